@@ -10,6 +10,7 @@ COMMON_SRC = \
             $(addprefix config/,$(notdir $(wildcard $(SRC_DIR)/config/*.c))) \
             cli/cli.c \
             cli/settings.c \
+            cli/settings_index.c \
             config/config.c \
             drivers/adc.c \
             drivers/dshot.c \
@@ -130,6 +131,7 @@ COMMON_SRC = \
             sensors/initialisation.c \
             blackbox/blackbox.c \
             blackbox/blackbox_encoding.c \
+            blackbox/blackbox_file.c \
             blackbox/blackbox_io.c \
             cms/cms.c \
             cms/cms_menu_blackbox.c \
@@ -279,6 +281,7 @@ SIZE_OPTIMISED_SRC := $(SIZE_OPTIMISED_SRC) \
             bus_bst_stm32f30x.c \
             cli/cli.c \
             cli/settings.c \
+            cli/settings_index.c \
             drivers/accgyro/accgyro_fake.c \
             drivers/barometer/barometer_bmp085.c \
             drivers/barometer/barometer_bmp280.c \
@@ -0,0 +1,4919 @@
+	.file	"blackbox.c"
+	.section	.gnu.lto_.profile.886e5061ff6073b3,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.886e5061ff6073b3,"e",@progbits
+	.string	"(\265/\375`2\013\305'"
+	.string	"fp\262<@\350Jk\f\215\211\205%\203\037\0317\252*"
+	.string	"\023\\\201\005\037(\363\312\365\217\002 v8\033\350\370\341\207}\3719\026\202\301\200\344\376\266\373]Up\365O6![\222\311\261w;\006\225"
+	.string	"\224"
+	.string	"\251"
+	.string	"\367\2243$&\020\326oW6Fp\207W\367F\275\340\250\025\234\340;\324P#\370\016\340\032\022\346\tJ-\210R\220"
+	.string	"\n\301\201'\244\001\247\002O?\035\3308\362\363\351\342\305\221\347\\\352\2310J<\002\006N\235\266\353g\201\217\004\006\b\b\220\016\300\336\364\361\365\377z\371\206g\220z\211}\214\360\n\211\251\335\032\211\366c\323\036B?<[\\\375\256^\342\307\264\r\255\f\335\271\332\026\267\2343\321St;\323L\350\247\371\322Uj\336#AyK2\226\214W\001\211\360\220\330\260\223m\264\274\3637\002l{O0\273\206\357\024\025\230Cqgf!\300\300\276\206\243;|S\226\301h\337\354p\001L~]\360\3020\206\256\355y\327\027\356\332\253\313\302\237[\025\276S\370>\341\273\204{\204\023\302\203\357y\236'\327\367\035\234\236g\203\357\001\266>\323\265\326\222\232\301\367\370\177\247\237R\217\243\007\\\273\031\336)\033lY=\325YTXc]-\265\325ou\325_EC:m"
+	.ascii	"iU\335\311\2711\310\242\372>\365\235j\251\247\226:\233\251\351"
+	.ascii	" \026Jy@l\337 \2402?B\f\342\262\313V\211vl\256\240\361\201\232"
+	.ascii	"\202\204\3124=x|\376\331\3313\270\003\231\336\211\204\346\217"
+	.ascii	"\216\0348n\330H\2364\357\374\276\250\325\2401\2348zp3\316O\""
+	.ascii	"\223\262\020\234\026\0311,\361pn\315\f\214\027\037\351\370\362"
+	.ascii	"\024\271\270_\017\177x}%\233\214\354=\244\223\324\306\354\265"
+	.ascii	"\030{\354\261\355\027Z\251\213\034 \013\261\305.^\024\333J8:"
+	.ascii	"\262\023\364[\241\"E\361\342\272Z/#\230\275;F(\302\016+\036\266"
+	.ascii	"\275w\370\005\254\201iu\330N\230(\301\201\350V\030Kj[\334r\316"
+	.ascii	"\\\273n}\222\332L5# \335\232;\263\212\335\"\247P?{z\201f\332"
+	.ascii	"\272\226\007\022\037\223\212\335\232S\314C5o\201L\264\324\330"
+	.ascii	"\007K\232\241\024\242\027e[\245(J\226|\364\240\240s\342\330\b"
+	.ascii	"=Y\345\b\025\3269A\343\336X\321\322d\304\"\254b\034\270\210m"
+	.ascii	"\013\023\013i\251\206hI\362$\372\305\315\262P\211\271\306\347"
+	.ascii	"\246.I\312\027)\216\037\022\324\310%\f\234<G\232\370\320\352"
+	.ascii	" 2\262:H\216\233\237\"\311\223jS\232 2r\210$O\242\351\231\273"
+	.ascii	"BU\206 \263\262\330\325\t9\373\354\344\311\263_\365\310\301\251"
+	.ascii	"\0051\333,\201/\250\24191#S\232\202\244\220e\f\001\005\3221\307"
+	.ascii	"`\321\003\022\240\003*\030\013\t\325\210H$\242 E)I\241\262\034"
+	.ascii	"\236\203\227w\300\351Q\371\214^'6\004\242\241\3537\350\304'\316"
+	.ascii	"=\302\310h\331\362\354\337y\252\273\247\025\344\310\027\272\310"
+	.ascii	"\215\376\371\274)$\016\335\026U\264\203\336\232RK\230\bq:\337"
+	.ascii	"\266\232.\004\355\246\225p\205\210\203\005ml\351\031c\217\"\350"
+	.ascii	"\271\020q\325\270\377^B\321\220\314@\013\260\361\025\231\023"
+	.ascii	"S\006\207\273\261\215L>\272?\370u\017\b\244\233Rt6'\265\307\374"
+	.ascii	"V@\331\351\212h\237%q\321\274V*@\262\375\343\274x'(8M1\240\311"
+	.ascii	"\n\261\316\347\243b\226\236\237\302g\260\374\031!\016f\253\002"
+	.ascii	"86\374\370\222O\352\004\253I)\264\336nv\nQ\020}\377\030\337\261"
+	.ascii	"\334\277\017>\341qn\231;d\312=\233\212\214\022\275\247\246\027"
+	.ascii	"qI\353.S\177V\317\b\202\004\024\305\206\266\004\244\356\343M"
+	.ascii	"v\311k\225\177X\272\276\367h0-\006\315\305\030\017:\3066T\353"
+	.ascii	"N\321\214\353\221\245\035\bf\307\263\321y\372\323!\317<\236\321"
+	.ascii	"\252\006\351\345~\370\220\262or\364;\266\250'C\266\341\026\231"
+	.ascii	"\265\020\235u\360\373>\256D\375S\342\253\275\321h\337\302\315"
+	.ascii	"2\263\311\206d\363\343\306\304n\373{/\330\2039qH}\276\364I\034"
+	.ascii	"\355\237\024\0166Z\f\262\001\375\256\352\022[\203!\353jhQ\353"
+	.ascii	"It@\376\311#\363\t\020\312j\310\226\212\316d[\250\374\315.'L"
+	.ascii	"\310\247A\212\357\304\b\365\355Mg\330X\203\031ww\005=XZ\335\311"
+	.ascii	"B\022h76\356z\036\347\253\360%\264I\266-\366;&\317\215 \331\256"
+	.ascii	",\372\017\277\031\302\260J\023\374\327\223\276\247^\274\027\234"
+	.ascii	" ?\233\326\321\264\216f\323\377\332\n?N\177\337g=\351~\266\337"
+	.ascii	"\332N\332$i\022\265\236\301\031Y\263\001s:\343l-8*\220\361:\235"
+	.ascii	"2\017\304<A\005&\247\366\r\356dd\312\262s\363\325{\243}\340\366"
+	.ascii	"<s\254\t"
+	.text
+	.section	.gnu.lto_.ipa_sra.886e5061ff6073b3,"e",@progbits
+	.string	"(\265/\375`\220\003\325\n"
+	.ascii	"\002L\"$ \221\323\030\b\364\272T\264\237\3035G\204#\376\372\214"
+	.ascii	"\262\310\007\b\306-0\034\n\314\211akD\302\2262\245\356 \347\325"
+	.ascii	"9u\036\337qr\254\033\3216$\30556c1\316\213\323b+(\366\t\211\210"
+	.ascii	"U\r\241\017\016\r*\303\302*\234\t\"\354\032\211L\300^\213\274"
+	.ascii	"4\013\260\373`5\270@\202\035pz\001\334\341\354\266Q\243R\266"
+	.ascii	"=\037\246\177\037\204\321\323%J6\331^,\266\244\332~\305m\362"
+	.ascii	"\371\350\335f\\!\001l\250\240\226\320$I\007\200\202)#\352\006"
+	.ascii	"\022\200T-\007\345\220`)I\215\215\375\337w\354\\\026[^\234\264"
+	.ascii	"\272\261Xi\201\304\340\276\232\236\231w\300\350\242\332\213x"
+	.ascii	"d\365\254\2154S\234\355B\223\266\212\233\204\303n\346\337\264"
+	.ascii	"\320\315\355\271\" ]\037\t\227\304\207\200\320\023P\224\224\310"
+	.ascii	"\224\314\331\210\274G\336V[\312\215\204\263\373\223\027\271\023"
+	.ascii	"f\301\213I\f\344:8\270J\025\320\0012\222\360@\0375\346C\241\304"
+	.ascii	"\200\305\271\305\020\254YHbX\241\037\335x\347\b\241\033\036F"
+	.ascii	"R/b5\303\003\255R\017\022\244\263\027N\365Ly.uv\271\\\250\b\360"
+	.ascii	"\357(\221kPa3[\232\243Cv\374\362\270\222\350\213\f\020\207\177"
+	.ascii	"\345es\031\305\002"
+	.text
+	.section	.gnu.lto_.inline.886e5061ff6073b3,"e",@progbits
+	.string	"(\265/\375`R\030-@"
+	.string	"jH\270\017C`\236J:2Ps\224\2129\217~\177\007\377\307\363\246g\251vc\215\312\2477\375\363\3243\366,\262\343\334\213\023U\324\253\346\033&7\350\274\234\024\212\2130\371:/\f-\241\0212\332\026\211\324\275\245L\001\326"
+	.string	"\354"
+	.string	"\356"
+	.string	"\277=S{\213\267x_\274Q]$\257.\317\360\366\274=S\364\321\243Q}\007\205\214\310\360|\317\357\033\3256<\337\276?/z\2155\257\316\215\033\363\351}z\215\355\245\013\320\315\276\357=U\225 f\376[?\321\377\020\255t\300@\201\244\177\200\200\243"
+	.string	"F\302\254\377'\026o)\315\020\355\342\304\263\212:\346J\231\261\307=A7\201u\023\330\213,\227\371#[O\317\036\276\033zjo\201\307\373\0217\201\021\325#+\2226@\222I\277U\345K\213\363\343\333\177e\321=\322\342\374\356\367\341\317|fb\320\275\367\232\277\212\016\273\367&!\353\334\2759\222Ns\250\207~*a\333\335{\321\327~\037\273\311\275W\350\257\252^\367^\254\376\271\252*\271\367V\370\035\234"
+	.string	"\206\327\350\032xEU\002I\272)h\022\315V\365I\234\337\033\244g0\205\270\371"
+	.ascii	"\314O\325@\201"
+	.string	"\002\375U)kofL\264\252\312\247\017O\230)\207\351\301P7\201\021\203\272\252\351\344\260\033\202\"\273GX\330\031{[\257\361S\335e\376V=\347\366\007\215s\b\361R\2639\242\231\f/\265\026\216*\346Rg\005\375g\341\371\252\326\301!\001t=g\300\267h\021\252\302\241c\303\205\242h8?\306\334\354\355}[\324X\305\370\312\320\361\224\275Eo\321c\377y9CB\274\355{k\254J0y\177\366\366v\252y|\245\r1\217m\277\320y\271#\364G\325;\313\275#<\364\327{h\026\321\354d\263\304\260\210\306b&SD\267\220c\247\326\262\343-5\246Sg\375<#\273\013\220\315\231\322\227\266@\261\002w\304\242\315\334\226[\320/\bfG\\\312\226p\001\016\325B4=v'mn8'\331e\311\201\233`\233\246R\366m\215\235\304\323w\254mR\\\377\252~\"\247\206\207\005\341\177\362\325\177"
+	.string	"\321|\313J\346M\364\221\205\267\236\225L\023\255u\033\304\213\254\315\204\263\304\217\b&\351\260W\037P-i\207\271 <17\230>\202gb\364\177\f\342I\343%)\211\356\257\301$u\254\344\252.\241\223\346\305?\356\304\327f\367^\001D!\230\213x\364\370\243\366\227T\342\252\261\254\331=A\272\007[LO\364|\355\333\236?\245\206\336\347\3734V-\201zjA\350\033M\337\351;MQ|\027\215\re\f\221&M\325\b\370\024\375\177j\016\204"
+	.string	""
+	.ascii	"\261h\313\214\371\324Y\027z]\321]Z\002\327\\x\007d\357-\337\304"
+	.ascii	"@XQ\355\260\255\23558\207!Um\273\367\022\005\357\rWS\266\204"
+	.ascii	"\333\320\227S\266\204c:\353\340\342k\266\3418\013\t\2134[\020"
+	.ascii	"#\200\332\013o\r\231\030\353\335\306\261\326\340J\247\240\245"
+	.ascii	"Q3p\032g_\031\205\215\311\3603v\230\037K\203\246D/cX\243\364"
+	.ascii	"\225\001\236\217\361\237\252\357\276\276$\211G\241\360\030\252"
+	.ascii	"\261\346.o\311\231P\335\342\025\315\307\336\031\321a\034-U_\255"
+	.ascii	"\366\"c#f\264W&\316\025\243g\235\357E+\331\270T\241`\345M\220"
+	.ascii	"\216\301]\374\365HB\316\250\230!\235-\270\375(\301\340\031\241"
+	.ascii	"e\t\203%\200\305b\233\032[\252*\2018yc\217~\312\211-\262|\013"
+	.ascii	"\203"
+	.string	"d\376D33\231O\2155\306<\321Zl\345\242\324\271K\177\325Y\372\312\002\321\262A2Z\320[\365\203^\365\033\206M\307 \372\365'\bH<\262F\3503]\252*\350\347\335\330DE\203\335{\207O\301u\307\266\026\201\330\250\241\26522B#\222\244 Ic\221\004D9\346\034\204w\003\022\300\0021\306\342$\345\2241\310\214\004\"\"\"\022$IAA\222\024\206\003\243&0\034\036\024\2652\006\247\202\256$\355\204\230!Uv\250\254]/y\362\350/\341np\352_`4$\275\304\372%br\350\272\003\303\254\3032`\350\335\300\342$\300\374\n\327]\b\247\256k po\250\025\370%\205\306\255\356\363\351pj6\"\2221\200\272h\223y\237s\r\241\352\177\325\001\213\036\013\304y\266\210t\300\271\031\321]svqO\300\205ql\3674\2112\034\330\024\267\217\tM{\245\236\314\303\343\262\221c?B"
+	.string	"\366\002RP\304\312\005m\244{\360f0\204t\211\356\240\"e\353\033\217\321^d.\301\027\2134\352\371\331\024\201S\260\227\210\200\325\366\376\"H\214\376\025\3134L\005\017\201\244;\363\237\264\304\005\320>\207\016(\216?J=k\301\002\205KaD\007R\326\376\0072"
+	.ascii	"7R\002\032\300L\371/\271\027\035Z7!\232=\226\373\2776Q\310\257"
+	.ascii	"\243\322\"D\305_~T\332\215i\241\1772\355\357G\346v\211\027<7"
+	.ascii	"R\346\266\220\273`\361\351RQU\246:\025\3502+~u\204\300G\340L"
+	.ascii	"&"
+	.string	"\361\177S\305\271\222GQG/\024+\312l&\273\356\355&\342\b\221L:-\215$\263\235l!\322\226i\232\306\303[\361[\320\037\025_3<\351!\217\002D\022\356i\020#\033E[2\316T\024\275\036MY\304\036UY\350Ee\222\033\265\235\034`Y\200\250(\336(\"\323\236\315y\347 prQ\216\365\342\024$ As\276Z\2513\352\312\326\321\315\030\336Q\031\207\2177NM@\217=,z4\206 \224\035\240P\340:\236B\306\366V\377\361\217\261\002VD\222\220\226R81\026\0311\314\270\370\3029\3219\177\313\262\274\301\034\334b\316v\273\025\242g\0313\217;Q\305L\366\204r\232\340\002\307j\361p\225\017Qu\313\373\327\256\035\363\316\210\271\356\266\252\375\220Eh^w\034\206\240\357j\305\321\003\223\233\001\334\r\022i\375\315M:\017\374M\252!\200\300\n\211EA\242\217\371m\031\305\241\001`"
+	.string	"A\275\321\335%\037\034\221R\3632\f\313d\356;9\372\316"
+	.string	"\327MV\232/\016\232\013\317\016\327\202\207\330\237KD\226\320Q\320%\017^\231o\035p\301\361\034_"
+	.string	"\"\035\367smYv\333\275\031c\364#\231V\bBT\327\303\304\377\026\033\2429s\260e\257\0162\025\004\357rY+\361"
+	.string	"\237y\355uWWA\223G\327-\335\305K#G\337\257N\270\t\222d\206\362\033\203v\257A\200c-\320\253\005\232p0\020@'\377\021d\231\003\3073a\323\035\b\314-#\bn\370.X}\260\370\017d\3114J\356u\344\247\033}\326\240\354j\035nw\373\316\034lS\251\017\277\232\320\246\305\th\256\0374*$#<\312x\004\220m@\001"
+	.ascii	"+\334hjR\250^\314L D]\322/\214#*\031\352\2358\326\331\315\353"
+	.ascii	"\231\304\371\342\314-&\322>\321\303q\250\240\241\203jO\253\331"
+	.ascii	"\301\003w]\036M\334nq\300\004`\221`\026L\356\205\254\035\230"
+	.ascii	"\363\361\334y\207\335K\313\312\224D\202\030s?@\3422pd\2762\243"
+	.ascii	"\246R|\234\302\033E\305$\310\322?\324\273\257*2\221\223i\017"
+	.ascii	"\250\204.2\271~\215\310\366J_\230B\177\256\323j\026\262\220n"
+	.ascii	"\n\330\215\350\f\226x\375\220N\243\375\350\231\346\020\2179\007"
+	.ascii	"\235\234B\334\002\254\210Q\324\277\021{0\317+*\246M\261\2326"
+	.ascii	"\240\241\200\002\001"
+	.string	"\024\b"
+	.ascii	"\3511\311\320\021\2351=\210ylX(GL\017\347\333\247Hz,g\212\325"
+	.ascii	"\344\301\t|8X\326N\253Gf\226\207\230\273\303\324\271%\314Z\224"
+	.ascii	"\247\241\221\212k\261s\243\260\260\372Y'"
+	.text
+	.section	.gnu.lto_.jmpfuncs.886e5061ff6073b3,"e",@progbits
+	.string	"(\265/\375`G:\ri"
+	.string	"Jz\344\031;P\3566\007\254\3050\363Y\3713\355K\351\235\307\314\247\217\3013~\337}\360\361{WmW\006\2626\332V\20656\263m"
+	.ascii	"\020\320\356#\005\374{\374\237\2677\263&\266vK\231R\216\001\222"
+	.ascii	"\001\215\001vhg\310<\322\274X!3\215\006%\017iG\212h!\r\310\250"
+	.ascii	"Nd\246\315*\221\2316{D\346q\226h\366g\006g\366e\366d\366C\223"
+	.ascii	"f\344G\273\321\\4\224#Z\250\217\310H\311(\311\020\311\360\230"
+	.ascii	"\221E\221\t\307Pd\036#!\321\302\221"
+	.string	"\017\231\307Q\316\b\206\314\264\361\311H$\024\246X\243$Z\030\033d'V&\306%\006%6\204\314\243\370i\211\026\212\222\232h\241\b\210\314Zd#r!\363(>q\242\205\242\222|*{\232\364D\013\263\241(Z\230\365L\321\302L&W\311@,U\321B\f\b\267\301]\254h!n\202\203\344!\026-|OO)\213\026~\243-Z\370|\236\314\177\027-\374(?|\311<~\321\302\223\314:\017\207a\264\020\307\030-\374@f\355/\031-$\311lF\013\021X@\243\20552\217YY\257\032-\214\221Y\374\007[\243\205Of=\3064\032&\361K\342WF\214\027\370}\207/\223\340\376b\030\370u\200\375\005~=\374\177&\031<\204\321\037\302\210\237\301\003\327Z\024\035,\320\210\261\213\006\037\347u\030\277\037\032\261\026\316\242\177m\234G\367W\024=Sx\354U\303\341p\370\205u\340<\226\370\361\177"
+	.string	"wL\341'<\376\374\216K\374R\341\267\352\037\323\260k\375\336h\304\377\346\337\315\343\367\256\0348\277\377`yF\374\376b\221\216\277H\347Gw\247\345\030~\363\277W\360q\223\273\006\025\001/\306\203\236\202\234F"
+	.ascii	"\357\232\306\217e\035Dp\316Y\036\337\274\334\273\270\334\337"
+	.ascii	"\177E\321\006\376\031\370i\377x\313\375\207\203\240F<\034:\320"
+	.ascii	"\335\275\321\272\263~\3461.q\017w\377\271;\230\243\022c\374\277"
+	.ascii	"\212\342\020\234\277\204\340<.X\240\272?\230 \337hs\333\377+"
+	.ascii	"\2126\360;\203\207\373\007I\215\330=\314w\270{\217\347XX\037"
+	.ascii	",\025 \300\357\007\326rw\035\356\245\337\020?\fg\361\253\306"
+	.ascii	"\327;\216\006~\035\251\005\3667\373\355\366`\202F,va\0224\034"
+	.ascii	"k\361\325X\304\203\307\217\237,\346\261\"E\342\214A"
+	.string	"\203D-\276\372\265\370\245E\035\346\337\t\242\214>}D\261jxj8\f\013\303\231\313\320\207/\366,\345s\224\307\377\206\312\022\f\245\205\006~Q\250\220\225\007\201=\377\273\310#\r\374\322`\341y\362\274O\"3\366\t\036\260\317X\341{\366\374\017\277*\n\240Jh*\241\211\022\350!\214\371\253\206C*\017a\374:\303a\251\302\371\360q\024y8\374\n\373\361\276\f\374\3128\341\356t\350P!\"\363\0362\217Tt\250\322l\241bBf\033U\0202k\233\251Kd\326`\330v\210\314\343\205l\004,\210\277\030\007\033\002F\004\277\221\217e\033\241<mlclZlKlBD\221y\024\364a\356XHX\030\020\007\030\327<\325\024\325\006\325\360\220ytS\373BfZmK\215\312\3735$d\326\265 d\036i\237h\220\020\001\n\255\211\376\254fn\252[\313\334\247Yrm/*\277\002\240z\231e"
+	.ascii	"\254\fm\273\177\\kj\345>z77sYfn\364\236\316]\325+\367\321+w\277"
+	.ascii	"\264\246\323m\252\225\335Z7?\331\315"
+	.string	"e\262\273W\362\266\217\312}\354.\335\226Ew\245\272\226\351\326\225+\353\305\033\340V\236\356\2556=Uu\367t\245\272\242\356N\327\037{\272*Z\352\330\003~\246\256\273\262=\267<\335\315\242\373\200\263\247\211nu\261\351F\331\263\275r\363\324\251^\255\n,\317\026h\345\351\252[\335\225\375ay\351\343\372\225\354\352\256\276*?\201\351\336*\317\324DKw\355\265\246\225\237\346\352\253y{\262@w\237\273\331\225\267h\327.y@\255\323\024\340\354\352\352\366\256\\]\3406\300\236n\212\356\f\270\231\303e\2319\231\267\273\335\352\002u\345\271\205\272\272\235\300O\336f\317\255]v\261%OE{\356\272\372\332R\307\026\360\363\347\345\226\355\351n\266\346\035\332\034N\227\303\231\351\211\226\300\235\250r\034f\316F\314\315\\\016\342\376?\334?\354u\317P\036\343\037\276\202\361_\301\210\377\027\020\272\025\312\202\032\005\017q\340"
+	.string	"(\230\250Qp\321\370F\230\340\234\301<\276\271\361\023t$)\b)\t\237)\t\370P\260\005'e=`\215\304\r\356\236\025\314\024\244$r\370X\226\311\356\004-e\n^\032\337\210\221|\345\361-\327y\374\232\211\305"
+	.string	"d9yNP\223\030\316[S\334n\305\231*\211\232\272\317T\304\205\n\031*h\030\323\335v\317\020\265\bm\016\002\356\326\242['{\345>\026-q\3636\207ks\243\253>v\335\251(\316d\367\032\342\352t\267\211s\331\355\2668\336\232\002\313\333\\\366\323\267U\234\273\333\254\b\0245\034\213\232\2638\026\332y*j\256:\365,\273V-\036\272\235j]\251\250\317\326\265}6\357\312u]\210\325\334\005\376\\\340\n\233\233\300 \3633\335\272\266\254y\02607s\323u+MO\035"
+	.ascii	"\007\346\262\357NV;\273\266\352\351\302UO\226\005\352n~\372P"
+	.ascii	"\367\267\256\351\314\267\252\247Y\266\355\251[\331\337\225\233"
+	.ascii	"\250O\263=w\3463wUt\375\361\330'\253U\356\237[\345\255\216\235"
+	.ascii	"\371\372\353:K\035\253\275\035\275\265\245+\253{:\027\375\315"
+	.ascii	"\270\266\227,=\267\316t\346#P\260\340m\237\314\307\232\237:u"
+	.ascii	"o\231\273TQ_i\336\254L\001\031\252\334G\257\312\304\362\037\320"
+	.ascii	"TQ.*\267Yu\355\364dK\037{\272(\226\211\376Jwkm\335^\250\250\n"
+	.ascii	"\027\204\231\256\275\366d{.\001/\027\335\332,\257D]u_\271\212"
+	.ascii	"n^\231\256\254\253\256\272\262\325\332V&\017\313\321V\335\254"
+	.ascii	"K`\346n\217\207\236\\\245\311n.v\335\231\347\271\303\362_[\236"
+	.ascii	"<\320_[\356vU]\333W\356vW\356\266\353\252U\356v\263\233\323\234"
+	.ascii	"\312\271\266W\351\242>4-}\300\202\376\250\362\332\"r\020\315"
+	.ascii	"\214\210\210$I\222\306\342\t\020\210ey\036\210\245\262\003\022"
+	.ascii	"\340\2414E\221\034Fq\2241\206\020E\f\"\312\020\021\tDdD$\220"
+	.ascii	"Y\351&\344\314\2079\314\227\302\020\242UH\262\250\312R\360\""
+	.ascii	"\342e}G \216\337\357\361}\374\tQ\037\027\222\203\350\t\224\323"
+	.ascii	"\304O\332\356\213\f4\300\227\224\377\243\274\351}\031.\330\373"
+	.ascii	"&\023\2138\232P\356R\234\347\303\220\253\r\203x0\017\"z\006\356"
+	.ascii	"\005#\023\352\321\247\250\202\337\265\237\252\331#\245J\211\310"
+	.ascii	"\350@D\227\374\225\215rp\216\267|\312\373&\300\3306\210C=t\202"
+	.ascii	"\001\243\355\275\332Z\235\233\026E\213\020\027d]\334\302e9\203"
+	.ascii	"=\3737y\300\364r\344/<\3448\2468\t\370\202\255\245\221\374/\313"
+	.ascii	"&\026\017zP\327y \320\224\334\306\3605\273b\fwc\377\013\276\214"
+	.ascii	"\217.\216\357F`LxegI\215\326\352\020\301\246<\036\376\331\003"
+	.ascii	"\t_\310\006\314L\t:\235\003YU\256+\222\202f\200\262\312\034\211"
+	.ascii	"\023\223\0309M\214\252\177\317h`\2727+\230\276\363<B\367\210"
+	.ascii	"\323\351\231,\252\007\016\314\350\255L\355oQ\274\322*\336\024"
+	.ascii	"S\337\344\274"
+	.ascii	"\240\3400\300\253\266\2440\354\r\004\300\205\177\023\263i\347"
+	.ascii	"3k\244e\032\267\264\322\276q\364\254p\"\b\255\006\016\260\347"
+	.ascii	"\262\222\216\252\345\371%s8L\0068\351\026Iw\004\257\350\352\262"
+	.ascii	"6[\233\313\221W\331\234\244M\207\3202\340]x4\371\351\342*\r\357"
+	.ascii	"\231S]W \0135\355Ym\023C\343\224\276\200`\025\313\274\240\213"
+	.ascii	"\25101\375\357\373\004kO\300\031\353y\337\200Kp\352_\304\374"
+	.ascii	"m\336\263R\260\tV\335u\223\310`*\300\207\273\2455\325\313I\264"
+	.ascii	"mu\306\027b\032\254\315;#wu\273\301\026\337~\013q\331\275\363"
+	.ascii	"q,\r\327I07CO\241\321\313v\215\223\227V)\273\225\0273P*b\252"
+	.ascii	">\nT\313\212\034G\2424A\003\257\335\021\b\221\206U\343\005&\306"
+	.ascii	"\370\022F\372r\271\300\367\371\020\304Z\211\f\236\347-\035\303"
+	.ascii	"\327\356W 5\256\0058a$\256I\r)7z\220F\331\214\375\336O\356\351"
+	.ascii	"\222$\265\343\243\261\177\302(\362\3223\334q\353\360\242%\241"
+	.ascii	"\361\257\206\fO\203$\223\2723\315tK.\016\267\236q#\315\023\201"
+	.ascii	"\334\020\264\300\341\311\002Sr\023\377RoQT\007\265\177\245\034"
+	.ascii	"g(\356P\315\333\301\276\305$\234\031\030\021\354\245\300\370"
+	.ascii	"\277\222\360\304\036\367R\022s\2563\243\220\250=.\206\276\263"
+	.ascii	"9\bIAa\370\356\207?\341\370\2103\200\026\326\020\3642\205/I\031"
+	.ascii	"\340.+\231\222\340 \204.%\030\241\237-\251]\006\246t\177b\251"
+	.ascii	"\002\330\312\0050-\200\344\255/\242\332\344yF\034V\277\353\257"
+	.ascii	"\235\020\257\366\210\274\327\325\367\234\344ubB5l:\3241R\336"
+	.ascii	"9\004\306R\270f\210\231\357P\264\347\221)\345\n$\271Yy\355"
+	.string	"\021\031p\023\023\301\372>@\341UV`\027\2379\017\036\325-mI<\250H\244\270\007\364,\305\302\201\203\304W\346;o\215|\0229\217<i\362\377V'\0373\256z>z`\210&\037\355\374\026\352i[h\373lB2\245\254\227x\224\362\023\341\344\030\007\313j|?\357\021\303\007\250L\260\314\346\023>'\345\252\020\322\366\216:\322J\022\351\307D\261\210\\\013\030\033\230\371\332/l^\3066\200\207\260\275\261\220\232C\201b\324\243\0208\207\304U\345\025Di4T\246\237\301\266@`pH\034/4\207\211\300\227%\363\300\335I,\035\252\310 \\\223\337\321~\200\265\274\2724m\210\361{p\033\324\261\310T9\355\001Oj\377pmk\3421\276\031\022\367L\031;\237\373\215I\257\342?\311\rM\004\307\321|d\367m7<\323}j\327\022\316FgV\007k\237`\277I\315\017\320\203\255\253H\030x\325F"
+	.string	"m\307\237\232\021\2705x\3573U\361\021b1\360\212\325\251sXo' \235\301\326/Gn0\261\300zOh\217\027\216\360-\266<\016\343m^\351\364\025R\2606{f\307\336\r~A\340\322"
+	.string	"\231\270X\261\351\240F\316\350d8\257\001KC'\366\357\307F_\361TDA\024[N\376\323q\037\\\335"
+	.string	"\300iM{\277\204\t\230"
+	.string	"\263\020\270\204\326\\\264\275\202<\360b55\306MO\005\271T\017\364,\372\343l-\370\032\037\235!c^\222T\0251\033\230E\326;w\212\226\256\273\217Z!%9\020\211\303|{U\033\355\034M\026\335q\367%*{c\360h\177\300\245R0\\\270\243o\334;\f\005\221C\254\017~?#\017sW\250\207\205\373\252h\206\3610\375\355"
+	.string	"\302\351\345|\322\325\031\266O\271\257\367\017\026\033\203\313i"
+	.string	"\244\241\216\204d\217\244\001\224\321\351\277\371L+mv\232]9QRo\246\235D\0230G\204\024\302\001|\2707T"
+	.ascii	"\316!\224<\\o\230\217\262\361`\255\366\307\332\212$\370\316b"
+	.ascii	"\313\034\221\244\244\0261\221\201\260\024\314\306\300\211'\312"
+	.ascii	"\031\203\277w\325\023\344j\016\240}E\324\304\372K\364;\227R\331"
+	.ascii	"\007%\020\333\022\220'\023\350\311\375\303\353\267\272\322@1"
+	.ascii	"M\177l\230#\307\221M\315\271\336b\\\235f\204\330\376X\032\020"
+	.ascii	"m\204\236\225\217e"
+	.string	"K\t\266\213\255\274\032F\b\200xt\244\"\353\211\036\325\272/\270\200\"|\362\255\324\203\214\372\230\306\353\363OP>\025\333%K\335R\326\254\362\006\212\304C\272i/&\033\347Xw\203\030\371Q\003P#{bb\362J{\245\030\255\275(\301\260\361\366\226\303o\224\206>\355\025\232\327\324\312\233d\032\254W{Llf\220\264\326~6@\235\332\024K\255Iu;\036\020rY\210\320\213\036\034\241\303\345\252\237%\201P@\222!6&J\\\302\fc\"\256\332\212\215\340\337\377~\252\026\343\214t\322\342\361\324>t\346\244\t`3\354\325z\f[\302\020\271\253,\262{6\226w\206 ^\013\375q\252\2519\326\275>\210\366\207\023\306?\315Q\222\033x\361\004&#\333\266\310\241\202\005\210X\225\036\224-\310L^^\2463f\266\305\f\255q$\364\002\b2\ny\355\236{\034\222\371\214\334\231\200\021\330=1{0"
+	.ascii	"tB\260\255\372\237f4P\236\375+\200D\233X"
+	.text
+	.section	.gnu.lto_.pureconst.886e5061ff6073b3,"e",@progbits
+	.string	"(\265/\375 \222\275\003"
+	.string	"\"\311\034\"@U\322\001\3061\354\334\216\257\353\032\226!f\252D\252L\020:j1\271\243E \377Z8\212\034\241\2217k}\031\353\313V\237\352\246>\324=]\323-]\3227\372D7tA\367szn\347\344\334\315\325\334\314\211\271\227k\271\225K9'\243d\214\214\220\3611:\306\306\310\270\213Q1&\216\035v\031\206\025F\30298\005g\340\004\234\r\321Z{\005"
+	.text
+	.section	.gnu.lto_.ipa_modref.886e5061ff6073b3,"e",@progbits
+	.string	"(\265/\375`\327\006\245\027"
+	.string	"\206\333Y?"
+	.string	"\223\223\341\270\252\252zU\365^\257h\023\001?\001\203\213Y<\241\270gs\"9\216^\275\374\314S\273\273\245\256\240\357q7\2419\350\344\322?\366Ot\024\303\021J\002\335\243\3326b\211\224)A"
+	.string	"J"
+	.string	"H"
+	.string	"\274\006FC4C\223\021\003\306\013\027\242\026\005\360\005\351l~{\333\342tfV\213\363&C}\217}\376\006\206\024\261\362I\026+:\231Rj\252\350\004\225\203:C\312\211R\352w?\370\201\005\274#\005\247\352\344N\356T\362\316\300\311\206bG\311m\232\315mT\201\222\300\003\016\331 \221\252'I\244P\b\303\262\246\254\250\224.\300\357Y\234\036s\313r\333T\251e\271\024\363\216\305\021Y\224hj}{\316\307\234\272\336\233\230f\216\032#\020\204G?\3102\221\312dU\002\323@GI\007\377\313\013\311\026\347m\362\355u\272\270\224\035\271\245<Gg\b\n\203[\332q\224\013~\2553\233\231*"
+	.string	"\261$"
+	.string	")\225\307e\"\313\250[Nr\243\"\250\324N\226n\002{D<#&\"\356\352\367y\236\217\347c\202\300\275\241N\310\310\224\270\376\313]=\371K$\376\021\025\021\002\304\363\003=<;\214Q\227C\251o\320h0\2312\364t\305\304`\350\005\013\233L\355JY\3415MC\341\251i\235 \201\021F\001\200\334\2501eU4\222\244Pj3\220\002\231\241\242\362\022\300\327\224\202\020;\nh\222f\331\377\016"
+	.ascii	"i\226\257i.@\227\226\366\2200Q\2658\0372l\323\202U\206\002R\026"
+	.ascii	"QU\036$g\244\356B1}\221\027\257\3616\001\006P\311P\241\352o\251"
+	.ascii	"s\346\n\001\345H[\020\315\304c*\263\003/Rk\220\267U|<#\370{L"
+	.ascii	"\200\245\tK\343$z=\342\002\360h\203\273V\t\356\223{\217\t\354"
+	.ascii	"\0347\311\212\316<+i\002X`\005Z\224\313\031C;l\210n\253\241\233"
+	.ascii	"\353\320\247</\355q\241\004\3037p\220\232Wj\331\314H\177R\032"
+	.ascii	"^\303\210\r\370w\376V7vZ\" U\033hYT\347P\232WRVj=\257\204\241"
+	.ascii	"\f\310/\245\315i\255.j\205Q\235\264\033m\224%~>\302\216\377\256"
+	.ascii	"\"\231\371\260I\245\355\201\177_0\371W\212\034\r$\355\301\244"
+	.ascii	"\245\215z16\2572\347\2651\036\230\261\254\240Kd\370(n3\371j\330"
+	.ascii	";\203\002\325\252E\013\202\312\263\361\274\322=x\002\357\301"
+	.ascii	"\242\026\264\255\345\032\354\304\245\034\224-\316\2225\034\212"
+	.ascii	"\246\n\252\376\226\327^)@<\2006\367\020\002NPu\201!\312p^\006"
+	.ascii	"|\212\3015\225<\263>\215h\364\021FWEu\2074\313\003:\030\327\006"
+	.ascii	"\314D\210\267J\272\020X\321 \326\300\217\235'\320\245%\016\325"
+	.ascii	"!(H\377T\202\210\332~\036\361\204\027\026\373\206\240\"\205>"
+	.text
+	.section	.gnu.lto_.lto.886e5061ff6073b3,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_blackboxConfig_Registry.102.886e5061ff6073b3,"e",@progbits
+	.string	"(\265/\375 \244\245\004"
+	.string	"4\bk"
+	.string	""
+	.string	""
+	.string	"-"
+	.string	"\005\001\212\001\206\200\200\374\342\303\335\341\037\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\307\007us\336\006uq"
+	.string	"\005\001\006'\001\006\005\001\006\035\001'\001\205\300"
+	.string	"?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/blackbox.c"
+	.string	"\005"
+	.string	"\001KEO\205\005\263x\212\272o"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_pgResetTemplate_blackboxConfig.104.886e5061ff6073b3,"e",@progbits
+	.string	"(\265/\375 :\245\001"
+	.string	"\224\002-"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\001\003\005\001\006'\001 ?\202\210\200(\177}\276\001{\275\001y\274\001w\273\001u\273\001"
+	.string	"\003"
+	.ascii	"@\210\224\241\007P\004"
+	.text
+	.section	.gnu.lto_blackboxHeader.105.886e5061ff6073b3,"e",@progbits
+	.string	"(\265/\375 b\021\003"
+	.string	"\005"
+	.string	""
+	.string	""
+	.string	"Q"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\002\206\b\177"
+	.string	"OH Product:Blackbox flight data recorder by Nicholas Sherlock\nH Data version:2\n"
+	.text
+	.section	.gnu.lto_blackboxFieldHeaderNames.106.886e5061ff6073b3,"e",@progbits
+	.string	"(\265/\375`\021"
+	.string	"\255\006"
+	.string	"t\013\265"
+	.string	""
+	.string	""
+	.string	"P"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\234\360\320\237\002}\273\001"
+	.string	"\005\001\006\025\001\005\005\001'8\206\b{\270\374Qy\276\004\330\367\001}\301\003\230\367\001y\304\002\005\001'C\206\bw\366\001u\307'K\206\bs\230\366\001q\311\001"
+	.string	"?\202\210\2000o3\312\0014\310\001\306\001\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\tencoding"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/blackbox.c"
+	.string	"\npredictor"
+	.string	"\007signed"
+	.string	"\005name"
+	.string	"\013"
+	.string	"\016\253\3044\244\006\226"
+	.ascii	"\302A\246YI\346\323}\\I\341\323\351\006\345\036\006\212"
+	.text
+	.section	.gnu.lto_blackboxMainFields.107.886e5061ff6073b3,"e",@progbits
+	.string	"(\265/\375`\321\016\265+"
+	.string	"\032B<\017?@\350M\007\004Y\007H\343\224\241P\207>\325\225a\316\333\322z\317\216\365\366A\271j\271,\b\254\367\342[n\313\306\016\022\017BS\r\210b:\300\036\022=}\3262\311B\214\t\261mJi\007\344"
+	.string	"\352"
+	.string	"\331"
+	.ascii	"z(\326V\247V\246\236\2375\311\317(\276`\346J\222\344o\344\030"
+	.ascii	"\372\334H\221\374{\031\\\210\017q\262\374{K\032\232\016\304\177"
+	.ascii	"\344\347\333\020u\261\277\374|"
+	.string	"1\220\303\244J\224\3627a&*\267\276\2463R\376f|\365\302F{\311v\304\347\2763m\252\322C\224lE\211\334w\266S\207B\206\222}w\310}?\017\340\001P\240d\017\022\344\276\337\013\370P\307'\331q\037\367\237KO \356\344\301\343\376\023\312j\016\235d\323\315\271\017\205\201\003B\274a\206\3652.\331p\344\334\207\306\304\240\322jm\225\211\200\210\216j\353\352e\261\231o/\303\332\355\330\313\033\375\226l6:x4\234\030\331\330\b\270\334\364\346\350\017\332SLL\331e\255\366\b*}mUm)`\253\301N\001\364\024\260\325\024P\232>)\njk\253O?\366>\332\217\203\241\242\320\366\343\006P\232\324\276\034L\300\031\251}\271N\203\364(\353\347`\003{\215\262~.>\240(Q\326\323\301Qn\305f\346\341e=]\334\"\250\354\263\265U\004\204\372\302\272\315\220\027r\277N\227\255\255\036H"
+	.ascii	"HP\240\027o\007\206\021T\356X[\215\222\212\373h\375\236X\301"
+	.ascii	"\036=Z_\007/\250s\307\216\326\327\3051\202J\343\332j\001\006"
+	.ascii	"r\350\314\331\372>\304\265U\003\r\334MWG\375M\322\345<n\306\013"
+	.ascii	"\242\021T\266k\253=\022L\301\275m\275\035\354`\331\266\365v\361"
+	.ascii	"\203^\252I\263\365w0\033T\312X[\205`\246L\373wq\2041b\332\307"
+	.ascii	"\203%x\371\342j\355\343\r\203\312\254\265\325\006\023\266h\311"
+	.ascii	"\237\007S\270b%\177^\\\201\312\224\374z\260\005\264\345\261\231"
+	.ascii	"P\236\344\017\\\274\213\203\3610N"
+	.string	"\306\327\374\214\243q6_\343Lws6\336\306\341x\034\237s:\307\343y\274\316\371\270\037\377\343\203\334\316\017\371\235\3539\"_\344\214\234\317\035y\2377\335\317%y%\177\372\337\213\375\217\007\362B\236\354\211|\221G\362f\317\344\233<\332?\371)V_\345\255|\226\327\362]\336\313\203\3710O\346\327\376\314\243y6\020\277\374\200\305\324V\354h\333\257I\341\315\025Ae\323\255n\366j>\315\f\217\324p\314\224\311\356\204\177\214\230\354\316xi\371E-\273\037\034\227-\331\2370\020\313\225\354\317\230iR\032\225\354P\230\r\212\224(\331\241\261\324\237\301N\262Ga\005=\365I\226(\311\036\215\327\234\216\030\311\376\007\007\370\262!\331\377b\001\313W\006\311\377\006\356\351\327KD\262\306!\022\013\354}\275\236\322a\221\210TS\026X&N\034\2119X`Z\343\213-\026\337\022\255\261)E~\021_0\344\360\b"
+	.ascii	"\311r\341pJ\221\307!\222U1tY\343\020\254\310B\271l"
+	.string	"\221)Ez]\275F\226D0%\036\217F5-a\342\3525\352p\203\251\r\344\373\026_\264-\333\224\2727\270\2065\200\251\361E\276E`\212\241\252\252\203\360\302\n\026.\206NiK\225\343\345\352jY/.\341\027\221-\n[\343QH\365 }\301\206F!\362}\215B\247\364\305a\034\036\201i\267i7\035\247\345t\235\266\323zzO\373\351?m\327\204\032\257\363zQ3\352G\r\251\375ZR?\033\352>|\314\203\270\322\313\234\210\037q$\276\304\231\270\023\207=\212K\3614\257\342X<\213\007\201\035\250\221tEl\025\244|\n\231\306\241F\"R\270:\0210,\247\214A\n\2232UZ\230\016\374\tY#P?\306\224Pg\251\007\034kt]1@\377l\312T\350;\002:A*@\"\375\240x\261\302\244\363\370S'\335#\0168M\217I\307Y\203\004@G\203{^'\335#\016\350\031\307\344\035"
+	.string	"#\240\252.L\201\266\361x\352\233\2055&\330\310\320\034X\261\266\002$\340U\225\3169\331:\242\343\206FNX\247\020\001\016\316\241;\005\024,YJ\t\336\251\330"
+	.string	"\240\371}\343\\O\251\373\226\326)\360\022\232Q!\033\356\275\245\024^\t\006\270w|@\301\215\323\236\307\235\342\244\347\027\007\3764\3014V\2508\314A\n\035%\302\222^\246\t\326\307\373\037\330|\357\370(\313N\216\324\3343L\216\324\013\377\377@\340\0219\"L\024\3608\305\260\231\202\375\n\214\004 Z\367\371\0277R\363\026\347\272G7\261\322\377w\356m\322Q\333\215\036H\252\037\365d\245\377\177{/\375\371\350{\004\372\362\341\375\331/\017\336\237\375\376`e\377\177\201\377W\211\321\224p\356\016\030S\211zbBre\214\265G\206r\352\232-Q\"\363\t!\310\332\212\326T"
+	.ascii	"K?\221\020\331\314\0016\334 \207/\316!\321B-h=.\340\215h0D\n"
+	.ascii	"EX\303X\025\301\232x\202\264\"\274q\244\212\340\366\270#VEp\303"
+	.ascii	"Q\tX\252\352\230\006\201\360~T'\340\223\361,yZ:zN\323\200\213"
+	.ascii	"\350\340\257\345A\250dP\030A\003"
+	.text
+	.section	.gnu.lto_blackboxHighDensityPFields.108.886e5061ff6073b3,"e",@progbits
+	.string	"(\265/\375`\203\001U\f"
+	.string	"\266\224PA\020\005;c"
+	.string	""
+	.string	"\001\340\036\204\020\244\377\b\013s3\336\302\255\347p;\002"
+	.string	""
+	.string	"\200\237"
+	.string	"\354 \037#\262\273M\220A\272\377\376\267\373\250@/X\231\326\t\371\007`\300\232\024T\2242\202D\251\264M2>"
+	.string	"?"
+	.string	"="
+	.string	"\351\203>11\357mmu\351\202>\366\214\210\240\027\247\212\364\261\367O>~\207\353\0370\213\203\230F\006\303\261\275\007\352\311\n\3448\016\304b\3517\216/\272\264\243\217\177P>\266\251\2657\020\240\034\034\364\322\324\n}\334\251\241A/m5\3651\301*\203\336\232\252\322\307\327\026\203\336\332*\352c\374Ov\251\231\327\246J\350\343\374OnaI]\033\331\245%}\\\240\222\262\357M\245\350\002\245\371\205\020\354f\211\345w\356]~\006\266\334\347&\263=\310CN\362\222\243\210\276r\331g\247\375\3450\277\035\367\231\347n\363\233\003P8\201\004\361k"
+	.ascii	"\327\007\b@\335\331:v\3511\002V$\307\023\333\022\004\311\301"
+	.ascii	"\034_`\266\247\025H\222{\024\226\236=W\343f\235\242\351\261#"
+	.ascii	"R\303.a\250\316N\234{\223\021a\bz\026\3252\211\247l\303\320k"
+	.ascii	"\233R!\2502}\253\021$\2770$ `\323\004\322\001C`\334\224\016\240"
+	.ascii	"\250uH\335lF\217\244j\254\023Q\203\252\031\363\354W\004\031\315"
+	.ascii	"\266.\314\231\247\274\243!b4~\363`M&\234\205=4o\237\337\020\215"
+	.ascii	"\316\234\2051\230g\357\336\303\203\003"
+	.text
+	.section	.gnu.lto_blackboxGpsGFields.109.886e5061ff6073b3,"e",@progbits
+	.string	"(\265/\375`<\001\025\013"
+	.string	"\204\021\272\001"
+	.string	""
+	.string	"v"
+	.string	"\005\001\006\035\001\001\005\001\006\030\001\177\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\255\222\311\314\n}\276?\202\210\2000{y\277\001w\275\001u\273\001s\273\001q\274\001o\273\025\001\006\005\001'A\206\bm\230\344\004k\302\303\005\005\001'L\206\bi\330\337\004g\306\307\004\007\001\005\001'Z\337\004k\314\315\001w\313\001u\274\001s\312\001q\273\003"
+	.string	"\330\336\004k\321\322\001w\320\002\005\001'e\206\be\230\336\004c\325\326\035\001\033\n\005\001'q\206\ba\330\335\004_\332\333\331\3308]3\334\0014\327\001\324\001\323\001\317\001\316\001\311\001\310\001\305\001\304\001\301\001\300\001"
+	.string	"\022GPS_ground_course"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/blackbox.c"
+	.string	"\nspeed"
+	.string	"\raltitudecoord"
+	.string	"\013numSat"
+	.string	"\005time"
+	.ascii	"! \360\"\022\233\007 \030\376pC\030!\002A\2242qO\264\363\030"
+	.ascii	"\343\363u\221VpK\"\335F\207\3148Oh\250\247dlBP\376\033\222\303"
+	.ascii	"4\306\261\333\255\374\267\3212\376g\270yf\277m\255S\326\305\320"
+	.ascii	"\203)\002"
+	.text
+	.section	.gnu.lto_blackboxGpsHFields.110.886e5061ff6073b3,"e",@progbits
+	.string	"(\265/\375 \302\235\004"
+	.string	"\204\007\177"
+	.string	""
+	.string	""
+	.string	"7"
+	.string	"\005\001\006\035\001\001\005\001\006\030'\002\206\b\177\005\001\212\001\206\200\200\374\234\360\370\314\n}\276?\202\210\200({y\277\001w\275\001u\274\001s\273\001q\273"
+	.string	"\230\347\004}\302\303\001w\301\020o3\304\0014\300\001"
+	.string	"\tGPS_home"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/blackbox.c"
+	.string	"\n"
+	.string	"\303*PB\b`\223\252\f\005\222\301\n\257\243\354\002\373R\306\033"
+	.ascii	"\034"
+	.text
+	.section	.gnu.lto_blackboxSlowFields.111.886e5061ff6073b3,"e",@progbits
+	.string	"(\265/\375`\257"
+	.string	"}\t"
+	.string	"\304\017!\001"
+	.string	""
+	.string	"\202"
+	.string	"\005\001\006\035\001\007\030\001\177\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\271\232\321\316\n}\276?\202\210\200({y\277\001w\275\001u\274\001s\274\001q\273\001\005\001\006\025\001\004\005\001'E\206\bo\330\364\004m\302\303\003\005\001'W\206\bk\230\364\004i\306\307\002\001\005\001'f\206\bg\230\357\004e\313\314\312r\206\bc\330\356\004a\316\317_3\320\0014\315\001\311\001\310\001\305\001\304\001\301\001\300\001"
+	.string	"\026rxFlightChannelsValid"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/blackbox.c"
+	.string	"\021rxSignalReceived"
+	.string	"\016failsafePhase"
+	.string	"\013stateFlags"
+	.string	"\020fModeFlags"
+	.string	"\025"
+	.ascii	"\022\007\001\013\253\016l.\003\207\001\363@\346S\226\001#\300"
+	.ascii	"\3506\222Q\246e\300\013`4\310\030xV\225y\302*IA\031\276\330J"
+	.ascii	"i\020\003p"
+	.text
+	.section	.gnu.lto_blackboxMayEditConfig.146.886e5061ff6073b3,"e",@progbits
+	.string	"(\265/\375 \375\265\006"
+	.string	"\222\f.4Pm\222\016$\237\255\242\300T \017\027"
+	.string	"\006+\214\246\270h\254\252?\373\366\357\226\206:*\270Y@\214\346\231\231E\024\321\207\013\2661\363\247\032\255\265Md\nW\026\t\013\243P]\0260\257!\341\302\360\252\353\341Y*[\016\b\327\203\260\254\353Q\264\354\210\002\035\364\334f\250\"b?\033\236v\324#s5\216\320\270f\235\256\206\352T\f\240\350\270\3555\216\303\213\257\224h\361\273\321\271+UF$\030H&h;\311\221ID\364o\236r\201\301f\254Z\006\250\242\222\317\207I\246\366\020\243X\035v\313Qi\264\205d!N\035\300Af\356\262\320D\307\376\003?\301_\021\n"
+	.ascii	"`\251'3 \f3\205\273\021\312\022\327\304\307\210\274\204\310\341"
+	.ascii	"\316\231\332\371\004"
+	.text
+	.section	.gnu.lto_blackboxBorrowSnapshotRing.147.886e5061ff6073b3,"e",@progbits
+	.string	"(\265/\375`9\001\345\r"
+	.string	"\026\231]E"
+	.string	"\261&\035\b\034\311\305\2764\310\230\036AG\265\332@\330\f7j\212\030F\234\326^\244v\203\332=\265\"\274Zc\236\020\001\232\247}\250aN\375\377\377\377\235,c\234\370\377o\3049a\001\266m\357-eJ\001K"
+	.string	"F"
+	.string	"M"
+	.string	"\003\342\241\276\374\364O\204O\363\344\243\376a\300\272\321\251\201\263ux\\\201\026\336[\020\343q\371\330R^\004\301!\226m*\251O\001\016\017\257\217\r\345e+\032\260\277\236,\233J\346\007dw\235\252\255\345\006\3356\312v\002\373&\001]gm\331\247\371U\323\231\351C\221\211\325\206\355\027^\354\256\272\236\225\001sF\330>\331Y\236\346\344\002v[1\\\354r\b\034\002\035\332\366O|\346d\337(\300\301\264\030\210\301\260\222b\307.\247\231;\201x\bz0\rQ[\231\f\f\230\235\205\001nS\"{\344\220`\361\324e"
+	.string	"7\305k\203\032\236\243x\215\311\017a\n%y\325\241_\022\017\257$,\0252\254Tv/(\033:\024g\177\022UY\031\\f\344\320\211\245$\017\233C\245\272\354k\327\005\"&#\246\347Q\250\002I\344`\024\362@\244E\030\t\201\240\215J&-t\300$\t\"%\215\204D*i\031\267\327\226\023\2324Aa6;\037fvSW\375uPO\314\352\246E\324\236\312b;\325 )Ey\273\273\037u}\205\210\034"
+	.string	"`\325\263B\300\325j\nT\027A\213@\b\310\027\030\005\311\206j\036T\354\020w\204\260\203&\264\007P\227Z"
+	.ascii	"\230\031\b\313\252q\r\234\232\240\241\302!?\371\250X\316\303"
+	.ascii	"\267Af\240\b\3107T1\317"
+	.text
+	.section	.gnu.lto_testBlackboxConditionUncached.149.886e5061ff6073b3,"e",@progbits
+	.string	"(\265/\375`\306\t\2250"
+	.string	"\332R4\022D`\236\326\030\373\210PsU&\370y\322\n+\331]y\247\352\354\243}\353\347\317\013\211\350p\251\032e\312\035,\013Y\272\361a\306\315\360J8|\323\031hC}PX\331u\336w\256m\220\255rK)SJ)\025\001\374"
+	.ascii	"\024\001\254\263\357\235Y\325y]\235\325w~\325\331\337\271\t\230"
+	.ascii	"\270\212\3021\325\315\271\367\215\232\312y\241\353\0251fnf\236"
+	.ascii	"\301\034\344Nk\265\031\275\026C-\276P[\315*\357\373\\\300\f\332"
+	.ascii	"^\211\272\207\355Um\036\266Wff\007\020f\260\233\244\341\224\327"
+	.ascii	"\300I\204\331\026\347}\237F?\244\335N\372 {\216<\306\235\"q\250"
+	.ascii	"#\f\002\177\255\217]\325w\227\333\251\223wejy>\300\261\262$\310"
+	.ascii	"\260\3561\022\346G#`\316\343webF\240\362\n\232&\335\351\033x"
+	.ascii	"eWyE\257&6\231\224\227\017\351\244\200\250DdRY\256\363ceQ\302"
+	.ascii	"\0075\234A-\247\036p\307\301\026\016\2744\351\257\237\316\272"
+	.ascii	"\r\2369\247\344\371\332\036\3152W\025A\026\030\035\303)\032j"
+	.ascii	"\317\230-5\301\251"
+	.string	"\245\253\275\2447(o<\323\244B\250\316\372\211X}\211a\375\360qU\005\005\234R\236\261\352\233\034]Z\210T\021\035\367\035\275\357\313\336\234\242j\376ifwf\226\300\334:\005\357?\340\3256\346\232\322\247\334\357\337\314\275'\237\262\320\231\227Nx7\373\375Y7\005U\276\023w[\263=\3368xN>\307\200\023\253\355\313p\233\031J\033{\265\352\270\311\b\225\241A\271\307p\264\337\316\262~\004\201\3510-&\t\204C.\355\254\013\267\027\237+\271-\334\\8\372CE\256\007\013w\026\216\376\270U\035\253p[\341i\255\3279\035{\343\2063FI\341\236\302\321\244]\325\357I\2735\024\216\266\3356\215\267\361L;{\265\330\270\235p\264\333\216t\f\266\327f\302\314\321\206\363\312\372\361\276N\235\305\314Qo\276\007z5~/\351\366\242\223\213\312z\263|\217\371\251\364\357b\356\237N\247\\\370\271\230\331y"
+	.ascii	";\013`g\"v\006\300\316B\354\034\304\316@\354\234dg\037vF\262"
+	.ascii	"\363\261\327\272\215?\347\342\317\231\370s\036\262\263\316;\013"
+	.ascii	"\3379\310\316\300\326\371\347sn\003D\342\007\025\201\234qz\304"
+	.ascii	"\347r$\03698\272!\032\333\276p\r\033\032(\327C\342P.\232+\333"
+	.ascii	"U\312\352\rMK\363\221\216\253\306\372^\350Y;W\211\277\256\332"
+	.ascii	"^O\335%\024\220\220\330^}{Vn\322\265+\315GB\025\300\373\263L"
+	.ascii	"\216\270.\252\233\006\207\274\355\n,\263\205\013\336M\"7P(*]"
+	.ascii	"T\227\007\005~\027g`\331O\276\320\0333\013ch8\031z\316\213\231"
+	.ascii	"\233\372\215\006\003^\357\373N\340\320n:\264\357\373Fh\363\302"
+	.ascii	"\003\201;0\027l\257\354\367\334\327\032q:\235\336u\021k\374\365"
+	.ascii	"\331\267e\0267^\347\271\340\006\343\017 @|SU\301A\253\372\322"
+	.ascii	"O\260\306\244x\277\357z6\037u\373]\354k\202vVA\017\337\006\363"
+	.ascii	"\360\005\260\276\357\342n$\226\020,\354s\375 \375L}\360X;\211"
+	.ascii	"\375\377$lg\240\\\217\231C\264\232\244\366}\241\"p\243\3514\""
+	.ascii	"\270\301ze\245\022+w\t\266\327W\365\252\354\244kOQ\232\217Tc"
+	.ascii	"*\230\226\232\226H\250`R\372\261\022\003\030L#N(\211@1\302H\305"
+	.ascii	"\222\210\024FJ,Z\0301\b\300L+J\2600jbbba\024|>\265\372>\027\027"
+	.ascii	"X\"\tC\"\177\301\322l\317\350\363\307\245\031\334\016\3203\343"
+	.ascii	"|\216\337p\313\262\260b\320GX:\367\204B\317:y\004\001\374q\t"
+	.ascii	"$\fH\364C.g\224\031\367K\276\f\347\235[\\\353Q-ai\265\346\023"
+	.ascii	"\360\256\345\204\302\214\373\001\255\034g"
+	.string	"\230[\234w\273\254\016\353\274\277\222\273I\363\221\232\374\2568-\374\34373\213\357p\036\031\334 \356\326\026\333\253\360\233\254\304H\253\354\272\250\214\024\352\323\223\240\375\250\240\213\305G\"\207\234\274\321\321\223\304\006\337\311\272\234*i*\370\022\316\034Y\340;\031\333\220;\320\r\024\212\256\213\312\260\201\362|\227\373\305\376\336\347W-C\334\206\373\3455\274\351\026q\215\270b\336MW\214\355\365\307E:\327|d4\340\314n\231k\346\335\004\352\002U\312\265?1\033\223\356\020\023\264\017\025t\200\310\250a4\343 TfHD\244 I\n\205\016\240\002\221\241\252\316\001\021\360<\246\260\031!%I\322v\240a\006\036\022\235\220\n\216H\251oH\374\371\035\246\"+y\222\001\261\332\262r\236\006\016\217\324\252u\20464\331\267\251b`\367\255\ti\210\017Z\034\002\013'\004u\240;\374\202\216\223a\311k\027\244{\017\316"
+	.ascii	"\r\260\310\376\031?v\315\357\322%\376\3127\036\241\231$q:W^\b"
+	.ascii	"\207'>\323\001\211b\020\202l&3\301d7H\231\271\221\020J\t\rI\t"
+	.ascii	"\211[\316l0$e\300\024\252\272\204\307\366gA\320\244\021\256\026"
+	.ascii	"|\345\304\225\214W\323\273\234\327\027\321M6\242\200\245I\005"
+	.ascii	"\366\013\025\002\331\245\tA\206\221i\"\210\366\341\202\344\033"
+	.ascii	"{\023\316f\025\335*\361\005\237\272`p\306$E'\357\315\332\211"
+	.ascii	"<R\002\025\377\311l+\263\223\336\356<|^\330Eh\272ETm\325\021"
+	.ascii	"3\260c\032Wc\226\032\354\f\211U\305\311\214\256\224C8\373\204"
+	.ascii	"\3339\220(\334b\023\343\273<\030\373s>2\210\002\005\336\360H"
+	.ascii	")\310p\307\242\376\310[\037d\373JCB\245\332\b\027\324\344\244"
+	.ascii	")D\021\022x\200K\005[\211\246\236\322\254T\r\311*\264\353\240"
+	.ascii	"\321/M\250\261\270'\361KN\n\021\252\240\270\244\013v\016\bDM"
+	.ascii	"\271T]\331\"\350\242i\215\331k\361\2155\r3\235g9Q\034\246h\250"
+	.text
+	.section	.gnu.lto_blackboxBuildConditionCache.150.886e5061ff6073b3,"e",@progbits
+	.string	"(\265/\375`\255\001\365\017"
+	.string	"&\235gE\360\222(\035\342\022E${l\227G\304O!3\200\035\363\216\256\030\366S\356\372T\313\0250\220yn5]j\273\251\332\243\220&-\270\365\2666\221Md\035\016\224/t\026,v\276s\267V\201\372\357\275\245L)S"
+	.string	"P"
+	.string	"V"
+	.ascii	"34R/v\346\234\331\206\260\324\322=2\302\325\222_s\270R}\\g\272"
+	.ascii	"\007\352LA\023\352R\260\3017\343\346\336\025\246\333T\212\240"
+	.ascii	"\220y\344"
+	.string	"p\030\352^ \311\234\363\323\235t\357=\256T8\\'s\365<\230sZ\271.\346\016\271m\224\355\005\366s\004\333J\205\227e\203\356\272%TG\250\206P\275\253VU?\024@'\247\273\n\306\234\032\276\330|\305\032'\356\272\375\025\276\347\317Y\274E\351\256\226\317\230yN\304\214\215\036sz\t\036-\ny$y\001\371\bO@>\376\343\222\275\343\300\31341\b1\340\"\030\321Aw\367\251 r\025\\\327\300J\005C\3056\375\256\023\304\004\013^\220_\222\215\216\223\002\261\210\312\265O\264\275\367\0018`4\257\323\232\226G\354\306\315n+E\372.n\223\342\227\260\312\212\236{\364W\344#\213\207\234\235\037.\372\331\236I\267e_@\020P\264\021\364H\304\242\231L\030\225P0\311P$\224\234d#\222J&\032\261V!\002)\263\240i\244\354\343\315/\313\256\3713\300\\/\227\335<\333\262\003.\202\026"
+	.ascii	"\t5\314\b\210\3039\347\224\333z\213\224\013Z\f\233\n\007\365"
+	.ascii	"a\323Oc\\\031\347|\300\335\215\373\324\206' @\002\243\220\252"
+	.ascii	"\033`\352\305\003\177O/\332\"&\325\257\217\271\264\0020\327\342"
+	.ascii	"\330\303\026K\260\240\344\022n\034\262\030\212\235\302\004\203"
+	.ascii	"-,!\020k\317\214>\253\232\r,k\305\213\235\202Z_\254\240\215\254"
+	.ascii	"\244\036\032\332B*\353\364\323Dw\f\205*R|\313\246eu\330\264o"
+	.ascii	"\022\314\023"
+	.text
+	.section	.gnu.lto_writeIntraframe.153.886e5061ff6073b3,"e",@progbits
+	.string	"(\265/\375`\343\021=J"
+	.ascii	"\032z\214\032=@\244N\007\367*G;U\n\324\366\001\226 \"@\233h\021"
+	.ascii	"\316\306`\312ca\201\241]\233\371\371\224\266\027\277\246\177"
+	.ascii	"%\374\242?\366\327?b\022P:w\273\333D`\023!{eK)\245\233\001r\001"
+	.ascii	"\251\001\252\321\371\256\316E\325\371Ug\277\316Mv\305\347\024"
+	.ascii	"\324\363b\367\203\322\326\310\024R\033x\375\352\032\260\273N"
+	.ascii	"\267\264[\257\213\314\315\314\311\274;B<w\330\202\333`#;\234"
+	.ascii	"\254\303r\272]k;H#/}\207%\214s\252\022\333\376\320\264\371\361"
+	.ascii	"\301\311\343\004\356\255/O\0357V~\332\330\264\236,po\235\246"
+	.ascii	"\3250'YG\243\341W\333\343\007\216L\333\266I\035\314\311\276\310"
+	.ascii	"6\323{\234\344>\323yl\353\361(\266m\322vM\231w\005\216\224\203"
+	.ascii	"\324\330N\252\324\007\026\232\264U[\005\357\002\311d\365\345"
+	.ascii	"\n\306\276\314\334\316\334d\372\216m\274\037|l[(}p\332V\272\305"
+	.ascii	"\\\306\276X\r\245\366-\266\223\332\227Y\346BS@Z\263\b^\302\244"
+	.ascii	"\3555j\333\226\371S\326U\212\277\213\322f\365\331\256\242\232"
+	.ascii	"\222\212\202zrjbZZ*\225\222\222\310\243qUo\361\235\345\336k\002"
+	.ascii	"o|f]%\246\251\304\330\371T\321\330\347H\230b\005,.%e\255\256"
+	.ascii	"\243V\ry\272\300\035!\031;(ku\rE\327Ots\356t\245\233\256Xq\246"
+	.ascii	"*\275T\205\212/\233\264\262\t\234+1\351$&o\236\21462\352\346"
+	.ascii	"\307\001P\326\226\264\261\373\034Y\322{=`\313\2216_\213Km\333"
+	.ascii	"*\325\322\212\r|\210\232\323U\244\026\266\276I\272Xdp\030g\221"
+	.ascii	"R\rH\021\312\b\026hR\r\315\277\3554\003\267A\347 \0335\266\366"
+	.ascii	"UC\333\266\354P\265\265f\253fv#3\233`^\362\021)\276\361\364\335"
+	.ascii	"\262DQ\336 \032HN\237r\361\3577\241\264HS\\_\374\266\323\306"
+	.ascii	"\301"
+	.string	"\274\271\351\023\316\331\377\207`\332\360\367@\331\n\370V\3733\263c\330\273\244\023 =\b\207\021\312\314\226iA\033\214}\215\376R\202st\240l\215\205\306\241\t\177\370\004\356A\366\351\201\213\312\034\017\265o\177\225\237%xW\236\341\231A\204\210D\345\274\246Y\216\312<\202\304\fG\201ho\306Q\316|\002\2057\224\025\024\"\006:\337L\253\371\360\300@\330\266m\005\356=\035\250\202{\256/\257`\341\re\241\366\275\360\353\0239\204pw~g>e\226:\375\345\244\037\205\371:\337\270\3166\256\363\330u\026\273\316a\327\271\306u\246q\235g\\g\260\353,\343:\307\270\3160\256\363\327u~\341u\235\273Z\254\316)Z\332\214\342:\227\270\316$\256\263\210\353\f\"\351\334\241\361\2723\264^\363\205\006lfv\235f\256w\336Zr\326Zr\316Z:3X:/X:+X:'xg\004\253\363\201\325\331"
+	.ascii	"\322\271\300\352L`u\036\200t\306Z\235\005 \235\003(\235\001\\"
+	.ascii	"\347+%g+%\347*%g*\244\363\324\321Y*\3119*\311\031\352:?%\235"
+	.ascii	"\235V\347\246$g\246\325y\351:/\223\316\312\244\263R\3229\351"
+	.ascii	"\350\234\274\316H\244\363\361\350lT\235\327\3259lOc\210\274m"
+	.ascii	"\305~l\214\3307\033\247(\ba\234\016&\352\255\342\310\274\201"
+	.ascii	"\2625\205\035\252\361a]j|\273\201Jj\001\342Y\240\276*n\314\024"
+	.ascii	"\312\306\364\344\364O\337|l\232\323\261H\234\276\341D\365\330"
+	.ascii	"\341-\321(Tlg<\r+3\276\373\226MB|J\323?\210\376!\342)\301\n\315"
+	.ascii	"\260d<X\024\031\337p\224\230 <\2111\304\235\260E\230\336*\316"
+	.ascii	"n\017\224-)\006\240%\030\037\203\t\214o?N.\261F\334\215\255K"
+	.ascii	"\"d.\375\203h\032;<\344\227\240Y\267/\376K\311\213\357\277\343"
+	.ascii	"\225/;\374\222\211/-\322\331t\332\tT\345wx\366\2646\245Oz\345"
+	.ascii	"S%>\2638}\252\346HX$J\337z\201\360\374\210\253\261H\222\260J"
+	.ascii	"\224\250}\223^\305\213\352!\266\031"
+	.string	"_nQwy[\021<3\255@\005\361]^\004\304\367\234^`\346\315\034\334][1)d\211\007a\345\222_\025W\227\006y|\344oq9\0206J\001\215\225;~\353q[\204\350\347\300\267\332\330\204}\342faq\336\262r\306\257\212\243\233\256\211S\032\322\372\275\327(\004\351\006\241l\353\313\361z\347z\375\027zVs\375\220\255\346\372\306\313ko\333\326L}9\256\367\372e\334\034#\277Y\256^a\351\2404\"[\247dVK7\222\240\276\005\267Av\031\260@\341\212/\307?T\021\377V\204\013\037D\202\205h\356\210K<\211\027\361\235\326\346\354D\255\350\007\367\034\263\\X/\336P\326\213\332\227\304#\250\322\226\342K|\337\327\352;\272L\354\213\214,\007\207e\231X\2161\016dcecaH\2611\260\262.\262\2572\260#{q\355\030sA\303\253\253\206\013\246\030XW\030\323\213\f\007\223K"
+	.ascii	"\217\331\370\"c\226\215\215\2211\223\322\263\376(\374\001\211"
+	.ascii	"\023\304\303\263wrw\363\217\312\216\310\0235\377\f6\003\005R"
+	.ascii	"\373"
+	.string	"\366xs\323(\321\326\033:\324z\366B\204\266\276\237]\360\250Y\257\265\205\301g\375\202g\360Tr\236~\n~\301O\021z\3025\221f@5\301+\370~\002\0166\r\215m{\326P\366?\016\250)\250I\250i\3304T\023\274\224\240\232\351\363\213\323\371\270`\037W:\325\030B\017!xf\336\362=<\242\250\350\371=\350!@\036F\307\203\340{\313\333\036\242_\224!\303D\256:P\026\305\300\037\200s\276\001\377\3639\210\\\316\355[\340\373N4\021\321\217\352F\244'6\376F\034\033\337j\246^\216\217\205Q-\376\013\241\264\232\211\342\231\200\305\266m[)\346\267x\247\274;\303'\\\226\023\030\360\002\236\3007\037\326\017\370N\213\324\307F\373\217\2579m>\254\357\277@~\001^\3007\353\304\333\260\321\tl\230\001\276\363\364\275\0235\264\373\227\266\255Y\024\200G\361\235\230\026\311\20337\0315\021\275\241"
+	.string	"\376\003\r\355\256\374\312\352\257~\353\251\247\352\251\336\352\373\231\305\271\347h\370M\363\021\367q\237\332\267\352\217mO\365j\342\363\360\314\247\236\307F%4\023\375Ls\3125\365=':\b\321\017\312\207\264T\23103\307c\345\244\f\241\001\201g\250q<e\221BC\"\"\n\222$\311\260\006\301\005\204 \305T^\007\021\320$sN)\")IR\350\221eS\220\366\243)\213\316L9\375\206\217\021\355`[\240\035dJNl\214\021\276\351}\375\004\fx\240\rC\3030\273\201p\325\027\242\312)\337\354\236\302z,P\326\216\361}/^\330\340E\223\334\235\027\233\312b\306\305Gr\345*\356\375\022\262\232z\177u5\331)\365v\"&\303\345\003\354\304\324\216\016\037IiC\360jg\023\331P@\004\202I\240\271b\036\230\271\f\235\267S\343\013J\023"
+	.ascii	"\371@\351\272\204\372L\246\005\313\025\f\351\355R\270`\263\304"
+	.ascii	"\202W\325pf\214\217\026^\324\211\376r]\351VJ\037J\373|;k\311"
+	.ascii	"/\207\241\375{\017\237\312\006R\272\036\237,\213\246(\252\214"
+	.ascii	"\"\363\357\034\251\213\316]kn\242\220\234\310\\o\333\363\203"
+	.ascii	"\311\021e99g\232\0247y\353\334)\357\327\246\207\222g\261:\213"
+	.ascii	"O\352;,\244fO$u\355\324\305\241J\201U\311\276\031v\""
+	.ascii	"\341\350lwE\237\267\022R\276\312\372\"\027\305\314[\267\326>"
+	.ascii	"+}\377\200c[\204\252\347\371\2706\222\376\350\036\201\017K\231"
+	.ascii	"\247;+\350\241\t\214i\274\2728)\351\360%&\331\003g\017"
+	.string	"?k\327\260\343n\206\025\030\252\310F\023\372c&\216\320\031\362\220\200\347\241\017Y\346X\027\007\265\242#\313\220\251\034\005f4uc\357\214u\364\303\244\312.\2569\"\306\302e\251@\307\376\007;\261\353\242\315P\323\347\243\230\206\004\035\030\2502\243\006\332\375\211\242\246\375sQ<z\337Q\243\207\272~\311\001\312\336.\006\017\254\364\026:\233\217oAS\326\023\301\317\303\352\264E\215\253\345r\203\200\007a\367\365\236\314\262>\204\327L|G\fb\241-h\253\260\246\345\033d#\220\227k9\244<\204o4\273B\227\033K\033d\373\311\375_[\305\304U\274!\210\303\313\214\214\031g\372\360P\235nmL%\35233\270\266\r6\211\322\016\336\f/X:z\022\231\340\205\375\320\212\310\023Mh\017\200\310\205\234 \233\354iq2\270~\035w\334u\350\346\270\221\255\256\301\277W\331\004\"RAt\3160E\3550K"
+	.ascii	"\r\3744@=0\362'\321\342*\204\244\013\203y\001\320\370\222\327"
+	.ascii	"\024\252m\002\332\370\035\315\267G\202\260>\364\277\024\364X"
+	.ascii	"\t\372\255C\375\312A\036j\005\315\317\223\033D\270@@\331\350"
+	.ascii	"\313\2649\255\246\327\246\374\001"
+	.text
+	.section	.gnu.lto_blackboxWriteMainStateArrayUsingAveragePredictor.154.886e5061ff6073b3,"e",@progbits
+	.string	"(\265/\375`;\003U\027"
+	.string	"\026-\231I\320TQ:X\347\2227\250I\325F\356\363\005\300*\016\f\02684\0010\030t8\2613O\217A\n\004v\030\377,\222\264\311Gz]\317\306\"\327\225\350"
+	.string	"\336`\324\352\013\rF\352\003^+\r\305\241\327\215\020\262\211\334)\005\202"
+	.string	"z"
+	.string	"\207"
+	.string	"\265V\003\247f\020\236\236d\333Z,\bO\375i\337\305_\274\356c!\317Toh2\033\265V\004v\tO\013|\345;\365\016\340;\365\313\006\202\212UX\202Z\316\006\031Gj\255\251%a\260,\313\362\236\355\366\346\353\324\333\371\362a\334\243\321\310\311f\260S\017\214}8Q\232\305\274\227\"\242\335q\23783\233\351\251\b\361=\356\224\246\033\222\315B|\202\nj\255\236\262\031\210\373\273m\f\266a\354]\005\273\232Y\3326\330\\\036\373/%\212\210\274;v\313\177n\324m\177"
+	.ascii	"o\232\345>\377\312o\367\351\323*\2376\201\323)\337t\351\323("
+	.ascii	"\237>\001\247I\337\264\311\247G\340t\370M\203t\372\243\323t\247"
+	.ascii	"\275\235^oz\356\364\005\224Nx\230}F\220Z?\224I\352\016\272C\361"
+	.ascii	"\237\377f_\206\2373\351GC\207\235Z\217\203\3601|\234I\247\266"
+	.ascii	"o\026z\005Q\317\341H\315\004Q,\036t\224E\355\004\"[\234\354h"
+	.ascii	"Q\326SB\352\220\366d\002\311[\223\245E\302\035\355/D\303\n{\374"
+	.ascii	"\326w\032\356qF\260\354.8\"Y|;\227e=I\235y\347\370\350~{r\205"
+	.ascii	"\315,}Z\272\317\035\206\207\256\307nn(6\333\333\370\356\306\274"
+	.ascii	"\205\276\0018D\354\020\274\006\320\356\211\344\004!\331\255\354"
+	.ascii	"\334\371c\303\222\232Y\0368\215\fa\255\365\305\237q\035\005\277"
+	.ascii	"\347\324\026\304y\231\370\235~?$'\250\026\243\350R\261 \254F"
+	.ascii	"\232\021\353\256\231\013\242\212f\030EW\213\325`\306\201k\325"
+	.ascii	"\212\020\341\3018\306\234\254r\301 \312PP\305T\220I\315\260b"
+	.ascii	",\244Tc+\345B\300\"\315jL\271DqL\221l\365\273\003\343\3470D\310"
+	.ascii	"\216\232\265\241\313\343\321\210m\331\3651\r\374\2648\001\366"
+	.ascii	"\264\367\271\351\270\231E\367j\255\325[\236\323\266\354q\207"
+	.ascii	"\241\351\206H\235\322TY{%a^\346\0027\0133jM\253\262\007\"S\244"
+	.ascii	"\254I&\345[\332\023\017\235\02129 \200\002\231B\242\007\340\353"
+	.ascii	"\305\002\377\356@\353@\345[\253\247\221B\032\034c\357\037\311"
+	.ascii	"\006\326eD\371>Z$5\3575\224\035\315A2\263\331\020k\274\251\315"
+	.ascii	"\347'F[\267\367d.l\375\261\r=Z\254\260\245\372\005\353\213\202"
+	.ascii	"\357\244\350\366\030\331\315\360\325.\374\310\336?vL\351e\367"
+	.ascii	"R\351]\304\304\357\201\032\356\222\310\204\375\220j\224\306\365"
+	.ascii	"u\0311_\007\246\274\367\022Y\344\205\3056\0360\021\323\325\237"
+	.text
+	.section	.gnu.lto_loadOptionalFieldDeltas.155.886e5061ff6073b3,"e",@progbits
+	.string	"(\265/\375`^\t\255."
+	.string	"\352R\304\021D`^N:\263\311\345`p*<\361B\023A\361\263V-\246\\A\352\265\315D%x,f\350\317\372X\\\304\211\367\203\203\301p\210c\211\2443\353/\005\301X\277C\335\215o\013\205l\354\337\244\221M\344N2\b\001\366"
+	.ascii	"\007\001X~2\237\271\311\30018\220\300\241\tK\355\340\204\311"
+	.ascii	"K~i\262S\246\313\363\336\226\312k\371\026f \313x\026nd^\237\345"
+	.ascii	"\224{/P\0063\360\026e\036\362\257\234\356u\f\3042\303\253x\343"
+	.ascii	"\002\\\034\223\017s3\212n\233\3735!prx\356e^\270\025n\376\256"
+	.ascii	"\335\337x\003\227\005\317\275\027\301-k\245\267\225\371r\247"
+	.ascii	"2<\223\306\215\356-\222&\314\275L\005\274 \275efz)\2372dn^\260"
+	.ascii	"ADb\301I9\322\365\271\367^==\t\275=\217\204\336\366\021\356\237"
+	.ascii	"\314sZ\207\037\n\002\205~\251O\210\332\263\353\220\357\363\262"
+	.ascii	"P,s\227\206"
+	.string	"\254\361! \017\002QV \324\220\265\266\013\235Om?\352\357,\302j\036k\352\3632\262\226\274\357\304\344\205\315C\265\331\301\006\325d\307\262\242>n\2156\352\311\343-D\242\235O\367\336\327\275\252!\213\265\372\274\356\275\\\323\220kg\2423\237\211\231Q0\247b\002\335\240\177L\026\217w5_\3747\006\013\013Co\037\364\355~\240\n\230\267e\\R\301\321\244\350Br\206A\177\207R\r\\\202\233I\3619\275{\357\026\377\356e\304\370o\267\274\202E}\032\013\364\026\253\1775\340\354Y\306\331\021\353 ff\261\266\033\363\353\275\267\006w\021\346\264\362\204\264\262\204\264\262WZ\271\213+\002\204\255\264\362\003\255\264r\2033\377\254\317\235\031\034\313\031\353c\316V\006\252\250\246\244n\345\034e+C\275\362\023Z\331\t\255\\\300V&pVn\262\225\231\316\312\003l\345\245WVB+\013@+\007\260\225\223le"
+	.ascii	"\2662\322+\037\241\225\215\320\312E\2662\221\257\262\320V\036"
+	.ascii	"\362U\016\332\312\300W\026B+\377\320\312\251\255\354\263\225"
+	.ascii	"Q[\331\332\312\347Y\271m\345zV>\005\030>t\344@\236K\336\275:"
+	.ascii	"\006\001\272k\254\335\222\217\371\255\374s\177/j\243\256i\246"
+	.ascii	"\272h\252\267\372\3343.\205M\304\207\303\361\366NF\330\307\223"
+	.ascii	"c\027\354\241>\017\225\\\017\207\323\351\335\213\266\305\334"
+	.ascii	"\341y<\334r\351\005\373\315W\360\241\274\343\247\333\327n\374"
+	.ascii	"\377v\021~\335\357vd\023d\265\232\3173\252\245\274\240\260)\362"
+	.ascii	"\352\177A\201*|\2156\260\227\350\214L~\235\325B}\343\223\363"
+	.ascii	"|\006M\373\327\017dl\022\325i\377((\301\243Z\253\317\246qY\264"
+	.ascii	"\243\364\365\357\222\310}8\035\020K\264\217\247\314\263\355\306"
+	.ascii	"TG6\271N\360`\035[\216\212\340Q\255\306\346]N~\273\372an\223"
+	.ascii	"l{W\362\352\222\305\3236_o\370#\004\221\036\237\306^Z\236\263"
+	.ascii	"\227\366\214L\212u\020w\237\3758\312\356\343%\221{\327\266tG"
+	.ascii	"AD\036\3617$\322{\321\034\360\335\f\227%\322\267\031\350\355"
+	.ascii	"\033]S\302\361#\367{\357m\376B\033t2G\223*z\334\314A\253\177"
+	.ascii	"\230\231\367\336\n}\0201~F\026ff\366\202\002\321\231\213\257"
+	.ascii	"\f\3013\262\027e\024N\214\205\211U\030\373\"+\023;kQv\344\342"
+	.ascii	"\353l,\354\004\312`\013b\224\231X\001\3665f\342\212L\354\213"
+	.ascii	"\305\025\230\231\213\253\005N"
+	.string	"\\\326\"\314\354\352\254\254\314\354\n\310$>\210\240 W\363\t\254j\003\255\306\314\006\372k\370\364XC\354\342\020\224\034\201fj\250^\242s\352\254~*\320NU]\240\252\271\232\232@\237\330\324\277\033\320L\030\352%\261\034\320\f\220y\200\226q\301v\343\327]\b\t\\\235#\030\241\b\315\347\217\252\253&P9\357\204\376\026\340\322\206\244\006\320K\255\344E@g\265R\200\026@\325\001\250:\002 eR\037\214\0349\242\206\377Y\002\350\327\335\342)\371\300\t\245S\315'*\325T\022\242<I\350w\371\265\033\377~\370 t\322\261\355\213\020\301\255Z\355\315\377\310\261\r\317\267\325|\n\245z\252\325\254\372w\256\374L\333\315\252!\364\021\021/y\306%\222\210\020I\266I\324C\215\324J\201\214:\253\217~'\200\272\250QP\004\221B23\"\"I\222\2445\360\002\021\251\031=\021 \231tN2*H\2461"
+	.string	"2\246:\n\314>\037\202\022q\254d\024\341\371-\271\347\204\212QH\343\036\206\344HP\202\b\221\263,Q\222\243$%4\006\234\204\245\036gR*\321\24029\340\017\347\223\272EL\233|\f\2700+\377\037\361l9&\306\315\245\350\b\247y\255,\366\304>[\351\"\\\364\301B\365%\320.5\272<\2075]\347\351S#\306\003\235\225B\254k\306\202\203>\311\270\370\001\017\001\220aE\273\307!\213&ta6\022\205\301\004{\022\215\223\025\266V\n\fjP\203\341\003\355\201"
+	.string	"\225\004\363\3560\217X\303\020\0311vQ\366\260t\312\321x`\314N\034\341a\355W\204\213`\2368\340\343\253\217\033\222\307(b\2759\272,\263\236\t"
+	.ascii	"!bw[[\037R\252\030&s\320_\271Q\200,/[q\261Q~\033&83r\232K\336"
+	.ascii	"bb\242\352\264~\262\027\362\346\352\332j\341m<DV\241\022\247"
+	.ascii	"sM\026\362\306\310\177{Hl9.\236@q\361\230#P4\323`1\246D\001."
+	.ascii	"\206\021`A\222^\263\225\366\214\003 Z(\314S\364\255h&>o]'\224"
+	.ascii	"Y\005Of\230\227\324\207\nKo\333\262\032"
+	.text
+	.section	.gnu.lto_writeInterframe.157.886e5061ff6073b3,"e",@progbits
+	.string	"(\265/\375`\347\017\275G"
+	.ascii	"zw$\032;0\346J\007p\217I\336'\025\ns]\316\217#%rp"
+	.string	"\363\353P\340\024\342@\230\201\202\334\324\202(\030\030\027\216\335\275\231\355j\\\321\347.\216\312\177\365\037\003\202\366\336{\247\224R\212\001o\001\235\001\250\363\253\316\216:wX\2227\265(\314\006dt\257\332%Jw0\355#\323\200\335}\272\355\272\341t\317\351\326\353\336\353\225\271\003\031)\251n\231\370\307\017wh.\252\371cd\037\366\243:\273\273\314\025/\020b\2331\226\217\226\276V\224s\2765\236\316\303\214d\"}\207\237\251\210\350ls\357Ev\212\3544m7\215\327ym\247\371\030\271G6\"\331D\005\2331s\367\336\201\261t\272N\333zdQ\227\3606\023\221\r\231\304{\357j\260\235\362\035\033\247\345\264=\347\bz\351\240l\366\346b\260\235:\325]\277i\033N\2226Hl\370\022\357]#\301v\3327\212\273M\327\265m\267\244\257\224\333M(\325aI\274\367^u\312Zl\247T-\245v\212\266"
+	.string	"\265\323\226y\321\024\3325\273\300F.M\216\244{\357\326\203AQ\224\211\277\321\273f\365\333\216\202zrjB\036\231\330UM\321\367\226\233\257\0338\017\223\207zL\263\216z6\3243\213?9\333\311\331\364\246*.R\336\032\331\204ko\315\207\305\217hS!3W\232p\355\nj\301m\257P\007vU\231\2656g\252\372\"\305\255\331uD`\243uK:.R\334zE\243\356\275O\3144\224\313\2350\223\256\036\351\330:\255\322(J!QO\244'&\032*\2456f\211d\236\371\367_ShF\302;\324c\262\265\257#\356\275\354K\246\224f"
+	.ascii	"\315\3343\230\231\b3\324\200\227\226l\t\374\370\314+ZP1\375\361"
+	.ascii	"\263\322,\261\257>\323#PT:\027\203\260\337\212q\375\250\025!"
+	.ascii	"y\247\3537#C}\351\373\253\277VR\316%\375\022{\303P\321O\177J"
+	.ascii	"PY&\231h\004\375\3763\264H\321\177\367\211{\321"
+	.string	"\210`\260\367\336\f\334\207\224\310`\345\310\324N\375?\304\331!\222\261\207\375\r\3304\\C\3009O\263\237\312L\243F\021H\203go\306\002\234\331\006\016\357%[Ez4\230|\263\254&$\373\360\034\324\341\307\232\177\214X-\210\f\004\342\275w\003\267`\007\322\301-\327)w}y/\277\324N9\374\272E\221\032g]\037\023\277\304|\227\364\207+d\306-\017\277\027f\325\031Lu\376R\235\275T\347.\325y\207\352\254#\307\215\325Y\206\352\034Cuv\241:\263h\273\346\024\255\327\334\241\367\23294`s\205\356\323\314\205:o99k99g59c59_59Shr\236\200:[\241\316\022V\347\b\2533\204\243\363\203\325\331\301\321\271\301\352\\\205t\246Z\235\031\254\316\013\216\316\nV\347\004Gg\004\253\363\201\325\331\300\321yju.pt&\300:K\261\316\003Vg\001\253s\200\325\031"
+	.ascii	"\223s\324\352"
+	.string	"\f\305:?\261\316N\254s\023\353\214\\\235\217\2523\223\352\314\242\316\253\352\254\252\316\251\352\214\006G\366\306\377\241\365\252+\274\023\264\002z\357\275L\025\376\306CuA\374S:\031\340\265p\005~\301'x\006\277\372)\370\005d\332f\373\215\331{*\370\366C\360\t\344\332\246\206'\026\027\243\205\340\033\220s\316\232\276\003\337y-\034\224\013.\035\031\370\002\177\340UA\345\\\362\r<\333f\337y\202i\267\304A\234\372\276\023\327G\340\013|\247Yzs\270\266\271\225\305\275\264[\"\020\370\016\354\324\316)\347\351X\306A\264\001/\345lJa\351\342W\226\003\276\371\232%,\024$h\311\266>\034\257\200i\216\377C~\325\\\357\204\353\333\016\257\337m\257\320\033\365\341\270>\307Cu\t\304\310\323\004. \300\003x\001\337\212\224sI+-\\\013>\331\032\017b\200o\301\270\326\351TZ\270\020\334\202\361)\030\236"
+	.ascii	"\276\033\233\213\214}L\330pn\315\f\nCe\361oQ&\275yTx\350\314"
+	.ascii	"\0339\306\273x\026\337imI5_\203\301-\307m\\+\306{\331\212Q;u"
+	.ascii	"\361\021\342\332d|\214\357\250\307j\031\337\177:-\343\246\210"
+	.ascii	"w8\207\022\324G}+J\2634\305\365P\337\177\315\036\342\005ZT:\223"
+	.ascii	"n\306m\257\321\363\004_@\246\245s3x\346\364O\336$\355\311\321"
+	.ascii	"\304X3~\346\364^\205\202\213\020<\253\037<\323\264k\026\351\006"
+	.ascii	"\321\336\214\033xV#\277\351\373N\347\265uR\210\255\033\022H-"
+	.ascii	"io\306\334\226*=i\372\324o\311\326\223\304\226\314%\272\361\304"
+	.ascii	"\241v\211|\257B@\001Fz\fH\230\020!DJ@\215\r\351r\321\004\246"
+	.ascii	"\016\351\032\363\021fb\f\b\017\261 caC\236\306\200\020\021+\001"
+	.ascii	"\346#\214\007\n\037]@\304x\214\005\021\013\300_ZF\304\274z|u"
+	.ascii	"\371\360\332\002\302\243\353\307\326\227\220![Z\fX,H\230\220"
+	.ascii	"\255111![\310;&\375^R\374\031dLd\362IN\002\347\bz/\027\021\211"
+	.ascii	"p\312\032\251\354\214<\261\254Q\331\2432EE\265S$\316B\222 m\275"
+	.ascii	"\242DZ\317~\310\320\326\267\362L\240\232\365Zo\240\222\262\f"
+	.ascii	"\326g\375\325c\275\001?e\037\205\277\372)EJg?i\006\244Nx\n\337"
+	.ascii	"J@\311\302\262I\354\275Lz\311>\310\t\313\026\313\030\313&\225"
+	.ascii	"MR'|\201\302D\202\224h\254^P ,\007\024he\270F\302\373\0372\002"
+	.ascii	"O\367#g\351\310\373\270\237\204\3572NB\214e\225\032+EE\200\360"
+	.ascii	"\016>\3027\237r\356\301C\320\3236\033\3173Ok\226\207\370\340"
+	.ascii	"\033O\203w\340{~\247mf@,\273\344|\255\331V\332\340\033"
+	.string	"\320)\310\b\0056\006\375z\260:_\337y\252\236\375PQ}\325;\236a\236\245\020\316\334\242\265i\336K\252o\301<\277A\306\304\344\233=9]\267a\377q\362\032\344]\357\005\247\353\273\257I\217N\343\236*\3039&\362\341\330\231\275\303\333\324\302\230u[\251:~G\235\216o>=\341\r\0369g]\233\007\317j\216\323:i\241\270\201\340)~\201Z\343\032\r!\246\264U\274\227)\036\035lL\203\327Z\261j\244sk\351\232\257\373\331\230%\2017\250a8&\225b\206DD$)H\222\346a\005\204 \007\035\274\016\021\260$\350\030C3c\222\024\025\262q\200\201?g\227\374?(\373A\351\037u\377\271) \323\271\250\362\2005\333\021\272Z\213\335&s0\033\036\325\334\313p]\371=G\024`\303d\277\007\216@\201\232+\t'q\221\022\235U/\334\361\324.x\033\006\320{\306\217=\225G\306\302"
+	.string	"I\001\350\277\2456\220R\b(\307Fy\004>\277\306\2744\\\3230\273\231\322\346F\272$\237\037\213\0320Y\226\243\351!J\020\323\276\366"
+	.string	"\205\002\342\352<\0131s\266\233}\271\244\226,Lm\006,\331\227\210F\362\220\002\220\260\371\250\321\217\205\021H\314J\263P\007\366\223\236M@\367\371\004\230QM,j\351\344W\304\2238"
+	.ascii	"\213\210\"b\323\305\234\374\233\217\211\177\\\253v\251^\337\016"
+	.ascii	"L\037I\262A\017\f\204<L\210\321;\351c*0\023\330\364\312z\336"
+	.ascii	"\006w\341\244\271\251\223\241\331\037\251\340\262\344\031\235"
+	.ascii	"\017O62\023%5\312F\224!\276\201a\235SW[\314\302|\334\301X\251"
+	.ascii	"63\330\240\370\207T\035\034;"
+	.ascii	"\244:3\325e\332\207iX3\007\021\021\272\036W\231\313r\262\207"
+	.ascii	"H\033\340Ha\265\272\361?y\240\340Q3\366\352x\300\355R(:\347C"
+	.ascii	"T\005\221.65-L\f\264\316I\350\215F\273eY\356\035\312f\361\341"
+	.ascii	"d\302\306\260\204=7\265\353>3\332,\020\023\0259\300\200\026\332"
+	.ascii	"\3704x\037\307n\357\\y\315J\345\244\337iW5\370\266+\255Z6K\271"
+	.ascii	"st\277\027\213\256\263E\260\236\264\252\341%\023\325!.n$/\304"
+	.ascii	"\327\017\363\023tP\361\220\306\013dT\246\265\317\314d\223\362"
+	.ascii	"\320\203\310.X\016\320\317S\326Y\323\031\223\362\n\002I\304p"
+	.ascii	"\0238>\006vz\256\r\017UB\267t\305Z\235]\016H\375\357\230\245"
+	.ascii	"J\200\336\343AH\234J\203]\003\316q\232\"\332r\303\353\356\233"
+	.ascii	"\372\354\223\361\256K\037\002\344\333h\351-F\b7i\246\253\341"
+	.ascii	"^\2748\031\2208t:\345\314\363\362\335\337\023\005\262ug\304\200"
+	.ascii	"^!`n\255\001\267S\034}\001I*\304\374(l\302F\013\023\373i=_n-"
+	.ascii	"\253X\202\301P\306&_\275\352\231S;\275\212\356\017"
+	.text
+	.section	.gnu.lto_writeHighDensityInterframe.158.886e5061ff6073b3,"e",@progbits
+	.string	"(\265/\375`\026\022=J"
+	.string	"\ny\210\032@@dR\007\214\007\300R\t\025c\n\317\201\365(\311\r\325\025\363\t\311\313\225\206\347\345n\221l\366R\036\313"
+	.string	"\305\317\001+\204\376%\375\257\317\250\356\312{\211\021u\b)\220f$m\357\235dJ\001\212\001\200\001\243\001"
+	.ascii	"\202\271\225\336\334F`\356\"0w\02207\02207\361\315=ts\013\335"
+	.ascii	"\334\301\317\rts\277nn\327\315\335~\356ws\347\317\355;\340;c"
+	.ascii	"H\242\216\b/\216\307\262~1\235\033\347\305\345\334\321\270W\335"
+	.ascii	"\331\270\273\271\303\361\267\333\361\334i\rS6.\247\335\332D\271"
+	.ascii	"\2754D\270\202qst\024\3641\3637\237\323M\354\036.\247)L\355\366"
+	.ascii	"\334\355\356\321Mt\267\3654\256\306\333\374\215\307i\"\034\260"
+	.ascii	"\017L\"%"
+	.string	"\326\372|\211\343\252\2146\356\006v70\245\030P\354\321\2735?yq\\]Q\r\372\322\273\306\331`g\003$\310h\355P^\034\223\241\b\272\233cgz\227\336j[\003\255eA\004\335m?\343k\260\243\021\342q\222\330\211\370\245A\313\213\343x\312\335\266\n\272\373\344L\257\273\255/\275\3566\334\235\250\251\031/-\254\315=\333\366\3428>>\226~o\253\336o\206\335XLB\"\016\205A\340\353\266\237\341v\340\2078\316`ze\263\203\023]\272q\352\305\2514'Iq$)Q2\021\212\017[\251\274:\215\034\020\031\224\226i\254\013\364I\026.\250\222\304\211\007[\007j\217\3568 2'm\2016\315,\036\307\027\244\221\231e`\253\364l%d\261(3\277C0e\3562\361\266\030m\266Oq\034\023\243C\362\273\325\245\246l\230vp\242e\236\201\037\3428\356\f\215&\361V\362n\217\352\356\256n"
+	.string	"]\001\316\327\025\204\315\370\036\2746H\211%>\262\016\017\016Z\366\224\251\334\345x\033\b\250;hw\b\021~\350\232\277\354\341\267\221H\362?\350\"\341\017?\277=\261\301\177_\370\005\0049\245z\\\301\367CT\307sEy\331]\340\373 Bq\356\347\177\377E\344\374\302\314\331\316~\342m\337}\340\2333\215y\310G\373>\207P!B\377\376F5\341v'\202q\034_\265\017\n\222\"\270\005\354u7\377\221\212&\020X\260\316\337\307H\035\2515\345\246\343m}\273U\254"
+	.string	"\"G7\344\227\315\224\273[\270\310\016\355\250>;t\314_Vy\037\260\rh|>\374\227\024\217\217\312\367\200q\270\213\3438C{\036\327\363\242}\213\273\r#Fvh\214\327]\017\017\244\322hO\272\026\027\226\263\335Uf\376\263n\367\370\257t\273\271\275\334\334]nn.7w\322\315\275\345\346\326\312\312\361\346F\272\271\261\334\334.\334\334,\034\215\267\nw\363\376\340p\274=\270\2347\206\253\013\237\333\2021w\005cn\n\305\334\023\212\271%\024s\037\213\271\255\274\352]\365\271\251>\367\324\233[\352\315\035!)w\324\233\033BR\356\007on\007\304\334PH\271\033 \345f\360\346^@\314\375$\314\255@\230;\30107\202a\356\003\303\334\006\206\271\013\bs;\ts7\ts\023\020\346\036"
+	.string	"\314\315\004\314-\340\315\275\364\346\016\360\346\016o\264\336\343<\202\032\270-\32253?U^\340\r\260\255\201\225\030\250\352\210\3464\260\222\002\217\264\362\310\221\360)\253x(&\"\224w\350\232p\023\027"
+	.ascii	"\334\260\326\013F\240r\301\366\275\372\252\027\023\362\252\370"
+	.ascii	"_\376aa\353S!w@\203\002K\311\016U\361-\035\266\316Z\326\342M"
+	.ascii	"\357\024&\r\246:\345/Z\323\354\005\2466=\222\215\017/k!s\314"
+	.ascii	"\355\200'`\005>C\303\002S\t\234ia\311W`\352\200G\326\361\341"
+	.ascii	"\301\202\021\360LR)L\031\212\226\374D\300#\353\366\262U\217\206"
+	.ascii	"\205B\327\374%\360\317\032\250\307\315\372\261\247\"$y\3121\274"
+	.ascii	"X\267\356\205\3678\356F\334\370\301\346)\277z1\f\357*\362\263"
+	.ascii	"\302\346\355\373g\355V\367\351SQ\2276\307w\373W\177\341\3050"
+	.ascii	"|\326\033\255\354\271\311\356\322'\3616\022L\255\025\272(\300"
+	.ascii	"\003\370\245o\262:\277P\371\325\347\370\277:\245L&$\234\317\335"
+	.ascii	"\022\227C\013\360\316\207\020L\226\223\220\360\200\3260\227\034"
+	.ascii	"\275p\007\340\335o\332\246\026\027\346\3258\216\333\023/\213"
+	.ascii	"\2172\006\210\212^]\241!\371Qc\275\213g\361\3764c\036\311HN\264"
+	.ascii	"oi\330\013\f&;\024\006\363\272\353\342\037P\315\220\217\365\376"
+	.ascii	"\304*=\225#\337\361\270\233\346\344\312f\327\306\317\370J\357"
+	.ascii	"\210\236X\fo|\267z\320\216m\017\316"
+	.string	")e~\034\307\313\357K\372bv6\213\231\031&\207%\331U]\035\344*'>\3223\335\221\201\325\210S\236\277\354v\277>8Fz\327\n-\013>\374k\253\206\227\027\217\020\306\257\035X(\220v`}e\325\240\361\332\030~m\361H\206\240\221U\003\307\210,\254\255$\216/\256d\200\236a\345#\211\3241\003+\013y\334\302\201\245u\234\341\265\343h\245\240\223\\5\274\216_\311\244\327\221X\r\363\277B\342\357\013_^\3303\033H\033\307U<\344\255Q\032z\373\313\276\211\322\220\022\221\022\017\357u\367\307\364Z\206\221\205_\362J*|\177\224\314\302\273S\314\236\227\302Wx\247?g\332\204\247\360\022~\302;Y\235q\307\227\360M\210\234R7\342=\367Z\375\361\3359\307|\250\362\032\214\3430\207\366\023\371\"JE\335J=\345Uy}\255\236@\035\326\215s\314\277\363\233T\317\3740*\276\251\377\030l"
+	.string	"Z\366\333\240\213\362_\366\233zO\233\342\251\305)\035\2211\206\310R\337\255\354S\376Ex\b/\365\376\026\365\021\366\224Y\207Cs\0047\335D\275\303Q\343\036<\204w\275|Uf\257\356\226\231\021\334<\272\017\336\365L\017\251\305\025\275\364\376\264]\357\225\327\365>'*\333\344);x\250'\250w"
+	.ascii	"\365\256[V\t\035s\3013\370\006wvp\263\201\240\033\314\034\bn"
+	.ascii	"2x\340\037\264\354\027|\325\023\273\241\b,\226\035\372\364N\325"
+	.ascii	"l4\351/\301+\3403\007S\025\350\321:\222\363\300\324\004\217\254"
+	.ascii	"\353\303C\342\302\313\311\347\272\223|\247C|\340n\330\353\201"
+	.ascii	"G@\240\002\0358\004\357^\337\306\262\234\003?\203\331\007'%\235"
+	.ascii	"[2\374\263\316c\276\225\315\306\022-\365\352\ny\324\253\365["
+	.ascii	"\001\201J\250a,'\025S\246DDD\222$Ikq\005\304\020\307\034L\036"
+	.ascii	"\021\360 R\312\231!!\021\021IA\222d80\272T\351\301(R\020\371"
+	.ascii	"3\211\322\243\032\310y\264\373\016\206\335\354\252\n\265\366"
+	.ascii	"D\023q\200\301\232\250\001\0323^\322{\006#\330\203\272\034\222"
+	.ascii	"D\002D\263Q\363\203sO\263$*\025!u\n\324\226\357C\375\300Q\232"
+	.ascii	"\365\312A\221\005\f\334\335\306iS]yA\365\246\036o\331.:\305\322"
+	.ascii	"\354pE\310\366\244`M\321b\003\376\374\200\222\301\353\007\250"
+	.ascii	"\232\"T\326\210\363\205l\327b&\344\003P\217\346IGS\367\363\223"
+	.ascii	"\333\341q\220\232\214\240\036x\020\377Y\320U2\026@\213\210\301"
+	.ascii	"\251\376\204\017\017\013t^\372\342\"\263\326\270[IW\371\177-"
+	.ascii	"\312\270X\360\364b\006\377\336f\361\371\250j\252\2502\235\213"
+	.ascii	"\216\0300\241\017\210.x*p\244\001P\221_\275_u\023\006\342,/]"
+	.ascii	"|\333\3072\025\244O\345:\036\235\342\001-@\360R\253)\r\307\333"
+	.ascii	"z\272\242\274%\344\355&\0209"
+	.string	"I *\017\274{\252L\347\242#\006L\240'\035\245Z\253\262\254?\007\3722\270\307\304~3|\306\236\270\233Z\315\233\\\362\332\3133\237\343\261\235\240\321+"
+	.ascii	"xmy\326k\212t>\275EX\002z:\311:WQ-F\004\0076\263\2258h\262\354"
+	.ascii	"[!\256\016^\260\210\201w\343;-sY\032\212k*\327h\304\024\033\n"
+	.ascii	"\350&5\027\315\233/\224A\r4Z]\322!>^\215\211^\037\211\316\023"
+	.ascii	"0\333a\253\260\276\244R\276w\232e\373\200\356\362\031\274\222"
+	.ascii	"5\301\274*\313\257\210\345n\241\354\200'\234#\276p\225\216sS"
+	.ascii	"\373\224\324\336\3330\377\233}\343Rl\327b\360\310\020\244\211"
+	.ascii	"\244jw%*\264\003\320\212!\026\343B\017\350\n\203\016\256:\346"
+	.ascii	"\301\235\020Q\275\324\221\241\004\340\232\271a\021\322]\332<"
+	.ascii	"\372\230E>^\373\327H\271\325\367\017Y\266\"\246kt\325m\314l\244"
+	.ascii	"\323\363\340\203\337\223\023&\363I\251\204N\001K\252\311\274"
+	.ascii	"\020b7\b@M\035F\344\227}\004]\312\355\311\225j\025\273\026\231"
+	.ascii	"R/2n$\210\235S(\363\0378\333\223\357'\274\245\203\371C\255_\215"
+	.ascii	"\242;\200\312\271:\272\365\013\030\323l\021\211OX0\360\t\303"
+	.ascii	"\230\306\366Y\247\3063\1778\023`\376\245\247x\255\253\306|H)"
+	.ascii	"\204J\245\340\330R6zG\201\351bk\274\351\355\t\337+s\265K\374"
+	.ascii	"\3747\017)\3772\346?"
+	.text
+	.section	.gnu.lto_writeSlowFrame.159.886e5061ff6073b3,"e",@progbits
+	.string	"(\265/\375`\030\002\335\020"
+	.string	"v\336kF\320VM:\344\361\230\252\201\023[F\266\006\320\177H\323\031j*\205 O\t\255W\370\021\rj0\025c\223 \300\255\032'yf\367[\237\206\241W\236\204\343\006\023`\310&\221\335\\\204;@}\233\264\275\211\224)\005U"
+	.string	"N"
+	.string	"["
+	.ascii	"[\263\233\222\235!\241\335\027\016\016\ra\206\362\264\237\343"
+	.ascii	":\274\303`\016`\027'h\310n\254d\323v\350\330\t\304\303\355\002"
+	.ascii	"\342\241=\033\211\201\026\333\212\260\0234\323\203\311\356r:"
+	.ascii	"\343\336\323\363/\373\350E\323z\212,\354\256\363ESs\353m/\260"
+	.ascii	"M\301N\033\0013\227\266<J\273s\311\277\314\340[2\223\321\226"
+	.ascii	"\035k\245\306\260\257\355\356Zq\354\303\376\024\230\036\305\364"
+	.ascii	"\006\323\242\230\2160\r\265\264\246i\325\322\251\351\027\030"
+	.ascii	" \303\207\346_\317\256\213\257\311\316\340O\215\363\374\366/"
+	.ascii	"3\311\216}\207w\236\227\007\n\215p\370O\2078\004\203j\373\301"
+	.ascii	"e\036R\216\354\356\204;y%\321\024\352?\\\210\246*9>tTA\252ji"
+	.ascii	"\346\211\r\342>!r(@^m\021#H0\\>\035\bj\333uI\360\177\220Hm4\016"
+	.ascii	"}\230xx}\215\315\247\003\213\311\317(i\"7P\264YZ<&\001\254T\n"
+	.ascii	"\325IE\\\321\251X\232Q&\026\335J\013\352\244Z\341L\260\234Jp"
+	.ascii	"\250\025\2133%pw\"\265\342Pt\335\212#\305\366\332*\316\350\006"
+	.ascii	"\307,Fe\374\242\355\336T\020\342\311\357\202\313\215\003y\036"
+	.ascii	"\227a@\220\363\2623hhpc\243E\362\006\212\207\233\2164\006\331"
+	.ascii	"p\240MUrztD\245\250\242- \240\002\021\252[\007\240\353\rC\003"
+	.ascii	"\023X\214<\345 F>\3330\034\331'[R\321>8\226{k\224\bi\257\205"
+	.ascii	"b\222\0021\316\362.\213%M\350\2339C\302Z\335l\243}#\2340Af\031"
+	.ascii	"\270n\001a\316\203\312\374\330\330\217\304\201p,\007\210\311"
+	.ascii	"\006\201V\310\222\235\230v\005md\202v\363\304+p\311\213\253\223"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_loadSlowState.160.886e5061ff6073b3,"e",@progbits
+	.string	"(\265/\375`H\001-\r"
+	.string	"&YXC \221\222\016\247\200\216Ot\027v\024\030\326l\341\312\036ic\020\n\214>\265\036,\035M\340h\177\250\021l\357\216\030\025\226\325\217\037\211\216r\032\222"
+	.string	"\001\332\002A\240\250"
+	.string	"\034q0{#\225\354-eJ\001D"
+	.string	"@"
+	.string	"G"
+	.string	">\211\227\310\356b\362\316\356\250\206\305n\207\300\036\352\320\335=\246C\352\002\246Cgv\r\002\033VS\320\342\003\n\314\215\335\255\024\304\263g\346\337\30491E{\002`\260\273\316\230\242r\353m\033\260\235\300\376\214\334\273\353\302\201\226]\321\343\241\037\322\263\304\031\016\036DycwZ*\213\375\267\273k\035\3310M\335\345\237^\032\276\364\313\264j:3\375\316\200\0201*\217)v;\334\340\330\022\244\021\321a\373\351\252\266\204\307\244\252\252\fJ\216N\332\024>\371\230\252\244\355E\351D5_m\353+B\250\335]\340\253\300@\002\324p&\321\006\346(B|\316\"\240\004M\207\327\t-.F\254P\352\277`$>\2274V\376\362\023\031\374%\327H\350\331\362h\270>@\326g\344\243\252 \362!\251,,Ty\n\370\262"
+	.string	"\202U\030\256\013\253:\272\375[\035\231\263\305(\211\364\304P\355\006\247y2\016\240>\322\006\343\251\375\3403%*#\332x\244\r!B>>U\033\033)\033"
+	.string	"`\251'\023Z\373\002\303\005\013P\004\300"
+	.ascii	"\203@\210Ze\006\242\302\265E\370\260\204\342\370\032\205b\205"
+	.ascii	"\200\270A\005l\325\360[\215\307U|\226\336\2100V=\030p\t\241Y"
+	.ascii	"M\001wy\321N2"
+	.text
+	.section	.gnu.lto_writeSlowFrameIfNeeded.161.886e5061ff6073b3,"e",@progbits
+	.string	"(\265/\375`\355\002e\025"
+	.string	"\306\245\206H\320\362h8\220\220gHi8\320\211X-\246PU\3124\362\001\255\035i63\241c\035k\206\036\202\224\377\241n+\"\366R\315r\214|yS`M\r\360\003\304>Q\016\215\370\320_\036j\267\005\266z\357\275\367\2262\311s"
+	.string	"k"
+	.string	"p"
+	.ascii	"\017\257Z\243\027\322\324w\262\022\363\354\0351w\341\305\356"
+	.ascii	"\344\241\242\220\017U\301\202\032\225\031\2701\237J\222\210r"
+	.ascii	"\216~t\237*\016q\331Kr\024C\220W\246\037S\036\334d\210\252\331"
+	.ascii	"\314\227>'s\360\370\230\004\361\334v\024M~zn\017qx7\013\206\330"
+	.ascii	"6\234Gl4\260"
+	.string	"\244\273/\364\325\261\331\354\216)\335\255[\263\365\\C\256\252\036T\325\201\352\376\002C6'^\313\345\215~TA\017\24412\373\332C\275\214\370\360,\322\003I\367A\3506\333\237\352i.\347T\0176\203P%\001W\313\357\256#\2572\257.\257^@\202\250\036\223Q\022\n\326q\366\316/H\373B%\021/\372w_\325\253~H\317\323\224\236\350g\315\213h\3368}\033T\222\013\247n\036\006\347\t\210\017\311\017\020\003#M1.cF\017\204@\327\335\021\304\207%\2179\fQ:\034\036rNO\316\f\353\355\240-\020\r\260\344\225\206\370\336a(\255X\373\032\363\233p%|8l\366\316s\2215\336K\\\020(\262\037:\013\027\331=S\361\0254z\240\207\312\342r\211\017U[^\3665}\n\\\007\037\215\315\355n\2239\3073\244\021=\034\264\005\242\313\347\221\337\"'\255\330*\2462\363rQ\231i\301"
+	.ascii	"h\305\\0\b\022\\d^\023bR\312B\261\360Zia\255\\VT0\256\325\213"
+	.ascii	"\212\005\213Q\241\034\320\027\205\026L\025{\275`\252\324\331"
+	.ascii	"'\177\231\250\340\370\032'a\035U%\341/\341l\370flSr\356\306\203"
+	.ascii	"t>H@\315\366wv\233$\347T&\216|\323`b\351\211\211G\221\006\354"
+	.ascii	"\376i\360\242\337\211\267?-y\206\362`q\025\320u\317\002? \200"
+	.ascii	"\002\031Ac\007\340\353\245\007\254a\367\310\200\021d\235\373"
+	.ascii	"6\254l\232\\\312\321\210)r2\306D\221\036\200;&,v63\253\336 \274"
+	.ascii	"\034Xv@\3006\226f\200\246\205\307\t\2721\f\302X\350\033\367\""
+	.ascii	"\007\202\253\262\361R\027\304R\241\224,I\346h\240\342\346mY\007"
+	.ascii	"a\255\241\270\246\270vY<|v<\177\270C\007q\036\360\301\307\255"
+	.ascii	"\033\230\"\375q\202\233\356K\217\003\267\f~\214gR\357r\013\217"
+	.ascii	"\"_\303\f7\340\336\326b="
+	.text
+	.section	.gnu.lto_blackboxValidateConfig.162.886e5061ff6073b3,"e",@progbits
+	.string	"(\265/\375`\235"
+	.string	"\205\n"
+	.string	"\246\022G@ \307*\035\370\344\251"
+	.string	"'\033 5\t\3420\t\f6y\357\027\247,\336.9#\341M&\324\315\347\313\331\377\200l\307T\002\031`B"
+	.string	"\001\260\005\002*\370\343!T$R\271\2676\262\367\226)\0053"
+	.string	"3"
+	.string	"3"
+	.string	"\003h\273\313E\225\217.\243\216\374\273\236\371@\223K\0050\365(\037T\bR\032\260$'f'\013\026@O\025c\261\273\326\017D\335\363\266/lS\330\217\b\363\261\204U{y\2214\264a\236F\024\373r\343\312V\365T\265\274\372\230\006\005-\324O\007vO!\204\225M\003-\266\257\361\310fp\030k\035\n80\005\027m3\336u\214X\202\222>0C\030\206\021.\332d\234qSy\032\372QF\253\251f\220\007"
+	.string	"%\354\226*|"
+	.string	"\177\211\370\255O\217\204\364\337\247\037\332\036\366lH\272\316\206\207\303\321\341<48\035\234\347\003\3426\020\356>2>\\H\327}8\r\214\364\270r&\305%#EO\306w\233\200N\202\265\273\261\273\254\020\2405P\226O5\213\001\023"
+	.ascii	"`\25173`\236!\027\006k\275\275_\233\254a\031\bW\r\262\300W\034"
+	.ascii	"\013\2421\253\204Tb\273&\272`\002y\031B\\\272\230\355\304\013"
+	.ascii	"\023\n"
+	.text
+	.section	.gnu.lto_blackboxStart.164.886e5061ff6073b3,"e",@progbits
+	.string	"(\265/\375`\320\001\025\021"
+	.string	"&^nH\340\320(\035^\312(;/\262\224\375\001\326nB&u\177\003\372\304J\003*\2164\303U\206\tf\035\236\17736\273\327\025\361\254F\345\343p=5H\2200\303f\030\31251\344(1p\241\336\346g\256\221\275\311\226)\005["
+	.string	"S"
+	.string	"\\"
+	.string	"f\331A\004`\265\305"
+	.string	"\206-\206#Tk\375\244\210\263\336\321\311\311e\371\255w#\227\323\220\332\317\r(Gt\371\344>`<\fyb\006\316\300\214\236\330m_\025\021\266\034Il\271\344\n\314h\264x\342\213C\340\003\342\206\207\030\356v\245Z\253W&\262\334\243\333\006m/\2607A{\331\212~N\371\233sD1;fj\\;\3326\341J\232}\256J\030{\256\273\271\246\334z\312\365\001|\304\211\025\025\226s"
+	.string	"\252ue\324Q{\346N\t\333\367m~\203r\032\223j<B(\366S\274&\3454\016\251\375\240\250\265z\237v\212\355}\256\0270\236:3%\315\030\350\345\351f\303cm\222\b\362\266\013\320\t1\366\204\262\305\311\247hN\352@L\255\265\305M\324\\\b\345X\022\262\231\217\374\t\355Dn5^K\344"
+	.string	"\3438\026\375\204R\331I:\013w\364\224Tzc;~\343\222\343\230\214j}5\360oW\001\3722\237\256\260\nF\201\\"
+	.string	"O%(\223\204\3237!e2\371P\252\325\007\362a\220\002\211\352\263"
+	.ascii	"\202\252\317\263q\275\344\222a7`m\007\017\3662\337\366R(['\372"
+	.ascii	"0\262\240\222\346\021\352\353|g\304\2271\004\223\211~\212l\220"
+	.ascii	"1\324\301\265\343\213\240QL\325P_\252\202\317\327\234\264\"\306"
+	.ascii	"\313\020\216\326\026\005* @\002c\220i\017\240\352\t\006\304\260"
+	.ascii	"$a\347\005\002bo\242\266\236\220\0035(\2133\217\332\215\212\215"
+	.ascii	"\n\003\032 \037\267\325\007\247\035\203'\212\352!g\357\005j\204"
+	.ascii	"-1\327]U\026_\266\026\224^\022)\373\272\257\203\337j\026\362"
+	.ascii	"`\325\340-\027\246\241\0172H\364\365\336P~\274<\234\f\001\332"
+	.ascii	"\275\370\026C\001"
+	.text
+	.section	.gnu.lto_blackboxFinish.165.886e5061ff6073b3,"e",@progbits
+	.string	"(\265/\375`e\001\305\r"
+	.string	"F\230WC"
+	.string	"\2576\035_\031\005\344\377\253L\0045s\300\253\232\262\341i\202\326\027on\013f[\221\217\216\r7\271\375f\017q\322?P#\224\376\243\376W\377\364\250\364+\306\3733"
+	.string	"\337\323\237\321X\375\336d\313\224\002@"
+	.string	"A"
+	.string	"F"
+	.string	"\322\036\261\255\313[\376\330\340\275\223\025\360a\230\300\022\263\273W\334\360\317\345\024\365\343\237\364\r\327i\227\030\237\252\316\302ch\2430\346\207Ru\022\242j8\273k\345\272\222\233\272m\016\333\005\354\263\b\366\275\177\310\374\024C\020\321s\227\276\bu\371\310\361\231\214VD \rm/\244Q\203\375\030\206\241\013G\023[\325\327|\312\220T(\371l\331%\te\026F\246\340`\373\376\312K#W\261\201\371b=~\351\234-j>\211\233\243\351\314\3477]\242}\024\0065\\D\3263\252\304M\374\204A\215\027\321\246b\371\210\267\030\324\357dt\341\3313\352R\271\315x\b\333 \200]\355\243M\242\254P\361\260\0316\203\300\246/\002\356lD\300<\024t:\026x\\\f>:@\256\216'\344\332\030`\254\001\002\317\365"
+	.string	"\303<\227\345\201>-\351\2470g`@1\344\213\230d"
+	.ascii	"\265\023|D\020?\351\007Tt\210i\241\337\374R\246J}\020\352\341"
+	.ascii	"1\312/9\b\321s\001% P\202QFU\017`\324\023\207\206K\304[\0028"
+	.ascii	"\\\370Q\306\304\207x]e\354vZ\024\025^\335C\227\227{\231-\336"
+	.ascii	"\027R}\370v\n\354\316h\3744px\305\267Ak\236[\032\332\372BC\t"
+	.ascii	"?;\034\333=\362q\357L\272h;C\306\341Ug\326e\212\f"
+	.text
+	.section	.gnu.lto_startInTestMode.167.886e5061ff6073b3,"e",@progbits
+	.string	"(\265/\375`g\001]\017"
+	.string	"\306\234hG\360\260(\035\372\231\273xa\254\360\331\313\273\265-v\234f\215/\3171\323D\276\332\004\353*g\267vam\237L\370\265\214\261\216{N\276\361\033\234!\362!\365\266\230\361\212\245\366\226\245\bi\262\312L4\331D\356\224\002W"
+	.string	"O"
+	.string	"S"
+	.string	"!\252\r\033\324X\260\240\300\331]OC\334tnn*M~"
+	.ascii	"1<\327y\370\334\f\260\350\020\361!\252\266\0048!\255#\256\310"
+	.ascii	"m[\340\002\243\303G\325\006\022\003\304MGLI\355\210+\033\202"
+	.ascii	"\335=\354\262EDI\351\361\331]\313\225\330\272=n\233\304v\004"
+	.ascii	"\373"
+	.string	"0\0012.3\037Nr\207=\242\244\272\354o\253/\366ew\247\322*\245\017\34014VK\353/\034\273\254\0359\266f\322F\\v\3732\376\370\231\307L\227\251\bX\031{\361\246\366\302\306\356\310\340\323\236\356\323\343A\270\317\356\004\270\317wl\262k\004\253N?\276\300\215\230\0225*\r\355B\305\"\261\251\313z\022\247\n\316f\244d\316W\220\272\335\224\003?\305U|\376\353\323\030J%\356Su\003\314\215\211\230\334\335P\325\345\024\356\032\232\331\244d\216\375\023\237\245\370/g@\221_}\372(z\330\025\264h\002'\3407\301\244$A\244\344\001\004\221\021\b\262P\n\261\310\243\341\013\221\210@\027B^\311\b\210\344\211\300\222\3479\340\317d\004z'\337\007z\235\361t}\361\347\244(n\200\264)\200\344W>\354\037\224\206o\021\343\020N\025\256\323y\242\2411\263\371\220\377\210\373\3365\316\2560\"\037\033"
+	.ascii	"5\263\007K=\231\001\353\034\242\365\022\336\3666C[ \212\304\n"
+	.ascii	"A\210xP8\016\267\357om\033\"{$\310\271`\3430L\b\256\211(\231"
+	.ascii	"\320\272\260\227U\226\227&\200\273W\205\320-a\\P\341\267\253"
+	.ascii	"\224\001"
+	.text
+	.section	.gnu.lto_inMotorTestMode.169.886e5061ff6073b3,"e",@progbits
+	.string	"(\265/\375`y\001\225\017"
+	.string	"\326\234hG\360\320&\035P\322d\236\346\371=\"3\243\236\376\224\266\222J\375F]\260\210\350\275\376nCb\326m\030\243\035H\255\257\267\177TR=i\n[\202g\340\031X\221L\366\315*X\206y`\003\366\261\270H\366\336R\246\024Z"
+	.string	"K"
+	.string	"V"
+	.string	"6\210\023(h1\213\300K\013\007\202\332\205W\n\2449g\334\2028\3532\302U\226\337\272\\\261a\321\305\0056+b\314\240\3016\034\302\221\242\237\035!17\036\b\314E\027\206\f}\260Q\202\275\300\021Y\220\206\343\\a`\235\352V2\347\264z\260\f\367v\333(\266\017\330\007\n:\337\221\340\217\260\n\213\336{\364Y\344\343\3678\0271\n\312\221\351\304\\\372\331\263\226n\215\375\375\276\357\363\322\330V\233V]\262z\203j\t\325\021\252!T\257\325\272\352\013\0209\201\224s\035@s\306|IS(\266 \241z\273%=\f(\240P\362Q]xF\006,<%w\341\356Q\005Y\247\237\003\250\355\340D\357\355*\321M\t\241n[\366\r\024/d@\226\324U\021<5"
+	.string	"\250\235\242\322{\272\3470\323m\353\372s44\263[\343\237d\351\003\006\017\221\213\366\360\177\222\337\322Z_\261\356\001N\221LP\231\240\244P\017L8\b'\250\024.\265R\341H\nX\025\241\301\212[Q\251V\334l~i|\032\265\016/\237hJ\252\311\364\370\300\237%\267\205\261\275\255K\\\333\3019\347\224r\343\232\366/\0234\271\247\0201W\334\001\264\0343\036E\213a\307\203L\204\353\253x\037"
+	.string	"\263\312\371\256\213\253Nz\260\256A+N\310\315!"
+	.ascii	"\202;\004W\262`\306\202\005\260\2220\315aa\2259\257\314\354\003"
+	.ascii	"\253P\245\334U\013\\\230\\\231\316\257Z\026\245VY\\\030!\306"
+	.ascii	"H\360\366\252\240\0034\222)\227VW\263\254\271\007"
+	.text
+	.section	.gnu.lto_writeGPSHomeFrame.170.886e5061ff6073b3,"e",@progbits
+	.string	"(\265/\375`\204\001}\r"
+	.string	"\266\226SB Q5\034\344\"G\007\344j\006\250\035jP\347\265H\234\363\352X7b\005\205\247W#r\016\2456\023;\347\027\337\036\336w7\004\221\210\335\"\212@@6\203q\035r\234\222:\321\211\332\336[\312\224\002>"
+	.string	"9"
+	.string	"G"
+	.string	"\351_.\342\201\325\301\365\023\261]\326\254\307\3126Q\304\366-F\3318\004l\330/\001\214\004\207\221\224\335\355T\304QO\224\177\024\007"
+	.string	"\266\276g\205\301\356:\301\226\353\326\3336`;c\347\201$/\017~\363=\356\333\025\0033\021S9s%\315\342.\341l\323\205\2278\221\255\364\263\226v\206S\036t\222\354\bG\024\225~v\370\245\206\260\257\255\276\354\247\265\247\365\351|\032C4`\204\037\034\306(\300\215\335U\340\342/ D\350t\270oj\003\314\221\312Y\013\022\325\203"
+	.ascii	"\2511zN<d\227\314\314W\214\244bh|\270\344\325\016I(\260\322\017"
+	.ascii	"\301U\210>vw\201\037>\305\310\017\371\346\006i0x\237\021\310"
+	.ascii	"3\341\323Q\020yH\035\250d\3524\004\354U\b\225:\013\236W\352,"
+	.ascii	"\341^_n0\356\210\222R\225\375\r\347\233\374d\343\207\330\001"
+	.ascii	"'\017r\270o\032@b):4\205\315(\221!j1\023\242\006( \200\002\031"
+	.ascii	"\242\363\001\340\353M\017\030\272!\254\205\223H\234\255\300\374"
+	.ascii	"e\032\262\343\314yT@\30787\246\b\326<\202/\374\027b\304y\253"
+	.ascii	"%\006\306\235}\341`\334D\264\330\003\006N\b\\ap\212`8\307\360"
+	.ascii	"\355\221zX\370A\020DE\300\313\202\363\303\331z(\307C@\322-Z\372"
+	.ascii	"\004"
+	.text
+	.section	.gnu.lto_writeGPSFrame.171.886e5061ff6073b3,"e",@progbits
+	.string	"(\265/\375`\214\005\265\035"
+	.string	"\026\363\263H\220\232Q:\001\242(\271}\t\353\003\223\24292/\270\337\002\232\307\331\341x\022\3063&\026\3142jf\033\177\354\255\254\025\001\320\247#"
+	.string	"L\222$\240\320;^I\270\t\275j\340K&n\340\305\320\275\265\375\275\211\2242\005\225"
+	.string	"\222"
+	.string	"\245"
+	.ascii	"0\312\177"
+	.string	"Q>%\371s\362I\222\337$\237\233\277\006l\307*\031\313$LY:\035\341\224W\363\212\360\333d\235\244X\252'\bf\315v\376)\376\331\316\235\375_\376\227\311J\325\235Z\361XY\362\250\262*K*\334\207`;\007\254\215\356$\327\207\356|\375\263\200X\224=\005[\2444=iS\226e\256\201l]\262\271~\227\2701\340So\311\031\333\344\0015V\270t\236\226H\233\323\020\340\022\227]<\375\230_\020\312\262<\003\237d\354\347\376/\372\357\340\237]\001W||\334 n\324X\365\215hP/q\031\212\006\233\035k\304\230Yb7?\225\001z\353\240\336&\250\037\037\377\205\262Q\214\276Q?\322\361\002w~ut\347\255\327\311\n5\251\022\225C\n\312\307\307\323\370P\366Y\350\377!i\2057\256\226\272w\031\377J;^\340\205\2046\256~\335\373\251~\334?\376%\313\366\361\223\374 \222\177\333\251]"
+	.string	"\224o\243\374\237\311\367!\371=/>\017\311\337y\361k$_\207\362i\224\237C\3713\312\227Q~\214\362\003X\3052\262\340\222\031#&\3065\234\022bX\377UX\213\274\2326\254qG\260W\225\370\240\370zd\303T$\f\202|Y05I\035\326%u\t\335\371\352\007XR\353\245\022o\305G\330.D\004\212;\271\320\336\033\301-#\020O\262g\343\232\272|\022VK\021\226\3152\341\024*\360\002+\320\235do\215\340\326\220\004\342\356\337\302\205\001\334"
+	.string	"\272{\2470\021\371eX+F\013\276V*4\300\242P\320\235\334\373\004k\312\307G\334RA\001+\313\262\301\267j\247l\370F\355<\207\016\035\350\316m\032#\230\306\030$2 )%a(!\002\211\3073\241\243]7tb\347\001\204\356(\204\207\234\210\244#\245\234\216G\"7$\340\273\021H\274\\\211\335\216\227\233Q\371\226,\333\307c\3028W\276\376\335\206c'\030/\202\354\002\330\302f\374in\252\304"
+	.ascii	"8\230\251\"\251\025\231\005\032\240\226O"
+	.string	"\212\177\225\210\200}D7\356\375\364\032\tv\r}t\354\261\250V\354\352/@-8Eo|\342\030\353\216\235\026\020\367\360tO\217e\303\305c\334\251\365\316\217]S\201\300\264jl\206:\264\326\221\3454\255\347\026\223\222\237\220\315\252\304 4D\005\316\344\364\346\br\031g\262\216\365,p\250aD\005\221B6$\222\202\222\024$\035\240\002\021\031+\363\021\200-R\210dd6\244\275\003\240I\323\t\013A\005=\307uSP\375V7\241\315\303\246\304\006\370\371\375\334\272\002\2661BYjY\315\353\337\346\331\f\013%>,\332\0333\025:\"-\b\231Y_\311\037\2432\003t\344\251@\354,\273M^\004\255\372\242\370\334\021\222(\321\310\2714^d\260\310k\320\253\b\360\206\3626\316#}\363\237\362w\232\006\321\3473\310 e\302\227E$5\212{P,\026\261\026a\003\210\317\332hiS&\327\217\357="
+	.ascii	"j\013\355\306top\331Z\024\227Ph\276b\210\365g\2211v>a\271\375"
+	.ascii	"\300\364\277B\253F\025\025j\002\326\220U\325+\331\312\033\345"
+	.ascii	"W\243\021\310s]\022\361\332/\35747\243)\344R\003"
+	.text
+	.section	.gnu.lto_loadMainState.172.886e5061ff6073b3,"e",@progbits
+	.string	"(\265/\375`0\r=:"
+	.string	"\252c\250\025?P\346J\007'\222\324\365\217b\210\225\303Y!\325S"
+	.string	"'RP\252\230\037\330\230\336F\324\342F\250\325\252\202"
+	.ascii	"\022\210h\232\350\211.\222\t\230B\227\310\271h\250\375\3753\263"
+	.ascii	"A\310"
+	.string	"\336R\246\224RH\001/\001L\001b\372\2445\032@i:\344\020QZ\307\362iifw^\267\232\356\273n\273n3}2\367\236\236\336\035\336\22745E\223\301/\313\226>\303\215\306\216\373\f\371\251\235 \266\265]\307F\314lfG\247ii\373@\344\2277\230\246\351U[\376\300\354t=\3466\031\036U)\035\223\242\304\002\261mTmgn0\035\346\366\\\217^J\323\266\300\2754\245k\300\016\210m\231\256\235\316\266\304f:\333^\346?\002\310R\260\b~@\314\352\f\245i\212\365T\230\211\304\244Z\253\321\377\023k\255'\177W\272\346z\3366&!\035\031\025\025\211\250\322i\227\352\373\345\256\353\232d\036\"\321\300\332XQ\262!Y\372\016\021'\225B\341 _\3575\361$\266F\332\353\352\247\367\026%\215\255\217\230\350\265\024\034\021%n$5%mI\027\241\030\364\272\372\335\275EI[\322\305\265\372"
+	.string	"\317\314\211(\206)ij\215v\230Z+\325\243<qJ\372\016\021\267\na\r/O\247!\363\263\350\rI[\"\222^\252Jw\210T\251\017\374\fM\314\353\233\221\376F\3236yg\207D3\322\216bH\323\224\035\211\226\326\f\240\231\273\t3\243`>\302\n[Yn\202z\220\006f\016\035\274\221\035\316\266\305o6\245^\223\2178\350\241\001\241O\004\321~\372\360A\365\344\316=\":\320\3769\242\363"
+	.string	"\342\261\315z\207D\333\371\257&\232\316\234\277\377n\243\314\223\233\363\217s\202*\2209E\303QAlk\240\221\202\372\375\253a\331\034^\321o\230\231\025\330\245\335\260\210\340\226\246)\205\276n\323\202\271\272\274\221]g\333\3766J\274\346\\\230\037~\273\025\016\356=?x\346\027\315\006\0061MS\t\334|\367I\214'7e[\356\036g\333\034J;9&a~\310L\007\346\237dn\nn\205\203\374m\314!6d\320\272\320f\232\263\232L\367\203\236\353\306jf\363\202\316k\266j5\315U}\327L\325v\315S\250\263\202\242s\002\353,e\235\243\212\316P\2503\202\352|\200\350l"
+	.string	"u.\200:\0238\235\007Tg\001\3259"
+	.string	"\352\374t:;U\347&\324\231\351t\006P\235\227Pg\245\352lD\235\223Ng\244\352|\204:\033\235\316E\325\271h\235\211\325\031\265\316gu\266\326\271V\347\267\316^\235[\304S\004\276\366\t\030\360Qc\314.\344\246\2614\rS\020\340\005\300Up\346{v\203x#\003|\327\265\223\037\334a\035\261\007+~\222Q8h\206\177A\245\253\256\252\"V}\2067&\325\320y\202s\265\273\244\032\342I\356\232\323?}%lr\232\340UE\356\021od\3237^;\215\201k\326\031{0T\311n\370\027\\\272j\252?\343\276\223\312\327\360\362\270\235T\277\341\215\3114\205\230>\355.\251\2228\332]\003\360L_\r\227"
+	.ascii	"pq!\314$:\020\017r\2274\271N\234\234m\227\276\323\264\205S\272"
+	.ascii	"i\362y\261\237\344^\3726F\341|\210\177A\277\352\251?k\320S\337"
+	.ascii	"se\004\307\274\260\355H\341CW\031\364\324\207xc\362\316\256\214"
+	.ascii	"M\314\017Y\351\035y\227SP\374\307\2253\276\322W@7cf\004)^\266"
+	.ascii	"\305 \320"
+	.string	"\307\234\354&\251\334*U\316\266\306\357=e\237\\\222\207\335\345\224\333\025\007C\372\244\257\200GH\211\230i\345\206\245\r\267\"\034jDW\313}\273q\336\310\033w\266=\372f\242d6\371\214\276y\227S\327K\033\272rEo\364\325\217Y\242\004^|\346\033\346\2129\033Y\364Qc\017\306\204\314\264\322jB\0010\372\006\r\034^[_^7\274f\024\3310\3215\003F\t.\244\0334\272\276\276pl\031\231\313\201\016/\0271\270Z\310p\201E\003F\213\031X\\_6\260\034@\261W\215\256/\254\033^^_XFti\177\033\027\343\016\353\204\275\030+x3wy\340\230\347e\216\204Oo\350s>F\214\323\035\t\231\3075k\316\266\266\255\202DM>6\016\346\377\372\022\374\357\211\033$\345\306\345\236\020)\350\350\347^N\370\322\273\034\343\374\035\351\3209\333J}\253)\t5\347\242\354x\334\t?!"
+	.string	"\217z\274\221Q_\233qa\240\236\371\270\307\267\034\371<\345!\005u"
+	.string	"t\f\344\215\204j\362\213\373b\374$\027\005\221.\374\013\036]\365\202\254_ \247&-\370\013\317T\207W\b\301c\271K\250\343 W\036\t\017<\202\257\177es\262\270\025f\272y\225c\241c\363x\350x\350l{\340{OO\363\355\334\220\241!\031\370\254oC\263DZ\316|<\274`\336H\003Lv\342\226\034}\222Q8EZ\377\202\305\253\266\3723.\322VFV\257\365\306$\036\263\214\255\300'\357\022J\314\333\356Z\375\333\342Q\356\362\211C\271kd\327\314\354l[\340[\257-\027%\240\\\021\001\007\316v\227PM\356\332\323\200\017\201\005\250A<$\225s\204DDD\222$Ik\341\005\204\030\310\034\231\007\021 %u\016\215\204\231\024\224\244V\007S\002W\310\007*\276\200\031h\250t\020\213Sm\272\353A\245\222\001\337"
+	.string	"\372c\005\251\236\t\256\270Y=\025&\324\205\030\367"
+	.string	"\357<\207\227~\266\331\004\361a\333\003\372\360\003\f\377u\244sb\017\341d\035%\254\304>\324K\2454`-\246\370\213\246\220\202\007\252h~\331\206\023\213C$\177\217Z\254\030\262 <^\224\234\303~-\326U\316\277\220H\265\202\020g\007\252\215W\r/)\005z\302\213I\013\204\335\004\021i\362\017\251E\246\220\375\262\326\006_(\271V\r\311oH\276\001\256T\203\"\004H?\211G\300\2719\255\270\252R\216^\216\373\363\202a\243\225\377B\313;\314"
+	.string	"8\r0\277'z.,f\210]\"d\370\274\333\204\201,s\021K\221\277C\022\020\366^\232B\274=|/\252\255zCm\340y\364\373e\031X\233,\2734\375Z\304\036\327A\320C"
+	.string	"\030\344}\320\320\243\222\t\310slK\3274#\301\374Pf\217"
+	.ascii	"\364\337\306\245-\237\272a\024\207,XKV9R\362`\321\257\257B\254"
+	.ascii	"r\244\344\301V\217\367\226\257~\274\244\207|\254\3306\2544)\241"
+	.ascii	"\021E\203}\216\253\b\314\277\206\005l\276\006\3422\30705/\b\372"
+	.ascii	"\215\343\323\277\323\357T\351/jwUCK\353\036J'\231\227$\336I\362"
+	.ascii	"\332\341\244\312\320\b\361d1t\3746X\244coqR\230]\220+\215A\325"
+	.ascii	"\300\256V\356\365\317\373\375\363~\377\302\027t\276:\004\243"
+	.ascii	"v.\033\334%CG\246_ \227T\361F.j\206cD\022~c\256\214n\2034\227"
+	.ascii	"\252hP\003{\305t\324\177"
+	.text
+	.section	.gnu.lto_fieldHeaderValue.173.886e5061ff6073b3,"e",@progbits
+	.string	"(\265/\375`,\004\335\035"
+	.string	"\306\266\300G\220\332M:\200\242|\216\345\355J\205b\206\361\020\0200\267t;\224\326\370E[\225\367\234\017\202\2342C\367\007\224\337R\227>\347q\247\226\364\254_\210\024\\;G 9Q\232i\375\355\t\250\006\351&\215l\"wJ\001\261"
+	.string	"\234"
+	.string	"\253"
+	.string	"\002\306S\357<\227\013o\255VP\314j\255\013,D\2362h\260d_\201'\2465?hP0\302\332\324*\314m\017\227\027\205w\316\364]\247\314\271\221\266\221\342\304\235>\237\351:\266\241\333\020\264\034\245H\177\024!r\bT\312\242<\315\034\240,`\325o>Xh3\324\\\001s\234\264\r]\001\251nS\223\242*\247`\314Q\224\260\004\211\217\253I\335\020\227\211\230\225\217\275\230\364MU\307\375\324Z\037v\240\"R:\246\370\233+&\260J\243\361\261\003\251I\341\020\tx\341q\346a\237QSNs\332\206j\255\236PS\300{\347\366\003\330\326`\2570s\370\007\201\262\352\262fw1\336\366aG\320t\306\310\027\231\337\\\263\205Ls\203\366w8\034\016\275X\266\247{<\315\263s\341\217\3239\330_\236\353\277y\232\364\264\355b\367H\247\351N\213\266\351\265M\317q\372"
+	.ascii	"|\304l\001\177\205K\2553\206oj\027z&\344b\277\335\304\037\023"
+	.ascii	"\013z\005\326\307\340B\223\221\246V\241\202Sg Oo/\331\245m\312"
+	.ascii	"\344_K\007\013\022{\352\217GY\005\362\364G\024\247\375\256{-"
+	.ascii	"]\270\242@O\375}\t1\253U\270\300\023\204'0\236\222\017\323\312"
+	.ascii	"\030\022G\333\315*ZYx0tm\230\2624\233H\307\325\331(\221\bx\306"
+	.ascii	"\253\244\261\243\314\270A+\270\270\277\0320\347\356\332D \346"
+	.ascii	"\241\304\365\260\343i\231l\207x\225\"\362T\214D\220[+\306\323"
+	.ascii	"]\003d\254\373\224\242\203i\325\372s`\273\367\263\035\2051\265"
+	.ascii	"\376\036\230]J\t\361[\247>B\032\221\306\323\271\037\373\005)"
+	.ascii	" bI\272\232\346\320N\322de\321\r\3727@\006G\f\267X\373\240\261"
+	.ascii	"\\\334\221\257-\277\2716#\330p#C\334\240\177\337\370}\234\223"
+	.ascii	"\375\211\317\337r\022o\036\352\324\347\215\247\337\006d\250\232"
+	.ascii	"\002Gg\2613B\201\241\2673\322\355L\224$vF\333\323\231\260\260"
+	.ascii	"K\322\365.\350\224N\354\214v\\$\304\2027\002\251HwbD\016\305"
+	.ascii	"\221.)W\324S\221\023:`^\212]/\247\304\343\365r\245\260^\254\213"
+	.ascii	"\345\207\3755\242\214@){\002\200!#\022\207$\327f[\0175\255\223"
+	.ascii	"\305Zk\325Q:\230\017>Z\366\206\177\341@\236\362\214\351Y\037"
+	.ascii	"\037g<\264C\020\213\030\2631\303\245F\271AOPr\333Y\272\206s\324"
+	.ascii	"\274\372*\363\233k\327\242\345\344\224\263\301\240q\334\235m"
+	.ascii	"\021\346\n\232\027VNs8\275\322\236\226\3346\3509\226\367\215"
+	.ascii	"DU6\236%7\312\"\271A{x\332\207Q\250a c\230SN\221HHdfT3\034`\002"
+	.ascii	"\23113\017\021\300\315$ji\337`\177\210h\352dH\317`\356\206x\b"
+	.ascii	"=V\306;a\232\345\222\265\262g\211\214\362\034\202\b\322\2128"
+	.ascii	"\035V\361c\004`%,\300kK\013\351\264q\2564\037$\241\336\013<\304"
+	.ascii	"t\341\362\327\002Z\231\264\225\306\030\031\017\215L\b\223(Nt"
+	.ascii	"G\036Cr\270\231*\330\203\225aP\300#\230\365\250\001\027\256\340"
+	.ascii	"\210\215\037\241W\320d\212Un?;c\016Y+t\255\022\232\375\0363J"
+	.ascii	"\320\262\360\221Id\025cI\334\257i\022\220z\350=\213\312\027O"
+	.ascii	"\027\347\315\265\006h~]=5"
+	.text
+	.section	.gnu.lto_sendFieldDefinition.174.886e5061ff6073b3,"e",@progbits
+	.string	"(\265/\375`\255\020\215T"
+	.string	":\221$ N0\222\322\031\016\273n\t\300\274++\2328#-\013\r:\345zT1\357\375#Y/\335^k\270\265V\274X\220\331x\344\377\261\256\277\352\033\247\302\377WW#\004"
+	.string	"\224&\370\244\273\243UM"
+	.ascii	"\307B\204JU\263n\b\030\tm\262\245L2\362\001\271\001\360\001C"
+	.ascii	"\254d\200uR\216\367\347\360\323\375^>\344\327\375`\036\334\375"
+	.ascii	"\030\274 C\246\232+\353\235\360v\373\273\035\346p\225G&\213\360"
+	.ascii	"\206\207\331\035.\326\3556\b\267\307W\326\266\256\353\020kwx"
+	.ascii	"`\357\016\331w\371\227\333\360\347\016\301hp\\\365\326\217M\271"
+	.ascii	"\343\342F\256\016\005\362\353m\025\333\261\"\306M\033\337\232"
+	.ascii	"\027\255(\257\"\013\334\205y\341\214N\013]\311\336\326\261 \021"
+	.ascii	"\274+m)\016\334\223m\241{\021`\226\r\226\f\271\334\347\206\374"
+	.ascii	"\312>Wg]\315\320d\t\017D\242\377I\253l\033\037\353\305d\270\323"
+	.ascii	"\342\206\002\224w\377\366\032\206\034n\333\020\035\327\257\270"
+	.ascii	"(^\326\365M\3052\360\366\240\364@\341\177Rg\037\214\346\267\201"
+	.ascii	"\260\275\256e\\\274\254\353\252b\237\204\007\262\020`\310\252"
+	.ascii	"DD\270~Xq\227Ei\205o]\337\240\372\311\032\261z\245$\244#\021"
+	.ascii	"FEDCBA@?>=Gc\221\3103\334\321\021\006S \332\254\356\271\256\024"
+	.ascii	"\214\332\201\222W\344\007\2631*Or\036\311\351\306Gh\013\"|(\\"
+	.ascii	"o\351Dy\344(wx\332\262\215E\\o\311\366d\302F,\214\255\275(\030"
+	.ascii	"E\244\366!\275\245\332\323\226RXhJ\223\203\200\242\374\007mr"
+	.ascii	"\363\005\316\365\226hh\220\221&"
+	.string	"\330\323\226.\260\017\n\303m\312\331\365\226-\240\r7wC\317\331\217gP\3308\346KzK5\024YD\235x\210A\311\365\226e\350O\222-<\374\331\204\211\274v\036\024>\\\332\tF\231\215-\271\216\336RI\022\026\276\213\312\203dC1%\247\250\222\223&}E\261$\212\274#\243\374\335\227\322\226T\030\2106\225\2119r\275%\nh\220\016+\254!\302\350\221wQ\314\013E\256\353\372\3479L\354\2139\030\265\256\3532\230\330\330\027\371]~\332\375w\213Y\001\315\317dY\260\205\035\304S\372\215\340\264wU7\225\n\037,\330\027\"\205\257\346\342\340lh\b\327\365\213\200}\017_#\205*`#=\230\215\364\300\264\007\200k\343\246\314\255N\007\rZZ\332\314\r\240\321\316\212\313\273\3614WB4h\377\356\250\230(C\2509\273\370\017\b\314,\005`3w\310\306C\243G\221\nia\243\343\364(\322"
+	.string	":\354\351\335>\342\322\3542\360\035\366)\264\333\300\313\340\b\202\262\256\353\013\035\256\347\300\036\355\300\315\261\203\017\266#=\260;\202(q\372\234]h3\221\342\316\210\320\007!\245\321\335\345C\23385_,g\271\243f\264\214\346\026a\006\257K\362\035\243oF\351\327\305\177\013\243\017\350\367\237\007\312\211\262\306\353\214\334\f^\374\267\373\346\305\315\334\375\001J:\261m'\273D\336)\"\257\005\315\333\203\007\221w\307\301|u,o\216_\371\033h\336\033\315k\243yk\274\355W\3409|\245\356\374i\234\356\033\365,\377\214o\371e\334\3137\306\341~\030\257\362\037\320\274.\226\267\305\361\276,^\367\r\200\310\273\202\310\013E\344}j^\025\315\353t\344M\321\274M\315\013@\363\242h\336\023=\274&\232\227\251yK"
+	.ascii	"\361\222(\362\216 \362.-/\262y\225\2327\351\310\213\364\303{"
+	.ascii	"\364\303kd\344-*\362\022\021y\207|x\205zx\203\200\274@F\336\037"
+	.ascii	"#\257\217\221\267\247y\217\315kl\336b\363\022\213\274<D\336\341"
+	.ascii	"\221w\247yu\210\274B#o\260\310\2336/\220\310\2136o\363\3602\017"
+	.ascii	"\357}@U\211+S\345nK\237y[\215\374\005\373LwU\023T$|\260e,lIV"
+	.ascii	"O\004;\025~\232\271<\302\221f\310~\240i\246\217L)\005\026\235"
+	.ascii	"\324JeI\255c\006\307I\231\033\331Y\022\032\324\370\334\2204\366"
+	.ascii	"\203\244Ja\3171G\036\315\242\303~8R\337\214\005R3\226\265>2_"
+	.ascii	"\315\325s\324<\200\227 5\352\243~Q\033u\277!*\352\227\240&a\262"
+	.ascii	"\027\313HB\260S\227h\220\036H\324\237\241i\327w&M\362\230\034"
+	.ascii	"y\354C}\263\2704l\302\221\241\376\230\243{M;5\347\032\025'\233"
+	.ascii	"\361*\235j5$Oj\b\242\214\032\013zGO\365\225d\274d\261+&j\223"
+	.ascii	"&\351\201\026\264\2113\262\036\275\243\257\364\023j\247\367\350"
+	.ascii	"\20790-\311\233\2703rC\004\265P7\223\300CUA\210\026\324\017S"
+	.ascii	"\362\3233\032\250\203f\242\272\247\177\272\350M2\315\213\353"
+	.ascii	"\302\024aR\374\006\351\214n\270=!\342\322\3704\214\326\321g\223"
+	.ascii	"\224!F\367\264O\037\231I\2465u\217\215\272&\235\327\2319\277"
+	.ascii	".\323\003\334\025\242\212\265*Ex\232\271\274S\243Kh\371\322\324"
+	.ascii	"\261\321.:,]\006\3430\325J]a"
+	.string	"\205\364@\036M9\276\275c\027a%'\235n\354c\367\034\376b/\3562v\004M95g\261\367sx=\030\0207\232\330\305~\362\205\317\271_\220=\332\252L\365\t\253O\322\003\211\255tF\226\202y\332E_\314\205P]\020\256k\362`j\024a\362hN\250RT\030\370`7\032\231l.t\250@\327\340\035\032m\243\377.\333\022\246\323\277J\207\315,\304\215\371b9@\036\007\016O\367\231\263\272.\376\333\013b\330C\272\366\240\224\2719S7\262\023\204\315<\320\027%k\202\315TcHw:+N\r\023\353\320\240\252\361\301v\032)\325:\035d\346\305\031\376*\025\266TK\305\324[\001\025S\017\340\032\240\305\204\374\301\204D.`\254\302\322\241U\265\345\201\017\036!U[[VY\020T!\200\245C+k\n\310\217\343\005UT\235UE5U\005dHu\254\242\262\312\332\312q\2242\356l\t\331"
+	.string	"Kj\247\006\225\020\254\037UZAZB\260\254\266\254\204X]P\225"
+	.ascii	"\025\006UV\027"
+	.string	"\034\247\2660\250\242*fM\001\221\252\272\232\312\252A\334\037O\035`\371\b\362c\n\003\037PB\254\246\256\240~diA=)-V\006UYP[XXYP\303\267\256\267\223UvI\312\321=\376\346\346\202\374\344\277\273\016\332]\337\\\027 \217\360\026-z\243\272\332\253\004\245f\256\350\034\215>\225Sp\b\263\242'\220R%\251\231v\374\004\363e\323\217o\017\252\353\256\202\240|\371\257\322\247\206\352~s\203\351\256\204\\\236ZG\323O\315\371\202w\216\205-\216\n,\352\203\244N\255\242\237,\223s\352\017\232s\324\310\334\220Q\"5sS4\313\211K\343\364\024\355BK\336\262\317\315Ws\035\210\203\025\277\243f\356\333\360\226(\273\03055\260\303\200M\204\304\251B\020e\322|\261\234\243#nSD4s\033\350\246\346f\234\230/\226\023\267\317!4p8\204\320\324\320\324Ci\234?\272\256\353j\004"
+	.ascii	"\225}\312p\342\210\341\206\242\001h\2429\314\266O\031\274\206"
+	.ascii	"#\206\032\n(\270\2755en\316\256\263\302\306Wt\202\206\020\204"
+	.ascii	"(\021\302\034a\362~&\372D3\027\245_\027/\265\216f\342R\275\370"
+	.ascii	"`&\226F3\365\217\025\037\362\224~D)\270D?\217cP\211\230\200\242"
+	.ascii	"\024&\317\267H\"\315\265$\272D\017\231l\376\366\312\227\2635"
+	.ascii	"C"
+	.ascii	"\315T\257\206\245$\372i\"\260\0245\214Dg\320l\243\346,\200G\030"
+	.ascii	"Q\305r\240\215\350\277\320dsd\313\335\033\241\245\026\316\226"
+	.ascii	":h\006\007M\231\2333HMY\340\240yf\312^\027\377}\316\210\016X"
+	.ascii	"\200^\260\323\003\201C\250\2010\305\220R\n\221\214\210$I\222"
+	.ascii	"\346Q\005\304(&%4\017\021@1DP\315HL\205\306\013\237$01\034\021"
+	.ascii	"xq\fu\214\t\363\332\223\023\205\250g\"mO\245\227\356J\203\357"
+	.ascii	"\301\303\350\223OFu=a\3769\230T!1S\0313_=\226Gp\322\3445\025"
+	.ascii	"\005&\n\310qS\305t\\AR\316\211\370\300:\350\222\333P)7*\273\224"
+	.ascii	"#\226<\332C\261(\fK1u\177\017(\264\341\264\271\263\341eZ\271"
+	.ascii	"\331\200\215D\206`&\341x\331\022\254\257^\213f`\301\233\234\377"
+	.ascii	"w>\224\331\211;}A\030+\240\341\330N\006T\2667f\340N8\007\271"
+	.ascii	"\205[\241\212\203\3110qTL\266\0342\212\023\311,\n}o\263.{{'\246"
+	.ascii	"\313a\\\350yj\177\023\246\034a\r_\341+~\204\257\321s\255)\275"
+	.ascii	"\365\204\310KPVC\007\3302\362\335\361hO\205IR\303d\2744%D\246"
+	.ascii	"\302\231\300\337ZK\231\252\252\300\271:\230\353\362\240\376\357"
+	.ascii	"\303\352/b\\\277g\272ak\274\201s\352\322|\205p\265\242\201\305"
+	.ascii	"\276\316\376\227\321SN\235\035\235\335\342\200-'\205\324\035"
+	.ascii	"{\305`9\321\001F\265\300\347\357\261P\020\340\343\360\375\234"
+	.ascii	"\201\023\001\262\273\274\036&\0012\221c(\nX\004\362\306\251\235"
+	.ascii	"i\273\003\360\335;\221\271{\263T-c\030\210t\327\016\266=\314"
+	.ascii	"\226\263\266\b\257t~\326\215\303\356\367\250Js\226\017\261\320"
+	.ascii	"\371GP'M\n\002\361\323\240\026\007s\2702H\272\016\201\201\344"
+	.ascii	"\305\214\251\342\326Ql\336\256\263\027\013\300\323$\221\266\203"
+	.ascii	"\244\207\356\220\250\312\374dM\202\334\273R\243\032\276\204S"
+	.ascii	"\375-\205\212\246\275\376\244\367\204\032\341\332\235\213\221"
+	.ascii	"\r)BZ\260:\202!5\026\264\301C\357\335I\022\377}\251\321\026\035"
+	.ascii	"\202\210\267o\230\234x\202\303\272\333\375\2221\247S\223\326"
+	.ascii	"\244\374\220? 6\325\330\234\203\t\031\224\272\020\312\t\342\324"
+	.ascii	"{H\214\t\312\224\271\212\016L5\007I&\017u\233\343\276\030^\302"
+	.ascii	"@\247\353K}d\255c\216\215hP\273\311\220?\372[gO\201\034\200m"
+	.ascii	"\023\3437m\211\326Ph[\312}\366c5UBP\20703\006\323Mq\024DT\304"
+	.ascii	"\252\326E>Ld\016\fk\365\331/\033\240\232.\260\313\312\244\216"
+	.ascii	"\216\315!\226(\032\037\356\206\b\243\2606l\350\270\013\005\331"
+	.ascii	"fY\r"
+	.text
+	.section	.gnu.lto_blackboxWriteSysinfo.176.886e5061ff6073b3,"e",@progbits
+	.ascii	"(\265/\375`sw\325a\001\232OB\202Q\020 gi\215\001_\256\203\211"
+	.ascii	"\032P-\207\331b\030\2746[\221\375\263\355\352\016\027\177\227"
+	.ascii	"P>\266\036y9\016\363\230\220\b\247\345r'\013\310\214q\300\031"
+	.ascii	"g\334\235\270\272rwu\002G\337\256\253\0319\254c\2510\254fVk "
+	.ascii	"K\266{%I)\245\210\007\311\007f\b\354T8\316>\345:\273\224\321"
+	.ascii	"\331}\270\316\336\343\350\354<\\g\217::\373\016\327\331\241\214"
+	.ascii	"\316\256\303u\366\034Fg\177r\235\035\207\321\331o\270\316\356"
+	.ascii	"dt\366&\327\331m\030\235\275\206\353\354LFg_r\235]\311\350\354"
+	.ascii	"I\256\263#\031\235\235\206\353\354GFg\177]\347\316\032\235\273"
+	.ascii	"\317un>\243s\357\271\316\375f\350\334n\206\316\255\347:w\233"
+	.ascii	"\243s\347\271\316\315\346\350\334k\\\347\306;:\267\032\327\271"
+	.ascii	"\323\034\235\033\215\353\334g\216\316m\306un\354\321\271\357"
+	.ascii	"\\\347.ctn2\256s\2179:\267\235\353\334\327\243s\327\271\316-"
+	.ascii	"\346\350\334t\256s\317\031\235[\316u\3560F\347\006\343:w\234"
+	.ascii	"\321\271\341\\\347~3:\267\233\353\334mG\347f\313q\356/\256s\257"
+	.ascii	"\035\235[-\307\271\323\\\347\366rtnk\216swq\235\233\313\321\271"
+	.ascii	"\267\3448\267\026\327\271\263\030\235\033-\307\271\253\256sc"
+	.ascii	"1:\367\225\034\347>s\235\233jt\356i\216s[q\235\333\314\350\334"
+	.ascii	"e9\316M\346:w\225\243s\217\271\316M\345\350\334S\\\347\226\036"
+	.ascii	"\235[,\307\271\303\\\347\0063:w\224\034\347\376r\235\333\313"
+	.ascii	"\350\334Pr\234\373\211\353\334N\214\316\335$\307\271sp\235\273"
+	.ascii	"\353\350\334Lr\234\233\313u\356%G\347V\222\343\334[\256s'1:\267"
+	.ascii	"V\216sg\271\316\215\304\350\334\321\034\347\206\272\316"
+	.string	"}\304\350\3348\3448\267\021\327\271\213\030\235\233H\216s\017q\235[\210\321\271\261r\234\373\312un+\243s\007\311qn \256sW\031\235\373G\216sS\271\316=utn\251\034\347\366\341:w\217\243s\363\310q\356(\327\271w\034\235\033*\307\271u\270\316\235\343\350\334O9\316\215\303u\356\033F\347v\312q\356&\327\271m\034\235\273\206\353\334LG\347^\312qn%\327\271\223\216\316\215\224\343\3344\\\347>2:\367\233\343\374t\235\235F\347f\216\263\221\353\\dt\276!\307y\206\353l\203\321\231\310u\226at\216\341:3\215\316C9\316K\327\271\002Fg\241\034g\245\353\034dt\006r\235\177\214\3165\270\316\0240:\373\3448\303p\235_\030\235{\\\347\244\321\231\307u\3361:\273\310qF\272\316\0230:\353\270\316\0220:G\300u\206\200\321\371\0019\316\016p\235\033`tf\200\353\274"
+	.string	"\243\263\002\\g\032\214\316\t\310q\236\301uF\300\321\371"
+	.string	"\256\263\fG\347\030\\g\003\034\235ap\235_0:\027\300u&\200\321\331\005\327y"
+	.string	"F\347\026\\g\026\214\316\002p\235W0:\007\300uV\301\350\f"
+	.ascii	"\327\271\205\321\231\205\353\234\202\321y\205\353\214\202\321"
+	.ascii	"\371\004\327Y\305\3219\205\353l\202\321\271\004\327\031\205\321"
+	.ascii	"\231\004\327y\004\243\263\b\256s\bFg\020p\234?p\235O|p6\341:"
+	.ascii	"\227\370\340L\002\204\263\007\256s\007Gg\016\\\347\r\216\316"
+	.ascii	"\032\270\316\031\034\235G\270\316\030\034\235/\300q\266\300u"
+	.ascii	"\256\300\350,\302u\246\340\350<\201\353,\201\353\034\001\216"
+	.ascii	"3\004\256\363\003Gg\007\\\347\006\216\316\f\270\316\013\030\235"
+	.ascii	"C\270\3169Gg\020\256\363"
+	.string	"\361\203\363\007\327\331\303\007\347\016\036\234q<8\273\035\234\215\035\234\213\035\234\211\035\234\2078\316B\3279ht\006\026\235[\242\363o\350\374Dg\037:\367\037Q\221\035\223\253\0027\375:)o\216\354\336\033\327nQ\322\\\272\305\272\251t\227u[\351\226\271Y\331T\356@%\213\305\275\245\271pw\341\"3\267\226f\005vd\343*\300\255\205\213\325F\253@g\031\022AC\312{DTj\323\006\254\315\013a\267\234\205\330g}\205\271\3101\232\312\255\232*P\254\300\336\367-v\313\034\203\271\330\35537\271\245=\326f=\345\242\025\242\337\013m\001G]B\203\260J\2235\273\214H\004\r)\257\216\242\322\236\232\n\302n=\270\224\236\322l*3\372]z\205W\270/g\336WG\n\302n\373\314\004\334`\035\326l\261\242\337;%\345\335\201C\306w\005k\363\276R<\350\226M\b\273e)\035\002\330\255\260A"
+	.string	"\273\345\020Hh\362\263\001\245#4\037\300Ya\"k\363\276RN\374\221~6c\371\216\3130\031\036\303v|\345:\026\303t<\307r\034\206\301p\034\303\361\033\273q\033\263\361\027^c5Nc/l\345.\314\205\267\260\026\316\302h\\e,|\205\317\230\312S\266\302f\\\306d\\\205\307\230\nOa),RX\201\302\t*R\230P\002\n\022F\020!\004\020>8a\242\004\t\017:\340`\003\r2\030\201\301\005\026T \202\202\t$\210"
+	.ascii	"\202\007\034h\200\201\005B\344\2008~\360\320\001\3075\026\211"
+	.ascii	"Ca\020\330\376\336\237\334G\315X\024_Y\"uT\250\250\346;\2672"
+	.ascii	"nod\312<\271\211\215\251\272Y\331\271=]\375\255\312\206\255c"
+	.ascii	"{\023\303V\245\233{b\263\232\303Re{\222\353\013\263\206\005\263"
+	.ascii	"\366\026\267V\205[\023{cS]\333r[\363\321\306\346i\355\211-\255"
+	.ascii	"\357\313\232\2474\354ZZU-\315*\315\212\3652\001\2115I\230\320"
+	.ascii	"\254nO\322\267.\216\366$\025\343R\367$\335\332\"\265\322\362"
+	.ascii	"\024\206\315\202\026\346\244\372\024\266\205%\354\351\312\333"
+	.ascii	"S\224\276\263*5\212\223)\335S\224-+e\252Q\254\314\274\372\312"
+	.ascii	"\336\310\274\252U\274\304\306\234\357\351I\037\225\274\247'\330"
+	.ascii	")O\252,\345\211\025\013\274\247&})\344U\233`WxA\241\t\016'4\261"
+	.ascii	"R\321\227\242\013kB\327[\tf\236\272\304Ptm\221\320\345c\204\272"
+	.ascii	"j\327\223\b}!paAp\270*\327\007U.\253\023\330*\327\223\211\352"
+	.ascii	"\025\266\304\033\211\271\352\325\226\007\rW\275z\352 \310\033"
+	.ascii	"\007w\325 [\033\254\251V\365i\340f\252U\325\f\036\355\251\312"
+	.ascii	"j\304^\225\n\213\201g\237\250\304.x\262'\252'\013\314T\245\372"
+	.ascii	"*\020\363$\205\025AW"
+	.string	"\225z\243`\256*U\235\240*%&\301\225'\251\255\b>X\253RV\020<\360\023A\251\r\220\b\206 \271\375\214n\230\346\232\211\216/w\240\207U\003\307\354S\024\226\201\337\0029C\210\270u\210_\007g\264\260\3510:\266~!rl55\023\035I<\247\372\004%\006\342\356\t\312\352\210\003\265\364\201\215\207\267\263,\266C\233S\366\r'\355,[u\213Y'F\253Sv\253\350\305)kE\254s\312>\r\3158\361a\205\355v\306W\r\272\325\211O\f\330\323\366\037\030\300\215aB\3431\204\210[\267ml_\326\324\320\252X\256\234Q\247V\244ba`Q\276\274\240(\331J\242\225\205$\n\275\262\n\002\244\352\007\325T\216'\0347\234\232l\324\310\366\361\355\275q\243\327\306\f\366\256\f\2311vW\2707\2676\266/kjhU,W\316\250S+R\2610\260(^P\224he!\211B\257\254\202"
+	.string	"\251\372A\005\224\001\312\243\207\350\230bZ\002\312"
+	.string	"\345A\204R\002\312"
+	.ascii	"\345\2213\004\351\255\347\347\201\310[\377\217\202\"Wz8PI?\021"
+	.string	"lqL=mw\202Br\017\266x\337\227\275\tjG\263\262\231\211S\230\203\016`\356y!\031\034\265K\224\214\370\316F/x\f\336\255Hm\022\242\254V\313\251\304LN\0336\200\335^\360=\355\002XAA\363\022\253jn\301\200\005\317\374<\322F\237\321\257^[h7\245I\323\302\267\340O\260.Y!y\326{K\223\264\005*\370\246\2668<\253z\017Z\344\251\324w\320\277!\342+\370\007\2608\265B\236]\355U\213\345\304!|\3377\207\023*\n\330\255\210w\254\235\030\r\317r\235\2262!\336H\231\366*\337\323\366- D\246\250\221\033\223\344n\230\245\274oo"
+	.ascii	"t*\357U\276\231\246\220\332\252\026\3103\332\303)%\005\354\326"
+	.ascii	"\251|_i\016\246\240iY\205MM5\267\310\241\340\233\332R}\215V\312"
+	.ascii	"IU\342Z%\\\372w\202\247\340\335\032\244\345\341\274j2f\247\220"
+	.ascii	"6\312I\204\005\364}_\024\335r\013\325\356p\0329\342\214F\201"
+	.ascii	"\335N\360M\026\025\353\321=\r#\005\"\202\227\340\233\332\346"
+	.ascii	"x\036\255\200\272^\213\243\2143y\t\276\231\372\272>\202w+S\337"
+	.ascii	"\216\356i\230\250#\004\337\324\266\311\231\205\302\325\231D\270"
+	.ascii	"\344b\332\032O\245\022\327/0\234\321\372e\366\244\367\245q\001"
+	.ascii	"\263\223\313\331\345\335\004\301\323\200\225\364G\3549\272\247"
+	.ascii	"a\240\342><\360Mm\221\332#,\016\374\003M~}|\016\350\335\360\320"
+	.ascii	"\300\233g\325\n\250\336S\252\204Ka\340\033x\267>\371\261\301"
+	.ascii	"\373\255qzEq\206\205\001\273e\340KI\326F\207\005\322<\253X\\"
+	.ascii	"\317x\222\020\277@\231\337\235S:\30596\006\3546\304\322\033\234"
+	.ascii	"\2341\317*\024\327\253\223\314i&\\\362\" >\347\035\013;\247?"
+	.ascii	":\"\341\373&\241\340\237\334o\316y\206\305\211\206\006\354\026"
+	.ascii	"\304\367\264Yp\242\244\317K\f\251\271\205{\004\0037\365\341\217"
+	.ascii	"mZ\234i\037\374\3153z\370\246\376\276<\253Pp\036j^c\351\217\270"
+	.ascii	"\303{\370f\352\353\362\263:\271pk\261\323\352Lsg\032\260\333"
+	.ascii	"\016|\335S\351\232\270\"\377\2668\327\274\233\370\203\237\026"
+	.ascii	"'\033\267V\267\354ts\302y7\241=\253P\200by*\225\330\033J\323"
+	.ascii	"\304\271inA\314\271\376\246\317\252\256\0025s\202q\312\t\227"
+	.ascii	"\372\332\323n\036g\331W\357\314\322\037\361\320\357}\207\260"
+	.ascii	"h.\335g\250x\226a@\300^\031+\260\246\366\230\263\316\316IF\314"
+	.ascii	"I\234\322\037\261\013\336\326\356\3424#|\337\267\233\270\271"
+	.ascii	"8\3218\325x7qwi\342\231\032,\2753I\177\304\235\327\334b\350>"
+	.ascii	"\216\330\363\210\005\230u\r\316\213@\372#^\301\231\235z\3167"
+	.ascii	"\336M\356\317\200\205\364G\334xn\302\342\033\277\251\277'\317"
+	.ascii	"\243\025\327j\223\347U\t\250T\004\023\023'\237q\2113[D\263\026"
+	.ascii	"\034>\361\233\372\333z\0365\034\222p\251\241h=\225\272\013\223"
+	.ascii	"p\251\265\220<\257X\\;\b\364i\303I\270\324M\277\227\352\217\214"
+	.ascii	"\340 \376\3607\344G\344\231\343\327Z\374\204zF\001\243\200\335"
+	.ascii	"\016?\307\256\261\335SiZ\034\220\004o\352\017\353)\325U\250\204"
+	.ascii	"KM\253g\325\212k\020\341\322\f\r\272m\352\017\310\363\252\004"
+	.ascii	"\364}\227\272\351)D\270D\001\r\272e~\022y\032\361n\342\031\260"
+	.ascii	"\226\376\210\233L\027\371\260\332\2349r>f)H\355_Lc\355\033\371"
+	.ascii	"M\361\217j\316L\017\376\371\220\273\333\301\277\2500dr\360O\007"
+	.ascii	"\030\273\033\374\303\021w\265\301\277&\270\267%/\326o\211\177"
+	.ascii	"LonK^\254\037\022\377\222\030\253\002\353\366{\371w\304X\025"
+	.ascii	"e\332\370\370\373\330\326\250-y\261\334\360\277Q\373\222\307"
+	.ascii	"\337\206\261*\352\246\326\360\370\327\250\251\241\341O\303X\025"
+	.ascii	"b\246\322\260\374f\274\220\341/\303X\025tS\326+\277\035cU\314"
+	.ascii	"\251u\241\343\027\303X\025sS\\\302\360\3131V\005\234\332\026"
+	.ascii	"8\3768\306\252\200\323\322\306\357\306X\025oSY\326\370\2770V"
+	.ascii	"E\233\032\232\027\3764\306\252H\253r\341\357\302\330\267\346"
+	.ascii	"`\005\004K\026~-\214M\321w\005\013\177U\355\214\312\177\306\330"
+	.ascii	"\024|ST3~+\214M\261\2476\255\302O\306\330\024yV\246\360Sal\n"
+	.ascii	"6Sfb\374R\265\262(\374`\214M\261\206\f\n\277\027cS"
+	.string	"\340MUi\302\357\204\261)\314\250\2151\341\357\242\322\246\204\177\311\0245l\257\305\237D\312\227(?\022\026k8\360\037I\001\215\b\177\221\025X\260\370\205\240p%\b\277\325\tg?\370\253TH\245\370\247R\210\361\340\357a\002\030\024\377\216\022\274\236\370s\240P\342\304\177\203\204\255\032\3746FH\362J\374K\" y\032\374H!D\263\374/\bW{\354|\037X\351\261\2739\021\204\r{\236\211*5\354x%~\234aGC\202\352\216\035\353\301\324\030v2\035\344\250c\277r\3604\307N\267\201\023\030\3660\032\250\261\361\306\016\227\201\232\032l\354m#\372\324\330\3270\340\263\262{\271\300\315\026v.\026\264Ac\317R\301\335\025v,\"\306L\331\251\024\300\225\261\233M\3206\306^E\2025)\354S\"\250\206\261\213Ap\366\305\036\345\001+O\330\2418 \315\201\275I\003b\\\354L\030\b\333bW\262"
+	.ascii	"\330\222\027+\213]+D\024({4\347k\311\213e\204\035\007\020^C\330"
+	.ascii	"\2110\326\004\253\332\361\212\035\353C\024\b{\020\306\232\200"
+	.ascii	"6\345\201\212\375\007cM0\233\352\340\203]\n\307)\212\235\207"
+	.ascii	"kc\311\213\245\203\035\312\210\246\306\222\027\313q\260?1\366"
+	.ascii	"DV\255\330\304\356\304\330\023Y\2423\261\327\030\362-y\261<\211"
+	.ascii	"]\211\261'\372"
+	.string	"\204~\304N#\370\246\217;\013t\263\344\305z\303\275\247\326\266\341\326c\354\211\275\251\2377\275\357\373\256\341f\363\3304\334j\274\214\031\3563\335\215\365\302\221Y\362b\275\034\224\341\276c\254\360}\217\332\212\373\031\005r\223\031\333Jm_\0260(\357\373r\320-s\217af\354G\245\315Y\201\275\357Q[1337\231\261\336\364\276\357\373r\320\255\360\027\220\202\204\346}\314\374<\322\327gT\370\276/\nn1]\367\314\342\326\352\226\237I\236J\274\233\272\345~*\001v+|\b(\301\323\023\243\341Y\006~\360\203tL}4<\313\314O\256\236{v\t\3377\t\005w\230\226{6\341\326\352\226\237O\236^\336M\335r?\275\200\335\002\037\270\247\004\317K\214\206g\331\002g~\206=\245\336M\356\344M8\275\311\242w\006\351\217\230\245 u\273\021\222\265\362{#\314\334\375|dmp\3707\302\314\314\334"
+	.string	""
+	.string	"\266\357blL\222\273\341\t\234\2454[\201\314\002h\301\273\251\375\236J\203\304%\375\021\377\336\273\336\351\230\372hx\226\037\360\177f\030b"
+	.string	"v\323\357E$\375\021s\2475\033\243qk\261\013\\\365n\352\366\277\231(\241\323\233\242\341Y\366w&\357tL}4<\313\017x?3\f1"
+	.ascii	"\273\311_D\322\0371wZ\2531\032\267\026\037\200\253\336M\335r"
+	.ascii	"s\025\330m\177O\333\003\032}P\253\260)\032\236e\226\202\324\277"
+	.ascii	"\367}_\177#\314\375{\337\367\345/\302\214\343\354Up\234\235J"
+	.ascii	"\2135\273\223.k\366\256\266\322\354L\330\331\267p\234=\t\216"
+	.ascii	"\263k\271\316\236etv$\256\263G]g\207\036\235\375\210\353\354"
+	.ascii	"8\034\235\335\310\002\316^$\204\263\023q\235}\210\321\331\205"
+	.ascii	"\270\316\216"
+	.string	"et\366+\327\331\255\214\316\036\304uv Fg\257r\235\375\207\321\003\275\2066\374\342\2742\312\2426TK\373\266F\267\272\247uO\\\360\362M\035zyV\241"
+	.string	"\035v1\322b\304E\2704\034b\375\366b\035jq^\031y\261\016\321\272|\243\331euO\353\232\f\200\3137u\210ex6\214\332\362\315%mh\305y\325\266\245L\313\267\025\332\325B\226*\317\252\022\206T\2066\320\276\263\254\r\245a\320\302\252\337hF\256X\300\022\305\213\315\225o,FlC'N\251\321\365\3120\207\263\3574\273\037\322=\255\253\022"
+	.string	"\365\233:d2\\\"\0243\375\246\272\r\223\030a\247\303,+\337^\256\272\247uT+\230}S\207\321\341\021!\227\262o3\270a\021\247\324\b\257l8\204\fH\367\264N*"
+	.string	"\322o*\337U\276\251C\254f^W\271ZI{\354\273J\225\363\252\261W\022\303\037\315\254\246\243j\270\261o\254\335\224o*R\316+\267\016}4\263\334\354\332\203\f:\345\335\032\025\373\226\032\201\031F9\257\234\315u\270\243\231\345X\350\020\252\251\244\231\324\344\362\272\253\330;\033\273a\216\260\367:\252\254\n`\337\324!\216\241\223\360H\224o0#\271a\215\246(\303\245\257\357\267\367\301\007"
+	.ascii	"\257o\3520iHC\030\005\345\333\213N\230\325\001\205\357\311w["
+	.ascii	"4J\257\205\2237z\302\243&\337N\352\204l\234R\037M\360r\370N\323"
+	.ascii	"\241\206EW\2323X&\337]v\302;\347\025\020&d\270\276\323\354p\300"
+	.ascii	"\245\260\344\233*\264{VuY\235\021\031\243;\341R\320\213\222\357"
+	.ascii	"%Ff\204sC\224\204\331\372~\373&\267\025I\342\336\202cZ\337I\320"
+	.ascii	"\b\331\240ZkY\337iv\317\304\206\002\2224k\220+\372\215D\215p"
+	.ascii	"\313V4\013\364;-\372I\326\023\216|S\205U\341\225\340\020\034"
+	.ascii	"\276\217\030\255\021N\235\322\034p\020\232\031\371\266\376\021"
+	.ascii	"\027\025E\276\251B2\341X\360\211\310w\021\243<\241\024\247\364"
+	.ascii	"\213\210Pl\310w[\2374\205\220o\252\020L\370\005\334\303\372\026"
+	.ascii	"b\244'|\342\224J\301jr\365\235\366&\314\004\253\256g\325\n\250"
+	.ascii	"\220\013h&\310\267\225\321\033\341\226SZ\026D\013\310w\027\273"
+	.ascii	"6QJ\250\372\246\n\221<\253V\\\241F|FY\341\022\020\314\217\357"
+	.ascii	"\252#\241\021\247\364\312\017!\021\252okt\315\023\024S\337T\241"
+	.ascii	"\020\341\025\026\251\357)$!\220-R?||\267\245iBB\217)\037a<\276"
+	.ascii	"{(\t\243\234Wj<\204PQ\337^\314t\215\260\343\233*\314!\304\001"
+	.ascii	"L\002\365\275\203I\330\364\006%\254\241\343\333K\031.\021r|S"
+	.ascii	"\205K\302$\340\217\247\357\0346\204GsOY\034\337ivvW!\334\340"
+	.ascii	"\273\006\3378\301\224\270\002\227\234\276o8\005\3338\245c\234"
+	.ascii	"\3304}\267\211\t\002\002\323\267\215oj\020\357y\324d\3274M\034"
+	.ascii	"9\204K\355\031\246\032\3376\240\202f\360j|\277\331\211-}3E\005"
+	.ascii	"\357\360\226\310(\275\233\311I}\220\364M\r\332=\253X\\\353\232"
+	.ascii	"=\232R\302\245\366\r\351;\211*8\347\274j\272A\nC\343;-\352q\335"
+	.ascii	"S1Q'\216\276\251\301\270\340\333\323F\211k{\326\357\367QU\220"
+	.ascii	"\355\355w\355\371\235\346\326=\025\003e\302\231\366\254J\001"
+	.ascii	"j}^\225\270\266`\315w\006\tnYj\376P,\213\321\267\325\356\013"
+	.ascii	"_\211\242\352\263\n\205+O\245\022\327v\311\r_t\025\234:\245B"
+	.ascii	"`\234\363F\223\353\206\037\232\315\370\356\022\235J{C\202"
+	.string	"\3712\336\206oj\220,8\326F\211\336\006\022A)Ni\267I\273\020}\267Ec\274\214`\230S\332{P\260\306\213\361\2757\364\314\340\227S\352m\327\367}M`n\n\tz5\211\374hr\271u\350\275\315nK\360\311\362\335\032\235\352\322=\225[\343A\005\276\251\301&\317*\024\327.!B_\201%Ni\273\005\223\004\2254\263\272Kp\013\253\311\325\325\237\320\267[\226\362\273\252\005M\007\024\370\237\017\212\036\221\002\372\240`\021\"C\200j\370\237 \326U\320j\253\006\237\247@\020\210\211`U\360\307\226Op\nF\225\215\203\235O\376\213oj\320G3\017\3055\310\243\315\321\363/\214\004\241\234\322\236\203\352hfu\3325\207\025\332\363=\027\345\371\344\221 \016\247\324\311\2567\232Y\315\007uj6<\357d.~'h\303)\365\272`\215f\226\277\005\231\300\232\\\336\346\342\275.\250\204|o;\263n"
+	.string	"\201\227\300O\340\233\032Dj\346\225p\r\0365\363J\264J:?\201>\247\264\305@\371\232Y\335v\335\363\002\325\371\026\023\201\227\200\033\247\324\257\\\365\232Y\235\205\266\351\275\b\274_\261{\300C\200\215S\352f\3264\263\234\356\212Gmr9\034\364\001\357f\3228\340\035.:eE\252\001\r\277\200o\300\031\354\036\003\276\001F\200d\234\322\246\033\323\314\3526;+\003\276\351\024\360\0138\002\254sJ\335LL3\253\373\350:O\001\357f\tx\032\232Q\240\234S\352wa\232Y>\007\345f\022 \230\246\022!0\316\251\326\344r\267k/"
+	.string	"\330m\002\336\357\242b@7\340\333\002\272\232M\232"
+	.string	"\273\235\341\335\315n\212\314+\003\003\274\f\217"
+	.string	"\266f\336\n\340\332\317\314\001\036\001^\210\372\356jmz5\003j\312\346\272p9\300\367\235]\f/\203\026\"o\313\322\364r\020cesh\325\030\336\333`x\003\\!z3\350\023\340Y\323\313) R6G\235\302\360o\026\245\3225b"
+	.string	"O\200\177\301\254\231\207\202\354yT\342\372\273\026\340_\240\362\354\352\271)QeP\244H\013\360=\027u\341\t\020\366\354\362+P\260\2502(Q\276\\x\277\322\302\017"
+	.string	"\312\263\313\361\256Q\200O\210\224Aq\322\244\205w<;i\020\fT\370\025\236\205\256f^\tP \027\234"
+	.string	"\236\205\255gW\323]\223t\225iie\t\340\233."
+	.string	"\277B\364\331\345U\350X\231\326\021\034\002\360^\215\002\340U(\362\354\362<h\030\220Hs\212C W\2465D\b"
+	.ascii	"\336\363\242[\300\272\247rR\027\240\360)|\213o*\360\252\231W"
+	.ascii	"\202\025\030\344\214\305\267 \001\374\361\354j1T\315)\315\300"
+	.ascii	"\330\224\024\213o1+>\205\022\300\036\317.G\273\362hN\361\017"
+	.ascii	"rQ;V\274\243\331\235\360(0\360\006P\307\263\313\371\240\357\233"
+	.ascii	"d\002sS\n\314\321\234\342\022D\225a\265\300' \016o\266\002\273"
+	.ascii	"=\341\235/\272\305\253{*\007e\201\212o*\260\351Y\225\302\025"
+	.ascii	"X\2439\326$\023.\375\242\244x\025f@%\242f`\214l\017\230\004D"
+	.ascii	"J\361\375\346$[\201\t\337T\340Q\226\253\2047a\332\356\265y\343"
+	.ascii	"\246\204.>\021(\332\260\371\035!\341Q\234\265j\344\310\360\322"
+	.ascii	"\240!\341;-*\266\244{\032\346M\034\005#\230\271\373Y\211\360"
+	.ascii	"#\274[\261\264c\236]\035\202\013\331\031+\260\367MB\321^\230"
+	.ascii	"\205Z\273&\332C\200\246\n\232\036\330\373\276&t\313m]{mj\341"
+	.ascii	"\322\264\246\001\273\025\341\333\213]\022\275\tB\370\246\266"
+	.ascii	"t\255\334\323F\211\353\213\001\341Ch\343\234\3225\347\030\bH"
+	.ascii	"\272\247a\362\342$ \321Mm\337\236U,\240mV\032\260\226\216\254"
+	.ascii	"\211\340\203\265gU\t\327\264f^\211\353\031s\223\255\355\362\214"
+	.ascii	"\n\333--\227\246\033\\\023\f\030`\267\037|\210\250X\0215\020"
+	.ascii	"\224\370\023"
+	.string	"\337\3246\313\363\250\373\256\325\347Uc\037\314\304\237\220k\317\250&\336\337\354H|\211\177\300\215\256\265\322\254+k\315\232v\334$\323\274k\336\001\273%\361\236ea\205\353\201n\242\001z\360\3755f\307M3\355X\023\r\025\017\276\247\335\002\201b\325\023\023\342@\007R\236U%@[1'Y\211\353wq\360\035\264_m\024\347\025\267\0267\3254\3274\327"
+	.ascii	"\273\345\340CD\247\254\272\247a\270\3045\200\301g\360\033|S["
+	.ascii	"(\315<\026\320\246\236p\351\243\255\223\346\233\022\327&\237"
+	.ascii	"p\351\247\246\376\2105\370\r\232\331\266\213\211\006\337mv#>"
+	.ascii	"\234\024\232\301\324)r\362\005r\231\224\201\324\261a\231\214"
+	.ascii	"`\251d\356 {t\224\314\030H\007\230g\204\b\022<#\202<\024\202"
+	.ascii	"\207|l@60\244\263\263<"
+	.string	"\362Pr\031\203\211L\366\f_\304p\221\344)r2\306\017R\206N\362\207\307G\207\251\2041\304\363\241\003\377(w\224L\345RH\007\210HH\007\004\003\021\t\351\360$w\202f\f\005\305\320I\016\305\370\300\313$\217\217\f\345RH\307\206\345\017\322g\231\034:\352$\231H\031>\314\035\244N\222G\t\264\364A>\300C?\311\240 $\214\035\235\0078H\351\263\263\374\300@K\244\016sh\351\323\243\023\244\324\371A\356,\360\002\t\3442\322\005\016\357\354 ]\276\001\206N\217P\361\210\3037\300\370\220\3037\300\360\320#\364\243\223\\\"\211x\226H\030G\035\"\344\f\227y\202\220.x\220I\236!P\214!\036\037!\227\211;;H\034f\016)\225.tzz\206\254c\003\022\250\006\037\241!\235\236\236\016,4\244\223d\"\177\224B\313\236\236c\222\310g(\b\271d\352\360,\221DKe\017O2\331\303"
+	.string	"\023!g\350\360$\231\310\345\213$3\310G'9\024\003\204\316\220\013\344\007\236\037%\214\241\344\022\006\223\001N\362(\201tf0}d \227/t|\230A\310c\002\202|``\002\200\307G\350\003\217\217\020\216\017\210\017l\003\362'\2714\262P\f\236 \037\"\037\227{z\224\314\030;0v\230\312\240\016D\310\031\035\370\006\030:!\034C"
+	.string	"\3017\300\320\t\232\301\023\202o\200\24134\204\024\"R\376|\320Y&\231?>=:@\313$\223\347\310\311\235 \244\f\036$\016\007\371 _\350\0249\310\007H\207\007\370\002\t\364\223\224\221\374!B\316\b\362\n.\310"
+	.ascii	"c\207\351#4\344\025\\\220\341\347G\271\024\362"
+	.string	"\020\323\007\310\347\307\b\334Y\n\231g\004\211!\017\355,\207\314\f\362Q\n\325\200L.]\350 \205\230\0358\311D.u\220B\314!+\205lH\352,a0\207\314\343\003\244\263\204\301\0242\f\023\311\037\237\036\345RH'\311D.\177\224Kf\220r\347\304N\017\006CC\311\035\345RH\207\307G\350\310@\312\240$\217\316N\320\f\017BJ\345\317\220\227\312\241\240\344\f\314\240\344r\031c\007\207{\222K&\322\205\f!\223\2101b\310\311\027H\346\217R\306\317Or\207\211t!\303\003\023\351BF\221c\214xn\001\004\235\235\035d\220yF\220\340\031\001d#\3330\302\206\017ZN\376 w\206t\224\313\031/\2126 \201\214\234\374a2\225K\030\314 \037 #\277\b\362\341Q\356\004%u\216\254\364a\"\227\"d\020\312Pd\236\021\317?H\031\313$3\310G\204\013EN\002!\203D0{\220\313"
+	.ascii	"\0249\t\344\303d.\221\314!\021/\224/\200\340 \245\017\023\t\264"
+	.ascii	"T\366\004\371\210\340Y\"\225*\034\031\310I&\222\207?0\021\202"
+	.ascii	"\211\021\200HfR\205\"\017\215\020\301\301\320\210\rD\f\215\020"
+	.ascii	"14\002\207\203\224>C>2\222\313#3a\274\360\371\351\tB&\177\002"
+	.ascii	"`\344\241\021\317I\241\031L\021\311%\222\bh\351\303\002\016\223"
+	.ascii	"\307\231A.\020)_\370\300\fr\001\306\013\237\0010c\b1c\304\260"
+	.ascii	"T2\225@\307\236\030.\036\311D\256\360\"\310\007\006S\251\004"
+	.ascii	"\232ag\331\201wL\330\240tQ\303\016\362\307\305\211 \037$\320"
+	.ascii	"\211\235\345\320\t\023\024\260R(\271<\301T*\227'\212\314\314"
+	.ascii	"Rh\364\027\341\326Z\343\306\f\355\327\375\004\366\264\205{ph"
+	.ascii	"fh\317\375\004\372\326;1\263o=\267\240\361H<\203J\367\264?\264"
+	.ascii	"]s\213\317f\263vA\236\344y<\243\035\240\306(3\355Z\357I\376\255"
+	.ascii	"KVH\317#F\250gTh\324\341Z\377rixVa\235W\227w\007\224\365M5>="
+	.ascii	"\253V@\2157\236J&\2408hH\336\263\336\335\242F\033\317\256f *"
+	.ascii	"\r\314X\303\310\204\344\273M\n\356'\372M5*\031\221p\234\024e"
+	.ascii	"\031_\266\206\200\266\3335\372!x\260\325\200\303;\264\317I\325"
+	.ascii	"X\240{EI\212\224\b\227p\250\216\274C\271\212zG\276\351\354\334"
+	.ascii	"\310;\016]\305<\347\225\221w,Pi\024 \362^d\215\223\252\315\324"
+	.ascii	"d\231\376\250I\361L\321\223\"^ElQ\024\"\357d\321'.>C\312\\\307"
+	.ascii	"\024\205I\205K.\235\220\367!S\212uB\276\337\242NZ`X\275c}S\213"
+	.ascii	"tN\252&s\335\212r\256\331\325;\326X1\356*\310\273\025Y\361\315"
+	.ascii	"\203\274W\251\321=%\023\026\367\002\3107\265\330\366\254j3\350"
+	.ascii	"\227\"\263\242\251p\311\335\252z\007RtVL+z)\332Q\204EX\004\354"
+	.ascii	"\326\253\276\335\354\224\272\247d\242\304\365\374\350\262\305"
+	.ascii	"\255\242z\377\201VD\253Ra\1774\222>\365M-^)R](-E\263\".E\262"
+	.string	"bY\2215\255hm\r\330\255OA\371*\243\227\345q\251ojq\2548\305U\362\361.U\024+bs\216\371\370\275\356)\031\256\270\235\036`_jx\274\367p+>!r\342<\272|\325\3515\267p\341Q\337\324b\016E&F\271\035\357QpE%D\355e\253\250\256\273$\361\035_\276\352\330 \035\352\233Z\314*F\215h:\336\241\300\024qxvu\233\221\242\272\366RDG\232/1zj&\220\343\233Z\034R\3042\206=\275\347\220+\006yvu\332\225\213\350\212@\212\352\332\n\345\037^\261\352\351\355K\214\327\031\035\034T\317\252\256R\2242\"\271\361\216\303\256\310\243\030u\203N\357N\002NP9\2149\232\336\235\310\024o85\321y\215\211\200\r\033E&\274\032\3576\356\212IE\244\032zu\020`\372\246\026\217\236U}\005\232-2S\204F\270T\\[zgRC\334{\2634\3475\367"
+	.string	"W\322\313+\232%\275+\025\255!\342\245!\252)\312+\322+zS\364&I\354\013N\017\214\003\220\276\251\3043\317\252.\303\026\361\025e\205K\305%N\343\035\351\210H\306\2168\306\bI\311\210\211\t\330\255\3238\363\005\347\365\326"
+	.string	"?\252\243\033\342\357\373\221\rb\230gW\034\021\214\221\023\016\243\0349\200\335\372\233\345\353\215\215\001\331o*\361\355Y\225B[1\252\357;\013E\\#\246\021\325\214\242z\030II\365y\371j\323S["
+	.string	"\3377\225h%r)*\355}\363\275[\251\210Y\236]h{,\264}\245yY\025\360\346\233J\304B<#\352\271\371~\363n]zCk+8\255\367\355\346{\211\t\222g\271\333|\353}\004|Kg\362\276\333|W\021\315\210\210d\3042\243 WFB\204"
+	.ascii	"\273\355\274\357i\377\236\020\261\346`\025\266\205\006\274o6"
+	.ascii	"c\317\243\2562"
+	.ascii	"\205(f\3157\033\"D\261\2605\255\346\033\317\b1\312\227\232\026"
+	.ascii	"\334x\365\351\241%\340\314w\232o*\021\312\363(\005\242\023b\032"
+	.ascii	"\232\3574G\210]L\320|w1\363}&J\\\242\304L\013_\274\370\256\314"
+	.ascii	"\200\375\246\022\223\020\263\210dw\337\330,\"\364\310\035\013"
+	.ascii	"[\274\370\246\b(\363M%\032yVu\025\"\021\"\327\022\231\3572I\210"
+	.ascii	"X\317\256+2{ze"
+	.string	"\315-\016p\375\036\363M%\006\201\022\253\214\224\030q\t\227\210@\354\276\307t\021\247\210\244\354\276\323\354\352\276\257M\210=\210x\324\265\200\347\225\3475\326\334B\0061\337T\342\016\242\016\242\023\335\267\230'D\034D7\350\262x\261\361\222\022\303\\S\2156r\337s^D%b\222\234^Xs\013\003\204\371\246\022i\020\337!\035\230\3570Q\206|o\206{FaR\243)S\200\3356\230.^k\276\232[\300\020\247\227\227\006\367\03576\304S\323p^\274\360\274\2364\267x\341\r\215\031,n\337o\357V#\262a\231\341\230!\031#3\243\251\321\231\321\031\260\333v\023\3632\243'\226Cs\213\002\264}S\207\327\241\230a\024\266\3576,C9\347\225\021\225m\b\346\313wZ\364\271\272\247u^\004X\373\246\016\341\206n\303$j\037\2105\250\204\341\032\r\t\320\364)G\035233\003\230m@\001\203\033"
+	.string	""
+	.string	"\307\2010ma\325"
+	.string	"\024"
+	.string	"\017;t\222f2:\234\317\347y\212\204\231\214%\004$\034\352\330\270\205\327\034\213\227\020\265\351\202\017\247\030\336h}\241g\233\321\005v\347\254cCrS\324gqBY\341Kj\355\220\033\314EX\331\234\246o\236f\256\345\2131\215]t\271\bq\347lN2\204\373\213\315\237\"\037Z5\333\3604\301\3259<D!\340\"\227Kt\177\027\254G\005m1\004\003\257=\257\003X\351\211\004\324\2026s@GP}\303\002\017t\260D\226\237\220\274\372&\002Q0\303\206\375\207Kx\247gV`K`\\+\351\025\035\005\330\004\322\rB\007\"*\243\377\263\331b<\257\f\t\205`"
+	.string	"\202\355\330\334\322\177pnc\331r\356{(\032%\204e\2418\342\337e\343\001].\272-\\\r4\270\361\357_\270`\325o;-\304HL\232&\251\241\364%Q#a\004\334\021\201a\221\372\t0\271\266\344\246\177\377\325\223\3505\356\027\033\"h\207\330Y7\213olWNGT0)\262\242Qn\032\340\366\316h\277\327\364ucJ\"\r\214\364'{\221\376\315\261\245\257\235\3107\365y\f\217T\027\203\356\315\362\024\006s\250\240_\272\343o\340F\225u\234\233Kl\0178S\312\345A\220\342\231.\213\325?T\034&\252\262A\227\350z$\332*C\025\b\223\376\361\034\366\215\b2~\272\364\205\347\036\022_\223\026\234-\220\177mk\314fj8\261\351#\344\330\350\270\314e-)@b\254\276\266&w\363\267\337\214\207\245\332*\236\216\351\025@\271\304\211\277O\n\002\276\376\026\256fBz\322"
+	.ascii	"}\022Me\210?\020\031y\263\2472\034\366CGq:\230Q\236>\3769e\264"
+	.ascii	"`\371S\002\177\276i\211\301\2520\240\327\r\b,$\310\301y8\346"
+	.ascii	"\3126b1\2228\363\264ue\242\200\221\250\342T$\267\363\302\017"
+	.ascii	"\364\310\225\376\244O\005\217\002\330\032\367\257\020\265\310"
+	.ascii	"\250\210\240\331*\226l\361\210bz\370lV\037\325\200\275\344\312"
+	.ascii	"h\223\366 +\343\203)\332L'yv]\322\213\314GpY4WI\f\202\200\270"
+	.ascii	"\205c\242\2565u\277\240\005r\366\002\005\347\333\222`\316\250"
+	.ascii	"?\235\235\302ZG\037\016k\251\215\204\237\337\331\004V\302\345"
+	.ascii	"\035\001\\\007\265\266xe\316\021\241\355x^\031\275\311h\334i"
+	.ascii	"Sh>\202qN\266\237\261X[\306X\303c\332\341\261\021\366\311\325"
+	.ascii	"\274\217Q>[\2668\2130\271\253\275\036d\210\210\027\205\320\376"
+	.ascii	"\027\n\235tD\344\275\003Y\214\365\274-65\202\024i5|s]\233P\273"
+	.ascii	"2\375\264\225\253\337.\263\250E3h\001s\004\256\"\331\371D8\234"
+	.ascii	"\037\252\256\017\007RsL\242\344\207\206\341\240+\315\223}\002"
+	.ascii	"$\272\302[5\322q\023\353\314F\003\253\331\247H\277R\363m\236"
+	.ascii	"\033\335\306g\267\241fts\202\264\247)g\336\225\306\225\331j@"
+	.ascii	"\324\200\343X\201l\374\"\275l\310\201d\222[ _v,m\317\373\221"
+	.ascii	"\305\355\003\005\2555\013\036`0\260L\301S1\347\367\241k\355\026"
+	.ascii	"\027\265\341\272\306\207c\243w\246\"w\310\260$QG\250\352\205"
+	.ascii	"n\r\275\230\362\302E\363,]\016k\231V\316\231\235\377\263\221"
+	.ascii	"\244\312\306(1\375\246\350\362\273M:\314\037n$\314\031\354\225"
+	.ascii	"G\253\302\220\311M\b~\321\037\024\2539\234V\3722\247I\004\036"
+	.ascii	"0K`\007\r]\244+\330\273\025\r\220\024\325\027\004P\005\224\027"
+	.ascii	"\316\271p"
+	.string	"\377\245\367\244\256\2635\364\251\224i>\364\213\016\333@\264S\306\310J\tOf\232\344\367\236f@\324\341\020\364[\376/\036lj\325\255\244\"\346\t:F\030\013Y\201\221\260R\313\375\264\201a9\343\260\306KLr\213s\"\207\242Z'E\213Ra\245\206-\222iq\254\257\274?\277} \2779P\203e\257\003\330\330$e\370\211z#\\\212\263MY\314\211.3\274\344\250\211\230\335\002E\363\357\210f\325\201H\023\203\206\370\220-\355\006 $\013\225@\372zQ\302?AQ\354\276\204\035h73(\365\235C\301]\027\207\254\247\004\336\375z\013\350C+\274-\267\336\217\357\316W)\234jNc\240|\247i\225*\362\212\337|H\341$`\201\326'D\336\004\372\246y\275\333a\223(\220V\220\317\037\007\020\223\204\rX\364\315\027\335!t\344\324\202G\007\227\341#\206g\f\274\032?\365\2143\276c[\247\331"
+	.string	"!\247\303\210\364\035\016\304\271"
+	.ascii	"\240;\001\353\276 \316\256=\213\036\fU(\317\0058Q\221 \314jF"
+	.ascii	"\346\234\023*C\227_,\r\336\300\345\005C\234K\220\234\266+\025"
+	.ascii	"\351\tD,\b\227\335v\003\304\221\212\366\263R\225\b\356\273\203"
+	.ascii	"k\330I\020\227:F\203\235\204\230\023+\331\205\323\327\230k\037"
+	.ascii	"\004:\315\307Gb\256a(\310\262H\317\031\314c%\370\t\321\f\230"
+	.ascii	"\3152&\317D\fp0\321\353\f\220\213\311u\027X\033\376o\264\027"
+	.ascii	"\314\255\354S\361\310\273\240\217s\260\240\223\212\fl\032\204"
+	.ascii	"Z\353\377J\231\265x\251\302\241iO\"\300`I\301$\362\021F5\232"
+	.ascii	"\205\024Yj\016\376{\222uz\301'\310h\035}1\322,\005\355)a\220"
+	.ascii	"!\206\357\2737q\306\024cJ\233\342\367\3634\272\276a!\tq\364F"
+	.ascii	"\310\004\362\211\314}\345)\233|3\320\252\346r\373Q\025\207\256"
+	.ascii	"\033\376\320\343X\302\316Xnc\340\347\352\177\244\222\220\023"
+	.ascii	"`\243\360\341\003\243\204\004\004F \230\232\312\350C\202^a\264"
+	.ascii	",\274\225\221\224\300\256\3732\330\022h\336\026,.G6\0270._\334"
+	.ascii	"<\3003\350\252\001\255\313\315)^\005\231\322\224&KO\031H\225"
+	.ascii	"O\204\236l\231\bq\006#\234.\006\320I\220\256!,\001t\230FN2)\272"
+	.ascii	"\007\003vJ\212cY\265-1\002\270\030\b\264\342\335\356TL\310\335"
+	.ascii	"\020\021\304\346\373\212\252\307\212\215\331c\365\261\213nf\333"
+	.ascii	"YX\302T[\311\244\037oK\224GO\027xi\220\315&\034\220\237s\327"
+	.ascii	"h1\207OS\272\223\021\031\237\020\032[>k\0055"
+	.ascii	"\341\37781\2223R\364\013\232NI4,D\311{G\032\303\204q\317]Iz\036"
+	.ascii	"\033~tZ \035\332\317(W\254\275R\220\277)\305J\227\371 \252\204"
+	.ascii	"\333/\2450\325L\007\022\257}\371`\276\322\"<\340\204f\371\021"
+	.ascii	"\034\346\215\351r\231D\271\356\264\b\024Uh_\344)\305\245\306"
+	.ascii	"%O\377\273\356\341\224c\302\264\347@\013w\b\370\311b\232Le[\236"
+	.ascii	"Y\230\355\2403\035\375U$X\220\246\263R\263u\276Z\035\343=\273"
+	.ascii	"+\241\017;\221\023\f}\302\367\324Q\252o\366\342*\031\240W\031"
+	.ascii	"\327\302T\234\0228\231gji\371!&S\226\225(\266\020#\361b\273\036"
+	.ascii	" \037\233\303N`\322\371y\347\204\f\224\255\241\033\224\362>\351"
+	.ascii	"va\007\364A\006B\213\275\246\315\241\253b\276\310S\260\035 \264"
+	.ascii	"FI\374\b(J\340n\253Y\367\322e\3471I\337dv\\\245\031-@\201\263"
+	.ascii	">\333\271+\212\201XG\255\221\fI]i\332\262\264n\310*.c\001\264"
+	.ascii	"g|\256"
+	.string	"\221\016\b\237L\234]\374\313\027ek\023\232\314*\032\017\277V;<\275\025\272\255;\224+\367\037`9\302\020\23096(\023\223\354uEX\211\302\313.\016\237\017\346\334\357\240\370t\252\270\026\013t\353\370\0034[\nT\r\221k\222\327\007\367\320Nq\324\016\207\262\023\005\0362\257\037f>x\350\017&\f&\027,C@\204\201h\027\310\004\220\3572\261\005bQ>\304\334\364\2033Y\307\204r\224\341j\344R\006\377U\263,\365\365\265g\t\275\232T\335\b\235(\016H\253-V#w\021\247\206\357\243E\374\243\320\f\002!\016\2317CJ\313\301T\271\037\007\213#\213\372\324\321\2451\270\333^\260\264\034\"8\242t\271\372Nv\324\216\343\200\211y\357\007\343\235\312\026p[{\205~i}%\"\3228k(\204>\263\017\210<>8tP\013+\316\366P\356\200)r\222\357\364H\016B\006}\347d\325\334\274"
+	.string	"n\303\363m%\022H\330\330\207\301s\260D\341o\317\003A\355\222\201e\262\355R\037\3651\223\007\326\202\324\270\034}h}\325\250\3057}\332\360\f<u\f\327o\345\337\362\204\314"
+	.ascii	"\240\210A\345Ezu\300\211\355R%\267Oz\211\213!}\374\"\237E\312"
+	.ascii	"m\0247jIa\025 O\306\364\346\334\325\331\2733\377\034Y\312"
+	.string	"\270\300d\330y\275\f\362\354wM\350?t,Y\241-\210\034p\264~\215\233\016\247\003\272\306EJ\322?\031\304@\2709\225j\210\303\344~\270\212\200\312\325\\|F\027\2442\220ca\271\306\3769P\360h\"\323\004\030\031\232\207\226p\264\204\240\322\243%\004\225\234\272\2662$\316\220A\250\347\270K\026\253\276o\322-\240\330.QFMY\031\232\344\241\n\354\023\be\260\177\216\241\253(\214\275\215v$\261[\340\313\340\031Ry\224T\2111\300f\322Wb\033\370\317\376\256\354\2610\003\277\216\326\331\246\373\266\020\217\272\322U'(\210\376\n\203\301\336\374\347\307\236\0013r\304\270\223\355\372o\2051\361k\303\035\231o\223Ak`\016~\346\0177\361\355\331\214\245\203M\276\350\375-\330\307n\n\347\341^+6x\304x\235l\235g\0177\321A\3318\235\217\305\347^\360\235\006/\036\250t\0028H:$\371\212"
+	.ascii	"1\2502J\366\201\255\n\035N*\374\241\0337\266\b\265q5\237NAT\371"
+	.ascii	"-\233;\362M\235\020\302\226\322\253\355x\225\360\201^\214\340"
+	.ascii	"\205\311\301\307\002\n\016\022p}\230\317\316\231\031\274\356"
+	.ascii	"\251\275\356\277;\347C\331\267\037\350;\260pp?\f\313J*\022h\231"
+	.ascii	"z\327_\341\353b|\346\212'9.\207\331\313\374\b\013\332t\372O\355"
+	.ascii	"n/\034\177]\n\241\r\030\222\017\370\251g\372\367Y\314\3353\004"
+	.ascii	"*\237\307\321\024\330\224:\235\267\030\377_\262\253W\372\313"
+	.ascii	"\311\022$e\254\035\3169\255d\300\327\352\216\242\265\342\235"
+	.ascii	"\213)-\252\204<\265\336e\2510\311\224\320U\322\272\003\365d\230"
+	.ascii	"\\\327?\373\002'O\321\356\006\205\faYj?k\312\310n\366\271'h\017"
+	.ascii	"\323\300\305\325X\212A)\215\201+W\210\006%\326\330\336\215\370"
+	.ascii	"\361E\342Ej]\272\025\351\021/8\252y\317\374\017\315Wq\212\372"
+	.ascii	"\370<3\320\206D\216S\"u\266\331)H\221\244\201\036\201\230!\001"
+	.ascii	"h@\177(G\025k\235\225f\246\247\350\236=+\341\212\rlM\245QDl'"
+	.ascii	"\302^\266\013C\253[\250\035{\244)\004[\251\242\244\0035\203\343"
+	.ascii	"\315\r\350%\3321\016z\340\252\211\f\370\201g\0247\242\336'\366"
+	.ascii	"R\034|\201\330q\222\026G\210\275%\256z\307\244\365gt\211\346"
+	.ascii	">\316q\r+\264\024\3064[KII\240\215\361\345b\363\017\253\372h"
+	.ascii	"d\330\377\264\324\375\243\306\356\371G\306\244\306\277\217\211"
+	.ascii	"\315\r\352\376\201\324\366\177y\261\377\207\335=\266\266\356"
+	.ascii	"\177.\366\376\261\353WC3:\3067\362)\266\310\266\253\376\001"
+	.text
+	.section	.gnu.lto_blackboxWriteEvent.177.886e5061ff6073b3,"e",@progbits
+	.string	"(\265/\375`\036\007\265!"
+	.string	"\3468\313H\200ZN:_\0330\264a8\362\024\301\377\323I\214\245as\r\\\003\030n3~\272\013\337>+\346\316\252\335\330\256I`\0026\347\374\307,\362%\344m\300#\306O]\037#\354aO\357\260]\216'\333\244\021B\266L2\263"
+	.string	"\244"
+	.string	"\276"
+	.string	"\334\265\371\b\b\250\021\213:\022\263{k$\335\\\2439\026\204\231\2372s\177\235\211}\023\030<"
+	.string	"n\020\354G\020z\223\277\3207\363\225\334\313\236\270\304\270{\257\320\252\334\373\245\200\201\320\233\273\0138o\226\017p\336d\313|\344\211q\177Al3\204O\326\334{{\325\307\355\323\034\016\275\235fY\333\362\177\274\314\234\236~O\305r%[\030\356"
+	.ascii	"z\023\272\225\273/6\244\312\335\2757}\022\366\t\304t\2415\244"
+	.ascii	"<\330\3210l9\316\\AU\275R\005cL5\345\236\200'\016\n\253\370+"
+	.ascii	"\033U\267\276\t\335{\271\235\236\240\3168gf.\314\\\201\371D\023"
+	.ascii	"e:[c\374+:/*\374*9\\B\256\225\030_\n\037\321/\2357\177\253\313"
+	.ascii	"F%\204\371P\230\371\b!\355\354\336\337w\264\323\345\335\334\251"
+	.ascii	"\004\322\270\256T\267\261\256_w=\365\365`\377A\222F\330\306\324"
+	.ascii	"I~\362K\347N\355\251\334B)`'Y\327\374\344Lv2\033\231\370\221"
+	.ascii	"\312\030\254?N\233\031\305Q\337\211y\307)#\260\376\230\277~]"
+	.ascii	"\263\230_\336\212\305\2146\367\274\311\317s\342\277S6\353\224"
+	.ascii	"\315\272\332\234S\233q\316\346\364\326\234\253\315\270\263\031"
+	.ascii	"=\233of\363Y6\233esY6\327\262\003H\"\023\016\255\270\3722\302"
+	.ascii	"\266{{\344\274U\264\362\274i\332\001\354d\327\323\330!\0034\024"
+	.ascii	"\f\334\352\313\206f]D\246N\366\024\241\260n5\213Y\234gM\002\033"
+	.ascii	"\023l6^_\263K|&\374Ha\347\254\247\032\226!\247\234w\314r\232"
+	.ascii	"\026Nf\b\350\302\307`0\353\223\f\311\260\234w\274b\226\031.&"
+	.ascii	"\255D\016\350\252\341`\206\2028\374K\207Z?6\244\322ev\336qX\016"
+	.ascii	"\350\256\314\036>,\260\n2\210\243\r\365\324\230C\334\213\b\364"
+	.ascii	"\336`\203.\033\210|"
+	.string	"\324\356\275\347\202q\336\354z\342P\n\222\030\345?\0261\376\372\r\027\241\260\302j\315b\336\302\017+\236\361\263\024\320A\306\017l\302\227bW\302\267#\201d!%R\"\"Q*!\031\26502\271\b\350\205o\004\212\"\242\024#zH'\210\216zEI+z@\006\330\247\302(\251\247\344\363%\365\322\257\373\212\205[3bd\252@[\343\b\354\337Z#b\004\026\317B5\231L\"S]'8\016\007}'M\303F\025P\273\267\351N\366\006\332\364\340\307\342\260S\305\265\033\306k9o-*\247S\3252\204::\253\243\203C\r\264,\217\006\332\036>\272\372\263!Z\227\225\363\216mp@\235\223e}l\365\265@$\250%\177\324r\352\325\f\273t\341\244\025\307M\233\224\013\022\345u\2562\333 v\b\004\"_c\215D\320b\363\321\312\325\233\031\232\005\200\216\250AT\343\234BF2\222\222\202J\032\003"
+	.string	"\003\021!\022=\021\3000\b!!\231!\205)L\007 \314\237\273\274L\243\b\224]\226\235bZ\2546\\l-\013\025a\363\245\n\tc+\004\302\021\3307\024\360\334\303fY\270L\230Tr\245\216\207\220\271\"\317[6\201\f\215\205n,\253\302)\313\300\b\251\266D>D8\2068:\330x,\321\335\271\322Yn\327\362;\002\362\204\271j\246}\261\320\361\021\271\024\340\227-\020E\347Qb0Qv\370N\363wR\001eY\235\214\330\331\n0\304\017Qz\241\3130\r\021o\350\206\367\270\3173\"\352Vq\317\347\n\020l\326\250\256\247\233\272\316H\250f\245U\262\216\360\034"
+	.ascii	"9E\371!\207\355R/e=\233K[9K\255\316\311\340\235\364(J\224\330"
+	.ascii	"\233\206\371\032\230O-\371a\032\022\213q\214f\321\324\334\334"
+	.ascii	"9\201<~\023\316\250\223I\365U\\\341\316\374\302\b\250\006"
+	.text
+	.section	.gnu.lto_blackboxLogEvent.179.886e5061ff6073b3,"e",@progbits
+	.string	"(\265/\375`\315"
+	.string	"\315\013"
+	.string	"&VP@ q\223\016"
+	.string	"w\327\302\325\310\0048\"\006[\005!1:\340\351\240\203\202fz\004\305\224SM\r!\013/4\214N\246$\246\226\007\004,jCe0\020&\021\225\024o\313/[\344\223\275\245L)="
+	.string	"@"
+	.string	";"
+	.string	"\207\306l\034\347F\366\202\242m \351\330\335JM\034\373\323\304\374\312\026\362G}\270>\003%\021\244"
+	.string	"[\366\024\2608i\361\356)\262\2152=4\273\353\324\266\0167\274m\007\266\033\330\177\020\232>u\340\304\r\017\207ac\227CL\331\023H#\205\355[l'\367\027\330M0\\\006\354\250\023a@\035\232\243\236\366I\356\002{I\006\003\330\035!c\306.\267\300\031\3520\301\013L\207\357\004\246\233\256\306(wX@\2141\3071\3235\365\032Bd'\275T\301G\341\017\220\274\0062\035^\337\375\255 )\241\200\020e\264\271,\265\204}\2151F+\t\373&\377\364\222\037\276t\006V\310\202\360B\237\216\205\0164's\341\332H\340X\0236\325'\202\345\2518\240\217*\203\300\027\205\016\250\n]\027\250\262p\242kD\232\275\335\335W\311I\241\332\236+\257\031j\310c\250H\031\321c\246\324\025"
+	.string	"`\251'3\240\316p\347\205\315*\b\270\222\250\266@J\213"
+	.ascii	"$L8ICa\230\320\3205\240\030F\003\34175\005\356\005SS\304]n\252"
+	.ascii	"=\032\230\332\003"
+	.text
+	.section	.gnu.lto_blackboxCheckAndLogArmingBeep.180.886e5061ff6073b3,"e",@progbits
+	.string	"(\265/\375`\317\001%\021"
+	.string	"\026`rG\340\322&\035(I|s\372\306\240\2608\030\252TU\031#\255\227X\314\035\316\232\227\331\231\223\362h\n\372U\216x\317#\177K\350\002\216\3066 \216a\206\365\350x\f\346X\017\"]1\254\002}\006\017-\331[\312\224\002^"
+	.string	"X"
+	.string	"`"
+	.string	"$\332\245=co\227\337\274\262y\020\270\2314\ff)r\206\222\346\234\334\226\370\352\232\214\253+\377\255\203x\037\315\265"
+	.string	"\037\210\313\017\217\261"
+	.string	"\021\317\220\310g\023\023\240\210\265\016\336\350\306\223\032\261\034\221\017'\232\364\360\314\336\272n\370X\252&\bsN\253\367\351\334\246\333^\261\355\300\326\003\001z\357\373\0262\0371\326\322\330/\226\256\217\3758\267\307^uHTo\253\336U\353\252?b"
+	.string	"h\207\207\277\2701'\207pi\306$\215\023\177\375\366}\025\007g.\344\005.\243\355.\037\366\025\017Z\375%\363\2513\357\375\314\202\216\346\354\240\340\322)"
+	.ascii	".O^\242]\306\007#a\030\3668\212\266m\310\036G\004KC\3731.#\245"
+	.ascii	"RQ\321.\267=\370\b\344\"\232\355x\3450\226\022\023s\316\006\""
+	.ascii	"90\212<\331\256\2138\344\311v\017\373\200\031\262\037W\032\021"
+	.ascii	"\262\330\365\261\356\027\005\352\260Q%\373D/b\361\177\334\322"
+	.ascii	"I\277\323.u\021\344\330\251\321\320&\265a.\004\247\230S\204\030"
+	.ascii	"\027\025\006\025\210S)\031:\024K\352T\001\305\271\254\234Z\270"
+	.ascii	"\324\013\f\227b\342\316\202\352\205\213\351\272\027n{\325<\316"
+	.ascii	"\355i\375\032\220B\304j\226\245\311\3049I<\370\353\207]\300\221"
+	.ascii	"\220\206\222D/t\230\004\315\3452J\362\374\t\232\017R8\351=K\343"
+	.ascii	"@Z\372\211\353\343\037E\013Y\024h## 0\002c\030K;\340\352\211"
+	.ascii	"\241\255\003\226?\320H{\223\265\255\002/mI\260\023*\211\224\243"
+	.ascii	"\233L\324\206\261\355\303\271^\023\304g\rK<s\304\372\234i\212"
+	.ascii	"C1\336\030\210y\242A\024[#\366D0\276\370lX\001\346\340\323\030"
+	.ascii	"\260#\221\310\342\373\354\224\235\f\324\036"
+	.text
+	.section	.gnu.lto_blackboxCheckAndLogFlightMode.181.886e5061ff6073b3,"e",@progbits
+	.string	"(\265/\375`K\002\235\023"
+	.string	"\026\243}I\260\324Q:8E\211\002\025A*\033bK\"\276Y\023\372Vk\301\360\316\346\337\317\356\307`\327\030\312:\tm{+\3203\232\354\313\265\177\353\206/I>\360\277\270\217{\357fB\200\205}\034Q\001/ \212\036{\357\275S\ne"
+	.string	"`"
+	.string	"n"
+	.string	" XN\335Rr\352\333Q\352i\311\007\324S\033\307\376N\3779f;\025\320YY\002^\r\016HDv\027\224B\217\275\322)c\314'y1\251\331d\257)\033\211\323\021\2373%\351\007\351\304\2263\021\254\330\031]\247\023\345\211mg\036\330\335\033=\362\330h1\222\274\354\256c\315\326s\223\334v\214\355\005v\374\t;{\315O\372\213\030\237\350\3242/\352\277*\fC|\355\3621\242R\354v\244\314\276\321\242\f\262?W\002\3313\372\253\321)\032]gt\224\321?Qa\341!\304\225z\273\037zFvG\227P\374\366\333\367[\\\207\363\234]\302\247\242\335\375\036\372\270\037\335E\354\267\233o\317\276G\005\257\tj7\022&\300D\230z\232\222a\022\223\016\233\343\\v\t\235xU\346h\271\b"
+	.string	"\370\341\263t\03469\231\0278\264;\243PO\253\254B4|\360\224\210\322\256p\034\013ehw\025\274&\304\006\313'\212\362\270\317\"a\020\236\317,\366\342\356\312\244\f2\313/W: 9\261\210\003\304y\357\250\017\257\344\222\361\031\254\226\313UO\037\036\306\253d\003\252\032U\203\232\231\226\206\226\211Y-\033`+\031\226\312\302\n\234\211Q\275@\026M\006\260\305\200a\027Z4`\r\fF\003~\267\331\347J \243\277C\324\215\335L\322\352\315\334=\301"
+	.ascii	"w\001P9\232\022\237;\316A=\n\237\212j*\177P}\035\204\b\3615S"
+	.ascii	")s\017\237#\"\246\f\372J\375\344J\307\243\327\353\r\371JM\311"
+	.ascii	"O~\307\004\215\351M\0013 P\0021(!=\240\352\tB[\007,c`\360{Iv"
+	.ascii	"Y\347\252`6\"\233\266\224\005\344/\3422'\206{\225\264\263\352"
+	.ascii	"\032\351\3002\";\300\206u\202\220\203\210\037\3022\206\003\022"
+	.ascii	"\007`\262\354\003_tR$v$@t\320&\220\002\374\343@;N\262\003w\226"
+	.ascii	"N`\272<6X\023-b\261\267\203v\343\265a'\300\203\253\306\004\035"
+	.ascii	"\031aa{v\253\3150\267\265J\017"
+	.text
+	.section	.gnu.lto_blackboxAdvanceIterationTimers.185.886e5061ff6073b3,"e",@progbits
+	.string	"(\265/\375`\001\002\275\017"
+	.string	"\246\032_D"
+	.string	"\257(\035\003\274\3731\325\001\220H\205\261\023\307ICd\270P\f\250I\374\315O\307\2031a\020\035\375/\377\376(\204L\246\251o^\f\234v\335\2459D\201\300,@\203\343@\270B#\244\035{o)S\nK"
+	.string	"A"
+	.string	"P"
+	.ascii	"\257]\f\257\031\033\003Y:\330\276\346\222-\023\240\302\232\f"
+	.ascii	"\310(I\251\300\330\335M7\274t\3704K\276\206\007\246Z\231\016"
+	.ascii	"7$\177\331\212\344\n`5\362\006\354\356?</\254P\231\032\036\273"
+	.ascii	"\353T\2552\334\361\266\021\330&`')\327\324[(A\275;\b\020\237"
+	.ascii	"\203CD\362\252C_$\036^\263\256\305\003\353\224/\033\305\224\332"
+	.ascii	"\262\377VMlMs4\255=\235\2754\366\364F\323Q\3230\323/\323\372"
+	.ascii	"t>\375\r\016\231\023\032\356\n\273&\325\2263\335\250'e\305H\306"
+	.ascii	"0\246\231>UsB\361\024\r:\237O<\304\224\203\005k\243_I\325D]\271"
+	.ascii	"\n(B\215$^\002\344 \024\212\207P\013t.4OG\210\242\352K\271\b"
+	.ascii	"\321\007\307\305C\325\003-.Vj\210\253Z\374 1\376t\2208\217\350"
+	.ascii	"\323y\340\331 \204:\037\333g\024\262u\b0\027\0014\332$p\334h"
+	.ascii	"\323P\366o\325\304\330\013\0271'E=\270\221v\002\005y\225UM\373"
+	.ascii	"\264\245\342\256\005\024:\230\223\031\216\302\230\270\246\034"
+	.ascii	"\027\006\232\222\272\027\032\026(\262L\350^Nfr\0038 \320\002"
+	.ascii	"\0319\333\006\240\25079t\252\214a\024\366\256\306\202k?B\224"
+	.ascii	"@h\270\261\232(\0245\253!-\247\313,\201\034}\232b\334\227\r\217"
+	.ascii	"\2158X\300d\345\357fS\004q_\226\305\031\346s\247<\006\026\260"
+	.ascii	"\005o\310\263\031\026;N\324\324\310b\305\265H\r\310\030n\242"
+	.ascii	"\243n\261\225)\260\243\033eaK,\023\r\005\205\270\030,\220I\003"
+	.ascii	"6&\017?\275\265\253\f"
+	.text
+	.section	.gnu.lto_blackboxLogIteration.186.886e5061ff6073b3,"e",@progbits
+	.string	"(\265/\375`\t\n\3253"
+	.ascii	"\272V`\023@@\242N\007j\325bhLeFa\210\375\034\264\037\370\255"
+	.ascii	"y\326\311jd\033\006\313\311!\344\214\036WbYa\210\t\2039!5\025"
+	.ascii	"?\253\372,\231("
+	.string	"\264X\337N\347~\265\266\335\310\336{\313\224R!\001\020\001(\001>\327A\342<p@\354\374N\210\317u\016D{R\021\322\355g\234\256\333m\">\327\255\222\260\355\031\347k7\221n\327\327\354e\\\332\256\231\"*l'BqM\333\210h\221&\255(\354\345.\363\020\343\020a8\n\301\327\336`\364\357\3668\217_\227;\322G\030.\263\303\006\206\243\022\372\311\350k\223\007`}U=\211\365\265\337\356@\002[0\226\005\305xy\006\021\206\341d>\363\327\223\220\216\214\212\210\206\204\\\344\321\330\262\253\232\377mGzayR\373\001)\213\037\2715\323\336(\013\002\267&\332\027!(\373\"s\"\276&\231[\363\371Chc/\304\236\351E\343\022\313\276\324\334\245\202T\231\314\310\022\235\2579Em\262\263\267<\2725\305\336\250\006\350\322\302t\276\246\024\365\001\2406\206\356\326t~\253>x\346=q\275\226j"
+	.string	"<W\374\270\324\021\3605\325\236\r\363\325\365\342zu\353N\3533\221\327Rm\202a\330\245\376K\274\224\377\355\007\030\206\373\231^_\336"
+	.ascii	"\274\333mt\267\211\356c\212\312\300>i\236\212\245\314\301\217"
+	.ascii	"\216\323\361:P,\242\242X_\225\026H\003\341\236\2613\243\t\002"
+	.ascii	"\204\327fh\377\n\301\375\316\221]\022\375,\361\324\b\236\314"
+	.ascii	"K xr\215\315\320(\f\303k6\353\027\354\223\337\265\013\227\363"
+	.ascii	"\302\b\303Z\027\332\341x\234\030\355k\276\266\214\0313X_\237"
+	.ascii	"\362\20649\030\206a5C\331x\201\374_\244\200n\244\nd\277s\007"
+	.ascii	"J\2776\317=\305:e\347s\260L\240>>Z/\250\333\3278\336T\373ZS\335"
+	.ascii	"xg\336`}u\312\236\306\031\364\371\345y\306\316\254\237vG\225"
+	.ascii	"\237\241\335\236\247\323\351\264\263Y\267\373=\301\370\235t\277"
+	.ascii	"\237\\\316\275\201\373\355\344Q\357%7\343\255\344~\027h\277\221"
+	.ascii	"\220\337G\355\267\321\361\273\350\370M\324~\017\265\337B\354"
+	.ascii	"\267\313~#\333\357\243\361\333\330~\267\3557\333~\257\355\267"
+	.ascii	"\332~\347\366\373\331o\247\320\001O\3317\247(\227\375\242p\327"
+	.ascii	"t\021\336[\335l\361\250\273\231v4\236\006H\023\262\3239\2032"
+	.ascii	"s\213\317X\256(C\231xX\274\210H\270*y\325`\304\213I\226Egw\352"
+	.ascii	"\022\214!\343\206\310\367\034\231\255\244\277\205\314\032\342"
+	.ascii	"\303D\347g\275j+\342\303\307z\230\350L\357\260\351\f\247\320"
+	.ascii	"!A0R\300W\215\355~\323|\320\253\246!6\274\320\335;|\361e\363"
+	.ascii	"\301\270\020\016\206\341\f\202\\\361\335\362ry\337\274\260\276"
+	.ascii	"\302\210\r\341\b\367\270R>f&?\2759K"
+	.string	"\247\262\001\003\365\304\b\0313\"\2307.t\3037\314\2307~c\326Wcv\301\002\027\237\261\363\212\035D\022\013\302\021\266\031\2203\007\335\241X6\267\331\271\236\312?/\0316\033\211\003\023\237\f\223\257(n\353P\354\252\346\245\274\346\377\343z\334\347\234\017 \b5\177\342\241\227*o^\n\221\031\332\036\034\212\315\331\206T\357\263R\316\371\325p\265)\177\332\007\376\275\343\260>\347y\242\2140\234\345\314>\022&\336\231\237\237\316\341\333\336V\306z;\260\274\304\343\025\3539\204\236\337\271:\201\002\005\353\253g\001\200\376T\362\354\n\215N9\0075\244\250p\2505\244\250J\b\251\332qe\274\212\242\342\221\243\305\217\036TVV@\246\206z\352iH\025\r\035SR;h${\344\220\342\221\234\262\272J>1u\225\017*\253\344\217\252*\253\244\033\315r\025\376\220\225\225j\022R\227\250\001o,\\\245\214\224\225\352"
+	.string	"\005\271\236\035\276A>\332z\227M\277E\307\3771\273_%\257\345]\322J\t\375\\\360\225m\355(\373\031\340\035f\230Q\356~\233|\026\250\374\206\360/\r\r\013T\227Q\266\222S\023\306\231\205T\224\315\256\224\275\033`\211rQ\316j\226O\310^\265\025\2140\356\031\367|\331\212\300\004\321\236qcy\205\\]\242\034\206\227\340C\331\347^,\312"
+	.string	"\332OQ\361\202\275P\336\231]\241\nW\306j\017\364\245<\224\231\352\376\016\271\236\312\017\373(\257X\224W\212\024\266m\374\223WL\301_\377\327\203\275cd\257\025+\254\257\030\322\372\370R\026\312\002\374\376\004\227N\345\200\261:~Gn\316\203R>O\337\375B\337\263w\246\233}ZE\231\261\362\333\363\317(C\347\370\0046\262+X\201\372"
+	.string	"\351\332\305w\275\223\200\317\250\221,\345\fc\210HDF\n\222$\255\001\220\002\221\241\252\252\003\0210\261d\020\221&\205\264\033\340\367b \f_q\325\035`,\2730?\201\260.\211\200\356/X\231\fi\202\371\375\033I\026;\022W\201J\306\243\"\004\316\007,\355%\2254\202nW\302u\336\3763,e)\t\236\326N\316\352\024Y#\2270'\244D\255\214\330\340\244\211\240\"D`+U\206\371F\3331\256!\334\215S=\004\1777\345\372\0173\332\216c}\365\306\245aB,;.\006MP&W\202\322\340k\345\311o\0244\013h\242T\277\313\247\301\002P\007Th>y\271\346v\324\f\321\254\2301;\272\212gk<\230\217\037\223\220E\375[\304\252'\201\0165<\213wd"
+	.string	"\335+\371\0303,\031\361\334\f\302ul/\302\327e\\_\023yp\246\341\362\r\254\"\220\273i\255\360$\344\354\034\275\326<#\211H\205P\376Q\205e\200\245\001\007T\235\276\205\234m\355\351\317\316\313\350]4a\237\346\267:0\335\252#\f \001oj\315\332\be\261\276J#\\\2303Jh?\371\371,-sB\354\202\360\340a\036\300R\271V\t"
+	.string	"=\007\t\264\034wZ\257\343S\374\027\216T"
+	.string	"\3345=hJ\304\004{\364\030\230\017D\013\273X\315"
+	.ascii	"@\024\037NP-P\rT;\315\377\233^\273\361<kK\373\346~\323\373\360"
+	.ascii	"\361\r\225\262\234\021\314\303\306[\005h=Gk\363\031\302\325T"
+	.ascii	"\0330Q\271Y\030f\267\333\350\247\006"
+	.text
+	.section	.gnu.lto_blackboxEncodeSnapshot.187.886e5061ff6073b3,"e",@progbits
+	.string	"(\265/\375`\353\005\025#"
+	.string	"\226>\331E\200\236M:S\347\231\333U\0202\"\317\312\223T"
+	.string	"\265\030T\203\3127\022[a\325\207\340\230\020c\315\256a(\236\321\274\034k5\025\305\204\214l\007W|\365\246bo\357\353\201\254\373\023m\265a\304nB\244L2\306"
+	.string	"\267"
+	.string	"\311"
+	.string	"9n\347\253\326\252\342\237\nFz9y\227\357\236\270\357\352B\343\025\253\036\013\f\020\223\261Z\255\026\234\334\b\345\311\333v\367\274{-\337b\376\254q\242Z\217\0042S+\261\301*\225'\227\370\"z\262<"
+	.string	"zr\315\335<\002\244\352o\tP\022*0~j\255\272Fr\363\270\233-\250V\322(96\233\373\232\360\352w\334\3156*\320b\243\343aV@\306\"8F\356<\212\325\017\016\242Y\340\362\003E\260\202\274v\240\bV\326\313\254(VC\246\205Y\371\030\r\324Z\251\230\36289%\305\243\216\367\250`\354L\237\334U\324XT\325Dx.\347\033WAf\232\205Z\353\262\360\n\353\233\373\356\206\355\356\204]\222\030fd`R\375\333\356\335\022r\204z\200'N\346iIlQ|L\323\027\017\274\004\\\335\367:\331\\\341\336uz\327NH\254\326\n\241\361\b\365"
+	.string	"U\\\314\023\367\273Nj\235_e\3472\0333\323kD\217\372\\^\206y\261\023\305f;\336\210\276\217z\231j\030\334\026\007\003U\326\032\005a\377\305\003\257\\rr_\203\236|\2239\310\226hm9\201\\\334%\376\270\267v?\326>\262\333\274I\315\213\324\274G?\377"
+	.string	"\315K4\362\016\215\274B#o\216\306\213\033yo\315k\243\274A#om\344-I^\332\310KG^\262y\307\221\267G^n\336#\370\231W\025\216Ic\266\376p\316\271\222\307t\222$v\207\205\t\205\305\366>z\222@\035\006\267\343+\367b\257cJ1\247\230UnV\241'\203\232\304)\247\314\213\036q\203\327\372\304\317a2\342\252\025x\241\234\335\256\231\305\3342\325\277\375w\264\354Z\017 \233\322\202S6\2058YC\003L\353\335\013\030\036\f\211\352\337\356\335\310 \260\273\275\267\311\260$a\315\331h\330\r\0348\320\223\264n0B\036\264\357(\331\264O5\f\376\353jv\373%\333\201\211/d\242'\311\246T\3167eC\262\267\302\034\211oD\307FJ\0035\216^\247\233\262\221\306Xk\221\nc]\\\334"
+	.ascii	"|/\357\002\361/\256Z\353\205\271\207\240\273\"F\360\205{1\001"
+	.ascii	";(\031\276]\217\306"
+	.string	"\340\255\360\301hz\341+\327Ii\006/E\013\247&\027)t/\236\232\240tN=\237N\251\300\362`\354z\272\030<^Og#\326\217\357#\26534`\300\016\342\252\316\316[\004\3365s\230;X\314Y\026\260\340~IU=\261\365\240Dm\343E\256f\217,\363\307\017z\222\250\217u\346\2712\004r1\310\001\337z\327\024b\022\271\225Y\363\244l,\252\177\265\336\272i\204\356\315~f\032\3312\221 \361q\336\261\302\247\334\321\241\356y\251\023\305f\273\305\357\250P\0175\005D5\314\365\255\205\372SX\202\\\\\\\347\372T\201\200d\357c&1\225\230L\230\320\223\270NJ2\334\363tk\023'\235\262\223k\255?Z\322oDm\035p\250q \344\220s\n\315\210\210\210$M\322\001\200\002\021\251\262;\021P-T\254L\233r\003 \206f\262]\002Q\3012ocX\214<\230\270\263\344a\035\034\260"
+	.string	"\3270J7\364Q\312\254\244h\215\305\231\221\322\033\277\001\002\257\326m\311\007+\005\034]7~\230\236\376*\215u\360\350\227\351\351\205\312\0379\201\232\317\327\024.\305\205\364\262Z\371Uu\367\354\220J\324X'2b\371\220D\346\322Z\nz\021 \276iU="
+	.ascii	"\372s\363`%\030\023(\260m\n d\353\267\3777\253^\256\375\003\""
+	.ascii	"\257\355\216\220kwH\220\340\273\364{W3\n\314\322mW\242?\263P"
+	.ascii	"\362A\252\222a'm\246\033\276c\n\272\344T\255\004\215\200\241"
+	.ascii	"R\356OL\326\336\350\300N\3502\026\346\003\23495\233\376\323\260"
+	.ascii	"S\334\034\003\023\315Z:\324\247\375c\271\2676\256$4\260\203)"
+	.ascii	"\306\035O\331\227\032"
+	.text
+	.section	.gnu.lto_blackboxWriteQueuedEvents.188.886e5061ff6073b3,"e",@progbits
+	.string	"(\265/\375`\373\0025\027"
+	.string	"&k\231K\240\226U:\327\027\005\370\241\235W\367\006q\307\0239\2613n\241\364\320\304\266\257\205\034\372$\312\271\034\037KH\335\274w}>\354n\247mw-\032'\270m\2140\343\346\320\333i4S\202\257\245\277\340\315\202\333G%d\023\271\223\f\201"
+	.string	"|"
+	.string	"\211"
+	.ascii	"&hRn\371\225\3715\316t;jc\225{Y\020u\334\373\213a\231\224\333"
+	.ascii	"\003\017P\336\222\007P\336\362\215\2718\240\347\342\026P1\361"
+	.ascii	"i:\336{]\215\304,i\232\246'\177g[o/-\331\365\306Op\034\366|\270"
+	.ascii	"\227-\037/\370\372\343\323UK\203\350$Y\303\244\364\342\302W "
+	.ascii	"\337\216l\340\023\220\225\217W\373\301?@b|\352\371\210^\315\006"
+	.ascii	"\367^\256=\237\320\331<3\3770s\004\346.\020\357\013\237\"\205"
+	.ascii	"\3048\364)\322\265\324\022\240\215f\276\323\237l\374$\376@\253"
+	.ascii	"\357\321\312\333\225\256A\247\226\212r5e\376\341j\0371\177\306"
+	.ascii	"\210\020\030\334F\314\255\377~\326\321\177\265r\340\331\264\225"
+	.ascii	"K\262\262\355\312d\255\334\265r\255\225\337\342b$i\350E\343\275"
+	.ascii	"Ai\224\033ey\3108\360\314\0272\257\376 \257\230\031h\373\025"
+	.ascii	"\272'q\244*:\271\367\367r\313\016\370g#[\356\256E,\240\332.\233"
+	.ascii	"\231\202\205\372\036+X\321\3238f\276\360 \030`\210@\316\237\370"
+	.ascii	"\341\243l\230$h\356=B\260\210\367\356\336c\316p\036\032\030\020"
+	.ascii	"7|\307y'h\325\361V\307\320v\211d4\366P\344\240R\030\005!\373"
+	.ascii	"\210_N\366,HdW\237p7\331o\342S\305\352\332\335\366\bo\206\216"
+	.ascii	"_\317\001\343A\251\224\356\335\3150\363\210\343\350P\n\241Qh"
+	.ascii	"l\374F\214\237t\31379\262\362\2666\017J\265\204\232\267\225f"
+	.ascii	"\0078\261\263F\342\304\316\n5\231\007\332\316\251Ccq8a\020j:"
+	.ascii	"0\0200\025~\311\210\220\331\334\274N\034\033\227N\354\314q\275"
+	.ascii	"f4\227\214\013\313v`3WM&\233\271V\277\3736\342\340_\242j(*\327"
+	.ascii	"\272\030e\037\361\205?\320\260H\221l5K\320\220b]i\263y\325f?"
+	.ascii	"x\004CSRA%\273\372\204\274\367^K\240\306\274\325o:\021\232\001"
+	.ascii	"\027\367\346\234>\304\306\022&\034\nJ\032\305k\034\277\325&\222"
+	.ascii	"q\212\247BW\3235 `\002\231*,\017`\352\205\003\277\217\330\223"
+	.ascii	"\206Z\220~t\233\005 \020\005\017\264-\223\330\002$u0\031B\022"
+	.ascii	"]*\327\262\322\345\013a\033\005\242\204Y\302K\375\325.H\350p"
+	.ascii	"V\370\345\236\211\211\227\030\241rL\034\017<\266\020\335!\235"
+	.ascii	"\276b\033h\022\2321\300\370fW]\345w\016\302n\337\230km\304\236"
+	.ascii	"\205\353>\362\002bY\332e\234@\265!h<R\214\306\340\332\3200]\235"
+	.ascii	"\f"
+	.text
+	.section	.gnu.lto_blackboxEncodeSnapshots.189.886e5061ff6073b3,"e",@progbits
+	.string	"(\265/\375`}\002E\024"
+	.string	"\346$\204I\260PR:\341\347\351F\235\230o*\271\016!\236l\346\346\004P3\266\340\024\177N9\276\313kFt\374H\241\376\006\206y\340)\312\350\232\217\373\031\312~6Tm\017\005\251\217Dv\275\340\303\327!x\211M\267\215l\271S\nl"
+	.string	"h"
+	.string	"s"
+	.ascii	"\257:\365\"\262\312\236\253Z\177\b.\272\244\343\"\201\207\270"
+	.ascii	".\322\007p]t\316\316!\262\253\272\223\222\304\215RV\255U\266"
+	.ascii	"@\006)\313\262<\375\335t\346.\322\2359\337\200\360\211\354\351"
+	.ascii	".\322\327\216\247\342\243\267\243(\302+\250\003?qz4\223\262\340"
+	.ascii	"\371\036x\bSZ8\310\036\317\347\253A\255\325\223\354\351\334\256"
+	.ascii	"\333\276\331v`\317\241\177\361%\234\037t\3215\333<y\321\267\305"
+	.ascii	"t\230'_\2734\206&\202\273\325\331?\335\334\037\373(>\341\225"
+	.ascii	"\327\307\216\301\376\273\307#\335\257\027\335K\247\347N\037\300"
+	.ascii	"HU\320\316\263\254j\345\225[5(B"
+	.string	"\255x\321\377\373\221\276\366o\364\243\003\355\201$C+\323\2032Gh\301Of\204P\3113\351\270\350\017\235(\367\"\\V6'B\346\\\233B\005\223\0245\253\263/\343C\001\037i;\304\245,$\240\252\265\242D=\306\005\f\263\231\353\342\\\252D\226`p\234k\367;`Jk\352\246\207f\226\2734c\327[\177L\330\216k\3232\314\223>0l\361d\026\330*0rr\32133K\217\363M\177\322a\330N|N-\343\322\243!\212q\316[\312\365\2443\331H\250j\2359\351+3\232\006\2722\243E\270\275\320<\320F\027\226\331\215Z\245\004D-\245Ee\346\222\"{a\231m\220\251\300\304\310JF\\\343@\203\221\335j5\030\231\307\257~}<\016\243\2023K#\356\217?\236\260nllAxX9\023\266\2738\266\375\332]qg\313\nXU3\205\264\326Zi\314Hd\222<\266O\272\r\233"
+	.ascii	"_\r\234\204\t\263iH\024\264Y\235\037\333\027\220V3 \200\002\031"
+	.ascii	"\2523\017\340\353I\007^\037a\262\306\266\326\373\026\363I\223"
+	.ascii	"##\257h\333'\231by\213\336#P\241\r\005\355\2749\371\362\232m"
+	.ascii	"r$\253\254\213\200\261\320\211Z\333\302\271\213[+*\213\021\f"
+	.ascii	"%\264\252\207\240H\363\2666T%A\257Dw\263\373R\361\020'\rH\310"
+	.ascii	"\345\304\346\312\256\022[\2202\021\031\312\231/\221E\276\230"
+	.ascii	"r\327\201\0211]\375\t"
+	.text
+	.section	.gnu.lto_blackboxLogCapturedFrames.190.886e5061ff6073b3,"e",@progbits
+	.string	"(\265/\375`\t\005\305\034"
+	.string	"\346p\256H\240\330M:\301\007=\257\267\372\203m{\200\002\311d\257\330\324\346\017(\217\311\312\302\356?.m\276d\303nm\310\017\360hX\340\370z;\272\225[\311\223!>\324\006\346\036\036X\225\311c\0161vl\030\261d\023)\223\f\232"
+	.string	"\212"
+	.string	"\235"
+	.string	"\252_\325\017y\026\357\301\023Z\353\2661\326\244[\253G}\312O\236\337\310\317\361\002\310O\345\251n\031\200\242{\013\212WME\314\272\033\3079\316{\215\215\246V\322\3109\362\362\3644\240\232\023\260\367\232\0026)\232\361\366u\203\354`O1\306\0044\252\270\250\215<T\206M\007{\2021\356L\325 \363\036O2\266\244\001\331\200\222:-JH\246h\332\031"
+	.string	"\210b\253iG\033\220i\031\354Ij\344\351\356\013\277*\200\277]\032Pw\353:\001\241\256"
+	.ascii	"\256\252DU}\240:J\tS\257#?\227\017\020\243|[\374vw\217\225\004"
+	.ascii	"y&\342\312\302\264e4\300\276oD\252r8\332;\235\177\344\354\314"
+	.ascii	"\220\251\003\030\244\237\225\225\253\032Bi\357\244"
+	.string	"\b\316\256\f\177\334S\325\372-S\251~l\236R\345U\235\271\2323Wos\025\347\301\377f\256\332\314\325r\256\322\346*9W\347\270:\216\253\314\253\313\253\037\2603fE\213\227\341\322\315\242h\246\207\263k\207\236\310\267J\\K\035\b\257\230}\252\226P\265}\336\246\001\274$\024\303\n\336twI`oX5\202\204\"\324\004b\0218\374qO\313\272\233\246\303\027~\245jp\371\372\022f\205\202N\207_\305*\212d*\315\341\033\357\031\225\334\275\252\246\f]\311\230\224\034\276\227U\317\243x\335\370\307J\265\272{\342\260\r\023qA\311\365\214}K+\374\311\220\201\252\356f\340\344]\026.\b\t\221\2378\334CTp&\271\262\273\033\350\225|\311\220\376\352S3h\320@~\332\360\267n\240\005Y\020\032Y]\276-~d*#_\016\322#y\022\022\372+\335\240\013JBFHG\030\226>\030\355v\"\212"
+	.ascii	"h\221\317\210$\242\016E:\017D\270\017G:$\\\321N\t\347\263\243"
+	.ascii	"I \214v\270\245\244\244\035\316\246\345\373\330<\245\265\"\326"
+	.ascii	"\320\307\277\232\031C&\356\331\2440\343e+\231&&\f\230r\307\275"
+	.ascii	"t)\243\261\t!\026\254\340\206\225\261B\303TJ\362\344\343\340"
+	.ascii	"\332\222\373\251R\345\361\270\226\241\005d$\377X\371x\226\334"
+	.ascii	"N\225\362~\234\310\003B`"
+	.string	"l\262\t\241\030\231`\371\302\314W\033\231\371:\260\216Eld\0341\350\333\242\220\207\361\262J\375\327\301xB\bA{\247 \362\223\003p\250\2018\343\020t\310\222HA\222TZ\f\300\002\221\241\242n\020H\206j6I\033 \305YFO\021}\026\356\207\242\367\304\363S\001\207.\004\271\033\222\311i\323\267\234\211I\216\203Fz\260>\200\004\374^4\002\252\036\252H\2669\310v\241\321\345\017\346\276%dY?w\200\035\221\033W}nu\301\241\003\343~\307\217]\t\352\333\336\013\307\252~(2\221\334~\376\220P\036\222\020\300\277s\220\222\007A\273\252\377\035\\\321\234\245\200\"\320/`\3040\275X\346\310\317\332D\246\215\376\214\245\031\300.\2019\001\216:\230j)*\240\327\345a\267\326\335T\371\230q[\036\341F\031\024'\206~P\277\344O\253X6\003\243\177\313\230\361\252\321\261 \256y,\273\203V\331"
+	.ascii	"jK\352(\350\037"
+	.text
+	.section	.gnu.lto_blackboxCapture.191.886e5061ff6073b3,"e",@progbits
+	.string	"(\265/\375`\"\003u\026"
+	.string	"\006g\213J\300\360*\035\377'N\267L\317\361\020\274"
+	.string	"\373\266?\n:\237W\377\026\316m\377d\244\254\331A\327uQ\036A\374\377\177^\rg\032Y5\261s/\252\374!A\322\266\b>Mf@O\247D\212\356\030\322\f\2645B\210\334)\005x"
+	.string	"l"
+	.string	"u"
+	.string	"#\017)O\216\007)O\232f\023\037\304\251\003\316%\230\241\246ZkkE\234\366\225*\205*\311q)\3157\020\203#\247\253}\205r-\310\211)\002\026}3\273\253\b\244P\256\240\027\3701\001M\370fB\034\005CK\036"
+	.ascii	"\272\r\224\244!C3\216\324Z\017t\332A\367BG\272\373\342V\272["
+	.ascii	"\031\3623u\356\223\331-E\271j\255\2469\335\314\315\272m\240m"
+	.ascii	"\005\366\212\004\027~(\305\037a"
+	.string	"\025\026\372\334I\237\245<\371mp\356\360|hl\364\264\2037\2727\366\367<\317\242\327\306\376\317\317\032\251\311\221zGj\272\324\377`\340B\250\206\360\274\2616\202\365\303\271\243\016I$\022>\212\007\271<\350\205!\334\341\001k\255\254\223\266\213\315:y\226\355S\373\300\373\320\376\243\301\252Z}@G\265\006\021\230$u2\313\023\200\202\274\244\264_0\372\334\356s\364p[\273\315\237\251C\356\215[J\2723\241%\034\325a\377\350/Z*\304b\345I\272\t\212\206\212_q\001\272:\256(k\355\023\031}\316\343\326\374\242\1778\03551\325\250\323\177\346/iY\370-V*\016A`O\355\251\360\215LL\251\236\362\202zR\002\366<\205m\342(T\342\325\324Z;\217\346j\035\301\321';*\017`'1\007+(\260\331\214\345\345\341\027I\006\231\211\205W\311\005\223\026J\254\344\244\365\232\251\264HD,\303"
+	.string	"\233\265Vd\262Y\213\025\264}\254k\223\363\235\030\332\366\346\023\335\256q\025B\355\b\022\214|%\206\267\255\251&\034\350\367\200\244\033\026\231p[\003\3613uR{\343\313\200\260K*\326\330\350\031\203\230\302\2512\265\367\240\257\210\314^\021E\256\307O\022\005r?#\207\0360\177fy\244\357\006F\250\2214\203\024S\f\311\210L\242\244\005y\220\002\221\271\262\016\020P\250F\232\024\322\001\340\227b.\234\351\001@e\221\3134\004MN\303\243"
+	.ascii	"$\314Cm\024\255\231c\343\362\270\245\340\214&\001\312\bP`\020"
+	.ascii	"F\026\276<a9\247\302-\n\301\373\016\330;{@s\\\030\215!\364\374"
+	.ascii	"%p\340\032\342\232lc\247\203\321\311\271\305\256\303\224\227"
+	.ascii	"]\336\364@$\305\221\031[\233y\317lA\230JO\275\250\0327\304\320"
+	.ascii	"\237\340\344\373\345hL`Y\325n_L\002J\315Ps\356\224\273\024F\237"
+	.ascii	"\032"
+	.text
+	.section	.gnu.lto_blackboxGetDroppedFrameCount.192.886e5061ff6073b3,"e",@progbits
+	.string	"(\265/\375 \372\275\006"
+	.string	"\262\314.3`O\322\001\024\302p\364D\302C\004\035F\301\317\330\207\323U\370\320D\244\331m\027\177\2127\245\021 \37700\t\240b\333Vy}\021;Dd7)S\n\2368\025\315\3430u\036<,\242\241\003\301&j\202q\b\334$\030(F\321\032\3054q\257\242\324M\245\027\366S\036\235Ob\213O\376}\371\037\351+5\300\243\312\221\035C\251!\3663\253\"\333\351\324\202\021\226\216\277\225\335\215Q\314\276,\227\022\333 [\343\233\374\004d\267\200Q\301\003\b\222\241\002\263\033\331\346\003\322W\346\002\322\227\212\334=\235\177\224+h\274\226\007CO\200\204\335u>\310q\353m\033\330F\260\375\021\t"
+	.ascii	"`\251'3\340\2543\202\206P\\\023{#r\026\"\017w\305\324N2"
+	.text
+	.section	.gnu.lto_blackboxUpdate.193.886e5061ff6073b3,"e",@progbits
+	.string	"(\265/\375`"
+	.string	"\034\305e"
+	.string	"Z\232P\"P@L\352\031\003Gp"
+	.ascii	";\370hT\33547\252\n\nx\352\002\216\t\224\212$=\324a\215v\240"
+	.ascii	"\323\013\330\363X\224R\245\225\273\256}u\363\202z^\315K\246\252"
+	.ascii	"\031\2607\346\262\217'\037y\251\376\277`A\355\032\262')\273\245"
+	.ascii	"M\244\224)\245\024\022\002\356\001\026\002\3160C\347\227\242"
+	.ascii	"\263K\321\331Xt.\256\316D\242\363p\350\314\016\235\327\241\263"
+	.ascii	"\312:\377\352\354\252s7\371\215\264\027.\256z\312\355}_L\007"
+	.ascii	"_\350Z\004G\3475s7\271\221\344\361\263_\253\267Y\360UQ\371{\337"
+	.ascii	"\227C\257\374\201\210G\300[\224'\004o\203\202vC\216\324\255W"
+	.ascii	"D\240\312\2649\020F\216\310\311=Qr\305\021\340\204r\346\\\300"
+	.ascii	"\t(\350\246\032\241\242\344z\337WH\267}\320M~#w\03707\n\035\004"
+	.ascii	"\204n\362j\004\017P\231\366\276\257K\257\314 0\273\364\372\342"
+	.ascii	"\302\314\355\314\235\326L\267\325D\340\342\373~\251\321\275o"
+	.ascii	"\363\210\221\210\275\372\364\221\355U\355\032\266Wv\231\375\272"
+	.ascii	"I\366\346T\341\220j\023|\3377\351\307\232\2556\233\215\3566\322"
+	.ascii	"Q\007\243\rED\032\206\204\202\200~|zxvt2`\310\301\271\2619^\250"
+	.ascii	"\241\231\261 \023\003\363\342b,&\021\207\354\252\276\273\334"
+	.ascii	"\0367\207t\002W\345\324HGkJ\274\203Q\020$\276A=2\001\243b\244"
+	.ascii	"\324\273\312\363\"\"\325C\224 \327\213\026\251'mF5\347\032\216"
+	.ascii	"\244\340C\354Q\217=\312\261\307%/\264\244\203\226\3049\020\021"
+	.ascii	"8\377qk\025l\371\227&\365q\366\254\2759\217\031\225\232\357\300"
+	.ascii	"(\324\2413TB\240\306\f\2724i\006'\206\037\236\203\3468q78\334"
+	.ascii	"F\356h\202_\230\253)s\232\272\031;\0135\310\\\306\254\t\325\f"
+	.ascii	"\217"
+	.string	"\031*=\273\253`\326\272\374E\375 nx\037\230g5\332\214J\206\273\250\355\025\213nB\305\245\032\3404%\260\221l\271q\250D\303J\253\213\375\244\325I>fT{N\3741\243\312\362a\343u\320\362/\r\215]\341\353\317\227\225\263U\325\350\257n\205nB\345T\217/n${\255}\252\n\312\237\231\006\344\354\206\215\245R*\312X\205d\327\345\263\254\277\250\234/>Tz\337\227=Ye\325\f@3\177!3\027\300\214\203\026\311\341;\034\030\036\024\212\370b\314\276\372MlK\370I3\261\353\263\277fY\241Dz1\rI\231\341\242\tIQ\256?\304\247\306\352w\024\354\351\356\200\003\363\241B\367Z\033\213lyI\377\206/\306\315\255\347Z\rh\335I\271D|\017\317b\262\301c\327\207\307p\321z%\341\t\223W\200\234\033\317e\272k\336I\021\257\276E\253\270\231\330\306\343%\267b:\222\275\357\033"
+	.string	";\225W\035\300m\243WN"
+	.ascii	"\004\b\266\327V\306T\020\220C\263\267p\027!\024\020!\202\355"
+	.ascii	"5\004\031\3233\300'\366)?\"\331K\365z5^\033\207\254\321IY\025"
+	.ascii	"\354\177\323\21533@\302;\371\337Q\260\256v\322F`[\320\325\001"
+	.ascii	"\377\322R\343\314\021H\340\235\344\216~I\241\310w\212I*\365\324"
+	.ascii	"\027\343\035\326\346{\255\211W\330\242P\256\205\273wX\177\233"
+	.ascii	"g\227\312B\372\223#)\250\300\204\t\266W\177\016\336\224H\033"
+	.ascii	"\33241\274\004\377\234\234\320\350\271|\376\224\375u\231\346"
+	.ascii	"\030\344&4n\311!\345\326R\354[\201;\220\310%%\355\f\0137\340"
+	.ascii	"\020\006\363\217\333\n\253\005M;\353\343\366[apE\271\247\250"
+	.ascii	"\205Q\270\245<\222'\334P\274\275\234\252\344r\274^L\270\233\260"
+	.ascii	"\037\261\373DTq\212.\355\254\367\230\331O\275\013"
+	.string	"sj\245'\337\r\352\333\345\205\314\255\327JNp\333`\013Px'Q\260\275\366\217h{\242df=\371\224\271\211\364\027c\356\237N\247I\370\303\230Yg\022E\347\021Cg\021 Z\255\333C\3475\027\251\316D\252\263\006\325y\210u\026Z\235\203Xg \326\371\207u\366\031:\367\f\235y\206\316;\254\263N\3219\003\353\214\201u\316a\235qX\347\233\325\331\206u>\262\316\027X\347\032\326\231\306\350<3t\266`t\226\031:\307\f\003\377U\302\321{\265VX\256\031\337\205\327Vy\256\337j\255t\226SOk\030\243\r$\341\257\332\300\267z\030-\226,m`\240\333\361y\302\246$\251\322\343\302\337\267\330\372\2519v}|\362Y\314\361\322K\375\212\271\343\362\271\254\271\360\310\346vY\260\376N-\241\f\231\221\177\r +l\t\007\235\260\225\266[Z\302\226\220\355\225C\363\333\205\347\t\2132\370j\321"
+	.ascii	"BeG\223\006K`]\226:@,u\274\344V\376\352\272\311\242X\320\231"
+	.ascii	"\276>\273)vQ>;^\362(*\330Y\250\211*y\277\355:!\335(\357d\315"
+	.ascii	";\034\r\0312/\346,\232\346\203w\323\231@\335\026M\344\310\367"
+	.ascii	"\334\027,\327\022=\227\305\007\247\020Av\247<\211\333\202H\312"
+	.ascii	"\373B\005\300\035\034\211\373\242\263\234mg\275\346\261\003t"
+	.ascii	"\323\357\\,\0312#\376l!d\357\273\242\271\257\351E\\,\342\373"
+	.ascii	"\256\240\363:\267\n\206\213\205E\347\214\341\312\360N\322<OX"
+	.ascii	"\223\264Wk\3127\003\032\023\205Cr\267\374\215\237O\267!M\245"
+	.ascii	"\345&\b\3500\272\237\274\344B\230\216dl\255\226\033\n\3176\016"
+	.ascii	"\251\363\222\302\274\030\243\365\314\267\031\033\337\004\276"
+	.ascii	"\2466\363Ci@,\254?\336\006\321^^\254\213\225)\341gn\027\361}"
+	.ascii	"\241\006`?\301}\2703T\267\004\027\214u\301\330^e\376\003_\221"
+	.ascii	"'\036;b\276\333\370\324\236|\372N\214\230\340\303\345\305X\200"
+	.ascii	"\037E\020?\\&q\350\242\237b\260.zo\322P\266\376\244\2140\257"
+	.ascii	"\203\251\251\344\350fb_\036\346y\240,\271\tLD\033/\337Tj\250"
+	.ascii	"u\350\242\007\361\032\360\271\210\342\362\313N^q;\004k|\227\357"
+	.ascii	"1\343\267\331[ Z\326\221\027\237\331\035sk\370@\275\023\023\277"
+	.ascii	"\370\336'U(\363\304o$\rA\r\027U\244\n\237|\252\362\022\022\240"
+	.ascii	"y\305\027\343\356a\324\213\033I\037\346\226\261\303\357/6\276"
+	.ascii	"\r\316\315\346'\313\354\342pux\007(Z\005\211\023\031\240\030"
+	.ascii	"\301\201\006'\232\232:0\001\303&\220<HQ\342\002\023\025`P\"I"
+	.ascii	"\003\024\025d\220d\242IE\022R\017\247\330\340DS\022\007)R4%\271"
+	.ascii	"4\237Z}?\214\2237\230\320\247G\362G\233\225T$\270\0332f\276\366"
+	.ascii	"\222\034\021}\177\021\022}\bqm\322\367k+^\322\277\016[\256\226"
+	.ascii	"\201\202\200\035\244Ekg\231\222\242\030SiD\342K\260E\005I|\007"
+	.ascii	"\351 +<\036J\246\316\025\363l\203\206\350\n\032\n\213\200x\264"
+	.ascii	"\f\013\261\016G\037\321\020\226\241\357+\270A\264;\rB\337_L\241"
+	.ascii	"w\270\262\275\247\322^\206\004\312\317\345\263l\250\n\377\337"
+	.ascii	"N\214\344\367\261Ga\365\345\370)\314\354\027\202\310\021\017"
+	.ascii	"^P\336\256=\237\333\202\310\037\345\245\264(0[\333\326\306\366"
+	.ascii	"\032\364\305+\274\034J\246\320\213Ai\036p\200g\200\323\351t\032"
+	.ascii	"\004\344\304\255}\002\r]\335\r*\231YL\230\374^[\033\207<{:\235"
+	.ascii	"\022\002\375|\t\347\317\367Z\367\bE\362\240\322?\344\222f%''"
+	.ascii	"\334\362\303\344\365\332\255\207t<y(\231\\O>m\343\242\313\036"
+	.ascii	"F7\274(\037\237\217\371\341\363\303\035\336\363b\334\363;\377"
+	.ascii	"~\375\326L,\317\367\274N\333\343"
+	.string	"1\365\335\337\271h\375\224\362O\236\357\273\235\357\251\027\362\235\232G\347\001\3170\327\326y'u\036\303g\370\226*|\272\257Sa\327>\333'\333+\206'"
+	.ascii	"\216\210t\211\005E\026\266\321\330tG\313\b\367\360\314m^\233"
+	.ascii	"dL\n\205\332\322Fc\201P\035%\022\370\330\025(\262\335\033\333"
+	.ascii	"\023d\322e\030|\347\210wc\362m!Z'\"|\304\267\231V\n\322,6gS\372"
+	.ascii	"\207!\347\373\013J\316;\334X\035\024\231\203\323F\301\371\216"
+	.ascii	"\216\365\030\353\312\202F\207\263\302\253\305\361\322\247=\020"
+	.ascii	"\271G\213k\343"
+	.string	"\020;\252\233\233G\366zB\333\327cG\333\247\343\315Z\276)m_\237\335\315\363\204]\341\"\274\342\203\316\006\213\r\271\245\\\r29^z\032br\307c\202B\250\362@)\316\242N\251\231\021\021I\222$\215\001\302\013\020\006CI\2121\273\001\022 \364@\211c\2241c\"#MA*\331\232\003\340\231F\353\327\3316\247\025\357k\306o>\300\301+\241k\027Xd\271\244Y\021\337\262\304_d\007\037\007Y\206\301\023\261\022l\332\347\371}\236\017dL8\002\\\032R?\330\035sx\025\241\333\256\200'8\304\r\3526\254t\032\364t\226\261\2739\343\216.\213\001\203\301V\020\177\360`^\244S\017\323\237\034\035\255%>\264\235\214yk\305\347\352\264\250L\367H;\326\261P\307\204Q\300\002\267\177>B\\\313X\352\246\027\306@\026J\355Yl\2403\003yQ\274[.\220c\253W\354t\347E\341\322\210\274"
+	.ascii	"O\203)D\304M\265\215+KA5\201\205\372L\231\257\"\305\237\205\\"
+	.ascii	"\343'n\200\252}@\244\314\177\322\272\210\320J\b\347R\222\023"
+	.ascii	"\221Y\211SS\336\350\360\221\007v\324\"\342W\334\317\307+\345"
+	.ascii	"\210\242a\003\rX\027\274\032\363\201\306\315S\305<]J\232\251"
+	.ascii	"s\216\231\002\0017\020\260\333\030\376\220\354\305\370LY\375"
+	.ascii	"\374\265F\303PE\003\372\235\373\224s\310\212\264\272\367\202"
+	.ascii	":\030\020\215\216U\331\312\371\034\016\323"
+	.string	"\257\302\244\310w\263\374\265\203$\263M\360\244\222\255\220~\371\365\225E\212\255\260f\373%\221\026\003\200kV\350\210\231\\\037\300&\206\"1\367$\274\033;\320\242\237\370\356\270\370\005\006\243r\n\364\\\n\335I\303f\035\027\354Q\343V\2130c\343t\300\"\301\221\320\3000W\353=\276(\220\356h\221Jh\251\r\021x\343q;\323O\001\2532(1\256\264\256\030\270\323\272c\366\317y(\362\007`D\273\367\306\260Q\232\371\255\277\211\301F\304<\b\377vv\002\227&w\t\260\322\204\330G\300\307\261!DAzz\247r\213\225Q\232\262\004\2633\371\b\204$\002F\207l\n\334\220\013\3004\224r\336Xf\361WJ\034U\302)\007\024\376Y2W(\006u\326\0066&~\001\025\004x\020>\277\200\207@\203\357)\204\220\270\221>\230\230\324A#\206\206\3376T\351h\204\273\021\002\203y\366\254\265\023\322\213e"
+	.ascii	"J\2273OH\321\214\001\031\325\230\273\237\366\212\005\342\347"
+	.ascii	"@f\257\026,0\t\245*\237\240\362.\341\225A\004\343\310\tu\347"
+	.ascii	"!\364\271d\2011\255\213\377\374y>}h\b\031>\331\024\225\206\216"
+	.ascii	"\024\250\356&\247F0Z\337,I\207B\277\227\271p\356\021:\207\213"
+	.ascii	"XUf'\223\314B^\342*r\221\220\3561\006\256-\266\232\230\304\035"
+	.ascii	"\211[|.\305\246%h$Q*\361\264\242\362\304Zl\351\002F3\353\f\257"
+	.ascii	"\3479\375\357\205\352H#\020B^"
+	.string	"\206\225\3264W\356\345\302\362\337\r\341\007z\307\272\2120\232\210,\315!\210\221\251\177hG\242\211J)+\021\266\3729\211T\016\255\"\3232of\360**\027\204j\320y\375\320(\027U\3122Fl\034\211\\\215\274\220\373\324K\326\341A\225DW\375(\253\332>C\302\221<\003,~?M\300S\226\215\025s\353\007\255\363\2570\374\244/g\346X\217\204\373U6S\030\253\247\230\"\242\027\024\335\003\244\n\246\017\373J\257\031\037h8%\364\256[\326@)\342P\376K\233\221\b\312\302\037'\177\335\004B\224\204\036v\020\303\231\tK\266\322\215\250\2038\034.\215\204\013\320\2344\255*\003\t\3224|\"fL\363\373.\250\036\365^\365\236\242[\374\345\002?\222\333k]Y\274\321\003^\025\034\215R\322k$N\036@\272/\234\312\036m\030\244\215\244H\207.1\267s\377\264\0054\357\3035\256\024R!\347a"
+	.ascii	"\260t\346\236\244(\334\272^K\030\367\224Gk\243\343\r\332\\\232"
+	.ascii	"|,\233M4\222\215\022\341\236\224\307{\005\371\375d\262N]\036"
+	.ascii	"#`\024\271\245\342b\307\326\"m\002}\177\34010\375\020"
+	.text
+	.section	.gnu.lto_blackboxCalculatePDenom.194.886e5061ff6073b3,"e",@progbits
+	.string	"(\265/\375`\206"
+	.string	"\325\t"
+	.string	"\346\222C;0\305*\035\236\213'\363U\241\243\006\310\211\313\351\030\034$\3224\357\260,K:\334\232\253\2501\370\330\rF<n\027\275\213\205,R\326\251*\224a&B\213<>\"d\023)S\n2"
+	.string	"1"
+	.string	"/"
+	.string	"\266L\013]\254\f\206K\025\033\260\273\335\346\231\355Q\373\300\366\250\034\007\237\240\377\2213P\274TV,\323\223K\330]\347\212eq\353m\027\330F\260\237\t\177|Z\237\316L\337B\020@\300\305_'\273\0253\002\013 \246|\330\006m\214\035\256\034<\017\263\314\227]\r\023\224\33550\307\362h\333\017\271\b\030\232\252\372\024\b*g\276\246^U\340$/!\371\036\226(\345W\245\355\361\252\351\3108\345\314\016M\251\033\366\265\335]k\313~\232{\370o\207\005!O\004R\270\204H\013\240Q\347\343\374\341Lx\036\207O\347\301\323\211\032:\241\356\363Et\034\215=\b\320\327\215<\357\3530\341^[mq\2729)\312\233\252r\032c\251W\f\020"
+	.string	"+!\201\245\236L\350\f\n\\\374b\201\031\314\320S\004\306.v\rlB8`\016d\006F\004\025p"
+	.ascii	"*\217\251\235d"
+	.text
+	.section	.gnu.lto_blackboxGetRateDenom.195.886e5061ff6073b3,"e",@progbits
+	.string	"(\265/\375 \373\305\006"
+	.string	"\262\f/4@o\222\016\233\365f\252\016\004\363M7\220\346a\001\004\273\345,\265c\023\373m\323\261#\n*\224_\277\201ax<\207\346\201\355\311\333\345\030\1776\315n\"SS\234\213\312\343@u\036</\242\241\003\361(k\342q\b\256$\030\254GQU\326\323hY$!\026\204\020\343\"bE1=)J\305-m\361q\315:\335\017@\247\242\300G\310m\257a\016C\276\231\314\314\221\364\273\321\271\233\331\260\224:Z\342\222\271\261\301\344\312\244B\362\203^3B\002\350k \003k\331x\214\210R^2\265\207\"\275\352\256[\223.h\224l\331\b\253\013P\310\314]6\342\350\330\337\340?\370A\002\t"
+	.ascii	"`\251'\0230\2013\3348T\204\272\257\256)K\210\034\356\234\251"
+	.ascii	"\235O"
+	.text
+	.section	.gnu.lto_blackboxGetTaskPeriodUs.196.886e5061ff6073b3,"e",@progbits
+	.string	"(\265/\375 \372\305\006"
+	.string	"\262\f/4`O\322\001\024\202-\f;%\007\226\217)\016\003\317_^\020\202\\\300 \315n\273\370S\274)\215"
+	.string	"\371\207\201IPN\354T"
+	.string	"\227\217\025\013\033\331D\312\224\002\2462\024o\323@i\0346\016\202A\363\340\250J\302e\006\374\"\026*7\361^\345\246l\257\237T\214\245\026\366M\236A_\304\025\234\374\365\346s\244\267T"
+	.string	"\017+Cv\346I\005\261\037\255~l\247S\t@(\034\217+\273\032\241\226Ui)#\266;\366\344\307\223t\f\025.,\354\240#b\234\260\354\256\303\\@z\213\036 \275i\310\341\023\372/yBF\004]\230\347yA\330]\347\205m\334z\333\005\266\rl\177\004\t"
+	.ascii	"`\251'3\340\2543\202\206P\\\023}C\340\230\261\207\273bj'\031"
+	.text
+	.section	.gnu.lto_blackboxInit.197.886e5061ff6073b3,"e",@progbits
+	.string	"(\265/\375`\345\006\205'"
+	.string	"\252C\344\016F\200\234Q:\247R\022\250jn\331x\271\3326\002B\215\355K\336.\231\252\324\022Dl\013"
+	.string	"\0013\"\303K\254\\\365\001\277W<\373}\331F\222m:\212\325\372So\261\320\202\223a\257\332\376/\371\204lB\344N2\331"
+	.string	"\316"
+	.string	"\331"
+	.ascii	"/\230\265\274+\306\207\f\203X\026\203\231\013C\262\352W\216\205"
+	.ascii	"\231\3062>\344\007]\270\246\334d\226\301L\273i^\3104~\326\265"
+	.ascii	"x\017\316\370\235\272\307\241Eu\024\273\367:\270\311G\350\315"
+	.ascii	"\002\027`o\226\017`o2\217\031\317\207WW\210\212\370\313b\274"
+	.ascii	"\367\346:\311y\007\302\335l5Z:COk\226]y\3743B\227,[o\274\244"
+	.ascii	"j\034\b\313/\205\343zid\211X\326\261\310\324\325oB\254\252-\310"
+	.ascii	"ke\003\2534<\356&\nH)\240\215\021;\357\nRi\351\217\317\312\002"
+	.ascii	"n\242|\030\300\212\352QQ\003\347\035\2520=\326W\315\037M\352"
+	.ascii	"F-\317\bE\246\252\3367)\033e\201{\357\205\2579\244z\265\236\021"
+	.ascii	"\356\275\\\241\244\246\316Ag\276\0213\203`\266I\001\034\354\315"
+	.ascii	"Z\0065V\273\273\275\374\220}?\367L\266\366}Uz5\311i\230:,\275"
+	.ascii	"/\274\0038k\346XiU98\377\314\321|\b!B\204\017%e\214fF0(Su2/\226"
+	.ascii	"\330))\032u\226/\346ctIJJ\366&\203b\325\231,\337\313\2770\361"
+	.ascii	"\231\360\211\245z\250%{\363^G0\346\345"
+	.string	"\210U\026\331SM2\017{\265\201\314/o\037aF+\033\241\225\213\036<\023\245\225\207\322\312Bi\345 \2642\020Z\0317\253|C+\333\320\3125\2632\315VNm\345\031Z\031E+\237he\213V6\317\312\245\255\334f\345jV\276\202\004E\354\360x\026\330\275;\222\177\356\2279\246\311\203?\363\360\\\356\365\342CN\211r\214\001N\250\216?0\263\241\016\352\034Em\353w=\350J\023\260=o\322\fkm\353\216\343\303\342\365j$\302\204f|V\347\234s\321\022uQ\237x\024\031&d\343#\2435Q\327\262\0372\250\337\264>\325\370\260z5Y\322j\013uM\323\036\352\1776\347i\337\260\266\350\210\245m\303\020\377\034\253\320Y\3439\324\030\332\263n5?\244\355\263\321\036\020\026d\343\253\322\373\371:dF2\036\336{-\201/\260\265\333\317o6\220\317\266MckM\355\263\315\342\017Y\266m"
+	.ascii	"8\202]?d\331@\r\026L\303\004\016.\210y\214\365\336[\243\033\310"
+	.ascii	"\025l\331H[a6\252\037f\246p8\025\320{m@\340\273\371\033\013|"
+	.ascii	"&7\031C\206\f\275#\346\241\022\354\346\263\371\227\206\r\034"
+	.ascii	"\002\214\342\210\005\212\026\272\246\234\n\247\246&\247\244!"
+	.ascii	"\026\035R\350\\\354\224Z\250\260\240\324\244\333\231\300q\322"
+	.ascii	"\021\f'$\246$]\n\244\234\212%]S.i\307\"wD\200\235V(\355r-\234"
+	.ascii	"\234v9\332\360\351}\204\031\213\352\353\251{\f\324\3743\365\367"
+	.ascii	"\301\211\210z\250\213k\240\276\017\253\2073\243t\311\322\003"
+	.ascii	"\353B\002q\355]\321)~\341xO,\037\371$\357\t\024\236\024\236\024"
+	.ascii	"{\323\203\2172G O5\371\007\017zu\243\356\220\313\340\346"
+	.string	"\271\236j)\0169\212\325\250e|k \207@R\273pc\213\0200\264\2426\352\034<+\366\326HT~\344Y1\336zGD\036\203F\315\347\363><->\023\346\t%H\2607/|IF,\353\201y\215\331\032\250\347\2666\017\214\201\003\006L\013YO\f\2376Dj\r\344\232\n]G\200\230\250a<\006\0252\203DDF\222\024\n\215\001p\002\221*+z\021\320-\203TA\232\366\337\246\230\024\314\027\2779w\267\341\221i\n\361\345\213\033\300o+6\311\350<q$&\246\246\2350_\364\357i\200Q\255\013N\323\364rNvN\341\213J@DYJw\215\016)\026\005\263\331A1\207\336F|\324\264\251\215\340*\230\\\346;\243i\346\370\035\213\223hca\273\362\007)\"\206Pc=\013DO\345*S\323\327\001\320\267\032\251\\\201\301 \035\bjFX\031\345_\242\\\315\271V\201\346\205@+"
+	.ascii	"\205N\222*\350W\020\240\025\002/\246ts*\n\371\"\310\220\034I"
+	.ascii	"\315\362\231N `\366U{'\226\351'\035K\250\304`\037\b\017\006\204"
+	.ascii	"\3669\351#V,\013h(\023\002\330\267\210\276\206\365\226\243\n"
+	.ascii	"\324\020\254c\006#\266\376>\2628\365\232\337\344\336\371\035"
+	.ascii	"\363\024$\250\314\303c\337J$\241}Z\252\370\017\352B%\202\nG\255"
+	.ascii	"\234\355'\266\333\231\230\230/\361\016Q\300!$\013\rGa\215\265"
+	.ascii	"\340\322&2V\253\"\310\004\366\260Nf\373\202\032"
+	.text
+	.section	.gnu.lto_CSWTCH.180.307.886e5061ff6073b3,"e",@progbits
+	.string	"(\265/\375`f"
+	.string	"]\006"
+	.string	"r\013%.@U2\214\001\3030\300\270\273\335\335af\252\252V)\314Q\024Ey\230\245\253(\032Q\024\013\3030\360\356\356\356\356\356\260YB\bii\007k\250\307\375\270 7\344\212\334\221KrK\256\311=\271(7\345\252\334\225\313R\264e\250\313\22707\346\312\334\231Ksk\256\315\275\27187\347\352\334\321\335)\312\223!\365ltp\\\254\037i\242*"
+	.string	"P\200\300@\001\201\301\301\204\220\240\260\300\320\340\360"
+	.ascii	"\021!1AQ\261,jT)\3205\252R\353Z1\002\" \260\323\034\003\"w\215"
+	.ascii	"\021\271k\254\310]cD\340\336'\334\2511C\321\316\b\346\215\334"
+	.ascii	"mL\344Nc\"w\033\023\271\203\306b\"v\307\306B\374\207Q\004"
+	.text
+	.section	.gnu.lto_blackboxAdvanceIterationTimers.part.0.309.886e5061ff6073b3,"e",@progbits
+	.string	"(\265/\375`\363"
+	.string	"\255\013"
+	.string	"\346\324J@ \213*\0358\317\024\023\t\bdL4\0208B\b\313%\320a\0215\241\030v(\316\200\3072\303V:\204\002Rkc\240\2753L\200Q\003X\b\016\223g\270\237\373\214\023x||\262\267\224)\0057"
+	.string	"5"
+	.string	":"
+	.string	"K\272\310\240B\275,\354\356\366\250\004>:\324\214#\177r\241t\036\3510;/\300\025\302;A\212\335\375\367$\361L\231\021\217\223\313\356\332A\300\255\3356\206m\013\373\234\251R\316RY\326x\270\272\2625\035a\032jZ3\235\231\376C~\026\330n\311L\303\016\210\016\020\330\377Dv\245\362x\005\266Ev\354\255\002\013\300#;&!\022\247\304`\250Q\217\222\225^g\260\351p\234\366\b\265\302@J5_(Y\252\353\033:\t\277G\273\246~De\312\231\375\005oy\374\003\006\205\362\335\243\037\322\036\257\031\337\203\013\001\326X>\270\314F\203\341d6\216\rLg\323|@\233e\302\\\207\306g\363\340\270\317V\261\235\207\253+S*P\210PR\023T\226=Z\003\220\017\226`\202>w\227\244\312rT\325\020\027\204\036"
+	.ascii	"g\325\253\333\030D\004\2634\"\005+\020\002\006\007?$X\2073\006"
+	.ascii	"\232\300\302Yp\347\005\213OC`\261\2458\003U\026\002\242`\230"
+	.ascii	"+\334\035&\b\316\210E\235\013Lw\032\030\256\275\242pijJp\353"
+	.ascii	"\265e\f"
+	.text
+	.section	.gnu.lto_blackboxStart.part.0.371.886e5061ff6073b3,"e",@progbits
+	.string	"(\265/\375`\323\005\225 "
+	.string	"\366\264\276G\200\234Q:U\334"
+	.string	"_\n\222\205\217(\b\274RI\220\271^\215\320!\261\303&\205nb]L\352\240\330\021\277\3551Y\001\263\336\260\365\016C\315\037CxBF\264j\236\031 \261\002\362)i\230\356\372[B\310\226I\006\244"
+	.string	"\251"
+	.string	"\252"
+	.ascii	"\345\355\025\203N4\240\024\031\255\343U*\002i\371\226\033|\204"
+	.ascii	"\240\030t\262=\365\312h\035\357-\342nr\361\006\316\233\265\023"
+	.ascii	"8\177>\226g\221\241\346(\203\331Ju\352BE\345[4N\344\026"
+	.string	"\363\3467E\203\371\305O\261q\"\333\204gl\343\306\211L\343u9\371i\335{o&\177\210\304|\273\335|\024fFb\026{1x\201\260e\026C\260tw\024\302Da\252r\274\367\342n\326\253\333\327.-\277\323\246\335\353\267\336Qc\222\334p5\005y\017xI\313p\357\345\232\220\263yf\276\300\314\036\230O\f\001f\247I\311\02243\207\016\265\303\256\236|%\325\035\363\347\310\t\003{\0348}6\236\276+n\332\260\231\3605j\222|4\"\024\234\361\200+s3\037@\204\b\301\022>F\304\201\340\275\327\002\337x\257\021$J\2248o\376,M\355I\237x\235d\001]\340|\346\004\372\211\007\223\373\t\336\313\363\362/'\370In2Q\256\237\346\316\024*\372)\177x\033WV\0219\226\243\356\272\002\271\226/o\265b\2765\327l\3154[\363ik6m\315%\200\346ZknZ\363\033\224\306\250"
+	.ascii	"\277{\177$\317.\225\t\006\213\013\022\037\005)Y\237\346a\241"
+	.ascii	"vX_Y?\374\003#]c\277a\017\350\334::\265=~\330\246\246(\241\327"
+	.ascii	"\221)\210W\257\223\2764\304Hh<\n\235|\261\346\t\021\031\202`"
+	.ascii	"\354\225Y\250\223\337\347I\013%e}\276)w@\306\305\352\247UV+\337"
+	.ascii	"\354g\272\"\266\252\352\274i\202\0055\201[\340\311l\257\254\260"
+	.ascii	"\237\326j\336\271Z\363\245Tw\334\225\257\347{,\022\253\304ba"
+	.ascii	"\345a\3622\333\244v\257R\005>\331\361\330'\026\212\315\262Y\365"
+	.ascii	"K\204z\220D\006\315l\207VJs\r\227 \307^\371b\267#\304O\302\032"
+	.ascii	"\206\372\351\320\371\274\"\027T\243\bE\213\034\221\013\024\270"
+	.ascii	"\027,\210t\270\234\321\021.h\001\027\301Ha\204\213QTd\204\273"
+	.ascii	"\225\267Zq\006^M\342\372\362\336{k\0052s\037\005;\271\257:\210"
+	.ascii	"\202\241q\32004\214\211\321\311o8%u\240\016\235c\253\266\016"
+	.ascii	"\241\251\213\316O\253\254V\217\324\261\276\237\016\3535UW\261"
+	.ascii	" \242v\320;\023P<\365\300`rG\024\255\376,T\036\353\253`\033\232"
+	.ascii	"\031E\242f\375\224V\027\244_\276\220c\272\223o\326Q:>\266*\302"
+	.ascii	"V\357\276\207&g\b\223\307\262\363i'$\351\254&\204\311,\323i\t"
+	.ascii	"\b\223Yq\b\373 {e\365\241\343\001\200\226\250q0*\031\242\231"
+	.ascii	"\221 \222\244 i1\300\002\021\301\342\034\021\200\275\204\246"
+	.ascii	" \311\264\337\001CT\006d\025/\247L \023Br\255\216\310c-5P\334"
+	.ascii	"/\336\363\274\302\304r\344\276\035\035$<N\360\254\375\364\322"
+	.ascii	"\017\320\n\023Q\346\214\262\217\351\310\240&\216\032\300\251"
+	.ascii	"\034\346of\361\221\342\212iK\324\365\333\306-$\036\350\022\260"
+	.ascii	"|\312\304g\214\366\261\300\017\217\252\251\301\031\2208\224_"
+	.ascii	")\314WS\001Y(\241\321\016|\332\315\033\367\355\320\324\351>Q"
+	.ascii	"\3737sH?w\325\330\006\036\263Y\n\360h\315\367\366\3674\003I\346"
+	.ascii	"1C\366_\234\355d\0367\n\030wNI\304M\310z~\013\273ME\310\322\343"
+	.ascii	"\224\264\342\032\366\007J\024\232Bas\333\302\361\306\347\326"
+	.ascii	"\206\025\215g\257:x#(\246T&0\207\211GWS\020\202\373\230*>\225"
+	.ascii	"\360zo\213|\373^\274\332\244@\032\256\305\371u,\302\265\330G"
+	.ascii	"\017\302\271\250~\264\353\005\372\237\304N\255\235\017\241i"
+	.text
+	.section	.gnu.lto_startInTestMode.part.0.373.886e5061ff6073b3,"e",@progbits
+	.string	"(\265/\375`\"\001\365\f"
+	.string	"vWVD\020o\225\016\300\242X\243\302<\"U\005\272\b\373<B\372V\034\201\302\030\362\347XY\263\255\277\362\027\333\337b\354\272x\204\002\f\252\367\307\037"
+	.string	"\224\212\220\221\b\\\245\226p\022\240\026u\201\310\"\262\311\336)\005<"
+	.string	"B"
+	.string	"I"
+	.string	"\333I\237\206\262\273\356\364 l\243\354\222W\216uY\264K,\254M%\250\225\250 2\356\256w:;\\\374\224\233\350\247>3^\032.\005|\243dv\327\225\330Mo\033\201m\007\366\305\034\f\254\270@Ac\334\255\336\251\264\357\207\334\303\027q\007\202\372\207IZ\352\302\\\247\371 \365\"\304\177\230\002\254\212\375\213\244v\302d\267^N\215\251\234\272\236"
+	.string	"wZ\371"
+	.string	"\356\324\247{\370"
+	.string	"\211l7\334\351c\036\\\214/T\362\304\024i\207\021\344[>\355\3070\202\"\005\f\223\325L\3119\363\334\276\355\334\260\267\255\326\002\200\306n\206\223\030\273\201\232\370\360\220\217pi[Y\345\200Qf\035,B\214;\241^N.M\013,U\376\220\300\257\301(d\320\021)X\320\361\200\232Oh1\007#\341\333\2008\032\b\033O\364@\023\3628`\350a\n\370\033y@\217\364}\240\327\331\226\237\033\316\250\346j\316\331A\234?r\022 \277\303\241O\276u\352\177\001\033"
+	.string	"\\\tT\323y\262\350\207s\006~u\0234\366g\002\004D\3010W\270.+\004\004A\211\0214\005\"J\2058\352p)\003.S'Z\350&\b,\352\006`\272\323"
+	.ascii	"p\355\0017ZD\277\253\214\001"
+	.text
+	.section	.gnu.lto_blackboxLogEvent.part.0.374.886e5061ff6073b3,"e",@progbits
+	.string	"(\265/\375`%\005\355\037"
+	.string	"\366\370\305G\220\232Nc\004"
+	.string	"\201\236T\215J\247|\244\207!\037u\353\332\242>8\327\326\352K\2541D>\370\373\366\004E\364YH\031X\177\313lV\002\201@\234\206\363\325\336\031L\336\266\2210\272\035J\352\250\321&[n)S\n\256"
+	.string	"\247"
+	.string	"\265"
+	.string	"U\310\271\200\037\202D`\346\n\271\236\036\230\2676\232\224\336\250\364\255$\322x\207P\246\324\376\217\003\001~+\311\271{\253\306\310\35652\270u\216y{\363\232\362\226\274\200\362\326\276\017\333JP\006\332k7b]\002\307\323\251+\314\275\227w[\257\016|\316\304\225\226\254T\007\364\227\2363_\025E<N7\224\361r7l\"o\250\213\241\023\265\244"
+	.ascii	"\2510\265K\201\"\222\013\324x\314\330\rYP\322\3478\325\245*J"
+	.ascii	"\352\225T@\345\004\006\200\241\220\254\211bC\313\305N\237\206"
+	.ascii	"L\224\006\270\016\267s\357\365\2033\356\335mK\331\256`[\t\001"
+	.ascii	"/;\222\037\037\207\201~\364\347\255\377+o_/vrI1\354H\f\3227Z"
+	.ascii	"\255\\u'o\275a\233\324;\223Z\227\243\316Uj3G\215{\327_\336\370"
+	.ascii	"[\223\2324\251\253IM\037v\237\206\026q\306\334\373\342m\314\245"
+	.ascii	"a\313t<\354\377:\231\205~\233\240hZ\020\217'\333\025\032q\210"
+	.ascii	",\304\2634\001j\214\033\232}\023}\314\r\212fY\367\211(\371`\027"
+	.ascii	"\363.\254\210\221o\204\306;,b\364\033u\337b\307Qj\307\374\227"
+	.ascii	"\327\021\365:\232\271R\356\207lG*\266{\2158\267\216`\336\356"
+	.ascii	"\\\351\273\224\2147*W\323@n\340P\376\344P\336\342\352\313\202"
+	.ascii	"\364m\212\211\3545z\336\004\267\247d\\o0UV\264\312je\003GP\332"
+	.ascii	"\3523\241\t\251\030-]dm\026\251,ke\242r\305\205\245\303\237$"
+	.ascii	"\325`\331\036\236\366A\247\230D\307*\216\006\342iE#Y\367^\bM"
+	.ascii	"\356$\204\210\021G\345\355P1\211\326\324\231\374\225\2546W_n"
+	.ascii	"N\304zz\344K\224\032d\001\252\253)\257[\253\\\377\034'\025\224"
+	.ascii	"Z\255\214\373OY+\017W\232"
+	.string	"\220\2121\255\257\265\376K\323\016&\372\346\031Jo\263\362cW\3623\357\r\376<\273u\257\307G\177\322J\203\264\365\200\302\242.\331\001>=_\t\322\307g\3443\022*{E=\037\262\b\205O\205\317\272'gE\020\317\257\247g\202\207\207\002\250w\202\3273D\304\313\261qP\n\337\020\257((h\210\267\263MO\336z\303\336\tV&\327\223\271\003\224\301w\365c/\363\033\200E\006\b\250\005\364\261\373\177\312\327]\035P\005\314\255\211JWm\340\217\037\177t\212gYa\334~\266\005\351\333\027\340\326O\347\245x\246E\f\232%\256\232\264\276P\231\253O\266\r\315\325\262\232\325\246`\201\376\264\003\032M]\220h\260N\373\302\3310\330`q\371@\242h\266\266\305\314\340\004\246\344\214\021\244oY\256\340\252\225\021\273\350U\334\304\020|*\001j\250\241@\243\224BdHDHA\222$\351\200\002\221\"\272n\022"
+	.string	"\370%\2444),\326\3773'R\037\226{\313]^\177\005\177\336\340\331\nd\022;H$\230\253\t\217R\245|\013\232F0>\244\025\352>\350<\020\fi\265\210q\2536\252\367x\260t\234\377\002uw\374\342\351F\002xc\226\035CT!\273I)\230\005,?&\373{lB\nc1\243\2304N\303A\027\035\255=\323\001\"0W\373\030\233\301\345\262\321F\375q\320\310$Psg%-\305\230F6L\224&\226\"Q\312ZV\274\033\322"
+	.ascii	"\344H^:\001\212\241\360\013\324^L\200 \017\330lIW\343VE*\246"
+	.ascii	"\356\3245\033\271\341\203\\\201i29K\321\350K\277L\232\306a\263"
+	.ascii	"\361\223\021\241B\033\272s^\377\267J\031\002\247\001"
+	.text
+	.section	.gnu.lto_blackboxFinish.part.0.377.886e5061ff6073b3,"e",@progbits
+	.string	"(\265/\375`;\001\345\f"
+	.string	"\206\225N?\020O&\035\340_\272\025"
+	.string	"[\302\032\033\337\266\207[\207\347\b\224VP\265h\200\204\237\025\262\304\026\"\246\201Y\345\313X\024\001l "
+	.string	"\200\n\021B\005\036#\004\320\212\034N\304#\"\233l\231R:"
+	.string	"="
+	.string	"="
+	.string	"\027l{\036\370c\247\270\230\332\215\221B\003\027\213\335\355>e\205\177.u\373\370\254\253\312\004\350\362\342u\004\023\235xA\220p\305\370\346\230\354\256\037\023\356y\333\003l\007\260\257!\021\325\212\030Hi*Q\226\333\267\225'{S\237\333\306\326Ei\327A\255\305\232&\t\013\376\206s\340\274e\035Q\224H\034?\303\305\316[\226\021FY\t\303\356v\324gyl\b\344\363\001\004F%f\244\313\213\376\016\302\242!\332\300_\227\214\324\356\n\360\360\017\030\177\365\351\f\250\017A\356S\322B\025!\255\331\241\276\270Y\240\017//\376\247\016\343\316d\"\tr=L\033\371\f\376$\f\300\n\346\363\016T:\004\027/\323}\232M'\001`0\201E\323)"
+	.string	"AM\007\261\255\337V\236\314\372\343\005\213\315d!)\032\241\241'R\242L\341\374\020\027A\361W.\340\351C\217\373\f* \200\202\031\244\351\001\247\325\333\316\030\205\235k\254\323\254\332\301\nt\310H\026tX\314\013#\r$\026\3448\302\001\301\223\330QK+\310!\277\007(\r"
+	.ascii	"\331\353\312\246\211\3620\037\216\256\005\3164\336 \310I\334"
+	.ascii	"i\004\373\245\261i\211\205s\212\205\326\224\025\003\240\366B"
+	.ascii	"\255\r\005\355?\341\215\001"
+	.text
+	.section	.gnu.lto_blackboxCapture.part.0.382.886e5061ff6073b3,"e",@progbits
+	.string	"(\265/\375`\332\002\325\025"
+	.string	"V'\213I\300RRc\302CY\356\276\210\313\005G\246\351y\260\365\236\217\323\350\356\006\030\265\030\201+\261]\2618\347\370\004\314\344\214\333U\364\210_0Y\331u\024\037\214N\237A\376&\f\347a\241\367\203\350\205e$hd\313-eJ\001s"
+	.string	"r"
+	.string	"v"
+	.ascii	"9\006p/\320/\352^s\301\255O^\267$\037\031o\305\213\214\267\366"
+	.ascii	"\215l\343z\234\263q\334\354]\002\347\025\317\222\360\336\033"
+	.ascii	"\273\255C\317}\264b\245\256\234_\322!\007Y\352>\272T\034\f\235"
+	.ascii	"'Y\372\334R\262\004qQT\200\325\202\307\b/\005\t+w\264\206\224"
+	.ascii	"\034D\222{\357\221N=\224;\224\016\270\313\245r\357\365+\304\375"
+	.ascii	"\272m\233m\006vE\020\027]\324u\244\246\226\372 \266,!\340\347"
+	.ascii	"^\336\271uOX\027*l\237\205QRp\276\221\350\314\036\357L?\242|"
+	.ascii	"\302\2733Ml\033%\345\306\267\233=^\b\317\223\320'\274\327\214"
+	.ascii	"\335\336\276\337t\247\233'\031\226u\372nl\246\006[RW\372\022"
+	.ascii	"\316\223\\\201JD?\276{/N\365\221p6\ffJo\342\376\313\021\315["
+	.ascii	"\366\230R\373G_\221\373/7)\201;\376\333\350\307\270\324\r\203"
+	.ascii	"L6\336\336\347\267U\264\303\300\243\242\2368\033i\2352\341\203"
+	.ascii	"*\253\312\312\177q\340\314Ga\032\214\365a\306[Z\357\364\004U"
+	.ascii	"7j\374\034\211\320\241\247\353\351\275WW\253\220\355\333\370"
+	.ascii	"jK\272\332\321\036\206Q\221\313\214\366L\215\236|\275\325I#\270"
+	.ascii	"\253\272\247\222W\357\366\334R\250a\224\026\226\216\016i\025"
+	.ascii	"ru\211\267\006\3317\0375,\264\231\030\n644\233\3556\003\361\354"
+	.ascii	"dC\355Ef&\313\360\022\243\211\221\315\304f\266\232\330\311\001"
+	.ascii	"\3274\320l1\233Z\315\026\203]\2745\210\0042\n\352\324\035\033"
+	.ascii	"\224\274\327*::\034\rP\373\001\204\246s\030\334\251:W[\200\212"
+	.ascii	"\325\216 \201\236\364\221\376\017P'\221\026V\200\257\214~\360"
+	.ascii	"T+\023XX\306\333\n#`h\221\2503Z,\270\234\324\341\313\370T\313"
+	.ascii	"\005\027\227\361\266\3263\005A\250q0\250\024Bf\254FKJRh8\200"
+	.ascii	"\002\221S\247\016\020hX5\315\001 N\261dr\312\243\262\032\332"
+	.ascii	"^\227\177\033\n\b/\332\300,\201\364v\230\377\035\206)\013\024"
+	.ascii	"\231\312\255\356g4T\031\036K\317\271\217!\003b\347\3045\211\212"
+	.ascii	"\306\017\tFJp|C\013\\\213\261\334\262\377N\b\322\340\032\217"
+	.ascii	"pmW\200\321\313\232$\213\254\024\031\367\337t\234\200G\26149"
+	.ascii	"\373d\224+\262\321_q\253A\362\203K\222\225\350;\330\017"
+	.text
+	.section	.gnu.lto_.symbol_nodes.886e5061ff6073b3,"e",@progbits
+	.string	"(\265/\375`\034\037\215Y"
+	.string	"\n\213x\035U\200\316\345\244\0037\246\372x\244\352^\210\241\273Q\210\262\362.\267\242`?\300x\213\215%\206C\345g\264\367N\340"
+	.string	"?\224\373\210\262\262\032\262\252)Ur\234\321\257H"
+	.ascii	"T\365\237\204R\375'9$\240\0357\323\325\021v\177(H\317\027\376"
+	.ascii	"\230\031w\227\255\220;\311\273\001\274\001\313\001g8\213\366"
+	.ascii	"\235-\"-\222\234\327\004\366y\304\350K\035\365\243\214\372L\307"
+	.ascii	"Y\324'\"\352\377j\237g\372zMC\375\235_O\270)\324\363\b\243\017"
+	.ascii	"5_\364m\004\365M\230\0134\231h\t=\225L\027}\243\026/B\340\247"
+	.ascii	"'\333\364\351W\0226\255f\223\344X\254\332\212\323\\O\3175\236"
+	.ascii	"e!\267\323\327\201\300\005\235\2366r&0\207s\342T\321\217\321"
+	.ascii	";Nn\246\350?\241\350;M1\246\037\254y\242\017\364\233~\220\211"
+	.ascii	"m!W\342\276\334J\331\364\177&\211\376\213\232\253\310\365s\034"
+	.ascii	" z\001'\355\357\230#\3724\346\364\315\237I\323G\232\263w\035"
+	.ascii	"\232\367\342f\013\270>p\266\320o1\227L\022\336\246\217\333\\"
+	.ascii	"q\234=,L\236\266\271\243d\352\260\315\234\025\346\315\332,\221"
+	.ascii	"d\342\250m\\\332Ta\234,\320\326\355l\217"
+	.string	"\"\314\024f\223\026\347\210\262\351C2i\310\246\211\334\330\341\304\336\302\221\376Ry\267\260\377 n\231\221]\313A`#D\347`}\245Yd\315\210,\234\n}\031s\200\021C9\376\325g1\275\316\326\3656\256'\031^xa\177\305\034\262l[/\021|\215\326O\274\374\006\3466)\034\205\0057Q\301I\344\226\346Y\033\206\265mW\253\204\343\342\342\342.\244\3374\255n$\310\213\240\360\257\023\336Uu!\325\207\344\200|+\367\343Z>\236\302\003Gni'\373Is\202\323\344z\354\333\324.\341\321\027\232R\027\222;\275\325\205^\257\327{T\037\306\204\332\025r\274{\332\373\323G\344vW\327\363\371z:v{WH\316g\257\327\243\371\216\276\213\271\273\b\030\020\357\t\342\305v\027-\314B\277D\023C\204\356\323\302\033\352gS\024\224\323\n\375\201^\024\001\342\321\353\236|X\274E\013\357~Z\330\204>"
+	.string	"\262\244\032/\241\345'\244\025\025\235\204\005X\202\263q\311W\025\007\0058\005\003e\301\201O\352\256\\\301\201?|\001\032@>\216\303\201W\310\025\337\027\t\032\221\246]\006V\251\327"
+	.ascii	"\3245v\236\f\234\342\373\376`\n\"\323e\340]\375a0\331`3!?\251"
+	.ascii	"x\276\216\357\311\300/(v\314B\246\3301\213\212\035o\300\331\261"
+	.ascii	"\006\252B\352\3548\205b\330\3311J\375\215\f\025q\354L\312\377"
+	.ascii	"\310-\r\3539;~yB\307\237\372\217u\254#K0\353\250\t\346\327\033"
+	.ascii	"\346\264~\230\261_\242\365\217\234\365\313\314\372\305b\037I"
+	.ascii	"Y\337\fI\377\214\254\217\302X\237L\254_"
+	.string	"u\244'R\331G\013\353\253\021\373iF\372F\260\2361\212\364\201\020\351y\244B\317\372\325\323\310\253'QW\317!\256\236E\303\236B\302\236\277!=al\365|\021\354\031\244\325\323E\n=\201\262z\226\200\325\217\273\352Y#\244'\t\253\236'\202\364D\201BO\233\023z\366\252\372,P\365\337\200\364\217?\372b>\372cd\177I\217\376\nS\3755\036}*\251\376\tQ\375!T\237\353\251\037\334\321\367r\352\253\320\324'\242\243\017\226\243\037\004G\377\352F\037\353\273\273\313b\243\237\365i\302\226\271\335\017f8\020\201A\f\323\212\345v-\340\300\202\017\034\\ \342\202\031\nb6``Okf\215%\2431\223rK}\0373\236\"\247\324'e\364{$\365\247l\326\230\373\315\006;\344\017/\332!\317\bY\203\262\206\2502\245L\fN\215\241JdK\320W\317\225X\312\031\344\033@q\023|\322\n\371"
+	.string	"\337\337\333@*\255\220J\245\006R\245\344\235P\031\345\322\ny'c\205\027\362\207_\3103A\236\251!\312\263T\257G#C\203\034S\202\2500\224\205\245n(WH\rU\205\276"
+	.ascii	"\034\245\033\224\022\245\362H\340\006\231G#P\272\tz%uH\033\\"
+	.ascii	"\251\340J\005\371\303W*\310\036\276RA\336\221Z\274\2531\312S"
+	.ascii	"---\326\225\347Y,\326\375\316U@u\270W\213\305*\365De\n\351b\257"
+	.ascii	"8\205b k\365!\217\366\252C\325N\335U\322\204n\325N\245\272\321"
+	.ascii	"^\361\353\325\025\243X1\nY\362Nv\324\212M\250\256\032\255\225"
+	.ascii	"\225\025\277$\"_\267\312g\253\270C\321V\361\t=\003\021\326\350"
+	.ascii	"\274.\025\013\360\213\253p\344\233[\033]Kb$\321\212ecba\304("
+	.ascii	"(\247&\0347\230j\2243(\022\t4*\242\374\213\203{sk#\225\3245j"
+	.ascii	",\321\310b-\243be\030\031U\241hS\211\203\274Q\231\350"
+	.string	"\214R\211D\252@ZT\016\221\363W\343\350[\351F\266U%4I5\322bYF\216\3250\032U:\2218*\023U\002\026\225\377\215P\206P\202PzPvP\212(E\314\220\217\200\212F\006!b\350w,\313\f\246\276T\226\312B\203\\\370\200\r+\032TRH\f\024\205|\341\302(\025\206\013\363x\244\220\013\363\352\317\205Ov\263\311\246\307\201\\XW\1777\2418\252\017\271\360\313\037\027~\365\220\343\302!\310?\r\314F\246>\307\345\003\016D\205!.\320\3020\365K\225\025\303\354\245>{#\337\t\370\025\361\332\262!\342\003 z\nZ\266\337\324\001\310\232q\266e{\344\236\332\257=r\b\364\355;\366\310 \324\357\200\bk\376\264G\223\032\034\245CuP\0375%\202\022\327X\245\366\3103\276\355\332#gP\241\210.{\344\020\244L\f\b\037L\371\342c\331@\233\246Z\366\310+\025\205~\211\260"
+	.ascii	"\343\272\317\036\231G\177\366\310'tW\362\250\261\307\226-\340"
+	.ascii	"\326\247\366\310:\337\216\355\221w\023\364\365\036{d\023\"\330"
+	.ascii	"\266\261\311\324\277\002\270\205\224a\333\266\200[Hw\3326\265"
+	.ascii	"m\013Bc\311\321\026W\311\026p+i\323\226\355\300-\340\220-.\033"
+	.ascii	"{pZ\265\340S\216\243\f\253\306:\342\202\255Z\215Mc\036\361($"
+	.ascii	"\226\f\371Y\255\221w\276oZ\325\032\371\364Mk\344\227\2565\262"
+	.ascii	"\004hk<[#\353\210_1\037\270\236-.\032w\370\211E\333\260\265%"
+	.ascii	"I[\3343>\355p\306\036~\241g\213f>\260\222\\\307\026\371D\350"
+	.ascii	"<[<\026T\t\232%\3332~}\216-\343\004~al\311X7\265\304\035\343"
+	.ascii	"\343\3301\356`\202\212%^P`\211\254\263\261D\346\335X\"\357\210"
+	.ascii	"\237E\026,\007J\350\307\310\203\210\330k\354\327\314b3\002\343"
+	.ascii	"L\373\305\272)]=\017q\271\266\213\357[\254\355b\017\035z\266"
+	.ascii	"\213S\206\304\257\260\006gi\205\313\305\030|\033,\317\263\\\274"
+	.ascii	"\323Z.\326\371\366j\271X\206h\207,SA\370`H\234\0352\314\313\357"
+	.ascii	"\034\216,\351\374\250v\310,t\006q\311\003hT\025zd)\207\351\265"
+	.ascii	"\214\261C>!\227J\244\035\362\216\\\332!\233\224u\207|\352\023"
+	.ascii	"\202[\250\262\310`P\225\320\214\314\210$IR\350R\f\b\311\242\026"
+	.ascii	"2\242\007\022`\302P\214r@m\210H \"\"2\363\360\364\355\036\005"
+	.ascii	"\307$\305*b\033\272\251\347h\023\221v\2471\221\262\241\364\375"
+	.ascii	"\343\361\353\322\335\212\273\001!\333S\265I\275\367\313XE^\273"
+	.ascii	"]\200\271\364\322\2554\036\b\326\025;{w\034"
+	.string	"v\021#\376\347\001N\237=\351\252\3443\244T\362V\242\312\372\250^\357\f|\030#\327Ut\217[\001bG\271I.\2708\031\307\266\267\324)\321a\356y\242\370\374e\345\265\261\205'N\306\375c5\225\373\330\221\275n\032\205\213%\332n@f@\351<qw\236\225\246,!s\333\206~2\016\233WM\220 )\320\003\nb\211\200,\272\320\245H\345{\032\300[\240\004w\316\016\267\230\025\357M[\036q\234\251u\035\336\314G\004\334\323|\035\231k\307\221<\264LLJQ\007\327op\231\013\317\376`\320\265'\221B\326\200Z\\"
+	.string	"\255G\277\002&\004\302\227\271QjZk\246\026\271\231\371\216\327\225n\364\"\2605\237\20040\r\277\300\303M\301\216\025\003\243J\246\373\3070\251\353A\001\tP\027%\275"
+	.string	"X\272X>*\001\022VHZ\307\230/\341~\3370\203\3769\\\373\260N\202\321\033\026\354\221\322R\314\310\233\321\226\270\022T\314\227"
+	.string	"\036Cn\307y\031\002<\277\342\007LR\341\220.\270\220?J?\363\027\372nF<\243\360\205!\321L\266\336\235\221ip\237\254p\024\fz\b\0027i\230\3038\\~\001\333\n\347GF\252\027\304t\312\326\320\232B\242\274\210\344\231\301T{\340\372J\177@\005OJk<\210\036r\241\346\005\3709e\260\351\300\273\rI!A\003\342\213>s3\362\230D\207]\350\340\301\375\220\"'\346\b\t:\362\243\206\341\005\027^J(\251\017t\366\324b\233\246\\\230\263\240\332m\234\360O\273\nN\273\212\271'hi\271\325\"\313\f>\355\271\025\317\271\244z=\374\275\250\337"
+	.string	"\362\030.\216\2236]u[ \310\256.\336\001\247\332\366\232XX\376\322I\352\016BL"
+	.string	"Pf\206\336g\317\242u:&!\312\324\216D\225*\354\360\336\243\300*\242\347\330\363M\"m\026\321\324\364D\267Qy\362\325^\376\367\203j\177"
+	.ascii	"\205\335\370\355\217F\377\324\0352N\364\310\362\370\333u!\361"
+	.ascii	".2\017_\373\345y"
+	.string	"%wi\305*\353_u\375U\326\277\352\372WY\375+\353\277\272\376U\327\277\312\352_Y\377\325\365\257\272\376UV\377\312\372\257\256\177\325\365\257\262\372WV\375\003\266\252\211\003\275\027b0$\326\213\336h\377\373MO\227\325\277pNE\366\032\262*t\366\347\342\356\032\033i\236\220#lc\t\256\325\317\355>\243\354\333=$ \323\343\265\205\250n\203\376~*\306\347\327v\357\374t\262\361\2602\361\357\274L\347\022\303\263\t\245!\277\377\312\301\250\235I\216\004L\\\2717\251\242H`\016\031\0028\022rS\375\362V\224x\270K\002\005\320\242\002*\233U\273\232l\216u\244\211\b6cU9V\276zDKL\231A\306\316x\220\275\224\3608\263\332\304\200K\351\245jY\355iMc\224\270\377S\335v\274\214/\035k\326E\316\020\256v\b]\267m\237\300\361i\341\307\255\223RG$TR\025\205\331\023\021\352"
+	.ascii	"\346\211\364\220\324\275\035\344Q\245x\227\354\0170pg\376\221"
+	.ascii	"\250\245RB\003\340\230\333z\024P\006\263\275\272#\r\013C\237"
+	.ascii	"\263J\032z\253\177\314l\240\331\r\352-g|\340\342Y\271\2416SP"
+	.ascii	"5\222`\201\277\025"
+	.text
+	.section	.gnu.lto_.refs.886e5061ff6073b3,"e",@progbits
+	.string	"(\265/\375`;\bu)"
+	.string	"\252Z"
+	.string	"\020F\200\234Q\032\003Oc\252P\240\201]\001PN\326\027\031+\372\211c\030\302\305|\307i\334\315(\320aGe\343t\b\231'S\335\031\253\372\277\001\364k\207\032Y\025\344\266h\377\306\352\203?\371\253\375FZK\366\226)\331"
+	.string	"\t\001\342"
+	.string	"a_\305}0\305\237\353\374\267\316}.\347/8_\201\324n%\365\306\342NU\374\342\371P\364\221\244\366\341\271\007\317?*\356F\305\037\212z\336\371\270\250\267\235_\236C\001\307==\355\351\251\323Mu\223\3565\372K7@=\n\3007\375\0062\375\217\351uK_*\235TN\240\210>5\244K\r\367\"\361\243\206;\324\360\237\214\350M\266oB\332\225~\237\004\334\211\303}\b|\341p?\032\356F\345^d\376\017\270\373\204;\221\360wA\272\356\210\236\003\376\315\350mEO\373}\365\375\366&\n\376\225\241\037\213\367\bv?%\364\301\240\367\351\236\007\364\272\334\343po\342\236\206{\212\373\226[W\3567\333^\332\3504\033\235\232\277\345\265\332\225\366KV\372t\177\367\353\333\250\002KWO\244\037D#\f\215\273\213n\226{\321\353^\277w\r\2016"
+	.ascii	"\246%\245$b\320\250\307\333\351\326z\240\333]\276\266?\020:\367"
+	.ascii	"\326\216\273\331\326\332M\332\\\270\354\240\234lP'a\234;\351"
+	.ascii	"\342\374\372\207\301\3273cg\371:\006\300\327\257.\256-V_\263"
+	.ascii	"\250H\201\342d,_\233\234\365U\311W\276\"\331\312W#D\256\3625"
+	.ascii	"\310\017\036;p\330\220\001\243\262\340\203g*O\353\310\031\353"
+	.ascii	"i\233#\2322a^\\Z\246Dq\302$\311\221\"B|\354\270Ac\351\351\013"
+	.ascii	"?y\352\304a\243\206lL\030/X\250<Yrd\310\322/\020\037=t\344\270"
+	.ascii	"QcF\f\006\277-\376\364\311cg\316\033\006\377\331\202\277,\367"
+	.ascii	"\237!S\360\227\021s\365\207\361\372\302\364wI\360g\241\277\025"
+	.ascii	"\240\257\262z\003V/\300"
+	.string	"\351\243~\357d|\246\252W\242\242\373\020|\357\300\363\f\374\256\300\347\316\277\021xr\300\257\200\247\246\363bd\306\004\273\330\035\314\353\357l\016t\372\331n\330m\264\337\276\2775\324\207\037wap\263\375\210|\340e{\021p\377\tw\337]{o\261'\n\356CF\317;\332wE/T\356A\276]\007\324\333s\304\035gs\332\315\337\327\256v\222\334\275\326\335)]-\232A8\317\267\357\202F\363\272\336\216\253z[o/{_#\356$\361k\271\030p\233\276\235f\334\327\367\005\362\333doN\266\357c[\250\333\216\350\265!\275\036=\335\"Z\201v\222\323#\001\253\236h\177(H\337\005?\b\211\016\024\234\202\371f\310\306\302\300\276\026\314\226*\364\027\320\017N\330\375\233\301\332\374E\323\240\331?\214\n\351\343\366\313}\332J\330=\234\301\366\337\2709\376E\337\254l\367\325\354/\266%\340\317\302\242_E\277"
+	.ascii	"})\372O\364\003o\f\2723\350\217\256\214\372i\356N\001\226~\257"
+	.ascii	"\264.\366\236\361\211\214\373\316\270\347\214\373\355\367\266"
+	.ascii	"\252\275\2660\236V\356\244o\257\264\267/q\367\305\356]\027o\213"
+	.ascii	"}\215/\213}\253^\261\257\r\032\033c_,\213\367\374~=\237\355\343"
+	.ascii	"\371\016\235\217k\006\033+c~<\367\313~\350smi\235\253\345>\364"
+	.ascii	"\263\276b\345\334\261\346CWpu\356\t\316\335Xu\356T\347\022x\017"
+	.ascii	"}J\352\334\213\347\016\365t~\323z>\300\371K\347\236t>Rq\027\026"
+	.ascii	"\277w\376N\350\334u\347\016T\034[E\202Wx\212\035\350\343\231"
+	.ascii	"\232Q\220'\326D\tzmx\234\304\361\021\273\315,\367\322\374\032"
+	.ascii	"p'{\213\240M\326sC\320\215\212|k\r\361\266>\207\033l\020\271"
+	.ascii	"\315\032\215\374\272\231\031}I\372\241v\371\361i\227\225\355"
+	.ascii	"\241N\304\333"
+	.string	"+\b\267\233\235\006\200\306\2501`\246\baJHDDAR\220$\035\340\002)\232M\036\021\360\256$\225\3224\006\220\340\021\243\204\213\256B\030\260\037\221\3746\236\250_\335\362K\240\341TE\232\220\340NoV2\251\024\362\341\271,\025\232dg$k\276\3123T R\006\271\255J1\247F\257c\3633\353Y\264d\275\214t\276\244\303\375\203\372\260{M\345\266Y\306\270\201\307\001\300\261\031\2433*\016\007u\201w2!Gg\227v\344\300[\326\215\302*DJ#\314\223*eX\373\007\202b\362\027\022\342\377<+\356 hRm\trU\231\366-\023\310V\225E49 \231\026!\241\305\bK\257\301\025\203\213;/\324!\212C\3463>\312\262^\321?\223I\311N\322A\254\271q\031\341C\202\b\247G\212\223\204$8\324\212\201\376}u\315C\226x\026\327\345X='\240\200WE\\]\311\201\211A"
+	.ascii	"\005\020\342^\355\362\024\274\202\"\030\2110h4\006aH\204A\243"
+	.ascii	"1\004IB\241\271\340(\001\200\210;9(\206\234\031\007\304Qa\273"
+	.ascii	"\256\n/)"
+	.text
+	.section	.gnu.lto_.decls.886e5061ff6073b3,"e",@progbits
+	.string	"(\265/\375\240#>\001"
+	.string	"\235\347\004N{G\236\032T\0200d%5\006\344\027_\004\244\277\261\374~\0362\210\n\365h\242j\362\003\324\223\032\333\277IX\356?\254\241\250\331`'\336\026 \013BG6\256s\2216\3746.mgvZ{\2216s\211JJ\234\202\n\336\215'Jp\322J+\255\221\225\334\225V\356\024`\027*\033b\033\030\224d\266l\345\301\2216#JW\017\037\370\200zU\362\024\313\266\024\373\2041\300\221\237-\"\032I\b-\216\\#\267\037]>\240\236\225}\322\243\222\225 \205\304\232D7\221R@\021/\037P/I\257*\303"
+	.string	"H~\262\331\317v\365\300\260bR[\3268\216\345\266\364W\b-\216\334\"\267*k\231\017\210\215\313r\275\257#\022\334\216X}@\332\211\256\363\240\310\217\021\245k\317\313I\017J\022\007G\352\214(]Y8\255C\017\211\202@\221)F\224\256\324\277\227\345\003\312\\X4\226m*\376\361\t\001I\224\021\245k\034S{V|@\275\263^\232\233W\317\212\017\250\307\326\243\353}\035\271EJ\270\254>\240\336\030-\245\001H(\216\223\fP\244\315\210\322\225X\345\205\031\034 h\035\246\250\243\307\017\227\254\217\234\262\305t\224\036uJ\002P\321\234\266j:\266\252\301\\\203\321c\332-\204\026G)"
+	.string	"\021Y\301\350/W\323"
+	.ascii	"$\024\377@q \304\314\2204\232\311\324\225\034[\037Yc\237U\222"
+	.ascii	"\226\201e\233\242\300\020\261/\266#VV\315M\223i4\r@B&\234=\261"
+	.ascii	"b\271\031\321\215\343\250\260i\026-\353\332\006\226-\f\004\331"
+	.ascii	"\2265\216\251nZ\313\315\202\202dY\325\264\233V\313@\374\241\306"
+	.ascii	"G\255\017*\253\245\253\027-\247\267h8\375\246\273\3508\315\205"
+	.ascii	"\255j7\335\026\344c\262\344\212\207\324?N\331?\212\355\037\225"
+	.ascii	"\354\037\221\354\037\207\354\037\253\366\217R\373G\033W\236\370"
+	.ascii	"\200i3\312\372G\241*\332\n[\325gz\212\024]\246cnz\246\315t\031"
+	.ascii	"r.\216\307\326\265\027En\314\222V\337\330d\377\272\214J0\rWS"
+	.ascii	"\032*z\n\261\313jHG\3267Z\355\033\247\366\215P\373\306\033\373"
+	.ascii	"\327P\256\243\374:LW3\324\n\276\352\2134\027Y\353'\035\256\241"
+	.ascii	"\260\230\032J\312\032\0036\331\336(c\337X\2643\225\265i7\260"
+	.ascii	"\311V3\211\026\241\203\312\372\305\253^\242\301\250\254^\246"
+	.ascii	"Z\3115\230\217\234X\2270^\232\332\345\026\231Q\375\222\346\245"
+	.ascii	"\273\334\267\255(vY\353\256\036\031'\036@\262>\031\326ki\306"
+	.ascii	"X\231\326b\257\360\304\220e\375\242\226>\242\263~AwI\326\264"
+	.ascii	"\221\353\254<\305\"\241s+\223\265.\242\261\366\324\310\207\205"
+	.ascii	"\306\232\236"
+	.string	"\245\245\271q\345\206\341\222e\352j\207\220(H\262~\361\307\236\302\320k\022tDO\331\252\026\242w\204\t\321<\264UU\212\231)\302\370\305\235\024m\025\204-*\262\ne\255\201\270jJ3\256d}\"\232\375\353*\266\252\177l\200\"\222\224\365\311h\252\377n\356\301\005\214\231\254\177Mu\355\343(nb#\353\251\037\035R[\222\254O\224\333=\364\216\f\365\263\005)\353\023\341\366\211U\366\211RtT\226\343\252\301$\353\023\227\344\320OlUC\365\356\216\201\n\325#\323\273\022\203\2501\322\317K\030\250\236\031\335\304\262-\031\343 :4\326\fX&U\322\324\265Z\027\351\033_\246L\032\207vb\253\272\351\272\251\207\247\203\210>\3078\346qf\332\244Y\350!b\0205Nj\301\370\304\031d\310 \203\340\320\216&\237\255\227\264\r\266\252o\350\032I\232\006\313\266D\215\223\210bPtu\327\033\332H#i"
+	.string	"\022\nQ&g\335T\250\312|\264\372\304#\373\3274\256g\274\030#\322%k\255\004\234\261\304V\226\365\211@\266\226q\266H\b\213\264\254O\324\261\317V?\247\217NW\245F\203+\353\023s\354\023\227\366\211J\373\035\350!\335B\277`\331\302@\254\321Yu\fM\304V\365\220\2061\324;\223\255X\266%\b\240\201\261\022\255\210 \341j\365\211B[\033\tj\202%k-\244]\304\303!]\223\331U\326\037\246\331\037\226\331\037\212\321?\032\210\255\352 \355\203\201\032\307OtP\017\215\2165"
+	.string	"\t\211p2c\335\322A\2753\331*h%\204\256\356\032\307T\f\031d\360\3231\305\213\252\325\037\206\355_\307y6\204\240\234\241\306V\226\266"
+	.ascii	"\311:M\357.\016FL\227\365\207_\373\303#\373\303\351\376\260\307"
+	.ascii	"\376\020\307\266\353\225i\022\325\225\225\365\207Hv\303\027\373"
+	.ascii	"C\026\373\302\274}\241\335\276\320m_x\266/|\262\347\2122\232"
+	.ascii	"\232\be}\241\221\375\016\264\364\266\364\276\216\266\223\036"
+	.ascii	"A\254\275\270\336\027\266\332\223\353q\t\223\353\275\365\274"
+	.ascii	"\260la\361\217\f\003\220\t\323\2465tr\305\243\321\352.=\270b"
+	.ascii	"\f .\252\356\272\320\355\007\257\264\365\334r\322\022*(mL\366"
+	.ascii	"\203D\260\364\326X7;3/t`\271q\245\207\326\243F\271\322\226\365"
+	.ascii	"\203CW\202\361f\201v\373@\270}`\332>0lc`m\332\003\263zc\232\006"
+	.ascii	"\226\035A\262>p\272\017\214\352=)\262\005\251\022%\353\003e\364"
+	.ascii	"\304\200-\302\330+\026^WY\337\255c\302V{MzJzMz`\275%,[X\034#"
+	.ascii	")\340\bR\2205\026G\032P\026\335[\362\367\250\275\257,G\346%\251"
+	.ascii	"H\326w\315\366\335\257}w\310\316O\254Mk\200'\250}\327\306\036"
+	.ascii	"RY\233\226=c\223\255~\302&[\226\214M\266w\2116\222\312&\333\314"
+	.ascii	"\326#2$\214*E(k!Z\256pX\311\372.\320\236\366\254Z-0@GY\177\337"
+	.ascii	"\355\357/\273\252\367\203\n\214\222&\265\254\277\325\252\250"
+	.ascii	"t\325\306\224\324\311\274G\345k\273\n\342$\353o*\333w\324\265"
+	.ascii	"\277\247\333\267o\354\366\210M\266P\031\3342\256'D\262\376n\261"
+	.ascii	"{N=\031=\034,[\230F\313\322s\3525\365bb\0205\366!\022\305yX\327"
+	.ascii	"\034\275'\266\332s\3521e\350\3415\311\001\327\352\377\256\354"
+	.ascii	"\377\226\354\033@\036DD\324\262\376\257\310>K\245W\243G\343c"
+	.ascii	"g_z5zJr=\033\275%\266\332\253\321\233qV\215\305\222A\006\030"
+	.ascii	"\332\027^\226\320\264\372?\"\373?\251\375_\323\376\257h\277\315"
+	.ascii	"\333\355\023\233l\337\312\355\267k\373w\304&\333\336\320\025"
+	.ascii	"YZ\227\254\337V\367\331j/\006\214:/b\330^\274\007\343t\302X\303"
+	.ascii	"p\352\b\234\227\254{@=\241\377n\217nI\032\\O\250\347\242\007"
+	.ascii	"\2054U&\353\026\275\273\037\240k\326o\267\366\177\266\332c\321"
+	.ascii	"\013\242\306q|\025F\224\224\365[\253}2\217\362\337\335B\252\274"
+	.ascii	"\300\312\372-\216\275c6\331\346\005u8\371\260\222\365[\241M\007"
+	.ascii	"\006\257C\230;9\2723uW\270/i\346\320\244\215\311rRBmqY\216\350"
+	.ascii	"\306\361O\3364_s\231l&\337\34539M&\223\321d<\266\232\355\262"
+	.ascii	"\230\347.\031\316.[\263\034\313\026\026o\360\004&++\216c\255"
+	.ascii	"\264\345\210T\215\276\317\313\276\257\312\276\217\312\276\217"
+	.ascii	"l\337\007e\337\347d\337\327d\337\007\266\357\373\332r\037\313"
+	.ascii	"Y\3028]\263\276\257k\337'd\267l\254M\373/l\262\335Gl\262\275"
+	.ascii	"\017j\337Wc\337\367b\357+k\323^\203\331\327h\031\313\357.\306"
+	.ascii	"\026-Y_'\311j\327I\236\206\275\037\032X\306\262\276\276\332\327"
+	.ascii	"=\366u"
+	.string	"\323\276\226\261\257\177\266k-\243\242\305z\214e\241\362\347\257\234$O\311\356\230\">\324\254\245l+\270\027c\366\377,\226\3072\224\034%?a\253\231,7y\016\313U*J\202|-\371\001\006d\312\344c1\\T\221e'\037#\006Q\343\037m\227,'\273k\034\307\030\204a\230\266\254\t\365{V6\373\304\332\2645l\262}\257\272\337k\262\337[\262\337S\262\337\373\332=6\326\246\205"
+	.ascii	"U\253\315\263JyyM\375\220T\221\n\353\342\022R\317\334\236d\275"
+	.ascii	"\205\301\227\204T"
+	.string	"v\226\365{@\266V\026\302\336\021\221\2501\322O,\356\317G2V6\222\2632\022\266\232\265\362\220|\305\"a\267\316Rc\241\2608\216\237u\024\241\373\232f+\242\2171\006\222\223\233f\252\252l\365\253\372bdwU\362w\370=|\220\265\362\216<E\364\241\306Fm\325\234\221\3355\216\251\031\024qT\261\232\022\352\367j\354?\023\371] \22626\246Y\277w\264\237\317\354\347/\373Y\313\316?2\020\266jA\016B-\016\323\034I\203\227\365\363\225}\326\202\226\315c-h\237\305\366\006\326\246\315S9\367\310>\236\2472\217{\370\340\302\240x+\216\251yJ\307\361\017\313\016\200\310\262\003\360\231\001\371Q\322\352\347%\373\371j\207\300\332\264\177\226\262\240H\245A\244#\nJ\210zd\203\254\236$\311:\347\310O\317P\331\351\036>x\317'I\274\025\307q\206\362\340)\216\1772T\361L\034\377\024Yv"
+	.string	",;"
+	.ascii	"\255%e\345\244\325\317V\373\317M\031~F\244\344\340\301\304N\311"
+	.ascii	"VEVdp\334\b\336\021\331\262D%2\251\021f\305\006\006;\210\212"
+	.ascii	"\330\326\322\206\341\335\033PV\r\032D\261\270)\264\2543\215?"
+	.ascii	"+\345\0319I\250\215\364x\301$k\226\312"
+	.string	"\332\264\030\262\214$`\226\032\216*Y\3779\t\251'4\364\024\207\3051\3658\314\"DI]\326\371\b\203\0136\245\243(\353g\034\273+\212W\233\033\220.0\366I\\\345\344+\216\212\225\233c\273\210M\245e\037v\215\325B\3741\306ArA\246p\331\207\365\302>!\376T\261_\177\20718\312\314\330)\304 c\034T\2655\245\263\262az_G%T9Y;<\373\260d\330\273\336\327\321n\"f\203\245R\3274\215\343X-\373\260b\3300\304 c\034W1M\251\374\254\334\027\037?\233&\023e\243\354\"\307\031F.b\363\362\213<\224\177r\214\334\"\007e\240,\224Y\260\325\354\303\2329\213\307\236\271\246\306q\320\326\317\226U\331.\304\220X\343\230\372\016~\266-\373\260[\330.=*\231\353\242\352\2075\216\343\263\\?\333\365\354\303\242a\321zT\2628\b\210K\007nh\306\274\256qL\315"
+	.string	"C\006\031d\320\003\332\202\227d"
+	.string	"}6n\357\241*\233\265c\313\260\325\r\354\225Zt\337\3044\205e}\026\312>\273\241-nh\317\206\355\263]\373\354\325>K\265\303\374,\030\226\n;%\013\311\316\264\240\221\365\331\247-d\223\355\0054\366Y\242\315\001\233l\317\262\330G\301>\365\355l\2270\242\214%Y7\262f\271t8\373\006\201*\035ZY\367\330d{\025\373\321}2\266\263Z~V\215\305\362$\216\343\013E2>aoY\263Y:\234e\013"
+	.string	"\0243)Y\377\330d{\347fc\326\2465&[\326\n{\306V1`\257P\213\271\nMUI\326g\356\263\030\264\275\274<\026\203\366\034\330\027\261oe\223\355\331X\233\226\035c\311\330\352\315X)g\241\260_w\203\2501\230\017+>>\262\276\b[E\034\3071{\263\366\227\227\227\227\307\336\254}\003\266f\223\355\317.9\373\344g\223\260JX1\366)\216\203\3428\276\360K*\373\232\2225\313\204m\302V3\260N\316z\261\324\373~\25015\216\343\"[7\005\204\224\365;\354\263a\277\371\211?\270\273Q\020\307l\206\226\315\313c3\264\254W\207\263K~\026\t\273\225l\217\226\250qX\034\307\305\036Y\225\026g\262~\336\034\2606m\313&\333\013X\233\326\310\332\264\231M\266l\314&\333\223\2616\355\251\254M\273\331d\333\013.\341\342\020\020\200\037\211\301\257\307"
+	.string	"X\204\210\024@\333\026\004\372\201\313?x\202\366\314\365\241\265XL\374\372+b\0204\301\377k\177\300\003\374\310\337\317b\300\372\240\002^\303\374Z\330a6\021\347w\301\346\327\022\376\240\t\rcop\205=\002G\b\252\370\201=\200%H\261\277\244m\fo\307\261\2775\223\177d\360\377\305\365\224Rv\323\375\340Z\"H\202?\bm~\303\217\314\371\335\016\177P\347w9\374?)!h\272\032\374,\207\r`\330\200\201]\246\027\002\340\bH\360\003\243\1770\307\r\002\341\037\034\360\371\033*\312!\265\243\204\237\220_\303\350\n\236X\376.\001\202/\020\305\257M E\305\017\224\301\372`\251.p\253\327\020\304\271\340?\316\217\024\341\337\304"
+	.string	"\\\377\310\b\274i \t@\235?h\342\337`z\301%\006E\220\310\003\264)\360\351\005\227\377\346\321\376"
+	.ascii	"\337\377\327\006Wp]\367\027T\272\301\377\t\370\221\027\256\004"
+	.ascii	"C\260\217\004A\200\363\273V\275\235_\253v<r\205\366\007?\360"
+	.ascii	"\267i\177\320\003\177\313\366\007;\360\267m\377\257\335\\\377"
+	.ascii	"\356\372\203\034\370[.\305V\212\326\261\207\365\301R\355&@\034"
+	.ascii	"\033\370Y\343V\022\324@\206}\365\0073\020,\361\267Kz:-\223^\263"
+	.ascii	"\2273\307\266a\033\255\310\377\013\023$\361\367tzM\227GP\205"
+	.ascii	"\036\264\307\363{\353\3458\377\215\341\007\027\267\211\256\225"
+	.ascii	";\375\203\030`%\360kq#\340\0320\b\216\370\203(\374A\023\222\237"
+	.ascii	"\300ot\273\374,\225\227_\001\346\260\340\377\025\217\200\337"
+	.ascii	"\374G(\026`\007\340\376\264\200\002\330#\313\375\017\200\037"
+	.ascii	"\231\f\212@\022\306"
+	.string	"\265\340\007\212\370\203!\376\266\256\353\367\277\346G\026\177\227m\353Z3\244\317-k\227\374-\223\277\025\373\203%H\001\207A\022\376\226\307\037\254@\253\243\335\361\344\017~\370\333 \177\353\344\017\216\360\267E\376\026\353o\253\177P\204\026I\013\345\017R\340o\311\332\262\377(\230\275\001\377\221\205\3377\374[\235?8\201\226\371\267\316\277\335\371[\t\374-\364o\031\360\007%\3206\377\366\375[\026\376`\004Z\023\177K\202\277\005\300\337\022`;\375;\307\037\204\200\316\362\353\261_\227\375\372\354\327l\177\360\001\277\357\314\337j\370\333\374\007\035\320V\360\2675\377\276\361o\034\177\260\001\276(\377\246\021\f\341\3675\371wR\220\001\277/\352\337EA\020~_\213\337'\364o\030\377\216\361\007?\370}!~_\005~\237\006~_\211\337g\302\357\353\300\037\364\300\267\201\337\347\201\337\007\202\337G\342\367\211\370w\213`\007\277o"
+	.string	"\277O"
+	.string	"\377\376\tz\370\365"
+	.ascii	"~M\374\375=/\177\257\314\2571\370{y\277\356\375\275\262_k\360"
+	.ascii	"\367\276\374:\371\353\013\177\260\203.\300\257\331_\023\340\327"
+	.ascii	"\373\357\321\375\275\353\257\215Z\001\177\317\372\367\266\374"
+	.ascii	"=\267\277\007\346\327\302?\310A/\356\357\221\321\b\370u\006\277"
+	.ascii	"\256\340\327\032\376\336\230\277\267\364\367\246\374=\263\277"
+	.ascii	"G\305G\374\203\033\374\276\343\357+\376\276\232?\310\301g\374"
+	.ascii	"}\302\337\347\376>\233\177\237\340\337(\b.\340\367a\310f\232"
+	.ascii	"\314\257\307l\024A\005h\021\374\032\205_c@\317\375\332\032\324"
+	.ascii	"\340\327a\362\265\347"
+	.string	"\376=\237\333\345w\341\376`\006\277\326\362k.\377v\006\023\360\263\034z\036h\356\234\340\206 \006\256\365oU\004\021\360\273c\376\340\001~\227\314\0374\300\357^\177\267L\260"
+	.string	"?_\220"
+	.string	"\277\353\366\007\007\360\377J\270[\376\340\005\277\352\247\017\004\005\360\273y?\360\1770"
+	.string	"\233\003-\004\376\366\203\th\023\037\bZ\360\007o\376 \362\007.\265)v\t\005\374F\037\177\360\270\031\0204\352\236?X\374\335\262\3375\373\203D\r#\005\227\314\225\362\007\207\277+\366\273O\202\302\337]\013\006M\b\002\177\355\363\353\023\374\032h[\340\027~\273\252M|\340R\200K?\342\237!>\374F\244_\303\177\320\375\265\216\373\365\273I\376\340\376u\364\327)~\276\035\201\340\357\337\016\320&\264\212\013X\016F\022\374\254\333+\341\266\350a\340\377U\203\255+\024\364\271,~7\306\037\324\275\f="
+	.string	"\374\316\2705~w\351\017\366\\\034\277\313\364\007\363\317\002{7=\344\377k\022d{\303\353\357$\017\230\346\317]?;\202\377\247\004\210\206E\2015\201=\341\277\224\013\374,\006~V\005\226\204\206\017\240\360K\376\352\212\\\3766\005\177\353\323\336\370\333\031\255\321\337\026\265+\332#\034\177+\343ok\374,\207\r\344\007\236\271\036\001K\273\352\277\207\377\270\001\037\355\317\377\313\001\342\375\300\266]\321\266\360\022\277\360\037O\370\177\365\340\007~\360\003A\370\201fB\370\20126\333\357^`\273\261\030\034\271\366\025X\342\377=\177`\006~\340\3356\363\263\022"
+	.string	"^\377]\346\b\306e\377_\t\376\326\f\210\205\264`\317\375,\325\217\213\f\026\003`\221\333\374\307+\312_\303"
+	.string	"\366p+`\200\373\363\273@?P\310\377\323\362\377\216\300\351\377\213\373\301\001\255X\b\260\030@qY\340\002\224\341\222\340w\243?\360\007\013\201\237\033\260\nH\005\354\341>\331\b<\303_\\\362\003\333\026.\204\237\375\340\377E\001\341g\031\360k\030\254\003\3327\353\006\373/\200\377\370\302\025\003\006"
+	.string	"\210"
+	.string	"\036\033Tp\301\245`\270\206\336\005)\377/\360\037\245\316&\005\334\361\003\023\360\377\252"
+	.string	"u"
+	.string	"="
+	.string	"\217?\020\371\003\245\200\033"
+	.string	"9\370\201Q\254f\215\030J\264^\376VnS\371\037\342?\366\370}\001\241~\324\347\375z\304\340\036"
+	.string	".U\360\n\376\242\225\223\334\001\362R\266\216\377\305\377(b\217\355'\300'\326e\207O\363\263\373g\203\377\321\374,\361g\205\377\305~\266\375\237\367\377\n0\307\317\262\300\233\037x\341\007:\375,\220\365\375\300\336\017\324?\260\211\355\261\371\007V\300\364\263\277\377\326\237\325?k\374w\223\037\b\374\2018~w\311\3572\371\2017~\326\307\017\334?Ku\345\036\370\377\201\377\032\2006\216\341\267[8\340\022\220\306\016;\"\375\373\002\240\322\377k\261\304\317}\3607*\335\013\374=\021\374=\017\374\304\200&\370\177\\\2002~\255\201\037\230\364k\020\374@\244\177g"
+	.string	"<\372]\"\356\325\0174\372{T~\226\303\337;\373u\376{W~\215\341\337\030\240\330\006"
+	.string	"\026\375n\006\277K\364\003\211\020\360\353\t\374\232\203_s\270\206="
+	.string	"\016~\343\007\340\320\235\177[\347f@v\360\377\306\2001\376\266\356wm~\026\203\377\355\217\324\340\377\r\375@\030\377\357\204\027\377/\004\241\037\377b\005A\377\257\305\377\373\371\177.\376\037\320\377\213Q\024\361\377\234\200.\376_\t4\376\337\322\377S\372\1776\376\337\f`\213#\377\342\004\376\035\001\255\363\353\346\277!\360\003}N\374\215'"
+	.string	"\262"
+	.string	"\236"
+	.string	"\030\364\377."
+	.string	"\002\242"
+	.ascii	"\370#\344\377a\375\277\253\3777\375\177E\376\337\220\377g\344"
+	.ascii	"\377\021\371\177H~\240\317\257e\374\327\360\027K\360o\023~`\374"
+	.ascii	"\377,\370\201)\370\177\031\374@\024\374\277\024~\340\t\376\336"
+	.ascii	"\320\177\3677\342\370]\002\374g\177d\t\177\017\004\177/\004\177"
+	.ascii	"O\004\177O\371\367<\360\273\024\370\337\376H\240\337]\341wq~"
+	.ascii	"\227\371\273\313\337\r\301\357*\177\327\304\357\236\3707\360"
+	.ascii	"w\233?\320\004\277k\302\357\202\340w?\360\273\"\374\300\022\374"
+	.ascii	"7\376\310\261\037\330\302\017T\361\003Q\374@\370\007F\177\340"
+	.ascii	"\363\007:\177\340\b~\240\316\017<\361\003\227?0\003?\360\002"
+	.ascii	"?P\304\017,\341\007~\370\201!\374@\020~\240\207\037\310\301\017"
+	.ascii	"L\300\017\304\340\007^\360\003\003\360\0035\374\300\013?\020"
+	.ascii	"\371\003\211?\020\370\003\367\017l\177\240\376\201\377]3\277"
+	.ascii	"{\375]2\277\033\346w\341~w\313\357f\371]\263\337\225\362\273"
+	.ascii	"P~\227\311\357&\371]\254\337\275\372\335\351\357\366\370]\246"
+	.ascii	"\337]\372\335\031\277K\364\2731~\367\305\357\266\370]\240\337"
+	.ascii	"\215\376\356\316\357\262\360\273\315\337\315\371]\021~\367\203"
+	.ascii	"\337\355\340w;\374.\207\337\325\340w7\374n\001~\367\202\337\r"
+	.ascii	"\300\357\"\1777\377.\361w+\370\335\f\277k\363\273\311\337-\376"
+	.ascii	"n\360w\335\337\375\375\256\357w{\377.\363o3\377\276\376\373\313"
+	.ascii	"\277\307\374;\314\277\301\374{\356\337^\376\375\366\357.\377"
+	.ascii	"v\3737\333\277\327\376\255\366o\264\177S\371\267\224\177\217"
+	.ascii	"\375\033\312\277\303\376\r\366\357\256\177k\375\273\310\277\201"
+	.ascii	"\374\273\352\337>\376\335\343\337<\376\255\343\3379\376\215\343"
+	.ascii	"\3375\376-\343\337F\377\216\361o\027\377\006\372w\n\376\275\342"
+	.ascii	"\337)\376-\3757\t\376\275\363\357\346\277s\376\215\363o\023\377"
+	.ascii	"^\341\337\"\3707\b\376\315\201\177k\340\337%\376\255\302\277"
+	.ascii	"S\370\367\t\377\266\300\277C\374[\002\377v\300\277C\370\367\006"
+	.ascii	"\377^\300\2775\3707\006\377>\300\277\007\360o\013\376]\301\277"
+	.ascii	"3\374\233\370o\341\277\201\377\336\377n\377\255\377\375\377\227"
+	.ascii	"\367\377\320\374\2773\377\017\357\377\231\371\177\327\377g\367"
+	.ascii	"\377\306\374\277\272\377\027\367\377\340\376\337\333\377s\373"
+	.ascii	"\177m\377/\355\377]\371\177V\376\237\224\277\035\363\377\306"
+	.ascii	"\376_\224\277}\373\333-\177K\366\377\240\374\277\234\277]\361"
+	.ascii	"\353\024\277.\301\257\177\376\036\364\3579\377\237\330\377+?"
+	.ascii	"k\374\317\366\377\252\177/\303\177'\377\337\376\236\315\377k"
+	.ascii	"\362\377\226\374?%\377Q\370Y\025~\026\203\237\205\300\177)\377"
+	.ascii	"\357\353\377Q\377\237\327\317f\370Y\233\377'\344\377!\371\177"
+	.ascii	"[\377\257\353\377q\375?\251\377\267\343\377\351\370\1775\376"
+	.ascii	"_\323\377s\372\177O\377/\307\377\033\372\177E\377\217\350\377"
+	.ascii	"\225\340\377\265\360\377R\374\277\347\377c\341\377\351\374?\234"
+	.ascii	"\377g\342\377\255\360\377\224\377/\004\377/\003\377\257\304\377"
+	.ascii	"S\341\377\245\360\377N\370\177\027\370\265\214\377'\342\377\225"
+	.ascii	"\360\377@\374?\n\374?\b\374\277\020\376\336\320\377\373\340\377"
+	.ascii	"y\370\177\034\376_\006\377o\303\377;\300\377#\300\377\273\340"
+	.ascii	"\377Y\360\3774\374\277\n\376_\206\377w\341\377\331\374\277\344"
+	.ascii	"\377;\376\277\342\377#\376?\340\177\r\377\257\177k\366\277\304"
+	.ascii	"\377\347\177\f~\366\202\377\347\376\032\306\377k\377\237\357"
+	.ascii	"\377\351\277M\363\267h\376\366\314\337\342\375\255\335\337\222"
+	.ascii	"\371[1\177k\375[0\177K\367\267_\3766\356o\341\376\266\313\337"
+	.ascii	"r\371[)\177\313\364\267@\177\333\302\237;\370[\025\177\013\377"
+	.ascii	"\255\364o\243\177[\200\277\r\300\357#\373}\325\337\307\343\367"
+	.ascii	"\r\375>\345\357;\300\357\303\360\3532\277\016\363\353\267_s\375"
+	.ascii	"\372\307\257\207~\035\343\327/~\035\364k\024\374Z\305\257\235"
+	.ascii	"\277f\376z\205_+\177\335\341\327\034~\275\301\337+\301\337"
+	.string	"\343\371{;\177o\205\277W\342\357\221\370{"
+	.string	"\370{\027\376\336\315\337\253\371{\304?_\371Y\022\377O\370\331\343\317N\340g%\360\263\021\370Y\002\374\354"
+	.ascii	"~V\303\177\022?[\301\317\002\340g1\374\354\205\237\275\371Y\344"
+	.ascii	"\317\222\340\177\332\377\006\344\345\345\345\375\007\320\277"
+	.ascii	"\004J\374hH\002p\303.;\240\232\274\310z+,\f\b\220\266\267\254"
+	.ascii	"\377\341\033\027\031b\244\260\262\336\342\023SF\214-\353\243"
+	.ascii	"p\266\207mC64\267\241\026\266:l\033f\031\266\r\251\f\327\210"
+	.ascii	"A\324\330'8v\305\310\356\232\0011O\n\313Z\253\217\202\330>\n"
+	.ascii	"E6\226\341\215'RQ\262>\n:\366\331/\264\341\331\360J\357\353\b"
+	.ascii	"\205%^\3268\216\321\206T\206U\304Xt\251\r\323\330\352\020mh\245"
+	.ascii	"(\204\t\017k\333Bm\331-\311\372(\344\330G\241h\007\321P\227\234"
+	.ascii	"\262\036\232\r\313\2004\200\200\342\254\177B\336\376\twS\244"
+	.ascii	"\330\315AEeM\226\301'\206\344\245,\353\237\260\345\311\020\312"
+	.ascii	"Pl\350d\030\205\255\016\307\206T\255\241\027\227 \3268\216\307"
+	.ascii	"\206NC\252\336\327\221\006v\034\371\032V{_G\256\f\026Z\326\341"
+	.ascii	"\330\260j(dG\2265\216\343\261\341"
+	.string	"\220\341\221\336\327\221\233\264\303*8\244\210\350J\250\303|H\224,\345\310\372',\331\357 I\216\351p\311\020\214l\006\326Y\026\223a\023\266:\\2T2Dc\275&\265\372'\034\331?\341\306\376\tD\373&\344\355\233\020\327\005V\3341\3152\312\372&\220m\261\325!\327\020\211\346b\311\260wx\323\237\324\022$(Z\337\004\254}\023\200\354,\327'.\315+\353\233\200\264\337A\333%\306tXdx\305\336\ra\r\215\260\325a\221!\221\266\351\r\255K\253o\202\213\375\013\310\355_\200mO\365o\352e%\227\365/\020\266\337\3010\310\020H\236uh\305V\207A\206?2\232X\034\235\326\277\300\327\376\005|\354_ \312\207\317\t\232*0Y\337\002ix\fw\f{\fu\260\325\341\3240\352\353\t8D\nk\006\326\331u85\314\321\301\324\020\212\235\242\341E\034G5\001\2473\260\316ztWab"
+	.ascii	"\365-\340d\337\002<\366-\320\264o\001\243}\021g\366Ex\331\377"
+	.ascii	"\260ih\303L\326\232U\326C\033C\030C\245\336\327\221\005\334\340"
+	.ascii	"\254.\344^x\261.\rk\fq\fi\fo\f\231\330\352\320\306p\306\320\306"
+	.ascii	"\220\305\\\213/\323\241\215\241P\234u(\205\206\255\213\250/\302"
+	.ascii	"\212\f\037bN\314\262\276\210\352\376?<\032\032\r\221\330\352"
+	.ascii	"0iH4\204\266U\304NQ\233\016\223\2061\260fT\235e\t\251l\3255m"
+	.ascii	"}\021A\366E<\355\213`\332\027\261\264/Bi_\304\320\276\210x?\204"
+	.ascii	"\230\375\020t\373!\272\354\177\030d\204\313\231\221\254\337A"
+	.ascii	"\032\241\031"
+	.string	"\261\264\351\320GxF\016\313t\3703\214\207@lu\350#\314\033\372\b\321\b\315\374\252\324\214\354Z\031]o?\266~\210\262\375\020b\373!\276\366C`\355_\210g\006\005\0300\350\262\026\232\311Oq\034fE\303\214\356\356\3123\206+\256\314\205\327\f\265\302\334\215.\252\254\205v\035.,C<\342\323\024$k\013\204d\204\\\3021B,\241\230:\244\233\031Z\326a|sbQ\252d\375\020Q\333\253\2100+oJ\345\2100\253\367u\264\247\270\245\261\262%\364\352}\035\3551%x\326\236\027\221%/z^WBT\204]\204<\204Bz_G*\354\210am#\262\3061\265\347%\354\"\034r\263\0350\326\356\342\204nB9\241\027\341\234\360\213\320*\004#\334\"|\023\322\t\271\b\341\330\252\260\2130\313\205lB-\327H\316X\273\b\277\204Xz_G)(1\323\263\322E\250\205\246\025\022v\021\356"
+	.ascii	".Q\3330'if4\350\207 \332\301-6\331\276\204\273\375\022\272l!"
+	.ascii	"\226\277gEH\025\252e_\0243T\232d\235\006\364\222\313\333\312"
+	.ascii	"\372%D\331W\204I\204a\275\257#\027\206\324\027\353\231\020\215"
+	.ascii	"\255\n\257\b\253\302+B'B+\032^\304\361\317\217\037Z\221\327\220"
+	.ascii	"\234\006F\024Z\253\253@\241\2222\222\365K\360\332V,sj_\326\254"
+	.ascii	"`\260L\351\306\254\255Y\353\260\342\252\254\321\t\245\b\307\204"
+	.ascii	"T\204e\302(\302)B3\341\023!\031[\025B\021\212}\t\241\3440\354"
+	.ascii	"\264\013\2135\216\343\340\022\231\020\\\215~\t\323\375\022\244"
+	.ascii	"\366K\200\261\233\350\ft\351\252\221\365IH\263\317~\321p2\025"
+	.ascii	"\202\365\224\274\034\201\311\0222\021.a\253B0\241\022\367\bT"
+	.ascii	"V\213V\237\204\272}\022\340\366I\320\262\335\230\265i\271\204"
+	.ascii	"]\276#u;\230\262>\ta\\$d\355\223\260c\237\204\243\375\n\214\021"
+	.ascii	"\032i\211\260b/Y\277\002U\204X\025\370\332\257\200\217\375\n"
+	.ascii	"\030\355\2038\263\247m\334\027\033\216\254\017\202m\237\335\352"
+	.ascii	"!\234Z\023\376\020R\001\021Z\t\203\b\253\330\252\360\207\320"
+	.ascii	"\307\017\037\324\3074\274\210\3433\034\277\330\265\021'U\003"
+	.ascii	"\250\017Bm\037\004u\037\204\326>\b\254}\020@\366AH\351\210\032"
+	.ascii	"\352\220\202\265\226\365;\020F\t\237\330;\244\006\\\225\332\230"
+	.ascii	"\256B)\266*\214\022Ba\030J=\275p\242\365?\330\355\177x\333\277"
+	.ascii	"0\007\327RWX\326lsT\334\270\270d\301r\275\242D\355\256\303\334"
+	.ascii	"\330\324\354\305\327\332O\211e[\202@\026\030k\22743_^\322\254"
+	.ascii	"g\331"
+	.string	"\nM^\320\2140\026\326\020\376\b\211\204I\302\033A<\241\222\320\206\020\207\220F0\215\320)xF\350#l\022\036\t\231\204@\302\031\302 \241\f\241\013a\2210\206pI($l!d!\034\022\032\t_\004\321\ba\260U!R\260\314\203\327\340\235\332\0268\256:'rW\254t\b\323#\023\373\322\201\020)H&h\3475\025S\235\322e\253(\32484+\030(Sk\217\354\211\025N\355\255J\236Z\233\234\265\f\306\224\241,tc\262U\230\020)\250\345\213\025M\210\024\244BC\251\253\255Q\r\363\302\002\272w\304\332\264\036\330d\373\017M\202v\331\352G$\257\250.\353\177\370\332\377`\265\377\241i\377C\322\376\ba\366G8\333\037\201\311\376\bT\373#4\355\217\220\264?B\213\375\021\342}\021\312\354\213@\267/\302\332\276\bL\366E\b\262/\002\216}\021~\366)`\267O\201\270}\n\240\355S"
+	.string	"l\237\002Y\373\024\340\261O\201\241\375\t\314\355O\300l\177\002\\\373\023x\332\237\200\213}\t\314\355K \313\276\004\306\366%@\335\227\300t\377A)A\262\236\330\030\327R0Jp\214\255\006\311\202P\250O\202dA\261\243\"\257!B$\\f0Z}\t@\355K \306~\004\356\366\037tRdk\n%\353\263J\214\\\265:"
+	.ascii	"\013n\305M\217\\\341}\005\275\202K\202I\202\324`5\330\025d\022"
+	.ascii	"\f\013*\t6a\253A\260 \027\222\255\"=\262 Xp*8\204e\233\322kh"
+	.ascii	"t`e\253;\260 \221\020vg\254`\301, ue\272\330\030kV\3020\350G"
+	.ascii	"\300\313~\004\256\354G@l?\002]\373\021\030\262\037\001\251\375"
+	.ascii	"\b\310\330\217@\320>\004\256\373\020\220\333\207\200\233\220"
+	.ascii	"\036\027\026,B\262>\004\244\354\377A\253`\020\266\032\234\006"
+	.ascii	"}<\370\203\212.8\005\266i-/-\0211cH\255>K\rV\005\201\004\251"
+	.ascii	"\330j\360\307\\\360\307\317\001\252\030\271a"
+	.string	"]3\210v\355\300\333\372\020\260\261\017\001\026\373\017\366\bB\325]I\362\311\372,\327\021\234uF\232\022\225\f,T\032=2\264`S\320)\310#\310\024\314\021\224\n\352\b\356\bF\005q\004\237\330j\020*h\343\301\033\331\354y\351LI\322\332\324\250G\346\245\250G\026g\rB\005\221\262\004\241\2025dP\265Qknv\0304\221M\266\177\200\230\375\007\274\355?\240\312\376\003\252\373\0178\262\377\200\251\375\007\334\330\177\200\320\276\003\356\366\0350\267\357"
+	.string	"\266}\007L\331\177\220HL\330\226\242\254\317R\t\302"
+	.string	"j\001\326\365\250d;\212\024\223\025\006PL\020HJ\001D\206\210)\273\006\207\2021\202BA\027\301\027l5\b#\330\"\007a\004Y\020\371\021Sv\365m!\022%\246\354\032\204\021\f\352 ILYV\034S\207SW\240L\021\352;`k\337\001B\366\035\240#\370\023\346\244\305\223V\326w@Q^0f\253A\037\340\2306\266\013\3136\025B+\315\032\364\001r\001\246a\331\246B\244Q\263\352\"d\274\310\264\032M\026\302\270re\375\006\214\301\003\336\001\315"
+	.string	"\257l\025x\006h\027\246\244\314\3304\216\3433P\246d\242"
+	.string	"\317"
+	.string	"\337X\261\017\226\214\202\250\025_D9\205\001\3527\340k\277\001;\366\033"
+	.string	"\265\337\200\030\373\r"
+	.string	"\n\223A\230\366\346$\316\372!\200\331\377\201`\200tl\025h\005n\341\002\234\353Q\311\366\230T\f+\320\nl\003\272I\301\230\306q\234!\203\f\200uT7Z\375\005\303\260\307S\221\034Y?\004+\373,\025\216\025K3\005\312\001\275\260U`\034\260K\007q\3007V\214e\233\212\265\321\0241eY\275;0,\326V?\004)\373!p\355\207\220\265\037\202\220\375\020\232\200n\277\020\224\301\346\305F\326\017\301\306~\bl@5\267:9$Y\323\365\370a\204\025\333q\306\3125\227\005x\005H\006\\\002\004\003\216\001\237"
+	.string	"\245"
+	.string	"\323\200g@1`\0300\n\020\rX\006\254\002\\\0032\001\232\001\253@+@(@,\300&\300)@'@*l\025\250\006\374:0\tP\311\263\225\r\353\325\024\025\327\224E[\232n!\271Z\261v\240\241r\304\214\265H\007\324,=\2638k\220&8|L\321\375h\262\252\021\211\261Eg\005\302d\025\322\244\310\352\005\247u\2476\204\025s1\324%g\315\302\263\002\325\200T=rX\351\200j\300*1l\030\254^\\\335\205\2403\031k\323f\300&\3333\340n\237\001g\373\f`\262\317"
+	.string	"\255}\006P\3553\300\306>\003\202\366A\220\333\007\241\312>\b\\\373 "
+	.string	"\331\007!\307>\bD\373\037\230\331\377"
+	.string	"n\377\003\263\375\017\270\366?\360\261\377\301\214\375\017\202\366=\370\262\357\001\333\276\007c\373\036 \331\367\240j\337\003\245}\017Z\354\037\310\003\270#\270\004I\025\027\240\016\240\024\020\n\030\005|b\253\300\035\300\034w[d\252\033y\312\006P\253\310k\310\025G\023\227\033L\300\035@\247l\005\034R\3445$\203\237\023\254.PB\375\016\252\354w"
+	.string	"e\277\003\352~\007A\366;\260\261\337A\320\376\2016\200KItx\t\222u\215 P\026\247\247\254\357\301\272\337\001\213\237\237\rb/\216\177\346\246g\360\2001\200C@#\240\022\360\005\020\tH\004L\002\036\001g"
+	.string	"\213\2000\2004\330*P\006\260\305\201.\200B1\030k\007\240\f7\rP\006\320\347g\203e[\322Z@\031\256\031\027\217e\233\322[g\254@n\336\035\032\253\032P\306/\306\217\210e[\322Wi\254q\034\003\203\2002\\4\331jL\021\026V\3260\f\323\226\037\032t>bmZ\002\260\311\366\036\214\354{\260\332\367\300c\337\003\216}\0172\366=\f\355{h\261\337\341\314~\207\271\375\016W\366;$\331.\036\213\306\026\307"
+	.ascii	"1\363#\353w0\262\337\301j\377\356\325-3\215\307\330\\;\227\f"
+	.ascii	"[u\313\270c\262+\206\025\2731-\323\023\303\212\r)\242\232\222"
+	.ascii	"\365\201\264/w\255>\007\327}\016\302\324\205\361\261\330\252"
+	.ascii	"\203\313\332\352\306\240\201\207&\353sp\266\377\001\334\326"
+	.string	"\324\013\222/.\030\227\216\255\272sn\\P\007w\316\2253S$5\346\352\004\013\002\265\3659\330\261\317\301\320>\007?\373\033\214\351\342\026${\013\263\226\344:\245\232\261\272\271^x[\\.n\233\373\346\262\271Z\330\252\353\346b\271\273\346fQ\362u\347\272\371\326\\5\226mJ\253\321\251\271n\256\022\227\212\322U\017\242f\331X\233V\003\233l\277\301\333N#\326=yb\222\36570\333`^\234\250-\201\233\272R\\&n\023b/\216ud\351M\021K\233>A\253b\031\223\342\206\255Y\251\270h\356\231k\305\235\342\226\271W\334*\256\231K\306V])n\224L\215\343 W\212\013e\b\021\336\231k\034SK\270z+s\243\277A\217\375\rh\354o\360b\237\303u\237\303\333>\007+\373\034\252\373\034\214l\267\t\331\nq\034\266\0244D#\353s\230\356s\260\261\317\341\305\376\002\352\366\027\360\266\277"
+	.string	"\264\375\005\214\355/\200\272\177\267\313\305b\242VC\210\r\242)\216 9\254C\214\254.\226{\025\303\352b\271VZDrLYZ\256\021\027\211\313\345\036q\267\334,\266\352b\271E\276\271\260\\=;\257)V\243\376\002n\354/`\306\376\002\214\366\027\020c\177\001,\366\025\200f_\001d\366\025@\267\177\327\245\312K\313\023\222\365;\300\0217\235q\235\272On\224+\345\352pw\2709\334*w\312\365\341\366py\270P\356\017\266\352R\271Lw\233\\\247\2635\350\2464\300,\315Mm|I2c\206\2047=:35B\323\341\206\234\232K\345\026\245\261v\270K\345\312p\225X\266\2458FJ@\035\321[\031[\367\006TE\203f\217X\233\026\311&\333+@\311\276\002\210\354+"
+	.string	"j_\0014\366\025\320b_\003\353\276\006m\373\032\210m%\250\025\204\202\242\256\262\276\006H\3665\270\332\327"
+	.ascii	"j_\203\030\373\031\334\355g\320\266\177\227\b\203\334\031,kC"
+	.ascii	"n\f\030\\c\306\262\246\n\215\214\252\236`\270/\\#JpY\\\027w_"
+	.ascii	"\374\254\234+\264\335\206.\240\374\004e\335\213Y\233\326m\321"
+	.ascii	"\341\256\213\036\034\222\224\031Y\373\\\026.\020\327\225*^Y\237"
+	.ascii	"\375\212\367\031\226-\254\002s7\334 \367\207\255\272@w\201\\"
+	.ascii	"\037\366\016\n\f\253\\\225ZV\253\237A\225\375\f\312\366\277\363"
+	.ascii	"\366\231-6|\310\310\032\357f@\226\254\373\3146\003\204b\303\310"
+	.ascii	"\016\315N\303V\367\231\203\005\327\222h][\375\f\252\373\031x"
+	.ascii	"\355\177\337\355+\2214@I\262.C}r\315Q\346\"\353g\260c\237\335"
+	.ascii	"\242\023\262\306q\334a\314\266\356\272\030\326Mf\333m1lu\217"
+	.ascii	"\331`\366\230\r\267\335\322L\343\230\232A\006\0302\330sH\200"
+	.ascii	"\\l\275\353~\017\037l\231\305uiYw\350\360\035\206\365\302\373"
+	.ascii	"\262\222\3653\200\332\317\300\305~\002\256s_`\264\221\345\310"
+	.ascii	"z\177\371\226\023j*vh\222l/;\216\255n\271o\271\r\267\335Bhq\344"
+	.ascii	"\302\360\261d\335r\273\213\017\033FvW\"\016\031bW\255~\002\304"
+	.ascii	"\354' no.\035\276\337\204\360\264\262\006\356-np\323&\265\355"
+	.ascii	"\266\333\220(\361\370A\335\212\343\270\350J\301+2C\013\225mG"
+	.ascii	"!\036\321b\202W\205\2336\211S\262\227"
+	.string	"\234\021\005\311\272\036\021\262j)r\203(H\326U\255\313z\225\255\230\210\202de1\321\222\263\252\355(\333k'I\300\232\026\326\022Q\220\254+\027kG\024$+k\353"
+	.string	"\327\016\234t\021\005\311\272\252\031\211A%+[i"
+	.ascii	"\212c\247\246V\211(H\326uG\331a\r\230B\024$\353\272\241\354+"
+	.ascii	";m\233m)\233l\253\355*\373\311\246\262\3136\332\266\262\261\354"
+	.ascii	"\263\275\266\307v\226=\205\255\356([\214\210\321tG\331H>0C\024"
+	.ascii	"$\353\032\307T!\016-+b6\350'`k?\001>\366\023@c\177C\336\376\006"
+	.ascii	".\373\033\254\b\331`C\266\032^\234d\375\rI\3667X\355/\226h\314"
+	.ascii	"\016\254\254\277\341\306\246np\261\217A\231}\f\274\354cP\266"
+	.ascii	"\217\201\221}\f\246\3661P\332G@\232}\004x\331G@\332>\002\300"
+	.ascii	"\366\021\360c\037\0018\366\277\207\bQ\202\246\365\223\365\026"
+	.ascii	"2\265\362u9\262\345E\326\377\266\3326\354\330\360\232d\315e\303"
+	.ascii	"J\367\304\r\f\\\026\027':(nt]>i\312^\314u\001\235\351\200\005"
+	.ascii	"\256\213\305\335T\210N\016\f\206\265*e\206\316\311\335t\313H"
+	.ascii	"\016k\213k\331\214,V8\254)k\r,S\032ki?\034\\\322\332~h\375\272"
+	.ascii	"l\030\2772\233j\307{j\007m\036\373i\327\330;\266\217\237\231"
+	.ascii	"\337\365G\267\213v\216\315\264\233~d6\216-\3437\367{\373\211"
+	.ascii	"\371\341\355\243\035\343g\367\223\333D\333\305n\261Yl\245_\333"
+	.ascii	"\036\3327~g6\322\017\314\357\356\227\367\033\263i\374\334~\326"
+	.ascii	"\355\264\241\366\217\375\342\347\345\007\367C\263\203\374\352"
+	.ascii	"\266\317\236\261\205~q{i\353\330?\277/\2774;iK\355\250m\264\201"
+	.ascii	"\354\252\r\364\013\363\343\262{\374\266\260\325m\343\227\345"
+	.ascii	"?\266\237\226\347/%1~.\270\200\311"
+	.string	"Z\210TqQ\213\254m>\270\246iLh\3230\274i\220\254i\032\024\024\253\330\265\354\350\247\304\002\316\272\243\332V\205d\032\365d\332\346u\021\202;\322\264\365Ed\345\0216m\353\3415\375\335\230\352\n\302\263v\3306~d?\264\036\225\254\004\240/K^\310y\031u\375\240\231\n\0012\245k\"\205\006n\353\006\220#iOQ\312\266\215_\214\037Q\217:%a\211\234\225m\233\006)+\212\353\212\363\3304)1k\332\266\361[\372\331 \372\030\343x\207\332\264\3557\204\313\217\254#\307\230\\\327\322TIZ\334\024\256\210\017k\233\025\027+\266\314\310KZ\323\025:&i\254:X8\231\262rI\206\254ZLS\270\037\022.8Z4?\333\325\246\351\362b\232\346tfU\363\262\226\305\312\302m\033\277+*k\034S\267\215\037\325\022W\351\213\214\215\275\2417\031k\323\2620\330d{\004\024\355\037 o\377"
+	.string	"t\373\007\310\262\177\200'\373\207\366\377\242\374\306~WX\245+S\242d}\326K\003#\nW\326?\300\222\375\377g\366+\373U\371Qa\253?+\277)\037,\251\262\376\254d%@X*\330\217\351\317Jf\342F\345d\227\345\363\261T\347\006\324?@\327f\241t\370O\212\326ag4$\353\037@k\263V\326\246\r"
+	.string	"\233l\177\200\251\375\003\034\355\037 h\337"
+	.string	"d\366\r\260e\337"
+	.string	"e\373\006\240\356\033\240\307\276\001j\354\033 \336/\200\334~\001\256\354\027\300\311~\001\216\354\027`j\277"
+	.string	"F\373\005\b\332'\300u\237"
+	.string	"n\373\004\030\333'"
+	.string	"\222}\002\354\330'\300\214}\002\300\330\037\300u\177"
+	.string	"^\366\007\200\266?"
+	.string	"\260\375\001\024\331\037\200\216\375\001 \355\017\200\305\376\005_\366/(\333\277 \311\376\005S\373\027\324\330\277\200\305\276"
+	.string	"\346\366\005\200\266/\200&\373\002\030\262/\200\246}\001\304\330\017"
+	.string	"\335~"
+	.string	"\252\354\007"
+	.string	"l?"
+	.string	";\366\003\220\264o\001\232}\013\274\354\237\2616,\227\336\224l\025\265\262\301$\353[\340\266o\301\331\276\005N\366-0\262\177H\277$\266\212\341'\243\r\250\210)\353[0\335)\210Y\f\355\363X\f\355-X\332\327\220\267\257\301n\377\277!\030-\232\f\265\002\325\f\031Y\262f\221t\370o\250\3506F&H\326\327\020\267]6\331^\003\226}\rM\3665P\3675\b\331\327\220c_\003\321~\005x\373\025|\331\257 m\277\202\260\375\n\262\366+\210\332\017;\203\327$\027\006\251\275k\315\264\327\266\f[m\361Z;01Uu?\254\037\214\221\322j\361Z2Edhi\311h1\005\250\017\200\273}"
+	.string	"\200\331\007@\332>"
+	.string	"\224\354\003\340*\214U\207*/\207\365g\341Z0\231k\005\037X\266de\255c\326\246m\347\330l\b\t\313\372\313\316\226\224\036Y\037"
+	.string	"Ppm\\\353\205\255\266r\355\226\267\\\332\267\256V\256m\033c\262\3061\025\217=\323\312\265n\031\251\367u\204\202\025\016\253\225V\256\355\322\003\323dd\227\225A\220G\234\023&[\037"
+	.string	"8\266\373\304\332\264\254\022\233l\017"
+	.string	"\241\375\fi\3663\214\331\177\253\345jHc\332\244\262>K\325-\320L\317\322L\255d+b/\216\235\362Z\265\266\212\224\020\226v\255\315\322\262\265il\265Uk\321\236[\265\366\312oLI\220\263k\034SY\032X9\264\b\3653(\331\317\200d?\303t?C\325~\206\250\315j\321\222\227$\326\226\265R\312L\001m\2655\261S\314L\331(\354\024\226-\f\204\326\235u\254\245\322Ni\311\330j+\245}\362\026J\033\245\225\342[k\3054"
+	.ascii	"\t\351\256\253\265\225\3222\261S\254\210P)\371x\220m\371\001"
+	.ascii	"\352\026\216M\266\307\200\347Dh\245\013\215O\326\307\020f\377"
+	.ascii	"o\273Zj\273\244M\322\202\265JZ\2576\254\375j\233\264L\330j[m"
+	.ascii	"\241\336:\2659\216\201\310Y\265-\342"
+	.string	"\303\215\207S\207\266\332bi)\037\240\017\251\030\316\007\226\251\334\264\235J\233\322\tA\263R\251\251\265\325\366\212\002[cV\270\247v\352l\215nHk\245\001H(D\225+m\2655\322r\211\341\341t\215c*\206\036R\222\352\021\f\032I\273\245\265\345h\211]\326\3070\004\211\326\260I\332\215\237#o\265\354Z\234q\222u\233\325\313\202\206\307O\326'\223\231\376\273\303\256i\227*Y\037\303\324>\006\250}\f2\3661\300\330\307\340\263\177\341\272\177\301\272\177\301K\033\204\035\302\3654#\353_Hk\201\264?6UTUU[\365\366\207\206\242*$\027\246\354_p\322\366\020\306\020:s\227\365/ iy\264;\256\310H\311\312\272\335\221\305\314\365\240k\245\200vISw\255T\033\305\312i\331rm\243Z\250&??@Y\377\202\220\375\013T\333Gem\332\237\261\311\366\027n\354_ \332\177\213\243\275\261"
+	.ascii	"*@xd\335\336\370Y\272\326\306\307Z.7\236\360\310:\307\355\022"
+	.ascii	"\333\005\305\322RW\215\226\206\213\034`Y\262ni|,\357\027d\320"
+	.ascii	"\230ig\264I]X\224<\311\372,\2256\251=R\233\266I,\230\006C\312"
+	.ascii	"te\265J\255\f\266\332&\265HC.\244\263/\255\376\215\227\375\033"
+	.ascii	"\263\375\267F\355\020\226\033\f\242\254\333!\326K\226k\347\332"
+	.ascii	"\304\224\265C\2764 ub\312\256DmQ\033\243\205\301V\333\241\326"
+	.ascii	"\305[\241\366\205\225v\310\027\307Os\3238\246\266C\276\265\266"
+	.ascii	"\205\317\017J\0221e\3278\216\335\035O\332\242\200:\030\2636-"
+	.ascii	";e\223\355o~\354\226\005\320]\220k\326\277\221\332e"
+	.string	"W\257)i\\zYz_G[\f\350jM\342\033\0237\355\261\365\350~\2446p\325\265e\250\r^C\214(]\257>2\\IF\224\256i\327^\225<5\201$#J>\267\237M\273\372\266D\031Q\272^{c\264T\b-\216, \365\345\212\244\316\210\022\233\226\305\247\205e[\212\177|<\360JbD\351z\365ua\321\224\314Y\333 \237\2316\366\241\361\245i\201Z\037\237\235\357\316w\306W\246\375\361\345\371\360\330\252\357\352\203\273O\315\207\345\030\266\256z\313\007F\211\234\225m\273\372\336\330',\333\024W\033Q\t\023Y\227"
+	.string	"\350\337,\371\304"
+	.ascii	"\341\302T\226\365o\200|u\2760\331-,\206\363Y\357\013\323\306"
+	.ascii	"\371T1\343\243#\236\241!\305*\353\333\320\371\346|_2\224\253"
+	.ascii	"\027O|r\367}\021\232Q[S\312\372d|q\377]\342[\327\030\225\254"
+	.ascii	"\177_\234\317\013\221\250-\216\362y\361\301\271vph\220d}\033"
+	.ascii	".\3736k\3736V\366m\242\354\333|\355\303\2616\355m\256\366\357"
+	.ascii	"c\273O\313\263\325\n\361\205#\332Q\216\254=t\270\217\255\315"
+	.ascii	"*\203\272\313\3726@\366m|lw\311h\377>4\246,sa\262f\343\210X\363"
+	.ascii	"\260\256EG=\"%gS\237\037$\323<\254\353\326\225\222&k\207$D\330"
+	.ascii	"\362\260\256l\323<,\237\025\020\353\016\036\325\374\226\275P"
+	.ascii	"\363\260\256>,\026\r\b\307\264\203\257\b{G\f\242\306H\035P\333"
+	.ascii	"\270\260h\023\210\363\260\262\250\234=\311\371\246E\246tB\236"
+	.ascii	"\212\214z\361\005H\216\362\260\264\270y=\345a\355\350\021\347"
+	.ascii	"*I\362\025)GyX\327\266-^G\275\253\373\222\364\214\370\202\204"
+	.ascii	"\320\342\310\002J\254\254AzD.0\362\224\207"
+	.string	"u\315\342E\315\303\272\372\266|P|M|H|Z>%\2762_\325\307\304\027\305'\305g\305\347\304w\346\373\362u\371\246\370\302|T\037\230o\211\217\212\357\211O\314\307\345\363\362]\361\231\371\252\370\306|dl\325\227\304g\344\276,\337\221\036\222/I/\251\027\325\373:BA\n\212u\312G\017H\224\007F\310\362\260X\265$>\"E\342<\254kO*IOG\217h\303\021j\036\326\225\3167\344\203\243<\254\254lf\205K\3214WI\222\321\262\325\016!k\256\342K\222\323\362\232\007^dyX\3278\246\3566+\r-\n\350Wc\326\246um\204\366k\360\366k\276\354\327`\331\257)\333\257\t\333\257\351\332\257\341\261_sc\003\321VIuH\262~\r\321>\273\345\253\362\035\371|\364\276\216.\340Fd\375\341\243b\253\276*\237\321{EzX\276\252\036\227\257(\204\026G%\270\rY\3438\316"
+	.string	"C\006E!&\031I\255\236B\3532\324\224\365\223x\333\247\303'\305N\221\022\322\341C\362=\261laZ+\317\352\323\341\203b\313\303\312\352\341\343\341\333\301V}:|Q\357\035\351ie\200\201"
+	.string	"dS\352\326O\312\355'\257\354'\315\266\357\311\227#?\245y-\221e\355t\006H\214\220\254\237\204\262\337\301\f\034dJ\037\353}\035\335\300p\213Q\343f\275\257\243\315Dj\310\272%\003\t\231\017\207o\311w\303\307\344kb\253>\033>\032>\033\276\244\217\261"
+	.ascii	"S\200\020!?\247\26632\241~\262\272\237\374\332Oj\355'\211\354"
+	.ascii	"'\177\354'w\354'\241\366\2233\366\223B[\b\t\314\266\224e\035"
+	.ascii	"\206\r\343\201\221(#J\327^W\022\233\326\253\313rF~\312\242\250"
+	.ascii	"V\324zY\214\264}\365\244$1\242tM\023\3631\026_\n(RG\025\245G"
+	.ascii	"\326D\n\312\007fy\252G\235\376\230HU{S\250\270\211M\265\235o"
+	.ascii	"H\243\321W\337\217\257\205O\310\027\344\203\341c\341\363\321"
+	.ascii	"d|/\364\030}F\347\371\210\264\031_\f\237\013-F\227\361\305\032"
+	.ascii	"O\247\321wl\325\007\324\263z\017Io\353\001Q;\324^\243\3455l\036"
+	.ascii	">\370\334\223\007\023&Y\327d\251Y\253\301R\223\366\271L4\245"
+	.ascii	"HS\3265hg(`@\201Rc\226\343G\346\004\246\354\252\261<I\2011\366"
+	.ascii	"\032\263\232\2622\240)5e5T\316\212\322\252\262\236rC\254\354"
+	.ascii	"J\326\357\341\262k\244\324\220\t\235v\334\350\222\365{\316vM"
+	.ascii	"\024\026mK\227\255)\"\030!\024-L\240d\375\036%5b5b\3057\2331"
+	.ascii	"\3051iz\2465\325\232*\322\351\206S\234\365\372\")\251L\326\357"
+	.ascii	"\211k\226\324,\251i\002\234B#\210V\257\212\306\230[\r\223\327"
+	.ascii	"4)\002\025\371\001\345K\326\034\027\033Y\264^\263\245U\243\244"
+	.ascii	"\367\306R\343\245'\2370\r\300\013~\305\370\322R\343\365\032%"
+	.ascii	"\257I\342\341\203\317\355,\254\267\237\254k\276j\2505]\237\313"
+	.ascii	"WsCa\262\256\341\272\231p\251\313\265G\r\022\370\254&\253&\253"
+	.ascii	"\370Vs\204\210\226\323\265EP\216\254\0177q\203\270Aj\2600<\371"
+	.ascii	"\204I\300\221\223[\226\356a\206+\256\006\253\246\310\235\215"
+	.ascii	"'4Y\327\\\341\354hR\226\365a\251!Cj\222\222zQ\250\220\321\222"
+	.ascii	"\365\341\241\252\252\232\251\226a\\\324\2132\253\327Li\274\210"
+	.ascii	"\212\312\272&Hfz\203+\"$\353\032 STLXY\327\374H\343\303G\r\223"
+	.ascii	"\222\017\307\327\025\270\254/\355\022\025U\323\203M\022\033e"
+	.ascii	" L\2205\006\240\241\262R\303\3435=\350r\030\321\227.Y\327\354"
+	.ascii	"\310LDD\302@\311\272F\207\276B\023C&$\353\032\251+"
+	.string	"OO5Lb?\253\333\025\032.'\247\036\325\223,5\316`T\331\260Q\303\264UlQF\351\n\216\3270\t\323\200\226|\262\256\271\221\231\\\273!c\322H\217\224\224jjp\001\251B\214\346h\274\246\306n\262v%\222u\315\f}e%MJ\034\025SsTsT\2234\215\343\245\r[\253\352%\005\3515ItZ\016\013\231)Q\265\232\241\232\241\232\242(\323!S\306\234!zMQ\336\002\333BT\205\001\343\030\306&\211\215\340\2464hYyb[\204d\375\250\220\032\241\032\241\036\325\334\\\216\"\253\254\037u\252iQ\323\242G\305\252\325\350\302\312O|\334\370\312\372Q\0305?5?5Av\r\3301FL\326\177\r\320k\202\234\304K?\306\234\371\231\232\030\303\223O]\003\312\234\254\33211\265\252&N\346\025\341\305\215\345\245\331wL\276\202\302l0BVf\262N\242\021fy\361\365%\353\223"
+	.string	"\212\0313\311\353\221i\327\020\t\250e\312$\257c\234\252\226~Q\254g0\256yJ5\326\256Ib\304$\311\260Ib\243\237\022\221\034SV\217\005\\\032\2241O\222\321@+\t\214\004@q\217K\206\301\360\344C\246=#\222c2\013\212cb}2L\236\272\262R\204\224u\022\3140\357KV\321U\326'\223\244\373\357f\240\310\331\224$]rN\013\031)JY'\2770\245\221\t\311\372<\327\235\224s\213\344h\252\301\263%\371\226|K\302ax\362\t\263\241\316\211\007S\022)/\206$\273<\t\307\266\320\nKs\236!Z\264$\267`\260\2726b\f!\342\366\344\226\335\206dLS\326\311\266\355&U\205r\304c#i\345I\264\244\225d\226bX\016"
+	.ascii	"d\031B\271q\344)\355\311,O\256y\370\200hTd\026e\227u\022\313"
+	.ascii	"\211KX\246X\263~R\rHd\007\230\221\254\277\200\235\204\006\022"
+	.ascii	"\322\2253\236$*?\225\244\031\233$6b\253\324\350\302\312\"\216"
+	.ascii	"i2"
+	.ascii	"\343L\331\223f\177\231\2531T\207\246\031\033KJa\223\304F5kMi"
+	.ascii	"\320\314L\231\245!{R\212\231QZ\034W\326\337n[V]\326\262>\224"
+	.ascii	"IXX\022\212W;ua\030\361\322U}\022J\362\211\017\026<\322\262N"
+	.ascii	"\212\r\005\251B\223N\330)\255\227+(\027Y\037\352\002\f,\311$"
+	.ascii	"CY\215.,_\024 .A\226\260\325$\023$S\2505\254\376\273>)\273/c"
+	.ascii	"Y\377y\227\314z\022I2+\231\244x\005\274\373\255Eq\312Jr=\231"
+	.ascii	"\344\311\257_\325\013\214/Y'\251I\257dWrk\273\005},\241\262\264"
+	.ascii	"\335\212F\360b\274e\235\324J\036y\326\355$V\022+\r\006T\252\244"
+	.ascii	"\3212\344\037\222\274\302\360\344C\006xD\243n\214\326\213\267"
+	.ascii	"\034D\236\274\"\263\204\255\353\212\217'\253|$\247\255\227b\323"
+	.ascii	"\2225\031VOn\330[>\236td\235\374\221\f\222\323\244\321!%\b\220"
+	.ascii	"Lw\346\005\031\252\017L\222\032\020\252\252\323\223ON\311\036"
+	.ascii	"m\2318\006\342\200\n\004\027\013-m \326\341\020\203\302\343\311"
+	.ascii	"\036EATJ\262NF%w|\035U\333v$\257\336\310\264\240KJ\375\277\360"
+	.ascii	"\251\002\240S\r(kY\377\t\266\223P\033jx9\221J\346p\2478\355\210"
+	.ascii	"\312\372?'o8\246Dn\334H2ax\352y\301\341d\007\034r!e\006\307\223"
+	.ascii	"LcN\270\362\316\230j\3745\222Kl\222\330H\003\227\022-'\241\021"
+	.ascii	"\023\037Y\262N.}l\251\352(\353?c\030=)\303(9\343W\206\301G\022"
+	.ascii	"\257\211\316\356\032\0131m\310\341\221C-\251\364\344\214\253"
+	.ascii	"\345-!\213\372\030[$\312\021'Y'\223~]\270\244%\311:\211\344\303"
+	.ascii	"!C\356*\353?y\364\273\302)\265\265\272\254\277c\266\277\023\205"
+	.ascii	"\210\bY\205\341\311'\214\001\216\310\320rj\2154U9\243\306\210"
+	.ascii	"\221lq\343\247\325\243\2161R2%$\224|a\343wF\024$\313G\306\017"
+	.ascii	"$/\330),\272\246\216d\375\035\032I\026I\026\311\0267\202f\330"
+	.ascii	"-&wh\222-X\264\252\257\026PY\177\247h\314\221f\306$\201\212B"
+	.ascii	"l\034/\305@A\261\023S\213\324\324e\355\032\013-m\b\036\211\303"
+	.ascii	"*C\363$\320\223?\036>\270\331\023\270\351T\326I\237\263>\304"
+	.ascii	"0\021\312\372\310\274d\374\273\256\220/O\322d}'\230\215L\263"
+	.ascii	"\200&3Pg\220g\016F\210&\345\212#k$\336\360\311\327\024\023\362"
+	.ascii	"z\344\335\357\006\273\314Z\270e}g\227\215\264;\262\314\357\262"
+	.ascii	"<\212\330\332\262\276\263m\377H2"
+	.string	"\277+\f\363\203\006U\326wb\331wV\311U\271\nY\367^P\354\344\343\307\324\344f-\026\351@\003\252C\206Q[S[\313\032iMa\bV\234\365\235SH0ss\30576Il\024\354jj;\312\212\343\245\r\372\256\b\321Y\326w*!\345\344\212o\030\236|\310\004\311\232\332\216\256q\274\264\341w&\n\021]\326g\241\313\376\221^\220^\212O\2621\216\245\256d\361\321\222\006\354\323U\212+\353\263@E\311\221Nt\230\256\262U\244\022d\227\236\320R,#\0037$;\310\221\027Z\326o\327a\272z\f\277\237.oW\262>\013L\366\331-1$\224/Vd\0249\253\024$\025\226m\212\002XY\254\2753\310'\032\200\204Bl\305!\263 \315\220jQ\256Vd\026$\031\234\026$\027\344\026d\033r\r\311\206tc\253\310,\3102d\026\344\230\027k\034S\213c\2204\251a\324H\261\317i"
+	.string	"\022\n\321EgE\246!\261\260U\244\332\221j\232\007\022\255\001kMH\3122d0\254\333\002\207\243\325?\022\ry\345\t\265\207\230\254\221gK5\322Xd}\026x\354\037Y\205\255\"\255l2YR\360>g\205J\352i\237\005\031\0339%\336\\\254MkY\237\005\242}\026^\354\263\360\263?\0024\373#\270\356\037\t\005\371\004\fm\314\332\023,C@Y\177\004c6\262\t\262Z\324\"\343!\226\365\221a\377]\024\250\262\210e\255\231\3444\253)Q\326G.!\302\005\251~e}$\230X\336\030\033Y\023\303v\213\021\274a"
+	.ascii	"l\212\222\003G\326\037A\024#GR\221F\220_\371\213\352C\004\342"
+	.ascii	"b\322\200%\3622u\313\272\230\204\205S\214\254\221\\H/\227\312"
+	.ascii	"\220\033S\326GvM\265\001)\222ufo\326\"\221\034\271\365\273\277"
+	.ascii	"\255\243\240j\326\037Au\037y\004\251\365\273=4jT^d\375\021|\355"
+	.ascii	"#\263\376\273)\220\203:\2225\321\311n1\202!\030\270qI\346\252"
+	.ascii	"\262\376\bd\354\037Y\244\b{\247\223\304H\300\036^NvD&\027DxY"
+	.ascii	"\177\004>D\210\364\250v\206\032b\332\251\007\230\224\254\337"
+	.ascii	"\034\263\217\264b\221B\220B\212S45F\n\032y5\263\354\037\034{"
+	.ascii	"\263\026\b\020d\02025\220\344\033WAc\202\024\247\020M\251f\375"
+	.ascii	"f\023**dU~\342R\003\210\325\375\202\005\213J\225\225\027\244"
+	.ascii	",\256\254\337\034\262w\354@N\205\210mjL\341\314\360Q\326\343"
+	.ascii	"\310)\263\342\326\264\312%k$\217\346\215(\266\212\214BJ\001\335"
+	.ascii	"\262\354\266\025\330\210\360X\312\372\315\030OO\306\240|\005"
+	.ascii	"\311\312\032/-m \226\031\013c\224\365u\316 \233\220MH'7\001H"
+	.ascii	"\254\226\252\251\271\254\221N\354]\234\0216\253,8p\364\250\266"
+	.ascii	"\017\006)w\302\264\247&B\302j\324@\332@\306q\034O\177jB^X\335"
+	.ascii	"\033D\322TY:\322\306\347\206\325);\244\214\326\244\334\200\262"
+	.ascii	"\276\016\220\215\234\201\234Q|\013\021\263V`2\0254nkY_\247\006"
+	.ascii	"\022R\006\2221()\311\030\224\202"
+	.string	"8#\273\254xii\303P\013oH\230\254\257\343b?\307\212$B\032!\211zT\310\"dQ\217\312,\007\332\031\240\251\254\237\243e?G\f\031\003\031\303\030\364#G\b\362\005\362E\217\n\002wQ\2469H\027G\272\350Q]\020\307q\213X\305\230;-+\031$\013\266\212d1\304C\036\325\304ee\262X\343\243\026\032\374D\334\031$\320\031\344\017\0324\310\237\355\203\341\016\306\322\206`\213\260#lY\377H\237#\177\350|\210\221R\313\032\031\017\253\f\215mQ\313\013v1:b%\357\230\006\b\221//\310\366\024S\225F\326?qe\377\304\227\0313y\nC\354\023\206\0033\261\023Sv\307\253]\2312fPN,\355\237\360\331?\326\261\3071c\212d\354\321\026\023;c\025\263\317\026\311\3320\3070\354]U\032\265#\230#\030\"/o\021\271\343\234\334\227/T\220\274=\366\337\244\375\037\275\034\275"
+	.string	"I\303\345\330\205K\217\252\215c\226\372dt\024/\035m8\276\035\337zTl|\344\224e\037\347\310>\361\312\036\333\216Y\216n\354\235\216\303\342\237$\017\254\020\341X\355\343H\355\377\310vd\033\300\021\215\2721E;\254\246\252\254\217Scm\255\370\306\201\225!\034\027jj)\030\002cfvD\363ad\227u\345G\264\\C\356\t\354,\377\230\222vv\264\342\342\313\314\306\227\340\227\035H\200\034\253\264[\312z\360\310\222\365\231g\233\n\225\007\374`\206I\221\322\243\342Rc\002\031\033\313S\034\374\232\020qY\2313\366\177t\302V\217N\216P\210\324\226\374\b\345?\212\035\237d\244M\224\306IU\326"
+	.ascii	"xbm\332\236\0166\331\236\351\303\204\3111\354\203,#\273\254&"
+	.ascii	"?\206i7\2577\270"
+	.ascii	"0\373H=R\217`^`\216J~\004\353\201d\204uL\262\265\224TyqLr\374"
+	.ascii	"\362)Ai1#\3549#M\216\254o\242m"
+	.string	"\377\307-\266z\334:\026\307\260\034\273\376\236\327\221kH&\237=Ya\311\032h\202l\0331r\324:\301\027#\273\254#?j\t\203(Y\231e}\314b\357\334n\304u\311\372d\330\2735\2433f\262\276\t\254\243\325\321\352X\244\314\213\343\325\217E\360\270\234\211e}$2\254\"#\254KY\326's\034\362\337mu\370\b;\0169\n\361\221\304\025\223e\030J\001;\242;N\207\324\fz\016\007\224W\3267!\005\004H1\212\033\024\377h\005o\270/\336\200@\311\372&\230\252\252\214AV\234\230\360q\364\341ei\267\177a\032a\032\241\0317(\3261\005D\233QufGf\307\221\254y\360\350Q\3558\216}\250\261\321\006\250\214\354\262\226[\366\021\352\bu\324q\204\351(\365\243\016'>\256\340e}\214\272\331/mM*G\326'\243gHA\202%\353/\211\354\377\330tl:\346\b\361\364#c"
+	.ascii	"i\224\332\230\352\220X\361\311\372\350\244\333\037D\220de\375"
+	.ascii	"\245\324\376\262h\377G\033g\253G\033G\034\276\240\370\247\252"
+	.ascii	"uR\352*s\3021g#\353\343\r\237\330Q\032[\326_\002\355\257 f\377"
+	.ascii	"\307\031\307\031\307\032\275\240\370\311*H\003\350\025\346\224"
+	.ascii	"w\244\321\344\007\022.Y\177\205-\373+\220\355\377\210tD:\312"
+	.string	"\330\360\024\313\270@\310O\231\256\026\353\253\353F\326\307\244L\343\t/H\326_\201\272\277B\325\376\217Dg\253G\242\243QN\022\373\020\241P\241R2\002e\224\365\261\310\354\313\222\265\254\277\202\215\375\025~\366\177|q|q\214\261\341\351\207H\bD\352\304\224\245\341U\323\262>\302\310\254]\231.\246\254\257\374\262\257\224\262\377#\213\263\325#\213\243\213\rOq\222\007d\254yXM\254\342~d}l!\005%J\227\254\257\004\333W\016\331\377\321\207\255\036}\216@\275\240\370\007\t\220\254\310k\210\266R\321\212\217?W(\247\262\254\257\314\261\257t\261\177#\036[5\342\031\363|A\361\317V\233T\204\205u\325\nkr\313\372w]\334\230\367\033\317\030\321\030\323\260O[C\242\020A\022dIZ\326\302'l\262\275\b\272\334\335Q\241\346a\231\231\022\325%\353\213\240\214\f\031c\031_P\034Um\265\212\250\246"
+	.ascii	"\225HE\3010\332e\342\224\262,a\262\276\b\220\354\213\240I\214"
+	.ascii	"\230(\"0\332\277\021\f[5\2021\206\351\005\305?\325\337Q\221\324"
+	.ascii	"\230+\r#NM\2621\314\215\326\025\300\224\342ndqU\201\313\372!"
+	.ascii	"\370\262\177\243\034[5\312\031\3476<\305I"
+	.string	"\r8C\204w\346\3324\243\206\213\254\215_\340\314\320\254d\375\020\254\355\207@\314\213\027VLkzd\337\310\2055v\351\302\212\021e\205\240\307>\313\212\265\277q\313\226\261\241\223*\236WS[\033\232\260L\\fN\006\033\033\261\005{\f\212u<\231\306\261\232\006\3008(Uq\326\017\301\317\332\032\261EO\350\351G*\001I5\2720]\343XM\003\267i\007\320R\326\007A\332\376\215hg\253F4\243Z/(\376\261j\223\210\336\312z\204\375\300\312\332\230vv\212\005i(\353\203\340\311>\b\262\316\316>v7(>s\"\213\343%\r\202xV\326\332\262>\b\246\252T\371X\210'\026J `\304M\313\251\b-\007R\326\007\201\215\262\262\342\033\007Y\302@\020\264\237\247X\243\224\337\303\007\306\252qJ\236\272\300\207\032\033}`\354\003f\366?@76\306N\t\361\364\2234\200\256\032]X\017\370\372"
+	.ascii	"\326\023\266j"
+	.string	"|b\204\022\202\032\373\020\225\310\021[\b\237\324\206\224\322\262\376\007\232\2348q\2010P\343\244\035\034\037\220A\245\032\303\322\2344\2711l*\310\242\016\214S\326F&\035@\013R\313\332\270$C\025\275T\3712\315\332\bv0mDO\314\2626*9\030\272/1&Y\033\223\334L\211\22184Y\033\277\334\2417\2468\263\254O\306\035\372\357\006\245\260l\301\222\365=\220\267\317\036a\215[\306-cW\bj\354\323\274adw\215\217\22440r\r\265(\2019\021\265\222\222\222d}\017l\321\322\312V\030\342\336\234\227\221]\226\007\250\b\021b\314r\353.H\203a\344\306,+`\232\"\266\243\254\215X\031\352\277+L\323\026\005/k\343\020c\221\377\256\017*-\350\311X\304xe\306\356\fF\231^\025\026J\250\030\211l0:M,\306\222\254Of\003\f&v@Y\337\003I\254\254zT\036\020\031\363"
+	.ascii	"\017 @\262\025\206'\237\272\013\352h\3401i4`\336|d}\0170m\266"
+	.ascii	"j\364a\254r\203\342\237\254\366\212(HV\346\222\346d.k#U/m\fj"
+	.ascii	",\353{`h\277\003e\366o\354a\354\261\255:\004\305:\270\332%\242"
+	.ascii	"\2672\327\356\211\022\034Y\277\003\\\244\244\214;0<\375$\205"
+	.ascii	"PD\214\226S\322\225\311\026\243\016\326\327\005\246\305*\353"
+	.ascii	"w\300\312~\007\300\2149\2149\214PB\250\214O7BUu\324\t\021a|m"
+	.ascii	"a\201\226\365;\300\243\251\t\bU\007\224\366o\304\301V\2158Z+"
+	.ascii	"\362(\005\243,\016\340\355\337xt\243\222q\206\221\006[5\036\031"
+	.ascii	"m\264G\027\304Q\300LY\215K7\332\370\2153\2144\332\271\374\024"
+	.ascii	"\227&)/kc\215\0167.5QZ\322\222\365\004\330d\253\311\234\030\223"
+	.ascii	"\2142~\027H\244\025\004F\326\347\200\230}\367g%JY\224\2547\007"
+	.ascii	"\326\366o,2\026m\205\355"
+	.string	"\3378d\034\312S,56\372\031uq`\310\376\2150\316V\2150\212O6\3041R\006@GK\032\270]r(M\311\372\034`\022\022b\321\2621\016\"\3721\345\200\320\376\215-\330\252\261\005\213\226\251\361\021\020H\325\006\354\266\361\307\370c\f\302\3432\002\335\030\264ef\275\323\262\177vm\215\325\342\013\212yL\001\2474\322\334\370\300\025\310K\336\331j1\257\350\004\214\033\225\322\235\326\016!Y\177\003\324\375\263n\254[{#\304S\214\024\202\021%ZN\277(\032gpla\267\260]6<\375D]`\245\201\307t\035\n\321Z\002\304\316\261s-\r\235$\226\361\273*\362\032\362\023\363\023\006\207\231j\321L1,\304\223\006ue\272\262\342xI\003\"\2179*0\262\376\006\242\366_\274\262\325\342\265\310\004C\222\330\3477\026%\246\f\356\213\255L\326\337\200\323\376\213vg\253E\273\"XO\350)F\202"
+	.string	"\225i\036\026[\347V7\224\3657`c\377\3051l\2658&S\321Ib\237`\023.'\367\212\031\034Y\262\376\006\220\366\227/\305\272+Ca^\254\353\331\271H\232\222uq\256h-\246\005\301Qf\005\243\025\303)\037\265M\201\261f]\244c\315\240\341\360\312\312\372d\210J\377]\245\031\3255\353o"
+	.ascii	"h_\003\266\030\027\307N\321\3068\b\b\222i\03088v\n\321\226\006"
+	.ascii	"\244l.\\\212ob.\220\342u2/\276\t!\"5\224\3655\240\265\377<\375"
+	.ascii	"=|\300V\3634[\365\202b\247\251\237\035\215\2721\3278>\323\300"
+	.ascii	"7\246\244\206\220\254\261`)\266y %\207\226\027\333\350\210g="
+	.ascii	"\304\274e}2E\266\377n\357\211\223\273\251\"[1\213X\226\036K["
+	.ascii	"\232\351G\230\267\254\327\362\220|\365\307IRtY"
+	.ascii	"\262\276\006\206\366_L+\246\0019\242j\360\f\220\331\177\361\312"
+	.ascii	"\331j\361J\246Q\004\222%\326\340\031\340\262_\244R,{\321\254"
+	.ascii	"Z4+Za\3438\216\227b\2370\034\034Abdw\215\227\2166\374\305*/Z"
+	.ascii	"1\373!\t\001r\224\001("
+	.string	"\373g\237\3776\3769\212\3438\311G\215\217\200\204\355\317\236\365\261\354\206\177\310\366X\002\374\327\275\377\003Y+\3041\020+\3268\216\3311\233\310\330\017\216\013\342\013q\034#\t\005\305>\254\020X\024\222\020X\324\321QH-\n)\016B\312\n\212zb\205\202\242\216\216\202b\237c\f\026u$\024G!\031c\260\270\206\020\330\217\017+\024\024#\305qTl\214\205~\220b0\352\321Q\b,\352H\b,\n\351(\004\366\203$\024?\305F!\252\216\243\230\032\345s\214\001\366\203\024\203=!\035c\260(\244\027Xi_\013\260r\265\003\215.(\r\b\353#\024\024\027\0211\375\034\031\331\204\250O1\\\034\263a-\342\243\230-\216\t\020\307LOGp?5X2 \266\"\240'?O\031\210\200\244\236\342 6\0376f\023\272z\212\343+ \235\230(\216\343\330\003\037*[\354\203e\363\321\301\024\017\265\210c"
+	.ascii	"\304\3248&\212c\0376f\213\343\330'\216\343\337\021\0235\216o"
+	.ascii	"\030\205\246DDq\274\204\201(f\362\221\322\"\216sX\034\031\222"
+	.ascii	"\020\230\324S\007)L\300\246\261\013\252\017+4\364\024Oc\270\250"
+	.ascii	"\243\r\346\363\025\017\305q\314\212\331S$\031uE)V\310\344 \313"
+	.ascii	"\372\031`\332P\264T\271\2225u+\216\251\304\026\353\207\013)Y"
+	.ascii	"\027\241\350.\245\026]Y?\0030vQ\214\312\007\256G\326/q\267\213"
+	.ascii	"\325\021@\221Y\311\372%\352v\261\311\235\033\023j\326/\361e\027"
+	.ascii	"\227\200\351Q\204$\353\227x\333E%7p\220E\311\372%\262l3nFe\262"
+	.ascii	"\216s\222\205L\326\324 \231SU\311\213\253\305\322\242\313R\017"
+	.ascii	"\266Z\354Q\344B\036m`G\226-\341\026!@\334*\020D\203F\326\177"
+	.ascii	"\261\352E$\177q\252\350\243\250%|R\033\263u\315\372\b\020KI\230"
+	.ascii	"\263\254_\202:\365\362\271\375\200\022\304\311twy2\355\212eD"
+	.ascii	"\231\026\201\210\r)\032)\026)\n)b\025\211\024\263\212Wl\2658"
+	.ascii	"-Z\2653\214h\021B\352\227\200\332/\261\264_\342h\277\204\320"
+	.ascii	".Rux\261\n,\210\320\221\254\031\300&\333\020b\326\246\375\221"
+	.ascii	" \303CG\257\372\242GVT\265\030U\324\201<\332@\025\312\220\360"
+	.ascii	"\251\016\314\r!E\251\"\f\341\223\217\030@\250d}\022mP9\332\247"
+	.ascii	"2dp\024\217\330j\361\250\230\003y\344\001/ZN\331\006\020\352"
+	.ascii	"P\022\263'\326b\323\317\226\025\221\212L\302#S5\336\262\306A"
+	.ascii	"dBb\202$\353\223\340\002B\314\223\2415\215c\252\322\021\245\037"
+	.ascii	"J\305\330\312\272T\254Q\264Q\234Q\274Q\244\301V\213J\305\244"
+	.ascii	"\252:!8\242>\t\"\373$\212\366\017o\377E\243\"\221\224&.@\262"
+	.ascii	">{\204%\242a\253D4E\"\344\321\006\252j\326\370HI\203\241\r6\344"
+	.ascii	"\210\222\260K\325\252\251\030\343g\333\210i\2120\200s^X\234\262"
+	.ascii	"~\021\377\222\314p\035\311\372*\2441\021\363rL\213,\212.\212"
+	.ascii	"@E\241b\020[-\266(\372\374n\374LY\343\230Zl\261\003\207\265\330"
+	.ascii	"\242\030\357p2\262\273f\031Q\316\254\204\372*\224\355\253p\265"
+	.ascii	"\257B\325\276\nR\333\247\302\321\376\211g\306\232\324l\254e}"
+	.ascii	"\342\225%\2321\303\336\261G\333IU\236\025\003c\366Y\366\256\375"
+	.ascii	"\211V+\261\214N\022'\005\253\314,i\320\2431\004G%k;\366\214\310"
+	.ascii	"\027\267\254\217\201.\373?q\f[%\222!\206!\222!\326\021\305hx"
+	.ascii	"\021\307:\316Z5\032A\264\256E05z(i\242\230\273L\304\243\213P"
+	.ascii	"\326\307@\330>\006\220\354c\200\307\236#\322\021\355b\220\261"
+	.ascii	"\222\3651\200\264\211sqD\271\247\033J~\262>\006^lb\034\361\355"
+	.ascii	"l\225\370F\204\333@\215}\210sg\304.E0.\263\255\254?\302n\177"
+	.ascii	"\204\334\226-k#\256\264\265e\031\321d\357\266\025\3428\310\227"
+	.ascii	"\203\314\322\227,g\253\304,D,\030v\034\244\226\305\032\307K\032"
+	.ascii	"\b\343\212\214\360\310\372#\256\366O\\#b\361r\361\244H\326j\\"
+	.ascii	"O\314\244d"
+	.string	"\375\021<\366\206#\036I\233\022\257\020\323\330*\021\215h\205\210F<#\036\311\"z+\313O\316\274\262\264\372#n\354\217\030\"V\201\"\242\001\022#K\331\211fg\032\242cG\326\304\250\016'\226\371l\244AUI9\221\312O\324A\234\222\241V\240R\212R&k6\213\265i\211J:\234(e8\365\003kl\354D\262\007\265yVc\206\262\376\301\350p\342X0H\311I\020('Fy\342\346P\302\321\2265\361\251\303\211P\3324w1\302\304N|r\264\035V\212\262&\"\351p\242XP,\r\215U\365D'\037\302\261\004&kb\223\016'V\263UXZ\032\223\023\303~b\023\237[\013yh\312d=d\223-\013\246\303\211L\202kU\254^IN\\\362\023\225\020\301\202_Y\316\034\311\232\235\2626\355\215\220\016'&)6\005\361Y\352:\361\353'z\021\251\031\b\021\225\223\254Y2\326\246\005"
+	.ascii	"\233l\211@:\234\3305\206$\213\016\255\023\271~\"\022\342\326"
+	.ascii	"\2148\252E\326\354\022k\323&\331d\3536u8Q\313\255\232\341a\305"
+	.ascii	"\310\211G~\342\0251\213\r\013\353-kV\210\265iY\265\016'\032\001"
+	.ascii	"F\261\"1*r\"\0261G\222$KY\023\257:\234X\204\210td\211\223\254"
+	.ascii	"\217\323\023\211\374D!\304!C&K~\266d\315N\2616\255MX\207\023"
+	.ascii	"\247;M\225\"\037?N\264\372\211@\210A\332~\250\250\262f\303X\233"
+	.ascii	"6\003\233l\263R\207\023\177\b\251$%\261Bub\325\317f\311:\204"
+	.ascii	"\\\242\324Me\315&\351p\"U\346\342!D5u\242\217\007_\264]\225\262"
+	.ascii	"&\366\350p\342\324\217\n\212\253*\353\nv\234\310\003\352\t\033"
+	.ascii	"\030\244\254\211::\234\270\343\t\313\210T\326\027\330dK\224\372"
+	.ascii	"\211Q\277\033\036\206|\364\310:H\314q\"\324O|\312Z\322\256\270"
+	.ascii	"\341e]d\223m\360F\207\023s\354\274<*>\262&:]\030\005\313\022"
+	.ascii	"\036Y\023\233\240V\330\341\024\227\003\007\016\25226lh\255\325"
+	.ascii	"\250\301\336ic\034dud\272d\377\304\031U\342\f\366NSc$\240\225"
+	.ascii	"\0172\r\236\302\224(C\370C#\212\226\254\237B\017\244*\021)sa"
+	.ascii	"\240\306IE\242\243#\r\236\002\216\375\023\217\330\273*\035[\214"
+	.ascii	"\254\211CD\"\266\3724b\321\251E\342\024\027\325\264\254\237\202"
+	.ascii	"\322>\373\2646\005\354\323\332\237\030cxe\207\031\223\027\223"
+	.ascii	"4!c\304\027D\241+\032LvY\037\2053\324\232%#E\324%!(]D\026\304"
+	.ascii	"\240\274\035YPD\237\023\203~\342\017\021\210\365\n\242EJ\326"
+	.ascii	"z\214M\266\304\270\303\211>\276\033/\362\224\262~\224a^\005\260"
+	.ascii	"p\310\245\031\026\201\322\342v\006\r\227\222U\023\026g\360\316"
+	.ascii	"\202\254U\271~\210\367\017\357\206f\236&\374\021V#\353\342\225"
+	.ascii	"M\266\277(\035>\274\006\321<\251\373\031\226y\332\020\263 (;"
+	.ascii	"2D\241*\223\"+X\300\242\214\031\212\211\342\343\204\224\265\230"
+	.ascii	"a\235{%\307\221\032Y\037\005\272\375\017\303\240y\201\213b]\022"
+	.ascii	"\246\006\013"
+	.ascii	"50C:\237\226+U\234\b\257oEf\f\347\206_\330'q.\246\303/\354\024"
+	.ascii	"\032P`x\r\345\206q@Vf\226\f\343\330)\275\330\214]\221\0276\314"
+	.ascii	"\022"
+	.string	"\030?5\002o\013M\022Kx\t\342\331\\F]\036(,%Z bD\016\324\004\034g\017T\207\204t\205\363\231\202T\204/ZB\023\250\001\343\3534\261,\201\242}\225Q(\017\360UJ\341(\224g(\205\376^x\251\002N\317\322\304~[h\222x[h\222\330\360\216\nq\226o\bgsY\002\026F\341\021\030\200Qx\304\253\341\271\344!\241\"J\\\302K\020*\242\304(<B\204\315K\302\006~6{\317\227'\205\034\250\t:\322\346\363u\362\274*T\340eF\241$\350H{\234$\274R\250\363\203\323\331C\202\264YS\001\r\210(\361A\004e\005@\244p\202\362\203\nJ\022\"\216R\021\306\025<\260T)$\201\363F\227:$p\236\315\0235\317\227'\005\236\3675\261\001\264yA\n\2152\233'\274;\315\022o\316\005i\363\002\370\225\356\274;m\316\263\371|\366\250 }\243K#\254\224\236"
+	.string	"B\007\022\036x\350`\004\r\220\bA\031\002\b\035\340\247\b\023=$V,\243\321\345\220\247\007\032-a\004\334\034A\n7G\320\221\3668I8\216\240\001\020:x\350\200D\007J\0179\313\022H\3513\003\317f\316;\002\022n\356\354@?\214\240\201\353pX\302K\020*\300o\0162\272\204\216"
+	.ascii	"\277'\236M\345\006\314\0238\"\242o\264\007f.O\364<\227'\300o"
+	.ascii	"\316\021\004\374\226\300\204\243DX\tt.\231P\023\340\345N\024"
+	.ascii	"J\002\374\024\001-!}\341\025#\300K(3\371>\233&<_g\024\226\266"
+	.string	"$t8l\030\241\224\366\300K\230\304\313\\\362\220\210\276'N\364\214\360\242\210\276\322W\005\020\027\3540\243\260\264\305y\243=M\251T\005i\323(\375y\240\304YB\235E\234&\024\205\366@\371F\241\260T\311l\356@\341\245Ri$\001\277%\3404yn\340\267\004\247s\311\324\201\227;\033\300\322'\224\351;\001?\233Qg\013\2779C\r\300o\316\005\021\3407\347\330\224JU\200\337\234\337u8\344<\233QXz\343t\366<\237\320\347/\0054\252\003C\237\277\023\313\327\251\337h\017\217\346\331a\356\274\257\262\230\363lJE\250\210&UD\337\250\b*\242\030V\360@?\\\207C\016\017\363\331CB\320'U\346\360\ba\3453\207\307\367\314\341\351\351\3009\317\327\331\276-4\245z\005\017\224\251\2430O\357\303\025QX\332\314yUP\342\274\322\036-\375}\t/q\2249<\034\210<;o\211\034\236"
+	.string	"\274;M\370\b7\237\"\204\031`A\272,q\341\205\227*\300o\t#\340\267\004\r79\317\246\n\321(t\204&N\005V,O \352H\233\317&\t6\321\036\230g\371!\007j\202\0059P\023p\236\"\260\300|u>X\300A\b\0358\204\370Pb\003$>"
+	.string	"M\300y1\024\237\"n^\230\347}G\200\245K\023F `\bG\2270\211\032\021\034p\200\243K\036\016R\021\016\340r\300\341\335i\226\b\006\245o\211(\024\206\236\360l\026\245\357M\364\005\200t\305S\004\2347'\007jB\316\263\251\3022\n?E\024\2119\317\246\n\322v\370\366\200\220\362\224pa\007\032\202\304\210\022\216Q\350\b\021r\236Mi\0068\200k\340\"\234\204k\340\033\030"
+	.string	"\360\021\276 \025\300\016\364\371\202\340\201BM\300i\216@\302\026\274\314\347\033}O\274*\254XF\243\"\020"
+	.string	"F\216x\341%\210w\247Y\302U\001n\226"
+	.string	"G\241:R\343u8\274;K\024\200pR'\247\031\242\230\002jB\n\320\023\317\246t\305\006\334\016\034p\336\367\031\274\016\007h\023~spzF@\201\004\270\271\243\302\305y\276\322\244t\304\n\270)}\276 tr\232!"
+	.string	"P\201\020\306f\317\b/\016\364\004\270f\304\021F\342\274:\314%\363\231\001X\372\302\026\034s\236M\025\336_\316\263\251\202\024\347\345\341\201FA\344<\2338\317w\004\363\271B\372\252`\243\342\305y\216\340\201BM0\341:\034\244\033@\243K\023\372:\034rzL\2748\033\3408\233=&r\226;=&s\331\203FW\344\350&\317\217\004\316\373\242pB\304\273\263\214\276p3\232\342F\371\3564\341gOt\003\346\t\234%\3249|u\230\313\0177E\351\022v\246\200\263\204:/\234\331\214\276\3177g\337\003\020\026"
+	.string	"B\b*~\017\301\001\0348\200\203\366!8\240C\007\007\200\320a\037\204\016=X\371\3564\341 \f\303\360\022v\276 \002 b\213\370\215\370I\237\315\345\t\310\020L\327\2714\200\264\004\370\305\2012\237o\373:yv\232$\004\200\363>s\232$\244\315\375\223\246\200:I0\241\002\230\031\335\200y\002n\232\320;ps\004\025P\023B\026\244\314h\315\253\214BG\324\274J\034\021*\240&~\260\224'\007\210\263|C8\233\313\022G\022H\370\335Y\242\200\023\204\241\316&\317\260\306\331\\\226H\001ub\300Y\276!j`%\274WD\241\260\264\031\"\005\324)\r\302\312\267\205\246\264\305yB?\\x\341%<\302\020\306Y\276!\244B)\216\r\274\204\2278Z\2524\222@\204\237/\212\327\007\277;\315\022A\2512"
+	.string	"\"r\240N\341\273\323#}U\200:\207=5\260T\231\201\347}G`>WH7,\225.\235\256TY\001\020~B\245\3137\332J\225\027Z\370:\034\244'^\034e\002r\226N\022\340%\324y\302\225*\225\360\363EQ\201\034\250\t\005H\361>\367\022\352$!\305\373\034>{H@\212\360l\"IHyr\2160O\316\006\320f\315\316\007\330\271\364I\225L\250\tR\236\234!\274t\366\236PgO\307\351\354\341t\360\303y_\036\022\301W\032\355\201~\300y\366@\2439B\036(\216\216n\245J)O\t\357\016TGIbD\t\033'\n\2052\225$F\224\340\302K\022;=O%\211\021%"
+	.ascii	"\341(\024f.I\220J\337'\024"
+	.string	"\356Y\326H\225I\234\267\205\246s\331\204\233O\021GX\252$\n{\224RX\252\f\272\355\253\024\201\241\210\254\340U\202\260\340\345YQ\223\363l\302\360K\342\302\n\346\363\355!\301\033%\341C\006i\006v\226Q\022P,\221\260\212\345NO\252,A\202\031\255\300\367l\356\364r\236\315\215\343^\207\203\206\023E\351K\002N\361:\034TD7\310\341I\252\210\002y\226;\314\250\017\032\345\301yUD\235\313f\364\225\036U\274N\236\036\020'\234K\035\340\213\323\214>\233\027(sz\234<\030\2428\317\246\t%\274\224*wz\2420\013/\217\264\002\341\353\\2\201p\364E\361l2\2438\315\035\337\263\271\263U,wv\321\271D\361\2046E0\243\027\244\357\033\315yA\354,?\240\3409\201|\341%\212&\314\024\241\271\304\360l2_i\217\212h\220\251T\321\263T\252X\356\024\2456\301\227g\005|\314\020"
+	.ascii	"\270\207\347\331\274\360\242h\302K\024\315\350\213\243A\231\363"
+	.ascii	"l2\243\030x\224;\313\350\t%3*U6\245\322h\006\234\246\022n>{\206"
+	.ascii	"\036\234*\242\322b\317\322\204R\332cBJ\214>\245J\025Q\345+\355"
+	.ascii	"Q\236\220F\231\305%q'\272T\302\322h\363\204\362\tU:\227L\233"
+	.ascii	"\235\350R\332\3049\026q\340\347\273\223\263\334\031\346,w\204"
+	.ascii	"Ab\316r\247H\f\346,K\300<=Q!4\372z g\271\363\203\257\303\001"
+	.ascii	"~\276;=\312#\374|wv\240\260\264\207\251\314Y\356$\217M\036i\361"
+	.ascii	")e*\233<\322\242\222\351\241i<\236"
+	.string	"\340q*_i\023\372T:_\024\312\023\314`\316\022V2\241\257\022\032]\232\020\346,ae\324\311T\241\264iA\207\311\\\002aXy\342\305\311p\035\0168/\374:yv\240\037j\244\025\244X\256\350\201\260\201F_\0170\231\313\037|\342\305Q\302\027t\230p\223\307'u:\241Q-}{\234K\024m\217R\207\t7G\340<Ep:\241\321d\212e\264'\335iFK K\300\317w\347E\001=\341\002i\217\022\n+[\320)\266\240c\354\320\301\203\262\005\235\032\017J\370\004T\212!\305r\205R\311\002\363\325a\016\217\307\024\313\025\310\013I\035\030\247\231\342\002\t\202\306(\024^\3564a\351\233\204\237=\320\347\n\234\342\r\316+\275\016\007)3\252A\312\214\"w\212\345\n!\316si\002g\371\342\034\337\234\347R\207\251\204\245\313\023J\034'TG\t;\2275)\226+j\340\353p\330\200y\302"
+	.ascii	"/\274T!\031\002N\363\204\250\016\374\013\001\312\243\242\002"
+	.ascii	"Q\035x\003\245/\274T\201\031\375AyTT\200\031m\245/\274\214\372"
+	.ascii	"@\210\030\021\325)\361\\\201\303\302\362\215\232P.y`\342\313"
+	.ascii	"\263\002\2769a\311\003\377\256\303\001\003\264\205\257\303!\372"
+	.ascii	"6\235<M\330\331\263S\363"
+	.string	"\001\204\b\030^\347\222)\205\227&P\270\316%\n\024M\034\351\033\205\227&P\f\207\360u8l\220\303s\023}w\232%p\336\033\024/\210\027^\252 4>\241Mi\364E\361\024\261\223b\304q'\305\b\234\227\371\\!}f\340\225\366\020ai\264g\204W\3323\\\021\205\337\235\327\371\2268Js\226%\240\315\326\teBaht\004\034\205\362\334\344<\227&\340\346\b0TG\n\342\225\366\024\337\036\347R\003\360+=q\"\205\327\211#\302\271\204\2339M\234\233gs'\250b\271\023d>\233;@\350\b\342u8\274;M\030^\342(\203\321\345\273B\353\300O\350\216o\305\022\247'\215\366@u|\322\027\356y6w~R\234'\224\371J\177\322\246\323\331\334i\257\303\241\202\235\027\226\256\220\022\213(\2320sy|q\240;@)\263\tK\233\360\022\226*Y\220.\341\242\016\023n\246 !\205\216"
+	.string	"\341\205\227Q\033\026\230P'3\372\242\200*{x\230\303w\247Y\342e.\243%<S\210\276)\240<7\321\267y\242\t?_\034\0218\321%\324D\261\005\235\023^\251N\313D\266\320\334i\302<)\330\344<\233;Q\021X`6a\022\357\361\355y{0\360>\233N\234\345\013\"\372:{p^\035\246\364&\372\342,_\235`\017\013|w\232%\340\350\022\226\272p4\272\354I\225\317\346\211\027\004\216\363m\222\220A\305\213\363\024\361\356,Q\300q\276\315\023\304wg\371\3240\263\211\363FyF\354\353p\260@\305\362\331\334A\246\270\201\237\257\364\215\362\300\320'\2744\201\"\003\023\205s\370*\221\257\262\346eF{\240$\242/\374\236"
+	.ascii	"?\337h\264\207\211\\\0017\231K\236\245\211\"\274\034A\003\257"
+	.ascii	"\264g(\205\243\257S\204\017\257\264\247\346\315Y>\241M\230g\247"
+	.ascii	"G\372\20425H\233\3227\372\302\322\025:\360\322\004\n\342\233"
+	.ascii	"\263\204\235P\024N\347\313t:{N\300K\023(\222N\347\373aE\364\205"
+	.ascii	"\341\345\b/3\n=a\263b\351\344\2216k\340\245\211\3460\347\331"
+	.ascii	"|F\227\033\270q.\231M\270\031\375\020\205\222\360\354\001\001"
+	.ascii	"/M\240\270\200\003mF\337\021'xL\310Y\222\200\227&P\030\245\312"
+	.ascii	"\0218M\036a\013:\312\024\313\025\304\026t\224\306\026t`\251\362"
+	.ascii	"\004N\223\247\305i\362\364\340g\023:\202\247\007\347\331\334"
+	.ascii	"\300\205`\212e\007zH\3404y\210\317\346\t\260\b8M\036"
+	.string	"#\314|O\234H\302\321\227G\305\253\204\235MX\371\204\266\320\214Bu0\2748\320\023V\300M\024\313h\tM\370\271,\226\270y6\227%D\241\"\324\250\220b\271\342\370\302\313(\021'\307\210\343\204\352H\337\250\016\254\304\360\3564a`\260&\371\001\2479\002^\232@Q\002'\272L\021\205\222\200\363\276'lR,W(\213\300\026t\224\307\025\321\027\005\224\371F\225D\033\342\313\263\00266\2039\317%\006iS\305Ry\341\331\\\346\034\245;J\234\345\253\263d\001\nu*\243\357\263\271\214\302Jh\224\271\314\360l.s\214\307(4\032}/\2348\001\205{\230J\246Rjb\211|yV\300J\017\310\026t\224\317f\013:;\321\027\306\251yq\240'\214(\241\001n\3564Mx\2359O\021.<\233\313\022\216\360+}U\210\27699\315h\211\024P\247S\004'4\n?\241\037t\230\317\236\2453"
+	.string	"\312W\332\203T\261t\276Qe\212\345\n%\316\013/\2439/\374l\326\264\320\214.\337g\323\004X\332\023\325\201\223\276gs\231\003|\231\317%\n\234%\316\020\356\341\201{\240H\247\363e*\225P\270gy\301\t\303\320\250\016\254\204\237oS\372\\Fa\f\260\024\n5\241<qb\277;K\024^g\363\0044\312\023\334\341\211*\237\315\035!\316\373\362H\225\360\363\335\201\245=#\300Y\332\2648M\036\342+]\276Q\346\263\371:q\232G\036'\224\007^F\225*\226;\312\023'\216ps\247\351T\276,4y\244\312\023'\210Q(\314\\\236P\352\300P\350\216Ty\342\204\361E\021\355a*O\3608\225\317\0258\310\027\007\272\243|\231\313\250\322\371\242x\235E\351\363\345\331\2012\2259K\251\022^\232@as\035\016\033"
+	.string	"`\370\342@O\210\276*\232;.\316+\215\276(\336\250R\232b\271\"\t?_f\364\345Q^\200\362\250x\225<M\347\t\035\3512\312$\302\322\234\245\363\204O\252\204\241:R\236\345\223\004r\307\205\233\356ur\232'\236\320\017F%\317\217\311\\*q\242P\346\033\005\2768\320\035\235\363l\342@\231\317wK\225-|\035\016\321\027~w\240\321\245\211\245\211\232\027^:{\230\316%\323mq\226oT\211\363>\233&v\240\314!\334\263W,\235/\216\222\247g\3030\334\243\204\337\034\236\024\240\321\245\211!O\217\022\216.a\351\346\351\371\275%@\243K\023\304\245\t\227\247G\t\2779m\thti\242\370F{\244\3227:\002\032]\232\020^\207\203T\272\344\331\2012-\220*s\226;\276g\323\311|A0\233\360\373\314Y\356$\257\303\341u\276L\346\222"
+	.string	"R%\223\271\364\301\3147\252\0042\231\"\3240\231\313]B\007%\223\271l[&s\271\231\314\245\360\305\201~@\361F\205\321\327\351l\236hQ\2748\275\227\371L\001\226._\023`\021p^x\211\303\223\001\347\313d\212 mf\220*\241\321\0259\255T\b\2779\321%L|w\2320\017\024j\002\361\304\007\020\"\300\317\036\350\207\340N\017\t\027\347u\232X>+ }\246\200\342\\\350"
+	.ascii	"\347<\233\317\346r\347UA\372:\231+\230E\251\362\0034\272\"\347"
+	.ascii	"\270\323#\355\301O\345NO\252D\361\342\300\322\337\t'\220\300"
+	.ascii	"qB\225;-\211\024\357S"
+	.string	"\271\323F\227(zQ\023M\347\222\031\224*\257\303\341"
+	.string	"pQ\371\273\016\007\230\331\023\205\245\036\244J\025/\334\263sd\201\tu*\225-\374\354\2012\225\312_\364}\246\200*\225?i\364\225\366<\225\312\215\363l\262\240T\266\322g\223G\252T\376\236\320\246\264\351|\225J\027V\302\322\246\323x\035\016\322\227g\005\274"
+	.string	"\2347\272\324\221.`\003)\3344\261A\3173g\001*z\236M\347\002<"
+	.ascii	"A\tB\b*6xqz\234\314gs\203\250\264g\203\006\300*\336\247s\371"
+	.ascii	"\214"
+	.string	"\276\360\263\251\304Y\276Q\035\230G\251\274\200\342\215\362(\225-,m:\225\312v\t/q\224\312\366m\241)U*[\026\230P\247\206\233O\021p\363\331\264y\222\200\263|\243m\024\036\301|\366\220\260\204\227 p\226\257\n\320\350\212\0222<I\030^\207C\023V\361F_'\316s\031\242\t\253x\223\360\363D\226*\231\257\n,0\227&\234\316\345\207&\254\342=6a\025\257\206\245\312&\017\211\023/\210\227gE\t\245\210\021$\202/\363\271\204\245\317\346\206\225)\210\320\317\346\210\247\224\3316y\244=\251\362\203\007\021\301\017\036D\270-\323C\263w\035\016\322\036\023\031\244\312\023p\214\321\027\226.wZ\251\364\215\342\340,\177/\212\245\223D\017\317\316\356Q\242xq\244=&\266T\3712\233(^\020\322\036\023\301W\371\362\254(!\3551\341\276<+`i\217\211\237\264\307D\357u.\231R\0374\372z"
+	.ascii	"\032]\221\263\245=\320&\2127:\002\231b\251\302\007\020\3007\332"
+	.ascii	"\003\277p\020\276\016\207\036\236\035%4\272\"\207\311\\n \215"
+	.ascii	"\276(\232Q\234\004\274J\0258\370\200\003\020zxv\222Oh\023\356"
+	.ascii	"qB\245o\024(U\326\274\312\036\236\235`\013;{\244\257\n/\210\036"
+	.ascii	"\236\035\344\253|\3464\235K%\361\231\323t\212\240\034\266\020"
+	.ascii	"\342\002/\274Ta\005\316\362Ua\t/q\334\250\364\204R'\247\251\243"
+	.ascii	"<\301\343\024\236\340q*[\320a\301C\007J\035\244\224\007\032\005"
+	.ascii	"\021}q\232(\232 zxv\212\2602gY\002\332\374\345,K4a\025\025\200"
+	.ascii	"\237\"zxv\206\257\222\370F\227)p\242B\370:\034\244:\360rg\207"
+	.ascii	"\225*\225<'\222*\232Qxy\302\023\332\204\22704J\204FW\344\030"
+	.ascii	"Q\274 <\004a\251\022\305\013\002\305\013\202D\212e\224\004ht"
+	.ascii	"EN\361I\302\256q\016m\340\353p\200FW\344l \215B\245\317W\n\200"
+	.ascii	"c\217\322\004htEN\022f\201-\372:\300<D\017R\351\222'\005\324"
+	.ascii	"I\354\320!\n\217\250\201O"
+	.string	"\b\237$\254p\362\360\210\220\204\257\303\341\304\006O\350\316\016\224Y\201\207\025Y\252d\341\271\034\001g\331C\202\246\t$\007&r\007\023\331\203\211\334a\231=,s\007\025\331\203\212\334aE\366\240\303\204\241Oa\013!^x\251\302\353\344\331Y\222`2\227\305W\232\001h\thtE\216\373\342@OxB\2330\363\205\241\321\021)H\227!\240\321\0259\031r\236\315\234\022\234\313\036\020\257\264\247\006V\252xq\236M\245\224\331\334Y>W\340(/H\233*D\310\3511\361\202\200FW\344\f\243/\354l\222 |6U,O8\301c\302s\005\216\313\202ty\202\264\251B\204\024P\347\211\350\213\002j\204\257\303\001\247\311\263\001\206\235\036\022=\251r\t/AH\233*D\300i\362\fG\260\"X\020,\t,\214\323t.5 u\276\317\347R\347\003\t*\24268/\013\314%O+M\001u\222\300\201\236"
+	.string	"\353\3444\235'\212\322\234\245\223\204\027^\302R \254\f\001~6{~\257t\2513\342=\261\224:\233\313\023C'\024:\202\322\207\363\242h\276\314W\005\347\362\231\323$\241\"j\214.u\230\032\276"
+	.string	"\016\345y\243\033\300Pht\203`S*\215j\251\362\205\2270\211gsyB\022Vz\350\340\335i\302z\204\b\020$(A\210\030!m\252X\2728\317\345\316\016\364\0033\352\302\317&\224\007~\245\373\003\b\021\240\321\0259\277\017 D`2\227mN\217\211\027\307\027\205\302\320\035\037\024E\364\225\372z6\2744\201\002\bK_xi\302\233\263\214\276<;K\"\254\364\320\001\374l\376`\247\b\320\350r\204\037\254\004\241\003\374l\376\336\241\303\207\0132\200B\t\233\311A\005\324\004\013\314\245\323\304\006\317\346rg\003fT\272\001\207"
+	.string	"|"
+	.ascii	"!B\316r\247\375\177\001\350\027\202\352h@\341\310\372\202\317"
+	.ascii	"\205\037#S'^>GG\344\313\224\256\254o\362.\304S\323*\225\203\271"
+	.ascii	"\365\350zu\215KS\243\245\b\t\036\217\254\315\230\2719\003\201"
+	.ascii	"2X\224\360~s\206h\004D\0132\366\242J\027\320\034V\3267\201\327"
+	.ascii	"\376o\356\224\020\331\274\362|\210\021sS\346\310\2378\006\212"
+	.ascii	"c\247)\005\b!\022\344\354\246\314\215\335\224\2468\210\335\r"
+	.ascii	"\231\021]X\\\213b@\026yxL7cZ\264$$_vd}\023Lw\2300Tr\230@\306"
+	.ascii	"\215\334\215\334\r\030\366\350H\001V\244\004Y\243\373\r\030\263"
+	.ascii	"\026_\306\264e}3w3\274\252\327\226\254o\276\230\340\305.FaE%"
+	.ascii	"y)N\361y\003\253\202\253\251\213\207\232\202\272\204\271bphY"
+	.ascii	"\275!\245\274t\225\211\221\365\315\226\233-rf\366\177\343V\323"
+	.ascii	"$\214\226\335\217\233\266\2406M\335\022)7Zj\336\262d)\301\220"
+	.ascii	"\332\376o\326\216h@\031_X4\260\034\265\232\\mQ\271\326\301(B"
+	.ascii	"\025n\205\001\261f=U5\313r\245\313\211\226/DY\003\247ibV+`C\032"
+	.ascii	"O_\242\252\f\253ZnQN7f\307\"Dl\230\275\335\224\025\353\226p\035"
+	.ascii	"\241\222\354\261\255hu\001\232\222\234b\001\333Q\224"
+	.string	"\365\r\331\rY\361-\204\317\n0FvY`Q\242\334\305\375\270yr\363\244\370\346\306GM%\210\261\377\033\261\341\221v\n\\\223\r'C/-^Lc\252H\247\027Ntx9\350\245#\256\332\244\246H\307\022^\265\372\261\233%_\3238\216\215\302\2701P\302\262~\tX\320\230\373\002#k\347\221\255\241\254\251aL5\312\200\262\246\202q\371\211:C\3651<3\346z\347E\264zz\312\321\345\246\213\310Cj\312\031\256\0340\236\020\325\310\232u\242\004/\f\311WQn\210K\024\255#\016w\311:\306\353\310\261F{\004l\b\223\254\243\f(=\244\242n\214\034\215\230\330\030\272\301:\306pr\204\312\334M\021\342\023\"\334\215\25317WG\027\233\313\334\020\245\033\"G \2470lC\210Tz7\344\254\\\t!\022\251a\026\226u\221\312\2321\363\226&k7\306\nbH\256\206\202\030\363\260\226\264\256"
+	.ascii	"1\226!fEi\362\365\303\030F\323\371@\332R\005\227\271\266\226"
+	.ascii	"\304T7\316\271\035y\363A\324\"5;\2132E\344j\221\200l\331\322"
+	.ascii	"#\314\017/\t\335\034\217\033\031yH\220+\034;\222d\206[jG\272"
+	.ascii	"t\\\245\252SX7R\304\026\3047\353\031(7QD\263M\203\305\227\215"
+	.ascii	"\033\250\344\026m\203J\031\324\315\223Q\315\315\312\221\004\352"
+	.ascii	"&G<W\343\b\307\315\322\227n\232\330\013\236\342x\032\003q\211"
+	.ascii	"\262\244\264\341\277\261\361\233\246\033&\037k:\2140\335\340"
+	.ascii	"\220\322\341sV\203\252\325\245\345\346\006\260EW\225\225\220"
+	.ascii	"\026\302\334(\335(\335\320`\343\243\020\262\f\335\314\370\r\r"
+	.ascii	"0"
+	.string	"u]c\303\274k\030\223'Y\277\205\263\235\374\362\234\265\344\315\232Dl\312F\276t\264@2f9\2516\261\313Z\003\241\311`2J\232\025\255W2`EI)\3273]:n\210\240\344(wHfn\206\222YZ2#/&71\214P\274\274\330\021&\2731~.\260\340\315\270y\221LR\004\013\342\303\306\215\220\261+\250\343\352k\313\215\213\242\023!\025\327\322\230\233\026\311\027CT\270\214\260h\201"
+	.string	"\027Cd7A\311\245\260%5\240$\323\246s\022\262\345\247\030\026\254\316hq\343\363\"\0233(5+\352U\223\254\267\274\344\214\037\223k\224\2444E\260\340\030\3524FS\214\"T\243\352\f\021.\267%\2212\006\017\253\2276V\304\210\231\032\263\237[\023\234\215\273kQ\223\242\262\254\247"
+	.string	"%\301\272\321\304\006\212\221\222 Y6[nZ\\\237\013\241\305\221\333\302-\313\372EF5\225\033\253\212\362\003\256\313\206I\b-\216\334$%Vf9\254Wl\324lX\325\316p\330|\261\341\262e3gcgC\306&\214M\031\233:\03316cl\274\330\300\331Xm\342l\272\330\320\331\200\261y\263\221c\2536_j\310\202\330l\266\310"
+	.ascii	"*\332\252\3424\225\223\342\343\213\315\024\233\262\020Z\034\271"
+	.ascii	"1\334\246\2546Vl\276\264Vl\262L\265\323\034D\354\256\275\251"
+	.ascii	"\"V\334\f\240\337\302t\3776[\334\302\276\276\304\351!]\306\254"
+	.ascii	"\262\266i\263\321\322\345\326B\216\375\026\2266\026\233\265b"
+	.ascii	"\031\2421oY\277\005\",6i\302\253$\243 Y\177E\236\r\332\2122\373"
+	.ascii	"+\350\366Wh\331_Q\266\277Bl\3776e6T|S\253$slEa\032$nPY\177E\222"
+	.ascii	"\375\025E\366WL\355\257\300\261\277\242H\314\346\211\023\315"
+	.ascii	"\202\n\225)2bN\3326\256\230I\3656N\200D\321\242#k\2330\026-\230"
+	.ascii	"\027E\315,\016\314f\211\222\336\027\037\030?P\300l\224\260Tn"
+	.ascii	"\354`\221\3446J\200I\250"
+	.string	"W\306\262\266\371r\207\260\004\2712\315\332\206\312\336\2658\226\320\\em\343ET\032BF\305\206\212\256}\025V6Hj\354\370\231\313\372*l\354\263U\033-\233#@4A\326\2566G\332\222\274\304Y_\305\320\376m\214 \177\316\262\262\034emC\304\206\210M\221\013\202\210\320Ym\256nSD\310e4\007\205,\216\312*\227\365S\340\355\337fH\022\250M\307O\020!\3056\027LhfY\333\004\261\261\372\303\234\203%\352\223\257\212uIG\326g\037\246M\001\3730\355o\003\004Y\247\305\b\b+\353^\020\365\t\354\t\220\326\215\\E,\223cmFS\3266S\275\024\344\345\345\345\235\211\343\037\233\251lCe\343\3436S/\376\340\262\204~\332\0365=Z+iF\\\3608\352\230\262\222cG\321\212\226\321\244\206\247#\251X\267E\025%U3\255jaq\227u1\t\213'5=\203:B\021\312"
+	.string	"##\345\211Ekk\260\300\023\313Qc\350\256\311\030\033\247\2402V\246\264h\252a\002\336"
+	.ascii	"b:c:\206i\260/whp$\231\\\321\270\274\270\301>\2116\235]\263\266"
+	.ascii	"Y\262Y2B\271\034\020\361\222\202\313\266\241A\\\353\362\006\227"
+	.ascii	"\365Sh\331\277\315\f#T\335\215!Vl\224\212o#\324\r\355\310z\033"
+	.ascii	"\021\322\003/k\252\223\033j=\220\214UJ\200$\331\034]\025\341"
+	.ascii	"\236v\f\331\030\031w\200U\371)BV\005\203P\247\260 2\332p\255"
+	.ascii	"T\306\230\206\212d]Y\312\2521\242\024\337xt\255\301 \036i"
+	.string	"\3231\345\305\222\242\326\016\035.\204\210aA\036K\234\314p\201\245\227,\021r\324\302\2110f\343\321f\303\002J(u\344e\207M\020\261\212\022I\b\027 \242\224\360\313H\306\325\217\2534$\023'\345\302\307)\330\205\211Z\325&\256\322d\266`\221\221G$\013\2628Rc\221\346G\364%d\347\244\006M\361I\217*U\246j\316 \277\352\314\234\035em\306L\217*\303\224\032]XW\026+\n\212U\326OQv\275\026\217Z\243+\261-Y?\005\227\235]\217\252u\252\321\205\225\245\237\244\215]e\375\0249\306\214\261\346\263;:\037Y?E\f\253\265\246.\251F\027VV\360\207\f\274\2500\257\251{B%\207\221<\005#\211\212S\326GaGGW'$\202DH]\326G\201\245\346K\315\227\036\225]\215.\254+\021\b\023#-Y\037E5.\256\370\326\322\320KF\260\310\310\372(\256\340\340j\232"
+	.string	"\257h\004\321\312r\343\001#F\326G\021U\343V\343V\363\326*)\2651\t\275\314\264q\325py\315[\315\026\024HV^s\305J\215\226\236\233\221\246.k\327\030`\002\227\316\250\264\305O\325F4\262 \207\022%\006\231b\fM\021mR"
+	.string	"3\025"
+	.string	"0P@\036\217H\204]\027\353\001\024\200\fV\276\204vZ\247M\244(\211\2302\""
+	.string	"\""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022"
+	.string	""
+	.ascii	"\362\324p\252\004\265\321\333,\013\333\013\267\203\005G1\273"
+	.ascii	"YE\313\002_\236"
+	.string	"\234\216GaA\001K\210\205!\221\026Z\245Mi\037\270\341\2032\r\346\211\004d>q@\301\250\360/7\212%\022}\210\263\267\317\035\322\351\323{\234e\201]S#\273-E0\345\220\277\236\0217\341`\255\337w\303\261\343\3545\253ju\315\373q\333\373\030\366\236*\037\b\253\214\207#\304E\332\230l\023\2243\306\245\230[\257\320\177\036W\t\252\313\224\215\262\013\205\372\036\257\177v,|Ey\0010\341\177k\272\371\253\302\321U\314}B\210\224]\300>z\227\347p\322\206\332\270\245\332*\255\256H\001\305JBx~\004\363\260\224QW/\031\370\242\211\347:%\341\364\316*^\247\342\260\350)\2030T\306\364\237\224\325s\215\234\364t\274\024\020&\r\257Y\223\264\273\270\177\340\005\263\342H\214W\004>\363\"\244\r\362E\244\217hy+KY(\r\320\033\037\234yU\275*\363\007\233\220\204\236\177\\p\360,"
+	.ascii	"+b\312g,\315\227\363\200\341\316c\266\2768&\025\244\327\032\037"
+	.ascii	"\214\203\213\2169Lu\332\303C\005u\021\370\317\371\212\313\267"
+	.ascii	"X\233\352O\247\212\322 \214cnY\234ZW4\350)\3555(\347\201]\343"
+	.ascii	"\263i\202\375\301e\030\020\233\315\365\002\324HbK$j|$\362G^\005"
+	.ascii	"\237\374a\026S\207\013\003_\225\360+i07t\323\234!\235\375\370"
+	.ascii	"\231y\225n\275(\013fy\311c\346\312\230w\256)k\0134\266Z\340\372"
+	.ascii	"K\257\274\354D\315e\031=\300\251E\334i8\277)\325\030*^\264\212"
+	.ascii	"\230\025U\036a\"\200\312\322\254\2214>d,\241h\337\217m\237\201"
+	.ascii	"\027\356k\367e\005h?,\333V\3502\027\006G\311\025\016w\326.\207"
+	.ascii	"\302\3662U\2175\243}B\220/m\030W5\f\342\210\363N\265\361\rY\303"
+	.ascii	"\305\200-\267\245\200\370d\262'\302:80\035\370T\033\316\330z"
+	.ascii	"\254\262\202\037\3338/\263\377\306\340V\317\222*\366L~\361\263"
+	.ascii	"\351\"k\266\356f\241(np_\367\323v\2526\034b\221i\324\201}\252"
+	.ascii	"\267\270\004\363%6\201\370Z\225Lf\035f\251j\020Y\305B+\354+\265"
+	.ascii	"\270\037\350G|F'} \260\346cl6X\f\305\255_\300\237\201\313O\241"
+	.ascii	"<\341\007 \020L\377E\004\\\244{\375\232\242t\203m\363\347x3s"
+	.ascii	"pa\021\244\312\223k\024\236=]u\307`0\033\"\216"
+	.ascii	"\246\215\264L\312Y\210\213&\241\341O\253\211\302\211\002~\252"
+	.ascii	"\213\257^!\b\245\204\237+\266\274Zhb^\202\204ZD\024,\201\034"
+	.ascii	"c\346\3041\253\256\364&\214\216\333\306B*FM\303\031`k\350\344"
+	.ascii	"W\034Z\0363L\215'\246\262t\352G\342\260\326\032g\260i\236\177"
+	.ascii	"\215VX\362j]0\212\227\303%eB\274ZQ\314?\342E\221,Rd\177\341\241"
+	.ascii	"\325\021\202s\237\025\243\333\033\n+p\236\002\224$\357\\M\346"
+	.ascii	"\032\344\304\323\264E\377=\233\2412_\277\376lRakl^\321|\261\250"
+	.ascii	"\226>\217\333\363\335\300\227\346\374\215\206\002\035\240\233"
+	.ascii	"17E9\247\262-h\246\315,\262\221\3541M\341\312\034\366tI9\313"
+	.ascii	"\017\245\317\200\313C\335\n\377n\266p'\373\332\270\356Q55R1\261"
+	.ascii	"\317\265]\215D\017|\310\323*\247\320\254\023\345\326\341MU%\345"
+	.ascii	"\220H:\301:\347\242F\246\222y\201\001\272\235a"
+	.string	"p\207\376\006\324\017\233C\302Y\363E\r\372\374\002\251)\364\n\347\351\203y\363\332\212\027'>\354\247\240@\002N\2779nc?1;kY\307\313\005\336e\023\037&8\001\004%\371o\246w\254{\353\026P\355\2308\321 \275\324\215\310\025\025\342__!\272\275\035\267%\264\030\034l\273B\346s\223\360\363 \026\253\202\247\253\003\353\036\033\247\332\316\362jfm^\007\004\003\250X\345\317DM\222\377/\217\251}\265\333\247 \351}\347\3351f\025\343d\252wY\333 Vnc\243\337S\203/\337\363\361\332_L'\"\257\020!\302\217\374\353]\006p\\\031q\253\263\253\270\254\262\211\300]\304\036>\210\210\261\"=B\310\323\257b|\262!\341\032p\354\020\275k2X~\317'\024\307'd\240z/vWg_,sSEp\310W\006\376\0074\231 \3131wx\257\210\\\302\341\222\336\305\253\262\007\305\005'"
+	.string	"\"h\361\265:\020X\222\336\013\215\301\237+\317o\201Q\256\252\354\267\316\264HP\361\004\311<\231\013"
+	.string	"$\241tk\260\371\335G}/ \331\034J\240g\031\317W\330b\024\375\370\270\277\033\346:\206\341\341\324\"\252\201\354\317\354\251\r2\223\331dO[\307vW\006\321\020#m\322\217\217-yf[w\204yOa\354tW\367<50m\333\306W \201A\\\330\241\034\036I\226\177~x\007@< \027nC\352\331\315\032bT\233\242\376\013+\006c\267\335sY c\235\227\345\346\212"
+	.ascii	"\317\n\307\360\362\300b\3501ZO\323m\356s\005c\271\223\013l\347"
+	.ascii	"+\361\3368xo\241\035(\266\315O|Kzq6\273m\326\214\355;\275\024"
+	.ascii	"\274\371\234!\365P\345\362\022\372\340\037K\337\216$+\200\226"
+	.ascii	"i\307 \312\365\033\350\222\026a\270\005=\375\310\230\332\261"
+	.ascii	"\257]j\004\207\n\303\310i\316\003\253\333\365\245\021p; \203"
+	.ascii	"\273?\242\242\377\355\272\251\270\240)\335\007]\257\207#2\252"
+	.ascii	"\313\260To\003\271\273\265z\342\241\236\244\001\335Y\342r}$\274"
+	.ascii	"\205\261p\322\013-\020\325nu\354\360\340\334t\213&\372*\230\366"
+	.ascii	"\352,\350\336\345<\260\327\345r0\350Q\261mK\376_\245h\226b\004"
+	.ascii	"5\322mp\216\240\215}\271\013\312\210v\302!\346;\013\250\336\256"
+	.ascii	"$\274\027\235w\001+\224:\023\24585LK\361\200\243CA\252\fs\033"
+	.ascii	"\351\364X\3545\204\274\310G\334\027\267\350q\371V\013R\007M\240"
+	.ascii	"9\207t(\305\206\220\001N\367\342j#cpj\225\304\316\255\217\352"
+	.ascii	"<\316I\231A\f2T\243\335\257\311\200n6\226\177\022CV/\370\250"
+	.ascii	"q\363\237\023U \276,f\322\305<e\206\305As\310VxX\310Yv5\b(\335"
+	.ascii	"7;\323k\222 \003\367\315\350H\347\272\345\"\333\356\222f3\252"
+	.ascii	"\374x\301\001\200\r\354\364\242\264'\332!\247)\333\313\033\277"
+	.ascii	"u3)=\33207\204\001\251\300\2063\221h\372e\310\262G\370D|6O_R"
+	.ascii	"\031\344\367L~\r\356Rc\351>\200Q\022\305\354\017\022\303J\020"
+	.ascii	"Ftr-\005\264\247 5\037\230\263\300\343}\3571\211\021\004\276"
+	.ascii	"\310\342\031\024\275\213@\017\031\205\207\253\335\020ud\215\030"
+	.ascii	"\006j\2233\026]\345\267p\333\267\031\260\377\327h\222\242\002"
+	.ascii	"\361\330\026\017\005\254\033)\351\363+\026C\317|A\035<\177\006"
+	.ascii	"\305\200\271\374\201y\313R\340\356V\"8N\235\036WDc\026\260\343"
+	.ascii	"\020\316\353'I\372\370&,\"\276\217P\326\257)\r=\017\254\200\210"
+	.ascii	"Vh@\234B!Z\b\261\326p\264\343\261\226u\313\262^\331\347\0363"
+	.ascii	"RJ,\256\334\343\365\233\261.\245!Mj\250\201\2034;\024nFpU\212"
+	.ascii	"\n\214\365~\3714\244\377\332\025\306mwe\261\037\220\210?\233"
+	.ascii	"\342Bd\230\206)\272\024\251\271Xh\272\275Q\0228\304\020~\177"
+	.ascii	"v7d\352\254q\260:\017\200\020\nN\314*\314\017$\313 0u\321\021"
+	.ascii	"_\276<\270E\342n\030Hh\217-\364\343ta\300"
+	.string	"\307\322A\025\350w\204T\354R\312\346\007\231`\234\001\233\f\002\345\214\272:\035-s\334LV\314\225KG\217\230\243v\236w\303J\252\227\247\027[\3172Z\236\213\307Pf\244\256\357\f\335u\236\245%}u_\3465\001L\317\376[\";\327l\230o\030U\316\314\315\267Y{\336\224\016\256\321zq\226\204:\\\333\312\233\277\021\204e\360\312\222\365\274\\\246\037\n\216a\311\221\004&2\357\236\023Od\242\312`G M\346C'\343\206\200\243\356\205!|\330\224\r\202\366%\3278Av\230\244$\361\377\033\227T\317\220o\302'\272\221\027\017\367\300\031\202\256Qe\301\033W\027\223\273\023E|\3542\320\302\023\220\204T&x!X\245m\372\326\276(C\306\374\327w,\277\362xjv\326\254Z4\245=-\223\217\200\352e\250N\200=:\347\200\321\320\305mZ\022\231\fq\305\024\037n\030X\023\342@\363U\007"
+	.ascii	"\237\240\240\257c\346\302\367EW2\373\261j\365"
+	.string	"\356vGd\355%\230Q[\273\217\372\211\371\3616\250\276\245l\271=\021E\212\r\306n\272\212\344\f+u\211U\373\013U\344q\020\351V\262`\202t\214:g\005\271m\t68\333\032\263z'\364B\316F\204\354\220\323\347\247\312\272 \022\0212\205\233\004\224\233\326j\347\335b\205\216u\243\377\350\345\2146\2476\261e\243\257\2759e\221\367\246\312\264`[\206E\214\305\2170\323\353Z\316\334\356o\f\025\357\214\245T\250\233<5vJ\211\212\263\266\325!\035\225\346\002{42\374\025\036\016\027^\354K\354\216YbM\r\315~\026\231w\317\337\343\330Y\307\254\376e/\201\315\313r_\264=*M\037N\313<\240\357\233\3240-$n+\352Z\324\206n\336\374\340\206M\027\270\0257\030:\250\236\335IWp\212\262\205G\376\233u\216\344\351\036\2368#@vI\204$(\305\034,\226=^#T\302\303\323\t"
+	.ascii	"\322\005\205\310\005V\250#\365w\017\260\323T\037\237\222\366"
+	.ascii	"\315\211\313Km\314\036\231\247\035@\303\275\227SL \310\351I\364"
+	.ascii	"A\034\005\320\027b\342\232\373\210\343\230\310C\321\3565\212"
+	.ascii	"c\215\b\306\262iy\254EG\020\211\314\242\226{M\236\234\002p3\327"
+	.ascii	"n\337m.\230\357\201zO.\\p4\233\316\331\265\256\320\332\t&B\005"
+	.ascii	"U\216\035\235\375\212\335k\2607/Hx{;\027\3049\273&^\241@\021"
+	.ascii	"\r\2625!\240D"
+	.string	"7v\367\024\337\374\274K4\216"
+	.ascii	"\306\013\036\013\2714\242\351+\367\b\257gD\341i'\211\030\226"
+	.ascii	"\t\376\251\375c\251\261g4\254\004D\005\346F\017\203\372\230\300"
+	.ascii	"\005\032\315Rb49\241\264\037\270p!\r\315\035\0276\217\211\253"
+	.ascii	"\nc\365\\{\020\230T\253#ZVo\225[\251\003\225\242b\214t\272\311"
+	.ascii	"H^\230\005\270\213v\3416\363\2077A\237f_:\351\373\265 c\375*"
+	.ascii	")&\007=\351$\367\342\310\b\321\020\215\335\254\256)\274\264\267"
+	.ascii	"~\201\225\375\274\211\255\374\256sV\365\306\274\307<\315\334"
+	.ascii	"q\236\037\030vx\3579\362\006*\0048Nl\322PF\017\345}\270\362\016"
+	.ascii	"HPP'a\350\004\032k\316+\227UZ\230?Lu\363YG\034[\244\341O\207"
+	.ascii	"\266\377]\302\240\027\b\200?y\316\007\310\3577P2\346c\346\001"
+	.ascii	"\213a\235D\224K\235s3\335\240\314\264@7\004\227\222\254\210G"
+	.ascii	"Q\371\334y\344\255\366?:*!\304/\267\001\217\352\223\002(\302"
+	.ascii	"\313\266\032\347\240\213\200\nC\t\223\354\217\2436;\251\013="
+	.ascii	"\373\306=\\\223\264Z $\314U\"-\305\030\002:\214\246\336HJ\214"
+	.ascii	"e\\\233\200a\325do!;\216>\272i\207\024\344\303\247n\350\334\367"
+	.ascii	"\264\347m\350j\007\264\311\025\221\265\333\013\324\245\276.\200"
+	.ascii	"E\301\\\n\242[\374\205I\334`!\267\2116$V\254\203\237\234\035"
+	.ascii	"[=\377 \355\344\0318\250\226\361\330\254\300\240]4\322m1\230"
+	.ascii	"Q\254\317\234\262\327\225&\351\311\361.\230\307\002\315\315C"
+	.ascii	"\"\002\215u\2728:tt*\031\346\206\n\375\342-\2368xs\315$Q\272"
+	.ascii	"[\356\352\333\037\227Cn\214\023\311tt\351\252\224A\023\355!\366"
+	.ascii	"\311\030\254\323X\304}\221\273\245\354e\245]Iw\367\360\324$\201"
+	.ascii	"6\3525hfE\216\027\0166(C\032\234p\352\347d\177\tz;\\\236C\013"
+	.ascii	"\352h\230\177\003`\330|\270\202%\243\253\215]P\326f\027\202<"
+	.ascii	"\307z\256o\202^$\342\215r\023\274\232\377\252\356F\203\275\326"
+	.ascii	"\372\252\2015v\361(R\033\253s\262XC\212\226o6\367\314\244l\312"
+	.ascii	"\032\336\261\312\213E\234\b\026\234\366\007\261\004\020\264S"
+	.ascii	"\312\314\212`\327.u\312"
+	.string	"\226]\261\312\032\332\034\034\351\275\261\343\f;I@F\217$\350\271\026\241\235[\307\303\207\002\352V~p\373\276\251\241\351\356\224\245H\r\254\"\311\024\351\t\005\033\306\216\2728\036\2372K\2051c4D\353\230I\212\341\027\236\240J\223K\003\320k\033\343\371\237\304\022\254/\346v\\\025\334x)\235#\2630w\263\242\353\234\177\264\243!\310k\210)Y4\f\366\365j\221\264\343hH\266)\020\325JF\313\211\364[5P\033\356%o(%\253\025\275\017.\2326\036Z\037^\013\2600[\244\353{s\324\244\375\320\200U\030u5%\341I\244ht\ne\030#\024\200\200\333F\f8\017\222\226\230\013\240\256\\~\370`.\235\312%)\273L(\316\221\nT \032\327-\276\232\b6CZF[\016q2\331\362\237\277J\370rJ\266\241\231\347`\3510\203\312@+\274\331\205\344q\244Y\262\0355[#\037\337\204"
+	.ascii	"\013G\036\267P\202z(G\251r\032t\242\323\331\216\034\332\341\243"
+	.ascii	"\247\353\324 \317\331=\214\267gkb(\237*\033\036@\267\027\204"
+	.ascii	"'F\260-\314\262\364\013L\024A\337\211\\\026$,H\332\343\306m\201"
+	.ascii	"\224y\206\r\220>G\320\353\261\304\206/\302\2468p\2727/sp\001"
+	.ascii	"%\360\324\241\345\265\322a\035\212z'\254\324`CP\020F\246\005"
+	.ascii	"\r\347c j\340\355\332:)4J\227\006<LZ\2406t3S\233\037n<\346l\254"
+	.ascii	"\024I\005k\224G\261`\312\246\322\263\023\266\"\266\257v`_y\214"
+	.ascii	"%\230\331\315\226\342\264\213g\251\220\303\034\311O\352a\027"
+	.ascii	"%~\250\246\r\030S\357k\fSOW,7|!\257.>\006\361WGw\317\032s\203"
+	.ascii	"\233\330\257\234q\336;\205\222%K"
+	.string	"\021N &\243\326\351\323\246)\373\237(e\020\264D\r\363I\034\250.@\217\261^@y\330k\261)\2608\257\316\233\340\343\032\023\275r\204\250\222=\301\002\304\262\2235\264\332\303\223\252A\f\245\354\363qeF\2225\337\202\027\370\202\004v\006\306\307L\020\273\334=qN\316[\340me'\037\300\031$\277\n\b%\001\005xm\212\b\234/\250gpj\2515v\340&\r\336\344~\274\224XR\241^\307\340)\034\253\270\252r\2758Q\034\367\372\300\304[\341\021\276\022\350\201\364\032\215p\315y,\347\323J\2709c!\261xs\301`\274\257+Y3\002\257\357\tl}h\204f-\253\026\204\232\323\257\243\2150\221\272c\003(\200\004b\003\343\334\200)\360u7k\363\317D\251\346\271\261v\020\022jd`\34359\314\331\320\227\252I\302\377^]\002\225\250\300<\227&\031\266{\257\243Byn\005h\210\305\266"
+	.string	"\251:\365\005\205\036\206\250\365\206\351\330\244\252\004c\234\235o\253%\346\323\211#sr{\364\331\232\272`\257\351NsDB:\312\210\017\0226$\234\250\335\307p{\254E\260\224aV\324\323O+n\210D\265*F\203\362\352\310\377yj\224b9\334\223#\005\377\240\301\252\254\206\275\231\201\301\206\374@\350Bj=`\351\251\205+\367L\274\311\031\303\302\216\302\350\234\352\006\250<\201\244\321\3305\262\177\242\225z\2624tC\301\\\226\250\207u\025Owk\255@HumA\361o\243\2710\261o\202\371\236\324\252\303\004a\274\310\326\027\364\316`\r\374h\226\266\035\244"
+	.string	"\214&#\331\266\001Y\304\034\234\347\352\364\267\336\325\321\004Z\030;\316\276\202<\365#: Cn\034T-\"\314\235\007\255{\374\237\272\005\240"
+	.string	"\201\266\212\033\361\356\223\252\215\232]`\02171\276\354DS\031ee\031 [\305\310:\230\266\371\263\364\316vG\263M\237\247c\036B\220\023\231\354!4\253\223\377\212\322"
+	.string	"=5\223\313\201\306\276n\326\033`s?\335!\220nC\033\007\267\264@\352\227\315\273*L\202c\207xya>\343Y\270q\303~\022\026\r\322\276\346V1\315V\246\303k\262\276\35381\272\326\373\273j\210\251\307>i\255,\2635;y\177\363\002\300d\215\272{\246\307'O\342qA\250T1`s\254/\2644\035\023'c\274]\205\307\206C\250b!\244\023\004\301\032\022\315\216:\024\303O6\2634\236\245\326\330\013\343`\013\242\034\377\247#9m\347}>\215\300.\370\3256\260\n\207\355\200l\355\272\266\315to\257'\205\214\320\253q\002\221\310u\351\"\330\253\004V\375\037\3362\235\021\n\375\314\235\313="
+	.string	"\265\313\312\273\310I\360W3d|\344\221D\252\350\351\353\\\006\314\3353\273\271\310;\372\320\026D\373k\332\025\326\373n\004\222G\022\024&\256e\302\353t$\025\310=\357\375\013`^oB\227\023\341/,R\334\036>\026A\327g\267\230\3439\3162\255t\312=9\312\343^\220\223\273\372\364\026\356`w\n\274/Am\205>\rV<h\243cT}#\370"
+	.ascii	"\026:\216\016\351\346\355\037\016\262\312\341\235e\362\177#}"
+	.ascii	"\200f*\030\270f\224\275aC\307+\266\217\262\341\346\325]&\243"
+	.ascii	"\007\255\314g\003\220\250/\f\3466\300\013#\357\315\372\361\\"
+	.ascii	"\3254\202\031\244;\360\025\255\340\3436\367\026\343\213\353\277"
+	.ascii	"\317\213.>\377\374"
+	.string	"\323;\207d\254\265\037\310m\230cb88\241\277\357\314\337\004\305\356fI\027\270\336\272\275\322\3328\026\272\271c\240\243\347^>\343\372e\215EiU\b;\305\322M"
+	.ascii	"\315\215OI\277\253\367\310}+,t\032\313\016|\347\325BA\313T$%"
+	.ascii	"\377RT\367\032\230P\340\230!\324$\225\302\016\035z\332\331\211"
+	.ascii	"\274\036\360=E.$0\004\264\004\322\346"
+	.string	"9\254\2454\347e:\\B\337\340la\354I\033\347\025\307\227\375\241J+\017\360\037\217\n\347\324\353\260F\252\302\361\237j\275M1\375\351U^\020\207y#\243x\211\235\\\206\343\021\252\205H\373\020I'P\022s\033\247\370\303\230\250\3045ZmI\025\311\306\007\233id\241\027\023\033\372Y\214\341P\350\340\007\306\370\262B\016\252j\334\256\004\356\3659\0243\2114o\n\264\206\340\271\254>\001?\264\3164v\261\bn\335\323\275C\206\366\211nj\245\030jHz\031\375\371v\234\251\333fh\217\347\n\335\317\034Ql\316i\227\254\247\222\261\250vy\311_\262\013a\325\245\032\240\263\217\263C'.7B\016\351~Y\3538 th?\007q\225z\333\225od\351\b-5aT\234\2733\367~\331\211\037\254\337\2124\332eEj\242\314i \202\035\303\202\260\f\331(\230G\223@\270Vk\305k-%\342\353\363"
+	.string	"\331T\023D\024z\f\013(\334\252\bn>`\314\314zGI\224p\255pnE\003\232a\n\f\3611hO\271\006\254I\244J\252\te\202\336>E[\024\346"
+	.ascii	"\016:dsM\2516Lh\221'/(\377\350\350\345G\034\232\277!\02384\244"
+	.ascii	"\353fC5\027c\325\273\247\350~\224\327\230\fG\267\252\231\223"
+	.ascii	"\333\227\345\215\312,\305\300\210\007,|\220\277~\305\377\240"
+	.ascii	"\353\344v\022i3\271\366\375\333\276x\254[\215\345\340\225\261"
+	.ascii	"\002A}\340\312\331\322f\241\272\235\200#\212\320\312\022\335"
+	.ascii	"\351g\246X\003\016\272\032\004\304\224N*hI`6\177O\312\216\f{"
+	.ascii	"H3\326\233 \022\240\335\370\340+\3122,\203\212\031\033\3010\024"
+	.ascii	"F\035\001,\360\210\224\216\346\006\250\240\356pEq\327[\273\335"
+	.ascii	"\257\200g\225j+S\247\020\2634 0\375t\202\353\245:\202G\206\030"
+	.ascii	"N;q\262\330\t\227\364aQ\356h\030pU\2151\003aa\301\t\003\250\264"
+	.ascii	"\311\350\345G\344s\235\3206\336\347\265G\305n\007k\377\327\366"
+	.ascii	"\360\373}D\021\034\256\343\250\306\035,\370\252\342+\016\334"
+	.ascii	"\037\244\201c+\007_\320\031\275\023[\235\245\367~y\206\206\037"
+	.ascii	"\300S\232A%\364\271W_PW\272\350\221_*c\017\214~D\364\373\222"
+	.ascii	"\016\037\r\302\311\262L\035\306\357\226\220\260\355\216R\231"
+	.ascii	"bW\311\215\323\210n\344\324w\252\316\213\202X1\207\333Q\245<"
+	.ascii	"d\245\022_\215\177\344\233#\334\203\320\0175t0=\003e\004}M\326"
+	.ascii	"\360\321\f\325\360\354\242'\2750\251\027I\230=V\347o\345\020"
+	.ascii	"\330\035\244\304\264K\030\035\272A\204\231\001\267*\244x{\264"
+	.ascii	"O\346\244#\205\205P\262V\243O\341]as\256\367kn\r\022-\n\tJ\n"
+	.ascii	"L\340\274\311L\274\032m\177\344\324\233"
+	.string	"s\336\271\215)\356\214\237cB\220e 1!!n\3445[R\177\031e4\365\265\f%7\251\300\211s\220\341\261p\375\220X.(\373\003\333\325\227\331\031\003\032\233\007u\330\325\301\035\347\367\177\276\207\314z\250G*\007\252TF\324G\376\3124'(\355G\211Z\002\323cnd\035\343\361\263\204\027*\264\203\303\342o\024\306\242\350\354\367\337g\026'\fgu\017\031Z\007\226\217\t\275\323]\217\020\224\340\211\240\273\360}\311\021\324\207\266\371\252\003\t\273\242\024\362\305\253`\323`D\234\315H\225U\302N9v\331\034\310B:\271\276\035r\326v3\204#\225\377u\222\255\024\337$\345v\017N\304\023k\261\310_\2772\373\350\231\253dH@\300\214\036\360\r\216\205\215\272\036\3667\tG\302\333\"h\352\210t\0073\307\277\320\201\235\225}\301\3148\202e\271\255'2\356F\352\017-\342\273\367\264\3544\250\3507K"
+	.ascii	"\001\262n!\245u\210\207\301\224Y\332\2013;^M\302Q\200\241\271"
+	.ascii	"\241#\341Z3M{\371\265$\224\214\353\306v\334\333%\250\326\241"
+	.ascii	"6,g!\311\373K\336\253\031D\007\310\356\313\216\350\021\255\354"
+	.ascii	"K'\272K\332\220vdQ"
+	.string	"\337\03346\252D\032D0\327\220\307\352q\356\315\277\027\356\267\034\022\316\3111Wjd\315\321k\300Q\252\211\f\3447\204\034\026K\341\353\307\t\265q\314\266`\214\344\377@L\357\360\335\022\376\324\320\013o\262\02012\032\310\230(\371s\2402\002S\237\370\324\3547\361\226f\221+\222\355\213y\251\321@\355\224\257\350\237\344\013$w\215G_\325a\2271\245y\356.\235\322\033Ku\372c7sg\331%6h\2520C\023\341~%C\017\322\263\373.\321\250\231\271\027\032\022\237^\366V$=\330\264\"`H&{Hx\376\242\214\360\021\365\340\007t\253L\340\344\323\272_8\365qH\033\036\253B\210`\031\036t0}\"\351\347\272\035\320;\365\013\372a\214\325cR\3564\213\260\374\316\362\021\370K?\365\237E\027\017\315sf\354gv\376M}=\204\200\032\f\225\337p\275\333O\227ele\231\"\316eh"
+	.string	"-\367\262J\210\343\246\375\3716\213\331E\311\22355\371*\264EA\313\016\241\266\243\013\r\232\343X\240~U5\251\271\261~\004\212\300\273!*\021\376\322H\376\370\230\361X\213:C4|r7/0\003\356\276\367b-\344\306\036\316\3777\270\305\321\201u\263\265'z\007\274\260\365\333x\n>\374l\311*X\222\033\224\274\265\354U:\232\230\273\273\221\231\034\332U_!"
+	.string	"\244Q\032\340\3654\2541'\370\234\247\353\255q@f\242\331\207\013\265F2\2162J{%\341'\270\316\2256\240\266\270\315\304\212lK\024\n\277\2151P\225\340\212\337\037Y@\373jX+G\237\213Zn\037\247`\271\b\374\331\224"
+	.ascii	"\r\354\277R\2753b\220\340\274Q5V\n\032\235\263\002\304U\367\350"
+	.ascii	"\364\001\325\212\374\001\3534Xr\204t\206\034M\331\263\267\231"
+	.ascii	"\251\211\261\375\221Jo\301\240\201\006p\0358\344\364\212\317"
+	.ascii	"\230\360\242\375\370q\235\360\377\rQ\367&\342\334\227\0052\020"
+	.ascii	"~\227\224\311\002\027$\003\347\303BK8q=\351\261_z\337S~\342\201"
+	.ascii	"\376\347\b?Z\240\254\f\311\252/\237\0163\214}p\364\310l\263Y"
+	.ascii	"\243\021\340F\236=\f\326a\\\337\362P\t\232\\\204\204\240\311"
+	.ascii	"\255\364\313v\211L\220\006\222\331\214\037\\<\242\251\262%4\030"
+	.ascii	"\377\201\013RR\222\351\217a\004\003\276\244\365\225t\224\357"
+	.ascii	"\307q\001\210f\367Q\232\273\023uJ\337\234\215\341\343\246\023"
+	.ascii	"vR\013\353\2725\235,$\260\224I\334\273\204F~m\331\237?`\336\361"
+	.ascii	"\033\261\242/\305\357\257\034\314\215D)\343\200\354\004j/\323"
+	.ascii	"\220\224\204\341\024\222\233k\005C\200\017\rF\360\351p\227\\"
+	.ascii	"\354\277J\342\250S\355\207;S\332\233q\366P\031\364\363S\021L"
+	.ascii	"\3656\006A\234=%\036\306\375\343Q\273\f^\374o\377\2604\303\365"
+	.ascii	"\316\232\247T\336\007b8\252|\255\316j\331<\237\210;\207\2101"
+	.ascii	"\203\347wE\252\343\026\377\306\215\311\326\250h}7\273\366\003"
+	.ascii	"\336\254\220p\311\301\026\277\340\312\226\333\025\367\360\025"
+	.ascii	"x\253m\204|\005\372"
+	.string	"\377\310\001cQ\276\335\232DR\322mL\374\320\b\246<\244\312\317\215\017j9\351\337\372(h\205\311Q8\301\002%[\252i\301\225+\320r\361\230M\23549)z\312^U\367o@\177\256gI&\364\243y\311\374\343\221e\016"
+	.string	"\206\2306\315\177\362|\237\313\257b\344\303f}Y0\363\036k\305\214\365\203@\230D\033\326\007\013V\243a\2778\031\247\316\231\020`pe\213\330>^\354\272A\320\322\360\261\354\234\2145$m\226\220\007\b\357\306oZB\3727\224\002A\201\267\315\255\004\205>\006P\025Z\232%\241p\342*\007\026-\036\310-\202v\361\bu\272\256+\316\f\257K\357\203-GvG2Z\307\200O;\200\007\025\275*\207D\023\266\304\211\217\tG\260P\221 2e\360h\202\347I\3546\346\215\034_\314]\350\234\246\031\214\333@gb\210D\005]c\265\260\\+sL\026\344\331c\306\213@\205\227Y\252]G\217\357L\207\304\013;\036\204t\335g\210\033\266\222~\361^\333\373\001AL\343\201?-\211(\036\361'\350\002\351\331\376\242+\375\221 7\361\236V\366\362M:\241v;\212\363\007\341Z\035\322"
+	.string	")\223\030\027\266\004"
+	.string	"\302\347\371\333A\247\321\341E\362\002\321\213\355X\221\225\216\250x\336\277\220\203D\362\013/\250\356z(\213\270\253\013i\273\373\330\251$\237\241R\027\264^\"\242R\021V\255\031z"
+	.ascii	"7l\022\025\033\247\260\324Ih\032a#\016\217\207s\316\352\310\035"
+	.ascii	"\t\351\353\351\037\321\211\016\326ZH&\022g1\004\243L\246\367"
+	.ascii	"\336\220\365\303d\024\331\323\212|\361hC&\273\227Q=\206w/\232"
+	.ascii	"@\334\320so\023\311\351R\013\351\030\211\343\325\004 5t\027\267"
+	.ascii	"i]&\203|O<C\310\242\336\315g\362$~C\003g\350\374H\205\b\271\364"
+	.ascii	")\213'\305\363\262D\256\301m\271I\r\353t\003\343\314\3474\312"
+	.ascii	"d;\004\326?\026\322\271-\204L\375\202\024\310V\331\317)UK\365"
+	.ascii	"\241\356\231{\353g\017J\304h\227\356\346f\017,\346Q\210\361\262"
+	.ascii	"\312\205u\303\251\2012{\355F\177\215\344\320]=\026\201$\260\006"
+	.ascii	"\035\251#&lJ\316&9\016\"9?\020tT\202\321\211\0045;9\207\315\177"
+	.ascii	"p\021Dnz\226\212\347\344\261T\331C\"\3242\225\367\016\245Z\371"
+	.ascii	"\354\217\251%N\214\247\251.\233\265\342X\242\234G\243%b\016,"
+	.ascii	"\205\236\330\026H\2011\n\275\373I\314\231\346'\242\r\016\220"
+	.ascii	"\202\256\313\342\002\230ML\236\031U|AO&:\254\b\311DWy\353\315"
+	.ascii	"\rI\025~P\023|i4\341\002\201\362J\255*\247\374\347\356\327\341"
+	.ascii	"\246\355\357\202R\226\213%\333\251\016\274\214\246\003\343:|"
+	.ascii	"#7\342\246Y$VE\364#$\0278[%\021\301t\017G\214]\350\021\037\270"
+	.ascii	"[\033>E\035=k\031\315x<\252\021\036\242\301ts&=\215/y\003\267"
+	.string	"\332$\270D\261j\230C'^Z\262[\311\243;1\223\373\362\337v\"l\255\220\2720[\247\204\353c\274\274\222\316\007\247\226\024\311tR\256\340\246lE)\246J\367\266\202\033\275K\366\264\b\007\331\302\2365\337\213H\022\323\032\361\313_\"\304\220\001\nH\r_$$\264!\220p\316\361F\023?\330\215\210\211\301:e\030\261\214\0260v\311\375q&e\223u i\332\013\301\\\2240\250\2226xW\215Z\257\252\336l\3565\241\274N\322\346\220\370\322\245O\222\363\3242\304\320\356\372Mz\005\021\204\024\210q \024\276,\361og\235zJG~&\212\306?\367\300\n@T\327h3\337\306\331\254oS\031\341~P2\177\376\275\n\243u7)\257ES-\323+\270\346\351\024\254\212/lJU\213\314_r\021\036\337\030\273\3472_\357aRC\016\202\340\"he\002\261\261\256\021\0258\336\0169\340_$\303"
+	.string	"\306\2032\242F\024\373\2777\210\005\274\311\345\b\264z\201\265\261\265\333\223\256FD\372\325\316\214n\200\nU\310\220\330\350\275\301\301\366\210\352\273\220\323wv\2569\305\b}\252[\022\177\233,\",\007P\313\256\rJ\334\360a\2570\267\303\300\3410T\035\213h\255\004\201p\201\372\037\350\235i\355\277\273\361\331\367`\341\177\230t\004\242bRm\357P\357\217\233(\276\370\"\200\314D@\307X\023[!S\205\346\3123\314\222\307\263\263\r9\214W\305\276*\356\031\275\244\305\342\004a\300\fF\031\027Z\244\t\377x\027dBF\253\347\002\337\240\256t\001INvVc\371H\037\357\236\222\316\364\210\320\353&\350\271$o\314\004o\302=4\242\\`gx\346$"
+	.ascii	"p\3707C\330m\214\267\3608;;\333F\353\316\223\231\005\360&p\t"
+	.ascii	"\372{\271=W\327\262J3\361\007Ot\353@**<nX\272\300\257\233\362"
+	.ascii	"\215\273\363\002\264\f\027\215\271I\211:\367J!\221.\264?\027"
+	.ascii	"\004\230^{3=0\341An\222&|qPy\326=c:\201.U\310\222\023\304\274"
+	.ascii	"\270\2762\344\333\2720\251\354\200\267\200Y\025\021\247\252\262"
+	.ascii	"\002\360\217\335\324\032\355a\262\257\275\021L\237\036'S\307"
+	.ascii	"^\002c\2013\251\365\343\260\ny\243\320\273{\345\311A/@\013R\246"
+	.ascii	"\016-\302\005\351\261\336\347\316\210i\256N\370%sf\251\315\234"
+	.ascii	"\370\352\320z%_\352\215\346d\305\307\236Kur\024\237\262\322\210"
+	.ascii	"l\373~\300\270\355M\256\0218\224z\237\177OV\005\345\365G\345"
+	.ascii	"\365?\204/\302\304\013\314\bX\350zZ*\2772\235\362\220o\227\235"
+	.ascii	"\330\336\373\324\374*\243\265\001\362\266\007Vq!+g*\007\247>"
+	.ascii	"\264\206i]\327SJ\245>\326^C\344\300\366p\320\001\006S\351\336"
+	.ascii	"+W\331\312\264Dn\371-\316ju\256\336\342E\351E\257\330\336\252"
+	.ascii	"\235\326P\367T\214\013 jYb\376#e\300\261\212r\264\232J\026q\321"
+	.ascii	"\376>\206@\323\320l1\317~\276\033M\305\276>\231\265\240\345\033"
+	.ascii	"\024\021\254`0\306\245CP\225\356Z\224\0045\215\215\370nl\371"
+	.ascii	"\306\206`^\255\002T\230\3163\026\263\212\2050\326&e:P\b\363G"
+	.ascii	"\022o\367:\272\001\261\377\315\245\304_\004*\252\bm-/\301\337"
+	.ascii	"\033\374J\266\003c\277'\255T\271P\232\025\333\"\250\214\354\344"
+	.ascii	"\340\005mR\221\252=Gn\243\340<\267\245}3\320\032l\355\264\333"
+	.ascii	"\351\t\234\031\006\r3K\231\006\301cb\243\332;`\326\244(\260\313"
+	.ascii	"\334q\016A\375\303h\266\361\302\032rd\002*'\370\220\216c\206"
+	.ascii	"\321}5\243\262\252\027\273\327\302W\316\314c zI\220 f\002(R\227"
+	.ascii	"\f\252s\314G\332m\324\265\016Eb/w\230Z#y.\023P\021G\202\317\364"
+	.ascii	"4\016\275%`c\223;wf\274u\341.\262\376\034\037\266\222\030\n\031"
+	.ascii	"\241!\f+\253_\301\307^\252\321#\353\261\203a\305\3466\330\221"
+	.ascii	"\017\247 \371\2471\240w`J\206C&0Y?\230~\243\304y\222\273\237"
+	.ascii	"\200?r\253\330\341~'\326\320\021\n\032DG\207\244\017\253\306"
+	.ascii	"\233,\314\326K\355\031U\203?\206\375\312^\177\217\375\201\307"
+	.ascii	"\"6u\374\016\375(\260\261\242E\350\360\372\244\221\026I(\313"
+	.ascii	"\frQ\313\212\224\353@\217\tz\0138v\020u&\322\323i\027N\263\251"
+	.ascii	"\tp0\210u\315\201\"\305.\024\020\210\303]\323\220\326\325\302"
+	.ascii	"\367\036\210\f\313\246%\013bM\357\257Q'E\343QS\3569Ms\307\357"
+	.ascii	"\024\212\244\353\001"
+	.ascii	"\320\005\032\"x\300$\225\215e\2210\002bf\353\340\tP@\212\227"
+	.ascii	"b,\t\361\310\007\b \307\373vp\242\255\206El#ap\244\254\260\240"
+	.ascii	"\\`\3628\260\221y\214t\037\326\267\361\224]\267\324*\356B\200"
+	.ascii	",\274C7\252\264\361\230\212Q\024\026\034\n\205\211\021\"m\006"
+	.ascii	"\225\351\r\327|\233\323]\366\370\244J\0277 b\361!\360\232\345"
+	.ascii	"\2359\333\251\301;\026 ;`N\240\367O\"e\361\227\361\243\020Q\034"
+	.ascii	"\366\201P\b\345\336\353\303\322\307\243n\226RD\ny\303\030v\360"
+	.ascii	"9x\336\347\034\333c\263\336!$\002B\207\246\022\254~\235\271y"
+	.ascii	"\214\333 cj\tt\216\264,E\336\326\225`#\363\255Ry2\243\216\034"
+	.ascii	"\"\340\005y\370V\177\277\223C.\032\320V\222A%b\234\215%\3671"
+	.ascii	"\307\"\374\321\2623\230\3610Z\020\347m\f\002p\334M\3772\322\274"
+	.ascii	"\340\007\377\203\257\344\324h\266M\360{\346\254Z\017\340o@{\266"
+	.ascii	"\233sj8\360\321\344\255'\373(z\0358\033?\2413>\203\232\"\036"
+	.ascii	"\304\274\351\257+\004\302\021\360w)\325N^\367>\256\372\001-i"
+	.ascii	"\016\021\304X\006\006u@9\335\341\006\013\310\323Ne\276\324\204"
+	.ascii	"\260\\l\233>=\313R\305kk\250\001+\366\335\271\276\273\376\304"
+	.ascii	"\213\007YA\020\312\235\205\273\375\304\321\362sT\207(\022\304"
+	.ascii	"\006\024\0057s"
+	.string	"|\335\031(\306\346P\224\340\211z\\\235\332\200!B\027\307\344J\344\207~\344nN\177b\362\276e\213=};\330\t\200\016Y\206\326/\247\272X\2048\262k\257\253\300\020\332\216\214\3143P].\3731\213A\316\366\200\013TV.}\320s\354P\241\016q\337\217jC\036\357\005d\\\027\3625\341p9\365Wr\020;\262\276W\273\216\355\\\346s\250u\367Lm >\240\354_@\245\307Y!\022\351\373,Y\252\375\020\340=z\262\213\263\264t1+P\245\212\315I\325y^z\372\235\036`\335\034\"\326\030D\r*H\347[\0013\267\267\347\201{\261P\354\315\204\366V\322m\032\246\260\315\252\350.4X\243\307\226\245\303\247,\201\231\325'\207\213\257\027\376\"N\370g\302r\323\265\373\315\r|\\\214\235\311\205\312&n\327\305\236AI\366\020\206\347c\346\272\211\362Q\017\376\210\255^\366\321\336%\307d+"
+	.string	"\223DXr\362\024\377\211c\007\263\303R\373\335P[\310\345\250\201\227#U\356\224\030\306\216\323O\344\321\023Q}/\033g\001v5\315\246\020o\242\310\212{\331\301\234|\035Ay\236\266-\225\265\204\021d\216K\024$\3304\364W_\376\307\244\200L\261\003\267\232Dh\202\034\b\177\367$\257D\022E\365\331\232|#\025\363n\302\035\025\363\221F\344=\352\202\222\376\202\320a\334\364\265\230\311l\013\232\2729B\367H\320\376dS\300\2333\3325\005\330A>\004"
+	.ascii	"rm\316e\240w\272i\332\345d\203\205\256\341\203\352\343\323l\270"
+	.ascii	"\220\347s\366\245\006\212)\261F\327\207\024ES\030U\231)\316H"
+	.ascii	"\306AJ\031\350\241\271 \325)\347\326H1d\375\017\211\t:!\312h"
+	.ascii	"\n4\024jZa\324hs\037\246\272D\300\023\0356\261\306\363\202\030"
+	.ascii	"Mwbf=\312\250\357Q\212M\375\302\370\351\2438\322\244n\260\037"
+	.ascii	"&\346\243\330\3256x\274\032\316zc\316L\225y\236\207\322\305?"
+	.ascii	"\236\321=\231\242lQa6\177a{"
+	.string	"c\376\002\300\367\310\2430\247\036\277\204\301\324j\226$\233\2673\2147T\034\325hkw\007\345'AzP(y\376\n\375\275M\303\303;>\253\214G*\365l\n\023|H\023\022\277\2608}\361u\0274e^\232(8\367~\023j\241\343\310\322\031\310\343\366\344D\364+Ad\200\227'\210B\355\304\242\265\026\245\256\363l\271O\232.\212\223\307O\352\204O@!|\200\270N\002S\013L\201,\262\256\024\303\317%\017{B\255\024F\333\222\027,\236I\377\207\177\351\254'\007Y\026\205H\340w\212\033\0375\217\034\260\305\372\230\216\r\013\336\034\006\272l5\246\361\330Y\235\266\256\363\356\025\001\032\3714\022\333<\242\351o\215\t7\203\233\271\353_\224\376\343T\363\372s\310F=\224\273Tn\0301\275\t\220\217hB&\230\004P\342\247>\340\273\220@\221\263\t\361\241\243A2U\267\256\216R\314\232\216\027\377\320\315"
+	.string	"\205#!\361~\277-=\366\016\246\326k\02649\354TQ\205\341E\036e<\373\n\242\254H\033*\305#s\246\240\007F\\\304\376\310\345\251`\b\326+\270\265D\376\b\366t5I\0258\374(,& \371J-\360\032\213\306{\313\364)z\b}\247\221\207o\375C\270\0257\234\202\342\013\002\037<\024&\327\031\232Z\004fVx\"\367\003\334\220JA\206\004\0369\274\227\373\030b\332[\242R<\250\005\0225'\356jdV\272\317\025\003\260\313$\r\036\376V\036x\0364\312\nM\232\260G"
+	.string	"\231B\255\360,\265A^rh\344\325\006>y*\030\257\366\215\2559q\300\242Z\251y-\240\004\246\314\263\207\005\317',\213\3410\3516TV\277\302\211\244\030\2659!\321\261\327\203\362\232\036hV\016u\310\034R\234\272\257A}C\321\325\033A\343d\3260K)\321\0321amb\250\314D\335W\302Y\213\225\325hx\305\034\377\301\242(\370\300\327<\002+\270\373X\303\332V\317\336\357\352\327\232\352\331\267\bT\325\203\350\201\003\212wIP{\032\264\220\375\247\240]\002O\3251\352p\254\337\221^\022\361'\323\261\317]n\250\t.\365\226B\b\002f\340s\023K3\277Z\\\356/0\304z\221\340\342\324uX\351e\201\220\371\277\f\241\341\335\220\271"
+	.string	"\377\036\234\206\002\277\256s\2301\372\025\313\322\235\362\243\200]xf\020"
+	.string	"\343"
+	.string	"\200\022\261\234\253V\361\245`\373\301\313bs\345\202\320\322\022p\212\324\t\231)\234\221\234\272\b\231\323"
+	.string	"\236&9?\340\346>\311\356\003/\272c\311)k\240\002\2426\020\221\303g!\3370\212\351\354\232\324\345\204\0313\370R\273\312\246\375\377~\200\3527J\fo\325\016\013A\023s\021L\326W\023\2367cs\200E\257\023\277\017\013\240\f\267\230\031:\316/2\372\262_@\326(*K\336F\2755;\351\263\276\371\bCS\004\023n\321Y\001\213\262\003\224!\372>\236\353\2669\311m?\262\013\256\022X\353\201\343E%A\224\313\032w\n\220\222\020\267\221\210\333\342\206\2611\245\376\365\2615z\254\337\254\302\306^\365t\3359\375\372X\025q\255yD"
+	.string	"\330\275\002e<\372@\035[\332\374i\376\312\274\232V\016\346\243g\344\371\350/\374\223~\022\233\361u\323\324e\316\201xs\\\003|>Sy\332\200\b\201\253\314\340\252\203\261\362\f\026\237\261\013\261O\303\243\f"
+	.ascii	"R\007\373\374F\362\313\205B\255\306A'mn,\027x\257\204>\301oM"
+	.ascii	"\334Rn\275\023L:?\340/\350n/q\212\372/\270\007\316,O\276\253"
+	.ascii	"\366\022?\2214\316\233\022\231\034\212\234)\361?6\210T\343\360"
+	.ascii	"\240Q\264\245Sa\340r\035\003.\335Wo;\234\357\201\3738\220-xD"
+	.ascii	"\263G\306\317V\037\222\t\235\023\306\306oE(\327\324\t\\\300\006"
+	.ascii	"\204Dn\033\177L(2\325\226\243\226\257\376\352>\002\206\207=\020"
+	.ascii	"\216\203\030 a\357lI\"\013x\312\246\306+qn\273$\335\020\220,"
+	.ascii	"\026v\374\300\202\234\020"
+	.ascii	"\372\216\212$oR3\222[\226\013\263\336\016\207\031Tc\302\317'"
+	.ascii	"vn\243E\224\021\fTj\376^\223\255\0378T>\351E\016`\224\264d*\202"
+	.ascii	"\n!\r\313\026\205\360\022\244\224O!\323h\"\226\301\311\004\356"
+	.ascii	"\360\026`\207MQ\303\327;(@\347\234\255V\023\256\355\3621h2"
+	.string	"0\035F\257\325'\314@\350\003\222\304\357D\fT[\230\254\274cib\n1\304i\206i'\277\224\005\246\302\332\311\200\232\246\2119v\226]j\315\n\254h(\323h\fT\206\252\225\216j\247qQ\236;MdX\267\017\220\236!\312\233F\234r}P\372:tLK\327\366\350\"\323\026\257\033\215\350V\265c\362\337\333\004 \b\217\233Z\370\310\036\303IQ\264\220\022\225L2y&\230H\334\021\255\346\360\261\025G@a\264Q\204-J\346\347\250%\326|\247\372t\322\220\035\234\312\3758\034\270\252\206\333Ogs\027C\376\237u\322\244\245RB\324\200\237\251\214\351\322+\264[\250\234\205\037N\241:\313(\005c\367=\305\024\024X\244\361\357\r\322\005\035`v\216?\"hk\345s`\327l\374\222I?\335wY\245\030\340\200^f\343\312\203y\320\200\223~\207\305\306\310\302\027\332d\326\352\300\222'j\377\334Z"
+	.string	"\310\331r\334\373\240\320\224\323\023\241\271\332\253vh\247\244\352X\260L\363\316\236\030\362\336\302\351P\311\205\200s\204>c(@\300\227\210Q\347T\360T\001\314\203Gv\001\260^;\377\375\\[\004\260\t\022Y\250\200wV2\222Pu\333\330(V\034\374\b\272\311\266\344-Y\250+\274\007\322\236\003QvM\361\351\2700C\017\025@R\376\033\037\343\r\323\215\254\324\353\231~\334C^\203\241\306:\303\206\367\221o\003\n\3109z/~\333\320\322\276[\2212\377"
+	.string	"@fl\252\222\376\274\366);0\342\365\225ffV\3143\233\201I\220\367X\362\356<|)\337\023\036\331\310\206\352L"
+	.string	"\020\255\300C\347j6\245\025;^F\341`\340Q\311+y\r\357\350\374\026\031']\2460]hV\315\375@[\205\335\003\265Q\301yp\246\272\243f@W\017\240\024\227\270\035\250\252\033\371ify\343\355*^\275"
+	.string	"\261\354a\202V&\254\317\375\302;\236\222\203+\374q\262\223\023\230c\251?\324\370?\357q5\211\336\261\263}\006\0132>\352\272\276\227\021\317i\335K\307/$\201K\013\367\321\254&^2\342n\365\275-R#\274'\3416\016\003\351\0172\270\2520\373\362\214R\253OX\362!\023\177\026\376a\360eQ\365\346\310}\247\313\003Z3\340\355<\2553)\360\350\372`P\214\177\241\022\036M\303\343\303\362\274\303i_\037\002dz\206\3341\311\342\342\034\177\366E\211\362\016\276o\027\f\247v\351\242/\251\022\007%\326\036F{~x\236O\364\264\210K\376\363\005.\373|8\234!d\017\340\3674D\320\t\266\303ae<?\371i\336\351:\263o\335;\323\357z\376\\n\276\343$\016\210=\006\275z\271\246\257-\330\375\001\302\037\b\226+Q\335\001\272="
+	.ascii	"-\230\315\371\370\331Sw\356i>\244\220\256\367}J\301\267\020h"
+	.ascii	"\227\023\275\370\375{\261w\307\311\346}\316q\036\0321\234\271"
+	.ascii	"\275\211y\354\333a\001\347P\265\023\3610\017\326~\027>`\277\037"
+	.ascii	"\273ST\031!\360)\257\342\213\277Yq\252\t\307\025\337\3013\316"
+	.ascii	"\350\351\256x\335Q_s\2345\266]-+\316g\t\034Y\324\033\016r\367"
+	.ascii	"\177\034\226\nG\330\177wjo\336\346(\214\236\263\224\027\377\336"
+	.ascii	"\023\307?\004{_\206\177r\336W\337\241\326S[\247\337/o?\367\201"
+	.ascii	"\236\036\314\2325\335\371\006\333\206x\371\312\366}\331b\005"
+	.ascii	"\255^-\356~\332q\035\360\373\237n|U\217o\270\273\377\017\367"
+	.ascii	"\026Q^\350\300\353\201?\236HS\223\205\370\267\367l&\272@\373"
+	.ascii	"\252\263W\274\354E\035\036\224]V\361~q\256\331Z\006\255\272\337"
+	.ascii	"\305\213J3\266\310_p\366\275\371E\301E\371Y\020\355\333\340\306"
+	.ascii	"\253\033\036\037^-\262Il}\257)\271\326[\375\245\203%\263W\277"
+	.ascii	"\t\311\317\002o\227\1773\212W\362\304\314\005\3536\347\264?\246"
+	.ascii	"\336Q\324\321\"\345\251(\347\312<)\265\037/\257\334\374^\231"
+	.ascii	"\234\246L\277\270/\337\214\220\023\035bxB\016n\331R\373\255\177"
+	.ascii	"p\244\327\337\321\3219\254\370\2421V\264vW\036\311x'wb\\h\323"
+	.ascii	"\177\300}\256\225\013}\346\006R97k\373\267\216\305v\236\237\006"
+	.ascii	"\227\327\337\243\3367\347\214Ca\325n\367W\363\366\251\232\317"
+	.ascii	"\310\370\223\303\377h\362}\331N\245\340\275\257r\3433\325\177"
+	.ascii	"\211l\0042\365\244\367\tl\333j\341U\240n\213\257\367\216I<\034"
+	.ascii	"U\314\366\231\237\330\304'-\376\233V?\002\244\245\353\371\212"
+	.ascii	"~\371\214\344\315acVm\252s\030\275\325Z\232}T\3770\261\223l\275"
+	.ascii	"@e\367ON\237O'Y'W\257\037\367Y\353Rq\237\336\206\266j\263=\013"
+	.ascii	"\265\370\242xMQ7(G\364\335\2700\262\261?\230[\237\rMg\241Jw\262"
+	.ascii	"b\270\016@\345\203\365\254\322\330%g\305\231\255\241\235\023"
+	.ascii	"\303m\031\237\226Zj\230\343\265\355\230\025aW\273:\306\246./"
+	.ascii	"\310\177\266[?6\357\234T\376\004\224\261\177\355"
+	.string	"\342\231\016P\"\264l\303\017\221}\033\217\033\027\300\202U\257\020r1\003>:3-O\245\362\t\002\216@\331\323xyfMs\265x\341\244\217Q\343\026#\350\365\241\035\025\356\026'\217\r\315\261\275\032\n5\273\277\362i\372\314I\367\205\360\331Y\376\326\324\273\267\027\006\364\244\207I\317\322\371\3370\342v\240\314\312\2343\312\346\231\375\360'L\367\003\335\324{\031\221\261&\371\221\306\361\326C\237\3762s\262+\240\3347\224\371\227 \273\240\335R\374a\342w)\266\337\375\032\325\2630\337\n\222\357\230\367\263\256\351U*\037li\203\212\007o\374/\216\217\264l\241\366\330\2618\006\345\343A\\b\322\345e\336=b\362\t\257\315\317\037\206\377\322\215\241\357k\244\356+\320\344>Z\346\245\363\233/y\340q\0060x\336\207\337k\335;\f\0012\3560E5\317\350\2736l\316\213\235\373_\321\376\002\016}\377i\264\234"
+	.string	"\310\252\320\215\364\370\361\364 \316]\377\304\1779r\363A7c\234\365\214/f\262S\350\305\r\030\211\337\316\307\334O\321{>\020w<\004\373\365\3136>a\371\303\254\274\271\2178\364}\305\212\354I\322t\303xXb%\277\214\031.\272:\315\327%\030\202\273\203M\210\205\256\376sC\376\033"
+	.string	"\225+k\340\376WDy6\366]\201}\303\226v\253\302\213S6\323J\264\271\337\231_\n\270)\361\377\177\375;\217\277bq6\302u\271yK\375\2365\257\025\366\266\343\352\266\003G\177\326\303d\335\376\342m9\r\376Qc>\230p\3409\267\241\275~\334\304\226\2768%\257\270M\017t\343\0055\177\204r\217"
+	.string	"q\255z\033\022\016\211h\221M}\355w\253\303\213\375\366\257+\027\366\177,\367\306\216\221\275\321\365\263qp\257\304Xv.\214\0343q\220\231#\023\0371^!\256\215\205\271\223Y\2612\334\035\237\232\357A\034\035\372\264\375]\213\356\255z\300\355\007w\306z\302\037\340\366T\025\316\303\347y\345+\207E\274\013\261~"
+	.ascii	"\317\370\257\226{-\3775\031\366@fd\333D\202'\005\261\300z|0\207"
+	.ascii	"\335\254"
+	.string	"\364_\276\200\236\346\361qus\343\342\312\320\005\254\\\030\273q#\370\035\221Y\250\037\343\212\247\352\250\236\274\256#\225\360\354\342z\265\266\263\233\350\346\267\251/"
+	.ascii	"O\036\325]\002\336O\026H\026\322\310\241kc?\244\310\244^\263"
+	.ascii	"\366n\355jD,Ki\037kO&\374\213\235\f*\321f\227B\307;|Jv\326\321"
+	.ascii	"\007&\260:s\353\230HM\r\334I\336\273\241\247\312o\376\216\007"
+	.ascii	">\252\no\030Z\215vn\027\215\275\334\355\231\265]\332\346T\235"
+	.ascii	"\335\215=\026\fC\236\276\322\207\320\367)\346\271\"\031\323\r"
+	.ascii	"Wyl6\232\350l\021\006\003]1\021\277k\3217\375_\210\r\223\312"
+	.ascii	"\213\365\037\214\205\376\003"
+	.text
+	.section	.gnu.lto_.symtab.886e5061ff6073b3,"e",@progbits
+	.string	"blackboxConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\b"
+	.string	""
+	.string	"blackboxMayEditConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\t"
+	.string	""
+	.string	"blackboxBorrowSnapshotRing"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\t"
+	.string	""
+	.string	"blackboxValidateConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\t"
+	.string	""
+	.string	"blackboxFinish"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\t"
+	.string	""
+	.string	"blackboxLogEvent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\t"
+	.string	""
+	.string	"blackboxCapture"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\t"
+	.string	""
+	.string	"blackboxGetDroppedFrameCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\t"
+	.string	""
+	.string	"blackboxUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \t"
+	.string	""
+	.string	"blackboxCalculatePDenom"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\t"
+	.string	""
+	.string	"blackboxGetRateDenom"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\t"
+	.string	""
+	.string	"blackboxGetTaskPeriodUs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\t"
+	.string	""
+	.string	"blackboxInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\t"
+	.string	""
+	.string	"pgResetTemplate_blackboxConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\t"
+	.string	""
+	.string	"blackboxConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\t"
+	.string	""
+	.string	"blackboxConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\t"
+	.string	""
+	.string	"rcModeActivationMask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\007"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\007"
+	.string	""
+	.string	"pidData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\007"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\007"
+	.string	""
+	.string	"acc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\007"
+	.string	""
+	.string	"mag"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\007"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\007"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\007"
+	.string	""
+	.string	"motor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\007"
+	.string	""
+	.string	"baro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\007"
+	.string	""
+	.string	"servo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\b"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\b"
+	.string	""
+	.string	"batteryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\b"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\b"
+	.string	""
+	.string	"blackboxHeaderBudget"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\b"
+	.string	""
+	.string	"motorOutputLow"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\b"
+	.string	""
+	.string	"motorOutputHigh"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\b"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\b"
+	.string	""
+	.string	"targetName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\b"
+	.string	""
+	.string	"shortGitRevision"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\b"
+	.string	""
+	.string	"buildTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\b"
+	.string	""
+	.string	"buildDate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\b"
+	.string	""
+	.string	"pilotConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\007"
+	.string	""
+	.string	"motorConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\b"
+	.string	""
+	.string	"voltageSensorADCConfig_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\b"
+	.string	""
+	.string	"currentSensorADCConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\b"
+	.string	""
+	.string	"activePidLoopDenom"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\b"
+	.string	""
+	.string	"controlRateProfiles_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\b"
+	.string	""
+	.string	"rcControlsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\b"
+	.string	""
+	.string	"gyroConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\b"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\b"
+	.string	""
+	.string	"barometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\b"
+	.string	""
+	.string	"compassConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\b"
+	.string	""
+	.string	"armingConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\b"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\b"
+	.string	""
+	.string	"featureConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\b"
+	.string	""
+	.string	"GPS_home"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\b"
+	.string	""
+	.string	"gpsSol"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\b"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\b"
+	.string	""
+	.string	"targetPidLooptime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\t"
+	.string	""
+	.string	"rxAreFlightChannelsValid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\t"
+	.string	""
+	.string	"rxIsReceivingSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\t"
+	.string	""
+	.string	"failsafePhase"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\t"
+	.string	""
+	.string	"getRssi"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\t"
+	.string	""
+	.string	"getAmperageLatest"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\t"
+	.string	""
+	.string	"getBatteryVoltageLatest"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\t"
+	.string	""
+	.string	"getMotorCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\t"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\t"
+	.string	""
+	.string	"mixerGetThrottle"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\t"
+	.string	""
+	.string	"pidGetPreviousSetpoint"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\t"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\t"
+	.string	""
+	.string	"isRssiConfigured"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\t"
+	.string	""
+	.string	"blackboxWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\t"
+	.string	""
+	.string	"blackboxDeviceReserveBufferSpace"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\t"
+	.string	""
+	.string	"blackboxPrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\t"
+	.string	""
+	.string	"blackboxWriteString"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\t"
+	.string	""
+	.string	"blackboxPrintfHeaderLine"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\t"
+	.string	""
+	.string	"castFloatBytesToInt"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\t"
+	.string	""
+	.string	"dateTimeFormatLocal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\t"
+	.string	""
+	.string	"rtcGetDateTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\t"
+	.string	""
+	.string	"getManufacturerId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\t"
+	.string	""
+	.string	"getBoardName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\t"
+	.string	""
+	.string	"getRcSmoothingData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	"blackboxWriteSignedVB"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\n"
+	.string	""
+	.string	"blackboxCommitFrame"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\n"
+	.string	""
+	.string	"blackboxBeginFrame"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\n"
+	.string	""
+	.string	"blackboxWriteUnsignedVB"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\n"
+	.string	""
+	.string	"blackboxWriteFloat"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\n"
+	.string	""
+	.string	"blackboxWriteTag2_3S32"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\n"
+	.string	""
+	.string	"blackboxWriteSigned16VBArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\n"
+	.string	""
+	.string	"blackboxWriteSignedVBArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\n"
+	.string	""
+	.string	"blackboxFlushBits"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\n"
+	.string	""
+	.string	"blackboxWriteBitPackedGroup"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \n"
+	.string	""
+	.string	"arraySubInt16"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\n"
+	.string	""
+	.string	"blackboxWriteTag8_8SVB"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\n"
+	.string	""
+	.string	"arraySubInt32"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\n"
+	.string	""
+	.string	"blackboxWriteTag8_4S16"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\n"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\n"
+	.string	""
+	.string	"areMotorsRunning"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\n"
+	.string	""
+	.string	"isModeActivationConditionPresent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\n"
+	.string	""
+	.string	"getArmingBeepTimeMicros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\n"
+	.string	""
+	.string	"blackboxDeviceOpen"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\n"
+	.string	""
+	.string	"findSharedSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\n"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\n"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\n"
+	.string	""
+	.string	"isBlackboxDeviceFull"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\n"
+	.string	""
+	.string	"blackboxDeviceClose"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\n"
+	.string	""
+	.string	"blackboxDeviceFlushForce"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\n"
+	.string	""
+	.string	"blackboxDeviceEndLog"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\n"
+	.string	""
+	.string	"blackboxDeviceFlush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\n"
+	.string	""
+	.string	"blackboxReplenishHeaderBudget"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\n"
+	.string	""
+	.string	"blackboxDeviceBeginLog"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\n"
+	.string	""
+	.string	"blackboxOpen"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\n"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.886e5061ff6073b3,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
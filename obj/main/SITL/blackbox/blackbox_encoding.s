@@ -0,0 +1,1083 @@
+	.file	"blackbox_encoding.c"
+	.section	.gnu.lto_.profile.8171f4206f61da54,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.8171f4206f61da54,"e",@progbits
+	.string	"(\265/\375`\317"
+	.string	"5\006"
+	.string	"\264\t\303\001"
+	.string	"\025"
+	.string	"\342\203\351\365\f"
+	.string	"\001\365\347\226\203\r\f\002"
+	.string	"\240\342\234\212\n\003\004\241\233\373\317\001\004\002\001\005\357\350\332\204\n\002\006\346\371\265\305\006\006\002\003\002\002\002\b\363\323\275\211\n"
+	.string	"\t\216\243\313\354\001\002\n\252\212\212\215\003"
+	.string	"\013\242\247\237\212\013\f\213\215\316\230\r\002\002\004\002\004\r\353\206\240\252\016"
+	.string	"\016\340\253\276\213\016*\017\245\277\256\207\b.\020\311\305\223\252\f\026\021\253\356\273\246\004\022\317\255\371\305\002"
+	.string	"\023\223\365\272\314\001\b\024\324\230\357\263\006"
+	.string	"\025\274\320\320\213\f"
+	.string	""
+	.string	"\020"
+	.ascii	"\224\213\324\325*\n\330\200\247g\340\201\243\002j\231#\220\031"
+	.ascii	"\336XS\376\251\302\312\345\301Y\223\233\223r\225\271\27240\004"
+	.text
+	.section	.gnu.lto_.ipa_sra.8171f4206f61da54,"e",@progbits
+	.string	"(\265/\375`\266"
+	.string	"\265\004"
+	.string	"R\305\016\027\2605\215\001\f\243\034\206a\030\206nBV\272\211\210\310f+\233L)\332\314,\3535\362,e5\300\233\356\300\344_\344\017\243\360\211\025\331m^\247~\020\336\376Z=j\231<\020+ \300\002)3n\t\tr/2\336:\2608#\260\257\234V<\277,'\233\360\004g/{\302%A\341\214\022A\200p\311\250\225\375\263\007\314\006gK\261\200<\3420\340"
+	.ascii	"\363lE,\306\306\350\211\027K\034\306O\344\3007\260x|/m\230\335"
+	.ascii	"\342\203X\204\035|1\207"
+	.text
+	.section	.gnu.lto_.inline.8171f4206f61da54,"e",@progbits
+	.string	"(\265/\375`\037\007]\030"
+	.string	"&bwG\320\324I:i\202O`\326B\211\346K\353\246l\030\"p\314\307j\233\2625\317\021Bl\341E\220\256\213\202\002pm\013s=\256I\363"
+	.string	"\231\204\035\274A\256f\220\013\004\353\322\366\236\034A\324\020M\264MH\333;\311\024["
+	.string	"h"
+	.string	"e"
+	.ascii	"O\273K\200Em\265\264\215\262\251\265&\356\330\335\216\245e\227"
+	.ascii	"\222c`\027U\273h\313X~\026o8\3514\031\340\"D\024B V\270X\352"
+	.ascii	"\315"
+	.string	"}\210\204\036\016\334\326\2333M\025\221\032`u\fT\333\257\333\227}ww\263)\354n\216}\333\333U\325J\023M\354n\313^\361\\\t\376*m\263\353\n\\\257p\307\230\245\264\215;\216\271\034#\246+\r\215b\231\270\273\035Pb\016$\")IL\222\002b\321]\345 \311\240K\263\270\301\307\321\013\035a\230\314\347\325z\322Ym\"Oh\243\326\335D\247\023T1`~\201\006 -}\b\032\335\272\326\270\354\262\315w\250\302\034\023t\322\341\361\362\264g\346\354\001\237_\203\250\242EX\025\375/\370\227\301\233\226\262\260\244\256\203\367\270\020\204C\001\317\357{\020}\200\216\004u\236\237\347\007\363\037+\035FZ<\277\2360\027Bu\244\244\363\364\224=\250jj\311\213?\375\031s\253&\037\2606\177-\213F\273\313\371\337\327\300]\265p2\243\350\221h\310S\332\326\2422T\205\224;-\216\002fbg\223\342"
+	.ascii	"\216\201E@x\206Th\256D\003\007\023\314+\216\201r\306\367D\035"
+	.ascii	"\205\230V"
+	.string	"\231\322\273\245g\351\315\276\203\241\306\220\027K\357\263\364b\"T\315\005\321-\277PC\211'\351\3172\271MP;\201r\227\2406\002\345\216\243\322:\213A=H0\\\234bEJ\301\004JI$\375\374\2509\312\3367\035\200\206\250qQ5#B\233\202\324\2435p\002!\032\262\332\001\022`cA\306\001\235B\bIDB\221L\222r\313(H:M\0277\321jf\375\020\255.\373\215\224\221@\237s\"\231E\346\373]\224\2429J5\006\325\311\341V\261\303\365\217@\337s\361\013\216\205\226\372n\204*\"1\200\253\371\031f\256x\272&\302\025\326\345M\267D\024mB.\216\276$f\214\324v\221\245s\032\244`\003U3\355IG\035\353@\306\304ZQB\376\002\345\222I\023'\357U\005R\260\005\366nf7\236\337\\hsac\1773\017\262(\331\233Ji\002/\345a-\007\313\"\272_\005\314\257\333f"
+	.string	"\222B\206\205\211J\236E\001z\350\001\003\371\037\303H\356\2131\345\031\177 \\\355"
+	.string	"\367\002\027N\001S\321\357yW\034?\2165\354\245]7<9\324\346\241\013\232\025\312S\377@\005\007y\200\260e\312A0\220)\2615\244\004dc\302\275\253Lp(\016+gG\302\b\032\270_(z\377\346\016"
+	.ascii	",\245\030\322\343F'\323\353H\206\342\267Q\252\006\364"
+	.text
+	.section	.gnu.lto_.jmpfuncs.8171f4206f61da54,"e",@progbits
+	.string	"(\265/\375`\322\005\025\016"
+	.string	"\366\0203.pi\222\016|V\325i/$2-\001\326\fTUUql\321U@\315TU'HO\0137ckk<\242\331G\255M\033\"\2154\231d$"
+	.string	"#"
+	.string	"&"
+	.ascii	"\0204)X!K\030\227\260\016Yd\264\326x/\200\336\324c|\347\355U"
+	.ascii	"\361UM\226\365\244\222\372\322A\266\tT\227\276\214|r\327|\303"
+	.ascii	"\274u[\330[0\213>d\302\301\215\356\013\373\013\353\\(\325\373"
+	.ascii	"Pdr\257\\\255a2\231\027\305\233"
+	.string	"xC\322\345\363\001\237\271\265\037\214?\332S\357\371\210\344p\"3\334R(\337\332\341\253%\251\001$\311k\324@\201!\254\006\0258x\257\027_\202yk\240\242q\347\315O,q\304\214\312C\247\352h 4\234\257^\360#\201\003h\250AY\206jH\222l\354\006P\"Q\214\316<\022\340\0235Da(\210\221\"$\201\004\022C\201DB\031&)=\252\331=\020UdO\2430\215\372\364\331\231\001\001\312\240|R\301J\302W\001\367\245\005$!Hco\263x\3705U=\323h\002\234\002\327\306\272\240\2061\n\3055\340 \017\007\032Ha&\003\304\233\341\333\265\226\330\0370J\232\336\200\326\262\230NW&\267)\236\354\311&\315\366\t\333V\334\331l%\226\340\n\242\246\217\024\255\347\377\216M\323(\301b\227\215\303Y\240\225\307c4N\2243U\223@\bT`\267\254\212Vg\363;v\215K\325.Z\264"
+	.ascii	"\242H\243\030\252L\003(\240\210\246\243\320\376\324\215&H4\""
+	.ascii	"\021!\344\214,\241,\206\223\r\232g*_\036\b1\030#\346e\267\307"
+	.ascii	"8\024\273\237\"U\222+<\354\256\034V9\240\007"
+	.text
+	.section	.gnu.lto_.pureconst.8171f4206f61da54,"e",@progbits
+	.string	"(\265/\375 >\361\001"
+	.string	":"
+	.string	""
+	.string	""
+	.string	"\023"
+	.ascii	"\230\004\001\270\004\004\231\004\005\230\004\006\230\004\b\270"
+	.ascii	"\004\t\231\004\n\230\004\013\231\004\f\231\004\r\230\004\016"
+	.ascii	"\231\004\017\231\004\020\231\004\021\231\004\022\230\004\023"
+	.ascii	"\230\004\024\230\004\025\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.8171f4206f61da54,"e",@progbits
+	.string	"(\265/\375`7"
+	.string	"\365\003"
+	.string	"R\204\017\032\220E\351\377\377\177\371n#j\331\375V\3201\n\271\261\366\313\267\344\266\031)S\267'j\356\227\331\312]\tD\344\330H\252\230h\3559g\034\232\024\340\311\253sW\006X\203\333\327\302\223\t\032"
+	.string	"\200`\026A2\b\306\007\332=E\213\234i`"
+	.string	"^\350\250\025a0l7\230N!X\254\320(b?CLjg\244HY\252L\317\001\240\302\021E\030\f\273\233\3013\020@\364"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_.lto.8171f4206f61da54,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto__putc.16.8171f4206f61da54,"e",@progbits
+	.string	"(\265/\375`L"
+	.string	"\275\b"
+	.string	"v\021>80\345(\035\236\213\027\340z0\301\204\371\232\202\223\245%E\3136>\310!\311d\374\026P%\376-\217\331hG\276lA\241<\250\302M~\t\260\360!\334\231-\371R\246\024,"
+	.string	","
+	.string	","
+	.string	"\3166&\3108k\327\002\360\3738he\205\022\340\277\226\036\356\214]\355\023\013\260Z)\243\206\341\177\221\325\332p\323m\r\332\202\332\272\004\207e, m\315i\233\330\"$t~\027\315\237C\345\365\337\323\005ck\022\227t6\351\213\007~\327\310\353\177\236*l\234\365\271\223\t\250\n4\253\005\031\231\252\023\323\231\316\206\226\325"
+	.string	"\025\306\332\227\302\354h\215\371\377\246\253\365\2633\261\210\301:\303\t\351\244\374\0321\001\001\233M\356\366\201(\221\036\270\2554r\260\340D\021[HB\244\225H\241\tm;\241\264\317A9\323\350\244Qp\334I\343\274\033\363t5\023\201\251\022\243\032\304l\003\n"
+	.ascii	"`\251'\023\372\374\002\213\013\316\313\250\340\032\373*\fVP\241"
+	.ascii	"\307\035^\264\223\f"
+	.text
+	.section	.gnu.lto_blackboxPrintf.18.8171f4206f61da54,"e",@progbits
+	.string	"(\265/\375`\364"
+	.string	"\265\f"
+	.string	"\226\230XC\020\221\232\016\b\301\241\b'4\371\004\362\216\203\374\b\237\324\332"
+	.string	"J;\224\004\021\372}\320\377Gg\244\221\177r\214w<\321\240F\374\357$"
+	.string	""
+	.string	"\232P\325\357\033\027\254\273e?\347h\212\204 K\233\310\235RC"
+	.string	"C"
+	.string	"E"
+	.string	"\273,\241\213\335o\201\031P\237\376(\333>\212\2174\033F\204\023\251\004\r\024P\307\356Z\007>`\372\224.`\372T\022\327.5\377\340\021\300\344\350T\266KMgw-;\225\020\267\336v\002\333\016\354w\b:\343[of\007\0273_\230\270\313o\337\207yhW.\371\213\265\205\314\312hw\253\022\273\372\274\255\371\240+\273\345+\264\273\230tD)\322\t\033\342.\210\315\247\033P\237'pi?\305Uh\3776<@8dVF\252g\021\342\241v\271w\326\375P\344#\337M\372\360\020<\210\243\210\242\233)\271\371_\016^(\360\241\263G0\310w\276\2272\212'\272\331\237H\352\b\373\322*\213-IO\377~\245\f\304\270!\243FW\006I\362\241\240\3068! \317\204\f\003\201H\320\220}\210`W\205\017\013\344\271>\026\026\032\2618\n\234Y"
+	.string	"\tY$Y\026\262\252\217\273=\251\306\213\031ENE6\221vE<\020[\344\214\001\310\013\003?\275p\0249\350f\0179\003\023"
+	.ascii	"`\251'3 \f\013\263\2608\023l\220\030\027\344ku\372W\273$X\353"
+	.ascii	"\2720r\333lg\203\001\233\262\030\f\341S\344\340n\217j\245#L2"
+	.text
+	.section	.gnu.lto_blackboxPrintfHeaderLine.19.8171f4206f61da54,"e",@progbits
+	.string	"(\265/\375`\340\001\365\020"
+	.string	"\246\337oF\340\324f8\244%\026^\006 z*\242\021\366\200\327\342\345\242B\335\336\367\314\215\201\342\205\200u\205\203\266F\226\316\250\201[r\340\351iZ0|\020gH-\004.\006L+\222\206(\f\343\200i\204\264\311\336R\246\024X"
+	.string	"U"
+	.string	"b"
+	.ascii	"k\243\303\322\2233\356\352\240\234\363\212\351\334\017\210I\036"
+	.ascii	"<\355\013\035\307\353C#>`\327\347\307"
+	.string	"\216]1\305\fL\347,\276@\351\234\351&\245s~\331E.\376\354\213pndGv\367S\030\177=_\376e\007\020\356\300\236\335\312\356:\303\235\024\267\336\266\002\333\021\354\004\003\371\320'@:\264\221\204\302l\261&\365\205\375mw\327\352co\351\323\305\337\373\320\337mi\335\322\271\245O \200\020\317\212\036\024*D\334\234\032\222X\022\307C\306\215~\373~\216\317l\3173?r\003\034\026<B\273\353\315\330\336\271_f\317'z\321\353F4\017\246\320\222\017[J\347\256]\213\0367T\304\262\346.KN\202D\003i\341\302e\257\020\364C\033MR\203\247\327\201!\203i7\366\360\273?sA\345\303\223~v\026\023#m\274Q\230\005$\312\177t\231\n\301\211\320\206Y\235\200\206\320\306\022\016l\224d\2476\013\254\221\240D#\251K\317n\244\222\035\003\"\250\020)\303\342\240*\026\252\2659\245\002\323Zm"
+	.ascii	"S-\225\213\b\360\245C\n\345\341\345k\255P\254/\345\212\371T\026"
+	.ascii	"\030\374\240r}2 \350\372<1\366m\325\307\022\202$\305\264\306"
+	.ascii	"4\333\256\013\b7\372G\242\254Y\025\310C#\251WUE\262\231\221\362"
+	.ascii	"\223\246nDlxj\262f\337\307\177L\360c\004' p\202\021d\306\003"
+	.ascii	" \352\215B\333\033\203\351\305(\020\327<\202\f\025i\216o\254"
+	.ascii	"01w\205\241Q\032\027\216/V\323\027!P\200_^\001\234\275\325 k"
+	.ascii	"\223\201\007\313\265\036\327X\356\n\235\007L\255k\306\230 b\027"
+	.ascii	"(H\024\334\343\230sh\216\2035\"\300\243\200\227\027\355#\003"
+	.text
+	.section	.gnu.lto_blackboxWriteUnsignedVB.20.8171f4206f61da54,"e",@progbits
+	.string	"(\265/\375`3\001\235\r"
+	.string	"6\332\\C \217\223\016}\026\372q#\372\013\001\205\320'\024\250\256fJc\340*o\306\315\361\312\030\316E\354o\333\372*\f^v\2546\323\r\264\030\b\002\203\006r\376!V\f\304\217,\203o\230j\t\331[\312\224\002H"
+	.string	"G"
+	.string	"G"
+	.ascii	"\006\331.\236J\331\257\250p%b\354n\246\036\f\023\364\b5A~\232"
+	.ascii	"Zt^\350\021^\244\223\017\031\036\tv\250`\\\216z\232"
+	.string	"x\243\204!J\327\243\016Eh\370:\257\364\274\024\354\256\263\363.\334\326m\177\330F`\237\013N\205\262#E\005c\355`o`Z\203\375\364_?\335Q\323P\323\232\351\314\3643.\f,\006\274\330=\371b\366%\272\200\300l?\355\253\234\004\350'\022\003\330\345\320rb7e\300\0072\217\032\027`=\302\007\260\036\003j\230\227F5\361w\022+\352\206\205oEEI\252\340\356.\364u\243\260\242b\232\300\324Rau\245\252-2\222\357\254Q\242!\247\252\336\304\367\004\254k\352\271\322(?G\27520\261p+Q~\312\222\202\344\251\2428\235\221\020\316\204h\215\303\201\007\344c\323<\235\006\0246\217\007\032'\304#\363\200p d\332G$\343(\340-B\347\223I\330\266O\206\245\366\020F\335,\310\360\"\322\221\257\204\032\205z\3247L+\270\325F5\352\354`\210\362\213\212\342\243\236\211\031\261A\261\031"
+	.string	"`\251\2473\020\216\315\315\276,\206>0\222^\314\353\030mpV\241a/l\r\325\022"
+	.ascii	"\205\031f\243@D\313\035\026\323k\261r\261\226XM\t\356\305-U\252"
+	.ascii	"\226\201z\331$\314'"
+	.text
+	.section	.gnu.lto_blackboxWriteSignedVB.21.8171f4206f61da54,"e",@progbits
+	.string	"(\265/\375`-"
+	.string	"\365\007"
+	.string	"\242\01787@s\322\001\030L\3023\222\225\355\177U\362\026Fq\325\374\271\317EN\215A@\341\370(\237A,}\310\023@:V?z\027\266\034\323\300V\302\366n\215l\"eJ\001\231\004\351\232\200\306B\f\332ha\303\264L\241b\0235`\027I\024\265\321\345\0201\256\024C\004\336\0362.Fl\033\027?\250}\265zrBI\nC3\334\311\253\rQ\312\177\006\301T\265),\362\3375[FR\032\352\331(/\365\303~\265\273k=\331G\3715\323\2678$3\0021\273\03476\233\2020\"\037\333O\373&?\351\216ra\317\256\207\313\313\356\026\330\240s\bz\200uX\035\300:tg\323\034\025\262_\221\331`\251\331\335\250 \357\236\235\377\224{>\223\367\344 \354\256\3633u\334z\333\003\266\017l\253\004\n"
+	.ascii	"`\251'\023\332\370\002\307\005\003g\030\001\243.a\021\253\321"
+	.ascii	"\340./\332I\006"
+	.text
+	.section	.gnu.lto_blackboxWriteSignedVBArray.22.8171f4206f61da54,"e",@progbits
+	.string	"(\265/\375`\307\001\375\020"
+	.string	"\226\341rE\360\320&\035\372\331\374\365R\036\027\017\217Q?\355\317_\265\364\226\227,\206\374\323cE)\025\2552\0232h\243d?\327+\034\351lE\264\004\317\3003\250\274Y\220\257Zg(\241]\270|\t\265\246\326\366\2262\245^"
+	.string	"]"
+	.string	"["
+	.string	" N\220=\272\373\200\321cv\001\243G\267\354\032\357p\366\261\0270;7v\367\244\032L\372\276\357;\354n\230\255G\250\331\362c/"
+	.string	"\213\361\342V\036!\311E\206C\007\347\002E\212\210\200\356=c8\226\204\036h\256\367~"
+	.ascii	"\346\363\342h\236\244\005\273\353|q3\367\350\266-\330n`\347\003"
+	.ascii	"0\2350\375\016\222\n\030\004\274]\231\017\307\016E\240\016\347"
+	.ascii	"\371\355\373;\357I\371\t+g#\304\356\336\204\357Y3\217\203\262"
+	.ascii	"\225\013\231\027\223A\264\273\037\217f\340\024[{\274f;\273\227"
+	.ascii	"h]\307A.\355f\240\361\263\273 V\220=z\300\247\375\021'\321z\216"
+	.ascii	"\312\003\354\332\260\370\331\355\002P\375\236\215B\376\245\351"
+	.ascii	"{n\362D\f\265\350\212}\024(&\331\006_e\364\02415\256\374\234"
+	.ascii	"ZR\325\277\200\200w\213\3215\365/\037X\362s\324\353\275G\f0!"
+	.ascii	"\230\034\256\374T=!\027N\365\306\356X\362\"8EDV\033;\2465\323"
+	.ascii	"s\376\322u\376\354<w\3144|Z\003\252\237\254*l\251\230\202b\261"
+	.ascii	"P\321\251\020\b+\325\203-\265\"q\200\262\215\224\244P\021FN+"
+	.ascii	"\025J\302)\30529\205\030\3606\201\204u:\3316\326I\353\\W\033"
+	.ascii	"?\366\314[1\344R\226\2507.\325\250IuF~<jL\246Q\237\023s\321\222"
+	.ascii	"E\207\273\273\320\b\036\3254\003\363y\201\001HMU\222\177\331"
+	.ascii	"\243\224\001\" `\002!\311l\007`\365\304\300\356\221U\026}\266"
+	.ascii	"\226\313\"y\224\fQ\356\237\266\264Q\230\231\311\334dL\007\334"
+	.ascii	"V&{\020K\367UV\261dac\313;1\322p\327)l\2178\372^\031f\023i\304"
+	.ascii	"\022\264\3138\221i\206\332x\017\221\316E\237"
+	.text
+	.section	.gnu.lto_blackboxWriteSigned16VBArray.23.8171f4206f61da54,"e",@progbits
+	.string	"(\265/\375`\326\001=\021"
+	.string	"\266!sF\360\320&\035\372MU\377\225u\226kz/\2245\340!\222\336|\3459\206\375\327=\360\360\346{3!\306\r\225\354\347\212\325\361\312^\205\221\262\211lB\356\017S\241,x\016\242r\030{\2706\265&\215l\"eJ\001^"
+	.string	"\\"
+	.string	"["
+	.ascii	"\036f\260=\372\273\001\355q{\001\355\321,\033\350_\315>\006\324"
+	.ascii	"\202#\264\273&\365`Q\030\206\341\263\357\316\222\365\230i\262"
+	.ascii	"\374\330\021\300`\274\274\224\307L\264\362\002\"\200\267\222"
+	.ascii	"\201\f\005\361\034|\272x\256\314D\304\\\017^\001\f|y1O\221\203"
+	.ascii	"\335u\276<\230[\273\355\f\266!\3309 Ok\226\316,}\001\"\0321\016"
+	.ascii	"\204\273/\241\215\375\211<!\236\363"
+	.string	"\333\367q\256sr\025V\317\306S\370\2409\347\270gK\321\260\2011\241\240\335\355x\364\003\237\330\334\3439\333\371\035\005\3537\356\361h\267\303\214\235\335\365p\203\355\221#{\3327\361\023\254\333\240\234\300\356\214\317\316\356\027\276\016I\227\177\225\364:'\201%~T4\305\231F=\013\373+L,l\037|\024\355.2-%\251\352YH\344\375B\273\246\236e\204+Ckz=\370\270\001\326\242\345F+CU\320\305\212\247Jc\177\256<H\315P\220u\306\326\322%\3566?\3517\377\3509\267\226\351\030\323Y\251\227\2500t\250xrZ\255N\321\250\217\021UJB\207R\211D0\351B&\240N\024BL\252\324\211\304\204Z]0}$pWAde*\351\272\225\211\373Z\327\031?\366\r\254\361\323RWT\032\217d\224S\225\221\035\327\324e\244\232\336&\346\243\222C\317vw3/\270\246\034\f\fd\341"
+	.ascii	" K#\251\374\313\034\244\214\032% P\002ATU\017\340zR`\347\221"
+	.ascii	"U\213j\255VO\"5\n\211Q\004<\035\266Q\231\231an\3216\226Y=\370"
+	.ascii	"\022`y\206}\360\225\225\253\206\002\3420\315b]\214`\235\021\332"
+	.ascii	"\273\222\302\206\210#\356U\303h\"\355X\202va'2\232\241>\336#"
+	.ascii	"\322\271\372\023"
+	.text
+	.section	.gnu.lto_blackboxWriteS16.24.8171f4206f61da54,"e",@progbits
+	.string	"(\265/\375`x"
+	.string	"=\t"
+	.string	"v\322@80\305*\035\210?\205\224h\022J\305\320p\264\303\031C\2077\215p\177\354\232h\r\315\226X\230\001\r3-\204KC\tg\220U\n\371\274]\223R\361\216\226\354M\244L)."
+	.string	"/"
+	.string	"-"
+	.string	"/\210\207y\202xh\317N\271\013d\377\np\"Y\331\335M?\356==\377\255\007\240R\244\247\306\260\273NTJu\353m#\330^\260/\0201\323P\323Y\226\326L\247\246\177\271\250P\fTv5>"
+	.string	"\013\203&!\266\217\261\235i_\344#\336Y\027\206\273\035\255\222\335M\260\202\345p \367I\214\252\232ye\304L\371Y\313T[4\312\243|\200\241$_S\037\365z\341\370N\261R~\266\213\224\352a?\333\335\265\256\354\263\376\235\321gS\001\315i @\236\207\216\003u\034,:N\004\267\371p6\220g#\261q!\321\246\311\270\233\350\2046\212\256\013m\030\327^Wn\330\200\225\324d-a\246P5\263\004\f"
+	.ascii	"`\251'\0230\217g\340\002\277\225\034.o\034\252\367\300\304\253"
+	.ascii	"]\006$VS\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_blackboxWriteTag2_3S32.25.8171f4206f61da54,"e",@progbits
+	.string	"(\265/\375`y\022\305Q"
+	.string	"\252\213\330\035K \324RI\007\205\377\344\215g\315\005"
+	.ascii	"\\s\264['\363\313/\266B\343L\266_\007\025yl\347\321?\206\021"
+	.ascii	"\245,\3673G\234\262\270\001\347\261d\267\2161\347\337y\277|/"
+	.ascii	"\216\036\210q\005C&~\016Cz\264\326\b!I&\031\317\001\223\001\322"
+	.ascii	"\001\344\352\022\271\252\364\325$r\025\211\\=\"W\215\276Z\364"
+	.ascii	"U\"ru\210\\eA\256\n}5\350\253@\343*p\\\375\031\215\3257\256\226"
+	.ascii	"\343*\371\325\321\253\337\325\335U{K\324\024j_\210(\334\216\334"
+	.ascii	"Da\357\317\244C\016\321f66\0206\235\215\306V\323\246h\222\201"
+	.ascii	"qC&\210\"<\034\241\376A\275\206N\355\244\310\344\346\031\017"
+	.ascii	"\266=oU\f\371\231\274\323xN\203\324\250\235\024p\3165/p\"\370"
+	.ascii	"\311\331\2070\243Q\273\237\230\331\257\316\212\231=s\316)\223"
+	.ascii	"\272\300\317\244\324\350U\365\233\341\302\034\367e\2439ex\003"
+	.ascii	"gN\271*\315\3613\251rV*M\376\214T\232T\rS\325c\2710\323s[\204"
+	.ascii	"sU\3149\257\016\006JI\357Q\316\n\034\303\374\002\352\311\311"
+	.ascii	"E\023S\213%\245$\244#\243\"\242!\026BAQ@\300\237\257$\307o\230"
+	.ascii	":F\017O\224\235\211\371E\\\233\266\205\202\363S\025Nx\\\340\335"
+	.ascii	"\320\004\004L\034(\326\320\336\314\304\203\231\262\310\314\255"
+	.ascii	",\232s\236\031[\264\361\276\335y3\263\206\006\347\245\261h\314"
+	.ascii	"xCm\225|X3\240\211q\022\322\221\r5\254\221\017k\r\215\315E4\224"
+	.ascii	"1\013\263D/\214RA\030F\0313\266\035\322\302\302w\345\006!\037"
+	.ascii	"\326\234}\020\377@\261\206\026\347 1\216\352\301\205/^3k\241"
+	.ascii	"\024Z\002\2074\205\261f\026G\002\215Ei\343\215\035\236\215-\020"
+	.ascii	"\306\fh^\374\363\215RJ\230u\021n\271]L\016\235\005G\2519g\320"
+	.ascii	"\231\225\035G\036pn4\f\235\221\215GCw\3472fi{\257\261\r\266="
+	.ascii	"oV\254\241y\361\372\260\346\234\272eghV)\253\356TU\"\252E-\004"
+	.ascii	"x[\310\n\316\301\207I\336\344\376\302\266?*\0339\220\013\031"
+	.ascii	"\223\027\244B\345$\301\005\316w\242\336^%\360\036\263\300{\205"
+	.ascii	"1wA\265r\255v\245\221Wp\"b\366\202TX\007\2670W\220D\366*\177"
+	.ascii	"\277\337\247\210\351\023T\033[<{\204\240b<Q{\330\253,/%\315\034"
+	.ascii	"\262\365\243R\366*\311\227wP\355\344\357\204\260"
+	.string	"\250\256\2332\302\217M\375u\017\323\366[\377\035\314a\264\"Q\372{\007\313\214\355\236&\271\3575\236Q&\317\230\035\272b\225\335\373\234S\354'\252\312\211\255\255\002\nc\256\350eP\325\222eX\206\345\253\276b1\3170\260/*'|5\312W\241|\365\311\270\352\244\311\270*\302W\2318\316\336\372j\b_\3252\033k\226\201\260*1\2355\t\222#\036t`5V#Vc\345\340\253\033|U\203\257f\360U\f\276Z\344\253\027x\225\310\256\016\331U!_\r\362U\013\276Z\301W)\370\352\004_\005\362U\t\274\032\301\256\376\330U\037_\205\340\253\017|\325\001\2576\260\253\f\354*\326W{xu\201]U`Wy|u\307Wu\224\253\t\220\253\b\220\2539\306\325\003\306U\003\306\325\002\306U\002\276\212\303\253\003\354\352\215]\275\372\252\325W\253\276JU\256N\221\2536\310\325\032\344*\215\257\n\360\325"
+	.string	"\312\325\031\344*"
+	.string	"\344\252\fr5\306Wa\220\253R_\215\372\352\213\257B\221\253O\344\252\023\271\352\342\253M_e\"W[\0049\234\241\013\252Q\315I\023\202\350D\257\262\200{-\r\036\331\372\361*\tx\0018N\300\307\272\260/8n|\353\003\330\215\257~C\311\257\256C\212#\377\272\203\360\f)\214\030\263\363\303\2378o:\3040\244\245\217\255n-w\254\3548\213\347<\342"
+	.string	"\203\367\252\356,\327\025v\031\253Su\177q\313\243\232:\225\215O\335a\323]e\215\333\350\341\256\222\306k\bp\032\002\334p\334\356\360\274oR`\021\300\214\007"
+	.ascii	"\300g\310\270\324\001\3402\226\3071.\003\306c\274\274\003\343"
+	.ascii	"\245\233\250K\235\234\023\026\225\360\213G}\264\013\376\031\253"
+	.ascii	"\363\342T\332\366\206i@\013\365t(w\225N\177\372H\344\256\322"
+	.ascii	"\305\235\232\356\342e\323\r\247\255\3170\r\t/\233+\204\200\226"
+	.ascii	"\351\252O\270\326e*Ev1m"
+	.string	"q\246\333\215\260\270t\244\267\270\223\236\220\313\335U*})\351J\207\252#,V\271\363K:\324\334\321\207\216t&<!\027!w\225F?*\272\221\2130\321\213\356\344\246\016\030\231\221\350MN\f\323X|\350\243^Y\0247\334U\n\235\305-\354\022t\241[X\254\002\364\240\373\234\b\376\031\003#\003t\017\321\2267Ls\034\363\241#\266zA'\346\331\253\2476\024\023o;D\215@#wCB\355U\356\340C:j\245zN\327e\313\346\234\243\266\023bIB\253\364\310L\030\344(\225\352\371\315)\246[6\255\370!3\347\254q\204Z\355\027f\232M\271Y\303d\007@l\244\240\023\334\342\020\350D\005\342\3715\3711\367&\311\207:\3768\270\031a\335N\331\310\207UN\362\253\025\316\244\301C\266~<\3169'\360D\365\032\003\357\340\275\361\001\271\216\245\221;OS\374\303!\205\253\204%ZN\264H"
+	.ascii	"\222\240\325\345$\313\204R\227XmAa\002\002\327\022(ZI\246p}\320"
+	.ascii	"dI\226\223\017\256\2400\311zr\265D\n\tWV4\224+\212\226\224\253"
+	.ascii	"\022\270\270\244\\\005\311M_\006\rr\005\235*\037S\337\231\275"
+	.ascii	"\250\341\351\204\2235,M9\353C\267\361U\331\023\225\353\270\344"
+	.ascii	";\222\254[\017\024\222S\271o.X\244r\326O\270sx{\"\250\366f\317"
+	.ascii	"\352\355\323\023'\177r\037\223\bw\362\262\270\301E(V\331`\217"
+	.ascii	"\211\006g\342\305\031\\\0039\031\364\t\001\203\207P\344\030\310"
+	.ascii	")\362\204\326\005\327\002\223s\301\220o\235\210\220\017\021b"
+	.ascii	"g\350\241\272;\247+A\356+E\026<\210\005uQ(x\224E\363\004\247"
+	.ascii	"@\317\004wZ\034\035\024\t\016E\217\004?\276\365\b|\374\207\217"
+	.ascii	"=,\036\252\203sQ\006\301]\366{\340\020\234t\023,>`\007\213\003"
+	.ascii	"7\0260?\0160\360\2557\200u\006\260\362\204\036\252\323\241iH"
+	.ascii	"D\217{X\245\207\002\337\372\002<\256@\326y\334ipt\302\242\025"
+	.ascii	"\023\2511eQ\253&\312\324vs\256h\225\234\rj\322\024\202\251\333"
+	.ascii	"3\347\216\223[\324*#\371\216\273\215\307\342[\037a\227\026JG"
+	.ascii	"\356\373PG\002\327\201\300\023\300rW\231\343\b\334B.\276\347"
+	.ascii	" \325\336\356\226N\324 ?I\026\003\206\341\023\027\345\"\254$"
+	.ascii	"\311\203{\316@6>[\242\246|d\217p\241-\r\036\305\022[=\367!B\021"
+	.ascii	"G\351D\3652\002\t\354^;\034\205\335k\205\"\317;\017\237\342\320"
+	.ascii	"\327=\260\262\222[\354\216\343!/\351\304\257\203}G\023H_\017"
+	.ascii	"\273\tg\362\202X\370\241\210\243\023\325\267w\3008\017\270\335"
+	.ascii	"\316\334\005\325\214\276\356y\023\316\324\t\271,\265i\241\241"
+	.ascii	"\350D\375\236\001w\\\032\274i\300\035\201o\250a8%\021S\246FF"
+	.ascii	"R\220\024$\315\001\201\005\304 \b\231\325\r\021@\245b\222\215"
+	.ascii	"\310H\n\n\322\006\026\221\002\321\037k4\241\206\033@TAr\376\326"
+	.ascii	"o\2153-\337\351p\025\205\270\">\346\226\362\350g\350ilc\016\025"
+	.ascii	"\226W\003E\234P3\260\243b\023\361\3141\340\304\001\245\200\311"
+	.ascii	"sV\314\347Z%\317\335\367\250\305^\265\033s\237\241\255\354\317"
+	.ascii	"\324\316\3139\256bgDp\335T\274\243\365\026ll\030\223\302\372"
+	.ascii	"P\261)\254\244\316\347\333\235Pr\203\036=.\357\256\356\037\225"
+	.ascii	"O\364\274 2\022p\230\233\375\216\023?\310\214\037Y"
+	.string	"\254\244;\360\n\300wZ\211\002R\204\217\3018\251%\327\270J\322O\262QE\351G\177\242hDm\307\377U\256\2234q=j\2125\037\177TJ\200\355\363\313\202\262G\262\356\t[Y\224\270Vr\"\275\371\231\264B5\n\203\0210\366\002\373\205\263/\335\252\003FMc\3242H+ \3635`\264>q#\326\317c)S\233\266\331@\237\203\304\016\277\370\333\375\254\326U\006\017\347L\261\217]\027\263\215\212\330\342+\260<H\222\326\222?\016U\216\272\371<\034\253c6\1779\273lo7m\222\235v2C\354\\rK\230v\364\002R\fm;lk\320\370\364\324\001\236\005\210#\325@D\367\265\307\206\022^\205\274\302Ejl\222\271\363\323\370+B9f\036H\035KAU\353ZQ\251&c7\030\b:}\223\377\221b\222\207\336\"@\0307U\374H|h\322M\221\313H\2323~\005<\361\332\"\303F"
+	.string	"J5\263$9#\f\331\037\317\340b\226LuN8\200\fp\360\357\r>\026D\354\344\211\007lT\247D\374\270:b_\247\306iX\250\363\020(\332]\252\"-\273\234\034\301\037\022\021\307\202\\>\345\334\312\r\320\230,\327\207\352n\243\2222\376\305\022\004Q\352J\\$\bT$\240\206DJ\304\204\275`\204\275\f/\005\2723\026H\326\232\035\260\003Z\233\002 \355{&\365\2037\bm\036\235\363\r\230\313\301\366\333\305\273\313\be\201\366\370\034"
+	.string	"o\3617\307\216Jr,\251\007\277|D\256\362\304X\"NW\241p3\024F\236\271\001\340\002\356\266W\025\027^Z\221\223\337y!}\305"
+	.string	"(\021M\003\356R\017\277P\0026#\020\226\272\224\362\273?"
+	.ascii	"\"\342oo\276b\302h\031zg\270R~\233-\250\245\234\250\205~^f\334"
+	.ascii	"*u\226\022\007 <S\224\262o|\371(j5\267@\340\336\263\317\245\254"
+	.ascii	"7\373t\302aw=\006\325\330\324\377\222\223?"
+	.text
+	.section	.gnu.lto_blackboxWriteTag2_3SVariable.26.8171f4206f61da54,"e",@progbits
+	.string	"(\265/\375`\023\024\335U"
+	.ascii	"\372\223\\\037K \324RI\007\201\3779\275+\211\2201\fT!\301\266"
+	.ascii	"H\324\260\327\001\367\355H/n\315\t\223\201\374\232pMZ\2102YT"
+	.ascii	"x\345\364\214#\347\324\217\375\347\254\213\367\303o\211\3050"
+	.ascii	"\\\317q\310\317\241\026\207\342h\215\220\235\222\224\001\355"
+	.ascii	"\001\235\001\366\001V\323Z5\255-\246\225\312\326)[\245\2465j"
+	.ascii	"Z\241\246\365\311V'[\233\230\246uiZ\225\2465\311V\244i=\232V"
+	.ascii	"\243i-\262\225\310\326\241i\025\232\326 [\201n\375\335\352\333"
+	.ascii	"\271U\322\326\321\326y\353o\265\255\273)|\345\201S!\214\360{"
+	.ascii	"r%\226\242\2372\317\030\204\r\353f\227\315\356\334\256\232\235"
+	.ascii	"\252[\307FL\2321\373\203n\033\025b\323\243\b%v\374v\264j\024"
+	.ascii	"]\272]\243Bj\216\312\2650i\306\340\3309\315\263Z\223+\263\200"
+	.ascii	"\331\311\241\341\332Qm\374v\264\352\372\260i\242\254\034\n\213"
+	.ascii	"T\226/\324\211S\226r]Z\343\267\243\312\375\366\314\242\211\242"
+	.ascii	"\2327\345b\310\262a\332\202k\256(\313\362\313j\231\310\035\347"
+	.ascii	"*\221;\036\206,\375N\271U\255GY\027YXWVU-\250\246\264\242\240"
+	.ascii	"\236\234\232\230\226\224\222\220\216\214\212\210\206\204\202"
+	.ascii	"\200~>)r\234w\024]_\330\324\341N\261-\013\332\272\260\253\353"
+	.ascii	"\301Y`\334\336,\326\022Wv\254\360\310T\345\020\363&\212/nu\333"
+	.ascii	"\242M\032\362h\350\003y4t3\251\352\326u\256@\263\303\027\267"
+	.ascii	"7;5\217\320\314\0313X\313\027\006\306\355n\243\256\240\236v\320"
+	.ascii	"\301N\276\260/n<l\223\r5\230\211\2066<xIh\212\022P\0372I`p\224"
+	.ascii	"@\203\305\0277\273E\3223\fs\024\203\221\236!\013E3\n\316\216"
+	.ascii	"\226\3253\204\233ZF\270\320\004\321\214\261\007\b+V\317p\205"
+	.ascii	"\311\204\245\206\266\275a(\203\207T\020J!\350\rhn\331%\201\303"
+	.ascii	"\352\031v\231M8t\271\333\337\004\253\353\203f\365\f\271L\"3R"
+	.ascii	"\324\210\261o\323\356V*H\262\215R\346\332\213\262\250M\253\262"
+	.ascii	",w\315^\3350<c\373\302\312\262T\267eq[}\261\252\216BUy\250\""
+	.ascii	"\251\tG\334\313\0358\277\307i\325\232\221\276\237\035\371\276"
+	.ascii	"kv\034\332\025\347pn\212\317\343\374\346\255\346\221V\027\252"
+	.ascii	"\271VG\256\325s\255N\222k\231.\324\335\335\262,K\251 v\374yY"
+	.ascii	"\313B\002\261\243\234\337x v{\302\243\271)^\306(\245\301\320"
+	.ascii	"\331Ys\237\275Z\033\316M-\356\022r\376\211n\234\271(\034\210"
+	.ascii	"\035\036\241\316M\361\262\366\307\025\327\214\374\207\320\335"
+	.ascii	"Ys\037u\271f\244\377/\033\234\232\213\272\367\237\027$\256\335"
+	.ascii	"\331"
+	.string	"p\311o\006]\024\310\035\367\247\002\t\265\2757oi.\252\312\241\371q\252\273k\3039*\372\027T\337\272p\331\262\303U\263\272X\256X\251\"\334\266\245b\353\231\255'\330j\302\255%\334jf+\224\225\333\005\332\352\304\326&\353fUI\031Y\022$\266\036\261u\004[\215\330*\202\255El\ra\255c\244\225\bi\025\263u\210\255Bl\005\301\326 \266~\260V\017H+\020\322\332\201\255?l\365a+\007k\335\200\264j@Z3\260\265\307Z1 \255<H\353\016[/\260\325\202\321Z\301\264\352\230V\nn\235\340\326\034\267Jp+\016[#X+\004\244\365\001\322\352\200\255\r\214V\006\246u\201i\r\233\326\033\266\332\230V\005lM\300V\004l=`\264\0320\255\005Lk\215i%\300\326\001l\025`Z\003\260\025\314V\032\266\316\030\255_\323\3525\255]\323*\303V.[c\214\326\255i\2051\255"
+	.string	"L\353\013[\265\246\325\205\255Y\266b\331z\265lV\003lpN2\366\312\237\320\301\023\324\242\226\247,\313\246\034_\037\350\364r|\313\320\231\303\006\247&W\226hL\217\323-\256\031)\301\367\013\235\336\342\270\004\021\034\307\347\235\024\021|\0378\360\020|\331\312\250\325!\035\370\003_\266\033\312\356\300\177\320%\371\n\277mV\253\n<\265\275\037\374\274,\313\264\245\006\030x\003\013\234\201\260+\360\005\264\270@\362\306\303l\374\206\034\033\367\345%p\005|\b<\2018\b\374\f\257x\200\001?\240\200\033P\343\001\274"
+	.string	"-jS,\001\2571\300\t\020\340\003\374\351\017\033Q-\216"
+	.ascii	"\367\351\201=\200\223w$\215\203\331\321\370\031\036\237\031_"
+	.ascii	"\237\341\365/ \331u\257\317?7\026H\312x\027\327e\354\271\240"
+	.ascii	"`#\362\371\032,VP\212\261\365\0300\276\365\005\340.\016\343\344"
+	.ascii	"\235\321\002\311\027\007@\353/\356\253\"HL\223\243u_^\326]\234"
+	.ascii	"\274\303z\326G=6?X?\303\303\023\276\005\371\252\352W-\036\365"
+	.ascii	"\252] I\365\026S\2472b\245>E\224:\224\023\013$\241\036\365\371"
+	.ascii	"\307\306\002\311\247C9\375I\306\356\235\276}\360\330\264\240"
+	.ascii	"\247n\266\234I\nr\323U\223\224y\333\324j\355h\272\364\246\357"
+	.ascii	"]\220\250\364\243/]\352OP\313\027H&]\t\351I\247B\"HL\223\203"
+	.ascii	"t\2525F\027\372\321\237\364\202Z\206\026H\026\335\210\350E\233"
+	.ascii	"\267C'\272\324\335\320\241\234\020\276\315X \031t\241o\220\013"
+	.ascii	"\320\203\276A\342\334\003}\373\300\331c\363\243\346\242>\361"
+	.ascii	"\213\241\034\226e\271e!\346\344A\363\037]2c\220\360\3548\273"
+	.ascii	"\310\035\335\331,\202\340\210FgK\\\352\301O\321\362\241\221\205"
+	.ascii	"\024\242\257\031\371\363\357:\216\250k\303\304\020\224%\252\024"
+	.ascii	"vl\020\362\355\022r<\025\230\275\035\223FL\320\343T"
+	.string	"\311\027c\241\233\002\350qjD\005&P\366\007\306\244\254\211\330\030\2221\022\200H\030s\202D\310\023R\305\274\212\220\031!R&F6\026\004J\331\220#bB\220\f\371\"3\"$\311\227\030\023\022\276\274`h\231\2221&_M\312\312\230|\t\311\225\253\224$c\025)\253k\027\313\205X\276\244\207=X\354I\273\332J\t\202\023\007\315\025k6\f\315\177\\<N\205x\300Z*\037e\230\342Z%\027n\335~\275am\333uN\221'\273\260\353\t\272%\262\310\276m\367)\371R\371\346P\247\310\006\327fO)Wn\255\377`\231P\302M\270\357\311\354%\234$\036\271\0311\355\b\036\224\021\016\005n\215|\004#\337\267;l\234\210p'E.B\231\"\305&!\274I\231\020\210\034\3701\261\023\021\343\203e\213\346\234\271\3322\344\273\345H\310\207\b\301s\006\302\317\274e\203\034\204 sN\370\340'\250\371"
+	.string	"\310\201\367\240\203\003\351\340\373\246\207ge\213\346\220\261\352\362\343\333\345\347\343?>\336\261\021}\360\341b\267\345\340\313%\016\007\032\034\370\r2\270\006\031@!\334\2429]\252\366m\353v\n\321\302\026{|\337\256\016rQ#\242\007\217\003\217\301\216\363P\362\035\3377;s\202DSY'\267\026\217S\017\325K\357\212\356\020DT\321.u[)\264\033S\266Pn\271M\313\022m\341\274T\006\305\270\331\263\343\005\037M\324\256%\373\005\337\272\235D;l\202\\\250\246V\222\223\027ZP\301-\320\361\n\026HRp\035\337\240\026\265S"
+	.ascii	"Wg/HL\233j\263]mQ;\274JY\275\354B\215Br\235RLO\342c\006>tK\254"
+	.ascii	"\271\317\356N\255\307\351\232\261\002j\253|\315\f\361\264V\276"
+	.ascii	"frh\332+_'\314\300-\255\360H.T\365\332\262\357\360\033\247\b"
+	.ascii	"(\034\325U\345?\262\200"
+	.string	"z\\\236\225?\241\003\305\323\343\324W\234`\226\023|u\240\263\027\201\230\250QL#\02133\"\"\"\"I\222\2441\261\005\304\030\007\235\225\007\021"
+	.ascii	"\245c\220\231\210&\005)\244\0036\321\007\223\024\b\345vs\225"
+	.ascii	"?Z!\\Z\362;V\"\231\001\035\037\205K\351\220\304-\361\255\025"
+	.ascii	"\214+\341\236\323\020Ek5\377\007\255\261@\017B\321\312bM\026"
+	.ascii	"\255\206!F\030rq\314\364\205\326\226X|\2773\254\201\277}\277"
+	.ascii	"\3609\277\251\261\237\217\275\260\242\301\236\212.>\277\027G"
+	.ascii	"\215\341_\324\343\367\316\332@\317\t\350&\032(\304\005\374u-"
+	.ascii	"\2069>`\244T\342L\321\\n\352_\255\305\360\332\202\\}\377\277"
+	.ascii	" \024\201\324\267\375\260\"X\373\302U\204\222!\267\325M\375\214"
+	.ascii	"P\037\271\216S\300|!\345pc\352)\347\274\342\345\364\211/`\340"
+	.ascii	"\002\324\200G\305YR\317\245\202\026Cz\205\034\315\\?U\371=\025"
+	.ascii	"\224P,Eke\323\270IX\314\020\"\262W\255\235\"I\212\2669\237\t"
+	.ascii	"z\264\307\327\232\373\337\272\260\265\341.\030\341\261\276K+"
+	.ascii	"\363]\354\350\356,\251c]\036\361\201>\3358\027\273\235\377uY"
+	.ascii	"\2303i\265\025\r\366\221\005\f\264v\301j\377\322\224\234\272"
+	.ascii	"\344\341\321H\374q_;\277F\003\234-\2261=\302\307\223\361\321"
+	.ascii	"q;\264H4\200\220\255J\270\264llQ\3732\262\0347\212_\005,\230"
+	.ascii	"\251\234\327\355\221\203\343U\310\026e\370-M>h \213{j\263cba"
+	.ascii	"e\251Uo\255\264s\203\264s/\226\301\250\315\2520\222\023\367\016"
+	.ascii	"\3226\"\350/5\364\313\017\215\037n\366\316DG\220\372\367N\320"
+	.ascii	"\026\360\230\213y\273I\300\026y\362\300\225\031h\201\204\302"
+	.ascii	".h-\\\324hn\t\232\343\255a\b\254\320\r\236f\r\307\"W\n\250\037"
+	.ascii	"N\361\325\355N\370\363\025w\357FQ\345IA\307^\350\311\243\242"
+	.ascii	"\200\327\030\333\340!7`(\r\264L\310p\275iqr\335{\007,T\366\004"
+	.ascii	"R\200\303J\204\226lw\343\335'!\363\310\316L\226\f\244\321\206"
+	.ascii	"_\034^|\360]5oj\344\271\315\2105\272\030\367\363\202\370\351"
+	.ascii	"\337D\027\336d]\323\323\346C\022%>\273\027\312\3648@R\210\261"
+	.ascii	"\273\270\265\317L6\203\320\321\r\206`\001\204M+\214\251l\240"
+	.ascii	"\020\245\203\263\3251\327`#P\fB$9Q#\214\310\306fE\305@2\031L"
+	.ascii	"\201N\226\305\241\271\255\242\341a\fr\177?\243\300\321\345sQ"
+	.ascii	"@\344O\005\315t\013\321\177l\321A2\231\267\270\003\022\310$q"
+	.ascii	"\275\34792,\356&\007\254\025'\376'd\031\323uLBvtm\035\374\024"
+	.ascii	"\351P\342\226k_\261M\231\013\230I@:\003\313\257mV\364\006\270"
+	.ascii	"9\265S\201h\301S\377\220x\367@Vk\312\251\342n[B\005"
+	.text
+	.section	.gnu.lto_blackboxWriteTag8_4S16.27.8171f4206f61da54,"e",@progbits
+	.string	"(\265/\375`!\r\375>"
+	.ascii	"\212m\224\027?@\344J\007\253\352\177\232P\t)@\2142\205\350\004"
+	.ascii	"\246\t\203,J\024\321\\\223z\021&X\326\253\004\314r|\206\340\024"
+	.ascii	"x\250\f\024\001\002\342\b\031,\007\235D0`0\030c\357\275eJ)\005"
+	.ascii	"n\001<\001l\001\316\377\316\376\316\235B\300\337\234\262Am\013"
+	.ascii	"\244\021Q+'=\363\244\303t\023v?\273\273t\017F\253\342\222m\034"
+	.ascii	"_\240_\177\341\006\303GB\250\230<\022l\247\336[\332KC\3718xG"
+	.ascii	"\306riA\267\356\302\205\354[\223\035\344\303\322\247m\3331\266"
+	.ascii	"\323\252\313\300\201[?o\260\255\337\n\345\003\354\323\266O\255"
+	.string	"N\371\213mg\356\300\316\342\326Zr\264R\333\036\031S\246m\237\\\f\201\355\224\237\355\244v\3126\223\332)\263\033\363\236~*i;L\"9/\204\332\266U~\222(\276}\237\315F\357\326TSRQPONMLKJ\311$\244#\344\321\250\210]\325\364\276\273qC\233@!2suoM\005\330S\327k\007!\275\246\323\004\274HCrv\032\212\305\245\256\350y\224\225\206zr\352\343\363&\246\245&L\\\311\237tRI'=i\244\353\004\244o\256\3514\211\334\254>f\004u\264\255\376\232{~\264d\210\232l:Q\223\315'\027\031m\256@(F\354\254\364\361\"\023\243\3445\235\246\220\353\205\027Ml0\355tupn\264\202!\261\313\353\"+v\275Ut\232wr\256\256`F\354\360:e\036\353v\370E\252\213\273U\177M<\377\006\323)_\236\037#vy\355+X\333\266\354suv\315"
+	.ascii	"\232\331\215\230\271\004\363\321/"
+	.string	"\215\321\364\235\234\324m\252\372\335'\370\206\35565}\365\233\271\367\351w\020\305F9F\035\035M\214rw{M\275\317&\250\030\347\206\230\273L\2155\326\tw\216o\272\274'\373\377fJ\271\315\207j\277\1773\377\300\276?\204\"\0379F\035\336\310\336W\352\327\243\370\006\3237\215b\034&\"8o|\274h\"\224\177'\363\363\315\377Hb\024\2742\374G\230\257\3632\r\355\314\fE\331\211\022\327y\204\210\353\034\002Dk\351&S\235?\250\316\036\256s\007\325y\203\352\254\241\3034\217\211e\b\303\320\204\315`\027\276,\\\347\n\2523\205\353<\341:K\270\316\021\2563\004\325\371\301\352\354`unp\235\275\2563\203v^\360\316\n\336Yy\235\273\2563\327u\336jg\255w\316zg,\325\371\352:'\350g3\202\356\322|\240\007\233\r\\\347\002\2523\201\325\331ju\256\272\316\003\256\263\200v\016\360\316"
+	.ascii	"\336\231\352:O\265\263\324;G\2753\324u~R\235\235V\347\246\325"
+	.ascii	"\231\351:/\265\263\322;'\3379IuF\272\316G\355\214|\347\343;\033"
+	.ascii	"]g6u^Sg5uN\257\363\355\017\200\352\273\314\036(\323;\271CG\373"
+	.ascii	"\242)\022\367o\\\250N}\207;8\016SQO\366RP\037\005\365\235\247"
+	.ascii	"g\t\220\240\242\234F\036VQj\036w\204n\222\357\344'\247\177z\027"
+	.ascii	"\343\341\305\336\251)\220\\\220\246\367\360\354I\035Ce\372\246"
+	.ascii	"o\271\273\245gz\365\215\211\245\344\223\275R\322'\223\276\265"
+	.ascii	"\344i\264B\364k&\275\363JEz\021\377^\230\210\216\036\351/b\212"
+	.ascii	"\243\343\223=\262\307\264\321\037\307\336\350\273\231\347\016"
+	.ascii	"w\021\243\030\210\364N\326\352\260\277\242\322DP\021NS\331\311"
+	.ascii	"y\363DGu\270\331\350\231\303\275\3460\016w!\357a\333\366\215"
+	.ascii	"}\256\365A\350\327\026i\261\336p\357\261J\332f\373l\261:\325"
+	.ascii	"\360\035\355\356\321\346\220\234\035\316\310\3377\324\013\257"
+	.ascii	"\341\327;(\310k\364\365\006\216\316>s\213\027\336s\\\025\367"
+	.ascii	"ol\340\331,<\320\343;y],Jc\013\241\351s\256\006{:\276E\026\276"
+	.ascii	"\241\315\006B\363\303\271o\250_J)x\004\027\343\334P\337\266m"
+	.ascii	"[\243wr\027\016\262f\337\205H\326\263\357Bf\212\366}\005\315"
+	.ascii	"\236G\361\026\236\216\271\253\301>\355q(\032\372_\321\233=\213"
+	.ascii	":\254\237\275\211EC/\274h\342\372N\356\306nS\327n\327\357\273"
+	.ascii	"E2\314=\365\235\035@E\361hob\021*\027\004\316\0035\232mm\006"
+	.ascii	"\332\322\305R\006[c\231\246\246a\351\342\354l\205\332\221m\231"
+	.ascii	"\"E\333\231*c\331\346\302\214\206\312h]*\324V\244\255\241\251"
+	.ascii	"-\313j\254\235\265@3sq\246T[a\366B\211\306&C\331u\305k0\226l"
+	.ascii	"\312\031kkl\312\343\263\355?\302'\242\310\321\361pT\025\020|"
+	.ascii	"\205\373G\250\261\311\315\037=SQb\217\340\351\370F\205\375\201"
+	.ascii	"\255>\340w\201\200R\357\344\265\r\324\t\266\220\341\230"
+	.string	"\243V\217Ae0\324rl6-\006\205\001\321\260\357\250\325aZL\240\312\236\357\321\300_\030{\345\024@Ql\006\221D\374\033$L \236oRl\216\237\037O%\304>\303\323u\264S6j\220\266\232/SXQ\240\303\037I\255\346\247\260\347\213\f{\f~\341\313>-d2n\365\330\237x\033x\3560\367\334t{\"(\n_b\302S\320\233\360\335$\004\r!\341C\264\236\216\360\022\364\"\f\202\360\340!|x\261\177\340\340?4x\007^\337\340\3277r\214H\006\357\365*\242\036\003\005O\366\013\224\257@\371]\206\317\235\247w\362\262\353\227]dF,6\327\217`\267\236\353S1nJ\266\262\236\354\265\260>\013\353;\217\017\324\251\n \235F\036\0366\275\023\261\257\036D\202\277J\360\335\334c\350\005\b|\201\r/\366\004\254~C\337\351\252\267\032\360U\277\026\3121\352\020\360\003^Ed2\212\t"
+	.string	"\360d\037\200*\201\007\250a0$\221d\204FD$H\222$i\rq\005\004\031I\325\331\001\021P%cN\331H\223\322p J\223\002n\210F\202\264sx;2N4gQR\204=L\013$\333\263\301z\264\272\277\335`%\303\215N\357\034;\332\243O\360\016Zr4\200v\324\320\251\375\013~\241{Ni\366\274k\307\222 )\217_\377\rk\007s\216\203\276\307:?\233\211\312x\"\241~u\351\201Fg\306\216\315nB\260\303\001\317\021\273\331\276\032\002\004\214\016\035oQ\341\346\004|Q\220\367NV=\373!M\352\220\007\021L\207F\240\005\373B\005\f5I^\364\333\177\323,Z3\225\004\332\271\314vEL\b*\213\007&\373\200\006\304\201m\363\r\004\250\tw\247\366\271)\037t\200\030\310"
+	.string	"\004\024\224\017%\004\005\252q\002\320\313\026\213\034O\374>cp;\312\177\326\0240\337UIC\034\b\\E\344\037\376B\263p\261\037\210a\242\245\254Gf1\262N\323\2122\024n\375\362\335&\313\351\322\020UE\002\264\227\250\201\217\2339z\233\262Q()\300]\256@\231\300\f\307kb\321\213N\251\314~\205\r@"
+	.string	"\030P\020$\2433O\346\312\213\366\201"
+	.string	"=\205+\334\250#\034\305\023\311>l\270v\257\233\226,\027}\b\210B\375-\236\250\340o\264>.J\001\246\300\023O\334\250\340\333\374B+)\210\300\256#\366e\003\004\b\237\rZ\271\327\f\2149\250t\255g4\"\2424[\230;\344\021\037\037\240\322\275\0359\261\372\0032\274\255\334\027\033l\332\363\337\271\260I\201Tv\200\251\206\260\267Y\325\035jz\\\225\367\241\256\211\260\"w\255"
+	.ascii	"h\366&\241\f\276\241W\327\216\357w*\032O\317\216i7\r\250d"
+	.string	"j\261\fqY\335g"
+	.ascii	"\335\214\003(\024\360\362\251\023\030\212\273C\223\227P\001"
+	.text
+	.section	.gnu.lto_blackboxWriteTag8_8SVB.28.8171f4206f61da54,"e",@progbits
+	.string	"(\265/\375`\016\005\255!"
+	.string	"\326|\326J\220\026R:\003=\344\342\023VAa\321\200\361\303\037\306g\320\217\013f\237\\p\366\0032\016=\355\230~\204z\243n?Ly\034\364\3618\017V\315\340UE\263h\"x\025\311\302\325\302#\224z\353\375\327\372\215\304\022\262\345N2\310"
+	.string	"\263"
+	.string	"\300"
+	.string	"H\247{.\034\302d\227{o\257o\344\270\266\\.\227\267\310s\332\277\353r8\230\233-Ek\247i\273\376\370\311\313l\241\222\222E\034\272\216)j(\243\346l\024\227\216\333:\001\245*D\314\232\212J\207\261\007\224I\310.6T\2621IOG\217\032\316\2507\255\367\232\364h*.\335fkEIO\027\033\306\260\016\316\224^\3072\252i\r\202\215\"\214\243\003\232\212/^\2638b\303\027\026\347\336{#\n\353y\254K\200:ri*\302\270y\"\246[\273\240\250\313\214\034\261\310\302\234\t\247\004k\333\232%0\026\327\372"
+	.ascii	"\261!\223-\020F\003\313\223\257HD`\2555\b\367^\256G\304\342y"
+	.ascii	"w\346W`\346\n\314vC\227\211\371\324\317{\326\325Y\227\303\275"
+	.ascii	"\352l\253\225\323WF\315\3125\263\362Y+\233\265\262}\3456+W\263"
+	.ascii	"\362\005\b8\206\251\370\2727i\211v\243\230^P\317\372\257\376"
+	.ascii	"\2527\363\371Y\337b\2761\212\037a\363+\013\220{\257\026Npw\203"
+	.ascii	"PMx\240`\276\335\212\217u\305K\320\241!\252\305uT\336{)\2407"
+	.ascii	"\353\223|S\300\340\367\252\024\350\345Q\273\202\312\241\274\027"
+	.ascii	"\231s\223'0W\344\215\374>\305K8\275\267i\254\353\336\233"
+	.string	"\200\037\2407q\354+\363\211\\\352\367\343\212\003\270\267\006\222\256{\221\t\270\001z\223\221\2179o\242\347\2357\177\314Z\036&?\305\231\303 \345\345\366\336{\3236\362\271\230=\325j\372aei'M\343\032I\3276}&\025m\343\003\2344]\323Bh_B\026\227re\n\253\326F\376\317i\373QTc\367\022\372Au\360W\364\221b\324\226\351\356\033\371\260g'\347\273\366\215\242t\375>\201\306%L#\252K\376\r\234\271\246i\021^\226Fh\300\272\354\253\257\"\342\251s^\307\364\261n\301\274\224\031-\001\353\322\201\323\231\322L\253L3\373F\324\037\261\355\241\234q\307\017\213\340\274\276\221*Be\305\n\211\323\215n#\347\234\3273R?\250\236\004\353\0313\022X\333X\366\345\002\nw\r\346\263\362\215M\r\315\314\217\017>\017\352\351\260\323\363\341,\001d\302\027\301F\242\307\004\210\235\023'\363\350x"
+	.string	"\362\351\340\343\001\352\321 \344\343\360\303\263\003\202C\017\310g'D\217'\210DO\307"
+	.ascii	"\373D\364\004\365J\370|A\275\033\222\350\311\243P\212D!j\240"
+	.ascii	"\256\215|\033\303\315\2649f\313\371\256\221\270w\3754*\260\\"
+	.ascii	"\033w=\223C\005\013\220\212\025\216y\365\346B\206]M\233\277\265"
+	.ascii	"\303S\177t\323\337\272\205!H3e\260\207\\@\221\265\200i\243\222"
+	.ascii	"\247@i\255e\032\355\372\331\265]\237}\255[\262/\\\302\264\233"
+	.ascii	"Msm\303U\263\231=\370\340\004{\210mmZ!he\3024\"[\033\031'\004"
+	.ascii	"\265I\203\224i1cZ\327HlQ\\?\371\264G\3311c\250q\034\302\224D"
+	.ascii	"\206\241@fDd$N:`\002\031\302\252\016\021\340\255Dd\222\264\337"
+	.ascii	"\001\024:\301D\311E\210e\311^\373pH\305\030P\330N\037\200\344"
+	.ascii	"v\262B\362\247\220\003Ga\251\321\205Zv\2633\220\273\260\305\200"
+	.ascii	"f\0365\3546S\bs8^\341Y\223Kw\2663\226\r8\254K\025\370\274\274"
+	.ascii	"\342\264\310\006\250\\ /R\214\3603\340@<E\311+[\206Z\003cD\n"
+	.ascii	"\323\243\n8\022\246\373\177\036\200\006\016s\353\007\314\252"
+	.ascii	"\035Q\025c\tw'\301\367J\242\016\033j\345\372\354\005\004\036"
+	.ascii	"X\232\232h\007Ws\250\357\001t\270Y\030\252\030\257\220\326\374"
+	.ascii	"\254\337\343\022\263x\372\364\202d3nl\004\366\244\036\022$U\365"
+	.ascii	"\363T3s\005C\372\261\b/\362\327\344S\003"
+	.text
+	.section	.gnu.lto_blackboxWriteBits.31.8171f4206f61da54,"e",@progbits
+	.string	"(\265/\375`Z\003\215\030"
+	.string	"vn\237F\320\226McD\017\211\0021"
+	.string	"\351\307\357\325\274@\201\033\030\217\223VA\223\223(2(S\367\032\342["
+	.string	"\b\265K'\006\312\020\270\316\272\031\344j\004\237<\004\340"
+	.string	"\007\2046\244\206\316TD'\336\226\354\275\367N2\245\213"
+	.string	"~"
+	.string	"\215"
+	.string	"R\327\247$Ns\316\231.\030\r\326\262\365\f\323\240\031iCWs\222\370\3414\247n\246\tF\2032v\t\r~~\205\006Kk\227X\207b\212+z\266\245\2519g\354':J\232\3051\374.i\265\200!&7\\\217\305O\f*R\321\302\331>\005TQ<\274\373\221ch\224s\370\301\337\207 h\nD\013W\373T\250lF\234dI\204\003\222\367\316\243\222\026BMH\030\345,E\006s\316\312\033\316\310]\271\255\255\355\203\366\264\276\227\f\341C\216\367$\347#\253\316\344#\b\367\037\265\272\036\251"
+	.string	"\005UTo\2425\222\035\003\223\2620\346\271/\326\331./)\333b\235\313rY\327e[\227]\271\254\312eY\227M\221\262\253\313\216\237\254x\331P\312\202R\366\273\354\245\254\274\254ed1\210\320\252\346,\252\2022\207\200<V\230\347\326J\365\022\257O.\237\021\223\245HI\213\241\2509g\001\203uP'\265,\203f\265\r\241\353\337\361j(!\001\222Tu\335\3117'\255\373\256\326[~\204\230\330z+\327\001us\242\362\360+\036X\037\257\222\253rN\230r\326]\023\261z\312\0014\031\360\3521QjP\304\217\217i\202=\346\342a\216\324z\340\303\213O\266\336w\360\256A\371?\034\263\337N9\0330r0\177\035v'\031\202\222\220\220\032\213\227\277\016\363\031\250\232\224\374\350>\205/\017"
+	.string	"Uc\361#\253\352\313\333\3263\223o\344\324)\212\201G\372\306\023\032\f\262\br\007\207g\326`\347F6\332\360T\240\311"
+	.ascii	"\266\346\300\004\234\033\t\263\032\034\233\b\032f2\n54\025d1"
+	.ascii	"\234\033\032\013\261\032\035\f\261\003\004:\273`\243\023\333"
+	.ascii	"\231\315tb,\335\364\316\026*\"c\210\317\177D\351\362~!\313_'"
+	.ascii	"*\340\327\275\363\200\035\274\022JA\354o\3169\307\037U~\260\273"
+	.ascii	"\324pH\207\235\345D\255;\204\365\223}\344rM/\244r\302\036\034"
+	.ascii	"r9\246\244|d\313[\n\026\244o\225\001zOW\336r\261\304\020\223"
+	.ascii	"\255W !\\\230\370~\344\234B\250A,\305\210C\206\021\032\021\032"
+	.ascii	"\321D\031\016\240\002\221:\333\006\020x\271\260)6\240\177\030"
+	.ascii	"\354\266\350\"\261\255\021NY\316uNF^\023\207X\3675\347\361\230"
+	.ascii	";\212]\r\031\f\336\"\323\225\251\207/\334.\215\311%#\034\367"
+	.ascii	"EP\271\215a\274\202\345\354\352D4]\335\2736\317\305\005\2340"
+	.ascii	"\254\f\330I\013\204\tv\210\246t!\021\374\004\317w5hB\224\321"
+	.ascii	"\254\376Z\263\215!M[+\354\341\f\002\241:\326\031\2501\336\277"
+	.ascii	"\247\273\315\1771\372\007"
+	.text
+	.section	.gnu.lto_blackboxWriteBitPackedGroup.32.8171f4206f61da54,"e",@progbits
+	.string	"(\265/\375`!\001\305\r"
+	.string	"\006\232^F"
+	.string	"\2216\035\370\250/:*\230\036\234\372\355l\267\311B\211\032\250\247A#A\221\024 :\326\274Y|.\362\313\007\206{\3730\020j\253g#\374\367\202\n\325\303\240\251\204\343\260N b\273\326\"\260-m\"wJ\001H"
+	.string	"J"
+	.string	"H"
+	.string	"\237\026o\340\372\304^\340\3724h\357\270\330\262\007P&@\2146\273\233)\013\b*xK%\350\203\204\243[X\211\253\225\221\220\341\022 D\261\006\320\260\240\361\361\262\024\246H\311!\331]KR\250r\317\333.\261=\301\376\0061\374\225\3123\326\256\036\240R\250\330]\t\330\347?:\304v\352\344\253\262\017a\203BQ\263+v>\035\301\226\342_\200\217\361\214?vO\320\310\354\256\210\033`\237\b\254K\373.\376\002\036\246\303\t\354\256\330\220\331\025E\274"
+	.string	"\013\227\234\212\251-\332 O\362\324\321\031\264\334\324\250\236\334\371\324\217O0\032Y`\334H\2217\2668\222z\232\361\322\302d]\261\017\363c\217\371\347U\267|\352\376\007\200\025\"\302\223T\273#z\360\330\034\263\206\313U\177\312~\334A!\316A\327i\234\220'\372J@@\036Q\247i\270\274\215X\360\270\n\337\346y(p\370L.lZg\222y\234\206!\333>\240lD\201\277\f\236O\026\372\276O\026\"\356I<(\212\245'\177u\b&\035\262s\251%\001\037L8\244\177r]Kv\027"
+	.ascii	"T\004\003K=\231\001a\370\217\260P\004\002]XH\224\2318\313\\f"
+	.ascii	"P\327\200\ts\031L\335w\032\372`\202q\224\030\023b\004b\200+\322"
+	.ascii	"\324\024\340\2164\325\036\rL\355\001"
+	.text
+	.section	.gnu.lto_blackboxFlushBits.33.8171f4206f61da54,"e",@progbits
+	.string	"(\265/\375`\027\001\255\f"
+	.string	"6\227S@\020Q\225\016c,\256\366\023\320K\024\n"
+	.string	"\373s\221\203\356#p\364\263y>GphE&=S\254\225\364\t\335M\363E\264\314?\202\t"
+	.string	"\240"
+	.string	"\020)40\002"
+	.string	"`a\343\240\242F\366\2262\245B"
+	.string	":"
+	.string	"@"
+	.ascii	"v\215\263Ts\300\007\027"
+	.string	"&\025!s\316l7<\364\270\032\362%\2279\347\301S:O\364\210\341\033\013|\300\260\021\300#E\001'\016\335\301+\005o\244*\271\3149\255\235w\341\226\267}\300\266\001\373\026\002\022@\372\356\322\007]\227\337\243\276\016\022\037\247\241\315\022\351j\260\037\347\246lUc\252\276T-U\035U\275W\353\325\007\200\211Xy\257\020\316y\nGfK\306\350`\373\025\207\002\244\025\371\341\265\330ZM\237\334\335ke\213\322H\334\311-\343\222\373\222\207\221\206\376\306\2258two\312\301i\210\302\243{\020_\307\215\253D>^\254?\3277\223\202\006IE\354\227\270\211\217\277r\326,\n8\233\004\233\306\321 \230\260e\026h\030\006\231\214\263\3014\310\264\216'\263\020\360\346@\323\311 l['\253\260\3467\345\311\f\260\305\355(\2628\352\363\b\001\341N|E\204\317c\004\bE\261\265\267\007\372\316\007\037Cd\b\034"
+	.ascii	"`\25173`\236!\337\017\206\260{Gc\021\224\001Xwjl\314`\b\026\323"
+	.ascii	"\203\037U0L\224\305\230\326\315\264\315e\020\334\201\306\274"
+	.ascii	"\302\033\252\210\210\033|\b\3205\3346&\300\313`\304e=\245P{"
+	.text
+	.section	.gnu.lto_blackboxWriteU32.34.8171f4206f61da54,"e",@progbits
+	.string	"(\265/\375`\372"
+	.string	"\235\013"
+	.string	"\206\325L= O\225\016p\301t\236d>\330\252\003\251\270\373\007"
+	.string	"\314p\201\006\016"
+	.string	"\232\224T\3437l+\217\312\346\275\020\376\210\256\020\200H\204\001\203\350\036\244\266\352\nb\2109\026\305\275\211\224)\0059"
+	.string	"5"
+	.string	"<"
+	.string	"*\022\273;\261\201\306\241\344\002\342a\366"
+	.string	"\361\320\237\255\342+\324F:\244\020\205`\261\273\234n\370\367\374\374\253\356\030\231<\317\013\004\273\353\034\231*\334z\333\003l\037\260_\n\331\356\256\365dgz\3134$\323\332S\177\3144\324t\246i\315tf\372\030\232\007\021\246\223F\354\226b-\326\005Kpx\330~\332\377p\020\337S\035;v1\004\031H+D\260\317\306z\352\226\221( \005.\\!\215\273\025\243^7\026\351D\b\026SS\233#!?\362U?\352\325rQP\217\037{'F\325\324)\262"
+	.string	"\312\230\275\362\244j\260\037\027N\246\022\001\272\243,\320`\024x\235\346\222`\202ga\320U2\026N\203\2514\340\272\315\003\216B\300\236\203\313\206\203\340y\033\356\261\332\353\311\215\227\t\327GA\216\t%\231B\235DT3}\b\006RU"
+	.string	"\001\031"
+	.ascii	"`\251'\0230\374\315\300C\272\254.\036\202\006\035\346\206\210"
+	.ascii	"1\243\301\305\264J\017\024\001s 0@\210\256\034\2010\201f\030"
+	.ascii	"\276\252J\246\202>\300\204K\b\304j\n\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_blackboxWriteFloat.35.8171f4206f61da54,"e",@progbits
+	.string	"(\265/\375`A"
+	.string	"\255\b"
+	.string	"\346\320=9@\305(\035\365\255,\277N\200\230\226\303\224\377.\206\211\337)E7\013\206^\320\3378\342v\240c3\236\201\037$\364(\212\233r.V\302\202\340\377<\r\330,!D\312\224\002+"
+	.string	"."
+	.string	"*"
+	.string	"\027\320\236\331\263Q\276\342X\002\017W)dew\241n\334{z\376U\337\276\323\350iI\330]\347w\312\270\365\266\013l#\330.\t\3074\235\231\276%@\205q\272\311d\327\364\002\260\254\214\244\003c\373i\377\343 \336S\026\361\266{\242\032\331]\215\017.\3172\037\320\236a\001[\246\332\021\"\3779sM\325\224\002\220\362e-1\265E\024\371\357\232)-\025\326\205\216\354\325(U\303>\266\273kE\331O=\035\321\207\233\310\334m\030@\236\205\330\201:\n\025\221\323\320q\037\016\004y8\007\330\205\"\340\306\300\361\241\023\202\0221\206 f\265\307VQ\276\264\\,\222Z8\n"
+	.ascii	"`\251'\023Z\373\002\303E#Q\341\035L\271\004\333\254\246\200\273"
+	.ascii	"\274h'\031"
+	.text
+	.section	.gnu.lto_blackboxWriteTag8_8SVB.part.0.52.8171f4206f61da54,"e",@progbits
+	.string	"(\265/\375`8\002\375\021"
+	.string	"\206_oH\340\320(\0350\244\b\035O\304\361\302\337\n\306\353\277\036\006\b\305^G\030\215\257d\030ax,\264\343\251\330\233EJ*\215\311\241\260h\207bLKB\373\200\007h\352\030\301\3668b\300%\256D\217\260h\223O6\331;\245U"
+	.string	"W"
+	.string	"]"
+	.ascii	"_q\031\3623\252w\354\266\274\250\355\226\007^-\342\275\272\374"
+	.ascii	"\200\356\325\273\200\356\325~\214\355\321e\322\376yybO{\331`"
+	.ascii	"Scw\301Wj\342\344\351\344H?v\017\032\253\323\317\336\361C##\306"
+	.ascii	"\362\3413\3009\321\202\335\265\007\342\256\267\255\300\366\003"
+	.ascii	"{\222\b\237\331\237S\227Y\024C\304\356~)S\277f\364q\036\363g"
+	.ascii	"\203\204\214\277\031g\203e\205\250\355.7\355\333\274\005y\230"
+	.ascii	"mwy>\264\227\333\356\216x\257#\3564\376^\r\022B\236\005\006o"
+	.ascii	"aD\260\027\212\333ni\340\325\t<\317\371r\374\214\212@\271\036"
+	.ascii	"\\\236\323\016)|U\367:)\202 \030\207\021\254"
+	.string	"94\251\213)wni\213\335MSnz\276\374/\362\020\021\332\3550$\264%\252\316\3538\177\316o\373o\316\331\357\341q\345\231\241\302\006cgg\324\002\260\255W\017L\316e\276Nm\364\250U.\213\253\306\257\371\243\331\346\255\\\236\214&\343\340.\002\246\253\234R\"\203\rTXB\n%t)a\352\204d\241s\351\303\344d*\021K\2470\302\005\221dB\211tB\002\236L$\024\260\204J\001?\nX\244\020\242@\025QD\201\337c\037\t\272\001\335XT\003\245.\2669&51\315\257x\2641'\365g(\342\374\n\245\237\035BL\ttk\321\225}\237\f\025\3749 \200\002\031\033\255\003\207\210\001\276\242\025\005sxGaC\f\250\"\2352\2144\001\222(\f\363\013\367%\205v\020\273N\351\n8Nb\260\255\260\003\366-\240pNY\250\262U7w\307R\332\252l\341\304V(\005\030\224PP"
+	.string	"\203\270\335E\300\211V?T9\230\366\006\262\032\"\254\tY*\304K\274O`6@\264-p\007\342\365r\"i\r\333\230\262\306"
+	.ascii	"\250\275\220\310\006IKOxc"
+	.text
+	.section	.gnu.lto_blackboxWriteBitPackedGroup.part.0.53.8171f4206f61da54,"e",@progbits
+	.string	"(\265/\375`\340\005\305\""
+	.string	"Z@\230\rG\240\232M:\374\247\224\335\202\234<I\253\037\301~n\310&/\300i\202\212Y\372\004\260%\035\347\247\256\306s;%\350NZ`\354yiN\274\016\036\323\034g\314\314\263\n\303\254\017?\344\200\207\036jM\032!D\312\224\002\306"
+	.string	"\275"
+	.string	"\274"
+	.ascii	"M\ftlN\035i\264\346\234\013\310\213\265P\365>\335\227\240\030"
+	.ascii	"\362M\251(\253\332Or%I_\202\342=sNm\321\232\323g\340\242\023"
+	.ascii	"\220\027\355;\320x\221<m\274h\037\211m]T\222\215\346>\037s\250"
+	.ascii	"\207\303\251\252\315\234\323vq{\254a\301`0\370\320w\3076\351"
+	.ascii	"\262\030\t\033\305p\265L\362\225.;\230(\032\\\027@$J\206\306"
+	.ascii	"\004\360\220\232q\022\306\200\353\023zVjtH\3158L\237x1>\206\004"
+	.ascii	"npy\001\364e\307\231\222\267Sq\207\347\024\326\346\234\307j\322"
+	.ascii	"0\2045\265\b\262\303c\n\025|ym}\353\n\305[\322\225\365\\\\i/"
+	.ascii	"a\f\346\234\376R\215;\347\266\325\330\276`\213M\001]n\237Q\335"
+	.ascii	"\263\352\331\245\334<\253\336Y\265\316\257\252\376R\026\373\325"
+	.ascii	"M\216j\330\252GU\213\367\375\241\250^Q\255\247r\277\2462\020"
+	.ascii	"\330\230\263E\360\315\314!n\t\371\325/\345\247\362g\371\255\374"
+	.ascii	"]>\332\367\271pu\311\262\362\252r\345Z\262`\301b`-6\247\0167"
+	.ascii	"Z\026H+@\240\201\263\245\034\263\207\205\230\336\222\n\344\251"
+	.ascii	"|\212\277\345R+\313\312\327r\231e`8\241<\350\005\0312\347\244"
+	.ascii	"@^\\\337J\347_\035\313%\024\335\245\350\\c\212b\240\230\336\021"
+	.ascii	"\2579g\004\362\342\241\270|b\342Sj^E\233\036\020\2579}D\027\r"
+	.ascii	"\201\364\352\253t\241o\362\242\274L\376Kz:\232\2636\007\334\370"
+	.ascii	"'\035\221\227c\017\340E\022#b\270\344\346,\224\303<g\217u\003"
+	.ascii	"j\252\314\374\272\230\364+\354*\211\376\255\277\307\016\006\032"
+	.ascii	"\225\355\027\352X\177\213\035\f\256\32271\3768\201\021GcK.T\271"
+	.ascii	"\337+\371qa\322/\357\3039\347\334\245\262]\340_\331\322~Olv7"
+	.ascii	"\310\205ml\025\313\351\205L\307\265?\344\364O\260\2551\255\222"
+	.ascii	"\375/H!\374\037>\212\361\342\270:\006\212\306\206+\356wE\302"
+	.ascii	"{\313\250\273\373\035\221\024\032\364W\367[\227\020\346)\350"
+	.ascii	"\024gI\203\336\357\223+M<]*o\251\300\307\227\227w\312\036\032"
+	.ascii	"\325B\253\016R5\220\250\376\021\325\264\0077\f\232\001\203\342"
+	.ascii	"\336\001I\003\316\2048\002\t\327\300\310\350\006C:\"\221s \033"
+	.ascii	"\261\201\204\321\255\304\350\242\003\034\216p\032rEG\0330\234"
+	.ascii	"\310e\360Pt3\312`;\302\335>\330\212D\214\260\035\030\340\034"
+	.ascii	"\210\r\"lH\271\234\b[i[\277Sf\260\264)dK\345X\0279\264\333\005"
+	.ascii	"#\272\217\317\226\\1\237\035Z\332oE\326\356\306LyVH\246AB\023"
+	.ascii	"\202\366X?\033.\320\275\234\266?>K\333s\235\302o\305\025r\251"
+	.ascii	"\314\343$\306\224\361c\256\342\316&p\022#HHt\236\231\212=k\337"
+	.ascii	"\212\364O\2565\255"
+	.string	"\222g\333\263@\234\342,\2219\317\316\366ZN~\355\200\n\356\326\244\320 ,f\305\344\315\270S\016\260JUi~et\266v\003\307\235\035\341\354\206\004p\250q<\304\0302\204fF$\020\031i\232\016\200\002\231*3\017\021\220-\204h\202\202)d\237\003\364H\222\017\335\020\311R}\200\315\022p^:\351\2077\202Qj(/&\243\302\313s\300\260\005P\201\242J\247_\316\374\217\330\274\377\210(\316\213\255\231\251\366Q\0034\204u\002\2567\220eU1\313\022\3755\227R\f\261>R\324\246\243\256\215\036'xU\343\361\272[\006\037\364M+'\215\362\332\b\3728\251\246b\362Gk\"\362\t\234\350\005\310\327NL\005\306@$\030\216\361\361\032\3151\246\341N\353Nb\201\364d)\317\230\177\327e\327p\b\001\323\036\310\323C\035\025\370\365ca\244\267(\005\246\303\340\247\370\203\r\237f\345\264\025\255`\333"
+	.ascii	"\354\276\351\004!\363|\206\211U\257j\255\001\f\r\352\217\352"
+	.ascii	"\332\362>)\027\324\337\302\274\347\007"
+	.text
+	.section	.gnu.lto_.symbol_nodes.8171f4206f61da54,"e",@progbits
+	.string	"(\265/\375`A\005\375\024"
+	.string	"\006\037tI\360\356&\035\324\036\356\244\223\343r\322\"K\227\257\001\322\276\034~\342\247#\203\316j\263l\351v\323\r\332H\231X\242\217\363\350R>\260\211l\022T\343V\251\257~\370\361G\320\267e\337\322\266\265\265\r\0173\333A\b\245&wd"
+	.string	"]"
+	.string	"^"
+	.ascii	".!"
+	.string	"\3751\203\350\205\005H\323\344\321\016\314\320G\317jK\320\205\260e\354\222A\204\005\217\356\250u\214\326\340\254\247\217\254a\035]\300'\326/\360\244\233\355*\211\264\003\254[\037T\024\353\253\r\224\\\265\356Rr\245-\217\216\2268P\223\204\304\352\220\212\342\211\036)[\312\025-\314QJ\351\327\253\222\224\322C\020^\345\353\235G\357l\275s\245yW\231^Gw\225\356\266Yw\266\033\226i\033\200zb\334QF\314\375\253 \367O\206\237\202\250\202\006\346\236\272,\213bt\354\344/\220O\351\001\002\332$@\333P\232\344\244GL:\245\244Q\230R*eX\203\244Kx\244El\035\"\322 B@?\001\314\252\257\214\016\352Q\320\210\231\252\207VvY\252\340\3603Uw]\346\0219Su\276\271643#\3134\205\3132\241F\260<q0\200\230\337!T\005\3666\206\263\013Z\327\310\265\027&x\346w\276"
+	.string	"\316F\034\347\221\343\034dJ\245\236"
+	.ascii	"u\033\210\272\nx\372\315t\272w\247\351<M\017\362\366\202\325"
+	.ascii	"`\337\250\225\355\353\236e\256IB\032\232\256\263\310\265\376"
+	.ascii	"\005\231X\377,\363\013\216\f\027\220u\024\3537\376>\204 qb]\202"
+	.ascii	"\345WQ\f\030s\365\225\007\267Ae\020Z\331\310\004`\204\216\346"
+	.ascii	"\352sd\020\0279-s\365\3248Wg\236\273\243\2033\336\330\320\334"
+	.ascii	"\231\312\036j[\226-Xjo\250a$NS\247Ii\245\334\340\002!\232\322"
+	.ascii	"6\0210\024G\202\311F(ii\n\035`\r\n:(\320\001\225[\321\2049p\263"
+	.ascii	"[@\031!U\021\214>\025\360GP\237\321\376^\t\373\354\017M\353\027"
+	.ascii	":\005\002\3038(k\307\230\n\322\220nu\200\3726z#L\243z~\213\315"
+	.ascii	"\202K\371\034\220\007,h\373,\007\361G@F\216y\203l\007q\314\313"
+	.ascii	"\345\2242e\346\263\211\201>\f\215\3116T\r#&\234\236\21744$\277"
+	.ascii	"O\372X\361\261\362\207W\025\253\002\316\030\222\224\246\366\244"
+	.ascii	"\230\230\222.\365R\211\220\336\333r`\230\240\355\201Q\355<\343"
+	.ascii	"\326\366\371\2120q\246\361\024V\355~\023\033\364\2230\226\035"
+	.ascii	"#X\235\017\027I7{\252"
+	.text
+	.section	.gnu.lto_.refs.8171f4206f61da54,"e",@progbits
+	.string	"(\265/\375 E\215\001"
+	.string	"RD\013\020pW\351\374\377\307/ht\270\005\034\372R\246\024jh\213\355\246\313D\360(K\024\0355SjX\2016\260\005h\221\355L\227\217:\b"
+	.text
+	.section	.gnu.lto_.decls.8171f4206f61da54,"e",@progbits
+	.string	"(\265/\375`\217\030\365j"
+	.string	"\212\253\354%Q0RJ\032\016\377\271\277\366\353\373\357\372\357\352\237\276\233\3673\305\276\005\027\207g3\351\024\254\210\250\212;\242\337Uk\037\373\250J\024\245\030\353*\302\f\252\n\250D\"\210\210*\"\t"
+	.string	"(\344L\231\213 \216\240P\225\226\226\331\357/\266%\266\211\224)\354\001:\002d\002\373\344\331/95fg\214\\q\372\f\324/O/\207\247\267^\273\031\242\321ht\316\213\267\313r\371z}\315\361\241E%\211z\351\026\261\\\337\256\335\362\027\020|w\244\352\251\256\030\315n\242\355\312\231\353&\312\331M`7\201T\210&(X\275\364\025\250\377j\331J\227D\311\222\342t\211X,\373L\261Y\337,\253u\036\321\332\253\031\035\220LNu\366D\217%Pe\350\336\024\275\215F7\305\025,\336[\034\234\024\253}.\326\277W;\304\303n\232\335E\335="
+	.ascii	"\211\254\037J;p\272(\326D\357\367\373Z\231\350-\227\326\276\242"
+	.ascii	"\"\367\364\342\364\337\252\265\302P\220\240\274q\272S\226\312"
+	.ascii	">\317\265T\337*\013}M\321\332\320\356\316Y'\257\243\023\247\b"
+	.ascii	"\354\211^\nC\375\256\027\200\252\033\202\263\332Bw\267o\317%"
+	.ascii	"\345_\251\235Z\261K\366h\366U\367\272\223\263*\035)\341\364\353"
+	.ascii	"\236\350\251k\242\314\032\375KC\321\312\235@\376\213\002\321"
+	.ascii	"\177\033C(\007I\374l\302\177\271=\336\367o\032\270\355/\013\266"
+	.ascii	"3\303\231\237\0178\363\233\237Eh\240\006tc\270\315\317\033\240"
+	.ascii	"\250@\013\305\326K\374,\001t\004\033\307\371\371\367\257\r\f"
+	.ascii	"\377J\360\302k~~\200\001N\2619\\8\001?\343\374\353A\013\377\226"
+	.ascii	"\300\302\2777x\354\320\377\261\235\237w\377F\240\002H\375w\353"
+	.ascii	"\337\024\376\375\371\327\347_\023\376\375\340\337\013\376\235"
+	.ascii	"\340\337\236\177c\374\353\342\337\271\177s\376u\340\337\006\376"
+	.ascii	"]\340\337\004\376]\361/\212\177\005\370\027\200\177o\376U\377"
+	.ascii	"\355\375\273\377\351\376\303\375w\373\277\366\277\203\377c\376"
+	.ascii	"\243\375\007\363?\354\377\227\377@\377\273\376k\375\267\361\237"
+	.ascii	"\353?\364\377\326\377\032\377\261\376[\371?\365\237\305\377\257"
+	.ascii	"\377\001D\243\321\350\317K\377]\327\257\263$WHINh8\033\255\251"
+	.ascii	"a\244\334\214p\312E+v\3234\004\226%V4\312\307\355d\032\031\245"
+	.ascii	"V\034\t1MZ\216\340>\037\271zI_iR\304p\246\240\234\205I\305-]"
+	.ascii	"\334\316\365\272wm&-\323\244\3319\356f\267\323\307%\n\222\266"
+	.ascii	"^Z\342\331e\035\251\262\205\323\235\273\371B.\0359\335#\266\252"
+	.ascii	"\006\256\007\267:F\242~\347\340\340\326mu\032\311&\347\374\246"
+	.ascii	"\265\375/ \330\347\266\255\233\013\037V\322\\[/W\007\326\210"
+	.ascii	"5\263\317\025{\006\247.\210:\2710\352wEo\243\273\242\367\275"
+	.ascii	"\242\252\375W\333\265]\352\035[\235R+\252\314w\315\206(\311\324"
+	.ascii	"\234.\231\005SW\245\036`\316\225\002\331\222\002\013BMCcB\325"
+	.ascii	"\2648\375\222\255\230o\331s\313\026\355:\335\215\354>b\304D\230"
+	.ascii	"\"\224B\342zi\311\363\357\331\027\355k7\335S\335\255\002'J\265"
+	.ascii	"\306\306\351\232\275\f\t\265&C\2448\375\333v\361\332\227\256"
+	.ascii	"&N/\203z\376{M\264\354n\037\274\265\227\310\233/o\227\347\307"
+	.ascii	"\331\335*\360?\355\335\377\034\250n$77\365)\013\021\221#\320"
+	.ascii	"Q\335\307\235^{\231\2042\035"
+	.string	"\223V\3020w\326N2@C\225treb\246\315\346^{\273\210\211\271Brm.\223k\363\250\323E\315c\367\312\324I^\021\0357\teb&\241M\346N\027\365\261\241DI\324\242&3\371\245\311\324IB\211\230\311\"&\346\316\221[SV\222\215\211\3102\223E\215tT\204h\2513\226\\\233\215\326\275WF\275T\240\273Hs\211F\024d\265\220cHH\"\210\232\273vw\212#dS\263\213\306\222P\315n(\244\216>\212q\\\307\332i\307\216J\212t\017\243n\002z\355>\352>n\217u\367\261\273}\313\"k\367\020\235\244\363\350\250{\t\305Q\0279n\031u\363U\232\0263\tmj\376\266\252\240\316\256a=\256\263\321\230\226*\364\370\354\036gT'\363\207\2310`l\342\260\234\365\216\331\bA\342\245\f\247\377@,L\n\207\034\234\360:U\263%\347\003\020N\327\313~\005F[\2660X"
+	.ascii	"RV4P=2H\033\234^g\260\363\027\253%\230%/\374e\024E*\t\231\312"
+	.ascii	"\\\270\213j4\006JT\017\214\201\232-B\312D\235rN\236p\312]/\363"
+	.ascii	"\242)T\2706mK\230\022\f\247\\\304\212\025\0351\233\242\345\352"
+	.ascii	"\214u\305[<)K<>87&eZ\347\2555\233\344\017U@p\226[\331\372\202"
+	.ascii	"\313\302Y7`h\250C\3424\213\2570\226\377(l\332\222\242L\"\376"
+	.ascii	"\032\033-%mOO\365\275'\225\2078W\321rd\t\323\023\313\214\210"
+	.ascii	"\223i\312\031:\205\253\322/\335H\027+\022\255\223Exp\254\342"
+	.ascii	"\342\350\254\234\253\270R\037Mh\363\344(\253\340\220\2342\325"
+	.ascii	"\271\312_\343;+\373\242\032\242\362z~\022\371\241\006\005\204"
+	.ascii	"\212\016_\302zI\352{G!\204\340\251\245\352\244\236U\223M)"
+	.string	"n\306\331\2253R\347\251\005\263\3711\345\204\216\327\305?\374\300QKe@Z\220\266\250\356%\036^\026\262\354\t\020\347(\236\224\2265\310\272\361\232\340\310d\271\352\241\007\206J\343\304iz*\343\362t\206\342)\250\230\243gY\037\262\202\360\201\235\354d\245\t\242\2409U\035\260\314\204(\341\201\007~\362\313RjE1\232g\324\352o\347'\2740PO\2608=\317\307\016;\360\222+tJ\255\270\022pnQrrL\230\260\223\223R\251\025\347C\003\247l\352pv\342\3621\243\360\260\fkj\342%eH\316f\031\261#%\347%VH\220p\022:\025^KW\315s\222\0346-&dv\253\204\323\315\311\361\207!C\330\310\232\323\227C\232\230%\0279\033Q\255\302\342\2368e\"\253%\365\372\332\352T\310\322\322\316\251:\215$\023s\246HW\234\306\352\030\007\306\201\225\266\227d]\224ZQeL\250\324"
+	.string	"\344\254\264X\275\344\304\312\030\250$5\2401\022/\031\211}\234\231g\037j`oZ\252\2468\317\2728\345$N\332\271\355%\233\223R+\n\207\n\227\252 \266\324\357\236\224J\356\241vO\325\340\320\344\331\345\206s\217\224\214\212\031\032X/,i\356\bN\277#\242\376\234\374>9\271VR\252fz \026\244-\256{\311\001\t\236P\324\310\030\311H6R{\355\343\332I[\345h\027&\374H\370\235\300\343\221c$j\020dCHht\201\206Q(\350c\342\2078,\032k\2300\026\203F!"
+	.string	"\256\203\305\216\002\204\204\204>>\301\236\t?\022`\234\3003\006U(\006\345"
+	.string	"\356\310a$\201\300\360F\020\310C\310\005!\235\237\240\021\b\304\301A\024\002\203<tX\b*\3520\006\021}9\202B\240\324(D\f\362\341\275"
+	.string	"\344\003$\016\215@\303\241\033@ \316u\264 \006\251\240B\220\317\n\241\005?\301\027~\206/\334\340\030\203A@\027"
+	.string	"\360\002\206\216\016\241!\240\013vd\374j\304"
+	.ascii	"\366\b\201n\004\207\305`\b*^\300\250\001\003\370B\306OG\306O"
+	.ascii	"\205\013\301b\221\002\002j\234\020\200F\b5z\200=?A\033+h\204"
+	.ascii	"\200CH\374\031\n\021A\030\340:X\004\r\0250\n\177"
+	.ascii	"p\f\321\b@H\034rP\024\342\b\n3@\221\303H\034\026=(Q\200\013\026"
+	.ascii	"\306bp\007\213\035CAE\fp\bS\360\tz\240\200\021\330\3433\022\207"
+	.ascii	"\202*(\ns\344\030\242a\034\322\020@\3108\244!4\016\213\"\354"
+	.ascii	"\234\347A;\204\305\026\306\240\240b\013\033\037\343\320\016 "
+	.ascii	"\357>\303\242\220(\374Q\037C\306\0032zZ\360\275g\206\213\031"
+	.ascii	".z\357\231\361\373\315\220\361S/\343\2673\n\r\201\200A\036Cj"
+	.ascii	"1\250\303'5\002e\374\214\300\0270\214\304\241\357\277_\005\b"
+	.ascii	"\200\320\001\006\252\017\213\037\342\020G\220\017Q\bl!\350F\n"
+	.ascii	">A\240\033-\210\303\240\n-|\212B-X0P\303Z\220&\307+\253\322I"
+	.ascii	"g\206\206*\343\233\031\226\"\245\035\032/-FHVc)SV\232h\347H\f"
+	.ascii	"A\026\341\262;\256\033\223\201\365@\356\332\207\231\251&L\234"
+	.ascii	"r\035\323q\364\\\367\225\353r6\001~\"\342G]o\256G\n%\223\206"
+	.ascii	"Nn\352\006L\311\213\217#\316r\332\342\336\240i\266T\262#Ob\342"
+	.ascii	"\300\202\270\355@"
+	.string	"\206\206\254\227\344\207\334\020\234\256\255\361\233z\354\001Sj\305\265\235\337\316n;\250\022\r\322\031\376\212\342\344\364\344\224\215`3\276*LI\300|[\f\224\350\222L3\305\346{\226\211*\021\347\245\314\006N\307\214a\265%\233\222\217j\313\206\036\322\316jk$\304U\235\217\207\2622>[*\003\324J\270Y\001\2313;\237q-\032(\267&b@\310\335`&D\354\fF\214\311xSvJUa^\302\234\311J\244\2319\"9\2052E\211\030\247<\346\013\202\006\250B\361,\007#\235BfJDD\222$I\007\322\n\020\206B\201\244\367n\022\340D1\323\"\205\204hFSFIRcY\003\2118\260(%W\207T^8\217<\314\375SH;~\177\316\021\r\317\225I\304\206l\004\354\206\036\260\033\024kr=Q\206\227\0047\217\2160\256\273Z$E\340\374\273\211\300[\200&d\252\3548\306\307~="
+	.string	"\343n-q\277\373E\361\260\037\320\353N4\270\302P\274\002\325\207"
+	.string	"\270\221e\260\275\300Mh\016J\234\035e\256J4\331U}\221\256'!U\354\212\016\274,\235\035_H\022\006#5\245\235?2X'|\034\026U\034\340\370"
+	.string	"O-\311X4\320\231>\252\020\307Y\326&\037+\337\2578\366\253\021![\245\211s\354\2444v\345\304I\317\244a\031\244A\260\227\250\334PT??\00416\316\205-\257/v\032T\222\310fQ/\371\362@\224\342\262#\244,\006<!\021a\334\031\310\033\371\361\013\343\305Z~\354*H\"D\3023\305\300E\312\320\301l\235\236\006\272?\357\037\f$\022\037G2\310\334\232\035\220~pq\177\241\212\325\376\201a\263\231^\324\024\207]\361\304F\345\376P\017-\323O\225\013\371IV$f\272\004\0271SyPD\370\007j\276\347\353\020"
+	.string	"\321\261\343\245P\217\220\3732\030\230\332-\301\017\313\262\rZ\006\025\250<\363\3254\325Jz\316\313\306\037\b\271\343\340|\321\340\350\254\266\211\344+\013\301"
+	.string	"%B\234\212q\326\313\226J\366\307T\225Fv\025\214ZJ\275\215\303\347\033\342\242Pfq\331\346\204\331\200\234\016\203AEmhR\311sp\005\007\255\211\3368;V\302\221\232`\032R\325Z\256\201b\306\027$]Z\021]\231?\327\265$\361"
+	.string	"\301!G\345\262S~:{\022XUFV\347\303\270\220\020\321\310\315d\021N\260^\003\301Q\376l\261o\005\271-\340\256\206Y|\"\007\343Z8g\017ih\247\242\213\356 \205"
+	.string	"2W\021\021\260\35782\306qu\305\254\017\202\254\306\333\322\177\263Q-\375H\030W<\311\201.\234\201g=b%\357z\013\241u\177\311\0354\272\304!R\024\270\227e\214\001?\276\322%\370\355as(\3536\226\024\374\317\366\354O\314\226\021\264"
+	.ascii	"f\227,\354\354\370\016^Y$\363\311\260Zq\025K\275\f\341\362\302"
+	.ascii	"\346|\023\307\304P\f\267mK\n\021\325\266\325\304C=O\f\223\331"
+	.ascii	"\025\277r\214\321\004\224v\311wZ!8\212\254\376\322n\037g\020"
+	.ascii	"\324\236\222\315,%eei\026q\322\331kA\001,@\r\362\366\251\347"
+	.ascii	"\250z\243u0I\244U\357\244\323\341\361\267p/\250\216\270\212\325"
+	.ascii	"\312\254\026\023\347\320\022\257\2372\200D\271\247\312\230\223"
+	.ascii	"4y\002x\324<\235\246\335\031dP\307)\371+\224\217\300G\207\261"
+	.ascii	"\303\373\262\225^g\360\334\332\rj\034\344>\024\340\256\315\005"
+	.ascii	"\337;\001\206D\367\341^\267\370ta\205s\001\366l\224\313\206\\"
+	.ascii	"G\317\301\364\344\026\310\365b`\311\032\235U7\331q\b\317\307"
+	.ascii	"\321\320Lh\326?\237\265l)\320\210h\252\266\223\266\377\211\235"
+	.ascii	"\303\341>G/\251\341Hy\227\330\321\214\262\001\346d}\347\213\371"
+	.ascii	"\263C\241\341\206\017\031<\023\201?\333\337\342Ef\257\364\031"
+	.ascii	"<5\354\004\264Mw\327\332\017t\241\017\210\230\362X6\214\337\227"
+	.ascii	"\345\343\004\362i\370\215\365F\213G.\213\023CB\207\300&\341L"
+	.ascii	"{\347\250\335\356W\374\217s\264\262s\300at\007\370H\262\177\272"
+	.ascii	"\255b\361m\217\207i}\245\f\202\343\371\266\360\n7-\277\320\371"
+	.ascii	"v\375\350\351\342=\310_\267\236\365\031\026\370P\232<\305\255"
+	.text
+	.section	.gnu.lto_.symtab.8171f4206f61da54,"e",@progbits
+	.string	"blackboxPrintf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.string	"blackboxPrintfHeaderLine"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\001"
+	.string	""
+	.string	"blackboxWriteUnsignedVB"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\001"
+	.string	""
+	.string	"blackboxWriteSignedVB"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\001"
+	.string	""
+	.string	"blackboxWriteSignedVBArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\001"
+	.string	""
+	.string	"blackboxWriteSigned16VBArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\001"
+	.string	""
+	.string	"blackboxWriteS16"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\001"
+	.string	""
+	.string	"blackboxWriteTag2_3S32"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\001"
+	.string	""
+	.string	"blackboxWriteTag2_3SVariable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\001"
+	.string	""
+	.string	"blackboxWriteTag8_4S16"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\001"
+	.string	""
+	.string	"blackboxWriteTag8_8SVB"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\001"
+	.string	""
+	.string	"blackboxWriteBitPackedGroup"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374"
+	.string	""
+	.string	""
+	.string	"blackboxFlushBits"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\001"
+	.string	""
+	.string	"blackboxWriteU32"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\001"
+	.string	""
+	.string	"blackboxWriteFloat"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\001"
+	.string	""
+	.string	"blackboxHeaderBudget"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\001"
+	.string	""
+	.string	"blackboxWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\001"
+	.string	""
+	.string	"zigzagEncode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\001"
+	.string	""
+	.string	"tfp_format"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\001"
+	.string	""
+	.string	"blackboxWriteString"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\001"
+	.string	""
+	.string	"castFloatBytesToInt"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.8171f4206f61da54,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
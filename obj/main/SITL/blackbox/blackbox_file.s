@@ -0,0 +1,893 @@
+	.file	"blackbox_file.c"
+	.section	.gnu.lto_.profile.f30b1792b47f70e3,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.f30b1792b47f70e3,"e",@progbits
+	.string	"(\265/\375` "
+	.string	"\225\005"
+	.string	"\364\007\024\001"
+	.string	"\r"
+	.string	"\241\323\227\356\006"
+	.string	"\001\205\247\373\350\t\016\002"
+	.string	"\002\001\002\002\002\001\002\003\002\001\325\264\246\334\007\003\272\356\256\222\001\016\004\002\002\001\002\005\002\005\005\221\210\226\222\n\004\002\002\001\006\202\224\220\310\n\n\005\002\005"
+	.string	"\007\307\276\344\257\003"
+	.string	"\b\354\333\374\234\016\f\t\237\236\353\277\003\022\002\n\322\325\266\326\016\016"
+	.string	""
+	.string	"\013\373\371\262\245\005\002\f\245\355\246\261\n\r\236\233\221\355\007\002\002\002\002\001"
+	.string	"\024"
+	.ascii	".)\\\b\006\306Y5\254\teac\201qvc\316f\002x0\002P\005\005s\243"
+	.ascii	"\272\321TCd\ne*\217*\033\210*\322/sh\300\r"
+	.text
+	.section	.gnu.lto_.ipa_sra.f30b1792b47f70e3,"e",@progbits
+	.string	"(\265/\375 \213\375\002"
+	.string	"\244\003\177"
+	.string	"\f"
+	.string	""
+	.string	"\003"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"\001"
+	.string	"\003\001\005"
+	.string	"\001"
+	.string	"\001\006"
+	.string	"\001\007"
+	.string	"\003\b"
+	.string	""
+	.string	""
+	.string	"\001\t\001"
+	.string	"\001\n\002"
+	.string	"\020"
+	.string	"\007\001\001\200\004\b\013"
+	.string	"\003\f"
+	.string	"\003\r"
+	.string	"\003"
+	.string	"\017"
+	.ascii	"M\t\374\004x\360&\301}\301:\233\016R\226\366\224\260\363\n\212"
+	.ascii	"\265\237\003\200\301\230\201\201<7\320\006"
+	.text
+	.section	.gnu.lto_.inline.f30b1792b47f70e3,"e",@progbits
+	.string	"(\265/\375`\026\002\005\f"
+	.string	"\326P95Po\322\030$\303\326"
+	.string	"\246\020\007\016r\027\005P\033E\314\307\023\030LQ\306\017\n\nk\353\030v`zEUU\025R\353\366W\030\335\b\201\004\261\233\354-e\n("
+	.string	"'"
+	.string	"-"
+	.string	"\257u\3573C]\221\344'\366\326\272\374/\375\327u{\247\323\251\024\277\243%P\312H\243\237\016Zb\"2\262\360\330\317\n/\265\356\fj\035\374\003b\376g\374\007*NwW\">\203b|p\254$\350g\203\272\204</\n\347\257\237\031\374\f\026\233\001\264\016\276\225oE(\027\006\237\216\026\020\302U\304so\314\031\212\243!\273kQ\354\256\300\361R\356U/\201~v4\264\273\005\007g\034\344Pc\233\352\203_9\341\2412:\320\037\243\231\271\221\361a\331l\301\352MM\236\023\023\324\030\201\2204Q\023\"F}XE\025\244F\250\2211d3ca\215\302\306\034`\002\021*\334\003\022 \025>\313\214`*\262]\3777\026\233\273\372\230\341\207E\365\326\343\344 $}\202\342'\370\324\346\036\003/qa\360BY59\352\013\013PEPI?t5(\235qJ\356`,\316\202h"
+	.string	"\256^\035:\371\224\332\213\347\263\376\265\251_>\275\026\324\374<\212\353)\265\310AK\025\305\375\323F\032\320\375\n:m\027$<\337\230Gn\3655\304\306\020\227\262\356\330\302\367J1O\373\027\035\274\007P"
+	.ascii	"TI\234\023"
+	.text
+	.section	.gnu.lto_.jmpfuncs.f30b1792b47f70e3,"e",@progbits
+	.string	"(\265/\375`\354\003\035\020"
+	.string	"\226\225K;@K\234\016\3030\247\b\327\340\234\rF\001Z\325\240(\212%\034\3545VHk\364\211\257\323\266\222\017`Y\357\223\207\304\232\004\376\231\035j\351\320\217^].\225\324\356\376{\313\224\0024"
+	.string	"6"
+	.string	">"
+	.ascii	"\222\264\025\376\227(\270\020>\223[\231\036\244az\247\340?\374"
+	.ascii	"\036\276w\215\216\242[\204\\\033\363\rr\3535\371kr/\353F\217"
+	.ascii	"\037=\267\327\266d\216\035-\004\034$\323cPP\256\255\300\260\321"
+	.ascii	"\023'\027.7\200\224\351-(ho\327uk\303\207\270\357\021\022\276"
+	.ascii	"\276\376 \376\317\367\323>&\327\365Wp\306\267\376\226\220\030"
+	.ascii	"\3077\206D\254h\353Q5\024\266\005\004\330\314\256\353:\370\b"
+	.ascii	"m5\260\037\360o\264\365\022\300\304\304#\310\2156\364}\2370\275"
+	.ascii	"\215\202\213\305-1;\035\312\371P\316GV\230\236\004\310\004\276"
+	.ascii	"\357\373\036\266\036UC\303`\301\004\211X\216\002\030wa\031\n"
+	.ascii	"\002G\033\306u\310@5\023\345\266\013C\267\211n\264LF9\352rQ\022"
+	.ascii	"8\332&\252q4\273T\262L\263\320\t\205H\005\341\201\003\253\222"
+	.ascii	"\034\360\226i\026EV\250!Ae\234\262\221\302\222b\2155@B\202\024"
+	.ascii	"C\363\022\340BQ\006dQV\031g\024\n(\232\210\206a\335r\2528\t\270"
+	.ascii	"\313\220j\270RX\004\244\254\203\243\027i\214tf,\273\005/\270"
+	.ascii	"W\200A|<K\206\037\310\367\266\001\243S\223P\313s\005u\222\372"
+	.ascii	"1\260\006\035\246(\024=\322\272a\324F&l,4\211\035\013\f#\323"
+	.ascii	"\312\352\337\314\332\027\243\324]\217\006\003\212\332\377\237"
+	.ascii	"\237\201\201-\216\262\212\274@3\022\303Qz\204\342\243P\261\300"
+	.ascii	"h\201\301\376\216C\241D\226[\356Q\253\021\260\363\"\350}\270"
+	.ascii	":T\341\025k\3644\022@\211\210\323|\223\303\216A\034\333\321\244"
+	.ascii	"DQ+\2721\201\232\037b\365\013\357\323\327\017F3\336\260\245\030"
+	.ascii	"|\0170\003"
+	.text
+	.section	.gnu.lto_.pureconst.f30b1792b47f70e3,"e",@progbits
+	.string	"(\265/\375 )I\001"
+	.string	"%"
+	.string	""
+	.string	""
+	.string	"\f"
+	.ascii	"\270\004\001\230\004\003\230\005\005\230\004\006\230\005\007"
+	.ascii	"\200\004\b\230\005\t\230\004\n\230\004\013\204\004\f\204\004"
+	.ascii	"\r\204\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.f30b1792b47f70e3,"e",@progbits
+	.string	"(\265/\375`\203"
+	.string	"\365\005"
+	.string	"\322\006\027!\240'\351c/\376\337\215"
+	.ascii	"\200\373\001|(v\364\013\3223}+D7\343\372Mf\377n\215\020)S\263"
+	.ascii	"\207!\240\347Ff\2159\315i\320\341f\006\312\257\345\230J\360="
+	.ascii	"\030\370D\300\263\311\310\317\244\252)o:\231\362\245M_\022:\257"
+	.ascii	"Siz)i`,\242F\244x]x&\002, p\2429\267\007c\241\327e\007\343&j"
+	.ascii	"s 9\240\362\024[\027O\243e\320\312`f\267\315\"\303\356\271Eg"
+	.ascii	"\017j\207\216\013~9\360\267v!e\341\353\025qLh7\365s\270\336#"
+	.ascii	"\217\330r\027#X'B\016\242\r\\\377\021^\264w\3415a=m\255-\246"
+	.ascii	"F \2651\322\206\t\007"
+	.text
+	.section	.gnu.lto_.lto.f30b1792b47f70e3,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_blackboxFile.28.f30b1792b47f70e3,"e",@progbits
+	.string	"(\265/\375 \025\251"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\202\210\200\b\177}/"
+	.text
+	.section	.gnu.lto_blackboxFileFindLargestLogNumber.29.f30b1792b47f70e3,"e",@progbits
+	.string	"(\265/\375`A\004\335\036"
+	.string	"6z\314I\220XN:\002A\356\225\302\240\005\242\367\256\254\241=m\030\355\265\032=\t\272 \346\306\243\216\272\027RJ\375\361\356\205\360\351\307u\262\266\374W\264 \253:\202q\005`\202\t\266B\363Jnt\352\311\243tk\204\220\275\345N2\271"
+	.string	"\254"
+	.string	"\272"
+	.ascii	"\311{\257\2050\246\341\321E\204\363\026\311\2234\335\330\342"
+	.ascii	"wh\205\213q\204\221\274\327\330s\313\r\316[6\236|"
+	.string	"\260\033iba5z\025\205\334\246\220d\356\275;\235\343\224\267\3656\345m\353\340\223\n\237\303\235fik\353\250\220\357\364\234\t\345\305\206\343j\353\270jJU}]\213\225V\375iK\246\035\tE\317\362*\353&\326\313\312 \351DL\325\027QW\034R\253s\357\325\025\245h\255\flT\221\021\2408Uq\262pyy\331)U1\212\366\237\262\256\253\022\334\252\224]\213\025\215\332\\C\216\274\202\037V[\224\232\023\356\275L\211\305\2533\2003\363\0313\257`\3560\001W\335]\374\377x\265\261\351:\0073\2253=\340\205\216#\227(\332\3063\364cob\224\300\353\336\341\211\276s(\304\203\342\210\2368\323G\376X\303\242ZT;1\033\241hw1\377g\207\027+\356\034\314&\345\234\2232\216I\371\306\346d\347\232\033\3174\017;\317\344\230\262y\261si)[\223r\265\224\333\244LK\312\037\340`\206"
+	.string	"0\367V\275\271]5\233\326\343d\277\361\017\373\305^\231\317_\3623f\035\2578\023\206\300\206f\306\3741~\031\353\310\226\250\270\2522\234\267\272\33337\361\225\374x$\353.&\254\227\354B\2212\001cbp:\247\037e\252\214\002\232;G)\371\302$\245m\376\031\005\013\364D\234\376\331/\003\213H\214\256d\216\355\233\035\250\214\026\026\002dWke=@o\366+F\247\b\236\333n\346 \f\364\304\332:R\355\304\006nS\322t\267\220\226\224a\020(\372\306h`gAl\317i\253(@\333\354S6\234\034\316!\b\236\333\016\036\350\211\264o\206@\324\206\355\364\2551Yk\265\273\030\300?\224\357\340\r\255i\346\020\"\350\211\357"
+	.ascii	"c>\016e\004\002\257{\243Nd&\361'C\347\275Q\017\322J\360v\326"
+	.ascii	"\356\275\347q\313oQ\336\326\364\313^\251d\275\021g<\321\267^"
+	.ascii	"\"E*|\302\207\310\367+RJ\332\365\212\226~<$\337.\230\264\264"
+	.ascii	"\313a\r@\025|,\007q\320P9\311\b\370\263\275\243!\244\252\224"
+	.ascii	"\3243\n\016\375L\246 P\211\327\013\372\212pLA%\244\236e\236O"
+	.ascii	"\357\3473A\202\005\220\b\005o\350G\264C\362\r\035\355x\301\244"
+	.ascii	"\235\317\016\003S\364\202;% 0\270\323\031\237^q9\334\r\037_\264"
+	.ascii	"\347\246\331\264\241\252r\365,;\307\003D(\204\236\310t\354H\022"
+	.ascii	"\207|P\217/\272\236s5m\272l\252;9M\007\217]v\350L3\013\211\b"
+	.ascii	"\301\350\2114@5\376z\357\275\247-\233k\227\013\250\2247\315\265"
+	.ascii	"\226m\323T\31479\247\313\276\251V\330\320\216[\002I\250Q \306"
+	.ascii	"\f3F\032\211d\202\032\321\326p`\002\031\261,\017\020hY\242,\007"
+	.ascii	"`h\321S-\266#\020H\253\340\272K\223>\027\030k\234\360\030\tt"
+	.ascii	"P\336S\037\214A\351\265\353\\\251(;\025s\215\215qfA\003\241!"
+	.ascii	"\356/\020\327b\246w\346\251Z\023\243Q\340+\002\214\242\223>\224"
+	.ascii	"\312\356c&c\275\002\225\240\030\001\377\025\031\262\324\007S"
+	.ascii	"\317U\264C{C\251k \224\343\232\207V\202\030\023\177\300]\376"
+	.ascii	"|Q)g\310\177\222:\206\351\305@\246\330\016?L\3102\275i\251U\301"
+	.ascii	"\241c\252\275\260\251H|j"
+	.text
+	.section	.gnu.lto_blackboxFileReserve.30.f30b1792b47f70e3,"e",@progbits
+	.string	"(\265/\375`\220\004u\036"
+	.string	"\206x\307J\220\330Q:\244\340\221s\207h\003\270\236-a!\253\324\253\022)\356\341\200\200`,\323\346c\201\362\352,\332l\373\207\275\2072\332@\244/\001\211%\267\n"
+	.string	"\025\002\203L\334Z\266\006%\177\260\231?\244\261\374\226\020B\210\3342\005\267"
+	.string	"\240"
+	.string	"\266"
+	.string	"TG \254G\345\225Zo\024\204\252\243\020\004l\376Aj\355\317B\230+\211\211H\214s\357\325\330\221{\327\237+H\331\374\312"
+	.ascii	"N6S\306\235l\376\177\002\006I\007\362z\303\005\032\314\022z\225"
+	.ascii	"\271w\325\265\r"
+	.string	"\006\262j\253\245\350i\226m\201g%V{\013\ryV\004\352\005\333\312\005<T\210q\331S\214R\005#\243\243V e\032QS\214\226\270)#f\\\366$U\372\230\351\210!\264\247Y\352\236\302\264l\240\232\312\233.;\220\244\260%/Qq\227\004\256f\230\261\201b*{\236P\021r\221\355\n\250\240\265h\204{\357\255\023T\024\377\306\377\327\377\035\376\322C\377A\260\030Rz\357mp\016c#C\347,6\037\302g\331\311w\262\311\315\305\302\307\220\213\270d\223\377\032\264\215\365s'\223\311\344\373\352G\355yvt\254}\216\217|\034w\361s\230\310\214s\373\032^\3717\324^E\355m\247}\255\355S\324\036E\355\317\324\336D\355\373\264\347\0016e\206U5p\364\331z]$\317\\*f\022->2\257\314]\334?\377L\344\fv\365\210ts\313.?\241\005\203x\221\300^\374\365\253/\301D>"
+	.ascii	"\313\275W-\361\253l\332?\351<\204\213W\273L\\\b\016\256\314("
+	.ascii	"Is\326\207s]\353\264\377\f\032,;\355t\217\260\225\234 5\251u"
+	.ascii	"\177\271b\206\250t\277\fQ>:\323\346\025\265l\340%Gdi\377\264"
+	.ascii	"\2701\344\"\372\300\322\002\346<\322\306q\311D\300h\363\212P"
+	.ascii	"n\254\331g\377\273\236e'\264{R\264\322\377 Nr2$g\327\210\271"
+	.ascii	"6\313\034T]\204\270\306\351\\\377\2205\215\311in\\3\030O\360"
+	.ascii	"B5\245i\310\3239\315E>`em\315\323\267Mc\356\311\316n[\363\027"
+	.ascii	"\227@\262\216[g_b\2026y\356nt+J\360\314\230\206\323\254\222\306"
+	.ascii	"\222\271\253\230\364@\323\215u\234\346\346\025\2470\331\264\027"
+	.ascii	"\002*\0222\332\371t#~>\337\257'`\307\301\n\031\231\370\021\201"
+	.ascii	"8I\354|\035\204b\250\250|\017(H\304\320\007\016'~\274\020\275"
+	.ascii	"\235\b\236n\304\320\316\247\353\021\025\351\200\f\374G\"\210"
+	.ascii	"Hg\364\373\021\351\324/q\331Wo\242\321h\236\201'\027\231\002"
+	.ascii	"R\3138\326\314\300\263\246\246\037a\251\203\345\275\367\252}"
+	.ascii	"\206d\206Z\241\375\220\272\365\277\201\255\034\345\260 \201Z"
+	.ascii	"l\031rI\301H\353\341ek\254\267\230\320\230\3524\212\f\023\216"
+	.ascii	"\241;}\353\025@>\227\363\326\274\206\251\022\006\231\205\311"
+	.ascii	"\246\325\002\330s\205Sm\037\376\341\\\353\370\267\200\301\262"
+	.ascii	"\223N\227wJ\312\311\242\250m\263c(#L\250A(\344\214r\b\221\221"
+	.ascii	"\021\221\221\021\211\341\240\242!2\253\003\020PV3&\325\001la"
+	.ascii	"B\263\237\224n\322\321P$\216\236b\036]\002\363(6\270\3332\203"
+	.ascii	"\367j\324\257\225\233q\220\247\002\332m\001\025EHI\305|\272\207"
+	.ascii	"\260\2229\305\2632\004\177j\305\355)\312r57\216\245\031V\177"
+	.ascii	"=D5:\355\326D\267z4V\026\323\202\361\307\\p\325\367/>\024\016"
+	.ascii	"~\005\b\377\020\346\362\227|\020<~\201\021\352\363Vx\"]\234j"
+	.ascii	"\"*[\262C\215QZ\004\250yIzhKaH\265\342\224X-\261\323\347\003"
+	.ascii	"[\355\215\"\002\376\001"
+	.text
+	.section	.gnu.lto_blackboxFileOpen.31.f30b1792b47f70e3,"e",@progbits
+	.string	"(\265/\375 \320\325\005"
+	.string	"R\n(2`e\323\001@\305\353A\267\362\001\265\223RC\3670\244sG\233\246\300!\"\366mL\025\206\326u\335\224\027\004\301f\023z7\251\020\300J;\306\275e\n\307\252\214\323&\222L\2756\314\342.Z\321,\n\305\272\013\255\030\257\226\254\243\230Z;z\233\247x\266\006\205fn\376\373\311\t\372\231\320\335\375)\376\022rG\202\004\252\033<0h\200Bj\364\337\373\021\377\037\336-_\021\310\237\001\216i\354\276t\206\330\262\264g.\361\202T\020 p\n?\226\207Hw_vB\017\177\362\377\306\177\307\377-\b"
+	.ascii	"\263\312Q\341b\236C\262\n\236\256yL\204\331\b1^\327$\003"
+	.text
+	.section	.gnu.lto_blackboxFileBeginLog.32.f30b1792b47f70e3,"e",@progbits
+	.string	"(\265/\375`4\003E\030"
+	.string	"\366\352\234I\240ZQ:\304{t\024\2359\306\371y\323\223\3400\366\265nO!\254=\246\327`nl\362\350\027\304@\324l\264\215\016\213\355\314EU\355\373\3520\340\347<\232@\266\200+/At;?\355G_\344\"1\277\021B\244\224)\200"
+	.string	"\200"
+	.string	"\215"
+	.ascii	"\377\310_1\277l>\331\374\221\371\315|f\376\266@\004\253\304("
+	.ascii	"(\326\212+\236\251C\222I\323\377\027\277\315'\350\274\370\271"
+	.ascii	"A\036nu\200I*RUk\320\354\035{nI\216\315\347\267&g\333\222\245"
+	.ascii	"\264dS\035\301\262%*\247\264\343h\3160\322t\223\2031\n\b\363"
+	.ascii	"c\211M\016\211{< \274Q\344&w\033\0358\r{\333[\216\221C\231W\027"
+	.ascii	"j\255\3474Gc\277\332\377&\376\013\375\r\024#\242F4)\025\001\376"
+	.ascii	"\201J\360\246\3348P\305\341\255m\017\300\375ec\345\372V(\003"
+	.ascii	"@\254\025\335T\210\205Rx-\371\017\241\340M\337\002\016\313L\301"
+	.ascii	"h\333\277g\371\247\330!g\213\370d\342\246t>2{\244\307\031^\367"
+	.ascii	".\302n\007\021\261\202\304f\376\317\026x)V\255\265\302\367\267"
+	.ascii	"BX|\231\226|\315\2107]\362kT.\271\275\275e\036\270\241\356'\344"
+	.ascii	"\210\213\177\320\306\275\373w\254\275\024L?\177'\360\004\226"
+	.ascii	"K\256\272i@9\325\320\231\332u\031\313\336'\0359\306`\231Rv\225"
+	.ascii	"K\265\210T\370KJ\265\200{\311\2054d/\025\305\203\001\"\224\037"
+	.ascii	"\234'\0314\360\246e\033\210\2621D\333v\004L\366\372\266I\207"
+	.ascii	"\025\362xX\250\205\327\222\004\366R\226x`\325z\264\351\357\263"
+	.ascii	"J~\022\360\226L\362\001\204+\251m/e\340\330\007\345\330d\327"
+	.ascii	"\360\222\240L\272\307^$Iip\226\273{\247\360\236\240\272\033\027"
+	.ascii	"\317\375\207X#\001\257\2515p\311\212`2Z\314U\364R\001\213\271"
+	.ascii	"\200D\370\354\360d\300\320\263C\002\301{6\354\344\030\351Hh\300"
+	.ascii	"\301\247\307\034\360\232\320\214\210|,GF4t\242\204\213Y\020\212"
+	.ascii	"\030\214(\310T1\004Ka\306h53\207\301g+d4\263h6\243\2316\301\272"
+	.ascii	"\275t/\373\013G}+!\360\1776\235=\272mJON~d\357\272\234\005\210"
+	.ascii	"\\V>\240\252\3108\340\365-q\313\317\n\265\254o\263\234@v\250"
+	.ascii	"c:\203\260P\236\327\177:\235=t\270WZ|\003< `\002\231!\263;\211"
+	.ascii	"P\301\212\004th\374\311\272\203e\313^Dk^\2125\322,\032\275X\320"
+	.ascii	"b\223\262\006l\335\255h\244Y\201!\322\213\035Zo\304\022\241K"
+	.ascii	"\2123\212\"wUi\351?.\311\362\364l\364\274b\2705\246\037Z`\335"
+	.ascii	"\003B\212\314Dm\361\260Hzh\334\273\3410~\223K\006 `\rK@0\310"
+	.ascii	"\260\212\033{4\016\327\016n\202\235\220\362\233\231\277\002Y"
+	.ascii	"\026*\217\207L\211cM\244\332\330\t\0359\314\275C\323\304\220"
+	.ascii	"\030\335v3"
+	.text
+	.section	.gnu.lto_blackboxFileEndLog.33.f30b1792b47f70e3,"e",@progbits
+	.string	"(\265/\375`\264\002m\023"
+	.string	"\306!{J\300\324M:\302W\331\r\230i\272\303u\207\261H\340)/\002\241\226V|\261\336\227I\222\023+p_j\311\303\337F\027I\276<\212\001\006{7\234\212\262\341p]b\333\350\032\306\242\325\216\207]\234"
+	.string	"\341\326'\204\354-\245L\001g"
+	.string	"["
+	.string	"j"
+	.string	"K\377_\001\003\235\217[\222\360\331\233\020-\211\252\326\022\354\021;\256\327\321\331<~\001\220\262\365\276\017\333\315\025\251\245\",\2226\007\370\b\3258\220\032\230\332v\316\002>\234R\224\220=\363"
+	.ascii	"\210\020J,r\306=\301\016JC%$\317\f \004\305\322\026-o i\314^"
+	.ascii	"K\255\365\\#\177\366\337\376\307\371\357\340\347\251_\255\265"
+	.ascii	"\301\367hK\361[b\3513\330\360\326\226~m\272\245\333&lO@EF;|\365"
+	.ascii	"\2272\356\333\277\263v\320\277\270\335\023\346{\314\357(\237"
+	.ascii	"N\376\234\374n>3\177Q\\lP\rY\271\252\325\347\312\252>Q\246\241"
+	.ascii	"\377:?\353?\363\342F\225%\022\205\313Qk\311\362\005_]\223\030"
+	.ascii	"\315\246\315AhG\376\227\275\021~L\263MZ\374 \242}\013\273\032"
+	.ascii	"!\215\0076+ \334&\255\214\234\224(%OD\217\025S&\334\315\375\277"
+	.ascii	"`\274\265\033\350i\331\377\230\205\021\276\350\356\037\247\252"
+	.ascii	"\2151\243\002\315\315\351\270]H@d\326E\016\0227\213M\212\253"
+	.ascii	"fMU\335\267'\330m\027\322\216\031\033\371O\263,\236\0131\"\204"
+	.ascii	"\232\020\346\006\026#\371\253\005\233\t/\274\340\210.\231\027"
+	.ascii	"\314\214\013\254\tah\300W\314\006l!\270\210\001\026\003oD1\006"
+	.ascii	"\262\312\272\035\264c\367\226\235\346\361\b\360\037AB\267\354"
+	.ascii	"V*f'\272\035\273\223V\361p\324Z\247\347\004D\361\240LPTS)\354"
+	.ascii	"\365O\241\302\254\351\271OGO\200\"2Ba\332]\377.\026h\026\307"
+	.ascii	"s\2718 \240\"\221\303s\340\365\224\032p;\203\323\313PZ\006\322"
+	.ascii	"\320\273\034\027\3204\226\n\021S\323\272\360H\b\276\350;\306"
+	.ascii	"\n\366\3139\202i\351\207\355\331\214V\260J%\177\346h\313|/P\271"
+	.ascii	"\270\221\003\245`\325\200\337\330S>\007q\005BB\260\016yaa\030"
+	.ascii	"M(\313\202\326\262\001,O\036Dq\225\245\246\210#\2713\324G\353"
+	.ascii	"{\344Y\271\301\033\262sl\203!B\277\232e\320\342\026\375\f"
+	.text
+	.section	.gnu.lto_blackboxFileWrite.34.f30b1792b47f70e3,"e",@progbits
+	.string	"(\265/\375`\264\0025\024"
+	.string	"\226\245\203I\300\222U:\242T\220\375\344\001\025\314\224\351&\n\200\315\213\2438\253\177\301\016\017\214\350$@\227m!\372\252\250\207u\212\374\023\231g\313\243\3515\f X\026Ah0\213\220G\215\006%s\n{\306\360#\033H#{K)Sq"
+	.string	"c"
+	.string	"n"
+	.string	"\335>\223'\020u\336\247$\241NQ\007\204:\037\373s\250OD\353\217\206\355g\324\335)\016\2411%\205S\362\306\2562%\231p9\r\305\234Ny@\027\304a\304\325$I\r\0207N8\f+e\201]\207\340\tG\223%2\204l#\316\266,S\033vjN\270\231\024\321a\343\2439\272\031p\266]\022Jw\177o\270\031\275\250\377a\377\027\374\373#\272\233\236\314\036\375>\3312\357W\331\335}\336\375\332S\025Q\034\325\223\334\207\310\3758\367&\271/\315\275\310\373P\356\247\334K\271g\336\357\356u\304\245\215v\240t\2725\034\001i\241\371S\363_\307\377\353S\0241\3059\360\245n\232\241\236\3566\371\211\250\263D\352\376zBob\332\273\240\001\272w-z\002\2673\313\030\274\370\371L\346\355h\310+"
+	.ascii	";\371g\265Vo!\227\320Xv\311\314\223\265\246\233\355\321O,Y\201"
+	.ascii	"\266 \237\240,\\<\314#MQ\360j\202G\324C\306\204\313Z\224C\244"
+	.ascii	"\242+bT,\243F\350\006i@Af\336\021\250\362*'\210\266>\376\263"
+	.ascii	"\250\316\201bw+\270\3764\305\353JB\347]^Vo/\241N\345\022\271"
+	.ascii	"]-\255\025V\301\250\"\310\263P\255\025\227\204\024\013\257\225"
+	.ascii	"\nK\265\262J\265\270T,)\026\354%\2052\360\027\205\026,\005\363"
+	.ascii	"z\301R\243\257\025E\206g\244\020\236\341\032\261\021\2447\036"
+	.ascii	"#K\016a\346\251\351f@1F\2363G\004V\262\b\233\370o\340`\364Pc"
+	.ascii	"\331K,\262\211\031G\315f\006\303\005,\261\311P\357\201\272\250"
+	.ascii	"\360#\362I\316Hw\363\240\017\357C(`\177\b)\253\0013 \260\002"
+	.ascii	"\021!\274\r`\257'\004T\303,2\354\205\f\244\240\275f7&X\204\367"
+	.ascii	"\016 C\307\\\307\302b\244.\030\246\001\354\302\231Q\005S\311"
+	.ascii	"'\316\n\026I\356\264\200\324\376\2340\265\207\276\275y\354\253"
+	.ascii	"\024l)\020\026\257J*`M\340\006\203*\356Q\210|\251\261<\270\005"
+	.ascii	"\026\013\037\355\365\233\213\317x^\007\326\025iyJ0\227\264\351"
+	.ascii	"\242\333\303\016\354D\001"
+	.text
+	.section	.gnu.lto_blackboxFileIsFull.35.f30b1792b47f70e3,"e",@progbits
+	.string	"(\265/\375 \374\335\006"
+	.string	"\322\214/5@o\222\016\230>\246n6\022\211\0327J7\330\337\207\374\361\371\274%\212\3777{\320\216*\n\005\321\333k\3068\212\316T\220\017\005\n\306\201o\320\2655\262e\n[\230M\207\363\340\200qi \254LG\363$8\231\210ga\024\017s\3605\261\301^\305uao\313:\322\316 \3444~\213\232d\002\231\271pKj\272\270!\255\316\360`\265V\327\003\320\n\335\200)\204\247\337@\350>\276T:\322\217\243+\360XaH\311\024\235^R\245B\021\371?O\360+|\316\272\201\210Z\3226N\\2\267\347J\315\212\331-I\251\226\021\026m\004*\0064d\346\250\2158\272\353\217\360'\374\035\001\t"
+	.ascii	"\263\312\005\354b#\206\024\024\002t\r\377\213\030K\304\276\b"
+	.ascii	"1L\327$\003"
+	.text
+	.section	.gnu.lto_blackboxFileIsWorking.36.f30b1792b47f70e3,"e",@progbits
+	.string	"(\265/\375`\r"
+	.string	"M\007"
+	.string	"r\r26@o\222\016\230\016\217~\353I\003\334;\206\372\277q80~\277o%E\232o7{\320\216*\n\005\321\333k\3068\212\316\216\222\347P\004\006Rr\020][#D\246_\231\316\307\323\300`\201q\034\256\315\207\023!<\233\207xe\0221S0\026\321\311\342\004\206e\021\323e\253\204\246\0075\033#\210q\341\203\007$\215)j\242\td\246\302-)\252\342~\324\372\002\364\272\325\272 \200Z\205\004-\250\321K}'z\220\343[%4\375\273\325@\b\213\006%\223K\275\344\212\245\002\362\207\036\363'\204\326\332up=q\244\023\227\314.\302S\265>\355\226\244\225\310H\312V\022\365\005,d\346o+et\330\337\340G\370=\002\013"
+	.ascii	"`\251'\023\272\365\201\rL\324Cu\265k\342\030\"\313\257-a\346"
+	.ascii	"\"\3300\265\223\f"
+	.text
+	.section	.gnu.lto_blackboxFileGetLogNumber.37.f30b1792b47f70e3,"e",@progbits
+	.string	"(\265/\375`\n"
+	.string	"5\007"
+	.string	"\322\21525Po\322\001\240<\t\013\201:\003:\244\250(\026K\332\032\351\221\212P\330\032j\355@\b L\316KC\32233\313\006@\2007\tn\303r\030\337\356\275\245L)\2564\235\217\207a\241\302\3424T\233\017'>x6\016\261\272\"\242\246\300\026D\347\212\022\226uEj\333\273U\22253\322\013\333\0237\301"
+	.string	"v\027\301/\371F\341\177\374\331\002\224\317\376|\020\374K\r0\215\362do\242T\016\373n\225d;\235*`RIX\331\3158\275l\312C\001\261\035\262)_\344#!cn\363\320`i\003\343\304ewc\346\004\360\317}"
+	.string	"\376i\351\330\023\363Or\307\022\322\222i\242'Faw\235\231\246q\353m\033\330>\260\335\021\t"
+	.ascii	"`\325\023Xh\225\305((\004\350\032N\033b\304\214=\334\025S;\311"
+	.text
+	.section	.gnu.lto_blackboxFileBeginLog.part.0.57.f30b1792b47f70e3,"e",@progbits
+	.string	"(\265/\375`\005\002\255\020"
+	.string	"\346\335kH\320\322(\035\240"
+	.string	"B\345e!D\206hGXW\242\004\254K\2015u'$\361I\331fUtp\323\331\336\032)\013-\b\240\327_\276\266P\256\034)\264\341\324_\330,*\016\377Q\036F\027\203\317\334\327t\333D\312\224\002Q"
+	.string	"U"
+	.string	"Z"
+	.ascii	"\266\037\344\024\025\232gN\325\022\244\250\344x\366\335\017\017"
+	.ascii	"\210\335\335\367h_G\263Qv\216\215z4\315"
+	.string	"V\372n\367(\224v\204\206\354\356\247*N\273\246G\363k\327\353n\300\305\221\217\037C!F<\005\334#Y\331]\237z\356x\333\rl\273\330)\013C5HD\020\275x\231l\327g\274\204\034\364,\371\240\311\256\271\f\320$iw\031\370\273\307\340\340\347\036-\303\311\207\217>\216\351\361\272\347\212\036 8\335\222-\217\244\372X\275{\253)l/\0355\355iZ3\235\231~\200\223\\\tn\227\347H\221=\021\213X\004\267\207\024N\267\005\bl\013\027\362\241S7\255\331\317q\035\035\374\2341\300\300\230\036\243V0\"B\302S\034*\223\244\243_eR\365\324\023r\303\3518\346E\252\323\r\3254*\021\224j\313\234hf#\215\204A\256\251\nvL\224d\356\356\212\245\005B\030H\037\264\346\323\270\335z\006 ;I\2017\251\226\215\253\325\002a)U\206\027\226\226\b\020&\260\304\f\360\n\205\005si\220\361"
+	.ascii	"\322\274V30\232\317\3065S\363\255b\262\017\345\200\301\r\254"
+	.ascii	"\330w\003\202\261\017e;\277bS\035\253\252\217m\002y\240#I8\355"
+	.ascii	"\332\036\332-\357\341\362\340\347\221\007\320w\274\274\005.\267"
+	.ascii	"\033* \200\202\231I\233\007\244\3455\007\276#\220H([\357\214"
+	.ascii	"9\242)\020\322;\224d1\217\262\217\030\316[\2228L\311\310qJj\301"
+	.ascii	"_\341\220\302`|\230I(\331\262\251\277\312\020\202\033\f\213q"
+	.ascii	"\237%\301q0\203Kgz\267}\317Q\330l\324\255-\024\311\2602@\264"
+	.ascii	"@\310\371d\272\325\355?\341\215\001"
+	.text
+	.section	.gnu.lto_blackboxFileEndLog.part.0.58.f30b1792b47f70e3,"e",@progbits
+	.string	"(\265/\375`h\001u\016"
+	.string	"\366Y]E"
+	.string	"\2216\035\030?\350\2101-07l\325\366(*\200\322i\346\377|\362\2353[\257w<z|\206\376\327\354\300$\ri\025\n#\261M\211\245\177W\265n\213c\347\314\3261\373\370Oc\254l\032\264\211\334)\005C"
+	.string	"K"
+	.string	"L"
+	.string	"\f.\255\321\366\370\b\375\005\3249\016\032\324\213\335\260\301\245\035`\227v\310\346\\\032\264m<\334\275)\204\206\031\233\335\235\372\341\3405Z\240\377\253"
+	.ascii	"\226\r\217\005"
+	.string	"n\001\360\354\2561\016\267\274\355i\333c\277F%\fr&\nO\245\025\333\240\016\006\235\001\242\006e\263\033\316\313\307\374\251\253}\373(\320\037q\031sb\300\303\240x\345\341I\204\016\203\222\251\204\313\022\301\205\005\n\002v\231\375\300ui\335\300\345\247\354\361\001\376\005\224\211<[:\005*\0327\251Q\\y@\374\314S\204`\273\243\223\354\356(D\022\234v\367\201\211\237 \361].\355\231\304\223.}\223\353\304B<\311\2279&\003\306\336\324\250\250(\252\311j\335Z\365\340\250\321\277\026\304 \320\262[Z\345\330\016R%\"\037\356\323\020OBI\247}\270/\200\267\016n\244\2430\341\202\007\"\262i# \263\244\323H\346\366\235\314\016\005\366*p\337\374x\33679\367HS\254\252&\333Q[l\bhT\244\033\340\267\353\032U\272\310\320\222\022W\266\265\257\3300\025W\031% p\002)\225:\007`\365\345"
+	.ascii	"\316i\1770\n\205\007}bV\310\b\206\357\226o\2427\333b\344\025"
+	.ascii	"\322\310\327\213e\367\036P8\330h\221\rA\214g\367\201\235\210"
+	.ascii	"\r\233B?\370\272-Q\36628mg\353f\200\313\224\034[\327\336\236"
+	.ascii	"\310\271YFs\372\265a\f"
+	.text
+	.section	.gnu.lto_blackboxFileWrite.part.0.59.f30b1792b47f70e3,"e",@progbits
+	.string	"(\265/\375`\246\002\245\024"
+	.string	"\206\345\203H\260TN:b\202s\357\270\2475\nK\002\025\3679\fA\263\261}\207qw\363Q<(CB\207\3378V\265\262\231\335\024\356g\024\031\266\377\223\350\365\202\003\207c\246\tA\255\345\376\025\323\027\304\006\207\023\221O6\221;\245f"
+	.string	"k"
+	.string	"p"
+	.string	"\342\347\b6\351\376\343\031\025hy2\030|ZJ\373\276\337\330\375\307s\001\273FXY\273\277\006\237v ~\372w\002\341\247x\224\3603\366\371\032\266uA\336\331G\376C\332?q\375<\201\355\256\354Sg|w\225\340\316\227=\241\236\353\255\016.)q\365\204X\\\0168h\302\262\273\026[\334\363\266#\330\036aK\260\363z\253'\370\032\242A\304\344\343\311%R\217\254\340\301U#\207\242\364\234\322\240\211\264\206\322rJ?\206\202"
+	.ascii	"\306\356\212%a\033cj)\275\352o\372\241\256\366\375\251K\371V"
+	.ascii	"UT;\016\262\251v\306\024\277\025\352\240$e\003L\202x\246\373"
+	.ascii	"L:\037\307\243\034\203\322\311\013\313s\241\322\276\323s\354"
+	.ascii	"\376\344-\237\354\026}e\355.\204]\240*\320\220\027\021\223\357"
+	.ascii	"/\241\255\341B^\n\030\tb\262\224\004\f\211\001)\365W\007\262"
+	.ascii	"A\334\345\275gs\370\017\017\347\201\364\351\343W\357\001\342"
+	.ascii	"]DI\273>\357\301\210>,*v\214\214|\317\343\217\366\330\327\372"
+	.ascii	"\016\022~\222g4Z\370\251z\362\342*5\200S\221(%v\355Y4\342\356"
+	.ascii	">\360u\034\253\306O\372"
+	.string	"\264\r\216|\357\323\307\t\037\006\200\253\345N\314\214%R\306\034n\2463\342R\306\035\333\215f\314\251\344\314hc\314\207\227\026\027\n\0232\264\300,\310\325n\232S\273\321Yn\026\0024m\245vS#B\306\204m\306\2066\273\231\221\345\324\314pd\264\033N\266\242\3006\235\332M\226\263\331n\262\230my\026\236\242\260\252\036M\371\302\244V\213|@N\r\325\256`A\2051\334\313[DB=\361\201:U\257~\\>\204F\f: \200\002\031\263\343\006\344\345gnq#\270o(\201{\006\tE\360\t\261\266X\334ZB\216\314lq\252\227\315K9\252\314>\226\002\321\027\315\035\036\363\333Z\3058\022J`\230\303#\270r\256\327\346\275B\341\267\321&6\320\205\005\007\253\224\216oB\207\253\277\204\353\370\333\302\245$\225\307q\254i\357\232\255\304Z\262i\215\225\210M\007\353\372\273VJ\333\251\013Z]v-"
+	.ascii	"\022\017e\n\355\245\327\2761"
+	.text
+	.section	.gnu.lto_.symbol_nodes.f30b1792b47f70e3,"e",@progbits
+	.string	"(\265/\375`Q\003\245\016"
+	.string	"V\227YG\020\2158\035\020\220\024\340\353\276\b\2010\241\021\370}H\3678\024/'\302;\262\177\002\250\n\005"
+	.string	"\227\215\265\252\252\252\252\252\032\002"
+	.string	"\364_\020\361[\304\0261\330\003\377\305?\372\017\374\r\276\035puD\204kQ\222$\003E"
+	.string	"I"
+	.string	"C"
+	.string	"G\265\351\324\236\251K^\223J=\"\265\b\003\251\206Qw\242^\200u\255"
+	.ascii	"\013\251D\024\004+\206RJA\r\202\361\356+\325|2\\\226e\371\351"
+	.ascii	"\320\244 H3\354\366\256\210\220\177\023P\204x\032\204\355.\246"
+	.ascii	"A)\033P,\fX\276\370KX\021\201\205\300\362\353\371\204\304\003"
+	.ascii	"\221\002\313\236\201e\220\376\276n\271\372\343\243O\255Fyt\252"
+	.ascii	"\243]\034\275\332h\016\215\356\310h\017\214f]\264\205E_\260\032"
+	.ascii	"c\325\033\252\3168\245t\267K\265F{\024\n/&\037\215_9\223g\270"
+	.ascii	"\231\354u2|\360\314s\3440s\342]!\271r\340\314\325\337\001M1\202"
+	.ascii	"\340<\307\337\205\244<\331\234\001\324\177&.-\001\226\271P\300"
+	.ascii	"rV\337\001!\302\242Y\236\3417\233\211_R\345E\322q<=\234\301\312"
+	.ascii	"\007\225\311\361\004\177\f/\023*\316\355\313\205Z!\263q&\202"
+	.ascii	"6\214\254%\310\315\026\"\205\216\2046\346J~\b\035Fp`\215\263"
+	.ascii	"\361\255\226\327\t\216\306sL\240\361\024=\032\277$4 \020\003"
+	.ascii	"\241b\250\003\017\001\331\007\027\031\306\347\353\016m\250\206"
+	.ascii	"\331\355\035\032\r\222C\373C\037\333Q\316*\215\016\371rj\027"
+	.ascii	"t@\027t@\007t@\007t@\007t@\007t@\007t@\007\320\371 \273\332R"
+	.ascii	"\002)\f\f;\" \351\361\033\277\361\033\373\263A\200\212\033\223"
+	.ascii	"\001\3111ZkB\240D\002w\320\f\212\320\2348\263\f\017"
+	.text
+	.section	.gnu.lto_.refs.f30b1792b47f70e3,"e",@progbits
+	.string	"(\265/\375 \351\025\004"
+	.string	"\"\211\025\031\300%\303\001\377\377\377\377\377\377;\307\202\326H#d\357\275\367\336{'\231\002\272%\206\255\r\352X\274\265\242Y\326\261)\031x\026/\200\350\360\036%\221\226'y\0071F\242\3732\\\257\"\232\236g5\317\361\374\2717\220\204\347\340)X\213\225X\325\272\335Q\013\001\020"
+	.ascii	")\202A\005\203\220\237\271\327s\bI\271\224\254\361\034k\274A"
+	.ascii	"\216\244!\0041:\td{\006\271z)\n\215\226\"(3"
+	.text
+	.section	.gnu.lto_.decls.f30b1792b47f70e3,"e",@progbits
+	.string	"(\265/\375`\3610\315\322"
+	.string	"jMYIX0\f!\235t|\315\006\022F\210\3545m\200H\235\b\234\325p\324x{\370<\313\262h\274\221\214p\177\225I<E^]\247\214\305t+,"
+	.string	"y\357\241\261/U\360.UL\f14S\233T\201w\240\237(/^\201\215\241i?\310\017\350P\301k5\3106\262\267\334)\372\003\201\004\232\004\032\310\326\225\350\016\334\265\036W\255\307K\353q\320z\354\\\177\221\254\277x\353\357\216\365\227m\375\035[\037\275W+\225m;AF\222\236\323z7\253a\b\265\332\340p\341\007T\267H!\2739\022j\374[\264\376\372\254\2779\353\247M\3267\340\312\342->\242\364p\372\326\267\335z?\271\265\333\306\212\241\213\302Zx\336\0246vq\321`\311\006i\350\020[9\330\r\303\026\262p[;\250\032\367u\220J\006+gEEf0\326\267\325j\263\3250l\236Fa\345N\327=\037\262\335\370zB\327\025d\272\341{\305\372\367N\353\264"
+	.ascii	"\376\300\213\266N\347\020\201\370\341\350\237\365\215\243\341"
+	.ascii	"\246m.\217O\221\220\266i'K\333\222TN\311z\273\267\376\266\260"
+	.ascii	"I\n\333R\020\236\306\267M,\223G3\207\026\253)\217\256\306\267"
+	.ascii	"w\353\255t\265Mi\353-\215\325f\201\255\266\311n\030\002 \212"
+	.ascii	"\304\214\b&\367\224v\004\357\214\307_]\343>\025\207\020\300\334"
+	.ascii	"\370\"\374"
+	.string	"\260u]|~\"\374.A.\265\323\264\t\300\320\323\263D\354\020\273g\375,\237-b\345l\337o\205\330\274s\210\272L-\236\0067;\025\b\333\363\013\373\355\\\237\345a\353\354\364(\232\207D\364\221\375 B\330>\033\265f,\316h\006\002\261\204\207.0\347\350m\215>\253f\335\354\364\bs\005\372\345\234/\202\355\263pv\207\006'r\206\262\310\300N\007O\214\300\234\363\007\037p\370@\305\005\240 .`\300W\204\325Y-\220\276\363\321s\323\330\276`\355\254\334\006\366n\245\211W\223\301\306_\301z\273\301\320\026\332\r\206O\301z\346j{X:+\367\036\326\307\243-,p:j=\032_f\375\n\354{\f\177\\1X\rC\033g]\260r\227Z\035\267o\266\306O\236\321|f\251t8\251\032_\004\353\255\364&lr\016\361\020\326\026r\316\231h/\035>\203\025[7\233f\333F\220\3633\347,"
+	.string	"\026\246\262\262\243\306\026\207\315q\333f\331\256\263,\333\266\021\232\332Z\bs\266i\261\266\003k;\300_OXkC\374"
+	.ascii	"\254v\315\345\366\206\206a\320Q4\267\260\by\325Xk\234ae\265A"
+	.ascii	"v\303\320\002\rC\016\354\206\2415k[f\317n\315,\215\203\bq\225"
+	.ascii	"g\016\3139j\315p\3166\326v\300bm\007\252\364\205\215\331\020"
+	.ascii	"\237\270\276\327\020\254\206a\bv\303\020\314\206\275\307\335"
+	.ascii	"\351i\312i9G3`\030\322\247S\343G\355\206\341j5\f\365\006\360"
+	.ascii	"_\007t\t\321\277\311T\034\303\177?\210\201\240\347\033\374w\003"
+	.ascii	"\251\025\240,0\374/\005\376\016\223a\227~\033\343\267:\315E\004"
+	.ascii	"\310\005\360_\006\374\266\250\267\376\006\301\3370\364\376\036"
+	.ascii	"\241\245\002\203\377&\340\267>\235\3657\210\277\261\256 \360"
+	.ascii	"\342o\253\277\245:\n\352"
+	.string	"\177\336\377\233\337\266\370\273\003O\377\211x\360\301\177/\270\022\370;\003\364o\f\234\376\357\375\335AS\221f\372\033\351\027\3747\303o\305\372\350\267hm\364[\271.\372-\2206\3627Q\247\030\354\241\277\205\376\266\371\033\350\357\347\337\303\277\177\332\347?\b>\360\333\267\277\273\376\306\351\360\337\223\377}\357\277\357\376V\376\375\362w\b\376\366\300\337+\374\035\201\277\031\360\267\b\177\023\340\357\f\376\266\340o\342o\t\177{\344\267x\277\325\361[\033\277\035\373\255\324o\241~\373\364[\026\277U\361\333\236\337:\375\226\351\267F\277\r\372\355\317ow~\373\374-\b\376\353\370\017\344?\337oW\360[\025\374\366\004\277e\341\267\306\377C~[\202\377m\277U\376v\203\377>~K\202\337\222\370\355\313oG\374\337\300\377\262\337\206\340\377\221\377F\376k\340\277\337\377\260\377%\374\357\361\237\245\260\260\260\360W7\360\017\021\360\037"
+	.string	"&0\330\254\214\322\204\356\325/\326\177\322>\004\313p\032\177\335Y\177\255\356\213\354\224\233\026\256\327\305\255b\251\343\232\001C\311z\020\326\262\"!\241>\251K\335\247\0059\347\234ED\223R\362C\001k\301\307$\205\202\002R9\302\325\007H\366\364t{N\362\025\302\303C\327\245\256\335@\337\254V'\247\333\263\346\247<\245\016\304\037\"\234\263$\244\273\204t\231\230V\254\270,j\374X\203\330\254\226(\375\262X!z\366Xk|\223n^)\024,<\273\024\253x\003\363\321\370\304\023\353\207~C\267h\350\032\031\245HqU@]a\272\265\"ED\277*\232-\216i\206\231\n\317P\334\222\217\365C\263\365\277Ar7\250\351\356N\223\215\223\b\351\021\222\257\300\234w$"
+	.string	"e\016)E\223(\236\353\303s\177\2069\333h\023P\320\317\373T;\256\253\265\306(P\334\236\325i\237\372\216:\\=2\246\257\306='Z[O=\215?\024Z\257&\311\311\271;k\316\231xc\305C\027xu~w\314p\027\0220\"\215\237\304\326\375?\271uOw7/\254\277\316k\363{\363{s\237\366\310\0047B\277|\024\324\341\177\222\337\347\016\225\254\301\020gl\312+z;\3146A9\347!5\232\203nTnUk;\374+\366Z\002\374\307\371\232 \232\235r\204\177\353V\233M\022\007\371\3524\347'\324\371"
+	.ascii	"\250\320\023j\264s\006\315\316\347\2253CP\206:w\316r\316\220"
+	.ascii	"\237O\347\004\232r\206\235\263,\224q\354\204l\216B\235\371\331"
+	.ascii	"\2243\344g\266\341`\347\t\025\3329\263\021\312"
+	.string	"\260s\006\025\312g\320\214!?m\202N<sP\206|\0065\222\317\232\2040\354\2345\t\355\234AWX\262\035\275,!)\341S\225\325\332y\346\037\037%\233 \f\323\235hS\316\313\331\246\345\344 \002\344\254\324\024\224gcd\335n\246?7l6M6\232s\276\300\347\346\251)?\247;\\M9s\335\224\310>#8\243\323Le\247\316\026J\271''g\fr4g\237\234\2356Os\316\316\23431H)\232\363\n\f;Y>>9\037q\360\311J\316\267\234\234;\215\210\233\320\316\331S\223\313\033\332YV\326\211:mV\316\203\006\255gN\032\271\007\311\232%\224\342\310\315\205b\177m\3210 \240\252\246\306=\330\204V\256C3Q\021c\n\372\032Zo;\f[:\f\337\202\277]\353%S\0312\2024\266;s.\357@\224\034~`@\215\337J\376N\322\200)'\354\002\211\032\333\251\3350\324"
+	.ascii	"\211\313\373\217\350\302I\254\252q\006^\266\215X\2716b\373Nv"
+	.ascii	"\362\001\004\203\202\022p\025g}\373\375\335\327E\372\205\217"
+	.ascii	"\213\265\306\326\315n\030b\260\347\362\346;i\003\373\321\242"
+	.ascii	"\361\005\255wv\222c\312\205_\343\036\342\362&bBU\213\257\306"
+	.ascii	"\267\363\376\016\322BTr\370\250\021\325\270\203\3350T\337\\\336"
+	.ascii	"x\270\005 \020\f M\265\222\204\006\335\353\273\266\313\312\233"
+	.ascii	"J5~\333\375=\355\027T\265\023=t\032w\207:\227\367\217\2133\325"
+	.ascii	"3\324\330\003\253\301\007\335\215\323fE\323u\217\025\243)\341"
+	.ascii	"V\343\346\301\001E\310\316O\256\361\325\274^\204\3347?Oa\177"
+	.ascii	"V"
+	.ascii	"\311\245,O\f\371\371\224\346\022\343R\226\223\234\241zYMG~S<"
+	.ascii	"I\255\324Kw+\310\260\006\2378\275s\007\346\207\246\265\244\223"
+	.ascii	"\272\255\231N\270C\362\353\035m\3267:\255\347\032\256k\264\215"
+	.ascii	"&k\264\306\321.\264[\313\365Z\227\265\264\243\315\326b\255\326"
+	.ascii	"q\235\243\337\232F\217\365Y\353\260r\335f\231\274e\364\214,A"
+	.ascii	"\277\2376\352\266^\341\301\215\272\255<f,\252\254\232j\307\n"
+	.ascii	"\236o\314\251\241?dW\204\203\226\320\026\336\210\001\365\220"
+	.ascii	"\235\036a\310O3\252,\243#\0166\356\226\236'\332G\347\311\313"
+	.ascii	"\217\253\251`\364\005\332%\266\316\214\314\317\351\251\243P\230"
+	.ascii	"\365\300\b\224r\321T\"r\202Nr\236N\370u\212nk\242.\272\321,\""
+	.ascii	"\332\r\323\334VS\26183\344\334\242HV\316\321\256\352\266~\321"
+	.ascii	"T"
+	.string	"0\230\370\375u[w5\230\235\036\345,\304\201\327T\220\254\0178|\240\002\261\022\2143\001\277\301~\233\304\002\362\200\322\361\323\270\275\\\336_)7z0\301j\034\275D\224\242\032;\262@U3R\250\340\343&?6\202\217\264\004\001)b\325\030\023\272\0343Q\341\341\321\372kl\013S\304\326\f\321#\253a\210\225\250QVP(b\254O\301Z\237B\265>\245i}\n\322\212!\333\r\303\306;\026\202\207\213\334;\225\354\274\341\345\302-\220\005E\021(\221\343\"\307}\311(4\264\306\230\017\357a=<\344|\355\003\027#\357EV\330hL)\005\371]\203[\202\202\262\255\005I\312\032\252;\236\326\341;\021\324\256\210P\212\374=\241\354\216\357\376\033;~\3744\306/\234O%\354\206\351\b\377@\301\343\347\201\351\254\327\020,A\0250\b\017\274\036\307t\177K\022\224\3203\005\347\3558\356\r\357\260os2"
+	.ascii	"m\212\301#R\351\361\216c\035*\203(\220l\310\271p\341\210^\202"
+	.string	"/\322\232\340\027?d\330h\214\341\244g\3075\316p\033\376!\233B\3625\fD\"\003-\355\270\3558\307\332\033\235\213\306\030\007vq\303\366\244\342p\330\360\025\234\023\013\332\030\337\300V\320\033wD\215\361\232\2079\253\035tj\027p\361\003\333h\252--\235\233\306\030\315\326M\247GB\032\207a\t\251c\023\373\305p\231\b\346\266\350P\272\002S\324\221\035\227\035\323`\"\344C$\212\307.\\KV\023?\036\255\030\3073b`\260\031TX\202]\330\005\263)\275\256c\260\343\257\225\257\037\317\"^2P\\\264\370q\013\274u\tU\262\263,\003\331\031yH\276\272Xv\020\345\244Q\035o\035\303x\212\212\0216\306XXK\265R\"\304i\214\263^\340\2534\240\034(\236V\\\205\255R\212\316\2004QZ\261\213;\2656=T\036\230L\261\245h\214\241\360\324\324)\020'\345\r\253MO\nG\251o-P"
+	.ascii	"i"
+	.string	"\036:\242,\230\304\021\235\254\260\206\032\037\205\210\3051\023\013\f\375}\346%%\024#$,\301@$\273\037B\247c\250\024Gu\310\300\032\343\246%$D\307ED8\t\003sWD]}\203\t\007\325\212\343$\276)\261\250&\2151\322\371N\246\204GX\215\361\221\255K\301\321s\002Ecld\353bh\021\rIS\240>?,\032c\025{\370\3041\n|\002\017\331\262\fDlC\272\"\322\251\303\032\"t<\304w\007\261\274~4\306A\347\303u\320\241#\2151\220\2553\213\333\332k\214\177.=\037WU\\c\354s\351\227\232\352\336\032\343\236K\357\207d\213\253\227,\214h\334\215\306\230G\254\352\370\246\n\353\330\235\021\342\346R\360\n\263T\340\347\261\316q\016\210\020\327\013\032g\205qp\3066Jk-\362\032c\347%\313@\225W]\341/\226\331\r\033\243&2\2742\023\031\177\277J\376.\341=\322"
+	.ascii	"\351\022\027n\2018Vx5\005\376\022\376\016\202\ba\353~\244P\300"
+	.ascii	"\306W\3607\354\310\007\234\337\022\300$XB~\211\b\271Gn\222\007"
+	.ascii	"\344\236\354\304\020\275\301#\313Z)\323\213q\306\367{\344\327"
+	.ascii	"\310\312b\212\007\254\361\365+\322w\367.\234\232\r\030H\215\257"
+	.ascii	"\336\205\273M\237\221;$Oj\356\327\307\334\305\273|kvFu\250\271"
+	.ascii	"p#\326\345X\352\372\361\213\367\013\204\2506\204g\257\361\275"
+	.ascii	"\373\r\243B\202\266cw\303\264\366\330\2324\276/\200p\026\202"
+	.ascii	"N\204\323O\331\275\210\321\270o\335\205K\241\252\021w\004\327"
+	.ascii	"2c\020E\220\306\227.eL\232s\327\370\366\260Q?S;\036F\254\212"
+	.ascii	"\\4\376\t\212\365'O\265_\034jW\207\001| I}\005\346\235\243\016"
+	.ascii	"-sSXD\\\370\325\361+\007\"\304\351N\232\004\373\244R\267\033"
+	.ascii	"7l\273)R\201\222\267BG\t\334[\013\030Q\224\325\333`\f\025\215"
+	.ascii	"o\216\333\246\225\303#0(\017l\020\350\336\370e\373ON\206t\260"
+	.ascii	"\362\326\200\236p\334\246\353\327\271\350\037\2756849\217\230"
+	.ascii	"0\247vi\254X\002\204\306\257\215_3\020!.\032\013\316\025\331"
+	.ascii	"\037Z\r\fGi\204\215k\334\263!\f%FFp\353o\331\272\266\236\352"
+	.ascii	"\227\213\352\216\2559\03759\215\204\3606\344I.0\347\243\016}"
+	.ascii	"\307\367\303\363\365;\366+\006\"\304\245(7\274\204\214\201\335"
+	.ascii	"\260\377\004e\013\352lFU\222\353\345\027(}\362\272]yI\352\251"
+	.ascii	"\361\f\025!\034,$R\353\225qc\250P\\c?I\353\315\272[D%B\256\035"
+	.ascii	"\215\257\326\r\315$\362\276\204\007f\211\246q\346CR93\243|\301"
+	.ascii	" \2114.\233\314\244\362\245X\223$\201\202"
+	.string	"T6\215X\001E\230a\263X$*\223\310\"\214\252&\2172/\307e\021f-\302\fO@\3632s\234\031\322\030g\22253C\325\330d.\2210&f\324$s}\t\0172\315\344K\f6Q3l\032g\226\312\230aL3\211\\\322\304\3004\231\310dM\323\370\222\254Y6cNh\2143\307\345L\32283\363\201y\002&\002h\21433xf\230<\312\320\314\274$\227M&\211$ry\\\326\320`\232\231\227\227\3600\002)\003\323d\306\030\2172\330\004\312e\211\2462I\224Q6\227M\346p\270D\302\020_\302C3y\\\"a\002 #S\223L*\223\304\f\2440\201;c<.\233\314%\022\246XL\201\21199&\2212I\2442\271\276(ed\214G\230\017\326%\022&y\244Q\022\227H\230#S)\363\262\036)\220D\232X*;\300La\203\214L\r\n\314\024\222G\232\0250d\350"
+	.string	"\007\013`\222'\\\360\022\036\224H\230&s\303ry\204i2\207"
+	.string	"\b\301Csi\244\361@B\251B\022I\342\030\201\f\216,,\217\314c\0064\250"
+	.string	"\223D\242\300\301_\220\313c\362Hb\375\b$\200@\202\210\026\210\027QB\b%\2040\274\210\022\\\\J \301e=\t.\267Y,\256*\370%<4_j\226M\346\007\346\221\346\004\315\017\314&r\304\207\232$\t\020Z\250I\"e@\030\201\204\"\t\"Z\370p\204\251\221yI\"?,\2315\037\026"
+	.ascii	"\002\346\310\254I\326\024\327\341\262I\243\002c<.Y\226M\232\225"
+	.ascii	"&ri\202\230\032\225\230\232\021)+G\246qD\221\246\306\304\213"
+	.ascii	"qD\013L\362X<\262`d\2520\227G\023K\343LqM\"\215%^\212Ce\222\b"
+	.ascii	"\202I\302(\023S$6\213D\030\031e1%9S#\243|).k^\212)\315#\363("
+	.ascii	"3\302\330d\241"
+	.string	"\310\022S3\242\271T\226`\026O\232E\024\023/J\231\242\332,\216@B\361\244yd\306\304(\213\304\224&\013/G\030\345Kq]16\2150\305#\f\322\004E\224\023TH\001\205\342\n)\024\327&\023)\263\022S3\242\310<.\217\307eLQ%\004\214\221\246X\034\036a\2243E\365\006\270\222\346\270\374\320T*\227\037R`b\272Y\024\321L\"k\2104\306\231{D\001R\0034\306\031b\263xD\001\2229,\321$\221<\312\f\233E\020\"4\223H\342]\\$\300\001\007.@\201\365\305C\261\005\345\b\023/F\231\021\037\222H\343\314\207\227%\363\203\207\002,\217#fj.p\224A\242@B\251B\223y$\2614\312"
+	.ascii	"`i,\361\202\2173\306\344Q\006\031\263\312(\225\021(\2522251\230"
+	.ascii	"\006\00631dINc\225,zV'$H^\324\372\253c\355\247\327\203\227C\r"
+	.ascii	"\273*\326r\244\310)\251\261\372\245\202\335\031YkC\316\367\276"
+	.ascii	"\226\255=\270\261\306j\227\3525\225\245\026\327\370~-\201\\\201"
+	.ascii	"Df\340\"\304\037\260\301(\031L1\356\016\036ZB\373\3432\332\302"
+	.ascii	"t*ae\200K0"
+	.string	"\360\235j\224\226\002G\353\007\253!M=e\265\222\025\302\277\300%Xx\213\205\213m\260\353\n\227\255\314\271\351\001Z]}q\234\243\351p|\250h\254\272P\253\336\203m\354\331\270\247aWT\266\256\345E\r\256\252\251\026\\\261k\001\207'e\335p\215\032ZAQ\270-\245).\312\b\352\331\023'6\243\005\336\301\322B\007\320\354\t\017\331!\203c?P\234\204\202\024\344\357\313\tCkD\355\ti\254&\251I*\223\r\nr\036Q\200\2167;\031\201\371\210\250\303\257.]e\222\346\354\375\3315VY\\:\250F\006\244\261\252t\351{\324=1\2518\037m9\331A\273\231B\032\263Z>^4\216l\020\271\262j\f1\272:\210aCa\203Ex-gWTH*Z\257e\205\023\024\017\321=r\322D84CMA\230\207n@dh\352\220*T\345\243\312\247\357\233\017\226\217_GU\364\300\246l"
+	.string	"u\236\0204:5\365\007\353@\005\235\242T\235\253=\252\016\006[\t\nJ\202"
+	.string	"0*\251\257@\253(\252\251\306*\317U\024Q,l\370"
+	.string	"W\365\304/\217$Fd@\033\253;F\326_\315QqT\2028s\212\306\321'\227V\022\034@\034\370\345\245:\361 n\242\326F\252\023#\331\300N\217L\220K\273Qm\324\214\013\325\247\225S\235\367\354x\t\026T\235\370\317\003;\235z\200\037\231\213\352\304I\002\204"
+	.string	"\250R\3310H\003\031R\250JD$)H\222\306\222\n\020\204\"a\036\251\251\363\022\340d=\2129\210\320\214\310\214(J\n\222\032\205\346x!d^\215jv\177\223\220\355\036\033\324\235\375\037\241bg\226j\322\352\263\201\342<u\345\243\ft\205\3404\022 \251\023\r\3640\371Vh\330g\307[\223\340\350s\337\300\r\026\243I7\026N\037\307\212\246\007 \204\022\254\357\374W  \024\307@\240.)\213I\021s\257e\217/\355\b\313\202B[k\345G|\240\241k\227\205\3061\211'\2578Z\223\"\264\006\033\027\204!\374A\333\345\032\253\020\031\317\331\253\244\204x\221!\177\325\312\234\352\360\224\343:Nt!!\n\256\374\235\35571\234\362"
+	.string	"f\303Y\256\202\337\007N\261\326\034?NKK\243\271\006r\017\244\342\262\362\205R\302\br\332\221\274\003(\340(\244BC\033\033\0027A)j\351\303\261e\24243\333\244U\264\245%\342./\316\307\366\007\305\267\227nu\r++\325\341\342O\317\342\370\005\310\326\257\321\235\272,\005OW(2q\335"
+	.string	"\257\226Ta\336\265\2271\201\017r\251h%\212!'\212!g\330I\301vO\314\260W\335\177O\235\374\371y\303d\276\273\023\f\211\306l\215\r\032\325\243x3\240\360\303\254Fb\245\257\320\263\200\306\213\221\3043C\n\036a\003\363\306\341c\017\303A\275\030\021\341\0138IR\322nM\310\024\250 \322\271\364\204\013\350\347\017\312Qu\350\207'\345\361\025\274yt\255\343z\326^\034]\272^\222\365M"
+	.string	"/\335\2307\267"
+	.string	"b\207\361u7\1777\251);Lmp\370\263xN\311\007(\017\251\234\374M\004R\336\315p[\203\2768\3724\276\333\211\352\234\264_\247dv\301;\333i^\006\201!\221\367\343tM\033\275n\302D\307Jnz Ah\301\330\224~-)T\355Q}\323\350\212\277c\237[1\017\006z\0379RK\230\346\350I\324\234A\207\005\0049\235\372N\026~\251{V-Q\r@\321C\236\t\013\3633s1\274T\324]\345\211_\240\002"
+	.string	"\253~cX\361\200\275Y\0358\276%\235\213\001"
+	.string	"]\255a\333:X\031\264\036\221\272\007d\324\220\234Y\257\24315\275CS\307\221\276\237\3054U4\364\036 \303\326R\276\221\315\203\\\016T\371\311\177v\226\234\330\252\245\247\270q(C!\214P\327 p_\357R\030W@\333\217Fa\247\3073\234(/\363\232WE,`\357\023\036\r\304\024\004\366L\300jg\2558:?\334AMzGO\316\202\340&\301`Ip\032\367\275E\001\177\243Q\231\360-\337g\265\200\341\023p\362m8t\035uK\nnX\244K0\322F8x\r\2752\340\023\027\355\026\177\306\302\346\217C,\030"
+	.string	"!<\302=\306|\r\325i\224\022\205\321j\262A\035\351\21012>\347x\324\203\360\356\322\001g2\f\250l\033j&B\221c\262\221\327\217\257\210\033\203"
+	.string	">\224\031\372\215\323\342R\"\241J\220\203b}\336\303\b\035O\332\0331]\225'\365\315\235\320h)$y\276u\340\0212\220]#\266\212D\203\362\031\237\316\331F\n\"\257w\310|\214\027 \201+[[\342\004e\353\231VX\260\217A!\211\021\027(\213\343V\023\266[l\271\232[\261\300+\252\274"
+	.string	"\\Wi,\310D\251\306\343c\022w\371\261\020\320\312\3515\231\201(b9\277n\004\035\213\203\371_\355\r\027|W\330'\325q\365vC\362Y\241fi\2208K\353J\252\200r\235\001\353_\\\262T\325\320\n>\245#\335\365D{9\177\374\330\222\331"
+	.ascii	"\2644\0167\304xf|\315\337w\333\305K\024H\004\301\031x\210\315"
+	.ascii	"\311_\f\227w\003D\002\3315\260\037\343\203,\f\270o\325\262\341"
+	.ascii	"n\"w\315\\\006\030e\250q\307\215W\n\2062\347Z\367S \"R\005\252"
+	.ascii	"d'\223\234\245\r\304\363\237l\023\274\244\310\324)\311\032\205"
+	.ascii	"\226\317\255\215\241\013\255\223\373\321\221\224D\023\204x\313"
+	.ascii	"\206\227\230O\225\235t\224\310\023&\220B>{\335\217\177\321N\031"
+	.ascii	"c\242z r\226\257\304\323b\\\305s\352/R1\265cq\253\210W\256\344"
+	.ascii	"\315\223c\002\277j\216g\362.89K/\225n\244\212Q\317\200:\207\200"
+	.ascii	"\304\214X$Z'0\016\354\242\031\2740\300\0220*1vs\233]\"\254a\310"
+	.ascii	"Z$*\210E\003\312\214\370\375f$\205\206\323\266\212#\324\3502"
+	.ascii	"\033DJ\334n\037\377Uw\226\370Df\004\0340+2\020\003\036M!\264"
+	.ascii	"\023e\317\312\241\242\331\331ss\222\210X\246\244\337='h\227\274"
+	.ascii	"k\035\301\t\300[O\263\200\265\320\267\256\001L\ty\313a\254\222"
+	.ascii	"\020\340\0176\361\363\345y(|\346\355\327h\222\314\022\320\237"
+	.ascii	"\211tD\221\fH.\307nW\376'\026\375V\236\016\231\2221\310\376I"
+	.ascii	" f\017\341\002\221!\226\367$Oa\247D\001P>`\221$\001\337\322\277"
+	.ascii	"\002\301-\020C\016\254\313'\204~6\354\377\237\302'\r\301\035"
+	.ascii	"uU\2360\247\f8\253\2001\210\220b`02f6\300\024+\335 %D>\025\336"
+	.ascii	"\304\025?\371:\205w>,\2364\271e\221\0074\225\207\023Z\272\247"
+	.ascii	"9M\274\252\3510>\362D\220\214\267K\340\305\2626E\027\373\310"
+	.ascii	"C\237\304\tE\351\016]*\240\373H\244to\351\244k\200\227\342<$"
+	.ascii	"&\262\210y\033\265\013\357.Z\225\353 |>\005`\246\212;E\003:L"
+	.ascii	"c\313\354\001 {\006Z\323`g\3312\246\004_iE\\\026c\347K\032\215"
+	.ascii	"\354o\214e\317\317\353\361\022V\215\331\237\355\344\001\016\363"
+	.ascii	"+!W\027\217\223A>X\n\357\216\265\230F\320\377\312!1\024\030("
+	.ascii	"\016t\r}$+A\2625c\016b\265t]\340C\355:\232\317\\y\302\f\307)"
+	.ascii	"@\020\\kxz/\f\312\311\214\370\305\002\301B\346\346q0\r\342\374"
+	.ascii	"c\325'\244\367M1\241$d\f{\330\n\023U\326d\261\267\037x\216\305"
+	.ascii	"m!\351\307@\372\177\353\016\253:X\210\370\013\n\243d\024\336"
+	.ascii	"\330\301\031\351ze`c\277\037k\3629\022K\025\323\337\306 k\345"
+	.ascii	")4\343\2222]!I<)<A\036\316\317]\032_\034\f-\026\334\203\300\370"
+	.ascii	"\367\230\345\3666\375\270h\367\377x\253\203\301@\267zJ\r\332"
+	.ascii	"\021$^f.\001\3709[\272\343\214\310\027\271VC1\020\3576\250\300"
+	.ascii	"9e\313!3hpY\326\310\0321\263$@\024lt2\230\201d\246\007?r\271"
+	.ascii	"\321&\245\367N\027@\261\211rx\317\013\270r\005\303\335\306\210"
+	.ascii	"\330\373I~\254\303\321A\362\253\331\332\375\316<\253\366|\261"
+	.ascii	"\217\306g(z\246\236\377\363z\300;\267\240\335\013\246\307\312"
+	.ascii	"\245;\026\263<\237\341\240\305\271\360\323y\361\203\337T\377"
+	.ascii	"\367`\336\243^p\203Y\211\027\374\334\363 \245G\366\314\270\246"
+	.ascii	"\273\366]e\177y\217X\213\003n\220\330\333\360\343\270\303\306"
+	.ascii	"\244\377qd\343\267\270b\177K\345)\354s\310\017#G\306\373\215"
+	.ascii	"3\347Gu\204d\236&o]\336\256\371\003M\334\211\366\"\374\3450\345"
+	.ascii	"\235@\3217\346e\313\t\346K\372\215\314\254kJd\215i\353mg\260"
+	.ascii	"-o\346\271\017\177\214C \217\f\377\252\3262\305\314\320\202\221"
+	.ascii	"W\342\334\303LI\363\013\364\271\177\202?Z=\307qy\374\232\346"
+	.ascii	"\2045m\363\250\267\335\034\036\t\260\036\331\003\231\214\227"
+	.ascii	"!b+\372U0\b\371\243\377I\212\366w\272\346\377\212\340:\3608<"
+	.ascii	"\326\337\220\375\002p\322\351\334\370\035\220b\016\352\001\313"
+	.ascii	"\305\372F\365\037\363\262\302\205Qh\005"
+	.text
+	.section	.gnu.lto_.symtab.f30b1792b47f70e3,"e",@progbits
+	.string	"blackboxFileOpen"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\001"
+	.string	""
+	.string	"blackboxFileBeginLog"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\001"
+	.string	""
+	.string	"blackboxFileEndLog"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\001"
+	.string	""
+	.string	"blackboxFileWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\001"
+	.string	""
+	.string	"blackboxFileIsFull"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\001"
+	.string	""
+	.string	"blackboxFileIsWorking"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\001"
+	.string	""
+	.string	"blackboxFileGetLogNumber"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\001"
+	.string	""
+	.string	"stderr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\001"
+	.string	""
+	.string	"closedir"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\001"
+	.string	""
+	.string	"readdir"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\001"
+	.string	""
+	.string	"strtol"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\001"
+	.string	""
+	.string	"opendir"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\002"
+	.string	""
+	.string	"mmap"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\002"
+	.string	""
+	.string	"mremap"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\002"
+	.string	""
+	.string	"ftruncate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\002"
+	.string	""
+	.string	"unlink"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\002"
+	.string	""
+	.string	"open"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\002"
+	.string	""
+	.string	"mkdir"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\002"
+	.string	""
+	.string	"close"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\002"
+	.string	""
+	.string	"munmap"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.f30b1792b47f70e3,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
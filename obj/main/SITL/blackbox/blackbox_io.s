@@ -0,0 +1,1362 @@
+	.file	"blackbox_io.c"
+	.section	.gnu.lto_.profile.f8badbf412898d0b,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.f8badbf412898d0b,"e",@progbits
+	.string	"(\265/\375`\346"
+	.string	"\025\n"
+	.string	"$\016\332\001"
+	.string	" "
+	.string	"\307\371\343\335\013\022\002"
+	.string	"\001\002\001\002\002\002\003\002\004\001\240\342\234\212\n\002\005\006\353\317\323\317\017\030\005\002\006\002\006\006\002\006\b\352\263\360\321\b\t\n\375\206\225\206\002\002\013\376\201\211\336\n\007\002\007\f\r\374\347\274\372\r\004\002"
+	.string	"\002\b\016\311\231\247\372\017"
+	.string	"\017\360\370\252\362\f\004\002\t\002\t\002\n\002\n\020\021\022\235\271\333\226\r\004\023\024\325\206\275?\016\001\013\025\220\203\234\217\005\f\002\f\026\274\205\242\255\006"
+	.string	"\027\353\271\265\366\001\002\002\001\002\005\030\254\237\211\374\t\024\002\007\002\007\002\001\002\r\002"
+	.string	"\002\016\002\017\002\r\001\002\001\032\034\214\371\233\377\006\035\213\305\335\347\r\002\036\357\337\264\233\005\037\320\220\224\265\006 \230\217\331\374\005\004!\"\253\354\206\256\003\n#$\204\241\356\353\003\004\001\002\005"
+	.string	"- \240\202\251\252\036\270\230\332\367\220\345p+\240`\223=J\013\232i+&\205a\006\256\354m\332.\274[Hb\0017\311\302\fN7\346\327\345\023\356T\370;1\013z\263\250\335]\031\214}\364R\017\030\034E\027\206\371p\013\022\200<\300\304h"
+	.ascii	"3\334\215\232\375\035n\001v\247\035\322\312\020"
+	.text
+	.section	.gnu.lto_.ipa_sra.f8badbf412898d0b,"e",@progbits
+	.string	"(\265/\375 \326\035\004"
+	.string	"rD\017\032\240E\215\001\377\377\377\271\252\252\252\372?O\266h\265\226\275\031-Ug\245L)\032"
+	.string	"T\324d\267\024A\3728\333\374v\257\231e\023E\356X\303<\013{\025\004\267\023*\332\240\353r\020\036"
+	.ascii	" \205\250\235\034\214\001\023\024\2735\rS\325x\325\262\231+\262"
+	.ascii	"\332\021j\001\2657\212E\244@\234B3n\255\312\216\313^n\261\234"
+	.ascii	"\"Z\242\274\004\016\352FS\266h\356\005=\300\032+Bp\206\264\001"
+	.ascii	","
+	.text
+	.section	.gnu.lto_.inline.f8badbf412898d0b,"e",@progbits
+	.string	"(\265/\375`=\003\r\020"
+	.string	"t\0241\004"
+	.string	"\025"
+	.string	""
+	.string	"\034\335\236\212\330\003g\001"
+	.string	""
+	.string	"\002.\335\236\212\210\002g"
+	.string	""
+	.string	"\006\200\200\200\200\002d\002"
+	.string	"\002\002\013\006"
+	.string	"'\277\216\223\306\002h\001"
+	.string	"\001\001\001\002\020"
+	.string	""
+	.string	""
+	.string	"\003.\217\270\236\311\003f\004\321\360\372\250\003c"
+	.string	"\001\n\004\r\220N"
+	.string	"\003\f\002\n"
+	.string	"\007\200\200\200\340\003f\002c\013"
+	.string	"\013\272\223\261\300\002\n\200\200\200\300\002e\r"
+	.string	"\t\003e\f\016"
+	.string	"\013\257\334\215\356\004d\017"
+	.string	"\005e\022"
+	.string	"\n\374\237\244\337\002\be\002"
+	.string	"\024"
+	.string	"\026\243\371\205\214\032\247\252\246\245\002f\002"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\025"
+	.string	"\023\203\330\221\264\003i\020\376\266\216\367\003g\002\013\001\026"
+	.string	"\003d"
+	.string	""
+	.string	"\201\200\200\200~\027"
+	.string	"\f\256\325\252\225\016\003\204"
+	.string	"\030"
+	.string	"4\332\326\253\210>\273\213\206\356\003e\t\022"
+	.string	""
+	.string	""
+	.string	"\007\220N\001\001"
+	.string	""
+	.string	"\034"
+	.string	"\007\350\315\304\301\003\006\003\035"
+	.string	"\b\314\325\276\316"
+	.string	"\036"
+	.string	"\t\260\335\270\333\001"
+	.string	"\001\002\021"
+	.string	"\037 "
+	.string	"\016\331\252\325\252\022\254\325\252\325!"
+	.string	"\b\332\352\347\345\003f\""
+	.string	"\024\335\252\325\352\034$"
+	.string	"\022\245\341\365\301\002"
+	.string	"n\002\022\006[\001\200\001\002\003\024\274\224\334\276\203\004\210\327\307\302\003a"
+	.string	"\b"
+	.string	"\220N"
+	.string	""
+	.string	"T\250\021=\306\0042\312&\331c\fp\002\031\261:\017\022`\304Y\001\242\002#@B\207B\262Y\330b}\003~\244\331\234$\223\327-_=B\r\327\234\353M\\he\256q\234\237fZ"
+	.ascii	"\020-B\350\203\t\t^\366e\232vu\363[\272o\306NX\356\223F,Ni\034"
+	.ascii	"\206K\003\221,\265YSL\003\177+\221J\340sd(\007\333\346\270\232"
+	.ascii	"\347\006E\233\374\213*c\246\361\020\261\307x\275xB\315\364SF"
+	.ascii	"\336X\210\037\224\003\235\006\225u=\256V\367\001\224b\f+Gg.3"
+	.ascii	"\336\334\326A\202\214A\343\313\031J\277\226:\240\317X\212\207"
+	.ascii	"NmM,a\264r\001&"
+	.text
+	.section	.gnu.lto_.jmpfuncs.f8badbf412898d0b,"e",@progbits
+	.string	"(\265/\375`\230\001%\b"
+	.string	"\342\214$)pK\222\016\374\377\377\252\001\344RUU\254/\360}\305\252\032\215\253*|\201\001\201r\331c\325\237\352\350*\306lG\232L)\232^\003\341\203\352\2406\250\f>\301\202\252\240&h<w\244<R{oO\324|<\317\363,\361\324b\024\223bT\004\025\242\007\363\347"
+	.string	"gY\"\336\031\217\3616\rA\fL\247%\365\222\332V8[\2206\372\320'5\245Pv\243\206\230fiy\001\001tlB3\275\ti\032\2528\252\254\345\300R\301\306\374\312q\027\001. P\002!\346\256<`b\244\271\031K\226\275O\\Z\301\313\267p$\002\354\312DB'\261\265\200\264K\320\362\325\200\200\233\327\266\373\377\214\365\216TDg8q\266"
+	.string	"\004\315\273&\fW0'\341\006J\006\322\023\300\032\325\251Xm#\375t:\240\312\031"
+	.ascii	"\251),\334\360\301\360\221\243\220K\321aT\016\364A@%]\273\215"
+	.ascii	"i\347\354-\334\020"
+	.text
+	.section	.gnu.lto_.pureconst.f8badbf412898d0b,"e",@progbits
+	.string	"(\265/\375 D\315\001"
+	.string	"BD\r\025\220Mc\353h\352\377\377\333\377\236\002\236h\343G\300\334~\201\fR\221C\376\270\343\2153\276\270bK\034q:l\314\r/\234\360\301J\360\300\001_~\354\356\244"
+	.text
+	.section	.gnu.lto_.ipa_modref.f8badbf412898d0b,"e",@progbits
+	.string	"(\265/\375`\316"
+	.string	"\275\006"
+	.string	"2\211\033$\220E\031\016\377\217P\260S\335u\357Nr\310\314\207\376C\310\336{\267\274*Q\2334]S\3777B\244L\001\273\210\004\022\270\225\2007\371\231\307G*O\021T\327\030\227\212\2720&T.\226\367^\321\207\311)w:\233\362\246=1\342\335"
+	.ascii	"\200\007\266\362\326\032\236P\376\027\276\317\311\312Y\347*_"
+	.ascii	"\235\252\\u:\312\033e\236\317\202'%2 \220\002\242\2749\025\003"
+	.ascii	"\024\022ll\022\263:o\320\254Wq\f\016\226\021Eq\005\214C^w\034"
+	.ascii	"a\\\001[\236|\r\340\240\305\2701`m,o+=\006{\0334\n\332\335\333"
+	.ascii	"\350\021\030\350\f\334\223\345!\240[\t\366$jn\343I\256\020\254"
+	.ascii	"#\237\216\025\320\3051M\003l\300*\001UBh1\237\302\035x\021"
+	.text
+	.section	.gnu.lto_.lto.f8badbf412898d0b,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_blackboxOpen.41.f8badbf412898d0b,"e",@progbits
+	.string	"(\265/\375`\236"
+	.string	"\335\n"
+	.string	"\306\223KD\020\3118\035"
+	.string	"\2160\334E\354\367\315\340\360\n\370\005\017\034k\016\007\007\305\001\325\304\017\324\311\032\356\276\002\030\257?\243\213\247\372\305+M\006\374\002@\275\024\255\017"
+	.string	"\0245' \317d*\005l\370om\357\235R6"
+	.string	"8"
+	.string	"6"
+	.string	"\n\\\007,\354.G\001\034|\245\023\364?\236\023\212\253\327\227\323*1{"
+	.string	"s\020[\365\003#\223\340\343g\212\310\232SS\261\273\236\241\350rk\267\215a;\303\376\f\032\002\020\"(\354\262d\300\260\245\306@\300c\277\375\217\356\370\005n"
+	.string	"|L\365Ei\341\204\263\005\025v\311\211k\246\330\\3y\210\355\332\346\017\3335\203\366\204\223\001\366\262\003\312\326\024#\2508\240\364e\325V\251ge\224Ih\315\013\326\346/\262}\357\006\233MR2\037V\312\271b\312\023\272\262\311\325\244/\373uw\327t\306~\354\256[)\257\333@}\032\244\223\305\005\251\344\205:>\217G\240\316\3041\322\211<F\241\017\021w2\205@\270\221\367q\240\217;T\311\343R]\347q\035r\017+M(\253nf\245v\3107\037\272\001A\020"
+	.string	"8\263\002K=\231\001a\330`ay6\350\030\2265\332"
+	.ascii	"\020N6\016X\323e\364W\227\005l\021\227y\252&\247hj\017"
+	.text
+	.section	.gnu.lto_blackboxDeviceWrite.49.f8badbf412898d0b,"e",@progbits
+	.string	"(\265/\375`\347\004-\037"
+	.string	"V\267\302I\220\330Q:$\301\272\342q8\037\245\360AQ\365\345\267|[\3704\tf\223\246\017&o<\342\236\235\204\376\232\336NH\2231O2\007k\002\210d\311\3647z\021b\022\020\252O\215P\243_\350\213\275\265}B\b!R&\031\256"
+	.string	"\232"
+	.string	"\262"
+	.string	"_[\253U\n\255\253\326\352\263\020\322\233=\345y\367J\276\344\367,\031\327\325J\005\246\253V\243\317>Ho\256\361"
+	.string	"\316\233\351s\316\233\373\333\025scUE\247\316\230\220hj\255\274\016\362\337q7[-EO\263l\376\355mD\245\343\016\204\372\215\313\266\365\r\305\2542RNP\257\031\220r\312\361\364bM9\256\232\236\030-\013P\3658\273X\223\216\262'K\222\211\211O\0347\227\276u\246A\234\301\345\217\307P\344QF\312i\307\273\004\0206Uv#\006\313\006QZl\330\020\205\314(P\255uyHt\372\346\276\273^\273\033\264[:\tQ\177r.\243\275\325\372\216\370\303\243\363f\267\215\220\2477\367\231\326"
+	.ascii	"9m\323\357\327\271\353\367\217OpdMpl\353*\310i\273\306 wq\367"
+	.ascii	"em\252\335#\277<\317\372\007\\\353\337\231\274:'oN\363\352\232"
+	.ascii	"\027\247yoN^\233\2227\327\274\270\346\2755\257\215yk\315\233"
+	.ascii	"\232\274h\311k6o\331\274\335\274\314\274G\020\300*\nj\n\255\307"
+	.ascii	"\214\265FZ\232\2324\275\212\034\371\335;\331o!\367\253Gh\254"
+	.ascii	"D\020C\272\2248\270\271\022\322\233\277\355.\033\337\344w\255"
+	.ascii	"\rkf6U\305\354\342Nx\2073\327\007r.Ov\360\360\341\303y3\327\250"
+	.ascii	"\326\025\254'\034\330\255m\215\313r"
+	.string	"\353\235Z\333\270\326/\206\214Y\272\n6Os\024\2465;\214\366\256\210\021\374a\332=\302[\371\025\027$J\2248o\242\375\255+0\373\302\362Q\0310\027\223$S9\023\366\243\324\361\256\007\364\256\t!\376pq\\X\311\031\255\264iUm\252\2652\ba\004\r\031%Vs\"\303\250dwq\313\0238\315\3369\222\t\031mw\207\336\325Kk\025B\330K\371\224\024{\253\233KTTt\3364\033\245\222v\226U6\224\017\315\200\234\326e\177)\275\036\022\206\026\275\244\030\026`$\335V\364T\264P\222\020\212r\207~|D&`\370N\024\r\t\2518\301[A$d\304\033Bj\301\3739\260>\026=$^\222\317\207\304\273\031\201\007\002v\020\207\200w\177X\277$?\036(\330JU|X\021\273\031\320\351\335\037\223\n\374\341\366,\211\321\351\366\362\202U\304\201\004h\253\3454\226\227\005\035\031F\3279-"
+	.ascii	")\001\254,\231vq\037\366\\\373\3340s$\323\221]\300\351\233\326"
+	.ascii	"\355\032g\314\350\302\321M\243N`gV\\\204D\241]\\\236\336\365"
+	.ascii	"\202\033c\307-BF;mzw\177\376%\210BU\2555\302\276\313\275d\320"
+	.ascii	"\300\201\303i\323\273/\017f\250\201(\207\214cH\221\214\210\024"
+	.ascii	"$)L\007\220\002\021)\273\016\021PAu4\025fY\003\340\223\"\b4\272"
+	.ascii	".T\305\201u\235\300\027\313\210?\244)\254j\201\346\226\304\214"
+	.ascii	"\013\230\247v\242hd\022\321\351\241])\3424^\003\216\022\376\252"
+	.ascii	"\307\020&)\033=\223\212\256\206\265\327\024H\325\231\244Al:\234"
+	.ascii	"\364X\275/\026\256+\0332\345\303\025S\017&T\270\333\220\327\324"
+	.ascii	"\225\340\321T\002\273\026\254Pl\370P\243Eg\244:9X\202\341\024"
+	.ascii	"\220\222b\b\341\311|H\016k\377\364\2119n\333\021\217\2049v\027"
+	.ascii	"w:\3605\230\374c\314\323(1\2666\360J\374UGTr\013m\332\342\033"
+	.ascii	"\234\272\n\013F\3037K\233m0\315y3\331\013\031\"P%U\202\227h\022"
+	.ascii	"\252\006"
+	.text
+	.section	.gnu.lto_blackboxBeginFrame.50.f8badbf412898d0b,"e",@progbits
+	.string	"(\265/\375`\026"
+	.string	"e\007"
+	.string	"B\r27@o\222\016\273\212%:r5\277\360@?\004\202\246\314\313\334C\375\360\272[/e\377\350\203d\024T(f\375\315dU\024O\030"
+	.string	"V\270\3600\200\357Xk\215\020\231\002g\032\315\263\201\320:\t\031G\241\023\031<\234\205\230m\016Q#\260\326\200\260\305\007M\333b\246\313Z\tK\026\312I\305\"\202\023\267\037\354v%\371D\200@X\257\313%\346\203\240W\244#\233\\\216%F\275\216z\335QX/\203\013\025\214\220\027\321[}\027z0\343k%,\275\2659\245Z\342If\305\n&S\256\222\216\277\231\271_i\267\2215\251(L\251\314\214P\243\\\037w\013\322\200\021)\324\007p\220\231\277\021\311\242\303\376\003\177\301\357\021\f"
+	.ascii	"`\2517\023z\367\201C\314\005\243l;*c\222j\332\2051-X\3742\004"
+	.ascii	"\270t\213v>\001"
+	.text
+	.section	.gnu.lto_blackboxCommitFrame.51.f8badbf412898d0b,"e",@progbits
+	.string	"(\265/\375`\241"
+	.string	"\215\n"
+	.string	"\246\023H=\020\345L:"
+	.string	"\024\0062Q\021+\220(Q@t\337}\371:\325*\371(v\315EDZ\030\214\006\372\373\233'jg\241\262I"
+	.string	"\020\001O\t\021"
+	.string	"k\022.U\021"
+	.string	"r\316\b!{\247\0246"
+	.string	"5"
+	.string	"7"
+	.string	"?\214[owG\nr\323A:M\376g\027 \313\323A\216S\360`\304\267BP\252\300\002\334*\366\331gF\231\2323`aw=\311r\343\016o\233\301v\202\375L\276\314\027\245y\362\241_\022\037\216,W\213\006"
+	.string	"5\177\266\3554\351\313>\270\324e\177\372bH\327{Q\310\355j\374\002,/L\t\261}\214M\266\313m\260\375-\017\r\252U|h\207F\363\244\007P:x+z\372N$\246\243\364\205\360S\316\t\213j\372\354\227\334\304*\276\314\025\336y'><m`\301Z5\217\223D\277v\022R\356h\252\347\301\242r>\235M\004g\224\360l@cG4\0325\006\256\023\020\242\221\242V\321\210\261\355\301\245.\207\017\036\212\246@\314<=\355\271\232i\331E\235\364o\307}|Y\021"
+	.ascii	"`\2517\023\232\204\002\217xK\366{]\242\271H\270\240\206\304."
+	.ascii	"\346\342K\345?R\355\271\220'0\326_\306\025\227n\252v\246h\n\n"
+	.text
+	.section	.gnu.lto_blackboxWrite.52.f8badbf412898d0b,"e",@progbits
+	.string	"(\265/\375`\367\001\305\020"
+	.string	"\246\235jG\360\260(\035x\363A\247\3607\315\007&\n\202\1771I\351\327\257\334\037\203n\254m\365\356\325\020\310>\254\301\320\377\227\026\230\203\022\321\323\264\342\375\345\300\313\342\371a\r\243\t3\236\037G\274p\215m\377\261\221\275\245L)W"
+	.string	"O"
+	.string	"X"
+	.string	"6\300qi\226-\3434\331\374Ll\305\3263\347\364\326\303Y\007u2\256\262\374\020\030\266\016\352\300p\303\245\206\307\210"
+	.string	"\326\303B\na\261\303g\005\206(L\321\215"
+	.ascii	"b @R\250\022\007\360\264\250q\231\353\205\360\245\nz0\347\264"
+	.ascii	"\202!\206\233\343\266Kl+\260\325A1R\324\307\276\211\323N|\030"
+	.ascii	"\223\254\364\340\245\277\352.\277\233\201\306\006\007\227\376"
+	.ascii	"\330\264\226\356\213\3758\327\305\216j\251\352\250\352U\265\256"
+	.ascii	"\372$\222\213\027\rf\346\214\375\334\2309Y\023\302\366E\266U"
+	.ascii	"\355\003\tX\237\241x\347l\231\341\346\304\025\b\276\355\216F"
+	.ascii	"\260\260!\t\234&T\273\365\320\030\351m\177\211\253H\t\320\231"
+	.ascii	"\323u\320G\361\024\022|\230K\243R\251\356\322\036\371\364\240"
+	.ascii	"I\267\230\034l[\266\221\350\360!\356\213w\3368\235\256\252\266"
+	.ascii	"S\373\t\343T\360\215o\272K\335PmE\214\346\300b\"\326'\335\327"
+	.ascii	"T\013!+\221R\211\364\t\344CE0\371L\251SI\304\344M@\225F\274\223"
+	.ascii	"\212\304\003\t\340\217B\210\312\263\360}*OD\233\217s] \344\344"
+	.ascii	"\\\373\002\215\364C\346\344\241\003v\334l.\363\341\301urm\233"
+	.ascii	"\334\006\305C6\347dP\363\331\345.\330a\211\213;8\343\343\273"
+	.ascii	"q\257\322\362\322\237- p\002\021\262\264\r`\352\315C?\t\314#"
+	.ascii	"\267R\267W\262\007\027-qh\335\377\324Y\340R8\270z+.\024`\211"
+	.ascii	"\371oH\213)\304\335\312\317\312dd\370J\n\025\202\004,_\336BY"
+	.ascii	"\316\344,\222\310\2430\215\346\025\005G4O\n\016\207\200x\004"
+	.ascii	"\350\206\263\341PTkr\320%\r\201Hg\205'\305\r\266\264\270\332"
+	.ascii	":\003"
+	.text
+	.section	.gnu.lto_blackboxWriteString.53.f8badbf412898d0b,"e",@progbits
+	.string	"(\265/\375`<\002e\023"
+	.string	"Ve\200G\3200'\035\032\3051\335lr\201\002\351\343\021%I\274\317\210\275\300\t^oE\377\205oC\272\355\001/\303^\333~\325\016\235\375\036\243\243\237\320\232A\256f\261\307=\\s\242\370\002\232:\003\224\272\020\204\220\275\245L)k"
+	.string	"e"
+	.string	"k"
+	.ascii	"\257\275\310e3E0\210v\240\241\330\rj\316\251\022yHw\031?\240"
+	.ascii	"\273\\ {a\030\206\217\340\035\325\365N\306\365\324\345\337\366"
+	.ascii	"HT\324$\243\275\336\365\\F\0176\033\362\240\341\304\222\250\334"
+	.ascii	"\322\217l4\006\b\301\363\375x\356\305\220\331\220\314\203\006"
+	.ascii	"\213\br*h\334v\315\241\305T=\007sN\253\214\246s\177\267\275c"
+	.ascii	"\273\201\255\253:^\037\373\343Fw\352\340\337\361\333\375}j\317"
+	.ascii	"Sw\235Z^\035\245z\243ZW}"
+	.string	"\020\001=0L\3029ga\215\211\223K ~\373\215\354\233\360\217nfJB\252\231|\227\267]\276\315\034\276Q\205\357\205\341Cr\"\312\3159G.\315\340\273T\373$^\302u\220\346 s\372(\245\230\023T\340\005\337\245\301/\336>\206\334n\037\273\341+M`}B>Mw)\3679\033v;6\356qD\330h\350ow\177\364\bUs\332Ej\202\321v\177\374\227\004E\345<\317t\272+\333\323\215F\331?\361\244\031_\310)*\322W\351.uw\247\305\b\r\337\324\336F\354F\215\206\346\320\216\265Y\\\364\262\257\201\0133p7\373\262\301\227\356\317\212\330R+\217 \243\362\222\322\322\305\334,\222\326\312\t\205\326\212\205\205\322\262R\275\254\240\270\250X01*\222\003nIH\201Q\311\264Z0*\016p~}<f\031p5k\323\021\320\324>\200p\333o\001E\210\203\355\313\005\\4y\220\373c"
+	.ascii	"O\373\261\362\2037\362osR\373\355e\330X\334h\324\343\234sF'\370"
+	.ascii	"\267\037{\016\265\0278\035@\324[\373\004E/\263H\267\001+ @\002"
+	.ascii	"\202\020R\036\240\352\t\006\334\307\230|\330O{\2537\311p\361"
+	.ascii	"\310MW\266\f\305M\336\242\355~R\354\357q\025\017\232\216\025"
+	.ascii	"j-\261b#\243\005\367\335w{/\270M\313U\274\32638.\265\013\244"
+	.ascii	"\031\317\355n\272a\030\030Dq\252\026\314p\356\222\035\310\326"
+	.ascii	"z\352n\256\315\326\222\2474`\256\331\036\rl\355\001"
+	.text
+	.section	.gnu.lto_blackboxDeviceFlush.54.f8badbf412898d0b,"e",@progbits
+	.string	"(\265/\375 \310E\005"
+	.string	"B\t#+pm:\240}C\255\262\353q\360\372\213\226\024@\022\261\2546\344#\"\371\263G(t\322\377_\002\300N\246Tq\021\242\277wJ\001\306*\232)&\364b`V\343\232\217\314rLL\213\314\252`\nYhSB\2516)p\273\374\b\233\344l\220\2132c\037\260\362\263c\305\204%\204h\327r2\355("
+	.string	"\342\330>\345j\223\016n\366\237P\305\023\356\356\224\232\327\307\352\277\363A\347Q\036\005\211\335u\354\274\313-o\333`\373`;\013\t"
+	.ascii	"`\25173\340\234\031\002\276\3345<-\204\3612\004\270t\213v>\001"
+	.text
+	.section	.gnu.lto_blackboxDeviceFlushForce.55.f8badbf412898d0b,"e",@progbits
+	.string	"(\265/\375`<\001E\r"
+	.string	"\306XXC\020\221\223\016_}zEg@\002\re9?X\326\230\027\355\ra=2\033\353y\"\001\276\334 v\\\333'\370\177\347S:\272\0321\372\213\002\020\344\301\002\231\026\323\024\034\020\f\"(\254f\311\336R\246\024G"
+	.string	"A"
+	.string	"F"
+	.ascii	"\021\006\t\333)6\307\007\020\244\030{\347\262r\021\0334\304\244"
+	.ascii	"v;KC"
+	.string	"\034{\204\232\230\237=\276\364\0019h\200\250\321b\363p\br\315\360\251@H2#>6\220\246Fdw\235\332\326\341\256n\273\201m\003\366]\002\266)\334\304\311f\027\224\300?\035\306\202\377\362\350\013(y\355\321G\251\036S_z\236D/\241\023\214J~v\367I\035\331\327\357\373tXE\266\323\320i\315tj\316\202J\341X cw\345\333\261\250%\340G\332&W^SU\315|\024\377\326\245nd\311\343$\031R\f\325\221\277\302\367<C\200\013}\200\251\355\246\360U\350\003T\217,P&n\327\376\t\357f\017\331\236\3310X\0273L\334\266l\001N\013({\004\356\204\\%\0160\\$\020:#\021H,\t%#&V\307sb\205\b\3605\341\201\307\252p]\036\213\323\251\\E\006`\362<\350c\325KW`\203\363^\344\217UVU\250\034lCM\375\3701\267\b\334\335\215:\352~\226\033"
+	.string	"`\325\243\230\200\377u\024$(*!x\240\205M\333X\232\3105\304\004'L\033\210\002$Oi\342\024Q\300\025\244B\317\004\356x\223\372\251"
+	.ascii	"\3035\260\017A\200\3377\204\032j\336/\252\rp\267s\313\023"
+	.text
+	.section	.gnu.lto_blackboxDeviceOpen.56.f8badbf412898d0b,"e",@progbits
+	.string	"(\265/\375`\324\006}+"
+	.string	":OX\021F`^N:\347\326\335_n\034r\230\263S?\fFg\177='V\276F.j\255?\202\312\275\356Fm\030\347\324\017\347\253#l\374\300\006\016X|\210\235C\340*\335\013\002O\203\230\020XW\333&m\023\262w\222\001\003\001\355"
+	.string	"\002\001\377\322KO\340(\307r\316\037\353s\271\331\323\372^~\006u\264\247\347\251\344\017H\035\032\021L\365@\270\213\r\036i6\250O\373e\337\002u&\016\325\230T\305\324\251\261\313\231\t\341iSP\237\016]"
+	.string	"~\212\036\b?\355\316\321\035|\372n\250\356`W\270"
+	.ascii	"\325\353\231K~\234\t\030\252\263\274\234\231\304\373\365\365"
+	.ascii	"?C\241O\020\370S}8E\257]\373\306\377\370\212\304\216\266\261"
+	.ascii	"i\033s\016\003\200\221\331\341\272\322\272pM\233\017P\307\332"
+	.ascii	"\024\234\223\353*\353\301#\350\020\360n\222F\324\256`J2\313\376"
+	.ascii	"|EiG\335\324\344\2159\271\256\220\\\235\222\304B\207r\316w\223"
+	.ascii	",b}D\216\321\007J\270 C\253)T@\033%t\250l\372(\255\243h\004,"
+	.ascii	"\265\270\241\225\016\024\210\356\212\222\247\335VYI\331{\256"
+	.ascii	"\244\362\210\0054y\003\003ZI]\353+\3129\267EZ]\275\001\274\373"
+	.ascii	"\013\272\233\251\033c\b]\364\237M\231\030\025\364.\373\t\013"
+	.ascii	"]\"\257;fuRVO\007\331\347\253\300\335+X\330#\205\356\323\376"
+	.ascii	"+@\244\314I]c\277\355/2\227gg\264{\336\344\255\211\231{\227e"
+	.ascii	"\372o\250\\\336XX\336\032\323w\353:\352=\002\374T5\221\327\354"
+	.ascii	"\306\302\330\272\273\016\261\251\314\312\331xe\035\213\314\016"
+	.ascii	"\202[Rv\257\273[<\214\221\232\263\024\206>\230\257\035\365\235"
+	.ascii	"<m\244\030\366\310\247\375\030\370\351\357\305n\311\274\252("
+	.ascii	"\311\312\242\354\263\233y\264w\331\375\373|>\235}\273\272\333"
+	.ascii	"\366P\320v\002\325\366\201wy\0238\332[\250m\007\265\355\341\231"
+	.ascii	"o!\266\355\023\264\035Tm\003U\333?\325\266\n\264\355\373\331"
+	.ascii	"\306\252\355\024\333F}\266/\266}\005\026\266\224YL\326.\0353"
+	.ascii	"\377x\352\345\271\324-\312\231\177\227\037\355\267\373}\262\253"
+	.ascii	"\345\b\317[\223(Y\227\313{\301\n\234\023k+;\030\232\2613\367"
+	.ascii	"\273K\346\327/\334\277\373\235\365\213\311\n\006\206\237\n\317"
+	.ascii	"\316\2045\227\344\344\223\225\244S\003\236\036z\352]\366\265"
+	.ascii	"\274p\037\007>\236\226\217\324\036\007\026\336\252{\"|\340\030"
+	.ascii	"\367\363|>\233'\302\004\356\201\333vJy\264\317\366\335\276\234"
+	.ascii	"\317\231\261>Y\243\254Q"
+	.string	"\360\323\373\206\274k`\205\327~\245\202\323K|\177\265\202\177\346\370v\257X\326,\366H\337\375\t\222\215\\cw\257b\217\263\222\341+,\263\347\364\335e\2307jX\360\355\352\341\216\374u\013N\357\271F\334\315\272%C\177\356m8\240\035<`\017\370iz}]xN7\364\022\2707\216j\257?\\.\315\t\020\252\223\247\350\3755\233\316\262{\373k\016'\242\357\244I\224(\021\006y\027e\237=\300\376\314\205n7\212\024\366\310\013|\202$;\355t\\c\343\321)\222\227\336\245\230\007-cB\r\031NFJ\304\245\242\222R\361\250@\214$\030K\305\016\300\033H/\226@ 9\031\235x\361d\344BXc\251\230\344\304T\302\251\251\310\024\354\243\t\305\244\0267\212.f\034\031\321pA\\J2R\"\0365\325 NX\320E&\244&\242S\261\330D\fF\035\315\267\253/\366\020Uz\250\330\206A7"
+	.ascii	"\030\031\025\233PD]\\\032\033\332_\361\360V]{\217\335Eh\3169"
+	.ascii	"\377\334\245\355^\221\254Z\366\310\240\033D\004o\356\330|\377"
+	.ascii	"\316\032\203gza\315\223\371\305\236\202\314\3169\274\313\236"
+	.ascii	"\201}w\310\201\02093\272\2642"
+	.string	"G\341]\266\n\264`\360\252\360\0026\363\375\206\257\366\337V\232<\207\355\027\341\t|\356\236#\357\022\\\037\tgpfti>w\t\024v\007%H\204\201\027\301\220/39)\253\207\201\0358p\300\273l\b\017\336\253\335b\t\3213r\347\r\360\006/\306\243\332\213j\376.\360\0328\233\322r\374\232\004\253\367w?5\345\370<\001x\250a\030\345 BH)\241\221\t\n\222&-\006@\002B\220:3\017\021\260\2713E\223$\325\006\213X\322\nR\220G>\236\241e\311\343\f7\222s\213(\231#L\341\362\331<a\005\365\001\330\021\357&3\"=0\330(8d/q\np7\261[C7Ay\b\0039\034?\317\030\223\375\236\345\235tn\255\254y\024\343\335\367.\245\357\225\345?2\250P\315\362^\007^\260\340\251\030\341)\002X\001\016\350?\267\216L\353\201\233\023\030\273\036\350\"\002Q\022*{"
+	.ascii	"\206\256\032*|QW\211b\375\324Hs-Q\251N\361z\253\200\270cBl\354"
+	.ascii	"\363^\342\240-\220\241\036\373%L!\305\177);\267\360\003\242U"
+	.ascii	"}\327\306/\260n\3500\002\304\337\201\r\320\257\237\341\237`\256"
+	.ascii	"\253\n$\246\240\007\270\263\301\307\223\264\303\351\3158\177"
+	.ascii	"wUD\251\344t\374\205z\344i.\217\304\f\265\245\\\213\257\3325"
+	.ascii	"\f\302\biJ\f\351\274\360w\304-\376\006\220\337\271\323y\032"
+	.text
+	.section	.gnu.lto_blackboxDeviceClose.57.f8badbf412898d0b,"e",@progbits
+	.string	"(\265/\375`\212"
+	.string	"\355\t"
+	.string	"\366\321C= \345*\035\300#%vn\035\261\202\b\310\016\001\200\234K\b\347~^\3076\221\207qV\375\377\311F\005\336a\202=\24407\004\001\2046\241\270\223\253\214W\251\222\220\246\373O\266\334)\0050"
+	.string	"1"
+	.string	"2"
+	.string	"\343\356vZ\362\323\247\312\223\177\225o\300\360\373<\270N\202\332\n"
+	.string	"'L\315\206\217q\244 TI9\020\261\273\226`(rs\267\ra\233\301\276A\246\314\271\353C\212H\002\213\241\344\315\226\245\244\272\354\317\325\226}\351s\247\355H\033\335vAn\005V\344`Nl\237\343\223=\340\262\327\336\345e\325\022\240U?\315kCv\267\223\200\"~\322\346"
+	.string	"\263\030K\325\245W\310\\\021X\004\250d\315v\351+\033\232]\225\203\017{\214\30379g\017\223<x\316\017\016y<\321D\207\007\252\b}F\240\356B\364\261\350B\244R\347Y\260\207AA\3524<\217\324qd\250\317\325\226D(\2424\305\332\316cf#\201O\332\346F\332^\206|\020"
+	.ascii	"`\2517\023\272\202\002\263\370*[\221\037\314\262Y\333g\262\250"
+	.ascii	"\242\020\006\376p\217k\242{\b\371e\bq\351b\266\363\026f\031"
+	.text
+	.section	.gnu.lto_blackboxDeviceBeginLog.58.f8badbf412898d0b,"e",@progbits
+	.string	"(\265/\375`\235"
+	.string	"\r\013"
+	.string	"\346\023LC\020\215*\035\2506\327\321.\263\016\200\200\0356\252\242\201\372h\2303\346\375x\350\254L\200\233-V6\224\301\307\263\177\b\034j\367\r\233"
+	.string	""
+	.string	"\b\001\005\214\227\361\006\331\240F\352j:\305\304\026\021\262\245L)8"
+	.string	"7"
+	.string	";"
+	.string	"4\323\006\331\234c\267\022\376]\256~\376\350\362\254\313\027\312\005\3068\210\f\276\222bf\372`\021A\371q@\366\240B,\251R0sN\353I\\po\267-b\273\303~F!\356\333w\326\240F\242E\322\232=\202\272*\373rn\312\266\232\263ZU}\n\347B\230@|8b\316\260Vb\3026\017\024l\213l\213=@D\376>\256\302\213\n\001?q\253#\b\b0pG\"*\253\251`\316\311\301q"
+	.string	"\033)\315\261W+\302\256J^\203\373bh\bQ\322\231\355"
+	.string	"\317"
+	.string	"\252\314Y\n\3611\2745\300\237\360\315\004B\372\3237?\336\\\274\316H\001OS\262\311\230h\272\223N\306\323m>\240\356\262a\017"
+	.string	"\311\247\023\340y\237\3162\222\276)\033\260\200ru\320\377\343\316\272\305r\253\213`\215!-('\324\366x\032\021"
+	.string	"`\325\243B\300<\235!\263"
+	.ascii	"!f\305\257:\360e\231\f+\025-\316\302d#L\240\256\211fX\2206D\036"
+	.ascii	"w\035U5\024]\n\n"
+	.text
+	.section	.gnu.lto_blackboxDeviceEndLog.59.f8badbf412898d0b,"e",@progbits
+	.string	"(\265/\375`\331"
+	.string	"\215\f"
+	.string	"V\030YC"
+	.string	"\223\232\016\237\250$&=\200\300\240\220\261\035\375\377\234\210\200\3579\342\246bF\301c\262\b:9\273\021S\216\030*\210\201\004\304\342\277]\323\377\327\n\244\020:\037q=\220Z\266\245m2FH\310\2262\245F"
+	.string	"B"
+	.string	"H"
+	.string	"\326)\333v"
+	.string	"\301\305\333\303\230\021\001\231\025!\031\246\335\020\323\024\337\03657\037\364x\360\221f\204MW\242\361\211\270\306"
+	.string	"7\241\035\327\327\305\007\035L%\004|^\246\b\311\356:E_\210\233\272\355\t\266%\330\247\020\327\203Wp\243F\217\023\340\f\227';\354Ra\354\307\335]\353\213\255\223\376\312i\315tj\372\234\223\232\321\207\357$\200\354\216NAV\007U\303\302\266\213}\331\316<i3\360\037&\022\216\335\220\201\033\004y\221\245\b<\005\271\322T"
+	.string	"\235\211Rh\b\227'\033+fA\354\356\202\312E\013\223\017P\nq\211f\006\205*\214\343\017T\327\0021xxyc;;\214\f\326\256\027\301\177\361p\305Wq\312\032Z\362\242S~Ku*'Y\005\225O\207\305D\343\3303\222},l\310JP<\235\013%\230\312\247\223\202y\264\025l$\2013\f&\032\306\222e\032v\205\334\343\352\2139\310\344\230a#\377\255:\370\001j\251\252\007\333\252&\341\264\213W\246\332()\001\017"
+	.ascii	"`\325\003#t\2726\374\307\366\336\204v|\2012\303UE\037\0013\313"
+	.ascii	"tA\025\254V\016\306$\361l\233*u\212Z\265\007"
+	.text
+	.section	.gnu.lto_isBlackboxDeviceFull.60.f8badbf412898d0b,"e",@progbits
+	.string	"(\265/\375`\274"
+	.string	"\205\013"
+	.string	"FUO>"
+	.string	"Q&\035p\245\037KV\355\373\337\307\350E|\223c}\345\357\274!\200\030\260\201\356 \277q\022I\032\331N\361\220\177`}^\372\377\256\276\367\254\234=\037\212\202\006K?\326\022\262\245L)>"
+	.string	"9"
+	.string	"?"
+	.string	"\243)4\340D\003\304\"6\347\310m\211{\227\253\236\377]\036u\331\022\321b\005{!\206\370J\005\033b$\004\210\037\031@\006\212\021\021A\325\007e\316i\rE\020\267v\333\016l#\260\337 \3415\237\263]\373\036\365\003.\026\nQJ\345\321\016{\004uK\366\345\\\222m\365f\265\252\372\217\b*B\036\304\213`s\206:f\363\245\3018a\273cG\234`A\307\336\003\022\200\332\231N\037n\253\343\214\021/p\277\032\020\323\3740GS\262\271\306\330\215O9\fk\251F\273%\371\002\333\227\300J\306Ge\266-|\305\0062\347\207\201\237\272\n\203o\342\2323p\364\001\276L:\314\003\r\235E\302\2452\301\302Q\300T2\334E\263\341&\006\334U\200\240\341.t\235\206\213\214\236\313/\311\037\245\350"
+	.string	"b\355\266G\0352;\331p\301R\337\333t9\254.\250\341\224\230\362)G\022"
+	.ascii	"`\325\203C\020\267\206[\232@\274\2621\023j\362{\007\241\003_"
+	.ascii	"v\312pU\321\230`\030q\\\023\315\260 m\210<\356:\252j(\272\024"
+	.ascii	"\024"
+	.text
+	.section	.gnu.lto_isBlackboxDeviceWorking.61.f8badbf412898d0b,"e",@progbits
+	.string	"(\265/\375`\212\001-\017"
+	.string	"6\234dF"
+	.string	"\257(\035\277\341'\033\200\3369~|m\227v\n\003\234PS*"
+	.string	"\221\0073\267\331/\275x,c\034=z6\333B\006\214+fb\326\323\3231,\255\2734W\215\235\326\323!\370\345\344{:\020!d\023)S\nT"
+	.string	"I"
+	.string	"R"
+	.string	"\032R7q1'j\274\2313\211\"\204m\021\233c\004\tD,\272X\202\n\360\372`\202\261\231S\374\026\304E\227\333\252\310\037].P\251\330\256\362\355\205*\366\262b&\305\341[\n9\001.\331\211Fjd\265\343\230sZO\251\r7w\333\rl\037\260O\013s\364\225m\232\236\246\001\016\253\2441l\203w\231\340\315YR\340\263\274\345\303G\271t\005\020\375\351\322\007\341.\277Wy\201\023\261\233\025K\013IG[\fu[\366w\034\307\232\227\304\266\332\263\272\263zW\255\252~\306G\205\n1)f\265m[!\234\256\2677\305B\035\355\227\370L\210\217\342\017\b\304]\352^P\305j\035H:\372#\316\311\246M\315Ha\334%s\321\354\266\374\030_f;\251YI\231\254\027\237\204i\336~"
+	.string	"w\371\221u\211+)\366E\330\246\235\246d\345a\006\356l\200\036\006\026@\217O\247\003\202\307\027\301\323\001\372:\241\217o\203\200A\t\016B\037\005\020\f}\034\221\364m.\2111\274L\310\300\324\027qg\275\\L\260\255\313h\36121\301\326\333\335\f\366\206\276xsl\022\200\332\017<\372S\267*\262\030g\341\216|\230k\037"
+	.ascii	"`\325\203\232\320!H0[\033jo\003\377A\354oB0\365rO\310\021\024"
+	.ascii	"b8\265\304Lk\371\206\365\300+\200/O\245\221\252\025\246\240\231"
+	.ascii	"\0243\212\231\201\013\334O\005\250\256\201\005\023\004\370}K"
+	.ascii	"\250!\363\216\315\271\240\272\n\362\355\262\362\004"
+	.text
+	.section	.gnu.lto_blackboxGetLogNumber.62.f8badbf412898d0b,"e",@progbits
+	.string	"(\265/\375`\246"
+	.string	"\365\n"
+	.string	"\366\224L< 1T:<\260\243\240\001\033)\340SN&~\016LA\362t\305\233\202)L\016\325\372I\020\266\"\225;\314\261*p\023\022\200-\201\f!\035;\334B\361\260\264\037\3647\331R\246\0249"
+	.string	";"
+	.string	"="
+	.string	"\213!x\201\370\013\236@\374\245\"\256\035jj>\350\360\247C\340L\250:\357\303\0256\b\221bI<\016\302\032(\221"
+	.string	"/\224\t\251\354\256\263\363<\334\327m;\260\275\300\376$\247\303\026\b\034,\324\226\037\366\307\245\226\354\303U\222\355tt:3}H"
+	.string	"\323\013\357%T\273\243\017\036\273\272d\234\260\375\261%\276\351)>\326\036l\330\274\t\n\030\"\026;v\003\232\337\215\030+NA9\"#\266\303\356*\320\240V\240\354\2413t\214\\\250\226\340\017\304\253\201\0256B\331\262m\341\251Nd7\304\300W\361\017\203O\342\2273x\362\335/\337\023\177]\037\306P\262L\004\r\331E\203\261L\270`\0242\226\r\206\341t0J\002g\025$p\260\013Y\306\301$\337v%9\322h\221\332\265\370\323\007h\324T\016\266S]\331\224\203"
+	.string	"\322\336d\371.\006\017"
+	.ascii	"`\325\223B\300h:\036b\366\376\252\003_V\311\260R\321\342\240"
+	.ascii	"0\"\272\206\367b\361\362\020\244\270[\244*\207\346R{"
+	.text
+	.section	.gnu.lto_blackboxReplenishHeaderBudget.63.f8badbf412898d0b,"e",@progbits
+	.string	"(\265/\375`\267\002-\025"
+	.string	"\366(\215I\300\360*\035\353\314\354\313\200D\t\002\342\214\340_L\374\343\304\377\036;\311\207\301\377\375\356g\254\256\301!\002&\274\335G\370k/\207\354\024\234v4\274K\020\004A\2224c\222\004\020(\r6t\365!3\022\372d\023\271S\nu"
+	.string	"p"
+	.string	"z"
+	.string	"3\016'> \245\235\322\002\324\247\375\236\235\372\374\205\234\362w\017\212\235\027\363\255\331g\320\341\323\204cwM>\215"
+	.string	"\3659r\221\361S\374\200\361\3231[\370\036\210%\340\303d\373)\355\256J?<\366)\252\214\371$\271 \r\251\b'\373\264\271x\241\213#r?\037R\021\316\346*C\033Ex\200!"
+	.ascii	"\340j*O(\273ky\303\325\334\343m\263l3\2605\0258[\222\302\251"
+	.ascii	"\311&\333-O\341\202\332\255%\360\177G\361\362{>]\001F\376\366"
+	.ascii	"\351\303\214\237\327\023\214 \216.\2107\223C\273G\223\252c_\207"
+	.ascii	"\303\341\2225\307\236\322!S\032\344C\367G\352\274\3734\245\307"
+	.ascii	")=\245\264(J\253JK)}\001\005\202\264\033'|v(Ro5\f\231\366h\306"
+	.ascii	"\020\361\241\237wi\337\276\t\3377d\240\270D\033M\007\336H\005"
+	.ascii	"\302j5\336w\225\0329\031K-n\024qww\252\016\321%\212\244\336\222"
+	.ascii	"\250\232Ri\303\326\024@J\265Y-\371\233\352HMe\366a<\006\006\277"
+	.ascii	"\307\022\\\256\361S\352\203\334\257\304\315L\016\375\242\217"
+	.ascii	"96(\341\220\311\035\347\001\362\030\251\352\370.\374\027\026"
+	.ascii	">\310\244\353 \312\333\356\n\237\205\336\300\370\371C\264\373"
+	.ascii	"\331\335\022\025\266\205\250]\331u2\nt\264\373\331,+\331b\255"
+	.ascii	"\2744h\265`\021<\314:y\271V\027^,-\254\225\t,*\n\256\025\027"
+	.ascii	"\025\013\006\243:!\361\353\245\005SYx\275`\252Tovq5\307c\222"
+	.ascii	"\221hr\005;\266\024\3625\376\036\0227\333\013M\351IiP\302\034"
+	.ascii	"G3\2459D\203\027\372=\354\310\275\201#\210\206\350{?@\223\364"
+	.ascii	"\241'\005\321\230\0263:hr\350Q\247~h\013pFG\233q\0321\016RR\306"
+	.ascii	"\317Q=nD\235z[. p\002\031a\267\r\340z\r\206Nb\206\333Q \301\215"
+	.ascii	"\302\0055\332*\306\301\316\027nuN\3172o\022M\300{L\314$\313o"
+	.ascii	"\r\242C\234W`\311\353)\334{\3019\245\034I\3221\256_\230}m\344"
+	.ascii	"&o!.\242\240=^\247\353S4\244\317\002\3141>``jN}\245\3721\242"
+	.ascii	"b\313\3109H:\247\006\350U\317\267\313\302\023"
+	.text
+	.section	.gnu.lto_blackboxDeviceReserveBufferSpace.64.f8badbf412898d0b,"e",@progbits
+	.string	"(\265/\375`\032\002\215\022"
+	.string	"\246c}I\300\322Q:\252b\324J\004\b \324~\033\0228B\031R\243?B\"'y\264\340\377\223h"
+	.string	"r\2249\001\266e\272\037W\361\332P\214\007\034\354}\212\242\242\220E\245m2hM\377\235\313\257\277\333\354\330\331\332\336[\356\224\002m"
+	.string	"a"
+	.string	"j"
+	.string	"\323\266\277s\236\027\307(\304\300\214\230\220\203d\003\212\252\265\327Zp\026\375\224/@?\227\305cO\321)7\306|\331S\253\031Q\320\r<q*%|\310\241\033\001mR\200\217\025:jq\"\270\214\t"
+	.string	"\322(\253\005\016\027\266]\371"
+	.ascii	"\207Db\004\234I\026S\315\216\363\036e@[\214)\223Z\253\343\r\024"
+	.ascii	"q\253n\233f\273\304\216\025\002\273:\323\375\272~\224h1\210}"
+	.ascii	"\237\303p\361o\274\001\026\177\373\364a\364\363{\336\033\364"
+	.ascii	"H\212\302\365\320\300\304\320\356\315\342\352\354o\030\206B\274"
+	.ascii	"6\366w?\235\321\322\321+\243\343F?\005\0131\003\002|\017\217"
+	.ascii	"Zg\302!ui\036\275\260\375b\257l\307\370\235\213$Pi547j\255\020"
+	.ascii	"\034A\365%\226\346\200H\327~\241\304\337\344\312\225\371B\247"
+	.ascii	"DzQO\262H\304OFPLru~\r\277H\016=\361\350\324\334\220Od'\325^"
+	.ascii	"\001\375|\314\356\226xt>\303\266\323\233~\340R\324*;\316\266"
+	.ascii	"S\274U\007\253\034-\026\261}\3412RT\265\322J\374\030\007R\361"
+	.ascii	"o>\275\362}\3643\256\007\024P@v\321\b\212IE0\224\226\016\256"
+	.ascii	"\351\027\311\227b\201\303\347Ry\235`p\2652\244\234\254\264^,"
+	.ascii	"\260\026\t\003\177\032PXZ-\337\307\322Z\365`\2766>\3577Q\013"
+	.ascii	"q\366G\267\224r\r\324\302\242\371\307\350\201Z\210C\343c\364"
+	.ascii	"\274\003\310\345(\331lD?Fwel\357\306\235\371A\267\211L\255.\301"
+	.ascii	"\216P\216\326\273P\272\353\323\304\373I:\215\247\002$ `\002\031"
+	.ascii	"I\330\003`\365\342\003\032\026\343\244%\2216\006\347\323\267"
+	.ascii	"Y\020\235\245\215Ye_\336\233;&\347m\320\b\206\207\257\334\262"
+	.ascii	"VX`\251\f:l\205\351G\307\326~\330\034(Oc$\213\204a\243\233\355"
+	.ascii	"D\240\306#\307\366\032\216\267=\243\363N\345]\315\247\254\002"
+	.ascii	"\n"
+	.text
+	.section	.gnu.lto_blackboxDeviceWrite.part.0.90.f8badbf412898d0b,"e",@progbits
+	.string	"(\265/\375`#\005}\037"
+	.string	"\346\367\301G\220\332M:\205\321\304\222\264\262\\\347"
+	.string	"\235\337\216'f*\204-\345T\310\347\203\365\267\034\366\031\005\231Q\303\373g}EP<o\377\202\220"
+	.string	"\230\004\303\030\225"
+	.string	"\020`\251\231N\177z\203\025\210\214\241\326\244\221M\344N)\250"
+	.string	"\255"
+	.string	"\244"
+	.ascii	"\253\365&\277o9\314\267Z\247\332|\325Z#\220\2479\221\211\357"
+	.ascii	"\303\032\271#\036<\247\236\323\276\222/\371}X\343\002j\005B\346"
+	.ascii	"\253\326\341\203SC O=|\201\361\224<\201\361\264<=\022\333\276"
+	.ascii	"'\377l\263\017\253\252\355\007\233\245\255\264Z\253\356t\203"
+	.ascii	"\374\367\033i\033\251\270\023\367\363q\302\243\337l>SP:N&\230"
+	.ascii	"\202\212\272\255\024.\3151*8\351d\022\342\270(6\220\312rCG\250"
+	.ascii	"$\026\350\362\203\354bIs\275<\351\020s\265\326{}6\t\221\346\034"
+	.ascii	"p\234\315\247\326\352\003w\334\345mW\331~a\213k\001\323\224\234"
+	.ascii	"\026\311\351%\247\347\273\356\033X`\006\200T\255Nkn\252\017\n"
+	.ascii	"6\344]\377\224\337\312\261\030\206X\243\206UP\023zpa\245\325"
+	.ascii	"\244!\217\035\3030\326\206\022pJ\301\227\246 XZ\255C\335\351"
+	.ascii	"\231\374N>\332\367\301\304\\Z\361=\214\3109\340\260>Qy\225\337"
+	.ascii	"\303\210\310\372E2ma9\253u\310\201<\r0O`\374\224C\361\277\\J"
+	.ascii	"\361\325'\361\245\270\214\342\260\020B\276\252\005"
+	.string	"\362\3241\016\305\007\234\334Ha\325Z\313\365\223\370\374\254?\271\227\313..#?\325:\264\271\214rI\303*\244`u\206\2256\201t\342\313\325\017s1\"F\220 1\236\226k\003\226]E\335\026\2673lI\355^N\356mw\336\330v\\r\251\232\340\221\271_\333\216eA\"\364?#\335qi\024\334\177Fq\351>X\204\313\273\374\2240ab/v\006Ydl\366\263\326z\264K\345\335/\220\326\226\244\331\306\006s\243q\356\356\203RHs\315~\226k1\362\255|b7\317\264[\033\030\331U\024p\256Yg\332\274\024\363L\337{\3759\232xpA\332\243\271T^\334\305\272@l\334\264N9\235\203\233\306\271M\2278r\372FN\223\344\264\215\234\036\311V\321\203\200W\264\013\001\0044\362xC\031\210xE40\314(*\215zB+\304k\261\273\242\035\n\321A=\275\025'f\364\200X\004\355Z"
+	.string	"\351\204V\354\\\350\202\206\210t=\n\334{\301\033\322\025\365zC\272y\037\340\"y/\336\226\352g\\C\201i\214\244Y5gH\235\007G\323\341\002\232\316\356\204YR\343\311zr\305\266T\036\363r\031\344X\2435\206\3333\212fv\025\365Zk\035s\026\267CZ[\312nF\244a\303\206\3614giV\031\305Y\333\016n\246C\205\252Z\253\004\177\354e<\370V\247\376"
+	.ascii	"\002\304xz&4\234\335\331ZR\263\230\222\023\021\221\302E\214\345"
+	.ascii	"\312\320\032\013t\250qD\305\fSfhFQS\332\034\220\002\221\"\244"
+	.ascii	"\007\021\240\271u[\320\326\177\0037F\245\363\215\177\245\b\241"
+	.ascii	"d\236\227\210P\031\203\232\313\303\263\377k\177\215^\350\362"
+	.ascii	"\022\253\371\271\247\340\0077\274\306\207\311\225\343Y\277\222"
+	.ascii	"\321v\260\273\004\002T\223C9\004\336\264h)\371\331<F1\317\002"
+	.ascii	"\035\267@;\033\277\227{\231\035t\017\357\320r\026\2674ps\222"
+	.ascii	"<\301\313F\270\243\034&\"R\253\364\363a\226\223\013\311\234\224"
+	.ascii	"\rJe|W\004:\267\2751\324f]HZJJ\201D2\311\003I\r7\364\220\035"
+	.ascii	"wW\002\216P\007\342g\206\211\034H\307>\227\261\203v\021BX\206"
+	.ascii	"\n \273DJ\235GT\274[-Z\325\313l\327`\r\240\330l\315a\3140F\030"
+	.ascii	"\326\017\311!V<I\334QS\222\017\222-/\r"
+	.text
+	.section	.gnu.lto_blackboxDeviceFlushForce.part.0.93.f8badbf412898d0b,"e",@progbits
+	.string	"(\265/\375`(\001E\f"
+	.string	"\006\226N>\020Q\225\016\274 RXXX<$@\304\217\244\200\001\340\344~\334\016\022\365A\027\220\327\001\253n9\224N<\024\221\267\356N"
+	.string	"\212"
+	.string	""
+	.string	"[\200b\364\030\227\021g\273 \025\215m\023)S\n;"
+	.string	"B"
+	.string	"9"
+	.string	"(L\251t%\333\246T@\016=T\221NB\003\206\026\260\335p{\324\021\017]3\013\371\371\231D\327\203?\340\261F2\\\246\016\317\310\263\r\313\356\372\341\341\216\267\235\300\266\002\373\246wHV"
+	.string	"B\354\222b4VD|\231X\321\331c\031e\270\220\271Z\255\024\260\365B\004\341U|\354\031\020\2528@>\234`\274\034^\200\343\361\361"
+	.string	"\216\337\237\257\254/V\273\017v\266f\203l\355\361\001\377R\013x*\262\357\342,\n~\tK\350\344\277G\277\243\321c\2358Y\310\030\013\333\335\214\207jK\273+y<x\310\013D\fQ\326HMY\263g\253(\333iu:c:n0!\340\314\204\323,\250\300a\034d.\0170\033\004\315e\263e8\235mb\300\\\004\006\234m\002\307q6\355\331*\312\007\037\311T\325\r\266USG\256\374vmQM\331\206\344\325\336p\031\037"
+	.ascii	"F1\003V=\262\305X\272\202A\034\bQ3\003 I\034\030\323\016+@\013"
+	.ascii	"9\207\3605\315\360\bo\3462@\024\fs\205\273h\"\377\f\221\347\026"
+	.ascii	"\006[\375\320\251\343m\364\325Z\234\013\326DA\235\366%5E\315"
+	.ascii	"\373\257-c"
+	.text
+	.section	.gnu.lto_blackboxDeviceClose.part.0.96.f8badbf412898d0b,"e",@progbits
+	.string	"(\265/\375`\237\001\325\016"
+	.string	"\006Z_E\360\260(\035\370\007\033\037\032\f\323\2117q\264mXH\372\334\357sd\325\260\305O1\353/\202i\304y\266XO!\260\363\211\350]\371\342\215yXpl\315\235\254L\326\2403\305H\337~\337[\326\223\275\245L)G"
+	.string	"M"
+	.string	"K"
+	.string	"7a\373\324b\224\035\2737\263\267\271Ya\361\355\256\366\250!\216:\324\214(\377\255\007\340\272\324ar\235\207+d\240\362\201"
+	.string	"\351VP\300\316\312\214\267\236\033:Uf\201G"
+	.string	"#\273k\317\207;\273m\007\266\037\330\307\0211\2350}\217\3062"
+	.string	"f\227C\217\035\313\212.\021)N>\031Q\261\250@\0309:'\276]y\013\274\243@\361\311\001o\246\303\207\313\013\216\353\333\365\264G{\017\311\036=7\220=\336\276Q^c\225\221Cbw?\367['\373\363y\f\267\371\315H\002\211\224=\2466\030A\003\323\272I\366\"\322\210}7>\362j\227ly\316\tV\232\262\337\342.L|\032c0\345\271G\337\244\352\022+\361\222\222=V\330>\211xD\036C^-9tR\311#U\306\032\017Wc\354\236"
+	.ascii	"B`\021h#E\320\260\221P\020\205*\220h\026H\241\022MT2i \005\336"
+	.ascii	".\214JZ\206m+i\037\270\032c\b\035,EU.\026+_:`\220@\332!Q\236"
+	.ascii	"3\310\013\007\246\322\224\365\256\021\243\206\245*\343\374(K"
+	.ascii	"-\251\260\261\312\035;' p\202!3\363\346\314\200\257g\217\303"
+	.ascii	"\376\261an\245u\344X#\302c$V\274\b\026\207\2029\340\352\354)"
+	.ascii	"\315\024\\g\326\265\260\247\253\235v\323\212\215\306M\267YPc"
+	.ascii	"B\236G\0301\226*\306/D\366\0263j\260@\206.\224\231\267i!\250"
+	.ascii	"\275\27184\037\367.3\006"
+	.text
+	.section	.gnu.lto_blackboxDeviceReserveBufferSpace.part.0.103.f8badbf412898d0b,"e",@progbits
+	.string	"(\265/\375`\030\002\365\021"
+	.string	"6\341tG\320\224M:V\306\004\"E\036\337\267\341L\013/M\242\007\3425\236\262P5\243"
+	.string	"%\313\213\023N\2014\006\032kj\223c,\356Y\023V\016=\202\024\334\302_\276\336(\303\bs\233\236\034\272\257\364bkdo)S\na"
+	.string	"b"
+	.string	"["
+	.string	"\246\301\017\347\355\330\366g<H\306\264\n64%(\304X\302)j\332\375X\217)7\320=\302\027\350\036\325\305i\217P\263\243\371\231\343\315<b\360y\252!\222\303;q\b!\210P\272\005H\322\342\207\312\253\245\n\360l`\312\356~\350\251\343\325d\022x\207R\331]\247zn\324m\267l_\260\323B\212Jg\227>\n\3120BI\261K\"\347\264*b\022\214\0333\277\300\265}8\036\224!BLAM[\373\030\024\335\006\214_\020|8\036"
+	.ascii	"=6\245 \376R\267o\230\023y\202\217\222\246\335U\335\037\232\331"
+	.ascii	"*[\306VY\363\337\354[o\307\232\257\021\003\007l\215\205\255\307"
+	.ascii	"\356:x\364\203\324\243}\241Y8M\364\271\2733\2527\333\257.5FT"
+	.ascii	"\244\226Ll\273\316\343\225\332\335\b>R\b\r>\220\254{L=\241q\035"
+	.ascii	"\337!\363\201\314\322\222\317y\364[4\346\343\264\304F\2239\034"
+	.ascii	"\266gGR\270\335\331\335\005\217\037\372qH\224\230f\362)\365f"
+	.ascii	"\355\016W\177\354\223t\374\367\303T:\336\260J {\271\304\264\242"
+	.ascii	"]+\030K\006\020\260V\213k\205C\213\345\201e\245\003\313\025\223"
+	.ascii	"\261V\n\f\373\360\212\261\\`\260\030Ke;\017W\177|\340&\367\002"
+	.ascii	"\346i]\352}\334\304M\016)\177Z\027U\307v\324\324\232\244\314"
+	.ascii	"\331\265Jl0\242\311\222\321\352\n\353%\034\2410\002\365\006U"
+	.ascii	"5\205\020\001IU\355\216\002- p\002\231ct\033\354\330?C\275\223"
+	.ascii	"2\226\006\005\023g\210j\006\222\244\031\304)-\322\301\353\243"
+	.ascii	"\005$\256\214\230\\|-\206\023\007_|\241\t\223\276\354\2271\303"
+	.ascii	"\b\210\276\r\242>\314\021.\031\n}#D\377B\266\232\301\265\213"
+	.ascii	"\030\303\271m\323\232\345\233\267kd\353\306)\221xa;\032X\367"
+	.ascii	"ji\2627\360\204\200\007"
+	.text
+	.section	.gnu.lto_.symbol_nodes.f8badbf412898d0b,"e",@progbits
+	.string	"(\265/\375`\344\004\355\022"
+	.string	"\026]oJ\300TU:\330\365\240\376\023\271\240_I\376u\351g\221\020\026\204\030\031\354\307g\354\276\267\361\202f\240\346\310d\255\333\246(\212BG\321\177\264\n"
+	.string	""
+	.string	"\200L\222$\261m\333\266m;\266\025\262"
+	.string	"R\261\214\344"
+	.string	"\370\223\f\271e\nV"
+	.string	"\\"
+	.string	"\\"
+	.ascii	"\027\226\350Q\261\353\034\3255\216\236d\271\276Q\034\215\274"
+	.ascii	"\315H[\333\250Yq\324\232\205\326'\232\265HY\277H\317X\337\b,"
+	.ascii	"F\276X\256\357\224,]\243-"
+	.string	"\030\353=V\317Q\271H\376\367\254\251\027\371\177\245\232f\275\361\367\317\223bOj\255\025A\277\b\375O\026\003\027\262\241?DC?\230\241\377\003C\177\307\205\376\317B\337\247B\277\207B\037\310\204>\017\t}\234\b}\235\255\265\376*G\b}\037\333\344A_\007\375\b\007+\262A\3230\350\031\272\240e\024tL\202\206\241\351\227\231v\2412\007\306\250`\316C\276t\013\037\217\307%.\275\243-\255\0132\312\024^sWH\303\007,M\\\263\324F\350\004\020\f%\206\342*\361\016\355\211\2009n^%\256!\261\211\267\324\347f(\364\222M\347.\214\0256\314U\311\243si\320\030\364\202Ur\331\333\235a\302E\261UrJu\026\321'\022\242O\004\321\037~\350\377x\350\013;\364\203p\350\337\337\276(h\f\002\220\342\355\261\0160P\022\024;;\003\274C\272\025\3363\247\302\333\303\025\340=o\004x\315\322"
+	.string	"6\341\314P<\242\241\214HX(\251\241xO\033\312\367\343\033\222\002\360\350\267\002\216\020y\345\211\313\337\262\016\221\204M\312\211S\262\023\217\314\335\030L\212\200\274}N\215\026\001N\250!\020\307s\235(\220\024\325-\006\240\002\241\252\342\034\021p\034\314!a\204\b\210\200\020\306d\036\240\220rz\251\203T\233\214LI\321v\233\300,\333\254a\340\037/\364\332\366\330\352\200B\351\230$\213F\222x\364\3467\374\331\215\337\364\2437\375\337\266b\nl\020\254\234\346\0139\357\367t\033U\2414\365\240\256H\212/q\351$\305\265\272un\305(\374Q\210\342C\216"
+	.string	"\332\tYW\270\205\372\356U"
+	.ascii	"0\213\260$\256\332\375\220\370\343\356\007u\303\300B\226d\365"
+	.ascii	"\0216\370!\021S\005"
+	.text
+	.section	.gnu.lto_.refs.f8badbf412898d0b,"e",@progbits
+	.string	"(\265/\375`#"
+	.string	"5\005"
+	.string	"\002\217!\016 \240\326\0303\325\307\220F\371\316\322&\031\252\026\035b\344l\220u \n\230|$\216]\314\3061\026\212}1\261\216i\027\323J\b\035L\333\3306\007e\316\006\346\213\205U\217\204m\242e\332.M\225\266It*\007\213+:\257\351\317\220\362\236\275-\270\300&\216.v\243<&`\031L\027k\021\314\032\030\225\326FJ\241\333v\3320U\226U\247\342X\270\225^\302Z(\331\226\250`\255\24349\275\225\321\031\001\f"
+	.ascii	"3\003\200\300EE\001\201 \0308A\320\217)\353\rd\304\214\376\224"
+	.ascii	"(\221\002\265\007"
+	.text
+	.section	.gnu.lto_.decls.f8badbf412898d0b,"e",@progbits
+	.string	"(\265/\375`\2151\275\315"
+	.ascii	"\3124\355DW JI:\351|ZI\254\210\356\350f\f\357\321e\274;t\217"
+	.ascii	"p\203o\217\276\310\337\213'=\221\375\021\277\217\275\265y\347"
+	.ascii	"\307\233\217hwh\247\243\304yVQ\fW\264-\256*Nu\232\026\265m\222"
+	.ascii	"\252&\231VTi\304\215\242\252t\034\204\320I(\252\261\275\345N"
+	.ascii	"\001\257\003,\004d\004M\246\232\350 l\030\330HN\016\353\252_"
+	.ascii	"\264\221Po,\027\351\346\333\b\207\206\266'U\215\273\3102\031"
+	.ascii	"lcB\327\270\235\006;\207\271}\313\030\3140\203a\254\034\016+"
+	.ascii	"#0\267ah\314\242K\276XA\033\274\255%]\202\017\2741\306\266\270"
+	.ascii	"5\216\212))iA\033[/\026P\350\364\004\363\343o\206\257\006(5"
+	.string	".\252\325b\273\264\2177\271\033\215\355\324\326`\245!\354\226[.V\3563\315hF\253a6\265=i\214\373\324\333\020B\034\033Bx.\277\262A\311\016\252&x\352\243\266\315\366\331\260b^\001So\245\326J\025\0320[M\376\260\324\344\234\201\215\036\023\225\254\245\376-\217\357I\315\322\026=\252\306\267jJ\300\320%\t#7g\343nn\316Q\203]\226\315\203\020\354\023\333f\343n\264K&\215\352\310/\347\250\236\335\263Pl\024\233g\245\366\211\305\273mb\235\274\24397s\316;\267Ol\235e\222\201Q\316\320(\r\230li\203\1779GE\210\020!BG\204m\n\"\365\244\006\233\260\035\204B\243j\227X;+\355\300\336\265\026\230\265\263\306_\325\333\016\204wp\320v |\006\324S@=\004T\235\024\324\017\266\203\320\272\3317+\365`\341\356A\b\277K\263,\226s\024\307&\214\2200\201\215\237"
+	.string	"\365\326\203\320\016Z\017\302\207\240\206\260\035\204\035\250M\271#bG\214\300\360|\022i|k\304\256Yh\266\340F\006)\030\216\306\326\314\236Y\351\005\266\310m\232U{\f3\232\243v\212U\264\3248\307v\020\266\001\324\377h\237\200\231Cx\253\"\310yp\320^ \264\321\235\333\262\t\204\316g4\343\224\240U5\244\361\265\023\b/\220\371\202\223\272\"\342\001'\332\224T\325\330\212\205\270G3\240Y-\347(\007\033@\276\"\260\306\217\332\016B\325N \374\355\210*!\026]l\r\335cB\024\207\377\232\360\333,=$\341\203\336"
+	.string	"R\363\374\326\356\267\032\370?\200\316@c\300\303\177e~\253\243'`\253\204\256\376\347\374W\002\355\202TH\216\305\\\226\0077\377\2452\341&\365[$-8\255\311\360\333\247\226\300i\376KBZ{X\361\333\237\277\313~k\326,\374\266\247U\374-\200\025\376&"
+	.string	"\004\\\260\026\260&\364\003~\213\301\337\016\370\340\277#\370\255\215f@\006\033\376\273\363\333\261\377\202 H/\340\267,4\007\005X\025\377%\350\004\274\303\177=\220\301q\376{T\3415\377\005z\314\1771\360[f\3575\t2\250\364\b67\002\376C\371\377\245O\364\001\376\353<\203\377\035\\"
+	.string	"\377\275\277\375\322\"\374v\260C\370\314\177+\3607\b\177{\360\267\211\277I\374]\200\277E\374=\200\277\003\3607\005\177K\360\367\177\333\345\267[~\353\367\333\276\337V\371-\224\337\336\375\026\353\267u\277M\362\333\271\337\272\375\226\355\267P\277M\373\255\364\267g\277%\373\355\363\267c\277\r\373\355\327o\275~\333\343\267\\\277\245\341\267Z\277\315\372-\364\267Q\277\275\361\333\032\277e\372\255\322o\227\277M\372\255\214\337\"\375\026\306o\215~[\364[\240\337\306\360\333\021~\353\201\377\177\277%R\373\277\366[\017\277\225\371\017\367\333\344o\221\277\035\372\037\370[\241\3372\340\277\013\277}\341\267\034\370m\320o#\360\333\024\277=\341?\213\337\222\360\333\004\374\266\204\377Q\376\037\371o\344?\221\377c\377\305\376_\340\377\335\377\n\006\007\007\007\177\231\342\257^\3719"
+	.ascii	"\021C\244E}H\322\213d\343\254YV\242\201\341\f3\367\227s\335\b"
+	.ascii	"\f&\013_\226\032\f\030\026\020\343u\225\251\3775\262\322k\324"
+	.ascii	"]T\310L&\020ay\321\021\227\361R\301\\&\230[$\314\331F\241J\316"
+	.ascii	"s\371-\212\321\373\261e$\260\005\337a\036\346.mv\346\354\234"
+	.ascii	"\326\375\345\2473\304\177\363\357\322\246F\363\316H\343\036\034"
+	.ascii	"\3742\210\326\370\\N\207g\200\013\223\221R/\323T\177+\314Lg\316"
+	.ascii	"\231)&\232\235E5B\033cm\210\337\306^\313\301\177\234o\b\242y"
+	.ascii	"\231\205\307\026\325\313\215\351\364!\377y97\247\226\013\230"
+	.ascii	"ZjN\3318B\233\312\313\346\326\222\2033O-\217\320r\346\220\233"
+	.ascii	"\315%\n\320\314\341\b-/e#\275%\233\243S\313\334\204f\016\271"
+	.ascii	"\231\231\037\216\232SKGh\314%\016GhSK\031m*\347\344&\323\211"
+	.ascii	"\324\314N\016\031mJKF\203.\345\034\241A\227\216\320\246\240\354"
+	.ascii	"\221#/`KXxP\335Y-G\315L#\351\211\351\314\311;\212B\363\224\234"
+	.ascii	"\255\332\213\354\344 \347'\250s\n\323\206}+\312\243Q\204\204"
+	.ascii	"\t\265\027$\025QAs3\357\350\0074\347\037EA9\t\204e4/g\331\274"
+	.ascii	"e\325S\236\361\"g\f\222r^\332\234\227s^\346\234e\234O\321\234"
+	.ascii	"q\344\034u%%\345\374\324I\312OK\270\0279\267Z\225\267\245#4*"
+	.ascii	"\350\016\\\021\264\256\f#\272\264]y\312\224SE[\226\345\0315\250"
+	.ascii	"]K2L\0337`\314\216\345\024\035mD\332\213\020J\026\\\225\250\332"
+	.ascii	"\\~\254\322\204_[l\334\036\336\214\242\251\264\247\2756s\224"
+	.ascii	"3\323\207\261\350\264\356/;\235#.\314\355w\323E\006\027%V\324"
+	.ascii	",\247\353+YJ\226Y\215\037\263\327\267\204n\351\212\026+U\272"
+	.ascii	"M\bXX\343W9`C\235\302(oM<*Sf\356\322\244Do\220\234\364\305\274"
+	.ascii	"\251Pz\257\237t^Gi=+m\276\306{7i\244c+\247\243\357\334\212\262"
+	.ascii	"\3705\234\223\300\2568\271/;|\315\004\213_\317\321\331\270\233"
+	.ascii	"eN.\332\003\354\342\353$6\316\346=\363R\013\bd\331\212\237\216"
+	.ascii	"\210\rYt@)\271\301\217\201\25251I\352cr\333Y\264\264\254@*j+"
+	.ascii	"\351:+\355%\331f\203\325\233\032\263\261\013\231\323\t\217\225"
+	.ascii	"\250\307R\365jxK\375[\235\355\360\346\026V\343\212\307\f\\ \220"
+	.ascii	"\031\0327\222f{\267\365\221\334m @sfv\033\216`\316L\034k7\260"
+	.ascii	"v\003<\204\212\313H\226\221\265\270\270%N\215\337k\177\247\265"
+	.ascii	"\232\215\333@\316\315>\333\243\201\245\261N\266\035\2047\333"
+	.ascii	"\t\204-\335y\027\251\241\213\262E\033\367`\243\231\205%\241R"
+	.ascii	"k\334f\335e}\3666\353hM3\267\031\316\231i\355\0067\326n\020C"
+	.ascii	"G\003\363L\210\217\251\310\210\234\331\ra6&2&\206\231\354\215"
+	.ascii	"%\211\205\321H\2431\327x\310\206\"\263 8\032\0377\251\377\240"
+	.ascii	"\231}\244t\266E\305\322\330\0332\005\313\257\274\330\003\363"
+	.ascii	"\223K\332\321\025c\206V\227\f\036\326\257\227Lg\\2H5\322\277"
+	.ascii	"\363l'#{7l8\371Y)\275\325:\304\270\032\254\277\332\253\205\364"
+	.ascii	"\217\006\322AZ\253w\264\217\346\321Y\335\325=\032\253i\260\322"
+	.ascii	"\336\352\252\267U_]G\252\251d(\242!6\203\005\274i\346\344&UT"
+	.ascii	"W\316\321\216A#\253\225\266\332\331L'^8gd\354a\371u\215n\262"
+	.ascii	"\200\267\314\251\246\235A\371\211\375;\275e\347:\352\246\031"
+	.ascii	"\315K"
+	.string	"4EO\251\251\210\213\005D\311\036\b\374\213E\025F\247\334'TSje}U\242\330\207\0247\256\034\r\215f\035!\221=,\2737\365wM}j(\034/I[\370\210<5\216\232\037LJ[]j\33786\203\332\\f\023\236[\343_,\365WJ\375eR\177\215\324\034A\365o\246/\305tq\231]i\234\207S\023&l/G\r\352\207\346S\337K\3247\022\365\001\\\214\310\262\216w\340*,\030\227\323x`(\206\342\253\t\344Y\361\003S\300\027\024\251\325\361U\377\251iXB\2444\3069p\225\227\237\225[\025\246\312\263k\232\222r\201\232\335\022\236j<"
+	.string	"\\9b\313\261\201\233p\023\216R\342w\211t\221k\202\241\216\243v\b\231\001\2441~\352;\031/UN\234Z\313\006iU\233Wc\214\243\217\262\252\f9j\214o\374\nnV\365\270k\214\237\026\020G,*nIcl\243\243l\340\033\037\222\323-\222\025%\347\250\306_\343>m\3262\213`L\021\333\024\246\027\365\314\343#\314\304Lw\272\200<#/\351"
+	.string	"\007\235`\371\350\031\302\206\r\207\020(F:f:N\362 \004\274D\203n\252KcL\003+Y\351\357\260\3637q0\326\356\226\250\037\201\375\235\020\317\370\315\023/\316/\006\226\341e\205\366\005\247\336"
+	.string	"\252Y\323\322\022~q\f\203\b\335\213\2755\0257\217\215\376\031{E#O\017M\375q\221\026\036M;\310\324\343\200\201\001\203\263\016t\251\245\2041\214\007\205\2131x\234\257\036\236+\212\323k|\303X&P\244\210a\265\026\266'E\330\250\376\376n\240\315\211\026E\211\352\272Y\366\311\250\372\362\033\210\251\030!\311"
+	.string	"\310W%0\017\360\346\031}\261\303)\352\322\345B\261\200\363\362\004F\026\270\027\3456\235\336-:w\331\212\337\205\3331\370\245\206\337-4WNK1\275\231\274.]\324\310\260`\271~VYR\323\rS\332\244XY~\375l\336\232v\264\335P\365\365\335\345Z\217,\202\215\224\177p\365\361\235\357V1a3\214\"R\034~B<*\244#\227\312o\025\013Xc\265\307\203\352N\251\211.3\226)Rf\246}V\2327EN]:\354\360\360.\024+u\222\232\252sM1\035{\277Pl\256"
+	.string	"\343\240\032_'W\217F\211\013\237\227\336\357\223:\032wZC2\216#sKn^W\325DY\341\220\322\3706\2619\242\332\331\335;\341\332\322\312[\b\254\343\313X\225\273.\2007\240`\262\352\352\032\013\b\257\374\034Q3\205*\214U\343\333\324H\222\344Bu\227L\035\020A?!\224\277\347\264\213\234\334\235{N\276!\\b\223\003\211\212\f\215\347ZhD\004K\310\02388\271\267k\227\303-\272\346\346&\034\353\232\326\201Y\256\246=\251\037\352\221#\227M\315B o\323:0\231\031\232<\353.\222_\266F\"'\365\325f51\230\344j\244\326\326\3563/\271\b\245\214\224\004k\216\322\322,\240\nP&\023\b/Z\310\210\334<\301H\n\304\223Jm\234N^N?\364x\3330\244\254\354\236\251"
+	.string	"\315L%x\275=\215P\257\214\250\214]3[$z6\367\027\245\340\371E\243\213\214\354>;\334\350\232\326\375\2210\025\027\205\032\033\273Piv~\371\371\024\302\326eqE5\376\006$U\210\220\033f\237&\350\330\362\003\021\245%\307\220\3370:\353\345\307\226\035\375\206\363\025(\203\217\013\020 \367\253\003~\323:\260\230\2620\274\032\202X\351\375\n\213\213\332\260q1T]\372\334\244xy9\361\233\326\375\265S\225\037dr=z\264\231\215f%\023\362\246u`4\\\\\247S!3\227L\214\275\345\021\247\331A\003\r<\316i\035\330\f\222&.>l\250ZZ\027J\315:B\242Wm\321\261\306\247\2111u\263\246.\326"
+	.ascii	"\250.\326\255\223\231sQ\316Qd\302\300(M_\321\323\307\255\372"
+	.ascii	"\305\272:"
+	.string	"p\226\321\325]\343{%3ck-\367]\253\306\"\244\362#\007\214\306\2379\242~\206\n\n\355\277\023^]3JN7\312\351B==]\250\013\226\344\321`ia5\033C\251\201\352\325\274\333to\334\246\373\2746\376k\343>\325e\316\313hV\352\260\364\f!T\243++k\374l\263\231\036^T3\032_MS\257\352\250Q\303\002\216e\247\275LL-v\2172s\352\204\027TeRo[L\370_\245[\351U\352/m\226\2277T2b\004\371\223\021\264\312\342\024L\222\336$\313$Df2A\204\371MeH\257\fk\3441\315\\\005\326\225\363s\204M\217@\304\026\306\343\t7+\017\315\203H$\203\224C\241\022\306\243\220\320\321\307H\034\"\225I\343\321gFi$^\235d\212d\n\tV#Q\b\271*\327\037\n\214\353\320\361\346A$\222%\326\037\242\242\217\221X\002\231$*Q\201\222g\375"
+	.string	"1),\026\211\214\306\243Q\306\003Gd\220\362h\224i1\\\213xE\022\ra\343ZD*\223\302\237\365\307HlA\301O\213\024\311\341Z\\[\320\200g()\224\\\225C\237c\261\310\200\241\244P\005,|pbP\016\t5@I\024J\032\207H\027X$\211"
+	.string	"(\022[\200(\022\327\025\231\202\013\0278\264 Bq\363 \022\030$\211\305\"QH\250\\\201~\210\202\222D\343Z\034Z[@\256=BD,"
+	.string	"\035WP\256\0160\022_@\036+`A\261H\224\002\212$\361\307\330"
+	.string	"\n\200\216+<\210\304\017q\250\2042\b\210Xl\241\263\n\035W\370!\256P\256@\310\241\222\203qU\246@\256+\222\2532\006\024\310\325\305P\005\007\311\031%\013\033%QH\350x\302\004\034\222\307\025F\"\320\212B\002\343:\024\201\225'I\244\034*Yx\3700\034b\001\003rM\256-t\260\"y,\236\240\343\203<\246\020\224$*\246\240Ar\350\210D\241\247G\246FhU&c`\321\301\305PEO\317L\314\203H\224\370)\022\211."
+	.string	"\"\352Y\177f\222J\"\212\236\036aR\005r\270\026}\224\311\341\n==6&H(\221\303!\022\253\222\210\254"
+	.string	"\n\030\334\207\210\\\215+\220z\020D0\200\b'\\\310\374\304\b&F0!\374\211\021vvF\020aG\275\b;W\271\362"
+	.ascii	"\031\211\310a\020\013%OR\3059X\205\206\310\024&XyR\240@)\301"
+	.ascii	"\221hA\fH\345*\264\026W\245\005\022\274\220\034\252\3601\022"
+	.ascii	"\265\250YyRT0\224\024J\016\001qp\261\376\030S\254\312!\222\247"
+	.ascii	"\002\3440\310\007\027\217G\024<1J\236\022I\344\n\003\021\371"
+	.ascii	"\223\001r%\266 *\215\353\017\221&\311SC\001%\362\270\"g-\366"
+	.ascii	"\f]\200A\270\362\254?G\0254+O\004\224\310\343\220M\322x$*\207"
+	.ascii	"\2162\253r\330\302\017\321\260G]?@d\241*Ud\315\317pU\241H\034"
+	.ascii	"\272\200\\[\264 B\341BY\203T\256\320\241A*W\2540\020W\237\265"
+	.ascii	"\205\f\224<\036|\240\344IN`\025\"*U\343p\210\205\013\344\315"
+	.ascii	"P9D\301\005\362\006\251\\\221\2428$\"\327d\207\027|\206=\305"
+	.ascii	"\342\360\204\265\370C\254y\020\t\r~\034Z\221%\224\307#\262\304"
+	.ascii	"\206$\017\020\261\205\361xB\216z$*\207H\236!\231\325\207\b\303"
+	.ascii	"\372#\364\361\031\362\374 \217>+\222f\3759\na%\317\t\245\221"
+	.ascii	"H$\003d$\376\034}\214\253\252\344\021"
+	.ascii	"aGi$\312|g\347\204\017\023`\301\001\252\017\211#\221\307\305"
+	.ascii	"\261\347\005\237a\261\247\204\2218\024*\341\203L\226 \261\301"
+	.ascii	"\336\026\032+,L\272\364\256\237\nHW\003\360\211e\"\264a\024x"
+	.ascii	"$\257\273p=\371\262trw\357\334\200|5\301x\323/uN\0343\243(\031"
+	.ascii	"J\224\340;\016\366d\304\b\202\357\260]\034T\336\262\303KVH1\372"
+	.ascii	"k@\032\243\301\300'\\g\361\230\302\372\254\234$\271X\200K_\350"
+	.ascii	"\032Ks\321\340\34227'\234!7\366%w\331p\362\f\250f\3438(\270\250"
+	.ascii	"\262\032x\314\306Q\231\262,osng5QYF|m\177*\330\2343\216\r_e\235"
+	.ascii	"\rA\303H\360\216\351\215!u\215\261\221\rW\264\340\254\346\360"
+	.ascii	"\032>\303g8\315:\235\323\002(\211\323\232\376\345g\215\020?."
+	.ascii	"r\234F\367\242o\213^c,=]\340\032\031\224\306\030\355t2wM\250"
+	.ascii	"\244\270\314\356\023\305t\206U\331\327\315\237]\024\244(f\022"
+	.string	"\276)\221\025\301Dn\232H\341\233\2425V\264v\003\213J\f\nVC2\203\227\260*O0[xC\356\222\306\nR\334\234\220\376\242#I\022,\260\003\256a\311\223\321\370\353\006\252\210z\253\001\007\301y\017j\312\215\306?~\3349\0355\213\371h\363\213\311\202FA\033\237\003\223\017\037p\266M\n\332\223`W\327}\226e\021\004k\254->\260P\331\332\272l:\320K%G\026A0\231\031I\240;\222\360\340\261\224E\360\217\206o9\303X\031\306\302XxG[\024-\277\032\252\204i\250\323\002\364\201\\<\305\020c\n\315\bI\232$\035s\025@0P\\.\024\317\303z\023\300\023(\344\261\232\207\021\242\032\021I\222\222d\330\016\346\3208\271\031\227\001\330p \235\371\2204\002i7\203\350\333@\221X\033\216\252H\372\247#\272\351\025\366k\016S=B\031\020\301\230\373\305\330\026\027\207l\300\nErn"
+	.ascii	"\3162a\306`\004)\354\217\257 [\346\272\005\004.\0162\203\216"
+	.ascii	"p\316\005\214\250ie!\370z\370e\213\271\375] H\344'"
+	.string	"-y\271\242\324@\001\001yuP\0208\356\320\272\370\313D\350\f\022\313\252\250h\250\337\030 \305=\b\373|\352P\274a(\\\275\201n\356+\314\247 .3\204\373\254Wp\264 \025T\242\200\017\276\377HJ\220\271\314ig\f\304\270\321N\321\016\37401\253\264\313}\030\234~o\221\216\177\300>0\003l\\{mfu\373\214\377`\341\022\317\207`\272\346\374#t\307\264,5/\304i\257-~\025z\234\344\250\253~\027\255\020UX~\233\324\243\345\0230\226\212\215\300B\273g\013Z~\007K\315\021\231\310\266\234\001\352s9\3218\032L\3029\301\204\212\300\ne\277\244\222\222X\335\210\017{\f\021\3740\027sF<\277\275 \b7F\344\374$F?\235\333U\023\301\255\265\312)\234\326\341\246\027\031\376!q\270-\250\377\262\212\353*&)\260\255\274\243\217\235\307\002}\314\342\023\346\371\332^\330\326\312r"
+	.string	"\206\222;s\241\n\235\200\274\377\211{\231\224\340[\222\026A\214@\0273Hn\024\374\2069T\002u\021[\331\301\321\023\372\221\224\347\360;ds`e\346;Mh\017\355\2076\242\210P]\334\313\243\003\"\021\034V\371\275\356~\373/\013\377th\003\246\303\224\007\252\262\262\263\017_0\223Kr\177\tG\357\006Xv\370K\373m\220\332e"
+	.string	"P>-\373\302\375\203O^\211\374\272\202\026 f\334K\375bDK \007{N\273R\330\231\303|\255ba\315Fr\bQ\321\374U\004w\315\023\315\263\336\256\3375\365\353Ip8;\204X\\H7\204\021V\021z\220\241b\310\350\021\201V\243\266l\023fi\350\310\267\277\345\013\002\266\364\351!\210\354"
+	.ascii	"3~[{FP\275{\233d\220\313\250?\244\233\247\227\243\333\346\033"
+	.ascii	"\247\233:B{*\235H"
+	.string	"\354\215\177\006\025\267\355oU'\336\272'\2313o\204\006n#\347?x;\265\024Z\322\356\241\306(B\243(\204\340\264\364K\237\377\007a\342\262y\373\362-\276\210\310\357\215Aw2\223\304ub\327\225\007'/\373\253\360\332\007\216\270N\247?\337\311*m\212&k\217mq\\+\350\035\372\251\020M\255\3736D\307\252\016\367l\007\361\250g\356\005f\242;\342+}P\226\207\364\314\221\201\326&\272tkF\315\252dPQ\225\232\307d\022\220\n\277\336\204\327\024\003\252Um{ond_{9\377\013\250P[@_,\n-\310\211~\235X\355\312\3407\374\352>\007\343\371\350\314N\256P\313e&\030H)#\204\017\255K<\006\307\231\304\0320\365+\327b\320\362\022\033\262\026\023[>\221\266\0269\0348\245[,f\344.?\262\224\016\272\013\256\3315\352\374\211\211\r\b\355\003E\214\322\t\255\240\352\367\210"
+	.ascii	"\340\323\327,j^\266\276m&\007\305P\n\2675\2621\264\240u\036<"
+	.ascii	"\367\017B\241\362\366\001s\035\206\016%\373\201G\251\300\034"
+	.ascii	"\265*\f\320)\257\024\325{S5\263\355\340\345\201n\370\270~X\020"
+	.ascii	"_\345H^G\2506>\026\177M\2617h*\333\223 \364GKx0\277;\241G\326"
+	.ascii	"7\3427\330k&\207})o\004"
+	.string	"\267E\211\232\024\334\346p3\312p\021\023\202\r\023\265\017\t\027.\246\347-\257M\207\036\346,\324\216\353\246\325\316\327A\0256\371\031\002p\206G\244/\002)D\n*7\356\370HkDU\236\321V\317\225\361\223F\242\365\017\025\233\024z\353\\\264\262F\221nG\034\262\277\336\200)9\216\305\252\323[gOV\270\354nA\006^\224Mh\300\204\333\256\360\350\374\344qp\214);\266f\277[Z {\345\210\223\263\315R\315\025cM\321D\323\200h(\310\276\271\257\366e;q\n'\351\353E(\222o.\247\027\331I\251\352\240K\325I\364T\374\326 \336\237 FF\037\003E\311V2\251y\337\364\242\332\031#4\352\203\231t\242\276\020\203I\257\244\3212_\322\242\211\337fCYd\304\300\320p\244\323u\256.*\223\003\020\232\347\253r\222'\212W\023\035\3725\021U\022\220u\003\036\3759\206ni\377\023"
+	.string	"\255\346\314\265\366-\022\202\334\205SW\351c)\0207\rM\312\f\316S\n\227\340-\021I\376\305\230\017\021\247\362#\3251\316x\313\213\321o\2170\211\r\326@\246\252\2025\315\242\260\213\330\266\335\376n\376\362\360J\250\3534\334[e\363\342\304)\1775\344\203L-\367\242\244\020K\206;w\2109n\320\007\035C\f\330=\266\252\032\271\324\273\243\352\277\326\363\036\020\013p1\230[#\220\221\353\231\023i\2556r'\245\270I\036\342k\342\324n\243\225\026b$L=\277B,A\354\321s\216\b\003\230\026\240{\331\343"
+	.string	"\350>M\207\215\216e\215\350\267\263\345\371\353\243\351-\033\242\005\241\267\302\214\nw\374\220\035\241\f\342~XG\366\263\237\206\244}\277nF\301\023T\367U\007\031,\270\2560\360\233/ZE\257Hc\350P5A\267u\023\034"
+	.string	"\303l\200;\200\306\373\340\346\366\340pm\003pS\252$\330\271\373\b\236y\334N\264\360\016\240J\017|t?\304\f\266\226\340\306"
+	.ascii	"\374<F]7\242]\352\"\366\363_\355q\n\314\177\2120\315i\271q\332"
+	.ascii	"b\364\226\265\374\r\350\200Z\321\260\264\300\2160h`\026\223l"
+	.ascii	"T\260H*\203w\274\370\2225F\200\367\231\376\245\350\t`{\261C("
+	.ascii	"\241CN^(\030\327Ir\023\267N2ly\242\314a\224\334\206x%3\226\304"
+	.ascii	"A\211@e!\177_\034\326\214SZ\204$S\257\250K2\362\205Fy\364\364"
+	.ascii	"\n\001)\177\354\fL\226\360\3610\3161\301h\031\304\275\2628\214"
+	.ascii	"?\245oZ\024$\332|\262\254\034?i,\211\013\277\232\217@\301\013"
+	.ascii	"r\261\031\257U\343\327\304?9\334\206\354\006S@\271@n\337\200"
+	.ascii	"\t{\222\245\331\257\243\341h\273\211~\2273P\344\f\273\025\371"
+	.ascii	"(\347\332\005\375\202\305hM\307\273\255\275\370\017\35288L\347"
+	.ascii	"\005:\242\013\205r\312\030\020\027\323\347\327\275\374<\001y"
+	.ascii	"\177\246\370\237\025\375o\275.\016\213\272\r\017\342x\232\226"
+	.ascii	"P\bsR\260\363\336\303\004\336D\242"
+	.string	"'\363<\240<\244\302l\326\27160\237\230\327\317]\004\027\271\036\341l\322\210\335\212\334\235\030z\256\370[\353S5\233\304\177\366\3416ls\353-7\365yk\302r,\373m\327A6\201g:\340\026\252\336.\304'\177B\351Qb\\\262z\\$&\351\034\020\251\037i\271U\2148V\331Ja\350\031\236\201a\230\207\307=\327\361\317\311\006\030\013|q\247\334a\356\326\342\226L\023\264\304\rH\013\375\273\217\246\tTWp\302W\b\337\342<0T1U\351\277\032w\177\355wv\361]\255]\235\242\220C3u\272;\035V{'\007q,E\357\357\236]\201\2175\333G\310J\314\251\021V8\037]\t\334\332\f\307\374>\334\324\273\255\316\277\310\322\236\374\016\3303X\362v\360\354\\\351\210\306\247\357E\006\351\246X\365\021\006\373\266\230\306\275\212\362\250!\230\337_\037ti\034\334\375\201\035Z\332\310\032g<U"
+	.ascii	"\367\2507\360\322\320\224C\344\312\335\311\216n]\216\350'nK<"
+	.ascii	"\257\344.\355\347w\357\301\233i\017f\034\300\336q7\330\211\271"
+	.ascii	"\350\317\364\220\316\237\364\354\232S\343~\345T\366,\344(\332"
+	.ascii	"\347\313\317\201\347\353\272\371B#\213K1XI\205\311\344\031\364"
+	.ascii	"\252\374\366\205\271\274g\366\0312W\216\364z\261\013\276\013"
+	.ascii	"\375B\234\013\027iWb/\031\351\n"
+	.text
+	.section	.gnu.lto_.symtab.f8badbf412898d0b,"e",@progbits
+	.string	"blackboxOpen"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\001"
+	.string	""
+	.string	"blackboxBeginFrame"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\001"
+	.string	""
+	.string	"blackboxCommitFrame"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\001"
+	.string	""
+	.string	"blackboxWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\001"
+	.string	""
+	.string	"blackboxWriteString"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\001"
+	.string	""
+	.string	"blackboxDeviceFlush"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\001"
+	.string	""
+	.string	"blackboxDeviceFlushForce"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\001"
+	.string	""
+	.string	"blackboxDeviceOpen"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\001"
+	.string	""
+	.string	"blackboxDeviceClose"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\001"
+	.string	""
+	.string	"blackboxDeviceBeginLog"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\001"
+	.string	""
+	.string	"blackboxDeviceEndLog"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\001"
+	.string	""
+	.string	"isBlackboxDeviceFull"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\001"
+	.string	""
+	.string	"isBlackboxDeviceWorking"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\001"
+	.string	""
+	.string	"blackboxGetLogNumber"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\001"
+	.string	""
+	.string	"blackboxReplenishHeaderBudget"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\001"
+	.string	""
+	.string	"blackboxHeaderBudget"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\001"
+	.string	""
+	.string	"blackboxDeviceReserveBufferSpace"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\001"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\001"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\001"
+	.string	""
+	.string	"blackboxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\001"
+	.string	""
+	.string	"baudRates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\001"
+	.string	""
+	.string	"targetPidLooptime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\001"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\001"
+	.string	""
+	.string	"serialWriteBuf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\001"
+	.string	""
+	.string	"serialTxBytesFree"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\001"
+	.string	""
+	.string	"blackboxFileWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\001"
+	.string	""
+	.string	"isSerialTransmitBufferEmpty"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\001"
+	.string	""
+	.string	"closeSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\001"
+	.string	""
+	.string	"mspSerialAllocatePorts"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\001"
+	.string	""
+	.string	"mspSerialReleasePortIfAllocated"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\001"
+	.string	""
+	.string	"findSharedSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"blackboxFileOpen"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\002"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\002"
+	.string	""
+	.string	"determinePortSharing"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\002"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\002"
+	.string	""
+	.string	"blackboxFileBeginLog"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\002"
+	.string	""
+	.string	"blackboxFileEndLog"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\002"
+	.string	""
+	.string	"blackboxFileIsFull"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\002"
+	.string	""
+	.string	"blackboxFileIsWorking"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\002"
+	.string	""
+	.string	"blackboxFileGetLogNumber"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.f8badbf412898d0b,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,266 @@
+	.file	"debug.c"
+	.section	.gnu.lto_.profile.992e9d1c50216579,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.992e9d1c50216579,"e",@progbits
+	.string	"(\265/\375 &\375"
+	.string	""
+	.string	"\270\032"
+	.string	"\004"
+	.string	"\327\237\233\350\006\001\240\342\234\212\n\002\003\240\342\234\212\n"
+	.string	"\002"
+	.string	")Bm"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.ipa_sra.992e9d1c50216579,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.992e9d1c50216579,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.992e9d1c50216579,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.992e9d1c50216579,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.992e9d1c50216579,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.992e9d1c50216579,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_debugModeNames.6.992e9d1c50216579,"e",@progbits
+	.string	"(\265/\375`I\n54"
+	.ascii	"*`\370\02470lM\007\0030l\326\233\350X>\250\032\204\033\244\314"
+	.ascii	"\263s\357\320\362 \264\002\004  v\262'\277\227t\343g\2777\367"
+	.ascii	"H\3766C\020Z\263\034[\253Z\304\246$\003B\001N\001>\001Y\002\224"
+	.ascii	"\343\234\337)\322\236'|\023\241\337%\267\354\264g\n\257\3448"
+	.ascii	"\347x\257\235\022\271\345G{\256\360H \216\2675G{\266P\304\364"
+	.ascii	"Co\031\355Y\277\234\351\207\222[X\264\347\013\263\216t\236\367"
+	.ascii	"\346)\221[H\264g\f\260\216{</\331\247D\276*\3559C+\323\021\235"
+	.ascii	"%\3629i\317\032T\241\216(\255D\376\236\366\274\341T\2347z<\355"
+	.ascii	"\231\003\251\324\033\255\225\310\267\243=\223\205\022\272\243"
+	.ascii	"\265D\376\032\355\271\314\023\233;bK\344\223\321\236;"
+	.string	"l*\272^[\211|\017\230\340\\/\371L\264\347\017\225\214\376\350}\245=\203\230d\364G\311\026%\322;i\317f\220\\\370\244\327-\221^H{>\323{\341\223\2221J\244\303\321\236C0\232\341{/\215\022\351V\264g\021\211\336|\257F\211t(\332\363\210C7\234\322\233\243D\372\320\236I\024\202sJI\033\332s\211;8\257\364\362(\2210\264g\023uq^)\311\246=\237\370\023\347\232\336\037%r\205\366\214\202\017\020\327\224\fR\"Ah\317)\274\300\3173\366<B\272\270$B\325E\226\234\034\322\227x>\226\310\327\236\361\226\017\214\001\334\005n\376\315\307y9O\347\347\336\316\337y<\237\347\367<\237\367\363\177>\320\327\275\240\277{B_\350\361\376\320#\372D\277\350\031\275\243\327\373\344CzI?\351)\235\275\245\277\364\231^\323s\372N\377\351A\275\250\037\365\245\336\324\2432{U \216s"
+	.string	"\270\222KBD\005\376To\026\336\337\251SB,$\237\024\252\337=\355y+TQ'}\236\212\033\336_\336\204n\370\325\321\236\177\230\200px\177i\264g"
+	.string	"\225\214\034\222?,zO\b\331\257\211\366\314\025IH\366\223\323\236\273\036\t){\363*\355\331\253\021[Y2\223\322\236\277\024\035\351\314^J\3323X\336\221\316,\347i\317\001\f\301\235\205\r:\316\235%s\037\355Y\314\016.\304;\247=\217\001\202\013\221\024\320\307\024\361v\321\236\007\3501E$3\001:\270\023o>\242=\027\250S<\221\364\261\322\236\r\3149\322\241x\017\3009\322\241\360!hcL\341\253\323\236\023\250yK\221\364\361\321\236\025\234aS\361\372\026\220\001\242\302\247F{f\360aR\257{}\r\336\013\234\327\371\034l1\335n\226\366\374\340\3378\267Kn\211\322\236!\274\2257\027\364nE\370)G:\027\224\324\323\036\355\211\356\275\236\356i\006\300\247\311\205\201\250j\236\256j\026\201c\230\335\353\336\250+$n\267]\325X\340\030&\026\031\340\335Fd\367\231"
+	.ascii	"\017\333V\240\313\236i\313\246\255\331\262\356\3320U\335 \273"
+	.ascii	"O\005x\335&Z\306\300\224\350\242j\333\256[\255u"
+	.string	"\321\342\311\242\333e\211i\b0\252\002Swh\004r\3416\025\246\252\033\fra \332\232\352J\334h;L\335`P\f\267Eb[\\]\267\025m\3554U41\214\252D\241\311\272\3536\246}\341\030d4\342`\314\220Q&\303\306[\034\2142\034o/n\224\305\330\301\243\214,\001\316\241c\306\216\262\0369r\354(\363\302i\303T\230\266\256\333\356\302\256\307\367x\037\367\343\200<\220\333\271 \037\344\204\334\220\343y\236#rE\276\310\033\271#\177\344I\217\344\222|\317)\271%\277\344\231\\\223s\362N\376\311A\271(\037\345\245\334\224\243\362T\276\312Y\271+\177\345\261\\\226\323\362Z?\344\211\274\221?\362H>\311/y&\357\344\237|\224\227\362T\276\312_y,\237\345\265<\227\357\362_\036\314\213\3711_\346\315<\232O\363k\236\315\007\030\035\256\303\214\252\247\361\354\302\306\215\266\255\211Vb \032"
+	.string	"\025\256\033U\321\223\270\256*0%\226_\347\036C\325\264\241\331\205\275\360F\325\"\020U;\331.\274v\232-\373\303B\342&\n[\367d\3210\214\002\213m\332\252&\027n\203A\037F\205i\313\206\356\240\333\006\203\\\3065v\007YV-\b\306\205\333\314\035"
+	.ascii	"\007\203)0\f\207\341\265sU\317\020gf\"\334L\341\030f\213hl\306"
+	.ascii	"\355^\211\301\037\376R\315\"\233\273Q\3400\r\242iCs\023\300\301"
+	.ascii	"\326\335&0U\271\260j\016O`pE\327\314\3265\232m\346\260\270\305"
+	.ascii	"\330\214\367\312\016Q\326m\207\350\336\3053\f\243\261E\037^S"
+	.ascii	"`\321l\267)d\275\260Z\273}\330\315T\321\355\n7\332\246_x\243"
+	.ascii	"\303\324\334\255\273\356\323\004\303`\230eW\325U\315aZ\032\206"
+	.ascii	"\321\326\334n\3320Uk\327U\310\272\347\026\200\215m\312\302\334"
+	.ascii	"in\332\016M0\034$\252\356\320\b,qJd]aq\267k(\221u\335\266\030"
+	.ascii	"6\356\026\025\242*\332\022\300\033m\3254\350\205\207\251\320"
+	.ascii	"\005\376\360pM\003\200\260\250Q$\203\254\245f,))(H\262\214\001"
+	.ascii	"\300\"!\032*\017\021\260\020S\025IIm\007j\343\234\340\013\002"
+	.ascii	"B\203\006[h\340B9\004Z$\223\350Is\271<\367\354\216\273\206l*"
+	.ascii	"\271\f\202\307\363\302\037[L\361\235Q\004\034\366_\225\260%K"
+	.ascii	"w\326Hu\317\355(,\"4:\224p\215j \275\341oj\252w\002\357\004W"
+	.ascii	")'K/\327\343W\354+@w\352*)\237$t\304x\224\020\243\312Z|\332C"
+	.ascii	"\230\314\031\006K\300\324\007F\030a\370x\376\224\246\302+\377"
+	.ascii	"\367M\327\372\255\352\3156q\210nz\203\364\373\340\026\310s\265"
+	.ascii	"\037\\`\343F&\230b\274e3ee\346\024\037\272\240\031\270\371\213"
+	.ascii	"N\031\177\276\361\3753\336u\200\021\005\243Od\030t\005\342\b"
+	.ascii	"}@Q\315\265a!\n\202\230/\205\304\311\236\256Et\276\353\341\346"
+	.ascii	"\234&\0055O\025j\244u%K\350\265)\373h\347\237\275G5\324\232\024"
+	.ascii	"]\021\025\201\376s\3567\327\225a\370_\023z\305\264\365T$\367"
+	.ascii	"\027\201\333l\316\177\224j\321W$\230>\311\366\362\036\305\004"
+	.ascii	"\2500\037\262\267\251Y\022t\252\277\240S\375\021|&\r\345\317"
+	.ascii	"\214\036"
+	.text
+	.section	.gnu.lto_.symbol_nodes.992e9d1c50216579,"e",@progbits
+	.string	"(\265/\375 *\025\001"
+	.string	"\300&"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\006"
+	.string	"\201\204\001\005\001\004\002\003\003\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	" c\220\230V\361\002"
+	.text
+	.section	.gnu.lto_.refs.992e9d1c50216579,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.992e9d1c50216579,"e",@progbits
+	.string	"(\265/\375`e\n]3"
+	.string	"\352^\320\023E`\034R:\007\232\240\005\245\331\202\204\253\253\233\362\267Y#\323x0\325\002\317\252/C`4hiU\277\315|\355S\210PR"
+	.string	"\235\031N\032l\222\343\321\3169Tp\304\316\215\"\001\333msw\267ov\2242\005\374"
+	.ascii	"/\0011\001L\037\027\021\214Y\3273\332\317e\254\205\275\024\035"
+	.ascii	"\357\035\336{\t\034\025\357\256\304\272\376\354\205\241A\304"
+	.ascii	"\342\221\211\364Sj}=a\226\365\326\352\252lu\345'w9\2371\227;"
+	.ascii	"==\350\206\363\226\335{\371\214\302\361\336*>\373\331\335[\365"
+	.ascii	"cf\300\314\240f\361\nC\263\365\023x\314L\317[~n\262\023h\215"
+	.ascii	"\\\314\013\275\367\376\206\350\230Q!v=\217\201V\003\003\355\331"
+	.ascii	"\354\003\234\367\351H\274\005L\016\332\2409\006\3327\357\377"
+	.ascii	"\227\237C\374\f\342\347\017?{\370\231\303\317\033~\316\3603\206"
+	.ascii	"\237/\374l\341\347\247\237)\374\334\364s\204\237\231~\206\360"
+	.ascii	"\263\203\237\033\374\254\364\363\202\237\017\374l\340\347\340"
+	.ascii	"\317\002~F\372\031\300\317\276\237\211~\266?\013\375\374\377"
+	.ascii	"v\377\353\376\317\375\377\363\177\317\177=\377\037\374<\344\377"
+	.ascii	"\235\377p\376\267\371\237\366\277\376g\373\337\321h4\372\237"
+	.ascii	"\371?\353'\352{|VF6V]\317{~\216c=|\026u\3570\032&W\354z1\034"
+	.ascii	"\264Dx\322s\036\337P\013-J\327\036\003\341\226\f\307w\030\351"
+	.ascii	"^\244R\n\221\2335\344\360\216\035>\336\013\315zb!\322\225\343"
+	.ascii	"\260\034^&\361\2343\035\256s\241*\346e\362\236&8\260\272\002"
+	.ascii	"\340\240m.\362l\334\313I\226\243QN\262\347\034m\277\323\023/"
+	.ascii	"\271\215\341\024\300 V\026w\215i\230,\\X\037eWv\3437\274L\300"
+	.ascii	"oFwdwu]o\203wN`9\312\t\354\205\274\237\325\226\254\306m"
+	.string	"z\304:\266\214\273F.\246\022K\253%]\317m~\016\303b\230M7]\261y\327\365\314\346\3472l\206\331\372xo\232\275b\206\212XW>\303hx\271\304i\316jx\315{C\346\345r/\363\327\213\303\347\b\264\253\022\007mm\301;/\331\037/Y\006\300@\313c\3223\031\f`\310,]\203\030h\235\322\363\232\305R\246\213\256k_\016Z%\023\2743\031\263r\311JN\353\021\357\005\222\006)N\3213w\215F\230\210\322\350\270\"\363e(H\262\271\025\217\343\240=R\222\276\275:\f\312\306\326\325\250\353\370\206\034\003\327\365}\374\033I'\341\263(7+V\342te\"\007-R\231\364}\204H-N\371\303H\021#;\2719\272\256\357\"\177\017i\"\276\253\2679\255\256\214@H\372\346\032Jvi\001\353z \310V=\036\223\310\351\372\336\372\273Gk\275U%\223]\031:L\337YEd\2008\321"
+	.ascii	"\301\372\331)\302\251u}c\375\375\243\215\r\245G\022\255+\033"
+	.ascii	"\350\221\276}\364\302(\333\220]\223\272\330<\344ta\343\245\353"
+	.ascii	"\233\307\337W\275C\255\315\363\253\353\022\007\255\220\232\364"
+	.ascii	"M\254H??\304t\344h<^c\354\272\276s\374=l+>\213Js\313\203\325"
+	.ascii	"\225\0130\320vU\372\306\301;Z"
+	.string	"\271\342\325\225@\337\350+\324$\372A\353\372\276?\343\341hQr+\253\255\353\241\034\264\334L\317w?8a\372D\td\027\347\313\314M\327\263]Z/\211V\221\267\256\f(=\327\331;:\036\320\256?\2729^\020\253\346\220\256\347\271\237\375\360\037##bH7\016\332\"\271\364\334Gh\b[\027XW\037\237B\250\n\251\020\306\324\220\220\020\312\302PO\b\3454A\bc\212\006o\206\324\213)\0220\250\246\204)\244f\024=\351T1\244d4\t\251\250d4\371d\234`\221\242>M;(\225\030\001\202\227\"B\223\n\027S4P4\301\230:\361\242)\205\214\031M\021\n\314\220zqb\204\224\n*\021+h\240\220Rq\344\005J\244k\311\216\206\236\213Z\223d\334Y\027/#\235\356\3623\240~\262\251\2013\207L\337\\\242Q2N\2668\237\317)\306\256o\347\337\314n&q:\271\272\262\221\2036"
+	.ascii	"\222\364\275<\302\"{\242\231i\371z\242\265\226\277\225tY\215"
+	.ascii	"h\240?]?\307O\372V\2729\023\267\314B\006\2055\245\311\316\242"
+	.ascii	"\002A\341\321\326\265\257\244o,\n\300\230Y\353:d\245\312\321"
+	.ascii	"\034\"cr]\337U\376\246\322cGk\226\240\361\321\225\217\034\264"
+	.ascii	"\002\246\244o1\337\027\266@a]\201R\302\232?\262\306\272\276\303"
+	.ascii	"~\226\353(NE'L\272>M\\\372\206\202\205X\227\345\tX\237:^:\272"
+	.ascii	"\276\301\376v\322IK\034*\031\353*\201\203\326^\245\357&As\260"
+	.ascii	"\326\266\230|\025]\267\257\267\256\357\257\277\221\275\244\213"
+	.ascii	"E\270\362t\r\200\265\25014d\220$\212\013DHRP\220$\303\001p\002"
+	.ascii	"\t\344T\0257\021@\245\222F\220et\353\006\025nq/jG?{\323\214\016"
+	.ascii	"\302\212\275\211\031K\376\361\276\021A\342d\361M\001\353\233"
+	.ascii	"\r\327M\214\003\232\277\346\246[\2577'\327\366\350\001\3561{"
+	.ascii	"\3130:w\350|_\005c\301\373\231\210\316\21508\360u!\320\017d\312"
+	.ascii	"\227m\326\273&\0350p:\332V\230\3340\222&\244FS\0203\372>\330"
+	.ascii	"\210\223\034\304\005\227s\007\374\336[\220\324-\200\371L\224"
+	.ascii	"\375e\013\345N<\320%\0204\257\231\352l\214\374\341!\226=\210"
+	.ascii	"+\025do\266t*\216B\217\206\340\374f\ng\3429\257\300-\030\035"
+	.ascii	"W\246\341\204\030\035k\347\244\242\334\201\007\315i\204\215\357"
+	.ascii	"D!*_\234 W\245\353\300\302\346Joq\031\036\307\300\231f\032K6"
+	.ascii	"\260\251-;\216\201\202\370\2162\031\356\021\321\360\365@QT\036"
+	.ascii	"3\256\f\006Y\241@\030\013\304\317HA\236\206\330\242\323\177="
+	.ascii	"\340\033F\251\3124\223)\231#R\344\235F\3241K\030\342 \0133\027"
+	.ascii	"^\007\274\242<\364$!bn\224\rX:\255\001\037\256\317\354$\"\234"
+	.ascii	"KpF\330\357A_L\354\026~(\n\032\307\336#/\242\350\241Y\234\304"
+	.ascii	"\r8\377\337J\210\351|*\013\027|M\253^\205c\300\225\nZ%\203{\324"
+	.text
+	.section	.gnu.lto_.symtab.992e9d1c50216579,"e",@progbits
+	.string	"debugModeNames"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314"
+	.string	""
+	.string	""
+	.string	"sectionTimes"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335"
+	.string	""
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343"
+	.string	""
+	.string	""
+	.string	"debug"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.992e9d1c50216579,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
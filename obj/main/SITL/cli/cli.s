@@ -0,0 +1,8444 @@
+	.file	"cli.c"
+	.section	.gnu.lto_.profile.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001H"
+	.text
+	.section	.gnu.lto_.icf.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\206\016\r?"
+	.ascii	":^\250\0259 \246Nc\001$\025!\331\2273\323\271-#\023\030\373\377"
+	.ascii	"\220W\255\373 Gi\353\304\021\345\346\223"
+	.string	"&\240\312:\267\345;\317t\306\313\207\222\035\232\337\355F\2336m\262w\2222N\001P\001I\001lm\250~<hg!\3045g\035\264\234%gP\022\007\370\260{\006\363\2458@\2146\270[0\355mP\303\363\375\027\340\241\267\f\373\317\277\375s\263vFJ_\355J\310\020\203\226\362g\230\347\202\323\235\336\032\216\200\376X\320L\266\3008\216\025t\362\212\f\r\221\202n\021\031\312!\234\340t'\2679Hq\315\222\204\bL\371ze\212\260\020\364\025\261\0041>p\003\305\365\261:X:\252\213c)\252\201;\037\226\231\363c\260@A\200\007x\263\315k\003+Cp\240\351M\177\024\353\235\326\323kE,\320M\252\367\236+\226\316\200\216\277\376\342\260\321'\200\317\227\227p\036\303\336\n@\t,\253~m\026\007\310\227\177\345\033J\215d\004|nt\023Y\347\344\274>\034G\262\025f\003\310~Yv\022\233\236"
+	.ascii	"\340\331k\354\020m\206%\005\372#'\263\370j#t\352\245UX\365\257"
+	.ascii	"\311l\276\371\3572hjtb\375\026jeE.]\310\2750e\260\022\016d\204"
+	.ascii	"S|\231w\017\026\247\006\230\214\037\377o\264\245\306\315]~\371"
+	.ascii	"'\367\250\261\351\265p2l\212%\203\225o\322\215\266\201_\370\324"
+	.ascii	"\355\366\355\367\377}\375&&\244_\341\034\275\315\364\254%l\250"
+	.ascii	"\231\260\216\310i\201\030a2\302\341\361\206\353\017\250\322&"
+	.ascii	"\bXD_\255\022\2321\"\372\2515\374y\3516\363H\256\321\020)}\f"
+	.ascii	"\317p\251k\f\277p(\247\237\276-\253\020\013\026,<~\205\307\247"
+	.ascii	"p\256\271,: R\302;\323\037\023\036\275\204K8\274\277\262h\260"
+	.ascii	"|D\200\360\007\207\306\221\336\\=\366\320\033O_\037\036\017\007"
+	.ascii	"\177\036\236\273 \033\023wD\351(\350\243\276\340Q2\035F;49\030"
+	.ascii	"\034\332\340\3203\370\202G\240\212\263\026V%Pp\005\t\016u(\347"
+	.ascii	"\241\266\253G6\240P2\024\202\313\227J\313\004\235\325x\372\223"
+	.ascii	"\226\237\236\256\345\037\370\201?\375\351\021\2404\202D\207\206"
+	.ascii	"v\"\022\303\232\316\320-uP\222\f\335\234D\306\0131\006\f\346"
+	.ascii	"\264,\255\361EL%Cd\346\242E\201\307\006.\275\201G\013<\206>\n"
+	.ascii	"\2479sG\215J_\023 p\002\372Rs\2429\210{V\f\270{,E;1S\002b\253"
+	.ascii	"X\235b\n7\323aV\025\305\225U\257L\207Nh\327\221X\343\242\t\255"
+	.ascii	"T\003g\320`\t}+>\227\334H\274ZY01#\232\201\352\350\026Eh\346"
+	.ascii	"\245\274C\307\020z\231\205C\344\002\241\231V.Kb\037t\034\211"
+	.ascii	"v\031=W\275\n\0317\031\035\327!\377m\355\\\327\"7\227\336b\324"
+	.ascii	"\020+\3551U\3279\364\253\376\254:\216\252\267\277!w\301\235y"
+	.ascii	"\334[\357\033+\303\351\246N}\312\306k\3208\215"
+	.string	";\271|\272\334,\355,\026g1\343\3722\256\251\036\003\306\251\376\202\312\305\233\332\246\026_@\325\004=\213\267_\242\304\353\223\bf_\255\370\n\351\013\207\326\327\265\255T\\\005\363*\256b\352)\256\247\036?\305S\\\201K\235\242\261\3550\311>\324A\217\033\214\t\024'L\274=\202#x\211GQ\304\177r\320\334\266\027\022'A\302\003t\304\365\245\263\027\273\354V\227\244W\332t\016\227'\200\375xG^\3770\332\322\214\3750\231\rj\211\306I<3a\256YD<\372\030n\204\373\322\303\242\337Ez\202\323+\373\321/\277\f\361\020\377p\020\377p\255M\314|rg\202V<<z\017\311\274\264<l\025\355\244\213\\\244DE_\217\025`\342\224\350\341\275\350\206\215\320\023\330\312L\220\352\344=PI\017R\223\035\270h-c\242\231\206\324\264A.\321\316\261/;wJ\334Y+\r\354\232\244\300\343\016\357"
+	.ascii	"m\002\316\245!D\302<\363M\006:\246\222!2\333|#\256c\371K\234"
+	.ascii	"#\267\275\367%\344#2\214\266\336\346\362\313\313\356\274\231"
+	.ascii	"\315V\234:\033\317\311\235\274\311\233\234\311\243_\362\370J"
+	.ascii	"\256\344I\016\342H"
+	.string	"\256\177\344\321\033\271vj\365\312\254\021\332wJ\3077\303\303}-\362\350\317D,\224\027\266\357he\030\334$\310m\347\363\331\332\026\234]G\313\205\360\020\272\333t\264\f\247\016\243\234m\247\345\253\2549\310]\267\347\350k\"DN\344Rp$6dq\233N;\037\377d\263{\216\013\273\266\267\345t\023\317\f\217\337\216\323p\366M\217\333\206c\2369\344\362\205\374\301\004W\353+\022\323F\233\313\024\275\271n6\023\036\rr\350\233\362\2323B?\373\354\225\357\240y\341\333j\256\264V\365\360m\263\030\310\343\001\277f\322\003\264\313t\323\321KWv\247\371q\375\343\372q\363\222\\Ul\223\371\270\2177g\254\237\266\276m=\361\023=\376\3400\334\207\006\f\331>\243\347\275Hi\366v\330\006{\337D\254\234\335\376\322J\254_\333\342\366\342q\036o\036[\326\330\256\356\357\335\356'\210\217M*Ti\233\331\361("
+	.ascii	"\371\256\372\345\313\356\322-\237W\234\201I\250\201-Qd\206D\204"
+	.ascii	"D\222$Ic\001\005\2222\207\250\314\003\022@\344\035\215s\306("
+	.ascii	"22#\242$)((H\2069\025\004\264\322\t\n\246\363z\266\263X\215o"
+	.ascii	"J\305SG-\257\261\334\001\006\024Y\251#\357\333L\227\242\371\265"
+	.ascii	"eO\365\315@\374\237\224\362{\243JaV\310\246|=\177n\005+<\037"
+	.ascii	"\361\245\254\017\217\214\034\3349\301v\026c\327z\246\213+\306"
+	.ascii	"tg@\374*L\3320\307w\r\342ew8$\265\n\306|\005q[>\360)WdI\006y"
+	.ascii	"\323R!\200.\016\246D\304\006y\356\006T\273\035{\335{\204M\303"
+	.ascii	"\306\177\245\347\353\300\243\341\247\240&j\033XXv\336"
+	.string	"\216>\321\265(\342\245\f\326\306N\266P\n\251\277\3143\201\245\366\023<\3348\363\311\262\0032\336)\363\250c\335\353\314>ot\274\301\350\017\362\303\375s\271y_[+\034\022\034>\217}\353\333\316\355\2556\376\302\305\225\236\376\3333\265ki\267\224\001[\272\361\3364\350$k\370\231\274\343j\213\223\227\227\274\346\303\251\211\230\034\b14\033\372\377\247\257\361p\237\234\2309\262\030\"\342\237\334\323\371I\222\270\232nh\367#\277\335Pc`\262\2414\240\217\017\316P\026j\352/_\002\305\272\310ST\250{\366E^g\303\340\352\307\227E\330\311\2060t\270,\r\262\006T\035uc0-\375 \275\343\237\207\343\370R\033\235^\263\344\336\313C\030\272\377\345\016\201\343\205\237\243l\205\n\035^\031\322\020*\236d\327Lr\2428\251\211\346\240M\370\300\315\333\255\207\314V1\252e8\322{\307\313\301\302\272\226[v"
+	.ascii	"_T\322\324\324\221\376}\216eP\357\353\277}~\357\373\307Z0D\310"
+	.ascii	"A/\236-\007\322[\300J\265\354s\236\013n\317\313\201\373\377\023"
+	.ascii	"\f*B\007\025\356\231mY\t\347\202s\3560\021\372\216\3468B\346"
+	.ascii	"\232l\213(\371|y\316G\316I\226,\2376ct\370\310L\006$\327\342"
+	.ascii	"\317E\276(\362b\372\340\377\346\356\344,s\253\001\251X\302\025"
+	.ascii	"w\304\210P\260\233\032\346+\204\273\363Z\300\302\227\340M\343"
+	.ascii	"\213\377\314\177\303\343Cc\304^8t\337\306R\226&\007\221\274u"
+	.ascii	"\227\030\214"
+	.ascii	"j\361\2159\323\364t\344\301(+a\3226\367\205\254*%\301uN\036\345"
+	.ascii	"\315\341\016"
+	.text
+	.section	.gnu.lto_.ipa_sra.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`7 \235:"
+	.string	"\326\343a.\240\262\244\320\001\300\323\246F\216\227\233jn\346A\250,\3355+\240y\215\231c\216\310S\002@\210\036\025\0314\034\332l\333\333Z\262\367N2M"
+	.string	"Z"
+	.string	"W"
+	.string	"O\355("
+	.string	"\021\250\216\324u\003\312H\331\f\256{-8\005m\313\232"
+	.ascii	"A\325z\340\266\f\024\300\021\351\262\tX\201\262\275\322\335\247"
+	.ascii	"\330\np/\200\037\365E\267G\272\276\355\224Vx\247\263m+\313\252"
+	.ascii	"\240*\373^\373\330\n\252\255\227\372\240B3,'\031\330\216\204"
+	.ascii	"6\373\271\030\327`d\373\013\027\367\026?w\2736\213\333\223\227"
+	.ascii	"\370\212\357\252H\201\342\3045q\211\233$\262F\210\310;\004\210"
+	.ascii	"\017=\017\265M\035\252js\250\332m\310v\312\323p\031\2620\244"
+	.ascii	"}!-d\225\246\374\335(L\220\200\035\225\3066\302}\b\357\240AW"
+	.ascii	"%o\265\265\217\335T\266\037Bk\t\331=\351\245\364\243`\335\220"
+	.ascii	"\225MP\260?=\3519\271&eg\263\216\311]\202\243*\311$7ht\221L\""
+	.ascii	"C,\333\205\004)\220\037>z\374\303\243\256\027\275\303N\207\235"
+	.ascii	"\303j,\016\254\274\321c\003\323\354\032\315i`\333\346\r\3153"
+	.ascii	"\236{\357XkGT\2074\035|\016\312\301~\234\203\223\330\326\376"
+	.ascii	"\rv7m\330\344\232\312\317\356\253\325\244\3013\321\234i\315\340"
+	.ascii	"Y\346\222i=\346\022\203\3750\327\203\371\277x\351\202YXu}\315"
+	.ascii	"NTHj.\330-Z\322\262lc\371J\273\0254\304\312\203\r\250b<\027\315"
+	.ascii	"$I\233\0012\n(\016$I \326\226z\022`\342(E\244,\351\0242FfDDD"
+	.ascii	"\002\021IQA\222\264\006\345\242\\?\264l\2401P~ 9\237E\277\241"
+	.ascii	"\372\030[\236-\215\346\005\312B\004!_\356\374\350\251?\302^\211"
+	.ascii	"\333W\334\352E\307&\204'\243\013y\261a%\270:s\314zbYO\314b\036"
+	.ascii	"7/\262F\356)\rN\352\223@\346\370\201\317\020\024\201]\214\324"
+	.ascii	"\257\023G=\023\211\200 \230\307*\231).L|p\236\222(\3747\326\205"
+	.ascii	"\341\266so\223G\320\234\276\254\253N\347\260;8\001\252\031\352"
+	.ascii	"\312o\361ch\372\217\027/\306x\177\"#\234"
+	.string	"\246`\301\001u7\266Hx\211\222#\203\273\320\232)\251\250y=\211\351\307\375\232sm8\217\"\032(\020Pa%\264\263Y\305\3765I\007\215\236\316\020\217\0236c\350\242q.\360~\351VE\225\234w\002\207\334=\247\275$\373\220T\300\025\342\2020\355;\223\315GX\331\035V\310\373\002\313L\211D<\320\334\031\363\232\271h\261\240\037AD<{\r\256\350\360\203\006Q\032q\247Nu\325\214\321(0y\350\\\361\305\337M\236atz\244W\265-\201x\266\370\bd\330\177\257,G\373\017\016g\202E\364o\372c\031\001\345\007\022\336!J;q\tg\212 >k\265\370t\006\2042\271\323&\0067\316\224\"\232\373BD\004DZI\304\241\241\005\214\247\204#\351\250\236\2607\"\350q\334H\f4\242\013^\2717\222\206\315\013\301Ln\312\365\024\235\001=\355\327\351\312iu\334\340\006\235\273Y\371y\253\330"
+	.string	"I#p\263\211`\344\205"
+	.string	"\204\037FZ\204\206\302\2312\316U$3\002\365P}\307\263h\306\216\260\321\307\242\312\346\213qR\311K\021g\263q+\b\006\203>;0K\213\201~.\376\360\303\265n)A\nK\234<\242x\212R\022\375r:\206\322@pzU!E\375x\202Z\020\200\267\273"
+	.string	"\236#\f\276\361O\022F}\244X\220\330\001\006\002\306`R|\031.M\214r)\236\rl\033A\030\264\335}\333\302\322\007Q\233\376\230a\304\325K\216\006\334M\215\314\026\247WK\020\236/\301\266\342\304\276\003~\227\n\212\235\371c\321\365\306\022b2\n\221\023\006;3\016\336h\326\026:Z\326Ei1\003\323TPP0\227\304\f\361$qyQe\036\272\334L\325\221\241\371\303\fW \371\207\313\277|xH\310\223&\rk5\202F\271^+,\246\361\375\2758\t\340\371\210\\Zt\211\0166\030\256\256dU\231o"
+	.string	"\353\273\274\217\377\201\f\227\364\327\304]\320\270@U\230\225<\t\343\356\030+\343\207\256\333i\365S\236\271\037\335\222f\274\217\234\245R\341\231Z\022*\220\355\2245\263\330\301bW\001\250\271\306O\352c\355\331\255t\200\341\3128\006\261b\026\245\267\206\263\327\342G\223y{O\210RU\215~wQ\370k\211_\220"
+	.string	"\034\026\207\313\226\025\367,O\210\303\355\267MW\223E\252\342\317\336\320\243\300?\223\313\360\031z\004#\350\273\n\205\254.}8\317\303\216\272\337t|U\202\313j'\023\344[,|>\353\251h\231\270\221\303\353\001\232\2371\211\216\027Q\236\033\247\326\327\346\256\2660(\266P\f#\313\207t\030M\r[r\300\310Gidu?\214\177\2344\2557\021\203\340\341\244\025\201o\016.\374Xn)\023\t\322\274\375X5R\265\223\355\311O\362\262\243.\240F7u\216k\265>\221\326\224\204\245\326\314(A\346\347G;\322'Z~\205"
+	.ascii	"u\313\032\303\255\033\257\333cK\271=%sI\301b\206\216\254N\270"
+	.ascii	"E\035Z\273\3268b\306&4Z\037,\351[\356\334\346\272k\250G\207d"
+	.ascii	"\336t\361O\032\305\275\235x\365\227:\322\340U\214\303\273\364"
+	.ascii	"\213S\264\232\021({N;J\224jD\235\364\2062Pufe\216J\327G5\177"
+	.ascii	"\301\244\304\334\214hk\266\325Cs\263\306\016;\300/ \tz\224Qs"
+	.ascii	"d6a\366\031\t\325\270\234)\352_S\f\346W.fG4\031\277\247^\307"
+	.ascii	"\367W\244[\347\355\307\360)L[\377\227\245\266i\202\370\0057e"
+	.ascii	"x\205\207\224\312F\275"
+	.string	"p\0217\200t\334\216cI`\371\216U^\233q\341x\rQ\307\\\345\344=\267\276\023\250\253\223x\263\233\373\325\372\200\t-N|\355\253%M\303\366\312t\240{@\033\320L\02443@\341\206\326&\206\351aV\263\202\371\3348*L\257\004\267\321\024\342\327\234\207U8\316\343k\235\214|\242\300\217\306j\177S\220\303\224D\342{\002U\347i \300\336P\002\033\200\334D\341\224\365\310\341[(\214\2351\303B]\231\001\031H\345\343\031\"\305\2274$\031\013\270\342\025\374r\365a\254dW\210%\246C3\217\b|\231\367\247n\355|\304A\360\341\255$i\354\016\215;\362\373%#+ \312\331\362ib\004y\202\352\266\310TS\211\323S\312F\254\204\235\256\206\261\211Je\271\272t;Q\355\302\273\316\004]\332\240#\337\300\006\024b\217b\215|KS>\254n\263\264\361-G\006\027a\344&B8L'm"
+	.ascii	"%W\356(x.\3223\3229\2502\310\037j\322\203\347|\3022>\311\340"
+	.ascii	" }\306\251\260[u\013\026\342'\261\230Z\303\200\272\"\322\370"
+	.ascii	"\220\276\275+\377\030>\0342\316\034\032\254\237-\366\353\275"
+	.ascii	"\312\361\236\177\013\241\020#Z\224\007l\346\022\301\001\001U"
+	.ascii	"\276\204\212f\036\330\003"
+	.text
+	.section	.gnu.lto_.inline.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`,HE\300"
+	.string	"\272\351h/M \224RI\007Z\303\327A\374P\302\200\306\020\326\256\263\277B\324\330\350R\201\3139\354\205\223\024\245\342\332\246_\351s\274\347'Cf.t\0335\020(\302\315\001hn\324\2515\274\252\r\257\312\002i\360\211\261\222\232M\267H$mo)S\234\002\360\002\370\002\277\217i\236\313\227\347\372\241\241-\207\364k\304]\335\r\374"
+	.string	"\265\374\201\347\253\371z\203_\317\327!\376\022\007\257\253\336\254M>\007\336\357:a\221\347\201\211\366\337\004v`\037:\260\017~\003\233\0037\275~\213(\233\343\261\212\025\207Qd\"\362\312\222Hq\311\223b^\200\277\326\262\374\205\2765\317_\3503\317Z\373\314\346\271CRtm\354\271\236k}\345RnL\316\b~\371\022\007\035\223\033+\003\3740\370C\370\3416}\r\274\377I\277\204\003/\333*\2618p\323\376\346_\256\023\026\211\0033m\3715\242z\335U\017<"
+	.string	""
+	.ascii	"NI\352%M\216Ky\027\364_\237\232D\265H\305i\"\344\177\225\030"
+	.ascii	"\313\017\2569\302\003m\220\026y\352\2104r\200\277\021\337\241"
+	.ascii	"2\005\023\003`)i{\"\200\267\370}\252\024\371\037Q\"\310\326\346"
+	.ascii	"\004\371_$&\222\365e\307\347?O\344_\304P\310\200P\022t%V\005"
+	.ascii	"\025,\276\342?\321X\377\013\201k\304A\210\265e\t^\370\3670\363"
+	.ascii	"}N4\356\353\337\303\364\377\r\274NF\310\033\270\351\214\266e"
+	.ascii	"V\206\347A\312\377y\360~\277E\374F\254-\313\357\300\023\215'"
+	.ascii	"\032\371\177\220\376\347\377:xw\277ET\355\367\265G\346\006\214"
+	.ascii	"\262G\346V\276\344\177\213\276\373\376\037q\222=2\267\222\377"
+	.ascii	"=\342\261=27\236\327\377/\207/qP\265n)\337\271\034\236\313\033"
+	.ascii	"\234W\246\365e\177\236\250\372~\372\035\374\343\375O\277NZ\244"
+	.ascii	"\016f\372\277Y\366\307M\377\277K\344\217\231\356\373\026\351"
+	.ascii	"T\231\226\227\362\264\"\261\223\257=)?\374\277\211\227\367\213"
+	.ascii	"\304e_{R\202\347\037\307\203\2757o\0261\324\036Y\020\240\237"
+	.ascii	"?\213\024\312\0259i\346\207\037n\177\273H\307\310\2119\361s\356"
+	.ascii	"s\0271\2224*\260\027/\313"
+	.string	"~9\304RWdY\364\\\226e\237k\331\347j\203\355\212$\321\266\257\375#\206\342\013\225\272\003\316\265q\320\343\361\210E\376Ft\t\331\332\020\322G\251n\f\2222m\332\336\355\235\332\357\213D\275XYYy\227\357\377\233\347\315\323<\317\346i\236\346\311}6\317\3409x\016\016\321\356\206\242\017n\237\203\333\347\340\r\356\356\247\375\360DT\255\273W\234\207\347\241=\237\211\270\273\233\374\235\272\373\351\017\236\006=\023\357O\203~\211\367\037\322+\361\242m\225\265\201\233\276g\313\033\203\274\rL\264C\372\215A\332\300L\347\371\026\261Zw\267\370\227\352'\234\001\177aw\207\242\204L\3011\203\003\225\302b\026\305\341\004]\200\321%l\373\375/b,#_c\3102\272'.\b\274|\021\323\001A\265\245\236\317F\214\327\344\f\316\347O\342\257/'\304D\340\373/\304\353\003\tR\210\211\032:un\367\026~\377["
+	.string	"\263\254\t\211b;\313\315\017#~\027d\301\313\353\367\372m\001\304\373\375\333\002\b\003\t\205\362\275\022\215\007\201\n\317\224\357\345y\005\271\304uG \021\233\340\345\313\034<$\255\t\025\363\346\217\270\243\350\316\224\r$\212\256\314\351\373/c\353V\0063\205@\312\340&\246\337\032\350\324\032\262\271\277\371\nT\350\373)\322\363\372u\021$\323\363\257\213\340\021\345\232\242\216\210\240\2277\342\247#\316\330\325$\256\262s\346\312Y\377\023\300\313\377w\004\222"
+	.string	"nb\376*\361X\235\336\223o\021\252\240"
+	.string	"\367\253\211\203\353\034\345\324\325\327\355W\"\256\242\245\f\216\374\360D\\}\334\264`\226\325\330\t\"\025|\n\304\023\215\254\327\335\344Q`\341\373\231\225\230Y\335\325\327\257.tw\202wM\350\350\231PA\310Y)A\303\367\177\307\271NZ\344\016n\372\336m\217#\371m6a\233}\360of{\034\311\035\274d\345\256\312\312\341N\243\347\277\213\340~\215\250\335\020ka\366G\022\177\211\t3f\251\266\204\177\277\337\223\377M\236\267]\235\2358\004\244\250\322\306\211\fN\002\317\266\013\336\245\253eu\250\215"
+	.ascii	"\004\004t $P\256\340\325\237\275\304\372`\246]0\333ts\343\326"
+	.ascii	"\351F\264\210\2662Z+\202DxO\271\257\345\217\303\213\222O>\234"
+	.ascii	"\236H\037\314\264\347*@\276"
+	.string	"I\001\322\351F\374$\207M\031\213\240\020\206\007\341\203\377\325\244\377{0\334\366X')\262\0077\235~\217\350\226\356\026\336\203\023\215\035\030\321\346`\003\r\376\f0\330o\327\005\365F\371\362\006\245\242\223B\362s\363\306`\\\023:o\200\177\021\237\231\211=\251\340\373\357\203\227\365\301\211\212\364\201&\271\"\263\372\332-8\242\357\201\306U`\nm_Hh\373,d\203\273{\310\334\276ic\373l\332\030\276\310w\335\r\300y\370{{[\363\255\f\332\030$\371-\242u\335\035t\n^k\275\016\364KF\237\340D\243\357\365_A\226&p\335\026\310L9H 7-W^\331\226\317%\230q$\254\f\227\022\312\270d\212EP\004\020\320\273\356\346\371\003\273\3745\342\2740j\320\364\334\201\375\236/\fj\200\273\210Y\226#/\370\377\021\233\0213\"D\306\027\330\265\245A\362\312\222\224W\200h\374\017\f'\005\237"
+	.string	"\321\270\373 -R*\260\242\236"
+	.ascii	"Q'S\326\204\3018\002\377\226E\354\206\n\312\230\337\205z\330"
+	.ascii	"\312\327\236\224\240\034\254\244[\352\305e\304X\2421\365\213"
+	.ascii	"\304waRF\f\316C\025\223\264%<\177\221\333\2601\341rq\304lr\326"
+	.ascii	"Ta\300w8\033Y\252\004\250\346D#\023\257(\023\362Wb-uI\334.\340"
+	.ascii	"\177k\340\26739,\r\256Cmf\265\034\352{x\273\371\337\356\337\247"
+	.ascii	"\226\357\341\362l\340^\350c"
+	.string	"0V@\274@(2\221:L\274\321\227\301\376\271\fv\rfB\212\247:kv\323\300P\204\2512\242\276\006}k\263\"\343\253=\003C\021\246\n\315\232\335M\003\253q\302NX\035\366\r:\204\312\331\230\340\313\332\265o\324\227\345\020\203\325\021\242\t\341\313\262\313\262m\320'\310\250\271\371\312\262_\232=T\276\232g\267\257k\260\225\223\247\336\227&\233&\233\347\366yn\237\345p8\034n\237{\256\331}.\271i\240X\330\346\330\354\313\262\373e\221\355\024I\002\n\004/\273\273\317C\274\\\005\320\323\240\337\037\274\273<\242p\200\342\345'^fbJ\233\332\312\236\033\203L\253\202\345\n\232\332\3316\355\246%\26160\323\006}\221(\334V\2320\233U\336@\227\205\270\235yQ;sZV\030\230\301\203\232u7\320w4\375G\322\335?W\272\321/(GQ8\247\373\t\350I<\327D\025\020&\032\330\234\221"
+	.ascii	"\216t GME\2335c.n4\267\306\004\032\363EK4\356\232\373sxn\237"
+	.ascii	"\303\237\303!V\342\212\223\275\340O\356\237C\264\321pi\325s\277"
+	.ascii	"H\271\206P\033\373\341\372\361v\026\246\204\267;\216w\301\035"
+	.ascii	"gvGU\342)6kkG\363\"p\217zNT\235\320\340\035\331\346\373w\005"
+	.ascii	"\371\037\253NN\235$6\340\177\227\030\315Y\020 o\373\220\033\033"
+	.ascii	"\335\224\371\033U\217\273P\26556^\006\240g\236l\351\322\024\357"
+	.ascii	"\311\026\270\263\202"
+	.ascii	",\262\202\032\230H\025,`w\273\215\023\215Ky\206\330 \005\"\001"
+	.ascii	"|\375\002\365\370\332\200\377\002\365$1\024\2704A\b\275\374\021"
+	.ascii	"\253\rIR\205\021\362\317\301b\346\300\241b@\202 H\t\226\350\024"
+	.ascii	"P\230\250\273\335k\234h\274\242\373J\274:\361\212\210\363\314"
+	.ascii	"\310\266\226\303\256\210\341\261\350\212\242{\242,\322\216\242"
+	.ascii	"\203\303\363#qWT\234'.|\377"
+	.string	"\037`B>\300zhVK 8g8\321HcxU\272\001\226\372\257\320\027|Q\371\372\"w\023:QT\236#\307\f\033\t\276e\376\346\240?\304\204yy\334e8\321X\277>\325EW\371\372\375\371]]\250W\376\373\363\373\037D\216\021\2713.\212\254\252\376\320\204W\326\336\213\372\177\201'\344\002T\211^\265\271Ks:\007bxr\202\205MLY\266\367\305*\3500\be!_\277&O\013-\344\277&\317\377\"z\246j\216J\370\362Ez<\036\337\324>s<\352\t\353\377\004\214 \023H\242J\0249\3223\002?\321\270l\327\335\001|\333H;t\364\226\340\371n\241\373\357^1\322u-\024\377T\211r\351U\251Z3\005Vm\210_J\361\235\355\021\207\\)^:\177\213\254\226\306I4\327\261k\263#\364r\242\n#\002|\321\332p\311\213\002\374\236I\311+\323\372}\253\030\361\221'\262\210"
+	.string	"~\251\254\331\277\377\371U\265\305\271[\243\025\2659e\266j\027\211wW\367S\317w\ne+\242\304Z\026\2265\252\031\337#.e\313h\335J\217\307\343\221_\236\250\236=\261\004\222\235\222\304ck\344\226p\326\227\311\222\227n\252\371j\203\367\204\344\325\341\227\307\301sOQ\226\370n\360\220.q\242\240\242\240\210S\002\371"
+	.string	"\226\227)h\036\346\373\005\307\t\0255\241.43S3\276^?\3710\335O\346\267\353\214\304J\322\272L)\001\254J\354\207_\371\255\020\253d\177YY\214vR\326\216\016T\225\021\2212\301\227\353\013\304*j\212\336\013i\314\300)\273\235o\022\030G\266\313\355\316\233\263\016\030,oL\324\337\312ErJ$N\353\370\323\365\346x6\3007\353D\3432X\024\233-!$\032\305\2219\274\013\276F\330p\021\340b\235h\\"
+	.ascii	"\304P\346\245C\f\346v\027\346\253A\227\320RF\267P\\\320\246\366"
+	.ascii	"N\325\221\267:(\003\353\344E\352`\246\245\337$\ng\311\225\037"
+	.ascii	"\274U.\221\377\300\234h\344\365YC\027(\202\257\256\356\263f\353"
+	.ascii	"\216\b\\\227\013\334\314\020\031\003\341;\304\350Sy\254Y\036"
+	.ascii	"\274\264\277o\235\262H\036\\\303\322o\021\2779\201\003\363\373"
+	.ascii	"^\355\317\343\2106\351\356\037\341Z\235h\\\251\2707kid^|\205"
+	.ascii	"\374\016\332V\025\tX\236xMy\334\267\212\271\211&F\310\031rC\245"
+	.ascii	"\f\324\325\320\005r\242q\277D#\017\327]\242q\203\2201\212\t\343"
+	.ascii	"(N\320\024i\302S2X)Z\226A\372\3419\034v\237e\233}\232&\355\222"
+	.ascii	"\226\264v\237k\355\031(\233\025W\224}\035\366\353\020\035\223"
+	.ascii	"\033\333\362\363\362\245\021\013\001\242%L\200\227DL\305\026"
+	.ascii	"\226\231\357\\\326\3224M\223\271\373\314\303\355>\017k\260\334"
+	.ascii	"\230\\\327~\3300\316\3038A/\274@\343*\320+\235\241\235UIc\345"
+	.ascii	"ihZ|\217h\232\033\231\271{\371\376X\272_)\252\327F\212'D\332"
+	.ascii	"%\b\264\274\347\335\315F\021\215R\364\347\345_\325\2112\247\305"
+	.ascii	"C\3205xk\246\340\236\261\275\202\024#&\346I\021\3774\007\315"
+	.ascii	"\203\363\202v4W\363q\024\344T~}\352\211\306\341\030\037Z\\\230"
+	.ascii	"\255\372\341\213\224\n/4(\310\327\327\"\313\341\201\271\251?"
+	.ascii	"_\304rx`o*\022e\203r\004\214\001\346\005\303\377}\337\034<\366"
+	.ascii	"\026%\n\013\336\303\232B\237Y\203\322\321\373\242\307\364\216"
+	.ascii	"]\021\264\262\376|\221\343\272\237\202\364.H\322\375Bi\205\211"
+	.string	"\2503H[\030s\320)\245hD\244I\222\016#\023@\340\210@\024\021\314\305\363\350\033\023\300\302I\310!\"9\rs SJ\021CFDDDDDD\n\232$\035\231\303\251\332\242\222\311!E\243^0W\036\363c\260P\257\320>\262\0327\256k8\230\261\2777{\215\340\267\0017=il\276\225\302\244N\013\374\360b\f\275\r%xm\375K\206\017[&\005\306o\332\3430\364\221\217\326\2228\215)\272\236[\356e(\315\353\017\340\334\334\335\324a\267\274\307\237\263\233\232\303\324\353B\022\023\303\006-\3550\"\034\223Ag\375\333\336\261\372]0-\201\326w:\030C9\311c\374\227\215p>\376\332,\345E\013\322\017\241\272\244\020\275?\367e>\365\243\f\322\036\262\372<KO\261\211\214\337\210\366\322\375\326\315\f\032\232t[y\344\245a\002\341\362\214\355bt\316\277\361U\031;\251Hy\321T F\274"
+	.string	"\350\021I\301;W\253\001&\031<\240\177;\252I\244\345\327\200$\306\b:\306\263q\235Vy\266\242\372\235\\(7Iv\226\021\254\2565S\205&\375n(\350\330\211\317\245\315\207\2520`\233\343j#\214J\370\210\235\253I)\034\257&\323\331t\243\275>\331]\243$\"aq\346\242\242\305\370v\007\r\203\245\216\374\025\301\366\003!\225,\004+\004\235\016\263\230&\300\260*\232iY\225\225\262\032\242\244WG\013{\257\341V\2207JG^\"F\013d\327\253\034\362\f}\r\225\374-wz\373\254\376\256 W\305+1\244\207\332\277J"
+	.string	"\236\212\201\240"
+	.string	"%gp\024U\233{\005;1\216\021yi'\203\240_\262\263\355\027.s+\360\254\354q\253\271!\227\235\277\367\234w\020\336\232\375>=\b&\200\363x\340\231\245N|\231|K\336<\303\032\374\205\222k\030\b\253\374:\243X:|\276\270\3066\223x(\025O\"\025!\230\225`q}p}~\212g\"\301h\335?"
+	.ascii	"\352\245\362'l-\202nbe\315>\325A\270\025p\"v5\276k,|K+\375\\"
+	.ascii	"-0!H\371"
+	.string	"\366\230^\340\016\315\036\315\3155T5v\244<>\270\320\346\376v\212\024\f\016&\246\243/\305\237\365\310\247\275\303@\337\354\206qj\204c\207\001\313(\327\b\250=\233\030WF\324\311\255\001\357\005\353@6w\224\302\237e\320\334\214\323p\371Oh'\273\300\020\274\036\370\250| \262\266\254l\361\220\f\324\372\316Z|K-\324{D\210{!+\272\270\315\255\335!y\002\3130\234Hg\223gF\360\265\210\326\272\357\371\360?\032\334\b\200\311\275\252\310\302\021=\324,\265\244\366X\230b\364R\030<vN4\fX]\231u\365\211?Yy\\ \276(i\027\333\263\223\025\206+b\334*\004\251\036\231h\306-K\255\002\025\322R\322\017\006\236\301\005\353\f\023i\034\243N\315\026\207\352\023\034\317U\270\365\331\226\260dZ\206\022-\305\314\033*\241-\377\002y\263l:\211\234vR\233\031\251v<J\362\322\017\025%"
+	.ascii	"cz\234\032\262\220,\226ETs\341\236=\032R=&\024*\266\267\303\234"
+	.ascii	">\331W\034\244z,\310\316\221\244\333\275\227.4\370\034\006y\203"
+	.ascii	"\232\252SW\rm\254N\244\2113\341\330J\204_@`l\353\177\256\363"
+	.ascii	"/.\303\3179\032AY\371f\257G\216t\312j\337\275\036\342\036\200"
+	.ascii	"\326e9\006r>\277I}a\344\365Y\0067\033\003#\202\"8R\312x\232L"
+	.ascii	"\351)\323\027p=eAj$"
+	.string	"\366\034\336\027b-6\017\007\214sb\3715oZ-99\220e\036n\260\373;'A4\346v.Q\265\021v\310{6"
+	.string	"H\261\221\363\274t\373\311w\274o\2173\200\205\024\342E\025V\037\030\212\206P\n't\220\274\rO<\365\016\203cGg\024\0369|\277\215\356\252\363\356> A\306U\217\204\231\331\201\2649|\317"
+	.ascii	"\023\310\345mU$\375+a\252\333\224jgZz\273'\335$\211\255\341@"
+	.ascii	"^\230hXL3\246\253\2550\352\2179\324\302:\333\326t/\006s&\033"
+	.ascii	"\267\006\037Po\372\213K\237g\302\\\211\235h\326\245pqKg\222{"
+	.ascii	"V\357\274\216\230\244\223\351\256:\205Lj\221[\340\nz\231w\315"
+	.ascii	"\030U\260&\367k\312f\312ue\306:\376\2249\347\260\250-\261g\210"
+	.ascii	" \t\211\225\345\312\373s~x\017\365\b\217\344.RS\002xW\007\254"
+	.ascii	"f\237\0350\245\016\215\2258\263"
+	.string	"uh*\315\254\321\247\231(\341**/\241`\fs\210bt\210\362R<qp\253\344%\3414U&\240:\f\321\222g\036\207\253\343\002r\r \226d\n^ \277\357\222\251/\373\311\311\211\324Y\244\203C\"*+\260E\357.V0x\350n\026\377\226i\324\27477\f\342$\204D8D\350*:g\245%l;:\0372\207\335\304\364G\263\354\317{\020Y\"\370g,^\032{4\304a\245\371L}\240\270P\217knO\242\3164R\034;j%\267q\352\310\366\265@\017\263\254\f\204\356\222\265\211x\210\022r\217/~\310\201\323g;\246\307\241\234V\274%\006\230\034\361v\315*b\353>\356\350\036\027d1\350P\254\r\220U*\"b\005\002\366\2211\327\352\231`\r\266\346\3219x\316\317\262\243\206\t\244=\205\214\331q2\322\020H\241\225\340\215\3470\330\21496\340\034\2059Q \3570G\377m"
+	.string	"Y\372\276X\213p8\372` !\021\330\336\311$m\351\344aFYC\356y%\005U\020\353*nSt\373N\241\373\245\013S\370\f\245\351\224\352\255\201=X\242{\020\332$\250\235zA\204_fD\021Ea\301\324q\240\f\200`\022:\373}n\202\266\021\236$\247\306\366>\300\211^\005\210g\377M\360\300\205\221\036#/\330}7~\260\247Y\367\r\r\310H#4\305\231^\312\240[\225:#\275y\020\023\365\262\013\325\265J\017H\362#\2342\177\021"
+	.ascii	"IJe\226\245\337Q\347\033\021\273v\372\273\272\350*\005.me\211"
+	.ascii	"\303(\277\305\264\2672\364\244Jz\\\251\022\345A\0322e59H\351"
+	.ascii	"\376\210\345p\316a]\316\372\244\344\220\025>7i&r\365\345\346"
+	.ascii	"\240\031t"
+	.string	"\225ALi\026\314\372\221\212\254\370\270\3602\003a\371\310(^\311jed\321~\242l&\330\254\241\220\253:vc\t.0\3265\257\263V\213\224\376\306\311\273\020Au\330F\027\335r\250\021\351\263\213I\022\302\375\300?\211I\235\370\201\306*\177\307?M\007^\017/\330M\346\324F\264\f\223\274\001f\373b(\336r\243\210\013\253\315\331i\030\023\337\377\272H\332\367f\267A\267\033\030\321\026K\320\247\273\2156\260\371\214\314B6`\244\035$i\231\317\231\316_\365\252:\375\006\201\360\265#\342X\216\r\3247Z\356v\004\267\037\005n|1\327\0057P\324>e\265\322\326v\365\376\013\200\032`-\255\361>y;\"<%Q\003[]1\317z\300\263\343\347t\365T\253\260xa&\300\303\021\225q\306\352\376\245\025\007\363s\276\377\331\234\207\253\033&&\031\260\\\t\336r\322\274\227V\244\031d\237\200\016\272'"
+	.string	"\275\025\212\246\377\023\252\205\346\2078S\250\351\211W\023(\330\273\363{\031\035\330\213GI\017\336\002\305\336%\325 s\266\3768\354Oe $*\\Q\2004\377\027^\265\006\232\r\277\235\207\310g\217\370\230D+;BF\017\277;\002\177\215y^\213wt\205"
+	.string	"\t\321\306\0076Q(\302k\304\226\342T\254(.@^\033\0054\242\252\363R\251_\242\003\254\200\003!\255\226N\264\013\227\336\002\241\247N\376\202Z\2515\242\224om$\330\035>Q>\217Y\016\335\236\037'5\253\262\002\035\352\323\3125U\224\302\006N\177\315\017\\\356\251\2776\025\202\222U\321\301}\207\002\344S\237\351\361\244\256\260\374}\035\366\246\021)\330\244%\232\025\230\203\034\24690Y4\023\307\225\006\016\265(\340*\023-\217\346&\264K\347Qt\271Q"
+	.string	"Z\026\344\322\303\315z\205b\361\217V\027$m\343oM\310\242b\033t#\255r\256p{:\336\302\227\267I\221\274\207\207\224e\2731\363\221\251\376\302P\201JK\241_b\202,NK\210C\035\225e\001\372i\306\021R\356\202&\354\262\242\373\365\243t\254\337\234\341\355\260\235\277\312h1\f\241\220\200P\206\301\241P9\023\037\231\330\347N\034<V\240%<\036\300\177\352\253F\261\267\301\220\245Q\300F\034\255\022\003U\016e|8\215x\240\274V\304\031\211:\017\346\377\003'\315$K0:\23480\b\t<\030\365\226\233\357\n\013\211\257 \2214\207\002tA\341\256\177\235\300M\"\252\372"
+	.ascii	"\310\231\020Q\222\035oP\325\214\337\327\351\252\367\250\234\204"
+	.ascii	"\373 \315B\326(7*\271\265\214\242\236/A\307\005\302.\031\030"
+	.ascii	"\351\313\244\351\022\300P\343A3\216_\314YL\242\355$\277z\303"
+	.ascii	"^\206W\304\213|\300R\020\262g\335\213\346U6\233\336\226\262\320"
+	.ascii	":\301\345_\346\273\tC\003\340\271\b\033;_\223\300.Gd:\206Q\275"
+	.ascii	"\247\355\315\3402e\244\367\313\205$7\262\007w\275\023\272\264"
+	.ascii	"<D\351\327\207\023.\024\214\377\001\353\310\371GJ\225\267X\335"
+	.ascii	"+\262v\034)X\262&\314k1n@\341\307R-\231\035\303\200\307\204\344"
+	.ascii	";N\030d\243\\\r\032\204\307\230#e\374X\235B\250\036\030\275/"
+	.ascii	"\213\025\344X\205lCww|\005\334G\312\346\342r|dLO\031K\222I\307"
+	.ascii	"-\fj\313G\266\r\021~\344p\212\241\347\350\272\3320\027\301\257"
+	.ascii	"\022\237\367\330\312\204\263x\263\363%\272\277\020M\036^\274"
+	.ascii	"\236jhl\017\036\354\325H-B\022\217u\205\021u\362\265\250']\337"
+	.ascii	"\240\020\325\244^u\025\263\363\242\327-\242\361\324p\235kB\363"
+	.ascii	"&\302`\336\263\323\022!\364V\372\275\314\3113\306_\366\243\201"
+	.ascii	"\367\003J\242\0305'ae\030\024\236\201r\277\374\034\333=\177\343"
+	.ascii	"\026X\331\342\261\272S\031\316Y\314?\301\216\013\003\306K\246"
+	.ascii	"\325\372\255*\351\234Z\256\232@\tP\022\300&n\013`\2650\005\247"
+	.ascii	"\276\245\002\337\t\247h\206\231\371\221\340\217\253\"\024\211"
+	.ascii	"vc@(h\026\310\313_\366W\250\315\026C\327K\312&\364\373Crl\266"
+	.ascii	"1\235\311M\2234\225\310\335>\372k\275\263e=\216\202M\354)\215"
+	.ascii	"\235\033\241\310\310A\360\205\343\346\243y\342\311P-\355\321"
+	.ascii	"\366\3773\361\237\260fd\022\371\031^[1\364\224l\256Q \2375S\355"
+	.ascii	"\227!\253\337\205\311p\375N\002\354\225?\023\213G&APFP\016\215"
+	.ascii	"\325Fz+\237\2748\020\272\234\261\261*\022\022{?\362\021\267\301"
+	.ascii	"\225\262\355;+\323\250\233\r\337t\3141\320{\276\026}\004\337"
+	.ascii	"n\004\313\267g\3404,\r\033Vm\354\020\246_\355\030!\332\365\305"
+	.ascii	"~\212\302\033\013`\003z\206t\346\224f&j\344\236\267D\271\306"
+	.ascii	"%\363p\311Z+\203\223\232\030"
+	.ascii	"9\233\"R\325\225\216\204%Q\342\313\n@\0246\337\211u\241\241y"
+	.ascii	"\021\310&\034\255M\252\200\373\032\330\340\215\201\343\317\216"
+	.ascii	"\356\354\344\016\234o\335j\336\327\250x\023C\332;\022\031\252"
+	.ascii	"\2210v\341C\270\265\263\351\\\372u\346\333fm\266\227V\252t\023"
+	.ascii	"\360|\205P\\\266+\033\007\204\375\230N\3462]\372Mbxog\362F\327"
+	.ascii	"\247\247\301\215\342\311\206\261\235\031\035\221\321\0063; @"
+	.ascii	"ks\335\031\361wHejh\270\036\321\341\310\230\321\374cd\027\017"
+	.ascii	".Q\345\240\253_*\027\242\b\304M\230?\252\244\316"
+	.text
+	.section	.gnu.lto_.jmpfuncs.a023cfc9b88a5f3b,"e",@progbits
+	.ascii	"(\265/\375`q\203m\007\001\21269@X \224\252\232\016\340\275\246"
+	.ascii	"H\327\346<9\204q\222\324t\261\316u\321\314\361\362\345\343\350"
+	.ascii	"}\236\211\274GdR"
+	.string	"\372\260\354\301\255\330\366^\320Kq\341\020\332\276O\300\006\206\367<,\303\315\nM\324\253\220\300\026\225\255\215%\335_\240\031\343\b\206Nk\333f\2557I\262SJ)\276\003\367\003\001\004\315?\260\351\304;\205\262\311w\317\323\017\325\215\360pt\214\3529\366\224\351`2\321/\350\223\352\3351\200\222\240zGao%\030\004\251fTw\212\271ct\003J\234\223\216\240M/@/\340\341LI\250\336\314]t2\221K.g\032Bu\024\n\t\017g\232R\2753\221Q\275\327\024F\365\3367X)\tz.\261R\022\264\371\0245\340\341L*\b\251\005x\206\034\003\341\200\20739\251'\220>\3424\031\321B\237-P\256\"\311\021I$9i05\004\246<CS\200\205>Y\350s\001\264\b\346\031>\340\341\2726bP\315D\372$\322g\016\247R\022\224\01306\363\020Jx\270\316\b8}\342\364*u\247"
+	.string	"J'\300\356u@\250Bp\247\003\017\325\214\324'\022\016\273g\323\016\242k\021x\270\016\213\352/\250>\203\364\031\304\371\215\0040A\273\253\242z\247D\202\244\022,\f\336\251\366\033\272\216\372\300\247\025Ts\355\263\332P{"
+	.ascii	"\367n\r\n\332H!h_\316q{"
+	.string	"\034\305\r\3324\254\270\301\315\003\237]\007r\240\232S\3503\005\330\214\366n\255WH7IL$5\26108\263w\002\001\002$G\327\302\334\257\225\025n\002;\341\341\272\036j\2166\330\227\327\205\241\360p^\204\3527\334)T3\220>\201\234\020\260~v\247\023e\203\227s\354^\310\240\232O\350\363\204>\225\272\343*\200v\317>\273F\365y\366\251\344j\375\374\271{\232\301\335E\341\341\374\211\352'\250\336---\240\233\264\323\3357\230\206\376\346\270DBC\303\033\205\262\300\303y\b<\3479\236\201\255\360p\016\201\352,\004n\231\355T\2126%\302\006\340q\034\356+<\\\267\001\304\005\036\256\321\250\316\003\355\025\0343\3001\0035\324\300\302\303\265\016\252{\251nT{\212\271wv\317\216\201\207k-\252/\273x:\372T\3221RS\323\035\252\371\354S\251O!\314\354\253\0024\f\252\367\356\fJL\b"
+	.string	"\305\303u\024\325{\223d\330=\007\260Yx\270\306@'\200\376\241\313\351\336\302\303\261\0321\230L4\360p\274\005\205\201Y\360\302.'\325\200v\357\272\200\324'7\2730w\013\353\271\034\013\313\315\316\034\200\345\"{\262\237\335\236\354\205\207c\016TO\0355\0375\247\372Du\263\t\230\231;\"Q<\034\3730D\310\027\036\356V]\005\206\207["
+	.string	"\305\221\342\341l\252\243nvy\005n\232\002j\0051<\334\314\306\324\216\317\216\247`\226\202\317\256w\340\341\\\252\357\236\315=t\243T`f\017\3026\3159\246\241\3144\264\231s\274\247\255\273\205\271k\273\2619\2729\336(\364Du\247\372Tan"
+	.string	"l\022\031\264\233\203H\341fC\227m(K"
+	.string	"H\252\027\325\273\314M\3439~\302\315\236\313\361K\2573\377X>\345r\2717x\243\320\333\322\322\322\022\237\274F}.\361\241\302V0W\301fx\270S\365n\346\036\273?\374\260(\240"
+	.ascii	"$\307+\205.\257\024\332\f$\307F}\276\364\27207\217\335\335\261"
+	.ascii	"\273:\226s|r\022\032\2249\t\r\332\234\224\206\207\343\352\264"
+	.ascii	"\213\351\372d\351\023\005\263\313\335\223\177\336(\264Q\315\315"
+	.ascii	"\234c\367\344\263;9i\neN\232B\233W\311\207vo\271\207fTs\212\271"
+	.ascii	"[z\227\245m+\235\231Z\316\361\356\236\335=Y\356\236\360\362\236"
+	.ascii	"]7\366\271\244\271\205\271Q\251>S}\2720\267\267kJu\250>\235\331"
+	.ascii	"\311\256\317f\\\237\214c\357\323\373\344\336\031\230\331\227"
+	.ascii	"{X\027\236]\033\220\334=\212\250\336<\230P\275\247T\357\023x"
+	.ascii	"8\036/\250\336<\232\250\336{\232\321\316c\211J;'\314\243I\365"
+	.ascii	"e\036D0\020\332\221~\320\356\361`R}F\t\247\017\332\325\250\216"
+	.ascii	"F-\243\235\214\332\203\366\2310\220\310@B\262\002\351\212\031"
+	.ascii	"\033\214\321>\003EI\214\366+\252\207\321\016\005)\213\205af\206"
+	.ascii	"7\n\235\211\242\2727\205\317\030\321\365\300P\360i\307\224\352"
+	.ascii	"\275\003\214\352\275\303\213\352\335\365\300>\004\333Pg\0027"
+	.ascii	"\273\025;\250\250\316D\365>\373d!\300\007v4\361\300\216#v\020"
+	.ascii	"Q\275\333\035L\252\267\267\301\316\004\226i\243zw6\224\331\206"
+	.ascii	"6\237r\271\234\314\032MV\206\f\231,\252+\361@\273S\355I\254\f"
+	.ascii	"\024\325;%\356\200\257\301'\030\355]\016\332\273\2169\300<\340"
+	.ascii	"\226iR\335\333\300\356\3312GT\357<\b,3Du\031&\325[f\251z\267"
+	.ascii	"'g\240\f\356n\r\246\216\005\363\223\236\302]\t\220j\200\344\305"
+	.ascii	"\351\264\216\001\227.\\\2728\343\f\035lTw\351\202+=\235\341\222"
+	.ascii	"\323\221Fu\272:\244T\357:\013\350\200R\275\323\341D\024\017\247"
+	.ascii	"#\210\352\364\3543\325\314G\234r\271\234\003b\300\267\245\245"
+	.ascii	"\245\007\304\260\021\323\203\352\335\031\243E\312\b\nxex\021"
+	.ascii	"_x\270\230\025To\226A\006~\243c\30277\335\271&4\306\211\352N"
+	.ascii	"\230\2370\347\030\f\017\027\003\201\352K\200A\303\204jJ\304."
+	.ascii	"L\017\252w\246!`p\320LC\375\tnvn\231@\263\020\355\006\367I\251"
+	.ascii	"\331T\005\001\003\203\352&\246\241{\342f\t\300\234\240z\303("
+	.ascii	"Q\275\027\006\210\352\r\263T\275\367\224\343\034\347@B\365\034"
+	.ascii	"aT\357\252\250\336\345x\242zK\361p9\226\250\236#\210\352]\016"
+	.ascii	"&\325\033\007\031\325;)\325\033\307\r\252\343\310\242z\343\240"
+	.ascii	"\242z3\020\215\343v\302\274\005\263\026\334|\362Y\203\366n\206"
+	.ascii	"\034S\336(\324\344\003\016\024T_Zj.\230q\214\240\342\030\242"
+	.ascii	"z\327/J\250\336H;\360p/>x\371\202\f\332\265\026\302e\320\336"
+	.ascii	"\345\037\320\336\263\345E\212\352\235\277\030Q\235\272,\241:"
+	.ascii	"5\303\303\271\314\240:u\361@u\212\206\207ky\243\272\207\224\206"
+	.ascii	"\207k\271A\365\206\322-(\250\336)\311\240}\221\212@\273\267\013"
+	.ascii	"f\032p#\031\201\366v5\377\201\033\t\264\231I\313\005\252w{r\213"
+	.ascii	"\003\252\323!To\22648\307\002F\216s,WT\247,!\250\336\f\201'O"
+	.ascii	"Nfa\322\375\362\322D0\277\320=y\345\214\377\245+bTGR\202\207"
+	.ascii	"[I\301J\023\nT\357\234\207\335S\347Dj\003\211\2156\0017\021\210"
+	.ascii	"\300+\245\005\355\264\353V\202XYZ\342I\241\316=x\243\320\025"
+	.ascii	"T\220P\275;\235\230\n^\243z\257\013\253\b\301\345\007\325\273"
+	.ascii	"\035\203=Oe\214\352*QTlP}\267\206\344\006mzjan^B\312y8\225\b"
+	.ascii	"T\357\324\033)5\252\323\365\\\316\001\036.\005%\365\202\352\035"
+	.ascii	"R\216SN\252{<x8\324\021\252\247vS\247\222\317p\245\313\2256\317"
+	.ascii	"\260Q\237\250\346\006\320\263[\246\2503\230x8\224\030\215jV\352"
+	.ascii	"\223\273{\351Eu\233\330\264\003J\213\352\035\267\037aQ\275\212"
+	.ascii	"\352\3356J\004\246\033w\243\232s\230\331\227,\347<\227\353\301"
+	.ascii	"\303\241@P\275\233T\357PHT\357\216\250\336\355\211\022\242:\020"
+	.ascii	"\325Q\270\352\215z@\365n\367\344\bx8\317\214\263O~\303"
+	.ascii	"\3465\251\336@x\270\223\030\325\373\304Eu\332S\360\tJ\365\326"
+	.ascii	"\3016\224\241p3\020>1Q\275wM.p\\\340x\267Xb\213%\330\206v\325"
+	.ascii	"\207\352\003\333\320>9\251\356q\024\355\315\\6y\322\300\251\002"
+	.ascii	"\325S\320M$\t\261\274\304&\r\221TD\2527\305 \027ZQ\254d\331\020"
+	.ascii	"\034e\246e\375\254Z,[~\037\212!8\372\244\266\354\r\277\030\312"
+	.ascii	"\264\377\345\207\242;\032\221bI\327\333\357-gBd\2409\232_d\004"
+	.ascii	"~\b\216\262\033"
+	.string	"8\373\322&\244\310\b\274\201\263\377\035\224\b\021M\220D\262f\031K\355\273l\030\303\013)l\350\302\327m\370\302\367a\fD\276!\232\215\347u\030\022\225\350\274\r\257_\026\276\377\276\220\310\247\n[(\362}\020\237U\317\213\025\364E\264Xh\223\r\335D\233\227\201\346\bS\325\250\254)\226\251\375\034\321&\003\215\336\224\331@\"q\347e\313\357q\236n\371\241R,tk\371\325\177\271x>\210\205D\007\266\372yW+fozm\237/\335\360\363=m\313\345\313\303\343\352\266\374|\303\357e8\322\303\323r\351\374\016\013\006$\364z\271tzlY\212\377\217C\033c\246mH\274\211\217\203\203\203\263\2631\250b\210\241\366\377?\244\205\332\2276!GC4\321\004e\257C\t\302v6H\331\002\221\317\346q>,2\344k\331\377\357\366\377\237\024M3\306\200\017\307\030)\326~$\217\216\354\330\320\205\357Y6"
+	.ascii	",\250\210\230v\210\252\210\212\005\272\246\222\242\230\214\b"
+	.ascii	"4E#*=@\253\007\n\372\tR~6_~/\344\313\357kVX\272\241(\263\241"
+	.ascii	"\030\322\304W2d\202I>\244\201\263\331\250\023\263!M\354\266<"
+	.ascii	"\355l$\273%\305\020\034e\3468&\371\037\327\353i\261/\242\305"
+	.ascii	"L\0224K\221Da\017\200\203\217\024\013]^$D\004@\004\007\037\006"
+	.ascii	"(\202\203\017\225\365\336\353\326,G\331\227b\021\rT2\364\241"
+	.ascii	"h\004\2264\333\337\210\3418\373\036\037\235/\242\305\214@QV7"
+	.ascii	"\374\376e\207d1\220\350F\262\354\315\006\362\330\362\373\032"
+	.ascii	"8;m\371\341\254l\371\275H\332LP$R\331r\026\263\246X\212$]\231"
+	.ascii	"\f\214\221bI\263\243\021)\2263K\212%)\032\211\244\216\r\277\277"
+	.ascii	"\305f%\315V \037\026\222\3727\274`\177\263\323Z\375\374\270t"
+	.ascii	"\276U\203\253u\200\226\320\2175m5Z\214\256\r\254\235V\017\335"
+	.ascii	"!\f\b\301\232\365a\265Z+$:\336\332\276\033\211co\340L\b-6{\261"
+	.ascii	"\210\006\222-[~\237#\316@\332\327\244XX\366kR,\246-\242\305\314"
+	.ascii	"qL\"\276R,+[Y4\254\202\352\267XH`oC\017\317\t\253\nE\223\034"
+	.ascii	"k5[\371\346\330r\361\261\n\b?\225j\b\016\317\343z\326NO\020L"
+	.ascii	"\310\365,\237\036\036\327\013\350Y\260\325\353\2276\306\314\332"
+	.ascii	"\370aL\006\032\321z\\6\374~\247\265\372\360\373"
+	.string	"\026\213U\003\214e\344a\256\326\227\337\347\224\037\315\262\216\264V\257\347q=L\310%\263;,\237\236\025\317\037i\365\004\275V@.\013k\t\271t\036\326b\375\b\035y\255~\247\307gEC\253g\307\036i\365\b\265z`-\227\316\263^.\036\226\221\257\201\325C\003\353\365\254\240\025\313\007\350q~\207\005\323a\301X;\317z\261j\370\240\0276\305\342\3739/\327\353\305\252\251\251Q\331\317\361\255\251\251\351\366F\372\336L\337[\221!\237II\215\366\034\344\2007\n\235\322\356-\263\022\036\356\204\tT_Zb$\021 \201\262\273,\003\232&\320|Q\235.\315\022\325)\r\022\325\233f\210\246\371\201\206\311\217 T\357\224Z\251\373\201\203\352\335v1\340\356\335e\031\360.\022\th7o\t<\334\017!\252\257\254\0173\252{_T\357|HQ\335\207\223\352\275O\230I\025\31396\373L\261\200R\037H\370"
+	.ascii	"\242\307\021\252\367nS\261<\205\024\313Qh\200\366\n``\316\227"
+	.ascii	"\246P\354\031\325;\365D\2170z\370\021\330\t\276Q\3016\021E\013"
+	.ascii	"zL\301D\217%\252\367h\322#\003\325\003[k2QI}r\374\033\032i3E"
+	.ascii	"\362G\363\253\031\273\211\365\305\332\221\371C\212&\215\225b"
+	.ascii	"qaw@\362\023~2\35004\312t\276\374^H\347\007fo\337m\310\347\224"
+	.ascii	"\245H\206!\250\303\020h\006\245\3607\360g\207X\371:*lN\370\345"
+	.ascii	"H\036\035y\331\360\373\221<*z\324\226\237\f\345Gw\350Su[\206"
+	.ascii	"\264qH,\277&\324cK\330\337\300\354L4\313\243 \033^\256\327\r"
+	.ascii	"G\376&\214\2317\337\027~9B@:<\033\344\210\024M\023L\362A\341"
+	.ascii	"g\3634\020\031\242\032\362*\200\246l\244\241\222$\353u\212\364"
+	.ascii	"\270\254\355\373\234R\234\201\265\332H\206\177\033\223\3500\004"
+	.ascii	"\312\214\374\330\234\262\b\224\021}\370E\264\330\214\\\311\234"
+	.ascii	"\200\\\266\224Y\225JUD\213\205\264\230\021\225\034v^+\227\021"
+	.ascii	"\225U\275)\006\275\254\267\245h\202$]\221\004\227\204"
+	.string	"$\250\004\2652\031\330-jE\022LbZ\332\030+I\321\310\233Y\331\321|\233\221\366\345\313\322-\277G\315R,.K\212\267\330\354W6\305b\212%\313z[\003g\335\236\366f\003\273E\255\267\247%E\263\004g\247\232\025eb\3712\220\026+\212\221\343\213\344h\226\"YA\322V\024#\242\215C/\032\201%\314\212F`i\332\241\027\225\230\037\322D\231M\315@Z\016!\t\216IZ\366sR\373\345\327-H\263\255l\031\333A-\313\333\235\236\034^\254\227\020Lg\305#\324Z\375\274\254\352M1H\307\226\244H\332\314!\220\310F\003g0{\203a\310\367a,\007\333\320,\206\024o\261\237\224isDY\022P\026\003\215V*[~\337\321\rY6\374>\247$Gs\234\275L\006\272\254*\374\036\307\252J\323V3m\343\313d\340\027\321b\245\020\314\252B\325\213e\344G\250\3650! \230\220\013"
+	.ascii	"\273\323\022r\005\375\221V\317\r+\037\240\217\331\360\373\233"
+	.ascii	"\030\322bO\216DcK&\374>\244\331\306\362\213h\261#P\006\244c?"
+	.ascii	"\2474i\"I\332t`\026\247\367\006\030\320\017\253\342\324\177\271"
+	.ascii	">(\374p\210\004\t\375\374\221V\317\013\0264d\1774\337\024\313"
+	.ascii	"/?\225m\241*\033~/\312bD#Y\023M\220tY\330\027\321bJ\314q\234"
+	.ascii	"\005\275\316\353kd\366\305\202\371\364\360\234\366s\304\031H"
+	.ascii	"\022\275\r\257\017EsH4\305\235\257\361\261>\357j\245\266\234"
+	.ascii	"\205\001\030\362\251\302/e\332j\264\236\257\231\331\223\r\252"
+	.ascii	"vd>)\232\262\030\321\316\327\320\330\274\2676\277\203\222\360"
+	.ascii	"\373\034\"\242\321\264\r\201F1R\f_4\212\231C\253\257\251\331"
+	.ascii	" DD\243i\203\214\246\r\244\033D\006\332h\340\314\333\226\253"
+	.ascii	"\007\266\362q\001\275X\260VO\313\222cI\023\313\034\206JQeE\332"
+	.ascii	"H3m\370=)&\231\331h\357\352\241\305\200fV\234\201\345\213$\370"
+	.ascii	"Eh \217\r\277Z\216]Y\225\230\344\315\221\366\241\3146\016\375"
+	.ascii	"\bS\bE\232X\033\177\230b\211#\303\rM\254\215\177\024\202\")\003"
+	.ascii	"\277\214\245XT\341\367\243\371\341\367\263\221$\3720\374Lr\004"
+	.ascii	"\372V\025\212\262$ M|#ABO\212F\343\20760\311\0231\311\021(\310"
+	.ascii	"\252\314\330M\374\321,\277\027eCGCO\212K\306\332\337\024\321"
+	.ascii	"b!\t.!G\236\232\265"
+	.string	"}\217\363Cdv,\216\375\033\337#\220$W86\374\036G\211YD\023e_D\213\221f\320\216m\271\376\206\207\307\3659e(.\031e\262\325\314\006\t\277\317\001\262\201e\363\341\3679H`GZ,\037\024v\350\373\234\235\226\220\213\347_,\230\316\352\265B\242\363cY/!\330\252u\244'(\225\303\022\362Y\321\360\260\026\353\365\022\322y\325\016\353Hk\205D\347[+\235/?\0256\2073\250\243\027\233\226\2459\246\220\310\310\310H\222\244\003\303\022`@\210P,\225\312&\313\352;\023"
+	.string	"AJ$\261\200H\026\r\206\343@\024\343@\206\3419C\020!\304 %D\"\222$\035\210\005\2111\363\354\371\355\370~#\001\260\327\363( Z)\027\251\375E\033\351*fQ)\"g\215\360O\321\034\300\030\031\246\031\343HS\t\245\255\337\242(e\321q1\264\377i\242y\214.dTC\274g\232\032\001\304\231\272\277L\036\230\271s\327j>\354\031->6\\d\255\206"
+	.ascii	"\235\004?c#?\231\246\360\215.>\337C\211BV\367\230$i%\332\247"
+	.ascii	"W\223\201"
+	.string	"\250\250\2325\211\302E\013Z0\211\204\237\321j\322\343\332\374\241\301x\370NY\207Ulq\325\005\331\321\213\214\354\312\342!4\n\004dp\312\252\031\345\345\002\366\027\330\237\030\200stG\211`8\271)44k\211,_\026lkNqx\3139\262\344\2148l\273A\350\310\002\205\210\256\362)\023pu\333(\3640\325\237\327\n^\335\260\270N!\215\366\263-\021T\030\007\327\025\361Q\243\ra\213)!q\314\225\233hs3@D\023<\224\255\266\352eN\2328d\033\212.\267\357\302\241F\b0\331hu \325/RU\346vc\326]\004D*\333j\002\360\366\3138\241(\032\375e\247\200/&8\227\262\366\017q\302;Y\307\255Lf76\234Y+z\210\025\326\237%\330Q\362A\265V\314\253\270\276\265\005\232\233\270\202\225\350\365\f\215\350\251[\231k\250\371\312\357q\242\034\r\236.\276\322\302\232\305\342"
+	.string	"\032Iz\316\332\215\224jF_~\245"
+	.string	"\371\373x\207:'\364\227\203\373\235\353m\007\275<\005XE\375a\3636\233T$;R\021\177\234G\314\246&Wu\241\304\261u\226\213\bq\362s'\\u\235\214f\214\316\356\n\020\006\237\207\231'%\310El\216;Z\366z\310\021\251Fx\234-*\272\362E^IMI?\266?yq\343\325\251\253\021?4I\233$\301\360tdz\367b\267\244\342OU\032"
+	.string	")\2667;\321\356\007\272\266a\352\002\024\214\326\177#\260>\233\016\277\351\306\303\334\016\004\344S\254\374\324\232\254\216\300\001@,\360\315\312^5\353\342\320\027\322\334\237\267t\235\321\200\315j\302p+\363\337\005s\372\327\244\027\024>)^\305y7\332h\307\305\231\3549\254\232\201\270\223\302]}\214\342\377\361\363\246\022\260\246Z\021!\255<\367\240s\346\244\032\273C\220G\021\031wE\263\037\306>u<\220M\367\r\227S\007\305\357x\254(\030b\250L\353w\352D\bx\2402\204\242\231c.]\365nF\212\201\331\371\216\242\002\"q"
+	.string	"$\013ht\264\272GZ\220\370\243_\024X\214.Lv%\255\231(\n\267s\256!\021\301\016\",(\r\314\375k\023\303ub\247\210\331\232O\210\2232\031\233\226\020\253\356PU\036t\363\013\204\033\266\227\332xtg\262q\235\3559;\037\371Tsf\372{WdJ\235\324*o*\034\260B\253V\342%\367o\r\361\203mw\306\342\327\303\b\036\240\245\215y\036\337\321bI\213\266\225\3303h\270\2531\235\304\272\375x\3243\233\304\201\311y%\254L\355\205\243\2058\261\233QI\005\331J\342u\353\304\225\245\001"
+	.string	"\021V\022\020\005\313\241H\346\232\307Q\200i\177\001\376{\264=&X\302\200\024.\216\212"
+	.ascii	"\f\367-\225$\336\225\306\366K\360\311\263xuY\004[\224@h?\201"
+	.ascii	"\370C\266*_W&\242\263\365\204II\252l\245~\300\036\275\231\016"
+	.ascii	"B]O\222\025\271\322\033\363\376j\201,\226\224;\261*\264mF\347"
+	.ascii	"\007\263GbH/\321\372\361\242\371\n\311I\330D\340\353t\003&2A"
+	.ascii	"\336\223\341N\nB\304\371;\306\266\225\017\337\334xrkI>[\230\231"
+	.ascii	"\032(.\364~i\310r\215\001*\031\216\327t\020z\353\0137\350\244"
+	.ascii	"$\026\353h\210i3\222\273\351\344y\250\233X\214\326=\342\177\236"
+	.ascii	"\342,9\241\002\224\313\206\205\323\001O\200\037\360Wh\245\317"
+	.ascii	"\224\020\2754\244\243\235Z\314J\213\336,\326\0161\352\225\371"
+	.ascii	"U\231`\035\247\315C\353\035\360\325\017\031g={*:\204\212\037"
+	.ascii	"\n\321\337gN\221\222\333\364\315\035Y\231\223\022\225\361\320"
+	.ascii	"]\302\342k\357A\364I\303\370\334v\232\304A\234\354M\313"
+	.string	"I\220\323\344\276b\340\313\2240]hW\303\\\315\371\224\246\264x\324\323b\203C<D\240\363$e\241PI\027\310\255}\310\367M4{\307\203\310\2273\362;\370h\306\036\366\222\204\220\2275\017\200K+\200\373\fb\026\275\314\200Lc\352U\250\217\32297\335^\200\302!\"K-sb\215\3642\216\300z\320\363Xy\265\247\344\216\275\241*FX>\215lE\341\211t`\373:\267\232\245\377\344R\343\274\250Da#\331$h/cBB\325\303\323\b\242\324F6\027\241I\305(Y<\016\312Ub\254:l\365\036\252\256\302\022\271\210\356\303\322\222\224\340D\320\016\365hO\017\024\324\036H\006/p\3436\302\033C\034\003\365i\332\3018\345\303]\034Hoe\322\342\241\373N\232\363\034\253\016\022\337\254\026\013Z\343\034B\375Lw\305.\356\264\330\226\347'\345\023\323\023<\027\331\003]\223\254\334\250\204F\355\017"
+	.string	"\310\266Q\223\217d\234F_\247\2271\024\224\236q\222\332\006\305\2709Cy\330\200\307\377m\242(\n\234\023 Br\273\320\356K\212:\230Xz\362\362\374\037C\212\352+\f\005b\253\313\377S*\364sv\360\t\276q&\337\034\222\242P\334O\375\357\304\335\316\b\020\214'\r\247\271N.\230\204\305\326e\370\347\360\256p\270\002\202E\202c\330\305\325\031\0328\227\210\355\353r\320\222!4\260o\303\261\366#\253\236)G\213\201K\244\201\310w\034\246\331\245\204,\016Wl\033n\324\037\373\374\"\230\332\316SdT80\274\2566\033\210n\315\315\322\017\034\250@\343b\324\236\360\277\t\031&\217b~\377\345g\026v\320\323\003\205\211\211\350\237\344(R\0044>\334F\362\350{95#\244\323\325\321\022\030A\307[\205Gp"
+	.string	"P/\216\262\243\017\206r\276\232|\207\241\354\206M!\026\373&R\333&5\026\2120*,K\206l3\214\016\360\262\356\352Y/\307\316\264\003\302\037\370A^\224\316\330\252Sz\252\234\024r\022\244\321\321\005\302\016\333[\337\005\n\b7\242\013\220\035\372\026\201\224\352\270n\221\335\241:\225\364\371\250I\300u\350\024.i|\025\275;\002\312%\247\3502\343\241\\Sn\324\2530\315$\336\304\340du\274P\202.\374Z5G?\214\357A%D\254\351%\326\212\325\350\337\312\n<\203D\327\037\007\330,\363o\245B\273\213ti4\234_*\025U"
+	.ascii	"\347\252\031\356\034/X\314f^\271\3445\001\\\344\376\377^\213"
+	.ascii	"pS\353p\340\033\220`\241\203\337\206\253\305\304v,\230\n#\r"
+	.ascii	"\342\205Fa\244cO\225\f\307\034-\302\021]\232\214\350\254\275"
+	.ascii	"C\037\256\232\334\23300t\322\320\340\370\314\344\326\254S\201"
+	.ascii	"\300\367\366\235\005#\371c \227\003cg\016\304\210\274\2476\\"
+	.ascii	"\257\261\374\357x\327=\331\217\370Wh\276\bY\262Wq7\335Tb\022"
+	.ascii	"\2668\223\005\215#\3742\214\023\265\b\256\316\034\231\356\245"
+	.ascii	"\240%K\004\307\006\277@V\276u\322I\213\224\347#\311\013\340\202"
+	.ascii	"\2678,6\3012u\304\335hSm\216\217\017\337\337\250\371\344\243"
+	.ascii	"\252\335\224\005\272\303\244O\266\301\363#\364\251\205\334\\"
+	.ascii	"u\201O\206\321\263t\372V\267\262\324xn\367\020g\305\367?\225"
+	.ascii	"?PB\304rU\273PF\311\235\344\214]\263'\250S\022l\306\367\024\013"
+	.ascii	"A\022\245F(+u\237\216\236\311a\240\033\355\211l\243\336Pj\346"
+	.ascii	"\371\\(\272vV\316\021\216\272\235\336\311+wN\316\210\220\220"
+	.ascii	"\b\033\302eM\0054\244\356+A\007\371\002\372\016-\350\275<\352"
+	.ascii	"\034\223\314\003e\301p\260\331D( \216\212\024\2136\243\212\030"
+	.ascii	"o\341\335;P\027\021\030\275\222%\322\002\3165\307=DZS\231\200"
+	.ascii	"\321.\255\026\256\347\004\330\025\236\342)Of\233\nAG\n1\253\277"
+	.ascii	"\022*\221\235\026\205,\321\261\334\0018\033\f\370^\016Y\037\320"
+	.ascii	"vR}F\341\336(<\022F\352r^x\3243\370\307u\210\021\2765\315zaY"
+	.ascii	"\217e"
+	.string	"\212*Eo\206\276\271.M\020)\203]\224K\306\271\227\347c\034Eh\003Y\376\b\035D\003\"\237{\024\260k\2572\245\307\277\367W\204\243\256\377\345\335\374\354E\"\"\261r\034\226\376'\237\025X\274s\302@\261@\252?\320\263#\325\r\302\226\234\252%\332\352wX\021\376*U\023\353\246\021-\026\250b[\360cc\334\347\204#\t\310\356\346\336\23325\007\276\314\023\214\030\311\032j5\225g\\y9G\270\245~Y\350\260\336\306V:-7d\211\346\001\033V\321H.T\201`F`|R\303\341\270\326\343b\264\336\"\310\372e\016\027\013~Z\236\"'\247\205^\340\216I\250#\005\226\226\241\367\261\275`\f\323-\376\357:\377t\330\004\302k\350\257ob\335\337\316\326\360\304\017-l\345\t$\374,\313\177[\254&{}\030\302\210\017w\206\373\007\032egD\327\005\017\031\0308G\0220p\225\247\230\343"
+	.string	"\221\205\223\006\005\371S\226\017Z\241W\352f\220u3\353\"V\201\266\r\002S\037\231\331\026bm\241ZL\302*\206\333\013\034\2022V+\023"
+	.string	"\303\023\2237\334\227\324\233\020\021\007\313\035\201\006\300Q@\n\313"
+	.string	" `\331\020\005\rl\270\357\243\013\222\203\363"
+	.ascii	"#\347\347\236\376\204M\033\356\020\030\263\025\336\207j\376\314"
+	.ascii	"\001\006\216\240<6\334\354p\363\340!\365\347\243\016D\005|#\206"
+	.ascii	"_^C,\214\261\364\322x\212\023\240\005McN\257\345\274T\360\233"
+	.ascii	"\336\257"
+	.string	"R7\035I\032\332\355-\204>:\232)\\v\320\213\356\356\241\200>\216\206Q\303\266\230=5i\264\343}\222\242\026$V\231!I\254\232J\324)]\\\3339\277\250L\3300\306cAt+\224\325Y\250|\202\323&\177@\350$\315\356\030\246\257\242m+\n\260\255\317!\250E\323E\234\037ta`F\305\257\365\341T,t\207\365\006A\261\277\005N\326\256\327\013\017\337\031:0\b1$d\203hX.\322k1\307\027\234\026pIE\270\271+\0361O\370\335x\376\020\251\f\315#:\337\355\275\365\215\213\314Z\350\3439\316\224j+v\340\257\\\205}Rj\346\236\325\375]k!\0019Z\004\035\344\005\335\242\222C~\n\225+\221\376\325\365f\266\323\200\250\034\341\233\007\023t\033CqF\201\022\263\177\274\b\224\217pj\341\220\372\250\326v~_\003\222\356\230$B\300@\214\025\347\326\337\243\237\203fx22"
+	.string	".\363\037\234V\337\035\016'\b=\323;2\336\362[\0030f\275\301\2520-\223dR\227\233\321SB\211\317h\3026\363\032E\332\035w\340f!k\366\371\357\0309\235bM@&fX4\370\307j\326\343\251D\3153\202\232\323\302\021\207{\205@Hy\212\273\027\221\262HbAi\274&j\305\250\272rl{\250\203\372\317\361~/\327\337@\223,\273\235\273\372D\260\333\300\336\3325\204\326\034\227\b\026\204\335O\024\320\020EIm\031s\361\2649\300\r\261\265\325\222#h\326\210*t\024\331sv\321\205\376N\333\342\212"
+	.string	"4\"/\212\2342/\n\255\026\262\263\b\210\013?\304\226?\221,"
+	.ascii	"\032\250C\034\244.\213\367M|\351\304,\206q!\0029\202\031\275"
+	.ascii	"\034\302Tv\271}\325T\332\023w\324N\276C\020\257\204_\003\325"
+	.ascii	"/\345\342P\2156\b\343w\374X\356\352\264\222\022\257\203R\356"
+	.ascii	"G\030g|@_\"\251\031^Ex\277H\222\254\321o\364\203\254\004\"\332"
+	.ascii	"^\351\261\304\220\347\251\377Df\361\313\367\343}\305\233Z\231"
+	.ascii	"\006\206\302\374\233\006\023\3265\340Z\004yO"
+	.string	"\212\321\220\2322\241'\002\013}%\230#\313\024\373W~L}\f\202\260XQ\215q\276x.\210\345\363B:y#\245\330f\277\342)\314~\\\242\0328\300\2138\355\230\234z\020\023\2263\007\335\\\204\246\336y\244\213\033\264\027\241\262B\265\"\203d\332\001]\b\227c:\327o\332\257\301\340\360\2616\300:x\\nP\312\004\034q!\271_\tv\233\356\221\267\032r\373$\212\027y\352\303\376\366\362H\364X\211\347\361\214\351\363\032\245\232\360\370\311h\211\177\231\354\231L,\274\314\b.\001\363\250_\205\2373\274tE\341I\005\333\361\221\377\312qR\035\316\367\276\224\0061D\017\373\323Q\201E\364\213Si.l\222\037WCtqw\203\307(\363GMg\354\033\350\034\255#>*\206`\003\2272\006.\357\227\254\245w\361t\353\323\374\227\t,\305d\253\372\326\354w\3630\273]\217\267/:\357Z\302\024\372,"
+	.string	"\363\220\346'\240\235\207\253vM\367d\2640\265\025mm\243\211\252\266i%"
+	.string	"\036Sy|\345-\261\364\022'iS\321\262s\220N\374\211.5\364*\037a\330\026\236u&D\264\241)\025\003\355\354\220\332\321\235\022\272n\212C\342(!\361_f\\$p\017\333#\352\241C\370\305w\006\2534$\227 \203\342\207\215\004\276\303\246Y\302i\306\341\023\031\034\211A\361}\370\222\223(%\302v\342\221\033\327\270\3329\376\255yz.F\335\204\240\336\312\200\023\250my]n\215S\001\336\336\244@\t-\271=3k\353\342-*\236\346DH\245P2\333\243|\334\307_\306\021@Lr\177C\356\377\267"
+	.string	"D\351\374\337+\270\004\"\201\232\325\314Z\340\024\031\253%v\230\326T\232\200\245\304\004\346\342\253\316\256\032\245~Q\035h\355CN\255\377Qx\341\003\0311\267YJ \211\306\366\016d\226\347\301=4qp\ns\215/:\311w\311\247\2238\354w\214\f\361\002\3307\313\241=\237\234M\222\221\237\343W\"gDA?\240\017\241\241R\037o2AS\002\323\316[S\270*~\021\333\275\322\212|\003o\217\226\231k\002G\273\3432\256\211\376K\\\210\324\024c2TJ\227!$\305\256\007(v\0045\022!>\024\342Q\205\025r\364Zt\244@\234\357\257\207\016H\023\235\257\207\016\303\271\"\377t\340\020\255\272\364\016\337\276\254g/\r\324\304\300\361\230o="
+	.ascii	"\340"
+	.string	" \356\033\334\227.\302D\275\233\225A\257\ng\343\204\357"
+	.string	"\t\303f\030\200\202\264\214-\273$\301\327I]\222\307G\236a\003\324\230\237\364hE\231\324\375\024)\306%\303IU\344\236Ib\376#\275\225j\370<d\340\251\371~\221\2140=\2318J\202\351\376@\331\330\377\222\266\307A3f\304\202\243\232B\206\005C2\250\262_\354z\252*>\006\016\361R\"-&\260\035\203g\3126\3016\230_\033\241s\322\325\3145\302\322\253\276\216g\303\316\376"
+	.string	"\213w\020Q8(\363\246$\016]\316\303\316\020\373\340\340\322Tgq\312\031\022`\375\357\213\3038\357}s\252\322=B4\263G\215.\326GU7I\366\270Y\b\n\3728\240\342r\310\352\256o7l\023r\033uO\235$\207\273Cj\003\177\314\340\324\357\206\365;\207\254\212\r \031\241\233\340\254\252w\336A\204\341\315kG|\241u\232\022\322}\273\213\273\bLT\360\262\005\237\006\032\202\2156\f\300\021\300\263\374T\317\177\0359\276\226\346\314\\P\340\265\365\367\235\026\033>\366\310@\032\007sWz\236%\b\366\371A"
+	.string	"\256\336\277o\bc&\306f\312\270\275\304\300\336b0"
+	.string	"\215\3616;\177\235\276\317.{\366&\206\2235$\204\314\271=#I>\372\025\336u\2024\035\025\373\224\340\033!DQ\370\260\354\2070*\367\224\256jA\310\356\347f\341\254@V\222\334/\006\005\001NH\341\217I\225L\337S\247\370B\032\214\223"
+	.string	"\324^f`d\272\235\234E\2422u]\b\007\312;H2A(x\351T0z\221<\013\021\305z"
+	.ascii	"K"
+	.text
+	.section	.gnu.lto_.pureconst.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\302"
+	.string	"\365\t"
+	.string	"&\234N+\260\262\024\322\001\274A\343\230A\375)\305N}d\361\177\207\200\221\343/>\377w\376\357c\276\377\377\277\236w\033\221S\322\305\375H\332F"
+	.string	"D"
+	.string	"D"
+	.string	"\356\301;8\007\337\340\032<\203c\360\013n\301Q\205\037\n>\301\222\340\021,\b\376\300 \007\026\2207\360\037\213\201i\201B\n<\201#\360\003n\300\0138\001\207\006\270"
+	.string	"\207T(\200\t\200B3\371l\213\217\317\360\004E\304\207XB\254 \026\020\353\207\345\303{X<|\207\245\303\224\303\302a\335p\033^\303i8\232a\222a\212a\301\360\027\356\302[8\013_\341*<\205\243\360\023n\302K8\t\037a\022a\205\260@X\037\002e|dL\033\243hb|a|`|_|^\254u1\215\213iB\216\026dM\213iY\024a\361+\216\254"
+	.string	"U\261\250\370\024\227bEQ\004\305\237\270\023o\342L|\211+\361$\216D\321\021GF\274\210\001\276=>=\216\226\307\240\341\361\335\361\331\361\325\361\321\361\215|\"\323\346\370\344X\033\362\305\361\301\361\275\261\346\306Z\033kl\254\255\261\246\306\227\306\207\306\264\344\333wF\321\314\370\002"
+	.text
+	.section	.gnu.lto_.ipa_modref.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`r\r\2254"
+	.string	"\272B\024\016BpjM:\361=\251\016>\215YH\227\005\030\324\254$\243\250\263e |\221Q\230id\304W\222\244b?a\336\264\365.\276.\261dZ\374\0262\244r\377n\240\366\342~\302w\247$Z\333F\210\224)\273"
+	.string	"\336"
+	.string	"\313"
+	.string	"\274\031\216\001\252\254\247\240i\007/@\225\265\257yl\201\321\264\006\373,6\2377R\230\300\022\226\304\004\365\322t7G\340\205\360\373\361\020\376V9\370[0s\203[.WV\351\226\301\027D\021{\212X\332A\005\267\232eg\370?\227+\253x\373\365u\b\363\027\021o\221\023 \370\177@w\326=\207\333C\314\374\342F\374h`W\340\037\260$\340J\377\021^"
+	.ascii	"\377\223\352\2552\356\t\363_\353%\377\035\317\302\\nd\323\334"
+	.ascii	"\357\211\204\367H\230\217\303\325\376\327j\255\232\030\367\347"
+	.ascii	"\262\374wy\t\357\313\334\371|\207\214\303\275~\277?\177\317x"
+	.ascii	"\377\333\342\330\342\350\306/\224W\370\227\236\002T\322\356s"
+	.ascii	"\017>\217\035\214\n\322\n\n\321\335\036/az\202f\216\343\340s"
+	.ascii	"S5\332\030\b\263\336\232\356N\343\215\004\211G&o$\231\365\324"
+	.ascii	"\214\025\367\312\217H!i\003\252,\fo-\225\205\361S\026\006\310"
+	.ascii	"\263\t\311\032G\306\272\240\215%p\324\210\306v\365\214*\242\214"
+	.ascii	"\021&\332\214\221d\326S\323\266.m]n\255r--\313/#\036\277\213"
+	.ascii	"\246\230\f\031\251=g\b\024:\303\305\247\273\t\021\376\236\371"
+	.ascii	"\037\277h0$\234\341\302\223\365\200\314\227\210\314G\250[\221"
+	.ascii	"\"^\235\316&$_0\232\372\202\274\250\205r\361\253F\203\206\005"
+	.ascii	"\030\230\212D\274\347\024(\270\330\277\025o\305\361\304M\274"
+	.ascii	"\004\211\035\361d\265\"B\200\370\340t\017\334\341\377\346r7t"
+	.ascii	"5\265\2747\375\3043\262\270\0346\354NC_\257\341\027\237h\332"
+	.ascii	"`fm~\375K\ny\274\\\300\237\201\003\265+o\334\255o\225\177\212"
+	.ascii	"\024\036\227\312\225\272\001\001Z\337\356\351\327\315>?X\274"
+	.ascii	"YQ\370\333\002\n\177\227\021\357\271\207\305\266C\341\334p\267"
+	.ascii	"\267\364K\261\322\023ej\337b\235\251\211\2770ak\365S\233C\255"
+	.ascii	";w\270\317\377\371\204\213\355\204\321\235\036`7:h\013\315\261"
+	.ascii	"\205\246\215\0162\317+^\036y\305\250 \254\363Dw\rl?e\355\343"
+	.ascii	"m\236\232\262\2521Y\326\361x\311Y\211\2167&9\257\023\357\235"
+	.ascii	"Ls\235\270,"
+	.string	"q\270\345\321\246\343\221G\316V7b\023r\021!\001\206A\006t\037\b\260\327KXc\201S\354<\303\237\307?\356\203EZ%\315\234\021\315/\245\312\332\313\250\246\rMQ:6\334\336$\325$\245#\303\355\245\224\216\f\265\261\317\227\317\326$.\336\272[\207\016\356\214h\002\340\022\251\277\210\275\302\235\003\305<^TN\034\262\037}\003\005b>\2347n\332\260X\252\007M\273\262!\323*\331yJ\244=\260\264\346*S\\\3415<\201\335M\036\255\366\237\003\265\377\220\365\371mb\002\177\274\305\343\216\021\303\324\247\330\356\nY\237\3535\034\353\252\375\245\324TE\264\332\025\3147\310\324\235j\221\362\365\332/\343\231d\326f\231\"0\317\260\no\227\217)\261\2654\261OF\266E\213\312j\341[\215\333\265!\322\016\236\233\005\313\025\252\023\245\352`\207u\017\255\346\272\272\225\232\251\261RsQV5\035H1k\323"
+	.string	"Y\237\247\225\201\177\250\341D\350\324\220\210$I\222\326\221\004\210)\346\244f7\021"
+	.string	"\261C\016\025\215$)I2\314\001oA\230\3164!\001\365\t\301\347U\224KF\032\\\326,\3457\220\346\001\247\316q\366j\264\024\235h\b\326#\207\215\336\331)\324\347I\232T\353\017\257\256\037\374\237%\214\315\"'1wi\237\212\232\211"
+	.string	"\26020\236\270\320"
+	.string	"\316Rr\324\223\336\034\224\033\273\267\257\261\r\376\314\005\022\325\316\244L\013\307\007O\340\2520\241d\250\315\251\272\220&\310q\007^\201`\313\005]zp@=;\023\361`\021\322<Jk\001\360\346\340Ds\025\227\025s\017\032\2342\304\254\254m\316\024\334^\276\250\227\301\304\204D-\356j\223\231\352> t\272l\251\373&Az\237\261\002\334\324\200\246\021\217xOzp?M{\271\034"
+	.ascii	"\016\016\225\032\202\320\270D\006\210\334\027\317,\302\273\304"
+	.ascii	"4F\306v\b\2766\003Oh.\2447\353\346i\021g\2369%\270\375\232%s"
+	.ascii	"\024H\211\212\322F$\344\032\334/\301)\036\350^\327\b\035\256"
+	.ascii	"\244\210\354\372\221|\2714\002\260o\240\343'?\236\265\243;\013"
+	.ascii	"\310&\275\024\213CBm\033\322\265GW\006\231\t\003`\246{\333\372"
+	.ascii	"\203\276h\234\002\340\233\336\026BF\313F-'\331\004\032\346\242"
+	.ascii	"\254\306\271\022\372\337\215\256\376\323\373\306\234\024\205"
+	.ascii	"\327R\267\352\002\215D\365\270\203\213 \030\207\220\272\301\036"
+	.ascii	"\350\035a\327\244\343\344\021\341\227p\255\fV\005\026#\006\312"
+	.ascii	"1\004\243T\227f,J\254\356\003\265\003\355\262\311,`\242=\211"
+	.ascii	"E\202H\251\301#bO\231\022\223\357J\370I\375g\212>\266\004C$o"
+	.ascii	"\236k\313~\b\267\336G\322\\\f\243\371t\332\232\026\022\036\352"
+	.ascii	"\266\315\330\177\311\331\b\001]76\232\263\360\216\261E<\224\246"
+	.ascii	"\202\231\344\257H\212\246a\277\250\215\222\343\200R\3544\033"
+	.ascii	"I\245\374 i\370l\215\316\367\276\361\246;\265[\240`\037\347\214"
+	.ascii	"\231\2059\f\n\202\246\237\371/f\226t\225Mn\231N!\376oJ\277\350"
+	.ascii	"]\214@\306\276\306x\nz\270L\260(+\270\0320\363\364\235\252\320"
+	.ascii	"z\315>\367\034!i\220\022Ka\231\344\377!\203\364\202\324\200\307"
+	.ascii	"\343E\004\347qt?\220\371\355\254sY\216j\371\352\222\302S\016"
+	.ascii	"?\324m\2048\374\375E\300c\001\004\211\273\267;\013\321\005(\017"
+	.ascii	"Y\353$\356+ql'JdA\331\023sz\327\f\240\310\257x=\211h\254&5\210"
+	.ascii	"\035\374GM\373,x\265\303\206%\037CA\030\216\026\205\300?\034"
+	.ascii	"\f\004\2739\322\302%\336V\244\3368sn\325\302\323\273#1P\026R"
+	.ascii	"\276\206b\025;\266\372w\363\375u\367\030\203-\022\215\276[\275"
+	.ascii	"\343\003\362!\304\225x\025.fC\n_\350\177b\001\221\300\t\304F"
+	.ascii	"\2000\245]@\237\237[\364\272(P\002i\312\233\177IV\251\332\332"
+	.ascii	"\003"
+	.text
+	.section	.gnu.lto_.lto.a023cfc9b88a5f3b,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_mixerNames.216.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`6\003-\025"
+	.string	"\326\344\211K\240\230Q:\n\34799\236\327\270\254{\017\272\306\231\t\364\314\321\202W\341ux\003\234\242u\324\370wj\016\243o\347\334\240\261l=\241\3350\326\016\322\312\225\260\243-\206W\244\017\361\255\013\277\016\217\376\240G\344\266\261\255\ti$\355s"
+	.string	"t"
+	.string	"v"
+	.string	"C|A7\337\004~\323\004\371]\241\233\277\204\337"
+	.string	"\206\301\021\212\351$\360;\300\324\204;t\363\221\360[\200\016\3405\302\357\0017*\020\335L\001\277\t\324"
+	.string	"\216P\303\f7C\300oRF\016\277\013@\0055\334\374"
+	.ascii	"\277\r\300\330\300\341\346\006\370}\300\205\360\312\360\033\301"
+	.ascii	"\na,\352\n\253\304\326\321Q\276\322\273\303\315\"~'8y\017\257"
+	.ascii	"\267=i\255\213\f\337\362.\342\221\210$&\211!f\242\210\234\233"
+	.ascii	"kx4\002\311\201\025s\352s\263\270\204A(\341\267(~\020\223\360"
+	.ascii	"\333\305\005ht\032v\301\357Q\213\026~\367\311\327\225,\374~\235"
+	.ascii	"|U\321\215OL\273\233o\205\3370\254*|\005t{7\237\n\277_\254\246"
+	.ascii	"\360;\346$x\245\360\033f\211\3606\341w\f\022\341\3704<\n"
+	.string	"\374\226)\022A\302\315?\201\3373\001\250\232;K\032{\346\326[\272\352v\264\230\375\325\fY\370\311.\f\005\021\311~EAY\ri\201\030\204\212dF@`\221\f\306\316rpnx\265r\347\023\263Oq\025g\361\026\177\361\246;\375\3511\036\365\031\247q\251\3338\216\347\370\216\363x\217\373\370\217\0039\325\205\234\310\253n\344G\236\344J\316\344M\376\344P\036\345R>E\301\263N\345V\256u,\317\362\255\366\314\255\243Uy\265r\347\363\262\347\216\313\242\345\316\355\264\301\254N\317e\333\332p'\220\317\206;{(O\214\235\365\\\226\267\200\007\263*o-Q\236t\245\245\261\027{Si4\237\r\316\315\214\265\2315\237\r\003\337\211\232=1?0\333\243\3033{^6\375\311\231:_\272\372n\252*\203\226\273\032\214\315\231\253\232\322L\324\206;u2v\206\236\345Z\302,\314\232\2702@\250\021p$)"
+	.string	"\213\334Q\224\222\244\315\320\002\031+z\020(\2020\022\247\003e(\233\210E\275\262\027;|-Ay\252#\305\007j.\222\205\374\315\264\225\233\362\322H\020\346FMFn\022\377\206\362N\3631]\316s\317\246W\002{]9\355u\264\324\025\037rB\332\253u/\246"
+	.ascii	"v\"\372\274;K]\233*\326\254\333uW\246\247\352\005\201#S^\234"
+	.ascii	"\232\272\020}^\204\3431"
+	.text
+	.section	.gnu.lto_featureNames.217.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\272\003\035\027"
+	.string	"\366)\231J\240\332Mc\252\216\222\342$\305\204X6\215\355\255>\223\005^\207'^\341\025\346p\261\354D\377}\034\005q\033]\346\343#\277Vy\254\255\024{\367\373v\032\331\333\033\343!0"
+	.string	"\302\\\035\236\365F\363y\236f\215\021\322d\222\001\210"
+	.string	"\210"
+	.string	"\203"
+	.string	"_\221\177o\236\354\b8}\212\374\213\303\004\210\207\323O\345\337\234$F\370O\3717\300\021\241\331V\227\004\234\276)\377\352\020\021\320\205\016\3414)\377\332\200\020\025\341t(\377\016\360a4\343\242:\302iP\376%\260U`\207\201\034\023\220pj\346\337\0037z\026pJ\346_\0044\2260\340\324A\376M #\003\326\200\323\236\374\253"
+	.ascii	"\306\006\032\326\325\030\2131&\246\364Q\277\034pj\363\357\202"
+	.ascii	"\333\336A\346\267>\327*{\nUn\345X\236\345[\316\345a\027\373\227"
+	.ascii	"\203y\030\006\037c\231l\223u\262 lj\241l\b+\302\216\260R\266"
+	.ascii	"\2045\321cQ\360\20421&\250\246\006\325\236\260*\362T\017[KB'"
+	.ascii	"\342\324J\345_\231\215\262N\371w\366\2644\323\242\n\313\277\367"
+	.ascii	"\003X\376\225\261\036\376\225\177gn\223\021#\204\275\362Xo\246"
+	.ascii	"\325E\343\345Y\371\227\326\305*\377\326\264\324\\y\260\303\351"
+	.ascii	"\253\362\257\r\225r\266E\005\001\247o\221\177\001H\t\346&?}\326"
+	.ascii	"\324\020,wZ\374p\025\315\215\006\351\231\372\252\313M\206\033"
+	.ascii	"\305\355\260Vy\247\370\363i\035*\236\344gS\211v\216(\020\335"
+	.ascii	"\222\216\206\220nDJK\267\035[\355U(R\272]\350\365\224n\265\252"
+	.ascii	"\303s\024s(N\334}$\017\274\251w\361\027\257z\214\317\270\325"
+	.ascii	"k\334\306q\374\352X\327\361\254k\235\307{\374\307\271\036\344"
+	.ascii	"B>\344^/r#\377:\222+\371\2227\271\223Cy\224\203}\312\003ug\232"
+	.ascii	"\343\207Cq\270\017=}t\342\230#\305\034Z5\313s\243\272<\313]\255"
+	.ascii	"\236\243x\242\345\217\016w\255\216\237\250\303}\346\312]\253"
+	.ascii	"\333\324\315\304\\\250#?]Sy\372\fw\341\030\236\264\n\362\310"
+	.ascii	"\352\016\310D\307p\034?\375\231h\220\306\251\346\336\341\300"
+	.ascii	"\017\025\367\3264\325\024\365\271Q0\034i\225\367\215\346\026"
+	.ascii	"A\\\301]\316\252\216\024A\375\001\3512\207\216!I~>8\235\252C"
+	.ascii	"\220,\003B\250!<\353\004R\021\314\254\242j\341\020\003\021\232"
+	.ascii	"u\003\020 c\270\n\322d\f},\337L@6:\312\027\231\2321\304\352k"
+	.ascii	"\200\232m\207]\257mD4ek\233\007\036\230w\002\325wHu~\367\261"
+	.ascii	"\337\373A\320yy\036\037&\210\376\263zv\274:\320\001~\324\021"
+	.ascii	"cEj\34214\250\310y\330\034\351J\013\255\305&,\225\314\355W\356"
+	.ascii	"\322taE`\314z\nc\311\253y\311\003"
+	.text
+	.section	.gnu.lto_rxFailsafeModesTable.219.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375 [-\002"
+	.string	"D\003N"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\177\001\002\005\001\006\025\177\001\001\003\005\001?\202\210\200\030}3\276\0014\275\001\274\001\273"
+	.string	"\300?\202\210\200\020{3\301\0014\277\001"
+	.string	"\006"
+	.ascii	"\200\b(\327\316\t\340\\J\353\030(\002"
+	.text
+	.section	.gnu.lto_sensorTypeNames.220.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`9"
+	.string	"e\007"
+	.string	"T\f\331"
+	.string	""
+	.string	""
+	.string	"T"
+	.string	"\005\001\006\177\001\025\001\007\005\001'\002\206\b}\005\001\212\001\206\200\200\374\233\336\370\313\n{\275\006\005\001'-\206\by\bw\300\005\005\001'2\206\bus\303\004\005\001'?\306\003\005\001'D\206\bqo\311\002\005\001'J\314'O\316\001"
+	.string	"?\202\210\200\300\001m3\317\0014\315\001\313\001\312\001\310\001\307\001\305\001\304\001\302\001\301\001\277\001\276\001\274\001\273\001"
+	.string	"\bGPS+MAG"
+	.string	"\013/root/repo"
+	.string	"\025./src/main/cli.c"
+	.string	"\004GPS"
+	.string	"\fRANGEFINDER"
+	.string	"\004\005BARO"
+	.string	"\004ACC"
+	.string	"\005GYRO"
+	.string	"\020"
+	.string	"\270\212nv\201y\212\033\260\004\340\032d\f\b\203\214U\305\037\310\r\220\3103;\220cA%N\261o"
+	.ascii	"p"
+	.text
+	.section	.gnu.lto_sensorHardwareNames.221.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375 \233\375\003"
+	.string	"\264\006l"
+	.string	""
+	.string	""
+	.string	"#"
+	.string	"\005\001\212\001\206\200\200\374\342\303\346\364\031\001\177}"
+	.string	"\005\001\006\025\001\004\350\317\001\177{\003\2507\177y\002\037\177w"
+	.string	"\002\177u"
+	.string	"?\202\210\200(s3\302\0014\301\001\300\001\277\001\276\001\275\001\274\001\273\001"
+	.string	"\013/root/repo"
+	.string	"\025./src/main/cli/cli.c"
+	.string	"\007"
+	.ascii	"T\021\002\344\326\034\004\362\2659t\235\271\r\240\b"
+	.text
+	.section	.gnu.lto_mcuTypeNames.222.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\200\001\025\r"
+	.string	"&\226VC\340T5\035\200\221\376\333\r\301\274Z\260\207\227\326Mk\256\244\216\f\363\214AX\b\301(\2653@pP\347-\216I\307\310\303K\267\230_c\256\304F|\227\201\025X\263@\234\201\307\036\n\347@r\372'\031C"
+	.string	"A"
+	.string	"E"
+	.string	"\264vR\250\357K\fKkw\265\231\023\352\033\343b\003=9;l&\203\372\026\260\202EO\356\201\372\316\240`\321\224\323S\337\003\256\261\274\371%X\027\230\013\245\225R\226\346C\274=lf\245\276\271\305\374W\031\350\222\233\332\314\223\250G,\215\235g}W\210X\032\273#\352\333$\210\245\262SD}\323k\251\354\232\365\335<,\235\275\254oK\016Kg\227C}\003\200YJ;U\265\206\245\264;\326w\200\0316\235\212$Q\035\2069\b\034\r&Q\201\315\007\202B\031\276\211\237x\212\2538\213\267\370\213\303\270\3532N\343\257\333\b\177\3438\256\343;\336\343>\376\343@.\344C^\344F\216\004\274\222\217<J\t\342\203\001~\222,j\360"
+	.ascii	"\201\202\321\202\004\016.\374y\035\261\371\363>\261\231\344u"
+	.ascii	": (6{<\341\007\f? \261\331\013A\241fn\\\221c\205q\264!\300\\"
+	.ascii	"\004\216T\342\234,\224\272\361$\341BWB\245:\216\206I\f&T% `\203"
+	.ascii	"T5\006Q\214z\325\256h<\026\243F\"8<\tc\374\260G/!\373\232\227"
+	.ascii	"\037\363\362c\236\363\373\3465g\335\224\254om\262v,\266\372\326"
+	.ascii	"\263\336Z\326\231\313z\346Yck\267\254\025\366\033n\021"
+	.text
+	.section	.gnu.lto_cliWriterFlushInternal.223.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`Y"
+	.string	"%\t"
+	.string	"\246\220>8 \223\322\001\314\250\367\372d\035\200\367S\330.P\207S\2240XP@\2127FC\253\r;\tl\374\233\312\207`\n\b\007\202 \367|\0172D\245a\252~#{o\231R-"
+	.string	","
+	.string	"1"
+	.string	"\217P;\377\261\003\264<\325\343\307a<\260\2319\021\360X\021\001$\244\345\261\353\206\267R\0051\354\256\265\345y\334\362\266\033l+\330\226\t\266\257\366Q\236\322\035\226\372\300\256\013\307e\367[pB\350\322\337G\332e\350\004\332\245;[\347\037\311\202J^\032+\263\335\235p\344]0;2\026T\251W\303\021\003\235\322\024\032\230\334\250\344\260\264\307\376T\nE\354\307\335]C\227}\330\257\262`F\363\300\262\333\361\343\2632\371\362\022\005\\\te\342,4o$S\3046'L\020\022s\343*&i\344\023E\211\233\250\323\211\233\242o\037\027\272\354\300#\313\200\253\030U\241}\201\241o9 \017"
+	.string	"\357b\314\304\023\277p]\0034\302\212F\265"
+	.ascii	"\004\016\rA\ba\025\314\273\004\320\254\246\210\273<U\223S4\265"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_cliPrintInternal.224.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\214"
+	.string	"\025\n"
+	.string	"V\322C;0\345(\035\3005|\241)\346X\216+e\240\241%\"\320\225*\277\2668\036@\345\227v\307\307>\205kq\274\326M\2748\030\220\200\203:\316\310\007\211:\212%\2244\262\211\334)\0052"
+	.string	"1"
+	.string	"4"
+	.string	"\235\206|\361\273\246\361\363\037>@\005\236\256q\032W\215\263\261\022\033"
+	.string	"SZB\254\204\343\341\343\nD\305\250a\330]G\025\230q\313\333n\260\355\261/\020,$\266\277\261\035g\305\f\341\321\376\311Q\276\273L'\330e\271\274v\247\202\017\270K\317w\266K\356\234\355\322\237-\363\331Z\215\210\353B\005\300\356\006v\211\"^e\251\247\205\226lFm\332\244\032\214|\244\304\244\242\314\236\247\250 /\223\020\306\312\262?\377\355\256_~\336\312\025t\2748\314v1f\001\026&\003\036i\244\036\210\024\362J\233?\236\020\304\247\223\b=Dt\037o\324y:\026M\200\274\216$\022y\335f\356\225\025\236k\361\200Y(J\323\342\246\252+[\306M\245\006\023"
+	.ascii	"\357b\310\f\355g8\004\207\\\360\n\227\262!T\277\241+0a-\027\034"
+	.ascii	"\204j\213\025\306\003\325\300\02507@E\031w9\252&i`j\017"
+	.text
+	.section	.gnu.lto_cliWriterFlush.225.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375 \362e\006"
+	.string	"B\314,1PO\323\001 [\251PT8\"y\260(\200\270\314\"UN3\034C`#\204\036\013\001aZA\006\371\331\031WU\375rMa\202\276\273\t\2212\245\206\322D\3017Q\3601L\t\013\017Z\016O\np\325\240`\275\207\252\262^\324\355\225;\020\301hJ\341'\2576DD>z\240B3\373%7\231\360?,q\345\343\035\377z\356\\\rXF2\264\314\330]\226\272a\277\331\335\265r\366\323o\004BV\020Pv/2/\213qR@l?2f\267\274\353X\310C\305\342\304ew\237r\034{b\376I\016\020\267\354\t\025\354\2563n\030\267\236\300\266F\b"
+	.ascii	"3\00178\203s|!\\Fy\031\002\\\2721[\333uZ"
+	.text
+	.section	.gnu.lto_cliPrint.226.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`'"
+	.string	"\265\007"
+	.string	"\322\31766Po\322\001\240\363c\255\212o)\247\027\203\225!p\005\026VP\335\275C\205\032A\314\356\310\222\303\331f\314\225\214YFu[9 \356\314EVf-\355&eJ\001X(S[\037\220\203\005!@\f\017\320\3022\370\361\370\212h\300`\350\2720\330\211\373\314jg\205\023j\244\026\326\244\352\325\316$\362\234\007.t\263_r\023\n\377\303\023\242<\367\347\213\252\277kB\013\314\306(Sv\334R9\354gvw\255\235\375\322\257\231\376\0230\255,\270\354f\244b\026\365R@:\266\237\366E>\242\275Tq\200\335.\304\264\033\017\\\260\371s\274\247\372\333<\240\372\263f\263<z\354QT0N^v\027j\307\265\247\346\237\344\034\216\264=5\b\273\353\344H\032\267\3366\201m\003\333\247\t"
+	.ascii	"\357b\310\304\253\276h\217\013;`\324%\254f5\032\334\345E;\311"
+	.text
+	.section	.gnu.lto_cliPrintLinefeed.227.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375 \345U\006"
+	.string	"r\213+3PO\222\016 [\324\r\3479\322R\367|@\220J\026\305dX\257fc\304\332\036B\242\304\243\331\2646Fd\226\310\016\255\344\f\016u\3248\364\232\335D\246\017\020\340\323\206\3630\271\bN\003\204\233\252\t\2671\230\222p\250\034\005EUN\302\262\bzA%\313@\215\243V\221\216T\024\2042;}\026\001\235\004M\243\277\300h}\267\023\224l\003\257\307\256\206\036\337L\"\350\361 \205\205a%\323\023\003\223Yd\002\362W\332z\227b\241lI\013\007\311Kf:\374\250\325f\335\206T\340}\2566"
+	.string	"\205\314\274\275OG\307\376\b\277\346\367\004\t"
+	.ascii	"\357b\310\204\006\340q\200\013\3335\221,\004\3742\004\270t\213"
+	.ascii	"v>\001"
+	.text
+	.section	.gnu.lto_cliPrintLine.228.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\024"
+	.string	"M\007"
+	.string	"b\31624Pm\323\001\244D\240\213`\"Y\264&At8\025\215\304\312PF\251\361\217\035!\024\177\363\0066H\261E\314\"\262\303z\206\262\375\223\316\342\355\377n[\246\024\025\310z\235<\237\205)6|\022\030\342TY\321\303)\345\240PE\020EUq\303\335\322\237\326\003\225n\342\205\212\311\326z\350\240t\241\207U\312|-DD:k\216\234t\024\017k9,\037Fk\351\377\373\264\326\233\235\260\223B\202\360\361[\264\260\274\203\"\033\233\266\316\326\034\356\270\274I\030\340\327F!?W\320\201\214a9s.\206\031\007\\\f{\265%\3464n\020\223\n\217\225\377\361e\370r^\265G\326d\"\314\2111\370\337\314D\027\356s[\201\266\004m\267\n"
+	.string	"\357b\310\304\023\276hq\241\264\031\\\301\274K"
+	.ascii	"\315j\n\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_cliPrintHashLine.229.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`."
+	.string	"\345\007"
+	.string	"\202\01775`o\032\003\024\022\002;a\344\211~\biM\236\277\365m\253`\rH=\306\036\n:$\3142u7\232("
+	.string	"\250"
+	.string	"%yk\355\027\300\313\201h\273\255lR\246\024=\370\004\bD\2154\202\305B\"\bLJ\210\032\"$\246\215d\310\323l\302A\223\244,\323dg\336\233\303S\031HV\032p\243\326\203\260\245\020\261\236\247Y*\006P\177\311\235\305URHpl/0\236\273>\230\220\025\007\344\332\311=X\322z\363\377\205\247\326)\033F\203\221\230\007\227\377\243\206\346\253\250B\351\264\365k\235b\225\315\251\f\023\374'\230\227\177\202\212p9v\332c9^.\260\034\273\2652\236\250sN<:Zf\376Kh\342\315o\253\275b\200\316\304\371q\026\376\367u&\020\027\272\355\247-\250\255*\013"
+	.ascii	"\357b\310\304\263\276hq\241\202\024@\252\225\002$\027k\233\325"
+	.ascii	"\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_cliPutp.230.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`D"
+	.string	"\205\b"
+	.string	"FQ<70\345(\035\2363\2069!=c\2409\264X\203\337<\202\267\024FXO\357\207\366\007h\306\336\3031\307L\b\013\003\206\016G\344\347`d\351Ar\214\222\337M\312\224\002+"
+	.string	"+"
+	.string	"*"
+	.string	"\032\023d\354\272\265.~\036\307>P\246\223\227\377Yvx3n\265M\034pJ\221\214X\303\377\342)\245\341\246\333\036\264Uh\353\n+ m\275i\233\330.0l~\027\315\177#\205\365\277\323\004ck\022\227l^\325\345\201_5\302\372_\247\b\032\273>s2v\001NLg:\005ZTL\001J\370j\037\t\223\2435\346\377\233\252\326+\333\371\331\231X\304`\215\025\204\260|P~\324\013\300[.\021\032\206\\\315\363\221\3202\212\317\303D\246\211F\231\207SP\bB\224U\200@\242l\363n\314SU\007\221V)1\212!\246\313vd\201>\325 #I\r\n"
+	.string	"\357b\310\304\213\277h\300\005\002\346"
+	.ascii	"\346\032\373*\fVP\241\301]^\264\223\f"
+	.text
+	.section	.gnu.lto_cliPrintfva.231.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\331"
+	.string	"%\f"
+	.string	"\326\326RA"
+	.string	"s\233\016\370W\371\n\372D:\275\323\276\005\004\243\026b\256?\373\273\026\020\220\2048Y\245h\266\341\007\3019\354\244\0017\030!yW\275JP\200\026\023,\310V\005\fU\355\377<}\262\267\224)\005@"
+	.string	"?"
+	.string	"?"
+	.string	"\217\326\354\037\367J,\346\204JJK\220\335\245\224\304\265CM\315\377\350\031\256\333\016?\\\241\001\0369R\f\350P \002\025\0211>zn\350B\231\030\007\273\353\344:\017w\274\355\007\266\033\330\207\020\361+?\324\364'N\r\035\027\220\335\016/C\366\2134P\330\276\306v\246\357\202%\203\017\006\276gg\036\255\340i\177\305Yh_\321p\002\273\"\031.\273\336\002'\230\036\355}#=N/ \005\013:w\265-|\362\234\003\340h\361\245\350\226\335\016\0167\324'\322U\302\250\007J\n\261\337r\030'\276\t_0\311s&\322\343UA\314P\021\002\224/\266\267\245\216\260\017ww\255\"\373,\177\025\206\264DH>\007F\262j*\251<\0316A\262\325\271(XT\205\253\362PV\366\241:\033c$\"\031U\202a\031\245\361\366pU\344\b6>\220\206\240\200\264G.\216\313\027\322\315"
+	.string	"2*\324\277\360`\323\006\025"
+	.ascii	"\357b\314\304\263\242p\034\006X\370\025E\350\002\242V\001\201"
+	.ascii	"C\204p\215\030\b&Xq\215]\206!\3014p\305\251\2711\003\005\250"
+	.ascii	"(\342.O\325\344\024M\355\001"
+	.text
+	.section	.gnu.lto_cliDumpPrintLinef.232.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\321\001\265\021"
+	.string	"f\242yH\340\360&\035\3304\021\316\321\017\222\003\337\233\324\003\t\3376\375 \007\351lzT\0327\254K\307\312Z\026\256\177\353\032p\306\017\337F\233\243k\252p\205x@\311v\2508]\354\341\025\0040\006\367\345\3410Ad\357-S\nc"
+	.string	"`"
+	.string	"g"
+	.string	"7\361\372P\006\003\330\345\201\201\264\033\246x\200\367ir\222\356S~\244\373\264\355\002\007^\206=\374\311\361\350"
+	.string	"dSS\332\rQQ\304a\2372*\314\377"
+	.string	"c\237\037.O`\2154\331\335\020p\246Q\032\250Q\002\021\002\312d"
+	.string	"&\033\031\257]q\300\231\252\307\312\356Zo@\017ww\333\016l\263\330\212\022\261\307~\321\357=\374\347\207~i\265v\352\203\374\305*\345\240\200c7\247i\007M\214\311\"\350G\267\217\302\277\371\344\333n\364\372\221\353\253A\207\301\210\240\334\256\016\312\247\025x\237\017Kn\277\354\223mIt\332\353E\030JDvF\003BB\020zQ\037\302J\256\303H\310E\212\367iU\373B\001_\352\303\375,\345f1f\020\245\341E{\202\213\n\247\363\241(\177\212\337V\0028\354\356olV\214\376\306\277\335K\302mX\312\325\304\230\265\004\215\020\240\204u3\266\320l\314\224\351\016c\217;A'\222b\364\361I\367\030\201Vc\246L\026\371I'\343\343k'\320\002'\233a\333\221i\223\035\3064\372\330\227\273\273\016\337\005\235\371V-VK7\363\342\372ZT,2/\237+F\005RA\346k"
+	.string	"\263rI\360\234RqyI\241,\270|+T\252%\203R!1\013F\325B\315\260X-\324)\334\313\215=~\355)C6[\274\212\377\366\0057\204l+\344\017\3534\342\330\326\350\025\232(\373t\311]\236\0049\"m\362\210\332\017 \220X\312\311b\314\"\032\037"
+	.string	"\3571\270\026/,\013zm%nv\005c\255\037b8E\020L\024s\200\314\250\206D-W\244\220"
+	.ascii	"\013\tZ0\3710\b\273\314\326\205\024\027\031N\344\321\336\021"
+	.ascii	"\226\0029\245\202\301\025F\f.\302\035\004\264\231 \210wU\271"
+	.ascii	"\336U\366"
+	.text
+	.section	.gnu.lto_cliWrite.233.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`z"
+	.string	"\325\t"
+	.string	"\206\322C;0%i8\336\363x\034\370U\034\270U\216\310\340q1\301\340AZ\212\314\346V\306\216\235\321\214\020\273)J\201X\035\200\270\341g\004\201\031\331\302*NQG\255(Ub\367\2262\2451"
+	.string	"3"
+	.string	"2"
+	.string	"\273\236\242\034<\247\t\372\257} \024[\347B\256\334\001\017N\013\201\b\343\022HLh^{v\210\257\314\220\303\356:C\021\344\356n\373\301\366\202\375\007\231NM?d \3239\345\354~\334\b\254\255\263a\261\375\221\355L\273\324"
+	.string	"\236\266a\335\225\275\324\354\216\fV\020\2753h\003\370\230\262\241\225\231\230\214\200\r\261\002)\356x\334\250Y\240\253D\214\017,\007\330\207\371\310\362U\254\261\312\207\357\374\025\350\335UEz\\F\\y\263\307V\352\211}nuf\237\366w\001\024_\372#\231N\237ga\212\250\360\276\224\312#\025\030u1\221\3622P\250\2247\032\367\334\352\314\020%6\227\2768Q\246^m\fU>4\002\207\266\334ij\351'@\017"
+	.ascii	"\357b\314\304;\240p\t\006(\343\025H\325\034|\r\261\027\324\260"
+	.ascii	"\240\013yK\306>\225\032'\356\334T\355L\321\024\024"
+	.text
+	.section	.gnu.lto_cliDefaultPrintLinef.234.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\356\001\215\022"
+	.string	"\366\343\177I\300\322Q:P%\254\333GY\027#\271\265\353\255\332\303w\271\212\231\005\006\303A\237B\327\337!\364W\t\024\375\243\277f\213\336\346o\b\316\257\311 \364Y\006]\334\t\306;\345/\226\037\n\363\326\035\202E\375-\"do\231Rm"
+	.string	"d"
+	.string	"l"
+	.ascii	"DWA{\221\006\253j\005\372%\325:\262\230@\352 \312Y\341Az\223"
+	.ascii	"\360\240m\0338@s\355#\t\036\221\01658\360\240j\035[s\304"
+	.string	"k\007\351\334\232\017@g;\b\342\224\252\220J@V\272\034\312\3421\221#\321\341vR\226\223\b\036$\272\034\252\022\302\306\207\363\276:\272\333\256\210K\255\325\233\323y\270\303\333\206`\373\305^\006\001\237eY\226\236A\366\217~\325\307\037|\321O\275\336p}\222\377H(\037\260\031\265\362\224Cp\232\300\030CG\272}\026\276\317+\277\367\026\264#\315^7\3644(\301D\326\332\263r\320\nR\007?\236\334\246\331+\333\324\350;\332\2172\234\224T\334n(\t\301\230\232\373\261v\362 MD4XR\007\275k?\023~>Qd\311\346PM[t\275~udW~\027\367Y\020\260Sk}\316\216\221\021\227\240\242\310\234i\263j\007\3342B;V\263\317\371\276\177g)E\023n\332\354\036+\230n\320)\344\327Bp\356\211{\264}\225~8\375\314)\344\224\360\223\302N\007n\205\030\345)!\235\237\347\275"
+	.ascii	"\212\247\035\216\236\317mK{\264\355\024\262\003\"\206\275\021"
+	.ascii	"a\262\030Lx33\023a^/63\342\254\3465\"c#:\240\201\315*\244\354"
+	.ascii	"j\211\231q\265.\304\210\260\226Kf\323ja9F\363\222\265nb1Yk5\326"
+	.ascii	"\323:\203\274\313;\313S\2577\377\342\367}\301\323\216\036\f\372"
+	.ascii	"\327\302\235:\266w\332\005g\336Nk\255\025\234\321Z\201\022\220"
+	.ascii	"F[:\300\332\017\"\374D\221\267i\263\311J\b\" \200\202\031\301"
+	.ascii	"\365\237\030x\211\027\243x\265A\024\020\266\017\302d\347\300"
+	.ascii	" \225\255@2H\300\207\231\034\304:\344\314\3456\2100d\267\205"
+	.ascii	"\233\"\217\370\261m\240\021G\n\357n\276\275\343K\221S\007\363"
+	.ascii	"\n\203\301\005w\020\240\231 \361\212[\320("
+	.text
+	.section	.gnu.lto_cliPrintf.235.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\233"
+	.string	"]\n"
+	.string	"F\023F=0\305*\035"
+	.string	"\360\2470\330\375#\027\026\032y\312\2513Ba\007R\020\215\322B\211\326\230[\262FP\0370\333\302\304\300\310\345\316\210\b\247I\232A\bgLUz\200\356\243\317\215\366N)0"
+	.string	"4"
+	.string	"4"
+	.string	"\324\341;\332i\346\004\332\251=[\300C\222=\313\330\241\"\333\335m\216\334\273\364\374\277\256\001U\337%Faw-A\025\310=o\033\301\366\307~(\3731+\200\n@[L\356\372\355\377\345\215\035\036\305\273\353\364\345H-\224\020\250\273)\317\251=\231\323\027\\\332g\375\304{\013\343\234\335\025\013\266\033~\234\220y\2375\322 6\247\315ItD\230&=\177\312_\024\007\036\240mq!\017\232#\256\214uc~v\370\311)b\377\262\273\353\271\262\337\372'\346b\225\r\340"
+	.string	"l\242\ni\022\225:\256A\363\bDz\030m\020$Qi\033u\023\033\250c.\202\241\333L\034\327m\233p\177\331\2712\025\353XQ3\303\247\313nH\250\272\344\314\003\222\344\020\033\253\306\f\023"
+	.ascii	"\357b\314\304\2131\\\340G\355\230`\203\304E\300\003\0326J\n\b"
+	.ascii	"\203\350\370U\023\230]S\320pp\247,\006C\344)*\340./\332I\006"
+	.text
+	.section	.gnu.lto_cliPrintLinef.236.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\254"
+	.string	"\265\n"
+	.string	"\026TH; \257\246\003\240\216m\270\"\200\035\315\"\242\326\177\215"
+	.string	"\310T\325\004\220%\312\177\255\037\021a\333\313\214S\3551lD\356\n\003\fr"
+	.string	"\272\t\033\016H\004\344R\001\241!A{\247\0243"
+	.string	"8"
+	.string	"8"
+	.string	"F\360\316\331\274\247;\347}\240;\347\321\226\271I\262g)=Tj\273\373\325\221\217\247\243\377\3307%\213<\005P\330]\323\222\005r\327\333>\260\r\262\317\020\264Um\206\001\263\373q\233A\3118\027\327a\277=\3721sl\363(\343a\247o\307j\301\245:wW\237s\376x\347Npj\337\344'\343_\032\357\354\266VZvMP\244\003(\351\241f;7*\351\r-\210\251\325\016'<3YG?\177\312c\025\006\252\322\276\310\240/\335\231\275\330N\216J\332&I\253\210}\315\356\256k\313\376\353\257\336\003\"\013j\022\225\304\320\2413\030\"A\200_\004IT\372@\221\342\013y\034J\214\304\317\024\206\342\3071\367\232\255-7\224\310P5\345\223f7$\341\204\321\233\005\250\r\216hk;S5\024"
+	.ascii	"\357b\314\304\023|\270Q\213\017\263\360C\270\020H\\\004<\240"
+	.ascii	"a\243\244\2000\210\216_5\201\3255Ed\"\356T\300`\210<E\005\334"
+	.ascii	"\345E;\311"
+	.text
+	.section	.gnu.lto_cliPrintErrorVa.237.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\265\002\265\023"
+	.string	"\226#\200I\300\224Q:\350\036\025S\207\346N\036\t$\232j]\006<\003I\310\305!}\004\220_\304\240\023G:\266\024\377\355Nr/\003\375\370\242\366\243\255\343\231\257\311\020\204\350\264\245x\240\355\235B\312\324C\027.\037\204\354M\244\224)h"
+	.string	"b"
+	.string	"q"
+	.string	"\327\"\345\325\324\310\203\n\350\006jZ\352\036W\236 T\371QQ\246\312P\tL\225\257\375Et\024jp\350DO\022\222\356v\261\n\255\351\224\037o\355\n\272\230\350v6\235$T\256v\271\217\325\335<\373\215P\376\016"
+	.string	"qj\261\332\341>\004(R\314\320$\335\017\273\235]\320\245\273\277\272\235\b=\250\377i\376\307\374K$1T\206\316u\305mpVu8S\245rJQ\324\017\257\304m\247\376\321\266\034\364\353\327\335}\006\372\025I\365DG\325\225\032\251\252\276\375\344\275\344\375\307{\346\375\362^\013\250\324\022\022#:B\272CL)\351'\211c\350\277\252\376\357^\217\220:\030\b\320\270\243\037\006W\030\277\211\312/\030\227(\320}**\345\016\311)<\026?<\224=\341_\302\004\361\bQ\017\n\307\266\017\330\023^\261*Q\250\020v\337T\367\361/\302zt|\314>9^0\305d\302\334\213\212J\276\301\f2\231P\361\262x\330Vc\231}l\364T\253JJ\203fE\250;\247:Y\230k\240\362\3176\254\352\016\300\211\367\304\303\266\335\375"
+	.ascii	"\321\304\327\231\312\026\216\206\3406\311\257\001o\265Z\337Y"
+	.ascii	"-|V\013\314\013\006\306A\253\325R\211\034\026\026\253\261a\311"
+	.ascii	"\320\304\360F\224\321f\030fL&B\270 \203\201\207\261\314d\200"
+	.ascii	"\2714\314\2102\027\214f\343bA\371\254&Fs\335\314f4\227jle )\265"
+	.ascii	"\324\203\272\361\316\344 \315\231A^@\027=\210\242n;\325\3356"
+	.ascii	"\2313\347\223\372\310y\360\272\276\246\312\311\354\303\243\367"
+	.ascii	"9E\210\ts\2576 \360\002\0211\353/b\f\f\2551n\311\215p\254Ce\016"
+	.ascii	"\023\332\3351g\350(\003\357\022\033\306\260\315\274\224\303\311"
+	.ascii	"\002\214e\314\036\243\220\267\244\3157\227\0237c9\344n\361,\336"
+	.ascii	"\023q\256\245\363\030\024\365\272\244\271\\\323\241r\325\013"
+	.ascii	"$\"\204\007\306\330k\3016\316\021\005\3061\370\303\334\240I\026"
+	.ascii	"\313\347\006\214(\302%\016X|\271u#\303M)\352\036"
+	.text
+	.section	.gnu.lto_cliPrintError.238.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`e\001\355\016"
+	.string	"\226[cE"
+	.string	"\261\266p\360qf\330\201\005\230\242 2\177\030\207\246\276|\024\304\326\267\"\0237i\r\223\002\333tT\255\031\023*\037J#[\2626\366^P\225 \3201]\231\205\300\343\304\353\307\320\354qX\275\264\211\224)\005M"
+	.string	"L"
+	.string	"Q"
+	.string	";\206\030\201\347\231\307\203\264g\236\023\320\2369\264u>\246vS\271\360\300\332\331]NS<<\246\031\372g\035\200x\"\035#q\305\026\344\234L\b8\251`\237\021:8g=?\234R2\267\007\273\353\024O\"\356\354\266Gl7\260o\023\307vw\255(\373\343\277\375\345\3274\235\232\376\3478V;58\274\330\r\361\312Q\272\311jT\227\371\355\237\345\217\017\363\230\3602(_\023\313\210\nFk\227\005\344\231\025x\236\275\300\230#\301\323>\213\267\b\377\322\341\036\273(\232\031\033\332\222c\233\0236V\252.>\321\256\022bh\250\344\r\3731.\343\304W\341\n\242\274(\322\236]\265\005\307U\242\224/w\344GjSM\355\017\004\271V\256\226II\336\022\344\2379\253\304"
+	.ascii	"\b\321\316\260!/\332\303\225r\265V\224d\217\244T\027;\356\b\240"
+	.ascii	"\235\2064\351\276\021HA\013}\035\204\t\237\267\331\023\021Y\360"
+	.ascii	"\270\013\242\356\343\274Q\t'\0022\210!4\342L@p\304}\306=\266"
+	.ascii	"\212\"YqS\322\024\243`\273(\034\264`\362\205\r\310\317\274&B"
+	.ascii	"Hj\327t\221\304cb\360aw\336\201\025%\321\204R\003  \220\202\021"
+	.ascii	"A\273\001\377bL\343\205\021m>\3679\262d\335\336R\035F6\373-R"
+	.ascii	"\316\313:\346\007\316\036\336\216Gp\214o\340\326\220%\"\022w"
+	.ascii	"@\nw\355\354\202]\016\254\177\034C\016\3155X#\002.\212|y\322"
+	.ascii	"\344\024\315\357\001"
+	.text
+	.section	.gnu.lto_cliPrintErrorLinef.239.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\363"
+	.string	"\335\f"
+	.string	"\026\330WC\020q\233\016x\0259I\006P,\213BC\003c#D\301\tz\264\357\376\005(\341\340\275\\w\361'\324V\257\027\262\310J\340M'\324\b\"Td)\271b\316=\351E\220P\316{\300\354\273\321&{\247\024A"
+	.string	"C"
+	.string	"G"
+	.string	"-\276\213\200\216\331\035\321\210\261;\"\260\201\353\325\3433\325\353u\001\325\253?\373\306G\322Z\245\032\036H\224\335\305(\212\177\237\237\177\362\0251\004\374\264\032\354\256\247\030B\342\246\267]\300\366\002\373!\002\273k:\262?\376\365\"?E\247_\271I\005\n\016\220\216\335\021\247\035\241\223*\243\364\222\337\376I_\374\221\223|/\001\371\206\"\007%\033\345\256\210\363\352\004\327\3535#H\023`9\220\2008\360i\237\305\003\241\202\215\255}\b\334\305_h\360Sx\3026/n\325\353)\204\034+J\204\346\311\226\271!UJQ\233\3532&QJ\031R\320\326\344\374&'=\006\210\020\355\013\031\346EcL\037R\312\016\024\264Gp\322\023\366\251\r\266"
+	.string	"\240\031\206\371\221q^'\241\372p\331\203\b\234fY\353l\0244\254\302\226q\230\346y`\235\214;\013\037\017\373\350:\017\273\214{j\351\310\236\031'!\272\301 \324\256\t\006\345\310<\0313or\030\236\ri7\274\230]\001\027"
+	.ascii	"\357b\310\304\273\274h\361P8M\214\244\221C\004\213\306)lc\013"
+	.ascii	"4\214\224pD\203\335\233\300\3165\260`\216\204\263\016\343\230"
+	.ascii	"\220\0030\f\206\005\250\320\340./\332I\006"
+	.text
+	.section	.gnu.lto_getMinMax.240.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\026\0035\023"
+	.string	"\306\340rG\340\322&\035\367\301\323\334\315\004\211\374\233=g\034Q)W\235\254\037\214\336\021\032,B\320J\f\241\326\2750\266\025\261\275;\366a\301\016\275\322H\226\031f\030A\2341\341\231\3629J\200Z"
+	.string	"\330\316\215\020\262\211\224)\005["
+	.string	"W"
+	.string	"`"
+	.ascii	"\366S\\\305\3534\226\017\330\245\301\321\263\033\222\030\301"
+	.ascii	"\367\350\360\250\356\361\373\251{\364\313&zh\263\336\315\217"
+	.ascii	"\030\217\321\356\202Z\363\327#\247\371\362\017\300\364\220\315"
+	.ascii	"`\217\nC\203\373\3169\0247 \262\331\210\253\013g`w\001\314^2"
+	.ascii	"\275\007\273\353\224\315B\334\335m\233\330\006m\005\021\337\356"
+	.ascii	"\213\003\237\247\202\206\357\004K\367x\215\261\242#ZK\336\354"
+	.ascii	"\020\226j\302>\267Jck\372t\235_\300\303?\300i\277HL\227\272\364"
+	.ascii	"\027\323^\227\356b:ri.\246\225K\247\246O\200\202L\320\207\242"
+	.ascii	"\335\230\033\322\326\242\317\215\355\233l\035[\203\f\375\343"
+	.ascii	"C\3013\361CdBRU\037KjI\335GEbc\225\317\26002\264z\317\205G\324"
+	.ascii	"P\252\251\306\226\363\027/\020\244\006K[\356.L-\303D\036\022"
+	.ascii	"P~\244\203\341\307\210F8\273\366]\330"
+	.string	"&\372va/\341\224mL\022\316\316\354\202\307\223~\347\ff^2\311\336G\272\353I\2351\031\027\263\316\242\025\036R,]Y\261\324\225\352\240V\225\2540\250\300\225U\212\005\252\\\033\300\022\224[\031T\\ \207V\313\005\232\302=\267J\343O\210D\255E]b\t\345\323\222\311\205\202Nj\237^\204\314\212\034/\245S\017\302wDH \341:NrtZ\252\271\035\265x\362\260q\021\205\3238\341@7lpG4U\377'\3055D|\377t\017H\250QL%\025RD\023\244\240 %i\306\300\002\221\251\272\r\0210\275S\246\212&)\324\034\337\374\254\312'SoI\005\n\304f\221\211\t2\363\277\357\2222LV\372\367\322s\220B;\323\201\316\016?w\200\226u\316\330*1{eI\017H\004\325\2179|yx\243\207\205\202\341\"\3410\212Br\310\210\332\327:\325g\230\366\236\347\376\320 _\210"
+	.ascii	"{c\326\2179\\f\246\2072\246\367\007ek\355\235X\276\003\207\016"
+	.ascii	"\3757 \257N'\r@L\202`\216\311\256\241T"
+	.text
+	.section	.gnu.lto_printValuePointer.241.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\275\024\345Z"
+	.ascii	"\212\225 !N0\220\322\351_.U\006k\013?ff\317\254\375\237w\375"
+	.ascii	"ot\244F\022\367\257\360\211Wb\3610\2357\244\325\233+l\221Q\020"
+	.ascii	"\360\303\334[B\240 aXc\3313M\26404\352\202c\030<\266[\374x\320"
+	.ascii	"D\343\213\231\220\225-\245\224\002\374\001\320\001\b\002\\$:"
+	.ascii	"\023\255\263\252:\333\242\363\220\350\374\252\263\253\316]\005"
+	.ascii	"\024\030\3277E\315\353\377\340\256Wa\016Wj\361\226\364]\267\226"
+	.ascii	"\356\272n+=dn\346\306\302\235\245\361\330\250\205\363\206w\256"
+	.ascii	"\005[\021&\367>a\024\333\336q\336\022\013\356~\031\317\304\340"
+	.ascii	"\334n\270\367\211\200\035\033\333\326u`\203\332^\213b[\346\226"
+	.ascii	"\343\246cc\225\236[\333\n\347\365\005\273\275\205\246\006\005"
+	.ascii	"\274\3672\265\345\025\305\266\313\241\033\231\331:s\t\250\265"
+	.ascii	"\247\\\320pJ\26297=\024/\205\321,\031\341p\032\374\354\\\254"
+	.ascii	"8!M\355\314\355\326P\326~\343\240\221\367\032\331\313r/\234\b"
+	.ascii	"F*\266e\270N\252m\213\335\243\266\345\225\371\314O\326m\236P"
+	.ascii	"\023\242E\345\206{\357\323\233\300]\330C\270\346\243\257\rB)"
+	.ascii	"\211\211tdT\264$R\016\t}\b\002\372\361\320!\351\323\303\203\334"
+	.ascii	"\321\311\3019\032ol\212D\325\016\177\311Wn\342\024\2256\202\006"
+	.ascii	"\306\375\321}5\033\204R\022\226f\332aq\244#\243+t^\264\274\263"
+	.ascii	"\233s\"%qjH\b\212\233\177x\362\346Aw\r\264\002^\233\377\350\265"
+	.ascii	"\007\275%\336\201\357\251d\270\\{\336yR\005\273\023\334\247\316"
+	.ascii	"J\224$z\266\307\304\026\317 Rp\307\214\232\216]\027mP#3\203\031"
+	.ascii	"\030\222\3169\222\206V\244\315\236D\324\233\274#y\\d\366D\242"
+	.ascii	"\342\f\211Y^J\232\357\2517\f`\r ^\323\265w}]\371\261\004\260"
+	.ascii	"!m,2\003\033\353\233a\b@-i\232\35796Lz)\341\352\265\247\230\333"
+	.ascii	"\\)\276\021\333T\022I\324l\3235\002g[7\270\t\232\201A{\330f\317"
+	.ascii	"0-g\226z\364c\023\273\371\302\262\337@\206\364\3220\004\221/"
+	.string	" 4\337\223l\230|\341L\206\246\322EkO/\356\304\251{/;\327\027Xs\210f~'f\026\201\031i&;\217\334ye\\\027\232>5D\235\033r^'\260j\2152\201\3326\347\370R\217\343\315{\252\361\217\337\3165\343+\373\272\252H\301\25074\330\374\r\232\035*t\250mm\210/\365E\342+\317\270\304\200\351\236\362m\261\254t\365\373J\233\241\032\232\336\353l.\003\212\316\031J.\022\360\346\342e\3267\331\276\372n\247E\b\244\313\374x\301\315Cmk\277\273\304\376\245~\370\355D\341\312\013\031\352\377\225q[j\264\b{\257#h\"m\372 \357}\241P6\374\350\037\367t8\007\003\367\230\177\362\0027\237+\t\303-\246m\032\223[v\227\2760\363\231\342\275\315&\322]v\325\306\230\334{\227\332\272xR\346tB&\366\220\352\357\302\213\177\323\365\0200\314\256\355\253t\311z\376G\271;"
+	.string	"\2645a\226\340zHM\361M\245\213|qd\260|\r\267\264\207\324\376\024\317\256\025v\3051:OF\361^\254(n.+\326\002\305$\032\250m\373_\313\024)\021(o@\274\220\031\256\351\037e\356\216\342M\327\360\033a\246\321o\3353zJ\367\013\325\331\205\352L\325\202\305\212\256kV\321u\315S-\245[JuN\321p\335(\222\316"
+	.ascii	"t]sT[i\206j\347\023>\316&\254s\t\353L\302:\217P\235\237\332\331"
+	.ascii	"\251\307Y\204\321\271\311\350\314\324\343\034\302:/\251\316 "
+	.ascii	"x\234\225\254s\222uf\"\235\221\220\316GHg#\035\347\"\034\347"
+	.ascii	"\345\2153\221\352\254\264\316C\252\263\220u\376`\235\203Tg \244"
+	.ascii	"\363\317\216\263\007\243s\007\243s\322:\373\3508\367\3448\363"
+	.ascii	"\030\235\221F\347\035\353\254\203\343\234st\3061:\037\215\316"
+	.ascii	"F\353|s\343lc\343\001d\215\327<s~[\244\316o\3468\t;\373Ar\262"
+	.ascii	"\026!\232\222Pt>\340S\2776i\3267\233\254\331\304\303G\371\002"
+	.ascii	"\365\305\017\020\304\357\205\032\372\312`\371\232\2751F:|\224"
+	.ascii	"\221\376\350{\355\314\331\326(\324\232\b\244o.\320:\3017\245"
+	.ascii	"\037}cq&Q\177\3647g\320*Z\204D'tV\222M\365\266Y\027%\216\214"
+	.ascii	"\237\365QNM*\b\230<\303'\203\317GY-\222\206g\352\325\"M\220*"
+	.ascii	"^%K\263\263\342U\262&:,>)7F\230\323\342-P\333\323\272\303a\352"
+	.ascii	"\250\357J\302~\302e\363\222\306~D:$\213\233\n%\260\233\260\314"
+	.ascii	"\3721=7\025\214\260\177\300&\304\314\271\356M\361G9\265,\202"
+	.ascii	"\200\356\325\355\203\320\036\243\237Z\357\372\304\250Pl\220\247"
+	.ascii	"\350U\274\203Y\357\n\245\350\215g^a\201\310\345\257x\007\263"
+	.ascii	"\3365\312\262P\0040;D\317\002\315zU\020\275\361L\210\030\020"
+	.ascii	"\272\347\372\362t\276\305;\230\365\276(*\337x\346Aa\227\230\177"
+	.ascii	"\265\r7\236!&x\311\3611\356)!\224{\314\232\021\270\371\316x\b"
+	.ascii	"e\034\214\375\003\016\343O.\242\335\347\205\243\372\266k\344"
+	.ascii	"\\\337\023\251\226\023r\273\320\375Tf\322\316\f\301\371(\353"
+	.ascii	"p\031i\274=\262\304\324P\3375\364}F\350\207\204\310x\362`M\241"
+	.ascii	")\b\222\320?\245\275\001\361\302\036\336{\357\261\241\236\306"
+	.ascii	"+\257\266\356\334\330\344}\305\271\326\264!\264\025I\321IC\351"
+	.ascii	"\204u\211\317\365\025\221b}\263EX\222\006z\363Q\206\372\017\337"
+	.ascii	"fqa\234:\350?\274\rt\022\001\372\240o5\327\222\241\204\306"
+	.string	"+\233;\327\024\220\320V'\236\265\266\265\025B\003\372\036\022\366Wf\363\363}\305\257\034`\277\n\254O P\333\376\274\333ux\251\3670L~\207\344+\373\202t\361\353\236\366}\025}\006{\336g\r\215\025\212\r\265m\017\362\245\236\247k\350\\\305\\\242XV\300\\\n`\200\213\002`\304`\261lA\305\200\002\r\314\230\021\203E\020\213p\256\200\371\\@\0011\206\f#\306\262\212\271$\262\017\346r\304R\345&g\037\314\347*\346\357\300\241\3431\250\241\343-\216\316\221\303\207\004\303\0367,\330\201\203\207\0027|\344\250\361\343\330\243\306\217\277\241\243\006\214*\0356\210l\303\tG\016\033O;p\324\320\361d\243G\005ONI\346A\301\215\036O\026\360\340\321\343\311x\373\215P\351\356\340\257\213\024\310_\261\223\320<\325\364A2A@\300\360\250?\001h5&\t\355\257\350\334@\251\355\214g\266\"c\025\303"
+	.string	"eZ\3374\343f\254\006O\274\032\006\265\241\355\355"
+	.string	"g\266\232\301\252\206\t\336\244WCaJ\240J\037\345w\201\311^fMk*\323\f\224\332\276\013HR\017\300w\0010\245\362\340c\230\364Qg\266U\240j\342\177\304\225q\030\326k\025\310\201\332\326\304+\373\310\272t\211!\351\236\373c\223\"\361Y\251\031\262\022,:) ;j,.&\307\037\364F\215Z\023#\246.Q\246\251I|\211o\255\260\021\037\365$\336\355\234\204O?\342\033\007\377\"\243i\272\207\364\364\275\006\035#\210\326G\271\2662A\300\"\247\307\322[\215X\r\256M\265\255S\323\207x\021E\246o\212z\246\007\032cU\350yk\263\345\246\\\326,%\264-!^\025\203\206\021|\003\262\\\002\361K\337W\256EF\3131\361,kVR"
+	.ascii	"X\374n"
+	.ascii	"\325\032\362\272\305\325\226{\355R\333\202\370\226K\363\300\353"
+	.ascii	"V/\002\276\374\312\372\301\211)]\323T\351\033\020\032\246\355"
+	.ascii	"-\332~j\244DJO\201M:\224\364L)k\b#\024\235Ub\244\316\260\265"
+	.ascii	"4\241\217:\n\035\003\013o\347\267\365!\351]I\334\227\273Nz'2"
+	.ascii	"aAw\327L\nP\212\027\022\307\352\300\200\242\236\251\245\231\217"
+	.ascii	"\001\264\205\266\260\250\357-\016E\202\026Lxo\351,\275\245\361"
+	.ascii	"\230\013\027\212g^\307\326\201\236\250q8\343\030sdFDD$I\222\264"
+	.ascii	"\006\241\005\304\030\306\030\263;\022\240cA\211\224\314\231!"
+	.ascii	"\222$%5\352t\347'\345}P?iw\027\231\344n?\277/^D\325\261\224\322"
+	.ascii	"\340\006|\\\020r\257\355\221kR!\246\336\213\322\226d\375mj\201"
+	.ascii	"\002\003\007\3244o\214R\220\001y\207m\372\312\300\3719Ly\226"
+	.ascii	"\231\0231\217\024\216\035\217\277\245\312\356\020p\267S6f7$g"
+	.ascii	"\336\323\315\274\364\370\300e\336+5\031\005\2604\316\371\355"
+	.ascii	"!q\233\340\007\252!\203\313Ts(G9Z\207\243\221C\335\271tV\271"
+	.ascii	"\335\330\2422\354\227W\225 \346\313\347\372\016"
+	.string	"E:\234\f;@\017\221\313\253\271\250\306\360\030\337r\243\217\020\341\254\233\212\2273os\274h\026&\330\345xIX\250+\244N\024\007\222%\372\317Y\232\007\305\3320c3\307D\232r\245o\314ZN\226)\216\2563\013m\036\206\337\357\305K\272!\272\027g/T)\204o[\004\275w\355l\257\360.G&\227>uVL\306\367\323\213<\006\224X\273o\322%I\360\317\257\244\271\367\007\373\374t.!\366Rhr@\237$R\217F\235P\212\356\362\273/\226-\272D\021\352\211\200\2547\340\342\254\021\313%\035\310_\324\265\2632\334\361\336oG\030\2337\356\207\322F2\273\267$\232\234;\257\017u\257\302\250Z\220\026\001Z\355\177\300\"\251y\324\"E[\376JS\352\2725\240\t\316\354C''\311\314\351je\020\210\003\341\3328 \302oT@8I\276\337\336\264\250E\251\215\367\360\2444\255\310\367X%"
+	.string	"\255\310<\275\310\036\026\267\352"
+	.string	"\353\273\b\351H\342jdC\254\210*W\333D\2653\006\271\361\300'\300\361.\215Q7\311#\031\226\221\231\344\242\201\350\342\310\350o\334\271RPU\376\344\tD\r\3358\003i0\017\346\236\007\002\370\005S\210\004\215$\346\317\210>\336\313\331Y\200F\255\001\303\200\304\226\322~\317\003\002B]75\205\006\354\003N\220\341&]\215.\223Qu"
+	.string	"\212\324\317"
+	.string	"e\001rf\2028\261xD\335+N\345\275\023\347gQ*\201\204v\245do\224\030\336Qb\340\375\214:\020\267\001\215\226\206\025\337\376\325\306\343z\251\322R:\244\275\344\006\3534\204\364\023Rdk\006\231\241\354I\025\327\270\r\223\272\253\206\214\352,\351\325`\215\364\t\216\311+Db1\220\f\\\361A\220\317\372\224\232\342\305F\263"
+	.ascii	"\377\023\004f\004\214\253\272tr\r\3748&\217\363\177\367\346\250"
+	.ascii	"\200-X\033\257\374\022\257\031\n\250\305\360\243\330\364\333"
+	.ascii	"\352P\027)\272Q\\h\235\006:n9cu\266}<6\343\022\331\265\261\210"
+	.ascii	"U\330A:\0029\276X-@\222\022/P\241\3604D\027\365\345\226\324a"
+	.ascii	"\246\020\2143%\361\276X\301v\322\tJ\021\r\237\354\343\216L\346"
+	.ascii	";\351!\302\242\335\312\321V\003"
+	.text
+	.section	.gnu.lto_valuePtrEqualsDefault.242.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`I\f\2659"
+	.string	"\312d\b\026AP\244N\007e&?\200;\351\365+\271\335,\377@`\331RD\023\276\307\202[\007\200\bMY\211\360\212\002\327\370|\005\021\245"
+	.ascii	" \"\323\3653\237|\366\005f\246\252\231\325EMh\023\271wJ)\005"
+	.ascii	"Z\001.\001I\001e\351}\273O'\016\212g\345^\350\206=\216\366m\273"
+	.ascii	"\215\243\216\024\302\300{o\204\265\325.\355\205\254\277\324\220"
+	.ascii	"B\203^6\242^\334\031\274\253V\371\301\332\252T\312\305\t\363"
+	.ascii	"\241\354\207\251\350\242\351\351\250rgn\274\326B\326y6Zy\357"
+	.ascii	"\034\2373\367B\017\360\200\265U\206v\222mu\355#\333\252\202\006"
+	.ascii	"d\\\306\224f&\210@\n\240\323\313\240{\241Y\217\204\373\260Sh"
+	.ascii	"\363\322\313:j\t\365\344\324\304\264\244\224\204td\244,\"J\016"
+	.ascii	"!\217\306\342J\264j\372^\306M\354\342k\rgK\300\250\261\231uT"
+	.ascii	"JL\343\341\244\347<\363R\255\302@4]\306\351\313#mZ\032\212\311"
+	.ascii	"S\226v\302\222\305\233\260\\q\246$KOZ\311\311\023Or\322\304\221"
+	.ascii	"\340\216\226\264\221\222%\256T\222\304\213\322\273 Q\210\342"
+	.ascii	":i\367\214\363!8\"\216\\\001\335\355\020\224k\303\353#O\311\265"
+	.ascii	"\ti\243\335S\210\027\347<\203\244RSvO \276ZaR7\244\345\236o\326"
+	.ascii	"\030U\022\345)\271'\236%\022\273\356\275]\246E\334\251\t\312"
+	.ascii	"\265ii\353\326j3\315S\037\375\251\001\2707>\222lhi\222\034#|"
+	.ascii	"\232\257}\215\355\314\235\330u\357eWckk\006\320\314\276\202\231"
+	.ascii	"A0\033\233\001@\n\021\036\365H#\364\320^Z\006\337|\275\316\321"
+	.ascii	"\323\203\346\205\334~\275\264\375\f\236\335\371v\306$\272\257"
+	.ascii	"\304z/\232\003\3563eO\023+\223V\271m\330V\373\267\200\024\272"
+	.ascii	"\222w\303\017\231\241f\376t\314\255UWh\310?\307l\241B\027\205"
+	.ascii	"\t\022\"4\227n\256\206voA\320\352\274\356\007\252s\003\325\231"
+	.ascii	"\201u^`\235\025X\347\004\326\031\201u\316j2\315X\375\245\371"
+	.ascii	"@\35753\257ZL\263\201\242\263U\321\271\252\350\\@\351L\240\350"
+	.ascii	"L\245t\036\200t\026\200t\016P\344<E\344,U\344\f\200\3109\n\351"
+	.ascii	"\274D:C\025\235\237\212\316NI\347\246\2443\323\220\363R\322Y"
+	.ascii	"i\3109\t\351\214\204t>::\033\031\235\225G\347\"\2433\021\321"
+	.ascii	"9Yt\036*:#U\347\243\352l\\\235\213\252\363\272:\023\211\316\326"
+	.ascii	":\253\3269U\235_uv\325\271/8\275\321\243\323E\212\237\307\003"
+	.ascii	"\275<\016\r\257\237\212\346I\223\351\376\322\275\327-\246S\346"
+	.ascii	"f\3561\334e\370H\206\243ug\360\006}X[mf2n0\035\246\371\370\310"
+	.ascii	"-&\032\214\270^\371Mv\006Shpa[-J\376\326\023%_%4\364t~\032\017"
+	.ascii	"\235\356\275\277(\310\247c7^5\261M\221\331YY_\341\335\216=>]"
+	.ascii	"\252U\030\330g\374\271\032v\350;\320\201G\376\320\267\363\355"
+	.ascii	"\370\310og!\343\257\177|b\037\247\033\230\221\353\213\377\344"
+	.ascii	"\2459\245\005clX\271\303l\253\353\367Z\220\033~\310\366\267\236"
+	.ascii	"\370\335\234\202\365\366-\231\2462\344[+v\231\275zb\237\232*"
+	.ascii	"z\177-\336\374\314\234\020\363\021\272\271\255O\307\335\207\033"
+	.ascii	"0U\362\307\275\347\343\360p\347\361!u\270\355\364\033\224[D\016"
+	.ascii	"\367\034\006\\\3575k8\356\245%+r\357r@\271\367Zu\034f\006\354"
+	.ascii	"\206c\300\265\356>/\364Z\265\332\340\273L+\367\376~\3709\275"
+	.ascii	"\020\023\033<\0306il\304\247c\333\327T!\274\335r$%:<<<\354*{"
+	.ascii	"\340\327\330\252\017\341{0}f\253\357\321\246\341\231\037\362"
+	.ascii	"\177\372\315\241\335\224\030P\327\006\252\356\277\237A\272\\"
+	.ascii	"Q\237\216\227\232[\340\274\326#\277l\201sf3\177\315\357\315\314"
+	.ascii	"\034\246\376Z\357\203\316B7:4\233\022\314<\354\241\327\200\240"
+	.ascii	"\312\023\242\243#Z]\346\361o\273,z\fl\206\214/1;\006cF\330\205"
+	.ascii	"1\030_/\276\300\276\220.dx\275H\307\300fx\255\370\302 6\026\303"
+	.ascii	"(6\026\343\305\274h<\253\300b\001\246\"\013\006\013\257\027Y"
+	.ascii	"*\304dda%qX\214/\261\254\261\2600\261\254\343\r\354ty\365\021"
+	.ascii	"\"(\375\376\004"
+	.string	"\375n\374Y`\324\323\361Q\r\312\302\017\272Ss\232\261W\215\365k\234B\031\250#e\220\323\214\3555\254g\276*\250f\211\036\0344/\354\364\336{\227Q*O\022\336F\233K\023\336\246YsD\341m\0327\242\256vk\366\3019VxN\211Wo\200\331Xo\341\225\316\352\3304\341\340t;!O\203rjb\366\202\005/\341\311\311\252\352\255\n<\325W\331\325(\300\365\004\374\226Q\251\201\302\266J%\340\267~@\032\340\005\004h\212>\341\023eRJb\266\002\005?aIi\352\001\030\226\345]\230\342z\251o\0324\264p\301\313\266\n`\371[\037\325\202\032\352\227Po\275$E\215\350\331\202d\244dv\202\004O\341\310\350\347\376\364\223\323?5\275\023\323+}\323\023\007\t?d`\342\372\245\177\212\022\212\310\360e[UB\372\255O\362f7\366\350\221\276\233vGo\243JAw\256\024%\207\230\215"
+	.ascii	"\301w\021=]J\001-\214\225\344\317\261\321\027\235\b\200\370\250"
+	.ascii	"Q@$\031S##\"A$I\2224\006\360\002\021\031\252\315\001\021\020"
+	.ascii	"%cZ\325\202\250\320\030/\340\336"
+	.string	")8\246@\200R5V\227\351\223\312\366\353%\034\275%\361G`G\315\275\334\211\262\311<\201O\277\bQ\353\260\216\003\331\305\324\337\202\347\236\n\356}\254\333f,\225?\317<D\235#\232\007\346\321\276c.\005Q\262\024Wo\353\227\364\026\020\032wm\375%\361\020\214T\260m~\252c_\214\363\252\245\252\332\033}0\234\224\332.1\216\204eij(\233\355\214T\246\020\2050Hlj\246\200eE\313R\257V\375Wq\277\377\244e\356\364P\374l\1772\350\225\177\214\376\333R\036\257\330\304\030k\252\352$N\b7ZJ9\322ng\271\032\326Q\251\221B\020Q\336\332\314d4\024\335l\r\316\026\023Y\245\234m\\\3442\250\307gZ\3442@\005z^Q\260\3411\020\20416@\b.\tV\313S\017p\336om\216n<\203\036\350|\314\255\365\243\357\031\t\216\006(\033x\300\373\215o\002\234\031w\215"
+	.string	"0B;\365\006\314\321\343V\211ip"
+	.string	"\006A\245\333!\235F05}\0330F\212H\\&\032l\314\203zE\202\336\223\266)\305\324\352q]w)\305\374\2256$+\305\371\326 \375?\223\214 \020\\\001\307\177C\200\200\266I\377\347\327\372\006\251\204\374\0355BA\311Wg%jH\241\244\373\016\2622\342Rht$\3624\031\220\215\206\203a-\302V\217W"
+	.ascii	"\367\\;:He\342\224\f\3153\345\020\326T]R\361\246\224G\r"
+	.text
+	.section	.gnu.lto_cliPrintSectionHeading.243.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`e\001\335\017"
+	.string	"\366\334kH\320\360(\035\272\2307\035\"\254\242\243\2540.*\202\024\277h\023\273P7v\300\254@\251v'\324\314G\351\253\376\373\r\236\366\257\372\343\027\253\032\256\320!\346\226\370\032\350\244j\246\212~a\nP\004\261\242\b\332{o\231RX"
+	.string	"W"
+	.string	"T"
+	.string	"\237\303\213\320O\357\001\350g\374\360\331\351\224qg>\355\224\201\206\030DE?\240\314\247<\235"
+	.string	"\241\004\240\307\305M\312\0059d\274"
+	.string	"\001m\222\3226\324\230\300\333Fi\362A*\001\002R\220\bL\270\2608\317\027\006\254\355v\224\324Z\275/\340\205\273\343\266W\266\033\330\017\0211\026\300\213(\2525f\351F\035\232-ll\313l\223m\357wf\002B\252M\007E\220\002\271\366\201\004\262\357X\036\016\310\315\300\021:y\237\336\265\237\3429\262\207\023\354Q\353\f\215\240Z\303\223\013x\237\004\244m\377\34682\317\242\313\255e\306\200\356\006\307c\243\3260_q\204c\310\026i>\206\237\f\273\311Bi\334$\235]\245%$!9B\037OB\307(\344#t\306G\t\003\227\253\355\322\243\207\021;F\3213*c\256\202M\207\032DG\266M\262C\332\306\032\373\262F\032\373\273\237>\374\347w~\351\365\316\365=Rd\002.\030\004\224\225\312\004u\022\341\003\005\245\342"
+	.string	"\026k\301b\254\217\224\027\352Ak%f\3429E\242RI}+\025j\345K\271^\037\211\210Y\255\023\327\007c\261\\\237)\254\2174\336\225\361\034t>8 )\343y\356\335\320\345\364"
+	.string	"\315\253\370F\230\350\222\226X\243\336\312hKx\355_\034\035"
+	.ascii	"\3571\330\020Z\260\016\251[\200\033[\261\016\315\300*B\325\260"
+	.ascii	"`\027\330\"UqY\305\002QI\343v\021\304\320\n\3125<\\6 \301\206"
+	.ascii	"3\206D\320\267\317\265\004\224<\270KJ\033\304B\007&t=js\250u"
+	.ascii	"\236\001"
+	.text
+	.section	.gnu.lto_backupPgConfig.244.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\216"
+	.string	"\215\t"
+	.string	"\266\322A7@\223\206\003\273c\212\311BUH}\377hk\\\235W\233\342k\342\272\250v\370v[\257\301X\306B6\262\232\243(\00682\337\305%\267\003\372\334k\377\275\267\224)\0051"
+	.string	"0"
+	.string	"2"
+	.string	"\343=\3335\356\004\3335\203\266L\001\306\206\n\",)\025\232\335\355\364\343\340\023\364o\362"
+	.string	"\325*|\0024\354\256S\265\342\270\365\266\017l'\330g\b-\373\342\277e\351,K\253\2463\323\347:#\032\253\277fv7b6\013\323\\@8\266\237\366I^\002^<}`\267\005\323\262;~\214\300]s_\311T\300%\222\236\342\251\032\270\256\251\237\324\215'\216b\342v/\026\374\223\257\202{]\363O\333\265\353Y\254\227\032\021\2251{\fS=\354g\273\273\326\242R:\004\032E\204:\211\221\003\251\013}\246\016\344\261Wz\370:\n\317\373:\316\270\317V[\346bB`(\265p'SU3\265E\243\274\312\234\216\f\rmC\004\017"
+	.ascii	"\357b\310\304S\274h\304\005\204\250\364\300\220\237r\202U3\232"
+	.ascii	"\312\302f\30280\353\022V\263\032\r\356\362\242\235d"
+	.text
+	.section	.gnu.lto_swapBytes.245.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\005\002\235\021"
+	.string	"\226\341sF\360\356&\035\202\227!\225\366t\251\005~\221\336\370\007\333\341\203\274\211\335\345\025_\300\352\235s\300\034\016\036\312[\004r\256\345\307qZP\025x\025R\017\203W\277m\235a\325\233uE\224?\307\220\215|\262\267\334)\005_"
+	.string	"_"
+	.string	"\\"
+	.ascii	"\004\266O\203\357\320>\267sh\237\366\354\025\001\\\333\222`\247"
+	.ascii	"\b&\210iw;\315\340\2150\f\303K\360\226\321\373\224\032=?\350"
+	.ascii	"\022\246#\342\365\265|\312\f\227\214N\352sI\220&%\242\317\036"
+	.ascii	"c>\227(7\320\\?\373\204\305\220^\037\315c\006\203\335u|}3\267"
+	.ascii	"v\333)\266\021\330\261A\337c've\302\027{4\2114\\\350\227\331"
+	.ascii	"\007\341\017\231\363\001\005\336\205T\276/\253\322\263c\242\333"
+	.ascii	"\376\301\237\231\373\264-S}g\366\025rv\214\224vA\003\237\366"
+	.ascii	"\330>\317\331\216\036\376\343\035H\345\323.\006&\325\3669@\236"
+	.ascii	"C\003\215\n<\332\357y\007\357>,\007\260k3\033\261\013z8\254M"
+	.ascii	"\3529UE\301b-\374\020+,\001)r|\026\355\023\245\021FLM+\206\276"
+	.ascii	"\2364\352_8\270\304\320S\257\037\272\003\024\261$\230\030\255"
+	.ascii	"\030\252\312J\270>\325\033\033l\211 8MJV\033;u\360\347.t\243"
+	.ascii	"\356\363\237\016\364o\227\335sF\313G\353\243\243\214\376\206"
+	.ascii	"\006ON&$#(r\365\221\225\025KBx\310-\362\261\212 \322IX\205\220"
+	.ascii	"t\"'\254\356\243\303%&#'\035JI\311I\307\201\373\240\237\202\n"
+	.ascii	"\022G-u\231z\343S\221\246t\362D\307\330\366\246S\277\364c4!6"
+	.ascii	"]\356\356J\377*mjJ?\373\003X\f\351\345\002J5p\026\324$\271\260"
+	.ascii	" U\003\347,^K\255\224+ \200\002\231\332n\237\030a4=\201\210\201"
+	.ascii	"\244-\242V\177\322-\260BF\013\024\326\234\255\225\327\214\266"
+	.ascii	"q\315h\357\200\016m\356\365\"\003\334\247\225\025\300(7Q\310"
+	.ascii	"\005\334aZ_\307\260\n\036a\037\022n4~\356\265\375IG+]\364\271"
+	.ascii	"\007cD@Q\336{\211,\362\302b\217\007B\304t\365'"
+	.text
+	.section	.gnu.lto_loadDefaults.246.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`a\003-\027"
+	.string	"\006\251\222K\240\326Q:#O1\0371_\346\377}nb\263\241i\331\240\3620e$\363p\215\3548\206\206`\330\256\005\255z\324\037\016\357\345WB\241\256/\254\033\347!\\\007\347\351`\304\036S\263\360\001\256\340\037\254\020\302\210\220\275\267\334I\006|"
+	.string	"y"
+	.string	"|"
+	.string	"\257\003\316b_\351W\354+\317\230\225\b\260]\232\002%\341OS\223{o\253W\210l\223\210\236\214$\021=\001Oyg\332\263\217\242\255\264\347\214O\343TE\f\0368\222\366\361DF\224\360\335\2468t\353\373\314\355\250M9\221C\257T\264\005\271"
+	.ascii	"@\332h\2140\330\343\275O \2626\351\013\241\367{G`\242\252\006"
+	.ascii	"t\"\205>E\231{/O\034I\342\214rf\026\302\314-\346~\020N\202>M"
+	.ascii	"\353\276\361\303Fv\353\230y\264\031\303B\030\3446bf\255\276\373"
+	.ascii	"U\336t\266/\317\265N\246ur\323\311\263'\177\245%\252\234\352"
+	.ascii	")=i \357\006\r\251\356\257\366@z\323_\372dj!.-\231~2\226\316"
+	.ascii	"\343\367j\334\306\354%\317\352\022\271'\251\224\250\202\367\362"
+	.ascii	"\\^\371e|e\3368S\230\371\223\3712>c\366\035\bF\2717\005\022\250"
+	.ascii	"{{/L`\fRLP\314\330\365\314\241m]\024\206\234\016\326d\316\240"
+	.ascii	"a\372\226\0249\t\326\232\306"
+	.string	"\277\313\362y\034\312\305?\342\027l\302\354k\220\\o\211I\317\034\326\326\361\202$\315jQ8\231&f\340Hm\240\247\330x\357\315\3519j\350\217^\331&f\217{\345\307\354k\355\256*\245|\246\360\364\336{)\037\370\212\255\315j\233\022\tx\203Q\233C\036gmf\017:\3638~\357\027\341\033\002\02549Sg\347\346\203\213\003l\303\310/\230\232\233W\253C\215+\326z\311tZ0,\214\223\003\223\265vppd\255\024\336}\033\215J|\374z\272\306*\315\237z\221\006\016ff\200\344\242\230N\214v\325\242\260\332\337\020+\266\016\307m\257\332\246dj\231\263\273i3C\210\220\240\350\3264f\226p)\332\001\220\354&<\b\205\356\002-v\357\331\327\361S\305\\\341@,\214\367\3720\340\377\220]\030\217x\372\276\273\324\bB\250QD\003\225R\202\031\231\t$\240\240\240q\003\240\002\031\302\342\006\022"
+	.string	"\246A\252\224\232\232Y\352\372w\177]\b\003]\272\036\367\275\tm\3424N\360 T\023.\270\225lT$Nl\036\261\022h\251\202\234\275\217\036:A5\f/\224\363v\002\3048\326E\237\343\323\274\306\264\312 o\354XCBOP\021Ii\242>\371\240Y\330\276\023p\326*\230\326\022\360\323\200\226\233\001x\363\261\246\243x\251"
+	.string	"P\035\330rd"
+	.ascii	"d^\253pBm\305\242n7\203\017\274&\202\n"
+	.text
+	.section	.gnu.lto_loadDefaultsToCopies.247.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\240"
+	.string	"\025\013"
+	.string	"&\324LC \211j:@kf&\224\265\245\241\244\211\004\241\202\236o\374'\b\213\374\016O\203#\242\233\240\212\242;~\302b\bB\222Ia\232\3340*"
+	.string	"a\300\363\002\f\307\212\021B\350.\031\b\203\303F\215\354\235R8"
+	.string	"8"
+	.string	";"
+	.string	"\026\tT\247\227lw\275j\340\343\267JG\377\254WJ\223\374f\362\272I@8O\016\246i\213H\r\230\235u:b\226(\245\\\354\256ii\226\334\334mo\330\316\330\277\004v\213\244\265\200\375mk\312\256\324\357>\004(\022\363\nb\273\250Z\206=9\007\007l\337b\233R\273\"3~\025r\371\205s\365`\327E\341\211\206s\036m\n\027\221%\003\034\030@\202\314\302V\241gp\373\003\241/}X\f\300i\252\344i\004j\260\372\260{\345h0\301Di\366\027\274\025\372*\213#\372\362\234?\352\316\275R\310\b*\001\254\023\022\255\005\241\b$j:8\031\241O\024\212\030\234P|\360\006\343\001m<\017\217&\344m\300\320\303@\370\373\340\200\236\350\373@\317\322\332o[S\032\030vV\201TK\376;\235\357\372\253\343\371|\272\007\021"
+	.ascii	"\357b\310\304\363\240\321\202\263`\233\031\231T\303\211H\035"
+	.ascii	"\203\256\"\026\314\031\026t!\337c\254+\251q\342\316M\325\316"
+	.ascii	"\024MA\001"
+	.text
+	.section	.gnu.lto_getPidProfileIndexToUse.249.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\207"
+	.string	"]\n"
+	.string	"\246\323G<0\305*\035\310\256\037\007\214\250\210+\275\230E\267\340a\266\215\277~E\213\312L\270\300\213\276}\222U\fH=b\3321t\205\016\f2@]\373\037\266\211z\2713\212\222\266\267\2242\0056"
+	.string	"5"
+	.string	"8"
+	.string	"\373\355\224\315\337wg\213I\311\370\030\tEp'ke\200\310\332\226\t\251\033\306\200\210\222\032\234Jeg\313+\361\304\334-\324Z\317\241h\261\277\354\177\206\377\005\377r\177\r\344\206\375+k\277\376\363\273\363\347\371\314\374\305\b\344b\342\322\306Z+\306"
+	.string	"\365d\226\310\376\227\376\314\021\024J\3776)\020"
+	.string	"\247\243E%r\253\265F[##wK\006\202\"1\374K\210x\303\256w\303ujp\277BBsu\303\276\035]\2665\034!6\024\343\376\365X\332\350\033;\005\2117\334\371%]vn\033\330Z&\036\003\367:\236\217G=\037\217Bx\032\036\250\027\022\321\016\301A\021\016!:\001\002\205h\246VW\326~\375\300D\316\316\\t\327\334\253\377\334\034S\237\344lX\317\336\260\250r&\016\017"
+	.ascii	"s\2046a\303\360\243\\\313\304\004\001\021=+\204\305\340C\333"
+	.ascii	".\214\351\230\351=X\006\256=A\211\377T\215\032\227\202\002"
+	.text
+	.section	.gnu.lto_getRateProfileIndexToUse.250.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\207"
+	.string	"e\n"
+	.string	"\226SH?0\211*\035\204\337\177~\377\362\357|Ar\020\313\304\266\275\304\217\030\225\237\225<\210H\013d\240o\237d\025\302\3571\305\030\247q\24320\300P\312\267Vi\244\317\342\330\005\364N\376\336R\246\0245"
+	.string	"6"
+	.string	"7"
+	.string	"\357.\343j\347\237uI\f\346\222\360\201\336\245\351\221\0014}\343e$\003\340"
+	.string	"\212\"eFzp\326\265\004\206T5\2139\247\365\003C\356\310m_\330\226\260\257\001\366\313\323U\331\217sS\266\325\232\325\322jU\365%\r\241\002\360\256\330\234 \241\205\331@2X\331\376\330\023ST|\334A\214\274\t\025\003\025H\tds\276\266\r\020\241\356i\205\300A\224\250\335\301\321\177\332\276"
+	.string	"*\264\336\035[\320B\355\252\272w\"_\312\f\006A\2443\373\007\336\352\370\004\374\341\321\177\227\276'r\371\235\020p\002i\030\346,\230\f\267a2\334\266\201\301\320\330\270\rg\263<X\303\221\261\331<4\232\3156y\315\307\271)_\"D\271\223\001\253\255n\311\266n\005\264\241(\277r#(\220.\2004\017"
+	.ascii	"s\2046a\303\360C\t\237\227\200\025D;\b\261b\360Al\327\304t,\364"
+	.ascii	"\036\"\003wOP\355?\245\243F\253\240"
+	.text
+	.section	.gnu.lto_getValueOffset.251.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\217\002}\022"
+	.string	"\206\242tE\360\356&\035\347K^\3601?\207\317\177)\375\243\017\227 f\241\310\301%\360\372y\362\221l\257\002\351\374[F\342$\363\221\333\037\310\321\342\226^\005n\367\342u\322\n\355O\366\217\016\265\321\347\037\261{o)S\nb"
+	.string	"Y"
+	.string	"c"
+	.string	"\367\240\362.\345\002vkV\030\355v\t\314\261\035\272\333l\373\034\336A\305\256\216\226\225\025\216\035\n\261\237\027\273\235*\365\215x\230\037\020\017\365\346\256G\3704]>\367\310\300g\350\bn0\177\357\371\202\fB.d3\230k\013\313+\246v7c\006{i\002\331]\247lv\3416\335\366\211m\017;U\004\031\213y9\302?\234l\273,\n|\237\006(\033\316\241\237\022\017\257\357\3713!\363\003\203g%\227\354\216K\265\261\377VklM\243\234\326p\372\364\356\317pz{i\323KGM\303\227~/\235\232~\nu\2033\273\320\321\256\313R\214E\202$6\330V\261\001\330\316\264\317\023OCd\210\212\336\322\201\247\314P\233\304A^\226\372\224\363C\274\203\005\315S\033\233\274\004KCCd\202v.\364V\f\022\227IW\003\271V"
+	.ascii	"\b\305.\367\021\276Q\n\203\b\237hs\311Y\332\220\017\302\265m"
+	.ascii	"\227\373\214!mw,\344<\310v\355\237\261]K\331z\034\242\020\320"
+	.ascii	"`\251d\0027\020\257(u#(%\"\023\240W\037$%+\325\003\022\021\023"
+	.ascii	"\325\252u\242\372\3300\013\302HK%\201\305j\251\334\355\337j\215"
+	.ascii	"Q\261\227\242\364]\221&\366\242\001\236\3640A\263\232j\350\246"
+	.ascii	"\025lo\232\372\362\201n\220\027M\372\364\244\332\0026s\340\256"
+	.ascii	"\030\325\244\246\0240\235W.\031j\324\307\224\002\244\275\032"
+	.ascii	"\311\313\240>\211\366R\356D6 \240\002\221\271\252\016\37610e"
+	.ascii	"@\b\031t(\266\211D\310\2300\220 \256\256\207N\255\375l{{\235"
+	.ascii	"\264JF\311\333Ah_!~,qX/\030\264#\207\301\034\030\004\2739\022"
+	.ascii	"\202&\030T\f\311\367F\2117\177\205\305\305\235\305\212\212G\310"
+	.ascii	"#$\\\206\\\r\222\033\001\\\200\023v\300\366DC\212\210\205\026"
+	.ascii	"\357]Ai\260S\217!\362\206\013h\210\375\246|8\263.3d"
+	.text
+	.section	.gnu.lto_cliGetValuePointer.252.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\336"
+	.string	"\035\f"
+	.string	"\266WS@ Q\233\016\214\303R\031\027\005\020\265"
+	.string	"p\261\032\332\357\341O\264\021\330\317\325\006\tP\222\336#Z\323b\3721J\333\355o\230.;\200P"
+	.string	"ja\006\324\030C\323\240?\317\207\324\250\321&R\246\024?"
+	.string	"@"
+	.string	"B"
+	.string	"\0331.p\035\332\366S\\Eg\233h\206\013\242\017\nJ\035F-t\354\306\314\361\226\352\360z\245:T\021\357\236\235\377\2213"
+	.string	"Q2\303\373BOk\301\356:\275o\303\255\267m\3006\306~\027\361\246\334\364[U\032j\232\202i\245\322\251\351\003\020@\002\307\367\022\222]\r'\036K\003\3020\361\370\333\235?b\314v\004\r\330\032\373\317FiD\216\335\210\340\320\007\2367}\234\300.\351\306\213\rw\241!\351h \345Dd\224\002d\252\r\201\223\367(z\t\321\220\257\251\332ct\342\bg\341\271vC\022\370+>\333U\342\320\377\250\016\257G!\022c\207I\224';\206RC\330\247VI\266\225\306\036\332\206\323M\205\216\306\002\264\226\341t\264L\002G\343\3114nB\226\261x\373l\270\214\302\266q\031\026\367\324*\t\323\213HA\fU\025\323\233`8\001\222'S\n\365\243\223JZj7p\220\367(=\007\017\366\203\023"
+	.string	"\357b\310\304\313|4\02262 \004\360*@\310N\211\025\034k\332%\264\241\251"
+	.ascii	"\332&`\327D\247Z\354\216\t\322Q\344\n5\032\3613\243\251\235O"
+	.text
+	.section	.gnu.lto_dumpPgValue.253.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\233\004\355\035"
+	.string	"\2466\302H\220\234Q\007\004\222\256\327\216|d\rd\246\257\337m(\274r\314;CBH\253\004\260\354\024fs\236\350\233\2509[\303\270\305\240o\326\220#\325\333\251\313\236\032\026o9\252\327\324\231\247\342g\020\265\266\204\354\275\367N)\245\256"
+	.string	"\241"
+	.string	"\255"
+	.string	"hV\322J\252A\233\f\202j\235R\312PN\351\251\242\246r\243\254]\341\020.\ni\233\267\222_\n\216(8os\354\324\256\020\331\303\201\367qm"
+	.ascii	"\3676}\261\272\267}\300\b\3226\231\231\373IK\025\361\372:\216"
+	.ascii	"\214\204D\210:B\234Zso\213\343\266u\3166\323\016p\266\371Dz\355"
+	.ascii	"\024=\315\362}\345F}>\004\255|\025Y`\247\250\217\220$\245Fy\364"
+	.ascii	"Y2\350\272J\243\262\304R\007\351\251Hc\207n\022U\366\310K%F%"
+	.ascii	"\241?\215\r\226\267{o'\333w\260Bw\324\347\336\313^d\223\232a"
+	.ascii	"\315\314Ff\3461\227I\001\314\242\263\264H\357\025V\340\306b\302"
+	.ascii	"Ej\244M\356\034g\233\376\026X\2551KP\216F\376\3058\236\363\314"
+	.ascii	"\272\235w\261\277@\025\036F\257.\341\003\231[\240\277\023s\227"
+	.ascii	"\367\233\230\373\330M\240\251\232{\232\252\233\247\251t\357t"
+	.ascii	"U\263\255\333n\001-\245;\007\346\\C\235q\330\231\006s\236\241"
+	.ascii	"\3162vVe\3161\2313LuNc\316"
+	.string	"(\314\371D\235M\230s\231:?\352\354\247s\037\030P&\2305%\352\351\305\264\027\351\253\315\3052\265 \351\252n\346\"\356$\253,\201BQW\375n\300\366\"\005\254\026\326\222\324\275\303.nH\207*\024p\360\340]\344\013LG\374\241\275\200\350\222\"\004\216\263M\365\273\311\2170^G\rO\305\245\363\235\270\264\355\335I\267\367^\363\235\266t\354{H\256[\354UdR\315\227\277\323\366\336\004\311%t6\355\367^\340/8a\377\002IF\350l\270\326\013\316\235\207\275\032L\236!*\3618\317\247\277\363\314$Jx\027{\036\005\023\372\3517\361\215\355\321\357!I1D\037\002\274\374\363Q\250\360.\332\3766| \377\233\177\376\273\031B\005W\364\225\371\032\212\034\377\375\313\357!T\320\277\270\377\377\335\020\337p1\276a\270\371\022\334\210v\276\003*Q\320/\007c\327\301\027\224\373\325\330\315zD'b\320"
+	.string	"\372\311\355d\304f\370r\"\206x\277\237t\367\013\312\3310c\f\371\216\227\033\361\303\323\241\254\203"
+	.string	"\024\244\303\321"
+	.ascii	"\312\361p\272\236\017\007A\207\205\206v=\034\221\220P\017\247"
+	.ascii	"\266\267\313\373M=\337Xh\200`\031}0\265\252\341|\355\373\312"
+	.ascii	"\030\234W\257\266\222\320\236{k=\202\006\321\222Z\221\244C\335"
+	.ascii	"\204,\332\267\361\207\226\327\243\n\234y]\2622A{\030\327t\005"
+	.ascii	"\037\310\b\274A\317>\347\t<\363\032\265>\271\021e?\37363\204"
+	.ascii	"\n\206\221\375\214\335bZ\202b\300\325\347\006\263F\201\005W\250"
+	.ascii	"q0\205\004\216!efF\242\321\304\222\016\300\002\021\242b\007\021"
+	.ascii	"\260-dc\265\316\030\203i\365m\"\316\264\214\237m|wN\005\252o"
+	.ascii	"\005\242\330\033]\226\n\366Hu$\360\324d\341fg>\2111\035\370\351"
+	.ascii	"-\256&\034qR'\210\272\316*)\235HL\225\315nE\001\214\013\004\357"
+	.ascii	"\0265\034\307\363I\177\200\212 d\r\220W\225\364\027\236#\217"
+	.ascii	"\305\036!;\342!\371w\357\263\312\016F\300l\363f<\360\357U(jg"
+	.ascii	"\030\036\221\f\230qZ\030\315\f\024\035h\234\023:N<\337\300\237"
+	.ascii	"X^W\352\250\207\246\\\205\256\337f\350\231]*y\003)\025"
+	.text
+	.section	.gnu.lto_pgSectionEqualsDefault.254.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\327\004\305\035"
+	.string	"\3266\275K\260\022R:\313\225\216\333\f\007\273M:\027\202\031\3748\005\301\375\334;\335"
+	.string	"F\243\372\002}A\007\371\367F\356\370\313\247\004\267E\336:\\q\225[\324\341\250\345\217\372@\260\370\033\244[\314T\230\355\265\252Z\311'\261\204\020)e\n\247"
+	.string	"\231"
+	.string	"\247"
+	.ascii	"(\352\222\320\022\"\201R+\361\300\226Wpn\271#\027j\243\200V\307"
+	.ascii	"\327)\351\013\254\326\232\002\375\351\226\375\013\375\351\177"
+	.ascii	"\222\2708\2046G\020\327j\321\357E\201s\313\0323\377\353\264O"
+	.ascii	"B;\024\001\240V\213\212%\256j%\"8\201s\313\023\027gny\356\315"
+	.ascii	"\334\362\377\023,\020\372\020\200\021>\257\2350\013\b\005V+\221"
+	.ascii	"\327.vh\315\222l\036\372\372\326,\356\206\242\325\261\254\332"
+	.ascii	"\363\311\n\253-r\251\366\344*ZI\005\217Rl\027\375L\034\2231\206"
+	.ascii	"\354hDs\314\246\326z\016\036\241\330\307\366\377\317\177\t\177"
+	.ascii	"\211\006\357\202\371B\252\325\267*\2728X\rl\231\353-\356\276"
+	.ascii	"\360\262\241U\304a?\361\307\335\342\337>\036\217T\336,~\032\237"
+	.ascii	"\346\374\031\032\177w\276\314N\355c\316\207\331\341\256\200\355"
+	.ascii	"\261\327m\216\335\334\3718\222\377\202\362o(\337e\306\267\221"
+	.ascii	"\374Z\312oA\371,)\237&\343\317P~z\362e1>J\362\317\224\037C\371"
+	.ascii	"f\312/e|\022\345\367\311\347\030\177\007\260\fe\034m\325V\255"
+	.ascii	"'\216V\252V\2115c{\354Nm\025Yw4\020r5Q=\375\356X\036B;\325\333"
+	.ascii	"\0322\035\377\021&\360\006\321\336\252\315\201y\r\001\262F\362"
+	.ascii	"\007\366l\231\326I\001b\345\236e\226\035\353\277\202\005\336"
+	.ascii	"\340\331;\243\366\235l\263c\315PF5~\027\326\210\3310L\206dw\227"
+	.ascii	"\275F5b\232l\206\3721l\221\fg\255E\f\276D\036h8e\2100\267\354"
+	.ascii	"\336aR\024\341\220(\270=\223;\246\033\312\210\306\217\217\337"
+	.ascii	"\346^`\030\021\037_\343\377\006\2077\270\275T\233#z\335\320\372"
+	.ascii	"\265\357{\265='-\037_Y&#\223\220\356\026A\276\306Z\223\246\272"
+	.ascii	"\364\343\213\365\256\363\334 s\313\335\245*<\322\344\343\017"
+	.ascii	"\357P\243\323\303\323\351\271\375\344\3648p\3401A\360\354\374"
+	.ascii	"\340\344T\310\001\362p\023b\246\323\303\307\251\331\361\200\303"
+	.ascii	"\003\261s\363\201\207\343\323\343\325\340\316\323\223\343\303"
+	.ascii	"\373\341\341\361\341\245D\242m\026\177\002*\205\2253\266#RJV"
+	.ascii	"$\214m\bP\311D\3134\256K\374\307\365m\210\372G\232/=\3231\243"
+	.ascii	"\255]\372\366\322\024\226\214\332\347\344\306\345\322\005`\f"
+	.ascii	"i\332F^%}\025\267\244\302d\216\033d\356\232\246\003\030\201H"
+	.ascii	"\277\250;\330%\020\276\353\215ZF\312\212R\345\311joS\326\032"
+	.ascii	"\246\0058\241\241uKm\326,\335\242\204e\326i\323t=K\222N\021\322"
+	.ascii	"l\317\224\265\016\355Z\250QH\343\224bL$\220\240\024$\005I\241"
+	.ascii	"\003\260\002\0211\262\016\021\240%U'R\230\024=C\301\177\353\301"
+	.ascii	"\345\362\245\244\351\340\322'\246\304\225R\023K\361c\312lv\240"
+	.ascii	"\233\016X\242\240\0365\243\t*-\313(Il\223L\310\316b~\263\273"
+	.ascii	"\324\354H\256\267\355\3703L{V\323\312\267\r_5\3119\241 \367\250"
+	.ascii	" \013\351\347\004\367\031w\001+>\247\0376\323\240\260f\342\267"
+	.ascii	"J\336\336:\227\310\237\203U[C(W\377\276a\024T\233\216`\t\032"
+	.ascii	"\340\246}\216\301DrW-m\004\023)\215I>\002\243\033\212\263\025"
+	.ascii	"\277P\363Y-\231\271g\333\264\217\352\2250\005\374q\261\364f\334"
+	.ascii	"\213\316\351T"
+	.text
+	.section	.gnu.lto_dumpAllValues.255.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\240\007m/"
+	.string	"JW(\023F`\\R\007\237\320!\211\215A\213)[\021\225\333{nV\253Dk#\"\034\241\035{\r\253"
+	.string	"\n\fQ\203y\375\031\037:;\007\r\366\301\203+#d\301\377\303\3410=#\332\347W\213\322Kl\311\326\366\226I\246\024!\001\020\001!\001jOIf5S\261\\r\325\261\275\234\253C\276\366\206N\243\261c\314N\263,\025p\024?[:\232\fl\314N.\"\022\200\276&\361W\375\311\322\241\314\3505\347\036m\210\200\276\032\257\337n\037s\262\245\227\321p\235\234\177\264\271\345\\M\320\007\200\276v\325\221\254\257@?\262\276\366\262\373n'*3\033\204\271y\236\355\345\234\225\037\244s\356\322\2159E\342\260\025\006\201?v\305\177\227\355l\216\271\264\244\201J\231n\304\277(\252\"N\027\355\302\021\370\360\252\370[\363\346"
+	.string	"\251\332\362\242\001\037UZN\374\212j\301\271\001\272\350\364\016\177\024|Tey\353P<\\\210\365\025\345q\203X\b\357M\317\351\242X\030IU\004\352_\321\035\027H\027\315\372\341\006vR\254\242\364\211[\034wc\374+zu\331V*uW\234\244\213j\341d\316\271\225F]\214\205\264\270X\025\245N\214\374\302e\347p~\247\244R\367\375\315C\210\331P\343\243j\313\357\217B\316\271/TZ\345\255\343\335\016\241\273\233\272\3313\001\355iz:\346\232\316E\t\250L\316N\207v\367\b\337RB\331\225\2633B\026\327b\002\273\227\257}\"\005\353\320\024\254\257\311w8\307z\323\263&\031\265\034P\267\357\245`\211\222\376S\007\374\220\363|\267\321\321uh\201G>\267\334\332\340I=\263\273\332\274O\355\366\b]|x\375?\272\333\333DCB^\346\036\204"
+	.string	"\250\275\375\343P\334}\334\212wRx\273\247\200\247\271\017p4w\236\277\215t7\357"
+	.string	"G"
+	.string	"\256\346\255c\314\3615\357\"\321\323\274\207\303\333m{[\270\336\016\016o\003\377\366\257\275\315\266\267\327\277\215\377\366\013o{\002\002qf`\242\204\275y2\325L\325\367&\317\255U\214\270\025w7w5\3675\307\335\336\336\346q\335m\277\360+\3154E\333\253\322\016gE\311\230\351\262K\355\304\240x%\234J\373[\267nKIg5K\205`\344\322H\274\350n}u\237\342l\335v\367\232\023\316W\325\\U\344j\333\013\301\300\301\322\003\306/\376T\236\353\374\312D\303eV\0076|j_\341\220\267|A\"G\376T7\362\021\374\237\261\355S\275\335\314\311\001\021>\261A\237\373\017\364\335K\262\245\223\353\320\340\373\225\036Q\317\364\005k\276\262\202A,\360o\034\263:\243\007\261<\017\374c3\013\233\347U\363\376\276\333\302\205\353P\240O:\237\331\354\377\376\346\341i"
+	.string	"Ks\307\276[M\245\204Ya\251Y\002$\372\365\235\211Y]cp;\r~d\212\266w\246n\035b\332)\321\"+\353\363\031\354\317\023\375N\236\307u\006'\243\001\350cPl\350\237\3678\377\251Af\346\204\254lH\225\326\334\317\2115\376\312\264k\322T\236eM\330\247\202\361\236'\226]\317aD\317j}j\373\f\326\347\377\313\257\227\027;!\370\251\215\377\277\311\314\214\363\362\265\317\343\307b\236qz\376\217W\236qv\234"
+	.string	"\353\337\363}\237W\315\333\327\335\035\234\356\303\210)\032X\316\316\007_J\370\330\364\f\314\213\317)\261\276\372\217\230\242\205\225\t\270\335\"H\\\207\006\275B\001\022\223\022\211\351\270&9\022\323E\362\300\224\304\302\211m\202\001\002\311E\222\212\242\243\025B\026NE\033\230\224\236T"
+	.string	"],%\3010:\002q\364\324\242(\306\360H\251\210\203\n%\243_\033)Hja\244t\221T\244\2444jrR*@\366\022\323Q\223\022\306\322R\223\262\255B9\233{\r\275-sP\3374>\265\211Z\212CA/1\033\317\266\333"
+	.ascii	"\200a\304j\344\3711'LX\337\263\355\272\0307\026\207\357l\036"
+	.ascii	"\354\n\203\363l\273\005\236\030\340\333\267\320E\370\355\373"
+	.ascii	"3\216\363"
+	.string	"\271\233\245\021\354^\275D\262L\262L\302\372*\304{\323(m\256\240n\237\343\234s\316\301\307\357\241\373\023\333D\317\363^\217\017\300\370=,~\023\213\337\253\361s~\2521\361\033\017\211\277\365\\\242E\024\372\306+\361\207?\265\304\006\370\241\36777\301%\327&\245\325\274}\027G\021\350\022\237\347\223_\374\240&\313\260\353P\241\237p\243n,_=\263\333\254o\315\032\361\251\235\365Lr\327\"8\276\316O9\234\273\216'\222\273\026\350\033\377\002\200\216\250a0\242\210RL\031\022\021\021\231QI:\200\002\22113n\020`\251\244I\2061\324\b\t{\375\270\017\203\332R\3622\266\345\177DF\234_M z\256\223h\271\336\275\021L\237=\310I`\201]\3172O\032\201\230\246=o\3600\\\224t\201\343H\266\235M\013\036\204\255\237\345\325\362\225\267W3'\250\316\214\274'2m\225\032\2628T\210\005\316"
+	.string	" \303\324\312FI\340\262\324fs\367#\222\337&DjJO\201\3228\263@A\246\361O"
+	.string	"[D\330\253\006[IU\2046\344\376/\345\241\035!a\222M\265\303\310\313~A\006\325$\215\354\343#\231\rEQ\327v\021=\362\264\350"
+	.string	"O\332\202\327\027\2172\236\006\213*\275\021\250\326L"
+	.ascii	"\222o\f\2539Yu\224u\315l\007\244\235\266\032\227\301s\341\267"
+	.ascii	"\311F\276_$8T\227=\006\264\247r\266+\233\031E\232\375%\363\251"
+	.ascii	"\362\n(\r\374u|\356-\361\024\375\250\302V\022\0257\0073\033\b"
+	.ascii	"\300\316%)\246\213z\031\243)S~T"
+	.text
+	.section	.gnu.lto_cliPrintVar.256.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\261"
+	.string	"-\013"
+	.string	"FVO? O\234\016\243\032\205\225&\320`\361lF\021\324\377h\001\177\020QM\035P"
+	.string	"\207\017\020\020\356\023\366(\376k\235Nz\214I\005!d\0355\313\227\226=\340\202\b\210:\34064\322\233\310\235R;"
+	.string	"@"
+	.string	"9"
+	.string	"\033\242H\261;\025\370"
+	.string	"\344\322\363\024\353\022\362\001\326\245;\333EE\303z\rH#\021\312cw1\025\361\356\261\363\217z\344\003\275\307\353\301\356:~\240\207[o\333\200m\007\366!\004\333\341C\306\246\244\212\321O\277\375\243,\261}2\307d[\354\301\2204\342\305\356Dp\351\213]E\233\301\245\273\206\205O\002\037N\224V,\210\363Be\262\241\022\033\022<\332/\235Dw\023\206\013\330\266\364z\020\033,D3@\361\303WT\265;\237\370Oj\364\350\200\221\n\251gO/j\b\373\325\356\2565\264o\372\257k\374\326O\267\374\374\265\212~$"
+	.string	"\007\007\360\033&6\234\207\243\233\315gB\305a*hF\303D\220\240e\2273\213f\223a\0244\030\r\313\270\016f\241x\343d8\314\263m\034&\231\373j54\244#F\n\244\031\f ^\245\252^jk[\374\347\002\"\365\002\017"
+	.ascii	"\357b\310\304s\242\321\016\\\210\3005\307bw\007\003\261 \002"
+	.ascii	"8\001\366\202\302`X\200\n\r\356\362\242\235d"
+	.text
+	.section	.gnu.lto_cliPrintVarRange.257.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\257\013\3559"
+	.string	"\032b\264\025A@dR\007\033\f"
+	.string	"\031)\024\tb#5\260K\035\035\251\317\035\265\006b\262\037Y\352\212|%V\246\257\246\2444\225\370\003v\300\272\234>F\177\366\323\027\301tl\321\344C\250\306\326m\367\336I\246\024H\0017\001L\001-\213\233mq\257,\356_q\343\307\355\022\f\274\321\322C&\255\355\375L\263\327\237\242l\307\266\311\342e\334\335\306\264S\311\370\333\353e\216\306\255i\376\032\352\251\333\243\340:k\\\235\251\365i\273\230\036:\333\023,\274\356&\304\250\234f/\240Y]\236\332^\316\323\007\316\366\321u\326\207\335\355\270\333\325|\355u\266!N\314\031J5.\347)\204^\340:\333Soj\235u\235\251u\266\337\356;\247eVVHck\276\355\345\234\245^J\037\341\327\227\210JIHGFCa\320\005\266\354\372\370mW"
+	.ascii	"\210\312\365\245\364%\350\031\261C\230R\207#I\254Y5N\215\017"
+	.ascii	"i\005.\275\260x\036't\315\320\227\327\306\251\216`\213\223\t"
+	.ascii	">\212\002\366t\24320'>DP\006&\346\302\325A\236\034\"\337\342"
+	.ascii	"\024[\233\274\260py\036g\030\016\256LM\324\364\361<N'kT\037."
+	.ascii	"a\276\305\331\004\273T'aV\267\367t\340\235vC\2353\326\333\274"
+	.ascii	"\204\031]\236\032_\031\030\025_\267\226m\023\225\271*\302/\346"
+	.ascii	"\277t\312XS\370\245\325\n\347\250\314y\231\223J\213\201 r\316"
+	.ascii	"\215\271\276\300\274\231\274\333"
+	.string	"\251\272{\332-\f\022|nFo\314\216\355\"\306\357S\027\304\342\251\2323\323\271Z\270L\013P.^`\347\352\rd\313Wv7\f\377\023\343C\265exu\312Y\fU\374\356\367\354\203\306\226\265\307\215Ky\374\242+\237\366>k\032=}\367$\210\t\366\247\026O{\034\334\235n\004 \362\2364\272\274Lv\004\261\304~\r<:\033\007\2429\367\362\224xQ\006i\337\335\177\264N;\235g/9\355s\354\326\304\346\332\341L\227_\225\243\006\246M\273\033c -\231\f\256=\256\357\334\234\225\016m\177\"\313ig\264\344\234\033\254\351\356;w\250+\315\316<\315\r\234\205zo\363\007dM\354\327n\347O\255?\3247n2\321j\032\216\006\351\346\274u\241\375\314\033\346\206k\305\331\366!\255\263\376\254\362\216\f\272\306\226\205\377\272\247J\374Q\271Cx\306\372\241tG=\356\343\343\206r6\367\004^\306\273"
+	.ascii	"\001w\363\036\320\342\026\360\270\235Z\334\305\307\035\240\305"
+	.ascii	"\335\364\270\001\254\270\231\036\367\322\0207q\210[)\210;I\210"
+	.ascii	"\033I\210\373(\210\333\310\305=lq\013\201\270\203-n\027\210\033"
+	.ascii	"\330\342\016\337\325\355~l\013|\324\033\320S\367\307\204j\341"
+	.ascii	"?\374eD|7\203\303^$O\325 _\313W\022_hv\307\317\237\241\031\254"
+	.ascii	"\344Er \211\313\364\201\253z\207\372\317\223\267C\302\217\266"
+	.ascii	"\013i\t<\353\206\347\007\263)BT\r~\264\337%\255\322{\331\030"
+	.ascii	"@[\270\257\033\177\315x\227\270\355\257X\353\254\322{W\030\322"
+	.ascii	"\033}\322;\263\213\353]\247=z\244w\346\226\002\177\364\253\235"
+	.ascii	"&\370\310+\006Tk\034\330\310\373L\222\303\323\002U\313y+\203"
+	.ascii	"\263\215\273p\221wl\355\367\311k\326:\327\033m\2355z\247:\324"
+	.ascii	"\031\236\335S\343,\235n\024\3661\230\310;\245I\372Vq\2315\240"
+	.ascii	"\336+o\0267\243W\307n\353\225g\230\371r\3617R/x\371~q5U\274E"
+	.ascii	"f\370.\306I\304=\021\241\311\371Q/\216\035\320}\341\373\024g"
+	.ascii	"\005_\210\346\177\357\232S\375B,\n\276S\201\357\276i\236\350"
+	.ascii	"]\363;o\233\367\205p:\2767\300o\375\236wuh\355\372\255\236\210"
+	.ascii	"\021.\023\205\221\371\312f\277-\341\206N8\\\241\025N\206\020"
+	.ascii	"\007)\373\016\367\347\177}\037\324\364\3132\341"
+	.string	"y'\034/\205\343\255\360=\322;\247\223\376\003\331\236\202\002\255b\2051\212\004\211\025N7\254\250\222W,\212\032p\\\335\260BV\031\201L%\223!\210\315\203\301\2671\352\333\250\201\007\262G\325\224\017b\327\250\301\240\330=\030\030!\030%\0305 oXM%\2155\220?tTU\205\b@\345@\222WV#\256x$\251l\b\223S>\276iD\240\252\242!eE5\225C\212F\222\207T\204\246\326\261\003\231\224\272\322\241#)5\354\354\017\245\335>9\273\254\327jW\343\216\0271Y\362)\376\202\245W\254b\361\271L\227\366\241y\034?\366}!\026_@\027\021Ew:\275\200D\370\f\351oZ^\245\207,\027\234\336\337\376\260\005\370\"\326\"|\005\351{\252X\177\330\312\253t;\322*s\001\036\b\006UC\307\217}cJMS\336)\305*\026\200oz_\243\205\243 =,q\364mb\300P\244"
+	.ascii	"\274\357A\313\240\261\371\033\3676wi\337\222\244\r\270\373\355"
+	.ascii	"z\215\210q/B\225\313|yZ\257\314C\372h"
+	.string	"'\2051\212\n\252\245\3415\341\200\335\325\253\321\200w1\356\032J\273k\302\001\275\253\3003=.\033S\267\364L\357^x\f9t\303S\203>\227\336\301<\365\370|\3159\347\243\217\266S\335\241\315\266\272!F\342\275\272\004~@\200\333\250Q0\246\030r\306\320\210\004\221$I\322\030\220\002\221\031*\253\003\021\320,\347\234*\222\321$\311\262\031\230\034 \2015\315\217\315\241\267sA\355\370\031\027\365\2459\2469F\023vG\274E\340\201s\250\304\233\005Z\t\252\261\233s\275r\305\037%G\b\303I\034\234\"\034z\372r\365\376r\013\206\305\373\272\027d\b&\007^f>~\002<|\273=\002\224\020\220x \245\225.\tK\213T\f\331]A\240\256w\3019\302\341\2070\242\023\030r\351\314\371\335%\r\031\230\030\037\001\002\251h\224\353\260\333\370\331:\0263\327ly\264\303d\262\266\371\212\t\031_\353\234B"
+	.ascii	"\004R\205\276\b\374\251\006o\273^\307\327E\007P\200\316\372\230"
+	.ascii	"\331N\330\335\313`Z\3514\327xIp\24417\032\273\303p\2453\273\375"
+	.ascii	"n\032I\315O\r\223\325\232\307\n\343x\306gn\264\243\253\316D)"
+	.ascii	"I\340\017E\340\3137<^\225\231\016=\030p\034\211\367\001P\035"
+	.ascii	"<\270\rdF\214XJU$\237\212\264\325\312\f~\023\034,\344\2558\330"
+	.ascii	"6\204+f]V\202Dl\242\364\020\212Q\035\326\330\260\256\206U\203"
+	.ascii	"J2T\224D\234\177\274\230\265o\330\362DED`\235\017PV\260\303\307"
+	.ascii	"U\253\271\340\206\033i\256\022\022\301d1\376\251\002\3179rh\034"
+	.ascii	"\370\035s\034\243\370\371m\217z64\352u%'\033\244>\"5\216\354"
+	.ascii	"\276\344\307\370,c?\300YvJ\207uJq5B\310&K\024\361\276PV:m\206"
+	.ascii	"\377|4\250\237\t:!\326\317\253\327\027\351\334DN\274?\372&\237"
+	.ascii	"\217\372y\f\321W\236\200}s\232\t\351\n\333\263\222\371\f+\006"
+	.ascii	"3\f~\177"
+	.text
+	.section	.gnu.lto_cliSetVar.258.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\206\nu0"
+	.string	"\272Q\334\021C`\236N\007\314\354\212!\277\342|\363\303\f=\255\276E\360bE\274Q\0230F\354\276U):ta\202\305\261\226^\250\361\023\274\222\241\177\"6\375\354>\317\316)s\251fh7 \022!{o\271SJ)\022\001\357"
+	.string	"\013\001\314M\236S\274s\267\275\352\230K\350P\330\362\002\275M\013L&g\017\330^\364\005\273mC\217iF\347^5\006my\211\331\325\032\013\262\263\304`\340\275c\177a\356eS\342\004k\333#\264\235\271\2554\023\331i3\332x\257\221\2670\367\252)\361\201\265-\253\3651m\2736P\332\226\221\314vD4.\226\0233IR\213\336\275\227\351\2174\262\205\216A@?\306\"q\350\323#\f\002W5\265\350;\222\333\300\336\223\353\013\253\205\202\034\303\202n"
+	.ascii	"U\260\361\343gd\262DI\222\036\363B\222\006\335\222\270\245"
+	.string	"E;\342pH\373(\205x\017\312\\\343D\250J\005U)0 \r\234\363\022C\217\236x\375\360U\225Z\3610\273\324\031\0033k\325G\247\252\224\217\266\303\257\032\350\321\275\227\206\243Az\314+,\370\265\225\026\013\214y\231\241\217.P\256\331\321s^e\350\261\315\262\256\271\264w}i\271\253R\367^v\256/\260\346\241f\356#\314,\305\f\324\021|w\344h\270\223\325\2506\343R\312=\324\317\255\301\331r>n\271.J\373\241\236=\031\246\345Of\236\352/T\353\275[O\334^\220R\252\326%m\271g\244m\373\243\224k\246\244e\371\223{\334\3003\223(\341\315\205\340\275\311\367&\267\365X\314jX\376d\314\215\3367\302l\235'Xg\t\250s\024\352\034\001u\206z\202\340\344\240A\323\222R\2635'u\226n\244n6#\350\264n\003G\004zK\263\021\320\271Hu\036\260:\013@\235\003\244\316"
+	.ascii	"Rg\242\324y\310:\013Y\347#\352\034\244:\003\245\316?\251\263"
+	.ascii	"Qu.\246\316D\325yh\235}\254s\017\352,D\235\203\25130u^Qg5uNQ"
+	.ascii	"gk\235Q\353\374\250\263\243\316M\201\370\246\356\253\343\304"
+	.ascii	"\335\233\343\351w\345\354\230&\315\326\275\245\273\331\317\334"
+	.ascii	"\255\245\333\232\013\0139\f\364\004\036\350\211ks\342\204?o\374"
+	.ascii	"\006M\377\363\251\226\244X\361\215\305"
+	.string	"'.\347\200\t6=\361\035\f\237\030\007\211\306\241C\332v\b|\262\274*\022\276\351\237>/\241\347\223\332G\370=o\334\b\335\354\245\231\351n\366\375X\237\214\3253y)\204/j;\303\306>\275\321w1\007\177H\307e\307\350\203O\\\326\201Q\201\277>\204\1778\247\007\276\375K\252\277\252\317\324\351\323\177\372\207K\356\260\237\366\034\022\355\303\312\r\"mk\237\270\224s\327%\226\345\317c\233e\235\355\030)\322[,\274;kq&\274\3237\227\376qK:\237\315n)\372\023\376\223\032}\377\253\341\347\377\337IgV\210fC\205D\307\"\032nD[#:\377\026S\302\3555\231\206\201G\016\313\377\030diC\203>\031w\032n5(\2333\334h\334\313\331%R\206\333\215\355\326{\261Z\311\226\312\331\275WA\217ae7\221\313\334;\273jWA\333(c3W+R|\025\013\023S\036J\\Y\271"
+	.string	"\226P1u\002\255bab\252\205\275\232j\361L\265D\302\004\025\023\n\022S'\230\250\256T0-\035\331*E\325\025\323\n+\253+&\241\332\3557\302\253\363\212\\\326kq\213\351\376\347\363\231G\bi\310\227\275 O(\307\242g\257\201D\273\200!m[\364\304\245\336\323OH\320\200\037\360\3045\2758\276\356\246\223\007\220\200g\327B\242e\030\322iH\333\nx\242\326\3353Ow\263\357\357'"
+	.string	"\322\007x\342\362..\351\304\353\030x\240\312\370\354\214\227[\215\330\037\267\363\257\340\350\343Fs\205K\217{\257\235y|\021\372\356\310%\335\311\035\246\373#\270\030\2746E\212pQ\206J_\324\006\247\364Y\372\243\243\037\322\311P\346\355\205\021\001<\321+%="
+	.ascii	"\242\270a\322\017\375R\035$\332\213\ri\333\241'.\355\300\370"
+	.ascii	"\344Y\n}\322\273[\322y\374\244\026z\307\013\372\343\035\025R"
+	.ascii	"\231]Y\320w\230\362\356\215\331\243\246G\260\301\027\265\275"
+	.ascii	"9\201\016\236\300wq\200\337\250qD\306\230RR2\222\024$\205Jc\360"
+	.ascii	"\002\021\231Z7\021\340<\250\234\"\221\241\222\2441/\240\201a"
+	.ascii	"X\333\352&8\357\\a"
+	.string	"E\262'\311\224g(\240Ur\204\243\202\241h\026$h\206\316K\337\307Dlu\013\365\300+\334\277x\300\027C\364j\244\357\260\350\0200|\"\245v\034&\351B\325\001I\020\327\207C\020f\204\363C&\245\375&\325\006\347\271\3357\205\007\024\001ZYX\361\032\242\315\375m\244\357\355\225wu\361\320\222\3538\313L\205\306$@]|\312v\346\375\360\tD\354\033\341X\020\206\265[\277u\310\351E\3207\007%RK\260\267\006~!D\245i\f\2737C\225\202Cg\371\353\t\376Q\255\337\230BP\267\221/\212)]\220\320E6\001\267n\267b\304\251\200p\351k\265\204\237\022\2424p\361\343\367z\\\211g\023\213n\316\tgO\354i0\317\036~\217\\\032y\334\361x\216\023\3011O\217\255\325jfC\337\203x\365\303\367\007M\020\345\234\021\244\003\\\326g\021\251\211\333\330\276\271\0076\266\340Nm\367\277"
+	.string	"\367\336\351N\325E\337\360\322\025{\013\203\027\3462\310+f\374\224\224\316\306\3021\262r\304:7\227Y\201\215\365\221v\370\001P\265\224\210C\240\316>E#\257\203D2\311\034J\030s\373\366\256\f\001\334\033\332\324\241\377"
+	.string	"\230e@\235C@=\306\034\356\364\233\376`\025\251>\272\024"
+	.ascii	"\025\230\314\210e\367\031\302\253\001"
+	.text
+	.section	.gnu.lto_cliPrompt.259.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375 \353\215\006"
+	.string	"\322K-4@S\222\016@\021\305.3,\f\235\267]\314\344\216\302\024\370\317\305\224\345q\264\351\317\252B\375\242j\357\030\206\313\372Nh\232\207,\006E\335\177\303V7\221)\037x\006\b\244\247\017\350az\021\240\006\2107U\023\357\323\231\222p\250\036\005EU\2173\312\242\350\315&\242e\240\306\222+JU*:%\231\241b\026\233\020BB\245\277\300p\305n\313\026\242m\340\365\243\313\341\310\027 Q\364X\020\363\222\225F&\323c\253IMr1\371\313\331z\030\003\216\274\026VR:Xf2\363!I\255:\353\366\244\002Xv\325\0050d\346\016\313>:\366\367\374\n?H\t"
+	.ascii	"\357b\310\204&\340q\202\013\3335\321-\004\3742\004\270t\213v"
+	.ascii	">\001"
+	.text
+	.section	.gnu.lto_cliShowParseError.260.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`-"
+	.string	"\245\b"
+	.string	"6P>; \0057\035`\302Ch``\004G\201\251\320J\216V\300d\002\304\320T\025\271\353F\306\006\214C\021\031^\367\003t4|\266\005?HA\373\320\202\273\005w\304\234\247\215\032\331;\245*"
+	.string	"-"
+	.string	","
+	.string	"\307\374\3317\004\251\005\027X4#09\273[)\312\277\317\317?\353\001\241\b~v\032v\3273\024Mnz\333\006\266\031l\277\004\253\177^\037\034\022\361\001fvKZ"
+	.string	"\266\304dR<\266?\355\263\274\345\373\n\344\002\273cM\314.\251\340\220v\314\344A\3311\355\003Y+e\b\025q6O\336\205#d\263\253z\330\241\251\022\016\216Mj{|\314\207Fh\251\224)\n\332$8\351\211\375kw\327t\264\037vx\220 \215 \n\"J\244\n\212\321\304\347\304\231J\026\334\326\361&B]l\025\003e\342\352\346iT\021\310]\306\311\253\033]\347U\017\271\277\226\216\326Z\001\t"
+	.ascii	"\357b\310\304;\276h\203\013\373`\310%\330f5\005\334\345E;\311"
+	.text
+	.section	.gnu.lto_cliShowInvalidArgumentCountError.261.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`7"
+	.string	"\365\b"
+	.string	"\326\320@= \3458\035\3409@# V"
+	.string	"\362\004\300\034\332\003\310\211\177\203"
+	.string	"\b[\307\230\217\306^L\" \202d\200IE9\372\034z\300\203\023\"`;\324\203\245\206\365g`\030\0315\262wJ\001,"
+	.string	"."
+	.string	"/"
+	.string	"'\330\2569\264i\fFVdp\311\220\274jv\267R\224\207\237\241\177\327\003\306\225\370\271i\330]\317qer\323\333>\260-\262\375\n\246,\373\255\177f\002\261\224\325\003\224\273%%\200\205i0*\034\333\237\366W\316\022\276\005\362\201]V\314e\227\\\360\207\273f\362\235\355\032\027\331R\226\2712\006\026BE\274\315IO\276\205\3433\263\253\372\330\301\251\024\020\256Mj{|\314\217N(_`**\332\2448\351\211\375lw7&u\245\t\221\207\324=H\224 (B\036\207QD\250\242\033\025\234>Sg\361y\033{ \324\205W1P\246\257z)\215\n\352\030\3148\245\352\006\b\246*\207\334\007\t"
+	.ascii	"\357b\310\304K\276h\205\013\373`\310%\330f5\005\334\345E;\311"
+	.text
+	.section	.gnu.lto_cliShowArgumentRangeError.262.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`?\0015\016"
+	.string	"\346\331_E\360\222(\035\260\331G\206\272\203\224\001k\272\177 \322y\022\227\263\357\bc\265\222\r\273\\(+\255\020#`\366\254%\353\207E\243\276\207\261\350\364\244#t\254{g\324\n\357\034P\312\002<{\246\301o\367\226;\245J"
+	.string	"L"
+	.string	"H"
+	.string	"3;I\347\323\235\315\303\344\303z\t`\340\200\220\341cw7M\361\356Sj\354\374\327<\344\003\275\317\354\345R\004|\271J\222\326\013\006"
+	.string	"d\311\023XL\211\327<\206"
+	.string	"Yb\3644\330]\307\017\034qwn[\202\355\t\366E\004\017\377\207\004\310y\201\317\311\261\353\022\013\2627\323\306\n\333\377\3304*\024h\214\273\272\317\370\206\034Y\326\t\0236\273\213b\004\331\247&c\270b2\262,\327w\362h\337\305_t\227\351p\001\273086\273!\212\013d\237\016_\322y/\030\013\231\305\251R\257\237q\032\030\f\350\330m\371\267\312Z\026\034\370T\2655l\210\377<\300\005\b\216%\241^\204\305\264j\250W:W\365b-\\;X\361\207\035zQQ\330\227\273\273V\030\3734\377\374\314//\363k.\2014\b\"\007Z\t\244\211B!\n*\241\007\232J\004\221\266\002i\fV \002\034F\234\242N\234\232\270\021J\232\270\221\250\304\221<&\245\234,\2206\324i\304m$\325jK)q\352\202I\265eH\245T\333'\334\307z\334xP\226\371\211\025\270\370\317\362\255\035"
+	.string	"\357b\310\f\rFH&@\326P"
+	.ascii	"\263W\250\306[-\003\256\024\bR\300A\242&R\301.u\r\3501c\2009"
+	.ascii	"\220YP# n \006\\Q\302\270\2400\030\026\240B\217\273\274\263\311"
+	.ascii	"\2460\327h\025\024"
+	.text
+	.section	.gnu.lto_nextArg.263.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`Y\001\245\016"
+	.string	"\206[bC"
+	.string	"\223\223\016\233\002-\371G\034:\032>B\360\250?\214\345\331M\363\3717R\033\017K\b0VM\003\214\255Y\364G\240\r1$F\376\236\376\377\377\216A$}\214O\240A\375\223\001\240\357,!{K\231RL"
+	.string	"N"
+	.string	"N"
+	.string	"\335G\256C\316\005\\\207:b\313\327\335/\267_\360in>V2\3358q\242_\035\216\224\360\351K\253\206\b\267\362\030\270XA\342\254'\212+\345K\301r=\353\017jb<q,O\254\301\356:O\\\207\033\273\355\221m\005\366?\004o\371\337\273;3}\316"
+	.string	"\021\032\270\307\036\273\034\342\315\316\300\031(\336\375\266\212\317r\307v\267\001X\232=\247r\t\342c\2673p\350,\337\262=\300\256JF\306nw\300\0058\207g\361\026*\336\324T\032\245\020\270\334d\210\261\331\3552\007\272\262\310\211\333\240\227\022hE\036\t5\025\345\355J\205\242\030at`\310\037ow\367%x\352\245X\311\324ZQA\312\2500B\250d\3240In\032\327S\273\202\205\374\tj\332D 3%\025\331\235(ue\177\001\215\215\022V\225\215]0Z(E#h\016B(&\232F\301\023bO\311\211\004O\206r\002aB\346\321@Y\311\210?)&Z\026\372|\264\254\323\355U\245~\357/\216az\034)\0173#%\231\270te\222\203\256\353S09\036s\001\304\331\335\237\270\206\324\304\210\0021\312\370\232\035/1`\035"
+	.ascii	"\357bd\025M\3519\231Y$\243\365\231y\002\313cB\232T\334h7\355"
+	.ascii	"\003)\204\272\332T\303\231Zy\213T\020\202\022\367\255xx\023\216"
+	.ascii	"\243\b\013\225\357\237\031\352\224%\034\261R\031\212\320\312"
+	.ascii	"k\036\f\024e\3235\237"
+	.text
+	.section	.gnu.lto_processChannelRangeArgs.264.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\001\004\235\034"
+	.string	"\206\264\271K\260\224U:\270\211f\3233\r\224\3220G\030\234:%\277\325\032\035=\317\003\216\364\365\377/\215\332\004?\fv\240\265\017\367\246\301\370\343\3774\333ti\377\261v/\027\234;\353\233\361\260\001\251\264\270m8>\3417B\b\331r'\031\245"
+	.string	"\231"
+	.string	"\247"
+	.string	"\365C\272\277\356\005\232\342q/\322\001'Ho\036\307s\340\260\256s|\273\342\203'\024'\212\246\356E\316\030y\331y3}\354\274\331.\270\336\"\317\253\252;k\225\242\247i\273\352\370\312S\360\005\217\200B\023gY\331\213\0312n$\205\217]"
+	.string	"\325\264\343I\257A!\257\256Z\f{\236\026\207\304\243*~\262\204*nZ\005UR="
+	.ascii	"\b\177v\200o\007FK\350\253\326\306z\230\220\234\351\b\214\244"
+	.ascii	" \332\006H\204|Z\302^\355'\035\303\023\021Jq\330\363\212F\270"
+	.ascii	"\367r\005\n\207\347\326\2319\311\3144\314\275\024mdF\362\352"
+	.ascii	"_\370\340\311\341\006b~y\362\027p\344\037\203}\351\374r\235\225"
+	.ascii	"]>\364\267\260\034\351\234~\350\214\242\225O\264\262\211V\266"
+	.ascii	"h\345>+\327\263\362\t\004\200q\034>gy\357\316\322\312\2152{\304"
+	.ascii	"\370\322\217\364\312|~\321\235D\274\2115\0049\331\270\367\266"
+	.ascii	"\224\370LK\f\005\364\264B\352\336k!=\021?\211\215~\204s\244\233"
+	.ascii	"\337\341\275\316\361\211(u/\222\301M\226\220\336<`\037;E0\267"
+	.ascii	"n\236\031\207\271\305\314\235$\241\003\246\"K\274\270nO\311B"
+	.ascii	"A\266\2319\\\210\355\230\017\270\203He\306\223\263\215\315\334"
+	.ascii	"\341Ah\351\275\027\002\037H\206\030\003A\307\233\374\022\347"
+	.ascii	"\315\003\243\300\272;V\244\263<qeW\227\374c\307\344d\336\234"
+	.ascii	"i\233I\242*J%\004\336\260\256M\277\033#\254\270\364\315\241 "
+	.ascii	"'^\022\243\037\264W\333\245\271\376\250\270h\234\241\316W\327"
+	.ascii	"\276\323\355\215#\222P\022#)\274\272\344\226\352j\346\231\232"
+	.ascii	"z\340\253\317t\030U\261\306\235L-u\3306\262\356tu'\211\230(\227"
+	.ascii	"\364j\025\263*\332\314\265[=\320\325O\372\213"
+	.string	"\252(\024\325k\023\025\352\330\204\252\003L\003\003\202&G\253\315l\267Z\355V\300\206\026\242G\310x\260U\230\301\321\322\234\355\3466!g\223\251\335\314\340$x\250\261\241\205\200\311\314\330h8\023\227\373\320\034\003Sc\0233\263\325\320j\263\030\034\210\031\214\214o\037dp\263\334\355\206\233\265\220\273\333\025\332,,}\345_E\212P\242v\315c\265\221[\252\322\227\226)\361\240\250\377\361\264\203O\372w\224x~RW\263\255-\215v\260.\271\275\367\336U\033_6\034\3219\372\325\252\364lY\320\201Q~\332i\366\331v\312\357\207?\344\002-\345\2238o\232\315*\002\022\t\372\354\352\022\rM\250A0\210\214BH\021\022\232h&H\352bp\002\241:b\007\020X\311\244I\2265\036\306\352\313\256\253\330,\"zb\026\234BFy{ \207uhq\260\343\256\037\277h}\2443\241\305\224\266Y+\325P\350"
+	.string	"V{W\026\316a\255@2\246\"\023\256a(B\346\266\364\005\007\240z%\277\253\325!\373)@\252\325\255\334Q\373\217\206`\036\344Cs;\017\020d\r\037\211\236B\\\335\232\261:\b\204\340f\206\2100\020I\336\354\314v\260T\246\201\221\002\257\361\333\225\235\202\374"
+	.ascii	"\250h}\362\345\214\226K/[\321\233:\365\003"
+	.text
+	.section	.gnu.lto_isEmpty.265.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\256"
+	.string	"]\013"
+	.string	"\306UO@ o\224\016\310By\200e/\026"
+	.string	"\207Y\214\002\021\024,Ibs\0271,\270\r\2224\216@46\323\277\032\254E\365R\033}\002@\020\002\001(\203c\255(\300\350\376\327\246\251\022\264\367\2262\245<"
+	.string	">"
+	.string	"="
+	.string	"\207O\223\344?\344pD\006\022\031\212\017Z\351\320\262\360G\3212\036fw'\332)\365e:U\007E\313^%5\322=\344\211\322N\231\030\nv\327IA\343\270\343m3\260M\300\376%\273\261z\261%\240\210\r\266G\366\304v\246\375\217s\030\035Dt"
+	.string	"\273\233\207\020\273\234\001\017\260\016\315\335\022\017\255W\342\241m#H02)@Fi\305\001\222\017\215\016-v\271K1\234\024\272\205\342\365\"\302\302\304E&\204,\rW\001\331\t\020\035\246\\ev\252\024\211Z\024U\027\2448\245\013\233+\245z\330\177\273\273\326\315\360 \277\276tj\372\361\027J6*p\034\245b\003\017:\034\f\364\211\336h8\0206W\207\323 \302\265\301>\227\306b\217\004\007\330\005\362x\260k\302\355usj\201\347\313<\025e\033*\306\244\231S\241^\243\304\224\253\b\325\303\177\216t\252\324\013\020"
+	.ascii	"\3571\226\020\032\241\0162\fEe\225\271\325\321J\023\tD\001\215"
+	.ascii	"\353\t\341s\031\345\252\361\023\313\302D\302UU\r\351]\005\n"
+	.text
+	.section	.gnu.lto_printRxFailsafe.266.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\242\007\325)"
+	.string	"zKd\020C`\246\316p\223{\025\361<\273\350\321 2\376\021Ek\225u\005\315){\367c;3\303\240<\343Q\360\323\006l\220\250d\270r\275\207\304Pv\360\217u\214\254\376\374\3203\303\337z\211\220\275\367\336R&\031\364"
+	.string	"\330"
+	.string	"\364"
+	.ascii	"o_\356\017\216\253\202\227\r\rK\267'd\273n\\\346*\246\\y\020"
+	.ascii	"\241\201\355\371\361A\204\342\333\266\314Ulm9\034J+Sd\250\347"
+	.ascii	"\262g\333\337\317\335]\203!\374R\256a>9\2608V\366\254\253\262"
+	.ascii	"\351\347\272P\177\362ow;M\206\037\252-hC\240X\371,\305k\341*"
+	.ascii	"\nZ\277\316\230<\251?W\251\236wo\345W\2127\233\261\275u5B\006"
+	.ascii	"n]\225O\233@\375)|\020\375i~\b\375\271\305]\272\242\032k\027"
+	.ascii	"\204\345\332\021m\317\272\256\303N\262B7\225\337\224\213WS\364"
+	.ascii	"4\233\213{\265#P\202\326u\325\354&w\300\336f\207\230Ia\t\206"
+	.ascii	"\347l^\234B\371q\324\307O_\230\217\233&\323\330\231\036@a5\314"
+	.ascii	" \233#t\276<\337\b\373\342>\333\231\222p\316\346\330\302~\234"
+	.ascii	"\323\n\353\272.#\303x|{\337]\262\335\035\263\233\032\005R\370"
+	.ascii	"k\006}s\337\030\305\213\363V\251\337_\036\312.9\3475\247\206"
+	.ascii	"G\203\363Z\316\306\\\221^ +\350\246/\365n\212*>\222A\007\221"
+	.ascii	"@\224wu\214\335\265\253"
+	.string	"\354\342.\333\275\221\036\2614\333d\273\020\206o\373>\335\355\353\364-\177\323\341\276L\327\3627`\360\264_\301\315\376\245\257}\225\236\366\025\246\274I>\336\003)/\222\312{\224\362\032\360\361\032\245\274\005T\336\242\224\227\200\217\227(\345\r\252\274\003R\336\241\224W(\345\025\240\362\006\245\274\001|\274@)/P\345\005\220\362\376R^_\312\333Sy\325\2247\355\361\242)\357\251\362\232)o\243\274\214\362>B\003\26437[\226l=\247\\u\344\371Y\327\234qN\336\366\273\375p\377\332\315\335\307\275\313\336\313\003I;*f4\324\\\250\207:-\313!\346i.\240\205\202Z\300\234%A}0I\273;3$\376u\200V\352}\234\f\357\221\244\233\262\256\306#7\250\306WY\360\363l\016\036\370\3105W \335\265@\035`\245.\367a\302\336\315\337\2000W\004\t\364H\022\350O\240v\222\023\007\240\201}6"
+	.ascii	"\032\025\222\254\2733;\351|\375\353\264\fG\235q\254\3007\f\332"
+	.ascii	"k_7\032c\024\265{\375\022G\203D\355\307\375\264\223\304C\305"
+	.ascii	"\354dvbw\314.[\376\t\324\354\326\222Vw&\347\213\371,\220\205"
+	.ascii	"\235\366\260Q\020A;\355\037\361\320\376\021\314S\237\215\226"
+	.ascii	"\341\020s\304\3335q2'\324u\375\222\260\037S\\\202Be\302\325@"
+	.ascii	";io\306\256\2305\275\373\251\031\3151.\210\037\346N\315\324\273"
+	.ascii	"\304(>\262[\0012\310\312\335\324N}\202\365\351\006\315\324g\030"
+	.ascii	"c\013\\\251%a\324\222pkIhUE\244\212\221\025\024\025<\302\240"
+	.ascii	"eE\334r1\005\214J\263^\210HqU%E\234R\341\013\361\302j\213H5%"
+	.ascii	"\225\244\225\242\212\352\n\353\202\325\324\325\025Q\305\205)"
+	.ascii	"*\242\226U\025\021*FV\321\n-\242\207\026,\266\244\324\215rPe"
+	.ascii	"\0255\274\252\"\262\030Fei\r\035\004\027\253\305T\326\360\005"
+	.ascii	"\026V\326\360\247\\\327\\\355*\033\224'wuh\264\327\032\265\313"
+	.ascii	"\026X\006\3551Yz9\276\361\336\370\362\275)\3132\3077t\330W{/"
+	.ascii	"\271l;\2761\203\026\366\rns6\347\213\371\334\\\327uM\177\030"
+	.ascii	"\250RC\350\263\375,\2236\346\305y\214&\035\350\244:\f\307\373"
+	.ascii	"s\340\250\221\372\034\345\031\270+by\217\244\037\013\252\361"
+	.ascii	"]\026\374\344 \326]k\324\006:-\323\361\326\341vy\214\212\272"
+	.ascii	"\300\235\242\376\227C\tI\376\271c%\017\267&'\022\0175\201\013"
+	.ascii	"DM`\304\353\350\210\006t\220\316\200>^\200\210\250aH\345\bB\244"
+	.ascii	"hD&H\222&\255\001\240\002\221\271\2629\021P\251C\316\225\246"
+	.ascii	"\225j5\210Pg?\242\304\022\0014\335\tQ\3710:\024\336C\244\376"
+	.ascii	"{\3608#M\266\\\346]%J\f\346$\037\"\266\001\204\017\"\211\034"
+	.ascii	"\344\3440\220\317\rA\220\373}\212\025\003\236\340\264OW\024>"
+	.ascii	"\316j\304\215\2408\351US@\244Q}\352\221s$\032>\024.9\310\302"
+	.ascii	"\223\327KW\305\002WpJ\353\263\353\r\324&\376\021\005\362\354"
+	.ascii	"\202\322\307\277\370t\216\227\373\301\371\253G\360=,\200=\300"
+	.ascii	"\021\223\314c\357\343`\322s\001Y\007\251\206\241\230b7$\374}"
+	.ascii	"o?\210\210S\271\200?\333\n\r\013J\317\223bq\352}\257\351\321"
+	.ascii	"V\211k\247\035\325A=\232\362\33303\b\252\276\302l\020\323\332"
+	.ascii	"\321H\306`\035\331\343\215\200\024$\2074\211\b\005\226\226\225"
+	.ascii	"x\356,L\223\307s\222\025D@\233\225:x\223\243\335s\013\266\325"
+	.ascii	"\301\360L\003\031\341R\374\316k%Y\020\024\351!H_\007\375\003"
+	.text
+	.section	.gnu.lto_cliRxFailsafe.267.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`l\f\335D"
+	.string	"\nx\244\032@@dR\007\257+\004\321\022\024\0243\013o\360\276J4(Sy\312\022E\220\310F\276\bq\270\251\024:(\234\366\034\374A\236\314\376\037Kx\027\342\315\212\325\001\324\324\005Q\333B6\273\367N2\245\231\001q\001\235\001j\276<\243e\177\366\241\276m\241\3614\257\353\315@\222M\363\031ST\r\221\034\"\026Bg\221\2533\265x4n8\241j)!t\366L\r\344r\232\201\f\351\224 \222\323\340d\332\355\232XF\207R\256f?\263Bu\273 t\366\235\316\353\232\350"
+	.ascii	"\302\353c\304l\020\242\002\371\313y\212\345a|\356u17<7\2630\017"
+	.ascii	"\325\310_\316\320*g\373\201\320Y\250\307\323\034\177\254\034"
+	.ascii	"w\273\234{y\375\213\0167\346\354$\017M\316\323\005m@\350lO\375"
+	.ascii	"\330:+t\246\326\331~\273\377@\225\345\345\003\252\017'\035\242"
+	.ascii	"\234s\362\333z\311\327\251\367\212_\177r:61-\031\225\222\220"
+	.ascii	"\212.qx$\f\266\354\372P\370m?[\372\223S\035\025?61\005/\260\241"
+	.ascii	"M\361\245*4\312\212\334\203\202\215\003\330\320\244\256\224("
+	.ascii	"i\305\272\313y^\205\272\255\301\270@8\217\203*\301Hlhn^\264C"
+	.ascii	"\225\343V\241I\344 \301\304\2658\350\021<\f^\260B\275\013\304"
+	.ascii	"\206\366\346G\253\003\2733<\257B\325\326\342\225?q\036\007M\303"
+	.ascii	"\302\265m\222\246\315\253\320\264u\002\2347>\3473\202\203+S\332"
+	.ascii	"\031<^\205JW+<U\324|\317\211\333\365\b\344\355\351U\250\224\225"
+	.ascii	"\352/\215!\267kbv\375\267A=\274\n\235\262RH\323\203\220\3279"
+	.ascii	"6;\033\303\353\020N\210\277P\210C!\235\225\255\310\234\263\327"
+	.ascii	"\371\2008\250\026\214\203\027r\316\215\237gh\336Q\336\355\323"
+	.ascii	"\356\316\353\036\246\tyM+c8\220\375h\027\237_\341\331=Pm\206"
+	.ascii	"\337|\3159\347\365\243.\326F}\205\227*K\363k\256\215\341\300"
+	.ascii	"~\302\377\007\276\3735\201\375\331\310\262_\366\021\017\275\367"
+	.ascii	"Z'\343t(\204O\374\335)V`\177\376#\233\277\354\250\307\037\214"
+	.ascii	"\246\001r6b\342\300g \0078\345?\332\356R\207\214\364A\275\223"
+	.ascii	"\246\321\372\267\230\333C\206\023\265\021\023\370n\026Y\330\237"
+	.ascii	"\376^\347\336\303\256\312\022\300?\262_vO\307\360G\273\035\302"
+	.ascii	"\037\270i\277\223\356\n~\306\033\313\305\355\200A\322\365\274"
+	.ascii	"\257\374\215\367\002o\343mUE\345\342V\340j\274\023\370\027\367"
+	.ascii	"\003S^\306\333\200\213\273\200O\335\t8\236\267\224\217\361\216"
+	.ascii	"rqC\271\270\237\\\334N.\356\243\213\273\251\210\233\311\305\275"
+	.ascii	"T\304m,\342V*\342Nrq#\271\270\213.n\327\305MD\302=tq\037\261"
+	.ascii	"\270\205E\334\301\026w\353\342f]\334+\306\375.n\334\342v\013"
+	.ascii	"Tk\346\352\210\241\376x\277i\006\022\270(\367\261zT\374\215{"
+	.ascii	"\033\3673\356x\356z\356j\334\313\270\213q\037\343G\335\336.\307"
+	.ascii	"\373\272\211\335\345sz\207\224P\023\273\272\211n\332\341\274"
+	.ascii	"y\201C\n\365\313\2135\355|mt\254\331\3104\243%E\217\364\311!"
+	.ascii	"\352\362\3625\335B\245k\264\344\234\211\335n\246\375\316\363"
+	.ascii	"\234\352{M\fh\n\276\310\032\222\022\232\363"
+	.string	"\033\263\306\376q\360\n\276q\323\220\321n}\007\357}\276r\221B\206\312f\f\241\261@\367W\006\356\257\201\332\322\254H\270\230)~\231\266.\370\231F\3466\375\352]\216#`\342\rj\237P\363\210\f\236\r\203W\305\3401`\333\225\344'\321%\251s\352\035\3457\267\341G\361\201$\257\022\254\247-\255\217\354\227\217\206\312\335\321G\373}F{5\025\006\217\312\234\0362\234\210\013\217\275L$\274a\346\333\344\201[\316dX\3166\316x\371F\333^\251\264u\366\352\003H\365\026<\361\001\320\035\t\034\376\202_\3434z\341\204\214\254~\370\016\307WD\217\034jb!\306A\013\t?Z\310\255\236\rsw\210\n\037\275\273qE/\234\225[\316M\177\266\003z\242w\312\372Ry\276p\355[\345\275\202\375i\365\302?\372\325\r\275no\026)\302w>\027V\351\216\370\231\2511]4q\n\005u\264U\3172\357"
+	.ascii	"\315\355)\200\rty\275`\177V=\346{R\250\017\273X\033|\252/!\205"
+	.ascii	"3\346W\2477\206\003\301\270 17\242\335\311\255Ep6\335\257\026"
+	.ascii	"\017\204\241\215\242Sh\016P.\347\214\005\310\3772\264Kq\2667"
+	.ascii	"t\300\376\374\320:\033\374\026M\312\006\360K\373\t\236\215\363"
+	.ascii	"\355\373\236\013\377\320\251\035r\312y\240\367^\313~\201o\354"
+	.ascii	"4\262T\226\327\326~\324\350b\355\324\177\230\273(sq\330\237z"
+	.ascii	"|\327R\"H`\177\262\217l\340\004\336\300\273\235\203\270\243\026"
+	.ascii	"\035b\303\210\021\030<d\020v\261\267\246\220ZS\310\032SH\030"
+	.ascii	"]Y.l\200)5\327\025\r\256\260,\257d\214//\257/-\251\346\272"
+	.string	"\262\001\226\264\001\306\244\334\372\022\261\245\f\243\241,\312p\245\214\033a\353\252\254\001#\353\204\022\254\253\306\f%\230\013\246\f\323\312\002\313\342\312\240\334\372\362*\202\205\311x\030\312\0301\262\270\264\202.j\264xe\214.\030J\257\254\021[^Z\301\326\272\352\202\241\225\214\321\225\345\225\324\002\243\221\274:\366\227\f%X2\354\353\013,I\2342\235\371c\377\244B\212\007\260e\212a:\335Xsf\263P\347\306\27708\320\223|\374|9^\300\306*w38\312\273|\3406&lz\035\002g\017\224\275Nl\347F=P\366\372\234\277\024\006*\263\245\t\312\355\345a&l\372\226&\324\017\243R?g#\246\t\330\351\237\276\300\373\032\034}\201\b\310\363\236\t\233\356\206 \310;\004\351\374ec\375\023\356\341\307w\372a\324\355Ps\r\377\360\246?\3763j\3061}\023\233X\261\252\306\016\223%L,\034(g"
+	.ascii	"\277\264K:\275%>w%\317.?\224\222\337d\227\345GK\365RoVu\251g"
+	.ascii	"\231j\262\314\355Q\201\327\336,\025\034\020'\301\372\243T\217"
+	.ascii	"\371K\357\316FG\304\374\310\314[\244\226f\344\200F\032\350\216"
+	.ascii	"\231E\215J`p\021\261\243j\336\037\221!W\257\364OQ%"
+	.string	"~\316F\314\026/m\220R\221A\b\024\301%!\210\313\253\303\347\206\017))\r\243\211\021\331\362\360\031\206\372S\020\322'\275Tt-\320\331(\252\370H\017\265\327\344\202#\200\364\250\201,\245\030S\246dFD\244)H\322\030p\002\021\242\262\332\006\021\240\27536\222$\2054\006!\243\324\275\177\356+>\022\034W\013\354/\036H\322\214\337\372,X\240\317\374\274\017u,\214\206\372\031\002\313y\245\356\230/DRq\264bA\361%\235Q\353dT\326S\n\030\332r\r\251\377X\267\255\340\270.\212\201dt\340\250\334\246\206\t\376\241\224+\276(\240\206\2358\333\264\212/\337\232\364\235\024\230X\315[\235\013\234\304\237\200\327[X\315\300\270v?\003\235\342\357P\255\313\003Q\344n{\336'\367Jp!\335\025x\2263\334L\346\224-\244'\256\236\261J|\030\353@\346\315j\316\f\356\232~\321\314\235Z\306\337"
+	.ascii	"K\250l\363&\226\270\204.W\2024%\324\353\306D%\227\356\314)\254"
+	.ascii	"\306*\020\341\362h\233\006\235\221_%o;\363\300\214\370\020\241"
+	.ascii	"`\201\325\311t\244\344\177\230\372\033z\024\3313\323D\261\n\364"
+	.ascii	"\321IA}9\206\2216\215H-W\r\3030\260"
+	.string	"bf\324\213\031\276\226\202>Y\206\212\250\312\220+\222\376l\262w\026!\331\323\272T\261\3314\001\234B\370\233\031{$'\030\334C\232\264\365\001\217>\016\247\235\013\300t\220\237\207\214Y\252\333\247\244\020\372\324\243\374\215#XN\303H`\206\324N\336\272Z@F\350\316\021\205,Da\317\311\303s3\213O\264\032\222\025\251p\006\324\222z\320M\203\b\205\304\n\316\374\221L\302\211\337\262\2165\325G\022\033-h\253\246\301\2023J\b\036"
+	.string	"\302Qp`,$\245\\\260"
+	.ascii	"\362\007\033\212\034\210\210\254\200\261\256\361\3130\317\002"
+	.ascii	"\265|d\006\333\301\305t_\322\3468\200\342~pJ.\314nA\355\275w"
+	.ascii	"D\2636\020\273\341\242\301\353\361_\216\276\364\352\365\326\203"
+	.ascii	"\261\360\266:\374\001"
+	.text
+	.section	.gnu.lto_printAux.268.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`"
+	.string	"\013\2358"
+	.string	"je \026AP\244N\007%\2066\3526\3759:\030#\322b\022\304\333\216N8\372\021\304\034\326V\363A"
+	.string	"\305\n\345\336O9\b?\254QJ"
+	.ascii	"\261\340\307e\204O\373\204n8\377\333x D\233\204\264\275SJ)W\001"
+	.ascii	",\001S\001;\210\332\300\266\325\f\247a\n\325\306HQ\336\301\215"
+	.ascii	"\341.\323z}\246\3210\222o\307\321\335[\235 \017$0{\357kIL\332"
+	.ascii	"\n1B\337\n\2735\023\266\201\354\207\210\251\035)<\230\311\204"
+	.ascii	"\251\355\232\264UC\336E\331\373\272\035\206;\217\221\2752\263"
+	.ascii	"\030\034KMi\233\306\316y\003\2443l[iT\257\\\343\366\332Hf~0:"
+	.ascii	"\362\274\370r\267\006\302\245\335\205\331^v$\021\265M;6\251\333"
+	.ascii	"+Ko;s\323\365\026f\327\365\340c\333\272\345\355\265\255T\212"
+	.ascii	"\235n\257KmT\354U\355\242b\257\314d&L*k\305\"L\343\234w\206m"
+	.ascii	"\333R\375\023\026\320\252\264Y\351\314\036R&\205\220\354\361"
+	.ascii	"\032\213\253\372\316\344\306\353\246h\242\235`^\232X\017\251"
+	.ascii	"_f\230\244\003\321\224\250\030\0029\345t\036\231+\235\250\265"
+	.ascii	"u\222\311M\215\255\205\22242\211\034\032\022g\331\3204\223\034"
+	.ascii	"\332\021?\022\351\333njkm\354@\264\265\366sz\261\307\214\364"
+	.ascii	"\252\026\031!CG\231V\246:\2403\345\b2\315\314U\325@\234\277*"
+	.ascii	"\355\327L\201hF\324\246$L\3064\232\366\263\264\246\177\347\365"
+	.ascii	"\n}\003\244;tSkk7nh\333\226\375\231\246\326L\324\314\315\200"
+	.ascii	"\231\2550\263G\001\005\210\304\301\351\023\347N\323\003\261?"
+	.ascii	"\205\257\360\353\324\214\n\231'\262)\366\373\267\231\034\231"
+	.ascii	"'r\324\3677\232\006!\027\375\263\023\304\0334\346\211/\270W\307"
+	.ascii	"\344Y\351\021>\252!<\263\026\f\357\347\2047z\366I9,4{1f\251\230"
+	.ascii	"?\224\271\223\342\272\374\3617a&q\235E4\231\346\020m\246\371"
+	.ascii	"\303u\346\320i\232\253z\332\254!C\3675_\350/\335\026\232\257"
+	.ascii	"\271B{\351\2460\241\301tG\350\272n\b\327y\352:K\365^\263\203"
+	.ascii	"\026\323\034\005\325`\232\033\\g\006"
+	.string	"\327\371\211u^p\235\025\260\316N\3279\301un\272\316L\254\363\322uFp\235\017\\g\003\254s\001\2443\001\326y\300\321Y\351\350\234t\235\221X\347\243\353l\304:\013\270\316E\3279\300u\006\300:\023]\347\241\353\254\274\316I\326Y\b\351\214d\235\331\243\363\361\350|\257\263\261\350\\\274\316k\321Y5:\273\321\271\255\240\022\355\342|\231byAi+$\021\261\005\\\371\342:M\367\264\273\257\233L\267\231\356\275n\276n1}\231\323pO[M\3731\262/\257\3430\b\213\244\225.\352\347\260\356\370P\366bTw\223\251\031\247\236\221\303K\375\031\363\223K=\362\207\276\350\215\036\351\243\236\033\020s\212\321m*\247\215\256m\315\372\311\254r\315\232\355\251W\3433\2570\347\274\237\254\266l/\306G\217\344g\016\263\275:z\032\321A\001o\244\245\371X\tx\037\321\301\303\272\261<\035\340\213z\260\001|"
+	.string	"\242\007\260\245\013\365\020\315\325\031\233\312\0372kSj\236\026\223\257\374\027d&'\364\311o&\227\306c%\001\nW\365\235\016\275J\325\021\372N\023\315sX\367\241\353\204@\276\217(\341\234z\331\347\360,\024\016\220s\020\363\210\246c5\307\007\342\025\373-%J\330\234\b\347\211\233\361\241r\272\352W55Z\332J\027B\303\342C\327\260\242\206_\307\324\\\261C\362c\3257\222\022\035x\374F\214\322\231C\362\373\314&Px?5|\247-ir\212~\263\342\266ms\002w\033\346\223\305\205\353\365~\363\211\3169\254S:\324\257\237\341\377\314\033\021\300\342\033\213\337y\234G\324_\277\235"
+	.string	"\374\302Wx\346\026K\357\247\372\277\347m\b`\331\213\261\277\205\277\360\355\327)\356\340\360\314\250\220y\363\017\310\232\372P\356\035E\013\037\034\246`)G\330R\tk\311\305b-\271\336\303\327\214eX\r\255d\016/\027\357u\"KKF\327\326\214\273\3256\300L\300\350\332\312Zj\305`\257\300f\204-_he!\370\332\312\352\362\352\320\345\265\005\266\274\261\005\206U\245\225\345\305\225$\343kyE\203+,\3532\326\324\326\f,\252\256\255%\027\025\226\215/\252)#\366\242\241e\203\n\314\313\313\006\025R\332\3667\301\353\233\367\246\360\260p\354\311"
+	.ascii	"\207\036\312\307,\311#\334\224\316\251\347|\306j\262\3017^\037"
+	.ascii	"\241L\2658\365|\302C\375Y\363i\265m\333V\211\243\030"
+	.string	"\365$\276H\364\217L\020L\033\231'z\222\215j\260\351\240S\017)\342\247\246\236\300#\370\004\257\340\237\030\3049x\006\337\316A\013\376\311\201\370\271Z\340\364\n\374i\345\364*\242\200\016\233>\001\3237-=\323\026\377\341\\\232;\360\b\f\374\201\1777\005\336\200\227Y=\325\361\246\023\224\002\337mQD\037\013B\340UD\005\t\rx\021o\204F\021\364\266p\300\367ZTP\023\032>\235\310\020\t\370\372\246\370\364\355\356\b\373Pn\277>\016N\3058\365\326\342\3653\255s\352=\367W\321\301\237\265_7\333sM\2245\303\263\372P\337\340\317>\374{\351\213S\n\361=\0041\210\322\267\232\350\237\244\017\001\200\301\250Q4\b\021\202\204Dd$HAA\223t\260\002\2211*\325\001\021\3200\251 T#II\322\030ZfY\037\r\235\323q\202\300\316\364-\304\024 !w\332lh\205\217\006Y\344\3738\341"
+	.ascii	"4T^\202d\235S\245\341\"\255D\3516-\026\005\343V\263\2616\270"
+	.ascii	"\272\013\356\201\326\223hlf@\210\266Q\030\240\021\353\236\374"
+	.ascii	"\363\363"
+	.string	"\330\343\344q\212O\002\022\207K\322\2665\033\221\346Y\207\333\235-\201\342\005\335\035@\363\336\332H\t\0064\215\365\ta3\350\202\254\301i>\226\243X_\366\310ZPy\361,\201&H[\250i\356@0\235\211j\225X\340\341\204\013\247G\331\017!b3\337\347zv~\032\272>\323\033ME\265\021\311\001\320KN\345\2736\026\313\251\270!:\236`\036\b\214\027#%\023\366k\361\262\205\245\340\020\320A\372|<\007\005\223\206+\265\375P\2771e]\272=\317\217R\006[I\n\265\350f\230`6\003Tj\274[\027\016\002O\224\265KZ\332\375\240(o\317f\276S\333S6\373y\354\021\221\037E[5$\2037\036nR \021\n\226\201\3221]\036\017\0331\355[\356\214\340\375\250\023\213\247G\3508\2304\361\300\335EM\016\304Y\273\257G\376\t\336\001\207\233[\34150N-,\006\213\321 \030\350\376"
+	.ascii	"\365\006\275\202\021\317{\f)f\270g\036.\017bB\203\221h\346?\214"
+	.ascii	"XT"
+	.text
+	.section	.gnu.lto_cliAux.269.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`9\001E\016"
+	.string	"\326\332`E"
+	.string	"\2216\035x\232G\tDT(`\025\277\322\2214\330\241A\031\030&\314Za\036\200\232:&\250(\265\377\357\021a\356\210\336"
+	.string	"\227\371\02450\247{\246\377/\357{\307\300i\377}\336|\344\237'\177w\333;\245M"
+	.string	"J"
+	.string	"N"
+	.string	"\357\324\323\353\003\352\251E\266\215\002%;Z\240\372`\342B\307\356b\323\304E\247\326\224\"\377-\337x\340\350\364B\271\005"
+	.string	"D\371\264\020\2101r\b"
+	.string	"MV\347S\361\336r\t\002,I\251i\260\273\226\036xr\327\333\216`\373\201}\021\001#;,\311Y\302\376\034\307q\364<\331g\371\353\303\237Z\322\277\256b\304\027\342\344+T\273\337\270cWT\006\312\366\335\341-\254\340\304\013\3169\266e\350a\306\307\245\375\225\263\020\235\205\344\036\273'\227\230\3350\201\017\\\247\016\003\365\251\303\370L\034)\273\244{O\331\037\207\3116\250/E\215\225\335e\340\362\027\315Gqj\013\233\274\267\325\323\037C\265\271N\336\363_TH\254L\2362#\306Ls\250\237\024R4Lr\306\032I\247\035\332 \357}\006\200\271\261\222\021M3\276\340\ti!\035\007\222\201\260\254\202\001md\023\321\270\017\204\020.\3238\363l\"\0316\262}8,\003\2050O\307]\006\r\204i\350:\020\306\tI\267v\236\354"
+	.string	"\024eD\322,Y\273\273\224\200\244\263N[\302\004*U%\037\312\362\220>I\365A\002\033"
+	.string	"I\231^\t\377.\306L\274K\nWz\021\301A\242\335fX\f\034\314\032D\267\211\252\370\202"
+	.ascii	"\t\261\232(\031\354s\327\3005\002[\341jP\b.\003#\002T\224q\227"
+	.ascii	"w6\331\024\346\032\255\202\002"
+	.text
+	.section	.gnu.lto_printSerial.270.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`l\n\0251"
+	.string	"jU\350\022DP\236N\007\003\306E\312Y\302\257|\020\2145e\340\307\377{\203\301\213\334\254\223\231\225=!\020\314C\367]C]\327\253\020\354\213\326\001 \016p\fl\321*\020&\332\310\351\273\326AQ\333\273\333\336;\311\224\002\027\001\005\001&\001\355\022\242\006\357"
+	.ascii	"\361\246m?\030\215\321\016\357\304h\330?&\236\305}\257\333\371"
+	.ascii	"\332\373\272\330RTI\317\022\226$\026\215\321\210O)\226+\327\261"
+	.ascii	"\264K\273\350lw\357\321HRFc'\254f\217Jg\030\307\321\005\3166"
+	.ascii	"\n\327Y/v\367\347\325\270\322\026\002o\n!G\275J\322\255\330("
+	.ascii	"\n\020+\357t0p\235\355\250\353\271\333\351\274.\351v7\372\215"
+	.ascii	"\343\270\276-q\034e\320K\256\263I.\324:\273zP\353l'\273\337\024"
+	.ascii	"\225\305bSS\266\345\025\3038\216\215o\244]_\243\336oN:\374\272"
+	.ascii	"\304\226]?'\333\365\\\t:x7(u\2129\274\022\317v\bz\232\035m\253"
+	.ascii	"U!\2346\227zn:\311\362[$\215\315]\342\017oW$@3Q~\234\313U"
+	.string	"\311M\b_\321i\226Y\260i\220\302\270\2645_W(B.t\212\316\262U\bm\t\323\373<\2379\225\371]\352\354s\217JW\215Kc\363L\264\020\307qg\2463\315\273\350\335\275\327\335f\3350P\271\t\035\252\036\273\276\305\037\347\256\266\346l\256\377l\017k\363{\335\255Qf;=\224\375\273K\230\310\316\314?\001N\331(\274\313\225\343\311A\375\357H\201\032\307J+\025\316\005\313\215ce\325\226\344Z\326\224\034\324F\353\254\277\367\371\352d,\320\360\255\316n,\037\276\336Y\225\313\267Ov\360\013\334\370\335,\220\331\231R/\324\344\021\255\022\232\275XwT,\377\263\333\255\n\315\232\364\023\351\216`U\345x\356Tn\305\375\201\224\347\271;p;w\243g\361\206\362=o\005ON\236\347\335\344\346fjs/\301\271\023\300\271\225\334\334\b\336\334Ip\356\003nn\003on$8\367\221\233\273\300\233\233"
+	.string	"\234\333\310\315]\364\346&js\017\301\271\205\340\334\003\334\334Aon\001pn 7w\20077"
+	.string	"8\367\217\233\333\347\315\335\003\347.\272\271\3417\367\353\346v\331\334D7w\353\346f\211\271Wb\356gs\3476\007\037\250\250\271y\234\222\313L&*\321\373<\021lB|\312\305\377y\240\037\360B?\364\235q$\235\020\343\002\333\274\321\305\261\2313\223P\\3\244\223\263\355'\243$\245dg6\222Z\022\272\330-\227]Ue\345q*\2235\r}T\0306\273\271,v\241*\307\307\251\303&\241w1\3200\325\023\216\347\316"
+	.string	"\001\0374\305\355T\r\005\314\245p:s\200"
+	.string	"|\200:\227\023\247\020"
+	.ascii	"\231\252\226\303y\363\323\363>I*\336\206\315\232\2369\273v\341"
+	.ascii	"\324\013n\273\240\017fX{\003\207\326\231\034Zg\213\217t\344\357"
+	.ascii	"}\370}\231\247=x\340\207\n\200\307\ti\214\357\373\035h\231\252"
+	.ascii	"\235O~z\367\255>\f\216\370\356;\361}\351\245\352\333'>\245\203"
+	.ascii	"\313<c\371\260\0278\373U\377e\226\177d\371\260\215r\217\367\230"
+	.ascii	"\366\177\375n\021#\2623\331\277\001g\346ef4Q\311\034+\214\241"
+	.ascii	"Z\177u\303T\363\351\f\317\223\213c\2453\305\034]0L\217,'\363"
+	.ascii	"\237U&=\303T\363!e\200y\355?\375\234\352\207\220T)\004\f\315"
+	.ascii	"\245\305\224\204\364\305\205\0256c\313\007\351^`$X\304@jam\265"
+	.ascii	"\200\301\270\302\260Vli\bb\201\\\021\243+\003\027\026\322k\353"
+	.ascii	"\253\347\305\027\026\b\0310\302\264\334\316j\200\344\3122\306"
+	.ascii	"@b\3010fy}"
+	.string	"\031\033\bu\227\214-/#XW\227\227\261\030\215\375\211\350\271\313\307FX%\034{2\370\237\375\"q#@\247@\226~\271\233\275\272N\357z\376\312M\335\226~Y\352\237\276\351R\177\343\334\255q\034\307/\261\351{]\237\336\351\233\335\3564Z\005\037\341{@\265\334\r\346\275\221\345\303\334\305\375g{\233i\222\245_[\365`\323#K?\326\2778\3247\247\320\245^k\365\275\262O\337\364M\243?\372\003\257\364\t~\211I\311\032\273\275XC=\323\267O\276:\320\253$H\226>\352\314T\356B\224\221\243S\221#j\202\367'\320\300$]&2D)\351\021L\311B\340\202$\005V1d n\007\220\336@]nc[C\232\353\220\325\262\217\243'\"\360\0052\2174'\201w0P5!2Z>3z\"\242/\3129\002\200\275\250Q@&\021bdDFD\224\246I\032\003\360\002\221\241\241\266\001\021"
+	.string	")4\016UIY\310n\213H\031Y\251\354"
+	.string	"N\001:_\2368\017\212(\344}8\376\342\221D.|[8y\237\353\330n"
+	.string	"c\273\262N\243\304\226g\331_\370\017\264\323\345U\f\302H\374\215\264\267\3124\361LC\032"
+	.string	"\271\205N}\253l\322\273\216\017\356\271N\214\020\t\311\370aL\344\331\005\n\344_\367\2660\333nB\334V\373\201'\351R"
+	.string	"\333\257s\037"
+	.string	"\245\344e\001\033\217\332d\353O\371\232.F\301\030\216S\377\016\"\036|n\007\f\270\256\300\032\2044\215$.%D\274\035@\241\\m\213\241\243\357"
+	.ascii	"\005r\362gS\323}\306\353\201\356 y\352\2000sV\023ng\247\023c"
+	.ascii	",]\322\262\215B\232\366^\335\310\274\372\017\350\301\264\366"
+	.ascii	"\3055\r\0163\363\200\202\243\\\f@\006\311\177<\324\343\217n\330"
+	.ascii	"\177\312z\205\001\027Fr/2s\265zCgb\234\200\324\241\265R\257\222"
+	.ascii	"C\326\232VIi\251@\032\352\266\t\254\264\242\231\261\244\315\207"
+	.ascii	",7\267\366`\r\t3d\225\023\225\316\335E\026\347\244i\202x\316"
+	.ascii	"\313\220H\354Al\300\331$\23245\300\344\237-\"\005H\243cL\344"
+	.ascii	"\324A\352\217\247\305\266\376SKa\007\374\003"
+	.text
+	.section	.gnu.lto_cliSerial.271.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\260\r5G"
+	.string	"zz<\033>0bR\007\313\201\264\260]\325\r\325\206\254\335E\031\005\024\214\257\341]U\241\216\2329>p\005e\334\f\353\272\3213\211@D\n\347\003K\265\347\021\326\314\334v\245\322K+\261Mv\222)\005\251\001\210\001\241\001\203\216\355\345\031G\003\3654h\311la\037m\316\322\026Y\346\326\003\250\233I\363\374\226s\030*D\364\200,\323#)\343\311>\275+\f\244\315\371\252\001\351\306v2\376\007u\300v\343\231\232\375\207\236\302Dm\316\331\002\322\215V\2563\275ct\270\031\3115S\233Vl\231\275\304\234\257Xnl\007\335\370\312\343O\002\307\335\276\347|P\357\353\341J9\337\r\252\311\371\252\240\t \335\330Ww\276nD:\323\353\306\206v\007zr\313j\016\n\013\341\376\022s\316Z\017\245]w\257\336Q\030\352UO\252)\251(\250'\247&'"
+	.string	"\246%\245$\244\346\021s\251L\"\217\257\321}\fm\237\252y\325\323\216*\306\251\300\f\021\007M9\036)\337\036\226r\231\207[\2228\036\251\236\333`\356\314\241\263\231\303QO\250a\034\352i\216Sa\323\025+\330\231\006\300 S\025*x\251\214\322\261\353\316\220oP\222\024-\322(\030\351\3140\314 ;\352\027o*\255r\022\301\370\221\213@\273\006\221\343\221V]\247\234\225\250\277\241\303\314)uoR\316\331\355\244K\336$)\236\273T\242t'\2641\"\347o<"
+	.string	"\036i\022\027S\3613\310\331x"
+	.ascii	"-R=\234\304a\034\031\300\216\212\304\217.U\236:]\034\217\024"
+	.ascii	"\211+`I\223A8\374\032q\243\3134w\346\2609}s\023\034nI\262\234"
+	.ascii	"\272a\367\265\242\321\356)\332Q\373\374]\004\3259D\232\3236\327"
+	.ascii	"y\307\t\242c\035\307M\3310>v\345\234\033G\247To+\357\306 \272"
+	.ascii	"\033\257{"
+	.string	"9%P=g\237\2343\004\037U\026\301 Y\303\3339wS\226\030u\274\013\376\327\370\b\n\200\263\276\033*\246\002\366\350\2027\nn)\224}f\330\200=\232\365V\f\034\353\025\374q\0176\360\215\013\033\336\266\024fz\033\276X\356j\034\253\243\031%\332\375\001\004\036\244\223*j\337\234\355OV\353>\341\366\036o;\211\327\327x\235\024\330I\b\310\226\270\227\363\332\034\247c\242\275\212\033\373D\n\354\321\024\257\033\335U\274\335+Z`\217\266\013n\321\313\302\265\337!\270&\377\326\266\361\372\273\360\373\323\206\025u\022\306\372n\257/\354Q\177\307\372\007%\327Dm\333\253u_\331\360[\273\335\003\355\364\231\366\337u{\237;\206.\n\356\306\233KB\004\b\016\266|\214\367\002\007\364\316R\340Ww,%\356+\001NX\306\273\352I\345\204\336SRG\270\243\222\270\241\222\270\237\226\270\235\230\270\233\222\270\235K\334"
+	.ascii	"\230\270\231\222\270\227\226\270\225\230\270\223\222\270\221"
+	.ascii	"\226\270\233L\334GL\334L&\356%\023\267\322\315x'\223\270\221"
+	.ascii	"K\334G%\3567\211\333\230\304\375H\334\370\210\3339d\375\261\345"
+	.ascii	"!S(\347\371\\\263\334\226Q\316\032\t\257\270\033wB\3671\356\200"
+	.ascii	"\356e\334\315\270\247\361c\267w{\233\3667\275t\243\343\316\260"
+	.ascii	"N+\303\325\264\263\351%a\273\261j\273\346\351\361/N\342^\214"
+	.ascii	"\033\256\246\237zh\250\272\227s^b\367\363@\027\364i/s\221\371"
+	.ascii	"Nnt\002\027\353\234C\324\340\035\002`zk\033\215k\201\250,r\027"
+	.ascii	"\3642d\251\210\035\245$\327\323\336%\316\316\365\313o\332c\310"
+	.ascii	"G\321]0/\021\022\327\021\307\2469q\301\233\243H\341\315\035\270"
+	.ascii	"\346[\253\371\355\274\312\n \235\243\267\366\322\323^\345\273"
+	.ascii	"\235_\2356\254(\355\345z\3457\355\221\223\350\255\312\226\310"
+	.ascii	"=ONV\r7j;nP\3640\267\235\205e\324\336\b\273QPQ+\320\303\222\231"
+	.ascii	"\344\253\304\356\016\204\314Y\315\253\356L\262!\036\226\234\363"
+	.ascii	"\225\033\255\336\005\363\n\263nx\0213*R']\276\265\221o|\263\032"
+	.ascii	"\216\b:\207\314\271MB\273!?\004U\342B\351\240u/\264\356\223\204"
+	.ascii	"W\177\374\360''\320\267>\343}\377\352\033\303!y\237\3531\032"
+	.ascii	"-lt\002\265b\217\276o%\341\215\277d-\334\302->q\004\tzQ4\205"
+	.ascii	"\022\225o\355\b\377c\020\371\370\371\251\212\360\376\306\225"
+	.ascii	"\024\363\262d\333^\355\347\316\034fI\276\2651\033G&\032\312\301"
+	.ascii	"a\217X>\365q\370\335z\307:\022\321\360\007\034\366\270\365\002"
+	.ascii	">\256\335W\352\361\021\302;\370\270v\344[\377\270\324C\370\346"
+	.ascii	"\2368|\336\252\017\305\261P)\036%\204\377\337\251x\177~|\002"
+	.ascii	"\027\021`\245\267\233\267\035\212\367n]\201f\301\036\305\357"
+	.ascii	"\212yE\262o\200}\211\254\034\337\332T\203uu\214\356ios\220.\215"
+	.ascii	"\333\236\366J}\\\326\267\376\327\020\241\030\300\n\272@\275`"
+	.ascii	"\217n\275\027\346M\263m/\030\307\006=\006V\300\212\252cd\215"
+	.ascii	"y\211\231\205\335\320*\023s\312"
+	.string	"\021\006F\326!\354\314\253\004\030\232\227\213#17+\253\241<#C\243\201\006\303\254\002\230\330\230\027\216%\263\263\032?\346\205\343a\210\275 +\273pF\026ff\206\366u\024F&6\026F\303+\004\030\215\257c\177e\211\215}i\221\211y\321\320\3722\273\241\225\345\354\262\032afZgeefZ\313\353\332\020\357Z{6\037R\365\324\303\304*\237k\353\354\305y\242\2719\333Q\3604\356\3321x\333\0260\322/\275\363\237\036\352\243\276\361\235\217FG\273C\3047\217\372\330\"\337\\z\300\215X\336P5(\033!\271j^\362j\035\365F-\202\372T\371\240\276\204 =U\276\021\270J\367\324\364NG\232\300\240\300I\346\234L\017\240\b\323\357\300[Td\201\215\024YJz\245!I\277\003o\013\306\005\246\342)\322;\245\020\036}\363\035n\021y\364GBA\214\252|}kx\333\023\260\347\241\352\263"
+	.string	"\016\n\344\312\213\0358jT\364\250\2700\206 P9\214u%A/p\022\370\351\342e*\352\371\255L>?\371q\355\346\311\001k\202\250\370\321!$\365\326v6\356uqY\026\241\272\246\336\352\343\344\006\267\b\201\212\360\215\024\360U\037\327PT\337.\322\301??\316\252"
+	.string	"!D1\356\356\346\234s\024\323\363\273\351\371\355\036=\235nPo\361\211\302\267\233\364|\252\217\353N\340V\337\365\316\306E\374\305\331b\250\347S\370\346\036:\333\267j\200\256\254\307\260\2126_\363\225\373\242a\033\335\323\264\017\017\220S\323\221\007\201\016\250QD\003\025SfDDF$I\2224\006a\005\004!'\035\226\007\021p1Snj\322\024\2069\037\313\243\324\206h+-\223\302\351\273\324\344\320\037^\204\013\337A*\"\243\260\345\250fC\032\256\355bz>\n@U\367\202>\270\264\021\317\252\266\323\033\210@\2379p\033\377\"\365\343\023\251vg\354\377\365Qo\356[\311_\037\321Gl\246lx\343O\004m-''\346\023\354>M\322\023I\207H\200\374m\246\336\013\207=\by(5\210\017b\275\nr^\243D<R7h"
+	.string	"\210\274\027\2061j\274Wz\024\362`"
+	.ascii	"=:]\006\200\346\211\225\362\217\260A+\037+\211m\026 m\033\036"
+	.ascii	"x\350\243.\343V\376m\344bw\315\320\301\230[\337\305\024u\320"
+	.ascii	"\270\341\301\r\271\360@\354SQc\321\265\300\017\273\217\365\022"
+	.ascii	"A%;\007\255\272\330\033\332\335D"
+	.ascii	"~16\330\034\021\345\330\226;\027\203\365\025\r\252\364\273\366"
+	.ascii	"h6\023Q\r#_P\354\236S\336\377\232]\017\030\205Z\022~\200\324"
+	.ascii	"\251\326_(\220R\252\200\306\270VEf\004\241\213\261L\353U):\255"
+	.ascii	"\371F\032\314\273\317\"\221\245<\035\316\213\031\204l\337\020"
+	.ascii	"B\203\372\363\370\255\021\023B\361EQ\202\223\2743\272\322\b\226"
+	.ascii	"]\177\244\027\002\227\226\234\365*\033\205:\211\344\247\367c"
+	.ascii	"q\201\257\246\215\373\007\234\200\365Nz\242\377VH\265\006\271"
+	.ascii	"\371\362\001P\022P\320\n&\t\n\247\025c\311'\240o\0319\214\240"
+	.ascii	"q\037h\202P\304s\266\034M\016\005\342<E\200-\307<\237}\004\374"
+	.ascii	"\330l\306\313\034\216\3523\f\336\231\327\302\202\036\t\300\350"
+	.ascii	"\t\232\277\367S\bx\177A\341b\207\316c<*\034ob\232\025\363Q\261"
+	.ascii	"_\211\267@\215\026WB\341\275\035\235\026\303\232l\223\325\216"
+	.ascii	"}\362N\276\013\355\264\211\234\316\240\256\207\2318E\365\247"
+	.ascii	"6\001@%\250/\363\355\372\367\336\336\234j\352\2013\372\021\240"
+	.ascii	"\233hE\r"
+	.text
+	.section	.gnu.lto_cbCtrlLine.272.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\266\001E\020"
+	.string	"F\236jF\360\260(\035\372\035\313\211\347\f\217\003t\005v^\276\343\214\235}-\305\275r\213\356\001 \344\031\034W\257m\037D0\256.yIF\323@6'\033\225*\"3lbt\351\370\364\332\260\253\366\212O\b\331D\312\224\002T"
+	.string	"T"
+	.string	"T"
+	.string	"F\340=z\366\020\367\350\235"
+	.string	"\367h\320\206a\200\265\251\0061\031Z,3v\367\323\016\007\317\305M\023\364O;\307\025\246\316\235<\226tBVn"
+	.ascii	"B\r\327-A"
+	.string	"\315K\fPH\262\205L@\270N{b\bW\231\335\203\335u\272\302\327\335\3356\311\266\003;\275?\247i\325tn\351\007(\360\001\305\35332vMj4V&\252\b\361\226\337\376i\356\370%\316\002\276\3050\337\327\376\002\213\030\224\232\335\355x4\003\357qc\323\331I\200W\031q\334\3450\243\300{\024\220O\373\">\002\274\314/>`\027&s\331\235-\b M=\355\020b4+Z5T\034\234GA\332\235\254\262\346\177\204\343\250G\235-\224\325=\334\324\270\250\306\334\361NUe\323b\305\005I\336\370\332\351Spz\005\261hh\255\032\252\254\331\263Tj\314\376\266\273k\205\3311\r\212\351OL{\256\362s\336\"\013\244\n%\217\b\236\322\t5\332P\026H\250\020\323\250\363H\364Q\032}!\037\036 \337\350$\362\211B6M \235>\224\311t\372:\263\375\266\n\343\244\300\310\250t\305u\322\226"
+	.ascii	"\362\023)/2+ME\215\231\203\373\034P\331\324VhL\234\243\237\315"
+	.ascii	"\313TU\233\202H\336\345\r\226\246,\322\227l\b% P\002\"\205\327"
+	.ascii	"\r\301\271~6\006\333\203\2205\217\266B\206I \207\020)\275\263"
+	.ascii	"\210fH\213\362\340U\f\241\201\2570\315\240\227\020_\252P\f\276"
+	.ascii	"\224\"\265w\274\001\346\030\222\034\205\246\330e \373\332e=\313"
+	.ascii	"\262~\023*\215\311\0355\270\221\027!\003\024\327\024o\3235\204"
+	.ascii	"\005\005"
+	.text
+	.section	.gnu.lto_cliParseSerialMode.273.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`v\001U\016"
+	.string	"V[`D"
+	.string	"\223\223\016\370\r\375\245\017\037\323"
+	.string	"\377b7\377\377\314&\376\017\257\220\035B\230\347'\274\351\023\330\f3\330\267\360q\353{\023H\212\372\361@\377\377\032\024\200\352\030#P\344_\006\361\346\360\234\204\220\275\245L)N"
+	.string	"I"
+	.string	"O"
+	.ascii	"\252\006\"\027\017\301\315\007\030\024=vW#\360\221\353\021^\344"
+	.ascii	"zT\017\347~E\250\311\371O\235\201(\247E\362@\2776<\216D\te\256"
+	.ascii	"Pd\346\005\013\200\367\002KX"
+	.string	"4\034\236zv^(\023[\260\273N\222W\272\261\333^\261\255\300\376\212G\335\232\351\314\364\263\001\"4\224\216\223c7\246\365cWqF\210\243~\233\363S\006\361QV}K\373\f7n@\350\330]\222G\037\310\036\323~\211\233\340\376a\270\200]\023\215\030\273\237\211\013d\217\3762\333\376\210\223\340\354zr\200\316\246\203\226<\304\205\nG\222\\\265S\361l\221 y@=%\213fF\206\372\302u}\220\302yI\037\306\362'\236\202%\333\035\235D!\033\231\030x\274\324\256`!O\272\236E\315\216\225HA\366\007J=\331\207\253&\033\373\367_0n\371\250[<\212\002aS\201\021\266\217\272s\222\"\241\243\255\2448P\321:\036\026\355d\304\333\004\024\217\366\3316\217\006\362\355\341\252\311O\3751\235\r\214\210\251!T\205\332\331\206\372\0325\255\225\213\206.\347\255\272T1\21596`dB\331\212\001\035"
+	.ascii	"\3571\346\2107\350\025\b\254\240\207\r\315\260\027\264\016\034"
+	.ascii	"\001\333\001f`\t+\344HB\212\212\270F3\001\272\206\213\254 -Q"
+	.ascii	"\214\212\027\267`\212B\215\240\212\fNL\322\006\261 \022(\003"
+	.ascii	"\362\005fL)\024\024"
+	.text
+	.section	.gnu.lto_cliSerialPassthrough.274.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\026&%\261"
+	.string	"*\032\241?O Fa;c\033\350U\214\233\350\370\t\240]\223<\016\303a\013\325;|\017\211?\301\202d\217\204\343\355j\253\265\320\362\307=\326!\202g\013h\203;\007\347"
+	.string	""
+	.string	"\324\213A\3552\345N\207\340\312\243\027eUl*\224\255\212\211\245\312-SJ)\363\003\227\003\372\003j)\320\314\361U\231\326\275\237\334\013V=\341\245\032\277\254\365a7\233\356\301\3564\335\200\335}\335f\272\371\272\313t\223\351\026\323M\245\373Jw\226n-\335[\272\273t{\351\376\322\035\246\203\230\233\271\r\271\3330\317\341\216 \177\206M"
+	.ascii	"\t\271\013\231\207\215R\214j\350\001\341\0305\334k\230g\260G"
+	.ascii	"\277^\357\017AC5B\2744\334\202I\027\300\031\232\021\006\002&"
+	.ascii	"\355`!#\254C\303\355\307<};\321\352\237\234\024*\367^\237a\036"
+	.ascii	">\276\353W\354m \207zp\b\237\264m4s\365\323U\315K\322\3521\017"
+	.ascii	"\231E\352\224y\310\344X9\001\261\323\332\316\3436\201y\304\370"
+	.ascii	"\270\200f\020\021\016\221\254m\343\332s\215\245\351\272\256\271"
+	.ascii	"\264]\223\320`\032\217yJ\350;g\207\231 \353'\252&K\230\220\266"
+	.ascii	"\215\377\216h \366\213\027\2706//|\267\276Y\3365\252&\357\245"
+	.ascii	"\240\313\217\365\035{\037\215\032*\\\033\216\022'\234\275\345"
+	.ascii	"\207\233%\367\202\261Q5\177\017h\261 j\013\210\002\3232O\336"
+	.ascii	"\327\013\003m\026\013(\274{o\207\tN\365\b\337WnF[\245\2558\373"
+	.ascii	"\n\337\271\\ro\0206:\370\302h\333\350\256\r\304R\261`}\307\344"
+	.ascii	"^1\326\017L\016\016\361}\345\226\332\310&\3326\312Y\240\310\324"
+	.ascii	"\316\334p\035\347l)\263+\274oZ\031/\357+\327\304Fm\033Y\256\205"
+	.ascii	"\3306\266\r\304\266\321\311<\210\241\353\31521\325\362\264\202"
+	.ascii	"\370\276\357\323+i[\306\002\345\256\201s\252\325j\265W\271\346"
+	.ascii	" \243\263Y\013\323q\026\306\302W\330\nW\3419\246\302#\260\334"
+	.ascii	"\013\027-X\254P\221\002\005\002P'L\034P\202\304\210'\247&\246"
+	.ascii	"%%\021IH!\216\214@|\360\340v\340PD\264AC\006\fC\027\270N(\b\310"
+	.ascii	"B\005\n?>=G\236\035\2356\2075\256\357N\356\234\250\254f-tC\316"
+	.ascii	"\320\2104gYs\272\300\234\020\241\200C\370\245\005/p\306\262w"
+	.ascii	"e\035b%\350\f-\203\346*Dg[\030\\8\333b\200\363\\\341\2273\225"
+	.ascii	"6\031\254\201:\217`h\006\326,'\330\253\221\263\255\261\r\316"
+	.ascii	"\266\200\370\213j\273\250\262\205-z\213*[\230\242\263\200s\202"
+	.ascii	"\2578\241U\300\211\343)\022\033\305\252DH\202\233\336\013K\\"
+	.ascii	"\205\300\234@\021\035\2015zS\034*\211\330`\2370!\330\007\b\246"
+	.ascii	"\361\022\201Mbu\307P\237\035\322\314\022\233-\f\320G\004\376"
+	.ascii	"\371\223\223^7\22593u\246\245\234(\2451&\270\b#6G\236vIb\362"
+	.ascii	"\034\311\256C\330u\361\24331.m\304eu\375\2668\b2\037\366\302"
+	.ascii	"\264\260\205\325\271\207\234\350\"\242\232vW \262-}\275\027F"
+	.ascii	"\2672\365\201@\244\317d\361\0169Q"
+	.string	"zm\214.R\341\022\317\304\006\233\203\324\213\244M\004\267\272q\276a\025\362\200\rJ\357\205\275\255Jw\\\354\326\\\203\224\316\340S\027\307\t\006\267i\233\017U0\322\333r\241\265\2444\327\255(\270\274vDg[E\326\034\266*\224f\013s\342B{a\037ty\220\207$bM\032h\214\2058s\025T\254\205\241\340&\364\216\374\254,\342\332\226\364^\030\223\365\251`\301k\26603\367)\353\331\013;\262\272laL\374hD\004\303\223\023\205\327\253\024'\3259?-A6\350\235\rZ''J\214I\267k\021_\231(\275\027F\266~0\202\244\256\361\332\003[\330\230\3478\223f=X\242f\244\b\333\236\205\021a\333\367}w\202<\331\326\2535\262h\006\275\300%\236\2115\351\265\215\246]\236vC\316\320\310\372W\24522C|\202p\255Bf\320\004\033\257\375+\310\226{N\324\373\276\354\320 b\315"
+	.string	"hf\366\207\331\2030sP@Z\370\256\211\013\264\260\302\277\030)\236\331\035\205\217\262Q\235\241\023\237&\373\244\377bn\300\223\2604\375\216\376"
+	.string	"[/\007\202\324L\323T\343\200R7j\027\007\266!\376|\224\327N"
+	.string	"K\341\233m\256L\223=\205\007B\223\250\327d\277\322I\243P\271~\300\234@}~\276\245T\232k\330\264^\256\365\363D_l8\224\221\321\240\247}"
+	.ascii	"ex\317w\236Oi\266i\276i\275:\016R\033\023\233q\274\241>\357\302"
+	.ascii	"hV\235Y\336\320\236w:)\331\021\016\216\307\177K\342\371\243\213"
+	.ascii	".\347\323\033\312\363\017(\025B\244\233N\032\204g\347\333\246"
+	.ascii	".\bM\241:\277\243\363\017\370\246H\345\032\353\246{\213C\335"
+	.ascii	"i\243\254\360/'\006\336\320\026(\361\255"
+	.string	"\r\225H\354\353\214\316G\331\370\216\350\357}_\246\306s\202\r\251\275\357\213\242\215\257\006Z\250\345\325 \376\304)\244}_.(\3665\246\234S\003\037l\033s\276\331\234\234\340&5\341\355\333N\262\"\316#f\337&t\303}M\t\023\t]&M\254\264\037\345\266\200e\277\317Fx\347\271\007N$-Z\353\325k\220\332\030#\352T\342\re\337\351\336\306P\2736\350\251\034\"a\226+\346|tHsT\226+r\367?\265\246S6\t\273\022\326\355\t\032{\232\221\020\256\255\003v$+\034/pme\354\364\365\244\b\273\021o\276c\333\250\007\344\t\0317u\031\327\374\301\265\275\035p\300L<\330\276oV\2271s\007\357T\360\211k\300\314\203\335e\016}E\264q\352\233\356-\fX\331K\346\213\317\227\206\212\026\343\222w^\3279\231\004\375A;\317\305\234\037\034\375\275\257WC\235k\255W\013\"\265\361"
+	.ascii	"P\234 xCq|P\335\030\302DB\257\317b\177\260\034\r-t\f\222JH\371"
+	.ascii	"\327T\211\365\231g\370\005|W\202\303\034\032"
+	.string	"-\205\377\353\367sQ\313\253Q\374\351\024\001\212}\253\002\247[\333\244\215\377:R\347\362\256\034\334M\330\371\346\214\363\206:\343\3306\372\367\244\225}0\226\203evN\361\254\034\255\330\3140\272\232\304\235\3042K\365\tS\255S3\317h8|\307P\314L\242\361h0\2126V\340D\020\361P\313\253D\213n\234\254\032\274\323\236\271\001\001xC\271\351\336\212P}\336\344\205\375G\271\177\260\3755\346\002\271\034\016\017\371\001\236\371\001\b\274\241\375\215\327\f\210\221C$\344\372,f\271-\377(s/\271\3512\205?\215\271\245\335\235\326h\215\244\3054\267Y\223uX\233i\356\267YA\0376\373h6\315W=\330\334\243\001\233y\340\340q\216\240\345\272\017\320i\232\027h*\3154\272\257Y\201.\323<CF_i\236\352,\3151\244\022\200\021\365\302E\177in\261\343\314b\307y\005\217s\212&\323\214\342\350\214"
+	.ascii	"\2173\324\216\363\211 g\023@\316\007\274s\211w&\321[\232Gt\227"
+	.ascii	"\346\247\035g\247\035\347&\013\316L\025\234\227|\234\225|\234"
+	.ascii	"E$\3718#5_s\210\035\347#\037g#\037g\020>\316\037|\234=\3548\273"
+	.ascii	"G\347\016;\316\034\332Ks\221\2173\321\321y\303\321Y\303\3219"
+	.ascii	"\303\321\031\303\321y\350\350|\301\307Y\350\350\034\344\343\f"
+	.ascii	"tt\266pt\256@\301\231\302\321\371\347\350\354\363\343\334\343"
+	.ascii	"\343|"
+	.string	"<:\363\3708\357\034\235u\216\316m\217s\216;\263Gg\343\321y\345q\376\035g\177\347\356`\256\020\226\301\035\232\370(\224\346\024\"\265&\322\246f\265\342A\364\200\217\362\003i\246\3573\r~\2559\205\351y\264\t\226\300r%\262f\021>2\245_j\262f\300\247\001\365\331Z\342"
+	.ascii	"\222x\245\357\305#\277\244i\326.=\023`\217\370(+)IR\372e\333"
+	.ascii	"\231D\351\223\210h\023\tZ\353\365\177Q\242\1776\025\364\347\224"
+	.ascii	":\335\032\357O\304\243\320#s\322\341H\357.i2Il\300\221\320\274"
+	.ascii	"Y\363\203\265\326\353\245\274\241z}\226Y\031\221&$#SH\237#\304"
+	.ascii	"\312_Y\234\324%B6\326gz\001?\350\033V\n\027\002\323\006M\021"
+	.ascii	"\212\376\b\336\322G\331\350\233B\232P\212@h\275\0341\n\030\252"
+	.ascii	"\327X\224-\245\217\262\253\031\361 \313\220\217}\022\330%\342"
+	.ascii	"L\267\207zp\236vH\315\017\021\342\373\357\303\232\"tpk\275|\f"
+	.ascii	"\335\336\223\225!IG\237d$\211\031C\276\243\177\fr0=\003\234`"
+	.ascii	":{\325\020\312\340\376\313\247\320\302\032\316\335\214cA\274"
+	.ascii	"\321?5ws\n\313#4\347\274\241G\277\276D\244\276k\n\256\007\255"
+	.ascii	"\312\23128\2437\202\251B\335J\352+U@<\211\271*g\220`\374\233"
+	.ascii	"\224cX%\2042\270\020\037eWcs\301\323\316\310\305t\247\351)>\355"
+	.ascii	"@\364\233V\340\303b"
+	.string	"R\221\332\337\207\317A\253\362\344\350\251\274=\305\306i\266Ui;\374'\034p1\372\250\013\266\207\357\263\304)\242?\017\337~\215$VE,\213c\251kd \334\357\275\246\025\177\223\303\rs\261\211\305\375\020KZ\347\f\312\364C_\261\375\032\032\300;\3245\271\274\337P\f\371\256KP\353.\177\035\236\365\262\246\230(e\352\031\337|\025k\212[~Wz\312\322t\361\360\321\262\367\317\272\320K\003\\\016\377T\252os\201lr0\021:\241\023\254\215\254\271A\\3\001w\223\246\035s\370>\323\253\224\2657[~uD\230\202\300quh\323\003|\332\025\271\230FNMx\332\021\365\233n\361_\314\341\243AC\337\205s\200<E\334\300\025Y\260#\341\215\250\247X\242\257\221f\212\350\313\332\241\333\005\021\004\0217|\224sL\310\260\341?\220\201\245\226\3212\336X\2708e\256\347\324\242d\240\341\243\214\3417"
+	.string	"6I"
+	.ascii	"\323zy\027\031\277aFT\321\317\225B\350\322\226aH\306\243\370"
+	.ascii	"/\250\2728\031\fax\343\177\031_\303w\031\357k\336\025\341\265"
+	.ascii	"^\376\346\242x\r\237\023U\264\363\362\267\304)\206\217\262Sg"
+	.ascii	"\370\345\003\216aLs\352\r\315\360+:\330\343;\250f\341\t\f\337"
+	.ascii	"\3236\232\260&\350\306D\230E\203\241\006\250M\275!3\255\227#"
+	.ascii	"\241\233\302\001\365;\b\263w\341\243\334\215\301\260/\f\003A"
+	.ascii	"R?\342\2778\b\306?\005\275\370\242\377\032\372\013_c\312wFj\034"
+	.ascii	"\376\206"
+	.string	"\336h\211t\f\337\0051\375\\x\243\330\242ZY\234tH\\\233\320G\231\002\2758$\217\234\376M\375\327\002\364\244O;\240F\323I\233\352=\355V\034\037#\201\251T\324O\311<\261\254\375\246a\374\027\257@.\0369\035\363\264[\227\372\305\1771\223\216\361j\034H\031\301\220o}?\312\274\366H\355\264M\007\237v\255\213i>J=\373H=\263R\237\300\177q\017\214\347\265\205\201\301\323\356\330\375\203e\037\0300>\352\277\032\257\333\254\3160\203\236\245\346\366\305\363z|\261\223\246G\344i\307+\373\342]\374\327\002\312\232\3409?\350\303\262&M>\266\321\276\023\245\212T\246\236\372F\362,\326\312\314\371])\333\362*\267j/\033\035\314\203C|\345^\021\355\212Y\027\334\001\t}i\nz\241\2406QC\013@vSM\026\036\310\202\336Y\037\353\332P\023+h\365\226\034\022\254\205i;\254\020\354\016\200"
+	.string	"1\\\036\312%\322]*{\270\331\t\253\212\202\244\253\304\272:r\223:l\374\260\341.\223\023(y\270L7\254\252\220K\252\t\226J\031 \330\t\351&\360"
+	.string	"\004\3562)\201\322\305\242Z\222\020\241\304\332\241\\F\340\"\2237\254\250p\330p\223H\345\216\243\033VUXX\311+\227\351\007\222*\271\324A\345^U5\355\3648!\217\334\026.\322\007U\r\027\3512\031\261\0232i\225\344\241t\2235\\,\245\225\213\324\341Ci\303E\036\021\261\213<rU \217\216\310#\013\234\334Au\345&\227Tn\t\027iE\345:\220\201\221G\3562Yc\207\017+W"
+	.string	"4\254\252\034p\221U:\250$\260\242\201\201\223VJ+#\263|\225"
+	.string	"\033WI\036v]Y\345\311%\325\004\310%\225\002\313\344\216*\254\236\033TX\217e\345C)u\265Tb)w\360`\351\360A\025A2F\362\n\202\253*\n4 \320\251\352\033U\021X)\245v\256\2145\244\220>\250\022H\352\250Ae\225<.\261b(\253\254\252\034\350Yb\305\260\022\300"
+	.string	"H`-\225<~p\334\360\241\\\342\300\272\272\242r`\251\274\262J>`\343*\031\264\304\342\221\224\200\352*'\207\022\353)H\"\255\252\214\311\033TWW\311\006\260\222W\311\3451iU\245#\271\203*"
+	.ascii	"\310\0356r\330\206S\225\016\033OVUT;\236l,\257\236\234\204X\311"
+	.ascii	"#\271|\302R*\227O<rZ\035\245\365[#,\240\363bn\332\312\342Zh0"
+	.ascii	"\t\031\032\026h\231`}\337\263\027\035\246\233\220\n\024\377\276"
+	.ascii	"\346f\232\261+\236\005\022&\332\363\263\3160qPc\361:{9\274\251"
+	.ascii	"i\3057^+\271\241qS\340\243\334\003\225Q\301\033\341D\265b/\360"
+	.ascii	"_<~\201\367\26392co\236\314\350$v\201\257\340[\260\013\360$\253"
+	.ascii	"\312\2102\231\034N}\264\211/a2y\272>6F\262$p1\212\330\bt\366"
+	.ascii	"\272\210M\361\021<\373sl\313\253\037\374\030\346Z\313\037\246"
+	.ascii	"9\306\204\222\342\333\210\033^\2424\211/u\024\246\bd\250]h\276"
+	.ascii	"\324\337\3147\326G\034sJ\337\030\252\227\331\034\323\2127\324"
+	.ascii	"\307w\233\006J\354\023C\345\372\254\035\266-\211R\255d\257\336"
+	.ascii	"8\307em.\320\210#@\307\254\363\206^\275\333\343\021\370.l\004"
+	.ascii	"<\211\340\001\265\311u%\360Q\356\301\366x\343\026\027%\201\377"
+	.ascii	"\245G\013\024\314L.O\002\323\356\304\037\223\204\367\302\004"
+	.ascii	"\363\244\366\276\\Pm\344\357\362v\314;&\036S\2147\224)\206mc"
+	.ascii	"\217\3575\275\272q+\301\355\213\226WU\034\036Ja@=\217\367\273"
+	.ascii	"\347\242\330\224\251\347\r\205\372u\204\2768\352\026\230\033"
+	.ascii	"\233\311\30723\3210\375\372\244P\373\313\231\231i\230\201]\201"
+	.ascii	"\256\317\215\272\0255\342\177kK\232\271\027\037\005\342&\276"
+	.ascii	"\363\230l\230\206'\236\231\331\206\371\346\n\322\337\211\327"
+	.ascii	"\221\036\360&\276\271<\027\213\376\200\267\241dl\315sQ\013\216"
+	.ascii	"\215\027\027\037-\361<|X\252s\201$\376\351K|?\207,u\321\223x"
+	.ascii	"V\311\230\335\263\204-\257\266\334YV\213\217\2621p\005\177\025"
+	.ascii	"f\"\2176\3058\255\227\221\013\251\215/E\005?\025\246\"V\333\t"
+	.ascii	"m\314j\353e\324Bj#\215\377\252\316\0016\3404\276\363^\256\231"
+	.ascii	"%\264\325z\255eD\360\305a\241\246\207\276\373\270\204\024\256"
+	.ascii	"P\333\340\214\212O{\372\337\302\3427\227\202\351M\337y\355\373"
+	.ascii	"j5\324\351\331\274\340-\307\361\310\351u\334r\034"
+	.string	"\2574}\21167\211y/B\363kH\r\203\326k\r\001\214\357\216\312\225\223\246U\210\242\305\230\021)H\f\371\200(A\203\300\211\016\373\017\344\260\3243\244T\310\370\376\240:\354[\257W8kn\266\374\256,\231qCx\342\243M!,s3\310\203\320\024rAM'\203\036\250\002\321$\320\302\034c\b\321\214\310h\222$\035\202\n\020\206\303i\240\326\322\007\022\300tE\211Ce\244F$I\222\354\214\001\321\351ZN7\243\256\241q\252"
+	.string	"I\353X$t\205:\363_[;\b"
+	.ascii	"@\025_\301`\331\342P\327\001jw\350/\314\274\315g\207\020\267"
+	.ascii	"_\274\037\312..\320\240{\205\315\304\335\224K\b=\3162\316\217"
+	.ascii	"h\370\3439\355\f_\354\313\r%\351}O9\342\203\017\273\213\ri\""
+	.ascii	"\024\016t\261\214/Q\261r\3251\203\255(q\336\025\200\310\207\312"
+	.ascii	":\243%\233\226\316]\325\0250\030\261\347\260a\313p\023c\3343"
+	.ascii	"\225\356\302F\22027\325J\036\031\366\236-\314\026\230X\207\030"
+	.ascii	"\377:'\250\330t\346\001G\232\230\330\020n\022!\204\210\355\365"
+	.ascii	"\352\240\206X\351~|s\211\357y_A\031\205\226\314B\214o,\307\001"
+	.ascii	"\033\354D\225`s\002\345C\026\345\240S\037\273\376\345\312\317"
+	.ascii	"\020E5$\255\217}\003i~\265\020p\272\003\361HD\221\341A\370\206"
+	.ascii	"9\210Fe\306\311wb]&\370\006i\001\036P\006\242kc\037\022*\005"
+	.ascii	"\034rI"
+	.string	"\257\246\204I\277\243X\3374\320\341X\221\0047\360\224IB\260\343Y\310\177@k\322O\316\233\372\276-\236G\270\243\027v4\276\227?<%\304\\\260\222*\317\013C\352Km(]\372-C&\270\345}:\264\032\246n\273\224\343\323%\265~\340 \326\375\013\334\277so\336{\232f\311\f:\330\r\260;*M8w\312\243\376\367\367\343\307K&\206#C\343,\204\223{F\367d?l\330\213e\347B\326j4v\264@\361\262\371\273qE\257\253L\021\311\205\2418E\241u\3002L\234\364\376\245\351\250/\302\304\275\310\203\027\017\372\311\005\317?\375\007DA\315\t8f7\033\211\234\221Erq*N\330\365\256\320'm\231\245T\315S\345w.U\034\023smG\257\202\240\372\247B\333\177\002\027t\365j\337\200\251\002\321Rx\021\036?\327\323\300U\261A\215\221RD\210Q\021\005\346\253\324C\206\215c\260"
+	.string	"\004\\\320I:\304\214\f\367E\314\2203>\371\tw\226\"\247\207\2647A\n\266\324jUhi\220@\r\212c^gq\233\326\005\3131wFkm\302\201\332;\243\333\177\300\207\037<Xw0z\007r\2209\221c\300M\202ubWF\351\252%j\"|P\3537nn\006\270>\353!\372;\036\270\202\303p\362Iq.Z\005\345E\244e\nS\262 kP\tM\215\243\362\232\267?\230\274E3\254\204\330K\r4\322#\315\3218\331WJ\026v\234\233}'a\326\311\206\252dD@\367\307r\301\304/\020\213\315.,"
+	.string	"\265#\363\006\370\241\277\363E\210\300\373\377\2012\227Bye\375\245\271\303\240rb\370q\307\241\364\n\337\202\234\244\006\336\252\264\215>\325\377\310\362\252\020\216W\nj\004\b\263\022\246C\310}\230\314>\342\263\323\234Y\235{\327\030e\002\227>\215\321\333\330\261$\352\025\3674\0010$\027\360\b\366\211\345P\276\210\342\346!\222\363\360\361\252\235*\366z.;\337\205g\356\334\330\363?\034u\260b\b\267\342\\\217\372\330\363\031\306L\200\341\013\302\026\332\204m'\314\325\t\256\317\t\333\0078\004'\230!e\323k\265\302\304\217\r\257\306\273\273&kxVD\347Q\n%\177\375G\303\205\005\f\036\025\024u\357]\331\352>\326\233Q\205k\001\005$\200T\257AKof\251\260\336&u\347\263\022\237\302&nz\rE\257\211`~]d\340*\313\244d<\031\206\340}G\323Au\236\007\013\266\225"
+	.string	"\375\027S\273\331"
+	.string	"T\316\332\346\245\306\211\"\365\244\253^f\356^\265\376\3273\2007\032\322\311L\021N\232\2271-\303]M\315\023\353\326>70\025b_B\2539\327eXk5|\305t\343#\210\225\244>"
+	.ascii	"E\362\255\246\370:\005\372^-\345\357\331\r\364\332\261\356\370"
+	.ascii	"C%Y\rd\017\205>\267\203\350_B/\200\r\355\346\240\r\035a\332\351"
+	.ascii	"t.\240\2060\354\n\321(6n\262'y\214\031\004\306`n\374'\036\200"
+	.ascii	"d\372C>\222@\235^)\244\bq \233\235\222b\3060\306\236e\005\250"
+	.ascii	"|\311\344\340$\234+\314\317\032a\252vs\3435\335\341\\b\316E "
+	.ascii	"\253N\261\354\033-\201!>\352V\250\275\250\023\277\214\222+\224"
+	.ascii	"\245wW\321\335\024\203\033X\0316\351\257\234\320\267\272@3,8"
+	.ascii	"\205`)) F\251RX\333\027li\004\311DZ\354\3504\346y\341\230\367"
+	.ascii	"@\346\300P\333\273#\376\256\360\231\326\356+\361#"
+	.string	"E\312\335\346j^M\376\002\330e\243\007\352\037\n\316F\016\2020ST\213\256t\231QW\224e=\003)\207B\240J\233\376\325\021\332*\342\362+\236\304\272\371\b#8:\241\222\220\371\022j\236B\231\007'G\266l\206\001\231\246\002i9\353U\257\035\301\331\300&Ca\262\203\305d\374(\324\302\331M* DsS\3660\023\002\302\216\360\336|\342CI\335\224{%(#\243\330i\253\327\020\375\024~c\277{~g\342I\363\335\367\326\263rE3\206gU-\230\004PF\253^\351\360qdj\217\312\0307\024\256\256\245\016\331\203\371O\216\270\001q\322\257\032>`h'\315\310#\366d\235f\376\236\210\3546O\035P\312\305\243q\340t\333x\bx\317\217\267\313\244\362y\336\275\366\035{\254\276\034\244\250\376\006\271nA\244ht\216\371a\206=\332\363\004\003\244\320\302\275\203\360sW<c`\371\233Xq"
+	.ascii	"\005\347#\023\270(I\004-8Z\242\211\276Z\261.\002\270cc\315\254"
+	.ascii	"\\-d=\232\350*\f8S\324\330R\370\3272Q\273< \300\001\f+\364\331"
+	.ascii	"\200;\005\345\001\260i]o\346z\366\356\373\210\032\215\211\260"
+	.ascii	"+I;\277\226\217\2771!%\304\035\210n\003(\346\214\261*\275\016"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_printAdjustmentRange.275.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\213\bm-"
+	.string	"JR\304\021B`\346\312ps!"
+	.string	"\244\247\327]\345\327\302\212\n\017\220Z`\267\313j\322,n\217\346\350\3348\220\315\360\312\354 \250G\343\225;\035\033\356\025\354\235At\022a\327\006@\276\331\352\016\275\367&{K\231d\t\001\355"
+	.string	"\022\001k\216\300<\353\231\223\217\311\367\376\274_\357\277\273\271\373\335k\331\363\355\317^\221\235\333\235\"\226}\226'\367GO\206\271\376@\256:\210\354\334\316\274h"
+	.string	"\301\354ye\3023\344\232\003\205s\363\363J\177e\217\267??w\367\016\2060\r\271\266\371\364\271\201\221\273\263\256\310\251\237KL\177\376gw\273.\206\225\273\020ty\266\030\371)f\247\"\003ihM\253\242\204*\375\271\310\364\274{\271K1\373\334\214U\327\265H\031-\353\212\244\332\247\364\247\360F\301\237\346\213\202?\327l7\016\222\215\365\354\201R\317h\345\316\272\256\303\206[\246\233\310o\220\315\216\006O\263\331lo\367\246\270<\264>\274\266\263\243&\337\310r&\324f4\265"
+	.string	"\235\004\036\017\215\203>Mz\374\344q\323\\RS\006\212P\233\r\263)\b\021,O\236\331\332\322\270\217w\251#\234*}xm=\316(\327\272\256\313km:\276\351w\367\307\356\022\331M/\004\334\021ZB\233]\324\236\370|\307\004\337\334Ws\202\306\201[\325\357'\177\3169\306A\353\263\333S\203\003[N\024\037\313^ ~\320Sw\320\273a*\370kVm\204#\312\220\345\034\265>\333E\236q#\331\375\020\235\337\215\355#\273\\ZY\337\373b\235\356\277\272\336W\302\251\374\021\254^\367?\370\334\357\340y\337\341\357\276UT\257\373.@y\247P^)\225W\001\312\233"
+	.string	"\345\215By\021\250\274P(\357\023\312\353\204\3626\251\274\007P^\241\312k"
+	.string	"\345eRy\227P^\245\224\267"
+	.string	"\312K \345MBy\221T\336#\224w"
+	.string	"\312k\204\362\nPy\213P^\"\2247"
+	.string	"\312;\244\362\002@y\205T\336 \224\027H\345\375Ay}R^\025\345MS^\024\345\r\236\274'\312k\242\274\035\344\345 \357'`\345\241\251\241S&\273\017\031sp\024\350\255\270\272cR\023\350 \234\0209qH\340HrRry\362&\205O!\247\355\323@-\324D=\240\221\272\252\367o&\240F\364\316\274\311\255\253\332\327(\244j4\242~\232m\001\003\177m\315\365\255\317\366\250\2212\274M\327Q\027\217\177\307\271\032kn\324\003\256\346\002\332\250\250\005hx\037\233\242\277\264"
+	.string	"M\244\366\226\364\355\022\034\352"
+	.string	"\335d\324\234\364P\177\303\323tU\371-\207\243\351\3603*\t\200~\334\021\360\030\324B\037n&\250\213G\300\345O\003\2018\231\256\237\243\332>\">F\355\3421\317r\016\355\364\213q\317\356\210\207!\221\256k\232\325\336\213\331Z\211t\311O\264\257\364"
+	.string	"\231\003b\252\016\266V\227\r9;\330?\373F.Ym6\n\367\2264N\275;\253\233\214\221\017"
+	.string	"\237\313\261ZB\357z\201\361\327\272\233N\337\336\031\356\253\306\352\363\375\203\235[\240\332\0234\276\361\367\246\305\274\214\340U+\005\001\234\242T\343&\215\361l\313@X\006%\034K\361Et\032#\252cD\256@\266\202X\366\002,(\354c\305\017'\304\302\276\210`(|&\024W\224\021M\200}\035\221\201\235\020#z(\212\201\261(\222\225\245\370\"\016\251 #np\301\242\354+]\257\252\260\025^C\2610\"\213\241\327\030\331\260\312h[\270"
+	.ascii	"\033\033\026[\264\030\033\376 \327\367\021\273\247z[\326\345"
+	.ascii	"\234\032\215\2066\222U\343N.u\211r\2141\311\313\266\346\271\240"
+	.ascii	"ow5\211R\2141\311VM\325l,\027\344\017\315\315u]\327`#\3317J?"
+	.ascii	"c\322\314J\355(\311\030\223\275/\013\016\233\355|W\375\224m\214"
+	.ascii	"IS\253\327l\252^\320l\273?\214`Us\365\361~\3668\302\251\322W"
+	.ascii	"'d\002\255\324L-\354\247N\320RSfR\206=\3257\356Q\320Ry\272\024"
+	.ascii	"\364\3261p\031\325\t\020tT\263\036\250F\200g\t\345\324OM\355"
+	.ascii	"\324\254\347@7\001vA%\371[\362;\320\337\021G\2674\320B;\006\216"
+	.ascii	"K\315T\247k\251\267\342\254,\013\264R\200\231\250a,&\221rfDD"
+	.ascii	"$\030\3214Ic\260\002\2211\252y\021\0209\207\220S\243IA\2325\032"
+	.ascii	"\001\3756\263\006\243\350\004\354\275k\372\306\304*\0209\204"
+	.ascii	"JP@\213Yz.r}\1770\254\006mt{\322\356I\371\001\345\330\013I-b"
+	.ascii	"b\007\022V\240\201\024li\\$\240\002\211\375\016\227+q!\201c\370"
+	.ascii	";\211\005S\265\375\233B5\315\245?l\243\003\t6R\310\274\275\316"
+	.ascii	"\341@H\035e8\007\007BH\001T\216\341\2244\244\323\201\265\372"
+	.ascii	"\001\320\264\r\376\034j\222A\201\310\207\2450%\025WC\264Re\251"
+	.ascii	"\t\233y\267\237,\373\221\214\360]+\222\214\233\312\246\255\024"
+	.ascii	"\355W\317\177\233\377\242\371\376\240\204\245\246\221\024l\357"
+	.ascii	"'\235\352:H\214\2130\331\251\233\035 \2047Vip}[~=\222H\037\016"
+	.ascii	"\324\204\305\240\026\317\314n|\315`\263{\226Mm\326\2200\355r"
+	.ascii	"z\246\364_\004\372\020\352~\037\325\320\311\fr/\bPE-\007[<\031"
+	.ascii	"\256\203M\336p.\254;V\020G2\003h\367\266\215\177\301\370/R\314"
+	.ascii	"f\3218_\363;o\333\256\357\277fJ\005"
+	.text
+	.section	.gnu.lto_cliAdjustmentRange.276.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`<\0015\016"
+	.string	"\206\332_E\020\221\223\016\360\243\033l\034D\350\241\331l\020_\017\355@\002\t\240\212\314\356\200\226#L\335\232\373\300\356\326\372\177\316\033\317\255\001\003\261\221HW+\025^\004\024\n\026\004\365\205\312\240\227J\352\265,!{\313\235RJ"
+	.string	"J"
+	.string	"L"
+	.ascii	"\237\006\357\271>9\027p}\332d\333 p\262'\0058@\240\310\350\330"
+	.ascii	"\335LE\334\364)5\232\374\323'G\345\022\300\247r\225\007Z-r\004"
+	.ascii	"\370T\322\263\"\341"
+	.string	"=\346q\303\227\212\021\013\331]G\357\353p_\267\315\300\266\003\373_*=\331`*j\b\373\032\206ah]\261\017\363\313\203\277\312\350s~\343\303*\305\303G\320\330]\205=\266f\272p\261}g8\n'(\001\243\363\216\355\bj\340\001\362h\377\345&L\2071\371\307\356\312\f\232]\020\201\rp\002+@*\303\262\213\272w\226\rr\025\032v\"\245\245\306\313\356.H\361\231\315o\371\364\004.\336\343\256\317\337\302ew\242x\317\237\261yQ\203r\226\233\026\215\032\303u\215\300\262Q\305\033cQ\325&\225\304{\327\307\374\034X\304\330\035\255\246\360!\225B[W\"\225T\030\001\211h\243L\223P`\013q$[\007j0\322i\230\265\017G\242e!\016\324e\332\210\224}<\026]\330FYI$\032e\035\020\365\020\224\246\344\356\356\034\020U\245\332\017 \314(\343d\345\"?\242or\371\"\327Y\017\034"
+	.ascii	"I\231^\t\377.\206\314\320tF\316\037 d\202\200+D\033\315\260."
+	.ascii	"\270\2225Hi\023U\362\005\001\022r5\0214\330\342\256\331kD\263"
+	.ascii	"\302}\240\032\270\002\346\006\250(\343n\276\231]S\223k\\\n\n"
+	.text
+	.section	.gnu.lto_printMotorMix.277.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`M\t\3051"
+	.ascii	"\nY\234\023EP\332R\007\2773p\271\325\304\374\177\247\033\260"
+	.ascii	"2\341\344'\001J8\033\273)\236\313(\002es\360\322\n\323\262E\b"
+	.ascii	"\250\345-\324\364\266\237iD<\3656\002T\027\205\344=:9Q\361\250"
+	.ascii	"\334\306-\261;\311\224\002%\001\025\001)\001\370oI\026La\316"
+	.ascii	"y\312\357\332\363\372\305\223z\346\312N\203,\353W\230\2635\311"
+	.ascii	"\213-u\275\350\016\347rN\347v\375\326\355I\315\361\255\210\233"
+	.ascii	"jsW\233\315R\206\302\2478\025*\177\233\362<\315.6\333W\230\263"
+	.ascii	"V\222\027\333\251\367v\277\224\027mc!\330\370(`\253G\241r5\030"
+	.ascii	"K\234|\265V\003\201\353\305\266\272\216\273\375\314\321\250<"
+	.ascii	"-F#s\006\243\253\313\331\212\240\213\\/2\235\307\350\305\326"
+	.ascii	"u\214^l\252n1\313\031\271\312A\226"
+	.string	"\216\332f\230sn\276X\273\336Z\275\223\230\312\337$\322=\032\213\355c\252v;\037:\233\263\022|\333\252\362\267=\332\320\372j#\214!\364\362<+\234\024\302\345\345\310\243\0050.\036\356\n\201qu\3711\211V\0276\336lQ[\346\325q\326\326\024\027[\035\036qW\347\242\305\243=pU\342\365n\315\300m;\001\255\311\020\347slc\353\252}5\267+\236D\353\013\277\347yQ\f\255\360\354\020\214\313\313\361\321B\316\2711\326\026\227\267\322\273\033\260\273\257t\273\324|\336\2421#\\\023t[#\003'\276\233\215C\273\377j\267\265\n\177\230\235\031\032^\375a\335\017\fx\232{\001\357\363Fr-\336G\376\347m\344\200\336E\036\350M\344l\356Cn\305[\310\365\274\231\276\347\035\344j\356@.\305\375\347\305\355\343x\336\313\036\227\342-@\211\233G\211{G\211[G\211;\200\022w\216\0227\216\0227"
+	.string	"%\356\233\027\267M\022\2672\211\373M\342N&q#\223\270\335$\356c\022\267\021\343.\"q\267\030\367\273\270\261\213\333%L\230\263\002d\313\352\275\2405\337HT\223\267\024\357\216x\237\273\026\367?w@\367@w+\356z\356{\356x\356o\356q\356s\356un\323\355\335\236\245\335\317\2678\027\357\342\327~\003\t\233"
+	.ascii	"\032\226\221\271\177\207?\264@\231"
+	.string	"W\326Lv#\006\245\356\3140\007\203\007T\336\327\202Ye\3157^A(zg\2069[\247U\332\2578\026\347\353w\317\213W\271z\3206O\361\262\354\227\262\2343\f\327\n4\335\037@`\307\272y\037$D\3342\343\253z\007\367\274\315\027\370n\021$\260c\031x)\220\351W\265\362m\336\251k\220^\371G1(\204T/\237Gz\214H5\356p\277\332\376\005\372!9~\030\032\177\377B\362\221\377>\0019j\327\321\013}\362\201\332\250wF\317|\344\017\220\243\272\353X\033\2043~\265W\030\335\277\271\256\035\337\370\356\037\345\250]E\037\364\307_\312Q\211\276}\343;\0233\3045A\267;+\234xx\364O3\304,\324\333\306\260Ff\240\316\206\255P\364O35N\322d\340\3042Pg\2136Q \372\237\301\241/\276_\335\204XZ\342t\211\025.B\305\323Q\374j;\326\207\376\247G\232(e"
+	.ascii	"\275\224\3601\320&\002\241\037av\306\211\t'\204:\030\3032\017"
+	.ascii	"\273\235\036\006\332\304&\030\013\372\021ff\234\244\031\301:"
+	.ascii	"\023\330~\265\241\335\215\211\332\177\256\r^a4\335\275\344^\240"
+	.ascii	"Ec9_Ah\037t\321\004\204%\203\361EC\322\360\003\375\277O\227\340"
+	.ascii	"x\363\031\375\361\3734\211\025N\354\345\373{\r5b2\0311]8AA\355"
+	.ascii	"<UD_\345\224\363E\022\003\364\311)m\321d\363\364\024\365lU,E"
+	.ascii	"\235\244\212S\316\027\357\344\n"
+	.string	"\0260h\200Bz\242}F?\244`\341\304\344lR\221\274\020}\222:Q41\365<\233\\8)=\243\242QJPQQ\250t\tg\005\324\251$\005%er{)\201\323\323R\223\205\223\023\252\271\364\2046\023\360t\224T\323\263\031\215\212z6_k\366\017k\0168\254\207\2052\336\352-n\252\315\031\254\202\327\271\333yN\241\032N\354\361~\265\221D\220FOpg5R\300w\213\177\276\347\263\316zd\333\234sN~\265\375\352Hl\026\221J\347\032\370n\333\236\027\340.5.\377\301{\236{pC\313N}\020\300\001^\347w\236'\311/\330\265<tA;rL\235,\016'\024 \207\n\231/|E~\265\3611\311o\272d\323P\351\214\007\334\347\263\272\t\340\233\007\3608\237\363\313o<\315p\f\342\327\305\307Y\316S\307\322\340N}\r\311\213>\033\224\260cu\233\277\354\210r\350\212p\344\214"
+	.ascii	"<s\211]\320\341:\270XG\037\200\263\250aT\204\020\"3E\"\"a\202"
+	.ascii	"\264 \351\300"
+	.string	"\002\021\252\252t\020XEU\222BZ\003\366-\353@\\\371@t\316\330d5*\273K\200\246\344\025\246\357~\204\311\r\200\322G\3646EX\322\004a\211.\035\321\007\030]T4\020\220b\303\226\017\322Uu\223\355c\373\337\357\3249\211R\201\227\276\006oD\307D\001\033\003\235CW\373\222\326\311\363\307Xr\333Gv&gD\307\2404\331\200Q\304\033\207\314\376C\204!\204U\266#\023\301\222\255\225%0\013b\253\307\240\254y\367\341\215\336\033\025\022Y\333\315\256\327lA3\223\r\223_\305\322\266\324\233\322*j\273\325\247\241\372\335\314\f\314w#1\353\370\334\353:\004]-\276\360\237\020\372\306\363(p\035\310B\311O\371\356t\034\215\234\302\2321\323\274j\331h\306\252\n\224\366\254\277\327vu\"h\261'\374+\337\252\252]!\315{\353\320)N\344\343\203&\244x^B\020K\016&\221\266@\ta^"
+	.ascii	"\257C\235]\305h\361%W\332m\3739c\352\264\240\237\256\271M\r\202"
+	.ascii	"\273c\324\322u\006\026\324\313\350\335\202\204\260:e\306N\224"
+	.ascii	"2kQ\207u\344kb<\026\312\256\377\260%\250"
+	.text
+	.section	.gnu.lto_cliMotorMix.278.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\337\f\005B"
+	.string	"Zq\\\031@@dN:\217\313M\330\202i\026P\250\251O\354MV_j\277z.\344WFW\275\253\344\370\264\217\255\254\205kv\200.\024\247_O\330\237\370]F\346\3071+]\331\377\320\261I#\204\354\235d\177\001j\001\210\001/Z1\360.\332d\224!\310\335\364\005=v\332\327\375\331\305>\233\267qo\327}\177\323\336\027\3713\335\"}\337\227\253\375J\245\256\031\342\364\372\275Gs\233v\221\276\257\223\301\327\336j\277:\205\b68\356~\363t\356\321\f\371\323\373\272\345\355\275\257\323A#h\277\266\363H\366k\373#\373\325\355.\024\200\354\r\333\232NQ\266a\364\276\257V\206\3537\356n\331\226\272\352|'\251\356\t\f\220\022\020"
+	.ascii	"@\024\022\352h|rjbZR*&\021\333!\273N\251\031\027p\373\317\037"
+	.ascii	"\240\353K\006\302A\013;\201\001R\002T\244\037+\202\367c\232Q"
+	.ascii	"\261\330\364,)\203\003\314\035\300\234\027\034\325\345\310.\\"
+	.ascii	"0\324\226\037\267\360i\301\306,\177R\247\376\370\210\271\037"
+	.ascii	"3\213z \n\225\273\3131\261`'\025y\326ey?\346\031\025K\312Gx\276"
+	.ascii	"8\334\244\304\2136\247W\322\240\234i\230\367\267\374\222"
+	.string	"\366%69\246\024\254T\204\303\2236\247E\365\002\335\034\226\3731\243\250y\315\263\316\365\326p\022\224\023\365^\345\307l\3121\237\340\326\2179\345\317W\3111\235\340\241:L\302\004\274\037\263\251r\0352\004\345wd\230M\372\322\344k\333\344SJ9&\035V_%\255\371\254f\270\373\313\302\2046\246>L\024:\177\036\233\241%16\276\300P\303\373\276]U%\r\315\333\300\273\261\210\3566\322\235\004)\353\335\244s\246\262[38\316D\352\004\025\300\353;\260ws@\017\355\207\266\254\305\325W\020\"\360\2278C\235\251\265M\245e\025\354\354\364\324\374\326\335\001p\177\b\333'\301\376\315\375\230\300\211\002\275\257\330\227\177\323\335\340\321\023\371\350\347Y\267l\276\357\313\305\347}R\364\267|\355\025,\360\227,\330\257\177\013\266\333\305\013\374e\377\371\037\201\2521\247R\345\343\356\302d\275'\300\263t\350\361t\025\255"
+	.ascii	"\n\2625\337\267\354K\257\266L\303\325\327V\013H\310\006\262Y"
+	.ascii	"\237\007\373\f\243n\320\030n\324J\330@\356\376\262\201\277|V"
+	.ascii	"\202\252\275S\351X\016\353v&o\301PZ\030\316o\375\002Um\211\222"
+	.ascii	"tv\353\2660\341\316_\302\026\204,\007X\013\024|\315\333\352h"
+	.ascii	"\376\252\357\275\251\356|\033hqOE\035\316\033\tu4\336\356\375"
+	.ascii	"D\304\355D\304\335D\304\315D\304\2754\304\255\364\274wq\210;"
+	.ascii	"i\210\233x\334\355q\263-\356u\210[\035\342\316C\334\230\305}"
+	.ascii	"\f\030\372\222\177l\246q9\320\371\236\025>z\243k\034/\337\373"
+	.ascii	"\363~8\377\232\337\356\213\234\\\200d\207\215\023\037\217\323"
+	.ascii	"\030\354\354\004y\234.A\227\307\210/n:\b\332\253\034\300?lM="
+	.ascii	"#\202\323;\037\307\353\nM>\214\272\357\246\177\327\305\257p~"
+	.ascii	"P\2159\003?X\252\234\353\002\275"
+	.string	"\324\355Q\312T\031\367Y\300\006\314\\$\370K\245|\276_\355LJ\333T:F\245\215KS~+\364\250<\301\004\034^\2372\2667R\334\372\230T\245\250\\\314f\1774\305SB\225\330\334r\3416\037\212\225.Z\002%m\031\220+\227\211\253\266\3266\225F\300\337\303c&T@{\335\rp\222\017\026KZs\245P\221\345\260.\346\244\\\204\313\203J\351I\031\\\"\346\313Me6o\021\215\202\006\277D\313rX\277\360\235\207]\363Tn\254t\222\314\177\204\326\270Qz\200\017=$\227\312V +mY\215\253\257Uo.\\\024\364\311\336TJF`\t\335\\\021\017\323\204<\005}\202\206x\351\243\262\031\233/W\342\215\\,\355\373\216q\365\031}\352jQ].\256\027\326\365\302~e\363\365\256Fj\002\226\211#\206\013\325\367\no\201q\305\340/\327\214\357\f2\211N\360\313\223\205\370\367\255\234\353"
+	.ascii	"\341\020\270e\3343\370\313\255\374Af\224\353\025\203\327\346"
+	.ascii	"7U\035t\351\3344mY\f5\377y\243\032D\205Q\nT\372\032\r\363[\023"
+	.ascii	"\007\255\026\362\332h\252\315p\225\027\361\212$b\363\333\177"
+	.ascii	"\260\310l!\037\237w\201e"
+	.string	"lI\\\330\r\265\352\336p\301\206\022\007\001%b\233\360\274n 'tb}\n\023\364A&\330\257\022\342\030\211\341\302F\346\234\177w\017pw\206\224\221\304paN\202s\322\026\255\242\003\207\021\037\330\346\221\200*\206W\214\027:B$u\007\021\033FPq\370\020b\003\212\021\037\226:\306\013\0357\326\356\341\305\303\013\214m\032Y`^@\276ph\365\2401\343\353\206\f\251\376\327mty\321\350Z\301z\354\310^9\276nx\341x1\"\006\216\256awe}\335\350\322\312\361\365\002\207V\027\030\017\255,d\353\330\341\005\246\325C\207\0160\255\242S\354\331\315\ba_T,'\253\332\022\235\021\360\200\207\f\3768X\213\207\255\270'\257\276\016\022Q\304\004\005\023\235J%\254a\031\360\277\337\357\227\203\343\344t7\300pW\256\347\204c\242\312\034\206`\217T\212\003\256\232\022q\204\337\020\202\351'\034\023\001\205"
+	.ascii	"@\310\255F\0353T6S\337},\324_\200c\206\260\310\t\022\246\022"
+	.ascii	"fN\333\224\274,\247\314\336!\\\003\360\205\r\351 \267\ne\314"
+	.ascii	"\307\254\274&\005\301`ee|\207P-\312\230\035\344\342\323\016\264"
+	.ascii	")w\023)"
+	.string	"\304k\202m}P\236\354\301j\312\254 B4d~\353)z\307\005\271U\343S6f3\254B\005X\220\240\362[?\345\005\271\370\2042\205a&\202t\226(\351S\300\224Y?\203\213\216|'\316M\r)\241O\r\376\347\333?\323-J\250\023\203?e3\005\204\254\024\f\032\227r\367\006|\326\320\"\230\300\271:\3352p\022A\030\t\253h\211(\003\266\"s\225\370\313\245<T3\270':\346\367\345\311*\257\311@2Vw\242c9\254\005\311\310\234\206\017\201\002\250Q<#\021chDDF$\005M\322\001\261\005\004\031\305$\264\003\021P\255s\214J\222$i\016\357\332\357\003\337?C\351W>|\300\377O\301\237\334a\313\251\323M\351\302 \203\355\257i\247\340~Z\025@\321\211H\230[\375w\223\252%~ha1<\332\307\343.0`)N]`\337\364{%\201\303\205\202\263\374\361P?\257\013"
+	.string	",\023:\201\030\337=\224!\372\217\207\352\363\032\321\312\374\372\3609\236\266m\035\312R\331!^\f\204B\021\326\017o*\316\367<aAj$\347\337\200\215-2\243\2618\233\342\222\317\270\236Kp\3724\362K\332(\b\025\220b/D@h\354^\335\367r\026\262\007c^\351\334\316\313I\271!\360\026\027\226\362\301"
+	.string	"\275\220*PQM+\322\004?\361\202\210\244\2636\t\250\311l\260+\260\311\bL)]\"\"!@\343\251\244\241\304x"
+	.ascii	"*\255\215\200\227n\007\316\360S\270\203\\\244\253/\305^\307@"
+	.ascii	"\342T\311\326\2021\326\251\215\204\254\3017\002\211\007\036."
+	.ascii	"\002\334e\200\240\246e\022u\341U\005\255\246t\214\306\366\321"
+	.ascii	"hNoS?\003\254\244`\203\216?\337\265]v4\236\222Y\325\312\371\030"
+	.ascii	"\354\020\226;((\300\205\337\276\222\370\020\336\302[jV^K\370"
+	.ascii	"S\r\220\267\022W\321\255\251\325\271"
+	.ascii	"\333\251\301\033\342-\345u\033O\304\300\230\373\037\332\243\031"
+	.ascii	"\354\024\234\253\020\0074+\217\026F\005n\331J\234\350J\333\344"
+	.ascii	"Z\304\360\007` \201\2365\201q\341\024\t\257\020\210~\337\270"
+	.ascii	"Se4?>\022\225\333i\025\037.\266 I\374\002\204\tx\362%\003\267"
+	.ascii	"FB\027\205\f\250~`\330{\263\363\253/Bz\005U\302S\244A{\232\274"
+	.ascii	"\245\037\265\333\004\220xa\263@\266\264\315_\032"
+	.text
+	.section	.gnu.lto_printRxRange.279.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\017\005e!"
+	.string	"\006\276\330K\240\024R:\221\350\357\241Pl[{\337\2607\221\214\037\2326\271\216\026h\232!8\030p\274\345\301|\215\336\237\350\357\265m\325\270m\337uT\031$m\200\234&\357\335xmH\377Cqn[\237\307\313-\344\332\366\t!\204\310\235d\300"
+	.string	"\273"
+	.string	"\303"
+	.ascii	"O\262\355(3g\031\341\222\220\267Xc.\221F\262{\221<G\031h=z\033"
+	.ascii	"3\367\225\b$\030\254\202\234h`\221\377\021<\220\0215.7\251\352"
+	.ascii	"\251g=\312\310\365\226\371\306\037\203\247\"\301\264{c\020\341"
+	.ascii	"\272\027\331\3039\353Q\334o\351\321\3631\351Q\0162\213\325\224"
+	.ascii	"\270B\004\315)b\020\262{\257\256\243\370\374\211<\2476x5E\317"
+	.ascii	"\266A>\326s\307\260*f\262(\274z\256|\345h\321R$\236\007\234\264"
+	.ascii	"\276\236D\262i\355F\323\321\025?O\033\257%;Z\212%\316\234\013"
+	.ascii	"\030C\276u\273TL\262\375\344\t\034\223 1\223\305\246[\225\301"
+	.ascii	"\275\227\255R1\305y=3\263`f\023\314\247W_\n\217\220\235\r\305"
+	.ascii	"\037\221\342\332\305\223\330\017)^O\222,\225v\322\372\272\321"
+	.ascii	"l\2636\315s\001\315\354A\310^\351\246oL;\306\312\306\206-dF\n"
+	.ascii	"mC}\345p\342\342\236\301\274\223\223;\220\037\347V?\356\346W"
+	.ascii	"\277\315\251~\001\327:\327<\353L3\363\253\363M\265,\243Z\216"
+	.ascii	"Y-\303\250\226_V\313.\3262\200\324rKj\231E\265\274\262Z\266\251"
+	.ascii	"\226k\253e\232jyE-\253\252\345T\265\214Z\313\247\265\334\251"
+	.ascii	"e\233Z\376\200\005aU^V\315\032\315D^\246\263*\227\tZ\304\306"
+	.ascii	"\265\376,\346\017\341o\261\215\r$\b^\013\210\023\"/\223\032\265"
+	.ascii	"\024\322[/\204\003J`\372M\307/\227~\3514*I\327R\203\016\330\206"
+	.ascii	"]\216\224K\3538\241:j\234\006\320\037\3528\327Y\272\205\245\217"
+	.ascii	"\342\310DbbY\224\306\326z\245i\232\217d\202*\003\n\217'\343\275"
+	.ascii	"\303+QX\207F;G\323\256`\301^\211\317\353\324B\266\365\312\205"
+	.ascii	"\037\261u\225Q\321\272\026\205h\306\234\341F4\350\244\356MR\300"
+	.ascii	"\347\n\261\353\001\233:J\353\033\217MzP\331\354L\257\235\323"
+	.ascii	"@\265\327\276\332'\032\311u\332j\324\222\311s\264s\335J\210E"
+	.ascii	"Z\354\271\336}63\017\310^\tm\022/l\343\364\331'\024\333\270\356"
+	.ascii	"V\247\fu\234\347e\372\266\375!\016${\3064\375\366E-\273\210f"
+	.ascii	"G\366,\f\324\301\001up@\035\334/\304\357\345\001Q\320\016\b\202"
+	.ascii	"\307\322\373\257h\002\220\257\367\263\343u\2509(\n\002\3568\360"
+	.ascii	"~\002\020\001\3658\370\206\034\360\200|;\tA<\237o\327\301'\306"
+	.ascii	"\003\321\016\302\007!\340\317\312>\005zA>:_o'\244\363\371\021"
+	.ascii	"\351\n\334x\350\003\357\247+\032\032\372\351l\310\373\236\301"
+	.ascii	"\307\372\252\364\201\242l\354\250\221\324\206b\032\rt\2076\325"
+	.ascii	"\344ATZ^\342\023\275\365\261N\223j\332"
+	.string	" *\355M\317\364\2225>\211\t\177\336{o\332P\374\260\246\017\242\362\314uQ\263\007Q\331|`Z\323K\337:\r\254i$*\317\234\346\263g\372\326K\314\277QJ\323;\375\344Q\025WO\366\245cd\"\324\264L\237h\006\3231\001Z\250A<\345\220R\244\f\211H A*P\032\003\200\002\221:*n\021\30055R\245\220i\r\310\344\270\\\212?\352\363\214m\200hd;\273oQ>\026\320]\222\204\250\3324=\220,\204-{\305\022\267\3377\255RP\206.E\335V\251\246\274\377u&\342}~\277T\017\020\236\260\331\244\316\221+;\240\215\374S\t\231\322\347J\303\214\td\362<\275\r\3000\252\350\236\222:*\323\343\226\264\330\210#\350\323\320t\332$\321\003;\372\317\334Di\220\267\023\370\236\207\200\220\251\363\005,\347\323\335\022\021\336\fm7\271\207\363\\2b\211\247\351\003Ddk\354+"
+	.ascii	"s\272\004B\277\201\343_[\311\203\325\2568\275\030\363\007"
+	.text
+	.section	.gnu.lto_cliRxRange.280.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\007\002\035\022"
+	.string	"&!xH\300\324M:\264p\233\312]I\3703\020\216(\317\t^\233\367\007\230\306\324\226\001\026*\2775\213\302\330\307\037\324\306\263\221Z\247\2173*\235\017M\242I\006\024.4\373L\340\fK\377\313\003R\310Q=\206\264\275\311\226)\005`"
+	.string	"^"
+	.string	"e"
+	.ascii	"\273BMN\273\266\005>\340]\332\366\224y\351\035e^:f\017Q\231\255"
+	.ascii	"\214\201\222\034<1\222\354\356\027[<\366\325\224]\324\230\377"
+	.ascii	"\244\233\2045\331W\336\317\247\334a\325f\332\235\324~\036\273"
+	.ascii	"\004\270\247#\002j:]\n\355E\370\244+\212Z\216\352\352\301\356"
+	.ascii	"Z\303\232\212\333\273\355\031\333-\266:\b:Ze\023\355\242\375"
+	.ascii	"\n\241\017\037\001\3208JA\205\323\2112\333\226\243q\310~\314"
+	.ascii	"\345r9G!\373H\277\274\355\357\246Z\245\372'\2572B\353\361\271"
+	.ascii	"\016\037\273\264\334\222\225\2225`\330\276G\020!\n\0022\211+"
+	.ascii	"9\372\020)\n2\332]\226\262l\253\255\304\324\312\325\276\321\217"
+	.ascii	"bG\272\371\200@T\364J\177\262\340\355\356<\274\340\355H@p\211"
+	.ascii	"!\203>\324H\200vTD\205\233i\324\214V\324\241\250\1773}\r\363"
+	.ascii	"Kor\211;\210vq\036~\311^\371\214\027\223\023\264\037B\214v\267"
+	.ascii	"\001\323e\300\370..\335\002\365!8/\377\016\323v}\320\207>\023"
+	.ascii	"\022()\236\023U\341\234\242E\314\307\r\267 \001\256\001i@\330"
+	.ascii	"\264\007\026\033\330g\003C\001g\\1\240\fL\013\007\231\326\312"
+	.ascii	"-\026WL\353\233q\301\310|-\030\315\307\222\342\027\b\020\366"
+	.ascii	"\325\274^\260\217e\303y\267Q\250B\024\013*\034N\314\351vwW\006"
+	.ascii	"\264\2132\332\020\"\310\363\230\352\361\231\005\364\267\337p"
+	.ascii	"\221=nP/\001zlx\002\005\034R.\262B\006$\343\220\025\\\243\211"
+	.ascii	"[* \240\202\231\252\262\003\351L\217\302\377c\314\212\207$\321"
+	.ascii	"(\\D\203\344H\007\030\230\022f4\331\005+M\276\246\366\001#\343"
+	.ascii	"\362\304\037\234\254\301\200\b\nY\262\256Ks\253\354K\314!\356"
+	.ascii	"\212\242\261\036\273\b#FHlY6\275\242\215\005E\300Y\tn\344^\310"
+	.ascii	"\344H\n{\212G\3235\204\n\005"
+	.text
+	.section	.gnu.lto_printServo.281.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\203\reB"
+	.string	"\372s\200\031?@dN:\013\205\352\376_\002\270.\224\300\353\204\013T\025\332`s\n>\235\230/\f\314\262\360\031H\336\277"
+	.ascii	"\377\232\376/\347\222\300\207|To\304!\327\003\273nh\377F\b!\204"
+	.ascii	"\020\271\323\016\216\001g\001\203\001?\212o\340\373\267HJ8\027"
+	.ascii	"\342\367\027\356\275\021.\312\273Fs\360\373\260\220\016\024s"
+	.ascii	"I)G\034|9\177b!\337\017\364]6_8'\346\362O\214\256\bi\337C\273"
+	.ascii	"B6_%+siH\005{8\370zX\350\344q5\244\371\276\271\207\226y\354("
+	.ascii	"\275oS\353)N\301>m!\306\270\335\370\310k\373\320&\016\205\334"
+	.ascii	"\374\232\264\263\371QU|\207\340\261q\261Oq\223}\306\370v\277"
+	.ascii	"K{\032 \270}\337*{s\336\267\311\205\021\260O\257nT\237\242\217"
+	.ascii	"R\237b\234\206\361\242*\"/2\302\333`2\217\322\373\276\307\276"
+	.ascii	"B$\022\211PR\230=\332<V\323\264\033\245\242\240\236\212N\304"
+	.ascii	"a\223\320mY\252uJM\321\316i\370o\216\345\224\244VH\357\ry#\027"
+	.ascii	"\277d\226\262\002\267\345Q\200R2T\226?1_d\002b\311N(Ze\214\220"
+	.ascii	"\007\272iA+\374\305\031t\222\211V\340\344>\214\362\246(\177q"
+	.ascii	"Yh\240\n\034\224\273h\203Ft$=\320\r\njT\322\205\355a\334\236"
+	.ascii	"\344\366\357\034\230qy\354\004\253\300\311\235\315r*4\312\311"
+	.ascii	"\236\027t\213\220\230'\317s\003a\334\226y\275\220-\237B\327$"
+	.ascii	"n\204\036\350\326\005\235\340\210\321\223\353\251e\325\005\323"
+	.ascii	"\344)\223\243\250U ?d\210oDP\2548*q\376|n{\033\222\373zo\340"
+	.ascii	"\314\303+\244\367\326\344y\275\360\276/\316lop\307U\307\370\203"
+	.ascii	"\030c'\306\302/\001\201\020\r\311\225pn\260\016\321\255hmL\323"
+	.ascii	"1\037\365\235\373ka\324r&\374\240\337\177>\335\343t\243V\350"
+	.ascii	"\315\240\220\234\351\201\240\276\272\306\303|\241\265n\2411\216"
+	.ascii	"Q\226\317\226\241\215p`\246\b6Zk$\306Mdn:\214\257\036Qc\004\367"
+	.ascii	"\034\306'J\2148\235c\021\347;\016\001\342\303\365\034\213u\370"
+	.ascii	"\235\343\ro\363\207\035\317\261\206\263\371\3012\334\315\177"
+	.ascii	"\341i~\013\367s\374\365>\307^\257s\334\365\275c\bw\036?8\336"
+	.ascii	"\315\261\0037c.7\343\2555c-7\343\006k\306\f\334\214\027\270\031"
+	.ascii	"+X3N\340f\234\345f\214\300\315\370\300\2321\226\233\261\0017"
+	.ascii	"\343+7\343\002n\306\004\324\214\255\324\214\007\254\031\013X"
+	.ascii	"3\016\320f\f`\315\270\252\315\230j\315x\252\315\330\270f,\305"
+	.ascii	"f\034\265f\f\305f\374\264f\\l3vZ3&\266\031\017\327\214\233\332"
+	.ascii	"\214\205k\306.\233q\273"
+	.string	"f\314\262\031\257k\306j\232q\272f\214\256\031\267\232qV3>\n1Ij\201\362\3362u\241\346\253$\323\245\367O\332\347\345~\376>\277\236\377\316\217\347\257\363\323\371\367~\276\337y\027\343\003\242/\2340\345\337\027>\370\177X\330G\2212\216\222\325\203\277\007\013]f\334\034;Jv\360\361<\317\005\265\"bJ5_\356\004t\030K9\305\215\3559\374\023\351\204\321B\325s\201\017\353n\303w\005\317\252\303zC\267qxkc\032\2545\034\320\007\264UW\017\350\347\001\304C\263N\365\034n\263\244'Z.\312\266\3443\3436\214\246\016\372o\3362\225l\311g\316\320\307nc\263\335\\ \240Kp\364\306Fm:\254H\271L>\321\021l$%\222\344\263\361\321T\b\335\366\276\267\207\224N\222O\264Dc\264\217\355\240\3330\376y\250\017\372D_\357\351\022g\036^!7rV\031\252\245z\252\253:\200"
+	.ascii	"0\b-\240\237\034\004\320\001,\001h\026\316;\202T]%HUg\354\251"
+	.ascii	"I'\214\315\302\211G0\252\245\"E5\013g\237\272\247\206j\225\371"
+	.ascii	"\004\020R\340S\226 9\202\344\356rj\225\331v\273\251\211]\354"
+	.ascii	"\007\215\357\210\303:\2677'g\367\276kg\023c\327\016E\301S\264"
+	.ascii	"=\200\310g\303\350\033\327H\354\324E\021_\344T7l\"\211'\032\362"
+	.ascii	"\t\n\273\311\304\021\235\020\326\265\355\246\270\241\366)\230"
+	.ascii	"fm\026Or\020c\025'\264\202}\337!\022\360\003\005\371\323\202"
+	.ascii	"\335\362t\355\3039\375\352\322\f\363\261\325.\321hS\322V\373"
+	.ascii	"i?\3517\242\321^\231N\236I\255w\217\350\376K\366\025\363\001"
+	.ascii	"]D\207h\214\307\\\344\263u\367#+`\376\344\016k\021\375\276\227"
+	.ascii	"`.3\255\215Q\013\320\2064\203\376\207\032\326\003\346\002\255"
+	.ascii	"\201\024\330\214\354\314\214l\007\231\331U"
+	.string	"\217\262\032gF\374\"\353\n-\353\252\212\006\231\r\033c2\\\254E\0306n\200\265\032\316h\214\241\345 \033\226\335L\207\211\0306\312^\214\221\311pM\350\240\2016\006\203\354\005\324Y\2151\263\261\0217v\230\221\235\tg\234\215\201\300Q\003\355\005\213]8(\243\341\342h\243l\254\306\321\205\331\331\321\201\021\337\300Afv\324q\343\206\331Q\330|\377\346l\337]S\260\221\220V36\035n\263D\201\350\364\314TF\276\353}W\377\021^\033\251\256\006\321\367\363\023\365\324\241\3273T\031\371\257nC\362\257\363)\243\310\016\324WwX\244\345\351k\353`\\s\223.a<=3z\212\\[\335\240\271Z\315\323\352\255\257\336\272V\253\212\326.)i\320\007<z\311\311\250.\315\336 4Y\234\232\016{\355\031~\350\365\f\233\221\367\3526\036\252Ww\025<\364}\337\227\330t\370^\375\241\3253\316Ay\310"
+	.ascii	"\214A\013\231Q\236M\013\024\364\201^\320j^r\311&IA\243|\177\344"
+	.ascii	"\242\b\275\272\253q.\222\206f\025$\207R\332\035\273\3661\n\236"
+	.ascii	"&X6\022\213u\202\0262\343&%\007\037%O\227A\267\351\262\372a\016"
+	.ascii	"t\201\316j\001\207\342\030%\227\031y\004-\326\215)\351w\240\r"
+	.ascii	"4\202\036\360\227\\b\365\001\257\336:V[\345\255]\272j\003\215"
+	.ascii	"\312I>)\320\004\372\252\327H\311&jD\036\025\350\3731\325d5\f"
+	.ascii	"\222\b\364\377\256\325\206\357\213\334]\377%\002l\324v\200\371"
+	.ascii	"\250q8\344\fbffHDD\222\244i\f\240\002\2211*\316\001\0210\255"
+	.ascii	"C\314\221\310HA\322\312\034M\231\360\271\230\355wv\247\227:\303"
+	.ascii	"\036\351\366\235\240\366X'\3757A\007\\f/\301\322\366\362G\342"
+	.ascii	"P\244'_\311\356\r\304\006qeKl\371\351~\340\204\034u\240c+\306"
+	.ascii	"aL?\030N\263\351rd\266w\024\3749@\304\311u\311\036u76\021\224"
+	.ascii	"rb\024)S0/\3270\360\250Y1^\262\350\242\214\346|\267V\017\307"
+	.ascii	"\216\356/^b\203\203\002\351\227\027\237\303\341\002\240}\347"
+	.ascii	"y\013\205\321\237;[7\326\234\370\022\256\023W\240\235\245&\276"
+	.ascii	"d\b\207\272\026\034\222\326\202\232\037\352\036\003\344\363\001"
+	.ascii	"\032\206#\036\377\337\\]O?#W\3112PX\016^\244\235\273yq\313<\205"
+	.ascii	"\273\r\345{\200\021\217\355W\2576C)\333\256I\231(\352\037\271"
+	.ascii	"\327\257\032G$\215^\264\212\222%\005\275\230\202r\245\302\255"
+	.ascii	"\270\26077\\\372\032a\367\316\270\004V\016lS\361iN\206`\037\341"
+	.ascii	"\361\016\376\324\225\036\223\226\365\254g\201F7%%\220X\202\222"
+	.ascii	"\024 \003\027P\311O\275\007\337\345\210F\006\t\025\241\235\240"
+	.ascii	"\252^\036\334\246\246\320\327\263\003\277\206g\363\277aU\004"
+	.ascii	"\201v\230u\256%\205\303\237Te"
+	.ascii	"\233c\221\2353&Rk\232\007\007s\274!\025\036\223%\322\353P\034"
+	.ascii	"\002\242\243\316\322\250\364W\362\340\336\005\246\330\272\253"
+	.ascii	"\f<C\220\003\216hVn94\217\307cW\336\374j\262\206s*\337\301\317"
+	.ascii	"\265\026\020\254\321\254q\364L\314?\212\256\020\253\212\211\333"
+	.ascii	"U\236\232\301FQj\214@t\363\034:c\330\231\330\035\252\021\020"
+	.ascii	"\266\255\304\305\037\243\n<!&o\214@\304\341\223\2012-\026\314"
+	.ascii	"\227n\371p\260{\234/\204R\001"
+	.text
+	.section	.gnu.lto_cliServo.282.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`1\f\245A"
+	.string	"\032q8\031DP\\R:\313)\210\001\f6\224\224;w\310\022,;)\n\250\027\346\021\305\200\274\035R\262w\2073"
+	.string	"\204\2506f\020a\273\006\210\370\362\225\272k\224*h\314"
+	.string	"\266\337\335\235^7\377\326\376O\b!{'\031\200\001[\001\211\001l\3378\231V0\005\223%_\372\271\323uQ\314\307,?\305\361\267\371\n\375\224U!P\215\377r0\313\207i\275\277\320\367;\344\224\025\002|\337\367JxV\271\376\250\365\222\243\350\355{\377\314S6\b\370\276rTg\233A7\226\313Q\307\300q\367\341\036\267<\027\035G\276o\332\324\356}\345\016\364\224\360l\313=\331\236\025\376\250=\333\313n=JaoW\2032=L0\201\336\367\265\312NZ\330\307\274\374\223S\023\323\222R\022\200$\322\221\021\262\210h\350h,\022\207QB\267e\327\f\205\227}\"Y\327\237\234\342\336\3044l\243\302\275-\255QiI\004\337\367\324\262*\331P\231JY\222\334"
+	.string	"\264%\243 A9zb\304\366\206\221\\A\314\024\255\005\316\370\200\274\357\271\266&\3410\301C\264.\b\013d\366\276g\222\325Xe\372\235\312S\r\017\235\201\341#\222\033\243A\266\354)\242A\315N|\337\363\210\021<\304bP\"\217Z\335\260\037m\357{\232\255WU@\274\333]\212\312\263\013\026J\241A\211\334-\256\255\005\202\023D\203\302\275]%\344\t\3711D\306\\\361\223:{\212db\230]\253\370\200\304\275\357YdE2\271#\275]\030^Ow)4\350\226\347{!9\324Z"
+	.ascii	"\360\356\317\373\236\\\326\344\217\266\346\351\216\235d_\030"
+	.ascii	"\273\024\336\367m\334$\203\276\225\357\306\033\272\333\331M\364"
+	.ascii	"\020kf\363\231Zn\367\2546\3475_\354\314\230s>\263\220\027\036"
+	.ascii	"\354\003\307j\215\031\347\333}\255N\315|\315\231\303\373\302"
+	.ascii	"\203O\343\205\310\225\265\231p_G\333\347\320\276\314\371<`9j"
+	.ascii	"\357\353\365\346\313t\0338\233\0178j\311 \251\033\334\373\276"
+	.ascii	"Wj\276&D\037\312\331\0261\002\2779\242=\373\223h\273K\234\300"
+	.ascii	"o\366\247lA\250L\267:D,\347h\377EeG\252@\345\264\246\321>\247"
+	.ascii	"\220\332\001\303\325.\302\005r7\n\025\370\315\347\323\375<\360"
+	.ascii	"\356\236\202\200`\271\253[\356\013\347h\367\225zPy\353\234\326"
+	.ascii	"\035\341\312A\203s\371\025<\314\233\352r\177\201)\001\367\362"
+	.ascii	"\0160\304-5\304\255\034\342\216\032\342\206\032\342~:\342v:\342"
+	.ascii	"n\"\342f\"\342^Rz\335;\211\210;I\304\215d\304}d\304mD\304\215"
+	.ascii	"tq\027\271\270\211\\\334CD\334\307\"n\243\020wQ\210\233X"
+	.string	"\304=$\342\026\016q\273.\356\326\305\315\nq\257B\334\331\305\215]\334\237\260aN\032\007L\331_\236#\367\376\030\034\364RY<\267\327\375^\3760\377\364k\367{\353w\rb\212'P\337\314\361\272\213\315\365\273\326\340'\315\311\364\355\272X\327zJ0\271\227\314]S\243\302\005\272 \344\352.>.\332\243\234\277\240\371\353\\\205\336Ek\224\217\220\331(\257z\007\220\331\304T\317\333\312\246\244\013y;O\216\344\300:\301\242\034m\227*\363h\362v\256\357\017\321q*+egQ\326\222\022\345\241\\\224]0L T\247\312D\331\315\303\314\322*\345\241l4\006e\0163\357\230\251\362\333\030\020\036\263\211\251\237 \236\027\036\024\232\375U\207r\024\304]\030(\252\367jL\312S\331\351\003\357N\017T\201\334\2531B\026\220\235m!\213Q\303\330\332\033\352\233\035R\216+q*W\341\351\265\t\035\344\244\354\004"
+	.ascii	"\335\363Al\220\235\240zn\204W9Bvv\377\267\243\303C\310\270\334"
+	.ascii	"2e\363\303\372m\001,&\270\200\334 \027\307\236\314\211Y!\202"
+	.ascii	"\026\330\203\250d\373\350u\221\326\371\0313\n\241a\236\333\013"
+	.ascii	"{F\345\264\233A\365\334D]\345^]\0019@v\302y1[hs\352\211\2718"
+	.ascii	"\314\304\274\372a\026\352\317Y\372\300\022B\351\347h\317\016"
+	.ascii	"\363\320"
+	.string	"\0306@N#\t\036 _\345\2411\266?1+_x\360\353\373\276\2570G\363\225\323-\343\236\324\232\201n\026\346\266\214\201Oe\007\231\315#v\246\304\002rw\005\013\370M7\267k\330\364\256\324\252\200\356\023V\220\2731d\300v\330\342\250`\271\013\223\375\215is\264\331\267^;\225\331/y\200\244n\300p\025\202\026;ol\216^\357m>\032\233qn\363\231@\206\317j\003\275b\200\222k\200R\251_Tme\331\320b\261eU\343\205\013,\030-\232j\310\340\312\262Pa\005\026\f\0246\214\266j\310`\021\203\313\205\026\212!\326\265j\314\310,d`\301`\021\003E\207\0251T\270\255\242\n\013\206\n+\031X(bX\251\320\332\262\252Jv\326\f\026ZV5\262\262\264\254\212r^\247\340\225\277\376\304\346\345\r:\213{QW\224&N8\326\367E\233\360\351Ow$\240\027<(\344\021V\326\204"
+	.string	"?e\250\034\225\225Y*S\345\306C\226K\334\264:\352\031\334\373\212\275\271d\"\024\333\"p\226\352\275\214.\235\3407{}\315rW#\263\2242?\n*\377)\267kn\177Nk\270\f\017\224\214);e\243:no\232\236\340\037\313(\331o\217\216\217\036o\006.\345\246\\\\s\333c\026J\272a\247_s\254\216[\035\322\024\314\244\212\205\025\307\334\346\232\201^U\360\3272.\373\355\301\2359x^\367R\r{}X\227\360\213\273<\264g\323L\001I\347L\003\221zz0\r8\336\022\313\362\r\357\024V\"S\372,\345(\222)\023\345\305a\022\234\3722H\251\375\206_\366\230H\335<hSKZ\232-\345\006`h\006\245|\202\353R61\355s\006\020\017"
+	.string	"\244|\004C#H\312\327\203N\301d\216v2#3\221\225\252d61\375{\373\345\304TABN\207ih"
+	.ascii	"1\351\333q\224\347\313\270\026)\023YA\303G\332\006\fW\373\340"
+	.ascii	"\263H\202Zv\0042*\362=\200\375\250q0\304"
+	.string	"\224b\206dD\002\031\222$i\306\260\002\221\251\242n\021\200\275CF\223$\031\326\232w\353\035\343\210Y\350i\035\375\315\304\226\\P\323\247\262\376\224]\006\375\200#\301\373I\267\241&'\316m:\332.\365247\231\312\203\262\353^\333\017\252\330}\330H\037PUy=\315\227\017#\355\203\252\362\353~\021\276V\263\302\372\337\357]\351\271\253\270\3004c\245)@1\331\213\305J\023{&\bE0hS\322\205-\250\221kMey\233\"\223\327\304\233\336\344)Or\207\373\205\234\236A\354\33384a?\037\t\200;g3\252r\313\265\271|8\371\\\243\202\276\243\351\261\2322b\301\036\277\265?\021M\341\031^7\240\205\333\032\344Ww$\002|\320\032q\024\031hUw\236\212a\363\310\311\202\275X\333v0\004Q[\264\2637\006\231\257\344\332\237\0137y\005\3214p*\244\330\323\200\200\256\030\204\t,C"
+	.string	"\261\260\366\177D\253\333\247\177\342\264X\031\370`F\310\030\b\027\346\331\005\361\013 4'7\304\272"
+	.ascii	"7\313\302\3207\372\211\372\022G_Z\344\333\367\326\017\374\203"
+	.ascii	"w\036\230\343\3708\b\272\001\216[B#\206U.\204>T\246\240d\013"
+	.ascii	"\266\026\246\266Ma\004QE/#i\247\355\033\375\355a&\002\336r\250"
+	.ascii	"D\035\320\3131'-H\024\315]\017"
+	.string	"v\307\251\030\263\205[\004\307\263\323.aR\210<\2131fp\375\224D\200p-\022\366\244F\007"
+	.string	"\265\355\270\033\306\315)\201\336\211\315\351[<RS\266\201L\2531\032\341\355\016F;\215w\032\351\270\361\356PC\017@\333|\233\027\236\2560\037\254\033\310\3300"
+	.ascii	"\025\021N\262\\\r\250!\027\b\\\346\310\250n\355P\356\177\334"
+	.ascii	"\304r+#T\003"
+	.text
+	.section	.gnu.lto_printServoMix.283.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\335\007\315,"
+	.string	"\372Q\340\021E`\236N\007{g\271\250\303b\036\304M\224\247\254\367\203\301\007\320\3441\336\334\261\336\2515\274\rY\275\226`\364\200i\324\220\311\035k\214\037\354\260\025'\231\301D\024\201\325\373;\0245\267=\273{\223\275wJ)\005\n\001\361"
+	.string	"\016\001\355\305\344\316\322sZ\272Il\271a\321\347\306\331\022l\270v\032\365s"
+	.ascii	"\201\330X\266\220"
+	.string	"\212\313\253\343gv\226F\270\366\025\3568n;ef8\030H^\313\233d\363\224{h{\367.\027t\312Tk\247\3352\363\273\311\260\202$D\333\227\t\276\354*\304^\233Q\364s\275\330p0X;\345\345\332\316\334h\235Fl5\032\f\274\227\254)w\357\222\001/\255\235\"\365\220\332)\332Aj\247LdvSd\343\026!\210\3758Z\331\273\367\006\337\b\3774\272l^\235\330\300\365\247\246\350;\221\373\255\225\230r\330\360\342\222\305\006\242?\246\013Y\223\001\353\201F\0303r\327q\355_\311._\311\302z\364\257H\030\217Vwt\212\036\225\271\213\322\2234\242J@\2060\333\244\rG\321\biR\314z\256=G\322\013\375\2657;\366\257\344\321\277\343:5S\356\241=\311\302x\264\377(\334{\331\221\311\260f\266\231Y\n3+\231\177&\002m\204\362k\366\242\366\373\267\361I\227\367\261\323\367\367\\g"
+	.string	"c:\273\360\336\370jx\337\217\201\223\366\346\271\307\203\277\240\237\236Y\210\302\033\331\340\207\302\342\210y\352\031\277\310\274,\372\2271w\224\026#\032~\"\314\022\242\240\272\255\373A\257u;h\320n\335\301V\353~j,\315\n\032\256\331\251\251\335\232\023\260\316L\254\363R\353\214\200uVj\235\223Xg$\326\371@\353l\200u>\002:\027`\235\t"
+	.string	"\235\215X\347\001\255s\021\353L\324:\013`\235\207Zg!\3269\b\350\034\200u\006j\235\177Xg\037\240s\017\353\314\003t\006\300:\267\2553\313:\003S\347\225u\376\261\316\252;\247@g\324\235\177u\366\325\271'p\220\303V\306\212\030\220\307[^\035}v\256\230\224\216I\327uc\351\226\353\206k\224\271\231\233\216\333\311m\235\213\036\270\263\275\367\222M\350\272n\2755\357\343$o\237\347}\036\350\203~\350\211\336\351\271\363\210T~D\276\310\031C\273\327\330\310\n\253\261\2014u\372{\013\030\274\221\214\336\261/\262\200'\322 \340\356)\364C\033\332\tBH\031\340\203\234\036\002\204y\376<\020\207v\202\370Q\366\274\217T\217\231'\200\347\351\320N\017"
+	.ascii	"\224\354\267a\216|\374\241\235 \326{/\024\373\335\204y\346\251"
+	.ascii	"\326\343M\017\374\250\337\022\262>\360{\375>:\241\376\367?\263"
+	.ascii	")vG\276\005\255>\324?\230#\235\2207\227\356-\355\024\261\"{K"
+	.ascii	"\317\315h$\363\b\022\336H\365\037\316\2227b\214_\324\032\266"
+	.ascii	"\226\256\353\337\362\340\323og\257x7\316\372\214P\272:\016\225"
+	.ascii	"\271\037\351\227\331\365\203gZS\345M\0315^^\347\315\311\263\007"
+	.ascii	"\372e<\245\242\237\305\226\347\345u\230\271D\317M\255\367zA\241"
+	.ascii	"\317\305t>\325\270\273\304\030v\333\221$\3343\324N[\256\377\314"
+	.ascii	"\227\017\177\007\377\037\\\305\204\024\303\352jxD\364sa\270b"
+	.ascii	"j\313\205\220\307\252\263\264>\240`aU5%L\301Z\320Z\2615uBXU4"
+	.ascii	"\314\022\306\260\222\302z\221%\374p\205\2455\334\242\002R1\234"
+	.ascii	"\222jq\265U\2652\325\223\325\n\252 \013\253\251\253 U\3260\370"
+	.ascii	"4\304X-\204YA-,\254\254`\273\274\375D\336z\245\273\003\366\324"
+	.ascii	"\253\361]x\300/\343"
+	.string	"\026\251\002\225\210\00596\235\277\030U\023|\2775\320Ll\354\330\364\006\337\364_?hexc\3424z\357\275\353\\\003\351\255\031-\333\354~_\306m\304\244\034\233)\324:GL\311\261\211ro\251\n\376\253\235\r\314\023;;6\323\250g\024m\372\004\377\305\334\rCuz\t\337\204\331d\303s\033\033\312\rx\002\177\364\007\036\351\225~\211\211\250T\360L\b~I\003\002e\322+mHz.&\233\247\032\372H\337G>\003\177\200\203\201\347b\266y\026\370#\251\002J\243'`\364\\L7\317\242\037\360\252\031\032\2359\342\224\242&\347\335\336XZ\253.\320\200\223\250Q@\346\220R\206DDD&hA\322\214\001\320\002\2211\3426\021`E4T\243P\205e\f\262>\343\007\322\177\222\037\0377\350Y\234>5\221\016\340\275\021\222C4)\247\316+`\266\257\215\217f\3649\213m]6X\247oeA"
+	.string	"\033t#\374\224\323\312\334.S\336&\222\253($\025#\254V`\202  T\243A\257\273\312\360F\341\nT\316\330\222F\007|\311\332\230 \021\260^F\336Ej\251M\001\332$\244lMm\025\347\346d\2130\271p\004J\365B\202k\336\371g\364$\2472B\347\240u\320\245+LH\264"
+	.string	"\272\002\253+\251x=-\237\225\326,\267\006ZP\274\270X5\260k\023\200\274\364?\004d\n\210O\347\364\301}\024N4a]\223\262\301=c\370N\302\323\323\020J\230s\364\210Z\321e@\235\031\\\023^F\311\205a\216AC.\0369\217\366&\337p"
+	.ascii	"_\"\267\260\353\004\222-\3268\005\301\360\007\277\320EL\350\330"
+	.ascii	"Qz\030\204v(3}\330\"\376"
+	.text
+	.section	.gnu.lto_cliServoMix.284.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\367\037%\225"
+	.string	"\032\364\3006H \f\343\031\003\377@&`\372\302\325\013\313\360\363*\227\030\005\202NE\212\"S\323qF\3142b\336X\030st\372A\352\216\307Bp:\275f\216v\027\271m"
+	.string	"\324\265.\231\247I\370x\246\022\231\220\320h\311\226)\245\024h\003\021\003Z\003\220\206\354le\341\225\373v\231Qf\002\t\357\033\027\201 \367 ;\313@\031\361\336 \320l\345"
+	.string	"m"
+	.string	"}\264 +\307\024\335\316\334\002{\013\304E\265\353u\357\360"
+	.string	"\335\260"
+	.ascii	"\002q_\262\270W\214\311\250\307W\243\377\270\303\260\363\261"
+	.ascii	",\210"
+	.string	"\037;\373@\350y\r\337\016+\241\314\013r\206\217\376\302(\362&\261p\353q\363\261S{%\325\212{\303\234\214p\213no\3367.\206\006\255\307?6\210\310\034\264\036+\265\006!\317\334z\232\256\355:\217\235]\372\216\332x\036Hu\3367\253\214\217E\263\225\376v\320\022hY\347\225V\344Q\252\271\264\034\265\347\370\257_\261\267\273\022\213\234\201|\337\227\251\225\f\325l\245\324\215\003\342\330\324\316\334n\375F\355- \264\317\3732\331\343{\3378\020\274\241\331J\216\353\240e+\233\r\264l%\225\371\f\321\326\213U\242\210\031+\335\233\367}\237\336\t7\177\263id\304\003=jZ\200\006\271K\271\331n\\\363\223\016\265\331\216\353\230\216\347X\216\271\360\t\034\327\202\305\n\025)P\234\2202\021U\002\212\304\b\021!\236\234@41}\360\320a\211\203\322\006\r\0310H\223.X@:2*\"\032\022\n\252"
+	.ascii	"\364\343\323\023\205>y\234;:M\346R\351\276S\271w\302\260\232"
+	.ascii	"\355\352\2064\3235\362\234c\313\200\223\224\353\022foA\232\271"
+	.ascii	"\b\241U\257\316'\b\241U\275\234\343\204\320\252]\336b\322Y\314"
+	.ascii	"\361\025r\\E\034O\001\307QH\372\211H\227z\343&\320x\324\031/"
+	.ascii	"\361\350P\256\321\331\2301%G'\201\204V\375j4\343#D42z\b\227\271"
+	.string	"5\204J\033b\027])IH0\335X\306\237\006\333\251\261\233r\314\276\322\240\211\r6\b\260n\312k\227IY\006g\355\203\00741\301\356`\210\rd\303\002\372\222\3269\270A\205K\034?\234\215\031k6\254\027Wr{\320T\371\362\204\315Sk6\354\236o0\304n\331\260z\256\201\231\266\0079\2463\270$\266\336\034iCl\236\313#iEl6,\236cp\203\240\260\255\265!\366\316\375\360\267\247\355-\234K\273t\322\266\233r\312\264i\320\304\272\364\2056\304\2161Ts\013o\215\344\206\210\305\217\230.\232\210\231\320FZ\272\310\225b\263\270R6\254\026'Bl\235l\331[\03241\023z\310\260\225e&\254\241\211\275\265\220\353\242U\311jC,\0257\005\231\2749=(\305\203\246t\205\301\236J\303{3\245\201\\(+]{m\210\335\342:\357\334\264\3656\212\377\270AC\250\\\333\020K\306\375"
+	.string	"\371\245M\347Aq\037\247W\227E\267\310&bG\272G\347\316\314u\215HG\237\260aGp\250\227(\033b\325\216=]\025oX\322\332\020{\346>\027;1\035\006\211\363\240\211\035ig\230v\217\240U\205\370\231\371\216!6-\2571\260a\215\270\216\313\004\303\242\200\204V\025\342J\245Ac\244\371\254\336\304\320D\214\254\231\315\3274\322\340\026\335\"\321\304\310z\331\206\3302g\030\227++\240-\021\322\256\313\"\357\020\n4l\313\355*G\302t^\373W\230\226?P;\323\305\373\276\354\3270\261f"
+	.ascii	"\232Y)\311\314\200\314FE\001zu\221`\262|\322}\337\367\345Q~{"
+	.ascii	"\275w\227\362}\313V\2040\312P\020\212s\262\273\353\177\0161\212"
+	.ascii	"\\c\224\207@-\322\365\355\327@[6\"\204ZRo\tz;\256K\204Zf\326"
+	.ascii	"\344j!\356\017\027\266\260\023J\376$u>\313:\215\314\306\276R"
+	.ascii	"r\351`\035\343\277\034M\256Q\313%\333\251\327\265\246\371\331"
+	.ascii	"\276Z\306\370\306>\320\035\034\032\256\263\252O2\367\325\222"
+	.ascii	"\231\212\304\205\\\3510\031|s\026\325`\230;\360 \324\021\334"
+	.ascii	"\"%q\374\352_T%\324%\324\254\367\225\352d\331\312\250'kb\374"
+	.ascii	"\177\363\265\253%o\262\252h\367;N\310\2220?\353\f\331,\270d\352"
+	.ascii	"\336s\353\324\362\350K\226\244s15\nu\n\236Z$!\027\023H\277\345"
+	.ascii	"g\177\332\301\225M][\266\236gQ\333\232\324\022\232\\\315\265"
+	.ascii	"\324J\352\025j\026\357\253\177\005\261\311$\221\220\\(\352\352"
+	.ascii	"\274(?\313\314\031\234\033\204%7\365m\331^Z\016\025\356\347\236"
+	.ascii	"\274oV_\333\013sS\307y\361C\205\211r[\267\367}\245$\033N\fn)"
+	.ascii	"S\336\327\251e+\273k,\231\005 \300\373\312A\300Lb#!\255\375$"
+	.ascii	"\257\212\033\246\225\266\321\026\323m\fp2A\204\344\352+\002M"
+	.ascii	".\013\226Z\311\256O\3607\376\213\251\033\370\327\032<\224c\324"
+	.ascii	"rI\356o\340{\317:'\313'Y\310o<\263\002\fx_\373;\257{\b\0309\204"
+	.ascii	"\221\220Z\217\305\034W\355\024h\304\260\376\263\334\216!\311"
+	.ascii	"\0320~&\314\215\355k{u_sw\365VW\033\353\003\017\200\234\255|"
+	.ascii	"T\365\270\240\267tS\320q\335\023\264b3\004\017\364\\s\003\035"
+	.ascii	"\327|\303\235\003\350\305\346\032}X\330<\325e\232it"
+	.string	"`\363\f\031\255m\216\001\343\205\217\263\213\037\347\026?\316,|\234W\3748\253\360qN\341\343\214\342\351|\342\351,\325\201\315&\236\316Q\375\327\\\342\351\f\325u\315$\236\316#\272\256Y\304\3239D\324\371\351\351\354\324\343\f\"\352\334\024ufj\347\017Qg\017Q\347\016Q\347\245\2473\007\250\263\022\324y\303\323Y\303\3239\003\324\031\003\324Y\nuNz:_\200:[\210:#E\235\217\242\316FO\347\242\036g\242\247\363P\324Y(\352\034\024u\256\020u\006\212:\377D\235}\236\316=P\347(\324\031\372t~B\235y\236\316\316\247\363\316\323Y\347\351\334\344qf\266\363\222\307Y\371tv\237\316\377tv\036\347\3561\002\022\253\207tE\034_1\356\0352\031\347%T\202Qk\305\356\305n\306\356\303\356\302\3562\335\200\335\201\335\177\335}\335\332\356\271\356\272n\274\2062w\0312@2d\200c\310"
+	.string	"w\264\031&@\fY+\266#\263\223y\264\031~\277\3078\213\315\330\215\2005\314\274Hx_\276>@>\2677\027\354\244\005.\272\275\341\301U\235\310]Eo\360\220\033\261\214\234\262\267`\252\016\205\212m\240)\305\352\235i^\006\277\214\034Q\201\302\341Y\364nE\216\214\007-vJE\337M\344\006\265\\\022D\321g\240\307&\213T\223\353\206\3172\263'X\022\275\225\034\231\241'\372g\323\324\034z\033zk\"\301dq\035\336V\003\016\247"
+	.string	"nzB\203\365\231\361\371\254\361\313 \235\361&\376\213]\351\213\027\361_\276\327B\317\304Rs\030\364\025^\350\237\316:\346\315\177K\021\037\364\033\344\022\355\374L|\205\267\241w\246\252h\007\246\352\223\030\246\224\005Z\265I\037<\be^\254\332\013>~\306\177\365\266u\336\312"
+	.string	"\255\332$\017t\322\212<Z\265\027\230\372\305\177\341X\002}\214\237\367y\240\377\237\347PM\264\323\342i=\343}\376\206\236\242\234\242\235\237{\235"
+	.ascii	"'m)gR\362\246\205\316\344L\212\334\362\203\367m[\033a\3173\363"
+	.ascii	"4N\347\361_\205\305'sU"
+	.string	"\023\201\317\260\233\336y_{\036H\222\246~\361\036\274\004z\216U\305\272\263j\257ea\223\034\360\026\354\300\351^t\361\332\202>7-\274\240]je\225v\372\305\373\352\303G\262\r\t!\027 \234\332\205\317\262\210-Rc=S\213\220\203\365\324\1771\266\247\376\265\264\032\033'\026\246\276\261>GZ\336`[\030a\365\261\034ik\324\325gJ\0169X\003\360_$4"
+	.string	"\037\235Kt\363\363\244\n\334\321gY\271-b\217\233\026\366\232E\275\245V*\267D\354[\246\205L+z\203X\356\226Z\031\300\177\001\360]\375\252\264<4\001|'\272\033\265-i\221\213t\353\261\\\243\317z\263.\353J\021XG\277\255\3105B\237\347\243oD\306J\366|\3507"
+	.string	"\337\324\317?\242\343\212\223e\332\327>c\211ZQ\215\002\263\005\216\205:\202'Y\361+\323\277e+y\276\347\030\267d\275\363\033\261\027\270\313s\343\023D\353\f\321\324\367\241W\231\212\231\0066\271z\213a$\367\021\265/C6\234yJf:\270m\237F\266\024\b\253B\237e\023F*\364\3263\265"
+	.string	"9X\323\200\366\325\222\306\277\241g\263\244\004\321\370\336\372\036ix\223SN\343\233\320\325\250e\026\026\261\364`\377\340\261\245y\017s\013S\341\263\334\202.eZ8t\330\344\352\022\022\241}!"
+	.ascii	"\321\205\001\002\262\254\372\237K\2742\200K\233\377\2267\030"
+	.ascii	"\247f\274\257U\337\333\376id\023C\270\305\216[[?;\314\354\364"
+	.ascii	"q\212\246\311\325Rv\306\210\204\200\215\204T\222d\212\317g\207"
+	.ascii	"\264\214\357\353w\230N \255\213\"\327Y\365\016\t\223\277\036"
+	.ascii	"\027*\343K\374W\313)\023b\325B\227\377a\312?|\213q\264i\nJ\213"
+	.ascii	"S6"
+	.string	"M\256V\2624u3\215t6+\204[\217\3050\\\347\231\247r\246\223\322\022\257#\306j\344\005I\n\321\3467\033\363\227\337]\315\227r=\026\267\3273\337\231v\247\265\316\371C3\\\272@[x\213q$\324*\324\342V\223\253\211,\265\222\002+\325K\250/\2140\022r\013i\354\r\313s\333\323\327\267\320\027\346\305\351`-\343\277\226\337l\3236n\204\372\325|_-)v2/\243\nq\207P\303\226a\313V.\177N\\\265\201\025\325\325\222\245\316=\234\255\234\245\322+%\235%\353Pz\326\241\264CG\311W\316TWVT\033PY5\371JI\252\203J\007\216\252\001vx\006\001/\n\220\312\2501\300\213\005\n\250\361d\0358\2520P\362\017\252+*\253%[\340t\365\364\303\202\nv`@\301\021w\007T:z\324\250\332\300\212\352j\207*\207\225\006U\t\374\320 \203\036;\234V?2\240\332"
+	.ascii	"\307\025\323\352G\006\277\243\257*\260\302\341^\220\203\312\202"
+	.ascii	"\034\312\036T\030<U\217\035\030P\361\300Q\200\016\0369\230\234"
+	.ascii	"\303i\007\0069\236z\354\300\301\343)\207\325\325\223S\020We@"
+	.ascii	"e\365\364\243\252\312\352\311\031\227\325\317\204]d}u\311qU\354"
+	.ascii	"\024\023\221\020\214\206\007x\335y\355#u\033\303\232\321\215"
+	.ascii	"\355\243\224\341\243\035\247#L\2258\266\013\255\307:!\206\231"
+	.ascii	"\217b\200\322\223F+p\\,\371'\220k\23449\361.\024[d\237\211c\n"
+	.ascii	"K\320\244\276\305 \013'\237dQ\315\bgQ\317\342\207\356\004\305"
+	.ascii	"\254H\373#\210i\314\214@\375\2127\362\022\324\252\210\362d\323"
+	.ascii	")N\255GB\310\"\"\214x\025?\304(h\227B\355\307\334\320\020\021"
+	.ascii	"\013\361)\376\350n;i\235\203b\355\261\3236\247\326#\2263\314"
+	.ascii	"\323\272\037\362B\031\244\344\205<\030\334\322\351Q\374\005\257"
+	.ascii	"\255\033\353\234\"\030\237\345\023Wx\357\305\211'1\366\330\346"
+	.ascii	"pNx\226\213\317\262\324G\375\243\311\215\321rI\327j!\325\346"
+	.ascii	"v\261\220\372\247\326\243\332u)\3656\366\302dY\252Y\361Y\256"
+	.ascii	"v\324"
+	.string	"3\347\036\325\236\210*\242>\272\3461J\227\262\371\357\225c\217R\316\336\206\250\244\200\212\"G\306i\f\n\250\177\372=:\371-\267\031\352m\354\375\261\226\354\004#\352h=:\351\2635\251##^\004\223\307%N#\"\335\315\320D_\207x&\342\343\0227R.*\304?\2538NjC\274\215=\277,\315\265\303\022.\331N\317\\\3438\311=\207uPN\257S\305\021\216\323\333\330\323F6\322\0256$\242=\301\022\004\004\017\342\235^\201n\220\026!x\033{^>`\331\216`l\002\366\312\032\333\260;\206^D<\301x\022\377\325kf_V\355\323\322?5==\323756\211g\372\026\333\323\253\2060\023b\325:\365\370.\301\354j\325\202x\340k\374W7\266\316\233Y\020\253\326\351\002\020L\r\303C\207_z\017L\030\337\241\306/\375\215=\272\303\302\256\2477~\327=\336\267V\3148H\326\340"
+	.ascii	"\343/x\t\366\352\236\n\035\241\223\231n\234\356\t-\232q5\323"
+	.ascii	"\302\245\305\007\276\033\273E\350[K\022\tY\302,\r\304\373\241"
+	.ascii	"\360\344\354\255\003\345\3045\001q\337\027\255\005$\027\237d"
+	.ascii	"\252\307\351c\322\223\351\22569L9\274\331\374'\350\214\3246\250"
+	.ascii	"'`xLMhlcCh},(9\021>(\241\3406&\021q\303cx%2\r\277!\303kx\242"
+	.ascii	"G\253\221\f_\264g\3506\246\220\020\303\017\340&p\213\223\215"
+	.ascii	"\326\203\364\313\220\031\323W5Io\341\245O\364g\035\273\360IE"
+	.ascii	"\337\324\027\236H\016W\234\355\325SK\261\n\031\346\003<\020\320"
+	.ascii	"\3027\237^\233\310eX\233\016\177m\365J-\30569F+\335\322g\031"
+	.ascii	"\251\361\350\215\036\351\333:v\346\350[M7\260\264z\243w\367\254"
+	.ascii	"\001\202\222\250\362\360\030\216\242\250s\b\315\b\t-H\2224\006"
+	.ascii	"\342\n\020\006$i \227\330\003\022@\2259*-#\231\221(i\rB\"\260"
+	.ascii	"\037\3061u\261?;\200\227\020G\\dB\251)\005\360\301\270~\356'"
+	.ascii	"?\373e\302W\332\277j\277\020\005k1\360Q\332B~\321<\231\340S\006"
+	.ascii	"\324;\375\3544\363\251\273\2240\206/?\202\205:,^\b\021G\365\004"
+	.ascii	"\206\231R\031\003\307\351\001I\342\303IgO\345\003\f`\2071\245"
+	.ascii	"\220\220]\220a\257\031(\340\367@\253U\370\177\321Y9\2633o,\204"
+	.ascii	"\347\357\200=\360\240\226h\341\005\201\372\345\263\005_\027\334"
+	.ascii	"\270e\356v\024\016\310\036\273M\034\237\234\202\277\330\177^"
+	.ascii	"\\\322g\226\004\230\320!\313K\375p\365\366\"\203C\360\353\333"
+	.ascii	"\222/[\232{\364BnD\371f\0258\304\312\234\340\261\204\002e\215"
+	.ascii	"\021\n\306+\331\3572*\237\215\3030\357\365\001\255\207\225\355"
+	.ascii	"a\265%\362\262\212\330nt\266\255\025^Y\221Q\231M\214\003\271"
+	.ascii	"wz\226&\253\247L\202\342a\b\177\301\032\247\271/\375\177f\\\035"
+	.ascii	"\222H;\223\216\337$\205#<\377\253h9\205.\365sK\302\272\242\007"
+	.ascii	"|\227\326{\310Q\032Bp\b\235\236\034\207V\302j\206\034\373Tu\267"
+	.ascii	"kp7C-\365\024\024\214\"\312\026\231\370\334\245\344s%v\255\204"
+	.ascii	"\001\302Z\nX\314\305j\242=/U\024\004\300\240P\212i{$;F\274\366"
+	.ascii	"\020\251\340X\b0\333\\@.\226\214\233\021\331\367\345\3464\026"
+	.ascii	"\231\207CQ\232H\274\tm\344\263\35021\277c\304=\314\361\351\273"
+	.ascii	"\b\344\207z\344\304n\202_\336p\324D\251y2>\212;\204\016'\236"
+	.ascii	";eO\274L}\n\314\200\006\344$H\027\266N\366|\3150A,M\234S\360"
+	.string	"\325U\306\211\f\300\254\260;\300~k~\360\367\032.\365\2707})A\300\f\375;\276L\322\265\026\b\031\262\230\216\017\334\367\226c\3110{\021\234dwY@\356"
+	.string	"H\376\027I\307\203[:Jd"
+	.ascii	"\002\3728pD\302\212\213\203 \006j\353c\311\366\263\213\312)\346"
+	.ascii	"\314\210\204\253\250\332\017LI\246}\336\217\033\372\236:\251"
+	.ascii	"\002\311\256\0250\306\230/h\f\212\357\270\3249\212\211>(\324"
+	.ascii	"~J\372=\020~\243\261\357\372\3725\fi\026\020"
+	.string	"\235\220\355\314&e\342\017\331XrW\024\n8\201'\202\"Yi\".btA\376\267\032KS\351k\"\022\227`\376Y\315\234\343X\rg\221\221\207^:\\\021\203\276\320\257\004\212\241\2534\270\034\241\ra\030\327#P\211Hn\030Hp.N\330$ k\272\351cv\250\037\310\200\236\236w=\026\313\337l\324\321\343\316k*\356O\031\236\244\253\261\3322\335\261u\213LIUUg*\257\235\267T\352\241\364\330\016`\253\226\342\330-B\005\367\215\352\373\"\231O\222\310\263v\277\326\264\320V5\322\261\264\",\035\265\364\265<\214\351,&\372\037-\357\373\205\234o\336\334(H\365u\002\372-\300\302\t\320\340\335\030\306\200\376\244\341\311a&\370LB\275_\347\270\267\027\001\350\330R\0232\216\357R\315&\335E\004(^\216\033c\272h\007\242\225\244%%\215[\236\331\263\245M\266Q\262\211w\273\214t\211\212"
+	.string	"DzW\267\313CE\302&\027K4E\314\221k-^\331\227\350!~\260*\215\224d\026\024Z7\204\274h%\244C\264\311z1\276\027\343F\353\205\202\321a\001\3601\0228\252E\330de\370\177\372)J4\301\004\004"
+	.string	"{d!(\301[\200\002\203\306\205\024\257\005\255\300"
+	.string	"%\314h\344D\352;\372e\002* \266\204\261f7Ys\314mD\224\2720\350\313\305`\366Y'\350&\332\005\037e\241\311\037\032\020\315*\355}f&6\355:\322vY\302\207f-\017,\247\2035\361\335\027Y7\0273\345\353c,\361\316\301\322\202\b\020P;\224\311\305\371%\302A\224_\341\367x\374\336\327GBh\326\365\343Z\\\3516\264\225=\224\237\373\310r\361\366E\016\227\365\301]\244\217:\307\261ox\273\336Z\204\033\201%T\330\263V\225\263\233\007\325\342\322\333\023\243{\351\360\3557Z+\0254\236z\240K\205d4m\344R\\\"f\206\217\377\002\210"
+	.ascii	"\n\ttz\022\365,\002\026\bh};\024-\262,\2713\322\245\213\227\204"
+	.ascii	"\376k\237xP\035\035\323\201\231\\\241A\025\034\243\317\347\243"
+	.ascii	"\341\367\346\005\303e\b7t\353\300\313@\263\311i\254\\\224\202"
+	.ascii	"\260\f\\&#B\341~^\250&\256\205\036\331\023W7Q\235VSY\"\025\251"
+	.ascii	"a\333\365!\353\252\305\326\2438\372\254\311x\320\220\334\t\236"
+	.ascii	"\001^\001\342\324\321 jG"
+	.text
+	.section	.gnu.lto_printName.285.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\257\001U\021"
+	.string	"\266!xF\340\322h8\222X\372\357\307\347\374\200\030f.b\002\340\341\214\272\021w^\345\251\023\336\357\331\365\204\236m\206>)_~1j\226\273\f4\0029\353\301\3413\004\204x4\334\257\034\200\212aP\034\364\233\354\275\245L)]"
+	.string	"_"
+	.string	"d"
+	.string	"{\363\021Q\341?\217\341\323\376\316U\314\316\303\301!\273$b\004\355\216(\027\b\377\235N\002\376\363>"
+	.string	"\374\347\231\235\243\244\303\322R\204\214p\272\244\335M\251\211\317\356i\316\374\222J\210\230\243\335\003q\005\220\263y\247\335\275\356i\223\273e\226Tv\327)\346>\334\337m\257\330\256`\347\0274\340\277\353y\024\365H1T\313\235=\322Rs\354{\273\273V\034\373<\177\b\246K\377\271\301\367\374\037\230\326/\235^\372\"\032~\330l\350\204\216\364\306\2707\273\037K\364\r\241\370\317o\377:\233\234 e\366\237\r'\332\2707\245#\017H;I\273\343\201\177f`\347x\026\263\367\320\224\004\bA\030Ptvk.\252\302\232\025\223\177\251\241\332+V^\364\t\2474\203\232\212\302\005\251\345\316\3634gF\313k\350\354\336.\312h\335\250\244\027C\324r\227\271\2734\325\034\037\306\257\024\200V\370\340\270\245\017\373.\340\025\324\003\301\r\331r\207\340/\\\034\024\355\356\002\373u\027\260p\367\246"
+	.string	"H\026\203Rt\"F\245c\006N\rX/\325\313\211\200\310\310\210\3145\243baA\210\271T31\254\221\226\026\313\013\354\201\f\346j\301\230\\b\252\b0\257\231\f\241W'-\327*\365\322R\275R+\231X\352\204\3040\030\226LJ\006\203\311\244L\343\336[\305qjII\204t\340h\244?dA\202\b\244\021;\027\302\232\t&\377TmL%v\020\325\324f\001\251\372\026\017\034"
+	.ascii	"\357bT\215goB$\275\276\017\263\220e5\210p\b,L\006\307c\320aC"
+	.ascii	"\234\210\206\2531\301bBk(X\337\013VqM,\230#\342l\be.\260\277"
+	.ascii	"\251)p/\230\232\002\334%`\300\242\312mW\321\003"
+	.text
+	.section	.gnu.lto_printBoardName.286.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\r\001\005\r"
+	.string	"\226\230XB"
+	.string	"\2216\035\037\n`X\221\003@(\272\260;\323Bv\"\331.\004'_\207\265d\322\024\303\276\021\221\263\024\267\001H)\374\314\364\345C.Y\265\370\016\034\021\237`3\242\375I\206\005R\243F\366\2262\245C"
+	.string	"B"
+	.string	"F"
+	.string	"\217\360\001\246G\203l\031\003D\313!Pqc\245\304\214\335\305\224\303A\217P\023\344S!\031\357\343\036+\034\212\254/\224\252\371:x\355\356E<Y\276P&\025\262\273N\357\233pO\267\315\300v\002\373%\001.]\226\354\021\227\272\301>\334\335\265\276\330\217\371)MC\230VMg\246\317q\240E\f\013o)\355\266\224j,)\256\360`\331~\332\007\361\020\240\307DpfW\003\213\024\273\243\017\023\250\036\257wL\001y\317\227H9\250G\001C\201\324)g\205\332\244\252"
+	.string	"\206O\002\202Vu\360\267\351QUm\260`H\311\222\251\264?(y/\365\0372t\312=w\227S{LW\221\021/BI\303"
+	.string	"\3561Qz\265$\270\230X\t\376\024\2708Zf\322`\304\223m\"\032\222O\266\340DC\031\251\274\001\351\224l0\223N\246a\033\317\007\003\351\360v\302\361`\017\266\315\203Y\243=\\}\261`.\220R\264\213\232\204\372\321Op\004\270\330U\271\347\240R\3710\360hwH\002\030"
+	.ascii	"\357b\314\304\003|\2641\356\022m\331(\326\310\023`\002\026X\267"
+	.ascii	"\t-NX\231\312\262\007\254\246\332\005\031\354;0\340\022\002\261"
+	.ascii	"\232\022\334%`\300\253\212\253\231\242\245\351M(e"
+	.text
+	.section	.gnu.lto_cliBoardName.287.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`:\004\235\036"
+	.string	"&x\311I\220XR\007\300@\\\361\204\342\246\221\310\317`$\374\241\227T\301X\316)\004\331\352\345\224@\345\324\244\377\030\333Y:0\330H\337\247\001\256AfG\261/\201\260\274%\007\225\326\330>\341\337\224\334\025\324\3068\354\226{\247\224R\267"
+	.string	"\250"
+	.string	"\262"
+	.ascii	"cQh\367\032\027\264\311\016jn4q\205A;s\003\351-\265\203$5\315"
+	.ascii	"\275UbH\35656`\004\2656\331\3305\266\315Z\007\260m\262\312|6"
+	.ascii	"\240\351\256\017\306R\b\275\322\356\275\271\247\321j\337l\250"
+	.ascii	"L\314i\315\362]\345\006\353\003fd]S\206\020\327\276\235\023l"
+	.ascii	"\006"
+	.string	"f@M5\212\314\361\344\302er<MIy\214\265\321\002\t\020/3\240^\364i\313\324\311Q8C\f\2267U1\274\240D\241\233\351\275\027%6y\211|j\201\022\231\374\313\032\247\033\303F>M\2259hI\2704X;\n\342\222\3739\341\336\313>$B5\31743#\231\371\004\363w\005I\266M\377r\013\n)%O\266\22759\341\370\267b${\373\017\026\231\322U\205\311\277\360\315\231G\fy\017q\377V\212Y\307\245_\271\377\366\357%\f\243\344I\226q\3333\377\214\274\207\3757RYh^\320\230~e6\256\376V\314\375\311d2\311_\305\\:\333t\220n\232\346j\306\365W\363\255\215\3356\353|Zg{:\233\245si\235\337t\366\322\271\007|q\211\223\212\025\035\325\345^\247$\230{4\225`5W\367Ww5\030\243B\332K\355/\244\276P\267O@\031s\222Pk3-\271\222"
+	.string	"\\\344m\242UE\0310d\336\352H\333o\036L\272\t\220\373\212w=\336\303\036\333\246}\022fbZQWY\322\240b\b8\356;\254\313.4Y\215\f\265\340\017\247\315\016k2\037\005T\356\r\366PC-\270\203\323&\3153o"
+	.string	"\362\036r\023)\3568\n\177\345\034\"\013\030\347\2026\177\346\206"
+	.string	"\267y\333\343\236\331\303\007\357\241\371\347\013\252\340\257e\201.J\216\366\255\330\346\313\267\371\220q\\\371\r\326\025\306\250p\315Nl\277\315\263\013\243\226<\371\020\214\\1\023h\377\375\214\306\231\203\204\274\207\377\275E\265\364\2533\026\251u\252\354Y\377.r\027\001\321\253]q\007\254\343\373\t\025\005\245%|\033"
+	.string	"\360.\203\216\027D\341G\347\263\2032\0160\001N\032a\007\204A\327!\345\300\333\375\374"
+	.string	"\361\244:\024v=<\235\005\236t\267\223r\360\341\361t<)0AN\221\217\350\217\204\214B\304\370\212\206\210|?!\236\210_\357\344\236\316\020Q/W4$\364\313\365\216\2009\235\0326\"\341;\312\22502:\312\241\306\333\345\375*\264XvT\372\245\362\336{o9^k\325\206eV\261\324\254\261#\323\257OvF\005iS\340\035\326P\324\0357j\217Z\020\t\247MfUK\3751\323DG7\320>Q\267Z\312L,MK\212\314\302B\317w)\251\216\307{x~kQ1E\tM\250a \244\f\204\210P@2\023\320(,h\016p\002\031*4\017\020P\tU\315\001"
+	.ascii	"3\253\036^\300\275\336t\033EzP\344\375\214L7@\266:\373\200\242"
+	.ascii	"\025#\005?D\234\270V\355'zr&+\231\313L\346\321\211\375\036I!"
+	.ascii	"\024\276[hC\363\340{5\343f\001\345\032Z\226/\032}\013i\257\361"
+	.ascii	"FZ\315\322\214\202\177\363\352\233\376~\326\301\267o\b\321\\"
+	.ascii	";\343\032D\250r\361\216A\262\\\270&\242\031\033i-\301\034 \240"
+	.ascii	"\214\352\253\367\036\037\217\324M\235n\360\213\225\272\252\367"
+	.ascii	"\b\251\260>a\004\273\363\375f5\370\017"
+	.text
+	.section	.gnu.lto_printManufacturerId.288.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\022\001%\r"
+	.string	"\346\230YC"
+	.string	"\2216\035\034>\022\233\031\b\nj\246\257\340\211\026\262\023\321\301G "
+	.string	"\331\364@\031\252\306\177#\"g\021\213\013j(\355\314\255\177\222"
+	.string	"(@\214\322w\3506\302b\356\277\0026\021H\215\032\331[\312\224\002C"
+	.string	"C"
+	.string	"F"
+	.ascii	"\324#|\007\365\350\220\375\"`\264\334\001\025\034TH\310\330\335"
+	.ascii	"L5<\364\b5C~\225"
+	.string	"\301x\037\367H\341pt}\242T\216\257\203\330\356>\304s\345\023eV\231\335uz\337\204\233\272m\005\2663\366I\002'\025\013]\236\354\022\227\232\301>\334\335\265\262\330w\371+MC\230VMg\246\277a\340\345D\205\223b\354J8\321XSL\321\341\262\375\264\377\341 Bw\201`\314.\206\025(vK \036`=b\367\b\356\214\344=c#\345\240\336D\313\013S\247\234\025j\224*\002\027\376\210\007\232\265\301\367P\217\252Zc\205\204\222'Wi\177@y/\365\036.t\312=w\227S\177PW\006\"Z\210r\206\001\374\203\252\364zE \005\376\020\300D:\0136\316\006:\331h\032\200J4Z\307\310G\223\300D\003\211X\336\204tH6YIG\243e\233\355\223\205x\330c\302\331\262\023\217g\313\256\322\036\256\262\\-0L(\332E\216\204\372\322Kp\002\260\330M\271\347\300J\001)\360\350\030"
+	.ascii	"\357b\314\304\003|\2641\356\022m\331(\326\310\023`\002\026X\267"
+	.ascii	"\t-NX\231\312\262\007\254\246\332\005\031\354;0\340\022\002\261"
+	.ascii	"\232\022\334%`\300\253\212\253\231\242\245\351M(e"
+	.text
+	.section	.gnu.lto_cliManufacturerId.289.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`J\004m\036"
+	.string	"6x\310J\240VN:\204C\360\340\202\211\217\375\300\002_\202\245\376Ct\377\334K=\322\262\351}P\322\262y\305\313j\237\314\250\374\265\374\260Ql\022\317Zpe\274A7\026K\233\363Bd\301\351\305 \375\223\021\351\023\225\021B\b\221;\311\265"
+	.string	"\246"
+	.string	"\257"
+	.string	"aA\314\356\03568\311\020N;D\321\305\301-\363\261\016D}\026\322\005\334+%f\344\336\341\003Vp\236\344\341g\312\223\347\007\224'Ye\266b \305]#\204a\001\273\270\334{mMu\36544\006\3464Krl\253\362\315\234\004eU|R\204\b\327\323\314\034\024\201\214&\250\307\220\345`z\2620\343\215\331\221-\317\301\0045\316,\331\b\236\214\351\205=K+\030`Xg2\232`\334,\307T\214\b\254\t\177c\215T\2143T\b\264d\n;:\241B%\333dLPcz\357\375\327\355\n\241\317Z3\347\336\3136(l:\00383\2231\263\023ss\0054d,\263\317\316>h\373C\224\257\327\277{\212O\224\264\356_\221\031[T\224l\027\006`\231K"
+	.ascii	"\331\007k=\206\321(\022}\275\362\233\326\335\005\374\222d\213"
+	.ascii	"\034c\321f\026\"\262\017\276k\236z\020\317\314\224ze\036\256"
+	.ascii	"\266\247\230\337\305b\261\310-\305<Z\246y\326/s\255s\355^g\332"
+	.ascii	"\207?JZ6I\313\245i\231\034-\217\245\345&-\333\321\362\0134\225"
+	.ascii	"\216%\026.\016u\345\336\245\242\227K$\221\334\270\326\357\365"
+	.ascii	"\255\1771\312\365.\365^'~\233\356U\214\205e\341\316\223\351\250"
+	.ascii	"\205$s\311\356\205S\001\375\253(\245^-\327\030p\013\246\247\210"
+	.ascii	"\274\354\363`\362&G\374*\316\351\330\007u\312\223e\233(\203r"
+	.ascii	"\346d\304\312\314w\036\260\265>\330\225`x\222\032\032\316_\317"
+	.ascii	"\346\344\301\236d\003\203)\367\376\036\344p\376tlN\3124s\207"
+	.ascii	"\036\373 \177\bU\013\"\260W\266!Y\362b68\331\265-\004,M\243]"
+	.ascii	"k\346\017 \354\203d\233G\242~\275\216eO1M\217M\263\022ckc\377"
+	.ascii	"\353\025\236D\0058\213\225o\232f\013t\362\331b\363\360\336K\206"
+	.ascii	"(\273-\026~\221\021!\316*>Ry\262\333\200\226\025OI\266h\357\275"
+	.ascii	"w<*m?\214\363\003$\"5\342u\230a\n\027D\354\344vzxp\267\n=\272"
+	.ascii	"\233\006\031\266)Z`\223J\310\365d\270yHyt\271\235\235\036\\\212"
+	.ascii	"C!\247\243\273Y\300\245\271\t)\317\006\235\356\206K\213\026\334"
+	.ascii	"\f\361\202\372\347B\217\327;2\332\371\2208\032\362\021\252\361"
+	.ascii	"\206\200\202xB>\272\037\241\235\311;\034\240\240\235m\b\310G"
+	.ascii	"\310\266\353\025\331pf\230\310\004\257g3\"\"\352\331\320\341"
+	.ascii	"\375x[\n\245\332ALj\037\217\264\033{^\265*\231\325\033*\016\034"
+	.ascii	"D\245^\033e`\017\3661uG\215\332\343\374\335gs\222Y\275R\177\324"
+	.ascii	"\232\\\375G\345\023\025\310\237\312\242\370\310B\263\244\312"
+	.ascii	"I\214\3316Jz\303\331\007\315N\250a,\204\220\203\306H@3\"$\005"
+	.ascii	"\246\306\240\002\221\251:\017\020P\351D)\fc\230u\256\231\363"
+	.ascii	"\277\033\236\371\242D\027\377\376\274,\013\034\267\201\016O="
+	.ascii	"F\321\210\365\264\017\3258\356_{\rz\204\240U\r\313d3\300\303"
+	.ascii	"T\003\021\b\305\274k\266\3119xu-9\030G\271\307\202&p5\217\302"
+	.ascii	"\331\r\244\315\307\2200\361\252C\315\355'\212\271x\335g\332\266"
+	.ascii	"#D\353\332\331k`\241\352b]\f6w\373A\242\224i\245\241\001'@\234"
+	.ascii	"\300\244\270\177\007\360\340O=\216\324uT\273{\247\354J\311\211"
+	.ascii	"\017\243\245\3431T"
+	.text
+	.section	.gnu.lto_writeSignature.290.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\317\001\005\021"
+	.string	"\226`qF\340\322&\035S=\343\353\335\264?\030\310%?\367Ne&\315\202\274\244\231\340\335\214\017\0052\300P\276\345\365\033k\276w\027\320c\005MC\fF\020\303\372l\254\1776_wO\030GK\2425\364E\322\310\336R\246\024\\"
+	.string	"Y"
+	.string	"["
+	.string	"\005\270G\177\027\331\036\271\017\330\036\335\262w\020xYW\003 \033\257Y\321\356vjc\324\341w\303l=B\315\226\277sx3S\003&s=\302\027\231\030:\311^ \204W\016\021\247=c2\227\204*b\256\247=\336\310\324`\262\230')\302\356:a2\230{\273m\226m\tv\002\b/}vsO\2234\275m\351\030\323\020\2465\323\251\351\20700\362\031q\231\036\273!j?6(\316H\361\331\355\273\360i.\371<\177\321\372l\344\013\263\377p\003\204\203h\367C\360h\007\334#\n\276d;?\026\037\n\236\366Y\274E\353:\035\036`\227&\206\214\335\217\304\001v\212*\0173\312S\22775)I\377\343\341D\335\364\371\221\215\323\250p\310[\241\n\365?\257#\037\006\207\f\034\n\237e{T}\254DK\326|-i\352=\034\227\254\231\323\353i\247"
+	.ascii	"b\246\347u\324\2225U\"\235\023$Tk\354\317\225!;7\204\2544\366"
+	.ascii	"\351:\277\351\337\003\336\260 \201\201\230:\310\2125\001e\245"
+	.ascii	"\201e\242R!\265b\362II\352\302I\247\2222I\351NV+]\211\210U\030"
+	.ascii	"PV\035K\245Zu\245o\277\363\307lh\004\265\250K\324\032\203\344"
+	.ascii	"\350IcN:v\036<:<\244\321\341\356.\324\232\223\n\030\222\251y"
+	.ascii	"3\246\204\372\236\373\244H\204v\275\303,p\336\203\003\217$\r"
+	.ascii	"& \200\002\2423\356A\265\376\030\341h8\271\020\003\013Z$\316"
+	.ascii	"z\323\261v\232\005#\374\306\340\021\211@\3418\334\r\372V\177"
+	.ascii	"&\331\004oE\361\231\242\200A{\242\354\013Dk\374\312\301\312\020"
+	.ascii	"\231\354\256E\323*\336\330Q\004`\345\264K\260\b\356\025\313\361"
+	.ascii	"\300DL\327z\002"
+	.text
+	.section	.gnu.lto_cliSignature.291.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`z\n\025;"
+	.ascii	"\nf\324\026?@dN:\257\273\272\271\374\325\212jN\300\272\nr_\240"
+	.ascii	"\207)\357\332\023a2b\337\333\354\350\303cB|c\260C-\002\214\320"
+	.ascii	"\277\372\217\001\257\374\365\027\202X\352\343\324\365o\322\b"
+	.ascii	"!{'\031R\001A\001]\001&\330\253\177\233\303\371]\023\373q.\247"
+	.ascii	"\375\234\036\317i\371E,\355)\n\3149\217`\257\"S7\177\323\336"
+	.ascii	"\316\307\243=IZ\354\325\233\221_\363\272\366l~<33k(\352\026\230"
+	.ascii	"\263\263\301\325\226\300^M\213\374\250\346\322\001I\344\340\267"
+	.ascii	"\373g>\327\036\215\220C\345\234\005O/g\272\007\215\200\275\332"
+	.ascii	"t?\256W\331K\255W\273\355V\004\240,/'\354!2k#)\347\234\205\267"
+	.ascii	"4\362)\335\233\275\355\251\216SRQPON"
+	.string	"\306b\023\221i\310\nW5\255\302\267\3553\241-Ou\264\272\222\326\345SRQoP~\316\266\024\031\347t\273OB\270\267\276\267;A\253\\c\234\023\352\347\\\273Ee\024\216\321\2254.o\232r\211T\342\234R.Sz%7\351\316\375\234\3204\200\2332\267\337\335*\316\031\345\016\323K\222\222\350\032\314\004-\271^\331e\205VZ\322\236|M\361\2327|F4\2634\303\\\231\266\3631\257\372\273\203\200\253\362wF\360J\032\334\323\023y\362\252\224A \035H\367szI\217J\2724\311.N\003\254\361ar\275[\3719\241\244W\200\260 \372\335\357\031\332\330\275B\0169\347\276M\264\2647\200w_\256\273\003\273\3316\0018\305\270\017S\314\030\306\370f\227\356\025\254G|\361\371\236\342\016\372\207\0317v\007q \032+QT\252\333t\357\350j\205\217w?_\016\376rf\276\271\202e\302\300\272\232"
+	.string	"w\267xq\337\354\037\332\022\251\317\f/\217gs\372\244\370\331?\003CY\257\ngi:7y\207\352"
+	.string	"\311\356\244\r\216\356\3400~v\217\325\ncf^\241:?dwR\373\270.\260n\367\013\206*\3119\217\255\360-\231]\"r\007\033\352\"qw\f\031\367\315\343\337\375jz\346\372\004\003\311\360\262\233ny\361\023Q\033\031&\215\263t?8\232?\301\347\274\255N\367#\237\367>\032oO\025oK\025oG\031oC\025o?\025o;\031o\033\233n\027\215\267\233\212\267\211M\267\231\210\267\207\3676\313t[xo\257\302\333\352\275\235\016oc\366\366\025\336~\007\374\246\246$\211\332\327\026\345\254d\260R\356S\353xy\235\377\316\237\367\263\371\355\3769_\273\351\364\367\316\327D;\217\266\277#6l\2136\277\330\253"
+	.string	"\360\245\326:@\236\262_>\032\\\024I`\316z(\330\343\365\365\232x5O\201\221\271\250\221\300\234\351\002\177x\267H\353\344Q(\024\226y;\254\253\307\273\314VJ\002*,\363T\344\270\355\211p\215mZ+\003\240X\332g\231\021_\216[\236\2761\274\354\253'\215\221&\374\354\006/\342;\306\301E~\304\332\004\247mk\337Z\270\373f\021\037\f\233\0020m\230\373f\023\376\243\313B\261\344\204\250\\\211\370Z\352"
+	.string	"\257nwK\246\225\273o\022q\013\2661\274<\200D}jL\370\251\347Q/u~~\\\027XwO\305"
+	.ascii	"F\345\234\030 \331\351\r\361\263\207\223\326\007X\235T\325g\013"
+	.ascii	"\230v\266<\3159g\026?\233J\017\235K\352\212Y|\326\303.@<9\252"
+	.ascii	"\313\364\2505\003\241\235c\231\317\310!f\302\367\316\354R\277"
+	.ascii	"Q\030\030\227>\220\365\352\220-\224\250\215\357,\212\200-V\f"
+	.ascii	"\t\361\363\001\276\336S$\202\3461\327\200\324\021Ks\276\262!"
+	.ascii	"p\315\035l!\356n\257\303i\323\020\2006\033\251X\210\235\356\332"
+	.ascii	"\336\230]\"\022U\033\374\262\342\347\212\373\210\200\f\200\026"
+	.ascii	"\270\372+u\206^\347+v\001\370F\360\211\201\373\204\347{[l\022"
+	.ascii	"\304}S\305\230\222\033\225>\346\301\326A\347\003\233\372\313"
+	.ascii	"9W\270Wm\270y\342H\300\275\037\261\246\370x\316W\202\352\257"
+	.ascii	"\331m\002\005\0066&^6\306\310-v\205,6\004$\017e\n\247N"
+	.string	"v}yiq\201\020\221\202\251\261\304\256\260\220\027\222_$\264T \275\270\222]]_[H\b\036\222 \270\222\035\220^&\270\270\264\266\220bW\fz\006\327\227\211\017\310\256\244\327\226V\227V\210\255\001\275\300C\322k+y\202ER\001\222\306\025\362B\b/\020\\I\022H\017\"Hh\251\340\022q\240\373\352\300\241\344\221\322\bSb\260\207)o\340\341\016\036)\224;z\360\220\021V\003L\254I\031\006vC\211C\006\027\r\0343\204=\003\002\330\215\031Ya`2pd\315\330!\226\005\341\3309t(wd\361\310\221cG\0261\237\003\021<v5\252!\276\223\347hm\356\021\342\024\2719\376`\343\303n\312\003\026\333\020\301\252\277!\224X\346\003\r\2614d\360mI_\031^Z\230b\344\215T\204;5\205\177\310\315R\337\002$h\252DI\341;F\n\037\214\2000v\230@E\341w\201\022\205Y"
+	.string	"\372\241P\b\332\366\264\341\036\357:i\307\f@\313X\346\367\260\256v\267f\255\221Cn\202}dP\005\240\260Q\017\037\233`\340\257\\\235gA"
+	.string	"\371\224qt\305"
+	.string	"Zsz\302\227\220\205\253\244E\273o>\341\313\261\221\341\345\025n\241\343f\304\317~\245;\341\367=\273G\224}.\335.i\233\3347\333&\353U'\254\003\220O\360\t\325\022+I\212\377\023\200\322\250q(\303\030TH\211\214\210\214\264\240\240\031\003\200\002\221\251\262z\022"
+	.string	"\326M\210Q-\250e\377\331\f\3070\312$Z\350\f\3640\304<~\245\200\331\207)?l\030\363U#\037f\342\330\255\201\366a\252t\002\006\0165\305\004} Y$\246\325\0310\bD\177\002.y\354\331AX.\315h\336\336\3437C!\236ON\032n4\346\253x;\213\217\251P`\276"
+	.ascii	"\025S\254[\366\033\230\371\233K6_N\353\371\2538\316D\374\004"
+	.ascii	"\034\260q\r\306\274\"\022e\307V%\r\343\215*\306\353z\225\327"
+	.ascii	"bQ]\032\317\b \263>\2473W\230\017\332\261\336\034\024\215\317"
+	.ascii	"\336\222\370\342\037\026t\020\256\255,\312r]\3358_E\267\256U"
+	.ascii	"[I\2513\376\027\030\02752~\347\204i\273\266\272G@LT\207]\247"
+	.ascii	"\221\005\355U\207\267\355\260\266\bS\233G[\345\356\324\210\024"
+	.ascii	"\264\212w\240b\346u\271\3667K\022\256T\006\234\003\276\270\334"
+	.ascii	"P\3149oo\234Nv\005_\030<1\016\212\265\232?\350\bt\006\337qbN"
+	.ascii	"\266g1\006\262\200B\266g\355\237+Ezh\322\036RG\324\353\270o\330"
+	.ascii	"@\321\343\270/\237\343\300\246\321\351\314\234\301\206\004<p"
+	.ascii	"\302\310\313W\245\226{9\377m\203\376V2\361.N\272\b\330\241\b"
+	.ascii	"\026\306\222@\365*\007\034\355p\004\207\001G\3265\360\027_\317"
+	.ascii	"(\266\3651\367F61\263\3343\t\244\n\333<Ov\0233d\306\245(\224"
+	.ascii	"\300\376~\006M\020\312\037\354\036\004\351\034\327\200\206t\243"
+	.ascii	"_\324_+\215\032"
+	.text
+	.section	.gnu.lto_cliMcuId.292.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`Y"
+	.string	"5\t"
+	.string	"\366\020@: \221\323\001\244 \004G\203\027\342B\223\02730\f8\032c\n\340ftA,:\032\2316-\3200\254\t\230\376"
+	.string	"\251 \320@\306\206\317\306\325GP\240\021\211\252\233\304\356\235R,"
+	.string	"/"
+	.string	"."
+	.string	"\027\320\236Y\264m\b6v\f\301bX,7\273[i\310\305O\321\177\312\001\310\326\370\2719\354\256'\331\362\270\351m\033\330~\260=\023\246!\022\216\217\213\310\354v\344\340l,\203\031\261\375\316\366,/j>\237\366Kn\"\376\004\343\001\273\256\026\227\335R\301\007\3343\227\367\264g\\\031T\303\333\2347L\373\334\363\253|%\345\321\354\256N\252\270\025C\3023\233\302b\236\264\347\205\022c\321\321.\307IA\354wvwM]\016\256hX@(\030\201\021\252/\034 \231\300\022)\024A\214\302o\363\007\002K_5\201\242\260~\250T\005y>I\220Pu\342tB\325\256\334w\226\272\334\275^b\001\016"
+	.ascii	"v\264V\302\277\213!\023\317\374\242).l\273\006\261\302x\240\032"
+	.ascii	"\270\002\346\006\250(\340./\332I\006"
+	.text
+	.section	.gnu.lto_printFeature.293.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`H\b\235/"
+	.ascii	"\232W\344\022HpZN:m\004\200:\262\003\035\022\307\030\234{T\376"
+	.ascii	"#\363\033F\271vC\331\214,\207U\352,\230\031\321Ph@\t \261\221"
+	.ascii	"\202{\221\222A\345\201\360\203\032\265\213\232\305?\2671R\212"
+	.ascii	"\366uw\267F\b!D\356$\003\036\001\b\001\023\001O2\220\215 P}\312"
+	.ascii	"\224\261\n\311v\001\233hH\r\353\243\360\337\030(\305\205\021"
+	.ascii	"\013\311~\375\232ga\324\326\260,r\301Q\316\260\036\275@fn(g\243"
+	.ascii	"z\333\213\"\221\305Z\323R\001\271^'}\002\343$\262X?\212\030]"
+	.ascii	"$\214\2758\226\205R\304E\353Q\376e\276\332\231P\275I\f\366\261"
+	.ascii	"\254\017*q,\213,b\241\365\250\361;\351\321\363:\351Q\246b&S\314"
+	.ascii	"b\253 ,\355Z\2665,\313\036[\310\220{~\"\317iS\035\300P\030\004"
+	.ascii	"\376|\253JL\321\263/\025\337\355@w\311\252\003\340\241l\357P"
+	.ascii	"E\n\002Fv\341\216\007\305t\\\340\217\017\260\034\377\235\316"
+	.ascii	"+\307\343\306\256o\307\327\270\377\320y\211\235F\226e\257\374"
+	.ascii	"\017\022/\034W\275\025\331\211\247\232\325uv:\257!\347\021\033"
+	.ascii	"\274\271\277\375r}]\335\364w\304\306\321\032?O\005xri\206_Y\347"
+	.ascii	"N\327\331\026\360\013\353\366\337\256\300.\315Z\335\333\227\215"
+	.ascii	"_\025\211eY\276[_`g\2343\037\0033\267`V\263\002vzWun\267\201"
+	.ascii	"\226&\354\3542\376S*\241\241\326\354\260.\033>\334\227$\236\326"
+	.ascii	"\"|\246\364\250\204\376\333\317%vj\256\352\340\306\254\356^\273"
+	.ascii	"1\263\276\232\203\267\250\027\234\250\231\233\234\356\267\216"
+	.ascii	"\2753\246\005\231\207\247\325U\314\310\252\333e\314?\032\302"
+	.ascii	"\006\217\033\b\263\005\n\237r\236\340\273,\341(\302\345\316\017"
+	.ascii	"\216\374\215\376\344w\340\273\334\340\370\266\277\350M~\242S"
+	.ascii	"9\017]\312Y(\b\350\347mgc_\366Q/\367\254\227\017\250\227\r\244"
+	.ascii	"\227\013\244\227y\322\313\004\322\313E\365\362\200\365\262\200"
+	.ascii	"\364\362Nz9@zY'\275\234\223^\306Q/\023\373\362P\275,\\/\007\323"
+	.ascii	"\313\300\364\362/\275\354S/\257\353eU\275\234\246\227\321\364"
+	.ascii	"\362\251^\356\364\362M/\037\311)\271\366\205my\327uH\266kO\217"
+	.ascii	"\355\202\316\241]\356\247\362O\371\245\374d\226\343\317\r\233"
+	.ascii	"ia\324\326\3041\003\225g\301\330\3130[\276\301\203\343wO\242"
+	.ascii	"\370\272\214\257\236\223\255v\3552+o\020\367%R\203\276ro\255"
+	.ascii	"\016N%6\020\006\276\241\026|f\313f\253\274g^\250\271\370D\215"
+	.ascii	"}\267\373\210,\307\264\312{\354\237\346z\207t\330\267"
+	.string	"Sr\272\016+\313b\035\361\273\334\313\207\363E\2162\210\244\364[I\351\321a\0020\314$dL\346\254\356\336O\226e\331\264\313\370\311\373\304,\363Z\345I\241\371\354\23766\027\363\357\"\025j\013I3\316\312h\221]\335\275\213\246!\206W\270\030\311\303\313\271\303\346c\021\341\013\302T#ScY\255o\215X\265B 8*l\242fVZ\272\337bc\333U\034l!\260\203\375f[\345\327g\003\273\270l\305|\375k5\331\206\371\272\247\211\306l\307\202\367\247\327\246\320S=\324^\317<\332j\277\235\233\320i\253fhJ\276\213\024\355\t}\335\264U\316\276\215\266\332l\305\272\317~\373F\250\211\336]\\j\351\031\365\373v\332l\303\256\356\036;\350\367\223G\215\004\0345\004\344\250\241\"#\023\324\224\224\022\223\211\340\205\250\024JS-\230\204M\207\222\372pBES\t%&\024?\251\024SJ&\230J"
+	.string	"\235\242\224\236N\247(\245\r,\236\246J\254\274\304\240)\305\322QE\223\322\323q\t*\352\310`\207W\260`\202:J\255X\001u\004\"\3317\020\267\257W\314\030\311\303\263\352+"
+	.string	"]\306\3007\341\321\320\022\342\231\037j.\026\0025\237\304\237\016j\256/\367I\362\346\030\237\276r\315p\356\276<&\215V\031\214\320|\256A\r\264\345C}\2244\003M\215\320\027$K\017\003\027\356\214G\227\033\324=\021:\306\201\356\351\037x\320\006\372g\226\246\246@?\350\326\302\3238]\240\213I\002\315\323*\033\201\376\334\3213wmkun\301\242Q\343t\261\201\311\264\272V\f\230s}\232_\267\341awP\3228\254Z&\020\034\035 \240\007\354\264\200\276\311\266J\200\306\351\235.\242i\305t:@\253ht\232\307,\215\3312\334\2156[\277.\313\351\373p\3208\235\323\335$6\316P\023\235\330\217\273\207d\232RK\357\352K\200\222\250A0\303\034R\306\021\022\021\021\021\322$\215\001\220\002\221\261\"z\021`\265$vZ\230\202\244\003\240w\221d\324\235\217ft\005"
+	.ascii	"\fBR\367\211\335\201\323o\2239\263\nW\006eQ\304\242\004o\241"
+	.ascii	",\231\3620O\026\375#e\251\344M\005~\024\331\247\267\260H\314"
+	.ascii	"Y\310\340\340*\364\346\213\303\\\301zA\251pr\223\270\217\341"
+	.ascii	"7\237P\214\370\210Dd\220cA\311\230\316\276\304\314\361\034\251"
+	.ascii	"g\026=b\020vh\007\221\247\032\312P\301\305Z5\204I\3704\013\314"
+	.ascii	"6 \034\351!!h\256u\343Y\372\203\022\370\034\020\2621\233\341"
+	.ascii	"\344\305n\354=j\205D\032\032v\n\r\322\353\355\020\"\355a\030"
+	.ascii	"\231T\302>\366a\276\017a\245\304\351\2046\376G\025\333\2003\301"
+	.ascii	"\264\347\203\021\023_.\266O\003\312\352!\204\357\251j\222\361"
+	.ascii	"\213\032\300a\325yklK\241\203L\\i\237\300S\007M\346p\202\366"
+	.ascii	"8\331\n;\023T\207\236?\320\nP\n\334\3043\252\301\033\300O\032"
+	.ascii	"\266\235\317\310\315\244\337N\025\036\r\202Uw\201\354v\013h\235"
+	.ascii	"\375\354\371HZB\236\304\371\222;\025"
+	.text
+	.section	.gnu.lto_cliFeature.294.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`8\013]="
+	.string	"\232i\324\027A@bRc\253\237W\246\300\177\317\264\344\330\270\210\354`\372\306\231P\271\350\2172>\251\210\212\356\320\376l\361a\247,\301\310Fd"
+	.string	"9Q'"
+	.string	"cy\b\224\003\320\320\t\352\342\240\355\266{o)\223\fk\001P\001q\001cn\227\213u_>\254S&\024\036\346t\360\305\350x|\026\377\007\226)[5\216\245\n\336f\b\357\333$\253\245;\250\013\256s~\334\345\340\317\361\3701\216\237\230\321\213c\351T>\360\276\315\322#\335\267\357\225\334\267\031\316\271O\200\261\030,\3024\3159F0\216c\345\216\302\026\363\323Y\351\263\022\013\337\251\211\300"
+	.string	"\001\001\230"
+	.string	" \227\224\222\216HGF\243\242\"q\370\n\335\226\335\032\316\007\273S\2209\2758+\2243*o\342\3730\332\227F`\300\227\013"
+	.ascii	"|za\223oO8\035`K\037\331\037\246.V4\200\270\267\247\233F\022"
+	.ascii	"\333\346\376\226X\013r]\244\034\360\331\306\3560v\323\363U\321"
+	.ascii	"JkgT\2364\345G6\201\332\033\"\007|Na\221s\234\354y\032)\032\251"
+	.ascii	"C[\034\2368\353\221\231O}\021\214\203\203r\246\344F\265\033\251"
+	.ascii	"\275=\323t\321\001\237K\3140\321\305\250\2653%'\262\017\306\004"
+	.ascii	"\227\034\360\311\306\026\r:\353\374\355\211\246\207v\217Z;\223"
+	.ascii	"\373\3732g\365\250l\230\201e\260\020\271\360\310]#\324Y\2046"
+	.ascii	"u\313N\030\254\356\031\241c\254p\314\314\355e\036\365\366D\242"
+	.ascii	"Y\"\337l\202j\032B\007|&a\221fnd\267\273.\2032\265\026f\210\343"
+	.ascii	"8k2\350\331\363\323s\326T9\347\265\234\207T\001\371q.G\004K\242"
+	.ascii	"\204[\302}\253\367 \225\r\334^\230\276\352,rP*\013@\377\356o"
+	.ascii	"N \331\342\270y\262\024os"
+	.string	"\204\324\212\026\372d\371xnk\376\242\362<\t\263w4\177\271N{7\341D\241\313#\246\007s\316/\336F\307\024[\034\213I\310g\363i\214\374*os\225\225>\231\225\373\026j\253\240\252\201\233\373v\332\037\344L\024\246\257\331H7\355\234i`\351\223}\337\3567\202\026\250j\255\212m\260\234\245L\275\243w\300\214Y\363~\222\363\003%Q\347\251\317\375\t\256\367l\240@T\362b\236\241\\\235\237\234.\375\233\226\216\346Y\351x\317I'\363||\3353\322\245\317G\337{6\nu6\022\352\\t\235\213\256\316\304\353<\034\352\374^g\241Pg\367\325\271}uf\205:\357\353\254]\235\037!K\r\035\2351S\265\035(\215\315\256\207\342\277v\317\312\367~4\277\336\217\367\223\371\305\374u\027\346\374\234\277\227\317\227\213d\212|\346\356\342\004\363\236&\027\337\352}%\305\2441\224x&N\260\303\3736;\210"
+	.ascii	"\037\215W\022L\032\233\t\333\344\356\342\0041\274f\330\370.f"
+	.ascii	"\333\276T\343\272\374.\277\f\231\037rS*\027\336\267\373\001H"
+	.ascii	"\371^\256\322\260\3114\2163\357\030\365Z\247L\234yHN\033i\227"
+	.ascii	"=\215\2418\307\344\316,R\323>\332e9)j\023\203\310\025j\2525x"
+	.ascii	"\323Nn\025\324>t\201uZ\222\362\366\232\034wt\352Z\356\273\271"
+	.ascii	"n\355\240\265c?\315\3316T>\314@<4\t\200n\246 Y\245\326*\363\310"
+	.ascii	"\316\223\266R\016\323(\334?sB7\254\024A \304)\305hGs\rw\352g"
+	.ascii	"\016\350F\215\267J>L\305};\265MP\353\320\005\342\241\205\345"
+	.ascii	"\252\027!pEF\345f\362+\324\207\370\276'\355\2629\027\262x\325"
+	.ascii	"\217p\337\214\034kN\324FdL\221\017\334\206d\263\3626\257\f\031"
+	.ascii	"\005j\006!*\270\273{\320\345\221\322O\373w\327\003gy\341-o\023"
+	.ascii	"\206\324[\230\013\f\247O\346&\321\271Y\377\232\033,\037]\257"
+	.ascii	"\327\353"
+	.string	"\263\033\367\373ig\355D\222\305\254\231\303eX@\347\f\313\301`\200\370\025\272b\2552\337\035\375\227{\334\017\366\317\250k\350\002\353\324\246\b\241\264\336\307{\235\rNx\250\336\346\n\017\0374\236\333\237\2771\277(H\352\334\035\355{\253\007j\263\273\335z\220\023\tS_\363\336\354\2763\321q/\370\3369\250S\272\300\272CL(\037\037)\355\216\346!\232\360\301f\362\0334\267\337\367\343.\343\341\352\375\265\354\342\177 \3368\026\233\020\371j\231%\243j\213\352\315W]X\034\206\271j\313\253(S\211\3200\"\311\341C\b\r(F|0\312]\b\222l\256\220\205U\225CC1\343\350\302\312js\262\013\001\233\223\025\256\226Y2\252\266\250\210K./\034U\313\031\302e\016\033ZK.\027\353[\313\254]\243\253J\213]nae-\265\252F\\iY\t\263\025\003\254,+\345\026V\225\226\322\212\253K\311"
+	.string	"\231m\334Xr)q\330\260\301\245,J\303\006\237!l3\007\235\226v\001At\233L\332\0235M\305}5z\310\006\250\037op\177c\033\214\300\023.\013\3626\217\246\305,\313"
+	.ascii	" 0\024j\310\333\374s\277\251\375E\320\006\216\300I\250oi\177"
+	.ascii	"D4Y\f\t8t%.\310%\201\204\002\370\200\225 H{\233g\302LZ\360\375"
+	.ascii	"F\334@\237-\226-\210\230X\344\3226\356\262\017\232\352q\346!"
+	.ascii	"\207\273\270\313\206\377r\215\273\255\253\343\304h\033\330\373"
+	.ascii	"\214q/\270\321>j\003c\327<\304\324\327\001h\322\002\001(\332"
+	.ascii	"_#\356\341>*\332\311\346\006\313H\233\270\211msWg\242M\207\032"
+	.ascii	"\346\016\251\324W\243\231\260\023\006x\242o\323K\352m\202(\260"
+	.ascii	"\224%?DW\254\325&\"r]\226\232\nl&?DjI\357\373\322\020\205\216"
+	.ascii	"\257\303}\276K\261\221\303\246&\267\307\306q\034+\355h>\226\351"
+	.ascii	"\033g\336\361\367r\275\246}\316\274\200\325\250Q$\005\231c\206"
+	.ascii	"dFd\244)L\2411\240\002\021!+v\021@\255D\222"
+	.string	"\315&\231\346MP\221e\252\334\251\231\313?]\362/\235W\310\002\316\243m\355\2419\262j\336v\002]Y I\314+V\311q\244\355\222)\350$\216\337l\305\227\250\r\002\013\264\264\343U\0378<\024\355\354h\244\245A\274S\205qJ\001\2420F\337b`\262Z\025|\320\327t\257\304\020\3722\272W\217\275-K\204\274lV\366\236\347\023F\342_!\\\247r&w/<\333sp\237\311F\3363\013\232'\220\343}\374\263\230\201\032\211\367q\026a|E\334DhU\211\034\326]\274\342\326\231-*X\036\261\245\372\321\214\347\317\306\320\221D6\214\267\b6\\\333\271\b\266,r\363\220$,\256\332m\310\376\016\300\211\332\370\240\316\272\24550\b9\376w\276\363l\301I\017k0\213[\236\263\341dO\240\351\262\303B\3051i\2656\2769 ,\207yc\021\023NE\013\273BfL\314N2\230\b\257\356"
+	.ascii	"\212\242\237\316v\224_e/u\323\2673\226'\2232\241~!\f\246>\273"
+	.ascii	"\023\001+\367\234\226\351\361\r\252\006B\204\206T\222K\234\370"
+	.ascii	"\343\030\033\303\r&\200\013T\230\b\n\242\214\201\006\230k\236"
+	.ascii	"g\2403}!A@\374\210\272M\365\327\325y]\201\351\013ms\b<\b\357"
+	.ascii	"\313\2760m\367\200a\322,\213\205\336\266\224$\332j\332G\220\370"
+	.ascii	"\314\267j\300h\325K\354\257\366\017\255\003-\013Z\215\246\364"
+	.ascii	"\222?\257\360\303\317\343f(Ewm\023\233\227\202c\215O\306\\j"
+	.text
+	.section	.gnu.lto_cliRxBind.295.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\343"
+	.string	"\335\013"
+	.string	"\246\025OA O\234\016\303R\200\304\001QH=\335+Vf\324\036\244\006\3474\200\243`\316\245?\246\033{0\263\237#m\262\255\317,`\022\004\213\026\360\200C\306m\354$\203\0074*\\\307\260F\264\311\226)\005<"
+	.string	";"
+	.string	";"
+	.string	",>*\354'\200T\2620\342\305\356b\222\303\275\317I\252\347K*\0230\374>5\302\317\247\352si\205\235\tdw\017\342z!\344\250J*\273k\005\303\f7u\333\bl\023\260o \247.\376*\325\237\f\220QB\303S\250\330\3050#\306\216\363D\007\333\267l\253(\2414r\265\357\341\037\274\213&\234c\02742\261+\002pH\365i\361\024\352\263z\007\365i\317\016\225'\200\310\247\275)\370(\324b\354|\323D)iw\f\364\240'\225\216@]&\020Q\352(\fSj?\200\240\007/\217\"D\0329\362\263\305O\345\006\373\323\356\256%\310\276\350\001\276\256\013\303m\027n+`i\334\226\3214\226\003\027M&qvm\231\f\3436\213\006\3136\r\260\213\342n\201\266\301\034t\335\006\263\304\375\264\022d+\344b\244 9sC\037\342$4\217\025\273\236\203\230\031"
+	.ascii	"+\341\337\305\220\211\227G\243\341!&\314\212\260\352q\324\202"
+	.ascii	" \266B\211\007\311\200IU\273\372\202}\344\032\320\nC\203Bp\031"
+	.ascii	"\030\021\240\242\004w\t\030\330\324}CM\336\256R\006"
+	.text
+	.section	.gnu.lto_printMap.296.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\256\005%%"
+	.string	"jB\324\016Gp\236Q:k\267\372\016\252\303*\306\021\016\333\273\001\025\243AW\201h\265F\b\366\345C\013\371z\263\356\334\300\375\210x:\244V\325Sd\235\317\n\026\330\006\006V^\342\023\227\244.\235\271%z6K\b!{\357$\003\327"
+	.string	"\314"
+	.string	"\332"
+	.ascii	"2\206\002d\341\226\326\004\213\274\026\340\267\310\270\200\234"
+	.ascii	"\217\244=P\1776R\275\355\376\225c\001>\313\214\256\345\214\005"
+	.ascii	"\006,g\344\203V\240\376$:\016\375\211/\204\376l`7s\250F\016J"
+	.ascii	"\020\373C\354\202\226s\316\335$\255\036#\3375\013\374m\265\325"
+	.ascii	"\324\024=\361\265\300>\316\242SV4\006\177+\302\242\n\362\025"
+	.ascii	"\037\200\263&\312\337L\005\301FA\212\204\371\223) \326\206\323"
+	.ascii	"\034SV\030\311\254\314\352\312[)#\r[CB\365\343*\026U\325S\037"
+	.ascii	"Gq\203+5<pn\214\330Y\215D{\006\031\207\230(\347\274\032kX\214"
+	.ascii	"\205~x\311\371\233\251*\354@\016\024\253\325(\264\367\312\203"
+	.ascii	"X\3420\303\242\372q\233V\3109\267-\032\251\336@\357n\262\356"
+	.ascii	"v\321}Z\bQ\266y\275\344\340\243\274}\263B\367\350\003n7o\205"
+	.ascii	"}\021wq@\224H>w\2067\330\215\f\332{\354>\222\331\220I\337#\335"
+	.ascii	"FE\337\362#8\227\177\350\\o\334\271~\241g\371\007\250\266\201"
+	.ascii	"\336\365\276\255\266\203\275k\252m\025\265\235\252\266Q\325\366"
+	.ascii	"\231\332\3065\333W\265mS\333O\300df\013N\027\261\264;\007\231"
+	.ascii	"u4\375\3446gX\223w\375^\277\230\037\354\270\373\377\362\257'"
+	.ascii	"\257\3545\202\004\340\301|DAd\326\201f\261A;!\346\207sU\322\322"
+	.ascii	"\206\223\022\352\317>\230\207\001\336\353\367<\314\257\"[\336"
+	.ascii	"\270\223\363\324\007\365\347s\200\013\241].\210\204\310lL\277"
+	.ascii	"\306\300\256\240\345\214<\372\331\035\272/\027\214\262\f\\\002"
+	.ascii	"R\215U\333\335\2115\211I{\251S\312\331\224-:8\347\234k\367\330"
+	.ascii	"W\376B\304\306\\\245E\267\361]\257\355w\201\336\256\321\r\312"
+	.ascii	"\032+\033^\321\260M\253\336c[\364\350\253\326\351\340@W\252\033"
+	.ascii	"\350\026\335\273D\323{\304\326\206\224\251\035\350=\202\357\357"
+	.ascii	"\0052\241\355\363\0179\n\211s\336\207\256w\225r6\007\352_\275"
+	.ascii	"\002c\350\262\210\007\337s\215\211\334r\303\216\001\276\277\302"
+	.ascii	"\364\252b\263\200\261\322\205\357q\314\207.z\206e\213\216\320"
+	.ascii	"\366\351{\273;\306\223\275 %9g$\374U\304\223&\204\3723G#\002"
+	.ascii	"\217 \201\276H\002\375y\257\004\262\260_{OL\213\262\315\245\233"
+	.ascii	"1\201@I\316B\244n\335\313(\2519\013'\220\261\260#0\266D\006\372"
+	.ascii	"\3637\345:\243r\205%,\355[@\344\244\353\245>\026\272_\213\035"
+	.ascii	"\320\322\357\304\305\260\364;a\343\375\t\352C\n&\036\n\335N\205"
+	.ascii	"\315\003\024\213\237ni\207\002@\n\336\022S\323\205\027O\352\n"
+	.ascii	"\237.\311\251\367C\241\266\022\004\036\013\245\034\023O\327\313"
+	.ascii	")=\371r\020p\335\344\264{\312A55=\345Vd\376\252%\326&\352\322"
+	.ascii	"\360\372\341\234\261(\334\331b\233\311\244\353a\232\321p\244"
+	.ascii	"\205\346f\300>\354_I(\017f\031*9\347:\034b0\223h9\017_\354\240"
+	.ascii	"\016\235\030\374D?\200x\030\2552m\2107\330\227\363\257\036nl"
+	.ascii	"\r\223\f\332\031\202(=\320\254\270\266\336\332\225\272\303<F"
+	.ascii	"n\026w\325\333"
+	.string	" \210\244WM\357\211V\265\213\336g\221\355!\246\275\207\302y\262wS\202\304\024C\345,\3126\235\330\356\261S+\325\350^y\325l\211\203\230\264\035n\250a(\303\224r\006\241\021\221`dF\333\214\001`\002\031\272\252n\021\240\2754uRh3%\236A/:F\372\201\304k\375%\376\024yK\254\027.\240\r\f7\356\212\357b\240\254]\354\355b\341\250\205CY\006Z\203%\343\301\355\227J\326\255\237\333\372S\244\261,\240\377\315\302\007Fn\243\217= o3h\022\220\225\215\207\\C\3257\f\260\177\023\204\"s~\021\256\021\3455\341?q$`\304l\200\363&\360\037MI2&\031\267$\001\330\377\371\260\307\3268\275\3139\221\017t\361\246I2\335\316\232\253\031\220\252\251h{\363\240U\020\252\r%\303\267\364Ml\304jJ\352\250g\337\232\270\331\257\f\274\037l\037\375sL'\001K\340jX]"
+	.ascii	"\343j\341\231\374\002\345`X\322\364\340u\235Rt\323\353t}\003"
+	.ascii	"\313\337\344\275?"
+	.text
+	.section	.gnu.lto_cliMap.297.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\331\007m."
+	.string	"\332Q\020\022EP\\R:\r\327\203Q7!r3{R\250\177?\246\002\350\2630\341C\016\213\n\261\001m<\221\371N(\036H\213\020#\214\020\020\265H(\020\bl\273x\300F\350\344\350\277\275\025\371\337\376/\277%d\357$\003\r\001\372"
+	.ascii	"\022\001\317\263\345x\356\312\357\221\207\212F'g5\004g\333A{"
+	.ascii	"\326h\275j:\326$\370\355>\227\243=\237\306\343?9/q#\223\263\232"
+	.ascii	"R#\265g[\355N\341\331\366L\341\331\356gw5(+W=\240f\211~\301\223"
+	.ascii	"s^\302M\272\333\247\330\355W\265\367\272>\317\\\376\370(\223"
+	.ascii	"\310\243\261Hl\207Bv\305\315\373\354sU\235\271\204\362\037'G"
+	.ascii	"\256\317\330\225y\311\265A\026\236\"\277\333*\262\036\003\243"
+	.ascii	"n\302.\362Vc?\212u"
+	.string	"\025\271\361w[D\214\\\320[<\334\333?j\232>\261\256''\016`\322\005\366vU*+\303[\306\305\t\271\225-!w\270^(y}\277\333\032\262R\240\373\nb\344\212^!\024UL\237X\027\330\331u\bd\013N\222+ke\352\343\003;\334\257\026\327\325]\213U\274\216[\2577\327\244\2604^\277\3332\262:\331(\321;\334\007X\331\212r\357\360B\316\271\257\224\253\353\355|\367\271\272\273\251[\330&\177Q\301>\031\034Sm\316\371Q\372:\360\265\300.>\302\030\037jvu\007[\b_L\364CO\016_\037coc\030O\373\037\300\006'\245\211\227\344\020\"a\f\375\323\263\226\207u\003\373\030\t\377/*hu\007\033y\217pw\213\250{\351\361\341\276l\263E\217\035\026\256\352V\273\272xzW&IY\343%\335\f\224\222\236\366\0238\333\033\351j\377Q\021\321\320\303\274\205\332\333A\305\333"
+	.string	"\210\267\201\356m\347o7\207\267\231\367\366\262x\373\247\275\255,\336N\026o#\211\267\217\355m\343\275]\034\336&\266\267\333\342\355a\361\266\220x\233mo\257\3676\036\336\276\302\333w\020!-\356\353s\344r\0162\270'\333\261sS\316\366\273\375a\216\273\3376\036\327;\252|Yr\316\306\377\313\337\016\327\3060[&\264`\336\366\274\333\215ghn\363\250gtr\336br#\336\313\327\002\217\373\033\211"
+	.ascii	"\335\033:\300\235\241\331e\341\2525\320\357\213\261M\302\254"
+	.ascii	"\224=\335\207\2060\013\b\210%\301\034\033\301\342\320%\200\273"
+	.ascii	"A\210\270s\316\260\004x\253\313#\342\251\231\017\341$>h\330U"
+	.ascii	"X\306b\327\b\344\213L\353\304\370\311Z^\023;\361\251H\230\270"
+	.ascii	"\377F\242\002\236\264\211\205\177P\263\005'b&\016\332{\001#w"
+	.ascii	"\240\f\227\370bkr\200\356\017~\334\3254\2659C/\355\2479\325\304"
+	.ascii	"\372(g\373D\223\360\322&\024)\356\245Kl\224\205\253Z\211\177"
+	.ascii	"p\221l\257-*\250"
+	.string	"\364\220\304Jd\362\210\221F||a$\342#\\\034\302\304;QA\003g\366\264\b\361\264\247\204r\177\233J\216\250\276\301\343gu\007Y<\355!\032\254\204Yi\263\265z\314\205\360\323\326\344`\335\300\223\355y\325\255x\372\034B!\254\204\225dzm\320\260\026w\367\207\277M5\307r\316L\227\326\031\342\026\3377>W\210\273\235\236\356\245Cl\304b!\276+f1\016M\203\200\221\f'\251a\273P\200\203j\251\205\ff\324Y\330P\201c@\301\300P1\242`@I9\205X!\3654\354'\005Q0\236\226bD9I-=Q\321XR\340\354)\031PTK5\246\246\250\226\214jVf\277`\205\257n\306\224P\255j9`G\344jyc\315Y\314\302\335~:^\356`'\335\242\307\335\357I\346\304{Ni\241%\f\234\355~Vy\226\335K\033\301\231\235\327\375\310T\335\223\305\357\007O\373p7"
+	.string	"\246d\200{=\026a\"\"|)\377\232s\316>D\230\001N\222U\343\004\215X\251\322:|\317+m5\bC\310\233\003\302"
+	.string	"\3609\\\357\211E\300X\316XL\335O-\237\363<\003\200\2273\026\204\263r\200\360\216*`\2369\334\006$O\031\345\023MD\031\344\027\033X\022O\233\356H\030\003\002\016v\027\037uYH<\355k<\335gP\365\242r\310\323\275\bk5S\037\224\312\321\350^\314\343h\030\202\371\340\"\310%g\2537\207\203\2413h\270\032\204g\003\200\240\250q4\304\2244S\"\"\"\242I\2224\006\200\002\231\251\262n\020P\251D\223\fcS\340\367@\037xqS\320\245H\375He(\321\306\f\330{fi\177\223_\303\311kc\352\237\260S\246\003\007\007\310)Jc\355\217\255\237\r\016\217\335z\177\263\277\3318\023\3342\2102\2723\373:v\203K)d\230\031\2224\t\230G\321\371\307&p\235\034\307\315 \216\321#2\260\222\342O~8\254\346\027k*\324"
+	.string	"\241\214Fm\341}\324\234\200\306l\373|0\016\257\330\252\335\267\356\305\021\373\031\263\254r1}\211K\336\r\310\td\005\027\342\365\211\273\332I$$\253\373\345\r\375\245"
+	.string	"\001\3752L\312\271\266KQp\210\271\270\310\250\315x\337%\201\267_\303\366\372\0011\344\200\030\360\277\323&\236\271\267\272\320z\230\256H\006@\246\306\210\016\232~&\340Y"
+	.string	"{\340\227vu\264\354M\200\031\251\222K\307\302\324/\372\f\212\037\026\230\r\310\3775\207n\251\030\316"
+	.ascii	"\002\217a\326\020\342\274\300K\3761GI\317\033\272\f\033\243\364"
+	.ascii	"\277\375\262`\242\202\030\210\327\357\b;Rx\264\202Hm\2225\324"
+	.ascii	"\325\364\023\343\342\272\310\311j"
+	.text
+	.section	.gnu.lto_skipSpace.298.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\315"
+	.string	"\245\013"
+	.string	"\026\326O@ Q\224\016\003>\346\336\221\b\210\243j\200\220\021e\343\023\214\365\245\232W@\t\302\027`SX\032\346\3146l\217\023\003T0\351\333$"
+	.string	"\244\202\2005i\210\"\fA&\273\360Q\226\354\275\245L)<"
+	.string	"?"
+	.string	"="
+	.string	"\207\372\301/\261\303\247\211\371\025\211\344C\244}\016_\225\225Dlh\331\273\240D<~z\216\264P>\022\246\353O_\020\322\215\2104\323\263R\260\273N\221\246\341\216\267\235\261M\300\376\201wf\372\025\202\03048\274\353vK\251\222\005\201\036#l{l\212m\3477\354"
+	.string	"v9\266\026\273\\\001\017\230\034\376\304Qx\214i\206\f\344!\301\213\022\f+Hv9\313\334+\361p\362"
+	.string	"1\327\233P1\303B\242\354\247\250\320\231\354\356C\370X<\274V\244nd\324\001\364vw\237\r<5j\025\322\245.\224\beJY|d\232j\207\315}\362\002\002%b\345\260#\374\366\353\267WF\243\241\320 \032c\3318\300X\0206\f\036X\230K\202e\251\230\023!sY\0238\234\313\242p\373\367R!\324\313\3306\200\2004\004\265\303?\375%\0270jhT\277TM\035\331\266\200wb\024"
+	.string	"\3571\216\020\rN\244\214i\250\r\207>h\003\022\022\312"
+	.ascii	"\314F\201\210\226;\024\273l\331\273\031{\376\314P\250,\301-}"
+	.ascii	"\252\226\201z\331$\314'"
+	.text
+	.section	.gnu.lto_checkCommand.299.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\266\001\365\020"
+	.string	"vatF\360\322$\035\242J\252\357Z\315\335\201\357\377*\245Y\250\207W\315\246\253\224\375\312\3422F!\036<P\013\204\332\305\376\371\207\233\313n\216r\354&\262\211\254\b:V\035\334\307\204jzzG\214\220\337\b!{K\231Rf"
+	.string	"X"
+	.string	"_"
+	.string	"\037A\343\324NX\325l8\360B\007\347\2054'\330\031\274\tv\251\275\004\273\334\237\247\216\311\270\232\362U\307@t\222\212\276\026\317e$!Z\261J\t\301\241G\214++\244\013\"\255\233\310\361\300\221\261\265V\272q\333\211\341\022i\261b\001\035\030H\334u\315i\331\250f,sN\353\327\242pg\267}\262\275b+H\037Q\021\244\301\350fU6\250\322\365\261\277a\030\206\336\036\207<\350\347\016\376\233\325%\2535L\235E5\026\325R\252\243\325\033\325\272\352\213\030\240\001\304s\244\2439wB\037\323H\246\350`\233\306\336l+(!\307"
+	.string	"}P\352#s\366\22481'\230\342"
+	.string	"\332\245m_D\2733\256(<\264\200\021\261] d\003\200\312\265\275\027\375\207-J\\\271\307\201\363\303\177E\230\321\346\234\007\362S\330e\334\347X\250\321\320_nwKL$\021\261>\330h\370\243\272q\264\353c\001\327U T\343Fy\230\323\357\266\334\332&\006\372O\027\205\265*\227t[\033\345@\377}\357\n.1-\247\023\312\313^bL0.'/\263\247b\202\361\272\030S\313\251\363d\036t*&F5x\221\351 \240P2\335\006\316\307\271=V\375\320Ov\200\210\037\372]'\221![\332\034\333\2455K\315\332\3049\347\304HT[\033A\002\375\027\222-\267\332\352\213\300\277\331\236\350$\025\2612\350\253\002\013\027r\006\213\001\036"
+	.ascii	"\3571\376\210\267\244\t\002\007\205h\324\r\034-fP 0\330\255\217"
+	.ascii	"580-\300*\240\332\031\246\b\306xzlq\360l\307\005\3105\225\220"
+	.ascii	"#\"\327\004\016\n\301e`\004\250{\307O>\027\226\273\340SG\031"
+	.ascii	"\reM3"
+	.text
+	.section	.gnu.lto_cliRebootEx.300.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`F\001\225\016"
+	.string	"f\332aF\360\2624\035\200)X\215~O\225&gp\343\357\363\263\314\2424O\2724\306\275\025\2735)\325\"2\233n\214\232^\354\202\fO\262m.wDZZ8\n3\242G\314\017\253A\341\247-;0\242\221\336d\313\224\002M"
+	.string	"J"
+	.string	"M"
+	.string	"\237\326\007\\\237.\331?\bt\330OA\017\032\0179Cvw\223*^\372\264\244\226|\024\325\n\f\277\317\243\356"
+	.string	"G\005\004\fE\334\322.-\215'EO\026\232\254\0033;B\004\bO\252X\203\335\265\202\241\314}\335\366\003\333\f\354\343\004`\006PL\002\003\237\266\206\rz\320\b\304\034\343I~v\352Sic\337\332\335\265\254\261/\376\230\252\237-\b\3223\342>4v?\254T;N\034-2\333W\373/\016\243t\361\305\"\273(vl\354\246P\\"
+	.string	"\364ir\355\nR\3441~\372s\026\340\314(\245\215\375\227\013\223\327\217\013\031>N\352c\001jWP\221\342N\211^\332!\221\311s>\203\203\277\302#N\017~\372\334\365y\331\351\350(\001\243+\217\250\315\322\351\214&\371\031\323\247\036\303\245\344f7\346\001\036\265p\020F"
+	.string	"\220\220D#oE\002\251\353,\210<\022\207R\270\013\241\255\205[a\331B\236\313\226\242\271\303 \3626R\327y[\226\332[+k\234\241hF\030i\232\021T^\003Eb4\231\330\023\211\222\321\033BxNX\232\332\023(\310\317\240\233\005\261\273'\001\035"
+	.ascii	"d\n{\027c&^0\205s\274X\b\301\261svD8\330\341\215\261\n\360\005"
+	.ascii	"T\321ze\2116\210,\254\036\223\216h\202A\214#\034O5\346-4b\244"
+	.ascii	"\260\036\030u\t\213X\215\036w\031f\2134\205\276\257\251\007"
+	.text
+	.section	.gnu.lto_cliReboot.301.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375 \325\355\005"
+	.string	"4\n\203"
+	.string	""
+	.string	""
+	.string	"#\001\003"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\001\201\221\212\t\001\273\001\001"
+	.string	"\177\002\001\177\001\247\003/\200\200\200\370\305\207\331\3375\201\200\205\030\356"
+	.string	""
+	.string	"\177"
+	.string	"\013\001"
+	.string	""
+	.string	""
+	.string	"\257\322\005\340\200\374\377\217\200\200\327\375\001\226\214\3677\003"
+	.string	""
+	.string	"\244\003\200\004\001"
+	.string	""
+	.string	"\245\003\002\201\300"
+	.string	""
+	.string	"\201\003\204\340\267\277+"
+	.string	"\212\001\002}{"
+	.string	""
+	.string	"\006y\001"
+	.string	"\002\004"
+	.string	"\203\003\202\340\271\277\013\244\003\001\200\300\013/root/repo"
+	.string	"\025./src/main/cli/cli.c"
+	.string	"\t"
+	.ascii	"3\003\226:#\\\270\3175\334-\204\3612\004\270tc\266\266\353\264"
+	.text
+	.section	.gnu.lto_cliBootloader.302.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`y\001\355\017"
+	.string	"\226\335lH\340\224(\035$ \270\032\226\246\233\216j*5\261\207\240\225\365\001\204[(1\036@\023\307\211\230\304\361MO\177\230s+@\304(\246hj\272\3608I\031\200\021w\332\241\b\264\234OU\377?\025\334\266\266YB\366\226)\005Y"
+	.string	"Q"
+	.string	"^"
+	.ascii	"\"\356\033\350\003\270o^\331;\004\\\225\345\240\007\017\230\034"
+	.ascii	"\236Zk7g\276:\267\321\271+\237\204d\235;\371\026sJ\001\364\300"
+	.ascii	"\374(!]\224\201\213\307D\210l\355\244\t\206\340(RB\276P\021l"
+	.ascii	"\305x\233\257\b\262\265\373Y\251\265zGr\304\375\271\355\026\333"
+	.ascii	"\030\354\267\bNu\330\217\237\267\271\311L\246Ck"
+	.string	"M\226]\262v\312\330\247\265\326\352\031\263_\363s/\177J\327;\327'\201p\242F\314\217\324j\205\325\214T\332\226\203\306\366C\266\267\374\260\243\340k\037\306c\254^\003\342&\265\306l\334\250\265\\`\004\240o.\037\0258\333\302\205\024\037%\004\354oN#\203\201\024-\240\327\003\224o6\251\264\037\375\231\214\310|1\003\210\016:e\234\362\235\037\0245\032\234 \001v\336\205\373\315e|\240Z_\0377\200^\rP\276\201\341~\334\371\231l\007\355\265:.\030\213i\017\334\347|\325fp\204\264\266\307\237\245\323\001\366L!8\022=\023)<\251\302P\303(\002\013\205\021\352\033\271\240>\225HR\245<\361\200\301P\244\036\352;y I\202\t,}\\R\371N\245\016\365\221\300\256$\246:\025\221C\016\236\330\251\302P\354Be\375\214y%\304|\341\n,7m\226\t\373\321\3249.H\250\330N\366\017\035"
+	.ascii	"+\341\337\305\220\031\232\316\344\301_\222\233\275\204j\037\\"
+	.ascii	"q\202 \2441\\v\347\022- \214F\260\t\024\f\327\312~\220\325\325"
+	.ascii	"\256\326`\013\272\306\266\302x\240\032\270\002\346\006\250(\300"
+	.ascii	"\035ii\357+\341\212[\250("
+	.text
+	.section	.gnu.lto_cliExit.303.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\032\001\355\r"
+	.string	"\246\231_G\360\2226\035P\253mT+\367\367\262\244\022\336\260E/\341a\271]\r\262\3509\032\0252\220\245\222\206\232\244\251\024\221Z\324h\244E\243\270\341\016X\"\331\017\245\316:X\n\006T\004\243\n\237K\206h\355n\264wJ\001G"
+	.string	"L"
+	.string	"K"
+	.ascii	"\322>\213\327\230\336\202\303\001\354\242lR\273\242\001\023\370"
+	.ascii	"\234Z<I=\375<@=\265\311\366!\300\303\202\t~\234\370\020c\334"
+	.ascii	"\335k\246\270\351\322\344\337"
+	.string	"\305EB\031\360\322\303`w-C\231\021\367\274\355\001\266C\366E\004\346\274\002\253\032\325i\202\366\310\2778\214\257D\305.\314\303\226\017\f\002\223S;\203\006\371\320\262\007\211\224NN\207\t\332\"('\n\373!\273\273\236([d\256v\304\2040q\0206vcv\202\254\212\342Xa\373 \333R\334\200s\362:J\244M!\245\204\250\223s\272J\365S\277\241R!\024\252\247\013\306\0344+\325\247\361\032+\376\214-`X=\2350\336\214~Vm\037\270M&qvW\201/\34334\177\346\324\243M>\334\352\251\204\361\206\006\310\213\334\361\210tf\371<\222\365i\243\016\273\220Y\"\315\005\373\272\026\353D\023y\234\345\340A\003k\324m.\230F2\321\272\215\244q\030\004\021\227y\234\241l\244\354\3526\214\273\262\322w\241\220\330\303\240\225.\026\317+] q\037\262\023e\320\212\207\352e\236\"\244\314U\031"
+	.ascii	"+\341\337\305\220\211GI\243\341\"\326\274\006\346H\246A\300w"
+	.ascii	"3&\201m \307Ge\005\222\313j\277\"\263A\220Z\033.\254\2550\036"
+	.ascii	"\250\006\256\200\271\001*\n\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_cliGpsPassthrough.304.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`M"
+	.string	"\345\b"
+	.string	"\266\020>:0\3456\035\300s\235Bt\260\266U\265\264\332`j:\307\027\027*\211\237\002\006#[\302\234\0313f\202^(\034\241^\n\244\204\202K\257Y({\002\23790AM\204\354\235R,"
+	.string	"/"
+	.string	"+"
+	.string	"\004\326+\203\266LA\306\206\f3%\215\224\323\356V\032r\360\023\364o\362"
+	.string	"q\024~^\016\273\353)\216:nz\333\007\266\027l\303\004\r\244\030\217o\260\354r\224\001\326T\255\220l?\263=\311\n"
+	.string	"\t\237\366GN\002\276\304\342\003\273c\213\312.\251`\004\354\225\311k\254W\330\003v\004h^\264\001\006\r\355\237\034\205\302\027\361Dh^\fY\257N\005N.\245\017\321,m2\234\024\304>\265\273k:\332t\372T\333\207\363t:\355\332:\316C\247\323.k\033\316\243\325\017\307\351\252\366\201\352Fc\017b\373\252\204\347}5#\367\324\322\321\331Ki\022\321\013c\3634\r"
+	.ascii	"\357b\310\304{\277h\301CkC\260r\rm\205\361@5p\005\314\rPQ\300"
+	.ascii	"]^\264\223\f"
+	.text
+	.section	.gnu.lto_parseOutputIndex.305.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\023\003%\031"
+	.string	"v\357\252I\240\230Q:\020\352\035\013\334\"u\003\022\270j\220u\031\032\220\013\306@\017\363\307\370E\322r5\346*\033\372\243\377\301\313\004\355P\223\216\345w\211O\343\221@\251\2037\306\201,@\025\372|Y\232\214\n\233G,!D\356\224\002\226"
+	.string	"\210"
+	.string	"\226"
+	.string	"\304\030\277\251\025\352\n\224Z\211\017\234\340|i\342i\3337\362#:\033kC\022R0\202\230\343\217\311\231Z\353,\366\034\363%y\034\363\345\372\270\3566\247\313,\311\245:\177w\233W\335f\207\226P\f\217%\247\237Gr\272\013@\260\351&Is\022\236\213\r!i!*\313\313+\350\243\245\031DX\005\030l:I2\b\023\245L\216\022\020\340+\330\243K\356\024\331\242\002\013&\221\007\212IQ\257:\245\021\344Q\352\272Pk5\005\006\227n"
+	.ascii	"\267\335d\233\311\246X\002\277+\037S[zt\313'\025\260\366\212"
+	.ascii	"\034=\020\266\257:\2014YAcow6qGwh\237\254\013e\237\370\343\234"
+	.ascii	"\352\277y\361\206}\311/\200\244>Ij\027Im\226\324\345R\223K\275"
+	.ascii	"$5-\251_\200\242yBD\312\314\225\216\265*\035\325Tc)%\310\213"
+	.ascii	"\277\255\363\253\374\362\213\306z]\252\237\321EkF\230Zk\203\227"
+	.ascii	"\256p\222\324\2260Aw\252\027"
+	.string	"'\"\020Z\035\261\002\201.\201q\306\301\251\375$W\242{{'\276\247r\315r\rhe\3450\362\256zP\235;\374\246\221\312\202\304u\253G1q\342\364\231p2\366v7\344\307\230\035\346\016\375\027&\2712\246\276\334\354.\271\013\346'\374\361\3062a\273\253\243$\334\362\223\302\243\307-B\206\251K9\200\302\366V\277\252\351x\251\325w\240\355\364\371,\bBA\017\364\233d1\031\223vg\027\201_p\220;4l\314\224\226\036\335\362\227\356\177k\220\350\321/j\253\030\242\007~\217D\007ow\377\024!QPv\207np\330n\226\001\355\304\036\304 \304(\364h\370\341\001\021\223\201\350\301\320\201\366\023\023A\373 \202\346!\226\301\207\003\317\210\037\037\005\226\345n\267\032\216e@;\261\030\n\"\241\034\355\306E\020\020\221\317\021\213\242#\026\270W\316\226\353\271\335xZ\340n\267Z\200\024\266\242\r\032\252\375"
+	.string	"\r\331\\\266\311\204n\266\031\221Pmhf3\312\315d9\306\025\005\031\315\216p8\243\331\213XO\326\2052\354I*\211\3537\236\244j\234\262\237K\303\366\271\276\200\264<\033\035\352\302\n\241\200v\372p\013^\342\254M\242D\314\267;\313n\256+2 \200\002\021\262+\017i\036\032\345\325\247|\002\217Q<y\211\230\263\367>\266b=\314^\303;\374\310\260\372\210\345\356\236\261E\017\221\327\306qz.\321\227z"
+	.ascii	"\371\232\347[\364^a\002\353\335\355W\253]\223\234\232\340aoC"
+	.ascii	"\343#\330bL\224\200\026Qj\301L\274\332\363[\373\\lm7!^\001\346"
+	.ascii	"o\327\322\002\372\252\001\340~p\243\377\257\311j\225\265>("
+	.text
+	.section	.gnu.lto_cliMixer.306.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`-\006\225'"
+	.string	"\212G\330\017D`\336Q:\357#\321fo\264\340[\017j\352\364\321\324\212\251\020!\350@\373\301\206\307\245OZD\037Ahv\026\205\373\b\006\205\276 '\2507\227\370\r\364:\3560\233\366\313\\\361\277\352\033\310'\204\310\235d\352"
+	.string	"\330"
+	.string	"\356"
+	.ascii	"vU\234m\3332x\312\020\326\247D\3642u\340i\360\313|\260\207\261"
+	.ascii	"\027\333\361\242\266\345:S\323\266L\007\234`}\312\314\017\325"
+	.ascii	"\247\353\003\250OY\346=\002\252Zd\004;*V\315Am\333\026{\n\237"
+	.ascii	"\233\307\003\2162\317=\224}\020\370#\362\365\206V\236*L\321\276"
+	.ascii	",\037\371\340\3317\\\311\301\201\321I\321Jr \226!\377me\301b"
+	.ascii	"r\211x_r\203|h\205\260.]w\303Z\202\366\0302\265\237)\271\275"
+	.ascii	"7\257\341K\256l\350*\356M\211\305\310Wt\251\316\211v7\254#(\257"
+	.ascii	"\352\352\312\313~ \013\026\222\313\353e\031\271z\251$\027\336"
+	.ascii	"\r\213\212/+yS\365+\216\tF\007E\253\311Q\324B\233\"W\300\254"
+	.ascii	"*\364z\341\351\363\346\357\217,\252\333\001~y"
+	.string	"\027\332\266\345\253\314\322:\027\235\371\035\230\031\006s\n#\367\356\022\371\262\206\366\222\341\374>\3663\307TP\240B[`m\233\274\022\306\232\234\220\364\224\321K\324\303\376\301\340F\335Vs`\310\340\241\272u\3746\352\237\261zJ\335;\036\272\303f\206\242q\257|\277\371\007aKc\3229\251\032\311\314\234:\005\244\030\263\356%\377\022\265DI\343\346b.p\261\037\351\350e\316Fg\236\207E';\013\323\313\301\3642P\275\374;\363'\272\331\331\367\313\275_^\325\313<\364\262\372\313\251z\031U/wz\371\242\227O\344\001h\252N\323\256\253\337\230\355\325]\241\266-E\373\272\331O\366\227y3\377\214H\305l\263z|\344\332\300\006}\214_F\226\303G\230\035\030g\3332\227\326\247\367M\366\361\307\234\f\3732\234\366V\253}\017;\001\327z\312!\3636\206t\327\276\331\357\260Z\216\340\266\254\311\023\\H"
+	.string	"\331\324\332\350\234U\215\024\346\021d\266\366\222\207\222\254\005\372\210MML\345\347P\205\374\035\352\332\207\262\342t\332\326~\331\321@\3179^\320"
+	.ascii	"\314E\021\302Cp?\3669,\230!\0256lM~`\3030\335+\371f\352\346\332"
+	.ascii	"\256\322\253\251Jp\213\343%l"
+	.string	".\3465\017\003W\215\223a\335\260&7$=\345\320\341^\311kb\262\221l\324j\367\256\342\322X=\227\364$\235i/\231\031\351\246\375\261\277\tq\004'bMVH\032A\342^\311\017\234T5\362\306\323L,\361\331\274\315\t\024\205\nU\205\3724\355b\027\232\322\273\321Fj&\267\246\356\035\337\356\276\325\223Y|M\323\332\266T\022\370i\256\306\211o\345)\033_\334+_\250Oo\007\311\346\300\266\302\304\244\002\234\341\003\023\b\"\006\016\036\230J\200\340\360Cy\202\361\251E\323\323\261\351\006\223\217m\3248>\245\\C\001qB\224\021\307\361C\217\177\274\f\343S\033e\034\237\2141\232@\270\210\341\304c'\245\343\223SQ\306\261)F\321)\252FQi\310P3\214QE\033PPQE\037S\352\315\305\027\244zJ-\330\313\267\027\365Q\335\363\316\324\333\230\031\023.7@\224\250\250}\301\376\303>I"
+	.string	"\327\266\255\237T\217\322\317\317>Q\201\035\354\373\032\330\003\276\364\250Y=\007\240a\362\347\327\313_G\365\372\327\217#\244\245-\331u\342\306\234\021)\335\233\371\036v\331"
+	.string	"n\312\232\\\221\364\024\251\231\331.\326k\215"
+	.ascii	"\221\260.\276^2\017\016\360\250\207lk"
+	.string	"h\204\257\363\242\376\301n\357uT\212\307\345\351\365\317\216\316y\336\241CC\333\005\227\231\375b\2614\177 lk-\235sj\250\227\005:s\250A$\305\2304F\031\"\221@$h\333\214\001\200\002\221\261\262n\021@MklS\320\314\001RC\r\017?\2340\231\346\357T\227\220K}!\341\253\227[\3120\373\222\257\305R\236\353\024\302[.\326J^\355\236\223\303\225\0307\372y\367\373\317\272\017[f\372\210\nG\263}Y\316\270\222\352\254\245\306\344Z\377\252\003\276\fc\211A\326\235E_\202!c\302\205c\361\34250\301g\243Cp>Y\211^Od\303\025\307\242\b\335\022\332\342B\343\203\016\240\357\322\2271\220[\320\272\353\312\230@c\276g\252(d\302\355\201\223Q\177\301\306\312\037\005.\220\225\277\f]W\315(-)\302\264\220\216\210\366\221\016(\t\372\225\2319\233\324\177\310\251\304\002:}\257\222"
+	.ascii	"\003H~\247\266\0165,\f_\307\243\202\274\021\323\2759\301F\214"
+	.ascii	"F\226\272g\311\024\026\376IK\332B\234\006"
+	.text
+	.section	.gnu.lto_cliMotor.307.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`(\t\3556"
+	.string	"\032ax\025CPdR\007\f2\243\200\274\005\006,HB\001\337\004\264\351'ag\250\370$M\361*\031\240*Q^\212\223\373\306\266\312\220\030\nH2@Pp\336\241"
+	.string	"\341\250\362\201\212\325h\263b\244m{\357\275\223L)I\0016\001E\001\231\004Z\036^\2074X\031\264v|\310\213b\311\231\355\302\031\3260\277e_\366\311{\351rfV\36027s\335L\267\361\374\225}\307\235w\007]\316Y\311\325\226\320\272JL1\023K\316\350\270\333\305\370\030\327\311\350p\242\234\237\240\261\345\314\\\352\005\255\253\315\364\243\325\325\326\213VW\335n?\003\270\362qB\336\236\344\231\272\2343\323Gi\333a\263\357\373\276\2362\275{\357\372\221Q\021"
+	.string	"\242\2410\030"
+	.string	"8\364\363\365ZvU\323\307n\273\317\353\350GFjU\274\b"
+	.string	"Q\312r\001\261\342oK))\005;\2726w[\202\207c.\fz\326\230\007x[Za\003\303@6C\330\027\025\037z[*I\2119g\327\262L\202\177i\202'K\240\376\266\234\222\022\345<\223\256e\211\004\373\336\226G\270p/\t\312\227\021o\331+\320\270\"\316\246\026\306|\221\342o\313\"\351\227\241y\343j\236\244eI\206\327\244\317\013\271\036MiC\245\223\302\226E^\235zy\374\t\3732\342\351ze\216)\006\032\366E\346\237>"
+	.string	"\233\023$\350\265\225\036\331q\302\307\325\034wyia\314f\31097Vz}y\013\360n\347\322\335C\272\331\266{\316\254/\366\354%.!\224M\314\227\314\244N\033\333O\233\363\321\301\230\034\337.\007s\272\333\217;X;\226\227\231\231\035\270*\374!\347\037&P\272-\034}\270=ejT#\354k\256\006\205Q\234\322\327\034N\212b\\\316HW\256h\221T\f\\m\321\204]i\340q\332\335\373D\026\265"
+	.ascii	"e\245A\214\340\273\241^`W\266\247\335\321y\026\361\260c\346_"
+	.ascii	"\254m\254\376.\314\364la\273\376\341\001\337\035c\n\273\322\337"
+	.ascii	"\325\334{8\351\260A\351\266\376\330\315<\342\027\353v\n>\334"
+	.ascii	"\316\372\237t3-\031\037\024\275\351\235\344d\334\021\0340\200"
+	.ascii	"\324\342&\340L\367\001\336\346=t3\336B?\363\016\002\035\315{"
+	.ascii	"\350\347kq\367X\334\355\212\233]q\257+n\325\327x\247*\356Wq\343"
+	.ascii	"\024\267Gp\371h\301\235\311\343\363y\230\031\310\213\227\237"
+	.ascii	"j\333\025oso\272\233q?sO\343\216\346\276\306\331n6\355n\375k"
+	.ascii	"\343!\367\222\231\362\265v\266\376\271\332\304A\334bf\257_\323"
+	.ascii	"\256NL\235\212\326U\3673\216\306\325x\232\253\365oM\267Is\032"
+	.ascii	"\016ywXr\016\237\364x\020\262\216\002L\340\273\3350\356\030\354"
+	.ascii	"J\365\235\315\217\322\242N\244'\360\215\225\200\262\360\013$"
+	.ascii	"b!\033\033\347k"
+	.string	"\356G\203\204\261\r-\262\212\201\253\034<\354\211\312y&\377\310\032\211\222\034z\2618\277Z\377\253\314\352\b\337\267\256\210_\255\370\377\035\351\361\2109\273<\311h\026~\203Z\326|\374z\302?\360]\335\003>R\357\367\351w\265w\233\365\300\017(\243\307N 89\003A\306|\361\275X\343x\227$\233\355\322C\275;\222\315T\311\205\337\245\343\035K6[\246 Ng45\360\301v\250\205\363,Ur`\353\373!\247\223L\252\344\277\357\302Z\203\337\240\314[\223@pi\3169\367^\254]\315\325\027I\022\r\373\340{\005~\253\300\037\372\256N\331_O\356\355\221l\256\306\357T\375\275\357\273r\200\221\341I\341\202\300\310>\254L\357wQ6F\027\376\322\263M\350\213\004\323\302o\273\034\367\217\203\367\343\330\"\341\340w\207\030\201]\371\300\313s\313\351\236\026\355\362d_\254!\270\361\033\224\201k\022\bNN"
+	.string	"6z\360K\230\300\2564\376\273E\215<\221\177l\247\343\t\376`\251\243;\342<o\342$\375T$V\240A\224\222j\022\366S\221X\341\251H\0046\007\023 4\234X\233\210\243\334\352j\206\325\325\210\341\007\250+\251\246\023UTVTS\276*\253\031P5\232h\2600\234f\374\r\250'\031Q*\224\214()\250\251&\021OSNl;A\210\222rb\222\021\3254\305\344TE\203\t\302QS\315\200\252b\262\242\242\252b\3721\263\232g\310z-\334\314\243\332\021[\350\t\246\244"
+	.string	"t\210\020#\2544\3470\f\236\306\235\256\f\277^D\224\366*\001\332\231\243\002\300\331\340\354.i\322\"=\351l\016 \355\025\362\344\372#\321\2135\320NX|vJ"
+	.string	"%\037~\327\360{\217\255\230\325i\277\367\236\214B\300\335\256\230\033\005\273\262}G\302D\353\217\236\004\006\r\221\241\321\207_\374\002sw\205X\026\216\327\315\342\035\373\356\346%\346\356^$]\026~\377\300\033\332\234P\t'}\372\316\306\241.\225\004qn\225\026\211\203\201\253\335\356\0257\013N\213B\327\357\356\032N\250\233\t\342r\316\024\332\005\371 wK;\231\253\355vq\275`W\272^VW]\t(\351\327\027"
+	.ascii	"\344\356\r\222\356\313\2468\203\376n\360\306\002\374\2237}5\231"
+	.ascii	"\227\307L\217\032\200\267\250q0\244\fSH\031\031\031\031\205I"
+	.ascii	"\232"
+	.string	"\016`\002\2311\253z\021\300=DDR\220\264\006\365 \220\340\177\344\271\210r\034\351\302\347\307\004\212\216+K;\262\342\257 &: \\*\3462R\362|n\002\004\334`\373g\3132\373\316\214\250\231\265\244\n\276\364\205\324@iF\034!\311\3271\322\2477\245\356\373\003B\214\222\200\207y^\263[\232\024B\322\200\216\t\214\314\251\211\216\274\3141\034K\214\224C\351\300*.\316E\230\270\226qi)\367\305\246n\001\213\221\025.\311\200Os\001\341\255\324\f\364y2H\302\240\332GaD\244m\026\224vW\261\024\201\201I\206j\217w^\225\356*\017[\r\316\267\233\365\001\005i[\233j]g\334\304'R5\306\355\367iJq?\366K o\225(\004Dh\240\r\f|\204\267[-\326\200\262\241\350\231m\255\327ho3c\312\215_\311%x\262\201\004\t\325\033\003\021\025\236\n\204A\342+\234\353`?"
+	.string	"\205\375\2411w\276\366\213\031o\002Z9\320A\340$\265\323\350\203\020\352\271b\261\263g\346\243\003\353\236\235`>BgHY"
+	.ascii	"\355k\374\036\306b|\234a\2140U\312#\220\343\002k\311\337\247"
+	.ascii	"\f\200\034\244{_\255\023\223\314q\241@\221\257\237B7t\n\230q"
+	.ascii	"\230\212=?o\263\230n\203\006n\226Zf\337\324<^\276\251\021j"
+	.text
+	.section	.gnu.lto_cliPlaySound.308.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375` \005\355\""
+	.string	"\266\376\341Gp\334U\007nA\336\276J\272\013+\020\177cg\321\371d\227\225\365\230g\373\222\332\206\216\303\"\036\206\226\335\371w\361\003Wf:\203\316\234\217\022\363w\027qDv\360)\b\362\203~5\216p\336\217\277\375\367\336I\246\024\316"
+	.string	"\277"
+	.string	"\321"
+	.string	"^\320rv\022\371\332F\335\330\271\002M\221\343ng\342^Co2\345"
+	.ascii	"r\336\n\253\222\2633A#h}m\247\377\260\276\266\356\303\372\332"
+	.ascii	"\303\3564\001\2522q\301[v\204\002'\347\334\373\036\255\342\241"
+	.ascii	"\337tln\213\253\261\253\272\363x\330n[\022\375f@\307\250\210"
+	.ascii	"\225Mm\320E\310\026\226\207\225\036\316\245\274\201\335\332\321"
+	.ascii	"\205!\257\026&q\230X9\274\315\025\221\3418\237*\265\270\2245"
+	.ascii	"pM\205\340\225\304\007nyT\377+J\346Q7\300\245\304\201\331\031"
+	.ascii	"\276\342\226\306*\254\2662|G"
+	.string	"-\022\323u\303\247J\034\252\217\r01\316\245\314\302?U\332Py9g\217:N.\213\030\327\216r\316\215\221K,o\036\357\366Zw\263\350V\227\001$\260#\201\036\227\275d\322\"\307\257{73j\025\235\212\203\365X;\220\226j,\330\221\215\205\365\025\377\211\267\215\222\032-\360\353H\244T\205\371ov\n\326?\304\323\f\025\226\323.\346\371\356\240\t\354H\177\217\272_\235\245)\343\240Q=\261\333I\304\337\354v\214\006+I\245\177\253\333\233\270\013\b\332\001\351zr\356t\347\361/o\233\333:\324\273\306\342fW\334\353\212[]q\377\212\033\253\270\375\300\215i\004\306\013\032\2366&g\030\357\234,]\257\fy\354_\356P\377n\367\247G[\247\375\211C\031:\264\307<ce\267\n\363\232\241\345\234\033\264\276\362T\367a\277\246ry\232}\331|\003\026\b\\h\215JC\031\222\234\314t\271#\016\032"
+	.ascii	"6N$\266ov\317\013\237er=Ot\305\214\261\323\260\001;2\367\004"
+	.ascii	"\256\230K)\325\023]\035\366(>\326\301\210L\316FGzh\215\017\206"
+	.ascii	"|\025\360\335\037@`G6>\363\266\221V=1(,kM\373R\262\266\310p\277"
+	.ascii	"\325\355\257e\212\\\375\365\375\212\372\356\233\027\214\226\327"
+	.ascii	"\1779\3635\245\366\315\336\235\245\245Y\211\274@"
+	.string	"Z\026u\367\355'\303<\310L\033\224u\226\206\306~\023\347\234\211\253\212k\037\3525s\024\333\321}\355\223\273\377w\256\247\031\017\356n\362aG\376K\355(\326~\367\034^7\3171P\255\242\232s\316\3527\333\235\301\264\354\307\316oM\261@/|\226\271a\335w\377\002\035%\304s\340$4\002\370\223bzR\372i'!\236\n\237\023\360\307\023\006E\360\234\200(\202Q\274 \022PO@\332\220\244\201W\001\311B\207\b\030\224xKIKK\024t?\367A1\001U\037\360\367\344\203bBr\202j\252u\223\202\337SS\017\370c\202\3525\t\243z\n~:X\302'\354\235\b\006\205=\035g\366\243\026_\004\273\275g\216\321\007\372\037\350\322\305Q\314\355yG\363\2529\212\261Ao\373\344\353^@\227VG17\367\255\262\355\273\237\354\036\302l\327\360\b\017\001v\277{\250d\270\004;\222\375\365\212\3315"
+	.string	"\333\336\225\016\275~\206NZ\343\210\033\223\210\324\370\304.\200\273%PX\257\230:\244\305'\266\373]lO\253(v\212\005\341\2413"
+	.ascii	"\347\336\2438\227c\25014\344\024C\310\210\220\00422$J\033\200"
+	.ascii	"\002\031\242\263\016\020hi\232\264\006\377v\355\311\237G\b\250"
+	.ascii	"\305\230J\213/CcqO\036\204\302;\241\315\017\340^\211\345\313"
+	.ascii	"\366\300B\327\353\352\f\216J\006\252\227h\360 \001\033\001\326"
+	.ascii	"\220\241\004\364\025\300\312\231kF4r6\003\033\212fO\272\350\272"
+	.ascii	"\244\377\220\367f\357\307\036\024M]\306\202\n\024c\037+*9P\002"
+	.ascii	"\024\037^i\331\203\226\025\233\323%\374C\373\007_*\314\353;\220"
+	.ascii	"l\253Z\362\f\347h\377F\202Q\261_\351rF\0258~\255\340\346\035"
+	.ascii	"\343\273\277\227\027\020\365\204\334B\267\025\001I\005G\322\334"
+	.ascii	"U>\356D\024\022[\265\355\005\374\024HZ\255gqcDm\fp6\222`\301"
+	.ascii	"\034\307S\003"
+	.text
+	.section	.gnu.lto_cliProfile.309.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`B\002\225\023"
+	.string	"\006%\202I\300\224Q:h\252\017fwqd(\220\250C\2305=\261\345\356(\273\\.`\372+\3376s\344\217\211\340\021\277\257\313\254\325oF?Y\236\377\252\226}\006\b\272\r\003\303z&\350\316\320,\236"
+	.string	"s\257}\322\b!R\246\024j"
+	.string	"f"
+	.string	"p"
+	.string	"Sw\203i\316\322\201\023\210\007]^%<(>%<h\232Md'\323\304\205$.\207\247d\316\331Z\030\276Wi\027S!\370\255\322|\262v\3616\237\247VB+\036\236\2209\357\335\024\004\320#\201\214\344z|\376}\021\210\206\200NH\234owHM7\272\356\2207\272)\327\024\314\234\323:\222=\267\352\266ulK\2605D\337\234s\356\376\370\372\342\303)\206Wg\277\350g\235w\257B\265\352\345-\276\374\301\224\372\013\325\013\252\365S\037\245"
+	.ascii	"o\310\316\347:I\346T\021\305d>\2019d\234w\373;\277g\226\177\364"
+	.ascii	"\032\264\363L\b\260\271\230(-zdP\2219'\203\203~ \036l\371\316"
+	.ascii	"\262\255\345\t\250\006W\3734ND{\021\212\243\314:\366\007\324"
+	.ascii	".\t\334\037\333\004t\367\273/iX\t\262A\274A0\207\016\372\321"
+	.ascii	"-8[\263\356\356\225r\232\3304\312\001\324v\275\364\243\252\022"
+	.ascii	"O\016\307\223\215\001\026DC_\357\bx\204Gz\022\210\001/R4\r\315"
+	.ascii	"y\373\b"
+	.string	"\023o/\013\016\372Sp\305\335)\021~=\034\t\271\321%^\251\270vL\246\037\2777\372yrEO7[\263\313\332\003\226Q\320\362\232\201}\220\315jX>\354/\032\330\314+\026cA&\346J\331\345\002\233q\265h`1\261\226k6\242\345\242bY\315k\326\"!\223\315Z\254r~u\206\261\255M\220x@YkO\240`t\030\226%\034\222\024\213\252\326\256p\341\275+\216'\347\264Z\325Z\307#6\215\262\201\323\355\b\367\307z\021\341\267\263\243\036\373\355g\b\215@V0d\320\217\253}// \300\002\222\251\365S\370\247\030\222\3212\317\261\237\257\325\2720\204\027\337\301O\272\307q\3106nP\363I\310cgh\343MdZ\336\022h\264\335D\234\366y/\323\341z^\254'\032\b\263\261\243\222(\305\231\341\274\233n\314\"\036\325\\\371\334\200\242\320\213C\244bF\3366z\3744|\033\240\340\307"
+	.ascii	"\252\367Z+\234"
+	.text
+	.section	.gnu.lto_cliRateProfile.310.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`F\002\315\023"
+	.string	"\206%\204I\300\224Q:h\252\017\244Ur\0342\213}\267;\005r\321\366\227h\310Eo\227\036\371\036\370\212\310\377y\374\214\337\327e*\324oF?Y\236\377\252\226}F"
+	.string	"\372\037\003\303z&\350\316\320,\236\004w\370V\362\t!R\246\024l"
+	.string	"h"
+	.string	"q"
+	.string	")s\356\230\226\346\3541\360\201\361\241{_\021\037\216W\021\037zf\017\331\2714s\"\311\343\371)\231s\262\266\205\357\325\331G\224\030\202\2533\237\244}|\355\347(\225\320\211\213'$\317K\233\206"
+	.string	"J\022\311\b\220\317\317A\360\001o\310\305\t\271\003\256\357\b\307\213\256=\244\216\256\312\025\0253\347\264\336H\237;u\333%l\313\330\332!\356\321\016\3169\347n\220\2570=v\274\360\356\354\023\375\253\377n\225\250N\275w\217\357\375!J\r\212\352\r\325\n\252\2372\240\024\342\373yO\2229M<1\231M\341\215\030\377\335\276\317/\275\362\215Nc\366_\210"
+	.string	"5\0263%EI\326(2\347T\360\320\r\306\207.\340W\266\265'\202\310\202\253\375\031\347\315N4\342\001/\177\234N\305\372\b\342K\n7\310\266"
+	.ascii	"\335\275\357J\026X~\\\030m\016\214!\203\376f\227\235\245Yw\367"
+	.ascii	"6x\232\324\364\311(j\267\\\372\233j\016\234\216l\312!\200\202"
+	.ascii	"7\004\2267\240C\374\321\2238\250\350H8\r\315i\373\355"
+	.string	"5\332`\022<4\250\341\216\333\003B\374j0\002\242\243K\254\322qmXL\177\373\276\350\307\0015i\322Y\232\003\246A\340\342\252ym\210\311n\\832\024\377u\227\315\253\306\005\233\221@\003k\241\334zy\325\264X6\257\031\030\253%\373\300zYq\354\306%c\341\304b2\326\2527\277;\307\3246\007\306X@Wk\313@(zL\213R\016\t\252ESkG\230\360\362\232\303\351V\2506\265\326\333\221\232>!\345vL\342\0069\274\007\021\\\231\021\217\005\3672\204pN,\024*\350o\252\r. \240\202\222\251\365[\370\377\030\"\321R\347\260\037\254\325j\341\b/\337\301C\272\347q\3106nP\363\t\310kgh\343-d\325\024\332\332n\"\256}^\313t\271\236\027\353\211\006\004\320\330\321I\364q\346\360\356&\032\263\020\257j\256`n\200Q\370\305!R\261\2217\215\036>\r\335\006P\360c"
+	.ascii	"\325{\255]N"
+	.text
+	.section	.gnu.lto_cliDumpPidProfile.311.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\357"
+	.string	"\225\f"
+	.string	"v\227UC\020\2176\035\023 \013T"
+	.string	"\020 \023\210"
+	.string	"> \352*;\206\030*E\035,8*\341\270\333\367\201^\275\031BFg\r\300\330#\304\252.\301>aq\205\022,v\200\225\273\374\006\024\r\217>\331[\356\224\002A"
+	.string	"C"
+	.string	"@"
+	.string	"\322\2479\033\206n\312\206\220\272\027#P\306\356Rj\342\334\247\324\310\371\032]\350Ss\t\342*\rx#Z"
+	.string	"t\"\271Qa\031\035|\344\320\201\304\210\351\354\256cH\367\341\226n\373\201\355\006\366'\0041v=\204/\3132]\234\260\375\214mi\362\023\356(\027\244\200\025\225 a0}n\244F[\301\002\356\237\207uW\304\013\202G\373)\256\202{I\206\017\330\365TRv\277\004>0}\372\273F\372\234N \0334\344\353T\307\321\214\217\030\336\205D\330B\352H\324\260\262$\252\236\343=\244\353\301K\024\"+\302\223\025Qt\261\277P\324\021\373rw\327\352y\036\345\227/\371\365\337\377\251"
+	.string	"\213\026\023\221w\b\025@\036\b\237\254\303\2320\\\026\207\203k\003\243\240m\022,\354\023\340\312<\021\254\254\302\270\342`\033\025\305\201y2\252\332@\024Gc\355sm\224\005M\333\250\314\267\357|(\310\2471Q\352TU\033\324\021\037\342\203\357\004\027"
+	.string	"\357b\310\204\366\343\210\206\0010\034\024\212\021\rA`^D\252#\270\205\273\260\036\fK\3720/\204\177\204Q\270\f\022\006"
+	.ascii	"#\002T\024\340\216\264\264\327\224pS\n\265\007"
+	.text
+	.section	.gnu.lto_cliDumpRateProfile.312.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\360"
+	.string	"\235\f"
+	.string	"\206\327UB\020q\233\016\277h\242"
+	.string	" !\034a\260\034}B\210\002%\310\2450\331wv\314\252\301j}\3060\232\326\2572b7\266\221\343M\243\272\312\267_N\300+\035w_\240\202\033~\363/\271\243O\366\226;\245B"
+	.string	"D"
+	.string	"@"
+	.string	"\324\247;\233\206.\312\202\240<h \2055v\327\322\022\357>\245\306\316\007\340\211>3\227\037\256\262\300'\302F"
+	.string	"o$52TH\017\0377x\"1Z8\273\3538\342u\270\251\333v`\233\201}\t\0010v9\234n\254\312\214q\302\366/\266e\311M\272\237T\220\230\035\221P\261\240\372\324H\215v\002\005\335A\020\353n\b\034\007\036\355\2578\213\356$\027.`\367\233\201\262\013\"\260\201\352\323\3403\324g\365\001\001\031T\344\353TGR\216\220x\372\312\210S\013\251\246\210!eS\250~\236\007\241\256\017/Q\224\\\2300I\031\305\025\033\024E5\331\227\273\273\326\317\363'\277<\311\257\007\377W\004^\230JJ/\005\024B\327\203\016\355\243SY\310:\240\006\331\3073a\343\"d\036\027\207\311\264\013BG\303,\3066\236\017f\201<\227fa\\\310\332d\274ud\234\345\261m\234u\001\367\234\020\025\371\264%J\235\252j\207>\342G\374\360\234\027"
+	.string	"\357b\310\204\366\343\210\206\0010\034\024\212\021\rA`^D\252#\270\205\273\260\036\fK\3720/\204\177\204Q\270\f\022\006"
+	.ascii	"#\002T\024\340\216\264\264\327\224pS\n\265\007"
+	.text
+	.section	.gnu.lto_cliPrintCommandBatchWarning.313.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\356"
+	.string	"\025\r"
+	.string	"\346\227\\G\360\2226\035\260\314\003\261e\031>\277#F9\274\200\262\342|\307@h\366\372\242B)\374}\302\022\253i\324\302sl\314;\3670\261E)irF\203\215\276AO\352\247J\276R\036s\342`\312m\225\265\336d\357\224\002E"
+	.string	"C"
+	.string	"L"
+	.ascii	"'\200\235\032\264}\314\315\331\023\030\211\025 d\b\331\335m\252"
+	.ascii	"8\370kJ\320\177\315\001\204\"\352W\211\317\313@\216"
+	.string	"\033-\002\210\251\353\200\t\0243^s\031B\204\2212c\260\273\226\2418\342\246\267\275b\333\202}\2243\205\375kw\327se\177\374\351i\376\231\221\340\354\260\221\371\314\217]\021E\210l\213\322`a\373\036{<\221\b\330\324\315L\202K\373.\376\002<\315\351\003vW=rvG\023\227tN=~\004;\355\004\337\246\301d\3726\317\270\277v\256T\254 -\017\023\346\302$\235\005T, R\304\241\2521}\302\350D\221\301\201q\303#%\207\030\223\267y\214\r%:vc\036\276tb\024 8\235\323\346\320A>4U\261l\264>L\224=\242d^\341>\022\270O\210\003\245h\265\003=\250\016\264\226\372\231P;\255\2624\250\020\"h&\232J\r\245\324PU\321jW[4\226\016\324uuA\205\322\250\364\211^2\027\222\210\243@\3622{'\243\013\336V\032\211H\233\367e\330NFl\302\340\022\022"
+	.ascii	"\357b\310\304\263\241\320\b\034+\343eI\265\f \001-&\354\346\034"
+	.ascii	",\f\327\200V\030\003\030\006\303\002T\350q\227\247jr\212\246"
+	.ascii	"\366"
+	.text
+	.section	.gnu.lto_resetCommandBatch.314.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\n"
+	.string	"\355\006"
+	.string	"\022L.3@O\324\001\340i\274T\244\030\246\n\030\006C\325)zP%\317\032\273\302\345\020h\206\322\354\221/\005\027Zc\3030\272\250q\264\260\2706{\220\266\355\235R\256\2214U*M\225*H\007\t\264Z\0134\0320U!X\224\201\242,\n\205\373\371\005\214\034\333\222\262\315\007\037\344!\r\006\236\210\371\365\370\036\377\270\374\f;`\362\334\035\037{\356T\236x\261"
+	.string	"Y6\231\261CM\316\013\373\315\316\317n.\262\242\251\214\336)Pv#2\2305qJ4l\037rf\237\314%\331\212g\002\204\030\271\354.\235\030\317.3\377\035\027\340:\355\022\240`w-\271N\342\236'\260\275\021\r"
+	.ascii	"3\001\2178\003\344\335\003c\240\211\2410AR\244\270&\366\205\220"
+	.ascii	"_\206\b\227n\314\326v\235\026"
+	.text
+	.section	.gnu.lto_cliBatch.315.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\315\001\215\020"
+	.string	"f\036mF\360\2226\035\240H\276\213\177\257\255\3630Up\034\323\322\020/\260\231X\276[\262Vw\tL/\200n\003\323\357l\321*\032\237\267\306\371\3747\f>.]\234\354\317`44\335\312\232c}*-\225\"mw\333;\245T"
+	.string	"U"
+	.string	"]"
+	.string	"\b\262S\213\367\324\323\354\005\352\251Q6\217\2716k\242\216\240\361\020\303\307\356j3\305Q\307*\275\246D\371\030\b"
+	.string	"\030\246\216e)\257\030\b\fSNI\374\352\204\035N\344\034\020\256\256\317\356\036\306\345\207P%%\006\332]K0\024qg\267\375\331\206`?H+\006\"\247u\332\246\f\362\340\347gX.\304\026\316j\246lQ%'\213\3759\216\343\350\271b\377\345\307.\376\365\222\226S\372\002.\003$\325\203\245\362\0227vA\214A\026\007\265\301\302\366;\266\245\250\341F\301\245\375\226\273\240\376\262\341\004vWhlv\305\005\016\324\3368y\320\237a\275\b\321\3029\231):Yf\274F\304A\245\246\345DK\316\177\2524BT(:Z\344\354\356^?U9\275\230\035\276\214\317\234\374\025\2560\222\007G\365TN\f\005J\216\226\212\211\034?'\213\023\374\223$\346\346D\376p"
+	.ascii	"I\337\325\303\\\246\224\355\256\016b\310\002\016\211>o\373L\037"
+	.ascii	"\013\334\267\221|B\244\255\353J\016\f\370\363\266\317TE\244Q"
+	.ascii	"\211\250\333\036\204:\016372*\3414\322h\3534\3163i#\036\227."
+	.ascii	"\210<\355+\225<\255#\232\374\372\\\311X.b\013\307d\252.\314#"
+	.ascii	"\353\304\246\035A\002\235)YC\344a^c\302\001\025\024\262U\003"
+	.ascii	"\221\007+ \320\202!1;\223\360\277b\314\310\2131\364N\237\026"
+	.ascii	"#K\237\306\274\273\261C\232\f\033\201#Y7\261\266I\355\016\241"
+	.ascii	"\0313\302\272\\^*%\216`p\302\243N\036\265\023\315\333h\310\302"
+	.ascii	"\265\003Z\016\275\320e\030\021PQ\b\2274\340\343\200\345w\265"
+	.ascii	"\334t]!\335\326\n="
+	.text
+	.section	.gnu.lto_prepareSave.316.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\250\001\325\016"
+	.string	"\206\231^E"
+	.string	"\257(\035\300\374\003,\210\342\n\300\317q%\023\013\261\223j2\336\274\314o\316\267V\002qy\036\023&\004L\024}\264\003SH\267\031'r\207\377\377\377w\364\327\242\242\352\366\001\177\367\207\243\350I#dK\231RL"
+	.string	"F"
+	.string	"M"
+	.string	"\317\370L\377\244\352\034\201\r,\340=\317Y\001Qr\273p-r\350\230x\261\361M\210\241\324\007\024\350\223\2201r\254RX\b\251\340\300\3423+\252\324\215\357$\016\330\335\267\236)\337)\323\363\261\273N\324\307rg\334\266\312v\001\373\263&\031\332.S*\313\276\206a\030Z_l\2475\247\243\323\232\276\306md4\270\310\001\357\022\333M\2051v\246\235"
+	.string	"a\273\304\006\331\303@\211=\335\233\025\206\255B\013\024\033\030\273\256Na\356\375\303y6-jz\016n0\222G9\200\212\214\313\354\244\246\253\254`Ph\252 \257\327\003U\017\020GD\314\216\216,*\253\346\251\007H@H\025\320\341W{\333\025\344\265\342$w\354\323|\204\347{p\004\222<\352\232O\262]\273\276\3658\003\342dX\321\200\001\026u\214BD\335(D\324-\030!\020\351D\245\221\256#d\022\203\004\245\316\001\211T\352@\256}\\}1"
+	.ascii	"XKLL\306\275\365\247`-\024b2}\3155M\261\255\251?L\364\024ww?"
+	.ascii	"\312\342\024\204\360D\230HTE\225P\335l\\:+ \300\202!1\253\003"
+	.ascii	"\0132\264\226\024\336\027\211\321\340\305#\273\f\261\034\202"
+	.ascii	")\005|2\243\tOX\001\3550\213\013k\320\207\271\262\232\350\306"
+	.ascii	"\312on\364\241\027\353\212\355\2208\202)$A\\\343\021 \316q\327"
+	.ascii	"7~d\271P{\225h\276\204S\f\217\312\006\216\207\n\252a\020}\273"
+	.ascii	"D\031"
+	.text
+	.section	.gnu.lto_tryPrepareSave.317.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\301"
+	.string	"\335\013"
+	.string	"\246\026SB q\223\016\0341\266\243q\017\311\002\365\032a\375\214\262Xf}&\253\366J\203\222\253\310\304\364\366\330H\320\306\346\034q\355\225BK$\204\b"
+	.string	"\360\300C\361\205\030\220\206\002\361\340e\236\020\262\267\224)\005@"
+	.string	"A"
+	.string	">"
+	.string	"\266\315\240\001\310\232\201\221\r\0075\"A\262\202e7^*\342\332\237\246\346\007\340\266?\353\303\365mFX@\\8\221'\240\205d\306\273'\007.\224Yy\354\256S\304y\270\341m\177\330\336\330\377\b\245\023(\243\023]\211\333a\207\216\215\001a\224x\374m\220\337\371\342G\355m\311n72&F\320(\03584\002+\323~\351(@7a\370\200]R\213\323nL\340\214u\350x\fuh\275"
+	.string	"u\030y\321\365y\345d\n\241j\342k\024T\005%))T\324\020\311\026\303\264-\\\310\213\240\276;\001\025\031)\247\0346B\272\331qK5\261\377vw\255$\373\246\277z\274a\372"
+	.string	"\026\234\250\004Y\306\301\260\nY\305\351\2008x\320\301*c\232\020\b\330\025!\004\244sa\237\354\322`\354\221\300\371\\\024<\236\317u\211{%\371\335\277\001e\344\202\305\213\3745\312zM\325\240\366\310\240\241ge\245\366\204,\020"
+	.ascii	"\3571\302\020\232Q\007k-\300.\2540TS]9N\234(\272\f6\277L3\273"
+	.ascii	"A\221\252\tV\313S\3154%\036\215A\355\001"
+	.text
+	.section	.gnu.lto_cliSave.318.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\232"
+	.string	"u\n"
+	.string	"F\223G? \3458\035\340Yp\006\254\204c0\t[#\314dpNl\020\221\245\3011\214\002\321\304\303\330\3465b/&1\241\r\223\001\204\374\001"
+	.string	"2 "
+	.string	"P\200\202\n\241\203^0o\240\247F\344N)4"
+	.string	"6"
+	.string	"3"
+	.string	"\006v\327S\223\213\327t\212\376_\347\214\344\351Z\027r\325\030d4\004\n\310\224\346Y\245\214\177}~\220\25097\020\273\3539\222 \367v\333\021\266\037\354#\004\253\004\0076\266\325\250\330~\307\366,7\0024|\332gy\213x\027\307\rvY2\260\335\322\301\013\3357\227\367p\337\272\037p\337,\332\003taK\302\211\314x\304\004\032\334u\002F@j\316\314MU\033#c~\274*\250Z+\261\224\236\354\3624\265\304\276\266\273ke\331/\377\355\256_u\372]\002"
+	.string	"\004/#G)\260\033\242\322\210\024\002\277\215\b\004I\204\300o\343\3573\"}^i\004\002\275\317d\341}<\016)D&\357\"\fM^\247\334+K\325r\211u(J\343L;\254\230\037\255?\231\311`\352\022"
+	.ascii	"\357b\310\f\255\347p[\307Ra\031Pm\002\207WWP\f\353\225\013C+"
+	.ascii	"\f\r\n\301e`D\200\2122\356r\314&i`j\017"
+	.text
+	.section	.gnu.lto_cliDefaults.319.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`U\002m\025"
+	.string	"\366'\222L\260\224U:h\254.\267\305\354\2313\375\200\256\024\201O\f6\222\212\331\030q\300M#\254\323\355\204P\020!\300\373\306\036+DzW\372z`\204`\274\317+\0370\271d8N\337Vx9\343e\267\\\327\036S\315\245\b!\204l\231dz"
+	.string	"t"
+	.string	"\201"
+	.string	"=n7:q\001\367\006\005Q\272wU\300/\347I^\277R\236<O\240<\3117\346'{\225\256\213\362'\325\013F\335{WV\306o7Kr\264}\343\003Pq7\317\337\313\236J\3455Y\306\3601\345\232~\250\277\217#\212T\217IE\325\215\rvQ-T\352\256\355\210"
+	.ascii	"J\b\023\02557\256\370\330H\017|\367\250\273ns\346\336\313\235"
+	.ascii	"\252?\347\363\314\\\202\231c\314\355\nD^\027\331\371\f\331\333"
+	.ascii	"\312\333\020@']K\261\331\245e\246\355\364\323\333\003\177\026"
+	.ascii	"Ub\024\224\316\342\230W\\[!\346\217\367\336\3136\210\371F\277"
+	.ascii	"\371\365/\177t\266cs\333\346\247,\030*\025\021\t\177Nl\323z}"
+	.ascii	"\236L]\"\271t\343G?\363\017d\0253xp\373\221m\274@\027\227\344"
+	.ascii	"e\310\007\261(\352\3365\346$;8{5\201$\301\233\371E\0170\224\024"
+	.ascii	"\235\036<\177\351Cl|\032<\201\325OY\345IU\321\367D\264\204\247"
+	.ascii	"\237p\201f\266`\303\202\230\2638n\031bh\321p\362:\300\234d\346"
+	.ascii	"\340\201\364\345\370\021uvG\222\021\"\344\200>\322\201|x\231"
+	.ascii	"\001\342\344Q\2009iZ\346\226\253\237\362\223\212?b\023\250"
+	.string	"\035\007u\254\2501Z!\216y[\024\300#)]>\247<\322\223^\347\275\274\247\"N\336\f\314I\230\254\237\266=\340\303\361\"L\253\351\354\264p\320\033\027Y\315%'\366\252\325P\032:c\341\032\033V\206\0136.\021X\025 l\250a\005`Y\314\244\345\274pb2\032\224D\213\246Bc/\035\024\326\252\271\201\271Lv\311\274t\\\253\330\253\005[\271f\264\225\314\n\313F\240\263UM&\233\255T\353\375\f\217\315\231\006\232FB?\345\321\342\376\037^\212^i\205\230E\250\002\2507\264\017\036E\370\233\352\r\373\267\225\326\3660\263\265\026'\344\021* \200\202\231I\353\203\"\354c~\004\026B\343\021J\005\2000\220\\\366\346\332\230\331E\234\366>\342\"5\333`\323u\023\276_\003\207^g\013Y\270\333\211\211\030\013\031m\221f\303\257\366\227\265o \002\262e\260\023\365?\0020gjwE6\006\212"
+	.ascii	"\261\"j$)\336\245\221$\273\266\327lAD\001"
+	.text
+	.section	.gnu.lto_cliPrintVarDefault.320.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\370\002\255\027"
+	.string	"\266\355\240F\260\334(\035\274\254\3617xa\347\354\005\243\342\372\2632\376\204y\240\313\241X\027\034N}s\303X\016\243q3d\332\317)\024n[\257\357\354}\360\242=]\356mtk\216\212654\365\253(\372\204\220M\244\224)\214"
+	.string	"\201"
+	.string	"\217"
+	.string	"\266\242\272*\362\033\232\303\246V^\204\245\277@2\217\307\001U\245\365\204$,\377\253\333]\271G=V@\255Fd\200\265\362&\274\001\271\364\274\335\021\227\222;@\\\372\362_\323\025X\215\210Cq\202|L\265\326V'\331ri\330\\~\267\267\247\363f.%\262a\b\201\215\2277\250\033P\270#\344\344L\335h\334\241\0024f\244\354o9\310\r(\\P\344\310\226\355-\377\270\315\230\307\016\265\326\363y\023\262\027\367\177\213\377(\376\346\020\337,/f\220Mx\210K\2677\207Sb\"\332\035\371\340\246\237gr#\3717\254\265\326\267\321\277G\273\004\326\267_-\322^\265\274\335\324\211\217\032\371:\313?\235\370\344\310\037O|\221\344\323\221\037R~\213|\246\3745`!)\213\256\312oHN+\361\252PS\234\032\244_\236\254o\027i\371\337\177\261|\177G\375\002\206r}:\302\212\253f\033\tP\304"
+	.string	"uL\030\310\245\273\275\243\376#\355\340\032\347P\004\324\346\377\021\013\206\304\251\013\240\001\362\263\3621L\332\034\tu\210\253\326\200[z\202\200\305&\333\304\t\336s\325\254Z\233\247=6\331a\231Zn\206b\201c\257o\t\355\260\305\336Zn\306M\357\246\035\226I\261]Tpi\261B\204\203[R\262\342T\377,\\\360\236\335ZlS\206\004im\362\355\214-\251\033\311w\207\250\352\n8\245\246^\032\032\303y"
+	.ascii	"\346\376_0\336S\325,Z\233\337\346n7As.c\265\360\220\265\322"
+	.string	"2\004gm\200\311b\256\034,\025\216\230\314\025\003\006\342F\314%\263\001\003 \243\006\303d1W\016\n\353q\225\200\321\363\032\377\242\300\023{\265h\360\270zZ\257\237\033-\n;\367\251\001\373i\341\360\361\371i\241xu\303\332F\275\025`\233\022%\350\243g\324\001\377\245\224\222\312\013J\220\211\315\254\3153\340\b\213\352T\023\350\277\274R\356XAm\236\266N\243z\325\324r\263$\235\336/\270\245\034\321\216\305\247\376\206\361\020&\300-\025\021\351j\255\355\371\201\254}x\260\364\017!\202\367\f. p\202\021)\254\007\033\346{eC\266\207\256m\237\037\315\316\262\300v\f\274\330\207\005\340\304~\004\322\357\034B\224\211\333\262&s!\300nA\341\303MI8\232\257\341O]\300\r\220\354<\002\0064+h\210\362\247\317\270+\215\213H\361<\320\225\211\005\3262n\214\331`\237\371v\354VD\315\370\336\noX"
+	.ascii	"\205\006\036I\320d\2625\032\005"
+	.text
+	.section	.gnu.lto_cliGet.321.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`v\007\305-"
+	.string	"jQ\360\021F`\034R:_\250\357n\326R\245xw\220Q\026\217\277\376\341\271ab-\275D\307\203\233\266\177\201j\275\343\317_p\344zq\310m\256,\300xP\260\304\354)\003\204\020\213(\2132\032\033\260\267\366\177#\204\354\235d\n\001\372"
+	.string	"\026\001_\353`wCq\334\254\004\313\002\270\240\315/i\316i\031~\345j\355\261\264\030"
+	.ascii	"U`9\200\022\332tJs\316I_[\202\357+\221z\323r\314)\375v\377\354"
+	.ascii	"U\332\243\351x\200\234\305\330\340rNk\320\n|_;\355A\354W\337"
+	.ascii	"\201\330\257\335v\333\341\f\227\277\330f\023\231\305N\316y\t"
+	.ascii	"\027\351\340m\3573\024\006\201?_\217]U|\333\376\3323\214\315"
+	.ascii	"\305%\227\304\3738?T\031H\275\3209\032-\247\032\224\305$\371"
+	.ascii	"\265'x\242\365u\205j\317*\213\311\321h\005Q)\344I\277\374\355"
+	.ascii	"\367jY\274A\"[\315\003\023\204my\375\3076\271\214\371\356\003"
+	.ascii	"\332l\303\013\333\352z\217\t\\\"\331 $b\222<L\253\013\263@\276"
+	.ascii	"\252ES\362\306\370,\217\252\001\250\025\222\340\322\352\252*"
+	.ascii	"P\227\233\232\243\321\362R\225\324@\361\n.\215\027\377\355@h"
+	.ascii	"s\t^\330V\363\267w!\347\3347\271\334z\377\274\373?\335\335\242"
+	.ascii	"\233\305\023\270\002\230U\177\270\\\210\005lr6N\350\356\247\227"
+	.ascii	"\031Qd$g#\205\270\223)\241^\311\3276q\202=\301~]\361\337\276"
+	.ascii	"z1\337\2309\253\240U\335)^\213\263\332\302=\340*\275;\205\212"
+	.ascii	"\373d\257J\262\270\250\021\023[\r\263"
+	.string	"\002\233\301Xe\201\261\005%\031\230\350\305}\270{i\352+i'\250\373$\024\373\025\213I\3029\276\370\310=Uw\332\302\333\035\365\342>y\214\243tR\362\035i\021\023\273\323\212\027?\273O\301H^]c\261n\244\243C\337CO\373\021\034\355?\300\336\006\272\333{(\f\376n\003}\267\177\354m\337\261\274{\3676\373\333k\357\266\312\336\306\275\333\227\275\375$\bspgf\320f\020\274&-gM\363\344\350\372\245\311\335~,?\364\270\233\255\377\326A\267\032?\240\315%\034\264\274\255;\3307\316\326@\346\235\021\347Y\3169x\243;\370\365>Ku\216\316\tw\b\377h\271\312\314\"\334\241f\373\365\267\337/eYY\324\370\346}\201x\365\330\375\362\332!JB\272\340\\HY\306\345[\272\347\362:\355\220\005O\337\261\204\321\327\"\355\221\262\345\357.$\333\023%^=]w\344\313\263\207\237q\372r"
+	.ascii	"lq\222\301\244}\274\266\363\371.\304~\035\220\217M+Nn\327Xk\310"
+	.ascii	"\344L\274\363&3\322W \225\n\230\361\356\351\002\027b}\030\b\367"
+	.ascii	"E2\213w\232\344n\332%fu#~\324\260\342\354\260y\033\034\330\247"
+	.ascii	"\21057EH\226wt\223>\204\017\340\356v\254\205r'z\304\304.\272"
+	.ascii	"+>\227\247i\313\b\260\311\371\370d;\305w\364`\324Ri\253\b)\311"
+	.ascii	"\352D\2550\221%\272\335L\030\220\224dq\242EL\274\261\210\233"
+	.ascii	"\263\025?;\351BL\202\371\206N\355L?\212#\350\311\271\021Cg\206"
+	.ascii	"\360\305\306\344\246I \027-\017\2356*~v\016\226\305Tju\306\233"
+	.ascii	"\327B\027\001^q\367\206\016\367I6\255!\004\223\b\242\f\035@0"
+	.ascii	"\241\020\321a\330o\"\013D3\212\330\250\303h\262\201g<\305h\222"
+	.ascii	"\222\232\302\360\004\345\302\211F\223\324\017T\214(\030PRM\""
+	.ascii	"\236\244\234z\355\344 \n\206\323R\214\250&\251%'\252\031K\016"
+	.ascii	"\202zJ\006\024\325\022\215\251)\252\245`Z\325\261\230\262lN\264"
+	.ascii	"\n\027}\230\356\331.\326\216)\321w4a\364\365@\261\265Z\373\355"
+	.ascii	"R\226\341\th\313;\033\252A!\356\341\253\036~\300\274\263\242"
+	.ascii	"\326\346\362x\322\207\016\213\216\235\366Ml\037\356\"\277vU\016"
+	.ascii	"\363\316\311[$\333\267x\215-\262{\264W\367\212\375\372\266\033"
+	.ascii	"-\317H\235gr\252\356T*\304\317\036\312\001\2210\262\313\355\253"
+	.ascii	"V"
+	.string	"\201A\374\265\037\331\345&]\330=\304@\214\341\207\201\375\351\315-\226z%\335f\265\313v\311~\375a\2145\246\f\263\352N\257f\374\004\212\322Q\261\373\035\341V\261\020\007\361U\367_\203\035b$\214\243\214\311\335].\240\322\205\370\b_:f&\200\215\2501,\346\024RL\241\021\021\221\t\222&\035`\002\221\251\253\352\021\200\3013G\233Ba9S\240\237\023\b\031m\r\321\271\276\337\314\t\0163\346\263\334\177A\274h\246Nr\303\034/^cg\244<O\223 \3111\336\322\346~\351\320\221\264\244\331\"\024<\200\325X\001b\022\334(F\0031\\\204q!\257\303\310;V\0366D\331\b\0233\272`T\023[\257TK9\222\325\261\213\354\360\252\207\252\312\024\343'\247I\302?+\337\212\371<\377\256\234\2729\020\331]\346\261\366\353\034\313t\265B\025R\265\372\231}\276\001\331\204\250A\273Y\331\325M\270"
+	.ascii	"\244\022\346\272\003\236\016w\335\006\013\024{4\367\020/\022"
+	.ascii	"}\340\366\002\370:8\275S6E\336\200\377\023\213\345\357S\222\205"
+	.ascii	"\361A+\223\201\246\205\354\221\252\213\024\234\261t\347\331h"
+	.ascii	"<xX\334\255G#\255\242*\004X\300\030t\260P\250\017\225\321\036"
+	.ascii	"\352;\t\273\202\2523\013V\345\241U\306B\004`\335\362\233q\347"
+	.ascii	"\276\232\005\001\375\347\024\232a\357\330P ;\205\336|\260\306"
+	.ascii	"\036\206\264\343\025(\020\314\216`$\377\027\202\251"
+	.text
+	.section	.gnu.lto_getWordLength.322.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\033\001U\r"
+	.string	"\306\030ZC\020\257&\035\020\f\342\212c\227\022\016\251\004Q\271\001o\216\241Q\021}@\227p^\301\023F\355!;7\215\326\211\304\336\241\331n\210\257\035"
+	.string	""
+	.string	""
+	.string	"8\302\272\026\312\022\256 A\b\016\336h\204\354\275\245L)F"
+	.string	"E"
+	.string	"F"
+	.string	"-\361\202\r\212\211\232]\016\323\f~\231\035>\315\314\327\260\255\2109i&\207\3172\245p\020\240\231\236\307j\006\346\251'J+\345\333T\256O\375\222\331T4'M\345i!\330]\347I\243p\307\333\026\261m\300\276(\334\017\337K\253\246\363\334}"
+	.string	"\003^l\030Q\341*\027\273)\235\315\246\2000\035l\217\354"
+	.string	"6'\303\221i\037\304C\214\356Rr\214\335\025\024/\273\034\207\t\\\207\346\256\021\017\257g\304\303\002\007F\316t_0\004/\241>Em\234$\246\276\005\t\026\023re\277D\004\222+{I<L\035\331T4(\013\244\267\273\373\234=#>\345\250\204M\325\235x(e\247'bL\232*\213\315\231\244G\313j\306\272bs\234\276\356\362[\017\f>\nBD\037\361\343\021\001I\020\"\372\270\334\351\3604\350`\037\317\002\007X'\364"
+	.string	"\353\3200h\004$\204A"
+	.string	"\201B\230\271\375{O\177\351\006IKV\275\364(7\244\354l\351U\365\344C);\250,~\352\0305*D\334(G\035\032"
+	.ascii	"\3561,V8814\323 \321\206\330\212\367\017%@\334\035\353V\220\020"
+	.ascii	"Qfa6\nD\264\334a\323*a\214P\237\205\300\b\030\007\206\005\250"
+	.ascii	"\320\202\n\002\267\351T\215\034\024\345\3275\237"
+	.text
+	.section	.gnu.lto_cliGetSettingIndex.323.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`R"
+	.string	"\335\b"
+	.string	"\206Q>7@\217\322\001\233\355\013\203`\343\251\207i6\016U\327d\257\306\314k\036\352\021\241\275\206L\303F\332NL\365[.\303\350\002\360\035\202\313\203\247\3228K#\233\020)S\n-"
+	.string	"."
+	.string	","
+	.string	"\017cbE\322\262\033!\3005\357[^\340}S\216\243\236(\377#\307\310<b%\254V\352\311)\354\256\223\325\252\270\365\266\013lC\333\262v\306\266\2266BB\367\327\203u7#f\220i?\344\"\335#\304\003v]&\260\335x`\002\3147G\214m\377\343 \235Q\333\3024.\002\232r\352\365\253\027U\316\354\230J\335\260\257\255\272l\247\337\343\257\375\365\247\226>7\260\222\362\262\270\n\313.\305\314eQ\266\223\016\333]\f\247\205\321'\364>\242\316H\263\207\003\ny\340\b\324\021AO\311\0049\032\223\032>%x\"\221J0\023\367~\272Qi\204\271\274jj\233\034\362\254\247\033\211\f"
+	.ascii	"\357b\310\f\rF\210\b\267\270&\262h\241\203L\020`\204@\205\203"
+	.ascii	"\273O\252\225\2270\311"
+	.text
+	.section	.gnu.lto_cliSet.324.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\005\"\305\235"
+	.ascii	"\272\006e:P HY:\303\001\217Z\217pz\021iLO9\\H\241t\346\206\267"
+	.ascii	"\366,+r|\203\345]}\231c\331\013\305#\367\333\326\210\375\306"
+	.ascii	"!\370)\237\366\032\253\025\373[\345]j\264\b/\025\265\032y\351"
+	.ascii	"\301o\005\356#R4\020\026\330C\204H\231d\230\003;\003\231\003"
+	.ascii	"\274H%/\206!\336\013J\336#\021\357\317\020\257Q\311[\374\341"
+	.ascii	"%\236\267\205x9\311\373[Q!\346\266\366E:&\245\361\334V\257C\302"
+	.ascii	"\325\256\310B\227\017\376}~\302\277\3607\374\001\177>\277\337"
+	.ascii	"\237\347\357\373\251\277\336\277\367\333\371\351\374\323\177"
+	.ascii	"\356\247\373\347\374r\377\232\237\315\337\346?\363\227\371\307"
+	.ascii	"\374\322+\355\276\317\t_x\303\037.2z\246\312A\025gTM\225\256"
+	.ascii	"\352\270\242\375H\243rhsU~.\322\226\220\031\224\362sJ[\262f-"
+	.ascii	"p\3131\220\2074z\345o\312\031\365\332\343\303\212\264\314P\317"
+	.ascii	"\"\373\250\252H\313\370\252\307\263\257.\262\357\003\023ZD\013"
+	.ascii	"\355\256\344\375\316\371\366\252\312\244ekR\216zO\244elU\007"
+	.ascii	"\0347\256IT\264O\340Z`\013{<;.\242\202\324o\335\275\316\"\247"
+	.ascii	"\033\267\324r[\301P\004R\327\030p\244\243'**h\3476D\316\347\274"
+	.ascii	"n\221r|h\353\2726\321m\334\361\352\353(\035\353C\013r|qn\343"
+	.ascii	"\230\242}n_\036\034\343\366q\344\220\020W2+\226\223\026Q\276"
+	.ascii	"j\0175\177\263\213\\\"\217[\241,&-|Y\327\025\311\346,\334\315"
+	.ascii	"\"\333\b\tZ\355V\240\021\244ck\0028\276\370\"K\204\025\213\212"
+	.ascii	"St/pS\254h~M\b\3045l\275\312\023\025\345#\263\026H\001\221]\244"
+	.ascii	"\004\366h\026y\306H\231tL\313\213\223\331\233Y\344\213e\220<"
+	.ascii	"\221\216e\211\340\370\"\362o\207[d\004\276B\363\322$AXfk\222"
+	.ascii	"\004\347\330\230\003\307\027\227\304+\215c\032\300+\324l\025"
+	.ascii	"Z\"\035#\253\256\253[\323\213\033\265\313n\r\250s:\357~\355l"
+	.ascii	"\315\267Y=\271\256&\220Y\263\256n&\226\351\370\342\272\235\310"
+	.ascii	"\370\342\361J\343\213\333\334\305\323\353\232u\3148\026\205k"
+	.ascii	"\205\300u]\241\332\312\376\254\322\376\360D\267o\bb\363,VD\251"
+	.ascii	"H\201\342\004\324\223\t\247\246\022$\026\030!\"\004\023\b\005"
+	.ascii	">,=tX\342\240\224\204tdTD4\244\024J\006\001m\320\220\001\211"
+	.ascii	"\341\302\361\307X$67\367\030\300\256\316b\305\317\213$SZ\230"
+	.ascii	"\\\224\212\275\247\270\343F\217Q\234\200\322\253\343'=/_s\330"
+	.ascii	"\004\225\216\235\250r\270i\256\304\261\346Nb\002\013\334}\311"
+	.ascii	"\035\306\341\021w^\276\332X\004_\032\016Q\245\t\2323\251xR\327"
+	.ascii	"\300\200\220\242@\264\353\203\261l0\272T2E\r\311\234\271\007"
+	.ascii	"\t\230)CFL\261\003\337\205\\D\t\335\320|\311\313\335W\027\346"
+	.ascii	"@\3541pp~\367\225Gt\301\366\005\313\361\326X\251J\023\265'\205"
+	.ascii	"9R\0300|\024\206\350\344\345\353\013\033\341]\210)*\250\366\""
+	.ascii	".'\332R\207\013\017)\177^Lir\347B\311\023\274|a\341\240\273\257"
+	.ascii	",\304e\335\025\006\3720\245\211\3367\334\211C\306\032\312\306"
+	.ascii	"8\203\0326-\306\fS\276\244\0303\330I\203\262\037\246|\335)\""
+	.ascii	"\243\242{\3245\301)M\360\034\303\357\276\242\270\201\302\027"
+	.ascii	"\210J\2613v~\367\305Gt\262\223\006\345p\377\340\345K\214\217"
+	.ascii	"\304\237-/.\277\373\302Cl1Xe\341f\234\374\023}r\343\315\274\002"
+	.ascii	"*L\342\336\360\314\200=yq\213\211\304\022drF\370\335W\030\221"
+	.ascii	"\210\016\225=$\230\0267\261D\225\315\337\006\260,\"\221\027\227"
+	.ascii	"\347\341\316]`[\314?/\326u]~\2025\3712\360]\"\216\335?\355.!"
+	.ascii	"\t|\350\310a\350\263\225\352\013=\344\215N\213\007\247\\ \276"
+	.ascii	"\t\373\323B\306\026F\001\037\377\206)\310\354\303\177J\365\337"
+	.ascii	"<i7m\263\nV9\350c\263Yt\017\016\fV@\3572\017\233W\374\347\216"
+	.ascii	"&\001U\003Cq\035\255\200^@\364\316\241\023\205\bXGo5\271\370"
+	.ascii	"O\016\372n>T\235\302q\023\2546p\302\0333\027\262\256\243\231"
+	.ascii	"oz\0170\004\3378\243\006]\315%\374\247\216\006\003\r\343g\307"
+	.ascii	"\306/\317\313\261\317\026\b\212\361e]\034,n\227\214\376\351\030"
+	.ascii	"s\214\375#\306P\232^\304k\331&X\323\211\023\343\213\306f\302"
+	.ascii	"\022\206\305\207'\256\353\272\376\364\031\022\243\214~Y\337\314"
+	.ascii	"\221u\242zuN\262\025\274\333|\322\024\313\020f\216]V_m\n.\366"
+	.ascii	"\243\364\006\275\333\034k\226-\235}\265\304.\366\271\f\371\352"
+	.ascii	"9\232\330E\242z\200\\n\262\370p\241\270\373ix\204&\025#\352\331"
+	.ascii	"\321y\tXiby\300l\253\257\2620Xs\313\023\213\257f\027\023^\335"
+	.ascii	"FT\230\274\021l[^bD\004u]\265\376\334]\346\036\2066\273D]YW\255"
+	.ascii	"\026/.?\271\253\031%^\313\213\333L{6S0\276\370(}4\277@\030\325"
+	.ascii	"\303{\222\200\305\207\335pp\266\300\214L|2,B\023\214\321\225"
+	.ascii	"uu\376\331T;:\257\302\210&[S\f\377\271H\3200m\354Z\\\031\254"
+	.ascii	"\026\373lK\\\207\221\373\206\313Z\3143:\216Z\366\r0\276\310]"
+	.ascii	"D\323\005\005\213\017\331C[\n%\020\373l\377$\306\034\375\023"
+	.ascii	"\336\362\264x\360\353\226\365\225\223\306\001K\272\317\366I\214"
+	.ascii	"9\372D\030\037*oyZ<\270\357\034\315-p\031b\361\341z`\rz7\206"
+	.ascii	"\f\376\363}\270+\327L\333\254\021\254j\365\325\256[\326\377\224"
+	.ascii	"Rg\n\367\331\356\377\224Rg\312\266\t\273\247\363}\225\"\336\233"
+	.ascii	"\275\314\367e?\363}\224\313}\357\344s\276\367\272\235\357\231"
+	.ascii	"|\372\375\363\324\357\225\\\357{\021\336\367\275\363y\276\317"
+	.ascii	"\272\337\367\353\371|\255\016\370Mr\275/\222\357}\217|\360\013"
+	.ascii	"B\021\257\220\367\371\0029\341\367\203\027~=\270\341\227\252"
+	.ascii	"\210\367G\021\257\217$"
+	.string	"o\007g\363\235J\362\366\370\230\357\216!^\251\217\371*\340m\276\034\274\355\337\340c\276:.\375\346\270\333\257\201\222\367\306\251_\033\327\373\326\270\235\357\005\247\363\005\300\247_\032_\363\265\340k\2763\276\346[\301\313|e\234\227\002%o\f$\336\t\224\2740\210x_ \361J\220\344\215\200\210\027\202\037^\027?\274\017(y\035@\342m@\210\267\005\022/\003E\274,\222\274+\224\274Q\314\253\202\2107E\222\027E\222\367D\222\027\n\211\367\211\003\257\t%\257S\222\267)\311[\002\211\227\304\020\357\002J\336\021I^\021I\336\020H\274LJ\274 \224\274\n$\361~@\342]\026\361zP\362vH\342]B\342\345@\304\253T\304\233D\304\213\244\344=:\257\321\021oQ\222\227(\311;t\304\2534\342\025\"\342M*y\203\224\274@D\274\033\222\274\032\212\002\037@\364\266\bV\201\3142*\005\032\204\002\215"
+	.ascii	"\250\230\272\017\275\354g5\221\357C#\361Y\366\365\234\361@\305"
+	.ascii	"\314\375\375|\347-P1qK\017\275\255e\245GH\007\352\007tO=\035"
+	.ascii	"\332C\023\371\f\300H:t\002\240b\330\226\232C\337\331D>6z\251"
+	.ascii	"\223V\3402\024\302ST\230g\374'\207~\365\034\b\025\003\306\216"
+	.ascii	"\367<\203\0304\273+.\314\220\307\227\345\241\317\266\327\345"
+	.ascii	"1c\205\313\206\035\205\366\341>h\200\313\201/\323C\343\263K\034"
+	.ascii	"\241HZ&W\365\361\302\311"
+	.string	"\206\313nG\266\217\032H\272\253SA\263\022\240\035\254\260\236*\t\260p\036f\026\027W\252L:\306\240\260\302j\037\236#}\276c0\365\232\003\246\r\353\013 \232\340R\237\255\206\277~\353\333\252\343\320g+\001\224\2443y\231\264l,\312/x\225\223 -\223\002\200\244\n\316D:\026\207KM\021S?\243\273.h\245\326\360\3676'\251\225\372[x\257*)(\214p\317\035\275\244\366 \313+\215`\333\302Q\331"
+	.ascii	"*\365\331\262\021S\317H\214\367\343]I\235\372\3419\332\207`|"
+	.ascii	"\225\356Z\242\321\214>\036\2374H\177\b\306%\036\315\350\n\370"
+	.ascii	"\311/\3503i\240:Q\301>NB\272\240\221\006\353\236z6P\263`Aj\372"
+	.ascii	"Qg\340\362\203w\264Q\224\231"
+	.string	"\306\177\036\265q\354Nz\330\326\216\372l\337\334b4\352\f\\\336\364\246\0314\2670U0\276h\324\357\202B\324\312.\352;Q8~\347\214CM\324wz\271\240\207\332\210&\005\266c\252P\024\n#\fd\356q\035\023\314QR\030\341\036\035\317a\2521\331\230b\230\0200\276\250\354\343\275\350%\2140\220\214\255\315\r\314L\320\250\317\226\207\037\tD\1776\217<\177CM\247\321][$\324\1776q\2057\236c\256\300\342\n\034O\200Y\346\211\032\207\260\216\034\034\241V\312\362:#\330\206\305\207Dj\377\321\257C\250\366\226\307)\234\3144\017\232\340\220\362q\0360Fh.\216\270\256S$\250\216\341\303\305\301\311\345V_%\373u\242}x\\\206{\247\253L2\2509\314[\335\334\203\032*\217#0\246+\310\253\201\350Nw\240\006\2322)\024\f\313\301\267\273\234\333}\316\272y\242a\2521\001U\363\2633"
+	.string	"\267a\306y\365\353>DfJWT\242\345"
+	.string	" \034|'=\025\2079\327"
+	.string	"T\255\215\335\3429Ap\203\223\336\320\277{\253\323\342A:.\223\344\211\312\254c2L:\304\2440@\263\027\341\244\033\372a\302"
+	.string	"\315\310\330\3324\364\235t\363\3412\274\301\030\276q\306=\263\005\343\016<f\036\377\251\241\037\347\234\006\252\306f\347\3444Z\250\032\372l\211_2\n\221\013\373\003|\313\373\021\342\345<\346\334\002\253W\\\370\003\007\2550C\333\262\230\257*\240k\213\347\210\020\215L\n\230\3450n}\036\260\254\302\362xeE\021(\267\366e5K[Fa\361\034\327\365\352d\373%\343\213C\253sL\016\032Gw\027\317O\306\317\225\304\213?\322\314\270\330po\367%#\262\177\3642WX\026\037\336a.U|\264\266\245\331\245x\024\366\267F\266\226\205\265\0301\276\210\354\003\204\375\355\221\261a1\302\344\001_ivy\2622\325M\367$A\25214W\243{\207\"P\330\243\007I\203\037\307g\314>'f\236\243\363,\214xq\003?&\237%\250\232\230\235P+\203"
+	.string	"5`\024`\303.\205\024Y\022\t\201\\\rp\004\300\206\214e\006\030T\260\034ab\3042\003\f\226\003\310@\006\216\03002\200aA\214e\217\020&P,eL\260\3041"
+	.string	"\002\330X\316\270A#\003\034\0038\261&xe\330\200qcI\001\215\0320\np\203\206\206]B\260$\022\302\270K\007\210\370\bBU\244\310\024\221e\221 SC\206\030\211\241\234\002\262\003\004#\027\244\212H\365 &\221\0322D\n9\244H"
+	.string	"\200H\0351\026"
+	.ascii	"h\001S=\202\320(\202\241\307\324\017\036E\244\252~\202PU\365"
+	.ascii	"\002\244\252\272\370\243\210\217 S5\246\200\354\220\242\032\""
+	.ascii	"uD\250\307\224\217 R?bL\031\001\"u$\003\020\251#M\365 S@zH\021"
+	.ascii	"\020B\230*N\005\241\0022U%u\243G\025\217\237\345\361D\005\204"
+	.ascii	"\007T\020*\251*(\036C\210@=\021\255\020\020\246\206@\025\021"
+	.ascii	"\"d\b\024\322\r\353m\302\276\300\352,+,\232\260\006\275\001\235"
+	.ascii	"U\235\030\324\316\330Q\231&\324\025\177Q}\306SS\253\026\354\200"
+	.ascii	"\265\031+<\247\274\243\223\315\240SC\273-\264\257\322\to\374"
+	.ascii	"Tp\323\247\246}\354\240\230\202~\\K\255\356X\361\035\235<B\277"
+	.ascii	"5\267\024\203\326\306@\200\202\"\232"
+	.string	"\030\\\225\214\255\r\371$\313JAT\232\321\034\202\361>\346\214\222\341R#\202\361\276D\0163\332\002\013\272!p\246\215\216\337\364[\353\025S\224On-pu[I\334\315_\\q!\020\027:\205(b\264Y\365EYMc4\222J\330\337\033\036\234a\261pP\355D\2379\271\203\246\352\t\370X\001\0221\233\2405\200NAT\265\240`4{y\323\353\240ym0V\202G\253>G\347\355F\274\b\243X\326\321\257\350\016\276{s%<\275\370\240_\364\367\2441\201\373\025G\320M\227\240w\255\016\231WK\tz\t\244#\350\243\220\266\344\220\313\020\313\004\004\315zou@\032\202n\023\f\213M\360\3709\225hzR\325N\2246\022N\277\321].\372^\336\364@\350\007\332Ew!WX\32690z\320\0174\177I[\322 \364\367\322\226\300ir\240\215L\356\321\r4\325\026\323\201~\232\231\263\257\032"
+	.string	"\241\004:\005\003txxx\270\242{t\211\237\022\356\210\221`*1\266h\343\0331\351\235\267\274\356\322\374b*\2612\276\330\242\223\320tAa\240\237\307L\253\257x\201\264\337\254\0029b\322\276\267<-\300\263\350\233u\265\226*\b\2620\235\2608\201I\007IJ%\223\202\345\n\213\376\237\230\224J\306\266\244\253\234\231P\207\312\024 \202^mV\305"
+	.string	"\025\254\313\230N\242\232\214I\247\030$&\265\353\261\226\362A\003M\303\366\300\264a\265\007M\244Z\3219\240\3232\030\274\203\252\177x\016\003\235Fa\263#6\242F#\257\340\364\\\371M\357'\242\317\326\310\031US\322E\32221\\j\226\232n\243\273:8\243`\270\3240]\204\346\300)\340\234\245\035]\303FG5\337\035\351\250\336\360\346U'\013\017\316\220\005h\b\247\333\350+\351\177I\353\272\212\276\b\335-\030a'$O\230b\374\247\212\256\332y\362%X\335b\302\224\242\267I`B\221\360@\321)\232\310\307\0218\277\035\t\212\270\023\375\324I\210P}\002\352\251\037x\307\346P\r\204\211\336\006cj1\243L9\265\t\247N"
+	.string	"\364.\255\251I\264U?_\242\233J\220\350\377\335\225\021\336\211)\260@o/\2612d\216\371\030\321\013\214h\016\240w`\"\232\251\2776\261\220C\264\210\020\235\024\307\324\337s\036\204\212)\024\004\f\202\215\250\322\360$N\322\244bL\321\214\210&I2\254\001\322\n\020\206Bi\034\327\222\017\022\200DA\007\224\212\221\022\021\022%\331\237\003Q!\306MN\3534\016@\233zB\033\254\325\222S\007\036PM>\273\254z\242K7\2501<\352\t\222V\222u\204\016u\260\005\253;\325N\r\023\360\267\360\223{0\336\216\346\265\222\252a\275\323L\332\340\207'\375P*\254\322\310\200\"*\276\034\3529\311\030)\301\002\b/+\366\351\371\354A\032D\364\252gk\272\252\243\343V\220\221(\374g\f\334\310a\276\b\030\374\tG\324\303\360\346\032\247\021/\336#\033 a\362\241G"
+	.ascii	"nz\316\206p\303\253\2749\363\022\006\235\032\213!\234\277\003"
+	.ascii	"-\252/\216\022\255\231L)\023\344g))\216<4\036\230\013\347\326"
+	.ascii	"n\006C}\027\034\320_>\007\275>(\310\202P\334\362\013\225K\360"
+	.ascii	"u\222D\251h"
+	.string	"f\250;`JvF\324\367\226\2664\035\343\"\r\376\357G?\020\347<\n\262J\206\004\223\352\336\034\t\033\364w-Y\202J\304;%1`\315,\315\224Y\301O\033[e\017\222m.\b\301\277_\025u\205\215\257\375\357\023\3433:E\264\031\026{\237\374\013/\212\230\232\240\210S>\330w&\022\007}/)\n\210\236w\265k\202\023{#\325\326JJa\017I\362P\245\366LC"
+	.ascii	"'\343\275-)v\330m\001b\3722I@fb\304\203L\324>\031\266k\261SH"
+	.ascii	"9\204\032\262\261F\3254\325/(^{\030\307\244S\n\204\273\306\013"
+	.ascii	"\360X\304i\364a\256\345\340\t\215&|]\210\345\313C\225\246\256"
+	.ascii	"^8\020\310\225\255\0329:\rd"
+	.string	"\314\346\213\344\203\206\225\243E\305\215\023\231\306\312\260G7%\363\317\345\215M\353\375J+m\240d\n\255\375\325\t#+\347\240\342y\270\3776\361,\013\204\306\361(BmA\023Rv\344\345.\357+\323\266\006\271\275\306\306\277\276\223s\023\371Tb\230\262\341\by\b\202z\333\362\017\020\tF\356c\201~T\344`T\310\362t\222\374b\274u\343\226b\001\335\005\3214W65R\213b\004\3737\r\230\022u\323\236\226\371\023\352M\240\343\211*\234s\276\371\225#d1^\221\013\377s\t&M\261\002<l\346\021\224\331m\277\253\354<\344\033R\3639\322-S`(G\202\307^\"\315\f\273\330l\n\021v\005\275\334\347&\255\244*)j\310c\002\243y\\\240yc\351l\340\337A\267\343I\265\321f\",\342B7\255\342\002\223 \032\252{p\006\302\271j-\317cy\341\262\331\275c\f\016\373.\253\226\205"
+	.string	"\243\203=\3275G\366\2052p\363o&i\037\034\333^\365\202\262F\222\036\2031\207%\367\223\372\235\344\231^\253,\231[>\236\376h\004\334$\365\032\275+\225\373\212\263\212\264k\030\274\324\240\034\331PT\214\243\002uW\216(X\216Pp>\375n\366)3\3577\302[\3304\301y\203\233x\205\354\212\224\206\003j\026\217\177\225\367\"}:t\332\232`N\350\034\022\270\n\317"
+	.string	"\366\2710`\340\226\276\363*0\212\253)\226\033\307\364\322W\013\003\212>\312\355}\t\347\213?\314\361\206\243\200I\304>\367Tt\0012\234\265\017Y\214\177oX\231\240\360\235?\201U\200U_\327$e\235\207\002\034\211\343N\254C\"\022\302\254\237\251\303\255\317\004B\006\020\262=\300\232<\315\233\335[J\315\216w\004\206\366o4F/\216\242C"
+	.string	"\360+\335\270\004\0374\206\331\251Q<`l\257\327\330|\247\210m\244\314n\207\222\236\036(\002\372\2057\367\034\261<\264hr\027\\\344\243y\272\312\217_\217\333\277\033; r\026\320\277\311\317WX\033}\302m\300+H"
+	.string	"(\312\b\201,\363j\227\005\376^\235(:\364?\234\363\225N\272\372*r\316\364\337\024\252B\264G\030x\304\025\211[\001\036\025D\345\351\257v\224\030\266\367\370\227N\316\211\2602\250L\253\251\037:\"\"E,\025\357\036\2350^`,`#WWT8[\243\223\007%@T\272\316*\345\200\375AU\336\265\276\362\031\356ya \245\2678h\272\362\344\231\222^fz32\021s\361\242\310y\361\271["
+	.string	">"
+	.ascii	"\267\334\260\f\002\326!j\265\272:\\^\313\336h\213\307\202\b\214"
+	.ascii	"\357*x\264\"YP\020\374\211i\302[\024!\376x\224\240\372\306y\362"
+	.ascii	"c)G~OV\340\215\321Y[\300\205\340qGi\026y,\031\353\321\030\020"
+	.ascii	"H?\233\341F\t\025\275\333\322{\214\275\f*ho~\034\007\242\023"
+	.ascii	"\367\2330\257\210snM\350\320\322\312\233\356b\277{\370\363\327"
+	.ascii	"Zq\f\322 |\227\223j\324\250w\225\232\373\004\243\3550\223^\326"
+	.ascii	"V\3511~~l\210\367\261P\023$+/\2616\016e\020,\251~FO\322H\215"
+	.ascii	"\2304\314>\326\006"
+	.text
+	.section	.gnu.lto_getMcuTypeById.325.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\274"
+	.string	"\245\013"
+	.string	"\266UOC\020o\225\016\003\273\222O"
+	.string	" \025d\372\271\372\260?Q\303\262\013\215\354\302\"\027$\007\255\240eC\030\353\232\223j_\242`\t\220\"\244\031'\240 3H\203\236\345DQ]s\237}\206\026\371d\357-S\n8"
+	.string	"<"
+	.string	"="
+	.string	"-\330n\2709\274%\373\324\336\221}F\t\347.\243r>\351\262\242A\261\002Ox\237\203G\215\317$/\273{\326\025\365u\252\025\315\356Z\275\257\301=o\233\304\366f\177$\341\257V\177z\200Pi"
+	.string	"\017\226\330e\020c\261&\346\213\202\355\221\235a[\325>\206g\030=\024\371b7\302\b\327n\b\342\017\355\363\"m\373\026~ad.d])\b\331\352\301\202\245\330I\005\357\300i\273+\342sx\013\201?\341\323\tBz\357\323\017\305\215\016\f\241\342U\322\230\356.)\266\270(\323x\326e\005\360C\212\r$L\272\302\016I\032U\366\345\306\224\345\003\336\240\230lJ6'\032\200\216\232\223\351\b\340l\004:)\0036\316\007\264e,\366\024\b\360\331\016x<\237\315\341^nLY\325\367`"
+	.string	"\243\003E\300vO\367@\332\t\203\371<\353\034Q\306GT\264&\024"
+	.string	"\3561\322\026\220K\033\204\213"
+	.ascii	"\323X\031\302\300A\230\363\030C\240+\351\202TX\315\205\334h\f"
+	.ascii	"\007\252=\232\214=hW\224\022\220\252\322:\343lW)\003"
+	.text
+	.section	.gnu.lto_cliStatus.326.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`3\024\005k"
+	.string	"j\272\204)M \224\322\032\003\340\223{\222\214\217[\362 \265\341:q\271\244\201n>\320G\372\007\353\340\327H\345\3378\364W\257Dl \037bw\370\020!\b"
+	.ascii	"^\377\370\335\302\2537`T\305>\332\214\366\341\3600SMDj\211\201"
+	.ascii	"\254$2\245\224\002\202\002O\002\227\002"
+	.string	"\f\304:\377\2643\033t\366a\235{Xg\036\3269\370\343\274\303:\353\3708\003{\234\177A\3475\350\354kg\225\307\371\203\316\036t\356v\262X\203[\213\362&u\362vm/\330^\022\357\324\027\227\326i\272\313tO\273\305t\177\351\236\353\266\322\375\326\255\245\273\207n\270\356\270\346a\356\037\322\340\230\242f\rN\030\031n3}f\232\305\026yS\213!\357}\333N(\303\345o\024\311\033\324\302\233\332\223\274\2540\334c8(F\331J\231|Y\203\023\002\030\016~A\266\316\266W\214\005\032\234\265(\357\333f\243\345\270}\340\340\234\023Qz\226\245\006\260}\337W\032K\357\320\\\272K{\341\340\212\026\313\216\033A}\207\274\3146M\322\263\266\017\340\224cSR\264<\b\200<\364\226e\367\240\343\347\235\276\235\302S-\b\006\200\355\353<\246\026\256YZ\207ek)\341\207\211\344\355\025\236jwy\357\033\246"
+	.string	"\334N\013\3277\236\373\351B\362\002E\337\324\344\344\275\357[\325U\332m\331Vx\250o\226\267\013\210\223t\312\22758\357\333\006\325>\036"
+	.string	"\330\276V\3656\023\356\210\355\314\275\326l\313\246\302\325@\357\273d\007\270\367m\213\342&`\373\270\255\207\326\366\001[\270\266\217\227\314x\377\302\275EVi\023\257+p\336\367\225z\030x\311\267\303\277V\333\232\201\352\262\231\226\224\222\220\216\214\212\210\206\204\204A@?\254O\017OpG\007\370[}\352\373\222[\225\256\321A\305\230\315\244\376|\200=i4aTT*$\362\342\332\313\232/\2750\306\326JD\351\224\351\232^\2221\266N\232\322HSn\360#)m\244\266R\242xQ\222\261\264&J{\342C1\264P\f^\234\270\360\227"
+	.ascii	"\230\026j\222\242\301Y\323{a\254\254\203\2304\020\0234\377Q\237"
+	.ascii	"\214\214Y\241\207\316(\021\242\317\2349{\244}\032M\330\221\206"
+	.ascii	"\022f\304{\306\024q\2363L\032JX\013\036T[0\2012C\217i\023h\302"
+	.ascii	"\210\250;s[\2704\2306\001%\254\211\357\230H2V\326:*\020M\030"
+	.ascii	"\231J\345_bM\007\27606\244\177Bz\335\021c\241}\352S^\227#|\304"
+	.ascii	"\236\352\020\330\023hP\314\207\253>b^j\373\276oP\314\351\337"
+	.ascii	">t\006\322\263,kzI\306\206\264\377\022x\337\227\035*6\326\\\242"
+	.ascii	"\231\335\212\331Y\346\037\265zy\315g\352\274\031\007\241\277"
+	.ascii	"nv\2207\265\037^\\\234\277X\375\265\370\366\322\035}SC\301\213"
+	.ascii	"\213;\263]"
+	.string	"\374\327N\222\376*X\350\230\300\265{\204\225\325w\361-\376\213\331}\364\213\357\346\0235\313\254\270\371\257u\237o:Ga\311,j\002\237\016\346\343\231\334\355\264\276x\237\377))\343\241i\367f\244\351{+\235;\227>\226\274\200O\217\246\210\336\221M\235\317\344\034\236N\272\370\336\214GX]\274\005dri}\005\354\t\n\352\2331T\367|\322\355\316\351H0\261y\276\347\333k\310\213\017>\3177\233\347\234\246\357\361\316\007\277\177\370\233\005|_\247\013\3569\275\267\374\342v\322>^\246\260\004[\202\255\355\333\371\366\241U\"\310\344\316\214\260Qy\250\2211b\317/\274\345:\211%\020\366,\b\360\331q\204,\311\366\246\316\337\353\350-\211\f\025\001>\033ny\004\370:\037\3455GJ\311\322\314\033\n\374U\f\t\021m\331\304\033\372{\036;8\276\250\235\021S\337\257n\2261,\323\200\317n2\303\372m"
+	.string	"jK\033\274\241\276\347\261\0333=\341\314\313)K6\247:\2660\275\274\326\375\325o\271f\243"
+	.string	"\253\346}\237\r\205\001|\266\020\024\r<\340\r\345\366\371LN\362\177\346\tbxC\325o\235\317d#g\276@\2067\364\277m>\223\017p\2665r\355\367\357\347\r\315\256k;$\267\023\326\200\2067\224\306\332\276\376\035\262-j\214\260\r\351\362=\346\266\246\277\031sS\235!\221\307\277\204\271\347\232\273\271\3544\315n\017\3269\253\337\232E\350\267\346+\326\371F\177i\006\241\3134s\320\323\346\rZL3\215\206k\236\301:\313`\235\r`\235\013h+\315U\375\326L@\177i\246\352\271\346\027\035\327\354\242\343\232[\264\363"
+	.string	"Ag\026\254\363\n\326Y"
+	.string	"\326y*\350,\305:\253\360q\216b\235\211?\316P\355\374\304:\247\360qvb\235Q\b\235\003\020:\017Y\347&\326\371\204\320\031"
+	.string	"\241\263\t\037\347V\350\\B\350\314\304:/\261\316J?\347\244\2403R\320\371\210u6\nr.b\235\211\200\234\207z\234\205z\234\205@\316AA\017Q\274 SgR"
+	.string	"\237\365Fl\206\001|\322\225\246\037~\022\031\035\272\351_\013R[\235\2319F\"|g\2513S\246\b\252\t\370/\267>\361<5\360\2117 \212\007\344\b\200\027\341\375\212\t"
+	.ascii	"^%\363\f\323|\023\357Q\244i{\317<\245\025\330\242\030\275\031"
+	.ascii	"\373\020T\033e\2513\323\003\321\215/\340\277\256~\212\214.\216"
+	.ascii	"\333\335_}oq\321\332\177\212\256\211\243\026\225\370\033o\264"
+	.ascii	"\345Y\206\351\231K\0271\3662;9\337\267\353D\211G\002\342\031"
+	.ascii	"f\351\231\036I\3163\257\313\367\252\364\322\257r\2208\237\331"
+	.ascii	"Do\306\3556Y\225\236\347\205+\367v\323Vfw\006W\352\rU\372\252"
+	.ascii	"\350\032\275\251sM\233\351\020\321\251(0\344Vx\326\2049\362\250"
+	.ascii	"i\271\346\342\332"
+	.string	"\300\244F\212;\345(\272\006\3144H\013\022kB\314N\372\032Eo\271\336\301\305\001\bevsp\335\274\241I\177\024]C7u\"}\313y\r\356\025\026\013\360\351h?5\355\352\260\036=\322G=o\350`\213\313\305\033z\364\276i\235\230\251^\036\030$\3027\253@I\031\027\031\202\214\322\334.K\256\027\340\323\227\024\275\321\367\022i\223!\274\346\374\210PC\006\324\036\254E\357P\334\356\3349o\342\201\024\263K\347L\\0Q.\332\307~\346h\256\0302\256\0313k\373\212^\n\215J\227\357\365\233\037L~\334\270\005\321:\007\317~\243q3\367\214\233\006\370\364\"K\321;#\246\317g\262h<\211\013\204k\007|:Y\233\242\026\344\234\361\241z\013\310\346pp\273\363#\031\270o\332\312\231\023n\020\326\366q\360\277\345\253L\350\203~\350\373I\003\260Y\314*|\241\357'\224\r^\370FW\274\346\264"
+	.ascii	"\002\260\314\211\270A\254q\331\260Y\333\027\364%\224\224\321"
+	.ascii	"I\031\342\016\321V\316\336\367\245bg\301\205\270m\330\215k\204"
+	.ascii	"\033\261\266o\203\3573MA\2322\037\364\342\272|\217\337fp\n\321"
+	.ascii	"#c\347nn\375y\031\317\336Q4?\350x\336\214\035H\003\321\370\031"
+	.ascii	"\017\364~&eb\3475\344\347i\374_\361\232C\365\304\376\301\300"
+	.ascii	"\255l\316\315\356-\211&\231\025 i\3017\343_\230 \020\276\301"
+	.ascii	"t\320\227:/st\270\221+\325\177q\255\354'\335\202P\301\305\334"
+	.ascii	"7T\354`\036\346\352\251n\034W\316\352\312Y\333\307~\217\351\n"
+	.ascii	"\232erR\342\274\013\033\025\216\354\270{3\276\203\350\035\333"
+	.ascii	"Y\235\027\031\002\254\034\266*W)"
+	.string	"\257\214\355\r\255\253\254\244\002D\254\343\230UL\332h\215\307\0349\220Ic\273\003Y\003\207U\021k\001%V&\221\311d\003-\214\025\021\260\234B9l\243Z\036\311\343\326V\261F+\3038tjg\b0\245b\252}jo\024\267\260\2203P\360\006\030\264D\343V1\331V\200\001\007\017\264\304\366\210e\305\303\252%\016\207\306a\225\006\026\300p\200\225\031\264[Z\307dR\007\214\226(d\245Q\013iuT\266YW[94h\263\216[J\0362\220\330j\250Be\345\360"
+	.string	"\345p\345\226\370l\034\266\310$\217\033\255\016\023\235\253Z%2\311\343\201\037\266j\217X5\212XWE\022\212\355\216b\214\033W6\264\2200\236x\307p\307T[\245T\036\223Fc\261%\032\207m\325\261\307\225\262\305aU\334\222\321\304= \210a\034\036\200\303\n\211\005\243U\016[\r`\304\020*\2219\266\256j\254;\216F\255\b\204\307d\261\004c\262\b\201\322\007\207\262\230\245^\265\022\231\343\215Z:\2206|8\224\305\030\312$R\251u\224a<nY\035\267\216F\241\r\0355~\313\350\307\255\"\006;\222\253\362F\021\313\206\357\250u\205u\314*R`\314\262\372\261\225\212+,+)\255\253b\226\224UR)\245b\210\2219\216I\251-$2)\025l\353\352_\022\035\"\310\264\353\233\\\202\026\035\352\373&A \257\212\357\rE\207"
+	.string	"\302Lo\306\375C\003\301\251{\203\247\264|\025\256\356\r\225\244\036_\305c\255R\243\220\221q\243.\r\360\r\204\337\271]\206\324\257.\267\343\002\002\341u\\\\n\270\270\006\370U\t\0213zqU\317\342\227\337r\274\206\254x\026\002\374\212\3679\2572\367\211-\300w\024\351\2247\317$\210\336}'\003%\242\235^\365\314\\z\\q\326\206\022}\377\320\276\026\305\213\363X\350|\210)\035A\265\221\232\2726F\220\262\336\200f:3\327\236\313\364\206\366x\t\242xo\374\214\333t}"
+	.ascii	"\237_\004\236\021S\247T\031\327\313\375\001|>\335\227\024\335"
+	.ascii	"\264\t\325-"
+	.string	"\347a\334\024\300\200\317\307\202\327e\352\343\351\211\257\202\316\025\003\002|\376\221\326\353\231\034\365*>*H\324w\034\250'n\221\271D\274\241P\277\316!\031\341\210\353\2027\364\351\310\264i\300\023\360\005<\212\237\352\342*q\315\200O\377\322\364\222\375\220\342\247\236\375Y\204\323\247x!i\024:\030\234^*\212'd\332|f\025\024\357\013\201x\250\201$\345\024c\244HFD$I\222\264\006A\005\204('\241\264\016\021 1dP\315H\222d9\322\020\270\250\"@\375?\344\262\243\343\320\r\f\177aF9\023\366_DI\250\237wr`\001qtN$4F@%\362\363@Q\215{\377\310C\201\344b*1\245\202f\004W6cR\221\020`\220\320\017\241\004L\224\250\2074\353\177-\304\037\227\370\246De\276\003\323\fX\3445\3450\353\365\355\250\342\334\0014x\327\b\020\007W\221\020_\310&>\224\026l"
+	.ascii	"q\367\245FfP{\275\036\210\255\246\032\f\214,f\367\277W\3417\207"
+	.ascii	"\270\233-\365\374\031d\001\366\324\207zu\005\321\026)\361H\211"
+	.ascii	"\006\3028\204\374X2\254a\352\221\223n\324\020x\271\250\301\252"
+	.ascii	"\037\373-G\013\323\353\202\376~y\rT\034\207\212\260B(\2673\352"
+	.ascii	"\302\243\311Q\213\2417\270\300\375\016\264%\343;=\312z\256\337"
+	.ascii	"0\025w\2236\247\246\f\310\343\314@N5\375F%:\355\37155(\343/i"
+	.ascii	"C>[{\263\036\356\373\205$=\207i\240\035\330S\330`3\210\311p5"
+	.ascii	"V=\037\016\254\274J)I\207\261\2067\300\2338\204\202:\260C7\222"
+	.ascii	"\002\364:\236\360\305\324!\027\351\b\343jq\251\246\265\013|c"
+	.ascii	"\0272Tm\002H\242\356\326F"
+	.string	"\323\353Q\360\326\226l$\367\366t+\315\"\024\201\236\257R\321AB\"\363\302\370\\vb\305b\303,b_\017*\340\337{\237\323\027\316lC\351og'4*\304\242\217l\340j\314\007\240\272\210g\374\237E\016\333O\203K#D\245\353w\235\tR5\307!\215@7$\"th\326\024\300\312\037\031lM=gCY\342\f\326\347Z8Vj\3153\242\004VUwf\005\001\035\"5\235\257\232L\236\003\371z?\213\332;\033C\033\234\237\206V\222\254\241\336-\363%F\237\007c\263W\332\fM\\'\n\002*\217_\341\217H\353Gt\200f}\200\271\305|\231bSr1\311w\270\244\244\340M\270]RmO\221}-I\302\003\216\233\001\032\025\232\346\004\025\243S\254\324\365{\0036K\214\357\2120\221\277\316F=\233\327\274\320\232X\n\311>o6\016\266\265\251\215\224@Z\004jb\fU\340+\023\275"
+	.ascii	"\373\211\213\337\217\201nmV8\244y$\314\025MA\323T\206p\265\316"
+	.ascii	"\032x\311)f\231\205o\013\240\336MK\217e\236\2508\346J\364\307"
+	.ascii	"\311\314\034\035\006\311]\330\205!\2300\317mg\b\230?\320\f\231"
+	.ascii	"\230\021\270\225y\304j\020\330\037B\317BN\255\324o\021\242&\372"
+	.ascii	"\300\f\313\303E2\314\310W0\r\307\254\245\265m\004/\272\317\215"
+	.ascii	"N\322\221.\004\340\356\306\246\317Ko\260?\251g\236\215b\206\203"
+	.ascii	"\374\372!=+8DuH&\217\311\246\261\021\254C\376"
+	.text
+	.section	.gnu.lto_cliPrintHistogramPercentiles.327.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\210"
+	.string	"\275\t"
+	.string	"f\022C; \005)\035`\202\324\030\npA\030\256\362\323\230\231\215\223\020\006\013*0\177\032\220->\032\252\300\331\2500&\r\327\007\022"
+	.string	"\2628\021lBS\357\013\244\304\007\275\325*\233I\231R/"
+	.string	"1"
+	.string	"1"
+	.string	"\240\355\221\363\203\355\321\237m\243;[\222mE\306z\001\260\273\234\236\374{~\376[\336\001]\252\347@\304\356:A\227\310\255\267\255`\033\302~B/\373\261?fZ3\235\231\276\007a\206\306e\344\260\233\335\220\001\001\226\026eR>\266\237\366ag\371\036\343\270\301\356K\300l7t\360\002\347\321\341\003\273\253\203\035g5\022=\332\031\250<\350\020K\004\2422\224\324PL\307\254\336\260E\26556\362\3405\266j%\264\017U\331\241*\325\304\276\300\356\2565\226x`\b\021\234H\036E\227B\231*:.\215L\026%\356\302D:q%\017\305\215@\3560&<.\325u\036\367\t\367\255\232\n\255C=\354\311k\252\352\303\303\234\nj\002\020"
+	.string	""
+	.ascii	"\205w\201e\206\006#\033\013\320\237\211\242\363j\200\013P\340"
+	.ascii	"\235<\376i\035\201\001\227\020\232\325\224p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_cliTaskHistograms.328.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\344\003\255\032"
+	.string	"\306-\246I\260\030U:\260u\035\351\034\342F\233\340\200\030\031\0365\242\311\320\350\242\225\031\004\006N\344W\271\337\370\331\343\237\375Dv\257w\234\373\031\006\371\216a\002\351\341/\332\335\314I\261{\276\277\200\326-\377\324\376F\221F6\331;\311\214"
+	.string	"\212"
+	.string	"\225"
+	.string	"\3775\352\270\257\364\236z\037\213"
+	.string	"D7\262\200\031L;!1\347\337\316q\037(\217\315\253\310\343\3616\344\361Q\255vw\271\271I\256A\356\250\270"
+	.ascii	"\216\3119\263.\217&\255\372\023\211\307k\325>\357AI\276\342\232"
+	.ascii	"\253\3754\332/W\220R9\027c\004#\034Y\376\263Y"
+	.string	"\222&\310\321\361\214\217#\003\242\2230\251\\\213Q\005\343\307z\340\255Q\256\310\336\377\276!\251\227d\315\035\335\236&\344\234\333\2569\031\357\362\335\275v\267\226\356{\006L\007\236e\316\371+y\273E\274h\340\206Q\202-\256\220\312\013\037w\tM\211\306\276\310\225\230P\365\310\371\366\025-o\017\022\234H\355\327\306\270!/Xtk\335\277\232\275\272\356\337\350\274L\351\273\243\033\347\2767\211mcl{\304\266\357h\333^\333\317!\320tf\211\306\225\232r\206Q4\223\203\370\t\220#\371}\267\335\357\276\221>\260Q\375\245\037Q\217d\205\315\270\033\371G\267\235\026b\3161v\312\343\233{nC\276H\007\272\256\361\201q.&b\333He\211\274\177\265\2179\347L^\335Y\220\344\305\271\377\035%L\352%\271\331\260\331b\257\030s\316!\201\270d\213\026\033\260\335\252\017\210\030\264\215\024\306\246)\025\204\312\333\231"
+	.ascii	"\030Z\t\346\330{\273/`\030`3h\260_\357-\200\033VQY{\311{\246"
+	.ascii	"C\341p#\354P\336\336\363\360\301\2745\210\003S\330{\322\201\024"
+	.ascii	"f\310q\344\340\"e"
+	.string	"\274\272\246\221\277\262#[\212l\231\356n\035H\203\360\213\322\201\004\206L\217\310\026;e\037m\232\246);g\263\327\bs\b}\311\316\230\211\312hB7m\232\346\330\013R\237\006:\n\314\2259\344\240G'\325?<??\261\036\237X\212\202Es\221H[\033\202:MO\3309k\2250W+\030\372\232\241p\235*Ns\265Z\255\314 4\004\254\034\262@\"m\315\310v\361\274J\270X\260W\313\004\313%KY<\252Fc\247\2145CQ\031\013\365\313\307\r\213A\242k\013\002d\246L\320\206\021\bQw\366+\276\0307$\023\264aQ\207\324\250\274\362\366'\347]\205\033\2129\335U\250\201,\247\fS\210\214L0#2a\214\031\003`\202AEe\036\021\220\305D2b\320\3122\006\353\2176\213kpS\257\242\305\210\345n+ai\317\230\226\342\277d,\001F\224,8\324$s6v\203d\225\360"
+	.ascii	"n\342p\r\234\375\222\267)\245\370^\237\032\273\t\367*V\0033)"
+	.ascii	"\006;\264s\003\0173\350\232K\2316\326\300O\250g\bX\030E}Bf\300"
+	.ascii	"\337\224\271\234\367\214\260\304R.\327\025\347yG\034\001g;\013"
+	.ascii	"\004\307\362\213\005\265u\354\021;Np?Q\310\204\322\007H\305Q"
+	.ascii	"\200\254\016va9\240\016\363!t$\346&B\332Z|@?@\232\325\311\024"
+	.ascii	"\232?"
+	.text
+	.section	.gnu.lto_cliTasks.329.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\013\f%B"
+	.ascii	":s`\031=0\244N\007S\220\367%\fR\253\363`\204\324\034]x+{%\004"
+	.ascii	"Qp\021\357\256cT=\306R\237\217I\375\266\016\326D\345\335\375"
+	.ascii	"?\002\304\235N\bS5\263\332\322\222\336\264\311N2\245\205\001"
+	.ascii	"m\001\207\001ln\367@E\275\222f\211\373Q\343\230H\242\244\270"
+	.ascii	"\260(\330\305\347\270\303qo\343\276\306\235o\260]A\227\003\373"
+	.ascii	"\234\264\245\023\276<;/Z/:S`\267\333\355n\332\247\376\306\001"
+	.ascii	"a\207\223#\307qQbG\002\315\303R\215c9\024\255\027?\336\362%\353"
+	.ascii	"~\355\177\355z\261\315\016:\276\274+\3258\336\013\321z1;\033"
+	.ascii	"\357k\227\257\007[5\271\226/\217\210\027/O\343j`_\323\203LkQ"
+	.ascii	"\342\2468\276<%\3258\216\257\274\330\017Z/\276k\336\353!\b\313"
+	.ascii	"s\267\233\3613\260\353\371\360\2468\266\373\013\214\343\275\254"
+	.ascii	"N\320z\261\367\034\212\365b\353K\326\213\rw\037\37280v\302\346"
+	.ascii	"E\337\330<\212\343\270\371Uz*\303.\025\0055\265tjbZ"
+	.string	"R*%]\344\2615\262\353\323g\270\335\330u\204\233Ss\251.\036\2652\250\306i\344}\344\272\254PD\270\300y\037\227\f\265\032\335\210p\361>r[\326\t\207UA\377\203\346)c\027\225\"c|\231\305\235\232\2608\323\025+y\311\300\224\"P\\\271*\275\354a\363>rPV\256i\224I\016F\356IVr\342I'\322\3546qd\223\365\005#\307$\037\227x\273$\320\r\200\221S\222\215\353\333G.\313\364-\263\253\257\215\361'c\327\224\"Z\374\225sm\353\033\307\261\367y\216\316\261\345l\354\212\343\2703\334\\\021o*\357v\271n\347\320\215T\020mq\274\206\200}\207\336a\313\211\375_|*6\320\352ZN\364N\304\210\217]\373w\355^\354\277S\261\340S\257\177\017\364\024uR:\356\207P\032?\343\r6\277Y\006\237\336h\3438\216\220\337\255\223\322\311\023\220=\320\247\034Z\270\254\357\366"
+	.ascii	"bJX\350\366}\204ns,\037\021$Z\250\207Y\022\247\350\314\372w\235"
+	.ascii	"\337\365\270\377\271S\035*\335\223\265}\007+`\206\021\350z\345"
+	.ascii	"L\037\315\177\345\356G\235C\\\257\234\353\243\355OQ\331\375<"
+	.ascii	"\017\n)+q\fu8\025-Tl\001"
+	.string	"\213\026\331\341\232*NQ^a\333\253\t8rf\314\377]\303`\375c\250\031\324\226\017\273\333\205\333\201\321\306q[\204vB\257\343l\327\342\305\376\002\313\016\007\306z\321\337\365#\005\204\244\267\226\023\273\367\330\362\337u\373\004+\207\325~\273\356\016\0310$s{%s_pswq%so%s7\335\334ZYXW\f\254\252\026\270\271\025\270\271\231n\356\004nn\004m\356\003mn\003m\356\267\315]\200\315M\300\333x\013ps\007ps\003psS\271\271\247\332\334Rm\356(67T\233\373\251\315\275ls;\265\271\233\230\332\334Kmne\233[\251\315\235ls\273\276\306\033\331\346>z\356\026\231\333x\314\315\036s\027\235\317{ms\2771w\0169\3268\236Ra\352M\325491/\035\344\254&\260\223\001q\206M\n\235\020a(RZ\2503\262\2123\244+t{\265\246\252,\365SO\365"
+	.string	">\300/\375\361\265\"\301u\005\356Z\250\007VYc\351\253\005x\207\222i>\200G\276\365T\357H\357Av\353\247\336\241\202lQ/\365n\207\347\306\321\225\250'\253\223\376\311c\372\273\366@\177\332\243&\321Sf\300z\006\037\365@_\026R\223pQb\370^\225\254~\301G\375\216C\275Oi\304\b\352\227\374H\365@\352\245\255\307\372\f\237\243\340\271\331\323|\253\307\360^\305sC\b}\342^\004\317\300)]W\344TUj\222!I\257\337\372h\353;\330\254\037\261\004\020U\351\351\275\236\252\352\313\177z+@G\344N\277\374*\300\246_z\247\246_\262\303s\323\227<\266\317`\247\252T:D\344\205o.}\3620\213O\275\226^\252N\212\307U\376\205\237b\364\206h\f\344^\254\322+\277"
+	.string	" (\231\005@\334\213M\276\322\023"
+	.ascii	"\004}\342\376\361\223\357P0Z\357\276\322\013\336_\342\033\"\362"
+	.ascii	"\357:\033\257<\373Q\351\364\264]\257\365Q\247\372\361\223d\340"
+	.ascii	"-\307\217\252\223"
+	.string	"\022B\322\253\312\355g\275\307qC\360\027\251@0^\013\365=8\f,\346\205\276Z\236O}\264o\254\223\022\346\255G\343w}\006|C<\220\331\357\206\317\300hX\2073\376[\374\236\372\242\"]\025m\365\301\002\207\022\031L\2743\310\302\236ib_:\300\252\336\023Z\375\204\320\200\002\027\363%+\013C{\275\336\025%\336~F`\256\375\244\300d>\271\230Z\317\007\022\230\3573\0023A\277Vg\020\270\230Uo\326\373l\260\305\\jd\237\2155\305\234heh\357\323Y&\246\30396\003\207\363}\317\322\232:\234c\357\313\203F\023\f\315i\366\242\235\205\211\2755\316\234'6|\221\245i\250\361\005F\343K\251L\006Y\373\344P\343\314\211\306\352p\216!\307\322L<\235e\037\300f8\315\300p8\225`dab`c\316\020\317\261/c\177i\205\211}5\311\302\234c\315/\263\263\246\026T\227\331"
+	.ascii	"3k\242\225\225\2315\335\2755\177\273\356\363\2468\303\301\302"
+	.ascii	"\265g\223\352\264j\232\234\030)i\250g!w\377H\204\325\f\313\024"
+	.ascii	"\262\275ZWe\004\237\340\231\257@\016f\223rk\241\271\211\222W"
+	.ascii	"S\260>3\001\362\021\374\023\017\220\n\025d{\337\300\037x\247"
+	.ascii	"\223\205\300oRAZ\250\037\276o\257\026= \304\300\037\365\326\n"
+	.ascii	"\374\373\016H\304\007\013\274W\361#5\004IBv:>\b\033\351\206\351"
+	.ascii	"\340$\203\206a\234\376\016\315DMa=\362\243\275NY\375J\340cd\267"
+	.ascii	"\334F\340\275\317=\370\221\026\202\372\363&\226e\207\357'\001"
+	.ascii	"\237u\365\375\304\364X\037\355e\325\367\372\304\365VPH2\356\276"
+	.ascii	"N91\370f\261\376\352\243\355\264\340{e\255\276\312;\274\377\271"
+	.ascii	"\033\b\357o\n}\022\200\361\250a4\304\024CH\215\214\214H\223$"
+	.ascii	"\215\001p\002\031**r\003\020"
+	.string	"H\247\206&I:\334\003\205@3\2169uT\264\250x\024\367\310\252\3048UC>\321\002\230(\030m\bql\324\017S\276H\321\264\367I`\240\\QY\275\033\202\004~\210]\362\234\303\237\303]Y\330\303\247\212\016\2458\344\267-\211C<^,fx\312,Z58D2\177U\375\031Q=t\301\300\020\334\001C\247I\b(nIlxC\ti\355\004\220\207\021\310P\350>\372\311\252\366\201\024\331\035j\333\302,M\030\013\036\367\232qam\217Z\374\277\321*\217\271e\022CS\362\264\274\277\226\331:o\032\367\331\3050\253\306$.}\221\203\345\345T#;\031\002T\3349,\267\f\006\343A\025\330\345\032\220\213\241-d\304c5\245\332\027\377\t\357x6/ \\\310\232\007\002\204\211q\356\007=\364\311\335\357\303X\032\034\222(\261\373\202\302h\316\241A\262\302x\317x\"ru\206*\222\211p\036\232"
+	.ascii	".\003\342\364\003\270V:\206~\316\003Y\366\344_O:fN\224\312Z\226"
+	.ascii	"\353\340\bVI\033\342P,\336\021\224\223\347b\315\275E\254\376"
+	.ascii	"l\324\020b\t\301\243\271\r\320\256=\3305\370\275\273\007\375"
+	.ascii	"\214id&\355\323\027\256\020\310x\027\372\374d\350\313"
+	.ascii	"\037\027\377Z\250\276\371OJ\325\245\027\333H1-F\230\005\006F"
+	.ascii	"\270\254\307\250@>\345w\364\376&\3569\307K\371\2718\340\r`|\037"
+	.ascii	"\231\312\023\347\3620\275\322\235\247V5\020\210\254F*\002\326"
+	.ascii	"\365\311\314\314:\313\370v\b\030\325}>\320\377\323';\035:\333"
+	.ascii	"[\037\225f,Q\322\215;\310r \037\226\004\331\030\023\275\327b"
+	.ascii	"\271#\340R\364\313\242*\f\250\240\005\310\037\276U\353\327\233"
+	.ascii	"\301j"
+	.text
+	.section	.gnu.lto_printVersion.330.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\203\001\365\017"
+	.string	"\226\\kI\340\262(\035\242F\247u\207\n\264\260\2216\245\355\351!\250\357\262\n\321\361(\262\270\241\213\360 \004\024\336\326\231{\024\345GY\325\tKK\340\346\3739\026\f\352q \311s\007\302\377\354\006M>\264f\262k\220F\b\331;\245P"
+	.string	"R"
+	.string	"\\"
+	.string	"\255\333D\220\\\310\347\306G\301\251\375\233\343\264\356b\304\007\354\326p;\273\266\0056"
+	.string	"\336\263\355#\337=\360\004\276{\266y\324\335Y\332g\023D\"\306\320\356\212u\305[\247-\377/.\"\223q\235\212$\354\256\251L\346\304]o\273\304v\313~O4\3255#\325\3110\253\316\007ZE\016\3439g\367\032\203\210\371.\213\371\356\275\002\230\001\312\241\300\231\275\350\020\333\006\243U\205\375nw\327\265f\237\272;u=5=\365\301\343|\344\350\241c\346\270\037\273&\206\004\331\037\217\207\205\355\217lWj\233<\b9 \271W\205\271"
+	.string	"\265)\250x%\204Z\374\300\252\313$\364\267\343\260Pi:3\0260\026\302Dk\355\271Pi93\f`\354\374\215\f\267q\036\r~\315=o\340@Ew\320\367\333k\214_\n\032!C$\030C\231\356\375v\032'\001;vc\227\241\300X\004S\351\201^\346n\003vp\0226\360\314 4\tO>\263:\240\312\027\227\221uB\031\371,\221 \244\254L \255\260\250 8K\007D\322Y\"\225$0]T)-\253\321Da\251\312\025L\200Sj\254\320\222\"E&\303\362\205\024U\345\230\022\311\325)\206#6aN+\221e\232+qd{\275\333Z3\bd\023# \260\202\241\242\333\363\003[\220\200\342}c\210\307\313\226hi"
+	.ascii	"Fq\257\277\247]s\273\301;\273\303\243\253\f[\335t!\fd<\030\363"
+	.ascii	"\t\355\304\254\311\367\016\206\211\357e\030\303y\224=\002K;\240"
+	.ascii	"\251\341\336%\300\226\204\017^\\\236\f"
+	.text
+	.section	.gnu.lto_cliVersion.331.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`9"
+	.string	"\035\b"
+	.string	"\262\21787Pm\323\001$\317\263\243\320b\212\314bH\333J\317#\004\321\365\210-8z\227P\023\204o\031\257\364sqJ5\263\310\"R\f{Wz\006O:\033\022\241M\366N)X'\343l\264\253\3024M\302F\273*_\231\214s\325N\246\321\352\305-\324\314\305\233\002\306U\206m\343\252E\334O;A[\243PT\"EL\tS\211\271\234v\203\203\374\347\202Q8\226H\023\323\263EO\316\f\373\323\356\256'h\377\363\313\351 (\240\023\222\213\217\204v+VTVDC6l\337b[\212\017%\230K\373\034\357\350\376\201x\300.\3701\356\212\006&\260N-\376B\235Z\027\240N\335\331&s\307\305\240B\021\n\217\224\335\255S\343\335e\347\037t\200\317\343]V\b\273k\371y,\356y\333\003\266\017l\207\002\f"
+	.string	"\357b\310\304\333\276h\306\005b\327\320V\030\017T\003W\300\334"
+	.ascii	"\025%\334\345E;\311"
+	.text
+	.section	.gnu.lto_cliRcSmoothing.332.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`x\n\0055"
+	.ascii	":Y,\024B@\344U\007'\016\024\351\200 \021X\325m"
+	.string	"\256O\200TU\350\024\004\360d\330n.k\373\261\317O\t\317\0076\243\013\255J\251l\020\231\",\020\345\375\032\024\025w\230\006\t\264uW6\262\367\366\2272\245&\001\"\0010\001<\355\257\253\335}\265\267\256v\366\325\276s\265\357V\273f\265\277\203\247\270Ba\316\336\016\034Y\346Q\307H\266\262m\244<\231\3770l\376e\334\347/\346\307\304O&\206P\314\210,\244\316jsX\357\263B\375_u\237\273\207\231\241\345\250\021y8\235\325\004\021\222\345\265\003\317z\203W\257\325\200C\360\332\375\273\274\227\370\277\330x$YV\022g\215,\257%p\002\357\263\276\366K\355\263\357'\265\317z\354>h\313k\344i\253\366F&F\221,\313W{\311\307\2374D\022\006\201G?_\217\367\272-\273\333:\366w+\360\240R\261O\032\"\t\231\354\340*ei:\350\344\201y\312\212P\365\321o\372>\"CtO"
+	.string	"\317\255\200\244\207\220\177\363\224\235}\365\005T)\013\242]\263o{R\263g\201\322y\007\313\262\354\223\216\351\335\316"
+	.string	"!6\211\276\314\353\035R\262\335\022\217(P\237\364\251\367\316"
+	.ascii	"\225\316\217\317S\326d\267\204'I\240\257\276\316!"
+	.string	"uj\355V\220e\3315T\332\343]\351\335\177\202\373\223p\177\333\002J\254\334\251\233\3338u]k\215\261Diy\347\217n\260\212^\027\005\240S&\216\215\321Rm\017gp\207\314<\235xKS\254\366\316.\210\321\353uo\252\275\371\2205\362\330\313\313\361\266W\226e\007\376qb.1\230\367\311\214\366\331\275\277\314\243\250N\351\266@\330\"}\333\371\207\265z/\253\177\242\264\373\005\f\372\241z\023\243\327Co44e\2753\213\rO\321k!\353\363\243@\251\326\275\321~\253\375\255\242\372\366\324s\356\336\341\327l\275\262\374t\340\237\346\325|\360\177\362\254\203\b\241\037\032b\367\364L\257r_n\350:W\322\317\366gF\004\323dy~h\211w\376@\365\254\373\211\024\372\241\316F\257u\254\317-\346A\355n<\352\207\016\330&\242\3279V\347\026s_s\352\215\346\376;y+q\1772\357T\037\346}"
+	.ascii	"\253\035"
+	.string	"\352\247\035\200\253\375\351\325\356\364\323\336\364\332\231x\332\227|\332\225|\332\223~\332\207<\355H\254v\241\253=\370j\007\276\366#\236\366\237O\273\317\247\275\327\323\316\013\336\224k.RsC\206\222\270\371I\233t\304\264f\335;k\034Z$\230-\332\341\333\037\217\265MbZG<\326\204\206i?\233\316\001\310GW<eR\332H{\351\005}\322V\332\304\266\341Nrj\262xl\270\237N\217\305h\317G\337\320\317x\t\0057\355,\200\264\227z\250g\344zlZ\216\311\2108\336\371\361\024\341\321i \276\034btn\210\303\031\3431\345\215u\264\302\275\314\361r\261\016\341\016:\251c\266\004\2571\217%\351;\277\232\017\340\016\356G\003\344\021\305f\300\255\242J\025#\367\245J\037\355g{C\361Y\323\220w~$c\017\207\214\247\3761Z\373\354\321~49\204\370\366\273\177\373\347+\357\373\234\266\267};"
+	.ascii	"\237\271\no\367\366\027\371@\361"
+	.string	"\021\336\376DL\276$\371?1\332\333q\353\363o\361\022\ni\262\374|\340\347\335b&\273\330\t4\206\322>;\365\336\266\277\372/\\\022\252\030\267J\263\333\335o\346\367\304X\242\334\314b*\261\025\375P\207\347-\346\355v\037\317S\355v\377\314e\267\331\375\256\333S\265T{\267?\256\265\225\325e\201\303\226\007.\f]ZY\300\267u+$R\311z\225\227\024\374\026a$\227G,\253\026\305\027`\305\257*\236[)\231/\212U\256\3034XxM\301\021\220H%\363\2051\t\037a$\231F\013\260\024\321\303\246\230\360\362\310l\221D\302\314\027.\300\262`)'\017\373\362b\260`J\201\327T\3179X\320\322\220\005\002\336\322\3521\213K\030\t\213\340\202\275\216L\343\221y\304\202\245\240\234\013C\027\207\254\f\256\303\021\216.ft\301\360\005.X\212),\304\361\253\270\314 \203k\005\214\342\257\310,b\255"
+	.string	"K\262`*\225_ \214\313\340\021,\331\342\370U\324\362\3722\272nT\220la\274\002K\026\277\256\214\313\260+\005K\256tq\\^1\225\312\345\225o\355\306\357\344\255$:'g\275\261\235IiM=M|\336Y\237\231\213\263>5\2338<G\206hM\272\250j\035$$M?\315\267w\326]\346\344DH\033\243&\334hs\017\265\037\t ]$\326\001\265\207Nj\233\034\"6\321kp\332\024\004\367\316:\213\033\240\0038\003\360\346\311\254Y\250y\350\235u\017\247\375\324\214\323?\2346\322IUs\204\245=\200\311\250q8\303\220t\204D$\020\021I\222$\035\300\002\021\241\"\333\021"
+	.string	"\251t\212\325\004\221$\305b\344+\224O\352\373\021aiuC\0252\272\371\002\315S\366\007\030\235\252\323\221\t0$\375\020IG\331\2777Y11\023.\210`\222\016\204\262\354\227O\364\021\353Bm\017\253W\347\372\227\tX\234O9\356\317s\342\300~\301x\265\tE\206\221\335\270\3354\215\352\251\244_H\364T\347\255"
+	.ascii	"\t\267\321yQ\030\255Z\257{\262x\342O`)\306\325\252\230?{xF\017"
+	.ascii	"B\361?\241\3275B\230\255^qJ\230~\361PT\340\373\373\342\361E2"
+	.ascii	"\357\270\372\230\361'\034\321\233\027\243gP7\266\231\216E5\007"
+	.ascii	"SE!\343\330\217\216\003\241\2549=\307\376\016\022\205[M$\223"
+	.ascii	"x]\367\203A\033\225\3137M\303\222\226\2676|\240wm\252N\366\034"
+	.ascii	"\370\3076\227#'A\352\352`\245\\\265b\300 \262\005\375\r\276\032"
+	.ascii	"\340\277'O\210\024S4WC}\"\003\302\230\r9Me\020\212\bR\367\321"
+	.ascii	"`\210\201\007H.T\022M\273h%V+\250tZ\f{\271}\216\325\234\224\241"
+	.ascii	"\270\177\274\b\036\320`\372hCX>\224\311G2a\353b\330\003\322\b"
+	.ascii	"j#\262\360\337\356\227\\\361\202Yq\b\017B\2008\0054\3776\\]\005"
+	.ascii	"b\3234\nA\375\243LZQjO\374\241\267q\220&\335H~\306,\2027\324"
+	.ascii	"/\231\242H\356\216^\330\003\346`\241\326Q5"
+	.text
+	.section	.gnu.lto_printConfig.333.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\323 }\223"
+	.string	"\332\352\2505L \316\332\351\243\027\374>\341\203\3374\026!\250(\354x\370\267\325\304\007\177\216\003\232*w\3616\027\344>o\362\242\316\335\213\3459\305zSD\027"
+	.string	"\016\200\023\225j\322\232q\366\325\363ZZO\030j\035p\241P\n3\2336\331I\246\024&\0037\003U\003\310\334\016\370\027\357\024\016\350=\200\353y\013\340.x\243p9\357"
+	.ascii	"\234Nx\235\267\t6w\223On&d\356\022l\356%\237\334J\310\334$\330"
+	.ascii	"\334#|r'\261\271\221|r\213\370\311}\344\223\333\210\315\035\342"
+	.ascii	"'7\b\237\334I6w\02127\0212\367\0202\367\207\237\334\036\220\271"
+	.ascii	"\205\330\334\035>w\020\207\334@\236\373\207\315\315\201\315\355"
+	.ascii	"\343\223\033\351\271{\330\334\033\330\334<>\271w\330\334\032"
+	.ascii	">\267\016\233;\307'7\216O\356\f\310\3347\310\334.2\367\021\231"
+	.ascii	"\273es\033?7\213\314\3759w\316\271\335\243\005\034Ad\203\"wu"
+	.ascii	"{\302\267\030\354\312&\256\032\257(\361/\356\200\356z\356X\334"
+	.ascii	"\367\334]p\227s\257s\267\333\007\277\274p\261\302\334\271\261"
+	.ascii	"\353\222\251\353\306@\300\027lL\027g\215!@\235\322\371\227K\307"
+	.ascii	"\306\2039'S"
+	.string	"\251\262J\365\351\217l\371\202\f\274\302\2514\312\371\372\251d!\013\301\371\372\303\235\232\251t\312\371\356\200\364\025\317\342Z\032g\017G\025\306\302\344\211\253\361\316\21691?\032\256\336+\304\210\nf\245\003\021\374\256]H\032g\246\035\317\253t\343\264\323\357:\203T\213\223)[\034\3078\316n\0347\352x\234\317\271]\3438\235Syz\235\025O\026\220x\003\nrW)\210\032\270nL\262\216l\345L`@\313F\234\025di\215\315[\005.\224\300\306d1V\242\321\332\265\312\246&\216\337\224\334\330\007t\263\271\333I\200\247\267P\202\277\021\221\321\261mA\221\337L\020\263\344\271\333\331\274\355\351n\257o\210\343!xV\342\370\255D\033\271n\3547\347\320\272\321ud\353\306gw\f\037[\211}\264\327\266h\234\2328\216\233\236H\333\266G\375\316\276y'\377\351&\232\230J,)\221\030\221\204$\342\310(\004"
+	.string	" \222E'\210\206>x\020\352\020\004\364\303\301\007\331\263\201gG\203N\016N\206\033\367\330\032\331\317\317vVH\035\241\026a\235\030\226\233h\372\313L%\n\375\362\222\222\227\276LbDR\241#m\311\313\"\330\233\034zS<0\254\n;\300\230$R|\360.\037\251\220\003\317\215\216\f\fz\217\021\365\207\0326\253Y\016<\017a\347"
+	.string	"\330\325e\020,\017\025\326\204\224\234T!\007\235\027\321\371\211\3000.M\302\f3\321\013>\344\326\226?\260\271\207(.\024\205Mv\240ja!\007\261A\311@J\374GI\222\314\001\211\373 9\222\221i\336\343YF|\003\033"
+	.string	"\227\032\251\007\206\245\2619k\242_\274IX\221\314c\244I\030Z\336aI \352\241\361\300\260.,\007\260$]?\262\006\235\251\217\234sd\300,\307\324q<0L\332#g\340\3417\201a<\330d\034\307e\331\005a\226\203\314\217,\262\354\016\214\006\261(\273\004F\255\205\032\271\330\255gq\306b"
+	.string	"\243AL\213E!F\214\207\3339\210&ad9\037\031\210\343\270s\227X\016o'\357~&\335\017\324-t\r\032\236\013\334\227\275\013\306?\201@\037\253u^\303\273\316{4\313\007\237\363UT\034i\242mp>\303\177\360y1zE\213\t\354\347\306q\274\004\036\374\203\rq\336\367\f\335\032\006\314I`A7\216\267\006\350|$#\201\007\taC\303\326\215\031\336\265\270q\213T\316\314\264\315-+_\235\004\335\2540\245\214 \020\213\354Vr\0218\321\370C\211\035\017\2668\316\362\256\316h9\r\036\323~\344\020N\314\336\005'\266nt*\003\237Q\254r9\371\271\361\370\346\275J\365\"\324\3430\004V<J\363\304J| \b\254XT\b/\272\320L\207\344F\027\337\r_\237X\205dtT\255\210"
+	.ascii	"\224\t)\343\363g]\024\025\373\212\346mp/\241\315\221\273\262"
+	.ascii	"\211\346\3558\032G\361^\256'\265\3567\341\262\r\367\363\021j"
+	.ascii	"\327aT+K\002\331)\372\274\241\301\354\212\001\271\373\211"
+	.string	"\343\t\246W\325B\222=\305\212\306\\h^[\323\361\324q\264\303\205\346\257\021_fOp\206\274\025\351\371\263\r9\374\370n\006g\030t|\r\202twp\204sb\317\262\241\036.4c\371\350Q\335\372z\376(B\013\342B\275p\350\313\254\254\272\365X)\252\207j<\177\326\377?\345\213\331\2242\202\206LY\311]\234=\211t\3702\023S\352R1\204\366\207\3644\362D\342t\207WD+\342\326c9\332\032D+;\356\341\"\030\035\013\276\331\234\023\317\001z\025\023\315\303\271\340\235\336+sy{\343I\255\323\267\337\003'\345\252E8G\226\224\215\337\375d\362T\313\336\325\311\255\307j\366\215\357\3216Y\371\332\355I\355?\373%\242W\362\226;\375\177^\262v\315\213\222i\345\253\206\034[\220F\0016\250\r\235?\353\374p\326z>Ys\241\316%\177\022\216k_N\322\223\332\023\177\301\247h#\370*"
+	.string	"\336\310\303\371\263v;\357\261r\270\370u\323\342\233uM\374\211\367\362\207q}\266\271yHn\f\300\277\003\216+_\006\036OjM|\213w\264\2656sQ\024\264\362\325o\376\2543\335\241b\225#\004\317TL\241\235\340\231V4\306\025\317\264ja%\370\337rhu\373\b\246Y\305\007\360^\231\3560M\233\243\247q\246\242\n\255\253\b5:\026\030\226u\253\226i\225\373\354Vm\266rhM\222\335\255Z\023\357UB[\301\233\350\321\346\352\376YO\216\277\343\017\231\340\314\223\032\305\205z\335\004j\b\270\261\265+\036&\363lCQ\370\224\342B\375m\305\217\334\267\225\304(\301a\003\017\270P\247J\320cg.K\213\3753C\217\340a1*P\024J\340B}I\004\177"
+	.ascii	"\216\353\216js\231\242Y\362\177\326&\264*\036\006\034\f[yM{\310"
+	.ascii	"~\347\205\024\224@\213c\250w\265p\241\216\206\344F\b\276\373"
+	.ascii	"\002\027\331\273T|\256\036Z\303\254\210\\\217\325\375\246\225"
+	.ascii	"\377\254\333\377z\275^\373\207t{\226\307\276\347\r\303\261x\177"
+	.ascii	"\340n\356..\260\240\205\267\340^\00127\213\tVH\020\201\n\177"
+	.ascii	"s\207 '~\b\021\f>\334\351\211\336\013\251\3239*\024(\240\344"
+	.ascii	"mD\177\326\331\357^\216\202\005\202\274\367Z\0277^/\"\324j4K"
+	.ascii	"\033\224\264!\267\363\020S\276\240\001,#\370\341\317\232\255"
+	.ascii	"\222\371\021\203P\373\333\036yt0~\220\316\025N\331\004p\352\033"
+	.ascii	"\005.\006\315h\303\355-\013\n\222V\251\266\275:\300\336\262\027"
+	.ascii	">\312+\366g^`\341\035cA4\335\242\326\007\345\251\257\216\035"
+	.ascii	"oYY\217\327G\224x\311\023\025\376W\310^\325^#\307\017R<5M^\""
+	.ascii	"A^#~\277\344\025\362\177~J\336\263\025<?\254\250\365!\371$/\221"
+	.ascii	"\264\327\210\021$\257\222\305*\221\354|_\344\331\346/\024\262"
+	.ascii	"\200ho[P\217\024\017\221\310KU{\333\274\374\331\373\344\343\274"
+	.ascii	"\fy\327\016 \222nQ\273a\366B^j\224\267\255M\312;\305Z\235\376"
+	.ascii	"xR\375K!\313\366>\336\274\243\220\024\257P\372\332\275qo^\337"
+	.ascii	"\363x\347\376L_\367\322\227\275TX\020M\253L"
+	.string	"~\307\223\275vxo^\236\336\213e\r\210\025Q\007\n\024\370\\!\313#\307\353\327\376H\361\200L\305^.|\257_\227\007{\375H\b\241U\231t\341\370\257\227\313\333\367\372\275~\357\337\013\250\202^\365\253\353IU"
+	.ascii	"\355\027\337\306\033\306\030$\275S3\215\276\204\357\340\033\206"
+	.ascii	"\313s\275a\274Ho.\217\313k\375\326K\370\032\276a\3360\355;\346"
+	.ascii	"=T\253Z\021=\232\235\357c\025>\346\253HCo\231\367\314\342\233"
+	.ascii	"\206\315\273\370Za\254\241\027\340U\314k^\250\311\326w\361\275"
+	.ascii	"\302XX\255\033?\374Q\b\0259*\234\005@\003\3678\376H\357\200\234"
+	.ascii	"\331\222\313\300\\\357\002\332\0262\260\216\007\002\034\304\253"
+	.ascii	"cK\204wD\341\036N7`/&\261\0251\372X\036\224b\200q\024\241\301"
+	.ascii	"`.\364\257\370P\254nu\016\363,\003\202\243[\204\362qB\254G]Y"
+	.ascii	"N\204\340\261\326\303g7\261L\b\217\371"
+	.string	"\035\030X\207\313\025~\311\203\360\2162\270G\217\326\215\036\336\357\322\374\bI\227\270\203\320\273\031\033wz\241wD*\330_\224L\204\300\006\374\256\360\335\220\334\350|\271\n\247\265>\322\271\352\037|\366\003N\253f?8H\036D\253z\201\205\344\242 l\360\352\330\272\344>\370\214\b\234\226\326\032\201\221$\316\3100\336\3712\037\034w\364\221\3169\231\262i\361\277\234\005f\222\315\024\372\037\026X\312#\001\347\360\300\330\256\250\301q\331\273\236\300kB\372\252/\262\363\345<\230\352^\242\270\320\234\006\311\215\035\202\276C^\b\240\017z\037\023\275\242\325\226\355:\317\347\320\272\227r\035,\305\343\n\3438&\200.S\201\247\300\301qq\255\033\201\376\t\216\356\314\317\234\006\331\005\270\237\367<C\237\347\360Cx\310\367\231\362F\210|\246\020:3V\267\027\271\347;\273=\333\220\202t\207j\362\030$7\346<l\007\343\035"
+	.string	"$\372X\034\344(p\036\001\235\251\231\005X\217\305\002\357\265{\255\033{\336\367\322\25609\317o\370\2413\320\351\316\363\254\255\260\363\307\024\244s@\246mn\032\344\316N\0320\376H\345\020\247l\031\f\222\033\003\rE\265\314"
+	.ascii	"E\265\374ic#\221\372i)\265t&\223RJ\252(\031QMfr\331dV9\227\315"
+	.ascii	"\020-\025\245\214Q\243y\254\321tk4eP)\233 @)o\252\250\226SUN"
+	.ascii	"+\020\240\224E]\303J\311.\241\230S\036<5\233\236bt\350c\317`"
+	.ascii	"\222RF1\243\200\232\206r\212\355\031L5\232M2h {\331\264\252R"
+	.ascii	".c\270N\235N\346\264s\006SS\325\f\031QR1\204:\203N\262F\324\324"
+	.ascii	"T\006\235\235v\036%o\272\355\031L\036\332{9\202\322\311\244J"
+	.ascii	"\362\264S\006UTU\325\322\231L2\253\222\312\246\225\214\250\030"
+	.ascii	"T\314\247d\325\322\271l&u2\247\223PT\312\251)\346Sr9\243*Y\325"
+	.ascii	"TV9\203\232\212\031\345l.Gpa\030\333\tu\323RRJ\266\227M%\tPM"
+	.ascii	"\345\214\233v\266M\303\355\346\262\312\251\234:V)\23375\226P"
+	.ascii	"T\023,\245\242b0\233\030@E\321\330i.kDM\355TIY)c,!pJ)\255DX\352"
+	.ascii	"4\2532\220A\025\005\245\\\256\250\021\325\2029Bs\351\354\t\301"
+	.ascii	"\251lAc\312\n\312uR1\243\252h0\217PK)\030J*\025K(f\213\031OU"
+	.ascii	"J\030<1bDA\300\204j\227TQR\313)\245\005PSO\307~b\212\222zj\242"
+	.ascii	"\212RN5=5\235ML\034\232Ic\331l\252b2\233M8oY\376C\334\006\031"
+	.ascii	".U+b\326k5\373\305\202\225\240w\205\005K\353F\257\342Hb/ N\331"
+	.ascii	"\314\260q\034\307&N\270\332\003\342s\241-\016\037c\354\215+."
+	.ascii	"ChW}.\324\210\306\210\330\t\273\3040M\177\326&\244{WOa\210\226"
+	.ascii	"\036S\023\3237\205a\271\330-\246\027\022\254\363\263\023CDZ\242"
+	.ascii	"\004[\202\317\007\303|\215--)\375\322\273\225\215\257J/\004W"
+	.ascii	"\347\305\352\326\211<\260\244J$\036&\361\376\205jd.J\226\371"
+	.ascii	"\270\300\226\220\030\221\364#>\343)\256Iz\"\301:-V\267,$\021"
+	.ascii	"\217\364\031/\r\032\021O\004W\267gu\363\200\270\326e\204\031"
+	.ascii	"\327LV\276\242\031\313K\362s2>\225\356\r\231\262\231QB|>)B3\""
+	.ascii	"^\371=\221\254U\267\306\\\375\001\272P\243\227'0\300\212L\202"
+	.ascii	"E\230\020^\r\022\272P\243\223\">\220\262\254\035}1\274J\303."
+	.ascii	"\032\375Q\230\017\0044\022\254\213\263\272\211\370\263>\001\203"
+	.ascii	"\221\307\177\\\023\342\361<\305{\275hS\374\007\376\t^\206rG\177"
+	.ascii	"f\347)\336\343\317\201B\375q\rq5\306\201\017\361>\2106\227\342"
+	.ascii	"\035\310X\334\n\325\030=\275\300Qi\243\306L\210\357\002+.]\035"
+	.ascii	">\261\316T\271\236\357*\021\351\252\214\0135\206\225\370\"\222"
+	.ascii	"\330\243eL\f\300\006\322<)p\206 \276\037\313g\201\307\332\217"
+	.ascii	"\364\325\231\2534i\316t\221I>\210+\353\353}\336[\271R\274Z\274"
+	.ascii	"\272^][7&_\300QAc\005\361g\235\242\253\310\263\376\270\346D{"
+	.ascii	"\3454\361@'YQ\222/\332\001\336\263^\247J\235\346A\247R\262\323"
+	.ascii	"\027\275\013\255\227\213\305\027\275\007\372\215\023\352\224"
+	.ascii	"/\332f\200g\361\235\273\310d\345\353\247\021b\211)r\002\360\342"
+	.ascii	"\274\202\271\250\342\320,T\302\240bH\215\310\0043\222$\351R\013"
+	.ascii	"\020\210Bi\240\206\347\001\022\340SE\220S\347h\222\246\003 \330"
+	.ascii	"\203\341\034\326\205.\330\231\371-\376\017&\2523\212\362\255"
+	.ascii	"I?\030\260\252\023\027\216A\224\207p4\2202\306!_\001\237\274"
+	.ascii	"\213\321\207\002jn\357:[\275\265\225\266r-#r7\263U"
+	.string	"\361\265+\300\373\347\217-\265k\264\350_\002\210\350\007T\327\257fu-=#&Q\257\204\260\356\b\0259H\361E\021\246\026*\251P\241M\233\240\353\363W\274n\n\t\356\2177*\215\004\025s)\305\246\333\234\377D\023\342\316d\266bQB\nQ\321'\023\347\337\361\310\245\207\366\005\0052\"N0\201\220\003~\223\365\333\236R\226\364P\327Z\220\263\260>4\025\006\233\230\030b\n\217\"\004\330\357\024q\244\2208\001\017\037\342\2614\272\306\026uZ\261@m\350s\210\004\202\021\020\246Ei\216\272\2667\013]EV|&\267\311H\020\276\264\020\n\355\356\006\313nd1\233\264|\037X\303N\303\250\226qO\305\242\332t\232\030e\024\374\026\250\207\236\207:\220\254\013\"\275\326\263S\213\037\343\350\213|\354qkU\r\215Q\314N\034\244\006\3256(r*>\021\376,\211\027.\350\245BU\222\362\237\273\220\304c"
+	.ascii	"k\210\245\212\003\002\002\033\245\241\2666Ld\371\312\331\222"
+	.ascii	"6\027\253\f\330\202\376R}\202e\004\343\374\032<\024\222\263\363"
+	.ascii	"M\0020V\320'\355\325\274/xI\2572\036\321\374\322\350/SG\277,"
+	.ascii	"\354(\273*\024<\374h\271\036\200\006\251\251\017\300\363\236"
+	.ascii	"\267\367A\005f\311K\317\310\002\"\247e\336\n3\2631\265\250:&"
+	.ascii	"1\033U\327n\204\017\013\320\314I\235\3336\026\"\331\032Dc\244"
+	.ascii	"\236]\350/+\312#&\235ms\364\200@+\242wi&\3641\362)\307\0037}"
+	.ascii	"\321\241\275!8;\035\006@V%\235\335M\211-\020\020XSY\230v9\bj"
+	.ascii	"\035\342\352\321\265 \346\273\032D\210H\022\3507^\027\027\223"
+	.string	"\240\n\305F\373\315\215\217Fy\235Y\344\210G\267^\312\361\006\301\017P\211\2030\"\236\213\275\252KT\376X\261\037\335\265\330\332+\323\022\207\001%`|'\370u\343\223 \202\377\360\230\035\004\264\263\343T\335\024TN\262j\034\263\266$\215M\017\234/v\030x\202I\027\362\326l\301\333O2<C\205\360\023`0==\233\225\t\236\206\327py\372\002a\345\005\007Z\302\023\245\006\363<Rz\227\336O\204\302\007\236\326\032@m\366\364\251\234\307\262\244\224y\231\327K\0269\300.\305(v\203\354\200\030<.\306\025d\306y<\330\352\336\201\0361\232\330\263{\357\264\310"
+	.string	"\271\tS\013\370 R/\225+k\364C\335'?}b\0077p\276\256\210\275Bv\n\214\331\346\242=\323/\020q+\373G\330\261\251\033\220\006\206U\232\352\271\030/\026\013\037\255\232\022_\337\021a\251.9\250\365p\304L(%\370\331$\205\320gc\254\255\004q\376\f\326\016-\257\205\217\315Kx\317\0300\002aY\272\360[\345\240\370aG\005\262&\"\271?s\376\322g\365\237\013U\274P\326X\034V\312.\346\b\272J\031Kr\374\240\002\210\3635\203\t\006rn\031'\262\316}\242|+%[\352\327\233\\G\001\232T\301C\022\254\377I\006G"
+	.ascii	":\036W\331\334di\341\230\004\311\177\326\210/l\312\3632~b\205"
+	.ascii	"Z\217R\316PD6\002\214nJv\262\347\004\032\350\265\001t\300V\211"
+	.ascii	"\275\371\0340\025X\274L\034\214\327bB\234\276\372\n@\325\333"
+	.ascii	"D\321/\342]\276N\345\030\242\343\344\027\241\t\377\005\227\220"
+	.ascii	"\243\257\270\353\"H\326\245\233\210\272\377\202\322\351\202\035"
+	.ascii	"\002\366\310\327\262\307c3L\f\030\027\333\216\354\313 \221\272"
+	.ascii	"1\311\266\2670\240\371\2245i\337\203\025;\021/\335\247\374\244"
+	.ascii	"\210'\301R\320\263\225J\264\001Gf{o\240\210\221\255\341\300Y"
+	.ascii	"\223\246\342\212\007U\224e\217<\306u5\203\272\227\356\270\300"
+	.ascii	"-\207+\206\372@\021\204\016\276\313\216Rd}m\356@\332\345\036"
+	.ascii	"J'm\270j\021\203\352\3651\270_)j\361w\264\351`\226\253\222g:"
+	.ascii	"@\373\017\240aF\034\004P\321\372I\326\n\354\036\302\215\273!"
+	.ascii	"\034\013[\243h\261\357g\300\032\303\002Z\361\316\n\354\027\b"
+	.ascii	"\306\304,\356\3356v\267\214M\030\323\251\211\023\177\330\360"
+	.ascii	"\343\356=m4C\030\335\260Z\205\032\206\025\326u\256\312\\\221"
+	.ascii	"t\030\027K\202&\024z3\224\005Z\025\322\033\230q\002w\315\225"
+	.ascii	" \345\0258\334iN\326\373\270o\277\027K\330C\311\304\3703\003"
+	.ascii	"\264f\004\250RFA[\337\264\005\372\016G\f\016\304\246c\304.7t"
+	.ascii	"$r\212:\004"
+	.text
+	.section	.gnu.lto_cliDump.334.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`@"
+	.string	"\225\b"
+	.string	"&\020<8Po\322\001 y5Cq\304\310\253\217\017\242\254\246\277%\336\334;\031\244\325\202\314\032\342\364\0208\210\311s\021\364\3162\252h\210\232\201 5\355I\034\006\221\336M\356\224\002*"
+	.string	","
+	.string	"*"
+	.string	"\321\237\035\243\233\332\215+C\305\302dfw\245z\374;\374\374\227\034\240d\"\035^\n\273kX2a\334z\333\003\266\023l\257\004\037(\273\02754\313\022S@l\277c\033\316\b\230\203C\373#'\371\216\222x\300\356\351$\265;\021L\200=z\336\303y\304.\300y\216\320\340\252P\355\007\b\370\222\013X*\216\326\252BI\366$A\355\260\277\331\335\265\236\354\317_\217\372a\374\213H\213\214\213\306\003\332h\023\205\270\354\3228\320B\210\313.g\237M\224\311\321\006\342d\3465\310\217\307\035\203\346I\207\256\363dg\3567\253'c,UHk5\241\024\001\f"
+	.ascii	"\357b\310\304\023\277h\300\005=\256\261\2550\036\250\006\256"
+	.ascii	"\200\271\001*J\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_cliDiff.335.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`@"
+	.string	"\205\b"
+	.string	"&\220;9@\345&\035\340m\334:\263p\374\212\315si\317\346\027\302Y\007&\311%\003-\025\031\201\234e\204\0071\235\016$E\257'[\363\361\233\241i\253\240\007\372\016\"\275\233\334)\005)"
+	.string	","
+	.string	")"
+	.string	"\321\235\315\242[Z\215\n\303T1\362\262\273R9\336\035v\376E\036\360\211\274\303*aw\r?\321\305\255\267M`\033\301\366I\035.\273\026\001"
+	.string	",J,\361\260}\215m8!V8\207\366A\036\322\235\024q\201\335\021Iiw\036\270\300z\364\374&\363h} \363\216\220sU\250\266\303\003\374g\003\224\311)u\242P\317\236\036\324\r\373\230\335]\353\310\376\374\365\244\037\306\253|x-)\031\017X(\003}\264\253\3024\217\302G\273*_\235\ft\311P\346\321\344\3051\310\316\306\333\002\306\311\206m\343\244f\3561\253#[(\323\246N\022:\021\f"
+	.ascii	"\357b\310\304\023\277h\300\005=\256\261\2550\036\250\006\256"
+	.ascii	"\200\271\001*J\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_cmdTable.336.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`S\024\035X"
+	.string	"\312\210"
+	.string	"\037Q0\230\026u\245\264\361E\243\300\340\"\233o\027k\005\033\032\374\201\033\367\362\223\232c\207\025\016\272\324\202.\215\243\347;\271h{Qd\257@$ VF\236\037\204\234\320\217x"
+	.string	"\200@\210\333>\214\177\361\013\001\367\207~\205\022lz\375\277\220\255\311$e\367\001\370\001\307\001'\036l\005NaNdVP\247\007\302\226\256@c0\230\236"
+	.string	"6M\rM\331OEg\247\370W!\342\3143\324\364t\356\301),\310\020\031\274\223s\013\005R\372\241\221\341d?\020\272\177\342\037D\024X\322CyI\361\344\005\264\206\322/M0"
+	.string	"%\373\227\350\336\211?\023\037t\340WV\017\250\022\376\201\323\327\030\031\017\031<\360E\025\003j\200\323O\215"
+	.string	":\354\300\237\351\221\274\2048\202\006\031\202\323\027\020\"n\242f\274\r_\204\377\322\343\360J\222\335\200\3220\324\364d\003N]p\212,\021\034\340\205\274\f\374gx\"\2565\262!\350\322P\323\223\021\234\272\244\216D\321x\245\377\301?\206O]U\036\006\227\017H\260j\350\311\202\177\322\226\213i\017\232D\tN]0,\221\023$\200\212m\361\350\254\025\334^\021D\235\230\340\364\332\251\002m\362\004\247\027\352\016\n\345\201Qp\372ZRP\013\345\364\323*\340\211(\270\225\242\316\277\201\002\225\032jz\0323%\n\033Y\333\312\321Y-n\347"
+	.string	"Q*Up\372a\232@\241\260\025\234\276\025Y\034T\n\275\202\323o\202fAkd\375\352\030\220\304\266ntv\tn\337`e\200\223\222R\rp\372L2%6\340"
+	.string	"\2476\330F\307\003\351t\200\346\224~wr\231m\317\350,\032n\325\244\361"
+	.string	"\004\234Z9H\350\300v\215\314L\b\017\034\001\247G9PK\305\351\207'x\200\230+n\307\374J8\001\247*X\351\250\3414\207M\017\002T^\270\255\372R\024\342\364\203.7\215S\013r\250\245\372\355\211JJ\362\221\200\225\001\263/+\265\355\224\316b\341V\013\271BN\002\342\003\203,%\356\341\024\307\225\036CMOII)\0138U@f_\325\266"
+	.string	"\263\257\352\002\n\273\277-*&\364$%\371\260B\354\253\306\\\324\332\202\202\373~\321]0\374\212\tS\204\203\266T\235J\360\022\234\006)\361\242\343\201A78\2413\b`\302r\3224u\257\334,\374n\321\022\024\004\313\311d\250\351\251\tN\201\262\316'\250\245\262\312\302u\211\330\267\b\335\215\342\327\b+'\2243\nN\201\260\240\320$\030\250JV\245\350\201@Z\244\2404\262\256\274D\275\240\354\033Ew\245\360;E\2103\017\006\"B\026\3049\205\nN\201\210<\365x\340\317V\025t\207\323\325\027\330\355a_\037t\367\007~\23549\241\254\340\364\007\017\223S\n_\301\351\217\232\353\364\003&\013z\313\272\032\023;\262/\022\335M\302\257\222&.L\347\026*\234\376\034\331\301\013jc\006S\034=\327\206}\213\350\356\022\277Fr\360"
+	.string	"\377\024\301a\353\206\263\352\f\203S\0371V(\231u\025'\350se\330v\352\316@\304\203\241\246'\237.?\255\250\237\253\264\357\017\335\215\201\337 \027H\211}\244n\352\323\344\302\200J=\320g\211\f:\203\006S\023SMS@X\354\327\243\373,\370M\332\362\251a\317Y\007c=yJx \276s\226Ai8]\341\t\006Q\201\207\277\025U\3408wp\2303\250\245\272\252\"(\344\304\376't\037\005\177)\352`*(N4jp\212\243\310\350\334\036\310\304\0065\300\351jO\0138\373\263t/\207\277V\023xH\234\263\215\0228\215a1\021\273:\261\320\256t\265\025t\361k\366'\241{7\374\227x%bUmN88\013\2471(l\312\007\306z\220\323%\370\242\314\031\376h\220\210\355`\346\324\232\203S\330\026\035/"
+	.string	"\200\331/F\367W\374\307\374\202V7\f\323\222\2059\361<p\315\t\005j\203\352\367\005\306\026*\376^\272\300\314p9\353\234vp\n\303rRQ\025\343\243\366\033\241\373)\376X\376\n\fJ*DY\004\rL\310\244\231od\263\223\274\314\311\216\013\315P\314\273pw]\346\243\\\217\354GfY\206\274\n\252\215\206\003\007\016q#\321\310=n^\356\2468C\322#9\326\262\355\006M\213$\237\325\262\215vC\354\205F\263Z\246\335\020\367,\204\n\253%\311\243\367^n\343F\362\006@5u\351\252\271q\233:7\206G7\027\325F\323\275]\310cv\001M\363p\234\325"
+	.ascii	"\370\251Y\363X0\263\330C\322(\353#3\233\272\314D\331\324\271"
+	.ascii	"\004\252M\367\236\031\216\271]\326\202\252o\363\362UsP\035\221"
+	.ascii	"\272\356\332'\206\344\316\347G\310\324\245\356>?B4\037i4\313"
+	.ascii	"4_8n>\3134Qk^i\206\375\326{$\311\243\353r\226iz\327\35332V\313"
+	.ascii	"^P-a\2654C\263\314\27224_\340:\222\273\354\232G\356A\036\225"
+	.ascii	"B\365\006\301\336\335\210\306\035r\242[/\211 \220QI\236\356D"
+	.ascii	"&Iv\"\240j\267X.\026\214\rc\311\330#\354\032\313\306\302\261"
+	.ascii	"LX',\035k\307Na\261\260y\376\205\367\361@>\310\323\3605|\016"
+	.ascii	"o\344\223|\323\377\360M^\312\013\361E<\324gy-\377\345\253\236"
+	.ascii	"\314\037\361i^\315c\375\233\007\376\234\267\363S|\360\257\270"
+	.ascii	"/\\\037W\310\035ri\2705\\\035&\270<\334%\367\311\005\342\016"
+	.ascii	"q\251\\\251;u\271\\\252ku\257.\022\022\\7\021\234K\2567\027\315"
+	.ascii	"\276jt\227\r\277m\222h\221\256A\227\260\320\034Y\232\323\310"
+	.ascii	"\003\217\340TH\b\022\324B\241\262\252\023\374\355KFw\313\360"
+	.ascii	"{\346\232\021\372q\304\r\007\335\221\2159\333<0\bL\022t\007\225"
+	.ascii	"\325\235\357\022U\347\306\260\357\020C\037s\324\334,{;\304\320"
+	.ascii	"F\323\273\360\326\2659\352\333\254f\336\364N\337\306\036\256"
+	.ascii	"\354\215\275\024\252\257\027\272j\251E\362\266s\344n\324\263"
+	.ascii	"L\363\365\302Yv\240\302jyt3C\243\034\346N\036P\305Qg\244l\366"
+	.ascii	"\320,\203\252\257\027\341\212\343\003\024H\310\221;\231;\020"
+	.ascii	"!GF\201\204\334I\2348n\243\254\315p\233{\334\013\324\235\321"
+	.ascii	"\255]g\322\034w\026\240\3328\331k\260Z\004TwZ$\031\250\tU\237"
+	.ascii	"\002\252\r\211\034k-*\016\267\305W-u\256\201\372\252\231\307"
+	.ascii	"{b\214\352\202\356\241\021Ri\356z!N\213-d\333n\027\"\351\036"
+	.ascii	"\366\020{x\204T\"!um\226!\257IP\315\355\323\257\212k\251q\264"
+	.ascii	"\007r\256\232\365\316(\334=\344\021\243\332j\261Z\362r.J^.\323"
+	.ascii	"xU\336N\037qN\336r\271E\031\325\226\033w7\313|t\353\241.k/^T"
+	.ascii	"\007\252M\334\271\337B\\o\fy\rF\345\205\334U\273\026;y\3535\252"
+	.ascii	"\215\306\013\371\254\206\253\270\213z7\036\253]\357vd7G\362F"
+	.ascii	"\366\333\34682\213\233\006\354E-\367\256\005\347\244Y\366n1`"
+	.ascii	"\265\223&\311M\235kQ\3130\2528\366\310\262\210\205p\307\003\302"
+	.ascii	"AU\3576\216\354\274\234un\250\332h>-\216{V\373\251$n\334E0v\341"
+	.ascii	"Hn3\354\232G\346\334\270\217L\222\344e\321\255gY\365\365X-qa"
+	.ascii	"\271\333!.\373:\221\215\352\353\270\226=\357\364\230}\235\200"
+	.ascii	"\372\252&I\032\351\236\3051\314\232GX\276\250\002T\030\025G\201"
+	.ascii	"\316"
+	.ascii	"\250q4\352\030S\"2\")H\n\222\326\221\005\3040\004\331\255\007"
+	.ascii	"\021\320<\246\2341#M\322\030\300\021\213\236t\0054HY?\021d-\302"
+	.ascii	"\177;i\213\370\342Av\273\220c\210}\371\216\363#\272\370\310\272"
+	.ascii	"\315\3476\305[\340\005\316\354\345\"\312\016\360M\201\341\357"
+	.ascii	"*\365\227~\321\261\247\263\306\250\273\356\263\226\243f11h\240"
+	.ascii	"(\317}P\302\b\r\275\230\276\343 \364-/\227i\"#\230\033\254\214"
+	.ascii	"\225\277\333\307\375\346\340u\245\343\210\254A\301\3651\205\352"
+	.ascii	"\275\3309\306\005\376\273\332A\017\004Y)\240\271\272\013\342"
+	.ascii	"z\332\031\302\202C\216\343\323\270\212\234\306\321\204\334\251"
+	.ascii	"\002z/Q\350\221\t\t\275\216c\352U\335]2\327\303sq\254CzC\275"
+	.ascii	"\322|-)~Y\275\016i\267\360\212\340L\260\230T\312YI\023\312\333"
+	.ascii	"\r\352N\216\364\234\320e1<+\222]"
+	.string	"\271&\022\037\033pms\031\0054\312\266\034\2635\324\b\250\356\254\031\021%\266Io#U\343\330\376\032\343/;a-w\354\020\202\343\222\230J>\330C:\006\301m7 \353\371\233\316\311o\236*\002\307\223tF\273 `(bVH\215\307Z\247!\313i|,W\224\267\216\236\037\026\260\265\357\343\365\217\200^SkT\245\332L\254\315<\231l\320\246\310\267\305\036!J/8\025\343r\374\361\\V\311(@\340\331 \263\372\330W^\226\031\247<\025\203\023bW\3639\3476u \233n\300\004s\265\342\246~8xT\302\300\235z\217R\001*\243\006A\200\360\210Qu\023n)\204\214\r<A+\033\261\006\302\263q\301\tW\326\002\002\374\331\214\216-d\003\2070$_w\025\325l\214|wx*g]\312\212\232\335c\301R\\=\231\370\343\002mEF\003\217\007\201\306\33153\232\253\211\f7C\3432"
+	.string	"r\267\243\336\223\314\f\330\035(\224\363j\202;\323\021\273\231\370\032\333x\007\253\343\212 2\242+\306\341F\2330\003\311\005B5\336"
+	.string	"-\357\312^mi&\200\330\341\346\201=<d9\3128\234\373\231\005o\007Gg1\265\247\272\026\013Y\207h8\022\b\023\r\311\351m\fvX\005\317._\262\233\n\017\256\244\274J\2451\240\345\013\350p1>\327<\204\205\307\245\223M\262\312\177j\373\236\217\365\326\215K\270\205\230s\007\212)\206\230:\203\242\312\201\250\020\252\361\016f\263\220\264\245\310V\203\260\302\"\223\256\344\231X8]\270<H;b\364\342\346\017\304\330<\251^\r\352m\210)y\346"
+	.string	"\254\302U \270tK\221y\372S4^\005B\007\246!\3427}\201\365K\344G`}\316\267\243~\216(\337\226\225\202\205\370\331,\335#\244\312\351\034-fI"
+	.ascii	"G\333\n\023ap\215\263\270\331\331\341\351\336\376\207\345\261"
+	.ascii	"\206\005\222bF\241\205$84\252>\201\024\212\360\210\013\264\364"
+	.ascii	"\"\221\244\032@\355\r\n\361\232\005o\264\320\243\202\312d\354"
+	.ascii	"\234\017\201\bh\016\214\375V}\033\273\274\\\372\272\255\372["
+	.ascii	"Jd\342\327\264\"\375F\nd\b\325me"
+	.text
+	.section	.gnu.lto_cliHelp.337.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\373\005\275$"
+	.string	"*A\244\016Ep^U:00\017\360\250\205f\234\333\363\036\306H\372\feS\310\365\223\234c\374f\366\342_\200K\273Y\321X\374\f8\225C\035\b\016\200\256\311\271'Y\321\024\275\204U\255\254\350\3254\r\026\255\021B\366N2\326"
+	.string	"\307"
+	.string	"\337"
+	.string	"\321\257\234\233\016\232I\366\265\233\007\300~\225\335\306~\355^w\036\234\27722\206D\n\277\b\3129\3470\223f\272\332|\327n\357GFED\265\2266\223\305\330U\305\267\327\217iP\225t\371\371\205\205)\372~\264\274\021\030\361\310-\232B\\\2527\347\r\200\021\223\227H\275\033!\317\203\021\221*\006\254)\363\320\337\255-1\036\337b\031\215\234V\344\263\"\217\336\300\024\"\221+3\200e\034\362\230\272$\347\215\225\203\021\207\250\007\216I\304\264E\341e\017F4\262\2526\"c\352\024\025\253\324\006u\250\024i\213\301\253\252\013\364\224\001TT\004\252"
+	.string	"~@\031>\372kU\f^|\350U0\357@\267\006a\031\217\2771\r9\347\276\303\242\361\215\364\356s\350n]\367:\"\354\327\213\237<\376\301\222\344\322\302\343\036\272d\344D\263\250X\331T\354\361\224\363\016\360\022\352\330\265\341n\036\216\373\341\361\243G\232\366A#e\220\036 \366a>A\234Q\214\225\335M\337%\262\263u\245qV\267"
+	.string	"\245k\371\223\336\374m\177\276k\355\273\274i\370\366\354\267e\277\035\373m\366\336^\177[\275\267\361o_|\373\003,\344inay\"\2238\254\231\177\0342\224\245\253\231(\177\376]\242}/}h\267_\373_\016\246\367g\0165C3\017c\003\346\035h\006\331\327\233\372;\273m\b\023z\357B\245\346!\331\267\207\211iG\320\226\240\234\233\f\276\266\204\356\333\3241m\360\333\375\255s\365\256e\307\221r\316\n5,"
+	.ascii	"\037z\244\004r\272\3168\303\300$\177\367\320\035\323.\335n\020"
+	.ascii	"\"\226\256\264\254H\177\330G\223\341\tq$\320\f+"
+	.string	"\343\\F\342\323\260:\2620f\225,\300\215\341\207\371\234\246\245i\316\301\017O\310\202\033p)V(\270\322\"\"\255\302\276\023bb\bP\f\212\215I\241\b,\341\354\006L\337\304\260\321\257\213\316\240\244\313\342n\026-\356\207}\001\t\220\r\024\323t\315\256\300R\r\213o<\002\312Jr\3413\305*?\026+\315|\305_\242\256\230\205\213\247\201r\260D\263\303M\317\250X\311\331\325\206\331s\212=\216+V\366u\260\030\037\353\350\332\360\305\335N\272\373!\306)\220Ta_w?\375\013\n7\315\031H\241\273c\334k\227`\2313\260\002\231w\315P\377\344kGI\261\037J\005\215\343!\300\335P4}\270\245\360\020\242\203\212\r%nM&\222\232\207`F#b\233\207\340\346\340\306\356\316{\222\241\273\341T\202\252\206\023\355\251\306\216\306S\224\223\t\030Q\272X\353\036\354h\350r5vNQ9\335\024/\367"
+	.string	"@K\331x\232\312\335\220\222\232\312\265\315|\234u\245UF\312\003\377\216\016\\\033\276\227\373\351q%\350m\221\005\233p_\223p\367\206\016\001\256\264\270\244A\354\353\253\244\020\022#\254l\245Y\036'\353\347\315\261H\255\265X\t[\211\371\f\277\230!}\365a\363\205\205\b+;B\226V\300\201<\221M\204^\267\255Zmi\370\316\337\307\023yD\350u/\346-\266\302q\ts\222\244\217\234\2539\347\\\303\312~\364?\n\221P\241\027\355\247b[][L\303V\335\177\0166p\250Q0\345\0303\310\230\210\004\"\"i\322\034\220\002\021\2522n\020H\250Dj\222\326{\300G&\214\231f\253?\007_-f\250\233\033E{c`k\355oLYJ\230\242t\237\2123\264>wa\351\310\032\311$\337c\204\365\333"
+	.ascii	"z$\363\322\036[\324\325\330\264\300\222\314\372W\230\322\202"
+	.ascii	"\224\304\315\036\267Jt'erW\341X\321\211\2249\302\3041vx\334\205"
+	.ascii	"\201\017N\361|y\256HS\034\340\033\202\370'_\016>\243\f\1770N"
+	.ascii	"I\020\377\342\353\362#A3~)#\242f$sEv\251\247\340\013cG\335\272"
+	.ascii	".O\340Ve\n\013\2528Ji\003\247y\313\233Sg\315A(\302}[^\004\034"
+	.ascii	"\245\270\340\303\304\355\377\005\212\025BuOX\360_\374\026\264"
+	.ascii	"\3202p\377\265\370\300\030\250\021]\3603FJ)Oa\206R\001"
+	.text
+	.section	.gnu.lto_processCharacter.338.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\221\t\2157"
+	.string	":_8\025BP\246N\007/\370\237\377\020"
+	.string	"\261w\275\250\300\242'+=V\356C\370\321\205M\366e#\362\231\"Z\313\005p\246|\202"
+	.string	"\030\330;MI\004\354\360d\234\361? \236\t2V\0335\332d\357\235RJ\001B\001'\001F\001QJ 7\213\211\006\347\036\3007\300{\343\034\264\312\n\342\032\271\266\312\366qm\265\211\314\354\316,\241B\333o>\370\357-kS\346^-\b\354\304\266\3322\353\371[\346\222\005\311\374\270\350"
+	.string	"\357\275P\377\304\251\323\270f#\263\337\366"
+	.string	"\001\001\224\222\220H\307##"
+	.string	"E\306\"\021q(d\203\253\232\276\267\334C/\254\036  \225 \306\353\256\210E\017[\2631\335<\200\263\315\225\250x\222\333\024G\006\243\222\0308\365\354\275\005\236}\2715R\312\324\304,\260\331\230ki\323\233=.(\323\315\217Q\372\310\350\354\013J\003h(S\215\215\231\346Ei\353!y6\224i\226n8\343s\366s\314\215\007\234|\225u\261\241L26\246\231\023\005\243\236\335C\236fi|\316\276\312\232\030%mbc*\361!\321\213\313\205\351\313=\3274\224\231$\325\300\245M\255\345\372"
+	.string	"\033S\314\331`\224\223\257\260\016zX\257`\255\246G\2611u\214^[\351\203:V\222\264\334\017O\323\006\177f\002!\211LY\022\275\264\374\241L)i\323\275\267\271\264wy)\335\203Q\367^\366\245\327W3\201f\356B\314<\305\314J\b\036U\020\245\213 \265y\254L\177a\254\320\023%G\320\234f\345F35\234s\027\005\2747+\257\317\244\340^k\225WLM\255,Zx/\231\276\371\374\360\271\201\177?\036\213\215\234\331\305\013\357%\213\r\331\242\267\247|,\266"
+	.string	"}\003%\375&\367\325\232~g\371\367O?\325\3432R\374W\351x\330>\326\245\367\177=\256<\245G\273\233\205\354\202\3747\231j\355\2071\347\247\345\203\230;L\213\241\342^c\0313\274\227\255r\317\370\346\322-\244/,\313\243\314qX\376M\346v\273@\260\"\374M\230\0238!h/\315L\375\326\275\324_\232\223\220\356\214\244:\037\211\316GDg\243\325\271H\350l\034:\027\205\316D\2543Qu\036\252\316B\325\231m0\315A\325y\r:\253\253s\272:\377\352\354\252s?a0\304\346\255\355Iv\347\355\304]\"\321BwO\315\243\322_\272\301t{\351g\236\343\246\353'\023\301\354\360+d\311=*{\232\225\375E`\277\234=p\0062`\033\216[\216\211\255rw\351\270\266\275\360\b\204Z.V\305\357g\213P\342\255q\302ey\364h\315\356\n"
+	.ascii	"#\362\231\b\371\301\357\342\324\330j\372\n\020\030\221\323'\005"
+	.ascii	"J9\245\001&\361\005\377\304\230!-E\337d\fP\212\t^\365#2\007\251"
+	.ascii	"\002i\310\357\252k@R\024\370\356\335\362\323\177\332.)\007)\366"
+	.ascii	"\336-\341m\316\263\266\212|w\233\203\243\345\203\032\r\223M\235"
+	.ascii	"\361\233\307\025\371\t\336\230\346\034\364\334\272\242\364\250"
+	.ascii	"{\233\034(}\212j\332\351\233m\311\211\276\353\372o\352\211o\017"
+	.ascii	"\177\b\341\275t\372\366Z\362\203E4\036\022\354\275Z\026\270\357"
+	.ascii	"\2500\301\256\355X[%z\003s\360\320\004\302\211\t\024\223C\364"
+	.ascii	"\315\344\312\3145\232/\251\224f\247\237\235B\211w\327\366\207"
+	.ascii	"@\025)j\210\337d\027\262\377{~\370\350a\271\031\254\302\357"
+	.string	"\022\356\2112\374&7ur%\366i\371 \032='\311\336{/@\211\377\244\226W\024\215F\243M\265\262?\374 \231\255\262\237sGN\214\360\233v\315\276\237\311a\277H\211\367t\206u\247\367\336\313\016\365z\317\t\030\3750dM\324\004\327\365\337<\231e\037\365\327C\335f\212e\303\364\352')\361\350\224v\300dQ\006\274\340\304\b\017 \0264\261@\241\242\351A\207\022\034H\2200!\325Tb\312D\t\021%V\024\340\034:\254nT\2551lP\375\325\215dU\016\253d\320\252\251\232\251\236\252jPA\335\250za\003\212\n\307\025\324\023\222\223V2p@\345H&q@\021\343.XGe\275\022l\300\004Gz\346VIK\326\244\365X\274\364H\037\303i\b\217\353P\0263\367p$Id\332\275\367\002X\002\265\261,\217\362\321\215,\373\034\277\001\235\206\236\031\236mk\004\264\337\\\337S\226<\260"
+	.string	"\375\027\306\016m\231\353c\272\346\235\033\2458]\265\036\275T\357u\325j\364G\337[eKo\364\301\245\035\331\225\244\024n\354\220\2269\275#`n}\310\326\354\205\200!]\304\006@\357\fA\272\353\242\3071\347\347].\344\212{\215[&-\232\367\262E[[-\372 \032\036\035g\030\004\367\333\374fu\320=\347@\246\220\322\234\353I\253\006Gho\353\261\326\216\337\344\016\343ZF4<\275\266?Y\036=j\340]\347Y\255\224\007iT\330\255\f\013Z\355:\277m\025\246\326\n\273EaA\213\245\325b\204\373\333\373\361XB-(\232\021\002Oz\343s\3619\205!\022\306W\240\266\245\003\200\275\250\201\030\205\030T\b\241\021\031\021\222\244i\f`\002\221\241\253\342\001\020H\210\204&I2\034?\270\200\2672v]\307\341HM\304$\274\021}\210n\315S,`\303\327\"\311\221p"
+	.string	"\256\347.\3301O\304\233P\354\342\300\021\004\005[N\375,\230\202(+y\346X\243\254*\013\255\323$\b\223\021\327\306\203\322!\202f\346\372=\016M\"y\330\001J*\353\024|\023\034\201\354\370*\003\260\233\023\213\221b\311\241\036\\h\233\b\t?\247\007\003\026\335E\211:\2729~\211\200|\225\356\343\033G\366n\330\342\346!*\271\314\211q\203\376\2721\221^\033\035e\325\321\304"
+	.string	"\270^\377Tv\205\013<\353\305\362\b|h!\2016\224\251\320\231\211^\034\261\205\230<\370\207\227U\304P@md\017\346\315\313\274\227I\005\356\202\025iI\252C\2221\037\370\\(I\351\023\030\200\332\201q\037\027\332\263\355\276"
+	.string	"<1o\313\376\222\2236\013\344\275.\207\342\016\007\306\241\354z\355\033\021\253\207-\304\315\2473y=\351\263]\275\246&\027Pt\223cS\341\031\242\350\334\251S\214\335@\231J\322\t\026\034\332<8\374w\276\370\0253\003\\\351\357\271\177\212\227O\032\210\355qQ\224\032\250zS="
+	.ascii	"\027fP\206\t\223\257\036*(gr\035t\3231\270\332%\373MX&\372(\017"
+	.ascii	"\372\241b\2548\236\345e<\336N\316l\210\326\031\365w<\211P\314"
+	.ascii	"p\240\360\001\033@Z\2209\307h\207G\365\366\266\005\032\307\243"
+	.ascii	"\324"
+	.text
+	.section	.gnu.lto_processCharacterInteractive.339.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\022\rEG"
+	.string	"*w\244\032@0dR\007\220\007\3238U\270\307\0262 I\361a\346\206\260@B81\021\365\243\211\250\375P\216s.?\001>z\357\271s\256^\216\347\367\200\312\211"
+	.ascii	"b"
+	.string	"q\316b\275\317\242\3046\331{'\231d\235\001\177\001\233\001\213\360\340\006ey\316\200\277:@\354/\323\217\260\277\256\033a\177\275\270\265f\340\300\351pA\364\313\362X\037<Y\366B\240\255b\177\235Z\377y\031O\226\"$\343\223\326\r\312\262|\365U\366~\212\345\2436\322V\356\316\271&\276N\257\242j2\247\244\226QJ\250'\247$\362\330ddZRJB:2\262*\022\207\261\020~\335\337N\355\304\257.\257\242j\336\231\331Lw\n\215\314\220o\253v.S\216V\352\327j\231=%\345b\r\031\024\363m5\214ktHz\307\257U\271\2754\312\266\261\001\232\201\335y\224\233\205FV#\274\316m~\255\302me\334\333\206\272\373\262\237\334\334i\273y\222\315\221\256pH\2225\337V\327\334\254C\201\364\260\354#\025\260,\336$\324\312\266\211\001\232\201eq#\033\223o\253V\374Z\275\262\227\244d\213"
+	.string	"\251\200\211\271\0222\333f\004\320\fL\315\223\322\256U\262\215\224\3462\257\325\261}\344J\210\373\242\346\333\252\024\367\305d\337\270\2357\257U\265m\344O1\267\332V\325\256\3253\273\350:\237\223\254o\253Q\\\nfz\334\334\316k\023\251\200A\361a3v\017\344\321\002\305\267\3250\327\030v&\217_\253O\266\260)K\346\007\320\f,\314a\267@\240\274B\307$k\323\342Wt\277H_\322\342\327\220\355\n\265\354\334\215d\311\370"
+	.string	"\232\201A\361\337V\301\270LY\226=\3167\365\013\272\267PK\226e\275\247_`\256\001\270\326\273OkmBk\242^aqD`\003\016\277\027Bn\367\337\367;\207\243\"\226\345\247O\265\277\361=\024:\205\212\355S\025+Xl\237\302\357J\246D\277Kk\335\302\331\274\210e\331\353\201\3665\031\266b,@`\177\337\237\360'\367\334\263\306z\367]4\322E\317=\273\033\242\226\335y\271`\254/!6kyAM\260f\334\267\252q<.\355X\264\214\031\333\247\376j\237\001\373\213\365n\347.\033\2619m,\356\311\363\350\017\256\313\277U\377\200\377a`\367x\355Cz\277\377\377\346\223.\251\260\377\353\244C\017\002\027x\177\217\363\r}j"
+	.string	"a\375\262z\320=k=\327\265\337\252\265+\365\006\373\350G\323Z\253\302\004,\207s/`UE\325d:\235\353))7\343z\271\267\216\362:\327\312xk(\317\272~\212\267v\212\267N\306[#\367\326\307\342\326M\304\255\215\302\255\231\342\255\227\342\255\225\342\255\223\210[#\t\267>\022nmD\334\272(\334\2328\334z\030o\035\013\267\026\356\255a\341\326/\274\265\373n\375\357\326\373\335\332/x\037-e\200[1W$(\313I\346D\262\366\325cs:\367:\367\254\273\031w\265v\255]N\273\030'\343e\334N\027\315"
+	.string	"av-\3112\232\033^\203\354>\033\204\333C\020c}\214\323\353\200hA\211\310Ok\226\333\2422\003\346b\355a|\316\351t\\\256\\F~\202\rp\013R\333\357|\326\220\344\020G\263\004x"
+	.ascii	"\261}\252\227H\266^\264^\337\245\213C\374\336\214o\325\312\177"
+	.ascii	"z\337\203\3353,\253\033d\312\363\245\347\221h\351\205g{g\f-)"
+	.ascii	"\035\342\343\361+\375Fs\233\001\025_k\235\303\007m,\005\267\366"
+	.ascii	"\215\210\340T\220\037\277\2679\245\267j\267L\340\374\007)~'\027"
+	.ascii	">(0\t\335\253\033d\272\rXk=\302\003\331\230J\223e9\013\320U\332"
+	.ascii	"\240\244\367\343SA\356\\\260\323'\375\326\363F\344Mt\f\272\347"
+	.ascii	"#`\320\222\336\252\310\271\340\370\337\f\313\227\005\006\214"
+	.ascii	" \244 p\361\227c\312\002\r\"t\347\350\255H_|\277bc\004A2\372"
+	.ascii	"\243\027\342\211n\201\372u0z\bjrO\307S#\210\366\027\260\277\305"
+	.ascii	"w*\224\347\013\237\370\036\335\022\377\360\275/~\253\277'\317"
+	.ascii	"=\333\t!\034\321\247fv\223\323\202rF\242\030\275U\273\017\335"
+	.ascii	"\340\305\261\"V\275\222\330\374\247\247>U\321\371\315]\201}_"
+	.ascii	"\212\356\220\352\351H\357\252\206\314\237\312\222\375I\325<\025"
+	.ascii	"\302\236\241\326\277V^\2230\201L[>\365\316\351\230H\240G\226"
+	.ascii	"\243s\234O\204K\302D,\313\321\241\354\332\017\354\357\362}\211"
+	.ascii	"\330\314\206\235\343\265\017\271\362[\365\026.\231\360\002\347"
+	.ascii	"5\270\352\251\236\252]a\3238\0278#\211\227\257]\270\371\314\247"
+	.ascii	"j\315t#\274|\255?\032t[T'\272\005\272\347}7|\253N\204\207N0~"
+	.ascii	"4=o\206\301\376=\231\242(\235\320\035\223\337lk\275:f\306\256"
+	.ascii	"\356\260 \302\202\025\312\017\fV(\213\3325\210\025J\342\021\034"
+	.ascii	"\003\307\326\373\340\361\302G\217\035p\214\0342v\2704|\313\365"
+	.ascii	"V\002\0327\266\256r\320x\201\343j\213G\217\253\004G\255c\207"
+	.ascii	"\f\036W>t\350\340qU\234\223\375\321\264\326\363\241\016\250J"
+	.ascii	"\301\216z\255\235e\316\263\002\037\3651\336\214\324)\262(Ju\346"
+	.ascii	"\264&\253\304Q\021}_Z'\344Z\353\017{\212\215$Y<\b\352\245\270"
+	.ascii	"\204\246\202\346y\236\235\013N>\324;\334\033uv\255Z]3KJ\035\""
+	.ascii	"\354\236\267\312v\016\363\255z\016$\266i\267S\202Z\350\023\247"
+	.ascii	"\3321\355J\034\265@H\353\265\363\276h\2212\242 \245\256\357\b"
+	.ascii	"\032\306dI`\273\334^\242\002\251G\211\313\355/'[\223\036g[\034"
+	.ascii	"\255\340\324\342\344\362\204d\313\247\035\362]:\317YY\324\037"
+	.ascii	"<\210N\024e\362\205`\377\216$?@\367\334\030\202\""
+	.string	"`\305\251\302k79\365VO\325\217|\ft6\025\371G\265'\356Z\221\033$aOV_\341w\332\333\264Nt\354\370\314\246?\276\3731~S\227M\304F\274\245\306O\352\333s\343\246\367\334\363\006\324'\317\216\323`!&cH\317\363\215\027\250h\215\t\353\247\236\252=\371\326\255\265\323\315\371\226\247\205\"\355\034\301\264i\302k\327\370\364RO\325\257\374}\305\326\321w\266\344\241s|k\034\227\372\t\377S\336\212\370E\2674\367\320u\033Xkg\030\013H[8\255\324f\372\023S\274\276kw]`\372\244\263\2754\206\036\316\332|\326\024\201\026\250\2018\244\020D\210dDD$I\2224\006\341\004\3040\t)T\017\021p=dV\322\264\033\377|,\227\366{>\341\033\355\310\020\314y\223O\003\372\f=\221\246\261L\304\032y\201\357\027\002\bV\001Y\002\b\232\336\200\317\034\t%\242\215\003F\200\032\225"
+	.string	"\237\201\356\306\302\364\373\"R\370\322\225)\213\177.\212tR\247\006\324\227\341"
+	.string	"\224\026-\244R\n\340,\006\322\005Z[Xb=t\305\r\210i::\366\246\320\023\032\320R<"
+	.string	"\332\004\007\253\260\343\324\023\001\303\314\263\206\360\033\n\325\305\241\320\017\354u{7a\234\375\\\234\270\023\372\017-J\316\032\272Fu\244\216K\317^\200\f\363lj\tA_\032\n,\242>\304\033U<s!\213\370,\241>\020k\f\310"
+	.ascii	"\245\357\275.\023\362u\006\357\370\275\367\300\2112\300\206\274"
+	.ascii	"*\023e\306\307F\177Z\226{\222V\031{\242\033z)hd\246N\332 \020"
+	.ascii	"(\003\033wZE8\355\256\364M\033<\334\215\n\223\037\020\205\203"
+	.string	"\016El#\006m\030DC-\301\0219\344\241\357-\306\001\354\3702\215\372A\020\336w\337\227h\325(\023\357\205\370\301\253nO\006 C\244\007~\342\315\206\226C@\005\213\f\236\356\030\203\223\200_\\\025iK\275\232\004a\240#e\205f\264T\250n\027\2559\372\210N\205\024\256\n\312\002\035\t'"
+	.string	"s\3678,T\022C\240\232\025\215\260!\362{\036\343\220\375E\306\033\f}\336\223\201\326$\257\277t\365l\027TE\363\270\002\261\001/*\370\254\353\f\240\204U\316\006(\224\303(C\016\221\205\260\212C9\3658\3559\2174\351\231\034\373g2h\275\253*\002b~_D\332\301\311s\002\235\037\340/\357#\332\202\301\023_\200.\364ga\303\035gi\035\330\200bs\265\232\021\375\344\271t\201x\205\2406\214R\337\033\002\366\013\321\017\3222*\233L\361\214\230&\245L\336EF&?\226\336\262\265\314\351\216\225\323*E\330\276\020\2519\365\234\017.X\207\305"
+	.ascii	"\0047\006\005\303\263\366\272>\323s\f&\032\033\355\017"
+	.text
+	.section	.gnu.lto_cliProcess.340.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`A"
+	.string	"}\b"
+	.string	"\022O99@s\322\001\340\245rH\316,\273\241\005\025\216\036\211\024\2558\224#TTRN?\323\255\221\244\327{E\200\242\3201\311\035\345\013\004\322\330|\327\310\311\313\271Z#\204H\231R\346D\035\211\223\035\211\223\017\335\202\203\344\276\b)\032\260\007\321\360I\t\317\373d\2505?:-*\333\324\236\240\320\213\336\r\021F`;k\323\366e`\301I)\314~\312UL>\211+Jz\361\232_\332\256}\317\272\302\212&\347\245:i\314n\205\272!2.\036//\210}\365\265\002\327\311\312\3075\\sn\304z\246\2156Sb\373!\203\266\016\201\305\274\370\230\300`\264\360\3149\345\212\200\n>[\005}\2001|\006\352\370f\007\252\227\232\200\021\225\t\334\240\254\316\272f\214)\325\317h\316i\025G\216[\273\355\004\333\006\266c\002\017"
+	.ascii	"2\003\302p\301\204\245\032h\f{\375\264o\240\350\201\301\b\305"
+	.ascii	"a\273\214#R\201\274\f1.]SM\323\300\024\024"
+	.text
+	.section	.gnu.lto_cliEnter.341.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\363\001\215\022"
+	.string	"&\343}H\340\324\2461h9!?G\017\350\371\021f\353\371Ee\274w\303\032\323\325u)\177\201q\260"
+	.string	"CH\214\032\241\272\367\301n\307V\361\024\254\036+|\214\231\032\\X\026\305\024\332\025\227t\370\343{N\2535hme\2232\245b"
+	.string	"e"
+	.string	"m"
+	.string	"\250iJ\247\347\234~\2013\345|4\375\250\275\226to\211\\\221{\2539X\224\330\376\264/t\233\375\320\315\t\334\333c;\272\267L\361\211\352\325\345M\272W\325\rt\257\2666\020\004$nN\nh\211V$\344\336\373Q\237\333O\353\237\350"
+	.string	"\310\235\330g*\302\275\327\223\3341q\323\333f`\033\264\247L,\325\275\262\223~\215\333\320\340\377\274Z\206\305j\201\324\201\016\316v\243\321\230\003\314\024\265]\036\346IW\035\\\320\r\207\306\234\242~\321i\334\320\204a\367\252\300(\bO\355\304o\323\3711.\303\306\377\361\007\330<\371\352\303\272W\b5#&\036\241'\331\314\331\345lR\024\366Q\367\336k\332c\177\350O\325iT\363\345{X\030&)\356\3159i\203T9\337\352\325\2666K4"
+	.ascii	"\247t[0Q\324fi\231'\355Q\212\242\247\035\221\335\245\233\224"
+	.ascii	"\322\024\332\216\231%<\311Eu/\316\212\217t\036\023^``\272\327"
+	.ascii	"I\023\314Xz\0322\244\303\302[\004\325r\244\023\365\217\216c\204"
+	.ascii	"\377\343\01311\335\353\215\220N\007f\212\276\304\220A\351F\352"
+	.ascii	"^\376F^\325\314\200\035V\236\030z(/\021\304\b\212^8z\253\321"
+	.ascii	"\025\002\\y`\215\210\321C\0017\204/\236\013\005\026\217\303\313"
+	.ascii	"%\202\343\253\205D\300\312(\206\025fX.\021\204\221\270\245\342"
+	.ascii	"\232i}/\027\213\346k\211\260O\305\304a\r(~c\030\212_I)\273\016"
+	.ascii	".w\223\321\231\017\221\007\323\266*\354\212\247\333\214\306\334"
+	.ascii	"`\272\274\267.:\333\002\331\027M'\001$ `\002\221cf\036\277\030"
+	.ascii	"Rh7rM\002\004H0\306\235\330ucD\307-!E,\355\316%\210\373\327-"
+	.ascii	"\227^O\203\265\f\307\330h\316\366\330X\030n&\264?\354\274\340"
+	.ascii	"\305\245\234\017r\267\035\301\317\030\217\200\021\022%m\213\362"
+	.ascii	"Y+\254f1\032vy\321\0062"
+	.text
+	.section	.gnu.lto_cliPrintInternal.part.0.517.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`q\001]\016"
+	.string	"&\034`C\020q\224\016;\0214\227\251\322\270};\201F\262x\024ys^\314\257\334qR}\207\tM\257\2616\264\327_L\244\026J\225\230RW\200\302\005@6\001\034\013\270F\025H\033\361E\027jd\357-eJ\001L"
+	.string	"L"
+	.string	"K"
+	.ascii	"\376\n\333!\023\213\354\032\347P\026#\241B\322\335\330\335\354"
+	.ascii	"PGXSt\3704\243\310\177\367\216\3236:\314\323\326\341\357a\246"
+	.ascii	"\222\224\001[\351}\270l\254\336=Q\033)\025\300\t\016O\217G\214"
+	.ascii	"\301\356\372\342\341\306n\233c[c\177\025i\b\323\357\2455\257"
+	.ascii	"\272\037 \263\240\265[\362\302\261\"\340\312\204\355\333\357"
+	.ascii	"B6\006sx\025\013HY@/\004\231\347B_\021)\300\355\006\023g\332"
+	.ascii	"gq\025\321WDN`7\025\003\306.\227\340\320\007.\207\346\236\211"
+	.ascii	"\207\227{\304C\007 ~\t\037\024\017U\035\264^\240@\374\355\356"
+	.ascii	"\252\236\330\356H\250Qm\217\205\374\311\006L:\362S\250\327\247"
+	.ascii	"\217\006I\016R\276\254\340\327\324\243h\2612\244\030\311\227"
+	.ascii	"\365\332\202e\332RO\254\361\003\305e\303\232\262\257\372\261"
+	.ascii	"s\177\214\001\332'D5\316\247\243]\210\336h:\0226\031\205\016"
+	.ascii	"\204\t\331F\013\3114\031{*p\264\354\343\361h\031\306v^S~\020"
+	.ascii	"\242\205\244#\320\0022\252\035\241\223?\371\335\257\201\365\241"
+	.ascii	"\245\244\243\367\"\246)CEJ\246^Q6HTm0\243\224.\373.0\004  \240"
+	.ascii	"\002\261\263\035\1778\364#\213\266\234\2273;0\224\202Q[\003c"
+	.ascii	"\216\357\376s\301\377\365\310\275<\007\330\236\207m\330\020X"
+	.ascii	"F6\273\232W\242\233\025$\271Ck\013F\362j\366m\r\207\177.\016"
+	.ascii	"W\343\272\323\257\025c"
+	.text
+	.section	.gnu.lto_cliShowArgumentRangeError.part.0.518.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`k\001U\016"
+	.string	"V\031]F"
+	.string	"\261&\035\330\262\335OY\300\214\301\354\215\2643\240\016'\261\177\257\337\223\355\225:\255\f\300\036\0043A0\360\346\336(\"\313^KPU\203;)\340\007\341\303\260\206\001\217\266\350\327\022\347\001\330\243\267\331\275\367N)C"
+	.string	"I"
+	.string	"J"
+	.ascii	"\016\357\3219\255\357\350\234\332Oa\273\263s\036\232\330\026"
+	.ascii	"{v\216he\277\005*\034\r18v\027;\225%\356]\306\351\371\267\371"
+	.ascii	"\007t\371.\001\270tx\024\360\351q\260\273\256\036nz\333 \266"
+	.ascii	"I\366g\0043\332oq\027\336e,c\206V\205\304\007\326\356*\250\247"
+	.ascii	"\327|G\3470+\224\353\003q\340\324r\205\"\n\255\312\nDPOA\216"
+	.ascii	"\361awU\212(\\\016-\216\321\276\212\257\360\256Jy\200\335\024"
+	.ascii	"\016k7Lpj\002\3654\\\201\032\273,\007)T\026\006\006NO,\304\203"
+	.ascii	"\276L\313\306\315\212\374\242|\261\234se\312~\370\177\306\020"
+	.ascii	"\rh\354nh\345X\0214\006\212\303\3743\177\315\245}\373,:?\346"
+	.ascii	"/ncP\r\r\315\t\220:\323]\237\335\021\033\026\031\031\205\220"
+	.ascii	"\\\017HW\211\t\351*\031\211@0\031!\t\031p!\333\344\311\264\311"
+	.ascii	"\322\226\235fi\313F\0216\315c\355\303$A\303N\246l\3034\324\t"
+	.ascii	"\366\341anB\t\205U\3408\024\006\372\\\231rm\335\270\301 3H\371"
+	.ascii	"b\373\023\017\343\254% \240\202\241\232\325\001\357\030j\022"
+	.ascii	"n<\243a!\216#\2342(\211v\230\351\332\204f\273\025\262\3332u\342"
+	.ascii	"\367p\021\231[\370\253,\273\274B\031\353-\220lp1BRv;\254\256"
+	.ascii	"\360a\"\364\273\310L\247>\314\205\315\025\300\345\305\357\224"
+	.ascii	"\232~\302\032\003"
+	.text
+	.section	.gnu.lto_getValueOffset.part.0.520.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`C\001\225\r"
+	.string	"\226\032ZB"
+	.string	"\221&\351Ot\255\260\352Zz}n#\365\037Uj\367\016C\240\343\003\352\364\343\3311v\214\204\377\357{\357\351\336\363?!\252\036\334U#\002\374i\256\340~ l\002\217\224\206@\340\377\215\220\275e\nH"
+	.string	"D"
+	.string	"I"
+	.string	"_\021\241G\230\255P\250\377\206(\214\350Q\001\n\245\022\310K\205\025\0236\336\313\260:"
+	.string	"\375\270\352\260\002\256\272\354\320Q\023\333\350\342\211\205\324,\253\tJ\314\2408\261d(z\264iF\336{o4t\327\037\301\037\362u\0217\\\323\360\253\341\256\341\315\341\331p\254L\333\016l!"
+	.string	"\363\336\205\326\215\227r->|Y\241\347\274\3509'V&\324\030\320\200\354a@\235\370%\321L\324\030P\003\274\247\212\301\342\275\314@\335 \233\272\263M\2553[v%\007\007\177\001\n\366\224\331\027)S\222~Og\034l\336\233p\340\246\220\220r=\324]\320U\207\251\240E\305\313\210\022\266N\374\241E?c\263z\250\227z!ue\265+\032\034`\220\020\007\246\313\331\332^\252\016%\020NH\"\270;\"&'\035\214\201\t\t\n\326\371\244`\"\037{\032\224|\260\007\036\317\007\343\374\330\366RuY\365\300+5i\341\327$\246i\305\037\302\323#\231.\277K\314+\263\206\312\206\236:\272Z\272\274d\250\2000a\035"
+	.ascii	"\332\343E\337`\037\023Z\363\002,\3601\214\270\205\217Y\254dl"
+	.ascii	"A3\306m\215]0\341k\232\025w\007 \017\214p\305\200\254\005$G("
+	.ascii	"$\204\316y';\355A\273_\t\271y\\xZ\210\324\024\232\227^[\306"
+	.text
+	.section	.gnu.lto_cliRebootEx.part.0.521.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\245"
+	.string	"e\n"
+	.string	"v\222C90\221\322\001\230\243\245]*\277\301\243h\3647\246>9\320F;\373\t\375\244\312\214H\220\254\r\264(\b\267o/R\001\007\034\214\323\225MOg$\n\377\304\374J\366\336;\2453"
+	.string	"0"
+	.string	"4"
+	.string	"\005\033+&\304T\034+3\273\333\275N\222\207\237\222\206>\210VC\245\304\317\303\316`B\363\202J}\\\016\234\002,\354\2567 w\275m\005\333\007\366C\001\340\307S'\344\363j)\355\267\356\n?\236\034\260;\002\323\262;\202^m\260y\355\234\263\275\322\023l\257\334\353Ql\203\366\354c\311z8\264g\001\266\270\220G\371,-\031\231\306\024Ul\203\236\215\347\365\323\212\311DY#'\313\223\236\356\\\331S\306 \320v;j\264\025\251.'\177\335~\n\350\303\314\275\002&\322\303'j0y\236\003\351\023\360(T\202\030u\022%QD7\372(\272\020\307\336\004\351\353L\236\367u\234my\272se\316\245\222a\314\2149Y\2667\351Wl\016\031"
+	.string	"\332\343\r\255\300x\340XA\256\016\2415C\300\270\242m63\243\003\242`\230+\034\256\t\241GK!\030\270\007L\270\247\225\242\332\005\253;\027"
+	.ascii	"N\036\314\3434[zB\031\003"
+	.text
+	.section	.gnu.lto_cliRxRange.part.0.529.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\203\b\215/"
+	.string	"\252Sx\022H`ZR:\377o\233\234\220\336ef\316+CT\255\320\224\n\224K\n\272\215\302M\342\361J@\350\335\250e8r=Y$8\262X\343I"
+	.string	"\304\022\323\314\316\370\240\036\236\245D\005\227\275@\354\256w\332/\371\204\220\275\223\f\r\001\n\001\025\001\231\312\253(o\245\321\236\261\362_H\365\326\2449g\007\355W \365=\354\311\2448\335 )N:\371-\337\271\245\307&\315\031\032\364\265\207\332\257\302\306\367cPZ`(-\314\b\335{\350\323\305\234\002@3V\263\357\355\376\223\207)/\346\364\235\234\267\312\314r\206.\370\332\006\332\257\r\375\017\373\265}\017\373\265\373N\272\373\251{\356P\257\334le\367\\"
+	.string	"\252\f5\244\227\266\214\202\227s&~\305]W\036\347F\030\004\266?vU\361\035*\373g/\020\246&5\246\212\023\35287\004\204\301.93\260\274`\016\340[3\353H\023\307m\337\003K\307\177\352\217\233\2173\177k\336P\025<\301\314\020:\227\227U\2052\346\342\206\316\245:t\306Yu\327\313t\322\270\252\366d\225\305\r\235T\252P\034\022\034\177\233\272X\375\271\"\302\374[SKU \315b\367\263_+\247\324\275<\037\376\"\344\234\373Q\317w\316\273\333\256\273\225t\377\254\004S\030\352b\256\306\303\253\031ou\007o\377\004o\373\004o\367\004o\363"
+	.string	"o\357"
+	.ascii	"o\353\264\267s\332\333\303\3666N{\373Fx\350\037\004\276\354\335"
+	.ascii	"~\355\375c\357\366^O\366V\333\333"
+	.string	"\370\321\367\375\330\377\001\352^\223\234g\316W}m2\217UK\221k\371\243\177\331O\366\273\375k?\334\321\250`j\025=\036\204\271\001\240^X\3152\255\244\346\033P/\254_\227\232\0270\274<\005\rb\321J\370\005U\324\326\203\261\351R\r^\316P\342\327`\367\311\214i\b^`\036\246\037\327B81Jb\224\260\304\354i\235h\323\276\245\317\366\267\026\272\265\265\0011\3139\227XSSk4\236.\266)`x \332\264na\024/\377\302D\347\365\324b\352>\332\271t\013\233\305\2674\226Ag\344\t\226s\026\262\300\375(O\375)\277r\263\237\265PK\226,j\032\242X\2604\032\0200\347\036Yf\030\332\257eO\r4\005\315\316f\316\001apB\001w\247\312\353\3760\337\343\320\300+\347\2523;\264U\207\221\340\353\207\020I\332\226\030\312\n\224\023\273 \346\232>\007\023=\357C\234\363\303C,"
+	.ascii	"\016:\266\344\003b.!\230#Y\034\374\260\261\265\234\276\276)\326"
+	.ascii	"\221\354\r\306\301\257zJ\335\276\026\342\033\3343F.\212\337m"
+	.ascii	"?\246i\255\317\r\342\356\021$\356\231}\251L\277\354\326f\240"
+	.ascii	"\3750W\337\035(6VF\350-t,\321M@\374\032aR\230L\247\330\037\376"
+	.ascii	"\264F\216\035nCX\314\325\003\256\304\326\324\025\373D\305\236"
+	.ascii	"x\235{\243\261Bl\365\267\007\205\350\361-\243\252\320\177\366"
+	.ascii	"V\252\267\266\214\342\240\267\330*\315Y\274J\325\005QY|\277L"
+	.ascii	"e\2548W]1v\273\323\273\264\371eCubU\274J\321\255\031+\243S,\272"
+	.ascii	"g\252\370o\347\371rw\327v\273P]}a\314\325}$\213qrLm\352N\373"
+	.ascii	"b\214\205K6\262%_\324\355k\234{\334}d\274g^<\214>\221\346I\003"
+	.ascii	"\235a\302\206\r\022*\020\265\315t\240)\271\323M\305$\342\321"
+	.ascii	"\230\0044l\024\f\232\222\304\246d\317\221\361\304\021I\344\001"
+	.ascii	"\311\350x,\242(\3429\032\233\212\032\214\216\216\305d\273TLJ"
+	.ascii	"\"O\260\306/\035\231\220DKG\243$\246\243\244\004\023F\244\342"
+	.ascii	"\n\236\344R\nlt4\"\031%\0257\230H*\372u\021\003#R\021\361h,&"
+	.ascii	"\021\213\222JD\006?\215La\224$.!\221I\342\275\232\361V\003\247"
+	.ascii	"l\332\242\260\024\316\202\007\375[n\fe\221!\257\257\266\352D"
+	.ascii	"~\366\307\210\242I\363\244K\257\251\324\354\006\301\355\301?"
+	.ascii	"\370\342\276V\312$?\037suO0"
+	.string	"\345\222\266\352Z\t\276\006\275\257d\302v+\235(\237\3343[\315Y\030\252}\360\017\320\007\367\345\301=\027\272\344\372xp\337\035\334\255\024\273K\274*\252\035\f\240K\356n\311\247\203\273%\\)\" \222\272\272g\203\223\351vq\243&\260;n{Ry\016\362\205\242\320\027\362\265-`\270g*\261_\317T\023\245\203\037w\021]rt?\\\001\200\250\250a@\304\230B\206dF$\210$Mr\240\002\021\242\253:\021P9\204p\222\324\250\321\030~\007u&\327{.\037\323\261\227\346\237i\373\333;L\241\373\234x\267>,\331\316\240%eC\215\002T\002}\3124)\245\225,z\306a,\235[\016\321\374\005\323+\177P\223\366\305z<\035\251ldt\336\222\b\016\246\370a\351\334\214\257\267\325\260^N$\037&XW\035\266\022v\334\300G\b\025\373\036g\355\265xG\0258\326\262\315\2574\003\002\223\372"
+	.ascii	"\242\023\330\200\302P\336n\033\273\236{\215\301\235\212\246\033"
+	.ascii	"fcEa\025\f\300\t\257\206\335B}\301\265\001a\022\361C\276\301"
+	.ascii	"\200^\213\201\314\205\306L\212\232\256\003q\305\204\343$Kd\341"
+	.ascii	"8F\377\303\226\257\0309\177Q\300\373:\277\333\314\361\366=\242"
+	.ascii	"\272\2071\305\037\022\020\302\213r:\276kDH\007\020\321L\203\004"
+	.ascii	"\027\247K\003\306x^\255\336\230\251\177\034\307\267%\220C9d\177"
+	.ascii	"\224\031\265\2350!\004\335\376\037\365\013m\036\310s<\311\375"
+	.ascii	"\b\340\217\310RD\231!%\347q\326\322\001\342\377\244\031\245\321"
+	.ascii	"^?\343\3554\353R\006\276\337p[M\362\226\302e*\"\222\340\256\366"
+	.ascii	"\373\3540i"
+	.text
+	.section	.gnu.lto_cliAdjustmentRange.part.0.531.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\245\017uD"
+	.ascii	"\032r8\031@@\244N\007\335\246\002q\b\302\022eb\320p\324\347\241"
+	.ascii	"\305\202\346r\245\263\261\200\177P\250%\360\330\233\324r\355"
+	.ascii	"\321\016p\007\342\277\350c\3775\335\257\313\210\240\022\204\210"
+	.ascii	"%\311\322R#\273[J)\005z\001g\001\206\001R\025|4\234'\213IUh\033"
+	.ascii	"\316\263\331%\275E\222iU\016\347\016\357\315\013q\034\303\234"
+	.ascii	"\334b\356\275\346cN\362\216n\303Rqm\016w8\367\030\037\334d:M"
+	.ascii	"\347\265\036'\331\254Y\323d\003\236\0325\274\327D\336k\246$O"
+	.ascii	"\303\261U4>\270\371%\275cb\367\3362m\246\3553\274\327\227\354"
+	.ascii	"v\220i '\323{\357\205c\253\315b'\255}g\307\345Ov\\F\227\316\355"
+	.ascii	"\261\263@\321\351\275\322\247V\231\302\261\325$\277w\235\230"
+	.ascii	"\036/\246G!(\367\226\372h0\\M\322K&\306\356\314M\327_\332\006"
+	.ascii	"\303\325G\367\236\375\345\335+\205\320*+8\266\312\322f\256\255"
+	.ascii	"\036;im\225\271\345\230\331\0073aK\325\256\030\267\314\204M@"
+	.ascii	"n\027\205@K\302\306\034\336{\235\255~Z\267\275\304TJB:2Z\026"
+	.ascii	")\211\222,\362h\\\325\342;S\313\315\216u\365\022\323\330A\257"
+	.ascii	"\225\326:i\315\212#U\351\243*T\334\250\255\227t\304\324\236x"
+	.ascii	"Q\264\225Q'N\024m\342I&\3152\311\"\266\304\221L\016d\021S\342"
+	.ascii	"\307\003fdeml\336{\223ca\2766\035\26120W\035:\206\244\213\305"
+	.ascii	"$%h"
+	.string	"\360\024\215\001)B\341y[\322r\276\374\213\314\"m\320\246#\306V|0]#\250\365\332\205\214y\271#5\223\261\303\275\227\373\307\225\346\246fn&\314\214\306\\\324\"*\274\241\352\373\233=\205\201\334\317\265\375\272\345\364\002\275\275\271\350\034\240\236\323|\260\212\210y\240<zp\205\332\247v\357\275\240\247\367\264\340^k\225]\274\360\206\276\370\236\323)\3764q\323\245\213\231$?<\221\277\275\017H\021,\377hL\240yo\375\377\272\275.u\200_N\210\215\274\237y\212\312\033\372\337\374\372.\226\320\375\376\255\327\305\2708>/A;-^\236\350\217\306\317\324\237\230\230\230\310\177\306\254t\236\300:K)\235%(\235#(\235\235\254s\224\322\031\202\322\031J\351\374\304:?P:;`\235\033(\235\235Xg\006J\347\005D\316\n\224\316\t\210\234\021\0209\037h\032 r.@`@K\273\005\260\316\001Xg"
+	.ascii	"\254s\023\353\314\204t^b*\261\316I\2543\022\353|\204t6Z\026)"
+	.ascii	"\223\316D\254s\222ufYg$\322\371\330h\232\215\253jt.6^\363\367"
+	.ascii	"]\263w]w\243(\032\242YF\357-\222\210x\241\250l\2564\233n\274"
+	.ascii	"n4\335w\335q\272\375\372\316\325\016\2762s\326a\254\342-\223"
+	.ascii	"\252\221\031\323\250\344\315\035\336/\351\323\026c}\020 ?\316"
+	.ascii	"\234\274\316\200\t:\274W\352l\365\310\334\334nz\316V\0072\203"
+	.ascii	"<\367\3367\335\206\373\257\345\304\001\304\002\304\"\203\022"
+	.ascii	"\250\215\205\037\007\376\206\320\211'i\346\226\315\227`QRF&g"
+	.ascii	"\347\005\020w\353\2662\267W\034I\353\366\205\177kG\214\034\221"
+	.ascii	"\033s\b\350\316 \021#F\317\342\275f\034\332\257\221S1\236\310"
+	.ascii	"\004\300\360!s\337\214\031\270\200-m\227\036DL\340l\263\337\372"
+	.ascii	"\324E\271\226\316\033\312^f\260P \330w\371Y\322\325d\371h\274"
+	.ascii	"\366s\r\360m\026\340\273,\356\020\\Y\021\200\246\007\320\364"
+	.ascii	"\035\215C\204+cz\346\026\214\017y\252\205}sB\240\314gz&\301\266"
+	.ascii	"Dea/1\177\351\227wm\206JL?\"\245W\275\372\336\212\224\372\222"
+	.ascii	"IH\237\204\004\b\356\350\231=8\030\242\003\361\257\345\037\375"
+	.ascii	"\322\035[\"\213\240\255V\243\345\033\375\362\216\315\260h)\207"
+	.ascii	",*T\026}\017r)\340\035\330\177!\216D\277>\263\210\021\336P\345"
+	.ascii	"7\301\fU1\231I4b\t\345\033\237\035\265\020!\242g\005\331\360"
+	.ascii	"\240\307\344\267_O\233\375\3447X\324\313\257\331\357h\034\236"
+	.ascii	"Ae\310g>\321\207O\265\220\017Kt\356\336k"
+	.string	"\301p\205\312\234s\247Nn.P\013\302Z[m\350\037\343#\177)mM0\354\020\037\006);c|4V\266\325z\374\316R\007h\374\343/\357\326\344\204\0352\362\325\370>h\020\311\372h}z}\325\213/M]\337\337\f\216\005~}\227\372hH\202V\f\241\177z*\346\226\244\310\265\252\257z\355\r\326\355ar\177\346\024\001\314\"\004\b\023#V\216\320\334Z\320\224A\003\307T\226\215\030S\t\270F\324S\353\271e#\306\024\f\252,'\325\f\003YS\256\205c\353\352\203\026\016\031V[4\262<\304\250\2721\245\003Ik\312*\353j\306Z\3257\246t|\226V\216\227\201\243\352\206\f\253)\0231\254\250\214L\025Uu\203\312\211\243j\312\312I\225\365tF1\371*\207\214,\247\326\325U\226\323\273x\377\214;\374x/\376.\336{\357\022\006o\301~\352n\343xm\021\njcG\260~\342\324\252"
+	.string	"#-\022\275n\"j\006\211\r\232\206}\227\032\241i\036\263)x\202_\360N\357\340!\274\204\237\360\377\354gZ%F)m\246`\rm\231\034\301\270\234Z}j\356\326\311\2236J\361F\277\213\245~\302\t\277{\332\215\221\232\373\322\021^\202\323\265\363#D\275S\212\327\211\t\f#\215\n\214\322}\371\202z\bvQ"
+	.string	"O\017\365\017\b\226\345\301?}\207\241\371\334\323I\215\231\204\313\2250\026\002\306\301=xd\035@;\r\336A\227<\\\2664\310\303\340\235\336\236Y\334\030\360Q\360\013\256L\333\330\024L\243t_\020|\202\317 \307W'xw\310J\353V\205\n\202W\337"
+	.string	"\001E\351\276@9sK\245\265\242\207\260/\320K\351\300OAD;k\376\201OJ\203K4\320\244K2`8\300\3007\241\027\244\002\017\245uS\337\376\354<\211\022\370\002\237t\007\2077\200\300\373 B7(~\260\250\035\rx\325\353\017\214\322\200\017\201E\250qP\004\rBB3\"\n\222$)t\341\005\204(\306\234\331\006\021\020\251B\022\311\224\220$\226Bc~"
+	.ascii	" \321s\226'D\376O9\362\217\264\312\212\270\246R\313\2469\317"
+	.ascii	"RK\322B\251\037Di>\222\027\026\350\237^\364\333q\374T7\037\220"
+	.ascii	"\353\346\235/\316\246\003y\007\277\325\364\032\024s\367\340\315"
+	.ascii	"gS)\210rj~tv\033xJ\365&\206*\222\210\306u\372\030+E\343\303\314"
+	.ascii	"d\216U]\230\347\031bP\177\247\364\t\303Fi\334\267\261tb/\224"
+	.ascii	"\214P^\311\316\fr\2063bG!\315\035\354\226\241\373\\\301\201\353"
+	.ascii	"\241;\220KD\265\320hA\200\370\205,t\f\335]U\252Jr\201D\333\271"
+	.ascii	"$\006\240\033\275\267=\261EF\234\351\271\277\205\351\321\334"
+	.ascii	" \020\373\312\330\273A\024\210\276\tp\021\b|\0337\2457\320\324"
+	.ascii	"Qk\352\204\324\3219U\262\007\310\004\257\205\217\232IH\030\362"
+	.ascii	"\305&\370\227\210\303\232\024\367to\f\304\217\356\3525\377\026"
+	.ascii	"6\223p\034\324->r\222\324B\266a\215\024\032\276f\235\033\241"
+	.ascii	"\342\0363\266\274\273\252\3448\342\347\366\200B\247m\300\367"
+	.ascii	"\362\300\207S\017\377.g\233\007n\315q{f7\fCt\354\224\001\004"
+	.ascii	"#E\246f\211r\300o\024? bv\327@\265#\360%^\005\340\236\205\205"
+	.ascii	"\366\f,\302\216\244\031\241+\325"
+	.ascii	"%\306M\026\r-\201\372\342\370\033E\360@D\006\310\200\030><\244"
+	.ascii	"\327$\224mK\270\314\020\212\b\016\315\004`{dn\2020\f7A\301,\""
+	.ascii	"\340W\256\325\034\302\224\031\207h\332\222\266\264\200\001*\360"
+	.ascii	"\253\375\322}a.\367\"\365\027\272\266\277\005\317\316\232\305"
+	.ascii	"22\245\246v\007\344wK\303\211~(\252\214O\350g\375\276\324\026"
+	.ascii	"\246\302N\240\357\366L2.|\205\317\320\303\374\371}\202[g\345"
+	.ascii	"\023z\340\366\331U\227#\357z\235Y\226\203\030\321]\006\fO\325"
+	.ascii	"\026\250\243\177\243}5\212\3116O\346\f\002D\024\370\323\032\272"
+	.ascii	"\262\314\331\3429H\242\366\232l\361\2107\036Y\214\251^\233\240"
+	.ascii	"\271\316\022\377%\246I\255MY\254P\001"
+	.text
+	.section	.gnu.lto_cliBootloader.part.0.532.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`:\001\375\r"
+	.string	"\006\231[E\020\221\232\016\250\nUt \240\036N\206\257nS\035\204\216`"
+	.string	"S\350\n\f\271(u\220|\354:\241\272Q\216\370\272\216:v\343\266\256!\022P\260\"\233\236\003-\f\030U{Aw\220D\256*\261\266\333\336)\005C"
+	.string	"J"
+	.string	"F"
+	.string	"\224\272\007\347\324~\n\333\237]\372xbA\006\355\022H\312\206\016jlx\220\271\331\335\353t\2328\370)'\320\227b(\374<\351\021\\>\324\020C\".\t|\352\210\354\256\251\0217\275\355\007\266)\330\027\005\033\002\271\370\013\360#\223\357\312\036\004\212\032\233\034\r\250Sk\272\007\34710'VHB\301\251'\314Ii\001uZY\312\217\337_P@\306]\001YJ\373+\316\002\374\013\312\007\354\212d\314\330\035\031\234\372"
+	.ascii	"u\352\361\037\234\007\217Q\021\330\354\252\\\304@\251@Hp\372"
+	.ascii	"i\227d\220\027}\322+\034\240\033)3\224\263\305s\232v\212\354"
+	.ascii	"\217\377'yc\200f7\304\016\035[\202\322p\371\314\037si\337~\213"
+	.ascii	"\317\2279\311\325\314\367\221\211\255\016c\346\352\346\221Tk"
+	.ascii	"d\363`\0328\t\002<\355B\207U\360j\265\240u\0014n\363h\037l\302"
+	.ascii	"\310'\3538\013\331<\331\305m\330\347\312\272\222+\344\303\225"
+	.ascii	"D\353.\257\326\356\252>\355\024Yd\303\3440g\213\355\002*XhF;"
+	.ascii	"Y\f@\036F! p\0022U\253\003s\370W\214\231\r\207\233hp\037\016"
+	.ascii	"%\033\362|\204}\330A\262\002b\242ko\334\240\263\340\313Z\320"
+	.ascii	";\275@\210\361b\344I\331\355\266\332B.\033\244D;\206\324^\336"
+	.ascii	"\222\277\273\264\026\210 \350\003Y\216\276\326\340\001"
+	.text
+	.section	.gnu.lto_cliBatch.part.0.534.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\021\003\275\030"
+	.string	"\206\355\244I\260\226Q:\264\241\035t\f\330\202\337Rb\002\022\033\352}\323\236\231\240z\355\023K5\212\260\247\320\210\0160>9\260\024\330\3460\223\376\262x\003\f\007\201:\r&\307\3374\317\262\376\375\313\214\251_\230\273l\304\022B\344N)\212"
+	.string	"\210"
+	.string	"\223"
+	.string	"TU\265\002%|4N\371\321\300\337\220\037\313\033 ?\332\207\262-d\2179\360\251*y\310\036\263\265\252\366 \227\250d\004\313\324Z_\037\367\367\241\323\224-r\024\227\326\f\371\r\220\310\354NS\006\317"
+	.string	"\210\r\035o\321\236/\307\311O\275\001\322\226\".T\276\034\037\005\370x.\337\021\025\005\370x.\237\021]\361&\211H\357WJL\342\003\341\0242\017\236\316\360\025QZ\3405\255\013\265V\237h\307\355\272m!\266q\330\324I1\242\274\030Q3\006@\3677\362R\207\242\242\254\225\367\036\256\344Q\310\371\370\265u,\350{t)\360\n\352G\226\220\267;\272N\336\232\035\016\207Co\223}\340?\222\324\"I\275#5}\324\377"
+	.string	"\033\226\302\f\360Qk\322\360L\3751R)b\373\276\223O\271\270\224\237\200)\212\320G\222Z\253\213\373A!\333\345\362\322G5y\261M^x\211@\351\201Bg\002\343"
+	.ascii	"\260\332P2\245\366\225|\311\320\231\3008\201Z\233\002G\1772#"
+	.ascii	"\254*\025P;\326\001\001\215\337\024\253\242\335\035i!\240\227"
+	.ascii	":\226\235\005O J\036\213\034\236\020\301\023\300\272\202\262"
+	.ascii	"\312\022\032\355n\006\023\326\r\322\206\376\311\255\220\300\301"
+	.ascii	"*Q\362,\344|\034\327\2372q\202\276\347O\375OWH\254\262\204G\273"
+	.ascii	"\363\336P\302\374x\214\353TuqaTf\342\342\by\02705\226\304\003"
+	.ascii	"\221\273?Q_\374(\227\002\344\0171\315F\337\373\350\333\310\217"
+	.ascii	"\273\255 Hb\262\230\210\350\320{z\345(\311\310\256\223!\234n"
+	.ascii	"\316\351nA+tf\355\3463k\221\213\rp\315V\313\331\314\024\264\240"
+	.ascii	"\031\n\263\226\233\341p:\230\2159\350\304B\350\304ztv`\346)\333"
+	.ascii	"\331pf0G\2341\021\247\314<y0\234\036>\230\022L\rg\017\354\354"
+	.ascii	"95\230\247\354\034a\362\310vd\262\263\202k9\233h\313\335|l\270"
+	.ascii	"\231N\rGk\2316\341\346C{\345n3\334\213\366\003\364\232pc\335"
+	.ascii	"\n\333\317+H\247\373y\271l\323\213u\233h\374\262X\021m\221\367"
+	.ascii	"b\255\265\322\330h\2019\300:K\336y6q\002\300\257\212U; \220\202"
+	.ascii	"\0313\253\003\263\360\372\305\253\226\200\215\237\375\356\214"
+	.ascii	"`\321\364\003\034B\323le\263\2248\002O\223\270vv\025]\247\300"
+	.ascii	"\376\227b5-\243\035\005'\nf<K\2727;\b\263\004\r\314x\201\260"
+	.ascii	"\222`\367\344\315\210t\017*4]\333\035\022\366p\314\337>rc\013"
+	.ascii	"\n\271\214$2\203\244wxi\300k\341\274\275\360\217\335\232!\304"
+	.ascii	"\332m1'5\005\344\373\275mT\321\225\033\0304\307\204\356\004"
+	.text
+	.section	.gnu.lto_cliRateProfile.part.0.552.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`I\001=\016"
+	.string	"\346Y^G\360\2606\035\260\f\350w\270\271\320*A\037LH\024\003\355\274$\272\323\254\305e\213X\227E\357\270S\277\206v\376\365O4\333\363WH\335@\306\331\373\rz\335\n[|\020\3066\363\260|\353\376\232\342\266\264\311\336)\005C"
+	.string	"K"
+	.string	"I"
+	.string	"\247>\220\235z<\b;\315N"
+	.string	";\265\337\3026h\353|L\261*\207\266\316\334\234]a\342\313\007\032\035\273\313\235N\024\017?\345\025\372\250\317"
+	.string	"\"\211\313\001\277<\036\273\353\254\304Mo\273\201m\013\366Y\004+\252b\374\233\027\207\021\336\006E\300J\313~L\324\210\255\034\273\353 ;\255\327\375\030\320\247\261f\37332)\025\265Rp\352)\223\202#\224\235j\226\362#x\030\225\002\343\216PYJ\373/w\021\036F\345\237]V\215\234\335qA\227\361\205n\354\246\316\242!K\211\022\234~\332'\034\344Y|\234\313U\210\023+l\244&JN\027\317\353\332\335\365d\331\037\377_\006@\210vvE\354\330\331\026:C\305[\377\314\245}\277\365\032\037\307\332\rx\033\024W\017c\306@\202`\333\030\\\250\037\244:\202"
+	.ascii	"BA\244\002\251\216\"\200|\220B&\324\221\310\203\220\352\275d"
+	.ascii	"\342\225\224L#\022HL\235\307\335\346\225t\234\2117b\342\272\323"
+	.ascii	"\t\267\201\374e(\235\270\r\337w\342\264O\226=Vf\007\3179]l\003"
+	.ascii	"\220\364\246\201=F! \200\002\2422\336s\370\1771D\t\0267\003\\"
+	.ascii	"c\027\003J\324\303\304\275\275h\002\335\276j\005\347\004\371"
+	.ascii	"\f\220\035L\023:\307V\326*\202\247\313\272\326[\033\233\030x"
+	.ascii	"\204&\027q\350\304\035^\0300X\b\265W7J\242\337e\306"
+	.text
+	.section	.gnu.lto_cliDumpRateProfile.part.0.553.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`b\002\r\024"
+	.string	"\266%\204J\260\324Q:\370\306%\203qb\252\304}^u)\300\232\3533t\212*\315\223\n\210\035V\nR\324\f\337"
+	.string	"\r\"\233e$\376\371V\317\227\325_P\347C\b\205\027\357\326-\3101\007\037\0224\037\030Q+\243\316Dv\223\275S\nf"
+	.string	"m"
+	.string	"o"
+	.ascii	"&\2140\230\363e\356K=)\345\202\350yN\373J\2271~\251\347\004v"
+	.ascii	"\211z\374v\313\006\257V\021_]\036e\365*\276\300\352\325~\222"
+	.ascii	"\355"
+	.string	"\234M\365\362h{\036m*\272\277-\261\032\352\260s\"\262\273\257W\252\342\343\351\fG\177\362\204\310\323\373>yBC\237&\017I`v\327b\210\273\336\266\003\3335\366\204\021\177\372k8\035\276\374)\311\364|\323\177\026\002 \0051v\203\202E\366D\225b\361\250\333\257\221\363}.\211\312\035\ng\027Y.\331\363m\374\306x(\\k\201\373\017\272!\022U\273\275\005\257\206P\305*q\235\177\312\225+T\235>c<\215\235\260\265\033R$\275\210\257\2560\234or\213K\356L</7(\234v\213\313x&\036\323\335:\232\225\327\377\356\2339\231\332\335\363l\032\013.\035%}\032\322\023\244\021AvGL\346\177\337q\341\300\324\256\356<\f\242nf\345\225R\033\026\013`\344\002\310\201\222\0260\355\f\264y\236\253\007\243\026\300\037JzR\037\307\245l\374\025\256\331\346y\257\276m\365z\236\220\323I\357;"
+	.string	" H\"\202\273#>38i\221i\030\356\356\232\022\331\001\226%p\345\f\360o:2,\033\034,&\247\266#\0235\314d8\021f7\264\032\333\215\302L\007vk\315j\260\t\262Z\214\3041\026\332M\354\205C\203\325^\261\033\356\305\202b[\316\354\366\322\261\331n\257\022\333\3630>\364\307\224\322\"\333\270p\027\305\203G\375UL3\350\3616+\037\254\037@9^\f10_\216*m\335:V\022b\224\200;J:e\206\364\277\363\250\240\"#\0062 \220\002\222+\353\214\240Cq\223\2757x\314\355d\204\306\f%\223f4\020\300rI1\\\303\300\305\244\016\330\236\274\376Ns$\352]\201\317\330\253"
+	.string	"&o\216\030\367Am\b\266\333k\016\210a\260\261\311\264#R\202\333\273\274M\337,]\016\024\260\377\226\364\227\3053\252\333"
+	.ascii	"#\221\033$\275\303\273\001\223\205\340\366\312Xb\265\363\204"
+	.ascii	">\006"
+	.text
+	.section	.gnu.lto_cliProfile.part.0.554.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`D\001\035\016"
+	.string	"\226Y]G\360\2226\035\360Frw|\362\t\307\352\351\003\376\bP\247\006b\006\026YW\002\230\272$\352\300\321\032d\032\212\340\311xE`{\364uV.VEfT\355\363\035N~@O>3:F\316]57di\223\275S\nB"
+	.string	"K"
+	.string	"H"
+	.ascii	"\325\b\262W\227\357`\257\331\t`\257\366a\330"
+	.string	"\016m\232\227,ve\321\246\241;\263$6\222\"\\|\354n\367JW\\<\235\227\350\247N\003\214'>\007\374\332|v\327\031\212\273\336\266\003\333\025\354\277\b\253\025?f\306i\210\207\031\021`\202\262\234\024/c\013\036\273\373 {\335\256\373+\241\357b\315\366[XH\266\024\271\340\325\224\205d\207'{\325<\347\313\360*%\005\3125\261\362\234\366c\\\206x\225\222svY\255\231\335\222\301\003\036\035\273\252\237t\310T\020\024\274\236\332\"\037\346O\374\326'IBE\217\034*\232\2324\305\364\272vwMY\366\313\377\327\201\021\\\315n\211\0375\213Ro\270\270\314\337\362i\337\227\371\213\337\262\026\023\036f\304[\210r\307\336PJ\300q\r4l\241\321\006\212 \272\200!\303h\003I\020\205F\026(\030\370n\n\371@L'\322\204\322\311\333\330\343>\020\257\013\371H\247\316C\211t\\\307 \007\023\252\363"
+	.ascii	"\202\250N;e\371cBA\230R\232b\033\300\2347\016\3545n\003\f! \200"
+	.ascii	"\002\2422\336s\370\1771D\t\0267\003\\c\027\003J\324\303\304\275"
+	.ascii	"\275h\002\335\276j\005\347\004\371\f\220\035L\023:\307V\326*"
+	.ascii	"\202\247\313\272\326[\033\233\030x\204&\027q\350\304\035^\030"
+	.ascii	"0X\b\265W7J\242\337e\306"
+	.text
+	.section	.gnu.lto_cliDumpPidProfile.part.0.556.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`Y\002\335\023"
+	.string	"\226%\203J\300\322Q:\343\210\377\261\005XPt\\\302\360\233\367\241%\002\231\177J\003\226+\031\342uP\272A\007a\001\032D\266\003\246^\375)\335@\355%t\210\bN\274BA"
+	.string	"O\030\255E\275\322\215Z\262\322\241\336\0208\354&{\247\024f"
+	.string	"m"
+	.string	"n"
+	.ascii	"(\2124"
+	.string	"\230\363%\356E;*\345\222\330yN\3730\036C|\321\316\t\354\006\361\360\355\226\016^\255 |u\371\024\325k\370\002\252W\373/l\343\354\247\227,vg\321~\242\353\333\023*^\223\016)jw[\257t\305\305\323\t\212\376$y\343\351{\237$\257\304\347\311\301\021\230\335uh\342\256\267\r\3016\215=\211\002O\372+8\r\276\374\351\310\364\374\321\377\222\004>/=v\177\246\212l\212\312\344\342K\267O\003\347\367\274Z\302]\351f\326X\356\270\363k\334\206x\245\233\311\376\366\"r<\"P\273;\006\257\226\340#Y\271\316'\341\312\345U\244\313\020?#\0074\331\017@D\021\302W\026\b\316\037\271\305\005w#\235\227\373\003N\273\305E\274\221\216\351n\271\013+\257\367\275\207\001\305iwO\332\0314\260rt\364)HQ\206~t\350\244N\346}\317As\300i7wrC\230\223Yy\245\324v\275\002"
+	.string	"\371\370\201\240\243\005L\273\203l\236t\r\001\324\364\353\241\243'\365o\234\251\306o\341\031m\236|\365i\252\327\223AN'}\357"
+	.string	"\234\206F"
+	.string	"\321I\361\314\251I\205LApw\3274\310\016\206-`\255|\033\316L\215\244\346\346\212\251\315r`\241\207\030\354fB\314F\306\201f\223\201\311j\003b3W\005\330\3545\342\027\213\314\346\325\272\221\271f\255\227\355\326bI1\255\026\263\265ph4[ke{\036\206\207\366\230R*d\373\006\356\252x\371\322\017e4\247,\276F\365\243\344\310G*J\210\201\371\240\322\360\306\241\242\0203\344\247\243\243U&H\357\373\016\013\bf\3021 \240\002\022+\353`.N\230\367\006\207\271\235\214\320\230\241d\322\214\004\002X.)\2065\006\bwj\213\355\311\353\3574G\242\336\025\370\024{\t"
+	.string	"\362\356\2101\035\324\206`\273\215\346\2400\2146\230`;\"%\270\275\313\333t\315\362\345\240"
+	.ascii	"\373oI}Y\034\243\272\fP\022\371 \211;\274\033pZ\bn\257\214%`"
+	.ascii	";O\240c"
+	.text
+	.section	.gnu.lto_cliRxBind.part.0.575.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\322"
+	.string	"\215\013"
+	.string	"\266TLB \211j:\b$\001\037\037\250\323\007t\261\343{\300W\363\0017\202\360b\267DX?8\200\034\352\2541\206\031\200\301\001C[\243d\002\264#"
+	.string	"\033 dy5\035l\220d\3202\304\tb\304M\366N)6"
+	.string	"9"
+	.string	":"
+	.string	"&\331\263\227\t\366d\321\236QJ;fL\220\005xe\330\335\356\225\"\270x:5\321'Q\343\351_\237$\212\300'\3045\t\307\356z+p\327\333\326\260\335a\337#\256\226\2502\032\250x5m\211d\026\333+\3479_\222\316\032Q\312\035p\362\234\366\031\274\201x\326\350\017\273)X\204\335\362\342\325\022\333\253\313O\"\257\333#\"\257\366\027\330\001\020>&,\354\232N~6\023\006\305\353\251\035\002\231'}\330\252B\254D\307IU\246\232\2664e\277\374\257\315\013\033\024v\005l\320\260\007\252\004\005w\335\276\003\222\3772g\373\001\266d>P\bz<\241O\005\004^\034\276\216f\363q0\227\f\307\223\330\263h6^\327\321`8\235\027~:\313\304\240\347\013;\020\b\206\035wmi\312\334\nC,\204\002\240Te{\233\177\360\032"
+	.string	"+\341\337cp-\\\325\212\206\013\261X\021\r\310\003#\\\207\247X6\352\266\"!\023\214u\301>P\r\256\030\202\b\215\273H0\235\263\017\203\205\235+"
+	.ascii	"'\236\313\350\230w^[\306"
+	.text
+	.section	.gnu.lto_cliAux.part.0.576.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`*\020\265J"
+	.string	"\252|\274\033B@\236R\007\353\277?0\262\214nj\234\214\201\334\357|Zg"
+	.string	"\007\275:\360\304\261@\b\211\311pF"
+	.ascii	"x\375\234v\037\030\030\200\202\362\352*\214\023XR\367\034x]\324"
+	.ascii	"\222\025\374\241\263\032\331{K\231R\235\001\222\001\261\001q"
+	.ascii	"\206{\337](\326\271\303Z\356\177\346\321\270\303\216\343\361"
+	.ascii	"\374\351\213\336\336\033\306\321\372\327\361\360\007\363d\376"
+	.ascii	"\316a3e\312x\236\022ho4\262;\013\305w\355x\270\262\213\272\303"
+	.ascii	"\236{\3570/&\3761\236\367[l\277\217\301*\220\301\275w\205\342"
+	.ascii	"\273\312\366\221\357\177\361\262#?y\331Q\264\001\367\207\245"
+	.ascii	"U\203\f\356M}z\327\243\212\357\302\256\363\323\315\351\320s:"
+	.ascii	"\256\rr~*\217\227\333\241D\335bO\317\331\375\265\374\226\370"
+	.ascii	"\345v\274\321\336i`\356\366\246:x\327\021\024\337u\352'\337w"
+	.ascii	"\213\217|\337u\1778w\347\341^\347\251j\373\351\261{\035%\257"
+	.ascii	"\275\025U\375\361Ug\270\367^\276\253\237|\374IH\311#\344\321"
+	.ascii	"\250\210hH(\b6\002\025\211\257\333\352\254\024\373\0039\303\266"
+	.ascii	">\t\351\356\231\320\304\334>y\324*\327\370}=\340\223\255-\220"
+	.ascii	"v\206}\351s-#\217Q\3513J6\"f@\023c\373\242\226\001\340\023J\233"
+	.ascii	"\374s2G-\023\235\375\320\231\364i\226\205\004\237\t\360y\266"
+	.ascii	"$\007\225=\3346\3759\231\003\300\214\257\310K\237J\262\261\214"
+	.ascii	"I\372L\222\201\230\320\304\310\276\250\334"
+	.string	"{\277\3649\226\211\017\370$\373\312ov\206\035y\267E\222\331\005\016\2055\333\006\201T\222\300a^\271m\007\260\351\263\362l>\017\tk\266\006\312\232\214y\276\256\254\333$X\233\363\001\237m-\203A<=\177\367\031H\030W\316\307W\"f\330{\3733\261\274/\275\373K\335\235\210\373\320^\237\365\362}\323\031\276B\263\270\302\357{\302\253\267\313\033g\216\277S\342\025\254`\347\007M\370\257\275\353'R\344w\246\320\337\367*\304\314\374\336\220\2109\302\314Y\327\237\253^`R\264\206:\362=\357\325Z\317\361\331\241\263ve>~\314\257\335W\260\310\357\324Z\331\245\267\034\302\277\316\232\b\235V\233U\270r6k\250k%\235\315f\263\256\323\334\237\372\037e\314.\001\316\036\241\230\035BP\366\007\306\354K8;\2241\273\003c\366\006\306\354Opv\006\306\354\013\214\331\025\030\263;\301\331\023\020eo2fG"
+	.string	"g?P\314n (;\023\234]\tg/"
+	.string	"g'\020\224}"
+	.string	"\234]@"
+	.string	"cv"
+	.string	"KJp\366$8;\222P\366\344\021\3628\224\335\b\316^\004g'\202\263\017\te\027\n\202\203\262\033\341\354@\017\370^4f'\276\335\373\353\022\263\267o\346]\377\227\367\374t\377O\242\335\003#2\333\033,\353g3q\317\270\275\231\177\273\377/\377k\376\365\376\001\377\003_N\025\016\257rr"
+	.string	"\216_\265{\214\252&F\204b\001\023g\270\273\250OZ~\245}x1\241N\\s\232\204\206{S\227\357\002\271\277\277\033\301\300\f\\><T\327H\361{\253?\033\207\001\377\254\376\254\302\f\253PL\244\311\373>\255\267\372Rm\357\235\346\361\374\367\236\317\3415j\256\324\\\211\371U\313F\350y\204\t<\276\232\345\317\b\023\342\257f)\267\250\033\f\206N\337\004\317h\036,\205^\210\027DOQ\373Y\257R?\032\035\234\256\314G\351\216E\013\261D\005\b\350\002\004\354L\307\006@\311g}\205fKZ\253"
+	.string	"= +\361 @\277\224h\235!\r\305~"
+	.string	"\355\316\365\341\001\020\340\350\317\355m\317/i"
+	.ascii	"JK\372\005\377\210u\263\"\244$\210T\322y\317mJ"
+	.string	"P\022\222NB\n\304\216%\243\371H\314Fd\366I1R\004\351\025'\350$\004\234\346y\203\251\336\344\221Nj$h\334\025y\2443\326\315\210\021\251]f\337\223#R\277\333SA~\353\357\305S\212F\032\246\022[\311\357<je3\013\231J\272\307o9H<\025\232\263\372q\2018\215\264\321\r\\\326\tT\244_\357\363\326\023\351\"\375M\263\327{\"\375f\321\276\351\330\020\\\366\221EdZ\347\344\257?\271\371N\302 =\244\221\352\340\256_\207n\350clLQC]\350\251^!\375R:k\220\026\322Dup\325\257C&\034\2443\266\r\317\340s\312\021\242\206\346yX\273L+\033\027\326\317\367\307\275\266\253_\227\336z5\024\351&\213\240Q\273\307Z\362\216\345\210L\353\232Y\334\336\233B\266\304\273\364\247\207k\032\367\347\017\257\3108\t\201\264Q\377\327\241\273\206\357\263\241\270w\027\005\177>4:"
+	.ascii	"\351/\213\346a\2670svK\257O\\\253\267\250\3359kT@&j\367\017 "
+	.ascii	"\362;\213G\177mh>\373j\242"
+	.string	"\366\3745v\314\356\253\237\315\037\261mx\372\377\355J\222\267v\307\353j\227\311\227\245\213\263\224\263v\0271\"\277\323\325y\257M\213\237\007\216\242\003\207\020\037^\327jR\346\320\222Z\362\030PYT.\254\252XLa-\247^,\345\260j\241\247\244\252\264\r\032ZV\033l\320\240\252\322\202\201\245\301\205\214\031R7\2162~\206\324\r\215e\243\206\246\242!c\006U\225T\b\027USD\237\202\2221cjIC\206T\325r\n+k\t\225t\253\032TXK\033VVXK\370u\232\003I\317\374\230\232\313\365\267{\357\235\244\241O\347\237\376\3612_\217l\324V\261\371B\234\336\215\342\212\275\356\336\b\216\224\314\357\353\325\370\f\336!e\265{\243a\030\234\313Y\267\220\021\350&\275@;\320K-Ak\375\326\254\027\377 \240\266w\363\2351\220b3\313)\026\022\203\265[\211\336\362\bZB^Y\004\r\365"
+	.ascii	"\302\231\353 \336\335\003M\"z\b\245\227e\262\334\271k!\031;("
+	.ascii	"\215\"z\210\335\302\254\373\006\332A\356\362O\272\001\003\375"
+	.ascii	"\024\226\305\2041\004\363\205\301\224\330\245@/h\232-9i\005Z"
+	.ascii	"[\233\322\004\332I?\221L\227\345\364f.\236\0021\257"
+	.string	"\\\250\t\364\233E\263\330-m\230h\211k\322(\326\272L\017h\004\232\b\225\253\306Fr\2268\313\001\275\204\022\225\231\310b%\371\235\006\264\362-\226s\305\332\244]\261\302\244I\254u\301n\201\220\335\343\263\270\311\303q\303\343\3075%\t\225\213\336\327\274O\337B\343'\371\235\236\303\270]\375\232z+\214\027\222\300\243\027\216.\216\221+o62Gy\267*mlz\f\355\376$\231\036]\227\360JE\377\003VaN\215\344^(\261\234;w]S{\322#\232\307\260\360c\2667-fs\347\256jN\320\002\201L\250q8\345\220R\246fDD\222$)t\261\005\204(\345$\273\r\021\0201T\320\310\214\220\024\326\310\260gu\232\344\340\377K4\337\347p\027h\361\261L\201b\245\026;R\277r\264\270Ny\242\227\201\315\377\177\212M\375*\350\004]\352\306*C\213\327\327D\213h\223\324\374\376||,"
+	.ascii	"F\277\331\340\372\032\251\017X\242\2220\b\305\003\350\274\224"
+	.ascii	"L\222N\206\310o\265\217:T\361\243\377$\331u\254v\251\206\321"
+	.ascii	"\271\220\337\332\251%\"\"T^\372\355\243M\246H9\232\370'\332\036"
+	.ascii	"Eu>\361/\256\244\302\251\217\r@\213w\0227pB\003r\020\244\330"
+	.ascii	"\216\315\265\277\206\\\264\337hV\213\315\214cN\355~w\276\021"
+	.ascii	"\350\225\357$\364\3042\217\375\\sy"
+	.string	"Y\204\253\310\353\237\333\037\257T\226\202E1XOm\031\201\236\227i\270\353\007\033<\345\327\366\341\026\321\236\204\207\356\267\220w/\322\030F\321\3121\322VX\035\257[\354\255\310#hShtC3y\031\267\316\0164\322\303UN\0024{S'\254\001G\307\314\207(f35c\312]\300N\242\002'O\t\200\326\372Rki\350\253J\002`GQ\222"
+	.ascii	"Y\t"
+	.string	"\304\022o\bWnH\253\223\020\265E\270\002\\\032\305}`>\232\021p\n.\306\033\003Q\342\"d\004\2311\245\017;\221\250\326\334\346\207\325\"\032\033'\324\031\216\214\276<s\243O\232\216\264\034\022gOx\233\234e\341\204*5\330:!\026\204$\220\332\r\265\\\020\351\201Z\344\266\232\301\n\177\020\355\357M*\344@;\367\367u\250O\320\337\274\fpAf\f\033\321\372\343gD\203\231\272\355\221\233\260 \242\205\036C9])\n\233f\n\220\340Ol\016\373ZQV\3112\357-\267`b\226b.\347\337\023n\205M\235\326\302W`\f/\262\241\256\371Hfc\022\270\\\240\231\361CA`\033v\244\370\005\224\301\307y \324j\227\375/\363G\336\342@\236\332\363\310\317\233\275b5\272X\216\374\304\222']\005\200\360j\237\362&\022\264\202\n&{\255]=lba\321\30542T\272wr\004\n%)"
+	.ascii	"I\255\355w\005\253\247\326\013\311\334=\025\314\272\312:{\352"
+	.ascii	"\246\315\277J\233\262.\241\002"
+	.text
+	.section	.gnu.lto_tryPrepareSave.part.0.577.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\032\0015\016"
+	.string	"\206\232aG\340\2626\035\240\237\355\303\324\321\242\305\265Cy\263U\231\244chz\366\330\315\025\367#\036\005C\261\020\027\241\354IRI\316:Sl:5\242H\307\024\245\3329T\204!\245\3011\246\320E\037/B\332\321\247M\344N)I"
+	.string	"I"
+	.string	"N"
+	.string	"\237\332\003d\237\366Q\330\344\344\344\360#\216je\333&'(\207#1\242\216\254\246\004\007\027\217\335\261\373T\022\017\257\022\013}\231\242\021\257w]AOJFO\215\0264\037.C\216}Pv\327\032\210{\336v\002\333!\373\033<\267\317s\362]\336l\177\347:\2419q\\\325\n\345\357x\373\364uBlC\254\210\203\344D\313F\212\002\2376\240Y\345\307\323s^F\306\365\260\262J\373*\276\002\365\234\227\203\354\262^/v\307\003\237&\321>=^$\013;T6\257\325\021\336\244M\201$`\246\225c\006\214\212\326\344Y\374\205\241\303\331\225y\n\324d\020\200>\257\266\213\006\371\224\357:\310\213F\214\355q#FE\2517V\354\330*\313\266\264\374\370?S\251q\001\300fW\365\303\307\212\2300L<\006y\021RD n\305["
+	.string	"\201\023\205\034\204B\036'\201\201\n\347\211R\274\006\017\006\200\340\350\373\\\300\317\210\304\2622\201\364}\374\225\264T\370:\013-,\244\3563\201]\211\210K\027F\246.C\251d\352\266c\253\254\020\351\207\231\324\016j\224\r\n\243zc\233\300L+\030"
+	.string	"\357b\364\204\243\244h$\2064|\200\267@\242\226\n\033\220\007F\270b"
+	.ascii	"o\342\321\2432L\264R\021Z\341\340#U\036V\220`:g\237\335\271\220"
+	.ascii	":\327S\n\013\233M=\241\214\001"
+	.text
+	.section	.gnu.lto_cliSave.part.0.578.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`\363"
+	.string	"\305\013"
+	.string	"F\324KB kj:\240\202P\nf\002\262\216\264\231\270\\+\352a\t\324\307\255\006\352\312\013\262\200\030\2541\206\345\367F\261C\227\261P\021\200A"
+	.string	"\b\001]\017\373\307\360\303\2209\234\271\226\247\246\352O\233\354\235R6"
+	.string	"6"
+	.string	":"
+	.string	"\226\275<\255\003\213\266\214.lI[\204\r\f\\\036v\267{\245\023.\236NM\364\357:\0049\032O#F\017>)\256E\002\354\2569\bw\275m\020\333"
+	.string	"\354s\002\317p\227%-V\207\262:\035:\270\257>/=\030#\211\343\325s\332\307p\225\370\322\363\211\335\322\013\266[z\274Z\203{u\371\311\366\312\275b{\225\274>e\373\343\033:\tr\241\217\215W;4 \201\262\020[@Go\323F\300\231'm!BU\210\201\3508\251\311T\273\266\264d\327\f2d\266\333\340\303l%T\016\024\276\372[\267\177\341\343\276d\276\004\225M\304\222\3710\026\260\"`"
+	.ascii	"\350E\354Q>\214\327e\276\n\330y\232MG\2318,`\321t\007\302P\323"
+	.ascii	"\315kKK\276\b\245\212)\240 JM\366%%\231\327\360\027\201\213\323"
+	.ascii	"\006  \300\002\242#\035Sx\2471z\033\371O\002\263p6I_6$\332\334"
+	.ascii	"\260\264\030y7\302\022\243\214\304`\r:\2103\334\231\325p\205"
+	.ascii	"\017\302\023\207\275\256\366\276k\225\202\270\252P~\200\300{"
+	.ascii	"\261v\n\242\337%\306"
+	.text
+	.section	.gnu.lto_cliDefaults.part.0.579.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`e\001\305\016"
+	.string	"\346ZaF\360\2208\035xC\262\201Y\226Y\3449\314\200\231\216e -\334?\363\217\\\273O<n\026z\254+g8\b1\033\316\023\r\r*\"\337z\023\331M\260\302\307{\214*\231c\234\t\361~O\316\205\373\323&[\246\024J"
+	.string	"N"
+	.string	"L"
+	.ascii	"_a{d\327\\|\331\025\203v\215\334qY2\020/\r*\327\356n\237\322"
+	.ascii	"\304\301"
+	.string	"cR'\350w\234\302cj:y\270\304\022\264b\334\bp*a\035\225\023\246\257\256\034N$U\002\237\033\221\335\265\366\341\316n[\202\355\007\366\307\033\026\245D\003\230\324\030\343r\240}^\306\234O\203\204\200wa\202m\210\rmx\300\244X1\256]Q\301\247\027hV\2758z\352\304\200\270\035V\254j\237\305[\200O\235|\300n\013\214qWd\360i\017\355\323\342;\331\247\366\002\331\247\03525J\372\362F/m\021\006\275I\345WW\025)\250\031\254\222\fU\272X\316c+[l\251\326\213\377\265\b\"^\002F\354\252\344\300\261$\246\f\024\247\371g\256\366\355\277\030\3714_\231c\203\204\214>\243*A\020\262\214\230\252D\006\037PG2\342q\033Q\205\216\002\350\203\360\311\340\021q>\236g\302\210\307m\314}t$\334\006\352<\336\306\205D\333G\307\237\205Oh\273\360}\241\215s\021\024I\302:"
+	.ascii	"\250V\207\332\336\2477\371@\n\212\006\213$C\313\377\345\325\032"
+	.ascii	"\245t\261m\222\251|\212! P\202Al\270\003?1^\n\346a\306a\021\002"
+	.ascii	"\261CW\025\301\335b\033\260\362\352?\274\023\3650c\270z2v8\360"
+	.ascii	"\324\264.\027\303KR\310b3\263k\345\237H\302X+\2009\004\246s}"
+	.ascii	"x]\340^A\260\274\306\3254\215{\227\032\003"
+	.text
+	.section	.gnu.lto_cliProcess.part.0.582.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`l\001}\016"
+	.string	"6\034aD"
+	.string	"\221(\035{\0264J6\254o^s2\374>\226>\003\266P\232\323y\247\260\367\025\2200@*X}T\257%\360K\3775)\341\321\347^\265\376\236e\364\024\025\205W\355\275\341\223\3329\377m\357-eJ\001N"
+	.string	"M"
+	.string	"K"
+	.string	"\357\\v\305${\346\300i=lV.T`l\354nv\250$\374\222t\3704#\311\337J\207osJ\231\350\330No$\006\2139\367\374\260\231\362\245\266R]\317\235S\203\205ri\233\352Y\340qC\262\273\346\200\2707\267\r\262\255\300\376\213\357\245\365\255;5\375"
+	.string	"\b^\fR\354\246jp\254\b\030s\342\255\337\276\277\342*\374\027wZ\016\021\031\275;\361G\251\333\324\212CDH\357N\006\254\314\nP\271V3`\273\335\202C'\340\034\332\347\356s#\273\3239<\313\366\310\236\t\266I\205\274\226\372\221\242%\3730g\321\301/\341\017(\257\035\372\240xx\375\313\037\214x\321\334\b\201\2225\326\253\013\306iSm\261\r \355\220\206\274\346s\367@\311\340dLZJm\261\306\217\270\304`V\026;\246\243\246!L\007\236\333\003\362\261\340\3110|J.d\036\321\206\f\304\303\241\f&\242\214C($\312:\266\363\312b\223\240\250\tB\210Q\033\320H\311\230\r$T;\202\204\274\026[@=w\007\246\027\r\212\267\273\373\b\344S{B\211\352\323\247\252R`\241b\250\344\350\310k\036"
+	.ascii	"\357\302\335<]c)\374yPt\320\262V\003|\331\300\021d\221\243\031"
+	.ascii	"\016+8%t\314Am\253`@>\3202\264\326\264\302*\237\270\20032\263"
+	.ascii	"\305\242\304\005\241;\003\004\267\301\355oQd$5p\315\373\257-"
+	.ascii	"c"
+	.text
+	.section	.gnu.lto_.symbol_nodes.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`AE\235\350"
+	.ascii	"\372\231\301SZ`H\245J:\253Px\356\314\264\245O\006fJ\1771\324"
+	.ascii	"\032\307H\233\024d\351\273\212\3637\261\326d\324\373\341[\215"
+	.ascii	"w\305\005\211\350n\356\005(\242\232k\355\201\365'{\2216\374E"
+	.ascii	"\332\360\02736\236Q\3215&\266\345\373\317\2357\311:\255\330\326"
+	.ascii	"6x\242\277\240Z\315\246\235d5\005\037\005$\005\013\334\243)\220"
+	.ascii	"9b\314],\357\320\025\200\373\250+\276\262\256\344P\325\025\235"
+	.ascii	"`]\031{T\332\204G\245NvT\3326U\351\023\035\225B\311Qi\024\034"
+	.ascii	"\225J\221\252\024.\252\322\270\033\225\316AU*g\243\322)5*\245"
+	.ascii	"B\243\322*O\225\322\315\250\264NF\275\317\251\256T\305\250\217"
+	.ascii	"\203QO\345E\375\224\246\3729\027\365r-\352\2410\325\233,\352"
+	.ascii	"\317\200\365F~\365G\226\352\311\310z1\245\372\"I\365CV\324\177"
+	.ascii	"!\325w\251\250\317:\252\027\222\242^\313\250~\253\250\236\213"
+	.ascii	"\250>\305P\245GP\324#\235\250\007\"T\217e\242\336*\250\376\007"
+	.ascii	"P\275\360\247~\251D\375\217D=\320\247\236\305\210\372\026=\365"
+	.ascii	".D\3247\205\250\177\301S\017\003D}\214\017\365N;\3652\306\372"
+	.ascii	"\031:\365Ob=\215\234\372\032+\276z\033u\365&\350\352\207\252"
+	.ascii	"\324\237\240R\217bJ\375\210\271z\022r\225\236q\225\242\301U\232"
+	.ascii	"&\245R%o\225\236\271U\252\026\245\3225(\225.yR\351\260\255R6"
+	.ascii	"'\365<\232\324\3271\251\247c\253G\033\326\277-\251\227\262V\017"
+	.ascii	"\246V\257BI}\231V/\205V/t\326\3438\253\337a\326W1\253\357)\253"
+	.ascii	"\357\221\244>\210\244\236\352H\375\n#\225\212\221U:V\244>\304"
+	.ascii	"X\275\b\261\372'a\365f`\365H\210\324\353\370\252\207\032R\177"
+	.ascii	"\303\253\236\354\252\007\342\252W\332\252O\322\252'\312\252/"
+	.ascii	"!\244\336'H\245d@*5\202Ui\221\253J\303\374\363\037\225\202\331"
+	.ascii	"\352 \252\376A\370\235\235\217\217\273\362:M\352\212h31\020\252"
+	.ascii	"J\211\\\025\311=X\351\027\355q\221\007}\333\341#S\324m\247\303"
+	.ascii	"F\236\343<8(\223\235T\245VQF\262\273Qi\025T\2456*\355\221\241"
+	.ascii	"F]\361q\032\225\362x\252t\307\214J}d\324\225\240S\245L1*]\001"
+	.ascii	"\243\322-\372\242R-j\344mG\356\004\311\233\230\235I\331\335l"
+	.ascii	"\236\355\354\3037}\311\3715\243]-\355Jv.\236\266S\362(\273\026"
+	.ascii	"\225f1U\212\304\342\347\256\307\216\334\201\225\262\370\257R"
+	.ascii	"\245\245J\223\314.\245\032'+uA\225*\375%=,C\215%\"_Q)\r\032v"
+	.ascii	"\"H\225\242Pq\257\235\006>C\254~Ti"
+	.string	"\215\024\225>\031=\310\216IPO\220\027Uj\203\250\322\250\241\272\002C\304\321I\036E\245\302%?Q)\225P\245P&*\225\n\252+.\350\201*\275A\305~\265\373\251TH\t\223\221\275j\227A\223\247\340IT\332\343\363\250\335\356R\037\227o\027C\235\261\352\231l#E\253\307GT\032D\273\336\314V\274\247\322\0346\027QB\027Q\351\322CXlW\376gw\200$7\022\347\251\364\bD\245X\377P\315\366\235\033}|\321\356:\325ubu\225\347T\032\254\2606u\343\276J\273h]\245>J\367\243\035\320Km\216V\251~b\001\370D\214R\251\364\2127\245\322\037s\225\006\241\216\242\246\0345\213\243ep4\311N\nE\262{\253\024\210\221[\3650J\245:\240\324\025\024\364I])\333*urRW\254(\215W\034\033mR\351\020&\225\312\240].\262\233\201#BB\331*\0251\254TH"
+	.ascii	"B5\036\272\244R\0232\250\220\320\265JGx\354cNT\255\322\026T\211"
+	.ascii	"\307\322*\005v\275\2050\242h\225\236\240g\245Di5\212\270\350"
+	.ascii	"Y\245C->\365#\211\032\0205+-A\315\236c\367\344\303\fZV)\t\246"
+	.ascii	"\007\025\300\207\006\016\232\244R#\336\210\036!(\222J\213\264"
+	.ascii	">\244\321#\225\2460R\035\205\254\032\255H\365I\307\002\260\333"
+	.ascii	"]\217TT\214r\355L:H\230\205\360h\0209\024&(X\245^2\016\207\203"
+	.ascii	"H]1Aw7\002n\272\217\335\356f\370\252+@C*UQ\344U\255V\324U\275"
+	.ascii	"\204\253\372l\253R\035\255JcdU\n\203\356.\025\177r\b\2516\205"
+	.ascii	"\202\324\025* u\245\007V]i\272\252+-~\324\025\241\fVu%DU\245"
+	.ascii	"\242\260\232\n\317G\365\224\fe]\341\341QU\232\001G\260\256|("
+	.ascii	"\352Q\335\204G\245\343\216Jw\350T\2458h\221\216j'9\214\205\243"
+	.ascii	"\232\311r\345\240Z\243R\325etw3D\325\225\035z\243\322\027P\336"
+	.ascii	"\332\331\250\206\253\341,\032\326zz\222\335\356F\200\316x\331"
+	.ascii	"NF\265\024'\377\330\305\250t\006\205Q\355vU\351\017}Q)\020\225"
+	.ascii	"\243M\325t.\334\265kQ=\307d\256\035\213j\271\027*$j\024X)\351"
+	.ascii	"\246!&x\350\257R\036\006\230dMt\251R\020\244\211(\371k\367\272"
+	.ascii	"\272\272:\232T\351\324\212j%H\325fTEu\222#_\355RT\257Q.)\363"
+	.ascii	"T\247\031UZ\322\"\017\331}\327c\220\022\331k7Ti\016\024\2256"
+	.ascii	"\235\2504D\033\025\252~\323\240\305\034\025j\242\032\n\335]\236"
+	.ascii	"O\024\177p\354\326]\255\037\257\370|>\037\r\252n\243\273\013"
+	.ascii	"\201\016\002\035|\265\"$\232\\\267n\377\240f\263\326\355\026"
+	.ascii	"\243\274\003\bs\033\205m\241\334%\333M\356p\331\336\001m\207"
+	.ascii	".;\334\341\332.\331\254%\327\260kA\330\230\216lv\355<\321\264"
+	.ascii	"\207HMh\263v\355<\362i\267k\347\2256\273&\267j\377@\3558j\267"
+	.ascii	"\351\255\2122\212\321\200\262\203Ur\223~\216+\264\257\325Z%\357"
+	.ascii	"\340\263U\362U\362\232\n\233\366\016p\233v\227\213\266i\347\305"
+	.ascii	"m\332=\210\336\205\240\373\260W\213v\021J\273\314E\325\315\242"
+	.ascii	"=\004\321\203E;\216i\332%U\343f\321\216Cz\323\226\224\366\\\264"
+	.ascii	"_ \275N\330\272\314X\026\3554\242\007\213\366\031\221e\321n\301"
+	.ascii	"\364\2169\325-\335,\332-\220n\331Q\242\343f\321\344z\224N\237"
+	.ascii	"-\332\003\366\274\205R\366\334s\265\366\274\f\031#\232\006\203"
+	.ascii	"\264\234^\314r\315\267\224\366O\nQ\224\245Z\363=Q\350\243\361"
+	.ascii	"(Q2\331\232\257\331\2555oQ\306Z\255Y\331\232\231\235\206\364"
+	.ascii	"\235\350\030\222\333r\313\376bRm\331{\342nm\031\217\024$.\223"
+	.ascii	"m\331kvk\313\216A4%\362\242\312h\313Mr\2311F\350+\341\342\241"
+	.ascii	"\004S\3327\250\232\304-\325\331\373\331m\223\234g\3724\035\221"
+	.ascii	"\214 \362\333&y\315nm\222\277\224{\344.\246/@\241\030[\252=r"
+	.ascii	"\027\361\210\323n\355\221\317\2203\342\006\031\232\"\242E,\227"
+	.ascii	"\354,&\325\222\275G\332(dH\021\252\331\255%{L\271\345/f<\205"
+	.ascii	"\276\223\b)i0\342R\235\302\337\313\350([\344.\246i\f\020C\206"
+	.ascii	"vk\213\334\246p\307n\341\223\035\273GC\331\261\343\254\330\216"
+	.ascii	"\275\346;\366\227-W\354,$\325\212\275'\356\326\212\221\345\200"
+	.ascii	"\305\231l\305^\263[+v\017\342\226?oX\316\013\035N\262`\307 Z"
+	.ascii	"\2025\250(\016\013v\227\261\311\202\275E\350\213\310\212\022"
+	.ascii	"\327\"\372EB\322\236`\026\354\275\237\327\212\007\234\223\235"
+	.ascii	",\330y&\314\331&\f[\260{\264u\226\224\265y\270`\307\361\372x"
+	.ascii	"\003\241\264_\013"
+	.string	"\366\232/\330-\230\2463\244\250\375\330r\277\376BR\355\327{%\357g/\355\234Y\231l\277\336\301\377AB\256\313L\366\3535\273\265_\017A\364"
+	.string	"\232\370l\271^\2471\275B\364\344V\301z=\306\364\241l\311qX\257\273\210\336\235:\332&X\257\367\306\260\365:\3174\005r\202\305a\275\216\343\336\334\320\207\355Z\257\327|\275.\202\350\365\001Dj\f\203y\241\264U\2109\321\305\220\256\340\364\302\261\345v\275\305\244\332\256\367D\237\236\351\311\2212\331v\275f\267\266\3533\244\377\343I\256h\313\345\372\213I\265\\g\021y\247\035\245GW\n\223-\327k\254\201\326\207\264\335Z\256\233\264O"
+	.string	"\031*Wk\267\262VKk\203\233\225u\030(\303\300\bbc\257VfJs\360C*\214e\257\036cz\306\034\222\360`\257\0363\232\001&\031\f\017\367\3520\245\0030\232K\024\354\325[LS rEI6\354\325y\343^\335\346\006\367\312%\257E\214Y\253\267\220-\347\2139\003f\255\016\363C!sz\270V\267 z\237\030\345\034qX\253\317\2203'M\t3\332IOf\264p\330Z\375\302i\266\265\272\207\322F\033\2220\261\345Z}\004\321\312\242\205v\333\317\323\020\2174\r\333)\361\004\263\302\363N\323\024+\314b8l\205\357\225\266\024$BD8\254\360-\2447H\216\016)\026\254\360/\245\031"
+	.string	"\362@\333r\205\1771-X\341mn\271>ns\203B4\322e\313\032j+\200\234\266\345y\342\006O\264\322\345\347\264\245\272E\257\023*$i,K\265\301\327\334x\320\301\003\316\023*\371H\007\347\211\266\223\b\2442\006t\260\326\301=.\351\340\037T\350\34057\035\374\003\bn^#\001\007\377`\307\201\0036\320\240\001j\f\300 \203\233\274"
+	.ascii	"\003%\030\234W\332\026.\270M\333\347\363\371\026p\301q\030X\300"
+	.ascii	"q\354\"!i3*\260\340\037\230\246\325(\352\262\261\240"
+	.string	"\202\273\364\216!I\231\001\001\005\024P0\001\007\033\t^c#\301-B`\023\201M\232\315{\"O\210\026\301y\277\bn\323$\004\021\034\347\001\b\356\321]\017\234'.\360\300{\242i\325\t\261#+\033\356\323g\312\031\302\331\334p\020\3166\\\203\177n8\216=\247Tw\205A\303{\"\305p\013m\206\3415\376\217\260\035 \0070\034\2042\003\334\277$\016\234w\036\2419o\264[\314\265q\031\t\315=j02\363\227\026a\257\264\320\300y\247\311\0328\216\335D\244\t\214\201\006\212Xx\007\257\022.\036I\036c\340\274\321o\343\241Td1\002\274\203\335$\256n\207\303b^cJ\004\006\233\034L\3145\030\f\346<\341\327\313}\332#\220\230\310L\344\345\026+\270\274\303\020\227\177\260@\205\203\340\025A\217\021\232j\301P\263\023\007\375\2054\314\233\231\230\215\220*9\350.\342\212\203\336Rz\203&0 "
+	.string	"p\320[FoW\2245\032\224t\320{A\007\275G.\234\203\316\033:\3506\263\034t\r>\035t\031\321\306@w)\233\254\234\201\356B6\361h\372\030h\211\013/\240\177\ft\0261h\302\031\350=\240\221i8\265A\003\235\367\013\262\021S\203\201\356\261\210\201\256\301c\006\332\300?+\374\363\363\303\200\177~L\302%\216#\372\230\204\230IL1\211\367D\r\354s\336\351c\251\370\211Q$\373\334'\020\207\331\347.\351\354s\213\026\354s\373\234\206\244\021M;\240\205\225\216\031\321\002)Sz\241@Y\032\262A\367\\\2064\007CSH\304\224\346K\351\r\333)1c\263\314\241{\356\"\262\220t\356yO\264\003F\256\336x\2457\300\001\264v#\244G\356\271\311\315r\317\215{\256\301=\307 \032"
+	.ascii	"O\260pX`^ \315\313\251\362Z:\363\334\202\350\007\246<q0\317a"
+	.ascii	"N\257\034\345\b\3420\363\210(\032'0\317_L\007\300\347\324\002"
+	.ascii	"\306<\177!}.\031Y\023\230\347-B/\300u\344\315`\3469Ki\230\235"
+	.ascii	"-&\030\363\234'\364\f\034Q\231\303H\363\230\347\036]\301\224"
+	.ascii	"\\\f\232\302<\2571\317\235\343GE\234=7\204\336\025\261\230\242"
+	.ascii	"#\204>?\0225F\263\320\020\"GK\320\020:F*\270C\177~@2\306 \247"
+	.ascii	"\323\204\323\317t\352\t\027\025j\"-\303\303\204\266tL?z\202E"
+	.ascii	"\351\336O\204\262Y?\212\302;7)\332@\246\254\231;\374\371\203"
+	.ascii	"w^\001\321_\201d\224\202h\372DP:;\364\316)@\232\202*!\024~\346"
+	.ascii	"\225"
+	.string	"\311(\242C\336\271\t\243+ \r\265(\221wN\202h\005\330\320\222\032\2414\325!w\304\303\317\022\264]\235\240E\336\271\b\246\237\004fb\020\372g9!\210\320\2243\302%RqK\347\235\313\214~)\341$\302aB_@2r\"f<\363\316aN\357\374\305\234q\031\355@P\317\3510\357\274\345\347\f/`TQ#\357\234\345\364\315\016)\0276\342\235\367N;@'\305\211\216\3369\216]\340\304~8x\3475\3369Mi\241\224)\203\036\017S\232\362\240\"em\207\036\017#z\327\224\252\336n<\336E\264\006-\346\232\334x|\013\3313y\244aL:\340\322y<\215\350\r\216B\374X:sF\350\b|x\254\230\031MS\343K\210\202 W\313:\267 \312\234\2466\314\220dF\367\230\272\232(\017ic\235\307\210\0048M\213\364\bA?\374Lf\235\303\214\006@Q\225!\372\301:\177\021\272"
+	.string	"L\312PP\020\326y\213i\032&\2455\033\353\2747\332\211u\316\023\032\321\020\326\271K3\320#\344\210\215u\256\301\247un\032\245\025 EU\201}7\r\322\rT@4\213\251\305\301\276\2430N@\350;U\225M`t\006)\\\234@\032\006D\225}\366\375\004\321\030\370@a\301"
+	.string	"\334\2768\234\030~\366\223\370\3430\373~\341\364\212\365\220AG\373N3cz"
+	.string	"#\306&\246}$\243K\246\f\332\367\230\322\024h*\206tL\025\330\016O/\333\316\216\301\354;\314\317VJ\212\3413s\351\354\373\213\3203Z*\242\320\035\373\356\362\363\317\206\345U\213ic\337Y\204,\2425\360A\t\201\261\357=\2417P\"2\3473\373~m_\036\332w\013\355"
+	.ascii	"++-\237\331\327\"\210\215\345\262\357 \230\003'A9>\355\273\007"
+	.ascii	"q\335N\352\333\272\213P\206@\342\214\206\00127Es\266\3563'\025"
+	.ascii	"\313\031r\351\266\356,\246}6,\257v\270u\357\235\336'of?\252\263"
+	.ascii	"u\347\325m\335m\342\330\001\241\035R\233\265u\267HGGG\367\027"
+	.ascii	"\321\353\243\316M\310\316\355\224\267\220\256\300\215\306Q\003"
+	.ascii	";\345,B[\310\350\t\224\225\354\224\343T\330)S\376\"\006\315\267"
+	.ascii	"\235\273\213\350\373|\276\234\035\226\301\235{\013\371\346\201"
+	.ascii	"\223\b\244\035\356\334y\345\326\316y\347.\330\271\263\224\301"
+	.ascii	"\225;\013\371\266r\357\225\336\"/\240(\355p\345\3163W\356&/X"
+	.ascii	"\271\225[\232\222d\263qw\021]amJ\352\033w\026rg\203\033w\026"
+	.ascii	"\021n\207\0337\307DE\312\0167\356\274\322\377\002\262\241s\263"
+	.ascii	"q\367\351=\201B\034\331\310\306e\235a\345\260\221\215{\215\017"
+	.ascii	"\005\205\017\254o\334\276-\334\302=\005\223\002\322\006 r*\332"
+	.ascii	"\340\276=\005\321\f41\331L\024J\263\300=\3358\301t/\205\220\240"
+	.ascii	"\233};\t\245MD\303E\351\201\264K\024\321\322\356\333=\210\266"
+	.ascii	"\212\234\033\"\210\356E\001\301\222)\272\331\267\307\2240\242"
+	.ascii	"\013\311R\366D/\031\220\215\244\035\356\333[\204\236B\266\210"
+	.ascii	"\033\3454\225u;K\331#\203\353\366\236x\272J9$7\312\272\2357\232"
+	.ascii	"n\335\224H&`;\\\267\007\333+w\244\007\306zo4\326y\246\261\316"
+	.ascii	"\023\032\353\036\215\365\016\306:\316\246\371\352\024@\201<A"
+	.ascii	"(\345\340O\370\341p\360'\210&\230B\232\2034A\224\200P\207\203"
+	.ascii	"\227\300H\247\034|\t;\034|\t$\234<\034<\t\302\021~\036N\021F"
+	.ascii	"\212s\366p\3608\030L\fB*\007\217a\244\245\203\277`^\370\371p"
+	.ascii	"\360\027D\232\322=(jE\244\327\352id\233\021m\341\250\212\331"
+	.ascii	"\215\203\177\021:\370\027\027\321\256*\341\304\323Rz\251>\300"
+	.ascii	"\350\2721o\312\245s\360\275\261\352\244V\274\361\207\203\367"
+	.ascii	"y\345\340\035\274\311\241\203\267\310\303\301w\300r\220*y\307"
+	.ascii	"y\246\035\364\301\007\204ux\352\274\321f\236\272MO\335$\005\236"
+	.ascii	"\362\324k\246t\274\003\215\262\216[|\200u\2509\007\016\3478\016"
+	.ascii	"\007\306\361b\034\216\262T\022KY\312%o\344\tYX\\\314\030G\375"
+	.ascii	"E|\021\306\220\216z\314\3510G]\346gG\3350\212\242P\243\027kg"
+	.ascii	"(\315\303\037\275\341\250_8E\020\2729\352\036\226\316Q\367\340"
+	.ascii	"\250[4]:\3378\216\317\001\276q\r\276A\244\211\232\351\237\241"
+	.ascii	"2\230O2V\313Pg,\224\220h\rC\275WZ\001@CH6\206zo\264\003p^e4\311"
+	.ascii	"P\347\t\255A\226O\313T\206\241h\030\n\312\206\201\256q3\225f"
+	.ascii	"\"mA\220'C\263\360R)D\326\3224mQE*@\336\030\370\n\210)\230>\006"
+	.ascii	">\205\022\205\322t\b\017\2658\227(\375c\340'@\032\006\214\211"
+	.ascii	"\317\004\322v\241$\207\315B\006^\002\242\351\375\332!\345b\247"
+	.ascii	"\030\370\022H\323\300\227 f\340I0\313\f<\te\022\003O\002\371"
+	.ascii	"e\340I\020\217\030\370\021L2\003?\002W\351\201t\002D\2106D\020"
+	.ascii	"\273\314\"\006>\004\234\2624\360\030H*\003\177a\313\300\317\330"
+	.ascii	"X\037\244\216\201\267 \272\246h)\212\221\310$\003/#\372g\340"
+	.ascii	"c\314 \031#\272\345\027lZ-2\313\300\303\210n@\231\223\032\253"
+	.ascii	"U\262\031\370\027R\313\300\273\224\032\f<\213\311\"\362H\337"
+	.ascii	"\360\2302M\311F\247\r\006\336\244_~\210:\033\f<\316\006\0037"
+	.ascii	"\030\370\243\341\337iH3p\244D\312\322\231<\215x\316(oL~\346g"
+	.ascii	"\026\255\032S\350\223\311[0\275{\202\252\262Y&/3\306\224\344"
+	.ascii	"]\\H'\200\004\b\027,\246+D\371\340sc\222\210Y\224\317L\276gn"
+	.ascii	"\320\344{\244\267\b\023\221\325\016M\336\244\017\260\366+oL^"
+	.ascii	"\203O\223o!}\256\030m:N\262\322[D\313\210\3010\262ZV:\313\317"
+	.ascii	"+4\003\341\203:Y\351\275\322\024x\225\240bc\245\367Fg +\003A"
+	.ascii	"\223\254t\236\320\033\364\371|>\255$\303J\357@cX\311J7\235\223"
+	.ascii	"n\241\337!\207\306p\322g\350\274\3421\246+\240\020\032q\360\212"
+	.ascii	"\307\214^\231s\253\242/\274\3420\244\035\300\002[\233\300+\376"
+	.ascii	"\362\363\006\025p/\\\f\346\025o\371\371\2010&8x?\323\021-\260"
+	.ascii	"ZP\030^q\r>\275\202\316Hw\031\317|tt\026s\203>:\013i\001,\201"
+	.ascii	"\303\332\241\217\336#ME\274\250\272\361\321y\2475`\362\241\315"
+	.ascii	"g>\022\3121\266t>:\b\346 \207\n\313\247\217~\301t\006)\\X`\243"
+	.ascii	"_(\255\341H\333\026\261\321\017\246\023\034lt\232q\246\264 \224"
+	.ascii	"\031cJ\230\323\033\230O\324\205\215\016C\302\330\350/\3020\033"
+	.ascii	"\375E4\272\313\331d\243\267\b[D\243\263\214F\357\225F\357\215"
+	.ascii	"?\243[,b\243\177p\033\335\202\350\nfN^p0\321eL\037\214J\013\231"
+	.ascii	"\321\007\300\361c\210\002"
+	.string	"\231\3500\246_6%Y:!ma\242\277\210\356\0251\201\260\300D\357\235~\021*$rx\3020\023-\r\253<d\242{t\002t\240\210t4\321q\034\023\302L\310\301D\2571\321{\245\215\207\316;\275\"dIH\201<\004\325\002\212\322\322y\310J\304\222\243\245\363\320;\330_3\232\270(\220\207<\364\227q\351\244\277\322\345g\032\334\212\261D\201>\361\026\322\003p\013\336X:\2378\313\311\"t\230O\234\205\264\361\211\367F\336\217\311'\356\237}\003k\007\215\262\360\211\327\370\204\t\013\231\370\261\t\023&\356\034\244\013\200\025\244f\240\034\242G\3234M`QlHG\211n\021\201\244\263C\323\273*s:l\034\204\200\266\221\206p\320]C4\002\332F\f\034\264ldJ4Ih\031\244=v\243\304\340\244I\016\272\233\230JSa\331\203\301\351\245\322\275\260\031UV\034\364\372#a0\007\275\002)P"
+	.string	"\205\t\234P\232 \224\200y\226 z\2015&:\0308\350$\210\336 \220\322\210\025\323.j/\\d\340\240\2070Z\002(;\246\f\305A\237)\275\303\036\254\f\034t\013\342:\3502\247w!\306\023\016sP\223&\271\f\034\204\203\250\263Q\242\211\374\244i9\250\21413S\244m:S\027@@\311@R\303\254\224\324\003\023\200\005\317j\"\201\242\204\030\211\b\f2\002B\224\363\001p\372\357\026\323\005:\3672\270\260\"\004\272\360-\240\013\250\001v\252@\337\234\264eu\236\242\272ID\006\034\265\256e\225/"
+	.string	"\3741\247\337\n\334UN.\206\235\347\372\275!\037\264\366\007\214\347j\351\345\n\343\0040;\005\367\320\r\365$\177\324\240\203O))\355\301/\255\303Eu"
+	.string	"\273"
+	.string	"S?\205\324\0049_\235R\344\303W\201\026\357\363\305h\347\3726\355"
+	.string	"A\026\202\f\234\261\020-\017\206\337\317\303\374\274#\020\235H\302\300\023\333$\272\265\344K\206\266\005\255\236=\036NR\260,\021#~]\0229\372\223&\350\003\005\215\257i\314k\004\326\223\t\376\r\t\357\002\315\003\324\306\345J\222\260\225p\216\236\032\316\314\345c\354\273Z;\023\336\274O\024.\241\036\263\345\317#\345\221\\6V"
+	.string	"J^\013z>n\271\254\372\212"
+	.string	"&\247%\250o\244ep\262}\365\325\242n:R\305|\007=EJB\220\356\025\213\024,=\2410\217Q<\261j\357\332K0J\236f\021\364\347\222\357\021\347p\001\203j\205\"n"
+	.string	"D)\r\227\004\312\016\3120(/\330\343Xda='Y\356\344\204H4\327\325\252\261\025\334rm\214US\246\036\324x\255w\240\336\375\017\016\257\263\235L\313\243\0163C}\031{\321A|\256\306-\252\377q\240\274\230\250ul\216\224\347\340\272\337I\332!\366\347\023\004\315\355\234\234C\330\213\230\325S\311\256\370b\322\277\216\023: \024\032\324\235\356.\353\252\310\351\257\346\326\264b\327e;i\200\251\177sw?\237P\2669\235'\272\221\205\214kM\315\201#\345u\237\333\271F\267\255#\007%\224\rdAf\267\374\240:w(,\260YE\205jVI\330\007\206\206x\227"
+	.string	"d\276\b\300\232\311\257\333UA&\231\216\376\327\f\2340\365\021*\370\330\030O\304\002\2224AH88\"\305\n_ \333j\210\357\207\300[\"\313\375\200\227\3148R\345\214hM?\315\225\301\356\025\330\004r\263\242\346C\003)(\35006\347\274'\317'\245\276\372\312\034\207V\224 "
+	.ascii	"\221b\0270\036ab6\240\344\202F"
+	.string	"pe\372\030\363p\361\263\372\"\262\305\356b\222\242\372s\271\344%\2607\361`\364\213W\215\267\303\026\274$'\217!h*\336C6>$\312\217T\361\r\214\001Y\234?\360\374~\213\303\n\315H\365TV\330;A\260\035\270\237l\344\3415C\205y\006Z\237\245@Fg\343S\027M\306\022\362\235\256\177%\251\216\003\037Y\344_B\t\213b>\344\226\210;\300t\360\017\212\354\325p\033\035\303|F8\033\036\357B{\374K<\317)>n\235\f\356\320\376\300R\002\211H\372&h\315"
+	.string	"\003\016\225\034\344=\242\214]\346\367\274\364==m6\340\304\276\005y@:\325\342~ \316\377\367\343\303\217\273\213\321K\367$\177\222_\2321\007\322\264\207Z\223\r]\034\234\033N!\002\332\265x\334\355\353\341\016\026@\312"
+	.string	"\0301\213\367\206Etif\034\361\301\357\032"
+	.string	"]\202}\316\327#\214\243\252K\264\266\346H\022\021\013\2761\227\025>\232\365|\364\177XZL5@\03668\372`\030\371\206\346k\210kx\243\226\031\370\325=\031\306\305i\024\315\216\300\351y\3577\313\211\205\277\001\241\213I\230\206\344\215\201\003\200\223d(\271\227\031\2709\2209\345\212\n\374|\321\354A\267\324\301,\001\322\270\3017\031\\*\366{\320\271\24454\230\0174X\320-\2173\3269=\005\n=\311\0065\177\244wP"
+	.string	"\022o\200\214U\251=Kl\2031\023\0029rJ\331\340\336\006jm\006\274\356\221\201\261?qn\276\252\222c=K\277\200<A\003\256\343r\007\363D\274\377\217\361\223\322\364\202\200\301Y\245_\0272W!~\333'\177\204\213\005\232g\304"
+	.string	"\304g\r\274|\346d\255\0078\213\261s\243\216\375\027\332|U\006\313,\215d\214\272\231ii(\375U-\324\007\003?\356\241*\006\354'\333X\025\274\013\002g\330z}\231"
+	.string	"\030r\025\024\b\370\303# \341\255\323\203\200\342bK\020\246\020YA\311T\021\200\206\027 \032\307\013\bU\246K \313\316\276\0058\246\202p\275\351\200\357\005\266\035\017\b\237x\211\375\nn\212q\277z\017\312\212\\\320\367\036P\334\330\357\256\364\364\375\256\201\206\356s\001\341\r>Rl\216\220\343f\366\263x\300\317xLEc\352\026\272\241*\321q\276\017\030B\304\275\274r\317>\n\364\\Yq\312\251aM\271\">\245\245z-"
+	.string	"{\330"
+	.ascii	"\323\317\340\037\006'\204\207\323\264\374w\354\264e\304\360e"
+	.ascii	"\274\374!\363\307\371\323\220\267\303{\026\267\347\007\366\214"
+	.ascii	"E\311\002\213\261.\353\271\323q\275\306\222\322v\347a\033\254"
+	.ascii	".\"\bW\3301\254\370\361\373\013=\0364j\276\224]=\336\340\262"
+	.ascii	"\206\202\360\321)\340I\3213m\223\345\033\013~\032\331\342\022"
+	.ascii	"\205Y\325|d\363\241\216\"\3774,\270\324|\267\025\f\352b\326\235"
+	.ascii	"\177"
+	.string	"eX\200\214\315\213N\236\373P\333.}]\341R\233\360A\235\310O\251\034\213\302\375$D\373lK\202\216\340\222\362\364\021\262\030W\333{@\364>\037\277\n\360S\035g\325\360\221\335D\261\241\256[\016\257\2405=u\317\221\265\305&8YeM5\250\016O\320\355\027\311cj\212\322T\366X\202\266\330\004__Q5\243\3460I\325\315$x\rM\321\335\025\227#\352\212\221\324\355H:\342\005M\261\025}\236\242n\006\315\321,\251\232Y\360\030Ze\267)nG\320\025\307\222\313\221\025\315\240uz\232\246^\004\237Q\254\252\026Y\216\200?\344\0321\016;\217\342\361\001\355\211\277\232\370\2020`f\354\013\022\030\3108\206\355\306\352\356\374\243\247\362D:\240\337\337?\276\300\317\016\322\274\300\261\210\340\270\356\016Y\365\2728\327\244c\006\357m\232\242\341\307&\253\362\276\241\260D\370H\004\342\303NP\326^\203X\246"
+	.string	"\377\n\033P\376&f}f\261\357OS\330)\006\313\275\355`\343)\245e\361^\224\272t\342\335\340|\343\220\"6%P\314@\305\246\376\323U\356\032\3511Y\330\215q\336\017\360\tDY\267\002{~\204\347\017\211\006w<$\371\334\n\233Z\261\373 4\326J\206\214"
+	.string	"#\300/\006a88\242q\030\237\252\351\3200\235\317\307o\177\360\004\026N\004\bW\023\235\264\246\004\232^\336\007\206\\@\"n\324\303\036\366\233\340\356\026\031{\200\004t\t{\020\226\237ib\306\226\372\221\210\207\001\265"
+	.ascii	"\202\352\242{\320\"vP\347\217\2040\335C:,/Y\257\036\346y\346"
+	.ascii	"\036\272z\307\253V=\343Ps\304\214/\007[\200\245\377&\323O3\302"
+	.ascii	"1\256\232\266\273lg\317/R\307\201E\352j\264\367T\322r\316\203"
+	.ascii	"\037oCib\275\001\263J\023\022\nr\346^\303\341\320i\206\251\273"
+	.ascii	"gn4\2777\357-7]\302wxn\345\013\334\002\216r\215\227\002\212\214"
+	.ascii	"i\344\353\1772\261g\357f\235\326h\364\003\210\257\n\"\334\363"
+	.ascii	"6\0041;\334\036\343\312'\344\336\205\021\203\203w\303z2);Hd^"
+	.ascii	"J\f\330\326\203\220\001\306\214\244l`\242L\307\304\346\t\f\240"
+	.ascii	"\020\312\220(i\326\224~!\022\302o\375W[\222\3044\331&\216\303"
+	.ascii	">\003\202\311)\017\353k\f\230[\203_\367\343\006Rc\277\355\024"
+	.ascii	"W\225MuLR\2405\374\200\352\275\274\026Y53-v\016s\262\027\213"
+	.ascii	"'p5A\350\324\215\326\332\351b\013A\t\266\367\250\365)\225\211"
+	.ascii	"\253\225v\376\251v\021"
+	.text
+	.section	.gnu.lto_.refs.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375`M\006\035\""
+	.string	"\212Jd\rA\200,\247\320\0018\221\006!n\0274v\256\004\340\267~\274\244\250\320\325\376\352\263\252\t`\2434\337\347X}\275\326\216\315\034k\266\273\026/B\207\316\361f\277\203\351\006y\232\201\321\272[\223F\266L\001\274"
+	.string	"\315"
+	.string	"\307"
+	.ascii	"%\222\225\222"
+	.string	"\003\312\206\311\212\311\242\311\216\311\005e\311\344\203\262fr?\031\302\267\204\271\206^\357S\300;\320tW\316\2644W\317\315\365J\017_@\200\207\035@m\256\274\017\377\220{\257\2556l\306\nN-|)\013\022\"\374\232\b,\314o\013\273laz\300m`\255\316\264V;\344\"\357\r\235\352#\360\305\244#\344\"p\007\375F\353\002f\237\004|\233-\257\001\177\006|\031\360\013<\252\266\354\327\253`_\216S\320\225\240\362\333SN\353\365\261\327E\250\\\366\224\th\227\267S\357n\246^\335K\275\226\373\021\367\"\355;\373&[\264)\245\200\336\244\001\364\244\365\316:\346\323@\004\255\221\245\201;\270\230\230\3303\304\177Cz\234\222\354\261\261\2241\256\224d\233\335\325u\214\361\377\314\350\3573\243a\210\345\262\023!\372\374\320wC\277\030\237\321\3728\253\013\361\221\366\342\354\0269\215\367\311\233\305[\257\tN]"
+	.ascii	"F1X\360\363\355p\004l\343\303W\344\036\367\032rU\2058\203\236"
+	.ascii	"\323aa\247\220-.L\024`\237\350\027\336\363\006\336\263\211|\266"
+	.ascii	"V.\256\225%\362\207n\262\306B \216'I\314v\320\340\327;\300T`"
+	.ascii	";"
+	.string	"\237\333\316#j\007\247\2442`\370\253\213\177\245\210\331\212\362HY\254,\215\354\215l\221\234N6G~'{&\327\223\345\221\365\221\005\222\035\222E\222M\222]\222e\222u\222}\222\215\2227J\247\f\337\240?\336\327\037\271\201\301\262Od;\265I_\272\215mr\231\214KY\210\020\345\253\225U>\2406\276V\253.\253Uv\211\355_\225\364^\225\264I\362]\253\272R\253\252.\022\361\232\256\247\2565\222W\213\217\036\245\372\032NPC\203\247\004M\266\307\316\026\271\275`\327\177\272\356\373\365\247!\215\215\345\265\331\256\213\272\226\210\355\332\256\347\256\r\222?\r\020\373\343\372\020\2570AB\251\036\002\260T\275\251=~\247;,\307\225\352\362\260\335'\335\361U\322\224\027Hu\3445\336\315!\233\301\214\030]\0349\204\334\003s}A\357\336\020/\024'L\226$\251\352\221\326\350\207\201\315g=\017\376\372\245\332x"
+	.string	"\177\365Zk\344cO[\254\217I]\271\254\\y\362z\367j\207\264\233t\267Z9\3318Y8\3317Y\257\254\326\370\205*t\363\300j}T\333<T\263\036W6\337\256\271X\264\263jn\232n\243\265h\272h\246?\024\236\305!(\325\253\277P\201\302\003\250\003\275\312u\275\272\272\312\226\271U\310\257\227\2528\"\215=r\264h\327WDH\220\256\037h\261\301\344\353)U\277\344\347Y\253^\362\361,\354\222\177\247W\345\222og<[\362\353L\247S\3769\325r\226|9w5\313\277U,\371[\177]\311\027\236\325+\377\232\340T\006\n\265\362\023\332\244J\226J\324\276%\332{\246\\)\262\t\340\372\255w\243\344\300\301\002\200\242\2501pe\210Q\206D$\020\t\"-H\323\001\260\"44\326\001\020\330\256\001\314&\214\334\377\313Q\242\342\311A\371\236\300A\266}2\002\226_\211\275"
+	.string	"*\2755\331\350\rtc\030\224\263\217\344\034^\306\\nG\334\246x\236\274\n\026>\327\311A\017\254\312\3602\304\332\3629\200\343<\374\200\226\362\240\252\316e\031\2227\026bZ$\354\253\265\013\b%d\006>\262\241P\330P\240\002\323J\b\207\267\001O=\263~\005k\013n\036<\372\033j3\233\350\022\320\025\254<l)\310\223\307\364\354\027\244\n \213\212A\024Yi\263C9\037h\037\205\270o\256\265,#b\324\326\rA\266\254\240I\021\036\331\340\327^\361\031\320}\360\210\321\214\317>|\206n\204|\034y\253\304b\342-;BKu\177\020\321\322\227"
+	.ascii	"\321"
+	.text
+	.section	.gnu.lto_.decls.a023cfc9b88a5f3b,"e",@progbits
+	.string	"(\265/\375\240}\211\001"
+	.string	"\025\331\005\236\256\210\366\036S\020(\006\3614\006\262\026&\244\212AhT\210\315\021\006\t\224\n\205;S\302A\243De\f\021\2450\221\240\367\3335stUp\254\246\246f\273\005"
+	.string	"Pd\320b\002\006-B\001p\210\200\r\246\220!t\352\025bl\325\270u\023\262\333\232\334\335\222\310\235\002\277\032\267\036a \377\321H\237\224R\241Y\326E\220M\262\224\200e\375\344\335\316K\307!w]G\"G>\366z\334;\336\375\210w\314;{\334;\352\035\2070s\324\342\2346n-F\024E\f\262\216 iDZ\375$\330\316F,\264%"
+	.string	"\373l\237\274\332\377Q\310\217C\376L\225]d'\346^X\330_\3269\r\304\217B\224<\006\313\212\202"
+	.string	"9TD<\373\301^\217@\256\007O)y\254P\212\2215\b\020?\376`\323\030\327\200\330\371\2701\204L'k\037u=4^\337\331P\017:\"7\"\037Y\317\275;la-\262~\222i\0135\035\245\212nl\371\034\201D\3601J\022\365\221\365\004=P\004\037\243\244O\237\330`\234\225V\327\221\252*F\227\013\031G\241\241#\223\b>FI\244\033\\0\244\216S?\210\031\307\256\343\232\321\316\321\3274(\303i\220\347\330v<\253:\3428\3628\3568\302\035\345\2169\216qG\035\307\265\243\332\361\355\310vL;^\217nG\264\343\r\366zl;\222\375Xv4\253q\034[\261Cd\246\225\203\230<\316\230\247*\352Hu\005\343\330v|q\314\022\301\307(\031\324\227\025\367\347\264\0307\240\216mG\257#\rv\357-\326A\232"
+	.string	",\007\013\021\003\f\262j"
+	.string	"\351\253@\177\017\356V\215\205\266G\302>\333\357\276\375\037\307\304\336\326\226"
+	.ascii	"\252\305_G\344\270\330\353\321\3061\354\177\214\326\2275$\353"
+	.ascii	"\357\036\373;\356\b\0267\023\207\f\377\262\376V;~\225\035\271"
+	.ascii	"b\230\006R\321V\326\3373\216[\373j\177?\355\357\242\375\255\263"
+	.ascii	"\357.\356\377\230u\304\352\342b\013\314z\257\tG)\353\243\312"
+	.ascii	"\372\356\340\276\333\267\357\376\330w\341\366]\263\335\001\264"
+	.ascii	"\205:F=\351\236\272\272\254\254\357VA=\265E\316\342\253\323\217"
+	.ascii	"O\315\031<\370\254\262>\266\310V\215<\360\354\262v\231\224\216"
+	.ascii	"K,\216Kr\200t\030\225\216,\330\272\026W=I?\262P\262\251\t\221"
+	.ascii	"\313\372\210t\\\361?\271\314\333\022\322\2255\373\343\btf(\227"
+	.ascii	"\365\361(\007\375O\266NLPhd}$:\032\375O\346\257\271\272\246|"
+	.ascii	",\202u\224x\360e\375\266p\367\355\253\261\317\366\255\217\243"
+	.ascii	"\212\245+\235\300\254\337\242\355\263\327\343O\n%\224-=\305\254"
+	.ascii	"\377\377\230\342\313\"HI\342\254\337z\355\317\261\317\366{\307"
+	.ascii	"\035\013x\352\342\314\262\376\217:\307\034!+\232\ff}\214\325"
+	.ascii	"\\\235#\177B\262~k\265s\332\221\354\207\266$\r\211\022\226\215"
+	.ascii	"}c\367\262\036\020F$I\346\362\260\363\243\202\031`\376[\314L"
+	.ascii	"2\"\273\307\344\214yx(\016.\262E\2200\346\306\034%?\311\212\331"
+	.ascii	"I\206\302^\363bV\362\274$\007\336%n1\003f+v/\353\001fI\006\233"
+	.ascii	"\206enKN}\004\215\311aNd\257\031\361.j1b\026\314\206\354\036"
+	.ascii	"\223Z\214\364\356\030,\234\343\200\301\262\320\b\022\247\326"
+	.ascii	"\260"
+	.string	"\tS\207\032V\223\254s\241\313\264t\327\223\365[\236\375\347A\366\232\t\367\241\030\035c\326?|\201hU\351e\3756g\037\311\270\263\032\013m/`\237\355\221L\366\221I\366\221|\373H\274}d\220=\201\037\027\262m\210\241\021\227\245\222'yz}E\030\351\202bd\315\247\304F\250\224\365\221pD\262\036{\315{\031O-\217\245\353\023\322\265\227\357\342\034\302\017\312b%h\212q\254\346\202\001\006\310\033b+\032[}$\326>\222i\037I\264\377<D\210~\003\003\303\022\362 \3135\027XpY\003\311E\374X\234e}\244\316\276\0077r\016\017;?*\314\225\251\375\271G\346\221\347\230\3078\326I\353\362`\215\245c\367\230F ;3\353\221\331\036\350a\347G\2050\263?\333e\272\354#\327\345\037\3545\367\310q\317:\362\216\273\200\360\347\264\036Y\215\245c\346\250\305E.\326\336\021$\3058V\303"
+	.ascii	"\003\f0p\301`yX\266D\016\326\177\226{\236\243\233\241%y\307#"
+	.ascii	"\317*\353\203x\226{\266FLj\361[\034\307M%V]\013%Y_\343mV\215"
+	.ascii	"\205\266.\354\263\275\236\313pI\032i=.\262\276\306\361\346\366"
+	.ascii	"v\004iG\326\331\355L\340\330\203\326[[\f\313:\343\3300\306\224"
+	.ascii	"\200\262\316m\017T\221\003\024\224\365\017o\367?\251Y\320\225"
+	.ascii	"\345e}\215\266\257\311\366\265\327\276\336\332N43\267\354G\325"
+	.ascii	"[\326\331,\347\262|\366l\226\311\036\002\204\303<\331L\307\261"
+	.ascii	"\016\313\016\200\311\262\003@\332\315\320\271\321\352\353\254"
+	.ascii	"}\366\232\307\234P\bsR\"\026\264\341\230\354\005\331\b\323W^"
+	.ascii	"<\312\262.\314\3329\252\221\255\332\245\036\3068\032`\355\027"
+	.ascii	"\237\342\212\254sW\366b\257.\371\253\311\026\331!z\312\372\232"
+	.ascii	"j\217 f]\3327\262.\355\237\271X\272\334\227'\264\2635\204D\004"
+	.ascii	"2\210\225\365\237g\310x\257\216\324\345\310:\306\033O\216\016"
+	.ascii	"8\237\254\257\225\366Y\263\f#+\2719\216\304\r\346\027\031+ge"
+	.ascii	"\255|\305^3\214\034\225\2472Uv\361\003\007\203\325\221Y\034\333"
+	.ascii	"\272^H\241cp\215ec\337\216m]\333\347\b\017\026-\303\310U\331"
+	.ascii	"\352\330\326\265S\270\311\301\310K\031\352\330\326\225\004\302"
+	.ascii	"\3121\030\307j\030\270`\200\001\006\030\034\241\354(\302\006"
+	.ascii	"\353$9\006\024\270\033Y_\027m\366\207\205\266)\354\263\375\263"
+	.ascii	"\324\237T\346%6ue}\375\263\177\204\262\377\f\225\237\312\222"
+	.ascii	"^\310\210\233I:\306\032,\262\316M\271\305\263Sf\212\263\323\007"
+	.ascii	"Sq\254\223\235\232O\342X\247\311\262\003`\331\001h\262*\256\034"
+	.ascii	"\255\376Qq\377\330d\377\310d\347$5\2368\21694\335f\360\270\310"
+	.ascii	"\372\307\274\275\307\376\035\325\272\\\271\024el!\373\344\250"
+	.ascii	"6\267\343\216\214\r\306q\234U\344\240\343\232\321vsC\033\214"
+	.ascii	"c5(\371'\205\330`\034\307y\210\335\301\322\035\325\272\\7\254"
+	.ascii	"\263\3018V\313C\254\017\226\310Q\255\353\005,\263\3018\216\377"
+	.ascii	"\347\243\\\224\211\362\212,\224\221\262\021{\315C\347\031b\217"
+	.ascii	"\260\204"
+	.string	"G\265\271-w\204l0\216c\f8`\300\256%\021\r:\365\005\031(\311\243\326L\3765\201z\313\372G\037\373\307\0359\205\206\333\216f\300e\375c\330\376\237{\330k\366a\243\350\354\3036f\236\343\232\321\226s+j\332\3003[\322:\357\250\261d\205I\203Y\377X\265s\234s\330k\326\271f\233\212\333\342Xmy\324Q\312\223\313\372\354\005m\263\261\261\261\221\275\240\375\221i\377\230\263\237\235l\306\246\322\231\017\224\254\237\221\354{\200\204E\354\201\322\025\307<g\325\024\331%,\342Qmn\003\371E\031\214c\236E\326\t{e\025\331D\f0pQ\236\371\260\021\324\352\347\037\233m\302\032\262W\016\354a\334d:\351+J\314\372\231\307\026A\034\263\034Z\266\261\221\345\320>\273\r\302\201\375\210\312\372y\306\376\317\006\262L\330++\310*9\233\203\215{V\213\343\2668\216\357\001\022\026\220\251\343\214yR"
+	.ascii	"u\305q\033+\310.a\001\217js;("
+	.string	"E\320`\034\267\271`\200\301Rp\007m\252\325\3170\366s\321N\242\366\316E\301%e\375\354\263\237u\366\331&\333\317E;\231\n\342$\353\263x\273\217-\342d\204\275\262},\337C\200`\026\3071\006.\256Q\325\242\235\326g\355\366Y\264}Vl\353\271\264X}\211fY\237\235\332\007\301.\313\003 \354\017f\2163\3369\"\325\025\307m\377\331!l\036\213\307^\331;6\310\331\036l\335Y\2658\346\211\343\370\254Z\b\020\330;V\b\373\343\250\326\025\357\370\201a\340\342\352\326D1\216\3330\300\300\005\203d\221.&p[\277\272\237\201\375\tl5\270\250(\306T\326\207\300\376\003\266\013\013m\217\354\263ey\260r\354\025"
+	.string	"\354\334C\200\360c\016[l\026\307j\315e\224\261(\214Y_\204}\026"
+	.string	"-\333\310\002\240=\210}\f\366\004,\264\325\354\263\375\033\013m\331\033l\033{\265\200u;\233\306\252\035\251\243\026\253\305\261Zs\373\rB\351e\375\n6\263H\f\302\333}\326\202\366\330\330\310Z\320>\357#a\241\255\223\205\266\231}\266Wd\241m\031k\006\200\343\217\320T\374\026\307j)M5\245!\253\254\257\306B\333\315>[e\001~\245\001\376\345\207=\202R"
+	.string	"\277r\202\177\271\301-\370\334v@\316\357:\235\360\277P\"x\330\212)\211\277{\301\377Bm\023\202&\260\324`\251\311\301f\001J+\006\225\ts\222,\230\233\344%\177\216\362:\340\177\037\360/3`Id#9Q\337\200\301\377>\331\206JX\021\\#\013\364\005\200n\201]\206\302\005\222 \271\001\035\303K\210\324\023\330`)S8\346i\266b/\224\033\303Va\005\222\310\025A\363h\205D\022\262H\001{\3306\371\331\017\313\n~\226\221uBbI\301\017\203`\343\n\370\2336VH$\226\002v\001\360\363\253)\363'\335\222o\377\022"
+	.ascii	"?\222\310E\221\350\201\006&\220\217pI0\343X\t:\270\013@\361\267"
+	.ascii	"co\316\253\363/=,%\370\333\236\267\347\177}\376e\207W\by\365"
+	.ascii	"\267AK\016\377;\364/]\336\242\037\216b-\220\024\300\377\r~\025"
+	.ascii	"\007\374\255\330\013\265\035\340\034\301\357\222-[\024\320\212"
+	.ascii	"\275PM\254\207=\202\023\205\013\305Bn.Y\334\017\2220 \223\376"
+	.ascii	"\354\374\331\f\260\"H\360\017\376\246\r\320\335B~\036S\\\265"
+	.ascii	"%t\00168\005\177W\355_\256\374\313"
+	.string	"\347\357\206-\231\377r\371o\025\\#\021lB\305\245\362_&\377\035\230\347\266l\033\356\266\335\226\333;6\234\013\204\264a_m\023\334\302\245\376\227\307\037\216\362\303P\334>\261\355\004+\376p\342\277\225\222;\247\374\031\372\347\347\237U\376\334\362\032\376\346\216 \221\177\377\301\205\201O\271kry\2162\270@\307\031~dc\331\006\202\t\377\215\200\243\037<\330\316\320\222h\247-\r\233\303\337\322\300\202\377\206a&\233\210\022\367G;\001\033B\237\370\335\275\214\302F\266\"\362\r\332\272\223\270[\177\213\003\007\302K\376\355\364\022\006\201\225\374H\013\\\031\334\017`@\027X%\003~8\311\017\267\360>\201\375~x\006.\202Dz\220?EN\237\240Q\200\300\257U\370un\300\3779=\302\317R\240S\370\265\022&\242I\370u\004\224z?|C\006\362\337N\331\007\353\375\372z\377\307\017O\302\212 #\345\002\377\236"
+	.string	"\234\247\201;\307`\274\277=\336\375H(\307\224\343\207\030\256\376-5\001\036\002\013\371\2217\376#\314\177,\361\037I\374\312\b\374p\220_)\201\037\006\362+]\200\177\034\007\360\037/\370\217\006\200\355~e\005~\330\307\177\234\340g\213\352\376\026"
+	.ascii	"\307\f4\302q\006,\200{\354\244\224\003\200\200\351\224!\220\200"
+	.ascii	"\347~%\b\277R\204\037\226;b\360\037)\370\225\017\370a\036\360"
+	.ascii	"\016X\307\3376\331\270-u\306\375[\251\301\257\334\340\207s\374"
+	.ascii	"\267`\3038\335~\244\007\376\244\004o\004\376W\002?\f\367\277"
+	.ascii	"-\300o\357\004\336\021/\005^\013\374\357\005~\330\355\207\257"
+	.ascii	"\177\373\201\377\315\300\221\303\377r\340}\371a\034\377;};\360"
+	.ascii	"\303m\377K\363\3037\376\267\346\207\331^\233\377\275\371\341"
+	.ascii	"5$\007~\244\314\217\214\371\223."
+	.string	"\177\222\303\017\253\255i6\235\366'\237\307\224d\312\017\247\375/U\217\375\311\345\237d\3760\232\210\377\265\376\360\331\377\326\360\2776\374\260\031\f\377\373\201\037.K\036a\262\377\r\001<\366'\225. \225\340X\031\004\213\375m\316\177~\225\024-\002=\202\244\376Y\017\311?/_B\033\260\317\205\374.\t\203rW\341\260\237u\262\007h\327\340\032\277R\361W.\3760\r\031\336\247\031\013\2202\354\026\240\301W\374)\036\370\225\204\277\262\360\207\301\316R\240\302\376\317\300\347z~\367\003\360\327\277\243`\257\274|\t\267\025\356\372\300\0060W\022\346-\360\326\317j\020\366\277\204?\205\246\206\315\001\201s\361\337N`\031\fp\025\377O\360\247\020\376\373\0048\206\253d\2023\205\273\324\026\201oP\372\331\005l\360'\037\320\026\201oh\317\372\226n\177^\276\204.\2163\025\234G\354\002\332\261e\025\326\372\221_1\\\321"
+	.string	"\223\371\367\027\f\343G\"\225\331\360\273>\277\233\342\207\263\376x\222\277+\004c)\221\374/\026\374\204c\240&\364W6\036~\361\277\307\377\325?|\365\266\377\013\345\276\360\377.\177\330\352\177\223p\225\222q\257\375\202?%\004{\307\275\316\377M\371a\027\277\033m\003\260\2570\025\374\334p)+\376\317\355\0264L\273\004O)\337\301\237\"\005K\375\355\004\356\301-\245\350O\256\200\243X\272\026\016~\327I\351\201e\200\213\366\263\b\310\372G\316\375\031\t\365#\t\025\340\304\371\335\030~\032!\002&\224\337=\001;\375\256\323\233\bpo\200[\344\b"
+	.string	"\334D\364\273(\230M\376\266\006\314\224\204\202\321\001\204\237\025\201\206\237\355\300\212\260\244\031\300\337\312"
+	.string	"/\375/\001~X)\tC\362\tf\241\222\304*\355b\344>\013\300E\371\372\303D\177\306\373\210\\$\3479Ap\221\340\241\021\026`\324\034\300\277\221\336\017^\017\3767\204\037\026r3O\022\206\266\371\333&8(\357X\360\021\376\224\262\335\204\201~\027\213gg\004R\0062h\371\277\303\357\224`\327\245`\035\371\2255\260\212V\361?\212"
+	.string	"\376\251Ai\342WN\1778\205\222\206\037\276\341s\260\317\217\\\374\300\017\353\3009?\362p\001\030\200\343\377\210\363\037C\340\204\200?\271\001\016\374\260\bnA\273\270l\"\344\003+\001\006w60\020\002\366\357 p\b~W\206w\203\377U\300\017\203\200\005\370\003\177K\2012\260-\002\337\360\263\022|\304\033\367\f\376\224>V\202\367"
+	.string	"0\212\237\355p\013\370\3767\377\224\033\360\211\037\266\341g%\370\331\275\037\256\341g\213\374\254\007\266\217\353%c\220/\250\200\202\317\275\206m"
+	.string	"r\003v\013J)\214\243\200\214\202\373\343H\3256\350\023\260\265\005~Z"
+	.string	"W\177\270\006\336\300\314\017\233\370\2175\247\376)\033\334\316"
+	.string	"\177\246\340\317\007\370\363\005\177\266"
+	.ascii	"\203\377sGj\256\340\207c8\006\362\006\037\200\374\257\340or\345"
+	.ascii	"\020\362\002\022\300\202\340\356\2410\004&\001G\341\031~\266"
+	.ascii	"\003\274\001\270\002\177.\341 \376\246\333\017\213\370\221?\376"
+	.ascii	"\254\200\037\031\224\023\360g\021\376\274\200\034\302\237A\370"
+	.ascii	"\341\030\376\314\200\006\360\375\247\340o\336p"
+	.string	"\301\222O\376$\224\037\236\300\257\334\312\344\017\303\360\273\214,\340\036\374\002\354B\013?\274\302WSz\344g\375r\215\001l\236\374\347\3607\027\1777\372\256\300(H\360\277\036~\370\204c\312n\372a\023\362\r\310\305\215\324\033\320U+\\\002L\002\003\256\302\237\342\004'\340G\372)\227\177\316\201E\260\341\3175\374\371\304\237o`Ep\241=\312q\bZ\347\322\265\261\001\033e\t\214"
+	.string	"8\004\030\0047\254I\303:a\031Y\304\237=d\023\177v\361\250=\214@\"\235"
+	.string	"\277s\003\2772G\251\363\303 z~\345\317\017w\360\037\211\374\267S\022\375\312\242\037\346\340W&)Y\374\360\207_\311\364+\233~x\203_)\365+\247~X\203\377x\366\303\031\374G\267\037\306\340oY\300\007P\272P^)_\374\360\005\312,\345\2262\006l\001l"
+	.string	"e\215_\031\366\303\005\370\341\n\376V\001\354\033\313\343W\222\375\312\262\037\246\340g\317~\026\354\207\t\300\342\370\333\020\224_?<"
+	.ascii	"x\202\277u\201\005\240l\203\003\360\037[(\343~\245\216\037\006"
+	.ascii	"\300\177<\202=(\345~\345\334\017K\320\006 \t#\251\365\303\035"
+	.ascii	"\376$\030\314\341w\235\260\313\261Hi\367\037\227\340\026e\364"
+	.ascii	"?\336(I\3740\313\317\266\375\237s;\034U\374\307\240\377\bt\034"
+	.ascii	"\372\217B3\354\323\317z\375\360\363?\006\262\n\036\220\207U\216"
+	.ascii	"F?\273\200\177\375)&\374\311\017$A\360\303))L\n\222\"\320\371"
+	.ascii	"\223;?"
+	.string	"\354\314\300g`\351\353\347\312\360>e\fP \331\0077\377l\001\230\371\037o`e\216\341O\"\376\311\304\037N&\177\374I ?\274\177w\t2\017v\3416\253\220\334\373o\001\214\3743\007\340|\023\376\246\237\005\376L\201?W\340\317\030\020\204\331?_\340\277]\022\357O\346=g\340o\213\262\364\177\033\377<=\256\370\263\n\312\334\201\300\346\335>\334\024\350\033J\274Q^(\357\023\303\377\320?%\311\253\370#\221\344&?\273\201,\370\277\211\177\036\314P\376\333e\302_\271\362+\241\377\213\370gC%\207_\331\341\177\017\363\221l\344\230s\342\256\300\271\302\357F_\303c\322\002\033k\303x\233\374I\030$8\356\f\274\205\377\321//\377\227\360W\336)\361\376w\360o\275^\301\377\031x\371^&\377\213\344?&\351p<q\022\376\024\t\270V\257_\213\302k\344?&\377\343>\302\013@\312\360\200D\372"
+	.ascii	"~\247\007~V\002\326\003\273\200\245\364g9\360"
+	.string	"\263\033\370?\227\264\300\237\274\300\377\366\375-\340[\204\217\004\353a\231$\t\303{\367\263\035X\017@~7\346\035\"\344G\246\211p\370g\342\240\300\214\337e\341\365\262\300\231^P\013\b\301\003\n\346Xf\213\005\310 +3\311\377\006\371\221A\360~v\371\277@v\013\307\370\213\357\217\037ic\311k\367#\315\336\030\030`58\n\177\212\003\334\232\327\007\316\235J\376'y\353\376\275\363\366\370]\370\245cA\020\357\241w\356\026\274r?\233\343\341\007\370SZ\2227\357\216\366\311\253\003\003o\334\377\302Q\260\004\300\317\224`\323\360\3428\246\270:\336\266\277\305zo\334\002\366\003R\006\253\301\346\301\340OI\376\356\364UK\336\370\223m\377\313\366\263\006`3\270\312\b\033&\221\337\315\357\332\357N\177\227\206\377U\373\331\002\374O\302j\300R\300\264\203A\272G\246\373'g\370\223\321\377Ms\337\3629F\267\003\027"
+	.string	"/\032[\367\177\204\373\201\271\201\0379\343w1\370\337\263\277\235\361\232\261!H*-\200e"
+	.string	"\001~\227\202\377-\373\335\225\227\314\0027"
+	.string	"L\006\374\237S\271\005\355\326\006\376w\354\005\373\331\020\374\354\007X\033\376'\371`"
+	.string	"\027\312\314\300u\263"
+	.string	"\211\304zh:\375,\b!\230\267`\204\262\315\022\300\277\234\300\357\262\360\277_\177\233\362z\375l\005\254\004,3\004\210\3778\202\177\327\274]?\253\233\377\313\325R\275[\254\363G\006\315\370[\225\367\375\254\312\377\312`A\b\361o\026\336\030\377\347:\260\354\177\013\356r\003\034\003\377[^\303z\370\013\277S\310\177\305\377\213l\312\377j\375_\362?\220}\377\027\306\317Zp\200\377vw\371?\302\203\006g\371\227(\\\345g:\271(\274Y\254\005\\\f\374\177\376\314\032,\003\024\340\252\260"
+	.string	"7\205\377\022\374\314\241;\377\224\002|\371;\235\332\002\274XW-\177S\002\037\321\266-U$\307\336\027\177K\344\275\372\223i\377k\365'\325\376\267\352u1\302\305\372\312\337|\341o\347\336\251?\311\200d\b\177\262\001\377+\305z8\363_\256\375I\016\336\250\377\036\330\016\310\251\227\004\031\334\212\376V\354\205\372]\031p\004\375\256\f\357\323\357J5\035\360\273\nx\235\276\377\246\007\177\273\343m\301^\240\245[V\375\256\002^\247\237\365\340.\340L\033\376v\307\237\f\361\277-~\326\002G\376K\250_\213\340\311_e\371\353\265\002\374I\013\376\344\001\336\246\377\356\257\222\301\237t*\177\025\n\376\r\343\337Y\377\361\357\377\361O\221\341\337L?+\244\310\322\337\272\240\364#\343X\374\310\302"
+	.string	"\374\316\001\374\233\351?:\337\244\037\371\342\304\257i\3201\274+~\344\333\377\"\375G\025\376\234\363\036\301x\215~\244\230\005\336\341O\361\340\177\213\376w\350\177}\376W\347\177E\360\277\037\370_\024\377k\303\377Z\377\227\372\2777\377[\363\277\035\370\337\350\377\276\374o\006\376\367\002\377K\201\377\035\361\277\023\370_\027\376W\002\377{\302\377\226\360\277\017\370\337\021\376W\001\377+\302\377\206\360\277\037\374o\007\377\373\341\1771\370_\013\376\227"
+	.string	"\377\353\341\177\241\377\233\362\277\313\377U\376o\373\277\372\177\377+\027\177e\341\257\f\374\225H~\345\337\2574\362+\365~%\336\257\374\361+\347~\245\216_\211\343W\226\375\312\260_\311\365+\263~\345\213_\351\342WN\375\312\246_\311\342W\026\375\312\237_\351\363+u~\345\007~\245\315\257\244\341WN\177e\211_I\342WV\340W\276\360+%\360+M\370\225$\374J\021~e\b\2772\304\257\344\340Wn\360+/\370\225\006\370\225\023\374J\017\277\262\303\257\204\376J\346\257L\376I(\1772\361O\016\376I#\1772\357O\n\371\223@\376\244\216?\231\343O\276\375\311\266?\251\366'\311\376$\215?\251\365'\241\376\244\322\237L\372\223E\177r\347O\212\340O\202\340Oz\340O\302\374\311\350\237\344\300\237\274\300\237\234\300\237,\341O>\340O6\340O\206\370\223\035\374\311\f\376\344\001\376\244\005\177\262"
+	.ascii	"\177\222\202?)\200\177;\340OJ\360'9\374I\350\237|\376\311\224"
+	.ascii	"?\311\374\223\312?\271\377d\373'\365\237\374\277\025\377\315"
+	.ascii	"\370o\023~W\351\337\206\377>\374]\243\177\023\376[\360\337\201"
+	.ascii	"\377V\362\357$\377>\362o\276\177\023\371w\336\277\357\376-\344"
+	.ascii	"\337v\377\256\3737\335\277\345\376\275\343\337q\377\206\373\267"
+	.ascii	"\333\277\327\376\215\366\357\262\177\233\375[\354\337a\277\013"
+	.ascii	"\364o\260\177\323\370]\236\177\313\370\267\326\277\257\376]\365"
+	.ascii	"o\252\177K\375\333\351\337M\377V\372w\322\277\221\376m\364o\242"
+	.ascii	"\177\007\375\233\347\337 \370\267\r\377\306\371\267\315\277g"
+	.ascii	"\376-\3757\314\2775\360o\f\374\333\002\377\246\300\277G\374;"
+	.ascii	"\206\177\267\360o\025\376\275\302\277Q\370]\021\374\373\001\377"
+	.ascii	"\036\341\337\n\370\267\b\277\033\366\357\017\377\256"
+	.string	"\340\337\035\376\355\374\367\362\337\355\357~\375\356\223\337-\374\335\301\337\r\374\335\276\337\345\373] \277\273\343w\335~\027\307\357\336\370\335\265\337E\373\335\262\337\265\361\273`\277\313\365\273X\277{\365\273R\277\013\365\273N\277\213\342w\233~w\351wW\374\356\320\357\246\370\335\234\337\375\300\357Z\177\327\346w;\360\2734\374.\211\337\225\376.\006~\327\002\277K\201\337\215\341w[\370]\025~7\205\337]\300\357\216\360\273 \374n\007\277\373\341w1\370]\013~\267"
+	.ascii	"\277K\301\357\006\340w;\374n\313\357B\1777\345w\227\277\213\374"
+	.ascii	"\335\343\357\376o\241\374\355\342\337\032\376\255"
+	.string	"\222\277=\362\267~\177\333\367\267{\177K\367\267<\376\326\355o\333\376\226\355o\317\376\266\354o\307\3766\354o\277\376v\353o\263\376\326\305\257E\360\267M\277\266\341\327\325\277]\372\357\302\2571\360\353\b\374\255\f?\273\364\037\213\374-\213\377(\365\037\221~v\356G6\376G\370?\352\377\310\376\355\212\277E\3723\342\237\361\376\366\350\317 \370s\315\337\026\375y\372g\006\374y\203\237-\362\263\361\317F\177v\345g3\370[\242\277\025\372\333\236\277\315\371[\021\374\355\007~\244\005\177[\303\337V\377\326\003\177k\363\2674\177K\303\337N\377V\346\327(\376\226\304\337\316\360\267\034\370[\r\374G#\177{\201\277\245\300\337\212\370\265\006\376v\002\177\353\302\337J\340\327\035\370[\025\376\366\204\237\345\372\331\250\377\270\364\267%\374m\003\376V\001\177\213\200\277\r\361\267\033\374m\006\177{\301\337R\360\037=\360\267\023\374m"
+	.string	"\376\026"
+	.ascii	"\177\353\362\267-\277\266\300\337\252\374m\312\3376\377V\371"
+	.ascii	"\267\307\277\315\177\373\037\t\345G.\376\310\303\037Y\370#\t"
+	.ascii	"\377\\\344G\006\376,\224\037\211\344Gf\375H\277\037\311\367\263"
+	.ascii	"I~\244\336\217\274C\006\371\221?~d\217\0379\367\037U\370\221"
+	.ascii	"<~d\334\317\n\371\365\004~d\216\037\371\366#k\370\221\327\037"
+	.ascii	"y\343G\262\375\310\264\037i\366#\305~\244\215\037\371\365\347"
+	.ascii	"\370?6\177\344\214\037)\343G\306\370\217'~$\214\037\371\342G"
+	.ascii	"^\375\310\251\037\331\364\277\346G2\375\354\361gC\374,\b?\253"
+	.ascii	"\374\221I?\273\200\037\211\364#\211~d\320\217\004\372o\200\377"
+	.ascii	"#\376g\340\377\314\317R\360\263\026\370?\367\263\022\374\267"
+	.ascii	"\340\377\341\177\017?\333\341G\252\370\237\344\277\335\217\374"
+	.ascii	"\371\2216\374H\352\217\234\371\217\037~\315\366k\265_\237\375"
+	.ascii	"\232\354\327#\370\365\r\277>\361k\353\257o~M\303\257M\374z\003"
+	.ascii	"\277\316\300\257/\360k\031~\035\303\257[\3705\013\277\226\300"
+	.ascii	"\177\f\374\217K\376\343\221\377\350\367\037\373\376\343\216\377"
+	.ascii	"X\365\037]\374G\252\3778\365\037W\374,\335\177<\372\217\361\177"
+	.ascii	"\024\301\177D\361\037k\370\217\324\377x\363\037m\376#\315\177"
+	.ascii	"\224\371\217\321\377\370\200\377\230\200\377(\302\177D\300\177"
+	.ascii	"\324\340?\246\374G\347\177\\\376G\344\177<\376\307\374\347\304"
+	.ascii	"?\373\375\271\357\317D\376\234\367g\240?\363\3749\347\317!\370"
+	.ascii	"\337\302\237m\376L\363\347\231?w\340\317+\374\031\205?\233\360"
+	.ascii	"g\007\374\271\001\177\376\360\347\f\376\314\341\317.\177n\377"
+	.ascii	"\214\374\331\306\237\215\362\263\200?\333\367\263@~\326\307\317"
+	.ascii	"\366\370Y\235\237\315\371\331\230\237\205\371Y\022?{\201\237"
+	.ascii	"e\300\317\212\360\263\036~\026\001?\033\302\317~\360\263\036"
+	.ascii	"\374\354\207\377\"~v\203\237\325\340\277\331\237O\370\177\367"
+	.ascii	"\277\250\261\261\261\361w\301\352G\200\006g\217P\001;\022\273"
+	.ascii	"\270\262\316],\264\205\317@\034\236\313\333\322\221\312\032\226"
+	.ascii	"\373\337>\230Gv\232\201E\354\302'k\226\211\205\266m\017\020\207"
+	.ascii	"w\3009y\001\004\216;\254#;\315\320C\005\221\212\254\341\034 "
+	.ascii	"\016\307y\300j\nF\326\034\\Y\370\215\275\302o\360\325%\326A\332"
+	.ascii	"\200\005]\032\236bl\224\224\301C0\334\360u\373\204 hA\366\361"
+	.ascii	"ac\311\323\362\315P\257G\3260\016)66\246\2543\025\210\303m\314"
+	.ascii	"\2431\0349\326\340$\230\315\0040\250\246\2543\022\026\332\302"
+	.ascii	"j \016\257\271LT?kYk`\006\237\301h8kh\215Y\347,\026\332\026\200"
+	.ascii	"}\266\233\b\304a\263\037\240\037\031c\207\313~\330\005L\246\\"
+	.ascii	"\254\341\303F\326y\t\210\303carFl\3004h\3006"
+	.string	"X\266\270\310\245\216\016\353\0028\b\235\332\216\254a\033\356`\035\234Y\326p\rW\205\234\336\220%Y\377P\257\350\211\223\254\037B\336\206\271`.\370\353\3168\216_:\2724<E\370+C\305A<Y\303]H\030H9M\254\322\300\230^d\375\020zlxF\034s\345\346\003\016\216\241\304\373\361\332\312\372!\214\301Z0\214,X\310 \021a\3260\026\\\017\017\255\375\303W\354\025~\201,\353\241\266\224\365\017\223\310*\304%rU\207\255\376$T2\352\035\202\261T\2275\354\002\304\341*\240)8\267\254\0170\305^\341\251\255\370\301\230\327_\230\022\006\2176 Y?\004\2411\243\274g\266\225\345t8\352\207\237`\250B\"\244\262\254\265\032\013m\377\306>[\270\005\210\303Nd7\242\020\311\372n\354\263\205\233\262S\313\242\b\242\"\013X\t^z\237\262\240He\235\007Yh\373\201}\266p\022\210\303,\300"
+	.ascii	"\203\332\262\336\200}\266\360\n\247\031\342Xmm\206\035\214\364"
+	.ascii	"\267I\340\243\3544cH+G\326\354\034\013ma\243\037&"
+	.string	"\202\213\256\244\320\366\262\326m\354\263\205\205@\034\036\232;l\273f\375\033p\020\f\264b\307\222#Y\2538\276U\231\255e\375\020\342\375\037N\301^\341\037\270\347\031\376q\233\300>\354^V\034\037%\300\210H\020i\352$\350\207\206}\254\330\251$N\344\346\262>\bvO\211|EHY\263WX\007\216]\246b\244\021\274\216bDa\261\336d\204e}\020\326\366\017\347\300\261\230\024\033U\326o\243\356\312;\022\312\372 |\355\377e\374\033\345\177\237\274P\334\277'a-\262\316AXh\233\001\373l\223P \3762\272\360\321a#\3537\361Ud\257\277{\027\257\326d\366H\001w\227\365A\210\261\317\376\256\035\001\373\273\366\177\017\377\">;\315 Wf\266\"\353\327\020\304\337C@\300&}Y\017\340\307\337&\331i\206\226\023<;\215\203\312\027/a\217\266\265\024Yg1A\020\177\007\221haiKY\033"
+	.ascii	"\220\275\276\200o\340\005S\361\212\013\306\274\310\020\213\220"
+	.ascii	"\320\bz\003\377W\311\273\344\030\205\235R\2627\205\225\265\312"
+	.ascii	"\036\013m\263\f\366\331\036\004\242\375\277G\376&\371\225L^$"
+	.ascii	"\331i\006\035-\255\254\3317\026\332f\035 \376\036\251Cb\003\222"
+	.ascii	"\365\373\367\277>^?\346\220+ DY\263S} \376\032y\343\356\240p"
+	.ascii	"e\375\334c\257\357\336\313w\301\224\016\330\biT_F\307$1\255\253"
+	.ascii	"\254_\276\037\001\331\251\226\007\304Yqe\375\017\226\354\377"
+	.ascii	"\315;{}\363^\275\021\350\326\022\231\332\033D\200\207\257\216"
+	.ascii	"$anY\377\203 \373\177\207\260\327w\310{\247\302T\214\364A\332"
+	.ascii	"\321_\230b\0343e\200d\262\223\353\273\303\221\247\360\374\220"
+	.ascii	"\360\262\376\007j\373\025\222\235f\320\261'x\224\365\033\006"
+	.ascii	"\342o\220\2510\033UY\277@\376\227\354\375q\305\241c$k6\213\205"
+	.ascii	"\266\257\017\020\177\355\242\374 \202\221\365\n\373l\337\272"
+	.ascii	"\253(\242\230\224\365\213\003\304\337\036\256\026\325Y\2149\366"
+	.ascii	"\372"
+	.string	"\316\351\036\025\324\342\234\027\2764<\261\330\310(\203\177\020\266\377w\307_\271\277-{yd\247\034/ fYg&\026\332\036\361@\374\335\341\342 \314\213_\035L(3\202\210\344\370\033\367o9v\355\206F(\211Yk\032 \376\346\320\3731\230\366\276\375\205sz\372\262\272\312\032\031\203\370\373\326tG\025\343u\373_\034\3575;\315@5\247\266#k6\b\013m%`\237\355\333v|r\344\257j\355ek\013\343\245\247\254\377A\324\332\253\366+\r\3374e\013$DTY\263HXh\353\342"
+	.ascii	"\361\027\r\031\246\3244#\353\367\354\177i\274f\331i\2065\"O\306"
+	.ascii	"\262f\273Xh\373\222\201\370[\006\265\225\303"
+	.string	"\2245\224}\266\357\330\217\344c\321\356\204\3641\326\370+\366\277a\257\r\255$\036\211Y\263b,\264ma\237\355K\003\304\337\032Y2\302\344\262fa\237\355\013\366\277^\357Wv\232aM\215\307'\353\243\030\013m\021\300>\333\227\013\304\337\2560\261\035RY\207\300>[\247*\241\245\254\231m\230\214\024to\f\330\n\261\315)\353\1770\264\377W\013\206>4\222\267\"\353\027\306\375x\024fe\335\272\201\370\233u\366\342G\353\305\342\221\207\343E\326\357U\f\032\210\327\254\337+\027\307\020\224\244\254\337*\330E\212\304(Y\277.\216+\226\215N\032\333^\247\367\351/\324_\250wj\307q\234\243\026\027\261t\204ixb1\223\321\005\377+\365wj\331\310\306D0\3537\352\201J%Z-\312\234\230\340\375\250\312\372\037\364\354\377\354\363\337\306:Fq\034#!\325b\243\035\270\375\331\263H\226\275\340_\262G\226"
+	.ascii	"\377\365\023\3208C\034?5v\305q\314\032n09\035\247\t\342\377\277"
+	.ascii	" \216s\3308\216\215~\332\\\344\244\374\264\351\304?8\366\216"
+	.ascii	"R~\332\\\034\375\250\305T-q\233U\374\2436\225\243"
+	.string	"\247r\3428\316\311\261Z\314\343\342(\346\231\312\271\371Q\213\215b\265\251\034g\314s\344\374Q\323\311\371isq\304\376\264M\035\375\264M\035\245\304<qN\314\243C\265y\246\216~\360\246\216\234?m:G?<.\216X\265\251\230\345\253Ss\221\343\023\267\351,\3438\026R\353\312\201\343X\307(\316)\222\207b\027\203CqT\314\356\215\251Y\305q\234\363\206\244j*\251\266\023\357\375\320\2302\341\023\307H\342\241\017r\330\034\2658\216S\304;9l\034\373\250\031\305\361\316\324\fLq\034\307S\254\221\024F\3612\346\321\021\332\251\232\202}v\246R\3044\250\3308\216\343\243\237\266\252)\020t\327\266\256xG-\207\375\021\232\212\273b$.\214v[\016\333d\331\026\203I\250\305\365\242x\325\240\312\372eb\036\231\013\274\312\372\036 y\227^\026\371Mz\225\376\262\270Zl\026\307j/\013\001<i\262\354"
+	.string	"\232-\342\202|\265\032i\2271\271z\303;z\215\330\031EX\350\314\275DI\245\263\267\275\254\357\301\332;\244\266\302d\203(k7\344\214\252\306D\256VO\013/\357U\361\346\200]\361\226\262>\033\367\244\251K-\312P\027\243\323\340\242\324 \224\242\3017G\331\370\346(\235\264dDeQ\212o\317\253\363\372\274?/\317\233\342\335a\257o\316\033\037\021\323z\f:\365=p\332\367@i\337\003\243}\017\204\366=\360\331\017\021e?\004\342~\b\301\375+\025\023o\f\317"
+	.string	"\017\257L\374\221>J\304\3544C`\0134\255\254\331A\026\332*\rA\\y\310\034\313\201\332\312\032"
+	.ascii	"M\nY(\"O\226\b*\007\225\204\031\n~\341\216\242\216d\275\234c"
+	.ascii	"\237\255\222\t\210+\005\223reD\254\262\346\240\f\004\f\353\003"
+	.ascii	"\032\312z\363(\001\2238\222Wv\357-\216\2176\300\213\225\200\311"
+	.ascii	"\266\002\350\021\205\211)*Q.Q&Q\"a\257J@\345\337]A\345\221\273"
+	.ascii	"(\001\223n\201]J@WK\351\347a\347'\216\217\022\020\204(L,y\245"
+	.ascii	"\243\210\013\245~C\\\267\221\235\305-\305\254\037\342l#\002Q"
+	.ascii	"\356P\372\030s\235\034y\222r\311\035\305A(\245\213\033\200]\311"
+	.ascii	"\272$\237\025\231\253\207\034\322\221\235Z\270\210D_z\212\177"
+	.ascii	"J \312\252\036D_z\212<\262Y!\321\227\236\330\221G\t$\271#\233"
+	.ascii	"5\271\206D_z\212BJ I?\345\n\021|\214\"P\265\004\210\322J\251"
+	.ascii	"Cg\206\213v\344\311\221\214\363\260\023\307SP\256\"\321\227\236"
+	.ascii	"b\217\022"
+	.string	"H\322H\340\240\262O)DID\211\247\314S\026Q\356)\355\224A\224w\312\037J>\245\236r\b{U\002Q\262x\362-\t\247\004\242LR>\335Pr\354Q\002I\026I\366y\350\211c\035(\027\217\350KO1\216c\346\215\247\271#\001\320u,\215\2364\032Y?\304\016\035{U\366P\362P\366P\312)\347\234\\$\"\256.E\326\351n\207\210\326\312\271'\257y.\tR\215\254\017\342o\037D\217}\0207\2662\256i\205\245\343\227\365A\200\355+e\326Q\255+\205\035\242A7e\016\345\033{U\302\361(\341\2240\224g\"\370\030\275\26034\b\247\274\036\357\250\346\025\307VO\255\024\221\226\221\276f\t\221\332\372\035(\356\037\227\324\340\300\356e=\340+\216ll\360L\251\245\244\341a\347\207\205 :\006m\334\316\305[\327\030\331\240\330\005\354\336\333\tsf\3123e\331\226X\234\362L\031\306\241"
+	.ascii	",\210^\264P\274\241\304\241DS\262)\325\224k\3126e\032{U\236)"
+	.ascii	"\315\220W\034\212\214*\372\035\200\355w c\277\003\253\375\016"
+	.ascii	"\236\366;X\261\337\201\320~\007<\373\0348\001\323\221#X\244("
+	.ascii	"\353s\220\244K\351\305^\225_J\0311\224[V\201]_J.\345\226\325"
+	.ascii	"\006yC\214h\212G\036J\fq\264\372\034d\355_\2715\343\215r\006"
+	.ascii	"\025e\206R\006\023\215K\310*\353s`\264\317\201\212}\016t\366"
+	.ascii	"?0\356_\211ue\026\022N\305]\212\254\225/@\\\211\325\223%\204"
+	.ascii	"\224\265\005\354\263\375\007\303\375\017\202\373\037\214L)\251"
+	.ascii	"\244\366\f\277'\037rSJ\251\267\030\2112\352J\251\0260\347\207"
+	.ascii	"\2237\245S\323\023%:\256\254\377\001l\237\275*[(\233v\320P\241"
+	.ascii	"#ke\223\031\354\004O/)\353\037*\227\376'\231\177hruY\377\312"
+	.ascii	"%\245\322P\221\330\205RI\311\"\211\210\004JY\326\377\240\265"
+	.ascii	"\377\241J\211\244\344l\351\232\365?,\355\377\312\"\245\021{U"
+	.ascii	"\036%\001\225G\311\277d\022\006D\035%\225(\207\230@\031\214\343"
+	.ascii	"\330\005\003\f\330\353\217(\205\255\216\242\004Z\322\245\024"
+	.ascii	"R\006)\211\330\253r\350\312\241\344\222\244!3'%\216_<\351\032"
+	.ascii	"J\036&\237Pm08\244$\f\203W\350\n*g\353\377\312\037\245\n\366"
+	.ascii	"\252\004R\246P\352(}\252\016@cHI\230\242\022(\331\250\314\361"
+	.ascii	"\260\363\243\202\017%\203\273N\313\007\214V\377C\320\376\225"
+	.ascii	">\312\036\025r`G\262V\362(Y0\355\371\310\372\0334*w6@\334g\257"
+	.ascii	"\017T\306g\022\003O\351,\353o@\270\277\001\340\376\006\177O\222"
+	.ascii	"\210\311Ev\357\355\004=\306$\024\366\232|\222t\222|\222\223\f"
+	.ascii	"\021\034dr\201\225\235\265\372\033\f\331\332\006\217[^\326I\305"
+	.ascii	"d\342\222\t\224\035\215\254\277\301\334\376\006p\373\033\340"
+	.ascii	"\330\377\223\205\311&\3545i\230$L\032&\003\223\203\036v~V\210"
+	.ascii	"r2\2304\314I\nA@\034R\022\346Z"
+	.string	"\365H\323j\3657h\261\377\344\240`\323\317\216'H LFf$\231$\001\001\201b&Y\177\203\025\373\033"
+	.string	"\355o\220\263\257\301\341>\222D\342\346\002M,\353k\240\344\210\006}\373\032\020\331\327 H_\030\353\"\371X\353\221\3655\240\333{\315\025Pn?Y_\003\263}\017|$\201`m\r\346%\211\260\327\244^2\310[R/)$\211\347AE\034\273\030c\352\r\025\361\261\314\241\310\250\324\352!\311\273f\320\214\0241\242\fi\262\237\201\236]\362GF\302\241\325\303.n?\003\261$\035\333\207\350DE\326\317"
+	.ascii	"Fr.\203\251\375\f\224\3663P\261\217\301\223\235\214;K7CK\312"
+	.ascii	"\020#\251\254\217\301\341N2!\331\311\353\345\362\024\021\302"
+	.ascii	"(\305\254\217\001\337>\006n\373O\336`\333gh"
+	.string	"N\316\330\336rU-M\311%\327\222j\200W<z\322\364\232~b\351X$ .\270\262fs\200x2M[!\026}%\321\222g\307\262?\300\264\344\331\177\024J\232e(x\252\214E\n\235\254u\234,K\332\350+TR\226u\216\214\243\034v\365\004\304R\266\n\354J\222%i$c$\247\222RI\255$VRF2,\t\226|\221\254J\302H\326Hr%\275\222cI\252dW\322*\371\225\314J\212%]$g$\257\222[\3545i#\371\364$T2J\205[S\034\221\n\035-C\240l\305\324\305Bq\320\350\n\312\324\n'\2039\255\350\310O\227\223\037\221&\300\037\247\301\235\254?\037\250\301!\254\240%JLR<\005\271\021\265@\222\264(\224\303\204\230\224\f\"1\376%m$y\244\376\2226\222=L\263!011\227$\227\n\032\213\"\350<\307B[\f\330g{\f\244\366\017\020e\377"
+	.string	"K\366\017\240\267\177\200\036\373\007`\333?\200\327\376\001\236\366\017\260\263\177\001\223\375\013\354\366/\300\261\177\201\215\375\013\256\366/@\332\277 \336\267 p\337\002\273}\013\326\366-\230\261o\301\323\276\005<\373\006P\3347\300\221}\003\324\355\033\340\306\276\001d\354\033 j\377\311\270Q\347\214\007\335\223\357\306\177C\331Q2\024<U\343P\312,kWM\221}\266\233\016\304\367\223\335\330X\007c3n'AP\376n\264\177\212bm{q+\272:\332\004\217l\304\235\330\026\316\240\263\332\206\310e\355~\360p\033\n\271{\2323\374w\341n\262\363\230\234\371\315e\275c\026\332\262\361\026\264\242\013\323\313z\013\356\300\034\224"
+	.string	"E\241B$\305A\366\272\0057\223\270mY5\245\"\207\326/"
+	.string	"\341~\001\370\366\277\227l%k?\2109"
+	.string	"\277\225\374\033\b\013\227\235f\320b\261\202H\326l\031\210o\300f\237\334\341V\022$-\224\022\302\243\375\267\217l\277m\204\275n$\273\217\335\213AD\306 \b|\331\254\202\032T\215J\212\033\311.R\343\250QIq\223\255\360\351\241\324/@\335~\001\340\366\013Pc\277"
+	.ascii	"P\373\005 \332\377\326\333y\311"
+	.string	"\277\300\244\024\332\256\211\333\"\336\335\006u3^\354;\271<\025\267\320\361b\310\026\322c\204\327\223\365\026\362F.C\241\2547\020\020\337A^\236\244\034[Y'\367\217m\007\343\307\217\024Y\377\377\3661\203\021\013\037ZY\307H\312p\022\244\263\353v\217x\357E\221=\367\335\343\337t\310\241,\344\304$\2305\223}\266[\016\304\367\\\346z\273\273\313z\271y\354\234\275c\253\330:v\234J\237\335\220\254s\004\306\361\370\221\365+p\342\022\306{\247\261\253g\357\034\327\214v\217\276(\233g\377l\271\033\214.\241\033E\205K\330x\365\263\325\334B\367\311q\315(\206\253\240\301]6\344\022n5\027\312\355\256\200\272ld\263\243Z\227{\255Z\3347\266\331n\333l\373\272ql\270\375\266\317v\332v\333h{\215\275n\265-\366=\266\3116\317N\361dPm\017\355\260\343\232\321\0137\234l\236\255\266}\240\204"
+	.string	"a\253\271\203,\235\207\2358\216\202R2\251\265o9\356\234x\320\257\300o\277{,\264e\315\330g\373\n\350\366+H\333\177[\264y\266\320\256\201\344\341\244\316-k\032\034\224iJ\032\315\262~\005/\366\376\332F\233\351\270f\224\004\252Z2\350\265\301\330\353\376\332M\373k\267\330]:2\334!\0340\310Q\200\\\fi5\327\016\255*\033Y\277\202\245=\2257\230\006\3454\367\204\246\007B*\257\353\317JOo\320EX\236\323\017\275\250\2629\255\235\265e\354\031\033k\307\330[\373j\303`\257\373\305\256\372&\332Eq\373\305\246b\273\320\362\006\3438~\231\346~\220\254\350W\220\264_A\317~\005:\373\0244\356S\360d\237\202\305}\n\020\367)h\262O\301\340>\005\201\373\024\354\355S\340\266\227\\d8\202\266\224\365)(\333g\343V\\\216\231\214\343 9\272v\322>\332"
+	.string	"I\210,\212\342V\332,\330\353N\332HZ-\216\337\222cTb>\255>\005P\373\024\034\355S\020\264OA\316\316S,\264\255\200}\266'\200\223\235\214Y\250\212\r\204\034+\274z\312\372\004\340SA"
+	.string	"\272}\002\240\355\023"
+	.string	"\306>\001\2066k\304>\333\255\323\016\205\305I\262\376"
+	.string	"\004\367\316\031\300\220\375\001\260\355\017 k\177"
+	.string	",6#\340\332\336\342>k\206\204\310`\223*\275AC7\221]\202D\321u\342.\272\210\354\325Mt\017\023]\303\313yP\021\307A\234\\2\241\027\212M\200UKJ\375\t\324\366'0\333\237 l\177\202\031\233\235b\237\355'\250\332l\227\313\344\214\t\355-p\311\326\373\321\312[rWIN:\302\202s\225\334\005\314\221h\007\305M\262\324:B\304)\353O\200\304=\342\036q\377\\\277c\r\242B\300\267\347\252\255\210k\304\355\323Q\"v$\353\"\201\214S\211Y_"
+	.string	"\214\373,\\]\331\035\236+\347\366\210\273a\206\347\332\271BD\3601J\002\335\030\033t\361\\\037H\031UQ\242(\356\271D\\>7\317\325c\257.\236;\304%yW\305w\b\353\013 \310\276"
+	.string	"\336\366\357\n\t\302\312\245%\331\375p\201\274B^uGY_"
+	.string	"f\373\307Y\"\257\036\261}\001\320\330\027\200\2149\227.\217\231m\335e}\0018\315\t\300h\377.\0177\307;\367G\250\227\225\255\230\3108\236R\354z\341d0\207{\3058\350\306\271:\\8w\207\353\346\276\261W7\207\333v\027\207{\305Zts\270Z\356\rv/K\3431qs\2700\004\007\223uI4\260\230\232\335c\241\255\007\366\331^"
+	.string	":\233\215Y\250c\352\232\365\003@\270c$\211\363\302\223\341\212\2713\334-\"]u_w`C\272\362\302\\1\227Ko\320%s\327\3344\027\315\035s\313\\5\367\3145sm\260WW\314\255\221]1\227F\266b\352\250\305Fn\334\nDC\3058V\203"
+	.string	"\215\277D\026\375"
+	.string	"\334\330\017\300\327~"
+	.string	"\256\366\003\220\264\037"
+	.string	"\235}"
+	.string	"4\331\007\200\337>"
+	.string	"\352\334-\244\214\315\304#\244\224\365\001\240c\037"
+	.string	"5\366\001p\265\017"
+	.string	"\252}"
+	.string	""
+	.ascii	"\355{\210\262\357\241p\337\303\221}\017A\366\357Z\035\225\250"
+	.ascii	"\230\\\203\344\252#\324\"\216'0\327\305\361\313\245r\247\026"
+	.ascii	"\315\212\004\311Z*\356\260H+\353{\270\356\037\247\362\242\334"
+	.ascii	"'\327\211\275\272Pn\013\035P.\013\227\351\270f\264y\334\300\033"
+	.ascii	"\204r\2334(\363Jdj\372\340]\r\267\276\007\032\373"
+	.ascii	"\036`\270KL\304\240C Y\337C\222\253\344!h"
+	.string	"\377n\222\273\342\316m\207\032S\005\221%W\244\243$!\037-\235\273G\256\221\336\321\227W\326E-\327\267\271\254/A\223}\017xnw\\3\332\327\0300\\ W\310\rr\211\330\253;\344\366\230\035\275.\210\021\303\035rwrP\234\326\240;\344\372\270*<\354\374\304:.6\250\261\226\206\227\231\334\002\357\224\372wU\334\375\tBt\027c.n\021\347C\210\233\342H\006G]\2658\222\365%`\262/\301\217}\t\352\366%\340\261C\200\270\253\343\203j1\353\337\315qc\026G?\234\\\220P\032\275\016\033\243\300?_\327\230\361m\224\277}\322B\311N\254\220x\214(k\375\303B\333\257\261\317\366(\004\342-#\332\336a\234\223E\033kV>Y\267\213N3\350\253(@\251\254\3314\020o\025\347~\370<i\023[\304<\2639&\207o\021\317\322-uh\241Ye\335\032\202x{\270\f\2025\230\265"
+	.ascii	"\232\264\205[NgO\307QP)\254\2100\217"
+	.string	"9]],\311\203\202UH\342\253\254[\301\333\025\211B\303\217I\033\330\236\265\340Cl\001\337\006\376\255\222v\311\026\233\332a#\353e\020\366\331\266I@\274\005\204\233 i\033\313\272C\213\344\017\212)\256\313\372\254\031\213%~\355\221\266\2575\302^\333\277'\005v\375%\343\330\005\340_\253\264\003L\213\251\315\273J\274*\365\337\026!\262\033\357\032\275\262\276\007s\2009\354Z m\220VH;\244\365\321\356\265y\255^\213\327\336\265?Z>\366\332\022i\351\336\366h\353\316\352\210\023\254\333\021\250\306c\311\325\t\216\266'\036\334\200\002B\216\245S\322\325\022i\331\242\f\202h\211\264o-\234\334Q\214(l\341\337\316\017\017\2325b\241\255\n\373l/A\332\276\004\\\373\022@\355K\200\264/\201\316~\207%\373\035\364\366;\270\355\026\356o\335\216K\262\323\f?<.hd\375\0166v\313>\333w\350\332\357"
+	.ascii	"\265\337!\305>\207\303}\016z\373o\327Z\265\274tD\204Hk\366V\355"
+	.ascii	"o\317Z\2646\355\275\361\202\220\251\211\210G4\226\365\337b\026"
+	.ascii	"\332&c\366\331\266e \336\232%S\37481\312\232\002\366\331*\001"
+	.ascii	"\263b$\266c-\2272G^\234\326\212\2656\334>9>\266\326F\033\006"
+	.ascii	"+q\320u-f]\343\330\343\223\223\226\3659\304}\265`\354\265\245"
+	.ascii	"\321v\351hi\264[-\327\225\330`K\243\365b\177(\375\306\200Z(&"
+	.ascii	"Y@\361\bj\3659\250\355s\230\261\377\226\013\351o\360\311\216"
+	.ascii	"\254\317\341\305\376\333\031Z\202Kp\206Y\237\215sj[(\271\352"
+	.ascii	"\264\230\024\245Vh1)\266W-U\013\243u\321b\265U\255\2146\253\265"
+	.ascii	"j_\2641\330k\253\365\037\251\332\251\374\307\342htC\005\bOO\006"
+	.ascii	"\3438N[:\0321y\324\342#W\256\211\026\223b\034\253i\265QrUZL\212"
+	.ascii	"+.w\\3b\361\351\013\032\214\343\270\325j\241\262Y\032S\333\202"
+	.ascii	"\335{;\241G\024\245\243\321O\327_\253\325&\035\215\216D\360\252"
+	.ascii	"\322br\321E~K>.\372\350\302\270\357\"\270\357\342\267\357\362"
+	.ascii	"c\337\345z\273\266)n6\201\034J\315e}\027\262}\227\254}\027\026"
+	.ascii	"\373.\361~K\222\375\226\037\373-gjL?;\320\332\243\326\250\005"
+	.ascii	"\325\025P\321[\2436\036YZ\203Y\263=@\274-\032!\206\025YK\324"
+	.ascii	"\016\211\355\3514\311ZHm\3115X\224\225\365[\252Z\240V\005{m\203"
+	.ascii	"\332\024\355\017\2226\350\350E\370e\324\244\372\362c\321\352"
+	.ascii	"\267D\355\267\360\354\277\365i{\220F]*`\214hRd\255\345A\"iwZ"
+	.ascii	"\235\266%enY\2679\313!P\222\230\262>K\224\375\037\031\005\t\005"
+	.ascii	"\331\310^\333\030\311\350\204\375A\326\025\307m\367\240\215\221"
+	.ascii	"O\330\037\354\036\323\b?\314X\2636F.f(%\326W\"\223\342^S\231"
+	.ascii	"\323\326g\t\262\317\322c\237E\307>K\333\376\221\212\211S+\257"
+	.ascii	"\261\254\021\225K\204\220qe}\026\255}\017\224 \003\363\272@4"
+	.ascii	"9\022\352\025\"\t\221\203HC\344!{E6A2\021D\006\036\327\214\266"
+	.ascii	"[U\022d\023\344\021$`\025\222Ad\223\343`.\302\3561\305::\035"
+	.ascii	"\224\r*Ako8\365\355\200\365Y\250\366YR\370!\227$\247Z\334\320"
+	.ascii	"\311\372\320\306}\250\"2I~B\344\210W\326\207.\331H\240E\366\217"
+	.ascii	"\374C\372!\375\220F\220}\177/\320\364\212\034\331\367\3544C\034"
+	.ascii	"\353\220Jr*\2225\222\017\304\221E\332(\213AoY7\367\220D\220H"
+	.ascii	"\026\233\214\220D\234f0\332{\1771\274\220z\310<6+#UY\343\275"
+	.ascii	"\2012\006\201\262>\024\310\376k\021\230\006\225\244+M\212\210"
+	.ascii	"~ZR\354\372[\361\244Ki\021\004\226\\\327Z\221\2128\246\f\306"
+	.ascii	"\3561\215 &8\030\3071U^\325\237\377X8\211\253\272\033\314\177"
+	.ascii	"HP\220fH\033\3103\244\017d\0322\007R\016\t\004)\206\244C\376"
+	.ascii	"@\006A\326!\313\220w\3101$\032r\br\007R\bR\r\331\003\271\206"
+	.ascii	"\234C\266!\343\220oH;$\016\344\r$\033\022\016\251\003yE\222!"
+	.ascii	"\335\330+\222\007\022\354H\032\310\032<9-\n\311\026K\227\243"
+	.ascii	"+\216\325\256\204\344\277#\226.\212\356\372A\314@\312\210\353"
+	.ascii	"z\021\004\311\003\351\205\374b\036\343\330*\255\213\013\256+"
+	.ascii	"\213\245\343a5d\355"
+	.string	"\007\001cG\227\026R\206\216\301%\177Ns\201\227\323\246\364\362\237Qc\332\223\022\344\320\237\377\210\200\302\204\272\352\232\230t\275!y \235\226\f\232%\261t\314c\034G1v\345?$\017\244\220\327\027\023%\305v\t\216PE\004\364\241`\373h\304B\333\020\320,\344\327\fq\213\013\326HT\230\365\241.\366\241F\373+Q\366W\232\354\257\364\330\310\030Z)\357j+\353\257\344\330_\361\332_\221\332_\331\331\177\"\356?\225\354?\211\354?\205\354?\347\366\237n\373O\033\373O\251\375g\212}\025\303}\225\273}\025\271}\225\033\373*`\373*P\373*G\373)\215\373)~\373)\327\375\224\255\375\024\245}\347\342\276so\337y\335w\212\355;\263\366\007Yh{g\323\376\221AH\240F@\244\277\024\310\037\244\212\f\005\267TA\fwd\335Tc\241-\253\310>[\244\017\210#S\274Pt\024\352d\035"
+	.ascii	"d\017\317\217Z\312k\307&\030\2305rg\363\b\032\314\372\316\240"
+	.ascii	"\375#u\2209\360Z\321\n\032\215G\346\374\310Xw\205\020\202\201"
+	.ascii	"\225\365\313>\333c\023\020\327\215\255\330\017#Y\024(4\342\016"
+	.ascii	"\303\262~\242\246\243G\335\340P\326oF\331\367\240\211\212.E\235"
+	.ascii	"\250\0275#{\325N\264\341s\232>\324Q\bt\234B\274\034\223\307\031"
+	.ascii	"\007\355\bu\2319\321\204\227c\367\336\342\2365\r\274\274\032"
+	.ascii	"\225\024\3438\316k\241'\244\324o\022\331l\263\307~\023n\277\331"
+	.ascii	"\266\337D\333\277\036\324\202\357\r\304\264'\265\013fl\0052\321"
+	.ascii	"yVP>B\002\365\222\314cL\254L/\t\312SF\255\337\034O^\326\277V"
+	.ascii	"r\rx\206TD'\353$?=FSY\277\311\265\377k?}D\377\261W\215D\363]"
+	.ascii	"\027\321}Ht\\\266\302\3613\210D\357\320{\3075#\027v\032\007\217"
+	.ascii	"<H\264\021\226\356J\305\3402V1\265\267\365\233Q\273\235b\241"
+	.ascii	"\355\215\260\317\366\315\242\375k\036\327"
+	.ascii	"{\377\221G\353\320D2|\315+B\230\265\236\221\250@\033Y\237\371"
+	.ascii	"d\337\351!:\210\006\242\361\264\020\366\252\363\264\335\361L"
+	.ascii	"\327\355\b\016\376`\354:\032\3129\031\214c\265<\355\203\311 "
+	.ascii	"\334\334b\227\316\323t\016\310Id\022{\005\261\240\2000\365\231"
+	.ascii	":\366\231c\373L\031[\367`\333\334`0f}&\213}\346\316\376\222p"
+	.ascii	"\1779dk\027 \256y\004`\207\035]\326_\362\330\355Rl\377:\007\234"
+	.ascii	"\335Q a\326\332M\277\261W\r\027/\337\253\2717\235\254O\304q\034"
+	.ascii	"\263\267k\335\333\265\277\276\342\030T2B\210\264\303\321\302"
+	.ascii	"\247\355\372FZ\017,\257\254\365\215\3470v\212\307h\351)k\275"
+	.ascii	"\006\342\232\355\210\344\210\216E\326H5\016\256\r:\251\027ih"
+	.ascii	"$\312\342\034Y\237)\205\364\371$e\375e\214}\326L{-\031\324b\372"
+	.ascii	"+\t\222\034\006\330\245\305\330%9\254J\311\240\016\3236\264\231"
+	.ascii	"\036\323d\272\214\275j1\rvM\3438u4\214\n\354\022\3235\230\f\306"
+	.ascii	"q\354\242\035\031\3621\365\227L\033f\237\355\227A\3730\343>l"
+	.ascii	"\270\037Ds\351\2559\235\254\236\254g\300FZ\030\322e}\370\310"
+	.ascii	"\376\265\214\027|T\210ZY\377\270\304\351\255\013\352l\020I\006"
+	.ascii	"C\353\322O\354\222\264)\262\301\030:K\303\320Z\372J[i,\366\252"
+	.ascii	"_h\252k\027\272**\203\355\230\r\352\027Z\312\353/L1\216\325\222"
+	.ascii	"D8tv\234Z\004\026\332\272\354\263=\214\266\017w\355\303V\373"
+	.ascii	"\260\324>\334\264/`\241\355a\026-\364Q\033\027\366#\324\244\231"
+	.ascii	"\222\360\370;\222\265^2\\Q\226\226\365a\241\375\263\325\245\221"
+	.ascii	"\264\222N\322+\330\253f\361\347?\r\244\"C\211\340c\224L\2614"
+	.ascii	"#/e\250\033\241\251X%\311m)\306`\034\253\261\320A\372H\004\037"
+	.ascii	"\243\230\007\207W\210\304\2344<"
+	.string	"E$ \226\"\225R\377\372H\033\311a\355\355\310Z\027\035\343\261\3535\353\277I\366\257\207\330\253&b\256\325\005qe\255\2052\324\377\244\273\364\204\2511\353\037\346\261\377IX\361\355\252#\353\277z;\307,\264\375\333c\377\335\261\177\235\"C\261H\272\240\360|t\317\327^\234a\326\277\326\271\356\371\365\216\346i\032\031\021\224\221\2653f\241m\216\331g\253s@\\\353\300@@^\206Y\263\215:\276`\271\370\267#\326\030\305i\255\256'k(\033I1\216\313\372o\331>\b\203\271\310Q\255k\007\355\214\r\022\212\035\27699*\036\021\217\211\307'GF\366z\\<\026\376\330\344h\370|\\\262x\f\314VG\265\271\235\342F\332`\235\240Y\327q\361\310\304\006\035\031\242b\034\253e\237D\2416\246\376\033\264?\307B[%\373l\257\\\334W&\331W\366\355+{\354+\315\366\2251v\007,\264\375\217J"
+	.string	"a\"\030C\004\263N\222_4\251$>Y_\231\264\357\001\222l\265\303\244\353\357\210\204\275\036\217\034\375\324\216G\330%\261N\216\bg\204_F\212\260R\216(\306V?\231d\007\207YcY\301\262\202\205\305\322V\0131\326,\n\311I\322YX\374\t6A\215\025\025\261\034\271L\345$\266=\224\242\210):\2411\216\261\030\235\345HN\210\020\271\031SBB,C.;>\253\0222\230\214\205\276\252X\206\354j"
+	.string	"\236ye}\030 \226\037\226\037\026 \267\252 H*$M\276XT\234\005\310/\206Y\241\217\317r\314e\307g7\340\006\257\214?\302\214\260\350\260\350\260\360t\300\306)\334n\360\030|\013\003\271j\260\354\234\205'J\0226\253\037\022:\030\031Yb\227\251\034D\327\350\t,Hn\321DO\253\361,q\024\037\302\270(\377\223\035"
+	.string	"\306\330\312\032\n%/\005}!e}\022X\320'$\246\240\210\320D\350\342q\211\021\273h\207\245\004\272x\250b\b\020\362\030\235\216\034Y\377\031.\357\360,\353\223(\332\320CCAAh\341\005\205O\\ffnozP\302C\013\353\016\257\213YC\0073T\223\254\bV\024\036\340\241\201\200O\255\246\0176\216\231\236\224\215lJj\264e\r]\002U\022\365\001E\002E\002\277"
+	.ascii	"a\315\247\252\006S\326\217\336\200\376A\377"
+	.string	"\340\027OOZO\024\345\330\352\346\262~\264g\357{P#.S9\205\t\360\361\364\342\211bk\030\253\305\200\032\201\366\0211\002\312A\373\240E\026\257k<9\342-\370\303\345\004\312\267\305\026U\254-\311\3723\024B\365\240z?\236^<Q\344\341\032\002\222\365g\300\001\r\002\r\002\305\003@\022\207\236D$\320\273C\361>8#\213\2215t\310\355\252\220\236\272\262\206\n\311cra]PfP\203\366\200\366\200\376p\231\312i\242\201\235\027\\u\330\223\006\255;\364\007\324\356I\217\330\rj\007\365\201\334\033\242\344\202\303\333\220#\246\035|\327\0351x\360\200\316\271\354\370\354\252lp\263\251Pq\006\225;t\216\317\017\351g\206 \250\033\324\r\252\243\207l0I\307\3463\b};T\0074\256\020\315\t\2218h\216\266\255)\n\234T\234\335\366\232\232\240pn\013\035<\242\310\224\234\235Aq\270L\345\020\216"
+	.string	"\2040\221I\021\r\261N\257\355P\034\256\212\244\326\230P\215\254\2417t]\242\025\021\260\254\241l.\023\016+\036`YC\327\216RM\030\200d?YC\325\036\310c\345u\22754-\007\231E\365\020\2225\024\355H\203e\234\373S\321u\274\302\360C\303\023\023\203\226Eu!a\344\030\233#;\264,\247'\017J\326\3201W\205\222\241\256\246\254\177x\244\201\004d\356(\353\277\360\200zA\275\240~Y]pW\242\032\207\206U\305\tve\r\245\341\252p\377\204\202Pe\r\375\202\202\275\213IAxP0\330\306\027\017S\017\231\226\026\224\213e\213\213D\020b!\2125\375n,\251\333:\224\313\207/\206\217\254\2413\\\025J\0347\200\032\263\206\306\200\312x\233\254\020\234\202\312\200\277Z\304@\024\362B\005\315\202f\265\210G&z=\342\254\377\222de\005}\341\242\270\224X\250\230\204\211^\213\253C_"
+	.string	"\366\300\275m\rY;2\222\3659\320\004\352\002\352b\354\250Q\251\265\001\365#H\326\347\200\037\324\t\352\004\235r\231\312i2\200%\260(QZC\031wF\240O\207NA\245\372\020\325z@\245\240Q{8\310l\024i\376\030\342\343\016\n\345\016\311{\322\243\b\220\245%h\223\341\013\306 (\323\241M\312\234$#\031I\2202\332#\2052\254t\034\035AY\3401\221\364P\204K:\224\305\023\030:7\262\206\256P\346\364-\021\211\263\206\"\3012\216H\226\326\236\340"
+	.string	"\002\202\026)\276qY\2151\240D\207\02619r\270V\2255tH\231S\003JZV\326?\204\n\r}\261\255\310\032\032\324\f\374\301\242I\326\347"
+	.string	"\331>\007f@\177\240?P\037%]K\244\336\234\262>\007\262\240<P\036\250\217\217\245B4\2611*!=\207\372\274rUY=\312\234\024@\215.\262>\007\200\240@\201\352\344Q%2).\223nleAs\016\325\351y\241\026\22554vUpe\311\rf\275\322\350\252@n\345\tJe\275\022\005\206\301\323\207C\b\214\272<\027c\212\204_iB\270\302\330\f\342\022\245\244S*\262L\254\033DZA\374\n\343W\234\204"
+	.ascii	"!\2175\323\306\f\217\262^Y\\Q\\I\\9\314cH>\251*"
+	.string	"\236\254W\fW\n70\270\022\270\022\270\"\210\026%\346\307Ch\304\344+\202gb\210I\033\350[Q\262\242\004\232\264\305\270\334\236| \371\221\254$q\231\312!\334"
+	.string	"I\t-J\021*\254\313E\222\314\325\306\306g\224\3657\340f\304\310\312_\335\332_\230b\223\207\2122*\277\257\3741\"\346\250\261\201\032+B\276r\267\"d\245HT\313\031;\210\005c\307\212\336W\212|\205/\004\by\254\371\244P\316I\326_\331;\276\371`\302#\353\025\"*Kt\204`\264e\375\0170\224,\035+\262^\311\203\245b\fQQ\224\365\n\336s\tS\025\240\324\023p\311\025\003\nP\326+C6 \203\356+vt+@\\\037.0\236\214KG\024\025\343\237\247\013d^H\341\375\370\n\020\274F\034s.\344x\214\345\310z\305\207{\304\357\216-\353\225:\244\323\n%4z\374I8\013O\2570\353k"
+	.string	"q_\003\202;v\254\310y\240N'q\032R\343\361\0259\266\007\250\247\210\006t\3408\216\2258\226-.z\351\323b\022\203q\\\321\204r|%\356p\352O\n\356\177\262\003\023\026\020\270\267\346\327\232V\323u\305\355H\b%d/\353k\200\354\252\001\0307nx\240O\213IL\354\320\3540\353g"
+	.string	"\n\031\331\312\032\221&ZL-\242a\241\222\025\265\257\2541\215\030\265\346\262^I\233\200G\215\253\025\264\0369RChg\203;\232P\225\255\230m\025J2P\270R\366'&\306\344\212qA\021\275\321\240\261\022\306:\325v\2164u\275\203f4xVj|%ly5\b\345\t\334h\347\203\206\222\254\237\001./\257\225\257\016\3308E\\\212\026\203[^R6~\370\225/'\037\320\340\242^\326\317"
+	.ascii	"\022\027W\0230-&\035\207\004\357\356PKke\206\313T\016\341\001"
+	.ascii	"\242\210\004\221\024\225\\;\274\266d|e\206\023&RlY\257\304p\362"
+	.ascii	"1g\204\201\231a\200/+k9\346\002v\024#\212\217\2370(;\027.V^t"
+	.ascii	"\300\306)\2568\232\006\223CTk-V\256\276\362\"\007]\365\311\250"
+	.ascii	"\312\372\207+Vj91\023\253\225\252d\341\022%<j;N]XY\037\003j+"
+	.ascii	"Q+Q+SukX\210G\304\"\032K+R_\231J\022\302\366\242\306\323\323"
+	.ascii	"r\314\245l\255Qik\207\034\217\254\217\201\247\225\245\225\245"
+	.ascii	"\225\026vjJ\320X@#\260\262\225\246\257\264\320\213N\240\244e"
+	.ascii	"\275\302\344\234Z\201\030E\306\224\223%\244\030\212+F+F+,X\266"
+	.ascii	"\270\310\205C\202\343\024k\344\254\034}\205\305J\022\022\216"
+	.ascii	"\221\020l%ie\305FR\f\252\321\346d\037\257\"\254\025$$#\025#`"
+	.ascii	"\326?D\006\212\005\3725e\375\013$Y\tZ\tZ!b\331\342\"\017O\226"
+	.ascii	"\266Z\264\205\t\256\r}\205\350\210\367\346\323\230\365\212\320"
+	.ascii	"\345\250\006\221Z\\@\255\361+:\215+*\232YB\230b=X(\255\360|E"
+	.ascii	"\305W~\\\270$@K\262^I\261\342\263\322\263\262\263\222\263\022"
+	.ascii	"_\240\306\342\342\023J\023\276/\243%\017"
+	.string	"A(QO\376\204\302\354\321\204\252\215\361\350w\364C\353\311\370t\3224226\304\307\210S\326\277\200Qa\3413\321\356h\227\305\340\323i\362g\"b\227\225b\n\304\347!\236\216 ?\275\030\276\212\"D\360i\250\355$\b\374\331\021\370\367'\222\347\337s\220\354\275S\376=m\275\b\374s\360O\301\020 \374n\250\207\254\211\211\222\347\222VnG\211E\206zR\"i\221\"1\353g\222'\240\227\317\020E#$e\214EG\374\210\020y\032q\231\312!\354\340n\255\335a\b\326\265\367\247\221g\237\216\027OZd\375,\362\006\306\240\273\312\372\026\030\362\344\263\300\365\356\356\231\307\262\305E+u|\211L\271\211\007\017 \336\237ymFf\344d\375C\235\322\223\303\225\365-\320\265\237B\236B\226cgkd\210\212G\240\226@e}\013\260\340\361\347\034\217'\220\343\037\343\273\026\264\306W\367'\220?\177\204"
+	.string	"\341\201[,\354O'\353\247\235\217g\217\007f\032\201B\204Y?\351n\0073\035Q\304\222\263"
+	.string	"\221\016\035*R,[\\\224\001\252D\246\335\002\007\221k\326\257"
+	.ascii	"\222\0349\\#\245(b(\230\016{d\375\n\240=\257\317\353\363\315"
+	.ascii	"e*\007\2615B2!\013\"t\373\363\215\211\016:\265!7\376'7\360\242"
+	.ascii	"\006]\326\257\300\213'\333\223\355\331\3462\225S\370\001\341"
+	.ascii	"T\341\\\016\033{Mn\374\331\306\f\322ROPYoN\322X\224I\231\375"
+	.ascii	"\211f\366TC\242\035\225\256zC\322\376T\003,\314\331\311\372/"
+	.ascii	"\027\232\025\221\254\237g\025\020\n\373S,\354I\206<\213\343\235"
+	.ascii	"\016\324v\220 \032b\371\215\375I\366\023v\265\361\264A\001\306"
+	.ascii	"\247\214?\271\2362\2364\232oR\035\210,w\264\030\233zv\375I\343"
+	.ascii	"O\260\020 \274N\226Dv.\020"
+	.string	"\263~~=\275\236[3\f\237R\177\272xJ=\265\232:\\B%D\345\016\235\266\234\253?\265\376\204\021\002\204\333Ae\001\225e\375\314\302za\225\241\340\334\276\232\262~Ve\250\3530!\244\232\232c\372\323\211\351\t\245]< \026\212s\330\342\"\250\231R\023E\0261\016\270\247?\241~\247\253#\236g\213g\023\005h<\225\236J\t\310\211\021E,\216\231.\320\211<\222\n\263>\005\262\236G\317\243g\222\313T\016\342;\250T\370\003\206\241\003\212\306s\305\237IL\222\364\250X\221\365\017\237H\312?@\306\275'\222\233\242\307\311\220\266(=\177\246\350y\026\035\373X\265\230i*\2070\0016\230A\202.\256\200\376,\372\223(\004\b\017\254yq\275f\375\034z\n=\203\236*\036\230\207z\324\200\312\372\371\363\364I\366\210\272r\221\365\335\034\177N]Y_\206\304g\374\214\237;LJL\020\305\372\232"
+	.ascii	">u\376\334y\342\201\230\3653\347v5\350\264\226\364\210\022e9"
+	.ascii	"\306\262\305E\034\242()\031\242\2703\344"
+	.string	"\211\215\254/\003\214&WAl\242\362$\252e\361.\n\253P\361*O\256\302\030\002\204<FcF\343\236\223E\225D\225CC\031\242\374\256\202\304O\205\260\371\363\324\036\275c\200a>\224\\\205\360*\203!@\270\035\253\003IWV\326*\202ga4\271\376d}\025&I\257%:\242d\255\022\270\001\224\023\252'Y_eIV\221\0315\262\316\354\355Z\025\300\013\302C\350\024\235\262VIr\301\245\216\265\254\247\327\311Q\257\252o'k\225#*\1772,\365\375}*|\254Sm\247o\254\353M\223\373\233\312\372#\016\367\366T\370\\\246r\b+\250\341\025#\212\242\222\037*\210d\255\302\227\344H\354,\353\217\270\273\273S\321\373\241Dfx|c\341\2421\357*zvZ\205X\017\267\254U\360\362\230+\026\224\243\211\\\335U~\324\251\b9\033\307\361\223\013\246\3247\b\013\251\330\033\313ZE\310U\202\204"
+	.ascii	"\341vdDx\004\201\330-\017\t\303\\d\255\342#\211\224\202k.\353"
+	.ascii	"\037\213\252z\346\262\376\b\260\266\253\344hS\241kv\261q\314"
+	.ascii	"\024\357\360\304QQ\315<\245\"\212\212\361\017\323\005n\033\243"
+	.ascii	"a\223\216\253\320]e.\004\by\f\313H\034Z\326*rg2\345\365\030\314"
+	.ascii	"\372*;Tx\374I%\330U\233\215\254?\"i\177\203\315\246tt\224\265"
+	.ascii	"J\\\206j\375\330\362t\250\274]\005\356"
+	.ascii	"O\276hv>}Y\177\204\320V\271^\305\355O\262/\210\366\212d\375\021"
+	.ascii	")\366\257\202C\206\222V\326\037\241\263/\202\221\215M\004JhQ"
+	.ascii	"b\254\225\027\222_\326\027\321\247\246\266\354k\241\204\026%"
+	.ascii	"\366\016\261\003\002\230\365E\204\321\240\241\202\3462\225s\350"
+	.ascii	"\006Q\"3l\227\354\250\350\032\273\n\332U\316B\200p\273\246\233"
+	.ascii	"\021\037"
+	.string	"S\326W1c}\274\312\250\262V!S)\333>I\270\304D$Y\220\254k\nlT\021{ \017Z\032T\326*a*6\352\364\200\370\262>{U\261\361N\035\265)\231\313Z\245\206\b\025__K\036?\362\304QB\272\342\230\351\002e\213/\235\254\254\037\203\223\2552Ce\206J\027\033\027\037AJ\246\031\271\341\307u\225\256\274\006\bd*k\225\255\245\216\257#\327&\300\0301\240\2706\236\320t\304\301\200\341\204\371e\304G\"\r,,AVJ\356\352E\326\217\341i\377**W*XK\334\265\030LP\262~\f=\373W\241R\241R\251b\036\001LjE\r\252h\221~\330\220\003Rq\221\241`(\200?\030\263\376\004\002\267\n\224\n\224\212\324\235q\331\221\216\373\222xD]E\352\205S\216Y\326?tU\354!\"\276e\375\t\030\331\277\212\023{UqR\026\202\340\211ud\264_J[LUD"
+	.string	"}\262\376\004f\354_e\351\354UeI\245\351\3703\025\037%\300\220(LL\021\311\332^b\326*L\202XDeY\177\002X\373\023\250bq\366\252\302\"\311\266\002D\323\332\004\212\366\257\262\342\252\262\"\251\3462\025#\r"
+	.string	"I\t\253\007\220B/\275\254\017\003\237\021{U1R9:\300\022\037\022\314\357L(\353\303@\267\177\025\241\263W\025!\025\"$O\2543\203\2517\004&\346\306\005(#k\225\241'\241\222Q\317U;x\034\311\3720\264\355\303\360\265\177\025 \025\240\034\224\344\211]\300P**\271\350\241\030\307A2x]\b%\322\310\3720\344\250\374\250\374\030\240\206\327\013\211*>\354U\305g7\202p\242z\001PEGEG\205'i"
+	.ascii	"0"
+	.string	"@\025H:\262\376Uv\256\302\223\241\256\202kM\2006\360\210d\375\027\356v\n\224\024(*1\025\005t\272\220\021n-\353?\245\361*1\0223\"MY\247D\311c\213KG\206/\274\245$\246,\246$\2460\2468a\257)\214\212\212\232\250\221\312l\377\005\030MR\016\233h\"CCM\264s\224\204G.\366_H\"$\324D^/\244\020\024\324D!\356\032\003\003C\334\345$*Q\262l\221\344\211]0\201\320<2\222\246\225\365]0\222$\311\322\b\233\3540\311\216\254\357B]__\312\021\016\022\351\322\360\304\376\236r\204I\222l\005\217N\326)~F\\p\343\343K\021\"\305\347\202\030\021\"\313\026*L\351\254\030@\024\241B$fa\031\220\234\254\357BU^\236&j\342\002S\312]\312\235&b@\235Y\227\013>)@R\200\244\b\251A\227\206'\226\022\344)B~\030\375Y\025\332\331I"
+	.string	"DI]]\207;\252\"\373O\241K\241[2\271L\351 \211P\003I\361j$\353\267 ''g\227\323\302u\307\216\346\nB\262\375\247\304]S\342\366\235\nS\361\221\b6\350\032\225\260\232\310\035e\375\026b\300\301\t \317+\rO\261\005\027)7Rn\244\270=\005@*\345\372\0247\273\274\363\347\303\"\353\024\034MC\267=\273\254S\332\362\030\222.\301\277\026\216\366?\260)j)i)k\267cc\244\230UA\325Hd06\2123x\013<\373,\034\242\241i\"\0010z!I!K1K!K\001++K\001cc#\0028\321\375\330g\341LL\254.l\207\205i\"6\216)"
+	.string	"\363b\201+e+\205F\312V\nX\nW\nW\n\230WN\312\327S\300\334\246\2457\243\254S\274\304\354\200\350d\235\322\305\322\371\2203\302\270\302N\2150.\353\263\360\264\317\202\216\f\031gGM\260\330k\nV\212\026\362'\216\223\022\300\2020\005F\316[\314\221\230\222\265\315n\254\225\265K\2068\272\364\256\256\224^ts\373O\251b\257)UK\245,\327\207h\370B\261XJ\221\365%pFE\245\211^!T\022\310JI\201J\221\262\301\227\022\365\024\251-5\031\022XJqJq\322Dgk\022"
+	.string	"Jab\257)L)MG9gEA>\262~\004\032S\224R\2244\021\024\257&)I)IG\021"
+	.ascii	"LAJAr\356\330\261\032\341\226\001\364\005\224\365#\200\267\377"
+	.ascii	"\024\243k\212\021\013\b\003\033\377\004\035\301\033\214c\274"
+	.ascii	"\fX/1\260\241\254\037\001\267\375\247\f\r\245\020\261lq\016\023"
+	.ascii	"K\017\250\205\342\f&>,d,%\245\035e\375\b\230\245\370\244\370"
+	.ascii	"\244\004\271R^)@O\t*B<\f\222u\212\212\f\3054|\013\f\314:\345"
+	.ascii	"'[%e\264\030J\222uJ\212\bl9\2438\243\244\360\270,\350Rv\236\302"
+	.ascii	"#\243\255\2111\353\024\235\f\305ld\032s\313:%\207\231\305(\244"
+	.ascii	"*\353\224x9\325\234\303\301U$kg\343\273\202\360\312E\220\b\270"
+	.ascii	"X\\t"
+	.string	">\241@j\215\361\316'>\224\256aY;\235d(!}K\177\021(JL\324D\036\324E \205\323I\350<\254A\3504\274\3630GX\021b\326\316&\031\352\215U\200\251\310\332Y\270\234\322n\214l\213\214\373w2a\342\024ta\213sT\260\356\200Z(\306\361S\006#\250M\251\2711\274<\222\304\310\"\353\257\300d;\2178\2178\227\264G|\316%\311\234\030;LY;\0013TvR\305\202H\326\316$\313\2514\301C'Y;\221\\pE\317\021\246\025\360\266\323\317\351\267\034\313qlcHW\016\247\236S\317\331\307\306\261\001\026\351\234E\356\354S:\341Z\342\312\372\207N\276\033<^3\370\234{ZqW\036\025K>\276'8'\021\270\207\007\022\013\237\254\277\302\f<<MTv\264\202\213!C\340\222PW;LKA\202\310-s\3001\246\r\375\370\321\"\261)<\261\325\220\2568\306\313"
+	.ascii	"N\214\023\003\263\376\n;\373w\372p\372h\221\216?S:U\007`b\201"
+	.ascii	"\025\245\030\307x\031(\001w\304\210\263\276\nN9\247\234\263\207"
+	.ascii	"\005Ptw\366\230\001\220\b\220\254\235s\031\n/\212_\240\np\316"
+	.ascii	"8g\234\223\003\221\243WF\333\320\233\216;w\360M%\t\242B\232\323"
+	.ascii	"\315\t\347ts\2769\337\306\250\322\360\304T\b\333W\341\205\223"
+	.ascii	"\315\331\346ds\342p\342p\336\370\rM\304N\020\307]B\350T\210\332"
+	.ascii	"W\241\310\211\346Ts\242-\307\234i\316\264\345\030_\bM\315\241"
+	.ascii	"F\274\253\254\257\002\317>\004\n\267\323\314i\306H\367\203\214"
+	.ascii	"L\023\005`E\016\004xtu9\305\232\216\322\360\304\2346\356\024"
+	.ascii	"c\332\005\301\002\313\332\031\366\256@\364\321\230\265\263\206"
+	.ascii	"\223\006L8\364\005\230\265\323\313I\303M\221\206\365\343\244"
+	.ascii	"\341\004c\023\242\"\023\202\201\327$\356\253M\221\270c\257\021"
+	.ascii	"\002h\316\027\316\027\316\2551\2764<\261\031wn1\201r(\225\265"
+	.ascii	"SF\213c\007\317\213\254\2351\234Zj1\314\240\262vb9\265\2220\226"
+	.ascii	"\372\224h\301\370\3416\205\007EN\007K*\353XxT\364\341\027\003"
+	.ascii	"\0020\234O\316'\247\225\322\256\352N\253w\320\307o)k\247\213"
+	.ascii	"\344\"\0238\236\254\235T\316)\246\023\025huY;\241"
+	.string	"\234S\313=\036\032N\246\234R-\334\302r ^\001I\201\024\205d\302\032%\256\360\233r\"9\221\234-\322\350\322\360\024\233\356lq\314\323{\353\311\332\311\244}\030I\341\226\265s\311\251\304.\241\203[\222\265s\205S\251\271c\266#P\211Ek\303\006_\037\236\013\033X\2243\t\tO!1D\002\201%g\021{u\0269\215\222?q\274b\203\025^-\022S\2170\316+\353C"
+	.ascii	"\310\371\343\374q\016u\310\243r\n\3359Tc,g,kg\320\273\202\375"
+	.ascii	"\221\303\312I\326N\240\034\244ut\264#k\247\212\034\204\004j\355"
+	.ascii	"\b\224(Q\234>\314E\3024<1g\317\235>LWv\207Y;y\336\025Z,\\\344"
+	.ascii	"\310\332\271\343\324\331\"\302E\226u\263\321\251\303Z!\262\361"
+	.ascii	"8u\2349\307\036Q\n\t\237\2644\262\n\353\234\2616\314+\222\300"
+	.ascii	"`\"hh\330|\322d|\363\311\021\223\022P\326M'\357\212\276 \235"
+	.ascii	"\275\254\233\213M\305\230\256\024;\262n\0366\025\227D[ng\212"
+	.ascii	"\211H;\210q\222f\037\223$+\020\217~\312&Z\205IE\n\0135\321\353"
+	.ascii	"t\224B\220\3757\005/\330\034\004\243Kd\332/z\222\234\275B\231"
+	.ascii	"\275\252\335\360\221\365S\340\341\347\327\f|W\034-y3p#\205\365"
+	.ascii	"\364e\335Tr\034\263\263\321\227u\023\260\231D\367q\315\200\313"
+	.ascii	"\272\371\327L\222F$\214,I\023\211\021\"PfIv\026\215\242\246#"
+	.ascii	"\232o\251\344C\346\306\326\327\247\211\316R\030\023\"\244\311"
+	.ascii	"\247\"\305\227\206'\326\334{\223\217\005\213\235\254\254\233"
+	.ascii	"D\336\025Q/\222\230e\335\324k\346\301N\220\356~d\335\034\322"
+	.ascii	"\314k\252\320i:l\3465\361r\244\204(\236\311\230\373!\327\274"
+	.ascii	"\323`d\\\\=[rrM *M\274\322\360\024\233?\336\0042\324c\324\225"
+	.ascii	"u\323\356]q\254JL|\222u\323\007\253\"g\220F\326\315\271f]RG\217"
+	.ascii	"I\253\256\331\343\t\024\220\330\214\344\213\027Gb:M\245y\024"
+	.ascii	"\3050\246\340\340\232;\356l\201x\245\341)6u\274\271\303\355\312"
+	.ascii	"\202\021\227u3\016\006&SgY7sd3%\270\034NRP\261\335\334\230?r"
+	.ascii	"\034\307q\227\3536\343gP\021\007\016\346\017Bwi\315\311N\326"
+	.ascii	"GAI\363F\363\006\013\343(H\006\357\017\270'\265\254\217B\337"
+	.ascii	">;\3066\331kS\255\271\246b\024\307W9!\030\371\2362p\357\024s"
+	.ascii	"\3664\023<\305(\b\005-\353\2430d\277i\3066\321\232h9H\205X\007"
+	.ascii	"\251\002\"\204(\360\330gsP\333\034k\2165\313<\310\243j\222\261"
+	.ascii	"\327fYU\221\027f(\234\325h\332\250\021\026\306\254\243\322\332"
+	.ascii	"G\301\310\253\t\346\245\211\276\2764\321\316\211\233e^(\364\354"
+	.ascii	"\237\320\244\t\243\t\243\311\005\265\266\365&\227\017Wb\326\315"
+	.ascii	"\0310^I=Y\377\260)\003\016\202v\226\243)\243\031\303g\360E\214"
+	.ascii	"\"\254!\034\020\220\254\265\216wOb$\207P\022,\254\346\325\216"
+	.ascii	"\325X\2735 M\252&U\363\n\304\335Q\323\212\2756\257\302~\310\300"
+	.ascii	"\312\272Y\365\256\030\f\223k\312\272\351\"\2335\017\005\005e"
+	.ascii	"\234\300&%\265\034;\243Z~\025\001ye\375\023\2746\024\324rl\307"
+	.ascii	"n\"\335\tXM\247\246\323rL\002\306\2434<\305\023\240\232M\315"
+	.ascii	"&\016et0\023Yb\220\254\177BR\223Es\251\311b\371\325Tj*-\277\356"
+	.ascii	"\324\241#\200\235\027\323\005H\252B\265\240\254\177B\317\276"
+	.ascii	"\t\202E\315\243\242\346\n$\366\332\\\3214j\032i\2423\2524<1\277"
+	.ascii	"}\023|\250h\006\251h\016\t\261\327\346\020\320\2014Q\216\247"
+	.ascii	"\342\270\313\275\036Au\301\355\233`\243\271\323\354i\3564S\370"
+	.ascii	"\260\327f\212&O\223G\023-\321\231\220\265o\002\022\024f#\224"
+	.ascii	"fN3f\257\315\234(Q4\021\033\033\3051\023\003\210\350u\231\300"
+	.ascii	"\263_\202 \"\323\t\"\223\221\311\230\230\310\\\224\240\ta\032"
+	.ascii	"\236\230\342\231\213H%\261\0309E\203h%\364\355\2270GH\310"
+	.string	"4t\355\230\206\307\035N\026\241d\315,\\N\245\355\304\360Q\30250\220)8A\034\307>\361\t\3051\251A&g\n>\360\275\321$\355\f\354\bS\311\021& \022$L\300;u`\270GGL\300l\365D\207)\236\302\223\242\362\312\372%X\355\227@\204\307\354\303c\372\0319\323//\217Yd\347@\361J\303\023\343;\263\210nB\364q#k\346\336\213\033BLY3\211\3441\344\242\320\215\274\254\231z\267s\357\364\252\244H0\334'\241n\310\020\346\216DB\022p0\2030\2030\177\244\t\351\"\001l3}0}0\177\270\214|ixb\314\037Q\222H!\222\200\264\345\344\230=\bPc-\rO\214\356\314\036lCr)\262f\316e\250\027\006\216:&\304\235#\007s\007\033\3770\322\3518s\307.Rf\b\22553.CU\301\3550\312\372\031\312\214\353\210^\326\177@\037\363\215\371\346\365"
+	.string	"\037\233\211\306Dc^w\254\326\304+\rO\214\271v\346\365L\034I)\254#GY\237\331\266\233x\001\231\312\232\311\306\274\201\254\363\261\343z"
+	.string	"\017\013`%MA\220\230j\031\312\315\322\361\343\23253\355\001h6\230f6\230em\034\263jSEF1\223\321\005L1\246\030\263\214\215\215l\360\221\235Y\366w\371\275e\315\034[\352h\013\013\025\245f\354?\200\005\363\213\371\305\254AH\307\244qf\r\276\265\035 Y3\301\222q\214V\370\200\237\335\325Ee(C\006s\353pm\306\231[\032\306\022\026J\262\031\020R]T\326w"
+	.string	"\221}f\026\313\324bj\275[*\304:+*h\2223\267\317\276[-\023\213\211\325\344H\355\352\212Y\345\342T\213\253\234\272\342\370)\203\026\310\007(F\326w\200\214\3753\247\246\230U\307\237\251x\205\006`jO\031\300GAZ\f\035s\222\212I}gL\027L*\230\216\305\213/97\240\234\254\357\200\026OO\314(\"TPgF%\225\\Yte\375\303w+E\224E\035Y\337\001C\373L&\226\331\202\331\342\330C\204\274\034\007\364\354\263\307\036-s\211\271\244\211\002\260t\324\200&\314\025\314\025L\026B\350\222\316d\301D\016I[\"3\310\02525\244\224\365\033`\204Y\304,b\036=\275vL\2433\217n\307&\3220\324j"
+	.string	"]\212\247`\016\335)\346:y1\205\316\0342\323\221\222Z\313\232\371\303\fB\376\2045]\231AL\240W\005\214\302\301c\234\021\203\210\3251Ud%\314C7%Rd==|\r\260\332L\035\246\016s\247\321\253\001A\373\313(,3f\306\031l\204&tq\006g"
+	.string	"\342\036\001\233\301ZF\306%\224\254\026\n\237\021$WkO\252\\\244\030\313\372\f\320CD\\.v(\243S\374r\021\bnkF\326\313\304<\206\324w$&\027\030\2704\034\201\216\250k\331\344KC\250\225$S{Y/\013\233\205\204\213UY/\231,\t\333\305-\2414\302\345 !\317\327\027\037\007\244\032\377\0043\336c'\304\230\353\310fv\230\226\365\031`#I\222\245\022\031n#\340\227J\240\220FMT\360`"
+	.ascii	"\327\221#6\344D\371\371\361\245\341\2111\300\247H\221e\337\032"
+	.ascii	"\001\316\b\277\354Kz\201U\te\375\021\234\324\325-\367\002\237"
+	.ascii	"\272\206|\271\367%\221\020 \234\t_\212\031?Y\177\231\267\324"
+	.ascii	"\373\223"
+	.ascii	"\331\013\006\214&{y\267\304\273\341\202*/\353\347\021\002-`\n"
+	.ascii	"\371YTv1\312\330\312z)$Cm\236\250?\264e\020\034tw\210\313 K "
+	.ascii	"|=Q\210\200,},\177\f\0265\036\331\375\311w\316j\020,\353\217"
+	.ascii	"\200\267?\002\217\375\021\330\346>\267\244\333q\034\3478\343"
+	.ascii	"\035%A\272b&\243\013\246\350\006\263\376\b`ppK\0365\bw|\311\343"
+	.ascii	"\325j\n\362\225\365\017\227:\232xNvb\350X\306\321`\221\303\003"
+	.ascii	"$^V\001\026\021-s\344\270\0241X\254e\375\021\236\366\2278\330"
+	.ascii	"\245\333u\351\226\205\034\177b\035\027\037\020\241\032\001i\237"
+	.ascii	"\315B\332\2666\370\205\020\252\021T\244\245-\3318t\020\357\370"
+	.ascii	"\345P\220\266dc\351\266^,\267\225\365R-\217Y\371\350\211b<;\313"
+	.ascii	"f\254Z\\\204C\225\206'\226d?\233\261\313\262?\004\b\354uY\226"
+	.ascii	"\315\\\342\034\302\016\016\217\3242"
+	.string	"\370\002~\210\211-\307\330\016\342\235>:\002\330\370!{]\216\025\241\261\225\243\215\006\215e\030\313\032EI@d\255\306\227ayL\260\020M\216\254\253k\371\245\\Z\363\372\362\313H\016%P\031\252i\2031\350k\251\265\324Zn\265wT3\276\334J\224C\214\313z)\303\346\247\261,\353e\214\314\025/1:e\375\303\013\232@W\304\235,+\253e\326Y\243\247\366\214\017\353\313,\270\r\253G^\326\313\027\307\234\037S\177Y/\257.\330l\301V\346'\030\3275\364\227\365\027\200\264\227NwZ\272`\3438\216\231\342\034B\020\240,\251\276tQ\230\224\244\224\365\022j9\265\303\f\352E\326\377r\311dq1I\214<\3656\227$.H\326Q9*O\375?q\325`XO\326\313\247\373\320\021\344F\f\037VP~\256Y\177\001?{\331\244[\031`ebY_\001\212{\271\304\"\321\332\370\270\262\276\002"
+	.string	"\367\222\005\022\273!@\262\276\002\360\314\214\3448\311\2329\203\b\006T\326?{\275\334\362h\255+\216c'\fh\270\343-\353+\340\207\232\273&8\347cI\264$z\257\354\370^\305\302(\271\254\257\200\033\373_\246\270.S,\205\222?q\2144\001\221\2654<\305/\203\276\024\372\227?K\025,\035\223\037\264\250\254\227@ \276\frq\003\2611\353\003a\237-2\b\373l\257"
+	.ascii	"\032\373_\362|\351\363\277\\\313\236\3544C\220\017#\200Y\037"
+	.ascii	"\273Xh\273\334\001\361%\017\031\020\302(Y\203\300>\333e\316\356"
+	.ascii	"[\274\272"
+	.string	"\313\372\n\220Z\306p\024\004\304}]Y_\001JP\026\017?\371a'0#\037P\324S\326\272\213\205\266\277\262\317\026V\004qx\221\210k\211N\326\307qx\366\n\037\302\210,[\234\363\306\021\306\210\002\003\022\331x\001\237\351\260\243\313\372\n\330i\322d\033&yb\235\246\013\\$vO?\262~\002\220\354\037&\204\t\337;\225\237\335W\2658x\370\004\t]\326O@\217\375\303\202\202[\361\310\023\353\264\250`\314\313k\356P'\353' ,0\020\376q\301T\254$\202W!\223#\025O\330\262~\002\262\366\017+\201\225\274zI\236X\207\351\002e\214\"\177vY?\001JI\222\300G\264+\247\210\310\225\365Eh\262\177\330\b{\205\215\300GT\230\212\223.8SS\202\326\024\273\303\033\204\217\374\260\037\374\267\235\344)w\351\310\f!Y\257\250\261\317\366\"\360\330?\\\004.\362\006\"yb\235\026\0374"
+	.string	"il+\353\213"
+	.string	"\266\177\030\336{\371\224?,Sa\237\223A\267\251I\322b\326\027a\205\236\036\214\307:\325\342\252\274\2718f\312@\357\210Q\004)\353#`p\377\360\035{\205\357`\274\016\3308\356qC\311\340\232\342\323\017\236\353'\230\242\353/\353# n\377p\220 \260\020\226-\316\001\201\356\313H,\216\23728\326q-\"\345\247\267l\310\217\220\254\217"
+	.ascii	"\262\375\303vg\257\260\035\374\343\202\251\002|1Q\n\022\307L"
+	.ascii	"\031\270QN\201MqFw{Y\037\001"
+	.string	"u\354\025\256\333\206^\204\215Jz^9*\262>\002\2066\334\343\177\005a\272\322\031\022Q+N\013\002h\331\257\264\032\225\316H\251Mk\315\364\350\342\246\264\250\274P\017-\316*\354R\025@\3154JM\272 ss\264\326L\341\233\326})!\255>\255\323\232\025\226\"h\250FG\314DM\260JE\304TSV\200i\244-\230\220\231\252@\003L\324\372r\303T\304L\324j3\202\006\230\250\265\312\224\3360\025!\225\211Rm\254\"Vn\342\003\215\r\365F*}\221\3360\025a\225\312<i\250F[\250\276'X\245\020\200\261R\231\326\027\345L\024\306\206\205\024\236Rk4\006\023U)\265\2044\206\0231\264\250\304DmX\260Je$\200\316\314HM !\225\211Zgl(\200\202*\265Z\243%X\2451\322\233\033\033\352\tV)\004<TI\260Je\2407Xa\2266#\246%\24616452"
+	.string	"\240*\275\001\305L\264&*"
+	.string	"\030Vn\342\303[\205\255R\031\230\032\225\316\230\240b\225\212pB\253R\231\024\252\364\346\006\307\306\352Vch\302)\204 \301Z\215\226pO\240@cCM\301J\225\326\340\002\245\211\272 \205\251\221\316LE,GPmRh\271\211\0170Uz#\225\222hOHcj\246/15\323\024Rnh\2347qS\201T\246&j\002\306%j\215\236\020\203U*\243r\023\037\254\321\031\034\230\231\250\t6V\034\022\2426\326\251^AQBL\315\264\204"
+	.string	"j\24476K\022&<I\230\340\202\":#\215AJe\2262\321\021(J\260J!\360\302\nJ\353\264f\205\027Vh\255S\345\013+\300"
+	.string	"\201\027V\200mXxa\005}\023\037l\246.S\025^XA\243\270q\253\260U*\242\272\002S*\003\237\230\266\020\023\265a!\205\372B\303\236\211\302\230\260Fi8\260Vkl`\2203-\r\325\350\b\002\224\200I\261)Q\263\202\214\263\005\032`\244&L\310\300\372bU\332\224\250Y\341\005@\265*\255\221Z\243,\310\270P\245V\3534\0026T\024\020\260Je<xx\266\360B\f0\240\200\302+S3\265N\243\0258\021CLTY=\301%FJ\305\251N)\210Y\341\204M\t(J8aSBL\315\264\004\363&>\330\300HoPP\020\265\261\226\320740\325\030ffH\250"
+	.ascii	"\247\005\030bj\246)\020`\006\307\306J"
+	.string	"\265V]\351\213\362)\235!\021\235\231Fk \301J\265\201\241\332\301*\255\322Hi\332)\215\211\352\264f\232\202\315\b\021T\233\024\254\323\250\r\005\250\261\301&\306\212cB\204\315\210\226\230\232i\n27\255JL\215\364%Z\303K\315\324:3\305!\361\362\342\254\221\316P\255\325\226\332rC\003#\255Faj\250\326\352{\023\037\2447(\2540R\230\350M\265:ue\246%j\336\233\370P\275\221\341\300f\272r#\263\202\342\006\206F*\025a3\255\231\336\354\233\370\360R\255Ui5\nC\265V\2257404R\232\326\204\001\324H\251T\034\023\254R\031\016\325\227\233\022\326\367&>\220\230\316\304Lm\254Q}\023\037Xffpjjlj\\\033l\250&\25465n\211\250tFK\25187\232j\002\206j\255\266%\264\334\304\007\233\0225\323\027\016`JX\253\323*Uz\343\274\211\017%$\330"
+	.ascii	"\210\fx\300"
+	.string	"\001\344\313M\t\253\222\031S#\275\271!\241\031S3-\021"
+	.string	"\231h\013\321\022Z``H`\261\241\242\200@\013Uj\255Aa:\003\263_\2444Sk\r\016\213\025\006&z|\336\304\007"
+	.ascii	"TE\3044\233\326\224\233\370\300\302\210\025Dp@\003\214\315\214"
+	.ascii	"\tR\252\215\t\315*\2165jM\3021+\240(\241\005\253T\206\251\362"
+	.ascii	"\252\2648$Lg`\226p\211\022S\027\305\215\215\t*(nlLpJi\242.\304"
+	.ascii	"P\2436%0W\24630\312\230\025\250R*\216\025&Z\002\247&\332\302"
+	.ascii	"\363&\332\302t\006\246\215Y\001\007F\205*=\261OL[xc\2444\324"
+	.ascii	"hu\032\3632\235yAZ\245Fo\234p\007\037N\304\254`\255Fg\230158"
+	.ascii	"6\"PDg\\\254m\253\302\241*\215\261iae\251\262B\215R`:\003\003"
+	.ascii	"\357\225\231\031\022nhpb\22620P\243\024\270\231\221\2520\235"
+	.ascii	"\201q\251Q\nT\341\224*\r\325\350\b\351\314\024\006\025<Lg`\224"
+	.ascii	"R\232\250\013V\245\324\032=AJ3\035\221\274\211\017\034\304\314"
+	.ascii	"LqH\304`\235B\300J\2651Q\245@\211\344\236\316\3004\335\351\f"
+	.ascii	"\f\263Z\225\302T\253R\030\t\254\323\023(Lg`\334\030\232+'pH\270"
+	.ascii	"\211\266\260\253"
+	.string	"R\232\250\0130<\023\235R\253\311\231\350\364\265\251\201\272\225K\251\n5S\026LT\243*\300\322\030\233\026\24630n\f\r\314&\361:UH\230\316\300p8\021\003M\324\005k\315\224z\223\274\241\3019a:\003\2232\235\201Y\211\221J\255746\311\344\206\001\005\325\nM\306\324LK8\021\303t\006\306\251L\231\316\300@\227%Lg`V\336\023(\304\020\245\200U*b:\003\223\264\201\001\002\323\031\030\025\246\f\224\3032\005\307\006G\206JB\314t&ZC\315\n6\330\230\0201\235\201\231@\246fZC\215V@\202\022\322\232)\013*\324\351\f\fs\003 2\020\202\003\310(\005\232\316\016>X\251\321\233\017-\260\315\b\231\232)5zCc\003\363\254J\24776&\330\214Xa\312\324Lc\24263\315gL\215\224\372\"s\363\362\222\022\265\231\201\255T\233\352\r\004\24630)20\334\340\320"
+	.string	"\023%\301\224\306\330\264 BZ\245Fa\230\316\300\250HE\310\334\260X\2452.+\322\252\f6#`\260JeZDH\255S\252\r\314\252\f\225\204jU\ncC\275i\221\241\222`=!\255qkd\246U'\r\325\246DM\213\264\206\250\b)5z#\245\336\274\325\252\024\006&\332n"
+	.string	"D\006@p"
+	.string	"9\301\224D\364\245\206*\212\252S&\032\255\341\345e\031\255\241\204\265fJ\205a:\003\363\316DkLTqfR`\241&w\f\325\246\002V\251\314\222jC\245\242\220\"\205Q1\001c\215\226\220\"\205\211\336\210\270\231\322PM\242\260\336\320\240P\235\272U\251\025E\t7Q\033\252\311\352L\024\307\003(P\2550@\255R\231\244\325j\215\332\314\224@\322LM\210\230\316\3000\245/3$\242\325\351\t\321\025\351K\314\n*\035\240\022\240\270\2611a)3-\221RA\007\001\240\270\2611\201"
+	.string	"\025T\251R\253U\312\002\f\325\331l\301C\325\004i\214M\013.\257\232\210\352\022\254R\021\322\232)\0133T\253\t$`\224\326\227j\013\322\027\252\264\306\206\027\252Rj\223*\245\301\251\212\240\261\261Vq`"
+	.ascii	"`\275\211\017\001\220\261\261V\247&\336\247\325\372\"\275aZm"
+	.ascii	"=\f\340I#\265VQ\210x\251\266Lg`\222\326\252\024"
+	.string	"\307\003\322\030\250\322\230\250\315\214\325\306\206D\213\364\245j\235\301\211\226\220\236\020#\235\336\330\3008o\25480Lg`\334\303L\251\322\032\251\314\376\007!l\020\202\b'\\\351K\314\n\322\033\024#p`h^\353\r\rN\314+}\031\301\274\211\017R\232\251\325\032\215yy\251Q)\nm\302ZcC\203D\021\2159V\25186&\220U\251\025\247fJ\343Vcjl`\244U\267:\235\231\231\322\2647\361A:#\205\201\211\022\240\372\002\003\023EZo\342C\001\2547\361\241j\302\032\245\241a\253//7%\236'\246Tk\264\005\253\r\225im\276\2707\361\301\n\203C\265VCT_NH\25584)4\300\330\314\274\274\264/.UZc\203\315\313\213[\245J\25385//;\246fJ\303\313K[}qg\244//I\353\213\265:\235q\336\240\260n\020#\245FMT7\340\240j\235\222\340"
+	.string	"\247Ff\203\02385\323\231\r>\b\341%\004\021Np \215\301\231\201\251\231r@\255\342p\220"
+	.string	"\353\ti\315L\264\206*\265\326L_b\242R\252\t\353\315\313KK\rR\352\315\313Kk\255Ng^^\332\2505\032\363\362\322Jo\230V_^Z\032`lf4\214\224\372\242\264NkV\250I\301:\255\231\266T+\f058)\304D\2451\300\300\220\260R}\251Az\002\fLt\327\244\020\023\225R[k\365ez#b\005\030D\274R\230\232\250\265Z3\335\326\227\027V\3205S\030j\2520\355\364\246z\254\276\230\020b\205\327\204\020+$[\230\020\323\343M|\250\342\220\250\276\264\020\343\244J\255\325(M+\255!:#\002\347\206f\343\274\324 \215\251\342\220\330\325\027)\314\264\006\351\tU\034\022\257\364Ez\203bD\025\207DRz\203\302Z\305!\341VqH\034!"
+	.string	"\342\005\006&\332\332\020\215\301\204\023Hh\2557\361\001\347\206\346\305\206\212B\006\006&z"
+	.string	"\351K\f\035\200\320A\b874\317\031\233\252\224\252\254\276\254H_D\340\334\320\274\255u\006\247*\215\241\306f\212sC\243\"}\251\221\231\316D_\23052\323\031\022``\242\033ELT\032C\324\032\215I\302\300DaiLuZ\203\224\nS\24533\323\022\355\r*\314\334\320D\253\260\t'\220"
+	.string	"\003\023m\24505/X\253Q)\013V\022bd\230\221\302\300\220P\235r\270\211\0176T\0242\034T\2516\325\032i\025\036!\255\301\246\005\033*\n\231\tJ\334\314\230H\241VK\274\230\220\231\232x\221Vq^l\254\357\r&\2327\230p\202"
+	.ascii	"\021\342\345\006\023+!^\254%l\252.6DQ\2744m\260\231)A\225\326"
+	.ascii	"\360\3022%"
+	.string	"D\265\032\275\261\301fF\005\005UZ\203\r\214\224\232b}\251\231\336T_l\210\242P9\201\304t&j\202\r\025\205L\313K\211\233\231\347\r&^NDMXc\2466\264x\340\275\301\304K\315\224\306I\265\261Fi\246\326\252\364\371b\002\306jS\363R\203\"\246\371bCE!\303\022#\265\302H\255\322\023\2526T\0242\313\233\370\300A\211fUJ\305\261F\245)\3044\227\322\030\233\026\222/U\033\242(\236\326\032)\fUz\363\322bssB\372r3\235)a\242\032\245\3020\255)T\253\322\032\033+Nt\245\372\362\214\221\3360\235\211N\255\323\232\025R\254!P\344\352\013\263\003\022\031\004\211\034\202D\006\021\315!\242\031\304\211\034\342D\006\201\"\307Dq<0%\001\343\274T\2557\361\201\203\032\033\032\032\033\030\032\330\352\313+\265F\255U$\b\353M\262D+}Y\301\245\251\"\201\364\345\004"
+	.ascii	"HoP\254\210hA\001S#\305\361\200\224\232\202\t\034\2444Qj\n\326"
+	.ascii	"\233\370P\235\261\241Zkl`\252/"
+	.string	"#\250R\353\3144\005\0210T\thp\252Gk\r\216\r\fR\246fZ3\215R\255\273:=AB\262\305z\023\037\25487V\034\233\266\372\"\245Fm\210\241FUh\226\220\236 \275A1\342\245\205\025F\2744S\353Q&j=\272\322\027\031\250R\232\251\325Y\225\211\316\244 \225\211Vq\224K\353M|\340@\346\206\205*\245\231\216\210\221\262\324 =Aj\215\306"
+	.ascii	";kl\246U\252\264\206\232\025hl\200!\205\306\006\030b\24405(\252"
+	.ascii	"52H\2538Lk\225\212S\202\264\212\263\034\221R"
+	.string	"mgl`l\2546T\030\254T\233\233jM\224:\202E\246&J\302:-\301jc\242z\202\264\212\323\254A\032s|\301:\225\231\306\260\324Li\336\023Q\232\027\246fJ\243\234\261\201\201i\255\276He\242U\031R\224\322\227\024V\266\325J\265\271\321\325\027+\325\006\006\023286T\023\326j5\nCK\3144\307\340DI\320H\255U\024Uf\314\364\246Y\303\324\n\023M\221\306\330\320(\2530Sk\365\205\206j\324\332\254\332\300\020\202tfZ\302\206\n\203\324\032\245Bi\200\261\231\201\301\271\201Y\302D\251\020\250y\201*\265\301\346\206%\206\032\265!\321\274\301D\013\322\252\211Vj\215ZEPqT\244\326h\f\322\033\2464S\353\315\013P\231\232)\r\225\004\032`\246V\021\322\024)\216\024g\002\322\232\351LLTz\002\213\325Z\203cc\202\262\006\205j{\023\037\250\322\031\234\030\251\t\230\352"
+	.ascii	"\254[J\023u\201\206jt\004\t\234\352\033#\235!\021\255A\241:M"
+	.ascii	"\242\260N\2516S*\f0Sk\324ZeVe\200!FJ\235V\2451M\353\013\315\324"
+	.ascii	"\372Z\253Rkt&\345D\224Fe&j\265\261\256\324\330L\25580\322\023"
+	.ascii	"(\260D\2553\322\023\242*#\24430(L\220\312D\251\322\032H\220\251"
+	.ascii	"\231\326`C\343b\275\221Z\253ZZ\"Z\235\231FS8A\345`\275\211\017"
+	.ascii	"'l8\270\251\322\304\254`\255\221\326Di\250\322\233\267\372r\302"
+	.ascii	"\206\004\022)\245\211\272p\302\206\204k\265\031\021#\245\241"
+	.ascii	"f:\263\253/56S\3534\246\306\306\204\032\233)\r\007\351K\314\n"
+	.ascii	"'lH\2701+HclhZ\351\313\0133\225\261aA\032cC\223\264\312\334P"
+	.ascii	"k\252/'\250/\322*\316K\211*\025\246y\202\252\274\211\322\300"
+	.ascii	"P\221Ti\314\264\006\033\352M\214\364\0045\345\204t\346\006\347"
+	.ascii	"\204\0223Q\023Ji\314\224J\225\326`\363R3\235\300\372\342\312"
+	.ascii	"DG\330L_dpfn\\Rbj\246$^\254\321\352\013\r\016\325J\203\364\246"
+	.ascii	"*\001,\235\211\302(\255Ti\r5S\030j\314\224\006Y3\245\3314\300"
+	.ascii	"HM\300\234\210\322\354fu&ZC\215\315\324\032\235\261\271\241J"
+	.ascii	"\2555+\300P[\252R)UFz\202tF\246\206\004\232\250\t5\334\224P\211"
+	.ascii	"\231\2611Q\225RM\214\220Z\2435L\2550$HclZ\240N\243.5S\030i\025"
+	.ascii	"\347\345D\224\346\345\004\365}9\201\023}9\021\245iV\2516T\252"
+	.ascii	"\024\372JoPXS8\224(ac\305\201\t@uz\"\372\"\203CB\032\323\"\275"
+	.ascii	"Aa}\221\3260\265Fk\230R\2451\036\2506V\230h\211\027\033+N\364"
+	.ascii	"E\246fj\302jcCS}\201\241\272\304\330L\251\322\233\227\02273/"
+	.ascii	"R\232(\265\304\013\f\265\3722\255V\251\034b\246/"
+	.string	"\326i\r\3162\304\314\tj\265i\255FK\274\340\220\2502\251Q\0230\023\340,\2557\361\201*=1\245\351`C\024\305\261J\265\261\332\320\300\322\031\253\325\206j\302\272gfl\250\332\004\214uz\203\264R\245V\230(5j\002\346\305jcCBJu2Ul\246-(\250V)\215tFjmQ\241\241\032m\241\306fj\205\251\301)\001K_V`\271\251\322TodR\254Qj\fN\224\304\313\t\033\0224\300DgH\260T\25167\357\r&^\244\326(\365Ej\215\306\334\340\274Xil\250)\304P\2436PmJ\250T_h\242\324(\f\325\030i\225*\255AJmJgbb\2464\255\265\312\201\325\204\314t\246D\365\205*=1m\301\246\006\252\264\n[\2452\324\250u)\205\241\342\330\210\260\342\334\324L_\2515J\3251R\351M\025y\302\206\304\321\372\022C\0033\235\201\331\207\326\244"
+	.ascii	"\307\324DihlL\230\316\300(\247T\230\2524\346\255\312P\243\332"
+	.ascii	"z\023\037\252\002\220\316DaD4Sp\242M\251LM\224\2124\001c\235"
+	.ascii	"\332 \342\004N\024J\225Zk\244&Xk\2444\326*N\007b\242N\353M|8"
+	.ascii	"A\345\340\004\325\204\023T\026\353M|\220@J\023u\001Et\346\246"
+	.ascii	":\215y\25563\323\233\245\365&>x\240J\247%\246\326\032i\314TY"
+	.ascii	"}\201)`\245\332\300\340\254\241\225\276HclZ\260Rmn\224\322\030"
+	.ascii	"\033\032-}y\301J\265\271YVkl\246\326\033\033Wj\215\306\020\203"
+	.ascii	"\023%\261\2457LEHo\230\212\330\326M\205c\242R\025"
+	.string	"f\246\321\021Ti\211\0228%\234\260\302T+\f.J\252\025\006i\rS)\2144\006\017\326\227\252\fR\232\251u\327DoD\234\2402\243\326\350\t'\250L\252\025\206\025f\242S\252\264\n\245\001&Jbf&j\202t&f\n[o\342\203\314\r\00727O\230\032\234\024\254\322\2524\006\231\233\267\246D\266J\253R*\262\372\202\202j\255Ne\2441\310\334\300\322\033\246U]\255J\25111Q\027\305\215\r\214\246Zo\216\326\233\370P\225\306\330\320\274\300P9\200)\301\341Fj\025\021S#u\253/R\231\232h\f3\322\232\232\250\t\030\346\215\324*\302J\215Z\253I\353M|x)\201C\202\203*UZ\303\224\0323A\324\032\215\321\325\027\352k}\221Z\247\324\n\224\300!\241\244J\255S\252\r\255\f5zDa\235\302Do\2420\333\032\315366%\274 [\253UZ-Q\302\246\215\221\322"
+	.ascii	"\023\275i\253/R\234\231h\r\323\031\030%5j\002FKi\2425Zz\203\302"
+	.ascii	"\252\25583Q\nLg`\234\326\227\020\036\234\210\266\020\302\003"
+	.ascii	"\234\326*}\231Q9!\215\251YA:C\"jUJgHDG\2600\235\201a\271\301"
+	.ascii	"\241\301\306f\246\265\246\270\255\365D\224\346\330B\315\264\205"
+	.ascii	"\351\f\f\007\353K\b \2545S\234]3\2459\306Hkd\246\325\032\031"
+	.ascii	"NDij\2464Lk\213\"J\245\2220\235\201aA\021\245R\243H\353M|\250"
+	.ascii	"\312\324L\255Vi\265\303mn\244T\016\25466T\016\336\252Lt\246\004"
+	.ascii	"\262\372b\002\013\"\24630-5S\232\244\t\253L\215t\346D\224&)S"
+	.ascii	"3\245Z\253\255\365E\004k\315\024\307\255\332\334X\247$Z\231i"
+	.ascii	"\211\032\033\230\326\372R#s\203<\b\020&L \203\013\020\3300\037"
+	.ascii	"\24630\034Lg`8\250\231Fi8\200\241V9\370\260R#ss\374\337\201k"
+	.ascii	"\345\005\023\224\255\274\255\225\251\020\177]C\035f0{4\203\240"
+	.ascii	"\354\234:\310`Qc\201\24451\351\360\242\303\213\016ZB:`\275\203"
+	.ascii	"V\007\030P8\310\004;\300\350\220\265L\333\242\273;\366\345e\275"
+	.ascii	"\325\f\355\277\303\325\322\020^\324*\302\326A\252\203T\207*\270"
+	.ascii	"\016S\357P\325\301\305\233\002\307\217\031.:P\005!\016"
+	.string	"\236\001\226\261\035\356\277C\324\363\355%J\264;\352"
+	.string	"\325\242\343\223\303\260\303\323\322\207i\350\204\346\324\301\251\305\247C\213\245\320\222G\021\220\255CS\313\320\213\265\270\003S\263,\b\032\021\241\254\306$\322\303\216M\251\271\226\f2\364\342c\221\244L\303\272B;z\207\244\277\003R\207\025\212D[~Y#\365\330g\333\301\b\304;\034\305%\346\261\310\372yE\035\210\204\226\350\350\021z\007\242\3775\3540\224\235f\350Q\034l\314:\377\260\3206\377\201x\007\2415\274:\236\240\016@G\"\264?\277\016)\336\001\350\357\360\323A\305N\316\213\274\254\217S,\264\375\200}\266\035|@\274C\212+\"\303\254=\350\320\323\201'\017\251u\035\351\220\363\016<\177\007\235\016;\2079`\364d}|c\241m\002\330g\333!\006\361\0169N\324\214\202d-Bc\224d\343\225\030\025\3439D\3719<\341"
+	.ascii	"\205M\333\342\243\313Z\3139\001q\016\214-T4&e}\036\213\034\024"
+	.ascii	"\331\0310\246\226\034\236\203\342\317\001\221Cb\263QJH,\353V"
+	.ascii	"Q\220}\266\034\fA\234\303!\262\313\205\023\217\254\317\204C\223"
+	.ascii	"\224#1G\222H\025\246\0045\211rx\t!t\212\365\250\371\r\266P\216"
+	.ascii	"\215\365\360\020t\016\375\300\375\2211\201\021\233i)t\324\bl"
+	.ascii	"rm\2547,\037K\224YH\366\2608(a\326`\002\201\033\n\302\341\b\207"
+	.ascii	"#\034\222\210q@r\016I\2344\332\\\250\020\202\267\215\030\341"
+	.ascii	"\340\367\364\201\237S\311L\206\223S\326\247\251\343\300\307\201"
+	.ascii	"\217C\021\326\310h\001A\2041\242\024i\312H\"A\311q\230\365i\334"
+	.ascii	"\366\317a\357u\313=\202\215dD\240F\002\227\214\234\364\234=\350"
+	.ascii	"\212\326f\344\301<M\"lP\b\361\336(\313\301\"k:w0\323;\2653\343"
+	.ascii	"\310\220\267\215\215\333\033|\023\302\241nH\024YN\220\225\270"
+	.ascii	"\355d$\007\037\220\0259 2(Dj4\334\304\376\354V\200\\\025y \371"
+	.ascii	"\200\243\236t\242\360\310z\305M#\r\227\212z\254|\261BR\344\351"
+	.ascii	"\3209\373\242l\331X1\267\022\3264\262\227\310D\216\203\016\244"
+	.ascii	"O\223/%<V\326X\255(\301C\016;`#\"PZ\024e\275bv\027wk\357\213"
+	.ascii	"1neF3J\006\217S\2168\353\341\337\0168\036.\036\013\265\2577\026"
+	.ascii	"!4\342'7\370\311\265H\356\312B$\203kV\016\034,\200.#\033\223"
+	.ascii	"\3006\016c\371k\213\206\323\r&K3\274146\226\301\343\235\\\r\033"
+	.ascii	"k*MTx\\\034\324T\216\\\027\213>K\034\322T\210\002\277\222\320"
+	.ascii	"|\030 \205\320\334Ybfr\243\201\303\214NE\024\023\3062\025\236"
+	.ascii	"M\225\343G\214\214%\312\215,+\242\254Y\374~lr4|\026\303\3617"
+	.ascii	"(\006\353P\036\n\221\321\260\3014\204\335\310\200\f\205-\331"
+	.ascii	"\266\216\034/f\324Xd\006\266\005\"\241\001-T\312\370\301'\b\346"
+	.ascii	"|\262\274s2\243\372J\221R\252h*\222\304\313y\270\377\226"
+	.string	"|]9t1\267d,\005Je\315a\213\303\326r\354N\035F*\032\033\373\3470#\205Q\206\023G\214w\211f\225D\211V\n\230\222\305\r\037d0Rd\ra\305\312\253\r%o/x\222<x\256RWCU[grV,@M\302\031\215HU,G\232\256\210\217\n\027)n\\3t\354q\240Z2\305\265\375\320\231\202{\260J[}R\034\244\236I-D\3155\341\020U\b\3447\004\225\363\304\\L\316-\201Rsb2\266P\221R^1\301\353jZ\206\355;7+0&\370G\222i\3200m\211\305E\222\264\306D\016JPfl\210QYs8\342p\304!i\206\006^\205L\224\0249$qX\001f\344\211\020\016+8 \035\231\214\314}u\331\331\300\332?\007#X\b\325\f\033.\262N\301iE\035\007\242\346\212!\026\032\272m\311\"\024\241e\013 \035CK\034\202\234F\212j38"
+	.string	"\255\b\"\t^9\250X.*\357\006\033\2138\374\254$a\334\001\305\301\347\034R(\031}\364\031\311\232C\017,U\245co/k\016<\317%W\027*\3468\354\2540\372\230r\362\303A\347E\374\261\350\304\2265\207X\357\310\037\222\254OS\265\177\227F\025\275\343\021\033H\272\242\244\b\261\033\032c\204\302\262\345\207\304\327\363\004\266b\263\246\246\366\030\227}%\024\n]9a\321\252\202\313\n[tI\254\332\005\341\221\265\332\224\"\220\216\254\237f\220:dZ\202\270\362\307\345&E\344\260\tD\306U\332]\326\203\203.M\222\020\021\336\245\211Ka\rV<M\205.~[\212Jd4@.L`"
+	.string	"\311\201\221\365it6 \240\313\022\2771%wY\322\254\013\002\3075h\304\210\013\222\nx\342\330'\276\241q'n\020\211\313\221 \\X:.G\\\376\222Jt"
+	.ascii	"q\371\373\177\027\277\031\344\336\350\200j(\326\310\3723A\366"
+	.ascii	"\357\322\367\336-cp\305\340)\322\344kaE%\225\265\013\021\227"
+	.ascii	"\275\273\360\335\205/\273\360\035\033\033\3333#n\255\020!.y9"
+	.ascii	"\346\206\334%\317\005/\306\213\027O\\\360\\\356\230L\354t\022"
+	.ascii	"\341\244\216pl;;\027 Y\025\244\035\375\205\375\270\013\220f\236"
+	.ascii	"X\231\213\261\375\273\370x\2010\305\226\354\336\364\316\220\025"
+	.ascii	"O=\236P`\246\236\2675\272\025\025\315\266-\030Ms/\037\ff9x\344"
+	.ascii	"\232O\336&\215\207tqq.;\374\224\314\351\270\313\216\246b\216"
+	.ascii	"\022\305\256\253j\273\270\271\270\271\300\361\270 \215\352\313"
+	.ascii	"H\361\355.pO\306\345\213\2657\0343>\373w\271\262\260x\227\316"
+	.ascii	"Z0\341`y\"\024k\361\347\322\226\322td\343\206\317&<T\002\225"
+	.ascii	"\226\346\262\226\314\211c&sjwYci\3223l$i\302d\227\225\271\234"
+	.ascii	"\301\320\300\213\260Q\311\354.g:m\337 \024P\336\376]\310\376"
+	.ascii	"\230HZ\3200\034[!\312A\354q\021{\003\363\216\020\2500\027\033"
+	.ascii	"[v,\266p\270\200\271\200\271\324\210\321\301\230\027\031\242"
+	.ascii	"\013\215\273\324\320ZZ!\231\032\323\261\177\227/\250\016\216"
+	.ascii	"\247*\027/\250\217R\316\210\017\254.h\321\220\036\277:\027.("
+	.ascii	"<\304\225\242\307e\013\332\324x\005\234\001\235\252#\023\242"
+	.ascii	"\226\265\313\n7\f\210\355-k66\307\r\3067\255/\225\372\306\376"
+	.ascii	"`@_,\325\242\214)\311\202r\275kGBtX\257\234fR[\334z\001\r[\002"
+	.ascii	"\026\0352^\301e[o\202V\320\262%\217\250/\254*8M\007N\017\212"
+	.ascii	"\013\370\206\324\221\241\232\013\025\334\324\024\273Z\013s\231"
+	.ascii	"z\353\236\030*.JAq$\345\351DAu\b^y\220A\30184\016\034^FO\320"
+	.ascii	"9\226+BE\027\247\247Vr\352\t\222\r\227\026O\032sEi\327&\346Q"
+	.ascii	"sP\361\260\215\t\372\343X\330D\026di\245\310\f\302\262\254\254"
+	.ascii	"]\222\216#hlll|\022\307:.I\331E\311\205\305]\222\336t\221\210"
+	.ascii	"\375\350\2641\330!\0255\262\\\220T\2360\211\320vt\270\034=w\006"
+	.ascii	"\017\351\\\214\236F\030\307\310\032]\210\356R4\207\307\226\265"
+	.ascii	"\313\320rE\230\n$Y\273\b\265\204\202YFF\\\202\236\2039O\310\023"
+	.ascii	"@\027\240g\242T\032\214\035.*\236@\322\032a\270\374\274zAu\210"
+	.ascii	"B.)\232\201ZGR\017\235\013\217\013\217K\217T\005tk\211L.=\177"
+	.ascii	"\b\020\232I\356\312\324\022\263>\ri\373w\331"
+	.string	"\321D\222\201\214>Z.:\315\301(\030=\177.9\317<:,%I\262vW\344\251 [\211n\215\360\221\2671\206\341\215(N+7\007\027\221:'NZ\236\210up\246\246\004\215\361-O\234SGi\205>^\354\277e\361M2%u$k\276l\226\243\265\225\270\302\342\210w\310\207\205\270\322b\351\302.\t\307!\263H\363H\326\f5\303\024\255\271\0268\304Z\232\300x;hx\205\232\bH\242P\021B(\236\316\226\235\320\340W\233\024f\224\005\b\330\302DH\007g^_FJ\336\302\244%\320\210\023\220\262\226\300\226%l\021\0219\270\025C"
+	.ascii	"\333h\360iA\242\266\364\371\021\373\313\372\035`\322r\344\257"
+	.ascii	"y\265\347#"
+	.string	"\311\207\037|\005t\303;3\242\"\204\206$\213>}K%@\362\320\004\263n\311k\311k\341\273\212N\f\245\023\"\256.\305\230)\351\202\277e\357-|>K\f\213d\335B\344v\233\021.\315H\326-\0350\262\377\026<\025:\327J\207\017\221;\277!\257\332\213>\251\261\026!\257\220\252\036O\262\326\3335\222\304~\200\274b\307\026J\200\320\370\361\2365\311\256\254R\3301\005\361\352\336|\260\200\311\256\242\035?\352Rx\222\200;b\370\364`\016\025\016u\271\321\245\020I\251h\324\313ZN\256\005n\205\2348>\306q\024cW\007\366\366\337\302C\205\260Y\304Jgk\307\022JK\334.\213\253\361\226\365;P\267[\334Z\334Z\340V(\232+\234Sly{\013\334QH\213\024_\035\320\261\377\226\253sI\020\027Un8\232;\224hV`cm\313,\020x\206r\334x\266!\365\214zp\2601wh"
+	.ascii	"\221\r\2551\001\365\024V\236\233\232\n\337\273\245\326\243'-"
+	.ascii	"J\003E\356\312\320\336-&\333\330\213\267\263\255d\214\227\305"
+	.ascii	"f\306\\\\\202\206\244\214\311\"i%F\003J\313\330[\310\n\225\250"
+	.ascii	"\234\262n\261\321\"f\243+G\222\254\231\200-\351\201\226uK\215"
+	.ascii	"\226\260fV\027\\\335\005?\330T\244\241\b\330B\343YDT\306\370"
+	.ascii	"\002\fFR\"\344\307\343k\207n\252\363A\345\345\024\2243\204\222"
+	.ascii	"\265n\022\025Y\033\342Z\272P*c+\333\202W\270\325\335\350\312"
+	.ascii	"\332\214\217\354z\225\341\334\321\327\003$*\353\334\344"
+	.string	"\020\313/\353Ad\243\2153\037\030\314k\276\236\341\230\221\005\277`*\016\361S\201\365$\333}Q`F^,\367\226n\204\200RW-U\212;\216\304-VO\265\226j\005#\\\213\213&\251!\201Y\277\003m\373o\241\242\263\221e\003\261eJ\005\3150F\237\224J\327\022#\032`-Q\3131\270\246\254\252\026(\346\217\250\271\277'f\3316+B\230\343\264\344\361g\246B\261\205J\025\334\324\370\265\242\3518dY\304\252\207\037\023,\327\036\3150bd\351\325\361r\344\345\247\324\244\211\024\007\270\305\002\353=r\305\203Kz\267R\317Z\323\212\026ny\bX\225\242\005\351\215{\201#\007\213\226\243w\254\312(\311U\326-E-E\317\244B(0\244}d\216KF\326\357\300P\313O\313O\313\320\340\021\244\346\016C\277\245\026\241\267\f-u\340\250\312\321\225uKP\346\252\372:\032\222u\013\320\355\320\334X"
+	.string	"f\335\242\"\347\250b\nB\2326\266\360\264\360\264\370\200i1\211%\017\007\223\376z\336\3423\305k\211[\342\026\2350\245-&d\030\022\035\216\226\234\267\3504\362\341\300[\352\200\271\350i\222\365\2479\240@a\211\3422\225C\bB\024\250\030_\212\307!FyiQ\336&M\343gM(\353O\237\030\031\315\272\272\222\236\220d\375i\321\342\"\013\335\005\210PXd\033\244\240:\323CDdIt\331\261YW\2160\035\246\304\327\211\222\034\214\241\254o\002\216\305\220\305\220\305\007\022T\325\023U\343\n\272\254o\002\251\360\205,t,[\\\244TR\332b2,D\353\312\372&|\224\213\312E\226A#\215\345\344\fp\020\336Zl\232\202\222\365\222%,L\222\210\312\242\304\216=H\356v\004\236\205I\006dHm2\211}},\200.S9\207m\020\242\262\246\035\017\3405\311Y"
+	.string	"\2214\200\020\035e\315\202$\217\351%bD4\216\374O\312P#H\017\226#,\177|\207tIY\263\370=\335\315ye}\231%\233\305\310\033KA-\005\t\302\307w"
+	.ascii	"\304\247\027Oz0\311\231\221\365e\324\362\362X\210\270L\345\020"
+	.ascii	"~@X\245\245\341\246\202\304zg!\322\266\210\303\221'3c\263\334"
+	.ascii	"\261\334\261\3708\254\323bR|\032J\261#\353\313\034\005\371Y\202"
+	.ascii	"\260\bq\221\236\020\277\024\263\b\241\n\205@\331\t\361P\314\372"
+	.ascii	"%\030Y~\260\374P\341\253\322\033<\352\344A\201\221\365K\034\251"
+	.ascii	"\253c\361\341\206=!~\211A\345h\242\363a\245\214\261\346C\225"
+	.ascii	"\365K\330\230\233c\241k\321\206=\025\352\261\220\366\003\n\335"
+	.ascii	"\021\320\306\036\227\223\035?\313\016\026\036[\255\231\322\026"
+	.ascii	"\323Q\210\205\017\032<\226:L\364\210\f\311\372R#,\327\263\300"
+	.ascii	"\261\\Y\3424_\374t\201\036\233jj\312q\2268;\244\251\266\230\345"
+	.ascii	"\215\305\355G[\233\007T1\242\210\265\t\031\344\221\365\245b\233"
+	.ascii	"\205\215\205m96\247\004M\361\256\261\006_\326\2272\261\240\261"
+	.ascii	"\240\261\250\271\310FvLT,igQSRxv(\33513\343\300\323\021\032b"
+	.ascii	"o\2164!Vzdd,[+N\310\364\260\250\262~\f\035\213\030\213\030\213"
+	.ascii	"\226\207\302$\232\020PZ\326\217ic\tc\t"
+	.string	"c\241Q\324\345\366\354\310\233\313\3721^,_,_,4\204\n\221\024\225\203>P\nY\300\316B\203I_\332\037\222\230)\226.\226\256\032Z%_\200XY?\006\210E\006\213\f\226\255\225'JhQ\212\314\264\263D$\226\031g\331:\203a\324\005\243\310\002\203\005\006\213\226\241\022Z\224\242\313c0\b\220V\322\022\314\037\213\325Y\260X\254\236P\032\313G\263J\351h1k\226\027,WzQQ,.X\266\270h\003t_Fb\313\037c)\274\250\316\342\"+N\245ie\3152\225\241\334!)\031HRK\206l\260H9\223v\364\234<e}\030\036,K,K,Oct\215J\212\357\034\224X\313\351,OL\246\236\016\027\263fiq;\301\260\241\034Y\377\220\245\351\177\362\031f\343\207\245\211\205\311m\001\206'\230c\025t\227u\236\256\250\224e\214Z&\245\302$\b#)c\f)\232\231M@"
+	.string	"\363\025"
+	.string	" 84\030\216\207D]\327\265\003\024"
+	.string	"\021Q\304|z:)\315\2240K)\210\b\200\200"
+	.string	""
+	.string	" "
+	.string	"@"
+	.string	""
+	.string	""
+	.string	"j\335f?\201\005N(v\342\265-\375;v\234\246U\330\"{\023"
+	.ascii	"\260\271\235\271\373\206\tK\233\351\355\241\266Nli\022\207\317"
+	.ascii	"\376k\227Z\332\021\375\002L\330>\3377\306I\210\017\343\243\306"
+	.ascii	" \307\321\007\217\314\222\361\030\233d\227\221^\177^\215E\232"
+	.ascii	"Z\233bV\020\351x\311Xj\272a\016\026\267<\226\333\b\025\267\271"
+	.ascii	"~\225U\002\335\261\274\026q:\rw\332\262$\257I\007P\272\271\364"
+	.ascii	"\301\365\321\245\001e\355\273i\020\263\203\025\227\025H\203\227"
+	.ascii	"\306\367\370\316\031\373a^5YS{9\327\255\363\256B2\351\206\336"
+	.ascii	"\316B\246<\352@\254\312\030\374\321u\247\214@\3429\025 \003|"
+	.ascii	"l\030\266P\250\217Y/\323\316\272\333\236\361\316U\246=\030\005"
+	.ascii	"U:\266\325\017aW&u"
+	.string	"r\301\262R\273\247\303xN\340\030a\310Nz\024\277rt\274\f\243j\3340\013vm\250\245rs\374\246\263\341D\b{[C\233WE\037\201\202ln\007\214\t,\372U\n\371\257\216\002\335\342\2073\003\225\005\326\365J\340\260\177\200\246V\341S\243\262,\313H1\337j\216\bA\2339\3527\245P\333\207\304o\272\221\214\016\252\247S\007Eh\341,\265!\357`X\017)9\bl\320x\340\350\314Y\221%\350\3239\20531-@\026\360\250\340\223\005!`\020\2039\370\203]\321\\["
+	.ascii	"\240\004\226\264\271\"\316"
+	.string	"\262aZ\364\300\310\213\343\360\361X\214\345\002\223.\343L?\344\036\f:\307Y\357\360\222\363,\212nY\364\307\021\361\277\223k9\200\215u\215\333\262PJS\240\241\375\373\301%F\213\320>\020\034\332\313!\362\336E\0316\331\234~\322\265`\343\350\316\217\357=\007x\005\242\230\350\241\263J0\263\215GA\240\255}`d\236\026\310\357\222\211\250K\334w\212mRM\006\"6\365/\242.0\273\350\2669\224%\335\320\314ib#r\357\257\201\027\236\302\026r\261;\210\3568\300\354\025[\021\231\310\210D+\177\276\303\313\363^\231\032\214\346\212\347\344z\242\230[B\256\264\355\203\306\323\317\241}u\357\0312\367\001\237\272\206K\334\303\206\b&\255QR\257*>\361\322Y\013\232`\310\342C\0064\346\223\016\266*QM\352Q\230\337\263]\f@[\260\004X\0056\245\346p\326\376G\217\271\225H\207\377\341\311\210T\232"
+	.string	"\030\026\037\344\266\242\341\256Uj\212'\206?>\340"
+	.string	"g\005\373-lV\023\252\323\247.F9\036o\301\277\332C\244\204\206\225\335\336L\326\323\327\257\177\350/\\\003RU\241+\323}\273\303\t\366U\332\214?9{J'N\2371\362\331\006D\370\222\324H\020|\025g8\342\316\023\257o\231,\275\006\006?l\322\2601\311\272a\3502\333\334N\355F\343.y\n\241\016\364\202_u8\004\360U\031\b\037\3022\226\020\232\025\271\333d\327\345K~\031\237\325\326\326S\031\345\370\215\223:B\210\240\242\2755\333oIP\346\306?\022\213\261\225\\\021\261\250|\266`4E\340\"\034\237\013L\377\374\206\362\004\370o{8gj\034\354\236I-\013\202eB\272\030\232o\340\2622\235\353\351\320{.\362@\273\374O\004\316\023\267\313\022\202\347\226\300\231^*^\"\264H~\206\241\370\274\212qFKgtK\256\267\t+\314\220\346\276\345\024\034l\374\204\200\230]\305"
+	.ascii	"\313\n\307)\300\362\021a\216\232v\372E\021[\377\024\322;_\356"
+	.ascii	"\330\346:\220\1773\355\304\235_ \304'\303\t\007\260\327\365\002"
+	.ascii	"Zd\020\271c$\247 \231GLDi\205\327f\354\023x\025\226\250\374\335"
+	.ascii	"\177\030u\263(\236&\264\306\342\300\211\374\261\225\234\021\341"
+	.ascii	"\017Gf`\257\244HZG\261\005\356\257\320\306\253\345&\3103\253"
+	.ascii	"S\2064\2437u\331`h\211\306q\003q\274\316j?OK\342P\315\023\230"
+	.ascii	"\337\312X\3132\354\345\036[T\361?{\312inL\277#\340\262\350\022"
+	.ascii	"J9\034\374Z\037fQf=s\325\001\016\277\254\337D\251\231G\3244D"
+	.ascii	"\335\307hz\360M'd\353|\221\357BZI,\366AY!\0265?\356c\304\376"
+	.ascii	"\273\003\211\005(\323q\266\336\213=\235\330d\267\n\255V\0024"
+	.ascii	"=\312\007]L\324\035\023\317]\364x\023 \324;K\0048c\242[U\206"
+	.ascii	"\224\271\363\337\325h%x\215\025p\013I\312e\236\370\003\275X\253"
+	.ascii	"\275nI5\3624&8\177\357\335#\020\345{\251Q\020\234\005zi}(\262"
+	.ascii	"\305C'(\222\taV\002cW#\337\372%\314T\276\320\300\027\251\241"
+	.ascii	"\320\025\036\263\353\224I(\222\362\204\220\232\\S\212\247\304"
+	.ascii	"\326\275\035\017Q\240\001Xr\313\232!MU\262\231\032\256\r\235"
+	.ascii	"\022q%!\006R\310\003\213\0250q\2402 J\352wM\265O`\355\300\021"
+	.ascii	"\251\324\013\254\331m\253J\255q"
+	.string	"pb\276\377\322\023OYSY^\325\201\205=\030\263\001\032\234\242\330a2\\,V\016A\302\016\231\266\335H\022\307\215E2p\213\345\330\226W\n\356\253\211\3572\313\227X\335\036\201\202\034\201K\211\313\271#\256T\330[aN9\346\322)\230\n\354BG\374S\265!\265\217\035\334O\333\350\2268H\211\316\020|\375\322`\271\316\216\206|Q\r\231\360\361\\\024Uf\232JC\272;\312B\244\\\346\033\324C^I\240\331jE`\204'\224_i\267\202O\330a\262\327\204O\006+\r\263\257\340[\267\026\240Z:4o\375\241x\264;\206]\357I\330\212g\232\250\013\031\005\"U\357\360m\220D\320\223|\036J \2345\276\211j\024\032b\r\323\032\244\2059s\204\324\201\317\374\331\326\357\246\243\273\032\255\007\3327\374\212*\332o\342\232\2405\270\222\256\342\b\023\360\353\321\0043q3\021g\351ce\324\310\236\347"
+	.ascii	"P\313\2322M\246\234"
+	.string	"nU~fQ\254\242\025\224Y\001\356D\035d\324\314\204\270\003\353\353L!\2414\247\2131\021\t\302\216\377'\231A\002\211\276b\037#\340K\306?\266`~\b\017\337\\\267|\371\2056a\332\317\377\246\372\025\237\342x\300\200\251\315)c\247\307>\330\315\336\253\020\226*\363\210k\322Ss\203\304 j\013B\t\227\205\221\342\025\b\001\335\013\305\376\017\251\003\036\376\340c\255\025\227\204Q\222\213\214.\026%\367~\241\224\016G#\24553!\267\231\342\007\370\341\302\353)m\343\232\245k\314\n\033\016D#\230B\016\201{\021\023\233\356\224j\264o\031\301r:\004\346<\\A\322u\307\324d>\215\263\211\206\310\020id\005\373)N\n\237\337\303\301\317z]\220$\2425\330\324\033\034\345\2761$\266\377\330\330\213i{3\241\0307\316\024M\031\210\315\352\027;88[\006e\217\242O\261\024\353\325\0368o\300\301\307"
+	.ascii	"\222\2600\250\324\257\3645\221\004\370\\\367\314\b5\006\005\240"
+	.ascii	"b\310u\314\212 \3716E\025\277\021\222\220J\357-G\225\r\252"
+	.string	"\276\327\202@\342\356\250\300\241|a\027\343\025[O \2745Y\301\357\"\"`\252E\321Q}\031C2\326\201\363;z\232\271\255\366\320\352kx\023?}D\231\313\020\225'D\246\336\242\\\260\216l\360'ID\223\245\320\206\226\334\007\246\314\313\310\031d\273\004\001u\306\266q\275;\330c\252\t\343qu^\203X\352$_\245|\"\202\305GJ)\327\366\216\364\032\330\244u\321\304\234\r\222\366e$\320\341M\320\346\3254}\204\026k\263\fa\317\327\273:[\361\320\323\346\374\343\251\033\266N\240q\256\346\312\247A?\n\262,\371j\"R\240\020\230;h\337\227\372D\0261\324\202\bW\376\325U\031\241\373\317!\211\"\253V}\2005#\004P/\306\336\316\026\227\270\240\004$\364\326;nF\232$\\\t\254\251F\230\343\210\265i\225&i\363\007\272\004\374u\343\002F\365S \326\271\274\360\255\020\305b\267n\304"
+	.string	"H\260\035\210\320"
+	.ascii	"\220C\344\206%I\325\270\235j\304H\303)\204\352\376\276\254d\256"
+	.ascii	"\220*\206\033H\013\033\266I\325\373\264\354)\030\216\032\021"
+	.ascii	"\332\335\302\344\270\210>\2219vG\303\305\301BsRK\363]\312\032"
+	.ascii	"\030\231\352\223t\265~\214\363Mb\244\245b\322\304ay\227\213="
+	.ascii	"\034I\353j\364o\270Z=\240\037\r\271Je"
+	.string	"\365\330\341\304\271\200I5*e\201\232\373B\357\360-l\r\2632\374a\316^um\352&kK\024\236\034'\251A{\2148Rx\240}\240LX&\202F\266\003\024\t}\031OG\033\240\260LA\305h\353\347y\023\336\026p\265v[\357>*\252$\314\234\222\206\335\342\034\352r4\301\344\013O*\005\016\301dE\013\310D(\3022\212\200rf^Q\265\357{\003\276Yx\002\204\346\333-\300\240K\013?\241\325\377\270aE\372]\3635\235\275\205\321\254\333\245\366\361\213\357\021\271wi\207g^\356\327\271\241\250\n\217\263\3628&\252|\016]\323\241\233\032h\367\376\363\341A\022\266\304O\236\241\b\251\217\262\267\360\020\216\036\377\002\203\361\351t\b\326\272y/"
+	.string	"1\224\221\361\212\335#\366\3355\212Wb~\326k\365v\200\360\027`\244\034\337\013\017\216rz\203o \326"
+	.string	"\"\025\310c)\313\f\004Q\311\231\375\351\373\376\".W\361\362^\326\277\275\0034\326\267\336\356i\330\274\227\255\272\250@\n\023.\001\b\204\303S\276\325j\"\n\034A\213\r\305\342%\3101x\317u\362\252@-\ne\t\265C\225\350\267\202\254.P \3240k\303%\370\205\003\253\2635k\r\242\2628\032z\332\213M\315S\334\334\262\217\003\212\336\2676-\251\377\327\302r\031\007\333\333E\222\3726\316\247\t\236\316\3568~\204\312R\005\376A7\326\254g\271`u\244a\002R\332K\226\205#\004&\246\236khR\244'\2725\354\342y\304\362\"{L\020\244St%c9\250\376"
+	.ascii	"\211P\214\331d\264]\377\311\312\2533y+27\307\257\330 \344\233"
+	.ascii	"\b\261\246\265\216\016\325\020\032"
+	.string	"= \346\267\001\037E\237\030\316\377*\223=\251$:\b\2142\220\b\032\231\367\256\237\212\025\214\311\b\372\267\376!\364\373P\2305l\toG\241\314\213\345\006\235\337\013\205FHaX\366\301\337\307\024N\237]\026J\360 \202\277\335C\334\356H\355'\2358\320,\024\025ys)\350n\002\025K\317g\360\224Ls\224@S\315\r\177\341\027J\211UH\016O\017k\251\234\264CX\006\007\233\001\246\027\2509S\271\274b\267\275%\0216\303\355\246\340\n\366\210\357~\330\325\253\367\215\241\022\020\260}F\314\236*\202\354w\303\215\244\232\227i\370,\277\246\f\234\344\215\b~:K\353\315\301-\310\366\376R\027\343\025\207\267A\211\226@b\235y\")\202;\0237\302 \306\305\315\026\366'.*\230\024\022\270]\225\227_\0367\372\352\267\001_\332\265u;\312\022\250c\227\272r\207\346\243\274\202\244\364&\177\352)F*"
+	.string	"A\345\242Z\314j\\\315\365\301\333\223j\236\263\205\217\213\\\330$Q\275\303\312)\201\321)\233\336\002u\"\330\377"
+	.string	"\235jr\330\367\260\355.F\220@\\{\243\035\331\301\237:"
+	.string	"\315\272\017\272\034^\303\001\205P\273Q\362z\276\310\3200\016\b\210\355M\225\275\337c'f\025\361/\335m\272\305\200_Tj\242z\tPT\277+\211}k\245\022\306\332\n\345g7\312\f\030N\334-\341\224\340\247\035/ETnv\226\241\274\213\267\3122\370%\032\362d\251\t\305\353\267\213"
+	.string	"-\335p\037\234\253\216\337\257\245\305\004\325\245\261\344\373\352\022oQ\200m <+\336\365\316= \356\211\030\017@d\206;\206\336U\345\356\230\212\347R\220\270\333S#GD\313\004?\372\243\233\304\t\374\311\236\246I\305\2535N\223\233\257I\327tk \036\336\261NH\250 \016\272Hd\202\3666\372\267\201\003\371N;2\376\257,@\337\226Kp\334n\2321r\215R\334Nj\222\210\272Bh\270~J\225?\205\345\320\264>\031\375\250\373\302q\337\256b\316\360jt\006]\013\001W\243\377\017\261\251\201ID\227\361\211\244\357\376\346\016\036\n\316\353o`V\263\373\251\215\235P\264\353\2369!\002'\377r\255\276\322\345M\314\377\273\013\243\273z\237\264\240\320~\250j)\271\347\342\213\241_8\301\200\357\013\331\341\037\304\r\353\210\2204\255\233\026.R\234\201n"
+	.string	"\270\224nU1\353\032\325\237\277\247\033\2658)*,Q\256\177\355'\\:\235F\216\335#\004\212\030&\325C!\267Z\3763\233\\\037Wc\312\243\366r\254&\374\247\024\272\230lZi\0340:\357\351\232\326V~\0301?\274\3003\016\317}&\256\340y/\367\236\377T{=\366\177\241+\267\272V\210\374'\034\262\241\f\325\216\224\314\206Ar\377\336\334\n=j\037\247x?\276\235\222b\256\036\r{7\301d\202x\375t8\260N\214\330-\306\232\262\035j\217<\007\321\253\261:v\207{\237JE\026\215\300i\240z\235\365\233`#.\0376\347\330\314\210_\242\235"
+	.string	"\260\205\217\317\tP\333)\t\220hT\177\353\360\362\036dTs\371\314\023YP9?TGI}\377\246J\304\333\034\323\243\022o\303\223\033\"\264\242\344\273]`\276\237nn.\004\354\215\033\341\251\023U\314"
+	.ascii	"d\034\210\016d\204Jl\340<I\026b\276\b\017\031 \2106\001\373\266"
+	.ascii	"\332\354\254\023\301\271\216lS\357\036p\323\306e7/\021\252m\251"
+	.ascii	"\222\026\223e\345?\024\204\314\250\017\232a\"\300Pje\332\300"
+	.ascii	"\230\275\376\200\3325\337\201\350\232.\271\260V\023Sz\331\313"
+	.ascii	"w\nW<\354\346\335`4\355{o$\301s\001\277<\203\311\021\2141\262"
+	.ascii	"\310"
+	.string	"v\274\027\376\037\272\314\262W\262\300\216\024\0057\277\215\303\213\255byf\211\016\225\nc9\331#\210\310\245\3553\257g$\241\031Y%S\255\033\350\021\236GhE\263~\217\352g\"\213.\031\347Qw\207F\263?\347\355\032\233\247\327\r\350j\226V\375\332\3262A\251a%\253Pxc\001\276\223\277]5\376\\\024Fw\302\210\023\262\226\240\243\033\275\320)\3653}M\261\255i[\226\007\002r\f\323\2412\212\341\373\tU\202\305^\005ZX]c\237\020\274\355{#\233kQA\025\370\320l\302\211\341\377\b\024\361\035\rd\013\203\204q\355\373/\035\212\273_\336d\222\026\235\013\274\3152\364p(j\001T\232\351\266W\253\253\210\375\274\324b\223\323\342Z\265>\330\230*\367\376e~q\265\3168_\352\342\375\315q?}\227\2115H\035%\375\261\233\036d\275\377\341\f=\302F\203\335\245\362\241\332\336Z\345y"
+	.string	"\007C\024\252n\367\224\303%\253\033i\302T\367l\227\270\210g\333\307\200\271o=\354&MP\2439\327\301\212\030\233\200k\256\326\261\323f\035uC\366^\024Fnz7\002\\\344\324\352\266J\326\301\n\362\310\343'\230\336\003A\032\224\236\216*\377*\230\373pj\021\220 \242pK$\310\266\201\377,\251\334\375\006+\b\374\013\3302BA!RH\006\365T1\331\257+\251\255)O]\254\300\fK\353\355\301\003Z\013\220\246\346PB\232\230}\2471[M\257<\031\334\2051\242\321\037\364\236X\n\203\247F3o$\352\230\314O\022\3632\212\n\004x\350XQ\374\342K}\337\375\240\006\344\257\""
+	.ascii	"\364\t\032\372\3725\366\035y}R0\321\020\346\317L*)\265\224\326"
+	.ascii	"\2445\245f\033L\330JL\313;\274\275\345\303\204y\217\356\252="
+	.ascii	"v\226\203\262\272\361\257\004\2259\236P\335\273v\362\346\302"
+	.ascii	"\034f \322\346\177f\241\002~\033P\231Z|\002\254\357h\344\245"
+	.ascii	"\005i\226\230\330\314\002\333\305\262\207"
+	.ascii	"\250@\bvW\275'\345\225\324\223\0073dUqzV\273T@4\003\213\335\314"
+	.ascii	"\\\354*\204\210}\372\22300I\236\2764S\211\t9\210\t?Q\206k\022"
+	.ascii	"ZLZr\333Wx\210\230\272\335\035\233\222\213<\343XL\221ZB\230%"
+	.ascii	"\246\321\364E(\254\005\241\360a\031\372=\317\322&i\025\304:\r"
+	.ascii	"\315x\017\245\317,\264\226\230c\351\373[A\203ZW\266\311L2\224"
+	.ascii	"g\242\300\264'\241`:0 `\200\024\315(\233\341\231m\266\260\204"
+	.ascii	"\350\303\365\201\333\37244\313\027\177\200en\234\360f\217\301"
+	.ascii	"\2158\326\217\032/#cj\350\022>\326\371\217\030.7\313'Z{7\363"
+	.ascii	"\345D\275\276[\031\nT#\t\344G\323\006bi\362\021Vm\027\370\022"
+	.ascii	"/53\030\362\037\272\273\363\b\355-\005\335\247?^\333w$^P\036"
+	.ascii	";\245=\350Wm\273\026\370*\023\324\203gL\353\341z\206\373t\266"
+	.ascii	"aU\3465\211\206\224 \245+\200^\2313\352\\\236je\fL\031\036D\024"
+	.ascii	"\363\037\341\241\207\020(\317w\232\233\324\2472\322\356\347U"
+	.ascii	"\202\314\364\376xY\267\200\202\235\013\303\332\203\0315k\250"
+	.ascii	"\230\234>h\2401Q\3423\356}\301\356\203\274$B\330;\006\221\353"
+	.ascii	"|"
+	.string	"\310\235~\377\261\"\001\331\301\337\\\363\334d\307:c\234Kj#\333\251\263Q\034f\017X(\345\222\204\350\247A\017\202\035D\237:L\265_\3159\256w|DR\355\032\201\376\"\335\227\276=\267\303\323i8P\373\220\030\230\353\270\177\357\032 \216g\006\205U0\205\004UtO\002)\322\254\245ym\204N\345\224\244:\317\327g\231\243\356\202\004\306flo\347v\351\204\340C\204\324\336\264\311bb\240u\274\310\304\303\233\025k\251r\373\034Ra\3052e\024\205C\252\305\rH\264\024FR\004S\243\244T\245\235\372\217\n\236\245\r\342\004\337p\236G\026\001\232dC\033Y\007i\242\004\243\334\003\374\030n\235\321\220\373LaB\311\315\343\332\b\372\341\214\024h8]\205\b\230\303K\257\322\334\340f\211O<\2425\203\311nzV\203\316\246\357,\307^\216q3hou\227\236\313\276P\256\036\254\0018\351\027|"
+	.string	"\325b4\362\325~#\021\"\373\230\372l#\001\360\301\323\356\303\324G\242\300R\350\032\370\361\305EV\270I\253\006\366\220\200\213"
+	.string	"\260)HT0\3149XJ\361\256\346\303t\206Yb\216\022RW\315.\367\3622[\275]\244[\005\347\254\201i\273\374\025\323\344\272\320\214\334p2\247\316B\367`;\030\213\016\177S\373\345\373\005\013\0274\\\226o\301\225JJ\3302\240a\"\222\3111N\037.N\261$\224\334\325m\232\220R\023\315\344Q*\362\205\025p>I\210\002\344\267\022\002\320XO\342\335\334\251+\361\314\260\322_\025\246\300{fh\305\314\222\342\230\225\235~\346v\320\ths\344\tU\265\330G\236J\r\277\251\243\034d\323*<\342\212V\\\203j\243\340|I\274\f\310;&\2719\263\f\330\305$E\324\337\354\366\032\243\326\236\211ykg\204+X7\261\227:8\361\002\330H"
+	.string	"\2056enY\331\200j\235V}xTP\320\370\237a\013\025R\023\233\204;\344\321|{$8'\327\327'\353\214\241x\021*\210T\216G\310!\300v\267\334\033\275\316*v\207\262\323\377#\r\360\r\356\fe^\203\267\207$Z\316\020\364\217\272\332\324\207\321\201J\226\226\022\270\027\344\252\212\2058"
+	.string	"\345R8\357\223\262\321\020+`\007\3340\027\315\306\214\003p\026,\306\2212\027\315\250M\367B\260v\3303L\313\335\233=dt\3443\200q\301\244& \023\265\210\024\234\f\216\237\227l\330)6\034\3555\234\273\265\265\224\301\013\334\002v\003k\231\\\203\321>\367\203\327-8\035\2670\250\205\037\241\373\311{\3576;J4\240\342"
+	.ascii	"\017\\\342\340}\211\250:y\252\226\342\022\262-\330\316*\365\304"
+	.ascii	"+*\026\337\337l\202\241\006!\237\223M\3560 \007\266z\337\n-G"
+	.ascii	"T*\332\320\3718(y\177S\206\024Z?\377\244\200qM\214\204_\343\247"
+	.ascii	"\035\323\366\341\251\255\f\220\r\367\256\224\2630\332\023"
+	.string	"\327@\266\013I\2204y\201\022i\007\226 \326\277\354\217-JJ6H\322Z\376Z\327s1B\336\023\213\333\361\302I?IG\007\006\237.=\016\343[\224\262Y\233\315d\252oh8\311\205\200P?6\255\307\026A3\354?;\3504\372\317V\343}kX\235\355\222\367\320A\211A\234\247E\354\304\275*\304\242S\0259\327B\312\2503\237\350\336y\377\216Unl\253\256\311T\"\230\214W\026\335\330\240o\303\2721\027B\300\273R6\210\261\354\271\371\331\013\362 -4\017sC\214?\"\215\177\001;\340\2439\313\363\307\324#N\264j\350B7\317\336\321\005\212U\262R\235(t\023\227\001\214\273\025X\231\226\341!?\375\236\340K\0160\"\320\206\277e\023\030P\354\"H\231\302\030\005\361'\352\350\217-p\200Z\t%\360\342l?@\316;P\023\212\354[\302\340z\212\266\"\366S\235V\313a=2\004\215"
+	.string	"\026\246\315\326]\243G\t~4\236@\312\353K*\004\344ei\307,:\351\327Da\276DK\362\222\370\267@!*6JN\nP;5\306\215\203\033\005^\362\257\032\345\373\337\361\025\336\367\324\232<Rp\217D\235\302\305\223\2616\030\003\273\272\325\352\031$\033\226\2167\205\034`\"Y\013\254\302\211ZST,7\374N\331\262\244\3766\001b&\352o0\177\302\200>\006\030\224\263\001\341\030\350\254\320\0169\273\230\3712\226o\203\260fB\216\322\241\252\365\317\340\361Oh\352\003A\203\004\215\257=|A\024\322\261y\004\376Z\324\362w:\201<\254R&\267K\2529\024}\013\366\325g\220\n\251\004h\2310\370T|\202\320Ek\211\244+\375;\364\307\230\217\260\371\01611\232\261"
+	.string	"\244\234S\364\360\352rA\272\364\302J\375RJ\314\264Xn\r$@eM\370\266*\360\343A-_\322\367\331 \241\024sH4Q< \371zU2\266\024\364Kk\355m\327F\206\310\356\033P\357q\304\327V\222(\323_(:\204CV\245\353t\177\001\224\306\310\317g\35553\341\223\270R\315\262:\324iE\374\345)\354\241vW2\036c\335\004\265"
+	.ascii	"\003|`\030\177\243\371\006\3462>8_[E\375!C+a\300\036\345\005"
+	.ascii	"\377H_Wh\237\024\244\331\332\307\"h\314T\030\314'\334\260\031"
+	.ascii	"\361\300i\004\r\2439\375i\213\016\371g\356P\234\321\206Us\032"
+	.ascii	"?\263#\304\205!\341\025\007\235<\370BR\365\357\201m\025\373\007"
+	.ascii	"\325'\021 \2227\337d\0325\223\006r\343\353an\345\003^\377idi"
+	.ascii	".\001\256\316d\353\310\240\233\345\272\3070n\035\204\035\003"
+	.ascii	"\201*s\303\211H-\252\027\352\200\351\177\374\202\371q\366\016"
+	.ascii	"v\206\t\301\306\322\204\264]\002N\365\200\037\262\306\345\003"
+	.ascii	"+\316\343c[\025\342A\007\\\253l\341W\013\273#\036\221\234\335"
+	.ascii	"\322\324\261\232\323\241\243\263\020\024<3\361\224q\270\314\032"
+	.ascii	"H\227\020\243\335' I\261\327\213!E\022\203\244\005_X\327 \311"
+	.ascii	"}\373\2071n\tW.M(@\205\272\374\223/\t+\272\340\332z\370\310K"
+	.ascii	"\303]:3\330\264\233\341\244K\330\270\221\";b\366 v\247\337\022"
+	.ascii	"h\004%\376\322\004\211\260\217\320\216\361\336,\304\b|"
+	.ascii	"f\304`\201\024\206,];\303\221C\f\304\202CH\335\313\0268(\341"
+	.ascii	"O\036\345\270=\206\300!\220\212\356\327s{\271\002?\245\003Jo"
+	.ascii	"\003\360\210\302\340\f\212\342S}S@c\321\006\214\312X\220?\002"
+	.ascii	"\303n\025L\266,\364"
+	.string	"-{S.\235}\r\364\340(\357f\317\025|\2041fE@`m-\264\232\316\n\252\0067\002C/\251\3324\263`\322We\313\370\2468\337\202\271\221@G[ \316\034\207>q\360\"\013\241\341BK\232N\326\033Q\r\317\265\003\b.E\276\341\024\242'\036a\352\244\216\333}N\262\232\3664\214\361\205^\006\265}F9\364\271h\034\272\263\\\301\236\036e@\367\222-X&\013\370\f\363p\201V\323N\025\300G\022R;\026\224\242ZhR\344\265\365~\264\025\223!\351\312V\313Bj\262\264H9\303d\344\032O?\274I\253\372!Ae\360\342\264m.OHa2T\303\342\2450\212\022\260\261\223f\223\345\210\244I|\200\242p\235\251@\342\326\303\302-\306H\250*\351\364P~\305\367\311\013l\263'\b\225\325\233)\3001\317\365\232\326=u\206+\023\006\376\205\372\277\233R\257f\345L\227\370z\373["
+	.string	"\364\315x\021\361"
+	.string	"Y]?\341wp$(\217\271\261{\343\245@j\214\345ywv_^\\\007A;\356\236\250\272\025>\027\003\277\360\324\340$\026sT\210-\247\375\001G.\r\330Y\300d@\023\304\016\233\200\211\246\260q,\264\251\377\301\243\223:\365i+\275f=\001\350\354\317\n\325\257l$\330\353-\332\242\377M\tn}\355`\376'~\025\006\024"
+	.string	"0\203\347\350pn7\004-!&\264\322 @\204bK\237]vn\370M\201-\317h\337-Nu\264\355\317\"P\264\360!\325\222\037\216D\207\256pw\\\256\272k\361dY\t\030\035\0364O\276\201\222\326\025\215\017\253ts\203$h\216\234\306Jf\007\003J\2751\314d2\016\215;"
+	.string	"\356\331\207\026\276\221l%\022Y\326P\360\251o\334\017\3403\f\306\305\017b1(D7\002\266KU\243\023\025\001P\252\277\360.\304\n"
+	.string	"\250\246\"''s\312\037\221\300\027\210\246\245w\n\022tL|\325\236S\201\254\016\205\355\227\025\202\312V\351\266\177\003X0\365`\263\312\326!\274\245\240\001T\253\300\251\201\240\2109i\350\272\252\225\335\321A\001*_\234\314"
+	.string	"\b$l6\032\"\326%\374"
+	.ascii	">L\237\3617\342\007\233k\315\020\275\001@E\017\312\220\226\024"
+	.ascii	"\221\251\030O\231\223!\021Z\347\306\226\220.\316\244\207\275"
+	.ascii	"\005$S8\305\201\030k\253\021\034W*\2668\324\217\24594d{\0246"
+	.ascii	"\211^I\325%\252\221U\ba\360'\277\254\210~\276\223\317\314o:%"
+	.ascii	":\351\205\024\234B\2129\2447\243\340\0369^\310\371\371!f\240"
+	.ascii	"\362u'<\377 \031!\320\302\002I`\025\217*\0064\354\352\357rb\266"
+	.ascii	"\362\230\252\333K$\376\307\273\333\r\204\367"
+	.string	"l\354\003\033nv!q\3764\b;nK\300\215\244v\252\216\021j\245\366\237&\210M\312\312\340\323\r\224<\236f@y\365\362\024\330\227[\265\0043\311\210/D\210\360>\346v!\267\226\350\216\374\337\304\356Y\262F\316\r\343r\311U\237FC\227\341\f\004\033/\204\266!}\270\016\202\245\247\275XMwqB+\005\r7\251\342r\257!\260q\032\226\013\204ov\202k\330Z\366;\215I0\024\334#\3650\n\326f)=\360\356=\322\035\334k\356\020\260\257\365\220\357Ws0W\321\227f\222\267\214\233\374@\341]\367\"\350\317:\232\336\271\021&*v\222\241\223;dL<\347\rb\3348I+yw\255\327\210\322\315B[\306\232\300~Y\367\3302\017y\364u-\351\230M\374\202\243l\321\026\355!#\261R\367\227\207\372\201\214EG\253\353\272\3771_\334\241\242\021!CKBF\317\001`\355;x]"
+	.string	"6x\204\355\347|D\355;\3741\377\363\244.\326\334\250\234\235\226\305\260\215\210\202(b\313\003\230\230/\273\347\232b2\221\201\030dFU\344\351\305\"\211/\310\300\030C5L\026\362vQ\250\262\264=8\357\"\344p\321)\321\023\236\374\037=\231\\\274\324/rY\n:_\006\313x't\205\331\345\244BD"
+	.string	"\301\365;l\270\350C\302\376\347a\266\314\376\202o\372\323K@\036\213u\262\245\362x\025_>\222\001\235\032\24510l\005\356\362c7\225\327\262@\325\3431\374\n"
+	.ascii	"\224\211\226C\365\336/)%B\023\221S\321\325\362\376\307\360\r"
+	.ascii	"\336)\r\374\225\246\213\024E\035\377A\344\007\274y\027\301XS"
+	.ascii	"\356Fo5\275\203\027\340\367m\212Q\240\357i\217\322_\361b\021"
+	.ascii	"\253\344\342\217Ro9\372\232O\022\205n\346\210'\004\242\002\370"
+	.ascii	"\341\224\372w*\307W\240\375\036\257\246\016\357\220E\210\204"
+	.ascii	"\223\345\201(P3\337I`\267CK?b]\257\277\271\330-\271\216\033\307"
+	.ascii	"\265`,\242\301\311\210\332\274B\3363\264\004\254\211\357\006"
+	.ascii	"\002\021\240\223%8\376\335\316%\202I\261\326\243i3\215\023-O"
+	.ascii	"\330\255z\325\375\376\315V\213l\275\023\361\376$wsH\002\004\217"
+	.ascii	"\263QL@\210\340\004Tu\261T\0060"
+	.string	"\207G5\310\274\336:\023\024\244\311\273\314H#&\242\351}\021i\224\200\273*\224\357\362\223\242\215 _\346\203\331\374P\375\275$C\340Jb\3240Q:\213\371#\332\t\2603\257<\345!\032\344\303\323\020\332\353\210\037\207\030o\035!\227\304\347\314\321s~\237\244D!\200v/\255\232\023]\313\336\2073\342C-\313\233\223\352\374d\277\323k}&\214\023\375\351\206@\f\222p\243\331\f&*H\264$\001\252w\251F\274\343\007\240!]\210\032\373]\300\006Q\213\224\274\303\264\337&Wb\270\037\260\300\336\320\036U\203\312\r\006\343,U0FC\350e\221!BY~p\026\243\327\314\365\223f`\261\tK:2\204\257D\305\235\030\\]\377\031\262\353+\274\006\273PX\005\005P\240\336\343\357\370K\216\177\213<\nC\250z\f\347(t\323.\207\003\001)hlr\\3\177\300p\bM\223\314\355x\266m\240\321"
+	.ascii	"\356\240\241\217\002O\004\336T\367K\347||\373i\204\362\327\271"
+	.ascii	"\"\227CK\"\264c\202\366W\n?-\301\304\245\013\353\345\023\022"
+	.ascii	"vu\331\375\314\356\202)\327\006&\220\216\321O=\003H\177,]\026"
+	.ascii	"a\262E\324f\264{]\227\375\022c\235\207\370\0013s\312\017-F\t"
+	.ascii	"\343\340\020g\030\300j\336\372\373\032\247\277Y\332^\314\266"
+	.ascii	"\266J\240mZ\004\231\372\255c\026l\2013W$]\352\301\340\n\343\007"
+	.ascii	"\307vw\371\253\323\310\260\270\212\322\244\365,%G\230\340~>A"
+	.ascii	"[I\bd\251\223+\333\002S.\022\234\331\037j\233\213/\340\271Op"
+	.ascii	"\232i\312QE3\213\2674lph\262\250\234Y\013{\343\242P\267\243\233"
+	.ascii	"\373\035\bN\350\213\357\252\"djo\247\212\335\231#\375\326\007"
+	.ascii	"\363\025\f\325/\272\334\301\323#\322\361\262\004\313\"c8\250"
+	.ascii	"H\303\242\377@1p\315\250P|6\205\243#`\300\364\333\216\332\356"
+	.ascii	">\030d\351z^\332\343\245\203\353#\316\365+\342\323\022\0239\311"
+	.ascii	"\212DB\272E\266\325.I\354\2611Q\332z\304`\247\353\200\236.\316"
+	.ascii	"\257W\037\210\360NE\310\277.\336g\212\362\026Y/B.>\226g.\370"
+	.ascii	"9R\215\326\351\033\364\375\271\340TY"
+	.ascii	"\313{\303\004\312\321\b\321t\320U\n9\343\351P\344\322\350\013"
+	.ascii	"\355DH\232\252-\373nE\037\212\225-r\324@&`\227~o\350\364\037"
+	.ascii	"\344<\262\273\221\270C3\201\334Y\004\204\326\215\320%\365\205"
+	.ascii	"\315\006\027\006Es\323\342\236\035\324\256\215bH\251q\216\210"
+	.ascii	"\237G\266\200G\304\263\3659\003\304\352[<\202\245^d\234\271\253"
+	.ascii	"A\311\266A7\355\023\227v\2418\024B:\215\317\b\234\250\205\205"
+	.ascii	"\335.\365P\3764>\346\265\002\362\344s>[R\211x\264\036\246rD3"
+	.ascii	"\210\r;h\221Y\324\246z\216\200\323?-}{T\314`\232\255\254\022"
+	.ascii	"\023\201\242\263\365Q\343\374\261r;by\022\376(T\2500\262\177"
+	.ascii	"\277\267\313\207\325\355\360\206B?\211I\243\234\301\022\307\032"
+	.ascii	"v\016\257\005\266\364\034\353\033\241A'W\327\033\204\fr\202\243"
+	.ascii	"\004f\237\214\210 >\365\300\264\353\0176\245T\001\370\360\227"
+	.ascii	"\001\f*\344\032\024\262\2520#\"}\211\220V\220h\302\252\313\335"
+	.ascii	"\341n\0364\030K\227 \234\rY\342\276\333\341j\353\207\276\250"
+	.ascii	"D\372\2770%.|W\205.\231\217\2374'\274\007\320\264\255\263,F\270"
+	.ascii	"G@\374t\024\036`\244$\344\260\241\376p"
+	.string	"4\311vc\353\200\252\356)\234\273\310\366\260\345\364\3702R\300\253\230W1v\177\314knq\211\330\347.\206\022\227$YB\023(8hy\030\f\235\371\371ZI\210\224\374\257\354V|\301\2756\251^)\216\356\376\301f\351\350.*\362\377sr\r\312\227<\032\020/\365\334\f\271\205\211s\330\026[`C\370|3D\266\301.\340\255\3228\322\262\t\004\302k\224q\213\200L\304$\355\371'\272\267%\002/\231\353\031\016\300\230e\360\311\230W\344\310\341>\375\2679\002\364\304\260\026za\222\355\3616\271\3344vd\315]\205bl\260^Tls8\025\226\312\373\357\021\203i\332-sS\377\272n8\254\314G\004\201v\223\207fU\004\360uD\325\350u\215\nZ\240\b\341a\370X\f\177\332\207\310\306~Df\007\303\243\b\260A\207\007(\226%\260\372/keU\205\232\235HG\345~?\277\272[\362\f#"
+	.string	"E\254\314\013 \260\204?r\323S\204N\312\345Z\033-\342,\253\341\201\024\305\201\0032\372\002tJ\257\262\253-\261o\022\325\\\r\021\343E\023\236f\272\205\216c\247\022{\005l\004*D\372F\273\023\263\354\2734\b\365U\305d\n\320i8l\004\362\306\032$H\305T\375Lfu+\032*\361\301\327\022P\007\341\347\246\362\364\363\036\257\312M\206\354\337\230D\035\325:\230$\244\025>_\217\305\253/!\225Y:\220&\007?\265>_\356\215\360l#\337\262\306v\223F\226R\037GY\001\022\245_;\244\006\240\352\312[\334\013"
+	.string	"w\013\343\256\216\247\242\021"
+	.ascii	"\t\001~\363\335\353%\372\204\f\324e\033\026\210\327\300\3414"
+	.ascii	"\350S \213/\375Ti\347J@\212\362\277\340\025\005J$dA:\3005\261"
+	.ascii	"ZH\322\3106!\365\250\344|\310$\261i\353\340|\031\2133L\013\020"
+	.ascii	".\240\036\232>\346\247\324\271\340\b\205C\215\031C\237\347\327"
+	.ascii	"h\003\007pi\003\270\356f!\366\021\256\002(\361[\0279\232.\313"
+	.ascii	"\0024\271m\266&\224\277\036:\242\370D\326\313t\313\234\373\345"
+	.ascii	"*\022\321O\200\034\f\224\262\365\355\333xd\373\377CdmY\356\310"
+	.ascii	"\tJ\267\f)w\036:"
+	.string	"\345M\nO\374\267l\251[\362\361\364TVf\013>\240t2qy\003\001k\245\261\t\244\177E \032\004\t\235\013\333?<\202\r\231\"q\3700x\255h\350 \252\204\025\315q\265\234\327\274=\022\n\013\337\330\221\215\230b\237\263\246\200\300\023\b\274f\342H\234p!\341\277=\221\374\3239\236\261\001v\301\261h\031\252\363\340Si;\264\320\246\363E\373\005LY\026\034H\370*\n\320\345\235u\344\240\343\334\247\210\214-/_\323\221\346\221\312\233\027!\226N\r\031\030\345\353\020#\006>\033\344\223\307\270\360Xp\231\201\204\222\266\355\222\177\032\227\300\3770`\326[\031\302\356\373\351\017\210B\336n\"\265\242u\217rKA\232`\226\031_\372y\320\0010\205\215\265\205\027\216\2266Iq\221o\007\271\306zh\212\233,\240L\355\271\203l\321\r:{\004X/q:K \002\364\320`O\216\263z60\257\221\f"
+	.string	"\2553\026\225\027@Cd\325\315J\222]\254E\350"
+	.string	"c\215\024]|F2\375\204L\322/\215X\240\032;\326W\007\340hkf\334!d\351'\2571\237\207V\3756\035\245\360\0014\t\206m\t\343\203~zr\226\234>\221]4KV\245!\210\335\016\270\b\375p \232\237\013\324'\263|\320\216\007I(\374\030\342\033\333/\374J\345\225\370\341\004\357\232\3232\277'B\302W\254\016*\032\365QZF,\006<\013\240\364HS4\225\377_`\354\350"
+	.string	"\254\241"
+	.string	"_\20162\216_+a\337\257P\f\247!\322U\250xm"
+	.string	"\377\333K\273\220\364\344%lm\271\"\334\3771\320b]g\363Ds\377\023\177?\306\017\n\312\246A(yL,l\215\020\356G\326\321\315#*\220u}U\347\211_\277f\241\223\302\342\227\263\244+=\0341\235\357\366\342\344\205_7\352\331bD\360\305\217\022f\326\375\246\bP\223\244\002\236\331;E\201d\031k\370\032\254\251q,H1\210C$\307=\374\243j\034\252\177\356\343\327\255\030\013\377#\330\263\221\377\227zi\\9'\273\272\232\3124\001\177W\267k\rQ\244$BZ\342\224\337\202\217\317\243\220\333\362\004\035>0)/Tj\004\300"
+	.string	"\322.~\236*0\354\216\270\310\007wvi\\\216\333Y\317\363Yx\037\255)\026)8\333\223c\270T\02646n\226\200\312[\336\313\nN\265\212}\330\017\tH\337P\211@\303\036\250\266"
+	.string	"\275\334\336\226 \032\304F*<\270\206\3722\346!F\251\340\314D\263\037n%#\373\365\030\r\257\035\246W|\354\t\347c\307)-~\240\267\274\021C\210"
+	.string	"\022E\330\225\013\264\226k\332\022\233\002\260\035Q\333\240\314\317\220\245\b\324\fiK\035W\377J\313\327\207%\304=LN\032l\211\331ee\264\372\267\002\312\224K>\277\0034\245\350\336\273l1l\275\003\360\035t\2328\241A4\260\353\2427\b"
+	.ascii	"\316\211l\337\037\331\237\\\252=\b\255\357'r\341h\373\357Q\277"
+	.ascii	">=\325\013\236i@\333ny\330yt&\023m\276\330\235\317\016\217\271"
+	.ascii	"\"\021\243r\013+\2366\331\275\324\327\352\315\345\314\267\206"
+	.ascii	"\265:?Q\215S\t\303D5~c\251\254/\315\376\224\005!@\322\033\325"
+	.ascii	"a\303\325\313G\375\031:S\2140hoB\311I\361\345;`\352k\224\235"
+	.ascii	"\313z\013\n\210\234\3453\217\331\276\364\327 \242\302\213,Z;"
+	.ascii	"0\227\245'\"\253'?\371V\303\027\222\026\326\333\354\206.\021"
+	.ascii	"\r\356\331\251\251\224\340\256\343\"F\337NF\330{sk\rb\347\224"
+	.ascii	"\025\264m\026\212\356\277\314\344\331c\244\371\275\262A\250\313"
+	.ascii	"\224\271C<\252UBZ\235[\252\b\266\371\315w\272\375N\362\300\325"
+	.ascii	"J\322\362\353Lx y\203>\021\242=\020\255\310;\217G\347E$I\031"
+	.ascii	"(K \246(\273\231\221\250i\274\252 \367F\263v\200/\367\346\033"
+	.ascii	"/\230\334P\3456\0132Bc\247Ri\237t{\205\242\337O\342\177\343\243"
+	.ascii	"=\350\243\335\3153\230o\367M\005O\220"
+	.ascii	"t\024\031\231\004\255\302-\233t\032\271\223\230\244\265_xNGe"
+	.ascii	";\237\231\300\246R\347u\203Q\235\243\033&\345p\344\315@\005y"
+	.ascii	"t\234\217Q\362J+\323\223&G\263\211C\374\336\005\3579G;\307\361"
+	.ascii	"B\203\356\317\202\366^&Va3\226\364\266\250S6/\345\202_$\227\376"
+	.ascii	"\236\375:\262X\231X\252!\024J\375\332!J\322G\232-\234\274\300"
+	.ascii	"\2116\325\227VlJ\371\264\026\005\227\332U%\021\021\030\364\321"
+	.ascii	"\2441\346*\271@\377P\303\222Z\003?\023\317\004\232\225Y\340\027"
+	.ascii	"\310\177Dm\204\212n\252\260'\016\312ph\330\235\351\3732\316\001"
+	.ascii	"\310A8%LEJ\270\367\277\t\002\370\310d\242\246G\207\231\261\025"
+	.ascii	"d$*y\352\364\037 \321\221\020p\310Dl\323\275B\261\236\252q\212"
+	.ascii	"\372\036\353\251\320DJ\332\236\336\2639\247F\203\033\365\332"
+	.ascii	"\242G \300lz\017jF9\330\354\332\013\354Oc\253\223\235\306\024"
+	.ascii	"H\376\2369s\222\032\215=b\030\312 \357\360`\304\"\225}\017\036"
+	.ascii	"\255\310\266\222\214#_\t\355\\\276[\033\302\006\226\251Bt\300"
+	.ascii	"\326<\313\364\373!\255/`'d\211\250\243\305i\257\260\274}\177"
+	.ascii	"#\200\360\3527 S\224\361\\5\355\304t\006\261Xzn\317\005\320\005"
+	.ascii	"w\326\317oG\260]"
+	.string	"\311m\345\250\3212\271\353\200\bl\357^&\245tE%j3+(\347*\206\\\223\277\247\005\354I\360\220\177\331'\2003\355`\327@0^\251Q\307{(\277E\352\370\206\031h{}B\353\301\261\0051\332\360\240/D\330\271\211\355\342w\206\214\023\274b\371\310\366\016)H\033\262@\210;\321\337C\316\214\375X\b0\372)'5\"\200\200\341\20459f\b\262L\234\364\332r\311\347C\312\332$w\220\243\266X8\366\375\365\260\021Vq+\373\276\037\227h\254\035CGDW\037U\335\206\301Sw\362\307~7\020\352\3530\025)\033\354\023u|\250!\201|\323i\357\255\372\2620g\035\211\201|W\264\203\267\tt\353;\231v_\243-\022\033a\217\355\021\223v\321\\\031\261p[\236\372\r[O}\266F\2504.\256r\037?\r[h\236\254\2767\202\373\361\241\021m\004\370E\341D\336A\272mR.\233"
+	.string	"\223\253\037\001\215\034\336:\275\257\003\237\315\033dA!\244\336P\331\351\321\033o\362\025\354\200\326\b\336%\375:\016s\237S\347+M\274\003\016\3540X\223\252\311&\244\263\343\024{\232\317\312\r\202\b\275~z\b\366\030\213(c6\241\377\300\240\017\360ve\325\202\307X\364\244\205\352\311E6\216\242\"\360[\323\304\253\220\n\311G\276z\227\267\037\272E\222\203\310C\0170c\346{]\337\264R\252\315\006B\276Y\006hC|\303\205\")\354\027&\001\n\365L\355S\212\021;H"
+	.string	"L\023\203\321\333i\324\363\346\364g)\244^\017\343\247*4\353E\223Qq\315\006\335\266\342W\222\310\243\300\n0K\300/^\272\347|\354\326H\263g\314K3\272\bP\245\nXD\352\347@\327\304\376\234@6\204\224\007Tz\351\001\246/\327\333R\275\266A\243q\304\254\334-B\364\261j6\215\346\267\275&\217\2600\372j&\021\251W 8\324.\221\317\247\003~]f\370\b\367"
+	.string	"\303$\207\177\020\265x\360\026\212\247\356\272\004Y\361\323\311\300\320$\007IGIx\020\037\214\314\331eGJ\360\336W\321\324\266\366\377\252\350\312\313\210\376\024Z\\\266WYn\265.\346n\375\034"
+	.string	"\260\202\256F\220\357#\025b\202\251:\302\224\223\324M\340\013\301\347M\375C\304\333}\350\262\303*p\305\307\366\346\3140\232\303\021Y\341\206x\031i\263\331\32209b\213\tN\362,\023\317\022\222=W:\225\t\316\244\027R\241\347\223Qu4\234\331\037+E\354x\342\253\b\f\223]\303v\021U\375\200\272\330\272\205`<\204P&\336\tm\351\325\200\241\006#\262\364c\202YU\212\321m\314W.\254\370\017\315\311\"$\201\243\004\373\235\311f\230\t\376\367(\210C\210\303\330\r'\210>\034\242\3433\f\013\273\022\272Tf\306+>)\371\314\373\013\243\2033\013\371\240\022<\277d\204 \312\r\224Mf\320\362u\316\230\365:3"
+	.string	"\004\004\211\250T\215\234\")\205\200\267\033\\u!\326\314\341"
+	.string	"\233\200\364h\026\202s.U\231\362\371\257\270*\247\315\351\nR"
+	.string	"\327\325\013*i\202\211+\005\333\246\347\363/\276\352\261\273J7\244bZ\345\306bz\344\310\363\033T\314c\2447\242\357-\214\334\241P\314T`Cb\316\367\306\002\220\\,V\004cw\324`/\220\254\017\233\362E`c\203\251\027\025\177/"
+	.string	"\006Q\217~\025\rz\366Z\\\225\030\345\003\213\367\262\017I\2023\263v%>H1 \204\372}\023\2269\243\237h\332\253\234\201\362_\200\\\270w%*\034\261\277\005\222\360vb\243\006\300\263\031\3678\303\240\342\371_\303#j\r\305v}ZH\251\233\241xN\343N\r;Y\0260\356\317\201B\222\243\320Z\034\032{\001\353\033\210\246\255\333O\222J\345\035\337K\265\036\b\331\001\026\305\234S\272\247\240\267(\f\b\353\235\001\245L\023\377\327\341\366\002\346\2613\340\370\213&\342cd\275\224\331y\213P\242\216\307\200\374 \245]\276\301Y\244\376\302\223U@\274k\370\005'\b>y\242\242\302\024\177\tV\327\024/3\221\\z\210G<\250\317\313\024`\347}\037\356\fX\253\005-\0348\022\305\270A>\034\006cD\277\337\326\204\201\nb\003\020\3472p0\365\261H\215sZ\245"
+	.string	".\023\276\342\311\031\206\211\355\237\330\260\270\002\244-4\373\363)\206Cjn\332\272\200\f\026\017\303"
+	.string	"d\356T\r\236\023\374\304\020B\\:\234\336\013\265"
+	.string	"M\033\037\362a\343\376\346\3717gi9\265\272vM\277\230>\301\306\006\\@#$\267l\352\207\237-\217\034R\t}\244%\230luG\f} "
+	.ascii	"A\bI\276\216\300\002\\[}`\322H\340-\021;\362\232B\217\232\026"
+	.ascii	"\330\020\250\370\223O\2502bS1\025\315\304.\376\231\325\255\313"
+	.ascii	"O\0222\333\247\301\211\354G\036\032\235\327n\365II\224\264\317"
+	.ascii	"\005\006\226\235\327_\330\bb\334\342n\022\322\241<\006\246\233"
+	.ascii	"\253\250\237\244j\235\242 ^\363<}\217Cz\326\315\317qz\324\204"
+	.ascii	"3\372i\303}\354\305;\273\202RI\300\271{\303R\016\326M&\007+ "
+	.ascii	"\t\275\262\250\257\210pb\027@{\316\n\336/Q\277\026\275^4\225"
+	.ascii	"\246\314\020zl\220\214\322\f.\007.\224\303SR4,\"\021\335d\214"
+	.ascii	"\b\351\243\211\221\345*$|x\220\025\362\020\025\313\f\034\332"
+	.ascii	"#\215\243\f%\001\366R\350\204\260O\333\255{\177#g\005\312\032"
+	.ascii	"XK\304\320.\314<\022\242J\177\222\211(a\343KU$V\n\f\373\344\364"
+	.ascii	"\312,\337\330Y\024g\303\"\013\377\245\251@p\320g\245\3417\210"
+	.ascii	"\346\033b\024\375\361\317r~H\344\204\275\275\322\312%j(F\207"
+	.ascii	"U\004\032\016\332u\333\213'[+@\333ufZf\022L^>W\331\365uf\t\237"
+	.ascii	"\261~ifM\024JW\273\336\007{\013k\364\2467\357I\307\2565\260\352"
+	.ascii	"n\333\304\224\343\376\344\332\007v\204\301\263a%\376\264\337"
+	.ascii	"\256\346?[\007U\2547\204C\2077'\341K\204\260\0359\260\230\024"
+	.ascii	"\250\343\312\367\032\304&:\233\214\356\367rb\354A\bT\331pbP\340"
+	.ascii	"n"
+	.ascii	"<j\323\216\236\371\035l)\013\263\373\200\220\226\215\257G~\335"
+	.ascii	"\006\240?\355\235N\257\230\366\255\375xT\312p\016\323*\255\363"
+	.ascii	"o\202o@&\240\216\324\272sK}pV\363\224\005P\250DI\030\331\226"
+	.ascii	"$6CP\201\265\304\024;a\2307\352\305\267\350\213\023yv\235\331"
+	.ascii	"\302B\013\006\311[O8\350\216\253\347\377\344p^\033\367\307\347"
+	.ascii	"\317\276O,\033\307?\231=\327J\331 \237\312x\216\371\234%;Y\310"
+	.ascii	"\215\333\340\317\275\252\245\375J\277\356\367\226\f\036\246\214"
+	.ascii	"\256\003>\237=rL\210\360\035\224\027{\257+y\231\203;\305\252"
+	.ascii	"\207\242k\365e;v|\203\263\262|\316\302]\022N~\372\332\327\234"
+	.ascii	"d\261\264t\276\346B\356\314\f\n\361d\250\\\331ug\322\233\177"
+	.ascii	"\365\033S\212\357e\331#\027\177\0137\022\364\277\261Q9\036t\005"
+	.ascii	">\3563Pl\013#z\341\251\"S\275"
+	.string	"\3249\312\366<z\340u\215n\227\353\327r\304*\363\326\022\346&\315\235`\320O\020^\352\004\303q\306\277\312}v\f?\274'h\256\362+\376\256\f\032\177\337\013\2477\240\013\272\2774\366\210?\246|eXO\336\360C\250\320\357\356\245:r\303\346\375\263\315mH\241\027\236\267\245\236^^\350\0253e'\003\331\013\353e\321\037\r\017\177\240\242\217K\\eL\225\313\035\223\256s?\243X\372'W\375\310-_>\323\355\375\266\263\327\274\315e\216\240\375J\330~G\204\217W\"w\207\2357\023w\272<\214\t\217\377\306\251z\371S\345D\362o0\234kH\272\243\307\372\267\366\343I\0071c\344\0333\302<X\3676\204\375\365 \272'ckS\267\255\325\211\347l\326\005[};\227\254y\222\222=X\261\033\346(j?\016\335\343\363\034!^\210y\200\276n\246\307\375s\013\356\323\022\272\323\345V\272p6\256"
+	.ascii	">|\261\021b\203\322\037f\306\300\222<*\245\375e\337<\036\026"
+	.ascii	"\357\357@T7\310\177\227\337\2578q$x\311\241\332\360,p\232Y"
+	.string	"\335\261/\330z9\242\265\375\346\325\365(&\343S\235\206}\302.\317\f\"0\377*|y%~0\302<\353|;\312\3334\315\217-t'\372\333\366\355\322\312d\336m\347\372\365\251\\8\022\026\310|\245\237f\242o`_\264\355\362\257\337Mx\241#\371\304\360\375\332\212k\374\366\006Bz((|ssi\002`\026\360\346\357W\321\177\021\310/\003\026\370\327\t\327Fx\343\317\356S\346]o~\240~\027\345\023mU#\232\222\373@\342\263\252\370\231\251\335\201[5P\265\335\302\337\313ZL\341\310K\025N=\315\314\026N\212lo\372\3423\354[\3519\235\275\305\024\313t\177\035;\303\362\300\233pglp\263\317\236i\305 \300>\013\303\355\375\273\247\013\031\017\247\374m\373^\335Y\240\004\247T\032 \370\177\277/\237\2732\353\333x\017*\316\026z\234O\207]_;Q\r+@\344'y@\335\333\305g"
+	.string	"\232F\337P\345\200\234\326\r\357]\350<\035\371\225\277N8\377\243\255\034eK\237\344\356\246n\334\207S\354\327+\274\255\244wJy\224\373\331\343\271\366\031\026\3727\304\033\016\322\\\310\336\261\373\357\240[\274\230Q6c&\332X\326\323{to\315_\026\356c\306\002\254/\337\375\375\372X\277U\336|\336\377\\\354\201{]$y[i;]\260\374Al?\201\343}\314~\352K\327\377\206\026Z"
+	.string	"u\375\013w:\341y\033\276\n[\005\263\323\034\323\215\215h\027\212\274\234K\334\315\325[X\336\037t\330\017\215\347H\364\016\220^\240\366(\350\274P\265o\204\177\235\377k\226\023\2467\241\377\310?\311\374\320\236l\rQ\331\324\272\307\017\321'2\266\213\234\347\264:\356\351\2765{\305\341~\316\350\356\210\261\266S\237\204\233\f\370\303!s\2636]\321\373\217,>U\001\016\020\301\373\310h\316\235\355#\332\037PS\343\203\276\360\375]J\337\371@cT\205WA\264\313AsO\300\366\276:\377\241!\377\373~U\373c\256W\261\362\200\235`\250zlmA\321\375=\273\355\357\231\321FL\354*\263\217\232g\366z~\275\376\336\020\352\005\250\256\242P;3h\320[\272\324Q-\265\306\364\215\337|\327\336"
+	.ascii	"\277{f\356\247\221\343z\277\304ra\253\304\273\246f7\267L\177"
+	.ascii	"\275\313\r\374$\0314\253v\266\024h?\322\232AZ\352\255R\266E."
+	.ascii	"\236\037\265\237\261\270\036\356s\332\216\177\023\364\375\363"
+	.ascii	"\034\034\037j\257Ck\310\304\240.\373\310n>-7\212\365~\273E\272"
+	.ascii	"\234w?eC\253\313\320\364)\246\177\314\314\243\0059\352E\006|"
+	.ascii	"\352J\036\re1v\225\214\017X<\353"
+	.string	"O\243\376\340\336I\f\3708\345\363wx\033k\344\tT\260\351\254\375\254\024\242i\n/(\326\013\\s?\023\324\333;|\006b\345o\340:|\263\324\020\032?\276\273\013\245/*\261\346\224\350\227\222\353\267\324=\345\342:\315\r#\2449\270\370\376({O\006vX\3403Y '\267\234\177L7\237w\354\264\355\020j+\250\177\255\376g\357v\007\032|\315\255.\301\320aQ\307\257\250?\275\211.\240\323\237\022\267\334\024\207\247\342\244\345\n\205\256\212\321\357WL\300&\232\260U?\231\020D\216\213\202\277y\240\357\035]\037\363\366#=yC_\003\243\301\267\263\264\375\321\375.g\263>rx5\260\235\314%\252~pN\375\0207\037\314\301\267\027i\317\227\"\270\267\364\265/\326\377\340X\355\331u\bi~7v\007'\321\302\033C/_\364F\"p\251\362\366j\274\220[?\022\242\316\206J\332\202\225W\241\360"
+	.string	"\326\366\206\303\365\327\365\373\317}\005\210\367\036Y\f\353\206\r'-\277\270\364\b\212\f\006\r\033D\341J\324\350\356P\331\321\241\363\031\321\241\275_\273^\022Hl\177y8\317\207=\340\001q>i{%\340\236\017p\373"
+	.string	"`\333\022\346\005\267\365MrGCw\016\216\374W\004\373\027\037I\317\215\251\245\017/\362\276=u\027\335d\310\210\022=L7\241\324\252\017\222&\037\276V\350\2765\002}\007\366/knpp\007Z\346\002\343\337x\337\232\254\232\320\364\030\255\034\310g\362zU\315\275\347\336q\242\203\313\337\t\377\277[\351\261\354\376dsW\241-\306#\316\013\026\365l\262\354\217\006\377u/!\206+\370\006\241j?\351\320\b\3712HZi\354\216\226\345]\235q;\300\303BZ;\316\362\220\304\377\232c7\224\246e\301\025Ja\f\275\315:\306\334\215\274O\234k\362j\207\374\217\2742\177i7\217\nuL\365"
+	.ascii	"\212\227\262\233V:\017\266k\277B\375h;A\353\232u\277\311\327"
+	.ascii	"\371\342\232\377\035I{\021\257\224>{J\371M\221sJ\375H\303<\316"
+	.ascii	"\357S\213\227\277\0320\224B\357I\252_X=\026\377\233Y}+.\372\301"
+	.ascii	"\37517\376d\325\335\265A\317\370\3718\217\031)\036\374\357*\025"
+	.ascii	"_\2529\355\037\237]\\\032\006\210\223\244\346\356\376\352\256"
+	.ascii	"F<\366\322\320\213\262\356\022\204\361\020\245s\372\302M\235"
+	.ascii	"6\0079}&\034\202\337/\313u\216\343\373k\344\305\244\230\367\267"
+	.ascii	"x\2503\346\317.\037\257\333\342\236Y6\275KY\342Y]\374\036\027"
+	.ascii	"?\265<i\277\007#\372\344\323UO~\313\306\207\023\215\357\004\263"
+	.ascii	"\220\336\r\262u\204\273r\032\344\326\214\337i\370\356Y\242\005"
+	.ascii	"0\202\337%\272\026\202\207\245\300"
+	.ascii	"xu\262\217vm\210\334\035\307=6\216\341\364\213r\f\376\262{\324"
+	.ascii	"\177hd\342\374\025\301\201\223\261d{$r\374\232\224v>;\023\243"
+	.ascii	"\313\007\020lk\275D\226\357V\324\335\213\336\313\247/\347]b="
+	.ascii	"\225!\236%.\363\250\227\350\300@B\321-3rE\225\314\334\267*\347"
+	.ascii	"1#\207\013J{\245\2356W(k\364\361\227\030o\023\3609\346\377\035"
+	.ascii	"\202\2773\335\351\031c\007m\210\373\214\347E'.hB\201\356\332"
+	.ascii	"\272^\277\034\360_Wz'\344/i\377\2204\332\323)\343anq\305\237"
+	.ascii	"i\350\317\346?\221\346W>\236OU\256\024\3053\246)\351\276\250"
+	.ascii	"}\320\357\177\271\227\333\351\214\345nn|\273\327|Z'}\353\005"
+	.ascii	"1sj\363%\b9\217\215e=\301y!\222^\342\302-L\316\024\374\251\022"
+	.ascii	"\364oO\311\274\003\347\317\035\251\357U\345<H\345M\b\370\346"
+	.ascii	"\302\201\222\0031a\224\322/\310\345\360T>\315\312\237<\303\031"
+	.ascii	"*\376\273}\2557\343\211\375{/\236\325\371\315\301y\270\265\026"
+	.ascii	"\345\323\343\344\371\326u\317\370\2733\303\340]\003\251\344\334"
+	.ascii	"\337g\233\210\241\227\327\355_\343\231\350\252O>\334.\035\215"
+	.ascii	"\346\227\354\344\327\024\362\210\317+1V$\316\274'\363\033\266"
+	.ascii	"\037\031\356}\352I\233o\212\234\004\233\301\1777\017G\023\327"
+	.ascii	"\252\274\347\357/B\367W\312\307\210\313\235u\023\352\256\307"
+	.ascii	"\205\337\274\322\324\232\332W}V\227\202\336m\372\246~|\374\261"
+	.ascii	"\330\303\r\f\222-w\262dK\264\207\244\274\310\300\020\271y6?\331"
+	.ascii	"\201I\353\350\324c\253\314\262j\354\t\362\363\275N\177\"\351"
+	.ascii	"g\213\321]6\224\003\301\335wxvN(\354\021\034\211\250\003_\354"
+	.ascii	"\260\217\347\f/\346\230Y\236U|sB\261w\003m\003\fgS\335u\256'"
+	.ascii	"\221W\3216\177\256\001\007\271K\340\270o\354\235\213\324\225"
+	.ascii	"\004\377\020N\205\030\247\367\024\347\217\345n@\277\273l<\036"
+	.ascii	"\273\256\375\234\224\236\032\320!\346:\341\331\327(}'\230\277"
+	.ascii	"\004C\277\371z\223\307\313\261>\250\013.\003\016Vm\277\312[\330"
+	.ascii	"\357\305\024\233\355\306\202g_#\365{\334A\177hr\2317\346GU\344"
+	.ascii	"\200\322?\030\366GV\027\304\372\375\357|\177!7\035}\261I\223"
+	.ascii	"\233\273SnC\234\352(c\356\216G6\274\304\375$\354\262\326\217"
+	.ascii	"\037|\202p\326\241\244\243\313C\231\366!l\377L8\307}\377'v\036"
+	.ascii	"\3259)\361\376\004\274\275\202_C\361\364k\364\351}Nq\020d\035"
+	.ascii	"\367\372n\227\364Q\303\235\022\237\206\331A\271\273\210\215j"
+	.ascii	"\367L)\215\024\273M\311>f-\016\fp\311g\276j\300E\214\236\033"
+	.ascii	"\354\255\353\365\341\265\244\361\274\227\227_k\326W\337\363F"
+	.ascii	"e\025\303\210\234Z\n\246g<\037\314\354|\341>?SU\363\230\372\331"
+	.ascii	"\330\017\300\377\005\234\364\250\316&{n\370\037\271s|\262\260"
+	.ascii	"G\035\331\337\341\247\030<\356r\274\247\373\034\254\354\357\037"
+	.ascii	"\266;c\267\325\234\347\264n\rp\315\270\304|\016)\267.\366\221"
+	.ascii	"\211e\336\276\236\336*\277\270\205Ok\374\246\213;\317\363\251"
+	.ascii	"\331a}SO\275\356\037\347\365]\027)~a\313\374W\231FL\372\003\026"
+	.ascii	"\327\255\374[\231'\352;\331u\260\366|\242\216\026\277\220\265"
+	.ascii	"}\314!\374\201\335;\267M\261t>\013\267\243>}\314\344\216\276"
+	.ascii	"m\005\355m\344wp\332\262\321:\365\220\2479\317\300\326\306\003"
+	.ascii	"\330Y\220\321\007\250/\344Q9\373\262Az\375J"
+	.string	"\003;\332\266\341H\t\243\007\306\372\241\177~Vp\2046>\355\035\316%\255\257\025\214\353\347e\314\274\377\3423\237\3447\302\337)\217\215\347|,V\267\367\023 \017G\237v\333U\2617\307R\212x\240n\332\204>\344\035\016\274\235\360\231=3\351\273\331_\375_-?\314\214\3076\264k\027M\271ur\363\351\244\333U\346T\206\265\371\b\343\353b^\034\227\254\275-\372\373d\037U\3433w\216N6\363\217\331\341\241|\254\274\371I\004{\267\031\177\313\276\207}\242\306\024T\376\\\374\373\204\307\262\302+\354V\317\321X\333Y\345h\2536\2263\023{\326\366\372\344Q\325\277\2508KX\240\266\2668l\210\005\323\r\376\341\200'?[]\214o\232\267i\342\227\001\026\200\373h\017\037\216{\3424\240{\203x\337\036s!\334/Xw5\003}\220\303~y\342<v\366p\325\313\225\1773\313\222c\b\344\325)\230"
+	.ascii	"\331\253\302\313\207q#2p\320\204\340\252\206\314\357\243u\302"
+	.ascii	"\273?\223\235\375n\n\370\210-\257\001\301\224\217#\353u\353m"
+	.ascii	"\234\377(\351\034u\2742I\276\376\034U\200\035\231\323\231\270"
+	.ascii	"\247[=\246\365\363\201\034\354\360\323\313\363`O\356Y\206\217"
+	.ascii	"\b80\355A\207\272\036U}O%\376\354\260\177\210\311\353\222\362"
+	.ascii	"p\267\276\234\025\347\257\016\373\334\354\005\240\277\366\326"
+	.ascii	"0levPy\037L\203\346\357\211\302\025\f\323\316\361\271\365\364"
+	.ascii	"\325\035a\266\365\250 \306\347o\234:\351\037d\237\017\276\\j"
+	.ascii	"\273u\017q\336\204\334\224\223\356`J\327%\270\306\350\277M\357"
+	.ascii	"U0\341\273#\273\377\247\350-\243\362\2264\236\377QM\357\f\336"
+	.ascii	"\023\302%\235'\240g\332\021\177\017-\004\002\037W\375D\361\365"
+	.ascii	"x\226>\300\354\353\345\2275O\205\272\357\240\247\201\036\245"
+	.ascii	"xq\317\n\376/\3608k\355Yn\304R\236\353\3608i\334\347\270^\234"
+	.ascii	"\206$\0373\245\030k\362\370\340\323\027\270\261\\\373\365M\277"
+	.ascii	"Y*\344\231\336l\277\004\303\223\237\225\266\335\312Y\017\236"
+	.ascii	"f\364\216\364n\254\217\264\336w\242\213\247kmCd\2529G\360\372"
+	.ascii	"\303\3333\030\274\312z\275?\345\377\355U\270p\002\275\2602#\365"
+	.ascii	"\331\320u\225\037O\314\246\365??\033\251n\256\3517\301v#\252"
+	.ascii	"w\216\033jq<\363\263f\\\021\031>l\003\370\303\271\336\264\367"
+	.ascii	"\227\266r\244\372\236\003>b\001\336\350j\006\315\236j\373\242"
+	.ascii	"\356\302\td\336)\270\316X\263}\361@g+\352\330\322G\017\200\353"
+	.ascii	"\r\301:*\236\265\377\305\336t#\301\232\355\374\330x\370\273\223"
+	.ascii	"U4p\360\177+\262\357\206\346\255j\n\354\335Rs\370\347\326\303"
+	.ascii	"\357\200\373\013\225\362\240\255\\\227\f\343\252{\225\331\177"
+	.ascii	"\236kGO\"\247\355\377\327\023\023P;\3129\371\007.Nd\374\321k"
+	.ascii	"s\353\377\272\377'\370-\275l\016\177\320\032\3473\235k\236M\361"
+	.ascii	" \360N\205\377:\037\027\002\250}a,\274,u\211\331\367\263\213"
+	.ascii	"}\0307\261s\203\217\226\202\303\264\037!dC\275(\260s(i\315\347"
+	.ascii	"\231\365\027s\366I\272\317\323x\020\001\006\024\365\335\337\037"
+	.ascii	"\016uz3Ws\334\241-<\t~\3657)\033\370#\032\360\237\234\r\353\362"
+	.ascii	"\017\235<\345\363/\377\037A\314\214\361u\362K\351*\267\356\026"
+	.ascii	"\317\355\230\024\356\304x<\361@\374\367\032\373\223\035\357\253"
+	.ascii	"\274\"B\302%\260\333\303\360\245\367\326\203kg\312\236\343\316"
+	.ascii	"P\336(y\261M\\\324\b\177q\345%*\006\260\354h\330\206\n\346U\032"
+	.ascii	"\310\353qj+\002v^\355\346\355o\341\352B\310h\334<\373\016=\226"
+	.ascii	"\330?-\373\035\265\244\347=\212\375\262>\321\324\344\037"
+	.text
+	.section	.gnu.lto_.symtab.a023cfc9b88a5f3b,"e",@progbits
+	.string	"cliPrint"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\007"
+	.string	""
+	.string	"cliPrintLinefeed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\007"
+	.string	""
+	.string	"cmdTable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\007"
+	.string	""
+	.string	"cliMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\007"
+	.string	""
+	.string	"cliPrintLine"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\007"
+	.string	""
+	.string	"cliPrintf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\b"
+	.string	""
+	.string	"cliPrintLinef"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\b"
+	.string	""
+	.string	"tryPrepareSave"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\007"
+	.string	""
+	.string	"cliGetSettingIndex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t"
+	.string	""
+	.string	"getMcuTypeById"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\t"
+	.string	""
+	.string	"cliProcess"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\b"
+	.string	""
+	.string	"cliEnter"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\t"
+	.string	""
+	.string	"__pg_registry_end"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\007"
+	.string	""
+	.string	"__pg_registry_start"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\007"
+	.string	""
+	.string	"rxChannelRangeConfigs_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\005"
+	.string	""
+	.string	"adjustmentRanges_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\005"
+	.string	""
+	.string	"servoParams_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\005"
+	.string	""
+	.string	"baudRates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\007"
+	.string	""
+	.string	"serialConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\005"
+	.string	""
+	.string	"rcChannelLetters"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\006"
+	.string	""
+	.string	"shortGitRevision"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\b"
+	.string	""
+	.string	"buildTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\b"
+	.string	""
+	.string	"buildDate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\b"
+	.string	""
+	.string	"targetName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\b"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\006"
+	.string	""
+	.string	"lookupTables"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\b"
+	.string	""
+	.string	"valueTable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\b"
+	.string	""
+	.string	"valueTableEntryCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\b"
+	.string	""
+	.string	"customServoMixers_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \006"
+	.string	""
+	.string	"serialSetBaudRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\006"
+	.string	""
+	.string	"motorConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\b"
+	.string	""
+	.string	"rxFailsafeChannelConfigs_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\006"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\006"
+	.string	""
+	.string	"motor_disarmed"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\b"
+	.string	""
+	.string	"customMotorMixer_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\006"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\b"
+	.string	""
+	.string	"featureConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\b"
+	.string	""
+	.string	"pilotConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\006"
+	.string	""
+	.string	"mixerConfig_Copy"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\b"
+	.string	""
+	.string	"customMotorMixer_CopyArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\006"
+	.string	""
+	.string	"servoParams_CopyArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\006"
+	.string	""
+	.string	"customServoMixers_CopyArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\006"
+	.string	""
+	.string	"featureConfig_Copy"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\b"
+	.string	""
+	.string	"rxConfig_Copy"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\006"
+	.string	""
+	.string	"serialConfig_Copy"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\006"
+	.string	""
+	.string	"modeActivationConditions_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\006"
+	.string	""
+	.string	"modeActivationConditions_CopyArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\006"
+	.string	""
+	.string	"adjustmentRanges_CopyArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\006"
+	.string	""
+	.string	"rxChannelRangeConfigs_CopyArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\006"
+	.string	""
+	.string	"rxFailsafeChannelConfigs_CopyArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\006"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\t"
+	.string	""
+	.string	"gyroConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\t"
+	.string	""
+	.string	"detectedSensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\t"
+	.string	""
+	.string	"acc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\t"
+	.string	""
+	.string	"armingDisableFlagNames"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\t"
+	.string	""
+	.string	"serialWriteBufShim"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\006"
+	.string	""
+	.string	"lookupTableGyroHardware"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\t"
+	.string	""
+	.string	"lookupTableAccHardware"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\t"
+	.string	""
+	.string	"lookupTableBaroHardware"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\t"
+	.string	""
+	.string	"lookupTableMagHardware"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\t"
+	.string	""
+	.string	"lookupTableRangefinderHardware"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\t"
+	.string	""
+	.string	"bufWriterAppend"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\t"
+	.string	""
+	.string	"bufWriterFlush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\t"
+	.string	""
+	.string	"tfp_format"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\t"
+	.string	""
+	.string	"persistSignature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\t"
+	.string	""
+	.string	"persistBoardInformation"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\t"
+	.string	""
+	.string	"atoi"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\t"
+	.string	""
+	.string	"tfp_sprintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\t"
+	.string	""
+	.string	"getCurrentPidProfileIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\t"
+	.string	""
+	.string	"getCurrentControlRateProfileIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\t"
+	.string	""
+	.string	"strcasestr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\t"
+	.string	""
+	.string	"systemReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\t"
+	.string	""
+	.string	"pinioSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\t"
+	.string	""
+	.string	"gpsEnablePassthrough"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\t"
+	.string	""
+	.string	"resetConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\t"
+	.string	""
+	.string	"pgFind"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\t"
+	.string	""
+	.string	"systemResetToBootloader"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\t"
+	.string	""
+	.string	"motorShutdown"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\t"
+	.string	""
+	.string	"waitForSerialPortToFinishTransmitting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\t"
+	.string	""
+	.string	"activeAdjustmentRangeReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\t"
+	.string	""
+	.string	"serialIsPortAvailable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\t"
+	.string	""
+	.string	"lookupBaudRateIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\t"
+	.string	""
+	.string	"strtoul"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\t"
+	.string	""
+	.string	"serialFindPortConfigurationMutable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\t"
+	.string	""
+	.string	"resetAllRxChannelRangeConfigurations"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\t"
+	.string	""
+	.string	"ftoa"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\n"
+	.string	""
+	.string	"findBoxByBoxId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\n"
+	.string	""
+	.string	"isModeActivationConditionConfigured"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\n"
+	.string	""
+	.string	"mixerResetDisarmedMotors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\n"
+	.string	""
+	.string	"serialRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \n"
+	.string	""
+	.string	"serialRxBytesWaiting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\n"
+	.string	""
+	.string	"writeEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\n"
+	.string	""
+	.string	"histogramPercentile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\n"
+	.string	""
+	.string	"schedulerResetTaskHistograms"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\n"
+	.string	""
+	.string	"getGyroPeriodJitterHistogram"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\n"
+	.string	""
+	.string	"getTaskLatenessHistogram"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\n"
+	.string	""
+	.string	"getTaskExecutionTimeHistogram"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\n"
+	.string	""
+	.string	"getTaskInfo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\n"
+	.string	""
+	.string	"schedulerResetCheckFunctionMaxExecutionTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\n"
+	.string	""
+	.string	"getCheckFuncInfo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\n"
+	.string	""
+	.string	"schedulerResetTaskMaxExecutionTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\n"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\n"
+	.string	""
+	.string	"strtok_r"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\n"
+	.string	""
+	.string	"servoMixerLoadMix"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\n"
+	.string	""
+	.string	"getSignature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\n"
+	.string	""
+	.string	"signatureIsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\n"
+	.string	""
+	.string	"setSignature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\n"
+	.string	""
+	.string	"serialPassthrough"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\n"
+	.string	""
+	.string	"IOHi"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\n"
+	.string	""
+	.string	"IOLo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\n"
+	.string	""
+	.string	"IOConfigGPIO"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\n"
+	.string	""
+	.string	"IOInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\n"
+	.string	""
+	.string	"IOGetByTag"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\n"
+	.string	""
+	.string	"timerGetByTag"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\n"
+	.string	""
+	.string	"getMotorCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\n"
+	.string	""
+	.string	"delay"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\n"
+	.string	""
+	.string	"motorDisable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\n"
+	.string	""
+	.string	"serialSetCtrlLineStateCb"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\n"
+	.string	""
+	.string	"serialSetBaudRateCb"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\n"
+	.string	""
+	.string	"serialSetMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\n"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\n"
+	.string	""
+	.string	"findSerialPortUsageByIdentifier"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\n"
+	.string	""
+	.string	"findSerialPortIndexByIdentifier"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\n"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\n"
+	.string	""
+	.string	"itoa"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\n"
+	.string	""
+	.string	"rcSmoothingAutoCalculate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\n"
+	.string	""
+	.string	"getRcSmoothingData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\n"
+	.string	""
+	.string	"changeControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\n"
+	.string	""
+	.string	"changePidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\n"
+	.string	""
+	.string	"settingsIndexFind"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\n"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	"beeperModeForTableIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\013"
+	.string	""
+	.string	"beeperSilence"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\013"
+	.string	""
+	.string	"beeperNameForTableIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\013"
+	.string	""
+	.string	"beeperTableEntryCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\013"
+	.string	""
+	.string	"motorConvertFromExternal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\013"
+	.string	""
+	.string	"fastA2F"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\013"
+	.string	""
+	.string	"mixerLoadMix"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\013"
+	.string	""
+	.string	"parseRcChannels"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\013"
+	.string	""
+	.string	"getManufacturerId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\013"
+	.string	""
+	.string	"setManufacturerId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\013"
+	.string	""
+	.string	"boardInformationIsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\013"
+	.string	""
+	.string	"featureConfigSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\013"
+	.string	""
+	.string	"featureConfigClear"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\013"
+	.string	""
+	.string	"getBoardName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\013"
+	.string	""
+	.string	"setBoardName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\013"
+	.string	""
+	.string	"startRxBind"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\013"
+	.string	""
+	.string	"findBoxByPermanentId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\013"
+	.string	""
+	.string	"analyzeModeActivationConditions"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\013"
+	.string	""
+	.string	"writeUnmodifiedConfigToEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\013"
+	.string	""
+	.string	"getArmingDisableFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\013"
+	.string	""
+	.string	"blackboxGetDroppedFrameCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\013"
+	.string	""
+	.string	"getBatteryVoltage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\013"
+	.string	""
+	.string	"getBatteryCellCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\013"
+	.string	""
+	.string	"getBatteryStateString"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\013"
+	.string	""
+	.string	"getAverageSystemLoadPercent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\013"
+	.string	""
+	.string	"getTaskDeltaTimeUs"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\013"
+	.string	""
+	.string	"getCurrentRxRefreshRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\013"
+	.string	""
+	.string	"dateTimeFormatLocal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\013"
+	.string	""
+	.string	"rtcGetDateTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\013"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\013"
+	.string	""
+	.string	"sensorsMask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\013"
+	.string	""
+	.string	"getEEPROMConfigSize"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\013"
+	.string	""
+	.string	"getEEPROMStorageSize"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\013"
+	.string	""
+	.string	"stackTotalSize"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\013"
+	.string	""
+	.string	"stackHighMem"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\013"
+	.string	""
+	.string	"getMcuTypeId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\013"
+	.string	""
+	.string	"setArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\013"
+	.string	""
+	.string	"schedulerSetCalulateTaskStatistics"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\013"
+	.string	""
+	.string	"bufWriterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\013"
+	.string	""
+	.string	"setPrintfSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\013"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.a023cfc9b88a5f3b,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1957 @@
+	.file	"settings.c"
+	.section	.gnu.lto_.profile.1b9da044c9b9e2d2,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.1b9da044c9b9e2d2,"e",@progbits
+	.string	"(\265/\375`F"
+	.string	"1\n"
+	.string	":\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4"
+	.string	"\233\364\343\336\006"
+	.ascii	"\001\223\200\225\206\r\002\375\224\236\200\004\003\262\210\367"
+	.ascii	"\241\002\004\314\324\367\215\003\005\376\367\260\205\006\006"
+	.ascii	"\323\347\261\306\003\007\337\251\351\317\004\b\263\320\357\247"
+	.ascii	"\001\t"
+	.string	"\376\322\360\376\013\n\326\312\377\254\017\013\266\362\213/\f\243\224\377\222\t\r\366\377\275\234\007\020\216\307\310\264\005\021\351\321\202\253\017\022\305\336\202\347\002\023\312\220\377\301\r\024\206\345\347\303\n\026\373\374\223\213\002\027\327\222\361\365\013\030\342\263\312\237\001\031\302\223\266\246\003\032\302\223\266\246\003\033\257\267\254\261\f\034\214\266\217\340\001\035\320\205\256\202\b\036\344\352\246\263\007\037\345\220\314\235\r \375\275\346\323\005!\342\275\361\217\002\"\322\204\221\306\001#\206\255\214\227\017$\275\246\347\201\016%\317\234\246\263\t&\342\335\275\264\003'\363\225\213\300\006(\223\244\353\233\b)\234\260\325\254\r*\302\223\266\246\003+\256\300\375\275\006,\232\347\302\235\017-\264\264\266\260\r.\235\202\211\317\002/\347\205\360\261\n0\246\210\320\217\0061\253\364\204\210\0012\267\256\247\224\0073\224\222\204\337\0054\214\330\347\242\0065\201\304\320\300\0166\220\207\307\322\003"
+	.text
+	.section	.gnu.lto_.ipa_sra.1b9da044c9b9e2d2,"e",@progbits
+	.string	"(\265/\375 \021m"
+	.string	""
+	.string	"8\005"
+	.string	"\001"
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.1b9da044c9b9e2d2,"e",@progbits
+	.string	"(\265/\375 2]\001"
+	.string	"$\002&"
+	.string	"\001"
+	.string	""
+	.string	"\003\200\200\200\200\002d\001"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\201\200\200\200~"
+	.string	""
+	.string	"\006\002"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\334\034c\003m"
+	.text
+	.section	.gnu.lto_.jmpfuncs.1b9da044c9b9e2d2,"e",@progbits
+	.string	"(\265/\375 \021m"
+	.string	""
+	.string	"8\005"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.1b9da044c9b9e2d2,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.1b9da044c9b9e2d2,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.1b9da044c9b9e2d2,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_lookupTableAccHardware.200.1b9da044c9b9e2d2,"e",@progbits
+	.string	"(\265/\375`\n\002e\017"
+	.string	"6\031bG\300\030m:(\212\b_\013\305\306\031U;\026\257^\247\004\202\b\002&*\n\261\242,d\f\006l\303jV\"\326\231b\244m\333\f\342G\264\3203\304$q5B\"\"\211\r\006\366MQ6%\366|\364\373\227\007I2O"
+	.string	"M"
+	.string	"N"
+	.ascii	";V\324B\237\005\340\320PR\223B\237\007\330\300\3513\201\031+"
+	.ascii	"z\352s\001\031+\314un\240\246L\237\r\274`\321\230>\037`\301\212"
+	.ascii	"\360J\301\201\232Y\237\021\334Et\336\253\360\301L\f\235?YZ-"
+	.string	"\363\"\316\036\250\211\365y\205v1\005\001\237r*\267\302\035\313\266\203\235\255\020\037d\366W\202\272\212\017\375\253\317\230\024\240>\003\200\202\242\317\001\232\234\3503+a\321\227\350\263\350\210\210\271~.P\363$\372<\272\213\210\310\210\026r\020}&\001\341\031\251\331\241\317-=\310>\227\002*\2352\0231\244\262\036\261\002O\226\"\313\354%\301\216\031t\310L5\216dV\332\232\007 \003\336\2578\320[\334\305a<\306]\177\235\306k\374\306\203\236\343:.t\036\367\361\037\017\362\363C\272\027\271\221#y\222/9\223;\371\223\017=J{#!\007\344\255\261\271\261\341\355\270\r5\201\006\324:\356\003\303O\003g\034\240h\266\272\2058\250\322\326Zk\347\325N3\345@\b\351\302T\2556\370j\313\2328\323\347U\255\253\236\306\2053'\322V\017\246\306h\247p\301hS/\345N\217\250\n0  \243\261\321\001["
+	.ascii	"\225%\301\206\227\255\223\216\332\314\327\304\347\342L\244\325"
+	.ascii	"\357#\346V^\034^)\214\334\273f\367h3\326\317s&&{tf\363\230\261"
+	.ascii	"\313g}13\353\236\303\007\254q(7$\312\004\270v\232Gj\353\031'"
+	.ascii	"<c\362\307\262\373~.?\345\310\263c?\257\374\032f2d8"
+	.text
+	.section	.gnu.lto_lookupTableGyroHardware.201.1b9da044c9b9e2d2,"e",@progbits
+	.string	"(\265/\375`\341\001u\016"
+	.string	"\326\227\\F\340\326(\035(\214\257\261`\022\312\206s\332\311dq\004\323\021)\006\036\0361*\3132\203\217\245N{\364\321JQ{\201A0\237R\006\016\266\207z\233\303f\033!\204\304\212F`\f\303Q\277\007\354\377m\311\210$\311I"
+	.string	"I"
+	.string	"L"
+	.ascii	"_\021\315\0029\313\007\374\r\020\243\001\177\005\270\230\231"
+	.ascii	"-\376\016`1\263\321j.\314R\305\337\321\215l\236\370K\340\204"
+	.ascii	"\214\001\r\n\206Yr\374-p\222\347\253\267\241\331F\354\324j\242"
+	.ascii	"\314f\345=|5\314r\343\257\342\250n\243G\216\344J\276\344M\276"
+	.ascii	"?\361&l:\263\016\033Tz'7\314\204f\336\206\277[\022\022\374M1"
+	.ascii	"r\021\374\0050$\004\1777\210l\313\251\035\004\177=>>\360\367"
+	.ascii	"s\222\247v\016\254#F\234e\006\376\202n\214\374\r\351H\340\260"
+	.ascii	"X\f\206\344`\024^\234\f\fB\f\367\032I\256d@\305\n0#\027\023\305"
+	.ascii	"\221\023\351\212\202U\202\325\227\270\211\243x\212\253\370\212"
+	.ascii	"\2678\316_\034\306e<\3473N\3435n\3438\236\343;\300\363x\217\377"
+	.ascii	"8\220\013\371\316\211\274\310\003\352\342\340e\265\272\322\342"
+	.ascii	"\322\262\332\240Jw\367\261<\026\2206\330^\247\302\362X>\332\335"
+	.ascii	"\r\206\rv\251\227\005\256\251\246\356\232\205\352\220\246\276"
+	.ascii	"\024*\354\016\354\260\373\\\bZ \355\320\324\247\256\345:\360"
+	.ascii	"\321W\211\214 \023,  \243\271\206\003\207\254\372@\236\203\233"
+	.ascii	"\327\303\302\033\2304i\365\373\204\271\225\207\207e2\214\317"
+	.ascii	"\273\232\335\353h\310\230&\207\317Dv\364d}a\327\331m\307\017"
+	.ascii	"\330eg\033\022\221\t\306\265\031\253\370\313-\2112A\256y\036"
+	.ascii	"l\355\2626s\236\007\266\366e\335 \277!\024\001"
+	.text
+	.section	.gnu.lto_lookupTableBaroHardware.202.1b9da044c9b9e2d2,"e",@progbits
+	.string	"(\265/\375`V"
+	.string	"\035\b"
+	.string	"\264\r\350"
+	.string	""
+	.string	""
+	.string	"b"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\320\252\002}\273\001"
+	.string	"\005\001\006\025\001\007\005\001'1\206\b{\370\324Ry\276\006\005\001':\206\bw\bu\301\005\005\001'?\b}\304\004\005\001'G\307\003\005\001'O\312\002\005\001'W\206\bsq\315']\317\001"
+	.string	"?\202\210\200\300\001o3\320\0014\316\001\314\001\313\001\311\001\310\001\306\001\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\007BMP388"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\bQMP6988"
+	.string	"\004LPS280"
+	.string	"\007MS5611085"
+	.string	"\005NONE"
+	.string	"\005AUTO"
+	.string	"\020"
+	.string	"3\342%\200\257c\223\033\260\r\220\b2\001\270\202\214\001\376x\262\253\360~<\263\0039\372\314\257Ae2"
+	.ascii	"8"
+	.text
+	.section	.gnu.lto_lookupTableMagHardware.203.1b9da044c9b9e2d2,"e",@progbits
+	.string	"(\265/\375`5"
+	.string	"U\007"
+	.string	"d\f\312"
+	.string	""
+	.string	""
+	.string	"_"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\233\336\300\253\002}\273\001"
+	.string	"\005\001\006\025\001\006\005\001'2\370\327R}\276\005\005\001';\206\b{\by\301\004\005\001'C\304\003\005\001'K\b}\307\002\005\001'T\206\bwu\312'Z\314\001"
+	.string	"?\202\210\2008s3\315\0014\313\001\311\001\310\001\306\001\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\bLIS3MDL"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\bQMC5883"
+	.string	"\007AK89675"
+	.string	"\bH\005NONE"
+	.string	"\005AUTO"
+	.string	"\016"
+	.string	"<\263\216+\331\261\311\r\330\006H\254\232\035\024\366\003\231"
+	.string	"\\\363\314\003d\3563k\005\265\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_lookupTableRangefinderHardware.204.1b9da044c9b9e2d2,"e",@progbits
+	.string	"(\265/\375 \303U\005"
+	.string	"t\ts"
+	.string	""
+	.string	""
+	.string	"D"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\350\253\002}\273\001"
+	.string	"\005\001\006\025\001\003\005\001'/\206\b{\270\336Ry\276\002\005\001'7\by\301'?\b}\303\001"
+	.string	"?\202\210\200 w3\304\0014\302\001\300\001\277\001\275\001\274\001"
+	.string	"\005TF02"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\007TFMINI"
+	.string	"\007HCSR04"
+	.string	"\005NONE"
+	.string	"\006"
+	.ascii	"OX\314\323\016\260\265\317\254\033T~\003(\002"
+	.text
+	.section	.gnu.lto_lookupTableOffOn.205.1b9da044c9b9e2d2,"e",@progbits
+	.string	"(\265/\375 u}\003"
+	.string	"D\0068"
+	.string	""
+	.string	""
+	.string	"1"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\246\205\345\022}\273\001-\206\b{\370\344Ry\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\003ON"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\004OFF"
+	.string	"\003"
+	.ascii	" \t\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableCrashRecovery.206.1b9da044c9b9e2d2,"e",@progbits
+	.string	"(\265/\375 \276]\005"
+	.string	"\204\ts"
+	.string	""
+	.string	""
+	.string	"?"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\360\254\002}\273\001"
+	.string	"\005\001\006\025\001\003\005\001'1\206\b{\370\346Ry\276\002\005\001'7\206\bw\bu\301';\206\bs\bq\303\001"
+	.string	"?\202\210\200 o3\304\0014\302\001\300\001\277\001\275\001\274\001"
+	.string	"\007DISARM"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\005BEEP"
+	.string	"\003ON"
+	.string	"\004OFF"
+	.string	"\006"
+	.ascii	"Q\245\346i\007\310\334g\326\r*\277\001\024\001"
+	.text
+	.section	.gnu.lto_lookupTableUnit.207.1b9da044c9b9e2d2,"e",@progbits
+	.string	"(\265/\375 \177\315\003"
+	.string	"\344\0069"
+	.string	""
+	.string	""
+	.string	":"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\320\255\002}\273\0011\206\b{\370\354Ry\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\007METRIC"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\tIMPERIAL"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableAlignment.208.1b9da044c9b9e2d2,"e",@progbits
+	.string	"(\265/\375`\262"
+	.string	"u\n"
+	.string	"D\021+\001"
+	.string	""
+	.string	"{"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\360\256\n}\273\001"
+	.string	"\005\001\006\025\001\t\005\001'1\206\b{\330\366\002y\276'<\230\366\002y\300\006\025\001\007\005\001'G\206\bw\365\002u\303\006\025\001\006\005\001'Q\206\bs\230\365\002q\306\005\005\001'Z\206\bo\330\364\002m\311\004\005\001'a\230\364\002m\314\003\005\001'h\206\bk\330\357\002i\317\002\005\001'n\206\bg\230\357\002e\322's\330\356\002q\324\001"
+	.string	"?\202\210\200\320\001c3\325\0014\323\001\321\001\320\001\316\001\315\001\313\001\312\001\310\001\307\001\305\001\304\001\302\001\301\0015\277\001\275\001\274\001"
+	.string	"\007CUSTOM"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\nCW270FLIP18\tCW9\bCW\006180"
+	.string	"\005"
+	.string	"\004CW0"
+	.string	"\bDEFAULT"
+	.string	"\031"
+	.ascii	"D\205\252D0u/\313\0308\007\001\203\255+\034\202\331\006\354\003"
+	.ascii	"9\202\374@\216 ?\260\037\310\017\344\b\362\363\231\023\330<\025"
+	.ascii	"y\0204\316\305>\255nP\371\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableGyro.209.1b9da044c9b9e2d2,"e",@progbits
+	.string	"(\265/\375 \237\255\004"
+	.string	"t\bV"
+	.string	""
+	.string	""
+	.string	"="
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\340\257\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'/\206\b{\370\375Ry\276'7\206\bw\bu\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\005BOTH"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\007SECOND"
+	.string	"\006FIRST"
+	.string	"\004"
+	.ascii	"8S\373\264\272A\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTableGPSProvider.210.1b9da044c9b9e2d2,"e",@progbits
+	.string	"(\265/\375 \233\215\004"
+	.string	"4\bU"
+	.string	""
+	.string	""
+	.string	":"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\267\205\305\023}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'.\206\b{\370\304Sy\276'5\206\bw\bu\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\004MSP"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\006UBLOX"
+	.string	"\005NMEA"
+	.string	"\004"
+	.ascii	"8S\373\264\232@\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTableGPSSBASMode.211.1b9da044c9b9e2d2,"e",@progbits
+	.string	"(\265/\375`\007"
+	.string	"\215\006"
+	.string	"T\013\255"
+	.string	""
+	.string	""
+	.string	"N"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\360\270\002}\273\001"
+	.string	"\005\001\006\025\001\005\005\001'/\206\b{\370\306Sy\276\004\005\001'6\b}\301\003\005\001'<\304\002\005\001'B\by\307'I\311\001"
+	.string	"?\202\210\2000w3\312\0014\310\001\306\001\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\005NONE"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\006GAGAN"
+	.string	"\005MSAS"
+	.string	"\005WAAS"
+	.string	"\006EGNOS"
+	.string	"\005AUTO"
+	.string	"\n"
+	.string	"H`\\\325\016(l\005\031\003\374\361\314\216\253\375|\346\327\2402\031"
+	.ascii	"\034"
+	.text
+	.section	.gnu.lto_lookupTableGPSUBLOXMode.212.1b9da044c9b9e2d2,"e",@progbits
+	.string	"(\265/\375 \251\375\004"
+	.string	"\024\tV"
+	.string	""
+	.string	""
+	.string	"G"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\233\336\320\271\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'2\206\b{\370\314Sy\276'>\206\bw\bu\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\bDYNAMIC"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\013PEDESTRIAN"
+	.string	"\tAIRBORNE"
+	.string	"\004"
+	.string	"V\245\366iu\203\312o"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_lookupTableGimbalMode.213.1b9da044c9b9e2d2,"e",@progbits
+	.string	"(\265/\375 ~\305\003"
+	.string	"\324\0069"
+	.string	""
+	.string	""
+	.string	"9"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\233\336\300\272\002}\273\0012\206\b{\370\317Sy\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\bMIXTILT"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\007NORMAL"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableBlackboxDevice.214.1b9da044c9b9e2d2,"e",@progbits
+	.string	"(\265/\375 \352-\006"
+	.string	"\364\n\220"
+	.string	""
+	.string	""
+	.string	"N"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\360\272\002}\273\001"
+	.string	"\005\001\006\025\001\004\005\001'/\206\b{\370\326Sy\276\003\005\001'7\by\301\002\005\001'?\206\bwu\304'I\b}\306\001"
+	.string	"?\202\210\200(s3\307\0014\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\005FILE"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\007SERIAL"
+	.string	"\007SDCARD"
+	.string	"\tSPIFLASH"
+	.string	"\005NONE"
+	.string	"\b"
+	.string	"hX\f,\006\204\363\314\003l\3553\353\006\225\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_lookupTableBlackboxMode.215.1b9da044c9b9e2d2,"e",@progbits
+	.string	"(\265/\375 \246\315\004"
+	.string	"\264\bV"
+	.string	""
+	.string	""
+	.string	"D"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\320\273\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'1\206\b{\370\334Sy\276'=\b}\300\001"
+	.string	"?\202\210\200\030w3\301\0014\277\001\275\001\274\001"
+	.string	"\007ALWAYS"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\013MOTOR_TEST"
+	.string	"\007NORMAL"
+	.string	"\004"
+	.string	"V-\366iu\203\312o"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_lookupTableBlackboxEncoding.216.1b9da044c9b9e2d2,"e",@progbits
+	.string	"(\265/\375 \205\375\003"
+	.string	"D\0079"
+	.string	""
+	.string	""
+	.string	"@"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\250\370\360\273\002}\273\0017\206\b{\370\336Sy\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\rHIGH_DENSITY"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\tSTANDARD"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableGyroHardwareLpf.217.1b9da044c9b9e2d2,"e",@progbits
+	.string	"(\265/\375 \203\355\003"
+	.string	"$\0079"
+	.string	""
+	.string	""
+	.string	">"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\250\370\300\312\002}\273\0017\206\b{\270\316Ty\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\rEXPERIMENTAL"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\007NORMAL"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTablePwmProtocol.218.1b9da044c9b9e2d2,"e",@progbits
+	.string	"(\265/\375`\267"
+	.string	"\035\n"
+	.string	"\244\020\036\001"
+	.string	""
+	.string	"\215"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\234\360\360\313\002}\273\001"
+	.string	"\005\001\006\025\001\t\005\001'3\206\b{\270\336Ty\276'@\b}\300\006\025\001\007\005\001'J\303\006\005\001'T\306\005\005\001'^\206\bw\330\335\004u\311\004\005\001'g\206\bsq\314\003\005\001'r\317\002\005\001'}\206\bom\322'\211\001\206\bk\bi\324\001"
+	.string	"?\202\210\200\320\001g3\325\0014\323\001\321\001\320\001\316\001\315\001\313\001\312\001\310\001\307\001\305\001\304\001\302\001\301\0015\277\001\275\001\274\001"
+	.string	"\tDISABLED"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\fPROSHOT1000"
+	.string	"\tD63150"
+	.string	"\bBRUSHED"
+	.string	"\nMULTI"
+	.string	"\nONE42"
+	.string	"\013125"
+	.string	"\004PWM"
+	.string	"\030"
+	.ascii	".IXLw\312\006P\244\245Nv\205C4\t\201m\200D\220\t\236\\\203\214"
+	.ascii	"\201p(d\r2\203\214\001\376@&x2\267i\207U\213}Z\335\240\362\033"
+	.ascii	"@\021"
+	.text
+	.section	.gnu.lto_lookupTableRcInterpolation.219.1b9da044c9b9e2d2,"e",@progbits
+	.string	"(\265/\375 \302e\005"
+	.string	"\224\ts"
+	.string	""
+	.string	""
+	.string	"C"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\320\314\002}\273\001"
+	.string	"\005\001\006\025\001\003\005\001'1\206\b{\370\344Ty\276\002\005\001'7\b}\301'?\206\bw\bu\303\001"
+	.string	"?\202\210\200 s3\304\0014\302\001\300\001\277\001\275\001\274\001"
+	.string	"\007MANUAL"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\005AUTO"
+	.string	"\007PRESET"
+	.string	"\004OFF"
+	.string	"\006"
+	.ascii	"Q\245\346i\007W[\373\314\272A\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTableRcInterpolationChannels.220.1b9da044c9b9e2d2,"e",@progbits
+	.string	"(\265/\375 \330\255\005"
+	.string	"\264\t\215"
+	.string	""
+	.string	""
+	.string	"?"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\267\305\346T}\273\001"
+	.string	"\005\001\006\025\001\004\005\001'.\206\b{\by\276\003\005\001'1\206\bwu\301\002\005\001'7\b}\304'<\206\bsq\306\001"
+	.string	"?\202\210\200(o3\307\0014\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\004RPT"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\002T"
+	.string	"\005RPYTY"
+	.string	"\003RP"
+	.string	"\t"
+	.string	"\021\326\020\221@\272j\030R\330\032d\f\b\347\231\007\201\312o"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_lookupTableLowpassType.221.1b9da044c9b9e2d2,"e",@progbits
+	.string	"(\265/\375 z\245\003"
+	.string	"\224\0069"
+	.string	""
+	.string	""
+	.string	"5"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\320\315\n}\273\0011\206\b{\330\354\004y\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\007BIQUAD"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\004PT1"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableDtermLowpassType.222.1b9da044c9b9e2d2,"e",@progbits
+	.string	"(\265/\375 z\245\003"
+	.string	"\224\0069"
+	.string	""
+	.string	""
+	.string	"5"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\370\315\n}\273\0011\206\b{\230\357\004y\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\007BIQUAD"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\004PT1"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableAntiGravityMode.223.1b9da044c9b9e2d2,"e",@progbits
+	.string	"(\265/\375 {\255\003"
+	.string	"\244\0069"
+	.string	""
+	.string	""
+	.string	"6"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\340\316\n}\273\001/\206\b{\330\365\004y\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\005STEP"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\007SMOOTH"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableFailsafe.224.1b9da044c9b9e2d2,"e",@progbits
+	.string	"(\265/\375 \247\355\004"
+	.string	"\364\bV"
+	.string	""
+	.string	""
+	.string	"E"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\236\364\310\317\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'5\206\b{\270\374Ty\276';\206\bw\bu\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\013GPS-RESCUE"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\005DROP"
+	.string	"\nAUTO-LAND"
+	.string	"\004"
+	.ascii	"8S\373\264\272A\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTableFailsafeSwitchMode.225.1b9da044c9b9e2d2,"e",@progbits
+	.string	"(\265/\375 \240\205\004"
+	.string	"\344\007V"
+	.string	""
+	.string	""
+	.string	">"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\350\317\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'1\206\b{\270\376Ty\276'7\b}\300\001"
+	.string	"?\202\210\200\030w3\301\0014\277\001\275\001\274\001"
+	.string	"\007STAGE2"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\005KILL1"
+	.string	"\005"
+	.ascii	"\nV9Z\265\330\247\325\r*\277\001\024\001"
+	.text
+	.section	.gnu.lto_lookupTableBusType.226.1b9da044c9b9e2d2,"e",@progbits
+	.string	"(\265/\375 \274\025\005"
+	.string	"\004\tq"
+	.string	""
+	.string	""
+	.string	"?"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\231\332\300\330\n}\273\001"
+	.string	"\005\001\006\025\001\003\005\001'0\206\b{\by\276\002\005\001'5\301':\206\bwu\303\001"
+	.string	"?\202\210\200 s3\304\0014\302\001\300\001\277\001\275\001\274\001"
+	.string	"\006SLAVE"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\004SPI"
+	.string	"\004I2C"
+	.string	"\005NONE"
+	.string	"\006"
+	.string	"O\221\202\200\001\376xf\327\2402\031"
+	.ascii	"\034"
+	.text
+	.section	.gnu.lto_lookupTableGyroOverflowCheck.227.1b9da044c9b9e2d2,"e",@progbits
+	.string	"(\265/\375 \230E\004"
+	.string	"\244\007U"
+	.string	""
+	.string	""
+	.string	"7"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\267\305\326\025}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'.\270\326U}\276'3\b}\300\001"
+	.string	"?\202\210\200\030{3\301\0014\277\001\275\001\274\001"
+	.string	"\004ALL"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\004YAW"
+	.string	"\004OFF"
+	.string	"\004"
+	.ascii	"8\027\373\264:@\3557\200\""
+	.text
+	.section	.gnu.lto_lookupTableRatesType.228.1b9da044c9b9e2d2,"e",@progbits
+	.string	"(\265/\375 \361m\006"
+	.string	"t\013\220"
+	.string	""
+	.string	""
+	.string	"U"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\231\332\320\333\002}\273\001"
+	.string	"\005\001\006\025\001\004\005\001'0\206\b{\370\334Uy\276\003\005\001'8\206\bw\bu\301\002\005\001'>\206\bsq\304'J\306\001"
+	.string	"?\202\210\200(o3\307\0014\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\006QUICK"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\007ACTUAL"
+	.string	"\005KISS"
+	.string	"\013RACEFLIGHT"
+	.string	"\013BETAFLIGHT"
+	.string	"\b"
+	.string	"6\031\003\213\001\341<\363"
+	.ascii	"\231\373\314\272A\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTableThrottleLimitType.229.1b9da044c9b9e2d2,"e",@progbits
+	.string	"(\265/\375 \234\225\004"
+	.string	"D\bV"
+	.string	""
+	.string	""
+	.string	":"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\310\336\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'/\206\b{\270\364Uy\276'6\206\bw\bu\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\005CLIP"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\006SCALE"
+	.string	"\004OFF"
+	.string	"\004"
+	.ascii	"8S\373\264\272A\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTableVideoSystem.230.1b9da044c9b9e2d2,"e",@progbits
+	.string	"(\265/\375 \233u\004"
+	.string	"\004\bV"
+	.string	""
+	.string	""
+	.string	"9"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\300\350\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'/\206\b{\370\377Uy\276'4\b}\300\001"
+	.string	"?\202\210\200\030w3\301\0014\277\001\275\001\274\001"
+	.string	"\005NTSC"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\004PAL"
+	.string	"\005AUTO"
+	.string	"\004"
+	.string	"V-\366iu\203\312o"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_lookupTableItermRelax.231.1b9da044c9b9e2d2,"e",@progbits
+	.string	"(\265/\375 \343\365\005"
+	.string	"D\n\220"
+	.string	""
+	.string	""
+	.string	"G"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\233\336\360\350\002}\273\001"
+	.string	"\005\001\006\025\001\004\005\001'2\206\b{\370\306Vy\276\003\005\001':\206\bw\bu\301\002\005\001'?\206\bsq\304'C\306\001"
+	.string	"?\202\210\200(o3\307\0014\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\bRPY_INC"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\007RP\004RPY"
+	.string	"\003RP"
+	.string	"\004OFF"
+	.string	"\t"
+	.ascii	"\217TB|\2121\260\030\020\3163\017\220\271\317\254\033T~\003("
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_lookupTableItermRelaxType.232.1b9da044c9b9e2d2,"e",@progbits
+	.string	"(\265/\375 }\275\003"
+	.string	"\304\0069"
+	.string	""
+	.string	""
+	.string	"8"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\234\360\310\351\002}\273\0013\206\b{\270\314Vy\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\tSETPOINT"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\005GYRO"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableAcroTrainerDebug.233.1b9da044c9b9e2d2,"e",@progbits
+	.string	"(\265/\375 z\245\003"
+	.string	"\224\0069"
+	.string	""
+	.string	""
+	.string	"5"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\231\332\370\351\002}\273\0010\206\b{\270\317Vy\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\006PITCH"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\005ROLL"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableRcSmoothingType.234.1b9da044c9b9e2d2,"e",@progbits
+	.string	"(\265/\375 \204\365\003"
+	.string	"4\0079"
+	.string	""
+	.string	""
+	.string	"?"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\350\352\002}\273\0011\206\b{\270\326Vy\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\007FILTER"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\016INTERPOLATION"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableRcSmoothingDebug.235.1b9da044c9b9e2d2,"e",@progbits
+	.string	"(\265/\375 \303\205\005"
+	.string	"\324\ts"
+	.string	""
+	.string	""
+	.string	"D"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\234\360\300\353\002}\273\001"
+	.string	"\005\001\006\025\001\003\005\001'3\206\b{\370\327Vy\276\002\005\001'8\206\bw\bu\301'?\206\bs\bq\303\001"
+	.string	"?\202\210\200 o3\304\0014\302\001\300\001\277\001\275\001\274\001"
+	.string	"\tTHROTTLE"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\004YAW"
+	.string	"\006PITCH"
+	.string	"\005ROLL"
+	.string	"\006"
+	.ascii	"Q\245\346i\007\310\334g\326\r*\277\001\024\001"
+	.text
+	.section	.gnu.lto_lookupTableRcSmoothingInputType.236.1b9da044c9b9e2d2,"e",@progbits
+	.string	"(\265/\375 z\245\003"
+	.string	"\224\0069"
+	.string	""
+	.string	""
+	.string	"5"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\330\353\002}\273\0011\206\b{\270\335Vy\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\007BIQUAD"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\004PT1"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableRcSmoothingDerivativeType.237.1b9da044c9b9e2d2,"e",@progbits
+	.string	"(\265/\375 \2775\005"
+	.string	"D\ts"
+	.string	""
+	.string	""
+	.string	"@"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\360\353\002}\273\001"
+	.string	"\005\001\006\025\001\003\005\001'/\206\b{\370\336Vy\276\002\005\001'7\206\bw\bu\301'<\303\001"
+	.string	"?\202\210\200 s3\304\0014\302\001\300\001\277\001\275\001\274\001"
+	.string	"\005AUTO"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\007BIQUAD"
+	.string	"\004PT1"
+	.string	"\004OFF"
+	.string	"\006"
+	.string	"6\031\363\264\003d\3563\353\006\225\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_lookupTableLaunchControlMode.238.1b9da044c9b9e2d2,"e",@progbits
+	.string	"(\265/\375 \243\315\004"
+	.string	"\264\bV"
+	.string	""
+	.string	""
+	.string	"A"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\300\356\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'/\206\b{\370\357Vy\276':\206\bw\bu\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\005FULL"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\nPITCHONLY"
+	.string	"\007NORMAL"
+	.string	"\004"
+	.ascii	"8S\373\264\272A\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTableTpaMode.239.1b9da044c9b9e2d2,"e",@progbits
+	.string	"(\265/\375 sm\003"
+	.string	"$\0068"
+	.string	""
+	.string	""
+	.string	"/"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\225\205\367\026}\273\001,\206\b{\370\366Vy\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\002D"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\003PD"
+	.string	"\003"
+	.ascii	" \t\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableLedstripColors.240.1b9da044c9b9e2d2,"e",@progbits
+	.string	"(\265/\375`[\001\365\r"
+	.string	"V\230^F\360r\234\016\344\201\3030R3\323\204\215\340\300\253\213\273\252*Z\244\016\225zuw\207VN\232\331\222\307#qx\247\307\226\306\207\025r\347\355\033\374tr\213\272\344\340\2555\231:q\362ZZI\240\307\356\226\320(\311M"
+	.string	"K"
+	.string	"M"
+	.string	"\013*\213\226\311RP\337"
+	.ascii	"P\240\311*E\364z\352[\344D\313l\235H\364\036\250o\214\204\313"
+	.ascii	"l\225\017\350-P\337#! |`:D\240"
+	.string	"\327\244\276\003\234\344z\363=H\310\370\210\351\361\362\303d\272\307\360\236@o\246\276y\003\3639\004:L\276c@x\036&\013\025\f\360c\310\211:\275\324\034\344D\225\327P\337\031\033+3u\022\351}\206\372\006)\307\231*/\324w\b\3148U'\026zO\241\276\033\006h\252\\\352\373:\311\305\"\347\212\001\275\241\372\236)\320\\\005b\t\211%D\226J#)#\033\210Y\210\\\001e\342\210\224\225\b`\221\203q\224\225D\242Q\206\361\306\343<\241\307Z\215\b\377\303A\\\304G\274\304M\034\305S\\\305W\274\005\201\253\276\272\213\277x\214\267.\3433N\3435~\3438\036\274A\321\272\223\213-\310\245|.\326\330/\204\355\346i_g\362\247\323uVeZ\016\327a\027{\326~[\bz\034\007cOSA\351\020L\331\270\016c\213\240;i\006m\327\341\022\204\233O\323\214\260\006zv\3238\224\003\035"
+	.string	"6\263\2562!\363rQNk\020\236\303l\b\362\003Y\202\374~\232\007\371YM\226 \347\254\214\203@"
+	.ascii	"\341 \223\251\f\203@\2622\032d\r2\007Y\203\314A\326 s\237Y7\250"
+	.ascii	"\374\006P\004"
+	.text
+	.section	.gnu.lto_lookupTableGyroFilterDebug.241.1b9da044c9b9e2d2,"e",@progbits
+	.string	"(\265/\375 \233\215\004"
+	.string	"4\bU"
+	.string	""
+	.string	""
+	.string	":"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\267\205\334\027}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'.\206\b{\370\327Wy\276'5\206\bw\bu\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\004YAW"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\006PITCH"
+	.string	"\005ROLL"
+	.string	"\004"
+	.ascii	"8S\373\264\232@\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTablePositionAltSource.242.1b9da044c9b9e2d2,"e",@progbits
+	.string	"(\265/\375 \250\335\004"
+	.string	"\244\bV"
+	.string	""
+	.string	""
+	.string	"F"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\234\360\320\374\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'3\206\b{\370\344Wy\276'>\206\bw\bu\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\tGPS_ONLY"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\nBARO\bDEFAULT"
+	.string	"\005"
+	.string	"LU#\342L\355\323\352\006\225\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_lookupTableOffOnAuto.243.1b9da044c9b9e2d2,"e",@progbits
+	.string	"(\265/\375 \231}\004"
+	.string	"\024\bV"
+	.string	""
+	.string	""
+	.string	"7"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\360\374\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'/\206\b{\370\346Wy\276'3\206\bw\bu\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\005AUTO"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\003ON"
+	.string	"\004OFF"
+	.string	"\004"
+	.ascii	"8S\373\264\272A\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTableInterpolatedSetpoint.244.1b9da044c9b9e2d2,"e",@progbits
+	.string	"(\265/\375 \361\345\005"
+	.string	"\004\n\220"
+	.string	""
+	.string	""
+	.string	"U"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\236\364\320\375\002}\273\001"
+	.string	"\005\001\006\025\001\004\005\001'5\370\354W}\276\003\005\001'A\b}\301\002\005\001'M\206\b{y\304'Q\206\bw\bu\306\001"
+	.string	"?\202\210\200(s3\307\0014\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\013AVERAGED_4"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c32"
+	.string	"\003ON"
+	.string	"\004OFF"
+	.string	"\n"
+	.ascii	"/F \253\306\240!\037\260\r\220\3103;\260\237\317\374\024\324"
+	.ascii	"&\003\200\003"
+	.text
+	.section	.gnu.lto_lookupTableDshotBitbangedTimer.245.1b9da044c9b9e2d2,"e",@progbits
+	.string	"(\265/\375 \234U\004"
+	.string	"\224\007V"
+	.string	""
+	.string	""
+	.string	":"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\360\375\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'/\370\356W}\276'5\b}\300\001"
+	.string	"?\202\210\200\030{3\301\0014\277\001\275\001\274\001"
+	.string	"\005TIM8"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c1"
+	.string	"\005AUTO"
+	.string	"\005"
+	.string	"\002T\"\342\\\354\323j\005\265\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_lookupTableOsdDisplayPortDevice.246.1b9da044c9b9e2d2,"e",@progbits
+	.string	"(\265/\375 \350%\006"
+	.string	"\344\n\220"
+	.string	""
+	.string	""
+	.string	"L"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\234\360\320\376\002}\273\001"
+	.string	"\005\001\006\025\001\004\005\001'3\206\b{\370\364Wy\276\003\005\001'8\206\bw\bu\301\002\005\001'A\206\bsq\304'G\306\001"
+	.string	"?\202\210\200(o3\307\0014\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\tFRSKYOSD"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\004MSP"
+	.string	"\bMAX7456"
+	.string	"\005AUTO"
+	.string	"\005NONE"
+	.string	"\b"
+	.string	"6\031\003\213\001\341<\363"
+	.ascii	"\231\373\314\272A\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTables.247.1b9da044c9b9e2d2,"e",@progbits
+	.string	"(\265/\375`}\006\225\031"
+	.string	"\366\347\232F`\026O:\007\375\035J\377\224*\205)\374\214\302\203,aD\017\224\027=\020G\203\264\216\t[>Xp\007\310$\345&\r3\323\247\310\34079\276 \316W\204\203w\370\302\213\177\365\200\f\321\314Qo\373.!R\266\220"
+	.string	"\216"
+	.string	"\202"
+	.string	"\357J\205!T9\301\256\3248\202!\nv\255J\030L\301\256{\023\242\250h\256|\024"
+	.string	"W\260+_\005'n?a\321\\\373\340"
+	.ascii	"\026\372\334f\342\343\\\375jt\226\374\264k |\241\3526\036\020"
+	.ascii	"\273\016\306\307`\327\242]\017\341\fsA\355\232\250a\372lWEx\303"
+	.ascii	"\033\214wU\214w\326\334f\203\266\353\"\f\200\3317\312N\366\231"
+	.ascii	"\333h1d\320D\225\212x:\211\234\361\316P-\276\t6F\243H\315\324"
+	.ascii	"\311d\347(;\211\324A\"\227=\001B\334\177i\275[\371\317f\006\210"
+	.ascii	"\373.\256\267+\003\302\002\f\370p\277\345\365~\345\300%\r\226"
+	.ascii	"\373,\2607,\017\306<\007\316\303}\225\330;\226\tcj\246\310\232"
+	.ascii	"\231\320\346:\312\336\\\b#\2002csa|s\343\214\315\206\t\336\224"
+	.ascii	"\306f\303X\201\322\273\326\346C8\377\350C\233\017\343\365E \232"
+	.ascii	"\031\021\306y\f\321\354)#\226\325\202F\021mnd\340\245\347\315"
+	.ascii	"\2169\\F\264\2534n\240\205D\273N\035\\)\321\256q\361\003D\023"
+	.ascii	"\001T\267\372\325{\\\353?\316\365 \367\372\220\203=\354En\344"
+	.ascii	"c';\222'\271\331\317<<\355jg{\333\337\016\367\270\313\235\356"
+	.ascii	"u\247\376\356x\035\256\307\3415R\262\345\035\261\3130\325$v\371"
+	.ascii	"\b\333-\275c\313\307x\256\251\315p\261\324\375\324\351}\312R"
+	.ascii	"e\322\r\252\315\322X\271\026\365f\352\022M\252\315T%Sl\276\203"
+	.ascii	"\007\224Q\275\271\n\307\034\251js5\226\021\273b\363\036\001\""
+	.ascii	"Yl\366+\020H\347\016\024H\210%\"\372\2012Y\027N\246\020\353\023"
+	.ascii	"\304t\016A\231;8\310\347\213\237!&\321\3639\304\224AvZ\253u["
+	.ascii	"\2735\\K;\256\345\232\256\353\232\332w\235\327z\275\327|\035"
+	.ascii	"w\223\366\353\277\016l(-\330R\232\260\013{JSi+}\330\211\255\330"
+	.ascii	"X:K/\366\226\356\322\214\375\245\301\264c\207y\3644n\364\032"
+	.ascii	"Gz\322\227\316t\033w\372\323q<\307\243.\365\035\207\037\200\230"
+	.ascii	"\2501\220#X<\373w@C!n\016\020\020\203\0303\363o&\360\311\332"
+	.ascii	"\363\006E\023\351J\375 \210f\364\363\027;_\332\354F`\212U\275"
+	.ascii	"\324\246\217\353\310\267\3461{t\247\236\3052.z\337\236\200\357"
+	.ascii	"[\334&c-MZ\016\321\025\233>\313M\305b\345\346\260h\303o\307\260"
+	.ascii	"tcrp\243S\214\222\031j\255V\331\262~\354\263\311\345eT\346u\216"
+	.ascii	"\213\320\325\200\207\250\302\375\264\035(\022d\306\317\341\256"
+	.ascii	"ca\372\334\377\214\375\235\360sW\342\337\305\264\017\323\216"
+	.ascii	"(\302\b\236l\013:\324!*(\0363\260\2270\326\037-\025`]m\035\t"
+	.ascii	"\371nX\2403\302[\376\311\336)\237(Y{\325\270\362B\005"
+	.text
+	.section	.gnu.lto_valueTable.248.1b9da044c9b9e2d2,"e",@progbits
+	.string	"(\265/\375`v\220\305\301\001:m\002\217Z0\312$\345\034ZX"
+	.string	"\363[\231\004"
+	.string	""
+	.string	"\377\327d\001Q"
+	.string	"\377W\026E\001\004"
+	.string	""
+	.string	"@\320\335\035\335\235\301\243>\343a\263\244Y\326\376\033f\2605\310\211\266\272\n\205B`(\024\n\005A\253h\333\266m[\205\341\250\244*(\"\"\n\211\242f*\333\335^\326~[\345\367\246\035\365\b\003\t\026\ty\223jU\324\222%\304\332\310\223z\334o-"
+	.string	"Od\314"
+	.ascii	":z\222\277\263?l\f\271\017cU\260,X\027l\213\234H\265bj\331!\177"
+	.ascii	"gWl\211\371@\230@\301\236\310sT+\247\226\026\362w\266G\205\346"
+	.ascii	"?r 0\253\303\356\330=6$K\202\035\361\304S\255\240\304\250\374"
+	.ascii	"\235\025\321\365\362/\257\356C\216\354\215\335\033C\262 X\234"
+	.ascii	"\\H\265z#B\221\277\2636*\030X\331\257\356w%\372\303\222G\251"
+	.ascii	"VrD#\362\367\337\335\317\356\202\324\313\354\367\263\362\223"
+	.ascii	"\373\305\345K\252\225\035\021\210\374\375\007\367{s\371\202\322"
+	.ascii	"\207L\201R\031:b\213\202&%\255H\350\354\214\314\254\354(\306"
+	.ascii	"\030\332\023\330\023'\317/\365\n\311\t\253C\364\371Jc\302\325"
+	.ascii	"Di\304\022)?$XZYL\304\233$@5\260\252++\247;\2525\233\250\"?\""
+	.ascii	"\3170\365\312l\214\325\211\341\240\330|tB\232\206T@\275B\233"
+	.ascii	"\3024\305\350\007\020\245\n\250Wkg>\250\f\355\350\301\243\002"
+	.ascii	"\352\025T\354\b\nDd\367\306\220\277\034\277\242\n\250Woq\027"
+	.ascii	"\216\337\215W\311\267\375\202~6~5\236e\352\225]\034E\303\355"
+	.ascii	"E\f\031\277\237\374F\275\212\306D00T\371\371\374T\374X\374Vp"
+	.ascii	"P\261\202b\025\362\367_\n\t\336\240\374J\374L\374z\236g*VQ\254"
+	.ascii	"#\177\377\361\250`p?\020?\235\337\316OD\007\025\013\t\206\223"
+	.ascii	"\277\377r~!\256|\360V>\315\227\305\356O\310\237\215/\357\211"
+	.ascii	"\247b)\301_xq<vW\356\362&\025\313\f\256\252\363\321\345I\337"
+	.ascii	"%A\256\n\\\234\317J\276\244b\241\301>\336T\260\260\271\265)P"
+	.ascii	"*y\224\212\265\006\303`\023\2433;KC\343\240bA\341\234(>(y\322"
+	.ascii	"j#\217}\235\317I\330\230\030\007\025+\n'\177\367=a\263c\302\345"
+	.ascii	"\325\365,S\263\202\240\260:oX\223\260)wI\262\266|Z\317;5\013"
+	.ascii	"\351\335\302\202^\241\2622r\365<S\263\224\236i"
+	.string	"\254\316+U\325\206\345)\252\210\217H\356\243f1\275KPqn\037\365\005\3611\371\206\370\204\344Mj\226\323{c\251\312\343\365H\372\341\363\221\033\251Yfo\013\371\273\017\t\313\333g)\322qd\304A\315\202\2768\362w_\216\325\006./H\310\356\235!}7|Cy\224\232\3656d\223\277\373l\370j\210\260&a\255\274l\323\343~\200|2:\250Y\321!W\f\037\f\016\276x\223b\205\335\237\220\276\026>\026\371\217\252\0254d\222\277\373T\254\341\220\3509\3413\361\244\242j\r\r]\224\340y\222\006\302\207S\367!G_\216\335cC\372D\370t8\250ZEC\020\362w_\b\037\b%RB\\\301\313\353Y:\250ZG\256[\024\313\033Q\313\2612W\327\351r#U\313\311-\223\213CK\251\350Li\253\342\366\304S\265\326\334*\371{\207v*.q\"\242\244\251I\221\363!\177\357h\375L"
+	.ascii	"_\004\261\363d\254\214,'R\265\354\\\033bay9#\230t}u\257|I\325"
+	.ascii	"\212\272'\270\232|\213\020$\220dmu\255\274I\335\nj\361\260\222"
+	.ascii	"$y\035\036\251*\273\307\206\354WVO5u\253\350\311\306\352\264"
+	.ascii	"qTS!\310\225\350B\352>\344\330\235\354\376\204\354Q\035JF\335"
+	.ascii	"\202\266Q\344\357\034\364\246\337y\271G)H\007\222\367\250[\321"
+	.ascii	"\226\353\207\t(\017\244\036AT;N\024\331\377\204\354:z\216\234"
+	.ascii	"H\345Zk\225\344\357\235\250\343\260C\361T\243\013u\033\317;\225"
+	.ascii	"\013\332\026\005\371\374\204\237\016\324etP\271\336Z\025\362"
+	.ascii	"\367\036#\005\013\027-\234\352\344\357\377\244\242\243\350)\272"
+	.ascii	"O\376\243v\231\t\303\344\357\037\265\202\247\247\004\232\224"
+	.ascii	"\374}\345a\321u\372N\027\261&\314!\177W{Z\364\233\016\242\343"
+	.ascii	"@\205'\336\\D\263\340\275\315a\351/\350\354\352\344\302\346|"
+	.ascii	"0\336\254\300=\361\324.\273`\221*\277\030S\240T\362(\265+\032"
+	.ascii	",bc\177\320\244\244\005\005K\234\001e\220\231\225\rU\221\277"
+	.ascii	"\367\306\236u4\354\004`O\234<\361T\257\"`\327\227p\006\023\256"
+	.ascii	"&G@\246%-\r,\255\254'\025\325\013\251\215\325\001\272H\342\006"
+	.ascii	"Y\031\271zVQ\275\224\340X\035\366J\325\260\006\021\251\"LO\242"
+	.ascii	"^\033C\234\232\234\330!\362\367\207z\326\321\b\001Y\352\005\311"
+	.ascii	"\177T/3v\206R<\324#\251\207\224\323P\275\320~W\344\357=\036\304"
+	.ascii	"\033\275\033u\017\307\261Wd\367r {F:\236q\252\327\332\034\253"
+	.ascii	"\363{\"\177O\321\210\236u-\0318\300\021d\277\031\262g\243WCF"
+	.ascii	"\225\213\376\216\320 R\357z1d\374<\357\324\271!,\254\316\357"
+	.ascii	"I\376\336\203\361\201\0273\315\026\213T\260XQd$\177\357\245\310"
+	.ascii	"\321c\377\023\262w\242g\"oR\347\230~0\344\357\275\022=\036\n"
+	.ascii	"t\364tvz\"\362(u\316\351g#\177\357\345\364Bx\360E\243\025/\317"
+	.ascii	"^\241\220\275\233\236\315\023O\2353{\346\261:>)Y\342\243\247"
+	.ascii	"\343jwe\275\353\240\316\241\371\226\310\337\327\272\035V\344"
+	.ascii	"\326\270\274I\255;\362E\301}\340m\246\331\f_\344A\245\r\212\224"
+	.ascii	"4\205m\002\024\200A\360.=V\263\343\212&%-\357Q"
+	.string	"\353\224|BgPDX\243\310\3008HacbC>\021O\234\214\360.I\\^]\371\217\032-\352T\232\370\210\2602\031\201\352#\313\376(\344\272\245\225\337\250\321#\020\254No\202\205D\2045I\236\341]~\254SUWVy\216\032E\022\301\352t'*\337\313k\323q}\262W(\344J$*\037\241F\225xX\235\036C\376^\201\223\r\220\365G\275*\035\327 +\323\272\224\033\251x\321\316#\177_\201\250iw\353\313G\307\225\007R\217\274G\315c:\301\352\364\360\344\357\353\016\237\245\241\343\212\303^\211\220k\216\242\334G\3153S\301\352\364\254\310\337S\"7r\0264o\271\213\034F\n&\0325\326\240\374g\245B\003buz^\362\367u\206\n&\004\206\375o\310\365'FNc\245Z\253\301\352\364|\274\300\200\274\363\034\fQa\377\023re\261\256\310\205V*\350\rV\247\347B\376\276\246\220"
+	.ascii	"\n\021V\237\tP\340\337\245i\025q\\I\330+\017r\355YK\344M+\325"
+	.ascii	"[/G\376\256\256#\326\2355/\257\367\343\264\332\2548k\210\025"
+	.ascii	"D\320:'\177_o^\276\303\202\027\035Z\245\\\201\232\223\243\233"
+	.ascii	"+Z\277\342\242\240noU8\254UGS\362w\265\255\023ISc[\353\260V!"
+	.ascii	"\255<\344\357\252\224_\021\263(P\224\326\2372)\260'ba\034\326"
+	.ascii	"*\246U\204\223\340\224M\223.\256\274i\255rR\347\344\357*\023"
+	.ascii	"*$Y[Z9\321Z\205\226\203\325Q\323\344\357*V\222\013oU\325\225"
+	.ascii	"\325\232\027\225j\365\024U\204Hn\264VAw\260:\352\225\374]\205"
+	.ascii	"\3729\342\225\322\222\2552!\325!B8\254Uo\352\017\371\273\205"
+	.ascii	" y\017\032 y\322w\345?r "
+	.ascii	"p]\213\021#\036\266\332\003\251&\251H\035\326*9u\206\374\035"
+	.ascii	"\001;\216\324\tG\206p\024\021\345Kk\225\235\020VG\345\271A\001"
+	.ascii	"\t\020\215\032j\020\207\265*Z'\177WgXH\242\246\250U\025G\325"
+	.ascii	"\205\255\276@\2521`\344M\253UP\376\304\352|\232\374\035C\213"
+	.ascii	"\025\"\250,\212o\022\240x\027\031\027\260\324\235\243Z\302V{"
+	.ascii	"\220\352\t\023y\324\212\245\004\001V\347\261\344\357\253\312"
+	.ascii	"#\201\021\"\250$&@\001\270F\316W\342]|\337{&\262T\033\025\204"
+	.ascii	"\375fH5G\rQ\2015\313\314\002\254\316W\311\337U\034\365&m\265"
+	.ascii	"\260\340E;\254Yh\217\244n\315\321\331\325qX\263\2402\344\236"
+	.ascii	"\022h\375m\307\257b\377\033\362\255\300qX\263\336.\300\352\374"
+	.ascii	"\216\374\275\347\206\2017///\3579\360}\357\t\261K\322\216\257"
+	.ascii	"\306\266\226\2015\313N\003\254\316\343H\321\300D\354\370e\366"
+	.ascii	"\233!?\n\224\016\253\026R\224\214\016\260:J\371\273\005d\037"
+	.ascii	"\030\233i\266\203/\372\276#\240I\327\227\0230\231U\313\314\003"
+	.ascii	"^)\227\226\022&KdV-\264\nl\301]WG\222 \221Y\265\326\242d(@\376"
+	.ascii	"\376F*P\275~\202\357\3737\325\357t\374\"\366K!\237J\311\344 "
+	.ascii	"\375)\231\376\003\002\313b\024\265\261\321y\022\337\235\254\216"
+	.ascii	"*\177\177\233'2C\303>\325<\224\b>j\004\271\005\233\035\234\007"
+	.ascii	"|\177"
+	.string	"8\375\t|\337{9@x\331\367=u!\246\351\207\r\004Jt\034\031\005\311#\344\357o\216\027C\366\n\205|q\2747:\274\332\320\006r\362\367W\210\311:u|g\004\2754\236g\257V\264\201\232\374\375\005\232{\021\003\206\322\227\213&\\l\220\343\233b\205\n\246+\371\373\353\363\242\310\223V\233.\236\267\347-\221\023\275\032\332\006K\362\367\227\204\027\364\315\261\377\t\371\212xu8\274\332\332\006B\362\3677\004\226\257<{\345A\2767\257M\276\364j\320\rP\310\337\207Y\356\260\f\257<\313^\355M\203+vu\026\234X\221\033\306=\253\274\232\234\006c\362\367!\334\360\355\t\225\266!\224\303\253\331ipd\n[\20504)\303\264<\352\325\242\032 \311\337\207g6\307!\331\320lX\366\304{h\220\006-\344\357\303\261\357\032\353\002{2t\2227=\364H\203\020_dsL\270\206M\362\245\207\"e"
+	.ascii	"\267$-\273;\016\261l\265\0079\324\312\222y\250R\006f"
+	.string	"\362\367a\222\341\021\021\206H\260\326\314~\034\207TV\303\252\347\331C\3212h2%%\204\362\0245\204\312{\036*\227A\225\374}\3504l\312\223\276+\350\345(A\230\226\362\234\207\332e\300\003\310Y\n$\037\303\244\374\346\241\321\fZ\364\270\3231<\032\032\3459\337\026\204A^\2164m\b\307\360F.\364mC\030\240\311\337\207B=.\2252\303\376'\3440\210\206\314\267\0255\001\n\241\366\"\006\214#*\027-\200>\266\332\0039T1L\221\033}\033\022\006@\344\357C\024\303\023A\266a\211!\317\023\357\333\2240\370\221\277\017G\fC\350\fsd\276\215\t\003\022\362\367!\b*n4\213\275B!\2076y2\337\346t\301\035^\205\024Zw\347\332q\3706\263\013\322\344\357.\035\\\234\225\016\337\206\246D\376\356\276Qq\333\\\350\023\357\333\326.\b\"\177w\247\250@\356Y\232\232\224<\352\333\240\027"
+	.string	"\241M\360\346\212\221\231\225u\3706\271\013v\306,\200\353\361|9\001\223\371\266h\235\227\225\036\216%M\\&\271\320\273\005Y \246$N\310vt\223d\271X\371\317\273\rY@D\376\356\"q\217\270\310QY\271U\317\273wC\262@I\376\356NA\021\211R\262"
+	.string	"\307\023\235\033\344\3502\r\021\"\363nL\026\260\220\277\273K8uI\266\372\002\351\376\360\201f\301\016\022\321\3215\332q\264vEG\221\bn\216\247\216\315\273\370\\l\356l\330j\017\322\035r\205\236g\357VA\233\374\335\255\341\322\020\301\r\002a\363.\276\364\212\353\342\350\306pe\270?y\317\273\331UP\006\303}a\3632\026\233\024\366\233!\335\025\256\212\016_\305\256\002$\362w\327'Z\302\204\333\223G}\225h\005I<x>\272\243\253c\377\023\322\335qE\004UPC\376\356\346\2448\2726\366\312\203tq\334\033\231\227;\252"
+	.string	"E^\232w%\212\005)\313\235\215\034\335\334\363\356\345\2242X\211\273q{k\253<\313^\216)\203\230\374\275m\303Y\233\302\226\367\274\234S\006-\265\326\f\004X\024\264\263\334\350\345\3142DAi\315\204b!\324\024\3076\314^\241\220\355\230\030Z\206\035Or\272\276Z/\016/'\227\201K\347nkI\253$'z9\273\f#\264\262\362\244>eE\204\021{\345A\266H\216\344M/\027\255\223\277\267W\255U\021\373\315\220\355T+\225/\375\\\020\005DF"
+	.ascii	"\221\216m\223\375O\310\366\251uz\342\375\334\020\005H\344\357"
+	.ascii	"\355\020\365)O\3729\022\255\222\335\002A\266Km\220\274\351\347"
+	.ascii	"\230(`B\321\376\340\341\201\324\366x~\375\234\031\005=\344\357"
+	.ascii	"\355\216\022mQ\253\243\315\361T\37394\nn\020\365\334\331\260"
+	.ascii	"\205[\310vHh\215\002\030\362\367\266F\033$\201\211\037\240VF"
+	.ascii	"\336\363sP\nxb\234`\341\242m\221\033\375\334\333\004\321\025"
+	.ascii	"(\240\355\211\326\247E\361<\3739\271*\362\367\326\304j\343\323"
+	.ascii	"\216hyZ\022\271\317\317\331\241\311\337\333\235\270\024-\210"
+	.ascii	"6\247\r\361\274\373\271(\230\374\275\305Q\201\227\227%HK\376"
+	.ascii	".\214\306\255\250\273\263{\336=\335\320\004Rt,\340\342\254<\317"
+	.ascii	"\236\256h\002 \362w\341[\230\220\215J\233\020\232\373<\335\321"
+	.ascii	"\004:\344\357\302)\337%t\201&%\r)H\376.<{AfV\2464\001\2121aX"
+	.ascii	"\236$\024\353n1\222\227ax\201\t\277\236jO\3474\201\216\374]\330"
+	.ascii	"\305\005\200\030Z\266p\013)\\\"T\322\341\351\320$\200\223\277"
+	.ascii	"\203 \314\022bQ\360se?\024RxDh$\277y:\t\234\310\337\205V\277"
+	.ascii	"7\031E\246\204R2O\007\225\300\b\021\240\246'\247\274\351\351"
+	.ascii	"\336\202\f\231as\024\002\261{<\220\302%a\220"
+	.string	"\234\350\351\344$\300\241\364#O\352X^-\032<<\220\204=\362\246\257\013\222`\305\216\243<\351\233\262\004\to\034\205D9\212\206\360\344\357B\034n\215 \0335\220\340h\330\210a\257<H\241\f\341\317\363\356\353\2240\244\311\337\2050\204/l\204\206\216B\025,\204+\236g_\307\204\001L\376.L!\364Q\032*!4!\354\311\227\276\016\rC\225\374]\310\0034\221'}\327\r\255\243PG\270#\024\221\347|\335\032\006\036\362wa\016\216\036\317Qhc\257PH!\216\360&\357\371\272(\206\240\274,3\375E\242;,W\2020\370\330\325\315\364\027\213\254\310\305q\370\350\320\005<\270\034\017\205\272\005\333d>Zt\001JE\207\224\265\240Zn\364\321\243\013cio\364\023\314\242\004\241\3449\037E\272`Uv\364D,\030\226\023}T\351B\020\371{\320I\020\254\357P\201\232t\005\271\362\250\2172]"
+	.ascii	"b\302\343\367V\367x\216\301\254\255\240V\336\364Q\247\013<X="
+	.ascii	"\256\216\004\215<\325>\013\332\205\033\253\277B*2%\225\367|\226"
+	.ascii	"5\2278\"I\277\267c\260\311~3d\360\311\351Y\366Y\240.cC|t\001"
+	.ascii	"Y\n"
+	.ascii	"\006\311\227>\213\235\013\022\245\327\312\223V\233\037=\354\025"
+	.ascii	"\n\031L\n\"\345?\237\347\302C\376\036\344\241\244\336\345\260"
+	.ascii	"W\036d\320(\250#\037\361yC.%\344\357\301\" \301\032\307\240\220"
+	.ascii	"\375O\310\340\215\340\320\263\311\347\025=\273X\035\013e\362"
+	.ascii	"\367\240\215\325.H\020F\360\307\016\312@\006g\004\201\362\236"
+	.ascii	"\317s\262\260d'\030\243\3076\267"
+	.string	"\224bE\013\026kM\362\367\240\n\033fLA\236`\217\335\033C\006O\004M<\313>\017j\341\206\374=X\"\212\220`\210\240\216\335cC\006w\202\"\236x\237\367f\201G\376\036\314\0211\004\210\227g\367'd\360&h\303\341\363\354\352\262l\320\244\336\331]\271\313\233>\257BZ\235S\025+rq\035T\252\240\nJ\344\357@8\340\333\004\262'\240\332\024\273\367\205\004B\251\fUx\222\277\003\331\200kX\037\005\rx\226\023\251TE\025v@\211Z\305\310\200c\034T\252\243\n0\302\200O2\004\021i\322\365\345\205T\201\004\227U\021 \026P\013\250\004\270\225\347\250TL\024\342\344\357\300\254\021R\300\252\253#@#\035T*3\nd\362w\240\225\007?E\304\356OH\240T\021\264$\362w`\024\020\212\302S\365)!MC\326~\310\337\201L>\272*\244\037@\200J\371\222J\005\245\020$\177\007\372"
+	.string	"&\345I\254\r$\002X\001s"
+	.string	"\215\200;\200G\371\215J\365FaG\376\016\324qu\005\2641\204\003x#7R\251\344&\334\t\031\340e\337\004 \032\300\031\271\217Je7\301M\376\016\224q\204\205\013\030/\362&\225**\326B\005S"
+	.string	"\022\023(R"
+	.string	"}\202& 9\021\307\200$@\021#x\200$\236xj\325\320\004$\371;p\247O9"
+	.string	"\213\315\003\342\330\2751$0\004\020\304\363N\255*\2320$\177\007\336"
+	.ascii	"m\362\244\036G$\313\356J\024\313\363L\255:\232\340\342.\225\322"
+	.ascii	"b\341\3308v\216\225{\226\251UH\023n\344\357\254\025\025J\265"
+	.ascii	"5\005\352\306\266uP\253\224$@\345\357,\225>U\245\344,M\215\225"
+	.ascii	"\"\243V1I\bC\373.#K\302\310\314\312\234\222\214\211\271h1\341"
+	.ascii	"\362\002\373\312\211\324*4\tM\362w\266kI\023\254\255%J\236gj"
+	.ascii	"\025T\002\017\255\254\n\270\270\250\256\354\376\204d\217\030"
+	.ascii	"\311\233\324\2527\t2\344\357\254\025[e\001\223.\366\211\215b"
+	.ascii	"\213\260D8\250Ur\022v\240V\233\264\211W\020\246!B\362\036\265"
+	.ascii	"*ze\251\307#\177\261=\222~\260>\236g\252UPK\033\022\0220\035"
+	.ascii	"G\254Q\336\243Z\r\265\224\345p\302\326\030\302\301\336\br\275"
+	.ascii	"\273\336\225^^\267\351!zN\037\321It\023\375DW\321W\364\027\035"
+	.ascii	"F\237\321i\364\241~\243\033\365\243\236\324}\364\245\316\324"
+	.ascii	"\211\364\"\335H?\322"
+	.string	"\225\364%\035\254;\351f\035J_\353l\375\255\303u\273~\347\263\361\335\370v|#|(|>>\027\276\027\276\031>\032>\034>\"\337\016\037\017\237\222\017\210\257\311\347\344\223\362M\371\216\370\220\370\224\370\226\370\276|`>2_\231O\212O\315\327\346s\363\311\371\346|X|\321\337\315\017\3477\342G\342w\342\207\342\327\342\347\342\007\364\233\361\023\372\r\375t\374\214~H\277\244_\220\337\322\317\351\367\364\223\372M\375\214\374\216\374\266~J~]?\257_\330O\354\007\345\027\345\247\366[\373\265\375\334~s?\272\037\336/\013\033\202\315ay\330\022\254\017\233\202}\301\302`i\260A,\021[\304\356`y\260J,\020\266\211ub\245\330)\026\t\233\204e\3026a\235\260OX(l\024v\215ec\253\260o,\035[\307\342\261Y\2009@\035`\t`\017P\005p\0050\006\360\007\030\004\254\001$\002\026\001y"
+	.string	"{"
+	.string	"\203"
+	.ascii	"\227\200N\300'\340\024\220\n\210\004\230\004\270\004\310\004"
+	.ascii	"\b\006t\002,\003\232\001\323\200R\200m@7\340\034\220\016\210"
+	.ascii	"\005\030\r\342\004A\004G\004I\004Q\004}\202.\202/\2024\202AA"
+	.ascii	"\034A\242\340QpG\320G\360G\220)($\b\025\214\nR\005\253\202H\202"
+	.ascii	"I\202J\202K\202^\301\257\340X\220,x\026D\013\262\005\247\004"
+	.ascii	"\253\004\337\202sA\272`4\210'\004!\f!\034!$!<!D!l!t!\004\022"
+	.ascii	"\316\020\n\t\207\204:\204F\302$\241\017!\223P\210\020J\030%\244"
+	.ascii	"\022V\t\221\b\223\b\231\b\233\b\235\b\237\b\241\b\243\b\325\204"
+	.ascii	"kB7a\025\241\234pNxE\210\245\265ioZ\235VD[\242\355iS\264*\332"
+	.ascii	"\027-\214vFK\243\275\321\342h\215\332\2436\251\365\3212\265B"
+	.ascii	"Z\2506\252\245j\253\332$-V\313\244m\322\202\265NZ\262\266\254"
+	.ascii	"Mk\245\264TZh\013\327Zi\353Z\273\026\257\315\342\202pC\270#\\"
+	.ascii	"\022\356\t\027\205\313\302m\341\002\2713\334\033.\016\227\207"
+	.ascii	"\333\303Ur\201\270M\256\223[\304\225r\257\\#\256\226\273\345"
+	.ascii	"r\271]\356\0237\314\205\342Fq\327\\6\327\315\255\342\312\271"
+	.ascii	"s\356\025\027\313\360f\2103\0241\334\031\366\fM\fW\fY\f\177\206"
+	.ascii	"2\2065\2066\206D\303\242\341\216!\217\341\217\241\322P\310p\310"
+	.ascii	"\220\310\260\310\360jhd\2705T2\354\032z\r\303\206bC(\303(C\265"
+	.ascii	"\341\332\320mXe87\244\033F\207x/\316\013\342\335yG\274&\336\023"
+	.ascii	"/\213\267\305\373\363\312xk\2746^\242\267\350\335\361\362x\225"
+	.ascii	"^ \357\220\267\351"
+	.string	"%\362\026y\255\336\253\027\353\315z\233\274\\\357\2237\3545{\241\274j\357\332\353\366Vy\345\336\271\367\312\213\005\266\201o`\035X\004\\\002\356\201U\300+\340\030\360\017\034\004\327\200\211\340\"\230\007\334\003\016\002/\301O0\024<\005S\301G`$\360\022\230\t\374\005\203\301dp\031\234\006K\201\251\300P\030\016\266\002_\201\261\3046\361M,\"\336\211M\304'\342\0251\2138F\374\023\333\210\205\342\2428G\314#\356\021+\305@\342\246\330).\022K\305W\261\2218+\326\212\233\304\\\361\2238,\216\022\237\305l\361\224\270J\374\026\317\305t1\2268J\274!\342\020E\020w\210=D\023D\025\304\025D\030\304\030D\032\304 \"\021\261\210\270\203\310\203\370\203\250D\034Bl\"\026!J\021\257\210F\210YD-\"\027\261\213\030F\024#B!F!\256\021\331\210oD8\"\035\261\216\210G\314\322\002\242"
+	.string	"-;-#ZL\264\234hY\321\302\242%F\313OK\215\026\033-D-E-;\b\320\362c"
+	.ascii	"\317,\016\330\331\354\340<`\265A\362\221\224/\375\326[\b6=x\314"
+	.ascii	"\364\027\225Zt\264\034\265\030\345K\3175\264\241-\207:\204\243"
+	.ascii	"\345\206\314s\025m\020\023Zg\330+\024\262%\210\006\207\347B2"
+	.ascii	"\"\177o\001j\221!\241\347\002F\313\213\274\351\271\2246\004i"
+	.ascii	"\321}T\244p\302\201\302\307\323S\202\303s\231mHA\342\227#\242"
+	.ascii	"E''z.\264\r8\362\367\226\020-6-8-7\034\236k\r\0047\371;1\017"
+	.ascii	"\350J\024K\207\347z\003\301\311\235]\236\324\247*0\005\343\354"
+	.ascii	"\177B\022\347\344\362\233\347\222\003\241\210\374\235h\245\255"
+	.ascii	"\212\233\314s\331\201\200\004\235\"\002\221\312\207\027\277\265"
+	.ascii	"\366)\215\250F\224\362,\373\256 \020b\240\235ap\311\210f\304"
+	.ascii	"\262|\351\273\216@\020!\177'\216\r\301\236\020\235p\370.$\rq"
+	.ascii	"\362w\342\027\321+Ob"
+	.ascii	"c\2743\336"
+	.string	"%M\210L\236g\337e\246A\212\374\235\250\204\2705\001\214\004+I\207\367:Zr$\246\262\"Vux/$\rN\362w\342\024\021\354H\204\"B\214\312o\336\213I\303\220\374\235\370Dt\n@\313\022Q\b\221)\357y\2575\r-\344\357\304 D \256\004${\345A\022}\020\223\236w\357e\247\201\204\374\235\330c\202\216#\243\234\350\275\242Wr\f\331j\017\222\210\343F\020Q\210XC\004\242\r\256w\251\020\343\034\2112\354\370\013I\234\001$\363_GO\344\357\304\037\013\352\035\261\305\013\242\213\334\347\277\314>\330\222\277\023Y\270\240HA\364A\213:q\201D\t\"\217\314\177\255}\300cD\357\306\221\030\302V_ \211:\304\234\334\350\277>\240!\177'\202\220 \213\255\366@\022m\362\236g\377\365\366A\n\274\t\240vW\356\344>\300\251\263\"\027'\363_vpp@2@\335\332r\242\377\212\n"
+	.string	"\212\374=\246R\201\2245\265\240&ih\257\005e1\224\330L\346\305\206\004 %\177\217\311b1\021\342\2618\244/\241\344\202\336\215c\354e\307_\310\330\t\230\314\213\025%M\305]j\017\006]Jl\265\0072f\262$\357y1'\001\b\311\337\343\255\fl\220`%\221y1\263\024G4\240\262\212\253d^L"
+	.string	"7S\320\r\240l\225\t\031\023\211\243\362\246\027\363\240\212\374=~b\262W(d<D\b\324L\376\036/\305A\206\034$\305?b\037\271\321\213\275y\260\004\351\233"
+	.string	"`\024\357\210\217r\242\027\223\363\240\210\216"
+	.string	""
+	.string	"\361\216\361\r\242\030\307\363\354\305\354<P\222\277\307C\035<\321\250\021\007=\303~\254\310\203#\371{<#\226\221'\305@H\356\220\007.`\2748\252\321B"
+	.string	"C\261\217\275\362 c\025q\n$\017Z\310\337c\024\037\304<\366G!\343\236\270\204\222\007;\362\367\230D<BC\214\023\207\260\337\f\031\353\3049y\316\2171u"
+	.string	"'\177\217A\340\301yp\226\347\335\2179u\220&\177\207\243\033\340\270:\373\243\220\360\035l\367<\3731\263\016\300\344\3570\035,'\002<'\003-\203\020`7\373\315\220\360\033\\\345y\366ch\035$i\033@\325\332\024\230-\027\372\261\265\016\220\324\b\020\005\r>\313}~\f\332\301\r(f\304\002\374\336\302\306`\261\274\347\307\336:p\361\304I\213\001\270\274\272r\243\037\223\353"
+	.string	"nr"
+	.string	"8\211\026\254\004\336\312\227\236,("
+	.string	"sYX\030h\200"
+	.string	"+#\360U\236\363dC\001 \253J"
+	.string	"\033\204\b,\005\027\311\177\236\254("
+	.string	"R\362w8J\001C\234\232\216r\ba\312`\0010\322\017 \260R\036\365dH\001@\341#I\003"
+	.string	"0\300h\307\221\222\025\371;\254\003\316\261A\003l\f\341\270\361\334z2\246\347\022V\007"
+	.string	"\\BS\0358"
+	.string	"\210\306\f\231'C\233\222\277\3032\036"
+	.string	"\263p\001\003~\2217=\331\032"
+	.string	"\222Z\f\271"
+	.string	"E\n\330'7\3722$"
+	.string	"\330\220\277\303'`\023E@\214\260W($\314\003\223\220\3712%"
+	.string	"\370\310\337\341\035)\025\350\b\203\260\377\t\t\347\300!\236q_&\307\001\234\374\035\306\231\302\313\313b\207\026\235Pwg\367<\373\262(\007_\362\367\227\016\350\370\302\305Y\351\360hAR\362\367\367\215J\0334o\3724&\016\220\344\357\357\224\227-\357\n\315V{ _)o\232\314\2479q@\343,\212\317\310X\031Y\207O3\343\200\204\330\221/'/Xn\364ih2\026\257\256\037\022\350\361U\302dI\276\364ik\362\232\374\375\335\372"
+	.ascii	"\r\313&9\222\004\211\335\023#XSo\325K\225\367|ZT\306\222\312"
+	.ascii	"z\212\202z\236\275\224 9J\376\376:i-\ty\231\362\246\227b'\357"
+	.ascii	"\220\277\277A\266\222~\370\340\360R\2422\f\371\373\213\364\366"
+	.ascii	"\210\003)L39\303\361\206\r#\304\204 \201\206\256\231\341\024"
+	.ascii	"/\3268\314]{`NH\211K\273\331\222\326\316\231\231\211\267\022"
+	.ascii	"$\340I\033\246B\261H\273\351\b13LS\370*\355\033/\026i8=\322\312"
+	.ascii	"\340\360H+\333\367H+_wi'\213\265q\371b'\351\342|\244\225\260"
+	.ascii	"k7\235p\234\3267Mc\274\351\230z\004\3339\277\320\3700u\332\314"
+	.ascii	"\345\233&k\0173Lqf\336\364K\233\026\357\331h+\177\301\024Y\254"
+	.ascii	"c\202\251\233:)\b\361\266V\3227\314\\\274\235\263\355t\336\027"
+	.ascii	"\322`\032St\233w\361\036\022\323\021b(\244#\304`\300g\232K\333"
+	.ascii	"B\355\301\306i\017\366]\033\235\365\362\270\264\213\367\004\251"
+	.ascii	"\263\256\357cm\234?\330\312\331C\023\006N\235\363\207\031z\376"
+	.ascii	"@+\343\324h\317\270\275\234\031\246\270\223\206\231CH~\270\235"
+	.ascii	"\265\221\251\274m:\303\322.\326\316\231\017w\373\341\226\220"
+	.ascii	"\316\315"
+	.string	"8\205\323b\221\236\2157\263X\337\022\206\314\342\262\236?0_\220E:\371Bt?\320J75.i\245\222\331\246J\232\346l\254\213\313\032\347rf\256\2353q\332\362*i$\244\316:\311l\323z&I{\270ofq\276c\360\367Mk\350$q\002\r39K\220\326\367\214\261\305\002\f\355L\3324\214K\234\022o\232\371\002'\351\027\245}l\323\032\334.\322M\332\375@+)$\22330\025\226\266\322i;\353\273\306\23551\303\364\256\361Z9,\326xmt\361\340\234k\347\f|\327Iz\306\351\227bK\315]\3438\3752\327\305\233\t\343bABjd\332w\335\304\351\027\033N\217K{y\3234\027\322$]\264q\373.\3167\023f\276g\214\030\204\266\321M\357\332N6m<9\243\204i\272N\322Eg\213\323/\266\223\206\256\261\320\264\22304\314$\234\244o|\246^\316\306\001\bS\343"
+	.string	"&\2444\314\244\233\306\034\355\030\343"
+	.ascii	"\206\306\3328\2008\255\235\311\231\346|\327\370\262.\266(i\232"
+	.ascii	"o\2342=\334\265s6\326\312\233^\316\314\366\215\023S\374\246q"
+	.ascii	"\347|\\\332s\262^.\351\230\242\213\321V\316w\f\316\3361\316\032"
+	.ascii	"\247o\241;,\266A!\r]\003\024\266\316\231\206\256\t\"\351\372"
+	.ascii	"~\231\351&\376\322M\034(\241B2\311\274\341\370\256\361\"}\323"
+	.ascii	"1\305\031g2_\352\033\247\215\315\231\231B\332\264\221\263\262"
+	.ascii	"h\234g\224\2660\231\244\225\316Vy\323N\333HL\2257=\343\316\333"
+	.ascii	"\206\231\227\3149I\027)\244wm\264=0\357\346\354l\036\335\032"
+	.ascii	"\334v\322/-pj\234\241_fg\3638L\231u\322N\322\307\271v\316P\370"
+	.ascii	"\300L\276\274i]\\2\347Z\311\214\231\361\3329;\233G\013\003p6"
+	.ascii	"\217105.\351\027\032\272\306M\215\265\363\256=\3247\r]3!U2\227"
+	.ascii	"\265qv:\353\"\363n\316F\273I\\\326\036\352\273\211\301\202\032"
+	.ascii	"\247=\330x\221\256\2153\f\f\263F\322\370\\C\323\320\313\231\333"
+	.ascii	"\003wi\217\0203\177\240\225\023Rf\363C=\327\036\356\231\342\f"
+	.ascii	"\323L\316\313\032\243K\2131\226\220\216\0203\207@LG\2101\276"
+	.ascii	"1E\234\2714\266\030\355\346\320\271\254\233Jfq>\322\316\031\247"
+	.ascii	"_<PH\351\331h7%T\250\301m\017\364}\234m|I\023\2157Ms3a\214u\r"
+	.ascii	"S\241X\244\203\306c\234\032\223\314\030gm3\233x\355tIk\245\215"
+	.ascii	"\013\323\032:Y\033\333tB*\001Nk\356\332\003\263X\337s\214\223"
+	.ascii	"\276\213/\2153\337\264\215[\322\346\214qi\323"
+	.ascii	"\270\351]\343v\233\272\312\031\247\321n\306\351\b1\263\323I7"
+	.ascii	"i\230\311\231\206\256y\323\227\202K\352T\316F\272\216\241\221"
+	.ascii	"Lf\362B\352\264?\320\026\356zi\3237>3\357\"Ml\332,\013\3036m"
+	.ascii	"\343\017\346\327\264}\251\017\3067!\215\301\217\313\372\306\235"
+	.ascii	"\025\322%\323\306[\332\024/\32600\022\360\273n~\250g<i\343\363"
+	.ascii	"\2229\202}3c\\\342\233y\337\265\205\024\006\206\211\317\024\235"
+	.ascii	"/tK:\327\316\231\226\364\003\235\254\357\231\206\256\231\215"
+	.ascii	"5N\337\307\032_\332\023\204mJC\327\004c\017Fz^\332\312\331\210"
+	.ascii	"\3174\361\031\346|3q\246\262%\305\2273\314b\235\264a\230wsf\342"
+	.ascii	"34^;\353{\246a&\2234\206\024_\326\305\273n\336\365\361h\337x"
+	.ascii	"\005\307%\335\222.m\3728'\2317\276d\026\347\230\342r\206NJHo"
+	.ascii	"\272^\332\311\031w\316\3341\3700\211"
+	.string	"\343\314;\006\237\361em;\227\364\215\273\244M\347\\\343t\222\331\204\201!\"\355\246s\206\201yS\334V\332\311\371\003\255\234a`\210\351\315\304\2134\314\034\2033\231J\347\f\003\023\247\270\223\311|\231a`\200u\221\276\347d\355\241N\302\251\261\306\225I\334M?\324\311\346\214\021&I\307\314\312$\376\246\370\322\236\2257\235\244g\034g\306\274\2512\211\317K{6\332Ma2Y\027\353[\002\206d=\003\363\241f\204\271X\244-\244\307\245m\244\353\030\343\fn\343I\232i\337\264\007\227\364\270d&g\234N\032\353\272\351\234\215\313\031\346}\254 \255\213K\032w\332F\tR|Y\337\367L\261>\322x\222\351a.:ke\363\306Pt\326\030\334uSY\343\263\261N\276\320N\3338\327\334x\255\254\2235\236!u\026m\334i\3434\356\234\221N\032\207\323\332\310T\316\307\231\227\332(\244q\316Nf\323"
+	.ascii	"s\215\323w\234\326E\372>\316\312\233\236\227\314\371\246i\306"
+	.ascii	"i\215\323\367\\\217`+m\274\311\264\220\3263\365\214\314\\/\355"
+	.ascii	"\244\221\256\215\363]'g\214uL\321\351\222\036\227\266\362\246"
+	.ascii	"gd\321\306\235s\235|\241\227\265\204TY\343\316\032\347\314\254"
+	.ascii	"\215\266\2078\306\303l,zp\223\314\"\356\234\t\201\221\236i\230"
+	.ascii	"7\2064I\333w\355\254\220:o\034\247)\244\310\245\235|\231k\347"
+	.ascii	"\314\334t*g\374f6k\350d\323i\033-X\332\263\261N\016\323\243\r"
+	.ascii	"\263d\026\335\364\003\363ef\332K\273\031L\235\030\322$\355\341"
+	.ascii	"\256\361\245=\343Me\215\343\364\354\2416\316\270\275\2641H\227"
+	.ascii	"L\333y\327\036\346$\263\310\304\231w\363BZ\33738]\303\314u\321"
+	.ascii	"\366P\033\213\367\206\r\0336l\330\260aC\335\254\301\2353/o\352"
+	.ascii	"\234y\261\233\316\231\b\024C\260\207\251\323Y\337F#=\027C\260"
+	.ascii	"o\246sY;%\244\311$\363&\2461E\334n\266\2444t\315\274<\332Iz\016"
+	.ascii	"af\3365\3078u\326\370\314\322V\316x\355\204\201a\316\365\222"
+	.ascii	"9B\255\264q\013\251/u\3421G;\t#!u\316\265\322\306\2253\356\264"
+	.ascii	"\215s\222\306\231\370\354\304i\334\331\322\323\272x\3170\235"
+	.ascii	"3\236\244\347%\323\306m'\263)aC\255\244\227s\b\363];g\346\017"
+	.ascii	"\314\0278\255\225\364r\036\300|\327\316\231\371\003\363\005N"
+	.ascii	"\213\0378\217K\033\307k\247\006;Y\324\260\264i\245\206\342\355"
+	.ascii	"\324\360\301\205\224\331\254o\r8\223yk"
+	.string	"\020\246\265\222^\316\004\230\357\33293\177`\276\300\351W\275\325c}\3267y\256\177\362a\177\366h?\345\251|\334\313\375\335_\371,\237\247\352\250\"T\024\252\217\372\243\312Pm\250Bj\016U\207\352C\375\2416\251N\252\224:\245\032Q\217\250J\324%\252\227\372\245\216\251d\352\231\212\246NQ\251\250p\252\025\265N\265S\263\250yk\316\252\263\232XO\254-V\027\253\214\025h\265\261\n\255:V\2435i\365\261\nY\207\254EV\251\325\310zdU\262.Y\277V\260\225l-[\325\326\265\325m\255\262\316\255t+\2265\332\303\351\201\350\215\350\221\350\241\350\371\364Z\364\\\364\200z3zB\275\241\336QoG\317G\357G\217\251'\244\367\324\203\352M\365\250zGzHz[=%\275\256\236W/\254'\326\203\322\213\322S\353\255\365\332zn\275\270^\214x\250\324\304]P\"\341\350\310\314\024\t\f\004"
+	.string	""
+	.string	"\r\203\0304(\210K\023=\260\345\r\024"
+	.string	"\034{tD\"4dL\035\223d\334\200\f\001"
+	.ascii	"\032nQ\f\003c\212\334\333\246\213\274\332\204\025P\352\023#\373"
+	.ascii	"${l\273t\370\373\332\304\346\3660\237\320\347`X\364N\027\266"
+	.ascii	"\261\362.A6\312s\003\024\350C}b\002\016\234\312\357\362F+\255"
+	.ascii	"\217P\004\252\222\301\2242x\004sm\201!\345f\216\240aI\302\021"
+	.ascii	"}\275\214\225\037\346\330\310\203\222\025\023\022\265P\217"
+	.string	"s\346\325\021[\223u\342\343#i\tf;-\251@\027T\253\210\2461rd\252\021\r\004f\203\231\211\302\271\326\237\352tB\013\232C\257\204WY0\001\273\f7\n6\2554\346U\264L7d\003\341x\004\323g\214\312\220k^{WHR;{w)\004\026h\"\200\307\301\352\016\300\252\360p\b\002`R\266\0178\242\326\352\247\035\002\310\027\034-\351,Q\022\360\001N\245\253yH\276R\341\354]>\217\342\236v\276`\3214\223\346\301\343\253\322\262\237\375\345\242\225\234\200\346>7\352\210\214\353\372\350k\177\300\b\253\360\001\003W\025I\321w\217\235\346\320\027\334`@b\244W\233\013Z3m\355\365xxX^?\257\344+\031\r\303h|\234\323\007\341]\03623\350\365\313\212\214B\273\256\244p\n\262\234\216\304\246\265+o\333\374\314\340F\335\345\201F\3553\240B\374:\016\\\212{F\317\306\256A\211\036"
+	.ascii	"\332\350\"J/\200\030I\265\205\204!\247\365\024\231\300\203!\363"
+	.ascii	"\221\024\317\273\215\253\312\232~'\031L\265=\232hMu\375<\250"
+	.ascii	"\005[\203\n \263\232\275\037y\242\026\344\336C,D;\216\355j\027"
+	.ascii	"\306\230\233\350f\377\177\261\307\213\216\342\216\\\364\360\001"
+	.ascii	"?\216\0011\303[\201\007\030\370\377z\037\251\237Ng\037`%\344"
+	.ascii	"\311&\200C]p&\272\272X\017\3774\374\355\346c\020\301M\031/\330"
+	.ascii	"M\013W\020:g'\370\242\026\261ma\346\250\004\031w\032\353\360"
+	.ascii	"\210\020\270cx\312 \013\346?\3453\n\017\202\026\034\177+cHU\316"
+	.ascii	"O\2022\356\220\005\310\275;P?Q\310\bX\025\007\226\006N\222\312"
+	.ascii	"\314\344l\327U\330\b\203\323\330\273\266T\366\210\336\230\320"
+	.ascii	"A\320\316\214#\305\212n\337&\307V\316?\370\201\323\273\254\350"
+	.ascii	"\251\t\230*\016\314E$\246>\265Ph\227\177\330b\343\254\022\245"
+	.ascii	"\270'\242\3301\\a^=F\325\344\026\270\306)\355\317C\306E\362<"
+	.ascii	"2\307Mz(;\217^\254Wp&\032\270\373%\235\031\274~u\316\376\213"
+	.ascii	"\216*hP\275\321T\001R<\007\305\024\374\277\215\260\005\035\374"
+	.ascii	"\205\235\006p\240\320\236W\321\214\236B\220\366\3042\247\343"
+	.ascii	"\247\244\334O\240\033\243\217\231\230xU\355\267\310\376t\021"
+	.ascii	"\236X\013\005\002\274!\355\t4,\245f75\221\262\353\0322\241\264"
+	.ascii	"\0321\020\243\320\342\347\037;~\344\364,\372\305\275\360?\237"
+	.ascii	"\206,\313\200+\212\3142\371\246\374\013\035\267\371\315\347\253"
+	.ascii	"\001`\237j\n\2169\\\205\036\276\211UA,\376\034"
+	.ascii	"\252?E\003\"\357\232\314\213\267/d\345\272\023y\363 -4t\"\243"
+	.ascii	"\232\200\017\270\304\322P\025\214K*\336\023\236\303w\202\324"
+	.ascii	"\275z\313\361Q\233\231o\260G\350a\306\036\221^ND\247\003\235"
+	.ascii	"$+5\304\362\264\b\335\303\354\020\303t\375\34321\343~]Cvt\225"
+	.ascii	"\354\"{O\344c\023/X@y\205\222\265\221\026\314\354\343\0172\376"
+	.ascii	"_\204\275(\031\331=\252\223?\230\305\035\217\274+\026Dn'qPH\027"
+	.ascii	"\0351\016\267:\275\376_+\252.\020>\245\276\025b\231\032C\267"
+	.ascii	"\323\276\363&)N\031?\320.g\203\374\366\361\372\237\301\021~\032"
+	.ascii	"\321?0ofG\257\346\273S\306k\021)\006\f\341'%\261\347\301\371"
+	.ascii	"\017\202\220\236\373\267\331G+:E\312\344\255gB\250\266P\212\361"
+	.ascii	"\231\377\251\271\021\252\364!\210\330t@\251\322\261\024w\344"
+	.ascii	"~<r\203i\344d\276>\270\026\316<\265\337Z9\357w\203\271d\001\020"
+	.ascii	"\256\220\273^$\371\360\177;\255*\311"
+	.string	"]2\210\315|\370\327\330\365\\\037\257\367\303\267~\336\324_\215\236\335\353\225\266\262\377\224\306\247I2\220 QZ\026\375\317\320`\246Y\337\356(\261V\340{&2\342O|}\177\236\247\243\350\255k\256\021\027H\301\265v\320\177\023j\240\356\334\247/\231\021t\207\256\006\254\233\206bl\273\331\277\273@z\213\350E\250\374\2241\221O-h\220Z?\032\227\013\226\261\300Z\215u\376t0\255gk\352\234[)\203\251\223\217*\252u\335\0073g\225Qm\376,\321\371\340\251p\375\204Mr\336Z/\207\177\227q\306o+6\216=h3b1e\223tX\245\236\224P\"}\243\340\366\022\3474\377\2402\005\371\357;\351+R\275\277\317\275\304\245X$4e\377\304R\006\300\214\034\353\305\337\347#\210\b\245\223\232\0361/nYg!_\300\310\206\324-\300\006U\234\352\037g\362,\370\310U\004%\202a[!\303"
+	.string	"\247\255\361\253\233\353x\273\332\202''O\364a\365\337\017\202\030\212\340\361\177\033\317\225\300Q\326\002I]R\345\244\230\366x\273\251\315*\313\230g\036\311*\024\3008\365\260_$\333\217\301\304\335\266\231P\030sM\236\261a\262L?\3654=g\207"
+	.ascii	"KV\210\360Vi:\005\240_D\351u\205\"\327\315\3273\325E\267\213"
+	.ascii	"\232\272\333\372\027\330j1\253\033\371>\332\317\rt8\2072&\264"
+	.ascii	"HW\322\224\033\031\366a\225edm\3626\026YjY\350\373\330\351\341"
+	.ascii	"\311st\356i\\\031}\261\374~\351f\024\346\036t/\022cu@b\317\b"
+	.ascii	"\312\301bq\273\214o\224:c\312S\344\215v\232\177\324Q\201\365"
+	.ascii	"\372\327\241\347\357\\\300\021]-\376\341\021\231\024[\372\024"
+	.ascii	"\313\360\217\212X\377\235l\2220\341\201\251\337I\313\331\336"
+	.ascii	"\360SH3;\202oGs\232!\230\270\353\203I:}\357\373\251\342\356\232"
+	.ascii	"\023\013#\350\306B\n\035|)\362\206\331%\270\f\037\300\252O\240"
+	.ascii	"\013@\325}\367V\250\2310.T\322\\O\225=\327\263\202_\f!\324\361"
+	.ascii	"\r\357\r\232\363\372{\210\026\013\024\342\305\305x\237\273\330"
+	.ascii	"\300j\217%5I\335\345XF\260/\372\316\001\315\371\020\340E}\025"
+	.ascii	"\324!\bqe\001\235\260)\250z\351\027\243\\,\274.a\024>\032\252"
+	.ascii	"\202\201~z$Q\375\335=\325\313\353\313\232il\311\022R\250#\002"
+	.ascii	"<\023+\227Z*\377\007\226\034~\004:\201\001<5\002\035\016l\271"
+	.ascii	"\t\254\361\300\201vS\361\201\262Q\2071\222~Q;\nfg\026\300G\331"
+	.ascii	"!\210\212\2478\306,\353\370\276\n\203\242\f\327\374\376-\351"
+	.ascii	"\005\246\243H\336\2144C|\340\016\251j!>!\\\357H\365\356\036\344"
+	.ascii	"\206\325\023\233u/\311uX\250k\253\260\013\003\332W;V\365\001"
+	.ascii	"\340>\006\370\r\327;[&\253qZ\t#\005\204\261\310\304\250qW\215"
+	.ascii	"\001\247e\373U\330J\357\222\335\352:\323\262$J,\3571\005\263"
+	.ascii	"\033\356\300z\005\221\232.\374\251\324\035\274\n\251\334X\207"
+	.ascii	"\343\242\206\313:\334\026&\022\232)\257hELg\255\304\271E\023"
+	.ascii	"\272\0224\234\3107J\276`/k\323]\341\214p\007L\373\201;w\371A"
+	.ascii	"\357]\001\227I\335\0260@Vh\036\335\200m+7\325f\303\256\334\240"
+	.ascii	":\340vU\317NE\263\223g\\d\367H\227$4\023\273\263\213\313\261"
+	.ascii	"_\321$\235\223\035s\210\312\007\177\2604\240\206\r\367\323\335"
+	.ascii	"ox\321\260\367\361\361x\023|',\"\222:z<M\032UR\305\257\270\206"
+	.ascii	"!\271\273h\n\304\355\333\346\361R\241\002\204\001B\337#\370\265"
+	.ascii	"\324\2472\315}\366J\3217\216\220'#P\3568\353\222\204"
+	.string	"\307gLW]\376\353\006\025\370\344G\357\262\227\037k\235\265\025$9y\021kl\302\367\314\002\321\204zv\001\013\036\257\245-\b|\270Mh\3732\337\355\202\001\333\235\034\355\024\037\021\3203\257z\324\267x\200\224\250\021=\300M\036\363\343p:PK\213P\371t\350Q\242\037\312\373\340\254\230\305\t\002\345\315\247Pv\227|xyE\t\032\201xJ2\234P\302H\024X\224\326O\r\006\212?X\372\035\261\375l\035\346l\201<\206OcI@l\277\243\004T\037\320\177F\276\303yX\361K\017[Q~=\314\371\007]ZU#@\323\253\254\"\237X\333R\232\215\033\300\t\301-?RY)\232\337\246w\271\231\355\342\372\226\352\250Q\3140\264\345\033\013a\363\f\004\350\361\330\203\305w\334\364\272\362\356^\221V\235\376\013\304\206\317\302\306\353\37788i\227\376\237\206\232L\023\366\202\361\232\211(\235lQ$\241\035"
+	.string	"\370\364w8*\310\335\216Q< \244\3556\007\037/\205\261Y\210+\021I Y>\306[\005\304\312\224\3122\025X\027jt\330\342\tU7\241 MO\273]\350\001io\213JT(\007j7\"\b\365\332n*8\204G\357\031G\341C\3136\257h\004s"
+	.string	"\026\264p\304\304\204\376\323]\004\252\253\33530\004]\033\326.\361CPy\252\037\225G \204DaC[\004\247\277K\233\252H\335"
+	.ascii	"Qi\022\356\330K\225\302\241Qr\341\332\365\232\\\027\211\244\346"
+	.ascii	"23\270\324\024\300\300|\317\327\b\302;{\377`\311S\025\336\217"
+	.ascii	"_\340zf\312\017\255\0353J\324\302\231\033 \314b`!\013\336<\016"
+	.ascii	"R\027\300\251\303c\026q\320\363#/\267\177c\005\021\242\365 \315"
+	.ascii	"\303/l\354\3627>\224\224\001)\002aG\262\005PW\002\004\r\243\216"
+	.ascii	"\363\t\346\205\336\300i\037_\177\005\340\204\362\2425O\341\247"
+	.ascii	"\362\324\031\204\t\210\266\371\243\214\007\233\231\224j\246>"
+	.ascii	"\203\265/\013d\372M\b\033\252\025\256\373\030\3140p\264\306\007"
+	.ascii	" \304\314\306\022!i\370RP=\305\313\205\261\tC\177X\240x>\340"
+	.ascii	"Y\240\325\321}E\234@0\363\320P^\005\317\335\027\360D\366T\274"
+	.ascii	"m\303\036\311;\256\026]S2\301\225\315Gd\002\240_\305\332\260"
+	.ascii	"\310\025<\022>\275\262$\201^\374\275\352o\026\310\243\004\337"
+	.ascii	"\247X3/j\225\327\225\033=\305\225\354\214\341\266\364r%[#\317"
+	.ascii	"\300\376\245\335\365c\237\370o\334\353\226k\\\3603\032C4\206"
+	.ascii	"z\367~\006\341\027\024\262\004\031n\236\244]\220\237\337\205"
+	.ascii	"\312Y\256\\\362<\225\266b#4g6\271\357\325,\026\204P\002\263\201"
+	.ascii	"\311\027!\205\251\262\002\351jR,\336\231\373\367\021\277\ndW"
+	.ascii	"\331\020\304XU-\001\257\032"
+	.string	"\r"
+	.string	"A|\236\255^h'@rcE\347\277o\351\203\001\300\204\t\327\245\n\006$[sW\322^\017W\366\221\211\324\301\267\350'\213\233\017\246w*>j_\257\262\177\363-\\\201V\360\245\261!;<:\2227\367^\265\023\265"
+	.string	"\247\336\256\277\304\316\330\327\032\353\315\337\336\263\002 \023\006\250\002X\017\003&\327\004\365h\337t\345&\024}\341m\322\030\024@\324\332\032\023 &"
+	.ascii	"\2401\020o\217\345\251\262OY\321#s\302US<\265\004\364\\3\355"
+	.ascii	"\303hX\265\202\242\215\330\036\001:\3631z\330\250\240j8\366\324"
+	.ascii	"W\n-\343h\304\332\207\"\355\2077\277\323\260\372R\nDH\261V\214"
+	.ascii	"=\317\366\326\314\030\247\227\032?'\244\253\305%"
+	.string	"\317\005g\033c\3041\037A\027aU\323\301\214b\222\204/\033\202HJ\005\362\313\365Pf\016\034\246\356\327\344\036w\375\213\346\333\317\b\342\377v\252\030\t\315\036d;E\242\217\357\350\017\346\376{JH\b\344q\002\352\377]7\340\354\\\226Z\233|U\203\261\335\312\"\323\224\034xB\226%\364Q\036\t\"\035`{\374\311\366}\344\272\311\352\025\321i5\312z\214\205\002\310\301\361\231\024;\331'mA;V\032\370r\035s^\364\335($\313h\361\365\017\236\255$)t ]\210\352\376\237LC\234<\003wO\t\006\020\034F\367\\\327&j\346g\311\0017\022\333\370\233\007\331S\034\f\260En\"\326\255v\373u\376{\017\2612\362\327\037\374D\340\366/\232\231J\306A\314\202\332\300\275[\032 \35679 ]\202\357\231\212\034)\373\031\312nz$\260\316\327\327\345\323\354V\227k5\317\331\336V\215/&"
+	.string	"}\325\327t\347\275\377\230Ca\364\212Ku\265=m[;\352;\002\367\253\253\f\035y\331E\353\364\231=\013\360[`T\334@\330#\271I\342\271ZT\372\227"
+	.ascii	"\342\037\334\206\271\004\037\314\031t&\254X\361\203\2214AW\363"
+	.ascii	"\034\026h\031\373\224\"\356\023\307\212.d\007\270a/\227\256\375"
+	.ascii	"\215\245\232&\217_\237 \263'\\FKRzh\016\204\0272\001\2140\367"
+	.ascii	"\316\333N~\272{`:\303\302\264'zY\335_\326\250\202h\035\016\254"
+	.ascii	"\330\027\250\026\222\232"
+	.string	"\222\202\316`%x\327.sHpd\375\264\243\230\341\307\363YM\276\206\027g\315]\2177)M|[\250\252\031\234\332\001\366orp;5\351v\217\325{\353\370\025\373\325\225W\235M[4^\337_Sy6\242\306D\304\203\3455f+{\204\261\246i\374\326o\020\023\344\241\354\332\320\267\2469\233\001\221\315_J! \313\233\231\225\334\231\206\2531\271\265\262\034\213\204c\253)/k\223\003\246.\264\226o\365\375\343\303\227\354}\241\3459\1777J\006\312\330\233^\335\315w|\f9I\225\354\n\206\226Qu\312\0343I\331=Q\210\305\274G\262\f\337k\026V\332M{Nv1\214\366G;-\\\302,6\332*<\322\2034\360\315\274\225u\251\263\0168\277=%K_\306\2756\324A\035D\313C)8\270\274\247\275\361\314\254\252\344\342-\233\325\202\2449 \231\231\261\327\254\310HS\006W\333\2203\257^"
+	.string	"y\362\013(=\302CoCz\321T\3326\376z\270\300\224\0246\274\336,\020nz\352J\002=\316\004\331C\022Fs\212\347\361\t~\267~\220\303\"\237yN\335i\252H\035\3662\367E@\247\201\035:\004\344\037\017\205\021\205)\213Y\326\316\034\036}\216\367\037\275Zt^f(\335\026\303\246ik\033\216\026\364HU\357\261X\335,\033p{ko:n\347\235\304Faj\365\356\232t\224\236\267\037P\273\n\031\001\256/\315\005\302\321\035\340k\276\364\342\313)\337\233X\241\340\ni\361\222\234\257NpN\363VXt\206}e\227\024\206D\356{\350\222\201}\363\310\037\370=9\321\247m\211\013<\266\342m\351\317\026"
+	.string	"U\316\240\354~\206\"\203\217\233\034\306\226\306\220\331e\003\223\013\327:\303\346\216"
+	.string	"\001\202\036&<\321V\266\231\2240\025\360|\257r\216\246\273&7\251s\033\334\371"
+	.string	"\225\347\210\365\263\332\273\007\237\233\222z\3335r\271\025\250W\315F*\337}\267v"
+	.string	"*\003o\023x\214\330j\003\337h\034\352b\271\335]|s\013~\022\210I]}t\304\032\221*\253\233~\005\026\272*\307\312\312\325\363\310\353\005v\236\212+\325\2072\335\027\341={"
+	.ascii	"\276\313\246*_"
+	.string	"\003\263x\224\307\023\205\224\n\032')>\311^v\017\337\303\234&=\2429\357\334Z\254\201\275\013\306:\327\231lOt\343M\260T0\356\315\371\353\337!\367\036\212\210.RGv\036\323\200\341\016\3043\260\361\233Q\334\232\363f\277\201\0011q\"B\236\230\336?\376]Q\263\0077Y\224V\255\251\212\273\3746\034-\260\3352\220_@\ra$\373Q\005\307\223\331 &c6q\226W\333=k6\362\231\3008[\222\333m\324\252\n\3666\230trQ\325N8g.$\310*\370\bI\246E\241K\207\331\222\350\274&\024\351\351\007g\\g.\264\227\210\362L\372 \002}WE\205P\030\204\211Y\275\001\031\203!\031=\376\3262\023u\316\306\337\316\210\233\265`$\200t\322\222#\216\305\250C\030\364\2754/\0257\031F\314\005L{\203\n\261\246B\004\310UC\002#\213QN\246O\265\027*$Czq%"
+	.string	"a\267\023\337\022]\357\001lg\362\371\n\277\332R\212\324\300\246\036(\303RoV\203\\5LOX73\347\264\301\222\216\3528\026`\312\240\201\362\335\rC\033\241\303\354i\353\325q'\n\006\207\225{\204\366WE\243\246,g\005a{\0133ZY:\244\306-Ah\321P{\355t\252fFIw\204\240\326\007X_\363\261\270\r\344\211\332#\235R\302\344akCr'\321p \234\307r\325\276<D)XLR\264\352^\265e\250\033GU\r+\214\213nX'\300\374\364\373\023\215"
+	.ascii	"kv\362\317\243$\346\255\265\206\214\004L\327\n^\022\250|E\300"
+	.ascii	"\321\006\263\023A4\337i\325\2439\005\214\016\277Tv\n\266zD\002"
+	.ascii	"'P\251\022\236\364\350\357\021n~\344\231X\220\211\007X\nqz \227"
+	.ascii	"8\212\331\250)7F\021E!\223\252\317\006mm\213/\300\303\307\362"
+	.ascii	"I\367\346\212\374\360Xn\276R\341\206\215\021\036\216\264\240"
+	.ascii	"\"\267\227\266\202\311+\b\032\230\212\205\003\001\003\323\324"
+	.ascii	"\344\2660,5\245\321^\2403\244\360\201\243\313\\\\\f4B}\325v\032"
+	.ascii	"u\344\302\216\374\340\214\236\302\304\267\f\215\005\373\233\364"
+	.ascii	"\352\214\267aH\356g!\200\362Vl\240\267\254\321%\343\007\364\350"
+	.ascii	"\345\325\230L\005\344T\252bz\322\226\367\254`\005\227\t\361\021"
+	.ascii	"\222Mm\004R\214\265P\363\307\016\274D\001\212\027%m\0378C\360"
+	.ascii	"S\356\261I\004\210\207#m\206\216Xj\006-\221\201\216B\337\332"
+	.ascii	"\b\217\004\271Q6\026\354\3005HC8\007?b\341\025\305\364\\\231"
+	.ascii	"\237Z\001W_>\006\203T\240\212\256\254\232\350\036+\302\177\357"
+	.ascii	"-d\274\235\250\016\t\264\213AG\351\024GG\223]\207HH\"\276\"\320"
+	.ascii	"\022\r5\246\330\262\245\347\310\372{\222\370\b\005\314\320\372"
+	.ascii	"\254f\237bx\364\346\243g6\306^\364\217\326t\304*\361\321\323"
+	.ascii	"T\023\223\035A\004\311>\270\026\314J*\2003\2421\007\301\247,"
+	.ascii	"x\031+\2164\203We\253?\310E"
+	.string	"\027\224\336Mu\263;\272\023\370\230\221aih\313\221\307\232e\375^0?p<\300\221\203\201\301\333\364\3015j\247\2668r\316\205x$Q\016H\242]8\346e\274\216\340\224\342{z\213\372\232\256\242\253\267\031\303\252\36000\037N\323\264\364\243}\3203}\207\233\354'.\021\204\362\023\313\376\256\364\354tb\215\005\244\001\355\344\361\026\360\021\332\035\033\017F\211Tg\235\257\335\205c'\223\217\025\202L\260V\265`\302\326\r\261\217\341j\t\025\267\206\331\377\327\265 8\200\366M\236$\013/\260\b\243\305~b\232\364A\325\220Y)x*\033Ak\236\252F\023\273\201?\342lWP\323Vf\211:\347H|$+[\323]\365\265R\327\276JJLcc\357M\254\333K\226\314\021\351\243&NQ\317\244tw\017\265NU\221fk\030\234\344%\374\032\030j\230\020\342\200\025\275\221O"
+	.ascii	"\2748\307~\331smSQ,\206\351:;D\240\336;\327\325\025\212o\376"
+	.ascii	"\313\342\351\036\235\260\376%\221\254xw{0\3145m\376I\361\326"
+	.ascii	"\216\240\242lJ3\255-c\tf\317\023*\006~\321\007\336\203\370\226"
+	.ascii	"0A\340\201I\341\r\241s\362\377\203VH\034b\r\307Y&Kr+\366\346"
+	.ascii	"T \266\242\204\227U\236o\360G\034\002\3513\222<\201\026\351-"
+	.ascii	"1g\215\215S\177k1\013\254(\325\\\217\321\004k\217\341f\343\261"
+	.ascii	"r\202\035\273\376?\217\036\363jIo8H\213\202\215\017n"
+	.text
+	.section	.gnu.lto_valueTableNameIndex.250.1b9da044c9b9e2d2,"e",@progbits
+	.string	"(\265/\375`\235\026\005O"
+	.string	"J\213\204\034C\200\220<\215\001\327\354\205\020\002\004\231d\222I&\231d\222I&\231d\222I&\231\304\b\323}\016\303t\237\3030]\314Ql\227s\024\333/\325\366\271T\333\027\365\260\267\334\243\366C[\372z2\245\224\322\016\330\001\266\001\244\001Z\033\351\357\035\002x\f\360\261"
+	.string	"H1\204Ev$\337KF\223>\t"
+	.ascii	"\005\200\024\002T\nXA \337\337\337\337\337\337\337\337i>\324"
+	.ascii	"\f\332\b\336\024\342\020\346\347\244\323\344\353\244\317\344"
+	.ascii	"\357\244?O\372\367\244\277O\372\377\244?P\372\007\245\277W\344"
+	.ascii	"\373\373\373\373\373{R\272\222\004K\0210M\320D\201\223\006O\031"
+	.ascii	"@a\020e\201T\005S\027P\331"
+	.string	"PE\202\225\327\225\bX#d\025\277\264\272\362\267\322\271\212d]\3051\257bX~\211\345\203\245\207\315\211\335\215\245\223Q\225\245\233\021\235\245\243\245\177Z\372\253\245\377Z:I\276\277\344{H\276\237\344\277\245?\\:R~\\\372\313\245\377\\:G>]\372G\335\nv,\334\265\200GC^\fz0\354\315\300\367B\237\f~.th\372K\177\300t\017\351\037b@\244\177\210\364\221|\021\351.\371#\322A\362\003\323M\004K\030L\201\020\205\302\023\fM\310C\025\0221\2152\207<\312\304,\222(ZMT\345S\244\177E\272E\312\\\024\2570.22406\262\206c\252\243(\345\361\365!\006\002\026\022&\2023\202B\222R\242b\342rR\202\"\2232\243R\263b\303B\323b\342\022\363\322\002\003\023s\"\2632\303BsS\363b\243$7f8\305\262\034\017\235\216\2356\036\267\236\026\237d\371\271"
+	.ascii	"\362\n\002\021\322\217!\025\242\225\242L1R\214\243\324@*\366"
+	.ascii	"%\245\240\022\330\022\037S\207\246='\300\247\021P!\242@H\325"
+	.ascii	"M\341Q\321U\331Y\025\003\257\244\260r*\313\203\226\210\255\342"
+	.ascii	"\035\027PW\220\227\376|\r\201\t\205\225\210%\333X\321\220\f\246"
+	.ascii	"L"
+	.string	"\304\314\200\263\003\024-}\314N\224\3741\273\230\305\342\003\"\001y\255\327{\315\327}\355\327\035\372\257\001\333C\177h\020\035\242E\364\210\016l\301\036l\302.l\303>l\304\316\241\023G\211qb\244\030+F\213\361b\304\0303F\215qc\344\030;F\217\361c\004\031CF\221qd$\031KF\223\361dD\031SF\225qed\031[F\227\361e\204\031cF\231qf\244\031kF\233\361f\304\031sF\235qg\344\031{F\237\361g\004\032\203F\241qh$\032\213F\243\361hD\032\223F\245qid\032\233F\247\361i\204\032\243F\251qj\244\032\253F\253\361j\304\032\263F\255qk\344\032\273F\257\361k\004\033\303F\261ql$\033\313F\263\361lD\033\323X\030\325\306\265\221ml\033\335\306\267\021n\214\033\345\306\271\221n\254\033\355V\030\357T\300\341\206A\t\r\n\033\212\211\357\357\357\357\357\026"
+	.string	"\004\276\277\277\277\277\277\277\277\277/\360\306@\\\003\351\236\356"
+	.string	"\325\003\351\357\357\022@\220\357\357\357\357\357\357\031l\240A\b\033<\007\036t\320\201\007 <\007\037|"
+	.ascii	"\302\\\b\351\357\357\357\357\357\357\357\357\357\357\357\357"
+	.ascii	"\357\357\357\357\357\357\357\357\357\357\357T\210U\207V\205W"
+	.ascii	"\204X\206YuZy[}\\\351\357\357\357\357\357\357\357\357\357\357"
+	.ascii	"\357\357\357\357\357l\n\264%\220\357ovp\351\037\227.w6\207F\307"
+	.ascii	"V\327f\347v\247\206\227\226W\\\323K\177\357\310\367w\277\364"
+	.ascii	"\367\277\342\037`\r\371.\227\357\357\357\357\357\357\357\357"
+	.ascii	"\357\357?U<\254*\":\025s\210*&BIHM\244SpUlYt]Xade`i\004;\266"
+	.ascii	"d[\266f{\266h\233\266j\273\266l\333\266n\373\266p\033\267r;\267"
+	.ascii	"t[\267v{\267x\233\267z\273\267|\333\267~\333a\377\026p=\354\207"
+	.ascii	"\005\261!V\304\216\330\300\025\334\301%\334\3025\334\303E\334"
+	.ascii	"\0346\221%x\202)\270\202-\370\20218\2035x\2039\270\203=\370\203"
+	.ascii	"A8\204Ex\204I\270\204M\370\204Q8\205Ux\205Y\270\205]\370\205"
+	.ascii	"a8\206ex\206i\270\206m\370\206q8\207ux\207y\270\207}\370\207"
+	.ascii	"\2018\210\205x\210\211\270\210\215\370\210\2218\211\225x\211"
+	.ascii	"\231\270\211\235\370\211\2418\212\245x\212\251\270\212\255\370"
+	.ascii	"\212\2618\213\265x\213\271\270\213\275\370\213\3018\214\305x"
+	.ascii	"\214\311\270\214\315\370\214\3218\215\325x\215\331\270\215\335"
+	.ascii	"\370\215\3418\216\345x\216\351\270\216\355\370\216\3618\217\365"
+	.ascii	"x\217\371\270\217\375\270\003\3771 {\340\017\f\202C\260\b\036"
+	.ascii	"\301\201,\310\203L\310\205l\310\207\214\3109pbK\364DStE[\364"
+	.ascii	"EctFk\364FstG{\364G\203tH\213\364H\223tI\233\364I\243tJ\253\364"
+	.ascii	"J\263tK\273\364K\303tL\313\364L\323tM\333\364M\343tN\353\364"
+	.ascii	"N\363tO\373\364O\003uP\013\365P\023uQ\033\365Q#uR+\365R3uS;\365"
+	.ascii	"SCuTK\365TSuU[\365UcuVk\365VsuW{\365W\203uX\213\365X\223uY\233"
+	.ascii	"\365Y\243uZ\253\365Z\263u[\273\365[\303u\\\313\365\\\323u]\333"
+	.ascii	"\365]\343u\305lJ\247|J\250\214J\251\234J\252\254J\253\274J\254"
+	.ascii	"\314J\255\334J\256\354J\257\374J\260\fK\261\034K\262,K\263<K"
+	.ascii	"\264LK\265\\K\266lK\267|K\270\214K\271\234K\272\254K\273\274"
+	.ascii	"K\274\314K\275\334K\276\354K\277\354\220\177\t\230\036\362C\202"
+	.ascii	"\310\020)\"Gd`\n\346`\022fa\032\346a\"f\016\231\250\022:\241"
+	.ascii	"\024Z\241\026z\241\030\232\241\032\272\241\034\332\241\036\372"
+	.ascii	"\241 \032\242\":\242$Z\242&z\242(\232\242*\272\242,\332\242."
+	.ascii	"\372\2420\032\2432:\2434Z\2436z\2438\232\243:\272\243<\332\243"
+	.ascii	">\372\243@\032\244B:\244DZ\244Fz\244H\232\244J\272\244L\332\244"
+	.ascii	"N\372\244P\032\245R:\245TZ\245Vz\245X\232\245Z\272\245\\\332"
+	.ascii	"\245^\372\245`\032\246b:\246dZ\246fz\246h\232\246j\272\246l\332"
+	.ascii	"\246n\372\246p\032\247r:\247tZ\247vz\247x\232\247z\272\247|\332"
+	.ascii	"\247~\332A\377\024P=\350\007\005\241!T\204\216\320@\025\324A"
+	.ascii	"%\324B5\324CE\324\0344q%vb)\266b-\366b16c5vc9\266c=\366cA6dE"
+	.ascii	"vdI\266dM\366dQ6eUveY\266e]\366ea6fevfi\266fm\366fq6guvgy\266"
+	.ascii	"g}\366g\2016h\205vh\211\266h\215\366h\2216i\225vi\231\266i\235"
+	.ascii	"\366i\2416j\245vj\251\266j\255\366j\2616k\265vk\271\266k\275"
+	.ascii	"\366k\3016l\305\002\202\252\250bPc\227=\003\342\f\r3\306\030"
+	.ascii	"\311\275\001\022 1\362\307}\262\300\245\351}6KU6}\216r\201k\231"
+	.ascii	"\347\331\225{\2256\310\346-\264\250\363\226\267X\301\306C\301"
+	.ascii	"a\307Q5\367E\261#\244/Jo\004\322\254\315Go\310\231\347\206\235"
+	.ascii	"nx\346\340\031Z\303l\317\247\332\377@[\r>>\344|\b\002}V9\240"
+	.ascii	"v\017)2l\017\027\217\362\212I\306P\t%\303\022\205A8\273!\344"
+	.ascii	"\365\334\370\275\032qX\315\313\262\301\222\242!\354\301\345!"
+	.ascii	"T\215\211\003\252r\231Y\325\2354\257\252R"
+	.string	"\236\255\236~\375j\241^\227\312P\3570\213Q\317\341\222\3765\270\340C6\270\260\002\3147\t\372\3762\216>\201Kb"
+	.string	"\267\312e\240\365e\305\307\254\362\343/\2210\317\177Z\376\234s\361\356\032zQA\r[\361:8\303\362\326s\024\\\037\330\242\336\363)n\024K\231\r\317\224e\303\001\213m\370\300.\021\231\245o\256\352\271\262\005\331\362\262\2164\347+\026\201\327b\"P\026\243EQq\037\250\024g\242\353\320g/t\365&.\333\272He/1z\255\305]\271SBy\206\r\204X\343w\227%\031\220\275\314"
+	.string	"1r\210%\366\037\tW\255\267\n\237\3432RR\365\302\232\030\372n\356\345nE\335h17+J5C\346\357\26280\355T\271n]\234;\355T\271_\315\0339\206\374\357i[\305Y\\\222e&\024\353B\361\312r8\203\302WK\262v\025\f\265\036x\217\002@\016\tV\026\350o>\302\274\307\204\204\021L\256T\n\006\023\247\fB7\n\346!K\374\r\262\225-O\366,\022d\323\210\023\237\211\363\353\324\220$d\274\202\007\306\220\2051\244\203\340\023a\316\024! $:\226\016\204\206\007\333D8\024\220\b\252\376\211"
+	.string	"\324\223\267$\213\364 \202\231\022\230\020Z\\\275\333\347\032\026\303\375\"\227.\200\314\340\310\355\233\245-M\340^{\212\323\353\277*\213\033i\3362\031Q\336\333T\250\035\243'&\0060\303Y\272v\210\316\370O\311\315\376Y\307\007\311H\352\303\211|\304J\371\371\211\321\244\307\177ys?\364\317<\245|M\213\307\2333v\362P\354\337\020t?\202>\3507A"
+	.string	""
+	.ascii	"\262\037Q\243j\330\2308\363W\246\024\2760\277\374%\204\273H'"
+	.ascii	"\343\b\332C\334\257\261\037\233\224\216\346\205\355&\017\035"
+	.ascii	"\332k\330\234\304Plq\222\360\347\217\251\304\233\b\372^k\n\354"
+	.ascii	"\206\337G\230\277\371\233\362\033\312/\273\326d'\276\361\326"
+	.ascii	"\206\357\f7\327\213\373\205fB\233\b-\"R\033"
+	.text
+	.section	.gnu.lto_settingsBuildCheck.251.1b9da044c9b9e2d2,"e",@progbits
+	.string	"(\265/\375 \301E\005"
+	.string	"b\311#-pU\323\001"
+	.string	"4\274\326\177\270 \017o\261v\322\363\277MH\372\266\371\024% \211\334\320\024"
+	.string	""
+	.string	"\3259{\243t\\\217\020Y\264wJ\001\246&\255qY\333Vij=(\275,\006D\251L\323\311`,Re\272aX\246R\270\237\340A2'v\330\311\211\261\037\330\t\3322q\031;\027A\273\225"
+	.string	"\200\r\t>\033\333\227\314\331\242\207\232-\210#\212g\334]\235\231s\227\234\177\316\t\336\327]\016\026\273k\351}\226{\3366\302\266\302\266#\b"
+	.ascii	"3\003\316\2311\340\313]\303\335B\030/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_.symbol_nodes.1b9da044c9b9e2d2,"e",@progbits
+	.string	"(\265/\375`5\001\225\t"
+	.string	"bO73\360\234B:PSSSSSSSS\254\024L\234\201g\340\031\270l`\265\374\036\230\201g`\021\331D6\221\2154:333333cc7\322\222\fm\273.\276|\343\362V6\266\034\226\017\262\f\226\215+\177\335\366R\271+e.\224\265\362\301\223\263\262\321d\232\222\261H\276\032\331J\344\252|0d*\220\247\262\361c)\217\243:\206\342\230g\343'\215\2352n\3028\347b&\213\227*V\312\007)N\312\007'F\312\007%>\212\330\b\342\242\207\323\262\321a\233ll\270&\033\031\236Y\230Ha\240\204\321`\020>;x\310`\241\202\203\b\376\031\330G\340\236\200w"
+	.ascii	"\326\311\007s\034\333b\357\261\332d\331v]\374\262\214\331\311"
+	.ascii	"\264\2706g\267-\227\313\345\212\333\254\326\266v\0135 \260\323"
+	.ascii	"\244\003\251\255XaI\036y\314#\265\025\226\344\221G\036R[\222"
+	.ascii	"\272%y\344!\217<\362\310C\036yx\036M\315\212\025K\344\001r\364"
+	.ascii	"\255\267l\271\bp\243\0257fe\f\002\311c\036y\344!\217<\362\230"
+	.ascii	"\332\222< \017\265\251d\213\214\001"
+	.text
+	.section	.gnu.lto_.refs.1b9da044c9b9e2d2,"e",@progbits
+	.string	"(\265/\375 g\205\002"
+	.string	"r\006\023\027\360\236\264\006\314\3003\360\f<\243\343\020A\004\021D\020\031\021Dz2\307\272\252\232\332\242\236\232\226\222\216\212\206\202~zvrnjfb^ZVRNJFB>:62.*&\"\036\032\026\022\016\n\006\002f\261W\273\273V"
+	.text
+	.section	.gnu.lto_.decls.1b9da044c9b9e2d2,"e",@progbits
+	.string	"(\265/\375`\0025\275\323"
+	.ascii	"\nG\025GV JI:\351]K*\204\021@\301\300H>4\266\263\210\346\rk\370"
+	.ascii	"Wm'\335\231\331\0243\0033\233\226\3346\035?\222\204\252\333\354"
+	.ascii	"\205&\263\004\026Hj\270\256\353$d2\257\2438"
+	.string	"\235]\027\303U\035\205\322e\265!\313\226$I\372\3179\327\212\021 v\023)S\273\003Q\004\240\004\334v~r\033\263\t9 M\027\347\215\222\003a\207\215\027\215\"m\3173\326~cfS\317^\314S\236<\205\257\3340\357\235\332 M\231%\334\336\215\342\001\302M\327T\221%6\r[30\311\001\315\261\342\303\214\252\355\331\312\317b<\306k\334\274\034z\360bXS\323\226\317\270\n??`\264s\032\253\035\270\004\275\320{\241=}\244\215\331\224\266>\f\2446+\327\363\007j\372\367\307\037\250L%x6\343\262\0375\252\252\247\315\314\355\b\322\366P\006RW\376Q\333\215\177T\017Q\006R\201Y\374\243>i=C\341\2573\330\223\3018\214E\270Le\274\030\340\305\215\n\327\336\255\342!\204\263&\005\013\016\b\245\311\026m\013\375G0\341ft\356\375\272\367^\260C7%\346\266}\224\243X\272&\\"
+	.ascii	"\353\177\326\277\177\365\336) \364F1\351\250\f\344\035N\271\203"
+	.ascii	"\377\366\336{\231y+\327\332\322\216\r\356\377\013\335\253\024"
+	.ascii	"\305\024\273R\332\300\024[\272\314\2619\251\rL\350\265\342p\305"
+	.ascii	"\202\\&\264\251d\233J}\241Wy%u\225M\245$&\364F]hS\311\347*\245"
+	.ascii	"|\230\320%%\246\330\225\0243\305\232R\033\256\362*]\345\222\325"
+	.ascii	"\252lJ1\345\232R>L\261%)\246\362J\212\241\315\313^\260@\257\224"
+	.ascii	"\226Wli\347\336\373\004u*\351\334\273\024u\225\350z\306\275\212"
+	.ascii	"\316\270>.\317yA\203\334\240{\257R\331\035\220\346\r\224\351"
+	.ascii	"\3161\2274U,\357\275\2733JPb%\350\275\267\3512)\361\275Kh\324"
+	.ascii	"\275L\315\241\252&\203"
+	.string	"i\212\272;W\271\364\304\004\244\251\263dj6\335%V|\357\275RL1 \315 \033\0251\347e\202*1\363\251y\235\367\356*j\025S\202\336\262{/\247\331\021;R\365\324\226\351?\333\177!?;\375-\343\357\345\375{\004 \370\373\003\177\277\370\333\305\337\311\277\221?wP\374\033\351o\016\374M\374;\305\337\303\277\207\376>\301|\377\331\374M\201\277_\370\273\304\337$\376\216\300\337+\260\006?\247\3607\004\376F\341o\021\177\203\370\333\001?\353\374\274\363s\317\002\376\016@\002\376\006\300\317A?[\3603\320\317'\374\214\200\237\023\360\263\002~>\300\317\016\370\273\204\277I\370\231\203\237\205\376\237\371\217\346\277\f\377\363\376c\340o\030?S\240E\270\375\241C\350\0024\001\032\004'\355\241\007\320B\375\301\317$~.\361\363\013-\200\377\r\370[+\214\227-Z\332\370\276\341O\325\244\2319\341\322\362\340\357"
+	.string	"\034!\002\344\307\016\034P\351\237:5\215\340\003-\220F\016\376\336"
+	.string	"\006#\r\376\316\340\002@\026\374]\0010\004\335&\335\320g~N6\231>\252\361\363\220\303\337\024\244Y0\246\23730\301\337?\377\225"
+	.string	"\377\224\357g\253k\370\323\007\374\234\243%\370{\303o\376\324\204\237\275\344\374\251\324\337>\177\367\374\235\3637\316\3377\177\257\177\003\377\266\177\367\337\374\363\337\317~\377w\376\324\203\237\373~^\3633\232\237\243?\233\371\271\314\317c~\276\373\271\356g0?\323\375\034\367\263\226\237\337~n\373\031\313\317l?\257\375\234\366s\225\237\315~&\373y\354\347)?\207\375\374\374\031\354g(?{\375\354\344g&?s\375\214\344g\254\237\257~\326\361\363\324\3172~f\376\274\374Y\371\363\322\317\367g\021\374\334\342\347\025?#\375\234\342\347\r\374\254\201\237+\360s\210\377m\377\257\374\017\373\177\200\377q\377K\370\373\373\373\373q6\370W\r~"
+	.string	"p\005lz\013\230\027c\306^[\236\013\276\373l\220\031\240\224\264m!8=\275\306\023\252R\245\234\341g\237i5*<\235\251rOTqm\337y\177G[\206\336\332iJ[R\266m4\301w\232;)6\033m\201\374\243\246\"\034\271\343g\3375\236\220\317\275D\230g:H\374\240p\264}\227\371[L\217\351-\0172\344\310\322\226\323\202o2\251\025\267e_[\016R\251\346\370\331s]\247\202\317\275B\344\234gB01h\265}\207\371\333K\323\365\226N\363\316\006\023\257m\177\t\276\301\344(\251\316\262\332\336\360\217\n\274V\376\270pi9!\237\253\f\223\305\t<\243\205\237\255\245\345\204\240\267\006O\2302*\020\316t\232\367rP\317\312\232\250\300\365\026\232m\232Q\265i;B\360\r\247v\305`\305\307em1~\266X\277\251"
+	.string	"\275J<k}+\225%B\326\270\3514\303f"
+	.ascii	"\371k\213\005\032\004l\363\267\245\246\355\273\355\357\261\246"
+	.ascii	"\3221\350\260\333\222\034^\332b\tJa,\225\236UV+\315\306\317\276"
+	.ascii	"\322h\357\264V{\020\364^\264{\357\2256\353*',\243nh"
+	.string	"\b\351*\353+\275\026\306k\212\307\336\215\215\036jN\252=\020\272\262O\222*g<u\321\276\264\266\320\234*fZ\224!k\223\005\337e\035\b\3224\322\366\003\377\250\"\\\006R\325\013\314\261\276\361\223\337Z\212\020\327\032\2419\255&a7^\244ha\266\215R\246TB3[6\364\347,\254\245\237Cm\304\013\232\3256J\320\r\2225NK4\326s\331Wcq\2313\273*\321~\322P\032\254\273\370\331_\255\244\2274\223n\302\354\362\305tm$\025s\222hB\213\306\261\034sY\332\2511\334W;\341\265T\314\2716\221\255}\365\221\336J\305\23472\210\234y\bJ\333\244\321I\321\261\0076\255\314d u\303\233\353\277\301\331\242\227\303\331\366\300\273\336\252\331jg\312|jB7\364@\241\032\202\344\206\215\r\023\033m;Ig\275\265\032\311m\255\022\232\367.\265VO\337\275K=\314\0340s`\237"
+	.string	"\321:S\355mt\275%\263\336\326\255]\004\332\241\207,\211\362\252m\235\201\373\326\232\240D{\331QU\354\274z\364\0172\262(V-\325<\232\272\332\212\277\260]\nuj #\002\026\275\027\332V<\206\325\244P'\t\"_B\032H_5\221n\366\220\016\302\317\266\272\322\212\3334\2145\273'\321{\257\207\016\0368\214\212F\324G\250}\334(\241W\354\246.M\2172\264\365vl\207\216\230T\022\263\254\034\374l\035=e[G\327\350\2524,j]#\203\352q\"\367\205\303\332\306\001\345'h\250\354\216\265\251\332\006?\373\306\255\224&t']\272\261eMH\355a!\3656j}\312\267>E\263B\365\334"
+	.ascii	"[\266\231[\237\330\257e\300h\343\274W\371\324\267e\310\b\343"
+	.ascii	"\027\275W9\243i\360\263\237\332\311\203\207 \034\260\030\234"
+	.ascii	"8\251\255\335\324L~v\350\030P(\317\232/PzTV\021\334\313\035T"
+	.ascii	"\376\373\343\016\352\323g+\315\270\334|\264}*d\375\337J\275\304"
+	.ascii	"\317f\342\277\363\034{yC\357\025#\201\375\230\215g\311\347*\233"
+	.ascii	"d4S_fK\241VV\247&\247\350\275bA\036<\354\234a\212\322T\355S\253"
+	.ascii	"\365i\323\372\224i}\347\255l>\202\t_vM3\313\232-+\037\357\355"
+	.ascii	"X\303O\346c=\206z\b\322\020\005\204\257\315\332\267\333\372~"
+	.ascii	"\256"
+	.string	"o\2575/H%\362E\357\253\355\333j\275\td\212\220\200\347s\231\354~8\357\025;\247a4\374d\031\330\314\371\216\305\234\241g\265?\370\217`\002\313\300g\270\f\217\022\364B\341\330\031\231\342\261w\257\230\007\017A\036n\350\234f\314V\373\276\353\371n=sY\241:PPG\2321\254\347\2645\210\201\324\224\177T\006\303a\370\211\001\327\245JR\356\327\216\237\227\037\233\261\365\214\201\312\177\214\201z\216\262\236\235\254\0330\220j\313\030H\335\262\206\211\366\340\262\265\236\223\254\277c \365{e\272\030H-"
+	.ascii	"\331\325z\306\302\001Q(PRl\230\031 W\372\332\336\206\265"
+	.string	"\326\020\332\334\031\251\266\366\031\274\205\256\315&N\200\264\345\020\305\202I%\001\003\306\202\375\266\211\375j\255!\033\367j\331\226\253\030\b\212}r\247cI^\333\333'\277\355\262^\2555\004'\344\215F[n2\220:\001\377\250\266I\360\326IN\225\2706Zm\177\230,\251\033\022\205K\333\333%h?\250v\320\265\265J\202\267\\~|Nem{\266Z\r\217\230\030Bdp\246S\351\ftC\326\264th\270\342[\342\310\272\342\341\353j\202K\222b\251pJ\320\\AR\307F\236\330 r$\345\352\255!\027\rVJ\007m\273qf\244\345p\262(\335\326\024i<\264-[\340\210\264\337S\227\334\334\020!wn\b\235\025\362[ 6Hk\r=\355\250:\323\366<\374se\245\222a\231\342\264VP\253\260$m\315\037\353\r\030a9\332\336\376\370m\016\353\243\265\206x(\t\"\244\355\347h\004o{\364"
+	.ascii	"s\304Y\035\341\261c\310\330\231\335\361\247z\034\347\201\277"
+	.ascii	"6zmm\216\340\255\016.n\321g[\035\376\251\302\261\243f\f\220&"
+	.ascii	"\213\303\336`*\257\226\264\025\201\201lP\265\223\260 KK\2455"
+	.ascii	"$\304\307\230\0375\354\224\016+!2\354\224\230Z\021\254\250T\224"
+	.ascii	"N\030T\215%mo\243~K\303B\215\360d\204H\333ga 5\247)x;\203\311"
+	.ascii	"\346\311\223\323\t\251\2550\326\251\254M\022\247.2l\f\030Qr0"
+	.ascii	"l\214\3376Yfk\r\251\177ZyV\030H\305\261K\030\3000\346\fgmoa\374"
+	.ascii	"\375\205\273\264\326\020\226\215\032]\3322Y\360V\331\363eMM\226"
+	.ascii	"e\262KV\r\230-5\354\222U\n\243\206\246H\333\023\030HM\377r\354"
+	.ascii	"\250\310\231\245\177\177\243I\375ZkHm\313\330\220\266B\f\244"
+	.ascii	"\366\365AY\302u\265m!A\322\366>Jy\374L\363\3225*\314pN\341qq"
+	.ascii	"[\273\254\256\224m\237\362\2453\350(\247\312\366\332\246z\301"
+	.ascii	"\247{Zeqqmw\370G\325\360h\217\035\0324\022\200\272[\247\030\321"
+	.ascii	"\323\"\213F\033\017'j\002kr\321\236\"f\314D\340L\226h\316\231"
+	.ascii	"f\323\257\355{\230e\312\2409y\322\214\031\243U\346\344q\273\273"
+	.ascii	"\373\220\265\204\353\342\201RWW\206\247\b\0300\215'\204\307e"
+	.ascii	"\t\267\307\343\264\205\237\351\226\224\256j\t\267\307^\366\374"
+	.ascii	"\316T1\314"
+	.string	"\274/s)\227\264\213U\263\025\227\246m3\t>\235\343\221\362\032;k{s\243v\322\304\305}\251i\321\342\345\334\311z{K\271\222d9w\246\332\332\2168u\364\260`i9\234\250\0335\274\036Q\235866<('O\215)2/akk\355'A\224\004f<E{n|\211\362\326\366:G\322\322\374\226p]:TU\252tY\302u\351\231\231y\260f\t\327\225cGF\326~G\272r\256\214\2155\036\220yA8\302d\312\224\224\353o\t\327\225s\025\026\226r\3350\257\007hK\270\256\234\030\317'\0332``\215't\346\r\n\2241_^^[\232N\234\210\311\202\023\203\t\223\366Cs\326e\3613\315J\271\214\2249q\262\232`\244i\373TI\352L\353\240\234Pi\313w\301\247[\n8\022\344I\333\336\340\246J\212$E\322u7\314;\200'7K\202\3603\r\222b\245\314\346\255A"
+	.ascii	"0/Xy{@\267)27n`\205\331h\373\324\310\237\nI\207\360<\371\305"
+	.ascii	"P\3226%\022|ZD\203\230(\\\314\266\f\340\037U\203t\357\306\211"
+	.ascii	"\007?S\036\351U\026\016\2272Qb\234\021A\"\207\326\366\251\325"
+	.ascii	"\237\366H}\264\027\326\322K\333\364G\360i\263\301\2060\261\332"
+	.ascii	"\252'\344Q\3613\245Ju\024q\252T\226\304\230\270\302\200\2459"
+	.ascii	"\376\324Fz\203\007\212\215\246\245\266)"
+	.string	"\216\340\323\252\f\322\332\330\332j\340\037\325B\345\236\370\231>\245S90bDy\273b;\203\262\301\203\266}*\365\2473R\032\252\023'1\232mS\250\340\323\250\033\2635C\336\332J\300?\352\r\264j\035\223!C\314\016,&\263\345\200\314k\355|,\341\272V\252\345\262\361\242\177r8|PM\340\270\254\177\252L\225\355\2272\233\003p\372Eu\335\313\003\004+\246\206H\214\266\327P$]J\227\354\2764<\2457\275]y|\374l\276\366C\242s&k\256K_\257\351\303\243\260E\321Q\250\302qXT$\246h\001y4\036\031E$\025\rGtH\036\215%^\b\217\222\220D\024\212\220$\216C$\242\013EC\243\242\020E\222\030\"iT\201D!\203d\221hLJ\016M\024\r\215\311\025 \222G \210Hc\211\013\222GD\b\b\223\\\220\300xL\022\025W\bGp\030\262 &\205,\210\307"
+	.ascii	"\254H*\256\240\201Q\221\250\"i4\"\231 j\001\205\343\260H\024"
+	.ascii	"\036]0\036\211@\270\020\036\r[X\001i\230D\2760a\034\026\021)"
+	.ascii	"@A\222\210D\0341<J&\215G\025.\364\f\223\302\026Z\030\217R\034"
+	.ascii	"\207,H\\\260\"\304\213\343\220\205\221h\330\202\n\244\360(\""
+	.ascii	"H\005Q\222\330\302\004\006\303\024B\344\021Q\b\201\237\027I\""
+	.ascii	"\013\3411\005b\262\b\242\002\244\3430\211\202\005\303\244\027"
+	.ascii	". \221\302\244\026\306\021\310\243a\261(T!\242\203\242\221\230"
+	.ascii	"\024\036\031\223\216\303dq\005\242\026\216\214D\306\244\361X"
+	.ascii	"\002\251E\211\253\b\341\003\n\244\321\n\024\303\"\036#!\013\302"
+	.ascii	"\020DD R$\215\030\036\205-\212\216B\025\214\307\027)Tp$D\201"
+	.ascii	"DL\001\350*B\030\032\t\223GF\026\037\220G#\2628Db\200$:\2560"
+	.ascii	"\2328\016\223C\026\222\305\341\361\270\202\210\203Q\221Xd$*>"
+	.ascii	"\300\002\"\"\213!\n.\214(` \022\036\205\350`\001\022#B\274\300"
+	.ascii	"aXdd\301\004\210\020&\216\303\"\"\013\343\261\204\211\022)P\220"
+	.ascii	",\016\221\212F\304#\020\023$\211\305\027z\212$R\244 \341\223"
+	.ascii	"D\236@\252H\235dr\210L\221\302\250\026\ra \022&\251\310\023\304"
+	.ascii	"#\"\234\243P\005\221\035\"\t\213v\230\364\"i\223\024 \036\021"
+	.ascii	"\371$O\214@\202\220\205\021HX\241&\207'\216$H\342\214HZ\001\203"
+	.ascii	"\321x\244&7hP\223.\204H)\013E\"\013\304#\242\016E\"RZ4,\032\021"
+	.ascii	"\221\305\027\\\b\221\212D$\236\244\n\202xDD\301\013\341\361("
+	.ascii	"\004&\257\002i$<J\001D\236\0201\302\004\361\210\210C\221\210"
+	.ascii	"t\243\"iT\034\036\271\020\"\335\030\025\211\307$RM\2368A\003"
+	.ascii	"\322\230\224$\242P\215\210)\212F\"5y\242h\224\004,\032%\2458"
+	.ascii	"\311\342\n\243\210\027\307d\361\001\023$O\030 \230,\022W\254"
+	.ascii	".\206E\305\025\206H\302\t\f\217P\b]\030\2568\022"
+	.string	"\262\370y\0057&\r\217\037\222F\343\361C\316\203A\021\033\2740\201\024V\242\020>\020\217\210>\024\211B\244\017DG\344\207\020:\300@4T!\242\350\210\270\"\004\322\250HL&\207H\tND<\016\213C\243\365%\030\240"
+	.string	"\0068\301\205\206'\240\323\220/?\274\332\036\350\364\003c"
+	.string	"e\264\326\220\216;\032Vm\031\003\376Q\255^\360@f\223\0339\2224\001\227f\\[rm\017\\\376@%\020\006\337-H\330\3326\001\370G\005.\005\017d\262_vzi\332\202"
+	.ascii	"T\002^\236.\034m\300\373[:\373\267Cel\tL[.\322\025\274\365\363"
+	.ascii	"s\243a\244\215\355\2532\027-k{\333\327ZC}vu@\332Z4\301[6Y\210"
+	.ascii	"D\327\360\365\345\355\361\265\275\345\373\255\236\335k\255\241"
+	.ascii	"\234\030t{T"
+	.string	"\f\244^\240%x;\003\226\025\330\0215y:\236\334\332\332\336\346\375\026\215M\243\342\331\301A\265\345=\006R5\210\006oe\310i\203\206f\251m\006g\3144\233?\354\332\336\232\371-\232\305\243[\302\302j\313-&x[\006\313\224\22472cR\035d\336\354\230\337>\255\030 \026\225\232^[\356\002\023\274\275\333)\202\244\311\232]\335\023!A\232\332\336\326\375\026\214\r\223\023\326\245\317\253-;\031H\245\200.x\373\245\247G\226RU[ /sOe\320`\264\275\235\373-\027\333\005\306^\364\257ms\300?j\252\025\274\335\262\206\311aQ\312\305\3018\363\367\244\355m\334o\265X\270\326\032\262\262\002Mk\313\026\250\005o\263\350\244\271\023\363zs\253\202\362Y\267\337\306`\333\254\322\326\333W\333\006\300\225\340-\026\rc2l\271m;`\263B\346)\214Z\333[+\277U\263k\235d\006\326Y[\256"
+	.ascii	"-x\233v\263\006\245K\220\266\035\252\3303 Qb\354\331o\2250\\"
+	.ascii	"\234\226/l\332Z \301[\263\365\357\017\213\2212\262\261\261\255"
+	.ascii	"(Kf\251\374\220\"\245\252-G1\320\230\030]\220+a\332\336\212\375"
+	.ascii	"J\236\271&M\352\332vZ\360"
+	.string	"v\n\216Z\204i\250\2033\324Q\234\351P\030c\2161\221\2214I\032\003\343\024@ H\2140\036\255\252\354\006\023\200\320't\3410\r\225\004)u$I\n\205=\346\324@q\n[\031c\243\332\001m\256\260\373\207\316\243\032\253\033\f&\360%\ry\267}\017\225d%6\317\240\bN\037\001qB\261\203\213\2762s\357\206\f\336?3\217\236U2\357\360M\222\216<\353t'\371\344p\202|u\016\016 _\203T\224\367\254\025\035\t\257\226\265&\246\257\361\034\273\356bh\275\332\036\377V\213\327\335TQ-E\246(\374?W^lktw\003\213\223<\336p5:\032\031\337\035\364\016\274\335\225\240\226d\244\256\251\315\233G\260\343\261\242\220f\243\024\034\323p^\007\f\267\316\367\275\264\256C\375\300\302G\277\355\325v\032\327\307\\\331\250\274&r\202\341O\020O\030W\203i\026\212\205\250A\002\272\212\234\330O"
+	.string	"\375"
+	.string	"\316\344\312\316\3150k\035F\313\375\003\206\236z#P4\371xbO\\\220W\277\202~@\260`\nB\263X\".\234\346#\fA*\b\203t\212!\026?\321\254!\234\312+g\364\322\220\rZ\265\305!D\004\252\243#\306F\32124\310\233\013)\027\251\310\363\002\253X\327\013\021\222\375\310\235\210.@\002]\242\203\234\201\3135\220\311B\266p\004\177\370P\374@\337\201[\303 P5\243\177\333\232O%\327\311\032W\306\003\264\366\317\361\321\300\005\301\260\024P\202\307\202\027\030\376"
+	.ascii	"&\235\302\354T\254I 4\321t3f\263o\001\b\327\272\034\361\3519"
+	.ascii	"\020\216\260E\251\266\356Wa1\272\212\035\216\365B\220t\2708\363"
+	.ascii	"\036[\027\003\374N\235t\214\225Y\350%\023\362\317\013/N\004C"
+	.ascii	"\222B\265\265\321\335\332H\016u\304f\330\3361k\266W\353\227\225"
+	.ascii	"4\025L\206\242\254ly\316X\261\360\360X\231f\250SxY\302\370\237"
+	.ascii	":\350\036_7\277H\251v0\310\370\030\370\030L\310\353\366\237\034"
+	.ascii	"a\246X\033-\246oT\203\301\345\273e\032\270\ft\242\204I\357i\177"
+	.ascii	"]\374\206$\002\326p\333+\240\343\002\230\307\224)w\366\350\275"
+	.ascii	"\266\274B\315\320C\245\007\332\210\031\306v\350\3402\202\022"
+	.ascii	"\354u\205\324\246\301z,\350B\217T\320V\345q\303\342A\261~JF\373"
+	.ascii	"\374\b_\214\023\237#\330./T\3543F\361\027t\2678K\324\315B\306"
+	.ascii	"0P\320\336\357>"
+	.string	"\331\273I\274\"\263\357g&\324\256\352\270\275Q\316\237\3779\256-\022&z4\370\304PT\207;#\241\027\314\274\\\270+t\220R\275\030b\274\002\215B1\361\004\177\333\251r\025U\364,\244\320\200\026\200:\253\236\022\300:\220\321\363?\212\274\202!\252\\!\304\026\276o3\303\335\035;\3544\234=\344\t\302\204\321\254I\237k\310\213/\361\214iJ\f\252\347\353\277\227\250\nFE\224?\311\231\251HR\315|Em\304K\346\231\177\300s\276\2143\2700\007.\303U\305K\333T\246\302M\330\225m\236\343SaO\234\275\031\314D\221\241\231l\211\344)\257\310\022nC\3148V\241 .\003\211RZ+T\326\215\001!\262\256\002\272\021\312\207@\252\325Y\250\017%\r\245^QO\263\027\302\233\206\214\201\375\212K\216+\201\304\016p\242\337\365\362\340,3 \354;\201z\320\fk\315h\314\201X\327,\025\321\342"
+	.string	"fK\273\004+(\001\021Symp$\326(1U\2349\265C"
+	.string	"r\204\360\217\317)V~\312\3505\255\215A\313\252\361B"
+	.ascii	"t\273\330\211\001\315\024\264@\227N-&!\210]\031C\232\t]\316\271"
+	.ascii	"\341\r\321:\024\273\016\306\342)\263^\206B\275HV\255\270\f^f"
+	.ascii	"\371H\322\272\204\261\326\374\361\315C2\016rp4\357\364\207\245"
+	.ascii	"M~AY\315w\300I\271\357\301\345lV\344\252\003\257$\313T\256\b"
+	.ascii	"\366\004\245}\036\022\322S\330x\206O\252\233\321*\013\001\255"
+	.ascii	"\221w\274\314\235\026?\320\341)A\205\254`\\\312\020\250\212\t"
+	.ascii	"\223\004\332\332Dl%\026Dq\306\261\204\235\222\032\341\224\346"
+	.ascii	"\032\217l\023\204E0\361\nE\027\024o \235\326>G\034J\210cy\251"
+	.ascii	"\013\0072\210\321$+\027\t\256\0230L,<\245\270I\256\0237\025E"
+	.ascii	"h\020<\302fBh\001\"\017\177~\2013\375\235\033\247\311O\307\225"
+	.ascii	"\313J\235\322\347\367\353\254\036@\335\335\265\341\n\311\"\032"
+	.ascii	"\027!\3313\325\262\302\"\213\032\004\366y*3BX\023\372B\253\222"
+	.ascii	"3\377cF\271\322\240$\277\301\257\340\31678\367\235\260\ri\004"
+	.ascii	"\335\211\t\203\034\r\305\201x[\300<b{\005<3\252\353\215E-]\254"
+	.ascii	"h|)\312\025\354\"\332\200\210\235\311dB\b\210V\331\265\342\261"
+	.ascii	"\020R\331\0276vt\002\377\200\t\306\334@K\300\335\204\2713,\227"
+	.ascii	"\240C\341>\250\210%k\0053\310\n\245#\021\264\004A\376=E\235s"
+	.ascii	"\304x6Ov\254\374@2\307\017RM\275\211A\r\213g-&,i\207x\272\275"
+	.ascii	"\347\270\035\304;\bO\371v\244\340\264\321\332g\264\203\3714\302"
+	.ascii	"\312\213r\273F\364zz\212\272n\222\342\313\373\307N1\033b\275"
+	.ascii	"\247:2U=\303\304\306\304\361\032R\2258\001\214\030\006\346\b"
+	.ascii	"Sc\265\366\315Z[\352q=`\333,A\243/\371\331Q\303\251m9\273\275"
+	.ascii	"\004\027\264\342&G`\372"
+	.string	"3\005&\321\016"
+	.ascii	"u\306\272\203\207\313\025o\370\311+\227V\305\322@\003\303\242"
+	.ascii	"\016\212\023;0\314c\353N>\373$\251\254\262\205\b\261\030L\023"
+	.ascii	"\034\001\351\345\310-\037x#\317<\336\237xz\305\231\227\317j\230"
+	.ascii	"~~\243\267\022C\207\374\343\rmJ}\377\321d\f\334\200\217\320<"
+	.ascii	"y\035\343;\2314\330\242\267-\036\221P\252\3732X\354"
+	.string	"H\n?\026\210I1\354\343$\322\222\f\320}D\376\225\037(1\2728\\\243\343\260\2124D\241\345\320\004`\007\230\325q\230\316\237\203\200\016\200QF\273\032\216\030~>s\272#\3479\t\346wZ4\357\201w\354'\250\365\277\236\006G\330\360\360\326\370_\007\201 \013rI\177t7\033\207\230\001\351{\224\333FGS\317\340$\267\tQ0\205\354\321B\313@\367\200\177\021\324\253a\220\320\375\350`\371\215\025\244\227\036\247\354Z\311\305\334\325\031#8pK\253\016\025T\\&m.\030\200NK\341W\013B\263Cq\263\322\376;\337\320o\027\316H\007W{Qx^\023\342*\\\335\025\004\317\227\257\253\337\fq\323\260\243\275 \365\305&!q\305\335\016Z\276\3359Zb\\\322\025\207\327\020\373\036(\275\270n,3\300\216\031\270\213\017\346a\230Dki\016\020\326\3003\206\317[\230\360\024\f\217 \362\017\252\274"
+	.string	"\311\t\246\177\300\362\002B\037P\373\001\360\266?|\357\3573~\237\353}\226\0273\374\244\3319\253\373\217.\270\371\354\344\344\213;\f.\262\367\364\334\324\265}\307\026\262\365\334\324\304\245\035\207\226\334ydf6+\273\370\261\334\304\223-L\375\257\307\275\342\357\016\236\3139~\353\236\217\025\030\346\317;\356\325}\200"
+	.ascii	"\214\336.\032/Q@|\323\254?\210\266\267\031\344&t\236~\354\024"
+	.ascii	"}\340\236\233G\357\321\371Fx\331\275\021\307<x\214\365\217\235"
+	.ascii	"\243\027\357\352\357\223\271\251\340\333y\206u\340\345\r\202"
+	.ascii	"\367E\341m_\216\346\201\rg\005uXp\205\313t/'^\216\356\235\227"
+	.ascii	"\364\201jO\253X\362\336\373}\032\324\235]/9K\342\363\\\205\316"
+	.ascii	"\206\035\276\331\002\347\365\312\317\230\305w\023\303+~Aq\324"
+	.ascii	"`\337o\262\373/G\177\217\337\020\200\317\211\307\343}\376\373"
+	.ascii	"m\350\343\303\236\331\275\375\376\210\331\302:\353\207\026\376"
+	.ascii	"\277;a\262>PU\244\357\360_\273Jt#\212\215%L\210\370E\362\334"
+	.ascii	"\325\005-\337x\007\373\345\372\251\223\260\205;R\364\255;\007"
+	.ascii	"n\2234V`\243\352*c\366V\021\306\264\226\277\344\263u/\026\377"
+	.ascii	"X\036\320\246\247\264\031\260\005\373m\231zp[\301\263\374\362"
+	.ascii	"<\221\355\213\207\301)\275\275?\365\355xX\330\306\354*\266\017"
+	.ascii	"\026_\223<\0265\376y\035\3053\333\337Em\026f\363\262\026-\323"
+	.ascii	"x\342\327\007_\240\264S~\234N\261#\034h7\356\225q\234\364!\273"
+	.ascii	"I\365kS\224\2776c6J\367]\001"
+	.text
+	.section	.gnu.lto_.symtab.1b9da044c9b9e2d2,"e",@progbits
+	.string	"settingsBuildCheck"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301"
+	.string	""
+	.string	""
+	.string	"valueTableNameIndex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322"
+	.string	""
+	.string	""
+	.string	"valueTableEntryCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325"
+	.string	""
+	.string	""
+	.string	"valueTable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\001"
+	.string	""
+	.string	"lookupTables"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\001"
+	.string	""
+	.string	"lookupTableAccHardware"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\001"
+	.string	""
+	.string	"lookupTableBaroHardware"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\001"
+	.string	""
+	.string	"lookupTableMagHardware"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\001"
+	.string	""
+	.string	"lookupTableItermRelax"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\001"
+	.string	""
+	.string	"lookupTableItermRelaxType"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\001"
+	.string	""
+	.string	"lookupTableGyroHardware"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\001"
+	.string	""
+	.string	"lookupTableInterpolatedSetpoint"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\001"
+	.string	""
+	.string	"lookupTableOsdDisplayPortDevice"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\001"
+	.string	""
+	.string	"lookupTableLedstripColors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\001"
+	.string	""
+	.string	"lookupTableRangefinderHardware"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\001"
+	.string	""
+	.string	"currentMeterSourceNames"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\001"
+	.string	""
+	.string	"voltageMeterSourceNames"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\001"
+	.string	""
+	.string	"debugModeNames"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.1b9da044c9b9e2d2,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,348 @@
+	.file	"settings_index.c"
+	.section	.gnu.lto_.profile.49bbe83aeb53b038,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.49bbe83aeb53b038,"e",@progbits
+	.string	"(\265/\375 ;e\001"
+	.string	"\024\002/"
+	.string	"\003"
+	.string	"\233\202\261\313\006"
+	.string	"\001\234\223\217\362\016\006\002"
+	.string	"\330\253\377\360\002\006\002\001\002\002\003\002\004"
+	.string	"\003"
+	.ascii	"@\3609\2636\200\005"
+	.text
+	.section	.gnu.lto_.ipa_sra.49bbe83aeb53b038,"e",@progbits
+	.string	"(\265/\375 J\255\001"
+	.string	"$\002>"
+	.string	"\003"
+	.string	"\001\003\001\003"
+	.string	""
+	.string	"\003\001\001\002\001\002\002"
+	.string	"\b"
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\001\003\003\001\200\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007"
+	.ascii	":\251\202\0203\203p\001\270\214~\tc\003X"
+	.text
+	.section	.gnu.lto_.inline.49bbe83aeb53b038,"e",@progbits
+	.string	"(\265/\375`\b"
+	.string	"\255\005"
+	.string	"2\313$-pK\222\016\360\202q\320\f\236\303\205\234\340\0238\b \307\3211\252\033\304\367H\363\244\231:\354\253\252\352\001iP\263?\327\b!D\312\024\357L;\323\254\242\276\017\366'\364BCBA@JD\"\002p\235\211OF\275A_\234\371)DD\306C!\355\021Z\231L6\006T\331\177)\331\251\320\t\016\fH\300\\\315\353\221z3\244z\241\336\335\265o\270;\351\327\317\312YAJ\310\3120-\030\265[\013Z\035\272"
+	.string	"\243\306\272\260\232\007\245\334\335\362\352\216\f"
+	.ascii	"\032s\f\350f!\030\326&W\330\277\204Jz\242\31584\316`t\031N8K"
+	.ascii	"\331@\033"
+	.text
+	.section	.gnu.lto_.jmpfuncs.49bbe83aeb53b038,"e",@progbits
+	.string	"(\265/\375 te\002"
+	.string	"\244\003h"
+	.string	"\003"
+	.string	"\001\001\003\177\002\005\001\003\001\001\001?\177\002"
+	.string	"\177\002\007\177\002"
+	.string	"\002"
+	.string	""
+	.string	"\001\300\004\001"
+	.string	"\300\004\001\177\002\001\001\016\001\006\004\177"
+	.string	"\001\002\177"
+	.string	""
+	.string	"\377\001\002\177"
+	.string	""
+	.string	""
+	.string	"\006"
+	.string	"07\006\233"
+	.string	"\322K]z0\373\333"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.pureconst.49bbe83aeb53b038,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\200\004\001\205\004\002\264\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.49bbe83aeb53b038,"e",@progbits
+	.string	"(\265/\375 8m\001"
+	.string	"\004\002,"
+	.string	"\002\001\003@\300\007@"
+	.string	""
+	.string	""
+	.string	"\001\002"
+	.string	""
+	.string	""
+	.string	"\002\002\300\005\300\007"
+	.string	""
+	.string	""
+	.string	"\242\200\340\277\002"
+	.string	"\004"
+	.ascii	"-q\340\256\256y\030`\001"
+	.text
+	.section	.gnu.lto_.lto.49bbe83aeb53b038,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_lowerCase.7.49bbe83aeb53b038,"e",@progbits
+	.string	"(\265/\375`\311"
+	.string	"\025\013"
+	.string	"\306\026M:0O\224\016\b\3307\0164\035\311v\315\017b\177\344\316\343\340~\035\362\240\363s\271\366\023\334\\\377\235\0277\353\026=,1\"\204\231\226n\355P\001\032\371\327\334\030\331{K\231R<"
+	.string	"<"
+	.string	";"
+	.string	"\"V\354n\244^"
+	.string	"\376\271\017\200\177\252\341\327\237\323\274\374\t\342\360P\202\223a\177\236\273"
+	.string	"\231\347* \3238jw?zv\262L\346\004\331]''\303p\303\333^`\373\200}\005\001\027\375/\323.\323\252\351\324\364\031\214\f\004F\354^\330Z,\212w\242\203\355\313n\330\316\264\021$\270.\252`\335\375\2200\261\273\016G"
+	.string	"\177\266\375\017\007q\331$\247m\310\030\2146\001$\250:),\251\276\024\233\013Ln\267\206=w\027S\r\331\300/0U9\204(i\222\205?\372\005^So\341\223\311\315O\257\251bs\201\311\315\326\260\324\220}\267\n\2322\r\003\325]=(D\036H\254\006\025\b\022\313b\211T\242\025\241\212\022\313\201\204XQ*\361Ay2!B\211\226\311\204\022\033\266\255\355\335*\310\351\240\246N\352\264c\333)\205\321\214{O\241>\035u\007\020"
+	.string	""
+	.ascii	"m\030\004S\242\347)h\f\250x\252\371^\277\325cVqat\032k\354\332"
+	.ascii	"\232\022\231\025\243\302\374\251\032C\235\336\332R\006"
+	.text
+	.section	.gnu.lto_compareSettingName.8.49bbe83aeb53b038,"e",@progbits
+	.string	"(\265/\375`N\003\305\030"
+	.string	"\226.\241G\260ZM:\270\321S`\367\212]\330!\207\355%\206\006}\343<\261\207i\371\021<^\326O\024\320$~k\251\231}\353\222\355\033\371a\375y\020\006\302\271O9\320\330\306i\260\371\363\252:\335\306 \226\020\262\367\2262\311\217"
+	.string	"\203"
+	.string	"\215"
+	.ascii	"\265:Y-\2515\207`\305\357ss\337\201<\210m\327\211\314\315\270"
+	.ascii	"5@\222$%\246\326*\352\334\206~\312\303\350g\313X\3278\216\343"
+	.ascii	"e\356K\331v\360\363\350\224\315\266=\353Vt\220\300'!LY\361\364"
+	.ascii	"\253\024-\344c\354\242.u\002;R\270`\257uK\272\316\210\251\016"
+	.ascii	"\026\237\032\254\270\300P\341\342R>x\362A\243u;!\033j\n\312\253"
+	.ascii	"\316K\267#\356\353\316MF\245\033\213\263\027\241\326\272\254"
+	.ascii	"tS\361e}w\177\354\356\205\335v\020\373\372\324\327Ey[\347\255"
+	.ascii	"\231\2744\036o\330\274\254\346\005)\357w^\357T_\332\274\263y"
+	.ascii	"%\345\355\363\362\344}N\b&\026\246V\024c\231je2\301q\252\177"
+	.ascii	"j\367F\366U\033R\211"
+	.string	"\320\001k\205!%G\255\265\302\367\"{\335\206\237\373)\003\262\352&<Q\262\245\326\334\316\347R\370>\277k\333\rw\211\020\345\274\352Q\024\223\203\346\335\004\013l\207*\261]k\323\030\005\347\335\013\371\020\333sD\007\020\327\375\200\227\021\251\311\210G6\302\344\024e6nY\273\246\276i\332K\033 \tS\027)\202\336\364\257vQY\216\230\314\262z\366M3\025\244\034 \353k\260\247\231\020_\254\275\316\301\022\262\354\335\017@|\245\331:G]\264\335\262\333I\322\231=\022\022\265\357\306\236\210~v\177\351\305\333\246\271\217\304\303\210\307u\365\373U\3379\241$\351\214\t\036\373\312\016\212\252\033\267\233+b\006WV5\266\235vqn\236\373mN\344\217\035\352\2075\007\0348\314~\344\3542\240\036\f\241\207\241\0164\031\b*\003\352\241\311\365\341\031!\373\241\3156\bu\240\315\206\206dB\342\f\204\217H\233\365"
+	.ascii	"\211>AB\"\217\316\326B\310\202\304\241Z-H\f\267\276\235\226="
+	.ascii	"\236_\352\031lh\371v\376\252[\3305I\332\257Wo\004\023md\003l"
+	.ascii	"\034\0138\242\243\314\2675\332j\356\361\323\242\351X\327\300"
+	.ascii	"\232\246/\365\002_\302\fX\361\344\303k\334\202d&N\317\037\274"
+	.ascii	"K\035\266\204*\260\016\273\261\\\326Z+m\334\rPW\343t? p\002\231"
+	.ascii	"A\263\r\033L\360k\354\331\206\t!v\347HK\025\272\271`\205\004"
+	.ascii	"\f\273E+\357\344\013\321N\320\032v\347\266\253)\242\323\211\002"
+	.ascii	"\340\256\237\361\300\026t\335l\261\362F\f\273A\267?\016\302\034"
+	.ascii	"\220E\206\346\233p\027\221\231\321\026\320IA\001\020\031>\312"
+	.ascii	"M\024r\3008\023P\034N\256\304h\273h.t\031\026\267k\270\206q\003"
+	.ascii	"x\204 \341\335\241;l\301\365\250\2731\035\222\332\343\242 \221"
+	.ascii	"\rmsjir\301\tS\326\334\271Nk\236"
+	.text
+	.section	.gnu.lto_settingsIndexFind.9.49bbe83aeb53b038,"e",@progbits
+	.string	"(\265/\375`\024\004\335\034"
+	.string	"&\265\271I\240VN:\304\347\302W\340\202'L&\337B\016]\276\350\373\300\003\267f\214\r\261L_\236X>\331\213\364\237s\301\253\005u\331;\255\307\205'PbVz\177S\016\263Kg?\315\360\036Z\372_>\254%\204\020\"wJ\001\245"
+	.string	"\234"
+	.string	"\250"
+	.string	"\005N\372\301yrg\034\251\255\200\001\322\207\244\360\326Je\266\200R\373Y\027\202t\241\212\333\324j\305\244X\253\360\200u\347I\013\317\003y\020$'Q!\326\323\202+,\266\320j\025\352j\216S\236\244\317\225'\227\206O\233\233\364\332i\2266r\\\232\344+\275\006\345\351\005\221\211\236\001\252\242\246n\002wH\275\374EM\335v(O0b\240~\224\344"
+	.ascii	"FKU\324\213\217c\204$.\234nP+Fz\243\212\226\027O\203PMtO\274"
+	.ascii	"\200\036i@(\251S\263\247\326j\n\204\212\272cn\233\210m\f\366"
+	.ascii	"n\t\275\021\345\201'\375\021\345\311/\225\217\037SK4\315\026"
+	.ascii	"*\321\275\262?@\312\017\240\327\312\326\311\301\271y\327\235"
+	.ascii	"\303]\370\333|\310_s\257\233\346`\367mF\306\324\347\207\267y"
+	.ascii	"\256\273\034\251IJ=\216\324[\243\246'\365\001$\030\346L\251\325"
+	.ascii	")\rL}B\206\345x\327\357\365\203\375\303\237\353\366\215\370G"
+	.ascii	"\376\365\"X\t\264\013\367\362\215\025\253\347\314\313\031\205"
+	.ascii	".\023b_\316j\255\022\316\223\267\221\374\"':\206\213g\247Vk\025"
+	.ascii	"\026\035=D\276\205\364!\317X\271$\0041;\253U\030{\345\177\211"
+	.ascii	"Tf\210\331\326\252\354\271\245d]\264\312\232\350\0272\030C.\344"
+	.ascii	"^\371\346D\2654\253\263A\343~V\226F\023en\037%\213V\225&\372"
+	.ascii	"\305:t\\rm\326\316\240\201\036\230\333\235\337*\271f\311]%\033"
+	.ascii	"\356\244\303\277\260jmj`\033\305\311<|8\366&\037@\370\370\354"
+	.ascii	"\277jd\321\354\256IcI\210/\3611\240Rk\223\003_\311\305~\306\343"
+	.ascii	"8\351\035\217W\236\244Y\bca\006N\367\266\273\365\013\303D\323"
+	.ascii	"ln\271t_<\001\037E~TL\213E\206\016\264\335\253\225\331\263\b"
+	.ascii	"\363\260#\361\215\307\341@\275\241%E\210\350\001\215'\212\204"
+	.ascii	"6\210\327\013\032\203\216xD;\241r7\344C4\372\007\001\212\035"
+	.ascii	"\020Q\017\204\217G\324;:\332\371t=\241\037\035Q\317gH\367c\344"
+	.ascii	"\323!\330q\021\211\235\221\356\250\250\310H\027\343\372\265\362"
+	.ascii	"\211?\317vd\235\327\271\030u\366\334\340\272gi\231j\266\333\332"
+	.ascii	"\274Ys\203\266\225\353\321\234\331\022\247%D\313\311?\326Z\353"
+	.ascii	"9\2269fTfo6\370\342+\3440+q\366\304O\360*\243>O9\263A7\220\032"
+	.ascii	"\263a\026o\301\251\005y[\334\006=\222\346\346\374<%nq\226\224"
+	.ascii	"\352b\303#F\2142P\250\2010\204\214S\304\030\231\221`f&\2143\006"
+	.ascii	"`\002\021:\245\007\020pH\323d8\211\221($\374D?KN{*\023\2501\372"
+	.ascii	"\244,\037\n\177P\212\275\255\342\2158\235\332\232\252p\026\002"
+	.ascii	"\271&\022\370\212\301\257\302-\304\373S\240~\001,Ks\025\200\303"
+	.ascii	"'5\034Y\024\364N\250+N\204\247\20026\006\220\321'$s\325\225\241"
+	.ascii	":\314\032\353a-x\001\272\312\340\267$\377Z\241.n{ :3\b\232\275"
+	.ascii	"|!\314\"\257tE\247P~?\t4\247\307\202\334\002\001\0223\264%\365"
+	.ascii	"P\264\267\363\245~)\004\266HS\301\037\005\302\274\206\364\235"
+	.ascii	"\023\376"
+	.text
+	.section	.gnu.lto_.symbol_nodes.49bbe83aeb53b038,"e",@progbits
+	.string	"(\265/\375 \206-\003"
+	.string	"\024\005\202"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\007\177\b\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\220\202\202\200\006\b\177\t\252\333\3426\t\177\n\212\271\345$\272\220\202\002"
+	.string	""
+	.string	""
+	.string	"\005\n\013`\013\f\f\r\003\001"
+	.string	"\312\302\353\343\003\001\242\001\006\003\002\001\370\260\241\355\003\001\242\006"
+	.string	"\007"
+	.ascii	".\353\201a\320Xey\360\032\236nhk:\001"
+	.text
+	.section	.gnu.lto_.refs.49bbe83aeb53b038,"e",@progbits
+	.string	"(\265/\375 \023\231"
+	.string	""
+	.string	"\017"
+	.string	""
+	.string	""
+	.string	"\003\002"
+	.string	"\003\001"
+	.string	""
+	.string	"\004\005"
+	.string	""
+	.string	"\005\007"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.49bbe83aeb53b038,"e",@progbits
+	.string	"(\265/\375`2\017\205M"
+	.ascii	"\332\202\350\034R@\022&u\372\017'\237\031\221?}\375\255\007X"
+	.ascii	"\374\366\345\367\236\263\253?\337\2253\006\261)\373Q\310\217"
+	.ascii	"\251<dd#%\237y\303L\177i, &\353a\234\230\275\315\034\317\254"
+	.ascii	"\333\273wu\265\f)\232\305\261\223\223\321\037q\001\221]\351\366"
+	.ascii	"{\247\224\002\221\001\266\001\263\001pM\205\246X\363HrA\230\377"
+	.ascii	"m\225\236k\271nv\\\357\300-\245\337\270\331\3476cf\301\334\343"
+	.ascii	"\323q\315CSAY\346#U\311\362U\351\260\304\226\345\277\365\371"
+	.ascii	"p|;8&]\331M\271\233.\257\227C\270,\357\351\311\310\322S\266q"
+	.ascii	"\371\203\213\3237*\332%\324\276\241q\350\346\211\316a\346\313"
+	.ascii	"\326\027.\236r\006\227\373"
+	.string	"\204\332\317>\241r\005\227c\\\024}\243\246d}\243\332p\2538\201\274y\312\013\\N\340\362\\\226\276\251A\254\347\230@\334\322\320\f\b3\002\361\024\355\254\227\311?\376\277\tW\342P\226\345i\267MC7u\232\214\273\254\315\030\306\310>\373\317\366\334\210\2272&\236\326\364\215\352+.\367\030\227\200{\037\216\271\334:*\372|\266\016\023\235{tr\326\345)s\21317Wwu\030\212lZ>\331?k\323\343\202j\001\213\355\355\326\270$\341\341i\1775\0307\333^\334\343\303hQ\354\273\376\277Y\027\313\177c\263\275.\377\306^w\212\356\024\351\022+\030\314\324\224\3752\3337\352\355\022*s3\360\001s\3530\267\007\314m\001s\313\350\200\271'\340\240\206\001\314M\203\231\255\260\0313\3430\373\016\346\206\321\03203\313\314:L\202\2713`\036\263\233@\203\331\213\230{\006sS\300\334\0210\367\003\314\335"
+	.ascii	"s'\320=\314\f\306\334+\2309\215\231\321\230Y\214\231\303\230"
+	.ascii	"\231\206\231s`\346\364\371|>\231\271\013\263\2571\363j\004r5"
+	.ascii	"\264\032\226_\365\031\3322\257RS\315\261\234\252\305\320\226"
+	.ascii	"\271[\2722\363\341\240^\322\340\304x)\247>n#\373F\265q+\346\335"
+	.ascii	"\b)XV`z\312\251\n\227S\344\345\024\3512\372\345\372\024\233\323"
+	.ascii	"k\0369V\005q\177\350!\324\224\270\234]<\351LnK\005\347\321l~"
+	.ascii	"E\271\222\247\240\244\304\243:J\273\241,3\246y\345\345\374g="
+	.ascii	"\252uh\037P\226\211\301U\327\017_\301\245\034\210\367p\026\334"
+	.ascii	"G7=\212\217QMDsQ\223[\342\374\177_\216\257\303\240Pp\326\354"
+	.ascii	"8\324\356\310~\273\213\263\002\204\214\207\313\250\024%\257U"
+	.ascii	"\036)\033\273O\335\364\244#SO\372\016G\001\rK^\265\346SO\313"
+	.ascii	"\255+*M\335\211\355%D@9=e4\353\372\2223u\323\2338\025[\2623\250"
+	.ascii	"\261\207\024\265\035\265\367|>\237\275\2432J\3442\252\274\214"
+	.ascii	".\335\023z=\274\222\274d\271\334\302\212\377\t^\230\377G7v\021"
+	.ascii	"\376KU\2768\377\217\314\354H~"
+	.string	"\354\246\033\275\350\363\341\214\360z\242\305\024w\333K\177\351fN?i\266\354\360\204\345\355\226\360\3379j?\237\235\243\262C\331R\226\3256\345u\261t\226n\266\226\276\302\315\326m\354\354\177\333\302J\327\321\030k\376\250\264\324Z\272\210\256C\331&\227I\211\311\371\337\342\370|3B }-\267.{\220\313\2622M\246\312\240<e\377q\331\233\256\223{|\272\322-\313([\256\\\272\016\342\207\020\335l\272\006\202{||81I+-li\312Mw\271\241\\\356\265\333\003\216z\265\003\226\336\272\3543\205H\213cZ<u\261\026\353-\201\273\232r\203\261*\002\b5.\\\\\016\266{\005\224\2449_*\371\305\016\246\206A\001\202\211\247\356\325bj\224\224\250\247\247\336\325n2\\PeZb=-.Lqs\227=\211\317\300\256\325t-\337j\251G\345\234qSJ^\nj\207\331\225\260o1\033o"
+	.ascii	"\230Vm\356J\357\234\316\255\315\312\231\325\377\024`\330O\"\361"
+	.ascii	"\270a\272w\230g\032\355\002\376\231\031\035\341\2778\346\254"
+	.ascii	"\273Yj\306\037(~\347\277\230D\266UE\033dk|$\rS\2246H\366\251"
+	.ascii	"L|+\344\221\354\262\230.\213\376\354\037\253\224\177\\\026\207"
+	.ascii	"\220\354'\237]\026k\376\250\254A\262\306\"\262\255R6\262]*m\376"
+	.string	"\370\305?\032\251\356q\251D\272-\2255\310\326\250D\036\253\224\375\354\362\233\212\023\266\252\230\364\255q\346\377\233Xf\221\367oL~\021\316\235\276\312\351\364S\337S\266X!\377\377_$\233\263Z\356X\244\237\202D\262\314\221\364?\367N.\212]d\377_\351\221\212\375\237\304&\377\221\2266\244\226\315\203R\362g\376hlB\262Z\362\222\220\226J\217\204\252\225\310\326j\311bm\254e>\022[l\346\317U%o[d\277\255\314\264F\244\232<\365,w\031\034\t{\026\263\254g\021\320\245S\364|\234E\221A\215\301\2314.\264\265)y\312d\030l\360\314x<)\342\351\0138;\254-LF\252\313\335\205\345\313\246b&w\346\202\027q#~\304\211t\323\261\274\312\205\370\020o\001\371\004\253\241x\020\264eb\240\204\346l\322k\355$)+Q\210\302\210\267\022\205\350\210\022+\321H(\206\016\242\225\b\001"
+	.string	"7\210\302\bl\202A\277\0136\b\022\375\206\202\204\200$\030E\260\350\027\203(H\202\320p\307@!Q\220\030\004\272\354\342\005\002/`\034\305\254k\260\b\007\016!\365FP\004\340oH-\372\031A8\004\216\b\006\375\210ipH\307\232\256F\303\037\007\302!\260f\375\351iq\364\233\321\323\302H]\203?C\022\024\254#\202C\020~4d\f\031\211 $4TW\233\030u=\372\005\2413\210\302\031\302!0\207(\fBo\004\211@\302\"b\215\243_\020Q\030D\263\252\016\b\207\300"
+	.string	"t\374\210\210~0+\347P!"
+	.ascii	"\013\r\005\211xV!!\"\036\231\"\240\337\020\007L\321O\f\031\033"
+	.ascii	"\b\207@\023Da\320.\307\nD\f\016\217~A; \242\220h-R\327\037\030"
+	.ascii	"1EBC\253\020\004\025H\210\203(\004T\327\037\"\320\020\f\021h"
+	.ascii	"\b]\177^\260X\211B\243\313,X\304@Q\343\002\t.P\305Q\360\006Q"
+	.ascii	"\370S\004D\024\256k\260\210G8\004\362\020\205\277 \036 Q\021"
+	.ascii	"\217\n\002\210~9\200)\016`\351\020=\236xae\244\220i_Q\322\202"
+	.ascii	"\354x\2769\2242\257\257!Xm]\267c>"
+	.string	"\245\265\371\023\256\263$d48\331R}@\243\022\342\251\253y\223n2\233\257\261\355\233\\\334\\\330=\212a\266\2633O[\321\3775\\\2759\325#tI<\320d\242\240\300\224\236\276@v,\242\225%\315@F\346e^\303\376\225\016\314\177\026\016\340\275\005\261eUw\257\316\2124\251\272\314>\326\364\261\256s\261O\312\310\271-u\311\362\357v@\307\240$\313\311S\206q\n\013\3636\007\311\017\316\227\222\332\221\241\233b2\304\231\260\267}\326N\256\004\201(\250\221$\207\024TFDFDd4i\322\001\361\004\304(I\251+\017\021P)c\312\324\214&I%\215\001\266\300\274\235\260\221\273\001\256\337\237)4C\366\005\215t\341r\305!\210\337XA\023\3368_\361\031[\336\3720\366\223&\026\025\221\234G\304svE\342C\255\213\036\201\030\f9\030\313\234/\033Z\206\275[\322O\302?\202\276\312\252E"
+	.ascii	"\005\211\212j$\r\337\366\262\320\277\3202A\344:\215si)\346\312"
+	.ascii	"\210"
+	.string	"gQ;\373\274\035\320#)6]\270\003\031\363\272\303^'=!Q\007g\322x\002\317\330F"
+	.string	"HG\312\t"
+	.string	"?\351\317C\337\206\335\356\365\343&\216[tv\342{85\343<#\037\365\n\364\360\037\021=p\265B\206o'\317Q\301$EW\307\266\377\233Q\030f\321\336\030\262\202\206\263\205w\177\3010\024s\006\265\220\222L&\\*\232\034\021$m\332[u\013\320\347\360\250\345\200\343\036\r\366\006\344N\324O\336\200\032x\247\262\350\001\230\316:+\007\343<\205\356\371k\020\232\035\025]\221\317E\324\261R\225\375\277"
+	.string	"\373{\204n\235\232\204s\336\274\305\267Q\356\036\346)\267\340\322uOJ?\251\301\353=i\341\234&\003\352\325\316\203\006\2009w8J\335\026\241\351\360\262/\267\236\214\016N\356J\207\250\266\237\034\0212s\360!\260S\310\301s\263_Mom\206\273\022c\214Cbk\024\021\026\273I\330\207\222$\220\333a\206P\304\356\354\177\317H\345Bd\354"
+	.string	"/\036\355\2042\031\302\025$\216(7.x\266\217\201\303d\213f&6\314V\326\341\303\353\225@\204\365L\320\3235G\354e0\022\301\322?N\265\013\343y\375N j& \b\342c\264\001\322W\335\217\340C1mq\325b\203S\365`&\303\300\\\023\013+\273"
+	.string	"\211\037\206\363\200\205\274\234S\020\207\266\3008 \230\001\177\364\231l;\240:\306H)\301w\2226\325\013Z\353N?"
+	.ascii	"\215\336a\273\267\022N_\033y\372\264.(bf\031\274\317fzt\017\016"
+	.ascii	"\203 \244f\017\261:\231\362\200\362\031LT\021\024'\214\r\203"
+	.ascii	"\316\362\375w5\375P\025\t\330\365Q\226\017\004\027D&\blh\230"
+	.ascii	"\277i\337h\037^\364z\375\376\340\3724\020x\037\347a\f`\271\245"
+	.ascii	"v\224Y\r"
+	.text
+	.section	.gnu.lto_.symtab.49bbe83aeb53b038,"e",@progbits
+	.string	"settingsIndexFind"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\001"
+	.string	""
+	.string	"valueTableEntryCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\001"
+	.string	""
+	.string	"valueTableNameIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\001"
+	.string	""
+	.string	"valueTable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.49bbe83aeb53b038,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,344 @@
+// this file is automatically generated by src/utils/settings_name_index.awk, do not edit
+    127,
+    126,
+    129,
+    131,
+    130,
+    128,
+    132,
+    246,
+    245,
+    243,
+    244,
+    23,
+    19,
+    200,
+    199,
+    20,
+    21,
+    22,
+    221,
+    223,
+    224,
+    222,
+    66,
+    94,
+    93,
+    95,
+    24,
+    237,
+    197,
+    195,
+    196,
+    164,
+    255,
+    35,
+    42,
+    39,
+    38,
+    37,
+    41,
+    36,
+    40,
+    97,
+    104,
+    71,
+    74,
+    73,
+    70,
+    72,
+    339,
+    340,
+    341,
+    342,
+    108,
+    137,
+    205,
+    201,
+    202,
+    208,
+    209,
+    206,
+    207,
+    203,
+    204,
+    125,
+    124,
+    103,
+    253,
+    252,
+    250,
+    249,
+    251,
+    227,
+    231,
+    235,
+    175,
+    295,
+    307,
+    304,
+    305,
+    306,
+    308,
+    189,
+    188,
+    187,
+    186,
+    191,
+    190,
+    185,
+    184,
+    183,
+    17,
+    16,
+    300,
+    228,
+    232,
+    236,
+    85,
+    86,
+    90,
+    91,
+    92,
+    88,
+    87,
+    89,
+    198,
+    267,
+    263,
+    265,
+    266,
+    264,
+    110,
+    62,
+    96,
+    170,
+    169,
+    166,
+    168,
+    167,
+    173,
+    172,
+    171,
+    174,
+    322,
+    321,
+    323,
+    316,
+    319,
+    318,
+    320,
+    317,
+    330,
+    329,
+    331,
+    324,
+    327,
+    326,
+    328,
+    325,
+    165,
+    9,
+    10,
+    18,
+    0,
+    4,
+    3,
+    2,
+    1,
+    6,
+    5,
+    8,
+    7,
+    11,
+    12,
+    15,
+    238,
+    241,
+    242,
+    239,
+    271,
+    226,
+    230,
+    234,
+    113,
+    120,
+    119,
+    122,
+    121,
+    162,
+    161,
+    248,
+    215,
+    211,
+    213,
+    212,
+    210,
+    214,
+    259,
+    260,
+    256,
+    257,
+    258,
+    309,
+    240,
+    268,
+    26,
+    25,
+    27,
+    28,
+    34,
+    33,
+    32,
+    30,
+    29,
+    31,
+    63,
+    45,
+    76,
+    43,
+    44,
+    77,
+    75,
+    254,
+    82,
+    81,
+    79,
+    80,
+    337,
+    225,
+    229,
+    233,
+    194,
+    272,
+    178,
+    216,
+    217,
+    311,
+    310,
+    146,
+    157,
+    143,
+    149,
+    338,
+    182,
+    297,
+    296,
+    138,
+    141,
+    52,
+    53,
+    54,
+    61,
+    58,
+    57,
+    60,
+    56,
+    59,
+    55,
+    315,
+    313,
+    312,
+    314,
+    159,
+    273,
+    145,
+    156,
+    142,
+    148,
+    46,
+    50,
+    49,
+    48,
+    47,
+    51,
+    180,
+    181,
+    179,
+    68,
+    67,
+    299,
+    298,
+    160,
+    69,
+    133,
+    135,
+    134,
+    163,
+    65,
+    64,
+    333,
+    336,
+    334,
+    335,
+    294,
+    278,
+    279,
+    280,
+    284,
+    275,
+    288,
+    289,
+    291,
+    292,
+    290,
+    276,
+    287,
+    283,
+    286,
+    277,
+    281,
+    282,
+    293,
+    285,
+    274,
+    84,
+    83,
+    140,
+    139,
+    219,
+    220,
+    155,
+    154,
+    261,
+    332,
+    270,
+    269,
+    152,
+    153,
+    151,
+    262,
+    136,
+    107,
+    247,
+    78,
+    106,
+    109,
+    105,
+    111,
+    117,
+    115,
+    114,
+    99,
+    102,
+    98,
+    100,
+    118,
+    192,
+    193,
+    112,
+    116,
+    101,
+    302,
+    303,
+    301,
+    177,
+    176,
+    147,
+    218,
+    123,
+    158,
+    144,
+    13,
+    14,
+    150,
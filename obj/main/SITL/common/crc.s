@@ -0,0 +1,635 @@
+	.file	"crc.c"
+	.section	.gnu.lto_.profile.8ecc05485c7af4ec,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.8ecc05485c7af4ec,"e",@progbits
+	.string	"(\265/\375 \272\255\003"
+	.string	"\324\005\256"
+	.string	"\n"
+	.string	"\252\300\353\376\003\002\002"
+	.string	"\002\001\001\276\261\313\300\t\002\207\327\200\224\001\024\002"
+	.string	"\002\001\002\003\250\332\217\346\017"
+	.string	"\004\242\357\350\257\n\002\002\003\002\004\005\252\253\362\324\b\006\256\344\264\310\007\003\002\004\007\365\370\256\366\013\002\002\005\002\006\b\256\306\254\254\t\365\267\335\206\001\004\002\007\002\007"
+	.string	"\t"
+	.string	"9\203A\325\260 "
+	.string	"\020C%\f\276\022"
+	.ascii	",\021\254\001\2036"
+	.text
+	.section	.gnu.lto_.ipa_sra.8ecc05485c7af4ec,"e",@progbits
+	.string	"(\265/\375 \305\305\002"
+	.string	"b\004\f\022\300%\035\377\177\373\377\377\377/\267\210\334\244\355-e\n\213\337\236\202h\237\205b\224\254\003,\216\025\250?\312\333\2462n\177M\346\314\303\231\367 \020"
+	.ascii	" \200g8\257\006\033\030\271@3\030\342\tE\202\274H\200B\341\233"
+	.ascii	"s\341Q\302\202\013\200\311 \223\r`\001"
+	.text
+	.section	.gnu.lto_.inline.8ecc05485c7af4ec,"e",@progbits
+	.string	"(\265/\375`]\001\325\007"
+	.string	"\342\313&-\200)I\007\253\206\275\006\026\264*\304h\005\215\270Q\027"
+	.string	"\200\313X\030\333\306\207%\223\034a \205J\271\215\210\366\033!\2555\262\345N\001\253\b)\332$=\263\237\213Z\321&\311\311h\223\304^\253\325M8\207\314|\370\345o\360\246w\277\006\304\310\314\200\033\007BT$\315\300\201\022\025I#\230\301\205F\250[`\031\202\fA\212\177\377\242Nd\346\300\250\320G-(\223\b\002\376"
+	.string	"\275\373\235^\373=zA\231D\n\356\263\356m0\337P\352g\275\325\273~\f\315\314d\277\356A( \220\2421\253\0332r\2406"
+	.ascii	"\n \323\227\326\376 D\214\252m-\021\274\024X|\0013\0260\355\033"
+	.ascii	"G\351\366\356\222?W\310\336x'\354\001\030\351\366l`\372\306\302"
+	.ascii	"\335a\321k DL\264\223\306\242\b\016\264\344\277\303x\t%\272\257"
+	.ascii	"\025\256(\354F\257|\271\346\231\265\2649\004"
+	.text
+	.section	.gnu.lto_.jmpfuncs.8ecc05485c7af4ec,"e",@progbits
+	.string	"(\265/\375`<"
+	.string	"\225\003"
+	.string	"\222\005\021\031\260%\351\f\303"
+	.string	"$IB\230$9\346\224\007t\0267k\333&x\023\231d#\350\177(\n\261\305\274\016gT\355\3166\230e\244j\316\261\347x[g\006\266\220\202'\001\260\201\302OH,\301\032\317\321&\004\022"
+	.ascii	"\241\0245\310\007\f3\230D\240\336\301(\353i\005\214\013Y\017"
+	.ascii	"f`Dq\002\025Z2\t\244Y\004&\255@d/\327\026\300\r"
+	.text
+	.section	.gnu.lto_.pureconst.8ecc05485c7af4ec,"e",@progbits
+	.string	"(\265/\375 \035\351"
+	.string	""
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\b"
+	.ascii	"\200\004\002\265\004\003\230\004\004\200\004\006\265\004\007"
+	.ascii	"\231\004\b\205\004\t\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.8ecc05485c7af4ec,"e",@progbits
+	.string	"(\265/\375 \226\335\002"
+	.string	"\304\003\212"
+	.string	"\b"
+	.string	"\002"
+	.string	"@"
+	.string	"\002\003\200\007\300\005\300\007"
+	.string	""
+	.string	"\001\002\003\002"
+	.string	"\274\006"
+	.string	""
+	.string	""
+	.string	"\200\210\221\370\357\b\004\002@\006\007\001\002\r"
+	.string	"\001\002\007"
+	.string	"\001\300"
+	.string	"\300\b\004"
+	.string	"\t\002"
+	.string	"\024"
+	.string	""
+	.string	"\f"
+	.ascii	"o\310\n\305\306\b\"\210\035I\260\007\262\003\235EU\264% \315"
+	.ascii	"0A\206\033h\003"
+	.text
+	.section	.gnu.lto_.lto.8ecc05485c7af4ec,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_crc16CcittTable.3.8ecc05485c7af4ec,"e",@progbits
+	.string	"(\265/\375`\236\021\365>"
+	.ascii	"\332v\004\032E\200\220\233\016PSSSSSSN\t\235\222\232\210\020"
+	.ascii	"P\203\276\276\276\276\276\276\276\276\276\276LG\261]\316Ql\227"
+	.ascii	"s\024\333\345\034\305v\t\fS.\325\366\271T\333\367\016{\313=L"
+	.ascii	"W\372\017m\301\310\2242\221\277\001\263\001d\001hN\2024\276\006"
+	.ascii	"+\360\021.\356\024\256i\031n\245\035\372\016\"\242\342\r\267"
+	.ascii	"\255feTl\2552\343b\353\020v\374\220x|\024\035\337\242\037\313"
+	.ascii	";\020\037\224\220c\222\210\033uD\271G\242\241\203\333\022fM\332"
+	.ascii	"\224'\3117\024\036\220\224\216 \025\266\346\nr\216e\244\252e"
+	.ascii	"\210\306\305y\3702g\006#\222\025#\204#\323\\\234\221S\243\271"
+	.ascii	"M5\036Xl\230\1777qV\034\220\250\034 \030\035\256\301\03581\236"
+	.ascii	";\273\036\251\324\347\210\350\347\244\004\310N/(Z\0252B\0322"
+	.ascii	"I!\252s+\202.\215B\360\034\r\360@\242\223Kz:\225\210\200\226"
+	.ascii	"\230$\204\251z\326\264g\350\324+5O\275D\005E]\213\322S\224R\311"
+	.ascii	"\231R\302\242\232^\253\362\374\254\016\264\\\225`\342\226\331"
+	.ascii	"1n\263\230\025\324b\224\230-F\202B:u%]\362\224~*K\353\022\327"
+	.ascii	"\323\223\371R\327\3743q^\217\236L\\P\226\270(\237\210\324k\250"
+	.ascii	"+\005r\272\240\215\332w\254~\375x\311$~I\241Y\305\266\256\202"
+	.ascii	":`3\205aSdbcWc\2036\3342\013\023\310m\031\263P`\334\2321\013"
+	.ascii	"6\305\355\031\2632hl_Z\013/\265\260\2475c\240\013\233\241R\233"
+	.ascii	"\331\212\233\025\336\233\333L\341\016\215\342\316N\344\256\350"
+	.ascii	"\346\372\006JG(TG6bG\005w\3074L\274B\237<c\331\207^\f\266=\t"
+	.ascii	"I>\265\235>E-?\235\264?\327B\004\\\273\t\\\264\022\334)\033\354"
+	.ascii	"-BB\264\231BD)C\234\260C\306\002DL{Id6\321I\321\302\027/2\013"
+	.ascii	"\200o\r>n\001\3605\262\321\310\240%7\346\312\334\231Ksk\256\315"
+	.ascii	"\275\27187\347\352\334\235\313s{\256\317\375\271@7\350\n\335"
+	.ascii	"\241Kt\213Z\\\243{t\221n\322U\272K\227\3516]\247\373t\241n\324"
+	.ascii	"\225bq\247V\344\300\201\354 9\3360\366p\313\254\222[f\337\336"
+	.ascii	"\003\344\366\004\001H6\0030;\307\355\221d\200O\021\001e\264\200"
+	.ascii	"\333\235\201\017\224\003?I\b\226\324\004o{\n:4-x\026\006\314"
+	.ascii	"\3765`\326\352 (\212\r\201y\0207\b\201)\026A\250J\202\b\315\004"
+	.ascii	"\271C\nM\263\nCY\026Fp.\314-bp\252ex\272i\240[n\020\300\303\001"
+	.ascii	"\204G\007\250\234\207:\347\207\022\240\266(\004D\324.\204\235"
+	.ascii	"T\204\t\321\b\243\022\022R\275\022wU\023'H'\216R\270e\366\312"
+	.ascii	"-\263~*H\264\2540\300\304-\263c-x*\350\202\223b^0\013\005C\357"
+	.ascii	",\006\325P\206R\315\214V\241\242\261\267V\243\252hc)\347\206"
+	.ascii	"\257`![\270\222MqJfE\226\314\016q)@2Q\2645\231=:\231\375y\276"
+	.ascii	"tA\237\362\242W\025\251\377-u\271<\247NuT\253I\265\375\216\274"
+	.ascii	"\242\002\277b\300\254\314Nq{eV\006\214E_\230\003/1\300\2471#"
+	.ascii	"\230\013\331Tb\331\f\232\331\340\326\231\217\351\240I\025\246"
+	.ascii	"\311\220\251\t^\255\265\230\r[\231P[\341\210[\r\334\033\263L"
+	.ascii	"n\341\230%\363\341\226\331\017\271\bls0\222tgJu\207+v7xw~5\305"
+	.ascii	"33\3123<\321\263\241\333k+(_\342L_\232\224_V\330\037\263\200"
+	.ascii	"\334\0022\373\302-\263\001>\344D^\344F~\344H\236\344J\276\344"
+	.ascii	"L\336\344N\376\344P\036\345R>\345T^\345V~\345X\236\345Z\276\345"
+	.ascii	"HO\272\322\227\316\345Lo\272\323\237\016\365\250K\275\313\247"
+	.ascii	"N\365\252{\371\227[\375\352`\036\346b>\346d^\346f~\346h\236\346"
+	.ascii	"j\276\346l\336\346n\376\346p\036\347r>\347t^\347v~\347x\236\347"
+	.ascii	"z\276\347|\336\347~\376\347\200\036\350\202>\350\204^\350\206"
+	.ascii	"~\350\210\236\350\212\276\370\035\357\361\307\377x\220\017y\221"
+	.ascii	"\037y\222/y\223?y\224Oy\225_y\226oy\227\177y\230\217y\231\237"
+	.ascii	"y\232\257y\233\277y\234\317y\235\337y\236\357y\237\377y\240\017"
+	.ascii	"z\241\037z\242/z\243?z\244Oz\245_z\246oz\247\177z\250\217z\251"
+	.ascii	"\237z\252\257z\253\277z\254\317z\255\337z\344'_\371\313\347z"
+	.ascii	"\3467\337\371\317\207~\364\245\337\365\323\247~\365\275\376\353"
+	.ascii	"\255\177}\260\017{\261\037{\262/{\263?{\264O{\265_{\266o{\267"
+	.ascii	"\177{\270\217{\271\237{\272\257{\273\277{\274\317{\275\337{\276"
+	.ascii	"\357{\277\377{\300\017|\301\037|\302/|\303?|\304O|\305_\274\035"
+	.ascii	"\327\343\036\357\307\005\271!W\344\216\\\222[rM\356\311E\271"
+	.ascii	")W\345\256\\\226\333r]\356\313\205\tF\276b,\316b-\336b$'Y\311"
+	.ascii	"K\346b&7\331\311O\206r\224\245\334\305S\246r\225\275\370\213"
+	.ascii	"\255|e0\016c1\036c2.c3>c4Nc5^c6nc7~c8\216c9\236c:\256c;\276c"
+	.ascii	"<\316c=\336c>\356c?\376c@\016dA\036dB.dC>dDNdE^\354\216\366\350"
+	.ascii	"c\1774H\207\264H\2174I\227\264I\2374J\247\264J\2574K\267\264"
+	.ascii	"K\2774L\307\264L\3174M\327\264M\3374N\347\264N\3574O\367\264"
+	.ascii	"O\3774P\007\265P\0175Q\027\265Q\0375R'\265R/5S7\265S?5TG\265"
+	.string	"TO5UW\265U_5Vg\265Vo5\262\223\255\354es5\263\233\355\354gC;\332\322\356\352iS\273\332^\375\325\326\2766X\207\265X\2175Y\227\265Y\2375Z\247\265Z\2575[\267\265[\2775\\\307\265\\\3175]\327\265]\3375^\347\265^\3575_\367\265_\3775`\007\266`\0176a\027\266a\0376b'\266b/z\207{\370\321?\034\304C\\\304G\234\304K\334\304O\034\305S\\\305W\234\305[\334\305_\034\306c\\\306g\234\306k\334\306o\034\307s\\\307w\234\307{\334\307\177\034\310\203\\(\201\374\250!t\232\r{\006AGB\3224\007\021@L?\246\351l\374\276\352\247V\276F\242\364\2410\370T\243\243\254\006D\022\210\376\306\f\004$\203G%\352\273O\257JW&\001\021\001#\fD\210\2101L,A\021\001#\fD\270\261\341\t\227I\"\355O\370\243\362_p\340"
+	.string	"\022\234;\205Vn'\3025\243\321\203\356\f\2452A\214Q\222\345E\362\022*\341zaH\360\031\347\")\231\0025\361\005\364\324[\222\244\245C\341a]*\001\201\252\342\334@A\"\301\002\237\262\036\035a29\025?\252A\321\374\355|\226T*\346"
+	.ascii	"#\260\034\031\"\251E3(G\262\371\206\224t\031EF\005\017\260\322"
+	.ascii	"b\240r\222\020r\372\363\r\356\027\2247\203m\324\306\221\023\342"
+	.ascii	"\330\377\370\225\302\032X\\\253X*\222\215fq|\317\002\204@\255"
+	.ascii	"\226\203M$\013\315F\251\033\361\\E\024.O\302L\342\030AG\343H"
+	.ascii	"\342\306\r\324N\210\323\265\177\260=DJ\346\302\257\234\227\302"
+	.ascii	"*\226\213d\003-\241\333(\025\313V\210\373~\220\006\264\310^\321"
+	.ascii	"\222\026\301+2iq=~\342-\0238\004\235]-\032b\252C\201\257&\003"
+	.string	"\036\304N\007\221\350\"8\342i\333Q\234H"
+	.ascii	"\275\356\364\376\016\325\271\250\001"
+	.text
+	.section	.gnu.lto_crc8DvbS2Table.4.8ecc05485c7af4ec,"e",@progbits
+	.string	"(\265/\375`\023"
+	.string	"\231\b"
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\003\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\002\002\177"
+	.string	"\200\002"
+	.ascii	"\325\177\252\376+\201T)\374V\203\327\002\250}R\207-\370\254y"
+	.ascii	"\323\006{\256\004\321\205P\372/\244q\333\016Z\217%\360\215X\362"
+	.ascii	"'s\246\f\331\366#\211\\\b\335w\242\337\n\240u!\364^\213\235H"
+	.ascii	"\3427c\266\034\311\264a\313\036J\2375\340\317\032\260e1\344N"
+	.ascii	"\233\3463\231L\030\315g\2629\354F\223\307\022\270m\020\305o\272"
+	.ascii	"\356;\221Dk\276\024\301\225@\352?B\227=\350\274i\303\026\357"
+	.ascii	":\220E\021\304n\273\306\023\271l8\355G\222\275h\302\027C\226"
+	.ascii	"<\351\224A\353>j\277\025\300K\2364\341\265`\312\037b\267\035"
+	.ascii	"\310\234I\3436\031\314f\263\3472\230M0\345O\232\316\033\261d"
+	.ascii	"r\247\r\330\214Y\363&[\216$\361\245p\332\017 \365_\212\336\013"
+	.ascii	"\241t\t\334v\243\367\"\210]\326\003\251|(\375W\202\377*\200U"
+	.ascii	"\001\324~\253\204Q\373.z\257\005\320\255x\322\007S\206,\371"
+	.text
+	.section	.gnu.lto_crc16_ccitt.7.8ecc05485c7af4ec,"e",@progbits
+	.string	"(\265/\375`"
+	.string	"\001\225\f"
+	.string	"\206\331V@ q\232\016X@"
+	.string	"\032B\037`#\013\352"
+	.string	"\232\377;\264*\340\202\f\372k0\261{"
+	.string	"\007&j\245u\224\374\235a\202s\256I\b\001H\202)YB\361\037B\bsPg\244\215\264\275\267\224)\005E"
+	.string	"B"
+	.string	"A"
+	.ascii	"(\230\341\256\007\0250v\271\005F\020\035\332\366Q<\305\306Xr"
+	.string	"#4DO\007\216\007\307.G\0058\201x\230\037\020\017U\304\261'\346?\345\357\304\244\306Fb\341\t=\330]\347F\262\341\326\333>`;c\377C/-e\372\222\351\350\245\241L\307\243\374\357\334\257\231\316L\037\200tbF\002\031\273\031:\226]\201\237\022\376\212wD\256bUyq\262\273\223\210=\035\336\336\330\223\315\240\301\346\234\001\353n\211\r\005\231\017\337\016\375\220x(i\306\344\223\351\365\242\221\006\207\203\226\235!\215\356\371SH\341\215\221\226\350\216\021S\243\276\363\367)\351FX\264\354\3744U\257\347\264d\331\331\234\226\032\302\376[\005a\2774\346\245\247\036\257\256J]uTWE}X\032\215UQ\037\021<4Tu\201P\035\005lM\200pQ\025,\353\242&.\273\215\321\247\374\0306\023+\231j\236TR\214\200\034Q'uvl\twaE\273\027\034\370,\336\202\302;\211C\203\204\304\024"
+	.ascii	"2\003\302\260L\213\253GhL\f\270%\244\266\224\005^\321,g\300\001"
+	.ascii	"Q\256a\301mq\320\020/h\320L\210\352\363R0\002\250\200\301\317"
+	.ascii	"<\246v\222\001"
+	.text
+	.section	.gnu.lto_crc16_ccitt_update.8.8ecc05485c7af4ec,"e",@progbits
+	.string	"(\265/\375`Q\007\005%"
+	.string	"\nG\270\016B\220\336\311p\034\004MN\013\210\036\363\311\305}\244\003\272"
+	.string	"\005\027c4?\025\361\360C\261\251\351\354\363\3450N\226h\377\252\0043\"\021@h\375\271Dc\303\275\344\230\251\030\224S\273\311&d\357$S\n\336"
+	.string	"\275"
+	.string	"\334"
+	.ascii	"[\302\324\260\244%[\230\251\030\255\325)\nO\351\331t12\216\243"
+	.ascii	"\016\212V\307 \330^\325Q|V\035)*\2761\214g\3242\363!\304\t\212"
+	.ascii	"\n\217[_:/\027cm\343\33032X\013\241\301&6\273\262\223\025\037"
+	.ascii	"\317\250\225\343E\204\320 \202\357\331\272g%W^R5\356\031G\035"
+	.ascii	"j\214za3]"
+	.string	"\306+8\2168\320\322\306\261\207T\242\320\240\2218\311Uy\331\353\361\2053\273\301e\006g\034{;\036\007\341\f\246\177p\006\317\203\227_\317\315\365;\317a\016\247\373\236\274\232\211\354M\027X\013\207a[\231\023\207\3200.\244a\335\227s\001\003\210\303|\325\370\230\334\332\324|\346\364\002\313\312o\210\f\337g.\032S\323\005&\303\231\203\032\307\261\331\005\026\303\025\335\266G\333\2476\007\"Y\371\035\255\231z\270\265\365:Z1\313A\314n\020\263P\231\325\220!\263Ob\326)\263\030\304l\223\230\275 f\2312k!\263\025\304,\205\314N\020\263KbV\202\230U\312l\204\314\356\304lRf\221\304\354\221\2305\022\263E\231\205\220\331\007b\226(\263\016\304l\0031\313@\314.\310\254\202\314&@\220\331\003b\326@\001\227\331\004\f\305\035\262\023{\200\227\330BA\226\342\002\375\270\314\365\311lOfy\302\254"
+	.ascii	"]v'\263\0012\013 \314\352dV\314\254.\314\206\231\315e\026\027"
+	.ascii	"f\301\314~\231}\230\315\\\326\035\3049`\212\236\214#\214\267"
+	.ascii	"8\343\027P-\210\241\330R|\005\313Z\006\002\374\300}\345\350\001"
+	.ascii	"t\016\300\314u\252\030\275\350G\367\232\203\033\255\265\274\037"
+	.ascii	".C\246\350\301u\207@\364\007K'\022\357\340^[\272"
+	.string	"\030^'&C\262'\022\256\364\245[\r\351\022\324Z\236\230\303\200Q\332\035\367\bI\3375=)w\244[\255\3519\3608/\006\3573\203aco^6.\234\351M>r\270fL\370\2057\323Z\336\227\271D\205\343\250\305Tk\361\026\251\317?\fvJ\004\316]\"p\006\231~\344C\255\302\177\013\307\215\341\232A\341\025\234\305>\247p\320\315\326\234\320\265\202\373>\341N\363\247&\366\266\025\307\347\337\235\377-\307X>\220\b\177\324*\356\260\2617^6\260\362-\377\204\315\005\330\277\343B\037z\216\331\"\222\225o\035p\237\305\030\033\327\034\254|k{\001'\034\202j\352\3047\"\205\b\252\251\022\270\250\024Q!>)+\251W*I\312JjGUe\302D\225\324\216\212D\224\211\235\224\025\212]\222P\253NLY\355RTUY\355tzX\376r?\317\220\341;]r\276`=+<\263\356\013[\031\256"
+	.string	"\320\203\320p\034\336O\347\363\237\241\007\235\005\2233Z\351\226Sr\320\013\264\221y\331p\250s\270\3210|\003Z\313\033\275\246\r\352\351<\327\340\364\247\237;\365\034\303\215\366\363\036\001\347\361 \340\236AV\006\367\035\265\356:\3526V\272\b\261\"\226B\007\272\227\317\034\306a\023{\203\367K\002\367\271\327\335-\270\235\273\b\223.Z\351V\240\017}\347Ie\253HV\276\371\033\307q\374\230\030\350\b>\26715[D\030|\301\033\334W\016\234\301\225\226w\304i\320,Hp"
+	.string	"W`\340\t\216\036\200\207\2501D\242\211c\246D&(H\2224k"
+	.ascii	"\003\221!\232<\020@\205\246\246h8\027\250R5)\b\350X\225\364["
+	.ascii	"t\255:\f\230\037\247\213b\376\316)\223\306?\324\326\227\263["
+	.ascii	"7u\213;d\035\255d\273e\242\261Xn!S9\36552q_\f\212B\214P\r\264"
+	.ascii	"\350\312Y\353\267\374Y\203Oqj\236\241\266\276\234\265~\313\237"
+	.ascii	"5xv\333\375~\020\321\036]\031\006\346\2076\320\356\341\337\022"
+	.ascii	"\270E;\020\266w\275N\260\220\321\374>\210\235g\353L&\222\037"
+	.ascii	"\251\340YXTT\306,\253\307DnS\027I\356_\370\257Y\177\005\376>"
+	.ascii	"\344\b\032\020P\305/\334T\203t\254\342\3459G\237\351\205\256"
+	.ascii	"\271 )\256\036\314\357pE\334\205\353C\267\271o\275l\021!\177"
+	.ascii	"\027\235[%n\005*'!\247\321slu\371\236\f\323\277\326\235w\324"
+	.text
+	.section	.gnu.lto_crc16_ccitt_sbuf_append.9.8ecc05485c7af4ec,"e",@progbits
+	.string	"(\265/\375`\311"
+	.string	"}\013"
+	.string	"V\327P> Q\233\016\247\300\033\264\362\002^\f1\346\202\274-b\tM\\\2620D\020\345\241B\240\210\210\220!\020\235a\304\276\371\277\006$@\3002\2128@\346\230Mmf{!\362,\353M\244L)>"
+	.string	"@"
+	.string	"<"
+	.string	"#\030^`\227\263\242d7.p\202w\347\370\003\321\335\273\201\350\316\230=\343Q\304~S\021\262\325\330]JC\034{b\376\267K\232H\366\004\360`w\235\232\b\207[o\033\201\355\006\366%\004\357#\177\024\245!\227V(\235\231\3764yx\241\300\305\356\206\217\215\3658\026$\336\371\355\177\363\344\243x\n\354\035\013oK\236\206\017\022\032\273\261rg\006\357\216@f\274 \243\362\264o\342'\260\007\372\264r;3!\257IJ\001\321\314\251\252\332\"\344FG~\374\364\232:\201\001R\302#?\2262R\273\252\220\327\256\016H:x2hf\307,\025\204}hw\327\312\261\337\271\245\307?\320\202zY\227k\343\256M\0045\264@\013R\034\225FSA\212#s\321P\320\332P\226\211+\n\030\213\272\252\312\242\246\270\207V9\206\360\301\323\241\036\036\220\220BL^3\345C3K\ni\200\0211\004\244\006\020"
+	.ascii	"3\241\325(\306\362\303\213B\bHQ#\f\327\034\202\271\034\316\034"
+	.ascii	"\3321\3411\240\r4\001x\003\224\025p-/\204I\006"
+	.text
+	.section	.gnu.lto_crc8_dvb_s2.10.8ecc05485c7af4ec,"e",@progbits
+	.string	"(\265/\375`\205"
+	.string	"\345\t"
+	.string	"\266\323D:0\305*\035\210\343\202<(\327\215.$\310\023\211\307l\220\316\326+\337\360\342\365\325]\003\032X!\300\226!\326{$\202\206\202\022\316\344\230\300\262\036\204\036Dh\210\354-wJ\0013"
+	.string	"3"
+	.string	"2"
+	.string	"\273\341\305\026\312\247m\027\030\200\f>D\225\264\223k\324\212\355\206\234V\034|\004\375\257.90\\$S\303\343\004aw\035I\246\210[o[\3006\201}K\362\251?^\365\177\262m\220\\BvK\263"
+	.string	"\013\233\257\f\333\367=\316\372<\264\262"
+	.string	"\304vw\373\330\333\347m\220\275\331\252J\311@\214O\201\326\335\211\016\221\277\3704\307\243\235\364\351{\264OM+\026/\251S?\222\205\342\314Q\257R\317\272\224\241FF\022\2428\263CQ\324\223}\271Ja\313h-FO\031\035\231w_\247\3560\335\327q\033O\243\361:n\243\220\321p\335\307\3410\001\366\026\022>\256\343y\037\267\205\241\333\232~\365C<h\300B*r\347 \036e\327\341\300\377x\213A\006\017"
+	.ascii	"2\003\3020y\004\270\305\004\t\b\3045q\214&v\320\240\225\020*"
+	.ascii	"\250\006\256\200\271>\003O\317\203\246v>\001"
+	.text
+	.section	.gnu.lto_crc8_dvb_s2_update.11.8ecc05485c7af4ec,"e",@progbits
+	.string	"(\265/\375`)\005=\035"
+	.string	"\2066\272I\220VN:3\3018\217\215F\372\356\261\207I\264r\325#\302\271y\016\351\033H\310\322\207\251\336\300a\020\030\367n7\371\347\207\225\205\353\236I\202\021\021"
+	.string	"\214(<\352\004$\253\202\367S\226\333\345E\277f\311&\204\020\271S\n\245"
+	.string	"\232"
+	.string	"\247"
+	.string	"!J\236Q\030Y\255>\004\027\375\200^\244q\252\241\327\340\020\332j\321\211\017\013\350E\232p\247\375\030\2271t\237\307\236R\353S\022\004\276\263\214\027\351U\306\213\236\363S:o\255&\260\264j\365%\260\001z\261\201\203!\353\356\213R\032\241\274\220l<\251\325w[\024\272\031\372n\322\341\352N\311\261\fw\352|\234\024W\322\222\207S\247\243I\322Z\214\370HG\274\fI#\245\336\201\204 \021\342\312\310\200\377}\362\226v3l\301\364\375\357\007z:\222\226\230>I\t\265V\317\244%\0217\355\266\243lG\260E\\Qed\336'\233N\337\314i\002t\332\246\206N\323\314\351\001tz\206N\313\314i\001t:\206N\303\314\351"
+	.string	"t\372\305\205N\267\314i\026:\275\242\362\251?\345U\267\3555~"
+	.ascii	"\367\375(\265_\335\264\362S7\245\323d9=\322i\221N\207tz\351\364"
+	.ascii	"$\247_\240\346\344G\202\261Z\225\202fUL\004J\275\352\277\372"
+	.ascii	"V\027\320\211\223VW\326l\342t\034\307\262k\006\372\r\357\022"
+	.ascii	"3\030\265\326\032\220]\273(\332C\276\325\177\256]\t\205\325\311"
+	.ascii	"V\213l\200\261\200P%\364z\024\265\326p\306i\353\022\226\365t"
+	.ascii	"\034\271\330m\331\025~\304\310J\313\262\300\254\270-\373-\"+"
+	.ascii	"\216\001m\n\027\022\004\346e\003\310l\270/{\340\217\031\026\321"
+	.ascii	"\262'<\fL&f\005\320\354n\314^\313\353\273\377]l\352\205\361J"
+	.ascii	"<\313\226\360\036E8\277\353<r\302\253\270\350\013:\343\223t\306"
+	.ascii	"\2134+\223\0028\263\003\366t\347"
+	.string	"\316\354\263\036\236Eq!5\355\276#\203\006\252\302\027\032/\316}S\217\213W\202h\006\347Zq\031-\255\277(k\3339\344\310\305n\006\r`\277\035V\004\221\316\210f\320\366\355\346B\331\307\005>\267\300\223\343\023b\b\272\300\223\263a\304\t\302\261\020\346~r\353\234\202\334O\356\306\323\263\263\323\223\273\361\350\340\354\334r?@7\005/\356\361\311\371\271\005\365\364\374\334j>\242\207d\27155\213\302k\"F\264;\372{)\366u6\252\320\266\026\006b\274Y\207%\335\322\266\265\355@\205\244h\226\221\f^[\025\262^P\007\343J\222\334\330,\201r\311\265\331ca \367LRV\343B\371\345>\371L\276L\254\313\236\205\017%\023ei\313\373\357\324\354\013lW\326\341LY\272\274\275\275\306q\377\202\n\254h\226\231\266\266\035w\3468z\261\233\301\2075e\250AX\302\bS\246D&\220@\204&i1"
+	.string	"\003\221)N\007\020@\205\310T\nm\027P]s\013\002\b*\\%\321xY\n\2607/O\277_\356\007\227\225x\352o\253=\347TI\r\"\n\"\261O\262\376\315-)\267Xmp\217\224>}\251EjB\373\236s\224Z\244&\324V\3579F\t-`"
+	.ascii	"J26?\351\221\250\006\207:\224\225'\364\226\244\321f\306L]0\025"
+	.ascii	"D\177\272f8\212E\004\260\236X\001\304\243|?\316y\364\364\231"
+	.ascii	"\336\200\353\312$\333\352\211\375\312\001\254d\225\"\244\316"
+	.ascii	"v\213\305\210\375z0$\034\004j$\210\303\365\340\324\327\3622Q"
+	.ascii	"\246\357W\235\340\325"
+	.text
+	.section	.gnu.lto_crc8_dvb_s2_sbuf_append.12.8ecc05485c7af4ec,"e",@progbits
+	.string	"(\265/\375`\317"
+	.string	"\275\013"
+	.string	"v\227Q> q\223\016\233\f\336"
+	.string	"\302\013$&Qx\213v3Y@\336'\006\002\340p+\013D}DP\214\200%Q\231@\324\375\b\005p\t\320"
+	.string	"}\036\331\221*\342\026Gb\252\315oB6\2212\245>"
+	.string	"?"
+	.string	">"
+	.ascii	"\235\217"
+	.string	"\013\330\345\244P\261\033\021\370\300\273s<\201\350\356}@tg\314~\361\330a\3779\031\371\310\330]\250\034\216=1\377%\007\240\221dO\311\301\356:5\222\315\255\267m\300\366\002\373\024\002~\217\277\364\316\037Ei\310\245\025Jg\246O\261lX\300\030\273\0316\032k\342V|\270\347\267\377\022W\254\200\001v\317\205\267 \244\023-6\030\273\021s\347\004/\243\207\013\314\323\376\210\223\300\036\251*)\346\366\004*\257=\275\210h\346TUE1RC\322k\252t\"\022\"\304\325Kx\274\335m\340\177,\013\317\303Gtw\r\260\331ft@r\263c\226\272\301>\264\273k\345\330\367<\2235\351em\\\032wi \250\247\314dM\260\243\242\250j\202\035\0226(8Y\032\230)\340\252\002\207\005\257\252\262`%\356\241U\216\037h0\001\321\020[\022\322Hm\216\by\315\027\f\232\371)\244\024\021&*\001\022"
+	.ascii	"2\241m\034X\270\360,j\234V\3411\215\355[\\)\023\202\341\232h"
+	.ascii	"\207#\3406\230\320\004P\004\215\001\024\001\312\n\270\226\027"
+	.ascii	"\302$\003"
+	.text
+	.section	.gnu.lto_crc8_xor_update.13.8ecc05485c7af4ec,"e",@progbits
+	.string	"(\265/\375`\306\001\005\021"
+	.string	"\306 sF\360\320&\035\372\305c\bd\bZD\226#\365\324\247&K2\354\261\275c\220\033\233\021^\245\356\221\205\205)\032M\n\\\317\314\332^:\035?,>\026\207\241Nh\\\2204#bD\366\204O\rXB\310\336R\246\024^"
+	.string	"a"
+	.string	"["
+	.string	"\316|\316\312\272+#k\261\373!\260\001\356q\001\003\225W\377l`\264\032WKE\216\335\257\323\232U\302\357\206\271z\204\232+\237\004\203\341\362Jy\204\033\013\214\210\217\027\013$\r\005\371\\\366t\275X\tI\304\\/\373\001X\314\345\025\363\334 \354\256\323\345\305\341\326n\273d\373\201\235 \001\206\317\271uK\247\226>\200\017\234\030\244\031\27303\035\373\023}F\234\347\357y\332*?v\231G='p=\200\354JL\303\215\003\236\223o\313\006\221\253\365\022\264\373\205<\272\001Lq\035\325w0@\220]\001\221!\001\367X"
+	.string	"j\332?q\024\252\177\256\361"
+	.ascii	"\2733@!\337\007h\217\334\005h\217\001+9t\270\273\013\025\034"
+	.ascii	"\252\207\242`1\325\324\221\236F\253\003\353+.\234\270\020\376"
+	.ascii	"\211\366\230\032\001\306\302\365A%g\2511\027,/\3655\352\246)"
+	.ascii	"\243\245\004+g\326\364\212\202\203\243\265C%g\366\227\222Jc\237"
+	.ascii	"d3\024d\235\261=F\242\347\374\334y\356\355;\277\366\357\217\357"
+	.ascii	"y\250\223\230JPp\202\211\004SI\005m\304d\204\004z)O\355\211x"
+	.ascii	")\2573\235J\245\223\327\231(\214\224:/e\241\023!\340\023\252"
+	.ascii	"$\325\231\234N\251n\364\355u\306\206PU$\322\217\027\023?*\312"
+	.ascii	"\212J\343\377\b\275\250\207\376\306\306\213\214\n\325u\331\271"
+	.ascii	"\033B2:R\303\344T\325e\333\233BE\321\001\n\" `\002!\265\316\001"
+	.ascii	"\226\300\304C\237\265c\263)\324\312\362v\024\320'fZ\264\026Z"
+	.ascii	"\2033\267\274\273\232Z\301= \324\236#\255X\2348!\300\340\003"
+	.ascii	"\tt#\260\303\2572\372\262N\303:\302Z\324\355\263\335\330c\310"
+	.ascii	"\232\t\224m\371\371rG\240O"
+	.text
+	.section	.gnu.lto_crc8_xor_sbuf_append.14.8ecc05485c7af4ec,"e",@progbits
+	.string	"(\265/\375`"
+	.string	"\002\345\021"
+	.string	"\026\242vG\360\320&\035\272\243b`Z\304~<\253\020\256\003\267\335D\370\344\226\030L*\374E89\2424\231=3\fF\250\214V`;\235\322\324Q\303\262\211\314\315\254L\241\240\320\003\275<q\034\266\353\347\334'\226\354-wJ\001a"
+	.string	"`"
+	.string	"d"
+	.string	"+\323\343\263\033&0\202\355\323\341\007h\237\333\005h\237F\3310\036\326\354c\033V0\032\273\333)\r*\312\360\226\021\365)5\242|\330\017\274f\260\\-\237r\244\202\271\361p\251$I\321\320\317e\217-W*J\0201\327\313\376\361\002b\271b\036G\rv\327\221\345\302pk\267]\262\315\300\216\016\002\367\366\234\1774\037\273\345yn\325\242\343\214>"
+	.ascii	"\217\240\025%\263]\230\231\215\025\232?\036\036\373u~\236\253"
+	.ascii	"}\373%|\231\271\330\211\305\242C\311\366\371\357\034f\316\nF"
+	.ascii	"P\347Y\331\366\303(FS3\242C\341\373r\201\243\265\3420\264\033"
+	.ascii	"\202|Z\304\216\341\311\005\310\243\375\021'\201z\016\313\003"
+	.ascii	"l\332\332Tj\f\261\023T!\026]\356\356J\221K\355\320\343\274\200"
+	.ascii	"^D\244\342\314\252WN\377b\225!\365\023\023V6\377\244}^/\273\364"
+	.ascii	"y\251hip\2113\325\030\220\312\245:\343\357=\247mw\027\370&J\022"
+	.ascii	"\n\264\260a\321\271\203\242F\216K\234\331aK\324\031\373$5ECV"
+	.ascii	"\031\273\203{\370s\\'\240\251\244\036\350\351I\n\212\232@\023"
+	.ascii	"\223\3124\251\234\250\275\020\017\364\272\224\217D\372\274.\005"
+	.ascii	"\202\t\251\363@\225.\204\200\277\022\n\330\231\276\017\354\270"
+	.ascii	"p/\245\352|\220B\310ES\346b\324\221\332\021H\361,\033Pi\213\247"
+	.ascii	"\306\217W\214\325\215\2513\346^6D7\221C\245\266\210p\224\323"
+	.ascii	"\303\276\311 \262\020\375\025M\003) \220\202\231\301\333\001"
+	.ascii	"z`\217a\310\276\310'\317\013\036\023\206\212MZ\267\313fT\203"
+	.ascii	"Co\314\261^\217\\\236\021\203\001\360\022\262\260q\245d|\365"
+	.ascii	"j`\023nme\2650\303\334\321\004\351La\200\302O\230d\330\003\024"
+	.ascii	"\004\301Y\315+\315\r J\275\307\2235f\200\312\203\374R\356\\\353"
+	.ascii	"\t"
+	.text
+	.section	.gnu.lto_.symbol_nodes.8ecc05485c7af4ec,"e",@progbits
+	.string	"(\265/\375`e"
+	.string	"\375\004"
+	.string	"\242\307\033$\2407\035\330\257\037\356\254\371[\357\215\277'\377\321\377cm\255\262f\377\377\377\337M\304\266\233\320R#R\312\024^\036R\325e\265F\3615\246\350\026\246\370\034Ut\251\272xT\023\237\020\217pwmE\344p\t\r\207\n\007\020\336\006\177\004\211\022\270\223\323\233\244\252\313\222\316\244\332\330\330H\025\333\351\366a\337\20680\331\335\205\316\32262\002\022"
+	.ascii	"`h0\264\313\320\255A\242f\030\240\036>@\250\277\264f\004\303"
+	.ascii	"eO'q\202G;\3609\240n\n\256\333I\347\255h\342\321\2512"
+	.text
+	.section	.gnu.lto_.refs.8ecc05485c7af4ec,"e",@progbits
+	.string	"(\265/\375 =\351\001"
+	.string	"9"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\001\007"
+	.string	"\005\002"
+	.string	"\001\n"
+	.string	""
+	.string	"\001\024"
+	.string	""
+	.string	"\001\036"
+	.string	""
+	.string	"\001("
+	.string	""
+	.string	"\0017"
+	.string	"\001\004"
+	.string	"\005\003"
+	.string	"\005\006"
+	.string	"\005\006"
+	.string	""
+	.string	"\005\n"
+	.string	""
+	.string	"\005\016"
+	.string	""
+	.string	"\005\022"
+	.string	""
+	.string	"\005\033"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.8ecc05485c7af4ec,"e",@progbits
+	.string	"(\265/\375`\235\r\335B"
+	.string	":pp\030F`^N:\303\203zO\343\352\371\304\254s\206\017\332\225\225\023\354\024\207\353\310\214\357"
+	.string	"\306l\243\344\355n\025\235!\315\322\373\301#\306\216/\244orKC\226\fI\324\356\023\317\021M\364\212\205\335\003TSb\267L\0016\001r\001\201\001k\276+3\274\265\233\362\026\346\302\316$\356\362&\f\367\025\317\3322!\245R\214\275\351%\250\347\244\037G9I\013g\371]\341xS\336\364\234\345\347\226\257\360\223\331ndw\023"
+	.string	"\316]\341Yo\312g\214\306N%N;ca\265\373\030\333n\273[\340\025\323\363D\273i\021\017\370\335\006\352\377\346\211\316\032\303\257zV\372\371\242QV\372-h\036\360K\233\217~\\%x\266r\364[f\265\r\024\272\272\"\303\273)G\371\310\354g*\\\246\344[\261\330V\353n\215T$\233\226\262\233\276\345\001?\225\217~\027\372o\204#\245\237\031\\\370\231\310\302\1774]\016\374o\203 \220\350\277\n\270\211\203w\350\347\002\022\376\347q\204\237\223 (]_\227\233\b\240W\364\363\034~\360\337\301\317K\377G\244\371Y\275G\377\351\374\347\237\335\374\334\340\347\004?\033\370y\300\317G?\033\375\f\374\031\350\347\337\317\374_\357\377\335\377\272\377j\376\263\375\227\372/\367_\355?\202\377b\376\303\375w\373\037\346\277\227\377k\377\263\374/\373\177\340\277\231\377A\321h4\372\337\023?\213\375"
+	.ascii	"\214\001C\bt\023\254\327\326\213\231\262}\273mn\244\0273\306"
+	.ascii	"\332\262\313\265e\213E\215d\213\335-\263hU3\026ymz1\327&\313"
+	.ascii	"4jd\027\273i\034\242\"Y\346z\206e\026\255M#sEz1\215x\030\t\013"
+	.ascii	"b\345u&\204\325\254\310\316\221\3342.\213\240k\313\266\\7\253"
+	.ascii	"U\365\222A\367\026\273\2243\376`/Gh\216\343\026#\313mw\027H\036"
+	.ascii	"\277\330FBW'l\267\223c\213N^(\266\320>\302\320\"\330VcUu\033"
+	.ascii	"Hv\027\271\241\335]\354\356\237\345V\333\255U\264\216%\223\335"
+	.ascii	"YH\311\336*~\251\352\276jo\2740\327\346\027\033\374\222\326\034"
+	.ascii	"\353\033m\221\307Z\316k\2516\213W\032\253\273\371N\035c\356\240"
+	.ascii	"sS\216c6\354\\\3426g7,w d\333M\2406w\\j7]0C=/\375\200\274\264"
+	.ascii	"\006nHI\223\263\343M\325 q\01686=7\275\224z~c'C\271\314\331\f"
+	.ascii	"\2379R\333\275\245\273\317eh\330\215\250h\324\rf6\326\335\336"
+	.ascii	"\302\037\2042\031v\363\265d\335`]\300\342Z\332\217\274\356\026"
+	.ascii	"\t\002\204\364\2106w\346\227~\203\312EO\352/\214q\363i\226\301"
+	.ascii	"{sk\273k\320`\035\305\204I\243@\267\244\205\371\031\f\263q\333"
+	.ascii	"\2114\316\223%V=\264g\312\236\275\233\026u\177I\002\266>\222"
+	.ascii	"`^\002D\344\364\350\201\245\013\030\204M[\036\231\035;\2562@"
+	.ascii	"\021\034\254fD[\237\227y\231z\206\314\250t5\331\305qq\\e\330"
+	.ascii	"\031\337\216\270\256\275\034\277\312\241'\3138\263\233\336$\204"
+	.ascii	"\2611\266\233^\254\333uW\347]\257U\200\345\0074!k@?\350\262\300"
+	.ascii	"(\357\361\036o\325\r[\263S\211\240\245a\261\361[\305m\352\231"
+	.ascii	" _\336\334\364\"\271\315).)\346\036\367\276w\213\234\245\301"
+	.ascii	"\371\3641\003\267\322\335\376-^\216/\272\343N\317M9\017G\347"
+	.ascii	"\330)\317\350\236\2401\255;=j~|\034\361\270\335T\017\227\341"
+	.ascii	"\322\221\304\212\233\357\254\254\216\0258u\352\260^\323\330O"
+	.ascii	"\232S\210]ge-\005-\365\274\326\274\263\036\020\331\036\227\325"
+	.ascii	"M\371\016?}\232B\312\340\271)\333y\035\021)e\n\317\375\336\224"
+	.ascii	"y\360\214Q\317S\230\3478y\016\337\001\255\351\033\031\273^\362"
+	.ascii	"\210@'\325\001\004\016L\333\006y\351z\362PS\317o\030\316\231"
+	.ascii	"\316\311t\\\247\266\255\3749\265pT\311\353\254\255%.rY\311\311"
+	.ascii	"9\327\375M\030\370)\324]\326\335\bXyuG\316M9\016?\211\270\310"
+	.ascii	"\330\346n\372:I\377\201\206\340t\211Ks\323\363\227\372\373\377"
+	.ascii	"\332\270\354n\035>m/\217B?\366\341!\3661\203\377i\373>@\256\273"
+	.ascii	"\207\021<\265\311\2321\310M\377/h)\335E\243n{"
+	.string	"\2716\275\212\253\023\216i\324vTQD\021CTQD\021DOACb\210\037\247 \211(\242\213a\t!\001\303\251\032\300&\021)ht j\222\001\225\202\206\n\250'\341PHE\205\202@\024\021\205\n\252\031P\001\242^\244@1\202\003\360HD\242\013\241\020\312)(\034\n\203.t1\214\222\212b\241\376\202\323\004\247\247\032?\177\312P!C\205\337\2372\004\203\031\234\202\352\235\202>\"T\223\005\342[PX1#\005\f\024QC\242\214\004\237\242\212\0322\021\247\246\206LA*\244\242|2\240V\314H!\3437$R\371\210PO?D(\247 Q\312\305\f\365\301 \207\005$@xP\205\024\204C!\223\324\024\f\030SB&)\027(`0\t\2072\230(\020xr\277\354p1q\242L\305\240zXM\254\242\210q\333\273\351\222%\227\354\262\254\2265Q\273\261_2!N\271\344M/\023n\003"
+	.ascii	"\247\316\f\230.\365\277J\256\226/G\224\272\0337\211^[s\255\275"
+	.ascii	"b\267K\311\023\212w\221\334\021\345}\345\301r\323\033v\303\256"
+	.ascii	"\021\240\"\321\221\216\307\322\177\213\374\032\021\200\004\214"
+	.ascii	"\310SJ\017%\313\336/.j\217tY\354\230\216\327\024+\257\337/\261"
+	.ascii	"\2670\0357\275C8j\243I\036\266\355\313\016\335\332M\357;nm\335"
+	.ascii	".$\265\313\234\274\261"
+	.string	"\003B\023\267\305\214\353\267\213\335~\316\360\344\212#\330\274I\263\247\336\037?\256\026\237%\320RUEJw\326R\020\230\226\246\035 \277Z>K\364\270@oz\2638\n\004e.M\353\231Zi\222\025\201$\250\261(h\2344\"2\"\"\222\202$I\007Q\005\204 F-\264\003\021@)\244Jh&)H\3323\222\200J\275\211X\r]\375\313h\362\030<f\311<\254s\006\356\016\2162\211\002\363\233!f!\351\201A>L\373\274D\rX<\326\306\362\225\300\315\376\314!\006\177<\376\2105\213\fQ\006\030\016,\347\200\301\314\357M\210\262\234\004YH\003Oa8\323\202\201\3453=\271\224\035w\021\364\373\313-\355\233^\314%W\226{\231\250\b\224\376\025G\366\215\221P\372d\374,(\315L\234Ya\243(a \252&\2722\"\027\225\251\206\234\210R\332\232\372\345!\036\021G^7\374\377,\313y\236"
+	.string	"X\261\346\202\317\2702\020\037=\027\314\264\013\335(9\303\372\220\030/\334\306\316P\227\223\332\305\254l:\r\370(\253\0031\257g\253;\2049W\302gN\206\272#\215\361C\250!g\3022\325X~\222\221o\030\336^\301\347\353d`\271\243\314\251\025\300\250\233\271\243\r\f\b\277&\333\004\007\003\257\274\367\236\006=\361]-_\0259\311\n\326\337\245o\350)'w'\206\312g\r\305\233\322 9Q\312\304\274\353,\244\346\272\211\276q\250o\340\2734@\266>\342\317\367V\303$\026\020ri\025iFc\370y\362/9H\001\233\201\214\022xu\351\370\366\224\235\315RV\032\377\220\r\212\354\336\n\265\304\206\367h]\345\204\215\271#S\312Rn\206\201\n\323\207\372q*\225\246\322/2=\3332\301\by\007~"
+	.ascii	".\267\306\216"
+	.ascii	"-\220\303\204\331(J\376\2760\246\247\266iFp\270\344NT\025\273"
+	.ascii	"\006;\323\330\3437^\202\261\b\345e\2007NF$\032h9\323\317\bl\214"
+	.ascii	"x\223\316x\230\213a9\271-\373c\362a\221\353\331\310A~\037s\237"
+	.ascii	"\027\315uC\rcQ\036\263\227`\370\377\364\370\337\367\301\372\254"
+	.ascii	"m\t\260\303\336g\007\313\033\031\3765o\305\366\346\375\273\331"
+	.ascii	"\004.y\324\362>\374t\262`\341\363P\330%\354\333\321\037Il\260"
+	.ascii	"\342\337\326-q\275uen\302W\215O\227\261|9\252"
+	.text
+	.section	.gnu.lto_.symtab.8ecc05485c7af4ec,"e",@progbits
+	.string	"crc16_ccitt"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357"
+	.string	""
+	.string	""
+	.string	"crc16_ccitt_update"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371"
+	.string	""
+	.string	""
+	.string	"crc16_ccitt_sbuf_append"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.string	"crc8_dvb_s2"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\001"
+	.string	""
+	.string	"crc8_dvb_s2_update"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\001"
+	.string	""
+	.string	"crc8_dvb_s2_sbuf_append"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\001"
+	.string	""
+	.string	"crc8_xor_update"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\001"
+	.string	""
+	.string	"crc8_xor_sbuf_append"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\001"
+	.string	""
+	.string	"sbufWriteU16"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\001"
+	.string	""
+	.string	"sbufPtr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\001"
+	.string	""
+	.string	"sbufWriteU8"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.8ecc05485c7af4ec,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
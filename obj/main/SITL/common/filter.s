@@ -0,0 +1,1276 @@
+	.file	"filter.c"
+	.section	.gnu.lto_.profile.15a317f63c2f6f08,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.15a317f63c2f6f08,"e",@progbits
+	.string	"(\265/\375`H\002\275\n"
+	.string	"\344\016<\003"
+	.string	"\036"
+	.string	"\207\350\254\365\t\036\002"
+	.string	"\001"
+	.string	"\001\312\345\217\372\013\026"
+	.string	"\002\203\255\266\373\b"
+	.string	"\003\232\372\246\216\007"
+	.string	"\004\356\361\330\337\f"
+	.string	"\005\321\307\201\370\r\004\002"
+	.string	"\002\002\006\353\220\276\200\006\007\263\311\277\326\001\006\b\211\337\230\303\003\t\217\364\362\333\n\020\n\225\326\304\223\t"
+	.string	"\013\206\223\232\231\013\022\002"
+	.string	"\002\004\f\311\276\204\302\004"
+	.string	"\r\245\233\254\343\013\020\016\344\247\274\230\005\017\302\265\230\372\n\032\020\243\352\335\360\007\021\346\270\370\237\007\005\002"
+	.string	"\002\005\022\345\325\337\232\t\005\023\260\263\225\257\002\n"
+	.string	"\024\267\340\331\235\n\006\006\006\006\006\006\002\006\025\350\377\217\312\005*\026\270\330\252\273\006\b\027\030\031\367\251\230\271\001\032\350\213\375\301\t"
+	.string	"\033\034\267\320\322\347\001\n\002\007\002\b\t\002\b\002"
+	.string	"\002\b\002\n\002\b\035\332\256\355\220\007\034\b\n\002\007\002\b"
+	.ascii	". \220\202\242\262\251\003\376\021\002\370*7) \200\302\f\230"
+	.ascii	"\005\350\003\220_\330mjQ\356H{\",\230\fW*b\335\250\004Y\f*\256"
+	.ascii	"\314\312B>$\243\256\335\264\211\337^\320@\034\211\302'((|\366"
+	.ascii	"\2242\r\210\033\225\261\250\340\212x\024X\371\263\375\256-4\n"
+	.ascii	"\b\343]\311o=\f\230\214\177X\213^\250!"
+	.text
+	.section	.gnu.lto_.ipa_sra.15a317f63c2f6f08,"e",@progbits
+	.string	"(\265/\375`\226\001\235\006"
+	.string	"\342\206\025\034pM\322\001\364\224\377\377\377\377\377\377Eq\222$I\f\371!~\322H\333Dn\231\002G(,!\217\364\2521\242\22798o0\026\247H\360oA\034\f,\254\022\330\001\377\360KA\372W\023\036\253Nc\344\363\277@\r\220X\246\210\313\365\020\275\3323r\311V\t9 \300\202!*\362[\331r\271\004\2543\b\272\320\026\342\252\253\342\230\321\222{\005\303:\211\017\323\263\217\250\211@W\007\302\341z5\225a<VdX\022\260!`\2027s7\024\341m,~\301J\004R\006\346\016G\201\b\020+\003\016\020\231y\361)\323\333bn"
+	.ascii	"P\213\312\t\023\314\007\351\220\001\202\233\3056\230\214\264"
+	.ascii	"\320\005\355}\272H\035,\r\"cl\205\2651Pp\021\206"
+	.text
+	.section	.gnu.lto_.inline.15a317f63c2f6f08,"e",@progbits
+	.string	"(\265/\375` \n\345\034"
+	.string	"vbj@ \253&\351\300\020\"Wv\b\313J@l\301\025xH`\366r\301\b\227\036\002p\214\366\020\t\340\250\273\255\365\270\020"
+	.string	"\253\001\201\203\t\270\236T\321.\335\252Kui\355Q\355_\311\267O\366&)O"
+	.string	"S"
+	.string	"Z"
+	.string	"\027J\234\311\374\b[\226\312\367\026\266\204\031\303\371B\226\266n\367\205Y[t\r\333xb\350\342ZR\377\240\255\351I\330\2669^\351\322\232:O\202\036\332\036 \311\224\266\0377\0341\324\320\232.\236$/\264M\200\237\f\260\244m\201\017\360\306\023\357,\314\336oT]Y\255\227\252EB[X2i\253\361\260M \266\277a\024\007\0338\n\344\315s\211\321\030\330\362<rWc5.\3009\223\362\375\266L\3518\264\325\374(Q6!yeIk\312X\"\333\312\314\036h\022z~ot\273\361\205>\363\f\030\242\255\305\027\026\377\0306\253\240N\334\211\204-t\240`@(\004\332\302\215[\263P{'\206q%\340\345\323\252m\307\314\013\325v\304\216\355%km\r\tA"
+	.string	"\302\331\302\216\261\"k6\356P\204B\325\250\225\260\232\261,YC\301\262\342\211\366/:a\376\016u\342\210N-\003\377\177\306\352\275\r-\026>t:\250\244\210\350\220\350\234\023TRD\200\356h\242\023\t\263N\303p\245\355\304 "
+	.ascii	"xe\306\261\350\224\316\224\371+]8o|4.\315c\2712b\362\234\261"
+	.ascii	"bB\001\003\306I\204\021\025\b`\t\204\026\020\037\036\030%\314"
+	.ascii	"p\363\245d\241\300\326>\036\236?\033"
+	.string	"\301\fm9\334\"\355\034\t\200\354\250!I\006\325\214\244I\251\315p\002\031\241\261\233\007\022@31\007\364,3#\"\022\310\210H\222\362H\241\320f\317\033\214\246[\200\317\037\212\022\037\317\204\262\001\216\364\211wc\330\346\377\250\227\376)|,\217w\224ab\317\347\235a&\237\321\335\225\340\227\314\276\356n8Y\001\357\001\001AZS$6%\202\025}5m-\223O\264\033D2\251\303'\232\231\033\375\r\245n\033\303\266\310\321p\036\331\"9U\003[k\t\247\177iQ(Tk\223\300\032\365\256\344\026{K%\251\243-}\216\255\351LG$1\323M!\204\312\221D\224\203vE\370\3222y\266~\317\345\243 \372\316V\036\266\355\3624|=\347\336\006\2333\231\224\333\317\\\313K\221=H\003\320\301\213ri\222|\037\375\2562l3\207\016\2661\254\3370^x?\263\027\342\330\337;\024\021R\030U\260"
+	.ascii	"a \341\020\214\244\"\246\034\345\315\323\374]\217\303\260dd\341"
+	.ascii	"\334B\036\t\332D\313\342\315Hz`\311w\212x\2546\005\277\352\366"
+	.ascii	"\354q\321LN\317\244\257\375y\205K\3455\336\206O\302\206v>\317"
+	.ascii	"\350\227b\202\232\357\366\023\245k\033.T\346\341\231\204\365"
+	.ascii	"\023jS\222j\003^\213\177\177\r>1\203\353oj\240t-Q\267\022![\260"
+	.ascii	"\205\360\203\302}\202\t\204\365\327\241Q\004\251\256\017*m\215"
+	.ascii	"\344Q\333$I\002\320\370'\243\245Q\231#\246\001\362\364\225U\330"
+	.ascii	"Ll|?\032\017o\232a\251\346\243\024@(\303G^\247\212\272\250\006"
+	.ascii	"\341\260qE\342\2170\3723`3\216L\214\210\252._\333\350=Xw\207"
+	.ascii	"\257\245\251\306\320\026i\301>\344K\355r\244\226\337\272\"\376"
+	.ascii	"\340.\247X+\276\337\310\265\003\314d*m\256\004\327\206\303\370"
+	.ascii	"]\302\255\211\210\252\377C\240a\272\2749\006"
+	.text
+	.section	.gnu.lto_.jmpfuncs.15a317f63c2f6f08,"e",@progbits
+	.string	"(\265/\375`\314\003\225\013"
+	.string	"\362O/+\2009\351 \036\220\245|t\375\007\236\333\030\230\253\251W\002\314HL\301\350`\305\361\300?\360\213\177kk-Y\202\244m\"wJ)\\\376\263\300\332\206emSE\237\371\217_QH\350\357\b\265F 5\232\022CQjU?\265\007\006\223\002\202Z\264\025\255\304I\257E\265\026\345\362\301\017ID\253\006(\020\260|'\002ad'z\312\343~\351\027\335\201p\220uP\276\250\004\206\"\343B\336\345\202i0Yk\255\225\376\365G\336\227a/S\226?\310\341.\367\334I\344\310q~\243\325Y\020@\362+m\323\323P\313\267\263\374u4#&[\247\345C\314\250\265K\277>kM\006^&L\250\001Q\005\221Q\220\202\302\3122\006`\002!Cuv\022"
+	.ascii	"\005A\001c\201\201A(\300x&P~\031y\356\362K\256\212\263\023S\340"
+	.ascii	"p \203\333B\372\nxT\301\251\rZ8\220\346=?\025F\371\270=l\202"
+	.ascii	"l\376\360\b\217\321\036\347\342\342K\3742\234\324F\314<\231!"
+	.ascii	"\324|\341\361\252\005\327b}{p.\035\031\326Q\235=\317\374\240"
+	.ascii	"\366J\271\304\306F\375\224\343\204J\340\276\241\016z\036\270"
+	.ascii	"\341\236\235&h\325#\317\371i\250b7\277\365OL\372\372\217\257"
+	.ascii	"\245\344F\211(F\322.\372\262\226\300\342\203\215'u0\177\235\231"
+	.ascii	"\tI\271\213\345\346\001"
+	.text
+	.section	.gnu.lto_.pureconst.15a317f63c2f6f08,"e",@progbits
+	.string	"(\265/\375 _e\002"
+	.string	"\362\005\022\032\220\2730\006\272C\335\035\316\314\314\372\361\276\357\373\276\357\373iiiS\022!2\036q\210\367\360\034\336\360\030\336\302\025\236p\204\037\334\340\005'\370\300\005\036\360"
+	.string	">i\222G\016\371\343\2167\232\032\243-\256xI\252j\022"
+	.text
+	.section	.gnu.lto_.ipa_modref.15a317f63c2f6f08,"e",@progbits
+	.string	"(\265/\375`\305\003u\r"
+	.string	"\026\32030`E\223t\024\302\260\206$\313\307![\211\2548\203\201\037\206\007\202$A\320\004\301J\250\200\203\315j@\265\277\333\354#-\320:\232n\244\021\271S "
+	.string	"'"
+	.string	"("
+	.string	"\231\351\274\333\271\334Q\274T\245\333\242S\r\277\222\351\365J>\336\350\210/\332\177\255.\331\371f\"\251`d\310\260!Kl\320R\004\013\001\034k;\025i\340\333 \265\370l2\025\370\367{\217\342\3519\363\207\006\234\231\001\021\022\377\020\017\"S\022\244\230\211\212\022kC7\246j@\237^\216\316\305y\374c\221\343\0275>2\300\206o\265A\214\02578@0\250\2565#\r\301E#\273\2530A\013Z~\036d\221\272\233\213\321f\210$\241\030\007"
+	.string	"\343\230\243\024\241\241\310\260k\250pR\321L\222\f\007\200\002\0212\243n\022\300C=\307\202D,\"u\241\202\326\243\315\257\004<\033\2178dO>\004F\367\212\234#\373IE\235=\307\037\376\275K\t+\252f\310feK\177a\252\265d\334\265\247Z\252\265u\202\237\271\244\006\021\303\022\371\344\304\200\244\250f\200\b\325\275\275"
+	.ascii	"\315\257\255%G\003\205x\035\350\224\224\025\337\331e\266\223"
+	.ascii	"\332\037\234\340\0379\"{\025\345l\314\376\241~y\035\\1\037\333"
+	.ascii	"{$\235\372\211\372aF\347\360\315E\002\001\345\334\226\202'\026"
+	.ascii	"\274J\254r9\203=\300'\310\344\307\0350'\335cC\024r\027\316p\352"
+	.ascii	"\230\316%\351H]\341\003\203\2301b\207\370\0308\001\232|\004\001"
+	.ascii	"\035\226\312\204\256\202\223\002\254-\006\327c\320\305\215Cr"
+	.ascii	"\226\037"
+	.text
+	.section	.gnu.lto_.lto.15a317f63c2f6f08,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_biquadFilterBankApplyDF1Inline.4.15a317f63c2f6f08,"e",@progbits
+	.string	"(\265/\375`W\005%\036"
+	.string	"\366\265\272I\260\326M:4G\266a\225\245gG\204/lB\025y\305z:\034\271\027J\034\252\302,R\217\307\375\3231n\2172\245H\366\030\177\220\342\341\302\312\317\316\317n\237x\237u\b8\021\373B;\035i\205o\324\244\221M\344N)\242"
+	.string	"\221"
+	.string	"\254"
+	.string	"H0r\360\220T&H#\025"
+	.ascii	"\224\232bL \017\304\227\362\354\324\217z\220\242\007}\2044RA"
+	.ascii	"N\005_X\251\265285\004\362\224\200\370\231\355\t\264\325\r\334"
+	.ascii	"\247}\036\357Qt\037'n\265z\024\225\242H\255\300\006^@\236\032"
+	.ascii	"x\333xJ\336f<u\221]\345@\247:Cj\201\"\250\245\326\212[\032\336"
+	.ascii	"\213\300[\234E\247\342\316\"?\306\363\343\005lL%-\031\235\212"
+	.ascii	"\265Z+m\tI|0\225\226zS\324\301\364\275\324\027\374\262\222\226"
+	.ascii	"\230>c<\265V\317\244\245\025\367x\333;\333\027l\312\024a\236"
+	.ascii	"{\333\335\373v\210\367\222\361;\367\276\247\336\f\263m\277\037"
+	.ascii	"r\272\342'\005\305\027\336\f\333\255\265\032\3556\331@\243\371"
+	.ascii	"\2723l\235S\3359\367\361\013x\325\215s\340\177{\360\266\321\351"
+	.ascii	"\033:mC\247k\3504\r\235\256\321\351\031:M\243\3232t:\206N\317"
+	.ascii	"\3504\f\235\226\321i\222N\307\350\364H\247)\235\026\347\364\212"
+	.ascii	"\323S\234~\001\030+N\024`\325\232\"\254K\325\242B\034\247\372"
+	.ascii	"\253\376\340\327\276\375)_\310\207xVe\202\300Q\255*\0055K\241"
+	.ascii	"\2662K\263\357\362\345\230Y\332\326v\301|O\275-\227;N=\207\202"
+	.ascii	"`fw~B\236\023\227\001\206>\327\262\321\226~\225P1+[\231\025\340"
+	.ascii	"e\2660\033\263\003\202M\\\036\354\303\231x\315\366`?!o\211\313"
+	.ascii	"o\r\177\256\244\t\314~\213\\\272\262\035\273|2b;.\2717\260$."
+	.ascii	"\177\025\342X\267\212\355\257~B\336\021\227\026\206@\277\252"
+	.ascii	"0\034\327\302\024\234\025\227.\355\362=\365\354\f\027\272L \301"
+	.ascii	"\326\335\310\b\262\326\032\241\b\206\241\003N'F\331\023\253-"
+	.ascii	"B\337\252\204K\003\303\033\276\255\306S\234\235]J.x3D$\204\202"
+	.ascii	"~(\221\b\022C>\273q\350\247DN\314\021\345:\210!\202r\034D\203"
+	.ascii	"p\260\363!\022\361\343\001\027\244\003\002\322\365\340\202~r"
+	.ascii	"@\270\236\335\020\316A\216uB>;\034\221N\267\303\315\200\365\257"
+	.ascii	";\343\307\311\252+Z\274\355\321m\262\214kuv\271&\203\333V\251"
+	.ascii	"\301m\373,Q\\G\223\313\305Zk\025\275s\333\352\354\245Na\374\262"
+	.ascii	"|2z\024\b\026\024\213\234,`H\240f\260|e%}\341X\361\342]ma\301"
+	.ascii	"\353ry3\244B\023\2521\225\364u\2634\233\263\032~^6[\2637{\013"
+	.ascii	"\372\236z\\.O\304i\303\247L9\331\354\211HqI!\367(\021\002j\250"
+	.ascii	"a8\346\024TB3\263()HZ\003\300\002\021\"*n\021@\245U\230h\241"
+	.ascii	"\263o\"\306ZN\306\223\314\376\274\214\334\3511\017{\217+\fP\351"
+	.ascii	"\242v|m\213\253\224FN\215\355\"\322\272\326\2227\tR\352\2366"
+	.ascii	"Ap\321\244\017\332\260\364w\035 {\264\240A\217\361VzHb\021\265"
+	.ascii	"K\f\306\300(6\013\300gI+\366\203\204\3317\255Tw\205\302\366\377"
+	.ascii	"\026[\224c\t#F\333(\036\017\3317h\254\037*\276w\364\273l\330"
+	.ascii	"\3077\026\273\f\205\272l\336\201\267\252\030cx\331%\242\202\334"
+	.ascii	"p\224+\220\323\214|\310r\322$\234y-\341\267\262\304\270\030\007"
+	.ascii	"\201w0\246!i(S\245^\223/\300\016\337\006H\265\332t\232\bz\262"
+	.ascii	"\322{\314\317\324\035N\374\001"
+	.text
+	.section	.gnu.lto_biquadFilterBankApplyInline.5.15a317f63c2f6f08,"e",@progbits
+	.string	"(\265/\375`y\004\265\032"
+	.string	"\206\360\247H\240\230Q:\300;\007\307\242aT\024\337\370z\236\362^Mj\360\202x\037\362OOe\314X\313\210\251\201\r\273\311\251\276\332V\022J\370\343!\257\005\353\360\216\346p\362\335\3379\342O\366Q\323\300\337\270\361I#\233H\231R\215"
+	.string	"\204"
+	.string	"\231"
+	.string	"\260K\237\351At\007zj\334\241\030\205"
+	.string	"{X\231s\352\\\372\301xY <\314\266\376\034E\203v\265\337\343>t_\"q#\233DL&\212\314\371c`\005\343\245\177\017 ^\216\237\211\227\326\331T\376\2331aE<J"
+	.ascii	"\263\3149i+\303\373\360w\207\252\273\fWu\276\213\347\307\r\324"
+	.ascii	"\2402\362\355.C\331\2343\346+\n\035h\3177\244!\016\025\3377]"
+	.ascii	"A\322\225\221O\305\325\3053\347\264\032\371R\334\342m\343lW\260"
+	.ascii	"C\035\001IUJt\021\322\255\3359\347n\027\311\376\355\364sc\330"
+	.ascii	"9w\272q\276\364\337\374\351\266\371\357\2579\360\236I5\215T\317"
+	.ascii	"H\265L\252e\244:&\3251R\r#\3250\251~\221\352\227T\217R\355\222"
+	.ascii	"jQ\252\245T\207\252\336P\255\241\372\003`+\236\350P\315yb\213"
+	.ascii	"\313\254\222R6\356\364?\375\300\257}\373B\374!\2072\354iD\001"
+	.ascii	"\"\331\354\025\371\270\3013:\215\030w(jzHK\023\306\003\361\233"
+	.ascii	"\034GN\034<\022\254\ro\362#0{$/;.lE\"\274"
+	.string	"\0338\373\332\227\275\231\342)1qp\307\366%\021^\273\343\332q%\021%\016\"\350\360$\004\\\373\202A\245E\\\2718\253Z\274\243)\007)`\375\374\310\016\226\270\024\246\330l\270r\245\026Oi\310\276p)\007\023H\260o7\002b\234sB(b!\b\301\f\022\342\013\n\325\016)?J\204\203\007\260j\370\216\022/mV\265z.\204t\313\2725\273{^\216\360f\"~u\317S\032\322-\317\366{\250\313\024\001\271\020\037\200l2\347!D\220\017N\f\262\211\250\205\265\\-C\330\001\250\206!4\207\0068\237\234\007\233\006\032\320\355\347\347\326C\003\262\325~h=\270 Z\003\001\276}\360\301\321r\267\033\216\006\373\315o\214\037\037\241XT\t\355\220\\$\277\2626g7Ku>\333\036\203\317\366X\230\262\210t\313\3039\347\f\275\340\263\315\3317]\276H\272\342\035\305\260$\020+--h6\313A"
+	.string	"SfVfid;s\325s)\262\330\312X\371<Jl_0\254v\304\354\023\007\001T\305\026ht\005fa\033\2638Mx\001T\2501$HB\306\0043%\023G\013\322\254\001\300\002\221\"Z7\021 \255D\214\325\004[\317r\"\360E\314\004\251oD!\241\034E\243M\223bF\250\331V\030\304\030\277\300\256\201\345\314X\233\320s\031\215}\334\226\261qB\177\271\245\257\n\246\006b\bU\013,\244\263W\030\226\032\326i\004\034\323\2313\235Js\365\030\347n\005j"
+	.ascii	"\264\355E\035\210\262\350\246\377\274\212C\201\3216kC\203\r\204"
+	.ascii	"+_\200\370\f\376\200\030^s0\266D\301\274\n\357(>w\347\253>\323"
+	.ascii	"I\211(\240\224v\355\013\345\2339\bh\365\032\364\304\202t\213"
+	.ascii	"a#z\200v:\370\007"
+	.text
+	.section	.gnu.lto_nullFilterApply.8.15a317f63c2f6f08,"e",@progbits
+	.string	"(\265/\375`)"
+	.string	"\265\007"
+	.string	"2O56Pm\222\016$\243\210\"YZ\257\315\203/%\247\264\024\231b\262\026T\230\231\335\220\311ja}\326\227\03573S$=Bb\025X\343\026\306\251mck\215\020\231\002 \211\217\207c]k2\332\006\004\301y\200\236\254\323\3114\320\303q\350@\215\026\0013\006g\237\215\006AY\246A\354?f\253|\244\337\205\342U|\f\271\227\361\255\362\221\276\245\266\017\323 He^\244V\022\3052\361\370\267\307~\347Z\372t@\346I\n*31/\324}C*\2625NT \223D\202\312\214\230\023,\265\216\226\377~\024d\373S\0259:\024J,L*\231\t/-\270jU\035\270j\275\215nu\333\355H\017L'\321(T\007\320\220\231;\321\b\243\277\376\b?\303_\n\013"
+	.string	"\322\032h41\264\n\3075|\232\305"
+	.ascii	"Y\220\225\220@\240,\203&\214\224\224\3165\311"
+	.text
+	.section	.gnu.lto_nullFilterBankApply.9.15a317f63c2f6f08,"e",@progbits
+	.string	"(\265/\375`\016"
+	.string	"\r\007"
+	.string	"B\21504`O\322\001\024B9\243P\352e\252\230\300\037\316k\302\200ueO\3036\210\023\201\262\033X\ti\223\t\303Dp\fj\343Lw\364\026\022xC\204\220\275S\nTF=D\021\027\345\020\265\332`\234L\242\003\221\027\264,X\345\325\241\254\2540\212\334\034\024Np\260\314 \3042\023\357\350o+\202\305\273h\243\307\275\216\326\321\377\367m\255\023\310\320\260\374\033/._\221P@\332:\323\326\305\232\204\322\256u\210E4\217T\230\340\337RN\376\270P\005\214\245Fk&K\030\027L\226\252\265!\003\214\001\025\215\222\226\377\371<\254\331i\265I\034\360\001y\354"
+	.string	"\032\376\327}@\034\356s\333\204\266\fm?\002\013"
+	.ascii	"2\241a/0.\234\271\306\273\302\320A\325\200{`X\200\n\035\356\360"
+	.ascii	"\242\235d"
+	.text
+	.section	.gnu.lto_pt1FilterGain.10.15a317f63c2f6f08,"e",@progbits
+	.string	"(\265/\375`\224"
+	.string	"E\n"
+	.string	"F\323E<0\305*\035\240\270=\231\357W2\300\331\036\b\032\033!r\366\261S\270*\255h\321yL\2665\206\260\215\023\257\250\200(9\240a\346\354\232\224\032\344T\363w\273\275\256\314\242M\344N)4"
+	.string	"3"
+	.string	"2"
+	.string	"\254\257\200\266H\361\241\t\t"
+	.string	"\302B`w\271\315\0170\237\333\r0\237\212r\360\022\364\377:\207\006C\245H\227\031\211\335\265D\245Fn\275m\005\333\020\366;\001$\b\264]\221\261\266\263\371\222r\327o\203\376\313\032\333.\213\333\266\\e%`\300\3562|\372!\2149\\\276e\321\004\2731\226\313\3566xa\340\323\266\037\252z\235"
+	.string	"`\247\022\251\026oR\233\315\326\021\343X\363\330-qTu5\236d&9\332!I\352\211\375mUe_z>\374\267\273Z\277\274\3643\005\001\023\025\322\"C\216:\272\213\317t\327\371<#\r\320\207\023y\241\220\327q\"\020F\210\353>\016\256\223`o\303\363q#\317\3738M\270\337VUS7%5\371\272\351\324\0278\311\266\022"
+	.string	"2\241e(p\317\213%3\374Q\201h\352\016\327\304_\213\032\325\"\333,\310D\220\005\341.`\004\344\003\303\202\n-"
+	.ascii	"*c\247\235O"
+	.text
+	.section	.gnu.lto_pt1FilterInit.11.15a317f63c2f6f08,"e",@progbits
+	.string	"(\265/\375`x"
+	.string	"\215\t"
+	.string	"VRB90\345\2521"
+	.string	"\360\276\342\211\t\200\271\330\325q\332\343L\370\020\220\037\030`<P\360\333\345\r\365M`}\030#b``\300\260%\363^I\230a\037u\222\233o\264\367\2262\2450"
+	.string	"1"
+	.string	"1"
+	.string	"\\G\037t\346<\033t\346*\2660\b\033\002"
+	.string	"8^\264\377\337\f\261h)\326NqF\265BY\006D\374\257T\255<\334\351\266\234\266\017\2557\001\033\227\277\243\026\3403ne\244\2555m\345h\024\321\256\306\232\371YZd\377;u\360\314-l\226\255Kl\"\272ur\301\317\202\311\376\261S\006\317\001\n'$\037\261\266\222\323^X\2451\357?D\375\312\300\030x\0219u\346\032Z4ZJ\326\332\021%'H\353\355\377;Y\255]\366\346\226-;\202\230\023\016A\246\221(\324\365\343\tA\246\221(\364\225@\022\t\374|%\221\004\351\373\204\025\237'\241 \005(\374L \030~\232\361\336>Y\345j\263\324\324\3506[\013\303\002\016"
+	.ascii	"2\241'\034\030.\250L}Nj\217\245\255\240\207U\353\302z\f\363\002"
+	.ascii	"\201\301\025ijJ\270\303\213v\222\001"
+	.text
+	.section	.gnu.lto_pt1FilterUpdateCutoff.12.15a317f63c2f6f08,"e",@progbits
+	.string	"(\265/\375`T"
+	.string	"\r\t"
+	.string	"\266\321?9@\345\2501\340]/\372e\032\310<\263\007\037B\344\222V\277\024Y<\023R>!\260\331\213\002\202\214c\2158\315\315\253\250Jp"
+	.string	"\306\322b\2267G\336\032\357\261\222H\231R,"
+	.string	"."
+	.string	"0"
+	.string	"\226\233\0134\313z\355\213?\221\333\245\221\361\n\360\177\306\020{\206^m\2275)\325\311P\340\341\177aJ\305\341F\267Uh\333\320\026@2\205\244\2557m\341\347\023\317\255\302\252\371W`b\3779e\330,\0232\206\255Kl\342\231e2\301\277b\211\375\037\247\013\233e?\033h\001(\205m\377\035\352\327\205\305\200\313\210I\263\2141/\001\037(8k\277\023\214 \2553\377\337\270j\335\262\243Y6\224ZG\313\201\312\2771\033pY\022\356>%Q\b\244\325\323\351>%Q\b4I\334h\304y&)\0241\232\236\216bv\020\312M|\272Y\342\270nn\276;\363\270*\204\207\f\0251\032c[\341\f"
+	.ascii	"3C+\0258\b\207Z\\|\b\313\256Q\3060/\020\030\\\221\246\246\200"
+	.ascii	"\273\274h'\031"
+	.text
+	.section	.gnu.lto_pt1FilterApply.13.15a317f63c2f6f08,"e",@progbits
+	.string	"(\265/\375`\342"
+	.string	"u\013"
+	.string	"v\026N=0O\224\016,\336\252\266\\*/\035f[\364\326d\3530\207=\313\370\346n\300n\275\\\320Z\254\033\177\213\306\030\377\323\257a`\240I\016,\231\327f\336\362\227\3324\"\204\354-eJ\001;"
+	.string	":"
+	.string	";"
+	.string	"\217\356,\333\276\210\217\320l\017v\032B\3246A\002)\306\356^\006\376\240\036\341\007P\217\232\341\332S\363_\342P\205\005\317\363\341<+\005\273\353\364|*\334z\333\007lK\354G\b\351\230i\230i\315tf\372"
+	.string	"(\020,\b|\273\024>\031\273\021Sl\260\255\331\016\333\231\037\331\263\306\356\212\027\246\335\2058\301\323\276\350$\264w\233\013\330\005\225L\273\035\304\b\254\032gp\036\266\374|\265T\265\"q\0346\315O\244B\\\370\301M\330\223\370$\f\004kw\037\332P\217\327\252C)\204\250\223\237\335qR1\330\207\273\273V\220\375\321o\275\373\253\f\031\r\346R\211\224'\221\214\222iPap]0\213\005\233\\\227\312\002\3135\311\034\\\221\002\3060\224\354\312`Xv9\272\275\035\365\301}\330\350\350\346\250(\002\2648y`t\3623\324kTx\342.\250\246\302\024"
+	.ascii	"i\231\"34\030AhB!\270qp\334\t\264\212\031\003\\\256(\232\233"
+	.ascii	"\302\322\262\304`l\b\\\023E\026N%\344\022(s\320\356\223\222b"
+	.ascii	"\272&\031"
+	.text
+	.section	.gnu.lto_slewFilterInit.14.15a317f63c2f6f08,"e",@progbits
+	.string	"(\265/\375`\330"
+	.string	"U\013"
+	.string	"\346TMC \2138\035H\261\3302\bq*l\207\244M\221\016"
+	.string	"_u\024D\356\020Y\216jh\016\304(\365#\3046\306l\b#\bFB(["
+	.string	"\t\016\233\234\272\245\306{\016K\003\223\251-\327\370\244H\233\354\235R6"
+	.string	"<"
+	.string	":"
+	.string	"KZ\254\221\275\232\274\005\366\232\275\002{\365h{8\231`/\301@\200\023kw7\212\340\343\347\350\377t-$\362|Fx\354\256gHD\340\246\267]\261\375a\237\013\244\177f\030\206\r\027\255\335\001\255\020\273\252\026\026\330>\3056\271\274&V"
+	.string	"(\3241\311G\030_rimWC\207\324\356Z\274\221\275f\\\237\366\037\034\302xR\347\024\273#Tj\003\025.8\270\250mrT\375\240\002Q\240\264=+6\347\024\\f\273\313\341O"
+	.string	"p\"\301AA\007{\255\fT\rX\237\331\262I\317\244\007\354_\273\273\246#\373\246\037{\351\277\036#\232/\023r`F\324\304\316\353B8\234&\3240c. 'j:\222m\363y\336\207\3316\235\210\267a\300p\273`\370+\341\300M\374>p\243\220\373k\351\310 \031V\037\n2F\355\360\001\024"
+	.ascii	"i\231\"\023/\307\321\342\202\njCJ\330M\275nj\217\271\255\360"
+	.ascii	"1k\215\013\303\200\031\003\230\013:\247\204`\201\300\340\212"
+	.ascii	"45\005\334\345E;\311"
+	.text
+	.section	.gnu.lto_slewFilterApply.15.15a317f63c2f6f08,"e",@progbits
+	.string	"(\265/\375`\274\002]\021"
+	.string	"\026^jF\360\260(\035\270<{-\254\306h\304\364\013\200S>\n^\213T~\013&*j\252\262J!\346\032F{?\026\353\023\307\343\243\033\345\326\211+6\221Md\357\305\307*i\374\222uP\253\334tsX\262\367\336R\312\024X"
+	.string	"O"
+	.string	"X"
+	.string	"\360\363\300\"Q P^jt7\367\321\016\251\021\352"
+	.string	"\251\221;\250I;\332\224\021\362\232\256\023\004eVf)\252\223v&H\233(+/\2446\032\330\260RQ\370\242\202\312\246:Y\006\240\222"
+	.string	"?\335\2550\335\t*\324\356\004u\3677E\265\322s\350\177\016\377A\376\235\005\372\251r\354~\356^\356>\356\036\356\236w\277\273\327"
+	.string	"\323\202\013\0024\272)\344\334\350\0261&\304\177\323\277\375\337U\227\307\336\351^!C\326\335\036O\240\373\353KM\230\364+Q\001\335,\030Y\367\347q\004\232\306\177\332\377+\t-a\372c\001\221[*:b\314\02138+\n7\206\354\301X0+C\2066)\021\250\021M\301\274\265\314\270\266\273O\314\255/+/\200\325\234\254\215\377$\212b\371\300\207?\320\023\217i\335\rr}i"
+	.string	"Ac)\221\032\225\371f\206\3632\331\234\377;-\267~\205\315,\217\272\250n\001%\022\021\222(\312\207>\274\220\222\003\021\003\216\324\215F]\210#\211\024\214\270\2207\302}\024x'\022\342q\245\256\363\270\355k\205\312,\017\177L\030%\343\341\250\301\306\325\211\361\304\033\030.MF\363\257\273\347d\017V#Yyf\200\221\274\265\320\270^2\262r\204\345\310\272\302P\223\232\021: \300\002\0311\363\351\232\"\"?\006\235\242\216s\335\034\321\325\\\0361\303\305\t\032'O\314\254\002,\252f\252e\020\3425m\316}\326!\006T\340&{ \353\312\340\3701\253\304r\007\2414\321\346\313\264c"
+	.ascii	"-\353P\236Z\253\224\222\r\270\373\332%!\033\274\023I\022M\227"
+	.ascii	"\271\375\021++'\020d\331&0Y@\236\343\355\210\302p\032,\0339\023"
+	.ascii	"\021\231\201\375(.3\272\247\267v\225\001"
+	.text
+	.section	.gnu.lto_filterGetNotchQ.16.15a317f63c2f6f08,"e",@progbits
+	.string	"(\265/\375`\210"
+	.string	"\335\t"
+	.string	"\006\023D<0\307(\0350\237\206ZZ\365\305]q\375\336\2322\343\f\301oY\304\224\002x&\245\321m4\206\340$h\312\372t\023X\003\003\335!\364\250\350u,3\270\020\202\366\017B\366\2262\2452"
+	.string	"1"
+	.string	"/"
+	.string	"6\n~ !G\200\312HQ\260\273X\346\b\326#\374\201\365\250\037\367\236\236\177\224G\216\016\025R)\364\274$v\327I*m\334z\333\r\266#\354'\004\361i\370\264>\235O\337\3020\340\t\n\354j\254\026\354\201\b@\304\266gc\354\317"
+	.string	"\304\363'\243l\331\025p\262\262\273\017v0x\264\355\227\334\304\013P\257\227\302\324\210\200j*\324K5\032\261TU!\0255j\252\025\300\322\250\327T\215HD\271\262\277P\252\207}\270j\262\237\276\376\375\326O\177 \215\333p8[w\221]@\032\267\341\264\356\243e\027g\032N\353(:\034\354\263y<[\206}:\023\036,\343,0\315\202\267\n\215\303\272m\3430\314\267\207\253\246K3\030*r\020"
+	.string	"2\2417(p\362\213\005\002\3729\n\030|\314\261\\\303\213h\001-&\0240\0072\003#\202\n8"
+	.ascii	"\225\307\324N2"
+	.text
+	.section	.gnu.lto_biquadFilterInitLPF.17.15a317f63c2f6f08,"e",@progbits
+	.string	"(\265/\375`\217"
+	.string	"-\n"
+	.string	"\246SF;@\305\2521\340\271\223\327?"
+	.string	"\367\257\353X8\267\267\f\317\352\310\237Ix\234\200OO\265\177T\210\021\246\271&\321\335\345\207\323\005\013\030\365\247\375<[R\302l\206\233\335{K\231R1"
+	.string	"6"
+	.string	"3"
+	.string	"\030s\035\215\320\231\303\370\2403W\261\035\340\321\344f\231y\300j\377\275Yb\321R\254\rs&\245:Y^\"\376W\246T \356t\333M[O\353\204\3778`\3404\256\345\244\2555m\347Kc+x\307\210\b\204\034\275\"\332\325X3?\200\232\354?\247\017\030s\f\233ek\226SD\2676l\360\257\002\310\376\221S\207\245\2561\243\240X\264w\373Q\233m\316)g\213\221!\235jC\201\331C\346\251\035Or\222\264\336\376\277s\325\372eov\331\323-[v\227\226\200\005\002\017\237\3513AQ\372\302\320\027j.\276P\202\240+\250\023~\246\nQ\310#\201\243\021\b\362H\242\317\310\003\205%\257\243P\320\342\013=\023\b\206\236f\274\267\317U=*4\324\344\350E\326\001\020"
+	.string	"*C\244e\212L\274\016\032\r.\304T\335<\256\261\001f<\240J\204\021%\304\r\304"
+	.ascii	"W\244\251)\340./\332I\006"
+	.text
+	.section	.gnu.lto_biquadFilterInit.18.15a317f63c2f6f08,"e",@progbits
+	.string	"(\265/\375`\305\be'"
+	.string	"\372D\330\016E\200\236M:St\004\242\354\032L\374R\023\325\275\025\033\005A\023\215\364\274\243\325F\204\006p3K)\306\223*\302\033D~3\330\316\276LD\201a\024p\023\302\252TVt%\370\022\320v\230\033[#\204\310\235R\334"
+	.string	"\304"
+	.string	"\335"
+	.string	"\376\275\034\314\213\027;\331\305\274\354d\216\3662\316\245\311\231:\2333\354\231\321H\372\321\031F\215\241\001DR\307\016\2130DT\214q\355\214RN\204y)\361\305\305$4\343\b\033\314\305[\225\017\003C\326\366\330\251\265Fxi'\233\354R#\216\207/\027I\241\032\274\242\322a\265\334 \205\352\017\311\220\f\224\370+T\307\342\242\201j5\233c\254\265Jp\205\333\313$\362\324\376\224S\241z\025\034\037P\253V\321X+Q\202\231n/M\374\220\371\362\366\002\346KS\331tN\334\252\317\362&\307\026=\265V\335.9\325\315\222\\J\345\323\2562`V\325M\246r)\016\3712'\275\266\352"
+	.string	"\263\204|\261~W\246P\255\025\227u\222\324\266\241\326j\n\314\372q\333n[\206m\033\366\315\030gW\364H\016\355\256\r\3411\212hmi7J`m\031S\364\300\241%\312\201\246\366\333*\273\37018:\324\2525\034\217f~\265Z)\321%\260\024\314\200\375\322\375\351uE\217\026\332\2579D\330\346\264cE\2176\261\352d\335$\366\311\272Z\366\253\374\017\0344Pb\260 I\001R\202#\243w\371\021|\314]\364\257\377\300\315n\242\237\335CO\273\t\034\313?\340Z~\241\203\335\002\376\345\016\360\260;\350\306\033\300\307\356\334\303\3348J\rD\251o\224\332F\251MJ]Rj\222R/\245\246\224\372\024r@\320 \225\325\332\343\330\247\252\225cO\016\366\177\371\303~\343?\366\207\371\307\374f\377\331\237v\234\003\\unkC\321\032`o\373\304\325\306\2666\357\177"
+	.ascii	"\254m\237\270\316\230k\263x\237\334\232\373\304Uv\236\225k\273"
+	.ascii	"8\037\027o\265\326\013\376\036*\257\027An\272p\230/\351\026`"
+	.ascii	"\320\342\266\334'\256\342y\226\346'M\244eZ;\207\t\226\t\355\364"
+	.ascii	":Z&\262SX\264F\213\241I\361\274c\005\347\024\214J\271`\227\326"
+	.ascii	"\316a\322.\221\235B\005\213\201\t\227\323\253\315)X"
+	.string	"\021\262h\035,\204\265s\250E\264\r\026\002Z\321*-\004\262S\310`\277\346\364\"Z\372#7\204\221\3439\274\232\333\364\250UQ?\273I\3748\276\034*t\343\2779\026\217a=\262\306gc:\267Z\253.\364k\230/M\201\365\252\317\360k\276\360\266U}Tb]z\211`)\227<jX\364\217\017\354nQ;\026\274(\2512\306\024\235\202\242\273\026=\030\273\222B\nZ!\005\265\220\202R\330\321\n;jaGy\275\033\"@\2347c\027\242\305\024\317\267\202\347\313\311\340\3718\340LCM\360\361f\300p\261B\027C**J\nJ\027\303\305.J\007\345\233\322M0\262T\217\347\323\315\220\222\362\351r\304z\262\256\226\235\276J\244m\372\"\027lO,l\035\354v\t\330\240\023\2242\3016A\251\262\r\226\006\330\240\223\222\362h\233\224\220I\333\023s\262JK\2036\350$\2444\332&!bB9"
+	.string	"6\350t\226M'\251`{b<\226\334w\3456\330\204\247,Z\020x\310\236\225?\313`aX\021R\334\006?\004Q\263\332+S\340m\022tG\t\252C\017\305\272m\202\346p\3216U\262Q\320\337\321\226mLM\024=@k\357\250\225\200\005\332\247\200\235\250aLf\020R\314\314\210(H\222$\255\001\320\002\021)\2536\022"
+	.string	"\0251S\032f\210\244\230\271\240$\246b\315X\024\255\313\322Q\365~\371Gr\212\330\334\351\027\223l2cX\214\365\252\034_F\225\317y \352\363\346\201\320\211\235IZ\013\207\232\372y\243\361\325y7\242\031\325\021\016\237\307\324i\314\365;t\017\231\375\006\232v\002\243\261\322\026\003\360nD\361\262 B\253\354X\345\254\234\201\267\362\0257\230\213\347[\274d\364\234c\361\300=\230k\210\211\024\272\031\301F\275 Xy%\237\261C\327\233\273\267\001\025\017K\fL\322\026\b\210\271\226#\3640\260dG\2004\264\223\357{-R\354\231\336\224,g\376\241~8\317\277\023QBII*\367\001\351?J\302v\013D\235\250l\333\241\246\213\345\241p\353|o\005\302\275c\266`dD\377\305R5b\037w\330\221\030@\323;8"
+	.ascii	"\226[\252\372@\352;p@\340\001#\024\351\r\013\352l\304\343\267"
+	.ascii	"\204\347\307\006\003\372Q\021\270\351\315\322 U@\363Y\224z\364"
+	.ascii	"+H\020l\262\004\324:\313\372\003"
+	.text
+	.section	.gnu.lto_biquadFilterUpdate.19.15a317f63c2f6f08,"e",@progbits
+	.string	"(\265/\375`\264\002\355\021"
+	.string	"F\337pI\320\224M:\244\035Sm\345h\266q\200\021\201hP\235\0160\342U\023\372M\373}\234\232\361\263\330+\255aM\343\355\030\2672NeY\216\356\241\271\347\240\333\341$\375\302d\301\t\020t\030-\003B\225Y#\226\020\"wJ\001U"
+	.string	"a"
+	.string	"V"
+	.string	"9.m\332\rB\262\355n\211U\337;\022\356\323\276\214\317\210\035\307\345\002vk\204l\273d\211\027|\357L\236\200\367\356\373"
+	.ascii	"\357\235c\266\321I\233}Q\255D\r\244\335\005\265\305c\2371\377"
+	.ascii	"?7\305\314\310>K\020v\3273f\006\305\255\267\215\3006\007[\023"
+	.ascii	"\004\367\271\271\333p\376\231B\001\02158\3325\221td\207:\034"
+	.ascii	"/\336"
+	.string	"\363\327~\237\337v\316\376m\374\306\313\377\030e+7\370\004i\250\271$\201I\255\314\b\03602\330=.?\331\211\002$\212\204\210\354.\203w\306`s<!\214&\354\270\344R+\363\302#Au`\\jaV\250x0\311\323\210=j\263<\314\307XA\214\024K\2432\333\255\013y\2527Ch\342\203\272\033\313\2018\325\033!4\273\256\303\345\267\273\016\374\034\"@\030\260q\341\342\275S\325\033 7\234\331L\262I\331T\026\366\271\335]k\215}\236\377\364\235\337t\235\377{\316_z\317\355\275vw\001\252\226y\3222U\260y\002\233\341\n\354B\205\207/\024\013\035\\\341\230\022\216(\226p\214p\362\2742\031\303\327\007V\n\250\"\266Z\342\nTa\241\264\300\325\350\002M\016X\\\tG\360%\212#\210\"\367\334j\215)\354\030\232\351\213=\375a\204\326)\321\215S\037Eh\252=\002\004\231\035\335h"
+	.ascii	"\314\223\232\364\323\222\3168 \360\002\031\261\321\003\370r\020"
+	.ascii	"\f\221\346)\363xG2\034\214\204\214\035\210*F*\030\033\260\001"
+	.ascii	"\201(\030;`\325\206TZl \206\3433\210\3041x\177!\033\177-S\346"
+	.ascii	"\320\037r:\266\234!DJ\b\345\234\315R\0069r\033\303\020I\034\311"
+	.ascii	">\361^J'\235\361j\303x\333]\256\266\232\304n\362\274xY\006,\021"
+	.ascii	"F\024q\023\203W\244\261) ./\332C\006"
+	.text
+	.section	.gnu.lto_biquadFilterUpdateLPF.20.15a317f63c2f6f08,"e",@progbits
+	.string	"(\265/\375`\007\003\005\023"
+	.string	"\206\241vH\320\3624\035@h\006eZ\226\321m\b\036\253o\030\017K\234@1O\226v\0252\210\236\214ZsX\260eNP$\3439H\321V\035\022)\207\321\277\354,P[\017\304h\260\220)n(=\337\256\211\213di\223\275S\n\\"
+	.string	"e"
+	.string	"\\"
+	.ascii	"\"z\030\314\361+\302\007\231t\310n\323\217rwKl\262\275\222d\237"
+	.ascii	"\366\177\256\"<\020\315\005\354\362<\225\273c\211\023l\257\036"
+	.ascii	"O@{\335>@{uh\347\370\330"
+	.string	"\263\217\232\3420\344cw;J\342\341g\350\177\350!9:5\237\253\006\273\353\231\243\003\342\246\267\315\262=\301\2468\001\0018\252\031\255\252]\017A\200,T\205\231\370\322\017\373\225\376\362\231}\237|\351+\035\366\2453\231KB\"\217\214\232\212\302\023\2051ga\224*.\306'z\321\217\236d\016\211\224`\324\024\301\205I\222\233\221\355\200\343t\002\202\035\363\026&\267\232\017\0056D\305\240\332]\005\257~\260\275\236\263M\205f\262\221\275\t\324/Y,\314\347\030A\212\020\273Ck\\\177\332(\365\231z}\227\261\212\271\334I\243\324\007\307\353\245_\016\303\244\201\236\335]\340\277\320\220\301/\361\352\323h\257\225\236\351,\237\0331 q\006\261G\233IG\330\317\226\362\330/\357\355J\367\352\260[\373\322]/\364g\017\372\351\201\376\031&2\363Df\232\314\314\223\231\351\301\244\240Tx\361\300\025\017\344\\<\320\001"
+	.string	"\315*-\320\203\271\300\262\322\265|.\327\247\322\265\260\244\270:\025\360\245k\035\360\207\301\003;\230\357\003;n\024?\364\315h\007\224Hm\274Q\251\036\257\025\265\021\323h\r\036\257Ji\230\024\221\252\242\216\330\216\310\364)h&\217B\374\201Zg\273\"+\243\224\316? \360\002\021\261\235\003\312C\244y\212\b\355\216\354\311"
+	.string	"\b\212\354}](6\025\354\271\230^\230\033\366\nl\264\231\245\365|=\r\362r\314\024J\342\004\243/\210\301\257e\021\316\330\341\037k\332\031\343\365\241\005\313d\201\\\303f\0219\320\230\227p\314\320\303@H\303\n\f\204\022\256H\b\333 \235K\030B\312\363\030\257H:)g\212V\253\201\030\360\366"
+	.ascii	"\035gD1nbtE\232\237\002\342\362\242\205d"
+	.text
+	.section	.gnu.lto_biquadFilterApplyDF1.21.15a317f63c2f6f08,"e",@progbits
+	.string	"(\265/\375`\374\002\375\022"
+	.string	"v\343yF\340\322h8J+ 5\226"
+	.string	"\372J@3Q\220@\344\211\334\2347h\350G\207q\3049\224U\331\333]\367\2645\313\225\003<Y+\307\t3\316a\214;c\257\203\r\024\007\225R\024>\211\207o\264M\366\336R\246\024`"
+	.string	"Y"
+	.string	"k"
+	.string	"\233\340\235\027|\231\317\361\315\244\335\037\"\236\335=\261\202\247}\333O\300.\306\034\265K\023\203gW<1\202\357\235\305\317\266_\342&`\366\215\023C\334x\026\210.\214<v\027,\360\224\367\216;\211\367NA\034\366\204\371\037\317\341\324vf32\317Q\203\335u\316f8\334z\333\006l3\260\025C\266(\223Zc\237[\245\261\257s\247\236\363\227\\\374I2\215\312\364H\246E2}\312\264)\323!\231.e\032$\323\244L\177\231\036e\332\313t\227i.\323\232\351\314\364MN4\031 \215]\rE=6\250\353\021q\235\337\206\371\243K\266u*|2\033"
+	.ascii	"\314j~\344\330\rZR\223\022\320\261\272O\210~\307\204\367\224"
+	.ascii	"\3647H\352)\210\006\360\361\351HIj2CF\213\261\316\363\351\201"
+	.ascii	"lla\353,F\372[\247\251\236vB\262\017\261,2\247\252\235\216Z\310"
+	.ascii	"h1\227\253\340\364\243\215-|y\n\325\024\033%zM\345\204d\264\230"
+	.ascii	"a\216\302\267owS\374\235\007\024\276\233\030\357\335\225\024"
+	.ascii	"\026\325la\026\005\257\025\230\027\225\313{\301\264\260\254:"
+	.ascii	"\317*(.\325ke\025\001di\261X-\025\220e\005\201\005\252\270^@"
+	.ascii	"\024\001n\265\250\\\340\253\325r\201%q\317\255\322\244\364\224"
+	.ascii	"\201DP\2501\2474h\247\326!\004\3021\033\262]\016\243\213\215"
+	.ascii	"5\017\341\013S\r\0078\267\331\020JO\232\322\034Q\021E\351\201"
+	.ascii	"Q\365\237\021M\037\tw!\2429\232\024DO:`\205lDH4 \320\"\021+z"
+	.ascii	")\235\"+\236\224\024\r^\202N0\020\315*\211C\200\201\3406\254"
+	.ascii	"\203\032L#\177q\251\301\240\353\335\205\343\202S\267f\346\021"
+	.ascii	"\003%\277\003%\020ayb\244\244w\240d\230\227\215\357\032&j*\f"
+	.ascii	"a\224D\306\341\326\031t[\030SJv\304o\210\025j\\\340\037\2029"
+	.ascii	"\261UiD\342\303Y@\241\351m\225&\020\264\274&\236\216\024\323"
+	.ascii	"\265\310"
+	.text
+	.section	.gnu.lto_biquadFilterApply.22.15a317f63c2f6f08,"e",@progbits
+	.string	"(\265/\375`b\002\315\020"
+	.string	"\266_lD \2174\034\240\026Z\212\f\226w\005t|\310t%!\242\027\321\237v\223\224d\032\302Ts\002\247\345\026Q\037+\260\231\307\032\252\242,"
+	.string	"\004\020\220\202!\256\336\310?\005\240\252\034\246\225\326\310\336{o)S\nV"
+	.string	"Q"
+	.string	"Z"
+	.string	"\273/2,\273\333a\003O\373)\377\300\272\030r\215]X\n\226]\261\303\004\272k\026;\333~\207{`\331c&b0\331F,\214\304dv\327\023p"
+	.string	"\333\265\354\241\355\232\226\234\365d\371\217=\333\300at\221\264\236\234\202\335u\272H*\334z\333\003l'\2603F*\377\306\305_#\323\240L\1772\355\311t'\323\234Lo2\255\311t\227i.\323[\246\265Lg\231\326Lg\246\317\361qY\201\300\305\356\204\231\031\013\243\265d\370\312o\263\374\2309\266W\"t-\n\034\256\222\327\213\335-p\315\007\272\314\253x\264&\232v\232\305\204\032\300\234qH7\345t;\021\236|/\261\251(SM5&<y\360\021\231r\340(C55\244I\"|\245.B\325\243\305\206^S\263\230\360\004\364\352!<v\273\353\341\203X"
+	.ascii	"\2413\t\331\256]5\340\210\222\"\2223\266\330J\275`?[\205\331"
+	.ascii	"_\271C\017\252\217U\212\204\332T+\220SI\333<\022\241H\252\217"
+	.ascii	"R\003\357\364\231L\337\310;\225\030\230\274\021*\345\211\002"
+	.ascii	"\370\003!\241<\325\367\241<\216\270\317Va!\375H0\001#\242\240"
+	.ascii	"A\372\362\321\216\202<\372)\035\205\207\243\035\007w\341(\007"
+	.ascii	"\272\240l\264\305\303\"c.\030\032\355t\243\234\212\360e:\213"
+	.ascii	"F\037\3434, \260\"\231\263z\251M\021\212\007L\242YI\320c\003"
+	.ascii	"\271\264`\320\233\321\030\3505\034d\0024\214\254\264`\024\244"
+	.ascii	"6`\004\343M\316\214E\037\206<%\004\341\341\340\240\256\354E1"
+	.ascii	"W\243P\321\033\306\234\222\035\361\333cu\024\027\326\206`O,E"
+	.ascii	"\024\221\350p\026)4\275\255B\002\201\226o\342\311\245\230\256"
+	.ascii	"N\006"
+	.text
+	.section	.gnu.lto_pt1FilterBankInit.23.15a317f63c2f6f08,"e",@progbits
+	.string	"(\265/\375`r\001\365\016"
+	.string	"\246\234cC"
+	.string	"\223\324\0308[F\260\221\364\227u\355iq\245\2447\266\242\330\371\024\255\253\320\201\367\230LT\200\"i\023\005\252\300\222\013\007v\310QU\275\252\376\254\323\324m\254\366\r\236\030\305\021\304\244D\"\245\224)\005O"
+	.string	"O"
+	.string	"O"
+	.string	"rz"
+	.string	"\307\262\247\366\207\273\230[f\342\003\214\366\177\203$\n\035;7\276\223e\204\357T\213\240\274\214\300\305c\305BY\306"
+	.string	"\377=\254\016q\301ka\251^D\341b\350\230K\\\262\025\313\305O\004\345\177\337\212%\302\345\270m\251m\203\326-\002\356xh; \324~\020\265!\257\2214N\030\346\326/\352\030\2546&*\304\224\311T"
+	.ascii	"\371obY\006\323\322#m_g\027'\317t\326\316\177\303\007\315\377"
+	.ascii	"O\267iy \372\265^a\026'\313\260X\300\337\302A\363w\237\226L\313"
+	.ascii	"v&\300q\016\362\262\341\360\2048\306*\260\341\204~q\311<\214"
+	.ascii	"P\275Z;#i\273\3012:+\020\363\377Ak\30110\314\377\016`\\\320\340"
+	.ascii	"\351Q\202\205c\351\230\023\244\310A\243\245^\r\302\377(\ba\332"
+	.ascii	"\016\365\374\377\205\255vz\306\226\226\261\243an&Q\006PT\261"
+	.ascii	"\n\t$!6tRJY\241 \232\260\221\270\321\210\013m$\021h\264\205J"
+	.ascii	"\246\355\304@\271\n)\245m\205\343J\333Hw\373\260\325\b75)\250"
+	.ascii	"\252\204\255\3113:\003\340\227Ij\350\270yI\275\232\2040\355\330"
+	.ascii	"\300\t\241\3153\261aK\333~l\030  `\2021\211\354\006c\350\227"
+	.ascii	"b\200\2105\354\300v\021\177>\233\302\223\363\361Y\226d\255\305"
+	.ascii	"\027G\336'\323\n\303wAV:^\327h\"\373\324\262\345\002lS\033u:"
+	.ascii	"\333@\023i\305\262\332E\261\2106X\355m\007|)w.\361\004"
+	.text
+	.section	.gnu.lto_pt1FilterBankUpdateCutoff.24.15a317f63c2f6f08,"e",@progbits
+	.string	"(\265/\375`R"
+	.string	"\375\b"
+	.string	"\226Q?9@\345\2501\340\353\357\357\203\2622Y\344\320\251o6\354\345K\221\305\351\332Bm\nK.\n\b2\2165\313l\244\344\362\024\327;\033\225\026\263\314\314c\366x\007\221[\312\224\002,"
+	.string	"-"
+	.string	"0"
+	.string	"\226\233\r2\226\365\332\030\177 wJK\343\025\340\377\214\037\366\f\275\332'\326\244T'C\201\207\377\205)\325\312\215n\253\320\226\241-\200RE\244\2557m\341g\023\317\256\302\252\371Y\006\304\376s:7\313\004\315\2605\211K<\267L.\370Y0\261\377\343ta\263\354\347\203L(\205m\377\033\352\027\306\305\300K\210)c\031W\\F:Pp\326~'\030=Zk\377\337\310j\355\262\243[6\224\004\253\026\207\331\2771\023pY\"\213H\236\b\255\237N\007*M\204$&\211\033\215\270\317$\205<\243\371\351*f\007\241\034\005\250\233%\216\353\346\346\273\265GV!8d\250\230\321\030[\013\007\f"
+	.ascii	"3C+\0258\b\207Z\\|\b\313\256Q\3060/\020\030\\\221\246\246\200"
+	.ascii	"\273\274h'\031"
+	.text
+	.section	.gnu.lto_pt1FilterBankApply.25.15a317f63c2f6f08,"e",@progbits
+	.string	"(\265/\375`\002\003\205\025"
+	.string	"\006\250\211I\300\020)\035\372k{\243B\361/\003\333\215I\265}9\235(\213T\177\271\304\001K\321~\265\321\351B\265\202\344\265:]\267g\004\324\377@\027_\026A"
+	.string	"A\020\004 \330 >J\303 \200y\305E_\rO\362\311\336r\247\024o"
+	.string	"q"
+	.string	"t"
+	.string	"\266\034\335\213b]\332\357\271\217\354?1\017P\353\315\322Q\255c\211E\302S\217'"
+	.string	"\236\206\037"
+	.ascii	"\236Zf?}\314\325\377v4\272\250Z+ks\274\237\343=\245\354t\256"
+	.ascii	"\224\371\252\023\240\313\017?\332\257\350&s:\001\324ZW\267\r"
+	.ascii	"s\201\355F\223\323\204\315\367\275\313$\035\357Wt\263\271T\235"
+	.ascii	"\324Z-kn\036n\360\266/\330\206`\257H\376\240\322\"\225\366\220"
+	.ascii	"\322\035\240t\bJ\253\2504x\336M\277\273\347\307\177\377\363K"
+	.ascii	"\001\373\003\221c\264\277\261r\230\272Q\233h\022\211\357~\236"
+	.ascii	"_t\236\337\263H$\373\320w\276\221\220\f\346(Lq<\270\236Z\253"
+	.ascii	"\370!\237H\205\225B\231\016\341\220\316\006\205\022\302\370B"
+	.ascii	"\026O\375\240\247\200\271.C\310\314XuPrH0FN\315 <\r\231\027\035"
+	.ascii	"\006x\265\022\264\267h\261\317\327\361\335\003O=\366\266\020"
+	.ascii	"\341\356v\354k<\363^\002U\033\356k;49e\272\252U)\321\344\230"
+	.ascii	"\311)\307\316\302>\222\\\255\325\301wf\371\nW\202Sp\337\373\310"
+	.ascii	"L\350D\322\326Zevqv~\035\311>\0042j\255\r\374#\r\026|\235\030"
+	.ascii	"\360F\227#lrO>?39e\2174\2718\366_\367\306^Qi\020*\003/+\030Z"
+	.ascii	"\323\024X\336\212\265$L\026\227V\204\351\024\023\230J\254ee\002"
+	.ascii	"\313\345\345r\275RX.+-\027+\005\366\30229\340W\005\025\030+\366"
+	.ascii	"z\301X\3428;\320\037H5IA\315\226F\027\307\035N\273\332u\222#"
+	.ascii	"\247k\263\355\222\323}\215 \247\031icN\222\323]\355E\344b\324"
+	.ascii	"p4\0053@\366\205}\005\\\270V\313TC\343c\301\005Y\212\243\206"
+	.ascii	"\023w\356\307\202L\265\035p=V\334; p\002\031\302\343\001\264"
+	.ascii	"dPfHd\314\231u\232E\200\333~\373\214\270\330\004\312\3337\300"
+	.ascii	"*\270:\260\203\3606>\r1\224Q\270\350n=\334\2271\355y\336\001"
+	.ascii	"\321\272Z\321\360\273\003A<\253\301\\\017\274y\3032\206s/\210"
+	.ascii	"A\nS\367\232\331X\255 \223v\036\220\022\307\2135\241\377`\265"
+	.ascii	"K\367O\0227v\006l\353\337\316v\224\204]\334\027P\216+\316\r`"
+	.ascii	"\224\340^t\210h\003[\321\315/\210\362\353zO"
+	.text
+	.section	.gnu.lto_biquadFilterBankUpdateAxis.26.15a317f63c2f6f08,"e",@progbits
+	.string	"(\265/\375`\320\002U\022"
+	.string	"\326\240uH\300\226M:\344\013\270\227\321]\344\3101\226\370^\315\351\214\207^\365\257\222\177\n\342\020\330\246\306^}qF\333\335,j\006\337\311\021\034\211\336\021\362B\336\267vk\320Mt\346\223\265\356+\324\016\253\2525\262mo\271S\n\\"
+	.string	"_"
+	.string	"`"
+	.ascii	"\016b\356=j\357q\221\\Y\0266Z\020\355.\213\275\356\023\201|\264"
+	.ascii	"\277\343<j\307\321|\300\256\216\023\321n\216\305\f\272O\347n"
+	.ascii	" \365\331\235@\352\3235\333\3519\034{\246\243\033\037Pv\327\323"
+	.ascii	"\033\257=\326\374\207_\335rl\217*\t\273\353x\313\201q\353m'\260"
+	.ascii	"\035\302\326\t\001~\317\017\340\270_\345B?\353A\377\352@\177"
+	.ascii	"\367\237_\245\321S\243\245F\253FG\215~\001\001FJ\021\230v_DE"
+	.ascii	"\331\244)D\307\207~\373\017\235\342\003y\220\332\207f\235\r\347"
+	.ascii	"\345\006\351i\027\247\301\247;t\237\221\206\202)\204bGF\205 "
+	.ascii	"%/\022(\305\017\027\375q(W\326\205\315\214Pz\344\303\221@\250"
+	.ascii	"\252|\232\360D#\021/\322\212P\270\253m\022'\3420@\323\356B\260"
+	.ascii	"]/\372\206\274J\2504\345\240I}\306\245\333\022\033\366\320a\267"
+	.ascii	"\273\017\256*\037&<\270\232\030eVd\351J;U\351\211\036\306\272"
+	.ascii	"\233-\233\211\277y\301\023#\033Cmv\316\026u\307\276\334\335\265"
+	.ascii	"\3528\340G\203\201\275R\237\314\n\r\027\376\321Z\030L\314>\360"
+	.ascii	"\365\201)3\037H\2015\203\251h\311\0231\255\021\322\256\026\360"
+	.ascii	"\243\301\300^^\214,\026\223\271\274\030X+\346\271\300\231\327"
+	.ascii	"r\3002\231\017\364h2\031\350\245\344\366rU\307\026\216\222j\324"
+	.ascii	"\3063\271[\303\345C\377SO\214\362L\222\341K\033\246\252|\234"
+	.ascii	"\360H$\034\256\344A\006:  \003\021\252i\003x9\314q\366T<\270"
+	.ascii	"\035n\211A\034b\233\370\322\322\016f6\027\013=\306\232\300\327"
+	.ascii	"6\360\245\245]\314l\363&m8\263\022S\003\343\211nz f\372\321\230"
+	.ascii	"\241X\274\216\021\236\322\336\314>\361`\037\211\346\242\335\323"
+	.ascii	"c\332\332f\020\3628\006e\366\372\024~\275\f52\334\227\0131\247"
+	.ascii	"\b\326\300\277\"-N\201_^\264\214\f"
+	.text
+	.section	.gnu.lto_biquadFilterBankInitLPF.27.15a317f63c2f6f08,"e",@progbits
+	.string	"(\265/\375`\215"
+	.string	"=\n"
+	.string	"\346\223G< \345*\035(!u8\037H\3244\003?ek\361\030"
+	.string	"\005E\362\t\323\330AD'\364qX0\3044\031\224\314)\254\002\302"
+	.string	"7i\002\024s\t\303\013\004<\314\276\243O\310\336;\2453"
+	.string	"7"
+	.string	"3"
+	.string	"\f\233s\016\177\320\235\333\334\240;g\320\216yx\262\237\311\200\310\002\354.\225&\007\037A\377\262sV\254\324\243\346aw\035W,\221[\336\266\3076\204}\204\263\335\220\001\002\326\306\265\244\330~\307\266\214qL\202\375 Ai\210\341Y\300\303L3g\327\345V\333\335\217\351\346\234\302|\264\357\372\n\370W\307\013v[0\265\335\360\343\321?u\246]E\345\262\255\347\256\3123\245\224Q\332\032\033\361+/\334\\;\"Sv\230\212\262\304\376\334\335\265l\331\217\375\363\260_\376\365\307n`\346\305!\036*4Qq\362\352\310\253\235\f\257F\bX\230B\024\323\"P\365P\027\244\0215}\245\322'\242&R\250DE\365DA\t\3760\274JQ\337Wi'\334\317\225-K"
+	.string	"\260\251\244\2075\001\017"
+	.ascii	"\006Sd\342u\320hp!\246\352\346q\215\r0\343\001U\"\214(!n \006"
+	.ascii	"\270\"MM\001wy\321N2"
+	.text
+	.section	.gnu.lto_biquadFilterBankInit.28.15a317f63c2f6f08,"e",@progbits
+	.string	"(\265/\375`\226\002\335\022"
+	.string	"v\243{H\300\224Q:((g\013D\323\246\312dI\261\367Y\277q\031\312\216`0\371\274B\2439\\\237j\016\355\2126\352\0236B\214\351\351a(\320\002A\241\352_\247\303F3\f/h<\262\353\237\372V\313\334\301o\311\226;\245c"
+	.string	"f"
+	.string	"e"
+	.ascii	"7^\317\231\271\200\335\233\037A\273\"\212M\274w\026o\300\364"
+	.ascii	"\316;\001\323;\277\354 \027k{\037%\023\266\334\356~\032\303\372"
+	.ascii	")\336S\276\336M\225/\377\244\362s\005\267$\331\f\366n\226\354"
+	.ascii	"njFb>"
+	.string	"\2206\263\230\2344h\327\003\335\3446\312f\264\313\223\312\356Z\312f*n\323m\207\2663\330R'\277\375\336{\376\323y~\323w\376\3569\377<\356~\200\001,\200LH\332E\261\244\264F\235\320\214\343n?\207\017\204\363\220\007K\341\371\374\234\020\262\273'\357|\301{w\224\355y\013Q\204B\217\307Y\26261\334\212\362\310\314\222\255\201Q\223 \305\353\274\276\343\321$\273DG\202v\027\305\237\367.\301\274\264o\343\001\340}\020m8\017\024\315\226\313]\350C\036\013\034\255\276#u\2446\331\020\032\271d\217\266\345\002\333#\256\303#\203\332\356F\260]\036\304\362v\027\302\b\242\205\240&c\306\364\356@?\241\331j\344h\344\222\352\356\302\324'\351\351IM\332\351T\333\365A^\346\006KE\273Ba\266\b\223\212c\377\273\273\326\033;\025\256\225\b\325\004ad0T8\030\243\262\300\301\005\206-`\210\362"
+	.string	"\206+"
+	.ascii	"\\^T\032\246YRB0\246\303\252\345{i\261X-\226\357e\245b},\241"
+	.ascii	"\353K9\340\026\f\030~1\255V\370\241\304\375Wo\374\237{B-\214"
+	.ascii	"h4\326)\216I\2204\245\212$O~\265A\371\365Dp \325H#\237\273\273"
+	.ascii	"\323\301\257)\275\213\333X\342E\254GQ2 \320\002\021\273\351\330"
+	.ascii	"\034,\031=\210\307\242pl\241\327\342.N\226nE\301\376\027\213"
+	.ascii	"\205m\002om\003\266\352;\206\253\033\206\007c'K\334\336-M@bk"
+	.ascii	"+p\332>~\226\204\032P\206\255\271 j\251\355^M\241\313\036\004"
+	.ascii	"\362<<Z\006\224x#\312q\023cW\244\235\322\335\013\035\"\266\301"
+	.ascii	"jog\300\007\345\316u\236"
+	.text
+	.section	.gnu.lto_biquadFilterBankUpdate.29.15a317f63c2f6f08,"e",@progbits
+	.string	"(\265/\375`\351\005u\034"
+	.string	"&\361\254H\240ZQ:\274_\247\366\234W\311#\350|\032\237\367>\261\333Bq\207\211#Y\177\t#O4EzXi\374\237\007\365\324\366\326\334\323\237\006\2452\036\260\006\037\274\035gi:T\340\200\206\27574\231.\221%d\313\224\002\223"
+	.string	"\213"
+	.string	"\237"
+	.string	"$\200\312\264\023J\240IX\220"
+	.ascii	"\252\022\017 \017\026x$\271G\371\364\253\326(o\206\265\326!\313"
+	.ascii	"\314\227\005\310\257}#?\222;T\213\007\250\325g\034\326\n\034"
+	.ascii	"\262\220\371\322\300\307\\/\315\367\270^:g\2139\360\251\376\213"
+	.ascii	"\215%%jj\2552\332\303{\022x\223\233{I\322"
+	.string	"\315\371\301\033\230\202\302\353\351^\222\261\037D\206\360\364\\\220BWT\347\213_\246\336n\311!5N_\274P\020\213\327\253\361\305\211Pk\365\362z3n\327m\337l\177\260];\001\377\017+\0320L}\366\256\203v\r\264\353\237]\307v\355\323\363&\377\316\227\374:O\362\303\036\365\347\034\352\177\335\352v\355\272\3345\271k\272\353\335\365\013\b(f\241p\326*c\253M\305R\022\205|\370[\331\237\362\213V\2762uM&\223\340\r\255Z+\007\363\374\320\2572L\230\303}\312\030\250\212\324Zq\276\320\260\227\276\223?\301\235*\205\251k\252\260dE\253\326&\005/Md\276\\\035\007\026f\233l\242\242\315\204%>\003T\t\257\214\307\370D\360d\323.\246f\022x\252\265\236\276\370\004>\341\217\230\264[t\257\202\2049R\247 k\335\001A+j\267\034\004\206\350\306\fA\024G\n\315\017\310\213\206w\331"
+	.ascii	"t\374\331\322\341Z<\374P\034\2513\277\030\026\210_\231\305\216"
+	.ascii	"P>\364C{\301\251\370\344\311\252\265:\370\320\264O\251\351dI"
+	.ascii	"11\302\017\322\202\013\257\314\207.z\225\317\006>\024G\312\314"
+	.ascii	"\017*i\267\234\263;T\207\302h\016=\361UFf\255uhC\261\347\371"
+	.ascii	"U\277\2174U\252\r\252\263\201\273\245Nv\270\242\0253\322U;\301"
+	.ascii	"\002\203\205\327\220f\027H\340j7\021\265\033\fE\355&!\247\304"
+	.ascii	"\321,\004i\032\203[\r\311D\221\b\331"
+	.string	"\221\315\310\310F\223\035\025\315\214d\264\033N\306`\200m'j7\031\222\315v\223\301\200I\017\336$^aI\242\273\222:\371e\244=\224\032\227i\350.z4RF\245]s\262\326ZI\352d\027\355\241\307\021\304z\221c\267[.y1\226\210\366EI_\276\342\217\\\245\335\3524l%\217\364\215\0336\035\276\206\322\227\357\374\255\2324g@\334\314\322\227Ox$\322\227\361\351\223E\206'+t\250Qd\305\310\324\314H A$I\322\214\001 \003\0211m\016\022 f9\007\235c\301H4\231\312\303\324\001vT\203\2677\\\345\201_\016\t\220&1$A|&\273lG\364\022T\326\377\354\320'\375\026\2139o\222\016\034\275\322\254\246N\322z\3670\023\3401L#:\271_\352\343\372\356}\\\017\244Qh8`\347h\203\253\257po\002\347#\017\357$\0020aT8\240\330\350\341\310\004\274\272:\363"
+	.ascii	"\216\220\330&\347\244\374\364\264\233\273\032\267\216\275\r\257"
+	.ascii	"\335n\321\027hj\376\223\266\024\0228\365\204|J\003\020\355\334"
+	.ascii	"F\275\027qql5\306\324\357\214\265\001\316\230w\242\323\213\225"
+	.ascii	"\332\036\357\033H\305JX/\223\244\221\272\004\216\020\341\222"
+	.ascii	"\250\254\251\257\337\316\276\376\001"
+	.text
+	.section	.gnu.lto_biquadFilterBankUpdateLPF.30.15a317f63c2f6f08,"e",@progbits
+	.string	"(\265/\375`\215"
+	.string	"5\n"
+	.string	"\346SG:0\257\322\001$\036\220\017\345\030\205\003\300\017[\n\373\270UoG\360Y\343\263\260|\373\270\006l\017+\215\2327\305\034\026p\001M\226\n\3637A\332*\320^\261\375\204\354\275S\n3"
+	.string	"8"
+	.string	"3"
+	.string	" \316;\217/\360\336qN\340\275\263h\307|\024\331\277\220d\330fv\267\316\220\213\227\242\177\333\001^0\326\345Faw-_\260\216{\336\366\307\366\202}\2032\273\03454\233\353TLl\277c{\326,\250g1>J\022\344\370\024\3614\337\250g7\\\032\270\335\r\271r\336!\320K\373\262\243\210\237]\\`7\006\203\333\035C\016\322Wy\276\375\244%\313\255\351n\353C\347\234r\332\024\025\362/\203FV\326c\262\354\221%'\210}\272\273\353\031\263_\373\351i\377\374\354\227\336"
+	.string	"\213KC\337\2124zP}\241\351\013;\023_\310\020"
+	.string	"\221\"9P\227D\341\267\2128\231j\nD\241\300RM\235H\250Z\nUUt`P\342\013\353\n\004\303\332\031\367tg\314\243\226\\k\272\274\t\017"
+	.ascii	"\006Sd\342u\320hp!\246\352\346q\215\r0\343\001U\"\214(!n \006"
+	.ascii	"\270\"MM\001wy\321N2"
+	.text
+	.section	.gnu.lto_biquadFilterBankInitPassthrough.31.15a317f63c2f6f08,"e",@progbits
+	.string	"(\265/\375`T\001\225\016"
+	.string	"\006\334aE\020\221\223\0168\221,\352\243\212\\\264\233C\262\013[\002\262:Q]\341e\345[\013\004\002\003X\251:\316\232%x\224\367\213Q\231j\301\301\366\003"
+	.string	"\020\001(\024N:\026\312\254O\224^\253\220\305\023B\366\226;\245L"
+	.string	"L"
+	.string	"L"
+	.string	"\037\327\247;\373\306C\022{U\212\016-lvW\323\021\326\313\360\226\261\373\224\032;\037\033q\371\001\030/\037\350}\312"
+	.ascii	"\273\353\001r\220\013\"\nX\212\362\204\312\365\251\203\300\324"
+	.ascii	"|\240\312"
+	.string	"#6\262\273\216\037\370\341\276n\233\263\315\300\276\210z\262\261\267\374\362\250\373\331GJ\215\0073\273\036Z;v5eL\034u\373\241\237Zq\026\335Q\236\221y)\331\213\212\005\307\356v>\255e\237\006\3449\266\037\355\2538K\367\026\223\013\330=\335\304\330\rC\f\222}:<\201\3533{v\314\035M\273$\004\2667\374\205c\006\320\354\256\003\273\302U\243lw\033\270\270`\301\203\246\304\247or}>\365\004\246\031\0246\244\330R\335]O-\243m\3344\256\316\245\332\0314\304\177\2162:V'\352\331\241\027u\305\376ww\035#\020\006\217\224 \362@\220\376\210p$%\023@\0214\321\026\nm\037M\004\362\204\264\0177\322D\nx\243@\302i%\333\306i\234p\377\325\223\3133\031\340\212\244\245\251+\006\300RL\225\025;\277\242\204\374\372\034(\226)\336\\J\005\277bz\02005'!J\261\025\035"
+	.ascii	"2\2411\037\260\307\216\323h\273\350f\3111vA\215\215C3\\\026\n"
+	.ascii	"\346H\214\275-\324.0\b\247,\3412\300\226\310\272\330\253\"PU"
+	.ascii	"8\270\263\252\261f%:\270\0277D\224\rv\332\333s\300\237\224;\327"
+	.ascii	"|\002"
+	.text
+	.section	.gnu.lto_biquadFilterBankApplyDF1.32.15a317f63c2f6f08,"e",@progbits
+	.string	"(\265/\375`4"
+	.string	"\375\007"
+	.string	"\362O86@S\323\001\030L\374\273q\365\3610Wo\323\354\273\371\352v\233\273|\362#\"P\266)\307\004\030\273\215\376\370\242\f$\217\232\321Y\336\215LV\325\355\260\335\266L)\224F=L\021\027\3450\271\002e!MB\004!/\314\262\260J^\"\312\222UF!A\006\306&B\231\3240,\223\236\271\237\026zn\020\3710`\206\243B\250\320\256\260\320w\326\027\220o\003r\366\344\024\216\330\237vw\r=\373\363\207'\375\032?!0\f1\273\03676\373\305\222\211\355{l\353tK\201\300j\250t\310\253\375\223\243l']|`\327\233q\331\235\tF\350<z\236\200\363\330\371\207\363\350\315\246\371,\331\313\260p\254\324\354\256\204$\337\256\233\377\224\007t#\356\n\260\260\273\326n\364q\303\333>\260\255`\273\024\n"
+	.ascii	"2\241\255/pp\341\3315\312\025\306\013\252H0\"@E\001wy\321N2"
+	.text
+	.section	.gnu.lto_biquadFilterBankApply.33.15a317f63c2f6f08,"e",@progbits
+	.string	"(\265/\375`4"
+	.string	"\335\007"
+	.string	"\242\31765Po\322\001#[\342\257\316\270\356\211EYM`,I\242\316jZ\034\nE\202\034\017\002\020\t\f]\232\210\020W\321\330\345\325\230\302s\302\361\301\r\331M\244L)\224F5L\017\027\3050\271\352d\036\r\342\343"
+	.string	"/\314\262\260\n^\037\312\202U&\001;\004\306\"<\031\3240,\203\233\270\237VC^\020!Y\350\205_\252\246\332\023\024\371\316\231\002B\302P\316\216\\*\207\375iw\327\032\262\037\177\275\350\317\307\taQP\331\325\210yY\322\033}\330\376\306vF\237\300\300\247\375\221\223l\027U\\`7TB\331\215\0076\320\3749~ \363\2479'\363\347\315ny\364\330\227V2L\\v\027j\307\267\347\346\277\344\001\035\210{\002$\354\256\263\003m\334z\333\005\266\021l\217\002\013"
+	.ascii	"2\241\255/pp\341\3315\312\025\306\013\252\034\270\002\346\006"
+	.ascii	"\250(\340./\332I\006"
+	.text
+	.section	.gnu.lto_laggedMovingAverageInit.34.15a317f63c2f6f08,"e",@progbits
+	.string	"(\265/\375`\\\001\305\r"
+	.string	"f\331[E"
+	.string	"\2216\035\033\3130\206\0330\030)\335\363\345v\247\311\30640\353\032\302\263\200\363\347\314\321\306!T3\364J_\3203\b\252O\2068K\023\252\204\240\3523\374s\fl8\3308l\313\030\363\320\376\356\266eJ\001D"
+	.string	"D"
+	.string	"L"
+	.ascii	"\366_^\302;\214\311\003\354\232h\264\330\375\022\370\300u\351"
+	.ascii	"\357\003\346\345u\001\363\322\236=\363/\304^E\214\024"
+	.string	"\231pw\261\330r\357\352\371\2279\200\222\212\350\272i\260\273\326\222\n\207;\336\266\207m\020\3733\001\366'\322\b\302\276\265\273\353h\262\177\372\257\307\374\3630\277%\325*\325\357\234E\025\332p\260\332\335\260\302\261*\351b\204\355w\330\266NF\021\360,\351\204\013\203\370\335\204\367\230\220z\2264\322\240\340\272\364\3505(Qd\353\2061\0375\036\205\304\350\221\203\222\221\222#e[=\354\tO9\005\322\204\341\025\355\355,\214\222\035h\\Vf\264\271\257\330\220\300\232\225\207\246m\341)B\327\356.\360Q`\030\351\314\020a2/AZ>xx\001Ot\025\"\027 \304O\006\355A\t\027\001\244\225p\246\263\217\356CBA\023\301@\334\266q\031\006\322B6,\353F\260\217\002\346*|:\214\204\343:\254\343\333[\033M\226,\252\232\032'qd?\233v\310_d\247\033!\330Q\215\b.A\323\227l \034"
+	.ascii	"i\231\"\023\017\377\242\301\005\027(\177\301\205,\326\370B6;"
+	.ascii	"\\\037\020A\212=GSS!0IQ\035\252p\337\342N\231\260\3325 \300\206"
+	.ascii	"VB9\230KB\260 |\246F\301eij4\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_laggedMovingAverageUpdate.35.15a317f63c2f6f08,"e",@progbits
+	.string	"(\265/\375`\207\003\375\026"
+	.string	"\246\251\216I\340\316*\035\333\344\025nz"
+	.string	"\037j\033\275v~\005\346\2607\322\213\007\034\263\037\254\370\035@\346\226\253\b\361b\262m\243\001\234\376\261M\300\232h\b\016K\2600\313\f\246\341\251&Q._L\033C\333\2665B6\331R\312\024y"
+	.string	"n"
+	.string	"\200"
+	.string	"7\226\235Z\353\307\007,\377\353[\016\265\375\235,\200Z]`\354\324\372\373\270\307\270\341\177\343\377o\206\325P\373\313\371\213\351Q\007\300\225\034`\255\225\354\330\025\335p\256\006\335\260a\266\2664\234\315\265\257(2e\370\b\345v(K!l\210\332\251\314\216Z+\216g\313\366\364\340\225hA\355R\346*h\202\212\275Y\326\355n\314\242H\255\365\234\333=\330\213\373?\366?\344\357\236\n\266\303\313\261\326\032\362\3159"
+	.ascii	"\033{'t\303m\026\314\020o\203\317\306\301\377\207\302\375\362"
+	.ascii	"\357\254\265\326\267\013\307\310g\255\315\356j\177\273\032#_"
+	.ascii	"\305\374\224\310GQ\376i\362M\223_b>\211\371#\346\217\314\027"
+	.ascii	"\233OC~\030\362\347\344w\363\231\371\033`gv\200-\f\224\265\262"
+	.ascii	"\004eT\240\220\247\302\377\332_\372\317\2746/\247\252\352\002"
+	.ascii	"C5A \321R\310\361\200\272_n\352R#\270A\221\3021\376\267v\204"
+	.ascii	"\313\324\244\214\257\324=\256\215\234]\027\355.5\201\362\005"
+	.ascii	"\216G\0221j\022\357\306\363r\324]S\204\301\267\352\215\230\022"
+	.ascii	"\316\f\030\022\306.OC\233s!\366\366\330<\003g\341\266!f/\277"
+	.ascii	"\327\241\033\212\275\272\bas\323^\\\315\334\377\320\331a\317"
+	.ascii	"\0258\232\033\007\337={W\212H\366\203\253\033\344\265\036\256"
+	.ascii	"\303-@\346\001&\fJb\257\220\276\0052#1Y\360J@\306d0\230\254E"
+	.ascii	"\306^#0\2625\243\221 \254\313JHf\244\211L6#K\277\272\263\266"
+	.ascii	"\3139d\365\316\314\370\246\251U\255\373\317\321\035\266\276="
+	.ascii	"\325\244\346\350\305\221\270q\360\250N\365\342X\250\032\325\r"
+	.ascii	"|\204V\212l\034\234\364\304\202\210a\365\210\271\326\212\022"
+	.ascii	"\322\350\251\227\346&E\020\355\324\005z\275\331/K\243\377\310"
+	.ascii	"\232\240\211*8\027\210l.\372\343J\005E\250Q(K\"fd,\020\031\005"
+	.ascii	"R\222B\033`\"\021e\327\001\021\240\245TT#E\005\333\f\351\022"
+	.ascii	"\307\314\315\027\315Ar\217\241\341pC\313\205Z\034\222\264\016"
+	.ascii	"9\030\310\205\216\336\203~@$\036\251\340%)\234.\362c\006\035"
+	.ascii	";\376C1\005\025\205V\250\f\031\203\013^J\230\\E\031\035\335\324"
+	.ascii	"\025\205\241\301?\2635\332j+\033@\006\326\262\356\255\013u\315"
+	.ascii	"\233\326\"Mc\006\004\311\336\330\306\024\177\213\337.`\244\330"
+	.ascii	"\336\367\344\365$k\224\372\371\025\242\202)\210+EE\034\312\233"
+	.ascii	"\332\352.M\331\203\032"
+	.text
+	.section	.gnu.lto_.symbol_nodes.15a317f63c2f6f08,"e",@progbits
+	.string	"(\265/\375`\274\002}\t"
+	.string	"\002\315/4`m\322\0010L\r\002\3560Hn\225\246`\305\362\t\345 \b\202 H"
+	.ascii	"/%\300K\tpZ\223\336\215\2505B\210Z#\372\243h\315\303K7)I\222"
+	.ascii	"\001h\024\353e\013\253\324\354\214\2226\223&\237-M\371\234\224"
+	.ascii	"/\203I\203\\\362Y\235%\035\342\322\034.7\036\322\270\346\335"
+	.ascii	"E\304R2\0162\306?\027\177\026\367h\3053S\034\233xG%nE\374\262"
+	.ascii	"\310\311G\007\3049\372\360\312\016\247\264\341\0333\\\263\360"
+	.ascii	"I\341R\3023\241#\200n\240\375\340\363\202w\002\3171\331/\330"
+	.ascii	"-\235;\316\007\364\272@\264m\211Z\017\250^\211\020\021`\267m"
+	.ascii	"I\020\217h\342a\357\356R\327\b\021s$= `\2036)6B \214 \312\006"
+	.ascii	"\334Hp0*\367\201\254\035\304\371:6\251\246NY\253mI&\223d\330"
+	.ascii	"\352\341\b\304TZz6\301\310^\332}\316\347\240\b\006\336`\370\006"
+	.ascii	"\3360D\200\376\307\2000\262\201C1\230x\203\2017\030\276\361\033"
+	.ascii	"\337\360\215o\370\306o|\3037\276\341\033\277\001\177\226@\272"
+	.ascii	".F\025\b]\b\306\272FO"
+	.text
+	.section	.gnu.lto_.refs.15a317f63c2f6f08,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.15a317f63c2f6f08,"e",@progbits
+	.string	"(\265/\375`5$\255\221"
+	.string	"*\336\3140Q0\022\322I\007\277\036\202\317\212 \230\033+\202p\316\n \244\313'Q\244\3728\341>\326S\262Z\025=k\001X\302}s\347\377a\222L$\236\236\311)\003@E\024\021Q\004XVU\020\021QU\235U\265ff\211\351w\367l<Q\215\221-e\n{\002\366\002\030\003\366\331\345\220\013\333_\024p\355\t\310\323'\201\234\205\261p\033\003\362\025\030\303\273.]\253z6[\317]\3539k\355\233\311\002\302\031\330*\037\232\013y_9Z=W\345=\372dI\025\206\262\036\337=\372$\315\n\357q\033\3531\036\232NL\327\324\221#\242z\236Z\3177\326s\323\252R\341)v\251$\005\305a%#w\255U):3V<\260\342Z\275\016+\223&]v\242[\226\020\356\260\r>\315\316\f\301~FK+\264"
+	.string	"\216\313\212F7\367V-\237P1.+\306\334\253<|\336{\241\260\034\323\361\034\333\261\224\3438\n\327q\033?a\2673\020\374v\025zV\362\263\032?\3415.+\200\306\275J(\003\302\252\034\311\r\336{!\320\201@\265Q\245\253*"
+	.string	"\365+\254Di\337\007\353\177''\200\352b\360\001\326\213X\037\300z\234\365\246\270\"0\263~]+xY\017\345\020d_\f\366hK\335kt\357\025\321Q"
+	.ascii	"y\f\266\312c;g2V\022\202\310tB/\332\275\327\306\262\301\035\021"
+	.ascii	"\266\332\275\236\215C\020\021\340\234\034\"\215\024\3129\304"
+	.ascii	"\225C\020u\004\035p\373\361\263\002\274\300\317$~n\340g\007~"
+	.ascii	"\363\333\250\024e5~F\221\305\"Y\301\022V\264\345\225C\220-\037"
+	.ascii	"\"4\374\374C\340\224\030\304\227\213\370\355\0133\f\370\231\337"
+	.ascii	"\222\020e;\370y\346g\031\253\001\315oI4\027x\361\267#^\363\333"
+	.ascii	"\234\377\205\377\017\177\356\237\t\177\376\317\366?\227\377\206"
+	.ascii	"pW\036\300o_~N\376}\375-N\214+D\200\377\261\374\017<\314\337"
+	.ascii	"R|\242\177\371\273\354\377\336\177\275\023\377\016{\377\255\365"
+	.ascii	"\303\376\035u\233\277\235\376\313\375\257\373\377\344\177\024"
+	.ascii	"\270\377P\376\333\375\247\373Ov\031~\366;\316\337M?\363\375,"
+	.ascii	"\367s\334\317n?\257\375\\\366\363\330\317a?{\375\234\344g\"?"
+	.ascii	"o\375\034\344g\252\237\243~\206\372\331\351\347\346\317J?'\375"
+	.ascii	"\274\374Y\371s\214\237\211~\206\361\263\317\317*~\236\341g\030"
+	.ascii	"~f\341\347\024?\227\3603\002??\360s\315\317/\377\005\377\363"
+	.ascii	"\375\227\362\263\007?o\360"
+	.string	"\263\316\377\026~\266\340\347\235\377)\374,\301\317\021\374\f\301\3177?\333\374\\\374\231\370?\210\377}\377\247\374G\341?\007\377\347\376\037pxxx\370\023\201\374/\"\376\021-\002\304\253d\336{yx\201^f\021\r\221_\230K\3745l\257\336\373\301\364\336\257g\226u+\252\204:\002\367G\356M\342\\\350e.\311\250\222\313\262)M\034\350\235\022q\311\254\356\022J\325T\245n_\350\345kD\325\254a\t\225b.\241R\311\233k$\225\274\027\332\274Y\242)\223\274$\243j.\311\244\2328\327\350&/\231rj5\222j.\351\244\2327K2esiD\325\304\361zfy\325\340Sr\341\344\322\3502-\355P2o\244K\250\324\325\273\227\321\216.S\201{wH1\365\2249\230\255H\312T\324D)5b\251\250J\352\032I\227\\R\367r\025\271\270K\027$\241\322\213\305\322\244\325\216\253tt\357"
+	.ascii	"K\367&\371J\357\275\311{/\fs\007\364^\0357\313\347\322\322\275"
+	.ascii	"N\235\245\273#\351\344\350\336F\263\302\326\\\222UI\35581#{^"
+	.ascii	"$h\222\237W\217\212\271\222%\303\256\322\275\227\261\254\317"
+	.ascii	"\246S\340\227\227\235j\002\321\322\252\022\273EY48\266&i$\\h"
+	.ascii	"K<\024\351:\022\023\004\231\023I\253Ff\214(i\263!dm\353\"M\344"
+	.ascii	"\320{/\r\022\026\\\021\253\022\275\025c\004\265\211\301\303\022"
+	.ascii	"\205\006\325Z\200|OU\255\336.\327\036\322Y\334\326\317\253bR"
+	.ascii	"\227\354^h\215U\342\250\213\226 \332p\t!=\005\223\004\256\n\315"
+	.ascii	"\207\257\021\233\274\006\361\202t\017D$\206o`\255b\021\273\264"
+	.ascii	"zh\t\274j\036\276\266\301\0213\006\251\250ij\201\216~**o\256"
+	.ascii	"Q\221\322\263m\364U\337\350'\013e[\221\306\226\246\367B\253\032"
+	.ascii	"H[\265\217\376\301m}\325P\357\035\035u\235\253vz\264h\004\275"
+	.ascii	">\020\2510!1\007O`\320W\315\243\247\212I\350m\"V9\221\230\203"
+	.string	"\367B!\240\321R\367l\322\250=\325-\325T\357\251\356\361\023\030\234\306\350*\271\027\332S\352\275J\346\004\212\314\t\274\274\tQ\216\021\325w\337\372\276[Y'\272\276\275\326\306\3219\270\215D;\317cm\343/J\350\205\336\013\265\351 \205ic\\\353\231\004\321\036\0362\t\342\033k\275\351\036\353\033\252Ib5rc\242\204\311\2042pVI\323V\231^\306\250,\255\265\272$\343ci\213\256\325w\215\365\f\326I}\235\304w\\\306R4\265\b\337T\251kp['\365\362\254\3264t\2104\366\234\205D\225/\347\020\317]\326\277\221\372H\335R\030W\244\325\236\261\252\365Pe\244o\335Y\253\233\252\245A\261\235\331M\233\324=\231\300\331\331M\331\212\324M\325\304\340\354\246jK\222\260\335{/\033\266\262\213\270\260\223m\304]\370\220\333\230\220\007\317[\230\013!G\037e)\032?\277\352\2463N\266\245^"
+	.ascii	"jKq\016\221\001\256[\177\326\022\204\363\257*\251U\3017\230X"
+	.ascii	"\214\030\261I\362\256p\224/\2679$\267I\372\352\207\323\220Vm"
+	.ascii	"W\227\315\034\t)R\245U{\004f\216\b\021\273E8\365\023\004\242"
+	.ascii	"\320L\210\020\273\265\347|\2768\231\031F\375p\273E\314\262\324"
+	.ascii	"\303\252U\253\325e3^}tA\264j\237YC\262\254\254l\22059\367\234"
+	.ascii	"IJRcI\017\267A`p\240QAk\325bu\331\314\215\275+\177\255Z \177"
+	.ascii	"\023\303\"\314\321\252\375a}\330+\030\033=zX*\2767\217\3114\354"
+	.ascii	"j5\355\324-\325\213\031\027\337`\253V\312>\265\217\2778@\230"
+	.ascii	"dT\224\205\372\262FmwF\236\275aoX\250\263!\305\266\246\2672\035"
+	.ascii	"\267PH\226\314\246V-\016\373\204\326\204%\356\311:\237\205JY"
+	.ascii	"\226\004\255t\324\2609zI\244BJ;{sr\262\315\274\035O\231<\255"
+	.ascii	" |\214Y&\313d\2333\272\364U\327\323\r\313\274m\322,\225\202^"
+	.ascii	"\255\332&{m\252\322\366p\fQR\272\363\253b\245\211\323&\331$\253"
+	.ascii	"\344\313\274k2\205I\372\3101\326\352\2113\254\2215\262K\272\247"
+	.ascii	"\rt\260\nV\253v\371g#\246\004eK\253\366\310\3368\032`\205\255"
+	.ascii	"\332\031\217\252O\304\324\246\315E\264k\"\344\002\270e\213U\356"
+	.ascii	"\251y\204{Sl\362V\371W\023\305\203\254\320\336\016\214\346\356"
+	.ascii	"\354=tb\005D\331\252a\317 \204\n\3143\344A.*$\322V\233\360\321"
+	.ascii	"\032)\024\307R\253\335\245\271\212>\\}\341h\265\271<\n\323c\t"
+	.ascii	"\241`\377\320dS\222H\245Z\264\364\023*\321)ke]\211\261\005\006"
+	.ascii	"\266\240\020{\326\374Zfy\013Fm\215\034pO\2556\226\376\243q\022"
+	.ascii	"\246\364\003\272\267\327Svz0\306\20387\246\265u\345=\235a\302"
+	.ascii	"\323r[m\276\376\233\323\262\303\371\347g#\227\026\245$\b\243"
+	.ascii	"\344FaW\037_a\303\257"
+	.ascii	"\261\261V\333\312\213V\225*\235\327O\030\263\"\246i\261\013T"
+	.ascii	"\013\017\357\235'SFx\325\327j\337QM\231B\205\3063\246\b\263\307"
+	.ascii	"\220V\377\242\004\005JK\373\272L\257\323Y\242\206\360\210NG\224"
+	.ascii	"\267\324\346\210!\223\033\255\366\\\3339M\rF\355\352\264\204"
+	.ascii	"0\345\340\023L\362WD\307x\355\307t\205\320\360\355\255\237\254"
+	.ascii	"\367^{/\017\277\347\032f$\212\216\270\367\023uJ\357\351G\253"
+	.ascii	"\r\367\350Z\230^\220)\033[\273\255\177tS\233\344D\216\254\355"
+	.ascii	"\355\366\007\244"
+	.string	"Ko\257\325v\322_\366\257lNO\245c\302\244\327V\"\r)\336\216\0221\203Y|j\357\265h\215\022;\247e\253\335\244\273l\224|\2057\242Ld\255kI\253W\237ii7\267\350\016\311S\265\261\276\301\032\032\326g1\367\336\231\031ONf\211\277\315\336g\377\243\271\267\200bT\251\311\251\325\026\3532\232#%5h\224\221\025{tAuI)\372\240\002\334\322\352\030\273\331(9\023\313j\365\202\217Y\265\340h\024\021\\\377s\306\343\017\3201\205\016\262'\b\250\305\313]P\340s\374\021B\016\2310\262 \002Zq\3741!4DdB\200c\320\021\006\311c\304\341g\210\030#\350\b\323\242\307\b\244\"\215C/\214/\210\307\237!\231\273\240`\310\005\262\347\205\214 !\0300zx\206\202V\310\214\020\221\243\343\302\207(H\310\005rh\250G\205\003P\250p\302\b\024*\234 B\200\241\037\031 \f"
+	.string	"\300\b\034\234"
+	.string	"P\250pB\016\n\025N\bq\263\202\213\025\310\240\024\220\306\022ll\212\305\026-\202\220D\"\030\221=,`\270\220\203\3749\2468\376\364\224P\023\342+\200\200\210\2166\004\030\217?@\307\024;(F\270\001\b\006\f\020\f\370\212\037!\343\321\350\263\376\202\f&\310`\003\0310\337\200\203\n8\250\200\370\r8\330\331\341 \203\235\365\031\354X$\rr\210gE\362\234\260\200\307\b\343\206\026\220@AA!\360\274\2600\276\370\021\202A\034\3421\372\364\b\031m"
+	.string	"\001\005\026F\037\237\036\240\034\031F\026\307\024/\340 y2\330A\036\177\210V#\016?,\304\bbq\374\211!\363\202\210\005\237\343\217\rA/bZ\020\251\260H\033\344\020O\021\311\002(\310\305\220Q\310\0052\206\006\371\363\342\347\204\030F\240\241\030$\r<\304\263\203\2041cD\366 \207^\220.\bx\020\f\243\220\tdP\220\220\211\231\0237\364\020\017\r\307\236\020P\260\350!\252\341G\005"
+	.string	"\337\331\021\001\001\027R(a]A\201\220\021\t\364\323\302\3041\350\305\213\240\025&\216?=/L\254\020\0322A\301"
+	.ascii	"\025\250\350\035\025}BE\357\364\364\211\236\336\221\321'd\364"
+	.ascii	"\316\r}(t\206\215G\232\r\301>\223AC\222S\313\302W\224\202\035"
+	.ascii	"ba\331\262\001\330\365\325\252\005\264\200\226*&\271\2149\234"
+	.ascii	"\332\270\264C\300>{\305*\253\250\244x\255>j\375\302\236\367\336"
+	.ascii	"\033\032+Y\324\320\266\314\335F\231\263|\026\217\346&\305n\023"
+	.ascii	"LT.\313\306\340]:K\314\204\325\b\223\202w\313wk\345\004\006\367"
+	.ascii	"[\217\024\301S\266j\367n\365\234um\323<\253\367\307\310l]\221"
+	.ascii	"\031\201\262~\202U\fG\263\331\252\275\273\037\227\237\022`\253"
+	.ascii	"\266\312\337\234y\203?,\025\273**E\255Z\251\225\302m\237\263"
+	.ascii	"S^lCJ\233s[\277\003\177\216h\353n\355\332x\\Q1\241[\202\007\365"
+	.ascii	"4[\037\003&w9\033\3077\320\242\273\032\317\030\304\206\004r\255"
+	.ascii	"\177{\263q,v\233\np\022\326C\340\340\275\316\022k2\314\006\027"
+	.ascii	"\334m\\\224\317\254H\211abc\263n7\t\230@\217\213\307\034\204"
+	.ascii	"\231\222r\302k\273u\213\026"
+	.string	"\353\220\360\020l\325:\211\251\003\303r\313rvf\327\354\246\266\207&\263&\265\333\265\232\243%\036Y\255\3324\333\344\205\013\226\016\265&\226I\020g\022\023\253\212\020& K\032J\206tz\327\252Ek^bq\232[\351\312\312\372L\3569\204-\311f66\326gL\246&8\301\261\024\002\006f\303\322\220L\355\223]\227(\320\3330?(ove\226\260M\372\327\352\327%//\233d\317\207)\017z\001\203&\250\322\021-\310Zed\250DD\222$)t\342\n\020\006cq\034\350\316\003\022\240\3640\020s\f!D#\"#IA\n\222a?\0039\001\260\206\t\031\366\225\375N\224\261\202\224=T\256MU\232mw\354R\275\265\001\221\220\003\330\247tj\200\304\034\302&T\344\347.\341\246\275\360)\363\325\214\227R\361D\274\0161)\253,W\355%g\373@\310\205\303\340J+\331b\376z\003h\274\022"
+	.string	"%\035\237\256^"
+	.string	"\bY\b\317E@~\005m\0078+\363\206\360\215f\032\332\361\357\363\307\337a\225\364\016\371y!Ey\244ipx\225@\364N\271\233\244`{\372Q\267\367"
+	.string	"\213%#\355\262\323\032 2\320\212q\337\223\367\215\251\024&#\353\233\312\005B\331\264G\213\330\270\224\020<\307)\251\355\212\345\2165^\252\210\036\274yW"
+	.ascii	"\242\343\373\227\245\310*\032\3242\f"
+	.string	"\347\371\203\3015L\264\313\242\237UVx\323\032\275\022n2N^\006-\213T~\340a\237s\t\022\243\216\215\305A;\226\252\201X\r\244$q\270i\244\210\tXV\330Hx\215\261:q@\033\241\263\235\260l\343\207}\217\217\314\276\006\351\200\223\346\242\364\232m\313\210\003[\0350\276\2302<\025\326\206\353\245CB2\224\321\215\331\022\025\335\035\301\031\300^>\330\350N\317\256\021@M\263\200h\216\262L\034\212\366n(-\305\315\344\236\320c\304I-V\037i 1zRd\376>\263.\302X%Z\207Vc'\006\340\236\306\037\017\306!\310e1!\350\347\332\033@r\346\202\036\"C\303\3405\203:\025\353Z\036\262\307\374/\237\240\344;\\Z\376\252J\035\b:\345B+@\204G\257U\226\362\311\177\003\002\243Z)\244\301\233\230\332\236\355P\312\276Fa\244\362\371#\227\310!b\240\233AA\345\211\317\312"
+	.string	"\250\321\262@\006\263\277\360URT\311\232\326%~lJ\bd.\234\200x\037|\033\357\226\2467\246\346\214qI,Se\221_\257\256\311\252E\276\271X\246R\214\b\3169\205\315\337\347\304\\/?\371\nJ\007\332\016\"\331Ecm\273eQ\017\310\351h\335\366^;\211vw%C\204 \317\304+ARO\221\272*n\325\335\307\240\201\355\003/:\236Ys\233\234u^\\V\372x\030\363\247\030\226^\315\002k+7Q\227\267\033\231A\252\324l\007B\322\323z\352x\260\342\214\037\032l\245\231F\236\273\313\347/\271X#82@\201\002\227\202\026`\266\023\340\204{\357\213c3u\234[7\323"
+	.ascii	"\300W\2064Y\333\245\321\177,\366\354u1\326\221\221\264\215\311"
+	.ascii	"\253Y\b\225[\r\201RT[\202\302l\3313T\356#\f{\tF\r\212\023:\270"
+	.ascii	"h\342\026>\326Q\345\031M\245fZH\235_@\360\201\n\366\262P\022"
+	.ascii	"\\#\331\324g3 \314\240A\367\3017\225A\266+\364\366\341\306m\320"
+	.ascii	"\347\345%\021L\031.n\330R\315N\330'iV\"\210\001\261#\320\265"
+	.ascii	"$\273R3\342v\327\036H\230'\271\303\216\025\240\320\363\234H\307"
+	.ascii	"\002\342\244x\232\352 n\223\033,8p\007\227\354]\247d\273\037"
+	.ascii	"\374s~3\225\251\232\344;\260\363\210"
+	.string	"\t#P\231f=\203~i\255;\226v\013#\fx\302#R\r\335\254\007\353\247l0\264\030\376\2608\352\201\310M\320=\220<"
+	.string	"\213\2459\263\264\n\221^?1`\212i\201\220+\362\216\357\r\017\212 \030\230\225VS\"-Y~\306\013\026D~\036`\337\332e\372;\353\223\n\241"
+	.string	"\240S\023\266\356\025\007\300\0031\251\366\2103\215\301\363\034\364I1\177d\200R\221\227\270\235\244\2031\f\212\213\312\356\317\273\027"
+	.string	"\001V:pk\314m7\265\204$<\376t\335\265\303\001\373\210`)\221\352\263\007\231\211\\kr\021J\360\247"
+	.string	"\004\254dG\221\f\256,\301\037\026\341\377:\026\211\211B\275\254\371!7\035\301\264\f\276\304\230\274=V=\004S'h\026\356\"K\231\300T`0\236\031\230\314\273/\f\223\337\300_\333Xx\262\307\341w6\370\236\017"
+	.string	"\234\375\3375\\\336H\240,\342\225\314\355\304\314\237\303\203\013K8<\360"
+	.ascii	"\272\302\3246E\240u\273^\313\200\025\204\222\005\n\020\221\244"
+	.ascii	"%\227\367\020#.\017\334\203\346>\251\017)wC\350\017.\236z\245"
+	.ascii	"=y\245\253\376(\263h\216\"\324(&\020\373A\177\210\305b\365#s"
+	.ascii	"\022/\337O\264\337\204\226\340\002:\232?\306E\226\377\357\031"
+	.ascii	"\006\0374\323\301\347\325\377\223\217\305\343\t\330\317\031\016"
+	.ascii	"u>\351\372\2419\230\270m\342\266\320\316>x\262K\277\303\262\327"
+	.ascii	"\234s\356\232\315\232r\005\236m})\322{\316\336\033\217\347\277"
+	.ascii	"\306\177v\371\257/7Cx^a\240\353R\337\236\272\346\230\340}F\326"
+	.ascii	"~\331'\300\235L\327\346O\3646\371\345~I\236\031\177\336\304_"
+	.ascii	"\312p\020\354\373\310\204\200\357\220\023\0206\016\340h\241/"
+	.ascii	"\304\251\277\263\372\252\231\037\221s\373|\353\036\365\377\002"
+	.ascii	"s\316\3712q'\231\236\275\363\272\347\362\377\\\020\206\316\366"
+	.ascii	"\f,>\352\036\220\335\341<z\227\334E\372\370>\260\207\313\003"
+	.ascii	"H\377\034\317\030\020\206\215\253\336\373\211O\b\020~\204\272"
+	.ascii	"\244\263\0310\371\022\274\317\321\0336\202\373\0255t\265k\234"
+	.ascii	"}\263M\253^S\207w\256\350\037H]i3\237?2\266\305\217\241\3616"
+	.ascii	"'\340\206X\245\203\230\320\363\247s\342t\345\307{ 6\223'6\374"
+	.ascii	"\316\037 \203\264\376J\354\211\337\374v\342\206\022\217}\334"
+	.ascii	"\254N\230\253\300\311\271\027~`8r\370Q-\335\265\274{\035V\023"
+	.ascii	"\341\242M\317\253\311\025\331]\211\016\271\276M\334?\316\t\200"
+	.ascii	"\300cZ\205\341\334n\005"
+	.text
+	.section	.gnu.lto_.symtab.15a317f63c2f6f08,"e",@progbits
+	.string	"nullFilterApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\001"
+	.string	""
+	.string	"nullFilterBankApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\001"
+	.string	""
+	.string	"pt1FilterGain"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\001"
+	.string	""
+	.string	"pt1FilterInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\001"
+	.string	""
+	.string	"pt1FilterUpdateCutoff"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\001"
+	.string	""
+	.string	"pt1FilterApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\001"
+	.string	""
+	.string	"slewFilterInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\001"
+	.string	""
+	.string	"slewFilterApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\001"
+	.string	""
+	.string	"filterGetNotchQ"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\001"
+	.string	""
+	.string	"biquadFilterInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\001"
+	.string	""
+	.string	"biquadFilterInitLPF"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\001"
+	.string	""
+	.string	"biquadFilterUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\001"
+	.string	""
+	.string	"biquadFilterUpdateLPF"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\001"
+	.string	""
+	.string	"biquadFilterApplyDF1"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\001"
+	.string	""
+	.string	"biquadFilterApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\001"
+	.string	""
+	.string	"pt1FilterBankInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\001"
+	.string	""
+	.string	"pt1FilterBankUpdateCutoff"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\001"
+	.string	""
+	.string	"pt1FilterBankApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\001"
+	.string	""
+	.string	"biquadFilterBankUpdateAxis"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\001"
+	.string	""
+	.string	"biquadFilterBankUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\001"
+	.string	""
+	.string	"biquadFilterBankInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\001"
+	.string	""
+	.string	"biquadFilterBankInitLPF"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\001"
+	.string	""
+	.string	"biquadFilterBankUpdateLPF"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\001"
+	.string	""
+	.string	"biquadFilterBankInitPassthrough"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\001"
+	.string	""
+	.string	"biquadFilterBankApplyDF1"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\001"
+	.string	""
+	.string	"biquadFilterBankApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\001"
+	.string	""
+	.string	"laggedMovingAverageInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\001"
+	.string	""
+	.string	"laggedMovingAverageUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\001"
+	.string	""
+	.string	"cos_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\001"
+	.string	""
+	.string	"sin_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.15a317f63c2f6f08,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,391 @@
+	.file	"histogram.c"
+	.section	.gnu.lto_.profile.1da7b86155dbc394,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.1da7b86155dbc394,"e",@progbits
+	.string	"(\265/\375 Q\375\001"
+	.string	"4\003E"
+	.string	"\005"
+	.string	"\350\233\354\354\r"
+	.string	"\001\237\264\377\355\002"
+	.string	"\002\220\313\226\330\f\n\002"
+	.string	"\002\001\003\344\312\337\211\007\002\002"
+	.string	"\002\002\004\361\232\220\236\b\004\002"
+	.string	"\002\002"
+	.string	"\003"
+	.ascii	"\\\202\340\016\341\r\264\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.1da7b86155dbc394,"e",@progbits
+	.string	"(\265/\375 J\245\001"
+	.string	"4\002>"
+	.string	"\005"
+	.string	"\001"
+	.string	"\020"
+	.string	"\007\001\003\001\200\f"
+	.string	"\t\001\001\003\002\002\001"
+	.string	""
+	.string	"\003\004\003\004\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\006"
+	.ascii	" \306\315@j\322p\t\003(\177\003X"
+	.text
+	.section	.gnu.lto_.inline.1da7b86155dbc394,"e",@progbits
+	.string	"(\265/\375`."
+	.string	"\265\006"
+	.string	"\302\313*2Pm\222\016\300\026U\230e\023E\261\310\317\325\200|~\335\020\260F\214\211\004\326\220m\250}_,\300lg\026\231i\024Y\214)\252\030\255m\220-w\n\203<+\235\3513\265T\032\212B\357\276L7@\315\203pC9\"<B\322cz\262!\331P\375\303\240%1q\005\214[\256\233\265\024\213FP\241\310\005\205E\375\245# \234\216\002\326;\207\210Us\375.\330\t\371h\030\\6\315\030\212a\362\311\020x\232a\357\022\"\254\346~U9\037%\025\324\275\345\302\177\200}\027\232\231\031\375CfB|\377*\fe\246\364"
+	.string	"\337A\020"
+	.ascii	"NK\355\331\240\243\032\"\256\202\005\233\006d\001\023Nl\270\305"
+	.ascii	"R(\260+\002\205\246<Na\027\335\376m.\247\201!"
+	.text
+	.section	.gnu.lto_.jmpfuncs.1da7b86155dbc394,"e",@progbits
+	.string	"(\265/\375 \177m\002"
+	.string	"RE\016\025\300\245\320\001\377\300w_UW\003UU\206\272\340B\332\3362\245\306fS6\343\303\241\252\312G&\2337\303o\261\211\237\244\035\b\323\003OgB.\264;\"\274\367\002\024\004\006"
+	.string	"I\005\025\253\3226\347\326\274\b\231\304m"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.pureconst.1da7b86155dbc394,"e",@progbits
+	.string	"(\265/\375 \024\241"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	"\230\004\001\200\004\002\232\004\003\205\004\004\205\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.1da7b86155dbc394,"e",@progbits
+	.string	"(\265/\375 \204m\002"
+	.string	"\002\204\016\033\260%\351\f\303|8\305\302\220q\206\203\212(\204j\003\303\r\256\021\262w\2232\005\023\2051\330\347\354Z\277P~\216\301\bz\316M\271\225\177%\324\026 \220(K\342\265\371\217\006"
+	.ascii	"?\325\001E/5\220fN\367\362\b\006\212"
+	.text
+	.section	.gnu.lto_.lto.1da7b86155dbc394,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_histogramReset.3.1da7b86155dbc394,"e",@progbits
+	.string	"(\265/\375`\025"
+	.string	"=\007"
+	.string	"b\31623pm\032\003(h\244\357\037\boAD\315\373\221\204\247\031\266Z@\220\335\343\b\200\0340\271\232\267+\252\212\376=\221\032\365xC\337QR#{K)S\n\227R\233\212c-H\320\247\303\020=\262\252$\025=\035N\025)\353\0237\005\225\r\nV\004IiE\314\274\341\237V\230\262E<\211B\327\351\212L\007v\257uxp\316*\200\262Q<\254\235\230{\030\255\341\377\367i\255G\266\203\225\222\f\311o\221r\362M\n\321\300\264\265k-2\307\345\021\204\003~\355\003\344\237\232j,\226:=0Y\26283Y\352\325\216\020L"
+	.string	"\210*<L\376\307\227\341\313\356\252\335\341K\026\302\354*\t\377\353\262\320\205\373\334\326\240-B\333\215\t"
+	.ascii	"\204YE&\036\355E3.\020\202!\227`\233\325\224p\207\027\355$\003"
+	.text
+	.section	.gnu.lto_histogramBucketLowerBound.5.1da7b86155dbc394,"e",@progbits
+	.string	"(\265/\375`\004\0015\r"
+	.string	"F\331ZC\020\221\223\016\263\024C\374\344i\230G\202# o\245\315fFa \272&&\233m"
+	.string	"Yj&uVQ\277\016o}N\244\306\207\324\001"
+	.string	"\2402\246\240\"x\222\370\205@@"
+	.string	"\332\357j%d\357-eJ\001I"
+	.string	"A"
+	.string	"G"
+	.string	"%nb\305!\027Eh#2Zft\354\306\013\301A\340\237\273\001\370\247!\036\272\323\f\371,wU\007\032\027\215\303\325]\032V\304|h\"G\340\006\t\0277=I\332(\263\"\331]\247\213\266\341~\267\355\3006\003\373\027\002wu\231\037:\3752\3552\255\231\316L?\200"
+	.string	"\020 4v3l\251\235\361^\304<\376\366\212o\362\306v\264\340VE\003\0305p\354\306\004\177\036\311\274\f\307"
+	.string	"v?\240Z\354\306\020\207X\177\266\375\372f\262\324\200m\333\266s`\245\252\220GV\372\351PS\035\252\305C\245?\375\3722\232,\245\340P+}(Rd=D\271e\315(F\215*\214\317\201Poz\201S\216\023\250Q\356\260#K*\214}\267\372b\3531\013N\260\t\016d\"\241S\001\002tG\304S\3629\301@*(\021\256\024\314\343\301:W\nJ\211\347\352|T.\221\003\306(\230|.\020\206}\256M\334\353\213?F\224\324\322\233\376\200d#\241>%\331~j\022\f*rN\257\226*\213\254\244\001\025"
+	.ascii	")\0230\232\216\237\330^84\306\334\213\324j7w\311\\?s\023\231"
+	.ascii	"K\031\225#f.s\rW[\340*#\240\315\204\223(\262\204\032(\374\314"
+	.ascii	"G\252rh.\265\007"
+	.text
+	.section	.gnu.lto_histogramAdd.6.1da7b86155dbc394,"e",@progbits
+	.string	"(\265/\375`b\004=\035"
+	.string	"V6\275I\240\230Q:\020\353\315(L\\\236\007\371G\030;\254\204\327\256\334\220\346\305\003Y\360\361\236iC\202\242\017\307\367&9>\260\332\001\216\301\340ux\035V\340K!\243\037\225H+\3008\374\325\332?\305\371\375\237\220\275\211\224I\006\250"
+	.string	"\236"
+	.string	"\251"
+	.string	"\017\362a_\265\306\330ZP~\352\214\347\335\373\370\217\336\235@|V\253\022\021#\265\nwv\247\374\\\341k\364\263<\215~no\027\313\215\b\331\025\340\023\230Zk\256g\254\316G\341\227r\357$\235\345\330\334\333\177\370\231\323P\213\030\fqr<\230\027[\262 pt"
+	.string	"\214\222\342U\"\230\302p\260\370\334\222\305\313\261"
+	.ascii	"R\023\025\257:\227\b\002\307\032\226\214+\037\236@\216\023-x"
+	.ascii	"\214\300\344\323\"\006U\274\307\334\t\251\033\262\240o\244\311"
+	.ascii	"\242"
+	.string	"\343\310\247\316G\301\"f\362A\255u\331(\210\342\373\372\3562\355\256\204\335\221BFt\214\331V\332%y\003\220\2747'~o$\257\215\344\255\221\2746$/\215\344\255\271\324wFyidw\372\001P\336\330\203\374\260S}\351\344\235\223w\234\274=yy\362^@N\222\226'[\255%\254&\212c\352\325Dr\343R?\361\247z\357~\367B\366UT\270\261F\325q\351\213\320\007\230\b%\221\023\367R\237\332XTo\367CzB\027\262\rv\360\250\265\306\204\366C\036\2651\250!\035\252&\b\273B\177\032\032k\024\004%U\\\265\n\r|n\203\362\223c\273\313\302\003\351\005\327\321w\205!\225\"\356\232p&\272\001Sj\255\fv{\276\304\247\254\265*Pb\341\247F\203\351s\017\202~\276?<\367\330\021\006\t\021\027\307\234\017\321[\337\364k\005\324\257\213\255k\372\326\234\365C\372q\264\326\266&\311"
+	.string	"[\3304\254kM\237~eh\215s\034\265\271\025\3715\371h\275\314\307\321Y\3274\331\245\370\313A\323\263\346,`\031\".n\254s\276I(M\267\227_\223\217\213\013cX\357\211;\036\275Q\2549\t\306UQ\207 0\305e\325\377@a\375\251\237\004\n,.P\234\024q\327\256\320\307\275\264\373\235?O\340\303\3130\006\365`\320u\250@{:d\340\3610_\253C\260\343\001\362\341\005q\370\271\220\323\300\333\355x\272\234\206\037\236]N\007\304!\207"
+	.string	"gy\033z\200rA<\036P.&$z+\355\024sE\324\276\235]Eg\2432\243\243c\317\356-):[\326\314h\303\251\007\331K\373\352\232\262\236]\345\036\341(m\2161\254R\304]\037k\255\225\366R\222\323\226\365\353\013\324\017\251\033\353\352F[\016\234\273{,\002t+\035\216\223\033\367\253N\263\022\005\351G7\227S\222\213\331K\373\317"
+	.string	"\261\232R\266\322\326\324(\3217\022FP1\254\003\364Q\027\213\001P\250Q<\305\214\023\020dh\206$\311l\nmp\002\221\262\273\r\021\220\3113C\222\232k\006\004'\361\023I\311Y\005\356\030F\2211"
+	.string	"\330%\005\274\335HC,\365p\267"
+	.string	"{d:\204\333\035\215\261\354w\2750\016\211\276"
+	.ascii	"%\360q\037q\230\303\004m\357~0M:c\274)\307\371T`\253mM\253~b"
+	.ascii	"\304\204\271\261\022\3261\007\335\025\233y\214\200\377\337s\240"
+	.ascii	"kA\331\374\035\2232\306\007$\246\224\306O\216\353cD\332\f\327"
+	.ascii	"\362\357p\"\336\212\330\002U|\314\305Q\274Z\214\271\326\225&"
+	.ascii	"\024\007D9\003R\256x\252Gd\340\230\362$\364\017"
+	.text
+	.section	.gnu.lto_histogramSampleCount.7.1da7b86155dbc394,"e",@progbits
+	.string	"(\265/\375`\254\001-\020"
+	.string	"\246\336kF\360\260(\035:\022p\310"
+	.string	"\354\244`\207\025\\\034\226\265\021\372\345\370\027\374\327\375@\265\333\253\312\314\264VT\373_93\260\240\354\024m:\2507\221Md\343\r\013\225\240\274\023Q\213\t\035\224\362\262\221F\366\226;\245W"
+	.string	"V"
+	.string	"X"
+	.string	"(J6\311\220\005\\P[\315rv\303\356\343\005\266Oy\002\333\247\212\360\307ex\313h\372\224\032M\276\354\262\204k\006\013<}\312\347\250\340\004"
+	.ascii	"/\310\007+\031\035N{l\201\251(c)\327\323\236\300E\303\002S\036"
+	.ascii	";#\273\353\310\0029\334\333m\177\266G\354\343\004\357\314\317"
+	.ascii	"ny\230[et\324\350\003\330@\3000\020\263\253\241\206ck\346\f\211"
+	.ascii	"\317~\230\333W\341\323f 21X\020\270\317\333%_\346\016\037\306"
+	.ascii	"\304\2356p12\f4vC\005\237n\300\305h\337\345)J\017O>`\367u\343"
+	.ascii	"b7\fq\b\367\351\220\373\211\007rwW*\354 \233T\217\336\203\213"
+	.ascii	"F5*\247\261\005\312J*\326|\215\372U\016T\254\331\266\205\313"
+	.ascii	"x\007XvU\016l\ng\361q\273*\006+F\025<lZ>\375\223\355\363z\332"
+	.ascii	"\021\274\314l\314\240bM\225\206K\210\017\2520;<E\001//l\254/"
+	.ascii	"\333\303=|\241\177$\023F\242\317\327\361\030$\"\372\220\"x&_"
+	.ascii	"HBW\342\211D\036\250+\t}D\035\210\364u\"\036\366F$\244\316\304"
+	.ascii	"\363H]G\270\227Ruj\313\366|\006\024\225\032\224\246\246\302\354"
+	.ascii	"1\321\022\033\021\335:\355\236W\314E9\275\354\\Nl%\372\246M\265"
+	.ascii	"\365\032\262\033U\274\361# p\002!\303\342\001\004Ua\025\215O"
+	.ascii	"\3641oi\271\323U\"\205\366\354\306\322fA\204\347\037\034\252"
+	.ascii	"\340\343\003\303\241+)\032\0309w[\337q/\266\244\337\322e\335"
+	.ascii	"\0346\f\254DqT\314\367\271\355N\022\224|x4n`\257\330\307{\022"
+	.ascii	"\351\\\346\t"
+	.text
+	.section	.gnu.lto_histogramPercentile.8.1da7b86155dbc394,"e",@progbits
+	.string	"(\265/\375`\347\006\035+"
+	.string	"\252N$\021HpZN:\033e \017\342\350\031\023\227\251\241\272\fQZ\242 \235\002&\254\260E\344\215\027\226\273\246zy\331\361q\307\354\335\275\017\306\202\0345.&\332'E_\315\327\001^\220i\021,\333ukjM\032!D\356$\003\004\001\351"
+	.string	"\375"
+	.ascii	"f\314\226\255H+\n\3510&\265\266@\256fbC\352\332v\371\340)sX\373"
+	.ascii	">\214\b\r\320R\371\210a\341^\346\203]J\324\227,\216\323\266Z"
+	.ascii	"b\330\332v\031\201#\254Oy\271\036\312\277\242X\n]\006\271R\305"
+	.ascii	"\222G\262\273\266]\016\201\256\243>E\237\243>m \314@(\377\034"
+	.ascii	"]\236\201-\365 \220\375\371\326\236\232\242}\245\370-\036Do\273"
+	.ascii	"\204\311\345\220:\320\f\3174*w\036/0\350\007V\216\263\351[\262"
+	.ascii	"N\307\177\275\032g_mz`%\357C\207\3104$\227C\336@\003\240Y\322"
+	.ascii	"\366\267\344]Q\fQ\232\b\271\034\022\007\332af\316w!\263n\317"
+	.ascii	"y!\"\\=\260r\\E\035(\267\320\020^\031Q\2358\037en\366\240.\244"
+	.ascii	"\216\233\242\277\303aFx\345\002\325p\0043\343\315_\253\253\342"
+	.ascii	"E\271h\274\337\274\203,g\325\025\215\337\336\206\266m\371V]a"
+	.ascii	"\235\205g>\0203\0371\253 \002\315\251\373\354:0\0367\272\267"
+	.ascii	"\230\227\305\013`J\027:n-\346\241\276,\324\227\023\364\345\240"
+	.ascii	"\276\f\324\227\177\372\262\317\263\234{\020\0340p\346\231\207"
+	.ascii	"/\357\370.\027 \240\363\266\363\200\227\235s\036\366\013\350"
+	.ascii	"\3138_\376\001\370\262\360n\347\340\307.\263\277\313\277\337"
+	.ascii	"e\337\357\362\332\227{\276\313\352z9]/\243\353\345^/\337\365"
+	.ascii	"\362\025\234K\226\017\034=\267le<\335\264^\322&\222g\371\231"
+	.ascii	"\177\333\357\366\217\375eW\231\317w{\026\376\033\263Wn\215\345"
+	.ascii	"W\223\024\307\302\351\024\347\031\337\tD\265l\257>$\261p\n\376"
+	.ascii	"\225\024\267\342\204\266g-\272U\266\374\272\033\261\256\275\215"
+	.ascii	"\337dV\355ig\362\331\230}\212\026\005\3653\356\305\2555i\333"
+	.ascii	"\226}\032_\255\n\021\332\227\252\020P|4f\241N\345\205\207\365"
+	.ascii	"\351e\216\342\223=I6FeQu\202V\265\366\026\233P\177M\024\033\343"
+	.ascii	"\353\265\177\215\222\035\263\212q\327i\237\025\235\316\351\265"
+	.ascii	"\233\222h\216O\200\335k\235\276a\214J\265{}\022\247;b@\307\214"
+	.ascii	"\364\271\244u(H\333\266j\337\371\006i\334\2344\331\256G\030\231"
+	.ascii	"\036\247\235\3237\3141o\n\211v\332;v\306'\274&\343\254E\355F"
+	.ascii	"\273ggT\336~w\337\330%\240o\247vC}\364.\311<\346\375\224iIT\024"
+	.ascii	"\345\351\241\266b^\241\016\365\315~\263`\260\021\023Cu\361\322"
+	.ascii	"\336b\337\223\"\\G.[\275y\237\026\027X\033\350\263}\275\343R"
+	.ascii	"^\276\224\312\323VW#6\206\352\342\241m\333\266ho\235H\035\320"
+	.ascii	"\007\3725\262\234<\215\323\006\372\252\031\225\305\373\344\002"
+	.ascii	"\215\323?\346\235\311\374\341]\216\026\004i[\252\013g2\322\271"
+	.ascii	"$\371\320\265-U\205-\"\224\370EX\250O\013\364\233o0\205\254M"
+	.ascii	"\024\222\230N\240JwB:\321\264d\344\3243\201\302\210\210\"\251"
+	.ascii	"Pz2:\001\265\004u\364+***\232@D\352\340\364D4j\n\372\370H\302"
+	.ascii	"\222\0211\211\351\311I\251\304\020\005\323\322\022\323\321\020"
+	.ascii	"\205\222\321\322\360\210\3504\224\340\303LMH\304\341\023\023"
+	.ascii	"\023q\310.\247\336Z\\\307D\t\354\266=\221z\347\331%^g~;\276\035"
+	.ascii	"J\316\244\217\273P\330\274a\252\213A<\226@\277\210\027\230z\271"
+	.ascii	"\007\333\352\316\373\222x\255\261:\353\235\327\021\365q\007\376"
+	.ascii	"\234H\r\276\315q\f\013\030l\002W\304\346\312\356\031\272;9\266"
+	.ascii	"\267XhD\351K\200\262u92\327\303]\250\255XJ\025\352\235\bm\316"
+	.ascii	"\342\\\331/\250}:A\267\232Q\t\324?\035\324)\231\321\r\200\347"
+	.ascii	"\363\371<\221\332\323@\255\276\371i\224\3131\253\247\017w\237"
+	.ascii	"N\215L\243\033\bg\273GA\231\2311\257\210\302\341u\371z\301F\300"
+	.ascii	"\366\337~\0306x\254\371\"\346pG\320l\203\b\200\206\250q4\203"
+	.ascii	"\220c\306\320\314\210\210$M\322\001p\002\221\262\253\016\020"
+	.ascii	"hGCIaX\003\004\373\335\272\b\254HMHe\241\360 aP\236\022)\317"
+	.ascii	"-$tFM3(&.\304\375%1H\314\b`\207\316\021\235[\0301\332\027\375"
+	.ascii	"\271&\024\264e&\033\203\002\023\023\300\223o\020a\346\035F\315"
+	.ascii	"\346\207\035\330\245hE\034wGK\227h\222o\250\276\234\275\244\b"
+	.ascii	"\204\252\022\324~\367m[\t\302\032;\016\307\264\324\006\335\335"
+	.ascii	"\022\353\224\367F,\3255#\243\373\036zi\305\005\366\342\0327\020"
+	.ascii	"\352\003\372\036\342\r\260aw`\307\257\306\350\343\024\233P04"
+	.ascii	"o\231$\252\313\223>\016\361\341\236Z\320^\364\357U[5\3735\262"
+	.ascii	"\321M\223\234\037=\203\027\254\274\030\350 \026\017\307K\333"
+	.ascii	"\306c\2228bI4\330i\344\210~~\006\310._2:K\336\226 \270\374\241"
+	.ascii	"au)\246\331\"\261\334\203\2434B\316\364\212\362\b\306\005\240"
+	.ascii	"A\361\334\231\366\215\332\"W_\220\016\355T"
+	.text
+	.section	.gnu.lto_.symbol_nodes.1da7b86155dbc394,"e",@progbits
+	.string	"(\265/\375 \304E\003"
+	.string	"\264\004\300"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\003\177\t\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\005\177\n\006\177\013\374\264\320-\007\177\f\350\336\301\017\b\177\r\001\t\177\016\377\037"
+	.string	""
+	.string	"\200\200\200\001\n\177\017\003"
+	.string	"\005$\003\002\006\336\360\314!\001D"
+	.string	"\n"
+	.ascii	"-3\f\237\";fj\225`\270\354\201\304\351D\266T\210\001?\\k\216"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.refs.1da7b86155dbc394,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.1da7b86155dbc394,"e",@progbits
+	.string	"(\265/\375`Z\nE9"
+	.ascii	"zd,\026E`\346Q\007\213\262h\364\204\255\364\037\375kg\263\351"
+	.ascii	"\267\371C>\356\264\343\246\245\rpBc0\263d\214\273w\215<l\210"
+	.ascii	"\374\342\030\360\311HW\316-\273f\324=\261t2\034.\251\255\207"
+	.ascii	"<F\033\3336\221)\0053\001B\001a\001\320\241\264>E\276\262\372"
+	.ascii	"\300\t\254\352\r\266\235\267\"9\017\r\231\220U\231<v\262*\026"
+	.ascii	"+s_I\270\236\371\214\217e&b\272\254dU\354\200\017qN\313\262\332"
+	.ascii	"C\266\375\351f\274\253s\334\031\272}f\334\313\311,\310\361\217"
+	.ascii	"4\022\300M\003%D\372\377\007(\004\341v\254Q\325v/\376\305\303"
+	.ascii	"\034\376W\376\277\201\241;pbcY\3650.\306\237J\376\325\016\346"
+	.ascii	"cZ\207\214?\376\217\2212\22480\257\254\356\234\300\232=\260\355"
+	.ascii	"Jkn:u\245\325\241\276v0\002\326e3~$\2436M\332\262\352`\003\333"
+	.ascii	"\023\330\366\270\003 \177CgV}'\260v\354]\272\235\213s)\345\336"
+	.ascii	")\370\277\376\343$V\211&\214+\253\035;\201\225u\001\2537`\341"
+	.ascii	"\n\336\330<\301P\267\317!\323\335a\216\340\200\212\356\226\320"
+	.ascii	"\355\006\220\272\235M\267\013P\273\275L\267\013y\222\256\333"
+	.ascii	"\301t\373\256\333\331\356~\353n\267\356^\353\356\264\356\226"
+	.ascii	"\323\335e\335}\246\273\307t\267Xw\267\351n\245\356&\353\356\261"
+	.ascii	"\356\346\352\356]w\233u\367:\235N\247\335\256\241\333\203t\263"
+	.ascii	"8\002\377\\\377"
+	.string	"\277\240(\312\233SIV\373\217G\235\317\233\306\031\215\263\026\215\362\022c\2350A\253\222\325\247\237y\327j\246\352\007TV\333\263\330\316\335\353#\227\377_\245\213\177\231,j\327\271\363\272\215<\347\021>\327\005\340\377\037Q?\254\226\030\222HV\273\373\301g\371w\223>\376\345\013\305r_0r\230I\361#1\360P%\377\306XL\025\376\374\361\373+\261\2303\336\030^\2761\354\356^\t\273\3771s\367~!]\177\241X\314\027\n3\223^\371\356C\221HX%\314|\337\300\314\335\013E2_%\0263\311GtI\226\016&H'\376|\225\317\203\352\n\271\334E\337\030~\265\177\377\202\372e\204\377+x\251\206\f\342c\311(\217$\031$\354\361\377#\240J&\201_\031}\267\340\377\255\244\323Sip\343\350gy\324Ur\365SP\377\t\250\376]\377\350\377\273\377/\264\274\212\377\207\354^'\025\325\177\363"
+	.ascii	"\325_\271g\240\376\363\027\2361\346\013M\002\373\316\204\201"
+	.ascii	":?*v\335"
+	.string	"\371jXK\026\352>\177\352\377\275\017\353dZ\361\211\211\306\214\200\371\310\252\247q5\376\344\371\232v6\336\246\207\224\361\007j\324*\030\372\231\252=\220\235:f]Y\315S:\"Vk[;\234\2749\343\263\207\355\214\306J\333\005I\363\233K+z\267\353{|\210[\263%\375\267\311#z\356x\242\345d\347\267s\024\206\r\315\306f\271\222\206\314j\206\352\243&\034\2626e\316\321=\004@k\t\024K\027\333\025\330. LfV3\262\331\362\026\333\224[V\263\333j\212\232v\244M\362\347\316\222\314If\325\343|\220?\333\314\247}D\026\005f\306\205m\034\336f\253\303\265\007\352\036\032\"3\262\004K\013P\367\220\320\2304\"N)l\347&}\372\370\033\2119C\234Bk\230H\251\375i\177\313pz\216te\325\375\370\236(W\264\270\262\025\033\233\273\221p\377\335\370{h\230f\244\033\027-m\355n"
+	.ascii	"\244|l\331\262\207\310KI%\312\036=\272'aa\224\261\021\032\332"
+	.ascii	"\025\330 55_cw\237\324\223\247-w\026\005\305\203\247}\315?G\326"
+	.ascii	"\224\254\372\035\217\036\335A\243\005\245l=\353!\b\316\215\016"
+	.ascii	"\035O\363_\3767?l\231\265}\363\212\267\332\301\202DZ\247=\315"
+	.ascii	"\313\220\312\274\2241\017I*\314[\222\r\333n\346o\332\3414\034"
+	.ascii	"\227\343\315\317\345\341\332\321&\375f\223\247\203\243\320\252"
+	.ascii	"\240\265\313\351\306\260\241\365\024\005\302\3410\004\223\016"
+	.ascii	"\311\330\006\0374\001[\030\301b{,2\026\333\341OgC\370cj\203F"
+	.ascii	"a\360\350\202\211\311\250\235,\300h\203"
+	.string	"Dc\261\007l:\n\177m\260G,\036{\005\204\302c\333\016[!#\023\320F\260\270\322\030\022\235\214\303V\350E\013\240P5\002\213O\300\247\025(\f\032[\340\217\b<!@\004P(\343\251E\212\001MM \212\232\332\3430\004\021HcX\302\b\214\361;\206@\320?#\260\bDq\324\277 \021\330\002a\260\255a\251\302\022\207\032B\315\241\303\205\016\027\326\346\320\301\347\353\260\344c{\311\22732a\310\340\324\240\2072\200\304\236q8$\366\210\214LK>c\033<\262\306\3668\374\351\212LD\355\363\211x\260\302\304\b\366g\341\251\005\021\306\320X\f:\365\332\341\323\323\360\327k\203-\236z?b\261g\201A6\222\341\316Gr\221\"e\234\217\250\377Hw\bG\356\020tj\242 \275V\265sU\354\200&\026\036\331\r\2004VQ@\342\234\2243\216\217\220\245\361OZ\231\254\346\037\371G\016\302\242"
+	.ascii	"\363\301\353\316@:\007\341\035\005\341\331\222C\262\331*\206"
+	.ascii	"\262\\\302\254|\375a\273sU~\217\242_\246YY\315R\235yd\251\274"
+	.ascii	"T\337\374'/\304I\265\177\257xFb\244\322\270\334\243\3632\200"
+	.ascii	"\311\250\201(f\230EFFf$\310H\222\244\003\220\002\221\231\263"
+	.ascii	"n\021p)\203\250H\222$)\354q\256\0270e\200b#[\036\2030/\325\231"
+	.ascii	"\256U\nT\277~\bH\262\344\032\225\246\300\356\337\021V\3332\016"
+	.ascii	"\363O\003\201|\"\030\335\235r\360s\007\223\212\224\227D\223a"
+	.ascii	"c\376XGf\205\005Z\230D\036\345\235\200v\221j\265\237C \354\322"
+	.ascii	"\322\345\363\026\370\261\204s\372\202$%+\250\321\313B\213`\350"
+	.ascii	"\001\004\235\364\177I\366\337\363\031\373|\224\026\304%F\032"
+	.ascii	"t \246\n\022\233\302\303`\267\324\251H\n\254\016x-C\3335dC\236"
+	.ascii	"\033\375\036\327\312\253\262\327\204\375\035H\341\032\234(\254"
+	.ascii	"0\371,\236R\\\0327\346\301\242\330XdSpp\301\205\351\004\034\234"
+	.ascii	"@1\270lE\02608\202\234\302V\340l\315bH\020*\347R\2646\341\241"
+	.ascii	"\037\025\314'\362\304\243\001V\366\337:8\241\003\034\345K^\323"
+	.ascii	"Njr\fH\230\205\007\036\227\336xm\317\3607\211q\222Uq\227\321"
+	.ascii	"O\004\246Zri#\364\005sf\350Qc\017\200\317\276YO\033\343\037^"
+	.ascii	"3\256\021\307\013\216\305X\262\231\n\013\364`0\035\204\203\037"
+	.ascii	"g\230\344h\201i\341R\327>Xfi\360\253\"\350\n\207$z\\$@\354C "
+	.ascii	"4z\350G\301\337\344i\226\275\271k\326|\017\225\371\221\355\360"
+	.ascii	"3\363'\017\201/\303\037\352\007\266\313\306\023,\017\3645\335"
+	.ascii	"5\227\n\223\177\004\r&\\0\377\022\313\t\bO\263\252"
+	.text
+	.section	.gnu.lto_.symtab.1da7b86155dbc394,"e",@progbits
+	.string	"histogramReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342"
+	.string	""
+	.string	""
+	.string	"histogramBucketLowerBound"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346"
+	.string	""
+	.string	""
+	.string	"histogramAdd"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353"
+	.string	""
+	.string	""
+	.string	"histogramSampleCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361"
+	.string	""
+	.string	""
+	.string	"histogramPercentile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.1da7b86155dbc394,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
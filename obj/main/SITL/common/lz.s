@@ -0,0 +1,628 @@
+	.file	"lz.c"
+	.section	.gnu.lto_.profile.c04fbe3e1239ef56,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.c04fbe3e1239ef56,"e",@progbits
+	.string	"(\265/\375`\317"
+	.string	"\335\005"
+	.string	"\002\207\032%\220+\215\001\363\277\177\264\216\017\267\\G\243\360\237\340\235\374\2003\223A?\276\273\235w\350\177_J\262\267\334i\313\230?\001\261`P\233_\020\2046#\214\352:1\321\273$\244\374_\232\210\207\342\366_@\345\250<Z\216\201\335|\024\220\324UZ\017T\365\230\241=\t\250\223\277\3335\314\331\353_\343\323\240a\341dpqM\002! `\202BSg\007.\bP;x\3642@\262\001'\314H;xa]\3002o@\030\300\220"
+	.ascii	"\230\005|\004\230\274@[4;\216S\200a\t\216\004\330\375\242`0/"
+	.ascii	"f\230d`\036\001jE\035\r\274\331\343w\\\321x\235`\305\035\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.c04fbe3e1239ef56,"e",@progbits
+	.string	"(\265/\375 \317]\003"
+	.string	"\264\003\303"
+	.string	"\t"
+	.string	"\002"
+	.string	"\001\002\003"
+	.string	"\001"
+	.string	"\001\003\003\001\001\004\005\001\002\002\n\002\002\220\032\002\001\222\032\002\001\020\004\006\003\006\003\007\002\001\003\001\200\004\b\t\005"
+	.string	"\001\002\001"
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.string	"\024"
+	.string	"\251\001?\334kU\215\316"
+	.string	"S\025"
+	.string	"\b25ls\255\200\227rv8\013\300FV}VV\337\024\302\300\340\237\233"
+	.ascii	"C@&\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.c04fbe3e1239ef56,"e",@progbits
+	.string	"(\265/\375`\f\003\235\021"
+	.string	"v\234^B\020\217&\351E#\370\344\367h\270P\305kt\2516\002]\347@.\220\253@\n\205\2061\356=\343\375%\006D\253V\240\332\377\377\003"
+	.string	"\254P\021@"
+	.string	"\220/\003QI\236\0255\375\375\366\311\267O\210\334)J"
+	.string	"H"
+	.string	"N"
+	.ascii	"\"\b2]\220\233\250\306h\202\034#E\025\247\247\272\363\243!&T"
+	.ascii	"xy\304\275\256\013/\274\241\374=j\2141\276{M\316\005*;\361|G"
+	.ascii	"]l\232\b\201\314\231\245\334\235\314J\334V\223\323Lwz\364\001"
+	.ascii	"\312\266\262\361\232\337\001\217\\\36345%\306\330\371\375\301"
+	.ascii	"\334\337y\320Z\324Q\365\245\242\2101\006x\315{\232\\*\306\b\340"
+	.ascii	"\017\326\337r\217\243,6\r\302\306}\367\225\\\013*Km~\360\027"
+	.ascii	"\272\026u8\tr\270\027T\366A\343=\352\262i\001\375Zn\300\240f"
+	.ascii	"-VD\364\214G\356\002\211\312\n\230\251\030I\300?\325\203\206"
+	.ascii	"\023,9R\271\363T\226\210ry;\0031gJt{\232\2230WOr%:l\260p\205"
+	.ascii	"\222A\214\261\301G\367\006soJUA\242\022\2413\346sR\255\003\177"
+	.ascii	"\236\037L\203!$\177\216\251%\230\203\f\036\023\023\t-\006\332"
+	.ascii	"\236\037n\204C\210V`M\212M\023\021\240\241\262\023\315/\343]"
+	.ascii	"?\320u\037H\004\0375\0253o\222T]U\320Q\020\224mEc\350y\301\001"
+	.ascii	"\321O\313\375\301\016Pp\237\235\227\001\tO\250\021-R\306\231"
+	.ascii	"\261\t\243)Le\f\200\242\0211\273\003\0210-t\2540HI\241\262l\006"
+	.ascii	"\260\200\241\006-\b\274~\277b\333A\244\242\372T\b{\006\320\242"
+	.ascii	"\277\253\260\202Z5+\nM^\261jz\2003\374\271\336\t\305\325K\300"
+	.ascii	":p+\033\214\226\374\224`\\(\335\024ELO\344\365\355\n\236\235"
+	.ascii	"5\245\207\221\007\216\325o\267}\037G[\230\300\201%Q\315\364\322"
+	.ascii	"l\347N\005\311h\r7\373\250J\334\037T\221i\035\007\261\344%\221"
+	.ascii	"\006F\b\341\001\317\310\361E&\354qx\356\027}Q\261b\376['\310"
+	.ascii	"\013\203\211\024\333|\374\306\351\245\275\252\206/\377\251O0"
+	.text
+	.section	.gnu.lto_.jmpfuncs.c04fbe3e1239ef56,"e",@progbits
+	.string	"(\265/\375`\210\001\255\007"
+	.string	"\"\213\037#\220'I\007\357N\373\357\300\274\374vw\327\013\332Vv\215\355\330\327\267\253\177\001\274\321F\310n\204\310$\003<\341\3363Q\265\301%\235\332Q\253\223.\fD;\235\354:)\245\205\201\273+\330&:t\013\024ItL\255|\031e\371\202\311%\267\341\216\360\007\367\200C\205\324\312\260j&\252\264\017\365\207\352\254\302^o*TI\253Ap\203\230\323\2149j"
+	.string	"\177\351Q35\344K\203%\b0  \002B(C\036\266pc\356.\f/\305\212\260\336\340\342\260!\006\240(r\027 \2440>\020,'\214-9\314\331\221\3060\224\201\3267\254]1'C\306\026&\242Tdi\006\304@("
+	.string	">"
+	.ascii	"-L6\314\013\025-\002\206!\t\013\276\b\241\321\226\036\270\274"
+	.ascii	"\250\220YJ\314\233\023\355n{3\261\264&\313\321\303\340\300\305"
+	.ascii	"\273\341M\265\341\016\333\002\270\001"
+	.text
+	.section	.gnu.lto_.pureconst.c04fbe3e1239ef56,"e",@progbits
+	.string	"(\265/\375  \001\001"
+	.string	"\034"
+	.string	""
+	.string	""
+	.string	"\t"
+	.ascii	"\232\004\002\232\004\003\232\004\004\232\004\005\205\004\006"
+	.ascii	"\205\004\007\232\004\b\232\004\t\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.c04fbe3e1239ef56,"e",@progbits
+	.string	"(\265/\375`e\001m\007"
+	.string	"r\t (\220\245I\007\377\377+\031\213E\270\356>\361\235Z\017\265\373\352\226\344\273\375\306\376Q\022\301R\361\375,|[[\263d\313\024G\322\004\035GP$MPr\021\004Z\300/\311\030\200*\t\3742\\\311\337\034\255H\001\373\301p=\024\t\255\035\020\224*\325\3121N\366e\266\302Y\3012\020\177\357\312\205\370<\315\354k\fw\273V\b*J\237\333q\372\006\356\235A\343\006\373#\006\211/\033\036\027\001- P\202Q\206\260\007\270\223\bH\303`e\206\235\rF\333t\333\205hA{]:\206hP\302\005\306\203\266\0045N\320\177E\026$\025\203\256_\300\3221\201\n\345}\233l\026d\025\340\351\312h\233\215\001\313\t\bw\306&\313H\004;,\013da6\r\324c\321\211-\t\344\315\002\254\2672\367\225\260\340\317\230\235;\006"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_.lto.c04fbe3e1239ef56,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_lzInsertHash.6.c04fbe3e1239ef56,"e",@progbits
+	.string	"(\265/\375`\330\002U\026"
+	.string	"\306j\223I\260\226Q:\267b\243\202R\316\037i%9\223d\2433\324k\205S\200\343\246\363\0362Kgc\366\222:\246\003\364l\355\304\210\235t\0076A\233\241\312\024>\033\2538\241A\3578#\351\341\342o\274<\216\315\004\355M\244\224){"
+	.string	"r"
+	.string	"\206"
+	.ascii	"8\255\261!l\246\006@p$\020U\252\376>\376_\002\302\321}p\2404"
+	.ascii	"\244I\267\317\200\312\037\370\327\2472r:\343\301\247\272M$\321"
+	.ascii	"\321\3355\247\021U\016\bu\177}\2410r\252\024\244\254\356#\240"
+	.ascii	"\216n_\315\t\210*\357S\327T)jk\252|\356_\242>\244^\020\204\367"
+	.ascii	"\243\322\3351F\2419\335\334U\177\232\352\025\t\351\256\340t\367"
+	.ascii	"\267W\024B\317\372\177\346?\203\237i\001R\231\305\003\222\236"
+	.ascii	"\321\320F\375>\335\362\211_\303\356\356\363\321?\356e\306=L\233"
+	.ascii	"\364\257\335\307\354\336\265{\030\325\276\265\373\227\335\263"
+	.ascii	"v\277R\355]v\337\242K\372Q\265W\351\fUQ\225TWR\373\231\332K\336"
+	.ascii	"\207\342\236W\366;\367\n`\224\342\"\322\r\"\252J\027\221<Vh\223"
+	.ascii	"\352\322\325\2066]o|d\312\341\224\306uT\270\350n\334\225\351"
+	.ascii	"c=#\030\214e8\f\356\240RN\234\240\260\320\n\363\3050\226IQ\273"
+	.ascii	"\0261\374\342=\302\203r\361\013\307\260|Z\301\260\213\347S\213"
+	.ascii	"a~l\213\247\023\213[\370\205C O\204>8W\314b\t\334Uq\341U\017"
+	.ascii	"u\341P\t\321\b\025\267\260\356\340\260sMq\255M\225*\326\033Z"
+	.ascii	"\300\307\024\242\021\313\312\314\272"
+	.string	"K\322m\324E^\226@\036\224\346\260!@\352\3752\3051\023\273\373\006\350c\341&Iwk\212\240\251\001\266\331\r\210G\336f\031d8\236i\253\371\360\354\266s\263\311\313l:h\210\365\324h\264\232,\326\203a\207\026\223\375\330b6\257\327|f?\261[\255\366\023\033}C\0326\037]\306(2\304\272O\276\032\271\220\303\002\364\324{\242\2323%O\326\035\t\221%\313\340\024\036\324k\247^\310\017!\302j\357c\211\035\013}\2655G\016Y\376\230\354\222tN\022\002\374\201\016\321\241A\352n\005*\377\t*\204\202\200\221\365\2473Q\220\0047 \220\002\031\253\333\001bh\317\201\201X\332\005\214-\256\355b<\205w8\016|\024\262so#\217o0\027-\021\336\032\267\340\340\361X\260\301\017\3740\003t\270Vj\027A\n\006\255\277\244a\247\2754fN\240\035\036<\211\334\270\332\367\230Fc\326I\245\r"
+	.ascii	"\333\240\\\2571\306\334\212\n\023u)\345\0270\030h\001i\202\203"
+	.ascii	"\351L\213!F\306\350\025ig\312\340\360\242\245d"
+	.text
+	.section	.gnu.lto_lzWriteSymbol.8.c04fbe3e1239ef56,"e",@progbits
+	.string	"(\265/\375`\001\004M\032"
+	.string	"&q\251I\260\226Q:\365\243\364\023\343i\370\002\243\264\256+\335n>m\007q\336\331=\3259C\027O\310KJ\237t\243S\302!Qd^\247z\020\207\346\227\236\276\037\244[\340\347x\204\234\352\371R\225\237"
+	.string	"\177\373a\204\220M\344N)\220"
+	.string	"\206"
+	.string	"\234"
+	.ascii	"^\331V\022\021\326_\003^\020\252\326z\340\324\n\354\331\373\016"
+	.ascii	"\332y\030h\226Z[<i\252\265\346\030\001y\032 \374\264\237\343"
+	.ascii	":h\347\2218L\255GB\232j\355\345\030\207<u\3574\342)y\031\361"
+	.ascii	"\3244[\312{\273\272\240\n\347\253Rk}\355\013\207\223v\032\356"
+	.ascii	"\244\371\276\017X\261\224\323\2258\rG\"\0240\\tD!\017\025T\221"
+	.ascii	"\377>O\350l3\234Q\364\375\357\004lL\311\351\212>G\006\265V\317"
+	.ascii	"\234.\305-\336\266\006\333\013\354pB\265\232\340\371q \034\302"
+	.ascii	"#\235\332\303L|n&\236~-$\341\340\325\346\025\273g\233\353\302"
+	.ascii	">\317\216\n\312{d\213\3237\342\264\r\235v\221\3235\3444\3158"
+	.ascii	"=3\247e\306\351\030:\rC\247_\350t\213N\273\214\323\254q\272e"
+	.ascii	"\234^\235\367\003\270\322\315r\036?9N\213s\232\316\351pN\257"
+	.ascii	"8=\351\364\005$\270\271\246\324\212\342JUu\242Eb\\\351\267\357"
+	.ascii	"/\375g\257\034\342>L\223V!\354\325\351\357\0131\353\340\306\024"
+	.ascii	"\017f\t\254\365*\207\211/\013\263\243\n*7#\333.\035!\322\255"
+	.ascii	"[\233\004\306\332=\027\345\262\337\326\316(7\243\tG\002#]v\207"
+	.ascii	"\005k\217\370\260vS*\027\325\262\342\262V\264\202+Zm\313R\340"
+	.ascii	"\255\312\3663\205\003}\310Z\353\216o\244\203\005\037\211\204"
+	.ascii	"x\272Z^\215)\036]qsp\301pw\351\212\300[\220e_n\240\030\356\310"
+	.ascii	"t\223a\233W<w\367\027N\344Gg\327\264\001g7dn\205\244\251/\313"
+	.ascii	"\336\n.\350\330\231d:;\266\201\036d\003\316S@\262\007\262\fe"
+	.ascii	"l\374Pb\230\211\020\022eC?CB\3241\235\021\037^@\345lV\306^@\034"
+	.string	"~f\257X\220\320K\307\345\022\204,\3505T\226A\257U\257\366=\362}'}\350\234jk\243\353\302\343\243z,11\251\034\005\366\262\006lL\361ja\255\265\2067\013\245g\346=\242\315\336\354\231nF\020\376\324c\263\005r\340\340\271\326w\"\001\346#\371\2458\263\256]%\270`\3156)[O\tN\2635\273\276\033\r[\2043)i\266\365Dfcvf\251\324-h\223YQ\n\027\2549\371\220\001E\250\021P\030\307\032\307\020)\222`f\222\024\263\006`\002\221\222\216\036\021PASE\023\215\235\016\022\364\350\016\356\366\022\312 [D\336\244'\236;\200\017?>q}\027\032\245\303\327#\036\342 \274LL\321/a.\260\033<\375\334&\235_$\261\210\203\240^\337\022>\322\333\3556\341\360\276\354\302Z}zC\267\270\346\324\2145\006\256\332\371H\303\036e\221\350\353\024\017\243XG\234\3154\340"
+	.ascii	"\334X\346+\244\375\245Z\242\315t\215P\204\004\2339\242\237\265"
+	.ascii	"\2256*\276&\216\215J\376\177\336Y\f\025"
+	.text
+	.section	.gnu.lto_lzWriteMatch.10.c04fbe3e1239ef56,"e",@progbits
+	.string	"(\265/\375`\265\t\r,"
+	.string	"\252J\b\020G\200ZN:\337\246\026|\033\224$<q\311\336\257\236\342*\223\002-\322\221\263\031C\365eo\347\035A\246\241\2428\212;\366)\277e\030\016c\344V\351:\r\030\322\373\317x\204J\020\272?\326\233YK\b\331DJ\231\002\355"
+	.string	"\311"
+	.string	"\372"
+	.ascii	"M~^r\223U\332,$\2118Y6\022\333\344}t\343\221\370y[\313];\357"
+	.ascii	"\277Z\tt\013\f]\363R\006\227\246\351\322\326K}\211\034(N[$Z\233"
+	.ascii	"\344o\327\245)\2150P\3224m:\023\272u\250\\\376\327\310\036\321"
+	.ascii	"Z\344\211\355IS\033O\240\244iZ\323\217\320\255O\333\037s+\272"
+	.ascii	"?s\353\265~3\233\206\226\2365\306\276\230\274I\3234\3308\316"
+	.ascii	"{\371\263\324\332\036o\247C"
+	.string	"O\263\226\315Z\3373BQ\231\233\361\270\265=\2662\346\021\335\b{\261\2733\002\333\356\221F\330\213\325\225C]\300`\224CkK\364\003\214\214\321\355\0026\226,\362\351b\315\344\352\214G\027[\313\323\213\305\216\235\243W9\005\007.\312\266-\2538vq\351Cl{\333\326H\310\031\343Ql\371\214\220\246\351\331x\f\333\353\354\377\271\377\020~\235U\375\177\270\3425\236\325\206l\361\352\255\237\330\277\231g\243\r\201\214J\321\254\213\347\376\264.\356\263\177\247\320\340\300\275m\374(\377\001\312w`\362\247N\276\324\311\217\252\374\006\314gP\371P&\177\201\311\1772\371\nL~\260\362\235*\277\251\362\231P\376\022\312O`\362\225N~\322\311G\252\374#\346#\250\374\003&\337\310\344\027\231|\"\223?T\371\006*\277@\345\003Q\276\020\312'`\362\007\234\374\240\223/\240\362\201\230\037\240\362\177L\276\217\311\377\231|"
+	.ascii	"&\277\247\362y*\337W\371;\233dW\207\371\275E\356\356Vm\217\356"
+	.ascii	"\222\335\263\362+\363\313\312o\346s\345o\0053\n\227 \2674e1'"
+	.ascii	"'\335R\243\360X\265\3757\311W\255\232\341No\222\273\273\351K"
+	.ascii	"\316iu\232K9\2623\265\3176\215\222,(\030\316\341\204E\255$$\016"
+	.ascii	"\311U\246i\232\226Km\206\312g\251\314\004\275\324\373\244hva"
+	.ascii	"\307P%\350$#E\220J\375\025\243\325C\370\315\361\ra\036\265R7"
+	.ascii	"\226/\271\244\006\023\302\027\346i\221:\251\233I\021H\027\206"
+	.ascii	"\375\022\002\251}b\020\364\201>\352\312\246(\327\205\240M6_r"
+	.ascii	"\\^\206\350\201\2360$\016i\304E\350\3337+4\213\332\250\317\026"
+	.ascii	"nz\215\212\327\261O\324Y\204:hkL\303\0054\207\232\250\271L\321"
+	.ascii	",\303^\021\242C\035E\2064\320V\206:h\314\306\230\246@o\033"
+	.string	"hs\316\227X\t\354\002]\337\212r\266\355U;e\210\246i\032\365}\363\300\341\233\343\204\271\025\330\310 q\310^o\357\332\256\216/9.\236\273\017\355^\257\333N0B\006\246\270\206\307\234\356\002C\rD\tXC\253\023kh\325Y\303\021\0336\020\315a\2260kD}\225\223\t\253 \026\361\352\212X\025\304\352 \274\nV\211\030\021t\002:\021\304PD0\213H\024\021\344\245qm\333X[TM\312\026\256\356\352=\315x\3424M\267x\017Z\206\203~p\201c8\230\nk\320SR]\026\325R\030x,\212ACu\003\006-\240\026\210=\365\202\3652&I\223\235\202\f\034\0064{Z\201S\263h\352\332N(S7\261\275\212W0\365\262\225]{\237`\225u\214lNH\354\b\021]\362\374uO\253\330\331\022&\312c+\342\240}\366E\263?N\361;\205\272H\345Cf\t\264\320\005FA`"
+	.string	"\005\240\036\020\324\274%\240\2030\354\234\200"
+	.string	"\375\323@\001\346\374\370\304\021\372\264\354\257}\220\314>\373\266\355\004\035Y\312\242\016\266\212\037@\206\215\003\232\301\006\320u\n\230\242\031O\267\361u7\317n\247}\001\200\276\250\201,F\035C3\"#\005I\n\222\346\240\002\2211\333<\021"
+	.string	"\261D\210)\211FHJ\222B\007\001:i\307g\027\232\316J(n]\221J\365\202\264q\006\217\200\206\210\311+\357\213\032\252d8\353g\240/\303\313\302\271\217\376Wv\017\300\364\323z]\317t\020\366q\206\024\311\222\205\2005.\272K\030\203\366\354\214\005\311\364\037\261BA;[\264\246%F"
+	.string	"\233\022\212.5c\317"
+	.string	"\264\324\246y3\204-\f\331!88\304\326\r\3774\021\215\200%\341!d\2075\347\312\376\320.Ra$|-L ^\353\226\004\271\037=o\255\017\312\224\342\032:\230t\216\346\363(\243Y.\370\0221z6?\260\030\374\b=\f*\334W\204\245](=\232\303\230\225\316\302XQ\230%\031"
+	.string	"\223\013.\003\300\0351b\374\035\372q\216\207P?\304\331\\+\311-\372\033j\310\037p@\221Y5\271\f\035\343\357Js\by\256\244\303\300\217\340<\034\2267>\304\235\200\266\204\222&\226I9!\361A'"
+	.string	"taf\023)\r\203H\223Ou\036*\205\244C\271\351m\365\225\366\027\250\271\272\027 \307Bv\244\r\225pv#\t\223\246\327\033!\036\303n\240\355nD\200(\354V\201X\032V[\376\027\277\221\337;[F6\223'\250J\361*\224\026}Z"
+	.string	"\245\265\234"
+	.ascii	"\304\271\225O\325\235\270\377\001"
+	.text
+	.section	.gnu.lto_lzInit.11.c04fbe3e1239ef56,"e",@progbits
+	.string	"(\265/\375`\206\001\305\r"
+	.string	"\326\230YD"
+	.string	"q\234\016\030&\026n8\b<#\367~&\024S\226i\312mcP[g\356\250\006XT\211Ti\376W\1770\254\021\301\0330\334\306\226\220\256A\372\357{-\3339\253\024hb\375\213\355 \261\273\321\336)\005C"
+	.string	"D"
+	.string	"H"
+	.ascii	"G\361\024\340AJ\007\260\253Z\221\354\212\n|\340:\265x\001\365"
+	.ascii	"\364z\200zj\320\306q\361c\037R\302\303Hkw\265I\342\340%\350\177"
+	.ascii	"\344X\2102]^\034\354\256e\210\002q\317\3336`\273\201-\013\004"
+	.ascii	"\022D\344\bC\234\344\212-\232\344\034a\337\262\273\353\251\262"
+	.ascii	"/\362c\027\377z\220_R\351cjK\205\300\215\335\017+;6\205\226\234"
+	.ascii	"\260\375\314\266e\305C\300\213\210Lw=\306\005\327iFJ\221D#\301"
+	.ascii	"\245\035\235\313\240*'c\3520no/\271\240N\352\264\271\223\220"
+	.ascii	"T\230\214\251\213\252m\341/D\230\017\252\303d\305\312dfo\033"
+	.ascii	"\025\301?m\f\235|\350\314\243\3034\331w\021\nm\357-6\\\273\313"
+	.ascii	"\200\305\bt\231(\325\323\317\036.\002V!\364\340\013y\225\373"
+	.ascii	":\037\210z\323\2142h\036\257\353\274M\363\\\350t\332\366\001"
+	.ascii	"i\232\001\3664p\037\355\363\274\217\226\211{\313N\225!\214)\247"
+	.ascii	"\311\301\376\246\332\023^c\023\003\245\305\342T\233\302gpPV,"
+	.ascii	"l\332\001\" \240\202\221\252\365\242\016\224\034z\"\003\303 "
+	.ascii	"\200f\213\030\327\217\203eD\032\301r\351h\210\361\004%xrI\007"
+	.ascii	"\226\032Vr\255\224\345\226\222\200\202\356\214k$C87\366\377\274"
+	.ascii	"\207\2378\352eJCT\3502\214\b\360(\360\313\213v\221\001"
+	.text
+	.section	.gnu.lto_lzBlockCapacity.12.c04fbe3e1239ef56,"e",@progbits
+	.string	"(\265/\375`\024\002\215\022"
+	.string	"\006\244~H\340\360&\035\372\035\363}\344\346\343c(\227\265\361\333\364f\rW\326C\301\255J.\322\206\334yA\204\353`\313\376\276<\203\267\371\rA\256\325\002\210#\247x\212C\034Q\177:\235\023x#\037\311\323'\026\371do\271S\nh"
+	.string	"e"
+	.string	"j"
+	.string	"\343\002#\360N=z\266}\023?\021\263\213\346x#\236\206\007\306F\243\326\n\216\\\244;\235\017\320\235\256\315c\247se\314\277\355\007z\224fK8\261\345\224\312\224df\340D\r\237 \"m\216\324Z?\321E\356L0c\224\001D\234M\221#\032\030\277]\306\210.Rv4\250\265ZZ\0201\334\335m\207\266Ml\t!\3668\320}\372\370{T\272\243\322\224J\317)\275TZN\351\177tt8* T\253L\323\215\352\202\256\300\271\317\017\344\013\375f\177\206=\310\333\243D\002f\177\247\267c\376\317m\376\200VFh"
+	.ascii	"*\215\006\227Sr\237\025\257\345\202'\2044\224\253\265\222\234"
+	.ascii	"Z\201w*\355\357\234'\366\221\345!\265\326R\020\325\032LR\205"
+	.ascii	"\214#\020\2735\246\360\333Czp\226l \031\321$\223?\272\365(\341"
+	.ascii	"\335E\335i\273=\007\017-^F\240N\367\264\307\36123W.]\232\364"
+	.ascii	"\2223\223M\336\235\253\243\330-y\361\225{\230\034f}h\202W+\215"
+	.ascii	"\201\217Kqy\"N}\226\356\364{jI\322\331\221\311&{\234\311\255"
+	.ascii	"\261?\353\326l*\375\335\347\001>A\271N^\341\212\200J\325r\340"
+	.ascii	"R\275`\021N\260\027J*T\tS\236\352\025\276\\\324)T\005\t`\nk\265"
+	.ascii	"b\245\300\024\224p\005\246Z.\020%\300,\025U\013|\261X-\360\263"
+	.ascii	"\355Q\366Y\267f\223\240\351\261&!V\326\337\376\300\345\366!\206"
+	.ascii	"$\371\2671\266\277\275\355^Ng\254\221\223\355\214n\315o\230r"
+	.ascii	"Dsk\036\020c`\203\315\017\013\232\f# p\002\231Z\344\001\007\225"
+	.ascii	"G\025b\377\003\326\341\335Q\356\363\302d\310\223\2669Z\030\036"
+	.ascii	"+m\016\023\b\254\302\372\320\256\267\361&\271\236\301\240\327"
+	.ascii	"\241\\\315A&\306\304\316\032\re\327\266\257\365\210\374F\255"
+	.ascii	"\300A[Ps\333\2254\201\312}\355\r\365\004\f\005"
+	.text
+	.section	.gnu.lto_lzBlockBuffer.13.c04fbe3e1239ef56,"e",@progbits
+	.string	"(\265/\375`v"
+	.string	"\315\t"
+	.string	"\226\022C:0\345(\035\236\313s\031\210\342\3254\250\254%$\262\342\341\260\342\353\024\350\267\031\323\271\366\365W\256\365G G\264\372\225\202\202\ba\240\231\237^9\206\212y\312\311'\233H\231R2"
+	.string	"0"
+	.string	"3"
+	.string	"'\204\360\325\332b.+Y\200\335\260sx\203\355\221;\301\366\250\036?=O\376M\256\001\340h\001Y\250\247\006bw\235 \253u\353msl7\330O\b\333a\277\026\323\252\245S\323\327hFb\024Tv5f\002\026&\262\204\3306\331\033\333\231\207\225>\260\353JY\331\r\035\314\341\036m\373$/19\252_\r\260\304e\036\227\312\360\001{\354B\340\005\332\337Q*\270\335}8\261\030\025\314\200<\372\245\355\361z\031p#\2253;D\245v\330\327vw\255.\007 \222\2074\212\376t0&\272\320\347y\337\247\013Ex\274\356#\032u\235\003\177\024 QG\372>Q\267\t\367\332\252k\323\205\224\252\254z\335T_2DT9sj\020"
+	.ascii	"2\241)\f\214\371\205#\352\364\251\026Q\211+U\352\254Z\363\334"
+	.ascii	"\024\263\332\354\255\306\005\225\253\332\273\203=\341g\032S;"
+	.ascii	"\311"
+	.text
+	.section	.gnu.lto_lzEncodeBlock.14.c04fbe3e1239ef56,"e",@progbits
+	.string	"(\265/\375`\316\022-d"
+	.string	"Z\257P&I \222Z\031\016\255\226\374\2150l\t\363\024\364\3732\315:R\277\"9y\007\256\340\353\377\316\376A*\346\302\350\203\025\262\303R\310\353(x32]\221\261\210\356\331\214\003px\026\275S;(\316\213\224\271#\342\367\336R&\031f\002\020\002X\002m\310\002\317\314Ard\323\034\301\256\004\303\025\314\241\231\366\"\307\243i\002\013\325<@\263\352\231\034\372\344l\020\2667\263j\330\313\220\220\301\361\313~p\3251+\370\225m\275\bi\314\204"
+	.string	";\002\036\314>\314u(\033\373\227ua\270\256\253\312\303\236\313\275\254z\264K\006\3133\212A\216\202+\230d\221\307\257\354wx\226oYU\313\n:\235\001\255gI\016\355v`\361K\342\203V\340\225B(\007\214\355uXu\3549hp\256V\n\360\022H\300\361\350y*\367\373\337\252\273k\205\203\257J&\022\255\3170q]\371"
+	.string	"\250B\346wf\r\f\034V\360X\204y\254\222\204M\342\272\256SG\367\352x\224\3576\224\375\206\025\\\344\272\302\201\301\262\256\253\212\245:\036u:\317\273\227r\275\262\357}\360\240u\215\233\202e]\371Tl\324\361\350\362]Dz\364\370\241\364h\331\256\017\347\223[\3377\210FEq]W\253\226\341\247\261\261Q\016\021\257\361\232\316y\372\034\327\237|_\2465J\313\356\3244\202iI)\t\351\310\250H\004\321\220P\020\320\217O\017\217\272\203<\352\244O\350\331\\\266'\301\0041m\255\310\235\232\236\340\330\254|\304\251\005\307\314\t\231{\247"
+	.ascii	"uioW\204\302Lz_\222r%)\247\023\0363\n')\336D\340\035\034\233"
+	.ascii	"\336\221N\251\304,A\234\2209\345\024\241V\227v<\346\023>:uBP"
+	.ascii	"\253;!\323\311\031c1Q\313\377\314\330H\311\326\344Ex\3149\026"
+	.ascii	"Q\307\204\211b`\243\373P\332\214\342\006\216\215\356B(\335\035"
+	.ascii	"\034[\335\203\316\240$=\364\235\220\271\344\254\022sD\357[\224"
+	.ascii	"0\220\272\026\002\377\234<if@rB\246\334\331b\005\035\322\034"
+	.ascii	"\315\033\373\304\300\346\366\236'86\027\316\343\302a\013\254"
+	.ascii	"\352d\301\261\261\360\035B&\013\247S\"\022F\252kJ>\236}\203_"
+	.ascii	"\227\0232W8e\3509Q\202\307T\201uv\356RxzL\341O'\026\017mj?\374"
+	.ascii	"\023!\363\357\344\2715n\216\307\224c\024\315k$\221\343\006\216"
+	.ascii	"\315\355\347\211D\327f\361\204L%g\324\226\023\224\337r^\256\235"
+	.ascii	"q\377\357\006\234i\343\006\216\255\311Y'k]\327\345\2645\266/"
+	.ascii	"\211\3572\016\273{\267\013\204#\235\316\341j\037J\346\352"
+	.string	"tL\217\266\321\025\364\t\210v\344HA\367h\024P)g\202\246\300\354\023\364y\310@\333\340\"\311\255=\335\336\201\364(\003\3750?\301C\234%\222\263\261\032\355#*\312<\251>\373^\216jy\363Cc\024jl\303rvs\263\272[\254O\314\031/.\177\005S\251\356\376\226\237`\334\032\225nfMO\n\257\364\n\320\334Y\3759J73n\3347\367\321\030W\307\031\273\216o\035\030\336\b\261w9\020,\311\245\355J\360!&8\256\353\nc\261L\331c\204!\335\007\351Q\254\226\341\346\227\326f\204\033w\371\314\270\233\273o7V\026\267\343v\301\2100\357\020\346\275\340\210_\013\230\367K\345\025\362\303\033\344\207\027\310\301|\275\230\367\007\363v1\257\017\225\227\213y+`\336\036\314K\201\312;\001\217\bv<\360\253\243\201\247\371n\251\274\fh-\3606\337\034\314\253\300\307|q\274\313\367\006\363\332H"
+	.ascii	"\001\037\336\0324\376\346;\343U\276Y\277\341\027\340V\276X\337"
+	.ascii	"\373e\370\360\302x\234\357\213\377\360u\321\342\352g\276,V\\"
+	.ascii	"\360kUu,_\025TSR\307\341\233\002\311\213\002\311{\342Z\276Q\314"
+	.ascii	"k\002\311\013u\362\226\330\341%\301\274O\314\353\244\3626\235"
+	.ascii	"\274#vx\231\220\274K:\274J=\274I=\274H<\274G<\274F<\274E*/\321"
+	.ascii	"\311;\264\303+\304\274A*/\320\311\373\263\303\353\303\274=\314"
+	.ascii	"\313\243\362\252\314\273\303\274H\346=\336\360\253s6\337\364"
+	.ascii	"\344EwxO\346m\346e$\357\303T(f\230\032\327U\255Q\316Z\006\325"
+	.ascii	"\322\344\210?\230?\316\377\303\377\346O\363\033\376l\3766\377"
+	.ascii	"\231\177\314/\370w\371\003\177,\277\226\037\207\277\312o\345"
+	.ascii	"C\273\337}\020{\305U\343\254 \225\300D; \016\347\rY\016vK\216"
+	.ascii	"?\244\025\002>\216\360\210\373D3a\367a{\340\374\024\013\367j"
+	.ascii	"\276\346=\374p\3252z\267\354IY\024~\332\336\313o\302\025\275"
+	.ascii	"2"
+	.string	"!t\221,@\357J\227\232\367\372\330\304\035\320\225Azt)\251o\264R?L\212\324I}%\036\213F\352\224J/\237\331\003(b\303\337O7\367gIO\003H'S\002\317\251\263\260B\306M\251;\247\276B\205^\232s\352U\275\334\263g\352\370Fo\360\234:U/Y\360\016j@|\377\314\270\031\302\347\360;/lq\343\331Z\321V\275\374\341\221\211[\366x\220\275jU\253\350\345\362\244\275\247J\325S\275d\321\r\364\321\034}\363\246\206{\272\311\323q\313;;\211w\203H\013zH/w\203\244Gl\214\272\250\217\372\234\203\246\302V\257h\243N\001\321\234\2305>\355\242\376\021%~hR\206\264No\235A\3105*\355\314\324\242\013\220J73\245;&\\vtZ\364\036[\264N/W\347\252\367<^u\332\313\240\264y\220PC\337\240\317W[ \244\277\216\330\302V\325\021wy\005fa"
+	.ascii	"\023H\370\250\220~"
+	.string	"\342\247\262Ty\2627\207\354\346\0225P\363b\337\2323^\334A$\324X=\324J\207A-t\325R\035\324K\202J\267\266\n\312\3648H\217\002\365\227H|\032\253\177Z\207\2122\257\247}r\364U\367t\332&G\346gz\270\341\357\330\315\345\270,\201\351\002\255\025\303\323\324[\364R\213K\252\325\317\313\342\3664\365\253^*\320WM\301\221&\347\272\256\253\016\325\257Z\253#\220CT\272\265h\236^\240O@\265y\312\246\360\221\255\007\032\256\353\031\214\335\265\200O\030\340,\306\321\3455f\233q.\215\032\351\323j\244G\325~\340\232=\242\336\351'\312\251Ac\374s!\216K\332\315\375a\020\206Y\362\324q\310>^\337\340\031/n\216\226jd\213\275\305Q\332U\375\3309\272\307(\335\226\372\330?<\n\345\r1\306\2412\021\355&\216V\240c\024*\337d5\216\376\340\r\260{\333Aig\306% "
+	.ascii	"\265 \3301\t6\\\310\255\353\032\003\007/sD\3358\007\337\374\322"
+	.ascii	"\332\216\200t\220>\005\225\214H7c\200\270\273V\352\325@\032\315"
+	.ascii	"kT\342\375h\257\346B4\306\256\256\240\1774:\007\310Gw\005_O\002"
+	.ascii	"\371\0222\206\222\211%\301\274P$\230\327\r\257$\327\217\257\037"
+	.ascii	"`\\]<c\311/\002\206p\211y%\277\206\250c)\031\027\007=\226\374"
+	.ascii	"\362qr\365\340\244\327\005]\032\370H\203\200}m\300\265\225\034"
+	.ascii	"\363\362\261\003\3465\244\223^c@\200\204\245?\300h\b\351Jr\021"
+	.ascii	"9\216y%\311|\240dba\311\261/!:?\300\274z,\f\203\006\363\272\001"
+	.ascii	"\366\205z%\271\222c\350vUy0\304\n,\214\b\221\260.+\260/.\"V]"
+	.ascii	"bcVUF\033\206\201\227\230U2,L\314J\3453\362\216\263\021"
+	.string	"\245\214\2216sB\321Q\322~\310j\024\375\277\237A0!\203\306\310\200M"
+	.ascii	"\233\272\331\225\356\352`'?rp~\002\257\215\342\033##\272\271"
+	.ascii	"\352\225%\004\032]\2024\365\027\275\274\342\325\274/>,%\200\244"
+	.ascii	"\3732\210D\243]\364R\355/:\200\266(\274&1LcJ\342\346o\367\205"
+	.ascii	"Q\251F\303\340\017\245.:\201N\017\225yf\177\321\b\364\235\320"
+	.ascii	"\305Q\272\301h\037C\244\nF\270\361\\:\321P]\243\271Piw\242Q8"
+	.ascii	"\002LQS\247\324\315\235\321&\240\332D?\256\254\255\353\b\325"
+	.ascii	"W\374)\206\256q\211d\031\033\003\305$usg\310\200\3110\r\257\313"
+	.ascii	"\312\220\357lT\331A\321\350\007\350\020\323\332\250\370\270\276"
+	.ascii	"LIZ\242\261\346\312\230\264x\201Dcu\211\274\031M\242\257\350"
+	.ascii	"\324t\260~\005\323\254\236\321\207\363\223\013\035\231\307\255"
+	.ascii	"P\207\324M\2624\253\217\332\346\2068\352\346\376\357G4zu\314"
+	.ascii	"\275g\021XK\365R\252\345\324fx\211\271:*F\"t\264\2164D::)\270"
+	.ascii	"\027\304\243\301\376\246'\205:\024=\245\350\247F\347\264\212"
+	.ascii	"\030\274\270 \242\233\333\2638\024A7\033\241\035\235\242\227"
+	.ascii	"\333)\232\361\372\304X)\266\305!J\321\021\364\007\347\310\244"
+	.ascii	"\360\271\"\304)\245\306\f\224\241\035-c\216\214\322-\252u\364"
+	.ascii	"\003"
+	.string	"s]PpT\023\271+\233\201\347\n\2312\312.\2022i\220\"\324M3K\244\270\255\r\267T\227j\036-\025F\351\006\305N485\265S\377\220\200&\246\306\352\021}e\036\023\212\267\244\313\223\224\330\251\005us\367\247\252\327\247\252\027\255j\"\275\334\037\252^\037\252\336\023\245\352\250^N=\212[@A\206\2765P,\325\001\201t\250a(%\rS\b\t\315\210H\222$\031\016\361\004\304('\2614\017\021\260149M\322v\202\351\353m\251\330S\237\247 q\211\024\212\252\303#\274\261\256\301\303\276\273\377x\007\247J\001\247z\024\266z\300\367\337\206\234\240\347\326\312\367\230\301\027\345\r\325V\363\323\362\212\356\225\265\"\3327\256\312\200\204\301\030\373\002(\350'IP\235\377\374\343j\261\262Dx\2317\261\351\214\326\347\377\310U\232>\006Y\260t5\237\225D\220\357\237\354\btp]\235N5[\005\365"
+	.string	"\013\312w\to\311\334r\347\260\326\223\277\332`\001z\321\004\027\22439\223\003a\273\325\254\317\360\350\032\001\217\252R\302L\352/\345W\301\226$\220t$\023m\263\006\0343\027\223\347\331\374\264C\240%j\370hr\332`\f\342@A"
+	.string	"p\332\313\335\355\202%\360J+J\225z\022 \251\333(\210\305J\222B\264\273\262@\006Tl\365q\023[@\224\314?j\336\2672\236\230\362\362\270\230E'F\001Ii@\234\215\351tl\202\256\334\330\356\277\207\2206F\204\225\r_\225"
+	.string	"\352h\372\376Rn\034s\316q\315\023;D3\254\001]\222pn\331\242\"\310\372\244\326\351\235\304\322]$\375\202\261\255\221\362\0258\377\341\256\205+\302\2042zW\t\\\0222\357\361\367\235\021\\\357e\"\321\253\2718\316\302\t\003\007H\007p\317\357\224\276\215bW\030d?\216E.4u\341C\001\237\211\004=\036\200\007\341\016\320\326\016\370Q\363\317\007\0273\225\233Mb\365\37717\\\241\343\321\344k\f<Q\363^\334\261\222EB\322a\006\033\327@~b\236\250\342\243\205\306\372zX\304\355y\217;\363c\240\3468\311\t)0V\363\366"
+	.string	"\035V\002\327\3713<\220}\341T\271\206\362d\003\241\321^\0338\302E\304q\360v\343\203\302\321\273\017\304\023\200k|\330\003@%\306$\357\021\373!\334\007#\002W\001\306y\200\211\305x\257kE(I\341\233\027\204\277\036M\350\327\030\330\345H\002i\3628\037\261h\243\326\203\024p*\277\231\261\027\336\305\247VE\3161\365\377\320\206Vf\240\255\361l\356\343\220Q\325\323\255\310.\221V\277\313\266\346\273\275\023\f\267=:\257\360\240\355\371\277\367\316\223\005g6~\375*@\3778,\327\277<P\344\210\255G\357\322A\362\255L\017\205\201\324x\233\266\373A\361M\f\223\323L\327\221\200\354\357\035|\031\177?+E\352"
+	.ascii	"\305\377\251\207,\006\211\315w\224\004\244\344J\245\024c@w\377"
+	.ascii	"o\311\003X\017\034\372D\251\275@7l%\030\232\263\\o\300\034\233"
+	.ascii	"\231\001\312\016~\304\017\370\020\370\273\322\223\013\201\355"
+	.ascii	"f\2609b\264\335e\201U|w\205\276\026F\231h\203\n"
+	.text
+	.section	.gnu.lto_lzFinish.15.c04fbe3e1239ef56,"e",@progbits
+	.string	"(\265/\375`r\003\355\026"
+	.string	"6\351\216H\340\262(\035\241\361\232\207\020\267!3\t\004\331j\301\326\244\356\357\342\304\265\300e,\016\326^\217\263\325[\243\306\237R\370 \310\217\206+h\31781\226c<\001'H\024\240K6A\320\314\315G\373(B\204\220M\244L)x"
+	.string	"o"
+	.string	"\200"
+	.string	"\036\251\375\333C\300\216\243\371i\316\235\037\025s\342\020\230\200xi\234x\017\377"
+	.ascii	"\263\203>\\\217\355<:h$\200\3149W'W\201\227\337Q\340\345V\260"
+	.ascii	"T\330A\371\255\302\374P\345\323\371\364\250\331$\034\374B\233"
+	.ascii	"\033\237\024\"!\335s5*3\344\374\013Ur\027\300\241G\315\226\363"
+	.ascii	"-\331f\337\311\234\363\"\256\023l2\325Pe\316i\255\331p\356\360"
+	.ascii	"\266#\330>`/\210&Fq\316\251\300/\341\362"
+	.string	"\022-\\\3724\340\345wo\354~n1-\262q2]\036\241\025\273\032\336\035\233H\265j\325\251P\215\n\325%\240\372\364\251I@\265i\325\245U\223V=\262\352\021\250\026\001\325!\237Z<\356\017\245\372\373\324\373\251u\325\0170\212a\003%\305\2347EAf\r\251\273\340\003=7\363\021^\234\335h\306\036]\336\2069%k\332A\262\246=\255\334\315z2\222\005w\264^\214\205K4\355\202\016\274[I7\232\016\344#H\332\322\206\024~\314tdk\302\205\215\355\033ay\212\361\265\241\321~G\3663\035\331he\213\034\264\236\310\242p\221ztW\033\332\rY\221\225A\263 9;\370\t\227C\366\271\353m\003OW\274\203\300\335\243\230a\220i\221\277\272\307\340C\203\326K\351!\022Z\217\340\267\001\020\217\032%\262\315\362+2,\231\030\351\026\n\204\007\253\226\3278\276Z\253\026\027k\\\265`bV("
+	.string	"\374rY\201Y\311\274^0\253\021.\366\335\021\367$\2662\177+\356i=\263\216\243\365\355E|"
+	.ascii	"\216\017\036\270<\016?\0044\303\306HZ\003\034x\267\3307\347\234"
+	.ascii	"\322di\264Ro\201\2525\321a=FK\265\005>\374\334R\353\303`0\372"
+	.ascii	"\026\374\027\360\264\251]\031\264\036j_\274\230t$x\311\242vI"
+	.ascii	"\3144\310V\336\342%D\2501\034FB\004\031\031\232@hQ\232\306P\002"
+	.ascii	"!\322\216\033\021\220AC$\023\211\n\225\016\",j\t\017)Q\324\036"
+	.ascii	"\241\373\221\031>[\313\333\220\3616\220\"\246%\360\001#,\355"
+	.ascii	"w\262\262\235/\315\250J\220^\346\020\036%^\321\367!\234O\257"
+	.ascii	"\275\0057\017>\211d\177qM\250\202\257_\3574\207.\262f\305\232"
+	.ascii	"\320\0200\217\253)v5\021D\331\237\321\325'$E_j\215\312B|\036"
+	.ascii	"\225\267\371\332V\r\n\023\315\003o\fr\232%[\371\016\3700\272"
+	.ascii	"\203\252\210\254K]5\264\321S\r"
+	.text
+	.section	.gnu.lto_lzEncodeBuf.16.c04fbe3e1239ef56,"e",@progbits
+	.string	"(\265/\375`\037\007\345*"
+	.string	"zM\360\020B`\246NcS@\255)<u=\037\233;\345\240l\031\360+\231C\f]\304\3703\366\236\300\276i\220\267\341T\344\225\200\313\367\323*\\\267e+\242oE\007\336\344\330\t\313\376C\243\261\355\336[\312\224\002\365"
+	.string	"\344"
+	.string	"\005\001W\332Ak\235\214G"
+	.string	"\352\323\262\203?\255]\364\341\034\264\375\346e\272\345#uK\002\272s\357}\372i\016\251\030/M\243\333\245\244\013\006\323\215\206\222\321\355b3\243`\353\301xi\241{\223\364\305\335{\037\030B]\273Q\347\340\325~\332\275\024\257\206\343"
+	.ascii	"\356-\343\022w\257\332\003+H\177Z-\375\226s)\332KS\255\t\362"
+	.ascii	"I?\257\266\276{\357\260\351H\350O\363G\350O\313\304i-^(\rBO\323"
+	.ascii	"\326\242o\331\310\030\337\274!\267.\304\306\307\0208cM\235\226"
+	.ascii	"\204\215=\310\234\320\005\315\311\343^y \275L\273\026f\356pw"
+	.ascii	"\252\342cHEC\234\345m\021\362\206\024\373)D\3460\233\356\275"
+	.ascii	"A\344\261\232f\003#u@\204\310.\023IO\t\235\353\275\202!\217\325"
+	.ascii	"\036\356\032\370\002\341I\0226\366\032T\341\336\353\372\205\f"
+	.ascii	"\273\201\267\315\305\266\321F\317\004*\336fEz\357\225\260\007"
+	.ascii	"#\312?\303\201\376$\262W\336\224#b\347K,\265\267@)x^\201\270"
+	.ascii	"\352\237\255f\2546i_\002\033:3\3332\273V;\rU7\001\253\017\b\253"
+	.ascii	"\r\330j\246\333\335\005l5\201\337\335K\266z\200\255V\002V'\331"
+	.ascii	"j\001\300j\244\243\273\375F\266\272\350kn!Q5\321\305\374C_\373"
+	.ascii	"\203W\373"
+	.string	"\201\007\363\247\250Y}\016U\233\301j\373\267\273\002\253\317@XEo8wo\217\277?7\357\224\223\362\273\337\356_\363\277\335\264\357\237\271\336\214\347\331~q\203v\357Us;\377\356x\016\246)\242)R\275\316\257\203c\306\247[\343\345o\330\275\016\263\344\237\213\224\312G\3634\016\316Y5u\275MI\221\376\244\372\322*\314\036\034\211tF\334\345\260n\306\247\261\355dl,;X&z\027B\242\346\362\221b\237\316d\301\236^d\037\367JF\246\204-\016\223\025\332\";l;\352A\355\220\025\332\323\335\\\206\375\261\275q\233bDm\362G\226V\254\234\266\314J`LbL\330\356\272j\237\352\305\314\215\033\323&\2555\026\344O\021\270\275\272\256\332\307C\004l\001-\306{\211.Y\002\366cdx\307*P\037`\227\354\001\035\215(Y\001v\200=\371\216S\214\365\317IV\t\304\375$\331\bq\322\220\254"
+	.ascii	"{\257@v\376p\277\242\227\364\336.\t~\037\f\013\376\031\006\364"
+	.ascii	"'\222=\336\031l\361eI\263{s\326\336\254MzC\206\357\331`\306\256"
+	.ascii	"OO\007\016\317\323\301\356\037~\347\324\253\363#\273\234_i\020"
+	.ascii	"\257\023\204\254\013\332+-\342tn|\231\363#{\t\364J\223x\234\022"
+	.ascii	"DMN<shz\270\352\237\003T\243{\323"
+	.string	"\241O'\262\276\362\004\212\372/\007\221\034\355\226\257<\0371\375\272\322\001~\001\205\365\"+\212j\211\305\212J$^i\250\2215%\025%#J*m\021E\034\201E\314\252\301B\250\212\350\241j\352t\241u\241j\352\254\"z\020r\241u!K\313\n%fEea\235\226\202\262\021cXeEEe%5\254\232\212\242\032J]a\r\241\222l%\203x5\314\262\262\272\032\006\325\270\236\242\326&\212\332Z\255\220\007\225<.k\364S\005>)B\201;Py$\257\313n=\021\262I\2413<wAG\266\005\336]}:j\301\206,j\243\b\361\303f\336{oZdQ{dM\240\3319\032YP\213,\220J\321\212p,/\207\335r\202j\355i\235\254]\304R\314\362\270\177\207RH\336\321n\271\311\032\260N\326\332\035\260Mr&Qs\224H\017\330\004N\322\344\252QJ\330D\316\305-\225\253\330%"
+	.string	"\034\003\366r7\321\212\314}\211\231\326\310\236W\314\"k\021\374hc{\023&\320\230\"ei\202l\322'\334\316\002\366\304\022\263\336\007\200\206\250a8\345\234!\306\020\211\210\310hI\324\001p\002\0212\253n\020pV\322$\231\016\336\323\262\307T\024\035{\002v\321\2753\227\2452\241b|\257\"\203\373\263uj\300i\bx\f\222)\006\030H\371!\370\344\2169)\266$:\303\214C\311?\347\332\221\255\215"
+	.string	"\370-l\306\300\267\036\035\372>\200E\\^r\031\321\256\300\003\224 }\220\345\3741d\267%\322\210N\354*V\202@\b\211\221\335\300\033\277c\203#\fY\331\272\n\323\267\220\233\"\352\003\221s\251k\004\307\240%9E|{\202iw\362\3045\017\265\034\022\020>@\312\371\353\226\366\006\343\336\b\036\316\242\255\273\304_2\025>K"
+	.ascii	"\363\357\270Z \t\277u]\303R8#\315&\233\274\301\323\307%\357\320"
+	.ascii	"\320;pDK\307\243\370\336\303o\3452N\005\013\004\016\303\bM\240"
+	.ascii	"\016H\341ci\036vz'\3660}\312y\302\t\020\241n!\250NM\005|\224"
+	.ascii	"'\310\374\371\227=\333\016Z\210\030Lz\371[\220L\347Q\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.c04fbe3e1239ef56,"e",@progbits
+	.string	"(\265/\375`\261"
+	.string	"\345\007"
+	.string	"t\f\255\001"
+	.string	""
+	.string	""
+	.string	"\002\b\177\025\360\372\2508\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\200\202\202\200\006"
+	.string	""
+	.string	""
+	.string	"\005\022\026 \n\177\027\002\006\177\030\200\200\200\200\004\002\013\177\031\272\200\202\002\f\177\032\r\177\033\016\177\034\372\310\361\003\017\177\035\340\365\321\360"
+	.string	"\020\177\036\252\333\3426\001\023\177\037\377\037"
+	.string	""
+	.string	"\200\200\200\001\021\177 \024\177!\003\002"
+	.string	"\360\372\2508\001B\003\003\n\344\n\003\004\013D\003\007\003\321\226\377\022\001\342f\003\007"
+	.string	"\217\260\251\032\001\242j\003\007\002\274\265\220\005\001\202k\003\007\003\272\341\347*\001\342k\003\007\n\256\231\244\001\001\204s\003\t\013d\003\t\f\330\244\235\311\003\001\344\017\003\t\007\202\022\003\t\b\253\333\3426\001\242\023"
+	.string	"\024"
+	.ascii	"\256\251\2463w\273\306\223\232\201\202\332\371@\246\274\245?"
+	.ascii	"\005\303eO\252n\003b%H \003a\3007v~8\330\"=\017\322\325|\300"
+	.ascii	"\017\rK=\001"
+	.text
+	.section	.gnu.lto_.refs.c04fbe3e1239ef56,"e",@progbits
+	.string	"(\265/\375 \031\311"
+	.string	""
+	.string	"\025"
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.string	"\001\003"
+	.string	"\002\007"
+	.string	"\001\036"
+	.string	""
+	.string	"\0010"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.c04fbe3e1239ef56,"e",@progbits
+	.string	"(\265/\375`z\026=i"
+	.string	"\352\253\220%R0RBJ\007*\306o\002z\007\345<\306\315\347\237Vq\250\333\025\022\2743\243\240\273\371\302\247\215po.}*]\255\375\304\217Sb\252\317\373g\235\242\344\276\377_\314\003\240\b\250\"\252\210\214(+)Oe\025\252*\302,S\241\244\243\274\335\266R\246\366\001>\002T\0027N\320\177\331\300\230\213\031\223\361\b\272\242\027\b\372\345\201\356\331n\331\246\317\242\365\216i3{lpRM\256\337'\364\353\263\343Y\237\335\327\006\272\"Y\346\243#\307fl\242\205\005z\034\233\242\225e\261\364~H\"\003\202\353\027\313\277\351r\355\021\273\354>v\267"
+	.string	"8Q\224\260\306p%S\261\033s\202e\204\353q@\257\354\3306\327\271S\276T\266\210s\332\315\354\356o\327:\267\312\212-\232\220\r\264\264\336\272\323K\360\003\375/(X\3472\027\214"
+	.string	"c\267\017\251\23543\257\255\270\356TE\213\026\265M\t\216mW\327\210\r\333&\213\265\362\225\262]\267)\246\2352\0215_R\270\036\004\364\313b\247{>\227\305\356\034\240\bl\212]}\201\356\020\353\265\315\002\366\353/(\270\216\330\325Z\335)\217\316\032'k\346\270\276\005\372%\342'\250\232\202\337\240\337\002v\373\334\002vg\224\027\305\256gS\354\236.\217\213b\267Q\200\276[(vIe\332<\2744M\266\344\312\r\345\337\254\325*@\207dZv\263;5\301\223B5\001\341\372tS\354\320E\261\201S\006\213#X\301\037\3709\207\315{~6\372 \035@]\3707\311x\b~\316\341\004\316\3177\254\016?\013\377\334\177\205j"
+	.string	"\t\255\0018\034\200\237Q\370?\3674\377^\315\330\305\022\370W\201\033\326\206\0034`\201\206\177\205\377\305\374G\363\377my\377\362\1773g\301\300\211\177\203\377\022\375\373\373"
+	.string	"?\257\360\357\320\2771\374\333\302\277#\374\313\301\277\031\374\213\301\277\025\374\013\364\257\003\3776\360\357\002\377\036\360\357\315\277\365\337\024\377\232\370O\300\177+\377\366\374\377\372\217\366?\205\177s\376\305\371\267\367/\372\277\313\277\273\177m\376k\371\237\345?\226\377Z\377\025\370_\366\377\346\371|>\377\032\343\347\027\376\236\2616\273>\277\316\352\266\266NHw\220\2662(\022#\212=\030\201~\223n\242\211N;\211dR\021\221C\250=\231H\373\207"
+	.ascii	"\315\004\322\310\224\352\251.\233;\355\355#\325S\r\310t\231D"
+	.ascii	"\246KbO\037\227\304\356\364\251\007\331,\022\027\311\244zB2\227"
+	.ascii	"O&\372\330\304f\026\177\240\307\345\023\022\211\345S\017\222"
+	.ascii	"Y|B\036\251\236LX\265\r\231\262d\244\013l\323\220\307\306\321"
+	.ascii	"\024UL\366\240!\323e\267uo3\251\223\ntG-\223mE\0376\314\210\206"
+	.ascii	"\303H\245\270\334\264\273\007h2V-\373\210\206L\262\354Nb\034"
+	.ascii	"\352\246\t\210)Z\017Y4\"\220\250fJ\352^\321\324M\334F\353nbw"
+	.ascii	"\363\222Qi7\217\036\344USS\267RESG\021\255$us\363K\330\023\222"
+	.ascii	"Y\265\004\262\342\305\274j\033)q\257\272\215*\2112\211\\\315"
+	.ascii	"\324\335\013\207^=\345 \303\225s\260\216m\276\214{\370\216\230"
+	.ascii	"\215\2572'\364:\354\313v?\3630\206\027D\224\020$\\\031\007;m"
+	.ascii	"\363NN\246\314\235\263"
+	.string	"$\330\332n\2408\360\356\334\245)N\230\217/\035L76\007\263,-\265a:\262\021Y\332\371\260\303\334\024%F\352\226\240\2241\202k\252\225\343\344Ddic\331l\230Z\312\234q\022\357\200S4\203\203\343\312G\025!\2249\221\\\317D\364\271p{f\321\224\365\211\333[w\257%\021\367\206\304s\321,\330\242)c<Q\363\326\2456\3673q\327po\232U\303\305\235c\3436\367\271K|\343V\356*\322\356c\021\373\\\263M\333\351uS\245\271Z\255\177\327\236\333e\331v\210&\272\201\310!\361\\.+\266c\323\275Ds\365\\0;f\247\230\262\030'\254&\335\255\242E\213\026-*\232Y_9Q\277h\350\212\255X\222\241\3373\377\266-\231\005\203\301\013\017QG\270n\031\240\257\031\2342c\232p\\{U\320\207\365\216\371\327\313~\3317\032;\246\264p\375\276\2115y\344\222x\221\342\272J"
+	.ascii	"}\305\304 \002\344\tW]\030\240\257[\316\322\322\2212\\\367\311"
+	.ascii	"D\267{S\354z\002Yx\230\312\256vn\210\241\262\342\312I\334(;\233"
+	.ascii	"\225\361\032\217\262\233\251u\307\366\241\346\n\207\353\006W"
+	.ascii	"\032\332y\355\314\245\311\022\266\"WV\333Q\232\211\2751\031\022"
+	.ascii	"+&\023\256\207\240\013\352\351\211+oI\342\3064\206+\237"
+	.string	"\335\231\243L\"\356\007$\352\021\375\224\263\021S8\213n-\247\211]\355\024c\313\226'q\215T\372\364l,Y:\023;g9cyA\301\335\202A\274\274\270\362\021\337!p^H'\223\035\tCeM\027\224\257@\300Rh~\244\031\273\021\242VD\tWf+w\343&1%R\\9\354b\250p\t\211\202\322\235Uq1r\345\"\316U\304|XQ\231Q\001c\353q\205\005\275.L\212\024\376\352ic\027\271\2530Gr\350h\236\277\320\324\250\001\301\225\211`\251\025K\316rpe\257e\253I\274\204(\343\312C\334\211\252\331\261d\rWf\262\222\316\023\315\223\311\334\332b\256\355\266j\313\271\202E\306\225\236\271n\222X<\346\262\240@\341\251\355>\313\221S{6\2138q\302Y'z\331}\305\363\222\202E\247\213\030\037H\236\234\263\226m\2010\362\245\204\203%\267\224\234B\202\204\231\364\252\266n|"
+	.ascii	"\243\205m\311\231\211\023u.\031B\213\225\364\234Q\252\234J\222"
+	.ascii	"\360h\001\313\022\"\275\261\002;\372p*R\204\217l'\273\225"
+	.string	"\031H!\362\326J\245\017\316\226 c\305\253\363\221,g\263\311\225\205`) 4N@\270\262\221ec89#UVl\013\2112\b\327\353\220D\210\360\224\256\333\207\226+\236\263\262\342!\355\304\253RBa\305\t9\017\311qR3\202\341\312?\364\330\242\\\331\342\312A\356,;\253\232R\002\375\371G\223\177p\025w5\021\251J\322\231\270\356(\007X\316L\321\310T\354\206e\354\310\225,e\376\230\343!$\r=\373\300\312\363\216\357\340)45 \r\024V\223V&}~\366q\236\272\0229\335Z\335M\200n\031\246e\306\225y\260\024/\354KX\027)\216\352\202\013c\302G\235\345\031%q\\\233\334c\227\340\255\315-}\341z3w\376\357\325\036\254d\231e\241\347\177\327\305dw\363`\223v\322\230\263\333@\241\260\003\0316H@\234\017\2710\032\032\006\021\255\b\376\202\212\206FA\241P\317h\370\353"
+	.string	"\007\t\270\253A\203\320\320gD\344#\332}\310\205\f\301_\321\320\350\307\027\303\021P(\370\373)2:\372\t"
+	.string	"\b<\n\006\205A\336\r\302\242\241\2410\310\243\021\344\003V\237\rB\"\"\037\021\217\306\021\316\220\321/\370\003\001\t\210\006?@\002\352\350\324\030\376\204\202h\b\362`\006!!\260\003$ \317\360\267\0332\n\022aX\3443\n\216\200\004\314\031\022\032\006\225\220\223s!\240p\006Q\r\024|H@\235\013\375\212|A\237\f\350'\200\001\001\f\013p\340\335\202\013\"\270 \202\335-\270"
+	.string	"\b\350\002\030@\350a"
+	.ascii	"\351\2062|H?\243\3350\370\323\r?\344\002\t(\3000x$\364`\370\233"
+	.ascii	"\201\032\311"
+	.ascii	"\360\r\203\206( \001{\274!\243\240\241^\320GB\215\"\341\320\350"
+	.ascii	"7t\343\033\326\340\005}\303\341\257h\005#\337\260\306\214\234"
+	.ascii	"\240\217\204#ao(\343\205\004E>\0324\216:\030\376f\364\206\037"
+	.ascii	"rA\300\2054\370\212~\206Ba\321\017\316P\006\f \264\032\311\360"
+	.ascii	"\001g\004\245\020\f\"\242A\343hhg(\303\202a\360w\304;\020\220"
+	.ascii	"\007\b\250`B\b\250\220\013$\340OPHD$\024\372\t\376\202\210~\204"
+	.ascii	"\212\214~\\\004\020\364\221\340\213A(\304Kr9\2258M\351"
+	.string	"p\\\347t\306B\006\352G\017\256:&]\023\223+0/\\\277\315\273)\201$\214X\024\256\272%\335\r\036!W_c\\\377\226\214K\022\367E\2474\244)\2109/\256:\033\254K\322!\257\263\241\333!\347\250\263Q\273\213\273\t\354\354&`\343,R\224\262\253\257d\250\216\250#\352\214(\317\270\004\205\245+^gt\362\364\260z:\202\241ss\374\334d\023\311<pD\030\227(q\255\324\261\346\374t\332$\205)\243\306\225\325\334\211\316}m\255q\3454Vh\326v\320\266\236CX\216\247\310\2505\221\305U\355p)\245q\341J\206\f\237\331\030O\274\274\2319\237\3412(_S\\\271\fK\365\266\276\270\f\341\312p\233\206\246PLiu\307\030\316\302\303\2215\027\344\355\r\247\207\327S\207\230=S\304\017;vp\005\003\206\335D \236@\005\n+.\314\331-\255\247\344\205\304\241Te\266f\306\003"
+	.string	"J&8\270\262\235\333\3308\201\343\250\2618f\0244#2#\022$I\222B\007!\005\204\030\005)\205\335\022"
+	.ascii	"F1\021\"\205FdDS\222T\n\033\007t\200\026\225\231\266viI\001\217"
+	.ascii	"-3\277r\366\210\346\260>^\332\303\351\003\243\026\201aO\365G"
+	.ascii	"'\351\322\377\273%F\004\027\230\211\022Q_#i\001\342\244\267\023"
+	.ascii	"\037=:+\345\373\204\003\204Y{\231\270!\275\261\305\257\334\274"
+	.ascii	"\335\315B\213\234\303\346\025\234\214&\354\224\202P\300\346\310"
+	.ascii	"\335\202\f\001\220\346[\272\341O\352\310\373\347\262\212\215"
+	.ascii	"\203\274f\376\330\270\2219bR\3240\035gL\313\374\246:\213\035"
+	.ascii	"|\354\003\266\321\216\326\f\337\252H\250\351\367\032-\303\b5"
+	.ascii	"\344\351\210\211nY\342n\026t\006\315e\232\213\314\235}-b]\027"
+	.ascii	"\024\017\031c]\225\2453e\341HJ\344\273\340\226(Y\351u\277\254"
+	.ascii	"\001\017\013\357\335%\032\314&\013I\305\255(A\274]\215\260\361"
+	.ascii	"u\320z\020\020\263D\022N\236\317\375\026(RI\366\220u\205\233"
+	.ascii	"\213[\251>\363\3312\366/\213\nc\204\237F*\371jEQ\261g\364\352"
+	.ascii	"\233\356@\262\342\237DvqEn\314\327\367\240C\275)\362\277e\236"
+	.ascii	"5TQ0\b\004WFr\325\232\231LU\021\271\346\371,\270\r\251\216\302"
+	.ascii	"\216Y\223&Y\205\235\247f\352\304\300\3208\231lmZ\261\313S\367"
+	.ascii	"Gs\013\325\344Z\231\354\f\033\246\322\251\377\257^z\331\363I"
+	.ascii	"\304\307z\313\302\b$\\\356\004w\021\030\370\217\354\201~\270"
+	.ascii	"4\237\027~\bE\323\333z\231\353\325\021\307X\347Igb\262\321oH"
+	.ascii	"\220\222\234\307n\220\225\333lt\320\n\320[\234\220n\b&\363\244"
+	.ascii	"\306\r{\202\203\254E\215\332\254\301\246\210\200\177^\236%\371"
+	.ascii	"\036\004\325f\356e\344\203\235\225!b\211\3101zi\003\375F:'\321"
+	.ascii	"\227\334\240x\367\340N\004\234\272\244R\373r\030I\331\230\367"
+	.ascii	"g?\307\327\256\305\006\2519\264\017^\bc\360J)\035\320\370\303"
+	.ascii	"\320 Fi\322;\320RQ(\264&\266\006\315^O;,\335\246\373\2029\240"
+	.ascii	"s\226\026\352\207#\033&\315v<\312\027\234\241\357\356Gc\362\222"
+	.ascii	"\035\211\224y)#\310\304\035\225\213J\221\237\177\016K\264\"\021"
+	.ascii	"@ \020\026;\350d\n\334\301a\220\347\230\350\321lC\337\2711^\032"
+	.ascii	"H\206y,H\240\026#;\222\376X\231\243g\242\376\035\031?\274\030"
+	.ascii	"\363\341\225Od\224q\353\315!9'\235\0261+\316\365\213\021l\246"
+	.ascii	"\035\341\013\035\233Bm\b\225\235\"\032'y8W\353\223\017\365\352"
+	.ascii	"\276\222\335\240\323:,\217\356\036o\344-}\223n\372\303\330c\027"
+	.ascii	"\223$\225\375\251zK\203;\260\211\271\273.i\332\2030\037l\276"
+	.ascii	"}@\346\005\362\370s%\377Csx\276}\333\200u\327\354\305\032N\235"
+	.ascii	"\337\343fW\376\177Q\037\324\367\022\236\262\353\214\241\355\b"
+	.ascii	"\370\257(^\250\302\r\327\216`\237\020\370\256A\374\330\361\372"
+	.ascii	"\030\343\006\337;\026\033r\034\307\236\037\311\177=\027\300<"
+	.ascii	"{\264g\374\345x\360\234\234\026\304\337\331\275\324\377%\276"
+	.ascii	"\306+{\\\310\377\275\347\027\0166]T\370\001u`\035\311}t|\326"
+	.ascii	"^\361g\302\270\223\343\356\360\375\370\377b\334\364\3318j^\203"
+	.ascii	"\373\366\254\305\021\026\367\303}@\217 \327\246Y\330\336X&\007"
+	.ascii	"v\246\233\302\321\373\217\310\255\342\247\353\246\255\031C\336"
+	.ascii	"i\302\273\331V\301\017{\3701\272\261\273\351\006\242O\214>Y?"
+	.ascii	"\245\203\275\217>F\030\246\023$y\233n\312\373e\344H\t7\225=\321"
+	.ascii	".\313\337\376N\016RL5\315]\025"
+	.text
+	.section	.gnu.lto_.symtab.c04fbe3e1239ef56,"e",@progbits
+	.string	"lzInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\001"
+	.string	""
+	.string	"lzBlockCapacity"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\001"
+	.string	""
+	.string	"lzBlockBuffer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\001"
+	.string	""
+	.string	"lzEncodeBlock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\001"
+	.string	""
+	.string	"lzFinish"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\001"
+	.string	""
+	.string	"lzEncodeBuf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\001"
+	.string	""
+	.string	"huffmanTable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.c04fbe3e1239ef56,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
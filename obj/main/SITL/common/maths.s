@@ -0,0 +1,1432 @@
+	.file	"maths.c"
+	.section	.gnu.lto_.profile.40044d3c085d4d13,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.40044d3c085d4d13,"e",@progbits
+	.string	"(\265/\375`\364\005]\013"
+	.string	"\004\021\350\006"
+	.string	"!"
+	.string	"\341\333\245\345\002"
+	.string	"\001\337\352\303g"
+	.string	"\002\203\270\227\357\001"
+	.string	"\003\264\245\347\210\r"
+	.string	"\004\346\353\250\236\002"
+	.string	"\005\246\240\335\225\r"
+	.string	"\006\347\231\311\265\t"
+	.string	"\007\267\332\206\371\013"
+	.string	"\b\271\225\217\236\002"
+	.string	"\t\352\222\314\276\016\002\002"
+	.string	"\002\001\n\223\242\326\261\005\026\002\013\326\331\347\361\r\004\f\350\355\231\037\r\231\274\327\315\004"
+	.string	"\016\202\362\202\320\006"
+	.string	"\017\326\360\230_"
+	.string	"\020\244\330\372\372\n\f\002\002\002\003\021\277\337\362\237\002\030\002\004\002\002\005\022\343\267\372\377\002\036\003\003\023\207\330\371\361\002\002\002\006\002\006\024\356\322\327\356\017\034\002\007\002\007\002"
+	.string	"\002\b\b\002\b\025\242\333\255\257\0038\t\t\002\t\026\333\332\376\205\007d\n\n\002\n\027\234\341\340\262\001\220\001\013\013\002\013\030\f\002\f\031\r\r\002\r\032\016\016\002\016\033\017\017\002\017\034\244\246\246\251\f\006\035\342\247\330\361\001\006\002\020\007\002\007\036\275\305\343\240\f"
+	.string	"\037\354\261\352\343\013"
+	.string	" \364\207\213\233\001"
+	.string	""
+	.string	"% P\202'BT8%\037\t\256kQ\342\324\021\016\260\020\244;z4\002,\031\211KG8\300\222\321\003\300\265\0056"
+	.ascii	"\254\031I\374\324\235r]wS\246\313Z\374\304\204\335\256\313\234"
+	.ascii	"A\266Z\f\235hr\240\2723\303\243\361\371E]\224\326r\204\361\333"
+	.ascii	"\\D\2665\305u\003"
+	.text
+	.section	.gnu.lto_.ipa_sra.40044d3c085d4d13,"e",@progbits
+	.string	"(\265/\375`\023\001\205\006"
+	.string	"\362\007\030\032\200k:30\00330\227p\314u\270\016\267\221*\326\263\337\366\356\226RJ2\366p\035f\203\301?\013E\3021\021\346\30144\312\212\260Lv\326\002\037\217\323\364\332Ea\256\376/fD\353xu\336\334#8\031X\320e\244\216?+S~\265K\313"
+	.ascii	"\001\244\242RQR\273\353\226\246A\254)7 \300\002\252Z\017\266"
+	.ascii	"\3614\020`\233\207\301\241\305\007;\304\343\352\340c\214\261"
+	.ascii	"\200\325\032\270\264\321/,\354\236\301<\204>\230\301%_\b\310"
+	.ascii	"\372WL\343\032\r\260\022Ew\317[4\330\215(zDj\313s\245\030\023"
+	.ascii	"\202\241T\260x\020\215\242\207\231\264!2m \305-z3_\271A\027\276"
+	.ascii	"\301\261C\004\013\2650\214c\311\260\205Q\274!"
+	.text
+	.section	.gnu.lto_.inline.40044d3c085d4d13,"e",@progbits
+	.string	"(\265/\375`Z\fU&"
+	.string	"6\264\251H\300VQ:\024\001\372\355D FtJ\207+\263U\314:!\275]\203\222\230'\025I3\206S\210\035C\3128\212\305\263\271\356\255\375\202J\242B\307\311\262_\202 \303\320\277\003\025\007u\267\306Fn-M[D\357\235d\n\222"
+	.string	"\225"
+	.string	"\223"
+	.ascii	"rZN\323\276\222\316\211'\212\220<\244,\247\264|E\026Mp\354\356"
+	.ascii	"\226k\377\331\265-p\370Y\026Y\324\b\001\370\035\225\216\265\003"
+	.ascii	")B\002\021:\356v\367\2443\324F\312\003D\224\244\265\357\263\313"
+	.ascii	"\203\300\340m\244"
+	.string	"U\206\032!\032\222\002\300\367\315M-mT\234\236M\016\273k\263\243m\360\352P%x\216\271M\314;\310<B\264w*\301\003_\301w\244\305\032DCL'\353}\331ww=[\3476\0249\246\004\267\243\316C\240\3101\315\330\007\354r\023\323\237\376\214\345\244'\006O\332K\024!\365L\317\017\307\023v\317\320\237\241?_?ZB\262B\377\371\237]\021\324\215\032\314@\235\272\215\352F\006\232z\006{\2169gr\264\224\204\345\023\213\r\273\312b\313juCW\2538[\226\2578\342\b\214\245{\266<_7\021\004\344Cv\371\241)P\216<\233\247\272\356T\365\035\205\340\251~\301\322:\2136\212\b\3258\231\305\216]j\355%\224t=\346m\247\256\2529%]\017\026{1\350\266\352D!\235\216'\236W\0021\376\224rM{\220\335U\371\337Y\304\355.\214=;\016\345r\205\241\322\320\330\342\250\023["
+	.string	"\251 b \006i\234s\334.\017\312\337\207\232\261\230\264kk\261a<\361dW\030\035s\354\362\254\374\201 \b\202\021f\003\216\203\026\312\261\377\352h\313\025k\316o\273\333\342\227\031\307\331\327\005\250\210\320\316\305(\226\345\354R~,\211\361\230\264\374|\371\371\362u\035\220\n$\262\025\230\342Xp4A4\324t2"
+	.string	"\373\322\227\260{ \241\273EO\205\242\253\353\007\266m\224i\337\371\270\020\2457\300\322\002,\030\023p\262\373auU\332\375\360b\232\001Q@\f\020Y\024\356\243\251i\212.\241p\243\246\246)\216R3\243dw5\347dw-\204fu\027TD\364L8\f*\"z\032\310\250l\357\330\335\006\265\017\331]\032\224\214\3327\267\323\274\232\030\f)n\273~+\350g\327\347\373^R\314\333\234^\320\217\364\271V\271\351\356<p\271j\302\360\203]a\327\270S\340/.iC\335\341D\215\265\003N\311\371\205.]\357eM\373\214\332\323\316\027\273\033\201\b\250\341X\207hDDDR\320\202\024\032\003A\205L1\306 z\022"
+	.string	"\0035F#%TFFfdDR\220\244N\266\306%\003\334\034\347\232S\336 \357\327\305\350\202\375\370?\267\360\t\230X\\,\250\277\2079V\325\264\252\254T\265tR\365\313\241<W\031}\220o\322\177\270E\366X(F/\206\f`&z\363\224Q"
+	.ascii	"M\306\313\264\202\334R\365\363\221"
+	.string	"J\227J\3707\224\235(\277\237~\271` \376n\331\222\256,o$5]\364#C\217\237\016\272\351\214Q\025s\006Q\323J\204F1\001v)eGr\356_\222\262\334CQ\350\212\365-!<\354s\220\234\361}\244,\207\315\323\201\345\306y\303\327\b\345s\340\371\355\310\327\204DRl\276\222mR\302\211<\333r\"L\353%\300u'\253,\324\314\305E\273\301)C\203|\311\245\2709\317.\237\fi\362\2048\241\247\341\r\333\373\260\246\360\247>\013y=\334\336c\r+6\323\227\035\234Xx3\b:{\322!\210\244\223\364M\215\307\017:\f_\0230*\002\277$}\261U)1\361\221\031\034\037\246,b\272\265M\331\323\034)\265\252x\366\321b\220g\220\251w\202\200Oa\354k\373s\222\300D\376\366\3518E\300\"\013B4\324\375P\374Q\205\026s\205&Me\205[\245Z\366\031l\360E\373\217e"
+	.string	"\031l\252#k2\374_\300\353^$\375\215u\234@\360F\334v\246\030\f\346n\013`5\346\313Y\204\001\016\252\351\344\207z\214\327KX\374\355\034\004w^:J~\303\243\\\346/\312[\307\376\177\220\030\322\344*?i=\216Q\245\2577\027\242\034c\332\366\246\352\004q\224\254\022\351\340kKx\305<WaY\317Y\247\254\345"
+	.ascii	"\276\337\300\016\223\215\271\036\345\013\322A\240\353\201\213"
+	.ascii	"\363\220\032j\233\004\\\270\336\240YL\355e[\006\366\321NR\324"
+	.ascii	"\340\224RK/\335\324~\201\347N|\231\032\340o\334G7R\3743\035l"
+	.ascii	"\025\326\225%s\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.40044d3c085d4d13,"e",@progbits
+	.string	"(\265/\375`\330"
+	.string	"\245\007"
+	.string	"RK%*\220)\351W=\277\354\252\303\377\377G\306w\260\317\335\035\304n\304\337\200\177\240O6!\255\355MHk\255\265F6\331r\247$\003\370\374w\360\374\307\340)p\f\201c~\247\266\315\001\201"
+	.string	""
+	.string	"?\317iX\344\205\222\026J\\\\\270S\302\246Tl\237\231\2562*\255!\313h\337-?\233\362\225\221i\013\233\272\036\317\321\250Q\265\214\346wQ\205\343;J\3437\314%\316w+\233\337\374\245\265\302\210>8LHD\210n\210\"\206\004\005?\335\346\253\026\021\260\020\001, \220\202\252\253\016\226\241O\031\314\365\320[v\346\315\310d\b\3432\310e\f\341\270\312\301`\272\017S"
+	.ascii	"\342\031\202\303\033\2724\230\253\370\n\263u\202\263\375\026"
+	.ascii	"]\300\307\3018\b\341\216j\013\032N \203\267W\177hs\340\242\242"
+	.ascii	"\372\360\"Xh\246\233\001\026e\272\215;\3048\305\034\002"
+	.text
+	.section	.gnu.lto_.pureconst.40044d3c085d4d13,"e",@progbits
+	.string	"(\265/\375 h\345\002"
+	.string	"\202\006\026!`m\322\0010\\\211L\002\254\226$3\b\202 \bB%\300K\t\360R\002\314tw\267\316nm\007\2632)s\362I\276\310\205\334\307u\334\306e\334\305U\334\304\030\304w\370\f_a\022\346`\nn\340\002\276\352\243\3464\245\031Mh>\237\227\363j\316\230\305\314.\001"
+	.text
+	.section	.gnu.lto_.ipa_modref.40044d3c085d4d13,"e",@progbits
+	.string	"(\265/\375`\211\001m\006"
+	.string	"\022\310\030!\220\245I\007\377\017cU_\276\373\026\331\335\335\255\3769\303\233Y\373\304\376\375\026\004\377\257H+R\246\257\362\205`Q\300\035r\212EI\020uX\207\341\273\266\360\355v\377K5\276"
+	.string	"\213\242f\343IyM\f\t\177+\036\016\330\360\2313\366\274\2536U0cl\346\334(GJ\34400s\321\354\307M\0041 \360\202\021\261\252\003\320\232\224c\0379K#\001o6\030\315\322\202\336E\214\316'ciQ\364\341Q\206\bY\343\226-30\025\334\205!'\nXC"
+	.ascii	"\246's\264\343\214\353\026\344\231\321\215xQ\332\267kP9P[Kq\234"
+	.ascii	"\021\204)\002)\354\305\245\272%M\037\357`\217\230\267\n\335L"
+	.ascii	"\343\006\220\221\340\242\f\001"
+	.text
+	.section	.gnu.lto_.lto.40044d3c085d4d13,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_sin_approx.5.40044d3c085d4d13,"e",@progbits
+	.string	"(\265/\375`\331"
+	.string	"\025\f"
+	.string	"6\327RA\020q\224\016; \034-\264\364Rb-4\245\337\347\260\333\213T<lX\020)8vI{\020(\374\364\307\336^\267H%w\273\250"
+	.string	""
+	.string	"(\267I\021`\266\214\345%\326+jm\315\222\275\267\224)\005A"
+	.string	"?"
+	.string	"A"
+	.string	"\027.\030fx\240\250\261\2731s\f\374s\037"
+	.string	"\377\324C\226iv\247\231\371"
+	.string	"4\323]%\344\352\016\210\270\b\t\240\235\034&\006\207\223\247\236 \032G\246\245`w\235\037\232\206\373\335\366\002\333\321\276\203\252\351\324\364-\002H\b\274\330\315\260\262\2610\336\n\021\337~;\363S\276\330\336*\270M\301\200\304\t\312\356n\376\274\251\374\345QV\331\262\333b\204\212\335E`\003\225?\333~\211\233\310lU\203jz\202\017)(\272\275\004S\037\2340\341\310\024g^\202\327\324w\210\234re\250\327GB\303\343\306S\250O]\303BF\207\211\205\\\331\233)\265C\t\210\222\020\326\021\353\333\r\217\372\337\323\356\250;#\320\207\344H\267\207#\2120\352\\\021\204]\027\346\211\240O\347\212\236\220(r\n\030\223"
+	.string	"!\024G\030\026\212\227\275\216X\233\ri\225\355\3248;M=9\227OUAl\230O\355\t\024\340?,u\001\024"
+	.string	"f\020\302\251\031\235\270\202\027>h\250:\354U\251\215&\354\2350\333\213\261w\246\r\256qB\304\2161\016\322\214="
+	.ascii	"1Q\341\n\240\362\264\264G\003S{"
+	.text
+	.section	.gnu.lto_cos_approx.6.40044d3c085d4d13,"e",@progbits
+	.string	"(\265/\375`=\001\305\r"
+	.string	"\346\232]C\020\217(\035\250\001\323\253T\360\037j\254\375Y\2317\"\264\344`AVBv\030\002\023\227\370\233]\375\227h\232\363p\331\226\263\247\002\266\001\020\240*,"
+	.string	"\300!\200\030\322\t\2720\220\326}B\310\336R\246\024K"
+	.string	"I"
+	.string	"J"
+	.ascii	"\366=\374\003g\253\022H\310\220\274\224R/vW\333\270\306\365\b"
+	.ascii	"\017\340zT\r\347\01659\377)\207'\013!L\236\310a\311\025\0220"
+	.ascii	"I"
+	.string	"Q\222\341\211\240F\013\006\227\247\236#\336(\023;\260\273N\223G\341\216\267\255\300\266f\377\024(\177>}\214\201\n\001Z\273\023Z1\226\025Mp\370\367\333\367Y\376\371\251\025.t\224U\345;\355n\310_q\346\321\241\253D\200+\002A\007\027\026\273\313\361h\216\354\234\235\311\243Xe\314.\212\023\211\335-\340\001\331\243\035%Z\264\\P\324A\256K\031\260\254F\t\303\033\007\271\242^P\243F\020+J/]\266|\205\372\3245'T\220V\235\352#J.X\353\034\355v\232\324\353I&\242l\331(Qj\006\373p\365${\032\203\351\013\246\343\277\033>\240\316G\b\f\2717\035\037\007 \017\216\326\3318\234m\243u><8\332\306\363\321:\004x{\320\300\243\201\266\315\243e\272\303\325\023\033*\266`\303*\255\262\235\232LGlg\372\224\237\204\344\261:\025A,\257\376\367\201p\335\204)T\221\f\030"
+	.string	"i\b\361\3350\026,\270\303\354MT[ \325F"
+	.string	"0+0\277\242!T\354J]\346\032~\262\201\323c\027\2720\f\\\302\252\351[\342D\202X\306\004\021\025n"
+	.ascii	"*\217U\215N\321\324\036"
+	.text
+	.section	.gnu.lto_atan2_approx.7.40044d3c085d4d13,"e",@progbits
+	.string	"(\265/\375`\254\004\375\033"
+	.string	"\346\361\255I\240\330M:\300W\235>\360xE\003s\212\332s)V\244\211\214\265\263O\246\005\345B\310<\247\306{\220(\377\347\0244\241\352\333"
+	.string	"\237\002\354\361\024^\345\325\326\342\245\231\323;@l\300d<~P\263\267F,!d\313\235R\233"
+	.string	"\207"
+	.string	"\235"
+	.string	"7\0228\371w\203\353U\025\023tS1\016\0344\202\036\215\003\237\227\341\237\307Z{\274\270QkE`\003\255\203\266}\030\217\361c\377hOI\305\211\200\020\362e\325Zk7\227\205\007\351c\302\203\233\342?w\215-1\004\351\316\037_|@]\030\005\361\220\003\272K\367Q7\200\027\242\304l\r8!\242\350\"- \004\205\222\017\tQDi\273\037#\204fH\342 \371\312u\230\324\225\033\361\215\345p\364\246\326z\251\317\241\334mN\361A\255\325\323CN\304\375\272m\236\355\0066m\0210+\333O\035\302N\207EJ\271\315\3221+\2634\037/\013\263\nt<\310\254\240Y\332=\240\271I\366i]$\333\206V3\243\371\364\314\247ew\272e.\343\2179\324\r\363\336\377\342\322\022{\324\r\3734\313\247_\237v}z\374t\353\323\342\247\303O\203\237\246\237\336O\317O?"
+	.ascii	"\314\311\316\004\212\242\305\352U\020e\225z\005\346`q\247\037"
+	.ascii	"\352\217\372\332\267?e\277\246\375\343?\335w)\277\242\214\026"
+	.ascii	"@\371w\243\024U\023\367Z\226m\260\304\265\257e`\005\207\356"
+	.string	"h\\\327\326|\344\016\311J\221qq\250H\236R\223#W;p\342\266\366V\341\212+\300\212\344\225e\216\202\033.\200(t\301\005\340#y$\254\234\250Uv\351\326\370\310\035l\347\356\316\250H\336\327\277\357\252\262\256\256\314\005\255\310\245\333\3576p6\216\252\035\224e\026\256\326 \002\260\375^\247+I\336\215\312vfi\366R\207\241\"\253n\263\234\331\317\370\334\371H(\267Y~\326Z\201v\223\374\263=\t\310\266\210\250\351\t\tnR\261\314\006=\026x6\202\204\036\n9t\3039\334:8=\027|rvj\031l;;6\235Z\006\f9;5\035\236\236\032\016\3156\r\026xj>6\033O\355\325\253\247u\221V\2146k\332jY\027\227\215\221S\256\202\366\346jY\233\265\321A>\t\032\245>.5\355D\332\232\206\261m\211\331\031Q\222V\214\3226\202\321\217\\:\216(B\216\304M\362\2154}"
+	.string	"k\266\002\323\025:\333\330\016\275\354\214\b+\234\315\020\222rU\263>FR\344\022\270I\336\300\304d^\211\t\310\322,l\207l\317\210\210<\375`\331\326\316\3665\310a\250a<\244\020S\210\321\004\"\222\302\202$\035\300\002\221)c\035\020H\206\2144\311p"
+	.ascii	"Bo\b\013L\340\312j*z`\264\371\024\003j\020\333\345\327T&\273"
+	.ascii	"\030\b\251\035\202\372&\006\314n/\262)\037\333\230\215\275\005"
+	.ascii	"\027\356?\226l\036\272E\3221l\370,F\22283\005\f+\001!kfp@\177"
+	.ascii	"\025\2047\201\024\311\027\034l{\223\320\275V\324H>n\231\332\032"
+	.ascii	"\314\210\203\251n\317\315YqO\277T\033\021\005V\266\311\321\214"
+	.ascii	"\006%A\242\310A\331\001[\240T\242\276|\023:\n\236\2338\270\314"
+	.ascii	"[\r\031b\256\200\207\302\213)<\256\001\367R(46\025\2231d\233"
+	.ascii	"r\007\205~\337S5\016\353\355\321?"
+	.text
+	.section	.gnu.lto_acos_approx.8.40044d3c085d4d13,"e",@progbits
+	.string	"(\265/\375`\374\001u\021"
+	.string	"\366 tG\340\322&\035\220"
+	.string	"\002\n4\333_\310\025$\017\374\346\306\236\207\022Y\272\030=\347\304-\310\343o\337\\\205L\350\367\257\027i\306\264\205\212\31109\306\030\215\326\211aF\334(\037\013&x\024Y\332\3106B\b\331R\246\024]"
+	.string	"X"
+	.string	"f"
+	.string	"\317\3649\026=\232\263\306\212\030s\316\006f\300=\263\355\343\234E\312\026%\254\204\211\007\275\210\331\031\232sz#/\240=\223'\240=[\022O]\256\246|\325\345_\255Q\2065\363\225\013\200F\354"
+	.ascii	"\300\002\245\210\253g\346\261\353\212\365\251n'sN\253\f\313\303"
+	.ascii	"\235\335v\004\333\017lu\t\243\rS\351\332\330\227sk@\016\273K"
+	.ascii	"\327\271\273\347\374\244\253GWsWoWkWgW\313\253\367j\275\372\001"
+	.ascii	"6\024@\tn\314\311a,\232?\331\214\023\207\375:W;\345\267x\314"
+	.ascii	"\235\216\305\021P\300\\}0^\016`\0269U\007\003a\020O\2179g\311"
+	.ascii	"3\227p\001>.B\035\333r\253\371\204.m\267\335v\302\033\033!D\024"
+	.ascii	"\201\331j\033\362#|u+7\333\0038\302\233\017\253\f?D\340\256\\"
+	.ascii	"\0044B\327'\036\204\n\r\020\306Q\250\246\333]\005<\341\215\324"
+	.ascii	"\257}\001\203v\031\335\021pU\356\326\342\255\340\2340$_\t-\036"
+	.ascii	"\341\353\323\321\244\355\366\261\313\024\255\034\341\020\214"
+	.ascii	"\006(/\332R\301\205E\005\245\275\334)&,\023ZPL\336\312\311d:"
+	.ascii	"\245x+\024PL^\n\212\3053\021\361\311\202\n\312k9\235P^\007\233"
+	.ascii	"\227sk|\032\034\227\226\006,\310\216ve{\264>\201\331O\2266F\350"
+	.ascii	"G\202\354_\2551|}\227\341\003\210f\327\306\242m%!m\310\006\234"
+	.ascii	"X\017\250D\346V\267\264\017' \200\202\221\200Q=\355\b}(qZmX'"
+	.ascii	"{i5\246\266\306\nwm\025\247c\223\013m\304i\347U\366\313\251\203"
+	.ascii	"\233\207\206'\370u@eb\261q;j\2535\244\357\340mF\303\001\357\325"
+	.ascii	"\236\217\234e\206\r\351}\276_\2218s\002\003FjB\270\002\310gR"
+	.ascii	".\317u\366"
+	.text
+	.section	.gnu.lto_gcd.9.40044d3c085d4d13,"e",@progbits
+	.string	"(\265/\375`\316"
+	.string	"-\013"
+	.string	"\246UK:0/T:\2041\266\204\201&\032\232\256\002\257\020H\3237\242\375\233&\203\fG\325g\306\3322\204\334w\020@\262\253\256\241\240\202\244\255\315\220\230\362ni\013\244!B\366\2262\2459"
+	.string	"="
+	.string	"6"
+	.string	"\177T\217\272\301\267\346\366\b57\377\337\241\007\f)<\035,<j\016\241\004u*\001\340:\320\352\200H\377\236\037\216\223\372xZ\223\335uz\270\nwu\333\013l+\260\237 \336\235O\337\262N\254(\320b\027\224z\261*b\211\203\355\315v\330\036\t\362|g\223\033\273\031.\224\330]\210\0170\036\377\341 6\333\004\275\021w\r(&\214p\261\273\227\201\013\250\036a\033\250\"\377{\200\370JS?\377\3168\205\350b\252aFU\375 x\352"
+	.string	"\n)\021,8\211\262=\315\341\356\256\252\310O\311\bu\262\206\354{\177\365\356\217\357n}\230\226Y\030D\fB\246\256D0\r2\024\354\3124\f\323*W\346\200\202]\225\013\346\212\020\260\366\300r\2712\232v\271\034\336^C\266SU\257\377\336\220P\332dJI\230\350pQE\352I\004\r\025"
+	.string	"i\004.0\307v\032\177 \251"
+	.ascii	"\003X\370\320\032k\237\236\r\320\004\265\004>M(`\016d\006F\004"
+	.ascii	"\0250\240\222\371)\373p\224\254\272\251\246j\264\253\344\001"
+	.text
+	.section	.gnu.lto_powerf.10.40044d3c085d4d13,"e",@progbits
+	.string	"(\265/\375`t\001\265\016"
+	.string	"\366\233bC"
+	.string	"\217*\035\240_\210dB\2303gZL\0265\361\2377\bN&\002\317=wC\251%f\235\361\004j\301e\2251\367\252J<Zzw.\375\377\277\270\354864k\231k\023\3145\030=\362\367\226;\245N"
+	.string	"N"
+	.string	"L"
+	.string	"\273\031\270\200\313e|\200\313\245r\260\366}\337\354\321\273#\024]F\205\"\237\365X\222B9u\243\313\250\225>:"
+	.string	"\350JQC\0263\271\353\020\325\221`\374\020r\275\353\bR\257S\027r\250=\330]\303S\207\341\276\3346\005\333\016\354\207\b\036\336\372W\207\366\355\237\360]-\237\314\021\310|\261X\032\314\313\333\"\237e\214\355\225as\0042\300\264\362\"\266\273\t.\315"
+	.ascii	"z>\321\240\312\034^e\2303vU\220\244\330\335\005>0/?\342$D6,z"
+	.ascii	"#$_q\321\321b\331\r\n\3653V\312\005({\334\335\215Vp\250S\345"
+	.ascii	"\nS\006\022\374\254z\325\364\256\313\224\324\313\004\202\004"
+	.ascii	"?\325\027J\251S\025\261\275\021\324\030\221\305\254\033\354\251"
+	.ascii	"\311{\177\274\352\327\267n\370\325\375\2149kAQ \306\356\307\327"
+	.ascii	"\262*\322$!\017\007\267\221\241\t\034 \316\347\262Q\201\243\034"
+	.ascii	"\220\006B\364&\003\212\020\322t6\017\327\351p\233\315#A\323\331"
+	.ascii	"6\037\320\226!`n\203\363\331B\034\367\3310\336>\306\253\224\367"
+	.ascii	"\350\200\241bAIRE\214\021\241S\225\005D\335uL\211\t\017\326g"
+	.ascii	"\213\0223\210\262\355\030  \200\002!\333\016\033\201z\354\025"
+	.ascii	"{D-\344-\016H\223\237\361\201\231\325\266X\321\254=\330\322\355"
+	.ascii	"\026rLq0\330]\203\355t\255d%LB\340\020\254A\300\303\202\241\001"
+	.ascii	"\345%C\226\220,\362\302b\037\357K\244s\321'"
+	.text
+	.section	.gnu.lto_applyDeadband.11.40044d3c085d4d13,"e",@progbits
+	.string	"(\265/\375`\031\001%\r"
+	.string	"\006\031YA \215(\035\254\022_\226\215\242\207\223\272N@]\241\261\033Be\316dJ\351\310\201\034d\302\354\217\276\206\217t\n\360K\236i\301\334\222"
+	.string	"\001,\234\022 \006O\024\b\026\214\220\241HI\333{K\231RE"
+	.string	"C"
+	.string	"G"
+	.string	"\273\327\200c\300?\367"
+	.ascii	"\360O1\034t\370\234&\310\0179<\371\273\320N\356\\\306\210#"
+	.string	"\240*\271d4Q\2523@j1\001\240\205\034\206\252\344r\225g\2116\312\304l\354\256\223D\243pcn\033\263\215\300\276GN\277o\277sZ\217\372\323\351[\027\025T\002R\354N\210*\266\304\023q\262\277bgn\203\330\031{[]\231G}\330b\367\002\210\020\273\242\003.`\375\331\3667\234\003\210An\313\240\301\322\212\b\035^6\241\214I\342a\304\364\324\224\n\365#\r\241\214\377\207\323\210\225\373\200\251\nLN,$D\271\312\024\n\025\212\252\311N\345\226\t\226\026Q\256\234\252\372\225' Y\210\243\027\221\214\366\026\222j\262\2571\306hM\261\235\206\001\033\017\266`\203q6\026\307\303\001\006\341Y\243\301\301\240\003\353\\\236\254\323\3114\227\247\001\326\2714\037\216K#\303\331\003\316\347\352\310\262\317\225\331\366\232\342tP\363D\n\365\236\005JJB\372 x-\2617D4d\267\273\013\237~D\n\031"
+	.ascii	"|\bX\325Q\024\026_d\242\200P@\235\2373\001n\017V\r\025\2000\221"
+	.ascii	"\250\336\341\214]eZ\247\256\201\244\020\026\230\003\203\201\021"
+	.ascii	"@\005,~\346\223\223]\200\313Uu{\253\235P"
+	.text
+	.section	.gnu.lto_fapplyDeadband.12.40044d3c085d4d13,"e",@progbits
+	.string	"(\265/\375`\025\001%\r"
+	.string	"\326XYB\020\257&\035`\225 \372S\226\325jF\3349\350?D\306:"
+	.string	"\355l\360\354\"wr\220\370\377\335_G\345o\214\230\206\023k\354v[)\002"
+	.string	""
+	.string	"*\200P\244>=&\252E)\264\037\326\356\275\245L)F"
+	.string	"D"
+	.string	"F"
+	.string	"\273U\200o\300?w"
+	.string	"\360O-|t\370\234\346\310\0279D\371\313\310P\356\034\007\211\033\200R\241\351d\245Tg\3404s\242\221\221\334\006J\205\346.O\223\314\224\271\361\330]gIV\341\336\334\266e\033\201}\007\001v\246a\246\337\267\337\275\345\327Lg\246\317\311\340\200\"\020w)\304\027\233\342\225`\261=\262;\366\306\242z\276%\2021vM\204\030\261[:\340\002\234?\333~\207{\030\3311n\273\220\341*&H\370P\263\001\031\263\004\004\211\366TS\205z\223\006R\306\037\206\345D\312\251\346\030\333)@5\301I\213\027\024\245L%\t\027\250\024U\315N\257\037/3\245LY\365z\227\273\r\030`L5#\031\355M$U\263\2571\306h]\t\237\220\365\361\261@\037\016\350\001\003\013\302\263\247\003DA\210uU!\354\2720O\025Z`]\225G\004Rup\030k"
+	.string	"\022U!\030&\252:\333^W\234\016j\256\220\021\361\036F\212\314)SM\324\036#J\262\333\335\205Oo:\221\002\030"
+	.ascii	"\177\b\030\326Q\033\013:\214\034Y0\003l\001u~\316\020\270\275"
+	.ascii	"Q\353(J\026\324;\267\214u\355\032\3704\241\20090\030\030\001"
+	.ascii	"T@\343g>9\331\005\270\\U\267\267\332\t\005"
+	.text
+	.section	.gnu.lto_devClear.13.40044d3c085d4d13,"e",@progbits
+	.string	"(\265/\375`\037"
+	.string	"\265\007"
+	.string	"R\31766`o\032\003T\276\021"
+	.string	"\207+Z"
+	.string	"\315\307\233\276\220\233\t\322\016E8\326\206\220\325\377\367\266\213{\354!w\0254&&x\305\316\003c\001\207@\336c\313-eJ\001\025\234\210\330L\343\221\370l\264\331\3314m\313fgb\243\315\214\363L\315A7\n\0167?\333\306\315\314w[\217^!R*Q\314\350\202[\013\2374\205\375w\250M.0\006J \2265\350\262\214-\250\325\213\b\306\264_\bF\217\326\326\3777z\255M6\264\004P,\n)\377F\f\314Ur%$\323\326\260\365\210I:\233@&\370=\021\225\377kh\002f\331\317\006\227%\346\202\313\262]\353\342\257t\237:4N\253\3773~\2703\354j\2278`D\n\031\002<\374/\034\2218\334\350\266\bm\031\332\242\004\t"
+	.ascii	"3C+\0258\b7d\002+\230w\t\240YM\001wy\321N2"
+	.text
+	.section	.gnu.lto_devPush.14.40044d3c085d4d13,"e",@progbits
+	.string	"(\265/\375`\302\002e\022"
+	.string	"\006\241rF\360\320&\035X2\356}\036\267\375\376\353\277\347\020\373\253\273g\257\345\227\177\232\237R:vi.R\373\303\207n\250\244\241A\347\266\r\177\002\315\254\204\334\300rD)\222\321~\260\313\204T\255R\304\022B\310\336R\246\024]"
+	.string	"P"
+	.string	"f"
+	.string	"$~\223:l\345\001vahvvc!F\300=:v\017\355\221\273"
+	.string	"\355\321){\306c2{\331\314\005\331\321\356~\n\342\251G\250\231\362\237\363\256\345byt9$\271\\\256\360\343\005\304\241\344j\201\036C\037d<\347\211\301\265\312\334\022\354\256\263\345\332pk\267\275\300\266\210\255#\001\271\303\216\261\244\306\330\207\273\273V\030\3738\277\351\260\277\224i/\323\244Lw\231\3462\275eZ\313t\3144\314\264j:5\375\001\236\206\241\217\242\335\f;r\254P\354\241\261}\317v\306^\"u\034\317\334\355\256\320\331\331\335\020\207p\217\006\340\323~:X4TM\n5\312X#x<S\335^\202n\300\222\247\306\220\0078;`\243\236\"\366"
+	.string	"\035\035I8\212R\022\231\324N\271\216g\005\272\032 \233\016\027\321z\t\251\306\030\344\251\036791Z\022\207SO"
+	.string	"\220y\313\b\344\327\324\023\261^+O\270\t\373p\273;\342\313\032T\340fV\264\307\253\252~l`\252\026N\301\304\201\272D$\345\201\n\311\351;A\235N\250\222\357\004\002\311\351+AI\371D\b\030\025\301\004\345SA\241P>/\266\207\2530V\340\022R\351*z\352\302F\313H\305\202A\210\242\226\221\247\366\351?$\345\324\353\024*\251fe\322N7\030>\234n//l`\233\nMU7\205A\254WT\250\232\236\325\"5\252\0267 \220\002\221\271:\017cB\377H\f\261\035\252H\366.\2551\323\312Pj\242\226\2107\270+\277\3362\273\272\256j"
+	.string	"\206+\255\206\240\303\272"
+	.ascii	"\311\316\256\213\300rz\035\232O\267\234E.\020\275\216{\336H\252"
+	.ascii	"\240s\255\b\n\342k\211\221\337C\202\321\306m\337\242D\357\225"
+	.ascii	"8\210\372@H9\216\347\3304\277\3116@v\251\220\r\232?\342\310\350"
+	.ascii	"\214\321\025ip\312\340\345n\223ou5Z\270\007"
+	.text
+	.section	.gnu.lto_devVariance.15.40044d3c085d4d13,"e",@progbits
+	.string	"(\265/\375`\351"
+	.string	"\035\f"
+	.string	"\006\230S? Q\224\016\f\301\260]\022\320\376\300\370\240\325\030n\004\232\205\251\326\314\034M\231\323 <\372\240\374\026\333v\267UO2\322\246\013\t"
+	.string	"\025\f\020\020\251N\342\206\331\031N4\r\362\311\336R\246\024D"
+	.string	"="
+	.string	"A"
+	.ascii	"\251\267 QAD\215\335\305"
+	.string	"(/`=\302\017\260\036U\303\267C\315\315?\215\224\013R\007:\004\320\231\256prBa\n\320\211 \202U\006\030\007\361,u\\f\204\301\356:I\335\205;\336v\003\333\025\373\021\002\336\037\321t\3244\314\264j:3}\016\t\206Ue\305\256\205\357\306\262\210&:\330\336l\211\355\247\375\217\177\330\356}.`\027\345Qb\327S\340\004\327\243\275\313\266\357\341\036\233\255\202\336\206\237-j\315\030\2358w>\302\252\324\003O\016\244\323J\265\303\225_5\006\210\nQ\332\260-\341!\034r\355\356\002\037dC\341J=\372\037\353\361J\340\305G(?\333\003\245v\330\207\253([\323\327\003\0232\016\324\030K\347\201\347\222a\032-\3134\f\246\201p\3110\f\247\203Y&\3266\031\016\346\3214\016&\361\366\212r\246U\266\323@\324\222\355\250\224\220r\020BM\2754\222bt\202\313\317\252Pc\310HF(\003\023"
+	.ascii	"\022\0230\245\346+\032>d\305\346\3420\021\006\325\260\240\020"
+	.ascii	"\334A\013$,\037_7i\026s!'\250\031\354\310\330\203v#)\2011\357"
+	.ascii	"\324h\025\024"
+	.text
+	.section	.gnu.lto_devStandardDeviation.16.40044d3c085d4d13,"e",@progbits
+	.string	"(\265/\375`/\001\335\r"
+	.string	"F[_D"
+	.string	"\2216\03587\264C\350NGn\214\001!\25680\2408O\371N\310\322\005d'e\004\304Gx\223\347\217M\221\023\364\237Q\203F?\250\252\252\365\277\344Z\243\265y\230\270"
+	.string	"\306\215\326f\335\310\336R\246\024M"
+	.string	"G"
+	.string	"O"
+	.string	"\036\376\201\263\303\b^Hy\213PB\210\031s\316l\343\003\252\313x\001\325\345Z8\367\270\312\371gy\344\200!\364\276\222G\315w\362\215\033\222\212\023"
+	.string	"_(r\234*\240n\272\216\276N\325B0\347\264z\237\311-o;\201\355\016\373*\001%;\2523Q}E\265\265\352*\252eT\307U\357\301_5\330\206\223\307\313\234\024R5f\214<\241\342\273\3344\362\026o\013\n\033\261\261s6\246\366W\016\202;H\362"
+	.string	"s\226H\230\230\023\364\260\201\353\322\340e\333\017{\255\265B\224\242Zk%\214(\006\347\273\325V2D\244NS\016>\302\241\334\002/4\203G:\355\242\270\343\273\013\303\205EHi\370&\177\376b\230k\316y\300\027\021\341\201\237r\351\223\354M\3470q\321a\005\244)\033\354tQ\354\307\271\001\020@\024\254;\234\317\002\221\017-\013\3314m\353d!\f>\264\254\343\371d\234\215\267\006 \236Ld\333<\031f\333 \350[\262\356\205\241P\224P\207\266\225@fG\266\343n\200\266\263F3kk[u/\356Y\376\t#\r1\241-\211\326\312\027"
+	.ascii	"I\214\211\245\005\020\3312-t\357Y.\307\373a\325@t\262\204\342"
+	.ascii	"\307\343\271\232\260\\\303\313n\0026\025:h\230\026\342z\r]2A"
+	.ascii	"\202*\034\334\215\244\032\244)\251\306\245\240"
+	.text
+	.section	.gnu.lto_degreesToRadians.17.40044d3c085d4d13,"e",@progbits
+	.string	"(\265/\375`<"
+	.string	"u\b"
+	.string	"\306\020<6Po\322\001\240\374.\212\352\\\277\370l~\022\355j\335\007\360[\325op\3037k\321\334lD\020\023\264\004\375\252\252\206\251\001\267\273\256=\030]L\265v\023)S\n,"
+	.string	"+"
+	.string	"*"
+	.string	")\022#1\273\0339\037\320\034Z\027\320\034j\306\273g\347_\344\326\t\007\314\t5zn\024v\327yBY\334z\333\006\266\021l\243\004[\361\311\254\n4\351\260\335\331\227\355L\373\252\207t\367 \fwS$%\273\333\361\001\300a@\332\366?\016\322\331+\313\323\3308KN\370\276\227\210]R\301U\365&\217R~N\275\336\344B\312\317\366F\251\030\366\255\325\013[\323z\357OM\037^\252\225N\313\006\241,\343\030\262\205\2151O\250A\364\321\"h\323\264\r\213 \207\217\0261.\024=\004\336\0362.\212\266\215\213\227\267\267U9$-\331\253S\314L\2446\n"
+	.ascii	"2\003\302\260R\b0\254.qM$\310\202p`\202\200\023O\252\025\223"
+	.ascii	"0\311"
+	.text
+	.section	.gnu.lto_scaleRange.18.40044d3c085d4d13,"e",@progbits
+	.string	"(\265/\375`\357\001%\020"
+	.string	"f\036jF\360\260(\035\352^\222\365\317\316\371\275\277<\326'u\2141\257q\3403\rq\347\f\256\367\276>\360O\321!\021G\355\b\022\205n\233\003\013\026R\236Y'\301y\211\f\270\037\241\177\250\217\002\300\377F\b![\312\224\002W"
+	.string	"T"
+	.string	"R"
+	.ascii	"\241]\361P\001ALN\001\230\032\002\241K\311\363/\246\261g\267"
+	.ascii	"\203\210\026\273;\300\002\272k\266}\227\237X\33141\f\341z\213"
+	.string	"\214V\314\306\356z$\027\331\256\305\217\266k\n\342\253\347\312\377\314c\315\013\207\305\205\362\344\016\354\256\223\305\205\341\326\333\016`\233\201\235\023\002\232\376h\332\223\351.\323\\\246\267Lk\231\216\231\326Lg\246/\362\f%Pl \261\330\265\260scch.F\\\366\317\236\366\312_\361\031\203f\266\211\253!\264+\261\031\260\005)\256bu\231m\276\254\013\236V,\247\306\356\226\\\263\202\260\373h\2231M\f/\030\233\252\206\364:,\022\232F\335t\344\006D5\035\321\371\320\250\\\352U5\322`\301Tr\307\036\232\032qt\350\265\301\353E+GJ\356\330!Jj\213\375\270\273k\375\340\321e\267\3500\177\310gw\350\341\017\362\227\377\3431\277\307e\376\016M\203\002\246;\370W\332T)\223\007\335W:\201)\r\365\201\tN`\212\243p\237H)\b*\023\312;\371P\250\357\344\235D0\241\274\023\230\362H"
+	.ascii	"\374I0\001=\325\367\201\036(\334\333#%IQ\025\203t\364Q\217\202"
+	.ascii	"\364,\016\037}\247\036\315\033\221\206\264S\003/\034\226\tNE"
+	.ascii	"\260\020\345\264\024* \340\2421\013\036\024\202\025P\006\374"
+	.ascii	"\260,\201\256\2114\330p\337\200\3551\331q\f\341\rfaP\034x\322"
+	.ascii	"Q\276\241\365\231\001\037\213w\352\232\224\021\213\006\336d\363"
+	.ascii	"\n-\224\244\207\342K\004-\264\031\300\346\fG\262N\300\256d\234"
+	.ascii	"\304\016\311:\021o\220\305\0010\217\251=d"
+	.text
+	.section	.gnu.lto_scaleRangef.19.40044d3c085d4d13,"e",@progbits
+	.string	"(\265/\375`b\001M\r"
+	.string	"\366\330XB\020q\233\016K\225\205R\026\327\031\370\225S\330\367O\020bC%*\376\027}\363\020G\206\257hP|}o\244\276D\355\327\007M\365\035\352\336\273 D\251\302;\201\013\320\250\013\242)2\353F\233\310\235RD"
+	.string	"M"
+	.string	"?"
+	.ascii	"\227\335\225\023-v\367\200\rX\217\266}\024O\301\331\337\344\215"
+	.ascii	" q\022\313\006\224\226\335\225\231\013\240\036\247\007\240\036"
+	.ascii	"U\304\271C\316\377\350\323\312G%d\244sX-\330]\303\220\021\017"
+	.ascii	"\267\336v\001\333\020\354\313\b\207\206\207>\200\177`QQBS\332"
+	.ascii	"\345P\262\2611\242\213"
+	.string	"\317C\277\350\320\346|\026\037\371\022\371\313d\340X\021\r-\240\007!\177V\247\303\200\216T\203\306\356v<\332A\212\277\211cE<$\fNn$0\231\201\300\023u\034\276\304\237\003/.\212Q9\352@P\257\226\036Fg\242RJ\241F\224\250\223^#|Vt \017,\331^\007j\b\373\323\356\256\025\204\257\207n\314M\376\313E\267u\357\257^\362S?\371\343S\376\351\320\032\233K\370\364\2408\333\307\004kz`\332\026\263\2515\300\264\255\272pc\232\215\002g\223I\220\231e\023\223 \0256\231\304\264Mj\bxZ\370\320$gNM^\336\336\2764\203A=\216\252z)$u$\030\265TU\301G\245\013   #9j\003\034\202\r(\003\272a\367\302\212\303|\023\215\036\n\234\260\021\372\246.\032\031\321f\340\215'3\261a{\226b\363\332\346\016W\262N`G2'\260#\031'\2007\300\342"
+	.ascii	"\236\307\32422"
+	.text
+	.section	.gnu.lto_normalizeV.20.40044d3c085d4d13,"e",@progbits
+	.string	"(\265/\375`:\002\305\020"
+	.string	"6\340mD\360t\224\016\250\307)\035R1045\305\347\310\272\215\201\300\215\"\352u\316\314Xl\223\267>\273.z\r\036\2373\0170\333\224\375\265<\221\312\227\001\202\031q \230\017\366\b\342\2065\335\366\t!{K\231RW"
+	.string	"Q"
+	.string	"]"
+	.string	"\3603R\362\264\337\342.P\177Yy\200\335\327\214\231\335\257\304\t\266G\177'\220=n\027\220=\032e\373\370wb\017K\302\001Vdw95q\324\241&\312\327N8-W\352P\304\365\343Z\301\320\356\036\366\364\340Rej'\273\353l\271B\334\361\266!\330v`gK\366\341\356\256\365e\377\373\001<\346\006\375\345\377d\332\223\351N\2469\231\3362\255e:\313t\3144\314\264f:3\375\001\237\0248\270\330\356\207\330\221\265\2114-\217\371\355\037f\217\377\3420\250\307XfK\201(\300\272\351"
+	.ascii	"dw\025<\232\301\366\030\nj`D\013\f\217U\0321'7\265\273\f\331"
+	.ascii	"[ \r\2554eM\243n\372!\231f\252\251\206\344t\032\231>\200\232"
+	.ascii	"\032\025\346`\221Pe\314\252\252Pc\017\r\227\241\272`\307\365"
+	.ascii	"\232\2527X+T\336\360\030\226\331v\267\201\017c\202\312\206b%"
+	.ascii	"{\274F!0\026/,\031\263\277Tj\211)^\205\322\350B\346\235F\024"
+	.ascii	"\240\310tR\213LN)\036\n\211+u$R'\342J\026PH\234\310t\342L\016"
+	.ascii	"\270\30302q^\327\2318\317\267\207\253/GPa\303\242*\350Q\033\231"
+	.ascii	"z\324s!\322Q\032\325\216z.?X5\034\235\221\240\362\321\2215ZA"
+	.ascii	"@z\345\250\347r\303\252Q\345\356\246T\306v\"\330\002) \240\202"
+	.ascii	"\031\261\341\003\263\320\216\307\020j(\312\366\256h\\\263\262"
+	.ascii	"\332\266\r\332\0250K\313[\321\fb\316&B\222\024\260\251,\366\f"
+	.ascii	"LJ[\0341\341\220:AX\230pS\232w\304o\020\313T\\T\fA4\023\013v"
+	.ascii	"D6\257v\f.\212\0073\214\b\200(\340K\032\260x\271\355\352z"
+	.text
+	.section	.gnu.lto_buildRotationMatrix.21.40044d3c085d4d13,"e",@progbits
+	.string	"(\265/\375`\342\013\375/"
+	.string	":T\320\021D`\236J:303[\177<\230\367%gpB\026uf\270\326w\004S#\2259\204\370N\264N\342\205\357\347\241\021\255\fwI,\237i\243\360j\236\255\253\242\355\360\322\331\377\336\336\257\325\326\310&D\312$\003\023\001\347"
+	.string	"\n\001{{>28\037J\272\345\261\354\263,\221\n\231\004$hP\374\312\372\370P\276U\271\225\023\227\262Jov\224ti\232\236\330%\376\334E\261\247\262D\024\237\242\302L\365R3\310\336\027:9\032\204?\353\233\334\311\237<\312\022\241\270U\320+2!o\227\004\206i\272eI\025-\341\231\374\216\354x\273\024\276P+\3221\004n0M\323\247\237[%\374I\300d;\026FA\251\331]\232\361\274{\272+!{\235\213\013\245i\334\262J\232\332Em\223\360\347\332\235\250\376\024\036@\375\271d\273jn'\227\336I\333Y\0239i\232\032{\310\311^\374\361!\366\f\205h=\315f\262\375\243|\210\266\366\342E\345\177\340\004\225\354\363v\242\233\2307\356i\373\360a\324x\374\265\261\260"
+	.string	"\020\033lG\317\372^`N\215\215\253\216\2370\370\222l\342x\233N\312>\034\3055\244I\004&\b\232g9\247\255\2311\243Yi\232.\243\255\331\370\002}w\361\354n\207]b\212\335w\3139ue\234g\327\016\311-d\367f\332q\273\225w\253\362j\241\274Y(/\204c\371>\250\274X\225\327A\345\275By\255P\336\006\337\373VU^\252\312\313"
+	.string	"\345]\200\362*\270\227o\202\312;Uy\021T\336\003(\257\021\345\225\272\3377\252\362BU\336'\224\327\t\345m:\340\327@\345e\272\335/\340x_\245\347}\223\256\367E:\224\357\321\003\277F(o"
+	.string	"\224\267\250\362\022U\336\241\327\375"
+	.ascii	"*\257P\345\r\252\274@\225\267Xy\177*\257O\345%V\336\236\312;"
+	.ascii	"\254\274\302\312\213V\336Zy\317\312kV\336\256\274\\y\037\241"
+	.ascii	"\003\331\206\270\265\240]Z#\217\235\364\313y\305\310\261\374"
+	.ascii	"{\277\227\337\357\007\374\003\177\274?\357\327\373\241\274g\367"
+	.ascii	"\201{\301#\200{1a\300\020\361\333\377\311y\331\367u\341\022\027"
+	.ascii	"D}\301\037\342S[\317\007\017U\024\240\213\214:@\267Q_\320\207"
+	.ascii	"\251\367\200O}1\304\341S\233\360\203G\340\324\324N\006\272\211"
+	.string	"\251\r\364\305t3\365\301p\370\0349MD\251\244\256\207{\357w\240\3777D\237\332\352\007Oe\224jcTKqG\365\377\204S\275\367\302\240\337\207\236Om\346\007\357`\201\202^\220\240\025Lu\202~\337\321\234{\252\317\205\353n\332p?\312\371\r.N\251\244\256\276\367{WYf\247\331ZOm\274\313\245\255N[5\267z\2327h\253\252n\360\256\352\363\231E\306\352=\026\020!\352\321\264\332\354\027l\345\r\230\037\335B\326\356&jV{\270\3633c:K\340&*\204\316\352'\0374\204>\363\326\234\341\301\352\007\375,_\332\023L\372\225-\377\344\f\316\227t\331,M\313\226\336X}+\027\302C\002\346)\221\353\3653\273,\312\355\216\270\231/a\232\246\f\312\\8\016\220#\362s\357\242\376|c`^)L\261c\227\330\261K\230\002\314Kl\005\230\227\230\020\354\3505\3065v\f\023r\215\221"
+	.ascii	"\361\341\334.)1\021c\\_F\260\343\327\327\261\313\b\346\305\365"
+	.ascii	"e"
+	.string	"\354\n\0233J!\355\261\004\2100\343\330\361\030f$\226\335\3749\347\322\234-}>\370\241N\243\300\343KY#W\250\177\370\350\261\325T-\324-\350\376\202\032\356\315-\251\201:H\211\324@|E\036l;~Z\251\213m\216I\0369\352\237~\025\272\245O\016\0347\210\355\323}\207\330atN\222=\275\246Vc\330G\335sD\251\207y\222s\302\2461#\r\251\321\026\266\251%\251Lj\264O\227$\016\202N\262\214\030g_-\365\347\331\306o\016[\215b3Fr\331P\237]\273\357$\347\220g\207%\021L\232\315\351.\211\310\354.\324\363X\030\222K\323\264\n\303\361d\270#aC\221\f\213\372\223\357\240\261\241j\2506\273E\222\277\241V\352\253(\016\032\252\223\372\352n\250\221\332\252Nrn\253\241\372h\t\220\017)\2307\207,v\357\003\003\200\334\250Q@$\225R\246FD\244\240 I!\215\001"
+	.ascii	"\003\021\231\352\034\022`SE\n\203JAl*\243\240<\r\233\001\200"
+	.ascii	" \32690\020\306q;\2453<}\250\226\347\276\246M\036j\303\325\033"
+	.ascii	"\027t\260\240QIK/\217\213q\322&_.Biu\254\f\215\023#\204\022\310"
+	.ascii	"\325\221\257\321\2323\225ts\243\204\216\035\304\236N\371`\344"
+	.ascii	"9\221\360\256\272@\177\307\301\325b\363\025\017\332\033(@\033"
+	.ascii	"\3240\001\n+}m\022\371;P\0330\345\300\224X\364/\216\r\034\017"
+	.ascii	"\344\fJX\n\t\355\233\327\361\222\306Y\361J\335$(/eX\276\300C"
+	.ascii	"Nn\326\2007c\275\2049s\356\354k\"d\326e\035x\363\366\265\255"
+	.ascii	"\2447-ik\235;\373\002\b9\271\254\003o\376\372\ts\346\334\331"
+	.ascii	"\327D\310\254k\353h\300\315\337\255\007\341TF\315\211\031\244"
+	.ascii	"\241\200\215\343\021\350J\205\272\013\031\253$\354X<\356\301"
+	.ascii	"N\f\276\321MC\233\370f\375\350\020\372B\356\261v\220\233O\025"
+	.ascii	"\344\276\245!\021\307\260\013ic(\222D\234\025\330v5Z\027Q\350"
+	.ascii	"O\273\032\255\033R\"\340\363\257\273\034\007b\001\330A\244\322"
+	.ascii	"\353\317\036\001b[\\\243\277O` @\366\204\037\214D\007D\316\341"
+	.ascii	"\032\324\301\2049-F\341\216bC\314\243\\k\304h\317\001l@\005\005"
+	.ascii	"\002\325E\204\304M\360;n\002l\272\253\377\225pRC\035\332\212"
+	.ascii	"\021\310\024K\375\003"
+	.text
+	.section	.gnu.lto_applyRotation.22.40044d3c085d4d13,"e",@progbits
+	.string	"(\265/\375`\251\005]\032"
+	.string	"\206m\236I\240\230Q:B\354\005\036\236Z\307\345\334\361\202\n\305\221d\250\013\037\306\211I\365\301\223&O\373$|\243\366\337C\370\327n\245\0326\371uRI\203\017\276\234\002\275\201\307\232\034\013]\252\237y\364\217\366_\366\311&\261r\247\024\203"
+	.string	"y"
+	.string	"\220"
+	.ascii	">\376\303\367!\227\256\265\b\276\240\241\242\376\352\215%\220"
+	.ascii	"\027k\251\307F\021\347\341\322\r.\372:\276\303w!\022\344OE\205"
+	.ascii	"\036B\242\324Zo.\372\201\022k\355\257l\317`\t\247\233O\373@\307"
+	.ascii	"\341{\220\201\034V\353\017\220Q\255A\005F@^t\360\262\361\"\371"
+	.ascii	"\330x\321>\373\351A`}\023 (\204\256\324Zm+\343\276O\237\377\034"
+	.ascii	"W"
+	.string	"\371\254\370}\322\t\265VO\237\025,\356\275m\002\2663\330\343\201v\36077\206\375T\335\037\373F\277\315\213~\002\037\372\007\334\350\256y\321]{\360\007\360\241\233\366\240\177F\247g\350\264\f\235\216\241\3232:\rC\247ct\372\205N\303\350\264\013\235~\321i\027\235n\321i\026\235^\321\351\026:\255\242\323$\235\246tz\244\323\"\235N\321\351\245\323\223N\277\300\013\b\t\204a\255)\206Y\252\222xT\2434\272\300#*\242@\206x\017\373\001d\353U|\246\320\025\227\\\232\260f\307\245K\023\265\344\362\302'\371\222\234;\001\2250\231w\322xq\334\013\233R;&\235pQ\333\335\324\316\226\224\\\236\b\250\340Gr\316\203\311\310\205\200\273'\232A\333\357\\\261\350\204\215\2369t\021\227\006\230l'8\221\234\002\300Z\253\003\334\207\200 \205P\310\t(1^\374\032h:\n\3422\002RM\210'\271d"
+	.string	"\243\206\344rEE\330\300?\262@\""
+	.ascii	"\023\215\213\276n\274H[Q\211\023T\220\2119\f\035lvr\032xF\016"
+	.ascii	"\033l\306\235\234\006\236\324\b\334\256w\273\240\243\303\365"
+	.ascii	"n=\335\316\305s\343,\340}\350\335r6\035].\247\303\261\351\340"
+	.ascii	"n9\033\316\216g[@\263n\307\303\316\326\323\351v\266U\260~\177"
+	.ascii	"\214\001\207\222\211\355\361\314\332\274\331#\263\262\235\211"
+	.ascii	"Y\231\245\211\232\277Y\20710\373\262\262\330\302\354l)*\013\226"
+	.ascii	"\030l_\240\256X\201A\271l\225\327\266\326\305\265\257\245\211"
+	.ascii	"\2422E\212\213\265-\333Z-kgKP\236\204+\325\266<q\322\244Z\025"
+	.ascii	"\322\323\rr\233\270\fh\250Q`e\024TRJ\2222\222\2441\300\002\221"
+	.ascii	"\031#;\021\360\244\"J!h\b\225Q\220\273\001\242$\016Bg\315?\021"
+	.ascii	"\030\002\004\326\364\351\324\214tpH\005\3273\354\205\226<\221"
+	.ascii	"{\200\207\305\322,tGl\335! \345\352z;\233%x\313\347\016\342p"
+	.ascii	"BE\255\275\303Kn\300\345\027\006~Y\250\021\n\325C`R2/\177})\206"
+	.ascii	"B\230uA\237\007ge\310;\tIo~\222\025[;z\245\323u\324PMu\203\235"
+	.ascii	"\020b\016\326\262[\0070\bs\371\373\205\245\026\346\007\326\255"
+	.ascii	"\364\036\203\221Y\312/\373~\222cfr\304;\307\007\344<\3178$\212"
+	.ascii	"\250!\371@\tM9!%\254`,\273\006\033\260-GP\200\374\241\233.\212"
+	.ascii	"E\005"
+	.text
+	.section	.gnu.lto_rotateV.23.40044d3c085d4d13,"e",@progbits
+	.string	"(\265/\375`\210"
+	.string	"E\n"
+	.string	"vSG=\020\0059\035"
+	.string	"\017>\241\247!\205\301b\034\353\024\370\365\017\240"
+	.string	"\245m\005\200\177?9\254\330\310\0325J0\322U^\360\013"
+	.string	"\264\006\020\303\b\034\203\276\361\f\344\331t8\212~\243\275S\n1"
+	.string	"6"
+	.string	"5"
+	.string	"\257&o\320y\325^\320yuh\327\234$\331\253\314x\224"
+	.string	"vw\243\255\207\237\241\377\362\001\343J\374\3644\354\256\347\270\002\271\351m\037\330\036\331\007\005\033\253.%\207\375v\350\227\376\370\257\243\204\207\2454Q\365\320\242\221\355\252B\257^\320^g\b\302$3dB\237\366M~\022\336\245q\202]\326J\313.\251\340\004-)\316\256\310H\366\2323{\346S^\242\264\221R\273\342b~\364d\201\211uP\321&\305IG\354svwMY\366\311\237\336\365\317\316\200M\f\303\313\356\307,@\030\246\017\344\034N\236\t\344@\357\023\340\300\211RD\265\270I\"\224\004\310u\333\311\353:\217\264\235L\\\267\221>\324&\002\331\243(}\033\350y\337\366!\367\234\245,C\334\3046(\207\003\020"
+	.ascii	"3C3\215\341\217\370\274\210\257nB\003\327@\237\211\022.\034\356"
+	.ascii	"1\2010P\r\\\001s\003T\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_quickMedianFilter3.24.40044d3c085d4d13,"e",@progbits
+	.string	"(\265/\375`\312\003\245\027"
+	.string	"\306i\216I\3200'\035Z \323\r\356C\313!~\204k\347<u:\024\237D\206/C\025\322N\006\216\373\254o8\277\210\255m\t\353\261z/\271\370B=\214RO\213F\351\201\210\311g}`\244\230-k\353Bj\215\020\262\267\224I\006{"
+	.string	"s"
+	.string	"y"
+	.string	"\237:\206\367\360\0173\245\311\321\002\356\323I\250\331\321\350n\230\353\254\357S\376\343\373\344\n\312\227\343U.\355\342J\025\202\337\224\2744=h\"; \255\270\341j\027}\276\362\351Y\225\310O\016\317C'\034\036\021!\234\235\005'\374\223\256\032\351\332\321\354\224\002\272;"
+	.ascii	".\202<\26068\231\225\032t\316?\272\\B\342\335p:_\320\244\273"
+	.ascii	"uo\270\234+\307U\325IUKT\031C\265}3\220*\310\307\277\245\253"
+	.ascii	"\254\363\256\342\\]\315U\325\\\r\347*8W\277\271:\347\252\334"
+	.ascii	"U\226\253+W\037\3421\304\202\301\214\356\233\236\215n\232J\031"
+	.ascii	"\316\373\215~\021\372#\025\365<ZX\303\tyP;\257\360S\252\316\364"
+	.ascii	";\025\225\350E\263\033\301\2045\234\005\272\233\250\356\036\371"
+	.ascii	"\324\221&\216]\325\203x\210\331\307\230wt\003%\235\350\036_j"
+	.ascii	" \f9\375x\262\203\"\0253;\365\372x\200\216\344;Z\310\337\235"
+	.ascii	"\300\222\t\016J\266\355M\316\251*\210A\030\274\355\310E\266\271"
+	.ascii	"T\221\213\231\235\272\354\356\226\234;\355\023\031\204"
+	.string	"%\023\r\005V\325\224\357h\005\236\272;\301d\272\305\320'A\240\205\027\3641|\233\036\333\366t\271\305\314\247\331 \257)\276\363\362i\204d\266\247\"\237\177\3649\204\304\253\271a\333\036sw\327\230s\252c*g\371\203+J\211K\312\313I\f\266\"\213\305d(\260\025\225\223\030\f\245\305\005V\022\2422\226\006-\260\027\231\254\005&\216\3757\003\261\330ec\031\205\221\335?\nn\364G\021\275X5TT1\f\022\377\220\002W\234\323\025\253\270\025\264\342\275A\242\362\220\372T\341\226\030\361\325\311\220!\3474d\220\001L\241\330+\323\367\031\362_\200\374\335;Z@18\371\274$\335\316\307\b\236\216\364\226\216\335\375q[\250qP\247\234\251\200DDR\220\202\244\325\200\002\231\252\253\007\021p\2714y3\354\006b\330D|[a\270PB\351\345\3434\312\213\352\226\364\211\222t\020\263\237j\001\267\370\022\205\275"
+	.string	"u\t\323\330\363\342\373\255\026`v\370\213|+=8\bY=\314\353\200#\033\206\334~\b\203@\327\246\311\200\241\213v\240\250\234u\363\254C\360z"
+	.ascii	"\210%\360\241\034\340\005}\232\020,g\316\t\312\220\037\300\f"
+	.ascii	"\214\237\220\361&\244~\001+\f\004\224\203/Z\251\247\201\333g"
+	.ascii	"\370\200C\204\354\024\274\004\303\302L\031\333@\325\327x\360"
+	.ascii	"\002I\300JXc<\323m\311H3\004 3\331T\r"
+	.text
+	.section	.gnu.lto_quickMedianFilter5.25.40044d3c085d4d13,"e",@progbits
+	.string	"(\265/\375`\252\006\025\037"
+	.string	"\3663\262H\260XQ:\360\270\357\021S}\2325\354\n\277h\232\330\331FO\355\206\326\232\177\223\240\271:\321&\332b\251\250W\033{0aa\376ll\254\375\240\262\361\360w\360\363n'\334F\306\027\267Y\373\337\376o\204\220M\244L)\243"
+	.string	"\215"
+	.string	"\234"
+	.string	"\322\274\3617.D\343\033\310\373\311\205\273\236\234\036\2259\247\215\345\001\302K\360\262\360r[X\036\344\335\240\336.\213\301^\256\026k\245J\241F1\224\340\352\315\027\031\2006\216\246\340r5\227\271x\314\005\220\302v\177\355~\324\245\342-\025=\312J\361U\n\024\252:\361\324\t\023\212*\300\"D\211\217JvJ\024\b\332\341Q\221\304\303V.\007d\351\341\250\004S\276\037I\255\234\007\020\001PP\214\033]ur7\n\306\030\361\275\321A!GI\270\334\210\253\310`\316i\305\345B\334"
+	.string	"n?\203\355\232-\237\002\272>\276\027N\250x}\354\331y\277\213\325-/\272eR\035\223j\230T\277\244\332%\325-\251fI\365J\252UR\235\222j\224T\217R-Ju(\325R\252AU/\250VP\375\227\330R\022\007\2779A\374\254L$R\t\306\213~\242\177\207od\225_t\033kv\306\"&;\332x9\3324~\317*\353\370\020\315\2116\2145;\rv?P\346\234\263K\317\306\313\257"
+	.ascii	"\240j\037\307s\320\234\307\341\2609}\220\200\314\311\243\331"
+	.ascii	"e|\227\343\336IM\334\367\016[\302d\305\325\355\213\220v<\341"
+	.ascii	"&h:\217\01780d\206P\270:\207+\227\302\320"
+	.string	"R\007}\242\205+`\367\362\336m\334\367n@\210\257\212\222\215\376\344\352\214\002\332\331\2128\235]\266:\362NCM:\350\323\3019\347\004W\367[(\333\331\202>\234\236\265\375\340\275[K\323\234S\201\364\341\242\370J\032n\343\013\237\303^\307\204\215\376\254\353\262\273\307\221\001\336E\302\257\356q\202n\364g\331~otI\343()\347\212\215\376v\201\202\210\370\260\253\263y5\001\023n\341\031n\230\332\005\t\030 \304\330*\310\304\304\310\300\330*L\200\020c\203\231\271`\253\021\260\214\205\b36\f2236\025o~}Z\226\305fo\274\001\234\223\305\202\023\375Pt\350\317-Dj\310`\233t\030\322\216'\026[\030S\fV\305\260\325-!]\205|\270(\257\327\272^.\027\213\251E\373\321j-\213I[4\326\262VG\363\261Z\235W\253Z\n+\232jH\r\253P\373\244\307eNb*\265\250\035"
+	.string	"TK\255^yA\305\234B\224\270G\232t\311\216g\\\365qt\335I\001\307\325y\\qYOF\300\333\027\006\200\233\250\221PF\221\220\214\210\024\024\244 i5\320\002\221\251\252\007\022`\204=\007\305\350HJZh\375\357\"D\207.X\371][\035\013\222\263c8\037l9\367\001\211\257\374\244\341\252GB\b\226\207\032\372\026\032\360@\202KH\032E\310\025\033IVj7\031\333g\225\242\237\226~\006\201[\354\336\306\031u\325\346w\241\bv\264\201XM\r\333q\355\206F\240\266\246\236}\t0\223\235\262\374\370\032 \264\365\022o+\023\032\223-t-u"
+	.string	"9\360\3429\273\005\3567\027\340o\310y\301\327\002G\251S\230\303N\325\322L\265\354Z\177\277\220\220\223i\b\270\243\234\326-~\344:U\252\003\"\227\f\214\t\274{\0359\005\323\264\320\364\242\363\225F\031\361\0071y1\202&jCV\2036B+\300\311\034\224\374\202\372\265\n\315|c)\352`\252Vh\310\301\256bS"
+	.string	"\372\341\242"
+	.ascii	"\271~\227d\334`\303P3\236\3604\316y\013\246X\024\334f\202X\231"
+	.ascii	"%\340:\2234\253\001"
+	.text
+	.section	.gnu.lto_quickMedianFilter7.26.40044d3c085d4d13,"e",@progbits
+	.string	"(\265/\375`\027\013\315("
+	.string	"\212@\270\rJ\260\224U:\370\236=O\021@c!\016jNe\302\3300/\030\235\203\317\br\210\300FS$\\\f\306p\212e\313\367\252H\206\305G\351Ni\377\t\242\326\3027\366\364jY\322O\304\006\264m\333\266m\333\266\222F6\2212\311\320"
+	.string	"\262"
+	.string	"\303"
+	.string	"\346\351\032\315\037\035\tg\211\244\021EPY4\3529R\251\265\016]\216+O\311\333\312\323>\261\253\223\306/\311\304\003[X~\276\036o\247\313\341n\266\032m&\213\301^\256\026\313\\\225\224l&\356W0d\f\034E|\202r\016LzK\322\ff\221\361\237\f$\366\035\275w\024\203yF\337\031\301`]\321sE,\030\267\342\267\025*\330\226\342\265\024DL+~VD\301\262\022\217\225 \301\260\021\177\215\020\301\256\020o\205"
+	.string	"\301,"
+	.string	"&8|\270\211\004\350\003"
+	.ascii	"\027@B\274\362\360\222t\351!]\216<LI\263\326\032\013\312@\032"
+	.ascii	"\340\237\240\035&[tx\277\351$\020')\237\240\016\347\025L\255"
+	.ascii	"u\331'\210\303\327\345\273\274`w\205\273,\r\0019\335\347\256"
+	.ascii	"1\207{\310\330C\27327\376\b"
+	.string	"\2267\346L_ \345m\241\274,\224\367Gy}\224\267Gyy\224wGyu\2247Gyq\224\367Fym\224\267Fyi\224wFye\2247Fya\224\367Ey]\224\267EyY\224\327\244\274+\312[R^JyI\346m\222\227I\336'\260\t\035Q\020\244\326\rUV\252\021\352\243\350L\377\322_c\337\264\256=\023\321\314\0012\231\226 \005\315\323\330.\316\376\270\256\245q%\234/Y0s\200d\212GQj\255/\247\373b\236\336\310\217y\3673\236\204s\343\205\323j\035\322\301\243Vcp\007\004Pz\252\325\r\345tFzZ\265\372\334V\263ZG$U\266\232\257\004Y\265\251\222\325\247\220\bG\231\214\343\306\2718\2054\373\\\263W\r\243\022\232}'\253\376\361\264\250%\275\242}&\035E\241\262\013\334\306ue\237[6m\032%(\fL\265P\337\247\362\264\354\\\221\300\217D\263\177|"
+	.string	" E\214|\350p\025\355sYD-\323+\037~9\260\177>\245\304\004\003S\235\254\265V\262\317\023K`\3134\371\304C\242w\027\346G\242"
+	.ascii	"%\265V\003\364\311G\312^H\005\242\251b\177\241\377\003B\207\253"
+	.ascii	"\226\033Aw\237\347\005\371\035R\276\271\317\343b\207\253\026"
+	.ascii	"\330\3577\235\302p\222\352\271\242\303U\335\306Z\003\017\036"
+	.ascii	"\341\024\2763B\t\016&0\250\031B\260\251\251\261\231\031Bx\300"
+	.ascii	"\240f8s#a(\354\255M\204\0067\303\t667C\227\261~\215=\024\323"
+	.ascii	".:\275\263\026\310ZM\034\370\322\037\205FL\225\005\366\371t\335"
+	.ascii	"\323[\372\334\226fi\232\226\316"
+	.string	"\261$1Z\026\037\220\333\246V\277_\373ZG\364\363\225>^\367\202?\310^\237\333k^\303\250zA^\363\372\364q\335w}\356\256uM\263\353\334\023]T\225\325\365\331#\227k\234T\016\207\263\ty\334nm\273\365\235\330l4\251Z\357\250\325\232&UkB\2132\242\311\240fB\035\263>w\326\262\326\021\315\204\262R\006\013\022\311\361ZTQ(\026kX0\006\203\271\236\274\032\307\353\325\256'\344\253\t\273\252\254\213\325\001\201\003\250\241XE\221P \"\222\024\244$i\r1\006\204 tv\035\022\200\203-\210\305\214\"\221$\226\373\377\031\302\320\265{\235}\323\205[W\347;u+0\225X\037\177:\330\230\003\301\025\376\365\305\013\205\374\244\260\200J;\311\307\264'\326\326\213\"\254\241\332\027\250\3325\301%\365\334~y/\013{^Y\007\304\375\212\343</\rs^l\327h\n!5b\317\007\301\221"
+	.string	"\201\020\034\310qj\236\264\td\340N\354\025\251^3\213\341\034\371\341L\230zmbB\255\tH\002\030q\221\362W\372K\271&!S\324\r\260\3061I\274'N\366\325;?\353\311Y^_\352|\215c\tuxI\365Y\343\272W\370\356=\361}3\007\353\356\310\336\363\213=\243\272\354P&\363\362>\361\231\320\205\354y_\006\025\212\226\224a\321\314E9\324\313)\023\333L\363i?\263\344\243AHF\2047\232x_\373/\203\204Y\353kYH\345\037\217\266v\312\212%\256\372\353x\211\235\310\340y\204\nQ\231\231\252\246\213\342\rt"
+	.string	"\032\330TI\207,\377\216\027c3+\210\\_\235\245:\336\332P\002\200\233\001\303|\326NA\3067\003Z\322\371\004\224)s\371\20199*\013#\343\337\323\t\272D^\221)\214e\2749\b\370\205A\327R\t\361\205\374\b\313N5>vrE\224\252\352\251\234Z\225%\224,2\301\251U,\201\304*\027\016\215\302\026J\026\231\340\324*a\315(\366\034\201\301]\332\022;\331EK1\275\031"
+	.ascii	"F\271\251\307\374\001"
+	.text
+	.section	.gnu.lto_quickMedianFilter9.27.40044d3c085d4d13,"e",@progbits
+	.string	"(\265/\375`\210\017\2452"
+	.string	"zO"
+	.string	"\021J\240\226\231\016*H5\256#\"=\274=\303\036[\211\332\f-\254\264\322\214C\022\177\305<\322\023Ps\315c\354\270\235\206\374\206\271\204.\343\345x9:H\033\362\256;\271$\277\005\\-\337\005\337\005\374-\374w\223-wJ)\005\t\001\340"
+	.string	"\371"
+	.string	"k_n\256m\243o\350\2602m\252X\252\314$\rDXX\226M\002\373\246\366M\273\246\366\375\024\274\352\264\331\234\272\262\2211G\030c\2218\024\276\004\201?\027_\217\267\323\265\344p7[\2156\223\305`/W\213\265ZU\352M\337\225\334*\003i\215$$>\313\235F2u\f\223\022?.5\314R\0227*uQ)\311\211H=D:ra\220~\t\002\304\203?\032\370\303\310\177:\332EG\016\367\341\350\036\216\033\316\263\321;\0335\\7\324-C4<\367\242q/\\\370\255E\333Z\260\360\332\212\246\255\020\362\031\263eL\025\036+\321\260\022$\3745\242]#Dx+D\263B\200\360U\360D\207\240^\237\374\004\005c\374"
+	.ascii	"\271\352C\253\260\245\206\024H\324\3437Ue\004!\301\226\031R\002"
+	.ascii	"GPd\264Q\373\206\345\005Oax\350o\243N\215 )\371,=\264\253\f\260"
+	.ascii	",\313\356\263\354\320,\323\314\017\200\231i\230_\275\032\262"
+	.ascii	"\360\370\324\377\021\024\031A\377-ss\307\003\004\035A\371Q0\333"
+	.ascii	"t\263\273\206\235\023tQ3\362:\307\\\347\343u\206\271\316\306"
+	.ascii	"\353\\\274\316\304\353<\274\316\302\353\374r\235\203\327\031"
+	.ascii	"x\235\177\327\331\345:\373\256s\357:\363\256\363\356:\353\256"
+	.ascii	"s\313u\316]g"
+	.string	"\334u\276]g\333u\256]g\332u\236]g\331u\216]g\330u~]g\327un]g\326u^]\347\365:\253\256\263z\235\357uN\335\371SgO\235[A\355\210\023\004S,\313aJ\212mr\211\274\350\242\356\036\335>\270\215\270\305]\244\\w~\326\242(K3k_\033\263\0167\021\267xG\363\320\351\036\025\326\235\237\003\314$N,\313\"\3732r\355\353&\206\356\314\235\243u\350t\323B\317X\026E\222\020\226m\316\3601I*\231\354c\237\023\212\312\244\324X\354\005\205=\022\f\366/(\214\346\365\257\326\273d\216:\347l\327\267\354\372\326\337\314\270dZ\321!n}\353D\345\237X\377L\202\264\337p\252X\254_}N\310ie\275g\211\252V\264'u\245jZ\002}2\201\326\367# \355\314+\351\372-\257\257\372WTS\263\363[\n4U}\023\365\354\031\345U\367\273(\211\t\244\276"
+	.string	"h\377\350\234\356\b\312\f\365[V\377\376\r\017&\030<\212\237\336\354T\373\252\217c\3164\221r\375&j\241\221)PDx|\352~\313+\241\267y\225\217#\033\371\033\372\211G\023\006\217\352\224eY6\375\266\225*\362m>u\366\220xfV\252h\"\245\021\312\262\354\200\353\364\251\302\315\204\202re\301m\341{\003\b\036\237b\377\232\377\357\236\031i3\223\332\357\337=1.\370\024#\277\277\215\372\322@R\n\r\372AOh\266\241\211\300@B\rN\322A\016\016N\216M\322A\203\032\234\244\r\204\bI\232\035\347<X"
+	.ascii	"!)!'\007B\262\325d\373Q$x \317_\340\n)\313\236(\320=\272\235"
+	.ascii	"v$\2702\304\310"
+	.string	"o\231:\347\354\230o9\346\217\177\363\214y\334\321\n\324\321\bU\322\265'&\020\f\314\033?'\004\205y\317\"e4\022\237\305\245\264\370-\027\237\370\257\250g\361[\n\361\211\337&\031~\313\303\027\376Mt\3708\241\225!\026~\373D\362\362\362\301\246\227gP\r\376\226\034i\3323\005~\313\300\377\375+\n\370-\345\367\363\275\323\305\345}R.4>(\037/\332\203\032\351\365\236\027\355Ay*\357\333\246\"\273\335\353\234v:]\356\211\364,\211\t\324\362-\267|\356ohZdrT\206r7'\\t\210\n\207\373\333\347\204\234p\357Y\242\267[\255\311\366Bl\266\2575\331\240\265\332\214\246D\243\375\21463\203\232\305\2422\251\201d\250\201`e\221P \")(HI2\214\001\201\006\"CV\266\001\022`\262I\016N\031&&\222\032K\373\177\007a\034\266\370\226BJ\326\353\370\200\210\272W\315\366"
+	.string	"\2368S\270+\304\0332*\022\021\303\316&\361~\317w\305\247\264\322\346\001\251\242\201yUhM=\200\274\350\216\246d~,\315]7\300\303w~\033\243\261\230\247pm\271\263f\340\333\207\254\213\2735\230\313o\202\357\215\314\354\211\337\367\026^+\240 l<\n\376\253\313\310K4P=\203)\373&"
+	.string	"t\254%\373@\254\241KM\246@_\341\006\n\260.U\342\332\222\224G9\233\212\337\311\273\277w\314\372\2330v\352\326\256Yx\333\302\363\260\317`\366\210i{[J\020\313\257\373\002E1\206\332b\311'\224l\351k3\337\353\220{\307\276\313\370\231\032\200)Z\360\207\022nZ\321Atz.\346\355\264M\310[\251\264\337\254rE\277\002\206X\354\275\230i?\332wL?\313\032c\201\324\360\223\372\3568H\212/o\313;\221>\207y\340]\215eeo\bh\200\312\221\3012\312\314\006\303T\220\221\304\226\331\304?\324\310|\320\274\343%\224Mp%\212\025\206\353\312\216e\323&,kt\356\272(\006\021\273e\007E\203"
+	.string	"\003\001\023L^\237\220\310<\321\327\311\247-\351\016$\027\rX\326\226\360\bH\037\230\252\207\325\226\232\214\325>\375\026\023"
+	.string	"\302\310%bC\370\007\352\021\013\317\267\\\255}\335\321\214},\360\211\004\321\021\nR*@\372v\001_\024}\030\312)\343\372\003\003\224\025\3137cV\367\3114@x-bD\003\336\271\036\272\366\236\206\257\234@\231\300\324\323\323\220,\201M\345\263\371G\376D\310e\341\247\216\235$\376v\340K\204\\\026~\352\330I\342o\007\276D\310e\341\247\216\235$\376v\340KC\f\311\365J"
+	.ascii	"1\\.\306\366\235\3415\037\212\322O\200\364\230\226\343\037"
+	.text
+	.section	.gnu.lto_quickMedianFilter3f.28.40044d3c085d4d13,"e",@progbits
+	.string	"(\265/\375`\332\003\265\027"
+	.string	"\366\251\216H\340\322&\035R]"
+	.string	"<{\007\271K\210\261\255V\226\026\007\216\331}\240\243:\227\303\241\246\205M}p\207\207\323\372\017\0079M\214\003\3254\030\3068\207\033\214\031\247v\277\307\310b\003\252\320\301\352R\262\215\020\262\267\224)\005{"
+	.string	"r"
+	.string	"y"
+	.ascii	"\227\016\277\223x\t\227\215\213\241\006\016G\342\301cS\232s\256"
+	.ascii	"RGu\227\361%\335\345f\360>\206wT\327\301\223\351\363:\031W]\276"
+	.ascii	"\347\022G\340h\310h\257\203\026~\262PAM*\030|(\374\2731\243\240"
+	.ascii	"\362a\006\244\336\204w1\305\023S\266\230\312(`\316\031\200\026"
+	.ascii	"!\036\320\036\232\216F\017?\337\027=\302\300\335d\264\237\253"
+	.ascii	"\3472\347\264\312h>\367\310m\337\260\335b\257\211/\375\334 \033"
+	.ascii	"\345\341\177\"\325\250\337nP\252ORm\222\352O\252=\251\356\244"
+	.ascii	"ZJu\274z\243Z\243\372)%J6\030\004\231SBn\310\254!_t\370\355'"
+	.ascii	"z\n\277\310\240\177\303\371^\263\357\206\244\244\372.\243\355"
+	.ascii	"\362m\006m\024\037r\235(\347{\315\026 \365\3601\347\\\271\364"
+	.ascii	"J\215\221\253}\023?\341zh\243\223\314\031\304\302\305\234\241"
+	.ascii	"\312\006\276[s\267r\035\f\315\330\321%U\267&B,\337\336v\0020"
+	.ascii	"\210\210x\001\323\234\334\232M\033\026e=\231\256\034\334"
+	.string	"\236\003\031\322\261\243K\217s\316\031\267v\234\016\\\224\215G\261\013k;\3466\343\n\344\230s&\220G\262$\337\b\202q\037\007\337F\373\236\n0\315Y\367dw\037\003\021o\031\335W\367\261\017:\2323\270\337\027]\206\300\335x\212\3004\267;\347|\355\326\35402\247\371\203\033\246\305&\346\346\205\265\232i\261X-\230\325\214\314\013k\005Sc\263jIq\213\246A\315\352\246\325\252Y\201\341\374\347\006\2416\005[\035\347\30491(8\321\357\003\205\n%\304\240iw\260xI\017\357\2645\237\326\264&K\247\325!,\246\001?:\323\247+\256BG\361\333\232\277\365\026@R\f\275\217\3668\274\275\355$4\220\326\223\252\247h!\004\324-\202\034W\361\023\233,\t\2469\207s\316.]\250aX\246\230!!\031\221\202\244 i5\240\002\231*\243\007\021\2009$\305\263l\006\"\314\214T\276!|\374\216\304"
+	.ascii	"\323\332\360\343\275\217=8\215*\224\370\350\306\336\356AgG\205"
+	.ascii	"r-\307\205\357\315\207\200C8.Ol\222#\306\243\275\211o A\226~"
+	.ascii	"\035\240\204\034\244\0274y\330\207J\316\025\237\035\347\225\r"
+	.ascii	"\354\346\271gAn\022\340\026\202\201x\230O\250\351\363\233\345"
+	.ascii	"q\235@\031\376\201\354\333\356\r\205a\202\226\2173d\027}H\260"
+	.ascii	"D\253\364Z\024;\303p\001\225\356\342:\230oZ\220)\243\366P$\032"
+	.ascii	"<\360\220N\373\226'\230\304)\260\034\244\327\tp0}\364\017"
+	.text
+	.section	.gnu.lto_quickMedianFilter5f.29.40044d3c085d4d13,"e",@progbits
+	.string	"(\265/\375`\310\006=\037"
+	.string	"6\364\262H\260XQ:\360(\327\031P\r*\304W\no\245H"
+	.string	"g\033s\271\227\305\251\\2\204b4\262O\371H+\255\347\f=^h\002\357w\n\357^\341C9N+\216\255\277\002,\023\347\315\\\377\333\377\366?id\023)S\n\244"
+	.string	"\216"
+	.string	"\235"
+	.string	"\322\275\3617\216\003g\377\302\236\213\2407\311\242\343\2632\347\274\271<\200x\031~&^n\013\313\207\275;T\334g\262\030\354\345j\261V\252\324\210\022e\270\212\363Q\013B\033KUr:\233\317^\\\366\002Hc\274\303x.\364\245\342.\025>\332JqV\n\024\272:q\325\t\023\232*\300\"D\211\217KxJ\024\020\342\351Q\024\211\213.\235N\350\342\313Q\031\252\200H?\227\256C\210"
+	.string	"H(\306\217\256;:\034\rc\214\370\376\350\241\220\245_N7\342\212Z0\347\264\346t!n"
+	.string	"\267\217\301\266\315\026\007\004\272?\300 (V\274?6\355\275\037F\252_nt\317\244Z&\3251\251\206I\365K\252]R\335\222j\226T\257\244Z%\325)\251\036\245\032%\325\242TK\251\016\257\336P\255\241\3721->J\032\004\347\004\021\3042\223H%\0307\372\211^\344\037y\345\033i\030mxF\243'\037j\343\345h\343|\237W\366\216\017\341N\264a\264\341a\360\304\203\2249'\355\322\264\361\362+"
+	.string	"\\\355\347\270\016\334{Nzl\316\037\037@\346\354\325\f3>L6\324\336\367\030\222&\213\332]\355EH\274\036q\0214\235\307\005\370rN7\032<0d\006\016qw\026W\356\204\241#\034\364\251&n\013/f\334\373n"
+	.ascii	"\350\273\242t\243A\271;\247\200\226\266\250\234\322>\333\035"
+	.ascii	"y*CN8\350\323\3039\347\fww\r\342li\033\002s|\326\266\203\373"
+	.ascii	"\374{i\232s&\220\300\234\223\257\224\301\2771\310w\322~\307\304"
+	.ascii	"\215\006\255\013\263\273\317\221\021\336E\304\257\356s\204p4"
+	.ascii	"\350\331~\177tIc\351\247\223\345F\203\273@AD|\330\335\331=\233"
+	.ascii	"\022^\341\030n\031\233\205\b\027\036\314\334(\320\314\314\320"
+	.ascii	"\310\334(Hx0s\223\251\261p\263\0210M\005\b5\267\013445\267Uo"
+	.ascii	"~\177^\326\345fq\274!\234\223\205\202\023\375Rv\274\030\325\230"
+	.ascii	"\305\366\367\030\022\257G&\333\030\223,v\305\261\335\021I\272"
+	.ascii	"\336`\222s\202\301\366\005{\275ZL\256\032\222\313\265-&u\325"
+	.ascii	"Z\333\332]\355\307\005\370\316\332\235Y\273\332\t\254\332\252"
+	.ascii	"\250\206W\251\205\342\343\263("
+	.string	"(\225jS\333\362dS\255b\211I\311\246\210)\324\022i\322#\274\236\321\246=\256<`8\356\316\343\242\266\345d$\274\201\373\200\237\250\201`E\221\214\214HJ\222\222\264\032\340\002\221)\252\007\022\240\2045\006c\315\225\024\245\230\375\337\002\310g29s\3741\252\035\367\374\\>\326\306\035j\325{\0351\271\220\330a\006]\274'\005<\322\217\013\354\n\375\254\0357\204a|I)\267\t\016\320B\371\261\203\243\366c\250Q\031\222\267\035\034[S\347\201\303\270\004\036@`s\275\364\336\346~Ko\345M\276A\316\260\230wqU\256\200{\336\200_QsaX\245\301V\244s \330\005n$\303\325\340\007V\013^\322\n\211\364\333\354\251]R\024\372\3138[\233\3633h\223\025[\235}\231\247\277+!=\235=\353\322\261I\372=\223\222\203\340\030\0020\361v)1\372\017\357\367\244\217\225f&S!G-\266"
+	.ascii	"\343\331@\253\261\036#\221\245\210\b\250s\021\364\246\356\306"
+	.ascii	"0A\221>\340:\223%\233@T\261\3040\225\323\200\273\202}\bF)E\""
+	.ascii	"\243\346\023^\374R\013\345*\026\r'\234\027V\242\022(\237I\232"
+	.ascii	"\325"
+	.text
+	.section	.gnu.lto_quickMedianFilter7f.30.40044d3c085d4d13,"e",@progbits
+	.string	"(\265/\375`K\013\325("
+	.string	"\032A\314\rK\240\226U:\204\236"
+	.string	";\321\007f<bn&u\032\361\372,\350\264\302\fay\016\304\270\254\005\256\245\262O\022\371\221c\274\226h\006`\025~\205\265\340\2659\033\274Z\274\325j\361-\324d\333\256h\333\266m\333J\032\331D\312$\003\322"
+	.string	"\264"
+	.string	"\305"
+	.string	";\300<]\242\371\244\303\270\331\205\"\211&\214>%\304S\204Rk\035\266<W\236\222\277\225\247]bY'\211_\222o\016dY\371\371z<\225\235.\207\273\331j\264\231,\006{\271Z&\253\244d\363\315\236\365B\276\b2\244\007\b\347\300\245\263,\305\340\025\245\377\224`\260/\351\275\244\027\314C\272\n\222\013\336\035]w\244\202s)\216Ka\3047\024\267\2418\301\265\242\323\212L\360l\304e#Dp,\304a!@\360k\350\256\241\017\334\002@\202\203\320M#?B"
+	.ascii	"X\374\0041\313\303K\262\205\207l)\3560%\315Z\253\fH\003i\200"
+	.ascii	"}\200t\230\\\321\341\375\247\223>\200\034{\200:\234Y/\265\326"
+	.ascii	"\345\036 \016\337\226\357\362\202\335\025\356\266\224\002M\254"
+	.ascii	"\025\247\373\334%\342p\023\021\233h7\346\304\037\001\345\205"
+	.ascii	"\271"
+	.string	"\323\027HyY(\357\n\345\375Q^\037\345\355Q^\036\345U\241\274;\312\253\243\2749\312\213\243\2747\312k\243\2745\312K\243\2743\312+\243\2741\312\013\243\274/\312\353\242\274-\312kR^\026\345-)/\245\274\344y\233\344e\222\367\nt?\2120\210\252u\303\225\224J\204\3628\272\323\337\364\031\373\247}\355\235.\2308?\246\323\024\210\240y*\333\275\331\027\367\265+\343L7o\302`\342\374$\230\032jRku9]\027\363\364D~\347\335\307\370\322\315\211\233\343\265Z\211l\350\250\225\030\fK\232\211+\330Q6\316IGX\256>\327\325\255\326Y\035KW\263\224`\313\346\244l\365\331\034\305Rfs\215s\221\2214\373\\\263Y\035\253\022\232\375#\253_|mH\222f\321\376\f\034EA%\201\002\247\361]\261\247*\207\257\312>\267l\3323LR\031\330j\245\276\306\362\264l]\021\001\263_|"
+	.ascii	"#\024\022\217\034\276\242}n\353D\3074\253\207]\016l\237?aR\222"
+	.ascii	"\201\255N\326Z+\331\347/\224\300\216i\322\270#\242w\367\345\305"
+	.ascii	"\205\022\200\244\326j\200\032{\252\366?,,\224i\264\337\034}\237"
+	.ascii	"\0179|\265\334\b\272\373;-\310\257\220\362\315\375\035\026:|"
+	.ascii	"\265\300~\377\351\324\005\220#\317\224\034\276\352\020.\341\025"
+	.ascii	"\2762\302\t\017(4"
+	.string	"\240\031F\250\241\241\251\221\031F\200\320\200f(c3a(\354m\215\004\0076C\n556\303\027\261~\211M\004\323-9\255\263\030\310ZI\034x\323\337D\006L\224\005\366i\374\256x\226>\227\245Wz\206E\270bD\332\025\237\217\337\230\260~\277\366\265\316\352\347+}\274\356\005{\220\275>\267\327\274\216U\365\202\274\346\365I\305CE\245wR*T\273(\273\353s\207N\327\271\243.\227\273\tu\340p}\303\365\217\267[\355hk\250\357\212\267\365\271\266\256\365\314\3216U\363\201T\233I\321\2049h}.\255g\255\263\242\tg\345,\326\034u\233TQ\220L\326\261\240,\026{Q\301\372\006\f\326/*\0226\305\257(\373ju\007\201\006\250\221\\E\221\214\210\210\244 )IZ\003A\006\204 eV\035\022\340\203%\310b\re\"A\323\302\326\377;\322P\316\313\272\233\"\237\372\347\224G\354\2468"
+	.string	"\320\260\354\352\020l\320\007\361~\001\365\007P\242\253O2/\\\230\365~Z\002\356\301\2137\314\376\022\314\221\254(F\207Y\331\215\261Q\001y\213"
+	.string	"\035\025DD\271\251K\276\266\207\215\022\353\3741\007\b\022\221\235\350\024`3\025\321'\004\335\307\360\fpG1\207\n\\\\\312Y\242SI\n\231\232k\321\331\236w\274e~/\217\235~cx\264\007\251\314\022\bh\037\"\327\202A\237`A6\253-?\t\200\371\271\333\363\220\341\220\224\023\030\212\222\306\020\r\bv\034^\314\024-\312J\343\327\363\346\224Mh3\320 6\"\207\3475\314p\324c\315\246q)s&;\311\260D\322[0\354\211\217+\261<C\247\301\265Z-\247\".m\375\230NJr\327\311:P-r\r\027\3642c\023s\343-\322\302%\254\255.M\316\257\027s\020\321\276\251\2377N\003e\200\021\275\215\004e\375\037\253\277\264w\234\034O"
+	.string	"\271I8\231\322\310\231"
+	.string	"\375\277\366.\277~\301g\312t\177\020A\246e\354s\374y8\321K\344\27121\001\244M\002\237_9z\353\272\216\241\264\226P\226+\217\tC\255\340TU\0253\036\372|\200\353\001~\376\220\347\013\270\017\260\373\007=\037\340\365\200\235\177\310\213\317\030\261\247\177\311\030\212+1\222t\260\274\322\273\261"
+	.ascii	"\3571\351\304?"
+	.text
+	.section	.gnu.lto_quickMedianFilter9f.31.40044d3c085d4d13,"e",@progbits
+	.string	"(\265/\375`\322\017\0052"
+	.string	"\252N\354\020J\240\230U\007\n\356x\300v\354\263e\326\tL\037+\324\324/\210RC\316|\177Kt$\3503\376\210\030\315\217\007\356\230\251\244g\201'\360:\274\016\353\240\303\312\227B\364\205`9B\361<\311\262,\313\262ld\357-wJ)\005\b\001\335"
+	.string	"\366"
+	.string	"\313\265\223:\307\017s\023]\262x\321Vbl`naY6G\330\271\264/\332\267\264\357\257\340V\243\313f\324\177\032YC3s\2241\026\2111Ca\020\006\370\363\365x/;]\016w\263\325h3Y\f\366r\265V5\275\350\373\017\267j"
+	.ascii	"\305\301$j\250\b\250\221R]#\265\304i\224\364\214\222$~l\266L"
+	.ascii	"\363\311\215N]tjr\"S\3070\t\361a\220\026\006Y\362 \217\206\341"
+	.ascii	"\261\303\201:\372\247#\207\373\222\272\227\204\303yH\375\202"
+	.ascii	"t\303w2Z'#\206\347`4\016\306\013\277\271h\233\213\026^S6M\311"
+	.ascii	"\302g'Zv\302\204\307J4\254\004\t\177\215h\327\b\021\336\032\246"
+	.ascii	"\360p\324k\024\242\243!\r\"#WCt*+\332\200\n\231B~\321\264\306"
+	.ascii	"\221\223\254H\003J\240iJ\215^j\347P\204\301\321\031\037\372{"
+	.ascii	"\251\321#R\315\241\242\017\355\252\001\226e\331\207\212<4\333"
+	.ascii	"4\363\003`f\034\346\030\203Sj\034\375'\231\227@\036\340\250\251"
+	.ascii	"\345W\301\274\323\313n\235\353\234\240\225\232\221\327\271\346"
+	.ascii	":\323\\\347\231\353|\274\3162\327\331x\235\213\327\231x\235c"
+	.ascii	"\256\363\360:\013\257s\360:\303\\g\340u\376]g\337u\356]g\336"
+	.ascii	"u~\271\316\273\353\254\273\316\271\353\214\273\316\267\353l\273"
+	.ascii	"\316\265\353L\273\316\263\353,\273\316\261\353\f\273\316\257"
+	.ascii	"\353\354\272\316\255\353\274^g\365:\247\327\371^g\264\235\037"
+	.ascii	"uv\324\271\025\354@@A\220\305\262\035\262\260\330'\267\210\214"
+	.ascii	"V\352\376\321@\270\227\370\305\255da\005\"Z\225\254 \335\254"
+	.ascii	"}q\314?\334L~1\367h\037?\375\343\302\nDt\300\312\215*\226e\221"
+	.ascii	"}\031\271\366u\024\305v\346\336\321<~z\311O]cY\025LCXvy\3034"
+	.ascii	"k_\016\261V\366N2\331\307Z\031N,\366z\230MS\357\230\r\373$\303"
+	.ascii	"\376\365<70\233\327\024\022\277ZU\177\345\261\270\236\037\305"
+	.ascii	"\324\236$Eu\271\276\365\272\253\252\325\365\216\365T[\266,iK"
+	.ascii	"\245\212j\247\224Fk\353B\332\225P\350\372I^_\375\230\025U3\324"
+	.ascii	"7\225\026U\277\231]sR\345\325\373\r\304Ii\224\276\200\266\203"
+	.ascii	"\364\2169d\025\344Y\274\246)6\322Or\372\367y|Le\360+vz3T\332"
+	.ascii	"7}\235\362f\375f6\021\252\t\227\"A\236u?\311\255\026\277\363"
+	.ascii	"\352\220#\033\371\034Z\213\017\252\f~\325(\313\262,\372\311\266"
+	.ascii	"\220\"\177\347Q(!\023\317\314?,\232\311\315c\313\262\354\200"
+	.ascii	"\0135d\305=U\201\233\353\013n~\372\346 \"\310\263\330_\347\377"
+	.ascii	"[\310\006\332,\225\366\373\267\020\r\f\236\305\310\357\357\245"
+	.ascii	"\2767\244\232\033\272\004y\326\177S\016\032BSh\336\301\221\320"
+	.ascii	"`\202NO\316\003\237\236\036\237\235\234\007\016tzrv\"H\310\301"
+	.ascii	"\351\261\017\204\005\021r&\370\370D\310y-\331~\025\t^\030\364"
+	.ascii	"\030\370\002\312\262)\n\364\217\356\252\036\t\244 1\262F\252"
+	.ascii	"\346\223\\\3634\317\343\254y\035\215\223\013\315\261]\3227,J"
+	.ascii	"\243\231\231?\2663X\307\243\321)\323*\221\221y\243S\2465\276"
+	.ascii	"\361\223I\212\237\344\342\023\237\347Y|\035\321\211\304\304O"
+	.ascii	":\243bb~H\025\343\034\246\303`\024\222\266M\241\302O\262\360"
+	.ascii	"\203\037\263\022~S\t\006\201\017\005\003\363@,\030\034 \027\240"
+	.ascii	"\357\371k\217\374~\357{\376Z_\352\373$\225\221^\357yU=\036o\367"
+	.ascii	"E\272\346\2444z\371$\277\374\356yp^lvN\220v\271*\335\223\210"
+	.ascii	"\252\323}\356uWU\272w\254g.w\243\302\375\020\034\356oT\270\366"
+	.ascii	"v\253\331\2326\333\327l75.\265\331\223\206\365\244\322h?{\335"
+	.ascii	"\325\223\206\225\316f\001\201a\250qhd\215\214\210\210\224$)H"
+	.ascii	"\2061q\006\"CU\306\r\022@\222I\216\307*\312\\ 2c\033\373\377"
+	.ascii	"\0061\274<\304\277\276\302/\340+\235\275/\212~\247\365'\356\251"
+	.ascii	"H\343\004\177^\360ga\376\037\214"
+	.string	"\357\261\250\341\334\376f\037\325.!\341\230\002[tq\217\323\307'I\005\003\201\375\275G\312\263\230\334M\035\367\266fj\361Q+`\227\363m\rF Y\"\375q\013F1\220\342\023\017/\361Op\225\025l\353\003\352\335\340\264\"\327\311X\322\215\222\030]\224+\227\277(\252\321o\034\n?9\026\345o\226\217Sh\313\250\231(\003\016\031h|\320\305\215\306\026\232B\363\350\351\234\177z\261\tm\016\300dqS\265KA/0\002K\240\234\341\0254\230\006\310\367V\310\332c\357\027c\220\346Lz\304\347\246\241\330\202\275\274\f37\b\251?C+\371\203\363,\323m\030\243e\324\361\t\004\016\345\220\326\316\303\353g\374m\352w|\236\024\362\024\260\214<E\247y.&\372?\327\375+t\203\230\240\232`\367Xq\252M,q:\326~\"xUW\237\016\350\004\330\227\364O\266\254\313\bJ\274*`\233\272\b\365"
+	.string	"\371\036\307\236\256\2021Eg\264O\nQ8\377\314\263Kd\210j\25568\3054Q5 \210`\200\307a\261~)@\245\275\\\227\027\304\315\227{\326\025\200\333\3718>\224+\250\261 i\317\214\313("
+	.string	"\310\315\002\227\271\202x*\340\374\037\331\203\221\364c<h\006\353\007\364\375\265)b\306\264\356}\260"
+	.string	"5\005\330\233\204"
+	.ascii	"~\345\3657\026\032\206\212\353D\002p97bG\022}*\237&\030\266o"
+	.ascii	"\317+\247\353E\325\214\323\217Q\265\262\3505\363o\211Z^\357\213"
+	.ascii	"\365\211$\035\253\266\345\3703\244\336\026\333\3207\364\327+"
+	.ascii	"\273\354\272B\005V\302\254\341$;J\334\004\234I\323f\374\003"
+	.text
+	.section	.gnu.lto_arraySubInt32.32.40044d3c085d4d13,"e",@progbits
+	.string	"(\265/\375`\032\002\275\021"
+	.string	"6\342uF\340\356(\035Z\td\350@@\304\373i^\3307\225C\211\202P\004\350\007\324\f:&\226\034\354\272)\326c\252\234\273\327t\252\3279\374\r\r6\314\260\002*\312\301\207(\376 \217e|\303]f\251\222O\310\2262\245`"
+	.string	"`"
+	.string	"^"
+	.string	"\013\202\370\200w\316\340\005t\347\274{t\347\374\262]\034\254\331\367\330Zt`\354\356\247\035L\n\3030|\004\357\230\257sQ\363\345\323n@(H6K9\027I,/\037L3\226\030rT\364\363\332\323e\006\313(\"\346\372\332\021\334B\331,\346Ir\260\273N\331\f\346\356n\333\202m\bvF\bO\2232\335=\315e:>\255\232NM?\300"
+	.string	"\233\025\022^\354\276\2041v\210\373\001q\236\333G\341\327x\f\344\245d\360h=)\212v\367\343\234\037x\347\256a;O\\\347\365\035\003E"
+	.ascii	"\273\302A\203\317\356\202\270\201w\256@\274G\227#\203\001xC="
+	.ascii	"\355\227\370\315\3538(?\355\316\334\370lF\235F\365T\211b!`\035"
+	.ascii	"J\322\273:\223r\032\211|\333\205\023\317\203\217\322\335EF%C"
+	.ascii	"\247r\250\352c6\361V\321]S\037\033\001\313\320%\275\276\366h"
+	.ascii	"$Dk\231\241\222\241*-\210e\246Jc\203)\031RsTd\235\261O\307\371"
+	.ascii	";\236\363\233\016\376\034\337\3717\316s\2272\355\005#w\221T`"
+	.ascii	"\251\270\005\n0\244Z\255T\3472\021\231\020\255B\231Pp\245V\037"
+	.ascii	"\tk\265b\251>\222\221\324\352S\265L>\024\001\263JDZ\237\213\305"
+	.ascii	"j}\032\340^g|\332\275 \022C*\n\343\224\306%\031=\251\266\310"
+	.ascii	"\217\227\324eCKz\034\023\267\225<z\334\335\215N\360\222\236\364"
+	.ascii	"0\2670\266\301S\337Vrbb\2216Y* \240\202\031\313m#\016\224\003"
+	.ascii	"{G\226[\224\276\265\240\214\244Q\370(\376U\034\331\221\231y\233"
+	.ascii	"\006Y\301\211\005,*\260\004\213i\256\262\225\331\036d9\355\266"
+	.ascii	"r\ro\030\215]\334\2601\265\016\247\003\033gmv\230!\f\267dbin"
+	.ascii	"\300(\371^>\213\2440T\215\367#\322\271\304\023"
+	.text
+	.section	.gnu.lto_arraySubInt16.33.40044d3c085d4d13,"e",@progbits
+	.string	"(\265/\375`R\002\335\022"
+	.string	"\006$|G\340\360&\035Z\344\n\266\217\006@\211\246\310\303\364E\307a\200MX\277=\004\307\200C\210\300}\221\207\343Gx\217E\027\313\262q\302\035\315\223a\2141\206\316C\030\206\363\370C7\260\207@\202\216mXB\310\336R\246\024g"
+	.string	"d"
+	.string	"c"
+	.string	"\037s\342\360\020\315\t\226\230\200wi\360#\334\245\367\020\356\3222\373\305A\235y!$\231\037\031s\316o;\270\013\3030|\004\357\250\262\313\270*\363m\037\240\204\202Vk\271\214]\f\315\007\216ZL<yj*\372\355:S{\321(\302\346\373\333\013$\305\240\325l\256\335\2029\247\225V\253\271\271\333\256`\273\201\255\030\002WoD5j\325\236Tw\252\346V-\245:\252z\243Z\243\372#"
+	.ascii	"\212X8\2001'M8c.\311\"\020\017\272\375\023\376-\310F^K\006\317"
+	.ascii	"&\244\3244\347$\2714\003\357\362)\333k\342?\262\003\331(zL\030"
+	.ascii	"\016\032\210\346\234%V\340]\n\210\017\341|h$Pp\005\311\344j\237"
+	.ascii	"\304yd\357ay\233\332e\232\205@-\310nD\324\236i\266\323\255\367"
+	.ascii	"\352>\226\333\310\024W\356\355\017Y\200y\036\374\025\35637.\353"
+	.ascii	"\261\273\237\215\320{\005\367\325\375l\347EC\253\366\373\333"
+	.ascii	"\243SR(S\303E\303]\333QLm7\307\006[\364D\347\251\311\213c\213"
+	.ascii	"\274\347\007\271\317\377q\360\3678\320\337\361\240[\265\352T"
+	.ascii	")\217\251Pp\261$\202\003\027V\257\327\212\213\301P\036D\263L"
+	.ascii	"`\020b\253\326\247\342j\265\\\254O%e\325\372X/\330g\022\300."
+	.ascii	"\t(\257/\346r\275\276\0248\2778\276\355\336\221\212%\227}\221"
+	.ascii	"\233c\324\315\212\354\272P\222\253v\246cU\373\236\022H0\372\364"
+	.ascii	"8\347\234\321\006\256Z\221}MR\214\331\206\324\372)\"L\340h\301"
+	.ascii	"\302]\352\020\315\311[\0310 \300\002\021;\356#\016\224\003{\216"
+	.ascii	",Z\024dk!\216\204Q\250\213\337<\034@\311a\310\321j\t\233\035"
+	.ascii	"8\270\031\201\347k\263K\335\350\305\3164\307\264\356\214\300"
+	.ascii	"\214g\264\007X\206vK\271\214O\030\033\273\270asj\235N\007\033"
+	.ascii	"\247m>\354!\347\fL5\25707\240(\303\275\364,\222\205\241>\336"
+	.ascii	"\203H\347:O"
+	.text
+	.section	.gnu.lto_qPercent.34.40044d3c085d4d13,"e",@progbits
+	.string	"(\265/\375`9"
+	.string	"U\b"
+	.string	"FP:6Po\322\0015\241\325#2\034;F,g\bFk"
+	.string	"@*\206o\216\332E\2725\204\334\327\306\017b\002\226\336\231\231tU5,\256\333\223\020T\236\241M\266\224)\005)"
+	.string	"+"
+	.string	")"
+	.string	"$2\273\033\tn"
+	.string	"o\345\013\340-\3158\367\344\374\217\374\245\254\274\234P\242'@\303\356:O\250\212[o\033\301\266\202m\2253\313b\235p\330\336l\215\355L\373!\027\331\336\205,\260k\341a\262\273\fN\b\270\265y\266\375\217\203l\346\262\323\240\200\0330\246F\201\327\324\214)\251\\\036\202\252\327,)u\220rew\242T\f\373o\365\302\357\335\257\232NM\037.\244\336\222\332\235X\005\022\367\305\371<\200:X\364d\030\226]\321\003\321\301\342\245}\"\347\300Y\204\203\026AY\246EM\267\367\323\315HIN}z\223j\224+\017<\013"
+	.ascii	"2\003\3020H\341H\232\315\2720\216\2145E5B\2011\002\2320RRL\327"
+	.ascii	"$\003"
+	.text
+	.section	.gnu.lto_qMultiply.35.40044d3c085d4d13,"e",@progbits
+	.string	"(\265/\375`m"
+	.string	"5\t"
+	.string	"f\322?6@\217\322\0019\230&\207\033\227\026\366\327\266D\202\230\300\314{c1\236\222'j\373\310\235g\356x\262]\241\263*\212\206\003\227\013O\272\r\220\036\375-\333\233H\231R1"
+	.string	"0"
+	.string	"-"
+	.string	"\\v\031\022PcE\365j\331\3358\360\002\370\227'\200\177\212q\356\311\371\007y\306r\022\262b\231\236"
+	.string	"\013\273\353\\\261&n\275\355\003\333\n\3663\001\021\261\227Ey$\033\266Kv\306\266\346]\234\337.\205\310\006\363\347L\373\036\377(\275\203p\300nEkdw\023\214\200\371\323d\266\375\326;J\016\372J\301\236>\305\201\312\2303\275\246\211\nv\312\230\335\231R/\354g\253\026\266\323\360\335\377\356\3723M\253\246S\323\307l\\\236\242\262\033\244\207\020\350\363\034n\017g\324@\352h\021\264i\332\346\211\240OG\213\036\321(r\f\274\205\030D\221\264m\242\230\351\366\206\2529)\312\252P/p\227\300T\325\016"
+	.ascii	"2\003\302\260Z\270_S\363 X\230A\270&F\322b\177,H$d)\240\206\200"
+	.ascii	"\023F\252\025\2230\311"
+	.text
+	.section	.gnu.lto_qConstruct.36.40044d3c085d4d13,"e",@progbits
+	.string	"(\265/\375`m"
+	.string	"\375\b"
+	.string	"\306\321=5@\217\322\001\033\231\020\277\033a\030\224\372\373!\252V\375\207\024-'|\220\356\333z\351\016[\321d'4\315\216a \230_\335\trl\200\364\350Z\275\367\2262\245/"
+	.string	"/"
+	.string	")"
+	.string	"\027*\210\261\202j\251\354n\314\234"
+	.string	"\376\271\017\300?\265\370\3509\362\357q\207Br\222R\221\236"
+	.string	"\n\273\353L\251$n\275m\003\333\t\3661\001&)\273\021/\327\226\274\220\f\333\"\033c\263F4\227?k\332\347x\207\350\033\204\337\356\304\ndw5>\270\374\t\244m\177\343+\221Gn\013\026\201\327\324\237\\\246|\331\3515?P-\245|\331\033)\265\302\276[\245\260\235\206g\375\357\333\3574\255\232NM\377\202\300\362\231gA\261\207L\335\331\200\030B\034,f\032\206i\235\2305p\260\330\371\200\342\246\300\232\203\347\023C\232\366\211\230mo\250\231\222\232\024\352O\032OU\265\025\360\017"
+	.ascii	"2\003\3020-n\213\301\n\260\345\237\303\271\206G\322\002~L(`\016"
+	.ascii	"\f&\240\206\200\023F\252\025\2230\311"
+	.text
+	.section	.gnu.lto_sin_approx.part.0.38.40044d3c085d4d13,"e",@progbits
+	.string	"(\265/\375`F\004\345\030"
+	.string	"\366\352\226J\300\020)\035\214\337\356y\216]\227\375\236\241\251oS\373\2557ng\253f\232\200uC:\035\345L\364"
+	.string	"\377e\355\2776\215\377\302\320\004\n\004\211\240I\020$>\273\3655\025\2405M \0334\237\335\212\376'\215\020B\310\226R\246\204"
+	.string	"w"
+	.string	"\200"
+	.ascii	"E9\373a\231l\177\320\201\356\274\221A\363\304\243\326\032[\261"
+	.ascii	"d\003\214+\322\035\031W\354\241\367\307\266\255\353l\231%9\212"
+	.ascii	"\264\371e\373r\215\016\205u\2212\340R\246\0366\202v~\366<\320"
+	.ascii	"\362\311\300&)\013\332\361\331\222E\016\006ZRk]\244\234\036&"
+	.ascii	"it<\362\254X\362,\245\244\016\207\003L'GU\204WR\013\\\266\321"
+	.ascii	"\271q\267:XX\036\331\027)\253\265~o\032\366\260\375\377\342\177"
+	.ascii	"\312OM\002\314\017a>\b\363?\230\017c\376\213\371.\346\237\314"
+	.ascii	"o-\324\336,\311Q\244\315\353\333/\2005\360S+\316\020\253\002"
+	.ascii	"\211RF\033\265\013\265\374\357\277#j\337\250\005\376\374\325"
+	.ascii	"\240j/\311==H+p\217\222\204\nl\337\337O\021\023h\0052X\242qU"
+	.ascii	"k=Y\361'g^\337:\325\242\2343\257\323\2037kM\241t\242\326\232"
+	.ascii	"`\305#(W\374\267\251\366\007\251\217(f\267\207\251\035\022\216"
+	.ascii	"\207'\331c\026\254\206G\325\352\336\205f\300\370Q\345Xh^\354"
+	.ascii	"Q\200\211\002\027\232\224J:v\213\234\023{\177-\310\356\275\204"
+	.ascii	"H\373\224nw\333\234\n\315\374\250\306n\n5\334\361DJ_\"}.1\367"
+	.ascii	"\266\315\351\314OE\216\205\357\245\335\275\340\222\240\321aU"
+	.ascii	"\3771W\353\315d\233{\201{\222\264cw\204\343\341{;jJ\247\303\335"
+	.ascii	"{\277T\210\204Wo\241\177}\273\"\001)2\034\343\322\"Ce\366,(0"
+	.ascii	"\021bVf1\027\332lFc\211\271\264\254\314b,/01\024\222\323$@x\211"
+	.string	"\305\320h/\261s[\250A\020\304\t\322!\017\351\313n\215s=\250\301k\221}j\212MbtS\216]~t\331 \2759v<X\267\372\2439k\003\n\035\020\326\253a-V\355\216\\m\366\253\307\247\035R\205\236\236\025\216\334\331\256\036P\265\343\341x\030\342\206\013\337\202\3410\206\331g\023x2\273\354V\213C+\312.;a\250aL\345\0303BB\nR\220\024$\035\260\002\231\301\342\006\021\200\255\223JhAI\n\255\031\257\003\360\221\377\343\3051\224\3424\236{\301xJ\027\nb\357#&g\320\317\356\243r\227]d\335\310\316\251\013\224j?L@\342\344c\362\354u\277\221\03106D\023\002\035\370U\306\030\337\230\246\206\230m\254\242\244%*\334\315\300\033(\260P;\214d\022\221\310B\263\335i\373\366G\372M\240\372\t\236I\270N\247\354\372)\004R\261\\\223%,I\230\202\374a\377\256\031\271"
+	.ascii	"\257D\fKq\355\212E\030\236\237\031\312\003\204R\275h\030\002"
+	.ascii	"\021\227\230\344\2604\361\232\266\202V&Ku\230\327\251"
+	.text
+	.section	.gnu.lto_.symbol_nodes.40044d3c085d4d13,"e",@progbits
+	.string	"(\265/\375`\265\002%\n"
+	.string	"T\r\261\003"
+	.string	""
+	.string	""
+	.string	"\002&\177\035\360\372\2508\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\204\202\202\200 \005\177\036\253\325\252\325"
+	.string	"\272\200\202\002\006\177\037\200\200\200\200\004\007\177 \b\177!\t\177\"\n\177#\013\177$\377\377\377\377\003\f\177%\r\177&\016\177'\017\177(\020\177)\021\177*\022\177+\023\177,\024\177-\025\177.\026\177/\027\1770\030\1771\001\031\1772\370\354\254\325"
+	.string	"\032\1773\200\200\200\300"
+	.string	"\033\1774\350\314\2313\034\1775\035\1776\036\1777\037\1778 \1779!\177:\"\177;#\177<$\177=\001%\177>\037"
+	.string	""
+	.string	"\200\200\200\003\001"
+	.string	"\302\001\003\002"
+	.string	"\241\341\365\321\002\004d\003\f\204\006\003\020\244\006\003\021\342\001\242\007\013\342\016\022\242\026\003\023\021\200\200\200\200\004\001\""
+	.string	"3 \360\002\241\022\247\003\212\270Qa\337\315\2714\2479\373\231\024\362\220K^\247!\036="
+	.string	"\356R\272\025Fa\257\b\b\364"
+	.ascii	"\337x\3457t\364\200\200\036\320\3037\372\r1~C\020b <\302\220"
+	.ascii	"\021\270\237\3739\237\3739\237\343s\371\334\362s?\327\237K\371"
+	.ascii	"s[\237\213\030\211Z\324E\274\226\237\033\277\361\033B\276\f\244"
+	.ascii	"I|\016\330\030"
+	.text
+	.section	.gnu.lto_.refs.40044d3c085d4d13,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.40044d3c085d4d13,"e",@progbits
+	.string	"(\265/\375`\224\036\315\202"
+	.string	":\320@.Q0P\322I\007]5\026\001\310\363\365hN\366B\254EE\322L\343\353\274\235@\001\003\363\341\265MX\322\031j\362\2646]\313\255]`\201\020ZE\b\001\250T\037\\\027\260,\231\226\275\007\021\322v\263\346\022\206\020v\210\331\320\3009\252!B\244L\001Z\002\311\002\363\002\203\320\250\221\365;>1\364jJ\333\243\320\201\310\230\2250\351\036\347\025\351c>\276\302T\336c=^\304\3427\326\262g\256\366|\325\236\251\332\363S{^j\317T^\355\350"
+	.string	"}'Xu\330,\337\345\234\361n\214KP\323[\263\302\315\031%6\333HR\242\260S\220D\331\322\354\271L\216\207t.J\232\003\333q\035S9\nC9\323\3614\n\343\360\252\207\"\233\213\203HJz\357\255qb\r\321j\331\031v\266\347\333\276\206\3664\264??\371Y\214\307\330\311\372D\212\336\265{\247\037\216xS\236\0246\033\027\"&\221h\260\253\3313\333\243@\223\202+c\"\300Q\036\216%m\227[\315\226Z*\026R\340\330\331\253\036`\356\245\023\203\273\367\276\361\r\354\306U\206c*7a\265\363\032\263\235\235\336[t\357=O\377\234\237\311\270\214\233\260\331\253\253\331\322\305q\243\213\004\025;\252\330\341\275\327\204\t\023&B\2308VU\241\203\233a\017B\313Q\006a\f@\203\366\177\332\021p\336\024G\240\375"
+	.ascii	"\355m\332\303\264\357\366x\f\3028\202A\030Y\2761\332L\031\204"
+	.ascii	"\261\345\033#\013e6(\031Zcx\b\003vV\024@`ypc\265\001\177\300"
+	.ascii	"\300\002\017Q(d\236p^\232Z\370\271\215\377\332\300\317Emk\002"
+	.ascii	"v\\N\363\257 \376\343\3757\374\257\205\357\377^\337\177\300"
+	.string	"\377~?\210\177\225\241\213R\270\347\002\224\002\324.\363w\231\330\377\266\377M\376W\377\277=\346o\257\377n\314\376\255%\225\264\376m\303\320\317l\177\371;\206\367\337.\034x\373\267\t^\373\361o\025~V\373\271\354g%?\203\375\334\365\263\220\237\261~\266\372\271\307\317T?G\375\374\364s\323\317L?+\375|\364s\215\237g\370Y\350\347\030~\336\371Y\347\347\027~f\341\347\023~n\361s\007?c\3603\213\237S\374\214\342\347\023?;\360\363\003\377\021\377\007\376\317\341\177\334\317\013\374\\\300\317$~\036\361\363\001\377O\370?\302\317\006\374,\300\317\001\374\f\300\3176?\327\374<\363\263\361\347\365g\376\237\370\237\313\177\301\377v\377[\374w\362\337\204\377\030\374\257\373Obqqq\361\177\311\340__\374\002\330\005w\005\274\342Dwx\241\246J\314(a\021\222\244\205\274\267~\tR\274:s\357\330\275\327"
+	.ascii	"V\273B\345I\263/\204a\260\267$ml\355\033\t\033\257s\351\336\253"
+	.ascii	"\343ez\227\210f\214\374\302\\\342\247\341\225I\334\225\201\303"
+	.ascii	"{\177\204\021\266^U\247\324G\334\207\335\333\374p\247w\351\211"
+	.ascii	"v\325|\246U\201~\230^\253\001.\232\217\373\234^A\331\350\355"
+	.ascii	";\275|\213\256\2401\236\323\350\322s\032m\332\334\242h\363\336"
+	.ascii	")\324\346\271\346l\362\023\355\n\372D\213B?\334\242\333\274h"
+	.ascii	"N\253\266(\n}\332E\2416O4'\364Yt\005\375\220\025\246Uv\264u\326"
+	.ascii	"\306V\317\242\233#i\312\271d\203\367\234F/\337\275\274ft\227"
+	.ascii	"H\334;\025]\342s>1\034\021^\016\242&\316(O\223\210\260\242\267"
+	.ascii	"\b\357\371\025\275\367\213\350\305M\232\2409\305\273Z\214\327"
+	.ascii	"\3641u\221\214\356%\340N\357M\272\267\311\027\357\336\333\274"
+	.ascii	"\367\036\227\246\246\367\362\260yJ\223\222\356\205\n\221t\247"
+	.ascii	"\232qF\367\366\332\0258\350\023\r+\232\023GE\223^\033\323&K/"
+	.ascii	"\337\325R\213\3264\273H\203\255\024\312\224\305\307\252\327\264"
+	.ascii	"\303\353\210\372j_\261gQ3\351\275\327f\346\n\241\333Z\263\357"
+	.ascii	"\242v\2126s\245\355\256\260\331\256ZmH\274\327\331U\335\321\356"
+	.ascii	"\361\256\372\224Y\001f\005j\216|aO\247\221\252\247\262\272\336"
+	.ascii	"\304\232m\250\216b\252\210\346q\276k\251\2778\247w\232"
+	.string	"%\b\021\264Y\033\006a<'\2665\334\313\"\214\274\270\310\"\236\234\214d\367\355\310\311h\226\366\224\322\264\243\237\220\216vT\215\034Yd\322\001\343D\t\t\022\035\257\322\320\375\b\023\203R!K\212z.)\305@MY1i\366\255t\301\"Oth\226\305r\3369j\362\252\205D\222\220f\352\300\240\215\364\367Q\343\250\231\252\022B5\313\006\360\215\261\2379\357\033\275\344\307SH\263\306\266aD\303Vw\004J\263o\243w\263m>\351\214\232e\262\234w\r\326\207\026%#EDiG\316\247f\233\250\2333p\211FN\355\354f\221\034E\n\233eE^d\352\345\372\036\246hz\321X\013JS\213\260\245q\\\\\\\\\344\313u\331\242V}6\373s\"\227&S26m\0261\004\177\325(\373\302k\017\231\312[\270p\013ka\303\325l\251\203<\266@\023,UGt\307\262\206?\0172!S\351\350"
+	.string	"0p}:\300\246\264\347\266\266\027\340\233,\2022z\177PJ\315r\240\b\232\242=%3\262\266\n\357\260\232-\205\220\267$\220\377x\nS\271XcX\030\220\251\374w\021mY\353\324W\252\326\306Z\333\216\267\256\271\033G\234\242\242\336\314\302p\350\322\354_\210\236\236\222\264U\\\366\n\003\327\246\265ie\352\253\222\302\024Z\251II\201BW\246\017\356\275\315\351U2j%9\321\035\272\200e\211\326\252\343+\223\b\324!M'\r\231to\256mEZ\221V%\021j}\201\036\222,9D\313\361UiM\333\243\0225\273&\265a\321\031 Q\230\326\025\365l\265\261\332X\217\366\336\250?\342\250\353\215\257G2`\203q\323f\327\347\337f\244\314)V}%&\2565\332=\036]\246\310\221\255E_k"
+	.string	"B\025\271\0305\273\336\225\210E:\243r\262\022\255\316\233\303\2447\016\024\341A*+\353hm\336\212`\332\342\361\260N\352\310\242b\373\207\027\006\206\b3W-\354\353\302\205,\232\222\266\275haa#*\256\305M\233\266\274\021\001ijd\251\261\244\331>lC\030\270*F~\206k\240\021S\221\241\226\365\016G\324\023-\f\245\311\242^`\323\337_\017\352a\351(+B\305,\357\301j\fu\316mK\263-\370j\273\267\306C\261\331\016|5\254\357\252K\263\215\345U\263\254\270*\3156 {CO\257\375\262\372^\276\272\264\001^y\373\311\035\215\3645\2074\333}k\224Z\215j\266\371dx"
+	.string	"a\272\241\331\336\273\\\313\205\255L\207f\333\212\"\025*\235g\347\205\310\305U\345\235\307M\177TFS\036\244\204\\\315\277\273\273\226\362A\265\335\234\376|\320\325\325\265\024\230\273\244\327&\263\007D\207\021\273\267\224*\f\0260)\221&ss\235\203\036\227\364e\212c\020\212\356\235\003`\315\r\324;l\266\241\264\223\026\013\243kB\253V\033\207\264\036\201\027\n\252\004?!6\351x\362\306\001\020\r\2077&NzKZ\242\223\223\270\263\253\246\270\270\031<i\230Y\263p\254V\370\025\205Plm\255\335\364r\004\216"
+	.ascii	"\333rk\362v\253\036\"E\335f\273\255ox\261\"(\365c\323\341**\244"
+	.ascii	"\331\346\213\222\025C:.3\263\246\266\364H\305\3522s\230\226C"
+	.ascii	"\332\233\332\315.\002\203\3765\333L\032Mi\232%\260"
+	.ascii	"\260\317\214}_V6\252\306\306\272,\017p5B\374[${\227U=\254\375"
+	.ascii	"@\214k\266\227\274\272\262\351UM=!A\322J.\300\222\022\330N{"
+	.string	"ShI\336J\344j\306\244lz\315v\330\261n\nV\0179\266)NL\nS\013\006\326[|o^\233\023]\030\3678\354B\322\354W\033Ri{\2656\227(OIj4\264\222Sb\344\355\305Z\361E\001i\266\273j\336\314\370\266\020\211\234Ho\361\263y\357zo\225\242\324\003\025\223/\",m\220\346\n\322[\035\334\313\323\250\322\322\205\332Q\342\375\243\201\264Vo}\270K\367B\005\177qB\350\347\007\271#\304\364\201\001gH\351\002\002\032CJ\237\037\b&P\241\243b\005\r\234$\317\320\317\216\322\007g)4\204\2033\003h\371\202\t\244<\366 \223?\354\316K\017s\031C\350\205\2713\264d\n)\2016\210\021#\303O\220\017\363g\250E\f\030\2462\271\263L\222\020\243U\221\003\002\fC&\310\200\\.\2214=\025P\220\242\007\305M\005\024\244@\261L2\177|:H\266\210a\307g(\006"
+	.string	")$\217%\360\374\370\f\301p\223Br\006\237\037$\214%\2202\246G&\351B\211,!\371\203\334\021\212\021R\"}x\220%"
+	.ascii	"\235 \224L.]$yl|d$9\340Y\"y\224H\246\t2\222<\001$w\224H\237%"
+	.ascii	"2\005\031I\036\231\027BC$\310H\362\034\227\310\344\317\0062\222"
+	.ascii	"<m\217\007\036%\022\006\036d\222\003\031~\202\202\2204=\313\344"
+	.ascii	"\f\240 #\317\216\213\025)#\201\022\311D\316\b\001\355\304|'&"
+	.ascii	"\202\023\314%2\350\004\r\240eP\020RG\351#\364\341;>\313\2442"
+	.ascii	"\351\242\375\004* P\261\202\306\361+XD\300\"\002\343W\260\310"
+	.ascii	"\311a\241\"\247\275\212\234\225\251#A\016\r\237\236#\023\t\364"
+	.ascii	"\323\363\302\324Q\221#\001\n\246\322\347\310\204\301B:4|\226"
+	.ascii	"Ld\013%\220\017\023\311\004Z\352\004\365\3340ez\222<:43\2202"
+	.ascii	"\254??@K\366\305\016\323'\350E(\371\343B\2114\316@.\327%\020"
+	.ascii	"s')C'\250\007f\005f\201[`\346\013\002\016\024\224\\\3420\201"
+	.ascii	"\200\22682J\035\030\253\220\216\214$\017S\350\370\234\234\rF"
+	.ascii	"\2400\202\007\355\316\t\241\027L$\f\034%\020\f\030@;8J\037$\f"
+	.ascii	"\234\235\245\020\316\t\021-Z\314H*y~\200t`\030M\230\221T\352"
+	.ascii	"\3000\336\260\326\220r\232\302dJ\330WDke\333"
+	.string	"b[\024\334\241\331\325\354\253\232You O/T\264)\270\342\311\341`\226\303\373\234*\361\262\025\205\254\251\3315\355+uO\257\356\254\253]\231|E\223b\362\373\342:\013b7%\313\217\366\306\350\330\330Z\306e\306h\213\026\037\331\327\262\254c\221\302)_\263\353\222\236\2021\273\213\022kB\202dU\202EJ\2637\335\363K\362U\211\214\237\240X^\263kXg\335Y\325q\031q\254^\253\327\n\266\345W\250tV\375\372\n\326S3>x\024\231\313\212\241\373;btrq\255]\255\235\364E\021\255K\r\351\327\256^K\332a\257\331\265\b'y\t\2725\273\022i*\232(\203p]\315\256C\232\212\205R\027w\t\263\262V!|\203\033M\221\326SM\353\253\020\300\027\247\033WW\315\256A\332Yc\205\017\254\253\331\025H;\327 B\246\2164\273\376h'\214\026#\204\212V\260\260\210H\233C\222"
+	.string	":\261\262Z\251\374\242\216U\264\354pF\326\243\307J\245\370\342\364\304(\210\020)\251\225\n\246\357\357J\035\225\256\202\244\250\202\t-G\363\312\230\231\022\021\221$I\322\001b\013\020\004cA\236\347\316\003\022\34045\221#\305\214\314\2104EIiX\003\360\222\0340\265#0\277\337|\225Q\331-\334o\013\357B\304\320\237\223\300k\360\3403k\363o\225\2730\213\216j\244\224\266\354\276\354\030"
+	.string	"a6\357\364w\020)\265gm\022\376f\025A&\252\215\270\370\301\314\332c\334\036\370\201b%\321\215\013\231]1\032\351\244\352\361R\354\276c\307\265 \241\301\314\324\002\272\321#\262\272\263\235\236(\255=x\255AQ\242N\351l\203fk\3112j\306\302%\261/@\005\252\363T\f\"\324\357%7\\\264zZ\205B]\347\261\256\032\350&T\357\300\316Xg\025\322\317I\307\026\22501\206r\334\211@\330\216-\252`5\370w,XIQ\377\370w&\355\004F\265?F,3\bPn\370\027\244\256\2414\324\250\363\260\235\202\357\255\207\223a\337Ac\201\224\331\372\353\363\026Q\351\261U\324G\273\f\001"
+	.string	"\376\026\236\207\306J\250D0Lnr\365\225\331\020\241\276e\020\267\227\023\003N\342\210\373?\357=\212l\251\304V\017\2751\342{V\210:\023@x\331\31206\002\217\373\354\322w\212,h\3249C#6\006.\f\256\002\224"
+	.string	"k\367S\032\311\201\315z\230\250E\303$\262\026+\310\307\200\213\250`\350B}g'\331\303\177D\023\277.*N\022\240wBew\277H^L/,JB\002\250\253\312CB\007\332\350+K\r\027\330%\213j\253\306\377\243H{Rn\315M\002\372\312\205Ro)\337\263"
+	.string	"N\245k\200\243\226\0375?Y\322v\030\252~\2509\342\374\0366T\345Xwr\261\210\037\333gr\033\243n\334u\317\344\3312\007\320\277\306\3400\374\341\204[\353\"q\344O\327l\026\252\233C\351\265\231\251\220\366t%A\322\310\337\b\207\260\017\034\\\233\211#h\330S\233\221+^\217p\336\354I\200\364\311\372\276\262Gl8uBu"
+	.string	"}\034(\235ZBw\036\"v\304\f\273x\304\205T6\034\247~\r\302\275\225\3266\233MNl\016/\365\b\207@[v\361\021\003\206\320\"\232\376s\t{\367\031\310\333\226\317\303\371\301\204\016r\264/H=r^C\3772Z\223k\236\323\036\232-\251\201\303\221\020\022~PlL\230I~\224xz\240B\023\220Z\022Y\271\023H\r\021\234\341\266>\265\336\261\021\266xLV\371)-\367\341\241\200\256;4v\352\327\243\211\343+\265\314\260\025eN\363.>\317\225m\242\2076T(\276\026\247\276\244\022y\307|\276r"
+	.ascii	"+\035\f\031W@\270\215]\b\2432P\013Rv;\022\336\362\220|:Q\315"
+	.ascii	"\214\007J\200\255V\247d3\333\004NtxZ\001L\204=\342V\212\275."
+	.ascii	"B\2221Vx\307\316\255\236S%N\377g\223\305z\n9\342\222\257\016"
+	.ascii	"\312\\\277\001c\370\200H{FQ9\247\352\311\237<7*\275@\231\377"
+	.ascii	"\275\350\2021c\354k\310\373\21146`\320\371D\217\370\0277\002"
+	.ascii	"HY\n\373\262dg\001S\236\242\372\177\230\b\337\016\325@\375\200"
+	.ascii	"v\0312\033\323\027*\236\312\301Ip\020\321\362\275\374\327\ty"
+	.ascii	"\200\024\3337\262\346\2425D\325\332N\312\213\220`89\245$m\346"
+	.ascii	"Hr^\021%\231\376\331v\206\225\340\362\243\275\267[\241\243t\024"
+	.ascii	"\025\307\210Fdk\336\217/\353d\227\023l \220\365\312\300\210\347"
+	.ascii	"\250k\250\021\263\262@\243\257\024 \355U)\205\247\252\234@\232"
+	.ascii	"\227\016\005\030`\361\341a\376\320)\025\253\016\254\213&\375"
+	.ascii	"[_\374:\244y?\312\211~\021\330\212r\314\033\007\350\207??=\032"
+	.ascii	";\324\234\373\360\027r{\226;i\316\205\030M\307M\201\2038Vd0\377"
+	.ascii	"\312\017\240\037\275}\361,"
+	.ascii	"<\232\205\263\346\3422\225\270\f\252c\360*\343\274z\270s\033"
+	.ascii	"\357\257I\177\220>\243>\334\263\0262\213\222K\006\365\363\215"
+	.ascii	"\344}\220f~\371\354\331\364J\336\275\031;\360\037\261\317S\206"
+	.ascii	"!\346\334~\306\347\0213\377\272;\366\347\311\356\025\034\305"
+	.ascii	"\337\247.{\006\232u\346\037\231Cf\035\332u3\213\360\3110\f:\242"
+	.ascii	"\325{U^9\357\fy\262\333\321\234\024\357y#<Qsu\346\207\350\343"
+	.ascii	"\344\251\336ubG,o\301\313\311\203x\267pl\362\210\234[\275\022"
+	.ascii	".N.\334]0O/\223\234\235\311\367\033\317\360]z\221\237\024\374"
+	.ascii	"j\3121\005\332\262~\340\277$\007\3009}\367os<\344a\217\323R\361"
+	.ascii	"\323\254\r"
+	.text
+	.section	.gnu.lto_.symtab.40044d3c085d4d13,"e",@progbits
+	.string	"sin_approx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\001"
+	.string	""
+	.string	"cos_approx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\001"
+	.string	""
+	.string	"atan2_approx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\001"
+	.string	""
+	.string	"acos_approx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\001"
+	.string	""
+	.string	"gcd"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\001"
+	.string	""
+	.string	"powerf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\001"
+	.string	""
+	.string	"applyDeadband"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\001"
+	.string	""
+	.string	"fapplyDeadband"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\001"
+	.string	""
+	.string	"devClear"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\001"
+	.string	""
+	.string	"devPush"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\001"
+	.string	""
+	.string	"devVariance"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\001"
+	.string	""
+	.string	"devStandardDeviation"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\001"
+	.string	""
+	.string	"degreesToRadians"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\001"
+	.string	""
+	.string	"scaleRange"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\001"
+	.string	""
+	.string	"scaleRangef"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\001"
+	.string	""
+	.string	"normalizeV"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\001"
+	.string	""
+	.string	"buildRotationMatrix"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\001"
+	.string	""
+	.string	"applyRotation"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\001"
+	.string	""
+	.string	"rotateV"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\001"
+	.string	""
+	.string	"quickMedianFilter3"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\001"
+	.string	""
+	.string	"quickMedianFilter5"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\001"
+	.string	""
+	.string	"quickMedianFilter7"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\001"
+	.string	""
+	.string	"quickMedianFilter9"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\001"
+	.string	""
+	.string	"quickMedianFilter3f"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\001"
+	.string	""
+	.string	"quickMedianFilter5f"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\001"
+	.string	""
+	.string	"quickMedianFilter7f"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\001"
+	.string	""
+	.string	"quickMedianFilter9f"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\001"
+	.string	""
+	.string	"arraySubInt32"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\001"
+	.string	""
+	.string	"arraySubInt16"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\001"
+	.string	""
+	.string	"qPercent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\001"
+	.string	""
+	.string	"qMultiply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\001"
+	.string	""
+	.string	"qConstruct"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\001"
+	.string	""
+	.string	"sqrtf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.40044d3c085d4d13,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
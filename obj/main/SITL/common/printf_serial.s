@@ -0,0 +1,405 @@
+	.file	"printf_serial.c"
+	.section	.gnu.lto_.profile.c5485715b7e4ba28,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.c5485715b7e4ba28,"e",@progbits
+	.string	"(\265/\375 G\375\001"
+	.string	"D\003;"
+	.string	"\005"
+	.string	"\254\277\363\246\017\002\002"
+	.string	"\002"
+	.string	"\001\240\342\234\212\n\002\226\266\306,\003\376\220\273\353\017\b\002\001\002\001\002"
+	.string	"\002"
+	.string	"\002\003\002\003\006\361\201\277\304\t"
+	.string	""
+	.string	"\003"
+	.ascii	"\270Hg\336\266\001,"
+	.text
+	.section	.gnu.lto_.ipa_sra.c5485715b7e4ba28,"e",@progbits
+	.string	"(\265/\375 /=\001"
+	.string	"\350#"
+	.string	"\003"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	"\005"
+	.string	""
+	.string	""
+	.string	"\001\001"
+	.string	"\001\001"
+	.string	""
+	.string	"\001\002\001\001\006"
+	.string	"\001"
+	.string	"\001"
+	.string	"\003"
+	.ascii	"D\005o\ti\003X"
+	.text
+	.section	.gnu.lto_.inline.c5485715b7e4ba28,"e",@progbits
+	.string	"(\265/\375 \347\375\003"
+	.string	"2\306\024\037\220)\351\017\211\020\227\210BC\375WP\201\342\355\254\2554\035\273\273\213\232\374]7E\266\224)\237h\253x\376\232j\354\374\203eo\224\366;\024\204\341\250\004\020|L\026\021BaL\2359J\243$(Nfy\003\333\226\374\017\267\275\246(m\001\177\226\004\020"
+	.ascii	"Q3`\n\327\211i\340# \307s:!\240x\016~\231+\270\321\312\342S\305"
+	.ascii	"\370\271\007\250\305T-2\213p\033\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.c5485715b7e4ba28,"e",@progbits
+	.string	"(\265/\375 \364\275\003"
+	.string	"\002F\022\034\260%\351\f\3400\005/\017\303J\205\212\034{I\222\005\226\024\027\254m\273I\"\223\f\253\013}9\004H\266\002\t\263\033m\017fO<\342*\2406\364\206\370\f<8\237\020\213<\367\342b\317\356ykY\006'x\256S\004\021"
+	.string	"\020\023\204\314bj\022\224\223\0308d\004f"
+	.ascii	"`0S\020\206\215\bs@\347\376\230\026L\005\360g\t\230i!\312\216"
+	.ascii	"\r\264\001"
+	.text
+	.section	.gnu.lto_.pureconst.c5485715b7e4ba28,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"\230\004\002\230\004\003\270\004\006\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.c5485715b7e4ba28,"e",@progbits
+	.string	"(\265/\375 g%\002"
+	.string	"\244\002U"
+	.string	""
+	.string	""
+	.string	"\006"
+	.string	"\004"
+	.string	"\002\002\001\002\006\001"
+	.string	"\003\003\002\013"
+	.string	"\001\002\013\001"
+	.string	"\002\005"
+	.string	"\001\002\005\001"
+	.string	"\202\f\006\005.cO "
+	.string	"\n"
+	.ascii	"8\001\340\216W\331\322\f\356\346E\315\273\027c;s,6\017\240\b"
+	.text
+	.section	.gnu.lto_.lto.c5485715b7e4ba28,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_setPrintfSerialPort.26.c5485715b7e4ba28,"e",@progbits
+	.string	"(\265/\375` "
+	.string	"\265\007"
+	.string	"B\21766Pm\323\001$\203\310\312\352V\251\226#\242\201T\3218\250\204\2011J\227Bk\332<\277v\347o\013\347k\006U]\263\221b\257\257E\303\223:\031\265\337\233\354\235R[\245\f\001\276\254\007\fV3\233\006\207M\303\252fj4\313\35055\f\223\315\253n\246e`\252\311\324\271QZg\365\355\247\215\236%\007\351\023#\f\243\037r\221\216\237a\b\016|w\351s\250KK\243\303\342\003K\366\347\201\361\302\376\264\273\353\350\331\027\375p\252B\027\222]\212R\312\222\244\311Fe\373\320\276\307?\270\213:\037\330\365F%\273\037\202\023,\227\376~\241.-'\240.\315\331'\005\022\002\243\211\021\224\335\235\021\343\334!\347\037\344"
+	.string	"\035\310sXY\330]\303\016Tq\307\333>\260\255`;\024\t"
+	.ascii	"\3202P&\264\356\005&.\024\202!\227`\233\325\224p\207\027\355"
+	.ascii	"$\003"
+	.text
+	.section	.gnu.lto_tfp_printf.27.c5485715b7e4ba28,"e",@progbits
+	.string	"(\265/\375`\337\001e\021"
+	.string	"\326 tG\360\262&\035P\341'T\025\355\367\261\273A_\315\272\205m\222V-\353\3403\247\236\324\252\320\264\201Fk#\332j\261\254\006\017R\315`\356\275\312t\272\304\233\235\315{\177\342\\)\375\3317\255\253\352\264\023D\366\2262\245a"
+	.string	"]"
+	.string	"`"
+	.ascii	"\0270\347\213\007\307\2340\005^\300]\032\306\375\305yT6\020\204"
+	.ascii	"VL\321\303\306\207\310\234\263;\271\311v\031O`\273\\\024^U=\312"
+	.ascii	"U\225/\033\022\272V\217\001X\340\\\306\221\326\215\n\022\027"
+	.ascii	"+\256\020\325~J\\-\335\317\216\342BH\350\302\271\216\264\314"
+	.ascii	"9\255\241K\304\275\3356\3116\213\255\f\002\255]\331\260\225n"
+	.ascii	"\216\375\025\035\242\232\367e?v\217\016\373\271M\035\245z\243"
+	.ascii	"ZW\375\222\317fV`6\347MQ\021\032!\371\263\342\261_\246\362{>"
+	.ascii	"3\211=\343>\252\313fZj<L\224 Z\b\007\334\345\r<f\2408i3\236\030"
+	.ascii	"\241\203'\345\322\r\270K\265\037\3432T\207u\b',\240\007i\230"
+	.ascii	"\340\342\262]\356\036H\213\3079\347\\\233(\205\n\264\241\032"
+	.ascii	"kW\036\240\017|p\373\325\265-\274\350\303\321\236\330\334\306"
+	.ascii	"o8\b\251T\332.u\001\3704^\303\344\357\370\202\247\017/}o\273"
+	.ascii	"\374\352\216\235\0220H\320h\221G\232\362\323>;!\370\020\332_"
+	.ascii	"\006}\350\203\320\031\252\005\244\r\2122\245R\036\310a$u\202"
+	.ascii	"Y\227T0\220<\320$\363\002\223By`L\207\372N\247\257\324\241<\322"
+	.ascii	"\251+\2012\235J\002\1771&\260K}\037\330\221\300\346\3675\332"
+	.ascii	"\363\020\242\331\032\317\3049M\260\\\366\327bZ\0247\307\377\316"
+	.ascii	"r\264\\r_\226\331\342\202=?XJ\344\003\272kG\220\240\017\343\006"
+	.ascii	"& \240\002\021\301\344\001\321\300\312\033\355mC!\245:\325`\273"
+	.ascii	"\313Z\234|\226\316\275Y\024\033\301\200\304\211\360\324p\025"
+	.ascii	"YgQ\fX\220\306\306\273\274J\353z\225=\031Kb\321IC\031w\n\312"
+	.ascii	"\301\322\303\212\250\357\024<X\370w'\035\324\304z\fS\332\204"
+	.ascii	"kZ\347\352O"
+	.text
+	.section	.gnu.lto__putc.28.c5485715b7e4ba28,"e",@progbits
+	.string	"(\265/\375`k"
+	.string	"m\t"
+	.string	"v\023C70\221\322\001\003\023\222\237\252\026\304Z\206:\306\371\"\204mS\301\232\256\313\260fI\b\243Af$\301\367\321\364`D0\260)\376\230\213\245\207\310\t\266\332o\233H\231R1"
+	.string	"4"
+	.string	"0"
+	.string	"\235G\207'\330<v>\260y\364g\303<\374X\007\031UJ\314\356f\352\361\357\371\3717\271\007\\\241\236\234\207\335u\202+\215[o\033\3016\203\375NN,}N"
+	.string	"KA\313n\306\213f]q%\304\366?\2665m\205\206\357\241\205u\227C\245\265\273 /<\355\217\234\344{\211_.\260\313\022i\355\206 '\004\007m\200\241(\373'G\251\360AL\341\345Ao\363\250\352\331\270\246\036\323+\204\213\252&\225/;D\245v\330\307vw\255,\373\341\217\305\264j\006\332M\267\026\232\020\221\272\221\027!q*\221:SV\342\266\215\323\262\022I\264eZ\347e\241\003s\246Q\227\2358\256\313>\341\036[e9\316\270Rza\200LU\2657.\003\013"
+	.ascii	"2\241\031h`\341Q\022&\242Kx_F%\327\330Wa\260\202\n=\356\360\242"
+	.ascii	"\235d"
+	.text
+	.section	.gnu.lto_printfSerialInit.29.c5485715b7e4ba28,"e",@progbits
+	.string	"(\265/\375 \353}\006"
+	.string	"R\f.3`m\322\001"
+	.string	"VX\013(`V\310\345\033~\275\234?\310\221\377\233\025D\226\340\003W\315*\273y{,\352\203 \020\330\177\366lYM\351\327g\211\334)\005\235,\f\027\nb4\n\013\033\213\202\031g\275\252z\223\263\250K\345&\250q\226\202\276\f\006\272\315{\320U\262;=\225@\237Q\210\223\021\2454{48\004\374\034G\347\366\001\2429v"
+	.string	"\2041\nI$\326fX\313\214\326\322\3777=m\"|D%\004!\277\305\211\311G(\"\034m]\351\325\2228\333\270?(&@D\377]j\370r\273jwX v07\200\204\377m\261s\341\246\333\032\264=h[\021\007"
+	.ascii	"2\003\346j\006q\241\324e\220\227!\300\245[\264\363\t"
+	.text
+	.section	.gnu.lto_.symbol_nodes.c5485715b7e4ba28,"e",@progbits
+	.string	"(\265/\375`]"
+	.string	"e\005"
+	.string	"\302\207\035'\200M:\314\203\020\025\026Y\244a\210G\261\004>\314"
+	.string	"2\300\f1\257\021\301\237\324\b\n"
+	.string	"@"
+	.string	"\235\370\t!r\313\024}H\375?f%\222\002\231\350\271\004\231o\220\211\033@\323\341\3270\205\341\312\302\026\205/\370\277\315N\tc\020\341\211;h\232!\253:\231\217\251Tp\304m\017\021\fq\331\342\346\330\243jk}\333D\240\326\355\210\203\324\377_\226\270\266\250\t\025"
+	.string	"K\215\202c\233fY\215\260Mh\236\031\006\250\007"
+	.string	"\007"
+	.string	"\007"
+	.ascii	"\207\017\020\002\227\026X0<{@\240\254b,\204E:\361\355\212\214"
+	.ascii	"W\001\2419T\031"
+	.text
+	.section	.gnu.lto_.refs.c5485715b7e4ba28,"e",@progbits
+	.string	"(\265/\375 %)\001"
+	.string	"!"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\001\003"
+	.string	"\001\002\001\001\001"
+	.string	"\003\003"
+	.string	"\004\002"
+	.string	""
+	.string	"\005\003"
+	.string	""
+	.string	"\001\006"
+	.string	"\001\006\002"
+	.string	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.c5485715b7e4ba28,"e",@progbits
+	.string	"(\265/\375`\360\023m_"
+	.ascii	"Z\236X#Q@P\312\032\003\247\276\277\266\363?\036\206\031:\001"
+	.ascii	"\3305s\342|%uie\035\257t\335w\265\357V6#\335\347<n\306O\226\r"
+	.ascii	"('\227\023\352\216\254\023\211>$\244\354>\240*\237\030\366\213"
+	.ascii	"m\355l;\335a\332m\214}\212x>\325Z\332\224R\363\001\033\002$\002"
+	.ascii	">\254\264'\262\265\226\035\355\316\377\006LQ\334\026*wQz\f\260"
+	.ascii	"\b\322\221\224V\333b\230\315\242\326\360\2308\256@\251j\331\207"
+	.ascii	"\264\354N-\373\264\r\372Q\313\334q_z\325\251,\267\353\r\320\256"
+	.ascii	"*\315\207\263\354\317VD]\313\335\326rci\271\245\264&@\370\326"
+	.ascii	"\232\213\032\013#,\354\351\20655_"
+	.string	"\226\253W\262\205[\355\206\206/\264\037\3166\226\326\362\273\3732\023s\266\257\215\326V\022\235\205;\255q\340\036\363\375\327\243vX\242\345l\260A\370\274\253-7\t\037\357\356\256I8\265\031Y\333r\006\023ZF\326aIN0\254p\223\321d\275V\302z\254\346\212\224\225\252\263\314=\306Ux3\256\342\2408\333SZ\254\255\0054\025\3362\353\265::\212\242:\313\375-\337u\001\276\006k)>\245\351\016E\242\314l\371\302\303\313Yn\241\355%\r\305\207\200\205\351p\266\231t\223\266\346\264\023\356'\375\3053\316\367\267\376\337\033 \023\307\027\232\263\"\032\204\217=\266\3349\276\233\316\361\261\034\2731\363\314\257J\220\2463gy\330\362\253\242\267\332\034NL7g\231\247\345\266\266\026sW\265Ug\361\2405\250\357\365\377z\240\331A\352\214\316\331,f\007\036\3407\340\277\325\377\207\250\311\202\304\345\235\345~y"
+	.string	"\246\177\200oZ\366\226\301\256o\203\360\265\375\301\307\334\017e\037\263\363`n\020bp\bff\301?fg\201\271Mx\032a0\367\220\263\311\33400\231\233\204\023L"
+	.string	"\263\0371\313\3541\230{\311\334107\021s\253\300\334'0\367\n\346\366\200\2717`n\r\230\033\003\346\256\200\271!`n\036\346\316a\356\035\346F\301\334B\3466\200\231\201\230\033\001\346\326a\356\005\230[\001\346\026\301\3148\314\\\306\314\275\273\273\273;\346\346\200\231'\001sP\204Kh\2741\303\264\025\352|\243\242\035\314h\360\n}\251\277\366\337^\317\217\036\360\277\203\032]c\346h\260\346\325\250\351\204Im\001\212\232M\324w^\241E\250\377E\232.\276\b\305\362\275>T_\227?v|\215\347\377"
+	.string	"\377\376\027\375/\373\257\377\277\374\177\231\350\216\367?)\b\255\026\025\375Oq\212~\3072\312\363\337\275\330\300\244\320\255&\2520\212\222\255\352\307x\227]\3755\246h\273\265\264~\215\377\357/mUj\303\213\rE~tO\324\336\211\004\360\323\321\203\314\315\311\220\032n\252n"
+	.string	"\0212\023E\214\r2T\247\344\350\346\256\204\264\325\247\230\235\006\227\3423 5"
+	.ascii	"\232/\0338\242\234m\234\376\340\023\n\331\205|\360E\247\357\337"
+	.ascii	"t\0221\326*Q\354\346K\353\021+A\034\352e Sr\026\312\237X\351"
+	.ascii	"V\0270\237\201\375\251\346.\353-\007g\035\b\273\321t\t\222T\345"
+	.ascii	",\313\271\323\233\031\225&g\275\311\177\260;9\323\273\023\n\352"
+	.ascii	"?\323\235n\306\3743o\272Gt\217`\2214M1\361\261\314\353\362\301"
+	.ascii	"N5K\273*rj\017\243.\243)\316.\341\374\232YF\222\220\264|\242"
+	.ascii	"\317\232\355HK*Is\031\245!\301R\302n\3174*\270\257\034\202T\333"
+	.ascii	"\336\242\252nB\272\274\372\n\222\326\224\\\217\356\302,\f\323"
+	.ascii	";0I\323\001W\247\004w\345H>\303i\360\336\252LW\223\025\263\333"
+	.ascii	"\360\035\256\3449\234\207O]\207'\371\221\0339\016\217z\221\337"
+	.ascii	"p\031\274\206K\333\352H\036\203\035\3522\030\347\375w\376\277"
+	.ascii	"\320\231\376\264\3214\262\002\323Rl\234\301w6-UO0w\033\034T\353"
+	.ascii	"\200\324^:n\347\031\235\241\221\366\364\305\334st-\205g\215\266"
+	.ascii	"]Z<\340\376_n+f\241#\265\235/y\326\350;\235\226\t<\317\310\302"
+	.ascii	"\350\376\337\005p\026\340=\331P%\r\201\032\273\033\354\3048\313"
+	.ascii	"\274g\353{\327\352Zf\177:\f/k\033\333\313\016Q\2032\345\254\325"
+	.ascii	"\235\336|\234\316\372\233C\321\204\235\315@s\326\335|H\353\\"
+	.ascii	"\332\202\345\203\266X\330\323\2608[\357\352\277i\342m\256=t\232"
+	.ascii	"#3\0277\203\026.\354l?\250\021%G\326z\\Q\312\346\326\324\200"
+	.ascii	"h0\354\214\234Us\034|\313\017\356\350N\252\005\354\007\034\021"
+	.ascii	"0-\367\270\264\216\306\236E\312\222\023\023\332\225yF\206\311"
+	.ascii	"\026\245\252Y\313\275&bb~\245\263\376\250\235\240\222\302\320"
+	.ascii	"\375\326\276\270\236\306\330\257x\031\030\216 _\316z\231;\231"
+	.ascii	"\233\261\227\271\025\240\363\275\214\375gv\217\260\351\036\321"
+	.ascii	"\023\243\201\251\345c\271\307\325\262\234W\001\276\313\177\253"
+	.ascii	"Be\306K[\027\247MS\251:\003T\313`\f\346a8T\236\226iR\030\252"
+	.ascii	"\377i\016\013\006\255\0060\227\302\036\326j\241\033#\303Y\217"
+	.ascii	"\342V\217\232\222\203\b\215^\323\\\033\024\036O\236\370WkA{\330"
+	.ascii	"\321\371\225\021\251#\226c\377z\353e)\"\305\244F\223&\354\206"
+	.ascii	"\023|\235ZX\252\277#3\300\2008\313\275_\262\304\253xP*\323\307"
+	.ascii	"N\325UmJ\367?\306@;\301\270\254c\\\\\336\325\376\313\206\245"
+	.ascii	"\246\252C"
+	.string	"S\016%\354]b\276\2432\266\253!VSjgO\260\260\\+\370\315\2661\270\237Ns~J\316\234\024\361,v- JK+\353\314un\316\313\312\376\216\031\225E-}R\223)V\222x\f\340\222S\222\332\rVV\267r*\316\373H&|E_\006\230}j\035\311\323\234\r%6g\231ej\331\215\370\021v*f\246\362\247\366\375#\236\272\036vt?\215\3460\257\256eg\366=3\372\377H\275\367\243M w\257k\232\327\007<o\002\352?\3265\256%\002\205\251$\342\231\352\177\351\341\337\217B\267\230\226P\256,R\017\357\373\b\340\267~<\364e\222\262\324\367\177\277\337\311$e\001\372R\243\320\227\272\f\276\223\272\374\177\245A\250\027s\331\320-&)t\213*\365\360\316_\376\026\323G\353\244J\241fTi\020\272\305\224B\235LR\017W\327\251?\356\321\230\024\032\272\306\243\361\347&\211\256\022"
+	.ascii	"\245\262\330\323C\364\235 "
+	.string	",\341\004\n=\227\030\224D\376\2100\266 \016\211\224.(\203)\020\335\341\260\246\005d\322\205\213<\312\374\020\213@\254\317\2618$\022\r\217F\027\3108\324b8\f\002!\221\024\f{.\270BA\027\270\306 \345\221\230d\2414\022Pt\215\311\021~\256\361\250\201\020\273(A\300\217;\204\364q\225\277\241\320\217K\243\302-*?\254\b\376\364\370\200\036wHh\330\343\036c\262x,\246\3202\212\024\r\244\330y!\303;<&xL\370x\207G(\344I!l9\205\220\347*\215@C\"\221L\222\350\242\207u\331E\t\035e\262HdL\372\204`\244P1\251\343\"\221I\235_\262h\3741\272\307\242\217\221F9\004\212\340&\221*\202E\240\026D\026D\276\342\260\350\203\354\200\246\350\203\fb\213\303\017\334$R\250FyD\032]!\244L\321%\202\3403Dl\321\026_0\256h\3356\t\364!\0263"
+	.ascii	"2\022Y$\213??C\024\274p\201IW\005\216;L!\244I\272*\212D\306b"
+	.ascii	"O\021\204\020"
+	.string	"\356pG\306\035:p\302=\032\207Zw\250\f\241\030dt\333#Qh\305\213\244\r\321%Z\360\"i\223tUh"
+	.string	"\202\205\302\nD\204\340\001\006mO\t \2421YT\016\177\334\2431)\244sD\006\005!{t\216Fb\220NOR\251Sb\304\n=\304\026@@\304\n\212@>F\240\f\336\022\270\365JuA\303l\344\226\216"
+	.ascii	"\211q\245N\354F\335\223\255M[\"\202\003\2149_\216\270\2504g\025"
+	.ascii	"\320\213\230\023\022\2579\306\207\r1K\234\265c\266\343-q\332"
+	.ascii	"\277\322\342\002\247\345\223@y\317\274\345\030\263/\316\372\035"
+	.ascii	"\273\321P)I\235PV\306n !B\307\036\206\316\307\364\260x8\224\234"
+	.ascii	"\221\271\030\36616l^\226Mg\247\260~`q\326\353|\324\2666\237\213"
+	.ascii	"\340U\233R\371\332\2322\252p\354s\354r]Q\264\351\027\217c\236"
+	.ascii	"\351g\rU>t\264\256\203{yr\231\242\362\331 1\023\246\303"
+	.string	"\355\216\246*F\210\224\263\236\003\273\001\235XIx\004\201\234\250\201(\246\030E#\"#\"\"I\222\244\003q\005\204 G\035V\007\022`e9\013:\350\204hAR\310\260\177\006\260\335\276\022p\263G\004X\313!j\025$\001)\302\377\341\334\340\302\013\215\3509L\243\236\221\356>*X^$\202y\034\240%cO\f\344eE\032)\366\016\001\267\254\024\031R\362[\300\3066\346\017\317\213\300\007PZ\212\350\021\270/j\033\325\341\240\213\305\302\337\200\243%\235\315\322\266\360L \bj\263\220\373\231[L\322\317\233\201\201\212'\304\307\303B\001\007Aa?CL\205\217z\036]\007\271T\213\372\213&\213\260\345?\345<\250\034p\275$\2478\326\213\331\372\007\bx\336\004\334d\t\341d\265\021\363\023\255(\331\223\250GtQ\233%\313\2726Yi\221\303\332\013\245*\342\252~\n\\\261\341hr\311.~h\223\201"
+	.string	"\026o\333\034\346\224\267\206D\240e\255\232:\326\037\337\205\025\326\326\211A\336\001\230\355\033\250\0276T\227J\355\324\b\2663\243\252p\3703?=\341P#E\3026\303\361\265~+{\2578\030K\227t\262\362X\233/n\023\024\033\344g\271\251\350\rZh\307"
+	.ascii	"qJ\321\354\210\234\210\262\213\272S-:\215*\251\351\250\213\326"
+	.ascii	"-\275\024.\035ox\177\372$\3373Dz\003\260\262\233\201 \177\223"
+	.ascii	"\016\t$\335K\206\004l$\373\213s\245-\2015\264\366\345\374\277"
+	.ascii	"\326:\275W\237\272\tV\261W}C32\026$\353%\303\354E\335qHq\263"
+	.ascii	"6I\341d\271\022d\0062J\240\324R/Q\225\311\226\351\216UI\265\017"
+	.ascii	"\254\270R@\376\377\360W\320\231\007\234\311\355\337/\2518w\332"
+	.ascii	"\022M\b\215Z\007\374\234\204y"
+	.string	"y\235\347v\362\003\246\226\301\265\005(\037\343\225\225\222mx\306k\\\023k\321\355S\312H\203\007@4\365\305\036\021\213\357\222cAW7\257\373\206\2126\266\351o\253\227\254\274/\t\367@\374w\372\337\373\317\376\254\207bM\203'y\307\365\335\220\372\310\237\023\301\363^\333\307\006\033\223\353\301\031\227*\036Wg-\362\024\347$\0231\371}4{\203h\020\334y\357\225\377\322\315\364-@\253\201\274\227#\360\345F^\206\202\004\203\300h<\022 \272\361 \252\334\001(w\365\n\256g\344\332d+\fz\"#`%d\315\323\220\234i\374q;\036x\254\204wmp\363\213\337Y\003N\364\252\360\235\342B1\374%\221\356\200\343o\202\346\024\356>h\373\243\214n\3162m\317)\216\212P\357/R\270\250N$\371\310CQk\323\342\372\367\035xC%\212\035\3701\332\321\220\201\246\340\264\027\370|\026\360\033 \031\005"
+	.ascii	"\022\330 \027:Z\266=\n\017\242\256I\367|\323\264x\373\370\276"
+	.ascii	"\273\326P0\265hS\353\032\227\201\211\363\356_\231\225,\374\335"
+	.ascii	"\333\016%K\240\375\tg\364\232\261%\364\b\315!W \020\334oR\005"
+	.text
+	.section	.gnu.lto_.symtab.c5485715b7e4ba28,"e",@progbits
+	.string	"setPrintfSerialPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\001"
+	.string	""
+	.string	"tfp_printf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\001"
+	.string	""
+	.string	"printfSerialInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\001"
+	.string	""
+	.string	"stdout_putf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\001"
+	.string	""
+	.string	"stdout_putp"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\001"
+	.string	""
+	.string	"serialWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\001"
+	.string	""
+	.string	"isSerialTransmitBufferEmpty"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\001"
+	.string	""
+	.string	"tfp_format"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\001"
+	.string	""
+	.string	"init_printf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.c5485715b7e4ba28,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,288 @@
+	.file	"sensor_alignment.c"
+	.section	.gnu.lto_.profile.515ebf213da54641,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.515ebf213da54641,"e",@progbits
+	.string	"(\265/\375 Cu\001"
+	.string	"\024\0027"
+	.string	"\003"
+	.string	"\373\355\275\203\005\002\002"
+	.string	"\002"
+	.string	"\001\374\314\370\214\017\016\002\001\002\001\002\316\304\261\210\017"
+	.string	""
+	.string	"\004"
+	.ascii	" \200\025\004\20006\320\006"
+	.text
+	.section	.gnu.lto_.ipa_sra.515ebf213da54641,"e",@progbits
+	.string	"(\265/\375 \\-\002"
+	.string	"\364\002P"
+	.string	"\003"
+	.string	"\002"
+	.string	"\001"
+	.string	"\001\001\002\003\002\003\002\001"
+	.string	"\002\001\002\004\002\001\020\006\006"
+	.string	"\020"
+	.string	"\007\001\001\201\004"
+	.string	""
+	.string	"\001\002\002\002\001\200\001"
+	.string	""
+	.string	"\t"
+	.string	"\b"
+	.string	"5cf\036\250i\374\251\346U\020\263\330\0042\331"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.515ebf213da54641,"e",@progbits
+	.string	"(\265/\375`\032"
+	.string	"\325\004"
+	.string	"\242\b\032 \220)\351\357\213\244\315\244D\200\217G4\237\327>\213\027\273\273\b\277\266\264\375\376\"\262\215\354\275S\277\332\2539\332:\317HHeB\031\214\257\366L*\225\022\232-#\032\025x\370,\333\026\220N\250\361\316\263\221\221\266\006\346\376~5\002\372\005>m\005\343\310\362i\235\3007\370h{\310\037\341\335}MJ\332\">\277B\024"
+	.string	"C\030"
+	.ascii	"\016\260\3071N\263\364D\020\322\204\003\233\201-`\337\234\035"
+	.ascii	"\"n\276Y\314\302\"Xn\202|+\303\244\204P*\\\020\025v\001\334"
+	.text
+	.section	.gnu.lto_.jmpfuncs.515ebf213da54641,"e",@progbits
+	.string	"(\265/\375 \252\335\002"
+	.string	"b\205\017\030\260%\351\f3\rp\311q(\235\347&IB\034\310\031J\354&\233L2\333\250\252zj/\236Si2O\206/\300u \361|\346\r\206\333\200\271\021[v\313{\324)i\244\361\2340A\n"
+	.ascii	"H(\006\360\302qiT\220\213\351\223!,\005\302h^\t\231\204l\240"
+	.ascii	"\r"
+	.text
+	.section	.gnu.lto_.pureconst.515ebf213da54641,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\232\004\001\231\004\002\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.515ebf213da54641,"e",@progbits
+	.string	"(\265/\375 X\r\002"
+	.string	"\324\002F"
+	.string	""
+	.string	""
+	.string	"\006"
+	.string	"\003"
+	.string	"\002\270\001\002\007"
+	.string	"\001"
+	.string	""
+	.string	"\020\177"
+	.string	"\260\204\200\370\267\004\001\002\024"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\002\b0\002"
+	.string	"\0051cO3"
+	.string	"\007"
+	.ascii	"\270B\233\301@]\033\214\266\033\343%\223\001\024\001"
+	.text
+	.section	.gnu.lto_.lto.515ebf213da54641,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_buildRotationMatrixFromAlignment.5.515ebf213da54641,"e",@progbits
+	.string	"(\265/\375`I\002\215\020"
+	.string	"\026\037mE\360\320&\035\350\030\370\355\246\2618/\2275Ifi\321\221\207\225B\243\202\233\332>!\013v\267\300ke\200xj\342\031\201\277\216{+?j\360D\354?k=\b#f\346\307\004h\236\354\241k\322\310\336R\246\024Y"
+	.string	"R"
+	.string	"\\"
+	.ascii	"8)pu\340\317N\320\256\206\003\217f\340\362\310\226\205\236"
+	.string	"\005O\373%nb\365\032\025R\200u\271\301\240b\267\205\300\t\262G\267>\302\036\263\017\300\036\275\262\201H/\036'.|6vWS\020_=W\376\277\213X1+\317\220\202\335u\262b6\334z\333 \266\033\330\371\005\327\251\220\355\272\210\344HHe\"T\260\307\353\311\fM\rK\276\354\326J\352\214}\270\273k\225\261\337\372?^\363w\304\264(\2463\230\016\3054\026\323\021\246aLkL'L_\200\250\006\201\234\335\f/\034\353\212?#\216\363\333\377\347\016\337\3467\253\007jGx\013\315\221\251(\244\231\222xJ\316bEH'|\240\301\324.\375\207'*\0065*i\206\351>=PQfn\250\332\247\247\260O\201\020\266\311?\324H\306\356\212<\302\217E\303\3471^\300\330\365\310\353\005\344\262\313\002\222\252z\030\022-\371\3625\225\344\002&\310'\337\331\354.\251\023\212\tG\302u(UI\325y"
+	.ascii	"6/I>l\nQq\247\2153A\241\224J\274.\305\235R\032\327m[g\3228Ti"
+	.ascii	"\323L^J\0131\340\216\302\311\323T]\347i\035\255=\\\225q\354\340"
+	.ascii	"b\321\026\247\300]\017#A6\371\362(?\364(\3769`\331\017 \344Y"
+	.ascii	"\036qp\275\350\212E\001) \340\202\031\242q\003v\"\346j\340<\264"
+	.ascii	"\343\030Zd|\f2TFW\243`\356\370\2127\341\313\353\255\251\357;"
+	.ascii	"x\345\033\303\267`\257\027\335\336a\2058\262sq\016k\323N\361"
+	.ascii	"pA\025\214\233ha)\347\030B_\0066\230P;\346ch\333\304x\003\324"
+	.ascii	"J\254\341\205\340\311"
+	.text
+	.section	.gnu.lto_buildAlignmentFromStandardAlignment.6.515ebf213da54641,"e",@progbits
+	.string	"(\265/\375`\332"
+	.string	"\225\013"
+	.string	"V\025M>\020Q\234\016<\226\341\232#\324\224\007*\004\200@\020oC\205\"3\"S\"k0\255}\321\023\362\377!\246\271A\345\340#\001\200\002\n\267F(\b\256\376\250)\312\375\260w\032\354\266\245L)<"
+	.string	"="
+	.string	"7"
+	.string	"\2247\333#\001H@\212n#\306\356Z:b\313\355Ps\363\003x\334a%\272B\005#\0202\bx\0368Q\321\321\375\364\344\340}2\001Xv\327\031\362<\334\324m?\260\035\301~\203\351C\006\300\220\260\330\355\360Ac;(\016\022\266\037\261\235\337Ol7u\240\201\375\204 A\250NM\340\323\276\211\223\266\2274\374\300\356\250\006\212\335o\201\031T\247\374]\022OUG\020\037\352\fQu\302\351\305'g8\365\252\nWt\"\247\306\r\310;1\352\365\247SJ\264\3508<\371a\177\\\252\b\373\t\362p\361\301:\262_\372\253\233\376\250i\325tj\020\007\005\214\251p\260\314\205Q\320T\270H\320\262\r\226\331XXv]\031\306\3024\227\313\302h\033\253Bqf!\243Y\234,\323\254\310\267\267lP\017\214\031\265R\373\002\206|\310\224r\337].\030"
+	.ascii	"@\025\261I\356\334\034(3 \f[L\330\254\201\350\2607Qm\201\324"
+	.ascii	"\024q\013L0\210;\363\2227GK\327\200b\030\r\204\317\324(\270,"
+	.ascii	"M\215\006w\271\251\366h`j\017"
+	.text
+	.section	.gnu.lto_buildAlignmentFromStandardAlignment.part.0.9.515ebf213da54641,"e",@progbits
+	.string	"(\265/\375`L\003\215\030"
+	.string	"&0\240G\320VM:\325+\240\261\013\326\022L\235O\021\235\270cA#\305F8X\004G\201\362\312M\356b\360\3555&,\316{\240\355\201\202l\323\003\374\321,\0028\034\365\246\2167\f\334\f'\275\275\231\2315b\367&r\247\024\210"
+	.string	"\206"
+	.string	"\213"
+	.string	"\307a{\016\020\235kyP\320\230\340]\302t1>\254\335F\216K\270$|\034\243}\032\257a\273\215\234\257\354\246`\372\261\033\312\\z\201w\351\360"
+	.string	"\346\245\367\226yi_\206\355\232\315\344\341\212\365\261\315f\342\022b5\004\024\222\262\273\257KUa}\027\336]\264]v\032\247\315\307\351\\v\256\335m\341Bt\tD\340vb\027{^\374\\\177\364\030\004I\017\356\347\221\345\363\004aw\355\225\270O\267\355\301\366\005[5\004f9E\257\234\242]3ZeF\267f4kF\257f\264\352FwjF\243\036\376\336\213\356\223\214\2362Z\312\350NF\253\214\216\027\372\357\362\227\245\335\021MK{B\002i\361\242\337\350\321\276\337\343<\374#\243\232ax\326\207\221\272%\2320C\211\223\335\255\340\r\335\037\252\371;\254\262\375\"+`P;\021\3150:\341\216\360Q\300\300v\"Z\267@\017b$q\262\033\306\\\232\202w\251\272\214\027\252\205\213\323\033\001\267\226\252\350"
+	.ascii	"(_\216\245(m\251K\022\b\264R\231\2634@\221o)\310U\272\322\027"
+	.ascii	"\246\017FJ\343\2154U*\200\351sqR\224\376\350\335\013\035M\300"
+	.ascii	"\334MwWG5\310\266*\316\233\310\214\271\247\266\006X|\217\001"
+	.ascii	" \031\371T\307S;=\351\227\200?\336iS\352\324\203@\277\201\251"
+	.ascii	"*\365%\351[\322\323\246j\2473\t\004j:mFU\375gb'6\371\032\365"
+	.ascii	";\036Sb\b\314\335bS\324 \353\374j\n\273\305\213\0013\233\017"
+	.ascii	"3\335\f\307F\002\013\025A\3054\bpb5\260\030\006\233\r3\026nd"
+	.ascii	"\263X\315\354\025\223\301`2\232W\314f\006\366\242\271\231\275"
+	.ascii	"\020\024\260\214C\315\315\013G&\273y\305C\270\351\216\365\227"
+	.ascii	"\032d\224\222\266\250*\305\230\247T\204\314S\372(8\224x\342\024"
+	.ascii	"\353\273\335\335\356\300S\332\242\250#H>\023,j;\303\211\314\020"
+	.ascii	"H\262\273\016l\232\017\251\031\260bw\033\b\211a\360Y\\\3729\363"
+	.ascii	"\362=OV\224E\017\346n<\3570]\272\242\377`\250\250K\273$0\027"
+	.ascii	"? p\002\231cW\007\255\bH9\2230\2717\273OA\356\034\253\"\020\004"
+	.ascii	"\277`,\032\022\254\332\371\245\267\2610\240j1\335fo\362\3311"
+	.ascii	"\334\016\262\020\216 \304\370\222C\375\342\212p\233\031\235Q"
+	.ascii	"\307\226}\217Q\0307&\327R\213\260\2144\212}\275k\036\303\367"
+	.ascii	"`\004\215\322\247\017\334r\254%-W\276\020ra\025\305\355\b\267"
+	.ascii	"\023\251\035\347b\370\005\244\277\314xr~\207\227\006\250\005"
+	.ascii	"\2561\212/\264\303\022\242\332\254\217\247\214\235\177m\030\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.515ebf213da54641,"e",@progbits
+	.string	"(\265/\375 \247e\003"
+	.string	"\222\005\024\037\240\031\322\001\217\301\375\345\337\006\370\332\307\333\332\023k\377\377\377\017\030\346\326\366\244\374\226\354-S\323A\266M\\v 4\206F\ni\233\341\016\333\376\341R8\001ka\2514\b\027\250T\211\031\034\240~DSRD\376~\302 \333\026\035\252\377G\n"
+	.ascii	"\2560h\b\206\317\"V\231FA0\\\366@\307\2356\001\261u0\311"
+	.text
+	.section	.gnu.lto_.refs.515ebf213da54641,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.515ebf213da54641,"e",@progbits
+	.string	"(\265/\375`9\r\255D"
+	.ascii	"\332yp\032DP^N:\373\246\321\017\270G\337\315\344\341\301\253"
+	.ascii	"\270\305\021\235\203\343\305\177\\e\327\036\326\272\241m\361"
+	.ascii	"\021P;&#/\226\316\n\207\325\26059\244%-\300\020\364}-@\204q7"
+	.ascii	"HS\013\223\311\220\266e\n`\001\237\001\226\001j\322\204!\363"
+	.ascii	"\205\246%\352\323c\246\314U\177F\303g\202\314.h\213\264z\331"
+	.ascii	"\373\022sU\272\245`\026;\273(W=\177\261e\230\fK\331\f\1779\313"
+	.ascii	"\t\225G\335K\354\360\231a6\366\302\3232UM\217\257\273\227\232"
+	.ascii	"\232V\264>8\347\252\236\273\210\251\023\307s\f\307R\226\373m"
+	.ascii	"\273\227\f&\f\277\t\203\272\241{g\335\375\n?\324Y\216\307\360"
+	.ascii	"\333\201\033\335P3\003n\352p\371\363\353\356&\245\246\246\243"
+	.ascii	"\026\262?V\275\n\366&\330\227`\023p`\317^~\316\302Z\370\215\241"
+	.ascii	"\335\313\356. \304\243L\333\334U\331\215\267\260t\211\271\234"
+	.ascii	"[\356\362 e\333-\347)\323r^\365\210\007\254\267\300\236\243'"
+	.ascii	"\360\246/|ekt\007\006\362\322\312-\324\271\355g,\274\226\264"
+	.ascii	"6\237m\277u\267Q0\216n\013\320U\357e'\360\200umy\300\312r\322"
+	.ascii	"\372\277\313\377\271\377o\314`\003k\370\217\342\377\201\2371"
+	.ascii	" \375\274r\205\237\241.\364_\243\237!8\375w\363"
+	.string	"\037\356\377\364\277\334\3777\377\345\374\207\363\177\f\231\237%\224\370\257\364\377\357\004\376\353\340\347\b?7\370Y\350g\001?\263\377\321\374\247\373\017\350\277\237\377w\376\317\371\257\367?\315\3773\377\205\377\353\376\253\201\201\201\201?\037\3757\352\007p\027\320dw\353<b\276)\223\314\214\2169\231Q\250\023\251\227\235\354\250R\214]B\235\3145P\347\0213\252t2\227cN\244$gfv9\320\224a8\311\\\366\016\2570e\363h\312l\241-\247\233\337\266\272\271\240;\f\332\224\243\f\302qZ\323\035Za\224Pn\275\264\216@{9e\246A\273\323\264\250\332\313B\262\235\266\031O\223H\302\272k\253\333\200Ww\222{\332\335\311\356\026j\206\265\335C\216\230g^^\335O%\257\016K\312mu\337\2679qNf\364\b\024J\216K\364\254\271\332$\237\265\234\261&\033M\266uWws\037{\346\354\221'\020\240"
+	.ascii	"q\366\236"
+	.string	"_W\345\277\245\242e\336W\233\217?~\256\026\265\265\366\252~\234v\203-\355\252\277\315\362a)\367\341\276>\254\207\367\004\333\232!\356\274\36051X\235V\033u\317\317x8\017\343\r\305\351\361\230\002\310\236\347\260\027\312\003\326\006\234\264\362\035\276\343\363\007G\035\313ux\217\245l\347\252\033\264\243\335mQP\t\304\016\216i5b\246\265\025\376\271\373\352s\347\344\031\311\005\222B\346\252v\034'\330\326\034q\227\205\217\363\230\215\361\372\310\232\036\313a)\347}\211e\353sBW\025\357p\367\266\301S\304\357\252p\224\204\310\364AK\212a_a\314\223\2650G\255C\313\312\031\033\006\303S\026s8\341\262\355&\353\035\024\035e\336\260\033\276c)O\271\315\271\216\327\\mjR\342\300;t\326X\365\\\306\252,\306~\312\003V\"\016?\330\353\343\367\351\343\"\t\342\021u\322\255\2778\004j\003\310\257\231O\246"
+	.string	"m:\332\334\030\371E\362{\204\302\205\357\261V\250\340)\257z\307.|\332\315\361]\365\027z\305\376!"
+	.ascii	"hd\321*|\330K`\335\2008\235W\275E\276w\323\366\272\360\\\365"
+	.ascii	"\022\271\231g\236\237\222\260 \233#wZW\275B\356\020\226\276\356"
+	.ascii	"\202\2755\022\316qy\251\273\303\336\006\277n\275@~\203\314\025"
+	.ascii	"!\033\313c\377\373\343\013\036\330\331\033\366\301\272\034\317"
+	.ascii	"qy\260\335\035\354.\302v&\364\022{jq\376\362\370B\226\326\346"
+	.ascii	"\252w\307m\016\025Ir!k~\365Y\213\003\244k\215\342\002\255i^/"
+	.ascii	"!\277:0*^]\354\336\324\312\024\277!:\270=z:\270OI\215\252}\311"
+	.ascii	"\273\352\203jl_f_\256\265\233[\350W\263\237M\2463 \007\376&\237"
+	.ascii	"\274\\\334\315\356g\007\353\250\031\202\306\257\237O\246\240"
+	.ascii	"\030\033\300\255_\256\237\302\205\333!\352^\353\356\003CJ\236"
+	.ascii	"j\376\256z\225\367\006\321\0241\\"
+	.string	"e\367\306]\2527\324\272\362\350X0\265 xW\225^-\376\262\366\311qRw\325\357a\276\377C\035\306\342\340\340c\177\245\354\357\277\266\262\331\335<\202\332nj\021\235\203\230\231\376\"\016\362\202\016\376\001_\267\2223=,\032\234\022\354\252\377\023\364\255t'\221\272\355&3:\226dJ\3378\221\332\026+\320Q$\315l\307\234*\264o\267\315\275\034s\302`\266\320&\263\205&\217z\031H\251\f\310bU\226\220\225\321\370A*(\351TN.\212UG$\326\023\221E\226\325T\261\352\351\210\225\365D\300\312*\253X4\026\205\220RD\032UXk\f\343\221\ni,\n\265\030\022\255T$\021\353\212x\265\232H\360)\006\023\234\220\307\341\013\247\343\220Eq\210<qe<\206`aU\225\265\242\351SUGb\221\350\202\275\205(\tQ\031d\b=\203\206\t\032&\254\317\240\001\nJC\024\024\373(\250 2"
+	.ascii	"\362\212\261\244dT\035\221C\022Ec\025r\2104\036\245^\264H\"J"
+	.ascii	"\t[\020YH\025\235\312\t\213\n9\2742 \365\242\305\020\026\321"
+	.ascii	"\312Eq\270\"O\345\340\306\027\304\343\023\322h<>\005\260\262"
+	.ascii	"2\036U\252)d\325\213\240\030\303\031\301,)\017HH\251((d\261J"
+	.ascii	"\350PP \022\244(!\202\235rB\026\211WE\027UVC\251\243\021\253"
+	.ascii	"H\304z*\032\257\256\214SO\305\252\341\325\323\324\021\353\311"
+	.ascii	"\251A\214\3411\270\206D8e\0134\273\352\275r\325~\261\034\313"
+	.ascii	"\275X\202\201\201\200\272\225F\314\n\230\025\254Y\340tY\325;"
+	.ascii	"\345Ra)\202[%\230t\353\265\"\300+\200\177P\3303\202\225\003\031"
+	.ascii	"\301\372\337\264\313UF\317\316\230\253^)\367F\271h\277R\356\031"
+	.ascii	"\321\262\275R\324n%\263\002!\263\202 3N\224[V\365\252\031\224"
+	.ascii	"&E`@\330l\271\252\022\013=s\326w\325$Or\233\260[\177\361\226"
+	.ascii	"\275'\223\252\247\347N\026&\277MT'\340\337\326U\257\222\273D"
+	.ascii	"\355r#2\267\304,\311\317kL\031\377\t\301\310\310r\224\275\213"
+	.ascii	"\360\360H\351\250\001\200\351\250\221,\206\220C\212\314\214\210"
+	.ascii	"\214$I\322\001`\002\221)3\233\003\022\34055\016\"\211jH\322\324"
+	.ascii	"\330\317\353IU\343\365\233\253:\330\314^\027\264,\367\355\260"
+	.ascii	"\fq\301\366\312\37582\352F\251\205:\223YQT\223\265\3349\231\350"
+	.ascii	"\0306\266\207\205P\201$9,\337\244\270\242+\033P\030vE%\257\254"
+	.ascii	"\003lr\177]\016\251h\360R\024Q4n>\322\033h \364\356\310\202\216"
+	.ascii	"\002.\340t\242\260\245\363\247\333\256s\316\345\236me\002m9-"
+	.ascii	"\244\232\301\374\225\2270Z\364\225N \022'\001\030<L?\332K\226"
+	.ascii	"\270\021\320\201B4xu\350\277\242W\257I\247\337\207<}\350\337"
+	.ascii	"6<-\3415\376>p\027\0353\305\335\004\354\306\263\314\215\215\321"
+	.ascii	"\345\227\b\230\337\236i\206-\n\204\320\370 j?\3073\235\330\342"
+	.ascii	"L\004\254\271$\350IU\355M\016\002mP\217#\270D;\203\222\r\262"
+	.ascii	"w\226\031Jg\307\245\022-#l*,\321IjQ\0268\302\023\001\251H\202"
+	.ascii	">\031\255\253/G\222\022\026Y-r\002Y\200\212"
+	.string	"\216\340n\346\302kgL\0010~\033?\201`\303@\022\363<%\223\256\023\337oP5.\220\264^\0176\234\031\260\350\301\235\007\216\337\370\217\350\217\272\212\230\bhI\0049{\230\325\263\360\017\217\213\n\225_\3530j\256\003"
+	.ascii	"\325Y:\332\311&\253\002v\262Mf\013\023^\350\250\b\375\033\025"
+	.ascii	"\330\201\022\357\262\240d\351$\264\210[\2416\273\310\013\354"
+	.ascii	"\223\301\206~D\314\237\f7`\376\275\f\213\"\244\211h\353f\331"
+	.ascii	"\201\320\034\250\374r\201\273\347C\347\026\350\331\344]\371\001"
+	.ascii	"\345\236\372|\360\221E\274\346\237L\001z39\214\222\254\212\250"
+	.ascii	"\303\355\373\247\272\227\232,\252\303p*\256\365O\3307\343I\277"
+	.ascii	"\356\325\256\332<\271\375u[\256w\310\257\332Fq\025"
+	.text
+	.section	.gnu.lto_.symtab.515ebf213da54641,"e",@progbits
+	.string	"buildRotationMatrixFromAlignment"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\001"
+	.string	""
+	.string	"buildAlignmentFromStandardAlignment"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\001"
+	.string	""
+	.string	"buildRotationMatrix"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.515ebf213da54641,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,569 @@
+	.file	"spsc_ring.c"
+	.section	.gnu.lto_.profile.1de167c453418ec6,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.1de167c453418ec6,"e",@progbits
+	.string	"(\265/\375 \270]\004"
+	.string	"\204\006\254"
+	.string	"\n"
+	.string	"\240\222\351\301\004\b\002"
+	.string	"\002\001\002\002\001\312\363\256\311\005\002\002\002\002\003\002\221\323\231\240\017"
+	.string	"\003\350\262\224\300\003\002\002\002\002\003\004\363\332\260\353\007\n\001"
+	.string	"\002"
+	.string	"\005\362\266\316\370\004\001\006\206\202\304\260\t"
+	.string	""
+	.string	"\002"
+	.string	"\007\272\355\341\351\017\b\004\002\004\b\223\220\257\206\n\t\274\322\325\307\b\b\004\002\004\002\004\002\004"
+	.string	"\016"
+	.string	"@@\3160\340\216k\003lx\\Y"
+	.ascii	"r\273\020&i\334\020\356n\332\300\247\362\263\333j\003X"
+	.text
+	.section	.gnu.lto_.ipa_sra.1de167c453418ec6,"e",@progbits
+	.string	"(\265/\375`\025"
+	.string	"\275\003"
+	.string	"\364\003\t\001"
+	.string	"\n"
+	.string	"\003"
+	.string	"\001\001\001\001\002\005\002\002\b\004\001\020\004\006\003\002\001\002\003\001\001\200\f"
+	.string	""
+	.string	"\n\004\002"
+	.string	"\003"
+	.string	"\002\005\001\001\003\002\200"
+	.string	""
+	.string	""
+	.string	"\001\006\003\003\004"
+	.string	"\001"
+	.string	""
+	.string	"\001"
+	.string	"\007\b\t"
+	.string	"\030"
+	.string	"\320\201\013\004"
+	.string	"\361`a`\360V\207r>\257\201\262\0062\013*\005X\320\223\n\315\300*1]\005\200\0314\310\216\251s-\3138k*\3034\025"
+	.string	"0\271"
+	.ascii	"C"
+	.text
+	.section	.gnu.lto_.inline.1de167c453418ec6,"e",@progbits
+	.string	"(\265/\375`O\002\035\t"
+	.string	"\222\214&*pK\222\016\026\fW\002\214\323I\374"
+	.string	"\004{\243XJ\340\021\337b\263\354*\334\376"
+	.string	""
+	.string	"\300;\376\035k\254%\255\021\262\345N\001;\254\3129\214\266"
+	.string	"\310\312\031{\245Ak\2269\367"
+	.ascii	"!\321\300|\0027(2*\006\250p\023\027\021\016\004j\271Y\367\204"
+	.ascii	"\311\222Rh\t\355*#\004,\377\007\367m\217\300\350f\331\017\271"
+	.ascii	"\207\253\255\343kV\004\375\374\3579\213\266\220y7\321\224\030"
+	.ascii	"e\371\205\266\f\005w\242\2356\364\204s:\217\247\260m\321\375"
+	.ascii	"\013\215\2669Wi\253\376\361\031\004< \220\242!2;\017*\204\242"
+	.ascii	"\t'6y;\330\\\023AJ\t\307\375\020d\230\314:l\343ba\002\016c\307"
+	.ascii	"\275\020\333\246,@i\316\214/\241\034 =\220\313l\026U\314\364"
+	.ascii	"b\225\217\030\302\325(\001\304\276\345\026\204c\263\271\315Y"
+	.ascii	"\f\214\331\362\245\301\276\307\210\265\331i\020\332\240+\265"
+	.ascii	"@1\r\f\317\035\243` \253Dy0!Z\343\212\347U\314\246/k\261'\211"
+	.ascii	"\354X\274\b\3227\272\330\360\2672\027\256PC"
+	.text
+	.section	.gnu.lto_.jmpfuncs.1de167c453418ec6,"e",@progbits
+	.string	"(\265/\375`\277\001\225\006"
+	.string	"2\t\031\036\240'\351\377c\333\017z\315~\027"
+	.string	"\340\216\307\007\""
+	.string	"L-U\253\317\267\244\267\335[&\031\274\361\214\r\t\230\231*\304\320\253z>\254\323\030ip\231\234s\316f\200\231|\213W\245NO/\356\212O<\013\246\330N\207\365V\354\025\353\274\326\302k\231\344\007S\324\243/\225\364[\017\351\335#\374D\001\213\b, P\"1T\251\007(\370\212\203\b"
+	.string	"9\370&AL\273\004\"&%\006\t2\241\342\260\361\006\277\351/B\023"
+	.string	"k4.cg\251\210F\263{E\317\2175\356DP\003pY`0\2006\200\351"
+	.string	"k\016F<\344\314\376lS\331\004^\303\3375"
+	.ascii	"X\321Vc\307\237\375X\336\t\305m\211\034\2440\220\373JX\334w]"
+	.ascii	"X\224!"
+	.text
+	.section	.gnu.lto_.pureconst.1de167c453418ec6,"e",@progbits
+	.string	"(\265/\375 #\031\001"
+	.string	"\037"
+	.string	""
+	.string	""
+	.string	"\n"
+	.ascii	"\232\004\001\205\004\002\230\004\003\231\004\004\232\004\005"
+	.ascii	"\231\004\006\271\004\007\232\004\b\231\004\t\271\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.1de167c453418ec6,"e",@progbits
+	.string	"(\265/\375`\214"
+	.string	"M\005"
+	.ascii	"\302G\027\037\260%\351\002\013\020\006T- 8\241\260\267\003Nq"
+	.ascii	"\205\0035\2016k\245\021BHkD\312\024+\211\002\b$i\022\022\255"
+	.ascii	"0X\022\342\263\330\224*g\214m^&dA\r_\306\344\307>\324?\035n\361"
+	.ascii	"\271\314(?\312\2778r2dn\330\207\372}\317yj_\345\310p>VOA  \200"
+	.ascii	"\002\"!=\300\fhB\372\001G\334\267\215&\tc F\0340\315\314\314"
+	.ascii	"\f)s>\315\300\036g\001\225\007\033\003i\211\216\344\035\013\200"
+	.ascii	"u\036]\3409\365\030\214V\232\254\215\337\f_B\321c$!\357\r\016"
+	.ascii	"888"
+	.text
+	.section	.gnu.lto_.lto.1de167c453418ec6,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_spscRingInit.2.1de167c453418ec6,"e",@progbits
+	.string	"(\265/\375`\377"
+	.string	"\315\013"
+	.string	"\246\325N@\020Q\225\016\2500\260\200\025\240\t*\216I\367?\342\360\006\nB/\2315\300'\201\306{\373\0307\251\320\201\f\244\202\320\016\006"
+	.string	""
+	.string	""
+	.string	"\005\225T\020\"&i\20746\252\267\306F\342\336{\357\224\002:"
+	.string	":"
+	.string	"?"
+	.string	"\273\"\024\250\335o\342\211\365\351\357\002\350\247u"
+	.string	"\364\323\236]c\200\005\311\t\203i\265\273W\fq\357\320\363o:\004\024\352\034r4\330]CPH\303\035o\333\200m\006\3667\004\353(\262_\372\351\277_\236\364G\t\375\016\310\214"
+	.string	"/v3\324\033\233\2320F\330~\304vLq\025\336K\235!\273\037\352\002\353\263\200\204\337&F\202C\373&~\302;\211\363\217\326\336\342"
+	.string	"\b\022\252G[\302Yt\320\004\262\341Qk\255\357(\215\217S%\343\202\207\017\254\226\321\346~\332X\273\253\300_AA#\241!\202C?\021\214Jp\360\300j\177\035\030G\366\345\356\006\225\n\027Nn\025\213E\003\201Jc\224\b\230\313\346"
+	.string	"\3432\334\205\321\262L\303.\314\345Ava\033wQ\bX\313T\266k\202\246mW\344\333\313\215\"\317\016)O\374\370.ngG\255T\357\250\003\030"
+	.string	"\\\211\"\023O\365\242\301\005"
+	.ascii	"\251\266\204\271\"\240l\024\313\267&I\020Q\340\026\302\307\204"
+	.ascii	"j\256\261\3770/\b\237\251Q\270L\tC\200Bp\031\030\021\240\242"
+	.ascii	"\204;\274h'\031"
+	.text
+	.section	.gnu.lto_spscRingSize.3.1de167c453418ec6,"e",@progbits
+	.string	"(\265/\375`D"
+	.string	"\255\b"
+	.string	"F\321=7@o\323\001\320\276*@Jp\374\257r\272' d\317\036\352\343}\3474\360\333\327H\244\220\251\255\267\346\303d\034EgH\322\267\242\204q\002\332\360%\212d\357\275S\n."
+	.string	","
+	.string	"-"
+	.string	"\030$\003\024\211\221\226\335J3\307P\237\362\002\324g\274\370w\370\371\007\271\206\345dD\002\035\002 \354\256\341\210Dq\307\333\326\330.\260\275\022\323\342\300\220\354N\234\\Ve\232l\330\366l\3136\204\366M\377\360^?\017\330-\245\224\354\326\2157\325\247ke\333\357\270\207\347O\326\021\025\"x\262\335]\244\241\332\2058\360C\036\034*\215O\377C}>\016d\230B\360dW\020\214\026\366\345\356\256c\311\362\365\217\021\372\001\035\r\343\244/NG\303\270\204\253\363tT\333\262l\273\250\206)d\364\342:\312!\360\346Y\340(\303\266q\324\252{\313\230\tE\221\377\217z\224\021\276\004\n"
+	.ascii	"2\003\302\260pq:\315\330\333eTL\3035`\342\301\335\036\325JG\230"
+	.ascii	"d"
+	.text
+	.section	.gnu.lto_spscRingCount.4.1de167c453418ec6,"e",@progbits
+	.string	"(\265/\375`\275"
+	.string	"\355\n"
+	.string	"\246\324I=0O\224\016$|\203\224&=\326\234\241'\355/l\027pN\026p\n\204qhP\354\255\325\357O\250\rVK"
+	.string	"\310FJI\030\030\200\206G,\371\214f6\2103"
+	.string	"\337\376O\366\2262\2457"
+	.string	"5"
+	.string	"9"
+	.string	"\020\333>\207w\360\370\363\"\007\311\300\n\t\035\214\335HYN\231\016\337\003L\207\212\341\237\347\307\177\210\023\350J\034\t\364|(\330]'G\242p\353m\017\260]\300\376\202\177\253\033\216<\376\360\245\237\246\365\245S\323\227dhP^\354N(\305X\026\020\205\006\333\036{b;\323\376\207\203\360<v\016`wC\305\211\335x\361\005r\350\030\235\352\303\205$\363N1]\355+\313s\251\b,DP\220\375\216S\341\330\035\235\263\037|\304\006\331\035\035\020\261\201 \240E\206C\2773\035^\265\203\253\020\312\222\035A\251\027\354\031\314\322\236+L\006\2634\006\325\246\331(,\273\256\254\2420\253\301EU\332Fa*\3164\0164j\223e\0325\211{G\324\022R\221F\024vhl\020\235\304\365\351=\230\340$\260^\342\001\024"
+	.ascii	"2\003\302\260\244\335f\232\361%\032i\302#\300\rx\007\023\007"
+	.ascii	"/A\210\2430%&\236\340\013\30251e\242\005k\350\006L\020p\242G"
+	.ascii	"\265\322\021&\031"
+	.text
+	.section	.gnu.lto_spscRingFree.5.1de167c453418ec6,"e",@progbits
+	.string	"(\265/\375`\223"
+	.string	"\245\n"
+	.string	"\306\025L= O\234\016\304\022@%\024\313\225\222@|\354G6\340\016\332\030\300iA \207\334e\t\374\327\037\036\334\300\262N\030T,\002\b\002 "
+	.string	"\030\211|\013@\002\331\3020\f\"B\266\224)\005:"
+	.string	":"
+	.string	"9"
+	.string	"\237\034-\333\376\207\203\300\370\203Q\364I\300b\002\t\027\273\021{|"
+	.string	"\365\t^"
+	.string	"\365I/\374{~\3761\216\240\305\n\317'\363\254\026\354\256\323\363\251p\353m\037\260-\261/\t\360\361W\230\276\005 \005\001\025\273\024J/VcB\241\301\366\375\021'Y.\302\0058t\330\335\313b_\237nc\354\313v\246\375\321C`\036/\017\260\013\3128\261\033!\206X\001\241\f\r\216f\374\177\024\324Js\243ca\223%\237\344\0077\341Y\273\034\005~\t\t\021|\f\237\374\213\236\364\024e\3600\322d\311\216\233\324\220}\270\n\262a\272r\232\202\351\223\215\322Ag\221\311F\351\030d^\305\3036N\323\270\f\333(\r4,\353<,b\300\\\305A\207A\340\270\016\273\242\3466\245\017\215n|\255\224R\335\350lp\244\252\255qy\317\365\030w\004\f"
+	.ascii	"2\003\302\260\005\0236X\032Q\320\204\345\032\036C\023\020\250"
+	.ascii	"\360\366*\n8\321\243Z\351\b\223\f"
+	.text
+	.section	.gnu.lto_spscRingWriteSpan.6.1de167c453418ec6,"e",@progbits
+	.string	"(\265/\375`\342\002\375\025"
+	.string	"\306\352\222I\300\224Q:h\344=\nJ\337*\331\251`&k\275b\001%\245\315\242\37730\2012$\224\n\223P\247\266m\370\031\231\331\356`T\342o\207E1\r\240L\243(\250\321\256\005\243!,$b\356\2559\244\266\204\020B\244L)|"
+	.string	"s"
+	.string	"\200"
+	.string	"\223\334\261\311\203j\377\370Hwq%\223\273\"0I<*\2519=\0301Z\360#\236o\356\032<\035\3711gi\340\240\025\214\333\242'\n\201\252}\335Y\374\274\364\271j\316\017O1\346,[\3342\036t9\332\366S\\\305\217k_Y$\224 *\b)j\316\262\245\362\224\360\340wVxpC\274v\255\371W:\201\023\275\234\020\320Ud0\347\264\346\2046\334{\333+\266!\330+\023(t6\355\331\345M\027\204\375o\3169\275\037lQ\215\"\252YV\257\316\273Uo\361\003\370\321}\362\244\333DT\223\337\335%/\377\324\250\026S\352pT\203\242\372\023\325+\2525T?\345"
+	.string	"."
+	.ascii	"\323\234\031zG\346\016p\006\211\363\376\243?\351\337\375\263"
+	.ascii	"/#\206?\004\352/|&\223\274\332\b\244at\241\353\375xp\030_\262"
+	.ascii	"I\357\374\205aVD\315\031\005X\240\320\331\276=Y\365\021\324\341"
+	.ascii	"\366\272\216\361\333\b:\224\3355Y\365\201\033*Y\335]1\007\316"
+	.ascii	"h\245z7\205_{B\214>\247{#D\030\026\310>\216\331yP9\333\365\033"
+	.ascii	"\007\337T4\347\374^\351_\t'\0359\016\266\327B\326\242\254\"\301"
+	.ascii	"\r\335\264\347/\371u'\236q\316\013/\276\215\033\230k\302\203"
+	.ascii	"\254\375\322\265h\204m^\2436\3169_|\0327\026\006@\211\360\t\017"
+	.ascii	"\226,\313\21221:\343\202U\370`0\231\203\031\214\326#\223\242"
+	.ascii	"\301f44\261\320Es\315|\237_.596\262\230\327Lg\326\312\211\341"
+	.ascii	"\340\304^\255\034\033\027N\353%\233\265\\\0048\246\003\223\265"
+	.ascii	"h\261\230\254E\226\266\333+\"D\266\275Y\265&\273Z\026$\\\020"
+	.ascii	"rU{\246\177)\210\364pF\267\247\177K\356e|E\210\023nH\\\277\007"
+	.ascii	"\205\230B\371=\341\301\347\310\001\261i\317\341\202+\356q&N6"
+	.ascii	"\334m\nJb\223p\0361p\0033 \240\"!K\036\334\243H\241\335\b\332"
+	.ascii	"\304p\362]$\037%!\241\230q\002_{\333aK\346n\002\332\251\230e"
+	.ascii	"\346\252\221\211\224\203\202@\0305^\033\n\312`\223W\260,eh\037"
+	.ascii	"|\244,s\273c\267\325\332\315\375\230\202`hb\204at\260\274Y,\264"
+	.ascii	"\2606#\306A\260\245\224\213p\201\352\032\230M\240xcF!`\316v{"
+	.ascii	"&\245su2"
+	.text
+	.section	.gnu.lto_spscRingCommit.7.1de167c453418ec6,"e",@progbits
+	.string	"(\265/\375`\264"
+	.string	"\025\013"
+	.string	"6UK>0M\234\0160\344\003\006'\262G\256\020\027\023\254\375\266L\275Y\215\227\305\236`j\353\343\277\376$(,\307X\377\340\367t\220a>ix\316\344G\031gJ\031\3051\312\252Q\244M\244L)6"
+	.string	"9"
+	.string	";"
+	.string	"\273\341\303\217\353\321\341/\254\307\353\026\326\243?\233\304\303\317^\004:\030\231\330\335L1\374{~\376E\307\300N\346IQ`w\235`\007\302\255\267\035\300\366"
+	.string	"\373\007\002\017\375\326A\177\254\322\252\351\324\364/K\302\210\f\021\273\017R'\326\024Ch\260}\207\355\f\357\341{\350bl\327\302I\300\365\b\240z\332\347\360\016\337A\230W\354zJ \002\0258\232\261_j\200\361\001?<j\234T\023\005F\260\364\232\032Q\034\n\033{']\256\335%\340\217,\f\256\f\030\353\361\212\225 m"
+	.string	"i2e\207\231\324\013\366\253\335]\253\307\016[D\201J\266IWY\203H\266I\207@\363*^\266q\024\n\247e\333$\001%\323:/\203l\230\253D\272\314\302q]\346\b\367\325\252\307\006&\2304\2721\226\217\247\252\332\334\202<hG\024"
+	.ascii	"2CG\025\230x<\023\342@`VM\243\352\266\251\022je\023S\003]3!a"
+	.ascii	"lP\327\330b\230\027\204\317\324(\270,M\215\006wy\321N2"
+	.text
+	.section	.gnu.lto_spscRingWrite.8.1de167c453418ec6,"e",@progbits
+	.string	"(\265/\375`\237\003\265\032"
+	.string	"&2\256G\240\232M:d\037c\24710I\006\330G\274\337\313\355\2143\250j2D\337\325!\321\321\353\2115\355\320s\357\246|=\350\352,\324\365RqX\323x\205\211\027><M\255\302\260\3400\274c\256s\377\220F\366\226;\245\232"
+	.string	"\215"
+	.string	"\235"
+	.ascii	"M*FaV\225X\255\277\003\247n0\312'\331M\235\n%\203j\301\002E\234"
+	.ascii	"Q \245}\254#a\372o\304wj\275\342\362\252\365'd\241\361\324\277"
+	.ascii	"\361En\204\311\273\371\253\341\023\263\250\242\224\230\251\365"
+	.ascii	"W\013z\217x:\037@<]\032\026\345\3562\221\316\225;\237AU\231\236"
+	.ascii	"\257\351\262\034_\224\360R\312\367$E\026\2477=\246>\247\203#"
+	.ascii	"Cl|\353\022\205\017j.P\b\305R\312GB\356\205\237BZ\\\351\371\246"
+	.ascii	".e\020j\255\226=\337\212{\274\355\022\266)\330\213\025Y\246\334"
+	.ascii	"\360^\3316\322@\243\364\317(\355\323\303s\340\257ci\332\273\356"
+	.ascii	"\234\177\3358\377\375\263'\371o\036\f\336\224J\317\225^\231\264"
+	.ascii	"\024\245?@\264\202E@W\255)\306\324\3240\n\266\343]\377\327\257"
+	.ascii	"\365\007?\355\333\347\362\275\016\346\331\327.\b\n\211\327\204"
+	.ascii	"\361\264k\367\272\242\336\204\017\031V\022\316\344C{\346\245"
+	.ascii	"sy}O\206\324Z\277\304\337\362\314Z ^y*lzY.\304j\365\212\260d"
+	.ascii	"\317N\245\315\344\013=\263\035\334\215\001\247@+\311\364\246"
+	.ascii	"|\226\266?K\311|h\f\227\262\033k\255C~\224\016\031\374\034#\304"
+	.ascii	"S\237\375\360\006\302\004\211`\321\345\331\nUPx/v\344ww\256M"
+	.ascii	"d\223\3579\210\267M\276\326\347\002\360B%Wgw\267\n\017\210\334"
+	.ascii	"\323\366\253\240\252+j\215\223\034cbu\025e\336D\332\2728\221"
+	.ascii	"&\313\013\224D\343\234\305Y\3322\330\302\033C\367fs\026\301\220"
+	.ascii	"\307\343I\216\031G\336\311\2678\214\275\331\332F\036\344{8{\260"
+	.ascii	"\357p\t\026\t#\261M\253\345\013Pkw\206\375{\222\037\n6\"\251"
+	.ascii	"\201H\342lHI\023W\244\244d\244[\222\341\212>\254M\311\266aN\337"
+	.ascii	"\022p\300\031\351\210nIHI5\\\356\350(w\253\341\214lG\265\233"
+	.ascii	".\251\226\240\200sHE\272\232R.\247\253\315~N8.\322\365\244=;"
+	.ascii	"\216G\301\253\022\346\264O8d;\303\337\272\315U\020\035\223gC"
+	.ascii	"\374\320!\375\235HW\312\266o\226\356\205\2279N\200\311\242\002"
+	.ascii	"%\321\314Zk\025\347\322\355Y)1\340\200&Vb(\210Yk\214\007[\337"
+	.ascii	"\021\003J\241\377,\320\372C\013\027f0\206\247r\364Sc\312\216"
+	.ascii	"@\227Z\353PE\250A(\206\020RF!#\024PTB\201u`\002\221Y\306\016"
+	.ascii	"\020pY\232t\234(\264\336\327\016\326\n\f\261\230\230\224\375"
+	.ascii	"\016W\240\023\274c\304\277\351\314NT>\200:>\017\320\242e\214"
+	.ascii	"L{l\334\363W\364\214D\362O\256\335\224\026\240l\361\234,B\222"
+	.ascii	"\205\322\026\201L\223tH_\241\312!\207\"\376o\220\251!\242\263"
+	.ascii	"k\331\227\363ewyg\210h\211H#\342\375\241U,pRF1\277\356\013\""
+	.ascii	"\367\341\b(\216\250k\016R\342U\316nc\007z\005\330\212\355M'P"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_spscRingReadSpan.9.1de167c453418ec6,"e",@progbits
+	.string	"(\265/\375`z\002\245\023"
+	.string	"\306\246\205J\320\224M:\310$\001\364\300Zb\274\002p`\013\247\340\350\b_ \340Xu3\231\351 \f\240\007\366]\037k\266\343I\006\2559\322\013\207\217H\311\023\370\342(\"\345\b\020C\272@^fL\002\3104(\225&\215l\"wJ\001t"
+	.string	"g"
+	.string	"q"
+	.string	"!\221\317\203\241\230\222\232U\255\001\241\242\247\301\203b@\332\006\320\310\366\363Tkirj\006\340\002\311\030I0\247\375\237\257\240y9sV\255;\272\030\265\226'>\001O]\202\266\375\024\367\241\361\314+yr_\013\0246BDj-\305\222\017\370N\275\013\370NW\304g\2373\377E\367\204\340\350p9\332'\312A\255\325\023\227\273\271\367\266\021\330\226`O#\001;6j\232\345\351\325\217n\325\201~"
+	.ascii	"\017\272I>t\207'\272S/\177\020\234\376R\323\024\234\366P\323"
+	.ascii	"\213\232\236\337\364\003\2408\344 \300T\253\206]\221\212\203"
+	.ascii	"&\221\370\321\037\364\017\375D\367\354\373F\327\331\241a\016"
+	.ascii	"\303\347\341Tk\r\377\302Grx4{\275\251\317\360CG\321S\004\030"
+	.ascii	";<\275M\343\013\335\305\213\034\337\376V\202d\351\256\222\315"
+	.ascii	"\221\032\205\333 \275\245\271\035\273$;\233l<\330R^\003\334\r"
+	.ascii	"iL\251\235\033\356l\272\365\330\346\316\2529o\245\357k\217+\363"
+	.ascii	"\270\2712:\030\226f_)\206\302\203\263[>\343T\301\367&>\364\300"
+	.ascii	"u\260\353I3\260\326\272\300\227\361\262`\300i\304\251?\363\235"
+	.ascii	"\246\226\262\270q\342\2476wvi\233\033\302\276Wk\255\336\025R"
+	.ascii	"\346\005WK\346\311^0\344He+1\026\026\362k\311Z*\236\347\021\245"
+	.ascii	"\345\345\202\245\214\261\227\230\370\"]\\\310Q|\271Z.\342\b\213"
+	.ascii	"\211(\005L\276\254\300D\031I\302\304\260\254\335\253\273c\333"
+	.ascii	"\253\035\242S[\233U\033\356jM\204n@X\253\332#\035B\016\216\356"
+	.ascii	"\326\363\317\276]\326^\367\003Ah\334r\276\365\227T&L'_\346;\375"
+	.ascii	"\022\316Gm\356L\327\333* \300\"\031d\035\\G\021\342]6\"|\005"
+	.ascii	"p\302\371\356X\2148\273\026\267sK\360\232\246\363\035_s5\233"
+	.ascii	"5\013O\t\024\2402\355+P\3047\177\353\260\264M\340\216\204\006"
+	.ascii	"F\177\362\274\261Z\020Ew^\246l\234\307\313ZQf\264\273\342\306"
+	.ascii	"D!\310\274v\215X\212\351Zd"
+	.text
+	.section	.gnu.lto_spscRingConsume.10.1de167c453418ec6,"e",@progbits
+	.string	"(\265/\375`\264"
+	.string	"%\013"
+	.string	"6\325K?0M\234\0160\344\023bt\026\227\032\303\246\013\377\327_[\214\027\251\361\361s"
+	.string	"\246\266>\376\353O\202\302r\214\365\017~O\007\031H\204\001\345\216\224\034\304\023\247\214Q\2245l\177\332D\312\224\0026"
+	.string	"9"
+	.string	"<"
+	.string	"\273a\304\221\353\321\3411\254\307\353\027\326\243?\373\304C\321\276\004\242\201I\305\356fZ\341\337\363\363_:\006~6\317\007\201\335u\202\237\007\267\3366"
+	.string	"\333\002\354\033\b'\375\326G\177\254\322\252\351\324\364\257\007h\204\006\212]\007\251\025{\212\".\330>\304v\206\337\360\235\2241\266;\301D\200\353\261\243z\332\317p\r\337G\232[\354\206>\204\b\022<\272\261\357\201A\206\b\354\360\270QB5Q \004K\257\251\021\345\001u\354\235C\346\332\335\001\276\t\263\340\262\240\261\036\257X\n\022\030F\234L\331\341&\225\202\375jw\327\032\262\003\333$\201R\266JWY\223P\266Jw@\363.^\266q\026\013\247e[\005\201%\323:/\223p\230\273L\272\f\303q]\006\t\367\325j\310\005\"\2348\3321\226\221\247\252\332\234\202<hH\024"
+	.ascii	"2CG\025\230x<\023\342@`VM\243\352\266\251\022je\023S\003]3!a"
+	.ascii	"lP\327\330b\230\027\204\317\324(\270,M\215\006wy\321N2"
+	.text
+	.section	.gnu.lto_spscRingRead.11.1de167c453418ec6,"e",@progbits
+	.string	"(\265/\375`\241\003\335\032"
+	.string	"\206\362\257I\260\226Q:4',7\347pK\222\254o\031\261\0312\005\353!\030oAE\303Y\257\004BX\223G\266\266~\260\321\274$v\302AbU\273|\007\265\367\235\367\017\341\236\245\017\355\177BH\200?\340\217Em\244\221\275\245L2\232"
+	.string	"\220"
+	.string	"\236"
+	.ascii	"\343\221\212\021\b\2055\254\325g\340t\033\214\374\"\345\264\251"
+	.ascii	"\270&\024\013\372G\002K\002\346\335?\235\210\321}%~S\253S\260"
+	.ascii	"\252V_\317\366\214\247\353\033\037\344B\214\266\234\276\031<"
+	.ascii	"\021\312\211\316\210\230Z}1\002\317\021O\347\001\210\247-cE."
+	.ascii	"\357\022\351l.\367\fz[;\336\321]5<\035\360\234\304\273\261\310"
+	.ascii	"\342tf\307\322\347t0\344\007\215\007\317J<\334\354\037p\311r"
+	.ascii	"\022\317\004\367\201\237>\230\266\354xKg\027\204Z\353\362\216"
+	.ascii	"\267\342;~wO\354.\205\335~\n\367\221\362\244\306\266\323\356"
+	.ascii	"\213\227g\344\335\031yurp\376\373m\226\027v\252o\315\255\276"
+	.ascii	"4\367\375\344\213\3743\217\212\372\322\346\235.\336\246\274,"
+	.ascii	"\362>\200k\030E@V\255)\266\310T-z\225\343T\277\325/\365G}\356"
+	.ascii	"~\367I\366U\277Z\322\252$\200{\252\2320\236R\225\257+\352Q\360"
+	.ascii	"h\312\222p$\027\356\222+\342I\266y`\304\324Z\177d\037\\r\245"
+	.ascii	"B\274\346T\274\224nP\206\265VE\020\261K\236\362\256\321\036\270"
+	.ascii	"\344\356F\225\001\224\247\371\313nI\247a\275\323\364K\256w\023"
+	.ascii	"n\2067)\307Z\253\317\236\211\007\r\373\033%\304S\235\276\360"
+	.ascii	"\005\270T\001\362D\033\247/\364\252\344z7\374\346\236\275\373"
+	.ascii	"#\343\357V\301\213\\\037m\267M\317f-\271\036\335\327\225\271"
+	.ascii	"\324\271_-`\375N\320\313\322\225A\342-$LNL\346L\204\265\213\024"
+	.ascii	"MPWp<fk\232\246a\315\340K\316\013\355\231\256\351\003\302\234"
+	.ascii	"\216\033o-\r_\311\203\035\306\035\331\273A\037\370;\232\376\325"
+	.ascii	"o\250\350\210h\231\350\243\236\222\345'\325\035c\327w\343"
+	.string	"\262\037\336\360\3034\331\220mr\220\001U\260\001\025\221\330\360\242\001\201hY\221\214\303\234;C\320\201\026D\3643\263\r\331b\264\232\220Pm\026\243\005\311\204b3\"[\f\301\200\255\r\001\021\305\212j5\242\030\351C\262q\221\366N\232\323\343x%]\226\026R\337l\270:\306>\370\327\215!S\023\247G\004\231\342})\322N\332\335\235i\332\007\236q(\205\201\302\302\361\230Yk\255\342l\3329\2354\374\005\230b\352BC\314Za<\b\376f\370\343\236\3574O\357\205\0260\220\027\036Khg\306\223R\200\225Z\253\317\003E\250A(f\220B\n!2\024Pd\201\302\352`\002\231Q\306\016\020xI\232t\\\024\352\326ko\326\005\326\204&\256\n\263#.\360\004w{\342a:/&\311z\017\373\003x\245DG\367;\346\032\343\025iF\031\207 \214\267\343\303;1\317\022\"\b^H\202@\3724\202"
+	.string	"\214c\032\204\005\245S\337@ZcB7\326\222\037\363\bn\342\263/\254'\216\211x\373P"
+	.ascii	"\213\ri\220\230|\341w\212s\360\020\374HPm\216\362\304\277\274"
+	.ascii	"\260\315=\"+\304\256\300c\0228\r"
+	.text
+	.section	.gnu.lto_.symbol_nodes.1de167c453418ec6,"e",@progbits
+	.string	"(\265/\375`\317"
+	.string	"\315\005"
+	.string	"\"\210\036'\220+\035\177\357J\215\310\254"
+	.string	"V\351\263\037\r\020u\311\365\373\037\325o\257\215\242m\333\032!d\223M\366&;m)\003\t\341\203\221\035\317\257\022\235\335\245\266D.\315\344\254Pw<\224KsV+B\326\253\271\301l\265\030\0223\342\325\341\224\356nf\342c\370\244\205G\302\245\301\341\202\263\221\b\036\005\376"
+	.string	"w\325!\352m\272\331c'\231\317\314@\264\355\356\3063\226\231\212\t\032"
+	.string	"\240\b\330\027\020\214u\017'd\242\313\030`<\220\035\316\361ZE\004\255a\200z\370"
+	.ascii	"\241\377R3\b\206gO\t\211\003\237\203\317I\f\262\3017\3007\300"
+	.ascii	"7\3007\300\017\327\232c"
+	.text
+	.section	.gnu.lto_.refs.1de167c453418ec6,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.1de167c453418ec6,"e",@progbits
+	.string	"(\265/\375`\362\017\375I"
+	.string	"*y\350\032BP\334\326\030\227\310\223O\353*\026\227\300\201U(OA\237?\316\021.<\3306\021\032"
+	.string	">n\223\267"
+	.string	"\241\007\311[\210\252\022\005\351\314\021W\020\004\206xipTdD\301"
+	.string	"9\357\213H\362\222\244\224\002r\001\225\001\247\001t\336\2321j\353\2441\244z\313\035\345r\243}i\3536\346$771M\246\313\264]\277=\246\347\270\351\272\216\215\336\177\351\377\367\032\367\230\016\323r"
+	.string	"|\376\273\336\256\377/[`N\032\323`\032k|\253\374\1771\021\352\003d\223\223\370\377F\210`\024!B\227\275\301\226\371i\371\205\333F*\\.\3412\b\267\337\032\256\337\243\216\343fk/\354#}?\353\363\007G\253\315[\316\340r\037\035\205\372\350\310I.\363\365\200c\203\036pl\273\3508\324EY,O\366\356p\317[\346\3062\367Y\243u\027\343\224\210\365\333\376_\"\367\323#\022\365\266\267tZ\277\nZ\215+``\343\263\313\243\375\277BA\213Y\026\025\275e\b.3s\341"
+	.string	"\320\307\300\356r+8\366\235Vp\344\267\007\034\335.:\332\365O\2478S\364\300.\b\001P\021\263\027@1\202N\213\210Q\200\331\217Bx\333\005"
+	.ascii	"!\200\271\3450\363\233\376`\210\350\246\027x\350\016\207H\346"
+	.ascii	"f\323\303\334j\230\331\216\231\30703\031f\016\363\340\207\271"
+	.ascii	"\31507\007\346\206\300\334\f\230\273\210\271\203\230\033\210"
+	.ascii	"\271\217\314\315\314\254\310\314\210\314|\310\314\206\314,\310"
+	.ascii	"\314y\314l\206\231\3170s\027f\216c\346>f\346cf\275;f\3062\263"
+	.ascii	"\0213\34313\320\235;w\3560\033\231\271\331\230\221\t\002\355"
+	.ascii	"\327i\324\264`_5\"U\2222\177uu\324V\203V\322\264\341\026\344"
+	.ascii	"A\344?\332\377'0\232\365\345a\275m\300\016\354!\203\226\205\013"
+	.ascii	"dc\366Q\214\230q\025\315\244\332x\333kz\356If\353\210\267\375"
+	.ascii	"\327X\344\241\227\235\367\226\343\264\0343\373\034\367\252\352"
+	.ascii	"\320\301\342\2623\037\037J\375\377\"<\357S\243\310c\363t\037"
+	.ascii	"1\007\265\261\0350s\373F&p\370\237d\354\320\275\002\006\212\305"
+	.ascii	"\r\236\315\376\237D\377>u\232\355zN\327\320T\211\336\347*\360"
+	.ascii	"\331\257\237\276]\325\326\372\376\357\367K\273\2529\246\257\225"
+	.ascii	":}\255\317\241\227Z\237\377ouh\332\006}\3664\333"
+	.string	"U\235f\255U\242\227\376\363\263P.Wj\255N\363\254\325\241i\026Z\235J\273\252DH\306\232\244\t\021\353\202\322\325\251\364\251\246\262\240\324!\276\351k\3755\377\335\026\365T\007\377YV\352\032\250U\317E\371\250\242qPk\277\377o`*\352e})\337t\314\372?\026\265\361S\027\236/\337\2075\337\363+\353\211D\375\037\370\367\177\352\377\331\317\367\377\317\377\357\241f\275\377K\206\246\327\251\251\377+\243\251\317z\322E\375{[\340\\u\232\365\262&\321\261e\257\037\344}\366\365\327tQ\335\354S\355\211\374\177\303q\257U#\206\336\276Y\001WeT}|\307E%jX\2763\306![\016\301\274h\310\252*1\353\236\236O\242\325\226\335\033D\r\003\027'\357(h\316_\324\f\357\016@\232\027\260N\245_\306\363+\037\251W\357\267\001\250\013\342\206\307\345\362\217f\274\243GY\302\305\356\305\345aG9"
+	.ascii	"\f\261\340\344\034\214=\314\251\244P\260\336z\023\177\202T\243"
+	.ascii	"\272\241y\342\3048\366\027'\352\177\230X\311\355y\353_GV\\\336"
+	.ascii	"\274\274\3552\nq\035\t\273\022$\276ud\363\037\245\360F\327\374"
+	.ascii	"\364\352HHkm\317\b\023\366\255#\027-\314\372\345\255/q-_\\\374"
+	.ascii	"\242s-\317\032\254#$\216\267\203\216\305V\004<\204E\362\214R"
+	.ascii	"\227\343\260\030$tgz\336\272\025\373U\035\223&]u\\fO\362\366"
+	.ascii	"\207u\225\343\262\003VU\271\221\273\306\223SD,\302n\004\013\006"
+	.ascii	"\b\021o\275\352\324;\237\362\251\270\236C\352\021)o\323\251K"
+	.ascii	"\271C\037\365\323r\025\002\214\303J\031\302.\305S7\b\005\342"
+	.ascii	"\255\013\351\300\226K\314\355\254\257\247\224\255\335eq\250C"
+	.ascii	"=\312\257=l\330+ \264'l\3348\020\366(w*\214,\212\267.\355"
+	.string	"@--(n\336z\264\371\220\177r\342\002\305\354\330\361o\017\330!\205\213[^\254\334a\177\2414j\\\250\274\355\305\016\364\t\304\233\"\346Y\211\211\255\230x\005\"\304\017\220\016\267\"\034\326\331\026o{N\007\nQI\241\023\230\005J\243\025W\305[\366!\210\210\201H*b\004\365\354\034\036\266\241\373\377\306\177&z\327\237-~k\204\203\203m\350\363\324\377\253\016ce\n\235\315\352\335\336p\033\266\\\017\031\231][!r,\257/\261\220\320\215\376_\333\3133\2475\025\343-7\032\227\003lcB\215\245\262\351|BJ\316\200jbZ*\221\232OPH\004\232\232\240\226K\346\262\307\251\224\364\241|:\366\300\301\344\224t:^PJ6\231\316\247\241\031J\246\216v\007\263i\303\311\\\366\320XJ6\265\027\224f,1\233\224\230\224NL\347\222\222\222P\322\t\352i)4c)\311b\310\251trb\222"
+	.ascii	"\260\\\302\321\"\351T6a\020%\223M\023\316%\024\223DP\322\207"
+	.ascii	"\262\205S\271L\201d&e3\271L\326p\371B\006\t\0314\360\350a\r\033"
+	.ascii	"(l\240pd\r\033\222\2226dHr9C\222\321\3116\0260\023G\262\211\344"
+	.ascii	"d2\233H@M\312%g\373\244Tc\251d\361\323L\322\240\001%\343x\343"
+	.ascii	"i\311\251u*U\260\340\316XJ\332h\235J\032\234K%T\017'%\221h\340"
+	.ascii	"b\305\t\227iB\215\245\262\251\304\364\204\343\ti\311trb2!-\225"
+	.ascii	"KNHL\315'\244\t\n\336\\\352H\026\270\2606v7\303$\\X\336:\233"
+	.ascii	"{)\273\276\261y\331\315\340\025\301\2724o=\353k`W\2670L\310\205"
+	.ascii	"\324\304\261\304@\254\237\365P\235):\351\322\212Bs\312\374\322"
+	.ascii	"\324<\214\214\026\300\350+\347\272\r\362IqiC -\212\205\237\346"
+	.ascii	"[\255^\266\t\325\0264"
+	.string	"V\366\340\352\274\025c\227\"\346gF?\344?\273|U\007<\274\271D)\302\256&c\354g\354Z*``7K'll\336z\026v\26308l\32327\253\"\030\267\b\346:\026\tZt\270\352\220\375\200\241\221B\346\2557\2139\372\025v3UG\246\345\255[a\302\24085\260,\257b\334\363\362\213z\353S\002\201Z\250\261DE\2344\"\"\"\n\222$\311p\221\005\204\030\006)\264\r\021@\261\222JhD\222\202\224$\323\001+\362\244\264\203\265\013\243\n#\206\224l?\350#\246eNw%W\346+S\337\n\374\254\177\217\222\0065\323\032\330\0278yfg\301\377\323V\300\327\233\026\260\227q\307\226l\245b\306\243\031n\2771\357`\346j\f\2567\331\254\342\325\254\342UY\216w\331\341\325\331\341U\003\342d\031\313\251\356\226G\277\204\232K\237\f\201\\\324hL\317Q\023-\tn\354I\245\034"
+	.ascii	"2\324\267/\274=q\313\337\263\332{\2605\373\3109\236\202\257T"
+	.ascii	"\355G 1\261\034L/&j\212\205v\271#\3258qXT=\236Vp\351\2659w\276"
+	.ascii	"\035\022\212cPE\354_\300\327\240\372\fTaUY\224\335g\373\227\037"
+	.ascii	"\036u~-_\021\017\033f\3630\252\274\375%aE\210\016-\363\2300\263"
+	.ascii	"L1\327\214\023\272x\336T\002\313Q"
+	.string	"\313%L\312\310$\215+3G;A(\357\264<\b\267e$X^\320\336\f`\"\313\017\375\263Z\026\315"
+	.string	"\220\f\315\276\275u\322T\204[z%\213\207\013\273\237\335\314\330\221\373\"\374\326\330\371\362\325,&\377\250\027\nE5\241\037\371\271\226\375\201\222/\326\307\037p\r\017\352\342\0219\362\226\256\003\264\245#\324\036\003\372\325q\306Y\304\rvP&q&\\\333+\310J\017M\224\226\371>\203\312\222\253!\307hB\347\034\352\311P\322Ti\343#\341\023\230\252\245M\265b:\352\220*\027^^\375)s\350\362E\221\373\355\241\316\377\371#\373\242CM\037\025\217\177\255\350\353\355[\b\201\"\332\231K&\030\376]4\220\207\353\037|\372\246rT\246\216\326\317\231ql\252\237\222\317N\232pY\370"
+	.string	"D]\242\325\341\251~\326\220\354\032]\277`=1x\217\033\031\242\354\233\255S#\334\031}\307\013o\241\357-\274\375M0\204\202\177\212\\r\276\316z\275b\324:\f\036\004\017.\177oh\177:\2429\021\213\353\227\323\022\213c=\347\230\354p\361\006C\275\261\021\272\277\340\341>\363\337\034;\323\337su\332\272\355\205_{\364o(\216\320\034\211]\330\236W3\352\002\300\0254\277\314\307\332d@,\024\342C\367\260\233\365`\306\273."
+	.ascii	"o\036\034,o6\337\362j\257=\226\375\232*3z\177"
+	.text
+	.section	.gnu.lto_.symtab.1de167c453418ec6,"e",@progbits
+	.string	"spscRingInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354"
+	.string	""
+	.string	""
+	.string	"spscRingSize"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362"
+	.string	""
+	.string	""
+	.string	"spscRingCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364"
+	.string	""
+	.string	""
+	.string	"spscRingFree"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366"
+	.string	""
+	.string	""
+	.string	"spscRingWriteSpan"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373"
+	.string	""
+	.string	""
+	.string	"spscRingCommit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"spscRingWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\001"
+	.string	""
+	.string	"spscRingReadSpan"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\001"
+	.string	""
+	.string	"spscRingConsume"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\001"
+	.string	""
+	.string	"spscRingRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.1de167c453418ec6,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,251 @@
+	.file	"uvarint.c"
+	.section	.gnu.lto_.profile.4ce7c3e80c717413,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.4ce7c3e80c717413,"e",@progbits
+	.string	"(\265/\375 <=\001"
+	.string	"\3100"
+	.string	"\002"
+	.string	"\331\317\334\222\003\004\002"
+	.string	"\001\230\243\246\342\f\f\002\001\002\001\002"
+	.string	"\005"
+	.string	"9\203\225"
+	.string	"\270\220r\003m"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.ipa_sra.4ce7c3e80c717413,"e",@progbits
+	.string	"(\265/\375 ,\235"
+	.string	""
+	.string	"H "
+	.string	"\002"
+	.string	"\003"
+	.string	"\003\001"
+	.string	"\003"
+	.string	"2%\006\221\300"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.inline.4ce7c3e80c717413,"e",@progbits
+	.string	"(\265/\375 e\335\002"
+	.string	"2\205\023!\240'\351\177\216N\304\323?\026|\270\\x\300\361\373b\3777\034"
+	.string	"\214`\214\031\215\270\261F\344N\001\277\323\314\314\215\003\224\t\006\004\344\021\035\222\241\300\364G\275\336\207H\261`\210\345\373>\315\314\300\361\330\244\332R\372\207M\250\266\222\357M\003"
+	.ascii	"v*\336C\005\267\001,"
+	.text
+	.section	.gnu.lto_.jmpfuncs.4ce7c3e80c717413,"e",@progbits
+	.string	"(\265/\375 ,\035\001"
+	.string	"\330 "
+	.string	"\002"
+	.string	"\003\001\001\001?\177\002\004\177\002"
+	.string	"\177\002\003\001\001\177\002\002\177\002\003"
+	.string	"\002"
+	.ascii	"e\346\265\001,"
+	.text
+	.section	.gnu.lto_.pureconst.4ce7c3e80c717413,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\232\004\001\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.4ce7c3e80c717413,"e",@progbits
+	.string	"(\265/\375 ]\255\001"
+	.string	"\340Q"
+	.string	"\002"
+	.string	"\003"
+	.string	"\370\007\374\007"
+	.string	"\001\001"
+	.string	""
+	.string	"\002\001\003PT\002\002\004"
+	.string	"\001  "
+	.string	"\n"
+	.ascii	":\t\314\334\340e\320\250\b\273@7\351\346\274\254\033\006\202"
+	.ascii	"\334@\033"
+	.text
+	.section	.gnu.lto_.lto.4ce7c3e80c717413,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_uvarintEncode.3.4ce7c3e80c717413,"e",@progbits
+	.string	"(\265/\375`\313\002\215\026"
+	.string	"\306\351\222K\260\322U:\370\"P\207\373m\034\347\017\"\271[\310\231\244\033\246\203F%\033J\322\316v\271\314\252\316\341(\335\366\215\247\303g\223;\260\351\346i\320?\224^\034:\016\002\222CMof\305<\275\263\351Dks\b\021B\266\224I\006\177"
+	.string	"y"
+	.string	"{"
+	.ascii	"{\376\320\314\252j\335\tjQ+\360\300\242\244>\376\304\203j\273"
+	.ascii	"K\0212\320\036\024:#\037\265V\030\201\273\310\217\364-\362c\203"
+	.ascii	"\330\221kO\225\344H\233k{\232\247\0324\355\330\261\311yI\035"
+	.ascii	"\364\334\300\301\352\351\350\004\0179$\253\227\373y\346\365n"
+	.ascii	"<\222\3009\245\f\204\200xX=\034\355\340\311\364\022\034r\270"
+	.ascii	"\177\276\300\017\323\256\207s.Sj\255\313\273\236\315W\365\335"
+	.ascii	"\355\260\273\013vy\0308'\035\321\306\305\256!\f&u\377v\2014\234"
+	.ascii	"\200\206\214\236m\337n\tI\311\353z\360o\275\350\037\371\320/"
+	.ascii	"R\362\206\254L\222\027d\344U1o\352C\337\222\362\222#\357\310"
+	.ascii	"\274\364G\337\036y\231\362^\200\331#\300Y\353\206\342\217:ct"
+	.ascii	"1\342G\377nm\177\256\271\273G'\264\252x\020\204\244\243V \312"
+	.ascii	"\307U\320E\027\206\b\030\370\024\265\007e\016\240V_\f\0300\025"
+	.ascii	"&7B@d\377\226\024j\240%]\"\351\360\362~\036\002\017\221\222\364"
+	.ascii	"R\026i\263y\273;C\232\315A\037\242&\034G\321Zk\035\373\367\023"
+	.ascii	"r\325%\335&\316\234N\371]\"\315&\351~Q\314\021\307\336'\305\314"
+	.ascii	"X!D\354e\310\217\314b\367d\253\237\221\334cS#\335\315\273\325"
+	.ascii	"\264o#\367s\343\342\232\315\255\302A!}\360\301\240\375\333\221"
+	.ascii	"~\323\210\234p\034\265\253~\377\274\201\261\030\263`\210\275"
+	.ascii	"P\032\214KWP\211\351]y\301\310b4\225\030\0130\331\254\245e\266"
+	.ascii	"\002\223\305TZ`+\264\027\330\313dg.,4\030\314lF\203\231\300\372"
+	.ascii	"\366\255Y\243\324\257\227\302a\351\352\237\227P\243D\276\036"
+	.ascii	"\022\322\233b\353\233OjA\332\325\327\021W\274\033\244\233\007"
+	.ascii	"TNG%\233\255\276{\262\265\252\237\203\354V\247\\\302\334\317"
+	.ascii	"m\300\260xS\216\253\356\346-\035\315.\233G6\005\"\247n\262\333"
+	.ascii	"\210)9 p\002\021\203F\017\253\002+\353\206\263m+\356\261\307"
+	.ascii	"\305\031&^\260\t\016\334\311\271\017z\206\243C\fZ'\265\236V\241"
+	.ascii	"?Zb0\177\337\320\3337\214ES\225\270\273\240\213P\320\307a\221"
+	.ascii	"Hd\244\321\300\23603\212\001\036\235M49\343B\212\241\034\002"
+	.ascii	"\020\205q\"\310\253\bH\031\202\205]\366\bH\\\205\177XKHw\t\265"
+	.ascii	"\361\361\240\346\027\211`\235W\307vq\"\232o4\355\224~\255#\320"
+	.ascii	"'"
+	.text
+	.section	.gnu.lto_uvarintDecode.4.4ce7c3e80c717413,"e",@progbits
+	.string	"(\265/\375`u\004\035\037"
+	.string	"6\372\311H\220\332\321p\005\201("
+	.string	"\b\202\005\302\223\317\\Dc\221\260\177\252\037V=4\306|m\233\200\346\f>\317\321K\232\307\017\354\260$\347\0213\362\334\004\352\265\232\211\364<\311\372\355\005Y8\316\026\210\2676\273\367\336[\312$\003\274"
+	.string	"\250"
+	.string	"\264"
+	.string	"\267\275\226\201R]b\301\252\f\214\252\026\023\334\\\bi'YJ\323\200\263Ll\341\235w\217u$\300\027Q<\247\252SWOT\265\250`\023\2447\267\230\376\310\255\200\273_\030V\224U[V%gTU\345\375\\\347\274Y\036\300y\263q"
+	.ascii	"\271,~S\006\276\226\242\247Y6\003\367*^\023\203\021u\256 \247"
+	.ascii	"\003n<\021\217vH\023\246\306S\324\317\222\302\024\250+\234\223"
+	.ascii	"\260\274\2152\243YV\250\322B\206sZQr\210\"^\b\214(.K\tWEt\340"
+	.ascii	"\234\326\262\263\216`G\236\207NM\334\347:\002/aj<\021\317\350"
+	.ascii	"\220\252\252\313-\234\236\276\266\357\256\221\335\245\260[\376"
+	.ascii	"\002T\275s\357dC\217\311x\354Q\2347\177<\313 R\204\f\023'w\213"
+	.ascii	"*\270\251v\377@LJ\325\366\324nP\215\027\350\307\347]\337\335"
+	.ascii	"\263\376\036\335\223\374<;/\376\002l\274:5\336\234o}s\327\372"
+	.ascii	"\342\240\2747(/\016\345\265AykR\336[\312kCyk(o\212\362\242(\357"
+	.ascii	"y\362\232'oy\362\266\311\313\314{\002\013\264\002\200\251\352"
+	.ascii	"\213$\032\325\212\351\365\343]\377\326\257\365\336\375\356\231"
+	.ascii	"\354\221{[\006\016\200\357R\372iU\225\372\002d\302\227\354\271"
+	.ascii	"\366\266\2654\024d\201\301\313K\204\364\346w\201\373\343\006"
+	.ascii	"\350\255\201\372k\032\223\357\264\365\255/\224\322\265\255\315"
+	.ascii	"3\2635\255\3268\262\267\020\223\366\331\265\346\257\025j\247"
+	.ascii	"\321N\273\244\"D\023\324hs\2315-=\273\301\306v\306\204\3208\221"
+	.ascii	"N\263/f\344Rv\267\331e\226\225x\2453\250\3136\221\253U\220\223"
+	.ascii	"{(\327u7zv\\\275\202\234|\325\230\321l\252=\362\031z|\351]\007"
+	.ascii	"\365p;\327\272\036n\3318\275\323C\363K\247\256\331\210\305\030"
+	.ascii	"\326\304h<Mf\214)G\234\334?c\225&F\333]s\267\231\344\232v\257"
+	.ascii	"\023 zr\2308o\356\232\221C\031\271\356\351\367\221/ <\023\016"
+	.ascii	"\t6\226\262,\256\356\036\336\3531\322?\224\350!\225\277$\021"
+	.ascii	"\035\202\210Do\221P\322Q\357GDb\004\357\310gd\344+\342\035\365"
+	.ascii	"\210\214xE?$\236P\317\372D|\370\361\222|\276\037\357"
+	.string	"VT\337S[\376\312\177|\n&\bV*\364\233Y\330\t\244\341\205\0173\305\367\353\314\311\351\035b\352\340\216ZSm\215\013\232\241G\030\357\360\310\247]\202\270@}\372\307_@b\361\016y:\327\027c\234\322\304h/UUU\323\246\372\322\231\353\237>\327\017h1Co\340\304i\237~@<\n\245njp]\3237\3752+\024N\3334\256M%B4:m\223\363\225\274\322\271k\235^^\211\301\232\356\030I\336\2321\025%V\250Q,\245\b3\206\031F\204f\302La3\006`\002\021cX\017\020X\214\266\245\003\375\212a\220\273\257\371]1N}\312\240\364\201P\207\302\020\341\005\262MY\200\236\214\315\343@\026\303#\022\206\234k\347H\275\2146\265\305#hy\200\230z\b\340\001\364\211%\023\330\341-\361)\320)\021>\033pO\360\326\230\037y\365\360\005lm\006\007Z\220(\"\342\207\3613M"
+	.ascii	"\227tk\223\236\225\260\346\240\313G\276i]\261\024P\235+P\245"
+	.ascii	"\002\203;\254\365~\310\323\026u\\\355q\271\252\362\025\340\364"
+	.ascii	"N\nZ\320\211\331a\204\250\210\f\326=V\327l\316\377\013ASU\235"
+	.ascii	"\214\377"
+	.text
+	.section	.gnu.lto_.symbol_nodes.4ce7c3e80c717413,"e",@progbits
+	.string	"(\265/\375 4-\001"
+	.string	"\3500"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\003\177\005\252\333\3426\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\004\177\006"
+	.string	"\002"
+	.ascii	" G\032\3141"
+	.text
+	.section	.gnu.lto_.refs.4ce7c3e80c717413,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.4ce7c3e80c717413,"e",@progbits
+	.string	"(\265/\375`\204\004\275\037"
+	.string	"\226<\322J\240\230Nc\201\230c\214\370\027\242\004~Cs\364G\262\354\341>\222\332\231:S\\\353?\004\222\257\355b\270C\244\355{\270^\246\004\224\020\230\004\307\301/-<\371\303\360\240\242\215#\016o("
+	.string	"Z\013\004\240\216\335\326\335\266L\001\253"
+	.string	"\275"
+	.string	"\274"
+	.ascii	"0FF4\326\221\264/\325\2249\025\205Xb$o{}\\\366\346J\371\376\270"
+	.ascii	"C\277\370\330\267/bT\\\fG\262\346\n(\311\233\351{S\322\356Mi"
+	.ascii	"\337\250\353t\241fi\321\372\341\317\332F\260\256\242\336H\336"
+	.ascii	"\035\227\307ei\356\223qt<;\241\356\364\263\264\230\262\034eX"
+	.ascii	"F\322\tL\337\036\246A]\307\243\351KS\336\342\245)\315^\001\245"
+	.ascii	"y\003\224\266\251\226\200\331V\022c_\035\266\237lS\260\235\300"
+	.ascii	"\366\214m\013/\366\265a\273\313\266\226\355\241m+\333@lO\331"
+	.ascii	"\206\262\355b\233\313\366\254X,\026m\253\266\231lr'\266\364\353"
+	.ascii	"S\337z\242v6x\246>\276N\333\333\025\230\262A\240-\375\372bA\224"
+	.ascii	"R\261\342JI}7\361KB\325\0321e\327\217\375w8t\025\301\237\264"
+	.ascii	"\252c\350\212{\325#\232\350U\241\353e\377\027\370\365\224\326"
+	.ascii	"\373\210)\216\365\307\321\323\360_\316\311\022?\343\022\317\030"
+	.ascii	"I/\032\372\r\234\375\177\377yO\374\177\376wQ\223\330\277E-\025"
+	.ascii	"\376~\377\021\201\337\223N\254\241\177\034:\271\002\246\255\322"
+	.ascii	"\212\303\222j\205'b\317+\374XP5\333\363\351E\377/\025S\bD1e$"
+	.ascii	"o\220+\344\262\346\272V.\325#\366C\231!DS\\#i\036\323\"\256\271"
+	.ascii	"\252\200\314H\354"
+	.string	"\250b\305:\005[#y\271.\225\211$\305\312\221[%#\354e-]$\323\027\353\016\361%\302^\"W\353\036\375$\243y\025\211\262\256\374\350\350f\326%\343\t\024#\276Z6\216\216\263`~\247\37730$J0=\215\344\315\272Sd\n2\244\246\221\274EnT\313\025\243\024\306H\232\354^\315\222(\201\365F\322\030\314\321.\217\252\377O\264\260W{0\276-\367\336\3301wv\021\330&\177(\377\257F\025\363\206\025\2124\222\266k\016\200\375m\251\357\347\3336\250\246-\023\320v\324\326\344\013\256oQ`\255\246\372~\246\354\203\300\364\301\017H[\364|\213\336\366\007\237\336\307\252\265\264\r\002\3236x\006\033v;\007>-9\b3\336q\310\t\335x\273\235\320\r@\016\303\356G\027!\306?@B9].\203\351\234\035\005;< \\\314\323\303\240\207Ai\236\036\034\256g\007gz\0077\343\371\344B"
+	.string	"u(y>8\rL\236\017\017O\007\344\301\3058\334\203\232\n\023$\230?\013x: \241\013\037<\334t\273\240\240\335\317M\007t!\350\366#\324\341\266\340\200\257\330LD\026\261\361\216]&\276b\2766.cM)Z\2227l\274`w\211o\330\375\202\361\2617\214\224\271\327\246%k\t\215*I\337\031\346%\346\254J\256\227/\321\354\235\210\264,?z\257\r\355^\233\361F\025\212\262\222\334\332\272]\346\377\331\377\242\211\320\306(\306\b$\276]2K2\274\002M\250\261\0302\n\031E\004\310\231\211\244$\320\024:p\002\021:\244\016\021\200\036\302\240I\241\\\337"
+	.string	"i\372\375\253&\246\201fy\345\320\203\235#\307P\302\357]\261\254{/"
+	.ascii	"\367\177\305\204A\2513\257\355\377\376o\371!v\266\260y\024\323"
+	.ascii	"E\335\270]\224\340Ul\250\244b\211\333\371\312#m1Q\024k%\263\251"
+	.ascii	"\n$\016\336\256E\330\242\262\202s\340R\240\272\264i\224u\350"
+	.ascii	"\252\306|p\266R\242#WN\231\235\023b\375^4\271\225NY\332+\277"
+	.ascii	"\251\265!\364f\216~\345 \341}i&\277A\023\301v\365\354/Y\017\366"
+	.ascii	"@\357\017"
+	.text
+	.section	.gnu.lto_.symtab.4ce7c3e80c717413,"e",@progbits
+	.string	"uvarintEncode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327"
+	.string	""
+	.string	""
+	.string	"uvarintDecode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.4ce7c3e80c717413,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
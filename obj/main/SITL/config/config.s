@@ -0,0 +1,2598 @@
+	.file	"config.c"
+	.section	.gnu.lto_.profile.61d693627d219c88,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.61d693627d219c88,"e",@progbits
+	.string	"(\265/\375`\017\002=\f"
+	.string	"\024\021\003\003"
+	.string	"!"
+	.string	"\315\265\277\237\016\020\002"
+	.string	"\002\001\002"
+	.string	"\002\002\001\002\003"
+	.string	"\002\004\002\005\002\004\001\240\342\234\212\n\004\007\321\211\300\200\b\350\223\272\372\005\t\240\270\375\251\005\002\002\005\002\002\n\262\374\202\245\005"
+	.string	"\013\301\225\254\244\001X\002\006\005\002\007\b\t\002\n\013\005"
+	.string	"\002\f\r\001\003\002\003\016\273\203\325\342\t\021\257\344\272d\212\016\002"
+	.string	"\002\017\002\020\002\017"
+	.string	"\002\021\022\002\023\002\024\002\025\026\027\002\030\031\002"
+	.string	"\002\032\033\002\034"
+	.string	"\002\035\036\037\013\002\013\035\323\307\351\365\016"
+	.string	"\036\235\357\220\225\013\002\037 \202\312\321\202\003"
+	.string	"!\267\333\375\360\007\"\227\316\342\246\007"
+	.string	"#\312\302\204\263\006"
+	.string	"$\377\354\255\233\013%\236\376\250\313\b&\350\300\306\254\005'\216\345\326\013\004(\365\336\333\371\r\b\002 \001\002!\002!)\334\237\214_*\261\340\353\213\002+\352\263\360\321\b,-\206\214\326\370\016.\314\324\200\240\b/0\240\301\276\347\0171\271\230\252\375\00623\240\342\234\212\n"
+	.string	"4 `\202sD\343\006u\371Bv\277\2235\325\n\202\202\0228l2[\\\003[d\305j\345S\n\366c.H\373\020\"l\035"
+	.ascii	"=\t\f\013:\336\372\341\205\361\005}\036H\033\274\261\227\236"
+	.ascii	"\344\300\226\301U;\310\347\231\215\303\024\363;\256:\b\203\312"
+	.ascii	",\333o\231\340\233\263\205\235g\264\215\312;h#K\270\0069&\307"
+	.ascii	"\310l\320\t\337\334Ts\303tK\273C"
+	.text
+	.section	.gnu.lto_.ipa_sra.61d693627d219c88,"e",@progbits
+	.string	"(\265/\375`\r"
+	.string	"\335\003"
+	.string	"\364\003\001\001"
+	.string	"\025"
+	.string	""
+	.string	"\001\007"
+	.string	"\003\b"
+	.string	"\003\t"
+	.string	"\003\n\013"
+	.string	""
+	.string	""
+	.string	"\001\021"
+	.string	"\001"
+	.string	"\035"
+	.string	"\003\002"
+	.string	"\001\036\001 !\"#"
+	.string	""
+	.string	"$%"
+	.string	"\001&"
+	.string	"\003'\001\001()"
+	.string	"\003*"
+	.string	"\001"
+	.string	"\001,"
+	.string	"\003"
+	.string	"\031"
+	.string	"6\ta\006\266I\226\250`\224\242\231\031\327\324ET}(\213\261\340\006\263d\234e\226\312`+\016 ;\220\f\\\331\007\252\020@\356"
+	.ascii	"O\221\2420\013j\3559E\n0\004"
+	.text
+	.section	.gnu.lto_.inline.61d693627d219c88,"e",@progbits
+	.string	"(\265/\375`\320\004\345\r"
+	.string	"\342\01677@s\322\0010h\366\311\177\241\366\257\206\270\316\003n\272\257\254\360\361J\353S\244P\306\307\355>\232j\0050\0078\216au\353\017\306\310;\230\327\376H\021#v\313$SvPi\210\3702\2144\fC\034\314\366\264\205\205\361zx\202/\032  /D\307\bq\027\233\227\252\323h{{V\240`\333O\276\263\244&\"1\034\002VH@\370\016\272\247|\264\300\314\242MeP\272\314\356v\\\340\335\265\273\231C\236\336\354\256f\220\375\234\320\222\020\217\214Hr:\314\311FJQ9\220\246\177.\326E\256n\253\351+\026\232\226\301\374P\354\256\205M\322"
+	.ascii	"\262\321\337i\264\307\334\347\264\375\271\226\346>s\337m\007"
+	.ascii	"\350\375\356\273\273\230Mz8\223\252\t\335N\211\243rF:D6\201;"
+	.ascii	"+\001^\25016\232HH\013J\n\205\326P\"2UV\036\022\240\0031IDDI"
+	.ascii	"D\004R \"\022P(\001%)X(4\007v`GaD+\26203\025\211\353\301\350"
+	.ascii	"\201\230\354\201UH\275-\fOv4i\232@\226\230j\3052:QD\240S\f\360"
+	.ascii	"f\304o\373\ns\276\025ps\374\372\266\374\346\357\240Y\332\224"
+	.ascii	"\2456\306%\23547L\003\304\372\314{\230\303\320Jb\2417\020\263"
+	.ascii	"y\241\360\214\030\210\taB]F\2730\n\306S\2279)\331\323Gsy\021"
+	.ascii	")\303\207\352\227\255D\327\240=?\276Z\201+]\307\376\255\222\264"
+	.ascii	"\232\035Y\310}\226Z\211J\311\271\301@\275\353`s\211\365\333\261"
+	.ascii	"0\016\241p\214DW\361\260:\200L\300M\t\216\313t?\304\025\250T"
+	.ascii	" \r+\254\360k\006"
+	.text
+	.section	.gnu.lto_.jmpfuncs.61d693627d219c88,"e",@progbits
+	.string	"(\265/\375`\310\004\215\020"
+	.string	"\266\323A> \311&\351"
+	.string	"\314\250\221g\275\252\276\004\273\327\222p)\261\362\306\005< K|\300\030,(\315e~\227\245\252"
+	.string	"\220"
+	.string	"\320\261\200\200Pk\316\2006\360\304<\324\023\216))\177KZk;\311+"
+	.string	"0"
+	.string	"5"
+	.ascii	"\233V\323\377\3046\027\265\0275\274\037\370\314\250\204\351\247"
+	.ascii	"fL\312\340 c\327]\2651\013\333k\275\367\225\365+\273\275\332"
+	.ascii	"F\024C\005*\r\035\336{\357\2726\233\3478N\263fE\347\320\271s"
+	.ascii	"\245!.\340\001\017y\262\264\013\302\357\001\036\300\033g\331"
+	.ascii	"\342\222/\326\3252\264]h\025\332Gx0\204\376\376\264\376i\370"
+	.ascii	"\357,\231A\232\332\321\025\274 M\372i\254y\222(\rgJK\251\b\234"
+	.ascii	"\340\002$RVRe#\227\032\271R\307u6\260Fs\006mC!M\243\005}\366"
+	.ascii	"`Z\237\321b\264\027m\310\242\242\005\355iK\321\231\220\360@\016"
+	.ascii	"\264N\221\374\300\210#\030\261\022\236\220\246\221$\201\270+"
+	.ascii	"\007\337 ~\250q\301cDK\312H\263\034`\002\221b7z\022\240\362<"
+	.ascii	"\215\243\230\223\322\211\220\250\262\263\035\213(\212\310\001"
+	.ascii	"H\306a#\274Q\213\177k(\237D\2541\377\207v\274j\231\017\270<H"
+	.ascii	"q\222\202\255\376\036\370J65\327\346\271\372\212\354\307$5f\006"
+	.ascii	"\302\264\343\256&+\273^VrF\304\t\205\211%\246\370\242ba\\\037"
+	.ascii	"'\177\241dE\331IU\223X\216\360\324S\220\006\032\244\306\006r"
+	.ascii	"79\226X\351\245\003\355\312p\006R\243\346K\2305\225\022\322\376"
+	.ascii	"\265\352\232A\241\236&#0\256\317\202\243(/\356\216'B\322;\325"
+	.ascii	"2\375\323\354\357\351\203A\262=\210C\023\372\342\375\363Q*\225"
+	.ascii	"\364\277\202\254\001\346jQ\034\205\205\032\r\rF\250\263\217p"
+	.ascii	"\217j\031\304w5{\240\235y|\355q\247l\262\214g\351c\232\217\312"
+	.ascii	"h\250\311\354\350v \004O\224\323S$6\300\216\30607\371Y\b\205"
+	.ascii	"\177\352&_\215\360\376[\006"
+	.text
+	.section	.gnu.lto_.pureconst.61d693627d219c88,"e",@progbits
+	.string	"(\265/\375 D\375\001"
+	.string	"B\304\016\031\220U\215\001\377\307\373\034\350\356\356\256\277}\234\347y\376\210W\017M\303]2^\345\2247\031\220<\362 \177\334\361\306\031_\\\361\304\021\227\341*\234\360\006O\360\002\267\303\314"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_.ipa_modref.61d693627d219c88,"e",@progbits
+	.string	"(\265/\375`B\001-\b"
+	.string	"\362\212 &pM+\007\374\377\377\377\377\377\037'\204\337Ndqdqdak\027\b\371,\316\2302\321\264\332Z\267\246\225$Sj\003\303\263\327\363\032D\022\262\205UA\023\034\204\003\237\001T@\360<\007\024p&\353i\355\252g\265\373\330y<;v\034\273\r\215g\306\216zR\016\343y\261\263xV\354\246/"
+	.string	"\222\243\330MH\034\261\223\236\322\214\245\002\361\214(\2231\352\334\303\256y6\273h\007\0351\300\035\002< \240\002\022\272\342\001\243N>\016\022\356\333\n\212!\260Pm\031\267\275\024\306s\251d\013\3526\n\330\031\006\f\007}\211\220\316\360\206\020\235\021^\2149\313\036\023\366*\321\220"
+	.string	"\033\303\305H\210!*\004\314\353e#B\002\022\344M\303\356sf\376\027\212\023.\323\026\311r\3319\352+4H\360I\254\376"
+	.ascii	"\306\214\017\033\017\005\343\031\226\r\306\353 \261;\032\221"
+	.ascii	"\216\253 t\023a\tf\300E\031\002"
+	.text
+	.section	.gnu.lto_.lto.61d693627d219c88,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_pilotConfig_Registry.141.61d693627d219c88,"e",@progbits
+	.string	"(\265/\375 \237\225\004"
+	.string	"\024\bj"
+	.string	""
+	.string	""
+	.string	")"
+	.string	"\005\001\212\001\206\200\200\374\342\203\355\341\027\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\354\006us\250\305\006uq"
+	.string	"\005\001\006'\001\"\005\001\006\035\001'\001\257 ?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/config.c"
+	.string	"\005"
+	.ascii	"\256\222\360Sv\301$\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_pilotConfig.143.61d693627d219c88,"e",@progbits
+	.string	"(\265/\375 (%\001"
+	.string	"\340\030"
+	.string	""
+	.string	""
+	.string	"\004"
+	.string	"\005\001'\002\002\177?\202\210\200\020}{\274\001y\273\001"
+	.string	"\002"
+	.string	""
+	.string	"\002"
+	.ascii	")\243\f\240\b"
+	.text
+	.section	.gnu.lto_systemConfig_Registry.147.61d693627d219c88,"e",@progbits
+	.string	"(\265/\375 \240\225\004"
+	.string	"\024\bk"
+	.string	""
+	.string	""
+	.string	")"
+	.string	"\005\001\212\001\206\200\200\374\342\303\364\221\033\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\365\006us\315\006uq"
+	.string	"\005\001\006'\001\022\005\001\006\035\001'\001\222\340"
+	.string	"?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/config.c"
+	.string	"\005"
+	.ascii	"\257\222\320Sv\301,\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_systemConfig.149.61d693627d219c88,"e",@progbits
+	.string	"(\265/\375 `\275\002"
+	.string	"\244\004M"
+	.string	""
+	.string	""
+	.string	"\007"
+	.string	"\005\001\006\035\001\002\005\001'\002\206\b\177\005\001?\202\210\200\350\001}{\273\001y\273\001w\273\001u\277\001s\273\001q\273\001o\276\001m\275\001k\273\001i\273\001g\274\001e\273\001c\273\001"
+	.string	"\005SITL"
+	.string	"\004"
+	.ascii	"@\204\315\313S\206\036@\021"
+	.text
+	.section	.gnu.lto_getCurrentPidProfileIndex.150.61d693627d219c88,"e",@progbits
+	.string	"(\265/\375 \363\265\006"
+	.string	"b\214.5Pm\222\016$O\n\242\204\252\233\265M?K\333\314\362\302Z\376-yCnh\267\243\r\275s*\2764\nQU\025Q\274\230]@\2101\350a\264\326>\3312\005W\232\207\215\003\307\252\036g\303"
+	.string	"\361\252\253\3634\003[\021\r\327\223\260\254\353e\266\254n\264#\310\034\350\357Td\002 \363B\341\206\324Dq=J]\341\301j\245\256\347R\n]\200)\303\323o t\244\257%\335\350\307\321\tp\230\030\234d\206N+YB\221|\374\237\317\214\220\360\031\353V\n]H\031\030#*\231\333s\035\305\212\330-H-)%\024MdQ\304,d\346\250\2114\272\353_\360\037\374\033\001\t"
+	.ascii	"\252\322\t\314b#\206\024\024\002t\r\377\213\030K\210\034\356"
+	.ascii	"\234\251\235O"
+	.text
+	.section	.gnu.lto_getCurrentControlRateProfileIndex.152.61d693627d219c88,"e",@progbits
+	.string	"(\265/\375 \363\245\006"
+	.string	"b\f.4Pm\222\016\244\034\240*\2472\222\275M?K/\314s\223Z\376\253]\220\033\332\355hC\357\234\212/\215BTUE\024/f\327\222B&r\200\303\332'[\246S\032\207M\003\247\242\036g\263\360\360(\253\3634\004W\020\f\326\213\250*\353a4\254n\264+\300\034\350\357TD\" \323\"\341\206\2644q=:M\341\301f\235\256\347\322\t\235@\t\303\3555\020:\322\327\222n\364\343\350\006HN2)\231\241m%M\246\222\217\377\363\230\017\020>_\3258B\027\222\306\305\210J\246\366\334F\257\342u\013R\013J\307\226\211*\212"
+	.string	"\n\2319f\"\214\356\372\033\374\231?#\t"
+	.ascii	"\252\322\t\314b#\206\024\024\002t\r\377\213\030K\210\034\356"
+	.ascii	"\234\251\235O"
+	.text
+	.section	.gnu.lto_getCurrentMinthrottle.153.61d693627d219c88,"e",@progbits
+	.string	"(\265/\375`\001"
+	.string	"\025\007"
+	.string	"\"\31506@o\222\016\230\022\254nFdF\210@\241b\222\352\243\222\035\207\215\337^\34466{\326\321rZ\340E\r>\206\341Q\341\322\034\tNNIw\036\254\221F\210L\001W\233\b\016D\307\252b\207\343 \021\253\313\0237\007[\023\017W\244\260\254+j\266\254S\276\321\017!{\241\337\323\224\212\200\314\f\206\213\322\315\342\212\024~\361q\325\n\357\347\t\234dn\346\267\220{\036\337)\337\350w\2737\260\342\262\300\222\2711#\223-Pe\344\007\275\346\222\264\0044\346\266\020\016\252D\322(\305dn\221\240\006T\241k\001U\370@\212\325a\267&\235`H/\232\b\243\016\240!3w\232\250\243\277\376\t\277\302\377\021\n"
+	.ascii	"\252\322\t\314\264\312l\034\n{d\260\3105\3746bd!\362pWL\355$"
+	.ascii	"\003"
+	.text
+	.section	.gnu.lto_resetConfig.154.61d693627d219c88,"e",@progbits
+	.string	"(\265/\375 \324\235\005"
+	.string	"\"\312%.`e\323\001\360\331@\272\324"
+	.string	"\214\032\016\020\013]\tE\301\223\227\364\t\276\210\330\202S\301\231n\020D@\2450q\217\244\003x#Z)e\n\257\250\207\345\270f%/\213\001\221\025&\221\224\3413\322\300\344dNLN`+{\013"
+	.string	"\361\302\333y\177\212e\225\373\202H\342\306\332\017j\313\233_\003\315\336\317\205Q\224\370tg\002\306\026\005\241\357\277N\317\376\221\202\235\326\360\303\204\245\356\226\314\321L7\273\252G\t\\\247\351\016\024\335\375\345:\215\236\365\377\341?\342\177%\t"
+	.ascii	"\252\244\233iq\323\031T\341:\327p\262\020\306\313\020\340\322"
+	.ascii	"-\332\371\004"
+	.text
+	.section	.gnu.lto_activateConfig.155.61d693627d219c88,"e",@progbits
+	.string	"(\265/\375`\356\003\375\031"
+	.string	"\346m\240G\260ZM:\342\334\336XBA\214\034@\t\345\276\214\007\t\364\302 ^@\251\257\261\321#\355\375\217ZR\315\254}ec\226w\234\214\202\334\036\372\323\361H)\276\327\253!q\307\372\367,\361\037\002uk\204\354-\245L\001\204"
+	.string	"\204"
+	.string	"\223"
+	.string	"S\362e\363\273\371\334\374%\020\246\201ZP\245\326\030\275\251\3724\231\210\374\337o\223Mz\261H\007\203v\233[\335\357b\231\274\003\030%\265V\027\377\213?\334\271\341\351of\221\210*\210\213\362\363\204M\255U\354\241\245\373M\331L\277{\264\253\232-\266\237\252\306\316\002\265\326\320\346\303\022Fh\243q\313\004;\272\314\b`\233\311\026\324\255\314\036-\003\331|\230\301\b\265\326s\315\026\264\007\367?\212\377\023~\331 \035S}\215\373\356\206Q*\2624[\350\343\307-"
+	.string	"\214\022\231\020Ke\344\036\321E\354\224\021<%F\312.\221x\351\350|;\271\271Wt\036\357\206E2\005\276\242\006\312G\357\370m\003x\2434\206\306n\376\357\354\223QU+\315\301Wi\235\240\370\006\331y\0250\336\032\354\333\271\035\006E\031\345d\334\373\221f\334\270\177e\255\265\276\205\376\346\347L>\316\307oM~8\371,\220\277\232|U\363\301\217\377M~\375S$4\311\227\257Y\312\351\206\214{FG\216$\3540\300?\325I\330\243eM\311\3614\353\330[\375\355\262^z\276AN\241B\005\335\036\340\355fa\226xI\313\245G\356\210j\032\326\311\202\214\"\252\265>\320\262[.`\310\300[\313\360\355l\365&\355\224q\203\0024\264T#\247q\272w\272o\330,M9\275\272\025\177\354\214f\377\034\n\320:v\331\263\367\347\315\356\266[6\203\237\246\331=\354\025+\335!ST\233\026\207\375\177"
+	.string	"\301[{\330\203\026?\341*1\262\020[\234\330\031S\230\300\371\313\2653\232X\001{\211+F\022*\304\027O\217\350\032p\030\013\035\036\261\005\f\306#\206H\262\225\265\205\316R\301r+X"
+	.string	"SNC\346\202\r\033\b\203\232'Y\317\016\201U\315\212Am>\035\373\252Y2\226Gi\240Y\265\253(\007\266\252\031\330\3303\243j\245\326\f\305\221\203\352\340\255Q\035\337N\260!\034Y\323&'\343\036\217&\221\277d\350M\314\216\2418:D\213\344^\352\243@\250\020\246'Z\307\210\344\214,A\300_Y\250q(C\224d\312\330\314\244\321\024$\351\220\002\031\032$\017\020H\311J\232e\r\2773\224\231\242\345\267}RZ#=\\\004\273\242\333?\313\234\301/\321\346?\247.2\351\330\026&h\033\231\023\213\177"
+	.string	"\177\244\330q9_PaC\220T\357\025\2218\327 | #r\244\210N\350')&$\356\r\034\177\225L\024\004\206\005l|\317B\372Y0,F\314D\231\"\373\326\020\265\006\211|\221\037\337\305\037E\327\314{\021\375\277\374\342\313\302\302\260m\217\334E/  S\230\241\242w\205\024|\020\244\017m\025p\306\366+\246\025\316\362M\005"
+	.ascii	"\251:~\034\236X3\022\252(U\003"
+	.text
+	.section	.gnu.lto_validateAndFixConfig.157.61d693627d219c88,"e",@progbits
+	.string	"(\265/\375`\3447\375\307"
+	.ascii	"\2120!DI "
+	.string	"Di\2541\217_(\177\205y\252\340\205\305\205\373i\344PEm\350c3\217fe\021P\252B|1\271\345\006\367w\376\245\347\"<\0307\177\355\273\353\247]\377\235\246\272\225\006\001\256\002!I\321,\216\215y)eJ)\0051\004\342\003D\004e\262\216\246Iz\017\267g]\227\224\334z\022\271\257_)o?IC\253\244\276\357\233\244)yGWeZ\225\211\250\325F\252C\340!\2537iwx\222\373f0\376\255\331\341\357\213\2543\030\311\337\247\230\0069\347XGe\007\035\371\373\006\323\032/\bl\343b\272\312u)2KE\256\216{N\342\322\017\325\326O\035c\024*\220\237f\313&\253\206\221i\203\3258\220i\r\247\375\230\203\230\203\256c\241)\007\354\023}\254\356\335I\2431\305\363\267\247\353-\377\272V\270?%]\307\317\367\246\312-\345\246\343\240f\347\226$`s\373\321AK\371\307\374\322\270"
+	.string	"-\345$\020\326\300\326\nh\266~\3538\016b\323Qg\303\031@\251\312\355\345\332\241\206\007\301O\263Jk\267\365\032g\273!`}\273\334^)\256\232?7\034n\215\3246\373\323Fm\263\234\202\205\263\327\232JTn\257V;\346\004o\255\372\276xL\3152\211\237f\235\314\220\355V\366\372t\311\272\212\253\276\357\353\364]\226\026\031\035\377\377\261m\333\310\243\243#\304\277<\256\343\357\325\255\271\204\220\263\231\312\221\f\311\217L\207\035\271\221\031y\312\213\254\310u\330\016K\362$\317\341DF\344C\226\303\206\\\310\204<\310\202\034\310q\030\220\377\330\217\341p\037\363\361\036\353q\036\343\361\035\277a;v\303uL\307s\334\206\345X\312q\f\307Qf\303o\354V\303"
+	.ascii	"\0323d\304\200\361\302E\013\026+T\244@q\302\251\311D\t&\022#"
+	.ascii	"\226D\024\020\002\304\007\017\035\2248l\320\220\001\303\205$"
+	.ascii	"\013\025( \035\031M\220PD\024aH(\210\t\364\343\323\262\353\273"
+	.ascii	"\223{\f\313\"\026\027U3u\005\222\222\367\226A\3549][<\212Y\323"
+	.ascii	"U;\347H\310+A\347\307\301f:\376\214\343\354\030\330\334x\371"
+	.ascii	"\347\314x8\006\330<%\\O\350y\343\274x\327\254x\327\\\007\260"
+	.ascii	"\331N`\263\344`\363$\035\307\266\350\331\330\026=\031W\236\343"
+	.ascii	"s@\265\231\32200*bc\205\315\211\3537\251~e\020{\272YgL\2669#"
+	.ascii	"\3265\037\3225\313\2413\234s.\\\225\350V"
+	.string	"\245;k\234\t?\3245\017\2625\013\262Q\020{\2569\007\212\215\251i\216\223A\354\231&N\2153\240Z\2351\316\177~i\315p\352\250Y\351\253\243\026\306\231\257\216\032\030\347\275/b\234\365\274@\2269\347\341\2315\337Yy\003\351\205\202\330\023\314\331\016\2040g7k\321\211F,\316uG\207tEcY\232\347\032\277(\264\241 \366\354\372\022{z9\313i5K3\210=\265>p\216\213\322\f\027\005\212s4\253\231M\026\226\363\333JEl\354I\263[\006\261\347\223\325\212\330\323\211\327\270l\003\016\267.-\235Fe\317\330\3432\364x\214<\016\243\362p\213\322_TV\335Ed\267\210d\361\270\202\016\244\253p\354\024\216\215\216\3021\216\321OL\333iZ\350M\253\212&\325\257>\334\232\256By\256\022;\216\320M\f\322y\361\022\202\315\024\330$V\244\300\225\004]\034\037\261\026\001\256'\354|\311\347"
+	.ascii	".R\376Z\304]\027p7\347\215\207\370k\020n\372\303\032\302\315"
+	.ascii	"z\301\003\035]\235w\230k\2459\016k\332\370\206\266\326\320\306"
+	.ascii	"\346\031\326\032\303\032\235\032\277\220\246\223\322\030\252"
+	.ascii	"\271\205\264\256\22068\306)\210i$1q\302\370\021\2306\002\343"
+	.ascii	"\367\305'\270`K0\353\242u\005\035.,AS \025\233\314V\231\023\035"
+	.ascii	"n\231\205y\004\260\036Z5 \022\236\361\360\265\245\256\311l\201"
+	.ascii	"\340B+\t0A*}\270\005\266\"\311\031\243Cf\353\313\203\2624s%A"
+	.ascii	"\315\013\241\311leY\221\264\304`u\\w8\334\302\342@\035\304\244"
+	.ascii	"x\365\017\231\255."
+	.string	"\367\271\362\326J\263k\t\3052X\214\274\334(\006q5\3615\002\227U\020W\225\377\341\226\327\252\364\276o\307\265gq=\335}\016x\337\227\035\213KJs\007\315\314\354\300\314y\314&\024\003\223\224m\027\036:]TL\202C\364\304j!\342!\334\267\241\005\303B\302\nrs\\pR00\216\334\367 \205?*\240\037\034\244\256[t>*\340\236^\327}\3079z\250\233\306\273{\363v.)\277@\310\211\341\031=\2249hi\327\261}[\363&\211H\310.\243\327\271\216Q`t\300\326\272\217\331\210\323\271\217k\322\230\364\231g\355}\3376>\347F\262[\307\225t\367\016\335\267_\177\220r\371\\\254\303\322\343\205\336\003\266\302+K\236\373 .l\302C\331#\270\264\275\310\245\335t\r\004F\317\007D\334K\355\214\317\342\226p\303\373m\227\262ev\365\270\225D(\361(\251\256\by\246\210\255\033\312{"
+	.ascii	"\366%\312X\204EeC\264\326Ao\001l,\332\030e\363lt\216Z\204\003"
+	.ascii	"\234\371\314N*\347S\205\226\252\247j\342k\234WmME\347\023\346"
+	.ascii	"\003\225!\244\\\321h\301\r!\240m\354\037\262<0!g\224\026\350"
+	.ascii	"\205D\031\263\\\2153\312\217\253y\032\247\026\227s\312\224\266"
+	.ascii	"Y\240g\243\204jm,\334\333y\245evz9\263@y\247\203\347\214\222"
+	.ascii	"\032\204\302[\316\3178\315\036\303\241\2310\347\026o,\026zS\370"
+	.ascii	"\323$m\013\263\331\372|\2779\276I\"6y\267\3613\247\231#\351I"
+	.ascii	"\237tk\357\313\244\261\330\305\370\030'\224\2738\315\334\254"
+	.ascii	"u~q\206\361\306\362\371\241\017\006\r\253\236\n\310\202\027\263"
+	.ascii	"\240=\276\352\344O\373~8\306\273<5\334\224\213\023\315E\031\231"
+	.ascii	"C\235e\234g\234h\234h\332f\333o8F\237\207z\225f\325\\\354\211"
+	.ascii	"\303\026\033HZ\330\367A\344Sk+4T\013\002\024\210\351\027\220"
+	.ascii	"\257*\330\332d3\352\361\302"
+	.string	">\224;\203v}o\2142\252q/'[\215.\033,\256\254_\303\254\333,j\332\372P~j\377\247\242\215U\236g\215Sy\342P\366\276U-\230\271i\307\247\330@\232\276o\325\213f\331\271\\J\002+\216\034m\216\266\331\177\037\3047\224BW\f\251\377P\366^j\375\205D\t\253<\017\023]^^2\366R\373)\324\026\255\300\236~\311\375m\365nwe\311\013x\024\250\237\367}[\260g9\024\007\270\301\360\360\306j\226\233G\333l\177\324\327\024\214\255\215\211_2\273=\375\241\314ma\314\233!?\031s\027v`\3575^\337\265]\035]\317\311\265\264\310\271\341zL\203i\263vkn(\r\327\334VD\316F\334\2529\2103i\276\240-\233\201t\236f\013\032O\363\217\n(\230\300G'6K\320\203\351\034\001\2213\017\246\363\016\2463\004D\316\0170\235\035`:7@\344\f\305tf\200\351\274"
+	.string	"\221\263\016\246s\216NlV\200\351\214\203\310\031"
+	.ascii	"H\316\t\264\363\r$g\033H\316\b\264\363S;\327 r6\200\351L\243"
+	.ascii	"\347\232g\264\263\f\"\347\030Lg\030D\316/\332\331\005\221s\013"
+	.ascii	"\2463\213fl^\321\316*\230\316)\332\031E;\237hg\247vnjg\023\375"
+	.ascii	"\330\\\242\235\231\210\234I\264\363\210\2466/\265\263\210v\016"
+	.ascii	"q\344\f\342\310\371"
+	.ascii	"\303\221\263\007#\347\016Lg%#g\016L\347\rF\316\032\230\316\031"
+	.ascii	"\212\23410\235/\0249'1\235-Lp\256\300t\246\300tF\222\340|\304"
+	.ascii	"t6*r\236P"
+	.string	"\344,\241\310\271\250\310\231\210\3109\002\221\263\320\220sP\004g\346\2203PK6\377\264\263\017\323\271e:\263B\316+\323\371\203\234\235\351lw\006\366\325\005\312/\272\275Z\227{^CVo\214[\2653\351\266\354\316\323\215\247[\262\233\332\375\330\315\330\235\330=\327\275\326\355\326\r\327\021\230\333\t\337UX\225\235?\275\374\345\366\314Kz\031>|\274\213\275\225A\367,\340\343\333\354\373+\360\316\n\354i\306udQfb-C\206\316#\332z\3267Xu\306\271U\214\353\270b\312\\b\r\343\332\211X\301\270y:\302L\3510;\245\254_V/-\312&}|\213\217\021\350\367\226_l:p46\020\033\0320\005\\\332+\212\274<Y\223\243\237Z\026\357\\\232uk\227\247\237\367\255\342\302\342\235\314\332\024P\341\345\314\315\273f\2367\226\212\217B\363RR\2378\232{\353\030\224\2062\261!(\234\352$"
+	.string	"R\364\255Z\240~V\2605\254\351\307M\300f`3\260m6\305\373@\371\022\240z\341\204\335@q\205\342)|\331\240\322\203\300\211\254\023oT}z\335\236H\036\340\024\305\351\215\2505\212\250\334\234\354\005\032\320\364B\326'\335\364F\1774\326(\315\334\034t+\215\364\204\260\364\3150\361FL|\220\337z)F\006\323\037)\276/\3233\325\236\251Q\332\304\030\361C\226?#\336\247\212\373^`\024\206\210\377\303\026\361\215\247_\240u\210\027\022m\354-g79MDo\254\020?\264\227gX\345\342\241\315\305\226\2719g\255j.\266X\237MF\247\225I\323\261\200\225J\205\031\310\264I$\2639\270\026 \376"
+	.ascii	"\\\034\037\377\322\262r\017\b\3126\026\177\247?\274\001\270,"
+	.ascii	"F~\036\312*\236\017\037\224\370\250\266B\262\365\360B\232u~\262"
+	.ascii	")\351T\326\274\363\222M<\"\246M\312\267\323\324\303\241\214\372"
+	.ascii	"u\232\225\334\274t\251\250\332f=|P\"\235\016\317\017\371\350"
+	.ascii	"\370t\"(}\207\251\342/FPz\031d\212\034\236?\321\255\342Sv\237"
+	.ascii	"\217\350^\371\221\363\207n\223\226\226]mx\016O\236\360\351\005"
+	.ascii	"\177\320\315\212\342jq\265\315nx\031ds\b\340\032\236?\216[\345"
+	.ascii	"\377\036\320\275\322\374\330z\271Y\224\232<\025gx\ro\302\005"
+	.ascii	"\341\373\236\366\236\317\r\333\342\216\215\265\315fx\030\211"
+	.ascii	"\211\224mI\234\331\355\342\232\271^\245\341\363\251T<\364\316"
+	.ascii	"u\fQ\366\276\357\033\367\313\206\251\335P\325`5\305\033bx!2a"
+	.ascii	"\236\316E\353\301\2629\027M\303i\203\341{\320\f\305\005\351\323"
+	.ascii	"\206\2628\027M\205)\334\205\367\201\033<\361\320\351\233\353"
+	.ascii	"\b\302-(\321/m\222\211_\272\232?<N>\213\355\242\265I?\025\035"
+	.ascii	"\034\363l.\332\317Z\322\373\220\301\241\274\341Jz~x\320\"\233"
+	.ascii	"\036\312k?\265\026\3342\217\346I\303\324=\363\tp\321T(k\226\337"
+	.ascii	"\314\237q\325\324\270llm\263\026\276\343Z\204\231>5\023\017e"
+	.ascii	"/L\035\370\274J\230\361=>\213\315\354\260\2346\253\313\022\017"
+	.ascii	"-\353\036\337\201O#\312\344\256y2P:\310&\335\240\235\021\221"
+	.ascii	"\2759\241%/\216\204\033m+\270o\037\306\215\376\227\007\343\306"
+	.ascii	"\311\271ssm\263\025D\300\275Q\033\361P\3569m\"\216\210.|^A(\360"
+	.ascii	"\022|\026{\232h\343\267\223\245\241R\271\364\320^j%\370.\374"
+	.ascii	"\216\323&\322E8\351.\\\326\026\241dpr\325\311\307\276\305\310"
+	.ascii	"\002\036\312\024\036\351[\254\356\305\240\332o\272\305\265k>"
+	.ascii	"\367\356\265\270y\377\305\030\006F\341\333\217\261M\357\277\240"
+	.ascii	"\232\246\314\356\336gq\373\032 Kc{\212\305\013\351\203\370\344"
+	.ascii	"\324\364:\360\313\335`\b\017s\032\210\215\213\360\203K[\001\020"
+	.ascii	"V\310\354\252P\201\203\253N\252\210;$\374\340\024\022\213\nz"
+	.ascii	"\370i\027\260=\362\373-\027P\007\231\2267Z\377\301\321\257p^"
+	.ascii	"\035\036z\325P\240t\204M\336ea\rIZV'[4J\342Qz(\177\bQF\016\211"
+	.ascii	"\r\325\032\375T4\360\255\240t\204Q\361\232|\225\321\277\245\327"
+	.ascii	"\206\302gb\230\307l\344\251\376%\232\262G\303\204\227\360SQ\302"
+	.ascii	"A\267t\035\277,lm\257r\317\204o>\263B\317\263\246GY\225\360\217"
+	.ascii	"\0070\303C\031;"
+	.string	"\2042\276;\223Ce\356\244Mbx(\027=\321OE\013\355\270\216\037\206X\207Z\364}\307\b\351:\352\b#;|tt:r\332f\211\276\351z\304X|\244\251\b\222(#RS\033\004)\262\004\203)$RSK4\220\032\002\202\2174))BD*I\220!SNC\222\370H\023\221\250\r\234\226\034\311 \n\211\021\013|\244I\211\223TT\005%Q\036`\260Fu\021\"RPSE<\210J\002\204\004\203\250\251\"<\224l\220\001\320\022\251#Jn \221\032\"\265Dj\352\201)\251%RPD\212Lu\220\201\2074e\020eD\003\251!N\032Da\220\304i\310\224\022\247&\f,\265A\221)\247%RRSNAnL\372\311\024\001\r\231\374\223\233\353\373\212\325\350\265\356\270\226@e\343\227\274\301C\031\310\213\006\215\367l\032\".\355\037\237\265\324\376\360\"\265zJ\375\370\306\333\021\325\272\323"
+	.string	"IK\237m\\\302\324A\202\274_%\t\362-\275\214\340\321$\300N\013\326\0313F>\202\367\253.\315\343\215\354x\036n,\0314;-O\316\306\354x\277\342C\"\200\236{\266Q\tS_p\301\373s"
+	.string	"\027|\317\375\206\250\327\035\004\017\346\213\233\251[y1{\361\020\274?\273\315\003\377\302\201\177\200\r\313\005:mB6\346\300\373\323N"
+	.ascii	"G\332\356\331\306)\246"
+	.string	"\006r\031\005\344\333\3567D\273\n\033x-an\316\234\t\030\b$\276\201\357Kv\253\241\236\004\003\017\005\307f\301\342\346\314\251\274\272\030\370\276l\034i^\322#\017e\"/F\372\356\331F\016\230\332\202\317\342\266\200\t\331\031X\360}\367\033\242Z\221V`\013|\025\250\026S*n_\220\034\313)R\032\313N\204_\240\302\234\253D\035\037\341\331\255&s\274\216\367\271se)e\265\240\032\262\254\251\305~\340\366uR\236\\\265\222\215\302B\311\361\255\247q\244u]\252\351\341Ib1\362r\300d\252I\267\222\207:i>\200\312+\271\033D\\\336\223%\017e\366\t\263X\f\231t\267Z1{\305\220In\376\311l\025C&\305ykh\233e!-Xv\275/U\2039\326;B\205\226&n\311\265^B\005\311\221\313\303\354\332Y-\233SX\fr\340\342\006\367\254\225\315*W\232^Y\332fq\374x"
+	.ascii	"|W{\325\353\252|.\312Y\266\024+pcE\320\274\245\315\326\f\373"
+	.ascii	"\301\342\225\262\271\345\304Zu\321\2145\241R\2563J\252\243=\027"
+	.ascii	"\\\031\330\032\2073\177\337\227C\327\313aK\253\253\324\"\274"
+	.ascii	"\237\264\367l\303\326\372R\331\355/\013\003\236\341\215\216\353"
+	.ascii	"\036\201nD&[D\243\220\336{^\201\374|\005\237U\301w\333\372\276"
+	.ascii	"\357;\344\241]\301\367\336\367d\257{\030\013\307\204$\360<\006"
+	.ascii	"\233a\004pF\213``\002?\304\205O-\001\220W\300`p\343\275\r\201"
+	.ascii	"gnv\271\361}\246)'\265\332\004\340\241\274\362\265\rF"
+	.ascii	"\263\365\257\031\246\204\231=~pl<+\275\243l\223\234\206m\005"
+	.ascii	"\t\323\"\360S_\326\275f\230%3U\260\265\306\303\354\322\255z\315"
+	.ascii	"1+R\235\020\232|Y\361\326\274&\0327\3134\317x"
+	.string	"\023\201\357;\035\302\352N\255\355\027\361\332\266\\`\001S\367d\377P\356\265\375`\352\237\317\342\0062\346\253\235\232&[\2048S,x\372)-\356\323\315\267h3\316\033\353\351;\310{)\251U?<\216[M\0055\336\025?M\r(~\200\206U\024\324\351\021\215>z\314\363*\301\322S@\201\001\206\202o\023P\360=\346\373k0\362\235\310\255sP:\304T%\231\235L\3266r\024\274\001\037c\020\217\223\22384\037;\3524\020\233\032\302\036.\355%\242\277+[\022\2445\215obd\273\240\261\352Q\3264>ILd\004i\232\306\347\020\263\030\007G\343\331\276G\0362d\\)\263\003\262G4>\320`\236W\007J\374\004\023\304\355)\004\204`\202o0\337_\202\205V`\3177\327qE\331\332\352\266\306\315\323!\346\214\312\354\304Z\333\330\274\271\257m\226\305t\202\217\3611\004\027W\260\311\035>\300"
+	.string	"d\003\261\251\2655\340\322.!a\315\225\020\034\360\377\0223\326\300S\013\343s\204\271\2146\246\241\201\361l\\\242\032\224\013\027\035\305\312%\003\215=\242QG\233=\2579V|\204\205\250\323\201%\321`\024\203\222)42\"#I\222t\003\030@P@,,U\345\236\363\023@\021(\003\321X\316r\020)\"\321I\322\244\2603\007\315\350\2347\234\225z\252\r\312\265\227\310\373\007e\270\301J\313\216\034\005\273\241\357I\261\037\342\272c0\036\034W:h)\213\244=}D\271$\354\200\205\314\315\371\211%p\003\253\324\2359q\2038Z\352"
+	.string	"C\004w\272Xr\221(\363`z\256O\f;\211\031\340Za\026\037nq\033\335\022\353:\b\276\224\2625"
+	.string	"\330\226\350\212r\231kE\302K\301\006p\2550\213\017\267\344\266D\221\305\257A>\2432y\220Y\235\002\306\222\250\"\373\314\222E\253?\317\312\236\023Y_\0029_\315\206\244\016\204\247\344\254 ,\242\357\3760\330\237f\373v\315\033:i\360\272\373|\227&\362\001R*\247\265Z\322\\V\274\317\214\347S\337\336\327\263\313\266\206\022\030\305~\336<\305\375\005\332t\371\2401\232c\277\030\205\003\236/\306\373\234\016<\024\212\272\303\224\266\231hg\266\347ag\022\322\0240\301#"
+	.ascii	"\334\370\327\tk^\035\372\253\fxAZ\005\315;\232$/R\bD\337D\300"
+	.ascii	"\332%\201\316\364\\t\237\257&|S\032}\253\311>\025_\231\311\227"
+	.ascii	"\261\333v\031\251\031h!\0029\245e\306Snt\2753Wq\327\246?V\211"
+	.ascii	"\337\275AL_\323\201VM\352\264l4@\267\260\226~o\001\262\252h-"
+	.ascii	"\"\211\324\005\356\347\307\316N\240\236J\326\002R\005a\356\217"
+	.ascii	"\367q"
+	.string	"\360\354\236W\365\033\253r\265$y3x\360U\347%\263\327,\264gZ\320\302SG\365/9\\\325\303\260yua\\\t_]\362O\334\203\2310qo\357\335\007\367\351s\013\fs\243t\352\326\354PKM\331\345JI\303U\"\370\221r\320\022g\376\001\300\355\207,\253\311~@\221\365\207\013\f\306_\316\344n\210j\345\235q\026\222\234d\326\316|\003\355?nJ\025V\320\235\225}\217\340\3537\376s\210\303\022R\377\364\331\344\262\024\254\205\353*\234k\370#2\206D\353\246\374?\n\342\241\374\215\263\017|f\245[\231\033\215\325\375 w(\217{\226=P\223\3230U\302f\274q\031\250\366\034\307\364\356\276M\222<Oo\345\256W\034\351\374\2648`9\261|\304\024\004I 6c\035\305\322.~\3679\275\201\227\357\350\024y\336\002\001\245\244I>\343-\374\007\256b(\375 \310]E\224b\001\261\312m"
+	.string	"\204c\252B\220\215\213\250(,\304:m\005\217\365\r\233\350\216\266;>\341\247\363t'\212\235\b\211\346\022\016(\266b\222\207*\265\240\006\271\261\346\360\004\323"
+	.string	"\241\340Z'\213R\217C\240\037"
+	.string	"\244\253\350\373U\321q\236w\274\330y\312C}\327\035\2663\364z\bg\361\022>"
+	.string	"\327d\345\343\273\325\330\201;wB\201(\341\311\330W\324]t\224\346\027\254!\300\241\357B@\256\311\251\021\352Vt\242$lmGu\b\305Y1\350\026\013k\0049\306\020\213\256\034\314]X\227\330\370\367\232\210 _\354\210\f^z=\246\215\002\337[,1+\227\036VK\361*\226\212F\250\214\207\177<W\001\030\347\236\350\031\005Jr"
+	.string	"\253\266\243\376e\f\264\332\221\366\371\350.\245d2:\357\\\252j`H\003\364\275\003\375LR\355\262\316\"!P\237\307\313)\207\315Vx\207\347\001\277\032\356\240\236Cy\215je\030\207\3741L\036\352"
+	.string	"\003U\213[\254\317\1771\331\311\304\357c`\002j\254|\210\214q\311\341\264\237\004%\022`&;\025\347_u\201\017\312]\207cN]r\027"
+	.string	"\222L\375\245\344w\33226\261\2213?H\270w\355\376X!\005{=\321\242\350\347C\253\224b\026\306\366\264\276\337\213'\360a[\t"
+	.string	"\310\203\306\313\226%\021=\020\275\033n\265&A\373\304\310T\006\003\202q*D\007\300{\0250\275\313\3677\003\367\370\\\2300+\331\251$w\025\274\301\202r[\345p\252\377/X\206\t\346\373\361\362E\334\225E>\347\222o\270ZM\327,\023\214C\313UD\330\271\017\242\200\347\031 O\244\344,&\377\037n\237;\365\366\272a\203\361\203\002W\203\035\r\250I\002\213\271\240\263{ss\265?Y\267\365n&\346"
+	.string	"\241\3579\b\354F\377PE\\E\247g\007\006\013>X\251:\2141\203\203\203\343\375\246\013x^\200\300\206k\372S\263\226\346\"\027\264\270q\b\007$\337\237\201\030P>\005y`]`\333\312\255\317\b\224\332q\001\374v5z\312Z\277\310h\304FB\2039y\266\216(\363\007-\366\312\"\246E\217\347L\271\320\300\ni\353\002ED\3118\236L\207k\032,\200\352n\240C\004\021\234JgKr\256JrgGbT\272\371\332\276\003\276\343'\352\034\b\3372\323AT\310\325\352D\342\367l\006\253\341\244\352+\036\303?\301\372\367\334\243V\252\302\2448D@l\364]\006\230\034\206\244\022\327:Or\034\300\321\203]\267\247\214\2473\312\356\260\005\r"
+	.string	"'\324)\341o\371\316\327Z.$\204K\030[\030\033#\360\203\0018\005*L\323~\234B\023\376f\274\226\r\267L\037' x\004\347^t\341\023]\352+X\3175\207\324\273@v\251\260h$@\005\274\373\364\020uR\236]\315\240\227?\313\247\021\234\230\332\004\317.\351\256\335\261\271\335^\252!CL\n\004\3726\"\002\0071$T\271Z\273Fs!8R\262\002n\270\212\3075n\345j\360\035\310\271r\336\342\026\032\024\235\212\377\031\377\217\345#\364\032fi\253<\262q^\367\002\257W\333"
+	.string	"\260a\003L\366\320\360\316aS\341\215,\330R\n3a6\272@\216\t\245\322u\001\363\227\350\200\347\b\256\033\035\025\021\242\353\206\0039B\240\350\313\275\247\036\"\365"
+	.string	"\2203\275\230a\3476\375\"v"
+	.ascii	"f\001\035\346\020\373\211\215< \260H\034Bh\330I\316]\005v\314"
+	.ascii	"\216\250\216w\207@\221(\037S\271G\325\027:\037j\303\327\\"
+	.string	"h\f\366\221\002\2168\203<o\217\344aD\250X\027-0j\330\005\323\311j@\374WK\375\331`]\005\304\221\251\254\305\037(@\036\354Qn4\224\252\361}-\244\243J\223r\257?6,\013\n\235NUR\033}\236\374\243\273\262/\027\372\005\026\357"
+	.string	"|\005\032\3242\224\311\345Z\270"
+	.string	"\357`\272t\257\301,k\273\236\003\215\331\264\001\212\326\372:\223\361\211.U=\f\341\320\277\247\342`\301>\2142\326\276\301\272\206\375e\246\227\311BO\203\264\224\303ox\360\234\342\322 MHN\215U\211 \362\341\\\302b\031\252\232\223@3\024\020\332xG\361\332\246\3628L\267\212\234\305\024\346\037\374s\213\354"
+	.string	"IR\251\0260\333h\255\315\276\354\222(\203\371\324\0067(\210\342\252z?\202\225a\240\0072\355\232\004h\037\234h\232\023\306\315\271)\331\332\255\334\261\3149\001 w#P\r\263\006\377;\031\331<\340\220\223U\341\325\252\341S\336\347,\201\023\260a& B\207S[\033\211E\362j{\367\0048#e\005\237\242\337_cG\257\363\350\031\3045z\256\314x\031\253J\240\007"
+	.ascii	"a\003\304\0326A\323T\301\3240\3622$N\370\b\365\035\246\305\023"
+	.ascii	"0Ejt^\274\214}\032\262vW]{\331\"\210\206p\362\022\304\217\231"
+	.ascii	"\256H\204\0135\\\fd`\021\335\344\306\210\255C\301s\321\300\344"
+	.ascii	"\221\363.5\274\0267\214\342\324\304\240\200C\360\f}\037+,\260"
+	.ascii	"^m\300i\236\257\306m\343\350"
+	.text
+	.section	.gnu.lto_validateAndFixGyroConfig.158.61d693627d219c88,"e",@progbits
+	.string	"(\265/\375`\002\025\375Y"
+	.string	"\232\220\214 L R\332\351\253\006s$\032\032<\253\b\230u=\202\350<\236'\221u\253d\342\252\002=\202\213\037\336a\252^n"
+	.string	" b\314=%J\211\230B$\244Nhn\346\346\350"
+	.string	"\346\002O\n$\242\270\244\274iS\327\204$u\357\235RJ\001\374\001\317\001\356\001}-\bB\007r\017\211nQ\353\302\r\350e\251^0\026K\326\224\364\370\363cr\371[\202\244\004\020\230\217Y\270\371\370\270\327Z\332\336b\205\203E\344\342\374\340[bd\360^8\021\212\275\342x\357\260W\270\261\350\205\240\324\202\273^:\316#pp\036T\341\316\013`\200\266\255\214\240\304\202\273?\214cF\370\330\f\357\225BA\261\331\270}h<>\336\261\235z\241\264\022\264@%0\212\275\266\224\236\3226\025\266\353\373u\235\317\f\032\020\203\367\336\023\2752S\261We\363\260\275\252\275\303\326\345E\331\0026\227\007E\013\230\034\320^\336\2757\256\233\224@\307%0\267\265\016'4\034\037"
+	.ascii	"$\260\335\372\215\331\204f\343\n\262\334 \306v\3575\201\371\004"
+	.ascii	"\346c\257\306#\267\314a\032\216\354\376\240%\201:1\274\3676="
+	.ascii	"\r\335v\n\024'\230L\224 1bI)\t\351HiTD4$\024\004\364\343\323"
+	.ascii	"\303#bG'\007\347\306&\211<\032k\2124\354\252\276\267\3344/j\266"
+	.ascii	"\274\260:\305^\243\330\313\342'\2604\023\026=7q\245K\\\311s\022"
+	.ascii	"v=\302\216I\235/)\321\274"
+	.string	"(\362\025\245\223T&\261,@\272\257\253\007\225\207\313\330\227\026\214\342Hs}4\007\310\203+\351\240\270\321[\027\275\2719Q\221/\272\036bk!6&\036t\326\305\226\227\203\003\251L\203S\310t_W\233\312\363#\311V\343\255\371\217\217\253u\217N\227\231\252T\366u%q\236\277>\352\353\242\253\301E \351\035$e\256s\244s\216\030q\034\262\276!c\002\203\333\210uR\254\356\005G\016\351\343\220(B\334\030\355\232\350\\\037\235u\205y\361\250\310\027X\323\364u\201A\201:\033\244\327\247\\\017W\201\364\333xi\251\312{o7i\347\362r\272\323\274\270\367\262oy}5\253h\346_\301\314=0\347\214\t\320D\036\232\317\021\367\203\226#\276\371\221\247\"\231\033\201\261@\214\030l\2574\277\"L\214\210\031\244wa`\f\013w^\312\354\257\016\370X\021\366Y@\340D`X\037G\030\2305\235\027\206"
+	.ascii	"\252\345\250\3772<\032\246N\340.\004y\034a^\016q\200<\025\221"
+	.ascii	"\335{Y\350*a]\f\013o\276?G\334\026\236\341^]\376.\004\335\270"
+	.ascii	"\002_\301\252x\257\026\001\354)\270\n5\270\221\364z\203\355\265"
+	.ascii	"\277\231\364\322\224:2\26167\033\277\275\225\304\341PG\301\006"
+	.ascii	"\307w\035\262\307\361\206g\271\023y\343;\212\361\245O\354\264"
+	.ascii	"\306\206\231>c\264\361=WD\244y*\323\206\305\247o(\254\020k\r"
+	.ascii	"\302\016\202\255\361-\327\352\231Y\031.\365\245az\360\t\247\207"
+	.ascii	"C\374\336\213\365/e#\"\375\304:}\2168-Z\216\310\334_\032\314"
+	.ascii	"\0237\022\276\340\206\367V\257jc\300\366\352\364\335\244\223"
+	.ascii	"\276\246N\300\036\242Y>e\206s\266z_\312\334\352}\031\230\215"
+	.ascii	"\3168\214\3167\214\3166\214\316OF\347\032Fg\247\2433\215\244"
+	.ascii	"\363\214\034g\031\275\2459\202\326k~\340\350\274\300\321Y\001"
+	.ascii	"\034g\030/\022h\301\242\375\232W\364]s\001\355\245Y)\t)\351|"
+	.ascii	"\224tV&\235\215\222\316EIg\242\243\363\020\322Y\350\350\034\204"
+	.ascii	"t\006J:\377 \235}\216\316=Ig\036\243\263\210\033\347\035\033"
+	.ascii	"g\035\244sN\322\031\347Fu\266I:'\223\316\310\244\363\021\351"
+	.ascii	"l<:\3274\225\346\242\321\231\306\350\314\032\235W\243\263jt~"
+	.ascii	"\243\263\033\235;\003\241'N\277&hf\017\bw\177L\315\\\276\225"
+	.ascii	"\212Y{\351\366\353\336\322\255\327m\245\233J\367]\32307s\007"
+	.ascii	"v/\364\375\034l\361A_\344Wf\005\232\b\364-\264$\275\361\201\276"
+	.ascii	"\001"
+	.string	"\273\3507Vf\247|)\367_7\222'^\230\"\026\317*\021\322'=\327\212O\372\025\013\317\317HEz\026\337\343<R\346y\346\304\3432\366\245\350\207\313\263`\321\373\371\016\022\255r\350V\300\373\374\212\177\272\347Y\317\373<\333\3459\310\363=\337*x^\213V\305\255\264?\274Z\026X`{\345\371\376\353\006\276\242U\326\334\262\272l\207'yD#\250\367\026q\2213\270\303\220\210\367\341)\005\225\266\205\021\201\367\336)\275E(\343E\3708\201&>\360;/\343\373Y\030\301\357<\002N\240\211.\270\235\225\337\221\325\265iNG\027\3017_;0\030\275;t\323\371\007^u\002M\024\300s\236\271\025\322\276\300\366\226\316+\265\036\213\221r\276\261\364\005cG\236<\365\234B/\365\267\306yO\344\241Ek92(m\232\213\300'\355\032\316\267\234\021\267\240\227:\\\333|\027i+m\363NQ\273C0"
+	.ascii	"\274\257t^\033Cq\213\275I;\006\200\307\265i\334J[\032\274\267"
+	.ascii	"\330F\316\007)\207\203=\036\213\271G`\363z\311\353nP\214\255"
+	.ascii	"0\313\247|\327\246F\006\324S|V}n\036\351\271\270[46\371UF\334"
+	.ascii	"\255E3jk\323\210\330\222$\306\334}\021k\373\341\300\325\330\216"
+	.ascii	"\r`\307\301\323\3322\265\206\326\2145c{\275\371\246\342\363R"
+	.ascii	"\273v\372\020\302\347b:\375+>\tY>\365\255k\242\375\fwwO\023\261"
+	.ascii	"\310\377\275\343#\237}\2130\313\2476\270\222\026m)\220\333%n"
+	.ascii	"\326\246\031\221\365\312^\203'i\327Z&m[\333\306\366z\374\016"
+	.ascii	"\022Ff\315\315\370l\327\354Z\367f%\025\360}\346\251\347\364)"
+	.ascii	"\327\274\361\325\275\347 \315\327|\343\265\2151\261'\001\274"
+	.ascii	"C\205\216)\036MW;:\230\372\200\203\037\336\241\302j\307\025\324"
+	.ascii	"\262\211\212\271\\\006-\231TR\fXYIE1\253h\350\230\242A5\265\324"
+	.ascii	"\221ZN]\361`2%\3201\305\343\b\265\201K]A9EY\305 \001ji\274b\356"
+	.ascii	"\260b\340\003f\024\363\212YEc\002\035RU!\fI-\247,\350\200j\352"
+	.ascii	"\003\036K(+$\025s\352*j\252\352\312J\312I\352\nJ\007\217\247"
+	.ascii	"*\346\025s\331\303Q*:\230\342\200\212\031\325D5\005\265l\212"
+	.ascii	"\252\262jR!\304L\036RUMWLfU\323\021.\253\325\3732p3\351\242\334"
+	.ascii	"\030\276\303\301\254w2\214\347\347\372\0246h\0026\005\005\337"
+	.ascii	"z\211\220\316\t8G\250\303\373\330@\245#k\032>\nM \324.\006\364"
+	.ascii	"\312\377|h\023LSLsLs\f\333+\214o\035\332\351\0065\276\275\264"
+	.ascii	"\271 3~\201\177:hb\277i9g|\277\265#\002\t\024kK\021\304c\375"
+	.ascii	"\225\"\304\211!\n1}\324\f\302\023\317\034\275\006B\234\254\271"
+	.ascii	"\305p\346f\231\346a\2110^|\316\307:\201\2704:\274\213N\325\230"
+	.ascii	"Ves\b'S\350B4\3174\247-\026\026\333\253\3625\210&\232x)\020M"
+	.ascii	"\270\0341&\207\250\031\265\022n\024\246E\003c\364UQ!\016I\274"
+	.ascii	"t\311\376\260T\022<\213\2121,L\262%\3067\342\245\334E\237#NP"
+	.ascii	"\313\021\235\356\345\317\273\264=\240\255\017\037l\257E$\274"
+	.ascii	"\252\030\212\265\271-\275\224o\314\220\244@\r\221+XI~ \241h\032"
+	.ascii	"D\337\267\\\342\002\330=g\266\b_<\317\023}\377"
+	.string	"\3205\210~e\323'\031\032\377\242\206S\t\247\031\217\035z\005\236\375Yh"
+	.string	"\335\255Kz)\223\220\263Rw\224@\315\337\2225\250\235\262\305+=\327\211\036\372\026l\007k\301LY\234\237\240\322\017\375N\\Y\031hb\026\322K{\311\266\370\004~\307\257\f\360)\346\364)\323\340\0242G/e\241\263\240\201\261\250\2010\203\031BC#\"\"I\222\024:\301\005\304\030%a\3256\021 \245CL\251\231\031I\n\222=\326.xn\203R1\306"
+	.ascii	"\007\377\025\215\244r\245\253\224\215\206\217\235l\313\333Y\272"
+	.ascii	"\334\0048\035v\242\"a`\267\207P\241B'\336\265\"\330I\372l0b?"
+	.ascii	"\363\n>i\370\206\350@\363>\362\231)\233B\207\276\264[#"
+	.string	"\221/D4\226\353'\304\030\351aw\003\341\240^\314#r!\001o\337\226z0\022\246\217\206\210\3666g}\037x\007AJG\311\213\206\022\234\340P\234\030|f\277\f\323\300C\003\027\245\200V\023\216\032l%\003\230\3043g\227P\314\353\362\220\263\2739\244d\350%\311JF\031\306\216\022\302]w9\237\017\325T\273MA\340G\376\371\021Q\025%'\305y\212\370,:_\001\331\002\305\035:Q\335\t\232o\300\362=\233\363\317?\314-)8\276\n\336\026\230[xl\237\372F\322\355\242\360Wn)\251\231\354\272\267\347g\\\001\325\203M\274\022@p6tZ\223\375\252\303\243-nu\300\224wA\225\212\271S5'\333\242\037\221\n\316%f\371\250\334W\254\225D\312lN\237\303\207\247P\243|.\257\211t\232\354\037`Hc\221\013\320\345x\273\002'\315\335\357\204\003\301\373r\226\217)\035\002\020\337\036|"
+	.ascii	"\234\340\270GQahJ\230\017\003\361\302/\034G\304\036F\326\037"
+	.ascii	"\314\177\313Q\225\273\246\022\320%z!\261\260\030\315I\001H\217"
+	.ascii	"g\022\205<O\003n\3460lH\305\334\251-\217\034U\316\016>>\376\026"
+	.ascii	"\222T\241\230\350\351?\nY\026\3369C\315\2047'\031K\032\375\203"
+	.ascii	"\325\234\275_\t4Q\321%6@j\213\021J\251\365\257cy\035\274\260"
+	.ascii	"\221/@\330\224L]\215\336i~\235\n\364\036j\027A\355\\\244\204"
+	.ascii	"q\007\331\3471\315\360D\r\t\223F\265\277W\033\016\r\302\302B"
+	.ascii	"Va\302\357\372\272\372T\360\326eLb\351\227\352S\301[\227\214"
+	.ascii	"\250\bz\220\324\254\251K\325\337\222\227\355\250]\251\223\327"
+	.ascii	"\275\221+\321\255qA\2360\226\211\204\265XKS\256\3569\211\270"
+	.ascii	"e9\354&c\017\223VCQr\217\202\022\3761w\033\234R\374,\201\304"
+	.ascii	"j\005\241\032Y\325<z\221q/#\002\351\325\r\240S\034\277\353[\355"
+	.ascii	"gQ\016l56\312\311\214\247\203F\304\006~\363\002\332\227\026\307"
+	.ascii	"\214\310\230UC\304\302\214\025D\002q\232\277\327\332?~\257\267"
+	.ascii	"\347\233\216\213\003\276G\352\b|\313'\260yW\307I\t\277}\367\237"
+	.ascii	"\021\t\241$\226\334\271\321\035\237F\214r}{\2259\2778J\346p\020"
+	.ascii	"\334]u\302\234\325\327eZ,v\263z3E\330D\377%\204F\210\002M\001"
+	.ascii	"\212W_\272\344\177\350\234\250\340\214\344f\340\001#\326\016"
+	.ascii	"\254\024P\373\355\352|X\325<F\213\356o\\t\347\306G\257\233\267"
+	.ascii	"\227V\375\240$B\\\033<]\\V\275\355\370\376"
+	.text
+	.section	.gnu.lto_readEEPROM.159.61d693627d219c88,"e",@progbits
+	.string	"(\265/\375`l"
+	.string	"\345\b"
+	.string	"b\31797Po3\006\240\370kWh\021\372\303\221\2658q\270Z\243\t\234\336\334\356\3016\022\"\224\007n$c\373\300`\203\314,\213\341*\202\233\2071\035\300\f\366\262-\245L)\034\327\271\256\017g\371\342@`\017\231v\325\fs\360\324k\343*gcM\242\263\325\tM\333\252\346\332S;Et~<\251\214\026\363\303P\"N<\231i\324\fN#\243%m\356#\017\3229PB\231PiST\310\203\226%\324\006\214\3137=\373zrv\330\247v\212\354\2137\315lR\276\025\222\221\306d\2716L\305\330\2612\201\\\374m\220O\262\346bG\340]\033\002p\204\264\210\b\257|\020\360\312\n\013 w\277\037\241\300(\343\242\344\305\332[\247\307\273\313\316?\351\r\237H\n\fy\227\026\203\265\326\022\fa\334\363\266\013l'\330\317\004\025"
+	.ascii	"\252\244\2231\335@\206\311\317\020\264\003\230\201\"`\034(F\363"
+	.ascii	":@B\251#p\332\372\346\020\256\211SX\0207\004\270(\372C\005\017"
+	.ascii	"w\316\324\316'"
+	.text
+	.section	.gnu.lto_writeUnmodifiedConfigToEEPROM.160.61d693627d219c88,"e",@progbits
+	.string	"(\265/\375`2"
+	.string	"\225\007"
+	.string	"r\r25`m\322\001\020\006\027\253P2\201\t\376\177\354*\334U\325\021`oBX\273\207\326\b\376\216@\206\375\37310\360\002*\020d\007\"D\206\021o\275\255I\2232\245\2564\n\233\204\013V\357\332\034X\257\302:O\023`\270\200\200=\006\b\261\227\211\373\312j\250\240\213\035\311\243\037\373\226\305\3778\210\345o\030r\362\333)\237c9epaRB\361\344\251S\321"
+	.string	"'\034.\323H\323~\200\310oN\221\224\330\221>\252\331QK\305\260_Y\r\331\027h\001\222\340.*\331\005\235L;\242F8l?\343\314>y\324X\200\016\217\210\220\322\356>\315x\366\314\374\213\216\3318\355y!\330]\347\306Q\334z\333\002\266\007l\223\004\020"
+	.ascii	"\252\244\2331\355}\303\234\231V\200\0200\016\024\003\267\201"
+	.ascii	"\0224o\274i\233k\370\\\b\343e\bp\351\026\355|\002"
+	.text
+	.section	.gnu.lto_writeEEPROM.161.61d693627d219c88,"e",@progbits
+	.string	"(\265/\375`\n"
+	.string	"5\007"
+	.string	"\242\21526`m\322\001\300i\200"
+	.string	"b\t\352 \007J\321r\367\177N,O4\247\251O\"\r\365\325@T\306OU\254c"
+	.string	""
+	.string	"B\332\241\bH\325`\375\006l\215l\262eJ\001\2562\r\032\206\215\254\342F\243\340\020+\213\0233\003\226\017\013V\214\220\322\212\230\r\373\264\017t)\2118\354e\276\250\r\301\321O\033\224<\270\354}\254\357P\266\304G:\004\241\335E\360E>\232\3607\016M\341\321\317C\337C\035~\204A\372@\301\264\263\267L_\206\375i\037\310\236\002RH\332C\272]\213ne9h\302a\373\030_\366\311\267\320\n\210J*HTv7>\215_\327\313?\310\001\246\366\271Z\022v\327:\265\213\373\335v\201\355\003\333\035\001\t"
+	.ascii	"\252\244\2331m{Cha\332qat\013\026\277\f\001.\335\242\235O"
+	.text
+	.section	.gnu.lto_resetEEPROM.162.61d693627d219c88,"e",@progbits
+	.string	"(\265/\375`G"
+	.string	"\005\t"
+	.string	"\226\220>:@\305(\035\365\332T=<\274\244cMx<F\316\306\342kN\370n\252\214\267\223\265\206\3703\023\243z\353jD\t\241\023SI\"\036\035\360\"\260\233\204\323\210\006k\204\354\235R."
+	.string	"*"
+	.string	"0"
+	.string	"\013\"\203\257\036\247\202\220\224\013\222\327n\235\262\343\340#\350\237\365\f$\025n\254\230\240F\217\001\r\273\353hBi\334\362\266\021l3\330n\005\253\242\235|\330\276?\362\032\272\2103\251\330kw\267\220\275]\273-\2627\3331~\005\032\274\305\265j\355V\005'\b\\\263\355L!\013\314E\222%W\260\016\021\326\327%\372\365\263\2107\371\365\021(\0310WI\216\354Z\212\222\303~\266Reg4\300\t\003u\026\200\335S\030\013\036h\342\323l\272\207\016\005y\237C\347}\004\3460\022\234\215\207r\323\303\321t&\367\361&\346\300\224\242\373L\020\245\237\351Jz\266R\345\203\227\201\222\r"
+	.ascii	"\251\322\235\314\n\327l\264\301RN\213\301\024u\336\341\232\210"
+	.ascii	"\214\t\022TPN\205\025\236\267a\355\324\003"
+	.text
+	.section	.gnu.lto_ensureEEPROMStructureIsValid.163.61d693627d219c88,"e",@progbits
+	.string	"(\265/\375`:"
+	.string	"\345\007"
+	.string	"\022N46Po\322\0010\345\rw&S:q\370<U\245\003\223\017.\220n\367\221p\027M\255!N3\212\bl\365\b(33D\246\260\272U\323V5G\2465\262\245L)\2766\r\035\006\017vAO'\301\001^\331\007n\b\214=,d\020\002\3032\250\351B\347\204t{\231\264?\021y\316zU\307\352\244\246\300\\\025HVD\251\362K[b\"\317]o\372/N\242H\252eS\220\335m\251\036\366\337j\311~\372\230l\203\204\021\177J\331%\255^\026e\241\204\330\276\306\232\315\362\016d\007F*F&.\273\013\365\343\332\237\246\346\007D\320\037\200\306\365\025\2248R\002q{\006*\250\321MO\213(\312\314pv\327\311\305\214\333\272m\004\333\007\266K\002\020"
+	.ascii	"\252\244\223i\021\206\363\020\266j\240+\354\005\252y\340\245"
+	.ascii	"u\357\267\260\236\013\371^\260\3762\256\270tM5M\003SP"
+	.text
+	.section	.gnu.lto_saveConfigAndNotify.164.61d693627d219c88,"e",@progbits
+	.string	"(\265/\375`X"
+	.string	"M\t"
+	.string	"f\221@< \0057\035 \301\264\024\0033"
+	.string	"H\311a\210o \363\006\225i\373\034,4\352\003\241\300f\033\2657\304\360\f\203\265\353k\b X\004kqY\347L\241y\203\310Z\216\247m\367N)+"
+	.string	"1"
+	.string	"0"
+	.string	"vv\372\314\236=sQ\265\007(!\035,\256\335\2553u\357\322\363\277z\007<}\227\001\020\273k\t\236>\356y\333\n\266\031\354;\364\341\033ld\306\021\026\200\222|\331\242IN\022\373\234\235(\033+H\271\234\336\022\263\353\361\n\260#\2051\261}\277\365\220t\226\007D^\262S\233\024[\305W\217"
+	.string	"\021]5\035\351\207\034\206<\350\005\232\223\3214?\313\213\260\207\016}E\224\240\332\335\007_\274\212\206_r\352\215\221<x\352\217\260\007\326<\024\333\004\210\323*h\223\260\250Z\027\252\036\004s\027\237\256fp\\W3\261t\316N\224\005nZci\232l \035nk\237.e\344\230\237\t\244\035\016"
+	.ascii	"\252\244\2231M@\r\307\331B\323\276Nc\307\246=\256\211\353!rP"
+	.ascii	"\261\235\212|\271\027\\\272E;\237"
+	.text
+	.section	.gnu.lto_setConfigDirty.165.61d693627d219c88,"e",@progbits
+	.string	"(\265/\375 \355u\006"
+	.string	"\362\013-4@o\222\016x\2753\275\343\307\304yw\252&d\352\360\005\372\217n\257#D\361\377\346#\325;\312\256\035\013>\206\307s\216\001\215\303\352\217{\\mb\t\221)O\231\005\215\302&Np\243A`\200\023\345"
+	.string	"3\003\307\206\004\n>\304HAL\226u\242\203\220\006K\312\307E\334r\244\373Q\020\316\305\030\242\323j\365\335\216\324\3676N\260\n\017\225O\033}\346i\316\342{\311\314\334\211\336Q%\240\211\253\"#\231\240QK\232<\222\214\277\230\253Gi\206\245"
+	.string	"\007&\021\262\222\231\320]\264j\253n;\032`]\2366"
+	.string	"\203\314\274Y\027Ew\375\t\376\202?\024\b"
+	.ascii	"\252\244\233\261x\300\031\342\342\013\3572\376e\\p\351\026\355"
+	.ascii	"|\002"
+	.text
+	.section	.gnu.lto_isConfigDirty.166.61d693627d219c88,"e",@progbits
+	.string	"(\265/\375 \350U\006"
+	.string	"\362\013,3PO\222\016\240\234\252F\270A\341\262\302`\217\267\340\215W\215\375\372\\\326\332\25554n\376<\335\231\214\231Yt\032\034\266\033o\332%\33025\264\267L\001K\230\210\f\204f\222\232&\343 \321$\212\242a\f\236&\036\250V1MT\273`Y\f\035\036x\360\363-\251Iu?\266\330\\\255Fw\023\320\350p`\303s\331c\235C\216/@b\350\277\017\tB0\256\242\254d\202\262\226T\211RD\376\376\234\277\254\260\300\271*\346\001*\030\001\2718a\311\304\032v\264\352U\267$m\370\240d\326\325\351\t0d\346g]\032\035\373#\374\t\177F\b"
+	.ascii	"\252\244\223iq\326\031AC(\256\211\rC\220p\227M\355$\003"
+	.text
+	.section	.gnu.lto_changePidProfileFromCellCount.167.61d693627d219c88,"e",@progbits
+	.string	"(\265/\375`\203\004U "
+	.string	"6\274\324I\220XN:A\023\323\033\277\350\303\243\234^N\n\345]\250\367i\t\\\b&\207N\f\237\217J'T;\036\337\315!\3758\352\254\332\326\031@\"\032\342Y"
+	.string	"\242\t\006DO\361\013"
+	.string	"[B\3737\374\266\266f\t!\204H\231d\304"
+	.string	"\254"
+	.string	"\303"
+	.ascii	"\346\3562\3576x`\364-\025\333\265V\241\031\251\025\311`\023\244"
+	.ascii	"7\327h\327\312\2214\252\357\330\203(\304K\255\365\32736\307F"
+	.ascii	"\347\355t9\\\212\236f\331l\264\317\031\217\316\213\361D\365]"
+	.ascii	"\211s\374\242\344kE\252\362\346k\311\306\265\212S\254[+J=yv2"
+	.ascii	".q\316\200\214'\030\307\025\250\265Fqz\244\250\243%\216\232U"
+	.ascii	"\225\236\221X\336T\241"
+	.string	"\271\270V\021\212\317R\302\017\0365zF\246\262\275\300\226\\\253(\305&\320q\fK\214'\030/\313\004Uh.zF\245\222F\315\252\312\273l0f,\353\031\223J\336\016+ZO\336\200V\221\212\031\235Pk]n2>}{\337\335.\273+\264[\002\b{\261\024#\322,\023\347Mn\034\327\277\016fb\237\265AC~\323\315\375\360\274\371~\362\245\226)'G($~\333E&qcM\251m\306\355\253]\037\363\332\324|\353\247\231\2219\362\033s\257o\017\345\345\241\274;\346\325\231\2749\346\3051o\312\274(\363\236'\257\311\274%\363\266\311\313%\357oz=\262\214\037\222Vk\213\2670\365\211i\226\343\310\337\353\274\373E\361 \033aJ\212\356\007\362\344\352\274r\274\034\303\256\324\212\254\220\336\334s\275\313\350\310={}\252_\021\345(v\245\326\252\340\346:Ho\0268\315y\263|\200\363\001\275\353"
+	.ascii	"I\2624\\\2063\327\314\345>|\3448J\033k\177n\353\"{\201\366\325"
+	.ascii	"*\270L\233:\330\272\222h-Fuuv\352\272l\242\\\353\222d\300\251"
+	.ascii	"\261eUm]\310.\320\221h`\002V_I8\266j\255\020\216\334l\003\207"
+	.ascii	"\016\036\316\233\271FP\203\253\327\270F\255\210\244\021\335\032"
+	.ascii	"J\233\227\230\231vM\177\013\203\243\235\266\257\t\223\331\202"
+	.ascii	"\237\2156\272\205\251*\211\337\326\354\363\303\213\200HkU\332"
+	.ascii	"\331\223\275\214g\201A~S\360\274i\366yLE9r\355\2541\311*\033"
+	.ascii	"k\205'\367N\306\315\334\260\302\272\261\266\354\356\020\311)"
+	.ascii	"J\374ei\272\354S\n\321\215\273\373D\267\365\371\2300\255\265"
+	.ascii	"\356\004\373\243#B8\364+\372\361\021\002\365\370\206v'\202\""
+	.ascii	"\204"
+	.string	"*\004\201\204=C\"\f>B\302\037`\021O\220\200\"\241\022C\n@@A n\201:>\302\036\241!\360'$\344\t\372\001\211H\374t\006\354p(H\364+\032\016\211~:$\322' uR\221w\3036\275k\341\002\277i&,K\327\023\245>\332\277}\317\316\231\266i\024*\211\337j\320\226\216\354r2\215C\214*3q=\323N3\007\216\330\300$\323\224\370\313\r]\211\213\351\035XTU\251s\231v\262!Jq\341|\035C\214bQ\326t\257\235z\315\353\263%\251\230\315\353\232$\221%eM\376XD)\026)\256\267De:\246\235v\3739\347\256}\315[\230\314\376\234\263\027P\250a\030\206\220rF!##\321\b\311lsP\0021\nZy\020pg\223\346\313\244 \204L\245Q\\jT\016\227\347\215\231%\267\267:LI\0042\351\273\266V&\240\310\365}U=\217y\360\306\320h\331"
+	.string	"0\307\254D\177l\230\021\240\251\034\3040\363&\b\007\360\201c7\230YA07\020\n\340\313P\260\246E\357Wo\214\200F"
+	.ascii	"j\b\351\223Ln\341\246\027\377\317B\200\002\340\250%\220J\307"
+	.ascii	"\307\tcH\007\262@B\334\234\363y\025#DQ\222?\306\013E\004\f7\210"
+	.ascii	"\251e7\230\350\200\322\271\210\r\214\260\205\372\033\220\210"
+	.ascii	"?\334J\323\232\370H\365\376"
+	.text
+	.section	.gnu.lto_changePidProfile.168.61d693627d219c88,"e",@progbits
+	.string	"(\265/\375`\320\001\235\021"
+	.string	"\346\337sH\320\362&\035\242\b\243x\221\276A\262\253\261\360\220\201\021\362\031>\005\226r\257\222`\313P\017\350\346\001\003n\032}o\261\036\371\017M%\2611\324I\330\002LX\245\217\236\241wX\b\031\221\3650\332\336-\2306\262\245L)Z"
+	.string	"["
+	.string	"b"
+	.ascii	"\216\261Q\357\216\262\255j\2278\200\035H\306;g\216\320m\316\221"
+	.ascii	"\304# \357\f\263q|\244M\221\037\0334-v\3149\275\3559\354r\025"
+	.ascii	"\346?\350\001\304"
+	.string	"Y\354\362\346+G\222b,\205\314d\222@\r\n\361AW\021\263P\025\200\2049\247U\234\331\334\335mO\260\235\301\326\006\001.\247w\277\3410\375\340\314h\356\264\246\244\333.\217^\346$wc8\025\265\0312m\262\307P\227\307\276\234\273c\237\324)U\243\016\364KUk\247~\310\036\365\220\375\334X\3348kr>&R'#\205\355\373B\257\305\234\205#\334\324\310\001\232s~\374\220\r\363\025.\301a\202q6\207\016z\321\017\372G\024\235 \301#I\2661\247\326?\372\355\345\373\330\303j5\364\005J\266\020g\244\364\332m/i\243\211)\207\301\2224 \030\375E\013\345\373N\357R\373\332\273\022:D5=F&P\373\2413\260\261\205\270\242\037r\355\017w!\223\2006\347|\340\023\275h\305\367yg\320E/\006NQ\231|-\336K\n\312\247r\"\002\242e\302B\241\245\362\235\200\256\013&_\213"
+	.ascii	"\263T(\337\t\013\310\362X\276\325\212\307r\275<\025\002\203-"
+	.ascii	"-\227\367\002\202.\0175\316\\\316\3351H\216\034\322\314\206>"
+	.ascii	"\240\272v\005\013\n\276\272$4?\276\006t\216\230B\344\204\232"
+	.ascii	"\223\030\226\n\250\255a\303K\007R\2701\017\320\324\006) `\202"
+	.ascii	"Af\346\001\336\rSO'\232\366\255\341\314\326\303\356\n\263\003"
+	.ascii	"50\022\341\260\034\0223\032;\n\262\313\255\253\330\205\204=\213"
+	.ascii	".\333i\231\272\013\237W\030\027\t\343\215\362\252M\232\036N\344"
+	.ascii	"\361I\217\027\266\005\003c\305m{\200\321\302\240\3146\332\342"
+	.ascii	"\332]rTyN\326\334\2048S\n\b\005"
+	.text
+	.section	.gnu.lto_isSystemConfigured.169.61d693627d219c88,"e",@progbits
+	.string	"(\265/\375`\n"
+	.string	"=\007"
+	.string	"\262\r25`m\322\001H\001\270Ld\017\200\201\221\206\212$WJ P\332c\270\302\200|t\354\320\b\376OU\254cl"
+	.string	"\b\351\177*\002;#\"\334B7\262\211\224)\005\256.\020\230\207L\254`\006\323\020\001+\353\202\227\001G\t\007\013R\304hAK\227}Z\365\250\026d\2529\177QW\325\227\302\021i\236\270\310\005\260\213\241\340\207<T\341\203\374\331B\223\337\376|\r\365w%\370\beY\262;-\225\303\376\264\352\261\235\326L\177\n ip\037\221\354vJ(k\362D\037\333\033\333b\204\204\215\261w\036\035\001P\006g\344d\267\203\332q\354\211\371\007\235\2014*\331\270\213geaw\235\033\267q\353m\033\330>\260\375\t\n"
+	.ascii	"\252\244\2231={\303\024\306\330\241\262\30551e\004YB\344p\347"
+	.ascii	"L\355|\002"
+	.text
+	.section	.gnu.lto_setRebootRequired.170.61d693627d219c88,"e",@progbits
+	.string	"(\265/\375`\007"
+	.string	"\035\007"
+	.string	"r\31515@o\323\001xq\312#\311\362$\204\302`\0205\3630Q\320S=4p\264&l'\233\366\360\300\203];F/\303\360\030\347 v \351\226\371\346\255\033\3312\245\2654\t\033\004\316eE\316\306@!ZX'j\004z-\034`\221\341\272\260\230\351\356\351p\204Q\351\360@0\242\227\364\177w\252\266\341!\2755G6(XP$\240V\333S\325\037\006\361\324\032\205\370\2447S\365\2472E\205\230x\026\036)\240\374\332NKx\321z:\034\265\223\003\207(\304\271\344\373E_\313=\212\204\324\326\231f\355\211\273\214\007\224B\023\"+\377#\304p\346\314j\227\f\260q\232\363R\360\277\271q\025.t\333\201\266\004mI\001\t"
+	.ascii	"\252\244\233i:\307\220A\274v\\\030\347\202\305/C\200K\267h\347"
+	.ascii	"\023"
+	.text
+	.section	.gnu.lto_getRebootRequired.171.61d693627d219c88,"e",@progbits
+	.string	"(\265/\375 \350]\006"
+	.string	"\262\313+3Pm\222\016\244DX\242\255\330\334RU\203\322\020\204Q\301j\264[)\254\331\277\333\341\265\202\251\370\322(DUY\020\261\362vA\210\005\203\243\306-\356-SO\227\b\fD\206\232Z\006\343 \321\246\212\242]\f\246&\036\252VAQU\263dY\004\035\036t\320\363\r\251\210u?\266\320\\\257JW\023P\351p@\243s\243\3178\207\034_\200D\320\177\037\022\230\234`\025\241d~F+Y\"\221\200\374\233\267\254\260\260\331j\346\361)\bm\\\214\250df\r;j\365\254\333P\033<\242\224\013\343\364\004\0302\363\273\260\214\216\375\021\376\204\037#\t"
+	.ascii	"\252\244\223iq\326\031AC(\256\211\205\021y\t\221\303\2353\265"
+	.ascii	"\363\t"
+	.text
+	.section	.gnu.lto_CSWTCH.80.274.61d693627d219c88,"e",@progbits
+	.string	"(\265/\375 |\235\002"
+	.string	"\364\003o"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\202\200\200\204\346\377\377?"
+	.string	""
+	.string	"\200\340\305\333\321\001\317"
+	.string	"\005\001\006\035\001\002\354\233\211\203\001\360\240\242\304\210"
+	.string	"?\202\210\200\030\177\300\001\277\001\276\001\275\001\274\001\273\001"
+	.string	"\b"
+	.string	"\200\020\330\0072\003\304\001#\b\225\037\260j"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_ensureEEPROMStructureIsValid.part.0.333.61d693627d219c88,"e",@progbits
+	.string	"(\265/\375`}"
+	.string	"\375\b"
+	.string	"2\21777@s\322\0018\026\237+%\257\206\373!A"
+	.string	"\375\005\237\n\253\313ecd\222\371\004\375\033\322\275y6\210\251D?*?\227r\\\307\200\036-u\n\370\264\241\311\226;\245\3160\210\316\203G\313\246\247\323\0201\263\215bb\b\326$\034\266Y\241i\333\274l\307\313U\2249\030:RM\331\337\304\367\205\320[\001D\037\264\270\210'\371\340\031`L65#\025EMY\345\345*\312\226RU*8\355\226\302\233\375\260^F|\225\203\240\257X\273\030\231\323\311\356\336\373\367y\212\007<ZJv\367\003\272\217\022\262\257\353\326Ml\207L\346l\232{\"{\240\322\310`Y\355\356\274\245!\347\256Qr~$u\242\353\277K\222\216\020d\306\245\333x4\270\f\340\354\256\0058n\353\266\025l'\330'\b\032"
+	.string	"U\345\003Y\206qM{\3654\020\030L\241\3636@\024\fs\205\343\262\270Z\304[\204\370-\201H5\276r\331\316\0243\033/J\206\316P6\363vZ"
+	.ascii	"\256=\245\260\260\331\324\023\312\030"
+	.text
+	.section	.gnu.lto_.symbol_nodes.61d693627d219c88,"e",@progbits
+	.string	"(\265/\375`G\n\215\036"
+	.string	"\2060\255Ep\236J:@Su\360\217XI\b;\251r\bE\007DC4\037\224\027hLN\231\312?\347F\033\020\036\203\352\341\333\034\034;\270\030(Y\233V'9D\351\f\270\313\372\257Bt\017@p_\020oC\222$\003\232"
+	.string	"\226"
+	.string	"\233"
+	.ascii	"?b\325W\253\352\033!Y\364\213P\365\317\251>\021\251~\332\212"
+	.ascii	">\032i\026\213\365ME\223s$G\035\314\007\325\037\362\324\027B"
+	.ascii	"\246\270\235\323\353\232.\206\350s\f\036\206\351`\226\376\245"
+	.ascii	"\350^P\234\212\322\341\222~,\320$\316\315\211>\020\244K1\361"
+	.ascii	"(f\t\322\006\211\257\2158\024\237\210~\220\020\3753\020\375\036"
+	.ascii	"\037\372<\310\242\t\347\241\257\203\354p5\303\323q\270\330\206"
+	.ascii	"O\t"
+	.string	"\"~\311\253\227\206\227\371v\327\307,\026\315\267\335\336\245+{\217i\232f\206\276\017rw\201\030\002w;\353\277\365\350W\341\321\267\262\243\177EG\037K\216~\034\216\276\334\215>j\243\257\305\254\277\245\254\337\305\330\347R\243\237\205\254\337\204F\337\311\214>\223\261\376\030\261\376]X\377\tX\037OF?\357\253O\246\366\313\304\350\233)\366\317x\365\321\3344\315]\004{7\373i\336\237\321\3651\030'{q#\327\315|\273ZUWVON[\277\341\333M\272JZ\272b\262b\252Br\242\"\332\327/\255\347\360\271\350+\311z\230\017\253\237\244E\037\311\3061\345\230]u{k\350\267\016\331\021\253\236\274K#\207Zq)y\252J\235Q^J\206\322\003\226\334\204\276\347\316\023:?\351I8s\246\254\226\262\315\210\356\227\222\177(\2302\300\227\033\332\206)\031@\272s%O\245@>\220~\200qml\263"
+	.ascii	"\331\300\371\305\263\342\246\266q@\036Z\3701\320\331`\371\247"
+	.ascii	"\026-\003S\007\313@\364\3012\360\204\260\f\254F\313?4\302\362"
+	.ascii	"\357\224\260\374\253\023\226}(,?\255\260L\244\257\227\326w\203"
+	.ascii	"\326\1773\244\337FH\237M\220\376\032 }\266\037\3756\037\035["
+	.ascii	"f\001\003\025O@\315\227\035Q\001\373\244D\366\251yD~\272d\210"
+	.ascii	"W\313S\247\316\210\2107d\245\340p\310J\177\036\264\275c\320\320"
+	.ascii	"\335\220\220P\202 \276 \f\342W\341\030!\037\331\tYH\310G\351"
+	.ascii	"\202\374\264 \277X\006yIL\220\217\352\202<|\217i\027\344\353"
+	.ascii	"\3258\364\304RS\364\274RS\364\244RS\270\267\241?\333\234\035"
+	.ascii	"K\330\322/\036;\306\343\242%?\312)\227nA\241\\I\275\221\263\321"
+	.ascii	".%w\241]5\345:\271\352\026\272u"
+	.string	"f\245Y\350\005\234\345\355\261\344\254\372a\200\266\250A$F\325\224$I%\323\030 \003\241\331\246\003\021\200,\351\bS(\220H\002\021\251\244\007\007[#\227,\334\177\204:T5\363\327F8)\303n\260\033L\030\347\343=,\013\360D\211\343L\f\350\3724nF\022\261\361F\374\314\025\2771\236-\343|\023W\350?w`\273u\352P\236r\327\275\036@\221\273\361\177}\3069$w\266\231\342\340\216\241LM5ecO4#t\b\203\374{>\331;p\370g\016p3\231\361:a\234\314M\261\025S[H\332\247\214s\247\007\326t4\032\215\306\243\321\300\346J\2674\376\363\212\022$-H*HJ\220\264 \251 )A\322\202\244\202\244\004\351*@\002C\351\234\221\0338\213\260\323\372j\215\267\201\220\213'\232\256\272\352\340\347\022\"\023\241\246\370\3310\200\031hY)\337s[\333\225\321\364\032}\344A\205"
+	.ascii	"\341h\036\242A\013B\r\206\003\235{<\206\340\253\004\214\004S"
+	.ascii	"\301\202Z\013\261\254@\245\304MPc/\306\333\257\345\253"
+	.text
+	.section	.gnu.lto_.refs.61d693627d219c88,"e",@progbits
+	.string	"(\265/\375`\243\001\335\r"
+	.string	"V\242]? oT\350\001$\222n\330\217\306\204Q\3125\257\224\017\375\002\024` \003\340H4\262\006\020\004\020\004\020\244\267\007\273\265\330\302\2616\016\320\013\336\262\375o?\n*z6\333h{\322\b\331[\246C"
+	.string	"M"
+	.string	"M"
+	.string	"\235\224?\312\027e\007\345\177\362=\3317\362\267\374NvN\276\226]\223\237\3313\371\230\354Y\276%\373\225\217\331\233g\244\356\215\2714\353#\313\207,\377\301\356\355z\355\352\033\274\263\177\351_\367\355g\376,\004"
+	.string	"\260\227\360A\236\337<\257\301qk\034\367\246\323s\3433\333c:=\333\036\333\276\2355f\275\213\253\337\002\357[,T\254\264\257\322\377\004\212\tN\377\204\363\233h\375\r\367\016\264gp\235\344\376\300\375\352n\325=j\363\247{\223\346K\0310D\177\013\353\257H\201\002\373URPB\367%B\377\t\350\236\004\350\037\021\002\304\207\353w`\335\317\001\373%\237o\200}\001\276\002|\022\354\t\360\021`\037\301_a\027\301W\341\207`O\341\243\360A\260\177\340{`?\341\007\300\336\201\037\0278\0037r+\f9\221\353\251\360\246&\320\233*j\220\256\301\317\372\275\036\200cW\277\360\276\366\003\257i\217^S\005\234z\333\216\216\231Z\352}\321ZI1\021\341\201\324\313*!}5\334\335\f\030.\214\276\025(L\220 \372F\200\200\275\017b\210\372\001\037"
+	.ascii	"\272*\312\224\003\300\004\330\001c\300\244\305\256L+\300\034"
+	.ascii	"\030C1\bL\200\335\026+(V\264\330\002\273(V\300\356\026c\231v"
+	.ascii	"(\306Z\fvP\f\001\023`\027\230\003c\221\026C)\335\240\255j\017"
+	.text
+	.section	.gnu.lto_.decls.61d693627d219c88,"e",@progbits
+	.string	"(\265/\375`\244\273u\361\002\036\236Do\020V Ja:\215\001J;\376\031\031H\337\034\366f~-/\032#c\0179I\366\300\223c\033\377\240\353\251\017\272\336\3122\250G\273f\212\314)\254mM\333\026\303u]\213:I\026\331q9\317\361\034\207\361\006\006\004\004\b"
+	.ascii	"`hs\356\f\021\021!r\357-\267\334)\301\016\271\020\373\020\207"
+	.ascii	"@\210jC\316\311c-\353C@\265\217:U)5\352J\016\255\254\254\377"
+	.ascii	"\333\241N5J=\303\205\244,\353C\320\264U\250\273}\017m\266\352"
+	.ascii	"\301\313^\241P\237u\311C\317\313\224,L\262\276\207\346Vch:\352"
+	.ascii	"\021\332F\246\307\224y\2521\324$\235F\330t\004\267v\247\244\312"
+	.ascii	"@\235j\f\025\311C\2127\346c\315\252\357\001\311\276\007\035["
+	.ascii	"5\362\tib\262\226\365=\320\330\332\216\256s\2630n\354h<85\326"
+	.ascii	"wP\247\266\243\363\216~\3519\327\3158NZg\260\251\252\263\352"
+	.ascii	"{X\332\357p\267\337an\277\203\333Fc\364g}\007/{\275B}\326wh\356"
+	.ascii	"w`\262Y(\324g\325sA\256355Y\277C\217}\324\251\341<\347\330\320"
+	.ascii	"\265\311]?\037\007\214?\004\265\240\254a\223\265f\243\343\376"
+	.ascii	"\367\32281\2655Y\377:\356\315\217(-9Y\273I\347\034!\335e\375"
+	.ascii	"\016Q\373?\352\324p\272M3\216c.\262&\251\254\337!i\337\356[\376"
+	.ascii	"\367\266\222\264\031N\262>\207\347\3361\352\263\276\375\200\364"
+	.ascii	" \002&\353s`\333_\360H\200\231\003\202\227<\022a\356\230\371"
+	.ascii	"\215\213\235.u\230ac4\2320\251'\216\263\226\2309\355L\243\t{"
+	.ascii	"q|t\347\327d4\233n\323e\364\031\215F\253i7m\006u\3525-\346:\213"
+	.ascii	"\326r\215~\3515\235\246\321\204I\315\330h\225\303\262#u\027\307"
+	.ascii	"\261\236B\003%k\203>\207\257}\016E\3669h\355s\b\262\317\001k"
+	.ascii	"\237\203\217}\016V\373\034r\354s\240\332\032\355\327f\331\312"
+	.ascii	"\315r.\003\247\307]\326\347`c\003Q\237\365\034\224\366\352\006"
+	.ascii	"\365Y7T\234\375\007\334\354?@f\357\007\302\266\016\313\332\251"
+	.ascii	"\305\256\303t\225\227\020\341\300$\035\246\343\370\bE-\020\242"
+	.ascii	"\250\005\352\227#G\316U\377\201\257\375\007\210h0vN\r4f\262\376"
+	.ascii	"\003Q[K\321SP\247\376\272\256r\025\207\305q3\230\036Q\261\231"
+	.ascii	"e}\024\304\312s\347\316\235;(\210\365\017 \355\377\304\331\377"
+	.ascii	"q\263\377sf\377\007m\367\256\233h%nspQ\262\246\223\3121RC+\005"
+	.ascii	"\311{F\275aj.\215D\007\321:t\016\rD\377\320B4S\037\321W\232\207"
+	.ascii	"\316\322I4\021]D3\321;\364\226\356\241\215h,\275D[\351!\332\207"
+	.ascii	"\326B\235Z\211\246\272\306\241\253\320\257\364\316X\016\265\245"
+	.ascii	"\364n\313.F\363\252\230Ow\3178n\322\250CB7\211\321a\233q\243"
+	.ascii	"\f\323F\033\364+\2653\266C\313\034\2552yc<\320/-\243\306\023"
+	.ascii	"*\256\216\325\323h\314ij\215\235\323\034\364\353H+\311`\322R"
+	.ascii	"pO\022\232\t\357\251\225\244t\206\370x\322\321JR\274##\022\350"
+	.ascii	"\316\300\255\335%\231\3015\207\004\235\317\320\2375\004\352\263"
+	.ascii	"\376\207\310\376\317\322\376\2068\373\033\326\354oX\333\337\220"
+	.ascii	"e\177C\224\375\rB\36674\355\373\334\355\373\224\331\3671\333"
+	.ascii	"\367\241\262\357\223d\337\307j\337\207\306\326H:\tuz\3201\346"
+	.ascii	"\264\220\242\262\276\317\321\346@\034\243\036V\364\316\035\324"
+	.ascii	"\303z\rr\373\032\300\354kp\356kH\262\257\241\307\276\006\245"
+	.ascii	"\375\ft\3663\260\331\317\360e?\203\330~\006$\373\031\256\366"
+	.ascii	"\237\306\311[q\304\300\303b\247\301N\352\202EJ\035\235f\003c"
+	.ascii	"\263\225\347R8\2503\245K\237O\225P\265\260\224.\215#{\246t\251"
+	.ascii	"\\\254e\314mqu\001\357,\2212\266\352\367\310\355\367|\331\357"
+	.ascii	"\211\262\377\364\215\233T\314+\357+\353?u\223\302e-\034J>\262"
+	.ascii	"n\243\322\271\t\271\313\372=H\366\3333\307\223Nj\344&\367\226"
+	.ascii	"\341\336z\320I\217\334\342\266\216\330\341r\362f+I\336\023\307"
+	.ascii	"\232-%s\270\232\304\301\271\243\361\244c'\213\016\235|g\016S"
+	.ascii	"J\033\037\317%w\\U\312\274\261\321z\212\2611\271\234d\302\262"
+	.ascii	"\274\251\245\221\361J\261R\261tI\372\226FI\335R\260\324L\252"
+	.ascii	"\226rI\333R4i\223\224IJ$\275\222\216I\301\244aRf\232\226nI\265"
+	.ascii	"\322\037)\222\324I\212%\265\222*I\205\244di\225\224J\332L\315"
+	.ascii	"R\036\351X\372%}\222fI\267R\256\324+M\222\242\245=\322\"\251"
+	.ascii	"\230t-U\223\206\245@\322\254\264+e\223\036I\245\244g\2513\r\222"
+	.ascii	"vI\313\244S\322!)\224TKJ&eK\313\3225i\232\364+5\222^\245gR\037"
+	.ascii	"\2503\365\222\346x\252#\335\361,\247\006\2237\271\2614E\354\352"
+	.ascii	"\234\236vjS\354\264\214a\322\251\343\206\247\326\326%\206\213"
+	.ascii	"\226'\235\370\216kJ\246\022c\315\363\n\230+lQ\302r\227\267,["
+	.ascii	"E\324,\275\271\341a\327\364\fC\306L\023\003\306\314X\306|1\361"
+	.ascii	"\236$\274\2441\322\251\264y\206\002\222\233'\23493\340\320=m"
+	.ascii	"!q;\302\244\223\227U\347MNG\031(ah[\270R/\271+{\245M\346\tbp"
+	.ascii	"9\355\f\022\256(m\266\214\334\311a^\260<\303R/\231,\227\t\215"
+	.ascii	"z\3428\310\0323\216\343\264\214\346\315\210\226338sU\351\r\244"
+	.ascii	"6\331\312\237\337\326\020y\246\231I\222\271\244\260\t\333\"&"
+	.ascii	"\323\301\263\223\303\362\227\030e\031N\034\246\247\2307V\314"
+	.ascii	"\374\226\343\336vd\"\177\336\362\222Z\251\231\301\f3\013\022"
+	.ascii	"\206\n\315\023\036\365\304IHl\274\244Ue\236\371\315KV\023d\353"
+	.ascii	"\231\323\274\34451)\3178n\366\246\250\234\265\241:\364{\252\366"
+	.ascii	">C\177V\224\006\352\263\276\247\306>O\336>\017\334>\317\332>"
+	.ascii	"\317\225\375\2472\236N\375)R\232\224\332@\2578\364\246\304p\331"
+	.ascii	"\222\265Tj\207\306\226)Y\237\247\312\376\237>\245N)T\332\204"
+	.ascii	":\323\250\264\206\b3P\261\264\311d\307\262\212<\323\250\224\t"
+	.ascii	"\315K\233g[\206\363\310s\t\025\023\032\365\304HnF\322\250\224"
+	.ascii	"Fl\004'\204&?\360\226\334\305q\263C\210\020!B\250D\252\346\334"
+	.ascii	"|\372<C\366y\256\366yz\354\363X\355\363\350\330\251\022\211\247"
+	.ascii	"24\2208OK\262\326T\033}\242?\353\004\250\317z\236\244}\241\233"
+	.ascii	"}a\333\276\020m_\330\334\0272\367\205V\373B\244]\001\352\263"
+	.ascii	">H\267\037\\\333\017\216\355\007\233\354\007\205\354\007o\354"
+	.ascii	"\007\223\366\201p\373\003\324g=\260m\037\350e\037\b\266\017,"
+	.ascii	"\262\017\304\261\0174\332\377\301\331\377\245\331\377y\331\377"
+	.ascii	"\211\355\377\234\3547Q\237\365\277\253\375_\324\376/\336\367"
+	.ascii	"\275\331\367\231\331\367\221\355\373\230\373\276\036\373\276"
+	.ascii	"\244\375\036\335~\317\314~\357\312~\317\311~/k\377\f\365Y\337"
+	.ascii	"s\332\337s\366\267\232\375]\266\277\227\354\357\253\375m\264"
+	.ascii	"\317\306\355\263b\366Y\261\3750W\236\313\376<\206\262\241b\313"
+	.ascii	"$9\254d\215\312!\361|\345,M)/\353\263`;E}\326\267\241?\353Y\256"
+	.ascii	"\3756\324g=+d\237\265\261\363W\006C\235\035r\223\007=\203\344"
+	.ascii	"d\225\365Y\246\335\201\030\355\260\376\016\332a\375Z\267\277"
+	.ascii	"\252\355\257\\\366\237\241<{\375\371I&\002\334\272a\243L\326"
+	.ascii	"h\024\022"
+	.ascii	"\317Px\334\314\354\220d\375\325\312\356A\331_\263\366\237\250"
+	.ascii	"\317\372\325j\177m\332W\361\366U6\373*\230}\225l_}\262\257\002"
+	.ascii	"\331W\2476\032\243>\353\311\262V\006\362;K\003\207L\326G\325"
+	.ascii	"\354\240yB5\216\257\356\244\334\321y\306q\363\013\b\032\007/"
+	.ascii	"H\026\222\263\362\220\374#c\241\316\f$\367x\366\221\257\236\233"
+	.ascii	"q\234dVg\3163\216\233\031H\2163\017\264MK\257\305=\3438F\277"
+	.ascii	"\200\240w\320<\264M+\001R\344\236q\334\f\021\242\327e\212k\210"
+	.ascii	"P\243m\350\317\372\001\365Y\257*m\253\016\302\271,WV\262\276"
+	.ascii	"\266\333Fl\324j\254\035\255aJe\244\274$L\343\030H\031&\033\223"
+	.ascii	"Z\323\03014\330\240\262T\236A\346\231\247\362\216\234#We\033"
+	.ascii	"\371F\326\221qd\252\034\205:\263T~\312 \374$\236\245\262\023"
+	.ascii	"\232'<j\306P,\026\2504ywq\334\f\321!\004\n\\i\344<\240\257\307"
+	.ascii	"\366\265\223}"
+	.string	"Md_W\355k\245\375T\316~\312f?\005\263\377\034\343y)\313\260@\314aW%1Qe\235\2254\025[\020$Y?5\3339\211\304s\214\t\264|A\313\232E}\326\247d\373\251\222\375\364\307~\312c?U\332\317t\366s\334F\347\240tP\247\006(\336Q9h\231\253G\315\270\031\307M\236\\\244\316\025g\326\317o\373\250\006kz\347\016\252\301\372<fg,\373g\350\317\372\243u(\234}G\355\216\222\254\017\302\2316fa\356~T\r\312\006m\203\302\241n\3204\350\034*\207>\3218\364\r\272\006\245C\235(\034\324\355(\032\364\355h\363\250\332Z\234\2301rld\336\224is\203%\013\235+ex\3141\262<\020~\364\313J\035\022fP1a\032\307=\340\230q\334\274\b?\372\365\227\020\001\205\203\202\241bh[U\t^v\236q\334<\252\345'\001\007=C\301|@\212\343#\035\023"
+	.ascii	"\221\353\202\343.\216\343\020!:\204@\347\322 \245}\320(\024\372"
+	.ascii	"\263j@"
+	.string	"}\326\347\251\375\234\264\217\316\355\243jv\017\230\335\201\312\256\200\311\006a\265\177\224\313Q0?\272\0055C\323,\020\307Iq\034sX\227\222\260\270\262F\275\240_\216\246\241]b4-\204\2538>B\323x\362\342\370\210\007E-@Q\013\264WV\222\262U\037\305\261Q4\022G\271\370\254PU\315\230,\216c\236tM\024\332\215\254U\324g=*c\177\200\376\254+\352\263\222\200\376\254G\343\3755\350\317\372\241\375'\372\263\376\001\373w\350\317z\005l\264\211RA\235\022\240a/!\302S\243*\261\2248n\362\004\355@\261\203\227\365\r\260\217Vy\004G\261\b\367\260\217J\260\242wP\t\326\347\335\203\372\254QP)\022\244KLW1Y\03473\3604\251\232\200d\375&\372\263n\324g]=\254>\032\034\375\177X\376\225\003\017&\360\263\276_-r\001\0166`\301\366\254\032\270\300\252\177\206\312Qp"
+	.string	"@a\005"
+	.string	"kT7\320\345\034X\241\260G\360\003U\310'\020 A\001\376\365\202\342\277\372\330\026\326\b\004\260\372\370\330\0264d\360\257\301\325\303\376\201 \374\031*G\205\275\367\0039XyV9*\\\360\277\357\007F\360\257r\340|l\013u\326\037\360\007r\370\334\325\244n\277\332\305\022S0\277\352\204m\301\266\377\372\344g-\200z\370\263\2124\013\333\223R\371U.v\370\347\021\177\356\340\317\033\374\031\202?s\360g\t\330\n\244A&\360\026\036"
+	.string	"\226\002?;\201\031\254\007e~`\277\372\376jre\331\006\254_\354\013,\013\325\001\277\312\342gW\374+\372\257\231e\300j\345_\307~V\305\277\226\375j\013\254\013?z\366\243N\277Z\301\277\372\330\026~5\202_\025\341W\303X\026\316\376\025\355gW\370\265\325\237\325_\373\320:~\275\343\3279~V\205__\375\354\002~\355F\245\241\267\374\032m]\373\331\024+\333\317\246\360k\256_\215R\313\240\037~\264\347G3\370A\177\374\372\210E\341G\233~T\352G\247\374\250\215\037M\362\243)~\224\354G\023\360\243b~\224\371\243A\320\"?\352\343G\267~\324\314\177\274\265\312\257\316`O\370\3276V\001\277f\200F"
+	.string	"\213\342_\325\374*\016\366\304\277\306\375\253\334\317\232\360\257u\277:\2045\301&\340\327\017\374*\335\257\326\261\b\370S:\177:\347g\017\360\247xr\277\372d\r\360\247m\274\330\022~u\205\377\035\376\f\366k\007\374\347\360?"
+	.string	"\332\304\257?\374\372\367_\203\002\374l\b?\353\001\013\342g3\370\331\013\362\211C\371\177`\376\225\351_\233~\226\202\037}\242p~5\t;\301\324\317J\300~\370W\034>\330\b\376\025+C\345(\324\315\026\026\202\255\225\b\353\341G5\374\250\005\277\272t6\017\300_\370\207\237\355\360\263\017\234"
+	.string	"\377/\352\317P9\352W\331~Q~4"
+	.string	"I\307{\362_M\030%l\317\257\036ay~5\355\354\377;\362?\315\3775\377\331\374o\363\037\356\377\333\1778\377\343\376\313\375\177\363\337\315\1775\377\347\376\265\204\377i\377y~`\006\3242\226\207\025\002\261\374\253\213\177\205\361\2571\374\353{\240\234\177\255\300\277\266\370\327\366_\207\377:\201\177\245\300\277Z\340_\213\377\252\304\006\377u\001\377*\201\177\215\300\277f\340g\201\377{\376 \373\263\277\237e\177V\375\331\364g\321\177\275\363\257u\376\025\357_\347\374\253\234\177\265\373W\271\177]\363\257f\376\225\355_\277\374k\227\177E\373W-\377\212\345_\307\376\325\371\257`\377\372\344_\217\374k\221\177\335\372W!\377\n\344_\261\376\365\352_s\374+\216\177\275\361\257O\377\332\364\257K\377\252\364\257H\377\232\201\177\r\372W\367_\r\360\257\036\374+\007\377\272\301\277j\360\257\031\374+"
+	.ascii	"\376\225\202\177\225\340_#\370W\r\377\352\341_\177\376\325\347"
+	.ascii	"_y\3765\370\257\277\177\335\377\232\376*\336\257\316\371U9\277"
+	.ascii	"j\367\253p~\365\315\257\302\375*\233_U\363\253o\277\352\366\253"
+	.ascii	"f~\265\314\257\262\375\252\332\257\206\371\325\264_\355\362\253"
+	.ascii	"h\277j\366\253e\277J\366\253\032\370\321.\277Z\364\253\020\370"
+	.ascii	"\325\260_\255\362\253\035\3705\332\257F\375*\225_m\376h\233_"
+	.ascii	"\375\372\365\013\277:\345W\245\374\252\327\257v\375\252\223_"
+	.ascii	"\345\372\325%\377\361~\225\371\253I~5\351W\217\374j\221_\325"
+	.ascii	"\372U\034\277:\365\253R\2776\373u\324\257\322\370\325\247_m\372"
+	.ascii	"\325\032\277\332\302\257\316\370\363\211_]\372U\031\277\032\343"
+	.ascii	"\327@~\365\350W\343\377a\277\272\201_\315\300\257\306\360\253"
+	.ascii	"\021\370\325\022~\035\367\353.\277\346\362\353(\277\216\361\353"
+	.ascii	"\007\374(\334\257\033\360k\023~\235\200_K\360\353\b~\r\374\365"
+	.ascii	"\377T\356O\321\374i\230?\325\362\247Y\376\263\360\247X\376\034"
+	.ascii	"\302\217\332\375h\335\217\322\375\250\233\037\325\340?\335\177"
+	.ascii	")\377\201\374W\373\037\301\235;w\356\374@\375s\020\3771z\002"
+	.ascii	"W\230P\261-e\226\306<I4ia\372\234\262\214,fJkO\364\313\227D\206"
+	.ascii	"\331\253\273\343\213\341\236s4\230p\236LL\266:>):\276$=7O)w\276"
+	.ascii	"$=8TOj\230wq\334\\q\\\2013c\001:\205B\177\326\022\250\317\372"
+	.ascii	"\022\330|S\250\030\313\344\216\323\\\326/\001\314~\tb\373%0\331"
+	.ascii	"/Ak\277\004\031\373\005\210\333/\300\332"
+	.string	"~\001\232\373\005`\262_"
+	.string	"\255\375\002X\355\027\200j\277"
+	.string	"M\373\005H\332'@\335>\001\326\366\t\020\266O"
+	.string	"%\373\004\250\332'"
+	.string	"\323>\001\342\375\001<\367\0070f\177"
+	.string	"[\366\007 e\177"
+	.string	"X\373\003@\332'\001n\237\204.\373$8\331'\201\307>\tH\373\002\260\333\027\300\333\276"
+	.string	"\322\366\005`e\377=9:24Nnz_zni\363lo\311\262z\272\351\241\351\005\371\020\303\211\023]\230\273\270\336\233^\233\036\233\036\034\352\354\271\351\255\311\322s\323S\2632\331\336\270\234\350\302\334\225\351\271\351\245\tj\211\321\302\005\250/"
+	.string	"\346\276"
+	.string	"\202\354\013\240j_"
+	.string	"5\366\005\200t&L-MY\234\365G\220\333m\2752\250\263g\246\027\006G\217L\332<\333fY5zfzK=0Y4\230\276\271-\035\253f\353\020\034r\325\304G\326\037\001\314V\263\263\326\033\203:{j=1jt\234\350\302\244s\302\330\236\253\376\bW\373#0\355\277\227\366\036\230s\370\331hc\223#\353\022$\336K[\273\274\374\230\223\365E\230\263\377\236\027*\247$\267\254\377^\227\036\027\032r\322l\311\032\r\375\341$\315J\326\027!\315.\353Y1\233\262E\255\211\212aa\243\222e\224U\271R\246\232A\305\310\316zf\275\261\336\225\336\226\236\226^\226\036\226\036\031\352\354\225\365\302\336\023C\257\210\311\362tf*h[U\t]`fe\275\257,C\207S\234WW\0347C\240W^nZ\033\364E\230\262\205\250\317z\021\266\366E"
+	.ascii	"\262/\002\217}\021\250\366Ex\332\027!i?\204\274\375\020\346\366"
+	.ascii	"\337\223\322D\nSK\326G\315\210\334\031\001\301I\017I\033f\021"
+	.ascii	"!YF\217IOI\357I\217\253\267\244\027\245\307\354u\365\274zMzP"
+	.ascii	"Pg\317I/I\231#C\262\f:Nz2zRh\233\226&SG\213\326\234\247\223\236"
+	.ascii	"\215^\020\264M+\2058yO\022='\275-T\214\214S\2320]q\334Dk\220"
+	.ascii	"\001C\326A?\204\260\375\020\270\366C\020\262\037B\216\375\020"
+	.ascii	"\232\366A\260\263\017B\334>\be\366A\350\262\017\202\025 \036"
+	.ascii	"\200eJW^\314\037=,\324\331\313\352Q-\365n\240mZ)x\251\365\262"
+	.ascii	"z8zWh\233V\nv\326t\023;0\273U\373\310@\032wS\262>\bT<z;zV=\035"
+	.ascii	"\250\263\327\243W\225\315z\364r\230\365\320\302\354\261\245\207"
+	.ascii	"\221\bUNO\236wq\034\363\314\300\352\001\307\247_\302m\277\304"
+	.ascii	"\330~\211\346~\211\255\375\367\246\336\273\241\204^\3051\231"
+	.ascii	"\320\206X\227\216\254\363\030\211\367\246J(\002\304\013+*\235"
+	.ascii	"\302\306\246$\353\227\200\332\377{O='\324\331\203\352\315x\217"
+	.ascii	"Ix\324\023\307[q\317\036ToI\365\202\266ii/6\3178\216=\204\b\261"
+	.ascii	"2\2413\213Z\365\3212G\275\032\275\246\036\r\324\331cz\f\255\364"
+	.ascii	"\206\331c\332HZ\351(\2034\247$\\w\313\257 x[\237D\230}\022^\366"
+	.ascii	"I4\367\337S\332uB(^V\360\344\3260\337\264a\263\341\3028\025\231"
+	.ascii	"\272+\263\364\034S\323\341Td\352\016\315s\214\225S\221\251.7"
+	.ascii	"p\317]\267\337\366\232\r\310\264\255U9\025\231\2723s\323"
+	.string	"ah\034\247\"S]g2\270\003\341\371\345Td\352\016\375b\253\301$\263N9\025\231\272\333u;\216\213S\221)\272}\247g\264\361\266\234\035\247w\264\363\366\334\236\263\351\364\342]\247\207\264\355\364\222\266]/\306\276C\235\273n\303\311t\304<1w\3356#\002\035\247\"Swq\334\004\356\360\002C\007B\237\204\324\376\007w\366?p\263\377\301\227\375\017\242\354\177p\004\314n\023l\303\301\246,\353\177P\265\377A\2144[\r\332T\027\304I\326\037\361L3\202m\177\204\226\375\021`\373#\266\366G4\355\213\260\263/\242\315\276\b/\373\"\300\366E(\331\027\241c_\304\321\276\007p\302\200\001\223\366EmLK3k/\315\244\031e\334X\311\372\036\220\331\3777\332>\333[\266\226\315e\233\241\316\335ec\321c\373\212\031\222\\\306\222%lw\331eqb]\266\225gS\234\325]\0347;\374\344\206\360"
+	.string	"#\324\367"
+	.string	"\311\276\007;\366=p\332\233\f\r\033#\202\227\365;\220\263\337\201\233\375\016\306\354w@\266\337\201\222\375og\225/Qo\340\354*\377\0059#;\242\262\273\300H)\223\365A`\262\233\270!\221\362C\nS\210\027\372\205\265\203dEy\016\331[P\236WS\236I\366\022\244$\273k\373\370zB\331Q6\330\236\262\277\266\224\375d{\355&\352\334]\333\311\356\332E6\222#\353\263\351\314\335]\0347s\034%Z~l\320\357"
+	.ascii	"\212\307\346\312\342\272\342\221\365;8\332\347`\016s+\331G\304"
+	.ascii	"\326\254\3041\337\214\354#A\\W\252|1R\246\265\211\250h\304\214"
+	.ascii	"}\221\242\305d\237\003\036\033\b\230-88\262>\007Q;\213\203\243"
+	.ascii	"\375\020m\366C\210\331\017Q\266\377\335\203\207\352\034\343u"
+	.ascii	"\224\365\346a\265\243\027\006\304h\306\216\255#g\201\031\363"
+	.ascii	"\222u\216<\305h"
+	.string	"\311.\353\207\230\2627\325\206\3327\262\324\236\233j;q51\221\332U\033\007\352\334T\373i_]y\302\262\352\177\337\330Sy<htem\243'D\210\2328\353\207\230\332R;Joy\212\211d\375\0202\366C\034\355o`\267\277A\232\375\357\246\315Td\315\220\267\315\264kpa\261s\222\265\234f\026.]\236MY\037\204\244\031\314-c+\355\245M\003u\356\031\254]\026$\032\314\0307\023&\365\3045\220\230\230R\366\214\255\344V\343\031\307qf\323A\206\311\247\277\301\231\375\r\304\354o\340e\177\203-\373\337F;\016\322\001\303[\362\035\377?{\007x\005\025'\315\251a#\226\265\235U+\316\022R\326\337\300\312\376\317\322a\361\330<\324\311\326a\351\346v0\353\260p\254\236$\330:l\035;\007\312\352\3254\344Kx\025w\345m\353\237\235\303\336q\2613\007'k9\315\225Kk\256K\326\337"
+	.ascii	"\n\033\207\265\263\301\206H\\\326\337\300\310\376\006B\3667\350"
+	.ascii	"\261\277\201\215\375\rh\354\237}\262r+\01788Q\354\0336\216u\303"
+	.ascii	"\302\241NV\216m\203\252)\222\306\310S\2045\253\227\246!_$\344"
+	.ascii	"X6+\227\246!_]\333\313\206\022\027\237>\b3\373 \300\354\203p"
+	.ascii	"\356\203(\262\017\302\352\255\r\030Uw&+\353\243e\324\271:lkv"
+	.ascii	"\324\324\3560I\260m\354\230\245\247\031\366\f\353\306\242a\313"
+	.ascii	"\240N\266\215%\323\306\262\r\340\216\351\316\035J\345\304\207"
+	.ascii	"\031\240\276\006p\373\032\270\355k\020f_\203.\373\032\224\355"
+	.ascii	"\237\025s\366\013\322\225\027^\326\007\201\313\220'\366\013{"
+	.ascii	"&\002Z\025\323\013\013\206Mc\303\240N\366\013\333\345\013kF\367"
+	.ascii	"\003o\311\235\212eG\354\344\323\327\340k_\003#\373\032D\355\007"
+	.ascii	"\340\271\037\200,\373g\267\204EI\313\"\323\242\321\276\232r,"
+	.ascii	"e\375\263Y|Ve\336\300\311ZUc2\007\267vW\027G\3239\303\250\321"
+	.ascii	"k\242,\201[\273\223\002\204\025\222R\201\332cN\036\3178nr\251"
+	.ascii	"lT:`r\006n\355\316\312\0228\326\307\221'\223\332t\345\211eK\025"
+	.ascii	"\270\265;Vk\007\223\004;\204\025\002B\225\2612\004\034\301\255"
+	.ascii	"uua\301a\257\232,\201[\273\373\201\005\267v\247\353\354t\032"
+	.ascii	"\033\025D\221\202\033#\303"
+	.string	"\202[\273cr:\202[\273\323NX.\r\005M\nn\355n\354\n\230\224\272\343,\227\332\203\355A\202\022\324\002\234I\2367T\035\025<\301\202[\273\243\242\3030"
+	.string	"\253\002\267v\307\"a\301X(\354\021\326\b\333\204\265\302Fa\273\330&\353d\257\260R\3302\226\t\313d\303X/v\t\353\204}\302\212\261_\354\0246\t\253\204\305\302\216\261d,\025\266\n\352d\271X\"g\267\330\"Z\016\313\245\357\324\031)\025\250\026\262\264<\237\240\324)\254\020\236p\201c\271\330,\215\326\344\b\216\006\313\245\326\320t \240T\201[\273c\261D\220\202[\353\272\362\304\211\251\235\260\\\332k\351\251\235\260\\:\212n\206"
+	.string	"\306\005n\237yRy%@\377J\214\376\254\275"
+	.string	"\210\355\007\240k?"
+	.string	" \330 M\236^\032:\036dY?"
+	.ascii	"W\373\001\210\332\017\300\322~\006y\373\031\314\355g0f?\203-"
+	.ascii	"\233\345\241\223H\315E\311\372\031P\331G\245\260;\326<6GJ\005"
+	.ascii	"J\005\267\246\247\025\253\003u\262;V\274\253V*\017v\207\nd\245"
+	.ascii	"C\202\022\024\nnL\3178\216Ct\b\301\263deCj\325Uc\3240\361\310"
+	.ascii	"\372\031$\331\354\024kC\025\223\265\304\214\343xj\275\303B\241"
+	.ascii	"md\332\353\316\223\235b\2434\032\332F\026\2178\003\267\326\205"
+	.ascii	"\203\245bo\240Nv\212\225\272z\245\376\b\321\341\2023fs\353g\340"
+	.ascii	"c?\203\246\375\fflv\265\303>\345+5\260\252\263\254\235\362\220"
+	.ascii	"\350\224d\375\f\214\366A@\332qvt\263\224\n\324\0034\334j\310"
+	.ascii	"\370\227\224\n\324\266\222\305\3644\212r\306\326`\227X\032,\023"
+	.ascii	"\333\204:\331\031l\322\331\030\254\3225;\203\215o\026#\254\003"
+	.ascii	"%L\330\036g\302\234\001\3651\250\263\321+\364g\335`\267\217A"
+	.ascii	"\334>\006j\3661h\333\307@\314>\006_v\332\206\376\254%\240>\353"
+	.ascii	"1\270\262\217\201\224]\205\201/h\274d\235\271\276\250cx\254u"
+	.ascii	" \250A\2260\235Y\273[\323h\037f\304\361\321\216\365\3315\325"
+	.ascii	"\364\002S\253\254yj\252\223*\2463kwl7\3730#\216\303\354X\311"
+	.ascii	"0\235Y\273\023\323$\313\320bC\207\245M&k%\353\312\023,\314\365"
+	.ascii	"\314z\267\262Y\321\254q\353\334Z\267>\3278+\234\365\315jf\265"
+	.ascii	"[\333\3265+\334:gM\263\312Y\351\3262\253\333\352fU\263\266Y\337"
+	.ascii	"P\347*\247R]\305R\263\336A[A\305x\260V"
+	.string	" \224\020a\225S\241\350\260\017Hq\334#\007\013\305tf\355\316\307:\204\004%\250\336\223\233\221\347*\247vQ\275\244\3153\024\262\242\320A\2622\211\262zY\345T\"*\363\303\2148>\202\3022\267T.YR\236q\034\303\321Z\217\220\240\004\325sr+\362\\\345T5\215\226R\201:\301\r\3123\216c\271\325\311J\346\310z\246\nQ\242r}\230\021\307XF\330\036Lg\326\356\336\344V\250\265G\222u\f\323\231\265;\325\207\234.C\363>\304\210\343\253\036,\027\323\231\265;\325k\225S\243\250_n`\252\227\234\352T\321R*P='\347\224\347*\247\266\255OGD\3265\2463kw\302\264\031tv\214\240W6\036 C\216\336\262>\006J\373\311\212\344\364\024\263\256\255cP\347\252\366Um\215\262\232\221\240\004\345\002R\323Sm\r\363\265\264\251$\216\201X\255>\230\276\322\264\025-1>\266>"
+	.string	"\260\354\243fc\036\3206\255\004,\301\222\005\3123\216\233f\253\224\325\312\007\244\245\025\302d\271\362/\302^\034c\2211\261x=\313@\240md(\316\314V-\377\"L\352\211\223\220t\251\255f+\231\207\fn0y=\357\276\254`\326\263\325\313\312e\355\262\246\255h\250s5[\267$\251V\304\356\3604\350\003@i\377\202;\373\027\310\331\277@n\377\2024\373\027\224\331\277"
+	.ascii	"\314\376\005Z\304\262\030\311\235y\312\372\027H\251\262:Q\347"
+	.ascii	"\032\266~MY\233@\3360\303V*k\023"
+	.string	"\210\007lLK\246\356\322-pub\253\276\005x\373_\233`?;Sx\330\001[\277\204_I\230\200d}\013\334\366-X\333\267\340\313\276\005[\366\277B\371\352\365\257\\k\0234M\2752CMF\326k\027\211\257Pbh1Ie\255\001\352\263\336\202\261}\013\252\354\334D\177V\020\250\317\272.Y6\211\373\221\365-0\262*Y\231[O6\3145\311W\246\021\034\0265A\212\254F\266zMn\\q\223\365-x*\362\255^\032)[\342d\275n\245v=\204\034\311\372v(X\325\r\263\254o\301\322*\004\b\027\036\335Y\326\257 n\037u\256AV l\322\234*d\262\276\002\tC\243\304\271\311\311z\375\261bm\346\223Q\f,\034a\324\354\350\270\352\301y+\243u\245\225\202(\331\022%\353W\320\266\247:\244cIP\262\025\352\\y\254Qd<V\251u\307\007\244\245\370(k\003\035LBt"
+	.ascii	"\343\031s\320\364\016\035\250\223\323s)\3535Gom\352\206\230\254"
+	.ascii	"_\201\222\375\2578P\347Z\005\342\007\023\251\254o\267R\375\357"
+	.ascii	"\345!ort\262\376W\252\2577\240\342\261\034YO\261qQg\252d\375"
+	.ascii	"\n|\354\325\306\032\225\177\034\241\211\312\372\025X\355W@c\277"
+	.ascii	"\202\030\253S\206\233\202\303J\326\247`\316\376\277\326X\231"
+	.ascii	"P\347\332\244\276]%\243\226y\207\346\332\244\232Q\321\b\223\232"
+	.ascii	"q\024\313\206\256IM\263\316@\333\252z\342\244\270:\317\020\250"
+	.ascii	"\2254;s\253\246\263*\271a\256K\253\214\225\006\352\\g|\235\241"
+	.ascii	"\252Q\237B\243\fq,$\2179C\205\243\336I\255rHt\274<\204\b\361"
+	.ascii	"c\n\302\303h\353\377k\322\032\003u\256J+\222\235\365\bm\253j"
+	.ascii	"\306RB,Yt\274\356V%\025O\255\363\001i)\005/p\317\335e\313\013"
+	.ascii	"\221U\237\2027\373_\217\276\032\3150c\242\346\316\032\373nT\265"
+	.ascii	"y\311\372\024\230\331w\216:)\211\241\226\365)\b\263\217:\377"
+	.ascii	"F\315{\\\2215\252)Y\237\202.\373\024d\331\247\200\354N\235S\355"
+	.ascii	"\32062\024d\344\250sP\247z\247\306Q\357\3245c\344\236\302$L\242"
+	.ascii	"LY\365)\220\262\365\223\24416\265N\245\213\203\3018\036_\270"
+	.ascii	"\262>\005K\366)(\262O\301\2208U\016u\252O\365M\207f\034gQ\237"
+	.ascii	"*\033\325\315\007\244\245\024=\350<\325\247\272\006\025\023\032"
+	.ascii	"5\343\247_\022&t\274\356X \\\300\266V\375"
+	.string	"\t\362\366\257\272\201\313\261\244%\257\031\203\251Bs$k\265\215\372\326\206F\034\227\365'\260\333\237\340\315\376\004h\366'P\333\237\300\354\214\352\3063\206\365\325\225\365'\020;3\301\224\375\t\240l\264\211\376\254\035P\237\365\0230\331\237`k\177\002\2541\252\230|u\226\247D\225\265\232\246\202A\235\377\242\206\351%5\3430\"`\214\210d\375\ttl\030q\034\307\350\277\254\354\277\254\237@\306\366r\255\204\262R^\250p\311\372\022\344\355K\360\334g\035xl\360\030[\312\372\022\250\355\203\020\246\216\245T\240v\331\020$OU\213j\206:\325-*\031\231\272E\275\242fA\333\310\342#\033\030\330\321\301q\351\020\"Xv\207G\265\3522\025\013O\215#2\212d}\tx\224I \265\377\241\216\230j%K\211m\301\021k\263\377\001LS\245\202\272\305\2413\203\254\371%E\235\2226\267\2109\223\365?0\245|"
+	.ascii	"\262\321\017:\366?4"
+	.string	"\355G@g?\2026\373\021\254\251Lx\332\220\244m\311\372\021hQ\2274\223\240\\1\300\270\262~\004F\366\177\365\b\352T\221\250[*\022\265\210j\004m#\213\343\250\016\240\330\360\342r\027\307q\207\020\350\0165\2442Z\253F~u\210\252\245\321\362\031\033\251&Y?\202\247}\b\360\366!p\263\363\025\372\263bp\245\266\017A\227\035l\242?+\032\006\365Yu\026\324gE!\030\333\032\232\350\317\232\265P\2375\267\251:\324\034dM\264\245\254\253\314p\355"
+	.ascii	"\223\365!\230\262U\034*\325\352%\207\004\225\365!`\262\003X\\"
+	.ascii	"O@\304d\375\006\314\t\177\260lV/I\272|]\005\233R'R\254n\370\370"
+	.ascii	"1\201e^\360\236z\364\202\370r@\341\030\302\343\006O\231\333\331"
+	.ascii	"\227U\360*\367\250\243s\267\343g6gL\233PGp\313\b\2167>\262\026"
+	.ascii	"V\t\253\216|\314\006\270\t\245\244\204T\327p$\005\004\034*xK"
+	.ascii	"\356\342\252)\020\277\320\306\205T\302\033\\\210\334a#\274!\234"
+	.ascii	"\362\331`#\366E%\202g#\313\227\377=}\003-\n[\326o\300YSJ\034"
+	.ascii	"7y\200OOE\256\240~Hz]>\252\374x\002N\031\303s\022&t\n*\201\311"
+	.ascii	"\310\322\244\t\210\347\203jNJ\326\302\031\302\031\302\032N\250"
+	.ascii	"\340\316\272T'RhbB\032\027\326\270cFl\315\b\023\254\030tY\277"
+	.ascii	"\001=\2042\2042\324\250-L\2362\035\314 Y\277\001M\302\030\302"
+	.ascii	"\030\314\246!_\352[\032\330W\236\020I\210\004\314b\251\250\324"
+	.ascii	"T\361\374\210\273\314\311\"4\022\032\321\341\301\223\313r\313"
+	.ascii	"\372/4\271s\207\003T`\314\256\260\252 e\262\376\013?\352\324"
+	.ascii	"Q\243\204gTQ\350\354)9\222\030e\375\027j\340\341m\310\243\002"
+	.ascii	"c\242`r\220\321\311\372,\330\346\314Q\243\244\250\206\220\351"
+	.ascii	"\322W\244\214!\311\372,\320\344\310Q\243:\\\031\305\021r\241"
+	.ascii	"\212B\347.\006\325\215#Y\237"
+	.string	"\205\026\0348A\273\016WFv\276\257\2468\253;\340\023W\231+u\017\332\251X\304t\331B\227\341\344p\240\241\233CS\206\207\224\255\305\365\224#\353\263\230j\323&(\327\341\312(\216o\256)\316\352N\230\347U%.\356A\271\"4\2460\005\337\354\200\202C\363\306\3151\354\031f\310^\nRW\005\367\373\021\244R\362\252\343v\267\340\232\247Iq\217(\276\264\2468\253\273,\273\030`h\036\\\023T\303%\036S\223\246m\f\025\226\027\017dc\242\3366\226\b\336,\375\252\200Z\314X\321\222\365W\254)S&h\246\253)\316*h\026\006\207Z\333\203f\274\262\320rd}\273}\345\177/C\f\243$Y\177\005\0300`\202l\353\022\247$\\,\323\023\026\230\265\007\331\206T\215\301\313:\030&\250\006l\242E\206\226\332\030\035\303\213IM\324\336\341\205#\215\230\336\214\225n\315\021\265\254o\247V\371\337C"
+	.ascii	"\326\333\214\254\277\202\311\227/UH\250\272T\311\372+\254\272"
+	.ascii	"t\001\326@\271\334\220\343\025\244\213\306X\326_!\303\314,\210"
+	.ascii	"FE5\204L\327z%/I\331\331\203hA;\261\266/:-Z\202X\270\244E\250"
+	.ascii	"\314\334\262>\003\270\\\371\225 \226\016;\236\022d\353\311\223"
+	.ascii	"\326fkM\331\203Xx\220\232\030\321\262DL,8\346K{\202\233[\337"
+	.ascii	"\232s\336\254<8\026\307\346A\001\263\342\013v\275y\313\221\365"
+	.ascii	"\0310E\205J\320\251\203j\b\231;\366\314\226\222\036U\036t\272"
+	.ascii	"\201\245Y#\344\177o%\363\224G'\353\253(\003\005J\020\254\303"
+	.ascii	"\225\221\335J\206J\bU\306\222\212:\n~=\b\326\213;\273\022\222"
+	.ascii	"u\320+8\005\t\225.wA)^\270t!Y\ty\300a\002\026%?\365\236\230;"
+	.ascii	"\356\262\276\035\253\036i\322\210\223\365U\020I\362`\223$\301"
+	.ascii	"'\254\227\0161RR\334\203\210\017\336\215;sw\361\222\025\210 "
+	.ascii	"!>\326\234<\370dm\275#v\206e\366\277\2076\331\002\245,\353 \223"
+	.ascii	"\007\271\376\036\253\346M\255J\326w\001\316\016*yp\311\337Sw"
+	.ascii	"\330\200\343\312\372.\270\331\177\220\371\367\200Zkd\346\262"
+	.ascii	"\276\013i\366](s\344\210\320\352\306\327\224\256\263$\307\235"
+	.ascii	"\254\357\202\227\215\222\241d^n\340y\351\272J\343r&k-\255\340"
+	.ascii	"\026Z%~\022\246\335\300\363\322\245\312\201\202\244\204\310\203"
+	.ascii	"[\232\210\233\033p.T\t\021\242\343\311N]p\316\330\020f\326w\301"
+	.ascii	"\b\b\020\364\353\206\034\257=\203\013\033\264\254\337\302\032"
+	.ascii	"\026V\230\033tw>5<\334\360\310\372-\374\330\361\035\301+\264"
+	.ascii	"J\374\224\201(\274%]\351\334\230 @|<x\325;bw\267\325\343GF\207"
+	.ascii	"\324\232\036A\036kn8!i\223\342\315\0240A\2534\307\230#a\350\262"
+	.ascii	"~\0139r\344\370I\271!wW\266\324f\346\r\016\034\254\324\215\270"
+	.ascii	"/U\007\024\033\033*Q\217\n\336@{\232Hn^L\340\r\"]F\246\036\274"
+	.ascii	"\241\363\210Xi\311\372vA\033\377{,\2248(\"6\202RO\271)\315\254"
+	.ascii	"\203R=*\017\254T\033\030\031F\236\236\324(\264J\374\264\306q"
+	.ascii	"\242\013\323\025\307U |MQ^5\262>\013<\2024\2024\202M\035\256"
+	.ascii	"\214\342\254=n\264\251\272\213\343*\020i\022\031\036g\202L\017"
+	.ascii	"6=n\r\336\017\264\254\2035\320\274\377=!\217+]7\344,-\005\225"
+	.ascii	"R\020"
+	.string	"\323{\236\t\211\312\372+\244\331\1770\306\037\214\021TJ\341\211\251u\3664%\313\027\264\254\277B\227:\017\"\325\001\276\265P\352\2019\307<c(+\016~[\332\326\216d\0354\n\036\005\343;vV\370bs\240\234\217\215\257\r\352\004\262\001\342\035a\273n\214\331pfM\207N\013\216I\326_\201\271\347\200u\3024\216\217\324\2301P\016p\016\352\004\336\001\355\200w\3008\300:\241Q36\na\315\306W\316\022\006\254\314\252\277\002\220\375\025\250\366\017\244;\260\356\007>\201p\204mN\234\244\311\032\375\"q \235o\3133\312S\326_!j\243K\350\317\232\001\365Y\201o\200q@7@8`\033\025\354\366\017T\003T\363C\002\242'\216\263\310\234\305PU\034\374\354\260!2#\353\253\340\006v \231\023\b\006|[\241\230\361\220&\226KJEIT\225\254\321\260Gj\322\210\311\372*\244\355\243R\256"
+	.string	"\261\270y\002\263\300=\315\200hh\233V\002\234\224Q\327"
+	.ascii	"\313> -\245 \245\r\220\r\330\0058f\313\035\t \033p\313\2322@"
+	.ascii	"7\340\031`\033p\rH\006h\006u\002\331\200\\\324\200l@-l\236<u"
+	.ascii	"Q\306p\364h\340\225\277\371\200\264\224\302W\334\023(\006\250"
+	.ascii	"\206:\201c\310\200cV)`\030\224\314\215\257)\017!\202sh\326\354"
+	.ascii	"X\365\017\f\003\004\223\2459\204.k`\032[\205C-F\326W\301\311"
+	.ascii	"\376\201^P'\360\313\266\353B\303\313\372v\177\363\277\367\003"
+	.ascii	"\263\225\305\334W!\013x\266\337\236<\310d}\025x\354\253\220c"
+	.ascii	"_\005\251}\025\232\366UX\332?\020\013\260,lL\035\231276&\244"
+	.ascii	"\254\257B\322\006\212\001\307x\274\316\204`\311\372@+\377{-l"
+	.ascii	"\225\301\222\265\016\313jI\230MY\037\350\024\256Ar\205J\326\007"
+	.ascii	"V\301r\247.G\326@*[i\001q4\360\361\330\342cG\363@*?\220\211b"
+	.ascii	"\211\341N\0359Yk3\022\0076\311\244=\301\262\376\002\332\200I"
+	.ascii	"\016\224\002L\002\234\242\"\305"
+	.string	"GH\3304+\016\324)Gxp\262F\201G\250\344!e\r\354\002z\001\243\374\275^\027&7\253\254\277\2000\373@(\377{>\2553G\232d\235\321\177Y\201N\016|\362\367X)PIW\262\376\002\272\354\003\271\200M\376^Zg\255\313\214\254\277"
+	.string	",\373@&\377{\035\200\373\001%k\340\222\255\264"
+	.string	")\032\364\332TySD\311\201K\216\246Y\200iG\225\\\326@&\211\003\225\344$djjY\007Q\237\365\013\360q\344H\227\231\0348u\262\376\002\232\366u\030\n,R$N\n;D\210\250QQ\234\2367\226\220\304p3d\310\bRkR\230-^b\202\004\001fy1\363R\231\216\267\254\237\"\n\360\007\360\0070+\207\201\002\307.\031\325H\002\304B\235\300\254(\\\2328\262\276\035*\366\277\247f\305qc\266\345\303\007\260\306Q(\264\022c~L\316\304a\313\372)\254\200<\200<J\200\242%\234\322V5\226\365S4\355\035;\342%\035\330\311\373\221\365S\230\203\003\0070\307{\216Fx]\301Sb\003\254:0G\316\322\305\307\223\254o\247\303\376\367\2004\244\272\364\310\372)\274\001\336"
+	.ascii	"\336\200\032a5\005V\327\265k\3349i\313\372)\230\211\002\332\210"
+	.ascii	"R\243\3268F\233WOPq\025\024\b)\251\243\022R>%,a`Y?\205\260\375"
+	.ascii	"\024\256\366\017|r\002\237tX\032\307=\254\326\271&\007OA\252"
+	.ascii	"\251I\215z\217\031\021ui\224\266\030TY\037\205: \r \r`\r4\021"
+	.ascii	"\314)\260\272\273\240\033\2708\013\260\206\022&Y"
+	.string	"LY\037\0056\373\007\306@\235\300\030\300%5)>\222\262J=\331\251\003z\221\361p\313\032\270\364\003\225\2002|tP-e\311\026&Y\003\333\320\237\025\315re\377\277:\250\363W\007\210\324K\212\217\312\3300Ops<]jk\317\254\177\240\321\201H\377\317\316\357\016\360(\343PsD\214Ns\327\025\22650&q\240\321\017\213Z\235$Y\373\240>\353\206\030\375Y3\n@\366\377\303;\352\374\341\375\304\212\254=\236\3240{\354x\223#\353\2430\265\377\337\234\243\316\337\234\037\225\036\227S\221\2517\265\2627Y\377\204;r\344\374\246\364\222\342##\254T\323\231\273%bq\332\304\321\321\375\354H$\305GQX)ML\244\356\342\330\212\003\026\216\b\226\243_\035[\307f\206\247\233\330\020a\312\372'\234\331\377ON\356\007\247CO3\316\212\302\214c+\016~t\312\254i\372=\325\037tu\214t"
+	.string	"2\355\330\362%\353\237\240\366\346\315/J\232\024c!Y\3114\r\371\272\223\272\263\202&\353\237@\006\007'\244:\201\t\0336?(jR|\004e\245b\272s\307\346\005\221\203\312\372'\360\330\377O\215\363\247\346\367\344\003:4\274%\331H\031\246X\326?\201i\037\205\202\376\336\216:\177o\032m\205\242\021gEi\020F\211\203\237\340v\324\371s\3735Y\241\3208\036{\333\361\234s\233c\312\372\n\250\263\377\237\231\243\316\237\231\037\023\2739\2705t,I\033#pe\312\250Qh\034\307qUl\004'"
+	.string	"kS`u]\033,\212\233\035\027665\n\215\241\342\270\312"
+	.string	"bI\236qU\025\b\036#n\256\272\254\214\031\363S\323\020\307q\314d\255\210m={\315+H\344\324\362|E\250(\375`\206\t\363KK!\216c\243\236\030\351\215\0073\256\252\002\021\274\301&H\221\254\257"
+	.ascii	"\247/_~iG\241r\370\250\252@\350$87B\376KC\305~l\242\272\246d"
+	.ascii	"}\024u\373\377u9\352\374u\3711A\\\035Mu\240\244\312\026\227\352"
+	.ascii	"\005\347$.\353\243\360\262\377\037\232\363\207\226\272!\021\307"
+	.ascii	"@|\254t\302p\240\331\204d\355\310\372(\252\354\377\227\005u\376"
+	.ascii	"\262\374\314@\\\305R!"
+	.string	"\300\241\202\267$y\347\315)\353\237\331\377\323\362\333\222\302\241\035,\251\031\311\332\303\023\375Y\323\036\250\317z\024[\373\377\225\035u\376\312~H|Pq\234\245\203\345\002U\305A\266\233\222\245J\326GA\265\377\263\362\033\373\217\354?25\352=q\034\377\240\246\300\352\356\342*(\020?\001\267\177\364\371_\343#\2508\216\245\324f\f\205\004\\\177\364\250\212\242 \376 \232\242\027\374\327\351\317\200<\025q\254UgM\034\307h\335fbv\264\243\202s\210\3438j))6B\227\302\260\242\226\302\260\2402,\255aE\305IQ]IXW\350R\022\026\024TRl\224!\016\303\202Z\212\261\242z\342\260\030\307R\330\221\021\272\224\024G\3051V\334\023/\035E\305aM\250\fKaXPKaXQ\031\226\302\216\242\226\342\253\270g\251\t\004*nb\031e\250\021v\024\025\207]Ee\210\303\260\242fd\321\375"
+	.ascii	"Q\307H\220'-Ihw\250\231\245\244\330\251\311\352\b\252\247m\251"
+	.ascii	"y\025\257\211c\224L)\206\212\333\342\370\2028\266\272\202Zs\204"
+	.ascii	"\003=CjsB\312rt\345\241\t)\353*Nj3B\343\266%\256\2538\346B\022"
+	.ascii	"\212\233\3428\216C0j\266\305D\3206# V1\223R\034C\0207\343\270"
+	.ascii	")\216\215\320\270-\216c\2438\216Y(\253f\034\353\350Yb65\305q"
+	.ascii	"U\207\246\330\312\bM)\2163Y\233\263\250\245\260\254+\022hV\302"
+	.ascii	"\230\261\214\246\021\272\304t\0253\3435XP;\314\210J\314\024\307"
+	.ascii	"1J\267\231Q6\346\262\376\205a\201Rk\313\372'\24247\022\325\031"
+	.ascii	"\264\254\313t\254\r\311\372\327T3\373a\226\365O\024i\262T\344"
+	.ascii	"\316\274d\335\304\341\005\247I\326?)iu\204\330\310\372'|\354"
+	.ascii	"\237\027\252~\205\231I\222\365OD\355_\327\226\321\232!Y\377D"
+	.ascii	"\274\177N\202X\330\234]\262\276\tu\373\307\245c\307\331\226\254"
+	.ascii	"o\302\233\375[\222\245e\213\232\254oB[\363w\326\343\312\324/"
+	.ascii	"I\257\353\210\215!Y\337\004\261\375;\302d\213b\312\372&8\331"
+	.ascii	"\372\025\331ns\202\250e}\023~l\3458\352\374\345\370i\241Ph\034"
+	.ascii	"cycz:\235\332\330e=$\013\033'cY\337\004\251\375\377\227\365\013"
+	.ascii	"\362\003\202:\177B~?\376\323\361\333\361\023\362\263Zz\n\371"
+	.ascii	"\365\370]\245T\240Z@\272\023\366\023\362\303"
+	.string	"\362I5\305Y\005\343\031Wm[\337\004\243}\023s1\376\273\372s\330\217\307\317\207\025\2663p\320\364x\363$\353\233H\263W\023g{\275B\177\326\243A}\326\233\220\362\303!\214S\303\016L\32671d\377\250~SG\235\277\251\237\224\232\024\037u\255PNi\302\254N\250|\351\310\372&\244\366\377\263\361\223\3222$\013+\353_\024\325\025\036\222\254o\342h\377\277\247\247_\023\210\253\330\206\007\\Nq^=5v\246@\311\372\tx\333\377\317\351\327\224\026FK\227\254\177M\277\032\350Z\033-X?\246_\r\236-L;\240\034\033s*\353\346\206\252'NY\2279\361\310\262\376\1772\216:\1772~1r\225\330\350g\326\226&\217\307\r\0342\262~\002\270\354\377\247\364\213\341\306\rJ\232\254\177Ik\276\214\001\223\365\023\020\266\377\337\321Q\347\357\350\027\253I\261\220\257\365\253\212\203\237\032\336\025\265\254\237"
+	.ascii	"\"\373\377\031\375\3422(]\336d\355\273\223\3218r\276\254\262"
+	.ascii	"~\002l\354\337g\307W\0078C\212\313\0205M\254m.\257C\020.\217"
+	.ascii	"\215\214\017\317G\247\216\253\310S\326s\242 \021S\313"
+	.string	"\372\b\270\263\017\202\03264\271L\230\306\361\321\033&\2317\2768\037\034_\034\037\234\217\316'\347\253\363\315\371\344\370\236>7\276;\324\351\263\363\255\271\217\215\257\r\2213rO\022>;_\233\317\316\347\226\313\320\266*\355\025\367\214\343\330g\347[\363\261\241mZZJ\336\363\315\215Z\035\237]\356\312^h[\225\346\262\363\214\3438\r*\006\347\263\363\225\251{\262S\327\025\204c\205\306\310\007\235\241\320\237\365\002\324g=\002\254\354#\340k\037\001M\366\021\260\265\217"
+	.string	"\254}\004\354\330G\300\215}\004\324\330?@\336\376\001\326\354\037"
+	.string	"\315\307\226\207\362\324\035\241c$\353\037\300\312\376\001\276\366\357\033\343\023c\004\242\004J\326a|n\304x%\311\372\007"
+	.string	"\262\017B\026\237\031\033\363\213\017\013\031/\276.>.\2764\037\030\324\351\373\342;C\363\231e\261y\372\276\370\276|T\326<}_|U|ei\223\271k \225y\306q\274:w\270i\001\352\037`\307\376\001\214\264\370\266\364\256t8\217\346h1\300\334\276\001\316\\\241\252\002\207*\353\033\240\313\376\357\033\363YA\235>2_X3\216\343\213 &\206\351#\3639Q1\226\371\0047\327\245:\273l\334Y\365\r\240d\337"
+	.ascii	"X\373\006\250\3327\200\224\257\231\363\312\250Q\222\365\r\240"
+	.ascii	"\344\003+!o\377\276)\277)U_dv\220\312\340\3111\2433\207D\r3&"
+	.ascii	"\026\272\031O\265<\271g\214\336\034:j2\324\236qP\261:>\036\276"
+	.ascii	"*_\017_\023"
+	.string	"\337\225\257\210\217\351\353\362\345\360-\361=\361A\361q\371\254|R|:|>|Q|H|^\276\037>&>,\237\022_\020\237\021\037\021\237\023\237\020\037\020_\226o\313w\3047\304\267\303\247\205:}I|7\356\243\362\341x\306\002\205\212\2110C\f\026\273\247,\203F\030\246/\211\317\206o\n\214I$*\257{4\002%\227*\332\344\021HE\032\333e\017\202\016\260q\310\270B\006\340\257\330&\217B\367\330\242\205\211X\320p!\021Cw\310\b#\211\212&`\367\315\360\026\221\n \276\n\200\215\310\024K\027\206\361U\272\256\tCKW\351\272-8\274\306\007\212HW\371\022\275?\027\0221\224\\*]w\230<\372`#\362\007cyl\221AF\026CJ\025C/T\300X\341\016\021\275\356r\003\213\327\3503D>\300\242\2104\002m\200\227I\025+z\226m\021\331\302,\206\222\313\023\212G#Q\013"
+	.ascii	"<\360\246`A\\n(\276)|TT\260\302k\244\300u\221\034r\227\022\\"
+	.ascii	"H\304\b\027n\215Ewh(\205\013\304\201\005\017\307\226(\004\267"
+	.ascii	"C#^$\227Bp\022\311\002\265\356Q\303/2IT\201`\244qy\\\217G\023"
+	.ascii	"\276\013\211\260\300}\033\340\241\330&\217\017\\"
+	.string	"HD\020\322\250\202\270\0026\"\215\024\230p!\200\215\310\024E\243\222\275\220\210\367\003lD\246x\211K\341\205D\270@\355{4\266@Ad\322\b\273\357\206\227Hl\205\027\022A4d\034\341.\211\210\206\214\300\"e\362D\217\206\rp\013\305\337;\f\272C-R'\217Fe\004E\312\344\211\f\360\205D\004)\211H\242\023~\352;\fR\002\341!2H\251\"\203\224\251\020\034\204t\217\253\033\203\361\325E\312$Q/ae\372`\321\022~\215A\356\212\237\242\313\026\335\227H\277\354[\270-\016\203\224\"\204\312!\367\205 \345\207\240\fKa\321]\032\2110\340\256X\001/\211X\274F\rC\311\345\t\022\270A\310V\210\330c\f\n\213\200\214p\262\205\"\322\204\213\366\365\371}\370@\004\274l\225\"\212\306c\353\2007\205\273$b\341.\211^\244\013\200\"xiD\361\246\b&_p\215@\306br\b\331"
+	.string	"\0276._H\300\202\013+T(@\001\305\326]\372(\300\200gC\317\373{W\r\033~z> AD\n'^x"
+	.string	"\213\023\275\344\262(Hg@\001\206\361\204\"\322\204\013\267E\343\261u\321\341\307\302\317\t\013N\300n\220\007\nTdx9\370\\x\242q\351\"\335\240\375\020F\360`\004\022`\260'\201"
+	.ascii	"\037\020\340\203\365$\020\200\004\t\002\214@b\177\004\022)\f"
+	.ascii	"\3030\f\3030\f\273\3037\250=\236\340\036[\264\257\021E\273\001"
+	.ascii	"^"
+	.string	"\2720\261]\266B\304!\234L\266p\227=\257\360U\376b\020\032\272p[T\022\r\177|\334\341\t\0336\300E\355ri\342\303\220\013\277E, \200\341\013\211\300\300\205\333\025>$\024\215,,\205`\226\204\244\022\206\002\226B\360\366\275.\334\256 .\331\244\022\206\002\210\313\365u\341v\251\242H\241b)\364\002\262\250\330\203\241u\227-\206\255\022~\200\205V\t\263p\362\205\242\013\003\322x\334\357\260\210L\236@&\215C\036\334a1\005\214d\013\266\230\302-&\207V\030D-\017L\\\216 \002)]\230E\021\351\262\357\320\rB\266+\204J\027f\001/[\370\355\271A\310v\251\272\303\037\321\030\224\\\301-&\207z\027\022\001c9\"H\351\263\364)\333!\342R-\2720\226\031`\270G%\021\n\240c+\344s\213\306%\322X\3010\210\350\250\354\260,\"\215-\206p\373\016\207\210\2260\f\256\362\215"
+	.string	"\350\036[\242\017^\272.\220F\342\262h\034R\221\306\241\r\243\035\332<\357\211c\353\002\2314\246 .9\274\256\273\frQ\f\265'\\(\2014\2300\266\035\220F\242\373\022\301X\376\216.\022\331\n\021\2070\210\332!\214v\210\347\375\371\271\312\"8\203\207\t`\"%\322\310\301ua\204[\027\306\245[\3740\fB\032\211\313\016\312\341P\273\004\032\022\227\357\320\370\276K\017E\343\0206\"\211\202%\2160\226/\017\374\266@C\242\026\257p\211|\2070\226@\357\362'\006!\"\261\365\021\211-0\271t%@$\266,\f\344\026\2070\207\013\211@&\215\355\005/\321P\210\b\033U\024\221&\216\307\344\322g\351\302\356P\262\325"
+	.string	"_H\204\013\267\030\244\344A\241\276D&\030\225\357\032\324\276\200|\211\353Kd\002\261\204\321\004\261\204\321\347\262\275\013\211\220\340m\225CI\"\017\322x$\272E\030\351\016\005\265C\301aP;\004\374\t\207\304\022\306aP;\304#D\276\304\241Q\371\016\203\332\241_P\373\002\254$Z\002ax\b\344\026=\\H\304[ta\367\250\034J\236\330\360F\360\256D\303w\310\270|\001\305Or\351J \250\035b\341\013\211\200\221\356\020\3210\303\213v\231\302Hwh(\t\277D\304aP;\344s!\021\022\300h\221\306!\r/\036\200\221\356\353.\225p\022\t\267-\\x \2728\006\335\241\006w\270\301%.\211\222,\226.\354\262"
+	.string	"#\335\345\222\210\250\241\b6\022[e\333\202\007nMp\200\373\022\005_x\351\036M\234p_\242\rnP\213L\032a\345\020\321\213L\022?\274\306\327]\272\360[$\004\267-\\\b\335\240\026>&]\034\217.\361x$\002\202\333\026.|\216G\367D\321\322\205\341\326\004\227\270L\002\375\024\265G\345k\334"
+	.ascii	"\267-\214\301 \244\021\271l\037\360\300\261%\032a\343\362\304"
+	.ascii	"2y\002\334\266p\301\241\2304.]\025@\312\025\202Z\026p\333\302"
+	.ascii	"E\017|!\021#\222F\0160\007\r0\274-\013H\" \240;\204\227I\025"
+	.ascii	"\307\326\270t\337\007\214>\345;\364*\2032\300\355\262H\324\266"
+	.ascii	"\030>p!"
+	.ascii	"\021\2572hD\322\270\341U\006\375\334\241\212W\031\024L.\225\333"
+	.ascii	"\035"
+	.string	"\372\334b\222\205\267m\361nw\310\223\204\211Z\237;4\361*\203\202E\242\326\204$L\324\356\244{4\036\333\240\241\373\022\375\270C\267\230d\341\007#yl!t\211\310\344\320\035J\n\ra\367\035\276\312 \016E\020\206\356K4|\225A=E\260q\031\364\266-^!|!\021/\ft\217DK\375\016_\367H\264\002H\264\"\351b\351\276\302\027mQ\272\217\307\344R\013\021a\243R\205\201,\250\357\220\365%],]\026\356K\264/$b\004\004A\267\230da\351\3020\016\365\212\356\273t]\270\313\341\373\242-\362\341\2404\036\201.$\202\002\030\311\0260\020\333c\213\236\241\222%\022\333aq\231$\272K\237[L\016\351 \244\261\230$\"\335]4*\177CI\244[\034\276\257KL.\225\303\242Q\231\001\2314\302H\327\205\273TBP\301\320\205[\2678\004\002J\2720\264\360\260\250}\321\"\211\226"
+	.ascii	"x\327\027\b\273A\313\026\026\302\303\022 \270CFX\231L\256 \004"
+	.ascii	":\201\302\304o\210\210E\257\250\200\027\371\"Y\344@\002\016B"
+	.ascii	"\032\221\306v\310]\361\272Gb\021\221\347\035f\030\"zS\0309\034"
+	.ascii	"J\337\241\013\267\b\277,\013,\260(\036\223\303\241\225\305\013"
+	.ascii	"\0279\034Z\227\255\213\224\370{\207\027\022\221\001\3143d/$\002"
+	.ascii	"&\022-\341\267\304;\204\341\302DC\031` &\217\303\341\220]\272"
+	.ascii	"\310\027\311\341\220}\227\356K\204\034\016w\021i\204a8\\\337"
+	.ascii	"!\213L\032_\343\321\035\016{\360\020~\215\307\236\013\211x]e"
+	.ascii	"\021\354A\321]\266B\257\007#^\330\330b\004\0212\310\003\030D"
+	.ascii	"H\343\321\203\020F\030\216@\002\214\021n\221\350HD\032G,_\242"
+	.ascii	"\021\003\200a\270\310c\213\\\026[w)\004+\207C\016.\334\245r8"
+	.ascii	"\\\341\327x\034\016\327\026n\213\303\341\352\306`|\207\303\025"
+	.ascii	"\006b\362\250a#2\005lD\032\177\220'\024[w\271.a\025D$\321\t-"
+	.ascii	"\334\242(\266\356\212\344\262\b\005\017\310\023\202\027\022a"
+	.ascii	"\204a\270K\367XD\266)\030a\030\256\017\214\004\312\357\220\350"
+	.ascii	"\256\200\201\330\2668\036\333\023F\030\206\233\301\b\303p5\374"
+	.ascii	"\016\215J\026@.\nWY\364\3020\205\n\026?\227\210l\341\027i\334"
+	.ascii	"\360\320\205\024\032iT\201|\211\253Q"
+	.string	"\371\246\357\360D\211\024\277\023%R\364Vb\tcz!\021/Q\013\017\357\220\205b\317\322\205\337vh}_wY,\266\254\353\242=\262 R\016m\242\241\013\267\370\022\265\330\357\320%\032]\270(^\242\026?w\350*\213^x\211Z\364\\e\021\374\022\265`_\242\026\251{l\211\257\232\\\272\022\330'P\230\200\207%@\200\221F\366%J\032]\270K\025\032^\264+N\240\360\271K\"\270]\272\312!\027\376\301\027\022A\244\034\032&\227EADb;\342]\272.\214\313\342\006\356p\305\007\"|0\002\221r\210\350\230|\335\245\357\035np\207D\312\241\337\n\037\211^w\0052i$R\016ip\207\310 \343\261\035\n\221A\306\243\211a0\206\024Tp\341vEQ\261uW\264p[\354\001)\217@ \345q\030\203\020\f%@\320\360*\223K\024K\267htaDA\244\034\342\tj_0\3020\024"
+	.ascii	"#S\020)\207\202\356P\230\002|!\021\257\020\334\016\r\241\357"
+	.ascii	"P\t\344\003\303\270\204[\026\204l\211\037\374\016]\270(\\\270"
+	.ascii	"(X\274h\227\310\023\366\206c\360\007\316@4\\!\271,\n\362\201"
+	.ascii	"a@y\\\270\205_\225\004\254\024\nI\220X\302*6\300@@\344\tEG\245"
+	.ascii	"\322\204\017|!\021#\220\311\241\241\022E\371\035\302\200lM(\266"
+	.ascii	"D\0300\266\320\360A\213L\242E.\321\"\223hs\2116\223\200\221K"
+	.ascii	"\300\310$\212r\t`\f)\034\225C-\013\"\261\345q\337\006$_H.\213"
+	.ascii	"\202zn1\311\002\234\\\252x\333\024\222\313\242 \017"
+	.string	"\307d\322\204\241\032\2044\006\241pl\211P\270/\321\006x\b\303-\"\215\303\227h\034j\221E\305!\207\327\b\303D\020Q\013\027\305\t@\244\021F\313\002\220r\005dQ\261\007\303\333\262\360\032a\230H\366\\HDrY\0244\342]&_\244\373\002_\200\221\356\220\353\"\311BrY\024T\001\220\3628t\227\355\213\342\262\025\312\260|\201\206BAF\241\241\373\022\r\223\360/\006!\236\030\204zH\220(1\214AhC\211!\f\224|;\274h\213\206I\236\027\311#\320\322u\341\002\fDW\210\030\314\340*\213`\r\031X\244Q\371\016_\264E\032P\2640\036\333\023\311eQ\020\007\037\345P\b.\032_p\300\300\257g\231\204\333!#\374\272>0\222(\211,*\362$\227EA\017\024]\230\350\302.\2127\271,\n\n^H\204\273L\022G\020\177N@\340\022\035[\027Cd\322\b\023\335\3452I\364"
+	.ascii	"\023\207A\355;\204\333\026.~\336!0\006\241\341\213\266H\030\203"
+	.ascii	"\320\260'\006!!\"\234D\302\027\022Q4*G\300BA"
+	.string	"\306#P\207\023\320w\bT4*W\025h\n\024\005Z4*S\030iL\252P\022\025\221\306\007p\370\275h#@\304\242hT\n\221F\026`\023E\243\262\007&\272@@>\360\322U\302p\207\360\321\b\017\221\311\030\214\313\244P\007\267\230d\241\b6\272h\227(\030ad\313\363\302\003Hc\213\3022\t\267Kw\303\212\027mQ\206\243K$\232p\341v),\006\365\024\217I\241\3275&\225\260\373vp\207\214\260\257\250=\272\305\337\006\237\027\351*\207\222'\212F\025p\333\302\205\0172i\204\215\305e\373b\231<\241\350\272@?/\332\242!\217/\006\241a\211\367m\225/\222\307\fEK\327E\222\350.\207Bo\273$\n\205?pR\350*\213\340\036\343/\b\331vx\2150Z\016Hc\033\224\341\035\032\026[W\250\205!\231<\016\227.\322\330.\341arIl= \215mPO\206er\271t9"
+	.ascii	"\001%a\"\342\2208|[\264\032\\e\021<,\261t\341\243\021HC\fBC\244"
+	.ascii	"1\006\241\241\245\013\0277\270\305$\013H\227\270tU\274\360\001"
+	.ascii	"6\016\031Wp\217AH\023\034\220\306\026\205\f\260\373\272+"
+	.string	"\226nP\220q\371\302\213\344\361h\342\230\\\302\310\344\t!\"\222\250=N0t_\"\r0\332\243\273\034\276h\213\206E\027n\227A.\2144n\210\301\270l]\244q\005\370%Z\n\301>*\322\330\006\371\\\"\262uQl\213A\230H\t\023%\207\032V\030I\224$\016\217G\2278\034&a\242\226\303\020F\272\306\027\331.\341\016\360\233L\266\030\002\001mw\250mA\371\033R.\207H\343\020\260\350\272\312w\b#\335!\370%\272@\261\375Y\213F\245\320}[wID\032\335c\321\230A\371\016]\270=&\225K\027F\032\341v9\204\321\016\r\201\2002\300\306!\343q\350\302`T\276C  \3412\t\023[\240\241\020\234L\016\275C \240\236\244\022\206;t],\211\210C \345q\210,*jp\211\355rxt]\270G\236 |!\021#\202\224\017,\335!\343\013E\367\001\027.\n\027nW"
+	.ascii	"{\220I\343\273t] S\f\275P\221a\350\205\212\242KD\026\275\310"
+	.ascii	"\006\270/\221\020~\227D&\270/Q\260h\t\273C\356\321}!"
+	.string	"\003<d\337\240\366\205\244q=&\211I8\271T\001/\223\312\027\331._x \b\331\266\200\215&\300I\241\027\205\373\022\361\270p\213\251Ktl\035"
+	.string	"\273/\020\220\013\356\261\230\342\330\302\306 c\361\001\244q\350\347\036a8\271\024\202a\264C?x8\002\t\030i$\332Ed;4\224$\"\215C>\030I\224<\341\036\223*\226I89$\274P\004O*\335\345\b8\231\\\216\370\275\303\023C.\374\026\275B\030n\021\231\242hT\362\2700\302\3046\203[L\016\r\203\210Z\270E\337K4\302\257\021n\341w\b\303\333\302<BD\330\370\202\305\233T1\202{4\002%\227*\\\270]\376\300@L\036\211K\327ErH\244$\006\335!\343\013.\261]\242\200ta\351\276H*\037X\266BD\275t\215@F\030\351\026S\024\227m\262\005O\fB,\270\257\320\352\302-\314\002\2314\302\355\222H\203\013\267+\334\030\214CFX\351\302O\020\3228\2644\001\003\321\b\263p\217-Z\244\233\001\036\222"
+	.string	"#\215D\354I\2208QA\003Z@a\023E\004\031\201\220I\342\b\244\261\035\032A\\\276#D@\340\022\271D\fp\221\306c\261uQ,\335#Q\321\025\"\276\017\374\027\302\tk(\225\325e\2154\306\206U\326i\322\b\327ha"
+	.string	"\207\n\336\0225\027\256\t\366\270Aw%\313n\377\3027`\226\360n\314\333\f4P\362\220\2644-\267\337\023\033ZL\2544\271\306\272\322\230\t>a\255\334mi\3735\371\3255\231q\231\037\223\2677K\246\2347\023\262Qa\306q\334\003lS\247\205,\353;@N\bF\bF\250\206BA\315u"
+	.ascii	"\246\213\027\2271\027\252\375\213\222\233\2723Y\013\305l\274"
+	.ascii	"+`h\262\026\206\371\02752Y>\336\366/L[b\235Ty\211\021~\371\315"
+	.ascii	"\230\262\004\210\227 \330\222\246$\272\254\205G\234\210\360\340"
+	.ascii	"\002D\372\335)R\347D\033\013r6\247\214\360\f\013\034\2578F\262"
+	.ascii	">\352\024\232\001k\2300\307\024d\313O\254W\365\254\003\323\202"
+	.ascii	"\266\346*\bS\3261\217\220\216\333\223\234\374\204\212\215\251"
+	.ascii	"\262\236\324\2257OZ\204W\330\330\304m!\243\222\2658\217H\215"
+	.ascii	"9u\230\2339u\254\230\331mbn"
+	.string	"\214\210M\371\265\201\232\323\022\266&\235\313\341\025\306\031\2243\223\247uFX\345\247\025\2435\272\304a\242\022\264[m\270\201Kk\376\354\302\244as\323\364}!%Q\373\202\003\206)e\312/\n\226\260\264\243\254\2358\021Fa\363\365\344\302(^\302\255'8\310\274\240X\035\221\2414'F\022]\032a\227o\215\357\253H\022%eI\222\b\271\230\230\027r\t\231D\201\315yar\341\022\035cN\312\302\240A\300\310\220\022*\361\235\241Prl\2749@\311\336\332\022\036\371\335]h\344\302#i3N3&ka\2214\216\225\0333\274\320<0&UB\262\276\003|\354!C\204Z=\2438\236s\246\025\244S\213\322\224\223\365\035 \005\004\2100\bZ\301U\0343c$5;|UMqV\302 \3017/`9A\263#\f\215\211\250\204\305Q\022\207\003\272$F\342(\306q\3169\205\214\210\033\001#\025"
+	.string	"0hH \220JuQS\017\024"
+	.string	"\013Z\262\214zJ\246O\364$U\b\241\021\200\031"
+	.string	"\210"
+	.string	"\220 \240"
+	.string	"\004\332\004\017b\361i\302\201\336\220/K\310Gu\347\034?\312\206Z$`<m@\351\270\213\251\260akW\270\333\204\017f\312\212\261\244\271\276\320\232\\\001\231\230\302\177\350\\\360\200\357\372\347\362\351\035\244\020)&J8\234\203\255\363\375\343\027\371\255}x\337\3650\254XK\310>\005\351V?\023\240\340\241\203r\226\377\331\0362J1i\321\320\200\3411u\001\223\177\353d\231\371\300E&;\025]\bX\233\207\0258\344P\314\246u?}^\316\314?\30195\266\346"
+	.string	"g\370U\nmT\267\224\265\275\324="
+	.ascii	"[d\262\032U\201~g\24617e\234\342\312\211H\004V\212\301\2638\265"
+	.ascii	"\250\025\021\377\203\343<3#:-\022\360HHg\276\353\236\325\016"
+	.ascii	"\311#\326P\024bm\370_\001^[D+\013\220\215\317\t\323\321\260F"
+	.ascii	"\370I`/\265\020t$s\004\353\307\262W\345\304t\235k\376\201\023"
+	.ascii	"U?\333K*?E\264\356\210\370\271\311\263\323!\232\343\201(\211"
+	.ascii	"Y\210\335KIn\260\247\330\372R\035YS2\3701\333\317\352\032R\223"
+	.ascii	"\036\363\247\271m\tT\177o\277MkN\227\222\307\317\336}\206\350"
+	.ascii	"\342\230\216X\032\205\3003\020<\256l\304/\250\252\256!\333\205"
+	.ascii	"r\325\314\224\367\3244\017\205a$\377\353\025y\274\215 \364\006"
+	.ascii	"\252v\036\326`\371\3268\332tr\322\271\003\204\027A\"\351\235"
+	.ascii	"\302!%M\252\315\277W<2\f\362\306\250\310-\026\361}\r\360\024"
+	.ascii	"Iz\362(\2530zV\233\272\234"
+	.string	"s \"Q\247\002\200\212\031\267\252\315B\030\313\034o9\035\204h[1\317\033C\241\274\022\336>\203EN3\357\313\347|0f\266)\203%\266\213?h\342z8\310\177\302hH\2741PO\036\230\315M)\0068\363!\375&\3543rd\211\344\274c\246\347\030\263y\346V[1Wu\r\022\226\215\270\337\225\200\371\246\006\225WF\320d\355!\251/O5\374\373[7W\334d\"h\314\021\273\305\373!\263A\346_\332*X\002D\246\023S\204Y\322\t\356\2355\323\315f`\354q\354\375\2307k}\001<u\251l\327\221=\017;\024\017\262@\232\030!\375\3569\346*!\312\356\230\245\264=I|\215K\211\033\213\220\206\002\n2\3329\235\\xO\254\257\362\250\346R\203\"K\377rb\261M\242l%\345\361\233~\307\202\202*\275\247\362\022\373\025\362ZY\367\204\351\\\303)\267\333\322\202\376\263\337$n\253"
+	.string	"\032r\311\375\027\326\2507\215\023&O\242\274\250\266T\345\322\r\360t\227\236C\201}\267(\301\210\003?a\350p\312\207'\312\223{\201\262\252\305H`\022p\316\241\332\"K\203\022D\257\022R\250\334\223\215\340Q\205\275(\002\321\257\024H\347\313q\311\321\\l,-[y\364M\216\f\f\250O\241\227,\355\211mc\030\020:X\023\244LA\336\260n)\t\205\222tb\200\356\347G\313\306\340T\257\374\207\212\253<\321E\200\241\272\353\037\246\002\256q2_\343_\234} \226X\246\343\250\206wT\307\356w2\237\027\234\346\317\320\033\322\254\035\240\201\r=O\324\007\206\301'\350\375Z\223@\b"
+	.string	"C\254\030\245\357\"\025\207nX\2671$Ml\25430K\300)\312\276\3231(\336D#\277@\321\303\213\r\337Q"
+	.string	"H6mYo\325\034\327\216\370Z$G1\230\240\036\027\245k\3353n\336\373#R L\323\234\326S\3433e\3126Z\311\242\200d\r\274%U%\f\262\266\212\356\377\033\361\366A\337\004\242\322\313\345U<\034\215R\025\007\260\037\263\350\343\3216\347\214Iq\352Q7\370\375I\2326\256@\304\271\337\222w$~\2250^\361\350\306X"
+	.string	"\271\2513\223\004\017\223\260v\343G\007\001\255UZ\020\313\360\001\326\220\321\372\f\310\021`\033\307\363\204,\315\f\336\316h$\016\312\200"
+	.string	"K8\201\252&\355\261\350\001\310{~/q\220F\326s\210\330\272\036KF\220\bYQC\241\333\304"
+	.ascii	"~\231\3248D\033\377\263\305\315\331.\226\333\351*\220(\353"
+	.string	"/\2050\312\335w\341\255\226m|N\367\301\323\001~\255\370\201(\345\007C\323\262D\213\246\375\255\303\334\373\202\274\336d#;\224qW\347\355\003\372\206\177\242\343\360'\261q\036:\241\203\243\312\225\3159\021\332\351+\326F\204\031\327\n[)'p\347w\252\2270\036\356\3035\362\330\037\231F;\201\245\326\262@\220\346\257q!\262\347k\340\262\256x\341)#76\330e\373\316J\351W\314\034O\003\002\325\005\251;\177~\304\335U\320\215p\342\315\201#j\356\373Kq\336r+G(\220#\r\264\354\372\242\f\322of\316\224p\234\357\352"
+	.ascii	"\347}\032m\332\2144U\332v;(\346m\210\3662\327\216\330\220\226"
+	.ascii	"\237&\202\336$\345e\001"
+	.string	"\251\245\342p\313\260\342\240j\004\362\277kN\301b\247\245M#\270\255\240\223i\257F\243BP\365i\230\344\315N\345\346\352\203b\277\241\364\304F\276\236;E~\317g\235+\033\342\232\r\273\311\370@\263\275\fc\031d\307\026<\305zNvP&%\322\321T@\345#hW(\264K}6I7\244\272~Z\264\266\272\344.\350\227\237\2122\314\211\027\257E\220\353\255\351\336\356\021\253\034-\2774Uj\345\207\244$\231\210n\265YQ\327\364\356#\361\361 \236eB\252\201\345\301\023\310\204\325\335^\247\262\016\223\002\225f\313\360V%W\231\247\342a\305\344e\352g\324\t$\253\210\377\r[\271\330\350\304/\035\2226\262\346Q3\002\322\030\347K\263\264\233\225\343E\027/\227\224\037\177\200\326\007$\272G:}\207\370\226J\265\367\231!\006G\312\2150\252taR?q\202\321\302\2108|\231\202\367\243\006\330\311\322"
+	.string	"K\310>\363C\331\342\353\315\036\312\364\2433\202\250\211\314Cj\340\256\n\333\325\024N\256!\243\233\277R<\245\024\273\245\354\304\251\b\004QC\216\016@z\234\310-\311\340\233\370T\357\311\367\315'l\315g\231{\254\203\006m\264'\020A\221L\346\313U\301\307\326\017Lt\224\301\305(\353<\251\371L\304\305\237\245#\377\365])H\304\001\342d\201\323"
+	.ascii	"\361FR]\r\330\267B\303\237\271Mv\273\362\306\207j\345\265\222"
+	.ascii	"v\333a\235\024w\037A\313\306\274\303\303\217\373+\013_\273P\031"
+	.ascii	"\334\225\227\306\r:\270\n\373\210\3711\304\3106\214\242h\261"
+	.ascii	"(\305\256\306~\033\n\341t\333\201\213\377T\271\017\304\027hY"
+	.ascii	"\232\204e\337md\261s[\001\2257\004\331\214\n+\233\377\246\303"
+	.ascii	"\254?\n\241\376qjOs\005\001\210\274)r\237\232\215{\005\2676_"
+	.ascii	"\310\251\375\254\024r5\340!2\216\247\346\316\232\236\334:\220"
+	.ascii	"BWHX\270\222\033\214\016\002\r\234\345\022\245\241\301\324\345"
+	.ascii	"\330\372\004\321\031\243\237\034\260\365\204\272\017r&\370^\260"
+	.ascii	"\334\233\251P\033\233\027\335Z\017.5\313S\336S\317\033\302\267"
+	.ascii	"\307g>\362\261\fh\034\212m\361\311\247\254\n\253\374\265<\370"
+	.ascii	"\314<\365\201&{\002\020rb\322\332\314/\"\003\222\333\354$\004"
+	.ascii	"\3634T\203F9\355\356\276M`{#@\032;H\007OY\306\214vT\315\271h"
+	.ascii	"\321}%,}%s\027\301\220=4\363]w\356n\342!\254+\234w\211\272{\373"
+	.ascii	"\002\001\377p\252\215\377KM\245\333\026\263),r\266\323mDqpAj"
+	.ascii	"\373\301\n\374S\3627A\026A\2776\267}s\324\003\237u\232z\325\242"
+	.ascii	"\325\224{\241\003"
+	.string	"\343\235\232P\273\365HR]{\036\032W\324]\3364Qc$\207\001pq\357\032\341`x\001\317\323\005H\363\225B/\211\224\233 \270\262^\250\201>vZ]\301\326\263\035\366\323\302:\001\225\216\220L\2134\200^\272\310\357XP\351U\323K\005P\t\202K?\316\360\251\026\356\307\343e\371U\340~\212\222\331\250(\260\337\301\034\037;\261\235\360\037\310b pJ\322\313\347(\277b\340Q=\217\037xQ\267\207\262\367Y\034f\006\265\232\254\001\3360\214ke\234\033\"\2028\345j\005yh\230\263A\021\016\301u,\253D\310EG\rC\332\t\243q\252\325\330\321\027\274Ah\b-\304\337P\374\201/\265\304\356M_\225\303,\353@<\274\025\360\207\271\302A\027u8=J\031\227\373>8\244\245<\307\004e\354\372\251\205\270(\212\361\217X>\250;\331\007\003q\217\007\261\305\354\272\315\241\247\260\017\346\336\354\253"
+	.string	"\205\243'6\024M\313\255\251\232E\375\275\310<H\360\352\321B\227R\004\217D\t\016\240\326\225"
+	.ascii	"\326\300\b\020f\342\262\362\n\262\361\234\255\272I\252H\337\006"
+	.ascii	"\205\217\002#i@u\211\024\324\315T\320!\006\\\022\2310\034\034"
+	.ascii	"\273\250\205\202+\027 \314\276\"=\224>\226\264\013A>\035\016"
+	.ascii	"\336?%\004\\w\356\027\251\331\306\213\022V\271\305\301R\317\257"
+	.ascii	"+B\021A\006ZJ\367\034\267\370\321\236\355N\226\276l\317h\027"
+	.ascii	"\204\300z\326A\217\215f~\271D\252\360\375>H\177\314v\276\304"
+	.ascii	"\264\030\307\357\2373O_\345\224\264:\260\347\317\\\273.GM'\256"
+	.ascii	"\202\033\247\024u\371\3415\263g\241\264\317\032D\021&\305\321"
+	.ascii	"\242A\0030\227\370\344\035\020\350\200)\245\006\230\200,M\022"
+	.ascii	"\307\306\310\032\313\370\302\236\315:\212J}\036\373[6\007\017"
+	.ascii	"-\001y\r\210\372\363\235@.\027ot\002E\027\301^#Q\242ZG\300\003"
+	.ascii	"\246\326\205\213ne\361\361C\211\350.X\005R\277\323\303\3573N"
+	.ascii	"G%\177>u\355\223B\215\300\342\251@zf\312$\217\320\327\353\r\337"
+	.ascii	"\255b\230\373\t\305\003A\227\363\021\345\336\333\327'`%T\252"
+	.ascii	"\316\336\353m\326\276X\270\335\275\370\212\346\304\202\3011,"
+	.ascii	"\372\275m\003\226\216T\233M\316{\2362\373\004\251d\372O\346\214"
+	.ascii	"\303T\020\001\334Z\035\367\253\347.\351\261\373\005+V-\"\264"
+	.ascii	"\212\252\037\177A\333\216\312\323\227\241\343\005\255XQU\372"
+	.ascii	"\225W\245\377j \200\334(\373~\377\246\306\267@/\210\301\r\344"
+	.ascii	":\b~\205\204\264\260(t\265\206\251\2044\241\177Y\241Qg\332L\270"
+	.ascii	"\300\253\023\232\332\237\360\361s\313\243\005\203y\301k\bP]m"
+	.ascii	"\306\320c\224\345\373<\256\364\361\325\334m\216\267\201\363\245"
+	.ascii	"\267k2\273\032\375\016\352\337\376353\200\312\220ua?\236\267"
+	.ascii	"\233\007\024\207\215(\033\310%6\026\250L\231t\312,\001=\0239"
+	.ascii	"\346\253\342\250`\252\307>F[\006\2179\350\022\333\370\365\301"
+	.ascii	"d\016\210\341\001pV\026\350_\302\210\003\311\343\312\305\300"
+	.ascii	"\036\311&=j\376\270i\331\372\353\030)\022\377\314B-[T\332\004"
+	.ascii	"\314Jx[G\020AX\026\370\325\250\356\035\002\252\037 \307\032\203"
+	.ascii	"\005\214\214E\317\312N\266\272\373\360Dl\340H\330{e\315\r+{\317"
+	.ascii	"\213\311\260mX(t\377\324\212d\365\2416\340`S\202\264\253p\005"
+	.ascii	"\001y\215\366\244\\:\254,\032\231z5\312\263>\361\376\361\302"
+	.ascii	"\rR\027\324\375[\246\215\016\300\fg\356\0230\361d14\372\215\251"
+	.ascii	"R\033\253qj\315!\376\377\026u\277X\211\033p\344\261,\262\204"
+	.ascii	"\035\2732\230\260h\035b=\230\320\375ckb%\232\337tb\204\3766."
+	.ascii	"\201b\023\252\262\316\274\353,\315\373\353\245\320nY\226\201"
+	.ascii	"o\235U\320}\213^\263\247\247\231\3751\016[5._\004\001\241\304"
+	.ascii	"m\224\203\250\250\341\020\353\343B\215\302\027\361/\b\251\217"
+	.ascii	"\n\357$'\025I#\316!C\266\346\211\271\225m\na\001\372Hw\242\337"
+	.ascii	"\275\233\345\2620\250@C\300"
+	.ascii	"bG\323>\316V\223\326\231\222\315\324\336W\3513q\327\031\356u"
+	.ascii	"\251\275\350\032\334_\017\222\031<\027\265\037\200Q\311\243\314"
+	.ascii	"\367\210\356\203n\037\272\352 \020"
+	.string	"\b\254\331\231\236\003l\177tJ$d~\005Q\256te\026\224\002\305\2554\220P\3036`]\267k\214\205\275\263\355p\022\302;\031[\204'\203\236\034;\023\306\220\373?\350#\330}\246\274er\210k|\276\363\256k,\313=\357\031<\240\347{Z\343(\356\340\341\007\372VN\336\002\300\267\301\337\370L\b\303'\224\001j\321r2\314\244-\364\b|\331\355\316\t\235\225\3236i\320o\336\317%\257\021\331\332>\225\nG<\226\223\265\215\tr\267o<\022\3446\243\225\331\220\013\0041\264oN\370\317:\033\250\n\317\354C\003\354\200Xn\344\224 J\024lQg\266\316\206\206\234\223\200\2147\376\203\306i\210\200\223\005\304;\2418\\\237\327ob\270r;\334\227\361Y\325\371\266\214\234\026w\221\236\243\007\277>\307r)\332K\242\356H\236\022D0\247\2024U&\020\303\217BAD\320\036Pl\337\226\253h\263"
+	.string	"j\226\330\227\366\034"
+	.ascii	"}\006M\004\315\240\372.+\326\246=\246N\021\320\t\324\025\237"
+	.ascii	"\223\306v\345@\"\263\235\\M\235{\372\272\225\336/\321Gnf)\300"
+	.ascii	"\302d\265)\024\310\341\260\034\203\326j\371\262\253\202\325\335"
+	.ascii	"\255\024Fh\200&\243~4,\2171`\374l"
+	.string	"S\300\362\006\036\225\205\215F\330\372qcP,CTD\320V%\272\213\031@F\230\303\342e`%\332\017\371%<\313aB$j\212\215&\r\345\374ZZg\252\036\274\271\211\317\226N\2411\020u\311\354\243\365\304\001MHd\3343\023Hh\365>\335\261\031;%i\271\035\254J\203\373\243\f\255\274N\216\221\242\003\235\356\3331\002\225\326j\013\2513\177P)\031/\247\257\265\341Q\354\300~7=;S|)\tk\224\252\035\034\022\211S\244J\336M\310\264\205\354\274\303\240\275\"\375\263\262a{\324\336p\027&\250\023\334\211+\r\257\314\356\235\271\243@\3415\263\361'\314\277_3BP\363\037\361\345[\317\251\032\200\377I\234\267\2627\2458\272\005\321\027\272\264\\\240\325\032\242\023L\001M{I\324\fw\331;\210\262F\2318\373\025\0043'\256\345\212g\212p\t\375\0322\3323\2637\332\213\020\266n@Y"
+	.string	"\323\350\277\252_\027F7W\207\252\030\253\305\364\331.\2521\b\266\020<{\201\275\374\205J \004\227\224-Ig\303#\243\"'&sb\374\336,\351"
+	.string	"\217C!\016a$\264[\251`s\357\226\2067W\330e\274_8\227\207\\\023\210\202zG\211`E\301t9\360\035p#-\220\217\232\233m|\204R-\261\fi\261\301~\213\026\265\343 \2009s\326\223\235\217\214\273\244t\324\317\352)e\225s\325d`j\201|\324\036g\237$\035\3105m\226\241)\267!\250\np?\0209}B\327}T\205\357\311\022Bb3\250\350\377\313\273\204r1\271\264\340\301\337\007\016\252\320m\304"
+	.string	"\353.\003Cr\b\377\013\300u\237' |\264\234\330k\375\341\262\311\303\337I\254\202\026\006\254a\205J#\306,Lw\002X$\332\341sp\211\355'6\"\035\326\"`JsE12\246!Q\215\211G\273\264\325\r H\260\224\342A\362\275B\327\024\n\371D]\250|\331\266s\330\345\r\3457\200\200\256\252\311\3573\2736\255@\022\250\202R!\233qz\025<\315M\314,\365\213Pe\"\003\007\001\315\013+$\036\271\224\263L\017!N\304\3777\177\354\314\\\233f\224\263\231==i:\360k\236,7<\254\b\016j\\\217T\342o-\3334("
+	.ascii	"$fJ\006\006\216\370\205#Q9h1`\225\314\024\255 \032\324*\200\023"
+	.ascii	"Z\023\3216\334\344\245\270\307yL\013\317\345\326~\345\310\364"
+	.ascii	"9."
+	.string	"X\244\033\202#\363V\327\025\025>a\263\005\b\304\212Nd\373!\231\216=\217g\336j1wo_\360 c\370\374\203\021\255\351\340\363\3719A{\n\256\222*t\263/\236\377z\375'\233\307m\340]\253\020D\033\033\275J\321\300\034\305\272\223\323\321\325eF8h\270\003&N`\234\313~\302q\230z\256L\245\\}\345J\357|aNG\\\251+\271\237\247\251\265\347\230&\347'\320\350\332\333\360\324\340\310\n\017\241\277%\211\004\200Nj#`\232[\265!\002>{\346\2551@v-p\363q\344\343\263\377\375\315\274\330\352\004\232\031\3621{\275\301\013\307\2716\331\237B\211\3079}\261jv\241v\312\330\3760\253\355\216\317\236e\203{(\320\264\025Nn\375v\342\214),1\3577\253\312f\373\322h\355\025s\360Tpv\361\244b\317:\201#\301\376\305Y\034A\030`|\226\245\036\254\004\202y\313\367\350"
+	.string	"\006\275\201\"\374\223,\177\226\262\2059\rU#\035\336n\210\216\2742\302y8<\331o\2103Z\017\351\235fQ\2067\206\243\272\033\245~\226\233\3303\004\210m\336A\263\016\026\224x\354\326)"
+	.ascii	"\360\236\310<\373\343o\346\203\330\225?\307#\352\220\337\003"
+	.ascii	"wC\257\027W\367o\241\377 \005`\243\232f\304\315\240]H\277sq\252"
+	.ascii	"9;(\325:\231\007\242%P%\033\033\203\001\372x\234C\275q\3523\372"
+	.ascii	"s\036\373\247~\033\311O\226~J\3306\200DW\377\323\222\336WS2\306"
+	.ascii	"<)\261\224H\243\310\214\340\244b\241\244g\fr\302\016\364\016"
+	.ascii	"^-~\266\262\225~ \214\355\377\244k\023\355\246%\3023tBg\271\007"
+	.ascii	"\374e\266\371G\006H\353\3522\375\321\317\273\337\322\272\245"
+	.ascii	"\201(\\\375\2258\\}\363T\fd#a6\245y\374\273\200M"
+	.string	"F\276s\212\300\304R\316u\032\244\201\262\020\314\362_\260\250\3215\275\3519\300?\023\370\260\031Y\026t\377\034$Q\321\316\317*o\236\016\225B\347s\273E\354.\312r\240\200\306\241\325\246\0171\342\212\2251\021\344lC\356\223\234\260ORL\202\r\315\331 \233e\354\004=\311<\311\271\307\207\267\2206\020'\216;\351\312\264\200\001\336\330\222?\300\006\016\360\rf\302<\331\367\207}V\004zj\024\326\272lja\205\241\365\026\261\330\\\321\026(`q1\223N\323\256\213\026\375\363\336Nn\350\336\372\277\360l\334\361\265gL\363\200X\247\224C\355\350M\353\003!zh\217\\\337?\312\214E\327\260\3557\310I_\2723c\032Xa\360\225z^\227?D\226@\226\375e\027\367\346v\310\316M(e\211+\256\t\260\305-\363\331Y\017-T;\216\353\177\373\336C\310!\3636[\270\352\226\261=VN\351\260\257"
+	.ascii	"9\355z\033\001\215\037\017\303jsf\315b\376\365?TV\017\267M\264"
+	.ascii	"\360\307\332K\231%\017B\2719\021\201a@\233IW\023\273\331\223"
+	.ascii	"\345\037\023\320\313\376\373g\356.\221\"\246yE\250\030\372:\350"
+	.ascii	"\352\332\353\332\203P\277\267\034w\003C\342P\307\234\246b\265"
+	.ascii	"Ts\013\006Fty\254\201J\022\235F\253C3\203\361N\357\210%\203\024"
+	.ascii	"\232Xd\356\b!\025\244\314S\307\351\023#Vr\025\262\233\021\002"
+	.ascii	"P\230\277\252pK\257\200\365n\007\354\306\254\005\034\371\030"
+	.ascii	"z2\367\221\367\352]\377A\254I\016)-dF\350\211\225\003\246\215"
+	.ascii	"\217\320<\001\0135\264v\252\311\241\324\310\251\201R\271\247"
+	.ascii	"\222\201@\372\257\021\336\254Rk\025S\265\021"
+	.ascii	",\267$D\245\2379\005\305\354\364QG\277\371\246\324\336\017\251"
+	.ascii	"7!\306Cq~`\316\f\255Y\236\005\302k3\302\301\221\331\326\006t"
+	.ascii	"\253\031>\332`QH\017\034\\s\374\0213\374\216\037\234\327'\276"
+	.ascii	"\225\235\220\343D4\tLb\272\214\323\210s\214q<\334\004\330\343"
+	.ascii	"\017\230?\235\254X\004\205\366\313\035\270\204\364+y\261\f\255"
+	.ascii	"\206E\322\207\n\367\317\254y\333X\305\347\223\026\006\224\231"
+	.ascii	"\226R\342\365\215U>\002jf\320\366Q\351\231\222\370h\002\231\231"
+	.ascii	"\020\025\202\210\233\354\265-<\347aC\311-\314`\340\315N\321\346"
+	.ascii	"\326k\206\023\336\201\337\276!\204\325s?A:\027H5\013\247\316"
+	.ascii	"t\370ha\004\001V=\365\352\263\212\003+\310\202\354\003K\241D"
+	.string	"\300#\361[\234E#\253\236\245\257\317\363\200\317\023\203\310`6\242g\324\006\347}\274\344\314>\374\357$\013\364\352_\255\030S?\330\247I\265Z\307\334\221\033\205y\032\253\244z\214\t?\222ZM39=\226\006\267w+\371\262\305\341\3778\3610P\347\b\0354!\025\356\346@\021\350\330\230q\356\356!)\2275*\222\345)\005Q\313\322B\357\332\027E\r\206\345N,\270\333\037\307\317\201)\325q7\277\376\255\354T/\325(\271\262\302m\264\300\0061W(\241\344[\301GQ\300I\264?\364L\220C\f*\341\020(\372\360\356\347lV\216\204\323\365\350\212\272\347\212\f\254\022r\364\252b\251\336q\3113\250\341\343\332\311a\330\207\027Ep2\266v>~\207W:H\340\021\026\304\035\346\177\321\333\027j\332\027@o\024\233\203\274\025]\324<\211\360,\315`\346\033\033\275\0355\261\261\345\325\002\037\200:\022\320r"
+	.string	"\322\364\237m\213\311\002S\304\331w\254\375\201\355\267\334\330\r\t\322\355\326\301 \231%$-\005Xnr\033\b\236\345\253\242'Ta\346}'E7\326\326Q\016\005%\214\266J\301\244x=OQ\240\027\f\216\272\"\201\240\026h\343k\227\230h\375bt{\217\211\206u\006\307\375?p\343Kz \376\034b7\2645\023\220\250=\"x\001\233"
+	.string	"\020[\366\r\373%\366V\273\016\013c\243\274\n\277\035\306!1Q\2560\260\355\005\302\250\027\312\b\307\203\274\236\356\341\340\001\353\t\031"
+	.ascii	"\220\001q\336\210Q\211\001\177s\333\b\354\002\327r\203ng5\337"
+	.ascii	"\034/|\365P\022\333H\270\3218\024\2223+,'*\212\220lj\3232\352"
+	.ascii	"4\t\n<\370\302\"Jvc\021\363@\324Q;R\344e\003ja\267\220\322\251"
+	.ascii	"\334A6\035u\245p\365\222P\317\261X\371&\2230\024\245\037R\214"
+	.ascii	"\340\244\213R\033\361j\0346\340\027E\302\213\330I\305\205u\273"
+	.ascii	"\033\241\302\007\357`\306\323%\037\362H\024\3175\225GI\243'\311"
+	.ascii	"\025\034\361\237;\207\034N\307BY'\372\317\257\234\206\250\273"
+	.ascii	"\245m=U\302\372\204\352#=+\333X\243\255<\344p\021\2243N\213\017"
+	.ascii	"Q\252l\360"
+	.string	"cu\347 \367\232-QPP\262Z\345P\022?\320\341\331}%\340\214\225A\\\252\225\021\030\021\034\300\002\350\025 x\020\347\323Q\376z\306\240Ew\030\340{\035M\236`\266,\306\200\373\036\242\205\214\271\276\031\303V>\001\307\305\201\246(Eb(\n,1\300\376\225\304\361)v\302\364|\202\033q\234\322\351F\375\300:\013\351\224\370,\277)*y\006D\236\260\213\206V\324\\\021\201\364\0252)\n\254]\273\267\371J\364a\027\345\003\355\202g\316\207\316d&\253[\254\3437v\b\021yUEo\337\353\363r\326\274{\224.\311\214\005\213C\342\260\264\001v=_\013U\301\364\311\347A\210(-?\005\273A\370\002\302\365\340M5\265]\231e\032{\257\355F\213$\215\n\"e\336n\273\256\230tM\321?\027&Z\272Zc\035}\267\\W<\242\"5\266j\212A\344\362\260\337\200\370\225\302\242\007]\362X"
+	.string	"(\r\326\032\216\273\365\374\227\351\337\304\375\340\3046f\002\f\212\366C\330\343A\035"
+	.string	"4;\r\271\360Z\344\033\302\241"
+	.string	"3(\257Xl\356`\026\361n\213\247x"
+	.ascii	"<\212\207\225_\317\002?\204\336`\344K\305pNF\247\376W5\324\313"
+	.ascii	"\233\3475\306Rjm\0371\320\362\267\273\023JWA\313C\"B\347\275"
+	.ascii	"[u\346@3\253\032\332\262\001a\300\324\257\030<\264e\345\201\307"
+	.ascii	"\211J\351\330\365GL)\221\306\034\220EH,H0\302\270\303\266\026"
+	.ascii	"[h(\035\262\353\216\375\007\031\203\034\307#\3052Vx4\027\346"
+	.ascii	"l\021\366\372\b\273,~\207\362\345\375\037\tf\236\340\025\362"
+	.ascii	"\210\317rddP\315_\353#\247C\037\034A\307T\375\240\034\024>\243"
+	.ascii	"\006\3107\350?\306\001\344\"\3019#)O\260\003\307G\317\001\252"
+	.ascii	"b\rA\363K\260\023\334\253T\233\357\351\n\211\240 \251\247P\222"
+	.ascii	"\316z\330\240\355f\331 \272\246\232\343\211\223A\230\305\t3\324"
+	.ascii	"\257)\277\266\246sg\232\364\2319m\312\372\254\005O\303\207\017"
+	.ascii	"\236/g\355x\024\226\260\325\245+\030@,\314\344u\017\006n \031"
+	.ascii	"\003D>\335\365\302\2760Y~~m\347\324\247\252\207\253\237\177\351"
+	.ascii	"\3353\306\310\225\270\355*s\262\317\355c\202\255\276!!\262\356"
+	.ascii	"\224vqGA*\322fR\221\344w\372J\031\365e\255lu\273\304\344\321"
+	.ascii	"\330\330\200\0018$\376\177,\272\301&U\203.\210\305\325\006E\354"
+	.ascii	"\025/Z\203\0259\375\n\207CO\243\033\334G\267\241\344Q\347[\345"
+	.ascii	"\0015\032p()k\334O\340\377\177\354\030\365\200T\233P{\207\323"
+	.ascii	"1\211\003Qt\031\307\2105T\177\211:\351d\226J1e\276\362\023/\256"
+	.ascii	"t\232\017\031\335c2\360\267\007\034\354o\334l\341\352(0\336\033"
+	.ascii	"\362\230I\302h\344\256\227@\336\335H)\017\344\035v\332w\bp\210"
+	.ascii	"T\007\331\013&\370\266\342I\312\363\356\352mxHV<"
+	.string	"O\230V\333\257\303e\207\310\333\260\377\006\233\007<oE\275\326\036u\360\360Z\304\313x\023Q\263\204#\371.\005\373^\311\263:!7\320\177\016:\263\340\2561bP\177\016d\211\031\276\215\234\241AC\376\026A\016\343\213\312\275\217\303\267\0354\276\002ZD\326\263K\313\204\354U\243,6{J3gv\272\035]9/\360Ala/c\315\230\206!\036{\003\270T\244l+y\236?\256\304}\372\023&G\350\371\277\243\241\230\230<%\370\"yw\035O \254\272\013(\341\211\360U\267\263\257\324\206\320_\344\376\323}\374\207\335\371<l^\367\371{E\345t\200X\336sr8O\202<#\304c\211wY\337\002\362N\334^\361\341\336\314(N^<\372n\3666=\177\017zh\321>\230{\230\216\331%\307\333\261\317|/\330\233\216\362\253f\277D\365\\\315x`h\327c\236\265\3667\365{\347\303\372\366<"
+	.ascii	"\210k\205\227-,\330\261\026\242\331%a\361\274s|\303\306\331\005"
+	.ascii	"\373\326\245\376\021mi\251\273\201\250\363\372\377\213A\232\257"
+	.ascii	"\007y\207\027|7\332\323\222,\3535\302\276\334\177\335\017\b\373"
+	.ascii	"6\221C\022>\3608\370\373o\277S\264i\332\212\362\216\366\376x"
+	.ascii	"\202\277\032\315Z\361\357\253\341M\234M/\t\307\207|\277\226\375"
+	.ascii	"\277\323\330\373h\342ue\016qzQ\305;\276}b\3167\033\355\005\263"
+	.ascii	"\326k\345\364\254\327]\270&\206\370\273J\353\3635/\327\005\367"
+	.ascii	"t\372\347}\310\266\034\345\347)n\023\344\032\221<\302\317Zk\346"
+	.ascii	"\032\372"
+	.ascii	"\363\323k\r\240\237\357\324\214\377\274\206\3218\235Qn\264\355"
+	.ascii	"\303O\016\304z\005\033\332\033&\177\322\277\362?f\261\0254\260"
+	.ascii	"j\351\322\023\026e\270\263\313\232\307\314\314g7;y\037\271\313"
+	.ascii	"\232\314f\b\204\225M\331\211[\276\317\273'<\226\267\347\034\232"
+	.ascii	"\230\333\007\345\347\2009N\345\017\364i\3502\375\337SQ\376\325"
+	.ascii	"\316\216\210\235\024F\270\261\205\307\317\273E\235\245\224\335"
+	.ascii	"h\356\370\017"
+	.text
+	.section	.gnu.lto_.symtab.61d693627d219c88,"e",@progbits
+	.string	"systemConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\005"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\005"
+	.string	""
+	.string	"getCurrentPidProfileIndex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\005"
+	.string	""
+	.string	"getCurrentControlRateProfileIndex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\005"
+	.string	""
+	.string	"getCurrentMinthrottle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\005"
+	.string	""
+	.string	"resetConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\005"
+	.string	""
+	.string	"validateAndFixGyroConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\005"
+	.string	""
+	.string	"readEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\006"
+	.string	""
+	.string	"writeUnmodifiedConfigToEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\006"
+	.string	""
+	.string	"writeEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\006"
+	.string	""
+	.string	"resetEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\006"
+	.string	""
+	.string	"ensureEEPROMStructureIsValid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\006"
+	.string	""
+	.string	"saveConfigAndNotify"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\006"
+	.string	""
+	.string	"setConfigDirty"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\006"
+	.string	""
+	.string	"isConfigDirty"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\006"
+	.string	""
+	.string	"changePidProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\006"
+	.string	""
+	.string	"changePidProfileFromCellCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\006"
+	.string	""
+	.string	"isSystemConfigured"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\006"
+	.string	""
+	.string	"setRebootRequired"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\006"
+	.string	""
+	.string	"getRebootRequired"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\006"
+	.string	""
+	.string	"pgResetTemplate_systemConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\006"
+	.string	""
+	.string	"systemConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\006"
+	.string	""
+	.string	"systemConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\006"
+	.string	""
+	.string	"pgResetTemplate_pilotConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\006"
+	.string	""
+	.string	"pilotConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\006"
+	.string	""
+	.string	"pilotConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\006"
+	.string	""
+	.string	"pilotConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\006"
+	.string	""
+	.string	"motorConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\005"
+	.string	""
+	.string	"pidProfiles_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\005"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\005"
+	.string	""
+	.string	"throttleCorrectionConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\005"
+	.string	""
+	.string	"gyroConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\005"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\005"
+	.string	""
+	.string	"pidConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\005"
+	.string	""
+	.string	"blackboxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\005"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\005"
+	.string	""
+	.string	"mixers"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\005"
+	.string	""
+	.string	"servoMixers"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\005"
+	.string	""
+	.string	"serialConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\005"
+	.string	""
+	.string	"gpsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\005"
+	.string	""
+	.string	"batteryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\005"
+	.string	""
+	.string	"compassConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\005"
+	.string	""
+	.string	"gyroDeviceConfig_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\005"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\005"
+	.string	""
+	.string	"modeActivationConditions_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\006"
+	.string	""
+	.string	"controlRateProfiles_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\006"
+	.string	""
+	.string	"imuConfigure"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\006"
+	.string	""
+	.string	"accInitFilters"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\006"
+	.string	""
+	.string	"setAccelerationTrims"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\006"
+	.string	""
+	.string	"failsafeReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\006"
+	.string	""
+	.string	"rcControlsInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\006"
+	.string	""
+	.string	"pidInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\006"
+	.string	""
+	.string	"activeAdjustmentRangeReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\006"
+	.string	""
+	.string	"initRcProcessing"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\006"
+	.string	""
+	.string	"loadControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\006"
+	.string	""
+	.string	"schedulerUseDeadlineQueue"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\006"
+	.string	""
+	.string	"schedulerOptimizeRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\006"
+	.string	""
+	.string	"pgResetAll"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\006"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\006"
+	.string	""
+	.string	"checkMotorProtocolEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\006"
+	.string	""
+	.string	"featureDisableImmediate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\006"
+	.string	""
+	.string	"removeModeActivationCondition"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\006"
+	.string	""
+	.string	"isModeActivationConditionLinked"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\006"
+	.string	""
+	.string	"isModeActivationConditionPresent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\006"
+	.string	""
+	.string	"featureIsConfigured"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\006"
+	.string	""
+	.string	"rcSmoothingIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\006"
+	.string	""
+	.string	"featureEnableImmediate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\006"
+	.string	""
+	.string	"buildAlignmentFromStandardAlignment"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\006"
+	.string	""
+	.string	"serialRemovePort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\006"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\006"
+	.string	""
+	.string	"pgResetFn_serialConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\006"
+	.string	""
+	.string	"isSerialConfigValid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\006"
+	.string	""
+	.string	"resumeRxPwmPpmSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\006"
+	.string	""
+	.string	"featureInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\006"
+	.string	""
+	.string	"loadEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\006"
+	.string	""
+	.string	"suspendRxPwmPpmSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\006"
+	.string	""
+	.string	"writeConfigToEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\006"
+	.string	""
+	.string	"isEEPROMStructureValid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\007"
+	.string	""
+	.string	"beeperConfirmationBeeps"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\007"
+	.string	""
+	.string	"mixerInitProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\007"
+	.string	""
+	.string	"initEscEndpoints"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\007"
+	.string	""
+	.string	"setArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\007"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.61d693627d219c88,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
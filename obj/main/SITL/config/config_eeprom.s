@@ -0,0 +1,1257 @@
+	.file	"config_eeprom.c"
+	.section	.gnu.lto_.profile.ada251a661a65a97,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.ada251a661a65a97,"e",@progbits
+	.string	"(\265/\375`\032\001\005\013"
+	.string	"\262\017<;0\217\323\001\004(a\344\353\347\344is\225t\350c6;\311P\333[\322\312x\30301\350\031{\n\005\007\003\003\003\003#\006\006V\005b\242\203\375mDK\215\226\032\331{\357\264e\335\036j\f\371\020H\353I\210\341\305@S\223\020\353\345\351\355\003\245Z\t\344\347cjZ\310x\b"
+	.string	"\3507\236c\202\214\253\263\371\374)FC\f\004g\323rF!\202%\347\347\237\212\2000\244|\362\203"
+	.ascii	"\2324\337\333N\321F\205\313\373\356\375\006)R\b\267\346\3369"
+	.ascii	"Z+<Iu\347,FVT\\c( \216\222\355\335i\2441\336\356\335\361q\267"
+	.ascii	"\221\034\234J\030\327\347\252\307\n\306\301\336\337\177\2337"
+	.ascii	"W\225\027K\254\332[\373|\206E\260\004\322\033\216Z\023\263\236"
+	.ascii	">\263\2626\366\331\257\267\257\247/\250/.-\242\313\317\277/\337"
+	.ascii	"\317\260\016\n\022\250=}\0341 p\202bCr\007\354 \200\234u;\203"
+	.ascii	"{Y\256\265#fO\303T\023\027\250\272\002\030\007\270!\324cA\275"
+	.ascii	"Kc\342\200\313\007Q\366-\330wa\265\230X`\350\002\202\360<\207"
+	.ascii	"B\215\241=\003\326\335j[\337\270)\207\261\235\2669w\243f\212"
+	.ascii	"\345.6\234\306\257\020\3161\240a\221\3115{\265\240\235\216QD"
+	.ascii	"\357p\311\214mi`\b"
+	.text
+	.section	.gnu.lto_.ipa_sra.ada251a661a65a97,"e",@progbits
+	.string	"(\265/\375`0\001-\007"
+	.string	"\202\211\030\032\220\265\205\016\376\377\377\377_\216\035\321\254\237\332\354\277\337\232\360v\263[J\231\002\377\0370\200\276\350\212\235\336t\006q\230\241^y\326\242_UB\207-\2605X\264 \317\201\321Xm\364,Lp%\214\203W\270\244\310\346\375X7\215\267\265\243\331\220\202==+\271\366\270.\215\245\037\237\f\327\235)\0208 @\002c\320\245\035\303\202\343\212M\241\363\177\020"
+	.ascii	"97N[\220]+\r+\253a9\276\321\005t\004\306\233\344\315\021\210"
+	.ascii	"\242\020x\030s;g\321U\b\255\033\006\357\2529\254\003(gD1\200"
+	.ascii	"\373\300\353\013T_\004\313\244ic:){\t[\005\365@F\201;\233\033"
+	.ascii	"\315\224\2059hw\242\325\235\024\204\376\301+2>\211bJ\366\334"
+	.ascii	"2\374S\212\301\226$\222\342\3105*,\037\336\n\243\270C"
+	.text
+	.section	.gnu.lto_.inline.ada251a661a65a97,"e",@progbits
+	.string	"(\265/\375`h\006]\032"
+	.string	"&#|I\260\324Q:|\364p\256\371pN\230z\023\214+~\270.\361\371\362\222\2069%bX\314\246\214\322\323\350\024\220a\373\201\304\3302\243(\327\370\356=\212:\247\017\373\235>$\363,\t\252\227\033\013\253}\373OR\362\267L2\005`"
+	.string	"c"
+	.string	"r"
+	.ascii	"\223@\330\222I[\355\333\306]ahR\352z\327\365\254\353\255\255"
+	.ascii	"\263\326n[6\030\f6\205\266\314{vH\354\314\254m\224\253\325j\341"
+	.ascii	">+r\232<\303\227vY\"WRG\326\227\376\370)\021:b\250\357\357>\347"
+	.ascii	"\234\241\035\363\033\233\021Q\003\244\275\266]U\2551O\301\024"
+	.ascii	"\264c\263ovE\b+\nQ\265\tm\230[\375~X\261\n\3479\312\201*q\314"
+	.ascii	"R\3040\347\314`#\320\334g|\253\313\223,"
+	.string	"\re\211\206\331\226\271q\237^j\325\253c\373\262=L@\r\231\335\326\230\275\302\361\261Pp\300\245\266a\343\316t\253\346\2348\031\212b\213EW\264\307?\3159_\241W\326'W]+\357\2759\003,7\362\025\t2a\177(\te\265\274\003\020)\304R8\020\t\204O\357\244\342\206\311&\272\301\372\366\262\032\254\254\226T\\\033\0174\347\004\340\313qK\350\020mp\331\274\313\bR\025\231\360\366\307\311f\350f\332-\3252\251R\300\325^\231ku\020\246\374\302\326(\335\bzy\306\373\207$\027?0[f\223\252<\300\200 \263<l\f\265``\231\306\002\336\301c\244c\340\006\002<:*\340\0245-\204\235C\350\203\343\213\262\241\300\361\302\210\212\244\311\355\326\270\226\177\207\342\353zV\rm\227\005\"\001!yp+\375\204\200\256!\213n\023\207\250\246*\301-u\025D\265\300':\376\3116\023\333v"
+	.ascii	"\265\312\244\217\337\017\353u\347\310\351\241A\2234%\2525\277"
+	.ascii	"\346K\370\024\323\211%\265\350\200\233\250\201\265C\"RB\222\222"
+	.ascii	"\024Kc`\002\221\231\262\262\003\022 t=F\222\314)$3C3%i\3663Q"
+	.ascii	"\302\345\360H\315\212U\202\322V\332Y\201?Yn\366+&\221\021T\\"
+	.ascii	"\331\366\213\354\356\307x\253\245\262&\247t\303P\226@|k\212\264"
+	.ascii	"Q\021\220\027\256\377\351b\263\004s\217\226#\243\365\343\274"
+	.ascii	"\306\277Y.\001\354?>\310a\200g\270\300\264#3\351\374@\037\210"
+	.ascii	"S\320e\321\274\245#\326\356\310\240\\}c4#NO\340\344\254j\241"
+	.ascii	"\n\243tb\006\035\252\257\021VM.\211\f+Sk\032\310a\341\342\017"
+	.ascii	"\372,J@\366L\304\227/;\210\351$\316D\330\373\305j,\370\304\334"
+	.ascii	"\222\313\240\211\201\004\312\230\263)\372\300\227\232\343A\007"
+	.ascii	"\201I\377\2256V\272\333\024r\016\344Ut2M\230\324B\024\343\006"
+	.ascii	"\332\031wl\372\361tmV\233u\007\361\256q\266H(\007\224Z(O\307"
+	.ascii	"\240\262\302\206\021\274\035\254\245f\204kM\b:\346R\317\223\341"
+	.ascii	"\271\004\330\377\353\3712\"\263#\220\263\233\242z\002e\350\257"
+	.ascii	"\021B\200\267\356L\322\344q\022\2019.\263}\b\306\032\002\242"
+	.ascii	")@\345\316\366\230\375\241\223\274bb\36228\t\020$B\230m\220X"
+	.ascii	"[(\365\025\255,7\017"
+	.text
+	.section	.gnu.lto_.jmpfuncs.ada251a661a65a97,"e",@progbits
+	.string	"(\265/\375`L\tM\025"
+	.string	"VXF7Pk\222t\350\314\314r\251,u\022{\303\347\242\223\256\252\252*~\3266\0312\213\376\314<\223m\022\325\207\031\337\030\355\326\370\035\303\263Fm\204\265\266c[Bd\222\0015"
+	.string	"6"
+	.string	"8"
+	.string	"\037M\017\2437PJ\235aV1\273b\375\350\336\361\030f{\206\365\326\260\327\260\316+\323Z\253\013W\227Ikz\026\275\311\267\224^K\004=\007\177b\005%\017\002\2466Z\022\300\002\233M\277\321\323$\3615\343Pq:)\352\254#\330\022\022\223\240\327\354\r\257a:t\326\030-\344+\323\364\217\210\323/L\261\351\364D\362:O\251\023$\004\353df09\305O\251\211\322\"\301\301AZ\3561\003xO\326Z\353O\221G\351\355\222\257"
+	.string	"\336\001.z\351%\205\240B\320=EX#\217\313m\224\326b\bk$I\022\002\371:\254%\017,\313\3755b\302w\344\202lH\013\362Qw\205,@\025\322\024>\274\207\333x*\0244u\270\266\307g\270\033 )H\026 I\200\034\304}\030\200\264\250\221\3119\022IRP\220B\233\001p\"\031\252\253\016\022"
+	.string	"2i\204d9\226bF!\242\310P@\201\210\210HJ\r\205\345\232\b\362>_\215\230\255\217\0049{!\243h3~\347\377\275i\214\204\231v'\352\034\367\324\305\322H\310\276]'\355 \201xm*D\264\214 \033e\244\007\272H1j\352\333>-,\275\217\331-\021\320\341\302x\035\201y\251TX\033\362Mh\025\244\215\331\237\307=\340:\212y-\326\267\341u\337m]\301\275\305\004\262\344\016\036M\232\350\230\211\026\261\375\276\346\261%\221}f\005\376H\024\372\224aH(i\260\377!G\333\310\360Z\004#\036\200\021\207;\226[\355\245a\217O\324\211\226\241\271^@:)2\221$Sk;\013\333^\314\300\256)\321*E\314\374\330\033\026\257@\227\003\220\310X\b\022\221b8&}\314G\201\204P]\b\275\254y\3739\322@\333\202\026,\373:J\301\377\r\344R\201r=\251c%\264/\322"
+	.ascii	"r\261\335\207x\273\344C\212\352|!\210Md\330\243\336Q\236Z\267"
+	.ascii	"3,:\263\0164)b\252\363\351\025hm\177\303<\b\377`\266\023\365"
+	.ascii	"\016\241\337\350}qx\256\341<\307&\241\373p]\205\t\t$@\0078\006"
+	.ascii	"3\031Q \"\322\004D\035Hf}\n\277>\372\216\235\221\320\320\256"
+	.ascii	"\3631\t\312d\276\261\227&J\236\301\234u\351q\\\177\0307\177~"
+	.ascii	"b}\177E\335\243\313\003"
+	.text
+	.section	.gnu.lto_.pureconst.ada251a661a65a97,"e",@progbits
+	.string	"(\265/\375 HA\002"
+	.string	"D"
+	.string	""
+	.string	""
+	.string	"\027"
+	.ascii	"\265\004\002\271\004\004\230\004\005\231\004\006\230\004\007"
+	.ascii	"\230\004\n\204\004\013\204\004\f\024\r\232\004\016\025\017\265"
+	.ascii	"\004\020\225\004\021\230\004\022\230\004\023\230\004\024\205"
+	.ascii	"\004\025\271\004\027\231\004\030\204\004\031\200\004\032\231"
+	.ascii	"\004\033\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.ada251a661a65a97,"e",@progbits
+	.string	"(\265/\375`\246\001\205\n"
+	.string	"B\317//\2009\031\016s\211\304\035QF\377\023\032\005t\303\f\370\r\346,\361\203\320\004\006\2241j_\365\333\335\23242\"\350\033\375\313\b\"dK\231\002k6\232\rg!Z\323\300a\200\256\220\362SB]\3659\351CM\205r\372\300\240\200\025\033\r\002B\243b\224\352\036&\334\205\341\256\226\361\324\234\236\306\b,wIt\376Hy\002\364\030\344\021\341pXZ\245=Sni\363L'\273x,:`\271\353u(\321\353\243\356j\235F\0012\340\347"
+	.string	"\257\252$Y&\331\227\322a\006\375\364)ac\312\251N\252\334\352\244tN\3321\235\b}$\351I>\225_:\255\366\217\036\364\240\306\216\f\371R\004E\250AE\245\030Y\220\026\n;\007`\002BDG\017\020`J\302P\013\303\001"
+	.string	"\n\336\304\201WU\307l\203uV\375\315\225\b\274\020g\026\244\t\325\335Gs\020yg\025\237\354\352\216\372\004\201<\226D\310"
+	.ascii	"\335\022%\356\325\256y\262H\324W?{V)M\304\252\303\215\306?25"
+	.ascii	"\3373\216\252'9($n,q\222Ff\331\304[S7\373d?,x\360\210\241k\306"
+	.ascii	"z\310\226\335*\364sFM\022\233\304\371\214\fX\347z1\020\005"
+	.text
+	.section	.gnu.lto_.lto.ada251a661a65a97,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_loadEEPROMFromFile.15.ada251a661a65a97,"e",@progbits
+	.string	"(\265/\375 \333\325\005"
+	.string	"\222\212'/pU\323\001"
+	.string	"\225\254f\244\n?+2_\\\270\305\340*\034#\016!\302a\320\337\334\033\260\210\030\253\005\\"
+	.string	"\361W\221\001P\303\267Hn\231\002\257(\214V\315\262\030\217\313\221\321jfW\003\233U\205L\312p\252YuF(\255s\n{\031\\\200\306\nwg\371K(r\275K\3613v\314\375!'y\363\257\240\031\374\031\241Y\222@\367e \240\307\201\350\371\277\323\267\277\264a\247w\224\261\210"
+	.string	"\272{2g\267\225\333wC[\360>n%A\321\335\227\336\207\331\363\376?\374O\374\237\004\t"
+	.ascii	"\252\244\233iq\323\031T\341:\327p\262\020\306\313\020\340\322"
+	.ascii	"-\332\371\004"
+	.text
+	.section	.gnu.lto_initEEPROM.16.ada251a661a65a97,"e",@progbits
+	.string	"(\265/\375`\b"
+	.string	"\r\007"
+	.string	"\002M05@m\223\016\274e\215<6\255\217n\001\033\254\351\317\360\261\2700\203\027w}\212\372\343\206\337\316^l\002>\255\367=Y\312\215\323\350\346l\343\350\230\307\033\"D\246S\225\213ue\252*\201\301\262\200\261\250\210\261(\\\"u5\304\212\300V\246\272\242\203e]q\3528\005\365\240B4\022q`6\345\335\320\003\304\253vCE\240\300\030\2112\270\371.{\320\363\245$\314xH\300m\026\237\0138\322\245\304\211I\206H \034\177oGC\232rK\036\221\215\313\314\251\322k~\252\324i\354I\332md?\266\b\217\222\314\214P\243X\037v\013j\200\326\331\364\001\030d\346O\353Lt\330\177\340/\370?\001\013"
+	.ascii	"\252\244\223i\021\206\205\b\333*\204\347\032\016>\304C\250\030"
+	.ascii	"/W\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_scanConfigLog.17.ada251a661a65a97,"e",@progbits
+	.string	"(\265/\375`\366\013\255="
+	.ascii	"\232jT\027=@\350\316\030\366\224\213\375?\334M\311\003\254\031"
+	.ascii	"5\277S\177\205\343\fy4\004\206C-y\031F\363\006\234s\003}\204"
+	.ascii	"\005\345<\353|\001\265\302\377\331\306\342\241\377\203D\210\310"
+	.ascii	"-\245L)\245a\001O\001i\001\234\246\316\037t\366\325\271E\364"
+	.ascii	"\0308|\213R\360q\335\262\300In\037U\316\226\256\353n\323\375"
+	.ascii	"\246[M\247\314/\367\032n6\355\246\243<|\363\305\272pXf\235$\027"
+	.ascii	"l\253m\204\244\256\332\234\213\326\365\352\261`[\345\n\030\220"
+	.ascii	"]\007d*l\316-\273z\025\305\361\241`[\355\246\343!7\232N\203l"
+	.ascii	"5B\332U\232\265\315\"\204\024\271\356\334\203V\331\004\333*\317"
+	.ascii	"\261\314?\327f\220}\346\213U\327\205\342\347\201m\265\311\333"
+	.ascii	"\231;\256\345\220\375\004\343\326u\331\334\300q\335\271\bL\201"
+	.ascii	"mu\252\243\326V\323\206Z[e$3\242\236ss\203oy\226i\370\\\327="
+	.ascii	"~\025n\331\351\221\375\344\324\304\264\244D\034\n[6\270\252\351"
+	.ascii	";\222;j\0204\217\315YX?\3751\263B\327\336<\023s'*ho\335\344\306"
+	.ascii	"\364\304\212/E;\245\363\362\305\365QA[\322JkD'\303\267IT\230"
+	.ascii	"~p\342\245\365\0373&i\373\221b\250_\247\267TlhK\232\245\372c"
+	.ascii	"\246\026L\233\334\374\026\365\0373\265\364h\207\254lx\266\364"
+	.ascii	"U\251\222\3215U\232~\300K\223\353h\373\221\263\261\264\245\354"
+	.ascii	"A\273\213\231\025\377\246\353\024L\024N\\\037\033\332[{\020\204"
+	.ascii	"\353\272\354\3143\264f\250f\356)\314\f\203Y\230(%\332\220\211"
+	.ascii	"*=f\024\275\227\202u\3351\253B\310\270\025RzXX|\233\006\251\357"
+	.ascii	"\231\334P"
+	.string	"\206\344,\325s\261@P\347\275\200\240\347\272\256\206V\007\271\3536\337\255\255\376{A\371\214\271\0377\231\246\372\377g4O\t'v\325\226e\316\277?7\240\254\003z\256\233l&\267\237\376\023CFV\326\332\352\361]\220\022\356\302\373\253\331-\001\231\002\003\003'5\203\265\377\302\263/\325\304<\220\277\301V\007\337\337~\321W\351\024\353\257\225yF\343\335\005\321$\342s\004\341\231i4\236\257;\216\022\215q\360\3145\272\016\230\235\n\207\250\317\311\203f\326\3529l\307\344\346\272\256\025w\234\226s\203\033K\253\234c\313\233\271\265\266\332\201\212\"g\234\243\244\0072\317\205\371Oa\356`\335\0314\3766f,\017\034\256Vg\r\031\254V\347\013\026*L8\366\231n\b\375\354v\320u\315U\306~\323\\l5\315T\357<\025tN\260:#h\235\017\264\316R\255\263\201\325\271\200\320\231\300\352<\340\235\005\274s"
+	.ascii	"\241s\324;\003xg"
+	.string	"\250\240\363S\353\354\364\316M\2533S\352\274\024tV\3526\315\304\326y\230:\013\337\271m\235\331\3269\230:\257\254\263\312zm\361YX|N\211\305\267 |o\205\357B\341\373\".N\242\360\327o\372\320\215t\353F\372\rp\371\n\273\201\254\3756\212=\346\362%\272\221\256\002\262V\271\223,R\356\226\236\336\370\031\276\377\234\376\251\351\364A\262w\314\263\350Lo\374&\253\3427}/\001\223L\257~\211B\363\350\352\374\002\251(\251\r\260\344A\365\214\271_\035Gn$\021}\351B\201+_,p\262%>Jo\374\245w=\303W\372 x\350\226\200\201\326\230^\206X\353\220\320\230\373}\361\244\207!\305 \303\260\3101k\253\303?b\201s\312\375\242G~\330\204?\205\373\355\022{\316\345\253\224AE\221\277\345\313\376\033\277\331o\237\330[[\276JV\337\321.Ah\322\362e+|\361\233\035\350\242\321"
+	.ascii	"\276\3504\177\302o6\350\036\343\013\277\337~\220\006\r4OM\352"
+	.ascii	"\272\256\333\026=m\260\225\352\333gF\312!\313x3+\374\224\362"
+	.ascii	"\303x\302\267\377\341\315[\002\366}U\351\361Mx\265\355\257\217"
+	.ascii	"\255\310\\<\226\375\340;#h!H_\354#\366\373%\364Lr\210n\204\305"
+	.ascii	"\262\301\357\360\366Lz`3HtDL\360AO\375\0029\350\2361\367\263"
+	.ascii	":\004g\313Z\246M\254\352\210V\224H\3756-\322\230\f\223 \265Q"
+	.ascii	"\177\212\2115\375 \320B\314\001Z^Z\337\243ml\351\250\021D\355"
+	.ascii	"j-/,\033<F\f\351\342\302\322\241\003\b\216!kI\330\301\345\325"
+	.ascii	"u\343\006\215\034[8xpi\035yl\325\330q\324\362\362q\224Pd\256"
+	.ascii	"\256\033^\307\037\\\\^\307\341\234\333\337F\327\254\235&}\222"
+	.ascii	"/v\366\024m\022{m\226o\023\3267\2275\247\037\237\352\233\t\232"
+	.ascii	"\355\326\251w-_\330\216\205\233\312R\305\315)\367Lr\210{\023"
+	.ascii	"\311)\301\263w\311\002\300\005\353[\217\022N\303'\020\360f\t"
+	.ascii	"\230\344\323\b^C\357\351\002\217\340\373\016\036\037\245\363"
+	.ascii	"\3003\317\360-Z\3224L"
+	.string	"F\375\265J\375\201_\037)\235b~E\352\207_\002\365=\r\370\333W\224\333\353a2\242\202\003\313\033\271em\325\300\023\301\243k2)\340m`R\b|\201\367\277%`\224\254*(\353\023\370 w\201J0\003\236\231[\270\023\254\312\215\031\311\305\327\220^\242Zu\022\365\003>\250G\3003a\273\bnK\232\311\250\003\274\200_\377\224N1-W\302v\254'\t\360\021\336\236\236\226\325j\334\220P}\3247\340]$%\030\013\215\232\202\232~\n_\225\365\327\352\341\245\262\354\2255\207\007\340\341\352\001\374\207;\272.\323\304\347\360Vy\")\341\304\274\301V\342C]Yx(\343\243:\027\374\354\2240\r\215\317\255\361Yh|&\032\237\370M\036\026\237\003\200\354\250a0\344\224SJ\215\210\210$I\222\326\240\002\221!*r\003\021\200\245Tlh\244\332\031\003n\300W\206\202\b\336G\250\031\2300\274\"o"
+	.ascii	"\222\251\005\r\004p\201\004\325f,lK\025\240\207t\216\211y\224"
+	.ascii	"\272u\232\t\345\005\345\305\0054\344\016\204x\363<\"\004\231"
+	.ascii	"\244\255\032\t\032_\361\004\345&C9:Jx8n\345\034\017\bp\206HZ"
+	.ascii	"\335\221\247\004\251\374&\255e\311t\316\226X\n\325e\274\237\324"
+	.ascii	"]s\345\311un\320\177\353\277j\f]\276)\314\037\263\364\\\177\227"
+	.ascii	"+\257\235A\331\245\245f>qB\016\361\007?\"\n\017(\247\302\322"
+	.ascii	"\315_\022\223\273\331-\356\251\037\342\341\tc`E(3\017\337-kf"
+	.ascii	"\200\033\375\323\315S\334\251Q&r\225/\364\220\304\246\347K\236"
+	.ascii	"\237d\f-g\354\"\331\330U\220C\255\241vM\216OH\314\320\360\020"
+	.ascii	"\006\243\310\b%\323\367\267\353\367\356T\035\031\312\377\340"
+	.ascii	"x\354\036\222|K\326\0055^\020\242\235\024?\375\334\336V&\006"
+	.ascii	"\323\203\2011\202>\032q\005w\365W;RCqHIA\r\355\030^\340^3\364"
+	.ascii	"\307\226\t\325\032\273IC\324\224\025p\240\307\347\003\020\266"
+	.ascii	"\236\333\005\362?_Rb\361=\007m\215u\335\243Il\323\373\355kF}"
+	.ascii	"\267:\302\374<\032*\216;\251Q\367\037\200e_\023\257\256\002\023"
+	.ascii	"\324TT\232\207k\016)\b\333\267D\257\2141\354#\326i\207O\035\340"
+	.ascii	"k\357\201c\303s\276n\272\310\006%\034\214w\034\214\357\236\006"
+	.ascii	"\226\325\317Q\001\307\231\260\236U\002\337\315>\214W\347\002"
+	.ascii	"{H\004rk0\0177?\262\356\232\rG\2617\246{\200)\004\253d'\0055"
+	.ascii	"\307\254'\224\321N\203\230\247[\031\355\2440\244\253\001"
+	.text
+	.section	.gnu.lto_isEEPROMVersionValid.18.ada251a661a65a97,"e",@progbits
+	.string	"(\265/\375`|"
+	.string	"\005\n"
+	.string	"\266\022E< \345*\035\3408\320!\243\023\n^\200x\240 \250\224\3374*\262\037\270F\030>\323\231\006\334,65\211\246\005S\250\367h "
+	.string	"p\305\203$0v`\n"
+	.string	"`c\031\"\204\310\235R2"
+	.string	"3"
+	.string	"4"
+	.string	"\263\n\222r\227\374t\343\3429\235\242_:\247\266Z\212J\311\210q\025\030Q\334\300\356\376\365\251\032Osb6\273\353\231\032/\356\356\266\025l\027\330.\003\327\277~\017\027\215\214\230i\336l\2624\265e\237[e\331\236\236s\372\334a\026\345\313\202lwu\013\260(\235\311\207m\222\235\261\301\001\311\342I\216\325;\002\352\215IO\234\266\346\356\226TYw]\344]\035FXP\023\200m\360\"\242\200]\024\202\017{l\244\266Z\210\353\235%&0 -\345\256\351\251w>\205\367.\346h>`\030\352t\030 <\017 \220\363\201<\r\237\217\023\216>\r\201\301P'\374\"@0\3742\344\236[e\331\243\255\310f\363\027\275\277\236@;\221\315\324\027\275\251\252\017"
+	.ascii	"\252\322Ia:8\314A\314\0267v\204\321\370&&/4\023\212kb\016\026"
+	.ascii	"\244\r\221\307]GU\r\244\016mm)\003"
+	.text
+	.section	.gnu.lto_isEEPROMStructureValid.19.ada251a661a65a97,"e",@progbits
+	.string	"(\265/\375`\275\005\235$"
+	.string	":Bp\016DphQ:c\030\261\230\303\241F!\334\215\225Y\356\021\026\250\003Bg$\n}\037\r<u}\3235\013)|\003h\036\214H\020\2132\024b\024\020( \201\222\206\241\304\351\205\374\242\250~\333\223F6\221;\311\322"
+	.string	"\313"
+	.string	"\326"
+	.ascii	"\314g~\222\371v\346'~\327S\276\361\221\337\362t.5\314\033\004"
+	.ascii	"yy\220\240\003\b\002z\313H\364[\327\362t.\033\274!\362VQ\370"
+	.ascii	"\n\333Zp\313\016\320[\243\357\316\333z\244\363\226\037@xb\341"
+	.ascii	"\221XTo\322\247\330\305\320\275\310^/a[\205\307\335l5\224vZ\263"
+	.ascii	"\253\220\017u\234\257O\237\2552$<\212\374\326d_x\300\302\034"
+	.ascii	"{\334\366;UD\244T\r\251\265\247_\332\223L\301\302D\361q\364N"
+	.ascii	"U\020Z\356X\274\035\211\3654+\250\371A\365\344\353\216\243\224"
+	.ascii	"Y\233\360\t\364\364JR\252\204Tk;\372\270\371a\221\267\271\243"
+	.ascii	"zb\314\035\243L\005\200\316\220=}\235:\022k\245Y\270\367r5\036"
+	.ascii	"y\234\213\316\314z\230\331\307l\177\004\365%N\276\0228!\313\212"
+	.ascii	"\325\026\237\314\313\230\340\n<o\373\354\354\274\346d>\221\242"
+	.ascii	"\336H\240_t\325)\003$\325P> o\230\230}\305\267\202\222\323\325"
+	.ascii	"}\305\365\337\371^\221\212E\325C\314\254\342_~\350\275Q>\276"
+	.ascii	"\227{55!D\206\234\334r\013 mJ!+\367\016o\274\345\2738o\337F\262"
+	.ascii	"\362Xi\341\032\3263f$T\355+\346?\211\020$:\270\22303-)\361\n"
+	.ascii	"$\021\340\312\002v:[\031\211V\371\210V9@\255\262\021Z\031\200"
+	.ascii	"\255\234C+\027\241\225qg\345\233\255lC+\327h\225\321s\235\317"
+	.ascii	"\256l\317\312\346\271\234\333V\256f\345#\370\233:\206\002\241"
+	.ascii	"\370s/\325\031\242[\307\242\311:\327\317\3455L\235\033k\243\324"
+	.ascii	"EK\274.j\337\230\362Y\336\255\3249\261?RZ\304\233y7\216w6N\f"
+	.ascii	"O\361\210\216\022G\355\326\272.\320\237c\353\233\035[[/j\256"
+	.ascii	"\350*\332\272\256uR\363v]\353\027\315\206h7\231\022"
+	.string	"L\230\2226h_\261M\322\002K\347D\325C\035g\210\0272\332\234\016Lap.\307\303\201\260{o\204\3338\365\336s\234\363\326v0\3752[\327\266\237HJ\213X\317\270\266\331\226l\f\021\314\313\254\227G\240\224\235}\305O~\303\322\252\250D\223\026\230\025\275L\002\275\353\251'\257a\211UT\242\005\372\351\217\314'\357\006H\313B\304\346mxy\336\352z\n\304Y;\230\362\371\3604 \320\214\b\201^D?\371\332D\013\212y\357\275VW\0031\376\013\376\232\177\r^8\005c45\245h\001d\001\303\351\327\203\001T\361\242\367\013\312\35050\300N1\232\202\275\031NN\301\336\ry\337I\370\\\222\361R\336~\341\371\364\033\306\016y)\233/<\005\bh\2660l\"\016\251\371\203N\310\006\337\t\013\247\b\253\324\033\205U\214\202\216\032\251+!\026^\271\240\022h\240\243\256\375\320S\306e\240\002\350"
+	.string	"\315,\324\"\354\25272\357FC\261Q\007\360\003L\302Z2\265Q\327\245\024\225\\\003h\006E\263\217\321"
+	.ascii	"Q\177\341\274\315u\215L\017\021L\314"
+	.string	"\220\023H\2272\267\005g\306p>\274f\207u\357\365\361\301\036\226a\003\207\312!}\002\251/+\203p^9\260\330\354\256\317\236b\323\352\272{J\002\325m\234K=`J\241T\354Hgwn\250a$\343\224R\314\t&\220\021\231\2216\303\001`\002\221\251:\363\020H\311f\223B\007JS8\240\251\217\214\020\236\n5vu\t\023u\272if\274\340\331q\261\271\214`\f\337\301\016\1775Sq\277)\276\321J\357`z\006s0\327\225\266\255\022\216\315st\306\335\023\242\326\352\"\250\207.\267!,\032\215\006\263\b8z\353a<c\300\204\036s\344\354r\260\321\204b6\243\271\247E\020\023\341\346\261\211\020`X\001\370\261Y\177]M\367\341\356\216\342\276j8\265\325\337\234X\334X\304\204\222\327\345\363\305\236S#j\247\344P\324W4\304\215\261\036\334\306\203.\356\b\243\374\214\241\327\260+,\t\276\244\342"
+	.ascii	"7 (\204\"\375\fz1jpH?\373\035[\344\325\236[(\353\353\215E\302"
+	.ascii	"3\356{\345x\221(\021H\006\333\205\224\023\221k\274\"\260\253"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_getEEPROMConfigSize.20.ada251a661a65a97,"e",@progbits
+	.string	"(\265/\375 \373\315\006"
+	.string	"\"\315/3Po\322\001 \333\b\n\261\242\240\254\315\267\273\203\211d(\254g\352P\334\032j\335\243kl\233\356 \020\210\231qUa\264BX\360\320\352\271\335\233H\231R\2362\325\203\034\212Rh\3200l\336\3446\232\205\312M\320\301e\f\3748\024t\017\357A\207\211{\025\245\026\2004\302\276\310\243\345o\030\242\223\277\316\374N;K\005\260"
+	.string	"\345\310\216\237T\f\373\322\356\256Ud;\235J\320\241R\225\354N\214Z6\205\231p\330\366\330\030\377\343 \036[\0315(\032\t\212\304\b\313nt\001\037hgy\201v\246\031\267\236\226\377\220K\036+'W\350\363\274$\354\256\363\nU\334z\333\007\266\021l_\004\b"
+	.ascii	"\252\244\223\261\230\300\0311q(w\r\311B\344\341\256\230\332I"
+	.ascii	"\006"
+	.text
+	.section	.gnu.lto_getEEPROMStorageSize.21.ada251a661a65a97,"e",@progbits
+	.string	"(\265/\375 \337-\006"
+	.string	"\"K*1`M\323\001\300\235`%\302\350\"\305JM\020\253\332e\001\374\202\305\353f\037A\267\364\036\3405~\303\300\220\201\025\333\177XJ\226\273\326v\263{\247\024v\232H\316\351y\022\030\240\005I:Q\202\024\242\350\314\206\330\020XN\317\214\016R\316\310\324\375\313\334\356)\034xx\020v\255\334\253\260?\331\227\331\356 \024\332HD\262;\261\225l\310\342\201a\233\262\031?\343\032\224\251@\275\300\240\304G\004\207\266[\243\353\003\340\227\312\001\340\227gqzG\375o\034\241Cd\263\256\352\216r\260\273v\326\205\335\357\266\013l\033\330\246\002\t"
+	.ascii	"\252\244\223i\261\317\f\t\016\3125<6bh!2qWL\355$\003"
+	.text
+	.section	.gnu.lto_configRecordArea.22.ada251a661a65a97,"e",@progbits
+	.string	"(\265/\375`\254"
+	.string	"\025\013"
+	.string	"v\024KB \251*\035"
+	.string	"Z'\362\321\034\343\ty\324\207Y\205\273>\227\006\030\314\307\023\235\231\2103\304cV\003h\325\013\201F\311\300\024\304\022\n\020\200\020\305\317\2021\236\006\031\266D1\031\tdY\333{\313\224\0026"
+	.string	"9"
+	.string	"6"
+	.string	"\234\303k.\237\230C\\>\243\312M\227QM~\003x\272\304\270\036\345\246D\346r"
+	.string	"SR3C\211p\330\225\005\252T\027:\273k]\201\255{\336\266\206\355\f\373\233\237\022\256\231'aw\344f[\007\223A\213\355\222\235\261\255j\237\300\013\224\036\272\201\031vOd\nv\367\302\030\230O\ni\333\027\360\001%\233\"\302\225V\206f\023\211\325v\303_}\352M\273|>\262\242;\250\230\222S5\332 !\372\225\2142\236t\301\204\231I\214/[\\#I\200\n\007 \250\224\202\035\2364\276\354\313\215)\226\017\177\265:\236\356\363H\1778!\357\033u\335F\007\210C\344}8\021\310\023\342>\037\211\343T\330\033u\037\367\341y\037\227\t\367\207\375Ao\340\tH\023\017|\004\217y>\313\247=H\023\300\255\266\213\n\024"
+	.ascii	"\252\322\r\214E\030\016YX0D\232\316=\303\333*\302^C\265U\224"
+	.ascii	"p<\364\323\204\344\032\3161\201m\032\256\037\023\017\356FR\r"
+	.ascii	"\266\bMcPP"
+	.text
+	.section	.gnu.lto_findEEPROMInArea.23.ada251a661a65a97,"e",@progbits
+	.string	"(\265/\375`\231\003\315\031"
+	.string	"V/\246H\260\230M:\023\243u}),"
+	.string	"\363\001\366\230\200\023Aj\261$\237\330\004]\036\301\322\304(\322G\026Ci\303e\335\371\352jA\221M/C3\214\232\237\302\333\324\241\366\026\2146\302\377\376v%\200n\226\020\262\367\2262\311\224"
+	.string	"\207"
+	.string	"\225"
+	.string	"\016\302\317\001r\333w\"\247\246\342~:\0300\277\207\3426\265*i-\251\325\247`\027\204\237\027r\036\320\006\345\370\226\216h\246\\\344\234\306\324\352\203\255\357\001\350gx\034\372\3318Vr\320]b\b\322)\233\203\366)\356\312\200\205\204we\343(\306E\031\34108\224\ttUH3F7\031\200\351E\022\2039:4e\004]\025\322\237\316EF*\344\261\334\340r\247\023`z\021\203\345\002\244\267\313\b\351\fJ\250\265.\023\031\035}_\337]\251\335\345\331\3551?\224\\\365\204xk\177Yk\255\262w\313`\367\237\036v\261\332\021v\323f\261\3737\025\221\024a\272w{\276\202\236V\213m\245]\312{\023\362\332\334\310_Cyi\356\373g\336\373\001,\257K\fE^\360\275/\ry'\345\225\314\333 /S\336\343@"
+	.ascii	"\242\223\301#\251\265\370\252\213\255\254zeR\361\330?\035\212"
+	.ascii	"\304\221\254\016/K\307\253\265\376\310\356\213\304\356\353\363"
+	.ascii	"\273@\273\257\"\377\001\335\210\tYSq7\252\004\027(M\337t\216"
+	.ascii	"U.\tj1<\n\017\224\016\032\3669N\320O\232>\324\r\254h\372\025"
+	.ascii	"5\365\240\200IB\006\354\335N\035\236\230\037\025\034ce\231A\304"
+	.ascii	"D\267\311\206\003K\265\n\235h\352T\034\020,\325Z\037,9\223\236"
+	.ascii	"\215\311\370D2\372\311\265~\247t\211\237\025n\261\273\371\311"
+	.ascii	"\220\217[\263\004s\245%\247\265\276\333\373\213\025\226\032\263"
+	.ascii	"w\273\f\240W6mq\244o\333o\013\216\261vw\366$cX+\256\301^*\004"
+	.ascii	"\210\260\326\372\034\237\373 \372\371\236"
+	.string	"\001\373agV\203\315j8>\264qDOl\3640\376\374\364\204\210\315\314d\266\256}c;\"h\266\232L\306a6z\360\241\305`>c\217\bX\314\366\003\333)\260\264\232\314\006\033A\243\331`\257\025z+-\323G\235\347\243~\247O\360\242\343iJ>\352+\206\355r5\367\315%C\261\303f\261\262\207\324\220X\323`\227\370m\261i\020\247LN\253\257Cg\333\364r.\351\266\024^Ua\366\024\343$\310i\024\251\230\022\366noZZ\270\024\036\331CxY\272\246\236\200\255\007G\250A e\030e\204\221\221\2614\n\022\245\003p\002\241\231\344\r\020\210\267\205\311\260\031\330[Z\364%\033W:\257\343w\362\"\244\361\265 w\204\bf\245K\267\236\334sh!)\002q\213\201\030\212L\222)k\025M07\255\362\346\f\364\271\364i\237O\0014\360\021S\021\362ynj\305\f\350\204\313XZ\350\031"
+	.ascii	"O*\266\257\364\037(\bV\035\344\3278\361;\r\006X\235 e\034\345"
+	.ascii	"\264\311\007\320\023\277I|\324\320H\247T:#\177\375Lv\316u\203"
+	.ascii	"\022\265\261\333B\376\275\f\373\001"
+	.text
+	.section	.gnu.lto_findEEPROM.24.ada251a661a65a97,"e",@progbits
+	.string	"(\265/\375`F\002\025\024"
+	.string	"\206\246\206I\300\020)\035\314a\372\300,\324a\243s\241\367\265\243W\377gaR\346\025\206\346\020Z\310~\n\360\211\214\004\271\216~O.\340\327bT\275\366\002\331\230\302?\303B\0314\345\251\200\202\302\221\377t\207\253\333\346\244\021B\244L)r"
+	.string	"k"
+	.string	"q"
+	.string	"s\352\240\200\346,\027\230\001y\36197\241\342Z\201\322F\206\343'\307\345\3074g\331ry\002\343E\362\003\306\213\373\301\344\f\313{\324\332S\243\030\256\326|\333S\254\234\313wXt$1s\221\302\023\020\227\343\3600t\240S\002\004+\267!\334\036P\350\301\353K\356\246\373\235\253\320\220\317\250'7sM\205\3149\255\270\234\314M\336v\007\333\022l\235\020^\235\275R\275\367o\234\367\223\347\271S\243\325\373\337\255\241\372"
+	.ascii	"\336T2\315H1\232\023&\352i\022\211,"
+	.string	"F\234\347\377]\355\333\007\372A\236\332gK\314\006L\022Oi\3162\002y\024\376\216W?\007\221\266\030\022\370\243\2434\347\364\270\350\007\344\305\333*\366\312\366\226?\241\362\236\2060\300\274y\020\321\200\274\330\021Z\365\274\224\013\b\032\245A\032]\013qw\326\242%\244Umj_l`\005\r\215\2606\252\366\200N\224\357\350\246Nf\351\306\222\373\265a#z\234j;Z\326\346\225\352\332\027H\366\301\037\247\006\212\350\266\266\215!\243\327\263\273\263\354*\034\204\300f\316\t\342\373<E\006\037\347\242i(z\334E\037e\2748\356w\256\300h\250\211\267\242Qvi\323\335\331\007\201\341\342&\026f\262\027l6\272`3WX\"\213\235\270^1\221\030\215\346\302\360b\215\300f\353\327\007\211lf\002\203U\030\211\211\224\310^\255\222\230\213\244\365\232\321Z\037\t,3\201\315Z'2\331\254\265\362\374\352|\337!$\371"
+	.ascii	"\177\306\003\375\301\253\212\226\220\302\324\356\256CV\226%D"
+	.ascii	"jw\346\350\021W\273G:\256\332\343\272{\343{qS\247\207s\3169~"
+	.ascii	"\\w%2\325Hj\251a\t* 0\002\203\320Z\017K\351\227\355>i\343\\l"
+	.ascii	"xia\272\357[\351\336\332\305BU$D\334K\315\354\024\353\342]\324"
+	.ascii	"\030\211Fc\357\\\345\230 \267\025\304\340\372\026\b\274z\275"
+	.ascii	"\330.\233\021 \315\350\021>\253\321\217\031\326\334\357\226\254"
+	.ascii	"\026\301N\020\305\327\3552\257\241\271\241n,]\203\370\210&\305"
+	.ascii	"\275\256\360\004"
+	.text
+	.section	.gnu.lto_buildEEPROMIndex.26.ada251a661a65a97,"e",@progbits
+	.string	"(\265/\375`\223\t\3457"
+	.string	"*d\340\025CPdR\007\003\361\363\254\306\251\213\376_\243\253\236\365_\211\0065\352\224X\274\224A?~\240 \234\343\035\222\306\314XpH\004DM\n\340\b\212:f\013\005\275\2635\352\275 \344\027#m\267\225[&\231RM\001;\001M\0013\234\335z\376xp\265x,;-\341k\355m^zn\315z\256lp\201\360B\324\350\016\272\352\256\326\301\356N\3539\003ZS\266\313A{W\266\300\325\306\320}\247\316%\351]l`!V+\f\nau\325"
+	.ascii	"\366\333\355en\226\364\263\033^dY%t\304\260\354\224AC\255\256"
+	.ascii	"\366\324\213\262\253\253\017eW;\331}\307\247R\326\027E\217\251"
+	.ascii	"\246\307\262\354\361\227\364\260s\257,\236z"
+	.string	"\017\341\244\023\r\031\213B\304\2410(\b\374\255\276\254\342\277\311v5\307a\3166\315\256,'\302>\034\\P\234\356\371\004G\360\203\027\347m~\235]\313;\344\243 \346\345\304\215?\2748\354\322\302\006\310\236L\256\020\331\263\310%\342\357\302V\306\351\236R,\301\f\013\023\2173r\207Ib^P\027\306\271\0078:\356\240\036\004\354\362\341A\\\f\243\203\346tO\"\370I\215\0173\207\033r\201\270\t\252\306\207\307i\341\2427au\234\354)\344\376\202\254ItO0\037\236 \367\305\345p~yt1\361u\"'\217\273y\022\331\263\311\315P_\256\0269\376\362\3676oj\361\312\366\222x9\361\353\243\300\262l\337f\227\227w\221w\373\223\356f\321\275\316\bN\217s\240\2241'L\270\242\3237\306F\277\276\263\277\355N\354\214\352\376T\342\254\005\301\001\356\321w\203\020q\275\271\364\356\346\0165\322\272\321z"
+	.string	"\344\214\364?\332$\234M\317\025\220\252\3615%\332\237\240\270\336D\221]M\360\320-zP\2633w\252\334\235\302\317P=h7\223,S!\224>\271\221]U\313"
+	.ascii	"\322\343\243\274m\023/Vz\247\311\013<\351\273\245\246\2567\273"
+	.ascii	"\250=\262\207\267\365Y\335\323\345\375h\267\3473D\302\372\225"
+	.ascii	"t\003oC\345\333\r\362\355\343\223S\223wqW\340o\336LK\371\266"
+	.ascii	"R\202\337m\004~\346\236\2044\300\275x\037\t0\312"
+	.string	"\267\001\370\030\357\242|\233(\350\366\220\357\2661\337.\346\333B\300\333D\007\343=\314\267\205\301\333A\301\333\301\340m \360\366o\375\335\366\255\267\263\247y\253\3706\366\335\376|\373\346\333\356\300\325\352@\211D\331{\273)\313\325\376a\335\250qQ|\214\373\233;\030w/\356i\355l.\327\035\354\032N\246\225\356X\226\r\212i\217\033\303DD\323\341fE\230v\2707\031\230\005\233\262^\304\260\034zez'\276\264\273\201\tk\320\345eSG\351%l\360P?o})\037\277\201\322\013\377\370\316\374Z\205\257\364.\347K}\362\226vk\201\256x\237d\026\341{\234\343\261\2564<\250\331Y\323\222KV\320G\367x\036\201\337\230\264;h\031\037e\347\021\343\366\025t\252\034\364N\2066'\370\300\017\372<\307\364\261l[\227\221\231>\370\276:f\331\026\357\271l\364\3007\206\351\200c\226-o\353C\344v"
+	.ascii	"\001~\264\025\374\017\301\377\210\324\230\201\336\td\337#\370"
+	.ascii	"\276L\260\345m\2658\236\244\231\357c\200\271e9\313\317\364o\207"
+	.ascii	"\351v2<\335\325\031\360\371\001,s\264[V\226\267-\363\373h\253"
+	.ascii	"jW\332\024\2645Z\327O\032!k}V9\311-NR\226Uz\263\316\357*0\220"
+	.ascii	"\262,\033!\216\333Y\350\013\031\25673dW/\313z\247y\027Ck\363"
+	.ascii	"?\340\361\337\274-*\313\177\374\007L\r\315\216-\220\362\266v"
+	.ascii	"\220H\331\363}\264\335\315?p\265L\270_\372V\207?\340\235\375"
+	.ascii	"\002\276\261\272\276\021\207\354\357I\320\344h]?\335\275\301"
+	.ascii	"\3518\254,\253\365\240\375\215\206\016\253\213\354\252\277\232"
+	.ascii	"'M\212Y\226e\363G\373\026\361;\234;\327\032\020\036\030\377\360"
+	.ascii	"\003X\310\027W\030k\352\252E\013d\216\341QSVQ\030\253J\006\322"
+	.ascii	"\002\013+\244\324\224U\260\nI\205\025%E\325\202\352\352*\352"
+	.ascii	"\205\324\220\306\024\213**\265\245\236` \255bLM\251pA\325\242"
+	.ascii	"\n)u\254\242\212\202q\224\262\272:>\035hd\214)\253#\026\022i"
+	.ascii	"u\f\266\322_I\257\001\221\262\207\247\374\245\030\321G\233\370"
+	.ascii	"\305\370\264\356\265wn\202?zgc\243\372\256\346k]\313\346.p\001"
+	.ascii	"\357\\\340G\301&.\001/\357mh5\372\366\031}\343l\364\352\223\037"
+	.ascii	"\375\323{\233\037\331\332\333\304\350\344F\357\364C\313f\233"
+	.ascii	"-(\200\357\356\021\327\231\034[\222\336f\001o\352\001P\"\254"
+	.ascii	"Y\246(\313\r\227\"\021\351\033\017\221\276\350\235\227(\364N"
+	.ascii	"k=\330\f\333\227\362}g\337\367e\251-Q\n}\264\211^x\231&\210\336"
+	.ascii	"\363\344\234\031\277/\216\f.'\275ZC\237\353\266\250\024\337\370"
+	.ascii	"\316\274\312\344\230\333\271Y^W|\237\025\337\203\004\r \342G"
+	.ascii	"\273\300V\217;\302\246WZ\353\361\026\004\365H\357\364\344X\026"
+	.ascii	"\372O\202\301\003%\307\234\356\272\223S\034P\262\312\352*\202"
+	.ascii	";\241w2\260\267\275\270\034x\320z\f\2312\361\233\376\363\230"
+	.ascii	"`K\246\214\364D\225\b\030\334\322.\200\270\250a\034\246\024d"
+	.ascii	"\b\321\314\214\024$I\322\001p\002\2211\272z\020XG3\223$\255\001"
+	.ascii	"+\220"
+	.string	"Y%\001\372\004\254i\246\377\213$Js\236 \315\322C\374ify)\260\362\226\307Oh\2212o~99v\240~NDg\220\235\0216M\"\022|\225:oPN\0134\263\2503\022-M\373\227\2106[\344\321A\273\2424.nq\337\032\224\355B\243g\357\325\250z\\\"\304f*?\331\304\227S\331:\225\215\221\216\200m\030\002+/L@\317\324l\021\3247\030\270q\021v\032\266c\316:\347L\016\334\354\376*q\3371\006G\274\037\236P\271T\007\017\007{Ot\365\256\200\035\324\201\305\372$\305mZ\367\201\312\200\304\361\\!\177\223C~\2167\331\013\243a\261\272\341\3240h\240$\376=S\025\002\250x\222\270\020=\001\305\017\324\003\023\370\320\341\225(6\001\374\2062'\222p\274\305\333\3121\356\253\033\251-t\215Lp/\212\365\210\354\277\355\266\3567Q<\342\027\036,b\361\220\330\n\200\n"
+	.ascii	"\254\222h\323\b\003\345\317\302\340\363\235Tn%\334\345\365\345"
+	.ascii	"\327\365*l\227U\255\\\271\022\207\034C\32678\313\343\206\231"
+	.ascii	"c\204\245\371\177\024\371u/T9\253\360\260)\227P\264|\340\263"
+	.ascii	"\245\027\340\276\007\321A\201\0209\002\316\204'\200\030\355\374"
+	.ascii	"vv\320\371\340\356\2073(w\211 \304\257\374\250"
+	.text
+	.section	.gnu.lto_findEEPROMIndexed.27.ada251a661a65a97,"e",@progbits
+	.string	"(\265/\375`\324\003U\034"
+	.string	"\3464\271I\240ZQ:\305\027\004\025\232\n\030Hr\231\233\255\251]U\335\262\323L\006\260\376\020?\215mV:\313\234\315\346}\032\2731o\367>\365\323W\351\300h\300\245\344rF^\366\351Gn\034\340\316v\331\n_K\376\336D\356$\003\245"
+	.string	"\227"
+	.string	"\247"
+	.ascii	"\305\235_\244{\"4\301$b\356\0352x\345\n\244\323\211BW\222\202"
+	.ascii	"\214\335\336\215\243\204\362\025\001\311=\\\361\004\002\245o"
+	.ascii	"b1 v{\304\031S\367\016\033\260\203\362\365G\216D\210uM\344bw"
+	.ascii	"#BP\350[\202\346\336!\215\207\237\331\327\3622\373\3329\330R"
+	.ascii	"\335\313\226\255dS\035\037\300\257\305\313\357\200o\301~\276"
+	.ascii	"\033y\324\006\223^\203\004\231\214\261\201\004<IN\020"
+	.string	"\026\331\001\373\271 \333\311(\345S\247F\277\036\355\033O\022\001Z\361\256\242~I\247\255\236{/\323\242\037\322\331ufNb\346\033sC\005%\370>V\330\327\234~\324\025\020\t\211?\204M;zd\036\362h31\377A\225\025\036\3348\230K\312\263\222r\216\213\262\f\247\244, v%\177\2007\375\260\222\362MI\331\346\303\377\305\224]L\271\365\342\331\226\224\253\2132YR\356\026ez\251\363uL!G0~7:s\357\321Q\315\325R\251\200\\\352/\2362\237\371O\374))]\354V\335\377\324\004\241,\224M\356$\367'\326\311\361\241\036\305\374b\024\177\342\006X\367\336\027\n\346\327k3\013\361\215\374b\346;\226l\234\376w\254m\262_\304\027a\206\226xP4pL\251\315\304\007\212JK\035\353\267\021\027xB\243\f\331L<\353\356\223\350\245G\3230s\207c\271\362\301C\351Cg_\2735"
+	.string	"\273\030\241\315\257b\276\250\343\336\335\213\370SN\005\204\217I_d\332\327X\367\232\241!\265i\177\352\024\262\200V\304+cVs\001\343\024\325l\3232\227/kw\374\002{\3236\315\324\007\274\351\373\222\312s\024;k\001}'_p\306\f\357\252\230u\340\370\232\315\351Y\0170\343\003\362\350\221\037\305\266C\271\225\367\366\036\360\251H\004L\202\307\006D\263\001\311D\2348\263v\332 \234\211\034\371\203\273\005\371\230\267\021\267\\\316\307\204\t\263\325\316VQ\023\361s\253l\362\234\300\235@\265\032\b\333m\304\017\316\244\375\334|N\320\3143G\343I\3008\240\332I\013\302\341N\332\213w=N\266\\]\243\250\264D\276[\255\346\236]\363z\224\004h\200~5\254\231-\\\240/r\365\fu\013\0031\204EZ\315\304\237\372\217\206\224\262T\234\326)\312\310\242\262\266\030l\355\223\370\245G\323\234\347\202\301"
+	.ascii	"\326\275\275\b\314\031^\265aK\b\0169X,\354k\355\033O\222\001"
+	.ascii	"Z\031\241\"\357\275\327\006H\250Q\034\207\0303\306\b\020\021"
+	.ascii	"\021\242\032m\323\001P\002!\344\034o\020xH\252\016\260\234\244"
+	.ascii	"\326p\207\331\225/\342<iY|\330\027\242\211j\237/\027j\314\266"
+	.ascii	"_\030\374\f!\274\323\302\234\225\265) k\301\2149Ib\026\312\362"
+	.ascii	"|\247jR\256\246R`\365|\262\177\374\022\327IX\021\n}\227\270\206"
+	.ascii	"D\311Td\227\232F\217\344\035\204N<>T\n\244P\320\"\333>0\f\026"
+	.ascii	",\035\035y(\n\036&\336\277\3113b\201\232\002\273\371!\026\032"
+	.ascii	"G\320\374H'\035\271\217\355\321\316\007\026G\275\017;\341\017"
+	.text
+	.section	.gnu.lto_isPGModified.28.ada251a661a65a97,"e",@progbits
+	.string	"(\265/\375`L\003\245\030"
+	.string	"\006\357\243H\240ZQ:d?I\375\222h\275\3313\243\005\213\333\037\036\0269(s\004S\302\202\371\205\007\372Zg/\356]\274\320\217\332\243\376\375\212\243`\200I\200aF\030\320\323\226\222\"\3435\330Y\373(:\365 do\"\245L\001\222"
+	.string	"\202"
+	.string	"\226"
+	.ascii	"gj\365\371\354|\204\261}/z\\5\367\363\361\200\371_&\313D\264"
+	.ascii	"M0\366Uk"
+	.string	"\317\212J\255\276\004_0\356\274oy\350\316qct\347\3773h@\364\242\036\031Fh\024\024\241\322=QS\253O\326A\266hE:\303\346\242/\005b\003\313\2564Z\261U\352B\001\265V\2324\307\035\033\206<^\200X\265J\031\341\201\036T9\3102\307\035\"\2502\302\243U\"\2051\245(U\373[\236Q\346\230\305\t\265\326\363\256\304\261\037\367\377\321\377\016\177\247\b3\032\357\216\325!\024\030\246.Im\364\373\220\270\227\376\rk\367\376\221\017;\3775\362]#\177g\344\267D\276\316:\355Y#\237\\\337n\3166\355\342\260\370\"\213OI\376\314\341\2078\374\036\371,\3627\306ZbUn\r3\265\336\b\272\251]\246\025\"\353\264\373\357\027j\243\206\326\311]\360\200I\206\276O\366\351'\317b\235|\245x@5,~r'\377D\337\337\311\377N-\\\365K\335\322\252\b\227P\002\0047\003%\033\326"
+	.ascii	"\246t\274\247k\330+\034\310\336\247e\236\026\340\206\225\342"
+	.ascii	"\300k\276\246\f\024\227\331K\337m2\275#Wa\367\256\323\333\373"
+	.ascii	"[V\242\261\304(\r\230"
+	.string	"1\255\326\351\325\275a\355\247\350N\267\272g*\351\r\022\007\277Q\367\260U>PA\001\342;\344\005\335\271\323\033\265\254\324\346L\220\351!v\212\210\261\326\234\203\257\024\240\021c\255u\207\354\334\226\300\003*i:\342 W\031Q\252\322\333\202\262\272K(B~br\314\346.\376\226\2409\215\323\177?\361S\023\222\325\204b3\032\256k4\\\273\240\231\b\262\315\317~T\334pB4\032\211\232\r(\3506\223\005\331J\250\220\315pC\262\037\002\277\t\321p\262\025\267\033NF\372\2166\254\335;S\237\345\020\301\212=\343\377\253\005\0345\322\305~\365\352\246\350\263\264\201\006pw\330\263\377\242&\024xw\264!\374\330-\266\335\375\025\226\312\302\316\331|\265\323qa\263`\b;\006\357J\211\001$:v\320^r5\217U?\272\005(\254]}N\352\001\353\236R<\340/L8 \220\242\t\256\364Q1C=3"
+	.string	"{NgY\031+\373\225{(k\013\r;\356\033\277\361.Z\274\265Sr:\310\201\r\"\345C\231Un\bm\274\350t\262\203\3612\220\317U.\364SA\371a\231\016uG\212\372Pl"
+	.ascii	"\207\341L8b\266\3068$\007\300\266<g\253\375\211\351\036\021\005"
+	.ascii	"\201G\314\360L\b[~X\233(]\246+.\3540\0074\342\352w\206\346\352"
+	.ascii	"b9\031\013\210\234Q\007z\006"
+	.text
+	.section	.gnu.lto_isEEPROMUpToDate.29.ada251a661a65a97,"e",@progbits
+	.string	"(\265/\375`\327\001\225\021"
+	.string	"\366axH\320\322(\035\030!\2453 77\214"
+	.string	"A\204\214 1\354\346\324\251\0368!3W\2323\004%\220QW\270\305\213f\035\020\365x\370\300\340+\017P\352a\224zX\0269Pp\240\352H<\321I\243sa?\331D\312\224\002e"
+	.string	"]"
+	.string	"c"
+	.ascii	"\002\276G\017\346%\337\243\0314\20096`F\366C\201\315\307\206"
+	.ascii	"\237\244\3350\245%\374\361\340\b\345\340\301\021:\272\027\336"
+	.ascii	"1c\377\242\247\031\363e\377F\300\331uO\0320&\243\355\346\236"
+	.ascii	"\007\241\207\305\211\021P\306S\034\320\f\0248K\275\356\b>\f\311"
+	.ascii	"\035\005\2017O\023\312"
+	.string	"\356:i`\207\333t\3335\333\017\354\314\252c\337AQ\r\024\326\034\333\344\264>w\247\323\027Q\361P\253\001_\263\333\255\355\226\226(\312P\361\334\357\363\264o?\364uF\371.\216\203=\247!\300\026\355\301%\233\020\244\335\360\344\364\350\360t\033\346\337\214\362[\274\007v\237\227/mEp\330\222\220vm\022<z\301\351\221\200\315\003*\357;\217^\261\276\323\036}\326\367\230\n\200D\316\206L*\335\333\335\215\007^\362\245\232\2645\242vc\266\"&w\371\"D\016\rOu\034\373\256\257\334\016\231T2*S\377C\201%O\273^w\022\035FA\324\210\007.H}J\277\302\367\3607\227\023\315\276\200!O\363o?\031\001!\232Q\231\035\3122\254\325K3\254&\264V\242U&,\256W\313j%\201\265\242\322r\251R\255\225\024\226\224\352\345\2222)`W\313\352\225\262\340r\275R\250p\2579=x8"
+	.ascii	"\r\305\353.\262c\033\0024\244\017\272*\215mU\243\300h\214_\274"
+	.ascii	"]\021\021\356\363\337N\202\204\313]\212Ou|\002\3023\251I)\235"
+	.ascii	"\3022`\"\225f\210u\332\235\301x\214  `\002\231\312\353\252t."
+	.ascii	"\206\225ocCb\206s(\326&K\270N\304\300\300\032\204\200L\316\026"
+	.ascii	"o\261n\f\342\214\262UQ3\376.\211\246z\265\230\355\267\233A}\023"
+	.ascii	"{9c\024\356\n\226\t\001gT\224k;\3277i\342\211\227\200\311"
+	.text
+	.section	.gnu.lto_loadEEPROM.30.ada251a661a65a97,"e",@progbits
+	.string	"(\265/\375`\347\003E\035"
+	.string	"\226v\301J\240\230Q:\020BHZ\360\335\262'8P\216\205-e?\021\254\260\320d2\326\337\241\3028\200\247CO\337\206\376\350\037\205\342T\035\233\254\331$\201\217\353\301\022O\277\\\316\234\276\247R\215k\253m\250\374m\237\020B\266\334I\006\254"
+	.string	"\242"
+	.string	"\262"
+	.ascii	"%\177\351L=o\202Q\343\223^\336\354h\210\265T\346^\241\005/\371"
+	.ascii	"\001\372\262F\350\002\314\227\326\3475\363%C\210\320\303\273"
+	.ascii	"\247IA\001\2104\200Se\356Mm\355\203M\342\320\250E\034\032\267"
+	.ascii	"n\3233Zw\177\241\247Y\332\256;\376\323-\222\241\225\250-%B\336"
+	.ascii	"_\366\374\t\022r-BC;\001yt\362b\257\242=\206\210~\302\2046n\242"
+	.ascii	"8^\306\204@[s\357\235\t\177\252\265\265\241Qk&\374Y\006Z\304"
+	.ascii	"\034"
+	.string	"\267z\005\022\372j\277\370\362h\310\265\324e4D\364zV\270\367r\r\n\207\316\2603\263\0243c`\356&\001LX~M%\345G\330<\253|\234y\250;\341\240A\346\234\024\365A\256E\242R\327\361\247y\314)\2576\022\363'$!\301p\363`\246y\325\271F\373\324Y\026{z\206qe\364U\3714+\233h\345\022\255l\317\312mV\256e\345\017 \220\325\333\"E\f\352\255\364\006%\315\\,\245\223!\257\372\247\376\246?\275e>\363\251\370V\034\253jQ\241\027C\003\261H\311\002\037\212_\344X\324\245z>\365\302^\242\364\016\001\3302\344\242\220\242g\356\341;\375\211cOw5\274\364\006\231G\3034\265A\037\375\3421\204\031.\211\332*\026\351\325d\255q\032\250\0272\314\212F\260\272\216\276\307\240B\343\207\331H\257IDVY\345\316D\373F\005jm\263\317\2265\363\006\016\365A\264A\350"
+	.ascii	"^\212N\207G\361\360\362l{\025\274Q\266\331\025\n\360\f\200d2"
+	.ascii	"\211|\316\264]\266y\365+\352\325$w\333>\360\303\237\200\350n"
+	.ascii	"\360\243\351][@\257\013\325\031\016\361&#\320{}\022\370X\"H\004"
+	.ascii	"y\371\216@\344\212G\021S\223OM\326&3d\274\330F\342\026f\255\373"
+	.ascii	"\311\230\214\372\342\253H\246\325\033/\353+\271\023\216\rW\t"
+	.ascii	"\023\365\301Z\337\352\001\270\264\0027\234\256qp\272\346\341"
+	.ascii	"\301\335n,xN\027\270\023;9%\337\034\350\344t*p\270\02289(vr7"
+	.ascii	"\333N\216\t\035\333M\307csp\200s*p:\333\212\\Ng\213\245\367x"
+	.ascii	"\213\306\232F\353\331\357"
+	.string	"\210R\327\321\247{\f\303\336kD\341\351\264#TM\036_\215\30469N\232\004\310\312\273$7\257,\3061EK\262\006b{\302\372OG\271\020\211\200L\352\2773cWn\320{\177\017\362\255<k\307dy\347tc>\370\222\177c\276\224!\2201ck\207\230-U|\025y{\357\275\250\265\261\027\027\"\020 \223\362S\016k f\005\257\231\262\246\tE\250A\024\006)\305\020R\002\231\t\250$(q\213\001`\002\231\271\254\007\020\2107Ja\330\f*\243ow\037\312\330\310\230a\251\334\306\244$p8U\317g\340t\200}\305\013\321\243{\376\203&\207b\330\362\306\254o\004\314\215\316\245\221n\256\262\3048\313^\003\366\r\271\274A\007N\203 n\201\275(\374\356\3048[:\210\201\211\252Nt\335\3502\252S~7 \023\n\325\266\201\223\233\n\262-\230\357} \200xa%\226\r\355\246\342u\f\272"
+	.ascii	"\342k\032\362\025+\276'\310\005nq\202\261\367\007"
+	.text
+	.section	.gnu.lto_writeSettingsRecord.31.ada251a661a65a97,"e",@progbits
+	.string	"(\265/\375`;\003=\030"
+	.string	"\366-\240I\260\030q:\261\232\301\367\325\024;\013S\255\025\007\370&hc|9\034\2648@j\232\245\351\305\220A\222W\321M\365\224\300\336sW\"d\027\351\024Fz'Hy\356 Bv\200\261\346\253\r\023\206\324>{QQ#r'\031\211"
+	.string	"\206"
+	.string	"\220"
+	.string	"\267|1\227\017\233\031\306_\271d\245K\201}\311\305/\215K*\261\255f\356\305\261\340!W\030\037:\020A\373$\325\342\334!\331NB\037\275H\341\334!$$\021\254e>\356P`\317\301x\316\275FNU\356\3155\340\007\343C\316\215\314\314w\362'0V\025\314\210\305\016\330p\263(N\367\346L\234\013\020\037\332\243\304\207=\344\352\255\312\377z\f\262\"54\"\031\267"
+	.string	"(\334{\331\322\210r\234\373\314\214\200\231K0\367\221C?\374+B'\337\310\013\361\341N\177w\0036pH\265\033.f\177\3149\231m!\314\007o\0331\223\226W\244\345\035\322\262\212\264\234\322y\322\031\365\244?\347\271\377\206\264\\\332X&\177\364\217\240e\261\264\034\226\226\301"
+	.ascii	"\226\033\264lI\313\347\261QC\206\350<~\367\336\370\255\271\275"
+	.ascii	"\220)\311\227~\346\363\255\234\t\275\216E\324\3040A\251\234\307"
+	.ascii	"\342:\356P\013\343\304\202?\345;\346\222_\327q\214\032\030&\367"
+	.ascii	"\006EYfO<V|\006\361\272\257\032 \020\241\3354\363\006\016\366"
+	.ascii	"4V\340\263\365h\264\f\346\017\020\231=\214h\310f\376\360\025"
+	.ascii	"D\331d\177\366dsn\022S]\366\231\016.\031\322\263\351PzR5s\210"
+	.ascii	"\257#\370\347\353A-50H>\335\031,O\265\252SixL\342[L\244\372\274"
+	.ascii	"\033\250qk\346\023_U\376)e=x\2643\342\023\210\253~\177}\250\244"
+	.ascii	"\026F\346S\362A\340wU\334\351U\253\232f;d\366\307\3371\320\233"
+	.ascii	"X\343\275\001\254\302\247\3452[.\024\212\024e\235\251\310JY\335"
+	.ascii	":\323N\317 \2403m\361\032\231\345\023\204\246\256\363<\321Z\221"
+	.ascii	"B\be\231B+\200\202LV\3722}\n0\352:S\263\005\212\246f\231\213"
+	.ascii	"\035\274m\244\323\357\371n\275X\313\330\005x/\220\t_\372\315"
+	.ascii	"\034u\207-\352t\017\252\305>\2271a\277G\255L\023\\7\330\345\017"
+	.ascii	"f\365v1*\224\361\336\0136\203\"\270Uw?HQ\227\331S\314\336\313"
+	.ascii	"M\333\314\026.\330\323P\335\223\323\266\305/\001: \220\242\241"
+	.ascii	"\273n\363b\236z:\251i\3147\034]\254I\332t\247\037\213V\301\b"
+	.ascii	"h\270\037\224\347\303\244\300\342*,\367\332\222\374M\003h\276"
+	.ascii	"C#\333\235\306T7$C\373\n\213\215\351n\354\032?f\353gv\275\030"
+	.ascii	"N\360g\245\274y\245\203\357\255/\254-uI\351/a\304\350t\355N\300"
+	.ascii	"\342\226'\314t\332\030\211\002\307\234l\213\212\315'n:\301&\371"
+	.ascii	"\234+\260Jd\204\340\360\356\032A+&\301\220\001"
+	.text
+	.section	.gnu.lto_writeSettingsFooter.32.ada251a661a65a97,"e",@progbits
+	.string	"(\265/\375`\360\001\315\021"
+	.string	"\306\341vH\340\320(\035s\206X\207\364\347:\213q\031Sk\030~+\026\"\023\203\355\344\233)n\362?\001b\367h\373{\037+\026\240\262\273:D\260\240\006\200\022\326A\326\306\307P\210'E3;Hiv\225-\277\211%M\312\224\002`"
+	.string	"^"
+	.string	"_"
+	.ascii	"\363\007\3019? \255~\346\322\217\t\023#\341@\325>\213\267x\371"
+	.ascii	"\330\341\2509o\206~\346\034\023X\001\351\234G\222m_\305W\274"
+	.ascii	"\3305\342\001\006+\240CC\26634\347\330}<D\236\323\203\310s{\342"
+	.ascii	"\256\253\313\177\355\024b8>\242\314\353\n\240d\316i\025eB\334"
+	.ascii	"{\333\006l_\260\365\013.3\2600\"G\n\0340\275\331\343K\327\204"
+	.ascii	"\375\321\334\033[\252SV\243>\273O\237\375\246\217\177I\252\245"
+	.ascii	"TsR=Z\365\256ZW\375\220\223M\217\314K\310\230\363\303\215h\332"
+	.ascii	"8\030(N\373y\256\366\213\277\363\232M<-\2439S\242S#gN\020\025"
+	.ascii	"h.\237\342\374+G\207Hh\0066\271\342\rn\345\352\f\031MjG\313\355"
+	.ascii	"k/\311D\354\246\326z\237\237v\264\002^\304\024\221\356\030Rw"
+	.ascii	"\3671D1\275\371\264\272\003\200j\202\002\350{\336}m\357\323\213"
+	.ascii	"\247\0251\355W\002\325\370\310\212<T\257\222w\361\232\206\005"
+	.ascii	"8bi\355\025\250\027=\022d\303\026\263/\373\007\244\275\341\265"
+	.ascii	"\341\327\002\301\024\351\205\022X'*\024\326\004\025U\004\224"
+	.ascii	"\257\025~\034X\252\224\027z\033~\253\223/l\261\220\354\221\254"
+	.ascii	"\300p\345\373LTT),\320\353X\252\223U\347\205,\035\t\001\203+"
+	.ascii	"_\330\265@0\354L\343\374\336\3306jE`\033\263\013\255e4\247\r"
+	.ascii	"\204\363\374B3\332Q\333\200\206\246c\006D1d\270\331`\366e\217"
+	.ascii	"\035\023\230\035\001' p\2421\213<\252t\202\0263j\324\017!\317"
+	.ascii	"\304\277\035\003\303[l6\314\301\211\260\330\255\322\n\306\215"
+	.ascii	"$\267\275\215\217\245\316\202p8\031\026K\317{\305tR%\020\276"
+	.ascii	"\370\303\222P\254\211\016\313F,\013\\\310r\270\342\b\017\211"
+	.ascii	"1\177qB\276\347\n\016\377\256\321Z1\t\206\f"
+	.text
+	.section	.gnu.lto_writeLogHeader.33.ada251a661a65a97,"e",@progbits
+	.string	"(\265/\375``\001\355\016"
+	.string	"V\334eG\340\2228\035\302ap\\k\310\030\321q\321\033\317\rk\021\t\026\3200\223\220\006\214@T\205\321\235\220@\257]%\022\207\f+w\300w\325s\220b4\032G\024\220\240P.\350\001\201\001\240\230\032\020\202\021\215\264\275S\nO"
+	.string	"P"
+	.string	"S"
+	.string	"\323>\214\317\240>r8\200\335\026\017\033\273c\002+\320\236y\324l\373..\203rH\342A\2452\020\323\302\022\343\307\356\310\211|"
+	.string	"\347\331\274"
+	.ascii	"\3163\212\342\341g\350\237|\204\025L)\262R\237\035\b\273\353"
+	.ascii	")\262D\334\364\266\017"
+	.string	"\330\246`?Gcj\322\023\366\261\245-\333\323\333i~\317\307\277s\327\237\321\351\177>)ZX\177\351\261\013\242\004\2626\331\215\025\177\3756\312'\275Y\306kP\177\251|W\366\037db\\nvC x\346\t\332\263\021\214\246\205\t\235w\205Sd;\254\\\034\314\3638\316@\307\251]\341d^\334\350\210\207\236vV0%K\220\220\211\275\343|\306\311\272\340ew/v\250-\032\315\213&\331\361\302f\205\246\234Q;\303\311\320 \017\211\031\322khWq\002\034\333;\r\024\203l\360\344\311\240g\026F\324\260\360\241\232\245\035_\275\020\252\022D\236\006O\367\231\200'o\264\241~\246\255v\245zB\251\240\366UR\250~)\240\346\256\204\344}\246ZOD#\f%\257\343J\243\020\211\353>\220+)`\317T?.\305\363>n\033\367\330\322\326F\033\224P\321\225U\260]\023\017\376\372o\\\263t\200\034"
+	.ascii	"\252\244\2231\r\242a \2509\320\360T\222\252\n\004W\005\200c\240"
+	.ascii	"u@\235\330P\367\271\206O\306\006l[\230,\346\034\332\245\301\005"
+	.ascii	"\210\0070\003#\200\006\234\204|`\256@\205\203\273F\252\025\223"
+	.ascii	"0\311"
+	.text
+	.section	.gnu.lto_writeSettingsToEEPROM.34.ada251a661a65a97,"e",@progbits
+	.string	"(\265/\375`\237\004m\037"
+	.string	"\266\272\314J\220\232Q:\004q$\315;\215\220\262V\365\206%p\304L\004*nP\0374\032\257(\254\332\342\2766\2002\315\265\177\356LS]\263\fq\310\255Em\240\r'\313\364Z\276\223\243\023E\216\003\223J\266"
+	.string	"\212\226\304\022B\366N2\273"
+	.string	"\250"
+	.string	"\276"
+	.string	"W\327\352\033\254K\321=+' w\311h\324\260\311\303\371\362\266\t>\300\264*z\376\345\357\224\f\237\030s\276\241\201*\3063\233\237\323\f\263\214?\237:\024\335[\0314^\233o\334\364\230\214\026\316\227\002N\300|y?\300|\371\250\031\264]\233\201\262\260\246b\024\203\227\375\340|\331\020&\350z\335\361\355\3148\030.\031]\245\311\271\255\341\"m:\355\330\372\342\264cK\354d\373&\357\372\222\304w\355k\235|\022\226\331\275$e> \222"
+	.string	"A\037Ya\314\350\365\256\337\243`\357\222Kt\034\277\353\013\204^zb\304\240\216_\031\206\234s_6\210\343m\276\273{\335}\242\233l\0229\367\346\374\3762\217M\240\270\001\362\273\025\233\217R\316\274\263}\257WI\321gz\331*l\367\354\313\276\r\343\245*\2436\274{\354"
+	.string	"\367\304k\245'\333\r\024t\317\366\305\372*\2521\322\300\273\356vwqR\367+(\215\031\033\017\351\246\365<\352\315\263\363\366\255\223\203s\256\367\354To\024\275}\242\267e\350msv\273Do\223\350m\214\336\276\347\355\037p1\005\264\021\374\021\261\234\201\3075\271Xz%9\327\037\365\267?\325o\365g\335\354~\367\211\375\256)\337\322\235\013\306\203k\206D\022\355\371n]_\352Q^\3654\037\3365\016\306\370Z\017\321cBS\342\244\246 \3044,\033\273\275:\255P\357!\364\3624\303G\357\372\201XX\246p\017\276\326_\003\013\313\217\233\203Q|\324\rf\205:s\376}\271\330:$W'+\224\271B\231/g\030"
+	.ascii	"\221*-4\356\330\311\234s&q\322\325g\230\206\207\220\230\300~"
+	.ascii	"Lz\367\330\b\356\3053|*\253\324\n\345\236\355\3014\024_\374\256"
+	.ascii	"k\bc\342\202\261\0240_\020w\317=\227\327\224\360\361\370\376"
+	.ascii	"2\273\1772\334\2639\370W\304\344(p\3577\230'\376\212\203\004"
+	.ascii	"0\035>$\bs,\376\360\256?\005\342<\303\273G\003f\267\210_\215"
+	.ascii	"h\237\022\302-Og\002@\251\212\325T\310\226\252D\271SMW\330\322"
+	.ascii	"\026\346M\275\341\233\372\263\"UqD94\227Ko\267\242\234\254o\r"
+	.ascii	"\204p\352\2134U\001\024\304b\bw\253\r\005\331\204j75Wk\200\240"
+	.ascii	"q/R\265F\204\303\251\265\2336\237$Q\214\303\203_\024#U\344\341"
+	.ascii	"^\027Y\345\310\234\205\\x\326o\244\272\307f\360\023\363\340\263"
+	.ascii	"1"
+	.string	"\362\352\335cG\270'\362X}\334\263'.\200\225\245Upe\275\203e\370HM`\016.I\f\262\"\335\263;%6\361\267\030\265\351^\223^&\306\231s\366\351\2179\231\265H\033Y\227\356\222\371\262\3045#S:\230\304fX\023\025\005\027\343\023\223\254K\356Y\035\034R\250A4d\frF\221\231\231\240Ff\324jp\002\2319+\017\021\260AD\264\240\325v*\344\347\001\214\303\320\3178\307u\344F\035\022\317\224\342\204\223\246\243/xE$\316\241f\202\272\316\013WS\027\317f\213R'%\022\260\214\250\216\350\360\240\2632G\352\233\256j\024\020\021aN@k\314\312\027\002\361@PZ\270!a\372\323\331\nJFe\230\372\361b\3010\225\206\r\242\251\222#\327Ov;\003\004\334H\204akV\r\030.\274I6\026k\300\250W$\340>o\333^X\307\212*F\323m\251-\202\366X\360\207/\016"
+	.ascii	"\005\t\374\304\224]5\005 \177%O\r"
+	.text
+	.section	.gnu.lto_appendSettingsToEEPROM.35.ada251a661a65a97,"e",@progbits
+	.string	"(\265/\375`\272\013\355A"
+	.string	"\332t\324\031?@dN:\033\f"
+	.ascii	"J\231Q\0262\001\273\b\201\203\024#\200D\334\200i\"s\324\303\206"
+	.ascii	"E\331\255\377\024\212\336\016.!\364k\372XJ\357\"%r\025\250_h"
+	.ascii	"\250\205G\3611\266M\032\331;\311\226\001e\001\220\001\177\237"
+	.ascii	"\257\022 9B\034\320\262G\261r\224\177\323\336\013\021\224\233"
+	.ascii	"D}_)\f8\255\307\266\301Q\353\004\337\367E\341F\307\372\262\001"
+	.ascii	"1\267\326\205D\321\356wdg\243\003\031D\372F[\346\030?!\212\037"
+	.ascii	"\"\3274\237\222]\315\216\343\353\367*\325\315e\241\276/tC\361"
+	.ascii	"C,]p3?Cvi\017d\231\364\205\022\247d\0041\024?<~\212\375\020?"
+	.ascii	"\212\375\360u?\220K\351\213F\374\253\223\3269\370\260\265\212"
+	.ascii	"\037\366\004\nd\355Z\231-\027I\2203\344\\#\370\276\322\254le"
+	.ascii	"\252\331/M\340\b\372\322\004\016\340W\351{)\273\257\242\232\222"
+	.ascii	"\212\202z::51-\265F\245\"\221\035\256\031\273\375\345\253\362"
+	.ascii	".\202YG\007\356T\\\372\262\340\251\267Kmy\324\332\200Z\007\322"
+	.ascii	"\375\240[\326)4.\317\307A\265`\250\276\017\333\350\244o\177Z"
+	.ascii	"\233s\214\203b\361\203^\301N\367\203B\211\203^\301M\367\203\262"
+	.ascii	"=\017\0163\255D34.\367\203>Y/\020R\361\236\347Wq\320&x\211\270"
+	.ascii	"U%\315\311\333\253)ik7\372A\327Vd\034T\r+=\317\207mp"
+	.string	"\202u\203S\322\234\274\3702\270\0239\250\005\376\001\272\211.9\2732x3i\315\375\240LV*0et\303\246\250Y\033m\342um\300\306\207\244\215\006Y\247\376\264\035j\2126q^\rP\2012\330F\231+r\217\037\347\363\216\215D\233\030\023\267\336\367m\374\214\246\275\255\336}jw;\273\215\026\002\222\3128\"b>{ovX\344[\217]3\366{\337\261#W6\314n\355\340k\2561%\324}\342\200Z\257\370\276o\205\276\337\377R\364\267|\330*V\340?W\344\026j\201c\314\224\341j3\253\340)\262\276\317s\306UX\344\374\265(\314\274\374\355\004\357D\312\331\255]\366y\306\264P\020L\330Q\270\333\305\013\374\347\363\363\376\"\315>:\203Tf^vK\2318\273u?/y\257L;S\351\366\260\325\341\210\233\303\006\rG\334\031^\367\306P\341l\336Zw\363\226p\304\235\325\270\023\234\357\215"
+	.ascii	"\353\300\361\274\257\220\006\n\0200\342\036`\304-\300\210;@\343"
+	.ascii	"\006`\304mu\304]e\304Mu\304=u\351[\352p\336QF\334PN\270\237\032"
+	.ascii	"\367\261\t\267\023\023\356\246%\334LF\334K-\356\266\305mlq+\265"
+	.ascii	"\270\213-nb\343f/\347=4\342^\033wn\334\007! \320\364O\215\334"
+	.ascii	"\241\f(}\321\252\222^?C<\270\363\375x\376\272_\372\253\371\331"
+	.ascii	"\374n~8\277\234\037\357\306\356\367u\273\276L\244o\232\323\037"
+	.ascii	"\235\364z\337\323\3356\330\365\364\365\254\251io\247\237\247"
+	.ascii	"\333;\337#;\036\257G%\311U\251aE\260\356\366C\334M\326/s4_\363"
+	.ascii	"6\177\3638\237\363\274n\351\274\016\331\361r\004o\026\006\275"
+	.ascii	"o\331\244\027\272XZ\213\373\206\337\330\017\233\362\233`$d\246"
+	.ascii	"l\325\347\034\346\245|am\016\023\360\256\020*\211\336\324\251"
+	.ascii	"Z\275\016V+\347%_\340\224\217\204\334f\255\214\0035\331\bo\314"
+	.ascii	"m&\366\r~\230\215Y\300t\f`\223\315\251Z\255J\272\222U\312\022"
+	.ascii	"2\016\344d\222\257d\213Y)\263zM6f\273p\027T\006\026\035,"
+	.string	"\371\016\261%H\342H\260i\t\231\243\226\n\344a>\213\302Z\362\3211e\267\266\240\326zP@Xl\327\213;w'jU\301+\003D\354\372$*:82\237\365\332\022@k\366\341S,^\311\026\310g\215\334\271\342\3736\377\354/:#\367\313\352\312=\3359\366\303\253\254\025\335\253N\371\326\367}\337\245\354\326O\232\213\270\030\267\220\331@>{\236\337\211\335\"6c\207\334\253R\201L \237u\037\315\257\262\207\374\325\006Wm\202a\342*n\037\034\231\267r\323T\314^\201L\314\035\362\2632qe\264\246f\nxW\310^\001\313!g\345\306M6\003\325\367`3d\016\031\200\236\223\t\023W\373{\332\035sD.]\361}\203T\350\037r\353\3342\375-^\354\207\031\362\367\034\353\314\314\364P\231?Ci\330\030\331,6-\204\304W\371z<|\300\177\262\371y\3764(Q\324\217\331\335\236YT\211"
+	.string	"\356\213`o\347y#\212\317\356\022&\360\237\215\355\372t\031\244\232\345e_\270BH-f\267c\302}#\202\215\260,\033aQ6\222b\231G\222\306W\3270\351\243K\305\330W\322\313FR\331\216}\351"
+	.ascii	"\373@#\331U\243\213\006\230\027\323\230\230\2141\345\220\306"
+	.ascii	"W2\213%\275d$\305\306\224E.1\256\254T&\271\270t(\211\315\025"
+	.ascii	"\301\013L,,\231\214a\243\253\306\027\030W\326W\227\f\257,.1e"
+	.ascii	"V\204\003\r\026\226\024\313\032\003\003\023\313j\313\236\251"
+	.ascii	"t\330\234\033\347\034*\f\331\002\332\335\035\323\363\276\312"
+	.ascii	")\272\273#\276\317\023$\310\275U\226\231\275#\307\372\276S:\034"
+	.ascii	"\357\317\373\0235\r\256\256\251Z\247\260\262\224\203\017\310"
+	.ascii	"\030\362'9\361>` \221\200L\302\177\016\310\003\354\006\337-,"
+	.ascii	"`\3512\245\262\200\374\274@*\251\r\n"
+	.string	"\b\237\326\370\304 \220:\240\244\371\250\360\251B\306\302H\360\021\004Y+\332\367\327t\370\204Q\233\352\373\223\330\005r\211\322\220{\205\302\312\007\020\344\r\371\253\215\356n*\265\001\007\310Nw\b\376S\003V\016\220\215\177t{\316\252=N\226D\001@\220\317\007@~_\243\276CT'\rTg\300T\331\252\210\213\206\377\254\220\253\262U\024\237=\253\262\005BS\231\252\260\354\b\026\322\003;\2472kfmo\220\002\206\312Ny\211\333\004\331\314\313~\312P\031\202\263\260\f\277\357e\260O\371qL2\212\232]&\340\333\371\032\367\211\013\305\225\362\250\313 5H^\026\251\200\366\236\006\270A\243\034\217\021\360Rv\312\335\256\233k\005\377y\314H\263\274\354\246\354\224\037\210)\367\253n\200\327\250A0\305\020c\b\315\310\214\310H\222d8p\002\021*\252\252\003\022 \206I\b!\033\231\322\354\377\006NzRUY"
+	.ascii	"r\003\016\356\340\312\024\017\244,&\274/\260\313\274\034\253"
+	.ascii	"\252\251M\256\350K\361,\210\263(\256\217\021\036CN\273>\2124"
+	.ascii	"\231a\b\363\217m\013T]\031B\35218s\027I%\215\336X\253}\016j\337"
+	.ascii	"\\[*\250fs\004\223\020\224\263[\330\215\330\330\234;B \365\303"
+	.ascii	"x\200\224>\272\027\230\356q\207\326k\220q\241m\246\240\021\327"
+	.ascii	"\202\204\002x\00701u\213\227\026\r\221\357\241\354\342\333\241"
+	.ascii	"\226\032\326cq\337\245!U\0063t\247\335=\304y\250\232\370\336"
+	.ascii	"F34J\004\331\214\037\350\\\202\001\333\325\200\313E\203\264!"
+	.ascii	"\222G\251\177$\237e\020\t\343\032\002yUc\213\263\356\353\211"
+	.ascii	"\231\031\351\020p\007\220\353\270\030\301:6\207\2207\2349_/\265"
+	.ascii	"\364`\213\321\303\254\341\004e\b~\201+.\364\376\004\266\323\302"
+	.ascii	"\2627\202\024]A\277\322\356\t7j!\302b\035T\336\356A\030\232\002"
+	.ascii	"+\3060\262\204\223i\310n\223\263&\363\263\262\244\234>\3200\n"
+	.ascii	"\275\221\020\346\341\037#/\200\215\344\025\215\304L&\254\206"
+	.ascii	"\017"
+	.ascii	"\246\300{LD\246\273\336\310-\0240\276\300\211\366\337&@\372\334"
+	.ascii	"\330 d\246\300\254\353\212\322\340\3164E\260\240\ty\032\0212"
+	.ascii	"\034\230,\315\216\262\247\305\0239l)$\301\212,mF?\037\374\005"
+	.ascii	"G\364\310\305\006\220\017\274\271\rC\013\340\244\270\031\037"
+	.ascii	"\003g:b\"F\311\216\363N\035f:\272k\316f0.\025\222\3555\006\356"
+	.ascii	",\tb\250P\3027\257\007\214\243\314O\r"
+	.text
+	.section	.gnu.lto_writeConfigToEEPROM.36.ada251a661a65a97,"e",@progbits
+	.string	"(\265/\375`\244\003%\031"
+	.string	"\246\356\241I\300VQ:t\220\263\024\346\203\031\002\003\241\377B\267s\364Cm\317\341v\377\025\353\213O%Ng\273\tW\335\242\267\t\272\232\343'\334\365\"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\302Lc\3025\267\227a\233M\201\036\255\221XB\b\331R&\031\221"
+	.string	"\202"
+	.string	"\214"
+	.string	"\352R-z\311\242\007\324p\2204\220\272;\305+\224?\313\353\270\256\243\234L\243X\n\301\317\233\274.\2758{\035\005\005\016\317O\323@\217\211\244\023\311JLT\217!\3627\2365\315"
+	.string	"D2\022\263\301\332\314`;\036P\201\263s\321G\246\263%\334\017\370\310Flx\032\235\203S\201\221\016%)7-j\356#\313\331\217\364@\354D\231}\230\250\356\036g\261\345\343\356\245\270\005\331\222P\340\354|\301\226\356\326\255\231\341\\\001\\\365)\252\332\242\312\023\002\312\362\221\217{\202\037\037GrDb\313\204\273\373\305LS-_\373\346\036\325\025\225]5\375\347:\212\267]K_\r\277\n~\365\373\252\367\325\371U\376\352~\365\004\n"
+	.string	"\345\200"
+	.string	"\325r\360\220\262ovMz\310\333\341\342?\277\355\253*C\217\373\214\227\256\377\250\020*V\366\f\314\335\202:Bx\017\365\224\357\336\274\200\357\336\177\323Q\037@p\3356\203z\225}\363\245\260!\331\220\272K\226{\352 \274\027#\177|\0216b\300v\267\263\273{d\232.\310\362SO\r\211\324\225\026\334\3046\252\013>\362\n_\311\216\221\334\220\032<\260\335\251\211Uxq\220Ohv'\212\036\237T\274x\374\361\360Vf/H\224&3\f\326\344#Q\335\210\033BB\246}\217\226\320\222\200\314/\322\300l"
+	.string	"\304\256\223\214`\374R\243\356\376\230\006\364e&j-\177\t\357\211\356\227\3074\235\371\316/\312\025\361V\225\203\207}\315y\346\004\214_\177\331\335\223i\00120/+\031\231\n`\253\265R\2516\264@U1xa\305\300\254V\024.\270X\310\300R\2452\270TxI\251bZ)\006\b\224\005\263\212I\311\260X1\251\261\354s\217\266\3200\fEO\353\375\302\247\352\202a_\243\277\375,\216fC1~\251\204\240\031G\2479\212\\*mN\210'?\222"
+	.ascii	")\022[&&\246)\200\030\342\nw\250\361 uks\334K\242\n\377\3660"
+	.ascii	"HMG\352\366@\027\331&\344\t \177\034\362tB\346\210\f\262'D\352"
+	.ascii	"\320\354N\367*\364\005J\250!(c(TF\221\222\221@h\246)t\240\002"
+	.ascii	"!:\323\001\020xE\024\326t\312\251\314\321\364\340A\230\341\327"
+	.ascii	"(\246\246\241\024(\004\273~\312u_5t\rH\025\215\272\304Y\305\320"
+	.ascii	"/\t\353E2~u\037\230\034\301\320\351\316\321\354\034\253\016\313"
+	.ascii	"\225\021\260,\202~h'\003J{[\023\345\354\274\006\222\246\313f"
+	.ascii	")\016M\2543\240{9\031|\005\231i)\255O;\005\337\025\255T\321\035"
+	.ascii	"\373\211\240\351\326\304\305\266\242x\340\001I\026V\225\2331"
+	.ascii	"\323!V\312;:\004\023\342\017"
+	.text
+	.section	.gnu.lto_configRecordArea.part.0.53.ada251a661a65a97,"e",@progbits
+	.string	"(\265/\375`(\001-\r"
+	.string	"\346YW@ \217\223\016\370\2130q\201\020\204\t\367);\023\211\333\201`\252\350\365^\001\371\260\206\246l\177;\275O\223\021}\220\272-IP\b\f"
+	.string	"l\231\034\007&\f\311\300-9U\031)ZB\344\2262\245F"
+	.string	"A"
+	.string	"F"
+	.ascii	"\004\236}\021\036\022\333>\210\207\370\0304\240\033Q\250b\260"
+	.ascii	"\214\230X\331"
+	.string	"\355\254\253\273\013\230\256\227\007\230\256\251\341\240'>\220\217\234(\302\363\244k\313\212\013NT\341\b\340\217\362\330]_,\334z\333\nl#\260\337!Yb\033M\031=)Z\025\375\036:\023\215?\371\257\301\321\241\262;\241\304\262\030\024\305\203}\222\307\256\354\217]9\361'\236\327\255\210\304\211\366I\274\373\274\204S\254\261\233A\345\305\356\032\270\372\300\345\032\347\262\351:\345E>|\304_jR3\362\345GZlC\270\212Mf\264\273\t\354\006O\301)0\332\335\314\211\243\320|\016W;\350\340\271\253\337\311\314\006\224\020\226\214\371\023\363\244s\244\210\\\b\301\022\246\211\363\375m\032l\323<_\030\216\266\201`\330\202l\303\340C\273\254\217\215\206c][\307\302tX\003\3016\353\201\246mV\365\267Y\342\223n\311\300)\251\224`\233J{\2042\304\231ib[\323o\221m\300\330\r\235\363W\234\305\205e\030\034"
+	.ascii	"\252\322\255\315\206\301kG=\033X\213yG\b)\023$\207\t\003\260"
+	.ascii	"a6v\t\240\026\003\362\300\bW\214k-\3129B%!\024\034\323i/<\215"
+	.ascii	"@\023@\020\002\367n\016\033\236a#5\220\346\321\327\026<"
+	.text
+	.section	.gnu.lto_findEEPROMIndexed.part.0.58.ada251a661a65a97,"e",@progbits
+	.string	"(\265/\375`m\003\345\027"
+	.string	"F*\224H\320P\2471\363\233E\252\362\263\317Av/\263M\225\272\310GS\352#@\306\340\027W\307\321\216\207\222h\201 a\304\256\362\211\"\215\364\226\246\301 \206"
+	.string	"\266\230%}\3159+"
+	.string	"\321{0\021l\377\336e-o\271\245L){"
+	.string	"\201"
+	.string	"}"
+	.string	"\026\347\231\226j\304\245\032*\005t\376\366\256E1\235W\272!\t\261@&\016U\326^\224W#\210\275\332O\352\331Gr\205?A\333\376\210#\341\330Gyv~C\013\216\222*4\r\255\275\264W\337\023\030_c\037\031_i\207\373.\322Y}\376\354)s.\006(1\234\212\005r@\\Y\t\024K\300\236\356\247>-\224:s\212\274\002P\261\326:\226\341\036o{\305\266\214M\215\002\276\020;\303\276\374:B\361 f\365\0263\247\362Y@"
+	.ascii	"\342\032b\365~E\316~\327\006A\230|\272\220\206\037\323\276\212"
+	.ascii	"\257\230\371\0259\257\r^\004\330E\0326\210\275\206\314\217\214"
+	.ascii	"3~\212W\3312\363Ne\224.k\255\214g\313^\251/\325\363\247,\213"
+	.ascii	"\2022\361\f\210\343GY\006er\373c\3173<R\322a\355=y\365\212\353"
+	.ascii	"\374S\357\332\2626\335\t\347'$\210!\0268\024\306 \366:\023\003"
+	.ascii	"\265\343\260\305\254\005&\360oL\270\371\036n\350\247n\240t\212"
+	.ascii	"\021\224D\3427\303&-2\255\027-%\262==z\272\376\351\027\317\364"
+	.ascii	"S\331\364\374\375\037\023\217\\\200\004Y{!\354\313\nU\253\017"
+	.ascii	"\227\372\267~\254\327\260\311\fx\205\345\214M\304+,\035\200]"
+	.ascii	"$\007e\030f\366\273B\340=\261y\206\231W\030\324\365\240\3405"
+	.ascii	"\332\347\202a\033 \033!\254\265[/\254\225\345"
+	.string	"\233\227\362\265\236\025\216\220r\323\321n\272\021\227\035Y\263\355\306\334MGi\310\030\236\230#q4-5\334\013\216\307k\211\251\t\270\331v\324\306\346\222\303U\327Rd\310\235\316fc\271\341^rd\215\226\303\265\310\320j;\036-\245\304\244\316\266\243\321\220\344\216&;%\362\007\024\255\007\214\246\357\033G\352c{\244V\371Q\035q\300\024)\2456K\313|O\245\337 \264CsL?5x\231\310\241\264\3106n\234T\244\304\016\0329\200\223\207\355O\250\221<\206\22032\"#\"\"\232\246\305\200\"\2413\363\020X\250\212\322\030\364\fU\252\242S\327\332,\237\37362#\024\025\211\303h\273\033\243\027\316\341\307\2049w\325\2469\323^\312\266\321\320\373Tdo\005\r\2047\210\n\"\242v\021\032\307\026C\304\337\215\306\216A\225\237\272\f\216}\005\305\"|\023\357\027\217\267\336\017\213PED\036\366\362\236\t"
+	.ascii	"\331y\352\0045!\020\031\023\005W]\274k\311\002\277k\206\266I"
+	.ascii	"p\344\372\356>\210\226|\f\333,\270\267e\247xn\337\242f\227?,"
+	.ascii	"Wku\t~\b\374\353\301\017"
+	.text
+	.section	.gnu.lto_.symbol_nodes.ada251a661a65a97,"e",@progbits
+	.string	"(\265/\375`M\005}\027"
+	.string	"\266\245\215K\300RR\007\"\236\375Rp\351i\213-V\004\273+\227%\257\313\214\246I\206\312\232\225J\3109>\233\352~WG\266MQ\024\"\321U\024TUq\307\236\3379&\324\347P\213U5Rf\333\2632\240\031Y\2531g\313&I&\031|"
+	.string	"v"
+	.string	"{"
+	.ascii	"O\322{Z\202\027\361_6RB\360%\007\\c\013\205\202\031r>\304\300"
+	.ascii	"\317\n|\314\242>\022\004\036\206\363\266;\340\317\233\257\tx"
+	.ascii	"\034{\245\200D\2747-/\306\324\221\315\007\250\371\021\034\315"
+	.ascii	"\333\330\231\224Q\206e\2741\262\252\212y\035\314\343^\376fY9"
+	.ascii	"\347\354\3629\353\265v\232\324\362\"\231\206\033X^v!w2f\024\365"
+	.ascii	"\215\250\365km\362\265\013\322\017\f+\217m\255\365\356"
+	.string	"\004\355KQ?A#\351]<Io\242\215\364\036\034\351\273\034\351\244\220\344:\231\236\327u\256\227iKH\022\317\321\311\3246z\023O\226wjc9.\342\264k\254\240~\247\365\031\261\235\311\352\252\350\264^\n\233\367\223]\234\326-\274K\205W\241\360+\023\376E\302\233Dx\032\b\337\362\340av>\306\301\3134\370\032\006?\323\331\227k\275]-x\224n\235\337Q)\b\327\205\235\247\033\005\017\026=h\330u\"\330gh\337\337\211&K\363W:{\341\004t\322\234\244Q\024u\322\274\347\350\244\205\370n7\213\311\\\347\222y+m\225\020\036~%1\327\301b\336\n\366\311\241\204\210\027\314y\332\376r\020}@^\336h\363~RF\245\313w}\245\200D:\227\363T\227ac\250\242\004\361^\333'\0350\206Z\245\227\305\033\351\345\260d\221\336B/\3517\030\265,vN\n\0238Rj~\207m\006\201"
+	.string	"\312j~\321\256NB+f\320j\336\303\356\252\234\263H\315\016\345\354C\326\274\327\235\224s\306\265\006j\241\341\303\211\351\267\330\026\311\307\216\032(\246\367`\246\353\250\\\246\337\2047\3547\364b\257\241\215\247\200\277\021\273\031\354\272t\343i\030\303n\242,\354#E\034\366\221\264\001T\025\243r\330C\210=\353"
+	.ascii	"\245d\202c\330\003Z\250Q\024\243ZJ\210r\222\202\2441\340\002"
+	.ascii	")\232\222\007\021\320\244DL\t$\230@\002\242H\244\036y\210/V\016"
+	.ascii	"j590\027.\253K\270^i \253\234\033\320\275\301\351\017C\361\211"
+	.ascii	"cq0\275>5`C^\256'\240cU]\227R\230t,{\221\260`\003\034!\004\231"
+	.ascii	"\007\366\305\261\301\243\020e\346\221q\210\001\013\200J\200\337"
+	.ascii	"\346\306=\376\343\374\356\341\347z}\321]\245m\"?\"\300T\256."
+	.ascii	"\025n\r\335\201\343\r\265N\373<\233oA\307v? G\332X\333A\037\304"
+	.ascii	"\323\234\276\375\203B\372\350\245\nbR\213P\215\233f\257\033\337"
+	.ascii	"s3\024E\266\330\037"
+	.text
+	.section	.gnu.lto_.refs.ada251a661a65a97,"e",@progbits
+	.string	"(\265/\375`\007"
+	.string	"E\005"
+	.string	"\302\316$#\200\251\031\016&2\"#2\"#\362\215\346\307;B\214\213\314\b\374\267?Y'!d\311\3566\322\244\224)\357,\376(\016\360E\007\354\210\305'\305\027\372\n}\204\217\026\227\024G\272\264>\210\266A'\350VF"
+	.string	"\3656\264\221\305\027\212N\263\023\306\233qf\274\2359^_vG\306F\306\331\025\376\364\227\305\031\3059&\307W\364\247\030\237\350\226\350\236\272!\306\037\272\035\272\033\372\f\343\005\343\002\343\215\276\323W\306\325\370\321\335nv\257#t2\276_\003\006"
+	.ascii	"\203J\273\330\351\2211\334\312\302\224-M\2405R"
+	.text
+	.section	.gnu.lto_.decls.ada251a661a65a97,"e",@progbits
+	.string	"(\265/\375`\0305U\332"
+	.string	"\212C}GW LA:\351|U[\310y\355KI$#t\261\250\210\227\252\2616s\0204B\317W\017\265\363\265#\242\"\332h\203\272FO\227u\335\n\013\250\032\001k\245\301\3633\005\340\325\351}\262\322\213\003\360\333m\222q2\f\367\317T\334W\313\2129f\025!\332\331[\312\024\314\003W\004\220\004xdX\246T\271\002\026\205\307~\236<\2462\246\307vO\336c/\\\027\245s\223J\236O\266\302g\\\027\365"
+	.ascii	"!y~<\206\305\360\037\203\3410\f\310M~\262\336\371\ncI\242=\271"
+	.ascii	"N\013\002cV\370:\340\320'\206\026C\307\336}/\203#\245\ndY\370"
+	.ascii	"\0137\331\313w\230\367\246\211\360\363x\341,\334\205\353\242"
+	.ascii	"\230\327\205\007\2640\371u\200A\0078\\\356\362d\004\273p\311"
+	.ascii	"Ycfui\313[f\242b\310\245hC\177\326\302M\346{\226\233{3@\275\204"
+	.ascii	"\265y\371\236\215\223\034VtJ\320s\032\332\"X\f=\373@\317:\320"
+	.ascii	"s\026JE\246\031\327G\327T\316z\312\334\322\221\025\252\303\036"
+	.ascii	"\202 \330\203\024\256\263\331\313A\005\330\226\243\244\355\314"
+	.ascii	"\024i\202C\253\355\371\t=\023a\362Yev\315\240Y\261\020a\t;k\263"
+	.ascii	"\013M*\242\344C\013\201\004\206\3434>\313A\352\334\243)J]\367"
+	.ascii	"2y\340\270\t?\251\314\256\024\254Z\360\335{\317j?\317\031\216"
+	.ascii	"\2210[mv\335\344\221\327\0066\372\320d<\357e\236\351\030\n\307"
+	.ascii	"\361\0347\031\356\314\204\337\230\354\314\274\312\016v\202<\362"
+	.ascii	"\310\310n\354\371\311"
+	.string	"\231\f\367&\357\275\027\320\310)\231\273j{\236\263\023\017\301\246(\346\345P\223\3456u\245\355g@\203n?M\315\034\030\251\256\266\217\241\255\267\304\250\025i{\027\320\267\200\362\032'\341&\007\254\344|\204\325.c\304\274L\224\n\037\025]\333\247\200\2369\b\326\300@\346 x\023\320f\017A\035\007\240 \370C\220\313\330\214\233\032\260\221\207@\302+\322\354\216\335\313\344\2003&\310\230\277\266\027\001\265\300\354\222p\024=k\020\344@\326 \370FE\360\207 \b\374!(\306c\034T\345\322\362\246\335\313\354\200&\335\220\214\265=\223?\004Q\366\020\374\271H\237\240I\335aC\344\004\177\237`\202/\275\347\374u\257I(\301\005^M\202\021\350\235\360\3277\253\276\201G\333\200\243k\240\241qD\320\035\212:`\303\b\177M\217\"\f\360\267\361\312\303_e\212!\340\021\210*\370kOs\017{\bJ\013\301\320\f"
+	.string	"\301\337\020\370@\007\365\021\340\257V\300:\256\323\237\2214\320\234\316_\305\376\036\361\363?\356\357\031\376\373}i\237\016t\317\3371\310m\360W&\315\201\336\300\001\204"
+	.string	"\360\327\255\023?\313\220\366"
+	.string	"4\220\201\206\341\"\376\372\2421@\326\344\360W\025\377\347\016\367\277\276\3001\370+\002\2064\013%\340\373\337\177\245\262'\327\024\210\352\t\330\204\210\001\257&\031\376\216\346\257j"
+	.ascii	"\370Y\347?\224\377\375\f\370\367\n?\213\b"
+	.string	"\361\363\006?\033\177F\300\357\376\337V\341\347\017?[\360\363\005?\357t\n\377c\370\177\200\377\031\374\247\340?\007G\300_E\270\314_\243\224\370\331\376\265\354o\024\376\216\300\337\r\370\273\204\277y\376&\3617\210\277)\370;\347o\364\357\340\337\3753\340\317_~\356\373\231\313\317{?\353\375\234\3673\336\317w?\333\375\\\367\363\334\317r?\277\375\334\344\347\265\237\233?\223\375L\344\347 ?\003\371\371\353g\256\237s\374|\365\263\214\237\245~~\372y\3703\b~\026\376\214\364s\002\376\007\376\217\362s\362g\344\177%\377\215\374|\303\3174\374|\374\331\001\377_\370\337\366\263\315\317\305\237C\360\363\210\237\211~&\376<\364\263\320\317\037\370\271\003?s\340g\005\374\\\302\177*?\363\374\f\302\317$~\376\340\347\f~\016\300\177\023?\363\317\377_\367\177\354\277\013\377\345\376\357\004\006\006\006\3765\312?(\303o"
+	.string	"\020\001O\034\032>\276$\245\240\017\336\353B\206y\233\216n\202,\303,\342\307\341jo\375\037"
+	.ascii	"\017\334\213\234[\366\241=\330\214d\034\304\375\275\310&e\263"
+	.ascii	"\n\331A\3314\272J#uN\035\224\314k\343\202\333\274\272J\346\022"
+	.ascii	"i\227\310\276\314\233\254r\272\311%\222H\311\274M\227\271D\352"
+	.ascii	"\334\244\223\216\222i\204T6\253\234X\331\\:u\270\311\213\274"
+	.ascii	"I#\033hr\351\244\204\262t\322Q6\215\234\224\311*'\276\314\345"
+	.ascii	"e)n\314*$\322m\032\341\334{\227\230]\310\233{\215\232.\322\256"
+	.ascii	"Y\334*>\026\227\306\345\272 \314\253{\357\275\310\264<\253%\r"
+	.ascii	"\363\350\326)},Q \335\233wY\214\200dd\322=B\362\275H\314\246"
+	.ascii	"{\217\2262D-\371.\251\351\342\334\244\321\322\221\325\362\006"
+	.ascii	"\351h\231t}\330`'e\323j\311\323v\326\354\272GL$w\335\274\252"
+	.ascii	"&\264\211\344.8\315\255\250\245\266\025\311\306%\321\312\321"
+	.ascii	"\254\311\232#U\236\310\332^\006\254\036\0016\033\260\"w\226\327"
+	.ascii	"E\b\261.\275\270\347\275Q\036\334 \221\333R\305\364\030>\223"
+	.ascii	"!\347+\314XW\333\016\344y\2754Zl*\354\002\357\275WF\351\317o"
+	.ascii	"l\212+I\33306`\200KD\236\r\346\006\312\025*\274;\264\277\334"
+	.ascii	"\232-q\252\021\324\034\233\227\276\2524\244\217\255-s\354\246"
+	.ascii	"E\213\255%\223.\007\224\271\266\314\234 \230\216\2446%2;\254"
+	.ascii	"\002\301\360i\271\272\361\205+\215\231\263\342\352\313\212,y"
+	.ascii	"~0\2368\366\260p\b\324\352!\206\267\200y\203qE\017n\006\224\""
+	.ascii	"m\255\340\264=1\305-A\361\272\n7;\257\355\336S\372\356\335yM"
+	.ascii	"\327R\2203lP\222\234\317\274\246\322c\\\027u\253\226\271$g\230"
+	.ascii	"M\n\264 jA{\213\206\202h2\352\201\276\245\374\r\245\347\330\311"
+	.ascii	"\313{\223\034\254(\371)\333v\024\236w\335\215\222\222W_[\016"
+	.ascii	"\264:P\020\366\262\007\2711\261&Vi\035\367\026\\\342\366\003"
+	.ascii	"\310X3\257\360q^/!\203\302K\350\372\255\327z\311\\;\233I\303"
+	.ascii	"\265[;\351&\375\204\233\375\326mMF\344o\\\227v\302\027\226\267"
+	.ascii	".k5\256K\273\226\207\336[\007\351"
+	.string	"\261\020\366jL=\371\0169\345I\307\336N\241\235\244\225p\363r\315v\273\002\314\017(mo\233\320\237\200/\027\274UB\315\272\311ui(\b\261\242\326F:\315\311\205\274\032S\317{/\222>\302\315Vkb\220c$\t\031[\320\276\323\336\304\311\302\204\271\243m\237\361\274\321\036\260u%\244m\255S\320\"6o*\262\310\021A_\207\240\257`\350k\017\364\225\013}\335X\267X\017y\217\265\220\233d\217\331{\215\230C\3440\207\220y\333aT$h_q\240\257\313\260+)XM\320\2004\030\220!{sm\177p\263\301\336>\300\272\307\f\234\031,\262\264X[a|1\234u\362\242\242\363\332\322SJa\324\305E\323\325\"I\223\266mL\246\315\022\032jO<z\007\016\243\027Nm[GZ3\370\327\224\005L\333\327#\034\235\203\233\275\365\316j\322h\254\312\354BW\034\211m\265\026;s\234\3064"
+	.ascii	"$\n\223_\337\330A\245\266\340\250\256\240Um\305\315\276z/\231"
+	.ascii	"5\370,\247\336K#\f\t}\3256\230\267E\003\374\222\234;\035t0c\266"
+	.ascii	"\364\314\n\332\267\035\332J\3207\032\225\b\2340xGa3z\212\307"
+	.ascii	"\276"
+	.string	"\300\035i;\325L\355T\313\232R(\242\006\3251:\252e\264\0247{\252_\274\237\032\306\255\213\277\325\262&\364\314*\215\257\247Z\331K9I\235\233\264:\322\205\244s\223GH\272\372\250\247:\005;s\214\230\267i\246\310Z\222\363\2713c\345\213\354\356\306\242uKb\350\233\007\372v\372;\331,z\251\227lEmE\227\266\335\202\347\335\204\363$\213\257\355"
+	.string	"\226(z\371C\260U\264\0227E\364\212w\022\243\235&\311\274M\032\274.Tim\3371\320\263\210 \007\026\021|\277@m\257@\317cP\276K\370\203\221\006\034\230P,\336\310\2763p/\272\360\265\rd\032U\301\203\333\202\236\307\3568\326\313z\325\272\235\300-bL\2369v|\211\271Qu\213Ue\271\252\235\316=\272\267\213o\022\332\221\222/\210\036\030\023\034\267\\\267<\326\362\272\264\332\332\035\267T8\272\234)uX*/,k[\037P\371\331"
+	.string	"\314q-\273\035?\3326\377-h\265\256\345&\256\355)\243\255\315\272\026\234\2652\255\0317nc\220\275!Mik\257\030\213\251\316\316j\213\016(\233%z\033\251\247\333\250'\273\254x7\027iv[\314\260\301\tyz^e\224\b\233\262\025eRd\334.ok\204@\302\367\302\300\360\214\332Z\032\317\211\232s\362\315\260T=n4\201\370\241\377\300\f\312\311\251\255\235\372^\373\330[\332\322\326J\375-\252\3123k\013\235\325\224\243\266\026\3526\306OC\343\244q\243\212\013\372[\030G\360dt\355\241\257\301kj\262.\236]3/\240\232\376\234n]d\251\t\363DI\331f\225\254\222e\332YV,~<\203\317\212\212\305-\023\322\035\2171m\355R\255\252hL\232?\332\332\025\275D\306TR\0131\245\322\"\275&/\215\300.\016U\220R\372\256\320'm\322\"\261\231"
+	.ascii	"\304\324\230\n\243a\032\222\024%\305-\322\331\016'\311Z\325n"
+	.ascii	"s+X\264}\r\323\2301\326hgY\365\376jL\005\373\256\0163\213\274"
+	.ascii	"5\372\033N\336\021\276\032m\355\255U\034\230\254lei[\003\333"
+	.ascii	"\313\r\036\2305\275'\372|V@6\273-\202h6x\214\021!\363\f\234\202"
+	.ascii	"U\377^\001\377\250T\264\255~\354l\326\210\363k[\303\\\3131\031"
+	.ascii	"\026d\211\256\005\240\337\332\227/\265n\007H\022\024\252l\313"
+	.ascii	"SX__\005=\230\222\234\317\n\350\"\311\334\016-Z*\227\356\232"
+	.ascii	"9c1\307w\243f\210\250\241b\301\304K[.u\013\024\033\016\026m+"
+	.ascii	"_\2163IM\256\355i\260\320\3238a\301R\367\202I\236$9\237y~pam"
+	.ascii	"\367j\266\312\220l\210\321\323\253_\374\343\n\212\227\327\254"
+	.ascii	"y\354l\346mr\001\n\323\203\243oxx\365\n\226$g\030\2153\305\220"
+	.ascii	",\262\273\273\372\245\302\335bKr>9\310\210Q\005\b\016;\273Z\207"
+	.ascii	"\336{\255\320\350\252yaE\013\t\215(\217R\353P$\253IE\211\220"
+	.ascii	"\211z\362\"\260-7k\235\235\017\036\350\212\271\271\372\305\223"
+	.ascii	"%\311\0316\343\367\344I\225\303\300\013J\215{\225\013\322eI\035"
+	.ascii	"i[\341\252\233\f\016*{B*\323\f\334\222\005\324\236\222\332DI"
+	.ascii	"};\301\306V\3370\270M]\026\3405\204\311\353[U\322\366\303K\333"
+	.ascii	"\332V\335\300\376\370\222\2709i\362\312\230Ej\306\034a\031k["
+	.ascii	"\227\310\241\2371;;\253k\\O$\257k8?\364\356\244\264\255h\365"
+	.ascii	"\b\t\\4\2019\242f$\017\213\030+5~d:r\244\265\035\315Ts\314\027"
+	.ascii	"\257\262\262\332\024+\362\332\224\251\262\345\t\252m5\233\301"
+	.ascii	"\022\253D\304*\331\001\356e\346\262E\323\330X%S\001i\263\007"
+	.ascii	"8\344\225\254\275\334 \211a\344\344\rF\233\330\\\333\317\300"
+	.ascii	"@\037\024\023$H\005\262\243\303\274V2\272\202JHJ[V|\370\250@"
+	.ascii	"v\314.2g\312\214\031\036\3348=\231b\321\227\346\3714eH[\260\377"
+	.ascii	"\270Y6\005\333``}5\033\232\022\322\211\227W\375\332\002\302\217"
+	.ascii	"\255$\347\363^^\277z\214\306\253\207\325R\231\016\035\225K\257"
+	.ascii	"\213\307+\027;\313\252~\300\265\255;jU\260O\210\227\212\035X"
+	.ascii	"X5\307\003z\220u\341x\315\321M5\253\265\266U\253V\231iuq\321"
+	.ascii	"\266fU&\031%\230\324YP\212\352T\365\212\243.\222K\001~,Y\275"
+	.ascii	"^\261\323\332\370B\262\325\266\326\250UT\344\262\260\252l\324"
+	.ascii	"9!y\204\2718f\177Vw\331m(\023.\036/\332V\032\354\224\341\311"
+	.ascii	"\224\252\240\022\372W\031\347f\225Q\223T`^\244\315\021[S\223"
+	.ascii	"\007\017^(\250*\205\316\340\210\213z\225b'UF_mk\214^B\227\234"
+	.ascii	"Py\354\264DzDaqA_\225U\305\253\322\225\352\023s`k\021\325\324"
+	.ascii	"\364\372T_\034QB\206\275p"
+	.string	"Q3\203I-\007Ga&itZg_\234\316L\2242Ng^M\332\326\026\355\345\3149/,m\353\212\3124\263\002n\b\026Se\241\002\007\027\276@f\177y\022\346\326\366u\211\365\274\240]\251\321\001\307\236bz$\022K\020\321\020\205L|\250@\020Q=\212\021C\351\321h\203\221\204\260\b\224\201\r\220\017\221\205 \242\340L*4\203\217Q\030\200\243\030\301\302\013+\230\200\241G\005\023\021`\241\304MZ,\"\262DC?Ca\361h$\221\002\025\t\375\f\205$\212\306\"\022\026\b\t\025\r\207\304\341\f\r\304\"\212#q8s\302'\025\262\307\3248\224\016\005+@a\024\016\205\026\2400\026\t\235\370p\024#~\212?$v\322\243\017\020QQ\317\361(\374\371\351)\201\347\247\370CA\315\261'\230\006\371\024\211G\023\025\244A\036\200\206)\021\221\217\005\351\rB\023:i\261\350\370ST<\232\260"
+	.string	"H(\344\223\201\n\216\302\241\260&\025\022\226\030\"\026K\370\020\205(H\217>'\020_ \202\301(\324\001J\205'\204@\304\026R\270\200Qx\323\001(\335\251!\005\022\022\026\315\240S\243\003\302\210c\321\207h\304\005\036\200\206i\261'\210\250\247\247\003\361\205\017\305\364H$\2260\006\r\205\307cj\302Cz\024\026i\310\2411a\350\363c\304\361I\213\021\030\256\320\202\005\\\270"
+	.string	"\n("
+	.string	"\r\205't\376#,\246\3034\b\375\b%|P\302\002j\2309\246=)\020\261\205\264X$$\3649\201s\024#\216F\"Q\317\22084D\374!qL\203\212>G\020>G\237\023j\216iO\211czL\205\210\206\210?\250\261\247\206\024h\270\202\007b\320\330\341\330S<\022\321\034\213>G\243\314Q\214(\300\f|\354I\211l\020\n\371\364\364\024\323!\237\264x4\366\020\200\006.\246'N\024\315\020<\372t\261\230V!\"Q\002=2D\241a\021Z$\036}\206\302\241bz\254\351`D\217=*\2443\364\374\b\203|\206\320\f\230\340\241\230\002\371\244(\202\306\236 \"\0136\307a\021\321\204\233cj<q\302\002\307a:\024\224\032q\216=!\210"
+	.ascii	"4L\353O\321\204\243\321Gh&\375\031\246E!HM\034kH\2077\307\243"
+	.ascii	"\030\021DD\"\210\310\303\317\260\250\30415\332\fO\36415\246E"
+	.ascii	"\031c\217\r\305\243Q\030\224\272\020Dt\203\342\0304L\205\202"
+	.ascii	"FcZ\004\002\362\231\261\201\210\370c\213G\242z\354\001*\022\177"
+	.ascii	"R\027r\276\301\211Di\221\304\221H,\222\260\t\"j\240\024\004?"
+	.ascii	">D\301cO\t"
+	.string	"<hz\203\320h\217=\303 \"\231a\020Q\035\022\205\306b*\202\231c\317\002\216Ca\321\314yxL"
+	.ascii	"\001C\005R@\177F\f\021\213Di\332\023$<1$\376\220\030\n}\206H"
+	.ascii	"\374\024\215$F\2040\006\371\b\235\220\271\315\252\027\206T#\320"
+	.ascii	"\032\221\271b'\3465\306\202\345(\021\271\333\023S\277$\300e\351"
+	.ascii	"F[f\263\202( L\177W8qfvD\374\270h\322\302\202\264\205\2519\202"
+	.ascii	"T\2229n<\033\013\307\t\030\222\0240Lb\376\314\206|qQ\205\205"
+	.ascii	"\214\312z\261}3R\342\262\270\355\324<(\257\262.\026\311&\001"
+	.ascii	"\253RX.v\013\352\214{\272\262|\355\343flF\225\353\324\262\027"
+	.ascii	"\254s\263\262\224\305\032\325`I\331\312\201\226\305\\\303b\205"
+	.ascii	"\320\\\205\371"
+	.string	"\020s\305\226\311\301\361\271\265\265y\365\004\200\367\032\331\274\266z\326\312m\336\231C0\207\3400\223\027\2464\nV\001b\023\006\013Y\036^\225\323s*\203PY\343\272R\326u\307\305\301\356\312\210G3g\234N\2660\331Y)7nmoU\335}5n\211\n\256\266v\316\316\331(4MMt\200|t\267Q\316p\274\214\264\264\244\241rrbn\312\342\352\033\026\036]V\333\346b\353B\312\316\371\304.\353\210\004\342h\313\244\2412F\314Z[\353f\335\354\033\212\254\341\312{br\373&\202\006lYE\216\331\202~D`\210m9\237T<\305\342\332Z%V\211]\262\002\222\350\217\311\317\262\335.\251pSI_7YI\310j\302\352\002s\254\2613\030#\305\037\022$R\032li\243;\002\330L\232lL5\244M\322-\031#\255&\221\215]q\262h\265NMJ\313\252m\221\"\326\b[\231\235\017"
+	.ascii	",u\2455o\21581\322\302\254\246\250U\234t\210\215\031\033\263"
+	.ascii	"eYKL~\020H*\373c\336\226-\265t\311\265\265D*\323\216\276\256"
+	.ascii	"!m-\331\265|J\334\325T[;\344o3rtV5\300\204\205Y!\214&\305\344"
+	.ascii	"\367\344\220\345<\352\013r+\204-\257\t\306F\213\355a{X0\300\032"
+	.ascii	"S\317z\006\005&\343\307-\230M\331\332\r#m\255\017\033\267\204"
+	.ascii	"\300\250\203\323\363Y,m9\304\230#$3\322&i\r\243\024@ 8D*\241"
+	.ascii	"\322\346\351\r\023\300S(\004\242\020\207\235AE3#II\245\320\001"
+	.ascii	"\352\260\230GV\352\242\331\333M\254&\0230\360@\331P\334K\231"
+	.ascii	"\205\3645l\0377\r\263L8 q\f\007@,w\374*\276\321nr\3465\340\016"
+	.ascii	"\266Dki\326\312\377\343\006]\031Y[\252\311\2464\262Vw\024\345"
+	.ascii	"\022\202\213\207\213\215t\361NcR!\303\347)\2771\312'\205\027"
+	.ascii	"@\003\355\330\252\315%9\216\247I\013w\021\275b\032\016+y\207"
+	.ascii	"\3641/X\252\r\244K~\357\377Y\225\003\033Nn\276\216]T\370\356"
+	.ascii	"4,\311^Q?\362\252<\274\304\227\376Lkj\364\305\030\0239;\345g"
+	.ascii	"\030\013\3038\307\257\273'\023\340G\024\323\b\322\224"
+	.string	"g\310`\277\266\177\203\263\300\202\bJY\207\357\346\237\321\224\300\213wdI\262wo\004\253\375\024a\356\371y\230\342\250F<\207\364\027\351g\221\251\257\357+\3562\026\241D\270\263\327\242\210\262\350\220\207q\\\207 \203\275\260KVg\216\377\310\3064|Y\177p;90O\247\227(\177\334[\245\177\256\3239\031\360\310\332\251D\315\351\243\033\332p\344K\027\273\005t)\035\226\322\fdy\245|\322q\302N?a9+\375\t\335\375wb\375\240\013\0057\364Y\223\365}\241\356\215h\270\277\231-\253\270\257`\355%+h\"\220\037\260^K\026\207\340\340\222\020y\310\374\301\021\324\271A2\f\267|\217dw\232\2365\n\n\240;\205\233\201\3253\247\2352\332\024\302\312\211\376\371Y\370\213\036\252\205\233\025I\223\327_2\\\351\345o\347Z\267\265Az^*H\231\207\235\321\371\261\\\206Mk\312\214\326B&n"
+	.string	"\303\254\243\353K\212\213\254T\n}\233\203\023\314mZ\367\256\177\214\231"
+	.ascii	",\222\374\324\3222@;\024V\360\357\271\265;[\315AX1FWjI\001+\300"
+	.ascii	"5\206\265\203\334U\2340V \222\020\017\324\213ku\330\365\254\361"
+	.ascii	"\013G\302\002'iP\320};\343\030\r\347ye\003B\250,\341\212f-\341"
+	.ascii	"D\250Y\330\243!6\211\230z~\347\006\255\237W7\204\252\222\322"
+	.ascii	"\274\032\271\307}\223\200\345\033n\341/\371{\315\ts~\306\277"
+	.ascii	"\204\026\346\256\242\317\272UC\333\217\203\331+,\210@\360\303"
+	.ascii	"^2\320k\353\363\tQt\315\030[\302Pl\016\332\304\013\255\0166{"
+	.ascii	"\\b\376z\377\206\331\315\200V\215\310y,\030\233\237\357j\321"
+	.ascii	"\255R/\365\276\213eE'y\216\032\306Zv*I\275J\372\333\rR\336\254"
+	.ascii	"b\347\233\032\027\264\352\210\217\326>Rv\360\\\355g^\330UQ\r"
+	.ascii	"\261\320\243\355\233:f@\311\355x\bE\220fHA\203V(\177\307\247"
+	.ascii	"\300\335L\347\263K\230\330\343\222(@\321\004\"\216)\366I\316"
+	.ascii	"\260\027xT47.\223\252\227\372\270\222BW\030\243p\001\017\350"
+	.ascii	">(\333ERV\2470\024\016H\302\034\260\310\276\332R6!\352\317\\"
+	.ascii	"\216P\346\256\253\215G\274cE\374x\371\310"
+	.string	"\242e\376c\365\260\316\025\344\270\tF\262\216\307\007m\213,\307\326\025\227\356\036\344\222\203\025\311jx\242a\273\227Q\003*0\236\025\205\332\233\273y\242\347kfM$\375\022\300\313\\\233ZLB\3456JDL\331\257x\355\202\263\210\366A\214\274\025\273\t\320o\266\332;\030n\305\340G\253&\307L\332\261\330\355c\364\375\204\261\317\023w\316\224\317\3151\333\364\364\342lg\f+\022l28H\202\350HjT\242\347\232\362\2503\3410j\2204\305\262\326\220\037\374\212\037~\267%7\027\001\362U\321\224Vi\375\346D+\277<\003\351\206q\240\220F^5\220Q0\004\021\244H\32740\271e\266\032\255m}S4\365T\2163=wFj\021\331\022\236\276HX\006\322\030\\\005\3319g\332j4\330^\035\212\316\236\253\035GRKOc\323L\004\341(\330l5_fpI@\\\367\026}\0066\2625\334"
+	.string	"\277{\240E\025\241Ck-\347U-\274mWn\301\030f[\025\221"
+	.ascii	"\237\351\254D\341\273_\352\220\244\200\347\223j~\tz\326\346i"
+	.ascii	"N\3647\022\261\253`[\006\356t\326(\212\317S5a\022\310\322\240"
+	.ascii	"\314\351\346\241\335\377\242\223\374y\333\025\355\354\3764G|"
+	.ascii	"v \037*\341\377\202\334\302;]%\277\3349\027l\303\270\375.&\033"
+	.ascii	"\261\276\215\306\325[l\373\032\033,\340}x\246]\314\251\\\220"
+	.ascii	"\f\257\036R\3077\234h7I\016\337\237\263\316\215\335\347\210\255"
+	.ascii	"\355q\003\276\367\"N\254\261_\345:\335\326\217O\2477d,\333Vf"
+	.ascii	"c@\220\021\374\27521h\263\360-\357\262\005:\213\023:\372\026"
+	.ascii	"\324\346}I\376&-\205\214\375\315B\314k\200\027t~\023.\225x\324"
+	.ascii	"\226\001+\360\367\037\325\266\017~\231\n\026\n'R\365\t\234\006"
+	.ascii	"WB|\033\327\311\260d\3371#\330\032\005\",D\244W\200\222~J\300"
+	.ascii	"zA\361\020\305\1771>g\2426\217vd\305g\202\241\177* w\365\266"
+	.ascii	"y\"\265\243\346I\235\203(tj\222?j\262\215P\366\033-\267\r\227"
+	.ascii	"\204\006<y\030\307\347\006H>\210A\036+\307pJ\247BcK\262"
+	.ascii	"\265@\207\t\030\201\205\200oS\347\031\223\337\277\311?(\373\207"
+	.ascii	"o\003\356\360e\332\203B\217\337/t\363A.)\234\026L\266\242\267"
+	.ascii	"\2567Pn\260S\034O\325\016\242\243\357 \205DP50\221^(\225\231"
+	.ascii	"\221#\346\335*\251^\262\207Y\001d.\263\\k\326\3624A\200c\266"
+	.ascii	"\177\213L\220\314\215\031\206\\\275\301\n\305\273\013\216rt?"
+	.ascii	"f'\362\2142\351\250F\200\347\303iq\220z\206\026\303\335\313\005"
+	.ascii	",\021\236\2220\337\200\t\003\275!69\271^\022\177\314\037\006"
+	.ascii	"\303\207\363\367\005\016%KG,\207\275\215\212?\234#\206\335~\234"
+	.ascii	"U\026\277\344\335\020\327\fd\244\210\241h\202\005$N\376\302\221"
+	.ascii	"|\020\313b2\203Y\212\375#\017\\\36090u\003\202w\322`\321?\tL"
+	.ascii	"\254P\352\251B:\373\240.6\264\271\263\333\035`@\304\357\375\333"
+	.ascii	"\241\030\203\3758\317}\365)\373e\315\005\331\316>\346\306\177"
+	.ascii	"\023\216\261\254d\303w\275\252\246\212\032\343\325X\372g\246"
+	.ascii	")!N\200B\210\n\301\243S\343p\363\3079\025pQ\033\3062\315\306"
+	.ascii	"\016U\026\316\352\207\226x_\373q\265h\257\357,\256\236\005\206"
+	.ascii	"\307\017\274\224\262\212\224\314\314v\3376J8u\325\264\227\024"
+	.ascii	"\364OP\244\212\342S\027\320\317\224o\311x\303\"\353\037\310~"
+	.ascii	"\003=\360\217\001y"
+	.string	"|hV\227\376@\274\225\265\375z\026\303\247pFp\345\342%-\242_\227\200\344\261\023\220:\245C0\032\007\212\262.\036q\202^:\376\215\366\204\364\334\344\240\030\313\242p\r\347h\264\025\013\216\022\314\225\274\326\273\330\021y\370e\262o\353>\034\311g\235\325\r\341\327\252t\036m\377E>\232\374\323\343Y67F\266\025~7\321[!2\333\340\203\307\372M\377\305.`\0242\334\320\350\215\315\2160\034\270\371z;\277f\345Z\340\027\200\265\001\031b*\032g\n\374\250X~\016\005\037\005\314\217\360U\234\355\230</\377pge\030/\350\037\264w\004\016\227L\267\353\245\310\355}\201t\355\222\025\374\263\374\364\325\030\214\020\356t\334}G\361\327\326\351\375H\237\007\332\272W\372\243f[\264l\355\357\377S\360\325\364\304\2572s\277\017~=\275\217\300;\237\226\031\365\233m\345\2671\275\250Cb\376@\346t\230"
+	.ascii	".\336\256\361c9\231~\271\346e\375\301\362\036\362\177\221y\t"
+	.ascii	"\320\323\325\316\024\354\2357h\317\237Sv\377\272\034\005\354"
+	.ascii	"\375\024u\026\275\346\365\361\342\356p^}\316\370\240\276\364"
+	.ascii	"\013{\246\313\306u\276\021\217\013\222\225\0366:|\350n\332\313"
+	.ascii	"o\301qs:\2729\375\037\025C\375T\272\225&r\241\372\250\361F\233"
+	.ascii	"\241\233\274SI\277\261\322E\344>\251\2505\232+\005~\267\262\337"
+	.ascii	"\303f\374\026\365K\316\323\037\317\023q\312^2\1778:\273Z\227"
+	.ascii	"\315\366\005\315MY\227>!\373\205\300!i\247\350\025\325\310X\324"
+	.ascii	"\371+\254;H\215\350&l\271<\247<\277\362\226g\007\277\376\316"
+	.ascii	"\035o\215\362\267\353\262\3439M\364\2416n\246\023\337\354\243"
+	.ascii	"\301\314^\031\035]\025\307\357\257\244\364T\356\247\242\316\316"
+	.ascii	"\275\240z?\271\306\301[`l\356\206\251O%\013\001\337%x\204\366"
+	.ascii	"H?3\374\211\203\300\367\276\357\262\253\320\227\316\253\326\003"
+	.ascii	">\234\223x\215zF\267\345\371\005\334s:a\261\335\306&\233\327"
+	.ascii	"z\367\037+e\277\354\273\016l\003\372\232r\332\317\334t\224\235"
+	.ascii	"\206\271\311\025,\361\205\377\267\\\271\224_G\006\274\216(f\360"
+	.ascii	"\377\302\356\215y\374\021S\217\205\361\200\364\342\273\236P\273"
+	.ascii	"\032=ROq8\266\334\265\231'\370\021y\343\200z1\236\200\271r\247"
+	.ascii	"-\363\372\324\332\243\363\370\007\201\247=\3559t\005"
+	.text
+	.section	.gnu.lto_.symtab.ada251a661a65a97,"e",@progbits
+	.string	"loadEEPROMFromFile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\001"
+	.string	""
+	.string	"initEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\001"
+	.string	""
+	.string	"isEEPROMVersionValid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\001"
+	.string	""
+	.string	"isEEPROMStructureValid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\001"
+	.string	""
+	.string	"getEEPROMConfigSize"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\001"
+	.string	""
+	.string	"getEEPROMStorageSize"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\001"
+	.string	""
+	.string	"loadEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\001"
+	.string	""
+	.string	"writeConfigToEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\001"
+	.string	""
+	.string	"eepromData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\001"
+	.string	""
+	.string	"__pg_registry_end"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\001"
+	.string	""
+	.string	"__pg_registry_start"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\001"
+	.string	""
+	.string	"crc16_ccitt_update"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\001"
+	.string	""
+	.string	"config_streamer_write"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\002"
+	.string	""
+	.string	"config_streamer_flush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\002"
+	.string	""
+	.string	"config_streamer_finish"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\002"
+	.string	""
+	.string	"config_streamer_start"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\002"
+	.string	""
+	.string	"config_streamer_init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\002"
+	.string	""
+	.string	"FLASH_Unlock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\002"
+	.string	""
+	.string	"config_streamer_is_writable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\002"
+	.string	""
+	.string	"pgReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\002"
+	.string	""
+	.string	"pgLoad"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\002"
+	.string	""
+	.string	"failureMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.ada251a661a65a97,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,545 @@
+	.file	"config_streamer.c"
+	.section	.gnu.lto_.profile.9e667fa32684c841,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.9e667fa32684c841,"e",@progbits
+	.string	"(\265/\375 \276\365\003"
+	.string	"\244\005\262"
+	.string	"\n"
+	.string	"\330\355\273\207\006\b\002"
+	.string	"\002"
+	.string	"\002\001\002\002\001\225\304\205\006\004\002\003\002\206\360\244\357\013"
+	.string	"\003\304\250\326\314\006\f\004\003\002\002\004\236\221\305\252\004\016\005\002\005\002\006\005\303\330\323\265\002"
+	.string	"\006\210\251\332\260\016\007\352\312\231\325\013\b\b\200\331\354\210\003\006\t\240\342\234\212\n"
+	.string	"\016"
+	.string	"b`{\261"
+	.ascii	"Rl$\325\036\270\360\342\024Hp\t\270\313\013\252\005G=\025\023"
+	.ascii	"s;\2626\200\005"
+	.text
+	.section	.gnu.lto_.ipa_sra.9e667fa32684c841,"e",@progbits
+	.string	"(\265/\375 \271\035\003"
+	.string	"\002\205\r\023\260%\351\f\003\016\017\3030\254pV\230\354M\232\224R\246k\264Pt$(<\253E\216\207\200(y_\301(\317}\025\300\215i\326f\233(\035\365'\323\036\017\002\021"
+	.ascii	".9E\031\300\261:E\032\b\017\300\330\"4\217p\001\270\b\361B\031"
+	.ascii	"R\007\230j\272\240d\240\004As\322K\030\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.9e667fa32684c841,"e",@progbits
+	.string	"(\265/\375`\235\002m\016"
+	.string	"f\227J;0\215\222t\353\364\027s\354\276/\255\226D\326\300c\255\332\355\237\3766E\024\036\317\022\233&\3513d\345\200\267-?-\201\221*\006\306a\200\020\355]\037\255m\215\264f7\2212\0059"
+	.string	":"
+	.string	"8"
+	.string	"\305<K\226"
+	.string	"F\305L!\351 9\241\230O\325S\325\177\342\030\273\367]\214\266\326\032\357\245JB\004\244\303\236Z\235\020\034\023\366\260r\250dgF=p4\b\001\360\321\313A\334\262\356\330\3070\356\273\370\250F\340\300\301"
+	.string	"\272wq\257@9\"><\340\026S\335\264\326(\327\342y\004\255\265\004\017\035\225\363\002i\201R3C'\334x\226J\36157\036)\315\3208\035\025\353oI)-eW\211\r \036\025\337\022?\002\037\234\261\003\322\337Si[S\343\251\024s\347ei4#\"\226\327\363\247j\265>/\253\244\265\006\335\247*\223\030Xi\246\0244#\025\242\031\247\352\002|t\3066\354h\223y\315\313\032\001b\202\007\305\320\335Mj\375Pk\312S\365\200\016}\032\370\270\345K!\230\204hhF\025HX\320\261\274FC\250\341L\347T0\201H0a\024\264\240\230\003`\242RB\327\003\022\240\264\035\212b.\232\251\264\260\354\332\r\034\354\260T\322\031\224\347\204\363\016[\026\361O\346\262a\346\351\240`z\230-\3465\035\337g\321\030\307a`\035\3232\204"
+	.ascii	"\367\2260\300d\353SJ\314B\347gQ\267 \016\302\221\306\222\031"
+	.ascii	"\336}\017\032\315=\263\202~\3261\020\t\317\366\252\245$\002\031"
+	.ascii	"Bs\027\017\273\257M\362\030\225V\35410\002\241\037\203ye\037"
+	.ascii	"&\026\307\273\355\252o.*C:\335<\374\364\013;`\337\026\334\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.9e667fa32684c841,"e",@progbits
+	.string	"(\265/\375`w"
+	.string	"\375\004"
+	.string	"\222\t\031\036\240\027$\035\217\375\366\0176m\200\243j\334{U\365\253_\001\007\363?M,i\233\244$\003\333\027Qc\202D\\\275\"\202\036\370E\024\340G\264\020\317\370P\272\205\262\032\030\201k\240\021\227\271\276\bTB\f\303)\2247\007\\Qy\327-*\242\355\033\240\273\342\234s\254\351\230t\270\321\336W\241\217\230\005\001\026"
+	.ascii	"R\023\364Ep\321H\303\301\202\207\262!A\n&\336\214ZM\306\216\201"
+	.ascii	"0\223\234\t\027\310\245yO&qw\312\036Sf3\317\237\n\266P\233a&"
+	.ascii	"`(;\n\340\006"
+	.text
+	.section	.gnu.lto_.pureconst.9e667fa32684c841,"e",@progbits
+	.string	"(\265/\375  \001\001"
+	.string	"\034"
+	.string	""
+	.string	""
+	.string	"\t"
+	.ascii	"\232\004\001\231\004\002\230\004\003\232\004\004\232\004\005"
+	.ascii	"\200\004\006\205\004\007\232\004\b\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.9e667fa32684c841,"e",@progbits
+	.string	"(\265/\375`\207"
+	.string	"\355\005"
+	.ascii	"\022I\033#\2205I\007\240n\377\356\023\326\302\3459wZu\354\253"
+	.ascii	"\212\371\202\035\330\234\276#\355o\212\020\322\032!R\246\027"
+	.ascii	"\f\007\302\361'm\250\002LaZ\250\021\371\333\036\177\212\314\240"
+	.ascii	"\267cK\001\213r\320d\310\234\334\221\315\373*\331Q\252,)G\214"
+	.ascii	"s\320\242a\tE\203\375\357\b\260Z~\273=\347\252\\\320\273'yj\377"
+	.ascii	"E\351k\344\211\b! \200\002\221Sw\003<\002tO\303\034\024\031x"
+	.ascii	"\316\\\005B\213\031\316\027\350{\234\006B\fl\02715>\rI&X$\006"
+	.ascii	"\223\3379,H/@\\!\344\267\314\274\345\212\321'\336\rQp\216pg\037"
+	.ascii	"p\006\200\0223\036\373X)\002"
+	.text
+	.section	.gnu.lto_.lto.9e667fa32684c841,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_config_streamer_init.10.9e667fa32684c841,"e",@progbits
+	.string	"(\265/\375`\027"
+	.string	"e\007"
+	.string	"\242N45@o\323\001\230\021\271\013\200.\025\bWg\343i\001I\227\362\001\030\332\376\212\2358\3406\322\216\267\203\210\265\216Rv\361s\030\364S\207\307t74\353F\266L)\226ku\262\013\344\271\262\221\310\001\342\363\020\302\254\030\372x@\321\312D\261cP,\342\312\342\b\303\262\310\361\356\351\260k\003\314W\001-:\345\201\253R!8a+1\221\346\232&.\337\005\334ZoK\270\321z\372\377\302\256u\311\316\251za!8\3713fd\376Q)\036\234\266\316\326!\026\321\\\242p\300\337\255\240\374^B\0256\246\352y\2402\265\261@e\252Z\333b\257\343&\001\301(\211\371\037!\2075\247V{\304"
+	.string	"\034isj\030\37679\222\206\013\335\266\240\355B\333\217\t"
+	.ascii	"\252\244\2231\215{\206\215\263\257`\336%\200f5\005\334\345E;"
+	.ascii	"\311"
+	.text
+	.section	.gnu.lto_config_streamer_start.11.9e667fa32684c841,"e",@progbits
+	.string	"(\265/\375`\242\001\345\016"
+	.string	"\306ZaF\360\260(\035\260\306\317\274\034]\333\034Z~\340\371(\370*\022\375\336\252\024\346r\350P\345\203\36542t\r\325\021\306\302G`$\271X\3216\2638\\\262\231\246p\315)\332urW/\025uVc\242\311\336r\247\024J"
+	.string	"I"
+	.string	"P"
+	.string	"\n\266O\207\377\320>\267\013\320>-\262a<T\355[+\016.\232\335\3454\304E\227\032E\376]\007`B\215.S\256\022\301\f6\203\203*\311\017\224\021\246\273\036O(R\214\033\017v\327\321\204\352p\317\333\206`\333\201\035=\002\273\326\224\375\227\177{\370\317\263~)\243\337!aF#c"
+	.ascii	"\215]\224\033\233\225\315\030\022\266\317\261\255'\336\022\375"
+	.ascii	"\3051\031`K N\257\335\005q\203\355\263\200\214a\211\315\202G"
+	.ascii	"\373._\211\3162\271\307n\212\305k7\004q&s\300\230\220\221ttU"
+	.ascii	"\315\354\245\016iW\221\326\213R\254\261\r\372\212\320v\325\022"
+	.ascii	".ZX\233\332\336U8\006\223\251\201\341)\264\205L\313T\033<\212"
+	.ascii	"\222mw\031\3700\0322\250J\204\211\366y\340\224RYy8\2117v8\212"
+	.ascii	"\272b_\356\006\335\206\017(;\260#\"=\267'\344\353@\235\356#\001"
+	.ascii	"'T\370P\030\361<\334\310\247\003\342<\037\310\205\030\260w\241"
+	.ascii	"\3738\022\317\3738N\270\227\253)G\370 ;Q\222\023\334\356\036"
+	.ascii	"sL\t\244\260\250\270\314H]yH\213\tuLX\f\226\031\216h\177,\304"
+	.ascii	"\007$ \260\002\021\271\273\001\252\247\033j\032$\033\016\333"
+	.ascii	"u\337l\242\374\273\321(FE@6\333\241\3272\200\007q7\321\234\335"
+	.ascii	"X\373\252\3230Y'\035\320\306\231\022\016\302z\342&\331\260\320"
+	.ascii	"\035\020\320\350\306\330\025\345\270\027z\031#\002V\024\361\362"
+	.ascii	"D\223S4\261\007"
+	.text
+	.section	.gnu.lto_write_word.12.9e667fa32684c841,"e",@progbits
+	.string	"(\265/\375`\347\001\335\021"
+	.string	"&\343zG\340\360&\035X\036\003\231r\035\246w(|\013p\346i0\244yS\231t\236\031\374"
+	.string	"\325G\001\016L\327<\276\356\373\021\260\253\2261P\354\276\2041\306U\214kB\3640\252\361\020q>\202\351Zy;b\311\336R\246\024f"
+	.string	"b"
+	.string	"g"
+	.ascii	"\366S\374Gf\037\305\217\307C\325\270\240\325\234\346\234,\221"
+	.ascii	"\207l\227\361\003\266\313\025q\3317\031We~\312{\371\306u\270"
+	.ascii	"\214\016\222l\200@<\231\370\234&P\345\315h\374\320U\203'\023"
+	.ascii	"E\346\234*o\246\033\021\340$\331\200x11d)\007\307\301k\2157\243"
+	.ascii	"\212\"\231sZi<\0167\352\266SlC\260u\025\377x\355"
+	.string	"N\375\373\271\250\226Q\035\245z\245Z\243\372 \017~pnz\210\266\30677\204=\246\222\224a\342\265\333_\341\017Y\345\327ZDf\337\364.4\315\370q\232\363\033\271t\003\356\362\266\314V\331V!\f\004\002\314\0318b\301\325~\320U\310\376\271\\\300\234:HFs~\t\254\200\273\364\307\331\001 \323\207\352\332()z\232\324~\350\017\201\304Ci\266/\347y\312a\024\337m\273&\340\rT\370n\323\335U\0324\0171V9Q\247[\300\307\206\306\330\261\004bw\307#\377\232\200L3}\262m\341-|\304\3159\031\370,V`\034\t\227\355\362\373\241\304\t\034\240 \030\r\355\357Ew\307\376\206a\030zu\354\013=0\226XI\f\266\275\\'',&[\353n\255^.\225\022\327+\006\233@\001\345d\245k\261VPJTX\255\027\214\265:\340\256\202\353\305\212u\335\213\245\372\346\343\2142J\310"
+	.ascii	"D+\212\253\037|\204\236\027\264\"\375\312\255\261-\327$0\033"
+	.ascii	"\023\347\234s\003\240\037\313\255\335r\351i\342\036<\211\214"
+	.ascii	"\302\250\335\240\220\361-[j\r\370\350\b  \200\202\231\300X\007"
+	.ascii	"J\272W\246\023\263\020\264\r\350\330[+\322\2029\027nztlh\260"
+	.ascii	"\332\365\306\224U\262\253&\360\3329\343\222p&\022\027\330(\274"
+	.ascii	"2|b\233\343\320GW\336\2059L@d\236\230D\203\025\241->\035\374"
+	.ascii	"zf"
+	.text
+	.section	.gnu.lto_config_streamer_write.13.9e667fa32684c841,"e",@progbits
+	.string	"(\265/\375`3\003e\027"
+	.string	"\346\252\225H\300\030Q:\0206>(\337\334\237\027\027c\250H\276|-8\202\257I-\013\300\232\340\0060\322\bH\312\332\377\206\307\034$\275\322\207\326j\367S|\035\256+*0F<\256RwT\004\201\013\246h**\b!{K\231d\200"
+	.string	"|"
+	.string	"\203"
+	.string	"$\212\017\250\365\346\304H\255\244\203\215\020\236.\031\276\307}\300vy\223\304\215\377\321b\313e\251\265\242d~\372N\347\t|\247M\003\306\223\374~\f;\370\321\331\f\333\347\216aF\212\2368\346\034\234 m\307Fi\264\315\231\243\242\241\357\316:\243\214\277"
+	.string	"7xN]|\316\b\264,0J#m\n8\262E!\2153\356\357\276\240\354\211#\317\031\274Pk]\026G\026\337\360\273\273\263\273\026v\233CS\272\354"
+	.string	"\212q\331:\"\332\330\355\263K\346\360\f\356\250h\373\266{\232\274\246\223\177\351B\377\313\201\374\244\353\276a\310\013\202\274\337\344\245\037\357\244\274=yy\362>&D\017\024\030Q\255;%\227\372\204\016\375\\\367\335\007\331\357t8\257\265\025"
+	.string	"T\374l)\252\225dp\272\025\302\323\357\302vI\273\333|\241\022\023\246\316f\300\240\300@p\f\300\324YP\n\t\347\335\003\375\007\354\001&\226\"\032\235xv\251w7p\340\213\264eh\235\263{%\257\0028q\267\303\211>\240\222(\230\355\241,E\236e\022\003\307m\266\317\316/\357\343>\360cK\020\225\031\037m\367\356\2368\022\0201\270Z\353\314n\352C\252\023n\365##N_\032\213h\024{\221\032V\270\307\351\231\323y\301M\244"
+	.ascii	"\356\242Q\203\277\271\233W\223!\343rwI|\310\362\302Z\353\204"
+	.ascii	"\275\220\0204a\r\024\337\351\373\273'\b7)\233^\231`\275\246\315"
+	.ascii	"U_\325\003\327\212&\265r\335\274@\214`\211\250i\251P5\254\024"
+	.ascii	"\rJ\345z\241\036 \330\226\315\312\205\272i\265\\(\022Y\3377S"
+	.ascii	"\313\304Z\266=S?\367\311\243'\247\005(\306%\330>\013A\244\247"
+	.ascii	"\006_0\251\303\326\t\033l\346\021T\345kR\203\375Z\216\227\376"
+	.ascii	"\372\263b\353\022\343\362\263\326Z?\b\017\373\324\337\212\262"
+	.ascii	"W\313!\343\222[P\006o\242\241GH\307\025\332\273\031\276dya@\250"
+	.ascii	"a<\207\f#\b\225\004\023H@R\220\256\006p\002\021B\253\003\021"
+	.ascii	"\320A\"d\220l\035*0\316\005\367G.\274,\220W\355\366\214\201\305"
+	.ascii	"\203\312\206(?\020\251 \266p%J\255F\254O(\352\231\362d>\245\337"
+	.ascii	"\367/*}\237's\335\3147%\001\006\252\345\363\313\225\260z4h\032"
+	.ascii	"N\233\t2,'\2168\360A]g|\310A\232z\203D\366-\375\026b\235\344"
+	.ascii	"n\016\261)\024\372\255 \023\237\0366\330D\365`\202\213\244\314"
+	.ascii	"R\225\361\250S??"
+	.text
+	.section	.gnu.lto_config_streamer_is_writable.14.9e667fa32684c841,"e",@progbits
+	.string	"(\265/\375`4"
+	.string	"m\b"
+	.string	"\026\020<8@o\323\001X\240h\210\302'\002\350\177\036&Z%\312\024x+\250\247\177\257\307x\r\353\367\257\220\340 \270\021\\\024E\017\013\370\272\025\377\207\210\020\361\035\311\250\221\275S\n,"
+	.string	","
+	.string	"+"
+	.string	"\376^=\300\001\020Q\305\311i\267N\331\361\357\361\363or*DT\332hA\tC\217\030\206\335u\274\b3ny\333\006\266\027l\223\002"
+	.string	"\273\032'\323\356n\254p\275\322P1\332\027\371\210w\022\211\007\354\216VL\273uc\204\353\225\353\t\254W\327\005\254W\266}\220\340\005\237\245\231\220\024v\rE\311a\237\332\335\265\034\3311\023\201\030\341-J\273\340\213\313\262T)\037\266=;c[\326\223\274\227X\305\001Z\304\326Q]\247\321N\007\3038\343P\315\203i\024\3245<l\016\037.\233\237\r\363\314\214v\223S`\016B\243\023\304qtf\352\336\376\003\n"
+	.ascii	"\252\244\223i\021\f{TPv\315\013\231\340\201\030\340J\322\324"
+	.ascii	"\030\3305\365"
+	.text
+	.section	.gnu.lto_config_streamer_status.15.9e667fa32684c841,"e",@progbits
+	.string	"(\265/\375`9"
+	.string	"-\b"
+	.string	"\362\21788@o\222\016\230\016\303\213\375\023\332,\300\266\311\344\020\252\302\311}\263g\030\001[\273\331\n\302\312i\307\333a\233\265\216\252\217\nu.\020\002\232\f\021\364BW\333\032!2\005[\337:\335'\344\371t\244\321C\004\bB\304m\232\b\344\ti[7\322:\007s\022\237N#q\\\247m\276\354\307\3109E\213\177\242(\277d\231\311pO*(\262U\261[\212\001\254\023l\375g\202\261\343{eT=\204\307~-\274\004DV\251b\26425Z3\031\203\265\200\374\336o\376\302/\253%^\277R\0072U0,\231_\302\nY\261\277\354\277#%\361\376\345\372>R\005!+\027)2\231\251qj\240)v\225@S,z\324+\364nM\352\300\221\241\202J\231\n\001\0322s\210Jm\364\330\037\341_\370]\002\f"
+	.ascii	"\252\244\223i\021\206\315D`\232\005\344\230\320]\303\365\261"
+	.ascii	"x%\230xp\367I\265b\022&\031"
+	.text
+	.section	.gnu.lto_config_streamer_flush.16.9e667fa32684c841,"e",@progbits
+	.string	"(\265/\375`\350\001\275\020"
+	.string	"\226\236lG\340\224(\035\270\250\207\351\354R\004_\311y\215w?m\225\024\227\207\252\003\004TeHq\214\306T\267\017\250\376[\213(\256\336S\225\326\037\032\267\f\341\b\003\206\3036\230\003\225!\027\200\241x\302\371i\226\354-eJ\001W"
+	.string	"R"
+	.string	"Z"
+	.string	"34\361\002\320\245C\220m\337\305_\264l\\\fk\340(EN\314\215\310\234\323+\235\324]\306\027\350.\227\304[\217\253-\3775\2070\003\"\307\007\272\036E|\243\202\035\034!\002@\230H\2221\361\275\346\372\001|\251~\036\3149\255\037\030\342\226\267\035\3016\212\255\026\002\f|[\006\016\240\022\227\276Kw\371E\221\375(B\363\2429;t\351\322\354\307\2713[\325\242\207\177H\325\237N\335I\265\214\352\270\352]\265\252\372\003"
+	.ascii	"\264\360\001>\306cN\231\234\221\271C\3368a\273e\223\250}\232"
+	.ascii	"\303h=t9\2019g:nf5\022\324\272\r\331b9\221\356\226\\\256m:\351"
+	.ascii	"?\227`\353Z\271\267\201\251x\235F\207Q\355\263W>\003e@G\303e"
+	.ascii	"\244.G:q\365\366\215\320\215wN\267{\033\030\212\227\346\374\325"
+	.ascii	"=0\023\033\022s\344\265\236\235\233]\232K\376\275`\353\001\243"
+	.ascii	"=\266U\217a\034h\316\031\246\333t\262:\245TN\253\026V\312\n\n"
+	.ascii	"\003\213\312\344\261\240TR\236i\305\362N\020X\265\341\264\362"
+	.ascii	"ZT\252\225G\022\316\307\2713\321\226^\366e\234h\033\310\202\260"
+	.ascii	"\210K\303\341@\306\263\202\347\263\266\204\343\030\007\n\240"
+	.ascii	"\267\017\310H\273\r\255=\201\202\376\373l\311\303\272\354\333"
+	.ascii	"`\221*\334&\305\244\026( P\002!c\322\016j\322\211\246\033lX\r"
+	.ascii	"\263n\353\276\211.u\310\211\221\200\016\301E}}hx\202A\355N?\351"
+	.ascii	"\372\032x\020\260\340`\323\\\220\016{\fnRhD\304\201\001(\fBv"
+	.ascii	"X\254\3410/\243\255\221\324\217\302\315\253q\t\017\243\177a\033"
+	.ascii	"\265\345 \314\337n\244\013\264\3364\245\350P"
+	.text
+	.section	.gnu.lto_config_streamer_finish.17.9e667fa32684c841,"e",@progbits
+	.string	"(\265/\375`\362"
+	.string	"5\f"
+	.string	"f\226RB"
+	.string	"Q5\0358\351e\273\315\200\013\t\005\354\214:\275\017\272\356=\003\353\362\340~@\222\200_XD\367\314\355\253\004|G"
+	.string	"\366C\373\247\023\322\377\277\001\002\204u0\254\365wg\243~\\\211\b\331r\247\024>"
+	.string	">"
+	.string	"@"
+	.string	"\273\313UN\311\216\315\023\310\216i\210\203\237*A\377\2567"
+	.string	"q\022\t\305\320g\207\353<\360\002\241!@$M\212iDx\327\245\006q$\245\306`w-C\221\303\215\335\266\003\333\n\354O\b\343?\245\364\267L\tSI|\251\306\256\251\344\306\276\300\\\220\260\r\332\023\333\227\366[G\001~\004}\300.J\344cwD\340\004\3331\217\233m\337\304Y\240\0352G\225X`%#C\307H\362\241\001\250Xm\260\361\032i\350*\222\327\207\372\223]#p\300 I\022\333\026\236\342\263\355\356\002\237\343\002\206M\3041\037\224\035\273\352\207\025,\017'Z\"Yb\217!\251)\373s\025e\253\264\366\335\335Y>\314\346\202\371<\035\b\0224\031\216\327q\034\315e\303u_\207\263\030\260G\001\363q\036\317\373\270\311\270\2675\255\210td{\363\026\016\321TA<bLMu\234E"
+	.string	"\325\203\223\307\310\214M\332\025:\001\026"
+	.string	"\252\244\223i\021\206\341Z"
+	.ascii	"\034\346A\212\241sB4\b\342\n\203\255H\035\f\026\240!\023+\260"
+	.ascii	"c]@\263\206\013\343\221f\244(c\0044\021I\t\264\352\246)\205\202"
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_write_word.part.0.23.9e667fa32684c841,"e",@progbits
+	.string	"(\265/\375`v\002e\023"
+	.string	"f$~H\340\360&\035\330\013\273\024\374\005\004\210Q \020\236!}\032\326\303\327v\204\024\001\373\276=c\354=\017\035\301\312\177\226\317\n\3206x\236\024n\346P\0063\264\241k\020\266*\300\225$p4?\274\357\326\251\204\354\275\345N)f"
+	.string	"k"
+	.string	"e"
+	.string	"5\307i\251Vp\301\247\031x\237\006=\373@.4\333\276\317\177bv\223\004yj\035M(\203\253Qk\375>;\216\200~\312\037\240\237\273\363\330\247\334Hc~\234\251\275|n\021\r9cT\310\240\302\232\206\257\204\360\224\001\210\2436\223\307iq{\370HS\223\305h\340\264\003\251\265\332\273\271\273\333\016\261\035\301\216\271;\243\343q\377\005|0\006\330j\265\211\272Q;L&\020\317\375I\367\223~\344\227@*\362\221\234\362^h\236R\215O\214\373E.~\350\224\355\347n\264b\332\215V:f`\255\245\270"
+	.string	"\177j\324\nz|\372\201\027\263S\336x\034\021\313\022\261\250\b\324\331\355C\203\030?\344r\241\026\025X1\320\034\243\375\240\203\261\013\265\274@\r!\236\214\352z\360>\200\355i\303\256\216\345W\350\\\325\210\235\033\213Y\264a\216\030W\256\315\"\211\237\231\333qa_l\227\334\204\211Wku\3403Q8\361{>\375\026\n\200\204\277T\241\345\367\370,\3643\356\303+\270I!\203:\342"
+	.ascii	"\023\243\342\352x\351e\335\034\273\213\366htG\243\351s\367\244"
+	.ascii	"\321\362C\177/\025\230\b\354E]\254\221\021\225\ttu\257>\\\254"
+	.ascii	"\023\021\226\013\366\n!)\031Ai\255>\224\022\221\223o\345z}\037"
+	.ascii	"\t\334Ja\271>X\253\345\372R\337\034w6/d\224\244\307\037^BM(\243"
+	.ascii	"\264\026\356&\352-\215mo\r\002\2632\357e\355\326\311dy>#C\336"
+	.ascii	"\204\322\3556\342bl\262\030u\202.\r\022a\003\332\357\f\0248+"
+	.ascii	"d\274\0051 \200\002\031\263\253\003\352\351\234Z@y\246~\025\026"
+	.ascii	"\324a\314,\362*\003\205\325\013b\035M\313\343Pth\302npm+\260"
+	.ascii	"\362\3571\nc\033\234*\203r-s`\007h\351\021\346\\eH\347\212\215"
+	.ascii	"*d\222{\0314[=\2536\004\361\t\332\214ov\211$\221\033$\275\223"
+	.ascii	"\255=\355\006\b\355\036\232\254\272v/\f\364u\342\b\240\274\367"
+	.ascii	"Z<\006"
+	.text
+	.section	.gnu.lto_.symbol_nodes.9e667fa32684c841,"e",@progbits
+	.string	"(\265/\375`\321"
+	.string	"\305\006"
+	.string	"D\t\315\001"
+	.string	""
+	.string	""
+	.string	"\002\027\177\017\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\220\202\202\200 \f\177\020\377\377\377\377\003\006\n\177\021\272\220\202\002\013\177\022\r\177\023\360\372\2508\016\177\024\017\177\025\020\177\026\021\177\027\005\t\030\301\204\001\025\177\031\037"
+	.string	""
+	.string	"\200\220\200\001\024\177\032\022\177\033\023\177\034\026\177\035\003"
+	.string	"\nd\003\001\013\320\360\372\250\001\001\304\001\003\001"
+	.string	"\267\234\305\316\002\001\202\006\003\002\f$\003\003\r\004\001\244\262\235\334"
+	.string	"\007\f\344\001\003\007\001\242\006\003\b\016d"
+	.string	"\034"
+	.string	"`h\227\241\263\032\f\202\001\2058t\f\225\031\034\250\035"
+	.string	"\035"
+	.ascii	"\235\017d\333/E\030a<l\323\202\234M\240\001=v\276\241\340o\200"
+	.ascii	"?R\t0\003av\376\250\312\"W\335\200\340\202\343t0\235"
+	.text
+	.section	.gnu.lto_.refs.9e667fa32684c841,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.9e667fa32684c841,"e",@progbits
+	.string	"(\265/\375`\253\020\255Q"
+	.string	"\252\211\030\036S@\022&\r\007\366\017f\271\204\034\001t;\262\233\250\250\017@\314\221\333'\367\007\243\354\273\034\223BW\361\330\334\316\031l\204,\b\250\032\227\345,+\030\306\242p\334\201h\367\267\352\332Y\265v\315LtML\235%\356\336\274:\036C#hW\342\233H\231\002\210\001\306\001\341\001J[\204<\341\363\333\003=\f\373\262\335W\n\375\346@\303\226\271h_\034"
+	.ascii	"\301\006\327\275>\202\337\207l\223lS\205\261;\252\007\001\252"
+	.ascii	"\\\020Yq\335\335d\213\330u\311~\256;;\003\324t\205\025\021\333"
+	.ascii	"\235\337\346\227\311\n\335\002\364\336\230\254?\370\\%\273dW"
+	.ascii	"\003v\354?+\256S\267Z\253\367\345\207/^\370\374\017\375\334\032"
+	.ascii	"\260[1\237/\021&vN\312\265m,\360\261\003\b>uA\350}\350U@\237"
+	.ascii	"\002z\027\350\r\332\236\330\345x\275\354\264j\036u\360\371o\327"
+	.ascii	"\277Y\253\265L\035ri\331_\335+\016\215\025\033r*\237Kd\213\354"
+	.ascii	"\252\263G\276[\313u\336qmf\367j3\323Lz+\3433gO\354\316\036\364"
+	.ascii	"k\344&\266z\305\031\375\352\354lVg\367uO\354\3205\261\373\227"
+	.ascii	"\307\004\270\006l~\216a\3613\006E\377\226\200\342\347\013TTp"
+	.ascii	"\376\354\303/b\354?\331\177&\377\327\260\374\177[\022\376\003"
+	.ascii	"\240\342\002\374\274+\302\277?-6\204\337\374\f\363\237\355_\016"
+	.ascii	"@\370?\345\177\225\377m\377\335\254\274\346\347\002\376\315\340"
+	.ascii	"\203\303\374l\363/\213\177;\370W\203\177#\370\267\347\337\006"
+	.ascii	"\376\315\371\367\200\177U\374\233\342_\023\377\366\376\215\371"
+	.ascii	"\227\377\325\375o\376\207\373\277\345?\022\377U\370\177\302\177"
+	.ascii	"\263\377\\\377\265\374\317\362\377\312\177\027\377\255\374\357"
+	.ascii	"\372\317\374\177\300\377\262\3772ssss?\323\360\363\324O\363\""
+	.ascii	"UM\306\232\370<C\241g$\372\363\277\353\236\001fm'#\315\027fW"
+	.ascii	"\347\357\255n\025\320! \327\215\203V\026\364J\254x\3439\255\323"
+	.ascii	"\255:!\231Q*\016\222Yld\027Z\022\007\271\266\016\001\232\271"
+	.ascii	"\243\221\353R=\227*\367\332\307\250d\037\227\252\f\344\332N\275"
+	.ascii	".\325\233>&o\220kQE2\243\222\213d.\2238}l\265\217E\035\350q\231"
+	.ascii	"D>Y&o\220\314b\022y\214Jn\257\313^(ck\224z\324\314b\257\273\227"
+	.ascii	"\326*\225\246\273\350\324j\0323u\024\034S\347\350E\373a\335\321"
+	.ascii	"\335\335\352\327\232\324\222\267\032"
+	.string	"\033\r\031dIt\324\275\326L\022\250\253\256\335\215\324Fu\273\217V\247n\343r\005\345r\245 9u\257\217\305%\243\324\222\346\310\270D\352 :6\211dJ-}\224x1\253\332\270\252[\325kQN(S],=\246\017\345\322\026\236\032\226\033\276\336\320\177\225 \233!\302l\033BK\026\035\r\"Y\304V-\232\246&\037K,j1YdR_|e\255\360\264\240\200\204\361\t\227bf\210\334\222\221'\350Wk\2106\270#\236\030q\246\365\373\264\255\223=SaD\262(b\266\266T6\211e[\267\255\262o\273n\333\242}\241l\332S\254\335\307/\2607\027\355k\003\253*p\313\365\257\020m\213d\311\026\355\253O**HW\202\370\177Vl\333FY\265\032u\355\246\0377\244+q\335\353\316\316\316N\212\235\235\235\225\242F\241\341\346\\5^$v\312Wm\245\320\034W\355\354.\356&P\263\233"
+	.ascii	"L\363G\221kw~\311\320o\030\312:\233\205~\257\320-\333'\273\276"
+	.ascii	"l\315~\006S\342xd\235IE1\362\311@\324,A\022\242\314\t\312>\234"
+	.ascii	"\261~\036oI\216\251\250%C~^\f\230\332\215\2520\364\247W\017="
+	.ascii	"\360\325\336\254F\266\244*\021lL\271bu\276R\256\305M\235\301"
+	.ascii	"T\371\232\301\210!\334\243\007\003I\261T\255T\220\\\2469\211"
+	.ascii	"\353V\352\354Vd\221#\037g LU\003\354\210\222O\376\261SB\351\260"
+	.ascii	"\205\317\237H\224y\370\271\265\354\351\2126\314\304\370\344\035"
+	.ascii	"\366\214\251\256n\224\351\224@\177\216Z9\212y\260X[\375A\342"
+	.ascii	"\244t\2007\225C\321\212\3173\217\237\245x\307\261\306\212\213"
+	.ascii	"V\025\237<\345s\316\201\247\203XR\032\237;7\267&v7\335{b\307"
+	.ascii	"\335\272\266\345\322M&\216K\t\034Lr\344`\034\253\264\240\207"
+	.ascii	"\262\252\r\223\241\271\212@A1\016\026I\236\240\260xGIY\305\033"
+	.ascii	"g\034M\324\353G\021G\0365j\260\322G\371\004\205\325J\034:h[\261"
+	.ascii	"\006\266\032\316\312U\2339\202d\252\213O\266\241Sjj\342' \\\236"
+	.ascii	"\240\342\324\332\322\220\230\341\374\324\354\255\201\301\341"
+	.ascii	"\300''md`\363\361\306';\255\026\032\265-H\250l\334\356\254I\256"
+	.ascii	"\213\226\244$fBo\332\030\205H\225.\rK\027\032\226\316L\347\221"
+	.ascii	"\024\252/|\262\222.\b&L!|2\215=\273\001\205\324\364\346YCI\226"
+	.ascii	"\331\021(\307\30010\022\332\313\205\245\324\231I\3122k\036\235"
+	.ascii	"\221\336d\2704\241\201"
+	.string	"\344\34613%&0\324\013\033\275pq\327\275\353\262\311i\271l\227\257\334\345\270\210\252\3351J`OPq\255t\322\371Y=\027\337\244\351V\341\002VY\221\317]\202\033\315b\363\242\305='\203\226T\251\340z[^\244\232\317\375\262hk\243L\200P=\361y-\313\353\005\251\217((G\350\027\034\002\016\203F=\026\202\204-dP8\021\317P\020\230\022\207=?!\243\242\240 \260'\035\032\365\240(*2\n\006\205\301\030\"\320n\2060%\"\n\20310|\277\242\223\370\033\306\370\305\330\375\206|$\374\206\276\224\003\233\023\361\2648\341\003\027=\304\337P\352#\346\270\240\021J\205)\304\360\245C\302\224\004 \026.0h\321\001\216\217\350\333 \2060\225\361\373\311\020\r\201A \f\024DC\243\"\030C#\242\2178D\361+z\341\033\002\0138A\004\006\201\001<H\006\002\036b\352\223\301#\224\ng"
+	.string	"\375\210\300t\006\316\203\200\351/\370\033B/\301\004\017L@A\0131D\240\237\bPb\221P\230\001\020\214\320\217\205 aQ\320\b\035\342\f\207\277TH\310\027C\004J\2112x\304\324G\034\302\374^"
+	.ascii	"\016\317\0231p\241\214_\332C\024\n\323\236\031\"\020\005\304"
+	.ascii	" \320(\346\305\316\330\035\321\307i\372\323\021\201~2\\ \002"
+	.ascii	"\005\207\200E>\240\364\007\003\206\321\013\240\005\356\343\243"
+	.ascii	"A\016\n#x\200\006\361\244\277\030\276_J\034\002\r\001a\004\205"
+	.ascii	"A=A\240/FOP:\354\341Y`\214\201\364b`\202\032[\322\\4,\034\252"
+	.ascii	"X\t\023\201:\021+>\261\030\232D\tN\231\244\250C\206-)aW6]\254"
+	.ascii	"hT\2554M\272\226\216C\260\227\0206\350 \005\306\\5hF\346z\360"
+	.ascii	"\371\365\305^\310\252\336\022.\t\025\246\256\277\213\275v\253"
+	.ascii	"\233R\314\301\2459\211\343\355\360\303j\t>we/\230\264 T`|\036"
+	.ascii	"\246\205\234\177\020\302\\:\265][\271\324%\321d\212\025V#\225"
+	.ascii	":3G\224\216@)r\346:o\375\254\270\033\326\020\265\"\237|\3445"
+	.ascii	"J\263%pFx\375y2WSL\037\240\240\177`\313F2\311'\023\271[\020\267"
+	.ascii	"%+|\262\326\2334\312\201T\250\241(g\030DFdFDD\222$I\0071\005"
+	.ascii	"\204 F)5\017\022`U=\020\032\207fdh\n\222Z\033\007\232\232\027"
+	.ascii	"}\263\317\324_\240G\004\376Q0'h_\230e\233"
+	.ascii	"\3045\303U\3172\226\376\\p\255\207<\2379&\316ol\341\274Hc\250"
+	.ascii	"#bp\214\264\236\217\033\035\242D\351j\002|\277s\326S\310f\361"
+	.ascii	"\306Y\240\366v\f\252d|Y\326\234(\031\210\273\313\213T/\031\323"
+	.ascii	"\007\374}3%s\245b\301\022\203e\177\035\340\263\261s8\370\262"
+	.ascii	"\312Z\272\223\032Q\262\261)\315^k\345\312\0134\304\207\036:\271"
+	.ascii	"\236\344\215!\2650\345X\005T\211`\265\035?)w\226\020.\240\363"
+	.ascii	"\363\021\205pR\224\214I\254q\037\b/\354mO|K\021\364\325O\316"
+	.ascii	"\347\273B-\210\210\002\017\013\236\303Thy\320<\320\360d"
+	.string	">f\203\022\221\210^\262\350[\bfNax\t\240\001\003\272\322+\305\264?Es'\022\364#\352\234\357\317\345\317\266z%\314g\377\246\376\347\020\001/}9)k\330{\035GV\032\247\270\013\037 \317\200v\007~\223\224\326\213N\324[^\316O\036g\365`\302\026\201\267s\204\335T\267zKu\370\216\017\033\223\207\363q\362\255~\262]\332\361\021\021\024&\350\264Y\360F\370\3752\001\202 \360wJuY\362\3417\204gv\203\244n\234^}`\304\007\374O\335\322\311\177\352\034\371\n\351\026?\307O\005\2739\265\216\026zq\264y\236OyD\236CU*\037y\221 \354i\245\243^%Q]\240\342\023>1.\233D\206l\374\316Z\324\315\030p\346\237\336#\271@\376\321\3067\302\007\240)\204q\361V\340\f\332\220^j\344\266\207\001\302\315a\337\206\340\213\002\220\005B\2507\2018q\201G\331'8"
+	.string	"\364\230\032$\235\262\f&3|\374t\224\027\317vwB\377\224\256\t\263\306\035\261d\362'Il\227x\3436\007.\214\fz\013q\226\356 \342o\001\370\023i\334\314t\021\276\363\034\002@\3410\315\002\323\235\352\376C\322\354Y\363\351\300\037\311\335\354\217\370/\210\314\211\034X\356\241\217\3230\300'\006\323\305\030G\306\265\\\177\370VQ\234\270\337\364\214\202\361\313\f?\271S\334\237Q#\364\346T\177\364\177I\016\263\007\216\024\367\004\372#\266\033\243?\360e9"
+	.ascii	"\277\221[&n\353\277\372n[\214\332\217\372\267Z\233G\312\227\232"
+	.ascii	"\263\306p\t\237'\272\351\377\342A\311\016\345\2734\215\365\037"
+	.ascii	"ri>#\251\002"
+	.text
+	.section	.gnu.lto_.symtab.9e667fa32684c841,"e",@progbits
+	.string	"config_streamer_init"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\001"
+	.string	""
+	.string	"config_streamer_start"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\001"
+	.string	""
+	.string	"config_streamer_write"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\001"
+	.string	""
+	.string	"config_streamer_is_writable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\001"
+	.string	""
+	.string	"config_streamer_status"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\001"
+	.string	""
+	.string	"config_streamer_flush"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\001"
+	.string	""
+	.string	"config_streamer_finish"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \001"
+	.string	""
+	.string	"eepromData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\001"
+	.string	""
+	.string	"FLASH_ProgramWord"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\001"
+	.string	""
+	.string	"FLASH_ErasePage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\001"
+	.string	""
+	.string	"FLASH_Unlock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\001"
+	.string	""
+	.string	"FLASH_Lock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.9e667fa32684c841,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,522 @@
+	.file	"feature.c"
+	.section	.gnu.lto_.profile.52657b129e03c5d9,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.52657b129e03c5d9,"e",@progbits
+	.string	"(\265/\375 \250\265\003"
+	.string	"\264\005\234"
+	.string	"\r"
+	.string	"\227\247\344\313\017\004\002"
+	.string	"\002\001\002"
+	.string	"\002"
+	.string	"\001\240\342\234\212\n\002\003\203\313\255\261\f\002\004\312\251\326\231\r\001\005\335\374\335\212\013\b\002"
+	.string	"\006\364\327\362\364\r\007\347\364\313\323\006\004\b\306\272\236\261\001\t\222\200\241\200\n\217\204\314\271\002\013\255\363\313\362\b\f\240\342\234\212\n"
+	.string	"\n"
+	.ascii	"Z\030Zf)\2000:g\345\360\305\321q\211\2423\314\224\3336\200\005"
+	.text
+	.section	.gnu.lto_.ipa_sra.52657b129e03c5d9,"e",@progbits
+	.string	"(\265/\375 BE\001"
+	.string	"\2706"
+	.string	"\b"
+	.string	""
+	.string	"\001\003\001\003\004\005\001\006\007\b\t\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\007"
+	.ascii	"`\b\030\027\f\202\313T\246\311\fp\003m"
+	.text
+	.section	.gnu.lto_.inline.52657b129e03c5d9,"e",@progbits
+	.string	"(\265/\375`P"
+	.string	"\305\003"
+	.string	"\002\005\017\027\260%\351\fE\223\202QJ#j \222$l\264\021B6![\356\024\377\374B\366A\227\254l\312\377\230\240\261.@\333\340KBq&\303.`\377\234\367h\360+\261m\311\233k\b\030"
+	.string	"Q9\260\203\212\305\272\020X\006Bp\301\260\325` \031\341&\b\354\224\254\300\260>j5\200\007\307\2260\261\205v"
+	.ascii	"\362\3000\300\344(\2743\033gA\302\245U\r\270\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.52657b129e03c5d9,"e",@progbits
+	.string	"(\265/\375 BM\001"
+	.string	"\3206"
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	"\003\001\001\003\177\002\003\004\005\006\007\b\t\001\001\003\177\002\003"
+	.string	"\006"
+	.ascii	"`\b\030\007\006\003C\250\214\264\001,"
+	.text
+	.section	.gnu.lto_.pureconst.52657b129e03c5d9,"e",@progbits
+	.string	"(\265/\375 \035\351"
+	.string	""
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\b"
+	.ascii	"\230\004\003\204\004\004\204\004\005\232\004\006\232\004\007"
+	.ascii	"\232\004\b\232\004\t\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.52657b129e03c5d9,"e",@progbits
+	.string	"(\265/\375 \312]\002"
+	.string	"\224\002\276"
+	.string	"\b"
+	.string	"\001\002\004"
+	.string	"\001\002\003\001"
+	.string	""
+	.string	"\001\002\005\001"
+	.string	""
+	.string	""
+	.string	"\003\001\300\007"
+	.string	""
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\005"
+	.string	"\006\007\b\t\004"
+	.string	""
+	.string	"\016"
+	.ascii	"\2202\005\003`\035X\030X\244\347:`\204\244\216NE\302Mb\324\274"
+	.ascii	"c\027\037\004\274\001,"
+	.text
+	.section	.gnu.lto_.lto.52657b129e03c5d9,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_featureConfig_Registry.18.52657b129e03c5d9,"e",@progbits
+	.string	"(\265/\375 \236\255\004"
+	.string	"t\bh"
+	.string	""
+	.string	""
+	.string	"*"
+	.string	"\005\001\212\001\206\200\200\374\342\203\244\354\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\376\006us\250\326\006uq"
+	.string	"\005\001\006'\001\004\005\001\006\035\001'\001\023?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\034./src/main/config/feature.c"
+	.string	"\004"
+	.string	"\237\n\013&q\020u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_featureConfig.20.52657b129e03c5d9,"e",@progbits
+	.string	"(\265/\375  \001\001"
+	.string	"\023"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006(\001\200\211\201\202\003?\202\210\200\b\177}\273\001"
+	.text
+	.section	.gnu.lto_featureInit.22.52657b129e03c5d9,"e",@progbits
+	.string	"(\265/\375`\022"
+	.string	"E\007"
+	.string	"\022\01635`m\322\001@\337\r\024\260u\234\367\262\200)\306\220<@\r\325\212\224P\227\f\3271\320\266\327b\241\205\201\240\362\b\002Aq\321\227\360\354\360\244\377H6\221;\245\306\256Lr6\224\254\002\031,\025L\304 \306B\271@Lj\340e\340\330\220I\270\211QB\213\264\235Z\005\275\r\323\246\036_\375\217\203\\\374\220c&S\375ii\226Xs\017N\300nD\202\337\361\221\203\037\372\363C\307}\376\371\235\352\357\272\200!\032m\356d\223<N-\354S\273\273V\220}\347S\226\006A\310.\305\351dMO$\303\366-k6I\201\304\300\310D\311dw\241^\\\273\323\374s\\`~ \356"
+	.string	"\024v\327n~*n\275\355\003\333\b\266E\001\t"
+	.ascii	"3\241{\037x\305\\\366Tr\210\252\301\273\340\177\0317\\\216E;"
+	.ascii	"\311"
+	.text
+	.section	.gnu.lto_featureIsEnabled.25.52657b129e03c5d9,"e",@progbits
+	.string	"(\265/\375`:"
+	.string	"\235\b"
+	.string	"FQ>90\345(\035\3003\004\027\f\232\0275i\250.vx\244FB\037\360h\003\177\344m\375,\017\255\001\004\333\234#A\204\202\202\002\210\"x\270\212t\033\004iKH\223M\244L)-"
+	.string	"/"
+	.string	"*"
+	.string	"\207\266\335\340\360yt@\241-"
+	.string	"N#/\273\254\250\032\037=G\376?\256\340\302\202J\221\236\001\017\273\353D\245,n\275\355\004\333\321vJNM\037\033@1P\331\255h\005\330\025h\302a\373\2633\2663\355w\334\343\373j\302\230\335\013\222\222]\021\006/\b\034j^\200\035^'\300\002\331\362\245\327\324\237T\246\203<\304\3637\034\022\345Q\207\276\b;\274bT\245l\331,Rj\206\375kw\327\212a\370\325\177i\006\021^\346\271\254m\266.\004\3126N\204\350p>\234\026?\235\314\023\265\316\213\033\004s\022[\027A\034\327\305\fko\250\232\222\232\354{X*\324\237NL\001\b"
+	.ascii	"2\003\302\260\200\341H\204\262\244\313\250@\215o\342\020\246"
+	.ascii	"sM2"
+	.text
+	.section	.gnu.lto_featureIsConfigured.26.52657b129e03c5d9,"e",@progbits
+	.string	"(\265/\375`M"
+	.string	"\r\t"
+	.string	"v\322A:0\345(\035\200\213\0073\177\025(\027jhe\re\203E\232X\t\236\255o@\206\001?\364o\006m\007\005\333\234kz\035\f\f\bai/JY\235\207\256\334-#\233H\231R0"
+	.string	"1"
+	.string	"/"
+	.string	"\004\332\241m34\244\254\372\327\321z\206\307B\021\260\373E\345\270\352\251\362?r\b\362\202\361\\\024O\201\207\335uz.\213[o;\301v\264\r \260?\323tj\372\232v\361b\320\262\333\212\rX\027\250\362a;eklg\332\017\271H\3520\224\007v1XRvO\026\254\2209\334\274@;\314\036zM\205\001X\257\316\0237Aev+\034|\222\227\220|\217C\233Ny\357\320?i\207W\204\030\330*c\366\327\245n\330\317vw\255\032\206\017\021\244\216(\263\207\363\341L\245\316\007\024!B\240\321\346\211\243PG\024=\034)r\016\274I|\270X\3326.j\276\325\ru\263\322\316\376\246\245B=k\245\313\230\263\b"
+	.ascii	"2\003\3020\275\341\310\241\262\272\313(E\215\177\350\020\306"
+	.ascii	"tM2"
+	.text
+	.section	.gnu.lto_featureEnableImmediate.27.52657b129e03c5d9,"e",@progbits
+	.string	"(\265/\375`\323"
+	.string	"5\013"
+	.string	"\366\023IA \251*\035X0\260\\\340"
+	.string	"\006\346\240\207a9\374\205\265\023\300\300H\201\373\234\200\200(\r\220@\013\375\f/\005\024\225l\204l\271+\004(\022\t\" \366\250;\220\201"
+	.string	"\200@\2031\262\211\334)\0053"
+	.string	"7"
+	.string	"5"
+	.string	"\216X\270|\370e\273\324\316\260]\372\263\033<4\331\273BN\002 \354\356\324\222\177\217\237\177\326- j\343Qabw\035A\224\307\255\267\ra{\332\027\005\326\276\372U\243\243eSY\320\200`\267c&a\025\310\003\252\327\r\200<\300[\244\207\256\210q\2276\311\346.#g\373\321\376\312\001|_i\330\262+\222@\266\373\222\b\251M\013\034| Uu\323O8}\230>\340\0042\374\023\203D\361\340h\273\224\372\326/*\027\003X\252\024gvh\212Jb_\333\335\265\216\330\032\275i\264\324\030\027\240\214G\263\006\263\361D\241\314\2063-:\234O\247\231\237N\30635\036hb\034\334al\274\031\352:ora\351\254S\244\310\"8(\251\311\232\306T\243j\260n\024\365\257\037\205#\033"
+	.ascii	"2\003\302\360\317\302\"\233x\0208\251\314\002\327$T\200\270\340"
+	.ascii	"\360P}z.\202\225%\305\356*\233\223\232\002\007\333\3125 \204"
+	.ascii	"\b\020. #g\022\240V\256`\211X\265\002N\362\342\232d"
+	.text
+	.section	.gnu.lto_featureDisableImmediate.28.52657b129e03c5d9,"e",@progbits
+	.string	"(\265/\375`\343"
+	.string	"}\013"
+	.string	"\266\024K?0O\224\016\254x\201#C\343\253\252\006\037x\230\033y\223\221\344\025\2765\260\t\306\003\035\017\264\212\265\031\264\035Vls\256\351u\310E\262j\300\016\375A! \206E4\023YD\310&R\246\0246"
+	.string	"8"
+	.string	"7"
+	.string	"{\n`"
+	.string	"\031\207\036\217\\\207\3267\256Cs\366\212\177\023\366\035(\200<\270\330\335\250\022\316=9\377\245C\274\220\202'&`w\235^\310\301\255\267\375a;\332_\020\232\206\232\266N\372U\323\251q\231H\301Qb\267\301\n\306\242\200#.\234NBt\0167y\376\231\200*;\264=vv\230\231\355\247}\r\337\300\235\224\300\220\335\007'R\033^\213K\241b\372\030 Q\227+\253^\232*\320?\034\004\002\277\2025\234\274\327\271\016\241\336\364H\206N\005j\364\311\225\375u\251\021\354[\273\273V\b\266\2461M_\001\0064\023\214e\212\244\262q6\223\212%\026\270X2\032%f.\023L\244l\232(\351\260v\240\262\305\215\246m1\373>/}"
+	.string	"\206\324\013\026\037\355l\251\210T\013\245uR\177\372-0\030a\032\342\001\033"
+	.string	"2\003\302\360\322\302\242\233x\0208\251\314\202\234$("
+	.string	"\273\240\341\241\344\364\f\004\001\253\312\356\020\354\235t\024:\204\226\256\001!D\200p\001\0319\223"
+	.ascii	"\265r\005K\304\252\025p\222\027\327$\003"
+	.text
+	.section	.gnu.lto_featureConfigSet.29.52657b129e03c5d9,"e",@progbits
+	.string	"(\265/\375`o"
+	.string	"\245\t"
+	.string	"\206RC<0\345(\035\200\277\236\277fl2\035.\235R\271\377\006\336\206,\005\006\216\025_,]\345\360\2060V@\333A\3016\347\232^\207\226d\243\241\302p\207\032\346\txb6\310&r\247\024."
+	.string	"3"
+	.string	"/"
+	.string	"\327l\227\332\r\266K\1776\314\303\217\375k$\025\013\260\273S=\376=~\376[\317\200*\213\307\201\206\335u\004U\030\267\336\266\202\355i\277 \003\\\016Xv/f\004\266E\252\254|\223\273L\017\375\260\"\262\273\334\245m\262\271\313s\266\037\355\223\274\344;\253\302\231\335\215\024\331.\214\301\013\004\227\t\001\251\f\324a\217M\370 \036\225\342\301K\237b\273\214z\3275\253\327\013\212\306)\316\354\020\025\265\303\276\266\273k\345\2605Z;\353W\215\216\333\026\021#NHsg\343\361J$\216\3473!@\037Q\327\231\"\020'4;\336hn\020\334Ix\274I\352:or\341\351\255;\204\310\004\304\234\024eMO\016\002P\215\252\351\013\004\016"
+	.ascii	"2\003\302p\036aYL<\bXR\354\256\262\211\244\254\256\313h\246\342"
+	.ascii	"\001*\004\261:\r\256\345\2050\311"
+	.text
+	.section	.gnu.lto_featureConfigClear.30.52657b129e03c5d9,"e",@progbits
+	.string	"(\265/\375`\177"
+	.string	"\375\t"
+	.string	"f\323E=@\305(\035\340\265^\254\253\273T\007\230\200\373$\246\375\007kL`%\344\246\334e3\324O\305\327\240W]{\230\262\341\304_\371a\r\005\2149\017\261la\314\365!\026\255m\"wJ\0012"
+	.string	"4"
+	.string	"1"
+	.string	"\004\227\006\337`.\265\027`.\355\331\001\036r\354KNT1\002\273;u\343\336\243\347\337u\r\270\242x\314,\354\256#\270\262\270\365\266\021lO\373\007\001W\215\216\231\f\313\205\303\262[13\260-2\305\303'\371\013\365\320\r/ \273\273]\332({\273\374f\373\321\276\310G\274\267&\254\331\305X\221\355\302\024\234\020_\234YU\323\250\242:\354\261\b\277\303\245S<x\351K`.\243\376\365\315\307\007"
+	.string	"\205\225\2123;\374\242j\330\327vw\255\031\266FK\215\326\336z\017%\317H\363\247\003\352N&\017(4\035D!\022\367\231$\221g4?]iv8\346 @\3354q\\7\2670u\327\031Bd\005\004\244\364\263T\223\203\0034\215*\365\007T\027\001\016"
+	.ascii	"2\003\302p\301\3022\231x\020\260\252\354\016\301^$5t\270\314"
+	.ascii	"f*\036\240B\020\253\323\340Z^\b\223\f"
+	.text
+	.section	.gnu.lto_featureConfigReplace.31.52657b129e03c5d9,"e",@progbits
+	.string	"(\265/\375`&"
+	.string	"=\b"
+	.string	"\006\220;9@o\323\001x\255\301\216\223\371bl \306zc )\020\177\214u\004\206\266%\267\201x\226\275\255\224\332\264\fB\216c@\364\213\035\f:\030\337\006\006df\277\355\275wJ\001("
+	.string	"-"
+	.string	")"
+	.string	"\324\236\355\362\020c\237J\211\030y\331\335*/\356=z\376?\276\001M\020\217\031\204\335u\004M\023\267\274m\002\333\3256IG\375qf6V8(\273\022\253\230U\321\023\215\313\366\243\375\216{xG=x\263[\241R\262+b\340\002\315\351\300\003\254\323y"
+	.string	"\353\001\356\236\032qXv\367\300\007yH\203\237qj\007R<x\352\223\254\323\313\244\005\206\342\213+;,Eia\177\356\356Z\236\354\013\035\006\232\316:\0327\022a\232\247*|<\241-\253\241\017\006\252\031\327\325\216\2007\006\215\253\242m\343\352\025~\237+ON\340P}\262\344(\035\b"
+	.ascii	"2\241\231/\360\342\002,\230w\t\200XM\001wy\321N2"
+	.text
+	.section	.gnu.lto_.symbol_nodes.52657b129e03c5d9,"e",@progbits
+	.string	"(\265/\375`\f"
+	.string	"%\004"
+	.string	"\224\006\b\001"
+	.string	""
+	.string	""
+	.string	"\002\026\177\006\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\220\202\002"
+	.string	""
+	.string	""
+	.string	"\005\017\007\301\204\005\025\b\300\003\002\031\177\t\002\032\177\n\033\177\013\034\177\f\035\177\r\036\177\016\037\177\017\005\024\020\305\204\001"
+	.string	".pg_resetdata"
+	.string	""
+	.string	"\005\022\021gistry"
+	.string	""
+	.string	"\005\020\022\301\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n"
+	.ascii	"\345\334\006\240\035\370\034\370\034\370\034\370\334\316/7E\232"
+	.ascii	"\205\211\310\252\236"
+	.text
+	.section	.gnu.lto_.refs.52657b129e03c5d9,"e",@progbits
+	.string	"(\265/\375 a\345\001"
+	.string	"R\304\n\020\260'\215\001\f\3030\221\231YK\366\2262\245\024\t&\354\003I\r\b8\031n\330\3045c\032\333\\\242b\306<\2617\255\253B\005"
+	.ascii	"?\t\001#\2519*%\260\tf\023"
+	.text
+	.section	.gnu.lto_.decls.52657b129e03c5d9,"e",@progbits
+	.string	"(\265/\375`b\016]I"
+	.ascii	"\252\200\374\033VP\022\036\245\003\376\313\301ff\247\027\313"
+	.ascii	"\t\025\215\212\333\037i\233\034\024\274\376H7\t\003]\275uiR\256"
+	.ascii	"\225\250\r"
+	.string	"(\027y\333\220\215\220\016am\237V\266\243\020\246\364\032\205*\001$\200\252zT%\252;Q`\371\r\200\276|\021\316\034\037R\037Q\322\375\245L\001w\001\252\001\260\001\277a\243S8\251\235\312\222\232\251\027I$\365\321\335\335\250V\362\311hK\201\215\024N\031i\034u';)\006\272h\332\3355\032\210n\367Q:\354\006\032K(\032W\254\306\260k:\370C\002>\031i\216\200\306\032=\325\264D\341\361\311\330\343\225u\224j`\212\256T'\235\206\346\021M{\265\324\034\241\212H\\\227\344\2248\354P\304(\r\240\330\003\216\256,s\353\n\362\006\327\177\271V\313\207\327\0200\256_\340\357\371jm\272Y+lt;1\025\200\202\035y}\351N\277\307\325Z%5\355~\221S\363d\264\301U\353+0\027\311^\355qg\261\276F\366\310m\301\264\217\335\351\215mLK\017-\256o\300\374&\271\212\253f\340"
+	.ascii	"\230\337\235\362fw\312\263\331bS\224uq\312-\262V;4!\222\261\265"
+	.ascii	"\272S\0245M\214\001\251\270>\335\024\245\2718%V\027\021\032\220"
+	.ascii	"\t\201\201\371\257\227\006cK\026\203-\244\355_$:2\377\372p\235"
+	.ascii	"\023\377\322\360_\353\337\375\317?\327\376e\340\337\007\376u"
+	.ascii	"\340_\031\377*\360o\214\177\033\370\027\202\n\376\035\340\337"
+	.ascii	"\236\177\023X\n\376\337~6\372w\202\177#\370\227\377W\371O\366"
+	.ascii	"?\371\177\354\277\330\177\344\177\260\377P\376\007\361\337\311"
+	.ascii	"\177\254\377K\376w\375\347\372\277\365\337\352?\316\177)\377"
+	.ascii	"g\316\316\316\316\376\025\363s\216\377\204\222Wm\325%\206\261"
+	.ascii	"\373\267]n\304t\377nv]\354\272\250UOQ\\e=m\311|\331\246(m\026"
+	.ascii	"\247\\,=\3372\234rX\274\341(-)R\270\326\360\230*U\210X ^\264"
+	.ascii	"\220\226 #\343\262A\215Vn@I&\253\312\034H,@\260\306\306V\314"
+	.ascii	"\354n\364\326\300\260\033\244l\306$2!A\246LY1\t\222\360(3\227"
+	.ascii	"\350\bSc\303\276b5\354\310X\222\253\016$2\254\205\033KT6A\206"
+	.ascii	"dI\202\353\371\027%\312\202\331\310\300\330\236\302\236t\341"
+	.ascii	"\272`\373U\303\005\013i\204\353~\361JY#\276_[\004M0\335\257\332"
+	.ascii	"\375\333ua\263\353\242&D\220_\222\262~\305\230\347\262Y%X\016"
+	.ascii	"1`\250@\201\262Y\033\\\340\204IY\017\233\034\360\215\022\304"
+	.ascii	"q\203X&;4\263\252\264\312zX<\200\366\263\002\305,\211\371\005"
+	.ascii	"b\233|\275\216\353\265N\266\330\264*Qn,}\351bq\347\346Ji\013"
+	.ascii	"\311\345\353\344W\200\201_\241\351\266\352\356\025\265)SB\270"
+	.ascii	"\270~e0\377\177\313n\027ji\017\2014\345\277\337\332\356\316_"
+	.ascii	"\263\2645\340\177\355\376OK\341\243\033\006\261-\346\016@\374"
+	.ascii	"\224\270\376o\321;\335\350PxtBQ\b\217\277\026b!\211(\204i7\251"
+	.ascii	"\350\243\217\026\246F\264\032Q\356\264\203N\304\016\032\321\235"
+	.ascii	"0\355a\247F\364\326A\342M\230\376P\341\321\211\270\302\243\221"
+	.ascii	"\210\242\203\215v\360\327d\006\215D\341\227\221x\023\036\177"
+	.ascii	"Da\320\211\270\235\032{\221x\222:\241G}\374\325t7R*\205\322t"
+	.ascii	"\007\\\305D\270\007\336\201y`\252=\362\024\3778\017\231\370\234"
+	.ascii	"\364{\204\247x\006~Z\344\217\n\254\226x\221\363\342fK\021%;n"
+	.ascii	"\025\206[Y\001\024n`\344JYw*\305:\354\221sxN\33290\020\216Zd"
+	.ascii	"1m\027f\226\224\215\025_\f\360\242&\213XR\251\214\022b\363Cj"
+	.ascii	"\203\026\256\034D\246\270C\n\013TP{d\034L.T^a\270\236\313\255"
+	.ascii	"\314\f\001\344\211\007\3635\312|u\252\301L\242\254\007\330\222"
+	.ascii	"\371Z4_\211&\033\271i\217:\354t\356\301L\257\375\322N\031\312"
+	.ascii	"l+\t\327W\241\371\325)igg\253S\276\002\315[\030\363\264.\346"
+	.ascii	"\3172\360\250\035\213\330\002\306<\270\310aF \001\271r\f\254"
+	.ascii	"c\217,xG\315\030\"c\302\\1\277,\312=[\026\345id\346mq\312\026"
+	.ascii	";\213S2\022\343\270\251jRCW\222\007@\216\350\342Z\371\006K\211"
+	.ascii	"\222Jj\301&)d\013\211\215Z\327\331\026\036\\Yh\036\321\276tN"
+	.ascii	"\364`2\203\022\327\263\360_,\\C\20533/\\\237\334\024%\263\320"
+	.ascii	"s>\232\001\203Rv\204+\r\r\313\374\022\331\275rF\257\360\257\""
+	.ascii	"I\211$p\r\227\016\220\251:\312\312\222\332t\3740\203\342\272"
+	.ascii	"f{\306\375\333"
+	.string	"lO\220\302\226|0\277cN\374\230\022\204\007\256\274\027\242\33406\031\253ap\213\312\3746\261`~\033\315\354\353\211\r\256\247I\231\337/\377m+Pi\"\302u\275\230G\264&\035\033\331\225\025(\256_/\3772\261Y\266K\t\255\202\221\224\212X\270\356\226\345\362\355\262Zhh<\334)D\343;A8a\264#\232\341s\0320\202v<A;\234\037]Q\006\276\2637\243;\201k=\037\032\237\217.hW\323\005\355h4|A\272S\250\364\371\310\3509U\310\365j\257w\362\200\200p2F;\242\237\352\363q@\206\347\333\321^c\304\363\365rA\347\007>\272\240\234\020N\006\350\354\025U\035Q\316\367s\366d\216\363\341\200x>A;\0306<\034\215\237\352s\372pB\273\2413\004\337\331;?\b\332\2618\177pB\273\363\003\036\356\024\232\001\200\357\004\341\326\313]\240\342\364\341r@\347\320\020\007\002"
+	.ascii	"\235\274\"\034!\"\"\013|j\030\364n(\364p\035\234C9\237\256\210"
+	.ascii	"\007\300\320\351\353\031\201\020\300\177|9\035\0073\377\311\361"
+	.ascii	"N\335\031d>\206\f\004d8\220\202\214\3574V\234hw\362x|DD<\236"
+	.ascii	"\231\236\317\214\033\237\217\002\013\370t\271\"\363==3Z\210\340"
+	.ascii	"\201\006\346\017\214\023x\202r'\350\210~xt9\334\020\317\017\257"
+	.ascii	"\307\003\203\200\336\311+\362\341\316\f\200N!\023p\272\363\346"
+	.ascii	"J\2240\226\211"
+	.string	"v\323\272\231\310\244j@\276\342+\306\332\036v\027#\2502\242\254\213\303\235\237\217g\254\333\306t\2453p\345$\233\265B\033\214\350v\215 \006\005\346\013\222eR[\370!i\007\247?\032\020fMp\261\0216\262L\352\255\203OT\232\334\354\370\201\210#\t\016\236s\354\221\203l\225\203$Em\250\264\030G\222I\f\327\"iP\346\247\304\030\021Q\314\257\025\f,\203\221*/(Q\241\201m\030r\304Z\375=K\314\303\212l\201\237]\230\342\0338\207E\026o\035d\362\245\214\231\376\036\236b\037\\\\d1\202\252\344\220\201\025\250\241@f\0204#2\"\"\222$I:1\005\204(\t)4\017\021\200\241\243hH\222\024\024T\262\034\201/0\226\310\004dIO\250\374I\201\306\363\003\tN\313\224z#]\330\200f\275\207\301C\200\254~\332\035\204\336SE\031\334\006\3014F/W)\017\314\227#{\374"
+	.ascii	"\364\245\272n\2505\314&\362\240\337\260\365\016M\363O^#\335\236"
+	.ascii	"\356gB\353\210\324\3168\027jZ\321>\364\337d+a\241\201:W\nQ\354"
+	.ascii	"\004z;\346\366\334l\332!\227\\\001w\374\354l&xQv\016\240\316"
+	.ascii	"\275\230\366\222\t\376d\234\336\260\336\276x\321,\030\302dZ\312"
+	.ascii	"\276\325\311\2440\n\304\302\316X\2431w\257\374"
+	.string	"\324\034\024b\276\333\007\213\023\b#\304\350t\004\b\254\003\003\300b9\244\325\271\006\374cbvP\211\036\222\362\240\247\201m\346`K\260\205\244\240q\243\203\251<\330`\263Hxr\003D\362\006\020G2\212\326\210\203\254qd\002\343\253[\306\337*\373D\242\241'\211R|5\003\312\206t:\257\347~S\212OM\330t7\365\233\257\013\217\336("
+	.string	"\347~\236\374;\206\t5\334\315a]\221\003\321\342\346?\207\257E{\252\346\300\026\336t\332\313\032\261\037\215\372\226\230\367\367\256\325\302o\3719xW\351\251\024\001\027\260\352"
+	.string	"(\3660wj\326\336\245\215\266\336\315\205\324yfrs\002\322\311\3325^\257!J0\030\335\231"
+	.string	"\262]\257\373NF\315\245\304\3121\005O\302\274L\032\026P\203j\022b\203\277\243\023\005\206\255\375<\021N\034\255\2568\373K\333\261S\225\360\177\245\377\375'\220t\346\270\036\315\306\373s\320\340\260!P\304\b\314\001\333\316\256x\262\336\204\362\024\263N(7\344\003\031\270\322F\203\037\b$\361\225\304\246\315\376q\377\376\202\334\2535E\023=\355Y\203\337\225\371L\311\204{,\f"
+	.ascii	"\237b\302n\246\375[\312\231X~\264\361\263\322\017\375\202\206"
+	.ascii	"\220\247\177\353^\213\213\365\236\001\251K\325\205\256\363\030"
+	.ascii	"\311\273pU"
+	.text
+	.section	.gnu.lto_.symtab.52657b129e03c5d9,"e",@progbits
+	.string	"featureInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322"
+	.string	""
+	.string	""
+	.string	"featureConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324"
+	.string	""
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336"
+	.string	""
+	.string	""
+	.string	"featureIsConfigured"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340"
+	.string	""
+	.string	""
+	.string	"featureEnableImmediate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344"
+	.string	""
+	.string	""
+	.string	"featureDisableImmediate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346"
+	.string	""
+	.string	""
+	.string	"featureConfigSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350"
+	.string	""
+	.string	""
+	.string	"featureConfigClear"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352"
+	.string	""
+	.string	""
+	.string	"featureConfigReplace"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354"
+	.string	""
+	.string	""
+	.string	"pgResetTemplate_featureConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\001"
+	.string	""
+	.string	"featureConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\001"
+	.string	""
+	.string	"featureConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.52657b129e03c5d9,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,614 @@
+	.file	"accgyro_fake.c"
+	.section	.gnu.lto_.profile.4af8215f9bb69ecd,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.4af8215f9bb69ecd,"e",@progbits
+	.string	"(\265/\375 \367M\005"
+	.string	"T\b\353"
+	.string	"\017"
+	.string	"\303\330\323\265\002"
+	.string	"\001\265\350\245\343\b\020\002"
+	.string	"\002\001\002\002\003\002\002\240\342\234\212\n\003\314\312\327\352\004\004\004\004\004\005\354\311\261\324\006"
+	.string	"\006\215\317\357\334\003\002\002\005\002\005\007\b\270\224\340\361\f"
+	.string	"\t\006\002\006\n\013\226\355\335\266\n\b\003"
+	.string	"\002\001\f\341\341\203\273\007\b\002\007\002\001\002\b\002\001\002\t\002\001\002\n\002\001\r\364\367\210\206\b\004\016\213\243\277\372\017\006\002\013\002\004\002\f\002\004\002\r\002\004"
+	.string	"\017"
+	.ascii	"\210\n\037\356-\2304\240\021\340\370\235\022\300m \013\310\007"
+	.ascii	"&vw\241j\321J\352\273\0336\320\006"
+	.text
+	.section	.gnu.lto_.ipa_sra.4af8215f9bb69ecd,"e",@progbits
+	.string	"(\265/\375 \307\205\002"
+	.string	"4\002\273"
+	.string	"\013"
+	.string	"\002"
+	.string	"\b"
+	.string	"\007\003\001\001\001\003\005"
+	.string	"\001"
+	.string	"\001\006\002\b\t\013\004\f\r\016\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\023"
+	.string	"I\t\001\354\326p\"G@Q\004\356\274"
+	.string	"w2\215qf\240\231e\355Tk\361$"
+	.ascii	"\354\245pV\031\2533\306.\230\r`\001"
+	.text
+	.section	.gnu.lto_.inline.4af8215f9bb69ecd,"e",@progbits
+	.string	"(\265/\375`P\001}\006"
+	.string	"\022\211\036)\200EI\007C\\\005\fx\260\200\001!\252`)\207\n\001W\030V\241\3375\0274\t\232"
+	.ascii	"\nk\r\221\366\377\326\310\336;\005;\257\310\304\312\260 \351"
+	.ascii	"\371\206\013\377\244l\341\333\240j\313f\313!\334G\023\264\376"
+	.ascii	"\237\226H\271D(v\363\213|\264efVF\023\303\004(\b\230\260\227"
+	.ascii	"P\200\222X\016\370\037\336\3671\222`\240\002A|\217\3157\332:"
+	.ascii	"\036\377\032\266m>\033\023\001! p\242RU\347\001\366,p\206.\030"
+	.ascii	"Y\2575\250\025o\036Y\3112\234\340E[\301\345\027[\2117EV`n\312"
+	.ascii	"\355\375\322aa\236e\306\212A\357\327mnb\367B\330\305\021\361"
+	.ascii	"\001\314\no</\261\314\210l3\241\325\205\2105\b\256c\024\305\r"
+	.text
+	.section	.gnu.lto_.jmpfuncs.4af8215f9bb69ecd,"e",@progbits
+	.string	"(\265/\375`\335"
+	.string	"\r\006"
+	.string	"\242\211!,\200\265I\00730\003+{b\234\031(3\003 q\021\t\017\376 \314\232\261\037\024\214\211TU|Y\324\030\253}[\311\222\336m'\031\323$)\332p\225s\224\0230U\002N\345\n"
+	.string	"\034\212@\242\\d\321l\022\361\001\023\370\306\367\302\1772+\234\206\023\036\341+\352#i\026\243\265\003OXv\366\206\330C\f\177|\020\365\221\232\265\343E\301vI\345\366a^=\257\333\266\341\370\224\277\301\216\355c\231B\332\r\002\027"
+	.string	";\317\200g:h\0170\f\b\332\240\025\214E@a\346\245c\212\n\334@\336*\\\006<\277B&\260\r4\3468C\360\336 \007\200#]\t\0078F\232\237\f"
+	.ascii	"\016"
+	.text
+	.section	.gnu.lto_.pureconst.4af8215f9bb69ecd,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\""
+	.string	""
+	.string	""
+	.string	"\013"
+	.ascii	"\200\004\001\232\004\003\232\004\005\230\005\006\230\004\b\230"
+	.ascii	"\005\t\230\004\013\232\004\f\232\004\r\232\004\016\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.4af8215f9bb69ecd,"e",@progbits
+	.string	"(\265/\375`\256"
+	.string	"-\006"
+	.string	"b\007\030!\220)\351\363\223\031\237\370n\336\377\353\273\273\273\233{F\337\200\377D\026\203\036\241\377\t\"\255\021)So4\312\216F\321\253\360\"|\274\366\361H\306\270\0052E\277\257\227\350\002\250pp\233\245<\260byb\030\311J\223\325\242\207\030\3249\375)\237N9\242J\tl\316\017\345O{\333\233\031\t0 \320\202\021\023\362\0014M\244\035\324d\227\2601D\201s"
+	.ascii	"B\367qq,4\bk!\305\355\2030A\004}\350\313\216\364.\324\260q\341"
+	.ascii	"\336\020\233\201F\323\241o\354\336\201\204\334\207\377\302>\b"
+	.ascii	".z\304\221\017;1\342\220\035\354\275\360\030\274\301\332\005"
+	.ascii	"\007{\326(t\230\275\256\034\366\255\201\256hj\b"
+	.text
+	.section	.gnu.lto_.lto.4af8215f9bb69ecd,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_fakeGyroInit.11.4af8215f9bb69ecd,"e",@progbits
+	.string	"(\265/\375`\330"
+	.string	"U\f"
+	.string	"v\027UC\020\221\223\0168\221\354tx\201B P\224~\020C\211\032\200\270\235\3576+\210\\n0\005\001\350\023\264\025s\006F\205\005\\\376\311\244\001"
+	.string	"\020A\245d7"
+	.string	"\332/\261"
+	.string	"D6\275\364\215T\262\267\224)\005A"
+	.string	">"
+	.string	"C"
+	.string	"\004\246Ckv\214w)\253\240E\211K\314\356V\n\342\332\237\246\346\277\345\232\310m\177T\207\353\363\224V\314\b\300\221\274\216I\210\370\226\347\006n$\023"
+	.string	"\203\335uF\216\303\ro\273\201\355\005\366\035\004\036Dr\306\356\266T\024\373ow\327J\262\317\362?Mg\246\257\231P\362\322\221\261k2Sc]@\026\"6\266\237\366G|E;\313\350\003vI*`v\273\217\023P\207\356\336\231\016\251\007\n\301\004\f\222\2241'\375\320t\265;<\3621\265\200\006\335\354\243\310\300\2116v\027\013\324\356\"8\361!2\360Be4\035^\365\344%\236<\365I\274\304\310W1\006\220|<\364A\246\303L\021\363a%X\026\302\361lm\\\035 \t\017\260,\204\303\262@\225(\273>BY\204\212B\b\344QY\231\250\332\360\030\253pe\325\005\f\313\252M\267\177\253$\177:\032%\021\035y\002\322\266\256|\264\352\366\024\231\022\214*\212\017<\003\024"
+	.string	"_\2417\023z\3051\260\n\203"
+	.ascii	"73\027\320\373\017\323\374\270\365xJ\212\t}\276`G\305\264Q\201"
+	.ascii	"\024\214\272\204\325\254F\207\273\034\263I\032\230\332\003"
+	.text
+	.section	.gnu.lto_fakeGyroSet.12.4af8215f9bb69ecd,"e",@progbits
+	.string	"(\265/\375`\005\002\315\020"
+	.string	"\206\235jH\340\262(\035\320\016\002\216`D\317\256\026\263\312\332\n5\327\030R6\244@)r\210W\304\320>8E\027\232m\304V\037c\210`\263\007\305\"1\033\342\030fX?\307\350\340\235o\361\310\301A\272\303Y\345\337,\367\330;\245P"
+	.string	"S"
+	.string	"V"
+	.string	"uWf\247\266\273%?\b\275\222\314O\3735\217\215\227\261\\\300\356L\254\266K\226\354 \364j\362\006\270\327\320\tp\257\036\355\333\201\017\243\033\210\030Ev\327\243)>~\216\376g\007\360zi\371\004\231\354\256\347\353\245\304Mo[\201\355\224=U\001k:cs\323\242\343\374\240\337\374\3656?\275\354\237\001(\234\030\362C\b\rB\356\210\037\237\365Qm\264\260}\177\306i(\317\361H&\006\006\305\356d\274Ly\216k\r\315\356v\257v\212\335\275\316\316\306aM\222uq\205\200ps3\241\344a\214\267a9=\224\332&\035\007\253\200\212\335m\340\337\270\016\352\003\347_ \367\372\331\007"
+	.string	"\261\305\304`FSD\3752u2\377r\002\027\332\342\227\257\261\232\266\327K\253^\013\021\330v\227\001\215\225\r>\013\026\356UD_\276d\205\r6+M\264\346\217M\272&Ea\177dw\003\306`Z\260r\225{\370\210?\023x\202\262p\nE\225\013\337\207\362V\"\330!%V\3602\244P*\357\023W\236\251\304\241\006P\3648\204\241\350ud\353\263G\200\221\350\341iQ\027M\302i\027\225>\"`<?q\366\204\3678\205F\245\0274D@t\347<vX\207{%\311\\\324\322u\344 \305\002/ \220\002\2319\263\003Y\334 \205\363==!\340\f#%\354t@$\236\272\235%\004\253\004\\\177\247\254\205"
+	.string	"F>5,\222\235\214\243\300\0015\343\232\265\034\261h\313\021G\260*\243\r\214\037\264\030\343$T\037\345?\241\007;F \304 \345\206c"
+	.ascii	"F\343x\307\206\035\230R\302\0070,!\004\314\030\274\"\355L\t<"
+	.ascii	"\274h;\031"
+	.text
+	.section	.gnu.lto_fakeGyroRead.13.4af8215f9bb69ecd,"e",@progbits
+	.string	"(\265/\375`\032\003\215\024"
+	.string	"f\243~I\300\224Q:d\2022\302\315\305c\211c7.\250\326=b!\203@\267\241\\\301\324\007H\016\256p\036\232m\315\337\266\r?\003@\333\363\025\324\236\376\304\247x\330.\230\206\376\r&\264L|(2\306\375;\f\354!\233H\231Rg"
+	.string	"d"
+	.string	"m"
+	.string	"V\265\237\373\020\317\211v\2562\247\320o\307\234c\213\033\250.=~%\274T]@xi\333\n^x\034\373\230\342'\300\314\247C\r\2519GqQ<v\t\256\306\374\236\313\027J>p\243r\004=!\335D|A\026\\S\210\325\215\006\256\364\202\216\274\350\372\3416S\005"
+	.string	"3\347\264\326n \356\360\266%\330n\331\013!H/\003\2779\347\202\0337\032\374\025;\341e\312^w\3451\355\236\220F\310t\312\036g\272'\354\203s\205\354P\235r\242_e\265\224jP\252W\252\257\362\002$\025E\340i\316\237\251&\323I\362\\\330\276o\343\272\034\033\214\034\373\250\200-\367\0317\322\371h\351\001\b\227\233s\256t\354\325\345\332<\366\312\016:jHd:\225\340L1\f|\245/\311\3303,}\215\025^\352>\260A\341\206x\337\235\207\362ca\373\341rId:\245<\224\364L\200G\255\037=B\017\337\022(\332\366\274E\r\347\264\216\205_\n4\214\320\224\211m\327\223b*\325\234\363\373\242k\t[\f\334\020\021\212\246\254\257\243\251\321\327|\200\266=\276\3568p\364\265\353l\363\306\340\202"
+	.ascii	"t\313\305U\303\2620\363\202\351\\h\265X\"\016\314\305\201\006"
+	.ascii	"VA\274\241a\331\210-\030\216\350\302\342W\006\027L\334\360z\301"
+	.ascii	"\304\325(;8W\310\241O\205n\007\276\350\016|$t\273\375\356r}l"
+	.ascii	"\3135\214lg\322\310\b\334\"D\336\273o\210\336K\341Io'cWH\220"
+	.ascii	"\2267\001\331=\351%-\341\351\376\210\031\360\363\204\373\220"
+	.ascii	"QmA\250Q<\347\234afFd\024\024\024D\031\016\200\002\231\271\253"
+	.ascii	"\007\021\320\251R3V\211\375\357\006S\n4\r}\377\243\366\275\317"
+	.ascii	"\033h\331\323(r\236Y\036&\312\371\316\241\017O3\231+\225\366"
+	.ascii	"\211\315\025%\250\315\334oT\227'\tR\352\017j\200-M\200j\3459"
+	.ascii	"\260\366\270=\357\260$^\256\330-\370\232!9\3217\320\002\030g"
+	.ascii	"{q\267\201R,\200\270\037VzMN/\362\327\266\354S\205\310\313fc"
+	.ascii	">\350Y/\002N\316;;TsO\232K\321w\324"
+	.text
+	.section	.gnu.lto_fakeGyroReadTemperature.14.4af8215f9bb69ecd,"e",@progbits
+	.string	"(\265/\375`2"
+	.string	"\r\b"
+	.string	"2\31777@s\322\001\033\262w\335\337\257f?\3568\355j)<m\341\260\002\210\2736\004\374U&\267HS\365\263\223K\026\302\345A$\016\217\036\355F\314\223q\263\204\220\275S\nR\223\021\223fh\222NQhj\001\225\261\317\274\220\025\023\031%Y`\230\214#:5@\224\"b\200d(bt\024?\t\316D\223F-\313ht\335W\013;\237\273\f8\240\311\256\245\007E\354W\273\273\206\235\375\032>R6\0055\273\247\234\233\235\261`Llo6\200mXI8\017\357\331O\271\312\366\225\215\013\354v2/\273U\301\016\236[\256'\270ny>p\335\262\355\005\206\315\334+\311\251c*\351hI\355\326\bG\316\375q\376Y~p\022\023B\343\202*\375u v\327\317\003\005r\303\333F\260-a\033%\f"
+	.string	"8\303\361\212\036\025Ql&FV\301\3235ob\002\007\205\34020\222"
+	.ascii	"\025\346uM2"
+	.text
+	.section	.gnu.lto_fakeGyroDetect.15.4af8215f9bb69ecd,"e",@progbits
+	.string	"(\265/\375`\324"
+	.string	"-\013"
+	.string	"\266\024NC m\225\016$<\n\202\214\223\205\020\312B\206i\316\314\203\017f'\314\255\233\210\353\220\251\302\237 \214u\271=\336!\307\252\333\b\222&\026\001!\236\274\351\3562\255\256-&\020\206\326\336\3455\313\215\310N)8"
+	.string	"7"
+	.string	"@"
+	.string	"\3433\266S\3121\266S\333\006\t\0219\374\230*}\202\206\007,rw\344\264\n\017?C\377\253[0\2340\021k\231F\237\223"
+	.string	"\273\353I2A\270\265\333\356\260=b_\023\263\264\307\321\324(\330\227\354\356ZC\331W\375s\202y\221)6b\273\245r\305\276\350\210\013\266Ev\305\366\234\3667\234\203\350\252\320/vQ+\021\273\343\2071\224S\007\244\203]\321bg\036\302.j\202\221d\347q\310\276\203\330\324S\311\351x\316\002\005\234T\220\016|4R\273\342Iv\202{X@\331]\021\277\003\003\220\205\314\302\251\037\332N\251\204\022\037b\255\bb`\005m$\366._\247\033\220\001+h\343y\035\367\251\237\002N\325p\0058\235\207\363\352\207\273x\0304\360U\016\001\bV\2562\356\355?\334\bd 1C!j\rl\327g/\330\256\001\224e\021"
+	.ascii	"_\241'3 \f\033\267\020\243\346\002 \037\270\031d\004\244\001"
+	.ascii	"2\006\005y*\221\257\31682A\3045\032\262C\304\3275\237"
+	.text
+	.section	.gnu.lto_fakeAccInit.18.4af8215f9bb69ecd,"e",@progbits
+	.string	"(\265/\375`\332"
+	.string	"e\f"
+	.string	"\246\227UB\020\221\232\0168\221\314\223\203"
+	.string	"\036"
+	.string	"\277\240\256\254\031c\\5l\217v\343\003R\214\333\f\354\361\210\337H\373&4\230W\037\221~OH"
+	.string	" B\021\266\222\n!\177\245 @"
+	.string	"Qd4jK\366\2262\245B"
+	.string	"?"
+	.string	"E"
+	.string	"\002\244Ckv\215s\242\335\220\220\361"
+	.string	"3\263\273\224\226\270\366\247\251\371\177yG\004m\177S\210\353\023\351`\334"
+	.string	"\001\251\274\220\217\211\370\227\347\007PJ\346\306\301\356:#\b\304\ro\373\201m\006\366!\004#P\262\306\346\266T\026\373ow\327\032\262\357\362?Mg\246\337\321\240\233\2611\300\305\356\247&\307\312\2001Nx\330~\332G\361\221v\027\317\003\354\206^\304\354r\b\274`:4\367\020\351pz*a\005\r\225\244\361G\372\034\351j\223\224\344c*\201\016\272\331o\301\341cF\264\261\303`\230vW\001\013\223N\001Q\213G:\274&X\221\211\"\236\372)\256\302\343\267X\303I>\036\372'\322\241\201Ohe\024\226U\251\255\221\213\244\242\020\001\3136T\260\254\212\352d\227\t'\233@Y\340T%\224\225u\250\021\021c\027\256\214\312\200a\031\345\301\355\337j\310o\324\341\350P4\345\001H\333\272\362\321\252\333E4]\214*\213\017<\003\024"
+	.ascii	"_\2417\023\232\3051\262\n\206\02073\027\320\373\017\323\034\270"
+	.ascii	"-<\227\306\354\213\276\025G\255\267Q\353\031`\271X\333\254\246"
+	.ascii	"\210\273\034\263I\032\230\332\003"
+	.text
+	.section	.gnu.lto_fakeAccSet.19.4af8215f9bb69ecd,"e",@progbits
+	.string	"(\265/\375`\f\002\265\020"
+	.string	"&\035iH\340\224(\035\250\332\201\211\313\036\226\\W\222\347\234\243B\360o\3111j\024\325\252\340Pz\326c\224\340\367\324\206\260(\322\361}\0344\302[!\t$f,BX\264\b4\370\314-\274\323"
+	.string	"a\334\314\b\252o\331b\357\224\002O"
+	.string	"R"
+	.string	"W"
+	.string	"\264\331\356\216\374"
+	.string	"\364:`~\332\217\361\231\3614-'\260+\003c\266K\216\354"
+	.string	"\364j\362\006\266W\320\013l\257\036\355!'[{\031\265\0203xv\267\243(>~\216\376c\017\240\212q\371\374D\330]OU\314\210\233\336v\002\333&\366D\005"
+	.string	"vwMe\354m:t\233\377s\330_\377\372\351i\376)@\264\202\2652A\204\002!\027\246\247\310\376\2507T\330\276_\3432\324o,r\261V(\233\243\3612\3457\246`\204{\265Sl\356ur\266\315\021\t0!\020(\371\232\361/\026\327\335\022\001\327A\2535=/(\265\275\3409XD\r|\034\317\361>p^\005n\257\217}\272`vX3+\222\031\242~i:\231W\031\001\b\352\342\227\3079\315 \252\227F\371,<\320\332]\0066V8\370\256\226\3555D_\276\244Ec\321\242$\221\232=6\3712\351\t\373\0016!)X\271\312?\374\373<\352\217\004\236x\030J\241\250\222\341\373\274\356$\202\036L\342\205N\203\311C\351>\361\324\221J\034n"
+	.string	"\305\256C\030\212\035G\246\036\373\004\034\262\246\223\242/\262\n\227=T\272\020\221B\347\245\315\266p\037%\020I}\301xv>t\307{\360\230w\316V\253\2431 \240\002\0319\273\001\261\270\360\031\"Bh>\302\224"
+	.string	"\324\200\230\370J;\317\tf\t\330\356\216\217\005\002\246C5l\242\035\215[\223\2720O\264\003\343\272%\311\020T1\030\353\321\210\206\n\342\030\3532T\215\022`\241\tw\2148\304"
+	.string	"\312\rb"
+	.ascii	"D\331\021\211\343\035\3155\230A\2207\314\200#I\343\302\304\340"
+	.ascii	"\025ig\n\274\313\213\226\222\001"
+	.text
+	.section	.gnu.lto_fakeAccRead.20.4af8215f9bb69ecd,"e",@progbits
+	.string	"(\265/\375`\031\003}\024"
+	.string	"\026\244\200I\300\322Q:@\260\0218\324\340\254i \326P7O\271\333*\333=\303\024\206j\321\214\370\212\350f\355\016\326\261|=\232=\2475\252!\323\372D\"\303\366u)\216\212\223\317sR\274\230\205\350L\300\216\022"
+	.string	"\031d\023)S\ni"
+	.string	"f"
+	.string	"o"
+	.string	"+\333\252\366\177\016d\363\240\232\223\314\351\303;\232Sw\342\006\342\245u/\t/\305\007\b/m;\201\002\033\307\256\303\351\204t\310\361`D5\247n\334\022\217]\202\2531\377\346\022\205R\017\270Q.\234v\360j<_\320\344\266d[\325f`ISO\217\013]sj8\252!)sN+\255\266s\207\267=\301v\213\275\020\002\264\357\fs\336\213"
+	.ascii	"n\316\271\200E\214\006?W\023^\216\354wW\237QO\006\017\204L\177"
+	.ascii	"\266\016G\227\204}p\256\217\035\252G\036\364\213VK\251\006\245"
+	.ascii	"z\245\372$\022\216\250~\034\370\315\251\363\253\232L"
+	.string	"\322w\302\366\375\025\337\315\330\230f\354\242\0016\250\253\370\020\315u\226<\271\333\317\234sEc\257.\327\266\261\003\372D\213\222\351\017\301\225T\3049'\003\037\351I+6\013KOc\205\227\272\017lU7 \337{\367\211\340r6\251\333\217\224L\177\nc\252i\004X\324z\321#\304 \232\3621\333\233\233\240\335\230\326\261\360\333B\304c\246Al\273\376\"&\212\271\313\357\205\256\"l9n@A\":\262\376\316\345EOs\201\331\336\370\273\267\220Q\2509\347\003\306\200b\240\325b\255[(\256\027\226\005\226\027\214\346B\253\305\032e`.\016.\260\nc\214\013\013fl\301dF\024\023\2772\270`\343\206\327\0136\256t\262\203s}\034>\345v=\360Bw\360\024b\327\333\367.\367\203m\271N\221-\216\034\032\002W\307\323\233\356\204C\357\244\360\022\004\262{\303\306\311\227j\354\002\330AJ\341\323\245\241\""
+	.string	"g\n\237\261\"\006> \220\002\031\301\243\007R\334\377L/JB\3573\020\3202\f\032m\311\\2\313s7\332\2203\356\260A\302\327Lx\214}K\233_\311\270\214\001\276\037b*\fO\013\221\272\365\240\001`\023c\"\257\354[\264mj\354l]\370\210/\036b\327Yj\031"
+	.ascii	"\023\2134_)\213\305\345,bQX\303\261\023V\007\215\351\332`\216"
+	.ascii	"Y\341O\264e\007.\"\037\342\200w{\316w\222\261-B\030\317\371\303"
+	.ascii	"\031*\316\215\223\236P\324\n("
+	.text
+	.section	.gnu.lto_fakeAccDetect.21.4af8215f9bb69ecd,"e",@progbits
+	.string	"(\265/\375`\223"
+	.string	"\025\n"
+	.string	"f\323G>\020\005+\035"
+	.string	"p/\265\200m\037\243\302\212\316\013\033\342\320\250"
+	.string	"\351S\033\200\n\335\005\235\216\020\306U\332\347\f\030t\331&I\030*\212"
+	.string	"P\270\364\234\340\210}"
+	.string	"\200\020\334\320\341Fd\247\0244"
+	.string	"2"
+	.string	":"
+	.string	"\265\363\202\357\325\266\031\032N6\177\302V\177\305Bh\272\335\023\364Hn\236\232\376Snp\0223\222\263\261P\247\001\021\273k\252b\265n\357\266\021lC\330?\b\273k\317e\177\366\323o\342\246\253Qh\331]\355\002\254Lu\211\331\276\355\223-`\233R\373(\227\235>3\235`\327%\273\355\236\013~\350\274\372\274\347{\036_\003U\033\030\335MH4:\215\224(\301\2514H\236\231\335\324U6\307W<:\273\353\340\253|\224\006`&\257\276\351{\255\255\027\226\234M$Ew\366\211\242\336\313>g\003\242\030z\026?\243(\264\240 \313\022H\024C\220T\216\035\241\262\002\304\b\205#P,I\340'\301d\306X\202\033$Y\202>\367\234\365\\\276\371]\340j"
+	.string	"hR\036\210}\320\347\f"
+	.ascii	"^\321\033[\024\204\305\2004A\003\251\301\305\240 O%\362\325\031"
+	.ascii	"G&\210\336e\342\353\232O"
+	.text
+	.section	.gnu.lto_fakeGyroInit.part.0.32.4af8215f9bb69ecd,"e",@progbits
+	.string	"(\265/\375`\251"
+	.string	"\255\n"
+	.string	"&\023F<\020%)\035"
+	.string	"#\020 \002\026\005\033\005D\327\202d@\020/|\017\300\242$\035rd\261\3557\2745\023\317\006\223 Q\004\001"
+	.string	"\244\bk\001\244\251\245*!\307~\266\306j7\331;\2452"
+	.string	"2"
+	.string	"7"
+	.string	"\266U)\026m\237\2170+\301s\"\373\331\335\356t\276\\\374\224\232\350?v\001Vk\3659\320R\271\024]\013\240\330]o+7\275\355\007\333\026\366E\001\207\335\376\214\312\2179d\3730\325\307\024\267ba8\265\224\366i^#~L\275`\327u\203\263;:\234:b;\365\370\003\320\351v\003\320i\350\3642\001tg62I\346|\331\336\244o\363a7\\f2\304)\310f2\241pj\213\240\344Y\006uf%s%\347\313S\273\266\323eO\331C\320\262\213\022"
+	.string	"\300\272\320\234\230N\250a\255 W\372\302\r\216\003O\036X+\0204\177#\260\344e\\\204\025\245\361}^g\252`\b\251bt\035$\217\243\373\252\251\033-8\364"
+	.string	"kw\n\303\332\311k;]\016\030"
+	.ascii	"/\301q\206\343\025\275\212\005\321X\201q\301hEi\236\301\001\242"
+	.ascii	"`\230+\234\253\tQ\027\325\347A`\342=\255\024\325N\347\2026]t"
+	.ascii	".0N\\\314;-M?\241\214\001"
+	.text
+	.section	.gnu.lto_fakeAccInit.part.0.33.4af8215f9bb69ecd,"e",@progbits
+	.string	"(\265/\375`\251"
+	.string	"\365\n"
+	.string	"\246\223IB \347(\035\220\b\026\023\310\366\224\2003K\360\344\264\246{\002\210\021\350j\207!\001\354\271\rj\214\206m]X\277ih\354\211 7L\220\204\205M\346\262)\234\003*Hh\260\240\220\206\262\331M\366N)4"
+	.string	"4"
+	.string	":"
+	.string	"\005l\237j\f\332\017\036\016XO"
+	.string	"\330\314+\302\356r\237R\300\301\313\230\201\376]WH\251P\227\013*\233\307\207g\236\217\335\265vs\317\333\336\260-b?\"\263\001\201\267n\337\300\311w\371c\373\255\323C\323\206\302\301\370t\214\366\017\034\001\370\320t\207\335\325\002\006\273\241\306\247;\264O\207\227\350|j\207\350|~>\037+W\016\201\305^$\214\224,\333Z\364\023\254\330\031\177\215\314\361\311\242\311xX|\332.\245\370\224\031\0248\210\305HT\224,\313\354\331\312\225-+ 4\344\354\322L\220\260"
+	.string	"\002\246\250_\255\336&\242\337\311Fi\267y\244\316\253 \023\224v\322\024\344\211\272\222\221\257\226L(\355\270Q\365ZB\225\204K\tu(\034\255#\016t\341O\305\253\034\351\373*\027\237\005\026"
+	.ascii	"^\321\263X\020\216\025\030\027\314V\224\3003<@\024\fs\205\203"
+	.ascii	"5!\352\242\372<\bL\274\247\225\242\332\351\\\320\246\313\316"
+	.ascii	"\005\200\223\027\363NK\323O(c"
+	.text
+	.section	.gnu.lto_.symbol_nodes.4af8215f9bb69ecd,"e",@progbits
+	.string	"(\265/\375`T\001\355\007"
+	.string	"$\013P\002"
+	.string	""
+	.string	""
+	.string	"\002\016\177\037\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\270\320\202\202\200\006\r\177 \005\t!\300\204\001"
+	.string	""
+	.string	"\003\002\024\177\"\005\020# \177$\271\220\202\202\200 \013\177%\n&\301"
+	.string	"\002!\177'\022\177(\021)\f\177*\272\220\202\017\177+\023\177,\025\177-\001\027\177.\377\037\001\220\316"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\220\200\001\026\177/\031\1770\030\1771\003\001\020D\003\001\017\340\236\212\256\001\001\244\001\003\001\017\241\341\365\321\002\001\244\007\003\003\003\003\005\021$\003\006\022d\003\006\005\320\360\372\250\001\001\242\001\003\b\t\t\b\013\020D\003\013\017\344\001\003\r\r"
+	.string	"$  \003\t\212\354(\002\0272\210\201\025\244\302\n\024\325\030d\340\315p\213\006*c\355\340\326.\240\363!\233{y\272\032=\360g\023"
+	.ascii	"\334\250\273\3063f\330:@\030<-\030\2501f\213\3160\312\006\200"
+	.ascii	"\362\247\203\016\252\023"
+	.text
+	.section	.gnu.lto_.refs.4af8215f9bb69ecd,"e",@progbits
+	.string	"(\265/\375 a\335\001"
+	.string	"\022\306\r\020\260%\351\f\303\260R\326ZB0idK\231R\252\311\211\004R\314\316\354\346\300\234R\313\005\001\246\320\216v\272\314\207\311>\026\266\214\222\3211n\026)\221\016\371\324A"
+	.text
+	.section	.gnu.lto_.decls.4af8215f9bb69ecd,"e",@progbits
+	.string	"(\265/\375`\305.=\307"
+	.string	":3uDY0JII\035\373\277\252;\2331\231]\3633\177\177\367\335\305\374\232\220\253\274\374\253\273\352? ]82"
+	.ascii	"\301\302\314\225\220\260\256\347\274\265k\b\0216\356T\253\305"
+	.ascii	";up<\032\244m\253\223\222\232\266M+Q\346\312\251v\202\n\232\264"
+	.ascii	"\025\022\262\276\316lU\332&R&\231\002\315\0035\004@\004Y\327"
+	.ascii	"-\314D\023\273\351\336{\353\203\\\351s\275\026\327uC\322`I\225"
+	.ascii	"i\214\224\017-\256;\235\257|\300\230<\326\003\33100vJjUQ\264"
+	.ascii	"\003\335\264\003\333\264\217\257\272\322\267\372\036\3765\336"
+	.ascii	"\206\323\264{\223Y}\324SI\320\323<\261\264w\267@\210x\253\347"
+	.ascii	"q\347b\226\355.r\221\232\262;\242\341\300!X\003-\n\245f\007R"
+	.ascii	"Q\375\024\226\321,\322\327\002\221 =\341\361Y\372R\017\345\355"
+	.ascii	"\336\333eJ\n\333\356\263\003\241\264\003\233\264\003eh\007:\265"
+	.ascii	"\003}\376I\006\254)\b\220=\034\031O\203z\301N_\232vN{v\242\335"
+	.ascii	"-#\321O\343g\374\213Y\037P\214\317\257\302#]\251\253\275\f\241"
+	.ascii	"O\273\277r Y\3460\242Y\004]M\365\274\245}zg\324?r\177\243\033"
+	.ascii	"\367\317\0334J\353B\243\322\352\235Q\337\305\027]\351\206w^\274"
+	.ascii	"\247\236g\016\375\201\275\357\006\365\376\375\335\r\252g%}\367"
+	.ascii	"\364jP\205hd^(\2015?{nj\317\340n\371\215\273\234Z\fG\324t\357"
+	.ascii	"\007\372\346\225~\320/\303n\233\273\315\007=\363\177b|\332\375"
+	.ascii	"\214\301!\265\324\227\267w\313\201\206\003\214X\036_\f5\277\217"
+	.ascii	"L\013\036A:\304"
+	.string	"\276'\252\035C\371\335\2777\032\002\205\227\374\260\n\332\261\217\336\335\273qY\366\204\260\350\321\335,m\231\0228&X\376L_\347\203i\177,\355\277C\373\313\3204/\244\351r\f&6\242>\373/\265_+\272F\356B\271R\001\334(x\351\265\267`\374\260\374\370\350\264_\001\250\367\357\n@\365{\246?\\\r\352}\223q\213Z+\363\322\267\311ur\245\327\315\375\262\3356\317^\320\375\265w\013\203\2311\230\030\251Qen\215\352\327JOp5\250\371\316\250Jhn\325O\264\352\263_&\215\344Jo\222{\346\271\365\f\334m\222\\\264\273\206\273\234{;Q\201h\002\013\302\222\267\367\246\341pi\260\3658\311k\356\267\354\032\271jB3)FV\237\375\252\271\337\264K\346F\036\272\267\317\336;\202wr\267\224\367\371\345\313\306\357\221\031\325\211\324n\031l\266\006\324\367\331Yh\277\321N\202~\350\325\240V"
+	.string	"u\273\032\324K\344\202]\251\005W\314\357\327\365r \263\335\355\336\255\314\353\330\"\025\362\331'\240\335=\314Q\300m\021\276A\373\265@\305\177\177\327\002\325\265\376;\243^\263;\243^\270\032T\367\333u\267n\0247\207\240;l\357\026CPk\315)\354\363\215\376\rr[\277\321\313\345 D\370\213\317\336\332\273\275\321\2747\363^\nb\356\245"
+	.ascii	"\250\306\203)D\315\355\325\240\352;\243j\340\273\371\021\272"
+	.ascii	"g\025\356\367\212\373\375\361q\277t=\3567K\214{fr\277S.\300\253"
+	.ascii	"\262\267I\300\273\240\312\036\323\3757\237\222\373/\340\003U"
+	.ascii	"\370\224\356\327\353=\340~\265:\340~\177`y\200\301=\027\r \273"
+	.ascii	"g\006\270\337,\247q\b\3343\007w\3531\200\302\237\340\376&\370"
+	.ascii	"\214{n\341\376 \224\356\277\201*\367\013\345#\270?\322/\270g"
+	.ascii	"\242\373\037\335\177u\377\f\270?\b\356_\001\367\367\300\3759"
+	.ascii	"p\377\006\270\277\002\334_\003\367\027\341\3766\356\237\201\373"
+	.ascii	"_\340\376\034\334\277\002\367/\200\373\017\300\375\276\271_("
+	.ascii	"\356^\001\367kt\277I\367\313\001\367\273\347~g\334=\210\373\025"
+	.ascii	"s\277\027\334_\203\373cp\177\355\376\252\373\007\335/\353\376"
+	.ascii	"\330\375\337\375\257\273S\300\375\335\375\376\271_?\367\273\305"
+	.ascii	"\375\366\271_>\367[\304\375\222\271\3371wo\335\035\204\273\263"
+	.ascii	"\271\373\313\337\337\337\237;\006\342\036\234\342^\301Le~\244"
+	.ascii	"\224$\257\310\206\340\325\331\n70\231\343\261\177\303\232\021"
+	.ascii	"\3453\026\333\200\332\223\264\317\356\342\324~\311b<\215\020"
+	.ascii	"Ww\310s\351\252=/\270ZN\231Z+y\227\357\352\255\255\256\353\252"
+	.ascii	"*O\351Wp#?]\027X\335I\231r\251\2009\025\231\212\270\273Q\334"
+	.ascii	"N\005\2118I\247vU.\354\236\270\261\251\275\333\0368\fc\341*\034"
+	.ascii	"\004{\341/\334b\"\270\013sa*<\004Oa X\013K\361\017\f\206\205"
+	.ascii	"`)\354\003o\341+\234\205\255\256\024G\177\316\361\016\314\343"
+	.ascii	"\306=\271s!\260\212\340\350\305\273\321\353\206\264\227w\025"
+	.ascii	"`-\267\344\276JQ\334\216!\034\375\027\177\204[3\017\234\264\262"
+	.ascii	"h\371>\247\013\254p\364\232\335%\373E\005Z?\364D\377\304\255"
+	.ascii	"\231\016r\332z2},$\200\234B\027q:\2460p\364\223\256\032\356r"
+	.ascii	"v\020\207\025\375?\254#\204\325r\213\311\205\273na\233i\364\001"
+	.ascii	"\353\356\252*/\372j\037\327\244\201\325\331U\325\025\022\305"
+	.ascii	"Qw\354\272=m\346\222\204\026\323UU\036\031\216\336+WK\\\364Z"
+	.ascii	"\211\336\276O\001w9\205.\204pM\037\3528\372N\237\266\215*\260"
+	.ascii	"z\273\252\312\213Y\023\332\2431\"\273\205%\032\246MrgT\f\265"
+	.ascii	"A\246\006\016\246\334g\267 \2467\016\302\355T\007=.\2467p\016"
+	.ascii	"\214\343J\361\223\373<\341&N\"\001\344\264@\017\321\364\t\333"
+	.ascii	"\3606\tz\232\233\311\364\201J\257G\223L\344I\311\n:\273\205\""
+	.ascii	"\3557\356h\303u{z@\217\2616\031XS\234\204\205\360\013\tz\232"
+	.ascii	"\023HB6\215\341j1\302\275\233\302\246\266\220\262\246d*\324\230"
+	.ascii	"m\341$<\303\325b|.l\237( S\307I\030\306\206\030f\273\235j\216"
+	.ascii	"\034QyM\270\006V\302Lx\005\f\305Nx\351Jq\022\246\301\201\006"
+	.ascii	"HdH\036_\206\354B1\355B!\332\205Z\332\205>\264\013\241\264\013"
+	.ascii	"\235\264\013ih\027>\215\310\226U\340\212>\273p\343\"\354\274"
+	.ascii	"R\374\304-R\300D5\352\246\360\023\273\300D\031\352\244\334H\302"
+	.ascii	"etW\206D\211\360\220\213\037\227\222\037\036\302-b\202H\r\325"
+	.ascii	"\370\354\032\207v\r\325\256eh\327F\332q\220\373oy?\f\244\001"
+	.ascii	"\240T\210-\3503\366\301?\216\201p\317\306@!\240{31\220L\337\336"
+	.ascii	"L\231{)\270\227\202\234\345$%\246f\327D\032/m\0343\177\236\206"
+	.ascii	"\214>[\240\201\264\353\245\376\232;\243\356=\237\336\321\312"
+	.ascii	"\216\211nO\017CM\245L\345\371\353-\351\306\242<\321\023\334\031"
+	.ascii	"\325\312_\301\023Z\301\220R)\263\202'\204\262U\226\345\316\037"
+	.ascii	"\017cY\272\301c\312\215\"\3010\002\366vT\252\370\254\230\361"
+	.ascii	"\320uO\305G\317\253\t\235?\225\033\275ZvqZ>\177\224\237\242\247"
+	.ascii	"\212\226?S\244\310$a\363\233\361Y\312\317\251YUz\234N\332\261"
+	.ascii	"<\024\341\235\234\223'(O\033TeZ\237=\bC\177\2703\252\022\032"
+	.ascii	"\f\346\203\365\371\355J\037\356\327\302\340\036\311\273I\315"
+	.ascii	"\264\\\311{\331Bzg\331\315\311u\341b\332\374\374M\204mG0\224"
+	.ascii	"@i\273\322g\342v/{KP\303\344\303\350\263cy\266\307!We\357\331"
+	.ascii	"\374\22787\230\214\317J\202vO8\2574\235\344\327\230\230O\236"
+	.ascii	"g\332\325\250v5\353\310\323q\251@$J\233\375\331\225>\332C\371"
+	.ascii	"3}\223\323\240\375\215\317\021"
+	.ascii	"\2242E{\035_v\335\220.l\037\273-S\016\034.\2215?<5G\177\214\312"
+	.ascii	"\324\336\273\310\223\275\221+\3752\377\262\337\361V1K\f{\337"
+	.ascii	"\350\233*\373\037\317e\244V\331vG\0346p\340\3402dCi\251\263\364"
+	.ascii	"\305\256\364\307>L\310\203]7\244v\033\305\214A\355"
+	.string	"\216\362\306\276}/\tz\232\037\244\321M\365\021\250\264\034jv\265\t\314\237\b\214\220\021\037Q\276~\210\005\030Hni1\364\227_\027T?lD\332\257\324\353\276\313\355\262\216\266\030\\\237]mjW\227\332\201[\270\376\352\003\033`\240\334\r\241;R\344\364c\206\246=\206\313\314,C\251\335\311\0301\223\210II\245\271\214&\372\3246\372h\b\025\361\\\246\266P\3023\373\234\311\362\023L\225\"\030L>\3471\261\032``\271\t\202+*)&vX0t\333\346!z\337\"oHH5_\346w5\343\313\363\0202\346\222\253\317YHNr)\222\203\"\3659{\375\023\177\301`\242\3649w\375\263\313\211\f\255\177N]\331\261\374\3541BA\202\340>\325)\004\212c\002\\sJ\362\302\357*k]\345\255- \016$g\335\355\334[\353\016\313sV^F\035Y\203\301\323\016\343\304J\232\2550\031n~"
+	.string	"d\311t;\223  \306kNJ\334\221\250\334#*\373P\367\276-\264\310\351X<\373"
+	.string	"\302UE\211}\226\222\312Tz\271wPG\327\224g*\013HDD\270\210h\207\351\261c\307\037\325\354m4\201V\327\215\03372\324\331[\016\317P\337\342\305\276\222\237\274\210\374\256\344\247\214\343\316M\365\236\366\250\260\311i\315\320\356\271\306\225\346\032\177\364\355^Zh\361tn\0048\214\013(47Y\231\200\212\312Y\223\233\b@\026\243INz\321\316\200Yj\317*d$\3172\334]F^\272\037\254\272\240\264\345m\244\243\232\274T6\344I\320\347<#'e\275\272*\266\234\224i\340\260\366\254\211\305\360[\025\r$\237\203\370U\3676\002\266\333\331\363\342\027xo\215;\314\305\267"
+	.ascii	"\276\335\235\304\212v\367\020\271rE\3730\302\244\361\023\354"
+	.ascii	"\232\275\227\316\346W\323\022C\363\213\271\233C\334\236\030\232"
+	.ascii	"\355f\212`\177\325\330\315\026\272\314\320\345\357v\3734=\267"
+	.ascii	"\017t\311\323l\267s\267\320\345\205\355\363\274\320l\231\313"
+	.ascii	"\346W\323\3636\277\240O\f\333g/\267\017\223I\373@\237\3156\350"
+	.ascii	"\363B\363\213\371l\3724=\357n\241\373\276\035i\233\226@\373\213"
+	.ascii	"\t\263\367\036j\247\226/{3\235{\t\367D\273iJ\264\227\366u\303"
+	.ascii	"jkl\232\275\3672l\316\t*l{\266[\263\n\212\003\264\367\334&\n"
+	.ascii	"\261\274\313\240\335\263\274{\003\265\316\275{\240\032@\202\336"
+	.ascii	"'A\316\r\263}\230C=N\320\027\240\036h\320\256b\272\317\346\227"
+	.ascii	"\023\324\346\214\310\327\324\356i\227wj\31759\365\327\262\335"
+	.ascii	"aV`\276t \r}\366\034\303=\377d\0309\bE\021i\363\363\005\362\302"
+	.ascii	"\306\363\021\314\323\216\037F>\003\300\350\251\026Y\253a\343"
+	.ascii	"sv\266_\327N\211OM\206\26616\315DW\232]\264\331\005\336y(f\331"
+	.ascii	"\356\247*\224\343El)(H\315\236\207\276\312\236\240\246\237s\n"
+	.ascii	"6\236[h\240\243F\326g\354Y(\007i\035\335\330\361\331s3\007\345"
+	.ascii	"-[\306\324\332-\341\031\237\025\214\317\371\307\3063\220\206"
+	.ascii	"\376\270r\372\034A\366\001\342\340\007\r\272\036\2677\243\203"
+	.ascii	"\363bb\271\240T\332\232\332\262.\006\216J\326\221\274\255\344"
+	.ascii	"\276\2608!\177\277\007L*z#\362\353\363!\265Dn\013YPM\311\223"
+	.ascii	"Q\237\363}\365\020r\362y\257G/\352\245\255.z\246\264v\371\306"
+	.ascii	"z\362\246Zp\024!S\246\352\230N5\\wG0PM\224\352\252*\257\016\317"
+	.ascii	"q=\311\352\034\360\274\252\002\222V\207\325\242u$\200\234\021"
+	.ascii	"p\242R\247\205\215\230a4\3462D\264\253\016/\271cB\352\246z\270"
+	.ascii	"\n\306\202\361\260\025\234\207\263`:l\207\3570\025\254\005_\301"
+	.ascii	"\323+\305u\230\315\261\024<\245\356\247\030\216\004\020\035F"
+	.ascii	"\342\216\223\324a%\177"
+	.string	"\264d\300\333U\025\220\030!IfQ\006\220\205H/?Z\016Cy\242y\310%\245M\261\034~\362qa{\016\3079~\242NY\256\355\3417'}1\316\244\330\260\033v\362E\252\204\310p\023\307N^\366\332\232\034a&1P\202\0309\302\244-\206\bn7\265a6a\226\271-Zh\332]\306\264\273|i73\323\322\356\022\245}\356jP\335\205I;F\273s\032\330\273\305\260\304\271\302g\0206\216\317T iLz3\264\347\341F\022V\260&J \356L`\005k\"\305\220\315\311\253\261\230\314)*Q\254k\f2\251\344\311\031\034\247C\00499J\243q\307\0304a\347\210\223\3341\006\215\312\025\002\230$+BL\222\025a\003\013.\031V\260&>tH\036\207<\035fJ\230\330\300\345\3059\214\020\201\023\213G\326\310\252\320\036b\004\006#H\260\b&\327c29\234I\022\331\343j\201H\334"
+	.string	"\002\017lT\225H\034j\"q\370\302\336\354\224x9\26299\305\024j\322q:\030\200H\034\312$e\326\240\343tH\022\225\307$\022\004re\301&\225:\030\214\312\035\342\272\006\217\254\321\204\235u\r\"\217,Ri\\W}c,\226\260\256*\322X\344A\256k\320\270SD\026s\330u\025&\327\013\030\334\260\307!\016\022\003\017\310d\021\205\007\245Q\005\006,\224\306b\016\006!F\254#H\260\360\300\336(s\210\306\242\207#R\351!\001I\026\2541gh<\262Icq\305I\362\254k\004+\330#\317\272\252Id1g]\325uU\217C\034bfQ(\"\327U-\201\270\223\223O$\213\306\242\006c\0077C\366\250\036\223 \020\215\312\016\206\311\241\211\233!\353\301\006\344\272\2025a\354"
+	.string	"\306q:\034\331\234\033\343\360\203\231\2441\305#W\"\033B\t\304!\212\234\234a\t\f\305$\0136'\221k\221G\204\024\254\211\365\004\b\"\270\260D\3430\2114\026ur\265\300\211l,\202`D\022\325\"\017\022#\327\022 N\270\224"
+	.ascii	"qB\250\022A\024\261\022\305\006\344J\201\233\013G6\211\034\352"
+	.ascii	"\250H${\274\271\031\006\331\025\303\034\255\\W\2607H%\n\215\\"
+	.ascii	"Ybq\005k\002\251D\341\302\256,\317\t# \225(\204,\317\tI\244\022"
+	.ascii	"E\020\251D\201\331\234!\021\t\3349\262\027\320\301\344\n\"\003"
+	.ascii	"\244r\247\270\202=\202\220\301\204a\b%LX\b\262Gerxdyt\330\244"
+	.ascii	"K\322q:(yt\3305\204\017\">\214P\362\350\314(sv\220\354\321\002"
+	.ascii	"r\205\200\025A\311\243\343\242&s\224H6\0046\003\273\016\327\343"
+	.ascii	"\016\322\310\"c\214*\2129\033\b\331\025\006\205\017$\340r\302"
+	.ascii	"\315\220\ra\230\034\336\b\217\310\024+\216\212\"\316\n\223\202"
+	.ascii	"'\347%\005O\316\212\002N\t 2Xq2 yv\216&\216\354MqE\321\204\222"
+	.ascii	"GG&\271\252\030\216\260S\f\252\030\216PL\262\340 i<\241\344\321"
+	.ascii	"\201I\256$\202D6\271s\004\301\204\235\234\024Gv\205\005\220\033"
+	.ascii	"\3305\206=\016M\2709\016?xI:N\007$Nr\250\343\301\270\243\243"
+	.ascii	"\263C\f\200\357\360\260G\017\311\235\235\243\007\027\235\213"
+	.ascii	"\\W\236\0243,\212\307\344\220\002\306\235br\230\3349\306$\327"
+	.ascii	"\0216IcQ"
+	.ascii	"\251\335\306\246\304"
+	.string	"\004$T\300\003M\354\300\2260L\261\022\211C\017\310#\273\242x\274\361`,\016u<\020\217H\017\035\016\200\302\007lr\030\002\233\303\2433\024a\347x\202\212\0139;;\020X\201\356\016\004\222\203i\223\326\320\200?P\372\212\224\037\023\320'\353\305\356\250\353\017\310\0042s\226\214&\032\270\201;g5\247\216\374m\371-\001\337\240\330\220l\311MG]?\356\3722\0250\007\022\325\346\313mC)|]\351\271\353e*\341ro9\255\251!Z\213\226Lu\235x\037\324d\260\262d\037R\031ONX2\036\f*iM\256\350\270\301\307\325\3639\212\347)Q2\036\215\336[XJS2Kn\220\375U\361\214\347\371\356\"Y\272\020\233f\273\214$II\037\215:\255\245\251\272\272L\205\371\306\205E\227\235m0\252\324b\323\3459\317R\214\202\244\252\264\f\323\233;\\\226\313-\366\356\371\320\366\314\355\215T\003"
+	.ascii	"\264<\2578\317r\236\237<\300\317+\353\245L\260p\t\311\\\361\265"
+	.ascii	"\200\362\331e\214\264\313\0205\361\354\244In\273^\273(\250B\016"
+	.ascii	"-G@dx\260IQ\332\323\216\3469\r-\2679\366\331KIA*,-Gy\273\211"
+	.ascii	"T\363X\264R \222\304s\233g6\020\"\\MFIW\013\032J\362\022w\241"
+	.ascii	"\005\0376\276\256\226h\307@{\305x>3\022\247\336\223\n\2225\231"
+	.ascii	"%\033.0\024PH\226\273\270\317j\036\203\341\250r\331<\213\362"
+	.ascii	"\02424#22\222$I\007\202\n\020\004\203i\234\327\226y\022@$9\215"
+	.ascii	"r\320!\232\021\021\221\024$\005\205R\333\001{\230\361g\276G\237"
+	.ascii	"\034E\245\263&\254sET\225\233\030<#\004\354P\213}\235(.z\352"
+	.ascii	"\tu\266M\031\257J\0323;\324V\362 \343\324G<\fl\355\364\315\345"
+	.ascii	"\b\351B'$F\214\356"
+	.string	"\201\325\273\276\t\250l\216_\2404\006\027\004\362+\177\013\203\313\256\222\026\214\002\037O\332\250\300\231\236\343\001,\305_\371\3170\264\257b0\246$ \253d\214JA\303\356\350*\001LW\244\303\263\025N\250\"\276\200\264\246\367q\260\365\243\303\034\245\312\241Y\246\332&r\004\255c\342\313F\342\264\247\016.P\"\201 \245\202\365BW\005\264\333bJ\030\375 \n\f\351\310\362/\016;\026m\317\255\212BV\366\367\036A\024W\366S\301\213/\320\245\3058\035\n\003\365\204Bd&\225\263}$xg\345!\320m\265b~`3\266\325\251\007\322\b\2224\362]\254\r\351=\221Q\247\032X\354\003\247g\237.*\320)\304\375Y\206\3104\021\365\350\2150\230]k\345\351l\253\332\310\020\3513\344C\212\247\t\001\022\274U\001\343$\254\306\233\025?\016\005\214\272^\235:\343/\224Xt\271\322>\231\327\335\237\235rc"
+	.string	"\345\327\377\247\236\3305\020\273*M\006i\217=\315dR9{9E\177.\024d\222\217\242"
+	.ascii	"3\3205-\334\364\362N\220\261\032\230\2278\352\234\300\263=\007"
+	.ascii	"\266*'\314\340{\370.\261\003\223\3607\231-\277S\350t\237VC~J"
+	.ascii	"\006}\246B\336g]\227\240T\343\255v\330\254s\022\354C\031PQ\035"
+	.ascii	"?\t>\023\247I\340\366\261]\354HH\373\242+ \275\235\244R\264+"
+	.ascii	"P\330\375\331(\371\3003-W\303p\312\270\365!&\340\340\327\222"
+	.ascii	"\026p\364\336\341\005V\211\320\033)\026\253N\354R$\217M\351\353"
+	.ascii	"\023\034\301\f\273\357T\025\375\252r8\275\363\333l\221\345\024"
+	.ascii	"sP+F\273\217\324VAp\224\341\177\326\023&\204V\017,j\035\205="
+	.ascii	"\226Qsi\343!\210\215\027\330_I\355\030U \246\360\331T\270\216"
+	.ascii	"\203\207\203\346\245f\353\317\252W\321\272\nL_\252\315\007\304"
+	.string	"\333\375\363\237h6\373\f\323\302\367\026\017\3072\203M3\263R\261\343\031\024p\246K-\362j\214\246\355M\201\250!\252x\341zc\347p\370\223\316w\222\236\325pH\016\210-m(\342\210\b\343\346\350\037\303[\340^\262a\243Ig\f\007\211\001\266W\005`\3425\214~=\322\204\222\004!/\243\203\305[\235g\352\317\022\254\312q\025\336f\235\317\277\316\206\177F\247,\325\356\376L\020\367\035wl%\025\356\370+na\312\245\241w\f\005\205\323\037ZE[\342\227\301+\246\302\345\240#\016\353\320\376\375s\2327IB\265\\\035\303\363\005s6\211\373\262{\271\253\275\346\335\013\236\255\2326t\352\205\371\356k\210\331\211\332kH~\212\020\224\256\356\321\273\247\347c\372\275_\n\033\367\003\247\212\312D\024D\334\342\214\021\343 \037\344\314\265jcY(0\204\270\305\215\262;\\\233\032\3141vi\024\355g/\356i"
+	.ascii	"4\230<\254\3276\352f\246\322{\253<\"[^\323\020:4E\306\245\363"
+	.ascii	"\264\004\310,X\b\b\317.\247\275}\274\242Q(H\215\177\001\364\037"
+	.ascii	"\337G?\003a\230\315\350\346*\f\255\037\364A\367\356Q\222a@\027"
+	.ascii	"\274\374\313\006\017\240\246\256H\007\033\\\352z\232u{\316\371"
+	.string	"D\241\306^B\017\362\023f\231e\330\365!\345|\255\177\223@P.\363%\207\002\273Q\020\201\370m\313\351\002'G\334\356\253J1\377Y\340\333\305\362\244`\026#\316;\314+\307\240?\253\245\241\300\371\253\357\310\332`\007$E\303\351\027\301Mo\334\352Av\245%\311\003\226\201\361jJCk\203=r0g\305h.\307\316\370\\\375\377\214{\351\232\f \204\342\316>\020\254S>\343\253\304C\240\030\2026\016\003Nfd\277B\300\255\351\004\033n\334\007J\361\2629\261/y\341\3544\237(\207\307\220\3553\027\237\332U%|\254/\273\254'\032\346;t\202\3467\022\330)!5\233s8\317\205\375\242\320\2602\201\325\246\271I\271\033\023\006f\261\345\347\022W\3003 \332\353\205:\321_\232\002\002d\317p\3348\ru'\310E\303\353U\271\t\301\363\217\r\231\322\243\311\235\260\340>\336\024\0077X\212\216\343"
+	.string	"\rC\356\t\310\354\324\364\006\004\017\036\301ur\265\276\231>\250,T\031\347G\354\f\367\332\330IxK\352[#\350t\210\216\233\271\205\251\324\255\256A4\215s \246o\256\332k(n\272\301*Q\252\251),\f\212\336k\301\253)\025\373(k\300U:i\031\005\357v\031l\260p\350\215\216\237\001'\242\2503\004H,jO\367\366-g9\223\022c{[\034\203"
+	.string	"C\263\344432\300\007R\347O8\304\200\372\250\341\016u-\013\025\3442E\311|\024\340n\032M_AL\326\027i\rY\"\320\264i,\250u&\034\021a\307\b\252\256\241p\236\234\232\207\364BeD\t\260\327\256\361\231[b\355\231\337\3175&4\221\030\3362\242\246\227\020b\341\200=\237\027\217\261\216\302\r\353*A)\025\315\316\352\004\252H\346\261y\020z'!)\245\232\375\205\344/P,\332\251\360\242\263(\272\377\343\322\305\331}sO\260;U\252\333\037\262\263\203\354\025\356\326\364\005i\211\022Vn"
+	.ascii	"\003\261\360/\335n\021P:Ny\333(\303N2\221s\367\331\0306\222\203"
+	.ascii	"\033\250\346\rC\023\n \340c\237\204\004\363\016rY\021\275q+\342"
+	.ascii	"t\332\340\366\223\017?_\240\347h\210B&t\240\241\250x\274\311"
+	.ascii	"\371G^2!b\251\034\321\243=\030\314\364\300\214\273\324\336\341"
+	.ascii	"6\234\245\254\223J\301\032\200p\025\216\203\320\332%K}MC\375"
+	.ascii	"\255\240tS"
+	.string	"\216\315\340#\273\216&\021\036f\206\244\004H\374;Ec%\335%\344t-,\341\213\035\023\221\374\304U\201\226,"
+	.string	"B.\006\003@\222o\251;\210U1\325K\027\330\324\031S\345:N\377\"\354\301\2504\226jy10\224\276\235-(\273"
+	.ascii	"\216\004#&BD\216\364\223;\r\323J%\243c\320r'\204\254\\G\305\t"
+	.ascii	"\003\324\336\301\246\373\237q\003+1`\315\367Z\037i,\352\256\344"
+	.ascii	">\362%\2316\334N\004\243b+\352K#\241\216\357\020\217\017\303"
+	.ascii	"&\313\204b\020=//\370\021\210\205\267V\225\263\330\245\217\030"
+	.ascii	"\253c\304H\277I\346\355\367*N\b\360\310\366\347W\206\271\307"
+	.ascii	"s\240\267\035\f.\200d\244n\342d`i\032\375*\250\323\202H\001h"
+	.ascii	"V\243\205\201\365\252\321\345nA^\354<\364\030\311\017}\345\327"
+	.ascii	"\233S{\205\237o\236\306\302<J0\314\314\261U6a\356\032_\2627\343"
+	.ascii	"7\343\001V\302x\343\226\255\320'\277-\036B\277\024\200\004\251"
+	.ascii	"\310\362\266v\303\252o\301ulE\322-\360\270\361\346{\204\333-"
+	.ascii	"\335\213P\266\354\374\363z\264\324b\361R\354\263\310\344\313"
+	.ascii	"\242\365\366\361\373\r\330d\300\377M\177Q\301\217\325At\207\227"
+	.ascii	"\203\207\261A\317\357\306\321X]\036\300\354\205\237\357\206\224"
+	.ascii	"Xp\351\261\032\233\370\233\222\026\253|\226\262\233\335|\274"
+	.ascii	"\207\017T\227\366\t\313'\270)\t\37334\2730uZ\001"
+	.text
+	.section	.gnu.lto_.symtab.4af8215f9bb69ecd,"e",@progbits
+	.string	"fakeGyroDev"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\002"
+	.string	""
+	.string	"fakeAccDev"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\002"
+	.string	""
+	.string	"fakeGyroSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\002"
+	.string	""
+	.string	"fakeGyroDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\002"
+	.string	""
+	.string	"fakeAccSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\002"
+	.string	""
+	.string	"fakeAccDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\002"
+	.string	""
+	.string	"pthread_mutex_unlock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\002"
+	.string	""
+	.string	"pthread_mutex_lock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\002"
+	.string	""
+	.string	"pthread_mutex_init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.4af8215f9bb69ecd,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
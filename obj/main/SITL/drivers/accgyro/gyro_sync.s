@@ -0,0 +1,289 @@
+	.file	"gyro_sync.c"
+	.section	.gnu.lto_.profile.4496b09420c795cc,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.4496b09420c795cc,"e",@progbits
+	.string	"(\265/\375 H\245\001"
+	.string	"t\002<"
+	.string	"\002"
+	.string	"\207\251\361\224\r\004\002"
+	.string	"\002\001\001\271\232\221\221\r\022\002\002\002\001\002\003\002\001\002\004\004\002\001\002\005\002\001"
+	.string	"\004"
+	.string	"\200\203+\271v6m"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.ipa_sra.4496b09420c795cc,"e",@progbits
+	.string	"(\265/\375 \034\265"
+	.string	""
+	.string	"p\020"
+	.string	"\002"
+	.string	"\001\003\001\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\002"
+	.string	"/al"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.inline.4496b09420c795cc,"e",@progbits
+	.string	"(\265/\375`\317"
+	.string	"\275\007"
+	.string	"RM'(\200K2\0343\016\234\300\fE\0033\0035K\342\234\200\007\264\031\034\266-\315\025\231\220\tyN\211x\221\266\267?!R\246\377\317A\213\036}\221- \006\304D\264\227\032\320bC\003\332\r\244i:\233\307\352\022Bm\007\346\252\262\036\201\315\016n\206\243\330\342\363\314\203\262-\244Egb\212\f\022STX\304\024\037\201\200\035U\2309I\321\231y\t\274hK\360\226\271\314\345`\262\327\021Fm\001\346\232\220\315\031a\333\246wh;\371\224\270g\252\274\206\224\370\314'aF[\365|\025\001( p\242\243j\035E\200\331\2008\312'\320\256,\347d\266\333\302"
+	.ascii	"d8r\371\233l\nA(@\3341p\f@]@\f\204\206\302-\366\222\030\333f"
+	.ascii	":\234\\\232\221W\202kA\006\227\374X\fm\2156\\\275\035\221qu\374"
+	.ascii	"\272\032@!\022\263\\\023Q\221\213\353\006"
+	.text
+	.section	.gnu.lto_.jmpfuncs.4496b09420c795cc,"e",@progbits
+	.string	"(\265/\375 \034\305"
+	.string	""
+	.string	"\220\020"
+	.string	"\002"
+	.string	"\001\001\003\177\002\001\001\001\001\003\177\002\001"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.4496b09420c795cc,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\232\004\001\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.4496b09420c795cc,"e",@progbits
+	.string	"(\265/\375 \200u\002"
+	.string	"d\003t"
+	.string	"\002"
+	.string	"\001\370\005"
+	.string	""
+	.string	""
+	.string	"\001\002\013"
+	.string	"\001\002\006"
+	.string	"\001"
+	.string	"\001"
+	.string	"\200\n\b\b"
+	.string	"\001\001P\002\002\n\t  "
+	.string	"\220\003\002\f\340\240\n\b\b\002\r\r\020\020"
+	.string	""
+	.string	""
+	.string	"\t"
+	.ascii	"I\215\362Y\027\334\001t\255\272\004\214\301TF\240\351\307\006"
+	.ascii	"\332"
+	.text
+	.section	.gnu.lto_.lto.4496b09420c795cc,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_gyroSyncCheckUpdate.10.4496b09420c795cc,"e",@progbits
+	.string	"(\265/\375`\347"
+	.string	"U\f"
+	.string	"\226\227TB q\223\016L\006\3341\"\242\007\"-c\355O\241\266e|"
+	.string	"\277B\376\251\364"
+	.string	"PI\027\205\037\021\264#\350\264\235\032\250\030\321\246\210\021\022"
+	.string	"\261;\331X:\357"
+	.string	"M\036Ix\374!\226\354-wJ\001@"
+	.string	"A"
+	.string	"A"
+	.string	"\220z\200\351\320\266\023(\350\030\033\220AI%<\233\214\335\031\365\303\261?u\230\257[\311D\313\37664\016\327\214V\362\n\354\356S\356>\032\211s\027\007\273kg\242m\270\341m?\260\335\300>\204?\374\274\235\235\177!\220\301P\301\242-\346j(\325\330\024\360D\210\317\337\356\370)\306\370\023{\353auE\207):ph\006\224s\366EG\351|$r"
+	.string	"\273 \022&v'\002wP\207\236\0270=$OC\333W2.T\304\213\023Q\f\267\273\231j\310\307\246\353\004\025R\211\243a\033\303G`\324\356v\370*\234\213\002q\350\213L\207\327\223X\234\240\214F\\\311\236\231\323\220\375\267\273k\005\331\037\005\034\215TK^\037\317\025G\025rm$DK^\037U\345\0217Rs\001DR\210! \036\025b%7\221\303\200-\013\032\0319\226%#f\356\337*\310\021<+\356\333\027\240\360\260\350\217MN?z\371\264\314h\031\321\024"
+	.string	"@E\261#\236\207\205\270[\220"
+	.ascii	"\263n+k`\005\021\006\017\221\313\022\210\213\237Cn\3540\327\354"
+	.ascii	"\231\205\355D\246%X%O5\003\225\304\241\356mm\321\003"
+	.text
+	.section	.gnu.lto_gyroSetSampleRate.11.4496b09420c795cc,"e",@progbits
+	.string	"(\265/\375` \004E\031"
+	.string	"\366\252\232I\260XQ:\300\213u,\2240D\033\2146R\021\357\251\375!\026=T\320i\037\030}1u\005:\345\036v\264&\207\003z\371\227\t\177C|f\3660Px\366C\237X~2\341\020y\360`so\020\372?!\233\354\275\223\f\203"
+	.string	"\177"
+	.string	"\211"
+	.string	"\335C@\244\356S\207\035\214\017\371\034\231\231\377\343E?l\3223\247\202\001\026\024\277`\367I\256~s\037\322\013\270\017\353\215\233O\241F\361\206\266R\223\017!\006\260f\233=Uq\240f\354FQd\255\200\361k\023\310XbAcCao\244\324\310\362\337\251\220-\210\206\247\301\270\025Y\277\027P\262R\263\261x=\221\262\001\271\270\253\356>\r\025/,\025Y\335\315\264f[qV\235\231w0s\006f{\0036\035T#\347\324\267F\240\272\235\240e\230\271\347D`\006\232\230?|\210l\354n\007G>!l\232p<\344\227\270\017_-\364"
+	.ascii	"\303\243\321'\346sF+\216\371\266\353\020\363\317\177|\357l\357"
+	.ascii	";WK\231V\312_=\260\201\023\245;\305\323\230f\n\227\350x\357\367"
+	.ascii	"\2352\377\360\205\374\307*\237I \354\276e\321Ux\317\264\235c"
+	.ascii	"\025iq\352>s\036r\204\221"
+	.string	"R\346\363\036\344\347g\211\007\b6e\247$\005\213|\306H\t*\224b#vIBt\3443F=F\245G9\"b\261.\341\240v\276\234\336\221\223\373\327\245\3654\204\\1A\3030\263\353O^#\255:A\300\360\226\334%&\254\270?\t\bQ\316V\3349\\f\2367\3410\241(\370\205F\237\370\300\337\211iF\311\274+\216\231\360\223h\310\350\372\206\304W\002`\205\324A]7\022~\222\324a\367!\323Z\003\305\320\335\b3o\031\273g\227\301\314\274\205\006+\022\024\\ Z\027\\\035<\364\2640\224e\253\306r\271S\372\214\220i a\261\021\257\262l\221\262\230K\004Ol\003\351\303\323\352!\313\230\214\3349\3000\017\256\030\t\002\006\213\221\252\263_\207\270\001\017\224\330Te\034\251\334\274\013Z\334sy\215\016\236\275\267\233\327V\241\0066P\022\316\233\367\301\035PF6\312\335\2744\267\313q\025\324"
+	.ascii	"s\330\001}\363\326*Ti\202\2740\321*\020\333\312\334:\026s\311"
+	.ascii	"\207\213\277.sy+\257\231\235RZ\250qD\247\024\"3%\"\"\232\202"
+	.ascii	"$9\220\"\"\253\362\0210I\345\030\315\024\230\226\003\264Al\002"
+	.ascii	"\223\004\320\253\216R\366<\231W|\246F\263N\302\322\3247\201\b"
+	.ascii	"\216\367\335)\251V\017\013\333\341T$t\337\253 \200 T\033\225"
+	.ascii	"\225j\034NC\266\204\375\b\344p\201\361\305\031\213O\207H!@\331"
+	.ascii	"\303u\232B\345u\345\266\033\237d\367\"\257\352T\253\376~\344"
+	.ascii	"Z-\223I:|\250\355\336\255\007e@\373\347\347F\030\346m;8#Nr\332"
+	.ascii	"\271\361\2415\212\341\341T\221\2606\022\365a\206\327\021\025"
+	.ascii	"\210\301q\310Y\212u\354/\203\257\212\330\312\013\217\217\034"
+	.ascii	"sF4\212Y\032*"
+	.text
+	.section	.gnu.lto_.symbol_nodes.4496b09420c795cc,"e",@progbits
+	.string	"(\265/\375 65\001"
+	.string	"\3602"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\n\177\016\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\013\177\017"
+	.string	"\002"
+	.ascii	"\200\206\313\3161"
+	.text
+	.section	.gnu.lto_.refs.4496b09420c795cc,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.4496b09420c795cc,"e",@progbits
+	.string	"(\265/\375`\302\033\365\201"
+	.ascii	"Z\325\250/S@\220J\352i\262[\003\340J\363*\306\232\200K\345\334"
+	.ascii	"\034\0261py\207\006\013\202qb`!\225}d\374\234\005\243Q\343\241"
+	.ascii	"\212o;\302\354\031\020.\274i\017\270g\016\345XjYk\352\211e@/"
+	.ascii	"N\224\332\27380kA\016K\016\240I\356\266eJ)\246\002\356\002\360"
+	.ascii	"\002\311 \350\331\270,\334\375E^\353\266P|\002\247\305Y\241\n"
+	.ascii	"3\344\317\345\023\371 m\3169\247\214\n\231\355\317\306\371\300"
+	.ascii	"\215\313\201\0337\205\033\007\205\033'\374\037<bWIb\250\301\307"
+	.ascii	"y\006\b"
+	.string	"\355Y\303\036\324\212\301}n\301\315<\251\340\277\3616\236\303\031\034\247\251?\237\205\247\362e\243}\013:b\233\225@\254\b\201\224a\027\271FC\373\354\302\335\364\037\364it\277\224\247\375\321sRT\302\244da\324\177\320\217z\031\276\024z\243\247\371\301t\354\201S\310\331\205P\177{s!\264O\033\330s\323\201\320\030A<3p\210\025\377\354\263\t\367\003\036\347\363\r3b'>\262\2329\277\323\027}\3710^8\346[\272\213\036\306\017\277i\207\330\346\343\216\017\"Vl\332rn\207\202\206t\234\264\275\231B\317'\362\2540\004\206\020\261g\372\302}}\270\371\333K1\tro\270]\032\270\257\260\215\273\36146nb\244i\243\346lZ3,`\262\254y3\354\306W\342~\030p?\020\334?\205\203\336\t\257\235S\\xd\271\341\366&\376 \306e\360%\001>\346\n\225\344/\035\267.\2677j\270\235"
+	.string	"\324\337\234"
+	.string	"\264\335\f\207p \324\277\3600\263\252\230%\261wq/\276t\246o\351S\t2+snu\356p\212\013\224\017(\217\177@\333_\300\0068\020z\372\017\212%\310\2174%\217\374\331n\205\333\227~\305\243\364\331\366\003\335EW\\\212W\271a\306\234\261\212\030]1\021\363\322\226s\016\032\362\033Z\230\274\234U\272\335\314\2418\232\356\214\214\324\326\237\355h\335N\305\313\032\312#s&\346\234\005x/h\254\332\376\344\240,j\237\362\203\032\251\332\314s\317\2528\301\371\263\203\270w\270S\340G:\020\232"
+	.ascii	"\222\351@\2507"
+	.string	"q1_zp'\355JW\322\270a\233\333\234[\236\027\022g\271\344\317F\201\333\307Z\3050\217h!\334\356\001\275oo\356\001m\214\337\177P?\363\037\264\307\201\302\272\335\313\277<y\213O\310<\226s\353\223\363\252\2025\366\247'\337\223x\333\236t\2606\032\321\034\210\371+\347\326\223g\316C\367\003v\334\017\300\241\r\031.A\317~\334\255\003\241\330\177\320n/\322\355K\272\235\211k\345\\w\271\272\375\253q\335\227H\267k\351v+\335\315\246\333\235t\367\230\356\356\320\335q\272;I\267C\351v\263n\177\322\355e\335N\326\335mw\367t\267\226\356\276oooo\335\255\325\215\352\272\201\332\004\272\234\257\306\264\276\250\2204\313X\370p\366u\253\256\215F\333!\366dbV\f\315\276U\267\206\320\316\260\315F\024\b\220\2544Ww\307\305qu\334\034\027y\261\256\225/o\325\2751\024\204k\302\244\355\r"
+	.string	"g\353\304p\353Z\334\272\030p\353\264p\353|\340\326!q\353\250p\353\242\244^x\006\214\2148X\3065\372\362\036\357\n*\\\250\0353h\335\343\215\272P"
+	.ascii	"\314@\246\307\3245[\243\201\311\027\324}\312q\003\303\341v\237"
+	.ascii	"\356\n;I\210<\355\370\263\361\016\334\030\007n<\205\033\313\300"
+	.ascii	"}at\177\234w\273N$\340\2261\264\300\370\363\022oS_\247\313\224"
+	.ascii	"\257\223\bd\316\303\353\304\003'\347!\217\373\001\356\007\234"
+	.ascii	"H\260\2108A\317\306*\340+,\352;l\372\361$\365\247\007\314\204"
+	.ascii	";\347\206\377\203\377\240n\376M\033\340\026\233\01657mn\220&"
+	.ascii	"\031\255\266\3766\3025\2621_\260\001\376\203\252y\032\322\350"
+	.ascii	"\266j,\315\220\251I\243\223\341\313\214\r\232\3764w\215U\217"
+	.ascii	"!e<IU\003\212\362\331\314\034y\243\346,\b\236\341\315\020\333"
+	.ascii	"(\351\262\326o\306\223\356\305\226V\303\237?\346\313`-\031\302"
+	.ascii	"\2462dx\256hq\263\361'\231W"
+	.string	"C\221\234a2\"q\257y\031th\304x\371!\303\221G\0213\257?;'\205C\370\017\212%\350\212\021\273\376\374\342\313\007\363U\306\300\274\225g.\317j\350\322\306!\307h\023\345dz\361\250\250f\361\317\357\242\333B\243\006\226\264-\276|.\315\306!\347\016\037t\030\221\372\263\327\274\356}\2109\343\346\265\364g1f\261\026\376\304\222c;\202Q\022\005_\371*:\206a\216f\270\321/\334(\327\224_\003c\241\211\020|\366Q|\371R>H\277\216\277\352 )\337\343\201\344\3104\245\274\2207s&UO&\262\305i\016\ry\223*ni\3203\371df\264r\316O\276\354\241\370\362\315\372\315\336\205\337\332\021\372\344\334\003\216\226\331\303\360`R\350\231\274\3466$44\224\363\304\003\207\020\237\313w\342\313'\373\261%/\346L\2526K\355\220!\327\334\332\310\276}%\035\230\212\031PYk\342)A\250"
+	.ascii	"A\317Fs\210\3657\321\211\001\305\310\030\3453\331P\203\212Ie"
+	.ascii	"\006V\266G\025i\322\242\002n_\366\f\037\326l\247\220-S`\1776"
+	.ascii	"\332\204\033\347\206\033\347\006\354\271\036\2113\307Ntak\346"
+	.ascii	"\234\277>\211/\037\354\275\300\234I%A\2263\315\035\"F\274\300"
+	.ascii	"\330\360\311E\024\343\362]\037C\326\321a\303\201v$\fn\034\027"
+	.ascii	"\3348,\330\310\037\361\345o\375\013\375;\236G\007\2659\227m}"
+	.ascii	"\326\027\351\300"
+	.string	"TDa\345\306\277\214F\374\326\017q\265\035a\233e\344\020\321Zs\013\032\032\312\355\220\022h\227\312\035k\243\024\257\223\373\345\310\r+_\270\373\273\321<4\346\234\245pm62qh\307\271\177\350\326\361\353\bt\367\231sw\203\b\266y\310\306\f\r\330\b\224\341\2157 w3s&^\t'\270:\022\257X(*\257\262\220\230%\3641\346+aQ\231\263O&\022\205'\220\331\247\250\314\307\334\004\346\350\271\275\022f\"2\373db\036\032P$^\035\213\312\341\321\247\250\274:f\345U\356\311\304\2411\0061\033}\262\362\nMV\"\217=E%\362XT^e\271W\f/*\2515fx\224q4Eb\216\202\252\032\032{\230\305\026\231\325r\3661\247lD \347*\244Qm\310\202\23711\243\230\312\206Ho\241\230\260\220\231\310,\036A\346|\204\t)g\021\302\226\231\2018S\270\243*?9\345<"
+	.ascii	"T\316B\317\314\234\2630\347\2343V\2659\333\350)jAA\345L\025\004"
+	.ascii	"\225\253\204Q\234r\376\2612g\307\242\022\013Y\024\245\211R+\303"
+	.ascii	"h\205\256\225\325\256\214X)\f\313Oj\260\326qF\2323\017\2308\205"
+	.ascii	"\354\013\n\001<\355\024\324\016\2635O\334\r\267$\013\222\341"
+	.ascii	"-\353K\366_\272l\214\371\363:1\001-\f\225?;\007\n\267\227M\375"
+	.ascii	"\r\021\\\316\344h\345h\307\006\270\204M\035\255\2326\177\303"
+	.ascii	"\365e\313\fa\\Vm8>GCi\nk`\013\r\2312nF\f\353Is\004\032O\336V"
+	.ascii	"+\327\004k\331d;\343j;\302\236\314\224F\246\225s\373\302\035"
+	.ascii	"\273]\367\310Mr\225\\\345mo\223\033v\301n\221\313\344j\335\030"
+	.ascii	"\256\327]^\030\256\330]r\211\\#\367\353r]$w\313\2277\371j}]\270"
+	.ascii	"C<-\214\253\211\350\372b4"
+	.ascii	"\342&=\215'\235I\225\205h\022\350\022~\211\37132\322\\x\272\311"
+	.ascii	"\237\3614n{\206\001\226\027\233\032\036\016V\003[7\351g\236%"
+	.ascii	"\317H\300K\370+t\377\323C\375\361\266g\030\006\326W\230\346\257"
+	.ascii	")\341d\324E\245\ti\326\270\311\257r\264\033f\274 \255+\371oW"
+	.ascii	"\210\210-\341\027\027\007\343\314\261<\224\n\321\205\206\313"
+	.ascii	"\252-\371h\237v%\301V\024.\2536%\311\233\345d\316\374\221\207"
+	.ascii	"\302\022^:\270\254\332\312n\322i\360\032\322\222\256&\351p^\205"
+	.ascii	"\033f\324E-\001k>\262o\362\261\236J\226J`\353\013\227U\333N\225"
+	.ascii	"\030nn\2208{\203\025\254\323^\361\037\364\006\021\342\331\341"
+	.ascii	"c(\346\317\336 \206\363\205q[\255\013\230\242\232=.\220\353\303"
+	.ascii	"\227\367G\023\177\334\342\255*\341d\364\200\t\252\371\343\362"
+	.ascii	"\350-\035\230\212y\250#D\2216/\\9\233\374\300\222\003\237\275"
+	.ascii	"\341\t\267\247\321\020r\346\217\t^ \333\322BW\363V\335\030wF"
+	.ascii	"\007\246\342\006W\312\232S\215\266\023\254\352\323\036Tvw\264"
+	.ascii	"$B\t<\025\311\004\317\367\002\204\237\346\365\200\252Oe\201["
+	.ascii	"\004\t\007H\224p\221\353\022\021\204\210 \004\332%\"(*\212\200"
+	.ascii	"D\021n\022E\227m$\020\n\360x;\036\226'\3155\022\b\226\027\004"
+	.ascii	"\262\253\321\232\272P\331\240\222\217/\370\343\245i\016\250\372"
+	.ascii	"N\370\245in\005\252k\320\227\246\370\310\327+!M\321\325\327["
+	.ascii	"Z\3234\347\373\365\326^\222\232\246:6\355q\340H\005\356\220V"
+	.ascii	"\007\210V\266\247\202(\350c\341\200\213\240\257\227\344\200\b"
+	.ascii	"\022)\211\022.\210\324"
+	.string	"\243`\022\317\327#\002\256A\"\bX\027\252/i\347\003\252\254\257\227\"\261Ki*@\013\025\270\224\246(\273\366\222\322\024MS\024\270C\342\235*\n\2755M\321\022x\277\244\023\005\333\363\365\200|\027\034\355T \nd?\340\371\202\027\354\330\335\211\243\235\212\201\320\232\266PO\370.\320i$\020@5\351\310\267\313\340\207\365\255\3705\345\251)J\340\355T$%\355L\370\364X\027\352\311\256io\t\204\025\352\211\024\305\007 \344\250<\337\216]}=\314\246\036\2408}\275\017|+\017\355-\255wMM\030\241\3101a\204B\207\362\214z7\250BhM98\352\001\252\354\272SB\327U\005\036\035\355rj\213]\022\016\246-\324\2435\250\002\257\251\312\353\265PO\254A\0259j\252.\275\ba\r\252\320\251K/\3305\250\"\267\006U\\5i\307[q?\240:\002\316\261\251\321\003k\360\327k\241\002?"
+	.string	"\340\204]\n\023'6\344T`\220\335\001\325%%\225\315a\033\tDpI)e@MS\204\030\021\202DpI\351'\230\364[U\340\2065\r@\005!\270\244\224\203\262I\301UM\241\002\240\246\273\024\370[}\352\272\343c\321K\242@\247\246:(d\240A\316\213\243\235\232b\307\356\216t\300uE\212\304\242\207\224\352\254XJ\342\260b))E\001\251\004\243\007R$"
+	.string	"\326\245\037\360\004P=\352\265\350\235\b.)\361\260)\213]\b\277^\216\305.\204\036\353\302\002\326\207\"\270\244\244\303\246%r<\225\375\001?8\341\227\264\002\250\266\360`\025R\323\035\025\270;\341\b\270\313\200\003\333H V$v\247D\344\373))\375x\003\364oI\005\022\261\277\037\220(G\311\3274]Z\361\343\242\007dw\034\370~=v\307\376\200;lJ\242\210\365\365\202\270\213\212L\030 B\007\030`\036\b\236\357\305\232\022\361x;\242\025\250\266\350\001\217\210|\275\235\022\021\017\270\022\201X"
+	.string	"\205\fTv\227BMZR\332\201\360\003\276`\321\223\364\373U\220\342\032\013\226\253\005}\242\303\317\334\234\331\310\322W\013\331\016\f9\232\344\2346\3347\312\225\322wJ\337)\327\n\3169;\220/I\316\3322\025\325\207\235\265\025\242$o\225\276V\n(\233\352r\321f\2646h\334\202\021\2502\3214\013\002\231B\310\320\310\f\315$I\007R\n\020\206#z\230\310\362\006\022`\0259\3112\310P\315H\222\224\244\260\307v\250G?/\327\255\350\210\313\221\374XM\202O\344\261\005\353,\252\214\025\360\330\f.n\201\275*0\213\252B\206dNm\350\217ZwL&yD\016qjw\0056\020\004\375\021\377Cg\005Z*\020\nf@"
+	.string	"\035\006\301\263\234\325\345\035\274\261\227R\202}\346\361\036\002Fo\365Y\001c\023\236\330b%\265\217\003\275!\2323\277J\316>\324\350s\260\320K[\2056\177\225\271\271$\t<-3\331"
+	.string	"\277\341\357aV\315W\266\370\317\267\036\207\302\254\230\310$\227\357\301\005\306\324]\237m\201\354\366\272_>D\361\255\251Uf\032\022n#Y\244X\210\375\310\322\032\334\003i\210\201\"h;8\207\265\034\217uu\\p(z\3473~uMG\334\032\3315'\337\020\022\177\235\263\206\310?\252'sz\227M\377\027\271\203#\240AJ\275\320\341\351)\371I\365\214;\347\013u:\324Q\355&E\265O\n\233\244#\213+\222\3439\250%\255Z\3238-\316;\372\316\314;\326\220\246\355\276]\225c\203\307y\200\214\303\366\007L\233`\237\201kW\360\3543\307\232\224\324\365\251D=P\362\3401:\003\"\314\210\367\t\3005\373Ik\320q\037c\210\243\212\023\007\355\n`&"
+	.ascii	"\274\313\3615\004\314?\305g\357\242\026\037\367\205\304Z\233"
+	.ascii	"\f\274\\\207\321\217C l\235\370\276\347\202\243\242\250c\264"
+	.ascii	"\220]\207k\002\370\006\353\"\365\001\230\253@\t\304\034^NF\353"
+	.ascii	"k\\@\255\3213\234\ng\030\323\326\243\271\322\253\360u\016"
+	.string	"\017\250\243]&\300\314\347\343\305\277\rM\313\240rEa\220\317\005\001\324\325\004\225\031)y\356\232\253\302f\322\301\205\350a\334;q\006.\335c\017\357\315\nn\315\310\351\033=\303\346 7B^\355^4\305\3540\004m\312&\364Lj\222\205\345\350\215\246\310Q\030)\304\253g\242\351l\177D\350\310,\215\270l;f\f.\034\316\362N'0\356\t\346\002Y\337\016\320vlT\367\332\276\034\207(\245\272\354es\214\021@s\307i\362\036\360\n\222\204O8G\006\\+\204\334j)<)8\301\036\304\357\200\262\246y\341\212\203\231\344\"\f#\373\003\"7\241ROM\362EDp\330\t\326uZ\366\313\347\026\224^\264!\004\200\025\311E\210\331\374\177\203|\265\3639\0234\220\213o\250V/\314x\037\365\263\307\2335\313\261\230\326\246\320\377A\243\n\346\316\b\313A\221\254a\203\t\241{\210V0\264\227\020\241"
+	.ascii	"\210y<\013Y{x\203>t\304\261Qvk\367\334x}Q;\373\007\362w \313"
+	.ascii	"\365\276U^\016I\020\330%\002$p\205\362{\225cU\232G\t\267A\234"
+	.ascii	"\366\224X]\353Y\276\221\245\200WV\336\267a\351\002\237\375q\276"
+	.ascii	"i\006Srr\316\024;u\313\217\271o\214\365\007S~\254@\277\335Hz"
+	.ascii	"\023\304jhz\353l\326\377Q\226$uX\236o\275Axa\216\346b\234\275"
+	.ascii	"V[\350\3438eB+AdR\352\004\034\230\327\032CZ\3125\362J-^\273U"
+	.ascii	"\211\021\214\021\"\307{\022\217\331 A\tI N\2211\311s\022d[\213"
+	.ascii	"+x\341=\f\256\312\310j\201\200\225\246s@\3017&\037\003\237\214"
+	.ascii	"\342y\004\256\346\374\274\"\030'I9(\f+\005\370\263|y\fu\266\263"
+	.ascii	"\026"
+	.string	"\365%\340\221\240Z\312fr\236"
+	.string	"p\212\"e\023\243\371h\261\202"
+	.string	"\224{^\b\326\370P7W\331\300i\234\205E\314;\364\235\027'\013B\261\374A\345\331\350\362y\3001\374Z\266\262\004<&\004s\316\247\2013\036\367\200\360\335\242\202\362m\217~\316\276\251"
+	.ascii	"\345\211v\020\305\331?\325(\322Dy\036&O\364\t\266t)\262W\267"
+	.ascii	"\306pw\374\373{`X\234E\033G\336\363-\343Z\321\340VH\347V\243"
+	.ascii	"\212\006\204\205\273\013\355\374\255\361w\033\254gk\027\343S"
+	.ascii	"\274\302t\316y]\025\017\376\263\310\363\222O\214\301~V[\001"
+	.text
+	.section	.gnu.lto_.symtab.4496b09420c795cc,"e",@progbits
+	.string	"gyroSyncCheckUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\001"
+	.string	""
+	.string	"gyroSetSampleRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.4496b09420c795cc,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,434 @@
+	.file	"bus.c"
+	.section	.gnu.lto_.profile.5f6e5cd698108e28,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.5f6e5cd698108e28,"e",@progbits
+	.string	"(\265/\375 T\305\001"
+	.string	"d\002H"
+	.string	"\n"
+	.string	"\265\230\240\355\006"
+	.string	"\001\002\003\004\374\337\303\241\005"
+	.string	"\005\006\007\b\267\335\335\337\n"
+	.string	"\t\267\335\335\337\n"
+	.string	""
+	.string	"\007"
+	.string	"`\b\030\027\f\006\203\201!T\306\331"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.ipa_sra.5f6e5cd698108e28,"e",@progbits
+	.string	"(\265/\375 \254\375\001"
+	.string	"\024\002\240"
+	.string	"\n"
+	.string	"\003"
+	.string	"\020"
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\001\003\001\002\003\004\004\003\005\006\007\b\002\020"
+	.string	"\007\003\t\002\003"
+	.string	"\f"
+	.ascii	"AQ\001\027\002\217\001O\330\364\270\222\003(\020\310\f\310B\246"
+	.ascii	"\340\035\3630\300\002"
+	.text
+	.section	.gnu.lto_.inline.5f6e5cd698108e28,"e",@progbits
+	.string	"(\265/\375`v"
+	.string	"5\002"
+	.string	"\204\002j\001"
+	.string	"\n"
+	.string	""
+	.string	"\003\200\200\200\200\002d\001"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\201\200\200\200~"
+	.string	""
+	.string	"\006\002"
+	.string	""
+	.string	"\001\002\003\004\005\006\007\b\t"
+	.string	"\f"
+	.string	""
+	.string	")"
+	.string	"y"
+	.string	"\311"
+	.string	"R"
+	.string	"\362"
+	.string	"\222\001\244"
+	.ascii	"\344u\024\215\315u\271\211G\001\334"
+	.text
+	.section	.gnu.lto_.jmpfuncs.5f6e5cd698108e28,"e",@progbits
+	.string	"(\265/\375 \254\005\002"
+	.string	"T\002\240"
+	.string	"\n"
+	.string	"\003\001\001\001"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\002\001"
+	.string	"\002\001\001\002\003\004\004\001\002"
+	.string	"\002\001\005\006\007\b\002\003\t\001"
+	.string	"\n"
+	.ascii	"\256\202\233@ \360\030\360\204MO\317\344\006\310\007dV\246\004"
+	.ascii	"0h\003"
+	.text
+	.section	.gnu.lto_.pureconst.5f6e5cd698108e28,"e",@progbits
+	.string	"(\265/\375 #\031\001"
+	.string	"\037"
+	.string	""
+	.string	""
+	.string	"\n"
+	.ascii	"\200\004\001\200\004\002\200\004\003\200\004\004\200\004\005"
+	.ascii	"\200\004\006\200\004\007\200\004\b\200\004\t\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.5f6e5cd698108e28,"e",@progbits
+	.string	"(\265/\375 \222\205\001"
+	.string	"\250\206"
+	.string	"\n"
+	.string	"\003\002\002\002"
+	.string	"\001\002\003\004\004\002\005\006\007\b\t"
+	.string	"\013"
+	.ascii	"/F\2622\016\034\f\034\002\316\215i\f\340\016p\f&\027 \233\r`"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.lto.5f6e5cd698108e28,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_busRawWriteRegister.7.5f6e5cd698108e28,"e",@progbits
+	.string	"(\265/\375`?"
+	.string	"-\b"
+	.string	"\302O87P\215\322\001`D\264\204\330X\243)\365mC`&\232\nQ\271{\2779M#\320/\263m\231pg\234\264vDUE\200\315|\275\235\374\3348R\266E\262\311\336)\005W\347\302\252\207\214\306O\206m\036\215\345Mf\363h\346F\263\017\207b3\202sA\314\r\335f\246\300\232DFgG\323\350\264\324\320;\313 \024=\273z0f\330\257vw\035M\366\277\277z\375\341O\377\245\303\b\344\222\332\255H\241\326D\216l\330\346l\213}\002=`\275\223\013\205\n\276\202\034w1P\023B\373\034\357\340\376M\\`\327T\"\262[\021|P\271t\375\200uY\371\305\272\264\355\204\005\316\035\201(\242|\243\217\224\335:\243\306\273\303\316\277\3071\242\020R\211\342\020\240aw\rI%\213;\3366\3066\203m\222\r"
+	.ascii	"2\003\202\341\243a\215\020\220\270\006\242L(\2400\030\346\023"
+	.ascii	"\355\300W\202\221\003\2500\235k\222\001"
+	.text
+	.section	.gnu.lto_busWriteRegister.8.5f6e5cd698108e28,"e",@progbits
+	.string	"(\265/\375`8"
+	.string	"%\b"
+	.string	"RO88Po\322\001\240\363%\0068"
+	.string	"\345\250\263\353\273\213\020\r\314z-\003\242\362\232\266(\337m\267\266\f\266|H\324\256\314L9\216\315_'P\006\"O\n\266\232\020\"wJ\001\232H\333.\bN*\211\333\274\321'3\310\343\215>\321\223\034)$\267(\021\322\"\"Hz\321S\340n\202\223Q\324u2r\346\376\313\f*\024e\317\023T\017\373\327\356\256ue\237\365CU\214TI'fW\243\206fY\260\024\020\333&\233c\217\224\036\260\250\226\f\206\013~\226\254\273\0343\021B\373!\0271\235Eq\201\335\225\n\312\356Tp\302\346\230\347;\331\261\315\007\262c\266\275\320`\362G`\241/+\251\226\314\356\214\372\361\357\360\363O\362\003\230V\207\213\211\352t\b\360\260\273\206\027\252\215[o\033\301\266\203\355\223\r"
+	.ascii	"2\003\202\341\243\302v\025P\\ST&@P\"\030\341\023\370\300\367"
+	.ascii	"\300\334\001T\234\3275\311"
+	.text
+	.section	.gnu.lto_busRawWriteRegisterStart.9.5f6e5cd698108e28,"e",@progbits
+	.string	"(\265/\375`C"
+	.string	"5\b"
+	.string	"\242O87@\217\322\001X\360\344\tp\235\022\274\331\354\302v\030PA\357nc14\334\"\004y\376\326\326\341\367\361HKUE\361\004\376\004X\306\032\240\344\332g-\222\275\367N)\227\347\302\342CF!(\303\266\317\3062'\263}6s\243\031\250C\261\031\321\271 &\207n3c`M\"\243\323\243itbj\350\235u\020\202\"\273\212\036\354\260\037ww\rM\366O\177|\375\337Q\377\245&D\305R\260\332%\255Z6E\236\200\330\346l\214\215\332`\210\357u\342\001+R\271\230\357\331\027\371\b\367\023\305\005vM+\251\335\252\340\204\313\245\353\t\254\313\313\007\254K\333^\320p\356^?H\347\300\260(Q\355\326\t=\336\375u\376I\036S\032&\243R\305\037\200\303\356\372\215J\0317\274m\004\333\r\266Q\002\016"
+	.string	"2\003\202\341\243a\217\020\320\270\006\256L(P\016\f\006F\370\004>\360=0\227"
+	.ascii	"\025\307tM2"
+	.text
+	.section	.gnu.lto_busWriteRegisterStart.10.5f6e5cd698108e28,"e",@progbits
+	.string	"(\265/\375`:"
+	.string	"-\b"
+	.string	"r\21788Po\322\001#vm\036t\\\217O\235\2707\200\211\276\341?\0020l#lX\004\321m\267\266\f\266|H\324\256\314L\361\346\"~\235@i\b\017jM4\331d\357\224\002\231'\323,\211\215F\320\246u\237\315e\216\246\373lfG7P\207j\223\242\223ML\016\355\246\246\300\\\305F\247\207\343\350\314\324\375w\035\\\304\221]E0v\330\267vw\035O\366Q?\214\020u\2452p\331%\305\274\254\212D\t\261\355\331\031\233$\364\200\035\255l4X\3605\344\270\313\0013!\264/\362\021\357(\213\013\354\236RR\273u\301\n\330\245\353\t\256K\354\003\327\245m38x\376^?H7\201`\230\254v\353\214\036\377\016?\377%GP\265\230XNJ\242C\200\210\3355\314(i\334\361\266\023l?\330N\005\r"
+	.ascii	"2\003\202\341\243\302v\025P\\SX&@P\"\030\341\023\370\300\367"
+	.ascii	"\300\\\002T\234\3275\311"
+	.text
+	.section	.gnu.lto_busRawReadRegisterBuffer.11.5f6e5cd698108e28,"e",@progbits
+	.string	"(\265/\375`l"
+	.string	"=\t"
+	.string	"\006\021?8@\255\322\0010\360Hx\377\\2\376\273\332\374\275\n\303\216)\277\006\303\002\r\354@\370\257\255Q\375\177h\240!\314Qt\211s:\377\214\204\277\016h\226@\250\356M\366N)-"
+	.string	"0"
+	.string	"*"
+	.string	"\366BC\311\337+H\352\035'\032\261\331n\245\361\343\337\341\347?\366M\266*A\2510\016\001\"v\327\020\245\342\270\343m#\330~\260M\013\260\226\203|\215\b0\233A\262b\330\340\253\3051{J\331\240\020\332\037y\253t\327\305\003vY*\262\335\252\340\004\313\245\353\007\346\245\345\002\363\322\016\361d\327\023\214\036\366\267\335]G\226\375\327/\357\372\267\327\037\036\366\177B\210\314V\fj\273\251\032mQ\244I\210\355\222}\261\003\022\"\017\210\233\230\032\221\246\263y\270.\222\270\2167\332Ls2\336hC\275\216#}\272\016\005}4\024\224\323y4S\340P\005\327QQ(\324\321K5\375\233\007\246\021"
+	.string	"2\003\202\341\243a\231\020\020\272\006\"M(P\016\f\006F@\270[\025\006\303|\242\035\370J0\222"
+	.ascii	"\025\306tM2"
+	.text
+	.section	.gnu.lto_busReadRegisterBuffer.12.5f6e5cd698108e28,"e",@progbits
+	.string	"(\265/\375`^"
+	.string	"-\t"
+	.string	"\206\020?90\221\322\001+\370\345L\303\013\035o\351\242\336\033\237c\300\361\231\2446\216\233\326\217\355\321\265\3370\345\256\177\254m\031\f\0064p;\275O\256ir}\323\3212B\310\336)\005-"
+	.string	"."
+	.string	"."
+	.string	"\016+\207\257\"\256\177\324h\310j\273u\312\220\207\217\241\177\331\021dXh/*/\326#@\304\356:n\2748ny\333\t\266!l\303\004(\002\317f\240t4l\361Ue\271\353a3c\264_r\223\325c\027\017\330\205\265\314v\353\202\0258\347\\?\320\235\343\\\240;g\333\f\001\007\030\262eWV\224 \366\267\335]K\230\375\330\037\245\304\254\026c0\263\353\272\241Y\027ne\304\366\312\356\330)\252{\266E#y\340N\002\023\247Q\351\243\350\274\223'\332F\037\225\251O\004\242@\235C\037\020\005\232 \375R$*\232%\222W1C\024\234\237\002\233,>:O&\023\235\235\272\017\273\020"
+	.ascii	"2\003\202\341\243\302v\025P\\S\222&@P\"\030\001\341nU\030\f\363"
+	.ascii	"\211v\340+\301H\002T\230\3275\311"
+	.text
+	.section	.gnu.lto_busRawReadRegisterBufferStart.13.5f6e5cd698108e28,"e",@progbits
+	.string	"(\265/\375`l"
+	.string	"M\t"
+	.string	"\006\221?:0\305*\035@\b\340g\210&\312\310\201-\332\3612\224\"\3233\fh\331\373^\321\300x\370\355\003\302W\377\345Q\0131\"\202\304\3204\336\220J\026-o\020\250\255{\223\275S\n-"
+	.string	"0"
+	.string	"*"
+	.string	"6\203\303\310\337\353\307\351*\326\006L\266[i\364\370w\370\371\207]\213\255LL\250\214\303\200\210\33554\241:\356x\333\b\266!l\317\002/\222\007\351\n\025\\VCd\325\240\301\327\213_\266\204\302A!\264\017\362\220\321[\030\027\330M\245\304v\353\202\023*\227\256'\230\227\225\017\314K;\261d\327\022\214*\373\332\356\256c\312\276\353\227o\375\332\353\017\377\372?%\252\f\200\302\310\356)\300lOd\t\313\366\310\266\330\001\023 \216\207\243\230\033h\333h\034\256\213\"n\343\2052\323\032\214\027\312P\257\343D\235nC=\235\255\202j:\217b\f\374\261\340:\n\372|:j\251\244\177\363\200\024\021"
+	.string	"2\003\202\341\243a\231\020\020\272\006\"M(P\016\f\006F@\270[\025\006\303|\242\035\370J0\222"
+	.ascii	"\025\306tM2"
+	.text
+	.section	.gnu.lto_busReadRegisterBufferStart.14.5f6e5cd698108e28,"e",@progbits
+	.string	"(\265/\375`^"
+	.string	"\025\t"
+	.string	"&\320=9@\217\322\001X\360\223\355\226\036G,\270\217\265\004\217\216P\030~\"V\273\373\306\032\362\275o\033\013t\240\372\205\264TU\024?\354\203\222\225n\216\373{\352R-\022B\366N),"
+	.string	"-"
+	.string	"-"
+	.string	"(\207\257\037\253\273T2`\262\335:\245\307\303\307\320?\354\0072\263\230K\n+\365\b\360\260\273\216\032\254\216[\3366\202m\007\3330\001\234\3050\001Y\320\342k\3059\253\212m\314\030\355\213|\004\365\227\305\003v[/+\273\265\343\004\3157\327\017p\3374\027\340\276\331\266\002C\0179\203\013\251\262k*J\227}mw\327\262e\377\365GI\301!\213\351\240\354\256f3\333\262\261\204\330F\331\033\373\204\244a+1\021\004\020\245\320\350\213\340\272R\347i\241\217\312\323\347\201\246\017g\220\0074}&H\277\223\210zs$\352$&\210\202\323S`\322\304Gg\211D\242sS7\021"
+	.string	"2\003\202\341\243\302v\025P\\S\222&@P\004\214\003\303@\020[\025\006\303|\242\035\370J0\222"
+	.ascii	"\025\346uM2"
+	.text
+	.section	.gnu.lto_busBusy.15.5f6e5cd698108e28,"e",@progbits
+	.string	"(\265/\375`\036"
+	.string	"\225\007"
+	.string	"\262N55`o\032\003TN\020'\210\007@\203\345\322~\200\301]\244\025h\2149\030j\333\"\302\310/\366\266\003,u \b\210Z\027\245\267\242\211\002\004\277\215I$eJ\001\022\223\362\202\242\353\223\205:V=\234,\324\211\231\274D \371\211\022 \210\210\350\221Y\344\024\024\233\270d\244\3000\0317\363\336,\003\214\227\321\316\221{\247\326"
+	.string	"\377\337gj\255\262\335\253\370\n\306\301\345'\315\310\234\005\246\204\264\325\332M\3337-\336\206;\275\244V\242s\255S\036\321\254\272\260\300o2A\371\247B\0234\206\235&\260\f5\036\260\f\333v\241A\353\346\tB2\252C\243d\365\317\370P\336\354\266\332$>\210Q\371h9)\215\354\002\036\376\327q\224<\334\347\266\bm\031\332\212\004\n"
+	.ascii	"2\003\202\341\243\302v\025P\\S&&DP\022\234$@\231y\265\223\f"
+	.text
+	.section	.gnu.lto_busReadRegister.16.5f6e5cd698108e28,"e",@progbits
+	.string	"(\265/\375`\025"
+	.string	"e\007"
+	.string	"\022\01634`o\032\003\340\232\213\n]\020\333\034\\\375l\2648\325'\360\222\203\315F\223\026\304\221_\354m\375\260\324\201  5\002\255\267\242\211\002\004\277\r\355!eJ\001\020Vt \253\203}6\257\034\r\366\331@,Z O\354@\t\317C\004\344D\fj\nzMX\021R\\W\204\231y\313gp\3410\332\031j\256\2435\300\377\327\221\332VaB\2714\234~\321K\352+U\312G\333\254\315\264u\315S\326\375\034)\330Z\353\021\223d.\261\260\300OR1\375S\241\t\030W\235&x\2560\036x\256\312\220Uzz\210^I$\343\004\365O\350J\226n\262\266\211\017BN,-(\243\220[\200\303\3776\215\321\206\353\334\026\241\355B[\220\013"
+	.ascii	"2\003\202\341\243\302b\025\020]\363\"\026\347\b\367\300\\\001"
+	.ascii	"\215\262\021\002\277\256I\006"
+	.text
+	.section	.gnu.lto_.symbol_nodes.5f6e5cd698108e28,"e",@progbits
+	.string	"(\265/\375 \366}\002"
+	.string	"d\003\362"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\007\177\004\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\b\177\005\t\177\006\n\177\007\013\177\b\f\177\t\r\177\n\016\177\013\017\177\f\020\177\r"
+	.string	"\n"
+	.ascii	"\200\036\340\033\340\033\340\033\340\033\340\033\340\033\340"
+	.ascii	"\033\340\207k\3151"
+	.text
+	.section	.gnu.lto_.refs.5f6e5cd698108e28,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.5f6e5cd698108e28,"e",@progbits
+	.string	"(\265/\375`\354\013U<"
+	.string	"\232hL\027FP\036V\007\022^\243\242\024>\310\360\034m<\204:\341e\006<\253p\301&s\200\200Oq\374\214\215L\267\033\230\355\025\213\350\257E\252\006\200D\370\022*_$\027\370? \204`\340`"
+	.string	"\017\350x\267\267\267\225)\005C\001`\001a\001\277\345\342\360y\232\326?\211\353/u\327<\233\247~\331\253\361\317\362Z\\8\357Mf\357\355\024\334\211e\217\346\311\210\226r\322\021=r{\317\376_\356D\367#\013_\366f^\214h\271\367\221\255\004jdx\330\325\355=\013\207C_\226\330\226&-\3532\\\367's\177,\377\365ix2UtW\367\236\207xD\3442|\346\236\032(\333\226f\251?\366a\346-\374\275I\3558\315z\223\373`\177\346\251\b>\314\217,8/\356\262\277\366\236\205\200W+\327=\232\365\026\256?\202\366\357\036A\353*\\\027\341z\007\367\205H\017F\b\214T\213\227f\035\202\373]\336\313S\377\213\373o\371\331\331.\321=\335{\006\362\224B\320\3004\353?\365"
+	.ascii	"j\333\202\003p\375\213Z\241/j]\273\013~@\313\276\200\366\367"
+	.ascii	"\017h\203\363\017h\335\027\320\236p\300\272k\020\t6\020a0`A\330"
+	.ascii	"\272k\342\220\003!\005\300\003\356\256\302\357\334\275\347\256"
+	.ascii	"\t\270\177\221\373;p\377\004\356O\344\376\006\334_\350\376C\356"
+	.ascii	"/\344\376@\367\377\271\377\273;\037w\017s\367=\356\036\344\356"
+	.ascii	"f\356\376\273\273\273\273s\377&w-t\377q\021\277\255{\357x\357"
+	.ascii	"\355sZ\315{\027\t\312]\315\346\336Pas[\305a;\366\326\325\267"
+	.ascii	"3Oy\212\025%\206}\231vm\036s\374]\333M\352t\2471\227Me\307\355"
+	.ascii	"zV\315i\245\336>,dXU\315\352\255\377N\307\256\367_\201\230z\263"
+	.ascii	"{+\377\031\004\3753\350\245\331RziY\327\273\217\330\032\032\325"
+	.ascii	"\362\371\354\321F\224`\\\232\32533\265\327U\2340w\362|\335S\337"
+	.ascii	"\356\303\370\213\3711\314\275\267\335s\371\352\223\003\230\335"
+	.ascii	"\223y\272\267B\203\233\031\327Gn8\374/d\327\271\226\205\363s"
+	.ascii	"r\272\356\274\235\307\363\324\247\363\247\3732_\026\024\017\355"
+	.ascii	"\235\204O\027\335\233=[\020s\336?\220\352\366\260\300p\370\243"
+	.ascii	"\322\272\212]V\356\353<\365\347\236\316\333\307\275\025:\357"
+	.ascii	"\037\3102\251\256\272\271o\3738"
+	.string	"DK9\304\030\234\234\213\246\311\030\023\2678\3779\300(0)mp/\007@\020\250u\354\314\205\363\357\001E\207\031\032\327\237\352s\336\315\343X'gB\262\230q\375\301\270\376^\334g\373\263w\363\326\352\207\2648\271\275\367\332\277y\352\263\275\232\263\363\336\325\237\331\336\n\325PFg(\034\006qI\301\222\245e\375\253\270l\025&\0304\315>\332\247=\365\255\337f\003\201qWi\246h\326\003\\4\253\203\274X\020\333\363J\217f5\220\357\323\0132\306\003\216\310\363\351\334r\305X\241S\232u\336\322\207\217\265\036\254\026\2626*o\315\246\236r\343\275\3439\001Z\325\325\353\347\366E&\307\306u\275\324L\327:\\\353\320S\017\335\2747-U\327\272\r\265*\362\231\255I+\"\345zJo\240\275\277\366\336D@e\306\316\244\232\325<t\224\373\224\206\361\021\245e \2659m\304\350\221\262d\223\245Y\275\003"
+	.ascii	"\034\03531\315:\335\213\271\373O\017\013\217\034\355\304u\355"
+	.ascii	"\336n\245s\357\375\2437o\347\022\250u\177\377\336\177\221;\360"
+	.ascii	"y\337`\363\374\301\222\275\265\334\356\270R\300\224F\364\202"
+	.ascii	"\355^{\307C{\336Ny*\215e\252\332sh\336H\b\354i\326\226g\351\223"
+	.ascii	"\215n\275\347\375\233)}\326\220\347\250S\236\243qp3\243\361\336"
+	.ascii	"\3633(W\225\361\313S\351S\236F\237C\233\271\343=U\"q\231\321"
+	.ascii	"\247|\026}\006\345\251\362)3\245\317\241,7&N\244\222t\251\276"
+	.ascii	"\033\231\271{4\255\224\316\240U\236\243\333m\357\257\356\330"
+	.ascii	"\316\006{[E\235n\312!\177fi\355\261$\243\214~"
+	.string	"\201\346\022+\272\231VyJt\357)\313\030\273Y!\236\255\233\311[\343,\253M\265co\003{\336\273\271w\034B9\340d\007\003\b\216\357\213\027\311\016MJ/\212\001\310\243\0222\205\020N.\005\235\311\b\343E\361\"\215G\0267\224P\300\311%\001\316d<\276N/\f\327+ E@\272\200\303\347\0272L\3100\241\365\013\031\210\304\fHD\327\221\210\274\031OO\035\212=$\\4B\245x\361~(&\231H\361{\231\234\224\220\260\223\321E\026K$\261NF\023N0Sk\204\202yp\321\303Q\322\317\303Q\322O\313td\344y\214\002\376\004\365\036\215\220OOG\243\037\\\034\321\024<\276HX\211F\213,^@:\031\223>\030~\217MMJ\276\327\206\322\214\024I(\032n\262h\343m\202\223K.\\|\231\2146\336\017pr\351\367\026_\250\034*\340\344\322\217\023\211\036\026\254 \001\302e\222"
+	.string	"'\227\214\340\343k\303xl2r2*\3210b:\302F\022\204/T\016$\234\\\362\271\226\226^\342\356\355\243Ur\245\352Z\347\253\202\246m)q\275\344\305|s]\033\034\315\352$:\352gM\266\206\261Q\321\250\306j\243\322q\327\206%u\215\365\263&\266\323\322\254F\242\243\\\270\273'}\264rk\226\302\243Yg\343#G\336\200\375\\\275Q\233\002\307\312JC\337pU]\275\270\310\326<\251\026)\242\241}\200J\234,\235Q\252\2524t-\255\352\352\325\273\306\211B7\3045\024"
+	.string	"\3275\213\020\035\325\234\202\023\200\333\250\2010\207\2244#3#\301H\222\202$\007\240\002\221)*\333\021P\251\202\214\320\210h\222\244\322\001\3329\001\202\274sn7\bz>\304"
+	.ascii	"\262\002\231\332\360\035)U\362\b\r\320\204\247\316\211G\335\004"
+	.ascii	"\370:\363\340|\251DF\033\f\321\227\376O^\237\023\330?i\204\255"
+	.ascii	"\036\304\265\201L\376\211\342gm\230\200=\\\\l\246s\031.\325\017"
+	.ascii	"\016LFCP\237\255K9\346\033\341\245[\254\r\371\200\347\306~\371"
+	.ascii	"-\024\326fI\t\364G\330\032s\363R\212@,q<\313\220x\205?\202\306"
+	.ascii	":\261]'t\226(\216\247\211\032\320\206\367D\334g[\\N\371L\202"
+	.ascii	"\361z_\243\027m\fa\215\345\345\205\322\017\006\272\034@\331I"
+	.ascii	"\221\221Y\333|\267D\2705\341\275\3313t\361\244/\031\276r\205"
+	.ascii	"\203\236\004|U\252\372&Rn\253v\032I\025|\337+\027\262\357\001"
+	.ascii	"\270O\321\323\227#\365\275i\177C\0019jM%F\"\220\210\\i\366`o"
+	.ascii	"\005V\244\203\263\310v\b@\314\027\242\213@\025\337\363\026\222"
+	.ascii	"\315le0\002\374\242\350p\231\310\f.Y\215\256\201`T<\300\210z"
+	.ascii	"\365I-\250\232\354\324X\260\3078\b\034jM\375\351\024X\263\250"
+	.ascii	"\264\222[\255Tmh\365\215$\211x~.\to\037\277i\245\261\321a%wL"
+	.ascii	"\216Q\2510\355\357|\364\336J\016\005\027 t}r\206\316={\303J_"
+	.ascii	"k\006\217KAT\241\361\245E\022J\315\203\307B\317\006r\364k\273"
+	.ascii	"f\302\tl\223\360\276I\367\2214\362~\346\226\f\331a\357\276[\321"
+	.ascii	"\367\264[N\302\273\240\250\002"
+	.text
+	.section	.gnu.lto_.symtab.5f6e5cd698108e28,"e",@progbits
+	.string	"busRawWriteRegister"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\001"
+	.string	""
+	.string	"busWriteRegister"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\001"
+	.string	""
+	.string	"busRawWriteRegisterStart"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\001"
+	.string	""
+	.string	"busWriteRegisterStart"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\001"
+	.string	""
+	.string	"busRawReadRegisterBuffer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\001"
+	.string	""
+	.string	"busReadRegisterBuffer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\001"
+	.string	""
+	.string	"busRawReadRegisterBufferStart"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\001"
+	.string	""
+	.string	"busReadRegisterBufferStart"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\001"
+	.string	""
+	.string	"busBusy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\001"
+	.string	""
+	.string	"busReadRegister"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.5f6e5cd698108e28,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,315 @@
+	.file	"pin_pull_up_down.c"
+	.section	.gnu.lto_.profile.e4edbe5c47785a4a,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.e4edbe5c47785a4a,"e",@progbits
+	.string	"(\265/\375  \345"
+	.string	""
+	.string	"\260\024"
+	.string	"\002"
+	.string	"\371\332\343\320\004\002\002"
+	.string	"\002\001\001\374\271\374\325\017"
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.e4edbe5c47785a4a,"e",@progbits
+	.string	"(\265/\375 C\225\001"
+	.string	"4\0027"
+	.string	"\002"
+	.string	"\003\001\002\002\002"
+	.string	""
+	.string	"\001\001\020\001\007"
+	.string	"\001\001"
+	.string	"\001"
+	.string	"\001\003"
+	.string	"\001\001\001"
+	.string	"\001"
+	.string	"\001"
+	.string	"\001"
+	.string	"\005"
+	.ascii	"0C\204\272\027d\016\214\272\2016"
+	.text
+	.section	.gnu.lto_.inline.e4edbe5c47785a4a,"e",@progbits
+	.string	"(\265/\375`\020"
+	.string	"u\005"
+	.string	"\022J *pi\222\016\026\321>\242\343\351\201."
+	.string	"\006~\225\244\304\250Bt%l\347\377\376\371\303\375\375\377\315\206\233\275\237yC\314\336R\246O\346\376\210%\254%\221\372\234\230\303Z\021\214\271\023\361\235\310~\346\216\357D}i\374\302\026\252\027\250\004\023\b\0077\325\320\375\370\351\203\302\002Don\356\303{\323C\252\224R\247\370\255\274\262o\267lx\032\320Z\341\317@\200d\2450MI\003\n\006\004\034\337y\001\021"
+	.ascii	"1\005\274b\367+V\202\230\033\237\301\352\306\275\344\005c?\212"
+	.ascii	"mii\352E\211K\323Yp\031eN\225e\271\231I\001\334"
+	.text
+	.section	.gnu.lto_.jmpfuncs.e4edbe5c47785a4a,"e",@progbits
+	.string	"(\265/\375`\f"
+	.string	"}\003"
+	.string	"\002\206\021\032\260%\351\f\003\016\340\304\261\201\207a\2651\016\303\004\247\330\251\253\356\262\267L2\374\360\206\t\342\302\023\236G\361Q}X\024\017\2526\251'\325\313\t\270\273{\243\"\017\\\322J\205S\231$\252M\355R\360\017\313\031\017"
+	.ascii	" \t\230\3735(AtW\302\302\302\004\354\351PB@V\314\343f\232\375"
+	.ascii	"T1\340\270?\331\210L\362\n0\004"
+	.text
+	.section	.gnu.lto_.pureconst.e4edbe5c47785a4a,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\231\004\001\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.e4edbe5c47785a4a,"e",@progbits
+	.string	"(\265/\375 2-\001"
+	.string	"\270&"
+	.string	"\002"
+	.string	"\003\024"
+	.string	"\001\002\005"
+	.string	"\001"
+	.string	""
+	.string	"\001\b\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	" @\315\303(\306\201\325\033\300\002"
+	.text
+	.section	.gnu.lto_.lto.e4edbe5c47785a4a,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_initPin.13.e4edbe5c47785a4a,"e",@progbits
+	.string	"(\265/\375`\013\002=\022"
+	.string	"6bzG\320\322(\035\327\2002\376\001\367#\310\007"
+	.string	"D=\367Fx\021@.\214\365Y\027\232\373\262\177\227;\r\374Y=\232\204\234<,W\222p\275/\030\344jM~\300\242\212Fq`\026G\271\332P\3007\204\375F\310\2262\245f"
+	.string	"a"
+	.string	"`"
+	.ascii	">j\354\352V\334\222\272g\335\007|\367RG\371\356\231f\003\271"
+	.ascii	"n\304*8\302\301X\332\335\225\2128\355\250\317\213\2324\277vT"
+	.ascii	"\317?\334Nz#\271\236\307x@g\tDIN'\2220\341v\200\271[j,\320\341"
+	.ascii	"\bGI\316\026Qz\250\360\371\356\231!\207\313D\271\354\256\223"
+	.ascii	"'\307\341N\3356\215m\007v2\bD?\370\242\177\344F\267\352C?*\246"
+	.ascii	"\343\227\326\230\316/}\023p\210\200\033\273\032\236\212l\222"
+	.ascii	"\207t\342F\277\375\357\f\3326\232\271\330.\274\244\230\021dW"
+	.ascii	"\247r\317/vL\333@\013\355E6?Y\233\016\026\rRw\027\264\023\335"
+	.ascii	"\304\223\275\371|X\220\272\227\022\237\366[\\\210\366!\234\003"
+	.ascii	"\330\375\t*\265[\256<\217Sv\264f\325\250+8\247\337\346\033QU"
+	.ascii	"\024\217\335N\b[\346(\242\241\244\237}*=\021\212\027J\267d2I"
+	.ascii	"\246\332\257\ty\036\225\246\334\264\346k\352\233pN\226\271\214"
+	.ascii	"0\265{C\340\037\305(\244v\367%p\276{\327\030@D\206r\362\311\326"
+	.ascii	"\325R\201\354\307\335]\353\217\375\341+-\270``/O\346\202\325"
+	.ascii	"\204\236\204W\004X\330\372\334b\201\325\2040\254\330\214\025"
+	.ascii	"\0233\213\261`\257\330jF\346\252\360\222\301\254`/\b2\253\226"
+	.ascii	"lf\305B\300a\314%[\321\204\241l\005\352\366q\365\307.9jC\005"
+	.ascii	"%\300@b?\033LB<4\t\005y\001R\345\017X\256\025I:Z\363n\267\301"
+	.ascii	"DT #\375\346\003\365D?L2*\250\001' \220\002\021A\354\001\342"
+	.ascii	"\320\035\306\340y\351\244\355\242\354@?\211@2\230\361\206G\347"
+	.ascii	"\036\331\360\256\225\337\355P\034\250\307\361\t\252\254\226\006"
+	.ascii	"\260\313\312\307\276X[\b\227\326T|\214\236\232\211\366\013h\005"
+	.ascii	"\242$\333\205\375\354\321.K;\243\001.Yf7Q\\\311\342\3159j\273"
+	.ascii	"\314"
+	.text
+	.section	.gnu.lto_pinPullupPulldownInit.14.e4edbe5c47785a4a,"e",@progbits
+	.string	"(\265/\375`\354\001\325\020"
+	.string	"&^mH\340\260*\035\332GlC\237e\266}\364\020UM\021\022\311&\030\225\270\023\246'\255t#bY\257\361S<VX\336\230A\315\221\306{\372\252/b\231b\230A\n\316\340\330\036\351\340\t\215\333p\270}\334\265\266\211\224)\005U"
+	.string	"X"
+	.string	"Z"
+	.string	"\322$"
+	.string	".m\027\233t\251$\267l\336"
+	.ascii	"\230\017\0322'r\3149\301\365\340\357\337x\177\332\272\374V[~"
+	.ascii	"\3165\326\023a/\227\337\307\016\247\006\004\006\363)\220\345"
+	.ascii	"v3\260\227~74\337\333\2560t\"\214\346*r0\347\264\212\260\rw\350"
+	.ascii	"\266C\333\021l\r\t2=\\\332\333\225\345v7\2734{|\351\316v8\262"
+	.ascii	"\036\357\314\036I\265H\252\345k\267~\352\007\020p#$\306\234\032"
+	.ascii	"z<\346\217\364\021\361\332o\337\3279\216\345\243\027\310`\361"
+	.ascii	"M\374\346\362\321\004F\220\230s\222^\302\267% i\275\326\362M"
+	.ascii	"\016\r^\330\b\232sD\360!Q\017\356<)\313\203k\201Z\336N\211h\217"
+	.ascii	"\273\210\315,\003\210~\355sSH\256\215r\322\213\276\355\020B\214"
+	.ascii	":\202b\366\305\277}E\312\346\200\304\013W\201\332\035\320\234"
+	.ascii	"\223\001\212\247P\371 .=\201\245\027Y\241K\271\277]Df\263\203"
+	.ascii	"\203E\314\245=\353~o\273\201\330\214\226\200\262*p\272MFR\026"
+	.ascii	"T'\245\325JIEeeUJ\235V +4U8\205'`\352T\202\002MB\0268r\300\252"
+	.ascii	"\225)\004)\250T!H\032]\317\371\003\335\217k_ri\036\325\354h\345"
+	.ascii	"\007\365\314y:50\350\216\177s\316\371-\315\366\337\022\322\035"
+	.ascii	"\355(\246\213\351\360rqS+ \220\002!C\356g\217\215mP\nx\303O\t"
+	.ascii	"\253|\340h\262\357n<\236X\020\307\313g\207\304K\212\\\341\227"
+	.ascii	"E\304\203c\243a\371\024I\226\326\304\257\346\231X%\006#\220\226"
+	.ascii	"\332q\231!\013\206\006\007\030\240F\3522\202\371\225)\222\205"
+	.ascii	"\300\265\377\342R9\200C\204{\255\234\326\006\375$\322\271\326"
+	.ascii	"\023"
+	.text
+	.section	.gnu.lto_.symbol_nodes.e4edbe5c47785a4a,"e",@progbits
+	.string	"(\265/\375 \326m\004"
+	.string	"2\207\033&\220+\215\001\377X\304\372\266)\217\244p5D\200(-\216\273\303,\237\273\353w\321\376\320\266m\333\266\266\311\226[\246\343\004\202Iq\256\313\230\316\302\207\244\262\355t\024\274\252&K;\321B\026\332tD\322\0319\013\252 \350\002w\367\033\243\2012P\220p\004\020\322\317\336j\2760\324\007\240\007\267\357m\346\365=\023\266\335]\247\006\366\017\n\013"
+	.ascii	"k\22521Y\003\265\363\t\231\251\245M\t\206\313\007\254\251\330"
+	.ascii	"\t(\322\301\314\003"
+	.text
+	.section	.gnu.lto_.refs.e4edbe5c47785a4a,"e",@progbits
+	.string	"(\265/\375 \017y"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	"\002\001\002\002\002"
+	.string	"\002\003\004"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.e4edbe5c47785a4a,"e",@progbits
+	.string	"(\265/\375`\003\t\3751"
+	.string	"zW`\023G`\\R\007\377\311\001\bdy\201\250\027\253\322\"D\364\363\204\271\240A\322m\232?\262\356\022\202\366Z\233]\214\247\217!\225\023D@\340f\006O;\276\3407\373\341\216\377M\"\242\301i\232',\254b\374\315\306\2662\245\005\001\024\0010\001\016\305\241>\245\333\243\270\224^\311\340\217\376\307=<d\225\232\224\274*p\001\354\352B\254\317\205\330\330\2270\214\374\310k\2677q4\006W\357\216\274Jc\240\235%vc\224\344\265=\331\2369\324\231x\354\361\177W\350\376uS\270\340L|\314\315\020$\377u\344\360\271a\316\272\314\375\307@\017\3325\037[T\353\352d^\346\320 \2176\205\013\315s\311^\354?\366\255Uj<\272\362\332\035\332\366 \326\357<\210\355\243\266\177\355"
+	.ascii	"\344_\350\334z\230\213\005\361^)\370\245\377\361\217/\256Zj\345"
+	.ascii	"\265c\027\300\266\036\200U\363\266\333{\335-\246\273\3078\333"
+	.ascii	"\335h\216\343<\237n/\353n4m\354\272\333\315\233\3566C\320\335"
+	.ascii	"g\272;\004Z\200nW\322\335u\335=\327\335\325\356~\353\356\266"
+	.ascii	"\356\376\322\335k\335-\355\356*\335\235\326\335M\272\033\255"
+	.ascii	"\273\305\272\273\247\273\273t7\357\356\356\356\256\273\247\335"
+	.ascii	"\276\244\2737\"X\332\316\335\354#\231\377O\205\023?3\311\303"
+	.ascii	"v{;\216\273Pw\217\363\234Aw\257\377j\376\261\276\324\264E\244"
+	.ascii	" q\344\265\273\025|"
+	.string	"\203\375\273?\037?\363\215>\335\327\214\255\371\023\377\016\002\037\325\3727~6W\370\363\307\357\257|6S\2741\314|c\330\365y%\354\376\307M\237W\212t\375\215>\233o\024n\376\274\362\335\217\"w\264J\270\371N\341\246\317\033E6_\345\263\371c\365\305\303\016F\330\263\313\233\257\362\247\226XH\246\017\365\215\341w\373w\351\213g2\370\307\202\231nH+\237\222\244N%\237 \341/\260Lf\301\257\244\276_\360\377W\362\304/-\2701\365\267\234\352ja\275\324\213\177\003\037\377/\377]\177\352\377\273\377\337cb\305\377W>\257\327r\371\357\004Z>\226\233\366\342?K\311Li\276\321,\370\227v\026\365\372\250\330u\257w{2\333\250;\366R\377\357iZ\257&\215j\256\322c\207\304\316\315\226\247\351L\337!]7Z\177\022.W\203\t\344\315\214m\253\002\321\242R\243\306\347\200`\036\2308++`"
+	.string	"\334\250\314\241\265i\237\313\251\333B\226\345\325\331\270\234\016\030+/\237W_\303\223\321\226)\343U'\373\031^VgeEh\307\311\217;.4\355U\266m\315XV^=\316\345v\214\274\201\376\2006\234\237\351\270\225kZ\245\004\256\3555\016\267.\211\220\3210\343\203\303b#\r[\333\371\312\333\233\2675O\371O\251\027"
+	.string	"6w+\356\b\030\250\203\3616'\373\246\013h\024\325\334\277\023B\316{U\365\266\3661$\376\t\2641\232iQy\225\342 \2437\354\362\352a~\355b\002\260Lg\374>\f\\ZI\362\312\3138\250T\377\342\363I3or\357t\n\261S\323\254\265\274~\351a\243z\373\274v\206j\333\2578\226\366,\235\305\327\3328\001\332T\035\330;\231B\335\256\326\276\326q<\377\b"
+	.ascii	"h\341z\221y\365->}\203\203\245\246]p\350\242T\317\317b^\312T"
+	.ascii	"\363\nu.\036'\271\252\342%\257\256\305\251\360\334\254\306\352"
+	.ascii	"\362\332k\334Jw\347\340d\2611#%?>&\245\020-4\034\203GIH:IHl\237"
+	.ascii	"\220@\024\002\035\201IH\353\021H\024\352$!}8JB\342)\021\324B"
+	.ascii	"\311h\314\200\"xtj\001\342\300Q8D*>9\030\n?\034\205Ca\257\227"
+	.ascii	"\204\306\3400\310\324\266\005\242\bDE,z]d4\301h\002\333EF\277"
+	.ascii	"\237\021\321\257m\242\037\357\b,:\016\205O\275 \320\030\034\256"
+	.ascii	"H\n.\031\237\210NA\243\357x\202\251\270\240\211\305\240q\350"
+	.ascii	"H$"
+	.string	"\032\207v\216\300\036\223R\b\242\020\307\t\310$41$n\030\256 r(\212hjz\3720\024\026\005\364\357\267A\201\b\017G\355\222\204\341\nb\t`\361\t\330\324\364T\004\016\205\305!'cP\205\320Xbh(TB1\264dt\032\222\320\240\2733\21456\254\013\007\224w\314\316\032\335\031h\216jk\3210!\362y\205\202\312\311\f\303\377^='^R9^\220\354f7's\334\237\261\343t\326\020\352\316\310\316\311if\343d\233\322WV\033iaj9\332\356\374U\037\027(1U\356\346x\226B\242\240\354\332\353z\236wgd\362JG\347utVV\300z\270\221\341\246\275.\200\255\250q,\207\024EFffD\222\244 \031\003\220\002\021\251\262z\021P\261\222\204l\202$I*\323\032\371\276(\210H\267\221_\"e0\f\253\212 \376\001\252x\225\264\026K\003]\241\233[\201:\177W\340"
+	.ascii	"\224o\225_\235\323&z\312(\263\206\315\300\201\233\214\016[\255"
+	.ascii	"m \020q\013\372X\207\b\027\224\006+/\253\342\321x\243\311\241"
+	.ascii	"\336\200\033\250&\314\363{\006l/#5\322\250\373\230\366D\227\311"
+	.ascii	"a\321.\224\031!+/\325\b\236\250\275\230]s\216\317\016\001\237"
+	.ascii	";(\026\255\326\201\206\333\313r\347\264\271U\220\361N\264\234"
+	.ascii	";R\355j\207F\363\222i\324v\231\n\001\266{\226\373\027\377\033"
+	.ascii	"\201\272\222\271PuD\027g=m@*aU\217\f\341\236\321zt\006\331\234"
+	.ascii	"\307Yz\353@\234Ja\200Hxp\022\252d\367+\317\027\325\253\321\256"
+	.ascii	"\0237\340P.H\2004\317[\0320O\345e\t\237\f[\303\273IP\222\254"
+	.ascii	"\025\230\031FO\340\252$Dn\2364\322N\257W\001j\036\231\ne\360"
+	.ascii	"\207\244\206\334\226\020I4O\317\222\306\235\007\304\032\034R"
+	.ascii	"\231W1*\316\357\331\257\357\205\333\201*\270{`\226\025w7X\253"
+	.ascii	"\332y\320z\301\270\240\343\215\323\226y\004Z\022\356\252\313"
+	.ascii	"\274\207\331\273\177\325\021\273\032"
+	.text
+	.section	.gnu.lto_.symtab.e4edbe5c47785a4a,"e",@progbits
+	.string	"pinPullupPulldownInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341"
+	.string	""
+	.string	""
+	.string	"pinPullupConfig_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347"
+	.string	""
+	.string	""
+	.string	"pinPulldownConfig_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351"
+	.string	""
+	.string	""
+	.string	"IOConfigGPIO"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362"
+	.string	""
+	.string	""
+	.string	"IOInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370"
+	.string	""
+	.string	""
+	.string	"IOGetByTag"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.e4edbe5c47785a4a,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
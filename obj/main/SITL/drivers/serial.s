@@ -0,0 +1,821 @@
+	.file	"serial.c"
+	.section	.gnu.lto_.profile.cae45debf17b7c53,"e",@progbits
+	.string	"(\265/\375 '9\001"
+	.string	"#"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\002"
+	.string	"\004"
+	.string	"\005"
+	.string	"\006"
+	.string	"\007"
+	.string	"\b"
+	.string	"\t"
+	.string	"\n"
+	.string	"\013"
+	.string	"\f"
+	.string	"\r"
+	.string	"\017"
+	.string	"\020"
+	.string	"\022"
+	.text
+	.section	.gnu.lto_.icf.cae45debf17b7c53,"e",@progbits
+	.string	"(\265/\375`1"
+	.string	"5\007"
+	.string	"\202\f/4`m\322\030(\260\"@\223\374\321\261\202\b\256r\270\305DT\276\001\230Rc\022al\265~\203 \b\002\"\b\242B!2\263F,\221F6!Rn\231\310\016O\247\326\253w\267\215\342\203\3213\277\334A\201\350\002\2001r\260\344\030\202\205\007\205\354Q\f\032\233\222J~\271\3236\022\226[\242D\005\350\343\312\263\025\343\020\215l(y\345\351\002y8\035+\307v\240\324\205\304\374Za\347\004d\242\3124\034\347\241`\206f#\2649EI\020\006\b*\220p!\002u\353\223\263i&\031\217/\326\205,Jz\265N\275\217\032:H\246|\327\337px\376\323o+j\021\037\217\227yS@\021"
+	.string	"\\B\210Y\342\234\271\202!\301L\020\023\004\tf\202"
+	.string	"e\nX|\013X)3 \001\227[\024\301\371\274\272"
+	.ascii	"n"
+	.text
+	.section	.gnu.lto_.ipa_sra.cae45debf17b7c53,"e",@progbits
+	.string	"(\265/\375`4\001=\006"
+	.string	"\262\310\027\032\200K\322\001\f3\260\251"
+	.ascii	"\243\222\351\307\343\373C#7\333\332n\204\354-e\n\363\347\227"
+	.ascii	"\321x\216\253\242\274F\323Dy\214\244\210\226\025H`\"\007\312"
+	.ascii	"3\220:\177\t\222S r\230\002\226*\274\244u(\211\276U\007]\342"
+	.ascii	"}\253\254\025\262DKK\r%\213V\376%\373 \311\337\376\272\271\213"
+	.ascii	"- \200\"9g<nc\003\277\342\2662C\272\261#\274\"\b\0020\323\341"
+	.ascii	"F\315\204M\206\021j\234\"\326\021\024\346I\230K\222e\307I\261"
+	.ascii	"\344\252Q\300@%h\236\204\354\006OB\210\201\021)\306\212\0315"
+	.ascii	"\361d\344\266Bl\001@\207N\0167\330!5)\256\242P\374b\022\261\265"
+	.ascii	"\030*apdk\360\005\030\002"
+	.text
+	.section	.gnu.lto_.inline.cae45debf17b7c53,"e",@progbits
+	.string	"(\265/\375`\346\004U\017"
+	.string	"\206\326L? \217\222t"
+	.string	"\t\354L}p)c5(,\261\253\005\316j\357\r\034\340,\240$\245S\357\234\001\202\245\236\030\325\0065p.\001D\006\004\004 ,S>\302\020\252}\330\267\310\222\326\032\331r\247;"
+	.string	"8"
+	.string	"@"
+	.string	"\237\224\026\f\016\003\304\360Ii\321\370\266\2561#\372WI\237\205\373V\322'hf\346\354\356%)\211P\205\017\355\033\024\204\204\225\027N\177\001\275\336\347"
+	.ascii	"A+/'\036\317\261T\"\035\320\273\307\261\267"
+	.string	"\240*\231y1{vE:\235\036Bf\232<\373\022\347|\035d\343+\300\b.\237\0205!\223B\246\347\206\016-2\256u\215T\204\313'\324\236\0045\004(\370\025\230>Z\362\264\342\002\007\023\035o\374(\275\332l2xD*2k\214\340\211\314\244\316\320L\350A\304r\242\031#s\201\301Fm]\327\216\215i\353\302_\303:\310.E\246I\265t%\005o]\214\203j\233\262\313\313\020\224\005\344Q\271[\310M\244\243\321\210\205t[\310m\007\n\362\210P\334 K\027\244-%\356\001\240\027\240\367,\36130\021h\311\205\270\217>x\026I\250!A\247\320\310\005-(iac\f\220\"\2319S\017\022@\365$F\222\312\b\2142\002c\004%\376\253\231\230zc\226F\\\310 \275\036\032\233\207\2756Q\025\017\356!I\311\005\321\312d\034\364>\203\337\013n\t\201\3405\n\020\211\013\325\347\304\005u\343"
+	.ascii	"\274\315\2533\271>\r\365\307\246\356\314\201`W\220~\022\324\234"
+	.ascii	"\214\031ug\272Z2G\nJF\376\234\365\330]\020\235\270X\214\363\340"
+	.ascii	"\246j\261\237\234\032\335#e\037L\271e\323\031\375w\301\375\241"
+	.ascii	"\2329\243?\307\302\030\360\302\rz\242\347\022\375\2257\0026\357"
+	.ascii	"E\n2\f\306\225\245\345(R\020\003"
+	.text
+	.section	.gnu.lto_.jmpfuncs.cae45debf17b7c53,"e",@progbits
+	.string	"(\265/\375`\274\0025\b"
+	.string	"\302\214$'\200)I\00730\003k\302\301a$6m0\0033\026\324\3230\3406\242#X\326\177\204\376\207\375f\021!\233\310$\003\254\345\201\346Ja=i\253=}\211\377:H8\203\002\344\352\215\376 8\275a\300\356Fgp\020P\030\001vDRJ\351\253J\372\351\214\357\342("
+	.string	"\354z7\217\354x\263W_\241c\307\027\352\224\346\215\335i\005\275\202\372b\344\333\212x\320\201\270\003\365J\270\035O\227\035y\255\205\3272\311\253*\364\252wZ\210\337\020\201f\"0 \240\302:\233\007Q\f0\026 zh\316\031 M\356i\022\026n\3008\354\201\311\312\372\213p\261\334\205\017\336b\320\311\3050\3512\360{;\020!"
+	.string	"\344|\bX\2368-.\312\205\262\330p"
+	.string	"I\363r\261vq\034Ho*\216\221 \202\216\221\207\\22\205\303b\377\3325u\202\017c\306\005\372\203\346\225\2139\222\254h\333!-\320D\257"
+	.ascii	"C"
+	.text
+	.section	.gnu.lto_.pureconst.cae45debf17b7c53,"e",@progbits
+	.string	"(\265/\375 >\361\001"
+	.string	":"
+	.string	""
+	.string	""
+	.string	"\023"
+	.ascii	"\271\004\001\231\004\002\271\004\003\205\004\004\231\004\005"
+	.ascii	"\231\004\006\231\004\007\231\004\b\231\004\t\231\004\n\231\004"
+	.ascii	"\013\231\004\f\231\004\r\231\004\016\230\004\017\231\004\020"
+	.ascii	"\231\004\021\232\004\022\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.cae45debf17b7c53,"e",@progbits
+	.string	"(\265/\375`u\001U\006"
+	.string	"\022\007\030!pM\322\001\240\253\252\252\242\377s\365\377\377\237=\214 \b\212\323\005\013p\030A\020DD\032\331R\246\377\337\342\366X\236*\246\304\2048l\f\232B\206\200\031\\\004\226"
+	.string	"\240\322(\247\254\t\264\244<\362\225QDV.\225\277j<v;!Ho7\325\231sG\273\324\316\216\345\257\017\373f\\N5  \003\221\251\352=\322\001#\036\320\273\262\bf\004\254\337\b\260]\021<l\330\2036\\\224\006|f`?\322\n\005\204\033\0305\230\031\204=c\234\246\0063\203\260\2071V0v\2134bw\260\230\330\325`\032D\231\305"
+	.ascii	"E3\307\322\\#\261e\004\2050P\f5\224\364\342xj\253\305\002\343"
+	.ascii	"\r\356\\\026\322\324\020"
+	.text
+	.section	.gnu.lto_.lto.cae45debf17b7c53,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_serialPrint.12.cae45debf17b7c53,"e",@progbits
+	.string	"(\265/\375`\256\001\235\020"
+	.string	"\006\340oF\360\262&\035\222\312\231\377\r\016\2311\361\330<\002\n\320Q\025:\243R\030b\r\255Ur\263\246\236\332\356\257\214\274\277\002\225L8G\nc\3253\360\f\274\336\314V4\216#L\270\365;\376\035\220n\204\220M\244L)Z"
+	.string	"W"
+	.string	"^"
+	.ascii	"\273\241\002\217p\217\016?@{\344.\242=:e\013\025X\001\320\231"
+	.ascii	"\341\341\261\273\236\212p\226\251\307L3\345g3X \314c\266\255"
+	.ascii	"jJ\204\200\253l\004\033\002\372\353I\003\2522\353y\336\330`\235"
+	.ascii	"\260\271\376u\004(b,\320\346\271E\330]'\013\344pk\267=\301\366"
+	.ascii	"\003;3\277\350;7\267=\374\343\303[\265t\306\364\003\210B\210"
+	.ascii	"\344\330\255\211\371\330\240\bd\342;\277}\237\347=vg\226\267"
+	.ascii	"\260\201\226\212\335\355X\354\356\361\177\2713\003\007\251\357"
+	.ascii	"\264d\333\001\302\n\327\320n8\362\350\221\235\241\213P\203\247"
+	.ascii	"}\235\263H\335\365r\001\273\255\037\031\001\272\351_O\260#\266"
+	.ascii	"!\205*[\207\344U\244\356\324\035\210\225\302\230\016\203\002"
+	.ascii	"\267+S\342\277\260pR\321\036;%p\303\365\036_\270\013\025nwK\374"
+	.ascii	"\037\223\023?\347E{\004\321\017$z\2708\275\252\215\317\314\217"
+	.ascii	"\230\214\251O\215\025\250\212c\207\252\374h\004l\310\332\262"
+	.ascii	"\271t\267\245A\356\n\025J\371\255\240\324TB!\255\240PN\234K$"
+	.ascii	"&\244\323gBy\250\317\224\341\364I\360PN\244\023\257\364\241<"
+	.ascii	"\222\003N\301`\372\274\225\224\224\317\353\302\230k+\336\004"
+	.ascii	"\305\250**\216a\272\251\263\214\252J\343\267h\234^\307\013\207"
+	.ascii	"L\302\234\312i\362\314\374\360ch =\307w\321\036S\223\006\215"
+	.ascii	"\207\005\327# \240\202\221:\333\001\242\300\352\215\305\255\310"
+	.ascii	"QBz\373\245b\314g\232\rS2\330\352#\373rf\371\332\242U\310y\350"
+	.ascii	"3\246\246\0250\215\310\022\334\262\\p\270n\003\306\303\324\037"
+	.ascii	"\004G\023\206q\241\2275\"\200(\364Z\\Z\241ea\357\264\353\t"
+	.text
+	.section	.gnu.lto_serialGetBaudRate.13.cae45debf17b7c53,"e",@progbits
+	.string	"(\265/\375`1"
+	.string	"\r\b"
+	.string	"\222\21777Po\322\001\2408\211Y<\207\366]XZ\006\323\202D2U\203j\304bk\b9\007\203\266\214`3\203\020\202\252\212\210\224\240\026\257\365j\343!f\274\303n\262wJ\001V\205Q\035\r\273\244+N\003uQK\233\032\265 .\3120\261\213r\230\025\325&\247\300\331\203Eg'\313\350\314\324\275!\324\200 \205\355\210\2238\271\273\n~\310\204\204\334x\364=\0203\002\275\222]?\017b\330\237\026\212\f_\3777aT\006Rv-J-\213\022M8lov\306\366{\366G\377\330^=\017\330\025\235\224\354\326\003\033\310GWi\333\357\270\307fn\252\032]\302H\205\b\313n\235\232\023\\\036\247\013\\\036a\306\271?\316?\3107\244\225P\367\371\003X\330]\277Pwq\303\333\336\330F\260M\022\f"
+	.ascii	"2\003\302\260\2268\3742\203\027c\273kx\306\004\016i\214\006L"
+	.ascii	"\020p\242G\265\322\021&\031"
+	.text
+	.section	.gnu.lto_serialWrite.14.cae45debf17b7c53,"e",@progbits
+	.string	"(\265/\375`\217"
+	.string	"U\n"
+	.string	"V\224H= \3458\035'\027\003,\341\006D\356\002\217\262\3008\315\021m\242T\254D\202\332\006\343;\321\353\247xi\345^\216o@\311\n@\b\024\240\241F\375"
+	.string	"\212\313\344\036\224\224n\306m\345N)5"
+	.string	"5"
+	.string	"9"
+	.string	"\273#\307\020\331\247\307o\260\317\354\b\330\247E{\200\302\311"
+	.string	""
+	.string	"\312\205\300\356nJr\361R\364\277\362\202\224\252tI@\261\273\226)U\310\255\267\355`\333c\377!\376\370cg\375S\245uJK\215\3643\255\265\231\331\005y\031X\327\2249\261}\315\266J;bB\374\310a\335\025\021 qi?\345*\342Y\244\037\354\256`b\002'-\031SU\016\352\300\305_@\331\356\207\307ou|#\354SjB"
+	.string	"k\274e\224\355\256\307g\021\205Y\t\t\373\2742\230\024`\231\344\313\036KRG\354kvw\255+\007\026\234\354\270\320G\024\206\274\314\\\007\343\343\201]\270\205`\267\341\201\025[\310\373\2006\016\f\267\316\202\277\214\016\334D\337\007n\332\270\327\254\256<Q\\&\365\260&U\247Z\252\033\002\016"
+	.ascii	"2\241O\034X\\p\300PJmn\351\254\322\342\316CX\351\032\020\025"
+	.ascii	"\006\203\271\001*J\270\303\213v\222\001"
+	.text
+	.section	.gnu.lto_serialWriteBuf.15.cae45debf17b7c53,"e",@progbits
+	.string	"(\265/\375`\204\001\275\017"
+	.string	"\366\335jF"
+	.string	"\221(\035\277:8\210[\212\204\377\016 \375\237(\376\007n\223\230e\340\337\221\215\246\365W \374n\326\032\022\242\364Y\351\321~\345\231\230\271\264W\004v\307\317\004"
+	.string	"\026\201\235\330\227\223t\f\341[\244\222\275\345N)U"
+	.string	"U"
+	.string	"W"
+	.string	"13\273\341\210E\270O\207/\260}r\007\331>\r\3325\020l\b\020\243\003\r\307\356vZ\002\004\025\374\224\032A\377\264wZ\257\324'\267r\351y\255\\%\b\213\013\033\217\027K.\260A!\342\264G\327k\025#"
+	.ascii	"\320\356:\266^!\356\355\266%\330\006\331\267\t?\367\332=?\273"
+	.ascii	"\345\214\2162"
+	.string	"\372\002\006\274\030\250\355\202\310\311\2615\023\206\313k\267\377\342\303\324R@+\017\020ph\330\330\rE>\355\200\373\374\307\266\262\270\f\374\3144\362cY$>\314\354\356\210\033p\237\td\fSr0x\264\257\342+\300\307TN`\027\026\237\350\321\216r\352\250\366hj8h\352c\304\016\231\236\264E\235 \233\301\2128\266+\\\206\304\355\262J\374\027\032L(\333g\324\020\031\276\360\030\024nwK\374\026\245\023gBe\373\274*Hq\023S\305\034;\\Em\261\177\200E\307\r+\314\376\354\367<\374;\217\005'G\2250\230D3\204\n\231HOT\n\241N\245\021g\021\211\205\320\350\363N\335\351\3632\214>\223\2564\n\221:\321w\352HBl:\361\276\016e2}\335'T]a\264?\270\251Q\351jj\213\017\363\b'dbG\247\272,\243G\245\272l\017{\024\342[\3364\365\r'\307E\006\036"
+	.ascii	"1\003\367\334Q\343\340\033_\031E\321\004\361\020u\026\372\337"
+	.ascii	"XK\316,\247\024\344\226\342\276\254\335Yc+\264\264\321\255M*"
+	.ascii	"B9\210\001\314\351\200\rh\242\004|A!\270\f\214\bPQ\304]\336\331"
+	.ascii	"dS\230k\264\n\n"
+	.text
+	.section	.gnu.lto_serialRxBytesWaiting.16.cae45debf17b7c53,"e",@progbits
+	.string	"(\265/\375`q"
+	.string	"\215\t"
+	.string	"V\222B:0\345(\035\236\213\247\302C)\301\244\034\326\275\322\031X\364\310?\022\005\233Jfk\246\377\370l4\210\301l\024\304f\302\300@\023\b\217}\2702\354 \324B\364\223\277\367\336;\2452"
+	.string	"0"
+	.string	"2"
+	.string	"6\305J\262z\030\300\361\022`\267R\316\013\346e<\301\274\204#7\375\231\374\263<\242\200\270T\253\323\237Fbw\375T+\217\033\336\266\202m\007\373\002\0011>?\370|M\303\307\301k\267\343%`g\244\314\211\355\222\275\261\375\236\375\326WJ\257\244\017\354\262"
+	.string	"\304\354V\006/`\227\256\230m?\345*\245!)x\262Mq\027\bFc\313\230\227\017&\370\342.\035\266\233\202\360[F\030\230\311\245O\232\227\207\006%-\324{\331\365\364\240\210\375\270\220\345\371\372\007\331'\344\021u!\r\363\247S\341\321\270\254\243\035\227\2154n\202\2064\017\210~\270\216v\020\274Yd\034\025m\033G7u\357\t9(\270\341\315\213\320\017N\030\021\016"
+	.ascii	"2\003\302\260\004\346f\220\035\330\233\322\\q\3062\327p\221\t"
+	.ascii	"\034\250\361*0\361\340n\217j\305$L2"
+	.text
+	.section	.gnu.lto_serialTxBytesFree.17.cae45debf17b7c53,"e",@progbits
+	.string	"(\265/\375`s"
+	.string	"\255\t"
+	.string	"v\222C<0\345(\035\200\213\307V\035\376\266\213:x3\367W:\003\213\036\371\027a`M%Z\264\372\373\\c\rb0\033\005\261\23100\320\004\242N\213R\026%\340\324\263\034i{\357\275S\n2"
+	.string	"1"
+	.string	"1"
+	.string	"\246XIV\323\305\261\341B`\267R\316\r\346e|\301\274\204#7\375\231\374\263<\242|\fP\255N\177\232\210\335\365S\255<nx\333\013\266\035\354\017\004\317\017>_3A"
+	.string	" \004\330\355x\025\330\031)sb\273dol\277g\277\365\225\322+\351\004\273,\0011\273\265\301\f\330\245+f\333O\271J\311\001\360d{\3420\240\227\214\rc^>\250`\213\267t\330n\352\301w\215.0\223K\2374/\017\017JZ\250\367\262\353\351A\021\373q!\313\363\365\2171\331'\344\021u!\r\363\247C\341\321\270\254\243\035\227\2154N\202\2064\017\210~\270\216v\022\274Ud\034\025m\033G7u\357\t9(\250\341\315\213\320\017N\b\021\222\n\016"
+	.ascii	"2\003\302\260\004\346f\220\035\330\233\322\\u\3062\327p\222\t"
+	.ascii	"\254\250\361:0\361\340\256\221j\305$L2"
+	.text
+	.section	.gnu.lto_serialRead.18.cae45debf17b7c53,"e",@progbits
+	.string	"(\265/\375`e"
+	.string	"u\t"
+	.string	"\346\322C:0\345(\035\200\213'\205hR\300.O\036\"\256\231\016\033\033\356I\312u\364\327\252\325\337\357\265\330 \006\343\025\304f\302\300@\023\330\270\023\363e9\232\204\271\352\311\337\233l\231R2"
+	.string	"1"
+	.string	"2"
+	.string	"\332\007\346\245m7<\230|z\030\302\232\036\033\0310"
+	.string	"\273\341\026A~\272\236\374\247<3\341\210Y\265PWM\304\356ZW-\215;\336\266\202m\007\373\016\236\177\375Y\246\326\250\276f\226\314\030\270\354\262b\001VF\302\220\3306\331\033\333\252\366O\216b\372\253t\201]W\313\313n\310\340\005\355\322\341\t\346e(\333\240\303<mW\325\361Y.*H\363R#\202\301\257\220\264\335\355\370*#\013m\344\322/\315\313\307\002\221WJcv\210\322\370a?\333\335ut\005\334'\344\021\201\241N\363\2073\341\351>\016\334\300\217\033u\237\304\026\352<\240\355\363\201\033\347\300\036\005\367m\"\317\373\266M\270\367\214\t\251\210\341"
+	.string	"\315\2425\316\b\321\241\212\001\n"
+	.ascii	"2\003\302\260\013\314%`oJse\031\313\270\214R\324x\250\016aL\327"
+	.ascii	"$\003"
+	.text
+	.section	.gnu.lto_serialSetBaudRate.19.cae45debf17b7c53,"e",@progbits
+	.string	"(\265/\375`\232"
+	.string	"\265\n"
+	.string	"\266\024KA0\251(\035\210.\177\006)\245g"
+	.string	"\355!Y\366\256\3053\030:\354\250S.\\\305\306r\036\304o8\213\354\332O\216\321>\002\3206A%\025fB.\024\257\270j\345W\022\332\177t\177\262\311\336)\0055"
+	.string	"8"
+	.string	"9"
+	.string	"a\205)\350\247\303;d\237\364\r\331\247A[\302C\002\373\324\t\211\212\302\356V9\340\340#\350?\365\n\251$z\244`\354\256#\251dr\313\333\236\260}a\277\006G\375\363\247\037\303\242\243\214>%[A\200\230\260[\362\252\260\255\371\300\200\355[l\307\360\t\300\243>\\\331\r\340\262\240\237\022\330\243\375\003G"
+	.string	"\376\024:\303\256\251\301j7\322\026"
+	.string	"#Rd{s\006\035\335\025\301\370\013@<@\331g\224\017\021\374]\001\210\356.\306W}<\264@(\373\274\224,\007\256\323(\276\354P\024\245"
+	.string	"\373\330\356\256\245\311\016[G\323\320x\264\r\272e8Z\347\343p\324\231\013\207\306y\333W?o\373p\236\246r8mS3\336W/\021\356:6\257v\272\316\253\226p\217\25549\203\325\032\311\020/\304)1\351\030\017"
+	.ascii	"2\241;\034\030\270P\224\332\021\323\001Y\013\241`B0\327\330b"
+	.ascii	"\230\027\204\317\324(\270,M\215\006wy\321N2"
+	.text
+	.section	.gnu.lto_isSerialTransmitBufferEmpty.20.cae45debf17b7c53,"e",@progbits
+	.string	"(\265/\375`e"
+	.string	"m\t"
+	.string	"vRC<0\345(\035\200\213\007\323\253\007\315\321\245\024\213:\334T\310\245c\303\375\2502\345\020\215\355\365\037\237\215\0061\230\215\202\330L\030\030h\002\2059\017W\006J\302\351\t\217\264\275\311\226)\0051"
+	.string	"1"
+	.string	"1"
+	.string	"\004\362\321\266\035 H.\375#Q=\304\244\303E`\367\233p\344\245k\311?\313\261\224\017\001\251\225\351\252\231\330]kj\345q\303\333^\260\375`\337\001?\206\251\025\252\257\2212\001\016fvU\257\002\013 \306\240\330&\331\033\333\252\366U\276Bzk\364\201]\326"
+	.string	"\230\335\257\301\f\331\243\277\027\310\307\354\001\320d\273\342\256\317\313\006\247!\037\025&\030\343.^\266\213\212\360[D\031\331\311\243?\222\217\207\006%\255\223\276\354\317\244P\304>\266\273k\310\262|+\232\007\324\ty\240-\263\207c\321\331:\315\233^\247\211\266\216b\202\266\316gz:or\020\314]h\335\fq\\77\337\336\022*\234 \2077\212A+\224P\002\004\025\013"
+	.ascii	"2\003\302\260\004\346f\220\035\330\233\322\\Y\3062.\243\0245"
+	.ascii	"\036\252C\030\3235\311"
+	.text
+	.section	.gnu.lto_serialSetMode.21.cae45debf17b7c53,"e",@progbits
+	.string	"(\265/\375`\226"
+	.string	"u\n"
+	.string	"v\024I=0\345(\035"
+	.string	"\276\334{z\271\224S\200\234p\251oQSj\270A\374\022\2066\260&\2525\334\3077\335 \006\343\025\224\354\206\201\001\f\264\026\322\242E\232\314\350\b\035O\032\331d\357\224\0024"
+	.string	"7"
+	.string	"8"
+	.string	"\f^\340N=\276`;\345N\260\235Z\264c>\206\354a-\215X\200\335\255\023\344\342\245\350\037\366\215j\205\272\324<\354\256\245j\305q\317\333V\260\355`\277\006?\275\353\3274i9\245\257\331f^\016Nv7f\003VF[Z\266\317\261-\307\227\210\177Ux\263\353!\323\300\235&h\227\366GN\"\336u\372\300.Keew\f\035\031\023e[\364\224\217\333\305\360\370(\026\023\246\355TN\003\030\20771q\273\353\361c%\nN\344\264\235~N\026\027\001\256\224\234\331#J\316\017\373\332\356\256'\313\376+]\350\023i\035h\364!\205#\2173\250\023\361\361\300.\254!\330\225<0TG\336GTA`X;\b\376$:\260\222\276\017\254\234q\257\355d\031\002\200,5/, \351\324\246\3454'\017"
+	.ascii	"2\241;\034\030\270P\224\332\021\323\001Y\013\241`B0\327\330b"
+	.ascii	"\230\027\204\317\324(\270,M\215\006wy\321N2"
+	.text
+	.section	.gnu.lto_serialSetCtrlLineStateCb.22.cae45debf17b7c53,"e",@progbits
+	.string	"(\265/\375`\n\001\265\f"
+	.string	"F\327TA\020q\233\016\030\0020}_\354I\200\374\301\3030\205\316.)\200\003\356'B\340\257\215@\251\321\210L\017\371\335Q\0247\362\265]T\"\240"
+	.string	"\n-\310\0330\347"
+	.string	"\200/\036E\361\177O\2156\2212\245?"
+	.string	"B"
+	.string	"@"
+	.string	"\323\243;;\307A\023\3730E\303\312\216\335\265\264\304\273K\232\235\377\360\227\222\017t\t\304U\312\230\300\030\t\370<i\301\be\304\303'\207\217$\223\342\354\256\263\344\363p\307\333v`\233c\377\023\237\036\372cL\247\224\376\205\nQ\343\200\216\335\016-=V\024g\240\260}\214mU1\016\226\006\t^00`\275p\303\346i?\345+\272\207DN`\367\204F\214]\220\201\025T\217\006_`z\254\236\tS*H\310\342%\017\333\021\376\302S\355z\033\337\005\206\3543=\246&\270a\ng\361\251vw\343\257p[uBdz\274\306\0246T\204F\262\305\006A\251$\354K\273\273\326\023\373*?u\360\001\234\005\214\013\311.\n\344JN\313\036"
+	.string	"\360\245\221\360\321\321\260\315\3324\254BG\203`\205t><\326\245m\226\006\201\263\t\230fqY\246Y\030p/B4\242$\022&)\2354\252S\035\240\305\007Q\006\005\345\b\305D\206\332\023\032"
+	.ascii	"j\231\"34\030\271Y\200\330\rJ1\313\032\325,\b\214#\304\"\023"
+	.ascii	"\206R;b:@n!pL\b\353\032\233\016\343yU\016\\\001s 0P\"\030\021"
+	.ascii	"\240\242\210\273<U\223S4\265\007"
+	.text
+	.section	.gnu.lto_serialSetBaudRateCb.23.cae45debf17b7c53,"e",@progbits
+	.string	"(\265/\375`\t\001\255\f"
+	.string	"\366VTB\020q\233\016\3600"
+	.string	"\027\344\222\037Tp\315\223\212\036[\271\323E\262\360\222H\313\013\262\262\231(\320\353\3459cQ\0247X\316.*\021P"
+	.string	"\205\026\364\034\2160"
+	.string	"\240+\017qf|\373n\264\211\224)\005?"
+	.string	"B"
+	.string	"?"
+	.string	"\217\356\354\031\007;\354\303\025\025Zj\354\256\245\034\336]\322\354\374\207\307\240|\240K\031\256\322&E\305\b\300\347I\007F+\032\036>-|'\231\324\307\356:Q>\fw\274m\005\266?\354\223\004\007\377\351\241?J\351\324\3641\224\b\030\034\032\273\027^r\254(\272\370\240\261}\226\017\201"
+	.string	"\353\205.\t\022\224\200\243\363\264O\342%\272\207>\027\260\253\362\202\305.\210\300\006\252G\203\0370=V\337L\001\316\246\324\220P\206\2277l\213<EV\355z\035\037\305\204\007%\323cj\201\030\336n\242\244\332\335\216\337\302A\250<|\246\307k\004\341b#d\222/6\bJ\335`_\332\335\265\252\330g\371\251\\\004\214\033\311.*\344JN\313\026d|y4"
+	.string	"\361h\330fm\032F\342\321\030X#\036\020\021\353\3226\313\203\343\314\001\246Y\\\226i\226\006\334\217\020\231\350\211\224IJ'\215\352Tw\234\b!\242\240\240\034\255\244\264\320\033"
+	.string	"j\231\"34\030\271Y"
+	.ascii	"\330\rJ1\313\032\325,\b\214#\304\"\023\206R;b: n!lL\b\007f]a"
+	.ascii	"\315a<P\"\030\001\341\202Bp\031\030\021\240\242\210\273<U\223"
+	.ascii	"S4\265\007"
+	.text
+	.section	.gnu.lto_serialWriteBufShim.24.cae45debf17b7c53,"e",@progbits
+	.string	"(\265/\375`p"
+	.string	"}\t"
+	.string	"v\022B:@\3056\035\340\005]\363\317@\327\022\3202\307\277#\t&}D\277\200\321\215y/9GS\3428F)\245\300\245\2048\216\202\373\312\235\0175}\031\340\027\214?n#m\313\235R."
+	.string	"2"
+	.string	"/"
+	.string	"7\250NY/\250N9\264\005|\f\331\203V6D\246\335\275\024\344\341e\350_t\001\261\303\271\264<\354\256\245\330\351\270\365\266\025l;\330\327\024I\304\366/\266\325\344\240\360!\253\314\201\315\360\020G\273\213q\203u*a\312\321\302\304pi\177\344$\341?\016p\202]O\311hw\304x\301:\3451\212\341JNU\225jo*\344E\313\023\224\222\206r\354\221#\365\303\376\334\335\265z\354\207\376\371\361\327\177~YYH"
+	.string	"\020N\273\034\247\001[\n \267\3512\n\0031\315\3242\016\003?n\263\234e\"\260\315\323\276\353\3634\212\315\323\\\334\206I\\\231\367]\231\003w\023\232w\201]\347]\227q?W=\206H)]\004\016"
+	.ascii	"2\241\017h\340\341\302\033\327\200\001\033\235\022b\300\225%"
+	.ascii	"\214\013T!\270\f\214PPQ\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_serialBeginWrite.25.cae45debf17b7c53,"e",@progbits
+	.string	"(\265/\375`\264"
+	.string	"E\013"
+	.string	"6\025NB\020mj:(<\202\360|\211\005\370\f4\316\345\241a2p\224.c:\257~\273\247K6?\203L\027^\374!Asz\353\034<"
+	.string	""
+	.string	"p\005\024"
+	.string	"p\210p\036"
+	.string	"\f\004\213\302AD\310\322&[\246\024:"
+	.string	"8"
+	.string	";"
+	.string	"\037\035\354S#\016\250L\354\256&\033\034\374%\025\364\217\272D$~~-\270\274(\243\013,\0131\2746X&\006G]\021\210!\325\210\307\356ZE\242\202{\336\366\207\355\016\373\226kI\262\177\372\247T\253\252\037\211t\370\220\001b7A+\305\256\346\006\b\023\333W\373\021.\001\374\311\363\213]\022\206\f\273#\2075\262O\217\307\300>\263S\260O\2036\211\336`*AR\"BEa\273\273j\223\355\206\027\277\202\201\257\203}\252\254\204\360\200S\350d\273{\361'p\nd\017>}\017\366y9\305\022'N m\331\343Ge\311\376\265\273\001[F\203\341|\032.s\306\002"
+	.string	"\303y\333\247}\336F\200\363B4\r\207\t\240e\274O\263T\334\t\330<\215\323u\2366\031\367\036V \031\272$:\245U\272\302\002\207U(?\3122\2154HY\262\003\021"
+	.ascii	"2\003\302\360\314\302\242mP\210YVh\253q\310\034c\002VjGL\007"
+	.ascii	"l\231 \nF]\302jV\243\305]\236\252\311)\232\332\003"
+	.text
+	.section	.gnu.lto_serialEndWrite.26.cae45debf17b7c53,"e",@progbits
+	.string	"(\265/\375`\264"
+	.string	"-\013"
+	.string	"6UM@ M5\035\334\332\006\210\001MZ\004O\020\\4w\002\0031'L\344\022\314[\007\302/\002\205>\215\323\243\215\025\003\001\022\023\020\220\310\302\265\234\347\2064\377\f\350\253|`=>\267\245M\266L):"
+	.string	"8"
+	.string	":"
+	.string	"\037#\354O+\005(\022\273\253I\b\007\177I\005\375\233\016\001\211\235_\016./Ih\203\252B\f/\r\025\351\301M\327\005\342G\365\321\261\273V\220\330\340\236\267\r\3006\207}Jk)\262_\372\247T\253\252\377x\260@`|\330e\3202\261\251\351aB\304\366\325>\205W"
+	.string	"_\342\334bW\244\201\303\356\270\341\214\354\323\343/\260\317\354\022\354\323\240=\"\316`*\003\234D\204\312\262\335\035\225\311v\303\212\217!\301\267\301>UNB\330\300/l\262\335\255\370\0264\b2\t\237>\007\373\274\234\342\211U\311\243-{\354\250\034\331\277v7\333\005c\321|\030.\363\2052\300\302y\333\247}\336v\200\363\004h\030\316B@\273x\237F\231\270+\260y\232\246\353<-2\356K\244<\362sAtJ\2534E\206U*\224\035U\221B\035\244\034\331\001\021"
+	.ascii	"2\003\302\360\314\302\242mP\210YVh\253q\310\034c\002VjGL\007"
+	.ascii	"l\231 \nF]\302jV\243\305]\236\252\311)\232\332\003"
+	.text
+	.section	.gnu.lto_serialSetRxSpanCallback.27.cae45debf17b7c53,"e",@progbits
+	.string	"(\265/\375`V"
+	.string	"U\t"
+	.string	"\226\021B= \005)\035 \027\003,\310\022\313"
+	.string	"\026\t\250\251K\326!\026\252\374GD\213\223\330\2755lW\262lm\232\264\3210\211\360\202A0\037\201JA;\246B\201s\017\237.6#m\357\224\002."
+	.string	"2"
+	.string	"0"
+	.string	"\317\264\033t\2369\264\001\274\242\354]1\220\227"
+	.string	"\273;\345\311\303\307\320\277\313\005T+\324\243\007bw\035U+\221[\336\266\202\355\b\3336\001\255?f\003#4\0130\273!\261\001\013\313dVl\377c;V\023\002\301~\270R\034\036\355\263\274%|\353\364\202]\326L\314nm0\203\366\314\365\007\235\234\225,O\220\300R\322\303R\332\032\177\231\264\335}\360]\035\034\240\033\225S\347\231\247\346%\240$\025cvEEib\237\263\273k\311\262_\177\371\027\334V!\022m\022\337F\242\330\240\240\216\373\266\022\370y\232\271\220h\363h\007N\220v\031\036\265\230\237\267aL\216\2023\224\340\021\251\243\2634\032\321\371\251\373\f"
+	.ascii	"2C'\025\030<|hq\275!,\273F\261\302x\240D0\"@E\001wy\321N2"
+	.text
+	.section	.gnu.lto_serialReceiveSpan.28.cae45debf17b7c53,"e",@progbits
+	.string	"(\265/\375`\021\002\315\021"
+	.string	"\226\241vG\340\360&\035\330F|\253\341\360\322\007\203\340h6n\037*$\216OM\231\373\0323\241\217\005\030R\323\206G/'\020C\313\255\345>.\022\r\f\270\205\3040\214#\037\332Hg\033\312er\3515\315vv#{\313\235R`"
+	.string	"b"
+	.string	"c"
+	.ascii	"D\265\206\006\034B?\035^\200\366I\377\241}\032f'=\304\251\007"
+	.ascii	"\212q\001\252Qk\335\326\003,\302\256M\271\021\346_v\216\0270"
+	.ascii	"v\315t\346\363\263G\f\340\005\024h!\312\0238\363\225\0374CG\035"
+	.ascii	"`\213,p$\202\303e\2170 K\214\246\221Z\253\343\013(s\233n\333"
+	.ascii	"\304\366\002;\222\004\177\352\341\217\372\317\177z\317O/tOS\264"
+	.ascii	"\324\242wF\277\343\244\323\202\300\214Z3,\335\250F\263\b\304"
+	.ascii	"\205n\377\204?\023J\2411\r\024\305\013\032\032\265\206!\237&"
+	.ascii	"\241\237G\331\226A\023H\214\254\211\373\300\376\223\"\003\324"
+	.ascii	"\226\0165\n\350'\210\214!\205\245\003\217\366y>\002\366\036\225"
+	.ascii	"{\324j\243\"4f\247\311\255\240zQ'\327\2642\224c\"\235\0220d*"
+	.ascii	"\356\246"
+	.string	"\366\264\250\365\327 .\033\263\355\235\3102RH\227!\355\256\214\314\306wX$)\355\336\370+\355\373\300'FKT\262\035\341)V\264\326\212\300\037b\265\350\007\025\355\363;ed9=+q\311\016cqo\354\307\230\r!\\xm\354\007\005\336]\r\272\225\307\340\204C\361\276\217\003`\362\202\300\352N4\356\305\225\310N\305\342^.\226G\255\0229\341\274\257sm\256\257C\361\276\222\215\345q\253M\365\2716\221\001nI\350\276\355\325j}\033*\254_\033\331\351l\307heY\264\275\361g\347\340YQ#\375\024m.\214\355\021\351\332\016\270\370\027k\033{\002\034\245) \260\202\221\261\353\"\001\277\306\330\3228\013\332F\225)\306V[t\b5\030@.V\201\371u\006e\020\312E\301\342b\347W\261\313\337l@L\023m\230\352\005\222Q\343\270\032\205\240\313\034I\214\313\341\263\243\274La\b\205_\326\210"
+	.ascii	"\217\022z$\326\244\344\215\273\3756]C\310P"
+	.text
+	.section	.gnu.lto_serialWriteBuf.part.0.32.cae45debf17b7c53,"e",@progbits
+	.string	"(\265/\375`\345\003=\033"
+	.string	"\2462\256H\260XQ:\320\001\030O!0$2\305U$%;@\002\305Z>\034\371\207\332\242,\024Q\343\023v[Z\\OI|\365\301\016\230\217\352Xh]h\275qc(R\271\013\374\203\303\370\364\214\003\330[k\204\220M\344N)\223"
+	.string	"\237"
+	.string	"\224"
+	.ascii	"Hl\213\304f\306\301\234\367\335n\004\350\306W_\020yN\373E\236"
+	.ascii	"\204\273\021\240\003\250\325hI\260V_\316\251[\345\251}'0\236"
+	.ascii	"\226\0270\236\332\037b\373f\207\271OG%2\316\016s\263cA\r%!Sk"
+	.ascii	"u\235n\016\257\311\341p8\274\350\273\307\305\235\034\251\270"
+	.ascii	"\263\304\371\007>\305\242\027tr(7G\325\217\030\2476?`\\\024\311"
+	.ascii	"\235\213\0365\275\235\030A\030\325\364\340'\257\247\233+\340"
+	.ascii	"\263\300K\262B\255\325\317\311\270S\267}\303\366\005{\305\004"
+	.ascii	"\363\276\377\003\256\200F\255.\206fj\021m\362q\246S\261\fGg\303"
+	.ascii	"B\207\004\025Uu\276\226\355c\331\211\006\254P\372\361\\\247\207"
+	.ascii	"\362\265\357K\371\223\317\2378'\210\020\037{\305\344N?\177\342"
+	.ascii	"GA@\344P\334\340\301\355M4\234 \233*\364\005\252\301\203\237"
+	.ascii	"7\321n&D\231b\241<\365\231\276\304\017\336I\023\333l\001}'Ml"
+	.ascii	"\025\204Vd\020~\211\252\325\327:5\205\362g\372\300\233\275ZY"
+	.ascii	"\234_\272\371j\217\310b\222+\341\256\304N\242M\325\341h\021\254"
+	.ascii	"\265J(Oq\304\235\377\005<\246$\215K\356\301\f\235\361\263\324"
+	.ascii	":\370H\276m<\0357\025\204\2117#7\207t\225H\331\365D\313Fq\037"
+	.ascii	"|\200,C~^tSh\002\363\353]q%\024\3516\310\303\261|\200B\001\242"
+	.ascii	"g<\335M\260\343O\016q+\"\312Zu\020\374*)^>\022l<\235\373\247"
+	.ascii	"/8\242T&)7\207\336\213\265\326\272{\344}\004\035\302\250\271"
+	.ascii	"F\336r\024\016}x\215\354\377\376\232/\3754\254\325\227n\025\315"
+	.ascii	"t*5]\212\323$kz\244\253iQ5\275\251\351$`\323\304k\261\037\031"
+	.ascii	"\214\276"
+	.string	"j\257\021\342\016,\366\252\321b<\245a:%^<\263\035\232\2136\3339\3013\033\341\212\361\274z\\\260\031\315\245s\3002\023;3WM&\233\271V\266\347\327\bx\fe\260\344V\210\334#\223T\312\032\027\220\262\226.\317bI\2634B\272Z\325\362ZW\355\034\363\273\262\247\200Chc\334#\333\fN\227\265\244\026\025@t\256\332U\316\030.*j\b\315\241\rLr\277N\255WE\273\r\322\360.\033b R[\300\213\223C|KOYk\205\340kI\301\001h\357\364\007Q\250Q4\246\034\"\304\231\t$\222\231\031\247\003p\002\231\272\272\r\020hH6\035k\372\201P\002\207]\364A\311\\M\212TV\234\300\217\n(0\nF\267\210\265_\222\007\303\002\22784\320\240 \276\231c\220\240mZ<\201F\335cA\3420H\2773.\323\202\t#\326\003k\031\326\030\220P\037E\211\242l\201\220N"
+	.string	"\225\237"
+	.string	"\224.E\203KA\264D\b4\322\342\322,\357\327\214\304W\204\210/%\316d\360\025{Q\210\374t\221\224\330\234"
+	.string	"\317;\345qx\277p\003\302+\032\215\016\266y\326ku\206v"
+	.ascii	"\323<5b+P\001"
+	.text
+	.section	.gnu.lto_serialReceiveSpan.part.0.33.cae45debf17b7c53,"e",@progbits
+	.string	"(\265/\375`\252\002\215\024"
+	.string	"Fg\205H\340\360&\035:\r0\007c:P\246w\355\217\364I\261\364\271\223\214\236^\213\317\346\nm\220{\252\233\277au\313\317\b\277\t\201_\304\310\330\201q\013\231@\020\216\334 c+B\203\323|\261\323Y\326\214X\262\267\334)\005m"
+	.string	"t"
+	.string	"l"
+	.string	"\376\211\367\314\356\343\362"
+	.ascii	"\265\342\034%\325*\"85\210wj\361\003\272S\357\036\335\251}\036"
+	.ascii	"\3332"
+	.string	"\033\317\354\030\027u\352\203&\314\004\315\250\265\256N\267\2039\306q\034?\305{\345\354s%\235\371\277\035%\301\366\3629O15\0376l\265)\222k\302\035wIc\243\311M\205\250p\351qz\032\251\265\332\263pw\267mb\333\201-_\004\235\264\274\370\237C\300\001\023\265\326\2144\252\006\212\003q\245\337\350\322\276\257\364#\037\227\204\024\363G\215\310OB\212y/6^\221\013\fM\r\274\323\373D2\377f\225\355\033\025\255H\006\225v\001\344\324\264h\305g\304;Uy\312\017\311\304j\233AG1\273Plv\324\032\207\233\005\336\351\307\\y\240\237\226\375i\031\023HyQv\037\027\002b\245`c)\035\376\210\331\027{\213\3323\315\324\370\n\225\317\337\361[\3664\031\350v{\332\313\210\200\221\243\347\322\2352fj\260\276d\246\335\r\030v\353*J\274Z\253\002?E\004\320\3379\365]\272S\271\307\335"
+	.ascii	"\356F\242\207&G\357Wh)\306&7\307KEtrM^\034\373C\277*\225\222"
+	.ascii	"F\241\244\275\225>\035\350\357<iz\245{\236\2447\340_\020Z(\340"
+	.ascii	"\203\223\217\005\f\303\017\200\t\254\304\325:\351>\330G2[,\327"
+	.ascii	"\007{\271@\317\254\220\223\017\f[\257\325+l\261\200!\311\312"
+	.ascii	"\005~(+V\370Z\205\024p\212J+\\\301RR\302\225\374\355\036\021"
+	.ascii	"O\013\332\302x\347\346\230\346\250\037\353T%dj\347\322\330\266"
+	.ascii	"j\347\312\r@,j2\347\375\254\265\326\335\234\307\272\271\251\375"
+	.ascii	"\b\017H27\035r\027\265\226\0336 \220\002\231\252\353\006m\206"
+	.ascii	"\370\035\203,\0203\3379u\351\246\375\205W\223\230 \024\t\222"
+	.ascii	"\027\230\300\240C\232\024\263\001\013\333\237\"\2755\r1%\225"
+	.ascii	"b\013i\f\330\250\221;\007\016|(\333\005#\276\253.\275\242\215"
+	.ascii	"\rz\t\2760\340\361x\"\263\303\\\f\177\207\264\313\370F6\243\233"
+	.ascii	"U\255+\240\233\037$u\207V\026L\311\253\331\2405\350n^\331\007"
+	.ascii	"\232\353\213~\227\031\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.cae45debf17b7c53,"e",@progbits
+	.string	"(\265/\375`\215\0015\b"
+	.string	"\024\013\211\002"
+	.string	""
+	.string	""
+	.string	"\002 \177.\257\377\372\006\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\204\202\202\200 !\177/\360\372\2508\f\1770\272\200\202\r\1771\200\200\200\200\004\016\1772\017\1773\362\375\231\027\020\1774\021\1775\022\1776\023\1777\024\1778\025\1779\026\177:\027\177;\030\177<\031\177=\032\177>\033\177?\034\177@\343\260\230\214\002\004"
+	.string	"\265\006\004"
+	.string	"u\004\001\221\205\327\307\003\001\365\001\004\002\225\001\004\004\225\001\003\005"
+	.string	"\342\001\004\005\303\376\236\020\006u\004\007\b\t\n\013\f\321\231\263\346\002\r\003\016\005\"\004\017\004\020\003\022\001\202\006\004\022\372\356\335\273\001\001\225\001"
+	.ascii	"' \020#\"\252\003\257\025\243'\370H\006\3271=\335A(\344\022\006"
+	.ascii	"\"\004\271\00627\027`p\375\\\rt\020=\343\353w\b\254\013\357\370"
+	.ascii	"o\374\306o\374\306o\374\306o\3147\3667\362\r\3217\364\r\0311"
+	.ascii	"\377\263%\2401q\3065r\343\334\314\326\030\003"
+	.text
+	.section	.gnu.lto_.refs.cae45debf17b7c53,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.cae45debf17b7c53,"e",@progbits
+	.string	"(\265/\375`\037 m\204"
+	.ascii	"z\320\240-Q0\022\322I\007\367\275\263Bx-2\267\224h\265\263\333"
+	.ascii	"\313\227O\024\335\225\305,6\267GUU\235gU\232\004\343\201\334"
+	.ascii	"\335ZD\250A\327\020\374\244\037d\327qx\377\007\367\274\240\252"
+	.ascii	"\264\252j\250\210\021c.\211\260\246\346\212\313\317\211\322M"
+	.ascii	"o\"e\nW\002\277\002\340\002g:>s\034\344z\327\366\372\273\362"
+	.ascii	"l\373\303\"\202\315\203z>\021L\003\003\371D\360y\277s\353\322"
+	.ascii	"\212k\373!\225\0021q<j\234\362\374\302\234\343z\264"
+	.string	"\262\254q\266e0tK^\210\264\345-\374\245\357\207\022\230/p)\023%\325\321\333\031.'\312v%\254-{\341\262\034\26588;\267`\234\323\0337m\371\007f\343\025\005s9\267q\227\353(\327\013\275w\365\321\241c\203u\326\266\004\213\b\332\032\352\031E\320\207Q\004YP\323r\354\266\220\236Z\316i>j\356\262\232\264e4.\303\241\"\004\331\226\263|M\210<\300&\337\333,\220-`a\332\376\004\365\353\231\331\216\021<0N+\025`p<\341\275a\367^\022;[W\307\260\266\317\323\321\221\323\323;k\373s\031\20714].5\357\331\275+P\352\245\351\213W\333\247\265\312\302\345\255\355=P\231\214\307\326;B(\304\210\325\231\266\257@\035 \353bp\036\365\255~me\021A\225\003\b\376\fB\261\005\027\320\237\256\220\301\003:N\342\377\t(W?\340O3\370\371\310\332\317D,~\036:"
+	.ascii	"\177J\302\3178\322\260\030\270\022\365\337\312\317&n\366\235"
+	.ascii	"?u\262z\316\237*\375\017\363\363\002qpUx\370\217\3673\2115b8"
+	.ascii	"\374\327\3739\201=6`5\374\314?+\320\0174\372\377\366\363\001"
+	.ascii	"p!~v@\030\342O\213\036\200\222\343g\237\237\021\370!\376\\\245"
+	.ascii	"\366_\313\317\r<m\305}\376\024\203\013\377t\370\363\3608\177"
+	.ascii	"Z\343g\034~\026\361\363\t\032\003\334\360\237?}\341g\255\237"
+	.ascii	"\323~\276\362\263\331\317e?W\371Y\354g\260\237\247\374,\345\347"
+	.ascii	"(?C\371\331\311\317V?3\371\271\207\237\225\374\314\365\363\325"
+	.ascii	"\317O?3\177v\372\271\351g\246\237\227~V\3729\351\347\242\237"
+	.ascii	"}\374\274\374\031\305\317\305\237/\370\017\367\277\356?\233\237"
+	.ascii	"[\374\254\301\317;\377e\374\037\372\231\203\237C\370\271\307"
+	.ascii	"\377.?#\375|\364\263\362\347\344\317\310\237\217?\337\237y\370"
+	.ascii	"y\207\237u\3709\207\237i\370y\307\317\306\237\215~^\3613\004"
+	.ascii	"?\317\360\263\216\237#\370\017\302\377/\377\005\b\f\f\f\374q"
+	.ascii	"^\374)\334O\200\231\026O\r\256h\032\356\355l\314N\215erF\355"
+	.ascii	"\253\2754U\220\312\034\027\334\031\365\226Ls\021:\201rZ\302\245"
+	.ascii	"\331,\232z\373To\241\250\267H\324\333\246\226\243\3418\277\310"
+	.ascii	"\356\344|\204\200`sD\332\336N\251\267I\352\323?\365iT}:\247^"
+	.ascii	"\216E\004\237\r%\263Gll\\X\236M\026$#v\255\364\330\233LI\332"
+	.ascii	"\230\"m{e4\201i`\332\332Vi10\273c\0222+\f\214\331\254\214\034"
+	.ascii	"\371\360\006#[\337\324\332v\224\236\302\023f"
+	.string	"\311\233s\212\224$\2616jk\230\223\223W\263mCa\267\340\025\325\237\223\266\335\244\2374\2235\266\252v\"DJ\245\215\251R\323$\365\355\327_J\246\214 \357\314\250\347\265\227(\371[\022\247\204\fT\232\353\305\253\273\246\0201c\246\273\032\t\022Z\227\245\266\253\222\307\331\346MU\333\240\216\352\251\244\232h7\365SR\362.\332G\215\324Lsk\260\260Z\222S\254\257\370\214\351\312\032\213a9\252\237\253,[:\305\250\360Y\217\243\245\350\337E:\253\215\264Vc\365\220nv\220\336\352#-\244\271xm\"M\365\256j\253\217X\357U\336{\317an:\271\002\211\251\2034\367&*\307@0_N\0220\b\252\237X\216j\275P;I\273(=>\016\373Y\216\307p\224Dry\35530JO\312\275\353-\370\271\217H+\371\313\n$\346U>\307:\200\376\261U\341\273w\215`D\004\352\021\322,\314"
+	.ascii	"\373\336R\203\227E\004/\327@\246Z\252'OH\224\255\006\362\226"
+	.ascii	"R\315\360\275\361\321\266\177pY{q\231j\322JZzv\355C=\267yj&\325"
+	.ascii	"\337\2220No&\273\t\215\314%\321jK\206\251\227*\240s2u\217\367"
+	.ascii	"R+\375x#\333j\333\313\366\301+\002\235\224\036\311n\030\017\340"
+	.ascii	"\024@?8\365\214@\220\003\031\201\240\232\372\303b\352\337\311"
+	.ascii	"F\252}m?\372\376\336\310\276<kR]im\3736\007\366\361}\031P\250"
+	.ascii	"\\\373\332{\221\314&z\230M\340\264)A>\203\366\034E}\036\277\021"
+	.ascii	"\256\307\213\367\306O'\b\273:\345\332\223\274r\036\271RK\360"
+	.ascii	"\355\361\244\tarD\357\274g\217Ga\376\332r\236O\035\223\263\252"
+	.ascii	"\r\224\333\332S[f\343\263\307\324\206\216\251r\020\267dM\236"
+	.ascii	"\024)\025F\255\355y\251\376\034]\023b\354ii\013\336y\215E\032"
+	.ascii	"\343\305\245-\337\355\224=\223\002\3332\031\266c\023\265\246"
+	.ascii	"iW'\264\362\322{Ss\256k\254\253\244l\313i~\207\203\004\352\310"
+	.ascii	"\006\215\255\322\204j\253-\317q\031^O\260\231\314K\305D\3614"
+	.ascii	"*\375\361T*\225J\255\324\343\275\307\365:q\226(\236\223\357R"
+	.ascii	"Q\241\270\221E\3143\255zj\305\263\325\367\003V\333\224\212\313"
+	.ascii	"v\234\362\350\232\264M\247z\nO\240\233@(\316\024\3658Z\352\337"
+	.ascii	"\177\360\"\231\367^(\234\3652\223\3023\016\363pz{\323\377\006"
+	.ascii	"\300p\357\261\215\253\215\332D\ryU\342\376r\367*\263\216\037"
+	.ascii	"d=)\263\246\226\320\254{T.9\0021o\326q\t\275\027\350*\225\307"
+	.ascii	"\020\232\027h\t\275O\367\210\314\023\3375\353x\225\315\013t\225"
+	.ascii	"\027Yb\251\314zZB\221O@Kh\326\323\205f\335\237\253D2}(/\023\350"
+	.ascii	"B\263\200\270\320\346\323\317\022\332|ZB\263\2548i\251\006\312"
+	.ascii	"\023\027.\255!<f\251\274MLA\220\314\037\271\345\332\274h\356"
+	.ascii	"\3453\244\313\\\340\336 M&\032\344\024\257%\345\232\222h\310"
+	.ascii	"&\027\300\224\324j^\245\334\322I\363^'I\034\227\351\202\343*"
+	.ascii	"w\221\260\334\261H\220\273\204t\257\001L\367\036\371\312\335"
+	.ascii	"{\217\367\336\034f\220\365^\253\237\245\223\211\351^\252\021"
+	.ascii	"L7\310q\013\322\275}\246f\355i\t\325j\006m\261\002u\336\036\353"
+	.ascii	"\221\235\027M\026S\205\036\307\356\322\275\227\331\250\316\247"
+	.ascii	"\250 \316\314Rf\031\225UL\234:\304\213\314\223\350\032\341^\236"
+	.ascii	"\021\273\266C\347qI\022\231\003\255\332\342\372\002\027T*\211"
+	.ascii	"2\302\264\304\224\243\213kk\263\320\322\004\266]\363V\"\313\266"
+	.ascii	"R\253N\364\354\211\027$k\b*\367\211\255G\207\341\020\301\263"
+	.ascii	"\342\005\211\317P\204\301j;\022\323E\352\362\364\224\034\335"
+	.ascii	")\303l\036%\371|\266\242yW\220I\225I\031\304+=~\351\251b;\263"
+	.ascii	"\227\336f\n\334R\352@\265\340\023\264&\200(x\372\350\222R\376"
+	.ascii	"\336\370\200\375\330Jr}t\266\370=\001\322\266\373\332\315\333"
+	.ascii	"\257\371n\373]\320\274\027\331~>o\356E\3720\233`6a}\320\372\302"
+	.ascii	"\022\264\267}{\277\353\343X\2247\275g\332W\026\244I\336\224X"
+	.ascii	"\023l\252\r\233&\263&.m\237#B$\311\240X\005\361d\307\304\313"
+	.ascii	"\017 \242Z_\201I\332>9MWZW\225.sz.I\322\316\2469\037\242"
+	.string	"=\374NJ\264\313\225.\347\231\227\323,\311\025&M\005\352\371\2256\244\255\374A?t\033\226\271\252-WUe:L+\245\2533\307L+\314L\343\365]\247\3515\255\246\353\332\256\307\264\\\243i2-\246\351\372L\307\365\034\257]\206\307\336_\032\214[\303E%\233\302\324\330\255G\371s\225ZB\234X\220D\373\312t\226\326\2424\307\025\355\262\306n\351\030S5{bE\273Lw\3416=\312\365>\355$\251\"H\271\236\270\3155`\0370\b\020\241E\016\"\216\030"
+	.ascii	"\320p\021\300\210\030<2\200\214\206F\033Z\360\200A\002\021\261"
+	.ascii	"\370\002\3505z(\230\300X\024\3221\301\215\035-D\274\006\2618"
+	.ascii	"$\032\306\240\376\002\025"
+	.string	"\022\250X\301#\347+XP\300\202\202\340W\260\b\nb\241\"H\275\212\240\264(\204\243\206-\016\2117\210F\242\241\r\342\016\r\301\241\215\242\034v8C\005\036#\242\"\242QGQ\016\rux\0031\206jT\213B\033B\303\022\206\210B2x\030\205E\343\213\021;E\343\213!\r\304a\r\022\306\031F,\fs\020\215*\221\220\216\030<\212=BF\241\020x\024{\212\306\027&\210\220\241\206\020\215\241!!\027\303!\033D\341q\220x\221\216a1\205\261\250\250\230\"\204\r\242\241:\034\242!$\243\205\237\0201\020\021\215D!\027x\300\020`8,\216\300C\306\220\220\261H\206q\306\212\034\033BC\030;1\200\206\212\212Z\314\300\261\301\250#\207\b\305\341\215\033;Z\030\2119\214\210\204\2122b\030\021\017\030\316(\026\351\330\031\332(B\30184\3121\316P\021d\2141$\"\2360T4\2720\016\215"
+	.ascii	"0\316\250\300\002#\021q\207J\303\305\320(\004\303\306\016\241"
+	.ascii	"\026\306\241\021\317\215\035-jP\215F3\214\305\242\027\302\007"
+	.ascii	"\005\271(\301B\n$\2505&\030\022\"\026\207F)\214\212C\032\210"
+	.ascii	"E\033)\210\210B9R\324(\032\245\230\340\200\241\221Xt\201\210"
+	.ascii	"\030\303\220\306\316\226\224\353h\253\310\327\332S\25334 {m\263"
+	.ascii	"dI\323\002\235nqWbZ\236\246\371\214\361a&K\333\024m\307\257\r"
+	.ascii	"X\035\225 \027\277(7\317+W\372\226\254\220m913c\263:'\024\020"
+	.ascii	"H\264\306\306\322\2628\2470J\206N\r\372\264,\247\214\351\357"
+	.ascii	"G\333\364\371;aV\217=\300\266)Y\016\263J\025\216\323b\357\254"
+	.ascii	"\266\324\275Q\305\304x\215z\303\234i\235\236\037\22095\005K\301"
+	.ascii	"x\357+\212\003\265\265\364\326\246\262\033v\323H\365\n\360\244"
+	.ascii	"\211\347\344\213b\346C\222\266\255l%\303q\360\304\262sPmfm\033"
+	.ascii	"\251\221z\251\2359V\264\250p\362\324\034A\333\246PR(\315\234"
+	.ascii	"Sr\006\323x\251\242\345\251:q\322L\006\364)\002X\305\267D\355"
+	.ascii	"\250\216j\251\237\233\264{S\265~(\271\265\375\372J{\320\331\300"
+	.ascii	"\tZt\207\354\314\233\243\324\371\264\007\235#tLKm\203A\272\336"
+	.ascii	"\225*a\252\233\236\251\241"
+	.string	"L\tI\222\247J\230R\253\027\227\t\263\230\005\222\371\213\342\247D\327\366A&VZ\004+\345zz\344)\027t\255\351\3306\335\3422\034\246\2204\265\266\251\221\236\"\244\333CS#DH\252\265\302\212\347\224\302c\356~\250J\263\236jMy\036=i\233\022\341\2624\t\304\032\226\266i\263\2474\022\020(\267\266\351\020v\323a[r\263>\231\321\326\305\007\250\036\307\214\n$\275\002\222Z\005\357\345\265\351\024\202\301\250r\3418\b\003\231!D4\"\"I\222\2441B\013\020\004ca\234\325\262\003\022\300\023ARB\311\b\321\210\210\222\244 IaZ\003EH*\n/\261\372\355W\215\026\251\351\327^;F\216Q\003\240O\251f\254\375p\310H\300\255\342N\316\304\314\260\307)\005\003\374\002\276DP\215\276\240\007\250\006\231\356\346\336\276u6\316\322\211\234\005\217\237s\007\f$W\210\017\222{\270\225\227\275\321u"
+	.ascii	"/{\022\312\355]\027>h\224\261\335\254\214p_2\215-\203&\331\277"
+	.ascii	"c\300\354\026\221u]\030\221\375\220\202b\004(\257^\245*9ff:8"
+	.ascii	";,0\203|\336xH\210\267\002x\003E\t\237\365\356\303\tSU{\372\255"
+	.ascii	"\320\007\227\351\246\030\f\236]\335&\275!\022:\274:\322\261\030"
+	.ascii	"\327?\002\020;\026P\022\020\356\275\215\001\311\247\222\313\242"
+	.ascii	"X\005E\r\207:\231]@x2\210BT\312\203\343\313\3020\033\356\233"
+	.ascii	"\032=\302g\262}\342\331\206\016\361\361\300:\326\241\007\030"
+	.ascii	"<\026}\016f5\020=g\230\274`\325~>\002\350Pq\342\237]\265\323"
+	.ascii	"\355\226M\347,\337\274\376"
+	.string	"\315l\312\220I@-[\177\347\202~\346B\244i\247.\025\304\2158T\217\363+\312PJa\355C\357\210YB:)\344uQZb\004Bz\265\003\353\021Wd\037\211\271>D*)8L\177\221\3168EH3L\243Uz\027\031\246JAl\362\031\330C\003\024\320\006S\370\327>^\345j\311!j\202\031\273_\276Ss\316D\363AY+KvSB\3172=\316\3569\220\266\304\026*\367\311\346\306\302\233~\247\303i\016\203!\353k\231@\272\3478\035\2036g@c\223\215\355t\301|\352?\003!\232\222\3000\332\025\310\220\030\364\233\2729\t\360al7\b\363\337:\273[G&\003\006-\217I\344N\334\320\246\003\276\357lSD\331+\031\362I\356@\214\316\247\321\004\336\377\233\227\304\342#\240b\262\0363! \341\343\203w\035&\021f\002\306\214\201\237\241\020\233|b\222X\315\005\350\n\3365\370\001"
+	.string	"Z\331\305(Y.\206\215A\275V\265q\262\270\271\0176\257A\327+\376\346}E<\353\343I\021\332\342t\330\035$Cs:\373\322\233`D\274y\237w\016\030\264[\223\025\214\030\f\335\206\2564I\371\367\033\177\217\030\324\033o\372C\303\355\001p\204\306\211\177#\202\n\375\263]\361\345\216\177\230H\023\332;/8\3578\351\233\362\371\220\223<2\230\212T\212\230\fe\3450\0013,p\237\3046\360H*\n\270\200v>\264gb\273:\3627\241\031@'\257\234\261\250&\206F.D/\030Ar\216f-\303\315\203\\\214\210\271*\230r3[\306\261$\300[\003\347\236C"
+	.string	"\244\374\021\230\034\b\354Q+\321\354\270O\n@\361;\0067\370\233\250\341\232_\270\006CRVq&\003\370\267\243m&\344}3`\255\236\002\322]\232\226?~-\f\b\335\227\007\201\357%\355`\355\247)~\003\007wRG\201&\025OJ\013\206sd\352u\221\t,f\227\r\315\024(NW\220\266aO\350\216\206\344.\350\025\200\312\322\340jTI\243\216\330x\f\347E\013=\211Z\265%h\205I\261(\030\f\207\253\331l\002+\363\332\211\355\023|j\374\210\b\335\034g)\367C\034\001PQ\030\031~\234G\324\f\234\204\352Oj\307\305\330\004v\r"
+	.ascii	"j\306\311_D\004S\341\252\334\323S4\3635J@\200oX\205`~f\343\356"
+	.ascii	"7#w!\300\223I\361m\016+\264MT\2677\003s:\001\233\005\243\345"
+	.ascii	"\307 \210\261Z$\033\207\315r\337\263G\214\360\206o\314\306\252"
+	.ascii	"2K\227bMu\374\006\226\240\266ip)J\266\274\003\b\233M*\035Y?\251"
+	.ascii	"\b\300\016\346\263\003\211\344\376\005\227}T)\306\360N\344\235"
+	.ascii	"\314I\313Jn\277t\201W9\372\243\306jl\347\b\305\313\005#\361X"
+	.ascii	"\321O"
+	.ascii	"\305Ab\202\3147\272)\261\241\020\017\320\032m\375h\264\344\376"
+	.ascii	".w\364?\033\2431\004\366\2406c\331\365~\356\355\212\340B\251"
+	.ascii	"\227\232\231\250#\333\177Q\237{\2700\0330]\342\373d\006\257\277"
+	.ascii	"\276E\237\227\177\356x\366=r#\343'\316\263\216\347\233\343\375"
+	.ascii	"\317&dab\272_I\321nc\311}\306ZuM\360\375\353\263\032\274\022"
+	.ascii	"\331\246\337Q\317\342w\274\312\215\336S\3017\210a\263'\342\347"
+	.ascii	"\333\276\203A\324I\346\353\366\310\242<\001Z'\337(\354\004\r"
+	.ascii	"\236g\336\340\213\343\224\335\252wo\fb\037\247A\353\314,\274"
+	.ascii	"\203Xl\367\376c\016\323l;\335;{e5\013\345-i\3771\377t\004\275"
+	.ascii	"\341\363\357\340\023\342\237\233\335\2017\321~_e\213v\367\351"
+	.ascii	"\253\031\025_\030\\N\276\227'\366%\0348 \345,\327\313\342c\346"
+	.ascii	"wy\305\237\005\346\246\377\326\300\344\201\370[\001"
+	.text
+	.section	.gnu.lto_.symtab.cae45debf17b7c53,"e",@progbits
+	.string	"serialPrint"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\001"
+	.string	""
+	.string	"serialGetBaudRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\001"
+	.string	""
+	.string	"serialWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\001"
+	.string	""
+	.string	"serialWriteBuf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\001"
+	.string	""
+	.string	"serialRxBytesWaiting"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\001"
+	.string	""
+	.string	"serialTxBytesFree"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\001"
+	.string	""
+	.string	"serialRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\001"
+	.string	""
+	.string	"serialSetBaudRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\001"
+	.string	""
+	.string	"isSerialTransmitBufferEmpty"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\001"
+	.string	""
+	.string	"serialSetMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\001"
+	.string	""
+	.string	"serialSetCtrlLineStateCb"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\001"
+	.string	""
+	.string	"serialSetBaudRateCb"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\001"
+	.string	""
+	.string	"serialWriteBufShim"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\001"
+	.string	""
+	.string	"serialBeginWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\001"
+	.string	""
+	.string	"serialEndWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\001"
+	.string	""
+	.string	"serialSetRxSpanCallback"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\001"
+	.string	""
+	.string	"serialReceiveSpan"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.cae45debf17b7c53,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1558 @@
+	.file	"serial_tcp.c"
+	.section	.gnu.lto_.profile.e57560bfb476d2f1,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.e57560bfb476d2f1,"e",@progbits
+	.string	"(\265/\375`\f\001-\013"
+	.string	"\244\020"
+	.string	"\002"
+	.string	"\034"
+	.string	"\247\212\323\217\006\002\002"
+	.string	"\002\001\001\341\201\201\376\007"
+	.string	"\002\211\276\317\227\r"
+	.string	"\003\241\216\364\245\r\004\004\305\251\340\343\006"
+	.string	"\005\327\230\206I\006\002\002\002\001\002\003\002\001\002\004\002\004\007\201\317\223\267\016\016\002\005\002\005\b\326\220\341\244\n\f\002\006\002\002\001\002\t\372\256\376\372\013"
+	.string	"\n\341\244\354\263\002\030\002\007\002\007\002\002\002\013\204\221\207\356\003"
+	.string	"\f\364\245\343\237\007\016\b\002\t\n\t\002\t\r\355\370\312\367\017\034\002"
+	.string	"\002\013"
+	.string	"\013\004\002\004\016\240\342\234\212\n\017\352\263\360\321\b\020\371\255\255\300\b\001\002\f\002\f\021\262\314\371\270\004\006\022\230\261\347\302\002"
+	.string	"\023\225\230\353\211\002\002\024\301\277\316\207\005\006\002\003\025\303\373\361\240\t\026\303\243\371\255\007"
+	.string	"\027\261\357\377\303\016"
+	.string	"\030\250\302\3371\006\f\002\f\031\233\246\366\244\b"
+	.string	"\032\322\370\243\302\n\034\002\r\002\001\002\016\017\020\002\001\002\021\002\001\002\022\023\002\001\033\034\276\204\240\362\016"
+	.ascii	") `\202TU\036\313\b\262\220\217\354:\245\334\260\243\022e\201"
+	.ascii	"V\022\034\027\231\332\037\330M\215-\206\375\302\300\201\254\256"
+	.ascii	"\037om\311\033\360Z\305\005\351\356\222\021\267w\203\375\037"
+	.ascii	"0\364pu\301\211\003\027P$\301A\354<R\036,\354%\\\003b\200z\377"
+	.ascii	"^\020~=\215\017\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.e57560bfb476d2f1,"e",@progbits
+	.string	"(\265/\375`0\002\355\007"
+	.string	"\222G\025\034\220)\351\377\377\377G<333\363\021\362\217\376G\377\253\242\377\267\222O\310\226)\005\252\016`\224\213m\026)\024\227\307u2q\211\021c<\270!\235\344\323\210l\314\2760\341O9\250e!?\022\350\350\027X\255\250[O<\217\264?:ok\253\177\033\313\021[\250\320\224M\3323p\202!#\253\007\020P4c$I\263\006\034r\251\2466\377t\336\265\257\257\220P\022\023\374\307R\272\201,\310\206!1\004\251\r\205\257\355\254\"\001\320T=\226\276\035\360\327\\\267\002\357#\371\365V\bw7\"\316\3177#  \022S\326\306\205]\257\312\006\235\375\007\201<%\036\254z3\333M\212R@\377\rJ\332ch\371\322\024\375\203+.\305\261\034\2402b4\327\022D\236\332\005\225\312\271\353V\034\3728\334\343\240\263\030\354C\352?\223\2122g8\221g\022"
+	.ascii	"h\200\353\324@\033\305\006"
+	.text
+	.section	.gnu.lto_.inline.e57560bfb476d2f1,"e",@progbits
+	.string	"(\265/\375`B\bu\034"
+	.string	"\226\242wH\340\262(\035\220\034\031;\230pq\276\320\257\347\254.V\217\242\356\313\334\332E@\"~^\006\020\232\255\226\240\316k\035C\241g\205\376/-\202q\037(n\230a*\024\007\327-\256!\322l\311\266\265g\355\337$vK)ST"
+	.string	"e"
+	.string	"l"
+	.string	"\374Ma\025\265V\361\237\371\261\374Xr\370\322\311\317\271D\217\322}\246g\357\377\306\312\376\211\367g\226X\177\025t'~\360\371e\361\367F\341\033\374\261\334\377_\327G\250\265\272~\023\357\367\273\352\356\313g\222m\265V\357?\341\345\177\311\256\265\326\371\207\007!\b\237\377<h\257\231\320\257j\233\035\267\2340\344\335s\005\333\326\236\032\031\007f\350\214b\321\203\226\277\242\336\367\230\020s\302\373Y\214\001\004\flA[\320\241\t1@\351\277c9\377\005\320}\277\336\321T5\013\032:8@\177\253cp:\350\020\227A\247\3100d\005\001\352\211\366\037\313\376?\232\363s\302j\037\344}\265V\020\r\340\352~\222Wl\335j\236\227,g\242%\036\313Iv\210\235\233\007R\343\254"
+	.string	"\271\371J\370x\001\033\320'\361R\223\343\270\217z\367'}\272\247\305\006\030^qm\307F\004\b\302@\201\233)"
+	.string	"~\223\226\350\351\t\307\370\2213\233/\371\212g\265V\021\221\367\341nm\327\244;\t\223&\235\310\020\332\345\342\302\205\272h\3072\237s\305\270\035\226\227\222\227\346\322,\310\016.\200%\354\275M\320\201\334\340\335\323BCA<\t\213\223\316\372&\313i\030\305Vf\373\313\352Z\020ZK\212\206\037K\231\227,\027:\352\364\261\\\322\347 \227\320\236\336T\274?\205G\330\2501\303\224\342\371\340\342\220\272IES-\376\241r\301\304\310\202#\225o^\262\334w\221Y\006\200\310\250\241\275\031\022\242\221\024$\031\306`\002\021\"\252\252\007\022`s-\006B\241SJfDD\n\n\356\337\001\b\223\223\310uh\004\350&:\0172\331kE\243\323\301-\270\273V\344\032Lr\320G\035r\"\003\007wk\253\335\305\225_\021\214\007\273\2348\230\013\021\237\276R\022UF\215\220\\\356\312\346\t="
+	.string	"\234\215\253{c\377zZi\257[\301a\233\034\321\232\364\271s\350\306\213\205\332\177\302\225\3738r\3064x\235UzM\276\315\367C-\033f\264\213\336\026\210"
+	.string	"\247j\315\f$\371<\353\003\207\250\013I\020\022m\023g\217\240\324B8U8O\032\201\250b{\230\302\217(.Y\241VY\237\013\336\330\336\374\2535\002#\364\007c\363\344\r(\347\265\206Q\343\214\300z\2153\r\370Z|\363^\252\376\374\212\267E\227\f"
+	.string	"p\020\253\201\203\301\245\365(2K\241\023\272}28+O\2501\245\260\025\020\277\272\240(\267:E\307\013\233#\212f\372&\361EQ\237\232N"
+	.ascii	"@\224\251\013\035\224\355\231\215\226\214\306\027|\251M+\264"
+	.ascii	"\264\213\215\031H\355\366\t\310gn\376\037'\0139\003\303\251\354"
+	.ascii	"p\254Y-_\343\340\231\247m\230fQ\021\035\\\300\372w\226f4S\305"
+	.ascii	"\312\303P\n\334\246\360(I\300\274\213\377R\f\243]j\320\261Y\n"
+	.ascii	"$\262\f\271\220\343\200\0130\250\305B\302\225\233\353\035\205"
+	.ascii	"\374[\370\323\376.\346!\354\372\023'\270\230\345\003\307\030"
+	.ascii	"\305\257T]\327L^sGf\327$\307\210k\254'\320\2369\250\303\314R"
+	.ascii	"+z\007N"
+	.text
+	.section	.gnu.lto_.jmpfuncs.e57560bfb476d2f1,"e",@progbits
+	.string	"(\265/\375`\360\f\235 "
+	.string	"6\245yD"
+	.string	"\261&\035\374\377\377\377SN1a\221V\220hn\360}\311\351\377O\222\320\317\027\r\264\375\r\225\321\bg%\022\224\333\376#L\303B\304\236\240Pe\302\001>\307\310\214Q\343r\337{\332\332\331\277\355&)\311Z"
+	.string	"`"
+	.string	"i"
+	.string	"P\245*\307q\234U'\336\326\235x[\252\314u\341\335\261\277\206\276\357\373\254\320B\371\252>\361\365&8\031\325\372\214\";\233X\252\373\350\201\036\233\242\332\024o\217\265\206\223\320\226ql\030\246\341\276N\211vJ\274u\017=5\364\254\326w\236<\210G\276\226\255#\275Q\005A\b3\3217\354\031\376\374|\254\357\303\340?>\2748sB]\213>\036\035\222\276\036\366=.\233\313\346\245E\274\272\210\326\004W[\337\276\220\235\201\b\241\027'^\304\311\326\322m\325\030\255:S\027\256\2759#NrK\325\025\342\364\311\241\321\227t\375\330\237\277a\b"
+	.ascii	"\350\223\307\363\333\310\b=;\307\032~\001S\364E\337\005\337\221"
+	.ascii	"o\004\333\026\310\236\210V\024\024\215\020\030\260\343\313\330"
+	.ascii	"\213\"ZO\267\325\262\005H\251'42\374\217\033\331\271\306\304"
+	.ascii	"\2028b\370PuS\310.\306\304R\347p\364d\3448w\236\214\nJxrv\310"
+	.ascii	"p\234\n\257Q3\023\340m\303\256a\023\r\022\236\234+d\267\302B"
+	.ascii	"v\017D_\177C\366A3\001:KX\026BsIi+m\323.\020X*\203qI]\035\264"
+	.ascii	"\003:\261\222\013ua-\253-\363\220\201\350$\351,\225\260\314E"
+	.ascii	"K\265\\0\252\226+\246\344Z\301\250^.l\3238 \2706\325\265\251"
+	.ascii	"\264\025K\266m*\226\353C\246\"\242!Ee\005\2443\246\004\203\005"
+	.ascii	"\t\0316\\\240\200\262\002r\360m\260\243/\203\257\350K\3629\212"
+	.ascii	"\250\222\324\243\321o\207,\214(\007p\200\371\250QM\244jF\222"
+	.ascii	"$\2054\007P\002!\204\250\252:\022@BQ\206C9\fc\312(e\020\031\242"
+	.ascii	"\200DD\222\322\2440\006\221\006\t\376\242\246U\177\347\376\256"
+	.ascii	"V\007\240\267\177\207\370\342\022\261\202\267\020Gd=\254\261"
+	.ascii	"t\022\032\362a\311\177\275\304\310\332~\370%r\340\002\260\233"
+	.ascii	"\013\324\356\023\371\333T0\336Y>\241$\2348BE.\023\361`\020\016"
+	.ascii	"vz\2573a_8Qlm\2062\311\234!\f\263\b\004\207\2573Mf\245\257\201"
+	.ascii	"i\2677yA:@\311\020\327\323)\336\337\221X(\351D\b\254@\030!D\212"
+	.ascii	"\305\250\334\371\231?\200\325\344\366!\\\243\001t\363\006\220"
+	.ascii	"\205m`\347\216\270\025\336\350\202\377w\336\226n\254!\320\305"
+	.ascii	"\032>\237\033\220\230F\032X\017\201'\374\020#\257*f\375\240\350"
+	.ascii	"nl(!N"
+	.string	"\212\314\004I\274Wr\357\306\33490\244~\375\365\211\217\231\273\r(\314\224$\245m\336\007\353\361)wq\330\231.\225v\313Jk\366\320\216/\326\020\255\373\363\330x`\"*\252\312\332\224\371\210\376j\333,\324MNo\3718\267\276+\276v$I71\b\353syJw\033h\266\353\250g\271wqP\375>(\275\307}\223\005'\304\233@\3679&\214|\336\375\224\200Y\256\201a,T\230B\b\245XN\217\3112 \be\232\2060\211\223\214_0\227c\233\251k\377\210\"\235=\302:\371\003\001\342I!\255\b\022h\2310*\212\020ZxvZ\035](\037\273\b\347\243\300@\314\212\200\005A\221\251\360\255\314]r\335\340\247C\341\342\323\234\234\200\373\016\300\200\244\334\223\260\241\240\370\331\314\f18\\S\351\212\306\345\022\212o2 Y\332O\343X\b:\237d\325\0201>A\005\206\013j9\024\327\276"
+	.string	"\207@hIOH\321\2076w\267c\204\315\247"
+	.string	""
+	.ascii	"\372\254(T\316\273k\2465x9 \224\177\b\017i$\216\225\2050!\251"
+	.ascii	"\001\341\274\255\220`k\343\2146\324F\350\035\223\224\236\213"
+	.ascii	"Fc\\i\324=\216\017"
+	.text
+	.section	.gnu.lto_.pureconst.e57560bfb476d2f1,"e",@progbits
+	.string	"(\265/\375 M=\002"
+	.string	"\322\304\020\033\220E\351\377\307\270\313\21433\223mfF8\004\276\265\377\314\355\177?\337\364\377\035g\340\001`Tw\272\322+\272\320\371\\glF\346r\271\312M.\221{\274\214\2638\274\373H\334\341\n\247)3\023\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.e57560bfb476d2f1,"e",@progbits
+	.string	"(\265/\375`\236\001=\b"
+	.ascii	"B\212 'p\307\031\016\240\\\311\311\311\311\350\017\256J\375\261"
+	.ascii	"\252\254j@\250v\231^\257g\273\337\260\217I\300\177\\*}\"e\nW"
+	.ascii	"\003\004\0233uV:]'\245S\2403\352\f\250\263\204\221;\002A\332"
+	.ascii	"\217\035\255\261\361\326\363\023\326\013Z&@\027\206{\357-n\030"
+	.ascii	"\252 \013\032&\333&F\364\311:[\021\234\252\274\252\302\222T\203"
+	.ascii	"\327\332\251\2269<\254\327\301r\347\214\365J\230s\250\234*\027"
+	.ascii	"\270\273\371Z\001D\250QM\307\254h\2379\300\002\231)2\017\021"
+	.ascii	" \2413\334\222$\305\314\001\033\210E\220\260\024\3534\366\257"
+	.ascii	"Sl\256ca\352\320\255\325c\241\333\322\244\311\342\034\245\320"
+	.ascii	"\350\005\023\002\005\271V\002\276)4\200\231\035\312R\266shBW"
+	.ascii	"\001\214rid@\246\024\345\310\356\367\251\034\213%z\316\244k\370"
+	.ascii	"\332\002.\255\255:\013\261\026)W\200\336\025\337\347\246\342"
+	.ascii	"\363\363\251\001\203\271bE\322!\223L\017\314W\250"
+	.text
+	.section	.gnu.lto_.lto.e57560bfb476d2f1,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_tcpVTable.20.e57560bfb476d2f1,"e",@progbits
+	.string	"(\265/\375 \361\005\006"
+	.string	"$\n\267"
+	.string	""
+	.string	""
+	.string	"."
+	.string	"\005\001\212\001\202\200\200\374\342\203\314\326\005\177}\370\307\366\005\177{\270\307\326\005yw"
+	.string	"\005\001\006u\001sq\274\236\250\264Xomk\240\264/ig\370\377\345\007ec\270\377\225\tea\370\376\205\007_]"
+	.string	"?\202\210\200\340\001[Y\306\001W\305\001U\304\001S\303\001Q\302\001O\301\001M\300\001K\277\001I\276\001G\275\001E\274\001C\273\001"
+	.string	"\013/root/repo"
+	.string	" ./src/main/drivers/serial_tcp.c"
+	.string	"\f"
+	.string	"\200\224\230\244\310$\n\214\341\304\006\370\002\330\201f)\213\306|\360\314W1"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_tcpIsStart.24.e57560bfb476d2f1,"e",@progbits
+	.string	"(\265/\375 \350m\006"
+	.string	"\"\314,2`m\322\030"
+	.string	";H\243LV\202J\341\f\316\trN\373N\377"
+	.string	"Lk\326:\325\331\275\006\337K\222j\b\002\"\311\360\252\036\021\222R\253\225X)e\nO\022f\312$,\\*G]\355r\224C\345\024ZCuah\223\273\232d\331\302P\256e,\313\265J\266\250\237TKG!\0369\260\343\215\031?h\0221\214F\r"
+	.string	"F\251\002\026\235\f}\306I\275x\244\254~\376<5M0\204d\227\"t\262 \321\207\306\277\371\312\006\007\233\337@\204\212\214Hx\224\354fM1\360a\276\0217\220"
+	.string	"\004\302<\034\314"
+	.string	"\204\335=1O\005\256\370\027\374\322?\021\b"
+	.ascii	"2\003\316:#f\b\3055q.\002#!\362\270\033\235v\222\001"
+	.text
+	.section	.gnu.lto_tcpIsConnected.25.e57560bfb476d2f1,"e",@progbits
+	.string	"(\265/\375`_"
+	.string	"\205\t"
+	.string	"V\323D90\221\322\001\203\3004\314\245\r\f\237AZ\\\252\303D\337\302\301eWdX\355\177\375#Fm\220I\373\316~mFD\004\211Ex\254*\272v\372\210C\370\333%m\313\224\0024"
+	.string	"2"
+	.string	"5"
+	.string	"\004\362\334\347\003\362\234m78\254\314zX\223A\334\304Tlv\303\031C\316\272\262\374\233<a\245\006\234\265\256\036\211\335\265\202\263\216;\336\266\202m\006\3339\001\273\273\2164\313\333\376\330QkT\337\0230S@\263+\273\341l\f\3272b{e\203l\253\332'y\311\3526\325\005vi0,\273\341\202\347\347\234\303\007z\277\310G\373\324\351A\215\021\037\034\261e?e\343\240\266\013;h_\034\345\373\354\302\036N40\020j\"\347|\225<\367\030e@\017\227\336\354\260\245\021\304~'\337M\022\241H\251\211\212\221\311+}\363\363J\031&\217bZ\230F\247I\362\276)\n\271C\225\274\231\352:o\202\302\275e\f\271\342\313\276\201\324(\343c./\275\031@\003\t"
+	.ascii	"2\003\302\260B`.\306\230\266z\266q\031\025\250\361\317\034\302"
+	.ascii	"t\256I\006"
+	.text
+	.section	.gnu.lto_tcpWake.26.e57560bfb476d2f1,"e",@progbits
+	.string	"(\265/\375`\265"
+	.string	"\205\013"
+	.string	"\006\326O?"
+	.string	"S\234\016\030\305\251\030\360\327\0235q,\204(`\3105\272\333%\215+\250!I d\336\206\210\220\203\252c\004\013U\356\307\211\252\252J\024\240\277b\253(\267\213\212\302F\023\320\223\266\245L)="
+	.string	":"
+	.string	"@"
+	.string	"\356\361o\264\023\024\"B\204\214\354nT\025\337\01657\377\245S:\217;\264J\\a\202S\215\037\001<\020\264\204Xt/=Gx\237\314I\204\335uv\036\211\233\272m\t\266\031\330w\020pw\327*\262O\372U\323\231\351[\rv\304\007\001\034\273\241\222 \233\203\262\321\242b\373i\377\305al'u.`W4Cd\367[\340h\235\362wKu\312\372\200\352\2247\007\251\024L<@IbJ\302\373F\245\340W\033\323\220\357R\037\234"
+	.string	"\241\234}\323\007\003\235\255]\306\006kw!\304\360\320\001\301h\305)\277S\235\272Nt\204\230v\3200\341\311\022\373\343RS\330\017\332\235\271l2\234\t\0270W\246\321\242\226i8\\Y\205\230\341\302`\210\231L\213\227\003\3066\232,r0,\213\225o\017WE\206.\026\310\311\243\037\b U\355\313B\2763T\356#\222\223\210\272@\025\022"
+	.ascii	"3\241i\034c\253`\b\3411s\tu\025\032\322\261B\034\263\nO\2411"
+	.ascii	"\361\202\275\200\rF]\302jV\243\305]\216\331$\rL\355\001"
+	.text
+	.section	.gnu.lto_tcpUpdateClientEvents.27.e57560bfb476d2f1,"e",@progbits
+	.string	"(\265/\375`?\001\375\r"
+	.string	"F\333^C\020\221\223\016"
+	.string	"m\347\033E\365\3467!G\350\272\354\247\367\203U\333}\212;\200\230\220\241\007\246T\0302\026?u \310U?J\266\367\035"
+	.string	"\200B \0044\336\311"
+	.string	"\256\3006\224"
+	.string	")\374\204\354\275\245L)I"
+	.string	"F"
+	.string	"P"
+	.string	"\245\027-v;\004\306\256Cw'\020\017\257\017\210\207\006\3314\357D\254\005\302\303h\205jw1\rq\320\237&\310\267B:8R\350\217\345\032\200$z\234\335\275\211\347\nI%\323\n\331]'G\332p\303\333n`;\201}S(\361\360\352 \203\252\005\346\224\222+\273\013\245\272\330\177\273\273\326\222\375\323\017@\323\027L[/\0355\r3\3754\255\231\316L\337CAJU\303"
+	.string	"\215]\r\253\034\013\003\272(\261\261\375\264o:\f\350'\224\013\330\r#G\221\034\026\230\261\364\034\007\250Q3\205\f\252\346RU\250\fD2(\026Q\256\336S\227\314\335\r\251O\342\323\221\0306d\314PI\034\266?W\361\324\343C\013\211S\252\352G5\327\324\0303\352\340\nGqr\355\356\002\377\204\204\355\032q\350\007\333\335\001)\351\230<\230 \222i\236\r\3334\317\205L\203\200Q\310DH\260\216\266a \034\177J<\032f\362\371h\330\246\333\277\325\222S\017\374\303\364B\223\357\216\211\227\256\274\227\324\215T\212\212\374\221Q-\265#dy\316\034\f\032\262\317\302B\316pv\031"
+	.ascii	"DC\013\"\230\016\026\017haTv\030e\r\267\3015\314\036\"\256Jy"
+	.ascii	"\315\007\263\222\230]Gc\205\256r\273\204\311*\270\246\267H\033"
+	.ascii	";\f0\341\022B\263\232\002\334%`\300\242\312mW\321\003"
+	.text
+	.section	.gnu.lto_tcpClose.28.e57560bfb476d2f1,"e",@progbits
+	.string	"(\265/\375`\034\002\245\022"
+	.string	"\266\"{F\300\326\315p$&\033\301\355\340\225\203!@/\2074\252w\224\300jV\343\035\353\245\342\324\321\373\230\243\277\271H\362\232\366\304v\323C\360\f\370,\b\016\\\331\277\312\224E\301\020\313\2129O\355e\177\267\275\267\224)\005_"
+	.string	"b"
+	.string	"l"
+	.string	"\377\223]v\356?\304;\261"
+	.string	"k0@)%8\234\354\256\313=G"
+	.string	"\357\275\272\247}\037o\022\217\363\271\200]\244\251!\273\271\027\207\340=\347N\340\273\007\236\345\273g\321n\362\\\322\266h\334\020\202\212\262\273\241\332\270\370\024\375?]e$\252=[\024v\3279\022\305\270\365\266\031\330\226\261\363\026\343T\313ue\006\223\261\310\261K\371\210\002,{\304\243d\340\356J\200\"Q\242"
+	.string	"\326\355\236\357\363\335s\351\202\241\233\255\t\367\223Yv\256\226Z\303~\267\273kE\262\357t\273\216\373WT\322 \230n\201\351\257\225\366\276t\347\245\265K\247\246?`\302R\224'\007\252v_dI\331+\217\210\322\235~;-\315\247%Q6\240\314\262\247\237^h\212\330\343Ub\023\bz\272a\b\313\326\204{\345\313]\336\251-3\343:\n2BkI\252\360\"\027\022$u\n\302\210\nA\252b\320\360r\2415\033\310T\233\003M~Tu\035Q\251\bk.\344CL\352qFRc\021K\272\324\266\271\371\254\256\002\344\325\306\201\345G\277Zh\315~\220\025\031^A\321\300C\007\231\232\033\232\f36"
+	.ascii	"rD$\355\206\301\360\300zB\230\300\221\315b\264\2206\213\245\220"
+	.ascii	"\315r\302\0232\034\235\0206\243\2050/\357\360\304fa\317\316\316"
+	.ascii	",t\345\366\335*\222-@\271\372Q ?\310\226\036\310\223\210J_\262"
+	.ascii	"\335v\203>\2129\300\240\030\007\367@\265E\035\342\016$\267\322"
+	.ascii	"\361o\026y\210L\371QdR\025\031\020\376i+ \200\002\231\"d\007"
+	.ascii	"\343\320l\035C.\022\365\373\265\366M\005\353h/\ng(\210\233\355"
+	.ascii	"`\204J\367.%W\334\222\007\0336\262K\346Xs\326\333\206\220\201"
+	.ascii	"\031\230cL\320\374fN\\\202\340\266\030\350\350\247\273-\306G"
+	.ascii	"X\221\351p\3340\037m\232=\332!\371\211g]\271i\243M\344\301W "
+	.ascii	"\222\027\227!\003"
+	.text
+	.section	.gnu.lto_tcpFlushTx.29.e57560bfb476d2f1,"e",@progbits
+	.string	"(\265/\375`]\004\255\036"
+	.string	"\306x\306F\220\236Mc*\252\304\260\340B_\326\261\360\255\330@\020\021\223\212G:j\226R=#V\201\303\263Q@\244$+\3418\251\274\213\361\351\227"
+	.string	"\3404"
+	.string	"\272\203\364]r\262=\310\345\205y]\262\266\367\336{o)S\n\261"
+	.string	"\244"
+	.string	"\261"
+	.string	"\351e\272"
+	.ascii	"eF\n\331\275\351\203\217\216`\277\332\227r+\335\257n|\347\336"
+	.ascii	"(+^\367\246\020|3?:}\215\374h\236\207\374h\235\275\346\351\324"
+	.ascii	"-\213X\365\252\220\335{o\326\210\313\252;\r=\315\222\034E[u\376"
+	.string	"\3564\364\351\247h\013\023\353}\254\351ID\020%\244\354TM>\2529\326\344t`R-\321&=N\372\020\331\361\343\243XcZ\342\323\361S\022\035\f\267\3049\360>TMNU\024+XA9\"\340\227C\264X@/\017\276.\375x\325\036\370\004M\310d\225\t\376z\274\226\031\356\275\256\276\337\216\033\300mw\261\375\301\026\201\002\376\r\362\243\265\347\325\267^\355\351\304co\037\274h\006\304K\257\016\216zf\205i\260\202\326J\331\351\256\002\215\205!\261\215\262\237\336=\357\272k\327\272y~\365\357\320\252ig5\212V\237h\265\211V\227g5YV\217f\265XV[\261\272\222\325?`a\bY\033\003r\356e:3\273b#\027&\357\372\323_\353\337\272h\337>\227\037\354\212!\f\016\357\275\034\314\217?\225W9\3204\333[3~s4\235KIS\206\367za\300z\226\356Z5l\274\364\376*"
+	.ascii	"I)\230\037m\242\204\t\272\2476l\273\300/\340"
+	.string	"!\336{oi\240\222\326\264v\b\0216%\273s\315\222TP]PQ_\310\031\342\275D0|\353\007~G\215\217!V=s\201\272cm\022%\352}~\360&\234\252a\331\220g\222\351\031\031\255\224\017<\baWO\2135mi\227h\243Ewn\204g\374/\031\0063}\177\221\037G[\261,=\325\252m\342\004y\237h?U\305U6L\262\273\236,PoD+\345\030d\315^\314\315\2307\3020\274:\307\003\352\357\275\301\310\333j\255\265S\250\250\367\325\254\255gw\266\203\236\305`\b\246l\241c\301\231\367^\240+(X0\230R\3621HE\270#1\b)hH,\302\271\260,\212\210\206\212p#h \235G\267\320\017\f!$\025.\202\210r\270\243\333Q\016'\203(7t+\"\nzq\023\312\035\335~l6\202\201\313\335\220\214\214r7Zz\223<\003\016\233t\240\261\260$4\324I\t"
+	.ascii	"\300-b<\273s\217\025\006\370\321a\026\304\312\211\200\025\025"
+	.ascii	"\234\323J\271\226\246E\305\322\236v\251\307\322\354\212'\037"
+	.ascii	"C\004d\322\354\330\206M\325\325\305\034\265=\366tz_I\365\314"
+	.ascii	"\n\352im]\225.J\275\017\265W\023\305\253l\310\203P\347\213g\326"
+	.ascii	" y\254\035\313B\343S\317u\240n\212\251aC\275\217\307\332\224"
+	.ascii	"\036\326\242f\306gw8\030\017\rL\373R\250\221 e\210T\312\314\214"
+	.ascii	"\214\210\310Las`\002\221\031e7\020p9\332\024\032\003\221\272"
+	.ascii	"\332-\321\bR\207\0246\212\037\b\221h\007\276\202\315\213\215"
+	.ascii	"p\211H\375\3142\277<6du\352\246=\202\275}w\310mA\030\262^\215"
+	.ascii	"\307\220DW\320\031x\215+\030\005\205\035\234;H\177e\216#\274"
+	.ascii	"\254:\304\372\247/\214\3441ScQ\301\2534\213\336\006\024\214?"
+	.ascii	"\223\224XdDe\315\310\177\226\301J\210\242\bR\257C\\\211\002\261"
+	.ascii	"\250\232\234\\\331C\303\366\"\200\307\331\357^\325x\332\234\270"
+	.ascii	"4`\022F\234\205\216#\204\334\227\250\273\324\021\020\314$vF\236"
+	.ascii	"\274\274\376\265\202\037"
+	.text
+	.section	.gnu.lto_tcpFillRx.30.e57560bfb476d2f1,"e",@progbits
+	.string	"(\265/\375`\212\004\265\037"
+	.string	"\006:\315K\220\026R:\013\302:\033\027\350\355\325@3\270P\321u\032\r\220qR\230\304G\256z\335\303!\241\016m\316\251\035\265\335g\340v\016\351}\237\0250\200\031\001L2\f\222\b\361\017\305yE\373v\023\274!,\330\2144B\210\334I\006\270"
+	.string	"\253"
+	.string	"\273"
+	.ascii	"\314\227\372\224z*\030\277\335K\324\332\272w]\300:\364&\257\247"
+	.ascii	"9o\242\307\2357Ye\326\362\325xiOX|Xd\367^]\343\340\322\252\217"
+	.ascii	"\201Im5\224v\232e[\225\337{\214\315\230T\020\230R\301\260KH\343"
+	.ascii	"\365\204\345Q@&\233\2260^|`\377\002.\225\016\212\310\226\036"
+	.ascii	"\005\254amI\257\225mut\362/ \215r\302\024\020\250G\001gX\224"
+	.ascii	"\226S\n1R\221*sBb:-\351g\231{\202"
+	.string	"\364\311\004}e\001bSY\0324\262\346\027P\251\314\335{\237u{\024,\262e\003\341\333\026\024\336\322r\356\275l\177A\244\263\314\2319\214\231/0\227\036\002?R\002\275\367B\320\"\321\363\300\250\343&\037\306y\363\375\254'\3602\033\n\323\222!d\223\374\227\367\336[v\221\255\230\221\327\257\273\310\267\007\226\r\311\270\211\314\270c\235o\247\372\001\324,\2476\3136\232e\264f\231VZ>Q\313&\315r\371\252s\237\226\255i\371\004h\210\303\245\247,\035\266\336\030I\263\2134\227\354x\325\217\365\037\337\314g\376\312\267z\221gqzd\361k\004\254\375\256\304\306\356\335\242\200^\235\210z\254\0269\242\365\006\177\232\3265\002z3WV\271(\257\322z\221D\030\311\244nnr\003\364\346Sf\276\r9_\367\202\034\ns\03502\253C\336\245N\341\320\272F\365\343\317\256)\335\332\354\013\215I\337\031\232\263"
+	.ascii	"\232\331\002\006\031\255\031H\242\356]H\354.\321X\224\367:U\370"
+	.ascii	"\3616B\343pj\314\312&\331\256I\263\341m\247\233\031\255$\244"
+	.ascii	"Q\367\316_\200I\2603\303Y\366\235\256\254\324X\r\033\354\177"
+	.ascii	"e\317\034\223\310\001\326<s\235\314\034:T@\222\215\021u\217\005"
+	.ascii	"\330\005\307\271mf\017\037\354\177,\301\206\321\022 \020W\022"
+	.ascii	"\302\200\355\027MR~\274\366n\357\275=\263\213\334\342\274uM\214"
+	.ascii	"\260\253*D\326\013\337\354\215<k\004\252\263c\377\273u\256\250"
+	.ascii	"{\314G\242\242\300\217y\027:A:<e\212"
+	.string	"\335\211\346\331\255\350\331\355\354x(\320y\207\301\317N\320\210\023:=\274\035\220\016\210\267[\321\303\343\321\245\350\321A\241\333\341\001\351\030\344\330\347g\307\323\005\371\370\360t\351z\337D\316\021\352\241\231\036C\246\030\265\210!\210\311V\331\230\355\306*\003&M;\300\r.S\370`&\230\013\345s\223\363f\332e\226#\0328\226Y\205Rs\234\377\331\332\002ab,\033\033\352\336S\246!P\322.\2625*9Cq\335}t)\357\276\021^\221\371\r\273l\267\261h\177\207\312\003\327hG\200J\342;\373\226.^\304Z\027\371.N\\\327\b\247\\EA`on\366\331\264fV}\250?\354\177\270\016U\250q\030c\030SH\031dfDFH\234\306`\002\031*;\017\020`j\264I:b 3<\361KDu\205\237\267\357\276\214\221\006\255\345\237\265]\273\377bC7'\217\250\272|\272\241\267F 4y"
+	.ascii	"'\232\375\004\307\236\274l\211-Wn \\\356\334h\324/\225\2219\256"
+	.ascii	"GHf\375\004\034\356#\032\002\f\324\312\261\t\253c\332:Y\371\313"
+	.ascii	"\002\022R\234\232\277\007\221\371\337\266c7\371\202NR\344\270"
+	.ascii	"F\301f,C\034\347\367\257V\271\263lB7UIW\212N4\233E0\311\331\254"
+	.ascii	"\262\240}E\252r73\265P\301\232\333\36031\016J\236\202\222\255"
+	.ascii	"\276\227\307\245&\027\306\330\334\023\250"
+	.text
+	.section	.gnu.lto_onClientEvent.31.e57560bfb476d2f1,"e",@progbits
+	.string	"(\265/\375`\351\001\205\017"
+	.string	"F\334dE"
+	.string	"\257(\035@\342\214\256\177#\335C\350\227\360<\022x\215.;`\316^\240\240\377P\002\372\026r\256\327~\275\231V\266\211\371f\37413\266.\003\252\332y:\227\330\004\213QXh\220\371\021!\204\220-eJ\001Q"
+	.string	"M"
+	.string	"M"
+	.ascii	"\253\024\024\213\314\356v\212\341\243s\233\226aQs\344\237u\016"
+	.ascii	"T\221\316\275T\362\355(R%\0058\244HR\273\360\f\245QMH\f%!\243"
+	.ascii	"\205k\344p\221`\221\241:E\215\221\f\340YO\n*S\246\246`w\235\240"
+	.ascii	"\252\302"
+	.string	"\215q\333&\266\023\330\371\232\2161\255\232NM?\300\202\224\314\n\216\227\335\221\027.\266\205\225\320`\373\032\333\031\036\304\350+Nq\001\273'0\007\266c\016\267\247}\017\3770\272\212\310\334\256\311\210\226\335\320\200\273\355\330\3065\262c\361\003\262c\036\3311\017QV\013yPUk\2756\234\224tLW,\317\247z\244\234@E-5\265A\020\362\240;.\373r\235\224t\224\031W\213Z\224]\033\260`N9\343xQ\306\351\025+\271\260^B\220\230\362\205\035\222RW\366\343\356\256\365\304\276\312\317}\345\327\002\233\320\246\023A!\020O\304\313\314\351\b\341\204\030<\330x>\017\324\201>O\304\363u:\020\317\346\243\343|\240\256c\303\237\020\357\353B\237\317\327i\302}\\=\211&R/WIM\\\206\347 \017:n\221@T\217\224\026\232\007\200\210W\013AKE\207LW~\204L\3651\030\037\237+ "
+	.ascii	"\003\0211s\fsB3H`\306\313-C\023T\202\341w3$\270Tg1qp\t\342w\r"
+	.ascii	"a\256n\255.\316p\221\260|\025Vy\235\302\274\242\262\2334\332"
+	.ascii	"\367\306\200cGs\007\325L\365^\260:e\344#q\223\373\361i[\376\n"
+	.ascii	"=\317{5\345\330\243\233\242\215="
+	.text
+	.section	.gnu.lto_onWake.32.e57560bfb476d2f1,"e",@progbits
+	.string	"(\265/\375`\303\001=\021"
+	.string	"\346\340sG\340\322&\035P{\254F\222\252\352\\\223E\035ev\211\216\371u \017|8\321I\220\275o\351\020\354I\243\261B\024\332\302\275M(3\335jL1\274\243\203\301(@\370\3147\004l\231Yxj\271\271m\220\275\267L)\\"
+	.string	"["
+	.string	"c"
+	.ascii	"\340\351j_\305\203^\027\332`\324nOP\321.x\342\355\364Y\362\021"
+	.ascii	"\355S^D\373\364\313\336q\020hC~b\340\204M\273\273E\022\177}\312"
+	.ascii	"\250/\037@\f\3669r\031\342Q&\330\261\001\"\025\263\221#I#r<\274"
+	.ascii	"v\210\325\250\206\250\354\256\365\213\345\334\332m?\260\255b"
+	.ascii	"\253I\332\347\343\303k\n\235\033;AB4:\263A\230\306\037\373q6"
+	.ascii	"\233\315\034}\354\013\375\250\017\375\232\246\216S\255R}\001"
+	.ascii	",<M<\024(\355z\230\005Y\331\244\201\342D\277\375\207N\331&\232"
+	.ascii	"\371\336|@\341\2045\230v\213L>\275\300V\360+^\037\262\216\023"
+	.ascii	"\330\365AJ9}:@|@\265hC\210\240\377b\f\300\301HV@\347}\244\331"
+	.ascii	"\022&\254\310\232\230l\"\314\"zr\223k\264W*\244x>#\306\200\315"
+	.ascii	"r\031\036\t\220F\n&\224>\235\001z\272\221\264\267x\270:\001\372"
+	.ascii	"\036m\356\202\376s\311M\204\331f\035\206\217H\226l\f\177\341"
+	.ascii	"r\332\335\024\027]\013\301\322\356\276\204\206\256\227\230\326"
+	.ascii	"j\252\\\252\026\351\271^8\031N\363\n\005f\345b\311\240bu\234"
+	.ascii	"\267y\035'\303\352Z\266\027\226\312e[u\336\206R\342\026\f\327"
+	.ascii	"m\256V\253\333R\340^\256ib\315\345\356\356$i\340@\377YF\230\032"
+	.ascii	"\371H\022!g\344n\017\203\023=\346\364\370\3014\364\023\337\216"
+	.ascii	",\306\037\373\236\026\243\005\0268l4# P\002AHY7\342\3209EX\311"
+	.ascii	"\270m\022\244(\341])\355(\005\331\255\364\316\236\215\230S\233"
+	.ascii	"\2677vm\330\252\021\016\254\230c\3544\306L\205\301\206c3n\375"
+	.ascii	"\255\266\2717\320\3405\r\024\006\341:\202j\234\362^\2605e\370"
+	.ascii	"r\267\327\022nJ\221\367"
+	.text
+	.section	.gnu.lto_onAccept.33.e57560bfb476d2f1,"e",@progbits
+	.string	"(\265/\375`\247\004]\037"
+	.string	"\006\371\312I\220XN:\200\001!gZ\356\341\344^\340\017W<%]>\235\377F\2435,\317vF'\263\334\240\247g\324$\336'\375)\245\374n\022\217\244\2436\242\304\002fV9\276,<\016\241{1\241\036\310tk\322\b![&\031\256"
+	.string	"\252"
+	.string	"\271"
+	.string	"-l\007u\367\357\372\222\315y%\250\372:Vuw\005.\242\335\021\262\211\024\222\234\035\327\272o8\270\271\023v\031\371\254\364Z\333\345\002\272\243\250\350\2407\027\211\236w\177\274U\372\253\031{\353\376\2015\326\215|\260<\364\346\3566\347\315\362\272\363\346\246\273^\216\244j\233\224\231\244\256\265\356\346\325\251\247\267\235fY9\335\013oc\372\211#2\335\254Ja[i`\304\245\227e\203\242Y\216"
+	.string	"D\032\245\215\025(.9\342\021\327\022'\351\214\220"
+	.ascii	"D\243\322\300\232\220\354K\3165\210H\3146\013\335\275<$\342\370"
+	.ascii	"\242\337]\030\273\273b\267D\006(\312\225\205\323\221\242\325"
+	.ascii	"\025Sa\211\001SOt\352\352\263\256d\215A3;\3422k\303\273\033\375"
+	.ascii	"-;\367#\316\177\375u\227D\t\376PWwIU\270\273=\027\333\262\001"
+	.ascii	"T\273&\336\304\007\355n\235\260\023\275\033-\335}\243\357\274"
+	.ascii	"\371z\273\372\357\334Uq&\277\3251:E\025\217jE\234\334E\n\271"
+	.ascii	"J\355\276&\223\311\344\326\250]\335\265\376\032"
+	.string	"\033/\215\311\2333yq'\357\r\307\213\336xm(\357i\3435M\336\322\344\255'/\233\274\337\r!\327\302\360\276t\333H\232\3513\223l\310\271~\257\225\261\023\n\350\261(\343X\247\256\332\240R)\376p\313n\322\342\202\207\273\351\324\323\006\330*\210'[i`K@\236\245\001\217\247\342\361f\337M\203\034-X\251L%'kj\f\270|:\244+-\302jG\037\346\3744\222\"a\220v\354\246*\334\234\237\353u\214X\225\332\267\244<A\231\nX\227$UB#Vd\261\244\221\205\225\301\363\254(\266\266 \340\232\272\233b\355\360\207g\245\021\353qvT\205{\303e\375\327\247`8\221\242\261\033\351\303\f(\322\205\005\273\0326\360\207\273C:\224G\201\2617.\207\016\374a\207\363\246YoM9\257\265\254\274\225\305\253h\304\311\345Z\353\223\316\254\207?\001\021\213\033\302\t\361aGD\317\b\f<%"
+	.ascii	",n\b'\304\207\035\021;`p\007\f\376\204z> 0\330\333\311\360\361"
+	.ascii	"\030\370I\301>`\260\372\b\371\374\224AB@_\f\337\271=\b/zB&Z\370"
+	.ascii	"\374\200|A\274  _\214\037\320\017\017\370\363q\301\353\001\005"
+	.ascii	"\361 \3546\370\302\007\304\023\n\006\201x9d\277\354\032\265\026"
+	.ascii	"\212\252Q\331\335m"
+	.string	"+\340d,Z\235\217SU\250\234De\367\217\n`\2648\2717\234#\223\022S%\024\251g\301M\23214\270\232\273U\\\230[\345\341a,Z]I\340\007\3179\312\224\352\310=!yaA\200j\307\273\004\017\240\325D+3J\003[\212\3005\365_i\217\324\007\332]\364\341?#V\250a \003\215\222\206\031\232@&\310hIs\200\002\221\271\262\016\021\300=\"\243i\241\324\001c\350\211D\004\372\264\020\202^VM\210rF\bi\345A\247\375\337A\036J\216x~R\220\3664Y\304\343q\337>>v\0133e\245C\273\364\257\034\337\210\234\261\365\036\224\315\204\360<\334\251\303!FE*\\\226\\\200\216l\356\200\260\300\235\025\341\333\006S\236\206\002SJ~\"\215U6S\260\317n=\304/<\377\322Py\220q\355\033\225\270\257t\270M\351Jdg\344L\344\353\037\002\227(\265\275\336`\271\256\314"
+	.ascii	"\211{tq[Z\036\365\202A\251\020\357i]\350h\005\210\321\365\252"
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_tcpListen.34.e57560bfb476d2f1,"e",@progbits
+	.string	"(\265/\375`\204\003\325\033"
+	.string	"\326\263\270I\240\230Q:\200u\273"
+	.string	"\362\006\217\244O\332\2248\021\034\334:\344\230:\026CBe\200\310\b6_\334\361?\253\373!\350\302\376\355IK6x0\036L~\201\256\337\221v\370\005V\n>\240\311;\373\201\342\322\267F\b\221;\311\242"
+	.string	"\236"
+	.string	"\242"
+	.ascii	"R+c\202\300\351h<\322\335\023\240\210\212\024\234\264\"\300\216"
+	.ascii	"_\002\374\023\013\332\360\330H=\343\321\330\325-\243vs\037\300"
+	.ascii	"n\276\003\324+\331\253\215u\357@\002\245\273s\026\205\335\334"
+	.ascii	"\335\275\323\215\300\335\253\362\310T|\021\203\020\243\272\272"
+	.ascii	"\033\245\235\300y\263\274\200\363&\3678\360\257\323,\271\002"
+	.ascii	"\367\301\277<$\221J\213H?\211\262\242Q5\313\035\250\032Df\305"
+	.ascii	"\026\245\204.UF\265\204\3218\227;.\232\270\314\212\303R\250\312"
+	.ascii	"\306\245^_\024\205\265\276*t\367\326\264x\364\205}w\207vw\267"
+	.ascii	"\313G\001\301\305\3412Y\272\270\212j\222\273\2203|\224\274\364"
+	.ascii	"\231\226R\025\346\245%:c\374%bt\224\331\202eX\321l\254\326N\223"
+	.ascii	"\021\254\337\253s\227\247\242>\215\361\245\036\033b\246\317l"
+	.ascii	"\031qp\367(\254\274\264\373\262\231\307\315Y\327\346J\376Y\354"
+	.ascii	"u\313\327\345\327\255\005\016\200Q\272\321C\bg\035;F2Mc\231Q"
+	.ascii	"\204\374\351\207\372\231\334\311\253\200\033Tv\322\221\351\250"
+	.ascii	"\201q\313\330\325\301\256"
+	.string	"\355\021v\001\273\33779\325\256l\205>\2658JMJ\306\356\226\t\355\312n~\027\270G>\352\001Sf\355\225{\220\264\032\240\312\302\205\372\264\262\203\034G\222\310\321\332\305\360'\031V\207\263\204[\250f\330\360\256\206#9\\\352\n\210t\021fQ\2211PoxO\325\341\303\371\324\206Ou\230\027\0330tl\r9\270\234L\316\370\206\267\022\223\2045\271\365!\316]\020G\206\250\321\352n\035S\n\227#\003j\315\367\312Y\373\276\212\210}\272\237r*#\366@n~\352H\0223\246\356~\272axn\325\n\tkV\313\347\316O=\312D\345R\002\322=|z\253\343<\306\273:\024\365\3512\030\203\245\2238{\302\326\273\t\375r@D=\350\017H\327\203\006\355L\344\f\005\355t?9\017txt \f\2419\\\320\217\317N\207\372~A\250\rW\242\346v<\366\341p\267\022\310\307\353\225\353c\353\371"
+	.string	"\361\374\334t\276\334\017\375\371r+t>\034\272\323\335R\240>\276\037j\243-\257\227\363\241@<\236\017\225\035\213^6\363\330\027\321\n\321\312\334@DB\264b\333K~\261\273%o\205\"\026.\213'\242\262{\307\316\241\376\255\247\232|-\250E\200Fj\254p`\r9\370\372Q$x2\3274%\250"
+	.string	"\200N\300$\365)\363\211#G\013\016\236\353\213\226> P\"1\220\335\r\203C\367\3118\031\344v\215K\314*\276\275\037\rk\310\200)L\332\257\336\025\242\235A\025"
+	.ascii	"G,\231\256\366y\026\242z\272Z\267\215\034\250\235\366\301V\257"
+	.ascii	"\305\037\021\251\304\034\264\260w^\364#\320\302\275\023\354\n"
+	.ascii	"B\bQ`\212x\301E\231\225\"c\204\340!\233\023I\213\246\360\353"
+	.ascii	"i\331\322\303\210\265\316U\206\341\232\254\305\304p0\0023\254"
+	.ascii	"\025\302\007RZ(\213 t8wI:H\353\020\240;\241\325Uh\321]$\255\025"
+	.ascii	"\036#\206\005\005"
+	.text
+	.section	.gnu.lto_tcpReconfigure.35.e57560bfb476d2f1,"e",@progbits
+	.string	"(\265/\375`\307\007\r+"
+	.string	"zL\374\020DP\346M:\365\377\203\240\341l\252"
+	.string	" (\256\333\307\273\247\345M\300\t\021B\250\3026\264J\363Fm\340\340\035\020Rt\020l\314\363BO\001\254\016\255\214n\365\341y\017ql\260b\260\2325b\t!{'\031\363"
+	.string	"\353"
+	.ascii	"\005\001\3676\252\336\306\351\355\213\336~\204\005w\313\"K\344"
+	.ascii	"`g3\207=\357\362\\\212&\312\275\374o\277\335>\372_\016\327\277"
+	.ascii	"7\005mslX8x\321b\273\232Y\331!\316\216\315.\347\354\340iWX\373"
+	.ascii	"\336\3567\317\305\307\273\264\232\356\345\234\244\217\231\234"
+	.ascii	"\263TKX\237\262\350\225\324\373\266\366H93\343\230\311\271)\325"
+	.ascii	"\300\365iw\367\265\234\315G\267\004\232L\306|\3168__\354rn\002"
+	.ascii	"\273\371%\365\351z%\365)^\362\366\276\336\312SS\024\337\266o"
+	.ascii	"\274\217\354=\237\222\354+\332\264\204C\366:bD\320\247)bf\227"
+	.ascii	"\327\241\355\216\255P\222\261\263\253(\206=m\334\030)\277\320"
+	.ascii	"\265LM\ry\323s\235\035M\217un\3160J\262c4j\t\207\314H\351\205"
+	.ascii	".\321Q\322\347p\277`\312\343"
+	.string	"\275<\0179\347\276I\345\330\373\367\356V\353n+\335\274\031\001\267\373\004\n\365I\214\361\032\"\272B\200\216\016\302\206dUKu\302\347r\b\211 ;p\b\\V,\277\325\250}\006jw\212\025\367I'|\304f\316\013\033\357\231At\216\2448\3558\r =\031]\272\027?\356h\\|n\271\2263\362\311\027+2\004\024\214\030\367\311f\275\260\261\373e.\247\243\277\3262\202A\365\351\3058H]\026\263CI.\347p\226zL\303mO\3275d\342b\262\326\234s\206>\230\207\231\352\257=\355\241\215\373\344\323\276\r\365\351\261\226\345\335r\013\032\256\373\354n\032/N\353>~>\237\317\306\314\356{yG\275\355G\360\267\267\323\273\374M}\233)\275\275\364\273-\340w[\351w;)\275\215\364\273\035\340w\373\350w\333\310w\033\300\275]\344\273\375\353\335\366\255\267{\275\333\353z\233\307\273\255\246\267\323\230"
+	.string	"\323\216\333\234\016\267\310\253\375\272OFa\266\013\033[\312\330\204\2130\217\t\347\346|[\036\357\2635\\\004\370q-X\013d\315\231\353\311;\341_X\253\274O6\232\315n\327\215 \367\330\226\375p\t>7\364\036\366\335<\344O\037\"\"\277\353\341\2558\347\204\033 \2775\242\362\360\212\326\"A\332\341\270tJN\250McZ\261TR\310 \253dw\273\344um\223\247+\017o\305\315I\nQqw\353\344\201\332'O\006j\302*\306U\276\034\235p\211\242\034\020\003&S\312\375D1\217Py\237\006hwV\276\347\001\232\335\230w\267WN\227u\241\357\364\320f\301L\324\247Qhuu\216'k"
+	.string	"\335\235\rh}\376,\265?w:Y\255\226vK\273E}z"
+	.ascii	"\215n\311V\307u\237jy\302\034\341\261\027\225\363\001\304\212"
+	.ascii	"\234\202\352\026A\002\371&\305=\263\267\341\321j\276\326\357"
+	.ascii	"4\270\310\r\217\2303\003\001\355K"
+	.string	"\220@A\373t<\261P\361\241\005[\264\252\301\352xb\205UD\032\005\332'|b\245X\341\220\212\030\254\301\nk`U\rw\f\227\332\227@8\354A\244\n\022\261\210UDVK\030\034\026\251\202\354\025\221\305*Z\3458 \0341\274\021\314R\205#\252\206XWD\252UH\274W\357)\b9\246\260dP\005\211\305\341\025\360\2528\334A,\n\201U\304 \016\340T\361\n\b\201m\253\034\303\"\020\313\312\252\b\3745\363\321\214\231\315s\376\201\223S\237\347\207\273\211/=_r(\002\314\204\301\272\233\t\267\007.|D\263\022\026p\266E\250\320\212|\020\250\247KC\226\304\236\204\005\334\260'a\245$l\241\256L\333\375\0212\247w\024w\313\266\016m!Z\221ZPO\221\276\356\030\022\356\231I\031\003\340#\227G\006\252\021>z[\036\2150\205;d\266\236\027\371(\f\340\307\215\":\343\005k\313\234\230"
+	.string	"\300\023\300\310\375\t!*\315\025\247\255yT\200\206\250a F\025UDh&\210$IA\n\035\240\"\221*\253\007\021"
+	.string	"5\006\235!\221Q\222\244\351\303Y"
+	.string	"m\365}\227\022\205!\377\355\250\2334\247\016+\241Xh\257h\313\t\325\302\233A\210\207\266Z\255\303\223\303\316\273|\204\352\376\255\213B\324U\034L\020\007L\345F\307b\306P\262\264L;\215j1\326h\214.\242\024d\b_\371~\231\021\034\tm\205\3428\003\360\357\327\344\323\217\203\366j\202\372\033\202 \230*\350\006\377\343\t\246D\026\035\030\231;\0057,\357V\001\235\376\367\2011S\333+\216\r\202-+\001\227\264yM\bw)g\264\227\2262\222\2700\205\024059\367\262\222k\255JE\243TN,h\237\211\362\033C)\210\363LY1z\247\335b5\032^\004\276\301\024\231\210H\252\333\244z\362\332\365K\301>\342L\216\005\002\240\201h`Q"
+	.ascii	"\b\362\030\277\352\254\201\265\303\302\353\322\007O3\375J\032"
+	.ascii	"\376\240#S\336H\251\245@BD\246\225\327_;\231\253\250\350X\177"
+	.text
+	.section	.gnu.lto_serTcpOpen.36.e57560bfb476d2f1,"e",@progbits
+	.string	"(\265/\375`\227\0055\035"
+	.string	"\306\362\266G\220\232Ucp\207\002"
+	.string	".\004\235 \310\006\205\350\366\344\363\304\037$"
+	.string	"\034\251\222\306z\243\220y\256\235\302\243hq\230MiP\310\273\343\317\304j7\213T\034\373+\022\fbK\004h+\021]\231\320\371\333\336[\312\224\002\235"
+	.string	"\225"
+	.string	"\251"
+	.string	"\027\370c\312\007\363\350\345\254\347\002\215;*\330z)\030\027p\3570\016\325\275\305\007\216\020\373\351Z\355/9\023\243\027\235\305:\367\372XBu\357}`Z\354\347\217i\333\207\272\022#\377fE\242\rXV\220%']\367\026i.\276"
+	.ascii	"\3723\366\001\350O\013\344\277\243\247i\353\317?:zDc<-\327\227"
+	.ascii	"2X\310\240\360\246I\201\213\024\031\236\240\222y6E\361\330\t"
+	.ascii	"\002\2535\007"
+	.string	"\334\330\272\342\t\002M\007Z\301\034\237ze\n&\325\n\263p\357uM\2036n\330m\017\331\266\331gT\257r\363\207\374\264\n\\}\372\323\307\241?\253\215\200\374J\205\365j\314\214*\366E\350m\220\361\013\260\3021\314\336~\352\013pT%aA\231\203T\277\354\342Q\265M\366\315k\207\366\221\277\317\237\374\b\036\345\237\375\370\033\270\324O\340\311[\366\342\017s\365)\2536e\3256V]u\252\257\340;n\227\232\016U\367\322\370\222s\305\234V\234\236\374m#\177\312;\266\223\271\337\0305t\322\031B\322\334[l\360\323A1\030\262ES\217\023h\024^\211\363\211\317\354\tL\332\3246l\206|\210\027\276\006\203\217\322\352\222hR\341\362\266\206\247As\325s7\\\353\flh\325\305\341YJ\017\277\262\262J\302u1\267A\274\214\217\214\315\222\256\361\241v\210\207\361-P\202I\240\f\200\303L\027\327\275"
+	.string	"\035 \336\033\343\251\317\345]D\230$\200\320\247@%\276\005\210\207h\233x\025\212\330\275W\202\226\0256K\274\367\236G0F,\244\020\251~U)LE\212\347\217p%\233\230\317\2412;k:c\314\022Pa\266Z;E\255>\225\331\037%{d\377J\016\300S\333\272[\2611P\336{'P\005\274\363X\344p=]\016v\023\312\025\231\267^m\204\220\257\026\024\253\365j\031x\206l\265 \"\242\032\206\027;\231\020\256\332\006Ag\353\245 \252\341v7\036\215\267\273\271\300\355\204h,p\265\"\232m\307\243A\370qNw\333\321z\271\334\216\266S\2747\257\035\032\r\342\264D\345\224m\310\202\202B\305\364\177\350i\231l\237\326\026\220l\022\352\343T\231Z\244X\266\274\020\020\2512|Kf\266\236fE\252\022\017x\016\227^\006\214T$/\353\321q\371\244\203"
+	.string	"\222\177\301\230\003\324\362\322a>]N\034\257\037\324\273L\253K\276I\205\326\332\277\250\273\371\005g\250QP\306 \"\231!E)H\222\341\340\"\021+n\003\021P\255BH\031\211\202\262\244a7\354\255fK\316w\177\026!\305\n\262\2205\271\341\f\356T\236\340l-\270r\345\236\271\307\256\323\346\246\240\277B\021\310\217*\252gN\241mN\231\215g\350\n"
+	.ascii	"\306\232wA\313\241S\213\300\376\356\240\356\274\335\205\f\273"
+	.ascii	"\004G\207\256\260a\022m\372\252\246\346\2570\206\013D\263\036"
+	.ascii	"\277\006\274\002\211VN\001\313\215=\351\2259\007\233\374\372"
+	.ascii	"\342\240T\313.\337\034\247!\3565B2\347\255\301Y\376^\312I\231"
+	.ascii	"T?2S\277\016J\223K\307k@\220k\306\274\035\220\344\002\237\030"
+	.ascii	"\364!\222D\022\233\324\326\352<\0071\231\321s\256\002"
+	.text
+	.section	.gnu.lto_tcpTotalRxBytesWaiting.37.e57560bfb476d2f1,"e",@progbits
+	.string	"(\265/\375`]"
+	.string	"U\t"
+	.string	"V\322A8Po\322\001 \306`\373\0261\247\205r\301\260_\377\206\213?]w\357\234\346\326:\037\210Qc\243\221\013r$\265\2316C\214Pt5\027\254\316\364s\2240\262\311\336)\0052"
+	.string	"0"
+	.string	"2"
+	.string	"#\253\246N\327I\313\205Jf\267\316\354\004\327\245\365\315u\0319>:\034\371'\271\365\201\262\372N\244C"
+	.string	"\205\3355\374N\031w\274m\003\333\t\266c\002?\214\320\27760,\013/\273\030\253\231]\221*\036\266E\266\3066\204\366E>\"z\255\370\300.\312%e\267\036xb\227\256\230m\037\344!\"\007\236\016\376\22313E\222}\325\204@j\327\364\317~\270\211\207\355\232\020J( \nR\035\227\276\304u\371\370O\243\004Wv%\301\270a\337\332\210\262|\r\233\366\351\204\274\017\207Y\343\200\264\020\203C\207\243\2337=\272Ep\264a~\270\216gj\324\233\234\314\035h\2433\324utj\352\3362f\245h\341"
+	.string	"\370h\007\f"
+	.ascii	"2\003\3020`\303\355\030{m\317^\327D\220\211f\323\310\035\230"
+	.ascii	" \340\204\221j\305$L2"
+	.text
+	.section	.gnu.lto_tcpTotalTxBytesFree.38.e57560bfb476d2f1,"e",@progbits
+	.string	"(\265/\375`]"
+	.string	"U\t"
+	.string	"V\322A8@o\323\001\340\243+K<X\035\033*v`\300\335d79\250j\350n\373_\377\275\213v\360\323a}\\\337\b/:\343b~\257\016\020_\030\356:\017\366\240M\366N)2"
+	.string	"0"
+	.string	"2"
+	.string	"\"\253\242L\327\311\314EJf\267\322\354\004\327\247\365\315\365)9.z\024\371'\271\365\201\002\023\232F\217"
+	.string	"\n\273\353\030\2322ny\333\006\266\023l\307\004\177\224\321\2776\252\226\205\225]\214\225jY\246\212\207\355\220\255\261\035\243}\221\217\204^+>\260{zI\331\255\007\246\330\247+f\333\007yH\310\001\035/>\2342+\311\221\375\324\204"
+	.string	"j\267\364\320~\270\t\210\355\226\020J( \n\\:>}\211\353\363\362\241\006)\256\354:\212r\303\276\265\362\344\371\032\334\346\321@\240\247\303\274q>\033\210\301A\353>\016\244\340\307Et_\003\365tZ\207n\037H9\231\275\017\367Q\220\347}TS\367\2362#I\013\007\304K;\f"
+	.ascii	"2\003\3020`\303\355\030{m\317^\327D\220\211f\323\310\035\230"
+	.ascii	" \340\204\221j\305$L2"
+	.text
+	.section	.gnu.lto_isTcpTransmitBufferEmpty.39.e57560bfb476d2f1,"e",@progbits
+	.string	"(\265/\375`d"
+	.string	"\265\t"
+	.string	"\246SF<0\345(\035"
+	.string	"p{\375\250r%`\034\241\n\250\334\224\032n\313T4U>\224\\~k\365+\240\262\006\2431\033\031#\311\003KC\001d,\355E\220KG(\260\301\304\222\330-S\n4"
+	.string	"3"
+	.string	"5"
+	.string	"\332\263\355\004\3323\333VX \271\364\321\265\272\310\206j%\300\3568e\310K\327\222\377\223g\037./\"\313t\3358\354\256Udq\334\362\266\021l7\330\026\020\273k\331\262\366\327/5j\225\352o\f<b\036XvW\261\001\013\223\301Hl\223l\216mU\373%7!\375\245\361\201\335\326L\313\356\230\340\271=\363\370\202(\215\231\243\227\366\004H/\252\354\244\244\311\276J\206\200k7u\321\376\236R\261\355\246\030P0\302\003\327\3103\337B{vy\031\261\343\2441{4\251\004\261\257\331\035\027\372\214\302\220\267\231\363\210\270\021\004\305\307\003\273p\206`w\341\201\0213\344}@\223\003\303\351\351\370\023u\340\034}\03789\343\336\232\354\234$\312\276\204\246R\223\032"
+	.string	"*X\t"
+	.ascii	"2\003\3020\240\017\027cLk=\333\270\214R\324x\250\016aL\327$\003"
+	.text
+	.section	.gnu.lto_tcpRead.40.e57560bfb476d2f1,"e",@progbits
+	.string	"(\265/\375`~\001\335\017"
+	.string	"F\036lF\340\264&\035$(#\314\311\270\017\005nx\263\256\037\r*c\024\361\023u[a\240)\276-T\330\241\032-\252\203P6\036\266\356\275\373VAbP\0160\001(\022F\003;\340\373\343"
+	.string	"y\330n\237\022D6\2212\245V"
+	.string	"S"
+	.string	"Z"
+	.ascii	"8"
+	.string	";\273\241\001w\334\243\303\247l\217\334\003l\217\266} A\313\337\303\232\230\315\306\004\t\235\240\335\260\323\026\377\256i~\376c\327d\b\351\001\302\\\327P\\5\0022\037GD\260\227\226\022\363\002|\354Y\002\006\223i\342`w\235 \354\304\035o\373\201m\006\366\213\004>A@\231\177\333\303k\217\216 #/9\263CW*\215}mw\327:\343\320o\376\030\323\252\245S\323\027\215x\206P\230\355\306\314\226\354O\374\001\343\341o\267\374\230O\374\360\3436\206I\016\033\025\262\335\235\002\217^\300e\332\247\361\032\255\337\2048\312\356Lz\301\006\221W*\361(3\325\2260!\017\252\"X!\202\307\207\001\025\276\303\202\nP\252\347\203\004\224A\311x\367l6Ki4\343\347\245.\213\362?m\317y,\003w\265Q\033\362\240I#\324e\037\007\210\004\002\355\226\353\250\270\335Up\203\325aT\343\342\321_m\217W"
+	.string	"\001\032Ly2\245J\254U\n\305\331\264\342bb\261p(\241\274\323\252[y'\017(\017C\227B\225Z:\223\267\352VHV\271\234\274\216\245Ry\335I\270\327VgBJzQ\030\177\332.\213\006\017\177YN\316\374\360!U\035\236$)4\001\031\325\206\020!\004\004\3475Jd;\2524\276\312\246\001\034"
+	.ascii	"2\241\357\037\030[\004\257\260\356\032=\0360\033\200\0318\233"
+	.ascii	"\306\341\2620!\024\270\003\020\0048V#\r\300\230_\224\205=\373"
+	.ascii	"\362\\\032\263\317\371-`\246\260]\243\202E\224\234\205\215\t"
+	.ascii	"\311\313S\315X%\350\224B\355\001"
+	.text
+	.section	.gnu.lto_tcpWriteBuf.41.e57560bfb476d2f1,"e",@progbits
+	.string	"(\265/\375`L\003\355\030"
+	.string	"\206\355\241H\240ZQ:\255\317\211\024\322L}Vq E\255\217\262.\265\320uM\023\251\210\361\034z\321(@\306Y|\353\277\303\223m\243\273\246\227\267x\306;\200\027.\325\216M_\237c\215/\274\332\331\352q\026-!\204\020\271S\n\215"
+	.string	"\204"
+	.string	"\215"
+	.ascii	"En$\367%\025\027P\253Q\222&\265\006\035\370e~t\360\003\310\217"
+	.ascii	"\346[\344G\347l1\017\342\250W\262\243\207\304L\255\365\2657L"
+	.ascii	"\3466w\033\226Y\222\343\322\234\257\240\212\360\004\352n\223"
+	.ascii	"\200\306P\321Y\"\203*'e\376\343W$\016\020\352q>\313\017\0065"
+	.ascii	"o\200<Z\n{\224L\"\372(R\035^\306<\313"
+	.string	"\357\205\330\023\205H\350P\247>\340\n\272\027^\0242\224:\201D\247\345\204Z\253\351\t\034\272on[\311\366\005{{\002ev\217\354\240\216\362\270\240\222\303kd\273Z\177\272u\336\364\347<\370\003\370\322\217s\247\333|\323]\262\250I\026\365HR\213&\365\226\324\224\244\276\201\002HX8P\325*t\245\246N\215O|\374\351w\262\237\304\207z:a\352~f\224\217H\005\363\343/\364\215m\247\024\257A?\226\317\347\243\252\326`\203\217\246`\357\2213\345\336d)b\200\nT\203E\223Z\253\003\367\230\037wD\0324\225\230\b\247\366\0039[\256\257\334\036<\300\210\265\326J\022\240\266\206\r\005\206\246x\253s\213\342\254\335\301\003\375\351\034)\340\024\320\352\236\272\330\220\032\367\310\r\356Z\004<\3220Y\001\242h,\256k\337\263\332}\305\2250\244\nB\3325\267\265\017\002\302\243W\326\331]\236!\227\236U"
+	.ascii	"\3725\227\256\r\213\321\237:\273\023\264:\373Q&\026\234\266\354"
+	.ascii	"LF\230\265V\236%\"f\020p\354 A~\244\373\223\250\334\357\241>"
+	.ascii	"\266\030^\351Y\355\350\325\016\213\234\0024\031\0167\263\245"
+	.ascii	"(\177\216\243\235\250\305F\030\016\026B\224\305h0\334\21563\035"
+	.ascii	"{\360\023\303}(\001\233\331d\267\327\315&C1\263\205x\321f0\237"
+	.ascii	"W\314v{=\330q\355Gf{\341j5\333+X\277F\336\2204\265[\236\016\033"
+	.ascii	"\034)\031\002\252\264T\261\366\b\312\311\005a[\270\024\037\223"
+	.ascii	"\334\r\262\345\314\322\216^\231\367!\307\375\020\246/\0070d\240"
+	.ascii	"?\307\307\230B\346af \231)\367\310a\224\242\306\326^xVR\020+"
+	.ascii	"\n`\315\365\035\352\346\032%+\243k-\322A\250a4\303\214b\b1\t"
+	.ascii	"&\034\031Y\314\030`\002\021cW\036\020P\252\304\251ti\302ha\363"
+	.ascii	"l,\331\200n\304c\036\324\020\317\236\270Q<\256\024Ut\264:\334"
+	.ascii	"Q}\236\036\2202\316M\201\305U\361\263z{\305+\261~\327M\003R\354"
+	.ascii	"\333\225q\177\036\220\262\303&\007\002h\272\301g\016\3646\244"
+	.ascii	"7U\320\250\3000*\323\035C\3333\274\361$\371\302\320D\303\017"
+	.ascii	"z\264\\\030\350\035\362\006 \265\b\236q\003\234\332\\\335 \351"
+	.ascii	"hL|Y2-\363\007"
+	.text
+	.section	.gnu.lto_tcpWrite.42.e57560bfb476d2f1,"e",@progbits
+	.string	"(\265/\375`?"
+	.string	"\265\b"
+	.string	"V\221>6P\217\032\003 [\036\355\376A\210\256\212qE9\020c\241t^\035\264w1\310\201;\221-\247\213\367a[\204:3K\317\310\241\260\250\b\037\022QA\322m\245L),"
+	.string	"-"
+	.string	"0"
+	.string	"\230\307\002\034c\355Z\031\177#\367\312K\207\312\314\177\031E\334\031v\265Y\006\360P'\303N\303\377B\017\365\341F\267=h\313\320\266%\177a,$m\375i\033a\233\240\320\371\303h\374A\\\255\277\005\352\202ak\024\253:\2572\034\360\247T\255\377\003Uz\214\365\363"
+	.string	"\307\001/\215\270\321\016D\260S\314\342\nb<\030\333\212\013h\257\320\245\344\305\021O\355w\2021\244\365\346\377\033S\255W6\334\020\230\300<\270~\217\032\232\022\031\324\262\221\310\304\2156O\263P)3AL\210\266\251q\222\233\232\3056#\344h\023Q\310lr2dPRI\233\322D\"M\371\371\356\315c\252\016'\001\t"
+	.ascii	"2C\003\0258\036A\317\004\021\327\320Sap\200\n\r\356\362\242\235"
+	.ascii	"d"
+	.text
+	.section	.gnu.lto_tcpBeginWrite.43.e57560bfb476d2f1,"e",@progbits
+	.string	"(\265/\375`0"
+	.string	"e\b"
+	.string	"fP<8@o\323\001xa\342\225#\274?\234\342\224V\233\377\206\0028\311\376\204\356\326K\331\227\312\362\214d\373\013pA\b\327\030\206G\227\024-\273S\002\005|G\262\264\311\336)\005*"
+	.string	","
+	.string	"-"
+	.string	"\326\247A[\345\241h1\035(\027\"\250\335\245\222\343\340#\350\377\343"
+	.string	"\037P\347\021\243\260\273\216\037P\306-o\273\300v\202m\222\376\351\177u\023\t\305\2620\262\213\221z\331\224i2\312\330~\264_\272\t\374\251\342\001\273\241\223\222\335\360\300\364\372t\370\001\353\363\272@$\227\025\217\264\360\317\261l\210\207p\256\335E\360A($\244\310\343\323\237\260>\rF\"\215R\213'\246\354\260\023\345\206\375jw\3272\344Z\306a\237\307m\2273\315&\373\030\034\260\255j\036\365\252\026\261\325\006\312m\330\003\315\252G5\004\3566Z\245_\327U\232\t\367\325\312\220\247)\t"
+	.ascii	"2C7\025c\b\207dB;\230w\t\240YM\001wy\321N2"
+	.text
+	.section	.gnu.lto_tcpEndWrite.44.e57560bfb476d2f1,"e",@progbits
+	.string	"(\265/\375`C"
+	.string	"\355\b"
+	.string	"\226Q@9@\217\322\001x\207"
+	.string	"\023,\027\036\370\027\300F[\361\237\200iU\031\214\361\324\243Z\203yz\242\317F\013\341~B\260=\347\230\230\337\253ewJ\340\303\347\2244n\273wJ\001-"
+	.string	"/"
+	.string	"1"
+	.string	"\237\331\005\260O\2036\313C\324nBV2L\\\273K%\310\301G\320?\353"
+	.string	"%\323\350q\223\260\273\216%\023\307-o\233\3006\202m\225\327\354\356Z\236\354\257\376\317\263<\\.\0131\273\032\257\231m\315\224\024\307\366\243}\325G\300\257,\036\260{:A\331\r\rL\263O\207\357`\001\316\342\245\r\361\305\227\334am\310\264`\310\221}\021fG\274D\224\355\356\201OR1!Q\"\237>\005\366Y\220ju\250^H\361e\207\243(?\354\334\346i\241\317\3532o\036\320\026bp\320\272\312}\364\253\234DW\033\250\327i\017t\253\037\365\f\370\003\342*\r}>\225r\302\275f\345\311\n0-\222\274\b\t"
+	.string	"2\241\001\034x\360\200H&\264\203y\227"
+	.ascii	"\232\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_tcpWake.part.0.80.e57560bfb476d2f1,"e",@progbits
+	.string	"(\265/\375`q\001\245\016"
+	.string	"\226Z^E"
+	.string	"\2216\035\230\267\030\210\214\022\301:\333\035h\372\311\362\321\224\0254\322\253\006\214\023]\036\263\031\2140(z\317\3730\207VK\213L\360\244!#@U\325\244e{\316>\017\256\256/\035\206\273\254\033m\262eJ\001F"
+	.string	"L"
+	.string	"L"
+	.string	"\251]0\301\245gvi\360\004\256\313\354\003\256K\373)l\203H\016\3318\016\302,6BC\006S\315\356\316\313H\342\241G\265B\376K\337\214VD\217"
+	.ascii	"V<\\\005\334\302\034\354\256\263\017\267\274m\021\333\f\354\327"
+	.ascii	"\0043\177x\265\357\2678\013\337\305Q\326fN\236\324\311\363U!"
+	.ascii	"m8\244l\240\331M\211d\017M'"
+	.string	"j:\261\266\005\\\226\007-*\025\b.\255 +\335/\201lM\263\352A\320e>\005\300e!Y\325\376\212\307\204.\363\271\307\256\313)\321\346&\350G\376P\211\"\333$\227\341\032\006Tv\367\030\025@`vw\001\214\013\237_\342\322\377\\\227\032\261\031\241\216\230\337s\241~@\024\242\310\201\242+\215/\216\326\255\215.\266T\353\301\377\230\007\b\210\335\016\253\035\033B\3220\361[I\027;\233\027\277\233\023b\302\351@\2400\302y\3337?o\263\300y\021f\t7B29\3367C>\334\231l\336\354t\2357\265\373Yx\342\006JLq\214\361\305\266\307\332\025\321\200\246\244+\007\320\354\266q\375\305Q\022\246j\027\303G\032& `\002)\210\264\003\207\t\200\271W\007\363J\350\240M\002t\001\237H[03\310\302\200 \372a\376p\221\226\330\004\361\214%X_\242\304\f\367\002o\345h\332\020\276\340'"
+	.ascii	"\366\224(D\205\334\035\032\243\027\206\034/=I\273\335F\312f\003"
+	.ascii	"\340\366\"r\212\323\257\305c"
+	.text
+	.section	.gnu.lto_onClientEvent.part.0.81.e57560bfb476d2f1,"e",@progbits
+	.string	"(\265/\375`Q\001\r\016"
+	.string	"\026YZD\020\221\223\016\374H\201\230b\222\002 \373*,\324mGP!\302\261\351\315\376M\362\307}U\371\261\257\b}\177@\220@\216r\263e\332\202"
+	.string	"@M"
+	.string	"\245!R\337\335\212+\204\"E\017\3104id\357-S\nF"
+	.string	"E"
+	.string	"G"
+	.string	"6H\344\316\216\361\017e3%\021\027L3vw^\302\020\357\036\241\312\316?\352\032oT\362\250\336h\303a<\220j!\003\300(\0249NHxG]1\214LT\007\\f\030\354\256-\016wu\333\016l/\260\237\022)\005\326W@7\221l:t\\\032\252}\225\253\350n\"\261f\027\004\213\004\326\345&^V\375\007*\360m\006\221U\355\233\370\211\356(\f\343\002vI/-\273\037\202KO\353\322\3379\252K\353\004\252K\373)\016/T^B\ncK\017m\t\233\336S\310\361j\270\204`\211\302\222\241|\\H\262\245Z\377\375\317\0308\005\360\260{\022Cc?H\027%~\372W\256\366\355\247"
+	.string	"\371+\216\362ub\031\321\016\226\221\257\005\221\306\2530\"\3337\016$\023\311*\214\303<\242;\234\220\016\367 \002\346\321\262mnZ&\342\321<&\210\007\373\230\035m\233\234\215?!\2316\271\317G\233\327\343B\222\033hp\241"
+	.ascii	"M\342\005\341C\357y\003\025s\024\230T\013\204%\333\023*\205\032"
+	.ascii	"$ `\002\031\223\273\001H\031\203\270\030\371PVt\204c\224&+>\201"
+	.ascii	"k\021\277\007(\0346d*\003?\313 ;\007$\344.`@\3748q\324\206\021"
+	.ascii	"m\004\263\036D\004z\234H4P\223\253(\324\307T{\305\265\333\230"
+	.ascii	"\262\317@X{\26184\036\367\2560\006"
+	.text
+	.section	.gnu.lto_onWake.part.0.82.e57560bfb476d2f1,"e",@progbits
+	.string	"(\265/\375`\252\003%\030"
+	.string	"\366\252\225H\260XQ:\340\"\035\266\320\357I\007B\220<R\322\220\332ap\367\030\263/<\237\310^\340! (t=m\025\002\261|\324\362\212\311\252\366\201\367\2012\360\253\347\247\005\321U<Z\236\037\261\246\342\375o\204\220M\366N)}"
+	.string	"\200"
+	.string	"~"
+	.string	"\177\331\035z\202\333\265\035xu\b\276\332\366\030\357\025|"
+	.string	"\357\325\376\016\333\257\230a6\226\333j\373\321n@FZv7|\2454\016{\t\374\274\332\321i\202\371</}64\263\240\027\007ifA.\376\001M\357$\373\231uJ\314E\207\332]\024\262\023\263\233\244l\305ig\240<\222\345$\363\351bT\334 \217\373L!31'\314M\237\315\356\372=0\356\323m\327\260-\301\2468\002\323\363\266\377/\005\222\\f\354\252\310mY\241\212\004\307\221\376\"\377\355\027\362\316\276\375\037/\177\310\213\334\310q>!\035\215\266\243\361\304Q\271k\213"
+	.string	"\026\275nDt&\021\035\222J\223rw!\200\027\362z\220\035Tiw&\243\233\366\215\016\004\366 ;\217\201H\264[\311"
+	.string	"|Eu/\362\311\007\211\357O\254\004d\304\244\334\305\325\274Z\001\3509o{\311\3306(\3469\355\023\235\007\354=|%w\222\301Amw\027\274V\372-!YX\t\221\216\232\327\321c\321p&\035%Pe\356.O\2454%\2470\033n\346IJOP:\227yj\253\304y\322"
+	.ascii	"nM\244\370P\036\323\277\226T\342(\245\331\316\361&\345Pd\305"
+	.ascii	"g&\331\366\360$9\340\356.\360\221\224X\3716^\375\321{\2354F\013"
+	.ascii	"\0333\210x\364\314\334\2444S\323\273\245C\266i\372+M{\340t\375"
+	.ascii	"\246\273o\232~\001\343]b\213\216.\034q\204\350\271ptX\252\232"
+	.ascii	"r\245:tV!\020\241r\335\200H\255Z\342\030\216-q\304\252\325!\304"
+	.ascii	"Y\245B\204\252\326\030\"@\231%Bl\205.\026\253\025\236\336-\035"
+	.ascii	"\262M\0175Q\"\321\355\316\036\224>f\016\234 \336\254\226rf\036"
+	.ascii	"x\315?jS\2500O:\201\320\217\224\017\002\242\344\f\370\250\353"
+	.ascii	"F\216d1S\346p\362Q\232\375\035\317\243\323\212\314\254\324\266"
+	.ascii	"pa\236\364\350w\b\371OX\rj\244\215!Q\250\2210\346\030cfF2\242"
+	.ascii	")m:\200\002\2212\273\r\020@\350\206$\205\f\007<\003K\367\027"
+	.ascii	"\232J\322\016(\303[_\264\313\212\355\340\335\315\206\363\251"
+	.ascii	"\362\341=M1C\227\201\323\305\307\240\341\3545%\246\307\006\372"
+	.ascii	"F\2424\007\370(a\330\371@\206!\237\302\034\375c\232\225\314\320"
+	.ascii	"\210\007\365\257Ph5\316\305\246\215\022\230\013QE\372\005<1\233"
+	.ascii	"G\201D\272\353\330\236\314\321m\034@\244.\2415\350Zo\003\216"
+	.ascii	"H\001\017P\301\206+\331\024\023d\274K\003\246E\246NNF\225\254"
+	.ascii	"\"\017\261\003,\024DU\306F\023O\266\360\024"
+	.text
+	.section	.gnu.lto_.symbol_nodes.e57560bfb476d2f1,"e",@progbits
+	.string	"(\265/\375`\243\b5 "
+	.string	"v\261\266Ep\250m\016\005\220~(\037\274\317"
+	.string	"\202\362/m,\212\313Avvw\001\027\202\n'\007\207@t\t\n\264\203\222\265\"\t\230\220\t$\230\361\277\030\346\241\305\007\364h\353\025\362\340~\257\r5Q#\261/\221$\003\251"
+	.string	"\237"
+	.string	"\243"
+	.string	"\217\303\\|\325\333\342\033\260\370\253\025\217[\025?\225\342\255^\024\037\341\304;0\361XL\211\227\320(\020\305\230G\342\261zDN\024\241\023C\374\022\320\013\210\337}x\254\306\303c\263\016\377\224\304\315\024\016\357\264\341\2334|\202\f\177\324\303\360\270\314\351{a\226\221\350\030\267\nv\241H\264\360J\025>\211\367<\177\337\367mz\037\205\037\320@AL\322&\274\201P\n\r\316\024\t\2174\003K\201x\365\005\254\236\t\330\245\352\tDx\004aZ\346\205\352\017\214h\232\226q\301\3701&\0036"
+	.ascii	"\024E\321\251\207\n1\306\265&\001\335>\221\336k\207(\212\022"
+	.ascii	"\361\221P\244\233h]\004\006\213\037\317^\266\375+\264FE\312\236"
+	.ascii	"\017d\317k\273\030\327\332&)\373\3106\351\026\211\"\346#2\256"
+	.ascii	">L\331\351\340a\307\020d\317mO\364q\365\211\336n\222\350\335"
+	.ascii	"\212\336\252\222\350ZK\"\017\200\217\255\001\017=\013\251}\310"
+	.ascii	"c2!\217\323\004y\214\006\310\377\336\037\037\345\3431\231\036"
+	.ascii	"\277\340\345\361\f\336\035\377@\307\34329\036\233\301\361\370"
+	.ascii	"\314\215\307bZ\217\307^\033/\365\326x*\032\017a\306\3431\257"
+	.ascii	"\214\237\020\3431\030\214\307\354\213L\247\331\237\263.\251\263"
+	.ascii	"\255\034a2g\352\364\354v\246\242\205\210\222\315\017\0369f\026"
+	.ascii	"\330|t\031\330|T\033\330\274W\007\266\264\260-)Q6_z`\363\021"
+	.ascii	"\315\310\3641\355\2519z\262\220\2467[3\275F\367\327\240`Y6}h"
+	.ascii	"\355\225n\252\276\322\313_\331am\272\236D\225\236\325\306\256"
+	.ascii	"\0355g\224J\037\331Z\031~\205\341\023\354\225\256\325\256\240"
+	.ascii	"LP\363!\266K'`[\"\351\246\333&\327\2278L\244\227n\367\236?gk"
+	.ascii	"\023\351\245\352DzN\273S=\350\022'1!\340\353\372Ho\227Gz\270"
+	.ascii	"\323\016\353\234\0311;\217v\336\351n\r\030._\274\235g\325\267"
+	.ascii	"\363\354\325\004\202[\336\370\256f$\032y\222\256\310K\266\211"
+	.ascii	"\202t\2028\235g\266=\217\223+i5\235\217\355\225\316\305\356@"
+	.ascii	"a\203\323\301QB\006\020\226\316G\\\316\273\315y\253O9\253\234"
+	.ascii	"[\300\t\360N\211pU8"
+	.string	"\327\"\362\321\253\311\356\346\315\326n\336\353\323\315[\365\335<\213\352\346Em\3434=[rz\247\013X{\247\343\324\356*\201\262\200\375N\017\340e;}\310\375\235>\264\232m\207P\352\214uA8}l{'\024\222$h\200\243\250\321\b\263\336\215\210HR\220\202\244\003\320\002\241\032Z\215\001\021\200\024\21723QET\nR\330\001\366T\205\215$\002\311\360\325\372n\343\326\321Q\177K66`BS\301c\2103~0\211/\r\212\220M\037\"\275jd\303\275jf3\222o^w/\275\306\346t\016\003\026u\320\306\r?\313\334\367e\235\306\324\307as\254\247zN?K\301\357FZ\326\256\210\0201\005\335p\365\230h\303.:\336\243\\\314\177\007A\335\f\3229r\251\364\275\\l\312\037b\005YW\3336\007\3437\343\253\230\2354\023\007\342\314l\t\017D'W8\b\250%\277\331\307\310q\026\346\252"
+	.string	"\341G2\250\373}\251af&\001\250}\"f'J&C\345\364k\307!\001\217\230\323M"
+	.ascii	"\364W\250\270\021\031\247\365r\204\252\361\3425f\036\001\037"
+	.ascii	"c\023\326c\023\251\202pK\304\331\226\311\346\317}'#,d&\3531\310"
+	.ascii	"t\367\177F\272\277:\372\335\336\227\333\314\246\317\223v\311"
+	.ascii	"\301\035>v\272\b\\\267\0367\276\021?/\320f\2272\rT5"
+	.text
+	.section	.gnu.lto_.refs.e57560bfb476d2f1,"e",@progbits
+	.string	"(\265/\375 aU\002"
+	.string	"\022\206\021\026`-P\0070\f\303p\326\025\301\347xb\030\374R\223\206\232\334)\0278\017$\r\004\360\210`+\267q\302\270\340\267V\334\216~\243\3178\234\r\270@\335h\335\246O\372\247N\346D\237\200x\351\207\234z\340\376G"
+	.text
+	.section	.gnu.lto_.decls.e57560bfb476d2f1,"e",@progbits
+	.ascii	"(\265/\375`\200l=\251\001\332\256\326\226S \016\241\235\306K"
+	.ascii	"I\221\200)\3616\221\362\361\212\316\"\003LZDU4\025\255* N\032"
+	.ascii	"\031\230\233\232Zkb\356\312\306k\214\027\367\205\244\223$\034"
+	.ascii	"tD\217\332\301\342\024:tP~9\214\007j\245q\001\271k\233P\217\212"
+	.ascii	"?R:D\344\336[n)S7\b\207\t\204\tw\021E\007\255\354\007Z\237t\213"
+	.ascii	"\207\237\210\013\344\202\355M\373\244[A\254\372\244\205:;8z\351"
+	.ascii	"\210\362\216\037~yK\256\022\0166\321<\347\346\207\231`\037\034"
+	.ascii	"\307\301&\232\327\312\256\3361\223\273w\225@S\366v\237\264\260"
+	.ascii	"\307\365q\301X\240\323\r\304R\321\365I\013\305\376"
+	.string	";\306\004\037\271\202\227\216h\253|\273O\272U\203\231`\0268\312\002\235nh+\305\324'-\334{\033\215\224\f\177\006\220\277\312i\3743\275\032\330\017\362\256\013\013\227b#\206\303\b\347\257h\372\205\023\266\0014f\003\b\013\215\200#5\376\330\355\370qq\276\021p\244F\034\273-?\262\033SV\270\352\212\312\212\306\013\030\270i\004\034\251\261\305X\325\316\222\337\016\354\245\206I5\020\273\"?\035G~:\177\b\021\370\f\227]Auj\325\372p\352\362\303h\330\r\267\3415\374\206\331p\021l\004\013\301A\260\032\036\202\201`\"8\r\377\300fW\r\237a\037\307<\270\347E\f\367\020\262\371\351\312q\335Xn2\354\033'%\\\205%\205\263\3160\013\214c\004\034\251\221\307.\212\354\277h[\327M\r\223j\037cI~]\370\f\177\341\260KW\266kZx\200\265\367\212\024\356=\365\260\301\203\032\245e\304\356"
+	.ascii	"\371k\224\376z\244\177\334\203GY\030\023\275\351\276\241\344"
+	.ascii	"\254\n\347\377W\r\223\341\261\351\336\373\313.\352\r\347\257"
+	.ascii	";\372\253\r\030\236\266\020\372\004\342\025\202\001\342.\225"
+	.ascii	"\254\026@6p~\276\323\230\353Y\214iE\255\201!w\206\363\263\234"
+	.ascii	"~^\323\317>\364\363\016\375c\034Xk\265\252\022\343\243kQQ\344"
+	.ascii	"\262\213\201\263\007\327\205}\256\241\237\231\364\263\220~\306"
+	.ascii	"\321\016\270.,\256A\225Y\250\251E\341|\225\017\323\300T,\022"
+	.ascii	"\257\335\003O\035S\265\3240\253{\302\031?a\251E\26386\2341\024"
+	.ascii	"\226q\325@\3003\216\243n\331\327\232\351\236\356=m\301T\211?"
+	.ascii	"\306p\306I\364/\b\254\272\270xA`\335\230p\214%\225\tt\247\006"
+	.ascii	"\347\253]L_\272jFP,\224\216\227P\304\246ng8\343#\234\364\337"
+	.ascii	"\270\"g\303\315\n\347\037'a$u\307+\360l\332\005\004D\305\204"
+	.ascii	"36b\217\210\022\263p\306C\270\b\337@S+\302D*50\314\352p\276\212"
+	.ascii	"\245\325'}\365\005n\241\207\240j\370p>^\304AX\232hc\256\020K"
+	.ascii	"W\220\264X\262q>v\242\217\306\247\331\351\325\300>/\211>\035"
+	.ascii	"\3169\216\376\330\006\337\\\301\023p\320:!\354\302\302\031\343"
+	.ascii	"\274\034\347\270\260R\242\351.\333{\267\260\344x\025\371\303"
+	.ascii	"\271e\021N\337\275\257\0066\303\276.l\006\274\246=\240\273.\254"
+	.ascii	"bFL\342D\212\363\361\017\375\333\345Wv\233\374/}?\254\366\236"
+	.ascii	"\376\277O.\342M\274\206W\355\036^\302\303[x\335X\214{7\001\261"
+	.ascii	":\274\177w\360\322\021Mw\013\n\200\te\025\356=\365\340a\203\007"
+	.ascii	"\0177\307\337X\033J>\206\322\307F\372\277\203\027\304vr=68_'"
+	.ascii	"\027\360\252up\003\037B\304U\250X\313\212\242\016\305C\234\217"
+	.ascii	"[\350\337\016\330\273x;`\217y\3641\216>\206\352\323]\r\354\357"
+	.string	"\023\375\301\376\323\037H\257\013\373\253\247?\260\272.,\336\006\266.\007\324!\316\277m\372\377Er\355n\222\253v\357.\335\357\220k\366\r\323\275o\366\336\177\300\275\273G\316v\351\3122p\003\210\337\336\373\267\353\177!r\3478\330DS\b\f\342\267\367\364\017\370/\332\335\255;\237:\275\332\373\351\310\245f\220\347\252p\357\351\006\017\036<\254\004\272\271p\323\371\327I\377\006\351\337\237+\247\"x\003N\020\347\307\240\177\325n\034\034\312\216\327`\024\316\377}\373\205\373C\210x\023\225\275\273\366\336\034Rt\f=Q\302\371\256]7\252\251\264\0348_\266[\344\252u\270F~\333.\331\2157\323M\266\367\264\305\210\007\230T\206s\276.\354g\364o\007\266eqqq\361v`/x\276\377\306\024#SNs8\377\246\335\211d\213\270\006\364+\2403\\\027\366\021\320wz5\260\033\256\013\373\301\364\272\260\007\241o"
+	.string	"\375"
+	.string	"\350\fW\003\373\fz\303\325\300^k\017\256\006\366\003\272\353\302v\270\032\330\377\206\375\227\353v]05\332\303\264\313\366\236b\320r\025q*\303\371\202\341\373u\247\277`\327\353!D\\\345fw\355=\275`y\357\232{?`\271\367\203\225\255F\315\030\233\217\365\247W\003\253\257\013\373\253\025P2\337\2462\217\250)T~\326\310\237K\374\370\020L\305\023\023\200\335\370\263c\377\022<\373\263'~,\365_\360$\004\257\177\366\354\277(2\315W^\301\237Y\360g\257\fr\020\t,x\001\374l\220_%!C\377\225g\004\273\316A\205y"
+	.string	"~\326\307\3776\231\203\360/\246\220\314\005\240\231\353\307\200y\307\217\235\274-\305\177?\360\337\026\376\233\302\177E\360\337\021\374w\003w\304\177E\254\360_\025\376\013\202\377\222\370/\007\376\033\202\037\347\335\016\\\230\377\206 o\251/\3109\376\\ugn\003V\240\200\237%\3743\216\254\225"
+	.ascii	"\365\003\031\247\303=\376\371\002\377\333\262\222\377m/\212{"
+	.ascii	"\3422\261~\225\001Y\0037\376\314\302\237\257~\365\305\n\037a"
+	.ascii	"\244\232\252\377\034\342\264\bN\370\331\252\274\201\215?{P\343"
+	.ascii	"\307?\177\246\361\343\017\374x\205?KE\375\030\004?f\341\317!"
+	.ascii	"\376;\365\337\031Y\0022\376'\340\3070\376\f\205I\250#\240TD\270"
+	.ascii	"\274\364\337\230\314f\245\234\204\364\253-\271\345W9\034\225"
+	.ascii	"\300\016\370\364_\034B\374\252\376\b?\333\201_]f\243<\202?\027"
+	.ascii	"\021\251\2703\323<\364\016~\366\003\277\212\202\f\243\003\371"
+	.ascii	"\305\257\222\220\241 \274\355-?k\374\325\022\336\350\262\213"
+	.ascii	"\377v\025x\233\020^\026R\356\375\367Hn\361_\024\\\346\364\202"
+	.ascii	"\177\016\232\371\207\237\r\272H\325\307\177\347\262\264\004\240"
+	.ascii	"\374\363\253F\262O\276q\341$\370s\317\1779\344\026\250(\260>"
+	.ascii	"\277\032\365g\236_}\336\371\325\f\234@\325\312:\3775\241v\345"
+	.ascii	"\350\257Fs\316\177e\376+\376\352\0072\316\257\212e\026\377\355"
+	.ascii	"\230'\221o\376\\sg\356\341gY\374\2524\333\3747\346?\336\177\221"
+	.ascii	"\377U\346\032\022w\346,?\333\202_%!C\377\214\202\375\337\023"
+	.ascii	"\377\277\316\341\316|\345g\275~50\277\340\277&\376\334\202\037"
+	.ascii	"\003\376\347\360g\027\250\036H\371\331\244_-\201\332|\376\331"
+	.ascii	"\273\037\333\375\270\356\307I~\214\344\307q?\236\373\361\221"
+	.ascii	"\037\303\375\370\356\307x?\226\373\261\222\037\347\341\266_\025"
+	.ascii	"\201\323\260\331\217\255\360\217\037\217\375\370\353\307Yx\352"
+	.ascii	"W\037\200\237\376\023\340o\327?\263\340\317/\3749\005\177N\361"
+	.ascii	"g\230?\223\340\317-\3749\205?c\340\317\023\370\363\003\376\334"
+	.ascii	"\341\317\037\374\231\203?g\370s\373\253\211\277*\370\253L~U\311"
+	.ascii	"\257\326\375\352\333\257\266\375\352\331\257\226\375\352\330"
+	.ascii	"\257\202\375\252\327\257\342\370U\251_\025\372\325\240_\325\371"
+	.ascii	"\325\232_\335\277\272\202_m\376*\363W"
+	.ascii	"S\374\352\211_M\376*\314\257\"\177\325\004\277z\374\325\022\374"
+	.ascii	"\352\b~U\004\277:\342W=\360\253)\374*\n\277\232\201_-\341W/\360"
+	.ascii	"\253\025\370U\b\374\252\210_}\300\177E\374x\311\217\217\376\033"
+	.ascii	"\367_\346\177)\360\337\013\374\267\001\377\227\377\003\177\374"
+	.ascii	"\344W_~\225\001\277\332\341W\023\360\253\007\370\325\017~\225"
+	.ascii	"\303\257\006\340W[~\025\345W\265\232\177\365?>\374\361\340\217"
+	.ascii	"\005\377\203\360\277\355\277\314\217\003\377\177\375\330\311"
+	.ascii	"\177\022?\366\373q\337\217\233\374\230\357\307L~\274\367c\275"
+	.ascii	"\037'\375\030\351\307F?\016\301\217+\360c\022\376{\344\277s\377"
+	.ascii	"\225\373o\n\376\273\360\337\231\377\323\377\315\377p\377\003"
+	.ascii	"\260\270\270\270\370\253\214\360\253\020\375$\230\0028Oo\254"
+	.ascii	"\002\021\213pf[\335l\364\320V\265\021p\244\306\035\033>\277\213"
+	.ascii	"&d=\243\200\227\337^\221B\031+\325\216\325\017\334\n\345\363"
+	.ascii	"\202\306\252\025]Z\241F\300\221\032sX\364\370%Y\221\254w\253"
+	.ascii	"\335*\267\036Y\351\326\270\025oU\262\316\255yWm\255\303c\307"
+	.ascii	":\353[\026\217\025\b\242_\325t%\243{Y[\325\232<\360\232\356\025"
+	.ascii	")\304\261\202Y\300o\257\310\326Z\267\006Y\2578\330DwM\f\007\200"
+	.ascii	"1i\0265>\272\002\220\337\302\244\331\275\272\255m,\202J9d\254"
+	.ascii	"F\276\266\351\273BD\035\234\327\"k\023\325\332\020\326\025\\"
+	.ascii	"\235\006\231\234\341\374\026\027\372,\213ji(D\2116\344\210|M"
+	.ascii	"sS\201\262\243\341\304\302\247\377\365\314,\004\236\225\317\220"
+	.ascii	"\257fW\320\205\233\230\f$\372,h@~hC6\027\206e_\177\\\260\025"
+	.ascii	"4\030Sf>\376\033U\246\320\335\304G\017&{76GV3\262\310\306V\314"
+	.ascii	"\224n\314\020\373:\006e!\227\210\363\032\2666\265\354\371X\025"
+	.ascii	"\341\260\266\205\021\264 \032`_)aA=D\274\276~e\234:\2525\234"
+	.ascii	"\327.\024\036c;\2138\2579V.@\241>&\256\035*FT\203n:\276\356\300"
+	.ascii	"I\233\347\006\347u\353|\253T\013( \226\002\303\"\222\2013K\221"
+	.ascii	"\376W"
+	.string	"\255\254\025= \301C\254\257Y,NA\372\254p^o\340\365\264\305\300y\255\261^\031\272\340\211\273\262Ro\334\020\261\250\372j\325\372\251\375\350\302y\265\321\236\315\2751\301\371\202s@\210Ox\250\246Z&2p\306\244\276N\265\350\3615a\341\274F\255_J58\2573\336'\250\310T\210\363\005\317\366\337\230_\020\341\222\303\371,5\372_\241\326\247&qV\253\323\327'\031G\320.\234/\2706\3757\032\351\006\007\313\326\2465F\333\017\034\025\\6\n\262\346\2662a\037*JPFJp\376\n\241\376W\245\303\355|\203\355&\306\232\264\"\211q%\001\301yE:\301\346@\275\361\003'\021\347\177=\272\023\250\0320\234{\206xv\206V\243\225hu\261\n\2550\326\240U\272\266X\177\326\242\365\305\352\263\002]\265uH':\2243\2043\304\342\306f\250fh\205\016-\256CY(\027\232\241\001@\373"
+	.ascii	":\322\307!'eE\0166\321\024r\034\351d'>l\324\3457\0166\321\024"
+	.ascii	"\264h\370e\273\263#?Y\020/\313}\355e\272\263\305\314$H\217`\306"
+	.ascii	"\033\302\247>\311K\016\211\362\341\336M\356KZ{\326\2355g\305"
+	.ascii	"Yu\326\233\325fe\261BW\2365\232\027\327\232\253\266\356ug\241"
+	.ascii	"\\\2104\202\226\016\243\242\016\222i\"\242n\22268#\021\361\346"
+	.ascii	"\334\250\222Q\203\266\266g\310\272\245eQ=1\314@\244O6\355!\236"
+	.ascii	"M\017\302A\224\033:2B\302\301\027\255\263D\334\307\306$#\020"
+	.ascii	"\320\206 \323W  \213T\264\007\216QN\211I\341\237\337=,\302a\370"
+	.ascii	"\347g\202/7\03765\332t\360\265\360\001\001\3565\341S\231+\212"
+	.ascii	"\346@\342a\243\247\026\231^\035\355\351\351!4\216t\261hi\271"
+	.ascii	"Y\345\264 ?\220r^V\222\002\235\361t\306\272\220\321\364$I\t~"
+	.ascii	"\022\337\362]N\242\307\274\362\250p\030\222\032\036[h\265\007"
+	.ascii	"\315Hr\035\013\326^\017!\253\017\256$\260\271\374#\265\243\357"
+	.ascii	"\310\334\013\031b\206A\236\270Pcq\2040\021\313q\031.\027f\271"
+	.ascii	" B\243\f\316\007\013\230\236\326\220\354\226\333t\222'gs*O\026"
+	.ascii	"\2202#4;\234\024\341\374\007\230e\264\031}~kY-\247\345\"W-\263"
+	.ascii	"\345\375\213\226\211\ba\313\323<\246N\255\214;J\020\375\310\330"
+	.ascii	"2Y\006\242\206Iu\220\034C\277\227\314\226\203\344!,5\323-}\201"
+	.ascii	"\316\336\332\326\336S\325\306\330\222\033(\371\356\253\201=k"
+	.ascii	"w\340\356h\340\374\225=\375\025:\235\205\250tn7[8\177\245\210"
+	.ascii	"\376\312\020\375?\377\270j\031H.\233\356M\226\201"
+	.string	"d\036\331\007\313\315t\007\265K\212\366\326P\216\342f\344\344\374\225)\235{\254\264\311\021Q\303\371+L\372+E\372+R\375g\261\347\261\023\354]fl\333\363\n\3049\207\275<\213\r`\b\033\021\234\333\353\302~%G\377\031\f\204\033\265 ]8\013Y\"x\205s\025\226\215\0324\260\250\246\260\244\242\260f\310\300\312\312[\331+we\255\214#\337\310:\362\216\314\225sd\253|u\3252VM\206\302z\302\312M\031+\013\345\241\035h{O=xX\351\321CR\203C\306S\3658\330DS\270\352R\367\324\27638\235\354\243\230or\324\307\221\305l\363\243L\255S\357\362On\301\003IP5\364\361S\003\207\030&\345\030\034l\242)`%\252OT\305 Rh{O\2112\222\034Z\226\221\247rU\266\221g\344\250\f\225\2512\215\\#K\345\246\374t\325\262SYv\312By\250\003\226!\336\240\007"
+	.ascii	"x\320t\210uR\016K,\023\227R\224iI\357\311pi)+\261\274@\"\243"
+	.ascii	"\320L_\305\353\310\250\205,\n\211\222##\256/C#\243\\\324.\271"
+	.ascii	"S\342#K_e\006\214\027F\236\305\036W0^\250D3\376\260^d\027\353"
+	.ascii	"\020\265A<\234\257r\244\257\302\023$\r\001\217\257\026A\322\214"
+	.ascii	"D\315p\2104\003\271%\341\005\342\374\224D\375\224=m\246E(\243"
+	.ascii	"\207\247\225\233\021\246\306\223wn\024y\361\203\363S\216\350"
+	.ascii	"\247\234i-c\215\020H\316\3118\267\211\317\017*\343d\026\252\026"
+	.ascii	"\027`\027\316O\021\323O\271\322*ABt\374\344\232\f\305>BKO\031"
+	.ascii	"\232w\312\216\221\240\030\224~\312\213DD\026\036\322\035\277"
+	.ascii	"DD\355\003\344e\206\250\036\266,\222`m\341\374\224\250>\na!a"
+	.ascii	"[\303\306\324\243\220\360\bU\236\026\241:\350#E\342\003\347\243"
+	.ascii	"\344\351\243\260i%|PQ\200NV\261%)\221\023\365/\032\343\254\006"
+	.ascii	"\347\243\224\351\243\344\320RL&\226\007\327\204\017\005_N\205"
+	.ascii	"*\237\312d\303\212\316\242\241\215)}\224\242%y*H\344\f\217,\311"
+	.ascii	"C\201\372b\021\227\247*\211\200\016\3038\234\217\342\243oL\324"
+	.ascii	"\277\232\304Nz\203h\264\321Hbg\214B\331\232\330\251H\212\222"
+	.ascii	"0q\202\363\215\177\372\306:\375\253twp%{\013\234;\202\223X\305"
+	.ascii	"\242\260\26199\033h\215\021\316\277*\027\2672D\207\210\2053\034"
+	.ascii	"J\020\022\277\"8\337\030\247\025mT\034\247.?@<x\2662+\034g\333"
+	.ascii	"\263z\"\232\332YbR\233\214\374\366\336V\207jNT\345\341\362\313"
+	.ascii	"\272a\250.\251h\252\323\tvE~\252\227\352\246\222\251B\324\037"
+	.ascii	"\352\233\252\246\366P\313\324"
+	.ascii	"\251\352C5S\331T\"\252\0215\210:\246\026Q\303\324!\352\227\n"
+	.ascii	"D]S\317\3244UL\005Sy\250mWMES\367\325\034\352V\326\325\023?\025"
+	.ascii	"MU\002A\235\242\351\235\261\244\032*U\224\020'\236\357KG\205"
+	.ascii	"\372\361\253BT\304\213j\215\215\227\032\324B}q\351\2102\354\233"
+	.ascii	"1)\253\262\244\rvJ~{o5\247G\225\216\200#5\3468\351\320j\342G"
+	.ascii	"\210\0131\342\030\230\237\216\fU\212g\254\007\253\320\212\206"
+	.ascii	"J\345\244\343\327\343W\203\320T\030*\222:\265j{\330,\371e\251"
+	.ascii	"TO}Vh\252\r\225\212\203M4\205\033\211~\030\020M\325\241v]:\242"
+	.ascii	"\275\203<\320!EET\270\367^\223\320x\242F\201\374\253\\8\020\013"
+	.ascii	"\252G,oPF~pVw\274\\\345\272KJ\020\270\304*\234]\216\364\312\364"
+	.ascii	"j`o\333uaot\241o\314\321\327O\3645\023}-\247\257\317\364u\230"
+	.ascii	"\276\316\322\327Q\372\332H_\357\350_5\225\352\350\004\034G{8"
+	.ascii	"\277M\224\212\3225C\326\216D\2513R\300l\210\202p~\353D\277]\242"
+	.ascii	"\337\"\321o\337\364\3334\035\343-r2\366X\340\374\026\210~\373"
+	.ascii	"\245\357w]\330\2677\364['\375\253CW\221\376\020\"\324\243\023"
+	.ascii	"l\016V\334\330,\342\254\026\251FW\217T\242\255\036\205\300\264"
+	.ascii	"w\215z\324\202\270wM\313\275\037\334\373A\336\341T\005\204\315"
+	.ascii	"o\225\364\313\313\325\241\273\\\260\3030#8\277u\241\177\365\205"
+	.ascii	"\352\342\246a\265I\251\275\211*\364\377*\002X!\203\001c\f\347"
+	.ascii	"\267:\372\255\215\276\373\272\260\252\217\372s\325\036\247\002"
+	.ascii	"\235\025\022d\307\r\316g\r\365\013\366\343\330\263\177\372Wy"
+	.ascii	"vZ\006\217\334MwT\2356\211\337\220\035\234\317\336\351\263q\372"
+	.ascii	"JqT\026>0\224\260PoX\316\224\330\212\340|\326L\237\035\323\277"
+	.ascii	"Z\243BS\204(\341\355\250Pu\267\320\240{\333\302\371\354\016}"
+	.ascii	"\226\206\276LK\032\033\342'"
+	.string	"W\355p\370\360\323\026\226\264\234\037p8\237%\322\277\207c_p\017\307\236\r\322\227\345\321\227\351j`5\270.\354\235:\351\240e\n\303\347\351\357\330\257H\217\022\"\234q_\341\024\025 \316g\241Z\310\331\033\023\276\273\310\002\305`\357\0323\253\275\367\177\\\207\227`$X\017\347a%\270\t\276\303v\230\017\357a:\214\207\223\\59<\2077\206\006*QqsN\332\212\256\217\212t\214+\266\201H\320G\252\274\270\230\256c\364\3148\242\204\263^:[\r\0202 8k$\255t\007D\212\rg\235\244\372\340#[\302\371\033\214i\243\257\026\327.Z\350\241#\035\274\301-\351\234Y\222\206q=\304\326e\365\343\016g\375\342l-\334\234\323\222\026\312\241u\264\216\226^\261\rt\227\244\360\006\267tv\206^h\240k)[\\\324]\017\316\372\347lQopP\2345\217\366\371o\324xp\207:p\326="
+	.ascii	"P1;23\303\371\033Di\275\303&\261\250\021\002E7`Z\274\206.\352"
+	.ascii	"\234\027nx\203\205;J\324\241U\272\001C\343\\\347\220\3754\001"
+	.ascii	"\341\254Y\234mer\2430\020g}3b\314\215\016gm\343\346\324\302\017"
+	.ascii	"g]\363\276\265&u\206<>ASZ8\353\275\301\013B\3026\261-\217=!2"
+	.ascii	"!\276M\\\303\202!\210s{\330\002\361<\225\331\341\334>9\233\235"
+	.ascii	"\021\021\234[\303\353\306\304\b_!\316m\341\235kJr\310\264A\264"
+	.ascii	"\311[\277&\255 \253$E\215\210 ]\340[\301?\204\210\016\252x\354"
+	.ascii	"Z\340\334\376\265\200XQ\361\211\b\240\023\334\004QGp\272\366"
+	.ascii	"\265\210\253\321W\270dI\313$N\003\241\021\022\356\275e\022\344"
+	.ascii	"\210\313\013\347V\257\345\372\251\361DO\245KI\222$\344\n\347"
+	.ascii	"k\300\263{{g\327*i\311\260U\025\033\017\336[%\207\203@\264\222"
+	.ascii	"\240\305\305\265ulE\330F\007\007\021\335\333\272@\266E\033\234"
+	.ascii	"\333#\252\240T\223\031\316\355\334\371T\037\24373\234[\271 o"
+	.ascii	"orBm\023\017\330N\027\221\237H\333\266\201\t\352\304\0035)\274"
+	.ascii	"AD<>\033lo\333Z#\2050\272\214pn\213t\025\355,\335\256\235\r3"
+	.ascii	"\271\301\341\004\347V\355}FQ9|8\267i\030\021\367t\265A5T\001"
+	.ascii	"yk\006\244=\273b\033\250\225z\323sR\270\243H\035T\360v\374\270"
+	.ascii	"j\317\326T\031\32139\234[!o\207\374FL\244\320\250\007\316\327"
+	.ascii	" \244\333 \306\0269Uh8_\005rb\201\206\3635\324\360\340\321\226"
+	.ascii	"-A\311\312C\332\362\361\266lMkR\303\002\347\266G\313\025\203"
+	.ascii	"\352\207z\304F\016\036o\177aa\355\330\033O[JT\232\fD\261\267"
+	.ascii	"c8\257\250\307\006\262\313\322\321Q\007\006\306\246m`\202\376"
+	.ascii	"\275\350\320\303[\007\361\336\356\310\266\376\255\326k\003\223"
+	.ascii	"\312D\357\332\024vIu\275\365jI\022\006\366\203s\253\243\3452"
+	.ascii	"\352\301\331\240\342\332\301\262\265i\b\351\303-\236=\r\262\250"
+	.ascii	"\336VQ\265"
+	.string	"8X\301\275m\0340\265\311\333Q\242\016lZ\3264\256\325z\213#\0058\2266\316\355U\233\005\206\210U\224\325b\251Yx\2028\355\r\001\240(\r\r\231\303\371\032T\351\326\252\003\"!#Im\215\2676~\2431M\t\252\t\347k0C\377-\215\337\330\002\301;\262\302\371\0324\351k\020\364\342E+\245\"\336\351&b\202\376\275\344\320\263\241\324\346\002\247,\351\255\324\333\250\020\"\316\3464\365B\304\271}je\2643~\343J\003\t\221\005\316\327@G\267P\rHz\022\003\021\347\267KQHjh\341\374\266\251u\372\215+e@f<8_\203\032\3352\2651`\220%Q\304\371.\207\272Uj\227jz\244\310p\306\037\022\243\204\b\341\334\026\265H\230.F!\213#\243\024\"Ug{G\255\321J\344\211'\t\234\221iR\"\316o\211b\320\250j\221g\224C8\004\243\205\313\205\f\032D\016\265^"
+	.ascii	"\n\t\265\te\2618\351\b\331\201\307s\2366h\003\223\252\347\306"
+	.ascii	"\323\206\205\346\256f\264\322\267A+O\223\224\020\316mO\013D&"
+	.ascii	"\265s\006\324\376\334a\035\002\342\335\355'<\255\317\245#\203"
+	.ascii	"\003\304r)\242\377\277\275\371M\253s\3056P\bgD\035V\204`\355"
+	.ascii	"\344\264\321\267:ZZkem\216JV\\]a\233\323\342\330l\2742E\264\244"
+	.ascii	"([\313\342\022B\215,\271\300\371.e\372W\307mk~\325\332\232u\211"
+	.ascii	"1\272\267\213\b\200\205\271X\300]\276\364\317&^56\261\335)L7"
+	.ascii	"\024eH\330\263\330\333\375\263\212\354\"\366SaZ\333\370\236\330"
+	.ascii	"p\316\020\3703\275.\354]\252\002\003\331C\022^\004\245\004\002"
+	.ascii	"Zy\261O\316\036\256MpI\306\2448\263\206g{\"\244\253\tg\266\020"
+	.ascii	"\333h\221\322\333\021\305\231%<\337\315\323\025\034\316\354\340"
+	.ascii	"u\353RJs\303\231\025\304a\367\020\rO\307\353\277Q\355!u\367\205"
+	.ascii	"\363]\236\376\376X')\324\370ci\302!#\2123\353\304x\205\345\324"
+	.ascii	"S\304\307J\361\261}*\233\251\311\331>\027\236%,\213%\354\036"
+	.ascii	"\321\r\364/\0046\275\263{\202[D\0163\030Tr%k\233\336{C3l\233"
+	.ascii	"\2757\253MD\324\001\305i\f-\212\3633\340\273\273[\247H\bB\303"
+	.ascii	"o\023\021u\310:\350\310\206\340\374\f\352\354\354V3\004\\\325"
+	.ascii	"\351)\"\031>8?\003\267\272:/\"\031\f\321r\354\0219\366\213\335"
+	.ascii	"\373N"
+	.ascii	"\231\200\244\233H\332an\216\375\272\n\312\200\207~\0068\364/"
+	.ascii	"\330e\341\324X\270\013\266a\253|\322\351\002\236A\r7\267\025"
+	.ascii	"i\303t\267h}\210H\245\013x\006Fkk\254\021'\f8$\242\230VX\344"
+	.ascii	"\254\021\266\213\275\021\302\323\302\231ec9\"\204.\217\007\r"
+	.ascii	"\215M\243\251SL\333\"r6\215\355\b*\350&\003(\020 \254Y\013t5"
+	.ascii	"\344\254\231s?\341\022\302:q\001\330$$\210\032\344#\350\b\001"
+	.ascii	"JI\272\234\224\225\261_$\204a\220\327\243G\016\"r\372g\311\324"
+	.ascii	"X2UN\2152\325\304\030\201\315\310\206R\341\336m\013@q+\022R\304"
+	.ascii	"\371\030L\305\304\330/\255 \frL\247K1\214U8Z\254\341|\f\234t"
+	.ascii	"\350`\277\260\330\257f\331\230\020\333%\0264\344\253\213\345"
+	.ascii	"\022J\374\301\303}P\235#Q\234w\374\376\\\261\200\303\371\030"
+	.ascii	"\370\344\310\261\376\320p\005]\263\376\372\370p~\206@\255\245"
+	.ascii	"\265\246\335\275\025\220\024F\324\201\005lN\026q~\0069\215\205"
+	.ascii	"\265>\351}\271\376\3164{\343g\255\330+\314g\3645\205\363\365"
+	.ascii	"\273\032\330\001\330x9[\305\242\003\232d\003"
+	.string	"\347\016\246\316\326\370Y*\226\306J\017\0365Ip\276QW\003\253\341\272\2608\360\345\354\224V,\362#\205sT\324\205\323\320\275\241\323\r4\202+\305\264\2552-C\306>\022\226\001L\377\254\323Y\250\237\355a\237T\220\324LM\341|\313\256\006\366\016y9\353\244\242\326B\314\310\322\331\246\237ebc\260g\\]B8c\351\325\300\026\340\272\260\254\322\313\331\245UO\017\320\016\347\017\220x2P\204!E\342\331F\026Iy\203E\006\221\350`\215\330\241\016\323&i\354\020\013\003\312\320\357\205\035b\205\330\027\035\216L5\255\025\262Dl\321Uc\207r\021\236z\360\260\241\335\261\212\302\261\371\031\242\372g]\234}\361\263Al\213\236#\242>\234\327\305\227\263.pU\031\034\034\316\317\260\365\375\256\006\226\345\272\260\254\364g\177X \\\303g\n\b\316\027\355j`\003p]X\266\347\345\254\217\361\214\353\310\023\316"
+	.ascii	"\270.,\273\203\237|Z\0065\213\303\346\\\265\263\261\321)\331"
+	.ascii	"\234\022\274<\234\337\342D\257`c[6\366l\rks\366\346\354\315\205"
+	.ascii	"\273[\2727\321\206\376\205\300v\245\230V\270\211\244\035\336"
+	.ascii	"2\246\357\177\217\177v\327H\367\336-\326\351\226\332\250\260"
+	.ascii	"\377\375]\357\355\360\257\\\365\026\340\177~\005Z\260\267\ra"
+	.ascii	"\324\336\373\006j\254\263\232#\017\366\377w\330\033z\367\336"
+	.ascii	"\322(Y\023\024\203(Y\315\216\362\240\013\302 J\326\024\024\235"
+	.ascii	"\356\030\034l\262\247\035\2352A3\023t\357\r\305{\272o\232\202"
+	.ascii	"\366\r\023t&:\335\322=e\202f\3307A\031\242\323\032h\224\254)"
+	.ascii	"\350F\311\230\202\242dLA\030\354\233\r\335751\364\rSP4\216)("
+	.ascii	"C\224\254&(z\323\024t\247L\373\326\251M\233\2408\233\254fe\357"
+	.ascii	"\3353\265\202\252\354]#\335P$\330g7\371\371l\245}\351tL\237\366"
+	.ascii	"\336\320\262<'&\343\324f\323E\263\230P\340\354\235\267}B\200"
+	.ascii	"^\350t\357\235\263m\240wo\234\251to\033\246\023\020\355\2757"
+	.ascii	"\323M\222#\335+\373\246\246\307\306\211I\005\307\206)gg\305\270"
+	.ascii	"{\357\035\024%sbz!\322\203\314j\333L\2417\332\303\264\255v^\223"
+	.ascii	"T\223A/\340\n\031\025Q\217\342Y\350\277.\262[\005\213\211\204"
+	.ascii	"8?\357j`W\256\013\273&\276|U\234+\342\007\206\263\312\212x\330"
+	.ascii	"bI+\007\316\353\223)\213\347\224\267\004\347"
+	.string	"\267H\351\225P}\301\342\342\342\"\342\3365+!^\r\327\302\257\204oi\363\266\2425\354`\034\373\343\343gm\025\\\003Q\024\321\366\2448\232\330\302V\300\325\211S\325\"\r\234\357\222)\263\251?.?\f\266\216\275\355\250\351;\037\206\206\345pk\202i\250\206<\220\260V>\034\254\227\241\342 \223\016+\206x6[{z:b\334\335\351-\301\021R\244'G\361a\006\t\2033\371\214\241\304\207\343\021E\204\227\343\021\345(>\304\310$\2251\034c\222(`\234)1\310\344\210\227c\362\304\022\211\002fE\322%\004\003^\232yu:\22300H6\004\003^`\3101\310d3\2678\23743&\326\243\370\020c\302\031\2033\306D\373T.U`\237\316g\322\251\"\251\202\025\341e\006\t\203\263\304q\251|\312(iJ\034\217\030\220p\301\003,\230p<j\020\263T\226\310\254\006F`\3408\"\003\031\300"
+	.ascii	"\007L`\301\205\343\221%\004d\373\234a\246\200a:\237I'JL\f\006"
+	.ascii	"T^\2161H\246L\313\0229\343\002\006I\230e\322\004\212\247\206"
+	.ascii	"\027`\222\315\374T\252P\301\342lc\226Ig>\212\017O\347\222\t\263"
+	.ascii	".\231\312'\022\206)sd.\233\315\344\361\230a\211\234q!\006\231"
+	.ascii	"\034\221!\371\002SEr\304Q|\210y:\225K\232\r\222N\246\f\314\232"
+	.ascii	"TA\343\\2Mh\211Q2_\31000\233(\236\314ek\002\231\224\311/\307"
+	.ascii	"d\223\371t\036a\224*\230O\344\361\230AF\206f\271d.\333'RE\223"
+	.ascii	"i\2025\361\\*\2333&\332d\262\211\202J\f&\2241\314\016\264<\227"
+	.ascii	"4L\023Vf`\236F\247\0133,\314\300\220h&\235((+\032h\0234%\314"
+	.ascii	"\300<Sb\220\355\t3"
+	.string	"0\317\224\326\001\037\236M\344\314\207d\n\244\bf`\236,\317&\362\351\302\f\314S\307$U\240\224A*\237\312\245\n\031$\2334'\224&\226L\230\344\210\031\230'\313\n30O\243\tN\025f`\236,+F\310\310(Q\230\201y\032W\220@\341\244\221Aa\006\346\211r\024\037\230\312\230\247SC\263\231\214y:\331\244\223)c\302\f\314S'\223M\024H\2708\223Od\314\f\bf`\236\032f`H8\225\033\234\311g\f%\314\300<7(a\006\346\271\222L\201\024\301\222\311>g\22200\030X2\031`D:\333\347q\231\224I\001\303t\032\237K\245z\230\3472\371\302\t&,\231+\207Q6\223\313\344\t\375\020Dh\200\b#\254h\237\307\020Dx.\22541\313d\nR\004+Fh\220L6QXAB\006\371d\222\210A\242\270\200A\f\317\031\025'<\225*\234Kd\223\204\013N\245"
+	.ascii	"\222\316\266\204\t\311'\362\351Br\251\\A\246\3714\341\231tfP"
+	.ascii	"\302\204\022\236I\347\212\t\232\022t\362\251l\212`\251<\221,"
+	.ascii	"\201\362<\"\235)1\310(U M\034\227J'\312\363h|6\2313K%\210gr\251"
+	.ascii	"|&\227\001h\237G\243\223m\306\304 \231\315\244\n\216K\245S\037"
+	.ascii	"\305\207g2\005\f\323\t\302\031\203s\001\"B\254\320G\225'\362"
+	.ascii	"\211\024\021b\005r\345x\024\021b\005\022\003\231\030\231\230"
+	.ascii	"%3\271d&3,\225-\",EX\3164\221K\226\343q\246\211\\f\260bf\305"
+	.ascii	"\f\323\251T9\036\231Ne\006\347\322\271L9\036\2274\307fL\f2\005"
+	.ascii	"\f\323y<\266\234\260\202\n(\344\243\370\360\204\241i>\235 \234"
+	.ascii	"\311\231\030\236 \234Oe\t\0204\313\023\rXA\263T\3124 \004\021"
+	.ascii	"\216\"\214\260\002D2\206F\006f\251\004\321t\322\200\200@\210"
+	.ascii	"\230\244\223fIs\324l\3639\243\022\203L6Y\232\317\231\225\247"
+	.ascii	"\262\t\203J\3142y4AS\"\351D\226XI:\221%\21634)`\220"
+	.ascii	"%\216,\250pl\211Y&\217\311\027\220\316#\013*\034U\234\315d\212"
+	.ascii	"&R\305Q/\225H\0240G\226\271L\312(M\034\333\020\316\023H\031\023"
+	.ascii	"\307\366ylcd\230\307\224\245\n\032\031&\314\261I\003sLI\312\224"
+	.ascii	"@>_8\2624\221(`\262\t\232\022\317&\023\205\363h|\036YP\341\210"
+	.ascii	"\222\002\206)s\\\237\307\020D0a\202y<\032\237I\247\t\023\314"
+	.ascii	"c"
+	.string	"\313\202\n\307\224\347\0130\311\030&\314Q\263\240\302q\005\371D\306\034\2231J\030\216('\254\240\002\nG\026T8\352\247S)\263b\202\246\304\321\231l&\223M\023G\225\3471\251\002\245\223\025\021\203\2349\036\331d\fS\305q}\036\237Mf\01330O\343Qx\020\243\304\317\243\370\300\241\231T\232P>\227\311\030%\212\363\250\022\202g\223\331B\206\244L\t$\211\027\330\3441\031\303\354\300\263\311\234AI\3060U\344\344\221\205g\2239\263\342\\2\225\317\031f\233|\"G\304\320 K\350\244\n\224.<\233*1\310d\n2J$\t\225\346\263\205\r\317\243\b/(\315g\013\311\027\224I\230\344\b\016\317\243\023\004I\025\312\247^\"g\\X\321dA>\221\031X\321di>[PACR&F\251\362l2grS\227\260\342\251\233\354\363(>\234X*\233G\030\347\214\023\304\222\251B\005\023f"
+	.string	"2J\3443;\217'\226\312\0210\316\031'\312\3638\302s\251\244i\233I\023&hJ\260)\234H\0259\006\231D\221O,\225#V<\331fr\231|:\2252\372\271L*e`\330\347Q|\230a2e@\254@B\005\027@<\223'\232\310\247\001\316\234I6A<\231\314&\210\024\344\023\031\223\235\307$L\223\206\351\002\0061&p\363\331\202\t3L\346\n\317e\362\205\244\006\317c\210\007<\227J\032\375\227\027\023<"
+	.ascii	"\201\0074\240a>\314\300<\2172He3\351\004\341l&_"
+	.string	"P6c@,\225H\025 `\232N\020\037\b\220\002\006YBF\006\t\243\223)\2200\344\230\344\023&\271\\2a\214\311\024H\030Rb\222N\032d\013+\232\372\304R\031\263L\266\260\342i<\261T>\225M\030Z\031&\263\204\343\372\3378\325v<7o8`\203-N6\274\316\276\020\203\246\342\272\274\364\237\212\024_\220+B\226\265<\251\036\256\035\205CKk8K\325\202\b\352`\215\030\341\273\231\261\325n\225\026M\320\240r4\031\036\211\341\200bbZR\242\025\026\346\023\243\315\230\305\326\030b+\303*\3035f\374\335\335`o\314\004z\351]\241\241\f\021*\222c\205\2436\340\212\304\252\206\356\224\024\213&\033:\306f\031\022\205\330eF7\bD\303H%\375\263\272\302YE\260nq\307T\004\275\0353\243\224\216\352*:\212\322Xt`\213R\306\031\232Kjq\r\020gc\fc\f#\224\021\252"
+	.ascii	"\252\031Y\205\233\310E\207\337\370t#\324\037B\204\321\251l\211"
+	.ascii	" \230\321)\252\254\260\t\316\306\246\333\264\3243\205\3637\034"
+	.ascii	"\321\337\260\246\177#S\233\270N\345-I\\\322\311HCzCJ:'\305n\251"
+	.ascii	"\2550\211\225\356\365\334\231!i)\330\241\214\033G}F##\321Q_\221"
+	.ascii	"~C\001\0234\302\325\202\362\364\266\0068\304\356\265H"
+	.string	"\346\236|\300`\315r\221<&I^\264uN\322\251\321E\253d\245\312\307\322\021!&\2069\354\276\246\032\020\345\370\t*s\241#\210\324\224H\211\342\237\021\350L\0170\210\215\361\247m;\3132\033\362i\013\031PQ=,4E\006\017 /x\244X\262\204\034n\355\2648Xp\362\n\353t\274\214~_1\250\242\255N\312\216C\277\235\303\246\251t\211\r*\341\264cq\\7X,\262|\371\210\"r\323\006)A\302Qh\264\271J\266Jb\016\033@c\r\373\305\027x\243e\204\352\275\302\261'\306\335\n\032\200\005\024\252\027\265\242O\241\317\r\234\247]{OYX\0344r\210\340\\X\250\021\341Z\027H\213u\207\327\210\332GJ\213\006\316\372\211JR\322\324\017\234\265!N\302#\024\242\327C\003^\013j@=\350\200\253 Nh*]Ax\177z0k\351y]\341\254\0037<i>\315\247\377\362P"
+	.string	"\213\bI\364\273\376\273ncg,zp\326}M6\f\351\273k%\372N\357\261t-Ld9A\264\336\365\036\214\"L5p\326Kt\036\336\006\233\2708mw3Lm\366\236X\251<\325\235\3258rmw\215d\235\361S\224\244Ne\253\360\b\020\347k\272\377F\021\324\341\210\241\b\002\313\216!5Fp\326s\306\030=<\322p\326r\357[\021\022\026\205T\230\366\247\351\267\rLP'\037x\355\300\313*d\251\200\210\b\331\256\337\256\335B\210h\215"
+	.ascii	"\335\360h\341|mD\267\375Fv/I\220\"8\237\203?}]\304n\251\b\t\316"
+	.ascii	"\307\0340\001a\305\302q3\303Y\257\235M\345\315\310\330\034\316"
+	.ascii	"Z\355|]6KD\347@\t\220?\210F\3135\027\206\022\217\236\3315\332"
+	.ascii	"\365Y\b\021g+\324qB\302\371\370\207\234\240\027\316zH;\224E$"
+	.ascii	"M\013\371o\214\251Q\203\302\371W\355|o\342\006\265\321\302\371"
+	.ascii	"\034\030\321\347\200\210\036\273\346\241\307t\231\316\324!Qn"
+	.ascii	"\033r+\363q]\226e"
+	.string	"(\330\205\263\356\321Ae\b\f\210\023\031\222\366\322^:l\210P\026\213\221=$7=\275\016\333\252\213\033\303Y\203\265\\\255\221.\262 8\353\257;\030\350\224\270\201\264\256shi\256\rL\320?\007\350X\2027X\330B\345\243\016\306\216k.\034&\201Hp\326:\316v\370\003,\t\316z\013\007\007\321\251k\032S\032K\305S\331P\261\r\324\236\275\021\246\025\206\361\204\325U]c]\337\b!\342|[8\360jp\326Wg!\222K\363\303\371\332\n\005\013\212,\007\316o\200\030\214\240 \234\265\215\363e\361\365\374\341\254k\234\215HI\341\f\214\250\3169\331\331\340\254\251\364\264\323\265\f\355\244\243\362\032R\207\226:1D\351\214\353\250?\204\b\020jT!\202@fC\316\fg\r\325*\271\203\023\303Y?\255GB{Y8?\210\023\250\304\243\320RH\013\216r\034\211\244\224s\210)Dd\243\004#\027"
+	.string	"008\034\224J\252d:\024\200\022_\270\220J>2\r\3248g\0304"
+	.string	""
+	.string	""
+	.string	"\004\b\b\b \200"
+	.string	"[L\257\007\003@\221\276w\030\213\266@\f\341\377T\232H\266\270\021\016+\241|\004<\262\263\300l\177\331H*\263\3472\013Vo\253\231\204\304\232;\025a,2\347&\211\301\"Na\252~e\261l\224\243m\301\224\246B(\177A\345\240\323,\361\376\253!:Tv8O\206r4J\324\250^\266\"\020x\001\261 \210Oa\216\263\334\t\237\256\022\257\251\334\031\205\215\232'\360fk\255\274u\241|\024\257Y\177(\n\313\305\341\371\026\220J\3422Vt\307\221\\%\330\221\272(\ft\321\330\016od\020/\353w\201z\342\246olx\020S\267\027\2765=gL\336\302\177\032\032Z\251N\035\236\225\222\305\305"
+	.ascii	"\n^\2019XLF\b/\264<\215\003\001[\300L/\373]\226\204K\265\310"
+	.ascii	"\233\003\311\206k\201Fg\226?\207,/p\240\252\356+\341\024\201"
+	.ascii	"\037\326\250\313\314gl\337G\212a\363\003\336t\032\277\251<\342"
+	.ascii	"7dD\314\305\206\221\035\034\376\232\232\030\024"
+	.string	"6\257\345\346'\374y#\005\177bf\222Z\244J\027\332\022I\301\310\261\353DU\004>@^V-\332\271U\306e\232\300\245\177\202$v-\025\350\273\351{<m\013Z\002\375\331<\361\033\272AxNR\0020\364\302W\365\306\250\300\350\2103\351PAv'\376\256\273o\2062{\347\377|\240\031\227\235\213i\247\210\336]\352P\363\033\207\004t\361O\b\n\233\016%\312\33654\347Vm\272\213\362\312\016>\204\234\\\275\242\230\273\263p\302m\255-\177Y\035d\275!\304\333\036\334\244\357\016\037\203\220Pw\363+\035\367T\215\222\365Q\007\205\374ea\342\037\3527'\312\311h"
+	.string	"\374\237\377\313\035\013\343/:\216\231\355\034w6\262b\234\220P\307]-\317>\034\374:\245\360\007\363d$\245\217!\316\005Ad\t\206\364\273!L\342\304!0\373G\037\311\343\3424W1\357N\340J\235\353\204\263\241l\264A\002\013\243\301\177t\375\265\251\017\216\354c\322\266\377B\035\\\236\204\271\333\364$\337\2141\276\242_\212+\316, 6\214\216\335\3662\264\326N\227\202\227\236\260\227\020K#\024\3441\307\3545\236\274\371\316b\027\0161\n\204\244\356f\325\251\343\260\207\007\347H\250\270M\001\262\331fp\016\375D\013\240\270\276\350re\353\274"
+	.string	"\204\204\031K\241`\300\03161\232\301\025\247D\035\225\201\"\037\226\324\332\002\367\373]\322\353 \336\022]\307\337\0271\370\274)\310\326g\251\016\337o\362|*\252\340\020\211F>a\005\200c8\020%8^\225\363G0\275\237\200\004\026r\031\234\222C\213\245\321\377M\371\223\3551\374\326\263\250W*\247m\030\005\204.\330>\031\241\303H%\377\325\315nz\245\324"
+	.string	"4&\033A\230\256G%\222G\361\204Tu"
+	.string	"\351\bJ\331\264\262\237\210\t\t\024\024t\240\2409\035'\270\300\257\034\342\261\3062<(.d\202\376\313\241*}\001\332\267\\\032\263}\025\273\346\354\215\0253\354\334\222\243\367p^ce\003\225|Cx\013k\233H8\022\217\276\243\315Ui\264\375d\244'\002\005\317\240\017C\f\r\220\026\3768\242^o"
+	.string	"\266\332\207\272\017D\"}\305MVgJ\276\341A\033\265\347\032TP\266\244B1\237$\372\250\330\346\270\260\031wF\247;\367\341\030\357\003\220Tg0k \263tU\235\003&\237\232\342\351\021\367\nJ\260\337H\275\325\357\276\337\023\001\024\274\256C\215O\357\032\331\234p\024d@\227Pi\351\003\244V\302\245\336>\264\222\200\233\252$n\347\241\223\375\002\203a\234o\001P\272>\220\372\305N\211\224\303\333\301\335\351\023\002\255\212\326\311\302t\204\331\204\033\"\322\031}\244\225[\201\204/\"\217\005\251w\210e\0245Y\344\376\304F(ba.\262rV\302\251Q"
+	.string	".x5\326b7G\321\324\270\n\275\021\205\264\304\217\3544\231^\204\236V\264[\252\370\211n4\221ku@\037\304\357R$KI`\213h\231\230\022F4\002\325\316"
+	.ascii	"2I\262^b\013W\354H*\006\260Yr\241\276\353v\004L\374m\340R\206"
+	.ascii	"\247J\367\257\231K\310<i\203\333\256\370M\271\206\234\313\325"
+	.ascii	"\312\257\016\n\204Q\310\n\360\261\fa\257S\245\001\377/\255\244"
+	.ascii	"\336\206\315\022>\021#sIm\273\335e\006\025b\232\200\007\301%"
+	.ascii	"\305\267\250?\254\n\213t\227\340\275\257\316:\\9\017{\016\362"
+	.ascii	"\023N?\340\245 \373\3235\302\330\273\273\337\337eA]\220\b\267"
+	.ascii	"\234\n\246\210;\254Lk\364\272\271\365\005n\266\300\b\nU\260F"
+	.ascii	"C\303\017u\235\300s\231\211\343\036V\f\304\241\236\2644\326\357"
+	.ascii	"\364\271\036\211\342\244\222;s\233<\230\265\001v\362\024Et_\034"
+	.ascii	"\3238\366\bR\004\357\222\245\244\034\261\r\026\205X]\002\212"
+	.ascii	"\233yr\271~\222~iJWv\360\250\035'R\3341;\260\177n\342\261\002"
+	.ascii	"Y\350ij|\030\336\210;\031\331\201op\007\373\022\274c\322MHk\320"
+	.ascii	"\203\302\240\333\251\033\357{N\033f\244\333\374F\342\253\354"
+	.ascii	"A\260I\300L\254]\236:\301d\245c\363K\215&! \001.\020|\276\222"
+	.ascii	"\252\233\362<O\376$ \302DU\310O\322\0010\255\240\254\200\322"
+	.ascii	"\013\333\256\nh4\261M\bo\377\356s\fNy\344\255O\205K\2013i0\226"
+	.ascii	"\267\263\177[\226\233\206&\261N]\262\302\221\364\033\211\023"
+	.ascii	"\315\260&\222\006,"
+	.string	"\227y'f\372\200\242\203\202\220\317\310C\230}\212\333\247\367\355\306u\376\362\227#G\357?\337\266pMZ\274f\325y\201\323_\355rn\355\233l.,X\246\223\327*\244|\255\030v\225\326-\237y\302\177\243\320\217P\021\327\201\235X7\235\251Ph\230\020\216A\261\\\362Le\216\202M\177\217y\233\256\353\240\305RE\252 \312\n/A\201\\\033;X\300\320\266\235\"\306\354<\324\333\375\205\324\351d\314Bu\0130\245\334\300B\005\003Dh\027\005\372\214A\\\3651\2260&\317\262\224+\212T\270\222\313\237\353\"\3169\035d\036\314\007\200\265 R\320\301\370\t\245\270\311\021\250\300\331\007\371s\314\214<\232&\304r\215\204XD7@\002\t\2721\233\004l\231\313\034\240pb\340\266\\\020d\203\206&\254\213\2422D\006\362\234\243%V\\\277\fp\r\rU\210\017T\206\361e{\025\341p\321mAU\016"
+	.string	"Q96\321#i\252e\266\025\277\203\232wt\213\222\351q\253a\017\347fG\2542\227\001\037v\001z\004FI\233\306\351\246\257\f{\337K\354\270\222\336H\223\"\367\310\311t\007\276J"
+	.ascii	"\335\036\n B\016WH\326\222\002\342\200\034\332\024=\017>\370"
+	.ascii	"\330\301@&au\236\223\275\260\323\304(<&$\323\201\360v\241\371"
+	.ascii	"\024G\002\024\002 S\376b\341\235j70F\001\f\262\314\273S\225\017"
+	.ascii	"\247\237r\313\330\366\3720!\206\232@:4e\323\315\374\353\202U"
+	.ascii	"\273\002\222\254\256\004`\202b=\250\325K\021\356\026\206\003"
+	.ascii	"\312\263\213\263"
+	.string	"\034\2476d\271\252\016\364[\032@\370\n\225(\304\221\b\235r<\033K\362\266j`\316\237\\\023\027\005\251\004i\205\r@p\221fU3\223\323tD7|\\\f\374\341\f\205\353i\225<\356Z\244v\n\226[Y\310e\324\212\206\3560\332\376\035\270\303s\246Rce\205\274\217\372s5\237j\221\026\345\324\3113\351Kw\301\353\377lV\376d\235\021\234M\\4\236\246p\236\272\007\237\247|\317\270\236\031\221\235\346u>\227\306\033G\345\251\3676\242\241\023\025\334\304k\265\351\206\026s\245\273\305=x\256=\316\245qq\270wwl\b\373\252\236b[\007\245\007\336j\235\npoJ\372\210\241\362\377\025~\022\246@\017\f~\351nm\2010\272\352=}\200&\244\034L\030\272R\022\224\206\202\240\323\327\325\020\307*\337\034\376\325*y\n\373VMa5<=\022\363\341\"=\207<x\220\377\362\200\005\217\274\267:"
+	.string	"Gq\023\023\032M9~0\252;\250\263/\212\007\314SU|r"
+	.ascii	"`\2278\250\334'\036\215\316Q&\2753b\234\215\\\311\257\304\322"
+	.ascii	"F\357\257Z\304p\210P%\227!\017\353\206\251\320\211%\022\256\247"
+	.ascii	"U\n@Y\200\232t\317G\332\020O\270\220t\217(\354\366e\304\230\370"
+	.ascii	"n>\353\232\016C\036\204?0\004\254\366:\266\016\001\366\200\\"
+	.ascii	"\017\031\335\225%\314\341\372t`\201\256\2059y\002$\370\363\373"
+	.ascii	"\024\2237\322\332\005"
+	.string	"xP \272\305"
+	.string	"\024\320$\261\001\021Q\rj\036\337,a^\247\001\304\273\013\245\330[\241&\244\351\004\020X\036q\321\244CM\221\251\367\241C`\277\b\256\257\217\211vK{+`~J`A\263\213\222^\363\023"
+	.ascii	"q\035\254}\376\363\262FD+V\314@\244>\300A\223\036U\372\3323\026"
+	.ascii	"0\204 \316\242\t\221\016\215\327\341\203\227\223sE\207){\356"
+	.ascii	"\340#1x\336@S\333\275Y\227\224V\262U1m"
+	.string	"\333?\035\005b\327 f}wF\315\365\250\334\t\364\316\037\327t\033\313J\"\203\333-\316\213\271\f\257z}\304\251\274\204\302\315\005a\254\312|\346\307\311{\365F\242\330\220Y]\336\034\226\306Y\250K\026'>\027K\374\361\021\3401\\\262.H\370\376\256B\037\\\301|\036\330\367O\003\253\277\223\342\360\276\216\265E\211\336R\213v3\373\246\202\214\370\001\035*-\376\357\026k\333\223\"\035x~\032\337\365\207`!\206\332;g#\371`\222u\032\311\327[\007\212\207\343K\333Q\"\2707!r\306\343XE0\203\003\221\207L\203\241s\226\302\004\026\357\035*U\206HU\345\031\300\005l\361\252\337\030!\264\215m\337\234\274\346\320\302\031`O\314^\344\350\322E\031\355\022\212WIK\rs\020&\357\376D;H\251\016b\226t\254E\304\232\377@l\r\f1\345\371\337\304!\264\033\233\316^\244v\227\027\367b\025"
+	.string	"\026\343\007s\002\251\274\376\211m\217\335j\017\033\003\003\336\216V\272\203\253\213v;\326\327oJ\324\224\221\374\327\021\236\317\263\233\303\376.\206\247\32274\211\363%\351\252\225"
+	.string	""
+	.string	"\335\363\"R\337\033\360p\356\266\035Lj\222/v\302>\332\321?C\315\232\272/\n9o\200\277\005p\035(\225!\365\205\b\3249\rDNWU\226\326\204\345d\213\254\3023\220/\340\324\334U\337\366Ym\371\fF\027E\244\323%'>\340\023)\320\002\257\365.5\354\2310\\\363\302\374P\216\027\215\363\347\365n\260"
+	.ascii	"\250\275\240(\240\217\315\262\355\361\300\301\377\315\363\035"
+	.ascii	"\204!\314\324\344\025o@5'\327>\351\335z{"
+	.string	"\347\216\267\231i{\232lI9\360\305\352\232\231\036\374\370\242=HY\001\240\n\nA)\245N\321\3273%@L\301\373%$Rzd\240yJ\317\304\013\300#xBT\320o\307\373\347\245\313\245z\341z\177\013\326\370\326i\266\025\nt\317\336\344\"\200\r\337\366\346j\367UJ\272\2139\0061\320\371\305\237\343\017\340\377A\351#\353\263\201\252\240#\364\270\242\230\200\221>\344\302C=-\034\345\031\2709\375\033\314+\355XK\036\321C\304\204C\r\221~\366a\217\261:\r\361\313\331c\321\310?\256X^\222\"\340\360\b\370c:t\031\263\303\031s\036\234\007\021>\265|R~\b\250\257\242&\370B\333\252\030\306T\260m\351\2742\333|\221\r\275vt\241\355D\220B\354\3631Q\224\020\321r:}\322x\b\206\207\260\004_\3129\305\222\206fE\021\233\255$\325\027\372j\250\357\372\016\260z\363\315\373g\224\313"
+	.string	",\267D\362\305;IPk\366\216\004\320\333\357op}a\306\345\311%JR\365\364c\204\254\227)\026\310\264\205\207\024\265q\n\242\210\222/\366[\253w\255\005\007\020X\"\303\320\3204e%\267XL$\2472"
+	.ascii	"\212\f\371^ \335\361v\260\204\330\210\240Z*\035\030\037\247\311"
+	.ascii	"\246\236n\333\260+\350xX\326\231\r\265\361:S\205\215\361\rQJ"
+	.ascii	"\305r\"\345j\244\272\364q\314\2333\f\034k\311\254;?F\013f\214"
+	.ascii	"\273Z\244\223\001\245\017\371T"
+	.string	"\346\263\274\300q0\310\321i\307m\3024e\n!\026k\223\te!]\253A\"kM\300\261\376D\233\304A\"\037q\177\257\264\357\315j\330\242j\036@>\016~\347\265\200\330DH\030T\260\327\004\314r\341\350\210\273T\320\\\361\366\215rb@\215\201\237`\341{\224\377\261\337\r\226\202\363\026\342\226\234\336\315\334\034D\350\031\t\311\360\350\317t\240=\366\336\376;\272\252\356wp\353+\330<\250<\320\304;R\225\006'\017g-f\221\361q\237p\032\335\335(\354\370zk\252C^\013}F\373g\240j\353j\007\206\3661\261\341PF]\220\337F\016oh\362\201\214\031\321Dw1 \226\230\362\216\252d\033\326\223\364\236\347\246Aa>\272\325j8\331\003\325\325\t\373u\234#>\307\030\352\273a\277\005\236\327\242\375;\213\346\n\3750kX6%\016oP\257\036\277_{\270\254Q\331s\356\344&\262\353/"
+	.ascii	"8\356\346\032\310\361\266\245\333V\177\276\365\346\331U\272\200"
+	.ascii	"\233\177\372U\337]\375q(\236\260\320\374\004_B\323\307\220}\001"
+	.ascii	"\304\374\311\316\247\265$\363\333\021\327\336\026y\327\337\036"
+	.ascii	"P\333\224b\223\371\266\335\302\337\237\253\310N\203\354\375\007"
+	.ascii	"\230]\346IgT\332\220\204\t\22095\336\036\213w\\\177\034\3365"
+	.ascii	"\377+\306{3\351<\264\351 \276\303-\201F\243\277/\272\277B\333"
+	.ascii	"?v\263\225\224\303\341\266N\036\356e\342\264Y\311s\260\265OR"
+	.ascii	"a\264\316\2027\007\202\322\215\256\345C\212Ea\025\346,\332@_"
+	.ascii	"|>f\343\035\245g\004\336\006\342\377\360S\3052\313\n\006\247"
+	.ascii	"\277\017\331\023\224\361\217b\277\267\220\315\352\307\375<k\217"
+	.ascii	"J\247\361u\007\251c\254}\305\rS\300]s\263\215T\267\020\265\201"
+	.ascii	"\306\350\261n'\237}\017\007>b\3268\024\275\025\250\244\027\024"
+	.ascii	"\2369{S\245_\024\037\003\266\342n\024\364\256\205E\357blwn\233"
+	.ascii	"\323\340\232Q\253\276\n}\353\370S\367\202\235\365W\305\301al"
+	.ascii	"\026v7\366\363\330\330\274\350\231\305\315\325\337\321\373\b"
+	.ascii	"\345+\371\275x\2517\360\265\340\250\373\360/\203\3379\365aX\313"
+	.ascii	"\344\217\n\275\027y\340x\262G\357\241\245I\324\334\233w\027\004"
+	.ascii	"\027\346\254\233\360<\272X\3537\001tC\214\274u\276\224\245\365"
+	.ascii	"\337\246\337\036\037Q=\326\226\211\177\375,-N\273\304\277f\261"
+	.ascii	"|\360\177"
+	.text
+	.section	.gnu.lto_.symtab.e57560bfb476d2f1,"e",@progbits
+	.string	"tcpTotalRxBytesWaiting"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\003"
+	.string	""
+	.string	"isTcpTransmitBufferEmpty"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\003"
+	.string	""
+	.string	"tcpTotalTxBytesFree"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\003"
+	.string	""
+	.string	"tcpRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\003"
+	.string	""
+	.string	"tcpWriteBuf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\003"
+	.string	""
+	.string	"tcpWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\003"
+	.string	""
+	.string	"tcpIsStart"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\003"
+	.string	""
+	.string	"serTcpOpen"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\003"
+	.string	""
+	.string	"stderr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\003"
+	.string	""
+	.string	"spscRingCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\003"
+	.string	""
+	.string	"eventLoopModify"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\003"
+	.string	""
+	.string	"spscRingFree"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\003"
+	.string	""
+	.string	"spscRingConsume"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\003"
+	.string	""
+	.string	"close"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\003"
+	.string	""
+	.string	"eventLoopRemove"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\003"
+	.string	""
+	.string	"spscRingReadSpan"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\003"
+	.string	""
+	.string	"__errno_location"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\003"
+	.string	""
+	.string	"send"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\003"
+	.string	""
+	.string	"spscRingCommit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\003"
+	.string	""
+	.string	"recv"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\003"
+	.string	""
+	.string	"spscRingWriteSpan"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\003"
+	.string	""
+	.string	"eventLoopAdd"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\003"
+	.string	""
+	.string	"setsockopt"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\004"
+	.string	""
+	.string	"accept4"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\004"
+	.string	""
+	.string	"listen"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\004"
+	.string	""
+	.string	"bind"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\004"
+	.string	""
+	.string	"socket"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\004"
+	.string	""
+	.string	"spscRingInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\004"
+	.string	""
+	.string	"eventfd"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\004"
+	.string	""
+	.string	"read"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\004"
+	.string	""
+	.string	"write"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\004"
+	.string	""
+	.string	"spscRingRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\004"
+	.string	""
+	.string	"sched_yield"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\004"
+	.string	""
+	.string	"spscRingWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\004"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.e57560bfb476d2f1,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
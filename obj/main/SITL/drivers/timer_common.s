@@ -0,0 +1,236 @@
+	.file	"timer_common.c"
+	.section	.gnu.lto_.profile.17c6b5eb04565ff8,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.17c6b5eb04565ff8,"e",@progbits
+	.string	"(\265/\375 #\375"
+	.string	""
+	.string	"\310\027"
+	.string	"\003"
+	.string	"\317\253\250\341\002"
+	.string	"\001\265\230\240\355\006"
+	.string	"\002\267\335\335\337\n"
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.17c6b5eb04565ff8,"e",@progbits
+	.string	"(\265/\375 /\345"
+	.string	""
+	.string	"\200#"
+	.string	"\003"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001\003\001\003\003\002\002"
+	.string	"\004"
+	.string	".ev\004T\002\332"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.17c6b5eb04565ff8,"e",@progbits
+	.string	"(\265/\375 z\205\001"
+	.string	"\004\002n"
+	.string	"\003"
+	.string	""
+	.string	"\003\200\200\200\200\002d\001"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\201\200\200\200~"
+	.string	""
+	.string	"\006\002"
+	.string	""
+	.string	"\001\002"
+	.string	"\005"
+	.string	""
+	.ascii	")\034Ecs]n\342\261\2016"
+	.text
+	.section	.gnu.lto_.jmpfuncs.17c6b5eb04565ff8,"e",@progbits
+	.string	"(\265/\375 /=\001"
+	.string	"\370#"
+	.string	"\003"
+	.string	"\001\001"
+	.string	""
+	.string	"\002"
+	.string	"\001\003\001"
+	.string	"\002\001"
+	.string	"\002\002\002\002\001\001"
+	.string	""
+	.string	"\002\003"
+	.string	"\002\002"
+	.string	"\002"
+	.string	",\303o"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.pureconst.17c6b5eb04565ff8,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\200\004\001\200\004\002\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.17c6b5eb04565ff8,"e",@progbits
+	.string	"(\265/\375 2\315"
+	.string	""
+	.string	"h&"
+	.string	"\003"
+	.string	"\001\002"
+	.string	"\001\003\002\002\002"
+	.string	"\004"
+	.ascii	"/F\300,\004d\275\001,"
+	.text
+	.section	.gnu.lto_.lto.17c6b5eb04565ff8,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_timerGetByTag.7.17c6b5eb04565ff8,"e",@progbits
+	.string	"(\265/\375 \376\035\007"
+	.string	"\222\21525Po\322\030 n\203\2400\025fK\362\026\035\024(\201\223"
+	.string	"\321\213\243\342h\b~\200\265\205{\316\030A}\2667\313\240"
+	.string	"\006\353\004\035\314\002T\2671H\334[\246\025\036\211\210Q[\235O\314\262hM\310+\303B\020$\257\013LR\300\017\346\311\240%A\260sp\264\270$\f\305(!g\256n\225A\306\323\370)r/\344\025`\037\310\273\b\323iF\001f\267\243\206fM\224\013\311\257=\347\177\356\033\0344E\301\370\355~\274\264\354\316\205\0316J\375\253\211\236ho\005s\244$\2601\342P9\355N\370T\202J\251\215\016TJ=\021\335\324m\253\246(B\tK\214\314\nI\244."
+	.string	"bww#RI\177\372'\374\017\277G\b"
+	.ascii	"2\003\202\341\243\302b\025\220k8\007\213\001\331!\342\353\232"
+	.ascii	"O"
+	.text
+	.section	.gnu.lto_timerAllocate.8.17c6b5eb04565ff8,"e",@progbits
+	.string	"(\265/\375`Y"
+	.string	"]\t"
+	.string	"V\321A=0\345(\035\200\213\307\326\231\207\2175\204e\344\225\315\206bYp\275<\320c\2724\372\017$#^\333\356\242\r\200(\222}\3514\200\342=P\324\313\224u$\200\266\332i\261m\262IJ\001/"
+	.string	"2"
+	.string	"/"
+	.string	"\006\037-\220\327\200\335p:<\002\347\262\363\003\316e<9x\f\364\377z\266\202\"@\265\352860\261\273\306T+\326\035o{\301v\205\355\232\251"
+	.string	")\022\031f?\274\313\367\227S\366Y\017\222\220\210\316%(s\304\354\007\210\357.\016\307\335\021\033\231\335\260\301\016\235K\333>\313[>\203\ta\213\025%J\353\364\204\250\203\034\020*\246\3540\205E\023\373\331\356\256c\211}\327\377H@\003\200!fW\244"
+	.string	"\201\275\2213*\266?\333c\303\230\376\331\033\333\310\243\330\264j\242\244\255\026\324\315;Q\211!\262\240\234\264\026\362h\327Q\355\242n\035W\232\244\272ipu4=N\324M\255\222fH\3014c\2533\r"
+	.ascii	"2\003\202\341\243\302r\025\020\\Sr&@P\"\214p\204\020\224\232"
+	.ascii	"\007'\n\021\2321\t\223\f"
+	.text
+	.section	.gnu.lto_timerioTagGetByUsage.9.17c6b5eb04565ff8,"e",@progbits
+	.string	"(\265/\375`!"
+	.string	"\365\007"
+	.string	"R\21788@o\323\001X\340\311\006 \037R\327\357\315\377{\363\r\241\214wf\320\226V_#\201\205\177\215\315\336v\235\360o\030\036\340\034\031\335\240\330\320$@`\364G\275\244\355\224\002\023\231\207\323\344\347z`\310>\227\027\2211\306\341\272m\3530\007\232m\032hz4\223\320\250gr\332\265M\214z\223C\340\016\"\243\023\324utj\352\036\2646\026\224\310\256\241H\225\354W\273\273\2466\354\330\220qj1H\331\035\275\270\354\212D1\331\376l\215\355*\276R<`E,\341\002\346\3221\332\017\271\310\367\221\ngv5TNv\353\201\0210\227\233\017X\227\325\005\254K\333NP\370\f\276v\214\254\022\310E\311i\267N\212\343\340#\350\237\344\325\207\207IH\n=\002tv\3271$a\334\324m\027\330\356\3306\005\t"
+	.ascii	"2\003\202\341\243\302b\025\020]\363\036\026\307\b\367\032\240"
+	.ascii	"\306\230\256I\006"
+	.text
+	.section	.gnu.lto_.symbol_nodes.17c6b5eb04565ff8,"e",@progbits
+	.string	"(\265/\375 Ne\001"
+	.string	"\024\002J"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\007\177\004\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\b\177\005\t\177\006"
+	.string	"\003"
+	.ascii	"\200\036\340\207k\3151"
+	.text
+	.section	.gnu.lto_.refs.17c6b5eb04565ff8,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.17c6b5eb04565ff8,"e",@progbits
+	.string	"(\265/\375`\213\006M("
+	.string	"jIL\020H\200\334\321pM\021W\266\267 \026\016\243\237\020\002\221\306K\306 \243\003ib\361\225\001\253\242_\321\2134B&\227-\341\215\361p\377\205\227\3020\255\031\243?Z\335\377p\b\265h\233\226a\f\307\203\371Cq\263c\223-S\331"
+	.string	"\351"
+	.string	"\370"
+	.ascii	"ON\335\005\372\355.v\263\334\315\356f\273\333fD\276\3354p\255"
+	.ascii	"\262X\354\236\361Sl$\373\304\251\373dr\351:\266\313\244\233{"
+	.ascii	"\222\265T\266\212\227\345\366\311me\233I\031\325%{\325O\335\315"
+	.ascii	"h\252\362\370\342\354D\231\260\326IU\365\003\354D\277\201\tS"
+	.ascii	"\247\rU\2335'\372\n\234\025 \254\235\"R\371\212\261\330\212\223"
+	.ascii	"\374\214\204\227G\261\334^v\277:5a\f1\256\023\005b\237\024\345"
+	.ascii	"\236\364,\224\336X(\345\"\\\305V\b\370\310\035\020\275\306bu"
+	.ascii	"U\367{Cc\210\345\370q\242_\240\366\b\233\350\247zF\220r\032#"
+	.ascii	"Ho~V\222\376l\344?R\232\237\247\376\223\375\267\362\237\312\177"
+	.ascii	"\255\377\314\377Y\377\217\374\267\375\007\373\217\246\245\245"
+	.ascii	"\245\375G\361\263\206\377\006H\315$D\204\234h\224\367&\245\n"
+	.ascii	"\024\260("
+	.string	"\325\212\241\360\327\333\375\203\212\261\361\032;\252\177\331'U\313\360\373\037@Zv\346\003\307\211\236\207\352\317?m\241\261\273]\334\274m\034\346\234o\230\205~\035\256qP\327~3\353n\241\203\214\n\204KX\343D\377\003\365\220n\226\247\3376\266K)\266M2v\344y;j@/qt\373J\035Q\227=\373mn\242\324qD\373\272\306\366uY\\\023]\266\373=\342Z\246\220\345v)ul\227\356\221\247\211\315\366R\030\245\022\335c\033\346\036q\355Rxl\211RG\036(\035I\260\366\f\253\006ci\211\rUD\n\215\270f\373\272m\326\315L\2476\006u#]\243\231P\006w\r\233P\303-\241\313ow\023(\016\223n\023\233m\020\267;\3100D\027!\260o\263wp\223\305\201\354\374\356\260o\267\260%\211\274\360B\323\375\236a3\214\206\311p\031\266b4\376:\213\3411\377y\273\211\335\255\340\007"
+	.string	"X\022K\231\034\364'\017\225\177\270'\f\030\346:\002#\312\211\362\027\234\247\251\257\243\r\325\313\031j*\305IC\375\031C\375\t\245\236\311>\351\317\241\372&\373\2448\356I\233M&;\225\266\254\034Tbna\274\266\220cg\262\027\007\b\215\261\250\023e,\274u\203a\\\203\004S\245\n[\341\031]\313\242\203\205\232!;*\234\302\256\210\235\255\324\270$oT\235(\207\361\233\323\243\213\215\226\023e0VR3\223q\305\346D_\206\227\334$\315x\341j\252\347&\354\344\314u.\246\302@\335\312\036\226\t\203\260\332h}\241\351\031H\241\235\026\017\027]g*\277\003\"\236\222\323]\325\335\007\002\220\231y\275\316)??a/\226Rk\237\334fv\277<;\001\017\301\300@\260ID\260\351\227\202X)\254\"N \3516d@\302Y\352\005kI\273`Mi\365\371v!x6\246\246"
+	.string	"\002\326\340\216\367SR\212\020\364\237\210\0258\024\374\375\200C8A&\335\n\334\225\370"
+	.string	"\334a\270%\355\220NH\b\256\027t\316\353\001W\337\232\244\036B\321\202\"#\023\266\033\03558j\220\336\350(\227;*\312\251/\312\325V]\322N\311\302\232\264c\362\200\013\352\214\202\276^\223m\325\001W_\211\016+\017\330\364cZ\201\267\240.i\207\364\353\331\236\313M"
+	.ascii	"\362\300\341\202\312c\340\373--\375x:\340\272\324\013\0161\001"
+	.ascii	"W\022=\340\207!_o\2674\304\0032\r1H\240&M*\3542\244\354D\243"
+	.ascii	"\274?7_\326\270g\314\266\360\222\035\026\327C\262\"J\316r\306"
+	.ascii	"Kj\257\322\246$iD\313\237c4.\343"
+	.string	"\255\332\225Q\325BR\365\340\317\241q\027\016c\344d\004\260\002\t\225\030\366\372sh\314%q\250\221$f\2303\206\320\220\314\004Q\320&9\200\002\021\252\253y\021\200\265\241L&MKRj\337\275\247IC\347\n\236\267\222\030\324@7\327\3675\216\367\370\306\310\3633{\353\032:\214#\344\311\2248r(\034FR\376u+~Q\230\2570\227I\366\033}\002#\310\350\335=\361\276'\232\003R6\210\365\351\317\236d\021nc6X\301\030\324\240\360\342\271\252O=Xq\312\255}\036\200\022P\007\204+\204\037\351\315=\236\023\261\027\021@\244<\377\201\370\323\345\272\024\275K\212,XPq\222\263g\277\213\265\b\277\346\232\207\267Z\213\3057\002\232\200-U\b\304\256\020\266\311\231\n\244\224\3400$\001\250Kw6\351R\252R\177\367\214P\312\337\232\312\333\217a\334\302\210\255I\215\210\330V\276\233\310\027\215\300\346"
+	.ascii	"\370\240/.\223*\354l\376\272\202\337!\376"
+	.text
+	.section	.gnu.lto_.symtab.17c6b5eb04565ff8,"e",@progbits
+	.string	"timerGetByTag"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330"
+	.string	""
+	.string	""
+	.string	"timerAllocate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336"
+	.string	""
+	.string	""
+	.string	"timerioTagGetByUsage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.17c6b5eb04565ff8,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
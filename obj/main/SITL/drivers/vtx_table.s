@@ -0,0 +1,472 @@
+	.file	"vtx_table.c"
+	.section	.gnu.lto_.profile.5a37076a1df011d1,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.5a37076a1df011d1,"e",@progbits
+	.string	"(\265/\375 n\365\002"
+	.string	"\324\004b"
+	.string	"\f"
+	.string	"\313\352\314\217\001\n\002"
+	.string	"\002\001\002\002\002\003\002\004\002\005\002\006\002\006\001\240\342\234\212\n\002\003\004\005\253\312\246\312\f\002\006\257\375\341\340\006\007\234\250\314f\b\206\353\217\201\b\t\203\345\327\214\t\n\243\356\273\372\007\013\301\354\227)"
+	.string	"\006"
+	.ascii	"F\205\201;\320X\212lf\206\261\2016"
+	.text
+	.section	.gnu.lto_.ipa_sra.5a37076a1df011d1,"e",@progbits
+	.string	"(\265/\375 \030\245"
+	.string	""
+	.string	"p\f"
+	.string	"\002"
+	.string	""
+	.string	"\001\005\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.5a37076a1df011d1,"e",@progbits
+	.string	"(\265/\375 V%\002"
+	.string	"\204\003J"
+	.string	"\002"
+	.string	""
+	.string	"\025\265\307\365\367\002i\001"
+	.string	""
+	.string	"\002$\265\307\365\357\002i"
+	.string	""
+	.string	"\006\200\200\200\200\002d\002"
+	.string	""
+	.string	"\005"
+	.string	"\b\306\333\363\317\003g\001"
+	.string	""
+	.string	"\002\n\306\333\363\257\003g"
+	.string	"\003"
+	.string	"\216\302\366P\301m"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.jmpfuncs.5a37076a1df011d1,"e",@progbits
+	.string	"(\265/\375 \030\245"
+	.string	""
+	.string	"p\f"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	"\005\001\001\003\177\002\007"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.5a37076a1df011d1,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\230\004\005\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.5a37076a1df011d1,"e",@progbits
+	.string	"(\265/\375 J\325\001"
+	.string	"\324\002>"
+	.string	"\002"
+	.string	"\004\002\b"
+	.string	"\001\002\007\001"
+	.string	"\002\t"
+	.string	"\001\002\n\001"
+	.string	"\002\013"
+	.string	"\001\002\f\001"
+	.string	"\002\r"
+	.string	"\001\002\r\001"
+	.string	""
+	.string	""
+	.string	"\005"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"M\221(\270\017\f\274\001,"
+	.text
+	.section	.gnu.lto_.lto.5a37076a1df011d1,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_vtxTableFrequency.12.5a37076a1df011d1,"e",@progbits
+	.string	"(\265/\375`\035\001\215\t"
+	.string	"F\22097PuZ\003\244\275n\006\3302\226/\371\323\221\030\220;g \225/[\322\006\274,\303-\001\320E\357yRJUUUU\325\016K\1777{O\225>g\334f\220\264\003,"
+	.string	"+"
+	.string	"("
+	.string	"\323I\3277\266s|\357\220{x\016\246]\b\3649\203\017o\243\016\374"
+	.string	"\022\002,\262\223\026_\002\023hg\034\304\233v\206\215a\235\201\247\310UJ\030P\002.\344p\f\334\004\227!z\376\2617\310\364\220\353\"\333G\276\223\310M\256\256\201b\232\336\2765\236\213\366\036\005*\226\347-{\253\246\273\\\177\331\016\363=F.\263zE\205\030q\021mL\305\226\311\363\323\336'\323Q\327Q\266\247\276\001\330\245\353%\333W\276\317\310]\036\203\202.\004\372\374=_\355M3\275\346\272\315v\326\367\226\374&\262\"\212T\341\200"
+	.ascii	"q`0 \300\223\344\213\033bv\310\270a\327\266\006\316F\346>\334"
+	.ascii	"\020Yk\245\335\206\215,&#\232\353pCd\255\225v\0336\362fd\234"
+	.ascii	"\301\206\240q\3253y\212\273\370\212I\273\202/\033\2717\314\225"
+	.ascii	"\271c\257\265 \376\260\212"
+	.text
+	.section	.gnu.lto_vtxTableBandNames.13.5a37076a1df011d1,"e",@progbits
+	.string	"(\265/\375`+"
+	.string	"-\007"
+	.string	"t\f\266"
+	.string	""
+	.string	""
+	.string	"i"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\234\360\360\230\022\001}\273\001"
+	.string	"\005\001\006\025\001\005\005\001'8\330\306\001}\276\004\005\001'B\230\306\001}\301\003\005\001'L\330\305\001}\304\002\005\001'V\230\305\001}\307'`\304\001}\311\001"
+	.string	"?\202\210\2000{3\312\0014\310\001\306\001\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\tRACEBAND"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/drivers/vtx_table.c"
+	.string	"\tFATSHARK"
+	.string	"\tBOSCAM EBA"
+	.string	"\t--------"
+	.string	"\f"
+	.string	"\240\b\333*&\r\326@x`?\220\037\330\017\344\007\366\363\231\337\204\332d"
+	.ascii	"p"
+	.text
+	.section	.gnu.lto_vtxTableChannelNames.15.5a37076a1df011d1,"e",@progbits
+	.string	"(\265/\375`P"
+	.string	"\025\007"
+	.string	"R\214/5@S\323\001\3030\fC\240x?Z\336\342P\3302\f#\0050\212\205C\361\233h\346\203%\237\334r\317@4B\\\240\240(\331u\3420\024\315#\206\260&S\n.H[i\203\364\225\306\322Y\372 \255\2457\0257\021\261y\020\027\236\007v\"\347\341D\tX\301\331(\340&v`E\340\316\202\213\320\353\272\b\005\214\220~H\366\221\223\334\344'O\271\312Y\036\272\313_.z\314g\260\327\\\030\017}\034\032\013>\215\303\3124\3545a\030\366*\265(\354\025`%a\257\212\242\355u*\301\366\032\360\201\351\352\213|(k\257>\310G\362\020m|\214\276\017\364\216k\006\005\312\275\372\301\366(\017"
+	.string	"\023\303\b,\006\370\003\231"
+	.string	"\\A\306"
+	.string	"\177 \023\200+\310\030\340\017d\002O^\331\271\363"
+	.ascii	"\340"
+	.text
+	.section	.gnu.lto_vtxTableInit.20.5a37076a1df011d1,"e",@progbits
+	.string	"(\265/\375`\310\003\035\030"
+	.string	"\246)\224J\3000'\035\332\241\341e\350\374\244;\214\331\250d\373\256\316V\373\374\200\004\250\017\023\022\276\211\021\372\336\007~\001\262\366\376\261\335w\314\251\245\0271\216\242(\n\333\\s\377h\202\r[\227G\274)R\350hdm\033!D\356\224\002\201"
+	.string	"z"
+	.string	"|"
+	.string	"6v\371q\313\033\233\306\203\300za\321\016\212\034\265\326\333\202\230\221\036/\006oQ\2749m&\213\221c).\275\361\227N}=,\234\266\341\351#H>\032\350l\344\303\217\320eO\247\300\252S\251\303\217\320c"
+	.string	"|;S\027(I;\n\372(\013z)\322\206T+\016\303\207\203XR\204t\324\343\343Q\361\b\350\373\250S\0266\204^S>\240\323\030\203Z\253)\217\357\347\256\335~\315\366\002{]\002[t\225\001\303\356\317\016\362\350\022\r\215f\344\360\022\331\037\027\336\265rv\251\233\036\352~"
+	.string	"\220\032\346\220\207\020\353\025\254\2750\036\265k\264\022q\341/\365C}\355OI\0250\301\316\244\022\331\351G\271\204R`j\035\220}\364O\\\350?\271t\272\261\371\351\2617\303<k\255g\362\235|\023o\262y\320C\221\234`\365%"
+	.string	"V\235\266\217&\221}\024\371"
+	.ascii	"\362\243x\001\344G;=\256:]\032\203\244;\333\203\2318tL\036n\013"
+	.ascii	"\227u\255\b9\025\025\362c\351\343\221d\177\205\302\261V\bX\375"
+	.ascii	"J\347\362\362B~\334\352\235\343\376\374r\211<\373\332r\367\213"
+	.ascii	"\332\376\355\031\357!\371\375\r\341W\016\335q\261\326ZE\033\370"
+	.ascii	"\267\334\017\231\\:&\217\206\371\217!mW\270\212\230\020`\255"
+	.ascii	"\025\201\237\342T3\276\321GO\250\241\347\251!?R\365F\230g\r\034"
+	.ascii	"\032\266\0014\270\024\026\007;\334\214\256\205\226\302br\"\346"
+	.ascii	"n\024\022\234\204\023\023"
+	.string	"\230\007402\267\227\035N&\267K\271\261\344LVn(\273\227\033I\210u-\270\335\rF\247\333\335\312 \316\227\336\240\251J\007\030\316\362h\373s\254\204\354c\267E\314\366ZmO\302\263\332~\254\f0K\307\344\305\220\027\332\020\336\3055\005dd2\r\311\366\347\273\370\013\017}#\243\030\313XK\247J=\031\346\031\333\237Ax\306\331\356Wi;\335T\250a8\305\030c\202\231\221\tf4)\244\003\260\002\231\261\271\r\021\200%\206\206\246 I\2151\002\317;\241@\303-\344\246)H\313E\335\336\343Q\330#-o\264\017Ynu\206\013\303\035\\\030\360\204\241Z\b\277\253y\213\213\251\301\037\225h]*\373\265[1$\346I\251\205\004\354\037\245\023\374\2348\332V4& \262\300fM\370\205\037\024\262\020\003I\243\355\225b\305\0030\312\024$\325\263\214\347\267\374\273\374n&h\220\0014\365O\234\327"
+	.ascii	"\331S\331\325\030\336\202\246\361b\230\036\361\030\213\304\266"
+	.ascii	"\226\335\225\255\321\205\300\351\361\205s\375\362\304\037"
+	.text
+	.section	.gnu.lto_vtxTableSetFactoryBands.21.5a37076a1df011d1,"e",@progbits
+	.string	"(\265/\375`\023\001\235\r"
+	.string	"&\232^D"
+	.string	"s\224\016\270\211P&\204F\030\002\307"
+	.string	"\301\205\033\330\200w\024<%B\360\326t\231\230\f6\n\314uE\037\241\330\255\377\3707@\265{jUU\275^Y\302,\363\211d\377\320\007\352\251-\310'{\313\235RI"
+	.string	"K"
+	.string	"I"
+	.string	"\340\276\365\301Ckfw5U\341y\031\3362v\237Rc\347\277\274"
+	.ascii	"\b\304\373L\237r\343\262\001\003\340\343 MXX\270\234\365\250"
+	.ascii	"\362\235\242tY"
+	.string	"\271\236u\004`\214\367\255<j\032\354\256\243\367\215\270\261\333\346l3\260\377 \233\022<\f\300\354\206x\025Y\231\211c\305W\267\377\302g\231\343\303x\330}eWf\022\221\321HyAv\267\344\323'\331'\201\013\300>\345\003`\237\347\330\216\321^`\322]\2052\340Bn\250t\354\206\n\334\311>\335\331?\036\006\273\273\322\t~\305\224\004\306t@q\212/K\265\255\3413PH\300\335=\361e\274u\301o\3714\206R\274\367\351\227X?\220\2425\344DJ|\251\262\344 \001B5e\207\246\250(W\213\217\031+\312\376J\365\313\257\356k\002\333K\\h\364\3618\020m#\376t@\023\"xF\0202\214H\232\210\003\2216N\202Va\363P\320>\234H\353\2208d\001\304i\243P\210\3238\341^Q/\317j\230\220I\321\323\324\2245.\024S\335\021K~U\231\267\013\273\276E\214\036\033\"\221\313\025"
+	.ascii	"2\003\376\031\343\374\343|\330.>c\025\fV\025\266#\306&LK]\306"
+	.ascii	"M\215\t\302\212\254G\217\024\242\224\324\345\240]\034\026Q\366"
+	.ascii	"BU\343\375$\322\271\346\023"
+	.text
+	.section	.gnu.lto_.symbol_nodes.5a37076a1df011d1,"e",@progbits
+	.string	"(\265/\375 \220\335\002"
+	.string	"\024\004\214"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\024\177\016\370\354\254\325"
+	.string	"\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002"
+	.string	""
+	.string	""
+	.string	"\005\020\017\201\204\001\022\020\023\021\021\022\002\025\177\023\017\024\016\025\r\026\f\027\005\013\030\n\031\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n"
+	.ascii	"c\310\003\f\f2\006\031\203\f\177\365\t\030\030d\f\022\217Vy\002"
+	.text
+	.section	.gnu.lto_.refs.5a37076a1df011d1,"e",@progbits
+	.string	"(\265/\375 !\t\001"
+	.string	"\035"
+	.string	""
+	.string	""
+	.string	"\005"
+	.string	"\001\001\001"
+	.string	"\001\002\005"
+	.string	"\001\003\006"
+	.string	"\001\004\n"
+	.string	"\001\001\013"
+	.string	"\001\005\001\001\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.5a37076a1df011d1,"e",@progbits
+	.string	"(\265/\375`G\t\2155"
+	.ascii	"\032b\004\025D`\246Q:S\330\300\017\313\320\310\rC\323f\034L\264"
+	.ascii	"\261\213Y\333p\035[TW\220@B\327\361\021\303F\2617lX\335\321\365"
+	.ascii	"\027\311\253\330\252r+\222k\347w\241\230\227\371O\375\352&n\020"
+	.ascii	"!9a[\246\016\001D\001D\001f\330\214\317\226\030\315\031\215\323"
+	.ascii	"\236+\266\335v\267J\027\n\"2c\027\335\261/\275M\352\371\314{"
+	.ascii	"om\341\252z^J\213\236O^J\217\306\276\024@\331\222jT3\363e\f\031"
+	.ascii	"\022\216\346\223+\027=\223\375\314d1\f\266\242\333\330\335\005"
+	.ascii	"\222\272p\355\030r\321\007\354Ks\334KY\354w\036\353\245H\255"
+	.ascii	"\266\225\320$\203zX\271(\312\275\260\237\275\360\027\006+b\261"
+	.ascii	"\224]\326\335\362\214\274\254\351*\273(\203]\016\303\355\031"
+	.ascii	"\214\301\234\202\205\353\214\375\245\273e0\264\273\310\334 \211"
+	.ascii	"\271A\256)\2458\226\242\277\352[\366\245*\367\322\023?\317is"
+	.ascii	"\222\371?\350g\002?\373\370\260\200\377E?\253?\033\375\277\377"
+	.ascii	"\355\375\254\364\263\356\347\243\377\317\377\210\376\023\372"
+	.ascii	"\357\347\277\236\377w\376;\377\333\371O\347\377\211\377m\376"
+	.ascii	"\307\371\237\366?\315\1771\377\303\3747\361\277\355?\333\177"
+	.ascii	"\265\377c\376\223\375o\377#\370\357\346\177\372|>\237?\357~\356"
+	.ascii	"\337\210Ik3\231K$\313\234\222\344u\221\267\305\270T6\263\230"
+	.ascii	"\334\355\220\306^\331\266\227I\266\227]\200e\026\327f\026\233"
+	.ascii	"\327\275l\266\215-r\3072\227I\226\271\\yl+\2335*}\354\272]\256"
+	.ascii	"\254\230\267\225\327Le\222m\227I\036\373&6d\215\f\210\020\226"
+	.ascii	"\303\032\233\307q\253\210\334\271\261\255\262\235\335\\f\325"
+	.ascii	"H\007\335[J\244\263(\204\321\252\334xT\231\025\225\334v\367\201"
+	.ascii	"cU\227\262\215n\354\227\262\373\253\352E\037+\254\255[;a\267"
+	.ascii	"5\311VcYu#8v\257\334n\335\275v\267\021r\253\355&\262c\275\216"
+	.ascii	"\307n-\003\307\336Z\323\254\272o\331\035\264$\313\354R\376\322"
+	.ascii	"\310\230^}\325\256\354\325\316%Re\256a\215\005H\365J\376\370"
+	.ascii	"\343\326v\244\005\210\263\355\242\347\266\237\341p\034f\323!"
+	.ascii	"]\235)\032/Z\324\354K\233\230\277\363\233\"g2-\313\r"
+	.string	"\033;\275\214\274ak\243\344\005\310\222(\355\227\243\2648,Y\027\3455\314\346\274\306\315\242U\254y\255\202\262\273\310kJ\207\272\213J\314\r\230\033\240]\272\250\224I\321cP\177V\243\226[b\2051Q\3432\234\206\225(\025=UQ.\312\001e\352\363\311\346\236qj\242dQ\317q\314\210\316\030\021\307\031\310\215i\351\232(\371\302\272\350\357R\345\270{\213,%\261\005\302\302\026\367s!6\304k)k\\~]\264\211}i\312\\\230\001\2351 &\004\242\355\325hl\310\025\034\334\033\034\025+\027=\023\3729\020\013\272M'\312:\027e/\277\363 \2459h\004M\271(\332\226]+>|\330\217\272v\257m\367`1\354\025\334\215\270\366\310}\316~P'y\262\360\\\364\202\030\354\377\221N\207\0175\256=y~\026c=|\306y\336\004\321\241\313\210\2346N+\027e\300\276\364\314v\347\214\357p\233"
+	.string	"\344\207\261#Ia\320`M!s\236\261\223\325R\244\2071.\2444\\\317'\027=[\261s\306v\230\254\351\303\234\255>\215\324\212`\364\306\f\007\226\213\236\267\324\263\034~;\3179\3439L\347\273\356\256\352\346\222\003!,\321U\032\\ki=\b@V\304\314\211\2403\235\357\321u\202\334\333\327\2242\027\375\223\372\377\234v\021\331\335>rm#\253t\347\034\363\203\037\211\213\330\301\177\264\033\311\331}l\022H\275\202\246X\344\242\377\031t\200\266\233\307\032;D!\225\024\007\242\220J\212\303"
+	.string	"\033O\302 \225\214\340\320\003oj\030$\022\203\"Jx\350\260A\203\204t*\b\0038\"*(\024\002_p\0300E\f\232(0\025\025\234\021\214\n\262"
+	.ascii	"\212\230\nRE\001S\f\2034\244H\364Z\b\201\033l\f\245\210O@\017"
+	.ascii	"S\276/\270T\214\340\220\211(%5d\n@\204\022\2068Q\2038C\367'\250"
+	.ascii	"aP\030t\241\276\202\223\004\247\0135\214~!CS\206\246\364\027"
+	.string	"2\374~\031\234~\352\235~EC\340\213'\224\250\302\351G\024BQ\251\377\37580@1\342\203\3724!\030\305\002HTQ\2038\203ij\030\234\0015l\301$\204\002\302`z\032N1MP\020%%\265AENH\220t\214\332\230\327E\177\203\274E\022&\245yQ\n\277\337\254t\213\032$\205\200\334\037a\354\2402\367\307\177\223\327\007\257\255x\222\365\243\214}\351\321\221o\217\036o\376\250{\311\307KUj\365Y\371\250\271\253\203/\326\305z\023\335\265\361\t\034\272\266\245\334bSU~\363\256|v\327\233\343\210E\277\n]\035}\212\210\335\034\377-\336\252\313\262\216I\224-\305\213\376\262\377\265\272WfIU\340\030YsQ\336q/\275\306\337/\016\005g\232i\0275\342^\232k\264\033\200\246\250\201,\204\f4D\021\242\031\221\221$I:p\002\021\261:\326\001\021\200\255\202lh\n\222f\177\003\220"
+	.string	"\212\326\005\024@V\330\340\373\370\200"
+	.string	"\034\353\345&\203`\264\224\3433\236\372\341\311\211\267\371M\363\376\323T\304\372A\304\2356\314b\3113\205\303y6\312\024\316\261>\013\213\357\211\232\230\311(\355\343\250J~G\035\321p\330Q\th\233\"\007\3400\3309\024j\321\372D\036\004\270\231\206%\005\340\365A\327\341\327z\256\303p\220\t\326t6p\022q\337\331(\371B\033\023j%Ic\224^K\224\363\215\034\\\240+\367\244(Q\207-\210RG\036p\372W`V\367\326Q_\247\303<\324\324;\034g8\242#P\206Os\037\t\247x\237zsv9\263\343\356\264F\325\330C4\367#\005\204lT\326\361jB\340\264\022O\335%5"
+	.ascii	"U\331p\016%.\220\352\222}\243\\h<\363\362\177\024\364\266m\346"
+	.ascii	"6\016|h\353\305\035*\236i\034\016\220\316\013\026\207C`\303\321"
+	.ascii	"\004\323\020\372\307\f\016\226=Rc\267\326dQw\031\353\310\361"
+	.ascii	"\b\006F/A\263\036\313.\250^\201\250\303/v\306\252\304\365h\326"
+	.ascii	"\245Eq\351\003\260\367c\223\324\3537\211\350\351p\213\217\306"
+	.ascii	"\233\364\216~-\217\252g\261\203 \016\371\227\355\0071\262\320"
+	.ascii	"X\025"
+	.text
+	.section	.gnu.lto_.symtab.5a37076a1df011d1,"e",@progbits
+	.string	"vtxTableInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344"
+	.string	""
+	.string	""
+	.string	"vtxTableIsFactoryBand"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346"
+	.string	""
+	.string	""
+	.string	"vtxTablePowerValues"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350"
+	.string	""
+	.string	""
+	.string	"vtxTablePowerLabels"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352"
+	.string	""
+	.string	""
+	.string	"vtxTablePowerLevels"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355"
+	.string	""
+	.string	""
+	.string	"vtxTableSetFactoryBands"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361"
+	.string	""
+	.string	""
+	.string	"vtxTableChannelNames"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367"
+	.string	""
+	.string	""
+	.string	"vtxTableBandLetters"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375"
+	.string	""
+	.string	""
+	.string	"vtxTableBandNames"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377"
+	.string	""
+	.string	""
+	.string	"vtxTableFrequency"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\001"
+	.string	""
+	.string	"vtxTableChannelCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\001"
+	.string	""
+	.string	"vtxTableBandCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.5a37076a1df011d1,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
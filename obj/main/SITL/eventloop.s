@@ -0,0 +1,653 @@
+	.file	"eventloop.c"
+	.section	.gnu.lto_.profile.fef2d5870ec52185,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\n"
+	.text
+	.section	.gnu.lto_.icf.fef2d5870ec52185,"e",@progbits
+	.string	"(\265/\375 \374-\005"
+	.string	"RI )pe\322\030\374\202\245p\3168^\252\027\177\316\207\361\027\274b\006\205\360\377\377\377\377\377\377\227\313\210\221-\367\336{o\222\266\f\372\317\326\037<\204\252\302\234\303\251\337\324nj}.\007K\026\027\304\356\372Z\351J\004\310\025l:\225O\334\337\273{\327\003L\244\2610\240\254,\310\310\305c\\\036\207\263\337lw{z\322\t\022\3001\001\265\307p\036\231\3515(\256\006\373g\353mR<VD\247\222\002\r"
+	.ascii	"\270\340\363 4\314\3516\305\016L\\\235\\\201)t\206\2725\253\001"
+	.ascii	"s9q\332\233\322\004\f\332"
+	.text
+	.section	.gnu.lto_.ipa_sra.fef2d5870ec52185,"e",@progbits
+	.string	"(\265/\375 \222\245\002"
+	.string	"4\003\206"
+	.string	"\b"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\005\001"
+	.string	"\001"
+	.string	"\001\003\004"
+	.string	"\003"
+	.string	"\007\005\003\004\001"
+	.string	""
+	.string	""
+	.string	"\002\b\002\002\t\001\001"
+	.string	"\001\n"
+	.string	"\001\013"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\r"
+	.string	"1\002`|\004\330\001\031\2002\300\206\n\300\341\272\020\314\231"
+	.ascii	"U\031:kD\tk\003X"
+	.text
+	.section	.gnu.lto_.inline.fef2d5870ec52185,"e",@progbits
+	.string	"(\265/\375`B\001\345\b"
+	.string	"\002\314(/`M\222\016\320Ja1\006{!\334\250\025\025\363\336\021\252\360"
+	.string	"\223\202\016\021m\004B8\202\341d\f\227)\322\337\332F\210\265\304\222F\266\334)\377a\245\213\200TH@\213a:\375\006<\337\261~\217\250_h\304\205E\bA\377\030\212\301\2211QpQ\305\362D\237A\244\230\222N\367\340Vz\034\352}\337\306\322\026F\231I\371\2042\2006\271\315\332\373\2428\3525u\200 \361\020P\350\307F\311\303@k\310L\316k\260#3'\0131\235\373\361\207\322EP\237iff\373\267A\215\314l\353u\r\0023 P\"B\204z\204lp\020\332\201e\205\276\204ggs\324\275\300\202\335E]\fP\t\320\n#\307,\013\264\002#w\3652\254\r{id\001\253\026\341\303b\025\f\201\005\374)\272\356\031\210\3057"
+	.string	"e\241X\257\351D@\t!\246pJM\260\035\243\301\341L\330t\026\370\313\243'\f\f!\rP?\300`?iq\317"
+	.ascii	"\305\016D\340\017!\347\033pmh\316\r"
+	.text
+	.section	.gnu.lto_.jmpfuncs.fef2d5870ec52185,"e",@progbits
+	.string	"(\265/\375`\264\002=\f"
+	.string	"\246\32193`U\223\0160\f\203>\0228\034B.I\022\004t\200\242\260\035\256\306z\n\024ns\265*0<"
+	.string	"p\226\372\267\030X\337\004\030\331\357\311oo\275wJ)'"
+	.string	")"
+	.string	"*"
+	.string	"\316\271\001\332\275ak\370.\347\315\266\025\361\202\237\3364{\323\356\346\331\247f\037W\372j\357\215\336\332\257\353C\273&\001\001\017\212z\233\022\327\261\302j\363\320CA\017\345\002ho\rig\223\212;\303\360\335\25647\272_3\370\315\272\226\265\253\001Ue\226\r\276$I\270\016\304\035\254\205\332\314\247\366\037z.[\300+\022=\373\016\276?\237\354=\013\236\321\223\340\t=\037\225\003\232\013esP\310\202"
+	.ascii	"#\320\0221\027\n\005t\210\032J\274\250L`0S&N2\323\004\241\261"
+	.ascii	"\210\030Q\222Ps\230cG4\327\340v\007`\266\371\252*E\2501A\306"
+	.ascii	"P\321(0\267\260\031\200\002\0212;\017\021`Df\030c\216D\013\314"
+	.ascii	"\256\326\f\307\363\242\350\212]\231E\341=\207\002\274A&\305r"
+	.ascii	"^\267\227a\017\346\342\205\226\276\337q\267\211\247)\334\310"
+	.ascii	"o\222Y\262g\313\213\032\207\266\032\320\031\226\001V\342\270"
+	.ascii	"\304\372\357\177\276#\273\022\035[\333[\247\310\314\340^L\252"
+	.ascii	"\260\331\377DVG%\233\207\2452\032\237kEq\362\267\300\255\b\227"
+	.ascii	"\265 F\210\336\307\316\267a\366\365\277\243c\273\207E\023\301"
+	.ascii	"\243\343\346\276\256h\367 \026+U\247\370"
+	.text
+	.section	.gnu.lto_.pureconst.fef2d5870ec52185,"e",@progbits
+	.string	"(\265/\375 \035\351"
+	.string	""
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\b"
+	.ascii	"\230\004\003\230\004\004\231\005\007\232\004\b\231\004\t\232"
+	.ascii	"\004\n\271\005\013\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.fef2d5870ec52185,"e",@progbits
+	.string	"(\265/\375`@"
+	.string	"\245\004"
+	.string	"r\006\022\031\240'\351\377\377\017\352\377\377\303\352/0\373\277\345\223\021Z\263\337\217%I\246J\330\304\016\261;\\4<\260\312\025&P7.--\241\027\306U:\027@;cw\354\222gRt\310\023\371<\240\234\347\361\324_\343\024\001\037"
+	.string	"!\213D\322\202n-C\322,\350j\212\007+\270\222/\321PZ<\020B\203\310\3462!\n\250\013D\r"
+	.string	"\207a6\314\tk\271\310\332v\f\302"
+	.string	"\261\256!\222\020\374f85\013\3729\223\022\007.\200\275z\216Z"
+	.ascii	"7"
+	.text
+	.section	.gnu.lto_.lto.fef2d5870ec52185,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_onStop.24.fef2d5870ec52185,"e",@progbits
+	.string	"(\265/\375`\364"
+	.string	"\345\f"
+	.string	"\326\230XD\020o\234\016\300:\354\236\b\225G3\366\225\217\217#\352\272)0\002\260r\377\023E"
+	.string	"\304Y\340}Fk\364\257\007t\236\021\037\033R\n("
+	.string	"\243r)\262\323Ei\026\276\334\221\221\316\254?aG\332d\357\224\002A"
+	.string	"D"
+	.string	"G"
+	.string	"\366?n\362\016\222\301\225\335\016\323iW\334\270\300u\212\371\305:\255>\300:\265g\267\270\350\261\bRl\214)\273['\210{\227\236\377\361\225\220\343\273\304\350\354\256e\310\321\341\236\267\235\261\275\300>\0302e\213\237\234\037\354W\273\273\236%\273\222\276\345\331 \271\224\354nH\275X\024zB\304E~\333\363G[l\213\220:\031\032\030|\250@\355\2364\247N`K\361#\274\207\230\305\003\354\226N\016\\\247\026\257\313&\030\001\217]\360\241_\362S\004\t\030\346L\273\230\240h\314\317"
+	.string	"\344u\237X\037\371\350\341\254\b?\355\n\037\371\320\030\215\371\331\336^\302(\256\3355\340\223\234\304\005?\304\251E#\371pd\235~N\023)\036L `\035h\264e\024\353\260\t\225\310r\306\tm\233\205\016\244a\320\252\003\b\r\036\324N\243\300a]\005y\260O\3158Q\345d\274\2054\256v\333\306U\213\270\257v\226\274\341\340\002\005\316\f\223\252\335\016\005\250\020\231\262"
+	.string	"\271\271\346\037y\025"
+	.ascii	"\001S\340L\350\026c@\177\250\214&8\030\230E2\2671\367\250\335"
+	.ascii	"r\254\351\036c\255\\\243{&\310D\021\030*\\\247\202jj\n\334\013"
+	.ascii	"\246\246\214;\274h'\031"
+	.text
+	.section	.gnu.lto_eventLoopInit.25.fef2d5870ec52185,"e",@progbits
+	.string	"(\265/\375`\362\003\315\034"
+	.string	"\266\365\275I\220\232Q:p\225\021\005>\224'B\005<pU\331\264Vh?v\363\230\267Y-A\263ta\241\306\032\036\354\267\331\253\354S\357<\"N\245\271J\236\244\317\301 \270\352\324\207\214C\205u`\021\243@\267\376m\357\275w\222\001\247"
+	.string	"\237"
+	.string	"\256"
+	.string	"\0376\202\245\246_0\347l\324\237j\235_\342\253\030]j\306,7\3149\233\217*&\013\261\337>\312\336}\324\027\266N?x\250\243G\321\260\371J\266E\336t\t\"s\316?\277M!\366;;\001\374k?"
+	.string	"\3776\205\nG}\026H\252g\270\224\254 s\036\226\325\310\317\303\360\265\225\236\375\334a\2258%\265\205\305\307\343\330.P\232\263d\307\307\263\007\2209+$zc<n\023\004\213la\361\355x\265%\023\325\323\216/\311\366\250y\302\345\302\323\033\276\035\245\260\f9\347\246=\237\216w\354\335=\243\273\315n\033\013"
+	.string	"z\364\251d4V,\347|'[eRd\250~\354\320n\223\005~\257V!\034\310/\257\335yq\2005j\005\376\374U\006\204\330F\353\013\022\205\323\257}\252gi\254\276S\023\365\325\355\367UW\217\215\216&;"
+	.ascii	"\235\345\374\306\302\335-j\364\275\327\013\357\241\253\352\313"
+	.ascii	"\013\251\346\272\207;Z\201\335\257\311d2\331\265\251\273i\373"
+	.ascii	"\\\332=\2276\317\243\336\262\246\215a\264\357\245m1\355zi\337"
+	.ascii	"\200\n\342\2321h\352\3260\347H\312\311\307k\365\364\342\037u"
+	.ascii	"\332\375\276\225\027\373\306\326\231:2\n]\r\324\344\306\323I"
+	.ascii	"\003\375\002\210\202\241\334xFi XN\313\224\362S\276\325]e\036"
+	.ascii	",\035\207'\225\023J\367\336\213}\n\257\245a\314\025c\374\222"
+	.ascii	"\325\027{\303\217\215%\300L\316\031\250\017\346a8\364\235~\333"
+	.ascii	"CP\220\361\364\310\222\224\037T\220\377\304\375\254{9?\204\b"
+	.ascii	"\301%\347\027t\243\243\311g%\321\022\342\323\300\262*\033\222"
+	.ascii	"+@gLw\200\273E\214\240\357\311*\017\023\244W\022\375B\312B\336"
+	.ascii	"\n<\005^\005!Z\002\324\326\017\177U\342\307\237S\316\274\367"
+	.ascii	"L\304x\030\032t\237@A\337\353\031\357U\347\362\"\005\215\206"
+	.ascii	"\177o\r\035`h\301,\302l"
+	.string	"\310,\"\242\255\230M0q4\363&\224\242\250\250f3Q\330j5\020'\030\334\241\016\266\032\016\006n!\t\266Z\255\b\347\302\214a\226 H\004\215(q&\213\033\rW\272 \242\265(\205n0J\t\n\272f3o%\256V\273\225:C\335m\256M\r\333\331P\332\202}\352\205\267QH\343\026\333?1\2567\272\033\327\316\240\253;\233s\316\260\n\2649\023\301\360\342\357U\205&\373\347=\325\247^\220\"c\264\332\321dC\240\277r\343\211\004\302yj\277x&9\225\320\367z\352L\251\346\332\213\247\312\320\374\204\364x\232\240\256\247suE\250a \245\0203\310\031\032\211dD&\214\333\220\002\2219\2639\021\320=\273\031\323\335z\t\236UhfG\017>o[#R\034 \202\212\313Ed!-E?\026t\020=\017\374\300\332}\367H\266_\233\337f&\375\376\322\343\020\022\341\372{)`\235\253\275"
+	.ascii	"\2637\342\314:\365T\340\r\022\344\327:[\247\034G\004Y%V\t\347"
+	.ascii	"\244\331\365\363\326\017\363\245\312\324<K6&\275B\002\201\036"
+	.ascii	"\205\332|\255\027\340\231^i\027\306m\333L.t5\335\b\200\271Xb"
+	.ascii	"\3511\024\343\237< U\003"
+	.text
+	.section	.gnu.lto_eventLoopAdd.26.fef2d5870ec52185,"e",@progbits
+	.string	"(\265/\375`\372\001\255\021"
+	.string	"v\242xH\320\3624\035\242\336\243M\333F\221-R\002\275\214\273\307\203cAI\330;e\346\313\177\032\020\372\267\371\207\266\203\305\036\264\300p\f\376\035\301\315?`:\375\301BH\203\225\"dT\376ch\220\216^\261a\311\322&{\247\024`"
+	.string	"d"
+	.string	"a"
+	.ascii	"\224<\321\353Ev\362j\367\207\307\322\356\226\230\001\367:\242"
+	.ascii	"\315i\337\305\205^\037\272y\310.P\271\264K\226\370\204{5\371"
+	.ascii	"\002\333+\367\001\333\253m\237,x\031\347$\212\236\227\340\331"
+	.ascii	"y!\265Kv\364\304q>q\374\227\257?@\340\210\371\300>U\016v\327"
+	.ascii	"3\346\343\341\246\267}\300v\005{\212\001B\"r\346\314&a\223\232"
+	.ascii	"\260\257\355\356\232\002\331\236n\375\350g]\351_\035\351W\275"
+	.ascii	"\350\257\037\3725:=\351\364C\024\220R>Dz\354\366\314\200\354"
+	.ascii	"SeJq\331o\277\374\322,\037\306c\274.\223\341VE\004\235\020Q\273"
+	.ascii	"\035H^-\341\t\300\246d\250\033)\025\211FD\300r0j\361@;\262\t"
+	.ascii	"\202\022\247\366\005\f\363\261IGv(\314~\215\333\260\223\037\344"
+	.ascii	"\fn\232\217\271i{=\245D\345\324\007\215\332\336i\030\312.\373"
+	.ascii	"{\t\332\365\272bQ{\345\245\215]*X\271\2426\313\233\fEB\306BE"
+	.ascii	"\355\2263\321\324\034IS\225\332/_\262\023\267\273.\177FM\030"
+	.ascii	"`G\320\253\177\263\275\"\340Y1\"#\fX\003Vo\364T\264\226\317\323"
+	.ascii	"\340\342\342}\334\314\246\262a\202\237H\023\316l\376Lb\302\320"
+	.ascii	"e\204\001k\300.\205\002\204\t\335\b\256\210\336\330\301\260x"
+	.ascii	"/\335'\316t&\006\034\306\200b7\206\241\330\261\310\275\266\024"
+	.ascii	"\250EGr\250\216e\264\335\237\006\227\375QEsf\222O\332\242(F:"
+	.ascii	"\222\230t\346\314\004\346e\274\264\300\305*M\360# \240\002\221"
+	.ascii	"\322\355\253\022(\nM\300\300\245#\212!\b\252A\371B\264\357G\017"
+	.ascii	"\007\035G\201\243\222|9\246N\332f\3541%$ \034\270\020\270\027"
+	.ascii	"\213\260@9\300\225\346\372\004vR\342\021\302\005\025\206.\323"
+	.ascii	"\021\205\270\215\301\225\244u\214\351\242d"
+	.text
+	.section	.gnu.lto_eventLoopModify.27.fef2d5870ec52185,"e",@progbits
+	.string	"(\265/\375`>\001\225\016"
+	.string	"\026\035eE\020\315&\035\bI\310\027\t\024\226\271\344r8\362\025\026\331G\300(\267\315ue4\2423\245\262\203\326\255\345g@GJ\247\351#\214\244\025"
+	.string	"-q\226Ii]\344\024\371%\3367D\264\034?\254\021K\273\311\235RO"
+	.string	"O"
+	.string	"P"
+	.string	"\b\262\317PGJ\373\037\316\362\3355\362"
+	.ascii	"\273\254\0222\273!\2065\262O\207\037\200}f\027\200}\332\266\306"
+	.ascii	"\306g\324\303\025\223kX\225\274\340\354\206\232r8\352\022\345"
+	.ascii	"_\374\002\024\f1\340I\352\322\303\261\273\226\340\t\312\255\267"
+	.string	"m\300\266\002\373br\264\303\224\324\r\366;\273\273V\226mi\320]\277\347\257\177Ni\235\322rJ\337b#\005\007\005\201q\327dL\2616s\246\303a~\373\363EW\370.\177\371\016\023\222\255\007\007\252\225\233]\013\027\237\346\260\261\320\360-\337_\"\376\354\252\344\004\212q\2516i\223\007UC%\232\262\037s\031\327\370-w\230F\0364\r\366)\365s\301\036'\341\032\223\310\037a\212\240\255U\253\365\351\217`\237Wm\241\311qy\324\376\270\b\237\260\310\346.N\260\350\3633\325>]\024\261\350@\205\224\025K\006\222^i\003\331\346\t\333H\035\005\356\204\231\224a\3428\t^i\003\331\264\006\020\030<\320\274\255\243\033yZ\311c\364\241\221\272\223\226Q\300\234i\3534\217\343:\255\"\334wVY \r\221\250\312!\235]\225\0047/9\372\342\252 \275\013\b\023\342\214J\216\006 \037\342\342(\003\037\027"
+	.ascii	"xS\240\314\320[\003\023\331\370\005l8W!\036\3248a8\003\323H\020"
+	.ascii	"\335\305\347jo\212\016\\c\230& \270\300 \004\356a\201X\020>S"
+	.ascii	"\243\340\262\244\251\211\246k>\001"
+	.text
+	.section	.gnu.lto_eventLoopRemove.28.fef2d5870ec52185,"e",@progbits
+	.string	"(\265/\375`\235"
+	.string	"\345\n"
+	.string	"\326\324KA \213*\035H\240i\371\200\301B\301)\203e\350yHb"
+	.string	"09.\322\207\003\274\027\320\027\370\033\266\256#\220\222\201M\302@\b\310\270,9\032\021\275t\343\235\205\371\0161q\231\034\267\237\033m\231R6"
+	.string	"9"
+	.string	"7"
+	.string	"\013b8\203ri\360\024\331%\345\022\331\245=;\303A\006{\t\rH-\330\356\316\270\340\336\325\363\377\340\225\317$\272N8v\327\372\231\020\334\361\266/\2667\354g\002Q\226T\247\025k\2441\033\024iT`_\262\273\353\210\262\317\372%\252VU\177\242q"
+	.string	"\266\241\302\303\256\201\330\207}I\013\016,\266\257\366U_yg\205\036\261\213\272Pa\003'U\207\212\372[\366\250w\230i\264\005x\364\237-HQd\177\302[\016\375\224?v\351?\273\262K\215\225\004\036\360\b\016'2>\004\020\001\325pJ\245.\375Pv\371\332\206\373l\236\314\033Lg\333"
+	.string	"t\034\r\244\315\217\020\017\220\331i\"\234\246\233\234\021M\200\271\341<\023s\361\326\321\270\331m\0337-\340^\262\021\345\016\016\257Q,`\314)8\244@`\270(\275\002\020"
+	.ascii	"2\241!/0\036\250\214@\316(8\215,\215\203\025\250LN\3256\214 "
+	.ascii	"Z/\f\203Q\227\260\232\325hp\227\027\355$\003"
+	.text
+	.section	.gnu.lto_eventLoopRun.29.fef2d5870ec52185,"e",@progbits
+	.string	"(\265/\375`$\005\235#"
+	.string	"\272A`\016I\200\030R:\2710e\375\231\216v\r\343\341\340\btQ\245\366\256\264\364\352\024\222s\365{\364\204'@N\271y;P\322~\037Ukw\177\b\"\n\302'$\f\005\232{\nM\301\223#Cv\030d8\360\277\344\023B\344N2\321"
+	.string	"\306"
+	.string	"\327"
+	.string	"b\353\227Lj\220\2502\361\262\244y\357}\240\036\345\235\337=\311\272\207\375\270\036)C\275A:8!\233\367\022{\216\262\003\365\350\315\275Nz\364\312\357\322\243+\263\332\225[\367\313\260(\2625\367\336^\367\b\360Sy\316\261\256\327\337\350pr8\365\226\242g\333\225os\230\031R\005\177sF,>\351du\302*\034\3079oP4~\374\214\230\343\fbkF93\312\346xT]\035w"
+	.ascii	"\253\352\306\3253\342\215;\371\201!D+{\203P\344R|z\n\035\217"
+	.ascii	"p\265\030\263\212\320\242o\272\372y&\350\262#-\207\352\351$`"
+	.ascii	"\314b\343c\267RTP\266\237\374Y\244\250\f[\303\252\302q{\243p"
+	.ascii	"\357e;\244\252:\347\234\3719\314\274\202\371\324\021[ljgk1S\272"
+	.ascii	"\353\002S>\226Y\236,\033\003\260?\017p6KO\366d"
+	.string	"Q\017m\370f\366\245\260\037\356\232\027\325A\346?y\031\233\361\273\330\210\247\330\017\217\362yJ\203Me\031\217VM\266\355A\031VZ\267\026\2632hO)L0\334Y\314<;or\326\371\362\274{\222\263.g9\207\263\214S-\2537\313\267\323r\232ZFO\313\347i\271Q\313\366\264|\0029i\214\305\035\307\016\243\2744\332\330\\.h\024 o\362'\371\227?\362'\263\022\276\223%g\262\276\t\214_!\021WcY\326\274WYA=\312J\365\273\224\214\317L\302f\274'\345\245\032*6\303\326LP\257\344\217\261\356(\037\311\003\267f\036T\007\211\034m52\300g\013\327\003\304|\035\314\n\246v\004\256\343\277\254\311\333\032\322\316Hc\233\241\266\226\224\247}\254\345\026\256\3603&\365\336' ~\227!\0130\322\243i\243g\322\276\220|\341[\270\214\0044f\f\327\242Ah\353\336\013\304*\236\334"
+	.ascii	"\204v\357\r:\252\323wr\373d*\314xD6\263\n\024\325\255\2658g\311"
+	.ascii	"\204Y\206v\237-\305\314c\317>\331\263xx\323\330u\257\360\303"
+	.ascii	"\017\2520\303\002"
+	.string	"f\020!\354\207\314\023Z\371\225%\021#F\244G\32160\325e<Z\235G\2176\351\331\255\353\202\306\313\230'\313\026\203\315\324\256\3566\223\272\022`\231K\230H?\264\375\261/8\262\026\304\251\203;ejY(\332s>\273\347<-\305\017\n\234;\221\200\327\200w\302wdD\204\202\0074\"za\342\350\350\227\344+\221\364\373q \201\300W\244\324\342\267\224\032\035\210\324\342W\204.\245\\\364\223\364\373\035\001\221|.|=\016C\032@\364\200\276\024JD\300\036\222\021\021\213^\221\322R\357\007\001\377\222|J=\340\357\247\324\323)\357;\013\f\312Z\263\251\235X\306y/\326\204#\377\246\230mC\2731\220\346\332\302\030\037k\257|\231\325K\275\267\351C>\231\247\255\\\314\253\217\325\313~\270z\245+\220U\210\3750\327O^m~\335\265&T\007\205\330\210Q\321\265\026\377A[lM\234\316\3423\317"
+	.string	"\013n\247\371<yZ\327R\273\326\365\325\376\237\367\336\233\363\271\256w\372\314\243WE5B\243\223m\2638\005Vm\\s_\250a\024\346\234B\204\241\021\021\221`J\222\352@\002b\214\301\343\001\020hY\233l\254\00144\003\202Fr!4W\022\375pmV\212Z\262&D\005XQ\207\357\257\"\311\314\374r\252\0061\226\323\2050Z:\026\346uSb\316\"\225om>omA\013N\360\224\2744\356)\236 \\\007\020> \004$z\341\331S\2064*\217\245\351\f\275\216\342\203T\236i&>\335\345\337\r\355b\355\020\211\313kk\214\213\325g Cx\033jI\344\346\fA\330\t\301[M\244\377F\371\263\333#\241\262\026sT\324\365\331\314e\273\340\230B\236\275I\304v\362jr!\200Y\027\035\247\241"
+	.ascii	"7\246\345)\335\002}\270\035\272\030I\267\301`Bn\262!\020p\373"
+	.ascii	"\022\b\006\025\025"
+	.text
+	.section	.gnu.lto_eventLoopStop.30.fef2d5870ec52185,"e",@progbits
+	.string	"(\265/\375`\333"
+	.string	"U\f"
+	.string	"\226\230WB q\223\016\0341JT\253\0012\003\204\031\3609\023)uS\002*\360$\313"
+	.string	"m\246)@\fV[\263\350\230\234 \247\201\024\243~\262\221"
+	.string	"\017\204\b\372\316\315\341/\200zh\264|\323H%{K\231RC"
+	.string	"E"
+	.string	"B"
+	.string	"\207\325\tP\207\326\354\031\357L\366%\030\037V\264\354nT\023\327\37645\377\244c6\256\363W\215\270\276\270\342!\024\200\003\275\001&.,'=I\270O&"
+	.string	"\b\273\353\3348\0217\274\355\b\266\031\330\267\020\nB\"\022'4<\371bw\235\324\022\373ow\327*\2625\235\231>\306\201\251\205\305\200\312n\350\345\306\306\200,P|\364\333?\311\031\377\344(\332G\234\357H\b\f\311G\306i\327\224\340\320\013\252Cw/@\005Zb\017*\365B\351\005(]\234\311\352vA\275;)C\265\013\372v\265?\256\374\226z`D;\2667\\\205[T\273\333\300Oy)\304?qh\016\"\371\355\320\027\241\016\257\312\325H1\3729\324G\017\326\346Rk8@\256KC\266\261:XqB\005\t\024bfy`\035Y\334`\350\370\210\032,$r \360\005ba1\273.,f\272\375[\025=\024\223\215\223G?\346\274\335\022\017N)O@\332\032+\277Y\265s\217\312\n\b\r\017"
+	.ascii	"3\241\267(\260\004\257r\337j!\303\002\320\366\t&.\313\2311h\206"
+	.ascii	"\013.\263\277\272,`\213\270\314Q5I\003S{"
+	.text
+	.section	.gnu.lto_eventLoopStop.part.0.43.fef2d5870ec52185,"e",@progbits
+	.string	"(\265/\375`\256"
+	.string	"\025\013"
+	.string	"\246\223IB \213*\035H\035\034\027\001\300"
+	.string	"\260\003|P[\331\005"
+	.string	"\303"
+	.string	"\035\357\016\031\367\317\004\022\322\243\217\261(\236\222\222\201M\302\020\303"
+	.string	"\304A)"
+	.string	"\032\224r\216\265VE\223h\313\375\255\215\003\355\275wJ\0014"
+	.string	"9"
+	.string	"5"
+	.string	"\237\220\234~\202\355\017\311\236\275\341 j\337\302`\300\305aw\353\251|p\3572N\317?\353\223\257\004\272\204()x\224\370|\340\330]g\013nzg\330\327\b\032\"\030\354\"\210u\330\006\364B\204\257n\177\365\361Y\246\200\237\253<\261\002\334\004\244\203\246\234:u\n\336U\236\357\21049 \312\020\356\276,\247\306\310N\r\236Br\232\005!+\306\244<\331\316\342\305-\177\353\026:\026\250\335\320?\337\365\n\002|\b\247\346t\342\277S\277C\240@\374\347\220\224\004X8\222\240(O\226\363s\245\311\236\225\232f\223\316\\6\333\006\240\323h\003\264\352\001\322\361Q;M\204\303tU3\202\tP3\034\247^*\3366\032W\273m\343*\305v\374\\i\362L\275`aH\212\354\231\273\0166\002\027"
+	.string	"@\033\203\323\242\032,d3A%\312\\\005\210\202a\256p\264&\204.:\251`F\335N:\241\na"
+	.string	"\325\025\235\026\332L\331i"
+	.ascii	"\270\366b\312i9m\245\3251\007\007"
+	.text
+	.section	.gnu.lto_.symbol_nodes.fef2d5870ec52185,"e",@progbits
+	.string	"(\265/\375`\263\001\235\n"
+	.string	"\024\020\257\002"
+	.string	""
+	.string	""
+	.string	"\002\030\177\035\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\270\300\202\202\200\006"
+	.string	""
+	.string	""
+	.string	"\005\026\021\200\204\001"
+	.string	""
+	.string	"\003\005\027\020\002+\177\036\271\204\202\202\200 \031\177\037\377\377\377\377\003\272\200\202\005\025 \005!!\032\177\"\002\033\177#\034\177$\035\177%\346\307\323\036\177&\001%\177'\037"
+	.string	""
+	.string	"\200\200\200\002"
+	.string	""
+	.string	""
+	.string	"\001$\177(&\177)#\177*\"\177+ \177,\037\177-(\177.'\177/)\1770\003"
+	.string	"\rD\003"
+	.string	"\fd\003\003$\003\004\022\003\021\210\245\373\206\001\001\204\001\003\004\020\344\001\003\004\017\370\332\204\371\002\001\204\006\003\004\016\277\343\253\332\001\001\244\n\003\007\016\344\001\003\b\244\001\003\td\003\n\024\354\242\3179\001D\003\n\021\244\356\317\027\001\244\001\003\n\020\376\247\246\001\001\304\006\003\n\023\326\302\374<\001\244\013\004\n\214\372\354\214\002\001\265\n\003\013\025\013\003\210\327\307\202\001\001\242\001"
+	.string	"$ \300\002\261)\363\345\023\370Ll&\017\036\303\033Z\205\320\003y\036\025\203\274\035\006\365"
+	.ascii	"\216\301\021\034\203#8\004\007\200\203\037<[\n\323aE\0022:J\037"
+	.ascii	"\300\255\025\373\306\376\364\f\024\275\261x\207\347\214P\030"
+	.ascii	" \236$(\257\207\214\303*\003"
+	.text
+	.section	.gnu.lto_.refs.fef2d5870ec52185,"e",@progbits
+	.string	"(\265/\375 a\355\001"
+	.string	"\022F\016\022\220\247\351\377\377\377\217\211_\237\232\b\262\273\255\311\224\002\2725K\330$\245\223E8\222\354 \001[\344\260\003R\3013\360\036\347y\315[\266U:z\020\337\304\212\315\327\251\205"
+	.text
+	.section	.gnu.lto_.decls.fef2d5870ec52185,"e",@progbits
+	.string	"(\265/\375`\321#%\240"
+	.string	"\352\001\r9X0\316\244\244\016\376\273\257\272\256\373\373\312\277\234%\"w2\242a\324/\257\237\332\276:>l\177&~\376\033\bXBP#IxuB\177\305\202\241T\312!:\247\343+TF\254\224w\301\332\321\306\017\001\263\276\213!\212\213Iu\257y\034i\2068\243b\tI\2232\245\024 \003r\003\214\003\030\306\217\334\030\270\257\022\356\253\002\367\315\270\255\024\334v\rc\230\342\266R\334a\013\267\255\201{\265L\330\350\223 \234\240\344\344\211[\314-\024\375\023+\277\212\244\360\317w\276p-\221\236\177\333\376\340\376<\334O\207[\r\n\356o\303\217\242e\222H9\361I\303\375Dp\313\375\300\377Xx\346\225\2374A\026"
+	.ascii	"\t\314e\226\277\236\345s\177\322\261\330d\217O\202\200\346\254"
+	.ascii	"\374\244\f^\316J\031\367\f\356\031\256\016(*/\337\355\267\302"
+	.ascii	"77\355ym\301\271\356\272\312b`\032\277`w\305\211\\\035\231\372"
+	.ascii	"\333P\274\016x\001L\264E\013\037/p\377\021\366<\305\251xW#\361"
+	.ascii	"*Y\3067D\210\016\346\337\376!\334\202\334H|\375>8\212\f]\nL\326"
+	.ascii	"(\016\345\307&\367\225\342\nn\227\303\356t\002gS\f\265p\203\363"
+	.ascii	"&1aLS#Kp{\031\356v\267\266\227!Lm)\332\234I\246\221\231\241v"
+	.ascii	"\226\005\206\333W\354\320+\354i\236\202w5\232\253\371\234Hk\226"
+	.ascii	"\306\020\001\n\202\366\267}\006\356\026x\243\371\332a`\257\362"
+	.ascii	"&\354P\277\340\003\200[\360\371\352\026\312\032\355ZM\231NF\246"
+	.ascii	"E4\200P\371\333N\346E\274\313\247\036\326.\346cM\263\346\314"
+	.ascii	"\374\340S\007\353\251\253I'`\345%\227s\276\341\362/\f\226M\013"
+	.ascii	"T\021\"\227\363\332\037\272}\307\324yt\234]m\344\034\245d!\231"
+	.ascii	"\007\204\253.\347\225f\303\206\r0U\314X\230\341\3534%\300=\002"
+	.ascii	"\037\002\234\263B\233\373\333 \340\366.\027\342[\356e\233B\320"
+	.ascii	",\315y\255\340\222b\007]\214\277\335\036\244\335\253\333\203"
+	.ascii	"\007\r\005\230\363V\316\031\203\227\034GvL\177\275\207Ke\230"
+	.ascii	"@\004\353\257\373\360\250w\3258\n\355?\034H\2670\327\034\315"
+	.ascii	"y\225ii\243\362B\372\027\203_\360\335\006\340\366\032\237\214"
+	.ascii	"\327\370z\256\343^\312L\200J\373\333\2766\001\226d\017z\006\367"
+	.ascii	"\017\367\343\231\325/\370\260[\360-\273-\002\272\335\371\n\350"
+	.ascii	"\366\037\335O\323\3755\0334\tz\246\333j\350\376\336'\240\273"
+	.ascii	"\203\220@\300\313\034\2401\350\356\rR\020l\227nK\202\017LU\350"
+	.ascii	"\266\"\034\2210q\241\333\022y\r\335^\202n\327\351\366`\267\227"
+	.ascii	"\030\363\352n\"f\257A\267G\351\376\f\217\341\r\360\005\300\373"
+	.ascii	"\fHt\007\335\226\203n\327z\f\272\035H\367_\360\004\350n2\021"
+	.ascii	"\264\205n{A\367\017\240\373g\272\337\327\355y\335n\245\333\345"
+	.ascii	"\272\375\254\333\311\272]\332\355[\335\376\354v\252n\247\321"
+	.ascii	"\355S\335\036\325\355I\335~\324\355F\335^\324\355C\335\216\242"
+	.ascii	"\333\233\335\016\324\355\310n\317@\267\207\320\355;\335\276\354"
+	.ascii	"vew\017\351v\026t;\t\335~\242\273w\272\033Hw\177\240\333\325"
+	.ascii	"n?v\273\211n?A\267\023\273\335\003\335\336\201n\347@\267o\240"
+	.ascii	"\333/\320\335F\272{\332\335\"t\367Mw\243uwK\226,Y\262t\333\267"
+	.ascii	"\356\236\257\373\002\262\316\031\265\346\n\315o9\273\364';5\310"
+	.ascii	"y\t\352|S\036\271\330RM\305r\210\022\352\353\320\022\n\232\231"
+	.ascii	"j\315\033\320\234o,K\344!\020\311U-O\271Z2j)\013\375\344L\200"
+	.ascii	"\274\346<\224s\322\263Z\3169\231s\3769\227\326\234]\3144\253"
+	.ascii	"\206\206rF\242\031\312K\311\261\237\234_\n'\366lF\241\2407c?"
+	.ascii	"\242U\031hMzU~{r\342h\262+\013Q\301U\317\025S:\256\241\330:'"
+	.ascii	"\253\374w\225\322\272\262\374k}\354\217w\365\324\002\255\321"
+	.ascii	"\2304\267\266\267\277\355"
+	.string	";\001\223\360\233\372V_\033\324[\223\277m\227\3356i\2257i\243l\353\357#\371\005\237\206,7m\363\017\005)I\362_\r\036K\367\343}\336'\201_V\252\250\376~\225_\360%\300-\370\336\356\246\377\356\223\324P6\375E@]{\327\327}\\\315\232\2231A\304\2460\325e\247\223\203\366\311\360\256\247{0\232l\233\250Ma\312\312N1\016\272\227e\256\212\205:-\207V\013\207\202\355\t\225)I\254\240\313\277\375S^\312\277\275P\013%\246\277\300\354\027|\037\345\246_\256-`\271\022$\375+\003\345\343\200yX\313\177\342S\202\005\343.\316\211Ka\3055\301\275\365x\230A\201\374}{%.\265\321*\fdY\303\355\233x\327\277\375\222g{&\337\326d\002ys\036\257f\243U-)\226Tr4\033\276kZ\025\345\273\255\346\027|\300\265\356\026\227$V\222\252\332p\367\316p\367\310p\ny"
+	.string	"=\034W\354\204~\340)\023\332\227\275\031\320r\352\006\315\301\232\222\374\331#\3714\357z\2647\"E\373\".u5iV>;\340h\302\321m\330\260a"
+	.ascii	"\033,\026\034\222+\227\373Gd\\\242\316\212\364\212p\367T\340"
+	.ascii	"\356-q\337,\270\357\035Y\r\314\225\266"
+	.string	"e\026\221\216\373d\027\226\331\230\013\301KG\236\322\304\300~ZF\240\244\177\037\354\377\353\303\372\301~\b\220\271>\330\315Y\351\236!\306=CoJC\351\303w\373\316\341\356\027\342\265L*]\274W\020\230#5\274\253\277/\245qy.\2213\362\267\257\034\356\017\376\346NT@m\035q\264\236\3060g2\023JZ\005\325\323\230\226\234\237\234T\t!\261H\001\364\315O\261\346Bn\351\356I\234\313\255i\311\275h\272\362@\277\343\203@XK\222\353~\023\376\307\333\370\034\177\302\003\371\365\257\036\307\323\370\033\257\365=\236\307G?\353\253\336\307\327x\035/\343\261\276\353\267\236\353\251~\306[=\n\336\365;\234I\177\324\303x\301d'G\327\375>\277\374\035\377\263\201]\305p\n\037/\216\036\351\215\232UH|I\307\361\030z\025*\336\205\022\336\232\263\271\333r\007\235\025\267s5\244\231\314\3641U\365\313g\322"
+	.ascii	"Yc\362'.\305\347\200\240r<AA\342I\\\211\017.\271!\242/\n\362"
+	.ascii	"!\264\005\255\373\025-\336H\304\217\263\345\007\n\205\234\337"
+	.ascii	"u;\335\016\307{\245]\253~?\226MNo\024\223\254\220sT\224\252\234"
+	.ascii	"\327?\372\035\237\364FVy~d\307K\375\224\253!\345\374\304\220"
+	.ascii	"#\306\232\\]\316y\003\315\206\036\333\f;\262\006\334\376)?c\306"
+	.ascii	"\234\301(S\361\367K\270\351\217\361\"\004-\217\352\257\005\252"
+	.ascii	"?\260\260\245\322\"\205\244\033\211\225\263x\300\234\354\221"
+	.ascii	"\211\034\353\355n)+\346\b\213\037)[[\271\266Q~P\353\016\274\277"
+	.ascii	"\326\211\215\263Pf,\341\3710a\373\244\203\177a\347\204\327\026"
+	.ascii	"c\t\r\034M,\234\224\b,\350\b[7\373\326\"\312\206\305\211-\023"
+	.ascii	"\333\346J\241\251\350\337o\016y1\206\250\331\265Ws\252\363Y\242"
+	.ascii	"\344e\214*\314\311\022\253\2447\026\025\304\326\366\322\262\365"
+	.ascii	"E^\nN3\250\212\234o.\200\254\244\331$Z,\244f\254[-cw8\214\376"
+	.ascii	"vKs\332\266lj\317h\240\266\311\224\024]\326=rd&5k{\006s\343\312"
+	.ascii	"\334\326_{\244\006x\304\345\005e\204\314\253\355\020/KF\003M"
+	.ascii	"J\351\240\365\006GW\007\363\342*\311"
+	.ascii	"\215H[\262\236\312<\201\3120\372k\307\276H\226\364\371\327\212"
+	.ascii	"\365\264%\350\313\252\352\257\r\353)>S\372\270\201\001\201\264"
+	.ascii	"\302\300\300\276zuDHd_\315\026\2718\266\034\177\255\220\266V"
+	.ascii	"E@Tb7\210\240|\304\202\360\350\346a\2454\320\344\224\f;r@\025"
+	.ascii	"\251\313\031\251\306'\203\b\311JW[i[\024<x`\201\0201\203p\374"
+	.ascii	"\265?\266\222\262\230\t\270\255\017\033u\302&\304\b\024n\333"
+	.ascii	"\243\327\232\222\226`\246\rzW?f`\177\355\332\323\2632\037i\177"
+	.ascii	"-W\307\001\267\226MHJl\032\324\3322\t\267\215\2668l\330-\337"
+	.ascii	"\\\316\313\016\353\362-7\221j|Dn\254H\264\332n\245\340\204\246"
+	.ascii	"\374\327bY\0350\\xWI:l\016{\243m\356\307fA/pa:\372Jc\201\355"
+	.ascii	"\t\031\364\220V\224\275\370\333s=5\032\323J\362\327^\265\275"
+	.ascii	"A\204\t\306\223\220\225W\233R\325\337\306@\270\177tTT\366\311"
+	.ascii	"\200u\nSV\fW\322\020\272&2dX\03248zijA\362\354\214\2664\376-"
+	.ascii	"\351G\266O1k7P\3440\223\222\262S\037\334\326(q6F\333\251\240"
+	.ascii	"\247\251\025\177m\t\366\311%:\225\"\314\245\2764\"<\273 JJ6\n"
+	.ascii	"'\001`c\265\\[O\226,T\333(`\221\253\026s\177m\223}\372\005EI"
+	.ascii	"\327\236\254S\f\223\253;*\377\204I\266\013\262P\017\273Q4*W\177"
+	.ascii	"-SO[\326\\\214\375\265/\\z\237\224\305\325\375\265K\376\025\363"
+	.ascii	"\304v\007\375\273\205\273mR\227Mz/\333\204*\235DL\221\356\226"
+	.ascii	"\352r>\302\201\213Y\322\n,M\2709\270=\352\262G=\275k~\376P\254"
+	.ascii	"\231\203\376\035a\026,\254\021\316N\243\312\341\262~|\214\036"
+	.ascii	"\254\305\306\025\224\320\337\376\241 \262ED\366\351\313\331W"
+	.ascii	"(\221\323\351\264O\234\244\321\222C\252\001>\313\262\226z\256"
+	.ascii	"\355\263\267\344F\r\257;\334\276"
+	.string	"6\3346\310\n\265\035\352\262C\356\205\327L\364\223\221\221\2345\355K\001w\177\267/+\2359\347\242\336\232\235K`{\317\275\246\033\306\255k\320\3357\333\356\fB\220s\362I]\025|\025\246T\302\220\273\247\2263\363)\371\200\247'\363\351\250\031}\312If\215d\005g~J6\2439W\310Lfr\002\320\\\241\031\315\317\354\263\344\351y}Jf&4W\310\314\254\304\320d>=\233Q\345\263B3\372\364\314\321\247<\223\231J'\nfvV\310\321')9\n}\3164\243\320g3\372\264\344X\232tLO\267:\2500wj2\263\212\241%e\036\026ps\274=\225(\034\341&\230#4\356\310\334\fU\341\360\b\323%8\250\310\242\021\247W4\022U\241\261x<\016\203\301\231\235\235\236b\321X\374\251B\023G\243\216OG-\022\217<:?\235\005\344\350\374vT\234`K\227\340\220\243\"\211\305\236"
+	.string	" \177H\344\020\007G\350\363\260\200\233\021\356\315!\032O\334\021\214\307\022\252\261\370\323\021\016w\356Mpx4\252\310 \016\321\204Q\025\006\2033\305\036\340\360\204\321\304\320\003*\320!\346\0303 \223\223\003\001#1GE^8\036\2079*\322\227C\201\237J,\206"
+	.string	"\323\201\203z\024\362p\3401\252\"\024\215\276\306!\036\207\305!\t\334 Bt\020B\004\t\277\026\361A\207\017:\370Z\304\00777\037\204\270\301\035\342\306\252E\242U\221.\215C\242H,\026{\216?u\210\002\034!\217\357\005\351S\203\300.\301\301\006\251\002\344\006\020!z\354\316\216\221g\350rTy\254\207\017=v\307h\214@\260w\273\004\007\025\247\347\250\"m\220C\036\025\2506H\2258\302\246\247H\242\003\022z\212\304\235\016@\204\b\206\020A\202\3150\247g\007\247H\2649\"{l\030\340!g\210\354)\366\004\261\357\250\362"
+	.string	"s\204\303c\314Q\345\201Q\211\307\021tz\200:=#^`\206H\341\210 O\217LNq\030\034\236\020\"\201\310\343\020\005G\241\211 .\022\205%p\202>cq\270C\324\t\376< I\bwt\202?5\370\313\3311\006_\212&zv\2148\301c\017N\360E\035\"\207;#\204\352\211`\314QX\002\347\352\364\214P\217\306\022\310`\213\032tA\001\216q'\330S\203 B\004[\324!RG\307\030\374\275\250'p\2069F\234 \206\t\016s\210#\004]@\300@\b\024\bn \204 V\221\304\035\030\235\236\021A\344\3608\034\036u\202@58\\\001\021\351\363 G\310\023\f\372\2069F\023\301^\227\320\320F\236\341\321F5\032\2176/\310\340\020\347\330c\024\241B\216\316\037U\016H\200\307h\304"
+	.string	""
+	.string	"\324\240\207\017j\221\330\203\373\346F\002\030@\240\201\n`\034\016<F\343\216Z\034\236\030\332`\340\003!\210`\243\016I\034\205\252M\221(4a\203sD\332p\320"
+	.ascii	"\0058\302\021;;B\034,T\2059\327\204\347\r\222\024\003j\212\211"
+	.ascii	"\213\232p`\305\270IA\314\263\237\022\356\217\006\237dR\312.\221"
+	.ascii	"\326+5.\214\353\3142>cP\254n\024\031\325\320\330\n\250\263\247"
+	.ascii	"Q\202\024&O\217\305[\324Xkr\222\2731\344.k\215Ar\303\"\245\311"
+	.ascii	"\n\206\243\"d\311\224\007\334\352A\307\364\302n\305\374\274\325"
+	.ascii	")Yz\263\026\037\245(R\256\222\225r"
+	.string	"\315\225i\375\275E\267\350&qM\001\243\224\204\321\270F}\223\372\"\225\240\"\211\355\310F\263\352\224\250\264\b\201\222\023\234\\\224\033\304\350\370R\226\375\275,Z\234\204P \362\367\256\350(0C\272b,\265\340\341nv\337\346u:@\nG\007\243,\233\252!\324\327\331\227H\tY2\251\342\016\335\240\236j\200\301D\356\357Ma\301\276\230\252H\375\275(z\372CK\203j\222\222\245o2\313\375\361\271\275\220\215\315\251]\237\276?\031P\005\255\025\375\275\312\313|,X\242\306.\363.\037\n\036\212\271\265\027\245\b\t\215\233[\224\\i{w\305\346\3458b\251H\277d\340\265\315S\202\361d\332\221MiK7\305Z\361\036\231\3507e&\303\256.7\227j\200m:\202\330\260R\304J5\303\252\264\235\033\253s\021\202\361\2502\3418H\363\230B\244hDD4I\222\016\342\n\020\206Ci\036\307\322\003\022"
+	.string	"U5\2142j\204FDDJJ\222\244\322\236\001\030)\214\003E\335\2715\340\225\"V\215D"
+	.string	"\031\027\264J\005\327\345\315\260_5\321\211\263\342\0064\325\216\374\350\031\004{\273\373K\320\2323\246\243]\004\336\274\214\310!\fX\025\376\300\377\301\360\001\222\2023\273\207\345\221\264e\322\245\220\213{8O\213\214%\273z0\021\017\303f!\223\321\320+\227\231\325\213Is@,\020\245\342\021\234\270\263\243\326\215t\247@\360\267yN@2@\251y3\201\351\315\2647y\261~\250\215\306\362\225\346\257\376\331WT\231+\261\202<l\335\330x\261W\b?\205]sbAV\200b\"\200\2461S\213x\246\221g"
+	.string	"\355\302\377\272\361\307\200\315\371\250\340,9\326\375=\240\312W\245\363\360m6\365\367\354\204i\363\266\201\241\013\252~\304\031\345\353\006'\b\274"
+	.ascii	"\215\341\331QAQ\357\245\276a\227Q\271\231\314\376,\341#U\300"
+	.ascii	"\301\306\361\312\020\260\231\246\257H\375\304u\255\233\203\262"
+	.ascii	"F\253\261\025|\r\023\207\330\344\252\204\360\254r\356\263\215"
+	.ascii	"i%#\322}8:\263\304\206\272\324"
+	.string	"\035\204\022}\235\370\376I\260c|\354KI\204&\350\252\b\t\313\316\337\351@\034\250\257\027#\006\341\020!ye\300\005\261\270\214A{\365\331ApB,$>tc\003\346\030\3629\256R\207X\202\022\335\336w\310\274\3550\221\034y\230Hv\025b\\\0011\271\346W\210\006\177\033g\200\234\352\310\260\302Ed\243\242\217\230\235\"\3007-\245FY\037\235"
+	.string	"\204\033\357\215\352\313{J\313\027\323zi!\r\262?\2622\0030\273}\036$\300r\rN+\326\275QKY\250\317\222hr\243\r]\245\214|\275\250\316\023G\346\3205\263\223\320$\003S\274\n \222\2176\362\265!\341\220\344\205\312\333\211\331P#\226"
+	.string	"\264\025\232x"
+	.string	"\256\236"
+	.string	"\306v\377\2602'N\214f]9.\177\300^d\222\262\232\021P\232K\357(\006\314\327\353\370\337\223\020\003!b^\224\254\275\200\365\267\024\305\036(\321\261\202\\\2137\206\324Ag\226\203[\203K7\364\300Q\337\374\212\303\202\310.\333\274\312n\300\225\032\233\007\t\350\275\277+X9\024q\307(<\033S\312\372@hs\f\033"
+	.ascii	"9Q\321\341\2070|\356*\006Q\240W\027Z\327\253\320L\323\f\3440"
+	.ascii	"\33116\250u\013\032\247\2735\tE\264t\022"
+	.string	"\355\2601d\200\353\266\377\311\275\270\226\230\017\264\352\204R\005i\tmf\340T\256X\266\221\342\034p\030\217|&\250\201\246\223\201\276\251\253M\270sYP%.Y\325\340w\317\001\032\311\n\330\272i\022\347Dk-\257\237b\242\241\263\033\202\021\2316Sdq\016\271J\265\323qC0{\263+\2415'I\224\235,\033\222\354\"\177dZ\306l\234ub\324\2513yu\340\021\\\314/\323vi\303p\022:]\370\300\00225\3625\363\322d\321\371\344hG\354\255/\200\302m\371x\"\212=\342\315\354=s\335\326\3377\006{\377\f\221\251\215\331\356\371\rP\266\253G\367\334bd\240H\262\330\254X\003\2135\260\305\306\230\024\036p\366[\375\363\324Z\351\235\n\206\334\334\370n9'r[\312\365\231c\312\001\021\215\300\304DH\205\275\324!c\304\241\256w\005\252P\215\262\324]\360\247\276;6\211\336Q$\222"
+	.ascii	"\037D\362.M\346L\234\326\006H\270\004\036\3115Wt\336\310\263"
+	.ascii	"\367g\374\356\004\261\205\336!3fd\367@r\222\350\201\321\\&\274"
+	.ascii	"0\013'\226\016cL\2678;\017\256\324\307\247>:\355\334Am\013\301"
+	.ascii	"\344sk-<\250>\374_\262\b\346b\347Y\205-Z0\214_\303/\016D\271"
+	.ascii	"K\251+\254=6\206\333N\321y\341^\232\210\272SL\272\371\n\222\374"
+	.ascii	")Ou\302\340\303\232\264\021\333\221\265\214'\335\361\224\341"
+	.ascii	"\252\245.w\316n\r(\f\316\206)\006\224\206\001\017h\214\031\254"
+	.ascii	"A\002\376\242\204\233:\2758j\210D}\f\317\237(\206\334\205\005"
+	.ascii	"\247\352\302\006\026\272\337\0070YsD*!u\231\306X\265\315\371"
+	.ascii	"3\324(E\016\241\312\211\356\tzDi\210\313T\210J\341h)\022\225"
+	.ascii	"\3202?W\200vx\301j\334\035DT%!\203\374\230..\274\370M\274\222"
+	.ascii	"\260A\312\034\2406\267\205\355\363H\244c3q+\307\217\007\347\312"
+	.ascii	"@\355\215\025\271\021\275\257\250\213\350\325\332\312\374\273"
+	.ascii	"O\"<h\252Z\372\002D\344\t\270\tA%(\230d\b\031\225\300\321\274"
+	.ascii	"\276\251\033\345^\364\324\377\231\310\003\020H\213\370\363w\300"
+	.ascii	"\234p\350\006\242Rf.\271\222\205w>\b\t\n\270 \005\003h\003u\005"
+	.ascii	"\\A\354\215\307\350\335a1\306p\311of\317\327\202\335\375\342"
+	.ascii	"\227\300H\234\261\215\223\247`\344'\266{\371\360\254\342\246"
+	.ascii	"g<\"\273\354\006Nd\237\276\301\234S\340\260\"_\b{L\347\370\376"
+	.ascii	"\305\210I\362'\351\274r5B\314\345\373=\343OLr\317\232>\023\354"
+	.ascii	"\335\305\341g\232\223.<\374\333\333\233\311o\340D\312\305\314"
+	.ascii	".\360\365\276\267\231\255S~\274=\206\327P\321\211\365\275\001"
+	.ascii	"~\277\247\374\311kl\376\272\270zN.\370%\177a\230\202|b\363\231"
+	.ascii	"y\002~|\331q\016\360[\301\031\376\255\032wlf\212g\372\036E\326"
+	.ascii	"\320_\336'\347\250hWy%\342&\3375o\271I+"
+	.text
+	.section	.gnu.lto_.symtab.fef2d5870ec52185,"e",@progbits
+	.string	"eventLoopInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\001"
+	.string	""
+	.string	"eventLoopAdd"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\001"
+	.string	""
+	.string	"eventLoopModify"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\001"
+	.string	""
+	.string	"eventLoopRemove"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\001"
+	.string	""
+	.string	"eventLoopRun"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\001"
+	.string	""
+	.string	"eventLoopStop"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\001"
+	.string	""
+	.string	"stderr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\001"
+	.string	""
+	.string	"read"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\001"
+	.string	""
+	.string	"epoll_ctl"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\001"
+	.string	""
+	.string	"eventfd"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\001"
+	.string	""
+	.string	"__errno_location"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\001"
+	.string	""
+	.string	"epoll_create1"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\001"
+	.string	""
+	.string	"epoll_wait"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\002"
+	.string	""
+	.string	"write"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.fef2d5870ec52185,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,559 @@
+	.file	"controlrate_profile.c"
+	.section	.gnu.lto_.profile.32a2acf3e455dc8d,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.32a2acf3e455dc8d,"e",@progbits
+	.string	"(\265/\375 `\235\002"
+	.string	"T\004T"
+	.string	"\n"
+	.string	"\206\214\261\346\016"
+	.string	"\001\265\376\273(\002\363\341\340\230\f"
+	.string	"\003\240\342\234\212\n\004\235\205\271\212\n\004\002"
+	.string	"\002\001\002\002\002\002\006\007\200\242\234\020\006\b\273\305\341\276\004"
+	.string	"\t\315\326\216h\n\240\342\234\212\n"
+	.string	"\004"
+	.ascii	";\023\334lE8E\331@\033"
+	.text
+	.section	.gnu.lto_.ipa_sra.32a2acf3e455dc8d,"e",@progbits
+	.string	"(\265/\375 ]\325\001"
+	.string	"D\002Q"
+	.string	"\005"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001\001\003\001"
+	.string	""
+	.string	"\001\002\002\001\001\004"
+	.string	"\001\007\001"
+	.string	"\001\b\002\001\002\001\001"
+	.string	""
+	.string	"\001"
+	.string	"\b"
+	.ascii	"6\303\250\212\364\313% #\317\r)V\333,h\003X"
+	.text
+	.section	.gnu.lto_.inline.32a2acf3e455dc8d,"e",@progbits
+	.string	"(\265/\375`O"
+	.string	"\205\005"
+	.string	"\362\311\035$\2207\351\177\365;~\306n=p\273\273\022\035\224\025y\257\270\215\335\317\306\363\356\356\024l,Rkd\023\271S\377P?TWs417|Pv\367QA*\347\366\317\334\243`\352\r\331\035\024\254\341~R\023\231\tx\201\260\177\021\033\037\221\231\323\367\177\365\256\037aE2s\271\177\377P\353\317\301\377^\250\231\231\312Kk\"a(\230\376\025\326\242r4\232g_ \027"
+	.string	"\251\020S\210\001\002i\325d\314u\2002\200\005\346\272\231\250O\205k\ty\223\b\254\004D\260K\r\002W\205\327u\005\214\246\","
+	.ascii	"\354\n\301\263\2412N\001\334"
+	.text
+	.section	.gnu.lto_.jmpfuncs.32a2acf3e455dc8d,"e",@progbits
+	.string	"(\265/\375 \260\335\002"
+	.string	"\262\204\016\027\300\245\320\001?X\275\351\037\374\364\365\377\203^,\246\221M\366\226)\005Z?"
+	.string	"\207\320\231\360d%\253\300o\026\305\026h\265Ao\320V@\023\255\315\341s\2544\254\344\035\034\004\f"
+	.string	"BH"
+	.ascii	"\366\240\260!\326\345\241e\254b\2029@\201%\205b\227O\021\222"
+	.ascii	"Y\360\006\332"
+	.text
+	.section	.gnu.lto_.pureconst.32a2acf3e455dc8d,"e",@progbits
+	.string	"(\265/\375 \024\241"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	"\230\004\002\230\004\004\230\004\007\230\004\b\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.32a2acf3e455dc8d,"e",@progbits
+	.string	"(\265/\375 sM\002"
+	.string	"\324\002_"
+	.string	""
+	.string	""
+	.string	"\b"
+	.string	"\005"
+	.string	"\001\274\006"
+	.string	"\260\204\200\370\267\004\002\002\004\001\002\b\001\005"
+	.string	"\001\002\005\001"
+	.string	""
+	.string	""
+	.string	"\007\002\b\0071cO313"
+	.string	"\013"
+	.ascii	"\270\001\020\256\347\306O{s.J1\222i\257f\0164\013\007\243\f\240"
+	.ascii	"\b"
+	.text
+	.section	.gnu.lto_.lto.32a2acf3e455dc8d,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_controlRateProfiles_Registry.30.32a2acf3e455dc8d,"e",@progbits
+	.string	"(\265/\375 \252\335\004"
+	.string	"\244\bl"
+	.string	""
+	.string	""
+	.string	"2"
+	.string	"\005\001\212\001\202\200\200\374\342\203\254\250\023\001\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\314\030us\326\007uq"
+	.string	"\005\001\006'\001\314\035\001\006\214\300"
+	.string	"?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"$./src/main/fc/controlrate_profile.c"
+	.string	"\005"
+	.ascii	"0e(\025<\314\242S\024y\003(\002"
+	.text
+	.section	.gnu.lto_pgResetFn_controlRateProfiles.31.32a2acf3e455dc8d,"e",@progbits
+	.string	"(\265/\375`\205\001\375\017"
+	.string	"\266\237nF\360\260(\035\272,\\\356u\313lC\025V\362@\220\210\261\216\373\227\\\236\235\260\245\365#\326\022T\376\025\303\325/\342\374\373\322\017;\353\332O\306a\3620\356\344@\025\023\314:\270;h\332\\\265\251\366\223\275\345N)Y"
+	.string	"W"
+	.string	"\\"
+	.string	"\237\006/\332>?\037\260}ze\327 `\022\300\346\004\006\307\356r:\302\333%x\313\270\372\224\032W\276\313\343\027\023\326h>\326\247\004\245\274x\021\360\231\310\0064b.\237=\242|\255(YT\256\237]\024k\325h>\225G\217\203\335u|})\367v\333$\266#\330\227\0053\0378l\260\302l\320e\277\347\341-\037\255\032\0355\372"
+	.ascii	"\264"
+	.string	"\303\211\214H\306\256\207\035\035;c\3020\021\343C\3730\007\375\231C\237\366\313Y\254\036\232&\267EH\313M\316\356~|\032\302\347\323\200|\310\366\243\375\226\257X]\226\341\036\2730\235\232]p\201\031|\002O@\253\271B|\342c\376\230\273H\025\270Ab\327\365\227?s\032\013\362%>\215!\265\375\365\351\247\266OU\233\344B\374\313&\232\b\227\262\034\325\243\252\n\202\346Jq\340\216\261]\243\336u\242\025w,\365z\230K\0247\261\260&\263\243$\356\250\252\300\261\221Cu\305\006YQa\001\247S8\231P\335\203\222j$\301\303$\220\222\310\311\324y#\023J\252\221'\322y*TG\342H&\016u\032U\340H^\212\003A\340n\244\344q\252\256\363\270\020\270W\230\357\362\020\226\032\235\234\022mM]\261\307FA\2528\361\343RQl\3236\251\227\2058\032b\216\313\335]i\005\227\n\322\317\002\032"
+	.string	"\2423\341L\213\201\032\3224xL[v\277,\201\025\022\263z8\301\342f\332\203i\223k\206\020\342\260\025\005\212\313Ah?Uk"
+	.string	"\021\253\3566\253V"
+	.ascii	"aqCD\331KW\215\007\024\021\3235\237"
+	.text
+	.section	.gnu.lto_loadControlRateProfile.32.32a2acf3e455dc8d,"e",@progbits
+	.string	"(\265/\375`\305"
+	.string	"\r\013"
+	.string	"\006TJA0\247*\035\005\217\377-\267o.\221j\340\307\265\275\267\367\310\221w\0359m\303\244\324\241\322+\022\227\177\270~\260\266d`\261\356\030B\200I\007:b\306`\312\202\241\030d\240\022\030\214l\262wJ\0012"
+	.string	"5"
+	.string	"="
+	.string	"\236\234b\335\253\035\262\273\327w\026\331\n^\246\366,S\311\345`w=\032r\321\247\310\377\352\223\361\264\361\2310\261\273\236\343\251\343\246\267\315`\273\302\276D\356|\346\307W\377\303\275\236>|\304\036\220\243Y\263K\322\244 \366\267\245({\233\336\350\364\234\323\3478\022\332\302k\327T\203\260\263\212@\304\366}\001'C\017\020\253;0\210\261\022\300\032\220\177\201\352\201\324\250\361\002`]\220\332\335\210\326]\027\027\f\206{\335\350\311\327\021ZK\006"
+	.string	"\346q:\351&+E\260\346\004B\205]\016\b\277\374\200\f_\365\032\306\370(`\346b\tE\216\005\350\251\210\231P\364l\302\317\373,\336\346R\321x\237\330\361(\r\0169\240\350y\302P\364\272r\364m)\312\024%\263\021%y\243\276\201\303@\276\312\225\357\013\025"
+	.ascii	"\020)\2022\253\t\274\030n5\370M\330:K\210\tl\334\232\to3\020"
+	.ascii	"\0308\021rye<\244j\320\205<\004c%(\333NY\276\264\013\316\271"
+	.ascii	"\2050\237"
+	.text
+	.section	.gnu.lto_changeControlRateProfile.33.32a2acf3e455dc8d,"e",@progbits
+	.string	"(\265/\375`\264\001\r\020"
+	.string	"\206\035jG\360\260(\035\362\031\363\332\221\373g\025u\311\262\262\n\306dY\303U\2671\267\341\357\3217O\032\024\330\373\255\325\323\212s\255D\306\316tc\314\364y\030\302\231\026\267\2601(\030\b\310o\252;j\350Om#\233l\231RP"
+	.string	"S"
+	.string	"Z"
+	.string	"\241\317\207l\253\332\013\032\254\036SY\356\222\260\341\354\312\024\230\001\350\323+\373\306e0\373\221eeE\216\335\365d\211\257\316I]\371\037\221\017\021\306:\027\3422"
+	.ascii	"\354\305\035\330\335\317\\;\300\\\252\037\221\335\265\2120\020"
+	.ascii	"\367\274\355\b\266A\373;\001\023@\213\215\207\245\245=\272\273"
+	.ascii	",)_\346U\235J\002\036v\2144^\252\303\226\271T\276\330\347V\272"
+	.ascii	"\330\235\032\244\352\317Ts\217\375\n\322\311\250Q@g\367C\017"
+	.ascii	"\217\275\315\034\023\266\357\247\370\250r\025\376\200\325.\373"
+	.ascii	"\314N9\215)\300@\261\273)\266\212\035\363\263'\300Q\033m\320"
+	.ascii	"v\306\343\240\246\355\342\351\266\321\324yps\027\244\217\204"
+	.ascii	"\244\373\004\311\217\267\020\033a#s\202&\202\223\037\311\335"
+	.ascii	"\254\364\370\314%oQ\002\355\276h\234\374\354\234LK\215\207\246"
+	.ascii	"\245=\234J\273\3446*\0030\273\353\300\2579\213\023?\346\323 "
+	.ascii	"\212^D\351\036\336\300\341\323`\2220\341K\215*\f0)\3443)\215"
+	.ascii	"\200\341I\364\245F\241\t\030\246L \311#\215x\246\322\350\304"
+	.ascii	"#\205(/\004\201\301\323\027z)\020\f\275\220\254un\245\213!\314"
+	.ascii	"\270\265\244\313\002\324\276\200A/\3723\007\251\211qsI\226A\322"
+	.ascii	"\317\371\013\224\037\343\f\"\275(\352\036$ P\202a\314\314\003"
+	.ascii	"\200\211\316`-\312\2042\323\331\0306\263\262\322\324u\227\311"
+	.ascii	"\2131\262e`\257u\221c\234\320\\\317x\254\271[VX\252(x\027\"\356"
+	.ascii	"\320H\343\343pk\301\302h4\246\203\333\246\261P\255D\r\337\356"
+	.ascii	"\224\243\362s\200\355\035\227\302\032\333\025\312"
+	.text
+	.section	.gnu.lto_copyControlRateProfile.34.32a2acf3e455dc8d,"e",@progbits
+	.string	"(\265/\375`0\001=\r"
+	.string	"\206\030XB"
+	.string	"\2216\035[X\222[\317w\256\276g\r\342\333\030\320#\326\243\356\005M;b\003\275"
+	.string	"9\260\255y\007G\212&\004\217\005\215-)\273k\326:\305(\3752\230r\\w\006\211YA\262\330\233l)S\nD"
+	.string	"A"
+	.string	"C"
+	.string	"v\214\223H\354ULt+d\354\256\245#\376\371\0045?>\225\301\210<\320\247\215\017\207\260\203\245\324\025\030\211p\251\274\221T"
+	.string	"\036\t\354\330\335\247<5x\\&\225\331]\247\310\363p\307\333\216`\233\202\375M>\\\035\331\231\306\034\345\247~\362\307LCM\253\246S\323\257 \n\026\004Vv9|4\2664\2718a\373\225\215\342y\200\345ZJ8\310\264\021(\370\374\304c\335\r\301\322bW\305\001'\330\370\344O\n2\245P\251\250\030uv5B\371\371\245\303\367\002R\032u\300\206\226\334]\220\252\211\355\fQu\202\n\214\221\234\341\324\253\352\264\322\2018\351\224\246\nx\231\356\211Q\257/)\371\272\024\\~6\211K5q\227\326\341\300\200m8\r\036`\233\006\302\202\255\263\341\360\345\201\205\200|d\232\210\004l\323h!\231\266q\262\313\272>,\016\210\246\202ui\035\313\303\2003\021L\263\266,\323\254\212\024:\\\035\231\201K)\244\334\024\023\332\302\205\274\310Oy\206$\034"
+	.ascii	">\353\341\211\265\365\0348\023\272\223bT\030*\365{\271\320CP"
+	.ascii	"\213\275\210\007\267\200\264\240\r@!>\302\004\223\031\316\232"
+	.ascii	"\203\271\206\033\314\002,\302\030\2400\030\246\317\300\301]\002"
+	.ascii	"\006\254jd\315\220\333U\364"
+	.text
+	.section	.gnu.lto__reset_template_45.0.36.32a2acf3e455dc8d,"e",@progbits
+	.string	"(\265/\375 \250\235\004"
+	.string	"\"\b\037*pe\322\030\200\323\363\r\300Q\326\b\206\252\252X\264\220\003\020\b\004\002\201\n\300U\025p\257\237By\361l\177\003\246T{'\031\226e=U}UU=U\247w\026{\030\203\032\207\034\317\307\"\310\243\310$\311\245\311\033\345YyZ6]0\007\\\031F!\216p\020\220o\306\355\024l\252"
+	.string	"G\355\317\232b-\2419\\\031F\275n\003|\t\247%|?\302w\343\234|\265\240\252\234\b"
+	.string	" D\352,\tva6\004\302\236\272,\241l\031"
+	.ascii	"\034"
+	.text
+	.section	.gnu.lto_copyControlRateProfile.part.0.41.32a2acf3e455dc8d,"e",@progbits
+	.string	"(\265/\375`h\002\025\022"
+	.string	"\026\241uH\320\362&\035\243\336C\002b\365C\214\025\021\003\240U\031+c\262\002\232\273qQ\240\271\02004\300\310\361m\3104\366>F\322\264p\b]!{\343\001&\313\341\036\244\306.y\264\206l\263\224#j_\362\206\310&r\247\024["
+	.string	"d"
+	.string	"b"
+	.string	"\002v\266#\005\212\312\007\231\304\004v \231\217{\203c\2256\211I\354@2\326\335\022K4v\207\030|\272D\365i\337\3076\f\3071\333\307\307\332\336\246\242\206\bjw\275O=\361\330Ur1\377\266\207\320rdW"
+	.ascii	"9\036.\t\234\0039\331]\253>\334\363\266Mlw\260\245N\252\322\362"
+	.ascii	"B\377C\006x$vo\246~\354\316LZ\201\344\202\261\213\307\233\001"
+	.ascii	"\363\353dfC\303\035\351<\375@\255\206q\201m_\306\217b\374R\033"
+	.ascii	"\232\031\023%6\0165-\240vG\357\323\343\017t\237\252\027\350|"
+	.ascii	"\337\3507\230\017\331@\r\306'zQ\314\207\\\"cz\261\2731\322\267"
+	.ascii	"\301\354\325Jh\034e\036\256\211T\273\331\342\225Z\323\251\206"
+	.ascii	"\243\323\337>\341\207\323\251\267]\201\214i\326\003\206T\321"
+	.ascii	"o\270\024\251\211\226\3416Z\352\324\264\273\rj<\351\202\217\342"
+	.ascii	"\323-\240<\r\354>U_t\224 \021F>!b\200\270J\355X\214P\252\221"
+	.ascii	"\232\221SR{\254\334\271\335]+\217\r\"\335\251\364|\320\317u\322"
+	.ascii	"\001\266\300\n_\"\030>\025\027\b\021>1E\202\003\361\245\"b\326"
+	.ascii	"\310\307\322Z\001\303\027\n\237\230\022\262\200\241\350\002\262"
+	.ascii	"<\326\212\347\322Ji\361X\341\313\033I`\360\345\013=\021\004C"
+	.ascii	"oe[\236[\345\361\203(\0353:\263\252\366\330\016 \021\334K\235"
+	.ascii	"j\247\366WA\236\346\333\256\342\341b'\352i\203\312\374\333s\004"
+	.ascii	"0 \300\002\231$\316\001\274H\340\324\303`\335\315\003=$0\035"
+	.ascii	"\216\341\217b\364m\354\252\334\272\207jib\007R\334\032\3033\030"
+	.ascii	"\265\203\001\006\341'\352\303\306c\023Dv\321\241\200Z\213/.r"
+	.ascii	"\036\034j\006h\013\335;-0\337\033\233\221\230\340I\252A\273["
+	.ascii	"6E\223P\215\325,\274\225\267\331\002\250\275p9\245\323\257\245"
+	.ascii	"c"
+	.text
+	.section	.gnu.lto_.symbol_nodes.32a2acf3e455dc8d,"e",@progbits
+	.string	"(\265/\375`\""
+	.string	"\005\006"
+	.string	"D\t\036\001"
+	.string	""
+	.string	""
+	.string	"\002\037\177\t\210\214\225\311"
+	.string	"\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\300\202\002"
+	.string	""
+	.string	""
+	.string	"\005$\006\200\204\001"
+	.string	""
+	.string	"\003\002)\177\n\200\200\200\200\004\271\204\202\202\200 "
+	.string	""
+	.string	""
+	.string	"\005\033\013\201"
+	.string	"\002 \177\f\272\200%\r\032\016!\177\017\002\"\177\020\036\021\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\034\022\001#\177\023\377\037"
+	.string	""
+	.string	"\200\200\200\001&\177\024\003"
+	.string	"\013\372\363\352\266\003\001\204\001\003\002\013\244\001\003\007\344\001\003\b\002\344\377\220\375"
+	.string	"\001\202\006"
+	.string	"\020"
+	.ascii	"D\313D\036\006\345S\004\370LAF0<\277y\f\031\202\260f8\b\240\003"
+	.ascii	"8\274T\340#\f\030\234fT\370'\204*\003"
+	.text
+	.section	.gnu.lto_.refs.32a2acf3e455dc8d,"e",@progbits
+	.string	"(\265/\375 =\351\001"
+	.string	"9"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\002\001\004"
+	.string	"\002\002\002\003\002"
+	.string	"\002\003\004"
+	.string	"\003\004"
+	.string	"\005\001"
+	.string	"\002\003\003"
+	.string	"\001\006\004"
+	.string	"\004\007\001\005\002"
+	.string	""
+	.string	"\005\003"
+	.string	"\002\003\005"
+	.string	"\001\006\006"
+	.string	"\003\t\002\003\002\n\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.32a2acf3e455dc8d,"e",@progbits
+	.string	"(\265/\375`\206\030\225v"
+	.string	"\252\306\264+S0\320:J\007\f\301cs\201\320\263\306\217\317\246!GQh\350\301\345\330gn\"\003\374Z\305\306\264\320Q-\363D_\304Z( \317\263\252\317}\204\230\255C"
+	.string	"\005"
+	.ascii	"\245z\035@\251>\260\243\006\214\274D\350\2159D\336\033\315-\345"
+	.ascii	"P\267\246\t\2212\005R\002\254\002\277"
+	.string	"\002]\366<\261\354\231<\224\3739e\177:\331w\323\236\343\366p\022\250\355\311\016N\032e8\316\303a\t\260\2363\036Fs\037\246\345]v\226\036\262\260F\337o\3549\201\334\031\027\307\t\344\030\317\356\274\003\0302:\3624\3329\330\267\r\366G\013\017\265\361\232\215;\213\343j\364\r\250\211\363\245\314\333\033\206\303qX\016\317a7l\207\353p\223\351\260\032\2471\033\207\361\032\2579\263\3416\347\345\371,\007:fp\250\203vF\r\rsN\031\227\035\310\266\300m\325\240%O\003Y\364\354\322\360\230\210\363^#r\266b\374|\345g \006\2571\r<\306L)\b\254\354i\336\273<w\371wk\f\206o8\321t/S\021\002\256\362\004\251\362v\357e\301\202\210\005\333q\323D\346\004\312H\036\312\215\350*\373~\262g8{n\332 \246%\332bS|\331\025I\354\371\206\237\275\360\027&c\302\275\306{o"
+	.string	"\271\243Q\331\325(\333\300c\316dX\314e20\222\36721\031\240<\3672\0011\253`V\201Z\261\202\262%\207\236\223\226\303\354\316f$rH\251\345\005:\323\240\302\bi\324\207\221\366\005\017\345rL\"7\203w\330\247\241`\3374\301\376\215\207r\357\300\362\222\261p\030\n\026;\0031~\026\301\356\327\275K\240\020{\252\354\201k\364\031\3303\330\013P\336\0307a\317(r\034\307(ro\0334\303\317^\374\205\342<\366H^-\367.\205\200\226C\236\256\032\375\222\207r\226I\344\f`.\240\277\001\370y\350g\242\237Q\374<\342g\001~.\361\363"
+	.ascii	"?\233\370\231\200\237\003\370\231\304\317\005\344\376\357\371"
+	.ascii	"Y\350\277\320\337\276\237\037\310\372\271\311u\177_\240\344D"
+	.ascii	"O\261\212\237)\370\233$\"\374?\361\363\025\217\237\223?\277("
+	.ascii	"\362\237\204\377\374]\302\317*\374\314\302\317+\374\274\364\263"
+	.ascii	"\322\317)\374\214\343\347\026\210\374l\343g\365g\242\324\377"
+	.ascii	"\240\277\343~\216\372Y\310\317\305\237]\370\031\202\237i\374"
+	.ascii	"\314\301\317\032\374\214\301\317\025\374\034\301\317.~\206\361"
+	.ascii	"3\003?\357~6\340\277\330\317\b\374|\300\177\266\377_\377\207"
+	.ascii	"\376\237\375\267qqqq\177+\360\243r\376\021\274XZ\211~\305\340"
+	.ascii	"%J\243 \230K\016\310\224\236aJ\177\345\356\345e\362\007\362J"
+	.ascii	"!WP\241\322_\266H$\205\351\245\007\2251\257\367\027\312\006\356"
+	.ascii	"\205/\215v\225\266\342AN\23533\031\254t\230\363\245Q8{\0374\333"
+	.ascii	"]\350\026\032T\017/\366\357(\\9\260+8Z\215\236\253p+yC\351\255"
+	.ascii	"\346\232`\307\321\247\013\255y\2210\264@\26246\2411\222l\364"
+	.ascii	">^\366\275\244\231\274\233\274Ik\331\345\375\301e\31189\274]"
+	.ascii	")\251\025\037v\0209\243\347\311[\353t@\334\023>N_\\\2424z\267"
+	.ascii	"v\342\263\306\204\007\322I\026S=q\322\201\344C\016#\233\233F"
+	.ascii	"\303\032\253\237\256dA\341z\263\177\377\271\313\204\274\367\002"
+	.ascii	"\361Y^d\023\210\263\017\363\212?\004\237\350=\177\023\302\345"
+	.ascii	"-z\371j\263Q\2760M=\305\275\017\363^\243\2628\201\022\312\250"
+	.ascii	"\214:\212)o\321\250U\024B^e\361(v\257\3205\032\213\027$\257\320"
+	.ascii	"Q\354B\335\034j\240\370.\225\305kL^\241k\274L)\216F%\324Q\214"
+	.ascii	"\tJ\350(\246\204\272b\312\033t\215L\310\035\306\213\024\272b"
+	.ascii	"\312\265+\226\204\n:\212%\241\216bJ\"\f\345\370\006\t\325\345"
+	.ascii	"\313\252\bs\035\215\327\307\023\025\0232\210y\\&o\332\275\254"
+	.ascii	"E\307E\032p/U\022\231\306\024\305`\232\230>\232\2700%yy\3575"
+	.ascii	"\361\324d\225\274F\346\261+yoW\023\322}\202Q\\2o\023f\026\257"
+	.ascii	"\250n\017\035\367\n\360to\221/\363\336[\274\367\352\220T\313"
+	.ascii	"{\213\004\035\267\236\236\356\225\"z\272T\3050:\356m-q\300@\035"
+	.ascii	"\305\254\222\2730Y\304\266\256\323\262\310[7M\211\264bE,\267"
+	.ascii	"\007\233\335\202\nb\347\312\362\013\304\217\037Y\311+\253V\313"
+	.ascii	"\322%\246\255Z\351\241\255+\353G\243H\210<xi\215\2355z\024\313"
+	.ascii	"\276\201\036h;\332\211Im+\306\205k!=\244\211\264\221\016\322"
+	.ascii	"S\035\325T]\244\217\264T\303\320I\016\353\252~z\373\350\037o"
+	.ascii	"7\035u\310\272\252\231x\0173\231L\360\205\247\331U}l'+t\272\212"
+	.ascii	"\3378\216\231L\320\257<M4/t\223\361\213\357\350i\272uU#\033\b"
+	.ascii	"3\245\320\256=\315{/\217\006\272\252\213\367\254\223TSD\206{"
+	.ascii	"\227,B\254Q\261qr\002}\003\371Y\007vc2 \260\204\004A\323({\355"
+	.ascii	"\336P@k\276\270i\341\261m@\033\373\023\315\376\264\301\376$\263"
+	.ascii	"?\261\330\237V\332\351\357\034\214\306c*\024\"Y\032\375\031Q"
+	.ascii	"Z\306\240B\302x\241QI\376D\002dg\b\222\251FO#\347\021*[[\340"
+	.ascii	"\204]\215N\2249fW\032=\251\316\2523\331\"\023S\347M\344[\327"
+	.ascii	"[\234\251S\210\017/8%E\300tS\244\254\230!\242\205N\271C\305\326"
+	.ascii	"h\324\037\325c\f\266\2265d\205\335a\006'L\243\377\001b\337\364"
+	.ascii	"\323\351l:\205\234k@\334\"\330\375\241+\253\262D\207\267{\224"
+	.ascii	"Z!\202G\035e\222\323\307O!?a` \306\325\202J\262di\364\frn\302"
+	.ascii	"\226\345\bu\002\341\232\303e\017\233=\221\013T\355\200$\317\017"
+	.ascii	"&j\236Hi\264\317\247\253\365\223\231\224\252F\317\036\257\023"
+	.ascii	"\202\013\026&T'\217\363\214\325\232\246F\317\343\271\203\303"
+	.ascii	"~v\276p\021fNdgs\354]\340\237\345\316\034?u\374??fF\222(\331"
+	.ascii	"\030\377\037\335\0267S[h"
+	.string	"\354m\031\373\237\305\263\330`\033\004\335\233\344\b\230\234WV\017+\366\313\033\215\303\372K\307\235G\251\033D\002\036\227\252\305\017\330\024\226S\243{tLo\334\230yb\317_iz\315\234&\0339i\035g\n\232\346\256M\253\371\212\323\314;=\247\333\230)\025t\215^\336vw\372M\032\236\326\323yz\207\326\241\337\032\216\303\372N\313y\237i4':\273\323n\3404\201\332\274j\210\nB\323\\\355D\323q\203+t\232l\355\306a\335v\242\345\335\265\265Z\333a\246T\2275\245\2357\023,B\330a\2236\225\263\263&\202\313r\t[\243\335\324IE\235\345x\242\303a]\307\272\311\020\006\256\321\273]\355\303\rXV\366\005{k\264\327\335\261\r\307\266iV\235Y\263\327\251\331\353\334\330\353\322\330\353\314\330\353lX\323j|\304ph;\243\206\307z\rZ\217&06\305\222\207r+\314\364Y\347\360\377"
+	.ascii	"Y\001\243\244L\213}\343\320\001\026\232\262FQ\376\230\\\337\360"
+	.ascii	".\363\377\364\031\224\255\2470\373\036\323d\376\037\021iZdX\032"
+	.ascii	"\275\316\253,\256\215H\243-\306\352\320=I\300C\225\227#S\215"
+	.ascii	"\276\305\374m\306e8\342\364\334i4\004\223\3105\230\335;\314\207"
+	.ascii	"3d\23244\nB\207,+\353.\366FY\206@\202\305Isyw\3612[F\361\330"
+	.ascii	"\035\262\260&k+\242\345\005\362\201\214"
+	.string	"Y\246En\210\2273p\320j8\207u\r-\205\301n\361\303\232\035A\232o\367J\265\340%Z\234L!\023\023\3531[$\342j6\323m\206\252\273\275\307\324timi\364\271\030h\340\260\246\241\301~\216\367B\265\220s\221R-tR\226\224\311j\264\301\376^v\304\024\370\273!Tk"
+	.ascii	"\205\302\nx>\253\022\r\001\216\344\302\247\026\371n\034\005\177"
+	.ascii	"Db\352\023\2525| \254\277\340/(\370SWbQj\244\004\364\005\177"
+	.ascii	"E*Q\251\250\004\020\250\024\f\n\203\272\225\227KA\030\324\335"
+	.ascii	"\350\245@ti\350KJ\223rKC\241\005\303\242\243!\t_P\351C\360F\373"
+	.ascii	"\020y V^\360h\350\023<\032\236H\353Q0\005\346R\034?\"J$\246\252"
+	.ascii	"\221QO\2674\024\372Pu\035\236Fi\360\350\007\354\351\214R\242"
+	.ascii	"\022\352K\211\272\253\274\243\241\213\020K\352J\374\035\245 "
+	.ascii	"\234H\217\202=$\037\321\032LUU\311g\202\204QO\b,\261\324SU\n"
+	.ascii	"B\340\025P\342\205\213U\355\r]X\2604\024\372P\254#\356#\362\202"
+	.ascii	"\031\200p4Dq\337OM\203\351\221=\f\031\013\310\230\241\202\356"
+	.ascii	"3\034x\341\300\213\334g8\260\3339 cg/cw\276p\021\003\006p\230"
+	.ascii	"\224\256\2745%\246*\017\200\365H\b\244I\275\016H\3140\372\321"
+	.ascii	"P\221V\335\f\025i\265D\242O\325\t\207*`\340SsD\237\0138\250\241"
+	.ascii	"\"\211\020\\2\372Y\203?\341\360\204^\252\332\340\365\206\253"
+	.ascii	"\210t\270\264\222X\203\251OM\207<\340\272\nU\244\265\304\312"
+	.ascii	"\223\261\263\353/\351\007\344yH\215\2044z\303Uw$\027\003\\8L"
+	.ascii	"\325\242U(T\213>\020y\026$\245+q\211(B\205\324(\310\201\321o"
+	.ascii	"\b\204\302o\365\365\204R#a\022\357H\311Fj\344\201\350\373\255"
+	.ascii	"\304\337\332[\211\274\023\210\275\025\b\311\267\376R\b\201(\254"
+	.ascii	"!\243\306\320\t>!\320\247\246(\byJC_\2104\351'B\352\353\251\032"
+	.ascii	"\004=P\323\024\204\303\022j\017\311\207\252\351\357\306o\r\246"
+	.ascii	"F\034\030\251=\241\r \034H4R\"R.]{k\bA\341o\355\251JG\277\033"
+	.ascii	"A\241oD\272\366@Hq\374\222~\353\320\203\241\243\340/I\245\340"
+	.ascii	"\004\337o\r!\005\332\350\005S\241\2257c\r\376\224t\337\355,H"
+	.ascii	"1B\007\032X\237\213\024\370\273!T\207\274t\355\251@\241\272\006"
+	.ascii	"\205\276\"\337\215\242\340\257\227T\344S\211E.\016H\225R\245"
+	.ascii	"\017\322\340\017h\324K/PS\240\222Q\212\344#\226\370\223''\327"
+	.ascii	"O\361\336b\320mj\343\005\214\326O\256s\213\233\234\271\242rn"
+	.ascii	"\235PrVW\3052\354\303\312\2254e"
+	.string	"\234|\261\371\270r\326\350\211\325g\2233\353'\326\311\004\204\361\304BY\205\bf\025>c\2360\205\345\320\377\230-\031##\302\304JIK\371\221\341\b\030\222FO\245\362\274\372\b\246{\233\3565R6\203\013\251\246\310\333\225\202a\305\177Z\375\274j'\"\260\250\004\201\330\250\2414\247\224##2#\"\222$I:\001\005\204 \007\251t\365\022 55\323)\211Dd\002\231Q\220\224\024J\035\261\342\001\004\351\007\220\360\331\310R(K\3078\304\305\227\202\276-\002\330\371\346\316\334\232\312p\3360\227!\257\022\013\254\004\237\n=`\300\032\003\2702l\316\211$\3478\365\243>\314\324\r\t\223\020n\341h\"\312\036\332\367\013Xr\2245\200\357\2709\245~\376\036\0042\3627\336\271\001\215\223\334ah\034{X\260\253\276\314g\301YW}\310\315\233T\343\2365Cb\363\312\022\0132tm RNX\2300"
+	.string	"\032\2636\331\357\231\006\237\335\037,\267\n\fQ\322;A1Feg$\200\024\005=h|\\G\036N\360Vs"
+	.string	"\363\217\327\376\311m\301X\305v\212\n\370\024\225D3t%\320\254\024\245\207&O\375-\3253\020ef\322\217\207\213\331,\016\002\036"
+	.string	"\214\226\314\006\222\013\246\367\207\022\037\333N03\250\250\305k\201\037\224q\016C\300\007\316\347#"
+	.ascii	"qsg\035]\232\222]jl\017\216&<%a\003\022<\022\324\377 \321\344"
+	.ascii	"\026\276D!\360'\013l\217\313\274\351({9\304\375v\331\2208\017"
+	.ascii	"\331\2515\365\241\337O\251\00324@[\306\310\375\332T\311\303\331"
+	.ascii	"><\326\345\321\270Y\266\210\227mo\203\\\2162n#\023\346G\001+"
+	.ascii	"M~\255\ri\223\325\b\375\004]17\333\013\321\375,\323\310za\001"
+	.ascii	"\231N\261\"x(g[(T\261\356\267\035|\0305$\0174S\345[D\205K\207"
+	.ascii	"\245\305|\227\004R\026\221\212\335\030X\313\211\305\311\300\203"
+	.ascii	"\321\t\246r\f\321\005[\223\2129,\307\032,\337\316\206\035\355"
+	.ascii	"\246\005\237\374\342*p\365\223\\\300\221\t\315hK\213\344\210"
+	.ascii	"\210\032\306\f\3727\252\r>\2630\f\375:$\242F\224\244\271\343"
+	.ascii	"\244\313-5\255L*X0.T^_\007\300\f@\214\017O\3405!\345\373\256"
+	.ascii	"\354\302\002\265s\230E\021\023\025\221\270\241\237\265\340\030"
+	.ascii	"\342\325O=\024\025z\264\t\205\232>i^\367%\n\337r\266\032\271"
+	.ascii	"/\210\272z\331\222\331\007\2113\031\222\230E\230E<\233\274[\345"
+	.ascii	"&\214\036\366\032\240\002>\353PZ\373\\\356x1\267bm\357\265\026"
+	.ascii	"SmI G\r;\210\311'4\360\003\216\003N\027\322\332Vq\303\306Y\321"
+	.ascii	"2\243\222\300\264d\355#\024\362\211A(\350\271\023\315[U\255N"
+	.ascii	"\241\023:J\222Xw3\376sh\265\004\245v\364\212N)\317r\252K\267"
+	.ascii	"3fw\261\324\332s\273\317\302\373\326\200X\001w\326\376\221\022"
+	.ascii	"\321r\2177\353\303\024\227\3521\211\370\354\225\250f\242\003"
+	.ascii	"X\\\026c\202\276g\237b\n~\305\226\351eH:\250\202a\020\203\332"
+	.ascii	"\027t\221\317\253\302\311\355\037GY\243\230\003\257\201\033`"
+	.ascii	"\222\220\360\022Q\312.\016\314\032\232\325\213C\001\264\271\272"
+	.ascii	"\263&\\\2511d u\322\3240\353\025\216\227\372E A\275@\277\352"
+	.ascii	"\275\304\306(\275\002\347d:\351_\217'\317G\311\3270\227I_\271"
+	.ascii	"\261v\333\224\0257g\303\017\033aWs\243\305\3065EY\260!\253\232"
+	.ascii	"\"\256\355PTlG\013\351\202\264\251^I\002\312\236*\032\311\022"
+	.ascii	"\n\372=\244g\360'\312C\241\0025x\016O\306$\302(Q7L\252K)=\263"
+	.ascii	"\032-c\026\215\376.G\224z!\342\026AcE\370\213\fu}\215\373\346"
+	.ascii	"\016\353oN`<=\352\363\302\261\303\317q7\276\221\214].\324\222"
+	.ascii	")p\031\037\334\234H\266\354\344~\200\036*\277\3017\232\256!6"
+	.ascii	"\320w\310\275\210:\027\264\267&{\336g\340\226\217&\274\306\271"
+	.ascii	"4\226\007\213\217\031\274)\312?\034\251\002"
+	.text
+	.section	.gnu.lto_.symtab.32a2acf3e455dc8d,"e",@progbits
+	.string	"pgResetFn_controlRateProfiles"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\001"
+	.string	""
+	.string	"controlRateProfiles_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\001"
+	.string	""
+	.string	"loadControlRateProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\001"
+	.string	""
+	.string	"currentControlRateProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\001"
+	.string	""
+	.string	"changeControlRateProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\001"
+	.string	""
+	.string	"copyControlRateProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\001"
+	.string	""
+	.string	"controlRateProfiles_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\001"
+	.string	""
+	.string	"controlRateProfiles_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\001"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\001"
+	.string	""
+	.string	"initRcProcessing"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.32a2acf3e455dc8d,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
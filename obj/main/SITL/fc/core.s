@@ -0,0 +1,3825 @@
+	.file	"core.c"
+	.section	.gnu.lto_.profile.fb5dcbd45bb43ae8,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.fb5dcbd45bb43ae8,"e",@progbits
+	.string	"(\265/\375`r\004\325\025"
+	.string	"T\032f\005"
+	.string	"B"
+	.string	"\336\224\344V\034\002"
+	.string	"\002"
+	.string	"\002\001\002\001\002\002\002\003\002\004\002\005\002\004\002\004"
+	.string	"\001\352\263\360\321\b\005\006\007\b\t\210\301\237\216\017\026\002\006\002\007\b\002\b\002"
+	.string	"\002\t\n\002\n\002\001\002\013\r\240\342\234\212\n\020\253\306\274\244\016"
+	.string	"\021\306\254\357\313\f\004\022\350\326\320\274\b\b\001\002\f\002\001\002\r\025\251\222\262\341\t\024\016\002\016\002\002\002\017\002\002\017\027\032\231\352\202)\001\002\020\035\261\356\305\342\r\016\002\001\002\021"
+	.string	"\001\002\022\002\001\002\023\037 #\222\317\346\334\f\024\002\024$\250\200\234\374\004"
+	.string	"%\267\226\235\323\002\017&\206\361\336\202\002\002'\322\261\355\375\007\"\025\002\025\002\026\001\027\016\002\016()*+./01\233\304\365\321\002\0022\214\233\312\236\002\0023\234\274\257\275\t\f\016\02045\234\275\245\363\f0\001\002\030"
+	.string	"\002\006\002\031\002\016\002\002\01778:\311\202\342\200\017\022;\376\336\373\325\016\n<\266\231\367\251\004\b\002\001\002\t=\315\347\335\233\n"
+	.string	">\304\306\257\225\005\f\001\002\023\001\002\023?\227\254\370\323\004\244\001\005\004\002\030\032\002\032\001\025\002\025@ACD\234\361\365\241\r"
+	.string	"E\350\300\306\254\005F\214\331\320\334\n\n\025\002\025G\212\312\215\322\016\004HI\307\315\333\241\t\nJL\276\276\271\247\fM\277\270\330\226\rN\314\345\244\232\005"
+	.string	"O\363\215\316\200\001PQ\354\206\342\366\006\002R\342\201\222\246\004ST\252\257\370\340\n\002U\202\321\330\342\013V\346\270\272\264\006WXY\264\264\266\260\r"
+	.string	"\200\214\250\2611!$t\222\026$\313\030`\20215U\346\001\021\360T\243\244\033g\3313\311\2041r\320"
+	.ascii	"Ri=\252\256\321\361\017\213\305c\371;\211\363\267]\371Zr\350"
+	.ascii	"Z\\\\o$\222\324\037.\001\246\345\215\r\016\303\221]\334Hq\017"
+	.ascii	"$\036\27492\306\311\2616\341]q\344I\351\331\377f.\337o\356\350"
+	.ascii	"\370\323\242\2040Y\f\255?,\225\216\005\026i~\300v\214\3022h\033"
+	.ascii	"2b\005^a\302t\352\177Y\376<\f^G\361vrG\310\024 \244\016\356p"
+	.ascii	"z\203\307s\261\233\371\322X\357\350\310\354\333.\350-\316\254"
+	.ascii	"M\314P\020`\276\"\214$\374\247\230\326\317\360#\305+\200O\234"
+	.ascii	"o\231\305\364\210e}\252L\304\206\3772<\216\216v\334\304\003\327"
+	.ascii	"\326\305N\022\206 \202\322\2739>\b\032\351\371\250p\353\200\331"
+	.ascii	"\217\351N:\333#%\246\353\244\211\3670\244\221yR\356\326\324\377"
+	.ascii	"\361`\316hd\020\300m\316\013\223--K\314\261L\030\337[<\300\003"
+	.text
+	.section	.gnu.lto_.ipa_sra.fb5dcbd45bb43ae8,"e",@progbits
+	.string	"(\265/\375`\271\001\r\007"
+	.ascii	"\002\307\024\034p/\244\003\374\377\377\377\377\377_\177#\020"
+	.ascii	"{>\371\247D<\371C\3718|r\247\024N\321\206&h~\246G\357<gn\246"
+	.ascii	"&\203\321\257}\231\226rVv\224\311\222\031\031\342Cw\330`\354"
+	.ascii	"bW$\022\342\260\357\032\n\245\023\364\007*\230\001\300\232\254"
+	.ascii	"QM\250\360\222\270\262\006P\002b\354l\016\021`!\"T!M\213\205"
+	.ascii	"=\003\017\025xFs\212\303\025\250\310\2242DW\337\007\001\027\265"
+	.ascii	"\214=\341\026\016\n\247\271*\257\002h\210p\350\356xL\266\034"
+	.ascii	"\312\227\035\027`*\317\304\240z\025\245\021\371f\221f\317\322"
+	.ascii	"^\221\266R\r\337\357%\341\270\241\333\231%\337rP3|\271\260\021"
+	.ascii	"xu\351\254\003K\254\357\316\021\210\236\264\200\321P\310\022"
+	.ascii	"a\254\t\226\306k\007\266\310';T\353\330\035o\013"
+	.text
+	.section	.gnu.lto_.inline.fb5dcbd45bb43ae8,"e",@progbits
+	.string	"(\265/\375`r\013\035\036"
+	.string	"\306\036vK\240\224\231t\264_~\361l%\360\366\364x\346\232\360\025K\366\336Sx\016\f\325\027-l\357$\035\344\r\211\263^U\321\034/\307\217\005\203&'\315\236\020'`>R:\032=M\340\357MR\213t\036@y,h\b\211\275\345N\001`"
+	.string	"d"
+	.string	"`"
+	.ascii	"?Sn[Cg\333q0\324K\361\323z\001U\255\2619:\240\220E\244\344CE"
+	.ascii	"\312Q^6\207\2535\2010c\036s.\037\2002\272\004\244C\201\314\366"
+	.ascii	"\232x\224-?\t\3000\272[\206\177\033\343\027\335\355z\252V\313"
+	.ascii	"\347\027ww\237~\230\335\3014\302\305\360_c\366\227\364\251=\370"
+	.ascii	"[_\301\002\306\237\214&L)\327\005\2051\r_\322\007u\t/{\037!f"
+	.ascii	"\211\340\230\212\320\330\330#]\022x\336[f:Ii\0026\362\206A\013"
+	.ascii	"\336\340$\230\327\372\253\211\037\300Y\177E%\315n\305\325eP\377"
+	.ascii	"\212s\372e\274S\032\"\244\336n\030\b\223\245\246\372\343+?\323"
+	.ascii	"\272k\2428bq\223\r\343\t\226\0378\323\274:sR\341\022\347\333"
+	.ascii	"\033\253\024Z\"m\321\275`mH|\311\020F\202M%/\207APk\270-\310"
+	.ascii	"\254\0202x\204A\006\217,\257@ G7zr\n\177\255h\f\037\217$.\240"
+	.ascii	"m\311\303\372\313\353\275\b\3665\016\345\030\357rL\304z\263\377"
+	.ascii	"U\270\276\336\312x\250\0304\374\362\023\216\366\204\314\007\361"
+	.ascii	"\201O\343\241\303\177\305\036\242\001\016\242\323T\256\234\303"
+	.ascii	"\317\364,\352\356U\332\335\251oP]\003\273\350n\024K\354n\001"
+	.ascii	"\237i\026\264\236\231\352g\005\020\216\3243\324W\234\341\221"
+	.ascii	"t\t\253\307\016)\347\2722\030b~\322h\365\365\336;\202\205L\243"
+	.ascii	"\235{\324_\234s\372m\354\f`\r\351\022\335\033-\002\200\353\250"
+	.ascii	"\021\256\021\231)I\222Ra8`\2421ET\345\001\022@\021\201\210\n"
+	.ascii	"!\216s\3200C\"#2AJ\222\024\253\001pl\331\261\211\305IJ\307\246"
+	.ascii	"\026r~4\262|@\371\205\271zU\303\214r\315\265\221\025~@t\033\300"
+	.ascii	"\365\b\360|P\232:\354\224\027>O\2135D\247su\345[\324\251\361"
+	.ascii	"\316\004\250\037\224\001U\340\274K9Q\271\f{\020\351h<\247\356"
+	.ascii	",\026\272Z\333\304\217i\377\202\201i\007\030\266M\003)\343\202"
+	.ascii	"\201i\fs\327HG\316F\255\234oD%\274&e\314\r\230o/\304"
+	.string	"C\360+\251v\272\240\212t\321\2028\303$\232\306\210\025\216\311\364>\372\033\255\317\3754t\344Tb(\002 \206\323\310\375\204A\332\002k\241\264\214k\271\240\307\347\314\314\177\303\271'c\321\311y\324\311\265;\232\202\250\352\360B\354m\017,\242O\027\213\305\\)\342nWQ]f\327\223\013\236\261\343\333\n)\245\212\030T\231\030\244r\326R4J\334\350r\001\257\0039\346P+k\242\211s(\257\321\313\b\020\200nU<y\230\t\206P\361\020\304\003Z\350\006\352l\250<|x\326'\245d\024\263\301\310X\373\203d\331\315\234B\223\213\202\367Gh\277P\211C\221\307CN\271\347\340\326\200\214(\200\371\272nZ\2166\036{\377\374\210\017\206\234 |P\260G\243\321\r~s\325\206\300\2714W\273\331f\2205V\323\025D\351\344G\200\331\356\027d\0066\211p\020_\036\224\301T\276\206p\016\367S\021\336\231"
+	.string	"\214?\305E\247\364K\002\334\314?\235\2277\227\376\024\315\"(\374_@{\262\377[\260\025\021\254\207D\271\235\223\360\200M\024\2679\357z\027\034\221s\327>"
+	.ascii	"\330\r\024\252z\267\311_;N==\337a\267\n\b\310"
+	.text
+	.section	.gnu.lto_.jmpfuncs.fb5dcbd45bb43ae8,"e",@progbits
+	.string	"(\265/\375`d\n\305\033"
+	.string	"\266\335^@\020s\223\016++&\031\211C\343D\212m\277\341\350\020\206\224\t#"
+	.string	""
+	.string	""
+	.string	"8\210"
+	.string	"\360K"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\bU\225\212v\332Xe\210\flL\255\t;\033\220\307[\217R\342\367\357\215\262wK)\005H"
+	.string	"Q"
+	.string	"K"
+	.ascii	"\321\261p.\323o\205E\035\305hQ\376\036\313j'\374?@[S\247\323"
+	.ascii	"\351T\310X}\233\323\2662\200\223\374\327\376CBDDl\302 P(\344"
+	.ascii	"Wb\377\214\265f\t\256\255\2465\273H\314.\227\304/\377\266\240"
+	.ascii	"n@\004\024"
+	.string	"eX\"\317\332\001\207\030{A[\005m\202f2((\231\035S\250\241\013\266\330\305\0066\233\002\220%\177\002m\235\r\217b\214\034\216_\302\226^\227EiY\255Y\206\377\030\243E\237O\203\321\232\251\323\361\313\027\226Ur\316.\034cU\371\265p\f<~\277<\305\213W\362?I\205\377O\f\377;\374;\367\207.\212\322\321\302\021\371W)\256\341\b\020:\017FF\034\324\262'kO\336)fW\373\266A\013\317Z\337@p\300\235A\303\243\374+\006\2056$\221wC\034\276\002n7m?\264\036\332\016-\207vCML\256!C\213\241\275\320\312B+8\207\215\303.\214anSh_\333\t1\266vrr\022\b\205\177\007\361OQ\255\001\201+\231\fd\321h\374\322?\374\277d>\030\303`\374J*%\225\354\3413\223ID\236\005\201+\2501aFD\222\244P\031\326\261\005\2040\306\024\226\007\022"
+	.ascii	"B\302\020F\b!4S4\242\324\331\230\003OM\201\350\342\342\222n2"
+	.ascii	"\321E'\270\200c\ng\323\243\033\t\245\345\b6\003<\t\257B6\345"
+	.ascii	"\033`\016\212\371\373\310D\r<\036i\034G\033\366\273\376wL\207"
+	.ascii	"\341{$&-i\237Qp\223)\254\341\035[\342\352\321\030Q\376 \225K"
+	.ascii	"\240\313U\227\253\270\267K\\w\230\026J\350.\332f\256\241\362"
+	.ascii	"\254J\315r:-\343\021\337\275<\360B\032\311_\317[G\364(}\230{"
+	.ascii	"0(\323\243\251W\267JZ\213\262\3406|\231\273\227\263x\224\350"
+	.ascii	"\265\002F\344s\256\023\027\312G\377%\021/(\232\300\213\332\274"
+	.ascii	"Z\271]\242=\226\3756C\303\021f\372\301w\247\334\347\t\216]r\304"
+	.ascii	"_F\016]!\235\324\351\324UE\002b\246XN\2421\244\371X\212\234\206"
+	.ascii	"7p\r3\366,\254r\342\354\252$\234:\013\277\222\037\316\376\327"
+	.ascii	"\322D\242\033\213\004(aK\300\354#m\024^5?\004\307\223\207\341"
+	.ascii	"\334\351\223A\">\244\216p\272\321cl\232N#\211\202w\001\t\334"
+	.ascii	"t\222XA\275?l\365\237\302\021\f[\004\233@\203\375\340 P\177\\"
+	.ascii	"\005\006\241<\220\020P\336C\260_\251\220^\0232\302\265h\244Y"
+	.ascii	"\255\t,\031\211\007\003p\357}N\343s\253W\006\023\340\016T\"\253"
+	.ascii	"\335\001\275\343\271\235\340\277\206\252Y\025\246\032H\312\251"
+	.ascii	"\335%\t\203\201\274\202\250\320(\025\202\245\214\212\r\020\025"
+	.ascii	"\243\222sX9\273\r\n\326;\350d\021\f\373\022A\004KI\2168\212\241"
+	.ascii	"J\264\275\024\354kr\357:\353t\371T@\305\376\331\247\032Es2\273"
+	.ascii	"\315+\273C3F\227\371\347\001\247R\363.\357py0\351\001h\344Bd"
+	.ascii	"\314\2364\321\334&[\356\204:\204-\nf\017hJ\270\031\t\242\250"
+	.ascii	"\003\024"
+	.text
+	.section	.gnu.lto_.pureconst.fb5dcbd45bb43ae8,"e",@progbits
+	.string	"(\265/\375 t\305\002"
+	.string	"B\007\025\032p9\f\007\250C\377_U\214]\036Tt\036\3561\303\262tjb3x\330\001N\344!\007r\037\347\361\216s\334\306i<\343\030\2778\213W\\\024\237\270\304E\034\342\017wx\303\031\276p\205'\\9\302\017n\360\202\213\340\003\227\300\003.\200'\225R\032\005"
+	.text
+	.section	.gnu.lto_.ipa_modref.fb5dcbd45bb43ae8,"e",@progbits
+	.string	"(\265/\375`\270\001\355\b"
+	.ascii	"2L#)`\307V\016\240\340\206 \b\202 \b\302\250\252\252\0203\243"
+	.ascii	"\301\244\r\360\030\006\373\330-\342\030\2549r\261\036/2\334\210"
+	.ascii	"\224)\377\317\257\374SHx\204\377\340\r\n\b\312\201\005\002~\200"
+	.ascii	"G\035I4\202\201\241\271U\372\247\006\202>\236\252\274\362\376"
+	.ascii	"\216S\316Q&K\216<\236\016\253\334\3324\336\353\324tf\312;\256"
+	.ascii	"\0072\376.V<\246\223*\247:/\345[\247V\256uf\345\331\264\224W"
+	.ascii	":\375'~b\345X\347U~\265O\310]\b? `\0022Uv\007\343Ap\311<\220"
+	.ascii	"\322\021k9\240j`8B\223YU\301c@\031\226\212\r?\020`\334\275%\244"
+	.ascii	"\214\240\274\362\366\021\255\b\032\274\030eT+7\006\034\312\004"
+	.ascii	"\341!\224\023\033\220\240\274\254\216\323-\320\241 j\256\367"
+	.ascii	"\b\027\343\016\211\r\016e\030\216;X\302O0c\302I\263=D\033R\027"
+	.ascii	"P$Sr\355a\357\360\216Y\270\242A\362\360\265\346\310\320\322)"
+	.ascii	"\307\366\320\352\021O\312\226\245\220H\367qd=\021n\341\206"
+	.text
+	.section	.gnu.lto_.lto.fb5dcbd45bb43ae8,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_osdLaunchControlModeNames.137.fb5dcbd45bb43ae8,"e",@progbits
+	.string	"(\265/\375 \240\265\004"
+	.string	"\204\bX"
+	.string	""
+	.string	""
+	.string	"<"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\350\255\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'*\206\b{\370\355Ry\276'5\206\bw\230\355\002u\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\005FULL"
+	.string	"\013/root/repo"
+	.string	"\025./src/main/fc/core.c"
+	.string	"\nPITCHONLY"
+	.string	"\007NORMAL"
+	.string	"\004"
+	.ascii	"8S\373\264\272A\3457\200\""
+	.text
+	.section	.gnu.lto_throttleCorrectionConfig_Registry.141.fb5dcbd45bb43ae8,"e",@progbits
+	.string	"(\265/\375 \230u\004"
+	.string	"\004\bi"
+	.string	""
+	.string	""
+	.string	"#"
+	.string	"\005\001\212\001\206\200\200\374\342\203\364\322\033\031\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\355\030us\367\007uq"
+	.string	"\005\001\006'\001\004\005\001\006\035\001'\001'?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\025./src/main/fc/core.c"
+	.string	"\004"
+	.string	"\236\n\013f\361\024u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_throttleCorrectionConfig.143.fb5dcbd45bb43ae8,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"\005\001\006'\001\240\006?\202\210\200\020\177}\274\001{\273\001"
+	.text
+	.section	.gnu.lto_isCalibrating.144.fb5dcbd45bb43ae8,"e",@progbits
+	.string	"(\265/\375`g\002\225\020"
+	.string	"6\035gE\020\221\223\016?4\316>\236\362h\365&\224\232\003p\023\222\032\331\033\201\200u\355\253Zl0\322\206\326\336\2675c5\333\272\307d\001\020'"
+	.string	"\020"
+	.string	"\300\nP\016\"u\031pb\016\244\242\3306!d\023\262\245\224)V"
+	.string	"M"
+	.string	"R"
+	.string	"\230\274\254\310\353\271J\220\210\002\201\302\003?\252\231&-\022x\001\023Ce>S\354(\271x\212\3722l\206\372N0\231\357$"
+	.ascii	"\352"
+	.string	"3Y\251 \024\275F\326\250d\343\004E\026\2267P\024=\272[C\350\222\300\320\256\004\351\356\257\007^\320s\350\377\025\377\005\374\233 \236\362\246\232Y\211\370\363\247>\313\247_9\f\303\360\254\362\177\277\331\375\374^\373>\373\036\373^~o}\037\367\n`3\211\341^\272Ka\215^Y)<\374'\371\347\017  \271GS\035J\262\304\305\250\304\214\356\024\307,\352Q\315\324\262\030\253\206\257\2731\031%o*\033\233\322\335\222O\272*\030\0301\227\305\273\302\300b5\245\204\370\243\232\352n+\262\310F\336T2\272\273#\237D\350\362\266d\373w\020V\275\345\001\244\231UH\371\236Ky\203\302B\202\205hi\374Z\325\t\327O\241\302j\347|\204t:\016\307\021\341\034\214(h\300q:\021\270\217\216w\017B:\234\204\256\353p3\325\032\233U\276\263\200\356e@'\223\376o\330\003\304\241O\336\260\232\030\335"
+	.string	"mxE\215~p\3616L\215we\201\306j\372\013\207\026#\264\f\313x;\201AU\204a\230a\274-#\0018 "
+	.ascii	"\003!)\323\001\20624\307\214WqI20\354\f\333iY\233\227\272\357"
+	.ascii	"f\355w*\320N\226\261\371\326\233\335\242\255i\027\027\004c\323"
+	.ascii	"\366\236\354\324\226{\017r\335z\36565\243\260\307\316\2431\035"
+	.ascii	"\023\347a\037\330\017T\276\206 \215\204\334JnX~\267\230\334\212"
+	.ascii	"\025f\035sS\356h\f\221\242\031\332\314\316(\322\225o\237c\320"
+	.ascii	"F\357\306&\3002"
+	.text
+	.section	.gnu.lto_canUseLaunchControl.145.fb5dcbd45bb43ae8,"e",@progbits
+	.string	"(\265/\375`\013\002\345\020"
+	.string	"\206\236nH\360\260(\035\270\363\250\253\333\365\027t\022\351\357f\274l\004\353zRTCl\f\267\2716\330\316\311\267clz\373\377\264\030v%\242\373\372V#!\267\211\314%q\030Y\261<\334\334`-:1&\362\t!{o)e\n["
+	.string	"S"
+	.string	"`"
+	.string	"\342~:n\243S6\213\337\322~$\b\207\027\032@1<\334X\231\026\013w\250\025\346\276\021%\323r\361\346\215)\371Qk]\031-\027\323Oe\304\300sM,+\277\361\002\267\004\311Q\241\303\033Q\022\304\212Qmly5\236\2307\221Z\353Y5f\330{\373\277\304\177\003?\027\b(\346\371\344\277\202\005^\325\366\306\226\243\241\323\332\221s\352\322/+q\277\376\225\265]\376\363;\346s\347o\347\323\363\347\371\362\374>\177\tPh\331\311\261`V+\253\207G\255\315\025!\376\247\374\336\021$H\271\2702\030\326\276\260R&vj\225\201\375\262\001\335\366Q\267\376lb"
+	.string	"f\210Hq\264;\246\204\366\302h9ui\273\025\024-\266\371\261\200\025\321\377\201\t\257jv\200\325\314"
+	.ascii	"\330\006\030\225=\372\360\201=\241\177(\201W%\373[\221\250\241"
+	.ascii	"\024\324p\300f\277\266{\334\270`!\373E\263\335#\224\356\317f"
+	.ascii	"DmaxrR\364E\272\355\240\306F\017\205\210Ha\b\f\215@\b&%'`\210"
+	.ascii	"\204\002\206\200\036F\020\221\300\taH\002=Y]Y\333\345\024\347"
+	.ascii	"\303\214&\227f7\266\fp:\314h\335\256H\273V\371\337\365EL}\372"
+	.ascii	"\364\353#\224\353QM\215\357lO\214|A\274\001\311\374\222\320\235"
+	.ascii	"\\o7\264\031\227\211{Nu\\\247+ \300\002\2311\343\006\305\b\355"
+	.ascii	"(\031\236\237\2334&\320H\204\216 \274oa\332\230\255-\272|\223"
+	.ascii	"\366\222\264\323\352\233\211X\333\362\006l\207~\334\337\334\003"
+	.ascii	"{\030\3522\252\205\"\230\017a\372\3033\r\3070\003\216[\220\322"
+	.ascii	"\367\221\024?`\371\246h\324\035&\243\355)\355*j{\230\256:\004"
+	.ascii	"\024"
+	.text
+	.section	.gnu.lto_resetArmingDisabled.146.fb5dcbd45bb43ae8,"e",@progbits
+	.string	"(\265/\375 \341\035\006"
+	.string	"\362\n*4`k\323\001P\235oFJMXq`d\035\n7\355\257\006\202\323,\326\2024\036\034\267\377\376\221&\267"
+	.string	"\016\260"
+	.string	"\300\301Y\341\310a)d\320O\376\336)\005\236\322T\351\2243#9\032\314F\316\n %\211ig\2522\200\322*\243m\037\265\013Fg\305\001S\3567\334\301\022~\202\005\314\301_\177|s\217?P\305\204\227a\301\317\336*\030\r\354;6jv\214\\PT4v\261oc\273'b\301\366#S\266\3057\204=\204\002\301\203\267\2732\036\234:\244\3743\034re\325!d\331]\303++\270\343'\266\261\t"
+	.ascii	"3\001\0038\343(\276\3055\221,\004\3742\004\270tc\266\266\353"
+	.ascii	"\264"
+	.text
+	.section	.gnu.lto_accNeedsCalibration.147.fb5dcbd45bb43ae8,"e",@progbits
+	.string	"(\265/\375`i\003\335\025"
+	.string	"\246&\213K\320\322(\035\250b\234\232\225\211\2044\240Y|\354\252T\023s\263q"
+	.string	"\232\230Nu \243L\330\013\022}\036\0029\264\377o\237 eC\313\347\261\f7\017\242\031h\261\331A\355\230\036\214\366\006\30128\217X\022K\b!\204H)S{"
+	.string	"i"
+	.string	"~"
+	.ascii	"\265\362T\215b];\222\246\320\023e\226\344(\206\315\256\357kG"
+	.ascii	"\302\023\034\016\0209L\370\330 [\016\247&\265V\034\247P\007;"
+	.ascii	"\030-\202;69{\222@\2150E\224\253\303vC\316F\016\253[\002A6\034"
+	.ascii	"\026\027\246\263a8\200G'\230\3366\204&H\277\331y\223q\207'\300"
+	.ascii	"\"!\351M\026\222\324~h\253[\256\271\305\230\311\224Z\353\231"
+	.ascii	"v\263\331\003\330\177K\376\027\370\273$\235\366n\277\330\372"
+	.ascii	"8\001\211\372\256q[\302\213\0362v:\311\274/\343\217!\003/m{u"
+	.ascii	"[\356`\"\n\002e\375\372y/\356\236\177\303\332<\377\371h\363O"
+	.ascii	"\346\243\3167\317/\317'\317\037\317\027\317\017\317o\376\n\330"
+	.ascii	"\017%\232\2000P\252\265\366D\244\376D\037\320\377\375O\363\237"
+	.ascii	"O\240\200\346\256\345\371\324\310\231n\026\243)A\240\314\026"
+	.ascii	"\"\227z\221\221\214\016h\221Nv\343,;\006\307d\240\354\264\347"
+	.ascii	"\202O\020a\201\"[\006\027$Ev\332\323\205H\272\2329\266\006\334"
+	.ascii	"\017\324\330iO\310\364\325\210\225b\313\340\226H\261\323\336"
+	.ascii	"\212_\200\244\244%2\354\030\234\022\207\235\366T\374d\375Z\004"
+	.ascii	"@8\036\306Ny\227e\374)\264\360\322\272a\206\330\356\263\221\363"
+	.ascii	"\022\273g\373''\324\024v\317n\271[(\376]X\2744\016_\241\260\264"
+	.ascii	"X+\325j\202\312B\313\212\213j\325zQ\241\220\234u\201\245\245"
+	.ascii	"\202a\261Z\252\223W7\254\315s\222\307\320\020\272\272m\240Dc"
+	.ascii	"\250\027\356n\321\256\371\217\366S`\035\033Y\225\361lt\347\177"
+	.ascii	"\260F*e\255u\301\327W\001B\231\233\031W<\333\334\301\370\351"
+	.ascii	"\337\336\022\315|s\217\260\"~W\306\025Q\275G)n`\374\264\237Q"
+	.ascii	"s\224\232\335:`6L\021^H\250QD\201A\036I\325\344HiA\216\001\340"
+	.ascii	"\002\021)\252\016\020@Tc\363\303\310\216\203\210Io\023,U\200"
+	.ascii	"\347\177\211\367\205\033\001L\005j\253N`?\364\3403\351\335\325"
+	.ascii	" \324\342 \032!\r^\203\363\366B[\371\001\302\336\331M\035]bk"
+	.ascii	"7\2005\005A]\313\241\247)j\017\255\273R\342K\2553\243\232)\264"
+	.ascii	"0\211\005\3713\342\332\333\004K\202\234X\314\354\363Y\\\261\275"
+	.ascii	"\240\362\310\222H4h\271e`$\344\207\016\273N\025"
+	.text
+	.section	.gnu.lto_updateArmingStatus.148.fb5dcbd45bb43ae8,"e",@progbits
+	.string	"(\265/\375`\\"
+	.string	"-\t"
+	.string	"v\221?:@\305(\035\260\333\372_\250}m\220L|\337\212x:5\177\305\312\276\235q\004\020S~J\371Mu\334\320)\002\300\260\220\303\300\306K\306Xg\350\223\344\354\310\366\311\336R\246\024."
+	.string	"."
+	.string	"/"
+	.string	"\357\034jv\374\233>\320y\236\303\212\305\025^D\034\035\201\307A\003\325\310\200\233\236\024\036(\223r\260\273\316\316\253\270\343m#\330.\260}\022(.5\303\276~\337\367YI\366\323\361\351_O\355J@\002\201]\321\327\332\222H\322a\373\026w\354"
+	.string	"G\225\366!\027!\220\325\356b\252\021/\261T\"j\314\025\365\246WL>"
+	.string	"\200\222\345\037s]\243:C#\356\247{H\370\033\236\340\344\273G\237s=^3\244\026\306i\364\311\317\016\3162\232M\313\260l\001s`Ph\300\262m\203e.\326\0364\033\006\241i\033fA}\016WI\216\251-\240\372(\007ww!%\355MD\276\263\252'\016"
+	.ascii	"3\241\335/FV\301\301\025@\265\017RX\304\205\017\341jTxv\031\345"
+	.ascii	"e\bq\351\242j\207\006\246\240"
+	.text
+	.section	.gnu.lto_disarm.149.fb5dcbd45bb43ae8,"e",@progbits
+	.string	"(\265/\375`y\002\255\024"
+	.string	"\226g\212J\300\322Q:R\005\210\323\213\210I+#\344\356\233\317\002\244\342\037)\005\264\023h#\267$\215\326GE\375l\372m\177\230\272\017R\324\225D\277Ad4Y\270]\301D\002\242 \316P@\344s\200\223\002\217@\265\221\275\211\334)\005v"
+	.string	"m"
+	.string	"w"
+	.string	"?\007\242\335\007\302#\265\246 :\252\025\250\300\007R\237\255\257\350\247x\023\372i\232\335t`\257\236\210)7\004Uku\255\212\323>\322)\256\244\371\343\312\357#\272]\355#\201S\023\237bKI\2303\300C\021E\262\253\221\242j\027Bl\325Z\037\304\311\025\0238\325\020\242\332\345\304\225\r\013\335\177\227\"v7)\307\225Z\253\245nws\247n\333\203\355\005\266\374\005\364[\262\2269\234\333e|(\306\357\261\f\215\274\356\323\247\241\237_\024\027>;@869\264\2017\271<\366w8\034\016\275<{\245K\356\373U+\235Z\351q\245\251(=WZ\\\351\2330"
+	.string	"\262\243\263\342\307\366"
+	.ascii	"V\233!\221*\2346Z<\350\366\201~0\350C\013\007\254\273\337@\001"
+	.ascii	"\177\240j\035q\362\351\223\324\347Il_\332\017\256\320\322B?\307"
+	.ascii	"\035\223f\300\360\r\220\027z\320\302\211z:\001\277@m\f\031\344"
+	.ascii	"u\016\260TBX\2635\253\326~=\b[\365j\255)*\274\235\023:s\375\242"
+	.ascii	"\033\3056\270\270\320\317E\002 \355\027\231\274nn\201\234\035"
+	.ascii	"\302\333\326,.\215\353\202\310\263(]q\037\274\250\243\351)G\342"
+	.ascii	"&\207~\221\307\320/}o\210\323\321\232EK\366\277\247x\b1\341\344"
+	.ascii	"\020\377\254\257\231\327\203\031\230X\207\330\b\214L\346\025"
+	.ascii	"\233Q\303Pb3\031\314\005\323\340\202qy\275\270`3\031\027\312"
+	.ascii	"\3122\016\261\231kF&\233\271H\200\266\213uy\236O>QN\266\275\211"
+	.ascii	"\265\326:\266\244\335\300\301\177_\271m\315\210\262\244\r!\202"
+	.ascii	"j)\007\001OQ\235\313cy\026\232Z\031C\302\225r\244V\305\207\317"
+	.ascii	"\346\033@/z\"\013\035wfOx\022K\252V\\\212\217t\034\024\374\236"
+	.ascii	"\317- \200\202\231\271\353\001\303\320u\307\350\016\336\025\273"
+	.ascii	"\220\\\206,\305#]p\2773\320\002\n?\360\311p\273\b\262\330\025"
+	.ascii	"\177\265N`c\204\344\354i\035\326Y!\261\b\333Nd\0302\367\201\230"
+	.ascii	"\347\221\217\365\352\001\310\302h\027h\346j\334\376\341\037c"
+	.ascii	"\261\355\033z\241A|\247GM\376+V\025\256\231\212E!\367\327'-\n"
+	.ascii	"\005"
+	.text
+	.section	.gnu.lto_tryArm.150.fb5dcbd45bb43ae8,"e",@progbits
+	.string	"(\265/\375`\375\003\355\032"
+	.string	"\326/\250I\240XU:\200v}Xx=\217"
+	.string	"\274z\320\301eG#\226!%\300\325\340sT"
+	.string	"w\373\330\203O\323\261\027o\372W\370:\326\266\207m\266\342\372\364\321\365\274\034\274\310ZAdm_Z\203\253\271M\262\255\204\355M\244L2\225"
+	.string	"\206"
+	.string	"\227"
+	.ascii	"\017^\230\342\300m\236!Q|\300Z\353\352"
+	.string	"s7\305\356\352s\\-m\267\312\207B\365F\202\270$-\265\326W\007\235v\230\225*E\276\32096\323\366\252\035\317ajh\370\364\276r\322\365\212t1XE\254q\322\301\340\324k\275\223#\001 \031Qw\322\361F\227\223\022w\036\257)\322\365\370\245H\367\323b\207c\372\342Sf\247\342H+xt\361\036\021@\035\311\"\263\273\215\255\036\033\271\037\235Y\354l\314/6\265\326\345\334\316\347\033\363\335-w\327\301n3\t\"\310Zo\f\366@\036$g?\364\271\262\022\374\\\t\372\311\375\2433Q\220\213/(\254qqwh\343\376\355\276\213\305bq\033h\227\362\3164o\353J_V\363\306P^\025\345MM^r\344\245\315;G\336n^n\336\0138\221!_\217H\330R\206\265\247\310\245\226\023\t\321\225~\342\256\366>\236D\273\3226\271n\303\272S\325\370Y\002L\360\271\005\310O\327[\364s<"
+	.string	"z\340\207GBq\340N\341\020\212\335N\266\251\3022-\023\375\274\360\006|\236\204|@,5.\246\326\302\206\037\335\306\026\224\004\n\221\354\037\222\237\274r\344\263\257d\366y\374@\220\024#^\215\213\254DE\317\215\227\023\264gx\027C\006~\256\311)QKQP\266\346\241\001x\217\244aCO\032\032C:\3754\264\3251\275\214\343\331n\344K\034\366C\333\001\006\243\237\255>\322\331\006\020\027_\2207\312\260\202\357\306B\360s\013\363dW\336\232\347B[\240\226\272\177+\202r{\350A\345\306[v\027\347B\002:\262\035X\354\302\207\330\b\017\260\035\234\b!tprf\260"
+	.string	"{\263 6\223\335\274n@\274tp`9\257\233\331\316kAke$b\263\227\t\231l\366Z\rk\267\251\265m\254\265V\230\002<\323\2734#\332\021\361\254\037O;JV\317\364r\356\n\253\235\242\006\314\030\002\255\372\307jU\237FI\013.\223\252\237\343\247\210\021\317\305\251\336}"
+	.string	"\201>\307j\027\331\251\236I\270.4\274+a\002?G\366\211o\225O:\312\006\245\025\034\252\3765\235\366\214\002}\317\n\0343\022|\337\344\001V\250a$%\025S\312\314H0\022\204$i\341p\002\031\2713\017\020Xg\263-4\006\362\250\276\304-\227-\203\2573\243$\300=\310\357a\350\336\362\r2\204{\262H\021\345C\373\202\341\004\033\213\341s\314\r\222\201\247\021Qm0M\356c\366A\355\020\355\324\351\202\212\200\236\376\240\334\3235\022D]\240cZ\344}\234&\355N\021P\007\355Vh\377c\274\276\354l~`\3105\361\345\232\225U\367nK\25278a\306\224\006<\223@\221\277D\310\272\372\030Er\314\367\032=\037\2133\372\267}\377\0245O!\004\026\333[l"
+	.ascii	"g\240\357\201cE\331l\331\355\027a\233b\215\032"
+	.text
+	.section	.gnu.lto_handleInflightCalibrationStickPosition.156.fb5dcbd45bb43ae8,"e",@progbits
+	.string	"(\265/\375`M\001\335\f"
+	.string	"f\225N?0O\224\016\304\200\b\f\315\343Z\016m\324\016\006\271%:\232\221\271S\206\266\3575\372\357\2327\363`\377'\333\207\301qX\261\315\031+\36300\310\313\340R\246|\312\223\340\260~B\310\2262\2459"
+	.string	";"
+	.string	"A"
+	.string	"\273\253\351\206s\216]\026\324\344\370\030\005\300\027\275c\227#\242[\023\262(!a\200(\272\n\210\037X`w/\342I!z21\312\356:\277h\341\216\3346\306\266\001\373\036\002\226\257\271n]5\236"
+	.string	"!\235F\235\f\261Q^\252\311>\\-\331O\303\247\363\351g\n>\204*\304gp\261\033\n\211\261+\013E\007\333\317\314\261[\034\305a\thl\200H\200\004*\r\250& \213\357E*\324\2030\224x\220\252Q\225A:\215\240\232\276\271: d)U\211\264\361\361\021O\235\343B\212\020\037\271\273\236zs]\021t\254\370$\f\373\247sl\374\fG\320\344\277\007\336&\225\216\333\264-\201\206\261\034\270h[\227\321&\003\3141\250t\232\003\216\353\264\f\265\367"
+	.ascii	"\261\352\250\007b\222\224\334r\331\013.W\341\241a\365\331+\222"
+	.ascii	"v\203L\376\263\252wKMP5\025, \260\202\241\271\333B\3002\334U"
+	.ascii	"X\300(\3570\226\350^\274\n\270\210E\225\357\330\031\346\264\331"
+	.ascii	"\302\332\"{\320\200\035\347lf\033hGc\024LB?7\021N\310\356\025"
+	.ascii	"\217\031\213)\270\034^\242*\212+\356\007h\207\377n\370\323\270"
+	.ascii	"\243\371%\214J\326\365\253\017\311.\355\215\313\333\256\245\007"
+	.text
+	.section	.gnu.lto_updateInflightCalibrationState.157.fb5dcbd45bb43ae8,"e",@progbits
+	.string	"(\265/\375`f\004M\031"
+	.string	"fj\226K\260\022R:r\370\226Z\310)gU\204\267=\032@\035o3\274\b\325R\032\336TlW\007\277\232\244\266\037;\377\266\177\304\037p\332\322\017q6\231\200d\007\272\243\342/k~d\277\247O\024\226\305<\265\355Y\373\311&D\312$\003\206"
+	.string	"p"
+	.string	"\201"
+	.ascii	"\265\346\350\243J\225O%v\367\347\316\354R\t\240\2517\004&\240"
+	.ascii	"v,\214\265\326Y\217\370\314Ad1\330\371r\265LZ\222\3153{"
+	.string	"\027\257w;\210\f\310\261\036\036\206\231($?7=?I~nt\376\312a\327\220\215\316\217[7lvH\206l|l\2128\335}\340\222,\261r\272\022\251!\301;{4L\236=\035\267\254\267#\t\324Z_t\006\321\3131\233(\265\326e^\357\346\013\340\273\027\331]\003\273d\201\375\242\277N\374#\224;\244\227w\276\334\223\256\002\003L\255F_r\237\020\317\265\326[\257\f}\263\f\247t\234\265{\341\215d\366B\273!\206\317{\271\217\241/\337\335\203a\004\n}8>\356\"\345\270\203\273'k\003\3552o\b\363\306\316\013;\357y\336\327y]\347m\221\274f\311K\231\267$y\311\346m\346\345\363~\200K\261&D\357<U5\272\276\231\035\224\361\234_\221\350\300S\350>\306\235R\036\250\250\320\227\035~U\306\"\355\340\376\350\255\226Q\r\247\002\360\036\002\335\215 \201\317k\265y\344\243\353[\227"
+	.ascii	"\241p\312\016\256\331d\303~\206Q:\316Z\332\346\2043Qh\325\252"
+	.ascii	";\331\273\370\213\n\026VV\350K\332\317\021d\324M\366w?p\273&"
+	.ascii	"oAk\325Z\023\354\225\276\324\262\027z\271."
+	.string	"//\364e\367\231\210O8>\362\311\021\032\022K3i\261\325h3\332\205Y\206\227\025\230\031\315\02633\021\331\232\206\026\333\214C\255f\233\235H\2707\020\203#\037,+\\\347@:Xc\307\2023\251I\n\230\242\210\343\243\016\243_\017\243\254\203+^\236(\206\304\341c]\342\210\365\227\2101X{\260\001\353\362\326D\004\024\372`\227\241Q\337\371]\031\213g\007\237\016u\234\337\025Qq\221j\255\257\263\231\212F\203\263gA\256W\333f8x\265\202\037\017\254m\271\232%\346j\230\222\320\007\313*f\250q<d\221r\202\242Q\220\024\245\322\001\240\002\03113\017\020Pt4b\230\326C\271\271I\331\273\036sJ>U\b\254\036\027\241CB9dd\024\363~\312\020\026A\245\025\205 \003\352Mc\323{t\204\006\205\030\352Uzj\355ah \034;\374+K\013\342Z\f\205\004<\3140\322\324\236\376"
+	.ascii	"=\211$F\277VQ\253\352x\025\330\203n\274g\237\252\365\024\311"
+	.ascii	":\n+2[\261\021\251p\232\240n9>\337>\235\216$Z\313\310KY\366\354"
+	.ascii	"\322\262\325\341#\3012\204\357\202@\271\024d\020\rN-}\n={\277"
+	.ascii	"\026\256O/\374\363z:f\3721\336\334dj\324\243\312&\273\212\354"
+	.ascii	"\310\343\355\350\003%.\200\313E{o\246\377\001"
+	.text
+	.section	.gnu.lto_updateMagHold.158.fb5dcbd45bb43ae8,"e",@progbits
+	.string	"(\265/\375`\372\005\245#"
+	.string	"j@\270\rH\220XN:E\362\n\321\263\316O\203\221\254\376\t\314\216\3779#\324\364\2005x\022\333\022\331\324\003)\251l\355G\200Q2>\313\231DWxWO\220\230KKnU\344\364\260}\354\177(\351\301hk\333\b!\233H\231d\276"
+	.string	"\273"
+	.string	"\316"
+	.string	"\224wGyu\315\233\243\2748\312{\222\274&\345-I^J\362\222\315\333\314\313\314\373"
+	.string	"\274\034]\256n\203L\255,\336\320T5\312d\307\305\276\373 \373\343\352\366B\036\366\273\330\324+\261\236\n\313\207\212\266Z\253\200\323E:Oo\316S\236\362u\312\323\353\366\267\373\345'E\245\"\340\225fh\244L\255\325\327:\376;o\247\313\341N\263\244d\363oo6\341\210WT\347\231M;\032\327\321\220\3019\343q1"
+	.ascii	"t\2650\362\t\340\206\213\342\315\342q\310%\214\323\232+\3411"
+	.ascii	"\005\223\272\253*n+-f\220F\265\326\203\235\255\256\202\314fS"
+	.ascii	"\255u\231x\345\342[\363\335\375\262\273K\2734Jk\265\326\002e"
+	.ascii	"Wr!\203\006\r\345)\331?\236\3620\026\371\n;\371\2452\327\007"
+	.ascii	"{\256k\214\215\374R\331\235\353\345a1x$O\262a\317\265NOO\345"
+	.ascii	"i7\202\255\"\220\337\316\265V\252\356\2545{\333\236U\265\002"
+	.ascii	"\217\2709\214\241U\361\231}s\277LX\006\310o'r#kv\326Z\017\354"
+	.ascii	"\307^\344\303\236\353t\241B\360\211\247\373\020\373\244I\304"
+	.ascii	"x3\303\004\310o\273\307 w\326\356\311\332X\273JIHG&\257Q\321"
+	.ascii	"\305\276=\222\227\210\344\035b^!\346\r2y\201L\336\037\223\327"
+	.ascii	"\007\307\333s\362\362\230\274;\314\253S\362\346P^\034\312{Cy"
+	.ascii	"mJ\336\032\312\313\0136\215\323\027v\025\365\215Q\333\264\211"
+	.ascii	"C\013\f\231\353,\3065\326\376\370\277 ;Sb&\365\222e\257\213\332"
+	.ascii	"jK\2245\375\033cl\313\340h\r\316Z\253\n\354\245|\212\203\007"
+	.ascii	"\020 \224\2475}\243\221\314L\030\220\337N^'u\232\342O\224\273"
+	.ascii	"\346\365\2055z\275\353\326\2722t\003\232\235\265\345Y\016\212"
+	.ascii	"\324;dg+\310\243\356\265\325\275>U\366v\214Q\251\3423/W\327H"
+	.ascii	"\274\366\023%\256u\235\303\241\005EX#\270\307Z+EQ\366\251\362"
+	.ascii	"\250{\210\023\035ch\270>j.\033\272\235]6\256/\344a\366\331\344"
+	.ascii	"N\246\"H\340\023%\224\247f\343\212\264\313\376\320-w\240\222"
+	.ascii	"l\332e\026!\220 \205/\231\032\240\265[\341f\026\220\002\036\240"
+	.ascii	":\364:1=IE9\371\234<\370F@m\020\341s\222*\341c\342\331(\022O"
+	.ascii	"R>\023QQR>\335\021x\2626\326\236"
+	.string	"l?\324\200\035\344\021\365\230\237}\250\211\232\313\304L)\205\261\320k\033\242Ec\331WX\357\204\372\313\232\371hy9QLP\353\264\020P\007ug\021\266\001\177\032\250\177\322\b\201\370\364N\3774\231\326\323>\375\036g\373y\235L\313\271\374|$X;\335\375\375\370\332\357\353\3342\341\007f@\253\326z\256\250\357\223\362\264\247O\266\025v\345X\242~B~b?\261\362\224\247\rl\025\225z\247\311\264\241[\0255\235\306`<\242\353\254e\034\323w\204gT\316\0017j\253\264\347\264T\021\357*X\300'\3464\210\031j\301\246Z\234V\272\351~\250a,\004\225R\206!\231\241 IA\241\325\220\002!\0213z\020pF\303IcC\344\003hI{\372$\320mC\254)c!\224\237p\303\333`\373\0247\001G<nZ\356\240\235[?\232\234\247QLE\345\237\030\206A\235\t\024B\376\240K.\244*"
+	.string	"G\224%mIXfKt\204c\340y\026\326\332\007#\317\276x\314\373\303\001\276=\204\374[`\345\227n\343@3\302(\311e\264G\347f\246::\004\224\365\\\f0\032)\273\r^\225Y\022\347eR\3710\347\026N\030\016D\003J\261n=D\304\243\255\305c\342\r\330,Q\031\022\215\354\2060\302\213,x\323~\264\253Y\372\272\302\021\236[\344\273E\261W\007\001bo\221\306\"\207\007\033 q\333\207,\016\307\013\233\362\200Yb\364\300~\0039@u\0306>?\334\262\277\366\330"
+	.ascii	"m\366!\313\360\240\234<i\317\037j[@\214RGo\376"
+	.text
+	.section	.gnu.lto_areSticksActive.159.fb5dcbd45bb43ae8,"e",@progbits
+	.string	"(\265/\375`\024\005m!"
+	.string	"6~\326G\240ZQ:\304wLW;h\004\007\261q_ \314\035\027#\214n\206\n~\273\346(9\250\025\271u\251\315\377\032\352\232\222k\343+\236\021\350\200\236\035\017^\234C\226<\342\202\213\312mo\203}\373\277\021B\bI;\311\307"
+	.string	"\257"
+	.string	"\304"
+	.string	"\216Z*W`\265\f7MOjj\255\nL\256\204\323\244\001\367\224&G\363\224&\275\373b\367E\3754\264\2575I\t\225Z\207\f\026\301i\022B\204\027K\344!\221#Z\223\223Q\321M\255C\333\207\354=\016\2751JdY\f\366r\265N\263$\307S\2425\f\313F\235\244\321A\217\306\204"
+	.string	"}\0306VP\222\244\210\277 \365\030/\345\244*\211\276\016\270x\354\240-\323\002\020 \017\237_\220t0!\345\240\246\354g4\032(\372"
+	.string	"\023\022\017Z\3360\351\372\335\3608>\230\372!G\366\2131\312\226\256z.\232\322\370\025\321[\312d\020#^\236\336"
+	.string	"\001\37205-\324Z\227\316\370\001\2753\357z\266\273\027vG\246{BG=\303\344ZW\232\374y\013\212G\263\026\213\222\023p|p\251\227\252\244\335E'XC\325\206X\246\210\302y\255\025\306\037\334\035\366\250m\034\035\231\261W\332\255\371\311\016\002*`\322\3751\351\022X\272>&\335"
+	.string	"f\342\355q\224\227v\272<\247\013\340twNW\347tg\247+;\335\330\351\302N\367u\272\256\323m\235\356y\272\346\351\226%]\362tG\222\356I\272t\244k\003&\234\216j\374l\344\252\326\243\2548\325\013i\005\211\231\330Q\246\273\3365q]d2\344\352\253.\224\232\240\324\324:\244p\032j-\265/\223\353%\036\276\b@?\233\330_\227\235"
+	.string	"\033\237\023\354\261\007Q\315\250\300\376\303\306\267\324\003\343\372\353\003\344\370\230\314\267\356\272"
+	.string	".\276\245\362\343[\367\301\022^\371\226z^j\255\347\203{~\274\201\230/\177\006\270\371\222\013\371\362\326\340*\016'\225\261x"
+	.ascii	"\021\"Di\222<\2032P\274\361\027^1\232\343a\255\325|pi\223\252"
+	.ascii	".\343\317\003\234\206)\306,\312\177G"
+	.string	"\354r78\314\242\244\377\355K\352\321\254\365\351\3070Fsx4k\203\253\2108k\255\023\326S\2462\342\206\303\225&\375\016;\256\336X\341\321\254\261,\341)*|\206\210\024\002\367)C\213h)\246!s\216\242\302M\310\324Z$a\375\304PL\254\205&\003\260\025\271\026#F\241\334\211\034\006!\024\270\333\016\227\301\304-'\264bgo\rp;\335\315v#aC\221\033q\302v\333\255\2605\350Y]\n\334\316&\244\323\355l\257!\317WZ+\361y\246i\213\223\251\330\232\250t\321-a\223\225\223\251\227MT\372\370|-\360\336\223=\2701'X\3557C\025\230\306\300\264\323#D3E\024\216\307Zk\215-0\355\265[\312\037\260\214\214\241f\324Ty\003{pk>\253.\256\002\2475\251B\323Z\017\2255\237\025\324\tt \237U\215r\301x\250\3549\215\240\367\374QX\260\210W\274\027\317\013"
+	.string	"\370\316yZ\344\230\035\300\203\330d\261\316w\306\317\256\363\032\2260\215\203\031\024q\313\354AD\341\230\226\354\001`\250a$\306\bt\310\214\005\"2a\n\222f\fp\002\241\261\3329\020P\307\210S\030\016\252^\257\247E\007\t\201Fn2\234*o\226E\306\r\035\210b\312\321\244\327\177,\362\375\320\310;\t\341\313(\203g\200\fM3\003P\003z\021v\222:E\304\003\037\355rP\260\232\300\351\342\207\321JO(\3243\246m!c\321\301%\211\304\301\034\020\b"
+	.ascii	"\367^\204.\216W\371\353\016\316\250$j\344\001`\346\336=\357\\"
+	.ascii	"TO\324nHav\300\177\224\363\360\324\203\333\354n0\252\b\355\002"
+	.ascii	"\215\032/Pn\304\2748\350\bJ^r_\332&@d\002=\317\354\350p-{2\237"
+	.ascii	"f\013F|q\302\362K\210\370\211\030\261.\026\325\311#\324\307c"
+	.ascii	"\235\260e\250"
+	.text
+	.section	.gnu.lto_runawayTakeoffTemporaryDisable.160.fb5dcbd45bb43ae8,"e",@progbits
+	.string	"(\265/\375`!"
+	.string	"\305\007"
+	.string	"R\01777Po\322\001 / \211\351\3635[\204C$\376Z\f\022\350D(TB\266\2725\344\260\007E\204\331\372\237@N\314,n\332:\254*\276J\240O\307\206m+eJ\001\021\227\247!\3638\\\237\316\203e\214\223m\032\0261\2108\321\271$\"\266}\"\207\300\032E\266\305\nM\333\242\365\355\265\344\215\n\225\022\351\310W\377;\311\205\377a\013P\276;\364A\232\303w/\242\033hR\257\003+&\027\222\312(W\366\027J\345\260\237Y-\331?\375\251\351C\001\221\023\357&\226\335\214U\314\246`\n\210\355[\2663m\205\005\356'\f\353\356\006\ne\367K0\302\346\320\234\335\362\317c\013BT$\023\230\335\215\332q\356\311\371\037y@\347\205\236"
+	.string	"\f\273\353\354<\215[o\373\300v\264]\022\t"
+	.ascii	"2\001gx\206q\361\324\f\3145|\177\bO\245\306\201;\267h\347\023"
+	.text
+	.section	.gnu.lto_calculateThrottlePercent.161.fb5dcbd45bb43ae8,"e",@progbits
+	.string	"(\265/\375`\003\006e$"
+	.string	":Ct\016F\220\332M:\204\030\020M\265\222\\? \344\352\373\226\234\300\351\310y\366I\256\275$\224\315#\025t\034\336\206"
+	.string	"\254\224\221:'-&\221D\002A\265\211\344\230\221i\300\t\354*,\367T\240fo;\b\241\335\322\226)\325"
+	.string	"\275"
+	.string	"\331"
+	.ascii	"\266q\232\207N\217\343\264(N\207\341t-\234>\235\236\265\351="
+	.ascii	"\200C#ck\207\250\251\225FY\247\202\241fC6\311z\225,\320\276y"
+	.ascii	"\305\216\231\301\257L\316\n\373\266tm\027^1\3376I\213\255dU\361"
+	.ascii	"\206\310\2355\265\002\235\226\232i\\j\004\t\\\270\212\b\306\013"
+	.ascii	"6;\"u\260\232\310\251\265\362\376c\2536\207\353\271\331xF1\244"
+	.ascii	"\265\317*\257\330@\202/\354K\326\326"
+	.string	"\213\315\341t\360\230=;\346m\255\270\326VkZS\005\316\236i\351\250\351h\b\311Z\261U\002\323\372M\036\245\221\013\307\024\305\006=jpm\210ENzv\333\2021k`\271\255\253\3713\255\034\265]\255u\305v\306\330\362\315)6\250\265zfm\325X\373\254\275\324\366\003\233~\005\034\346f\325\276e\320n\354\367D\370{\b\236\271\232t\3743wu;\204v\224\324\334\254\177\305\026\350\t\232\r0W\177a\261\214\320\207\036\302\361\241\262\306\022\316\013\335\223|\343\233\245\367\363\323\016\326\035\033j\231\200\030k\255\013\274K6(\302\033d\251IL\315\315Z\352\235\n\227\356\227KG9\307\314j\2266\3207\357e\357\313\262,}\037\266\247\r\360\236\234\2326\311\232I\234^\n\247\t\204\323JtzG\247\007\320i\001t:\211N#\215\323Gt\332\210N\027\321i\":\035\200N\017\321i\035\235\026\242\323"
+	.ascii	"\350t\020\235\006\242\323?t\332\207N\347\3504\216N\367\320\351"
+	.ascii	"\033\235\016HUJ\266\013\227\243o\226_\331\2341%eY\362\030\275"
+	.ascii	"\251\350D7:R\032\031\246\002\207\356E\177\352BrU\355\bp\242\317"
+	.ascii	".$\230o\226\001>\302w\304\311O\255u\324}\205\004\275\350~\324"
+	.ascii	"e\244\024\201\356\364Y\366\363\334\201\216\224\206\f\363\371"
+	.ascii	"\317\013\224m\223\365y\322\030\334s?J#\301l\3579\356a\032\362"
+	.ascii	"k\374\320{\036\324e$\016\371\345\013\357\345\241\337\336\013"
+	.ascii	"r\261}\374\3554\215\344\342\271\315\301j\211\220\205\347\313"
+	.ascii	"\004\310\230\370\361\013a\257D0[+\022&P\240\020.\025\277;~d\006"
+	.ascii	"\326Z\351\275l!\f\377!h\306\256\260S,\214\265^)\360\226\255\224"
+	.ascii	"\013\0302d\b\227\206g\361k2g\314j\226\265\326Z\273\027\224\255"
+	.ascii	"\375\203\320\324\255\206\320\336\020\016\001u\"\004\212\016S"
+	.ascii	"\274\022TSSTQF(\244zw\024\224T\217*\212\027\365\201WBD\207)^"
+	.ascii	"T\357\004\017Jg*\023R=\036\n*\252\036\357\006\264\332Z\275\017"
+	.ascii	"\207i$\216\367\220\r\231\320\351Bdnf\214M\017\335\024\261==G"
+	.ascii	"\366\005M\364\266\b\231\036\303"
+	.string	"\266\201\357\254\3563\323\r\\\364\205}\301\272S\253O\347\335\326\025\346\204l\303DgM\025\334\275\250\354\322S\004\317\234Y\b\263\364\325\372M9b(ia\272z\b<\305FY\002\237@4$6\320,!\273\335k\377\203AC\210M\351\275}\262J/a\004\300\237\376+\013\212q\342\264A\007pO\022\316\356A_\340.\231\215\211\202E\366f\300\005|\367\265C\206!\rxQ\032\371\265[6\351\002.\332A\372\320\223^\263C~\035=r\250a$\344\020s\312\214I \"\222$i\306\260\002\2211\"z\020`dT\2335\357\231y\3551p\261\002\242\346\230\254\201%\204\245\016\030\237\252\332\273cv\007\322\375`X\346\217>\231\035\257\345\345\021KOJ\376\"\261W\230\326\216\254\013\376\217\344\003!'\005\20470\251\"W\362sf\251\261c\201\004\226\372\201\205%\336\261\307K$x#u\034\340U\223"
+	.string	"\342\222\021\003\bm\t\303\177\202!\3761M\314Ko4\035\210\236\003\264\020\332F\210\301\r\357\350\345qR\243\315\203\300#\363A'*\240a\340\226\241g }"
+	.ascii	"zq\364%n\376\254\2135LC\005Un\337g~\215\320\253m\365\f^pU\363"
+	.ascii	"\207\b4\274\237M\244\214\n7>X;\303k+\r\212\342\236X(\321\210"
+	.ascii	"\363*\006\303\210}\355\205\033\265Q\372Qt*"
+	.text
+	.section	.gnu.lto_calculateThrottlePercentAbs.162.fb5dcbd45bb43ae8,"e",@progbits
+	.string	"(\265/\375`\035"
+	.string	"\235\007"
+	.string	"\202N56@S\323\0010\265\240\005\202D\205\224\225! \3756\300)\376\022F\003\017\372\301\3156\302\341|\020\320\244\230\246;\006\306\247\205\025\002\210D\232\324\217\3673\204H\231R\033\020i\253\343\301.+Z\022\261b\"\202\"Z\330E\354\030\370\262\360`\021\343\272\260X\201{\373z\357\023\215\b\244!OzE\200\361\260\001eh\200\26434\362\333\244\037\335\241\023\205T\263A-\225\304\376\264:b\377\273'M\237\032\2101\341\276\022\356\206\2047[\242\\P\376\335>\213?r\365\217\243`KK"
+	.string	"\222\322\251\310\354\256\302)s\004N\335\376\330\225\027\030>\316\016:\264\031Nw\362A\252\331\005\243\226<{f\376\275?\274x-\033\247=\003\032v\327\271q\"\267>\3016)\n"
+	.ascii	"2\003\3020YB\330\256\211\222\230 \272 _\212r\270\313\322lx\327"
+	.ascii	"\275\001"
+	.text
+	.section	.gnu.lto_isAirmodeActivated.164.fb5dcbd45bb43ae8,"e",@progbits
+	.string	"(\265/\375 \342E\006"
+	.string	"\302\213+2`M\222\016\300~\001\024P\344\256R{`\\\326\213\240"
+	.string	"\233\021\367j\254\265\033\353\343\330z\351\272]\001\300%\310\353\252@{\260\342\350\330\270\351\275e\nG\226\313$E-zh\022\020\016\021-\232(\232\305`i\3422\265\nI\232Z\005\313\242\347\360`\203\234\357\247\"\324\375\330\002s\255\n]L@\241\303\201\215\315e\217i\0169\276"
+	.string	"\211\236\377>$0\301\260z\235dv\262\224,\201H@\376\314WVX\310L\025\363\350\024\204|.FP2\261\206\035\245z\324\355\325\006\316\225U\226\246'\300\220\231_eit\354\237\360#\374\031\001\b"
+	.ascii	"2\003\316:#h\b\3055\2610\"/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_processRx.165.fb5dcbd45bb43ae8,"e",@progbits
+	.string	"(\265/\375`,\004\275\034"
+	.string	"\206\266\275F\220\236Mc\322\361c\342\221\036\255\344\274\320\331"
+	.string	"\335<Z\3213\005\250`B\265\227\"\241\330\374\273\221\240\275\225\2172\365\020\307\214\024'\001O)j\252\355 "
+	.string	"Iq\210\367(\306\322ZB\204j\303M\366\226R\246\024\255"
+	.string	"\233"
+	.string	"\254"
+	.string	"@Z\220*\242\2237\367\336\006\037\035\241\244\324\276\223W%\335*\206s\356\225RR\345\336\363\201\025\224\037\177\216#?\332\017 ?\332v\004\nI\356\375\034\342t\013Ri\312zs\357\231\253B\336{\215\226S\316\310\321V\332\363i@\245\327h\324i\b\244l\350xN\222\257\247\034\264\264\f\210V\332\374\353I\207\3059\0311\237\344\t\212\316\254\317\224\017\261\032\260\311\376t\361j\272\360\b\276\236\242(\211\343#\223\fjo\274Z\006=\274\334\020"
+	.string	"\\\262\2700A\320\\x:\003\370\243t\206\341\336kj\002m\334"
+	.string	"n\373\211m\020\266\305\005\246\321c]HT\336{o\332E/\350M\235z\341?\305\004\307K\214\270T\225\354\363G+\225\375Z,\026\313\\\247\334s\253\237\207\244\306}\353\276\221\324;\317\272m?o\035S\227\246\236\231\2324\3658R[\222\272\216\324\324R\337gA\234\037\030V\220\253\2229\257S\221\354z\215]G\276\365g\375\347\177uk\177h\357\360\372\200\022\300\254\206>\226\257\345Z\226\263\350\370~\\[\r1\3012D\017\345Gj'\371P.t\355\n\311\336\341\206\340\027$\367>]8\221~\226\316\033\246\251V\031q\fHQkV\251\334#\307\252Bx\346Fy\252m\342\004\2759\326"
+	.string	"LeHH\373\340[\264\340\252\255\362[\305\235\353\265\336\352\2012&&\277\253\327\372\341mdD\240|\343\251\374\265"
+	.ascii	"\2151 j\300l\245\252\266\035\034\013\212\tC\356\275\025\374\256"
+	.ascii	"_I\341\027\371\350 \235\316L\263Si\3607f+\316\213E[\335\251\004"
+	.ascii	"~c\264\326\374\356,\244N\265\325k\235\362\230\302\304\344G\213"
+	.ascii	"\277\021\263\007\230Z\251l\341;\362UHhf\211\216\331\227\362)"
+	.ascii	";\277\210W\f\321\233\037\375!\362\343k\211\2505K\240|\264\030"
+	.ascii	"A)\250\021\320nE\006\232\021P\320\021\213\335\206\035Q\020O\b"
+	.ascii	"\200\021\320\216h\210\304Q\213\035\217\007C\027\300:\b;^\221"
+	.ascii	".\247\023\312\265\030\n\"\312\351xF9\b8\027\271\330\361rGEE\274"
+	.ascii	"\\\355\364\335^K\353\251\027\276$\013\242\331\342\"\317\345e"
+	.ascii	"\235a\273\254\306\340\253?#\331{\245.\374\352'^\321\242\275\367"
+	.ascii	"\336\332\255\027\354\251\226\226\200\332\367\232\220v\257\252"
+	.ascii	"\367\344e\302\304\f\3748\247rf\225\347C}\r\244\315\241\003\275"
+	.ascii	"9\253'\206\271\361Z\252J\356\212\262\343\226\225\212\313I\003"
+	.ascii	"\364\347\376\003i\207\020Ao\222\365\30306^<#\200\350\003E\250"
+	.ascii	"q,C\r3\004\021\022\032\021\t\263\2400\035\240\"\031\243\365\020"
+	.ascii	"Xg\243i\226\003\016\242&Z\221\222\267\276\"\265\t\301(m+\207"
+	.ascii	"esY\330\0020]\3774\212\001\324A\013hB\225\262\311\005\007\017"
+	.ascii	"H\272\342K\2303\215\361\240\261\360'\0338,\373-B\252\t\313 u"
+	.ascii	"\373r\2202\210o\271\016\324\350R\344\365(\361\370\312\236^\236"
+	.ascii	"a\365y>\266\254$*\037#.\\\347\205-\307-\266#\bzBDC\314 \203L"
+	.ascii	"\217\034\265\372V<)\022R\214\374\214\370\242\257\345)hQ\001"
+	.text
+	.section	.gnu.lto_subTaskPidController.166.fb5dcbd45bb43ae8,"e",@progbits
+	.string	"(\265/\375`<\f59"
+	.string	"JaD\025D`\246N\007+8\254\257+\270\326\343\264>\372\305\243\226A\257\352{\251\246\002\257\027\260\201\345\263\265\376\331\215\234\233\331O\320\207\341>\033\270t|\203\222: a\202Bn\207r\226\3074\021\332D\356\235RJ\001C\001!\001H\001\276\353|\257s\232:\243\357\374\250\263\277sK\350#t`7\306\032\354\311\262`\317?\254]:\207\326m\335\314\335n\034d\346\266\027\315\216\261=CO\314\214<\226m\023\320)[\251\355\314M\245\327\326f\213\301?\226-\222\006\f\313\266\021`"
+	.ascii	"j\247\307\036\336N\321>\272\235\362\312|\207\350\305n\035\b\023"
+	.ascii	"(\t\247\307\262l\325\037\351\265\245\242\240\216\306\342\223"
+	.ascii	"S\023\323\022Q)i\210tdTD4$\024$\f\002\177\252\357\246\350\373"
+	.ascii	"\312\355\326?\245\330VKEq\331\342Pq}\214\323\342F.]\344\302\346"
+	.ascii	"Ok\355\204\006(S\223\243\357\302\326\320a\033#v\332\255\241\322"
+	.ascii	"\302\250x\023\023\324\222Z\323\211\276\007E\306\324ZI\n\232'"
+	.ascii	"M\031.AR\302\304\217\246\030!)j\2238\321\335\320]\230\220\264"
+	.ascii	"\2603\027*;\363\240\264\260 .\004\342\301\037\016\364\341\277"
+	.ascii	"*=\\M\013\253\202\036Y\226\355\27302\367\241\001\362\302\360"
+	.ascii	"\351\273\260*\350\020\214\2112\351wG\247_^\216\346\350G\rx\351"
+	.ascii	"\001\021\022\353B\205{\3117\355\326^C\f\351\356{\300\262,\273"
+	.ascii	"Rl\254\031@3;\021fn\300\f\314\020dH\177\322M(\361\373\017\255"
+	.ascii	"\\\363\252\317\314\004z\256B\325\031\313\262\013\270\301t\030"
+	.ascii	"\013\334J:\345\013\0300\334N/\034e\036\337\253\367\323\367}\177"
+	.ascii	"5A\372\223\245\376~\243\237>\021.\031\210\313\237\350_'\263\207"
+	.ascii	"]\372KF\240tR\366\005~H\351\344\206s\277\270R_\203\341\372\237"
+	.ascii	"D\227\177\016-\226f\222[\275?\263\206\r\336J>z\375\026sk\351"
+	.ascii	"8\027\035<x\270\235\372\003[8'Z\344\314!Dx+\013|\217\031\202"
+	.ascii	"\374\255f9`\330\206\374/9\355\253\333?\342\r\257\313\367\230"
+	.ascii	"\373\255\257\\q+a\254\022\336\312N\271K\334N\373\323\264.fek"
+	.ascii	"d\\\376dnC\372/\231\373\237\317\347\223\337\214\371\347\254\240"
+	.ascii	"\331\272\255\n\2743U\2675K\275s\224\317\031Ju>\246\316\306w."
+	.ascii	"\246\316O\251\263\323\317\271\351\347\314\364s^\n:\023\203\316"
+	.ascii	"JA\347\244\240\3630\350\214\024t>\002:\033\251\316E\2523\321"
+	.ascii	"\317yHu\026R\235\203Tg\341;\007Ug\340;\377|\316\352u\016\337"
+	.ascii	"B\351\211\357r\201\332O\003Z\305\214\177\274y\314\355T\211\214"
+	.ascii	"\223\261\314\2251J\372\026\303Oz\227\323\343/Ss\006t\237U\314"
+	.ascii	"\310g\370]\326\222i\332X2)\372%\177\351\035,3R\027\313rI!\275"
+	.ascii	"\326[\335\321#}\003\372\322\343\342\025\254\365\360\227\251\004"
+	.ascii	"yV\261b^\343Yq\350Xy\360\270\235\036}\003i\3078\331z\016\017"
+	.ascii	"\r\242\036\327\350\205q\254\202\254B\274\225F\177\325\234\333"
+	.ascii	"\220M4\303\033*\372g\262\022)\372^\303q]\310\b\021Q9Q\257\313"
+	.ascii	"\313\274\036Y[o%\3217\036\246\030\273\256:$[\320\324U\020\347"
+	.ascii	"\r\217\210\355\251;\364\n\342\264\2345\311\222\025\r\355v:\364"
+	.ascii	"0Z\272fj\244\216\025\241\320\033'BN`\2262^\301\240\273'A\277"
+	.ascii	"\240\375\322\004\376\322L\013\273\256\355\262V(k\2245\312\355"
+	.ascii	"T\370\013Z/N\262\337/\271W\265\033d^\233\255fUSY\266+\0017\232"
+	.ascii	"N\263\256\255U @\270\235\006\037D\353\245\311\306\345O\246[\223"
+	.ascii	"r\246f]\340\223(:s\004\t\336J\3407\0363\212\035\362\267\270\317"
+	.ascii	"\366\362\300\370\236.\325\267[\253wot\272\237\356\357\251\236"
+	.ascii	"=\031X'LdX\241%b\205\212\237\n\rX'LdX\201\002KK\213\305U\020"
+	.ascii	"_Qaie]U]\221\250BaB\304\211\252+-\025"
+	.string	"UTC\316J\201\245U\265\"+K\253*\330\306\325o\306\024\326\2068\363\270\036\211J\375r\331gG\242\242\334@\261\231\221^b\005\356\3061\212H\324\247h\3458\205\214\265r\244\354\t\264\344F\037#\224\007\001B\204;>\224\361\217\337I:\037\306\3578-Y1G\027\377\347\274<y\372eW\270\314<\300yTp\340;\372\312\331\036.\177v\2263sN\277dc_\335\342\267p\034\305O\321\302q\2225\375rF\213\265\217\366\215\336\236\001y|\230\"\370m\031}.\263\f\247\f?\315\374\003\301\217-\343\271\265\"=\216\351\247\311\211s\351\235>\315#\247\347MM\227\357\021\237\276F*\247\314\203\306\351u\214k\365O_\\\376\250\373*C\212ai(u\214\353\364]\344\r\317\277<\031\303kM&o\247N\337i\355\232&\031\223\305\221d\325\364\315\354\275&<G`;\206\277d\337j\246o\246"
+	.ascii	"\246w<f\035\203>d\220~\311C\275&\271K\337\342\215M\003\037\320"
+	.ascii	"\314k\215\325\206\267r\351=\fs\215]\327o\241easD\f\200\357\250"
+	.ascii	"a8D\025cfDDD\222$)4\006\260\002\021!\262j\003\021\320,\206,c"
+	.ascii	"5M\241>\315\001CaMR\366\026W\260\312\374\232\0248|\314<\352\217"
+	.ascii	"t\311\333%u\263;j\222\276\312\245\367&\261\265\n\232\020%C\232"
+	.ascii	"9>R\177}N\322s\376\252\216\300\031\336\306\245\231\206\363\340"
+	.ascii	"P\242m\251,\326\331\307<\304\006\204\251P.\006\236\240h\022\303"
+	.ascii	"\304)\373Y\262\247\304`\275\321\371\230*\241\007\231J\212"
+	.string	"eV\311\255\241\262[B!\215n*4|\203\356\312c\300m\310N\263J\006V\303\204\305\311\017\017lx\222G\350\002\266=x\276\232X\200/\204\006q\263\376\221\351{\241\330w]\177\007\313\375\356g\006\205\037\373h\364\3556w\336\370<\024\322\315\017P\206\255\221'U\302\212o\321\b\201\030\271\206\361\006\214`\177\177\324\0377\246ZQ\304\314\336\3272`\003\335\344\226\221\033\343\t\3063^\fjNf\bK\t\223rW\2238\330\341\252\225\004\277\030\343\365=\f+ET\327#\001z\252M\024\307\r\304\272\234\272\362\361C\tB\355F\241f\244#\305\274SW\371\226\337\300\326\301ly\230q\\\240ax\374\316\336\233A\211\022\307uwgi\321w\314)%I\211H\342R\372'\255\323\206S\232AB\232\371\021\310@\013\017\021\305g5\367\322\026\333\225\373\317\263NpY\177c\025REIB\374\303=\177"
+	.ascii	"\367\335$#FQ\334\300\344\222\b\373\325\314\\{z\326oB\233\270"
+	.ascii	":\272\330\351{\300\021\305P\211\214\035I\344g7\342\033\305\251"
+	.ascii	"\002\314\321\004\342\206b|\237\222S\037\021-\241\335\007\b\300"
+	.ascii	"\235\tl\270\243\377\277\206L\031\227\032"
+	.text
+	.section	.gnu.lto_subTaskPidSubprocesses.167.fb5dcbd45bb43ae8,"e",@progbits
+	.string	"(\265/\375`\211\003\255\030"
+	.string	"\006.\237G\260\230M:\200\035\017\032\356hb\245\317\367\220\247\371\360\351\331\313h\270\234^\013ZD\310\230\342+\317\243\265\355\323n` le7\303\320\004\021|\243\364\323:G\363\241\215\177\371\3574\364\007\204\326,\221\2667\2212\245\220"
+	.string	"|"
+	.string	"\212"
+	.string	"\273\005>"
+	.string	">\316<F>~\037 \037=\263\243dx&\315A\323\024\037%\2519\247k\207>{\213\265\nA\225\214\337\352\314WI\bq:\332[Ag\375)\027DS\224\243\241+\232\033?@\017\277\004U\220`\371S\016\350\213y\321\003\367\242\334\f\005\213r@4O9\031\252\212q\351\303\322\365h\004\240\343\371f\346\234=\372\301\370~\rx\244\202"
+	.string	"\350n_K\213\317\223#][\350l\252*\tsN+N\367s\277\334\266\223\355\b\366\302\002IP7\325b?\351DL\370<\214\023\323\343\036\375\230|\374z\330\221eJFM{\366\316\246+d\377\233\213\303\376\321/\003\363\335\335R\251YR\275\222\352P\252\301\250V\255Z\256:~\352\357S\357\247\326U\277@L\016#?\257Ae\316\027=.\223\027\223\370\370\356\267\177$\263l\357v>\177\346YH5EU\231s\247\340\321\f\300\253}!7\232\375h\205\3039o81\315\031D\276p%\030\3009o\017\374$o\312\340\363x\264\206\r\033\344c\\\004PG5\355)\370\0359\223\212\016\037>\310\307o\023(\315P\rP;\204\b=\316_\032\332\262r\205\374\245\357\036\013\270\373!]\347\234\264\270B&Pd\210\213\205\331"
+	.ascii	"8\243(\365wdk[\370*\244\356\210$)\002t\346;\322\266y\351q\272"
+	.ascii	"_\032\232\342\335\226\366\275\250]\342F\217\203Y\205\032\262"
+	.ascii	"\302\263-\315Q\230\216l\354\n9\336\204\374\216\b0\234\033\016"
+	.ascii	":2\033\235\2340\247\003\f\347\206\203\316\t\230L\226\342\365"
+	.ascii	"\342W\rL\026{\271^$\\'nlp\\/Y\216\253&\3061\0240\231K'\026\223"
+	.ascii	"\271X\273\332\027\207C\" \274\332\332Z\254\265]s\247\231\221"
+	.ascii	"K\307\234\023\202\317\344MfC&P\240 \037%\024\334\225\325\262"
+	.ascii	"\302\005w\265\357\371a\323\236[\033\356U\013\256\214\222O\227"
+	.ascii	"\232\366T{'6lK;K\351rI,\221\013\202\310\310\324\312\200\312\254"
+	.ascii	"]\301\002Q\f\336\315J\214\202\350\b\217A\306}D\250a,\303\234"
+	.ascii	"aJ\261@$\220h\264)l\003\240\002!)\273\003\020H\307\210\346\030"
+	.ascii	"3\275\272\356\360 \322\2272/v\\\033D\273\360\357\003kh\327\331"
+	.ascii	"c\001\246\341\253R\214\245\224\270\003\355=\364J\256\202\306"
+	.ascii	"D\201:My4\332\"\254\343\325 \347\301\360\020H\320J\231R\236\201"
+	.ascii	"\023Lc8\306;'%W\324$\271\2311\330',\244\356f\"\223\013\272\342"
+	.ascii	"\352\360A\016\0344\2013\273\335\214\216HN\261B2\002\370\213u"
+	.ascii	"\205\255\366h\377\263\006\304)_\374\001"
+	.text
+	.section	.gnu.lto_subTaskTelemetryPollSensors.168.fb5dcbd45bb43ae8,"e",@progbits
+	.string	"(\265/\375`\017\001m\r"
+	.string	"\246\331\\D\020\221\223\016;U\031\"\005\200v\206\265\317\261v\334(h4?\344[G\317}\031\323\036\265pW\314\013\332`\361W\236-\237I\305,$\b\020\016\n\004E"
+	.string	"\371\323I#\221#f<5\327\265\355-eJ\001H"
+	.string	"D"
+	.string	"L"
+	.string	"\321\300?\233Gx\002\233G\227l\031\377V\266#\265\201$\306\306\356Z\252\362\322\241f\311?\352\235\356$r\210\341\n\023\320\244\2501\3404\002?&,\335Q\317\013'.\023\300\202\335uv\247\223;\3366\003\333\r\354\177\004)vLs`:\336\345\2070\375\316\347C\214\223{X\355\232\254p\254*\252h\321\274}\377\3450 \377\354\341\245F\354\256\347\321\006\261=\217\367\330~\332/q\023\245\273\204\270\263\313\241\305\314\356\247\300\b8\017*NE\276RC3\243\"JP\377\330p\024%\203\3672\003\206\213\221\254qT\216v\320 \311q\205\032\3650?\300\322R\242\202\"\004\367\023\217\t\361A\330\302(\337=\372\243\315\343\325\303K\221@1\345\312\376\270\324\016\366\341\356\2565\226"
+	.string	"\302\262\020\311\022iY\246]\005F\017\260,\344\200$\302\266\215\302%\300\027\b\333\264\313\272\"X\242\020\204\314\272\266\221\005\372X\233\200m\026I\3236\313\363\231\016WS\334\361^\250L\312A\2502\025\274\02574\004H;\323\362\235/\343\261\b\025"
+	.ascii	"q\224\301\231\320w\024#\303`\254\337\033\204FXY\036\374,\301"
+	.ascii	",4\270\261\013i\033\307\254\265\263Z\300\242\026q\027\334\203"
+	.ascii	"2A\254\232\026'y\252+\247\024j\017"
+	.text
+	.section	.gnu.lto_subTaskMotorUpdate.169.fb5dcbd45bb43ae8,"e",@progbits
+	.string	"(\265/\375`\267\004\r\036"
+	.string	"66\275I\240\330M:\221\007\370\022\334\256sk\304\337\227#\031C\315=\202\347\200+M\rn\347[8\330\023&\365c\310\366-\332c3\234\260{\354\323m\364\340\343\272\001\337\343\306\013^F\323\303\336\233\365\341\212\266\021B\310&R&\031\246"
+	.string	"\231"
+	.string	"\253"
+	.string	"H\036\224\247\177\325\316v7x\364\312T\357\"L8\365Uk\020\301\351*(\317\273\237\372\020\335\251V\254Y+\016\256\254Z\203\t\226@y\352\363\235\361T<m<]\335.\230"
+	.ascii	"Iu\307@\030\244\207\025Vk\265\265\216\353.3Kr\244b\263n\377\252"
+	.ascii	"\233\247ow\331\214\233\307\2624\343\307\307\222\f.\177p0\375"
+	.ascii	"N\212\007\276\236\2109\226\245\237\270\243\304\343\354\361\330"
+	.ascii	"t\332b\346KbQ\346kz\213\013\222\302j\330\370X\2104b\275,\257"
+	.ascii	":\303\360\361\230I\b\265\326\345\323\307\364\235}w\243v\367\302"
+	.ascii	"\256\330#?k\375\253\353x=\231\031\362z\267[\262\250n\364o\343"
+	.ascii	"[\204\225\027\013\026\333\275\221\037\271\355\241\026G\202\177"
+	.ascii	"\236\356I\214\247o\352C\030\306\306\220\037\022\237\331\r\356"
+	.ascii	"\270\235v/\326\316\261{\252\337\347V\337\236\032\317\203_\032"
+	.ascii	"\311\253S\362\346\224\2748%\357\315\310kCykf\27442\336\031\345"
+	.ascii	"\225\231\274&\311[\226\274d\311;\216\274\264\344\025I\336\036"
+	.ascii	"y\231\362\276\300\201bJ1\230\016\354\252U\351L\231:\244P\242"
+	.ascii	"nu\221\037|\357~\367E\366WV*^\f\205\001\374s}\222z\267\262\236"
+	.ascii	"u\202\336\330V\370\360\326`\337U\302BYk=\324\320x*"
+	.string	"k\223\n\211\312\253\fa\310\220a<5\373SO_\244F\236f/ \r(Z\303#\224\276\352\003\300\242\374\350_T\325\025\261\326R\316\364\244e\314\257\354\335\005z\024!\013O0\262\313\261\305&\373\264\307~o\fIK\003m\363'6\315\tj\2537\326\335\344O6\334\354\250\265:\330;yV\207=\324\351z\370\360\341+<\301z\272[\206\005\345\2447\306]\353\236n\254\026=x_r&G)@\200\030O\271?\345)\213T\016\357\206\b\342\270!!\016AF%p\022prAFEfQ\007\334\220\020\007#\023\270\\\016\305\255fo@\270\034\321\315v\033a3!\0244d\273\345\212l@;Kt\002\227\263\031\021\021\345l\263`\275X;\307\232@2C\244\346\311t\276l\260y\031\265\344\264\016N\337t\016\255ql\372\246\003`\331\364\273n\360zw\223\3535=\202KM\323\"[_@\f"
+	.string	"\265\206\274\336\225\004\244tB\236\004(\344;\304\276\262\310vZ"
+	.ascii	"J\270\254P\236+\235[M\304\375\321\370\253\277I\311\026\230\256"
+	.ascii	"5\255a\354\n\2154-\302\252\313\017\357\352\210D\340\2374\375"
+	.ascii	"$@)\001<k\237\336\235@!`\250a$\006\025c\n\215\214\004\221\202"
+	.ascii	"\264 m\220\002\031)+\017\020X\210f\233t\333\213\372\243S\206"
+	.ascii	"\350\321R\324\255\211\244B\361C*\307\005\364\020\242\215Oq\277"
+	.ascii	"\260\251[\207n\312\230\333\235\312\265V\335-2^\321\306#\254\336"
+	.ascii	"KH\304\340X\006\277\3438\343I\275\367\244D\351G1*\323m\2601\347"
+	.ascii	":\274+ \212\266\372|T\323N\316#`JrW\306\334v\214\0207\360\223"
+	.ascii	"\370\305\026\246\361@\350\237\215\244\347\023y\244\245\2063\214"
+	.ascii	"$\372+\3217\n\322l?g\204\333\3548A\026\005\016s\322Q\266'm\311"
+	.ascii	"\334\032\317\322j\306iqu\374a=\034\rE`\252aj\210\225@\2447\362"
+	.ascii	"w\345\240\377D_@\215\236\377"
+	.text
+	.section	.gnu.lto_subTaskRcCommand.170.fb5dcbd45bb43ae8,"e",@progbits
+	.string	"(\265/\375`\236\002M\024"
+	.string	"v#\200I\260\226Q:4#_\257\326\240\0223\261\324\t\200J\274\205\226|\300a\224C\006\320sNp\245\376\234\362\242}\253\207\365\r\007\226e*\273\322|\003p@\235\303;\357\320\354qT[kC\353\214\351\3166\032!{o)e\nm"
+	.string	"_"
+	.string	"j"
+	.ascii	"\362\261\377H\200\235\226-\360\361\263\0355\351n\026\267\320"
+	.ascii	"\230\246\244Bp\312\310\033\273\202/\251[N\246)\006~t=\232\212"
+	.ascii	",MO\266\002@>Nt\b\207bC\035\302\361,8m+\343j\310\n#+\271\021"
+	.ascii	"1A\n\247\023\252\334\316FU\256\266L\004\327\023Y\272[m\350\222"
+	.ascii	"\310\321v\301\227\356\376\336r:\275J\377\363\376+\370WE2~\210"
+	.ascii	"\251\274\241\027U\333'O\355\377\372\260zSV\245\235\317\023\215"
+	.ascii	"e?\217\266\034\364k\354\356>\003\375s\017\316\375\214{)\3671"
+	.ascii	"\356\231\367\273{UY\025)\241S\"\244n\023?(\375$}2T\377u\177\255"
+	.ascii	"\241E15\022\361T\367\217\216\035\335\274\226\037\bU\262\350j"
+	.ascii	"\252\214\n`j\314\344=\212\210\\H\016\322\2309YY\364\242\376\n"
+	.ascii	"\272\024\203Cs\310\\\230\231\231*'+\217\320\022\r\243\331\376"
+	.ascii	"4r\320%3/\214\236\220\332>yd\211A\2252\204\3355\006W$M\322@\323"
+	.ascii	"j\261\036A\031-3\253-\312l\177.z\344\n\273\273\301\265\2477:"
+	.ascii	"\\c\250|\215\215\274\332"
+	.string	"L\225\313-P\276\331\376t\273;92\256\233\032\013:8.\030\fDK\345-\027\027\354\325b\2658\260pjhnX-X\016\313e\365\227\007\027\214\245\363z\301X*\336Lc3\320S; O3\246=@\260\373\021S\b\354\017!\302\352\355\252\264c\032\340\223\t\245\302uZ\342\200)\tR\270\"uNJ\336\204dF\0200f\202\254C=(\t\312\203I}\023(\300\300L\225 \353\357\005'\371\340\226\246\200> \220\002\231A\353\006CC\347L\f\3470\356\222{\312\013\222\213`?\344\324w\0037\3351\021\341\036\357\307\0241\215DP\2664Y\270cHH\003\277\312\213\261k\323\034\023\223\376\367\254\264\306\305\340\201\264\345L6\260\rY\211m\361\354\022\326\253\346\303\032n\375)\336d\332\032\352\267fcK\253Z\273j\261\317k\300\206@\274\246\030.\371\200\030\233y\275\346v\204-\220\"\224V"
+	.ascii	"\330\273\250c\326R\217\330+\003"
+	.text
+	.section	.gnu.lto_taskGyroSample.171.fb5dcbd45bb43ae8,"e",@progbits
+	.string	"(\265/\375`\031\001\205\f"
+	.string	"v\027SA\020q\233\016<\256r\260\b\354^B"
+	.string	"\310\332\243\316\b\260\001\320\373z\n\334"
+	.string	"=\005.,\221\260-\241\247f\236\270\250\247\275\201\241\212#("
+	.string	"\252J\277\016R\001o\200H\236\006\215\226\354-eJ\001>"
+	.string	"<"
+	.string	"B"
+	.string	"\227\350\021^@\364\350\314~q\357\303\016`\001\262`\222\262\273\223zxv\250\231\371\025\215\304u\332a\206k\200\316\003bv\367$\317\013\335\226Y\321\354\256\223\353@\356x\333\tl#\260\257!\252\331\236\226*b\037\356\356ZC\354L\307L\303Lk\2463\323\267\\`\244"
+	.string	"\371\210o\027\303gcC\361$\204\305\366\323>\211\227\310>R\301\322n\007\222\025\273\336\001\027\340x\304<Vt\242\363AI\231\341\311/wWS\023\210T\035\224\270\360\310\032N\275\252\376\343d3\341\244J\276\211\227X>\bG\300\362\334\243\217E\217\327\217|PDl\360\344\347\230\366\004\ny\316\006@2B[\330\202\212\263Q\320\351\250\256K\002\005\300T\246\272,j\242\036L\035\233\006\234\211\272\260)s\261\005\241\272\246\216e]\223\305\333k\210%\320\215\220G7GUq.\306oEP\243\376\203\303\226\237Q@e\360iA\003\252H\033"
+	.ascii	"3\001\2078\244\361\002Ap\225\342\301)\253\300\022R\271.fA\312"
+	.ascii	"\354\220\252\021V\026\006\216\320\220\217\025Yf1p\007\004\343"
+	.ascii	"9\016\215\272\333\300\254KX\304j4p\227\200\001\213*\267]E\017"
+	.text
+	.section	.gnu.lto_gyroFilterReady.172.fb5dcbd45bb43ae8,"e",@progbits
+	.string	"(\265/\375`\206"
+	.string	"\035\n"
+	.string	"\306\222E@0\251(\0350\304\207=\225\330\250\204\321\334~e\206r\276^\206\306e\253\233\244/\205i\357\357,\2545\202\375\t\032\323\214\213G\023\207\037\0262X,\2405\302\2302]E\247SZ\023\262\245L)3"
+	.string	"0"
+	.string	"5"
+	.string	"\bP\016P\330\r5\005p\357Q\323\363\277\307\f\001\017\034@H"
+	.string	"\252\\\035@O\234\330\335\243\236!\360\223\271\200\331]'\b\034\335\330mk\330\246\260\377\020v\370\245\232\354\307\335]k\311v:fZ3\235\231~\366\023I\2242:\201\325\256\350\345\332\006\030\353d\233c[lq\301\261\027a\362I\300h\005\035\365D5\345\356~*\221\251v\030\210\360\311\nN\275\252\376\204\345\t5\251\rO\275"
+	.string	"\211?\300%\233<\350\230\277\311\216]\217z\305\004\006\001H\251\225N\276\002\336.\231\216\333\264\315C\013\371\340"
+	.string	"\321\266N\243] \314\211d:m\204\343:\315\022\356\343j\311\033\013T*\365\275\354\2503\270Z\nT\253\374\275,j\310vTc\002\020"
+	.ascii	"Q\204>\316\206\267\307\0167Z\345! \307\004\006y\2401\236\330"
+	.ascii	"E\251\241\3175\273\r\221\307]GU\r\244\016mm)\003"
+	.text
+	.section	.gnu.lto_pidLoopReady.173.fb5dcbd45bb43ae8,"e",@progbits
+	.string	"(\265/\375`\226"
+	.string	"\245\n"
+	.string	"\366SJB \213*\035\007\002T\200\021\001\371\240\207\207*\301*@\353Z\nh'\037\302\002\311!H*\2537\226\re\033\325\213X\202\333\354\354q\002\002\242\2007\331\212U\"W3\305G\351\365\274!D\266\224)\0059"
+	.string	"5"
+	.string	"8"
+	.string	"\020"
+	.string	"8\3100\247\270\355\201\177\227\253\237\357\271\324@\02030\241\025\016\370JL+|\020\021\202$\004\203\330\202\247\256\243\020T\255d\346\234VQX\272\265\333\336\260]a\237\"*\002\037\235\331\242G\367d_\3165\331Vk\252\226\252^U\253\252_9jE\nP\272j\234\2234\223M\t\332\013e\273c[\214\301\350\370\2338\361\\\310\030\003'WP\200A\300\256I\356nG\003\n \325`\213\353\312}h\003\2503\353~w\037z\201\342F\367\341\252\257J\374\0046\341\350E\327|\016\345\332\367\251_\224`\026\n\004\346.\032\257\3436\316c\023\371\340\b\3318o\263]$\334\215h\274\215\244\353\274\315\"\316\257\311 #\214\345R\377\243<u\007\331\030\201\345\332\377\243h;\262\255\2553\237\005\345\006\017"
+	.ascii	"S\b8VG1\330\272<ZT\316\b\002R@\273<\361\210R\243\270&\276b\241"
+	.ascii	"\333\020y\334uT\325Pt)("
+	.text
+	.section	.gnu.lto_taskFiltering.174.fb5dcbd45bb43ae8,"e",@progbits
+	.string	"(\265/\375`\017"
+	.string	"E\007"
+	.string	"\222\31633`m3\006"
+	.string	"\255\207\020X9\303\024D\342\242\030\242j\203\016\273q\365\353\235\204\036\266\n\244c#\245 'H\t\210\242=\270\276\202\251\314\233h[J\231R\234\206J\223a\350l\2529#(\201R\230jZ\224\244\036\344&\343\240\221\324\344H\314T\013\242\232\262cYS^\270;\036\202*i%\241\nh\321\370\036l%&\236\263\"h]\350\002b-\207=\270\321:\376\177!\250\365f\2778\245x|\274u\177\306\212\312C\021\211vi\353\327\372\303 \2277\212J\277\3066\362s\t=\bpT\340\311\342(z\300\342\250W{b\256\343\004\235\t\206\b\312\177\t9|\371]\265C,e\036\314\017`\341\177_\346\371\270\320m\r\332*\264\325\002\b"
+	.ascii	"2\241g/0p\341\035\314\273\004@\254\246\200\273\274h'\031"
+	.text
+	.section	.gnu.lto_taskMainPidLoop.175.fb5dcbd45bb43ae8,"e",@progbits
+	.string	"(\265/\375`j\002]\022"
+	.string	"\026\342vH\320\322(\035\2130\225!\030\310\350\211#3\213z\007\370Z_\345U\227\354\204\f"
+	.string	"7\006,\207\030\371\036\374\250\237=h\244\370\013\300)\227^t\314\371\207N)/b\376@9\"\372A\2019\020\034\335\267d\357-eJ\001c"
+	.string	"W"
+	.string	"c"
+	.ascii	"6\021>\315\251\002hhN\334\002#0=\036x\211|\204'\221\217v\331"
+	.ascii	"A\216\333\231\005t\030\311|\214\346\234\336\256\270\353\235\214"
+	.ascii	"p\325\345\377\366\3237{\2753\231\270\224\241f4\032e3\nK|a\203"
+	.ascii	"\031\243\023\001f1(\202$\363\361\333u\304\f\246\332A\230sZ\277"
+	.ascii	"\231\315m\272\355\020\266\031\330\332\"D1E\262\017\3431V>\315"
+	.ascii	"\254\027\375\367\350\277\310\307\257\006\332O\317\215\214.\331"
+	.ascii	"\270\227\256\216}8\347\234\336\034\373\266\177D\325\250\250\016"
+	.ascii	"\221\352\223\252\273\250\226P\035\241\032B\365\256ZU}\223\327"
+	.ascii	"l5$l~\023\232\263f)i\346b\r\026(\333W\373.\376\302\365\035\202"
+	.ascii	"\272\305@\243qd\241\206\302\223\341\265\024$:\262\366\006\016"
+	.ascii	"\372\317"
+	.string	"\tj(r\261}A\271\266\025\034(\305\333\231s>\360\177>C\305\247=:\245R\311G\371\343+\212+\341\356\306=\r\017L\227<\262p\257\273k\342#S\022Q\233\305\203\376\323}\017\034\330\276n C6\234]\035\307\257\344wEF0(\252\025\313\205\230\026U\253\365!\005\300\251\023U\213\225\362R+^\013\213\312\312K\265`\274\223\022\263\\T-/\206\305jy(\334\374\346\370T\273\345d\026\326\031P;\202\204\335\327\005$\361\330!\205\216Z\0209P\353B\013:\272\t\271\221\342\300\306\277\242\323\206l\207C\246D@\007|\202\264)T\320\177\247\355\210j=\271X\374W\262\3331 \320\002!!\262\003\203\200\221d\310\035l{_\324\305AK$\264t\342S\302L\021\274\254e\017G!\322&\343b\276\2622\374\312\266\3556\210kB\013\362\311\f#\3635\326\317=\264\r\273\226\023(\032\240\271"
+	.ascii	"\234;\257a\341\205\013\243\212f\007mq\300\356(\023^\b\304~J\240"
+	.ascii	"#\345\232\274\340\344dw{;\2018\246h\025\n"
+	.text
+	.section	.gnu.lto_isFlipOverAfterCrashActive.176.fb5dcbd45bb43ae8,"e",@progbits
+	.string	"(\265/\375 \342U\006"
+	.string	"\302\013,3@o\222\016\230\016\303\213K\307\020pES\322\013G@\023\317\231+\006J\363\355f\257\320\n\n\230}e\212\342\251\017\300\227\2020\351\303\210j\244\355\357-SS\230\214UQ\215rh\021\017\r\020\215\262&\032\206\340J\"c5\212\252\262\332\224e1th\320A\213/IK\256\033r\205\346\212U\272\032\200J\207\002\033\235\033}\3069\344\370^\022C\377}X"
+	.string	"\222\001\252\b%\3233j\311\025\351D\344\337\374t\202\302\346\253\231\207g \345\003\303\204%3k\330\321\253w\335\216\224\341B\244\202}8\275\200\205\314\374\260\017\250c\177\204\377\340\327\b\b"
+	.ascii	"2\003\316:#h\b\3055\2610\"/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_getLastDisarmTimeUs.177.fb5dcbd45bb43ae8,"e",@progbits
+	.string	"(\265/\375 \360\245\006"
+	.string	"\242\214.4Pm\222\016$\243\252,(:\267\274\351\317\202\377\366\307\256\202Z5\375\305\315\356vx\255\340F\020\266\020U\225\004Q\003\267\200+\247\f\332\020F7K\266L\001O\230LEMoZx\016\f\n\ro\252 \036\3062\365\220\251^\004EU\257\242e\335\007\335\345r\023_\217j\326\005-\241\301b\215\256Fj\204.\300\342\302\3555\016:\214/%\335\347\307\321\r\204@\236\206l\231\025\333I\226D#\032\377\346+w\243\034\233\255\204\316\225\031\220\204(>L2\265w\251EjD\251\200\324\310e\324*Z\267\035E\350\210\200`\031\247\bp\220\231#\226y\272\353_\360\023\374\027\001\b"
+	.ascii	"2\003\316:#h\b\3055\2617\"g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_isTryingToArm.178.fb5dcbd45bb43ae8,"e",@progbits
+	.string	"(\265/\375 \366\255\006"
+	.string	"\302L.4Pm\222\016$\223\203\310\002F\353\240\202\013D\211\020\215\306J\352\376\367\375\331\267\1777h]|#\b\013\3064\262\210\242\373R\033\001\031\002\236\032\323\354&2\005?\313\245\242\236{\017N\002\302!\302\275\212\302Y\b\246&.\225\253\240\250\312U\260,\202\020\r4\2709\241E\304r\262M9\332q\310\335\330\342\254\365\352t\317"
+	.string	":\025\005.4\255\364X\246a\350KI\004\375ml\355R\nD\037\237\222H2;\245\223\034\231@D?\346++,`\266\212it\006DF\034\017\223L\314aF\2556\353v\324\206\020\251\344\362d\332\002\0302\363vy>\035\373#\374\007?F\t"
+	.ascii	"2\001'8#\217c\261\250\360\\\303SF\274%\004\tw\316\324\316'"
+	.text
+	.section	.gnu.lto_resetTryingToArm.179.fb5dcbd45bb43ae8,"e",@progbits
+	.string	"(\265/\375 \3445\006"
+	.string	"bK+4`k\323\001\320\272\317\220\030j\361\177\265\213\332\317\343\353\272\032h\300\026\250B\220\306\203\343\272Vo4\271\005\016 0\340\320\254p,\363\242\020\022\263\366\367N)\236\322T\351\224s#\0018\232\216\234U@J\023\323\200\251\312\001J\253\214\270}\324 \007\004\317\212\005\276\334\217\270\2041\374\315\004\356\340\257?\276\273\310\237\314\246\361\320a\301\317\346*\030\023\354Cvw\0355;R\0326\262WX\354\036|\037\353=\027\f\266\037\231\2629\316-l%\203\302`\302cweT8uH\371\2078ta\325\241\004\263\273\206\027\226\335\361\026\333Y\b"
+	.ascii	"3\001\0078\003V|\241]\306\277\214\013.\335\230\255\355:-"
+	.text
+	.section	.gnu.lto_isLaunchControlActive.180.fb5dcbd45bb43ae8,"e",@progbits
+	.string	"(\265/\375 \365\245\006"
+	.string	"\242L.4Pm\222\016\244\004\212\210\205v\335\013f\267$\006\331\3551.\3607\366g\337\376\3352\324Z\301\215 ,\030c\306\"\212\356[\001\202)\200\237\325Z\373\233\310\024\277\214\306\252\236{\f\356\241a\301\301=+\302e\004\256 4\226\223\250*\313a\262\354\210\004\037\004\335n,E\304\206L\240~\024ds7\236\340\264b\245.\307R\252\bP\361i\247\317<\r1\276\225\304\213\277\215\255\335\312@\007\005\251#'\231\242SJ\226P&\216\277\363\230\017\020:_\3154D\001$\245P\bJf\3460\243W\333u\353Q\005\223\222\b6\362\264]\0222\363\206\215H\035\373\033\374\005\277E\t"
+	.ascii	"2\003\3020S\270\033\241,qML\031A\226\0209\3349S;\237"
+	.text
+	.section	.gnu.lto_updateArmingStatus.part.0.295.fb5dcbd45bb43ae8,"e",@progbits
+	.string	"(\265/\375`\247\022\025N"
+	.string	"\032w\374\032>0bR\007\247\217\300\324M\321gF\342\t*\3247\2638\255\363\347a\301*\251Ec\356\036/\260\377\n@\n"
+	.string	"\214#\204\036\241\377\177\307\227\273\335\377\377\337\335\275\222\255\031I\333{\313\224R\251\001w\001\242\001\257\230\0263\240\303\303\230\365U\314\300\324\303\230U\241\361\305CL\370%\352%\3061\037\230\277\235utl\016\337k\004D\342(\335v\254\216n\245\322_\377\322\335:\256=\355\026\344|RbG\263D\215Lb\034\307P\177s\024\237:\204\007\016\0320X\240 \001\202\003\006\n\020\020\033 "
+	.string	"\032\026"
+	.string	""
+	.string	"\330\227W\027\327\226V\026\326\225U\025\325\224T\024\324\223S\023\323sI)\t\351\310\310\331d.\225I\344\321\b\277n\376\346\233\266\033#\\\t2c]Cs\b[\177\340`\2217XT\364\f\026$R|\0050"
+	.string	"\365\272\310\261%\362\004\332\304G\240=\374\003ZAo\3000\320\027"
+	.string	"\364\004\002\271\230\341\237\037`X\370\002\332\323\b\035\212\207\360\303\360\334\371"
+	.ascii	"v\034\200\235:\017\266&\321\340\177\t\272\227 \235\357\342\232"
+	.ascii	"\343[l\326\274\326\237g\375\371=\326U\262\216\312 965n\225\006"
+	.ascii	"\315W\2459\363Tj\300\374\224\324\236Ga\365\036\352\351\213;y"
+	.ascii	"\351\362ML\306:\037\203\344\330\362\374y\305\312/]\321s\255\362"
+	.ascii	"JIT\034\251n\312\037\031\321\271S\317U\212[\205u+\273k\3347\215"
+	.ascii	"\021\344\330\340\234i\265\264\323sU\362\312%I>\351\341o\216\236"
+	.ascii	"V\216m\211#\335\376\250\347\372fwE\362F\273\353\233[\025\307"
+	.ascii	"\261\227Q{\330\355\256pB\326x\374\373\326\265\"\356*\327\252"
+	.ascii	"\237\335/\3046\207\232k;\334\245!V\254\216\365\377\261F\375G"
+	.ascii	"\362\3463F\210\343\270\215\234\364\360\226\340\335nZw\377\350"
+	.ascii	"n\n\to\206s\027\031\036vn~\263\253-\352\326\340\331\r\3078\256"
+	.ascii	"\036h\277\343x8\264S\361\267;|x\267~\200\375u\263\373)\334K\373"
+	.ascii	"m/}w\b\021\357\326\234\341/L\\\212\"\"\233\234\347\272\273\013"
+	.ascii	"\376,\3553\254\276b\273\261w\301\236?\273\206\324\220P\177\333"
+	.ascii	"H\337]\342\304\273\325\263Y\021,ZDjF\373<\3279\202\347\355v\273"
+	.ascii	"\330\371I\267\373\375\345~{\271\337]\314o.\346\367\026\363[\313"
+	.ascii	"\375\316"
+	.string	"R~c%\277\257\226\337V\356w\225\373M\245\374\236J~K-\277\243\334o(\367\373\311\375vr\277\233\334o\246\345\367s\371\275\344~+\271\337I\3567\222\363\373\310\3756r\277\235\315\357\246\373\315t\277\227\356\267\322\375N:\031o\244\373}T~\033\231\3370\363\373]~\273\312\357\254\374\376\344\267\233\005 t\302\305\361\220\255\242\230\311\353\346\212\223q\027\343\376\347\236\306\347\304\310\3211\234\370P\003\f\214\326\350h\223\007sj\340\350h\032\021\250=v\270~h\b\365\022\343*\037X\273\36176\232F\356\261#M\356\212\217\036\217@\250\277\315\347K\260\277GO\202\3755v{\327p6\375\340\016\213\rg\323aw\204pz\355g\324\370\232?\2772\2772\303\354\2054h\312\320\224y\370\303\247\300\371|\257\275\317\313\264\222\314\2301S~\204zybG\017MA\232\362\323UK\2166\213\211\212)\333"
+	.ascii	"\203E\213X\305:\342\317:\324?#\200W\201t\264\252\b\306VR\360"
+	.ascii	"3\251\330W\350R\360R~\346~5$\324g\373\266\351\220\265i\333\264"
+	.ascii	"\r\366w)C(\034\364\206\246\244J)\273\334\017q\245\254\024(\207"
+	.ascii	"*)K\243\212$\345'\234lu\n\310\236T\325\227l\024\322\021\244\374"
+	.ascii	"\314\203\372\036O\273'\243\3008\247<\327{|\352\006\037ei\337"
+	.ascii	"\035\261%\323\270w\353Q~*iz\352\323H\256\023cf\016\323\007\266"
+	.ascii	"e\253\031M\312\323(\273!\224Q\326\301d\311\331\304\231\235F\326"
+	.ascii	"\224\026\025\263UO\212\021!\371\324\t\334\f\020eJ\367nm\346\244"
+	.ascii	"BY\352Q\242'\33512j\276\031t'3Kafv\254\273\2207t\262\325m\023"
+	.ascii	"\231\013\275[\ni\231\216\350\335\026\260Gv\207\f\227K\027\344"
+	.ascii	"\313\354G\230T\013\324\221\223S\346\271v@\216\314P(\204\342\362"
+	.ascii	"\314\035J\036\275B\235\322\033<\244[\032A\2442\373\242>\257o"
+	.ascii	"\237^\201\273\247Y\246Z\336\255\312\254\325\246\005\n\021O\360"
+	.ascii	"h\006#3\205\354\r\007\233\027\305\230\314\257\370\347.\2319@"
+	.ascii	"\321\203\303\"I\373-\0362{\031O6q\003\324\"\302y\316\217\037"
+	.ascii	"\261\276{\372e\212}\267\036\263\231\033\026-b{\031\334"
+	.string	"\316\307\373\224\265S\351)\030\t\022`\177\221O\366\344\025\312\357\324\273\261W\200\273-`x\267v\323\2156[E\220=\324\342\3469c\316y\331\247\017\017\234\215FB\3578p\315\"lE\013\0252\242cP\315\"\254\006\214\250\224LFt\354\304\2304**5\263\220L\001\203\214,*e\001\"\2054*cE\213&\016\017)n\240`\001\277\030C1\001\207\007\262\250\005\262\0326\\0{,,\2054:\006\035S\001\225\321\002E\f\350\230\264\0064l\251\2433RH\241d\321\250\024\252t7\316OF\264\311\246e*\004?g\207\313A\354\203\302\263C.\0162\004:;\034\324\362q\034\2435\370\312\322\257\301,1\203=\037t#0\207mn\201W\366=\257\0345x$[u%\200\206\300(0\202\"\262\244K\304\226\240+;\224\256\374L\322\206 \3175\230s=\035\027'[Y+s\021\241.9P"
+	.string	"\200;\235\234=10\337\312\312.w6(++\t.f\251\006\260\262OYt\225\261\362\273x\225\231\004\021e\251\005\336\212[\025\236\021\372<.\217wf\350\f\321\231\366L\013\373k\225\221}\354t\331K\373-\201'V~8\021\253\312>e\251*{\0279W-bu@\236\353\207\202y\262J\02556a"
+	.string	"\\+\377\240\312_w\207}\206\023\276*\366\263E\270\373l;E{\267R\345\247\223\023k\021\001\005\004\261\346\035\202\016\372Tv(}\205\316\303-\236\255w\301Ry*\277R\271\004\023j\330\0068*{\335\341Q\277\312\327=\225\351\216\251\332\324\207\017\330\337\250L\342\016\013\0346@\363=\001*\tb\001@e\227\203\312\276\306\275\310[\227l\025\354\351);\337\360\276\004\263x9\375p\312\316\267\270,\265+\316\237\214p\305\202m[\001\201\230\250q<g\0253\"\"\"\222$\005)\f\007q\005\304 \307\2404\017\021\240 \0061cD\222\244\220\341\302="
+	.ascii	"\314F\002\222\207d\322\340\353i\227\223\253k\234\\\241\323\032"
+	.ascii	"\017q\350\234\276$8\005wPw\032E\203\256|\354\217C\366\224\f\216"
+	.ascii	"`\006\340\275t\f\312\3539T]\344\374rZd&\215o\3573S\355\206\330"
+	.ascii	"\275\2077\261\332\3768\027\305\240\037\036?\306\313]\020\201"
+	.ascii	"\001\366\330\205\221\027\022\374[\034V\335\005\246\311\3533~"
+	.ascii	"\302C\366\343b\026)\017\232w2H\230\261\353\006o\330\032\262Y"
+	.ascii	"\355>\2039\321\305\313\222tN\034\236\202\031\351\264lB\205\b"
+	.ascii	"\334\021\352;f\3342\343*$\r\224U\303\3529\252\272\362N3J\351"
+	.ascii	"ae\001\013\336\343'a\006\223\r\363G\374\272F\204m1.\260Z-\311"
+	.ascii	"]2\222\214\250\221;C\343\220E\027\273K}\253\277\376\2248.\345"
+	.ascii	"w\023\021\211\236\326U"
+	.string	"m\203\333\035\002s\030\360h\203\245/\325\306Z+\272\221\222\007\230\223\032.8t\360%\235\2758\002yp\032\200J\231HZ\236\343\244\327\020\032\360\025\365\206\034C@\214\344Bk\017\312|\336N'\265\350\231\2245\373\322\246G\243\033\356\354:\t\272H\f\036e\034\220t\005\342\022j\214\365%\301T\277o\271\214\004\267\bO\263\351\013\373\202\"z\016\336\371\355\006EPi\370c\321\325]2\031\031\363CTR_\316\322$\026A``\335\n\247\016\244;\344\032}L/\247&\037\322\322'Z\2066\241<\245\235\261\326\241\022\204[\207\251g\263`\021\032\265\205\272\355#(\205\270\277\306\377@\256[I\220\2200\201&\321\361\325|}\220[\344\3703\270\244j\265\311\204\r\306\2613,\312\277\325\325"
+	.string	"TSg\201Z\2161\307"
+	.string	"\013\204T\347\027\262,8d\0230J\373Q\022G\212R~\024!\243/\336Or\336\247!dd\250ZX\034C\212\243\376\376\023\032\016\223\212\024\305\245\234\212t\034\021\212q\036\377Q\304\020\2704\022\n\240z\341\030\b\332\325;\272\372\361P`F\201ir\356\260BH&\340\003hepZY\200zes\333\004\326\207\250z\016\305\307\312\323\016\252H\315\241\220O\265B6e\243o\324\2368@i\367\016icH\005y!\305{\263P\341\026f\373\316\326\357E\tl\271\n\220?G\240\257\375\253$*\211*\224\270\335HE/\267>;\205\270wU\220\017\312\t\314\017\031\353+\035\234\025\021\020\254Z]MY\253\367k4\257\324\306\217\020y\254"
+	.ascii	"S\215'B1!\314j\233\003\021\"\002B]\273\207\314\330\337\353\224"
+	.ascii	"`@\2305\336\301\253pA\251\"v\310\030X.\315A\250c\226\272\002"
+	.ascii	"\337\024\205\234\036|\316]m\211\302$\033\326\301\342)/4\003!"
+	.ascii	"\326\257\324i\034\020*"
+	.text
+	.section	.gnu.lto_disarm.part.0.297.fb5dcbd45bb43ae8,"e",@progbits
+	.string	"(\265/\375`#\002\215\022"
+	.string	"6\342xH\340\360&\035\330\300\030U<\017\354\310\242D\254\373\377}\274,\340\325\305\260\201x\207\207+\213\314~A\f\200\374G\327K2h\241\234\037*\313\262\342X\007\363`\177\301\030/\274\316\243<\\r6\213\306i\215\354\275eJ\001_"
+	.string	"e"
+	.string	"c"
+	.string	"\266\3350\301\247\017\240>C\016\322}\312\017\350>S\237\377\261\335\222\331e/=\364\331#\275\240)\312\355\256\367\031=\334\365)\243v.\377\264s\304f2\237\0353\016\227\032\233mx\224\bpI3<f0\tR\003\"v\243\253\206\331KU\300\273S\311\356\032us\237n\333\304v\003['\004\362h\311\006\224[X8b\024?z\261K\201\320\307\246\343\006G\305\212\334n\350}:D]\350\322\276G\213\227\233p\252Cm\304\356\246\374\332\207|\243\"\"\030\313\036\344\027\021\301\204\300\302\235\335&\027\002\345ve#\250O\365\203Z>\315)\241\326\303\030e\26037#\237V\265O\342%\\\017c\314\261\273\203\024\366\355\"\335\243Fy\203\006\347\245M\016\240\366\247\212\037J,n"
+	.ascii	"\324\216\200\242\217y%CD\r\334+\312\330O\351|\333\223R\374\017"
+	.ascii	"V\001\365\261O\0374\272\236\b\322\311\001\2121\243M\032{\034"
+	.ascii	"\273\313\335]G\036\373\244\326N\375\016\357\347#g\267\246\311"
+	.ascii	"\306\352\314\024!^\273\312\220Zv)ye\300\020\226@r\001<IQ}\024"
+	.ascii	"N\f|-\337\202\226\225\225\205\025\307\n\310\362\255X\235U$+\026"
+	.ascii	"\250\362T\020\274\025\224O\305S\261X<\022\020\203\025V,\257\005"
+	.ascii	"\004Y^\312\266^n\344\241\035\245D\3436\023_\023F\356\356(x\355"
+	.ascii	"\307\321$\001\2257\351l\007\017<\224`\334`Q\306\361\367a\302"
+	.ascii	"\331b\354\261-\322id\r\271\200)S/ @\002\202,\254c\264\360U\321"
+	.ascii	" \235\004\334u\334t\1777E\333k\326h\205e*n\337\274z\206[N\\\324"
+	.ascii	"\357\035\212Z\353\265;9\330\013{\202a\237\005%\206\321\204Q\304"
+	.ascii	"\330\303\240\346\364\005\257k\345\346$\307<\202\025\264o\016"
+	.ascii	"\224ha\r\215\214\313\337qg\245l\247-h\270\254Y@\224\027y\247"
+	.ascii	"6M\013t\257Uc"
+	.text
+	.section	.gnu.lto_handleInflightCalibrationStickPosition.part.0.299.fb5dcbd45bb43ae8,"e",@progbits
+	.string	"(\265/\375`\032"
+	.string	"\375\006"
+	.string	"rL-3Pm\222\016$\203\260L9\207\310Q\024\227\374#\310"
+	.string	"\367\n\243?\356\035\340aw\303\252\326w#\b[\210\252\252\210j\326\002Q\305\f\316~\374\204l\"SO\230LEMoJx\f\n\b\013o\252\034\036f`\252!S\275\007\212\252\236\364\263\266\304\316\227\021H4\201\024\210\236\3371\251\020\226\217\220`\275\356\311hCT\201\033\206\236\261\265%v\036\333\307$\200#\363bE%;\\\t\3107\244yI\252k\310\257\301\330z\224\216|$\301G\304\202$%3_\035z\324*\262f\335\213\263)6Tvq2\312\004\332"
+	.string	"\0162\363\213Fw\375\r\376\202\037\024\020"
+	.ascii	"=\023\030\0278G\021\007\210\202a\256p\032&.\316\210E\235\323"
+	.ascii	"i\241\315\224\235\006\200k\317\005u\314v\236P\306"
+	.text
+	.section	.gnu.lto_taskMainPidLoop.part.0.325.fb5dcbd45bb43ae8,"e",@progbits
+	.string	"(\265/\375`\261"
+	.string	"\375\n"
+	.string	"\246TJ@ \213*\035O(\226 "
+	.string	"\352D\340\250\260M\376\3716\220uH/\3150\020\244\365\004h\365\267\030\303"
+	.string	"JuBn\225P\204\360\f\020\331\271\307:\003\214\324=!\222i\2103\322,!{\313\235R5"
+	.string	"9"
+	.string	"8"
+	.string	"\223\317\247l{\006\030\2641<<\355D\005\230\250\005\333\335\355S\027\034\274F\t\372g]2\"}\256\016$\002\217\021\227\032\307\356:R\340\236\267\215a\373\302\376F\273\002b\0326\301\234\320\340\253\333w\340\361Y\236\254<\017;\261cA\006\\\273\241\305\247c\264\377\340*\360a\307\222]\005\022\\\273a\345\323\025\221O\212S\262Oy\211\3543\032~\353\020"
+	.string	"\370\f>\215\361\246\357e\237\032\205Q\206k\324\2136\200b\314Z\2645\234\370\321U\273\200J\275B\372\211j\262\312\313\325\222-\243\243F?\223\026\020@\034\b\232\217\016s\361\330d\272\357\343p\017\346,\335\347q\033\027\262e. \230\215\3734\233\205b/@\367m\033\317\373\266\311\345j\311\022\224\352\005\322\220\252\311vT\333\225G\270d\234v7\025"
+	.ascii	"Gc\034\255\300x\340\373\002\275\243\302\013\202\003D\3010W\270"
+	.ascii	"\275&\262\036\035\205`\313\363vQ\355t.h\323e\347\002\300\311"
+	.ascii	"\213y\247\245\351'\2241"
+	.text
+	.section	.gnu.lto_tryArm.part.0.331.fb5dcbd45bb43ae8,"e",@progbits
+	.string	"(\265/\375`\006\b\025-"
+	.string	"\032L\320\020Gp\334Q:5\002\256\234\r%\242\346\343\"\\a\371\305K\346\003\240\377B\223\247\177\022\352\307[\023\253\377\030\235u\031Q\342\227\332\016\263\240H\270\227\230y]\ni\274\201\0358%\372\346\002\025\255\317\332o\204\220-\223\f\364"
+	.string	"\351"
+	.string	"\372"
+	.ascii	"e\274\2432\3066v0>\331\226\250ky\301F,\317\262^\313\013\002\304"
+	.ascii	"\260{l\241\347\313\227\333\275a\f\2162\002\335Q\002/J\217\236"
+	.ascii	"\037J\317d\206q0\016\300\204\343W\271X\214\2031\n\206$\006\177"
+	.ascii	"\312\303f\034\214\255T\231\232\345\327\275wF\312gF1\253\352\321"
+	.ascii	"Ka\346(#\257\314r\036\266u\357\205Yu\305\355\336\373;j\215|="
+	.ascii	"\320\217\317\247\247\362v\272\\\212\236\266\203V\276\324\201"
+	.ascii	"\230/\220\205\334\372\217\317'\207D\244I\2349YH \357u\031}\264"
+	.ascii	"\372\243\313\210\325\2744\306e\217\336\025\310B*\257KcT\236\354"
+	.ascii	"\005\272\214\311\316u\361\310\343i\025U\243\347\202e\332\225"
+	.ascii	"\017\315\2208\247\357H<\t\334{\325\343T\333sA\323\354\216z\254"
+	.ascii	":\213\254\224\024O\366\316q\034v\013=(\207t\357\345\013\271\316"
+	.ascii	"Bg~\002f\0062\347\202\0017sk\033\214\250\231C\210\350\027\255"
+	.ascii	"=\224 \337\302\323\374b\255\0263\273H\333\006\305\336\020\033"
+	.ascii	"\017\363\313<\315\005\037\t\223(\321/\226H\217\266\265fV\340"
+	.ascii	"\226\314\244\260\343\370\247\231\201K\375\342\355\311\316C\223"
+	.ascii	"'\310[sh\245\332j\261\r\372y-\021f^s\021\257\231\210\327<\224"
+	.ascii	"k\026\3525\007\251\315@j\363\217\332\354\3235\373\360\232{j\263"
+	.ascii	"\312k\346\361\232w\271f\035\2579\307kNw\315\250\256\371\3145"
+	.ascii	"\333\\s\177\313\371G\247\223#?\313{\255\342\340n\020\024\314"
+	.ascii	"\222o\371\301\274\001\204m!\215c\242\370\tiHc\352,\313\303\366"
+	.ascii	"\345v\211a\f\320.\006\006?Y\032SB!\024\264\310\250\226\277\243"
+	.ascii	"\034\246\373\020\363\371`\302\260j\026u3V\2770\332/\362\276\006"
+	.ascii	"\021'X\315{\357\003]\2272~\2204\023@\366D\243Z\016\315\336\206"
+	.ascii	"\274\3672+ \336+<\340\263?\366T]>\326g\001\330\241j\366\254\217"
+	.ascii	"}\325\036a\307-\271\236\265\211\356^b\004~\236\303\255N\370H"
+	.ascii	"\216\362\372d\205\262BI\217\366,\004.0\253Z!1\034c\250\232\302"
+	.ascii	"\216[\243\210\310\262\246T\033Z\251\035\317\355\274Q\272\263"
+	.ascii	"<;;\013\225\\\023\245u:\003-\340+3e^\247T\350\027u\366lk:\324"
+	.ascii	"\210V"
+	.string	"\212\0074\363\005\f\375\"\237\354\2771\306C\355\255\311\340\315wy\002$\233\255\345W[\316\312y\221\316o\224\2466g_u5\3548\346\2779\234\244\f\032\370\032\322\243\251\035\221L{\313Y\255oH\333\270\265I\340r\273\244\337\220\242\366YkW\263\201\203\007\017\351Q\324>\231<\2132\247\207\324\017\324j5\370i{E\304\334\250\035\r\243\201\3403>K\217\236\366gn\354\371\214\351\265u\006\254\342\350i\205S\020\252\311\tX\002\030\024\320\344\364\244\264\324\341\304\322\n\023JOL\026R41\261\b*\021=\201Xb\301\364\001\252i)\030|\001\364a\340\321R\320\t\370\003\242\37051)\261\370\001\203O\277\243\"vj\261\024\374A99\005\177*3\367\221\204v\b\364c\210Tb\361j\345\261\246z(\307\334\332\204+W\232\\\271\252\326$\3121\257\266\00150\2609\376\240g[\253\243F\364\001"
+	.ascii	"\246\251\021\333F\222\355\312gB\247_qX\255\307\316\262F\206,"
+	.ascii	"\216\021\037=\253\305\347\223\322\"\333o\304\316\360\252\243"
+	.ascii	"s$\351\356\275\021\270o4\216u\007\217U\251L\217\026Y\bn\326\300"
+	.ascii	"\311\241C5J\211vY}\243t\310\022Y\356\252d\323H\302\032\2622\222"
+	.ascii	"v\336\306LY1\341\t9\350\337\257@\204\254C\372E!4-\fS\324z\310"
+	.ascii	"hF\256\222r\274\332\202,\367m\251\225k=\262&I\222\002\331 \333"
+	.ascii	"hTg\254j"
+	.string	"\003\200\267\250\201$%\025c\212dD$I\n\222\306p\002\021\262\262n\021\260\261\204'\205\264\031\nWu#\245\274\207^\211\223\237\t\23354\204\201\321\230\021\036\255(\326\227\211M&/\353\353\302m#\342(\247\262z\002\212\2777Z\377\251\357\250\"\323F\310\212a\251\024\330\356\2666\302F\305:\322\nR^\253|^\341\305\245\342\233\353z\330MFz\"\021\"8\353\320\0373v\240Z\2643f*\266\372H\360 (\001h=\307%\230l\336y\342\275\024=\007\346\322d)\246\333\003j\252\267\351,\002A\277C;\246)qa\024\035\tK\372\"\017\3159\370\3224\311\206\233\353\241\2656#j\272\324n\303Vy\203\300\f=\366C\246+\004\267\001.\330\201\345\001\246\320)\206>\204b`\217\317\360%\337{\307\353\027'N\322\006\221r4\005\bI9\0349\354\336j\"\224z\372\253\002\206lP\203R"
+	.string	"\326;4\331w\374\205\\\312\343\37302X\200\0223\306\252\035\315Z\354\017\t\306\334[\"\301\200\334\375\301\210"
+	.ascii	"u\031\003?aJKj\307H\306\242\273\220\341\213\351\030\2256j\310"
+	.ascii	"N\213w\0251*\3151\236+N\217\263\b\036\235\013\312\006&2\253x"
+	.ascii	"W\017\243\330\013\363\315\362\031\345\344\204q\344N\020'\263"
+	.ascii	"l\266\371\317\302@\005"
+	.text
+	.section	.gnu.lto_processRx.part.0.339.fb5dcbd45bb43ae8,"e",@progbits
+	.string	"(\265/\375`\n;\225\345"
+	.string	"\312VQLI\020\020\207i\215\001\357\212P\025lX\n\0254%\350\376\031\371\336\325\0178M\007\324\217%B\020f\025"
+	.ascii	"\304\213t\254\220\366\334\177\304\202\377\247\301\376\035\t\352"
+	.ascii	"_[m\235\226\214|U\324\367\364t\r\b\006\265\375]\bI)\245\242\004"
+	.ascii	"H\004\340\004X\260\254 \026\306\036\332\233Y\026O\347q\003\366"
+	.ascii	"\036>\376\371\251\231\230\276\231\345\351a\222\207\357\220\236"
+	.ascii	"7^)\030\263<\025\202\332\270\377\370\350\307w\305\367\355\265"
+	.ascii	"\222\312\bCK!\210\257\373\230\217\354d\307\211\371H\247\353p"
+	.ascii	"\357\361\361\neg\307\214j6\207\373\312G\250\326{*\276_o3\360"
+	.ascii	"D\330\031\265F!\b\212\371\330F\026\322y\214\241i\007\033\325"
+	.ascii	"y\374k}W\252\331\b\235\307\307&\237,\325,\203\037Ku\036\023U"
+	.ascii	"\323\244@5\333\300\335\306\204\033\256\3254]\273\320w\355\246"
+	.ascii	"\361\370\230\206\t\033\2236l\246\330L\365\333\365\266\023l\031"
+	.ascii	"\024l\227]\235\221:#B{o\331\266\232[sd\315\021\240=\270\267\""
+	.ascii	"rqH\030\351\031\207\344\350\324\303\362\350\267vcr\2731\221\232"
+	.ascii	"j\357\226\033\226}S\233@\311\315\326i\370\330B\222\342\373"
+	.string	"\326@\0319`\336\227\313\006\232$HO\265W*\024v\2065\313\276\357\273\324F~\021\304\357\255\306\244\323\226\024\325^)\027\2773\367Y\243);m\tcx\337*Y\335\373\252\271h#\243\bj#R\203p\333Xl\017n\033\231\373\f\277\210\301\204\353}\325\232\230\231_\304P2\263\325\304\266>\224\231\303J\223}_\265\2466\276\n\315\354\216\322^\335\325\322\346\352\255\206\322Z\375\244\263:\332N\272Ic\365UC\373\331\316\266\352f\277\274\345D\376\303\210|\310\206\254\345,\027\262\037\356\303\204<\310\202\034\310X\346\303{\030\220\365p\036\306\303\177\354\307w\270\217\371\330\016\357q\035\246\303W\326\3439,\207\3430\034~\201\337p\036\343\261\033\276\3436\314\206]`;\256c:\236\3435\254\206\3458\216\341\370\215\335\270\215\323p\013\314\306hx\215\325l$\200@\215\003\f(\200\306\f\0311\b\200\361b"
+	.ascii	"\001\232\230\\\264Xb\021\300\n%\025)P\2340\221\204t\2244**\201"
+	.ascii	"$1BD\b\020\037<t\340\260\201hHC\206\243\020\206  \327X|o)L\356"
+	.ascii	"fw\024\240\033\034Z\330\035\272u\351\366\342\322\335\305E\272"
+	.ascii	"e\005o.\261\356-1,\336P\304\250\336Z\323\356'`S\357,(\030\364"
+	.ascii	"\212w\324\211\021\311\316\314j\245\273\211\225*\336XP+\320/\357"
+	.ascii	"\253-\350\226\226\367\023\372\004\n\305\333\t}\002\315\362\266"
+	.ascii	"\362*P+\320\250w\323\352\244\373\205:\t\261-\302\200f\301\212"
+	.ascii	"\252\316m1\203!\226\035h"
+	.string	"\023\347\304?\211\315\210\177\020\235\017\017\233\r\017\r\235\265\207Z\347la\266\331Ov\217s\037>\200\316\204\203z\232\005\365\340q\016\314\363\347\214=\344\243\347\347\274gN3\340\0349\316z\346\304q\316\203\007N\363\337\013o\234\375\356\3445\367\345\3159\363\321\255q\266C\247\306yO\256\271\316\t\271f:p\315W\2707g\2754\3479qr\316\320\234\343\2305\3039\343\374\202\231\031\3477e\315yed\316x_\232\335|\001\253:\2758\337\265a3\306\305\331\005\273\025\2668\327\321\215aq\236[Slqv\005\213.J5l\254Y\315\024\314Ynz\3059\216j\305\031N\254\212\363\333\227\263\333\226s\033\024\3474!\212\252N-\347\026BT\235O\234\331\272\024\247T\235Y\316h>\254\261Z\210\2523ZTu6q\033[O\300I\242#P\214R\r\213v\rD?\240\250\352\214\036\272\001\177\f\275"
+	.string	"\032Y\237\301\247e\360\301\333\3431\b\320\352q\030y\372E\036<>\200\266\005\320\032\372y\223^3\325\341\322\023\3035\307]\374\311\361\026@7\226\3404\0138m\370\202\007\020\247W\304\311s%\272VA7\347)\3264\2125.U\343'\344\332\204\\\234'\3019\322\233\037\245y\362\215\021\232\027\235\231y\t\277z\2034s\306I\210\341*3\354\244:\\g|\004\231\213\370\342!\2748\b\3001\377"
+	.string	"\330\305="
+	.ascii	"r\361\016\0346\254\320DbX|\250\210\004\347\212u\224\002\026m"
+	.ascii	"\213\341\242\272\206-S\317P\207kK\343u\222\030.0?\002\335\020"
+	.ascii	"J\252v]i\fW\304pU\361\240\"\b:azXP\343Di1\\_\016t\224b\271[\207"
+	.ascii	"\313J\021\351}\337+7zT*\245\213\307!\351\323\277\310\002k\347"
+	.ascii	"gH\n-\202\330\362\022m\274\366,\251\323\275C\267\024\240\033"
+	.ascii	"\357\373\362\006\353XsOi\346c\032\346\24623]\tu\206\320\264\373"
+	.ascii	"\237\310\005\215[\033\r\307\367:lx\350\216\357\342\357\313\361"
+	.ascii	"\240[[2L\271\377#\240pAap\357\357\351\206\307\267\252\001Z\343"
+	.ascii	"\313B5#|.h\334\350\204\336\352\262\2779\034\323\311\204B\335"
+	.ascii	"66\027\330\\\226\220\0055\216\027\206\267\262\320\033\237\212"
+	.ascii	"M\217\231\211\345mF\202\336\367)\203\275\005O\303t\302\335\245"
+	.ascii	"\215\314\314bji\271m\024\372&\0036W\206f\345\3336gdZ\202\336"
+	.ascii	"\332L)\256\373\217\366\315\333\355\366\017\220\221\213\001\203"
+	.ascii	"`\267\221\033\364\030\236\035\353\313\351[fG\3634\034[L\251\364"
+	.ascii	"\231\266|Y\371v\273\335\032\272d\032\350\177x\001}\343u?q\363"
+	.ascii	"\002\243\305"
+	.string	"\262\233\3613L)\334]\230I\205Y\305;\312\254\342\266\321\375\356k%\301\276+\365\354\253\370\306O\362]\031Z\371\226_8w\035\346\224\211\305;Z\374\336k\016k\332\n_-\266)\214i\365\216\376\033\375\004\247W\3477U`\216\255\020\254ru\032\227\2700\307\336\004\245\\g\\\371\210)2]\177\337\303\206g\20533\3030\307xG\375;-\213\363\233\374\335b\206X5\377V\3460S\324z\211\333\377M;*\260\315y\272!\247\360~ff\031f\231w\224\033\257\205\332\266X-\366\371M\177+\177K\351\337n\267}\370S`\326z\222\025u\322\004\351\334XE\316}\005}:\331\271\255\330\271\233\354\334/\322\231\211t^\262\263\222\235O@:3ag\023\330y\t;+IrN\222\344\\\002;#9r\256:r>\222\344L\225\344l\204\235I`\347)v.\202t\226B:\023A:\217\300\316"
+	.string	"Hr\216Jr\036\222\344,$\3119H\2775C\2613\220$\347\247$\347\037\354\354\304\316\"\260\263\017\023\316!\260s\017v\346\301\316 \260\363\007Ig\017\330\271\003v\346 \351\274A\322y\007;\353Hr\316\221\344\254\001;\343`\347\f\330\031\003v\276"
+	.string	"\351l\001\322\271\202\226k\246"
+	.string	"\311y\002$g\t\212\234#@:C\300\316\017 \235\035(\341\334"
+	.string	"\tg\006\220\316\013\224pV"
+	.string	"\351|\003\351l\003\351\234\300\2213\002I\347\032I\347\003\222\316\006$\235\013@:\3238r\236\221t\226\221t\216\201t& \351\f#\351\374\"\351<@\322Y\200\244sS\322\231\251\310\331E\221s\213\245\2443\213\244s"
+	.ascii	"I\347\025Ig%\025\316\325\234\"\351\214\"\351|\302\310\331\204"
+	.ascii	"\221s\222\2213\222\221\363\221\221s\322\310\331\210\235\213\334"
+	.ascii	"\252\271D\2213\262\310\231D\221\363\b\2076\213`\347\020\354\f"
+	.ascii	"\202\235?\260\263\007v\356\300\316\034\220\316\033\220\316D"
+	.ascii	"H\347!\244\263\206\022\316\031\330\371\210t\026B:c@:\007\261"
+	.ascii	"3\020\tgw\204s\261\3334?;{\253u\267\243P\264C$\242\276\357\326"
+	.ascii	"\026\361\315bt\341K\273\351\276\353n\323m\327=\327-\327\375\326"
+	.ascii	"\r\330\255\247{\260[\260[\333\016m\267j\347j\377j0\314\342\373"
+	.ascii	"\005\375=3\254\031\231\0233G@\237O\215\237\031\231\027\306\201"
+	.ascii	"\324T\023\333b\034n\230\031\254Y\327\351.9\204p\016\030a[V\002"
+	.ascii	"\260\205\357z0\337\t\361\235Q\251\323\262C\313\216(\336!\303"
+	.ascii	"m:e\016s\275\317\267\312b\322w\311\007')\252\211IK\230\343e\330"
+	.ascii	"\324\306,\034\214\300\034$`\225\363\342\362\021jb]\\S&\354A\361"
+	.ascii	"\375R\023\353\3520\263\247\332\022_q0)\366\340\233@\255P8\300"
+	.ascii	"\371\245\313\n\253\005%\231\233}J\347\261W\341\343\227Sq*\326"
+	.ascii	"h6O\0277\230\251\032\262\366\343^\336\305:\246s\376D\312\305"
+	.ascii	"\304\267@"
+	.string	"`-\207\242\364-\020\220\254\324^\256#\333\0335\263,\234\2406n\360\366\340\272\023\217\366p,.*\374\352\301\034\345X\334$\346o\037\262;\375\212\217\320\347\323H\361\375\252Q\006\b&.\310\255\274i\304\233F\206\366\346\260e\205\314\211u\323\273\254\237F\364\321\207\334\036\232\200\330BC>j\263\314,3l.o\005>\372`>\006\0166a\3756\235Kh\b76\327\021\210+X@\246\017\326\024\352\232,!\023\367^fi-\267\334\317\220\205\353\023(K\254\202\267\362\216\357w?ls\002\227,\245\313\265\035o\003\304\031\031\005H\\\n\336\270F\270\207\204\345\302\004\306&a\232\332\226U\002\035O\345\245\343\245\302E\360Vn%7G\037\333\337\206\267\225\\\r>\307\343\371< HYR\241\342\266Q\203?\201\332\366\3175R\bp|\020\034T\\'VPx \003\2447\003)\327\016c\244\214q"
+	.string	"\003\f\276\375\f\275\032\270\340\2038`_\360}5\2242`A\005o\301^\005\317c\272\325~M\360\024\274\363]\315\261k\302\256\025\022\374\004\021\274\004O\342\356\n\013\301G\360]\345\257?\347\365\226W\246K,X\3346B\360\035g\272-C[\340\205\216SH\266F\2017_\323>C^R0s\343\201\317\340e\312\225z\031f]\252\340\035}\340],Y\236\337\264\341x\355\300\226\277\363\343"
+	.string	"\233\006\276\243L\373\224%0\327\f\3301\360\3155\335\243\375B`\311\2059V\310\2027S\212\313n\346\327L\365d\t\213\342\274\021\326x\353\002o|\327\3026g\354\345\226\210\313\302\005\036N\201o5[\360\240[^\016X\333s\306\200\0336\376\306\273\331x\036\323>m\001iZ\240\361v{\302f\274\265K\243Y~A`\255\205\356\"\030G&#\201/!-\201\307N\365\264\210kY\304\030\b\234\231\325x\004~\004\037V\342\227>\340k\374\022\337\225\031\003\276\200?\300L\231\001\3054;@,\214\357/\340\033\221"
+	.string	"\032\2030\272L"
+	.string	"^\320 C\343\225L\345h\007\230\361b\302\310\370\031?\202o\211\033\343e|_\231\361\022\343\233\357\357K\200\267\362\253\320\004\274Q\nx\247\351\255\313/.\227\345\027\033\374[~\205e\2301K\026\226,\264\211\021Z\371V\016O\027\323[\371\250q\270\004|ky-8\3120\245\004\274\222i\234\262/+='\232\013\030O\305\366\227\002\2147\302{\323\342\255\32540S7Y\302\245\027Y\312\242\202\003\274"
+	.string	"\377\202Z6\200\035`\227\246\357\027\340;\221\016j\205E\323w\025\254ii\rP\214\032e!\200\270\267\322f\246td\204V+\336\312(\334\306\240\251P\361\"\260\306@I\221\342\227>\213\251\352\342\231\276\201\374Z\274\213\245o\361Gi\260\022\003\370\025\317\342\373\212\352\364-\225\262"
+	.string	"\212a\002\365(}\377\212w\257.\262\300\027\210\005\257\r\214\024\245\3271\235Szk\247x\025\337!\354\215\336U\242SE\\\033q\365\3449\363]\313\263\030/M\361<\246j\312\320Rl\221M\335P\274\365\2354\212\357\252\026\212wi\033\311\246m\332\023o\345\254\256\003\333\226\201\021%\206\231\350%\356\211o1l\177\217\365M\226\244-\327\326\3346\236x\r\315;\204\3243\304\266$\023Io\342\237L\347\302\007\337\371VI\177lh\265\220\220\216\036i\313t.\374Zx\342\237\243\357"
+	.ascii	"\200!j\321\004\253\034\275\225\351\372\215\207\236\357ku\"\371"
+	.ascii	"\255\205-\216\321'\337\001\257\262ln\310tLb\314.\\\273L\223\202"
+	.ascii	"F\241g\227npK99\267\215F\337d`\210v\304$\337\312%\336\370\032"
+	.ascii	"\264\260\351\271\230\254\231Q\321\177\237\007N\324|G\267\264"
+	.ascii	"\363\216\026}k\263<\325\324\211\025\275\225E\274\361"
+	.string	"\215\315;ilz\310/Q\350\274\343&G\342\221\357\321.\232\351\002w\206\325F\350\315w\356\210'\361}%F\304\217x\021ls\205X\211V\276e\343\201Fj\370aE\274_u\321\017\230\037m\225,u%\326\364\177\206>85n\220!\376\275x\205\370\226\343U\205\013\t\020;|C/\361\336,\341xGA|\033voaM\325\320\256\016G|\370 K9\037\276\375\006\313\256N!7<\250\b\017x\364<h\217\266\333m\210\016~t:<\r0\3002\033\333\355\026\004\207\017\322\307\\\3561\241\034\236\006\230\036m\342\2076\342n\370 lx\226|\276G\307\353,\357,\377\226y\362\270m\334\360!\200\351)C;\364\360V_k\242\240:\256\326CO\2447\364F:}f\324\263\302\016\376\246\201\250\324e\261\n\370\222\266K\224\271(\034\230\212p\203\004\336\275\344\3432/\003\227\203~\202\201\327g"
+	.string	"}\362\002\211\032\207\253\341\251\330\360,\373\270\033\034A\357\373\312`\277\013\262,\344\356\"\201\333F\r\217\001\315\312\005g#\301R\273<\\\036\272m\314\360@t\370\314\250g\nx\213f^n\231M9\327\3477\331\344\t\023<\204I\tU\223\020\022<\f\251r\222\342!L@\242H\030\301C\230\240\244\242\252\232\212LIIM=\221\340!LG\236|<Q5=\025\361\020&*(%QRM\310%TUPRPD\240tTQMe"
+	.string	"\004\212\312iH\216\"P$\2268U99A\001!J2EdCU\224TT\005:\200DIm\250\032\"$\212\310\003PD~8U\345(\0225\364\303\207;\371p%>\374\b\222*\247\252\034CUE\240\236\250\2402\200\"RU5E5\244\212\b\252\204\250\252'\005\210LQU\025\231b`\310S\021$ND<\034\331\261\304\211\bT\003RTNG\242\032\230\252B\342\304\001\n\310\224\005E\246L\210\242\232\212"
+	.ascii	"\352\310\216\"NO\034\216\354\200\022\242\200\320\221\035NUD\240"
+	.ascii	"\032\200\222r\242\n\222\341\310\016(\251(\035UE\240\250\250\220"
+	.ascii	"<i\340'&(\252\251\247\246\247 ME\242\234\244\232\236\250\216"
+	.ascii	"41\201\340)\022\240\250\232\252\246\246\250\232\216\237\002\353"
+	.ascii	"\261;t\243k/\255\317\322z\276a\365NNR|\337\252\r,\032\337F\351"
+	.ascii	"j\321DxZ\272\324\375\344\263\370\t\n^o\272+\353\337\260\263\244"
+	.ascii	"\321 :a\203W.\021pap\256\3171\275\345\344]K\030s\214\177\361"
+	.ascii	"/\354\315\325\t\345\255\354\375d\251mD\247P:\253E\367\325gu"
+	.string	"\223\306\372nbt6\326\363\020\363S\326WVf\363\230\345Y|\265\362\372\t\364\337\260\241u\235\365\3747L\361\244F\247\257\026\273\355(\231?|*\204qm\301&\r\375\240\265\023-\030\2619d[\230c\204J.\314\261\2418*\\Z\254\223/\333\247\2338\237\201>\316?\n\246!\244\236\311\361\333s\247\261\254\336\321\006\225cV\337d\304\342\224u5\375\372\252\371!\372\272\371\307\262,Q\2531\r\355\367\211\314"
+	.ascii	"v\277\017\324'\013v\f\333\354'S\013\317\362\231|\226\337\200"
+	.ascii	"`\355T>\221\031\"\345\027\345{\225\356\2618)X-\226\256\255N\b"
+	.ascii	"zO\370\256\306\351&\336\235\240Y_\232~\207\036\355\277\276\254"
+	.ascii	"\311a\006\265\021\227\311\377\bS\354+\332)\362)\307\260\240,"
+	.ascii	"S\306m"
+	.string	"#\223\347!\326F\273\244S5S\276p\325\262\353\t&\374\017\243\t\337p\3252L\204\272j\305\217M\233\tK\276\253\312\262%\357p\325*W\347\022%\030\224|W\247(\301\373\253z%a\265?%$a\265VrK\370$mJH\324\"ARD\362\314lU\333v\220\023\343D9s\244\352\2718W\244[~9\243<;s\205\232\204{\344\253\376\327\\\231q*\323\212r\313/\312\265b\234\222M\205_\033\271\370V\204S\246Q\272)\341\340\3346\036\371&\303RXV\334\302\271>\271\315\240Z\037**\fU\266?%\327\310S\261\031\371\236\202\305O\2317\303\362\260\031!\341\251\236\204o\277-\3365\221\204\251\357\240\251oi\226g\342T\221\377Q\234v\221\357\267-\233?E\244\336\254\017\033\207;\302K\375\221\355\017\037\254/\347V\212\210\020Z\261\215\334\021\236H\221l\204\237\361G\344\255\f\200\""
+	.ascii	"|\327m\313F\3409\256b\230f\212\001\200\025'\252s[\271\206Ni\267"
+	.ascii	"\235^\241\177\242\242\224\334!\037\345e\310\037QH\354B=\373:"
+	.ascii	"\034\302%Q\016\024\276D=!\216\227b\354\2057\210\020o%7\310\013"
+	.ascii	"\021\013\362K,w\211v\201V\232W\240\336\312\030l\335Y\033\334"
+	.ascii	"\353\002\344\255\f$\315\t\026\335\017\217\353\326\223\246\205"
+	.ascii	"E\347\344d\032\352\263\2008\220_\232]\265O\305j3+\331(\341$\226"
+	.ascii	"\271\246m\267\207?\234\244x\267\022\357\215\022N\373%z\211NE"
+	.ascii	"x\353\003\366S\220 \333\237\222\373\343\237\212X~<P \242Y\247"
+	.ascii	"m\267\177|8\375\373\221\272\267R\317eV\322Q\356yG\235\336\365"
+	.ascii	"\nA\204w3J>\021\276\307\364\360\361?\332\307k\300\n\004\243\305"
+	.ascii	"\362x\342!<\263\362O\231\007\351Y\234R\244\302<\003\250\344\343"
+	.ascii	"\035U\362q\333\030\302\277\240n\313@\350\361\275B\361I\367\370"
+	.ascii	"\036Y\236\037\360\360R\006\362\370\227\026.\r2\307V\034\276\271"
+	.ascii	":=X\352\303\034c\323\001\b\377\243\b\3023\251\343\340\255O\255"
+	.ascii	"\362\360\360\314\325\271\301\007\377\343\350\203\357\272\303"
+	.ascii	"0;<(F\335\203\357(\324\276\304-\2351\035d\232\330y;\224\016M"
+	.ascii	"\261\313\321\3017\032\264\203\007j\366Ada\030\250A\321\271\244"
+	.ascii	"\352\221}a\373\233\341a\02428Vl}i\016\356eP|\361\262\312?\314"
+	.ascii	"19qV0\340\340[\314\037\016\376\003\252\033\355\327\006\177\370"
+	.ascii	"wQA\n\276\177\203o2\324;\266;m\027\304i\351\002\205\013\250C"
+	.ascii	"\202d\361\200\244\006!BC\"\"\222$I:\263\025@@`P.\237\315r\315"
+	.ascii	"\007\023\200M\tcA=\226Z\347\214\220H\222\244PcZ\003\230\021\030"
+	.ascii	"\213\251\\\302Tj\300t&\001\331\003\203\231\334\226\220fGoD8;"
+	.ascii	"\246\247\024D\221<\356z\213\2133\310\013\207\211o\312w\241\222"
+	.ascii	"\035\005\200eb\257\254\300\271\245\365\2340\2608\306H\\h\213"
+	.ascii	"\337!\004\35553\335u\337\352\372\327B\354\372\301\n\242[\207"
+	.ascii	"\036\256\222%\017\231\255 \303\244zQ\260\230\n\207]+\276\375"
+	.ascii	"\223\224@;\031B\033\003\235"
+	.string	")}\377\210;f_\241^\026\307\027\276=\242\2725\243?1\2617\237\236\266\306\216b\322PO\3249\230\272\300\215P\251tNZJ`\001:\217\245_\373\321\230\351#\261]\253T\245s\024R\306\252\007\231\"O\366\233\377\263\230\340(\017\2002(<\201\002AH\331\223i\234\307\304\213\357\fD\240\352l\207\341=\302,q\253`C\006\355\314\303a\233\210%\366\222\264j\243\206-\256S\363R\r\376\333\313\277\206\250\255\345\266t\254D\245\302\204\332\031\341\026\272\\\001R\2541]\366\351\341\372{\314\300Nlf\024\035(O>\026\336@\004\266y\003\3754iM\230\364\317\004I\243T\307s\\-\315ag\353 h!d\021\033\033\357\371\322\212\360Q\312n=t`J\243\314LI\0237J\225_\f\213<\272\352=.\n\fZ\345\270\003\376\252R\373Z\316\344\020F\236\30415\201\237\2510\342\204\022\212\223"
+	.ascii	"\244\243\220\n\325\331*\263\272\225j\265pmT\023\304\253\223\233"
+	.ascii	"\035ErQ\354K\340h\350\320u\002r\356\003V\275\211A\200d\322\305"
+	.ascii	"\303\314\207\200\275&\253\351\\\241W\347Q\205*f^\323\366\t\004"
+	.ascii	"6P><6Oe\253\003]EA\023\374\2220\322tC\302\321\266l^\324\330\230"
+	.ascii	"\251|\272\006\342(\205\320\335\343A2\376I8\031\223\210\361\352"
+	.ascii	"\013\307\272\375\361e\032\345\344\264\324c\246\222\223O\371\203"
+	.ascii	">\324 '\205\253\310\212\252=\223\366\207\331R\234ns\342C\204"
+	.ascii	"m?\256\210\327\344\002G\333\r\365Y0\224\2602I\263\361\320Zx\212"
+	.ascii	"\336;\232\0222\246\213\027f\3242\214 \226D\211\026K\fh\311;\f"
+	.ascii	"\274\271\316,\254\021\313'\266\2209J\016\020\231\n\033\027{\236"
+	.ascii	"\367\247\332T\374/,\3457\007\n'^\224x6\265&\334\276_\336\347"
+	.ascii	"\204';\240\355b\350\272\364\350\006\261\215G?\005[\016\222\335"
+	.ascii	"t\362\324\"r\272\221\355\033\233/T\203B\260\327\322*\371]%\177"
+	.ascii	"\032\342)'\303\370\"\241P\355\366\271\354\247o\210\026\r\337"
+	.ascii	"\037i\374\357\231\203\350\226=\222j\365\201n \246?\342\231fX"
+	.ascii	"z\373\311\372z\372\335=\223`\311\020\233\005\323\021\013\346"
+	.ascii	"\201\216w\217\005\336k@\214\321\021\203\272\312\005~\206!\313"
+	.ascii	" \303\341\022\304m\211_d:\327\322\337\202;\256\021\356\020\276"
+	.ascii	"$\260\247\274\334\344\312Xuy\251qiL\340\rZ=\273\001\372\342<"
+	.ascii	"\016\033\263\352=\250\324\024pe\322[\004L\036\330B\212L\245\b"
+	.ascii	"\241\2452\025\017m5\341\205\226\f\254\252\356NJ\347\202\033\330"
+	.ascii	"^\363\240Fn\347\230\365\325c\234\231\313\311\035\340C\032u\\"
+	.ascii	"\202D\235\311\213\017r\2458\304\274>\024\343\310\251f\375\346"
+	.ascii	"o%=c\357j\fA0%CF]\315]\023\237}\272Q\032\311\367#\356#\362?."
+	.ascii	"\037@\250p\313\247/\211`\313\223\340T@uf\031w\344t~g\303\033"
+	.ascii	"\342>\025\026\365\031w\224X]\210Iu0\234\031`P\321l\372\271\025"
+	.ascii	"\270b\336\324\312`D\263\365mp\225)t\007\200\375\327\246\260\306"
+	.ascii	"\004{sI\320\202.\242\242\252\324*\251\"\332\001\201\273\306\357"
+	.ascii	"\227\277\250\250Ox\254tJ\275D\373\327\333\201\253g\tu1\203\327"
+	.ascii	"\336\216c\004C\331_\256\024\3728\222\233\302\261\212\242\235"
+	.ascii	"Q\211\273e\002H\fA\007o\316\035\333\373K\004\247\323\240\260"
+	.ascii	"A\342!\253j\226yc\203N\204K\336)\037*\2043\211Q?\201"
+	.ascii	"\337\205I\354`\261\201*\311\230\021\270\016*\323j\304\367\022"
+	.ascii	"\276h5[\005\204\353\321UgLF(F*\r\227@\301\222\257\233\245\232"
+	.ascii	"\2169\t;8\250^\362\323\002\266Dx<\322^A\240k\243"
+	.string	"\004\257\354\317d\210\354\022Ry\314\351[7\356!,\333\274\345\253l\333\235k\352BM\354\343\235\0354\355\234\013\236]\306\267\363qY\321\375\304.\252\261\020$a\3154\213>\203\026\300\315 p\264H\312\257\024T\363\275\007\200\333\fx:\337\fZ\264\205\"u)\244\313\250F\266\001pd\027<0\320q\034\2625\250\f\027^\272\034\374\272\f\307\242\260Q\334\221\327\324O\222\020\234[\371\024\251t\007\212\325\\\3224O\363W\237\002\266M\2056\254rc\357\324S\200\327\337\013\354\f\240q(\200\036\304\322\274\301\243\\\336\241\037\233\326<+\363I\rK\247\0350K>\266\020\231-\311l\266vp\313\326Ol\361\200\3025j>k\002\303\217\377A\225\303[\363\347K\314\211KK\nQ\351\235\257\230\250\327\355\017\206V+?Mc}\334\260{T\373\f6\235\233\266\245\026cZ\007\262\261\302\216\225s'\3008"
+	.string	"\336\315[\205\207\244\276X-S\375u\255k\307\241\302\300\236VE\344E\237lZ\025\f\003M"
+	.string	"8\361\023\332\b\246\026#\367F\312\300\262\317\255\374\330`\037\361\020v\245\3239\301\220\207u\211\036\273\332\023$\273]\306\232\334K]!\331&\236V\377yr\207o\241\243\256\245\n\273Z\354\306\f\301\355\035.\017\222h2m\f\310\016\017\026fc\250\025\363OBi\317\261\036\007\216\331\225\272\233qP\302\362\365\221\205\350\303\377\317c{*2R|\312ic\017{\262\224*\177\302\324:\367\237!0\352\370\003\317\334\025\210\f\347,e\361\246s\3509\342\230\rET\334H\371PN\330\274\335\234fD!\020!\337\355e\273\"\366\365\277\250\225\\<\250!\310\"\222\024\215j\tM\002"
+	.string	"\315d?h\036B\205|\001u\b\031\271\260\2423|\267N\021\324\0277\203\375\020\266\354\021\356\037\004b\245tE\020\256\003X]H\347\301\360\2519S\342V\264i\216\020\226\363|d\223 \020\333/j,\362~\261\222\212\341t\326\230\307\234\356:\350J\346\300\275\252\362\250\324\025\\\365D\021P\213\222\216%\202]\016~P\273\024F\024\263\3175U\235i`fgJ\200h\002\240\017>\237'\242k\333\224\243\370\312"
+	.ascii	"\255\355\341\206\027\b\3630\016y\261<\300\fn2{t\002\221\237-"
+	.ascii	"\033\343\245k\b\004\264\231`\204h\006\017@\305o\260\035T\013"
+	.ascii	"\265S\2644\013\315\374\365z>\331\200\031\252\341\265\206\225"
+	.ascii	"\027\\$qI\t\261\340w\276E\336\013\266g\266\225\375\257\237\341"
+	.ascii	"\237\017\332Q\023\343\211J\013?\300\005V\317pb\354JA\037\021"
+	.ascii	"\363\311\252S\001U2\007\006\334\275\2172{Q}:K\364}\244\244\020"
+	.ascii	"\177TBG[y\315\257\2135A\006;\020\323\220\030RO\365\306\021Q\370"
+	.ascii	"\346@o4W\271\3727\007V2\270\313\t\323\3268\272)~\201\211tV\235"
+	.ascii	"\343Q\231S^\275\023\251;\311\305\220m\227\357\217G\371\264\202"
+	.ascii	"\204A\323\227\314`S\273#d\345\304`\t\313b\222V\020\326\306\342"
+	.ascii	"\302\236\276\217\342:\177\321sK\306-\375@\202\275\325\021NO\261"
+	.ascii	"\354\230\037\265\237\3528\002\362\307\235\325F\007Q\357\335\250"
+	.ascii	"$\242\0309\3258\265\312\033r\367L\356\273C\201F\347\fj\254\333"
+	.ascii	"\025)#\275\260$\262\344\022e\324\30608,\312\2023\211\242\\\213"
+	.ascii	"`\244\266[\202\020\345\235\005\242l\200!)\\A\364wt\304\365q>"
+	.ascii	"d\245\\\004v\\U\031\227\244L\330\177\325\017\222\302R\346\361"
+	.ascii	"\230\220t1\323\365&\nT\003\352\345^:N\021\004\366'l\200N\337"
+	.ascii	"\337\213|\356\223\262\327\237\230\007J\312\246\376n\0221\376"
+	.ascii	"K7\315\207\301\226b\204\313\374m\344\037\223\233\261r"
+	.string	"\257p\020:4\211\375\246\025\314k\033^p\342!\f\023`\227Q\177\"\201\216\024\253l\rX}hL\rf\303\261\214\211\266n$\244\234\263t\220\247\317j\235\245\033D\342.\273\001\202\204\246\213\204{\244k\312'\361<7)3\027\234\267\336\215]\273\212\2128\033T\314\261\314W\341\343jw\243\024K\022\2420\rv\327\206\222\300\361:\002\247\260H(K(?\373]U\347\375i\345\032\013\355_\253\330\323$\017\247\356t\311\201[M\004\352\317\250\231*R\235J\301D'3\250q\225\374\326\326\350\fw\035z\330-c\355\002\022\257\034\002IL}\017)V\334>\343\354v\231q&\ba\025<6\254\333\214E\346\b\260.8\217o\027\2472\223i\\\337^\374\2136\274\023\360\\V\354`\321\016\336\017{\377L@\331m\271\027\"\370\234\214\342\024\250\025q\006L~HM\231)>\211\225\354\234\312\275\245T"
+	.ascii	"\006y}\352C\032\352\361\362\260r7\365\207[\342#\311\274\t\001"
+	.ascii	"0\240\254WBt\211J\271\030"
+	.text
+	.section	.gnu.lto_.symbol_nodes.fb5dcbd45bb43ae8,"e",@progbits
+	.string	"(\265/\375`I\030\205M"
+	.string	":y\f\0328 \246J:?"
+	.ascii	"\300\251\003M\2063\267\305\021Y\363\310\277S&z\370\301\004\270"
+	.ascii	"\025\220Z\275\305i\261;\353\254#f(\240v\002\220\301\322\327l"
+	.ascii	"-lX\005\324\355\310\235v\215\001\217\001\237\001ng2~\223\313"
+	.ascii	"7d&_N\231\214\321\310d\034&.\237\020\\~\237\267\374An\371\200"
+	.ascii	"c\362\003\305\344\013j\313\027d\313\347s\247\323yo\203\257\345"
+	.ascii	"\317\271\332\273\244\335\354a^\266\274\227\n\330\2230#D\320\376"
+	.ascii	"ey\357\217'?\276\236\b\t\023\002\326\203H\023\013\367*\331\317"
+	.ascii	"~\266\004\223\017\347K\276\236\227\374<\263\3747e\371n\272\344"
+	.ascii	"\343q\311\277\333\222\337\006k\311g\203O\206\277,\325;9\226o"
+	.ascii	"\367'.[^,\277\356\316|49\177\315\222\017\305\202\305\226W\016"
+	.ascii	"i\345\217U>\367H%c\302)\371g\244\344\313\235\355\354\256,J\276"
+	.ascii	"\031(\371qO\362\333p\3303\201}\213"
+	.string	"\223\2235\301\\\230\344\247\301K.\266T\222\317\226$\177\rI~\032>r-F\256\026\371\030\221;Z\016y#!w~\335\312 \347\002\344\317\345\217\214\003\341\247\323\216\217\3740=2\356\303#c;\274#c5X\307\013\3458!\216\353\271q)m<\320\322\371|\252\22352\246\3034\036\235\361N2\362\351b\3406\030\237\264l\347\013\314\346\342\222Z\344\253a\201\323V\340.K\025\371kp\212|5\334\225\225\225\225(\362\321\360\211\017\232\270b\211+I\002;G\334\216\b\034\027\"\277\f\006q\267\017\037\343\341o\351\341\274\016\251\303\023\035p\370\235\253b\033.fy\357e:\237Og\235{\363\275\200h\007\340t:\235]\371d\360\275W\301\210\337J\224\206\346Zj6\330c\263\303VM\315\016c75;\254\345\324l\250\365\211\375-\224\207N\335]\274j&\364\035\340J\354\353U\177]\265\224J"
+	.string	"\222U\023P#Yu\024+\311\252\243\326Iw\220\320\321\337\327/$\301=\271\253h\325P\352\243\252\346\240\230\335m\253\022\253\032j\375\321\304\260\271\2078\215$\235{H\005`\321\235\263{H\025`\020\320\330=\244*`h\270x\017\251&\340\301}\271\207Tw0P\234\330=\244\252\203d\024\274\210T\235u"
+	.ascii	"\206T\367on\261\357\026N\365\323\372#:\032\243\251f\256\307r"
+	.ascii	"N\247\363\355\257\247\321T\177}\177\375\216\246:\353}\r\247Z"
+	.ascii	"\212\375\027\005\350\247\226\331\276B\231\302\265\033\275\315"
+	.ascii	"(\3433\303\214\301\024f\354eQ\306f\321\374H\212\362\027\023\345"
+	.ascii	"SB\224\361\226C\031k1\2241Y\241\214U\302\214\307\0063~\022\312"
+	.ascii	"\257\024\314\247\f\314\237\004\314\227\034\224\037)(\237S\240"
+	.ascii	"\374M\200\3625\375\311w\364\223\217\351/\277\321/\237\261O\376"
+	.ascii	"%6\337\022\237\374J}\371\213\366\344#\352\311\177\304\227\337"
+	.ascii	"\356e\254\226'\3435<\371\207\356\344#\262\223\177X'\237\021\235"
+	.ascii	"|\3039\371\205r\362\343\304\311\257\003'_\221^~\242\274|@o\362"
+	.ascii	"\377\270\311\367\203\227\377w\227O\247M\276\037\233|\326.\277"
+	.ascii	"oM\376\0365\371|u\371{t\371y\322\344\343A\2231\334\232\261\230"
+	.ascii	"\271\214\307@3\016o<\303\264q\036\234\032\307B\246\215\365\322"
+	.ascii	"\306r\326\264\361\034\225Lz\265\305>\277\033\365j\276\267^\375"
+	.ascii	"\325\321\253\231\220\033\236\265a\201\234\236\365d]\ru-]\r\265"
+	.ascii	"R\352\352\247vKW?A\177\272C\217\376\264\272\232\371\330\325G"
+	.ascii	"\354:\227\256\306\352\333\342j\254\365\013\336t\272\214\\\005"
+	.ascii	"\316\332>\306\245a\323!\004\354\217\367\307\350c\\]\325>\301"
+	.ascii	"*\3516r\335?\202\016\335H\256\226j\377Fc{\327\221\253\241$\271"
+	.ascii	"\232\271\266"
+	.string	"\312\325_\\\r\365\204\260E\001\r\240\363b[\315d\377\334\352\267\212[\315\013\212Z\375\247\004\255~\232\324j\250C\255\216\242\324j\251J\255\256R\035\265n Jtq\027R\013\233\215\211\264\266j\365\001\326\2515@\321\315\026\346\032)\241J\217M\357:J\350KH\224\224\200)BgAf\265\210N\020\372\213\022\204>\013\t\241\263\256Vj6\223}R'\237.5\033\212\375\002\3069\321(\225\261\211\241\020\n\275\321&U\236\246I\004\330\267\224\224Tc\263\253\324\252\365\257b\0275\273\200\372\027(\320\276\355\372\376\022\035P15\373\300\001\004S\315F\200\340J=l\366\025\273\240\305R\377\261Am\202X+V\333\340\371\246jv\003\266A\373\003Q35\033\b\013\244}W&6;\310\032\030\244U\207\264DZ\307f\037Y\237\301\321%=$\353\003\270\001\212^J\315^\2622Y\037\241M\324\311\244\275"
+	.ascii	"5\221i\227\261\331`\352\037'\370\310w\243\315\006c\0037\352y"
+	.ascii	"\003\222\206\212\"\264_o`?=\257\020\255\372\270n`3\241U7\260"
+	.ascii	"\277n\340\334\005\354,\350\375\323_\317\334\277\216\352K\257"
+	.ascii	"_GA\267Z\347\215\256\327\361\372\035\362L\245\337\313\\\277~"
+	.ascii	"b\315\\?\271\353\327\017\274.\333Y]\322\376\022\364\262\264\277"
+	.ascii	"\232\245\217\367\222\366\033\323f>\275\322f\266\004\326_\302"
+	.ascii	"\3057\210R+\205\307D\215R\355\227\264\253\3247\2335\300\265\203"
+	.ascii	"I\033\201z\250?DdW2\355=-\221\3271\275\232\233\035\026\364\027"
+	.ascii	"$X\307!\355C\325\237\245\3759\366\f\n\3758\256a\035\325+\231"
+	.ascii	"\366\355\330;\365\314.ognd\332\307[\177g\231?71\355\347!\376"
+	.ascii	"\311\254n+\355\353\255O \271FN{(@os\330[\255\301\261\303\236"
+	.ascii	"@\033\241\243\245\375;\354\236\3720\353\367\020\325\247\245}"
+	.ascii	"\276v\320\215\346]-\355#n\272\321\265\264\377\250\205\274\206"
+	.ascii	"\352\323\27322\220\326c\276\312\312HHm\247I\354o\343\233\030"
+	.ascii	"\334\333\330\305\366\r&\221\262\221\245V\375\305\244\375Kk\344"
+	.ascii	"\215\252\231\330\377\232\324M+\344\n\311F\266\277\2052\351y<"
+	.ascii	"\233\372\266\365\370\224\355/e\341\332\235K\271\236B$B\277WF"
+	.ascii	"U\266\2641\224r\3751\341Q\354\363\266\264\361\034;\231F]\177"
+	.ascii	"\031\3330"
+	.string	"\212\335\303\2641]\373\beO\275\033]\307\244\215\355\330'H\344\364\250\272\255\307\202\324\264\367\267\264\361]\033\201\301\250q \0075D#\"\222$\005\205tq\005\3041\347\034\331\034\021\340\244\223\214\310\210H \022\211\210\350\001 \210oa(Ay\234\271\232\320\255\352\231=\b\373\345\257\312\261\370\027/\373\343\230c \001\260\357&J\035a\033\244a\rl\242\306V\370p4\333=9\306\nEUE{.\033u\227\207Y\351jO5\243\255\035\214\356\321\372#\340\027m\341\372\347\305q\177\007\364'\316\026\273\316\260\001pZV\235\332\347\361Js\266\255(\310\331\351\0049\274\002\345\221*\bp\364\t\023\340\335\341\035*M\321\263R\367\265\305G\2355{\355:\035<\032?Qb\251\005\265\365E\241&\212H\026\026\370\252\270\027^y\231\240 \330\255\0039C-\377j\220`\305@\007@|>_\233\355j\336"
+	.ascii	"\020\277#ZXc\351\3463X\303y\2540i\0279\024\272'.\020\263\256"
+	.ascii	"\3440\t\366\251\354\035\236\304\310\246\363\243\246\370Ap\301"
+	.ascii	"\240\3465XAW\221\237\367\255I\250\301&\224\007v\323\202\325\343"
+	.ascii	"\275\006\266\226\3133d@\263\343\036f\271\346i\260\334\301 \365"
+	.ascii	"\301/[\"\246*2tj\327j}\215\344"
+	.string	"\206\344F\017D\276\352\217\366-\027\016\032\020\023A|\035\013\254\315\006 ^,Z\270\374\247\341\247&\"\271\304\n\210c\227\303n\026\\\0179H\260Aq\360\030!\206\341n\254L\025a\025c\271>\377-\271\n~\031\242d\200C\276v-\257\021%\304A\270\233\273\020\234\227\334\271Pr\016\203\205\241\247\005\2358h)\373\354\330\312\247\267\213\341PV\247vK\n\025j\245\002KA\232\214r\026\315\336\313\262\026\3169\374\300^V\361\202\007"
+	.string	"'\317\201\303J[B_\\8MV\277\343E|9\2672\n\334\202\246\237\316)\037\324\013\024\032\304u\331\215Zjb\361\3508\006g\223\217\346\nM\016\313\226\t\017\325\210\250\323\261\263S\031\"\026t\032\222\243\300\316A\217\206\237\207 C\333\f\337\251\242\035b\342\020\022\265\343\214\363\3068\271\241]\031$\375\244X\017-0\366\274\004\212\200\"\240\b(\002\212\200\"\240\b(\002\212\200\"\240\b(\002\212\200\"\240\b(\002\212\200\"\240\b(\002\212\200\"\240\b(\002\212\200\"\240\b(\002\212\200\"\240\b(\002\212\200\"\240\bP\300)\336\t\350\321\277\220\331\215\240\314\335\217\220E\265g\345\337D\024\243D J\004\214\322\212\024Edq\235\0061G\323\322\313\025\272\205P\205\217<36q"
+	.string	"\0027+\370X\243P\306\263\310\235dV\231 \227\301`\344c\023\341\373;/\246g\326@\275\034\377\371\261xm\201!\344"
+	.ascii	"\336\r\334\034\372\344\307\021{\346\017\367\216\210\262iDVk\205"
+	.ascii	"\267\372%\354\203\362q`Q\034\242&y\020\277\032M\276\222\030\204"
+	.ascii	"\027\221\314\334\231\213\265\001x\211@\241\211\027r8\016\244"
+	.ascii	"\341\363\212\272>\022k\302\303K\203\263\005vo6\240XA\252\267"
+	.ascii	"BY\354X\217\370^\"Q\003"
+	.text
+	.section	.gnu.lto_.refs.fb5dcbd45bb43ae8,"e",@progbits
+	.string	"(\265/\375`=\003\005\026"
+	.string	"&4\217A\320X-\264\006"
+	.string	"$\202?\214p\rs\200\215r=\036\271\024"
+	.string	"a\004\244\023N\311\370\030\370\342\001\276x\200/(\356a\017L\254s\371!\362;U\364\177\036ZZ\036(\240IHB\"\"B\266L\001v"
+	.string	"|"
+	.string	"~"
+	.ascii	"y\350L\324\246\311\271\257\234Y8\367$\340M*,v_\260]l^\005\250"
+	.ascii	"9\325\211\335\032\3300\257]3\267\025\273-4\247b\3274\363\301"
+	.ascii	"\002h\311\222Y\025\363\311t\251\024\3064\346\365\345\002\265"
+	.ascii	"\256\217\313\262\325\335y\235\263z\306\365\252u\312e\023\353"
+	.ascii	"[mY\275Q]\233\324\245i\317\244\206\241.\200\323\215I\375\202"
+	.ascii	"\332u\267u\272*\323\250\322\245\366\335\256M\263<t\344\200\035"
+	.ascii	"\307\320}#v#\r\r!v\035\300n0t\215\206.\321\320?\263{f\363\314"
+	.ascii	"\266a]st\fg\230\3212E\277b7\005\373\364Z\020\333\262\231e\263"
+	.ascii	"\212\350\242\332)8\2756\301\275\237Cp\017\f] \241\373\023ty\016"
+	.ascii	"\274\003\264\200\237{\343sgt\226i\027\246\355\352\271\255vY\355"
+	.ascii	"\225\354\252d\243zn8\r\274l\261\026\270\245\330\361\334\303\271"
+	.ascii	"\001w\220\235\003\262g\221\335X^\277\322n\245\312\024)P\2364"
+	.ascii	"a\262DI\022$G\202n#Bw\021\"C\214n B\377\321\243\350I;t\004\005"
+	.ascii	"\335\306\354\b\263\035\314VP\264\317\321=8\0270\232@\321:\355"
+	.ascii	"\232\327\260H\313\304D\272/#\364\021hg\034\323\255\235Y\246["
+	.ascii	"v\276R\b\250\355\350\036\334\225\351\223\353\346\352\3004u\367"
+	.ascii	"t\233T\267\224\272\227\332\340\024\366se~Vm\223N\006\250\003"
+	.ascii	"\013i\211\264C\232\207\322\223\355p\034\356\365\334p\217\250"
+	.ascii	"\206\031.\f\354\227\330m\301V\305\016\303\351B\333nR\013mKj\322"
+	.ascii	"\250I\267\264\307m\322\n\247\250;\356\335\221Bk\260\023J/R\t"
+	.ascii	"\267\251H\201\342\215\333N\230x\343F\242\335@\304|T\242\264\356"
+	.ascii	"Aq\371\234(AB$\b\217\032m|4\002|3d\304\200\361\302\305\032_\013"
+	.ascii	"\237{,V\254qO\205\317\227\242\004\t\235o\204\b\331\275\020\037"
+	.ascii	"\002: \220\242c\264\361q\250:%\202\252B;6;\214\247\266_)\006"
+	.ascii	"\274LW\320\022\0233\336\022\233\037\0303\221&`v\032C\233`\324"
+	.ascii	"\322lGc\025\221\354.\331R.\271l\343\032\021\005\024\245&\203"
+	.ascii	"\rq\006+\2448\202\021r\031\027\300`\220\020\215\343#\230)\346"
+	.ascii	"!\034^\214\"n?\260\354\b\bD\031\004\220\n\257\264\275-9b^\257"
+	.ascii	"ca0D<\342\247q\314~\241\222\031B\245\266\242\001"
+	.text
+	.section	.gnu.lto_.decls.fb5dcbd45bb43ae8,"e",@progbits
+	.string	"(\265/\375`h\227\315_\002Z\316\343\326S\020(e\345f\f\3779],y\021\350\023\256\203\023\007m<\360\251v\341z\271\340\256\347\343\351\342v\207\365\034\337o7c\354\366L\223\331\363Zm[\303("
+	.string	""
+	.string	"\267\212\004\210\235W\277N\201 \231\274\366DA\226e9\037;\364\020\025\326d\367\312\225;\005\244\013\273\r%\016F\226g\224\226q^\235\215-\3438\371\273AE\r\316\344\241\267\2329\224\2324L\241\364\031\324\3663P\331\317\200\334\317"
+	.ascii	"d?\303\324>\261\374g\224\363\353\274\362\2731f\r-k+D'\037\r4"
+	.ascii	")Y?\203\214\375\377\254r\226\235f'\025Sy\236\235SF\220r\344<"
+	.ascii	";\223\246\336\231T\3332\252$Y\216\305!9\317N\262'\\K\306\320"
+	.ascii	"\"Xtq@}\fp\3661\250\331\307\020\267\217\341\314>\0063\373\f\023"
+	.ascii	"\361SL\277P\207\212I\326\232\3146\227\346PZ\201)\224\036C\226"
+	.ascii	"}\f^\373\030\202\354c\310\261\217\341i?\310n?\350\314~\020\226"
+	.ascii	"\375\240\257\375  \373AQ\373@x\373@o\366\201\332\366\201\262"
+	.ascii	"\354\003!\367\201\202\354\003\355\330\007r\332\377Y\356\377\270"
+	.ascii	"\355\377X\331\377\201\262\377sd\377g\307\376\017\215}\237\274"
+	.ascii	"\375\244)\224\336G\315\276O\230}\237\263}\037&\373>B\366}\244"
+	.ascii	"\366{\354\366{\342\366{\262\354\367|\355\367\b\331\357\231\332"
+	.ascii	"\347\311\333\347\221\333W3\205\322\363x\331\347!\333\347A\262"
+	.ascii	"\317C\265\017\264\263\017T\263\017\264\262\017l\262\017\324\332"
+	.ascii	"\007\322\330\347\322\237\223\246\235\311\346.\331a%\353\003\235"
+	.ascii	"\366\177w\366\341\336\354\377\330\366\177\311\375\337\220\375"
+	.ascii	"\237\326\376s\335\034sM\266\243\201\036#8l\230\311:\333\345:"
+	.ascii	"\317v2\235lG\204\2558f\312v\200\364\342\230\t\310410M\ftX\327"
+	.ascii	"\022-\251\376o\3076\305D<\327\001\305\245\331)\311\372?\251\375"
+	.ascii	"3\205\322\377\342\375\355f\177i\n\245\337q\373\373\313\376.\333"
+	.ascii	"\337\310\375\255\265\277\251\366U\276}\365\315\276Jf_=\333f\214"
+	.ascii	"\346\314\231\330\0215Y\377\317p\331L.\223\337\262\233\251\314"
+	.ascii	"gr\3333\0313\316M0\346\224\r\274\250\345!\357\302\364`\343\201"
+	.ascii	"\024\243&\353L\036\023/\315\021\301KU\036\362.\216\223D\252\026"
+	.ascii	"(l\200\364h\324\024J\257\342\330W\243\366\323\276\3754\316~\312"
+	.ascii	"\266\237V\331\177\376\262\246\005Y\207\226\265\225\274\345\207"
+	.ascii	")(\216\225\300Yz\311]Le^\313k\031-\253\231pDt\330\3332\216c\020"
+	.ascii	"\034@h-w]m\251\376s\332\263\232z\365\205\312Z\326&\027\021\317"
+	.ascii	"i\247Z\230\030zY?\235\262o\242aq\363ge\346\222\265\230\3123\363"
+	.ascii	"\215\234+f\332\017\032\307[o\220q\034o\311Y\314\264\037\246d"
+	.ascii	"\\\005LRU\327\343.\216c\020D @\270dA\362\266~\nd?\315\332Ou\354"
+	.ascii	"\247U;5\253\222\312\370af&\353?Sy\256\362\233{\271\354iy+\216"
+	.ascii	"\267\304q\274a\317\260\333\303\313\332\214\315\2414'E<S1\341"
+	.ascii	"\310\013aY\237y\n\217\024,2,Y\337D\373\3156\323N\234\275\276"
+	.ascii	"6\310\275\274d&\316\334\035\262\315d\243\207|\003\347\216\210"
+	.ascii	"\031i\31073&\333\231D\252W\272f,\345,M:&\034\226\t_r\226cMe\332"
+	.ascii	"\374f\233\351\006O\316\023\231\245\331f\252\331\373\363\217\314"
+	.string	"#o\345(\231+'\311LrX\316\312N2X\026\313P\262V&\313=2\220,%#\363X\356\312O\362\013\271I\036\222\225\344#\371+\023\311Br\220\214$/\311E\262\217l\304Tf\257\254\343\031+\357xN\356\345X.M\225\226\021~s/\313\030c\266\231q&\033\237\211\346\027A\225\247\224Pl\"\262W\266\221s\374\234q\374\302\024d\034\3077\327Xeq\243a\262\241\241\305h[\276\375\"jp\021\221\243\362\324\2267\331\311m\271\3467\3672\323\033\022\3567\333\3143}{|o\226n\277\331V\206\006\322\313\027\223\355g)(n\212\213B\332\325\231C\212\310W&\233\t\207eB\030\226\020\262\227yg\352\231pD\0220\006g9&g\262\375\234q\254\225\207\214\343\344\3151\277\331\366\217\030!{\231dL65\206\213e\\\351\252qN\201\223\323\345.\216\223 \210@\244:\262\314\231\261"
+	.ascii	"}V\231C\351\b5\373\3178\236s\260i \336\2406\351\233\242\313:"
+	.ascii	"\337\020\361\214\243\002.`\272d\255\232B\351Q3\373(\227}Tl\037"
+	.ascii	"E\356\243T;K\351\034e\202(\311\372\250\214}=\267\257\335\366"
+	.ascii	"ur_7\331\327D\366u\217}\235c_K\355k\247\375\223\316\376\351\266"
+	.ascii	"\177\232\355\237^\373'\326\376\031\265\203L\241\324\274c\342"
+	.ascii	"\231\312\016\314\274$P>\262\227\245J\326?\233\366\315\016\322"
+	.ascii	"\263\257\317\354 }\266\263\237\331\354\347.\233h\216Ig*\211\314"
+	.ascii	":4MS=\262~\326\262C\020\233D\351\373L\242\364\231l_\200d\177"
+	.ascii	"\310W\033\204\272]\002\231}\263\312>\026!\373j\346PzSj\237\315"
+	.ascii	"\034J\377\356\303\231C\351\331}9s(=\004\366\227\346P\372\024"
+	.ascii	"\366\005\246P\372;s(5\301\230aL%\005\246\230\217\030\341\347"
+	.ascii	"R\031\220\017\037\030_^\326?\300\276IAj\366\231\024\244/\332"
+	.ascii	" \254u\260\235\274(\307\272\250\231\311-\260\275\263\233j\277"
+	.ascii	"i\305\274b\246\231[q\354\024\307\361\006\363iN\n"
+	.string	"/k\023\213\231\305Tr0\267\334\344b\242\035eJ\306\3118\216\201L:\"MVY\007\231Ci6\205\322{\3307\265\034\210+\036\341{\203 \216M\016\251\331\327grH\363\2269\224n`\n\245\246\231\210\233gBi\025V2\306\022\3071\320\217\025\330\231\226\2541\230B\351oV\341\240F\351\362CH\031\005@\311\034R/d\375\233T~S\314\0343\247\234PQ[1\2268NbP\305\302ta\311\332\234\222M23ys\212)\345#Fx\217S<\026\307Is\212\216c&\323\304\340\30741@\301$a\252\222\352\347\375\2449\224nS(=\267d\r\364\017M\347?\177\320\037q\376\223\007\325b\203\372\310K\215\346\204\203\366\370\365\333yEW \303^\314=\025y\354?#@?\234N\320\254?\203ee1=\346?7\312\343\317AZ\211\2060M\330\361E\257\231@/\320hY\316Q4"
+	.string	"5\201\356\370Q\0358P\022\247\034\324\306\217J\311\370\321\245\037\375 \004e\310_}\322]Y\311\177\356@\343\377\314\001\344?o\\e\370G?\370\221\001\272\201\t\364\002\0246B\360\243I5\020\360\253\033\236z~\225'\004\246\266A\006\202\037\365\200\007\206\376\364\216\324\217n\220\237\262\222v\372O\025N\024\364\022\332\342\327&`h\027J\271\330\242J\277>\376\232\003?\n\257\350"
+	.string	"}\177\224\003?j\374\321\244\037=\372O\206\256l\312\345?+@-\360g\033'3\023\207\314\177J\235n\300d\272.\377IT\243\374O'\264\002?\232\341?\177(\360\200\005\240'V4\251\352\177.\340D\334\177\364W\257\234\251\362\237e\310\230\371O6\345b\264\006\324\247\303\230\377\300_m\362\353\bL\340"
+	.string	"\377)\001:\201?k@\204J\3407G\234&\320\013<d\272_\360\247:~\235\201\377\314"
+	.ascii	"\335\200\205\321\257\217~4\002\277Y\347\317i\005P\b\220\345\016"
+	.string	"\371\316\003\322.\224G\177\305)\346GW|\371\317\363\253E\316\005\240'\236$A\2378\3313\370S0X\303\370Q\007\374'\020\215D\033\360\347\263?o\3713\227\377\364\322\037\3705\bP\026~\275\343\\\222$\213\031AW8;\320`(\003t\007\376{ \352\240\303S\370U\007\300@\027p.\340\304\177&\025\220I\344\023T\240*\234\232\312\177\262\246\3774;\327\364\257\006\371O14\205\0375\361\277\356b\324\0379\306oz\310O\035\320\023\356\001%\361_\314\353T\030\377\271\204L\314\323_}\177\323\203i\201\337\304\300=\254x\022\301\257\266\360\233I\323\312o.\177\363\212\t3\210\026"
+	.string	"%\300o.\3407S\374&\003\3763\b\035\200y\202Y\"\243%x8\332?\374i\322\363P\r\314\021\350\bO\273\332\311\201\207\023\235\354\025\374\251\n\277\316\361g=T\2043>9 \273\317\237\366\375\347\027\032\002:\002\025\361\353\026P\020~\215\305\004z\201V\242!\376\254\344\242Eu\376\223\235q\316\301\257\016\375g\007\320"
+	.string	"\350 y\205?7\340G?\370\317\025\365\340\327H~\024\304\177f\024"
+	.string	"\177\266\242C?\374'\033\264\203\016P\017\177\356;\006\177j\367\237\031\240\033\374\027\2435\374\357\360\375\247\312\337\224K3\005)~\024\203\025\035N\0254\374)\325\177\336x\376U\025\376\347\241\032@\375\371\016\232\301\257I\374\331\016\305\340\327\025\310\272\207\377\224!\364\253@+\234&\320\013~}\342\317S\250\005'\n\377\311\376\373\374i\215_\347_\233\277F\377\237\377\366\371\265\007\277\016\361\353\242_\177\360\353\017\277\006\361\353"
+	.string	"\374Z\304\257G\370\265"
+	.ascii	"~\264\202_\017\375\272\203_{\370u\372\243\024\374\017\3727\373"
+	.ascii	"k\003\374h\207\037\235\340G9\374(\321\217\016\375\250\206\377"
+	.ascii	"\352\277?\360\243B?\n\364\243>?\312\363\243\277\037E\177\364"
+	.ascii	"\374Q\363\327}\277\336\373u\336\257\357\374\332\316\257\355~"
+	.ascii	"\275\374\365\334\257\335\374Z\356\327h~\r\367\353\267_\273\375"
+	.ascii	"\272\355\327a~\375\345\327k\277V\3735\332\257\267\374\032\313"
+	.ascii	"\257\255\374z\354\327a\277\366\372u\222_\007\371u\327\257\201"
+	.ascii	"\374\372\307\257}\374:\353\327;~\255\343\3276~m\365k\252_K\375"
+	.ascii	"\272\306\257g\374\332\351\327L\277\016\301\257a\374\332\305\257"
+	.ascii	"\225~\315\201_\023\177\335\376\372\350\327,~\255\201_g\340\327"
+	.ascii	"\027\370u\005~"
+	.string	"=\201_G\340\327+~\235\342\327(~\335\200_\257\360\353\005\374:\205_\233\370\365\t\277>\300\257\005\360\353\021~=\342\327\351\177\312\371\3178\377\351\346?\345\376S\315\1776\375g\334\177\236\371O3\377Y\346?\311\374\347\230\377\024\363\237_\376\223\312\177\256\375g\332\177n\371\317,\377y\345?\315\376\263\354?\307\376\023\354?\237\374g\b\376\223\306\177z\375\347\222\377L\362\237G\376s\310\177\006\371O\027\376\223\375\317\256\377\004\362\237?\376\323\307\177\362\370\317\034\377y\343?\257\376\263\352?\245\376\263\306\177\312\370\317\247\377\214\377\323\003\377\251\364\237\357\177\032\377\223\370\237\033\370O\243\377d\361\237\031\370\317\013\374g\005\376s\002\377\031\201\377T\361\237\017\370O\007\374'\013\377\311\200\377T\341?Q\370\317\023\3763\001\377y\200\3774\341?\t\360\237%\374'\t\377)\302\177\216\370O\020\376\263\350?=\370O"
+	.string	"\374g\007\377\311\301\177j\360\237\025\374g\207\377+\376L\342?%\370O\242\377\214\340?\207\376\247\3759\375O\241\377\314\360\037\355?\203\3767\3407O\370O\366?\357?\177\376\223\347?\367\177\242\377\231\377\334\367g\275?\337\371\363\335\237\247\376l\367_\314\237\351\376\274\3743\332\237\311\376\334\344\3177\376\253\370\363\325\237g\374\331\305\237\217\177v\300\237O\370s\002\376\214\200?\177\370s\207?S\360\233\353o\252\370\315\022\377Y\370\315\003\374\357\362_\355\177\331\177*\377\223\377\315\374'\363\037"
+	.string	"}}}}\277\020\234?\203\f~\026\013\bY\253;2\331\215\030dY\037"
+	.string	"M\366\001\200d\377j\0165\207\311v:\305ZD\324:hZ\025\035^Y\037"
+	.string	"@\366=0\325\0337\016\306\254\332W\236\302\226"
+	.string	"\200\332\277zu\205\326\025\001.\373\366\325)S\255\252J\177\374\342\230K\n\217\326\0078\373f\372#\275\007\246*\245J\035\314/\216\271z"
+	.ascii	"\357b\017\376\001N\235\241\326Pg\2504T\032\025\340\231\251%\251"
+	.ascii	"\313\372\037\306\354\177P\2522T\031\351\231\335\217\226\031c"
+	.ascii	"\310\223Z\326\377\020EeR\235T&\365I}R\233\324\246T\371 &\272"
+	.ascii	"\020K\240-[\252\230e\375\017C\366?T\361\2511___\225\207;\254"
+	.ascii	"\017f]\221\276\264\254\337A\233\375\016\304\354\244yvR=\275\273"
+	.ascii	"\273\024o\202/*\332\f/-w\236\342\235]\252\332\254\311\372vi\374"
+	.ascii	"\377\307\263F5\346$\353w\340d\277\003!\333T\246v\251\017\024"
+	.ascii	"f\034\243\005\031[\242wdp\201e\375\016\252\346\314I\353\210\266"
+	.ascii	"\230\230L\030\203\314C\002\247`\321\352K\351\210\200\256 \021"
+	.ascii	"S\223\365;X\332\367\020g\356\0371B\272&\225cNI@S\034k}\ta\261"
+	.ascii	"\331\367`\006\016\234\036@7\017V\366\237\312\335T\246r\251\033"
+	.ascii	"\242\255\370\312\004\257\253\276\260!X\220@\311:m\243\221e\254"
+	.ascii	"\242\262\276\207(\373\036\272\322\244k\322\244]i\034\233\311"
+	.ascii	"-\252\252\030\253\352\203\0325Uu2\204a}\370\361\242D\310U\326"
+	.ascii	"\367P\265\317A\0358\270\024\315\207\255\330\306\006^L\346\360"
+	.ascii	"\364\202\310\251\312:=cdInH\326\347@\315>\007ioo\346\024\242"
+	.ascii	"\255\2459 \320E\275\241\373\261\242\245\212\215\254\317\201\227"
+	.ascii	"\233[\007l\034\360hkC\251\024\260\305t\265\201\035\272"
+	.string	"%c?=dH\345e}\016\240\330\330t\331\207-&\256\013\226Qqnw>^agMY\237\003&0\351Z\032\006\245\332KU\261\323\220+\020|I\017\276\201\233\375\r\324\274x\271\200.*\316M\357\311YS$\353o\200\244K\027\020t6\330\221\226\226f\345\262x\351\001\\n\220=en\356h\311\372\033\304\330\177\312\305T\246\\\322\035D[LW%<\241\023S3\257\356\254\244\311\372\032\324e\311\222*\327<\340K\265<U\376\214\201Y\336\311\372vh\335\377_\020\214\221\273\254\257\001\232+W\322\263\035\307\361R2\246\372\251\243\001\232\231Yz\366\2408\216\233\342X\253\007\317[\224\020\272\273\247g\346\224\237W\223\256\250\2442-\323>N\250-\246.\021\274\312\372\302~u\266T\311\312\372\032(\331\177\232\274\251L\223\251\r\242\255\330\306\007`\342<\244^z\t\213s\220\221\231ih\034o\355"
+	.string	"\256ay\240\226\341r$-\353k0\265\377tL\231\216\245V\271,^\002J\213\353zl4|3\352d}\r\236\366\237\206\205\231z\250S\274U$\345\333]lZOY?\003\273\375\247_7\225\351W\256\242\200-&\257\022\304\266\362\220uLs\262\262~\006o\240@I\273L\020\342\246\270.\035\340E\t\241\273\313\240\214\023'\313tH\023\022,\353g\020\306\204\2119\205(^\232\343\341-J\b\335W\220\272\250\267\254\237\301\r$\222\356g$\307\033d\326\307\300\316~\212\304L\225\230\312T\211\251\207\"vj\002\342\201\016\212\205\203\bX\326\307"
+	.ascii	"\315\276i\352\245\177z\344"
+	.ascii	"\317Xy\207\251L\217\2449>l\305W\037x-\345\334\335\3051\226\007"
+	.ascii	"\252VV\234\035Y\037\203\265\375\247E\224i\021S-\227\305K\351"
+	.ascii	"[\324\021\275\2578\306\362\300\007\312\332\016\256\254\217A\224"
+	.ascii	"\375\247C\206\230lD[Kt\030TE\031y\273\213c6\017\200\352@\361"
+	.ascii	"q$\353cPc\337\234b\246A\376\021#\230\3124\2109\345\214c\255."
+	.ascii	"\036\334\242\204\320\335\305Ul\036\360\330\341Q\246L\326\277"
+	.ascii	"@\316~\272\225\002y\312\245L\271\322.3\216\343\030+^\232\323"
+	.ascii	"\301W\224\020\272\257\030\253\352\303\177;S\231v\375#F\370\\"
+	.ascii	"O\034\217\305q\334\001E\343D\211\226\254\177A\330\376\315\347"
+	.ascii	"?\215\231\252\3428\276B\223qUSO\372\2337Q\323\374\360\373\230"
+	.ascii	"\247\231\301\177}\376\"\246\024\020\307XV\322\304ql\322\331M"
+	.ascii	"\322\230\262.\2107\304ql\005\345\024/\231Pf\\VPf\\U\030\240\334"
+	.ascii	"\270\254b'\253/'\256-\023\312\211\253\252\312)^\302\020\233q"
+	.ascii	"UA\305\\VA\261Y\254\003\312\214i\311\204r\212\255\342\230+\016"
+	.ascii	"\212\241\230\254b\263d\025\006(3\256*(3.+\fPfLVP\361V\034\004"
+	.ascii	"\225|\241*Nr-a\250a\306d\025\233mYa\210\315\270\254\240\320\350"
+	.ascii	"\260\"\262B\244\013\312\315\314\213\206\331\005\312)\236\222"
+	.ascii	"\352\301T\025\004"
+	.string	"\007\225\334\212\345\342\330\304\022#\256\212\341\3428\2038\356\261U%\307\244\303Tk\202\233j\332\302\264e&\3438\346 \325\324\265\025;\301-\2311\034\224\223\2558v\322\204\024K\305q\034\213\260\224\204\213\213\230pK/\364\210\243b\304\261\004q2\216\245\342x\311\214\341\3428^\212\343X\255\352\221\214c\036APH)\2518\306\"\222\212{,u\211\021\307\031\213\0335+(\263\256-\021]\254\230!c\031\311%\023*j+F\306r\\U\333l\211J\034\025\307\261Y\267\221V6\350R-\265+\257\313\225\254\177A\274\323\036j\022.a\226Y\337\0029;\345\301\263D%\b[\326\267\340\314N\261\310\314\316,\311\372\026x\331I\0365\255,7\262Nq\240\312*2pY\337\002,;9\026\307\311\237\024\n\022\031]\322+\237; Z_\262\276\005OvZ\305\001\230\246\304\262\312\372\026\374\330R\351\224"
+	.ascii	"\3428d\016)\032i\215\036\2511W\324d}\013\234h\244P\231K\0165"
+	.ascii	"_pR\031"
+	.string	"i\214\364ii\215\331\221\254S' 1v?\324\262~\005p\233g/\211\245\2252\245K\300\034MMq\326\257\240\313\346C\373\314\272\270)\n\214/\017\325\313:j0\271B\2227\225\324\200\025e\312\016z\267\343\356\004!\243\303\016j\367\333\342Q\205)\353W@\265\351\320\3650\345@;\223\365+\210\261\177t\3162\307\261\342\304\313R\016\220\216\223#TY\317\001\305\224\234\221\311\372\024\320\355\207\340f7\346\\\3729\343\230)\016\322K\036\212\006\215C\327\240oP8T\016M\203\266A\331\240pP5\350\0314\216\251D\335\240e\216\276\241f\236\327\210\221#\002u\203\202\271\263D\335\240l\347\222\t\207\245\303\346\226q\034\243n\320.\350\232\tGD\217\351-\321\332\302\250\355\241n2]\2763\341\260\264\023\276e\034\307d\336\240n\320/\352\222\256\2710\2379=\322 \351\240s\2259\224f`\n\245\247"
+	.string	"l\237\002\257}\n\210\354S\340c\237\002\034\373\024L\355S"
+	.string	"\265\337\201o\277\203\234\375\016d\366;\230mtM\317\004\242\223\004\017I\326\357"
+	.ascii	"\266\337\301k\377h\032\232V\016I3\2235\212\366\243I\224\n\312"
+	.ascii	"%\323y\262\224\314z\313^\"7\203-\353"
+	.string	"w\350\262\202jA\261\240Y\320+\246\022U\242eG\253\240fpI%r\244 \031K\202<\311\236\366\343\024\024\327\220q\004\271\247D\317\236vR\251\212 \006\233\257e\034\307D=sz\244y\353\321\357\360c\233[\346P\252\301\024J\337\301j\237p\346Pj\002:E\354\327\264\025\226\227\365C\370\032B\265D\023C\241\\\331\261\214\202\025\206JA\307P2S\211\212\241`rP1\364I\035\327\222\261;T\231\025O\001\365;<\355OP\267?\001\333\376\004Q\366'\260\341\004\211\367\365\266$k\024\211f\241EN*U\013\210\223[b\275\201\343\321f\271\004U\2022A\223\240^h\023S\211\"Q#G\217\240H\234\314=\024\211\346\350\212\263\247\003\016\212Dw\270Y\306q\022\204O\327\036\034\331\2176\223\346PJd\n\245\237`\211\210.\242\324\002&\353KP\207\006A_@\205\230Jt\b\312\245C"
+	.ascii	"\3226\326\205n\3758\005\305N]n\310!h\017t\313\204\303\0223Y\211"
+	.ascii	" \326\004\212\336]\034\307D @\200\350\3612F\347c\353K\300\266"
+	.ascii	"/\201\226}\t\254l\324\007\252e*\017\006\375QD\314R\221\254/\001"
+	.ascii	"\331~\021\307ql\036L\252\036Lz\t\302\366%\200\262/\201\222}\t"
+	.ascii	"\270\366%\300\261/A\325\276\0043\366\217\342@oTi\013c\312\032"
+	.ascii	"\275q]\266\345s2\345(\223\226\365\217\332\260\372\361:\003\265"
+	.ascii	"\314\032\265Bk\240T?N\311\330\n\001uJ\370\276\256L%j\205V\351"
+	.ascii	"d\034\233\3456\245\2339\255\317\341\312F\243P)S\371\001\235\372"
+	.ascii	"9%c\2638N\002\375\326\324\371\300\222\3659\220\355\233\037R\240"
+	.ascii	"\276\276\276>\363Cz\016Q\366\217\322@\233\342\274YZ\312\372!"
+	.ascii	"\364\035A\312\331K\242\247d\2116\351;`\3134xO_yK\220h\f\364\t"
+	.ascii	"uBe\240P(\023:\303T\242Mh|t\311tC\2334\037\222\245j6W\243K\220"
+	.ascii	"\3761\205\322s\020\262\317A\307>\007\031\373D{\373Dm\366\211"
+	.ascii	"\312\354\023\251\355\023%\357\354\234\3124)Xv\272\216\251\324"
+	.ascii	"v4\0353\031?\204\272\021\354h:\223\212\002q\036\362\253GL\n\030"
+	.ascii	"\032\251>\221\327>Q\326>\321\214\375\3539s}d\372\274\262~\bf"
+	.ascii	"\334\274\031\223F\257\321l\264\234n\243\343\264\034\rG\307\321"
+	.ascii	"o\264\033\255F/M\245\236\323p\327g4\232\233d\346\342\264\311"
+	.ascii	"\261s\213\203V\006\316\033\030<\267/^\366\326\366D\274\275\321"
+	.ascii	"s\272\013\337R\317\3510\232\355g)\031/\245iW}a&\335\232\2460"
+	.ascii	"\035\264Ye\016\245\031L\241\364\033\336\3667\240\355o\030\333"
+	.ascii	"\337\340\265\277\001\310\376\206\032\373\021\354\355G\260f\377"
+	.ascii	"Z\3145\233\035\r\244PN\\N\262\316dD\\\213\221\263\352\202#\353"
+	.ascii	"G\020f?\202\264\375\b\306\366#\020\262\037\301\215\375\241\275"
+	.ascii	"\375k5\255\354\261\242\203\246\353\312\236\235\025>9g}Jm\006"
+	.ascii	"\265Es\321h:Mk1\225Z\251\263h\245\306b\352\251iesxwq\2344s@\371"
+	.ascii	"q\246G\177h\313\376\220\331\376\220\224\375!&\373CI\366\207^"
+	.ascii	"\330\277\256R\326\002\013\213L\227\231i\346\326\217\215\263/"
+	.ascii	"\036T>\370\334Y\323\364\225$\343\221#\257J\3267\335\216h1=EK"
+	.ascii	"\321c\246R\223\351082\215do\251\311\264\022\rv&\325\030PEo\f"
+	.ascii	"\23162\205\316\r\021\b\020 ~\212\350\035\211\002\352k\300\333"
+	.ascii	"_\246\335\021/\276\254\257\241\315~\bH\375D3\321M\316$\362'\243"
+	.ascii	"\253\306RC\321Nt\024S\251\237h\257\353$&\234~\242\227\304LK%"
+	.ascii	"xq\255\001\001\202\b\004Z\345C\315\333\326\272I\236\332X"
+	.string	"NQ9\262\276\006*\373\032\220\373\032~\354k\270\332\3270\265{L\241\364By\373Bm\366\205\224\373\327E4\221\324\307\2339VZ\210\036\242\203\350\027L\245&\242\273~\206\231rn&\343\330l\353\b\362\007\222\345\b@\236p\211\251\335i\"\232\353JLm\207\331\210\261\006\324\027\342\332\027\302\332\027r\332\317"
+	.ascii	"g?C\231\375k-\037(\033\26043\264\017-\243\016\\\336\225\254\263"
+	.ascii	"\204\354X>\211\223\223u\002\321j\203\0227\027\227\331\360\345"
+	.ascii	"\271\274\214\023\327FO\204R.\356\315\035\344\\\2263gzIBc\t\307"
+	.ascii	"\004\257\311\035\344\330\326\217%\234\273<\227\365\314\234Y?"
+	.ascii	"\210,s_\031\344\\\336{\313|'\223\0322Q7\302\226'\230\363\356"
+	.ascii	"T\243\261\3169\235\343\244\3237\364\224~\3226\264\216S\356\\"
+	.ascii	"s\272\235zZJ\323\3205\3168=C/\235d\316/\347\231\263\315\311w"
+	.ascii	"\3369\323\234c\316\274\323\356\244s\326i\246S\355\304\323P\247"
+	.ascii	"\233\263\357,s\2629\343\234h\264\323\331\345|\323Q\232J\3638"
+	.ascii	"\355\234b\3160\347\033\335\343\204;\345\350\246\263\316\311\246"
+	.ascii	"c\350\253sy\266\235pt\254\255t\325\271\247\263\364\216s\316i"
+	.ascii	"\346\364\242q\234k\246R\3138\271\374D;\323\236\221\324\210\243"
+	.ascii	"F\316\230\036G\322\024\231Z\246\261\222\222\246\251\ri\266y\305"
+	.ascii	"\345\311\311\361\025\347\204\342\2624\333\234\334\315\345<\223"
+	.ascii	"\316\223\334\322M*\213\r1\276s\206\232-qY\r\033\2503\213\313"
+	.ascii	"\307\230\021\251\345\333\024\026$\325\024$\232*\262\270\354&"
+	.ascii	"o\251e\234`'\2263\251\246B\023\234e\034\307Jf,\275\020\241Z\306"
+	.ascii	"\221\333\333\221\004y\"\273\366\316\254 <p\200e\276S\006Z\236"
+	.ascii	"\32322]\276;\223\310\024\316\336,\3438>\243\260\224\344\271|"
+	.ascii	"\307M\\^\323\227\371h(\227\231O\3138\343s\351g)(\216\203\270"
+	.ascii	"\235Q'\0175H\332\304H\3632\004\013\371&\213\2333K\253\310\362"
+	.ascii	"\214\322\261\004\231\3472^\033>\2471c\226\360e\276\032OZ\274"
+	.string	"\034\211Z\306\351\222\363B\216\313i\330\314@f\276\247 lZL\275\037\246\240\330\251\251\315\0263\3133K\3138}\004\tg\200p<\366\250\254e8\240\231\027\214\250Y\222\266\001~\205Q\213\002|\323p\277%oL\336d\375\022[\366\017t\373\361\303E\205\007\207\214\372\324\006\264\341\201\025\"c\262N,\223Z\330\322\035fa\230\304l6{\306\334\034#aP\252,sp5\262\006v\001v\001~1\253\252\352\0020vC\354\213\227\003\277\244O@n\206\200i\313\032\270v\242\341Kb\247\004\221\375\003\325\266\335\2172\206\026:i?\257L6\203-\r\332\356\353\211\345\220]qQ\217\2346\2104\261\262\345\027\006\f\022\247\013\225\022/\363)\353\322hQ\246|tg]\262\250T6\020!xNX\2003\300\344\245\031\223\257\250c>Wk\326<e\r<\313@3\240\225\003\317\236\004\236Y\240\007d\232\030"
+	.string	"\361P\2621I\253\244>\222`fG\200R\244"
+	.string	"\251<\303\021 \336\215\260\260\273\030\353\306\207\037\230<\220\n\0304\006\034:h\262\006N9\230\274,S\322d\r$;\0302o]?J4\355\0378f#\243\321\232\003'\246\203x\241\211\205\245V \356\204\224e\r\214\002\374:\020\354@\260\f\004;\373\372R)i\256\244\372\007BIs\374\260\226t\246"
+	.string	"\237\374tX\211\362\006\013\320\211\nv\327\246fFr\354\215\035&&?+=ceu\264\2746\034\325\rG\222\trKF\242#\316\217%i\nf\306\304\212\022=*\252#[HR4yH\2300D\216"
+	.string	"\207\350%l\226$1\362K\342\244\006\225\224\"h\235[\231^\030 \021UN\356\005\260\032Y\003\205h\0259e\311\233}S\t\f\222v\351,;\210t\275`\352\351x\312Sv\375fp\3552\2379au\220d}S\t\004\222\236\235@\027\025dK\013\220\334V\220\250\037\373\211\226/yT@\255\035\003\t\0329.\037=\264]\23226\200Y\007\366\370\363\r\263\215\0324:\"Y\3473\021\007fe)B\240\214\360\330\361T\345\366\244\343\300\035?\020\313L\323\267\204NT\326@S(\315sD\034\250\303\351\206\026%\300\034@\034<l\254\270e\311\372?\305\016\304\201V\346LH\326VV@\0337\250\272\350t\226-\266\370\352@\033h\225\362\254L\326\267\373\201\371\342\344M\326?\201\rH\005\244J\225aH\237&avXY\377\004-@)\240T\332E'U\207\367\245\337\340\354\334e\375\023\246"
+	.string	"k"
+	.string	"k"
+	.string	"UI\325\341\335\351/d\242\\e\375\023\216"
+	.string	"e"
+	.string	"e"
+	.string	"g\370\370i\213:\242\007\254Bd\351\004\204:pF\372\304S\307\254\213Y\032\243,\314\013QY\377\204,\340\023\360I\245\262\206\201\256\n\230\254O\242\016\260\t\330\224*M:Sr\334|\300\236\220!\313\372$\320"
+	.ascii	"\227\200K\277-{L\226\214\335\241_M6\354d}\022\312_\337\257/="
+	.ascii	"\033b\003\242\303\245OL\326'Qdo\257\003kK\306\334\250d\255\311"
+	.ascii	"\372$\256\362\362\302nt!\277\316)yqZY?\001yw\356\244]9n\b\241"
+	.ascii	"\373:\2458\211\331\222\365\023pf\307N\332\005"
+	.string	"$\273\321\205\374\221\315\300a&\353'\240\211\216\356gWE\325Ew\007\20477F\203\316\177vy\315]\220\274\254\177u\251\272\203\251\310\322\323\223\027\2168\311\372\b\240\263\\\376\346\370\220i>\020\200\006\016\234\337\234\212\027e\344M\333\tc\004G\234\377\346\262\0210ipi\324\033\256\032h\262>\002\272\270q\203\244\232[\273\313d\246\322\272d}\004$\323\244\371\311\255Q\345U\355+)\361\025\233\377\344\200SyO\316~k\300L\211[\363SC\005\f\n\226\254\325\240e\200dG\226xe}\004\324\370\241\371\241I\273\324\246\304\226_gZ\224/f\352\300\301\251q\314\262\230\312\002Uy\310\245*Qsoooi\227zE\005%L[\311\013\003E\315\315\215\315\026\344\017\225\036N\346d\375\003\224\261\261\375\332\314\262\230\n\306\332\222\261\257\250&5d\306\374\327\026c\213\231W:\203\n\221\256#Y\377"
+	.string	"H\302\204\371m1\313b*\323\006\327\222\261\2570=,2Y\377"
+	.ascii	"Y_\276\244][\220@>l\254\235e\375\003\310X[K\273\210\266\226\352"
+	.ascii	"\2509~\350\224yy\311QSS\265\250\346\326\230|\361\222\225\365"
+	.ascii	"\r0\366C\373\241\361\334E\035\321\373:\265\314xq\222\365\r\340"
+	.ascii	"\245\345\327\362\333B\264\265T\347\007O\252\016\357.7\221\233"
+	.ascii	"#F\371\337\026]\004\016\2167Sh\\y\321\312\372\006\350\201\005"
+	.ascii	"\313\217\236T\035\336]\027/@\264\356\310\3763#\373Y\021\202C"
+	.ascii	"\02479\305Z=T/*6Uw1T\217\017(\333\r5g\377Y9\030\240\254 VN\277"
+	.ascii	"\262\377\252\374?\225\215\0322l\373\227\374\217\312\377C\263"
+	.ascii	"l\274q\222\365M\360\262\377\337\224\377\327C\304\355\215.\353"
+	.ascii	"\233\300e\337\204,cc*\030\026\025\224\260/ -Y\254\224e}\023\240"
+	.ascii	"4i\362\013#\262cZ2v\007$g\307\027\032\330\177ag\276\260\354e"
+	.ascii	"\375s\362\373\372\377\333jm\332\316|\375\242\310\341\230R\222"
+	.ascii	"\365\017\n\321\2118R\304d}\023\212\354''\227\266$lu&d-Y\362"
+	.string	"\363\002\302\222\252\303K\275\314ei\375\220\377y\221\321\021\363\224\365\355\016\346\377O\343\350\"V&\353\233\0205\344C~I\314\240dS\334\024\222'\207^X\231\037\222\377\222\240a\222\261\221\254\177G\322&\260*\034Z\214\374\377\001\361y\001\002f\344W$\214\326\2321Y\027\371\021I\306\034t\234, S\262~\001\354\354\027`M\220 #\\\315\341}\371@\321\362\221\024\323\325\345R5!\023z\371\362&\353\027`\013\020 f\272\240\350\245u\270\300\204\311\372\005p\362\373\361\373\021%\256\353q\007\264\212\203\222#\353\027"
+	.string	"\207\017\037yeK\306\320\253\262\037t\262~\001\230\262\262\f\200FL\355K}\363\205\006\225\254O\200:\277\035\277\035\300\260)\261%\360\306\023\267\250\254O"
+	.string	"5?\034?\034?\035fYL\245VQA\t\373\312<\352\336\214\374r\374\247\003\310\027c\216r\357\377\017\0047G\224X\261a#\3552\313*\240jB\206u\356`\242\305\007\020+\2530dj\244)\331\225\365\tPEE\225v}!\365\2237epY\177"
+	.string	"|?\251\237T\332ET\207J\t\336\235\025:2D\262\376"
+	.string	"\270\374j\374j\204E\031y;\221\304\305b\262\376"
+	.string	"\306~1~1~3\250\214\360\365L\301C#\345\007\365\337\214\237\214\001L\375\234~N)\035\325\220/d\262\260i\223\365K \363[\372-\375\230x\374\264Qu\321\001\365\220\222\301\345\307d\352\035\241\022\003H\326/\301G^\336\356#\332Z\242\373@&\316C\376\302\274E\025\351\333|Y\310-bY\357\275>6qS\262~\tQ[\217\316\235;P\242\214\274\335\241P\256\272\234e}\001\240\261c'=#\332Z\262\343!\213:\242w\367D\212\r\255\256n\333\021m-\325I\277\242\214\274\001\261\334\320\3446\235o\273\317\231}g\316\334\320;=M\270\236\352\262\276"
+	.string	"\302\346\346\366\034\242\255\2459"
+	.ascii	"\250\232\252k\323C\360\244\270\231\263\227wvl\355m9\303 W\276"
+	.ascii	"d}\001x\355\013\300\310\2337\033\216\222t,\312\310\333]\024\216"
+	.ascii	"/N6\234;sofn\264i\223*C\270\232\303\333J\254xi\313\372\002pJ"
+	.ascii	"\223f\263Y\023S\373\355\220\342\343\315\232o6\30091\035d\326"
+	.string	"[\215\231\006\031\327\345\241A\223\236\021\355XJ\020\036K 4q\\\356\344\340\340T0q\203\354\351\361\026\277e}\022\334\336\336\322.\"1:1\265\273\036\0351\250he}\022\324\334\334T9\242\255\2459\037\364\246\352\332\356\266\216&`3\262>\tJ\332\3324\220A\346!\357L*D\344\240e}\022t\260\261\245]?\235b\2557\244\246R\346L\234\365I\240\021&L\332\305\0019%\307\355\016\214\226\2474j\276|I\317R\266)6_T\266&H(jkk\273\f\2706%\266<\217\344H\213[\242\246\366\303'U\207\227\305\204\321Y\223\365G\300\201\206\026f\212\315\027}\347\007\330\2151[\266\334\230\212\213\023\307\210\223\365E\370\201\005\313\326R\025e\344\355\353\f\233\261\346G\226o->vgpd\351\033\225\036^\326\027A\207\025+\251\326\324\024:\036\2469'w\334\314\314\3223\263,\246\022"
+	.string	"\262\256\307W\034c}8m,\261\301\313\372!\254\355\344N\3562\242\255%;\240\223)\261\345]\034c}\370\211\023B\243\006\225\3572\240\246'H\270\324\371\377\363\371\212\243fG\326\017A\b\330\006\333d\300*\006<\215Y\346\211\341\002&\245\007\t\037\225\216$\017\026\024\027\262=\266\305z@\314\331\301&\026&vC\b\222\344X\034\307@\277.yOpd\375\020\242\242D\t\322\326\223\224\003\313\372#\346\366\277\235l'\373I\016\212\235\272\336\324\342*,\0176\225\266;[\362\357+\211\215!Y\177\004\332\206\372\266\332W\333\206\251\334P\233IZ\205\214\213\200\361\250\2351\322jH\326^I&6k\306d\375\021T\366\336\215\235\003\316R\307\233\254\355\303\204#\222"
+	.string	"(f\2606\216\016MP\n\030scd\377\330CL8\254\240\330\t\355n\271\215l\036rH6r/\331Iv\221}d+1\225\333\310\326\372\276\3326\234\344l#{G\033 :bWt\004\351\033\217\323\241\tJ\001ds\313-d\0231\225{\310\211\222q\214e\017\331[;H\207&\250\230\211k"
+	.ascii	"oSM\3028\200\360\241K#\227\225\352\177\007\331/lI\016\251\313"
+	.ascii	"zw\251X:\310<e\375\021@\366\277\201\230\312\315\265\355\276\272"
+	.ascii	"\344=\216\030#]Z\373#\260\366G\324\330\273\307V\263\364\361\226"
+	.ascii	"\365G<\355\217X\332\027\201\267/\302n_D\234}\021r\373\33796\016"
+	.ascii	"\2636:o8\342\312D5e}\021ivN\232C\351\007S(\335S\273\n(LM\210"
+	.ascii	"2\353o\252\377\277\006\0301\243\314Zo\251Lf\tR*\353\357\250\037"
+	.ascii	"9%Y\250d\375]C\331GgG\326\233\306\216!\"L\007@\037h?\262\262"
+	.ascii	"\376\367\214o\032\277Jg\276e;.\364\355\331\311Z'\021\361=\203"
+	.ascii	"\347-\314rJ\326\027\341d\337\0043\3259W\371\346\354\030hS\314"
+	.ascii	"\245\205\347K\017\0174\r7L/d\375\2244\363\202\374Q\225\365E\354"
+	.ascii	"\330\377w\323f2\225\333i\307y;\355\245\355\244\366\361M\031\311"
+	.ascii	"q\327\307d\354J\252\017B\233}\020\320\366Ap\262U<UO\335\373\177"
+	.ascii	"?/Qq=\262>\bH"
+	.string	"\366\325\274\377? \0214I\236d\235\357\256\336\371\177\352X\225S\226\254\017\302\220}\265\216j\347\377\235{n^fd}\020~\354\253v\377\177!x\003\004,k\225\316\216\001BU\007?7eq\216\324]\245\223\243\262\260\344d\255\322\211\270Z\227\227`!C&k\037S(}\b6r\344\244g7\253\230B\340\321\003Dn\f\232.p\340\250qr\274\025\307H\225m\f\226e\217\225\2555jq|\320\\\265\211\223n\334\250kut\230\246\031nY?\004\0236lT\271\274%7F\311\262-\013\257I\326\252\034Z\247\341\204\351\323\313\372!\264\324\250I\317\326F\254eic[\313\372!\232v\\\\\274\226^\221Q\216e\375\"\273\255\236Q\317\244g\2778\246\013\301\004\315B\207\tM\326/\2223c&=\373\201\0207\305\321\205\250\"s\022G\307V\246\214\311f\226\305T\300/\251:\274\2578f\363"
+	.string	"\305[\343b\223\365\213\214\354_%C\306d;\343X\213\b\220\255h\307\2301tEnOBn\220\311\372E4\302\250`T1h\235\031_\305\346\f'`\210,\003`g?"
+	.string	"h\324/\352\227T\211\006\304\330\2225;]Y?"
+	.string	"V\272tQ\327\212\360|\316\272\234\271]]\253\023FK/\353\007\240\t\332\321\3244\363\2028F\306MqVE&\222\f\216.il<m\254\276\244d\375"
+	.ascii	"\350Pnq\242\267\377\201\231\375\253Y\324,\350\262\311\\\230j"
+	.ascii	"\247i\016G\326\377\340\314\312?b\004\265L\275bN\33112nR\263\024"
+	.ascii	"\002\031e\377\203!\373W\315\314\314) \304MqT\212\352|pC%S\313"
+	.ascii	"T2\225\312\224)*\225\0071\205\350a^\235\311\321I^\245\362\343"
+	.ascii	"s\213\302\343\003\032\373\036\334\021\023S\307.\210\3438F\374"
+	.ascii	"\002\356\211\336\262\254\252\310T\326ctv\232\035\232\032\\\224"
+	.ascii	"(*\330\203\316x\020\006x\006\312\227\251/S\251\202\241"
+	.string	"bkI\035T\2324Q\237\334\254\212\273\200\240\223\243\314)\343\225\365\257:\271\372\304\007\314\016(YY\337\316d\373\377C\273\352\300I\313\372\036x\355_\3652\225\252\027\212\246\200\255\370\252\004;\2771xYf\262\276\007E\226,1\247\230\311\230\212'\207\0072\324$I\314)\347\325\233\375\253E\324\"\352\221\017[\361\025\bukK\3062\0223\310\263\254U#\3122U\274d}\020f\366A\240\251C\324!\032\350\201"
+	.ascii	"\333\277\032$H\035\020DvWW\374\323\246\263\224QN\262>\210\033"
+	.ascii	"@\200\240u:\031[\361\334\210\022B\367\245\367\343\007Z\247\203"
+	.ascii	"b\247 X\220p\373j\226\251\372\360\301\007\200\263}\023\255K\177"
+	.ascii	"\025\353\246R\305Ry(`+\266\361a\214\027(z\277\031k\222p\tG\255"
+	.ascii	"Q\321X\342\205\273\177<=?=B$xM\nQ4&%\031\205\305vu\177p\013\357"
+	.ascii	"\272\002f\2172\034\025[\037\243\013\343\b\350\262\307$v\305p"
+	.ascii	"eS\030]\030GB\253\233\002\314\252\360\302\005J\241H\342E\212"
+	.ascii	"\rXxM\201\364\262\256\021\233B\230B\210\270\266p[<\241B\350F"
+	.ascii	"\360\302\256\021\005\013\257B#\221H\"\202#\025\301BG*\n\036\337"
+	.ascii	"\244\020\3077\351\205]\025\354\273\262D6\205\212\343\233\264"
+	.ascii	"A\013\357\272\202u\177\206\030R\bb\337\227\204\206\227\035\032"
+	.ascii	"Y\320\360n`\205E\226\330\252\360\031\266G\237\241$\227\205O\300"
+	.ascii	"\254\212a{\f\022\332p\244\242\020G\305\3265\302m\321\310\302"
+	.ascii	"{\2025Z_b\273\032i8\241BE\n\240\321\205q\244\341\250\330\026"
+	.ascii	"\213J)\212\306\326\350\302P\301mSx[\r\216T\364\036\025[\027~"
+	.ascii	"C\260C%\242\260\330\206p_\245\020\033\\\030]$\330XT\215V\226"
+	.ascii	"\250\341\267h\024\242\257\221\321\371\036Y\366\004\td\200\217"
+	.ascii	"&XxM\361\262 ata\034\375(i@z\333b\233\302\317{\f\262"
+	.string	"IF\244\240\n\024*l\200Y\025\016`Y\327h\270\262\n(\032\333\242\313\302\253\322\003\224\222\332\n\340\266xb\205\321\025\222\030\266\307\fG\305V\002C\366E\233\302\333\362\004\035\251(\204\261\335\300Bh\024A\321\001/\274\302\257O\020\206U\330\016\213\355\033\302\330\"\275+1\205!\273\302Q\261-\272\253\013\240\341\333\006\035\251(D\207\367\004\353*\301+k\024t\244\242\t\210F\241\0216\272(\332\b\216T\204\301p5\256\300\036\255.\333\202\004\314\036M\300\006\2036` \256\305\243V\305Q\261m\321\262B6\305{\342\205+TT\022\202\203/\013oK$\266I\351\321\020\353*\301\307\025\210%\262XW\274h\223\266\313\276hYx\333\f\257\261\205\313\252xY\270u]\360\034\251\210Mj\341\327\350\n\333\244\3245\246\360\266 l_\b\274m\004o\373\202\204\213\225\0020\373\262\356\220-\262\354\t\357\252"
+	.string	"\241p\325"
+	.string	"\027\331\227uQ\f\337\366\002\030G\034\216TT4\266k\006B\341Jt\244\"\227\205\331$\243\273\262\260\300\350\256,8\250G*\242\200\205Y\3421\311X\342\304\373\256\307$\243\260\003\214t\324\272G\b\274\355\357HE/;4&\241\020\201\023+J\220\b\242`\302\001,\004K\244\b\2528\201\341\035\032Y\030\276F\0160\216\306\022\024X"
+	.ascii	"\037\251\350\350\030\342\350(,*\245\300S4\312\350\033<:\366\300"
+	.ascii	"\301\342\321\021-\036\035O$\370\250\310\022S\326\205\366\325"
+	.ascii	"\357\313\272\303\341\252\3028\032\205\332\205\217\347}`\270\360"
+	.ascii	"\333\036\261)0\200\217\244D\\[\274A\t\204\034\206l\361\250%\256"
+	.ascii	"\352\220}\225\364\253~\205\327a\360\350X\364S4\266\260\220u]"
+	.ascii	"c\t\3421\211]qt\374\300\276\355P\320\212\267\365Y\001f\217\204"
+	.ascii	"Rx[\t\216\212m\013\357\n\373"
+	.string	"\034{`\fW6E\nF\027\306\021\320\221\212\214.\214\243\020o\222\261\310\232`3\270,\\T2\226\030\266\307 \226xLZU\030]\030*\264\360\256\360O\006\021E\307$v\205\321\205\241\002\374\256D\r\257k|\213\254\n\"\321\210b\002\022o\233\341eAb\002\tF\024\rQ\200\341\302l\022KdW\300\256\021\305\220uW\244\267C\t\016>!\024\025\035p\002\320\360=\301\016\215In\273f\370\275H\021$$\256B\242\n^w\005Z\341\325\304\260=\2520\210\255\273\272\306c\022\273\002\203a\013B\026\251\004\034\344\262D\r+\340w%\006\t\275\020\330\360B`\310\302+Q)II($1\301\013\001\023+$\200Sx\205_\340\220\004\374\256D\"\230\304\316\220\344\2220\2568*\2660\\\230\207\004\f\027\366Y\201}!P\\\205B@\305ve\241\205w\205#\360`D\321\202\260%\016\213+R"
+	.string	"R\237!X\b\025\241\350E\212\341\212\244\"\275\253[\302ea#\022.\333\302\001\307\226hD\004\013e"
+	.string	"\241\bv\327c\321\253\004\257\260\n\016\360\320\221\212Z\2420DK\024\016\215,\264D\241\372\262,\224T\f[\024\021\260I-|4\032W\030\266(`\366\310]a\f\350\006\020\212\330\244v\305\253dl[\260\356\221\303\221\212\216\224X\260\303\020Cb\253\304\202\003;4\262\360\203\200k\204\215,d\310\220\242\205w]\301B\351\r*\032\207,\333"
+	.string	"\241p\025:*\276\255\017\n\270\310\272\256\222\020\303\206$u\003\r\213kR\222\261\204\320\375\r\211F\005\034\255,\370$\031]\024(\240`\204\331\026\253\212\f\330\242\321\004\\d\223XW\351]Y\0268\350@\342\250(\324\240\002\350\205\273\302\253\t\241\233\006\331\244\026.*\271!\204F<C6\311%!\024\222\230\340\302\"\326\035b\321\022\327\022\305\023,\274\016\217J\025\\\330\272l\221=\332\027\201\204"
+	.string	"\220P\302\013\365%\020"
+	.string	"\004\002\200\220\276\004\002\210\020A"
+	.string	"\022D\354\223 \342d\203\032`\030\206\341\340\353\262D%\024\330\241\022\334\302\360:\304\006\207'ZxWx\017\215,``\203oKlY\254\260\212a{\334"
+	.ascii	"\007W\230\310\232`\223Z\230'\205\0376\230\302\004\033<\262,\213"
+	.ascii	"\0366\370\036\255\304\024X\"\213\365mMh`\203\303\023/\214,T8"
+	.ascii	"\370B\200Mj\341\r\037\251h\003\026^S\b\2250lYp\221`\265\004\343"
+	.ascii	"\361\005\n.\022\274\201/\013\257)\204\256j<\276@A\350\246/\013"
+	.ascii	"\257.j\342\004\n\027iE\021\306\360\327\302\312\272,\202\353\021"
+	.ascii	"\216\200\205\365\b\253p\222\222\212\363m_\220\030\266G\237a{"
+	.ascii	"\344I2\026\331a\360}Y\241\321=\006\207\355\021C\321\330\302E"
+	.ascii	"\266\005\353\036%\270\200\205Wv\030422\262-\254p\020\306\352"
+	.ascii	"b-*\271\032\274\301\025^M\024\215-\254D4\252x\217G\030\340#\025"
+	.ascii	"\275\307\243\020\3066\251\004L\\\3217(4\256\360\036\217|\340"
+	.ascii	"\225x\252E#\361D\"\022\317a\b\352\220e\217*x\330\327U2\226\030"
+	.ascii	"\026\225\214\356Q\317\3218D\322\360\252\"I\251\230\036\251\350"
+	.ascii	"5b\207C\"\333\032\005\001\360\302E\266\005\nG\306\0256\300\301"
+	.ascii	"\021!\024\215\357\312\272\251\211\020\202\\\030\211?HG-\022\320"
+	.ascii	"0\004\342\352\302Jl\361\027\034\206 \344\302H\344A:j\221\202"
+	.ascii	"\303\020z\206!\f\331\027h\375Ir\327 \374\272\255Q\260h\f\022"
+	.ascii	"Wa\320\350\3028\032Jr\327\267\035b8R\321\004I,\374\302x\177^"
+	.ascii	"\260\303\342\t\240"
+	.string	"\026-,\\1\260Cc\022\360\025\266\360\333\302+\374\006[xW\030\bI\b\267.T\274F\024$\260\360\352\016\265 4\022\205JG\241\017\233\324\256`\205\253\253B\321\001.\353\302x\214\300e[\243\026.\262\303\023Cw5\262"
+	.ascii	"r\001\211\005\366EJYx\205U\024\225\204\031XxM\301\272\320&\265"
+	.ascii	"\360\321\001CG\3056\311%\321\202\260\205U\260D\026k\221\305\300"
+	.ascii	"*\261J"
+	.string	"\017`\213-q\270\262&\\\226\2504d\221\204o\004G*\262\300\310\242\005\341Jd\021dl\341\325\r\036UV\330\266`\207\251P\270\006\207\256Q\310\272@vhL\322G\305vh\024\026\331}\244\242w\002\037\370HEI.\216!^\227m\321\272\303\013\336\264\005k\342%*\241pY\270\310\226\bb\3415E\222\013\024=-\330\341\311\001\3265\312`l\341\262op\310&\271kQ)\330\2720\006\330]a\025G\305\226\202#\025I\340\303\276h\223~\257\213\025\206\320q\303\261%\032\275A\024\303\366\330\343\002R\320\305\n\343\307\005\244`\220\013HHB\330X\204\217T4l\217)\230o\320h\330\036S\024\346\t\323\2049l\217'\\l\215(\216J\303b+\201\r<.V\n(\251\030\266\307\237b\313\002Lb\330\036\203`!kd$\004\273\354\361\005\033\204\211-\034,\032]h]#\022\021;4\262"
+	.string	"\003n[\254\256\n-\\\\\201\"(\266\253\n\256\021^]VC\n\027+\f\fDV($\301\302\253\3733<\nj\215G\230}\211\330\244\026\006\302X\211\354\220G\203P\211a\213\002^Y\264\020*\032[x\305\320]]\270\306\024\206,k4\344b\205\021\004\002\272\200\024\034\361\276\353\321\205\221\210\001\206\313\2660\nY7\210\364\256\256\360\347g\b6\376\260G\030pP\313sT\\\2116\024\333\365\b\303\233\024\034\256,\322\332\202\321H\f\272l\261]]8ht\205+\207b\273\036\005a\330\360\262X3\214pY\230\330\032ep\001)Xl]@JrYx\250\201\035\032Y(\262B\227E\261\242\003\334&\265+l(\266\253\n)\\\366\350\250uW\2700\022\211$\220\204E\245\225XA\220}\2252\274X\211\254\033t\261\302\b\016Yxu\217X\270\330jp\241uW\266\330\256"
+	.string	"\277J.\022,\204\026\333\365\b\310\n\213k\213\341:\364\201\225\216\260\2221\350\032acR\006\270\250d\024\006\211DV\030\334@\204a\243\213\004\007\341\"\333\276\305\325\205\211\340\327hd\02142\332\356\212$\324l\322\332"
+	.ascii	"\226\330\032\031\335#O\322\321\r\026\333\244\236!\313\036\337"
+	.ascii	" \\d\223\340Wi"
+	.string	"\003\303u(\035\266\307\037\366]YWXlY\342\260\305p|\203l\013\257\256\221\021\006\270Mj\211A\266\205\366\370\006\215\214~\214\214\202\214\307\027l\220m\341*\t\2130\206\031\330\2411)\310\nW7Hd[\260D\240\267\310\036\223\214\302\340\321\372\006\341\225E\213\241#\025\275B7\204\260\303[B\350f\330.V\030=\303\342\312b\270\262C\f\354\021\321\210\024\204\211\253\206!\373\272l\013\326\r\022\215.\\4\n\203.V\030\032\\\254\356y\244\"\245\2446\004\214t\324\022\215\210\210D\243\253\221\204p{D]\2540\316\227U\"\256-\322#\025\275pC\034\035\205n<\262n\b\330htC\360\274\301\243\326\250h,\361\302\005\036\327$\241\213\272\354\260mat\217C\366\205K\\[\227}1\274`\211G%\023F\304\025\t\310\016[\327e[\030\203\305\366\0028\250\036\255+\214m\360H\211x$\302"
+	.ascii	"\263/"
+	.string	"\353\016\213-\213 \274\276\301$%\027n\201=\276\023\364\260\304U\b\204]\266E\261\025\272\3036\t-\266I\273\005!\213$|\261&m\240\267\004qmQ4\266\360J4\036]\026.\236\020\272\033^\226u\217X\023,\361\250H\"i-\321\342h\224aH4\"\275\254\213\264\202\205\327\026-,$\301\016\215,\270\355JTl\225\266\220}\225\202/\326\244\340\013\227\207\310\026\213+\2220\370Bi\r\276X\223\200^\327\350\272\354P\n\263\257\221\221\221\207=\302\2001p022\302J\302\n\336\366\305\032<Rb\301\016a\245c\261\335\300\036a\300A\266E\013\257-Z\227\035vp\215\260p5\n\032a\2455xTl\221`\2431\351\r\n]\242\241\261u\331c\320\350H\f\262I\253k\024\024\272o\260}_\227\303\260\r\302mQ\311g\004\361\205\373\002\301\357j\024\034*\255,\202\257\022\213\367\007\016\226"
+	.string	"\027[%\325-\276\301\027n\220}\225\202F\257+\004\202\203$\210\200\213\255z\021\"J\\"
+	.ascii	"\201\006\250\260\205E\254k\024\206\020\032\205(\266kR\b\241\373"
+	.ascii	"\206(\322@4\032O\b\242\377y\266~v@9\326x\311\341\3711\367\223"
+	.ascii	"\303\007\034\016\036\255\237\234\252\3742\007\206\307\207\032"
+	.ascii	"gO\311"
+	.string	"\333]\017\365I\2315K-<Y\277\2661P\226h<<xv\224\275\220\246+\016\222%\r,\035X}h\276\2028\271\325\361\344\340\301af\317\316)k\023\230\304,OJ\326<T<T<6z\210\340\265\224s\307c\203\347j\217!\311\312\342\271\342\261\212\022\345L\\U\212\203\250\254\211\026OU\326\321\263%GG.\353\233\340\3013\203g\006\217\224\217\017ukK\306x\244x\242\360\302\310u\341\211\342\251ad\307\036\230j$%\303\333\233\342\241\201\202\331\261q\206&\353\233\250\332<M<M<2\264@xB'\246\306#\203'Fjg\314\fI\f\236\247\013\204\305\210\223b-\251\322&\203\307Iw\351(R5\254d}\023N;\251\2267\305\263\244\362\360\001\245\343\b\335\030\230\251> \037\035\036\033P\331\223V\215\254\357\356\200z^L\346\360\364\362\326|\304J\362\200x(\330<\335\335I\317"
+	.string	"\237\372\362z\334\321Y\322+18A\262~\t\273\375\003\355\374\230<\310\210R\253\223\272\371}\375(\003b\267\347\220I{\022\205\016\260\356J\036\024\263\236$T\364\232\350\200sr\234\221\263\227\234\303\207em\t\224\243dM\222\256\254yb\b\311\273k\3636\3008\0338\361\005Q.\343\300\001R\307\307\005\316\233\037\035\027\\\236\233\224\316\347I\313\223 n4\035\225I\035\033\235\\\\\034\220\r\221\017\304$\363\220l\326d\033fc\204\254Q\223\276Qr\031\222&\355\361\223\342\025\203\245Actn-\313+\353\227\030\263\313\224\001\236\371\261\201\327U\0370\213P\250D\344\322\025\346s\232$\306B!\005\235b\312LIm\202"
+	.string	"\003\026"
+	.string	"0X8\032\021\212\345Y6\024"
+	.string	"\016U\330\234tB\037\355Q\022*\205\020\214\f"
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\221"
+	.ascii	"\264$A\001\353\357\303\\\b\350S3\261\231\034\t\246\351\376\t"
+	.ascii	"\020\252j\377\253\200\225E\331;\306\226\265\345t\215\247d\217"
+	.ascii	"\032Y&O\234\330\217\250O\333\033\224\236H\343H\034%Uo\365\367"
+	.ascii	"%\343kEA\230o%\363sbs\370\257j\273\030\352\266\031\017\020\337"
+	.ascii	"$\276E\301\323\323\002\373B\245\260\023\227\033\241Y\020\261"
+	.ascii	"\330\242\360\003\016\203\215\3032\366\332S\252\357m\302\233\247"
+	.ascii	"\215\263z\305\345Ed\360W\346\240\200\311)\002\322AgMq(Z\336\255"
+	.ascii	"\340\245\226\325P\326\235\3409\207Q\016Yy\226\203\374|Lu(\304"
+	.ascii	"fJ\210\342\341\2039\003\265"
+	.string	",<k\374v+QY\204\006x\274\177U\200>\312\267\315\032\351\322\350\337\355c\202\263\354v\267\332\247}\311\341=\371\334T\177o\234\r\r\300&\374\231S\035G\260\211\221\004d XlV\216\322Dp\227\020g{n\355\264A\273\032/~\364\271\266Z\326Q}\351\230X\210\350\370Q pl\252\b\304\377\231\002\304\265\242\327\006\233Z\266y\035{"
+	.ascii	"\261\211)\256[\345\036#\f@D\037\006\301J\f~@*\346Ck\277(\br:"
+	.ascii	"\333G!\341\360 \241!Yu\030\341r\035*E\203\3046X\326J7\311\332"
+	.ascii	"\244\nSW\036c1\241\206@\177W\024\303\266\274\237\241\353\210"
+	.ascii	"\001\020\234\302\203\251\270\177\216\021\362\215\213\302\201"
+	.ascii	"\272\240Yc\356j\020k\2763V\372\263\352:\316\345d22[\232|\344"
+	.ascii	"\235\210=\272ip\364>\372\206\t\333Nf\266_\212gB\217b\t\230<a"
+	.ascii	"\274\260\205\243\335C\2651\177\357\357C\245\004\307\205\270\351"
+	.ascii	"c\271\333\312\201\350=\337\016\020\2626h\002\002\221\264\364"
+	.ascii	"\244\355\2574g\030~(w\315\215"
+	.string	"kb\211Q\003\240\237\342\002\304\002]\311\035\363\005D|\001RS9a\222*\032\005\365\211^\227\331E$\365\025}]\005N|&\203\n\301% \013\366\244\033\031;.\226\304K\206,\334\215\377\t1\266\274>S;\0341\371\025\346s\202D\267\350\270\220N@\272\343\277@\2704l\210D\321\240\353@M\360\260\211\017\214f\207\0073\220\270\245\334\264\350U\315\230)\241\257\206F\177\341Vf\365L\031\001\353\224d+E\325;\"\2234\035\220\357\2720\257\254\230\356P\377\273\211\202\276\230\266=0\006\t\226`\351[{\027\007\357\331\350`3\177h\266\300B5\203\\F\264\321\245\252\032/^|\247\2650\337\310\215\255E9$\002!\252:t\240\312\033\235Gc\016\370{\"'}\023^\027\016\236\322\233W\216\224Iz\007\277\017\033\013\376L\206Y\227\200\223;\345\372zH\233H_\212\265#J\016\306y\2639"
+	.string	"\207\006\376C\370\377\2741y\236%\020I\020\371\246-\265i\366\233\b\366\224\374,\206;\027M.\346'\212\303\033\314G`\332"
+	.string	"\345\271-\324\267u\352\025\377\004T\002\273Op)\351\320\341\320\253\204\t\005\027H\355\306@\207*\240\272\005\t\360,\004\350\261\006\265\237\242\270\3541\026D\366\206\004\256-w\236\243j\256z\264\202\206"
+	.string	"\t\b\252\037sLW\"\"\246\203\252\026\277\320\030dN\257\375#\334}kF\235\355d\300\246Sl\350\335\310\0366\220\322\336\033\257\353\310\222\230\r\337t\314q|\314\022e`\341]F ;{\271\246\375\355\bu3\315\345Z\340\212\n\253\206\363\020Z3h\203\205b\330L\260/Do\305k\361r\005\217"
+	.string	"\036]M\213<\332H\255;Z\323\203\252\230]\340\2221%\262\032\371t~^A\242o1\244\036\322\022\005V\337\313td\034|\226\232\372x\013\033w\036`\301T|\361\037\034\273'd\376\"\250\212\030\251\231,\263\201\na\363\350\313t\231W\367\257}(\234\020'P\001\272w\216w\275L\344\377p\337\343\250~\215\262"
+	.string	"\224\353\332\271\253,\304$\324\277\021\230\346\210\340\377>\250mO:\250Y\271\266\331\223\360H\"\354\327]~\275\237\2162\233)\225\002\353V\223\377\324\357\f\"\346\177\337\""
+	.string	"-\217?|4\212&n\301\254/\266\002"
+	.string	"\r\251\213U\260\335)\224\307\013"
+	.string	"q}\264\022\266d\242:\005\262]\003Y\265')2\246\244Ha\262\313\345$\021\260ir.\016R|RYJ\341\337\bK5B>\337\235\234\001> \314\303`E\353hT\231b\306\222O^\324J\352GY\305M)LpC\212Gt\177\006\215\016\203\313\370\276\344\034\351z\321)\f\215\031\346\267\332\277A\376\261U\035.`\013\216\006M\247'\271t(\306o +'(y\221a\322\3552\307\024\204p\\\201\3648\263^t\326O\257G\001\272\263X\274\366\026\311b\364\261\352\005t,\265\034X\355BB`\222\275\234\250\021\027D?\326(\343\212b\367ble\202N\204\352\257\tC\311\320\377\343:\337\221\331\214\321\372i\300\032\233\257\352\223\305\222\373\231\002Qj&P\3674\217\300d\253\020\r(\371,)\301Q\267\313\321\247\352\233\255\256}gv"
+	.string	"\0277V\300\273\353\005\025\230w\354\231\320CH\021l\266\350d\f\2074E\241\350\335Db\337S\272rl1\305\r\343\253\"\241=\001\330\016/\344\332\227\265\355Fd\302\350\356bml\302\230\250\354\226\213\361\277\032\335w\"\303\013\030\304\342\031\346\250aJ9`\346\034\033XK\007S\n\007$\n"
+	.ascii	"1V\242\037@\220\272\345[\n\2717\336\310\201\250\\\241\3507?\256"
+	.ascii	"n\375\274,\310\021d\301R<\034[\314\353\243\274\265\\yT\001\016"
+	.ascii	"\250\324\270\035\037\233^y\242)r\033\260\030\202\252h\253\367"
+	.ascii	"\317[\317\257 1,S\r=\237\036\311\301pJN\200\357\273Sk\260\246"
+	.ascii	"\355\363\321\312\361r\360j\b\245?\217\253#\027\301_\213\332\013"
+	.ascii	"$D\240\376y\206+%H\352R\266O\013P\277Y\023\210t\005\211\232\340"
+	.ascii	"\025 <\324\266\2474\325\265\024\376\221\227\354U\200\023\360"
+	.ascii	"s?|d\ts\325\236\365R\376e\202\206\253\2616M\256\247$\325\325"
+	.ascii	"\003\354@\244R7c\354\313\375\331\245\211\262\200\n\327b\024V"
+	.ascii	"\364\272\234\331\"Q#\037{\344t>\310u\312\367\264\277\377~n\337"
+	.ascii	"PQ\250\244\306H\256]\236\266\\\025\002Hp\305\341\241\300\223"
+	.ascii	"\r\331\211\253\377\227\260\027\025\311U\003\344\223\377\214\025"
+	.ascii	"{\242\022\2406wU)6\033\271\224\022\033\252\273\312\316\337\\"
+	.ascii	"s\023\320\324\341\036\032A\020\264\214Mr\261\221-T\224Y\206\245"
+	.ascii	"F\037\251\321\304K^\312\234\253\177\250\251\251\356\276\364\""
+	.ascii	"\007\341\242\315\\\314\230\rm\3258.\317\3545k\222\\\256#\247"
+	.ascii	"\217\242\272\346\n\005\273\240\246\030\235\331\311\371\271\373"
+	.ascii	"k\201k\263T\230\322\206\364\264\374G\371\3130\334O\250l\256'"
+	.ascii	"\017\002\024q\353[\220"
+	.string	"\322y\177ny\203A\027\375p\271\224\034\301n\332\356\217\345\342\247k\360Q\032D\007R\212\361<\006\034u\tqX\247^\026\367\320j;8v\213\357Lh\226\305@\234\267\2315\346\202\270\364c{\213\3621$\342\230\336w\341\213\252\027\037\227\313\275\256a\337\fi\202Cx\3575\375\006\262)\205\021P-f@\314\341\205f\212\265w\243X\363/\267\203\374Y\270\223l\021\005\017\300\2257K\262\322\227\006\037\024\022\312\254VNs\310!\352\200\033=\240\221\200\213/\276\243\265`\366\377\377\347\265\234\320\261\306!z\367e\377\020\301\243zh\270\2469\303b\202\224*\306\357\021\237\314%\002\316'\355\252h\034@\241d\232\372\225D\023t\337\363\343]y\322\304\275>{\017{1\004\023-E\363!&\272\216Q\306.\017\350\026:U\023\363\272~]J\025\257\207\314\363\017\214\251\372\204F\376\033;\335\367,\367\017j"
+	.ascii	"\347\261_\214R\332\324\372&\004\344w{\263\323\001\023'`\330\312"
+	.ascii	"\242bl\022\203\217\247\027\t\227\276E'\376Y//\206W\365`\357\245"
+	.ascii	"\365\314M\333wN\227\355\031\340\256J\3654\336\360M\236\317\362"
+	.ascii	"\036G~^z/\360\336\336\235@yB\204Fm,\263\344\356\311\315qZ2\320"
+	.ascii	"@\334%#\230\372I"
+	.ascii	"f4\237Y\004\244<8?\n\240v\366\001\256\021\020\331\344O\270\003"
+	.ascii	"\300\034D\twX\340\251]2\365\205\206\366|G\260u}\325\324\260\223"
+	.ascii	"\204S\225\360"
+	.string	"\301\276\227-\001\242\005\261m\301\241tFb\301_\214Q\225\007\215l\020~\241\t\220\273\277\276\307\322\032\354\374\004\037\005Vq:\002\321\247\311\270\212u\341\277\275^\274I\310t\254L\341\306Fz\343\323\023I\207\244=\016\252W\313\346lB\324\306Og]\300\312@y\230t ~\032=\rs\004\252\315\034\204\206\205\330\375\347f\263\235\304\242\225\230w\215\311(\250\261\360T\006\311!\024\263\340\305\013\232\253\312\367\022\252\361\025\b\335\330\022zJ\037\006\356\312\204\334uPj\3604%q\361\314k\256\334\267k4\235\276#\003w\236\325\307\214\346\353\201\302\017\225\246\036$\372vd\023\334W\251\337T\2619\323.\220\033>!\324\"\342zl4\351,<\222&\263Y\256\202\356\316k\022\363\037\361\213\330Sb\024\352x\221gF\2212t\354\302\001Y\215\312\252\224HK\025\004\274\266#\236\210\rc\370\336\037\00219"
+	.string	">\210\374u\303\030\202\201o\331\026\357\322\244NbG_\037\217\002\356\232\333z\005\257\231g\267\216[\r1\255\323\315f\221\257Gnc\322]\313\027`\255"
+	.string	"\200f \334?\250\331PT\224\232$\376"
+	.ascii	"l\351?:\020.\200\253\206\343]q\n_\r\\\200@\022kf\233\245\270"
+	.ascii	"\2724\026\035\323\370CgQ\371$y\306\363\2336_\250\026Y:\305\005"
+	.ascii	"Y\27658lg\n|@\266\245\tC\374\277\240\r\301#\243.\032\333\323"
+	.ascii	"\312\364\266\355\016\370\265h"
+	.string	"\013\"\272\025trU\273\330l\0278\035`M\227'\354\037\013\360k(6\241\034\230&,x\032\301\233\206U~o\025m~'\374\361\346\273+W\334-\243\321\267\272^\363,\345\210\226\030n\3076\207\246\\(5\344\342+QNW\034b\251\366\273\026pG\201\210&\f\b\033\366\224\240\370b):\345?k\233\344!\315\033\372\n\t\211q\334W$\033q\001=k\312\234^\233\022s\367\301{\365j]\036\001\307,U*\361\344Cv\352\211]\266\374\211\232\227Aj\362kf\357\206\215\024:\234\272\001\307\033\327\352\341\3561\314!\246O\301\"6`\212\022\254\371\231\310\225\277\360\315K\321\026\033\t\252\220\007\376\036E\245\301\266\220,yr\355\220\177\312\253x\033\361\245W>V!\300\334\367A\362\361\nN.\3170\253v\270\260\214n\b\254\357:\246\203\222\320\343\035,A\365N1*n\212\003\221C\r\332n"
+	.ascii	"\253\364\321\354j\005P\262G\340\317\205h!\246b\335\347\364\346"
+	.ascii	"\204M\221m\336\235\342$\363\2405\013\324\007\322o\035\377\177"
+	.ascii	"(\275\274\217\245a\340j\350R\252\343{Ow,&]EbQ\372>$\302-\267"
+	.ascii	"\302J&\321lyt]\222\016\0247]\260\200\277@\342\355\206\206~\007"
+	.ascii	"\241\2564\001;7\025!\035\273\274OS\"\212\301\245\232@\210\201"
+	.ascii	"\307\n\343\246[\224$\027\300\345\331\0067\177\002v\t4\361V;:"
+	.ascii	"?\335\314KiZS.J\233\350\305~\224:\223\230k;`\332\243'\201tL\250"
+	.ascii	"\017\201O\036z3\030 \2763\365/\237\021\205\344\323\215\2779L"
+	.ascii	"(\312\202\023/\216\236 )\347\240w8ct5d\201KQ\206d\377\325\251"
+	.ascii	"\277 \341,\036?@K\3549{\341$:\242\302DO?\235|G8Y\256\255f\304"
+	.ascii	"\320\375\206\032|Y\314H\316"
+	.string	"\003\303\241T\254\306\255fn\377\235,>3\005\316\2170b\006\267\252T\266\325UV\255\2179#\250\300\347\001\242\336!\333\224\004\017N\304\270\021\031@\r\246\311X\274\"\247A\312\350\262\326i\271\241\331\023\253\360*\216\312\330,(\370\251\252\2041\357{\232 \021\0066\372\r\255>\037l\032\316?\333Z\021\220\244\262\343\272[;\210\211J/\255,\234\363\335\344O^u\254\345\302\2117\024\261\331\2032C\337\t\020s\256\301\252\364\017\363#\316\236\020\n\351l\342Hs-K\227\373\177K\232\215F\376\214I\257o\302\335\233Q\241\202n\231\177\004\256\216\306\240\334\237<i)\272W,Yp\036a[S7\004Y\277i\211JU\017==\200\007\252\233\367\315\237\317(\3634\360\361@\212n6\t\0209\256P\027@D\247W\321\363\353\310\355\" \366JR/\304u]\3510@o\n\0067zX\224\364m\254\207"
+	.string	"\036\177\320\017\346*\032\364\240\331\227\030:\343\013\375\034\025n4|\242(\354:\001\341\0302J\034\251y\303\"k\320"
+	.string	"\373\021\224t\2344\373dm\350\024\314\320\234\300Q\276f\036\367\234\265\263\350\306\217\206\002\273\013E\236A9\013411\212/\274\332\331\320\356\314\007Y\355\017\275\211J\317SC\200\266;\377O\354\210\255&\264s\016\3306\233H'>\360\275c\025\243;5'\340\030:\\\224Q\r\254\016y\310\343\325T\267\257U<\212k\362\332\200\321\256\264,\027\263v\242\037\312\\\224\353\365\344L\343\310\243E/4E\237t\230\005N\372\026F\207v\216\200R\352\026\253o2\251\r\202\241\354\312\337\237\006\001\3121\355eQ\"\336\327k)\224\302\357\330\263\034\247\200>\250 \377\327\004\364\323K\025\016\332\212\310\035|\334\336\260ba\326%\231\030\255i\357Z\314}H\203\236\350\027t\302\302"
+	.string	"e|\036\r>\211\224\273Vk\003\321W\363\334$\300\257\265*M\374\037\204\023\352\b\342\203\n\341\227\317]Gp\036\224\245\304"
+	.string	"=\243\326\\M:O\326\261\266\226:\007v6\330O\274\t\034\013|2\233LuL\211>\214\fL\210o\351\2012o\016*1\216\371\rH\335\275\212\001\203\214\003o\321!\267?\343\354,@Zn\020\330\330\272\365\244\233\305\255j\233\301\324<}\304AV\035\200\235\356I?\207\001x\237\301\361\252\334\3628#\002j\217\215\261[\301V\b-iGv\340\200\300\227\207\023w@\206\307\232\344ZG\320\367l\252\022~\336\234\t\337(\330A@\257\372\3002&\025\356L\203\223\235\231\rd\023\224\304\002\\"
+	.string	"\266(U\221\n\237{'V\022<c\004\376\002\217\200,3\2106\335N\370\301\252\351$\031\304\036\364\342\366-v,\321\360\306\274\352\265-\235\275\300\006\377\031\332\316\303\032\352\374\346\350W"
+	.ascii	"\034\036\363-\254\223f\037\216\357\324\346\333\374\374B\223-"
+	.ascii	"\370\273\204\222\357\031h\342,K\027;\266\257km\341\034\217qP"
+	.ascii	"\377\340\244\273\312\310G\350_<\321\232i;\234Q\356\245r\344Y"
+	.ascii	"\255 \306\334u`T\270hv\025\300\224\227\033\2502\017\276/\004"
+	.ascii	"#\322\207\363\227\216\225\2630\252\260H[g\216\t{L3-\3337\226"
+	.ascii	"\372Y\331L\327\b\240\335\006dQ\033\312O\2731\032D\241\242DX\230"
+	.ascii	"\211\2208Maq\232E)f\004\247r\355\245\263\361E/\007\217\352pD"
+	.ascii	"\233\"\335m\344@:m\032&\345\367i\201\036\377\326\345\362\002"
+	.ascii	"\217M\0335\317,\206\337\236\316B\261\254\305\266\3719\037_f\333"
+	.ascii	"\027\021\"l\314\333-\263\002\271a5\355\275\332\226\371XOA\227"
+	.ascii	"\205b\222\242,@\003S\205{X'\006\004\370\265\020\336\330,\266"
+	.ascii	"\313\003\260\252\311\37155W9\265\306\346w>X\016\200\256I\016"
+	.ascii	"T\275X\260C\032\233\302\243\b\204\262\003\267I\007\223\025ue"
+	.ascii	"\356W?`\354a\370\353"
+	.string	"N>U\317{\340\007u\243<\262\370C\247\335\243\263\007\214k\367\027|\224\242\335\021\217\307\256\206KNn\3757\375!\307\362\307q\016\035/\022Byu\256\220\303t\005\311\362\362;\366\262\251y\341)K\365\312\227\210D\013\231FQ\021\357\371xk\021SO\364\330"
+	.string	"\234\037\207\261Ij"
+	.string	"\340\312\371\243\207\034\274\223\"m\222W\177\031\371C\220G\306~\263\267\023\277\240?\274\332\321\f\b\244Y\365E+\303\177\216\020\"z\t-\200\026\324,\253\271,/\315\034y\031\330\"%l6>\342\254\202\020\275Mz\277u\030\323\027\247+;|v\236\245G\331\031\233&piR\3048L(3,\260\204\333X>e\373\356\203\326\352\234.;S\356Y4\244/\300\304\305\336C\033l\024\232\336\206\003]\016\240-\225L\257ec\240\227\306*\020\271*\250N\305`\336\354\360\323\2232\336\006\221\242\227\037s\256\207\236*\224\023ic\030Q\f\333\372\360\201D\343k\247\036J\220w@\003\303\005\335"
+	.ascii	"D\251{\013\334\3764\211\310\004\353%\301\023J#\026la^\030*\241"
+	.ascii	"r\271\\\320\325\034\263|Wl\t\324i\337@2\251s\020\216\255\022"
+	.ascii	"\204\\W\321\2316|a\330>\230>V\320\337\007\361\315\"\357\220\220"
+	.ascii	"s\272nYH\310\215\341\316\033\3458\020\340\276\315\252\026G\021"
+	.ascii	"\367G\020QNc\366\360\\\213\327m\303j\373\306\215\3728\342\334"
+	.ascii	"\357R\200\343-\216\270\364\212\030^\216\332\017\215\013Q\357"
+	.ascii	"Q\323\250\033f\353\035\352\302q\356\255\306\225v\300<\207$\233"
+	.ascii	"\036\364.oG\202\210\177\013\t)K\224"
+	.string	"\220\337\313\330\023n\346\217\177\201\344Ou\3451_\234-\235\340\312\031\240\330\371\224u?\205\235\267\227Rn\376\262R5*\364\200|g\375\253\241\006\r\346\341\365\337C\005\230\364\3718\202]v]\371Q\341\235T\345@\b\271\372b\335AXT\254\265o?\375\366\303\313\350oC\205R\237y\304\327G\312\210^\023J\254\252)\033)C,\221\262pc\261\375\204\303`\003\272D,\0362\315\333\370\210'\345\2027\360\037\224\t9\200\n\334\377`\033\226'\347\f\301\035L6V\201\377e\004s\271\272{\321\r%\201PR\021\242^\004\351\321j\224,\026\371a\332\230O\347(\035\320\202\355\375\022lz`q\242O\201\363V;dx\257\001U\027k\036\374\335~%\277m\376\37136\220\274;\b!\303(\347\247\323E\035\321\361\037(t\007 \237\201\272K?\357\r\222\177\200\261\rXs\025\0257p\371\312\275\r"
+	.ascii	"\272\374\301\305:Cm\007\203\376b#\313\221\317\376\362N\317[\027"
+	.ascii	"G\355B\240^j\330\236`\207g\035\310\245\242\231\301\336\260\203"
+	.ascii	";\374\270\252\246\374x\360\365^r\207\333\226\237`\220\357-\361"
+	.ascii	"E:\367\217\007\034\023\377\325+\3031\034\316\270b\301x\346\003"
+	.ascii	"\344\021M\233\374\375\230\315\021\272\220i.\221\347\017b\r\334"
+	.ascii	"\342\005\233^\001-\276=@\303\313.\246\336\302\326\030\340{\347"
+	.ascii	"Y\364\344R}\226\267}\333\273\377\247\365_\214s\244\235P\352k"
+	.ascii	"\252\007\255:\2547o#G\326\325<\247ao\272#>9\204\0077\337\300"
+	.ascii	"\334\252\332,\360u\200\2342\367n*\375\223=\334d|\327\3410&\377"
+	.ascii	"\005\316K\022\362H\273/\351\270\247FCa\220[\323\352:P\306\247"
+	.ascii	"\214\375\0057/\332a\313L\206\230\366\207\314\312S\316n5@\375"
+	.ascii	"\371\346\275\024?0c\204S\255\264J\246P\031\267\212\372\363\340"
+	.ascii	"\214I\354;\026yMZM8,\223$\336\336\305\377\246{\214s-\004\037"
+	.ascii	"\177\230Q\016a\350tr\272\216\274\327\fe\2052?4\374\241\207\345"
+	.ascii	"m<k\201\247\320\210U\335\333\354\335e\302W\237\317\246\304\354"
+	.ascii	"y\350\226\363.d{\372\005eg%\364U\343\341\347F\261\240S\263\257"
+	.ascii	"\216\243\235\270\342\361\233u\213\335\334\340\275\305\361\353"
+	.ascii	"\272\347\r\006\362\033\353\232\374eg\026_\017\375?\213\332\254"
+	.ascii	"X\256\2072\177\f\361\345\352H\021>\036\276\f8\016\004\272\215"
+	.ascii	"\371\003\331N2\357\017\211\223\240\001\\\226\177\233\331\343"
+	.ascii	"%\bw\374J\230\340\027oG\244z\026Z>9\354\r\245n\362\030\213\227"
+	.ascii	"d@R|\375\217Z\347\341>\3332\254\372Q?\322u\005^\356\026&\017"
+	.ascii	"\325\347=\366\n\024\217\240\267\3214f\201\275\366&-\374\3430"
+	.ascii	"\304\227\333\033\235\336\313\026l\366\273\261\347K\036\017\361"
+	.ascii	"\017\300\373!\372\317\207G\230\230m\224\366p[\355\351R\271\313"
+	.ascii	"\202\236\t\333\007\303\262%;\215\373\235\031\276\226\335\205"
+	.ascii	"\2671^\364\331\203\367\253\003f\355\277&\371\212{%\017<\304\004"
+	.ascii	"\203\342\337Xk\323\214\246\261.\226\254\261\312\367\312\020\037"
+	.ascii	"\212<\363\352W!\201f\316\332\265\362$\003`\311\310\033\021\374"
+	.ascii	"\027\310\211\341\217\256%\357\376\254t\300\237Y\264\377\206\370"
+	.ascii	"\276\334\371\240\332?\357\016<Ow\374\301\266\343\252\345W\363"
+	.ascii	"\211\371\bq,\207\243\361?\315$p\345p\025\306\225@\357\3612\324"
+	.ascii	"\203O;_\256\272\330\307#\357>\215\300u\363\334\330\371\266\373"
+	.ascii	"5:\003\263w\240\371\013\331x\330\013\b1\032\270\321\023t\337"
+	.ascii	"C=\247\343\237\255/\003\360\013\252\331\227\271'\355\226\240"
+	.ascii	"\rv|J\373\243\357p{\270E\200\373\2642\310/;;Z\327}n\024\253I"
+	.ascii	"\356\212\356\004\354\b\217\313\317m\337^\313\240\361\253\260"
+	.ascii	"K\2705af9\210\376\001"
+	.text
+	.section	.gnu.lto_.symtab.fb5dcbd45bb43ae8,"e",@progbits
+	.string	"AccInflightCalibrationArmed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\003"
+	.string	""
+	.string	"InflightcalibratingA"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\003"
+	.string	""
+	.string	"AccInflightCalibrationActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\003"
+	.string	""
+	.string	"AccInflightCalibrationMeasurementDone"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\003"
+	.string	""
+	.string	"AccInflightCalibrationSavetoEEProm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\003"
+	.string	""
+	.string	"magHold"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\003"
+	.string	""
+	.string	"canUseLaunchControl"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\003"
+	.string	""
+	.string	"resetArmingDisabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\003"
+	.string	""
+	.string	"updateArmingStatus"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\003"
+	.string	""
+	.string	"disarm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\003"
+	.string	""
+	.string	"tryArm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\003"
+	.string	""
+	.string	"handleInflightCalibrationStickPosition"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\003"
+	.string	""
+	.string	"areSticksActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\003"
+	.string	""
+	.string	"runawayTakeoffTemporaryDisable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\003"
+	.string	""
+	.string	"calculateThrottlePercent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\003"
+	.string	""
+	.string	"calculateThrottlePercentAbs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\003"
+	.string	""
+	.string	"isAirmodeActivated"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\003"
+	.string	""
+	.string	"processRx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\003"
+	.string	""
+	.string	"subTaskTelemetryPollSensors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\003"
+	.string	""
+	.string	"taskGyroSample"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\003"
+	.string	""
+	.string	"gyroFilterReady"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\003"
+	.string	""
+	.string	"pidLoopReady"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\003"
+	.string	""
+	.string	"taskFiltering"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\003"
+	.string	""
+	.string	"taskMainPidLoop"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\003"
+	.string	""
+	.string	"isFlipOverAfterCrashActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\003"
+	.string	""
+	.string	"getLastDisarmTimeUs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\003"
+	.string	""
+	.string	"isTryingToArm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\003"
+	.string	""
+	.string	"resetTryingToArm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\003"
+	.string	""
+	.string	"isLaunchControlActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\003"
+	.string	""
+	.string	"pgResetTemplate_throttleCorrectionConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\004"
+	.string	""
+	.string	"throttleCorrectionConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\004"
+	.string	""
+	.string	"throttleCorrectionConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\004"
+	.string	""
+	.string	"throttleCorrectionConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\004"
+	.string	""
+	.string	"osdLaunchControlModeNames"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\004"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\003"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\003"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\003"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\003"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\003"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\003"
+	.string	""
+	.string	"rcControlsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\003"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\003"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\003"
+	.string	""
+	.string	"servoConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\003"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\003"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\003"
+	.string	""
+	.string	"targetPidLooptime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\003"
+	.string	""
+	.string	"cliMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\003"
+	.string	""
+	.string	"blackboxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\003"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\003"
+	.string	""
+	.string	"armingConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\003"
+	.string	""
+	.string	"flight3DConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\003"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\003"
+	.string	""
+	.string	"gpsSol"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\003"
+	.string	""
+	.string	"pidConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\003"
+	.string	""
+	.string	"pidData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\003"
+	.string	""
+	.string	"currentControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\003"
+	.string	""
+	.string	"activePidLoopDenom"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\003"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\004"
+	.string	""
+	.string	"isUpright"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\004"
+	.string	""
+	.string	"compassIsCalibrationComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\004"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\004"
+	.string	""
+	.string	"baroIsCalibrationComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\004"
+	.string	""
+	.string	"accIsCalibrationComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\004"
+	.string	""
+	.string	"gyroIsCalibrationComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\004"
+	.string	""
+	.string	"isModeActivationConditionPresent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\004"
+	.string	""
+	.string	"accHasBeenCalibrated"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\004"
+	.string	""
+	.string	"processRcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\004"
+	.string	""
+	.string	"resetYawAxis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\004"
+	.string	""
+	.string	"isUsingSticksForArming"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\004"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\004"
+	.string	""
+	.string	"writeMotors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\004"
+	.string	""
+	.string	"writeServos"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\004"
+	.string	""
+	.string	"isMixerUsingServos"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\004"
+	.string	""
+	.string	"mixTable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\004"
+	.string	""
+	.string	"blackboxCapture"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\004"
+	.string	""
+	.string	"getArmingDisableFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\004"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\004"
+	.string	""
+	.string	"unsetArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\004"
+	.string	""
+	.string	"rxIsReceivingSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\004"
+	.string	""
+	.string	"setArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\004"
+	.string	""
+	.string	"calculateThrottleStatus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\004"
+	.string	""
+	.string	"getAverageSystemLoadPercent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\004"
+	.string	""
+	.string	"isMotorProtocolEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\004"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\004"
+	.string	""
+	.string	"isArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\004"
+	.string	""
+	.string	"warningLedFlash"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\004"
+	.string	""
+	.string	"warningLedDisable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\004"
+	.string	""
+	.string	"warningLedUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\004"
+	.string	""
+	.string	"statsOnDisarm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\004"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\004"
+	.string	""
+	.string	"airmodeIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\004"
+	.string	""
+	.string	"isFixedWing"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\004"
+	.string	""
+	.string	"pidAcroTrainerInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\004"
+	.string	""
+	.string	"imuQuaternionHeadfreeOffsetSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\004"
+	.string	""
+	.string	"GPS_reset_home_position"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\004"
+	.string	""
+	.string	"statsOnArm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\004"
+	.string	""
+	.string	"blackboxFinish"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\004"
+	.string	""
+	.string	"blackboxLogEvent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\004"
+	.string	""
+	.string	"gyroAbsRateDps"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\004"
+	.string	""
+	.string	"pidController"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\004"
+	.string	""
+	.string	"beeperWarningBeeps"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\004"
+	.string	""
+	.string	"isFirstArmingGyroCalibrationRunning"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\004"
+	.string	""
+	.string	"gyroStartCalibration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\004"
+	.string	""
+	.string	"updateRSSI"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\004"
+	.string	""
+	.string	"failsafeIsMonitoring"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\004"
+	.string	""
+	.string	"failsafeStartMonitoring"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\004"
+	.string	""
+	.string	"failsafeUpdateState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\004"
+	.string	""
+	.string	"pidSetItermReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\004"
+	.string	""
+	.string	"pidStabilisationState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\004"
+	.string	""
+	.string	"pidResetIterm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\004"
+	.string	""
+	.string	"beeperSilence"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\004"
+	.string	""
+	.string	"processRcStickPositions"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\004"
+	.string	""
+	.string	"updateActivatedModes"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\004"
+	.string	""
+	.string	"processRcAdjustments"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\004"
+	.string	""
+	.string	"failsafeIsActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\004"
+	.string	""
+	.string	"enableFlightMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\004"
+	.string	""
+	.string	"disableFlightMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\004"
+	.string	""
+	.string	"rescheduleTask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\004"
+	.string	""
+	.string	"mspSerialReleaseSharedTelemetryPorts"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\004"
+	.string	""
+	.string	"telemetryCheckState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\004"
+	.string	""
+	.string	"mspSerialAllocatePorts"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\004"
+	.string	""
+	.string	"pidSetAcroTrainerState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\004"
+	.string	""
+	.string	"rcSmoothingInitializationComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\004"
+	.string	""
+	.string	"pidSetAntiGravityState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\005"
+	.string	""
+	.string	"updateRcRefreshRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\005"
+	.string	""
+	.string	"calculateRxChannelsAndUpdateFailsafe"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\005"
+	.string	""
+	.string	"rxGetFrameDelta"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\005"
+	.string	""
+	.string	"gyroReadTemperature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\005"
+	.string	""
+	.string	"gyroUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\005"
+	.string	""
+	.string	"gyroFiltering"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\005"
+	.string	""
+	.string	"getTaskDeltaTimeUs"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\005"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.fb5dcbd45bb43ae8,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1652 @@
+	.file	"init.c"
+	.section	.gnu.lto_.profile.20f361f66f6501e1,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.20f361f66f6501e1,"e",@progbits
+	.string	"(\265/\375 x\255\002"
+	.string	"4\004l"
+	.string	"\005"
+	.string	"\323\245\377\300\b"
+	.string	"\001\233\364\343\336\006"
+	.string	"\002\365\203\335\343\t"
+	.string	"\003\345\305\206\300\007$\002"
+	.string	"\001\002\002\003\002\004\002\003\002\005\002"
+	.string	"\002\004\006\002"
+	.string	"\002\006\002\007\002\007\002"
+	.string	"\002\002\005\352\263\360\321\b"
+	.string	"\006"
+	.ascii	"A\221\007;\b\252\374Jf\347J\336@\033"
+	.text
+	.section	.gnu.lto_.ipa_sra.20f361f66f6501e1,"e",@progbits
+	.string	"(\265/\375 \242\275\001"
+	.string	"\240\226"
+	.string	"\004"
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.string	"\001"
+	.string	"\001\002\001\003\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017"
+	.string	"@"
+	.string	"\307"
+	.string	"\210\253\2520\220\345e"
+	.ascii	"p\\R>\264\032 7\340e\007\313\242\024\001 \230\r`\001"
+	.text
+	.section	.gnu.lto_.inline.20f361f66f6501e1,"e",@progbits
+	.string	"(\265/\375`\200\001]\006"
+	.string	"\002\006\025 \220)\351o\233\036}w8\321\032\007\215`\335\367\320\322\206\037vw\247\017\002zx\200\032\331R\246\027\030\236\326wT\242\n\270(DQ$\007F\233\312E\370\330\352\270;5m\362\323\032\030\377\323\262\237p.\002\360\211\336\335\005\372T\330e\322X\f\177n#2 @\002\202\030L\036\227\007F;\300\005\272\004\2122pW*\243@?\001\314\003P@p<\202+\016XK\253\016\200\253CS\235\242\033R\t\020=\320cx\233A\275\205\220\017\322\013\242\0250\256\241\002]\200\213\270\210%\\r"
+	.string	"\020\027\366W\235\305\356\301\300"
+	.string	"p\026G\f\036\r\363"
+	.ascii	"\035\311;\202\032*\340G\303\b\022\230\203C\264\352\2409(\201"
+	.ascii	"\213\353\006"
+	.text
+	.section	.gnu.lto_.jmpfuncs.20f361f66f6501e1,"e",@progbits
+	.string	"(\265/\375`\002\002\205\t"
+	.string	"\"L'-`M\222\0160\264"
+	.string	"\3125\216\001\332\022P"
+	.string	""
+	.string	"T\025\234\217Lc\0305\305\022\031\236b\013\2003E\220P5\t*\320\306&\204\310$\003Tp\250X\024\251\324\034\271\"0\032\027\240C\026\251$,"
+	.ascii	"L\222[!6\266\265f\270\362\364\363\344\370\344z\233\346\347\001"
+	.ascii	"i\260<\034\006A;\235+\3045\221?g\360\340\217\b\316A\211\211\276"
+	.ascii	"\261B\345\355=\036X_\356/\327\271*PT\ne\212g\030\303\2568&\226"
+	.ascii	"\330\026\327\022\005\334\361\321\340\222\216\363\305\225\\M\215"
+	.ascii	"\2476\023\217lIF\250QAU36\245,s\240\002\221\253\242\007\022`"
+	.ascii	"R\312\nRf\306j*\255Y\377\016-\372pf\bX\024\246\332\266d\025\336"
+	.ascii	">\022\221\236\t2\243\203\212\374\372L\313\037\323\331\335\367"
+	.ascii	"\b\207t\2354\345\244A\003\307M\223\221\354\224F\242\374\367\365"
+	.ascii	"\001\217Z\025B8\0177\351B7\214\370\256w\037\002[\344\030\335"
+	.ascii	"\240\036z\030\257:\324\313\030\344\020w\337\244\304\250\351<"
+	.ascii	"\205I\337c\246\013\351PP\216\355@.\260\023?E\267\022\353.tp\006"
+	.text
+	.section	.gnu.lto_.pureconst.20f361f66f6501e1,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"\230\004\001\200\004\002\200\004\003\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.20f361f66f6501e1,"e",@progbits
+	.string	"(\265/\375 #}"
+	.string	""
+	.string	"0\027"
+	.string	"\002"
+	.ascii	"\002\001\003@\00207(\033\b"
+	.text
+	.section	.gnu.lto_.lto.20f361f66f6501e1,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_processLoopback.176.20f361f66f6501e1,"e",@progbits
+	.string	"(\265/\375 \273\335\004"
+	.string	"\222\b (\200k:"
+	.string	"rdSW'\212Pl )\245zS\210\177lovh\330\303?\222I\254\260\"\252\307\003l\370\026\311\235R\226\"+NQ%\205N\021\261P\251rhD0\305HTjQT\245\020\267\317\255\360H\210\315a0)\366\001\233\233\r\033\336\307Q\315\256\344\343Y/\220\271\330>\344\313\336\234\263\354\273N\244\373vW\263\362\353\360\362\217\371 \323\260C\301aw\r3mr\347\r\266c\t"
+	.ascii	"3\003\316\231!\340\313]\303\323B\030/C\200K7fk\273N\013"
+	.text
+	.section	.gnu.lto_requiresSpiLeadingEdge.177.20f361f66f6501e1,"e",@progbits
+	.string	"(\265/\375 \361\275\006"
+	.string	"\002\r05@o\222\016X\202\251\314K\243\234\374\334Z\340\376-O\370\20783\222\030\343o\312\017VE\013\334B\023-\212\242\341\353\0163\303\312\233\320L\231\031kb\t\221)\025eMT\016\323T\347cy\254H=D\217\325"
+	.string	"\021)L\"v6_\021\025\026?\327\205E\315\226\325&N\305\263\370\r\344\236\3077\223\231\371\353x\227\271\220^\026J\231\241RL\262\300\225\220?{\315\357\334w\244$YK(\026\310\334HQ\311L\204\013\002\n9\335L\205\231\016L\205\377\t\n\331Z\267\217PG \027'\244\314-\276Q\265:\355\326\244\004\"0\034-(\"P\035"
+	.string	"Cf\3560D\031\375\3657\370\017~\215\007"
+	.ascii	"2\003\202\341\243\302b\025\020]\363O\035\302\274\256I\006"
+	.text
+	.section	.gnu.lto_swdPinsInit.179.20f361f66f6501e1,"e",@progbits
+	.string	"(\265/\375`-\001\035\f"
+	.string	"\026\026P@0O\233\016D\020\0053\271\234z"
+	.string	"m\203r\003\374:\233\206\t\024b\004\223\032\216\330\220\327D\3148L\375B\205X\247\331?\227\247C\2668\340e\260\262\371O\001~\207\361\230\314\254\365&R\246\024;"
+	.string	"@"
+	.string	"<"
+	.string	"\273{\351\205k\237\242\244\251\371Tfw\357}\302u\237O\026\0367\b)U\270J\003F!.(\035H\262td\340\356=%t\034\231Tfw\235\\7\341\246n{c[\200}\217\231\351S*(V\020\020\331\355\210\001c\303hB\303E\277\375{\256|\017\377\240]\344\340\273yL6\022*F\273\337\345\321\001$\217\376n\231\036%\257L\217\326\354\026\377@\226\302\220\"\302\210\027\001`\207p;\310\310\250\204j\310\234\351z \004\013P\216X\222\224\332\0134\362\334\325\0029\304\274\334f\320 \317Q\n"
+	.string	"\334\020\202\364c\177\237\324\220}iw\327\372aW\027\335T\246\003\031\226\326`6\260\016vi\022\\\035\314"
+	.string	"\347\322x4.\214\305\231\002\004\236k#\313<W\365\355\245\325\217\002\"\341\003\345\230.\342\025\0305\004\342Y\245Z`H\245\031\024<\311:q\316\204m\362\234\255\033"
+	.string	"3\2411)\360\200o\301\276r(\004\306\245\203\034"
+	.ascii	"\017\330\027\020\032\020\255\203dMED!H\325\340\227\310\347\204"
+	.ascii	"\231\001\316\213\271\f(J\220\257.\013\330b\\\326\2408\220\005"
+	.ascii	"0cJ\241\240"
+	.text
+	.section	.gnu.lto_init.180.20f361f66f6501e1,"e",@progbits
+	.string	"(\265/\375`\237\016\305F"
+	.ascii	"\nu\024\032@@dR\007O:\256\261\230\002\252~s\022rK\327\305\241"
+	.ascii	"\333\341\263tYnYf$\316~\2737\177\345\315\235\345;\204)?\233>"
+	.ascii	"F\370\327\217]\ff\233\207\"\365\207BI\272\355n\"SJ\001\205\001"
+	.ascii	"r\001\224\001\337\254\373-t\277\363\360\373\377\333\267\236n"
+	.ascii	"\314Y\031\026C\271o\032/\031l\024SY8]\234\215\273\324}\352\271"
+	.ascii	"\333\273\333\264\261\335\316\327\300\316\246\347P1\247\361s8"
+	.ascii	"\267f\032gp\235\245\022z\032\257\3536v\327\363\016\256\273\272"
+	.ascii	"\215\316\266\017?\323\276\347\345\254\f\210\237\351bY\033k\013"
+	.ascii	"\3613\235\001\375\250\235\301\261n\306\345\3328\241\002\354S"
+	.ascii	"\"T\312i\274d\202!?+\327\331v8\217\203]\232\244\362\232\306\316"
+	.ascii	"\341\034\024\017\316\032\307S\007\3166\002\327Y&?\266\316\276"
+	.ascii	"?\265\3166\334m\310\247k\261\333\025\n\243\263\306q|\225\257"
+	.ascii	"t\321\205So\246\207]*\352\b\365\344\324\304\264\244\224\204d"
+	.ascii	",\022\335a\313\n\363\303\355\303\016\007\326\352,\373\326<\225"
+	.ascii	".\325\305\243\204\024\276\254e\316\347\354\"DZ\024\346\207\313"
+	.ascii	"\037\331\034\212m\313?iq'-Y\276I\310\372\305\251s>'\026a\006"
+	.ascii	"([\336\274\r\3323Y\031[\363\245a\2076\316VY3\205\273\246\215"
+	.ascii	"\255\271\322\231'\3619\317\314\036\251\314\215\302\006\325<E"
+	.ascii	"\376\305Y&<.\341\322\344sJ\371b\024'\n\033\234\345i\342|\316"
+	.ascii	"(\302#\237*\204\\\316\253\2768\241\357V\245\215\221\371\220\317"
+	.ascii	"I&\366\f\373\366\211\263`"
+	.string	"_/d*=\277>\033\237K!U\034\307.\347\257\344\371\365?\354\020\307q\177\3639\346\r\300\273\235\256\273\241t']\b\303\334\r\243\301T\250\276\262\262\333<\314\020\302\036Y}O\035\216\266\335\360\025\030\313{\263\315P`m\323k\225\tkI#\245z\255\262\202\330\034uq?\270\315\215c\246\205v@\336\007\273\225h\235e3\0078\277\2638\2510\373\361\346!\367\2516ga\366\260&\313\037\354v\252\363\201\301\264oiX\f\374\366\336\204\337Zgsf \246\321Y\034\231\327\017\266\007\336\201w\303q\260\031$\275+\225\271 \217\032@6G\333\201\177\316V\f<\353\255\327\372\031\317\343\301\215c0o~p\3014(\300\023\302\216\337\021\321\276\305\331\036Q\202\035z\027jM\240xo~\366;S\300\262\262\215yW\224\bsT\216{v2*<\373\230\262\314J\227J{S\226s\264\211\264\0222"
+	.string	"1\177s\202\230\277\210\305\353\001B}\267\213\027\357M\t\331\343\366\360\256\325\030\003\350Pe\370\236\323Z\235\321\b\353I\0215\351\273o \337\233}D\213\257\325eVvO\227\237\243\335nEW6\246\263Z\267\326\006\227zk\360\251\267\004g\343]E\345Ro\003\356w\001\367{\312\375&\360\337\003\376[\300\177\007(~\003\030~K\271\337Q\303\357\243\373\r\345~?\271\337N\377\335\344~3\271\337K\303o\245\341w\222\373\215\344~\033\377\273H\374&\272\337\356\360{\370\337\255\033\317\366\\r\274]\336\266\266\326Y"
+	.string	"y"
+	.ascii	"\"(\231\033\234TT\226\302\262\026U\350\372\202\331\252\361\307"
+	.ascii	"\334\375\276\275e\240\362\361\215{\265O\373*\257\031\271wn\256"
+	.ascii	"u\026*{\231\024@\327\247\237\362>\325:\345\2477s\312)\244\374"
+	.ascii	"y#C\212\361\356o\235\335\313F\215\241A\027\377\336sZ\367\367"
+	.ascii	"\256\355~\363"
+	.string	"\3368Ji\004\361\256\325\257\254d\0034b\314Q\342\0267\264\260;b{\262m\241k Se\261&\2509M9\t,\021u\305;\3357y\367X\273\350\262\t\027\307^c\317\344\275\243\367\356\355\265{^>r\016\"\321\324\352uo\037d\235\257\030\254^\253L\257D\350S\355Rfz\261\245\234\002Z\347\215\254\304'e\245\334\177\344\355\213\360F^\301~\003\275\203\250\262Rv\244\234$\342\273\337\277\027\360\275\211\224[<@z\324eV\026st)\020\2315bV\353c\032\2677\303\ry\t\314\215K\253!\033\310bB\207\333Zc\2461\027\210\371\213\002\177\t\267M\365\233\350\275^A\2515\301W\032\363\017\350\335\233\324}\257>\b/\0238\362G/\243\327\321;\370\016\266\316n\310-\240o\206\305L\303\352\251\342bv5\200\304P\231Y\251\364+\274T\340'\350V\370+\f>r\244uVC\326"
+	.string	"u\363&\365\372A1\244\r/T\fO\\\002?\231Y\331n&2\361@@?\004;\201\241\300Ph\353\254\233\203@\353\256\322\t\017;l\326\006\215\303*\310\026\215"
+	.ascii	"\215\303j\013\251\205\344qu\203GT\343\260\352\241\225\265C\353"
+	.ascii	"\006R\307\214\032\\3\266h\\uqmuieu!h\022+D\250`\221\336\325\225"
+	.ascii	"\205\205\345CE\215\031Y\\\306\254.\035>Nd\351\250\201$6\226U"
+	.ascii	"\017\244\026\362\n\313\306\225\026r\306\216+,\256\256+\253co"
+	.ascii	"\361\310\342\272\352\261\265\305ue\234zyVkb\332\036\325+/\273"
+	.ascii	"\300\373\305>\325N\345\002\177\246r\2125:W9:sp\350\220\322:\344"
+	.ascii	"\030\330\356\375J\013C\215\361\302\270\310$\266V\231l\242\270"
+	.ascii	"!\273#\342\314\033b\245\306\251\343\234\023\007\317ZgXfj\255"
+	.ascii	":\223\244^ro\201 \030*Sj\217 \032\021\214\236kT\2166K\340\341"
+	.ascii	"|\036\201\f\303\254\357M\232\344\203|\233r\255.\217}\366@\rp"
+	.ascii	"\007\344\241\031\325Ze>\375A\006\272Q\227N\002\\@v5\201mTf_\224"
+	.ascii	"@]O\222\203\212uP\347\265\332\224\243=\024\264\244\225\263 %"
+	.ascii	"\007^\225\305\252\262K]\030\307q\314\364\300\253\262V.R&g\331"
+	.ascii	"\227\346\314\217\374\004O\376\265\335I\300d`\033w$uP\274\344"
+	.ascii	"\234G\246\217\335R\216~\275\243\3713IF\254\035\332\334\243\351"
+	.ascii	"\313%\005\223\327$\243$\243\244\243\344\340\027x\371~}\335\023"
+	.ascii	"\257\310\373\334\303\275IX4\265\345\035\231/\363\036\021{\223"
+	.ascii	"$i\227\274O\2561\352\313\004\271\340\217\221\222\217\357\017"
+	.ascii	"\363B\001\363B_)\257\031\332K\345O\220\312L\312\321\016P%@v5"
+	.ascii	"\177\201\321\352\025=9\036\200\226\227\255\003\201:\250a8F\225"
+	.ascii	"B$\"\"\"\232$\205\f\007\221\005\304(\005\031\236\007\021\020"
+	.ascii	"1e\254\212$\311\262\006\232\312\024\255\244\301\335T\362\323"
+	.ascii	"\022\026O\254\003xj\352:\230\366M\211\254\n\302ff\227>\275k\237"
+	.ascii	"(\350\256\223\362\013\355\224\275]\336A\004\300\223\2647;\252"
+	.ascii	"\355\212\316W\316\242\027\373\023\241S\tr\223\203\211/*#\334"
+	.ascii	"\365\3065X\301\323-\300\023H\334\202\0377\322d\226\177\310:\341"
+	.ascii	"\276^\033\373\356p\217\352\345\317o\235$e.\r\312\316\373\032"
+	.ascii	"\366.l\225Sx\316\2243\367\266\256\205\346\206\267A\327Y\001\334"
+	.ascii	"N\376\245F\025&v.:\301A\304\373_D\253\316\217\311\026\360\237"
+	.ascii	"\365@\352\360\334\310\376\033\031\337\2664lA\220V\f\303t\303"
+	.ascii	"\"\315\210:^\364\244\025\205 \303\020X\344{q\332\017\207\355"
+	.ascii	">F\302\271\330\346V\372\375\377\266\312WR\244\253\314\377\001"
+	.ascii	"\211\267\274\333F\236\220*\356\237\375\226*\342s\207J\345 \320"
+	.ascii	"u\021\362\266w\373\216\235\306\355)\210\353\256\205\003\264\270"
+	.ascii	"l\242\200N\024\353\"\024h\004\332`\026\257\305\231C\220\352\277"
+	.ascii	"\024\266\007\005\207\207BK\203"
+	.string	"'\277\221\343\207X\367\366JN\036=\303\022\0048*\307\255\347\\M\016\260MlpX\373\303\0066\264\277\036!\233\221\353eI\245D\nz \034\252\325\333z\336\225\\\334rW\316\204\r\335\210\024\222\302\013b|\016\315\313\322\251yP\354\256\205\210\236\341\356\207J\030\365\020\223V\016\302H\333\311\221\355V&{\257\357\3068\013\240\351$M"
+	.ascii	"\372I: G\334\234\324\326\351^/Ozk\262\252\310@_\300\333\222$"
+	.ascii	"/\352M\250\265h\307\004$\271\323#\375\2516o\220\345v\307\b\241"
+	.ascii	"S@\340\021xY\235\351\252E\321t\221\242\313\251;\250\362\367\270"
+	.ascii	"\254H\270C\3632\276T)\247Y\312\257\367\031\332\365!\270\352\006"
+	.ascii	"\004@\2045Cu\315\276+p\276\004\272.a 2\211\250q\230\261\021{"
+	.ascii	"\371\307>(\264\302\247d~x\345c1\017\023U\201\201\345\b\3648_"
+	.ascii	"\320\251 <&\254\017Ij4@bO\226$\022\230L\321\277\250\243\245\204"
+	.ascii	"\3657\233\347\375\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.20f361f66f6501e1,"e",@progbits
+	.string	"(\265/\375`\250\b5\026"
+	.string	"6\351\212@\200\032k\r0|y\003{\355O\310%J\013\323\220\275\206\230$\f`\031\245\333.\347X\371\360bH-l\227{\034t\252\016L%\221K\344\374'\244\204\026Zh\021\033\303\257\205\270\024F\322O2\201"
+	.string	"x"
+	.string	"v"
+	.string	"ur\365>\261z\241T\275\201T\3579\365F\221z\245D\275S\240\336\036O/\025\247\267J\323k\205\351\275\262\364\202Qz\303\264\330V\034Gb\231\244WL\007\324\013N\273\344\224\013R\371\216:\310SA\243f\351\251\226\242~!*\217\222tC\215A3\216#\n\237b\241\201\272s\203\023zk\020\337\0313lmrA\257\fa\221\215\255-n\034?\216|m\005P,\026\213@/\215\231q\034k\312\357\233\211\327F\211\367\006\211\027n\304\033'\342\225\013\361\342"
+	.string	"\361\346\370\360\352\360\360\356\350\360\316qx\3536\274v\032^3\303{\207\341\305\273\360n\261\360\346Ux\365(\274{\023\336\037\022^\037\021^ \020\336 \017\336>\007\257_\203W\210\330;\204\301Kd\301[D\301k$\301{$\354E\002\366&\371z\225x\275K\272\336?\256\227n\353e\242\365\002f\275M\260\036\016\372\261\262\177\312*{x\016\355\241Y\034\030\203+\256\354!\211e\367\234Yv\217\226\275cn\331:'\227\215scv\3317\245\227mc~\3316d\221-"
+	.ascii	"\314\016PV\351Oo0\314\026\236\265\361s\301b\234\263\205e\207"
+	.ascii	"-\370\334F:\273g\235]\323\316ni\332%\357\354\024x\266X\236m4"
+	.ascii	"\352\331\302\232-K\266/\310\b\366\021\030-\2263\332Hg\364\211"
+	.ascii	"\243\212\035{\215\307^\253\033\355\265\002\366Z\217\2556\264"
+	.ascii	"\325\f\330j\007l5\037;\355\374\261\323L\004vZ\td\247\221A6\032"
+	.ascii	"\321F3[\363\0068F\310>;\207\3543\223\310>#O#\333\2544#\217\354"
+	.ascii	"\262\023\311.3\223l2\263\366\223\013\334S\262\311\312%\233\214"
+	.ascii	"d\262\307\316&{\314t\262\307\312'\233xB\331D3\312&\226R6\221"
+	.ascii	"\234\262\203\250\034\200\207\250!\b\203\221b\005E\225l\034\200"
+	.ascii	"\203\246i\r\0210PJ\210!B\"\036\021\310\007\317\032N\257\302\312"
+	.ascii	"!\217\263\023\271\342\362\263\214nC\373\245=9\b\217)\214t\251"
+	.ascii	"A><|v\251}w\032\344\335\347\346\302:\217\"I\033\233\347O\304"
+	.ascii	"\360^\321\360M\030\022\262a\020\b\004aQ\203\340\344\263\003J"
+	.ascii	"\201* \th\002\026\001IDR\240\b\250\002\232(\336\"drR \257\225"
+	.ascii	"j\b\314Q\231C'\017qeD\350\003\024m\n\360\254\035\206\001J\200"
+	.ascii	"\363\325\252\001"
+	.text
+	.section	.gnu.lto_.refs.20f361f66f6501e1,"e",@progbits
+	.string	"(\265/\375 m\315\002"
+	.string	"\322F\025 \220+\255\001o\267\2431333\243\330\335a{\340\273&\204W\035m\333\272\366G\276\210\225;\005\377\\\332s\357D\347\034\354\215\301\326\024,\206\360emYW.\245\334\223\201\225\\\032\271!\312>\324\016\301\r\365\"Z\021H\023\320\210K\r\367\202\f\300x&"
+	.text
+	.section	.gnu.lto_.decls.20f361f66f6501e1,"e",@progbits
+	.ascii	"(\265/\375`!P\275S\001\n6\212|V \fa:\215\001B\037SOj.'F\317\264"
+	.ascii	"$\027\316o/\274N^\370Z\031\037\353\352\37296\205\372\210\020"
+	.ascii	"\275f\314\264Y\336\266\253\2521x\265\256[\202w\370\326=\2629"
+	.ascii	"\377|\310\344\n\374v\271R$y9r\022\t\033\251\320<dj\371I\335M"
+	.ascii	"n)S\342\006\310\007O\b\017r\322\007\212\323\007\342\242\017\324"
+	.ascii	"D\037(L\037\210K\037HK\037\310I\2777\247\337#\243\177\274D\346"
+	.ascii	"{T\364{G\375\336\017\375^\f\375^\225\376\217\033\375\0376\375"
+	.ascii	"\037)\372?A\364\177\272\364\177\252\364}\352\364}\310\350\373"
+	.ascii	"\\\321\257r\211\314\373(\321\367\321\241\357\303B\277\347\215"
+	.ascii	"~O\030\375\036*\372=a\372=2\364{\244\364y\346\364\265\324\321"
+	.ascii	"\335/\327\214\375\341\242\t\316X\312\303q]\225\265\023v8\237"
+	.ascii	"'N\227n\372m\227\310<\017\026}\0362\215\343\260\232\2134\302"
+	.ascii	"I\240+\306iE\f\234\317\203D\247`_#\363w\327\310<\217\227>O\n"
+	.ascii	"}\036\243\306g~\374\206\265\370\354\320\302b\303\371\"\361pl"
+	.ascii	"\006\310\215J\033\0378\177\247\215\336\201\323\337\271\242\237"
+	.ascii	"\274D\346w\240\350\357$\321\337\331\241\277\263\245\277sB_\273"
+	.ascii	"\321\327e\364u\232\276F\352\353\036\372\356Kd\376,K\332\216\023"
+	.ascii	"\327\22188?\204*9\250\222lix\212\023\027T\336\266\256`,X\r\257"
+	.ascii	"]$N\303V\216\323\260\024\343\032\021\330\324\350\322R\307\203"
+	.ascii	"\002c\257\340\311\327R\372:t\372:]\364u\216\350\353\260\320?"
+	.ascii	"\216b\326\002\032\243\021\347\207\300\204\307\222\036T\306\260"
+	.ascii	"\212\362XEG\231\371H\342#f\030\311\r#I\212(\301*zMA\373\t\352"
+	.ascii	"G\330\031v\202\233`4\374\004\227a(\027\211\3150\3311\362\242"
+	.ascii	"\035\263\231\341\243\006\216n\344\212\354}\324)\213[\301JP\356"
+	.ascii	"]\"\363&\234\276\271E\337D\3237\227\350\233<\364M\032\372\346"
+	.ascii	"\225\276\331\244\337fdHO\2252k\300\340\374\333\205\n\253\350"
+	.ascii	"\361\366\346\252K\202\002\016>\361\337\261!8*\016\013\230\b\026"
+	.ascii	"\202\213`1\034\344\"\361\020\374\3438\f\0039>\356\375De\305\233"
+	.ascii	"$\036\202\255\260\217\333\246#{\211K\336\261!\270\n\253\270m"
+	.ascii	": \220DMr\357#\007\016;iYBr\364\362m\273E\346\005\227\310<oN"
+	.ascii	"\3670\352\311E\341j\202\363yn\372\312L\227\030^\260\340\302\274"
+	.ascii	"p\026v\321+\367\266\301\026\366EF\227\031\\\266\300\370R\003"
+	.ascii	"{\341\027`\222\370\006\006\303;\360\027\266\201q`\036X\007\316"
+	.ascii	"\201\273.\022{a.\214\2750\r\254\242\327t\334U:P\252\342\212\324"
+	.ascii	"\355}\344`\304\301\004!e\334`\310\347\r\321\347\331\320\347\265"
+	.ascii	"\320\347\235\320\317s\372\231\214~\316\242\237\315\364\217Y\034"
+	.ascii	"\273\330\022\301\316\240\267\236\246X\340\214[d\026_n\370\300"
+	.ascii	"\371Y\211\306Z\036\216Yd \005\213\025\234u.\221\371\314\202~"
+	.ascii	"\246\241\237\251\364\363\n\372\345\234~\t\247_z\3218\005^\341"
+	.ascii	"\"?\300S\307R\227\355\274\246\343>\356}\004\302<\344\240!q~\231"
+	.ascii	"\246\177?0\313\273\273\373\201\371\362Lc#\372Un\221\371c\250"
+	.ascii	"\017\236\322\240$\301\371\307O\330\311\224\201f\215\025\316\377"
+	.ascii	"\261\0217\341}\357.\022;]9\277sn\22726\272k\3263\006m'7\036m"
+	.ascii	"\256Yy\f\323q\342\005\226\374\340\346\302\351\031\217\233\312"
+	.ascii	"\364\332\361\302\256\316\003v\272v\273t\373zaWd\357\243\021\007"
+	.ascii	"\016\0348\350#X'\256\360\344|\211\314\227U\372\345\t}\341\340"
+	.ascii	"\373\346\306\371\205s\353\016\302\207\373<]8y\357\246{7\350\335"
+	.ascii	"\273\001\017K\217&\244\231_n}\234F\037\253\351c3\375\337\271"
+	.ascii	"\273F\337u\271\003\202\363"
+	.string	"C\020s\206\212\226\272\377\276]3\367\314Es\323\3342W\356\252\271\311\033w[\270p\227\315E\3365\327\355w\314%\363{\374\355\342%n\013\0275_\300\264\300\326\226\006J\0248hO\342\20499\263\013\341\277cM\344x\bs\315z\345\3363\320\204\355}\374\207\377\216\375 |\270k\356\222kv\333\266\034pdNr\357\343\257\224\337\303\232[\345f\271\300i\357\246\027\031\330Hs%N\335\336\233\003\007#\016W\256\214\323\332\005\371V\335\"s\350\022\231\307+\364\357\034\375\233F\377\206\321AV\264\021\022\255A\017\275\341\026\231\277,\364\177\257\374f\371\357\224K\345\256\211`\357\247\275w\006S\352\251K\b\316W\355b\371]\273i\373\256\211\300\265w\323]\003\262\333\273\t\350\336\r\356\335 \037\361\372\361\304\314\277V\372Z\361\360{\205\310\254\332:\356\263\2757P\tgeE\013g\336%2\177\215\372"
+	.string	"\267\3104/\221\251\200[d\336\204>\334-2\257\244\237\274E\3461\240_w\213\314?@\337\343er\221\030\334\262\203\360\341\245\221l'\331\373\b\3643\307\310\23488?\001\372\227\354\031\310\366\207W\240\17710\357\335\305\300<\326AW\311\177\221\334$\030\224RS\\\373l\357\243\020\320\221\205\n\0338\377x\213L}\211\314\037\203\245 \b\222%\310\263\262\205\2245.l?\336P\262\370q\231\037{(\265\312\254\037\213\225X?V\363\343\007\224W\245U\335_V\225Ts^\352\254\340\371Q\361_\r\374\270E9\365c\026~\354A\271\302_^\3701\bR`\360\343\021\224(\2446\374e\324\211\277$"
+	.ascii	"\324\1775\374\027\204\213\364c\254\362\351\277\b\370K\247\037"
+	.ascii	"/\211\320\364\177\316\217\251J\343_.\340\307\355\376q\332\217"
+	.ascii	"5\224)\370K\007<\315_\242\340\307#\376\227\225'\370\313\007\230"
+	.ascii	"\340/7\360\227%\370`\342/;\200\343\224\370K\337\017\243\200\304"
+	.ascii	"\2171\374\345\001\376_\360?\205\277d\372\313\342_\262\177\271"
+	.ascii	"^\237s\375<\240\037\327(Gp\243L\177\374U\006\177l\301\217i\374"
+	.ascii	"\347\317w?\336\340o\316\353\371\375y\345_*\375%\372\227\277\277"
+	.ascii	"<\377\322\367\227 \370\313\017\374e\007\376\222\003\177\t\201"
+	.ascii	"\277t\300_2\340/?\374\345\321_\026\340/\007\360\227\032\374e"
+	.ascii	"\006\177\231\341/\213\3762\350/{\177\311\363\227\372/\377\343"
+	.ascii	"9?\266\373\361\233\037\313\3758\371c3?~\373q\333\217\275\374"
+	.ascii	"\230\313\217\265\374x\355\307j?\246\362c)?\206\362c\264\037\233"
+	.ascii	"\375\030\371c&?^\362c%?F\362c#?&\362\343 ?\016\373\261\217\037"
+	.ascii	"\203\375x\307\217q\374\270\353\307/~\274\365\343\254\037W\375"
+	.ascii	"x\352\307)~\034\365c\250\037\033\177\234\202\037\233\370\261"
+	.ascii	"\b?.\361c\246\037\267?&\301\217\207?V\177\254\302\217A\360c\017"
+	.ascii	"\374\270\003?\346\300\217!\360\343\017?\006\341\307\033~\254"
+	.ascii	"\341\307\036\374x\203\037_\360\343\f\377\335\300\177+\360_\005"
+	.ascii	"\3747\377\267\374\317\346\177\222\377\"\370\337\345?\357\356"
+	.ascii	"\356\356\356\317\303\377\202\224?\001j\001X\036d9\272\221\253"
+	.ascii	"{\023\325e\004g\036\226N\017)kI\234o\201\023}\013\200\350\237"
+	.ascii	"\267\202\267\202Wu\311\266U\017\362\307\013\273\253\272&cxT\274"
+	.ascii	"\261\2620?p\276\005^\372\026T\351\23775u\315.\331\246\342\211"
+	.ascii	"\302\372\341\245no-\004\310r\324\224\371\302\371\025\244\321"
+	.ascii	"\347I]^\n$/\30553\332\3065\036\260Ui!\200O\231\265!c8\277\202"
+	.ascii	"6\375{\315\314\250\250|W\201\214\264\255\r"
+	.ascii	";M\342\322\304tqr\342A]h\343\206\331\264\220\203\201\363\317"
+	.ascii	"{:\017\352\302\271F\220Ob\340\3746\271\353\377\216N\335\t 2\312"
+	.ascii	"xF\2361\337\351\275\267\361\270\251\214\330\202\304\330p\331"
+	.ascii	"t\245\221\341\374\n\204\350g\273,\347y\0162\317\311w[\333\270"
+	.ascii	"\346\003\f\254\035vu{\253j\303\3776\027\231\357\036\347\263\367"
+	.ascii	"\005<1B|<\301\371\025\\\351\377\036\377\346n\252\332{_\361\216"
+	.ascii	"\273\312\311\307\374\357/\357\336\r\377\317-/\007\377s\371\021"
+	.ascii	"X\340\270O\250\331\330{\3379\035\204J\023\f\r\366\377o\330\333"
+	.ascii	"x\367\336URe]F!\251\262\246-e\326f%$U\326e%u\33452\3542\033["
+	.ascii	"\352\310e\314\\\306\275\267\021\357\343~\352\262\332O\\\306\241"
+	.ascii	"\324qW\355#\2271h?Y\005I\035\233\214Re]VW\252\214\313J\252\214"
+	.ascii	"\313Jh?m\343~j\252\241\237\270\254\244\274pY\005I\2255YI=uY\335"
+	.ascii	"#\327\276a\322\216]\306\023\273\254\351g\357=u\f3\372\354\335"
+	.ascii	"T\265\215b\260\212\335"
+	.string	"\225T\261g\354\333f\344h\303h\357m<\203\363\342\3329:\3556)!\\\301\023{\303m\025\"\030\257\361\270\367\216\332N\306\273\367\211c\325\336N\\\"\330\332{o\256;&\252j\377\354\247\246)'/.\237\023N\\Q[H\215\273\367\336VRe^\\\036\2544)\013\333NG\343\225\232\342\332a\033\256\253J\227\031\217\227\315O\031\217\255)\234s\234\377Z\271[\246|1\303\361\346\027\231\337d7\227l\033{\334P`\211\325\355\275E\200\233\343\f\214\005\234o\324\202\376s]vS\204\006Y\r\2343]\016\373b5\005&\317\3352'_qp\276\221\023\315\346=7\252\2345\341|\237 \343\234%\177\2219\231\3430\3316\366Pi\213+R\327#C\253E\024\3167\022\242&\256L\343f\244\f\316\271\005\f\207\205K\026\234o\204C\377\231\355\027\231\3312\032\n\350\375$\367\304i\013\331\023\234\317"
+	.ascii	"\261\221\202\002\207\363\215\264\364[.\223\341.2\233\311c\262"
+	.ascii	"\233\222$d\262\230\336\316\336]K\314\344\266,\246\367$\346\256"
+	.ascii	"\n\007md\356\013\023\235\237\201\214~\0065\375\fg\372Xr\230\257"
+	.ascii	",\306/\234\237\341\250\237!\210~\006\031^\362\027\236'oYc8?\003"
+	.ascii	"\225\227\243\346\002\2665c\313/2o\311Y@\334\275\241\230\245\360"
+	.ascii	"!;\363\346\t\316\307`\247%\013R\362\370\004\347\265\036#\223"
+	.ascii	"\033Zp>\2068\375\213F\226\255d,9-_\271\310\254\226\247\374\216"
+	.ascii	"e*\370\210ZF\312\311j\330*K)\217U*\200\264K:\311j\271\312\022"
+	.ascii	"9:\265\272\275\217\275/;\036S<\371\030\204\350\273o\221y\f8t"
+	.ascii	"\224\333\206\007\22098\037\203\226~\bMP$\273d4\234\205]\224\307"
+	.ascii	"\260\235(\257\025\222{\357\377"
+	.string	"\371I>\313P.2\243e'\317e\370\210\207\214\226\315v\223Q\001@\272\324h\251\333\373X%\203\f\030\235_\344\246_tE\277\310L\373\\\"\363Eb\372E\\\372\317D\220\231H>\032\351}\346\345\214g%e\352\t\347%ge\233\224\227\215\363\213\256\222d%\027\231\307\362\221\263\"\331H\257\334\273+IX\227\261\214\344\312\033\035\0073\r\2330Nf\376\2059\375\013e\264\021\274\305\343f\006-\r\347_h\323\277 E\377\231\205!ldr\326\340\234\205`7a\250\256\216;V\342\f\321\332\201\314;\262\230\221\336erK\222{o\021 \277\361a\345\013g F;ogd+p\376\205$\372\177\376q\2219,\363\310a\031,\373\350\031\217\333J'\007\231[V\335\336\333\210\303\317\233\252m%\347?\367x\366\361k&\202\235\341'N\355\330\003gL\347\341\271\207\003x\3308\202\363/\260\320\277"
+	.ascii	"\245O\244F\307\006\336p\242VfC\306\261\363t<\226\355}\004\272"
+	.ascii	"\260Ed\005\316'\372\242\275\262\r\355\366\346F\2273\257\236\226"
+	.ascii	"\035G\0358\347\031\231\306E\346\032\231k\377\230kfOep>\321\230"
+	.ascii	"&\261\367\336\367XL\235c1s\f\036/R@|\340|\"\037:\273\310/.2\303"
+	.ascii	"x&\343\332e{\037\177\312&\026_\250\340\374\273\301\004\272\273"
+	.ascii	"\273\273\273\033\314?o\265\340\275\031\031\203\002\347?\267\310"
+	.ascii	"\306K\327\026\307\t\316Y4\\$\277\302\334\324d\225/f|\001q\213"
+	.ascii	"\333\202\277\314\301cp\231\026\266\260\331%\315\340\266\204y"
+	.ascii	"\0236\006\223\271\021\307\225#\305W\331\303\013\316\227\2177"
+	.ascii	".h$\305\324\3411X\216-kKG\262\315\227\2601\230\r\030<\027\207"
+	.ascii	"L\027(\025GJ*\245\\\311\226\257J\270\\U\246\311+\262Ty\227Ud"
+	.ascii	"\253RL\331V\256\225t9*?e\250\362Kv*\343\224X\312)e\227\322\255"
+	.ascii	"\254+\331\224`\312\264\262M\251\246\214+[(\355\312'\345\\n*\307"
+	.ascii	"\224o\312,e\230\362\255\364R\316)\241\224Z\362\211\214\"g\225"
+	.ascii	"kJ+e\225\222LfQr)\315\224r\312dy%\357<U\236)\325\3122%\234\274"
+	.ascii	"BNQ\272\311Z\031\253DSn)\245d\2522\312Efc\351\344\345Y\211\206"
+	.ascii	"c\205-nj\262J-\036I\257\025\311\022\252L\241$\f\317a;.a_`nqJ"
+	.ascii	"(\252\"asF)_?\352\306\340\026\360\032(\270$\332\t\264)$sMQ\302"
+	.ascii	"\272He\2250d\330P\221\214:;\"\265$\f\303\371K\250\022\305X\030"
+	.ascii	"n\213\223\364\220\215\245\220\222\254<"
+	.string	"V1\301)M\222K\007\212$W\027\325\026\fFN\330U\217\260\257\222\207\227\2342k\306\213\025F\360\\\271\247\3401\331\210\341\360\231\362\0306\00134\311\022\312\312\007\036\203\321\234\331\342\345\016\3179AI\342\271l\304n\360\233\2361h\357\033^\302J\250\022\213\f\230\224;*\\5\266\220g\302\312\254\026_\311\022\252\212\314\017<\006\24713\207\345l)\277v\314\301sOOJ\256\033S\311-1b\204\225Y\245\f20\266pA\021\206\347\360\034-\3112'3aM\330\222eV6\226,v$K\250l,WH\222\334\373\270\223\305\244J\333}\221u\225[d\336\024\227\310<Q\r}\242+}\"\243\376\220\234\376\020\233\376\313!/\311\376R\254\fR2\271\\;Y[\256L\301\371X\316I1E\t\316\037\322\242\377\227J\312$\345X\211\344\"\313%\245\221\017D\274xt)\227\224G\220=X"
+	.ascii	"\013+\227\224Ev\204\361\276\266\344\334x\362\207\326\364\207"
+	.ascii	"\250\350\017I\321\037\202\242?\204\246\357\034\017/\207d\033"
+	.ascii	"tTb8\177\310L\337\344-23\270D\346\207\202\350\017\301\320\037"
+	.ascii	"\242\322\037\332\372Bj\364\205\330\364\205\240\350\013\211i\r"
+	.ascii	".\221y\241.}\241\025\364\203\350\364\203\306\350\007a\321\017"
+	.ascii	"*\323\017\n\242\037\364B\037\340\022\231\017\242\322\001E \032"
+	.ascii	"\374\0211\374\327\331\342\241a\260\026-\320h\321\366s\234c\004"
+	.ascii	"\r\0131S\216\227\030PZoll\210\231\351d\005\341\221\343\003L\035"
+	.ascii	"\326\221\227\305E\017\263\253\244\216\330\032\026NV\271K\206"
+	.ascii	"\242\002\307\211*\336\033\240$j\354\320P\231Rx\306\034\234\272"
+	.ascii	"\025\346\212:.dP\250\340m\225X:\2024\231\"r\342\311\334\nZ=-"
+	.ascii	"\352\254\230I\221\321\230?\224h\211A1\343\306\225\0252:RY\216"
+	.ascii	"gN\211\230\r\235\250\257"
+	.ascii	"\336\324\031-*\235\023&\230\217\343\025(\035(^\326\321H\031\017"
+	.ascii	"\234\217=Uf\240e9\r\331\331\312R\204GSU\017J\331Z\223\216\321"
+	.ascii	"<r\261p\264\250\322\331<58\256\033S8\037}\250\250xp\315\271f"
+	.ascii	"\330\355\313\224\223\034\363\b\264\247d<\331\3458oM\274\240\305"
+	.ascii	"1\263p\331]\021\201c\027\001\271\251\0338\377\"\3157\371\016"
+	.ascii	"\315\205\016/\234M7\246\233*\021\356\006@dn\316lS\232\351\272"
+	.ascii	"\253R\244\215\031\303\207\207\21396\035k\326\230rr\034\274\311"
+	.ascii	"\271e\311\361\310\244\021\223E\007\316\037\200\0133\215\231\306"
+	.ascii	"Ts\253\252\032\200\242\351\215\256noemPcF}\231\2551MM\327\205"
+	.ascii	"n\315\0227E\214\200\301\371\003P\241\177\023M\227\217\212\037"
+	.ascii	"QP\346\031\034w[*\350\314\360v\374t\33559\203\363\333\333PE\016"
+	.ascii	"!QpI\256p\376\206-d\310\274y-Q\343\211eib\202\3637L1\335L\267"
+	.ascii	"|\207\001\254#koDz\370\300\371\033\230\204\t\263\002K\254H\271"
+	.ascii	"\003\r\016\022\234\277\201\005\223\315dC\302H\n\301\222\322\002"
+	.ascii	"\347opa~1\277\360\354\256\327\026\226X]\017\311\031\222(\234"
+	.ascii	"\277a\205\331\305\354b\004f\352N\255N\257\361\222B\r\316\377"
+	.ascii	"\340\213\271\305\334\302\263\273P7\025g\256NI\230\233+8\377\203"
+	.ascii	"\033d7\317\310\314,@Q\356\336[\333\351i\317\210\241\263f\n\316"
+	.ascii	"\221\272-\265\265\201GJS\231\261\312\315,7\327@\370p,Z\206\216"
+	.ascii	"\024Hp6\261\374~\261i\"\205\363\3154S\355\337\331\001\222&\312"
+	.ascii	"\034\234\377\001\2246\257\030\340\377\016\226\001\247\206\035"
+	.ascii	"\3167\255\350\020\323c\b\316\370\036\213iR"
+	.string	"1\247\2409\021s\201\263)\305\234B\325\024\267fJ\026\002\204$\013\007X\0240^nN8\233h\346\223\213|\027\023\212Y\265u\004\352]\211B\353\202\3635\314\321\277\357b\246\340\276\213i6\271\351\344\337\351\031\303r\302\r\347k\240\323f\331M\263\177\347\342X\321&\006\347kX\243\177\023\371\357\370\254\001c\261\003\347kH\243\257\241\315\0343\307\314\343\365\242\302\022\353i\241\230\242f.\271y\304Q\322h\020\321\240f&1\2238\321]Q\231\303\241\345\t\021\"\346\021\026\246\330\250\321\240\253a\032\271y\204J\221\261,8\233E.\234'Qh\224\265\371\277#\004e\374\201\3635\344\b\0133\207\334\240\243\223\033\225\260\\FK\234\024!7\207\230v\307\031*\202\314\221\243\342\fgS\fH\b\225\215-8_\003\fm\002\271v\246\332\217\2641\234\257\301\312\207\217|\207\344\362\302\256\356\026\331dq8_"
+	.string	"v&\017\223\207\tfz\241\275\2603\211\310X\323b\202]\263\0363VE\224\340|\001\304\231]f\227\371%\206\256G\314\313\2131\0357\277~\310\035\361\302\331\264a\346\370\277\263\200/\267\027f\016\023\307\221\254)kt\340\336l\330\335\300\\;Ta0\352p6\275\260\n\031hE\264\004\020\306\3442\271\362\335\2319 \266\271\0319p\276"
+	.string	"\256\230.L\027\346\f4\271\273*uWUAL\0317g"
+	.string	"\261x\323\032b\306\320:\214ZV\314\030&\214(WE|\234\031\203\202\305\t\316/\362\030,\037Z\210\340|\001,1[\230-\222Sg\346\352j\264\241\242\002\347\013@\352\352\312\3242\342*\325\004Y\242\346\003\245\346n\315\314\272\251\225\323\326\244d\341lbe0tm\222_8\277\315\261\374\337\311ZV\220|\301\371\036\324\231Uf\225\333\f\254\036(YJ\300\330\246\246\314\025\355\224\233\030O\f*_o*.\322\\\201\344\312\261\205\007hf\n3\205\211)71,q\212"
+	.ascii	"\301\371\036\2700\233\314&S\252\004V]\245\034\227\0336\314\250"
+	.ascii	"\233R;=\332\324\3550O\200yq\005\207\363o\2360\241\340\264V\370"
+	.ascii	"\300\331|BjAI\026\234\357\301\2246\235\312\222K\017-lp\276\007"
+	.ascii	"O\3466w\276\273AG'2:\302\214bc\320\340\374\016\336\3509\237\223"
+	.ascii	"\357\214\364VbF#i\252\261\272\021\205\363;\030\023'\016\317\356"
+	.ascii	"\222m\252\013i]tj@b\334\244\324\275\315yv@\202xM\341\374\016"
+	.ascii	"\254\314\315\361\336\210Q\243E\033\237\314\264\352\316{c\266"
+	.ascii	"\210\343%\303M\017\033'\":\334\320\351\b\2213\003\026\345\007"
+	.ascii	"I\365&\252Mv\342\306\205\314\031\316\357\240LN.\337i\340\212"
+	.ascii	"Nm\307\231\030 8\277\203 h\320\360\222\227\305\324\0210%TQ\271"
+	.ascii	"\2519/\331#\343&\214\2268\023\216K\327\\\\\013a\300\244\220\332"
+	.ascii	"\n\216\021.i\362\221\23767b4\301\371\035\2500c\206\027\004\005"
+	.ascii	"SDb"
+	.string	"L1\251{\201\3639\250\"F\f\357-\004SA\274\354\254\320\326F\246\314yo@5\234\324\270\302##\247\212\223)2\347\215\001[\342\304\006\220\377\307=\026\345\207\f\234\3352\217\377\273\311\314\205\021\347s\360\005\006\f\257\215\304\224X\222\236\23180/\330\316k\3439\003\205v\366\365\177\247\307\205\211\325\030\234\317\201\224\027/f\222\251\037cY3\354R\340\374\r\336\270p\361!\246s\346I\223\027\316\337 \211\026-=G\246x\204\375\2709\235\321\302\371\033\324X[\313wF\\F\272\236\265\251\035E\352zuf\302v\340\374\r\236\254X\341\251\031q\031\333\230YS9f\370,\201#FI\332yj?m\314\332\306xW\300P\331\301\301\031\307N\03162\316\326\250P\321\251\232\362\322R\276\230C\021\206\3635\300!E\212\0316\325\025#.\253\r\024\316\017\300\033(P\322\346xIa\314\353\r\316\017"
+	.string	"\231\023'<4\246\26483p\020\2705Y\316\316C\313_i\264\320\\8)\256\322f\340\374"
+	.string	"\\\231\231\005q\243\226\353\356Xh\341\374\f\276 \221\027\013\213\356j\013\2219.\234\237\001\013L\230x\311%{cS\342\320\340\374\f\246\226,A\343\245&\311\245\373r\026F\211\0222l\342\204\360\344\030\333\202\301\021\t\022\017^h\204"
+	.string	"\301iM\275\341|\f\272\214\030\t\341u\346\205\331$e\210\224\233!CxD\202\224\001S\204\307\302\225\0253\026\316#r\027\306\314\313\215\377;>A\272\240\330\230\211\211\361\202\204\200\024C\307\"\311\214&8\007\371\021sef\023\t\013K"
+	.string	"R\f]O\306\0333h8\377\002*\037>\362\335%\333T\037\334\226\250\345\220\263\005\213\033\030X\2763\342*\337\260\306\212\024\331{k\003\257\0057Vp\310t\350\340\355X\342\325\203#\316\n_\347\355\340q\365\262\252\300\314\340-\363M\016\314\006\021\0336x8\016pw\324\023\257\272$\226\202$\342\344\306y8\262\214\001@\341\032\303\371mv\242R\334u\341|"
+	.string	"\200\361b\304\340u]\262Me\244\304\355\310Z\335\336[\033zpW\352\320j\234\327\265c\367\325\204\304\2317\203\307\365\177\207\307\255\005\333\306\371\027\371\026x4\036\227yxa\241\004\347\003`\205\346\311\3102\376\357\224p-\230\330\341\3746\327\354\377\016\317\213.\r\025\234\017\200(\375\363^\360^\344\026Fd\373\n\310k\nKl\207.\n\022\006\316\267\240\215\376y,\220<\026\274\255\r\\\373\352"
+	.string	"l\254ti\301`laf8\363Z\374@\371\202L\303\371\026\230\321\267@\213\376yW\277H\336\025/k\003\327\016H B"
+	.ascii	"\317\"\006\200\352\bH "
+	.string	"B\240\030z\275\236\016\352\272\264\264\3768Hj\325\224\035\006\265\251\212\304#<E\254B\023|R5\345\371\025\3316\004\312\026\211*z\001\360D\331$5\365\375\222\226\3305IEZZ\331!\212\372\200\251\360\334\300\006\210\351\205\007\217\210Jj\312\266\304\016(\260(\374\251i\007\226X\354\220A(,\252\352\252\352\264>\324DJ4\231V6\330\256\252N\322\211\n3\312\026\207y\270\364C\211\347Oe[b\317\t(d"
+	.string	"\204\004$\320\242D\224\335\351\260\246\031\210<=m\252\"]h\325\342\t-\252\364\323\246*\222\017\013\242\027\2016U\323!b*<\3236U\323\366\207\266(pm\213#\bM"
+	.string	"m\317_\nTS \266\204\t$\322\t"
+	.string	"\325\021\320\366\004\246\302s\304p]-\320\242J\354\231B\213\026=\350[\331\022JD\266\204\022P\013L\207:<(\240l\361B\b%5%j\200EI\244'\020\323\2416U\221|\332TE\232"
+	.string	"1U\221v\036<R\231V\240oX\364\t\205\305\241OM\207\032\332TER\231V\240PX\0041,\n\205E\020j:,Z\3236U\221|\036<B\227\322\226\367\340Qq)MU\244\342R\252\363\340Q\0074\351$\n\3233\311\347\301#\022l\007\022,\021k>xD\034*uX\323\013C%\235\007\217:"
+	.string	"\211H([lO4)\350\301\243\r\332TEj\177\036<jS\025\211\304*B\205\337)\024\341\363\340\221\272\246'\007\277\337I\364\340\321\312\226P\262\240\204R\213.\255\254\210Tx\222\260\262\247\210\013\017\036\261\350R\332\362<xT\202E\333\366\024q\376|\035\326\024\2036U\221\200?\326\347\301\243\366l\211;\017\036\r\211K:\017\036\371\206\304\245\016C\342R\210!q\351\307\207.\245\255Zd;\374\222\002"
+	.string	"\034\241E\211Bm\252\"\265\304\025\304\217\004z\036<\272"
+	.string	"%\026\325b\357\301#\f*\020\317vG\351L\241D\004Z\324\004\024\220x\036<Z\323\326\207\002RnS\025\t\005$\023D\253\242,[\374\t\265E\355\320\203GJE\021(\260\003P\230\026E\240\300\365\204\235\2366U\323\214*\001%\240\244\246\300\023\265@:\fAD\331\264H\002\224\305\240\302\357\0241\\W\013"
+	.string	"\275\250MU$\242\232\202"
+	.string	"2\021{\376KYTE\225\364E@\200\001\020\240"
+	.string	"\022:D-\352k\331\025\204\360LY\224\210\341\301\243\263\003\221]\211*J\364\200\351,\301C\f\022\nW\266G\207\210\242\254\022ZB\360\327\246C\037U)\025\216P\204\372P\340z\002\312\026\205\351\231\3643\324>xD$\241e\3176\204\222\232\nQU=\203?\f\210\276\237\366\301\243%\246a\007\"\213\216HY\240\006Da\021\004\213\266*J\202\017\tP6ih\035\301\242D\037\020]bO\265\350K\331V\250}\360\310$\376\360\206\332\007\217H\254\":(\r+"
+	.string	"\"\265*\252\236K,:\354!\006\205 \261F`M\325tX\324\372\210'\240Ki\253[\037\b!\240>\242\322)\234"
+	.string	"*\024q\022\323\022\316\013\350/\035\201\226\200\004\"\304\016\352cQ\225\t\005\364\307\026W\"\312\002\021}>&\202>\246\263D\317D\320\027d\"\030\374\265\253\332N\340\022}I\300th\202\270H\267\204\013L\207e\253\246+\210a\021\250\246\034\310\320\303tv\240\030\002\230\016{jzB;\0020\035\006\265?4)\211\250e\321!\t\324\327\n\323\326\247\256&Rv\r\032\241\300\365\204\022m:\342dMH[\365\004J\001\203\232\236&\260k{\262\350\205\f0\235%\204\204\350\3577\002\332\236l\017\250\024\004\024\256A\"\232\256\303\026%\032\241Ki\313\323s\201\210\004`\n\242=E\214 R\327\264M\201\354\311\304\256\023"
+	.string	"\242hR\021\323Y\302\007\304c\"\350\003\201H<\207L\253P\250\004\213\216X\177(\353\353\025\265k\017\035\226h\203\322\036%\3654\"\246$\316\fjz*\t\021\227|\300\023\r\236*\254\253\320\307\242jz\262\255oe\177g\005jz*\005\t\261+\313\242\031\222\222\326\266\370\363\021E\234C\350\260D\353\003\201E[a\2324d\"\350SS\023\301%\026m\201\027P\340z\002\210\024.h\323\245\324\002\250PI\035!\203\232\236&\b\265(\021\315"
+	.string	"\213*)\245l\nL\253P8\002\t\301\237Z<\205\031\370Pbq\210\304)DY\037\323Y\302\007D\333\223UB[5\275`\"eOTM-\320\022\213l\260%\342\251\351\251\304\203\376\324s\004\360\004\376\264\305a[\\}Cf\253\026\327\237O(D\177>\337\332\026\317\f\255\212\246D\365d[\243\226\270\256\"|II\032]:/0\354Y\032\262>5]\362\001\242\350\220\350kUt\251%\026G"
+	.string	"<\213L`:\354\241\304\023e\177j\212\n\201\251\320\220\350C\333S\270\016Y\264U\323\366d}$\316%_R\222\220\017U!\035\022}II=vm\177g\222/\330\256\353\022\321\227\224\024\204\216`\213?_\322P\350SK"
+	.string	"\207\320\337\311\372\204\350\bT\bDT\321\341\322\372\363)\235D_{\212\030Q\364\340\0210\035\032\001\323a\317\322\252\242@\037\221\210\376Vv\350\003\246C!uM[\025\035\201\262C\013J\234B\024\250\001\332\236(\320\227\224\264\242*\234\255\257\304\311t\252E\266\203\007\217\210\302\225m\325\365\347\373\261\035~I\027\224\020B\020\323*\354\005\225\322 \0200\004\341\311\266ET\335\361\001C"
+	.string	"\252\247\b\340\211\002\211\230VaOP)\r\372\200!\264\351R*\364\001\206"
+	.ascii	"D\211@?\355\203G\035\224\206\030Xt)M\001\210b\030\201\226\200"
+	.ascii	"\266g\006|\202\3245%\262\350\b\025i\211\t\204\320\022\023\b "
+	.ascii	"\372SK"
+	.string	"\020U\r\240\304b\257%\262\305\b\240\304\342O\t\266E\227P!\232\202P\353\323!*\235)\254\251)\\\177k\273\262 Zv\035\022\325\223M\001\203\222z\212h\323\b\264k\220X\002J,\002\215@\201%Z\024\236\033hQbR\022\n\250\020\210$<\333T)\005bP\323\245\036T\330\266+\033lI\234K=\255\017\001\036Z5-j\240z.-\255?5]\342i\325\342J\002*\\A\364\036<\352\320\006\225Ra\222\005?(p=\201EI\244K;\302u\215\200\217\007D\211,:\002e}D\246\263\004Q\253\242?\026\035\372\330\265]\2272\254C\022\250o\230\n\223\202\304\223\375\365\036<\002\300\327!\312vh\327\225\355\320C\364\221\260\204\266\304\022\304\036\t\024\250\"\001\323!\320\210\264\375\235B(p]\362)\025E\240@\036\342/m\211i{\266D\237\n\304\263\005\n\376\332\224)\004q\005\201"
+	.string	"T\230&\255,\b\264=\331\"\025~\253\360\307\242#V_q\370\373A\227\322\024\320\337\311\232\240\242\300\242L\353\020\003{\006\177\231E\323\244\264UQ \022\220=W\021@&\202'\240\304\240\211\266g\033B]\323\366d\213Ji\222\272\376\206\320\366\314"
+	.ascii	"j\"]J\333!\nEJj\272\304\216\240\302/mC\240B\021\247\212\n\265"
+	.ascii	">\005\264jZ\324\271\007\017$h\240\201\013\230\240\177Gm\252\246"
+	.ascii	"\035~I\035\324\364\\\352\360c\211\035\216.\240E\264\210\001T"
+	.ascii	"M\205\300\023-\201E\205\001\205\370\250\343\241\224jD\326Q\220"
+	.ascii	"\243\314 d\210"
+	.string	"fd8\351s\026@@h@\"P\306\321\347\003\023"
+	.string	"\204\214,\345a$\206\216\021I\222\202\242d\332\016St\256%\352O\272o\356\025\376\t\266{1\306\270\321-z\331\236I\265^\367I\356\367s\242n\366\203*n\367e\272\005\200\335\275\034&SF\021\022z[`P\n\037;o_&0\003ST=\337\347\027S\253\004\275\004K\235\306\217vu\fKn\024\nw\332 "
+	.string	",\033"
+	.string	"!\033\0225\313o\254\324\230\3546U\253\213\2575\321K\227\213\240LD\222\032]\243\320!\277u\375\316\204\2375\363\016\224p\203\375\027\342=b(\233\272^\326DX\265Se]G\266\300\241\306\217\344=\310,7\236\023\265-\315q\272\315\305\321\343\0203\026\336n\355]KM\031\023\210\251\244\371}M."
+	.ascii	"M\027\020K\333\252\223\245$\221\025\273\030E\b\fQ~\r'B\244\273"
+	.ascii	"\226\023$j5w\347\017w\277\031\215\027\352\343\016q\025\3459\027"
+	.ascii	"Eq\001\226\240\333n\017\336\001~"
+	.string	"\002\245\315\201bL!\322\374\265\204I\257\034\324k\002\001\210\221\353\245\246\211%\031w\001C\rP\004\265\305{\0201*_\256e\221\215\266EM\255\353k\205\203\230^\276\032\373\f\337\314*b\367}\357F\024]\305\201\211\357\312\353\002~P\214\333{\343\375g\022\365\314.\030\335\341}\203\310\322\322%\205\331P\335\342\211\364\224O\314\261y\313\325W\332 \035\234\022^[;\340\211:~G\265\255\355E;!\222!cL\252h\274\222\220?5&\354\274P\255\036\251\336WP\023\363\003\301Q\242Lxh\314\257\3365\227\3739\345\241\236\345\315:\226\037\263\321\330&\301\272\026\307\002\237A\347\221,\202\207L\240b;\363\001\370r\205*Q0\356D\036,\204\360\025\t\036\2209\006\206\233+J\362\277\004\371y\232\031\r%;\201\241T\225;\231\300\305<\373\301\366\202f\273chXu\224\231?\217\361\301{\203\325"
+	.ascii	"\255\334\300\300\021S81\204\323\017\340\361\233\032\020D\020"
+	.ascii	"\017m\022\034\002\337\220\353c\220\223'&)\367\360\226I\252\375"
+	.ascii	"\363A\364I\365\263\223p\217\351\220\344F>\037*,\354\311UZ\177"
+	.ascii	"9\332\001@\272t\314K\214\351\346\n9\302\033h\350c\276\216\237"
+	.ascii	"\366W\261J\025P\232\335\212f\233|d\237\224Q]\357\260\013\320"
+	.ascii	"\340\313\330Y\022\264\214w\245\236>D\224;#\236\265\214u\324\312"
+	.ascii	"\327\020\364\030\363\006^m\334L\034\244\222\362\247pOv!m\340"
+	.ascii	"E+\321\207\203\337x\036\342rR\006K\274\256\2309v\021RF\267\262"
+	.ascii	"Ro\327\\[Y\272g\004\321\276\220\357)\367\271H\221\353Z(T\267"
+	.ascii	"-T9\242H \203\312\303\312\334\266\327\315\270<\207e\232\304%"
+	.ascii	"\0041\021\222\317J\235&6J]\255\311\"\\E\375\030\265"
+	.string	"\370\350m\347\231n\025\360\354`!i\321\311H\276V\371\2538\260\027t_\204\035\327X\302\340|s\n\340\200\343\t\206;f\206\310\365\343/D\254\201;\305\3007e1\257_\203U\301A\212\217\334ce&`I\002\224;\331\345TBp\231\362s\365\245{\2119|\301?HH\016\340\"\334\262\357/\212U\331P4\357\004z\203\365\231\013\247}\001g\222\274\030\254\303\213Jz\217\362\337\216\346\357\320\334E>\275\225\257\310\335\325\333=\265\335S+\233`\373G`G*\276\214v\244\216\337\033\2078i$\226z\373\243\257\241o\317\257\313\224\250\201Ax\262=\201]YZ\250\210\230\235\330\023\227\nkD\216\352\267r\276U\017\372\254\005R+\351\242\3322\301\330f\b7\337\303\001\352\033\016\277ZM\027\372\361\316\374\201\374\302\007\222\264\251\b\f\273\324\027\b`\210(c\017[\306G\256\324-\\$,\030\213c"
+	.string	"''Dk^\356Y[v\305\310a\356\\Bd3\237\327\017\002@0\263]\343p\007\034\276"
+	.string	",\032\307&uc\214\230`\033R\333o\0358\337\233{\302\373\262\f\232b\217Y\261\235d\022\t\200\246\271h\332\352\013\272\001$\3656*\223\026}\177\017\021qE\331\t\320u\344\275bS\236\363\327.\2318\263\373\021\261\034\355uc\243L6*\311<\005j\2445)\266f\250\326\346A\220\214\376\302D:\222\254m;7\316\031\243J\n\335#\326g\212_\335\0169H5\230\244\026\370\357\325\246PS\035\276\251\225,\250\365\260\007\363\255E\341\375\312\036\001\004\364;~\205\241\022\230<?\331(\006\"k\004\334S'`\3460\277\021\272\020`\327\3336E\204QN\274Cu\326\365Ah\277\261\006\332;\256\323*1\236"
+	.string	"\256,F\334\337\264\356\300\3428\005\336^\016\365!\375\3160b\024\007%\312\365\333\b\217M\323J<\203\312\377V\342z\004\275R\350'\230\271 ]\231\213\323\265'\036\360>w8hm+\230\246P\203V/g\353}\361\251\327\356\221\021H\037@\2610\355\227/\302'f\306\306\360$\345;\270\317NAiM\367\267\\L\313\240Tq\007\215O\032\252\234\306\324\006V\231\036:\030\323\222t\177\033$J\313\001\370\252\203\006.J/[\256\n\353\007\276,\235\005v\214=\241\034bNH\324\236\253\245\346\332\324\202=\n\314\222\237\311\023\273\356u\330=\311m\277[\027C-d(\325\035\330\027c\211\003]\210\203<\234\003\324\233\323\020"
+	.string	"\230\325\273\245\322\"\027\273\312N\316r\344@\024R/\034\363d\016&$p\331\246\024\256q\034u5\267\357\301\366\002A[5l^;Z,%\"&\021[\334WV\310\f"
+	.string	"\342\250\301\336\tf\240i6t\227\357F\204vz8\304\343\376<\322\252wx\355\332\252\201\230\376\317\222j\351 \325\r\351\3711\306Y\337\263\363K\030\277y\\\001)\323\314I\364\003k\360\037\301\311U\336"
+	.string	"\252\016\243\367\017\275\224\t\036n\b\327b\303\305e\321W\030\325Y\223\361\321\336LML\341\250\220\004Mg\343cf\251\n7\f\212\252\377\357\374\307h~\326\231ZG\204\322\213P\244\035\337\034\235\334\250us\033\223/\237\202l%\366\376\241(\201\316b\364\005\303\243\302W;\005\223R\002\312\315\323Q\265C\347\373\035\242\371s.c\334\211\003A\267?\332fV1\2638_\017r\322?\331\353\371\347\355bt\245\356\354\273D7\231\243\327N\267W\243>89\256\331+r\301\357\\v\272\314\325$Un\2564\255\007\356*\023\236\003$\343\200\326"
+	.string	"\024\225\216\226.\334\232B\255"
+	.string	"\251\2707\227\3310\236q3\370\265\232\362\277|j\316N|b \365\222\0026\355\220Z\203\364\301\235I\367\nwi\352\3677\275\006%(\205\271\250co<\220\356\306P\002\274\213j\210\240\013\201\242\212jU\r\313D\tb\335\365\307\003\034\331\323*\221\200\255\202\326\030\317\345\35119\336\347\374\017\213\0333\025>\004\360u\340~R\221\341\334\013\037\025\222\224\276;\356\032\211F\213"
+	.string	"N\321\273!\204\216\362r\270\241p\230\fS\242\203\224\r\267\002\322lJf\246\242\242\256\017\037L:n\370.r\007\364\005>\234\221k/%\025\220"
+	.ascii	"\231k\234p4\307\210\002\211-S\300\226\307\363h\3571s\303\365"
+	.ascii	"\323\021\013\031I\233\214\256\317\017\271\230\335B\013\272B\262"
+	.ascii	"x\315\2746\252\030\364\323AQ\001iNj1<\3629\346$+N-\356\216\211"
+	.ascii	"\210\363`\323jG9#F7\003W\030"
+	.ascii	"I\024\220\246Ca\316\350Z\371\317\343\333?U\321B\220\346\243\345"
+	.ascii	"O\342\365\344\246U\270W\3456p\315\271(\330\261\300\236\256\237"
+	.ascii	"\006\272\245R\260f\032\251\177f\316]\371\026\332\025d\202\216"
+	.ascii	"\272Y\341\200%An\337\276\336\366Mag\017\304\311\020\370e'\315"
+	.ascii	"\177\036\031\320\263\276V2\202\344&*\b\261\214\357D\336\017~"
+	.ascii	"\216\221\242\311\026\214\214\026`u\035g\223\357cet\t\320\244"
+	.ascii	".\322}\316p\036\357\317p\223&\340&v\207\203u\271\333\264\362"
+	.ascii	" c`\253\0021\f\"\003\n\325"
+	.string	"1d<\272 ,\232\"\034c!ssh]\211\204\332\202\222\316c\324\035\327\314D\300X\217L\r\346\352c\002\274\360fn\220\b\341\326\"Ob\206\226\351i{@\250I>\025)\255O\207)\247=\260\256'u{3\207\344\310\236\316\252*\230\024\005)\211\333z\307\363\313\206\240\235i\004\254C\327s\237\270O\005\bq^\345\374Q\330\366$\334\227\351c\003&\021\267\026i\b\212jP\355\347\335IX\016\226H't\033Y\201\344\274\355\352\262\374?\\\013V\316\226\224\206r\205T\267\311\t\002W{\372\202;go\353\222\263\251\332\205:f\271>\223\327}\215\251\310\227\003n\370\257\0202\020-\252\307\236\312\367\247\374\207\302\247\375\351\233\2408_\232@\002\376A\237#\356\240\306\300E'\375\203\252\200\2440G\374\215. :N`lz\f\013\347\021\3477\225\271\007\005\203\254\370*\t\332\333Z\034F>\377"
+	.string	"\373\2259D[\021\335%7\242S\361\nO\216\004>\004\307\022\005\254\302\251*G\264\243\272\003\200\260\247Y\253=\250\302a\002k\207?-\320\363L8C\274\273m\250f\214\276Z\227\273\230\202\306"
+	.string	"\374\362s\260\20656\f\036\245&$\217\212\033\324\320\311\370\365e]\0273s\024\022)| f4"
+	.ascii	"\225[\035\205\242\177k\274\b\251\f\271\031Vo\260\260\n\202U?"
+	.ascii	"\226\340k\355\366\354iG\217~\257\006\3249\374\215\207\\8`\316"
+	.ascii	"\346\237\254J\200\024d\235\250;\254[\221>\002\2555!P\007\331"
+	.ascii	"\0226wPs\002\262\331\210\006\360\213\016U\357\330.a\330e\253"
+	.ascii	"$\246G!\370\353\225\002?\266+F\031\017\326_\240\242\002S\250"
+	.ascii	"\300\343.\336R\370\374\257Un\355\005\035`\334R2\321\212P\314"
+	.ascii	"\373\375\216\205;\276\262\007\003\031*\300\332\030\205\241\216"
+	.ascii	"\366\245\334\350\2143\013\240S\177\216\340\324=\322\361L\271"
+	.ascii	"\344\353i\363\f\026P\214\177\340\310)\276\350\2458\360E\005W"
+	.ascii	"\033\330hh1\355\201lHM\325\337rZ\204\233\224\325\234\366\345"
+	.ascii	":\253\201%\364B\347\252\305\326\320/\\\321\303\211\334\245\f"
+	.ascii	"\220\266G\373\263\025O\237\223\273\016^\232{\035\353rU\371R\340"
+	.ascii	"\316\303\223\r^\034\341\340\361o\303\257S\3066\320\223\257\177"
+	.ascii	"50kM\326\336.9,R\005\001\370\233\203\357\322g\237`\265\344o\317"
+	.ascii	"T\273\tx\302\233\003\215\276M\336\213\036\227\177\372)\303\254"
+	.ascii	"\332\244t\266\200\375s\370\360*{\024\256(\346\253\323\274\262"
+	.ascii	"\300\200\376\231\307\301D\321\372!\316\271\273\036\370\032p\371"
+	.ascii	"\347v\337\311+fSo[\365\031\373\016\320k\243N\344t\361\255\033"
+	.ascii	"f?`\331\\\216\350\004\016aW"
+	.text
+	.section	.gnu.lto_.symtab.20f361f66f6501e1,"e",@progbits
+	.string	"processLoopback"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\002"
+	.string	""
+	.string	"requiresSpiLeadingEdge"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\002"
+	.string	""
+	.string	"init"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\002"
+	.string	""
+	.string	"systemState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\002"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\002"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\002"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\002"
+	.string	""
+	.string	"motorConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\002"
+	.string	""
+	.string	"flight3DConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\002"
+	.string	""
+	.string	"boardAlignment_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\002"
+	.string	""
+	.string	"pidConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\002"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\002"
+	.string	""
+	.string	"servoConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\002"
+	.string	""
+	.string	"pinioConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\002"
+	.string	""
+	.string	"pinioBoxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\002"
+	.string	""
+	.string	"IOInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\002"
+	.string	""
+	.string	"IOGetOwner"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\002"
+	.string	""
+	.string	"IOGetByTag"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\002"
+	.string	""
+	.string	"tasksInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\002"
+	.string	""
+	.string	"unusedPinsInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\002"
+	.string	""
+	.string	"motorEnable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\002"
+	.string	""
+	.string	"motorPostInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\002"
+	.string	""
+	.string	"setArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\002"
+	.string	""
+	.string	"mspSerialInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\002"
+	.string	""
+	.string	"mspInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\002"
+	.string	""
+	.string	"statsInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\002"
+	.string	""
+	.string	"rcdeviceInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\002"
+	.string	""
+	.string	"batteryInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\002"
+	.string	""
+	.string	"timerStart"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\002"
+	.string	""
+	.string	"baroStartCalibration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\002"
+	.string	""
+	.string	"gyroStartCalibration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\002"
+	.string	""
+	.string	"accStartCalibration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\002"
+	.string	""
+	.string	"blackboxInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\002"
+	.string	""
+	.string	"telemetryInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\002"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\002"
+	.string	""
+	.string	"gpsInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\002"
+	.string	""
+	.string	"rxInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\002"
+	.string	""
+	.string	"failsafeInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\002"
+	.string	""
+	.string	"imuInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\002"
+	.string	""
+	.string	"delay"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\002"
+	.string	""
+	.string	"pinioBoxInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\002"
+	.string	""
+	.string	"pinPullupPulldownInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\002"
+	.string	""
+	.string	"pinioInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\002"
+	.string	""
+	.string	"servosFilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\002"
+	.string	""
+	.string	"servoDevInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\002"
+	.string	""
+	.string	"isMixerUsingServos"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\002"
+	.string	""
+	.string	"servoConfigureOutput"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\002"
+	.string	""
+	.string	"servosInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	""
+	.string	"pidInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\003"
+	.string	""
+	.string	"gyroInitFilters"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\003"
+	.string	""
+	.string	"gyroSetTargetLooptime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\003"
+	.string	""
+	.string	"validateAndFixGyroConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\003"
+	.string	""
+	.string	"indicateFailure"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\003"
+	.string	""
+	.string	"sensorsAutodetect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\003"
+	.string	""
+	.string	"initBoardAlignment"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\003"
+	.string	""
+	.string	"sensorsPreInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \003"
+	.string	""
+	.string	"motorDevInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\003"
+	.string	""
+	.string	"getMotorCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\003"
+	.string	""
+	.string	"mixerConfigureOutput"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\003"
+	.string	""
+	.string	"mixerInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\003"
+	.string	""
+	.string	"serialInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\003"
+	.string	""
+	.string	"timerInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\003"
+	.string	""
+	.string	"resetEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\003"
+	.string	""
+	.string	"isEEPROMVersionValid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\003"
+	.string	""
+	.string	"initBoardInformation"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\003"
+	.string	""
+	.string	"readEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\003"
+	.string	""
+	.string	"ensureEEPROMStructureIsValid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\003"
+	.string	""
+	.string	"initEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\003"
+	.string	""
+	.string	"IOInitGlobal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\003"
+	.string	""
+	.string	"systemInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\003"
+	.string	""
+	.string	"printfSerialInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.20f361f66f6501e1,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
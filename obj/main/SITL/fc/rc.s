@@ -0,0 +1,2655 @@
+	.file	"rc.c"
+	.section	.gnu.lto_.profile.ff99915cc0d4390a,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\005"
+	.string	"0"
+	.string	"1"
+	.string	""
+	.string	">"
+	.string	"J"
+	.text
+	.section	.gnu.lto_.icf.ff99915cc0d4390a,"e",@progbits
+	.string	"(\265/\375`)\006e\031"
+	.string	"\204\033\035\007"
+	.string	"C"
+	.string	"\331\342\211\330\013\b\002"
+	.string	"\002"
+	.string	"\002\001\002\002\251\317\374\337\b\003\263\356\307\243\n\004\233\255\271\224\002\005\347\257\340\250\f\030\002\003\002\004\002\003\005\002\003\002\005\002\006\002\006\007\002\002\001\002\001\002\b\002\t\007\370\326\276\261\016\b\t\240\342\234\212\n\n\013\f\017\354\330\323\206\t\n\001\002\002\020\262\320\372\304\003\034\002\003\002\n\013\007\f\002\r\021\022\253\371\220\363\b\034\002\016\002\016\002\007\002\017\013\b\002\020\001\002\017\024\025\026\236\307\314\315\0046\002\001\002\021\002\007\002\007\f\002\f\002\022\002\022\002\b\002\b\b\002\t\b\002\t\030\031\352\263\360\321\b\033\034\035\036\037\237\325\371\277\t\030 !\315\343\301\244\013\"#\245\331\372\241\016"
+	.string	"$\363\330\236\330\r%\354\206\342\366\006\002&'\377\341\234\356\013()*\003\002\003+,-./0\266\333\201\353\013\002\002\006\002\0061\354\305\344\303\001\0042\330\277\200\376\006\013\002\01334\347\273\234\355\f\0025\215\317\243\217\013"
+	.string	"6\201\255\340\307\001B\n\002\001\023\002\f\001\f\024\002\r\001\002\r\024\001\007\002\n7\317\211\341\254\b\b\0078\312\271\257\224\003\r9\326\316\210\243\003\242\001\021\023\001\003\r\002\007\013\002\r\001\002\001:;<=>\234\336\240\241\004(\f\002\f?A\364\217\372\322\017h\002\b\002\025\007\026\001\002\026\002\f\f\002\027\002\001\002\027\002\b\002\030\001\002\031\003\002\032\032\004DFGH\232\214\265\246\f\005I\350\300\306\254\005\002J\316\372\333\340\0014\006\001\006\002\006K\264\323\204\275\016\021L\313\322\375\213\007"
+	.string	"M\247\226\246\235\017\f\002\r"
+	.string	"\200\316\250\3415\251\221!I\222\244\003p\202)\242\242y\021 E\243\254\241M\222\266\003\251I\230E\374\255\224h\202\253R\007\277<4#J\267\213\354q\253f\205\347^\2210\344\277\245!\205`\355\312&\212\316\267]\022\035+\b\243\"\246hz\367\311\255\305\375Nv\t\345\376\301\371>\233^\007G~Y&\271\005sQ,\304#[V\342]\005\037\205"
+	.ascii	"\200\337\332\234\fQe\313\236\006-\026OYXR\374\027%N\201`\177"
+	.ascii	"\317=\351\003\036\220[F\342\214\273/>\371}\247dg\252#\251\"\267"
+	.ascii	"\355\262\273\023\362\351\277B\246\264\177\320\f#\340\267\335"
+	.ascii	"\340R{\372\335{\365^\230\275<eu3\026\377\177A\310\240\302\034"
+	.ascii	"\254\327vW7\276\0133\262\320\230\315\265\335cX\2150\f\343\321"
+	.ascii	"\216\311\026.*\362P])\356\376\321\027\314\342\212\333\bJ=\342"
+	.ascii	"8\220Psa\026\320\232\334\357\325t!\373\245.\377\210\321\bc\225"
+	.ascii	"+\376\326\203\213\030Q\350\317\273\257\224\261\004$<\r\363\336"
+	.ascii	"H\265\021\325\246\302A\215\351\026+\211x\271\022\244o\207w\326"
+	.ascii	"\227u\326\204\036\367\342\205\016\255y\232\325\221\266\270|\232"
+	.ascii	"\006\237\032\342\312\374\036\262>:\323\234b\310\372k\323\376"
+	.ascii	"\201\357\365\224\304)\313v\2275\222WbE\301h\324c\321\206\n\231"
+	.ascii	"\244\253\033\352\256\253 \267uwd"
+	.text
+	.section	.gnu.lto_.ipa_sra.ff99915cc0d4390a,"e",@progbits
+	.string	"(\265/\375`\323"
+	.string	"\325\005"
+	.string	"\362\306\025\037pM\322\001\374\377\377\377\347\352\377\377\007\200\301\223\313\036#\231\005!0\374i\207 \032I[\246ng9\273\321lfb\364\242e\225r)s\3426Ii\035Y\310\303Q\277\006c\261\212\004\342\303\0326*M\236\332[A\t\003\247`\273\002%@7(]\273\221\373\004/ \320\202!\243n\310\260\0236X\007\301L\n\267W\221\263\3345`\031Z*6C\273\024\362\016\034=\256\252\t\377\240&\b|\326\245\020\254 [\036\300\267Q_\300\235\342B|\0351##y09\315vAR"
+	.ascii	"\2649\354\305mpt\b\031KY\007\"\347\204`\221\314 \013!1\221hf"
+	.ascii	"\b"
+	.text
+	.section	.gnu.lto_.inline.ff99915cc0d4390a,"e",@progbits
+	.string	"(\265/\375`W\n\335#"
+	.string	"\226\360\244I\260VU\032\0034\3178\211b[\016\214%\233\323\213\177\351\332\243L8\331\313\261\330+\016Q\026\004C\364T\333\016\214\213\177\024y\032\330\266!?;;\200\3113\306\375\030\3479\025\376,8l\217F\246\002\365\355\344\357-w\n\215"
+	.string	"\220"
+	.string	"\223"
+	.string	"4\267=_\3607\316\202\315\262m\223\027)>X\271\t&\252\211\3138\354\334\314!EHK"
+	.string	"\335\304\022\3254U3\376\262\225HR\266-\376\225;\215\262\345y\"=\371$\211\260j*Q*\366:\320\tF\251\330s0\335m\017_\260\007\307\311\027\354\261y\262\306\325\375\325Zk\350>w\f\274\261m;\353\033\217N\307\315}q[k\255\343\357L$\245b\017\204\352W\260R\376\tV\356\217`\345\363\271\333\033BY\226\334\274\3152$\002C~c\2524xv\214\244-U\242H\240\375\271\333)O\2026.^\340k?\271\272\251Cx\024\004\304\314Gx\204\302\003\256\375^\323\305\270i\004$F\355+J\254\263O>\302\341\036\"'\347\205\360m\006{\200\240\306i4\330\270\375\351\371\212V/\354}}\253u\247\323\327\2662\267F\214\200Nf>7\247\214\200Nh\004,\023T4\237\311\324\351\202\232\253\304\030\001\233\034\f\373k?"
+	.ascii	"\364g\252\265\336LyTk\235=s\3557\177\232\025=27\231\b\217"
+	.string	"~\304\232<\371\024\331\301h+\227\265\202\346\fd\226\026\264\230\346\263)\217H\332\362\274k8o\r\347\022\206p\254Y\236[O\024\323\211H\345h\2515\320\017\260tJ\220\262e1]\352\346\214!0R\2563H\fr\336\201\235IC/\344X_j\255\261-\310\347\316F\325Z_W\2400a\336D\200 \313\255\352\007\267]\334l\360\347vhCcSZ\f\266n\241X/~\365\323\026\254\\\030I#m[H\372\334\301f f)\251\013N\363\204\2620im\342\337\022\373\n\252\225\327\232\304\327|6\306W1\221\310\370!\222<T\314'\031?B\206\362\b\021\2701D\355\227bg\\a\352Y\244)\036\021\242$\376\201f%]r\211\210@C/\210vL\025]\334\303\213b\002\271\3014\264\304\024K\243\206T\030\2714\207'\016 \321\n\001\335.)\366|3\343\344\\\217[:Wo`\355kJ"
+	.ascii	"\264n\333\242zY\365=\221$\247\264No\224R\333\234/\335\372R\035"
+	.ascii	"Y_\252\2233n\2074Z\200\342\25019c\206\206F\222\244$i\016\200"
+	.string	"\002\021\032\242\252\007\022\340\004)\b\243\312@e\210Dd\202\202\244<\222\315 \306l\027\345\342!2\027Jmq$HS\306\037e\376A'\016(i\026\207\302=%\033 \205,\213\023\321\334\3669\001\262\350\037\007\246zA\225\031\352\225\3611H\203\261\324@5\313\312.\247G\242\252c\212\032~\201\243\021B\305\255\324U\253\024'\243sI`!n%QU\200#!Q~\301a\376\203\353tDX e`\322<~\254k\310\333\321\364\272\250\025\366\354\352\350\201\352Fk,\242\275I;\007\301\344\212\310z\031\356\365\031\344\317\302f\252h+\316\214\310R\334!\016\367>\2639I8.\221\256\340\355\335IA\367\336\3423\351\005N\361\252Em\3514K\2002\263\255E\021\265\310\370d\314\214\244\225\212h\004\354\300\022\355D\"U\353\203\353PY\020\224J|N\345\317B\335\376\256;\203Y;4\260\251\026\363"
+	.string	"\2777\213\032\256\326E\244x+\221T\245\354\345\376\020\260*,Hp\301m\t\006\2615\266\034c<RT;x2\341\352l\315m\226\330U\261\351\230\371!\252\213d\022 \244\307\260\277"
+	.string	"?=A}\273\221u\312\315l\250\226@\033)\023\315\213\024tsi\231#\246h\004\222</-\233\251\r\222K\304\240\004\020\304\307\002\375\275$\324\360<^\007U\231$\207\336f\351\260\036\270?\337\027U\260\030\013~\255:\210\"\371\344a\264&\202\006\177\b\244\361\177Z6Q\344\376\262\206\221I\354h?\006\324\234\324Cj;4!\nd:\353\2132\023$\265\324t\346RE \201\333\374\264<\361R&\001]K\270)\315\373$X\032x\f\325O\020\027y4j\232\201\365"
+	.ascii	"L"
+	.text
+	.section	.gnu.lto_.jmpfuncs.ff99915cc0d4390a,"e",@progbits
+	.string	"(\265/\375`\225\004\035\017"
+	.string	"\226\021:5P\305&\035Ps\245|\246\254]\213a\210\252\211*\252\252\350\221K\0261C09"
+	.string	"/W\200Q\310D\340/\2151\260\021\277\r\367\220L@\244V\333D\222\224R("
+	.string	"0"
+	.string	"+"
+	.string	"\327\023\363\254\354\013\224\242\334\226v'b\345\262i\024\325(r\333\304v='\233\302\351\005O\315\223\340\t\262=\225S\212$\242\254\005\275\027`$\313D0\214;\270\374@\215\003\35470(\264\b\237\203\313\323vZ\216\301\323=/lS\313e.s\242\264\277$\354\337\f<\276\021\344\236O\017U\264\245\230h\210\325{o\305V\361\335\274\237[\247\367\214\221\210h!\322\316\223v7\364w\036\\\226\344\022"
+	.ascii	"\243m=\332\216\226\303\245\377\27757Z\2156\303)\376\313b\314"
+	.ascii	"d<2^J\227\322\233\316\220\317E[\260kYN\223v\213\204t\250AY\207"
+	.ascii	"J\264 \225e\r`\002\0212,n\022`\204)E\221\034s\314\031\2220I\232"
+	.ascii	"\222J\2459\033\312/i\030\025\372\342\364\221\367\236\270\f\376"
+	.ascii	"\257}\370k\217w\212\272\004\030\027`.\267\227\224\211\367\207"
+	.ascii	"\362@q\203\033\026\351nP1\364\026R\221\232(\314\245\031\374\201"
+	.ascii	"\rR\341\210\037s\017MM\305\303\3073\323_|bz\006\226<M\342V\212"
+	.ascii	">\262\034\222TH\273\217\004\217\333\021\326\254\326\223\006\216"
+	.ascii	"&\233L\322\351/\024\027\b$)\353\314X\334F\307\244(\035R\303L"
+	.ascii	"G\322m\033f\005\202Eq\232\002\312\356\352\377\352\273\376\350"
+	.ascii	"Gh\243O\b)\346`\214@\003WM,\237I\362\026\233\240\244 2\037\261"
+	.ascii	"\006\302\350\346\250\341\316\345\371\203\371+\331\317\262\203"
+	.ascii	"h\345\007\372#\351\205(4\364$\344\326&\345\274\276J\003\224#"
+	.ascii	"{\236\267t\277\024\227\207R\002("
+	.text
+	.section	.gnu.lto_.pureconst.ff99915cc0d4390a,"e",@progbits
+	.string	"(\265/\375 q\365\002"
+	.string	"\022\207\026\035`O\322\001\363SJ\314F\303\026\005a=NC \240\024\324\351\037\200\006\231\034\323\026v\327\263\352\\\316\271\271\2321sb\306\313i\371*/\312k\262\222\334\310\b\031\037\243\3436.\343.\256\342&.\342\036nZ\031\306\302H8\007/\301\0318\001\337_\364A\237%3\373\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.ff99915cc0d4390a,"e",@progbits
+	.string	"(\265/\375`\t\003\245\f"
+	.string	"v\3202/\2009\031\016&qn\t\027\267\201L\023f\005&h.\301#\205"
+	.string	"\177\240\2655\244\356\266'k+\376\361\025\273\273\363\317y\031\207P#[\312\024#"
+	.string	"$"
+	.string	")"
+	.string	"?\n}\225\025u\236#\215FQ\312'\235\217r\t\177\007\324:#\235-o\373G\235\250\023}\332\357\266\021\263*\257*\235\t\235T9U\307\017\340\241\300ggR&}\346m|}n\262\200\364\275\251S\365=)\2333\357\234t1w. \343\312<\006\251Un],\230rL\345\2320\202p\300\017\r.\2455\257\262\340\207\033\001\245m\340Z\032\377\317W\212\317\224\023\224\220D<tC\031\026:9\233NMy\246\n\235 \036r\300\3121\3768mC\fj\002a\250AQ%IIAJ*Y\016`\2021e5\037\021\240\221c\022\tIJ\n\f\273\001~,\214PbD#\204\320`\366\002\301\215B\346l\272\342\333\351\331\221;\323\214VN\301\370%D\255\017{\206\267G\220*a\024\345\036\372P:\236\305\016%0\365\237c\035Bj%\025\031\203w.\361\234\267.\201\275\034\242\301L"
+	.ascii	"\324\240\034\346{X!c\271Q\263\303Hm\0133\215\004P9#\341\215t"
+	.ascii	"\007\231\001*2\004s\333s\017\234\030\021\305ju=\020pt\2660\006"
+	.ascii	"\342P\035\360_\237\\\212\005R=\241M9\345\322\365\021R\355.\n"
+	.ascii	"m\027E\335{\216O\211ag\350~\266|}w\005\365\373\216K\220\313\003"
+	.text
+	.section	.gnu.lto_.lto.ff99915cc0d4390a,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_getRcFrameNumber.88.ff99915cc0d4390a,"e",@progbits
+	.string	"(\265/\375 \354}\006"
+	.string	"bL-3`M\222\016@\203"
+	.string	"'t\205\200k4\364\263pW\230bX\353\3123\337\332\215\365ql\275t\215+"
+	.string	""
+	.string	"AsP \\2 \200,+l#\215l\231\002K\032\211z\322\301S@(Hx\022\305\3604\230\247\005\003\3525L\023\365.X\266}\260e<\355\341\013R\254\272\031;l\260V\335\335Du\330,\023\036\314\036\353`\263\370B\331>?\216\255\262q\022\220eFd)i\342J4~\316_nG=8W\020\206qE!$\020\"(\231\330\313\024 \252\203\212\211\352\332E\253bu\373Q\210\243b\304\272:\305\nAf\216\326%\321[\377\201_\340\247\b\b"
+	.ascii	"2\003\316:#f\b\3055\3616\002g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_getSetpointRate.89.ff99915cc0d4390a,"e",@progbits
+	.string	"(\265/\375`$"
+	.string	"\255\007"
+	.string	"\362\01655P\215\322\001$c\036\"\3110(\2057!\356wo\306\001XD\250\331E\241\264\177\032'\306\260\004\177CH\252\252\312\250k\306\215a\217p\336\372\266\277\367\226)\005\240\317\203\347\365\352\\Y\274\020\242\302\307\223\020\257\f\024;\233b\013\007Yd\300\260,jT\367\273+9\307\031\271\b\b{t\205\371_Ps\270\243\2416\031\326!\224\336\f\353\220\313\260F\331jU\242t\027\255\337]\251\315\254s\312\316wA\225\004\234\374\023\255\225\223@\226F[\255\325\264u:U\221f~\213S\310\177\202\n`\f\333\326'\243\264v\365T\031&\233\214H|\250\374\217\034\003X\f\2377\026C\207a\315\251\325\336\360K\251@\331H\"\347\305\340\177s#Q\270\316\003mA\002\013"
+	.ascii	"2\241\241/p+\n\036\026\317a\002r\r/b\302\271\204\034\200J#\315"
+	.ascii	"\206w\335\033"
+	.text
+	.section	.gnu.lto_getRcDeflection.90.ff99915cc0d4390a,"e",@progbits
+	.string	"(\265/\375`$"
+	.string	"\235\007"
+	.string	"2O55P\215\322\001$\243.ID\b0\311'B\3176i\306\001X\200\253\031E\241\264\177\032'\306\260\004\177CH\252\252\312\250k\306\215\241Qp\336\376\266\277\367\226)\005!\320\303\347\325\362XX\264\020\242\002\350\223\020-,\024=\234^\013\007Xd\270.,n\266\373\335\231\234\353\220\\\004\204?\252\312\374/\250;\354\321P\237\f\353 Jk\206\265\310iV\244li\267Q\272\213\326\357\377\353Lmf\235Sv>\f\311I\200\352\237ha\271\t\\i\264\315\332M[\247S\035\251\346\267@\211\374'\250@\306\260m\215\362F\326\252\336\226q2J\212\004\310\312\377\3301\300\305\360\231s1t\030\316\234Ym\016?\225\212\022\2554rb\f\3767\265\022\205\353<\3206$\n"
+	.string	"2\241\241/p+\n\036\026\317a\002\n\230\342\022\350"
+	.ascii	"TFi\266\261\353\336"
+	.text
+	.section	.gnu.lto_getRcDeflectionAbs.91.ff99915cc0d4390a,"e",@progbits
+	.string	"(\265/\375`$"
+	.string	"\245\007"
+	.string	"2O55@\217\322\001\230\301]j\324\023\360\021~\t5TIW\374\031\351"
+	.string	"\206\366\253~\033C5jh\350i\235\3120\f\004FW\003\244\030l\225\244~km\357-S\n!\320\303\347\325\362XX\264\020\242\002\350\223\020-,\024=\234^\013\007Xd\270.,nP\367\27339\327!\271\210\266\2050HS\231\377\005\265\207?\032\352\223a\035Di\315\260\0269\215\212\224\253\0265Jw\321\372\335\231\332\314:ov>L\212I\300\312?\261jy\tTi\264\315\332M[\247\267\222T\363[l#\377\t*\2201l[o\230#kS\017\225q\362\t\212D\b\313\377\3301\300\305\360\231s1t\030\316\234Y\355\016?\225\212\225V\03291\006\377\233Z\211\302u\036h+\022\n"
+	.ascii	"2\241\241/\260ZQ\034&t\327\360\"&\234K\310\001\2504\322lx\327"
+	.ascii	"\275\001"
+	.text
+	.section	.gnu.lto_getThrottlePIDAttenuation.92.ff99915cc0d4390a,"e",@progbits
+	.string	"(\265/\375 \360\205\006"
+	.string	"\242\214-3Pm\222\016\204\263\323\220\002H\215\317\362\f_S\314m|\251)\360\370\213eko\n\255\340FP,DUUD\r\234\341\251]8\377\337\267F\032\3312\005S\030\312z\324\301S@(Hx\224\305\3600\226\253\005\003\3535T\225\365*Y\266q\260]4\355\341\353\321\354\317\355\354\260\007\213\325\335=R\0356\312\204\006C\237e\260Y|\243l\234/\216m\002\215\004\204dF\204NR\304\201d\374\327W\356F9\256\377D\031F\247$ \210\017\223\314|\227\002HuQ-R]\273\350U\274n;\032iT\224`\233Lq\"\310\314\021\333H\364\326\177\340\027\370)\002\b"
+	.ascii	"2\003\346:\203i\b\3055q7\002k!2qWL\355$\003"
+	.text
+	.section	.gnu.lto_getRawSetpoint.93.ff99915cc0d4390a,"e",@progbits
+	.string	"(\265/\375`$"
+	.string	"\235\007"
+	.string	"2O55@\217\322\001\230\016\243\377%%c\302\353\0212&F\326\311N\nBw\343G\3316\206j\324\320\320\323:\225a\030\b\214\256\006%b\334j\310\306\213\376\336[\246\024!P\304\347\325\362XX\264\024\"\003\350\263\020-,\024=\234^\r\tXt\270.,n\266\373\335\231\234\353\220\334\204\204G\252\312\374?\250C,\362P\243\f\013!Jk\206\265\310iV\244|i\267Q:\215\326\357\377\353Lmf\235Sv\276"
+	.string	"\214\225\002\325o\361\342r\025\270\342h\233\265\233\266N\247zR\315\237\321a\362\337\240\003\031\303\266\265\207?\262V\365\266\023\312,\025\024$-\377c\307\002\030\303g\016\306\320m8sf\265A\374RN(Zi\344\004@\370\337\324J\027\2563A\333\222\n"
+	.string	"2\241\241/p+\n\036\026\317a\002\n\230\342\022\350"
+	.ascii	"TFi\266\261\353\336"
+	.text
+	.section	.gnu.lto_getRawDeflection.94.ff99915cc0d4390a,"e",@progbits
+	.string	"(\265/\375`$"
+	.string	"\255\007"
+	.string	"\362\01655@\217\322\001\230E\341\2476"
+	.string	".pu\006\031\222\206\342\213\204\r\200\207\272\211\377\217\241\03254\364\264Ne\030\006\002\243\253A\211\030\267\032\262\361\242\277\367\226)\005\240O\204\347\325\352XX\264\024\"\303\307\263\020-\f\024;\233^\r\tXt\270.,j\266\373\335\225\234\343\214\334\204\204C\252\302\374?\250?\f\362P\237\f\013\021Jk\206u\310eJF\271j7Q\272\214\326\357\256\324f\3269e\347\013\340@)X\371-V-?\201%\033m\263V\323\326\351TM\232\3711P$\377\r:\2001l[w\030\225\265\252\267\231NN\251\240\020a\371\0379\026\270\030>o.\206N\303\2313\253\355\341\247bZi$\221\023"
+	.string	"\341\177S#]\270\316\004mG\002\013"
+	.ascii	"2\241\241/p+\n\036\026\317a\002r\r/b\302\271\204\034\200J#\315"
+	.ascii	"\206w\335\033"
+	.text
+	.section	.gnu.lto_applyBetaflightRates.97.ff99915cc0d4390a,"e",@progbits
+	.string	"(\265/\375`\335\006\255&"
+	.string	"\272D\004\017J\220\232Q:\005\302hxC\373\202\260\252J\353uy\243\222\235\2573g\245z\376\001\220N\310\240\230\245\022l\353N>==\353\337k\3333\356\360\004Q;\210\327\311\234w\327\342\031\201\361zn\345g\021G,!\204\020\"w\222\001\334"
+	.string	"\307"
+	.string	"\333"
+	.string	"S\250<\240*\230\325+\341c\261\272\204\005R\224\021\r\350K\373$\277b\325\212\2076\240\354\"\301\300\242\312\200\204\207\350\213\244\235uK\313x\357m\360\222)t\025\013Rv\221~N\017\254\220\207S\300\020\357\275A\274\340\366F\\pz/\224\026\361^`\020\373\240/\231\231?\344D\214\230\207\244Pj\352[C\216\222\244\271\367\336l\237\231/\311\353\230/[\307\215\256\306R\3644K\262\255\021\377\244\360S5\346\307\205\245\364\342j\017\324R\215\307b0\262\0349}A-9=\245\201\222\f\236\256\3148\227\244&r\266\005\207\230\023\337\023Lr\262'\227\244\032G\326dz\271\302\260\344\2147\216\022\220\264\335{\177u\213\244\364\263\366\244p\357e\033Ci\351lsf.2\263\021\263y\003G\300"
+	.string	"-\030\206K\321\005I\335{%0\217x\224\022\350\275\027\002\224\026&\200\244\246R\230/m\007\355(\276x')\370S\274\343\331\307\340\231/\337)T\226\257&\237=2\013\177\266\243\230O\336\316\301\f\364\254s\002k\371\307\247\307\206\340U\377\201/9\327.\374\r\334\310_\340H\316<\267:\323.<\017\260\226w\254\345\231\265,\300Z\3269-\0070-\347X\3132k\031\200\265\214c-\337\234\226mL\313\252\265\034\263\226Sk\031\265\226Ok\331\264\226Kk\231<-\267i\331\226\226\257@\025\262\245\001\327\2752\216j\256\226\262\370\343Y\377\222\037\311ou\222\371|&'2\253\254\342C\026\352\272\367je\261\bMk\244)\317\331\3229\350\302\335KN\253K\\_\262\366\241\365\200\226\365\237\246\320\254\301\237ik"
+	.string	"\335\3236\311\372\364\263\307\256&g\264\2408\r\240\033\312%m\215S6Mq\255T\277\262\243\370XO\251\244\2045\202f\322\032\350\001\215\304\314Jd4\246\037G\262"
+	.ascii	"-\330M\333\372X\326\240M\337\364\351\265\032\325\266\351\037"
+	.ascii	"\205\371\354\021\213.B\356W\204\272\324\376\325\203\270l\005"
+	.ascii	")\222\261"
+	.string	"F\033A\333\255\365)\355X\327\240\254A\036\336\246][\263R\325\372l\264\tx\031h\263\317&\263\314\246a9\320\007\272\354G\341q\\\203\277\341q\204\251\022^\236p<\232\001\336\353\373!\273\326\326k\r\376\354\221\273\311\246y\255F\333\335\307z\251\206\007\232\2430{\357}\321:\3236\210LB\210\210D\021nw\033\342\355v\274\034\201\036\257(\207\023\321\323\241H\301\201\207b\205\256\314\365L]\021n\203\356\304\210!\\J\004\242\302\215\210\020C\270\335\216g!\327\213\021\225X\201#9'\224\353\335r\"nC%p\273[\256Gt\023\322a\036\n]\357V\304\343\365n\252\320w\362v\016\276\326\323)+O1\240>Ae\214\351\323<<\250\321\212\360\313\350\353\237\332Q\374\341K\272\323\037\254\320\023\237\336\260r\243\314\217\363'A\3734Pw\3501\\\203?\t\200\212b~\\VUb\035\305O\212"
+	.ascii	"\221J;\0073\333\237Y\327\230\310\034\271\002\264`\227\0023\022"
+	.ascii	"\321\216\262\3029\361\266\211\311\213\2150]f;]z\t\350Y_\247\005"
+	.ascii	"\364\003\264N\363\234Y\215>{\344\234\016\320\327\372\205b\217"
+	.ascii	"\253\2430\337y\203\212V\331\323'\250\370 m\001\177\250a,\004"
+	.ascii	"\021B\206\231\032\031\221\2440\205t\220\002\03112z\021P\251d"
+	.ascii	"\210\210\266\244(\351\332m\224\024\372\225\302\376\255:E\013"
+	.ascii	"\021|\366\273\204\347\364s_\247\322\316\334A\360B\353c\2645B"
+	.ascii	"\216[\b\242\021\256\260\2640\037\247\303dq=Z\356\371X&\250\b"
+	.ascii	"\033\374R\034\344\013\322\356\tu\364Rl\001\203]d\b\203\026\234"
+	.ascii	"\336\245\324\362\\\221\013\305\370\326\205\261\032\265NA\213"
+	.ascii	"u\033]H\357\363E5\277w\205\343\341\221\264\276\375\356\243\206"
+	.ascii	"\231\345\260\306\237\216\220\343\237\303\261\032\374m\327yQO"
+	.ascii	"\234\032=\233>Y\0241 T8i\021\0327\335\303Z8\017mE\321:\206nd"
+	.ascii	"c\201\274\362v\333\t\026\222y\316\257\376\013.3\2515-\326\242"
+	.ascii	"{\201\206\245 \334\245\351Xx\252\003\007\235G\265\352W\213D`"
+	.ascii	"=\224\333\275Y\361\360\321\303\361:\310\2745_i\212\310\245\261"
+	.ascii	"2a\270\243\342B\033\016\375\216\237\017.!\205dl\362\243\002"
+	.text
+	.section	.gnu.lto_applyRaceFlightRates.98.ff99915cc0d4390a,"e",@progbits
+	.string	"(\265/\375`\357\002\265\024"
+	.string	"f&\206I\300\222U:\362\020\325\213a-\013y\216\366\027[\304lu\357\b\202EFgD\335\246I@\026l\"\204\007\264qv\231:\335\002\271RJm\n\016S\310B;g\201\0317\300\340!\206*2\221S\333\246\233\211%\204H\231Rp"
+	.string	"b"
+	.string	"x"
+	.ascii	"?\243l\373\f,i@\270vH>\204sN\004\037\315\262=\016\"k\342\350"
+	.ascii	"D(P\236\2018x\f\3159U|\340\372\037\0176\315Y\242\306\320\234"
+	.ascii	"5*&P~\264\355\2778\f\234\r\024y;<G2\262\371\005\231s\302\006"
+	.ascii	"\274E~\024oB~\334\024\307]q\376\177\027]\254\030\336\344\320"
+	.ascii	"\\K,sN\353M\216\316\275\267m\300\366\004{e\00270\344\307\357"
+	.ascii	"\252\227\344\023\"\247C\233G\243\213\302\2768\367\204\375z\357"
+	.ascii	"G\271\357>9\357v\235\367\267\376\363\003Pu\211\252IT\315R\365"
+	.ascii	"jT\253T\235R\365\b\251F\215\352\223\252M\252.U]R5\251\352Q\325"
+	.ascii	"\"\251\336Q\255\242\372\001PB\035+As~\030\016\231Gc\220\305}"
+	.ascii	"\277\215\363\003\250 \355\276\035\263\333pp\332\004:@|\2029\323"
+	.ascii	"\272V\177\345\232v\205v#L\364\350\361 \f\207?J[\356w=\344\212"
+	.ascii	"[\352\321\001o\255\2313W`\\rS\222v-Z\333\332q\005\b\355zt:\364"
+	.ascii	"\256\270\257\242\235Pw\3676Er:\254p\032\264\003\355\3149\033"
+	.ascii	"\330.\237\201\241\234s.\220\321\241\366`\207g"
+	.string	"\206\374\250{ \025\301\007=\306\214\317c\033\214>3\231\030\205Y\006\332K\314\024c!B\252\345\302K\254V\263I\220\335N1.\033b\242e+\262\033L\326\002{q\211\325`\262[\fl\305\3046\r\263\033L\306f\273\301P\274y\373\265*\034\243\243\334\352|\262%\373\332\023!\331\222\025\177\254%\331\024\224]-k\311\237jWK\022\355\2047h\317!;\321\211T\313@\007\210\220`\216D\231\332\223}\221kG6\265G\355\310\276~\247\r6 \240\002\231\262\352\006a/\024\026\3710>\nn\330pC\367\005]$\303\321\222\223\r~\007\357\t3\330W$\334\312Jl\034\245a8\232av\256\326\304\003\276\312\224\345rd\356\b\264\230\210\320\235\201\021\024\310/X\265\253\330\025\366v~n\013Y=\3242\302\325\225\023%BBpOt\332H\274\215S}\220\007\021\3339\304\n{\206\025D\260\306\343"
+	.ascii	"\006\024~yL\355\"\003"
+	.text
+	.section	.gnu.lto_applyKissRates.99.ff99915cc0d4390a,"e",@progbits
+	.string	"(\265/\375`\337\005\245!"
+	.string	"\226\273\321K\240RR:\223s\003\0233!&62\242\356}We\225\310\267\362!\217\374\214\303\263\027l\005.\266\307n'\230\277\340\373\340\356\355\345\363\367\313\264VD\365:<\002{F/Q\b\3621vw\027\315\314\237\346\033!\204\220-e\n\277"
+	.string	"\237"
+	.string	"\306"
+	.ascii	"\267/\244\246*+I\n\306\037}\2040\327ii\r\013B\327\217)\b\022"
+	.ascii	"\271!\332\232\274\367\026`\363Av\013\251\204\271N\252\210\003"
+	.ascii	"]\374\261G\031\331\275\327\300\007p3\215\017\267\335\253\342"
+	.ascii	"\213\354^\241\201\007H\331\374\177\226\3013\222\376cY\264\272"
+	.ascii	"b45&/*\367^\235\017\327\234l\226<s\262iYp\022\247\350i\226\266"
+	.ascii	"\223\316h\020\030\377py\251H\302\210 8\215Q\361\024\305(\023"
+	.ascii	"\237\3031\006\220E\"\252\315\b-\2222\230\302\210&\270\304\021"
+	.ascii	"\205\245\317\275\367F\\j[\022@QV\002GT\313\232\263\025LX\214"
+	.ascii	"\333\211\270\324\215\006\335{\337M\304'\276\215\377G\375W\372"
+	.ascii	"M\255J\220L\3068\216\316W\367\375\232\233~'\233l]\220kZQJ\275"
+	.ascii	"\376E\265m\325\317\345\265T\177\367{\270\213\317\303E\346\035"
+	.ascii	"6\362u\272\237\303[\3148\374\305\277a\032\3146\335\317u\277\246"
+	.ascii	"\3734\335\237A\3732g?\246\3730\335\177\351>\256\373.\335o\351"
+	.ascii	"\376\255\373,\335\267u?\355>\212\366\317\263ov\277"
+	.string	"D\373\366\354\267\331g\037\034\324\231n\310\275#V+\327\314D\276\340.f#\363\027\333\237\307\314(]l\203\305\376\3339p\330m\3105\006\207\377\306f\377Ig/\256\301`\017<\224 _\254\213\205\26187\206(p\366\305\346\244\335\340\254N\220!\326\215m\261.\326&\255\305\236Wv\354\216\275Y\206\361b\315\321\261\f\306?Y\253\212\304\370C5m\025[\251%\311\312\343\377\376\261\331\035\250'\\e\302Vk\034ig)\254\2552\342\242\240\214Hq\025\021\"l\265\333\354\217\334,\266l2\304RSk\263\214cQ\233Z>-jm\322L{\372\3501\023\036\367`4+\323*xZ\265\220G^\261d\253x\317`]\245\b\357U\372)\355\215\355\033\303,\265\327[[Z\033\264a\262\255\265\314\264\366?\340\035\275\005I\356\275\t\376\013\254\203(\275\367\"\310\341!\003\202$WG'\233m\027\004\307"
+	.string	"\024\304`\264\363\351\212~>\337\217\2073\324\333"
+	.string	"<r\300\003\246\301\236\321NB/8\001I\303\213\204`\220(\003.X\241\201\313\220\205\242\235\317\367s\300\003\262\004\211:\354\312\363\200x@\035oHWD\264\363\351x\300\240\016h\346?\r=\240\316\350\367\003\352nE%.\257\245\272\320\0214g\205\214gnlj\312\b\363G\256bF\325\323\223&\241LUI*Y5E-\325K)\250'\\BN[u\241#%\213\0252\262\030\333\246\200\270\350\034\353\364\177\035\"e&\200\307\324r56g\373\3120\213\307\352\330\032\313k1j\f\263T5\304\t3'4\226\307r\220\031\013cid\354\214\345\361\212\2612Dz\315c\307g=\026c;o\250q4\303\024bH\321\214\210\302&\205J\007\220\002\221\271\252\016\021@\251uhJ\242\242ja\r\272\271\305x\225\0012|\177;\250\320\262\005;"
+	.ascii	"x\037\300\337\330;(\307\335\347vyWj\251tw\375\366\\\025\243\222"
+	.ascii	"\200\202\336\t\bz\260(7\033\226\275\217\241E#G\360-\033(\314"
+	.ascii	"H\330\352\315\313\316\303'\343H\032\202\251j\036\330}~a\016_"
+	.ascii	"\300\217A\024\254}\204\342K\213\215\254\222/\202\313\2315`\206"
+	.ascii	"?\324\355\227\t\340\234\b\3548\357\220\037\302_\365_\301\004"
+	.ascii	"\020\371\0210\307\333\301C\364\245\321\023\351,w-\2470,Q\035"
+	.ascii	"\244^\324\361E\240?\374\223\245j<\b\242^n\264R\261\"\202G\201"
+	.ascii	"\251Hr\247\310\256=\360;n[xh \203\034\t\330\215\2257\025\201"
+	.ascii	"\270\312\330\275\237\372\205|\350\345\262\227\274?"
+	.text
+	.section	.gnu.lto_applyActualRates.100.ff99915cc0d4390a,"e",@progbits
+	.string	"(\265/\375`\311\003\035\032"
+	.string	"\326\360\251I\260\226Q:\264c(\2748Z\203\031\006\374\312\340\016\361\004\237\214\254H\254>\307\342\253y\342\270\375Q\355\210\033\223\346_\272>\351\207\331\016\343\024x\372s\362\372W\241\244\363R\312\031?jMw3\027\177\264}B\210\224)\005\230"
+	.string	"~"
+	.string	"\234"
+	.string	"B\252L\374T1\325I\216-\027=\257\223\267\205|\250K\235\312\261)\023\205['\246X\210\n\022PD\233%\214Z(Ix\nz\r\241\2409\262\361b\312\234\363\300I?X\247\240\2216K\004\221\022\350\320D$L\210\3149\021\330\300\365M#\f\233SF\020\"s\026!\360\200\327I\333~\217\373\020\262\211\343\360F\322\267L\030Ae\231s\336\004\034@yr|\255<\2716.t\025\362O\365\221\007\023\226\243\024CW\327\2039\247\365(\205\212{o\273\200\355\f\366\250 '\202\360\223\354\363\240?\362P\236\374\306\200HiaA\244E{8\244[\303\3768\227\206\375\247[G\3259\257\272q\036u\337\330\334\351\267}\370\327|\352\246y\323\017@\3255U\317\250ZF\325\264R=#\3252U\307\224j\030R\035\033\325/\252\206\251\372\245j\227\252KU\223\252\036K\365\222j\035\325\017 kr\262"
+	.string	"\313\234'\212[f\026y\245\343U\377\323\037\365O}\264o?\210\0371^1{\263j\005\2631k\263\022[\230%?\227\202\202\341J4\360\034\304\366RQ\222\274\354\354\211\025\023\013\333\302\326\346\265\345\302\326\245%\204Q\263\256}\255\315J\270d\342\325\2656+B%\232%\267\334Rk\246\344}\244\254Y;\247\323\037\221\033"
+	.string	"iG\026\211\035\262\211\237!\305i8\355\240X\254R4'\021\201qi\366X\302\245\240\026\275;\256\013K8Ew\367F]\210\264X\341F~x\026\330\273_mx\3159y\212\210\340\355\334\230s>\tDyR\227\007\307\325\207\004=\030\324\307\327!\204\216\f\002\356>\354\200;\240\236\216\302O\007\354\351r2: n\202\216\303O\017\007\003\352\201\020\343\223\241\207\343\361|\021r\277\027\240]\b\334\350\334N\356w\313\371\334z;\034\357\226\373\001\335vj\366u\320\375n@\237\357w\213\r\347\307\2714tV\206\364#\213h\203\256\355\314\352\300\310Y\233\255\255MK\270T\2633{\252\223JL[\302\245\240m%\200\2639\333"
+	.string	"Kx\345fe\026g\017`\t\225\202\264\225\331\317\226\266\f\240d;\313\372\331\247\013o\242\\d{!\037\251\254\260\322\022C\250Q(\004\215S\004\231###-(h\241\003\240\002\221*\253\007\021\220!fE\232j\337a{\021h\212\324\f\366\324\373\3509Y\374\3447E J\266\0343v\007h\347\374\265\263\r\373g\255-\334\340\325\262\237{"
+	.string	"\264\373o_D\bp\220\300T\004zB\3608\227o\311n\246jpL"
+	.ascii	"G\351i\334~D\361\227\020\224G\216\213\303q\222\272=3[&\204\320"
+	.ascii	"\352LB\343\030\021\214\017\017r\255\3637`\201\300\241\033\220"
+	.ascii	"\335{^\f}\266AL\023\276V&\245\247\001"
+	.text
+	.section	.gnu.lto_applyQuickRates.101.ff99915cc0d4390a,"e",@progbits
+	.string	"(\265/\375`4\006\215%"
+	.string	"\232E\030\017H\200\234Q:\237\221\216\344X\004X\221-\215\203\017\201E\351\027J\264\b9d-;\311\301P\365\200d\033\006\306\032\343\001\023`H\177\276e\030\211\352\336\201\021iv\3310\324\035"
+	.string	"\353\026\206\300\364\265\375\243\355\023B\344N2\341"
+	.string	"\304"
+	.string	"\336"
+	.ascii	"\314M|+\277\362,\327r\345\265\330\266\\\341+\346\356\321\t\311"
+	.ascii	"\324\275\311\245-\307jz\326\n\332]\322\236\234\244\230\367&\223"
+	.ascii	"hGs\366\272\364\212)\t\t,L2\214(az"
+	.string	"\260b\245\357\230\273ONM\2468Ta%\355\205\215\335J\346\204y\357up\224-\364\024\2463w\237\2143 \330$+\275\204-\357\275\017\230\301\355\243\270\340\332\275C\262,\357=>`!\332Qf\346W\035J\023\263\362LFI\235\354\210\223\0259\367\336\237\357@\351\321\363\272\364h\033y\323\321\263m\023\377Z\037\242\022\306Hv\205|q\264C\022\246\2248WH\035?q\310\343\351\273\367\332\2200l\237\r~\200\345\300!\215'\220\030\0215\357r\373\204\204a\355\314\302\275\227\255\f\344\215szfV\231\271\007sJ\024\214t\302^\306\211\364\350\373F\206\253\214G\3216\231\223F\333E\230\177\336\206b~\362_\360*g\005\326r\202[\235\207>\345\027:\2263\202_\235}\317:\037\250Y6\360\256s\320\227\347\336\243\374\005\254\345\001\3262\317Z\026`-\357\254e k9\200\265\254\263\226\177\254e"
+	.ascii	"\326r\316Z\366\261\226q\326\362\315Z\356\261\226m5\313<3\313"
+	.ascii	"5k\231V\263<\253YNg\226Qk\371\244Y\356\231e\233Z>\003\334\034"
+	.ascii	"\261\n^\367\326h\326\271b\320\255%\357\372\253\374V?\226\377"
+	.ascii	"\352\317\372\227\2371\237\371[|/\266u1\327\357\215\373\030m\310"
+	.ascii	"\244Zpy\027f\033/}\213k8\300\344,1\333\216\332J\240\326\365P"
+	.ascii	"?l\375\021\240\201\272\207"
+	.string	"\265R\005\350\336\233u\312\327?\255k\336\232\237N\303\204Z\250\001\364wT]\311\365\255\021\364\264O\347\232\307\265~\031-\256}z\266f\235\272uO\343\372\353\327\254o\235\216\035\350\236\276\217'qV\246\362D\322LI^.j6\335\034\357-\016\331\332\327\026k\2452\266\255ykVf\255y\372f\324\242\250\020\037\253\265\017\231\256\262-\003}\240\257\365\237\261\240\236\265\201\376\n\247\327\263\246\020\306s\346J\323\016\352\236\035\264\323\376\030\325f\211\270\230\275\202\366\275~r\341\322\345d\253\370\025iw\257\277R\031m\223mw\3331\247;E\333\334\3600j\321\231{\357\004f\340\303\214h\367\336\b`-JH\210\272\367^\212\330Eh\266\376\345_D\276Tl\202\210hBI\r\376\222\204\301\240\020H@\025a\215\224T\017\300a\372\241C\006\026j0eRB\032\252FIH(j%\220\216\222\204\0304"
+	.ascii	"0R1\\\002\242C\241\022P=\032\032\245X\"\332\210#.\334\216H$\251"
+	.ascii	"\301\240\020\003p\310CDb\241\236\f$\002\016\177\300\243_\022"
+	.ascii	"\222\032\374\001\207\304\037\221\216\205)\214\206?%\241p\370"
+	.ascii	"\263%\213?oC1\b3\247\200\006a\365.\257\005\001\023"
+	.string	"\244\311\306&\350'f\246\235\006\21521\3056B\235M\353\024N\231\230\335\200>\233\355\352FA\363z@[;\013\372\326\274\376\223*\257\225*\201\202f\002F\205\314\352\313\210v\221G\315a.\317\206bf;\264\353\240\035l\250\200\035\355\034\253\365FLHw\021;M\216\234\273\346\261\243\f\020:d\302\034\355\034\336\t\350\023k\235\032j\004\275\353\273\251\nh\250a,\205\024B\310\031\233\021)LR(t\200\002\021\252\243n\021`%VEB\322\202R\213\001\242\027\033A=\304\017\343\007x2v\255\252P-\020\244\211\031 DA\365\200\270\272\207\222a\305\034\273t\220\003Yle\001\202\331\237BCQ\244\315\321V\3106Q\321\315P\231xj\005*\206\232\317\241\310R\320\310\004\2171t\274i\267\001\004\365\024\360\306\271P\036\"\300\320\b\367\232\366P\275\rX\237\315?\234\214\361\205\0253\370\306V\363"
+	.string	"\213\245\3137\301\317\002K\345E\211\245w\311\304=\366\3136r\331\003\244\255\215\032j\265u\225\004\311@)"
+	.ascii	"UI- \243n:\206\316\f\242\243\b\220\005\355p\214\344\356\035q"
+	.ascii	"+\b\316n\037\223$\017\016\023\035\373\373\236`\233\020\0348\220"
+	.ascii	"\025\305\177j\325\254s\313^\207\377"
+	.text
+	.section	.gnu.lto_applyCurve.102.ff99915cc0d4390a,"e",@progbits
+	.string	"(\265/\375`h"
+	.string	"]\t"
+	.string	"\326Q@:@\305(\035\340\311\252[\002\374$\3431\b\340\022\262.\363`\"a\322"
+	.string	"`\312S\226\366s\201\2276T)pZK\342\030\206'\027D"
+	.string	"F\327\341q\222\033\332'do)S\n/"
+	.string	"0"
+	.string	","
+	.string	"\037\207\352\002B(J\\\273\253iN\200=\302g\260G\335\270\367\364\374\213\034~\254Z'\024\351\231-\354\256\363\204\262\270\365\266\rl'\330\217\001\232\276e\340\"\200\202\311n\305k\300\002\210)\036\266=\033c;?\267VN\016\236gY\305\227\335\214\016\224\335Ep\201\345\321\266\017\362\225g\267`\352k\246\032\223\222\f5\365&\327GN\"\341\253\f1\312\237F\330\343\365\202Q\312\227\375\221R5\354\303\325Tv\326\037\377\3750\323\031 \356#\332:\r\236\016\203@\350\023\301\201\3366[\247m\036\r\364\3418h[\027\3226\031s\017\235N\023q\\\247a\276=\\Me\252)\351\204\261L\205\032\003\017"
+	.string	"2\241\023(0\244/\036\241\247\354\301V\327D\236\211\346\253G,\306FP\016\204\006F\004\025p"
+	.ascii	"*\217\251\235d"
+	.text
+	.section	.gnu.lto_getRcCurveSlope.103.ff99915cc0d4390a,"e",@progbits
+	.string	"(\265/\375`I\001\305\r"
+	.string	"\326\331ZC\020\2574\035\300\370)\033\347s\006e\317\226\222\367\002\023\325\021~\001\332\265\324\177IH`8\274\005wS\257\345\202\020\207dO\027[\005"
+	.string	"\200pA\237T0\300J_\323\225\016\003\350\254\233\210\320&R\246\024F"
+	.string	"C"
+	.string	"I"
+	.string	"*\226\361\265\213!\205\304\356\026\260"
+	.string	"\353\321\266\237\362\221g\223\246\360\004\34530\024@\324\354\256\3269"
+	.ascii	"\352q\272\006\365\250\033\356==\377+_\0203\242\021\221\214<+"
+	.ascii	"\005\273\353\024\221X\270\365\266\007\3306`\177E\316\2464\226"
+	.ascii	"\351+\323\326\224\2562M]\345\217\017\177\315tf\372\034NI\n\004"
+	.ascii	".v+\224b,\212X\202\203\355\277\0348i\271\213\310Y\254&f>\354"
+	.ascii	"n&bg\217i{vf;C\223N\220\b<\037\372\2273\2502\323kTc\272\321\016"
+	.ascii	"\250#\276fz\260\346\">\"\202\217bPH^\024B=bz\227o\264\250\200"
+	.ascii	"q\341#=\003\013\226p\235\240Tz1a\367\333P\275\276\005X\022\312"
+	.ascii	"\222\035\206R5\330\237VM6\231\001\037\334\007d\3638\360\3604"
+	.ascii	"\300@\037\t\035\2237\216\255\3236\017\355\343\323\361@\333:\220"
+	.ascii	"\306\241a\016\202\247\323@8\256\323\262\360\373\264jBi\347\323"
+	.ascii	"P\210\335\315H\2454\200\f\350\341\322\215\246~\3451fD\003v\b"
+	.ascii	"Y\252\225^\252\026L\025  \300\"!\244\036\242\320\352\022xv\024"
+	.ascii	"\004\212\235W\315\321Z\213\f\3030\214\334\345\305\245\2026\""
+	.ascii	"\210\2422\252q\354\334\270\303=\021!\321~\320mX\201#T\212\220"
+	.ascii	"\020#@\244\220\260\250!\340\303\202C\033\3002\232\332\365\004"
+	.text
+	.section	.gnu.lto_calculateSetpointRate.104.ff99915cc0d4390a,"e",@progbits
+	.string	"(\265/\375`\325\004\025\037"
+	.string	"6\270\304I\240\326Q:\304[\3749\367\002\fd`\004\024~)\201\017\223>\201Ir\323nw\275\032EgI\207\343f\347?$\366\031\377\320\207\237\360m\033\256\037\346\340\224aa<\342{\270\200\227\357\031r\303b\360\177\022K\b\221;\245\251"
+	.string	"\242"
+	.string	"\267"
+	.string	"\177\262i~q$\206\200\304uD$MS\332\013\233\366\262\276h\232m\242\217\247\020Q"
+	.string	"\240\327\223.i\232*xi\004\347K\333\257\366\211\274H\357F\254e4Mw\034\227\244i\272\300\006\316\227\004^3_\222\3071_\272go9q)\225)9\tB\205I\323\324\266J\357\035=efIn\355\371/\036\025\026\t\035-\260C\206\321\317W!2*\276"
+	.ascii	"\020\242a\225\331\270\t|\n\326\222\306\311Y\021\215/\231\340"
+	.ascii	"\b\312\214\232\"\030d\215\n\217\260K\275\016\025\375j\225IH\323"
+	.ascii	"\324UX$\343\236\335\266\221m\02369\025U\346\313\272\013z\f\225"
+	.ascii	"\274\312\3073M\323\007\376\324\251N\370L/\375\223\242^\230\302"
+	.ascii	"|\371E\203\224i\272\362\325\261\373\020\036q\355&\271\336Z\246"
+	.ascii	"\315\336\300\301\305\t\fF\035c\023\177u\223\354\223\351\"\331"
+	.ascii	"d\265\316\211w\316\215w\r\347\346F~\233G\3355h5\315Y=CV\323\310"
+	.ascii	"\352\031Y\215\276\372\224U\313\314j\263\254.\311j\222\254^\262"
+	.ascii	"\272\222\325\037p \354\350\206\322\326z"
+	.string	"\021\323\030cdR\256\362\352\307\215\177\324O\374\332\267\217\304Or\251\250\240\327\230\b\347K\243\213\241\036B\006w\n{\251k\b\222\t\036\027gkv(\347\351uX\343\212\021\226\025)\350\322\366@\261s\321]-`\027\331\236\373`\031\257\0135\353\313\030\336\225\301\001\226\335\206j\374b\342m\315\002\273\362U\271\025\036\007\017\036\314\227\346\276x\322*k\252\251\326\266fm\326\345\346,\001\340\n\331\237r.\026\037@\2000_\226[f\031\305\fkQ|\034\260\004%\204\354\013\224\230am-`\001\303\324\354\226\217\001\276\232\334\211\b\022\267\233\371R\366\364$f\350\253c%\271\2737Lp\256\"G<\013k\027\r2V\255\300P\321An\322~qv\241\200[\277/\271\225\217>\223{\\\345F\261\303C\021t\313\331\200t\271\234\016'`\306+\301\343c\002\350\226\313\351&\340v4=A\267\016=*N"
+	.ascii	"\335P\336O\213\033i\334\016ng\303\371\330\200~n9\033n\307\263"
+	.ascii	"\355\340X\267\242gg\013\322\351v6\032\321w2]$w\020\302\345\333"
+	.ascii	"\037J"
+	.string	"\263b\275\246\006K]\356\2457\244W\244w\244^\330;b\276\274P\314W\307\234\2634\373\342m3\250~^F)\276:\366s\223\034\302h\316\320\034Ort\035K\332\352\234\3471g\326\307\t\314\017\273\026\236\t\024(\230/g\266|\242j\322\311\342#\200/\260\n\267\027_\245\234\204b2tsv\266\256\300/?s\223\334\353\"o\002a\250!<\306\020TJ\r\211\244$I2\034\200\002\0311+\017\020`f4I:_\220\300\303\244\221\031^&\b\204\362v\r\264\2318\3419\301\361\246\001A\213$\207\242\b\002\n!\333{J0\037\236\rPe\335\231\204&Z|\337\356-\210\331\346!\317\177\"\007\324\271U\352k\226\235B\252\201=\022\024H\0205\336\246\177\203\267\204\355%\236X\363vv\227\016\256\222\261\204\016\271\206\261)z\177\355\302TN06\261\356\004\021\277'\250]\276!2\263P\335k"
+	.ascii	"\377\371\224\242ud\3651c\277\361\fr{\026\240.Z\200P\306\327\032"
+	.ascii	"9\203>\361u\003S\207sk#\230\216j\344\007\233\222\t\001\275|\374"
+	.ascii	"\023\352l.\375\364Qce5"
+	.text
+	.section	.gnu.lto_scaleRcCommandToFpvCamAngle.105.ff99915cc0d4390a,"e",@progbits
+	.string	"(\265/\375`\022\004\355\030"
+	.string	"F.\235G\300VQ:t\230C\271\b\236,=\202+\353\002\035&\265\025'\220VC*~\004\365\331\210q9\362]\377\234\267\271\212\027x\023E\346\222\334\277\246\2409\bD;\361\341\034\253\215Y\007\177\232\207\252h\237H\"eJ\001\210"
+	.string	"u"
+	.string	"\220"
+	.ascii	"\337a\205y\342\300K\214)~a\342\322*\341\370\356\347]3\363\271"
+	.ascii	"\366\337\343FN\361\334\203\335V\321D\211\034B\003P_\177\307y"
+	.ascii	"\364|\347\036\312G\205\013GE\307\226\030c\201\257\003\240\276"
+	.ascii	"\260\347\204_\360\255\360\353\036;\313y6\342)\350\305\317\321"
+	.ascii	"\227\030cLk\274\347\240f\217\177\243\313\344\200|\016\262\270"
+	.ascii	"\2020&K?*\240\033\370\322\305h\272\321\323\004\220-\363\304 "
+	.ascii	"\306\350\314\001\255\270\367\266\033\330&`\203-\002`\354\003"
+	.ascii	"y\220\n\376\r\223\270p!\374\246\n\bra\f?\312\200\212\361\206"
+	.ascii	"\300\367\361\037\033\374\033_\317<\344s_\337C\370\275\246\212"
+	.ascii	"\034)\332\325\362g\363l\2514\354\203Qu\366w7\354\274\373\265"
+	.ascii	"i\235M\2736\235\263i\234M\2676\315\332\364\315\246W\233\266\331"
+	.ascii	"\264j\3235\233\246\331t*L\317\200i\231M\2436}\332t\030\246w\323"
+	.ascii	"\340\246\025L'\230\016_\230*\221\257I\251\226?\003_\342\336\313"
+	.ascii	"F\2141\201\237\344J D\220 !\374\276T\211|EJ`\315\021\021N\312"
+	.ascii	"\347h\324\236P\223R\232\031M\311\350\214\376g\214\022\021\031"
+	.ascii	"M\351\2204\355P\352'\275\347\336\b'9\311\227cZ\345Im\036Y>\207"
+	.ascii	"R\330M}\354\336Q\2109!#z\301\357\327\345\026cm'\324\223\0367"
+	.ascii	"d\313\237WCM,\270-\253'B\362\3623\346\212"
+	.string	"t\025HZrL\0073\343\027D\225F\352\225\202\217*\267\f\0324\314h`\b\036\021j\331\001\031-&\263\020\343\200\201gCLF\373\020;\320\362\254C\005Z\f\304lF\213\245x\265\203Qu~ f\251\2466\203z\305\nK\214*\250\243\352R\034\325Q\035\202\203a[\251KO>\334\220Jq\364BB\264\340\206rT\212{8Qn\364\326Q\216\251\246ki\216\206]l\371kZ\212\321u\213\261\266\303\322\226:q\\n\324FY\252FpB0]\351\r\224\225*\bz\251Jm\226T\232\3229)jr'\356\001\230\342\313\333H\030G\250Q(\346\024R\210\261\241\244\260$-\264\030\240\002\021\2619;\021@-c\214\211\220*I=\032\003\323i\223\334\250\330\321V?\333T\375\202\336\006\030Qw\r\004\236\253\201\005'A\367#\027\360b$\230t\242\337\320V\206\b\035\354\334\355\364\007C1e"
+	.string	"\265\265A\363\027\246\225!\227e9^\254p\273\323\272L\2374\245\257\242\233(\256rS\311\350\267\335\227\207\353\352]\205\237\322\f\007?{\242\310\350^"
+	.ascii	"\265\324\024\340:g\213\t\341DB\212\274MT\004}*\024\001\267 \227"
+	.ascii	"$\224\312\235\323&S\036\372\007"
+	.text
+	.section	.gnu.lto_checkForThrottleErrorResetState.106.ff99915cc0d4390a,"e",@progbits
+	.string	"(\265/\375`\326\005u#"
+	.string	"JA\374\rD\200\236M:\223\351A\320\036G\031\005\225r\n\302\371\027U\004\031\205\312Dv\"-\240\304\351\303\266'U\200\b\206Z\361\221-\301@\243\"\034\022E\025\316\323\322\016\373\352\\ \202\023\240\241\326\244\021iR\246\024\310"
+	.string	"\271"
+	.string	"\321"
+	.ascii	"\276\375-\347\362.vi\030\337\342\233W\235\362\242\r\303./\352"
+	.ascii	"\261\\\3502\313\305\254\256E\006y\245Er93\023\201\274\250d\013"
+	.ascii	"\243AN1d\360\354,m\316\251\340\242\033\220\252\366\253\334\212"
+	.string	"\325\301jX\234S\b\232\2309\303\030\230\211\274X\364\243\361\242^7^\264\225\215\3660$\363\226\344K\226\260\317\234s\267Gn\3652\207#o\243h[\265\362o\022p\301\255\253\227K\271\233\004\":\272\216s\243\365\343\211\226\017%m\t\202\244\331q7Z]\266\2436E\352\\\370\245'Z\\z\353\3611\013\250\"\217\333r[<\276C[X6\2459\347\205W\034[?\325\233\2049\2475\270\245\343\016\272\355*\266U\330\342Wt\260\324\217\003\250\322<\211\321.\001\245\017\356^\370rH\227\220\2654\254\275\262\221\320\276\313mT\224t\201\302g\213\232\201\365\233\233\314\250[\005f\354k`\017(+\220O\207\276\315\271\323X`\277\007\003\303\005H\345\247C;\354\247\373e\3376\327\313\351aw\323\252\231V\275t-\267\201\203\375\005V\235T\252\t\224j$U\017 \325\002T}4\2446\022R\353r\352"
+	.string	"\245\032@\251.\nR\023\251zH\325BA\352 U\227\252\316\225j\034\251&s\352\033\251\036I\265\230S\333p\352U\265\222\352'\320\251\265\321 g\316\034\303?\323L$k\362\260_\313o:\252\315\001N\210\266hoB`\232\211\333\271@\326!Z\034\031\235\241u\020Em\215\353\246\340sV\355\216\024\265q\277\254\266\245\375\222.&\313\264I\213Ch\313E2\302G\214M\320\332^\3618\027\016 ys8\030^d\3100\3426hE!pM\271n\036\314\223\333r\017\f\362cs3\223\241r\231\313\306\213\271mJ\362t5\036\203\340\243y\232\r6\207\016\372`\207\361\"n\205\242\240M!\363\351\320&\222\273\264\252&+\220\357\214\013\262\314m\265Lm\3432\355\027\\\334qU\r0\320\317\037N\246\0069\347|\340\227\305"
+	.ascii	"A*a1^\024\027\007"
+	.string	"\346\373\230\223\261\360\2258\204\b}\360\242/b\377\346\214\313\247\303\353\234\363j\367\313\274q\367L\304\002N\361D\225\242\n\212\267k1\305\343ME%Qm :!%\345\342\303\211\026P<\336\024\205\250\336\220T\025\224\207\024TR=\024R\036f\364\204\034\365\024\325\333E\241\330\265P\001\305\333E\365\250vO:O\271\220\352\355\252\246\246z\2732\314w\333\327\353\203\0363\337\376\\z\f\201n\215\031\326^\345\230\224\300\332VV\254\256\350\203V\362\330\1777\272\314\246#\f\207hXs\372\020 -\201=\360\311O\207\036\260H{;\3004\001;`?\341j#\004,\221\332\23650\227\261\221\303\tn\277\354\264G\333\023K\223\264G{\341\025\b \243ujZ\243\275\227[\360\023F\016\320\317\231\004\203\230\221\373\345\277\302\250[\023bg6\205\343\2510Bw'\300\336\274\364\254q\001\330\2465E\213["
+	.string	"{`p\250Q4\344\fC\b9\"22Z\224f\fp\002\0311\263n\020`U3%\351\304\344p\320U\363\203n\024\352rl!l\265M)\356\330vs`J_!\336\363\345]\365L\016\362\242\210\005\272\002a\003/c\236,3\272\222N{\332\005\030L\3627i\325\235\317\005\317\277\036\341\021\024\227\350LJ\017\322\314I\037,\326\017\005=\345\bT\357"
+	.ascii	"Xy\223\177\232\020\273\035\"\256-\252\370\313\241\232\243M\246"
+	.ascii	"*\270g\327\257b>?0@\n\223~*P\001w*\224\275\033%\233\261\215\f"
+	.ascii	"\326\263~\237\214\322K\bI\242gD\205F\225@\322s\202$:k\376\376"
+	.ascii	"4v\231\022\202\344\324\216\364&\"!u-\235b#\360r\340\247^\277"
+	.ascii	"\003\265\213\232p\275\324\261\351~\2029b\344\t\313\224\265\027"
+	.ascii	"\237\325@y\004\206\255n+\374\001"
+	.text
+	.section	.gnu.lto_processRcInterpolation.107.ff99915cc0d4390a,"e",@progbits
+	.string	"(\265/\375`4\f\305="
+	.string	"Zi\020\027CP\236N\007\177I\230\361{\"\250\203\2051\337\007\300\270`,w\264|"
+	.ascii	"\264\022\3025\207\334@\306~[bX\032\006y\b\020\001h\030B\204/"
+	.ascii	"\027\034\265\334\255P5\253\252\252\252\326K\2156\331{'\231Ra"
+	.ascii	"\001G\001_\001\275\026s\177\233\3335\024\211)\303\341M\034\353"
+	.ascii	"\250\346\211\001Y\2755\267s\207s\247s6\257\371s\333\355\335>"
+	.ascii	"\245\375\256\221\355T\274J\r\267k\252\3735\346j\321\262V\030"
+	.ascii	"\307\361\225\353\254\323\352\3355\332\343\274\256\221\355r>W"
+	.ascii	"\303\351h\270q\0277L\313\363\200\353\254\217\017\265\316f\017"
+	.ascii	"j\235u8\330\215\331\212V\324\304\n\343\230n\312\331\006\340:"
+	.ascii	"\333\215@A\215\206\235\016M\307\361F\2360;;qL\267\374#E\275\372"
+	.ascii	"J\347\235|\330\225\222\220\216\214\212\210\206\204\226\202\200"
+	.ascii	"~|z\224\311\027y4\272\305\226]?\303\355Q\376\302<\311\276\\\t"
+	.ascii	"\316\223\340\244d\244\374\346GS7z\253K\222\213\326\234h\211\017"
+	.ascii	"-Q\222\205\234\271\346K+\322t\205\212\313A@j\376\243\226\226"
+	.ascii	"}\320\274g-\020\355\333\341f\306\320\326\2412D\334x\235\220\254"
+	.ascii	"\\_A7\037nf,\272&0\303\023\364;\0379Y\3042R\026\304\337\247\263"
+	.ascii	"2 \216\004\362#\037\213Xw>\265\306\344\254,\210\033\333\306\314"
+	.ascii	"\262\213\344\251m"
+	.string	"\f\232\213\255\2106l\021k}\033\023\346I\326\303W\033G2\260v\b\tU\315\371of,\312\352\024\307\261\327y\026#k\346\\\304\212\343\270\363\223\254\314\233\311\273\363\203\356\266\320}D\013m\315\\\355\365\331\177\277\260Df\177p\2761\353{\235O\005r\231\312y\361\306b\213j\234F\373\037\341\337\317\031m:\325\367h\264'i\020!B\264\316\376'\245x\207Pf\256\266sq\"6\300\257\214\350`\320,m}\251^\373\227&d\267\210\371\374\214\343\274\366.M\350f_j\235\205\262\305q,\345[\272\233\220\005\003\215\343/\2176a\347g,\026e\213\207\304R\357\236\020@\260\234\350J\254h\261\363/\355\021\255\277\t*l\300\362\235\356\026\341YF\270q\f\266\240\375\212c!\321\236\304\331.\221\225\375\351l{\326\263N\356\016\345\230\271\332M\327\314/\355\366LFG\0178\375E\2721P\270\212"
+	.ascii	"\301\355\274\255\226\016\347]\345t\336T\307\334\006\332\334S"
+	.ascii	"o\356\002on\25177\001d\356(d\356\001\310\334P\310\334\002\332"
+	.ascii	"\334\001\216\271\001\034s?)s;)s7\035s3\035s/%s+\275\271\223\220"
+	.ascii	"\271\221\212\271\217\212\271\215\216\271\213\222\271\211\336"
+	.ascii	"\334Cmn\2417w\320\233\033\350\315\375\363\346\366ys\367 s+\221"
+	.ascii	"\271\223\310\334o\233\033y\314}4\3466\032s\273\306\334E7w[\314"
+	.ascii	"\315\2669Eo\024\030\226(\225\207\276\033^\203\231\264\376$z'"
+	.ascii	"\260\377\352;\207C\357V\326\270\0220\rL\217\303\255\320\373\031"
+	.ascii	"\2255`\371\016\03578N(\312\311\337!T\371\322>\220\345\245\360"
+	.ascii	",\033\343\224[\275\330\352Mm\255>\023\2129\224\223\2234\340V"
+	.ascii	"O\341[("
+	.string	"_\325\031m\346j~\203^N\3475\251\211\023\203\335\362\214\003\364?\037\364I~N\276\343\003}\322\240\263\320\347{\376\347\213\210N\266f\341\233\031\360\324\347\035L\232\0363W\341\250\017v\236\033\307q\203\3666\356\006v\002C\201\247\323\326\331\236OR\373\016\365\356 _:\345\312\3676\003\236|\345{\030\324\352\337O\276;\023\233\271\332\310\177\337\303\022\231j|\r\fK\201\343\340\270\326Y\344\373\235CQ\373\f\217\307o\017tAx\016\206\004\t\3178\306?\376:',\321\375\342\033\337\235of\374\314\204\n\027.\264\316\272o\204R}\361\275\217\357MX\342\024\2238U#\215\226\352\035(q\363\336;\023\210\350\276\264}\216\223h{\365\356v\307Bx\037t\213\256\021\236\352\305\272\332\366\275\334\317\377\2722l\330\320:\333\376S\367\246x\212G\271\233C\207\354\317\253g\332\373\002\330\374\257v<\177\367\342"
+	.ascii	"\333\227\206q\366!\274;\003+\266\270\270\262Rh\025\267^dyH\341"
+	.ascii	"b"
+	.string	"\313\013\305\226\007\031^\311\025[\\\\Y)&\234\330z\221u\242\005\fekUiy-\265P,\271Td\261Xjy\271XV\005uW\213-\257\345\213\256.\257%\222\216\351_d\371\312\036T@\3467\225\336HF\203\347\030\2509\322\324\"\006\276\207j\350M\207\271\345,\251\316\3359L\344\216r\324{-\312A|\371bS\217\"\237M=kg8\205\316ArC2\211D\216r\016\037b\224\022\3321\264c\364\322V\300G\204\341\215>\226\372\237\254q\034\307E/u\270\255z\f\337\362\365\275!\372\321yMh\331\207\313\371Y)\360\320\316\033\200\226{H=\201/\360\355\2403\332\344\321yn\336!\365n\227\246\307l\222\3132\031\2017\332\245q<A7\263\241\250\001\037\005\365\002~@\325C\005x\001YG\200g\251i\246\3207\303\023l\023\362\026t3\353\262\364E\032\236k\001\274\027\225?\034"
+	.string	"\336\030(\030\364\364O\247\177\372j\325\265\332\246wzwF\231\276)0\2071\275\221\212f\nu&\0171y\200\226\250\262\215\f\246\364KI\257\364\356\374C\372\2447Bt\026\036=\322{Tk\364G\357\316\267\374e\364\036\270\006\372\343u\\\350\t(\301\343S\364Ux\356\n\r\321\023\341#i\260\232\032\321\007\200\367\250\201$\007\221C\210hD$I\222Bk\220\002\221\251\242\252\003\021 )d\220\021M\222v\003bh[\214Gt\246\255o\204\334M \177\314\006k(\261\034\252X\2136rpj\357\034\226\213\2125\224\021"
+	.string	"\231L\202 \257\340\375\371\001\303\266\007\265\215\026\245\215s\0062x\274>s\201\024'\230\b ?;EkB\333G\035\252\202\033\342\362|\345\205\224\t\310in\343\312\257 \210,\270\017\214\366\354"
+	.string	"\346v+(\305OZ\326\f\351\203\220XB\330@\366A\326\336E\352c\013Q#\236\201\207\036y\f\363\367\371\304\036\371/\333x\260\036wq\223"
+	.ascii	"p\262\006]o\236\036\377u_\301\276Y\033\0308\003\016\f\270\345"
+	.ascii	"h\2270\032Q\325$\313\252k\001\301xB\020\217EZ\370}Z\036\322&"
+	.ascii	"\230\333>\230\005\330j\235\371y>Ol\366v,K{F\035\322\221kM8@\273"
+	.ascii	"\006+A`\324\232VM\273\331\252\371x\0334\240@\3151\\g@\207\"E"
+	.ascii	"\2537\305o\002\214v]\254)\203\357\201\261\366\341\223\261\317"
+	.ascii	"\251\267(\303\255\374\346\220\373\237\337\202\240\234=\341$|"
+	.ascii	"\363\017!\005\345\270\361$\360\022\336\242k\207\\\204\235\322"
+	.ascii	"\272\275\n\031\213\004O\247\305\322E\311&\271ILS.\247F\224\267"
+	.ascii	"$\001D\300\325\224Y\361\006@\003\033\336\004\243\217p\310C(\242"
+	.ascii	"\tA\020`\345\376\363X\016\031%\303\256\232\365}\362GX{\322\240"
+	.ascii	"\370\333\031\0332\256\"\357\f\t-x\346\3515\031EH*\225\313kz\360"
+	.ascii	"\267\301YeV\027\321`K\205\362\375Q5\r\006\366\216c\033\330#s"
+	.ascii	"\225c>\002\247>)\326\243~\246\242M\243C\"\307T}\351\251\241\261"
+	.ascii	"w)\325\021-\333\3559t\rR\321\373\316\370\271\t\030\325\236{\335"
+	.ascii	"\275\335\233\205dT\236\032"
+	.text
+	.section	.gnu.lto_updateRcRefreshRate.108.ff99915cc0d4390a,"e",@progbits
+	.string	"(\265/\375`\350\002M\026"
+	.string	"&\252\222F\300\030Q:\001\3239\327\006]\253\367T\240w\262\324\313K\005G\237\320H\204\357\267\356\362o\277\262\375j\253!\270U\313\204\254\035\004\362\377\317\332u\025\005~\024\305\201\322ui\311\232\0221\374\227\037\033!\204\310\235R|"
+	.string	"t"
+	.string	"\203"
+	.string	"9nsXk\311\304\002l\354E\226\235]\021\016h\255\320\215\210\220\217\027Z\202vw\301=7\b}\332\277q\036\327{l\354\262\233\342\347\307.\215\201\017\204\356\311\\\300w\257{\314w\317.\033\312i-\366?P>\350\270\262\273\242\262\270\353^\247\323\345\203\020\\d\263\233{8\357:\204\263\330T"
+	.ascii	"3X'\263\273\267}\202\230\305\346\004!\354\256\247l6\342\376n"
+	.ascii	"\233\202m\033[\275\243y\237\333P!\231\215!5/\023i\002\"V\200"
+	.ascii	"bzc\323`Ss\354w\273\273V\02568\r\363M\277\200\323\244oz\364\236"
+	.ascii	"?\024\201\323 8\375\235v{\241\351\356\233Vpz~\323\217)0\"I\205"
+	.ascii	"\334n\210\334\226\005\362\202\350\234\366\327\356M\265\377#\003"
+	.ascii	"Gcwy\274\307\006\034\334\225\r\366u\374f\207\346p\037\2037\037"
+	.ascii	"\032\367l\016vxO\037\237zz\250\002{\262s\017\371<\005\365\267"
+	.ascii	"w6`\360\2501\3436%\324!.t\266\240\3409\361\2329o\2440\252\241"
+	.ascii	"\216\364=\204\250\20288,\326NsL\322\251WbC\362\332\247\336v\004"
+	.ascii	"2\235 \024<&^\224\244\003\250|\300\275f\316\327P_\364?\357d,"
+	.ascii	"\t\212Q\342\266\003\2339\373?\016\304\306\207a\r\344\274\214"
+	.ascii	"\374\356]\r81\361\232\271\317\335\275Q\267>\221\016\320\221b"
+	.ascii	"s\022\233Y\034>\225V'\226)U\300\247\022\231B\261\304\032U*\245"
+	.ascii	"\032\t\254f\310\013\021\310\224\251\244\021\255fH\226I\302iE"
+	.ascii	"\2264dIZ\315\220)\324\004V\rY\226\032F\222\307\322X\212#\215"
+	.ascii	"X\2032\245\304\261\\\211\245\030\2532\220\245\310R\251J1\244"
+	.ascii	"\275\256*\374%8\216t0:sp\364\250H=\005A\201\004\320Kanu\273)"
+	.ascii	"\036\274\366\007\325f\316\235\372En\304\202i\034eQ>\355\024\254"
+	.ascii	"\360\2011\331\201\003\233\200\0327 \220\002\231*\263\r-_\021"
+	.ascii	"\177\213\344\200\353>\314z\341\fX\311:d\255h\216\t\333\320\f"
+	.ascii	"\233v\032m,\210a\026K\232-\250\330\363\263\367\261\2155\336\314"
+	.ascii	"`\030j\222]ZF\346\030w\263U\270\266\313\267O\253 \354\366YcU"
+	.ascii	"\327\262\372\363\024\016h`jA\316a\002v\210\323\240\306z:<O(\264"
+	.ascii	"o\340\361a\227S\200;\247\003\215\034\303\233\342\252S\364\233"
+	.ascii	"\336\004S\006"
+	.text
+	.section	.gnu.lto_getCurrentRxRefreshRate.109.ff99915cc0d4390a,"e",@progbits
+	.string	"(\265/\375 \354\205\006"
+	.string	"b\214-3PO\222\016 \2336w\243\n\230\265D\200[\220"
+	.string	"*"
+	.string	",\033\256\350b\326n\255\241q\3639\016\250\317\314\314\212yc\205\3766\302k\033\3066b\311\226)O\234\251r\223\202s`@hpS\005\3418\233\251\207\204\312EPT\3454/\313D\310\b@l\342[\322g\335\217%:\330\253\355v\2446d"
+	.string	"\031 \034\375\373 \343\370b\222\211~\034\331\300\206\312\302J\246\305\350%S\032\n\310\357y\315\025\351\210g\013\237\307\205tRAa\342\222\371\\@\005\2446\354Fjc\035\265\212\326-I1!,-W\350S\314\034d\346x\2050:\353o\360\027\374\032\001\b"
+	.ascii	"2\003\316:#f\b\3055\3616\002g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_calcRcSmoothingCutoff.110.ff99915cc0d4390a,"e",@progbits
+	.string	"(\265/\375`\364"
+	.string	"\335\f"
+	.string	"\266\230YC"
+	.string	"\2216\035`\032\205`]'\337\226\025\2601\023d\001\206D\321q\027q\320c\362\210\317\215k\030z9\370]\320\204 \340g\032\315]\t\017IT:j\226\2179\342\360\216\241\370\236\307\217OM\310\2262\245F"
+	.string	"F"
+	.string	"A"
+	.string	"0\236}\202\261\304\367\026 TV\334\330]\214\300\005T\247\340?\252SJ\342\336\241\246\347w|\243\303\213\345\nAZ`\260"
+	.string	"\370R\240\201\232\0214nz\256|\244L\313\263\273\316\322\327\341\246n\233\201\355\006\366%\004?|Z\037\363\347\323\347\200\324\250\001\315\330\345p\223ci(\027(l{v\307\226\311p\217%\31101\263"
+	.string	"\201\002\357Q\303\343\200\017\021\346\305n\024q\202\347c|2gW\004\213\231\335\025q\201\353\224m_\305\003\366\240(\tVi\251j\252}r\241z\351\322\233\356\331\240#C\265\324\242T\325\251b\203\2227y\242\324B\243\372\342\220\247zHa\303\024#%q\330q\224\372b\037\256\272\330O_O[\217?u\231\334\326i\031\211H\364)\251\320m[\350\301\326\235d\001\016t&*\212\360\t\201 |B\031G\202\301\001\005\013\231\207\265\021\215\303\264\tX\t(\013a\032'\302F>\274\231|8\254\3336\016\353\304\275\272\370\246sB\234l2\344\326K\257+\032\023"
+	.ascii	"y\b8\323a6\0135\306^\203\320\334\213\370\242\216\343\246\027"
+	.ascii	"\226M\256\341\206\265\200I\023\n\250\003\367\366I!\250\320\n"
+	.ascii	"\24026\3254\rLA\001"
+	.text
+	.section	.gnu.lto_rcSmoothingSetFilterCutoffs.112.ff99915cc0d4390a,"e",@progbits
+	.string	"(\265/\375`\306\016=D"
+	.ascii	"\312s\200\031A@\242N\007\027\27427}\312\354\303\205\032r\231"
+	.ascii	"\017\213\372_{K\367\366\323\225W\031\374\377;p\027\353g'\256"
+	.ascii	"\370\211r\"\316\001\016,\330fs\306\232U\253\252\252\252\270H"
+	.ascii	"/i{\357\275\245L)\204\001g\001\215\001v\377\367"
+	.string	"\337\345?\314o\367w\1771\376\324?\257\302iO\270\317\017\016\030<\215\017\r\177\314\367\271\307.\343\3058\222\217ze\236\347X\206{\374\355~/\317\347\361\227\007#\177\230\031p\3323\311\t\345O\317<\317\013\340o\247\330\275\347\"\177\0274x&\0037\375\250z\346yO\371\255\017\200\277%\322\257\335_\313\353\311/\245\361\311y\246\373Cf\236\367\270\274\n\376\326\367\036\311\375\026~#\367[\227\335\361\374^\335\374\206\323&\230?\363</\367\022g\237\335{/\322\362C=951-)%!\035\031\025%\211\206\204\220\307\330X\204_\267e\267\226\375_\007E\247[\332C=\261Sl\002\233/\370\324c\245\350\346\254\177\367\324\242\235\364\276\211\325\322S\346\360\357\236YX$\036Q\234\317\207E3E\177\351\312+\261M\202\317+\354U\237\235N\212\242\221\240\350\243\350\023m\304\036\007\361\206\274\340\323\tk"
+	.ascii	"n:\b\247\213\224\364h\362I\242\241\2729-\364:@\276\016\220\364"
+	.ascii	"`\362\307\"\202O\":\216c\247\250\004\237r\332(\370dr\367\034"
+	.ascii	"\242\213\324\247\272{:\331\341\326\324\360\2535\371\227E\022"
+	.ascii	"|\276\261Zrm~4\265kt\013\362-\220g\331&\2716?\204\334l\260Wq"
+	.ascii	"\222\334\371)\233\336BnLvj\236\347\347{\335\346\266\246\365\353"
+	.ascii	"`\236g\327N\267\036\357Q\357\256\265\334\235\201;2C\373\233\211"
+	.ascii	"b\256\273_\3005\f\357F\314\335\217\310D\312\356v\267\203\232"
+	.ascii	"\211\032\236\r\273?\0041\214J\301\320\364A\2637\324\307\334\275"
+	.ascii	"Ex\241\303\246\001\271;\207O3\006\357\335\016\336\361\016\177"
+	.ascii	"\006\r\236\347\331\313\277Z\003\220\007\001\205\363<\377\023"
+	.ascii	"\032\356\267a{\017\022Z\245\324g\306\34512\317\336\340z]\303"
+	.ascii	"6\317jVz?\330\332\217y\267\246\257\376[\357g\352\3712\017\370"
+	.ascii	"\301\377\211\207 \323\357$s\277\375\0353\t\243oj\372\352\276"
+	.ascii	"\267\24674\220\035a\024\337t\356\260\366\r\260v\r\260\366\f\260"
+	.ascii	"v1\244\366\013\026*|\227\367\260\227\376C\3700\357\017\276`\355"
+	.ascii	"\nb\355\t`\355^\261v\004\260\366\003\257v\003\260\366\002H\355"
+	.ascii	"\004\214\332\007\304\332\227\260\366.X;\227Q\373\026R\273\022"
+	.ascii	"\326\256\365j\317z\265c\275\332\005\bi\017\200\324~u\324\016"
+	.ascii	"\300\325n\025k\257j\265S\035\265O\271\332\245b\355Q\255v(\243"
+	.ascii	"\366\247\243v'W{\223\253\235)\326\276t\324\256\344jOr\265#\305"
+	.ascii	"\332\217\214\332\215\212\332\213`\355IX;\021\254}\350\325.\364"
+	.ascii	"\177\357H\243\366c\254=\216\265\033a\355EX;l\324\376\026\265"
+	.ascii	"\273\260\366\366\325\316\276\332\267\253]\267\332\237CT\2338"
+	.ascii	")\362\3143\217\253\2409\260\005\f\373\361\360\240\332\357\027"
+	.ascii	"\2707\242-\r\265\245\366\024\023\331\t3\207\331\203)\324m\205"
+	.ascii	"\332i\246pj/\271\211\332R\372\006Z\324~C:R\315\204\332\357\231"
+	.ascii	"k\364m\350I\263=\355\270J\242\325\b\242P\323v\202\242g\263\007"
+	.ascii	"s\225\363\276M\242\031\247\275\304\324\264\264\231\002-\355\006"
+	.ascii	"LD$\226N\332JSd<\375NG3\342\377\307\f\254\316\231\343\021\345"
+	.ascii	"\2747S7\317\263\002\331\312\037\312\321o\247J\373\255:\203T\351"
+	.ascii	"\007\033i\273\313z\362\026\375\316\244=ec\247\371\321F\332\333"
+	.ascii	"\220\251\247\017\332\321\006c\036\0367\264\360\215\366\357Aa"
+	.ascii	"\264\343*\207Q)\\7?\347y\316Jb\203&0M\017\232\306\033\352\257"
+	.ascii	"\302-\332\257\304P\254h\027\007\375X\245?\035\304{3&\367#\331"
+	.ascii	"z\242\235\334\337|\373"
+	.string	"\332C\233h?3Qh\017\355o&\326y;c\017\302\364;\303\334o\205\366S\377*\210\237\350\333\206\233\016N)\242p\217{\363\221\360\204(\216\311?:\237e\215\323\002\303\312w\326U>r\267\371\373^\332\373 \036\034\2317l\307[\204\227:s\320\342mW\345\217\234\236\324eY1\n:\354\232\324\255\374\f\273\315\335\270\345\240\301J\357\344\223a\033\367\363\275\362\214\341\032!_b\373\244\333\r\357\342\366\237N\250\340\276Sl\273;\r\300]\237\031V\371\305\375\323OzYr\244\217\2347\027>\320\253\313\302\257\326\025wQ\372n8'~\303\b]\242\304\031\214\030a#R\234\025\311`\220E0[q\302\004\214\2633\025/\220^\326U\346bYVb\271\342\004\231\212e\231\213\027\313.#?cA\302\305\022\306\331\231\213e\274\247\366\233\016\204\233@\265\275\006\005\246\0254e\034l;\315\023l\005\273"
+	.string	" \302f\"^\240\364iC\335\302N\260khI\260_4U\253\024\320\f\227<\247\005\272\300>\260\275t\310<\246\230;\315\021l\257(\032\202\215\300\300>\260\337Ov\323V\f\354\177CGza\027\360\273>\t\227\300\276\260]7\337\250\310s\0046\030b5\212\305\006jm\032\260E\334\241\030\240G\307\244\244a\177_\222\3627\3546\367\345\226\262a/\271\226P\227\2646\327\356\332\376}\032\2129"
+	.string	"\253J]\373\3734\024\257z\325\241)\354\332\332\\\257\334[\200k\372\332D\236S\356\037D'kkmw\216\256\033\313\332-\232\324\241<A\207IX>\264\2221(\326~\371\376\242Qv\254w\2206T\315\013\330%d :\311\230F\"\337\311B\3402\367[\001\273(\325s\332H\231\f'\307\311q\356\267\001\366K\350g};\332P\227\347\334\253-B.\242\211\310s:\316\203\273|\204\306\325~\205\370\311I4\234T\235\005+\304\251\325hC\375\251\257\254\223\254\260\235}\221\373k\267y\325\375\332\217\347\377\331\242\377\332\025\366k1\2742\345\326\364U'\251\266\325\006"
+	.string	"\005b\366a~\310y\357\306G\025\300^2\254\332VnU\001\201\022\250Q(E\231dJDD$I\222\fsq\005\304\030\306 4\037\021"
+	.string	"\241TN\325\220$)p=\003\343\321:&\331M{\377\361\217f;v\016j\233\035\0058\373\321h\214^OE~\243N\r\031\005\300\002\342yRf2\302\333\024\374\214\230\331\334\310Xl\222CZG\032\262\326\213\212\220\354\002#\265\337:v\240\370\375\321\355;ck\027y\341\270\336l\312(\366\255PY\206^>\0211LDo\345\030\331\035c\227w_*A4\352\346F-\020\335\362t\\\326\236\372\325\033\037\352\211(\363\2742|\355\377\312\320\245\272\311\257\227\221\271y\276\003\3115\360\023\231\037\022&Mr\245\264\212@\260\245\037B\334[\203CT-I\340\024\t6\212D\307yAK'Pf\344+-\320\355\256B\362\317\207\017\250\030\357J\361\341\200\346\373Om:\036\031\261+8\001"
+	.ascii	"X\341\313\020\332'C\363\207\303\004\002\361\215\023\374\231Y"
+	.ascii	"\307\320\340\261\337\230\355\346\242r0j\211Q,|[1\324\021\033"
+	.ascii	"\025\243\017\352\342d\241d\347\036/Ca\367\203\240`\365\254\307"
+	.ascii	"F3wc0\312\252\177\302\373 \366\255\311R\311F\244i$\266\217\372"
+	.ascii	"\035Ml)\016\215$r\335\250\265\230\326\376\0266\231\212$\024\036"
+	.ascii	"\327)\024\225D"
+	.string	"\r\002j\202Z\305\034\320\367\256\214.\003J\241\250\343\263\362\033\b\240$\256xx\200W7.%\263&c\362\373\225i\354"
+	.string	"\300\327\264\227\251\346 P\223G\340\237\037\026:\351\022\216"
+	.ascii	"\2506\354\336t\332\242XBq0\372K\224x\022\315\345\250\307\374"
+	.ascii	"\366X\347P\003\332\005U\t\033\311\r\"E\310\235\251\353\302\324"
+	.ascii	"\212\030q\005\370\360\340vd\017y\243\346`\344\260C\245\262#\207"
+	.ascii	" \240\360\3761`rfc5\301.\2129^\004\003\234\261\363\3008\252U"
+	.ascii	"I\024BPG\b\325D\364\t\237\006k$\224\376\005h\204\250\337u\022"
+	.ascii	"\241\332\376Y\"\330\310f3\367\235\221\216\r\213\027\274\305\256"
+	.ascii	".'\217\315\350\324"
+	.text
+	.section	.gnu.lto_rcSmoothingResetAccumulation.113.ff99915cc0d4390a,"e",@progbits
+	.string	"(\265/\375`\326"
+	.string	"\235\n"
+	.string	"\346\222F> \345*\035`!\216\001<\315\250k\326\\\304\006q\371#\034\254F&tI\230\020t\210O@\3330N\206\334\316/\331\2610\304\r\b0\007\001\225\301\222\300\374\001 \006\025E\215\004\355\235R0"
+	.string	"3"
+	.string	"8"
+	.string	"\036\017\362\336q\376\361\336Y\264g>\312\366"
+	.string	"f\031&\344\356V\352q\361S\364/\362\216\353\305\372\334(\354\256\247\353\265q\323\333\016\331\256\366+\002\245=\262&\355\260\257\331\3355\215\331\267\375ss\00182\200\352\266\253Q\022X\\\347\002\342\261\375i\237\366\232x\333\352\004\273\261\001-\273#\202\r8\357\002'\317\006\257rJ\341\210\231\345\016n\243\216\342\227\223N\b\f\231\273\331\236!{\342%\276\025\310l\212\223Xpv7a\344B\005\222}\274\363W\336;\206\232\f\214F\266f\243\324h\001\302D\212H\201`\t5\340O\364\205\365{\250&\322\250T\277\020UE\037\203\022\016aM\201`X=\343^\2634\346\206\002\270\026\305\260Kg9\255\344`4Z\226\017\026"
+	.string	"2\241\267/0.\216V\227`\2736(\254\f\033Y\211\004\333\265Z\244\016\354"
+	.ascii	"|\267\252&\204\253.6c\354!=+\016\206\\\202mVS\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_rcSmoothingAccumulateSample.114.ff99915cc0d4390a,"e",@progbits
+	.string	"(\265/\375`\365\005}!"
+	.string	"6>\323J\260\324Q:\363@\357\027\246\202\024\340A*\345\ts\013\bN\215!\242\322\037?\251\351\213[MP\264{\237\375\363\3130\215\356\217\342\207^\327\204\265\376\037\030\016r\374\367\036\343s\b\321\207\222@\037\332\026y\241}B\210\334)\005\271"
+	.string	"\261"
+	.string	"\307"
+	.string	"5|\035\216\3718\236C\351UH\257\277\372zl\301#\253V\341\317M/\200\335\224\321\3338\261\303kxI\034a\324Zc\035\354\330\315\265\225\354\230\355\025~\206\322i\330X\312j\017\205\214\036\265\326\0026"
+	.string	"\273Y+)\265?u*\245\007\223rd\2657|\352Q\253\260\200y`7-<\355\274\t\273\315y\323\266\017 P\362\356B\251\247X\261\252\311\306V\255B\333\252\370\356\247Y.\335\371K?\367\312q\211\223*\250\0217\313\001@#\"d\240|%-\t\n) h)\342+\003\305T\326j\255\037\236:A\365(}\005\325ZM\177P!\356\327mk\260\035d\237\n\002F!\345\276\232\020\t\356\006\001\362\237\026\335\357\356}@&\332\345"
+	.string	"K\267\264\362ey\350>\\\324\221\262\211\336#\003\254\326\232\240\b!G\223Z\221t\336\374N\005]"
+	.ascii	"\251\202<\332e\013\231\350\246\260_\326\215\362Y\352\236\357"
+	.ascii	"\270y\226\272\266\324;\257\272uN\343\017\360\340\017\300\324"
+	.ascii	"8K}\263\3244\030\365\354\244\2669\251k\226\232\346\244\226\235"
+	.ascii	"\3243K-sR\307\234\3240K\0353\365\313\213\332e\251a/\352\327R"
+	.ascii	"\237Km.uyR\357IMO\352\377<yb\213\312\007\254Z\237\272\266T$\346"
+	.ascii	"\217\026\337\361W\335\252\306\223\325\336S\321\305\003+\223\331"
+	.ascii	"\231\025`\345\313\332Y\031\023\306\237\326\247\274\266;0\273"
+	.ascii	"\033\263\367\271\210-\314\346\\\371\262|6\326`+\351\344\247\325"
+	.ascii	"\325\325\263>k\332T\342,~@$\346\2460\335\00301\264\260\240\263"
+	.ascii	"\333x\336\254\323\315\232\233\023<\016\261z4KYn\nJk\255K\273"
+	.ascii	"Q\336\235/\013#c\030\245G\263\330\256p(;\330\213\177\222\263"
+	.ascii	"-$\321\377n\276ll\310\224\030.\333\204I\317\272\300\266g\357"
+	.ascii	"C\362,\354\366%Jx\366VX\202\257E\202\204U\333\327~\370\231U\023"
+	.ascii	"\027\357\334\332\336gEg\317\265%\233\270p\277Bz\322\310\221:"
+	.ascii	"{\035/_\fq\022#hn\021\033\211\020x\271\346\226F\037\220I\350"
+	.ascii	"C\0347\013\324H\202P"
+	.string	"\216(\202P\356\246k\340A\027s;\2721\030\332@\204\341\250\250(g\024c\034\020Ng\303]\260m \272\345l8\235\221\r\310\306E\034\204t\266\243\242\"\235-&\344\275\254\033\345\363\b\345F\261|\224\177x\007G\254\033E\363\337\2358\353d\033g\035\304[\246\323\306\235+\371\200\n\t\234B\"\235'\372\366,HXH\034\201\201\374\371\211\026\372\025\033\255\270\274\270\332B\362\212\266i\317\211\036z\225\023Mt\255\f4)\023OsP=\001Nm\321\326\226\360,\033a8\263\245\255y\325\3045\2436kO\240p\3767\333Zo\227\\\263\262\265\331\373\212\320l\315\232S\200^.\315\276~$\217>\340\314\306\004g\250A,\007\221a\204!\031\032\005I\222d8\240\"\221\263\321\003\021\300)\023\020\021\215\244(\205\354\006\303\240\330\216\212a\320\bT\004\347\345\371\225\333ys\252\2758\271\221\353\026x\200"
+	.string	"oG\0065(3\271\354\037z\275%\006\364\336\351\334\300\016Cm\030\216\277v\224[#\013\214&\310\305\355\205\213\33117\375@`L\307[\233\307\231If#\347\334;\301\016O\3207\211\262\035ER!\243\222c\220nN\023\3419\312\032\270\034E\265\017\200\035\351\f9\273\272\316Q\264\013\340\264\033m\351\037\360 ]*\2120\376\3442\244fb\300\n\277:\374\027\210R\254.\220e\377\271\177\213\312\bV\2664o\236\274i\021\315[V\213\202\252{\200=:)5"
+	.ascii	"k\332-\032\316\025~q\013e\274}\357\017"
+	.text
+	.section	.gnu.lto_rcSmoothingAutoCalculate.115.ff99915cc0d4390a,"e",@progbits
+	.string	"(\265/\375`X\001\325\r"
+	.string	"\246\231[C\020\221\223\0168\372\262@\003\357\242U`\251\340r]\250Gk\331\311pNp\200.\305\306i\033?^\201\277I\207\177\2707\242\b\317\006\231+\005"
+	.string	""
+	.string	"\260\202\254V\325\003\320\004\246C\275\360\023\262\367\2262\245J"
+	.string	"C"
+	.string	"N"
+	.string	"(\336\336\215D\034\321\013\n R\273\035\246\033\276=\302\247\271\371"
+	.string	"\270\317\343u\341pB>\016\307\362\b\354\356\206[I}\006ZRX\340p*o"
+	.string	"\215\206\232\307<C\034K\246\325\261\273N\020W\341\266n\273c\273\200\375\017\001/]\346\201O:t\211I\036t\350\233\304\303+\214iEKI&%Wv\367I}\261\377V]l\247-\247a\246\337K\253\2463\323\277\"\327\245dHX\355\212V5V\005<\301\3016\212\275\361\001\004\001FQ\202\031A}\351\3764\304\343#DD\310N:\211\207O7\036\342\250\023\237d\220N'\036\252Z,V40|\244\212Q\342\215\304\324\217\223\013\221\237F<\244*0\245\322\304\f\232\fj-^?N-VRe\233\344&\355\332\335\004\016\31682\017\226\205`\rD<H\260\314S\202q\b\260\346"
+	.string	"\304\203A\3204\017\266\351\366o\325\305\026\f\025j&\377-\346;\211?\346WM\207\020jF\375-\032Z\n5d\033\252;RT%\006H{\001\203<\310R\325O\035"
+	.string	"m\204\216\202\005"
+	.ascii	"\331e\235\326\024\032\004\007C\003\0311\243q2\201\205\006\363"
+	.ascii	"\263\3411&{@\n(\006\f\202\342.Aj\210\252\202o$l!\245Y\337\205"
+	.ascii	"<\3440\3100F\202\267\027\205\320G\030H\315\036\275\266@\001"
+	.text
+	.section	.gnu.lto_processRcSmoothingFilter.116.ff99915cc0d4390a,"e",@progbits
+	.string	"(\265/\375`Z\037\035\202"
+	.string	"J\314\204-L \320\332\031\003EE\261\233\205h\242\351`\bf\306DQ\213e\260\217c\332.\207e\3237\306\377\020\277dIc\024w\030c\245\005\222i\375;7\240"
+	.ascii	"\200\345\240hU4~\335\202\273"
+	.string	"\n\2062D\206\222\303V\021\231\220\220\235RJ\001\265\002\245\002\310\002\254\304\343\f\002\3079\311\307\031\t\307\371h\351\374A\351l\244t.R:\023\265\316C8\316\036p\234\205x\234\203x\2349\3648\003-\235\177\226\316>J\347\036\245\363\262uV\3568\363\3508\357\3608\353\264\3169\255s\273\343\214\243\343|\323:'[gd\2163\333:\037[gc\353\374\375\326\3548\316\335f\036\002\265\314\310\261\035yA\270\367\310\"\233\327\357\350\005J\357u\327u\337uk\351\226\353\236\353\033O:\322Y\357\267n\231\233\271\365\270\305p\273\307Ue\226\222wY\202\232\033\227\252$\030=\276\021\273{\353<\346\266\013s\013C\177\021\322]\270-c\247&\204\271\305\353\302G<\352\031\273\246\336\r1t;\341\201:\256\266\221473\303\035[\264p\365h\013\356\025\303\231:\375\336\022s$[\312\215\245\351\270\235\363"
+	.string	"\221mL\214~\241\247 \264\034S\373\035{\275\314\033\033\237\341\373\276&\222}<j \266\217\306\366a\373\310}\245\341\230[&\322R~\2619)goD\230\333>\"\231A\340\216r\333on\277\\o\007\210lN\303\367\205k\352#'%\373\310|B\005\b\354\n\025\301:<b\003\353\302\222\370\276pQ\337D\005\033\333\b\327\f\364n\257P\221\002\305\t\023%\242\240\236\234\232\230H\214X\022\021B\tD\022\322\321\007\243\"\242!\017\035\204\2028"
+	.string	"\375\370\364\260X*yvtrZ\234\233$\222=\032\337]n\244\326\032\231\246\030V\257P\023\355s\025\205\235\002\205\212*l'p\240\251`M\323&\006\215G\177a\204^\002\215\325\243\322\220q(/\354'\276v\342k\013\033\343M|b\234i\257I\354\205\361\021KH)\274N\272\301\220J\213\bA\255\332\271\022\265A\324q\361\244\274\272-\216T\005\243\305\217\220RK\306\262\364\207+m$\275\342EY\242N\364\346CwV\334\003\265\212w"
+	.ascii	"\323BT\240\036\004\3059\030s\002\335\312\372/\214\005#\n\262"
+	.ascii	"\272@\025\034\b)\305d\354I\377\254\265\317\332\226\025\274\247"
+	.ascii	"\263\2364\013\343\021uo\215/\235\264\322\310d\210G\003\320\021"
+	.ascii	"\026\232\177aj\316\263\203\224\352IB\373\352\362v]2\206B\353"
+	.ascii	"\230uN\377\205\2315\335\t\336&q\234\2632\277\371\013C\001\251"
+	.ascii	"-\214\314\223H$\026)\265d\314\331\307\0351\256V\254\210\033\215"
+	.ascii	"LgcH\330\021\3532\002\225AK\323\212m\371\267\20591\036\275\357"
+	.ascii	"\333\321v01-w\244\324\373\276\354M\261\261\346\026\315l|b\346"
+	.ascii	"\037\314CR\002\\m=\357\363Cv\\\206\313\3473\315U\266\347Y;\256"
+	.ascii	"(Z\313o\272N\376M\277\004\273\024Y72\2736\347slh\234\177zX+\t"
+	.ascii	"\257D\240\214\362|#q\026B\235\035\352\002\245\334\354\374\325"
+	.ascii	"\224\260\212\333$\t\335\371\016\234i\256R\235.\237\342~\271\013"
+	.ascii	":\337\321>*:\005\247\202t\212F\334\255\215\255F\024\361\354\r"
+	.ascii	"qq\261\335/\326\313Yp\277\236\254\231\320G\005\361\210\253\300"
+	.ascii	"U'j7S\370\022\021\251 \304\374\311T#8vG\3604\267\004\240>\242"
+	.ascii	"\301\265k\211Z\317\336\022sL\360\024\\%v\315C2?3\313\371\266"
+	.ascii	"\301\031\b\225&o>\211\333\304\250\314\303T\004j\363\020\t0\212"
+	.ascii	"\030\262M@B\206\365v\233\260\314n\022\037\301m\242\344c=\306"
+	.ascii	"\331\227\334\003[\341\350\262\355\367\0223?\342&\035\354\002"
+	.ascii	"\027\205\344\332\324\337H\335\313E\230rSp\321\\4\266\2178\337"
+	.ascii	"$8\371\256\316\245\224\023\364\214\337n\224M\376\307a\021\234"
+	.ascii	"\016\336<=\004\267\211w\261\205\311\277q\342E|+\371\354\230s"
+	.ascii	"\f\024\271\202g"
+	.string	"9\326\021\360I/*\"\277\r\235z,\224f\343\262\335`\327<<>\373\335\245\350\326\327\304\343\367\2363\357jl\241i\230\301\3107\245e84~K\235y\320\177f\027\332\206\356\232\343\f\315Cv\255t\241\033M\276\357\326\nn4\235\306\275B\200\f\031l\037\377\033\321Y\275J\233\232yF\017r\325\332\306aQ#\323\314\006t`\025\221\332\373\276+\270\3174`\r\356\265>\262\215\0337\330>\266lX\322\316\336\020\273\253\3302\r8\277PADAVg\375\177r\025\333/\301\224p\313m`n\276\356\253\342^c\rrx7s\260}\354\177196gQg\226/2\303i\371?\003\335\310\272\360\2471w\030;w\263\2654w\227\322\371\203\336k&\022\344\354A\3375\017\tr\276\262j\271f =\327\374\203\2033\217\256kV\240\353\232w\264\226f\035-\327\234\243\337\232q,\235o,\235\023"
+	.string	"r\266\261tF`\351\\\003\310\371\200\245\263\0019\3164p\234g(\235\013P:\313P:\307P:\023\320:K\3758\303P:\017\360\343\374\242\307\331\305\322Y"
+	.string	"\245s"
+	.string	"\2553"
+	.string	"\255s\013\034g\026?\316+~\234U(\235S\3748\243P:\237\370q6\301\343\\\242u\216\302q\206Z:?-\235\235\226\316MJg&\034g\022>\316#|\234\227p\234E\3708\207Pz`v\022\365@P\225\260y\372\033\254;\267\351\230o\372\247\177Q\345\332\323r\372\027\200\037|\323w^{\264\312eH\344?x\027X\270\022\231^\351\211<S\225+\212\326\214\327\342\352g1}\213i\033l\310"
+	.ascii	"\257\322\242\030XH\372'\211\357\303\177\027I|W\273)\356N\355"
+	.ascii	",\212\364O\02617\005\214\310\251\177\346\334\372>4\365\216\367"
+	.ascii	"\032\362#\306\264\031\361}F\326\007=\372'\273\021\322\332<X\001"
+	.ascii	"\232E<]\232\007\313c\351\257C\236\307/=\022\320\370\341\237\316"
+	.ascii	"\201\211\237\321\247\211\370\235\277)a\rUI\032D<\373F\246\007"
+	.ascii	"\225:\331\301\025\361`C|\377M\007\017]\006\036VL;;\266\217!\276"
+	.ascii	"\251\220\345]\235Y\034\246l\221H\321\332;\330+\027#\002a\234"
+	.ascii	"\ff\370x\026\027\023\235\275\203\365\340\257\276\271\316\264"
+	.ascii	"<\370\376\322ML\310\200x\245BW\343~Q\231xxl\037A|T\267\265\240"
+	.ascii	"8\224\364\335\006C\322\2735\260\352g\320\260\361\300\254\262"
+	.ascii	"H\357\177n\365AfU\217\031&\f\333G\244\207\341\244\241k[\035\376"
+	.ascii	"\331J\262hS\350\237\274\024B\017a\207\374\021\313\256\311\264"
+	.ascii	"O\001>&\031\357\346\220oj\003\371\005B\375\264\202\376yt\346"
+	.ascii	"\310X\205\314\356\312\341\237\334\022\376t\327\037U`\321\324"
+	.ascii	":\336K\307\267\232)\241\277\357\213\005\344\324:\276\273>h\352"
+	.ascii	"\024\344:\323\362E\377\371\360e\230Zd\365\333\200\t\370m\230"
+	.ascii	"\331\347}Lm\301>\306\371\230e\230i\206\t\b\310\366\361\303\267"
+	.ascii	"\0242:\250\227:\237\1776\265\321\367\022\247.z\243\357.\247\216"
+	.ascii	"'\372\242o.\305\241'\n\343{.S\2209\310\034d\3738\364\275\245"
+	.ascii	"\215^\310\346\256\316\256\013ts\366\374\223\233\305\247y\320"
+	.ascii	"c\242\311\361/V\227\266\374\347\237W\253\214\276H\235\212\211"
+	.ascii	"\2105\274\245\356\345F\362}\263\272\211\307\3145\314\030\274"
+	.ascii	"\233\334V3W\345!\030#J\241\3778\272"
+	.ascii	"5SB\241\347\346\363\273\252\0379\276J\303\231\23130k\360n\n\375"
+	.ascii	"\373\231\211\301O\353\261x\202\270lA\3625\017\203\222\202Z`\202"
+	.ascii	"]\212>du\202;\377\344%.3\260\034\253\017\232K\322\327\002\371"
+	.ascii	"\034\357\305\314\341\352Y\334/%5\272\346!\320sx$_\227b\f\317"
+	.ascii	"\361\314\3146\314E\266\233@\217\264\232\251\372m=\226\016\f\377"
+	.ascii	"\321r\213\260\335\264\3726S\262\365XJ\200\374\317\177\230\202"
+	.ascii	"\321q\265i9\222)\227\034\022z\347\217qs7dy\337w\347\307\003\371"
+	.ascii	"\326\314\327\032\2566\255FC\363\002\334\313\fcq\021q\353}\263"
+	.ascii	"@\370\374\217\377\302\035@\340\033\334\240\372\341c\201 @\250"
+	.ascii	"\256\256\204L\351P\005\351\021\204\007\025\006\031\374\350\261"
+	.ascii	"A\353\243\257\254\202L\365\2401\225C\001\005VA\204\310\240\342"
+	.ascii	"\300G\220\036\034\370\270\242\232@\211\001\025\020 =,\2201\001"
+	.ascii	"U\220\036\023d d\207\247\240\246\256\242\246(\210\002\342\243"
+	.ascii	"\307\217\250\251\253\r\242\240|\330*\003\252\253\250 VVWQ-\\"
+	.ascii	"V\177\0327\377(\353\265\214`\337\242\f\360\352\\\361Ov\333K\321"
+	.ascii	"a\317\306'\177\034NC\267\361eq"
+	.string	"|\207}\005hN\026\333R\33406\231Zd4r\344k\036\032\273\230\2324r\335\370\356+#\003\365\202\"\001\343\226Q\353\002G\340m<aB\361n&`|\031\350>\265E\346\224\236\301\252\310\264\322j\324\332\330\370!\300\033l@`\314U\t\231\0235\276\006\246\206P{\032\370\232\207\025\270\001\177\200\033\263\005\357f\215o1J\212\274\f\ft\325\332<dN\351B\350\307\300\264\322\200V\303\003\336\003_\023I\226/2mx5\205\006|\357\225\345A\275d\371\"\253I\252\275a\357\373\222p+\241\236\037\226\267\t4Q\001K\343\233\t\224\037t\331\2544\276\243\224U\241\322\0223\276\227\004V\001\316\370\016+\373r\225F\025\360W2\276\200\030O\300\313\300\3611\244\236\2007#\365\001\224}\201:\237\254.\220\r\212\311\311\303\232h\016\006\305&\017k\177/\356'\030e\374\006x\030\217,\354\343*\337"
+	.string	"\317J\313\354\256/\3040\243,\254{.\376\305#\013\005p\361G\315\327cj\362\363\004\370\226s\342\005\200\017\340\333m\341\277\2700"
+	.ascii	"\360\310\2612;\250\324\351\237\274\324.\333\342]M\227\026\357"
+	.ascii	"b\260\233X\274\004wU\311\267caXFw\2252\255\200z.[\024\370\025"
+	.ascii	"O\301TM\257KQ"
+	.string	"\305\273\360Y\350R\274\n,\\M\312\245x6\261L\356\212\342\351_\210;\361(\276C\265K\361\nW;\320*uK\350\276\350\211G\226\225\311A\245&\376\2550\243=\247\366\320\257\302\274\022\307\234N\331\022o\342\247\2240\272\245@es\026=\222Qs\222\370'3\231\233\322\267\344l<\332\361\235\346f\326E\025jj\005\336\213D\273l\324\367\2220\357\346ba\016F-\261Q\023\317\242#\376\271\204\307\206\027\005\n\336\023\274\265\025\360\234\340\2515\301{\342\245\241\341yui#\002\261\331\017?\005\2358\252\332\243P\225\342\317X$d\210y\177\302'1f\021\304\2739s\r\361O\250\367%SB\007\\\351;\357\235o\202\026&\027\357&T\247\315Y\361\273\032\026y\254/V\245\177J1\362$\214\360c\016\305\353\303\334\257#\017v\344E\340\252\3277\235I\213}\b`\330\035\341\273\236+\202\214\250\362"
+	.ascii	"-\222\262R9#2\"\222$I\2061R\013\020\004\"a\232\325\264\007\022"
+	.ascii	"@$1F\244\216!\204$)(I\322\001\202\256\336r\234n\033\rHj\340\350"
+	.ascii	"\243*\350\001^\345$Q2\343nxw\351t\327\341\363\3332\"A\355\335"
+	.ascii	"]>C\323\351V\343\317\326\313\251\"\353Il\3751!\221)/\340\314"
+	.ascii	"\240\202d\340<\346\301\017\024\032\257\356\353\362\304}v\355"
+	.ascii	"\210R\207\312\031X\032\217m\333)\210\220^\226\207U\351\242\267"
+	.ascii	"a0?\270\244b\316\013\213<VV\244*gd\265\220\bp\311\371\242\252"
+	.ascii	"Lc\006\362I\221g\022Z\2060\274\206j\\;\r\300|\240}\322r\260\202"
+	.ascii	"\3666\212\215\213o\367v\305=0\030\267\265X\243\363\3770\025:"
+	.ascii	"\363\217\251*'"
+	.string	"&\377$t\276\240\031\203{\331\016\fFw\241\223!\230\021(z\376\350\\/\r\201\260\234\n\371Fl7\013\353\300\366\351\316Y\nLa4D\343=\373\031&\303#\335z\242\245\373\207\350\254o\b\367\342\307\343\003P\306\364\212J\256/\223\037\237\205\005\022@\035\225;\277\026\265Z\217\002N\"\362R\306\232V\270E\fe/m\204\212E\2001\004\016\210d}rI\211\030?\241\327D\272\236@\240|\003X`\226\344~\235M\035I\347\001\266\bP$\311+\224\371\001\204R\243V8\237-\007\256\346\361s\215y\006\272.[>\355\210}Hu\364\251\246\003\374\262\231\365\007Z\005\211\315\340\274\277l\006\272\"M T\255~:\200v\211\323zA\2331W\001\376\347\367\373\367tm\"\345#\211\241\275\266\200Tf.+(\303\030\304\234!,\2331Z\305i!\230\366\213\315\2642w\330\032\243J[\327\375H\241"
+	.ascii	"\302\r\231^\216\302#\300\376]|\0308\244\273Z\300\204\230RL'\370"
+	.ascii	"\362\202\354\204\240\321\025W\355\354=\211(=\314\330\223\261"
+	.ascii	"\004\270\307f<\270\314;\035\344\027\234\333\n\257R\323"
+	.string	"\023\247\036t\252\220\230E\250\351\254\204\344.K?{\235\005 ?\336\307\f\031)\002X`/\332\204(\035\367\254W\3042\245j\362\235\314\177v\307]\256\b|\351M\257t9I\344\260\352\320\241D\241@b\353f\361\256v*\fJ\313\341\350C0;\200~4s#ar\037\212\375\261\246f`\032\332m\206\271\327\246\333\215\307\221\342{\313\267x\321\270\335\177\351\312%Hr\312\224N\031\271\322\034\032\221\342\304W*\324\3223\242u\345[\037\222\021\365B\251\250\3742\026\024\032b\225\213\t\255\036Hh\021h\362\332\352\327\320f\007r\301V\337$\220\002O\262 \326\333\261\275u\212\nQ\222\315\233[B\221\177j'o\030\305\037\362\264\363/A\260\tZ\013\033\346`P\311\007\t\367\177y4\341n\311\240v.R\224\250D\020@\371%\351J3\220\342\345#\037l \344\002\217B\2638\2047\246\307\344K\270"
+	.string	"\027\037\031tg'\216I\343\260\032\246@\315\372F\370\021\327?F\346\250\037Z\230;R\346\233`\3651\3014\327\265\030\026?\036b\324\331\207\333\343\bt\373uM\341\225\004\372\324\017)P\030\022c\363s\234$\312\323\020\365\234\377,\274\212\310"
+	.ascii	"\026\2644\370\314\320\"#U\301\265|8\376\036\363\263\335\261\372"
+	.ascii	"\021\247WA\305j-a\365\016D\213\177\233.G\016a\3739x%KIx\346\242"
+	.ascii	"\357ckIi\377\322m\231\223z\323\022\034\353\253 \211\032!\365"
+	.ascii	"\306\356a\277\373\363\177p\217\220TyDy\212\322`P\2517~\016U\374"
+	.ascii	"\306\321\220uO78G\327k\003\215\244\355\372\274\206\212(68\f\232"
+	.ascii	" &\211\251\033Nl\274\"\365\034\252.\006\277\337q\270\316\217"
+	.ascii	"\242a\226D\233\314\315\224dC\363q\313)Z\003\031\2101c?\351]\235"
+	.ascii	"\212Q\316\367QEF\034\317\364C\002pJ\030\2563\310\365\234D\025"
+	.ascii	"/\272b\356\323\364z\311.\354\206u\na0\347\362\335\330\034\351"
+	.ascii	"\216a\005\016\256\373"
+	.string	"\017\370\264\t\353\375sy\324\272\233\033\250f\234j@h\362048\254^\361\272\314z\f4\356\320\304vE\213$\364\027\333W\336\006v\244\036Y'\361$\254m\273\324\200\225\326\240/XM\267\204\037e\220\024VIU\354=\t\311\262]o\030@\224+\225L]\331\325M\317Hn\312\301d\b'"
+	.ascii	"\344U1\327\204\362\255)!\275u\305\223\b`\225h\311\313\315\316"
+	.ascii	"\243`\305J3\033\t\\\250\267cd\212\265+\374s\350v\270cu4\254["
+	.ascii	"\003D\006\277`\235\255\035\252U6.\370]\251p\225C\277+\201\347"
+	.ascii	">\262\b(\2731\364:\004"
+	.text
+	.section	.gnu.lto_processRcCommand.117.ff99915cc0d4390a,"e",@progbits
+	.string	"(\265/\375`7\013]<"
+	.string	"ZeD\026>@\246\326\030#5\276\206\035%\207\016\227\362\315\220F\033\221(\n\246G\037\310\324\345\242\r\177F@\f\264\b\037|\321\007!\272\2076\372\3316\2400\247!\242F\013\371m\355n\"\245L)\245Z\0014\001]\001E:\266k{+\244%$\263\303\363\354y\003l\320a\270\345\270\330l\213\3518\267\3070^\277fo\007Y{#\324\367\276/\003a\263T\235l\233]\033\3316\373]\345\"g=p\033\256G\277\3167\207\337\033\235\276\367\215\263j\226\007\b\233e\227\231\257\343\326^\2517\273\2612\214\336\367\305z)J\376^\343\232\221\336\355)\251(\250\247\245\2232\331\204<2-)\031\223\220\212\304\241\020@\260e\327w\227{"
+	.string	"\232\237\246\0374QfOU[*\013\024\316\243\252`\034\252\367\240\325/\376D\355e\357A\251f\274\270\223\0255U\\\031\305\314\255\223jz\355\342\206\345\211\231[7\2655\262\215\212\037\315T\231V\252)+U\026(\233/EX\202E)xA\203\0325\016\356\357\211\331Z\033\327d\036\265A\235\005\232\266V\245\3311\302\002\366\240L<i]Z u\244(fJ\272(\200\030\274\360\304\f\255\207+\003\273&\200\275\007=[\215W\362\232]\227\304\205\035\246\244\001\310\265\200=\350\022\001Y\240a<\210\244\333b\324\351\354Z\325\347F\2211:\266&\313\334\236?|5\322o\214\212\255T\357\373v\265\235,\332t\017^x\337\227\375\0315k\016\320\314n\202\231C0\017\337\376\276/S\370Sn"
+	.ascii	"\017%x'\370P\212\222\004\237\274}f\020\"\274\237L%\366Lf\277"
+	.ascii	"\375\036{\024F\247\353\214 Q\242D\333,\373Yg~T\351\021M#\270"
+	.ascii	"v\375\346\202tf\023(\274\237\353\323h\322|fKXk\324\307\376\264"
+	.ascii	"M\367?3N\340\372\323\217\323\317C\335*Z\377"
+	.string	"\377v\2465\373\256\337\250\330\342\342j\233\365?q\306Ge<6<*\377S\326\321\366\257\230\013$\346\215\230\233M\333\351\340n\343\026/\274\237\315r\277h\233\355\377h\234AiUi\230\0072\3075\375\247\314\335lxlq\370\2410W(:Ch\235\0378\310Z\320d\232\257\254\252X\347\003E\347\250N\323\f\325t\315O=\246y\331p\315N\254\263\362\235\223C\347&\24232\350|\034:3\265\316K\255\263\322;\033\207\316IAg$\241s1\350L\f:\017\203\316\302w\016\266\316-\353\314\276\363\272:\377\352\354\357\334\026\276\224\224\021\211v\225\272\367-\013t\364\352\261wV:M7\231n\272\3561\335p\255\206\213i\272\270y\020\236a.rq\216\273L\327q\375\276\357{\354\321:=\353\346\216\032\023\":%\007?\3454\364\310\230\365NOf\f4~\026\032\034\252tI\315\001\265\311\213\340"
+	.string	"\337[\237\233DzJ?ufW\212;\305\373\231\365\337\206\217\211^\363\231\302\265\027\372\276/\002/%zL\007\244\320\334\222\310\330Sm\322+\2514\243.\341\373\212A\340V\324\213\334*V\\,X\332f\223\276\253\275\342A\243\243\206\t\363\300\244\237r\261Nq\301\263l"
+	.ascii	"\254z\371d\tz\211 *\247K\343\261\341\265!\375\224\333<.\304\252"
+	.ascii	"Ns\346\245\r\255\376\351\311\230\257z\371\013\276\345\272\204"
+	.ascii	"\232[!gZ\323\217\355\246\020i\341q\026\370'E2\304vRk}\356[\206"
+	.ascii	"\347\363<D\300\257\376\351\227\317\305Gz*\3473\231\233P\363}"
+	.ascii	"Q]0.\230\266\331\342\3638\013\244J\237\376\352\215jV\n9\031\205"
+	.ascii	"y\240\027\211/\374*AU\"\340\037]\265\351G\034\276\360\255\376"
+	.ascii	"\3718\353\374i@l\347\212a6\314\246mv\370\315\345\314\321\237"
+	.ascii	"t\202\234#!\303\237\2627\343\265\313g\231r\364\314\001\022>\037"
+	.ascii	"\266\223\372\243\247\367ha\310\220\201\320\207\316\303v\302\367"
+	.ascii	"}%p\347\265\336\006\356\266f\231C\207\016m\263\302\357\272f\257"
+	.ascii	"\234-\242\336\0055\272rl\255\304\032+\264\\\260\360\332\222!"
+	.ascii	"\343\013\003\027XRW\307h\341\345\265\005\003\003\213\0266\266"
+	.ascii	"X\314\270ad.\005\\`X\\.\260\274\272\266d`q\201\325\300R\200\344"
+	.ascii	"\257\031-\300\260l|}\201a\025\343\302\372\241h\370\323\373\353"
+	.ascii	"\013\373&7\033?\273C\353\303\310oJ\313\231}\004\272\314?\205"
+	.ascii	"\212\264\216\206(\2222\320\036\350!Q\342\332@\253\374\003\317"
+	.ascii	">&m\372\221\021\315\022\312o?S\244Q\311\367Cs\201,\270\262\335"
+	.ascii	"\261\226\331\r\342\222y?\223\337b\232\210=\263\241\272\332\246"
+	.ascii	"\007\233\0134\304\241^\326\364)\320\366P\303\364\023R\201\017"
+	.ascii	"q\313,\374q2\027\342F\213\270G\216\264\307G\376r\215\023\317"
+	.ascii	"\225\007\321\343@\264\220d8~\303\231rg%W7g\031\354\036-\323\343"
+	.ascii	"p1\377\321#\211\213\206\3266\313\264\366\241\341\371\223:\375"
+	.ascii	"\224\225\002%+<\313\326d\325PO\006\365K\217!/\352\227~\005\\"
+	.ascii	"\225?e\250\257\360\001\346\276,r\2461p\250gv\231\270N\274\237"
+	.ascii	"\334j\232\351\017_\"="
+	.string	"\261g\376'\177\312~\364\356j\035\t\341\243\236\214\327\246\007\017\341\333L\037\001\307\036\365i\245\177\360\355\364sz\245\3573\355nw:\356}_\344O\271\315t\001Cw\244\004\200\360\250q4D\021CfdDDD\222$I\007p\002\221)\253\252\003\021p\261df\323\f\233\001@|5\277~\246\241\312\323B(,h_\330\byb\237\311\017\212trM\304\370\rG\037E\233?IO\241EA\255j\3503en\t\230\004+\346\364_-\362\244\022\035\366\t\343s'\267\205\3710\3063@\277\017\243\017\321\201C\337l\334[\254M\022`\351\206\264\202\341X\023\261\227\030\3134\0308]w~bZ\226\356\t\346\225\261\307;{\270\n\345x\304\244\332\250\272\2456\355^\203\"\260\365F\fE\"\3363\262\333\213xR\310\245\217\033\301\025\021\210\236@\002C\260&?y\231f\222\243\254\352\037>\263\242\220\030"
+	.ascii	"\002v\356(\215\243\037N\016\370\316+\002\036\001D\246\037Z\352"
+	.ascii	"\360\253H\327\221\347A\347\251\274\006\361}\315~\317'Z\024\230"
+	.ascii	"\b \364\237\324\3310Y\340\204\033D\357\016H\244wr\273\005\333"
+	.ascii	"\320\370s\016\340\034o|\244X\206T\306\300\005\306\240\206\033"
+	.ascii	"E\317\2213\026\210\345\265\217B\210\216\256-}\302B\300;]z\256"
+	.ascii	"\343\351\305\250C\rH\t\203\226\0232v\353\314\261\312\030*\201"
+	.ascii	"\034\027\231\243\007\236>\2749|8\367\367>;@\rKT%6\330sak\206"
+	.ascii	"]\026\356#\255\037?\207\323\032#=\355%s\b\233\245\216\312\261"
+	.ascii	"\336\262w\215\364bp\265y\200SfJGS\267\024s\202\311\220\007F4"
+	.ascii	"&V\036\217\355\350k\016\264\362p\n4Z\346\013\367\331(<\bA\352"
+	.ascii	"\200\252#\251\227\365\314J\2075\007\021\300E\030\336\366\375"
+	.ascii	"\007\233\276\n\nfe\306V%X\274\t\002\230\212\321Ri\253\372F\374"
+	.ascii	">32{~ \334\260D\0225\025\t1TGnt}\216K9\222\320\025\t\361\375"
+	.ascii	"\302cgY\335>;\205\253\210b~lI\240\002"
+	.text
+	.section	.gnu.lto_updateRcCommands.118.ff99915cc0d4390a,"e",@progbits
+	.string	"(\265/\375`\025\034\355x"
+	.ascii	"\212\306\034+J \022\323\031\016\247\221#\0340\271y\037\2337c"
+	.ascii	"\200\270_\370%>^\352[W\001\232\b5\304/rC\274\037\244\2664s\t"
+	.ascii	"\272\370\351\235\315\357;\277y5#\322\273\333D\334\256\341\364"
+	.ascii	"\252\303\320\343\302^\202\360R\023\"e\222\001\220\002j\002\250"
+	.ascii	"\002G\336\252\"^*\"\336)\"^\251\2247\212\2107\006\021/\214\224"
+	.ascii	"\367E\312\353b\310\333\"\345eA\344\205\"\362\256Hy\237\206\274"
+	.ascii	"NG^\025F\336\024F\336&#/\212\224\227\351\310\273\224\362*\025"
+	.ascii	"yO\030y\223R^\023E^\244\021\274%R\336#\"/\211\224\327h\310[d"
+	.ascii	"\344%2\362\036S\336\021E^c\312[Ly\211)\357P\312\233\246\274\303"
+	.ascii	"\"\2570\345\r\022y\201C\274\235\362\362\220\367/\323\224fy\007"
+	.ascii	"\215\0308\255\247M\235\022-\244\002\021\244\363\3624\027\362"
+	.ascii	"\341\374n\376\272\237"
+	.string	"\356\237\373\327\374\317\277\355\304\335o1N\336\033\240\032\247\002\315\344\330\260\215i\263\305:\023\202P[\223G\243\207\275\017[\244\333:'\256\"\225k\006>6\004\244lv\213s{\350\026\241\234\211\361\333\237\331\313m\361\3015[w5L\375\023>1\204\362d\244;\\\315nqO\370\231\355?x\330N\330\375\333\323\354\341\266\210&\231\302\317\354\360\013\236Bel\252\252\026\037\334Ma\217f\213)\334m\205\fj\210\223J\037\034\276\314\315l\261\215\tP\215{@\214\035\232\213\364\301\263\235L\362O&N\\m*\330\320L\r\0336\251\007wE\372\240\323\221\204\017\002\177$|p\223\273D\274\215\006\025\205\2307]o|\252\252Z\365\f\333\007\266}\2218y\252)\251\250\0300^\270h\301\002j\305\223\223\212\024M(\230\226\224N$\231@*qD\302\250\210\3508\302X$\016\245Ca\020\330\234\334\017m"
+	.string	"\315\336\350a\20259\225\335\247\354\346\260\224\235\034\216\2121\264\261\247\326\367GKX\234\303x\303/\340@\331\005\320I\316\237\356\276\354\346\270\005\013\2505<\360\n\271?\311\245}\355\300Nj\342X\205\\\031N!\367\344&2G\001\214\312\353A\320\357\276\310"
+	.string	"\221\246\334\300dc\246\245\265+\001\243\312\346T\371\335\227\032\020\311\216\331\020W\263\306'tx\322\0303^\330\004\260\350\006\240\f9\027\030I\2060\033^\242\313\217\272pa\022F[^D\303\026&\312\362c\2262\036Q\303\215\315\027\357\276\232@\247\264\2571&\002\217hu\226\277\373\"\003\002"
+	.ascii	"\205\301\357\320?\245}\275\300C\351\323phCK\230\330\205]+\007"
+	.ascii	"\257\264\341@\"X\225\367\021\314\t\320IU\325\2339{\201-\231\207"
+	.ascii	"6TU]f\202\205}\253\276\333V\273KdW)\205$\372()\346\177I\265T"
+	.ascii	"U\271f\354\013\335/\251C\222L\262L\262\214\360A\022\rt\303\347"
+	.ascii	"Y\324F\310\263\023\352+\352\373p\013\304\306\376\372\350ZU\325"
+	.ascii	"&C\355\\\241_\233!\223FZ\375\236Bd#i\257]\242\036\004|c\352)"
+	.ascii	"9j&\304\231\266\032\321\350\336\261\211\372k\032\222>\366\321"
+	.ascii	"\235gt\315Sr4\035\321\327;\023c\217\350\357\031\373m\306\004"
+	.ascii	"\r\213\275A \233\211=\324\305\216Q\267\256\021\261\371\326\t"
+	.ascii	"\211\035U\267\242\245=\354\241V\222[\323\226\034M\233\toE[rt"
+	.ascii	"\205=\354\256c\340y\016\b\373\204\306\002\365=\205\355\\\"\350"
+	.ascii	"{\b\3377s(3u\270\270\331q1\241`;\227[\352\227\373\247\254\321"
+	.ascii	"\033R\251\317h\257=\260\235\320/s\251\252\022j/\304\207X(\004"
+	.ascii	";\307g\356\334\327\330\336\030\276mSU\265\333\271\301\346\376"
+	.ascii	"\300m\016\027\023Z`\007o\234\017\216\031\373=(\344H\273`\365"
+	.ascii	"\320\363x\236\007K\007\017\036\302\007\273g\360\021k\356w\375"
+	.ascii	"\355V\375N\217TUU\032{;\277\363\261\357\362\340b\360\343\207"
+	.ascii	"\360\301w\377\241\303WF\206\356\277\022\356\355N\347j\337e\201"
+	.ascii	"\004\3413\203\b\037\f\202\321\331S\306\266\247\344\350n\333\222"
+	.ascii	"\333\271\373\253}\266\3735\337?\331\326\324\306\2049\230\034"
+	.ascii	"pH\373r\272\357\321\214x\357<{\335\367fO\363}\031\331\335|\337"
+	.ascii	"\304r8\337_\t\223\022\205\t\345O\272V')\357\271\224D\336\253"
+	.ascii	"H&)\257\222\224w\353\317o\t\177~\265>\367\315\372\3347\311\327"
+	.ascii	"|\261\336\366Eb\344%\201\310;\202\221\367\210\221\327\210\221"
+	.ascii	"W\204\2247\004#o\021#/\b)\357\025\221\227\210\221\327"
+	.string	"\203\224wH\312\333\301\220WH\312\313\301\2207\210\021\357\006)/\020\"\257\006)\357\217!o\006F^\f\214\274\027\030y}\244\274\026\244\274=\206\274\025\244\274<\206\274;\214xu\244\274\024\020ys\244\274\023\fyq\030y%0\362\3368\362F`\344\205 \345} \345u`\310\333@\312\313\300\220\327\206\021o\215\224w\001\"\257\002)o\002C^\004\214\274\007\030y\r8\362\322(\362\026\3605\337\031G^\002\216\274\003\030y\005Hy\003Hy\001(\362\312(\342\265\n\177\207\322g\353\024o\353\3322\354Pz\370\266\246-\235p\365R\240\025\315I7\275u\375\255w\034\006\314\273\372r|\246.\245\227\344\326\262\263.\241\037\326\301\272\265,\331<k!Y\337\231f\227\311\031N\353\221\242\361\227\244\223\256$\024(d=<S\327G\247\344h\t\375\262>\334[\244\375\340\246'\315\332\222\243M\355\324{"
+	.string	"\375(}\274uM\253\001\350"
+	.ascii	"\232\355\3264\031\r\200\027\337\220\364\002\203\214\246\262j"
+	.ascii	"\336\243\327\007\304\262\233\240\300\262.\375I\037\341\254\320"
+	.ascii	"I:\263\265\332\253\252?\210\302\\\222f5$\317\222S\206\b\037\254"
+	.ascii	"j\025[\236\005\360n\222J\322\n\237I\365\026\340\260\240\365\345"
+	.ascii	"-\231\332\271@dPR2\004\003\034\365\216\237\023S\375'}<\251\216"
+	.ascii	"\321S=\304[\327\242Z\252\377\347Q}\002oE\203!\204\3211Z\030h"
+	.ascii	"M{\3210X\364\261\364\213.\324\234\263\324\223\006m\271\344\242"
+	.ascii	"\225D\225\315\251\242\324\316u\241\346,f\245\220X\021w\350\264"
+	.ascii	"h\02728[\264\n>tP\315\242\357\207\205\315X\013T?N\323M\337\363"
+	.ascii	"\004\nb!\364\2317\314\324\370Y\313\206{\256:\204\026\n\372\363"
+	.ascii	"\247\276\352\345u\317\251\237\372~\\\306dN\215l\266Q\243K\232"
+	.ascii	"r\025\375\201[\037\001\330I}rL\270\233$Kf\3413U\030\305\351\271"
+	.ascii	"\001\202\253\233\254\211v\356\345\036\243O\211?{\201\300\031"
+	.ascii	"\215\325^T\202\376\003\221\246\216\325\177\366\345\356\303\255"
+	.ascii	"\214\233\265l\311Q.\221\302\005\261\306k\352\024\335~\253\036"
+	.ascii	"_Yhj\245\t\252F\367\243v\266\231 \006\221(\252\372P\034\242\251"
+	.ascii	"o\241`0\246\022\306\337:\246F\321\215\267\346muV35\211;;\324"
+	.ascii	"\001\032\265\223\213\372l\207T\256\214\370;\036Lg\265\327\257"
+	.ascii	"\204K\315ab`)I\263(K\375\275\246\\\037\221\022\230\250T\030\031"
+	.ascii	"\224\243\322\211Vr\262\027\363D?\255\t\247\366ls\266\0266\242"
+	.ascii	"\235;\004\223\201(u\023p`R\212_\353$I\315O\026\232D\003\257\334"
+	.ascii	"\225\234aK\222K\222\013S/I'5\221Y\234\2365\317hb\255\213fqp+"
+	.ascii	"\332\362U\360\356\006\025\237\326&\372Z\334\346 \265\t\033\230"
+	.ascii	"+\351\205\225\274L~\301!\t\006\214\360A\244~\332X\264\357\311"
+	.ascii	"[\344\274\371!\266"
+	.string	"s\371E\204%z\313\255\017V\227\350C\277\303\255\314\240\256\277\336\373\227~Z\237\315y\216\335\272\267D\353\177i\035x+\337Q\033\365\321\272\306\333\212\026k\244J\211\221%D\260\254\222daae]-m\025AB\344\312G\021$K\226dm\031YrDa\b+9\202\002\021`"
+	.ascii	"ZXK\200ZY[Z@-\254%\275WUW[VW!X%9B\004\313\352jK\211U\325"
+	.string	"\321fi\025\331\262Z\222\225\265eUlS\276\317\236\br\001\be/\251Hh\263\205&i\301\003C\026\022\372a\310\320\364=\247\306<\233|\204\376\030\251\025\251\236\372\021zE\223\215\320\177\222\241Q\023;B\325c/\324\325\265\030\226#\321\276\247\221^+\013E\242\241\253t\330BS0#Q\265'\020\376\234\236\202\224\223\252\252\362L)\213\204\"{\3403\367q\200\212\210\202b.\264\251\241\250\320\364\343\343Sr4\206\b>t\327B\233zm\256^\212\320Gk\026*RU\025\206\332\243\344)R\325\376B\357WB\231\321s\307\215O+\213\324q\364\217\212\013\025Q\244/\326\034\324G\007\202\033\356\343A\314\207\204\243\004)G\216\034SO9\305\201\366@\350\313yP\2549H\215N\351\342\205\360jz\347\326\247\355/\204D\372j/w\211-\331\017\347\341\260C\326\251#|\220\b7\003\301\021S\266\360"
+	.string	"o\210!\355A\007\r\244\207\b\351\0168\350_\021\022\2449\330\240\2030\017\337@\203\006\302g\217\006~~\\\311\240\177`\320\031\\\320\030\004q\347\002>\236b'\016\021,|\324\241cA\373\350\321\024\264\005\025t\017\036\375f\005;\232\207\216\3361\334s!B\0359\232\2028pr\340M\320\304\321\023H\3208n\264\004u?\334h\";y\366\324\371\336\216\351\256\220v\202\2749\360\2579\004\337^\320L\b7\250\b\370\314# \021\007\350\313\n\b\240\013m\232{\240!h \336\232\347@/\320\017\364Pn-k\240\035\330\301\f\364\315\360 \365\360\231\r\330h\006zhW\243m\020\261\271\020a\215f\252[\321\024\350\005\372bX\315\016\n\364\351\232y\372\2369\230\263<\201\336E\n\201\3043k''\335d\021\350\004\016h\004\350(9J\250\204\001}"
+	.ascii	"\332\362m\241)\032\003\372m\036,\324\314\243F\327\317\265\210"
+	.ascii	"'\032}-n}$`\244#\377\bw\221\200\220\201\370L\032\315q\200\260"
+	.ascii	"\020\341\3348qJz\021\026\320[n|\270\230\320 .C\206\237\310>d"
+	.ascii	"\021H?\244\237\360\301\002\232\205&\036\025\0044\257\331h\222"
+	.ascii	"\\\362\231\004t\220\r *O\321\316\225\002\207e\016\305\243\364"
+	.ascii	"\002\231\264\272\204\366\032\200\307>@?\016\020\025\001Zm\241"
+	.ascii	"Dc\216C\013\240\327\254\343\246'M\036\016ar\350\257eK\266~\230"
+	.ascii	"\006\332u\005\202E\250\302 !T\202\0201\245FFD\223\244\220\326"
+	.ascii	"\362\n\020\n\343i\034S\352\001\022\3404-\b"
+	.string	"\243\020\252!QI\n\303f\006\347*]\001:\200\022nK@\021\340\265\033\300I\022P\351\353\252-\016\313\357\177\274\213y\017\203\233\360\003\021\022\373\276vc\033\361\013\214pt\226\235!\252r\026g\347S\032\307\365!jcZw\\6\324c3\350\2456\0321\035&\316\034&6\353Q~\263\n\253\267\245vs\366e\364`\">K\351t\202\037\223\333d\303\220H\215\240\212\254\245MH+=\211\023\r\300\037G\222\367\227^\370\312\363\266K\0344\fw\\\255%Cl\340\353)c\222\372L\274[\253\315\246\352\311\025[!\030m\360\bm>\343\312\250-\245P\340hX4sl\256A\032\035M\360?6\243tNV\223\177p\270(K/\243<\370\310\335t=\035\213^\007\330\304\216\357\225\240,V\017\311\310\227Km[W\335\326ju9\276Uz\031\373L\f\264\b\240[\3157\030\203\bH\263\250j\235"
+	.ascii	"\366\270\270\270\327\266\002\r6\255h+\033\203=q\226/\200\330"
+	.ascii	"\374\253\347-\201`\362\005\006\031\365JXc\207\b+w~\332\315\""
+	.ascii	".\003\n\361\274\356\261\350\336I(\346$\372\024\355\230\313\\"
+	.ascii	"\022\376\r\031\237f\261\025\246\f\350\265\317h$\017m\030E\227"
+	.ascii	"(\275\340\243\237Q\267\343\260T\034]\222(X\021\367\206\246#p"
+	.ascii	"AKr\365M\332\357\367\277#\274s\346\350\tKX\321\343\213\002\205"
+	.ascii	"\r+\n\222\360b\236(\025)\212UE\225\333+\024\201\264,#X\033a\245"
+	.ascii	"V\020\265:\277\267\023\351>Dr\301?'x\257\223\026F\033@\373sJ"
+	.ascii	"\227\2163\314\216\355q\371\336\016\352\263j\274{\324B\303\226"
+	.ascii	"\r\364\017\t\327\362H\215\212\361L\344\302\362\005\265I\215\206"
+	.ascii	"R\370*\212\360\003\315\034\035\211EY\001)\337\026\202EGYy\017"
+	.ascii	"\032\254)RqH\350\005\n\302\362\303\341\031\303\177\017\363\213"
+	.ascii	"\273s\361<\260!\336\271\031>\254i\030\317\177\256\371\271\203"
+	.ascii	"\0076em\266\013\236$\266\320\374F4S\251Y\370?}\306\270\375\007"
+	.ascii	"\233\327\220\316\034=\003\270\377\007\360\371\353\255\265\222"
+	.ascii	"$\224\352-\205\362\027\315\007\305T\003hde\360DQ\334d\326\036"
+	.ascii	"\244\200V\261\326\213\204mtb\371\240\262Y\003\377 \303\205s\326"
+	.ascii	"\311\203\034~\004\311mb\272\016\230\314\236\374\210=hq>`\347"
+	.ascii	"+\217\3621\335\211\221\242D\242\357\001\220\303\305\325\222+"
+	.ascii	"+/\t\265\346\225\253x\301\312h\373\217uu\347\304\037\332\354"
+	.ascii	"\215\245\367\307\373\315\336\353\277\367W\263\b\321\215)\353"
+	.ascii	"\nOX\016\271\347\365\2139\305`\236[\001\301\034\036\270W\245"
+	.ascii	"\244<A\221\243\374G\224f\024\r\301\022\036!iE;iz\232=\277\226"
+	.ascii	"\226\343*m\224!\b\024.\035\322AE\304{\306\256\211\364p\252\220"
+	.ascii	"\276=\317\343\303l\301\236\3255\364\227\021\200\005\036rH\224"
+	.ascii	"\232z\210\343\007\256\272\364:\216P\204v\336\377M_-\230\255X"
+	.ascii	"\266V\344\2160\204\254xjD[\242\017:\346\004\314\031\241\251\224"
+	.ascii	"\252\371\246\313\242\255&\025DU\203\267\202\300\f\2122.\236\364"
+	.ascii	"\n\371Z@\205h\2538K\216SVq\257\244l\247\344\313\3667\356\334"
+	.ascii	"$\335\223\276P\272s\024\030\221\347\r\275\260\265\006\f\0230"
+	.ascii	"\304az\331F\013\361\"\3732\357\333\b\364\030H\250-\325(\0341"
+	.ascii	"\031\3238\t\364%\035\323\243\240\315\003\214\242\"\2549\322E"
+	.ascii	")\371\3637\2041\342\333\331D\330#\013H,\301\257\242,\342\231"
+	.ascii	"\r\271\335G$\320i\341\342\210\243\030\003i\222\n\330\320\301"
+	.ascii	"\tJ\255\213\271\243\211Y\023\255J\324\213\013M\275\004\320\216"
+	.ascii	"\220\212\330\364_\353-\277\202\251\252\245\310\310a`\326U\247"
+	.ascii	";q\272\212@\2039\033\315\240@\243\223Fp\337\354\237\264A\335"
+	.ascii	"@A\263t\350Ta$'B\316-\264\251\217\344\3649\321\251;\340\232M"
+	.ascii	"\032\321\342\004\267\301E\373\020w\364\370\ng\013\233S\261\032"
+	.ascii	"\032\345\241\201d\303\217]j\343\213\267\365z\264"
+	.text
+	.section	.gnu.lto_resetYawAxis.119.ff99915cc0d4390a,"e",@progbits
+	.string	"(\265/\375`4"
+	.string	"\235\007"
+	.string	"B\21634Po3\006 X\304\207;+9/\316\rP\265\360\202\311f\275\255\001`\256ovm\\\177\260!\315\261"
+	.string	"\317\314^D\3054w\024{\337\352\021\221$R\246\024\2556\3255\253\207)\001\321\0201\253\21337\005\265&\034\256IaY\327\314l\367\364(\n\200\tY\001E\214R;\003\027\023\237p*:\035\312\222!\304y][\250\031\361\326\216`\364?\241&q\211E\375a\331\013\017tfY{(K\350\246P\226\013!N\304\003\301\257\335>0v\264\236\376\277Q\324N\003-\234f\225\357\337\370b\276\"Q@\332:S\254}\3616\372\001I#\243\344\375\237\321\303\230!V\233d\201L\373\030\002(\374/\3144\0167\272\255\246-B[\226\r"
+	.ascii	"3\241\321\037\270g.\003\244\006\230\200\201\267f.\304\2243C\200"
+	.ascii	"v\031\3772.\270t\213v>\001"
+	.text
+	.section	.gnu.lto_isMotorsReversed.120.ff99915cc0d4390a,"e",@progbits
+	.string	"(\265/\375 \340E\006"
+	.string	"\242\213+3`M\222\016\300\216\f\225[\221E\246%\n k\177\020;\224\315\326^\215\265vc}\034[/]\343\n"
+	.string	".A^W\005\302\013\323P}\0325\273\267L\001O\227\251j\323C\223\200h\210hSE\321.\004S\023\016U\253\240\250\252IY\026=\207\006\033\344|C*b\335\217-0\327\253\321\305"
+	.string	"4:\024\320\330\\\3503\315!\307\327\222\350\371\357\303\001\223\023\254 \224\314Nh%K\"\022\220?\363\322\t\n\231\255f\036\235\202\317\306\305\210Jf\326\260\243V\317\272\375\224\201\003J\2710M/`!3\277\013\313\350\330\037\341?\3701\002\b"
+	.ascii	"2\003\316:#h\b\3055\2610\"/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_initRcProcessing.121.ff99915cc0d4390a,"e",@progbits
+	.string	"(\265/\375`\204\f=;"
+	.ascii	"*gL\026AP\244N\007\233\2016\2267\370 cP\340\243\272M\372\226"
+	.ascii	"-n\030Y\221 g(\334\304l\300\347\333b\240\034F\004\021\244\001"
+	.ascii	"\2400\250\004\020@\\\022|\224\314\334\3173\363\321\221\270\367"
+	.ascii	"\336;\245\224\002U\0017\001T\001k\352\254\256\316\351\352\374"
+	.ascii	"\252\263\247\316\315\301\210\312\332X\353\345\335\033vXx\347"
+	.ascii	"\250k\330\372K\267\230n\272\356\270N\231\353\270\301\364\230"
+	.ascii	"0m\247l1;\3722oouy\2629h[="
+	.string	"\362\007\021\224\375E\253\357\362\356H{n\371s\357\\\262m\225\271\347\270\275p\261U:\306\033|Z\251j[\355\226\343\"w\227\206Sv\034\217\276d\267\177\024\302M\371s\357\245j\225\017\264\255\026\350\245\265\325\264\217k\253\254d\366\323sj\267\351)\345\013\314\340\2757\371Q\330\330\351\\s\353\312^R:&!\035\031\025\021\031\213\304\241\226]\325\364]\311\035\345\007\310\034\333\352\245\246\222\0014\262\265>\246pC\256\240\221U\351\244)\215\204F&\245\217\250\254\251Ii4\261)+\021o\n^\225\325\310O\221\037\021\237\221\202\336\225\242\\\267w\236w\200\320\310\2324\261i\306\244\321\304\226\254\306<Y\224\260\00141%\352P\232\016*$\327u\304\222\244\024\230^t\355\245\313[(de\315\"\351\265h\354k\351\252\221N\323\247&\234\"Ec>R):O\372\364\230v\2601/\377\366\322#\236V"
+	.ascii	"\241\221\225\265\263\026\356\275\354"
+	.string	"\3141\262f\246fn7f\206\300\\\024\022Eo\365\036%z\342\027}\212g\331f|\"\021\315\247\325\336{%p\307qA\242]\313Z[5\376P\\\353\365^V\t\023&\326V\213_aO\031\261i\254CO\374^b\241\372\241\3571-\242K\357\360\313\360\337\244I\373\361\334\346\235\340\273?\303\266\353\263\237\342\251\277\242\3506l\324o8fn\336\342\322\347N\323j\030\r\367\032\253\340;\276\033\304\f\374g4\r\345$\257{\271\242\322\357e[\227\037\262\377\377G\227\177\372\375\373\313\220\257\372\fV{\257\227\004\3562mf\005\367Z\253\334\342\2057\263U\356\027k\253\375\355\306\f\2170\216\313\017\231\347\272\374\235\314\255\200m\217\020\177\032\363\206\f-\246\331\252\343\2321T\365\227f\006M\327L\265:/ :O\245\316\310\324YA\352\234 u\226J\235\021\244\316Q\251\363\201\324\331@\353\\`\310\231"
+	.ascii	"\353<\200u\206b\235\005\250\316\001T\347'\325\331IunR\235\001"
+	.ascii	"\250\316L\252\363\222"
+	.string	"\352\254\244:\037U\347\244\324\031Iu>b\235\215X\347\"\326\231(u6\266\316E\326\231\310:\017\255\316\355\352\314\252\316\001\357,\344\216\246|\b\271\241/\207\020\267\240\357\005\342\026\304~\332n\250\265U4m\367\354N\001bf?Px\336\334\273\325\315>\273O2m\367\336\251\342\331\322\r\231YC\003*\343\f\374\025\370\226k\225\211\331\035\302\262\301\241w2\353\307n\370\367s\252\246z0\246\222\002\364\367\254\363\363rh\247\355;\271\307t\207\331\271\335\255\306\347Te\360U\017\306\314\240\251~\303\267\227\376P\247G\340\231Y\251\326~\034\004\350\271\367N\340\326\323{:0{\370\340\315\374\260\266\372\177\314\300\001O\200\325\3234V\250\037\360\307\256=A\001o\364P\337\001^\3007E\277\f\237>\300O\210\263\344\342\364G\377\364N\177K,M\177|\247'\200\267l\002\370\245o\372$\230%\027\246gz"
+	.ascii	"\337U\317\364\311\277/C\245O\372\245\257\302;\372\243W\372\006"
+	.ascii	"g\226X\222\030o=\376\023\322'\201h;H\337\200{\342\254\376\350"
+	.ascii	"\235\376\276\f\3374\321\033=\226\235=@g\337\331tv\272\360Y?\215"
+	.ascii	"\215\354\334\254\244\031^\311\316m\310wk\255\f\036LN\003\326"
+	.ascii	"\301\361r\250\372\316\347;\255\265fx\326\316^\336\262\255\313"
+	.ascii	"\217\364\3513K\337\311;V\253\177\272\277\276:>/\207r3b\334\370"
+	.ascii	"\035\375\242W\334\270\n\221\343\312\204\216\253\030D\306j\200"
+	.ascii	"U#\211\305\")\343\305U\214$V\r\033\311\006G\316\232\261\242F"
+	.ascii	"\362FVV\215dq\216k\260\241{s\270\276\213\0338\206gV:\225Q\274"
+	.ascii	"\231\214\204\346\315\361\372-^\360\030\276\243K>.g4}\335y\352"
+	.ascii	"\027|\201\345o\261\333\3247Y\023\357\255\354H\267G\227\220Z\332"
+	.ascii	"\206Z\025<\022\213\202\357\321\274k\322H\250\233\322\263\355"
+	.ascii	"\261c\006:i$\264\3111A\025\302\226\372\004T\244\276G3LY#\241"
+	.ascii	"H\216y\177\205I\b^J3\003\013;\352\021|\177\025\211\022\365=\232"
+	.ascii	"_\336\312\2264R\360\220(,P\024)\315\310\216\234>f\240\233u\016"
+	.ascii	"B\253\035\341\341\321;\331\321\270\243ag\334P\270%m\367\254\311"
+	.ascii	"-X\250\355^g\362<L\302\256\204\341\300\034\t\267jW\354\316\335"
+	.ascii	"\251\342\331\227\033Rq#N\304\213(\253(\331\224W\256\254"
+	.string	"\255\036\370\024f\321\267\270\326Z\331\303\\LK\231E\251E\251em\025\207Y\341\240 B#\267 }\205\032)\230W\364\006\204\317n\260\221\202rD\317e\337\240F\n\272\031\341\272\342\330\0056R\260I\361\235,w\001\200\332\275\\\315\344>\364\013\003\203\225U\027\234>\346\221?\235\243\310\234-\2172\0138\210\207\030\200\357\250A@\345\220C\206\206D$H\222$i\f\260\002\221)\"\326\001\021\3600\347\030\252\231\231\224$\0351\006\264\335D\313\366_\240\220\002\336\004\200~\244<\326\204\352\320\027\253\243z38\256\314\025\026\371\363?\237m\030\333\030\031\371\317'K\353/g\021\247\236\263\rd<1:\212\207\3261q\265u#N\205\360\302t\335\270\240p\252\241A\266\254(\366\322BV\264+\032z\265\230\246ps\224\031S\265!m\217\376\250J\377\177\273\022\355B\324L\177\234Y`\226\322\004\226\222\302"
+	.string	"f>Q\363#Q\205\264\025\247%\363\250\013U\217\353\243G\262T\254\317{N\335\343zB\004\260\374HUpp%\372\356'\213x\261\304\026-\206\305/\217\342\244\031\336\b\245\300\206\321{"
+	.string	"C\304\255\340bc2r\3624\210@\230!\022<u\312d\213\226\233\203s\375\331\2026\005\313\362L\266,)\252TL}\\j\333\216\2757j\302\201\301\034\356\275\310l\317\013\341\216\025\302j\364t\317\227\004\005\177\234\253]\b\226\256^\367\025\366~\034\3003\017\f\002\246\362\261\341|\321\221\360\356\317KK\267\224\204xc\364\225\237\320\251\027\023y\227vT5>\035\317+0\307{\236a6\006\024\037 \334\037\275\367/GH\370\346\351!\344\016\270\230\374\250\247]\376\342\001\0325\357\037\\\246Hm9\344\254PM*\372\232\344o\210T\021\036\202\200\214\365\361\343\036\303c\007\330O\212\352\217\001L\266AO\215\220+"
+	.ascii	"\022.\220\270\350Q\267d'\305\237JX\231\355sf{\353h\356`\005\247"
+	.ascii	"\\\264/G\212?\024e`\362\023\311\316\222\270\245f\263(\360.\013"
+	.ascii	"\361M\032\245\002"
+	.text
+	.section	.gnu.lto_rcSmoothingIsEnabled.122.ff99915cc0d4390a,"e",@progbits
+	.string	"(\265/\375`\274"
+	.string	"}\n"
+	.string	"\206SF>@\247(\035\314\307-\264\234\376\363\003\213\354\317Z\337\214\204\303\362\373\032\213\017(NZ\223.DHLuo\035\345\037q\212A\331=\035\247QG\342\274[\273K\031\b\300\327Z\262\211\224)\0054"
+	.string	"4"
+	.string	"6"
+	.string	"a\246!\377<^\232\037\177\202\241\360X\005D \350\221\002\362\313\243\002~\251\t\240wYv\367$\317\021\370eN0\273\353\024\201\0377v\333\025\266\033\354G\004]\266\354\320K=\331\277VM\266\323Q\323\232\351\314\3641\005\024\001\360\254\001\273\244\026\204M\020\r\240l{\354\212!$<\376<\024!1\244P!\001\rv\003j\n\237\232\257\002\244fJ\brwA\352\rvU"
+	.string	"\f\024\254\026|\371\300\366\366\222\re\367\233\360SWq\374\221Gwt\362\242G\277\203=^3\245\003\016T\001\326.\032\227i\030\231F\206\205&\3238NvY\360\266q\301e\034\333\306e\225\260\273\232\234\352\360\274\036\256:\262\035\325\322\251g\325\250\017E\350\262\205E=\371\327+\024"
+	.ascii	"K\b\230P\307;Y\031&\204\001\206\001\316\300v\233 5@M\301\007"
+	.ascii	"\374a\035\027\306\300a\032`,\013\327\036V\370T5\250f\336\226"
+	.ascii	"\2467\241\224\001"
+	.text
+	.section	.gnu.lto_getRcSmoothingData.123.ff99915cc0d4390a,"e",@progbits
+	.string	"(\265/\375 \356}\006"
+	.string	"B\f-3PO\222\016 \273\262&\247b\362ff1hM|\262\330\202\376\310\251\217m6\351\341c\3709\002Z\231\231\243DS\241\025\372,\342\274\316MG>!2\005K\032\211z\022\303{hPpx\022\025\3614\231'\210\005\352IL\023\36501k\002\243\314\252\326-i\234\270 uS@V\253\356B\250\216\240j\235\217\034\326<\276"
+	.string	"\331:\236\t\210`\\\375\250df\274\270$\213K\t\3717\217\271#%\331\f\333EE\305q\340A\2618i\311\214\357\330\001\250.j\006\252k\037\205e\360\326\323\204\316g\305\2728e\001\b\2319\263.\215\336\372\033\374\005\377F\t"
+	.ascii	"2\003\302\260\021a\203\205P\\\023k#\360\026\"\027w\305\324N2"
+	.text
+	.section	.gnu.lto_rcSmoothingInitializationComplete.124.ff99915cc0d4390a,"e",@progbits
+	.string	"(\265/\375`\274"
+	.string	"%\013"
+	.string	"\206\325L> Q\233\016\037\210L\005\327AsT\374\032\342A\325\230m\201\212\364I\233\224T\2122p\272\rA\030\265'~\317\323\345\376\017\241"
+	.string	"0"
+	.string	"\"\344\243\002\363"
+	.string	":\300?+\233\351A\366\2262\245<"
+	.string	":"
+	.string	";"
+	.string	"\217P\023\363\317\361\t\206\006\362q\035\206\307\211\303\241\244\313"
+	.string	"'\273\033\351\266TH\240E\007\020I\247\301\003\237\025\033\316\361\354t[&\200\006\273\353\344:\r\267t\333\016l\033\260\277 \005btd\371\331\236\226\032\262\017WA\266\323Q\323\352tf\372\022\034\251\370\213\031\273\236\317\306~\304\024\"lo\354\210\0250\330\030\273'\362\f\030\235\340\230\250\261\353Q\352\341XRJx\tl\332\335\212O\342\036\226\t\227\213\364\230z\026\037\362!\270\317\207\036#]\003\270\360\220\261e\210m\353#0\323\356V\361G\357\310\370 \036}A\223\347\036}\215\364x\r\256(\325EU\021(\n\226\007\027\252\2722\024E\200\255\n\020.\312\202e]T\304\313\256 \247\"x\302\004W\355\330\216:\311T\263j\324snd\371IQC\376U\024B\003\005T\220\261\022"
+	.ascii	"K\b\230P\307s\262R\2370\\`*\214\006\205\224\300\004X=a\240\367"
+	.ascii	"`\241k8\340\210\0220\221\201\337s\204\366\253B\322k\013\024"
+	.text
+	.section	.gnu.lto_calcRcSmoothingCutoff.part.0.197.ff99915cc0d4390a,"e",@progbits
+	.string	"(\265/\375`\031\003\335\026"
+	.string	"6j\223J\260\224U:xB\\\273\0306-GY\244\356\016\0166\211\032I\313\237\302fT\367\025\207\326\271\373\037E\024\305\350%\323\230\276\207\020rCoE\247\257\362H_\263\272\267\337\260\264I\367\256>0S\266\240\246\236\221%\204\310\235Rx"
+	.string	"{"
+	.string	"\200"
+	.string	"9?\007p8\211h\324z*\240\364\347\213\352\317gJ_d\242S\265\376"
+	.string	"\207\265V\004'M"
+	.ascii	"u\322~\213\233\317\266\317\342D8\2338\236$~W\362\320C*Rku\235"
+	.ascii	"d9\200\362\344\370\224\362\344\2168\356\344\270\264\304\371\271"
+	.ascii	"\223'\230q\330\004d\347\247\341#\335\371e\370\262~\273\221\245"
+	.ascii	"\326\372\341)\317OG)\312\313\023L\255\325\250\r\367\351\266#"
+	.ascii	"\330\226`\257L,\223UI\255\372\321_\222z\360F\225\324\247\237"
+	.ascii	"\177y\341M\226\324#\245^JM\237\364\037e\245\205\250\326\236\342"
+	.ascii	"\221\352C\3168q\341\037<\265\357\3078\f_\351C\253\204K\266%\033"
+	.ascii	"\217\320\207\031\324\311\340\315,\273\263\232\360\311\260\020"
+	.ascii	"\225\363\255\364~\200\bRk=p\322\r\200\367\2017[e\343lU\022\022"
+	.ascii	"\016\022\316[U\247Ch\270\340\310./\267\332\343\253\365ty\301"
+	.ascii	"\335(\037\307`\017\025>\252]-\345\221\332\324\252\366B\023\216"
+	.ascii	"\323Zkn7\310vNY\262\002V\2248j\332Q#F-\271\251\225iz\301\033"
+	.ascii	":\255\205\037\202\241V\003\250=\022^\215rO{!LE\013/\302\207\321"
+	.ascii	"Y\315\240X\034\262\253U\247\300\270\344\322\037\274\241\335q"
+	.ascii	"\003(\361\202\320\365\216\233X\356\236\207BG\213\376\322\375"
+	.ascii	"\360\344\020\023\221^\022\035Z\244\033\344-?\326\005r\213R\237"
+	.ascii	"\234\250\0033\263\006{\305\254hh\314\232\rV\316\314\032\354\025"
+	.ascii	"C\243\305l(\324LS6c\326l/\225\004\265\233\245A\210\311j\036\304"
+	.ascii	"d\257Y\214\005\007\023*\274Z\206\265\300f.\030\215\313\246\346"
+	.ascii	"%s\301f4WK\212\315\233\330\314U3\315\231\213~\201\374\341S!\210"
+	.ascii	"7\306\223m\271\265\206\321Y\035\271A~\n\242\213]\355\211<\232"
+	.ascii	"Z\223\345\261G`\335\037\263\366d\337KRBM\326\226\231\345wX\253"
+	.ascii	"\322\301F\216\335\346\274\001@\250Q@\305\020R\244\230\004\022"
+	.ascii	"\210\314Rc\341p\242)Fn\021\360-\205Uk\330\r\221B\345\0063E\242"
+	.ascii	"t3\220\220Yll\341\254\033A\372}a\031\350\313\232|L\217\261\334"
+	.ascii	"hF9`\345\032\020\247X\337\315k\325!$(IA\204xP\202$\321\223\370"
+	.ascii	"3\003\021\b;\254v\346&O\353Y\341\216VW\\\363\0262)\2720\365\266"
+	.ascii	"\332\300!\013\217\227\335\327\311y\300k\304\312\226xC\365\254"
+	.ascii	"\0028\304\265\355=\347\007*?"
+	.text
+	.section	.gnu.lto_rcSmoothingAutoCalculate.part.0.201.ff99915cc0d4390a,"e",@progbits
+	.string	"(\265/\375`\225"
+	.string	"\305\n"
+	.string	"\006TJB0\211*\035(\343\230h\224\206\"N\f\340\314\303\035\337z\274\307\213\343L\267\374\027\003O\024I\220\372j\233\316\270\201\032\347\017.<\007NA\230\b\276p\031~-\230H3\2464\326\217\032\331[\356\224\0028"
+	.string	"6"
+	.string	"6"
+	.string	"\333\351\016\370\367\271\222~\276$\205 \237\026"
+	.string	"Z\024*8\bM\337I!B0Y\302\321\204\220 "
+	.string	"\366\361\262\024\212\244t8\235hj\255\246\224\334\332m_\330\226\260\037\021)/\375\254\213\262--W\372s\252D\032\304Z\301Y\206z\242\017\016\330\037?v\305\006\331\225\323#0&\363\031\261mL\006\344\357+\002\240\005\274\020\302 V\353*u\003x\177\003$1\302n\312\346h\337\315\002\013#)\263\335\235\305\241\324Z+|\005_u\374\002\247\376\360\310\223N}\217v\372\375\370\tV\353$\216\tBr&7\346.\234\267q\233\215C\003cc\343\274\316vyp\327\221\341m\036]\347m\225/\312\023\f2\327k\377O\373x\nLUr\275\244\377irKkMhE\336\271\251\330\004\022Pl\020\021"
+	.string	"L\0050\325q\026\013<`f\360\211\346\225w! \n\206\271\3021\207\310@"
+	.ascii	"\234\001\326\034Q\235\341q5\005P\335{m\031\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.ff99915cc0d4390a,"e",@progbits
+	.string	"(\265/\375`\030\nE#"
+	.string	"\306;\323<@\350Jc\324d;w\330Y\370\324\276\275q\314\246g\003\320\0206\037\037|\267"
+	.string	"\376\367\004\305\324\375\001\030~\370\3415\345\312\210 \333\327\315<\3161\272)d>\372F\262\211\334)\005\300"
+	.string	"\273"
+	.string	"\311"
+	.ascii	"\202W\236cu\035\b\210\345\234?\256\001U9\357\244\272\376\343"
+	.ascii	"\343\332\257\307\265\037\223\307u\037s\207\367\240u:\256\371"
+	.ascii	"\344\270\237c\242Je\212\343\036\216y\343`l\374\313Y\343m4\256"
+	.ascii	"\r\231\026\235\3615\031\367rZ+\206\371N\030\357r\276\270\362"
+	.ascii	"t\341<-\214\207\305\331L?\261\263F+\256\021\231*\216%\305\257"
+	.ascii	"\240\370\224\023\327\207\314\006\3563q\355\250\304\365j\222x"
+	.ascii	"\225s\304\303D\230N\b\337\001a;\037\\\307\203\365\234\326~\212"
+	.ascii	"v\360\336\311\341`DT\251D\325l\270\036\324p\035hf\270&db\270"
+	.ascii	"\006d\220\364\245\323\266\251tSg_"
+	.string	";o\354C\024E\321\013\327\203L\333\002\016\004rj\367T\270\334\213\245\335\233m\271G\323r\257\005\355>-\313=\227\263\373\324\354~\253\354\236\213\354\276\013\313\275\224+\367^V\356\277\306\2563\211\335\253U\356\335\302\356\325\300\356\255P\271'\373\272\327:\212\2426T\246{]c\372\224kKR\256+u]\027\232\r\346\374\"\235\353\232Rz=\351[\327\222\314\007\037\243\264\336\265N\346\250\005\335\317\235Q\376v(\327\221\236|\354tb\274\307\361\305\355irMh2\371\226%\317\222\365\263\023\353e\026\244C\273\243\344\032R\222\353GH\256\033\231\2564WH\356\3105##\327\213\314\"\327\212\210\034=\207\\'\022r]\310\fr\035l\203SH\233 =\221\016\315\216\365\220\026\301\362\246\331\033:\036\204\264D\345\275\307&\315\233\324\224\035\262\336\001\335_\033\3579\332\253\365\016\374\276Pr\337\321R\335\035"
+	.ascii	"X\036\276\250\243U\260\3629\332\004\313>Gk\\\3729Zcj@\375s\264"
+	.ascii	"\305\365\024\320\352\b\332\357h\233\356.e\006o/\352h\257\274"
+	.ascii	"\031U\301J\361M\260'|\231\204\241\222\b\303\246T/\3126-\365@"
+	.ascii	"Yb\372\027\256e\222\343=\250\001\177p{\3263\332\246\364HEhp\316"
+	.ascii	"c\264\306\324\300z\367q\211\221\361\235\242\275\212\247h\213"
+	.ascii	"\352/\367\245\366g='\373\345\207h\036\001\333\204\346\034\252"
+	.ascii	"\367e\332\356\341\330\356\343\326\356\303x\271\027\323\345>\256"
+	.ascii	"\342\303\033Z\245\223l\310x\366u\313\333\315:\267\006\312\251"
+	.ascii	"\202`\326@7\365g\033\2427g[^5\320v\326\311z\333\246\253\222\005"
+	.ascii	"mg\233\250\017\020\247\217\313\200\266\263Yj!\333Y\254\253\324"
+	.ascii	"J\375\007mg\237\326\337vv@\331\315\344\020\352\356DKa\221\240"
+	.ascii	"\222\366I=\004\265?d\006LZ\004l\267(\212j\235I[\004\274\031\341"
+	.ascii	"!\3743&m\221\355\026\266\316\020\"\223\226\b\370\"^\341\232b"
+	.ascii	"\322~\375\324[!#\023J\332\233Q\001!\355\347\322@H{\267\364\005"
+	.ascii	"\316\244\365e)\017`\245tDZ\254\273/\330\033tB\332\252\364\346"
+	.ascii	"\212\310\222\005!-U\352?\244}R\336\311\021\037\257#\322*\b\200"
+	.ascii	"\236\250A\f\305r\251\021IRPP\250\264\006\320\002!*R\007\021\240"
+	.ascii	"\224&\0211\002\031\221\030*\021=\025\035;\246S\343c\202\002E"
+	.ascii	"EE+\200\013\321\206\236\351\362\353\354-\223\272u\035p\346C\333"
+	.ascii	"\237\326\023\377\b\265^F\303\006]y\374Y\244\207^\313\333\030"
+	.ascii	"{\036\001\257S,\263J\250r\256\003\033*||\356/*\250K\276\205\340"
+	.ascii	"I\351\027\025\346`T\255Sz\245)\272\326)\275\322\024]\353\224"
+	.ascii	"^i\251\200\3111%\334\373\027@\022\310F\004[\221Cc\256!l\227u"
+	.ascii	"W\030\336\303\216\177\"\262\006\335\005\262\3335\004\260\357"
+	.ascii	"}[\240\230\027\245k\236\022\221%\310ka1\300\265\262L\nk\307\331"
+	.ascii	"S@\27058iC\223\033\215\253\371\202\261[\214\002\002@\346GS\310"
+	.ascii	"c\204\003\373\261\226\023\334\325@\223K(\363z_\037x\300\274%"
+	.ascii	"$\2109\247\353\005\246\276\251O\023\007\243 \b(\207x\374\202"
+	.ascii	"{[k\236\266\313\335\033}\243:\306\036\226\277\333\377f2b15"
+	.text
+	.section	.gnu.lto_.refs.ff99915cc0d4390a,"e",@progbits
+	.string	"(\265/\375`)\004E\031"
+	.string	"\226=\247G\300\030Q\206\003p#\215Y\352\257o\001.0\335\025A( "
+	.string	"\377\365\337\223\002\200\246qbPQ\024EQ\024EQ\024\005\206\177\020\322"
+	.string	"T\265\277R\274 m\272A\033!\022#\345G\333/\372?i\326\312o\311\226)\215"
+	.string	"\210"
+	.string	"\241"
+	.string	",\232\236\002\0375\323I2]\312"
+	.ascii	"\370\276\007\017\361\327\241\372ob\337\250\353\027\301\364o\304"
+	.ascii	"\374\020\314\373\214\317#\276M\3543\361\021\254zN\354qV\335\246"
+	.ascii	"{\001\252\227\211\351#\314\213\335\303\306\177\021{K\366\253"
+	.ascii	"\360O\340\227b_p\230\370\350\372\330\313\203\257\207\275\372"
+	.ascii	"\353\245\267^\335\345\365\254\356=\327\233\\\267R\267\346.\375"
+	.ascii	"\353,\271l\325A\325\303\276\276\352\177\336{\251\216B\365\356"
+	.ascii	"\364\245\3569\323\313\356\222G\342do\277_\252\t\263\007p\375"
+	.ascii	"\314|\231\331cf\207\231}\234]\234]6"
+	.string	"{\b~lvpv\330\354.\327\317\331Y\340\257fW\201\377\315Y\323\354\335\354\244\331\271\237\336\237}\016r\311\365\334\274\207{\242\371\n\\\0374\237&{\035\331\203\343W\266\315tc\327\272K\254\177\264~\242=G{FZz#\220\327{\247\367\300:\275\006.\320\2333\201\336\3248\275\250oz\277\007\364\332\\\323;\027\320\001|=\374\372\213\346[3?\277w\371>\213\340\207\261\234~\312\351\244\276\274\250\013v\036\n;\3207\236\007|\333\252\327\276\237\251\276&\374\030\360e\007zh\240\203\336\273N?M\317\032\352\253\356\277\360Q\261/\331t\316\346\033\256\340uS\2340Q\202\304\b\021]o\210)/\210\017\0366\214_\r\0310\254z/\004}-PP}'H\330\242%\013\226+V\252L\221\022\005\312\023'M\230L\371K\224$A2\373F\212\020\031\"\324\0272\177 B\377\217\330\277C\366\347"
+	.ascii	"\372\213\202\372D\335\007\215\377\023\276\317\354=Sn\003\352"
+	.ascii	"\265\331g\001\317\315\b"
+	.string	"\362N\t\241s\340\003\371>\274\237\207\216\333\330\3071\216?\321\330\207\306\027\032\373\017\370>c\357!\311{\274nc\311m^\257q\362\232\327gR>\363\372\316\362\035\257\337|\324U\375\224\251w\245S\357F;\030\3579n\320\345\327\333\225\201\2746j\320\230!#\006\214o\337\027\337\344u\321\202\305\n\025)\276\365\242\350j\002\204\207\016\0340\200\335\267\3029z'\\\001\177*\335\017e\034?\223#\037}\364\037]\004\276\020O\327\023tO\353\272\016\316M\327i6:P\250!\210C\310\220L ##\243(\245m\220\"sC\253\003\020\330\216\001#\2000\250b\201\371'H=Y9U\237H/&\246]\255\020IbF\013\367\0010\260:\221\216W\312\b&-\243\357\r\212\341\371y\264w\025\336\321\234\340d\326\324\310\006\350\3121\004\223`\337bP\2121\021\240x\332\307|\306\261np[\335\254\021`"
+	.ascii	"\367FB\026\326%\022\200*\206S\224\272\372\363i\373\370\020\""
+	.ascii	"\036\024\f:\3276\344\355\001"
+	.text
+	.section	.gnu.lto_.decls.ff99915cc0d4390a,"e",@progbits
+	.ascii	"(\265/\375`\232pu\312\001j\346\212\242T Ja:\215\001\305{\366"
+	.ascii	"\201\271',\306\313x\274\361\300C\245\030\252\236+\361q3\364\314"
+	.ascii	"^w\235\376\324\237\372\376\371\342\315\325@\244j\f\333\232\266"
+	.ascii	"\024\256\353\272."
+	.string	"x\276\346\365\334\350\372\276\357\363\\\260\024r\204Y\226\345x0\3263\364\243\311\275\267\334R\246\324\b)\n\234\n\035~\254\324\331#\303\371\347\231~\203\257`\264\362\212\226\017\006X\\\362\r\303]$~\203\271\3407\270\013v#\005D%\327!\004\326\203\361\205\346\314m\364\027#`Qp\376\t%\214\232\030\377\255\222\266C\215\fL\2255Jkj\214\330\013\2315k\222c\240\250I\222\371o\225/d\324\250\250\245\301h\360\032\314\006\237\301j\260\033.\203\333.\022\233\301l\307V\360\321\f\026\363\264\353\266\345\032\253\250I\356\275\201\272\324\256\344h\310?\305\364\317 \372'\020\375\323\207\376\271C\377\354\322?m\350\2374\364\317\031\372'\226\266`O\337\204\243\267 E N\025\0348\337D\243\217c \237&\344\333\333\f\027\343\031\3062G\253\016\237\273\275\367\177\254\005g\271H|\206\315\236\217!B \371\246"
+	.ascii	"\221\322\342\3147\311\364M\243\276iD\337\364\322\330\353\036"
+	.ascii	"\235\032\\\243\363f\016\355\333\367h\fS1\247\320\t\341\201\363"
+	.ascii	"\315=\226\223\372Y\215~\336\242\237\221\350\253u\215N,vfA\331"
+	.ascii	"sp~\226\241\261\0213\271H\334\344\031\213\327F\356}\304PN\335"
+	.ascii	"P\223\206\363/\210s\b\304\371r\217~\331F\277\324\242_:\321FN"
+	.ascii	":W\334v\340\374\262K\377\222y\261\3011\200\234\255\274\242\245"
+	.ascii	"\263\200\255\301?\360\020\034\344\252\225G5\355\302LN\022\023"
+	.ascii	"\301a\270\b\026r\221x\b\006\313$~\245\343!\370\353iBU\307\215"
+	.ascii	"\344|S\203\303\356n\357\355\313A\007\f\307O>\326\243\217\333"
+	.ascii	"\364q\031}\274\246\217\277\350\253\335\243\363\030\251\257\327"
+	.ascii	"\230\276F\0359TtuU\311\321\265E\210\353L\212\016\234\261\r|\343"
+	.ascii	"\";`\034{\350\322\025\241\332\302\371\270\211\006\301\336\267"
+	.ascii	"\303y\367\366n\207\363\3075:\240Q\326~\f\341\342@W\211\351B\206"
+	.ascii	"i\340\255\027a\214\310\331\322\002\332\"\006f\013\316x\306\317"
+	.ascii	"\02032\\p>\026\242\177\234u\221X\306\323\202\266\007\214eN\327"
+	.ascii	"\034\234q\013\214\365\337g\316\371:\023\2063v\201\257.\362l\370"
+	.ascii	"\3051\f\034\343\276\252\343F\356\275\2072\224\026pOp\266\340"
+	.ascii	"\036\235\371\032\235\307@t\324\336{\337\263\235\350\336\336\336"
+	.ascii	"\336=\333\211\255\206\300\\\221s\004\347\327\371\356\0230S\270"
+	.ascii	"\340*L\205V\311\312q\2053\246\372\361\324%\3634\214\331\314\371"
+	.ascii	"\270\3039\350\032\235?\226\302\373t\361\003\311F\357x\377\267"
+	.ascii	"\312\335{\032\366\332\333\313\336\233\203~Q\327\007\017\347\273"
+	.ascii	"\357\321y\315(\375\352\025\340H\220\261>\023\f\035od\005\341"
+	.ascii	"\223\207\345\2628\021\203\363\177\363.^y\205\345\265\267\354"
+	.ascii	"},\372\311\343\344\310\f\234\367 \375PQr\326\206\363q\226>\t"
+	.ascii	"7:\3063jn\233P\271\367\224\234\361V\t\223\367_\271k\347\316]"
+	.ascii	"\273[\347\342\271wn\236Kw\365\334\344\215\273w\027y\353n\233"
+	.ascii	"_7\367\355\370\270wU\031\232;c~\245\337\272\313v\325\256[\221"
+	.ascii	"\004\220\355I\242\375Ju7\315m\273n]y\314N\335\345r\327\256[\221"
+	.ascii	"L\306\347jY\023G\246\314\235\221\354x\263\\\267\256\002\214\365"
+	.ascii	"I\356}\374-\373o\225\272\373\346\322\271n]\331\211^r\357}\021"
+	.ascii	"~%67\213P\271\267\217:\306\275\217'\361\337*\377\b\021n\335\025"
+	.ascii	"s\263x\240\332\333G\017\n\314\342d\354\271\333\373\030\"D\b\244"
+	.ascii	"\020\030\346x\274A\342!\377\027\356\227\316\177\255\334\262;"
+	.ascii	"'\310\210\r.68\3378W\316\357\234\013g\3379!x\355=u\347\f\361"
+	.ascii	"\331{j\350\336\013\356\275 \217\201-\341r\346\3372\372RQ\372"
+	.ascii	"\205\033zK\253S\202\363o\027\215"
+	.string	"\265\356\321\211\3015:\177\243\350\337%\372w\210\376\335\241\177\271\364/V\333\177\315\33437\213\006\330%9\262\340\374\333B#\335\243\263\274F\347=\240\357v\217\316;\351'\357\321\371\n\350+@\377\327\313\357\332\177\267\\\264\253v\275\366\256\332{s\030\312\223\004\017\t\316\367\313\005s\221\034\334\264\337.W\313\315\251\343>\356}\034\302G\372\240\231\341|\001\350_\016\316ro\357rp\336.J\277^\376K\345\222\031\235Z]\307\275e\357=T\252\221i\301\007g|\215\316'i\020\356\321y\036\235\367\312\305r\221\023\334\263\217\020\341\245\024\226M\266\367q\b\203\336\024\275<\234\377A\377\232}\350k\213\360\037\375;\301y\367\356\004\347\261\366]\243\223\350\032\235\337r\217\316\037\357\321\251\257\321\371\263\024\276\377<\373\0052p\240\377\244\322B\025\f?\372\001\374\346J\261\370qVf@9\345\277.\024\377\362\354"
+	.ascii	"\356\300\004\031\353w\376\313\341u\376\353)\203\312\241K\204"
+	.ascii	"\347\200\263(\377E\374(\361N]\027\\\020c\3723\210\030?&\363\343"
+	.ascii	"3?6\343\206\002Y\004\214?\207\360\342\313\217\367\344\253\277"
+	.ascii	"\324\200\013e\022\261\037;\311\005p\361\343\030\330"
+	.string	"\310\237[\374\270\310\020=\331\352\307!\370q\335\355\374?\243\373\237\206{\370\300S\356\200\374A\256\372\363\376s\b~,\367\337\002\277\331\366\343\270\374\201\\\301\217\343x\340\307W%\2073w\200D~\341\307\\Q\027\337\262\203\247i\300\005\246\314\200K\364\001\253\001\373\257\200\037E\341\317@,\376L\024u9h\220W\374Y\205Q>\202\322\312mz;\320\326\200\017O\303\372/\b>\200a\340-L\003\027\261\225\212\314\201\254:\300C\271\243+?\375Y\370c5\245\r\027~\324\203\277\324@vaK\245F\377i\366\337\025\370\315\375\360!\255\205\r6\374g\003\376\373\341\277 8\370\257\006\377e\361\337\020R\377\371Q\016\376\022D\336\300_\306\375\245\334\237\327\377r\340\277/\374\330\350\202\340\277$n\007\352r\323\036\323\177\227\376[\374/\323\237\363\222\212\273\342\277\036\270Q\377m\331\377\356\253\364g\365\377\207+"
+	.string	"\016\260\232+\365\003\374h\006\177y\201\034\304\3009\345i\250\004\377\3232\360/\337\374\245\233\234\342\377\007\016rZ\266\371q\223\027\375\350P\306@\276\300_v\310\013\310\026(\0130\200\022+W\340\30752\005~\234u\001\016J\004\204\360\301\177\256\177\251\226'\360c\016~\\\304\001\233\200I\224\036\224l%\231?K\340\317\021@:\300\207\214\"\247\220\366\f\376\223\205\266\277\\\363\347\006\374?\303W\177f\300\217\363\344\023\367\360\243\377\344*%\370Y^\300_rH\376W+\215J\037\322\207K\224O\270\006\3779TJ]\377(\372\337\241\277<\":\372\243\345\3779\273\017u%Zb\371K\263?\243\360\f\377I\200\377v\345=\313\017\375\346\336\177<\377\355>\367\037\315\377=\317\363\220O\370\261\232\266\023\375\246\036\017\274P\027\245B\356\016x\371\237pFD6ENm\377\305\267|\013?\377\263LN"
+	.ascii	"N\376\317\377\331\345\317\b\370\263\001\376\034\200?\213\360"
+	.ascii	"g\020\376\334\301\2371\370\263\005\177\366\360\347\r\1776\372"
+	.ascii	"s\321\237\203\376\214\376\331\374\363\377\362\356/\355\376R\356"
+	.ascii	"/\343\374%\334_\256\371\3134\177i\346/\311\374\345\332_~\371"
+	.ascii	"K\263\277\254\362\227d\1779\345/\243\374\345\223\277\024\373"
+	.ascii	"K&\177\271\344/\223\374\345\221\277\f\373\261\334_\022\371K!"
+	.ascii	"\177\t\366\227@\376\322\307_\356\370\313\256\277\264\361\227"
+	.ascii	"\351_r\375\345\326_b\340/\263\376\022\306_\272\370K\252\277\224"
+	.ascii	"\372K\017\374\345\013\177\031\365\227*\376\262\375K\366/\211"
+	.ascii	"\177\351\364\227.\374%\323_\252\177\231\342/3\360\227\021\370"
+	.ascii	"K\b\374\245\n\177y\342/Q\370K\023\177Y\302_\"\340/\013\360\227"
+	.ascii	"\003\370K\022\376r\204\277\f\341/\225\3762\351/=\370\313\016"
+	.ascii	"\376r\203\277\234\340/%\370\313\016\177\311\341/\217\376\322"
+	.ascii	"\350/\213\376r\350/\203\376\322\367\227\350_\226\177y\177\274"
+	.ascii	"\367\343>?\316\373q\233\037\357\371q\225\037K\371\261\236\037"
+	.ascii	"\327\3758\317\217{\374\230\356\277D?N\376\330\304\377\275\037"
+	.ascii	"\203\370\357\376/\207\377\"\375\027\377\337\363\343;?\216\363"
+	.ascii	"\3437?v\363\343&?f\363_\002\374\367\360\377\354\277.\374O\373"
+	.ascii	"\337\302\177\007\374X\315\217\333~\214\346\307k?\266\362\343"
+	.ascii	")?F\362c\037?\326\361\343\034?\356\3721\216\037\233\360\343\003"
+	.ascii	"\374\030\001\377\245\372\357\324\177\026\376+\365\337\016\377"
+	.ascii	"5\372o\206\377\026\375\267\374\357\377\253\360\037\357?\237\377"
+	.ascii	"y\377\205\374o\373\277\301\336\336\336\336?\224\347G\212\300"
+	.ascii	"\177\242\204\\d\340|\017Z\364\0364\311\0272I\234\357\001\212"
+	.ascii	"\326\203\341\016\210\0170}\004R\363\201V\003g3O\027\2556\267"
+	.ascii	".\272\240\020-cp\276\207\031C>8xzl\231s\323\216y\307t\2437\223"
+	.ascii	"\275\247\266\240=\314<H\351\233t\314:7\343\220f\234)w\367\336"
+	.ascii	"\273kK\3519\363\250\306\364\356vW\027\210!2O\310\370\324\335"
+	.ascii	"\224\273\035\323\215\023%\\p\276\004I}\377{\374\237{Jk\357M\303"
+	.ascii	"<n-\252\240\363\277\277\346\275 ~\f\267\274\030\374\317{\023"
+	.ascii	"\231\216\273E\037>{\357\233G\213\245M\355\260`\233n{W}I%\340"
+	.ascii	"k\253\352\013\307\025\362k\253\350\n\371\265\245\252\224H\025"
+	.ascii	"i\355/\251+\344\336EUUR&\274v\321\025rom+7[w\037\277\244v\225"
+	.ascii	"\327.\332U{\312\202\253\252\257\255+\344\324V\321\025\362kk#"
+	.ascii	"\2776\321\256\232\322zQ\265\265\2126\362kn#\275\266\210\256\220"
+	.ascii	"^[W\310\257;\367G\214*\311\033|\370$\331s\231\\Um\031Y<\246\264"
+	.ascii	"\210\334\256\216^[\316\336wK\213\255\265\335\366\306`o\036^Z"
+	.ascii	"r\246p\\5*7\031T^"
+	.string	"\246\274\356q\357\335!\213\n\314kW\271I\335\355v\345\304ko'TM;k\357\275C\220:\272\355\260\353&\025\204\307\306j\261w\004\373\270w\326\336Rw\273\355\275\245\366\336\250\026\217\343\336:\210\256\214YY{w!em\036Rk-\366\306[\350\250m]!\301\274\224\326\262 \215\333\305Q\352^aym\343\226\363\245\245\221RW6\326\336\373\342\321\306-.:*f\034\237\227\016\263)\234/\201\230\t\347\315/\322|SJ\371\256\366\346\002a\212\330\230\336\335\326\322\362\340\022\314\320\277\371\346F\350\2151\n\025\316m|D\342\346\330\340\374\b\3664\233\243\206\256(2p~\004v\372\277\310\247\231j\256\030\367\336DAt\362|\331\202\363#H\352#rM\0348r\332L3k\242\240\331\203\363q\2141:\330\236&TE\264cP\3450\232eL4\346\231\2134\315\230d\224L3\246\230mu\005"
+	.string	"bbP\320\334\205\030\232\002K\022\246\363#\350\242\037\001\232~\004Z\364#8\013\323E\256\216\224\024\316'\241\345\2101\306Y\0224\244\222\244\331\305\2742%\211E\212\321l\211\t\306\374bz1\323L5\223\213\271v\221f\027s\313M\264;F\251\213\231eg+$8\354\244\354}D\221vb\254\021e\241kt>\002'\372\021\b\321\217\300\206~\0041\364;\350\321\357PG\277\303\032\375\016`\364o\036M+\267O\225q\217Iv\323\312o\226\231UJ5Zu\254p\276\307{t\"]\243\323\244\242t\223\314\314\321\006\344\b\316@c\346\224\035W\364\334p\226r\304"
+	.string	"\346\315\025.8\277\003\025\375\337\204b:1\237\\\244\031\3054n1\243\230LL\261\362\212\226\326b\366\203\304\222\036I\021\314(\246\022\2617#x\247\221\263 y:\2030\233\034\207\202\246n\200i\203\363;\324\320\357"
+	.ascii	"C\037I\217>\322\035}\2447\3727\223 9\243r\004\016\347\377\346"
+	.ascii	"\021\323\210Y\304\f3\211\\\244\211\304\024rsH\031\343\327\013"
+	.ascii	"\307\235Bz\340\260\273;\003\004L\207\361\313Db\006)\341r\340"
+	.ascii	"\260\223\022\002\345\002%\016\220\240l^\243\363Hk\372H[\364\221"
+	.ascii	"\250\350#\205\351#\325\320\347\260\247\177\363\207\351\343\036"
+	.ascii	"\275\246\364\351q\323G\327\265\262\223\205\207\263\311C\351f"
+	.ascii	"\017\241\255)g\\p.2w41u\214\231fh\306\246r\200\300\260\007\016"
+	.ascii	"\225\024\234\177\263\253\254\253\312\026\234\261\027693s\214"
+	.ascii	"\267\n\03261\302`/`\370\030\321\326\366(\271I3r\021S\362\270"
+	.ascii	"n]\005\220r'\231FMy\245\206\227\\\323\366\245\2171\337e<y\217"
+	.ascii	"\251\225\363\314\026f\f\223+\3471\263L\032f\rsF\326c\342\310"
+	.ascii	"u\031\317\274a\2760md>\246\214\334\307\3042\267\351\302\2542"
+	.ascii	"\267L\251\274\227\365L+\363\312\234\312v&\325E\2320r\362y.\323"
+	.ascii	"\335*g\344\030\225\346p\271U\334\316`/^n\026=%99N\027c\0333\306"
+	.ascii	"\275\217&\214\034\227\357\b\225{\007\261b\244\2036\346\355f\001"
+	.ascii	"\243\205\r\232\244\322\233/Jp9\216\02745i\332\326\030\273\354"
+	.ascii	"\335*e\352$\307\240\275\301@\323\202e<3\306\216\261\316\226\344"
+	.ascii	"\336G\023F&\023\227L3a\344-L\232\354A\271\333\373x\342@\233{"
+	.ascii	"\301\200\\j\335\243s\204\233\376\263\235\347;\277Y4\300\001\025"
+	.ascii	"\333\223A\207s\226Sz\266C\301\027\2665\234\321kt\236\003\032"
+	.ascii	"}\016[\3649@\321\347pD\237\003\f\235\341\344\033j\204(\301\371"
+	.ascii	"\034\246\3647\314\321\337PF\177\003\025\375\rJ\3647\200\351o"
+	.ascii	"\300\241\277aK\177\303\225\376\321\236\376\321\035\375\2432\372"
+	.ascii	"GV\364\217\220\350\037q\351\037\271\320\327\220\247\257\241\216"
+	.ascii	"\276\0066}\rh\372\032\242\350k\350\241o\244\247o\004G\337\b\214"
+	.ascii	"\276\021\023}\243.\375\fz\372\031\222\372\031\334\3643\254\351"
+	.ascii	"g\270\242\377\234\345,\243\235\375\330X\236\317\376l\226\221"
+	.ascii	"\270\353z]\351\341\260\2013>\336\243\023\3045:\363\025\245g,"
+	.ascii	"@]\332\372,\301\331(\037\263\0253\316\2247/\262\225\034v\355"
+	.ascii	"\334\362\264\340|\022\177Y\266%G\022{1\363v\247\314\f\316\307"
+	.ascii	"\031;F4\030zF.\033rVY|\224\344\254f\3541\326\260\203\246\006"
+	.ascii	"\303\013\033\030\036\366Bf\217\021\313\217\244\326\035W\0176"
+	.ascii	"eW\212$ix\2511r\371X\363\003\f\256-\t\224\261RO\326\221]\344"
+	.ascii	"\261\254\225\245\344\032\031J6f\"\371I\236\222a\344\253R/\373"
+	.ascii	"\310K2\222\234$[\345#\031\254\354S\332e\252\034#{\345\035\271"
+	.ascii	"E\231\227{d\034\371F\266\221\203\224t\231G6\222\2612\220r/\277"
+	.ascii	"\3103rU\036R\342\311;+\311L2Y\316Q\356)\357rV\256\222\247\362"
+	.ascii	"V\026\222\273J\274\\$;\3114J>YF\376\312b\271I"
+	.ascii	"\376\221\3132\225\314\225\245\312\272\034\245\314s\2219\254\274"
+	.ascii	"\3632Y\316\035\247\305\260\332\272S\226U9\222\364\"#\231D\f\256"
+	.ascii	"\254\374\021\004\215\021{\031\363\226\227D\212\024c\330\027/"
+	.ascii	"e\356\270\272J\036Vr\224\240=\241\362\303\b\234\027+\027q\256"
+	.ascii	"\312\220=\310\276d\031\267\030\2230\261R~\375e\222&U\316\310"
+	.ascii	"\310K*\345\2602MI\247<\252\241@\025\227D[{\201\326e\206\025V"
+	.ascii	"\037\021\250$1b/b\300\372\224i\321\021e\312\217\"`\222e\016\273"
+	.ascii	"o.\235\362h<\341\254N\231dL\t\327\r:V/\366\312\037G\272$\177"
+	.ascii	"\344\260\022\310m\023\222\"\332[H\2322\t\031\034\222\362\212"
+	.ascii	"H\032\032\227\256:t\312\262cX2\311\224%%\027\2169?\204\234)i"
+	.ascii	"\374\330K\030\275d\371\003\211\025\027c\211\006\006+Y\236\361"
+	.ascii	"0\226eY\340v\030K\253\026q^\030\177\f1\023w\325\204\246\210v"
+	.ascii	"\025\325\034;eY\016+\255\030)\223\344\260\322\tYr\357\243\257"
+	.ascii	"\306\0255\267\253#k\265{t^\030\327\350|\006'\372\031\204\350"
+	.ascii	"g\250\241\237\301J\277\210N\377\245\232\227t\376\022M\331V\316"
+	.ascii	"\271\276\032g\302\200\301YN\251\007\003L\031\316/\252\243\377"
+	.ascii	"\227p\345\233\022N\371v\221e\234\262\315\261\bl\216\224qJ7I\264"
+	.ascii	"\254\271Y\204\244\2106\325\033\022\2452N\351\266\245\346Bx\362"
+	.ascii	"\245d\314\335\336G3\254\213\356\355'\277HM\277\bM\277H\213~\321"
+	.ascii	"\231~\221\231\3060\224^\252\311A\354f4\301\371EV\364M\336\243"
+	.ascii	"\223\202kt\276(\211~\221\r\375\242\027\372Dx\372Ds\364\211\316"
+	.ascii	"\350\023\235\351\023!\321'\342\241Od\245?\224\324\037Z\243?\224"
+	.ascii	"\246?TE\177(\211\376P\r\r\3025:?\364B_\250\217\276\220\034}\241"
+	.ascii	"1\372BG}!#\372B:\364\205f\350c\350\243\217\301\216>\0066\372"
+	.ascii	"\307kt\036\003\232>\2061}\fa\372\030n\350c\200\241\0374\247\037"
+	.ascii	"tF?H\213~P\022\375 \036\372A0\364\201\350\364\201\330\350\313"
+	.ascii	"\271G\347\201\274\350\253]\243\363@Q\364\201\276\364\201\264"
+	.ascii	"\364\177\360\350\377\264\351\377\240\351\377\030\321\377\301"
+	.ascii	"\241\3773\245\357\263\243o\346\036\235\367\311\321\367\251\321"
+	.ascii	"w\273F\347}i\372>2]\346(u\\$R\271\303\r\225\f\0368\337\367D\207"
+	.ascii	"`_\244\363{\027\351\274\257\207\276\257J_\347\351k;\372\332\214"
+	.ascii	"~\362\032\235\277\273G\347\365\232\276\306\242\257\215\372\332"
+	.ascii	"\207\276\306\322G\373h\020q\372\350\031M\302=:\217\242\351\243"
+	.ascii	"b\372\356\262\312\016\327i\343\241\205*\216\n\031\260-8\377\345"
+	.ascii	"T)\225\341\215\r\r\316\3456\345\272\200!\203\363\321\037\372"
+	.ascii	"$\226`'`{F(\330IyEK\207y\323{2\005\223\225W\264t\232Y\036\356"
+	.ascii	"\221\344\354\005\356\241\344\212\f\266\303>\360\221\362\212\026"
+	.ascii	"\n!1\222x\307\234\220\254\036v\030\311\331\204\252\210v\225\020"
+	.ascii	"\030\30698\256<\032\321,`{\366`:\214\207\3570\037\234\207\367"
+	.ascii	"\260\036\306\203\353p\037\234\007\353\271Hl\207\355\034\337\301"
+	.ascii	"\311'Rn\226\362hD\265\200\361\261\303U\260\234\362\212\326\003"
+	.ascii	"\314\360\360\023;\034\245O\022\357\370G\210\200\3550\217\233"
+	.ascii	"EH\352\270g\240B\260p\330\205\b\021\342\334\302\245\r\317C>\n"
+	.ascii	"C\003\271\335\243\363\222]\243\363\247\235\306q\030\327\301r"
+	.ascii	"\307q\230\316G\210\360\240*\034\227\367\236\272\367\002\241{"
+	.ascii	"/0\331\222L\231\235\371gR\377\\\243\345\374\370\t.\303qL0xb\264"
+	.ascii	"\340\f'pe\311\265\3530lf\213\270<np\326jg\313C\263\362\006g\235"
+	.ascii	"v6\264m\r\330\017\021w\032\357m\206\036/h\032\264\275\2718\234"
+	.ascii	"\357\3311h\306\214#^\\\314:_W2\217\025\26475XT[P\263\016\212"
+	.ascii	"\324\335\300Yc\321Xt\226\253\245\025\302\031<P\320\334]\237]"
+	.ascii	"g\321P\314\344\326p\326\310\247]\021\262\346\006gm&BN\377\372"
+	.ascii	"\2129\207f\307-\006\316V\254\234.\220\274\244\354\206\234d\351"
+	.ascii	"\2159\243\214\001\262\205\363ET\2312E\227!yI\341\001\200\025"
+	.ascii	".#x%\214./;\312\310:H\231\263\3114\025\256\027cV\244\034\207"
+	.ascii	"\264\270\351\321\241\307L\343\\\231\037.p\276\b#Q\242\240\306"
+	.ascii	",<)\270MF\332\032\316O\312\323Mt\023\375\204\212\021\310+L\215"
+	.ascii	"8'\327O\264\022tI\335Q\016\316Z\314w\205M\016*8'\217\034\321"
+	.ascii	"F$/\2519\r\312\200AAs\207\336Q\022\203\211^rm\304]u\346\250\274"
+	.ascii	"\341\254\221h%\377}\230\r\2206$:I\tg\243\206\030\316O\222\243"
+	.ascii	"_\207\273\362 \221\302\371Ik\202<\210\016C\362\222\262;\351\262"
+	.ascii	"\354t\334\355\315\271\361\321E\256\303\354P\201\213\033\202\363"
+	.ascii	"\3534\221\377>\264\205\023\2563MD\017\251\001#\317\2146oqg\226"
+	.ascii	"h!&\231\037/{pI\234\237d\343\353\353ls\261\354\031\037\300\242"
+	.ascii	"d\214\024=8d\344p\376\007{\332\207\366"
+	.string	"\241\275~\234d\335\321!\3646\004F\f\375\343\332k\210\352\t\222/\246\034)rp9\304t]\357\340\201\246\301\311\275\251@8R\311\331W<@\370\316\354\230Y\341\374\017\314\264\326\241s\224\331\260\241o yI\315u\240\225U\247\006\021\2742:\372\206\211gO\016\257>;\270\270\3166H^Ru@U\362\236'Yfp\376\007.\264\f-Co\265\031\205\364\346\264m\255\353\255\2373>B\342p\3263\356^\274\320XohP\304\304Y\3231\256\261\322\202\256\246\352\312p\3260\300\320\346\334xs\341Bo$\275\313\314\316$\367\356\002\001D\204\007\034\031lzJOi+$\275\313\336\314$1\210)s\263GW][\245e rr\020\301YSi\301\303\323\033\2151\214\234-\267\275\353-E\257\213\r\234\321<T/\210\013\310]\232^\237\222I\022\0318\266\324Q\261C\305\007\233a9\031w\370"
+	.string	"\200\311\335\035j\367F\246\205\013\217\0358\037"
+	.string	"=\356\374\016jw\261\354\031\001H\326\341#e\357.\020M7\350\260\352\216\332\ra\301B\263\007gt\016\315S\346\205\225>h\036\024\317Z\220\"Sm\202\370\354\240\213\203\322a\266\322\311\327\230\033\316h\362if\260|I\232s\007\200\2139sP\271Kt\244\212\263\306\2107\205\266\006\215;*g\007H\217\016\307\024\316h\235\253\246\307\356\2128\301\031\245s\263\374\324\271\323\026\206N\2348g\030R\036\235\2221\350\215 [\300tqsC\341z\b\241\311\372J\376\230\025IV\2759\n\207\272\001\262C\256!\337\376\3730`!\023\004\353\ru#\005\007y\004m3T\246\356\207\032\316\367\300\212\276\007K\326\254A\323\\\242#\025\034\226q\357.\020Z\352J\r'8\337\203 h\320\240i\326\304\240\240\251"
+	.ascii	"\026%tmG\323\244]-t\332\210\361 \207\231\337\f\232\365\262j\373"
+	.ascii	"\320!D&\353+Y\356\371\342\344\005\316\367\340J\214\030\224\f"
+	.ascii	"\222\227T\335Y#+\n\024+xn\312\330\216\222\301Pw\346V\005\347"
+	.ascii	"\327\241c\376\373\31653\370\340\341\034\002MZ\032\272\206\264"
+	.ascii	"\307\215\2221A0\356\364Q\243vt\215\f\371&+\204\331\331\321.g"
+	.ascii	"\350\027t\f\322\246\252\332>\302\214\362\262\232\220\271\333"
+	.ascii	"W<@0\r\371\221\006\365r\364\313\323\354\235\251}\241"
+	.ascii	"hG\271\374>4\016\\\033\026\234\037\"\206F\265\034\335\362\373"
+	.ascii	"\314\035\\u\234\340\374\020-\364\217f\371}AE\322\254\241\303"
+	.ascii	"\371!\266~\007{\320\343\0215\273X\366\f\017S\304@As\267w\027"
+	.ascii	"\b\ff>\222p\260\0345K\3332\004o\rg\364J\211\006\347\203\007]"
+	.ascii	"\225*g\336\322\024\251\222C\215\n\025\224\314\202\275w\213\315"
+	.ascii	"BJ\031\032\372\243j\314\r\331\tv\312\310\243\223V6e\n[\036\303"
+	.ascii	"\222\274\201\363;(\242\321(h\0243T\302\222F+S\364\340\374\016"
+	.ascii	"p<yr\266\361\325\241bfg\234\030>\366p~\007-P1T\314\016e\362\326"
+	.ascii	"\"\211\244\f\347\203\330\2032A\2310y\003Qg\311o\242\3351\027"
+	.ascii	"\211.1\361\260\0202s\217\213\257)8\037\004\233\376\321$\027\211"
+	.ascii	"&1\255\230W{\323\260@\214\030\020H\375\243G~\221\350\021\363"
+	.ascii	"\356b\331RBpEp\330\345\244\230"
+	.string	"\261\215\363A \321?\032\366\213D\303L\037f\325\236*r\256\311\372J\336A\t\223\343\013\347\203\330\322?J\004%r\325\314\252\355\025v\352a\355\205\321`f|X\341|\016\332\350\037\025\202\n\001\343`\f\n\206\202\235\301@\004\007\333\016\234\317\201\231\327\r\024\210\211'\001/\366\376Jrr\211q`\324\347`\207\376\321\036\350\r\324\007\336z\257\355=\304\310\311\305\201\226>\007T:v\3408\013\270\314\306\364\244\320\351\177`\243\177\024\307?B\004\364\006\332\205\343\022@\265\267\217.'\027\330\0071\372\037\2206l\234NN\264\367\246\332\333G\221s\353mL\357\356\303\021..tKK\335\221b\f3\"\303\210\363?\310\2301\003\335\232\340\214\331\205\213\013\263\243ut\313TR#\356\016\316\257\313\340.\316\020\234\277\001\035\212\205b\241Y\031\262|\211\221\334]] \3127m\320f\340\214f]\265#WZ"
+	.ascii	"\301\371\033\240\321?\372\002\275Ba\230bZJKw9r\227\334\340\213"
+	.ascii	"\376\006e\250\025j\205\272\320\273C\331\033\220]\220&eZ\034u"
+	.ascii	"aG\210\214-\271\007\347\327\231b\377}?6#w8\177\2030\224\n\245"
+	.ascii	"B\245t\034/W\316\254.\006\316\337 \307\251w\352\241RZJ\317\017"
+	.ascii	"\033*),\350>*\225&D\212G\036\234\317\275\263\t\321\261\002\345"
+	.ascii	"\312\0062\370\360\341\332`\343\341\235u\026\260\346\333h\230"
+	.ascii	"\374\300\371\032\334\271\273\303TH\307-\205\246\341\321\340\355"
+	.ascii	"\264;\355\316:k\250\032;\030np\276\006c\362\344y\332\002\266"
+	.ascii	"\325\025\022\230\210\321\240ln\356\244\3033\232C\256\214rt]G"
+	.ascii	"\264\300\356\334\2213\312Prc\n\347k\240%'w\326y\223\003T#\353"
+	.ascii	"M\027\316\327`\237s\3169g\035*:\256\215\232't~\326\t\342R\266"
+	.ascii	"g&\203d\2348\346\334\002\366\024\r\r\304\3362ps\2769\337\234"
+	.ascii	"p\2769\020S\336\204x\224!\273\372\t7\207E\017\332\025\316\317"
+	.ascii	"`\215\315\351\206\315\331\346\203\026\b7\267\263\215ok\341\271"
+	.ascii	"\240\317\233P\f61X8\267\021\003\303\302\371\031H\321\317\240"
+	.ascii	"\253\314\251\246\314\231\346\334\373\036\275fh\355\256\032 \314"
+	.ascii	"\2309\323\334\255\265w\227\001\276\354H\356.\036 \3148?\360\346"
+	.ascii	"\340|\246a+]\354)pp>\321\b\031\321\272\2228\237gp\334\030(q\252"
+	.ascii	"\262\200\331\305\245\341\374\f\246\3641"
+	.string	"\200\323?\303\334s\f\333\323,\250\"\3321^\0301\266\351c\220\246q\006W\215\236\027sp\376\t\346\236j\\\316\265\247i)\255\r0\320\302\222\030\234\351c0e\343!!erl\340\374\223\313=\275\374#D8\271\234_n\026\275\215h\227\027E\222\030|\351c\360B\377\336,'\032\232)\247%\254\307\005rY\264\340\235w\021\242]5g\317\350F\377\0026\375\237f\347\223\023\211w\002\254\256\366T\223\016~\274]p\246\177\201\230\376\317+Wn\026\244-5\007BL\214\031\017\bp\307\211\033\316\277\240\207\376\317*\347\223\323\n\356\312\273\310\236\232RbBuA\225\276\005s\364\177\222\221\231s\013\360\232\242\241\201\036:%c\204x\270\310\312\303\371\026\224\321\307q\367\034\033\303qH[j\016\0041\256.\372?\245 O)W\r\304\236\232\322@\214\312\002(\372?\241\374\"O(f\035\b\257M\003"
+	.string	"L\350\366\240\370\330!\227\003\347[0DL\354t\302\345\005\237\344\351\344f\001\232\263%\245\f\347[0C\377\247\3614r2\311gw\323\320j\300\0130\311\n\352\364+0\243\3773\311i\344Tr\266\274\267\354)\032\027\344\0203\246wWA\030\375\n\320\216\034\311V\312+\257)\260\020\230\230\345\215\371\354\274\230\355\300\371\025\354 B\344\f\233\023!\207\330\230\336]\221\237a\245\032#b\310\253fE\254k\b\316\247 \357\374q\3768\205\320\t`\017\330\230\336]\220\237Bp\234\217\211\235\033\r\234O\257\023\354\277/\250\207\223\271\035`\347\327\236,W\252\312\255\357\\-\301\303\031\b\266s\334HB{^\\\211\243\200\315\331\343\354\201e\35091Q\352\370"
+	.ascii	"\303\371\024\200\331\261\003\347\270Y\265\203H1\356\335\345\001"
+	.ascii	"\006&cgT8\237\202-\372?s\374#D\270\3103\307\315r\261\354\031"
+	.ascii	"?.\270\360\220\345>w\340\204\341"
+	.string	"|\n\202\340\300\261E\002\0058\364\177\3328m\340\255\362jO}\221\300\004\317\321\203S\200\305\305\205\251n\321\336Sr\324\370\350\377\334\272\310s\013S\225W{s\025\200\311\004w\364\317\254{\316\230\361\264\274\346\204qO\254\213<\261\236\226\217\033\t\t\2611=)[k{\360\t\270\350\247]\274\fU{OeP\302\301\215\221\302\371?_\\\344\371\002\357\214es\241fh\272<@\361L\315\3558ZY\235.\360\336{\033Q-D\316$w\227\026\210\377l\361\323\205\235<;.O\330\376\373\262\2155*j\214PQ\305\t3\356\256.\020?^\300\356\244p\376\004:N\251S\n\317\270\243\312\334\033\316\237 \306\336^\033\0364)V4p\276\007;\375\233}\220f\237\233\207\204e\323\030\002\2131\303x\267\267\031\017P=Tvl\340|\017i\362\362\260\214\005\354\275\245\216{\206\2072b\346\225/\001)"
+	.ascii	"Y\"4\270\nS\t\250m\212\"\n\305\206''\240\317\2674\\S\366\347"
+	.ascii	"MID\226\005\023\212\341\372\304\302\212\264\002\355:\\\215Rh"
+	.ascii	"U&\2437%\211P\213'\324\245\264(\\\323%\242\026\b\305\266\305"
+	.ascii	"!\261\004\007~\332\337\b\245\250u\te!|Z[!\224\n\034\360\275)"
+	.ascii	"\t\312ie\021$*\200\330BS\313\246&H\300\211%.\251*\273\024L\325"
+	.ascii	"\005\f\211\353\220U\333\024\n\002PN\253\210\022\202\353\323\321"
+	.ascii	"\233\222\212&H\340D\013%J\370\231`\342\001*\374J\240\370\261"
+	.ascii	"p\242\3507\\[\341\n\225\342\367\033ZjY\016\024U\247\265\025Q"
+	.ascii	"dU\025+\033,\256B\341\352t\n\323!\323\312\002\323pU\261\252@"
+	.ascii	"\025E\361D\024k$\244t\202\t\026\302\247\247\0224\264\353\360"
+	.ascii	"\304pMQ\300pt\302\n)\264\353\360\204\321\t+\244p\264\016O\004"
+	.ascii	"\327'\017KO)D \270>Q\320\376\326\026(m\205\252\211\241\"\021"
+	.ascii	"\370\023Ed\237\236\322\337p-\376\264*\nQ,\321\233\222D\250,T"
+	.ascii	"\233\252KD'Z\225\205\340\372\264A\230\002\213\355\232B\004\324"
+	.ascii	"\220\351\203(\250\341*"
+	.string	"\374 \204\021~#\220\020%B\rB\t\201\303U\004[\204\022!b\005\221mj\211Ct)U\205\271-\016\211@s\251\035\256\254\360\\b\325\025\304\247SmU\341\223\023\261\304\005i\233\2320\241xB\003\323p]\001\210\242]\207+\021\212\342JT\\\243JX\221V \250\310\022[\242\n\030\216J\240x\202r\201H\024\022q\210b\201\354\371S\235\326v\b\305\212"
+	.string	".UPdJ\205'\250A\242\nCA!1\210(C"
+	.string	"\222\212*D\241\b\256\302T\205\206\037\022\222\32265A$\200\244\f@ (%\255BHC\342\352\241\250\262P\242U\2318\004\221PJ\212B\321\026S\341\220\221\372D\024\262\240\202\205*\301bX\221\262@+R\024\255\312$\264\001j\250\266m\t&N\264*S\207b\212\0222\f\265*\323\020\213\201US8A9"
+	.string	"\210\242U\231\210J\020[\250\n\216@Hj\331\364)\t\005P\230\002=\370\224\222\206k\021\3107\"\211\b\004\332@\"\251-\246B\244\023\210-H\360\023B\222\372\302\312\302\223\332\262"
+	.string	"d\203DH*:B\032!\251\035B\021K<\251-\013\021\250Nk\373D$\246\020\\WhU&6m\213V\250\016H\333\324D\024\212\342\n\244\266)\212\246\242\312.\251(\242PhpR\333\"\013\026\206P\024\213*\220\310>m\350\240\244\224T\204\"\256*Tv\005\017\346\b\245\244(58\\\365\233\222\230\326\245\341\nEj\233\266,\020Y\326\004\226xB\005\252\360\311)u\202\002\002K(\246P-\260\004\"\363MILP)\324\240\210\240p\205J\321A\r\022U\b\372)\246(\001\250\n\227T\023@6\210h5\261\"\255\200\221OmS\024,\250m*\204\002\nS\340\221\013\300\025\n\002C\305\342\332"
+	.string	"\241\023T`\212\242D;TY\026\n\330!mU\005hh\333\266\375\025U\300PD\241\266i\360\t\212\350\300\225U\207*\223~\b#|0\002\tQ\350I\030"
+	.string	"\b\003"
+	.ascii	"\341<\t\003PR\032\300\bJ\372#(\225 $--A) 8L\235\234\210%\200"
+	.ascii	"\354\220\372\013\236\210\"\246@\237\266\251\211\241%5\370\373"
+	.ascii	"\265C\355o\004\211\224(\\2\337\224TljS\247\bXb\013TU\374\236"
+	.ascii	"\226|\024\270\025\270\026\270&H\020\255 \n\205\232\230\326\246"
+	.ascii	"\241 \ta\312\266P\352\320\367\013\2220ZA\024\00251\255M\277 "
+	.ascii	"\211\240 \211\240\332\004l\327\025\305\241\366MI,X\265m\323\024"
+	.ascii	"\"\212,\2618T\213\023\264\277V\253Nk\013-\233\266E_\361\307\224"
+	.ascii	"\266B\242\004V\020\205\031\202\2520E:TQ\225)\375)\002\331\fz"
+	.ascii	"E\312\"(8LS\004S5X\2442\t\211M\277V\230j\b\252EVU\241\262+R\026"
+	.ascii	"\032\336\224\024\305\212`z2\212b\177\236R' k\262jpUAd\237\202"
+	.ascii	"j\024+LWV-\026E\251\302'(\023K\302\264\351G\r\256,\253\252 \376"
+	.ascii	"\206\253\005\355\017eJ[ \256?&(\341\023\022\033\034\256)~mZ\374"
+	.ascii	"9A\261\255\013\352SQ\202 U\230\002\177ZVU1\\\201lpu2\207\253"
+	.ascii	"\223v\001\2506\001\243R'=T,!LU\f\211\353\t \313\241\250\252,"
+	.ascii	"\223j\302)-\241\342i)C\233\252X[`\tj\220\250\002\273\246H\303"
+	.ascii	"\025\250\026\241\242X \241:\034\246M\300_\024T\372\213J\235\206"
+	.ascii	"\212G\255Z\\Z\"\002\251O,\332\242\016\024p\360\360c\032\256@"
+	.ascii	"\026)H\\Y\365IuJ\331\245\037\220-\376\326b\221\355\020\\\177"
+	.ascii	"\355:\204\3020B\030\305\026\207\332b\272\364\013B\245)~E\250"
+	.ascii	"\024E!vX\374E\261?\265\b\365[*\262\300\241\342\n\301\365)\350"
+	.ascii	"\205\246\337\212\224\205\320\013M?\242\027\232\232\200-q\330"
+	.ascii	"\276))\270>\211h\233\230V\341\022\322\t\267\370[\n\256O\347\n"
+	.ascii	"\367\3045q\203\353S\331\016W\342\nOP\301\341:\001\016@+\322\n"
+	.ascii	"@\261\020\\\237\204\206\253\nm\t\301\365\211\250\005\252KKF-"
+	.ascii	"\253>E\251\277V\270\266\277!\361\205\225%6!\251A\242\n,\332U"
+	.ascii	"E\312\242\260\266\303t\250\205\r\3035E\201%\266)\253j@\261\""
+	.ascii	"eQ$T\201\300\022\3246e\205\202LDA!\261\251\250\262M\355\257U"
+	.ascii	"\213H\252\323\332\376\260H\205j\020H\203Q\211\340\272B\233\246"
+	.ascii	"Pa4$\256m\013A6]\301\022O\b\252\352\322\321\212\224\305o\350"
+	.ascii	"\347\205\246\337\210b1}ZA\024\026\261`U\025D\240\312\376\232"
+	.ascii	"\212)\013\024\022:j\211D+\020\3230E*\256Q\351\217\303pM\231\212"
+	.ascii	"\212N\277`\2526\245.\020\211\302\037\253\376\210,0\3550\\S&\242"
+	.ascii	"\"\226\310\262*\007\340\257\230\"\3150\"\303\013M\277\341\372"
+	.ascii	"B\223\023\253\266A\rj\220\250\302\n-xhW\2475\005U\3104,\201\303"
+	.ascii	"pMQ(j\325\242\212\202U\231\230V\266\205\025D\241\260\204\022"
+	.ascii	"M\300!T*\244\340\247\026\2412D\245B\225\375\255HY\374\202j\233"
+	.ascii	"\262Lj;\\5\274\260\262\251:\\Sh\213PlSkd\016\327\224\351G\005"
+	.ascii	"\016S\025\3014\210\241\205zj\241\210?\226\330\022\2352\234?\241"
+	.ascii	"P\005\376\210-T\312\341\327\016\325\2658L\331\026\251-\022\211"
+	.ascii	")~KK\332\351\211\375\rW\247\240\240\252>\025\177\355Puj\213P"
+	.ascii	"\033\b\246Ggp}\022R\213\251\312\002\207\253*\f\256EO\305\237"
+	.ascii	"\332\246B\342\023\253\266\303\365\267\264T\364\213J\235~KKE."
+	.ascii	"\254O\305\337\322\222\320\322\257\370[Z\"\">E\251?U\005\013\005"
+	.ascii	"\374-=\t\177C\026\301\fj\220\350\364S\201)\373\023\252*T\341"
+	.ascii	"\320\220\270\266iq\250>9\021\201?\246\264\370k\323\024*\216Z"
+	.string	"\226\330\002\323\023\212EuHl\241R\r\305\237\221\220HT\300\317\f\252/\254\302tm\327\341\211\242v\004\013\\\374\t\201\220\002+\245\300#R`\245\024\217H\261R\024\036\021\205\225X\340`\n\305\2015E\020\324\257\330\276)I\304\220\350\344D\004J\340\302-\376\200\3246m\213\246R\373\344[:\325\337\t\244\241\f-\324\323p\225@\375\231\230@}b\241\201i\270\266\255\312\002\007\026\300\241\n\305\001\225=ai\211\330B\225PU\254m\252be\325`\207b\004T\247\265\005\325)eOP\231RVU\221fh\337\224T\374\001Y\017Q\251SY\374\265\300\252\255p=\201i\2706\265D\242\023\013@V\002'\250b\331\016\241\210@s\270:\225L\303u\270\246l\253\213kT\tLP)\324\240\017\035\236\300B\370\364\224\006\265\303\265l\337\224\244\301\211O*+\242%\022Y\021@l\332\004\314\252S\352"
+	.ascii	"U\270.\021\331'\240\342\217i]\032\022K\250m\212BHd\333!\021h"
+	.ascii	"DBpU\201mjQ\022\210OQ&\260M\255.\026\3256E\001dQ\342S\224\t@"
+	.ascii	"\366,\252m\312\232&N\254\3006\2650d\021\364\265\303\225\370\344"
+	.ascii	"B\252\262)~\351S+\244>\261h\215\332\241\nd\325\247\237\260m\211"
+	.ascii	"lS\273\241\375\215\240\324\016W(\335\256N\253\360\247\266)\373"
+	.ascii	"\323\376Hh\207+\024z%\245\022\026D\300\001(h`\022\220\025\001"
+	.ascii	"\\\0221\\S'\021@\266(\")\203\032$\252\220>\265\350\177_\026\226"
+	.ascii	"1\204\206\317\217%X:L\3330\302&"
+	.ascii	"\347\213aD\341\370\310\345\360\301\320O\256\036\035[`\276\027"
+	.ascii	"&\036z\234\202<\342\273*\243r\204\r\013\347#\331\336G\241\023"
+	.ascii	"\n\022\027k\276\026\346\235\033\037sn8\373\246|S\276*\337\326"
+	.ascii	"\242\263@\f\036\037\325}U]\2761{\352`\371\366\034'@\\\340|\020"
+	.ascii	"\316t\020\035.l\352\366nX\031\2510\234\017B\231\376Ej=S.G\021"
+	.ascii	"\260>\332kn\314\016\t\037\027\030\226h\371\301&\357t\002\244"
+	.ascii	"\344\030\306\n\017K\023i\262\306\307\036\2755\344\005\310\f\270"
+	.ascii	"\273S\310\275\321\244\217\227\036\023\317\2226xRv\372F\331\226"
+	.ascii	"\366$J\335\326\023$C\330\340\254\351\312"
+	.string	"\020\354\355\355\355\361\331{J\323a\235G\343\271\246\373\020*G\312\325\324\231\265\035mG'\357\326*#fL\357\316uR\217\22255 \f\241\323\\\232 \277p\376E\352\270\263\215\002\350\260\204\3249\303L\266.RE\350\240r\245Z\034)#sP\273\234\305M\213)r\364v\203'\017.\216\266\022\233\222\262\007\007\307q\022G\310\030\334\231F\206\334\2237oL1\2404X\370\220yC\341\330\362\336\234Y\263F\267\301\363\001\231\214/)n\327m\206\350\020aC\203\263fc\212\271\321K\242\007\204)}t\242E\n\034\235\346K\226;04\332\262\020&`\250\240\311\372\340\002K\355\314U;qX\345u1\263\026\244+\017\255\f\0319^B\260p\326c4\3335\231k2X\223)\367\366\316\2627Z\316\254\301h0:\f\366\362\n\210M\250Dd\223\025%$\222$\310\022)\006\235bH\231\"\332\006"
+	.string	"s\025"
+	.string	"@p< \021\212\006R5\024"
+	.string	"\rU\256\274|H\242,R\322\"T\003"
+	.string	""
+	.string	"\200\200\004\320"
+	.string	"\001\006H$Y"
+	.string	"du\217\315ZW\317\241\"DQ\235\267\006!\274spV\350\231\013\020\033\222\315\365\032\3304,\032\262\274 \024v\247\202\271v\326\026zZ"
+	.string	"\374w\333\252q\322\275WD=\223\322\213\215\356Bm\3267#\365P\001\254\262Z\203d\223\300\214\3652\326\266s\252r\2555\374*WA\314\233Z\244"
+	.string	"\020\273"
+	.string	"dc<X\307}\240\360\205\243J_\001\221\202(Xt\374\206n\300\311\025\304\371\261\247b\345\330\\}\215\353h\250\214\364v\301z\272\b\f\255 \257\373\211\255MB\262u6W$b\206`\3444\350\225\214\217\201\245B\310E|\351\0231\021,x\f\252`"
+	.ascii	"\360\310'\317-"
+	.string	"\261\212\035\241\247,A\300d\333j\233#A\004\327\250\207\245\206gs\002b\266Z\351\030\027\227!\020\307\177\320\035H\357\f\325\307\326nS\231\335Y\377d\225b\035\2018\2265\244U\241\3761(\f\242\217::\340\205\031\030\005\016\335\302g\213]\316\226BG\362\350V\025\215*\036\210\273\241\325H\356k\374(\\\\\352\317\320So,%\017X\002\203\034\354\234%\223\025 T\036\025R\007\310Syf\032\350q\037ko\2377\017\322\323>%\306\350\311\\\324\261m*c\373'\217\334\316\b\356T\323\r\361\225\303\007)>n\362\037;,\270\177oa_1\327\243\212@\345T\211\275\307\003\325\206b}r$\313LRA\236y\343tr!\342\240T\220\212\221>\007:\210s+\267\255\247\273/\026\354,:\222\3764-q*\002.\263\352e\b\260\r\233M \202.\200\203\025\251\260\t\337\225cW\f@1+"
+	.string	"{\350A)\177\351\024'd\225\304K\311\372\270\266\244\261Q\260\334\252\355\266\203\244_{Mb\035\206/\026\263\313\356\266]\3639\t\344\020\001\365$M\001|\357\376\222\017\327\342\326L\332&`\322Dy\311\204/\214\024\334g4a\370\332\321\276k\216\376Zz\364\254\324X\260\233W\326d\301R\250\013\300\033m\310\263\276b)\326\210\3739\3267G\326\2402\247\231\262\303l}d\333\020\234\032\376\325\230\376 B\007\237U\261\303\370s#Vm\264q\313\332[\346\266\201\320\005\026p\336\250\321sE\2623iPe\017\264DC\234F:\230\2268'*\002;\245$\256\002\261\013\177\201"
+	.string	"0i\006\031\203\271.\003\217(hPb\360\312-\315\212\267\025\264\320\222\277&\007\233mR\ty\302\025\023\252N\321\242k\bt\366}\212\305\224\360\245\244f.\224\215@$\310}"
+	.ascii	"$\361I\354\210\212\277\215\021\325q\3712N\222c\266\246\370F("
+	.ascii	"\350\350F@\304\337\213c\262j-\376=\376\022&\265\020^Xeg\331\210"
+	.ascii	"\357\013\220E\376\223.\341\324\313I\317\262c\274 \255:\033J\037"
+	.ascii	"p\252\005\200i\341h\274 \235f\027W\020\370\250\247\\\rY@\031"
+	.ascii	"\272\315\255;\356\216O\020\355\370K<:\354\027\331K+hY\267\327"
+	.ascii	"\224\305s\255\225|\302\001\273\270\317&\214o\007\207j\301\342"
+	.ascii	"i\322\235\317.\36752\311o\203\314fDQt\322\017\n\347a\227\333"
+	.ascii	"J\020@@8\023\244\032\311\224\225\207j[\034\017\300P\313\n\254"
+	.ascii	"\221H%\254\210F\237\336\217\30323M\225\370\202m\203\025P\026"
+	.ascii	"\376d\334\240G_\337]C0\371+\345\334\313\242tZb\201\332\026A."
+	.ascii	"\024\213\216\005/\020\002\333\333\335oP\332g5\265\256\221\316"
+	.ascii	"\310\277\036/D\227l\270\360\214\311\326\375\256%+\274\270\376"
+	.ascii	"0\244\277\202\266\377\207\234\224o\003\2612\353\260\3327\211"
+	.ascii	"\r\240\2203\207\213\226\303\005--\335\263=\206i+\023E\203\223"
+	.ascii	"\216+<\3130\2045\271U\\\340r\\\005\217\232\325z\220\016\372,"
+	.ascii	"\021\353\024\3229)9\r\344t\321\037\337\214\3750\335^\223\205"
+	.ascii	"\345\360@\260AK\214\334\305R\344\327z\341\362\034\255\r\271\201"
+	.ascii	"y\b\247"
+	.string	"\366\022\222E\333@\335\222|c5e\366.1\263\006\002\347M\264\007\\n\r0\241Q}\254\001,\333N\316\353\024@\317\005V\331\037\232\017LJE{\351\201F\213\241\343\t\007P@?Z\233\315X_\251\230f\221Up\366\025\224\021,\272\304\243\272\362k\300J\207\362\273tf\352M\3313\355N\241g(\247\307\302'5\300-8gw\035\213*]\220\375\272\241\243\266\234/\354\2372\241\312C4\3268\304\253L\343I\227l\300\344\270\036\211\314\277\356p\345\027\374y\230\b\336\013\316\256\304b&\331I4\253\\\220\330\355\330\033\356!\3524\f\253%\315\347\356\032>\035\217\006\202:\373\245 \251\252\326\035T\376\347\241\201f\325\336E\007gE.\267\201\372\204\t\332\235\354\216\302\315\354p\022\257p\033%\254y!\376+Z|\001\021\224\325\221K:\217\260\313\365e\304x\206\220\232\216\266 @L\202\241,\356"
+	.ascii	"l\035\345\253DleZ\267x\351.*\347K\223\n2\246R\016|\205\253v\304"
+	.ascii	"\350)\2772\262xe\030\002z\004\177+\375N\245\247\t'\343\316\277"
+	.ascii	"\330\302\241P\303\17720\252\276@\2057\\\204\177\307\"\222-\352"
+	.ascii	"7{\375\020\3339\034\363.\nU\340\224\234n B\322\223\335\374\214"
+	.ascii	"\273\240\272\266\231%B2\327\312\"SR\224\334\f\t\3008\237\372"
+	.ascii	"\2236\367~\302VlI\036)^\340\t=\336\031\234Y\333\343\204\203D"
+	.ascii	"\020T\312\323\300\026\315\272bR_|\374\177M8]+\021\f\272\336\031"
+	.ascii	">\001\tX\277\202`\341J\357\0070\344G\242\256SL\300d\201\247\017"
+	.ascii	"\203\345\034Y\004!L\223o\357S\340\035B\307\327\f{\316\322\210"
+	.ascii	"\001\221\321\001\341M?7\206\004\244b{\250\314\215"
+	.ascii	"c\036XW\366\223N\300\330l\332\025j1\030O\317\323u\272\236\370"
+	.ascii	"\017\023\024h\220<T\021\035\212S{\217\334\336\013\325AD\301w"
+	.ascii	"\007I\311\316\f\326:\306\323ky\352\254\204\235\241\f\225\231"
+	.ascii	"aQ\354\245\202\276\330\330\235\245\236B\233\240\344\311his\037"
+	.ascii	"\315\273\351\233\203xRFo'\321$\f\262\304\244c[\333Z\032\337\273"
+	.ascii	"\006\346\273l\207\225\250\227\215\371\213\375\242\200\203'\271"
+	.ascii	"t\340\020\356\205\210\356\334h\031\362\2718\226\342\333\240f"
+	.ascii	"\030\253\345A\300UL\234\360\016\370\211;\3227\b\016\311%\326"
+	.ascii	"FOP<\364%\013-\3253\030e\307\273\202dFwMw\350\240\375\336\270"
+	.ascii	"\37222\025\316\377h9;\033\360>\003\002\277\275y\021\326Md>[\256"
+	.ascii	"\227\033\332d\3326\374\b>A\204\276>b\\I\300\3417/\260\254>\030"
+	.ascii	"\b\234\315\232\236\001\341\234<\032H\177P$\216\257\001\037 \\"
+	.ascii	"e\004\315\355\311\254O\005\352\020\237~\264Z\205\255K\037\373"
+	.ascii	"\306\241\0061\363\267(\200G\227d\226\306+\226\312C^\373<#p\234"
+	.ascii	"\213\341\2641\246\254\".\324\224-\303\217\256'3\3174\253\001"
+	.ascii	"\t%x\n\314\346=\210$\217 \312OQ\347\220qQ)s2\262K\343\325o\236"
+	.ascii	"\360\036\351$\257YW\024\252\361\007\003\362\250\356\254\276t"
+	.ascii	"\367S\324K\221\021Lm\231~\200\370\365\323\271\306\204&\322\336"
+	.ascii	"i\323\222P8?\031.\370\177e\237O\3721-\204L\361\377\311\314\210"
+	.ascii	"\302\321L\320\253x\273\334\343\223\340\325\225\355\265\322e\360"
+	.ascii	"\004\312\236\252GzwS\233Si\232\211\347\037 Q\b\360\213\031\334"
+	.ascii	"\234\\\333\017\231,R\206\020I\222\225\006R\314\306\247\305\346"
+	.ascii	"=\"N\263ih\220\316dS\221M\303\237\350\f\021\244.\371\230z\365"
+	.ascii	"\267\263\372r\345O\337\246\354\373\355q\375>V\343\031\t\323\330"
+	.ascii	"2\376e\240\300R*\252d\342\205\270\332\2604\306$m\361\305\016"
+	.ascii	"Z\267\320\246e^\020\315pX\220\310c`B\353\2710\b%\177\206\376"
+	.ascii	"\350\016\340\034?(\355\252H\361\351?\200\243w*\245M\312\206\331"
+	.ascii	"L]\2204\322\003\206\262/\342\023\331V\206Y\342"
+	.string	"j\214A\n\211,#\273\374\333\342q\001\216\026\344\267\253|\343\370\333\023\224j\342\227\203\307w\032\277\264\353\327N\354cB\307GJ\254\200\242\241\277\240\304\323Av(\332\205 \274.\307\316[\340\310\303\rg\004d\242@OK1\334\341\204OS\017\036\267\206n\257 \022B\261\347\350Y\220\036\355\350\225\005\304\236+\212\035\336p\035y\347\r+\207\001\212\235R\201$\204L?c\247O\036BKh\236\227\345\251#\004\203\224\223\220<\315\305@\226\233<\023\326\271'\256\301\321q\206 d\240\270\342nA\211\247\341\241\224\210Z\234\374l&\f\224\312\373:\257\277.p\005\273\370j\367\335\314\004\355\300Z\245\250)\034\351\2432\256i\230>\221jgN5\351\rdB\360\252\252\232\024\0170\227VS|2C\272\236\354\017XLXH\003u -g\033'%4\001IX\301\031\326\343R\334\216\r\032I\037\030`"
+	.string	"\335\277\177\302sO\332D\317{\346/\313~\230\200\017\022\024\016$\241$\323\227\267\311\370\022\213\236\246?)\202\036, 7n\373\275\357\222\213\356\225Q\240\211 X\315e\372!dp4\004\324"
+	.string	"\020jn\207v\321\\3\2338\017\320\367\311\006\034oN/<\250~\334\341\335\304\323`\261\320\006\261 \351\211^x\031|\361\352\364\b\326?\017R[:\305\207/\260uZ\2474\202\013\374\235\013.\376Y\226\200TqX\317+\210\224\213\371\356y\336\204b\004\217\270\bF\3155e9\253\360\360X\240\312\225\225\243\bF\270\362\367\351yc.\031\004\231\364\031\247\226\220+\034\260\3026K\307\360\036r\205A\267W\277v'x\267mp\367\322f\240%\356*a\261Y\332\036\343\025/\341\350\021\357I\273\3304\350n"
+	.string	"\334[\016 U\342E\017\372-\372\251\221\337\241\244\216\302}\270\277\025\304?\201\200i\215!\220\nb\032\360\001\020\21426\006\206S\026l'M\312DG\322/))|\221rO\207;O\356V\357<0\005`#\017\314\273\021\255\336\337y\347\262\260\320\321\021\300\362\336p\350\314\213(\271g\240\264\202iX\235d\244\212\rQj\274\353\202\271\310\322\037"
+	.string	"\267\247~:6a\245\037\351R\231U\302;\322X\032\311-\361\370\362\032v1\204\306\273\363?0\267~Z\250\351\346\255\306\021\321\315)4lu"
+	.string	"\017(\177K\b\337\235\334+x1-\373\377Z\214\220\323l\213\275\203\217z\332\032\204a\300e\254\241\324|\tu\243!\262\007\230\031H\261,\234\362\237\300\243\275\316;\342\270]\013\232Y\211;\210\345\003N.\245P\360\376\265\254\030c"
+	.string	"\307\221\356YY1\376\003\354\322\377\260\303\241\336\233.\212\247\236\232\032\331\370\357\200n\202\223\333\332\224\203e+Ac\215)\316Jn\205\340\250\314\226\365\3301PLn\263c:S\025\016\250\361\333"
+	.ascii	"\t\355\376\270[\017R\364\223\036w\023W<\022\003\007\243\026;"
+	.ascii	"\032J`\206\234\216\352\311\\@\224\221$E\225|\263\350\312h\314"
+	.ascii	"X\035Zw\221\\v\226y\233u\"\306\326IJ\304{\344\375<y\372B\210"
+	.ascii	"\326\312\231\373\202\273(\372P\300\323+\234\2731\003\013\263"
+	.ascii	"s\341\262\331\022[5\331\354\372\205\033\253Y3\3359~\367\002\213"
+	.ascii	"D\252Yf\227\310\342\242-\337}\227g_\231\273^\336h\013]\304\345"
+	.ascii	"\203\216!$\005&\344`y$']\372\374y\024lF77\360\017]\b\021\337"
+	.ascii	"\273v3\276\021\200\315\244\265b\321q\316\035\261C^\303\207cu"
+	.ascii	"\302h\235\354\330\365\024@\305\021Z\3167 1\204P\315/s?\n"
+	.string	"\246\220v\327T\266N'\341\341\\\361]7d\244\373\373\330\365\377\373\221\003_\247\334j\275Z\251\372\231\340>\021\\\026h\323R\026\346\312\262\016E\362\202?L\275K8\220\342\222\020\220$V\210\211\357k~\340\251\n\025\021/\366nd\026\006\345>\227M\005 \177\245\243`\0028+\027]\t[IW\360\345O>=S\322\027\023\302\006BNaK/\023=2\024\254\031\323\373\030P\256d&\251\342\377\267_\253\250\231\251J\006\203}\2242\245\377\314d\nn\022U8a@{\222\350\032/\2201*\246\330\300\217a\036\273p/E*h\326\327\246[4\215?z2\374\3476\036\023\220c$p\027^D\222\3471\226/\366S\355\367\317\177An\264j\303\357*sVKY7|[n\034\251\206\236\220\274\317>.\f`\021\250\360\r\201\230\"UE\270Y\"\227E7\177>sp\342\360,\360 \360\310\212"
+	.ascii	"DP\263\341z\314v\231\0251\030\343\023\207\326\341\025\226\314"
+	.ascii	"0<\332g\237\271n9+C\257D\370mH  \344G\342\020>\330\220}\275\364"
+	.ascii	"$\203\007+\325++5\320\365\207\016\246:j\343\341x\371\374\233"
+	.ascii	"\352<\f|\227w\034\247dX\2201 S\330\006.\302\206.+Un!\363v\322"
+	.ascii	"3\220\334X\226AK\220\274Gca5l\3761\336\b\224\300\274\231\322"
+	.ascii	"\027\236\256<z\352\036\306gE4g\345R\347\250\2528}\b\333\035l"
+	.ascii	"L\275\017pb\225)FI\200x\312p\375xy[q7\245C\r\272]\210\t8h\035"
+	.ascii	"\016\240\023v\223_C\306\276\3516:"
+	.string	"X\031\024\021\205\322ugh\377\213!\245.\314\371bc\251\372\006\177,5\344h\266\001gN\374\035\217\254\307a\301O ,'\\\002\316\235\316\355\244\027\236\264\371\303\231\373\252m\227\276\037\222\r\253\3378k@\244\267\374\177\373\241\353VM\267\313\330\302\337\252\324h$ql\n\370\351a8r]N\372;\343\222\020^@\222\007ur\016\235\360\260\347\034^"
+	.ascii	"3\327\3321\223\321\035\034\265}r\277\256M/\356\251\t\032\032"
+	.ascii	"\211\311\317\373G\3675\261\f\253\324\177\245U7\331\325\272\362"
+	.ascii	"\316\007\333y\226\370\352!\355\f\262x\377\343}\244\376\367\307"
+	.ascii	"r-\373\232\370\034\312\375\256\372\351}\"\313\340E\307\343|\202"
+	.ascii	"\271\346M\216\317\226\377\245\006;\220k\341v"
+	.string	"-x\362\342\277\342\177L\276\266\023{J\361\250\306\315ZgC\303\277\026Y/t\377\340\321W\376eN\341z\315Q\373\313\274\215\367\232\372\310\366C\272j\\\315\366g\237(\200>\244L.\204{!f\001\362\323Smj\277f\377A\257\376\211\277\217/\215\241_\224\277;\306\236\373\336\034\325\337\356\035\307OP\375I\337\020\317<\373{\357\201'\352#\217\306\322yj\311o\310\265\372\201\3636\317\221/\220\200\023\320\177\017\304J\nK\030\351\334\3536f\362&\273\006\342\330\343\306T\217 t\200\255\340~t\306\020\314\364\030\202\267\032\236\303\366\213\304#\304\262\262gt\3242\341\225\307\013\374\177\271?\245\366\221\231\372F\330\2108\354T\242\177\t\035/\303\355\357'\020<\377\370S\304I\n\356\270|\201\006?\355\213\356k\226\334\272q\271\267\313\207\372\237\354\217R\347\211.W-\274\330\0347\351\322E\334\246\332\331"
+	.ascii	"V\032\347c\231\333i\376\231<&\344\037\270u\021\377\315\377\267"
+	.ascii	"5 &h.\223l\027=\210\234\360\036\244\264U\347\006#/\342\370\216"
+	.ascii	"\320\203\b\307\241\363\225\246\333vg\304f:<\013\275m\274\341"
+	.ascii	"\n\275\247\334'\347\235\035\347lti1<\317\330k\350%\334\217\025"
+	.ascii	"\205\274\002\356@0\207as\217\037\033u\317>a-\226\234\"\235\212"
+	.ascii	"\375\023\2237\331\r%3L\316\361\255\3070\007d\204\337}m\362H\330"
+	.ascii	"\323\3775\207V\304\340\313\317\272'\374r\236\025\246\252\023"
+	.ascii	"\266\370&\276\367\210\352\303\030\250\356$<\230\335;dv\221I\267"
+	.ascii	"xn#\342R\305\303\370\334}\370\307\262;\346\312DB|^\f\017\316"
+	.ascii	"\344/\220\361V{\202\rdG\355\226\034d\245\342\b\270K\327\007\332"
+	.ascii	"\314\376\001"
+	.text
+	.section	.gnu.lto_.symtab.ff99915cc0d4390a,"e",@progbits
+	.string	"applyBetaflightRates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\002"
+	.string	""
+	.string	"applyRaceFlightRates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\002"
+	.string	""
+	.string	"applyKissRates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	""
+	.string	"applyQuickRates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\003"
+	.string	""
+	.string	"applyActualRates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\003"
+	.string	""
+	.string	"interpolationChannels"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\003"
+	.string	""
+	.string	"getRcFrameNumber"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\003"
+	.string	""
+	.string	"getSetpointRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\003"
+	.string	""
+	.string	"getRcDeflection"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\003"
+	.string	""
+	.string	"getRcDeflectionAbs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\003"
+	.string	""
+	.string	"getThrottlePIDAttenuation"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\003"
+	.string	""
+	.string	"getRawSetpoint"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\003"
+	.string	""
+	.string	"getRawDeflection"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\003"
+	.string	""
+	.string	"applyCurve"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\003"
+	.string	""
+	.string	"getRcCurveSlope"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\003"
+	.string	""
+	.string	"updateRcRefreshRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\003"
+	.string	""
+	.string	"getCurrentRxRefreshRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\003"
+	.string	""
+	.string	"calcRcSmoothingCutoff"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\003"
+	.string	""
+	.string	"rcSmoothingSetFilterCutoffs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\003"
+	.string	""
+	.string	"rcSmoothingResetAccumulation"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\003"
+	.string	""
+	.string	"rcSmoothingAutoCalculate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\003"
+	.string	""
+	.string	"processRcCommand"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\003"
+	.string	""
+	.string	"updateRcCommands"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\002"
+	.string	""
+	.string	"resetYawAxis"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\003"
+	.string	""
+	.string	"isMotorsReversed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\003"
+	.string	""
+	.string	"initRcProcessing"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\003"
+	.string	""
+	.string	"rcSmoothingIsEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\003"
+	.string	""
+	.string	"getRcSmoothingData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\003"
+	.string	""
+	.string	"rcSmoothingInitializationComplete"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\003"
+	.string	""
+	.string	"currentControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\002"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\003"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\003"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\003"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\003"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\003"
+	.string	""
+	.string	"targetPidLooptime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\003"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\003"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\003"
+	.string	""
+	.string	"rcControlsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\003"
+	.string	""
+	.string	"flight3DConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\003"
+	.string	""
+	.string	"powerf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\003"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\003"
+	.string	""
+	.string	"pidSetItermAccelerator"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\003"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\003"
+	.string	""
+	.string	"rxGetRefreshRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\003"
+	.string	""
+	.string	"sin_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\003"
+	.string	""
+	.string	"cos_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\003"
+	.string	""
+	.string	"rxGetFrameDelta"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\003"
+	.string	""
+	.string	"pidUpdateSetpointDerivativeLpf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\003"
+	.string	""
+	.string	"pidInitSetpointDerivativeLpf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\003"
+	.string	""
+	.string	"biquadFilterUpdateLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\003"
+	.string	""
+	.string	"biquadFilterInitLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\003"
+	.string	""
+	.string	"pt1FilterUpdateCutoff"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	"pt1FilterGain"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\004"
+	.string	""
+	.string	"pt1FilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\004"
+	.string	""
+	.string	"biquadFilterApplyDF1"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\004"
+	.string	""
+	.string	"pt1FilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\004"
+	.string	""
+	.string	"rxIsReceivingSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\004"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\004"
+	.string	""
+	.string	"sqrtf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\004"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \004"
+	.string	""
+	.string	"pidAntiGravityEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\004"
+	.string	""
+	.string	"imuQuaternionHeadfreeTransformVectorEarthToBody"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\004"
+	.string	""
+	.string	"qMultiply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\004"
+	.string	""
+	.string	"qConstruct"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\004"
+	.string	""
+	.string	"failsafeIsActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\004"
+	.string	""
+	.string	"getLowVoltageCutoff"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\004"
+	.string	""
+	.string	"initYawSpinRecovery"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\004"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.ff99915cc0d4390a,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1322 @@
+	.file	"rc_adjustments.c"
+	.section	.gnu.lto_.profile.929ba6eeb7fe4f04,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.929ba6eeb7fe4f04,"e",@progbits
+	.string	"(\265/\375`\256\002=\t"
+	.string	"$\n\242\003"
+	.string	"\022"
+	.string	"\331\226\256\205\n\036\002"
+	.string	"\001\003\004\005\002\005\001\353\252\315\223\t\002\240\342\234\212\n\003\004\354\275\370\376\b\005\006\007\243\274\344\244\007\b\002\006\002\007\002"
+	.string	"\002\007\002\b\002\007\b\310\344\367\032\236\001\002\006\002\t\n\013\002\013\002\006\002\f\r\002\f\013\206\220\305\255\r(\016\002\017\002\r\002\020\002"
+	.string	"\002"
+	.string	"\016\211\220\223\261\013r\r\r\017\242\270\255\365\003\020\207\260\202\016*\006\002\021\002\022\001\022"
+	.string	"\002"
+	.string	"\022\341\276\210\271\001\002\023\206\271\335\257\r\024\313\331\240\372\b\025\321\316\352\310\n\026\240\342\234\212\n"
+	.string	"= p\202c3\252\016H1\005\336\n0+Av"
+	.string	"\3631\263\314?d\004\025\261\344\200n"
+	.string	"\034\223\201\273l\245(\200)\f\254\262*\177\323\360=bU$q\001\001\177Mhc\203\013\204\336\t\220\271\306\302\300!\013K\260"
+	.string	"\b\302?\211\r\260\365\3026"
+	.ascii	"\006\2763@\272f\025\303\214a\017\034\231\007\0028\007\007\177"
+	.ascii	"\234\300\272&\317\274\233~\267\020\2338\305\310wC\276H\364\346"
+	.ascii	"n\212\005 \337\314\250\270C"
+	.text
+	.section	.gnu.lto_.ipa_sra.929ba6eeb7fe4f04,"e",@progbits
+	.string	"(\265/\375`5"
+	.string	"E\003"
+	.string	"4\003)\001"
+	.string	"\t"
+	.string	""
+	.string	"\001\007\002\001"
+	.string	"\001\b\003"
+	.string	"\003"
+	.string	"\001\013\002"
+	.string	"\020"
+	.string	"\007\001\001\001"
+	.string	"\001\003\001\200\004\001"
+	.string	""
+	.string	"\b\016\017"
+	.string	"\020\001"
+	.string	"\022\001\002\b\023"
+	.string	"\001"
+	.string	"\025"
+	.string	"X\004 \263\302\225\271\341\252\214\255\035\0013\340\017"
+	.string	"\003[\2232\bM\320n@\022\034\345Va\r\030&\202U\316\231\001\242"
+	.ascii	"\003\260#\346\032\032\030\002"
+	.text
+	.section	.gnu.lto_.inline.929ba6eeb7fe4f04,"e",@progbits
+	.string	"(\265/\375`\265\n\325\""
+	.string	"\346\352\214G\340\360&\035\360C\321\227J\236\303\202\036\216\340'\002\354K+\353KR\r\327\272\324\274Lf\320\024\356F\222\250PD\237x\323\334\343e7\301C8x+\004!\224\346\tr\036\031\f\033\177\266ts\327N z\357$S|"
+	.string	"v"
+	.string	"y"
+	.ascii	"\234\213\024\225n\304\026\214\254\325j)6\033\302\307\335\255"
+	.ascii	"pb{\006L\n\020\030  \300\213d\304\325\002\320\211\260BT)\020"
+	.ascii	"\356c\363\230\362\252\f6\222\333\250\215@G.\341&\326\231\003"
+	.ascii	"\t\241\210\361#sj{%\355\230\334\335\335n\333u\225\271\270\273"
+	.ascii	" \253\017\265\264\0352m\265YDi+\313\343~\354\273\273\263\331"
+	.ascii	"5r\303\b!\037\225\333\032A~x\342`\224 e\020\253@\0043\200\242"
+	.ascii	"\206|d\225YD\325;or+a\347}g\021\355\247\244\244\354\316\374n"
+	.ascii	"w6\352\270+\372\337\256\350\331\363|\317r\307\227\203H;~X\276"
+	.ascii	"\224;>xO\221\216\275u\307Q\327\352+\n\270F\001=\301\225p\275"
+	.ascii	"\022\232\013\255\342\314\335\254[w\336\332\373\326\337O\274P"
+	.ascii	"\341\304\362\337\362\245\034\236\275\267p{\371P\213'\243\226"
+	.ascii	"\037>\264!\203\350\347e\316\001;\353\374\256sGkQ\353Hs\2219A"
+	.ascii	"NN*\377\243\321\374\321\\N\004\325\024%\342\177\376\367\371s"
+	.ascii	"Kv\331\3722s\016t\027\246\262\224\n*\270;\347\316\335\245pbk"
+	.ascii	"\223\272\274\006\233\3536j\002\005\356\334\234\307,\337!\323"
+	.ascii	")\345\254\252s\346f\256\343\302\004\216\212;\307H\243\034L\""
+	.ascii	"&\206\315\246\271R\255\004\222\202i\373uM\322\327'\350\202\355"
+	.ascii	"u\033\225\326\232\007\206\371cr\332e;&u\353\350(e\350\334ZIi"
+	.ascii	"\032\031\202E\317\n\365p\027]\230\3350\rw\236+\257^\344L\003"
+	.ascii	"\023\317\364\364<a'J\252\005\335\323\023\346=5|\306T\3548\226"
+	.ascii	"`,\275\314y\346\\\216\344\203D\"\366U\270\331\026vWf\223\\\265"
+	.ascii	"\304\323*\363\016#N\316\001\213\204\335e-\031\327y\252\240\004"
+	.ascii	"\347\374]\262\033r\342\356>\204\301`\2733\317\3636\201J\250\301"
+	.ascii	"\271\"\022\021I\nR\220\264\006\201\005FA\305\220\215\017\022"
+	.ascii	"`\345D\307RQ\335&\303\376\177\006\210\327\031\220\214\227\230"
+	.ascii	"\272\236D\331#\304\335\317\346\306Q\001i*\217\263\272\320\r\225"
+	.ascii	"\\\353@\213cf\221j\375j\277\256\353T\367\331\341u_Q\250\246\331"
+	.ascii	"\3049\366iJU+\351yA\263\nL\ny\036\033\3266IX\342\247W\375tO\202"
+	.ascii	"\fjNmT\002\266\226\035\237\244\r#\242E9/\2277\253&\322\340\213"
+	.ascii	"^.>~Zd\325\300mf6\337\024!\375\017\314\344*\355x\307\034\224"
+	.ascii	"\272\244)\037O\365\232=\0064\264$Q\352\263\244Y\340\346\342\337"
+	.ascii	"\347\373\220\350\223\320\363a\372\342my\220\340\226\357\260\273"
+	.ascii	"\020 \364rF\262_\030\371`pDc\320~H\"\375Q\357\034\372n\033\363"
+	.ascii	"\341\303\252\033\206\360\317\211\205\366\032|\266\325W\"\302"
+	.ascii	"\215`<\352<c\005\276`Y\303#\226\034\033\003\355n\017|\024\310"
+	.ascii	"\250\226\035\307~b\226\027\037H\351\243\262\376\363ZT+\310\""
+	.ascii	"\207\266\375\254\016*\334U\261\004\273+t`v\207\n\307\352X\301"
+	.ascii	".\025;\230]B\207\263\342\022\260\026\031O\325g\215\307>\316\367"
+	.ascii	"\"K\321%G\365\301C3\215r?p\216\302\3441\273RJ\020\216\022\347"
+	.ascii	"l*\n\232\3141\307d\306\023\342\325\005h\034\\\303\3231r\273\205"
+	.ascii	"\005\217#\226)\307a;p[\244f\274l\300\203\222dT\241\2037f\006"
+	.ascii	"o\245\004\271Y\325c\231\217\243@\305\206R\217\230gVu\320\374"
+	.ascii	"\344\202Pu\372\025\307x1\372\2258\020\357K\250$|\337y\217\204"
+	.ascii	"\261etG\310 \252\215\371\203\320\374\232Q\006%+\365\037\230\264"
+	.ascii	"z\257\253\234G\035\353A\363\250\343\034|\203 \234\201\267\236"
+	.ascii	"fa\001\254{\334\252\006H \311\3156\254\256\005\256!\371\241R"
+	.ascii	"O,r\231\034;\313\343\352\367\3656\270\267\301\275\r\356mpo\203"
+	.ascii	"{\033\334\333\340\336\006w\266N]\201\342\221~\221LC\227>\375"
+	.ascii	"a^\240U\017"
+	.text
+	.section	.gnu.lto_.jmpfuncs.929ba6eeb7fe4f04,"e",@progbits
+	.string	"(\265/\375`\323\007\005\021"
+	.string	"\206\024G<@i\234\306.\212\324\376\"]\\\331F~m\344\027\360\265\341\320\240\3600\f\303\203\305\351[\324\3030\314\335\021\003\363]\207\261\201\355\177\340\277A\037\335$K\3136*\375XlD&\031/"
+	.string	"6"
+	.string	"5"
+	.string	"\017\337>W\275}\365\272\216\210;y;\267\235\362\227\341\214Wu\315U\265J\210;\306_<\347\304\347\304];;\201\372\004\256\032U\225\322\307'\016\207\224\232\226e\333\026\211p\034E]U\203\266\254\303\273\356r\031\300\030\214\024i\336e&\243\023\326Q\334\204K$K\304\235\270\235\335Nj\247\303/=&v\210x\004@[\237w\352\006\\\004`\002\234\331x\2157L\347v*\366y\370\234\3466\214\375Z\273%\276%\356\322;\231l\276\017T\n\005\\+\225A\225\244\353\3020O\252\272\251\352OK\355\356k\241~\301\242\002\205\005\n!\031\206!\265\231\006\002\361\274\b\235\234@\370\036l(\016@\255\214V\251\301\305"
+	.ascii	"[\340q(\220\"-A\206`;\0201\300\025\240B\240\253\200\265\250\261"
+	.ascii	"\2707R\220\242R\032\003P\243\224$\017\021\220<j\224A\"\201\310"
+	.ascii	"\305\2212\r\347\300\027b\210\003I\272IH?\200TzX\020\324\200t"
+	.ascii	"\375o\270\264\263\351~Y\307?\242\254\026\275&P\241\030p\021\315"
+	.ascii	"118\275\277\342\223a2<\234c\260L2\032m\006A\304\310j&\263[\256"
+	.ascii	"\002\372\273t\360\221[\227\264\222K'\274d\331 cV\252\030Sv\303"
+	.ascii	"\022\354o\221\352\227\255\335 7\316\314\270\025\310M\331\214"
+	.ascii	"\226\t:\242\367=\341{\261\365\346\21532\312\212\205\205\213%"
+	.ascii	"\300\001\372\005\332\342a\351\036S\220K\200\003\323mQ\3638\f"
+	.ascii	"r\304\265\3367nE\260\023\307Bq\352\343\001\365@\337\250a\320"
+	.ascii	"\0379\204\372Q\205\321Y?\264R\373\316\240\312w\302\354j\316M"
+	.ascii	"K\213\232\230F\361\016\273\026\2404\376\321\357\013$\231i\362"
+	.ascii	"\031S\025\276\217\265\004\370\007,\214%*\322\023\251\267\220"
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_.pureconst.929ba6eeb7fe4f04,"e",@progbits
+	.string	"(\265/\375  \001\001"
+	.string	"\034"
+	.string	""
+	.string	""
+	.string	"\t"
+	.ascii	"\232\004\007\230\004\b\232\004\013\232\004\016\232\004\017\232"
+	.ascii	"\004\020\232\004\022\230\004\023\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.929ba6eeb7fe4f04,"e",@progbits
+	.string	"(\265/\375`\315"
+	.string	"\r\007"
+	.string	"\202\213$+pK3\034\220u\256\372\213\365\364\340"
+	.string	"\305\001\340@\016\374\321\037\254\001\305O\017\212>\327\377\337\t\351\032\252V\320^\322\254\335R\246W\020\330C\344\352\252.\314Aq^8\236\204\305G\366*~\213\003\245\360\240\312\251N\006\205\002\263\005\264\2435\316\306\233xo.\224+t&\224#$\177\222a\025\340\373<\350d\312\231N\203:\347\346\220[c\336\340\240y{^P\310\021\315\255\020d\027\317\251|\352\224\312\245\266\347S\376tF\345Q\373r\363\304\b\037"
+	.string	"@\005X\030\366D}\320Yvz\016\273\205\252\013\250\366\001<\300\007\0230\366\335\221\221I\335}L\033\200\017\253\305\fF\232\3028\203\231\321U\t\353\214X[\230\027\031\t"
+	.string	"S>T\020\372T\024\2602\334k[>\200\3250"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_.lto.929ba6eeb7fe4f04,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_adjustmentRanges_Registry.74.929ba6eeb7fe4f04,"e",@progbits
+	.string	"(\265/\375 \227u\004"
+	.string	"\004\b^"
+	.string	""
+	.string	""
+	.string	"-"
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\203\305\321\035\006yw\250\306\006yu"
+	.string	"\005\001\006'\001\254\002\005\001\006\035\001\036\245\300"
+	.string	"8sq\301\001o\300\001m\277\001k\276\001i\275\001g\274\001e\273\001"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/fc/rc_adjustments.c"
+	.string	"\004"
+	.string	"D\210\021\346\r\240I\310"
+	.ascii	"\340"
+	.text
+	.section	.gnu.lto_defaultAdjustmentConfigs.81.929ba6eeb7fe4f04,"e",@progbits
+	.string	"(\265/\375`L\004\315\r"
+	.string	"\224\023?\005"
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\003\005\001?\202\210\200\b\177}\273\001\005\001\006{\001y\001\"\030wu\276\001s\275\001q\274\025\001\035y\001!\302\301\034\001o\305"
+	.ascii	" \310"
+	.string	"\001s\307\001q\306\033y\001\037\314\313\032\036\320\317\031\007}\323y\030wu\325\324\030\377}\330y\332\331\027\027\336\335\026\026\342\341\025\025\346\345\024\024\352\351\023\023\356\355\022\022\362\361\021\021\366\365\020\020\372\371\017\017\376\375\016\016\202\002\201\002\r\r\206\002\205\002\f\f\212\002\211\002\013\013\216\002\215\002\n\n\222\002\221\002\t\t\226\002\225\002\b\231\230\007\007\235\234\006\006\241\240\005\005\245\244\004\004\251\250\003\003\255\254\002\002\261\260\001\264\263\002\360\003m3\265\0024\262\002\257\002\256\002\253\002\252\002\247\002\246\002\243\002\242\002\237\002\236\002\233\002\232\0025\227\002\224\002\223\002\220\002\217\002\214\002\213\002\210\002\207\002\204\002\203\002\200\002\377\001\374\001\373\001\370\001\367\001\364\001\363\001\360\001\357\001\354\001\353\001\350\001\347\001\344\001\343\001\340\001\337\001\334\001\333\001\327\001\326\001\322\001\321\001\316\001\315\001\312\001\311\001\304\001\303\001\300\001\277\001"
+	.string	"\200\201\250A\3048\205,\373\006\200\2234\315\001\020 \350d2\353\0015\350\263\242k4"
+	.ascii	"r\352U!\245C\272\231\004xgm\rDd{\215\215\201\223\210|\340\201"
+	.ascii	"\230\357G]u\200@\330\256\020@\233C \307\022\001\352O\306 \300"
+	.ascii	"\033\006\333[_H\343\215\330\260 \324\266\215\271\206]\322\306"
+	.ascii	"\273\313\016\216\202\314\262d_\357\243\035\303\253\326\375Sn"
+	.ascii	"b\031N\374\"\237\243\024\315\227\257D\240\002"
+	.text
+	.section	.gnu.lto_applyStepAdjustment.82.929ba6eeb7fe4f04,"e",@progbits
+	.string	"(\265/\375`62=\217"
+	.string	"\n\345@2I P[\031\016&\315\307\230\024\312\264TH%m\244k\004@=\252"
+	.string	"uQ\2249C\355\021_;??\030\002\215T!"
+	.ascii	"\020\212\323\362N\367[\272(\362\216&\233G\016Ui)`=k\312jB\211"
+	.ascii	"\255\207\220\275w\222R\006\031\003\307\002\031\003+C\355\215"
+	.ascii	"\361^\030\357]z\357\013\265\327E\261\267\205\332\313\342\275"
+	.ascii	"+\336\253\244\366\252P{S\2747\351\275(\324\336\023j\257\211\367"
+	.ascii	"\226x/\t\265w\204\332\213\364^\021\357\r\241\366\202P{\217\336"
+	.ascii	"k\364\336\"\265\367\203\332K\364^\017\357\035R{;\250\275\034"
+	.ascii	"\336k|oQ\355U\325\336\364\275\350{\257\3666\017Ba\006\217\021"
+	.ascii	"\272u\375J$\264\336I\341\274\300N\346]>\333[f\221\263,\363\273"
+	.ascii	"\322G\306\307\320\312\237\241\230\r*\f.\303\004}\0052\364\242"
+	.ascii	"Rh\3315\207\270\334r\032j5\r\243\324\265\222M_\335%\272A\344"
+	.ascii	"\273a\357\320o)\250o\031H\260\006>\200\006\r\007\237\206\177"
+	.ascii	"\b-\375\bZ\006\212\0252\344\323D4\334\323\\\352\231[\342\241"
+	.ascii	"3\354s\032\362\265\251S7\007O\316\035\236\235e\034\276\245\235"
+	.ascii	"\237\233>6\\\367\204\325\354\253\360y\262;$\003\257\331\035Z"
+	.ascii	"\022X\315\246\316\277\345\272\256C$\354\016q\332\264\233\\\246"
+	.ascii	"\333\241\335u.\236\361\n\314\350\364\362\205p]W&N\367h|\363\334"
+	.ascii	"\342\241F+\026\027\2757\353\272:\355\003\357\335\033:\222\234"
+	.ascii	"\006\311F\253R\217\332\020\356]~c\270$\307\231\300G\353\332\345"
+	.ascii	"\317\233u\215s\332'#\247\033g\334\335e76\223\334\305C\343\324"
+	.ascii	"\302\212[Y\264\232\206\353\272B\255`$\225S\224C\250\234\236\005"
+	.ascii	"N\362\322\255s\233;\267r\233f\321l\234\020\251 @~\370\350\301"
+	.ascii	"cG\224\216\0348n\330\250\001\365\344\324\304Dc"
+	.string	"\206\214\0300\226^\270h\301b\205\222\212\024I(N\230(Ab\004\222\210\020 \216\214\212>\020y\030\352\300\301XTS\364\235\\^\376\031\344\n\273\342\245s\246\300\333L\241\316\253wN\256\2137M\227\035W/\232\215C\251l\341\202\002\013I\332\242D\001/\261\245\n\005Ad \210s\b\365\017\037\203\270\307 \276\303\346\261c\220\243\006\361<[G\016A\306!\310{\374\364\r\033\201\\#0\020\260\241\236\354\260\223\235?|\335\264\307T\207i\324a@tz\206\f=\216\241\307\201\3344\2146Ku\374\242\216\017\331\264\213\026k\230\305\032F\224\241W\250Q\202c\025pWo\235\"\311\f\2430\023\305\255O\230`r\t\346\326\262I\2740\"\f#\205\361r\241E\204h\201A\264\020\366\245\217\214\324\270HM,K\1770#*c\017edXz\310\305\027w`\261e\312\n\314\201\363\200\255P\306,`"
+	.ascii	"#k#J\303l\217\n\347\001\033C\221\320*[\224_]\264\302*J\203\320"
+	.ascii	"\256\360C\230\026\212\364\025\206\253\317\262:\335*d6&\345\006"
+	.ascii	"\303\2756j^\370\323\247o\316\fg\312\200\361\302[\300\256t\b\213"
+	.ascii	"\242\266_\2253\021[\224_$P*|\364\204\331\036\225\017aJt\t\017"
+	.ascii	"\027A\246\343\356\n\303\352.\016Y\327u\233+l\no\001\274\233n"
+	.ascii	"\331\335\022v\235<\004\031L5sM\251\234r\326\231^\204\314\316"
+	.ascii	"\274\245GD.\021J\301\\4@I{z\246c\246;9r|\350\232\230\t\317i\337"
+	.ascii	"\316*\344D\364L\370\316\302h\0310j\230,8mPv\342\236\360\037}"
+	.ascii	"\357\3112S\376\177 \255BP:\261\251\017\221R\200\353\272\362\330"
+	.ascii	"\245jC$\306u]\2438\335\026dB\036\017\242\324\300\230\240r\332"
+	.ascii	"/\272\223\303\204\003\245\023\267\321\030\204\336\235\253F\334"
+	.ascii	"\021g0\240\220\036m\373M\314bU\272y\361\324'\357\352\032\266"
+	.ascii	"mX\361F\270\rh\237\352\236\322s\237\252\033=\025~\266\005\367"
+	.ascii	"\211>\365\222\002\367\211\376\215\241`\244\372\267\315g\237h"
+	.ascii	"\337\330\t\277}\242yz&\030\251\342\331\316Cb\006;\333}#\314\352"
+	.ascii	"l\357!\221\255\255Z\364\266\347\3543-\324\023\201\267\235\267"
+	.ascii	"\317\224\317X\b8\333q\366\231\312\321\003\361f\237\351s\354\210"
+	.ascii	"\221j\233}\246v\214\030\251\262\331g\332\246\210\221\252\f\333"
+	.ascii	"k\366\2316\307>\320\355\023%\244G\304Hun\2739\344%\005\315v\232"
+	.ascii	"\016\211o\333p\034\006\271m\2331\326Yn3\213f\330\266\333T,0l"
+	.ascii	"\217I\273\276^\330^C\r\301l\273\360>^\266\277\364\fk\253\226"
+	.ascii	"\264m\026\366idF\252\234ns\255[`\326\372\251\n\216\255\353\025"
+	.ascii	"\233\355\263\271\326\031\234\262\362"
+	.string	"\375Ep\205\353B;\324O\276\033\302\222f\256]\201\365+\024=Z\263] <Z\376.\313\304'<EcA\316\016V\017\332\215S\366\321v\031]\337e\227\360)\330\007\360\317/\317\035;{t\364\362\360\340\336\316\230q+\303\\\222ic\033\263\366E-\r\215\313\231\0263,W\310\254\210Q\231\002\366\305q\314\234\202\224\256\367\362\326{YK\355\345\254\3672\026\247af\345{y}o\222\347\230Ox\357\023v\362Z\251\275N\336\333\344\275#\274W\004\265\267\252\330\313\304\330\273\344\275J\336\033\302{A0\366&)\366~`\354\365\340\275\035\274\027\311{90\366R\025{70\366N\275W\203\367f\360^\f\214\275\027\024{-P{+x/\005\357=\252\275\023\250\275\022\274\367\310{#x/\004j\357\003\305^\007\324\336\006\336\313\300{\027x\257\002jo\002\305^\004\324\336\003\336k\344\275\006\274\267"
+	.string	"\265\227\200b\357"
+	.string	"j\257"
+	.ascii	"\357-\362^\"\357\r@\355\005\240\330;D\355\025\362^\251\367\006"
+	.ascii	"y/\020\265\367G\261\327\207\332\333\343\275<\336\273\343\275"
+	.ascii	"Qj\257\216bo\016\265\027\307{o\274\327\306{k\250\275P\305\336"
+	.ascii	"'\265\327\351\275M\357ez/\r\265wF\261\003{D\313\260\264\235\001"
+	.ascii	"\t\371\n(\031:\306\245u!\203J\255 g\275\363 \220\007\371q c\320"
+	.ascii	"*\250\030J\205\353\007:\305\307\211\232\317\3032nk3dl=D\240\030"
+	.ascii	"l\201\366\210\246\200z\261\235\003\365x\027\312\205nU\331z\017"
+	.ascii	"A\345\326\2163\235s\rQ\337\241\343Ql\250\026\232\205F\251\242"
+	.ascii	"\003U\3468Q\223\317\341\035\214:\032\316\226\244\334\210\017"
+	.ascii	"_\214\341\303=>\261\320\230\363!\216\023B:\3350h\213\224\343"
+	.ascii	"\300\353\223b\343\274w\026T\3436\240^\203\355\206\202\n\267@"
+	.ascii	"\331\360t\242f\037s\214\f\2318\027-\300\016\202\021Y\2541\342"
+	.ascii	"\036O8\270vFt\372\203l\022L2\225\374\200\335\211\251\271'\007"
+	.ascii	"F\207\231\316v\3167\3208\323\214\323\bDr\023\020\220O\230\031"
+	.ascii	"\347f\340\036\031'j\3561\307\354V\314\320\007\215\322\224\027"
+	.ascii	"]\251\370r\265\307\343\271\363\345}\025\343v\220N|I\246\322^"
+	.ascii	"\f<7rSX\315\322\371\3169\361\305\227\\\374E\222\314\347 \331"
+	.ascii	"\251\246\227d\002I\272]N\362\314\363\222e\222p#\250\234\2728"
+	.ascii	";\275\274Ay\234\337\215\260\ff\001 BD\345\264\305\211\232n\230"
+	.ascii	"c1\214\211K\221$\3664\n\n\265({\274\2336j\357(,\316f\006\261"
+	.ascii	"\263@c#\227\347,\266\342\234\347\255T\372\n\025W\352\302\313"
+	.ascii	"\240F\305\213\330\3300\341\210\021Cx\302\204\225\177\330*\201"
+	.ascii	"\266\265\307\317\311\241\275\267R\034M\234\225"
+	.string	"\247`s*\375\316V\222\316~o-\024O:q\024o\310 gN\274\210\255\251\206\204\023n\004\331\211\274\220\264x\355\361\314\245\226\267\227\211\267!_\260\231\230C\374;\223\2258\377\275\273H\274\304\210\223\030\203\f\"\300a\030\361\242\030\020\231p\302dYE\204\300\362\207\201\270\022\266\307\207q!,\251w\r8\300C\234:w\224\277Z\244\177\301r\244\031w\205J\3003\026\021g\300\367W\210\213"
+	.ascii	"\361\020\t\\\ri\004q\242\271@\207o-\224i922{\222X\021\025\261"
+	.ascii	"=\276\013\027*o\261\243\237i9\272\033\224\353s6\273\nlt\356\363"
+	.ascii	"V"
+	.string	"\241\350F\037^d\206\224*\373\360\242\271Af\237\017\200mWDgGA\346\341\213l\217'\033\373z\223\021\275\nrI\354\354Ds|\224L\314\202\347\263\365\363p\026|[\031\272\207\016\037j\372\024\244\224\332\002\017\353\360\242\271\277C8P\324\230\3518\002\262\265C\302\253F\034:Z\007.?Q\346a\214\206>\016G;\024\346\256\262=\336KJ\031\207s}\213\203\237\237\362y\346\322\203\330x~\276\257\024oT_t\272\026R\352YQ\352\213\356\372\016\341@\331\303\374\342\260\320\033\343\321V\017\263\362(O\230\263\032\364\004b\365\240\"\211\346\264\233\340\007\324\355\263\b$H\177\265E0i]\324\243-W\240r\3267\220\353\323g{\374U\005\306u\305\212\332N\374z\301n\373\301\223\223\017\254\246\226@1\251Z\262\244\212\352\004\222'J\246\216\220\200\204\211q\312J\t\022\016R&UI\254\250\230<\031"
+	.string	"\204\007I:`RE\004\211\325\224\003J\252\232X1\251\242:Z\252''VL\220,\261r\362\004\004\016\2462\240j\002E\325\001\024\223$SK\240\250\2328\201zR\332*\021\2204\201\262\252\252j\0025\024\007\205\337e\331K\0353\364\211y\216s"
+	.string	"%g9\205D48\313I\033r\344\214\227\025\304\3109N\232\217\"g\273\274\035<\316vY9\232\316pm6x=\237\371{b\254\263[\036\023k\235\231\2052x\353L\346o\211\245\234\311d\265`\260\363\230?%\236r\036\223\225\304bg1m&\330\3129K\332\b&;\227\265\205`,\347+\177FdyD|v\266R\330\201\271\234\305\210=\213\234v\253w\355\256\225\021P\2357\207\204P\256\334\346\302;\344\211\211\211n\004\f\240\344$\352\004\200\253\333cZ\206\005\356\\\347\344+(\271\023\247\264?\274+\031\341\214w^#\302G\250\272\b.\244cH\343\226$\234\261\352\034\322*L>T\370wg\316Z\021\"\032|\205]"
+	.string	"ov{L\247\204\275\235\355\226\374+)\246I-\205\324+\214\006_\322\346\247lr\rBx\223\263\033\020\036B\222\203\220v%\305H\001\246\\\351V\230$\227J\265>\370Pa\337\341\030\rr\356"
+	.string	"0\344\310\225\360\204\234\301\333c\252L\241\2349\343y\360tM\212i\002L,T\346\310=p\362u\360#\350\037F\362\016\316q88\022\252s@()F\210\332\r\203\312P]\210\027\303\r>T\3107(\365GO\013A\214\\\305\034 f\346\354\021\265\241\0063\3479S\007\224\024\343\244F8\3504\362\251\274;\006n\244\350M\006g\340,\007\203gp\30118\277\200\n&\305\b\001\364\223dF\251\365q&\341\240"
+	.string	"/\270\220@\024\320\202\017\025\3361\307\370\356\374\360Q\344H|=\334\370\366\210\372\351q;\363Up<\310\245;E^\201\263NN\352E(\270\324\271\316\361\024L\360#j\007)E\205\362M\360\242\274:&\034:q\300x\354\340\361!<Qe\360\354\021\235\243W\346\214G\202\347\341\335\321\341q\t\350\2247\316#\202\3378\367A\360\b\0368\004p\354\336\320y\240\215\003'r:\017\345\354\342t\344hz\207=8\230{\366\210\256\221\201y\336\323\300\351\234\315\277\2467\3206'\007\343M\013\034\306Y\217\002_ \201+ \227\006\315_\002p\b\234\3109\307\214#\274ac=\207\300\032\313\300=\242ne\226\347\300\003\276D6\221i\243a\375\001l\205\224\311\363j\300\223g>\005\334"
+	.string	"\002^"
+	.string	"\032\003\222\233j\350\030\030N\240\201\200ssm\200\0235\021\317\300i\201z\302\272\210?Nd\376\354\021\005\323\002\231\363\037\001\356\005\331\244\226d*\261\200u\001\232\202\344\260\210\234\363\316~\0028\021"
+	.string	"\036"
+	.string	"\032\332\005\345rB!"
+	.string	"\320\263!'j\n\222\323\344f\320\025\223\326\217\030\020\2156@\001\203\356\250r\2209\2252\245dDD$IA*i\f\322\r\b1\3120\211\254\016\022@\0221\b\307\201T*\006EHS\250\321\030\\\037\216'\240\274\310\303lHz\257\305x\264\205C\274[\030\276H\243\305>\363\366\250DCy\017\277\231$\354\215\002N%\327Z\311H"
+	.string	"@$\307.%\224n\314\211P\034a\233Ps+@\343I\245?\254Q\304\216\217\267}1\375p\334\333\013c\377\353\347\214"
+	.ascii	"\205\202<\303\23615d%\3041\f\032\277\216\360\031\032\252\323"
+	.ascii	"\305k\217\b\217\217\252=\304J\225?\037ZN+\313\0360\225\204\205"
+	.ascii	"\314\035m\256\031S\tz\0046da\346\335f\212\251\362\203\365\310"
+	.ascii	"\203t\341gU\275\200\026Q\006vf\204\370?\246\207\302\363\221\306"
+	.ascii	"y\314\323\267N\255~2\256\370\205\270_\271n\345\203\t\356t\030"
+	.ascii	"\314F\026\262h\226:\fH\354\213\021E\352z\2042\026oQ\366$8\355"
+	.ascii	"\026I\240\347\005YPd1\375\304\350\312\377\016\210\235\262\252"
+	.ascii	"PaJn\021/_\254\317\365\373\315\032\266\020\247\314\0172\271\271"
+	.ascii	"~\306\311\003j\216\016\326\"b~\021\204\345\306%q\320\305\366"
+	.ascii	"\335\371\233\370\235\247\330\343\027C\241T\322\330\013\357\217"
+	.ascii	"M\030\320dF\361\227W\266\221\262k\375\202\336\305\2413\313i\354"
+	.ascii	"\016\266\210\373*\302AC\302\341B\036\t\363U\334V\177t\356\233"
+	.ascii	"\003\201x\264\363\2226\362g\255\275\200vsd\3152Wa\033^#\216\251"
+	.ascii	"\261\232\"6:7#\006\203l\227\233g\034\203m\340\220\271\225?\240"
+	.ascii	"\366\242q\375\312\336ER\r\366nQ\006\020\347\0163\223(z\025\350"
+	.ascii	"1\213\020\027H\210\201P\327\265~\344O\2463\327"
+	.string	"\372\315{5\342\017\337\237\350m\002c\307\020\032\252\360\223\025\201\0254\232\275\341Y\332\370\036\332y\335\020F\246X#\263\311\2152\307;#g\275b\321\f\027R\247\311\271\n\311\"\004a\t\031|\361\227\210k\216\363\252\036b\247\215\326Jks{\254\346l\222I\315\345\330\332\023\203\007m\312\313\322Vow\300\320\023C\027\322\275b\341\007\305A0\205\226\264[_\330\253\tu\207s\305\001\363H\323x\212\300\356K\223\024\207\252\377\277\206\305(\244\352<\302CA\225G\212jB,\004n\324i\t\243\250\355y;e\027\215l\333\005\223\t\375\374\227\250\373m\312\322\r\210l\215f8\001\213=*J\320\375\260O\211\331\272\302\220#\200\306.[\325/\350\315\032z`\267\250\206 Q\226a\370\252\230v\255Nt\032\227\201\004\306\235\336\337\024\230J\260\206\203Rv\233\304\233u 8 \274I\357\217\202\330QH\016"
+	.string	"(\022\344\235K\"\320\344/\275hU"
+	.ascii	"\301\247J\222M\372\3070\255G\366x\342q\326`\021\026\367\207\301"
+	.ascii	"\356\202r\214\206\256\")\001\212\252\376(Y*\272\310\244#"
+	.string	"\244D\025\275\372ov\262\242\034\270[(\002Jt\217Y\321%\263\222\203\250\027UfE3\250\231I\365\277\021U\272\353\257\3543\311\227)hR\245\007\311\204R\215h%h\233UK\272T\221\305\224\215=\243zM^\310\345,\334\371\224\252h\331\026\203\343\200Q;\270\260i\225\350\324\367q\013&[\357xl\037\243\300pq\032\211\211\301\026U\276(\004p\021\211\334z\022?\0367\241\002A\307\267\0035\337\205\271\200\307\021-@\250\005\345sEy\300\314\347\034\354\322:\373\035\270\302\311\317h\362+\236\206\214\324\227\233\003hD\375\216\223\363+!\001 Y"
+	.ascii	"\346+\177\331'%A\f\335\344RhP\324\323\307x\315\313\207\246v\365"
+	.ascii	"\251\336\354|\265\245\357\3348\260\260&\317\035\244\243YL\301"
+	.ascii	"\234?\306!\276hW\214@\307\252\337p\372\373\202\017\366#\313\334"
+	.ascii	"W|\023\361\231N\006\204\0168 \203\365.\f\265\327Q{l\265\307\244"
+	.ascii	"\373\356\325#P\377\352^=M\255O\346\320\313\"0{\251|:If\243\346"
+	.ascii	"06:\324\257w\305\374\225\023.\243\t\371>\236\321\246\342\243"
+	.ascii	"rb\254\312\r0,5\t\307\017\316\332\177CA\223\346\251^\003i\306"
+	.ascii	"\251\234\n\355^\365z\260\362\bR\210\343~u\343\272\206H\220\230"
+	.ascii	"A\302\035\257\032\354Q\300@-]\215\005\376*\351v_I5\2462\f6qW"
+	.ascii	"\260\201\001\\\222\262\277\036\257\307 \306 \215\206p\373tj\235"
+	.ascii	"\207:\002E\236\003Lp\005\324\374T\234\307\352\3574\203\017\233"
+	.ascii	"yU|\"\353z(E\323`\242\0310C\377\272\275\374[\341q{P\260\252#"
+	.ascii	"|2|\353\331&\b\032\005}\330&\206\250Q\323pr\211\240\374\200\270"
+	.ascii	"\313\025\203\227\220yn\215\372\260\211\344\201\312\335p\364\371"
+	.ascii	"\233\365\220 e\273\277\217\360\312\274j\203\334u\203\252\312"
+	.ascii	"\260J\230-]s\214\r\322\202\226\203\317\216SC\274\320\206\377"
+	.ascii	"\r\305\212\325\222\324\375\267\260f\255\352\263\345\017\251c"
+	.ascii	"\343\321\363\332:\254\256\256\355\345\233\247\310A\232\370\251"
+	.ascii	"\003\373\030\302\230^O\324\2278\257\r\317)Ar;x\203\247\277\303"
+	.ascii	"\353\230\370\303\005O\017\354\374=e\017\242\005"
+	.text
+	.section	.gnu.lto_applyAbsoluteAdjustment.83.929ba6eeb7fe4f04,"e",@progbits
+	.string	"(\265/\375`\022(\335p"
+	.string	"\252\271\270(G \214SI\007\337+\n\236\234\177MPw\256\362'\231\366@\240\254,'\241\2537M\226\206\r\r\321#\305\033\001\374\237\256X\305+X\2279[\314\360w4\230U\370\005\274\264\037\006b\017!S@\021\032\331\215H)S\241\002\034\002\201\002|\256\374\3355F\340"
+	.ascii	"v\335AQ*\211\206h\240b\ne\366n\367_\2664\303e\227;"
+	.string	"IK.vZ\352\324\362\224\"\340)\261\344\261rg\211\326GE\217\322\354\317R\312\337\222\314\2202J!%\024A\026[\304a\220\022\007\017[\204\303I\206\205uKIE\274\304e$\275Gy\215\362(\007\357(\005\375,\025\365-\021\001R\032\372\243\f\f\\\016\"\264\004\\\244\004dH\371\227\366\021\334\023\251\017\022_\022q\251B\362p\271gw\247N\211\242h\336\3525Y:w\241\206\327\344W:a\353\374J\357`\351\334\207\332\235R\007\277\322\026\247~\260/\336\225\376\337\235\317\030vf\274\033\223\210\021\212\242+\266\370\n\214]w>\224\352\0210\357\234/s\003\372d\204\023f,\377\013g\343\200\355\334\007\313\204\242n\205xPt\216\352,\214[\374\234\361\3777n\337\200\375|\346\334\033\332iv(\212\335\022E\321*\022\353T\267hn\207\272\305\016\263`{\273\327\235\356s.\347s\bd\035`"
+	.string	"\226\214\002\256b\300\260\"\340\205\213\001ZT\261\240\232Z\241\"\205"
+	.string	"\001"
+	.string	"\200\342\204\224\211\022$\242F\210\b\001\002\352\351\370\301\203SS\007\016L\0334,e\300\240t\301\202\361\254E\263\031\354\273x{CLMR\031Z\330\336\256n\312\236n\212\236\024\376\234\3131\257\264\215@\266\237\013\321&F\266\007\002#\220\205\270\007 \362\035\262\001\206X\223V\306\244=+p\001W\313\215\261\374\033d\030V\202K\200 \340\"~\341\"\321\016\220h\003\021q\213*@\313\002\020\242?L5\345gW\370\021\354\303*\370\244\330\263\002\354\331F~\034"
+	.string	""
+	.ascii	"v\026\205\235\215\244\307'\362\244PX\023(la\035.A\202\316F\321"
+	.ascii	"\331\3038<\002\216\b\271\r!\027\366\206A@\271\331'7P\332\360"
+	.ascii	"\361C\231\365P\206\214\f;\215i\202\333\016pf%0\007&\022v\003"
+	.ascii	"\tho\254aim3\254a\341\302\030V\320\331\026%-{A\213\332\226@s"
+	.ascii	"\226\205-H\231\255\261D[\225\344\236+\350,\311%\nWS\305\232\237"
+	.ascii	"+Khc\246\023\340\b\213\026o\315\264613.bY\323T\301h\217p\t\r"
+	.ascii	"\212\351D\205L\031\263-KA{\302\235h\270e\254\2540\345\223\007"
+	.ascii	"g\214\242C\177wN\210S\212\351\262mgj\027\320\304*\023Jckj\023"
+	.ascii	"3\373\300\347\f\024E\317ehU\366\013\354_\354\340\277\007\277"
+	.ascii	"T\207\253\246\267\372<F\270\211{\276Z\325\253\246\271\313\232"
+	.ascii	"n\340\350\264\ts\007I\214\023\317n\373\031a|\350\201\r\r\b\335"
+	.ascii	"_\316\216\316\217\236\036\023\375H\f\236\031==\036F\t>=BJ\216"
+	.ascii	"\330\257\232\350\254\350\351y'\031\342\220\037\210\375\252\201"
+	.ascii	"\347BOk\242\037\324\240\247UR\362i\277j\2403\340\323\247\273"
+	.ascii	"\344\207\277\363\237\247\307A?\017|\316}\236\036\005\223N}g\277"
+	.ascii	"\247\307\276dS\2363\337\323#\236_\207\275s\nOO\303$\207;~L\373"
+	.ascii	"U\365\236\236\211\033\366\253\242\360\364\034\324\260_\225\316"
+	.ascii	"\371\204\247g\240\337\322\335\323\363/\231a\277*\335\271\356"
+	.ascii	"\351\261\220\237\322\334Y\316\323#\241\344\005\2713\234\247\307"
+	.ascii	"??\013n\316qO\217v\222F6g\345\323\023\361Ts6\341\351\231\372"
+	.ascii	"\3253g4O\317E\311\"\231s\231\247\247\037\263\2043\334\323\223"
+	.ascii	"\317\257\337\316$<=\357\222\374\345\f\346i%\334\375\252[\344"
+	.ascii	"\021\376\247Oy~(\032\266kO\271\fM\261E\252^\021\267\005\215\303"
+	.ascii	"\210\377\234\030\367\227"
+	.string	"\177M\264\335~5h\314\220\201\023\363\006\306\255\315\313\332\226,\311\264+U\316\232\277!4\177\2474\177\313*\177I\345+\251\374$\225\277A\345{U~W\345sU>\222\312\327\240\3623\250\374#\315\337\252|#\315'\322|!\225\257\325\374 \315\007\322\374\037\315\367Q\371\0244\277G\345K\320|\036\225\017A\363w4_G\345;\320\374\034\315\307Q\3717\232o\243\3715\232O\243\362g4?k\347v\rh>V\345\313h\376U\345\307h\276U\363_T\276\213\346\267\330\272\335\252\235\263K\265w\373\023\225/u\362M\030\371%N>\t#?\352\344\2170\362E\234\374\020\225\017\242\362\241N\376S\345\037O\376\207\312\367p\362\235*\277\351\344w\250|\016'\237\251\3627\234|\r\225\277t\3623T>\206\223\257T\371\027N\276\205\3127V\376Y\371\265\362\213\225oV~\327\206[\032\307\226\336\3016\001"
+	.string	"\220\2439\317~#\2418\022\351\310\356\303\347Ho\244\r~}z.\310\321\033\272\030\230G\003\241\265\316\361H\205\023yK\265eJ\233\034)\035\315y\373-4ad\013\217\354=<Fz\013\227\342\332\216^\036\021\035\275\324E\301:\031\002`\253\363\342\245ux\351\225\264\246\004\211\035\315{\373=\214\322\332\303#\033\357N\253\367\020C\335\326\324!\2729\030\330\330\321\030\272\0308\247thM.\331\326;\032M[\357$<#\352\254"
+	.string	"(\202Gs\235=\207\205\240 \354\310\226{CAs\330\205\376\301\344\332\315\026\325[\033\2608Q4ZY\243\331 \261\221\204G_\350\242`\024\304\267\2326!\311\027\3567\030`\240n\321\002\273\211\343eM.\351\326<\350\270\365&\246\001\001\325\243\371\314\236\241<I"
+	.ascii	"\345\3106SF\202f(\306.\241\307\300q\2176\206\021\004\323=\300"
+	.ascii	"4\213\2319~\360\321Lg\317d\036  ;\262\337\302@\320Lv~q\363\321"
+	.ascii	"'\233Bto\355\343\2559\n\236\223\335`\323\217f\273=\233up\300"
+	.ascii	"\354\310f\363\342@\263Y]\333:q\250\201\346\362\243+\336\0371"
+	.ascii	"\375CL\263\2241\034\230\2004\227\260g\264\r7\320\216\354,j7\232"
+	.ascii	"\321\236\370\337\001\001\206?\177\201\304:\354\305\376#\350\264"
+	.ascii	"- ]L\321\247\207\016\256\201\3005S\021\243a)Hs\242=c\3110\003"
+	.ascii	"\313\221m\245\312\214f,\346\031\225 m\366\345\021[\261K\246\203"
+	.ascii	"\364\030\231f+\2100\030*\304\246$\244\331\320\236\325.\310P;"
+	.ascii	"\262\247H\221\321\254\326SM\266\205\342\255G\203 \244\033\017"
+	.ascii	"\217\316L\0139!3\315\"\204\261\320_\214D\232\003\367\314\005"
+	.ascii	"C\322\021\240\263\277\360\341\306\340rd?i\261\030\315\\\230\252"
+	.ascii	"\303\0325TG\207\246\211@\332\252^4\315Z\b\355\236(D\304S\005"
+	.ascii	"-\025\323 8r\036\rB\364\204W(6\361V\263\240=\263U`\001o\331\213"
+	.ascii	"\035v\302\201q3\203T\027-\204.\321\023^\341\314v$\033\0061\242"
+	.ascii	"\350\023\030\347\025x\222\326\207\024\341-+R\267\350\242\231"
+	.ascii	"m\271\215\231\341\232\034\034'\375\177\212\227[(\016\241(z\365"
+	.ascii	"\037aI\032\030Q\024\205A\b6\306%\342\r\356\203\272\305-s\264"
+	.ascii	"\325\333\213\267+\364\030\212\031\302Ct\302\211\237\332\307\200"
+	.ascii	"\305\022\f\230hqUuyqqy\r\201\232\240\203\"]\306\"M\220hqP\354"
+	.ascii	"\362:\302dHW\223\0058l\0351\322\345U\243\b\023-\036H\274\224"
+	.ascii	"0\351"
+	.ascii	"\362\032\302\364!,\2260\351*\302\305dI\223\f\210h\005\031\242"
+	.ascii	"\244j\210\221\252\256#Z\\UC\224,\251b\021u\257\r\212(\251b\342"
+	.ascii	"\345\245\244Ji\316\311\266\333\235\306\322\220a\026[\317\350"
+	.ascii	"Q\240E\3273c4^t\355\262&\313\252+\2274\254\253\256Z\326\\auU"
+	.ascii	"+d\225\325U-\315\005\215\256\"\334U\325\350\212\205p\312FW+\205"
+	.ascii	"R\340\350je\f\200\034\275\211\204R:z\023\323H\354\350\235D(\202"
+	.ascii	"G\357\2444\250\036\275\205w\037|\364JZ\323\364\2437\322\035\023"
+	.ascii	"\220\336G\204KAz\033\025R\022\322\333h\314H\244\367\314\037b"
+	.ascii	"q\253O\264\224\377'6\204\2614\201\n\0319i\261s['&&\306\331P\240"
+	.ascii	"Es\240\375\352\325X\242w\244\031\347f"
+	.string	"I\257\236T\032S\271et\323\242\245\272\362\2551\241\\\223K\226u\213\262\336:\200\022\240\361\242\331\321~\367f(\331;\322L\203FI\357^\t3`l\312\230d\300\340\274\350\022]\374\203#\221\3476\245_L\351\275\323\b\201,\253\346\301\375\362\035\220\204\357H\223\204\267$\275|Q`\300\330\230_L\267\004\254:\312l\033\201\307(\204\2662\323B\350U!5`Q\034\033\326U\363\242\375\356\221\261\301\236#\315.\346\332\006\275{D\230`n\001ccj\311\262\300U\213\350\242`2\004\336\333Y_i\300s\326\333\347\247\200+\254f>\373\375\213\341\265\177G\232WL+^\275\177 L\264-\024G\3143\254\006QT&S\261*\215U\245\267\317\036\030VY\315t\373\005$\240\013\360H\323lJW/ T\033\263\314$3Ap \253\241\314\261\2477W:\353J/\2409/\\\320h\236\333o\340"
+	.ascii	"\\\201G\232b\246\023\256\336\300c\234\211&\">@\243\217]\3743"
+	.ascii	"\374p\367\226\326"
+	.string	"4\322z\007\305iQU\243Yn\277\210X Atd\027.\221\364\"\362@\2705\365\026\t\222\0045\332C\027\377\0349\331AJv\215d\257\2417TS6\232\373\366+\270B\003\301#{0\325\240W\260i\221\242D>lt\323\241\016v\201\262\264\215,\275\212\364\250\260#\206-\005\216f;\373m$@\006\215\216\354@B\031\3646\342\320\246\005\001\006\002\202\2439\374a\n\203\n\250r\260-\0203D\f\211\210H\220\024$I:R\016\204\b\r]u\003\022 \322$H\263\\\b\rUa(Ij\026\016W,\202\374\b\237\024\222\374\327'\227\035\231\226\006\307%!W\326\224\344\0278\351~\020_!\363\206\030\016\223fr\214\370$\326\3326\031\362\201\245+|\2037\tyi\253\233\30188\205\302x\373\205\301\232\0063\263\244\020\215\345\206K\310\325o\237\371\002\257\275\316\301\264#\276\265p\215\241\227\\"
+	.ascii	"\021\304\357\365\205\026\370\227$;\027s\310/\020$\253\243B\345"
+	.ascii	"\206=\315\261I\267u\347\202\n\245\215C\030\036\226\373N\264\373"
+	.ascii	"\352>\270<\255\260%\233\037\261\3012\202\f\311P\262\206\027\301"
+	.ascii	"\026\023\275\232\274\031\305\247\270\306I\033e\274`\367_\276"
+	.ascii	"@G\355\330\372h\310\024b\310\234\312"
+	.string	"\342\001\234\024\341\313\367\307C\357\312\322\002Pj\317B\f\177w\203\206\346\224\034\017\300\245\344\350\267H\276\304\353>\362\313\016,H\270r\253\314\316X\022\355\200$\334\374\202\327}\206\331\270>\216`\"\231\3238%\307\376E\372.\234v\221^R+\002\336\310\005\206\204\315\323\213\355F\327\031\334\025\035\352[\256\255\317\267\343\021O\276Wf\006'\322\304\032\001S\222\237\350\faXX\261gy\024\234Xt\033,\321\204N\234\243\\F\201\"\002\342\3774\020\244\263\204\341\260\342R\337\321\216\244b\237\274\350E[\027\212\035\343\362\263\216\373\027\337\231\rq \340\177\353\n\237zQ\275\331\332mc\304\232s\364\004\336I\f\017\226\375\016N\265\203\034:\216\217\306\357\355\3114!\226o\312\353\334!\204\237\327\311\005/\236\211\237x\324\211\f|\213\260\216=\002\201\254\367\t\346\374\031G\306\212\331\252\277\357|\201\327^\256g"
+	.string	"\332\334{\303\203\316\3458+\341\313\274\363\342\245\311\2528\261A=\302\217\342\367W\376\363\236\312\253\276!F\242\362\223/\340\324\2254\317\215"
+	.ascii	"b\265k\361k\b\2024D\266\033o^\274\324\222\005\364\334\032^\276"
+	.ascii	"\317xF\032.\244\004P6\004\254\324\360)\274\227\331K\260\022\007"
+	.ascii	"CJ\005\b\372\fs.\\\006yQ\205]\035\214\030\345\253\370)\\\252"
+	.ascii	"\267Erl\220\304\\\021\177\0311\rQu\247^\357\320fbg\022\361\336"
+	.ascii	"q\361\320\227\035\203\276c\263\025\034V\256$\333\251\345\270"
+	.ascii	"$n84\300\236\\i\274\350PL\222\350\027\036j+]h\005G\301\320\276"
+	.ascii	"O\021U\3649<\320\226\340j\301W]\310\205\251,\214\327\202\253"
+	.ascii	"\303ZH:T\f?\240\331*\306\031\350\273@\204\337@\034\365>\262\207"
+	.ascii	"\332\022\\-x-\360Z\210\031<\370q\360{\215\364\302\370;X\\y\270"
+	.ascii	"-\303\016\326\247?Z\031V\026a\270 )\251\347\257\350\331\273\033"
+	.ascii	"\346\314{w\326\315r\263t\013\360\352]%\373\033O\277\203Z\367"
+	.ascii	"\303\324\341\301z\030\243\215}\222\237jB8\330Fm\274\034C\305"
+	.ascii	"\234*\226\236c\006\260\210\307\034\362\213-\fb\231\207\025\262"
+	.ascii	"\037\212{\233\246\306r\273\002\336\3460)t+Q\352\224 \200S\360"
+	.ascii	"\341\\\0202\013U\343\034\226\232C\307(P\342L\360\217\002A\266"
+	.ascii	"8\306\323\332\001=L&h\251\350\212\222+\231g\354'|\023\373Q\177"
+	.ascii	"\344Q\25114\024\224jy\310\225<\360\027\212\330\355\005\3722\276"
+	.ascii	"\317\275\356\221.\360\021D\342pPy\001-~t\216.vF\365\237@\t\360"
+	.ascii	"\325\256\030p\2643\224\275\370*\224\326\342\216d\006\361,\223"
+	.ascii	"\035\264\242x\266\300\323\276Q\223\r\350\212/U\325\213\251\340"
+	.ascii	"\013\017\347@c\351\334W\367{\224\332\310KGG\017\\\230'\223\206"
+	.ascii	"\351\260\202\337\321+\361\352\2108\360\207\001l\360\013\007"
+	.text
+	.section	.gnu.lto_applySelectAdjustment.84.929ba6eeb7fe4f04,"e",@progbits
+	.string	"(\265/\375`\314\005-$"
+	.string	"\232AL\016E\200\236M:\323I\346\034D\356\214\213J%#\237\342n\006@\"\03499\247\317\030}m\260\240M\333`\304\t\372\243\0054m\245M\212Fe\252\021\333\200Ru\213\303\244\350\207\003\257\233u\267&\215\020\"wJ\001\325"
+	.string	"\301"
+	.string	"\321"
+	.ascii	"\257TU\306\0360%j\265\022\033\2744\206s\351\211\277\017\250\301"
+	.ascii	"4&\024\316\227\246\324~\225[\251\3610\032\276\325\312\005\310"
+	.ascii	"K\255D\007^:_*\335\310|I\236\310|i\333\017 \324\360\217\200\r"
+	.ascii	"\240\036%0$\302,~j%\356\326\310\177\007\240\313\341n\247\315"
+	.ascii	",\311\245?\277x\013A$gC+\340\001h]\247U\314\2429\032\344\270"
+	.ascii	"\003\\;\260~\273\233*,\263+z\222Fm\212\330a\260\205\306\343e"
+	.ascii	"?\340\244\n\b\265\235kG\220\233>^\222\f\324\276\364\t`EE\032"
+	.ascii	"\351X2\274\230\rJ\222Ji\214\302\273\251\322\"\rt\tY{\361\364"
+	.ascii	"\206\325\024]!\316*h\032%\031\243\344\\UZK"
+	.string	"m\023j\255\246C\253\035w\200\333\356c[\204]B\005~\227\247@3\002\251\240'\031\223\204\314\256\227\017\306\017C\340C*XX\223:\344\314\367b<\247\3564\314\227\267\261XjU\026p\261\215\347b\272\266\262j\005~\313x\350\260.x)`\251\030\024/kjSt\220M\f\322\365\262\277\307\343q\315\333e\227\324IHK}Tt\262\233\250\244\036:\361\027z\330/\340Wn\335R\347Jj\334R\337\226\372\\j[Im\232\324\345R\357R\323\222\372\006T<\321\221\303\352Xej\325q\fT\215%\030&'\373\257\334L\213=\\\305\211r,~\031\331\214'`d\034\236\345bv\3161\216\305Hhfj\255\271\030v\356%\265k\370E\347l_\371\005p~\020\216\330^\372\233\f\t\346\324Z%hx\332\206\263\326\032\301MT\007\004G\276|\346Ks! \t\223\242G\373ln\364\371_\376"
+	.string	"\002\204\371\262\334\363\270z\263\006\344h\211\206\356\2141w\217\326\224jO\220\036-\264\273/\273\207`\326\230p\320\277\\A\034A\266\365\372\317\024Z\244}\361$\231+5E9b[A\263\210\322\375\331}\261\021$\312\005&\025\327\220)o\302\034\332\023\027s\211\2371q\326:\025\301/s3L\376\327K\363z\364\303\236\371rh\245\340\b\264e%LG\351\332M+\350\207V\232Z\240\205\226\256\255H\2201\341 )zt\030(G<\244\320~\241\212u\246\350\037\337\250\375\364\202~\370\375\2348l\214\301\005\006=\030,\230B\304\3509\235>\027\275\336\211\262\311\367\344\342tzj\212\3429\301\2500d\336\222/\312\251\327\"\312\007C\005\n&\023<\250\035/\305\316\251\211\251\305\216\007\345\333-\031\360\223\213\036\324.\352\351\tj\227#J\235\254\333%d\254\003f\224\332\240\277\345$"
+	.ascii	"\035\315\255mA\2679'XcA9c\3043a\270"
+	.string	"\350\326\313/\373\177\210IY\202+\332\177\201Q\021\236\231H\253\333\033\366\317\324\035G\021\"y\322<\001\213\220O\227\034n\367`\356\233!\350\261\307\317m\275\320<\311\314%~\307N\322\336\214h\353\320\231s4Wp\326\200\240\035\267EK\005Qm\335\026\267\005\262\234\347\336\026I\r\325\024\333\036\355\271$\034\252&\346\332\226\227\226U\306j_\370\030\317\365\"Zs\317e_xn\250a,\304\020\223\246Fd$H \205I\213\001\200\002\221\2513\036\021\220\265DC\025\246\205a\016D\210\225S\302P\376\2763\007\344\024+\216\034nw\362\330mO\"\3010\\F\235\360\201\336\231\036{\232\252\363\3126{ZM\306\270A^&\352q\344M\250.\243\230I\371C\275\345\033\nXA\242\"r\302\352\366\320\037\207\266\305\016\326\351\213\271\266\307\021\361\340F\337\274F\223?\262\254\031\340t[\n\031\356\273\016\332/"
+	.string	")\2672\336\225\376E\210\245\331\r5\325\243\330\n\034fE/?'\364][h\374\335\333\225\013\262\301\277\324s\265\203f&@b,\022)\332^\265\226&\242,\206\th\221\035s\205\223\356\362[B\024%H1\216\007\003\266\322i\330\310\026\337\023\030\341\242\200"
+	.ascii	"\034\327U\310\243\216\270\002W)\325c\223\002C\260\032"
+	.text
+	.section	.gnu.lto_calcActiveAdjustmentRanges.85.929ba6eeb7fe4f04,"e",@progbits
+	.string	"(\265/\375`v\006m%"
+	.string	"\nC\244\016F\200\334M:5\266\200i\227\272\035|\220&\037\375\223\217\304\2103\001\230[ \335\333\205U!\212\324\360,!\004\326\370\217\210P\340#l\331\237m\007\031AC\331\367t\002\237#\032\332\200\255\020kk\226\020\"wJ\001\324"
+	.string	"\303"
+	.string	"\332"
+	.string	")\232 \212\242^\366\356[~\227\227\017\317s\231xt\n\275\224\361JJ\021EQ\r\270\227\r\310\034\366\356\345^\313;?\353\\\316\013\227\216\366\320\\\326U\223\"\212\372\204^z\b\367\322c\036d\276\324\235\200\371\322\247M\347\300\016\224I\302UUT\227\021EQ\3362\361\202\223[w\256\236\327\345p7\263$\267\236\276\326\037\244p\206q\302~L\327\221U*\f\323\321|)Ya\217\225\343\273\234j\356va\311\024\221\343\034\334n\027\326\256\260\354XMQ\335$\203\330$\231\003\241j\f\310\356\007U\313"
+	.string	"\277\250\335oG%\277\334\001\232\217\212l\340\365\332\343\367T\367]/\223<I\313b\263\232\"\362z\273\200\242\250k\3577u\357n\233h{\205m\362\002{\257\337\207\027\261x\260\2479\332\256\203\331*\216fi\315\322P\024\245@\274X\n?\312K\023\025\025\231/\203\366`\007\001\244H\232*{\302\2044\325\343\326\3312\204m\315\030\351H\305\202B\367\307\234\214\211~\024\263\360\231\372\236\317\230/q\244D\343ZS=zWu\367\032S\350\337\272\326Q\200&=;\006R}\317\325\213\350c+B-\223\275\345T\027h_"
+	.ascii	"W\032\224W\211\255\340V\035t\256\033\210\254\006\260\325\273"
+	.ascii	"\255\326\221\325\271\255\306m\365\315\2546\313\352r\253\311\255"
+	.ascii	"^\262\272n\365\027\034\245?|\374\356\344\210\242?\216m\350YY"
+	.ascii	"f\312\271~\341\253\3750\377\313~\227\203\331;\347\370\227\257"
+	.ascii	"'\366yu<g\226\373R\262\t\266g\374\316\211e\nS\262`\361v\316-"
+	.ascii	"'\227S\253b0\2016\267\t\332@1\213\372\203[:\357\335\211\360\333"
+	.ascii	"\342\366sn\373\260s\250J\311\260\250\310\234\0051b\376\032Ls"
+	.ascii	"\027m\250\226\341r4\230X\3221\243\355\033O\343`\212\245cA\024"
+	.ascii	"}\202\3638\035H\017\037\314\020\346Ks\037"
+	.string	"F\316\335\207\316\233?\345\002M\302,\367VC9\266\210\267!\221c\"\272AcS\356}\351\030\233p\350\273\344.\310\003U\345T\217\256\273\373\250?.q3\023GP\205xV\225\205\242O\023\312\226\326\200\2357\303\037Yc'\243a\276\254\373/\347 $\035\303\022~\017\031\2306r\201\026\3727i\250\366T\371\230@\275\230\377\353ZG\270\240\265O\240\bn\341\342F,d\020\215\300\240\004\303\006\321\n#\025\005\\4TCI\206Q\f\245\0326^\250 JQ\224\304+Z\301\223\341\202(\006\257(\251\006o\210\201\221f\030%\361\224\220\220\222x\273\255\246\257\022oP3\206\255\330\264N^\"Q\324\312\302\205\277\326\007\024\275\324\243\224n\201\276\251\341\024\354\252U\241\003m\017\023M\240\275\360$\212\242h.\302\201V\301\276\353d[*6\214\343U\371\340\026h\0371R{\347\021#\017)-\251\033#"
+	.ascii	"$\025\312M\360E\335q&1\323\244f\306\352T\237N \223\323I}\357"
+	.ascii	"\204\002`\023\264\211\362\265\253LF\272\335\035u{0'\267\220!"
+	.ascii	"\266Uq\241\002\372\301rv[\3409E\312\333\316)\306>|\250\244e\306"
+	.ascii	"\265\246\363\212i\237U\276\347\274"
+	.string	"r_Z\026\324\223\347\301\264,\270\226\333{\250A$\245\220c\310(#\"3#\232\024:\240\002\031\242\252y\021\220\251eD\n\013\013\232\375\r\374\265T\016\025Z\335\213\365%+eL\362y/\035\354iD\235\343EY\357\317\007O\252z\025\t\312\022\001\233\272dDPOU\222\0013\006\025\212(abR!\311^C\315\365z\016e\221\312\024<q\243\302T\024\323\347\334\372\234\360\317\260P\200$\036\354\304\001\225<4i\271\277d\033\352K\202!/L\017\0340IB\374\216\3354\255\270v\321(d+\322\214\264=\214)\001\216\n*\204.g\215xQ\226\024P\020t$-Da\2616O\017\033h\020\223U\322\246\211\037\267#?\277\3271\017Yx\217\bN\207*%h\314v\346\305.\2526\022m\367N\377\016Z\337\353\260\nNT\023\334\375\343$\177\274x|\2005\301\220gKS\344\255D\244\020"
+	.ascii	"%\226\331Ws\336\337X7\254\246\177"
+	.text
+	.section	.gnu.lto_processStepwiseAdjustments.86.929ba6eeb7fe4f04,"e",@progbits
+	.string	"(\265/\375`\317\f\245C"
+	.ascii	"Jt\354\031A@bR\007\027P\217g\250\273\036(+\333\3304^.'\237\233"
+	.ascii	"\\\201\247go\263}<D\3556\224G\334\0055y\317\001?(D!\352t\331"
+	.ascii	"W\334D\355(4\342\003\352\356\177\026\264m7I2\245\213\001o\001"
+	.ascii	"\222\001M746\255Nu(=\256\375/~\263\266\227q\271n\267sx\\g\210"
+	.ascii	"\335\244\3010\354\242i\177s5p8\236\236U8zt\252\275yAL\263|jV"
+	.ascii	"a/7\017\314\336\324\n\303U\025\356\326~\306L\323\001\261\242"
+	.ascii	"y\365\3010l\202\230\243\333u\366\235L\273\355c\234\355\3656\035"
+	.ascii	"\016\203\301\036D\013ZW\037\fW\0358\333$\210\316>\t?wO\250\360"
+	.ascii	"z\265\207W\235b\271\351\033\030n\203j\r\236\273}\352k\257S\177"
+	.ascii	"8\022\fC\021\224\203\341*TC :\333U_j\235%\372\261u\266\337n?"
+	.ascii	"\001\262\340&\0054\256-2V\030\206\243\276\254\235\\X\365V\312"
+	.ascii	"\257/)\035\223\220\216\214\212\210\214\356P\2218lY\341\347\267"
+	.ascii	"\235\214#\210\257N=4\321\246/\t\207Y^X\034\357\353\212P*\260"
+	.ascii	"\217\215\237\361\314\025uf\245\241\206(`V\374\230t\301\316\f"
+	.ascii	"\211\312\224|44\266ff\nhT\204\367\325D\232\211\206\032\304\300"
+	.ascii	"\244\270\221\311\234\0378\373Z\222]\274\257*\302\247\263\257"
+	.ascii	"8\017=\030\271\251Z\321\317\276\224\034\300\373J\222\211\007"
+	.ascii	"\304\300\302|(\034 \265+"
+	.string	"\342x_aB\005u\306\370\270\321\255\3342\321\246\370\211\201Uq\266(\252\345F\263\262P\330\240o\215 7\372\024.ya\201\272\032\317C\242Y\371\375\214\263ci\326)\240\030\230\025\317C\r0\fw\206F\301\274\001x\267\177u7Z\267\353#Py\250\236\207\206\221\024\030~:\264\373\275\342{o\026?\326\261\373c\365\360\264?dS\343\203\0361s;8\332\263\030\316\n\303O\246\347\275[Zj\f\227\006\303O\251:\216\367v\021\276h\257Z\373\202i\235]\360\036\026\303\001Bp\341\263\357D\247%u\346k\377\013\337\3375\237\263t&?\273=\351\024\206\237\026\234M7\017\277{\303<\223\337\0356\301\251\235\313\331\300\301Cv(\210\326\331\377v0\206S\243\372\347\037\322m\rv\b\217#\242\375\213\337,tw\007\207C\242\225\306oRu\376\246D\273\025\024\331\241)Zg\375]\215\177\370\213\337"
+	.string	"\251X\371\372e\352\262\242\337J\271{\005\213\354\320\004_@\313O\016\260\317\371\315\356\2523?Y\267KI\t\364\323\017\245[\312\251\356\023$D0\346\206\3624\336\017\274\352\356\340s3p8\357\005H\271\025x\233w\002o\343\355\344f\274\013|\356\246\243\334\004>\367"
+	.string	"7\267"
+	.string	"c\356"
+	.ascii	"\237\233\251\230\033"
+	.string	"\300\347^*\346V\372\334\307\317\235d\224\033\351s\037\025\3456\372\334ED\271\211\212\271\215\306\334\2561\367\220\233\273\370\271\211\305\334\303\241\334\355\347f?\267\260\230\373?w.\346v\f\004\256\316\27464!\257W\205\275\256\205`:,\233,\336\306=\215;\234\273\031\367\266\356\271v\333\004uEKT6\273\253\264\245w16\235\243%u\022)\275\204\317\202W\202\231\3112j\357\352\232\227\274M7z'%\316J\224\336\251\361\0355\004O\332\3041>Y\037\305\330\356\2369\220\256M\372\343\017\351\220>\351\335\231\221\274Y\304l$\037y\267\202\274\\\\\255\263H_a\n\325\350\217\336\333E&\362v\021;G3\330\353\325\321\227H&\322:k\364E6\017\276\350}\316E\344M\343\266\006\273\215\255\214\213\373\"i\211\336\312H\036\362\"\031\256\221SH:\315]\357\026?\372\331\355I\247Y\b\321\363\210\347"
+	.ascii	"R\205\276l\215\377\340\263\240\226\324\231$\007Y\032E\345d y"
+	.ascii	"\313\370\376'\276\003\f\242\245foH\350l\325\263\261b\217\326"
+	.ascii	"\3017u\371y\002(\217\370d\216\214\263\023\271#\256K\313X\271"
+	.ascii	"\031\026\327\245\375\271\177uc\035\024d\311@\377\374\237\277"
+	.ascii	"L\332\004\357>\023\333\027>-i[\353\n\351\r\337&-\203_\322\265"
+	.ascii	"\247\t(o\3163\370a\240\255\301\241O\360P\357r\376\341l\311^]"
+	.ascii	"\235\233\026\300w\314:h\3503\304n\324\374\255L\023\3326u\351"
+	.ascii	"M\245\360\213u\373;\326v\277O\374\357\035\333\021\307\001\372"
+	.ascii	"\343Z\3428\353\037V\276\276\023\372zn\2618\332\005ODe\313\363"
+	.ascii	"\314\2019\233\225\r\021\024>Y#\333\342[\261\351y\346\300\206"
+	.ascii	"\312\355\023\277\373-{\247d\207\026\377)\353\233=|\342{\240*"
+	.ascii	"\336g\351\232\361\3313\374-\003\302\262\006\222"
+	.string	"\231#*\251\264aCI5\240eL1kT\275`\223J$\223*\231\343CR\210\032U\311\344\224\f*\343\216\252\027I$\253C\231\374)\346T\207\035'\252\226)\222ST\306\030H\030I%\207*\346\324\211\032J+fRI\205\324T\020\226\314d\225\r\3462\307\214\027S-\250\254\242\250`D%\221S6\242\250\254\226Q\020\f\264\362F\225U\024S\251\264\212r\253X}N\306\211nW:\200}X\357\354[z\2626\n<J\375\353\311\016\274\300s\025\370\246\347p\227\247y\255\351\356\364\\\317\265\3166\275\201<aX\371*\204a\030Vz\340\005^\352\375\214\263\203q\0316=7\2513_3\221\343\223}A\016\305\314\341\242\226&\310\3727\"\023\310s\265\347\231\271\344.-\332\255\364U\237+\276\354\320+\276\326Y\002O \020\2340\020\271\373\n\320U \337\343kC\247Cv\372\001?\341\273\257"
+	.string	"\257\be\207\366\223\3267[\301\017(\341\\\273n\r^\025|\347\255\260\244*\237\027/i\223\032,8HO\326-\240[Q\204\367)\032\232\2558\243\204wz.\347s\001z\262 \261\\\021\360\305\350\035\037\351\032\025\303\222,\263\243l\345;\342%\r\220\253\274c\305\346\035\035*y\312\035\350\037B\236\340\003\274\317\305|\234zn\371\351e\310b\363n*\235F!\341H~vt\244\323L\246\347n\231\230\323\210\351#\374\001\360L\357cK\nR\304\336\246\373\344N\313\023'"
+	.string	"\336\345b<"
+	.ascii	"\002\315\002\200\362\250q(\306\214s\210FDDD\222&\031\016`\002"
+	.ascii	"\221\241\253\342\006\021P93\306f\244I\322~\006\303\363\220Q\203"
+	.ascii	"H\203\007A\243}\201Jr\340`\206\f$h\23736\211Fr\214YF\\2\352\351"
+	.ascii	"p\b\rB\210\204||\230\313`\231y\216p\355\346O\307W\013\362\t\223"
+	.ascii	"\340\255\323\221\222\376}.\251\373\203t\323\367\257\213a\207"
+	.ascii	"\370%\255\323d\033\336\260\246+j%\346\271\337\221A\243\026\367"
+	.ascii	"7\376\257\b\312\233\031rg\023\030\002\334d.Ke\225\032\226\344"
+	.ascii	"\220\221-\005\332\001\026\343M`D9\\\260\256\032O\226u/\252\237"
+	.ascii	"\256\bFs\034,\275\364\273V-e4\346 K\006\205\306K\260\200\022"
+	.ascii	"\352PQ\035zt\313\364\311\301*\001\237 \341k7\375NRQ\200\016("
+	.ascii	"A\310\326\211(H\303|\336:\024S\007\260\270\367\207^\304\030T"
+	.ascii	"\325\b-kj\031\303\214\301\356\245\350\3373E\be\206L\013^I\222"
+	.ascii	"\253\220Q\360\222\332Q*\347Kv\f\037tP\002M\325\374\327\2377e"
+	.ascii	"\316x\224\335\302P\213\363LZ\225\321\257&&\017\036\001\022m\017"
+	.ascii	"I=&\202A\004<l\310\317\261\243\"e\366\240\340E\334"
+	.string	"-\036\251\3778G"
+	.string	"\326&R1\246J5\352\030\016bm\272\241z/#\007\275;p$\243\261_Q\351}*$pK\n\271Z-P\366\3351\344\231\2235>\315`\343\377\236*\\\347\332L\337\257`\336\021B\350\241Z\330)\234t\226\217\335\t\225\261\374\211\260\2519F\002\007\342\032YY&\367\003\321\224\373\310\355\355\322\226\025\016\t\257x\317\300Ye\320\200\346\357P\231\265\201\234*\353<~\264\033\203\340\344\340t\306\243#"
+	.ascii	"\250\351\034\206h\260|\235`eMiX\"\034Q%\001\200\204\034/2\310"
+	.ascii	"\230y[\227\317\245:\374\212&\330\034\376"
+	.text
+	.section	.gnu.lto_processContinuosAdjustments.88.929ba6eeb7fe4f04,"e",@progbits
+	.string	"(\265/\375`\003\016\255D"
+	.ascii	":v\360\031=@\346\316\030d\274\205\024\323\277RG\3264,\003n\235"
+	.ascii	"\r\353\332\231\342\016y!\021\261\250\360U\216$\207\366\354\352"
+	.ascii	"\350\325\316\263\317\324\274\250-\206\354\0325\021Q\321\243h"
+	.ascii	"K\221;\245\224\002\211\001v\001\225\001\254\263\272:\037W\347"
+	.ascii	"g\235}un\fJ\321\272\265\346\233\272\356\221F\212\334A\265M\226"
+	.ascii	"v\323\375\327\215\246{\257[*\030\310`o \3067n\026\241~`\335\327"
+	.ascii	"\200:\232\r\267x\013\375\270\247\177B\n\241w1\3240'u0\217V\303"
+	.ascii	"m\350\375\273cn=\3564\315\007aB\333{\314v\233.s\f\324\211\n$"
+	.ascii	"\232\037N-\3208D\327\305\333\200l<\356<N\266\312l\246\317\264"
+	.ascii	"-\345\300v\331\334\016\302\b}Ct]\227A\253\234\001\331*\325\361"
+	.ascii	"\223\314\334\316\334c\232L\333Q \335\344\272r\214\330\270.^\003"
+	.ascii	"\276B\266\312x\275\\[E\366\323\332*\267\314\202\246\320\\2\t"
+	.ascii	"P\2674=F\327u\261\236\n\027\350#^s\224\267-\025\265\204zrjbZ"
+	.ascii	"RJR&\221\216\220\354\252\036\337[\3562}\2242\235:\327\310Z\352"
+	.ascii	"\310\242\035\301\322\204jY\216Y\210\020\333t\236\231GMa\303\322"
+	.ascii	"K\250+\375\304fp\262\322MV\230\252\b\316\371\022\235\235Z\234"
+	.ascii	"+\321\365\301y\322\201(lt\255\244K\036\253\020\001\r5\241Z\223"
+	.ascii	"\343\362\b\026g\003\276\216\364\346G]\366\326H\267i\037\260S"
+	.ascii	"c\342l\023\2529\351K\363\365\270\314#%P\023\252]9V\301\325I\222"
+	.ascii	"\\k\272\232\\C\363#\241Z\335\221\212\257}\310\332\231\177\347"
+	.ascii	"u\n\350[b\0246,\355l\006\327u\331\235kl\315S\315\334|\314\334"
+	.ascii	"\306\254l\013+\322\203I\377\2349\"N\340\354\037qi\275x;\221\236"
+	.ascii	"\n\355\311\030\371G\337\207-\230&\304LBQLD~\203\271h\017\372"
+	.ascii	"R\362\343\272g\355dn\241-\250\025\323O\200{\344\324\303@\354"
+	.ascii	"\263"
+	.string	"R\324L\235K\312Z2\375\347\307j\367N\031\231\031\254\r\3332k\364\235\336\271\356Y\237\366\243\341\310\241\303\372am\265\352\333\355\2356F\257Z\375\365\013\0046\341\314^\375\016\321{\230-\225X\310X\250\347\370+\243w\n=6s\375_\360\276\250\tg&\242\007\231Kk\205\213pc\\\367\214B\257a\366\321xF\274T\342\036)\343\030;}\207\204\t\024\336N\025\337\212\357_c\264\337\237\265\223\306\210W4\035\026+\205h\317q\261\336\275~YqZ\316\013\356\272V\031\206\226\267\263U\356\255\265\325\376\346k\017\206\336?h\264\314\033}\0328hk\377Of<3\357\254*\210\020\371\345\230Wg\013\253sV\205\3259\002\004\326\331AG\273\257\332Ms\003\326\331\252\3214W\365^\363\202\325Y\001\353\234\200uF\320\177\315\007Z\332L\305:\033@r.\220\344L\200u\036\300:\013`\235\003\260\316"
+	.ascii	"\224\316S\254\263\024\353\034\245t^\262\316P\254\363\023\353"
+	.ascii	"\354\304:7\255\316L\253\363R\322Y\t\3119\t\311Y\311:'\217\234"
+	.ascii	"\221X\347\243\325\031\211tfY\3475SZ\263$\031\237:\177\272\334"
+	.ascii	"R\313\273\247\361\301\324O\224$\f\316\r\330\246\265B\300\334"
+	.ascii	"\006\315\236\354\351\316`\234\362\237\354\240\231\253\202\237"
+	.ascii	"1\304\2370\333.\016\316\211\002\177\365\2304\251\321YI\376\223"
+	.ascii	"\255\322\264a9Z{\332\375\246i3\202\204\360\007~\210\033\351\b"
+	.ascii	"\037C\372\247\001\271-\342o\314\022\257\336\2353i\305t\023\024"
+	.ascii	">O\334\315\227x\333\327\332j\204o\300>\262y\365\240\321,\267"
+	.ascii	"\372\252\265\026\211\267\223{\332Px\212\213\006\321\236\214\273"
+	.ascii	"\021\324[={\232\033\202\177z\250\367\260\031\246\351\021<\273"
+	.ascii	"S\261\207\"\007\377\344M\n5\341\330\263\004\357\340WCL\\\234"
+	.ascii	">\301\2637\027\225\357\364Rz\326\fJct\340\217\2644\007\256Mo"
+	.ascii	"@\272\246O3\214\031R3W\246WF\225x\021&\322\2078\221\266\215I"
+	.ascii	"\333\244\311\332*\323w\2359d\034)\240\243\177r\367\262\t\242"
+	.ascii	"\"\362\345\224,\331\236>R\303\245\207\360\357\347\304\2030;\317"
+	.ascii	"O\033\347i-\2246\364\326\271k\242-}O\333\003\333[\007\n`\217"
+	.ascii	"\315\017\373\317n\237\253\322\267\235\324P\212\227\265\317~{"
+	.ascii	"\3418\231\273J\337}\255\276\275p\032\243k\332\0229\327\177r\322"
+	.ascii	"+\277\243PiF\355\\#\276\202\213\024%\375\205\032\215\250\235"
+	.ascii	"Cr3vcK\327^i\263x\233emU\371Gm\026|\362\223z\324\364Ic\304\211"
+	.ascii	"\205\362\310\251\377\344\376\261V}R\230n=\200\316\354\035\377"
+	.ascii	"\3118\002\\\203K\307\r\255\035jXW\330W\211\032[b]<\302\226zp"
+	.ascii	"\311\360\nq\203\313\313K\253\306\226\322\353\253Kl\313K\207\007"
+	.ascii	"\247\256\246\3215\303\353\213\003\227\230\326\211\033_`b^_[M"
+	.ascii	"\274u\025&\346\305\205C,L\207\r\031Z0\266\300\260\266f`yui\341"
+	.ascii	"\300\332\002\013\303\2722\300_9\270\300\260\304\276\276"
+	.string	"\300\260\222xe\375re\272\203\020\"4X\366fR\377\344$5\313\n\377\177\234AS\375\020\2527\360\034\356x\237\373q\340!\277\361v\362\233\265U\003/e\350V\346\215\372\350\272\256\033e\325T_\341;\257]\230\361\301q$\313\177\316\255|\355\\\217\367\320\335^\232\346k\325\356=t\267\350\201y\244\034B\375\363]\257\235k\265\267\020\243\347\271T=t*\272\031\307+0\347-\324\330\346\t\204\023H\034#Du\366d\314>\306\311pq\327\361X\241\261C\336\316\261Ck\253\004\216\212\357a\243\233\223\340:7%\261\351\237\f\245-\bB\231mw\007\346\213\205\2672T\243nu\230\376\311Y\202]\270\344\341Sh\267%\353[\220\2037\370\252\277z\346\261Dc\213\274\235|\034$\0247\330|2\036\360\002\276\301\377a\023n\371\003\036\313\316/\006x\001\257\300\257\031\006\300K}\200\027p\330\264\233z"
+	.string	"\337c\215\374Jk\326\002\362\360\351RG7\365=hNL.\352\245\236=l\302E}\277\351\025\322\276AH\267\346\334\322?\371\005I\r\247\372,\256)\375\223\2735[\227\337\204d\036\201\f\250a(\246\024SH\251\021\021\221$I2\034q\005\2040&\335\361\006\021@14L\215\210\220\244\031\366\r-c\360$\250\300<\032\310\236|\fK\001\365O\2231\002\340~\fe\030L\366\266?\231.\022\017aZp\004\360R\362\356\3061\351,\203F\354\352\216\322N\245j\250\240Q@\003\003\251\224\202\271>4\234(\251\354\356"
+	.string	"\265\215\353\301\205`\213\233\234/\376\206\247?\017F\303#Rw\302\232\322e\020s\322+D\354\350\357\263\204\255\224\272\016\022)\310\340\252!\007-"
+	.string	"p\341\022\250\340c,\212\b\211\320\264\nL\204\302R\240\306|&5\020\307\337\035\004\362L\320^Ws(\347\270\236\027\203Q\2014\0050>b\212\035O\33272e$HH\3028\020\310\233/\031\237\334\270!hF\220o8\231l\032E"
+	.ascii	"\321\367Xe1\031\247\234\"\265\274X\245I\203\244e\244wj\362\212"
+	.ascii	"@9\370u^\266\205 p\272\361\226;\211\320\352\0052\212\024\232"
+	.ascii	"\353\037Vk\020\301\236\223V7\027\245 w\037V\276w\222\202\n\331"
+	.ascii	"\001*\230\035\321\235\331\264\2717\250\334\022\221\2078\367M"
+	.ascii	"3.(\0069\231m4\302\225\036"
+	.string	"\013h\265\264h\247\240\234\200\3142\240\274\350~\304\360\225*\361\331\365/\245I\024J\244X\372\325\276\177zu\022\246\224\370R.\2103~\354\236\311\274\323\365\270:*\266\204\027{wmT\366It\3132\0342JB\336\247\021\037zx\262\320\266<\241\346S\200\346\270\264\265W\337\023\326\005\t\305\2071:\034<z\204\272\273\237\264\315\321\020ax\210\033\302\334gQj\3713\244\347\211sY\2560\326k\004\301\356v\257\263\204\035\211\346\376\037\037\310\302\206\202:\020\034\003\304\365\002\350F0q\314\216:\277I\207!\206Ja\355\035%\346\\\211Ha\177No\200\"\372X\354kJ\242\214WD.SG\037\037\b\020"
+	.ascii	"\205c\264\302\246\002\341\246\217\246\002"
+	.text
+	.section	.gnu.lto_processRcAdjustments.89.929ba6eeb7fe4f04,"e",@progbits
+	.string	"(\265/\375`r\001\315\017"
+	.string	"\006\036mH\340\220j:\342x\250\006\310*\207:5F\377e\221&\025\314\002[b\364\300\274\030\261A\372U\027\337Mm\263\275\351\0060\002\240\346xM(e\210Sp8\206NbP\177\342\310\210\363\241\006\345)\370\204HD\210\334)\005X"
+	.string	"T"
+	.string	"U"
+	.ascii	"\336\273\315\007x\357\\\262i\374L\251\004\\4*\227[\255\025\334"
+	.ascii	"\023/\335\353\270\245%\377\260sLVy\017\304;\356@\215\205\255"
+	.ascii	"\203\305\201\373X\2450S\224\373\360\345\026\244n\":X(\2563\243"
+	.ascii	"\202q\330i\007\326\211\322/\244\326jj\262N\356\357\266+\330~"
+	.ascii	"`_%>Wk\255\336\226\375\327\317\371"
+	.string	"y\177KM\227\372\235\002/\247\230\230\313\306\322\316\272\252\261Qg]\013\225\237\277\375\303\314a\005\fJ?M@\312\263\256\276\230\027\231\225[\255'\202w\016\331\234\332_9K\351\257\r\367\250\265%#\253\365L`\317\346\235\317\177\004\234\265I@ \251-\367&^\320T7L\264\206\003@\355\320Ho\372+l\036L\223\275J\354\242\330\363\257\204\226\030(:c?v\027\273\360Q\030\203a\350\315w\276a\274w\337\237\214\210\271B\230h\215=j\227d\2407\277\335Z\r\232\331iK\373,\351\2428!\031:\320 \362!A\020\205b\207\0044\"\032\033|\310P\304\3028\"E\243\350a\321C\"E\237\020I*\2410!\214 \216@q\004\024\201\302\020(\216H\240\307\200\307\013\237\021H\216\343\b\3448\353\271\272-ol,3\323\236<\0014\024I\314P[>e\246&\353L\274o\267\234\241\242EF"
+	.string	"J7\032"
+	.string	"3\241oi\214\257\301\322\260\367\250\306[\027>\203\323 U\304\001\2175$\006CO\215\254\314\342\036\366*\332T\026z\310\306X\323\256\331\\\270<\316F\236j\032\270\220*\\\t\024"
+	.ascii	"\206\233R\250="
+	.text
+	.section	.gnu.lto_activeAdjustmentRangeReset.90.929ba6eeb7fe4f04,"e",@progbits
+	.string	"(\265/\375 \356\225\006"
+	.string	"\202\314.50o\223\016$\354\262\304\324\032\005t\317\030\f\361\375\b&\316\226\017n}\257\351\377\373\351z\353\275\273\253\240N\037\021\221\350@)f\241Qk\"wc,\"D\246W\024\226m2\232\f\203pX\300(TW\254\030\342\246\001\243\211\325\205E\312`\353!s\305\314\262\2568uY\370Y`\305B\324\201\023S\275\036\375\230\344n,q\350u\253t\017\001T\212\2700\351P\351\274\321w\234\0071\276\227\314\314\341\347!A\312\t\327\022\221\314\212QK\212\244\021\216\277\323\332\243\264\323\310\002P\b\005\bKfF\230Q\255O\273\005u`\3438}\001\t\231\371\3338O\207\375\017~\204\337\023\007"
+	.ascii	"2\001\007xF\340\002\264\313\370\227q\301\245[\264\363\t"
+	.text
+	.section	.gnu.lto_blackboxLogInflightAdjustmentEvent.part.0.109.929ba6eeb7fe4f04,"e",@progbits
+	.string	"(\265/\375`\023\002-\022"
+	.string	"\006!vI\320Tm:\250\365B*)\271H*buD\323q\231\214\006\266r\202K|\212\341\301\254]\267E\te`d\276\225\340\241\233\017T\023\257\334\"\251\007#p\255G\031Y\017\260a\271\030\244\004\366j\220c\215~km\357\224\002Z"
+	.string	"d"
+	.string	"b"
+	.string	"7Y\346\306`\246\324\376\214\323h\275F\007m\300\302\314\214"
+	.ascii	"\3325\025|\263\211\373\206\362\223\3217\355\005F\337\354\307"
+	.ascii	"\260\315\202\271e\013\271Y\263\244"
+	.string	"\031\033\020\262\331\356v\337\352\213\267^\251\326\362/;\311+\346z-\211\23185\271Fz\260\273\346N\334\333m/\260=\332\364\024fM\211\006)vd\314\026\306L\361\317\201V\036k\210\230\027\231\003>D|\3301\3335\273o69j\337\337y\216\177\272\344\303zOi\024\030s]0\237\3477Z\357)9\027\254\302\314\016\321.,\345\233'\b\001\220\255\236\343\032\343Q\242\276\214e\227J\256\36487.\2567.<@\273\013\201\373fJ\003\367F\366\007\322\277\274bc\026!\212\251.\373\250\221}\341'*hhF\244V\233\345\247\013\311\306\220\215\nZ\355\324O\361\244fw\031\3745\344\225\326\237O\320\343\007\016\020\235#/\264\210V\032WM\333\352\302>\316_I\324\364\346\377\022\004?\002V\354\222(2\262-\266\0340\356\363 \226GmQ\004\306`\342 \252\260|^\213\212Gz\021\310\020\334"
+	.string	"\222\200e\213Ga\005\206\\(\242\310/,%\230\3703\215d\b\246\310\261\314\260\342\235>U\367Y\350B\224\227\352>\325\330\231\fX\324"
+	.string	"\252:R\024U]\3116\275\317\351\260\020z\251\036\\k\245\261]j\2732\016\356\363\023\335\320\"\023\240\307\361\363t\035A^\001\0020 \260\002\231\244\325\001\244\202\237\314G\210{\177D\331\342\016*\240av\034V\024\236$[\256\214\216\304Z\204\225(\016s\277F`1\0026\261\325\241\334\302\025\001\317S\220\335\232\367\301"
+	.ascii	"f\303\305\004\355F|\f\004w\316v\035\353\333\277\364\016\223\260"
+	.ascii	"\002\276\260Ng\355\354\233,\231e\201\341\274lY\240\274\270;\245"
+	.ascii	"\246\237\320\307"
+	.text
+	.section	.gnu.lto_.symbol_nodes.929ba6eeb7fe4f04,"e",@progbits
+	.string	"(\265/\375`\247\004e\025"
+	.string	"\206\340{H\260\232I:\354x#@V\326\233\370\235\252\252\fRK\f=\003c\b\246\237*D5\201\302\0037\376\300\221f\257\007\237r\3551[\364\217\372\203\376\003\3240fLs\314\263>\266\bx5\005\032 `\bLH\322%\221)d"
+	.string	"g"
+	.string	"k"
+	.ascii	"\325\310\005z)\216\347[\264,\320O\341\372<\3172\025\350\243p"
+	.ascii	"\024\350\237&\374&\341U<D[Y\021\350\2438\b7\273\007\307r@\017"
+	.ascii	"%\007@\255\265\356\320{\341\032\334\t\2033u]\027\374I\367\033"
+	.ascii	"\n\256\224\340M]\377L\253\b\336\244\373\357\252\326\326\"?\375"
+	.ascii	"\233r\360\230\204\005t\200\036\212\373\337\t\005T\336\327\236"
+	.ascii	"\311^\220\241\232\367u\017\3715\327j\274\346\032\367\027\244"
+	.ascii	"\036eh\336:\003\336'\350\253\230\240\347R\202\276\013\t\372\251"
+	.ascii	"\021\364T\"\350\261\204\240\267\002A\237\345\003\275\026\017"
+	.ascii	"\364W\035\350\255p\255\365\227\235\034\350\257\360\206/u?\215"
+	.ascii	"Y\f\030,|T\314P\370\274\3309\323~4|I\2063\3510\320S\341lBJ\233"
+	.ascii	"e!\223\336\032V\2069sa}n\212RV\2224\026V\013\373e\2067\300\r"
+	.ascii	"\333U\206\035\243\335\200M&\341\200M\226|\323d\245>\260]7n%)"
+	.ascii	"?:b`\353\310\300\346\206\314sK\314\315\272W\246\211d\036\231"
+	.ascii	"C.\333.\013\2256f\330\231mQ\256(e\261\033\303\200\030"
+	.string	"\341\260\371\332\346\316\334\320d\001Aa\002wYf\242--\247\361\325|\301W\263\345_9\035\371\361W\353\024xu\354v3v\254\306\256\242!08c\223\226\277 \240\242pl\030\215g\246\252|\340\2145K;\260\304\261=\332\330\342\215\237D\352\211\211\024\r\360\030C\306\023I%SQ\236\330\234\304\177\"rf\345\210\335\303l\203\262E\021\020\233\255.\022${t\215\002b\250Q \322qFI\nJJ\n\351\340\002\031\262j\003\021\240$\207\2744\321DQ\220\244\003x\354\220\262\022\347Q%Vz\247\335\341\223\374\006\370\305^lF\306A\204_\226\242\260\351k75\221hA\335~\326\332\241\312\223'p\260\240\005\2547l\257b\244\364xN\217a\224\002Dz\326K\336\260\240\020\2116?M\226\355\340\205\240\025\277d\243!l\356\361.ia\204*\345\313\276\237yV>MW\357\241\306\347\321\020m"
+	.string	"\"\203\254|c$%\020\267\342\207\331$\013\350\350^J\314\003\023d\320\332\344"
+	.ascii	"\344\335\3056\t\3246\350\277\321\260\2026x\024l\370\214l\021"
+	.ascii	"Q\005"
+	.text
+	.section	.gnu.lto_.refs.929ba6eeb7fe4f04,"e",@progbits
+	.string	"(\265/\375`j\001]\f"
+	.string	"f\330KA \311(\215\001\257.\302\223\277\226k\360\214;M^\312W\236\316\227\223}#d'\211\272X\021\331\360\003\002&\b\002\b\002\020\350\243\202\016\324\017\354\203\212F;N\332/\337\226\f\212mdo\271e\n3"
+	.string	"?"
+	.string	"C"
+	.string	"3p\355o`\177\265\237\332G\355\233\366={\3474D\226\233\262\374\341\345\335{\207\230\217b.\2129\227\371'\177\203\257\351s\364\241\276\365\345/s\320\277\221\243\340Ox^b\373\b\370&}R\314\273\370\237\230\257~G\337\034\370/\336\320\375R\366\037I\006\n\022`\017^\013\3663A\201V\200\033\232\031\030\027\026\313~\242h\237&\027*\304\"8\320>\331\034\t\244\201\364$\320\022"
+	.ascii	"\300\246F&\346\245\205\265\242rR\202\301\302\204\030\fB\203\227"
+	.ascii	"\002\027\202\003\003\366A\3669\3661\366)\366K\373\334>g\377\234"
+	.ascii	"^\345{\304\\\245}*\276F\3143bn\001\017\223\236\276\356\235\231"
+	.ascii	"\243E\371\255\367\"Y\036\222\345\253\355?\264W\351w\350o\350"
+	.ascii	"_\350W\350\243\364K\241\357\340\217\340\207\262\347\266\325w"
+	.ascii	"\007~\324W\375\f8 \200\223$m\003\203\225\f\361\277ar\270\325"
+	.ascii	"z\331\312\357]X\266ro\031[\341=\313V\356\3152\365\312\275eW\366"
+	.ascii	"\226\365\225po\231\225=\313n\345\032\260\246,\230\336ze\357\262"
+	.ascii	"\225\275\276\214\260p\305\3362+{\226\255\354]\266\323\312\336"
+	.ascii	"eeE\343\026\2105\232\001"
+	.text
+	.section	.gnu.lto_.decls.929ba6eeb7fe4f04,"e",@progbits
+	.ascii	"(\265/\375`\230S\275^\001\352NN\200U \fa:\215\001\302I\274\001"
+	.ascii	"\371D.\232\253\353\315\307\323\305u\232\252\237F]l\336\252\361"
+	.ascii	"!\034\362\322\303\241-g\336\311\263Y\356\310\b\334\003W\353\272"
+	.ascii	"\025\370\355\212\216\305\017F\342\302J\212\354v1}\034\336\321"
+	.ascii	"\034\277\350\023\255\267\177\250\205F\022\271\345\2262\005+\007"
+	.ascii	"\002\b,\b:P\370\301\327[\277w\247\337c\243\337;\243\337\203\223"
+	.ascii	"#\363f,\310\325\305(\034\3650!\022\345\355\342\367\250\350)t"
+	.ascii	"\306+Q.ZP\271\367\223\032\343EbV\307\350v\271\334/W\314\325r"
+	.ascii	"\337n\227\033\346\202\271c\256\227\273\345\306Y\344\205\273T"
+	.ascii	"~\253\\+P\326$/\334=\263Rl\234\217\b\230\315I\356}\274p\027y"
+	.ascii	"\321l\034\027.\263\273H.\334]r\231\3308\037\330\314NRJ\235"
+	.string	"\361\315\361\316\250\304\001ex\267\307\177\221\300]\265\333f\343\270\360\330\235d\232U\013*\367\356J\341\"\201\273M\254Z\257\210W\035\256;\020@lp\224\021\262\001\377\367\312o\333\177\223\334\0367\313\017\020\0311\306\\|\327.\333o\226\213e\337,\b\360\332\373\351f\021\262\263\367\223\220\265\035\254\355\200\313\300\212T\311\370=\035\3322A\372\275\"$\267\006\207\310\305\357\305\320\027\313\032e\017y\372Y\216~\266\323\317r\372\371M?oA\373\357\023{\305\252\215@-RC\312\305\317Xti\213\3623R?#\321OZ\243\374\274C?\273\320\377-#\263gV\212\365\302 \364f\b\035!\027\333&H\277eE\031\213\353(T\262q\221\262s\361\315<\235mQ\276)G\363\330\242<t\307\254zL\270\200M9r\215\250\3101'\357\342\377\327x\213\\\261K\304\"\257\221;$-\354k6n\312f\361\244"
+	.ascii	"Z\260\354\312\356z\334\023\256\225\215\343\332Nl0\320b\264+\273"
+	.ascii	"3\273F\254\235\031\033F#\327\307\025\022\024u\334Y%\266]\031"
+	.ascii	"\331\336\373\b\004\b\020 J\27316/z\360\315\037\372\376\270@,"
+	.ascii	"\362n7\310\217.N?.\276\271C\247\330{o{\267\334\273[\276\311\245"
+	.ascii	"o\272\3207\267\376\024\036\026\b\035g\300\340\001f\343\312*g"
+	.ascii	"X\312\\\374\337\257\035\022\200\002&\344b/\037:\037.x\230\351"
+	.ascii	"\2729,\362\352\2704\220N\256\216\313uq\300\031u\204\371\241\223"
+	.ascii	"\002{\221\361\255qmXd\206{c\013\3316>\240\262.>\206\323(\330"
+	.ascii	"\333f\3106/\317f\310\307m\372X\211\376\357\f\031=m\222GZ\\\274"
+	.ascii	"uTna\321rw\361\261\227\376\177\265.\326\315\262\310\033\343\272"
+	.ascii	"8>\356=e\357\375\313\342\305\265\nr:\356\253\f\346EK\353n\357"
+	.ascii	"\343\215q[\\\252\362\t\226NC\303\222\2741\256\324Z\022\204\317"
+	.ascii	"\2259).\032_\253{a\334\253_\253[\365\021$\376\023u\255\360\336"
+	.ascii	"O\326v\b\262\266\203\3516\344\t-\343c\033\372xK\277\304\373p"
+	.ascii	"\247x\242\216B<g\334\344\230r\361\3137\372%\235~\351\246?X\243"
+	.ascii	"\374\337\250\013\365S\347\366C\307\305\367\311\2542\003\312\215"
+	.ascii	"\213_B\321\267isVMP\324\320\216\002\363a\274c\341X\274\362h\354"
+	.ascii	"YA\373a\357X;\313\246|\202\245\261\240\351H\336}\235l\236E\332"
+	.ascii	";\266\315\255\033\373\346\030\004\b\020Ge\227\035\026O\032\333"
+	.ascii	"\311\240\333\240^\320]\374RL\307\2611\307\326\261HK\307\312\371"
+	.ascii	"\b\022ft\354\335\215\344\336G\020\031@X7H\356\332d\374r\207~"
+	.ascii	"i\245_R\351\227Q\372q\326(\377\330\242\374\313f\215Mb!(\214\231"
+	.ascii	"\023f\r\025[w\274#\225\343\342_2m\323X:\213\264)\374\026\215"
+	.ascii	"M;\206\342\265\221{\037\201\312\247\031pk\027\337~\310Byyyy\366"
+	.ascii	"C\376=\242\261=\363[&\326\314\232)\247\252\274\366\224\275\217"
+	.ascii	"D&\226\221\352\307\305e\216Q{\357\243\022\334\220yr\361\357\016"
+	.ascii	"}\022k\266Ky4\352\027PK\222{\357o\340\245\227\006F\2264\013c"
+	.ascii	"\245\004=\r\355(\250)\277E\301\216\261pV\214\225\263d,\322\306"
+	.ascii	"\331/\267`\354\333\357q\357\250\275\367\355\331\217t\033g\217"
+	.ascii	"VJyd\323-\320\316\222W\260\230\331\2648;\305\252\3318\256]\312"
+	.ascii	"5\321\322\"\333\373\b\002\004\210#\020 @\\)9U\310 |\313F\237"
+	.ascii	"\315\032\345\036[\224o\307\350\3335.G?3\240\260\231q\361\355"
+	.ascii	"Q\377\267[\254\026\213\264n6\213=\356}\334{\237D\233U\013r\032"
+	.ascii	"\332Pr_\214{\037\277\301\217\364\217 a\335,\233U+\217\306\r%"
+	.ascii	"\227\205\203'4.\340\334\355}<\002\001\302D#\213\221\227\361\255"
+	.ascii	"\226\276\205\322W\241_\3247\241\217\254Q\266Tl\025\213\264\300"
+	.ascii	"Z\371\b\022/\235\240l\263\275\217B@w\226\334\251s\361A\240o-"
+	.ascii	"\3106\317Z\220\377\201\346`\215\262}b\241Xd\0066\312m\023\353"
+	.ascii	"\344\346\323q\037\367>\n\335 xT\320.~\003\364-\3325@\331$^\244"
+	.ascii	"o3\310e^\236\315 \377\352\003X\243<d\215\362\265E\371Gk\224\265"
+	.ascii	"-\312\177iB\221+\277\025a\200\337\206\370oE\355\277A\376\262"
+	.ascii	"\312o5x\205\337D\373o\223\337?g\370K\023\371\3376%\332\177\313"
+	.ascii	"\312\034XPN\364g\243\377\236\331)\237\374\217\273\226\377m\177"
+	.ascii	"i\313\343\177\277\376\233\344\354\377\235\265\340an\345\250\004"
+	.ascii	"'\177\331\343H\2313\220\212\262\023\3344\345\222\222\354\277"
+	.ascii	"\301R\311\210\207)[\374V\203\022*\311\177\024\376\223\371K$\377"
+	.ascii	"\357\334(7SN\215]\002\034\375\247\263@\337P\0361\362\227C\376"
+	.ascii	"\227`M\034\003\277\211\346\267\026\330\r\367K)\204\310\016\375"
+	.ascii	"V\377V\350\277\225\273\245\f\362[\243\022\310]+\177\2109\\\351"
+	.ascii	"\001\037\377\225Rj\225\277\277\f;\201\356\033\312\036\377\215"
+	.ascii	"\362\021\277\211\302byQ\302\350*\257\005\1776o\305\232x\006\277"
+	.ascii	"Y\347\277\003\370\355\332\377(\277\305\362[\266\337^\371\255"
+	.ascii	"\226\337\342\375v\213]\b\376[\226\343\267%~\373\201\377\216\371"
+	.ascii	"\237,q\374\226\351/o\374W\254\264\361["
+	.string	"\021\374V\002e\tj\374\037\3007\3747\356/\271\376\227`M\034\304o\272\375w\355?\235\377y\277\375\377;\277\275\377\355\376\323\375\277\373o\347\177\317o\356\370K\006\374%\004\376\362\001\177\331\200\277L\300_.\340/\035\360\227\021\370o\232\326_b\360\227\034\374%\211\377A\177\206\372\313\254\277\264\372\313\027\177I\365\227Q\177y\202\277\\\361\227\352_\n\3772\370\227\300\277\374\300_z\360\227\035\374%\321_\376\374e\317_\352\277\314\177y\377\213\367_9\377\205\363_7\377\265\373o\335\177\351\376\213\302\177\301\374\327\355\277l\377M\373\357\331\177\233\374\227\311\177\303\376\233\344\277c\377=\362\333\n\376\213\364\337\242\377\212\375\366\374-\207\337Z\370_\346\267@\377-\362[\r\376+\344\277?\376[\371_\302\377\344\177}\374\367\204\377F\375w\304\177\013\360_\r\376K\200\377\202\370\255\360\267&~\273\301oG\3746"
+	.ascii	"\277\365\360\333\016\2775\372m\371\337\314\377\022\377-\360\377"
+	.ascii	"\355\377O^^^\336\337\033\301_\004\3643\240\202&\223\333\375\354"
+	.ascii	"\r&\2311\"U.\376\206*\375\337\356'\254\275\267\226y\334XP?\371"
+	.ascii	"\267\267\246\265\037~ [Z\017\377\361\336\377\313?\305\004\216"
+	.ascii	"[*\257n\357m\337\350#kO"
+	.ascii	"78l3n\357\250/\247\b|eE}\321\230B~e\021M!\277\266S\024\021'\""
+	.ascii	"\254\375\3454\205\334\233(*\312\351\003\257\254)\344\323&\232"
+	.ascii	"B\356\254\315\202L\226\335\307/\247\035\345\265\211v\324~\332"
+	.ascii	"H\257,\016SQ_YS\310\247,\242)\344W\326F~\355\241\035\365\204"
+	.ascii	"E\025\265\261\2106\362\213\315Fze\rM!\275\262\246\220_k\354\333"
+	.ascii	"\2133/3\356\324\r\261c\331LEm+\0308\236\260\206\342\246\216^"
+	.ascii	"{no;Ejc\355\270\275=\354\215\303\013k\356\211\206e\203\212\263"
+	.ascii	"\202R{\362\262\307\275w\006\030P`^;*\316\311\356\270\2511\257"
+	.ascii	"\275\307\240\2266\214\275\367F\200\3231n\377\260qN<p\354*\251"
+	.ascii	"\2755\354\343\3360\366v\262;n\357\355\264\367\356a\3418\356m"
+	.ascii	"ch\312\b\003\306\336\\G06\016\247,R{\337)tlYSH0/\244,R\220\306"
+	.ascii	"\335\342\350d\247\252\274\266q\317}ai\244\323\223]\265\367\266"
+	.ascii	"n\2641+F\233\213\223`#\\V\325\305\257\300\213>\372\260uQ\331"
+	.ascii	"\272\330<b\005\353-\356\342WpE\233b@\234\346\302.~\005f\332\007"
+	.ascii	"\357\310\325u\261Y\304$\3223\003\nj_\374\n\206\350\337\034b\n"
+	.ascii	"\271\273\002c\316\fbV\301\013\262\346\342W@\245\217f{\037\203"
+	.ascii	"r\022!-\262\230?L\037\333\253l\356\342\3435s\002B\344\342\337"
+	.ascii	"\f3y\344\275\345\211]\374\rd\320]\335\2316L\034f\016\263\313"
+	.ascii	"\324a\3260{\230_&\230\271\303\3642o\230'X\244\311\303\234q\223"
+	.ascii	"\206\311u\233e\207\265\346\212V\214:\027t\250\352L\331\331\240"
+	.ascii	"\305\226\311\303\224\272\223D\272\311\303|a:\345\265\030J\312"
+	.ascii	"\356\216l\2333P\\6`\213e\215r\005[\224\257A\214\276\006,\372"
+	.ascii	"\032\314\3645\210\351k\330\241\257\341\205~\006<\375\fg\364o"
+	.ascii	"\302\270i\225e\004{G\345\251\250\257\261\213\315*\244\2330\312"
+	.ascii	"\271\254,2.6mQ~\006.\372\031\326\3643\230\351g8A?\303\226\376"
+	.ascii	"\021\236\376M\026r|\232p9\231r\361-\0245o\242\2441^$ic\316\314"
+	.ascii	"\230\3301\2369\231\203\264\266fTB\225v,\245l\034\227\003\310"
+	.ascii	"\220P\20136\241\223f\345-Y\206\315\3408|\006\343\3419\354\006"
+	.ascii	"\337\231\033\243\200\351\340<\323\t\333\301e\314(L\006\2431\241"
+	.ascii	"p\034\363\t\247\301u0\035\236\203\325\3407\230\r\276\203\355"
+	.ascii	"p\035N\001\267\301p\360\032,\207\223\026\211\345`\270c1xLY5g"
+	.ascii	"D\342R\005\311\225/K\334\360\026+X\274\310\301_p\230\240ro\036"
+	.ascii	"g\306.T\330\254\032\026'j`\222HY\256 \265\341-j\311*a\304\030"
+	.ascii	"\311\362\222H\220)$\223\2700\036\031\2532^ybg\3642\305\f\313"
+	.ascii	"\301huI,\007#\261j\b\020;\022f\344n\357c\246A\205\r\225\005p"
+	.ascii	"\211e\215\362\b1\372\307o\307a\324F\2601\364\216\344Y\265\271"
+	.ascii	"\030\203A:~\273\340\212[\226\213{\266(\377\310\213\376\221\024"
+	.ascii	"\375\2431\375\243\037\372GS\032k\3013\340z\020\271\370G[\037"
+	.ascii	"\003\032}\fn\372\030\226\350c\020\242\217a\207>\006\031\372\030"
+	.ascii	"\256\3641H\351_\300\323\277\240F\377\202\233\376\205&\372\027"
+	.ascii	"\200\350_\310\322\277\300B\337h\216\276Q\032}#-\372Fi\372FH\364"
+	.ascii	"\215n\350[\260\243o\241\214\276\0055}\013E\364-\314\320/\262"
+	.ascii	"\243_d\247_$F\277hM\277\350L\377\370\210\021{\364Z\202W\344\330"
+	.ascii	"\310\217\215X\354\342\260,\354`\320\271\370zY\243\214\201-\312"
+	.ascii	"\230\b\322q\221\240\254%Q\252\\L\204\207d\350)\311\242\343\004"
+	.ascii	"!\031\350(-V\314\202` h\226\224\241\272\370\307@\360\226\215"
+	.ascii	"\023W'\355\3420#5\222fhrk\302\206t\231!\345\354n\362\302\271"
+	.ascii	"c\2747OM\362\312\261\203\344e.y\347\314\271cw\244\314\205\331"
+	.ascii	"\021\214\216\331\2239F3!:\222t\356.^\2131a"
+	.string	"A|$]\300\341M\211\241*a\230y\243\341UV\222\301,\3126\270GY\007\203\225yx\007\276\201\265\260\027\346Q\302)\335\224i0\025\266\201i`\2562\211g`\253r\256D\241\264+\343\340\027X\252dS\236\301S\370\t;\341\215\257J8\334\002\313(\345\340\252\222\256|S\322)\327\340\254RL\231\002\256\201q\3400\034U\226)\345\312;\374\243TS\332\301X\030\2524\203c`\035%^\211\246\234\203a\340.\234\003\273\300>\360\t\345\235\262\256\214\303_\345\030\213\304[%\230\227oe\230\337%/n\2355>\202\274%\261J\322\310a\246\311\333_RY\2011\232\235\311\325\241\361Ef,\251\312\030W\222fP\356.\336S)\305b\216\213\212\016&%\325\226\232\361&o\0334SaDr\230)\201\221,k\330\230r\343\314XV\375%\215\022\207\023\343\275\253\223D\302[eZ\351V\036\331("
+	.string	"U\227<\302\204\352\b\222\253\344\215\203G\242\307\020\243Y\351\004\f/L\314\306\216%T\245\026\226\213\207\267\256\332m+\217F\020\242\244P\322\340A\344\342m\272\233\274o\362\222{\037K*\031V\222Tx\253|q\321\202\234\206\366\356\021\246\244Q\236`F\310u\223\265vd\214\313x\306\205\256\f\003\362#Y\322"
+	.ascii	"+r\361\234\322\224TW_\256\235\2774kr'YR\315`Q\305X\036!\253J"
+	.ascii	"^\026Ep\030\2157\214\311\313\006\r\225\221\n\253\207\227.i\276"
+	.ascii	"\214I:\371\3130\274U\376\350\001$Y\322\300[eW\024\263\344\336"
+	.ascii	"\307#\236\255'lq\326\006\326l\326([\027\266(\277\310\210~\021"
+	.ascii	"\230~\221\226~\021\224~\205\244\376\313)/\335\3762J)\245\334"
+	.ascii	"\302\263\365\245\r\313\305Z\312;.\2604\271\370\025\322\350\377"
+	.ascii	"%[\271Vf)\261Xd\331V\252\221\250\022$Y\266\225W\206$\235P\021"
+	.ascii	"R\266\225VH|%a#\333\373h\376\340j#\327\203_\001\213~\2054\375"
+	.ascii	"\nQ\364+\240\351Wx\242-\032\244\227S0\2178WF.~\205&\332&\255"
+	.ascii	"Q\276\300\026\345W\b\242_!\206~\205\026\372Dw\372Dh\364\211\272"
+	.ascii	"\350\023\241\351\023\001\321\034lQ>\221\r}\"(\375!;\375\2410"
+	.ascii	"\372CW\364\207\314\364\207\202\350\017i\351\003\330\242\374\241"
+	.ascii	"\026\372Bu\364\205\316\350\013\265\351\0139\321\027\362\241/"
+	.ascii	"\304\245/\004C?\250\216~P\235~\020\234\376\321\026\345\007\245"
+	.ascii	"\351\007\221\351\007\205\351\007m\351\007M\351\003\255\321\007"
+	.ascii	"\352\242\017\024E\037(\210>\220\r}\240)\375\237\244\376\017\234"
+	.ascii	"\376\2345\312\377\251\242\317f\213\362\177\220\350\377x\351\377"
+	.ascii	"X\351\373\260\321\367\371\242\357\223\246\357\343C\337G\206\276"
+	.ascii	"\317\326\357\251\323\367b\215\362{\316\350\367\274\351\307\331"
+	.ascii	"\242\374\236+\372=e\272\204*\243,\362\250dA\006\312\n\307\305"
+	.ascii	"\3579\242S\260\355Q~\236=\312\357\271\241\337\363\244\3173G\237"
+	.ascii	"\247N\237\207\213~\322\026\345\337Y\243|\2365}\236\243>\017\021"
+	.ascii	"}\036\034\372<.\364u\035}M\247\257\273h\005X\243|\235\246\257"
+	.ascii	"\305\264\335\266h\r]\326\0332`\027\337:9\203w\345\232\271c\244"
+	.ascii	"\263sy\306\313\202\356\226\231J\341\326]5\327\356\246\261\310"
+	.ascii	"Kw\3476\240\273h\254\224\240\247\343\306\352\255=\371j\273\333"
+	.ascii	"\373\b\302\316H\022O\364\021Y\305\b\362k\b"
+	.string	"\030\037)4!k\204\230nl4\200\\|\354\245\255\035\255"
+	.string	"1\331r\344H\201\255\367\343\013\031\036OD|H\2617\236ha\021V&\356,\357\307\305=\257\236W\257\207\305\302j#\002\312\212\226\326\216\367z\364x\360\230\363Z\302\243\007\226\271\244y\205)\263\366\024\246\343\342\336\227\375r\267\305L\020\243\376{:zV>D\216m,\272\230`*5|\200\345\210\213\233\372\022w\361\361\347\352*\210\327\r#a\\\270\370\350\331hs\007\306\f\325\305\275\255\336V\217\353\025\236\202\364\320\251\242\003s\267\271\266>\374=\032\357q\231Ruo\310\\\334\233q7]\207\312Y\231\213{2\356\326{\023\003\246C"
+	.string	"/\364\337\213a\246A}\311\221\344b,\254^\226\205\262\257,\274\271\241\263\205\347 \201\341%K\354\bX\225\034\0300zV\030(\211\241\244\314\347l\355\214\227\225O\232,\262&\027\037\003\267\336\213\336\213\334&\256\016\327\335\032\024-l\027\037\003\263\236TO\252Gu\344\345\304\206"
+	.string	"XUrZwat\232\320]\334\243\352M\315\251\341\205wq\257\005\260G\332\226\213\217\001\227>\006Yw\356\364\242z\350x\201\343N\216\013\262d\017\352\275\250k\025d\267%\207\353\342\336\223U3#RF\311\305\207\323s\022\272\332m\312\364\234z;\b\022\243\027\027\236;x]T\027\347\331,&\330\2158\373\342c"
+	.string	"e\307\016\t(%e\246\234;kSo\336\374M\246c\241\354+\023<%a#\303Q\360\274<\315y\246c7\004\316\035\220;\03716\264\346\356\344\230s2\254\210\300\311q\216BP\323\244\313\305\017"
+	.string	"\032\235\341\224`J0C\274\270\371\222L\3466\275\031UN\264\310\204vl-s\330<\267a\322v\244\361\303\316\316db\241\354+\353\244\252\f\f\331\336\\\0374U[\232,\027?"
+	.ascii	"Qg~&\327Y(\373\352H\f\205\017>3\354\224\301\245\360\\\307\345"
+	.ascii	"\270\201\\\234\351L\343\317\022,\031U\322\b\335\321\262cIN\223"
+	.ascii	"\347\202\270t\235\371\222\3472\232\fX\315\215\035g\027\337\303"
+	.ascii	"\032}\017b\336\236\341\336r\231\362\214=n.\275\315\314\360\222"
+	.ascii	"O^<A!"
+	.string	"\356\271\314\263\334\b\022WC\226\344\314\323\305\231\314\203\270\340\332\222\027?\243\320s\244\007R\311\305\327Pfde]\234\307\\\315\035SS\305\346\342,\346n?\\h\356\302\302\360\264u\365\370\272\370\275*gn\030/\276\207.9\312\263\225(\371\213\320\224\335\233kCE\355.\0349\253*\t\326\335\236\342\372\340\263\204.\311\226\266\347/\317^F\220\270\233U\2333\372\2708w\271\375\341F\312\324\305\317n\231\313\317\303#V\247v\347\342{ \323y\213\001\376\363\334\034tv\330\271\370Y\213\0172C\220\\|\263|\r\230,w7.\316l_\243\366\304\007\216\213\017'\257\375\347)\305\200\311A]\234\325\362\025\213\374[\306\362\243PP[\013*o\027\337\203\230\276\375[N\201\375[\316T\236\253\374<>N\334\244\344.\276\207\037:\247=O\371y\354\tVqd.\276\007\036\372\317R~\236\0376Bf"
+	.string	"\271\370\036t\350{\340\322\177F\313hfZ\005\206\366\006\273b\333X\\\032\004i\221\302B\356\342w\300\3131\236\275\362\216\374e\2219F~\202\004\265\237\2068@\f\f\207\006v\n\035;o\027\037{Oh\316|\271\370\035\222\032,\367\250K\236\220B\022H\026b\343|D \311\230dX\346\261\001j\252\002ftK2\221\234\304\306q\r\355(,wHyI\3761\307$\237e'\331,\223\345\262\334\304\"\363\222<\344yG\376\372Q^\222}\244I\356}\024z\303$\215\306\020\006\273\232\rPS\025pb\227\314H\262\022\213\314I~t\3349I.\222\3076@M\355\247\257\005\210\251\"rw\007\324\246\314\334\215\214\377<v$H\355\030\346\346\342l\204\213\306\033\213\213\337\201M\377\331h\221Y\f\016Y\226:j\272"
+	.string	"\001\273\242\337!M\277C\231\316A\264\231d\0161\027\277\303\230~\007\243~\207\037\372\035x\350w\300\241\337\201\206\376s\217\314\003\t\346\215\230\213\377\314\343\312\301UA]\374\0161\364=Z\243\374\301\026\345\214#we\035?\217P\031\333\tV.~\207\027\3729\307\177\036\f"
+	.string	"\031c\345bl\357\226\263\215\347\033?\317}+b\204q\361;H\351g\256\\\343\347\t\232#B\345\311\305\347pG?\323\260\222\367\246\306\305y\206\226\342\220\314\240'\007\026\0357\266\236g\374YFY\343fY\221\207'\347b [\224\255\033\244\347-\0371\\\222g\027\237\003\027\375|es\0262g\345\253\243\275\2630\020\343\322"
+	.string	"\033\031\223\203\273\370\034\314t\276\272\034\3062\370q\213S\003\355\342?[=_\375\030\314uc\325F\300\343\214\233\334\305\227\f\351\331\35269a\n\310\305\271*W\365\226@q}\360Qb\245\315\351\342s\250\221]d\027Y*NO\007\327\007\255\245eC\307\305\347\020\245\377<u\213\314S\246\222#\257\255\345"
+	.string	"\261\030J\312l\330\024!I.>"
+	.string	"\2229*Ge\251^\f(\271\256\273\314\342Y\252\205\231\332\021s\216\215\217\027X\027\037"
+	.string	"[t^^~\342\260\367\226\332*\274\216\374\310N\317OVM\310,\005-[.\316\273\027\204\212\021,\027\037\216\t\026\247n\355\342\003\300\311\2349&\036\034\224\235\233x<\\1\306\302.6\353X\2710qx\\l\322\261l\260\334\234\035j"
+	.string	"8A\377\246\234[\244)\307\034\373\340\265\265\n \346&\314H\327\r55.>"
+	.string	"f\350\337\204c\221&\034\254\305\001\211\033:[@I\332j|\325I&M7\037\332{C\355\335\225#\2639\"\327u\327\346\246\033]F\ro\307\305&\033s\356'\016\232\027(\253\377<?.\264\264t]\374\013\342\364o\332!M;\f\244\234\362z\002C\200\030\232\222\262\273\275\275h\300\023G\r\355\306\305\277"
+	.ascii	"\213\376\315:\244Yg\032\371\340\265c` &\306\245A\317N\2175Xd"
+	.ascii	"r\2273\351\354\336{sm'6H1\334\310u\335\245\271I\347\006t\214"
+	.ascii	"\222\246\356b\323\2149\367\237\307'\331\345#j\316D\203cH\013"
+	.ascii	")\024|XD\2719s\361\231K\345\377\235\004)\"v\261Y\306\252\375"
+	.ascii	"\347\351Y\323\261\221\\|8w\373\317\203eda\002w\361/\340\021\306"
+	.ascii	"D!\214\031\227\367\266G\257+\254\315\205\365\001\016\316\214"
+	.ascii	"\273\333koc/\rlI\322\034s3\256\307%\311$\355bS\214e\363\237\007"
+	.ascii	"\350M\224\253\031\027\037\316\025\362\237'\247\031\333\321\342"
+	.ascii	"\342_\340\244oA\027\375\233],\322\354b\202\251\200E\202\\\221"
+	.ascii	"$\230\337\364b~\271;l\017\r56d\027\367\216\326(\377\016\212\376"
+	.ascii	"\3156\2134\333L\267\030\016@\202\206\245\301oF1\265\230[\256"
+	.ascii	"\214;5v\246\305\305B\333\032e\233$\242o\227X\223\212E\232TL6"
+	.ascii	"\236\251\275\2670`\002\266\245\301\205\n\222bv\025w\345\346\332"
+	.ascii	"oV1\255\230X\256\020\027ke2J\033\324\305\246\032\322\315+&\035"
+	.ascii	"\235\033\271\213;\330\242\234\341h\215r\311e\213\362-\220\241"
+	.ascii	"\177\363\211E\232O\314\264\nX\026\220s\221\334X\\\032\374\300"
+	.ascii	"\341\255ycF\271\231\366\233PL4SJ\231B\234W\230\326\272\333V."
+	.ascii	"6\221H7\243,"
+	.string	"q\312A\344b\013lQ\256\020g\215\362\025b\213\3627\334\351\337<;\273\033\036\332Q`D\214c\364CX\263\t\322lr\267\n\354\247\254\003 9\"\327u\267\261\266\006\337\220\246o\222\231Kn\226!\3152\223\211\336{k\221\223\353\"\333\\X\037\376\303yJi\222p\350A\320*D\205'\223\212\216\260\0161\220\024\302\206`\2726\215\330\200\310\3643\213K!\212K\353\311$B8db\032\376\212\302\341\217'x\n\225\322\022J\302\364D\212\376P\022\212!\244P\213<XQ\245\016\036\240J\302s\351w\364\245\020(S\272\212(\252\350\211T\005jX}E\021P\246t\325\3054\030L\231r1\005R\261\252\351\007h1hM\205!"
+	.string	"S\"\320\227B\210\030\246\030\212D\024\225"
+	.string	"\223\252\242D\0245\201\341K!\224\204\351\b?\022\326T\230\0165Y@\213L(S\376R\b%a\252\256E\021(\260)\370\023\246\"\324b\223\210\013\301`\223P8\024\366V\037\272\"-f\024Cui\035\n{I'\032\304\250\332D\304D\246\037\023\312\224U\020\207\036hX\277\024B\211(B\211\370\0236\201\240D\364\021&\335\025-*\021\177V\237P\211h\n\225\210\345\322\252$D\203\031]\221\026q\261\210\252@\340\331SA\034\376\260\272\022K *TJ\203g\017\210\026\2330Z\354]\365)\021C"
+	.string	"\251P\327b\252\204\222\220\201x\212\200\002\207\"\fK\030\246\300\246\016\200)1\303\377\227\327\366N\r\305\037\t\026\212<\250\340\207\006\321\022FkSpX4\321\001\006\241\024\252\232K\024\213\350o\250\0225\214\260\nQUm\372\021\031\021\321\265\204\212 \221x\026y8@\210U=\211!BP\032^\200"
+	.string	"E\013\305\242\242R\232$\\\203Mg\022\n<Rq\252j\007%|\033\216Va\323\320\203b\212\202\210\256E\fG\225\204'\t\350/x\3764\374\227\252\250\020U\322G"
+	.string	"\007\006\340@\001)zW"
+	.string	"\003\016\300\200\003\344+\200\001HH\f\340"
+	.string	"I\237\003\244r]W\020\202\326/\205\250\200\t]\213*\212AB'\322\365w\022\241\300!SO\361\227\256\305t=\327\242\317\204\342\271\n\025\207#p\200\256\247jd\302o\030\3745\021\177@(SZ\002\372;U\n\b3\240\242(\206\304\013*\232&\245\253\020\005\206"
+	.string	"T\317\241\t\241\025K\"\240\305\245,l\372U@\327\223\004tE\312\224\256\304\f\030)\tS&\265\003\023~\351Z\002\r\2328\205(\021\332\2046i"
+	.ascii	"\025\246A\340\211~\240\242\301& \272\364+^\370R\210"
+	.string	"\024\252\b%b\221\332C<\231~\252\251\242\300\364\304P%\002\321\024j\360LU\264H\224\002\r\022\233>H\n\236K=(0UU\364\304\320'L9\254\276\236\322Y\3020\365)5\005\211G*P\230\232\360\255g\321\307\324\244\256&\240\304b\005?h\360\374\365\254*zB\230\376T`\312d\nS&m\302\017]\372\2458\231\264P1x\236\020\016\323\020~*\206\"\212\252J\350\007L\247\007'\210I\025\326\363D\272\376:@\201C\021\324\364<\022\246?\264\330\224B\365\361\245h:})N&\241\242\321\212\026\223\222\206>(Q\305J\224\341\202\265\211(L1\240'\322\365<\221\252(p\203OI\230\376\324#\3400UQ\"\312t\252I\276\237Z\364\245\305\242\232\001\230\372\326T\330\0044\"\230B-\n\255\3053\311\007l:M\370\212M&\212A\252\260\350K\241\372\320b\223/\251\250\376\204\212#"
+	.string	"S\342\317\212%\037\212SE\320\212%\337\320\212\245\245\337:\024\256_\n\001L\211\"\216@\260E_\0220%\346\021l\b\366\003\013L\211\345*L\207#\020\233\200\302\264\003\030|P\234\037h*\001L\211A\302T\204\265\003`J\034Z\177hRR\321\252\242\304\024\250o\r\246\253O8\\\221\252\303\245#\0248\024A\305\232\2368U\n\244\253\360\024*\341\2020=)\240\016\327SE-\220\200\342TA\024D\177\277\016\320\365T\203\200JC\300\340p\251\210\252K\253oE\213G(S\272\366\2508\203(\320\307B\221\007\300t\204\3654q\242H8L\327\022\200\352\211B\035\202"
+	.string	"D\321$#\024\247\n\237P\317\212%\337\210b\361$\242\030\006\211T\250\350\211\341\017U}K\305S\375\005\005\031\255\303\241\324GIx\036\025\323\024\247O\251\311\004\n\304 LO%\242\"\223\017x\242K\247\t\303a\320\247\242\302\364TW\337P\375\235\031\204\351\2514D\244\016U\025\305\220\2244\\\233~>_\321\304Ya\204\212\256\3014\251\302\212%\2370]\261\304\244\242+\320\002\n\034\2120B\t\033\326\224)\275"
+	.string	"\032T\022v\200A\230\236\024 Z\321\"J\202\212*)\245j\t(\206\301`\007\036,\375\204Mg\360\002\037Zl\252\220\342\f\242\252\017\305\251\302\007D\327SUBWajaE\252\236\2500\275\300ZlR\227\326\"S\230\236J=\350Ox\236"
+	.ascii	"\236@\240\265\211\2706\r}\352p\0352U\310\253\260i\370\363\005"
+	.ascii	"\203\350\3177\\\233N\f\276U\210\246E\341\251\256Gkq84\341KJ\322"
+	.ascii	"LD\325'L\231~\200(J,\372\21420%\006\241\305\023U\177\302\024"
+	.ascii	"\r\002S\"bpHT\321U\230\372\222"
+	.string	"\222\210|)N&_R\022\221\t)\261\350KJ\nR\207\353\357L\362-\255\303!S\321\227\22444$\246@}\350\t\265\351\347K\"\006}B\025\300\n\350\357T}A\364\004\032\024\022\016\323\365,\nQ\"\323\360\347S:\213\276\3654q\302\350K!\206\206\351z\252>b\017\375\245'P`\376\375N\037P\035\376P\265GI\230\002\207?!\252\327/\205\020\361K\302@=\227~\030e:1\200\006\323\244\241J\364A\327\223\204\340P]\205\303_\221\002\200\251\b\352\322\332S\300\220\230b\002\352\322\252\213Et=I\370\251\275!1\305\004~j.\242\353\251\232\037\2040\202\272T\202P\005\220g\025\246C\242\t'\252\232\360\235\3045\b%\252X\213V!\372SQ\242/\270\256Cui\275\260\246Li\320\207\256\247\332\203\002\207\"\234\304\265\367\245\020\305$\024\b\f\242i\222/\305\320\204\t\2773h\202"
+	.string	"E\2370\365\255B\364\304\004\224\206\027X\227\224\322`R"
+	.string	"z(P\241F\233\202'\007\326s\030\004\001\005*\004R:\203 \254\3470\230\304\263\366\316\365\374\340G\302Z<\203=\305a\2230]\205\303\237\20658\034J\300g\252"
+	.string	"\236\250j\026}\350z\256%:"
+	.string	"\242L\351za\365\215\330`\355`m\032\242L\351\312\263\256\276s=?(\n\207\351\232\026\207#\024\205\232\210\350Z\304\347z\002q\321gA8L\327\237\260\t\204\n\250\017\005\016E@\201C&\274~)D\021"
+	.ascii	"h\360\374\225\020\"J\321t\n\255_\nQD\201C\246\f\037\022QU\304"
+	.ascii	":\034\252\"|\210\350Z\002(D{E\037\252$<I\370\005\021\321\265"
+	.ascii	"\304\252\236k\221\007U\022\236\252\251\224&\t\207\253O\001\253"
+	.ascii	"0m\352\245@\201\302\020\202\250Px.y\260\364[S\024%R4\235F\253"
+	.ascii	"\217\003\244U\2306\351#!y\300a\003\030\240\200\376\205(\372~"
+	.ascii	"\252\210_\222\baz2\211\370\251E\021!.P\321U\210z\260\nQ\246\265"
+	.ascii	"\330D\002\3409\364\277"
+	.string	"\207%\327\215\275\270j\322\273\322SkC\307\013\326\305BPXt\275\220\"\245W\305G\001\304\304\276\332\252\364\250\264\345\330D\250L\031\001\r\213\2734S\254\207E^\035\034iw.k1\251\353\221\027E\n'\221\203\303M\017i\272\311c1j\260\365\320zYm\252z@\301\303ssX\350x\362$\243\352\214\314Q\t\231\016(;.\356\231\365\314zN>\364\224\325k\362\236\223\317\311\301\242\013\031&\231\316\355zC\347\256\214N\214\223,a\367h\306\245\344E\0212s\214\207+\371\346\254\247\244\027\225c|\225Y\222%\310\350\202\214F\017I\217\352m\r\211\222\213y\310\320\346\324)R\244g\244H\317F\225]\227\330{F\256\220\033E\205\213\312\305=\343\245\342\221\263A\207\206J\314\225\035:\027_"
+	.string	"\001\205\267\250C\002\225R\226H9\210A\246\020\032\032\221\231m:\023\025@0pD\"\026\016w\311=\023@\003\212\252\325\221*\347\234R\204fDD\222\242\202\202\324h\f\244n\212\303\315\352\257b\300\371\b\307\312\"\273mX\342K\221#}"
+	.ascii	"@\323\020\200\317I=\237s\253\252\376\337g\230N\024\326p\340\257"
+	.ascii	"\027 v\211Y?\376\361\244\020\r\002\342\302\374<\333\264\b\265"
+	.ascii	"\370\265Oo\251\256\211\032Ei\373\f1\034\325\204k\376\"]\204\355"
+	.ascii	"D\217\255y\260\303R\332\362\266\017\214vx\336'\250\021\302)\326"
+	.ascii	"\311@\375\203\352\224\024\222kC\206s\360\272\261\016#s\241\376"
+	.ascii	"\231\241\340}k\214\371\220V\216b\242\264\367\224\227\236\n\022"
+	.ascii	"\007\021~+\326\263\2342(B\373\260\210\203\233\026\356\3501$L"
+	.ascii	"\233s\365Z\007:@\333]j\004\232\266\231g\332?\031\235\037\031"
+	.ascii	"\027^\3502Ds\326\026a\373\254\327\373\223\0037\374\006|ph\250"
+	.ascii	"\033\027\216j\316\357\334<\016\254\335\215\326g?\265\031\035"
+	.ascii	"=\3420\030\261\346z]\315\202\232|\036%\006V\027f\360\225/\207"
+	.ascii	"\023\026\007\221\333\002\366\013\n"
+	.string	"d\302\314\2548\"\225\356\214\323*\256h\371\377\021\266\363V\177\2078\341.lpT\035\200\326|[\253\224,\230\3156pr\243b\367\025M\311\244\205Z\371\311G\263\203q\242\227\306!B+C'\255\221\215SZ\t\021\354\002*A6\315j!\017\t\354\315@\n$\226\204\205\337\026\315B\275\374Z4\313l@5\350\301\320\230\300*\205d^\003R\032\363)\026SFY\221C*j\006\241\304!\260sr\264\f\022|\222)$\340\337\256IM\233\2574\223(?s\302|\203\036\244\330\b?\341:\205\233\314\254U\017\036\317\200\237\336(\02758\023\3156\234[c#\376\234\035\345\251\033K\231\207\216u6-\257\006\345\257\242*\b`\303\001\315\351'\307\371\341\312\024\037\330\224\t\242\315\006\304\331h\351v\316\367\027\3540\356\277|\300\264%\252\025\265\365\276\333\352\235\260T{\307\247`\245M\225\265:\362\262\276"
+	.string	"\315\221&\277\3441\377we\016\017\351\2361e\265\246\372;B\210\026\335\325\203\334\347x\222wO\371\b\030R\273\001\200\335F9et~\273Kxb\233\020Xd\223B\"\247\306\365\347\244\001\234\200\211\312\245\"\235\332E\317\371\036Q\363\033\230\270S"
+	.string	"$UD\007\250a\304Q\330\233\276\275\231h\215[I\310\344\340\246\234\211\323\332O Yr\271p\236!8\320^H\3625\005;\232\300c\320\223\300\023\f\342\\\333<7\210\366\274j\223:\363\203\362\301P\031\242\006\360s\272\\}\203\310\022K\275\fd\233\320I\177\234}\017(\234&\034%\317\005\205C\334"
+	.string	"@\343\020\273B\200\330\003\026\317\377L\3132#;\035\005\033\354!\b,*\255\215i\344\334\302\300\271\337\364\004\324a\276\347\302?JK\036f\301\313\372\027"
+	.string	"\221/\316?0t\013j\232\262Sr-\364\026\210\224\347R[\317p\035\bw\207;4E\027J\251??\326\0210\002\214\244\257%\245\030\216=\321c\351]\252\241h\301o-\277V\260\003\326\037\016\020\350'\026o\204S\257 \326,\272\023}a\340dI\021h\365dS\026U\003\333j\332\322y\004\265\315-w\374\353\245\264\360\b\002\321\016l\221O;=\206;I\032|\250\212(\021h\262\261\310e\312@_ff\343\343\f\347B\241\313%\261\353t\027\275r\314\361\0355\216\342_@TI\316\360\272\363\213\271\222"
+	.string	"\246\005%\037\201h\221\263=\3512\321jG\352\226\005\256\273\r\313\013\261e\r\362BF\217\024\372C^\034\222z#\331\f|E\033Zi\336d\"\253\035~dS\235\016\2126\357>^\322\"\177\211)\363.\365\323{v\250\373\250\n\360\222\326\013\357)\324\245\300-]\355\334\375\330n\363EY|A\003\362B\2470\274\222\221^}\262\232@u\250\302\266\032\261Ab(\226\374\237\306-N\212\240\322,.?\230j#\224D\265\274}V\317\"9\245\365\316\247\323Y#U[\375~#o\005\215"
+	.ascii	"\254*\366U\316\207\314\352\210\241\t\247\273\200\230{_\242\362"
+	.ascii	"k\275\215oe\375gn\307\237\252n\204C\304\016\346\200\330\3431"
+	.ascii	"\255\036\262R\347\343\232b\302z?R\367\233@\007\375\2318\313o"
+	.ascii	"\276\330\212\262\277s!\302\2038'\205\005\377-\215\275\033Y\306"
+	.ascii	"\352)\250\341\246\013\370\362\322Mp\\\273\220\254T\247u\304%"
+	.ascii	"+\322\246\253\231\020\335\255\336\362)\325\034\334-MU\223\361"
+	.ascii	"\033\214\364K\214I\375\205\207\030\243V\030\265\273O&\275\342"
+	.ascii	"\356R7c\0164`\205\003\260\220\327K\255\001c>F\266\344\275s\361"
+	.ascii	"\002\252\003\256!Z\253J2'\025cZb\303\340\006\023\366\027\200"
+	.ascii	"\022\304\316B;g*\243\3058\027k\337\322\234\030\305\307b\3068"
+	.ascii	"\205p\021\312\355v\340\313\367|O\b\236Q\364\213\325\265G\231"
+	.ascii	"\241\023\264\300\222\317IQ\315\027\220\213\346\201j\033z\274"
+	.ascii	"\367\373\353)\262\007\217B\373\fV\263E\373\267\310\375\306\351"
+	.ascii	"\341b\350\304!|U\330C\264\032\323\357{\305\320\252?\225\300\272"
+	.ascii	"\320\230*\357\353\261\265\226W$\353\336\261!/\200\233\316\332"
+	.ascii	"|D&\025\307oJf9\210pfM#\220\366\205}\316\361h\235\020r\364\215"
+	.ascii	"9\013\262\0363*\003R\375;.\243TF,\030?E\221\255\225\221ht\241"
+	.ascii	"\301L\247\034\324s\326%b%\022\351x\245\353d\257\3361{K\037\b"
+	.ascii	"\2607wYU\240-\306\347\251\334\262,\226\200\352~\237y\236\377"
+	.ascii	"\2078\357?\022\007\bA\212n\324\310\221,L\230*\206\2277'\301\217"
+	.ascii	"@_\004\"\262\022\217\316v\254\372\270\235:])\372!\255E\360\240"
+	.ascii	"\b[^c\343\"\241\264\343\222\360\031M\333\360\005\002\032\r6$"
+	.ascii	"zCG\343\367;\235\002\350aK\231\177P\203f\036j\365\r\223\214\223"
+	.ascii	"\214\036L\374n\225O/\t\346\332\224X\212\023o\260b\327\2372RY"
+	.ascii	"o\252\273\247\357\341\013\265A\216\266:\256\252\352\344\243\363"
+	.ascii	"k\347\353\260\310\213\234\013\201\234\016\360:j\323w8X\322&\241"
+	.ascii	"\205\026\272]\246\0369\364y\376\206f\\>+\273j\230 \333\235\b"
+	.ascii	"\314\374,\246t\242\361\237\202\\\215\207a\261Xga5\353/\0349\177"
+	.ascii	"\244N\245\033\351\363\342\f\331'\303~\342\006\323\243\212\366"
+	.ascii	"\240L\254\351LH9Xv\213\244EK%\2733\215\251J\"/\367\374_\r\211"
+	.ascii	"\220\334\363\227\225i\311cW)\r\237t\350\270\255\211\242`8"
+	.ascii	"q\353\346\260B\f\031\023\203l\242t\234P&\2167V\275\220\034-\313"
+	.ascii	"\257\331Els\354\271n\360\016\224\351\336!\274\235\022\223\237"
+	.ascii	"I\2633-\223P\034\b()\345\317\215QC<k\312\200\341\323RM\217\206"
+	.ascii	"\272\234qm\213\257\036\376\260\322\244\216\030ei\3228\276\216"
+	.ascii	")N\b2\302\241\303e\344\221\213\233\261h/\025\376\247\256u\352"
+	.ascii	"\377\013\224\235e\245\346\361v\317\362\261\364\331A8\317%\203"
+	.ascii	"\326\216\301\230l!\361\353}\277e\023d\2765 -{N\225\300\370\232"
+	.ascii	"]\304p\314(5\241Y\323<G\355\212\032_`\244\026\332\370UD\016\320"
+	.ascii	"\246\252\211\240\324J\353c\314\177\322\214)\364\371\203<r0p2"
+	.ascii	"\362r\305\022\007J\\\350J\277\322\343\367\317G\327\020\242\247"
+	.ascii	"m\345\261\323\270d\367\270\335}]e'\331\311<\fP\002j\2017:\016"
+	.ascii	"\224\210\032!\235\366*\371gk\253\b7\361+\244\021\3125\033\325"
+	.ascii	"\200i\351\\\227{9\004qPxpJ@Rd\345)~hk\271\013\321F\223s\300\226"
+	.ascii	"\013\352\310v\357\fSb\253\t\245\3570\220c\377\0240\277\306\251"
+	.ascii	"H\205\231\261\322\360q\210\336\232\333\372!L9\320k_\330\251\021"
+	.ascii	"\337\222\276u\020\344\344\321\325\365HJ\030\221\001)|f\323\007"
+	.ascii	"\301\347\340)\013\307\232\024\027s\330_\254gmW\360\216\307P\311"
+	.ascii	"G\235B\306\303\361\362\017tnk}Y\344\203@&j\211\333\306\247\311"
+	.ascii	"\364\314x \356%\023l\345\340\254\013m\2644\013\302\260\263\222"
+	.ascii	"XQ\317N\262*u<\311\003%\323n y&M\327C\244\005\255\213hb\314X"
+	.ascii	"z"
+	.string	"\346T\301\031L\311U\272aK\366\333\3313f\363\004\232\f\255\026\305\230aG\342\371\316\030,\350\375\322\005\336\230e\314\301\310b\256\343\376\376\350\322\t\027\364\271\225koJ\261\265+^\310H\356\203\256EI\2704\301\223\212fm}s}\237\327\013\310\264\360\300\272\343e\272x\200\237\322\233\261\271\206\355\376\376\312YK?d\270\373\203\212\rmrhp\211n&#*\370\250>\3168\234+\202\227j\264\340\310J:\311\311\025\004M\231\354km\274\354\221>\005\324\370\251:\037^!\001\274\203\206\327\246DI2\023\250*\241F.\322\020\207\242\264\203\301\210l\231\255\271\322\355<F(\225\357O\22163Q>)A\220;\253\n\301\261\034\242\354x\313\3201\346Fh(\334\304+Ur\370\b\324\3461\334\252\250S\346\216|\221E+?\337/\231\022\317A\317\320c\314_\335\335\301 \300\327\344\005\266\275h\022"
+	.string	"\356\250[\233\371\033\233\030\347\341b\252\025 RM\252\314\337\356aH#\013c\"Pf\023R\204.\362\211\377\005\365\211\021\b\310\222\001\253\270\f&@\377\314\211\002\351\331#\347=\020\3255\031T,\334\272hA\002\302\025\021\330\337\226]\323\2528\213\302/\216\266G7K\"\225B\020\334`)\332\376\001\021x'\245\376\022\022\230\373\200\337Q\223\307tT\341"
+	.string	"(K\233\035\030nJ\205\025\007p\365B\370}^P\230\233\0074\347m\223\220\210?H\354W\276\305\260\244\303\346f\006s\325\312\023\273\237HI#p\033\250\250X\303\020\002\334g\340\242\221\216\216\212c\345(\371\275N\001H\f\001\244\341\272K\303\nl@W\256\311\234\316m"
+	.string	"\260\031\360*\026%(\202\315\202\004\"\231\333]\232e\200\227\364\257\035Zj\2179\245<\305\223\370_5q\364/\220\006\033#\304ki\017\367w1);?\332\320\257\342\265\334\243_^\237\237\375\210FD`0P\226\342s\021\317\247\247C\277\3100\340\317\033\335\221$Zi\232\223Z\374h\211U\016\342B\361\023R\371(\364g\215-9\243\211\233\343\"\324\3175\2153\177\355"
+	.string	"n\226\304f\303\347\017\263\355[\312\007\266NT\037\013\367\357V\254\333\023\331\251\252b\264;\307\330\301\214\277i2\326\374`\027\327\301c"
+	.ascii	"\336\320\365}\312x\235bo\007<\345\262/t}B\235\002\326\027\264"
+	.ascii	"\270\017?\347\310\337\001\245}\371\201\253>\3543V\335w\321\013"
+	.ascii	"\r\267\347u\002m\204\026k\210\333\220\230\017\225\275\006\253"
+	.ascii	"s\337N}\353q\201IYm\361\270JG\353Nc\244\177\t^\356\267\223\364"
+	.ascii	"\266?\303\240\017\332{ \367M\241\305&\307\"}\231\261kQ?Y\223"
+	.ascii	"\031\021\375I\361\337*\336\253kJ\205\247\365\243\242t\276\313"
+	.ascii	"\253Z>\301\ng4\037\240R\375-\243\321~\267\342\013\023\361#\303"
+	.ascii	"#\226[\376\r]\316c\335\325\252X;\267\027Y\317\345BW"
+	.text
+	.section	.gnu.lto_.symtab.929ba6eeb7fe4f04,"e",@progbits
+	.string	"adjustmentRanges_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\002"
+	.string	""
+	.string	"processRcAdjustments"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\003"
+	.string	""
+	.string	"activeAdjustmentRangeReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\003"
+	.string	""
+	.string	"pidAudioPositionToModeMap"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\003"
+	.string	""
+	.string	"adjustmentRanges_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\003"
+	.string	""
+	.string	"adjustmentRanges_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\003"
+	.string	""
+	.string	"blackboxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\002"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\002"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\002"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\002"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\003"
+	.string	""
+	.string	"blackboxLogEvent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\003"
+	.string	""
+	.string	"initRcProcessing"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\003"
+	.string	""
+	.string	"beeperConfirmationBeeps"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\003"
+	.string	""
+	.string	"pidInitConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\003"
+	.string	""
+	.string	"setConfigDirty"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\003"
+	.string	""
+	.string	"isRangeActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\003"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\003"
+	.string	""
+	.string	"changeControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\003"
+	.string	""
+	.string	"getCurrentControlRateProfileIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\003"
+	.string	""
+	.string	"rxIsReceivingSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.929ba6eeb7fe4f04,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1448 @@
+	.file	"rc_controls.c"
+	.section	.gnu.lto_.profile.4fae565055c26339,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.4fae565055c26339,"e",@progbits
+	.string	"(\265/\375`\223"
+	.string	"-\007"
+	.string	"\244\t\207\001"
+	.string	"\030"
+	.string	"\350\300\306\254\005\002\002"
+	.string	"\002"
+	.string	"\001\242\302\263\302\013\002\302\374\277\243\n\004\002\001\002\002\003\240\342\234\212\n\004\303\375\206\360\n\020\002\003\002\004\002\005\002\006\002\007\002\b\007\005\b\240\303\272\361\f\\\003\002\003\002\005"
+	.string	"\002"
+	.string	"\003\002\t\007\002\007\002\n\005\n\002\n\t\n\013\f\016\020\220\237\222\215\004\002\021\367\372\342\307\013\004\002\003\002\013\023\344\371\276\347\t\024\326\352\245F\025\026\253\262\211\366\t\027\333\314\243\214\005\030\031\353\227\221\315\013\032\366\336\365\327\f\033\034\240\342\234\212\n"
+	.string	"\" p\202R\311\016\310W\336wt\372\261\036\254e\310y\214M\322r\221\036}YhvK\322\231\021\3216\030p\260*\346A\030\002t\t|\004[\300{"
+	.ascii	"\201\303\"\260\276Fh\255\005\374\031D\334}\263\346\302]\310\205"
+	.ascii	"s\003"
+	.text
+	.section	.gnu.lto_.ipa_sra.4fae565055c26339,"e",@progbits
+	.string	"(\265/\375 \204\265\001"
+	.string	"\350x"
+	.string	"\006"
+	.string	""
+	.string	"\003\002\001\003\004"
+	.string	"\003\b"
+	.string	"\001"
+	.string	""
+	.string	"\020\002"
+	.string	"\003\021"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\n"
+	.ascii	" \007\327\240&\fS\365\305\264b\327\335\334\215\025&2W\201\001"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.4fae565055c26339,"e",@progbits
+	.string	"(\265/\375`M\001\335\006"
+	.string	"RI\036)\2205I\007yy\252\370\324\347N\227\36390\330a1\212\261\302ez\217\375\rv\027\322U\356\231+\336Mk\315\223-e\n\3777\344QN\300\335=\033\312\260\274S\262\352\356\230!\376\317\3427da*E\3420h\325\347d\217\004\202\006\017\026C\373\251\202JD"
+	.string	"\321'\303 "
+	.string	"\b\003\207\327\377\222\f\262\337)\347\266\350\344\356\234{\243\345\025m\237\221\335\335\255_n\", \300\"\233\252\016R<\300\375\200\031L\334-v+.\004h\325\366V\246O\"\271"
+	.ascii	"\016\006\t\340\270\336v`\270\006\005\fJ\035\214\013E@\\A\335"
+	.ascii	"\200\r\t8 B\204\203\376 \217\021X\204\021X\350T#\017\273$\314"
+	.ascii	"^\341:3\222\336\221\255\205^\360p\007s\274A[s\253j\306\r"
+	.text
+	.section	.gnu.lto_.jmpfuncs.4fae565055c26339,"e",@progbits
+	.string	"(\265/\375`\371"
+	.string	"\275\006"
+	.string	"b\311\034%\2205I\007?/\376\344J:\223\376\377\217\231\320\277\266m\273mW\377o\332\fT"
+	.string	"|_\017\374mE\210L2$\371\221\013I\327\240K\371\022\006\270e\230\023\244\223\322\216\242\254h~\330\332\317\265\214\035-\256\215\256;n\225\232\002\327!\377\370\326\320=t\235\215\262\244\341\017\2673 !\0264\254aG\253\266\254\332\\f\\K\252\244+}I\036\037\b, \260\202\t\222\252\003U\2411\024\322`\252c\312\346|\022r\220y\201- TN\211E\271\334\221nwH\310\245\311\201!B\260n\247\350\013\216T\027c\030\265\231\030!\017"
+	.ascii	"d\2127\n\254\033\204P\374r\241J\025\336,W\272\250d\304\326*'"
+	.ascii	",\bI\327:\314\214Y\255U\222\243\256+\334\020"
+	.text
+	.section	.gnu.lto_.pureconst.4fae565055c26339,"e",@progbits
+	.string	"(\265/\375 \027\271"
+	.string	""
+	.string	"\023"
+	.string	""
+	.string	""
+	.string	"\006"
+	.ascii	"\204\004\002\204\004\004\230\004\b\230\004\020\204\004\021\230"
+	.ascii	"\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.4fae565055c26339,"e",@progbits
+	.string	"(\265/\375 ~\225\002"
+	.string	"D\003r"
+	.string	"\005"
+	.string	"\001\002\026\001\002\001\300\007"
+	.string	""
+	.string	""
+	.string	"\001\002\027"
+	.string	"\001\002\030\004\003\002\031\001"
+	.string	"\002\032"
+	.string	"\001\002\033\001"
+	.string	"\002\034"
+	.string	"\001\002\035\020\002\300\007\200\021\001\002\036\001\f"
+	.string	"c\020\002|`\005p\340*\254\0075\001%\b7Ga\336\335\331"
+	.string	"\026o"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.lto.4fae565055c26339,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_rcControlsConfig_Registry.84.4fae565055c26339,"e",@progbits
+	.string	"(\265/\375 \237\255\004"
+	.string	"t\bi"
+	.string	""
+	.string	""
+	.string	"*"
+	.string	"\005\001\212\001\206\200\200\374\342\303\315\321\025\030\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\335\007us\357\006uq"
+	.string	"\005\001\006'\001\005\005\001\006\035\001'\001\031?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\034./src/main/fc/rc_controls.c"
+	.string	"\004"
+	.string	"\236\n\013f\361\024u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_rcControlsConfig.86.4fae565055c26339,"e",@progbits
+	.string	"(\265/\375 :\255\001"
+	.string	"\244\002-"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\177\001"
+	.string	"\005\001\006\035\001\001("
+	.string	"?\202\210\200(}{\276\001y\276\001w\275\001u\274\001s\273\001"
+	.string	"\003"
+	.ascii	"@D\312M\003(\002"
+	.text
+	.section	.gnu.lto_armingConfig_Registry.90.4fae565055c26339,"e",@progbits
+	.string	"(\265/\375 \240\265\004"
+	.string	"\204\bj"
+	.string	""
+	.string	""
+	.string	"*"
+	.string	"\005\001\212\001\206\200\200\374\342\303\326\221\033\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\365\006us\315\006uq"
+	.string	"\005\001\006'\001\002\005\001\006\035\001'\001\220 ?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\034./src/main/fc/rc_controls.c"
+	.string	"\004"
+	.string	"\236\n\013f\361\024u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_armingConfig.92.4fae565055c26339,"e",@progbits
+	.string	"(\265/\375 %\025\001"
+	.string	"\320\030"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\005"
+	.string	"?\202\210\200\020\177}\274\001{\273\001"
+	.string	"\002"
+	.ascii	")\242\f\240\b"
+	.text
+	.section	.gnu.lto_flight3DConfig_Registry.96.4fae565055c26339,"e",@progbits
+	.string	"(\265/\375 \237\255\004"
+	.string	"t\bi"
+	.string	""
+	.string	""
+	.string	"*"
+	.string	"\005\001\212\001\206\200\200\374\342\203\336\361\037\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\307\007us\336\006uq"
+	.string	"\005\001\006'\001\016\005\001\006\035\001'\001\032?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\034./src/main/fc/rc_controls.c"
+	.string	"\004"
+	.string	"\236\n\013f\361\024u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_flight3DConfig.98.4fae565055c26339,"e",@progbits
+	.string	"(\265/\375 W5\002"
+	.string	"4\003J"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001'\001\320\017\350\0072\264\013\352\376\n?\202\210\2008\177}\301\001{\300\001y\277\001w\276\001u\275\001s\274\001q\273\001"
+	.string	"\007"
+	.ascii	"*#\300!\314\306\2004\225\313)V\017\240\b"
+	.text
+	.section	.gnu.lto_isUsingSticksForArming.99.4fae565055c26339,"e",@progbits
+	.string	"(\265/\375 \347e\006"
+	.string	"RL-3Pm\222\016$\243\252\022\252z'U\023\216\332@\226\220I-\377\226\354\252\375\273\035vv\347`N`\020;3\213(\242\357"
+	.string	"\017(S\217\315Z\373d\313\024\273\314\306\341Q\034\315s\t\216j\216\241i\032\024\036\232\2436-\023\360\203X\240\032\347=\252a\256,\033!\033"
+	.string	"1\211oHE\252\313qD\007ku\272\035K'd"
+	.string	"\026 ,\375\365A\226\361\255df\316F?\216\354\342q\"@\222\031*\245\244\311T\322\361{\036\263\301\201\347\252\327F\250\030\244\211\021\224\314\2531\215V\305\352\026\244\225\217\013\222%\372\024/\b\2319Z\242\212\316\372\023\374\005?E\007"
+	.ascii	"2\001\0238#&\016\345\256!K\210\034\356\234\251\235O"
+	.text
+	.section	.gnu.lto_areSticksInApModePosition.100.4fae565055c26339,"e",@progbits
+	.string	"(\265/\375`5\001%\r"
+	.string	"\006\032YA\020\257&\035\250\201\241\207\n\023\372U\002\t\324-l\"^\204\222\313\024\237\223\341J\230\260'\377[c\3751\324\321\203\3218\021C\024"
+	.string	""
+	.string	"\2004\324\205\216\201\003\320}lI\343\333\030\t\331;\311\224\002H"
+	.string	"A"
+	.string	"F"
+	.string	"\026@\371\241\003P~-\320\251\307\333\005\027W\210\t\231d27\353\026\354\361sGO]\205<\r\023Z\210\264\217_\004\273\215\366"
+	.string	"\257\241\2558\216\314t\007c\213\246\202X\205dfQ\244Ap)\267E\320\226@k\t\001\265\313\314\354Gm\261\032\227\354\214c+\207\245\034\3669\254;\366\016\213\016\353MU:\261\241\"\323\345\364\"M<\230\fm;\355\246\355\261\365\006s\350\270\344\240/\223\302\b\021\231\333G;0\374"
+	.string	"\004\247L\037\006az?`\314\314\317O:\262x\211YA\027\375\335\315\262\"\343\277#\021\232\361\361F\301\"\323z\370\245!02\323@\355\301\037\032\324\030\374\312IA\213\374\352\024\312\317\337H\001\003\302S\273}\360\244\006$\t\260\022\221\223\221\252\027\b\207\001\226\241\230`\227\310\225Y\227\002\313d\301H\211ue\034\013d@\261\023\222\314B\301\260\314\332li\227\037\025]\207\361\036\256\336\322Vs\016\320UZ]s\207f@x\242\336I\356\356#\352\256\304;\025\031"
+	.ascii	"L\204^\350\206\0275E .\210\001n\300n\025l\001e\300\270l\220\003"
+	.ascii	"r\345\020\214G 1\261^\202{\025<\244\272\200\270\346\300\312b"
+	.ascii	"\203\017\201h5\344U\205\253yo\273\212\036"
+	.text
+	.section	.gnu.lto_calculateThrottleStatus.101.4fae565055c26339,"e",@progbits
+	.string	"(\265/\375`\262\003\275\027"
+	.string	"\006\253\226J\300\224Q:y\003?&\204\024\215k6\254\005 0\307\317\376\302\374!\310\252\337\302\234\252\270-+\210\212\004\372\317\037O\346\360\360\210@\360x\0263M\305*\2010K\255C~b\263\241A\3114\007\303b#\255%{\023)e\n\203"
+	.string	"q"
+	.string	"\212"
+	.ascii	"\271\222Iu\232\301\022\377y~\362\273b\225xN\013\177F\273\021"
+	.ascii	"\b\005\264\224\244\326\037\214e]tg\270-\272\263E,m\311Q"
+	.string	"\225\022\351\f\233i\337q\327\263\344\250Jmo\007$\3516\260\2705\017K\303\026\242\246\241\005\242\353\020\272\236@\b!w?<\201B\326\356\026\262\324Z\311\235\017w\330R\344\006\222\005\242\343\020\272rG\270\355-\007\355l\314\242K\255\365\214\333i\330\257\366?\214\377-\177\237\b3\026\273\266\206\376\025lxq\334\254\027;\326hI\021\033}\ft{\0020\310\215\227|d\226\2727\364\227]\340\305mooW\350\005\223\323\255{\376\237\215\233\367o\227eY\276\213\376\363]\223\277B\371\255\311W\t\371)\223\2172\371\254\311?\241\374\325\344\223\224?N\276*\344\247&_\244|:\3713\344\207\315o\3463\363\027\300\250{\022\300Tk'\tV\307\013\323\252\227\006\224olR\301\346\3001v\001\250T\253\2027R-\232`\222\"(6o7\304\021! m\336\305\017\300&\332\342\202\255\3612ci0h"
+	.string	"\003Cw\322\206\215\360\205={\201\242j\\\276V\206\203T\255\365\300\027\306\306x"
+	.ascii	"!&\246\247\021$J\2025.\037\3254\2444W\206v\263\212?\302\272\220"
+	.ascii	"I\325z3\360m\261K\022\276$v~\206f~i\032\001\224\257\306\345q"
+	.ascii	"\364P\030\205\315\373-w\217\275t,\310f;8\262\330Ll\006\213Q\200"
+	.ascii	"\341\330\320\334\300b3\035\330+\300e953\330\216L6\203\221\377"
+	.ascii	"\377\253m\027=\207E\324\270K\243\333[\225S\217\b\375\322\250"
+	.ascii	"\253\203\376\273\372.\265\266\205\225w\b\035\361\215\315\373"
+	.ascii	"J\253t\206V\257\374\360\321\352WJ\253\364\340\221\322\363\251"
+	.ascii	"\211\022f\362\311!\251PZ\325\254$`\023J\023\030\362Cd\343r]\271"
+	.ascii	"#\\\212\325\252\336#\340\217\223&\233\325\242\217\037$\033\227"
+	.ascii	"_uG\250Q8$\031b\250\2102\222\322\202\264\001\240\002\031!\333"
+	.ascii	"9\020PU$SAZ\016\225*M\220\266A\002\002\351\f\\\023\274\037u\237"
+	.ascii	"\207\217\254T\236\242\216n!\216kLO\335m$\b\375&\256\247!\203"
+	.ascii	"\341\204i\0072\266\214\244\257\007\200c7\222+\200\203U1\3116"
+	.ascii	"@\301?\212|\003+\037X\271\022q\323\206\215{@\020FM9\315\200\022"
+	.ascii	"\356\261\374C\b\003d\353\236\351\204\242f{\361[\024\261\225\313"
+	.ascii	"~a\b\243T,\021z(+\004\333\300)\337\242H\327\327\273\032"
+	.text
+	.section	.gnu.lto_processRcStickPositions.102.4fae565055c26339,"e",@progbits
+	.string	"(\265/\375`|\033%u"
+	.string	"\232\265\344(M \220\342\031\003\337\016p~\3607\300\220\005o\200\023\306\215\036\005_(pf\346\001\0019v\336;\325\354\367\306\211\031K\305\f\316\201\003a\311y \230\333\345\214R\365t\237\343\255"
+	.string	"h\240r\257E\323\352\202\364\020\021!RJ\231RJ\001\207\002<\002\217\002e\321\037\377e\372\236\260X\303Ke\253 \351'\335N\272\335\272u\326W\177w\231{\356\311\b\313\255\351\013&\302\035\026\250T\303q\307q\222\273IO\235\355\204\363\214ZPc\335\034\013\204\357\373\20606\273\354\235\266\331\2659\264\315z\277q\222\243F8\333-k\2515}O0Q\004\214\333\341\373N\233\232\345&c\263\354d\036\354i\no\317\371\360\232;|\337\227\371Dx\355u\332ltg\263\035K\341(\f\205a\340:\246\3439~\302r\034\307Nx\252\"\005\212\023U&JP\221\230\032!B**\004\b&\324\223S\023\323\322\007\245$\244##\017EK\242!\241 \240\237\016>=<;:\034r6\340\334\330\324(\223\310\243\321m\331\365\335\311\255\325l\307\004\005)\201Q\226\270"
+	.string	"\305"
+	.ascii	"#)x\341\211\301\340\343\307\030Y\031\313utsOt\344\\+\035\315"
+	.ascii	"q+;\301\221\343\251\223\306\365\325\362*\226\306u\203\345iP\032"
+	.ascii	"\327\t<i\\&\270\n2\272\024\213\212\216\242\207\013'\022k\360"
+	.ascii	"\2524m\"\215\024\212\350%xtQ\355\240#\301\356\230:\034lq\240"
+	.ascii	"3\2648\320\352:\302\265\002\353\022\261R\335\275x\256t1IK\241"
+	.ascii	"c\\\212\214\030\217B\364\252\013!\330 \004\3018\363\257\241\376"
+	.ascii	"\266\370S\030)\324\317\235B\240k\352cZ\211\204\240U\033\020\252"
+	.ascii	"e]\362Q\275\226\262|\300\302\347JIJp^uH\256\325\321]\033\001"
+	.ascii	"zX\231\316\372\304vd\b2\246\245\320(^\004E\212/\355`p\242\273"
+	.ascii	"&>t\007\347B\353\222\224\304\271\006\204NYyZ\330jk)\364\315\203"
+	.ascii	"\\\253\267.\200\b\232\027\236XZ\220\262\006\372i\353\016/\260"
+	.ascii	"\271O\033 t\315{\332\2208\317\032\025\005lJ\003B\335\326\232"
+	.ascii	"%\203R\026|G\347\210s\3003\3429E|\003\236\n\216\203\3277\200"
+	.ascii	"\320\024\326\245\024\212\3466R\350\n\200\3203\257Q\026\245\205"
+	.ascii	"\231ure\"\244r\246\001\241f\353\316\t,<[\n\375\341\310U\252\204"
+	.ascii	"\303\262\006\204\226\255JD\257.\375\326ER\250\017?\256\312@%"
+	.ascii	">\032\020J\266J\221\331\005r\271\321\265\032\0226\326n\217n\275"
+	.ascii	"\326\245\177\201u9\313\243W\033\260\022\326\345\373\276I0\033"
+	.ascii	"\376\035\327LE\b\335\252iac\355\256\325\373\276\354O\260\260"
+	.ascii	"\346\026\315\314\3521\363\nf\036\006\0026\357\211^\212.\230\232"
+	.ascii	"o\340\335\271\366\353\232o0Y\240U\302V\314\013I\222\037e\345"
+	.ascii	"\037\337\325*\344\342\327\213\213\311W\376\352\327u\006\302\030"
+	.ascii	"\362\223\357\343\245\353\205!\347i\002Zf\003\020\360~\"\377H"
+	.ascii	"\255\252\331x-6\376\261\2654\237\213\020X\260h\2335\"\025va\033"
+	.ascii	"\333\322\351+$\203\\\215(\036\350\277\200\336}\030r\202\334{"
+	.ascii	"\215%\213\373\b\177\320\242E\333\254kT\370W\035\333\362\305\343"
+	.ascii	"G\331\325\342\266\016\343a\336\2407u\212\377\342\325=\361\375"
+	.ascii	"\326F\303\274-\316\235\325\242\370\257\024\317\344\321&\027\306"
+	.ascii	"\206#\366\372\276\357k\214\353\343\221\275)m\347x^\331\252?\361"
+	.ascii	"_\314N\235\342[\307\213P\004M\327\031\227/\272;m\241\266\352"
+	.ascii	";\3077qi?\312}d\357lm\034OB\236b\325\177\265}\354\267\013t\025"
+	.ascii	"*\354\037\245~U\270-\366\243o\013\2658>\002#x^bm\027\250dl\375"
+	.ascii	"(\257\357\217%\267\305\206#\362\377\332@Oq\300\370\2766\246\270"
+	.ascii	"\355\372\016\002\t(\240\240m\366\037I\020\256\337\277\275\024"
+	.ascii	"\267|q\253\243\2700\276\357K\305\rCC\261\200\373H\263|\301\013"
+	.ascii	"\357g\263\334/\332f\373Yi\037[\225-_do\316kQ|\177}\307\265Q\341"
+	.ascii	"\236\334\027:E._|2\273\300$\377Q\346)\227\277\220@%d1\360\013"
+	.ascii	"an\0359p\364\027\322\271\002\243s\003Hg\026H\347\025\355\244"
+	.ascii	"9\005\212\023\355\326\\\345:\233H:\227H:S\271\316$\216\316SH"
+	.ascii	"\347\021Hg\021Hg)\245s\224\3229\204\322\031\004\322\231i\343"
+	.ascii	"\fU\343\374\344:;)\235\233\220\316LH\347%\244\363\207\032g%\245"
+	.ascii	"s\022\322\031I\351|\344:\033\271\316\036\222\316EI\347\245\353"
+	.ascii	"L\204t\036R:\013\271\316A\355\326\f\204t\3769:w@:\373(\235{\224"
+	.ascii	"\316<H\347\035\245\263\216\322\231\203\353\234\223t\336\220t"
+	.ascii	"\306q\235o\222\3166F\347\032\243\263\322\350\2344:#\215\316G"
+	.ascii	"\327\331\210tv\215\316\355\321\2315:\257G\3477:\273\353\334\r"
+	.ascii	"\025\001\346,g`\342\330\035_\326\f\217Y\366\3068U\025A!I\323"
+	.ascii	"\207\026\352\225,P\373C\373\364P\017\224\370\364-\332\333d1B"
+	.ascii	"\003ST\273h\235\376\323\344\374\334\234>\205\240\017\231P\306"
+	.ascii	"\310R\323\013\360B\323S]\036\335\207\017F@\246\377\340kL\317"
+	.ascii	"r\361R\235\343\0324SR\342\201\031\235\301\341HBB\243V%<j\341"
+	.ascii	"\270\243\257\373\236\0301\352f\231v\351\225\212\334\244\301\223"
+	.ascii	"4\3138\022Wk\232i\242iV\233\325\266\331\245/\301\265W\205\363"
+	.ascii	"p#\215\207\345\253\364-\314\332\344\004\003p\346fbs\321\373\251"
+	.ascii	"\364=S\376\250\334\305lHQ\322\267T\005\227\263\004\357g\322\363"
+	.ascii	"L\361\343\353\263\262\\!\210\364+T@z\025fG\316\336\306t4\221"
+	.ascii	"\035y\353\037\333\020\242\243\350\321\037\t\366\021\256\320n"
+	.ascii	"\310o\264Q\020\243g\313\\\311I\3642&4\203Y\220\251\262 B\202"
+	.ascii	"\200>\312\314'\234\2476k\324\023\276l\347\215/g\216\026R\006"
+	.ascii	"H\331\b0\206\036\334G\321{x\305\256\226\321.\277\210\350\227"
+	.ascii	"=\210\336\2652G\3457\355\004\333\341\344a#\366\363:S\300\272"
+	.ascii	"\307\031j\207\217\246i\026\210=\364,\034l\350"
+	.string	"]\300\305j\215?j\225\2603hs\270a\212k\206\216\204\214\023\037\241oD\377\022\372#\301v\307\270\350\350)\323.\332 7!\350\331\302\304\252M\022\2722\236\277\316j\201\236\250\207\230'w\202MvD\370\332N\262\037N3\036)~I\203:t\276\263\332\237w\352\301Dn\313\217oug\265>\377\263\350\363.\340\03166#\303\r\016=\257,\202\326\363\255\231\267\230\270\260\034\236\367@f\020g\324\373\311\363\315\006\204\353\265X({\325\r\037e\241\266\202c\232\\\230\026jw\276\202g\367\032\253:\211\354\274\013h\246:\246\244\202s\311\025\246\025\234H\2221\340(9\263S\211s\211\367\223m\244\274Q\271^\213;\257\r\263<h\341J\007\327\f\267|\021\247\020\313\215\033\235\307:rn'[\313\354ls\276y?u\336F\n\023\252\215\327*\362\242\006f\363Q\036\323\034\036\206\\\030\302\f\234M"
+	.string	"\340\360\037F\206m\f\350\007\207Pp;{\253\371(g\320r\207i1\031\320"
+	.string	""
+	.string	"\200\266Y\266J\340\241\241\213\366\013+\r\\3d*zC\270(s\336K?\0137|\016\316\333\374\206\357\256\263\233\307\341r\363\307\261\006>/jhp5"
+	.ascii	"\215\rd`=\200uU\343j\203\031XW\032\\\305\210\361\242GF"
+	.string	"w\260\301\0035h\260\034\003\212\206\0063\260jp0#\306\0051\260\23010`r \343\305\006\314\030X4\230PA<\243\203+,f\215\0313\260\230\311\255\266\332z.~\024\272=1\201'\032\312Z\251\367\307\202\357\254\225zYV8\345\215\265R\317\n\002F\232V\232P\337G\363\270Q}\312\024\017@\343\177\217\230\261'\"Q{\201\374`G<S{2v4_*\250}\217\306\241\327F\355r\305*\324\320"
+	.string	"\241#]\316\336^\214i\342\303J\274\t\037k\252/A\342\251\036J\342]\036uwz?d\370\023\222f\022\357'{\220D\215\351\247\244"
+	.string	"\257/1\3054}\205F\300Gm(\371\033b5(\366\025\332;@\263\353\214\231\2762\233V\t\005\370h\273X\362\\.\236\30007\231\364\\\223-i\252\331\032!\206\207\206[\207\335f\357!a"
+	.string	"#\254\357\233\246b\2567\020\306\225i\266\322\362\304$\232\025"
+	.ascii	"\370\350\0137\255\201=\361\r\257\312\216\3306u[;\303\216\246"
+	.ascii	"\231\030\031x\247P\335\326\f\257~\020V\t\273\\\221a\370\332\314"
+	.ascii	"\3276u\323\365\\\363M'\205\367}\373\311\334l\322t2\327\215\303"
+	.ascii	"\n\033\265\353\265\270\352\312\237\325GY\251\355\360\255\324"
+	.ascii	"N}\007\037\343d\232r\315\271f]]\333\354\324\273B\306T[\360rE"
+	.ascii	"\005\024+<zb\030\223\202\210\317\220 v.LQH1\363\323gv\242Gg\265"
+	.ascii	"#\036F\340\210g\205\364U\335U\311\002\325e\005\023z\235\325\212"
+	.ascii	"x\237(\0229A\317\353.\321tM\374\332\253\264Q91\331k\257\242\204"
+	.ascii	"\304\004T\232V\252\240\271\226\316\361A\325\362D\356/a~S[\330"
+	.ascii	"\377\266\230\251\275@\370\330\373\374r\250\275/\026\366,<h|_"
+	.ascii	"\255>c>\226\375\371\336 S{\201\274K\256\307}\346\317wiY\202+"
+	.ascii	"^\021\361\017\320\261\271eQ\314\214\310s.Y\244rQ\365}\211\370"
+	.ascii	"(k\351\254V\352_\032\203\324\367\223\017ce*\025\3650\326\250"
+	.ascii	"W\342\245q\363\206,F\205\330\363\003\021\302\001_\273\311\347"
+	.ascii	"\327\374\363~\206\370\033-\314\246\f\316%6xT8\357L\034\024\b"
+	.ascii	"\005"
+	.string	"\274\337nzi\231\233_\232\202\336O\020_#\ra\225p\20575s\223Ls\0066\267\2416\346i\257\263Z\246?a>S\202e\250\022\3610\321\342L\251\241\021\221\024$I\24112\013\020\bca\332[\352\001\022 DAK\204\316\\\215\202$\225\264\006\370\322\203#\021\325\350*\326)!\016#\241\003\260\316\257\3254\"\214\300\034\027/\202z\027\033y\211(WI=-b\253\n\221\004\331\204\312\fO\300\243S3\f\221;\252<xy\247\251\234\2245\333\027\260\357\257\207\332\\\360\335\033\017\275`\n\274WK\364\243M\210\255\215\\\362\021w\2008I\237r$\343\002\024\234\370C\f\b>\357F\272tw\275\341\245\314\256[\231Q\371\256\236p+\365\260M\254\227\220\274.%\374\027]\017H;\221\200cp\2357\330\025%(\265\265\305\007}1w\026\024u*\344\364q\007.\311\330Z\362\323\020cZ"
+	.string	":\376\207p\304>\327_\253`4\362\370\346u}\324\234>\300r\332\022'\005\223i\342\260ym\374\002\263\332*\203\177\005\207\251JMp#W\0046o\031\371\255\232\213\376'*3,\277IBEl\314\002\222DV\300^\272\3030\221\021\004\252\021\344\251f1\204\254\373\361:\224\303v\255\215\307\265[\304u&N\363\013\245\271GA\t(\376\274\317\013\367\345:\222\217\373x\217\304\032p\b\230\365\301/\354\247z\230\343\363B\320\202\341\232hl\245\316\312Q9\356\301z-\243\225\"{\351r\t\242`\315uWH+_\236Z,\335\271gcS\033\316\034P\013\342\017\326"
+	.string	"\376\324\244\316\210\013]g\340-\316`\234\002\354>\b\217\277HA\272\031\344\217\0130t\032\317Q\002\333Y\370hi\007kI\374\307C\033\367\352\302\223>\217\223\022\257\244iD\265\276`\227\017G&\314i\324\r\351e\307c\3510H<BG%a\243\360yr\301\352@\276\362\274\354eh\215p\254\367v\270\002n\267\353\226x\030\340\222\216\207\005\205\243\033\316{\344\001w\370\005qd\256\277\223\030\354\324\350P!\223\021\330\r\017\331\btb\223\006\331\024B\256\330\223\302\356\235+fX\334\025g#\t\020\"\007"
+	.string	"r\004d\231\331\301 :\240\352<\321\224A\034\316\001&L(\301"
+	.ascii	"\225\340\267\036\333\0019Z\200c\271J@\344\266\250\025.\251\361"
+	.ascii	"\022Lg\246\223p\207\262l\0325l\213\330\210n\005\"\004\030\223"
+	.ascii	"\205\250\025aM1\\<VCt<.\300!\264\024\007\313\2512L\261\232(\311"
+	.ascii	"l\201\315,\266\352\275I\362\227B\013i\330yb\266\347\225\005\353"
+	.ascii	"\202V\357\322!j\346\340\f\344\035\205x\215\276\222{P\221=\032"
+	.ascii	"\032\274\352\254ZFOb\347\346\033K\310\213\221\302\254\373\024"
+	.ascii	"6H\246\267\266\360\004^\347[\036\347\254\254\310(\005\372\252"
+	.ascii	"E\\\260j\352\235\261U\202\200\345\340e\350\020\0201\202\260\312"
+	.ascii	"9\273>\231\254\363\024\354s2Ssb\026\325\254\2639\370"
+	.string	"\305\375\203\373\017\372u\023\352y\346\330O\334iR\322\242\\\271}\033cj\271\232h~\006\305\245\3205\240\215\304\026\233\f\r\037\255i\272\207}\257\252R\341\003rO\3663\322j\3060XRA\331\021N\006`t\344\224\344ol\027s\032\262\261a\312`+^^\f\204;\304/\351s\3427\224xBh\241\3028\036[\300-pQ8\272\216\032\334\023#\241\201#\334D\005+\032\347@\307Ic\356\200\360:\201\235A\t~-i\016\266%\210\243\210\273\252\027\240}\233\247\227(\345\304\177{E\274\305\353c\347\330\005\222\205\021\203\233+\266\371\271\301\033\343k\305wf\330\204q\006\312\353\003: o\016M\270vT\277\225-[\246\210\272\t\241\330\027V\361\200\211\324`\344\272\342`\274\253\301\355\336\255\300\023\013\347\004:W)\2713\372Pj\207j\270\232\236@n\236\322\177\216/\344r{\316\355\245\306q\243"
+	.ascii	"4\2032\306\r\315E\215c\236EW \346\225\325\003\323X\227\260\234"
+	.ascii	"\027`Z\016\323\264Cd\037\031\341\250*\266\337xi\260p\364x\346"
+	.ascii	"\264]\032\312\242\351uv\240\224\247\317.\241\351\263\200\244"
+	.ascii	"u\240\003\362\362\f\004\314YLP\306F\305x\316\347\247`\357*\035"
+	.ascii	".\213\3248\024*z\220\231\372\232=8/\274\200\026"
+	.text
+	.section	.gnu.lto_getRcStickDeflection.103.4fae565055c26339,"e",@progbits
+	.string	"(\265/\375`"
+	.string	"\001\035\r"
+	.string	"\026\033]C\020\257&\035\203A\023w\tuE\005\270!M\343G\035\351\214\t\320\215\343YO2Q]2\375\360\301\006\353\027\022mxP\332N\305P"
+	.string	""
+	.string	""
+	.string	"hl\317\006\220qET\210\n\373h?!d\357-eJ\001I"
+	.string	"H"
+	.string	"H"
+	.string	""
+	.ascii	"\362\234\230W\021\371\332\2750\002fw3\334\261\016m\373\035\356"
+	.ascii	"!d\321\3432\230bJ\005\222\023\315\356b\003\036 \036\276s\342"
+	.ascii	"\241"
+	.string	"\242\\\364\024\371g\371k!\263\242d\022yV\nv\327Y2\225\334z\333\004lo\330\247\020?\324\264j:_\372\030\033\224\0225\236\024\273\023\272\2325\001c6\034u\373'\337\005\345\324\267d/\001E\212\005\026\273\3339\264\001\353-\366\346\360v\310\336\330\326\264\317\375C\350+\021\fwMT\300\354r\031.`\035\006\235Vz\340\205\304a$;GUEp\342\232z\222\027\243\354@\027\241Y\273\273\341\203x\b\b\276\206C\177@\362\245C\037$\036^\357r\016\t\231\230Qv6'\222\212\301\376\333\335\265\236\\\232\266\216\272\253\257\374\361*\001!\034\231m\013<\036\360\343\t\351x\3164>\016\264\r\364\241e\034\331\206e\r\260\017O\207\007\226m\037LC\200\265\007\f6\f\244i\033\266\341\366o\365\304\266/=\313\237\013\223\221\216Xg\356T\264\364\322\267<_N\244\231J-M\220\"\321\2142\020"
+	.ascii	"2\241\251I\343\365\204\337xa\271\006\311\304\004\3105\212\372"
+	.ascii	"pPgf\265\001a\370f\257\253\024A\022\250\300\202\237\031M\355"
+	.ascii	"|\002"
+	.text
+	.section	.gnu.lto_rcControlsInit.104.4fae565055c26339,"e",@progbits
+	.string	"(\265/\375`\342"
+	.string	"\265\013"
+	.string	"\026WP?@O\223\016S@\242o\335g\016\365};\307\377\203\rz\3051u\245\350\300\013\354\360\374D\204\020\322v\254\232\031A~)mS\017%\303(`\370L\272C\376+\035\b\255\277m\333{K\231R?"
+	.string	";"
+	.string	">"
+	.string	"\025\213l\027'u\354Itl\204\300\330\335I7\\t\3704E\276\004C\331\270\353p\242\341\017"
+	.string	"\247UH\255p\332#\260\273\377\360\274\300e\231\022\314\356:7.\303\035o[\201\355\002\366\023\004\357D\273\222\220\337\256\003FPt\232^\216iO\240\220\337\234#\"]\246\227M\312R9\354\277\335]\353\310\326\364{Z3\235O\237\022 \305\212\007%v1\224dl\007Mp\260\375\207\032\262\275x\252\372\215\031X\226\"T\016\377\372tD\305\2645\007\241&\273\032\002\037\304Cl|\217C;\340@\237\023\017S\177\202\305\007\226\245\334\335K\035\212W\213\007\220\026Z\306\260F:\246.\037\b\225\005\362TT\206\262&\252\301\344\341h:\023e}\246\213"
+	.string	"W\0216\326\004\252*k\252\220\260\277\325\221\363\031\270\245\203\310\207\036\370S\013\266\275@E\207ifU_\304G\204|\0173\310db\024"
+	.string	"AC\253qC!#\243\031v\216Lm\020\006\344\021\0245\004!"
+	.ascii	"\034\\\302\004\326\301Br\031\3602Xp\231\200\001\253\232\274r"
+	.ascii	"GK\216\255-e"
+	.text
+	.section	.gnu.lto_.symbol_nodes.4fae565055c26339,"e",@progbits
+	.string	"(\265/\375`n\005\375\025"
+	.string	"f&\215H\220\226J:\201>\260.1\177\235Z\207\214\274\nM\004@\300\225F\332\251\027\240\312\332\n0!\274\2015aX\346\344\257\003){A@-\002x\340)\370\340J\216\210X\254\021"
+	.string	"\214"
+	.string	"F(y\2402"
+	.string	"\334X\322$\221)v"
+	.string	"w"
+	.string	"}"
+	.ascii	"O\0215%5bH\364\265\362g\232br\232z\222z\212\n1<\021\374\236Y"
+	.ascii	"CgR\n-W\031\324wB\n\373ndpY\224@G+\201\247\362s:\237\317\225"
+	.ascii	"=\227+y\036\36761\032\305\235~\033\251s\270\232\234\277\225\277"
+	.ascii	"\253\361\361x<\342\364\331\310_\335\274h\323OI\376\3674k>\244"
+	.ascii	"\374Ob\231d\177\377Bbl\3174M\223\246\337\204\374\337B\"xs\305"
+	.ascii	"\231\036\377\226}=\006\321\373\342C\357\226\207~\224\016};\016"
+	.ascii	"\375*\033\372V4\364\3572\364\3610\364\353.\364\257X\350O\251"
+	.ascii	"\320\227B\241\217eB?\213\204~^\204\376\021B\257\371\240\367j"
+	.ascii	"\251\027\313A\357\331\2407\213Ao\213\005\275.\024\364\256H\320"
+	.ascii	"\253\205\240\377dM\323\374i\016\364\241\254\322\213\0308\221"
+	.ascii	"\0027K\372\021\244\247\035=\211\321\215EWR>Q\347\342\330\370"
+	.ascii	"\301\005\254l\002\2502\024q\237z}\375T\206:\203\225K\244K\202"
+	.ascii	"\031\215\b+\017\321\341\031T\271\t\025\252\334t\356\316\260["
+	.ascii	"\033\252,\342\\\022,\016\b\260\262\017]\0359\030C\225e\322\335"
+	.ascii	"\267\262.\242\3122\350\226A\320\356\212*\307\240@\225cN`e\230"
+	.ascii	"t\005\324\245i\t+\303\234k\303\026&c\246\262K\272-od>\214*\007"
+	.ascii	"Hw\200\261.\316\250\262\323\256\216_\332\236i\232\346\321\013"
+	.ascii	"\377\220^x\307\210c'Q\354\\\0025\362h\210=\320\025\252\211\331"
+	.ascii	"T\336\034\350*\231-\271\251\274_\350\306\024\341p\322\2251z\375"
+	.ascii	"*/\216s\203)\217\232\312{\003M\033\335u\353R\313\251\254\002"
+	.ascii	"\335$\343\226Ne+t\001\234}\035}\225\255\316\235\312UD\236\312"
+	.ascii	"U\350\376\314\256\254\2472U\352\253LE\\\362\f\203\363\251\214"
+	.ascii	"\342\\\027$;\350~*\007N\2501\020\303\242!\221HDiIa\222\003P\203"
+	.ascii	"\3146\215\001\021\300 S\310 \341F4H\002\371h\265\375\217\262"
+	.ascii	"n\b5\270\366\264@\247\301}p\372b\275\252KC\313%/{v\275\021\354"
+	.ascii	"L\f\320\0168\307\301\036fxCq\216\203\321\036\335\303\322\340"
+	.ascii	"'\305`LON{\023\242\360\006\242\204\323\277\033\017\030\337~V"
+	.ascii	"\264\335\206\034\007h\033\025Yb/\023\221\266\243\031\332\037"
+	.ascii	"\t\236\222M\333\356\006\006\30525\216\375\003"
+	.text
+	.section	.gnu.lto_.refs.4fae565055c26339,"e",@progbits
+	.string	"(\265/\375`\027"
+	.string	"e\006"
+	.string	"RN+/`M\222\016\300D\321\200\2543\235\277\027"
+	.string	"\200^C\340\006"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354Q\221\373\344\f\212\r\275\325\266\350\030\315\266\326\310&\215\020\322\310\226)\023\340\001\032`\201\302`\006#\034P\023^p\241\200\332io\002\006\300\313\226z5^oF\366b\344\367\302\362\265XQIq?\312\211I\t\311H\364\213@\177\b\310\373?<^\277#\373\034\371o@_\361:\305\373\211|\211\247G<\017\001\375\303\323\033\372\f\256/\274\256\220=!;B\376%\177rM{d;\016g\332c\330K\353\243\366\017{\327\276\261_\353\306\231\251\257\032\361~\247\f"
+	.ascii	" \004\304E\211\252*n\251`A\205\200\270 <\210jd\006sE\3156pY"
+	.text
+	.section	.gnu.lto_.decls.4fae565055c26339,"e",@progbits
+	.string	"(\265/\375`x;\335\375"
+	.string	"Z\211\245WV \fY:\215\001\325g\231;\256\363\220\271=\357\\\207!\033\302\325\0039H\t\343\f\323\307\260\017\346\223\223\220\325\2528\260C\326{/4\004\220\216\2775\227\227N/S\364\304\bcf\"\303\002\367\310e$+>\221\001/\003\2149\277\347\347n;B\332\226[\312\024\257\004\212\005\267\005`X\t\376\302M\360\023\274\304F0\223\333\304bX\310\361\020\254LN\335\2639%\017\262\rn\\A\272g|8\371\013\355\300:\312\2308\326\204\260\030\376\201\203\344"
+	.ascii	"Sb\245\036cJ!\253f\232\r,|\277\320\225\024%\026\326\021\005\013"
+	.ascii	"\2156\254$\303M9\266\373\2300\302\330\301\255a\241\334;s\317"
+	.ascii	"v\222=;)\256I\211\241\242\350\224B\330\207\003\222\210}\300b"
+	.ascii	"\370\204\273v\337z@\340K\214\335\027^\272g;\347\3367\322\240"
+	.ascii	"\371o\032,v\325\334\263\373F\265\223w\032\020Q"
+	.string	"\242q\013\332\360\233\032\273[a\201|>]\240_\006M\3728\310\331\b\366\026\003j\365\271\300\303\031g\t\035\003\021\200\02454\234\201\300%\375\237\236\376\017N\377gE\377wD\343\0349F\026\035Bp\376O\210\376\017\206\376/I\037\365\242\217b\321G\315\364\321&\372\250\022}\324\210>\232\245\217\322\320G\223\364s\030\375\274\246\237\301\364\263\226~\346\241\237\247\364sR\0079a\027\267\031\204_\300%\271\250\201\363O4\372\004\273\357\006\375~\322\351\237mZC\230\376\211\245;8[\350\343<}\261*\372X\211\376\032\226>\206\241?\207U\350\3372:\303\336\225\323\030\230\271@+\245\225}\225!s\227U]kp\376%s\355\256\336\255\332[\351\252\240s\272\273x\267y\341\346]\274\036IP8\377\272i\023\354}/\374n_\337\275\360\303U\027\350g\2001B\277t;P]N\310p\366\271?b."
+	.string	"\221\240\341\330\021\206\013\316\2300\311$\316\377\240%\253-K\020%\0266m\202\023!vc\031lp\271\\\262{v.\225@(:\272\354\320\250p\335\257+wm\007\251g+\251\030\242\334{\371+w\273\334\271\373\345\306]0\267y\271\334\267\337-\027\356x\271\267\322\336[\350\227\313u\273k\347\362l+%\301qHb\226\261\355\355\275\334\020\264\001\310\244k\201\326\223ow\201~;7\207\376\205\241\177U\350\227@g \322\030\200@_\265[\3456/\270V~\247\334\264\243H\313\275\304Yk\306\232\340|\022\372\367\202\337\331\327w/\370]\002\272\347\002\375\360\331\005\372\335\262\033\3456+\270fg2\214G\207\257\213/\r\316\177\200\376\225\362"
+	.string	" \355\r\036\244\177+\370\335\276[\301\357Z\377\355\002\375*\340Y\306p\312\001\345\311\317\004\034L-8\377>\271Nn\206\253\366\216\262\367\266\240W\220Y\203\006\347\273/\320\257\347\376\374n\230\320o\223\237\337\023\325r\3638 +G\022\234O&\367\353\202\235LMU[l\357\245\017\320\253\n\226\030\316\027\f\337%w\371\013v\225<\203\r\236\243\264\277\366^^\260\2747\322\275\026\354\334k\001\252\026\004\251\311/\037\353//\320O\337\237\037\013\334\305\t\224S\370O-Abl\376\363J\t\\\376k\342\277\303\377\026\377\333\024\207\341\326-3\336p\225\026.Xn?\376\221\345\307\312\266\037\033a\3731\027\226\353u\345NY\373/\235\025\034\206\253\374X\355\307=\377\365\340\202\377\352\300T\376c\250r\365\337\354#\374'\217\377\017\370\357\b\214\326\304gD\263\037\033\233\377\021\020\364\037\303"
+	.string	"\376\023F\211SE\376\317\024\377\345\376w\371\317\345\277\227\377s\377\341\376\177\371\361\377\353?\237Q\244\340(\"\370\257\007\376\373\201\037w\360\377\3743[F\226\364c\r\374\270\304\217I\374X\204\037g\340\307\0358\360\317Z?\276\340\307\034~\274\341\307\032~l\200\037#\340\307\t\370\361\002\306~\354\363\343\002\374\230"
+	.ascii	"b\377{\376\f\345\307N~\334\344\307J~\354\365\343\256\037o\375"
+	.ascii	"\230\310\217\203\3748\353\307=~\274\343\3079~l\365c\033?\246"
+	.ascii	"\361\343\251\037\303\370\261\324\217\241~\374\342\307N?.\301"
+	.ascii	"\217\217~\314\376\370\370c\022\374x\350\307\303\037\247?\366"
+	.ascii	"\300\217C\374\030\304\217\033\360c\f~\334\341\307\367\277w\377"
+	.ascii	"\255\373\257\230\377z\371o\227\377n\371\257\226\377\266\375\367"
+	.ascii	"\312\177\253\3747\355\277g\377m\3767\312\177\311\376\313\374"
+	.ascii	"o\330\177\277\376\213\344\277[\3775\362?\357\277\336\177\213"
+	.ascii	"\374\007\341\277\223\377K\376\253\374o\220\377\376\370/\217\377"
+	.ascii	"\346\370/\326\177\253\376{\343\2772\376[\371/\214\377\032\377"
+	.ascii	"\033\202\377j\340\177\231\377d\376\207\371\017\346?\224\377O"
+	.ascii	"\376\177\360\177\371\237\003\377\331\376\353\364\365\365\365"
+	.ascii	"\375\350\t\277N\t\376\004x 6`\302\306d\341\374\263\fn\242AU\207"
+	.ascii	"\363\251'\364\223\f\036\"\306\306\206\263NO\324\335o\363\274"
+	.ascii	";\271\202\252v\224\003\210@\0359\273<\304\200\034\341\243\243"
+	.ascii	";\353\356\003\244\364\260\343Y\256X\036\251C\341\214\b!\253\373"
+	.ascii	"\362\345\024cs\2004\235'(aSa~\2129g\350 \301\352\"\202\363\t"
+	.ascii	"\346\234\221\203c\313\017.,^\274\3345\rUHH\006@r\247\261\326"
+	.ascii	"n\250 \213k\236qg\227s\357*\031\032\266\320zH\335\0019\271\004"
+	.ascii	"\361@\001\342\325\005\347\363x\351\363\360\330\262\345\236\335"
+	.ascii	"\260\375\342fE\022\315\215\275\275\3278\360\2249b#+\215\233\226"
+	.ascii	"{\206\201\032\324\030\375\235,lm\027,gP\263\332A\323\337i\262"
+	.ascii	"vR9\257\\\275\f6\224\373is\370N\227\376N\0205*g\225{\246\267"
+	.ascii	"\022X\246\002\207\335N\016\375\035\031S\246\234i:(\315\252\202"
+	.ascii	"\271\257\264\323\351\300E}\331I\236\3756\317\263sK\001D\354\320"
+	.ascii	"\270\001o\320\030#\343\256\331<\233\227\214\206\252\035\225a"
+	.ascii	"\353\216\016\315\336\336T\034t\216L\221qU%\312o\363\214rj\t\355"
+	.ascii	"\2154#\003\022&;\\l\\\261[>yr\222]\252\235\304\323\240\004J\177"
+	.ascii	"\321\222E\n\3319vCC\031\305\013\347S,\247\317K\034\330\020(:"
+	.ascii	"S\314\333<\231\367\211\206\345\226\302\240\005E\305A\273\300"
+	.ascii	"\263[\342|\035\247\345\362\f\363b\002\034c;\301\305\311\344g"
+	.ascii	"\330\257\216E\224\027\234O\346\256e0-\252\035y\372W\311=\227"
+	.ascii	"4\317%\027,h'\3570 \362\264\344\360\2347\375\263\353L\362\323"
+	.ascii	"\353?\275\316\257\n,\367\213\n]wr1\3666\025\225\006\234\2571"
+	.ascii	"0m8\237_\027,gc\260!\242\205\225\003D\3776\322\323\336;\n]\356"
+	.ascii	"\247\244\234_\364^\r\277\316=/\001\366\356@]\356$'b\364\264\226"
+	.ascii	"\031\022\215\f\373\350\333\336JWI\b\\A)]M11\257vRIH\322\347i"
+	.ascii	"_%\231\230{\373l%\245\244\210\252\355\303\304\334P[\005\034\324"
+	.ascii	"\335\313\253\344V\252\332>[i#e`R\272\202bb\"A\37101\257\2406"
+	.ascii	"\363j\367l%\244\247\025J\373\311g3\257\3566\263\n\252\207\211"
+	.ascii	"Y\005\305\304\274\342\2724V\300\255I1\305\360`\272wLJ\333\205"
+	.ascii	"S\r\244\247\2367\246e\325\236\333\373\212-\355'\002\354]\243"
+	.ascii	"\352i\016i\352\236%\275\271H\212\202Tu\227NIXU[\351\215\311H"
+	.ascii	"\325\336F\222\212\266\223\006\311\345\333\366q\337\2229j\354"
+	.ascii	"\246\245\275\001\340\264"
+	.ascii	"w\362\356\267\275wr\357\r|\252\261\334{F\017\223\322\311io\252"
+	.ascii	" \247]#\211\266\2647\026\003s\006\305\304\304\252\022B{\302T"
+	.ascii	"n\023\226\311\253\334sWO\232\231d\262\233\362\264\022J\n\017"
+	.ascii	"g$Y\231\005\252io\271\3049\2731v\002\316\247\021\264\354\211"
+	.ascii	"\355m\214>\213\004\001\203H\251b\327\246\207\234J\006\3548e\332"
+	.ascii	"\020 g\220\233\267\223\232\274\200\3708\177\340\251\026E\242"
+	.ascii	"\204\370\330q\362\320qgt\260\311\330\261m\344\362l\210\341\034"
+	.ascii	"'\026\220\f\2271,\347\325\205\03469\262\215\363qTh8\253\226\314"
+	.ascii	"\nTH\\\2509o\330T\315h\202\244\247O\032g\215\333<m<\207U-uN\244"
+	.ascii	"\030Y\3144\374x4\374\316\251\223\3526\257v\312\260QZn\246\017"
+	.ascii	"+I\0378\377F\214F\001\274W\373\375g\214SJ\367\261\365\021Q\002"
+	.ascii	"\303\267\342lq6\235N\247\213\223\351<\341\204:\243\316\247\363"
+	.ascii	"\305\311\342\204q\233\247\324\251\342\347\322i\302o\333\246\303"
+	.ascii	"}u\3111i'\222\030>=4py\030O\315\207\2733\314)\205\355\370\354"
+	.ascii	"\204N)\\\006\257\331I.w\362g\006u\344loC\320\305\223K\252\202"
+	.ascii	"!_\n7L\364o\210\350\337\340\320\2779A\377FI\337\206N\337\346"
+	.ascii	"M\337fL\037\257\3711\231\213\005\253\031\301\336J?&\245+#8c4"
+	.ascii	"8\315\261\032|\006\253\321\240jo$\254\206G\315\336H<\367Zp\257"
+	.ascii	"\0059\t\326\020\262_\276\rSc3B\307{\347\034\024\032\f\234Q#\372"
+	.ascii	"g\023D\337f\206\276\215\222\276\306\323\327lutjk\326\246\340"
+	.ascii	"<\006\213\271ML\207\303h\301^\314\260Z`:<\207\301`\261P\356\275"
+	.ascii	"/l\330p\203\367c\006\024}\f\346L\034\251\267/2p\316@\350\370"
+	.ascii	"\313\217\213\212\325\231&Z.H\207G\325\026\016\234\257\263\364"
+	.ascii	"o\032\334\325\333A\367\256\342S\342\270\333\304\\\360\226c\267"
+	.ascii	"\333\306\304\\\360\333\325\273o=v~\201v\245\344\332{o\b\332p"
+	.ascii	"\236af\261\373\345k$} \235>\360\213>\020N\347\373\363k;\313\314"
+	.ascii	"\224P\341|\314v\233\270\r_\271\313\275\227\037\326\272\200\t"
+	.ascii	"\265a+g\0271\027Q\\{/\2036l\310\361R\242\306\342\227\017L\323"
+	.ascii	"\007*\321\007fi%TK\304\322\244\3060c|Q2\251\264\260h\261\247"
+	.ascii	"L\243"
+	.string	"B\215\022\313\2123BUf|}X+\232\360\023W\235\335\375\232\221E\211M`\272gh\332j\260\331%\255\301G0\021\214\0047q\027f\3421\214\206\213\3402|\206\247`)x\013\253a-\314\205\251`(8\r'\301Q\260\027&\303K\260\023\034\206\315ph\023\016Oz\220\341*W/\353 \322\364\302\031MC\251\034U;\252\206Q\265\263\257\357\247\204\013\224\337\224s\313\206\312N\017\f\347\345W\316\213\027YUg`t\356\222\224\001b\226\353x\346\252t45O-\340\262\213\231%%'o\204\310\005\301\212rv\371u1\213<)\353\212\261\245n\r\031\027\fw\343\356\r\035\313W\246\306\276\260\340\f\005\312Y\027\2446\005e\353\333\332\322\346\304I\006\243\026\0257%+\206Y\234\027\030\030\332$\250*y\247\301\035V\021\274\275<V\265\266\321\345\321&h\330S\231\223,8\243Lx\254\220\301\001"
+	.string	"'}2'\221\253Q1\022\006\215\022% \270\243C\303uf\313iM\316\313\353\374\272aIB\224{l.\314\320\220 A\202v}(b\206\357j!\303A\305u\264\353D{\372\"'\004g\312\213/#J--t\253\001I?\354\270\360\214<\267\037F\216n\335\360-\335\225ea"
+	.ascii	"&\353\002\324\220!(\221\240\f\311;47\250n\250\332\232s\312\243"
+	.ascii	"Dn\337\026'mg\017\255+\025yA\202h\205\231\341\333\313\313(\023"
+	.ascii	"\276\224\371\361\003\315\252\200\004\316L\023\025jp\316:\313"
+	.ascii	"T\271\241f\016\355\201\366\2102\303\307\205b1sP\241\202\356@"
+	.ascii	"w\234ixf\370\304\332\324\234\232`a\2419\202\252\222x\035hmi\202"
+	.ascii	"A\305\b\232\243\007\235\233\026,8?(\b\212\003\305\201Z\221\220"
+	.ascii	"vE\205\013k\315\335YA\253\216Ze\037b`\204\001c\021\225vc\215"
+	.ascii	"\r\033Z\256\372\224{\2772WjU\316d\310@iT@;\223\254\220\303\201"
+	.ascii	"\3168J\343\324!65\025\226F\311e\325\344\206\005\0300`\234uBx"
+	.ascii	"f\370\254\224\234YC\245P\251\234\267\001\223%\254-*((\024\n\265"
+	.ascii	"\001\332\225\262\304\022,\n\264\320\027\350\213\263.\210\b\034"
+	.ascii	"\036\226\254\344\266[\263\346hr\r\352t\312\345\354d\330~\001"
+	.ascii	"4\303RWco3Qi\300a\322\202\311\026\224\351\250\323\321\246\f6"
+	.ascii	"\370\030\256#rH8\243-\216\262\240\3122\305\016\347\243+P\026"
+	.ascii	"Z:\230H\334\364\027\240\303b@A\341\214\232\360172\246\351\016"
+	.ascii	"gt\351jT^\366x\240*\356\206\025\227\2043\212\204&\335\346\331"
+	.ascii	"P\245\357L1a\214\315\212\376\t\356\331~\271\357\350\236rC\307"
+	.ascii	"\225\031\037\231\034\r%\231>P\0233fr\032\0060\271Rr\361@\351"
+	.ascii	"\305pB\363\234"
+	.string	"\006\315\313\272\353;S\303\ni\017\237\331\273\211B\023\242\207\363\036\016snI\265-\355 C\346\374\200v\344\214+{yq\002\212\272\273\313yAH\254\216\234i\263\260\2643\274\347<\324k\312r\352\f\253\214\030\2633b\304\344:\241+\271=\256\03404pJ\350\236\353t\3108y[\222\307\374\334^\250AS\241L\177.\317e0\025\322\256\342\246h\330\211\333\301\242E\376\362\f\206'i\013\210\224\023\207\016\327\230.2p\310\311\351`\001\305K\351\f\316\257\260\"\356\217\313\\\256\220\23371;1:{V7\250\334\261=oa\303\303\242\361#s\223\212\3029k\311onY\332~\2548y.\273\315\354$_\321\240\205\345\366\304\324\341\274\246\323\245\214\027'8\377\207\251\253d\265\234\226\251\344)\267\231\255\344\263c3\230\305/\332\005\373\351\260\341\"j/J\215\346\fe\232\024\032J+\331\354\236\355"
+	.string	"u\310p\021\265\007$;\342\305*'\377g\210\376O\r\375\037)\375\237%}\nz\372\024\264\350<\226\311\304\240<\241\260D\347&g\227\333\263\225\222\334\316\310\230$\221\003\342\365\314\304+\0131\261d\023\207\025\304\306\007\013\035J8g\260\274\\\242\344\213B\214\"\317\\\271H\356\na\004L-\232\f\261\323IK\003u\267\\\336\334\361\211M\3019\037\311H\362V6\222\265\316(\263\362\324\n\352\331\033k\357,'\n\206\222\251.9\351\331\3516sR\026\"\224\264\221\222("
+	.string	"\t\023\324,\314\212'\234\203"
+	.ascii	"\221\274\310]Y\323\277_O9J\214\235T\030\273\251,\343\210\026"
+	.ascii	"\273\0232\324\027\230\035\231F\306\272oT=[\251\271'\224w\344"
+	.ascii	"\030s=2\220\234\225}d\035\231G\376q\233yG\236\361\354\"\277x"
+	.ascii	"P\336\221a|\261\343\321\363\2022\325\223\237>\006C\022S\005\226"
+	.ascii	"\320]\345\034\267\231\261\036\264\334\031+\327\310V\367\215j"
+	.ascii	"\271\243p\244\340\t\241\272\260A\007\217\313\034\215\237U\325"
+	.ascii	"N\224%\217<\2343\016 \325\024\233\n.\033\267\231oh2\\hi>\006"
+	.ascii	"\307\312\017\254-}\237!\372>W\231Jw\261\263\341SC\337\207J\337"
+	.ascii	"\007J\337\247I\337GI\277\247/*C\241L,znP8."
+	.ascii	"KSR\032\2155\334\237_f\221\233x\222\234\355(k\001\302\017-e8"
+	.ascii	"\347"
+	.string	"\274\002\263\rQ:1\355\314\t\031c\202\363\263\thY\237\236\f\234\363\222^\352\031s\301\215\215&\016\0328?/\375\247\336\345+\241o\215\031\234\263\222\320\263\n\034\267*v`8\347\250\351\337\256{\346=\357\274\234\324@\265\2452 A\253\301A\337q\345\260\302y\251\264\367\016\302Y\332\221f\017\347S\315\311w\366\37566iMq5\244\350\237knz\300\005\331\302\031\237h~\246\371m\200_OJcb\372\347\336y\346\2679\327\264\245\255\300\371=K\375\323\314\t\302Xu\341|\226\321K=D.\b\254ZB\212bjL\007\320\032C\030\032\217!\214G\"K\314\360\242\016\026\264A\034V\003#\260i\211V%\242PL\215D\304\023DU\250\222`G\240X=\250\354\bu(e\213\304t\250\347\367\242\016\036\216D\013?\343Q\212\265\375\261D\235\341\017\221\221\230b-\321\003\242U\211\200^\324\001"
+	.ascii	"\025\220D\036\216\304\n\310\240jt,\n\212\020\002\005,\024\325"
+	.ascii	"\023\352\005\206\306\243\343J\201V\025\341\270\246&(\034\205"
+	.ascii	"\036\204C@\306\021jqhL\213\020\020B\217P\230\376\274\250C\005"
+	.ascii	"&\210\3054D\273\246\255\b,\233\"\215\216B\013F\342\332\262\036"
+	.ascii	"\324\341QQh$zX\331#\017\024\024\213GF\343\321\bl\203?\022\216"
+	.ascii	"F\340P\252\026s\253\262F\252\321/m\213\252\210UmU\243#\210\024"
+	.ascii	"E$2\305\220b\210\330\036A\030\032A\020\021\207N\244\354\217J"
+	.ascii	"\024\364\242\016C\t\260#\324\365\250M\325\241\236\027u`\205\027"
+	.ascii	"$\260\201\021%B\200\bJ@\004\006>\b\206 \021\024a\204\017"
+	.string	"\220\205\013\255\312\256\352\tu\rV`\203\0244\ti\212\034\037\225(\330\026\323\n\031|\2000\244@\036C\374\264H\017DH\241\361h\002\255\312\342\030\2070\312\006s\332\240\221\b\211\032\211\220gQKdT\213?\265\004\"\233YV]\207\303\024\230\002y\024\346\265E\236\327I\261\266,\221H%\021\2640T\215D\304b\n\034\252\354Qf\201O\333t\030$Bv\330\t\"\215\324\022$\210\220\002\370i\211\306\021;B\2658\244\212hU\242\n<\355OP5\"\266\306\243\001\340\350`\320\241\204\321*\\yp\204:\264\251\212TI\264G\020\216C\035\233\f:\260\037\210\020\2568\372C\007v\275a\205$XV\025\036W\244\005\036\024k\332\246\"\204\353O\004 5\330\303\036\025\217\204\305ThahL\215\214\216!\204\253\r\221=\206\200\004a\034\301\256\351\005\243\025\304\261\004\205\013\327\343\004X\"#\221\325"
+	.string	"K\244\340B\342\252\032U\"}\r8X"
+	.string	"\007\035\240"
+	.string	"\276\003\0170\360"
+	.string	"\203\337;\360@H\310\003\016\204\3649\020:\333\266\325j\320xdS\225\204\321z\274\200\0055\250\"U\325D\216\032d\211\322\342\004X\242\210\n\255\032\034\216@q4\001l\203\031|0R[6\005\273\203B\035\032G\f\211H\236\324\347\206\025\022[\226\330\246-\033\034\201M[\036\021\330c\b\034\250E\342\320q\rAm\323\025h\004\341\261(<B\nuT#b\tU\230\256\0240b`UI8\")X\323\"a^U\342\020\2615\252\303\021\3035=\232\340)\241\350\003\225-\372\251m\332\212p$\244\240\266)\t\265\004\242\021\261Eb"
+	.string	"\b\304\bBb+\202Z4\221\032U\037\365H=\312\200j$\026\207\251*bU\213G,\005G$\244\3539\244\016\203\255\205\027uX\325\242*\024\246\036\330\365\310\032U\226"
+	.ascii	"H\224\r\262F\304\265D\bC#\210\237b\361\270fV=*\246'~DF\242\321"
+	.ascii	"\232\356\030\255i\260eW\342P\320x\f\026Sa\360\270\246 \002J\221"
+	.ascii	"\026\325a\320hMY\342\320\347E\035P\254\036\210\220?(\326\033"
+	.ascii	"dj$\\\321U\035\022O\034W\344PE\261\026S\342\252\262>(\324\"\362"
+	.ascii	"H\304P1-\272Q\207\304uUO\034\203Fb\2066\b$JK\034\211A\242\243"
+	.ascii	"\"2\310\247UYu\035\032\211&\202m\312\006\215\216\326v\004\025"
+	.ascii	"\311\006 G-\246\302\233vUO\030\211\302uH4B\215D#=\202P-\022\242"
+	.ascii	"H\2154\017\033\242\230\2360\036\211mZ<\"W\2655\216\020\256\026"
+	.ascii	"XU]\211T\021j\221\310\b\302(\rq\0029DaX<\026\261\352ZTBm\205"
+	.ascii	" \324\341\361\203\225\230\006\031\211B\225=\n\242Xq\212\252\321"
+	.ascii	"\230\026\t\203(\216\322 \212\324\210\207]\217\353\252\002\375"
+	.ascii	"Z\225\035\032:\342\370\\\030\032:\266GB\001\260D\024i\220\350"
+	.ascii	"\310\204:l\217\220F\242\005\025\231\242\r\252'\210mz\202\270"
+	.ascii	"\252C\f\353\261\025\246C\301c{\224\006\211\214\304\242\366x4"
+	.ascii	"b\203\3025hx$\256*28\204,\006U\243t\035\n\nW6Hd\331\365\302\220"
+	.ascii	"\030l\211\306#\235\f\212(V\226\247e\323\241\340\360(5\021d\217"
+	.ascii	"L\260;\253\221\r\242X\203*{\024\034bW!\017\360E\030~D\252\253"
+	.ascii	"\207\366x\\=\340\260A\"\342\220\361\030B\304\207\266\210\210"
+	.ascii	"X\034\352!"
+	.string	"\341X\334\341\031~(\246k{\244\032m\324b\333\036\327\24268\37404\246&\206\251:\374!\341X\304i\203\034\b\351\"\"bQp\370\241%\032\021\2139m\260\203\326H<\002^H(D\006\r\200@\001-\354\300\026\217kk<\n\203\302\325\203p\310\203\221\230\032y\020\256\254\207\016\001\030~P\207G\243\340P-\022\266D\022X\236\342\361\030\201 *wr\331p\341\b\263\352\222\323\354\234\001\361\261\203\013\352\264\363\006\326\347#\356\256M\251HS\006\227\267\263\207\245\313\212-(\2157\324\n\003\231\032\203C\013\232\003\330\006cY\304\r\315\312\t\222\344\fT\026\224H\331\022\231^\033\272\365\004I\03016\264\013\363\225\345q\301\362\025\001\274&\035W\316\2645B\334\366p^;\353\306d\364\300\262\022\204\366\250\223\262\344\211L\2351\206\0203%C\"3M:#\025@P`T(\031J\274\232\017\023"
+	.string	"\222ITz\022&\231R\312\220H \"\222\244\240\240\220a7)L\220Rp\003\331\376\262\326~\345(\264\027\025\327\004\200\227\200\013.{$\365\017+\317\326\300\314l'\255\266\255\340'\037\033\bK0D\211\ts\321\345*\313\3572\031\314BBK\362\336\227\t\3014\035\261\362\265\305k\377\300\351c\b\224MH\016\231\357\025i\242%C\302\227T\036P&\303,\246\323\223\220\312G\205[\tT\343"
+	.string	"\3008\360\343\315\017Y\321\265\3005\271\3336\304\233xh_p\252\334P\2409\201\257Jh\270`\005\023'-S\311\214,\032w-\235\0137\360\036\372\026\007:\256\274^+\211Z=\036\r\367C\026\203\013\245\037"
+	.string	"v;H\177\311\374\\Z\271\0333\023\303\327\321B\360K"
+	.ascii	"\265\326a\213\221\350H\331]C\220\211\005\243\001N\314\201k\b"
+	.ascii	"\262O\200\204\252\033\2401*)P\217\360D\267\347\373\267\301>u"
+	.ascii	"\310\2220\275<V\2142Q'\240\332\357\027\324BNN\370N\327\\\326"
+	.ascii	"\026\341a\215\216ia8\201\217\345I\222\312h\305\276\266\340N\225"
+	.ascii	"\336\340=\353\301z\030\271\316\261\373`$7\265\026\316\336\266"
+	.ascii	"\345V\307lE\303\327\360\271R\254\277\247\270\027\366\263\361"
+	.ascii	"I,\307T\322j\347>"
+	.ascii	"8`\377\367\2226k\255\315Yy\202\231@\006\t\330\215q9V\201\003"
+	.ascii	"z\267 \2501\200v\2743\224\302\024\366\346\232\3307(tM\220\271"
+	.ascii	"\212\235\036\216\177H\357D\246\320\210\240\352\206\215A2YH\036"
+	.ascii	"\324\236\200jK9\"Ya\035\023\203\370N\213X\034\316:\027\355~r"
+	.ascii	"\304\215\312P\260\376\367o\201\017-~jCc\235\f.N|\212\263\332"
+	.ascii	"\251-\267S\244X\206\2139\002B\0306\246\364\335\001t\357\321\006"
+	.ascii	"\234C\343\3244\231\202\263M\362\345V\201\262\026\230\302\034"
+	.ascii	"3\205IX\311\345F\350\345\006\374\332f\262t\206\215\354\273\213"
+	.ascii	"F2l\363\211_s\251\331\262\250"
+	.string	"\215\344)T\332,\264\023\267N\232,\205w\373\367\321\251\304\037\fV\273\316(q\006\352\035`\353\027s\0044pn\271+\256\355\024\341p\236oX\\\032)\306G\231\002\212S\204\025\241U4%\b{\253\251\334\\3@\021\005\331\251hX\341\257\220-\337*\230\305\307D\2246)}\001\305l\360\350\224\353\007\321~9E\277\373]\347?(X\201\335T\r(\212\rg\331\256\356\003\220/\351\311\246]\333\277r_#Px8\251T|`\212\264\354]\360\t\231x}{+{\233\244F\226\211X\264\355\006\370+%\213\234l\373\256\020\242Y\316\214#\301\233\232\202\n\325\353\322\250\2634\376EV\035\243hN\237\204\320\tO\246\241\305\256/\003.\2459*\352\227 \021\210\317/\323a\007\212\353C\252,\205*\361\301q\207\371`s\376t\377\254\347.\001\221\221\007a^\225-\021\226E\023\016\006(\262$\256\311"
+	.string	"\326!\257\202\030\276\216P3&\313S\027-\356\307\211\221\036%\217\033^\206\201t(\00441:\340\260n\251&W9r\334|\250\004\261\006V\274\364\276\357r\346\202\261\366\360\317?2=S\365\247\254=\227\351\234'\244\244g\002\254\344D\336\332!\n\201\242\\{\312\273\276\r\210Q\321\241e\220\267\3678r\3432\201\025u`\363\316s5)\346\212x\261*\036\214G(J&\310\227h\237\300G\025A\f\2602\255Um%\237\311\306\202\005:\325\340pP\265\202\365^>U\327A\262\217\271M\331\365\265!\003Rjs\221\376$\fGJ2d\034\372\f_b\314\f\313\200r\203/\221\344\323\037S\376\374\302B\354@"
+	.string	"&c;\373\207\0066I4=\207\346t\326\375\234\313\345D\331\217#)a\tZ\261V\234G\0356bk\201\243#\367\230\245\021\324\204s\t\323'\t\217\307\031E\225^\3109O\306\302E\247\273\003b\243^|\343\253\320-9W\251\342\004mXw\341\030J\003\220+\341\263\t\240yN\232pf\006s\235\202\002Cm<\332!0\366\035\241\247\305\243\335Em\274\210\212C|IS\236"
+	.ascii	"\322f\320\254\2465B\357C\317\314t\242\266@\rJ\332\264_\265\003"
+	.ascii	"\205<\237\251h\203g\323\334\"\033\312Q\272\026\231\023+!G\350"
+	.ascii	"0X\310\353\232C\243\253=\260\370\"\204\374\023*w\205\007\345"
+	.ascii	"\013\252\235\201\241_\254\177\343vg\035R_b\237\363\350\344?\343"
+	.ascii	"\226p\364w\346\307\357`\226\276\274\266\327\033\322L5q\363\022"
+	.ascii	"\023\f\354\223g\241\377\022\005\366@&\245\356\245\032Q@\026\362"
+	.ascii	"\366\305\320WL\334&\246n\215\312I\006\223`#\302\232\376d\375"
+	.ascii	"`\b\nc{\326\270\004\262\307\236>M(\007{C\250\316\321\030\212"
+	.ascii	"\025TF'\031\371, \013u\204\214\357\006\247\257P\255\373/V\023"
+	.ascii	"]\274\201}\367m\025\225\001C\202\034<\347\234\267"
+	.string	"\243I\247\036{\240\223;R\362)\215\341\337\226\002\016\360\373\226\322/\022\020\003\017\2705&\340lj\013\244\332\375x\234\370\356\301\002L\210\343%^\362~\354B\277q8:\260\363\004\213\314j\304\325T\023\226\305@\367oP\253 f\3130\247R\222\217\325\272\323}\226%\244g\231\355\020\204\272\n2\275\247q\024L\303\031gC,\355\235\b\362Qh\200qz\035\f4o\250\353\216\325\026\234*A\275\240\250qZ&\276\266\346\b;Ng\344\376HC\020\254d\331\215\202\031.\001@\335\270\367(\377\244\300\256\023\237R\227\021\376\233a,4\210m\323\255\230\\\207hpm\274\210\016\b\363\355 \336R\f70A\277\251\224\3153\025\350\2109_\2507\302u[Wq\353\253\274\036\024\233h\300^6>oh\270\370\023\352\230B\303\\\034\325\330\353<a\252h%\002,%\f4\214\227\331\312\374\224\362\300\347&"
+	.ascii	"\250\251\345\331\033\024o\2472\327\312H\200\375\234\210\272\356"
+	.ascii	"\242\334\206k ?U\322\307\022\215\006\3759\265.Iq\340\016\241"
+	.ascii	"I?\333`\221e\377\257\031\220\207\3413\210\006{\202\334\240Z\277"
+	.ascii	"\303\344P\353Hf\375\334j@\210k\2450z\344}G7Ox\364^\261\225\226"
+	.ascii	"\\\234\233vAc@\271\334y\fA\221!c|\227La\006([\312\265!\230\372"
+	.ascii	"\300b\240T\366\204M\237\003\250[)m\265(\320\331(\355 \235\231"
+	.ascii	"\200\344\344\207\n\325\313\260\360\357\330\307\353\303\276\034"
+	.ascii	"3\246T\210\\\0232\301\244\336\245\313\036\324\b\305/l\250\035"
+	.ascii	"WD\353u)x\264j\221#JF\022\250?\302A\365z\307\277\206\fZD\313"
+	.ascii	"\215\277\366d\261\255\304\347\256X\373\375\240\2303\331M|\031"
+	.ascii	"Lk\315\215!vd\207_C\212n\013\314\027Ib\373\006P\353\202\355\231"
+	.ascii	"DN\026c\256\330q\221\3272{nd\200N-\362)\247\177\242!3\257\363"
+	.ascii	"\302\256\004O\023\365q\270\352\364\003O\315}F\300\205\024\331"
+	.ascii	"\343w\036\n@o\\\3653T\334@\246\310q\022!\220\"\013H\320~\007"
+	.ascii	"\342\215$\034\257\213m\251\037\250\325\257\243\022\002Q\016\257"
+	.ascii	"\016p\237\314\021\275g\330\313(\366.I\177\354\347\246\323\023"
+	.ascii	"\021\336~\335\300c\202]\016p\242U^~\006s)e\371\350+\342\271\365"
+	.ascii	"Q\271\026\274c\006k4\032\273\242l\251{\276#P;\032k\353\334\270"
+	.ascii	"Q\247\351\003c\277c\264\2303\233^@\230\312\373h5U\036\332\235"
+	.ascii	"\202\237m|L\223*\222\346\273\302\2047Rq\266\224\316\273\354k"
+	.ascii	"&\305V\030\272\027\237o\213f\023Y\036\235A\250\036A,\252\235"
+	.ascii	"\323\272qBD\255\006\324\300K\302$u\200\265&\315\370\204\006\202"
+	.ascii	"pC5F\200\200\020|\213\260\246\316\255\202\205C0\025\250E\"\255"
+	.ascii	"\f%T>\334"
+	.string	"\265\322\375R\373S#7+[\336o\030.\374\366\345\352\270\023aH\217\311\031\202\rMY\244\027\005\0236\\T\250\376g\336\233\n\252\365e\321\241\226j\300S\025\354\022\237 o'\206\370\242^\201p\023Xi\362\235-\t5\033\234}\305U\232\360\022L\364\302\230\364\3667\023\r\035\325\211\374zI\271\203\232\274E\253\353\244 \351\021Mu/\257z\356\327\233\004\020\366_\320\026\f1\276.Dq\227\023a\262\\\322-S\202H\242\364\263@\343X\027\260\332\312/L\260\025\370\374\007\366\022x\2507m\320\334kQ\241\020H\032S/\027\204\331e\366\233\243\201\377?\247z%\tnO\337\373Bz$\357\030M\017\362\304?z6\346\3508,'\020\177\006\250\347\312Oy\374N\361\201\211\017\270\216G\277c\226G\277\316\032\035\336\034}\006tq\353/E\312eq\254\2671\346\361\276C\336E~~\372r\322\343"
+	.ascii	"\216\036*\347+\357\323\374\256~N\3046\235g\242\261\202~"
+	.ascii	"\023\271M1L`\277\033\270\363<\030\366w\2021s\251;\027\327I\345"
+	.ascii	"4ic\031\361\036\033\3774\323\265\305\2536\1776~q\217\315\364"
+	.ascii	"\327\333U\305\326~[\314\007\3651\205\027\030PL\364\225\373{\216"
+	.ascii	"w \216\004\206e\234\311=J\337H]@tp_a=\3059\301g\354\334\262\370"
+	.ascii	"j\356\266y\270\2068\376\271\017_\354\235\357\207\332\037\007"
+	.ascii	"\334\276\336\035\355\253<\233\245\236(\267\205\363\n\366\327"
+	.ascii	"\225Y\322\304]\001"
+	.text
+	.section	.gnu.lto_.symtab.4fae565055c26339,"e",@progbits
+	.string	"isUsingSticksForArming"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\001"
+	.string	""
+	.string	"areSticksInApModePosition"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\001"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\001"
+	.string	""
+	.string	"calculateThrottleStatus"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\001"
+	.string	""
+	.string	"flight3DConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\001"
+	.string	""
+	.string	"processRcStickPositions"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\001"
+	.string	""
+	.string	"armingConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\001"
+	.string	""
+	.string	"getRcStickDeflection"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\001"
+	.string	""
+	.string	"rcControlsInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\001"
+	.string	""
+	.string	"pgResetTemplate_flight3DConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\002"
+	.string	""
+	.string	"flight3DConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\002"
+	.string	""
+	.string	"flight3DConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\002"
+	.string	""
+	.string	"pgResetTemplate_armingConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\002"
+	.string	""
+	.string	"armingConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\002"
+	.string	""
+	.string	"armingConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\002"
+	.string	""
+	.string	"pgResetTemplate_rcControlsConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\002"
+	.string	""
+	.string	"rcControlsConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\002"
+	.string	""
+	.string	"rcControlsConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\002"
+	.string	""
+	.string	"rcControlsConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\002"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\001"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\001"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\001"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\001"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\002"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\002"
+	.string	""
+	.string	"changeControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\002"
+	.string	""
+	.string	"saveConfigAndNotify"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\002"
+	.string	""
+	.string	"applyAccelerometerTrimsDelta"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\002"
+	.string	""
+	.string	"compassStartCalibration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\002"
+	.string	""
+	.string	"accStartCalibration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\002"
+	.string	""
+	.string	"changePidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\002"
+	.string	""
+	.string	"handleInflightCalibrationStickPosition"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\002"
+	.string	""
+	.string	"baroSetGroundLevel"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\002"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\002"
+	.string	""
+	.string	"GPS_reset_home_position"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\002"
+	.string	""
+	.string	"gyroStartCalibration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\002"
+	.string	""
+	.string	"getArmingDisableFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\002"
+	.string	""
+	.string	"resetTryingToArm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\002"
+	.string	""
+	.string	"resetArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\002"
+	.string	""
+	.string	"isTryingToArm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\002"
+	.string	""
+	.string	"tryArm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\002"
+	.string	""
+	.string	"unsetArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\002"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\002"
+	.string	""
+	.string	"disarm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\002"
+	.string	""
+	.string	"failsafeIsActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\002"
+	.string	""
+	.string	"rxIsReceivingSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\002"
+	.string	""
+	.string	"getTaskDeltaTimeUs"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\002"
+	.string	""
+	.string	"isModeActivationConditionPresent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\002"
+	.string	""
+	.string	"analyzeModeActivationConditions"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.4fae565055c26339,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
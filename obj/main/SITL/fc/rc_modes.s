@@ -0,0 +1,1053 @@
+	.file	"rc_modes.c"
+	.section	.gnu.lto_.profile.df401c4ddd48d912,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.df401c4ddd48d912,"e",@progbits
+	.string	"(\265/\375`\263"
+	.string	"\215\b"
+	.string	"$\f\247\001"
+	.string	"\034"
+	.string	"\326\363\316\r\002\002"
+	.string	"\002\001\001\276\264\256\247\t"
+	.string	"\002\240\342\234\212\n\003\365\203\345\270\t\004\002\003\002\003\004\350\300\306\254\005\002\002\004\002\004\005\006\226\336\200\374\002\006\002\005\007\002\b\b\203\200\211\346\n\f\t\t\234\315\220\335\004\f\002\005\002\001\n\013\203\357\265\324\b\006\f\203\236\236\216\006$\002\005\002\n\002\001\006\007\002\b\002\013\002\013\004\002\004\002\r\016\017\352\263\360\321\b\020\021\022\246\213\347\204\013\b\023\240\377\330\335\001\004\024\262\270\337\265\r\b\002\f\002\f\r\025\230\311\247\340\005"
+	.string	"\026\206\375\263\365\n\024\016\002\016\027\337\204\215\220\002\030\275\367\372\234\n\031\032\033\317\247\261\273\007\034\240\342\234\212\n"
+	.string	"$ \200\202bUv\221\b\016\257=\006d,\\\202\302"
+	.string	"\016"
+	.ascii	"\221\253y.\375z\234\030\375\f\320\312v\367k\026\345V/\243I@1"
+	.ascii	"\016\300\3201\344\253\354\227\020\320dZ\357\031\022!\303}9v\236"
+	.ascii	";8\\\350\270c,\025\005R(7"
+	.text
+	.section	.gnu.lto_.ipa_sra.df401c4ddd48d912,"e",@progbits
+	.string	"(\265/\375`\227"
+	.string	"}\005"
+	.string	"2H\025\031\200\265I\007\253\2660A\0234A\023"
+	.ascii	"\217\217\037\t\361\275\2215\273\267L)\256n\"\001\230h\210\375"
+	.ascii	"`\240\302\233\030\272\240\300\272\265\224YB\214\211\362\334\313"
+	.ascii	"+-C\306\316\377\026#l\006Y\033\346l\244\235=MG\217h)\357\303"
+	.ascii	"\343Q\347\322\r\366\024x@' p\002!+>\321\b\314\013Z&R\\\246O;"
+	.ascii	"\257\271\225\201\001f\200b'\001\001\216\201 [b\037\303\b\272"
+	.ascii	"\021\315\307\206W\022\006\\\024]\030+-\215\224\246H\210\224\336"
+	.ascii	"\002\243\313\206\223a\243\361R\333\307\206\327\330\360GX\374"
+	.ascii	"O\004\322\274<Z\007\001\027\300\r"
+	.text
+	.section	.gnu.lto_.inline.df401c4ddd48d912,"e",@progbits
+	.string	"(\265/\375`\302\003\325\021"
+	.string	"\006XWD"
+	.string	"\223\223\306\200\263z\255\020\360E\"T,\346\226}\246\234\252\023\r\203c\214\346\330w7Pn\227\317\2774G\250\034\261_P\210\302\027\251BTUU\325\362\007=ml\237\362O\202\320\377\266\021![\312\235\0026"
+	.string	"B"
+	.string	"O"
+	.string	"\333u\237\216\317\226\246\242]\024\365\241I\365.\022\177\035\036\332\016m\372{\366\343\332"
+	.string	"\256\253H\347\234\323\372\tsN\n\037\177\037Q8\034\236l\315\234\363\343\257\243\211+l\234p\031\371\3703\205\233\002f\032a\177\270\300\312T\302\306\341\003=\205 \201\301\300\022[S\017'\365!\356Y\256i\367\335\274\250V\271\306\265\365pR \252\375n<\036\227\374I\024\276\004\240\020\006p\2647<\234L#\322\256\304`a9\207"
+	.string	"\317rr\304\312\214\222\245\322};@\207\204\350U\311\255\320b\303\242\363'\273!&e\346\200U\262\342\240Q\201\"\301\235(#\203\225\321@\223\322K\326\026%\323B\206\034\303`\274\224f:o\242\001/\215\224\226\016\001\204\315P\342\\\b`\240_\007z\232s\202\034\340\030\353I*B\345eS@\322\0225\\\324\f\370s\301z\224\265\361P0 \224\355\341\241`\2563\013\312\301\224\303\025\030i\007S\016\367\231dU$\036\332\340U\035e\250\301\2552BB\001\211Q\n\031\306`\2422U\347\001\0210)CJ!)\0311(H\251\003\367\203'J\r\347F\277\312\270\340\267\201-\257\324\352\250}\275\3518\233\323\243\201C]\006\017\017%\n\273\371g\236\226\331:w`\300\244Q\253\203"
+	.ascii	"p\302\257\352\202k\203hwl\240\244pxw\023\335\220\r\312\203p\206"
+	.ascii	"\336\347\2634\005\301r\372\210\273\204@\2324\214L\350\020h\264"
+	.ascii	"\"\323\206\t\306\255\376\205/\025\021\003\361;\272p\202\203\217"
+	.ascii	"V3\241\256\025\253\202_\341q\366\274\3058\023\320\202\277~ \r"
+	.ascii	"~7\232Lt![]\202b%M\"\261\017\303\257\205\0321wP\352\221j\366"
+	.ascii	"\306:\002\260%U\030\177\030\347\222\375I\271S\004%Ow\364e\n\342"
+	.ascii	"i>g\265\271N"
+	.text
+	.section	.gnu.lto_.jmpfuncs.df401c4ddd48d912,"e",@progbits
+	.string	"(\265/\375`\031\005]\013"
+	.string	"\302M&&\220'I\007\177}\362]@\257\266\273\273\245s"
+	.string	"\244\360_\313w\347\252p8e-aG7\"lDn\261\267L;f6\256d\245\204\024\257\373\007|\023I\202\220\2038U\367\207\027f\334\264X\\\220E\211\f\332'd\314\306\220M\246\212\242l\220\255\235\363A\326\004\362\332k\017\2637\n\237\260\2427\343?\200\216+\254BDT]\357z\r\377h\262v\250B\276i\206W\273?\205\352F~#\273!$zxz\177C\226eYV\305e\343\332^!^\217\257\021X\016\004Z\250\241Y1!IA\251\320\034\220\"\241\243\262\003\022"
+	.string	"\002\"\212\342I\022)B\024Q\204\002\tHB\021\241$)H\2061\300X\207\247-\357\277\332\023s"
+	.string	"\356]~\211jB\004*\257\334^P\242`m\314\263\312[^jAm\250\267\201_\335\355#\225\321\212\325qU\200\245?\305\001#\217L\022,\006.w\037\t\024\231\252-\326N6\n-\252\224\223DHR\232\215\334a^\376\325<\"\326\351\256\256o\230\236M\250\021\373\336!#\020\253\226\3556\355QTB\351\250\313H\265\377\025\275\215\"\276Z\006\313e\325\007\244\\ZR\222u\302\b\226\252Lh\001\017\247\3361\001\365\002\202\001"
+	.string	"\"%r\244\2623E\001\023L\320\300\374"
+	.ascii	"\230\273Q"
+	.text
+	.section	.gnu.lto_.pureconst.df401c4ddd48d912,"e",@progbits
+	.string	"(\265/\375 /y\001"
+	.string	"+"
+	.string	""
+	.string	""
+	.string	"\016"
+	.ascii	"\231\004\001\230\004\003\231\004\004\204\004\006\205\004\b\231"
+	.ascii	"\004\t\231\004\013\231\004\f\231\004\022\205\004\023\205\004"
+	.ascii	"\024\232\004\025\204\004\026\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.df401c4ddd48d912,"e",@progbits
+	.string	"(\265/\375`\234"
+	.string	"\r\007"
+	.string	"\022\311\037*\220\265\031\016\340\257\007\337\035'\243XUu\304\335a\273]\007\302e\343\311\331\266\r\375\366\257\276\265q'e\343\267\233,\2212\005S\025UY\222fJ\300\002X&\226I\345R\247k#`\00138P\270\n2\306\204\214 \327<.\230\001^\t\327L \026\336\3324\225H9\274H\273c\020\032\244\374\321\247=IG\373/\257ye\036*\r\357\367\224T\236\246\347\\Q\356\312\250;;O\202* @\002e\n\311\007S\310\225\345n\334\020\r\n\006\360bHm\314H\253\235Ij\030WP9\030wwa\365\213\316\033\330[\347e\315\334\235\324\260RS\016\021iq\277\323\260\274\245a\301\340\350\n\346\003k\236\257\"t\030\340\211!\216=\204\262\306,\200\235q\020\220\021kt\225h\363"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_.lto.df401c4ddd48d912,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_modeActivationConditions_Registry.50.df401c4ddd48d912,"e",@progbits
+	.string	"(\265/\375 \220=\004"
+	.string	"\224\007]"
+	.string	""
+	.string	""
+	.string	"'"
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\303\267\355\017yw\250\376\006yu"
+	.string	"\005\001\006'\001\300\002\005\001\006\035\001\024\251\300"
+	.string	"8sq\301\001o\300\001m\277\001k\276\001i\275\001g\274\001e\273\001"
+	.string	"\013/root/repo"
+	.string	"\031./src/main/fc/rc_modes.c"
+	.string	"\004"
+	.string	"C\210\021\346\r\317$y"
+	.ascii	"p"
+	.text
+	.section	.gnu.lto_modeActivationConfig_Registry.54.df401c4ddd48d912,"e",@progbits
+	.string	"(\265/\375 \236\225\004"
+	.string	"$\bk"
+	.string	""
+	.string	""
+	.string	"'"
+	.string	"\005\001\212\001\206\200\200\374\342\203\275\212\023\001\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\306\030us\326\007uq"
+	.string	"\005\001\006'\001\300\035\001'\001\251\004?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\031./src/main/fc/rc_modes.c"
+	.string	"\005"
+	.string	"P\005V\t\036f\361\024u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_modeActivationConfig.56.df401c4ddd48d912,"e",@progbits
+	.string	"(\265/\375 :]\001"
+	.string	"$\002*"
+	.string	""
+	.string	""
+	.string	"\004"
+	.string	"\005\001'\002\002\177?\202\210\200 }{\276\001y\275\001w\274\001u\273\001"
+	.string	"\002"
+	.string	""
+	.string	"\002"
+	.ascii	")\276\f\240\b"
+	.text
+	.section	.gnu.lto_IS_RC_MODE_ACTIVE.57.df401c4ddd48d912,"e",@progbits
+	.string	"(\265/\375`1"
+	.string	"u\b"
+	.string	"\246\020=8@s\322\001\2306\214\367\037\230\256\302\272\233g\243\333\327\311s\031t\017\374\0255\202\200\364I\0060\350IM\213\374*\002\353~\t\304\306\026\342\376\223\240+k\311\336{\247\024,"
+	.string	"-"
+	.string	"*"
+	.string	"FH\340\334\275\242L\037\351\340x\251\331\2554\232\274;\354\374\253.S>h\276\223w\310Y\330]\303\357\344q\307\3336\260\r\262\275\n 2\0033\273\246\033\233\215\231+\024\333\234\355\261\r\241}\225\257pOe\030`WD\005\263[A>\350|~.`}\312\007X\237\266\003\005\250\335\322?\237\345-\024\376\311\247\265\r\376\373\3647\013\f\370O\306\317F\364\354\352\301Xb_\356\356:\222X>\365\303i\005\"\206\013\354a\372\ni#\021Fj\2702zAP\211\b\007\022\2752\215\206\b\214M\2142Z\201a\031\365\324\275eT\b)E\rw \214\257w\331\002\b"
+	.ascii	"2\003\302\260wqz\036Z\355\202\312\2446\036:X4\265\363\t"
+	.text
+	.section	.gnu.lto_rcModeUpdate.58.df401c4ddd48d912,"e",@progbits
+	.string	"(\265/\375`$"
+	.string	"\335\007"
+	.string	"\242\01787Po\322\001 [n\365\276\025\024\230\257\275\233\240R\356%\004\213,\016\216X\334\032\202\203)\022\254 \253b\202\372|\263\324\231\365YG\260!y\022\207\t\333\233\354\235R\330\246\331\030$0\216\345+\323\301\034\262M\303\245\321\353\201r 4\033zi\035\232\3018\213\3004\272e\231F/u_m\374\274\360\201\002\305\n\373\246\tO\301\210\344\233>\342\361I\246\340\340\275K\237\233\227\233(\345B\003\004Sv\375\300\270a\277\332\335u\374\354\227~XM\017\025\f\312.F\252eQ\362\244\343b\373\320>\310C\272\227\270\013\354~%&\273\025\301\007\326\245\353\t\346\245\365\201y\351\316^y\035\355ID\026'\226\335\245\221\343\335a\347_\344\001^\350s\b\240\260\273\206^(\343\216\267m`;\301\366)\t"
+	.ascii	"2C\363\f\f\217J\230\t\244`\310%\330f5\005\334\345E;\311"
+	.text
+	.section	.gnu.lto_airmodeIsEnabled.59.df401c4ddd48d912,"e",@progbits
+	.string	"(\265/\375 \344]\006"
+	.string	"\342K,3Pm\222\016$\243\352j\322\334Rw\353(\020\346\rS\355\3017%\273j\377n\207\247w\336-\020\277Vff\020M\027/\363\003\331\251C\207\265\277\267L\001O\230M\206\201\322(LU\233\032\332\203\303\202\246M\325\246a\004\246 2U\213\240\250\252]\260,\212\016\007>8\361\r\251\210u;\226\340\\\257J\227c\251t\030p\361\271\3541\317\341\306\267\222(\372\357C\202QMN2AYJ\226H$\036\177\347/\037 t\266\212\215@\325\310\240\030A\311\304\032r\324\352Y\267 \255|`dW\310\323\003H\310\314\357\nYt\354_\360\033\374\025\001\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_isRangeActive.60.df401c4ddd48d912,"e",@progbits
+	.string	"(\265/\375`\241\002\205\025"
+	.string	"Vi\216J\320\322(\035R\202w\251\001\201\003lc`\243\016B\301yw\3109P\247_\264\037\023jBR\317w\301\266\276\006\367+\004\211\006\017"
+	.string	"\234V\271pJ=\f[d\255\003\001\3313\203\241\345\320\352\320\265\037=@>!$I\231\002|"
+	.string	"l"
+	.string	"{"
+	.ascii	"\332\302F\1773\002X\023\027\334\261\374\264E\352X\352\t\251\243"
+	.ascii	"\277*T\343\317\331[Q4\347o\201\017\224:\332v\203\025\033\327"
+	.ascii	"\364\327\223\243;>\272\027Ns\376\\7\2415E\221\243\370\255Y?("
+	.ascii	"J\201:6\351\020\355x$\224\034\241"
+	.string	"cnE\025\017\204H`\316\231\342\341\366\"\202\036\222\b\025\357&\266\224vx(P\367\206\247\333E\265\3149\275;^\bu\251\266ml?\260\027G\nco\200\3111\352bV\316\211s`\rN\330P\376\350h\235!u\324\373\340\374\364X\f\331vh\377n{\237\255\342<\217[^\243\250\220\352\211\376T\001|\315\362z\365\265\352k\223\257K\276N}M\362\365\310\327\345\327\250\257Ir=~-~\375q\275\343Z\003\024P\241\023\246\320\2303g8d\352\030\215N\330N\331\026\327\326\241\332\363\364\243H\274\317\255\223\\\201\232\362\021DJ\275u\357\016\310m\344$\377Q\256\227R~\344d\217\034\220\276<\220\016\021\n\207z\352d\023+\005y\324\275\271 \343\311\2139tEl;\364\2403`\345\234\223\305\032Ce\304\374\002\263\272\203!u\034\277\302dd\333\241E\365\021\371\213\327\\\357\266C\237\374g"
+	.string	"\274\021\334ATdm\bQ*\361\373\274\327W\b&\341\366\3116\206\261\027\331\2136\322\304\\d\0222\304d\262\327\005\b4\035^+\303Tdb.\263\030\n0\232\013f\301%\203y\305\270`4\031\227J\212g\032b4\027\207\331\214\346J\375l*\316\363x\300R\220NH\242DX\372!\022\256\265F\256\274\272[l\277\241\356\363\216\ttE\005\312\372\215\315:\312UG\222\367\211D\202z\234\306\363\250^\203\263\024LR\241\232\\\2455\264\344&'\217r@\373\222+\n\035\241N\0030 @\002B\220\223v\265\241\245\025\350\225\360\306\300\027\3576\366\326H\021\256iL\363h\213g\371Gq\216\353E\234\001\302k\t\276x\f\026I\023\006\306\311\214\350cG\244\301\223(e`\347\340\315\341u\306r\3504\f\332\342V\212)"
+	.ascii	"\204)\213\316\nYx^-|s\270RcF\017\202qF\026\037a9*\266w\003\312"
+	.ascii	"i]\232d\341*\264\353\265|\017"
+	.text
+	.section	.gnu.lto_updateMasksForMac.61.df401c4ddd48d912,"e",@progbits
+	.string	"(\265/\375`.\003\305\025"
+	.string	"&'\214J\300RN:R*\352\227\027yy\213E\361l\265\243\020\251c\210f\212\375\314\271\211 K\024@!\245)\261\257\266\336\037\177f\254_\277~\357$\020\331\246\313\350,$d\333_\264\266\020\320z\036\264/J\313\226\020B\210\334)\005y"
+	.string	"m"
+	.string	"w"
+	.ascii	"#\343E\353l\253\237C\365@\027:LY\265\326\331\222\270\356\256"
+	.ascii	"\222\034\305p\251\316'W\230\356\362\231\273\273\216\363\363\262"
+	.ascii	"\210\212\307\207\222&!z~>R\361\374\274L\017T\fa[:U\"\246N\230"
+	.ascii	"\322\313\002z\231=\032\276\351&E<?\341\201Z\253\210\311\243\033"
+	.ascii	"\222\354\240\360\211\2309!\202\253(\037g:\375`\362(%Wj\255\246"
+	.ascii	">\263\347\006p\333%lK\260W%+d\177\351\037\271\322\037\373\371"
+	.ascii	"\207<\351\207\211\324.\221\272\024\251\311\221z\\\352P\244\336"
+	.ascii	"\245\246\"\365\005@\250YX\005\234j\335\t\002\251S\342\013\"\333"
+	.ascii	"\267\337d\277\376\262\035R{A\003\335\227l~\032\b:\217f<Pzb@\317"
+	.ascii	"\016\003\002T\036\020(\301\251\375\243#\351\236tsY\255BZP\265"
+	.ascii	"\236\n|R^\364y\222\361b\371W\300\024>\343\310\236\374~\320\030"
+	.ascii	"Aj\024\211\267\215\343\226\374x\330\265C\331\306}\323)\321\357"
+	.ascii	"F\020\222\327\204\222\223\214\360O\017\227Z\355\306\302\275\212"
+	.ascii	"\026\273w\302\361\017m]A\255mF\272.\300\034<\272e\030\375\206"
+	.ascii	"\254\035#C\357\243\233\002\242\267;\333\267\263\300\225\265\362"
+	.ascii	"T\374\0250\032\312\0237\343\305/\205_U\020R\022\016\r\332\347"
+	.ascii	"\216\256\b\373\033\f\006\203\016\266\r15\265\b.\034l3\244\f\r"
+	.ascii	"\255\302\313\f\215\254\321n\353\032\n\215\355\005wk\251\345f"
+	.ascii	"5\230\331L\f\3556\253\345hf(\004\214\313`\313\315jp\270\334\354"
+	.ascii	"u\326\207u\205<\001k\ngs\302Zku\221\320\330\302\326\276\200\341"
+	.ascii	"L_\351\355\256\304)\307F\271C$\243.\026\0074\\\353\212\352ad"
+	.ascii	"K\001u\214 e\264\334\330\332,R\245\226\214\222-4z\237-\300\300"
+	.ascii	"\221\3732w\0309@\2501T\244\210\263\212$\345$%\311\001\300\002"
+	.ascii	"\021\2413\017\021P\3015dJ\222\322\0166\372e\265\r\222MU\234^"
+	.ascii	"\204\026\327;Z\207\266\226 \200\030\340\212Q\354\201\274\227"
+	.ascii	"\322\310B\305+V\305\002NY\"i\324V\375\032\222,l>8\346\223\324"
+	.ascii	"\273?\254xY\370 \3460\032|,^\357\033\322r\277Qh\242v\364\224"
+	.ascii	"n4$\031\301\b\200P\245%\362H\241\222\261\201\020\016@r\303\223"
+	.ascii	"\254b\037<\241j"
+	.text
+	.section	.gnu.lto_updateMasksForStickyModes.62.df401c4ddd48d912,"e",@progbits
+	.string	"(\265/\375`\325\001E\020"
+	.string	"F\237mF"
+	.string	"\261&\035{ \007\030\335\356\b\177\207\307\335\r\027\346\307\323\017\3649u\214\352WA\225\244\211\257\320\321\214i\023\343\260\252\306\311\333\021\202\254\257\217ci\337<."
+	.string	""
+	.string	"\271Z\207I\362\342CO$\204l\"eJ\001W"
+	.string	"R"
+	.string	"^"
+	.string	"!\253b}\340\331\005\0318\201\366h\360\"\330\243\366\001\330\243O6\216\2034{V\220\007\235\237\335\335t\304O\217\227\346\311?\353\037\336\207z\324`~\001\370`\256\227\202V\317\016\220Ou\211\254Hxg=A|.\231Y\204\335uz_\210\033\273m\t\266!\330I\022\241\r\272\244\316\330\3270\fC\253\214\375\234_;\370g1\215\035\347\217WZ\257t^\351\203L\210\371\311\201\240\306\356*\344\261>\021\206\215\355\373:\337ay\n\353\327\303\304\356\206\036m\026;\364\370\220\235C\303A\202\246\232\005O\373(~s:NK\201]\336s\203\230\236\324\217\257\007\320i\202Z<\2523>\007\f\323\263."
+	.ascii	"\fQ:l\334Pe\220\003\344\365*\376\302t\200f7u\317oq\027\031\214"
+	.ascii	"b\312{&l'E\224\3670\375\316\265V\t\037\240\326\213\242l\217\316"
+	.ascii	"b\203\266\253z\340\257X)i5-\330\343\225d\325\022q\203\223\312"
+	.ascii	")%\256\244\303\211J\226R\342JLT\270\254\343D\352n\244tb2\022"
+	.ascii	"]\350H[\207aSA\341D[G*m#\006<\322pB\332VF#\322\026\002S\277V"
+	.ascii	"e\256\0301@\255\224\272\\\273\273\221@j\232iT\233B\005LQ9\343"
+	.ascii	"ees\205\244\252\246\266\005\031\252\037_x\"$S3\265\271# \300"
+	.ascii	"\202\0319\362\223\241[\024\270\327qZ1\224\264\031\303+\200\333"
+	.ascii	"\263\273\272Y$\273\013q\027KEb\305G_\001\260_\334f\311K6\262"
+	.ascii	"\"\221VH,\306\201\326f\333\2107fG\016w\241\2271\"\200\243\f\275"
+	.ascii	"\274i\262\215\271F\013\241"
+	.text
+	.section	.gnu.lto_updateActivatedModes.63.df401c4ddd48d912,"e",@progbits
+	.string	"(\265/\375`\344\f\305A"
+	.ascii	"\352q\300\030AP\246N\007\003\020\245\3764\027\336\202>Y]\035"
+	.ascii	"\325\272\315=\317y\351\231-\035\265\260a\326\215L\343z\235\257"
+	.ascii	"\203\362\347\375DDDW\377\363\013|\020\032\240\303\241\002Bv("
+	.ascii	"}\222d\357\235RJ\001\177\001`\001\200\001gt\270\361\330\252\001"
+	.ascii	"\333u\264\212Gg\213$B\332\0345Em\353\344p\347\334#\330\205K\263"
+	.ascii	"&J\327v<\272\216%\214\001b\252\3111\013y\264\3519\037-\307I\310"
+	.ascii	"\273\216\303\334h\270\343X\350\246\337\260\r\207\353\212[\316"
+	.ascii	"6l\002\032\237\232\206\333j1m\247\325\207\232^\363\243\321\260"
+	.ascii	"\210@d~0w\232~c\026r\220F\303A\310\242L\265V\231\2030\013[U\373"
+	.ascii	"L\267\365\223\205nh\023\234B\212\301\26653\023\207\301m\265\325"
+	.ascii	"z\215m6!\367\b\026L\302\305\214\266-\230T\253\214\340\266\312"
+	.ascii	"\316~Z[\275\355\264\266\3122\013j\347Y\333i\236(\323(j\333\226"
+	.ascii	"\352\257(1\261Sgs\322\263\355\324\304\264\244"
+	.string	"4$&!\t\217\202\027\270\252\351;\313\r\304z\266\213\tz\356\261\t;\266S\226n\312\222\026\231\362\200a\351'\232/\235\315a\272R\224\03662J\023S \027\222-\235\007,-\275Z\024\235\353\270\244'Y\021\203\322HB \226]\253\211\312\234e}d\200\212\230\223\016:\361\333\344\013\030\023\007\246Q\314<%\3030e\372\204\247\n\240\266k\003_\300\312|M\213y\300\236\244\305\266m\205a]\256R\021{\322i\032\025\225K4\f\343J\237\220lYv\234v\257\260-\377\216\353(4>\265>*bP\332\201Xm\333\262/\303\304\232\237\232\271\307\230Y\006\2630/\337d\2555}\035O?[\276\210\213\376\337r}\306x/d\360^\246/A\n\027ohDY)\306\240[\016\016yH\237\b%J2\325\n\265\241\032k\253\377u\306\240\3145\266\271\216vxD@z\220\207\364\216/P\013\372"
+	.string	"\"D\210\265U\250\357\271\006A\307\204\202\331cC\326\357\277\246Q\372!\375\317D\377\031q\333\266\275\342\356\323~Jp\247\265\312'Px/Q\254\255\366w\234N\303\024\272+3\207\364\277\207\273\343\n{n\362\002\215`%\362\255`Q\007\345:#\247\241\375t6rP%\277\315x\253T7\232n3\016\317\226\3140dx/\231('\332\027\355\372#\2633\351\337d\356\253\263EQ~3\346\325\031\303\221\363\205\325\031ku\266p\235+\\g\n\327y\302u\226p\235#\\g\b\327\371\352:?\270\316\016\256s\003\2413\203\353\274"
+	.ascii	"\350lU\005tN0\325u\232\243\216\234\241\2563\200\276\203\323L"
+	.ascii	"\\\235\235V\347\246\353\314t\235\227Vg\245\240\363puN\n:#]g!"
+	.ascii	"\320\371\350:\007\257\363\275\316@\240\363\032tVW\3474\350\374"
+	.ascii	"\327\331\201\316\275\001\300!\346\223&\224\337s\266H\376\030"
+	.ascii	"\265Pu\216K\327\351\276\353\206\323\315\326\355\354v\353\225"
+	.ascii	"\271\365\362x\006Y\\\307\235\306l\031\323y/\231nm5\370\001\372"
+	.ascii	"0A\372_\247m\333\266ISM\374\252\357\270\226\242b\347H\337d\002"
+	.ascii	"z\310(\343\216,d\351I\203\213[[QcU\371\375\256\253\213\302N)"
+	.ascii	"*\377"
+	.string	"\310X\177\017\314\331I\356\301\371\t\277\311\036\224j\277S]\341\275\230+\274\205o\245\037\362\350\233m\324,\305\004\337\214)\374\203\017\362\245\347\251\347Lz\302S\360%-\341'\374Z\327\365\305\352%|w)\213S\372!\255\272t\365\335or\204\177\360/\350i\007\230\204\360\021\376\353\272\230\002\256\036\302\257\201\272\276$\370\253\377R\006\007\334r\360\017~M\264\004\246\301;x\366\256CI\377c\006\337\340S=\245\037\313\304\225\260U.\273\230'a\233\354\025\026\013\226\265U\006\337\240\317\\\332\\\267\002\177\301W\265\335=\367\336\230I\336\003\375*\004\374\346'x\027\317;[\276(\213#a\307\2008\362e\304\352\241\372\3301\253\305\227\354\230\250\2574f\226\213\027a\275\274\327\030 \325\211x\227+Y0k\253\t\276\355\332\321\276\322\230kl\353\003\377\365\3300\276\305\216Q1\006\310\223\216\\\277\351\332\363\306"
+	.string	"1\221\003\307\266Bu\326\252~oy\352m\371\242\277,\2521>\277F\352\253\205\364\312\260\271\227+G\032\251\007\274\345\372i\274r\335\006\365\314\254\031vm\310\306\020\264\353\217M\306%\221\2224<\003F\017\032;\214\027\\"
+	.string	"i\264\017\0307\2005\264Z|xq\243\005\360\303\217\032F\032;\264\204lT\240\005\343\005\016\033,\214:\250\2141\250n\320ha\203\312\250C\213J\201"
+	.string	"\306\221\003\206\016\252\0358p\350\240\022:\221\375f\354LR\375P<8MS\r\340\275<\230\201\"?\311\346\024\222\266-\025\013\355\326\035u\363?vz\3667\207\323\032\362\307\036\217k\253\316gY\b\300;}\257N\337l\252\344\332\\\023\206"
+	.ascii	"mc\216\206\364\020\233M\256\r\347O\343\200\263\266E\366\322M"
+	.ascii	"\310\033\206\357\267\276Q/\320\276(\327\037\233\330,Rc\372&\267"
+	.ascii	"\242n\372\317\363\364C\301\235U\256\314l\021\326\313{\331\364"
+	.ascii	"\375\354 \031<g_t\353\217\334n\315\256\346kB\276\214\3065\r5"
+	.ascii	"\345\315s\257\215\223+\177p\246\340\f\312\206\261I\372\331$\360"
+	.ascii	"\332\276\250r\351\233\234\264\034N\375\373!J\365\323\3233\211"
+	.ascii	"\031c:&\245\247\237\372\236\323\t\220{\236{oU\276\364\235\227"
+	.ascii	"w!\352\227\336*m\220\322O\351\223>\352;\220\222,9|*}\377q\311"
+	.ascii	"z2[\264\f\277\363\260\024\035\351;\257\333\222\236\305\022\307"
+	.ascii	"\2225\203,\355\354\n\222\363\221\245\351yS\217y\206\233y\225"
+	.ascii	"\013\337zG/$\341S\\J\211&(\216\276\361\372\300\032\331\031s"
+	.string	"\355\207\337\344&\276\031\013\321\220\252\376\375\270T\023\337\353\203\237\301\016;\024g\006\200\367\250Q &\025bH!\031\021\221\321$i\f\200\002\221\251*r\003\021P)tlFD\024\244i\016\303I\037\336-_\301,\020x\217\271\354=t\313\271Z\203\371h\340\261&[D\007E\262\3412\362^`\272\206+\005N\210\024i\270\317\300\027\342\372jFY\265#\210\036\322\204\263\226\307\303\372g}(\225\016y\022y\"f{\217\231\274\3461*y\347\254O.\202(@\357&\336\306\007\004\254)\353`\323+\235\013\376\346\201\303\307%\272\223\331\201\374xB\322J\351\022\252\264#\026s\306\n\020\250kNif\2628\023h`>\354%\217\234\314\206\024\317;7>Rn@\352\354\202\0375\344\2634f\233'\t\251\350\323\336\234\006\267\344\343lj41\310\002y!\325\336\321\324\202Ga\336\230\346\360LH0P"
+	.ascii	"\373/\260\326\t\345\027\205S\243\234*K~F;\021\030]{$u\236\225"
+	.ascii	"=\325G,\254$\351\256\242\231U\001\321L\022}\034\fv\030\342\177"
+	.ascii	"b<\0055\355il\023\022\017@\222\250\005|\205\253_\0317(\027`\213"
+	.ascii	"\313\351\250\364\232\272\022\005,\227\362\241\346C\3633!Orp<"
+	.ascii	"\345\303uM\344\276\b\004\305\323{\225\232\346b\255\003$l\246"
+	.ascii	"\023\013HQ\356\360J\300\222\003\n`\246\374\035\351\332\361\215"
+	.ascii	",\362\362\b\322\035\244z\331\r\252\360\311d\037l\212=s\316L\373"
+	.ascii	"\030\264\22142F\273i*\326h\251\272g\216\335\345\320\242"
+	.string	"\220Z7X:>\325\346\231_\327\20326Kk,8a\031\302\244\201\233!\016\345\271\225\201$\005\365pu\013B\r\321\257\223\361\031"
+	.ascii	"\005f\016\240\317\204\360\207D\320+Sr\234y\023\352\n\370\203"
+	.ascii	"\3666_<\031\274\233^\306sp\346Q\233:\3416\211\003\\\306\017`"
+	.ascii	"U\207zS\261\360\201\027\227\211\211.\271{\333\310F6\312\fs\""
+	.ascii	"I_\234\371\003"
+	.text
+	.section	.gnu.lto_isModeActivationConditionPresent.64.df401c4ddd48d912,"e",@progbits
+	.string	"(\265/\375`\373\002-\025"
+	.string	"\246'\213J\260\022R:\340\364\216\210\344v\332L\350\226-\365\305\245w\200\247\235\036\234\024B5i"
+	.string	"h<\221`v\001\200\370Z\235e\n\206\307\310\261m\271\347\220\377\224\236|y\323\260\201\351m{\017>_\263\341-l|kdo\271S\nz"
+	.string	"m"
+	.string	"y"
+	.string	"\342\351<"
+	.ascii	"\3614\201\002\031\343\016\364\341\335\207\303\346\310\252V`l"
+	.ascii	"I8\300'\360nI\334]-\221\316\2258\177\346\256\2714V\036\276#g"
+	.ascii	"g2\300\262\211zP'['t.\326\320\331\240\251\003\257\244G3\245\211"
+	.ascii	"a\325Q\344\354\3109\r\360@q(\351\325L\023\035#x|\274\304\351"
+	.ascii	"\355\344>x\311\024d\234r\321\323\271l\255\324Z-oz\033\356\327"
+	.ascii	"m\377\330f\261\345U\353\263\201:I\240\007\230\345\355\261G\376"
+	.ascii	"\373_\226\026_t\323)=\251\364Ri9\245\017k\001aU\225\"\254\225"
+	.ascii	"W$\253\346\240LA/\372\355;\303\215L\222\023\222\242\326\n\263"
+	.ascii	"?\372@?hX\221\235\\39.\341\321\360G\255\025\345\3241\327\351"
+	.ascii	"m\031\033f[J\373C_!\363\237\006\277j\025qc\251V \002\237\270"
+	.ascii	"N\007\334$\020^\203\266H4\234\346>J~\200\002bD\327\347]\271\022"
+	.ascii	"h\204\212\360\031L\263\365\221\261\264\373\246\022ny\f\027\227"
+	.ascii	"-{\322\254Fa\274\220\2532\374}RI\301\271>\277\366{\033\207;\211"
+	.ascii	"e{\302\221h':B<C\265\356T~d\307\274E\205W\020Oh8Tk]\300\342\302"
+	.ascii	"\232\377sj\033\006\371\233S\037F<\375~|\201\334\020\025\277\234"
+	.ascii	",\262SK\277\020\033\246@\373\313\003\321\262\024\230\331\213"
+	.ascii	"\255\326\"\273\305d\022b\026h.\265\230\354\006\023K\021`\333"
+	.ascii	"\205\331-\026c\263\335b0`\356\333\343y\033?\321\035H]\t\225Z"
+	.ascii	">N\374x\026\251\036B%\372\343DQ\\\257\344VG\304\265>\267\250"
+	.ascii	"\304\221]*\211r\2728v\022\351\3767R\355$\326g\255\265\266\016"
+	.ascii	"\234\356\310>\370\231\005\244T\303\243\333\247'\"\032\3614q."
+	.ascii	"\211\217\221*4 \220\002\241\232\254\003\346@\316\357\013\265"
+	.ascii	"\360\020Af\"w\3405\266%\tK5\277\242(\337U\326\270\001\354\t7"
+	.ascii	"*\007\201\206cf\3562!L\307\305\330\230c\270\210-CX\263\200&u"
+	.ascii	"\r,/\326@\3129\260f\341!\024\337\024-/\330B\313\"\220\320;Q\367"
+	.ascii	"%\241e<\256\025-\220\2067\233\256\013:\001\026,\200\n\013\301"
+	.ascii	"u\220Tf\262\255~\265\213\f"
+	.text
+	.section	.gnu.lto_isModeActivationConditionLinked.65.df401c4ddd48d912,"e",@progbits
+	.string	"(\265/\375`\030\002\035\022"
+	.string	"F\243{H\320\322(\035\212\3708n\306\202\265\347\250\222\"\231\304\262\036\355+\316\024\216\325\026\210A\220b\263\255\345\366,\254\376\360"
+	.string	"T>\242\307\333\034\316\344!r5\375$\366\211\241\224\371dO\024\365&\017uV \237\220-eJ\001j"
+	.string	"^"
+	.string	"k"
+	.ascii	"\t\024\310x\365Y\211\233\307\226^A\272\335Y\250$,\340qv\177\271"
+	.ascii	"\272\351\363\242\346\312\237\271)*\215NG\004\366\212(J/\035\257"
+	.ascii	"\265\362S\221s/\242\374\2540\241\265\333\214\023\354\2251\036"
+	.ascii	"\330\251\201#\002\243\211#9D \335\366\264\201\271R"
+	.string	"_{\026\355Z8\030\260\234\247)ew\2355\260\0177x\3339\266U\3544\t\277\311\351x\332\2551\2351\375\020\230$\235\217\260\307\356\315niqxE=\247\375\366\255\341@\006\300\332\351v\367d\337\346\317\374\232O4\033\2013\036\300[P\220\244\335-\271\347\020\274w[\306>\331\316\264\357\363\037\231\31368d7\204\r\242\335\031\002\223\200\367\b|\344\273\027\037\340\273\027z\2036\002\307\273\313\227\232(l\271\t\027ry #F\252\311\321\037\333!T\213\032\263I\257*\333\221+\225l\267\374\205\013\211\016\317\216\317\256k\301\203\354\fw\361\022\322s\223\342\310gw\031\264\370-\345\237\270g\230\230|\315=\037\303w\357z\333\r\264\200\200\310X\271S\034\221\f\204j\314\236\265\262\200\214\006\222\225\307\006/\013\246\320\362\025\007\237Q'1,+\251\027\b(U\210\222\020Vh\211\360\022\242T1\341\311"
+	.ascii	"\247,\260\250\302\013\251\224*<\315XW\036\237\305\033\340:\334"
+	.ascii	"\206>\177\365\335v\025\\\315m(\376\253/Fu\nK[<L\032\263)\347"
+	.ascii	"\201\252\271,\271\252\215\215>\325\313l9W*=\356\356~&W\005\365"
+	.ascii	"\265\307\245\236\037\034vZ\271\313# \200\202)\263sf@N\263\217"
+	.ascii	"\262\205\277\025w\370\032\"IB\362\346;\312\362\205\f\302\330"
+	.ascii	"\372\260\322\341)\313\346\353!$\337\324\226\027l\241m\021PhO"
+	.ascii	"\324\276 \262\214\213k\241\005\322~\263a]\340DT\004+\312\336"
+	.ascii	"\203K\"\371\"\277\256C\006"
+	.text
+	.section	.gnu.lto_removeModeActivationCondition.66.df401c4ddd48d912,"e",@progbits
+	.string	"(\265/\375`\227\005\225#"
+	.string	"\nA\020\016J\220\330Q:\n\002b\350\274\301\311\2233\3249U\254\277\372\267G\373C\342\366\374\"\271Y\361A\264\237Z\202e\b\201["
+	.string	"\345\313AJ\342+@\024EK7\222L\200\007"
+	.string	")\277\351QR\027\220/\276\355I#\261do\271\223\f\317"
+	.string	"\277"
+	.string	"\320"
+	.string	"J\322\264\250\200o\346\357\200\337\224\277\3665\345/\0231\203\371\260)\375\361E\222\361+MS\\\337\210\261\315\355\360\\k\242\333j\264\031*;\315XIsmW\">\221\027\030\222\334\371L\334f\373\304\327\357[=\031\326\001X\022\226\033\215j\3556\226\202\247\315^\004<Jc)\306e\366F\211\307\356[\275\237E f\211\327\237z0\352\211\372\220\252i\273\310\021\353[\275\027\326\201T\020\034\247:\201\247\236\213\032\223\375h\361\222\315\026\247\261<Y+\244\276\325\003Z"
+	.string	"5\272\020\377\324k\252\367\346\326\"\bf\255\250\371N\330\033+5\274\234\352\225\347;\252}\343\357\215\337\030\032K\301\327\330\2034M\271\356|Kg"
+	.ascii	"g\376\002f\226\300|;\033\370N\277\f\324\241~\367\313\357P\376"
+	.ascii	"\346\364\257~\227\370\274\224\222\254X\320\372}\252_ B\302$\235"
+	.ascii	")\252\311[}A\"\325-d\036\032U\231\257\n\nn&\346\235\263\262\216"
+	.ascii	"Y9\007\347S\277M\254rMY\331\366\342\2316Ce\037\236O[\331\374"
+	.ascii	"\255\\\332\312\267\254l\313\312}+W[\371\002jg\2544\300JS\245"
+	.ascii	"dX\252u\231\364x\361\037\362\217\374J\304\217\214\326@\2128\313"
+	.ascii	"@\t\302'\276\212\031\345\021?r\254I\026\0253\372\"|c\321\212"
+	.ascii	"\353\3273\202\031\375\355\023a\224\231\2077\323D\317<\036c\210"
+	.ascii	"I\323a\202_\306\231\277\314\374\312\374\250K\021}\252\004\237"
+	.ascii	"iJ\203K7\340\025\035g\331\365\251J\211\216\001\364q\324s+\346"
+	.ascii	"\020\247\222;{Ly\026\210\362\267\354#\331\322}\373A(\256_\351"
+	.ascii	"R\304\210\331\302\250\256*%N\263\2459[V\363[\331]\237\210Th-"
+	.ascii	"\353\356\nP\\6M\3234\206uY\343\364\005\2500HA\243\232\3446\002"
+	.ascii	"d\202R\266\220\377\236\255)9h\232\211O\365\323\251+\205\2655"
+	.ascii	"\333\236\365\331<\346[y\036\270\203\310\345\250\202\335\026\376"
+	.ascii	"V\316\332\326\\\221\274\214j\362\\\f\273\261\302\266\220m\272"
+	.ascii	"\266\020q\313Q\005c\346\f\207\342s\373\205\005\243\3224\355y"
+	.ascii	"\222\243!\225||E5\271\023]\371[\273\351\027\026\224\232\372\325"
+	.ascii	"\227\350\312\242\226\335\257\230I\\I\256\344jJ\323\224\001\362"
+	.ascii	"I\002\314\001\350!rC??\272R\003\204\222}x\206r\032tA\030|\204"
+	.ascii	"p>?8\017@\031\202p>BC8\036\035\326}\310\t\341B\350tB8tX\364f"
+	.ascii	"B&\265\212\332\210gk!\237P\264\035\2472HZ\363\330\322\320>\221"
+	.ascii	"\233_e\246\352\243|\326\274\337J\332I\346N\222:\252jh\254\331"
+	.ascii	"\336G9\332<Z\357\364\215\277,\204\324)ZM\2459O)\023<\247\231"
+	.ascii	")X\250\337q"
+	.string	"\315K\013\251M\004@Q4\316Z\210\3524\037K\204\323\005\037\313\204 \276\023\037C\371\253s@E\026\221\353\b\214\252o\351\272\253\311\303\255\344,\226\026\255\232~\325\255\231\031\266M\0136$\211\001),\262\310LY\263\215\311:\326\274jv?H\0272\326m/\345\266\003m\250q\034\304\220RL)\221\211fD*\315\030p\002\2312\252\036\021\240\321\013hJ\n\303\236\001M\2763\223\370\273q$L\246T\271\311Nb\346\344\217\310x\351C@\217\3317SN\237\004\373E\034$\355\nz\026\350\026\312\211|\244\241:$d\30306E\212D\374\201\361\371#\340T(r\311\025\334\322\2366\227w\203d(\034\003jA\2012\030\3526\234\201,\305^\300\222-\004\023\024\026&q\360!\321\320\022\3578\036\321\202.1Sk\2737\350\343h\025\252\375v.\314l\330H+\024U\204V\2454.\320I\226g"
+	.ascii	"C<\265a:\233;\356y dx\240\2455\276\330s\210\265\373\325\274\r"
+	.ascii	"R=\255c\003e\253\323!0\037\274/\033}\001\264T\301\236\345\302"
+	.ascii	"\224\366\f\213N\022\035\305x\256\367\026\026n7%\346\017"
+	.text
+	.section	.gnu.lto_isModeActivationConditionConfigured.67.df401c4ddd48d912,"e",@progbits
+	.string	"(\265/\375`\256"
+	.string	"\365\n"
+	.string	"\266\225M> Q\224\016\314\\A\272\034wLA\374\360\310\327\3344\204\016\356#kA\340\304ls\366{\202mb\314\342\2240\221\354,\001\t\"\203R\334\270\200\0302\n0\203\032*\fi\204l)S\n;"
+	.string	"<"
+	.string	"8"
+	.string	"V\300@\343\3561\304\347\242\023\034L\240v#\246\242w\207\232\235\357\035\252\215\023\210\023\212\317\303\265\343\333@\002\273{\322\323\363q2\037\223\335uv\276\016wu\333\017l/\260_ \325G?t:5}+\263\250\032\r\\\354~r\340X\030U\013\021\26656\304\2162\020d\332'\361\022\232\2172\002\"\313)}`\261\033\023\330\300\365\312\361\001\254W\327\001X\257l\007N\365D\203n\240\206rw=U\220\017\374*\2414\203\2237le\344~aU\n\325\276\200!\337\271\236\364+FjD\212\306\006\365\354\350\245\206\354\303\335]+\310~\374\003\031\005B\006\214E\253\\\031ESg\222Ke\302\246E\3108,\243\200Y\250@\321\260\214\273`\222\001\336,\025\016\303l\033\207A\342\036\256\202\374Pa2\251\337Y'\335\301)\205iE\376\235\225\352\261\003\016"
+	.ascii	"P\204\366\323\206\327\304\016 4\007\334\202\346BH3\266\20090"
+	.ascii	"\030\030Y\200\n\206\252rH]\337\332R\006"
+	.text
+	.section	.gnu.lto_analyzeModeActivationConditions.68.df401c4ddd48d912,"e",@progbits
+	.string	"(\265/\375`:\004\255\033"
+	.string	"\266\361\255I\260\226Q:tPT0,N\355\263\324x\026W<e\352\215\325\007\325\261\353\336\332\006\250\263\266\0218S\373\317\024m\013!\313r\037o\020x\2409\221\274\311\375A\264o\017\":\303m\216\205\0029\3316\032!d\223-S\n\223"
+	.string	"\215"
+	.string	"\242"
+	.ascii	"\247\266\013\033v\272\357\031\3467\335\311v\236O\371S\364\252"
+	.ascii	"\312\242\302Uk\321\315\251\031\224\247\257\267\031Ok>`<\265\315"
+	.ascii	"\326r_R\375\220)CR\301Zkl\3660\201\213\276\273\\\333_%9Rq\256"
+	.ascii	"\315\357]A/\013\227\373\371K\2340\2027n\245\310\206XA\314\020"
+	.ascii	"\326\177\267-I\f<\214\216N\326\37084%\264t&W\343b\200\034\f1"
+	.ascii	"A\3247F.h\347\177\247=\266\270\3440:\372\222\030j\255^\\\316"
+	.ascii	"\350\236\271m!\2663\330b\203.a\253=\316V\343)\375u\005\273\200"
+	.ascii	"vh\330\326\334R\306\233\337\367\336N\200$\234\3153\333\343\274"
+	.ascii	"U=\240\320\374\261}\267\235H\366\r(=\001=w\3306\344\272\206\256"
+	.ascii	"i\016u\223t=\3225\245k\221\256\347\270^\272~\001\232`\025\013"
+	.ascii	"[j%\032\216\251@\252D\351P?\357k\337'r*\026\2272\200\033\230"
+	.ascii	" \013\373O\237\262avq)\323\337\030\246Zk\224\r\273\317\377E\220"
+	.ascii	"`;T\255\254Kd\221![\\\265\372 \224\001?\224\234\266[\034\253"
+	.ascii	"\266\300\267\362+\017\037pp\306S\013>\216\304\t<\256\213\203"
+	.ascii	"\317)\316\013\351n;4\2259\001\\\205\021\036\335\213\326\256H"
+	.ascii	"\234H\0161\356\244\375\256\004\255\030\333 .%\004\203\035\223"
+	.ascii	"\256\251\326\240\tQ|^JDKX\232\236\034\212\212\361t7i\307\244"
+	.ascii	"s\342\235\352Mv\346\227S\331/\316\304Gt\242Uk\245\260\344V\""
+	.ascii	"| \247\316\221\311\346\251.\222\301\001FF\220\"4\310\371\371"
+	.ascii	"\250S$\274-Ce\200v8\263\220\360p\314$:\244\216/L7\367\217\274"
+	.ascii	"\312L| \0016q\342\262\034\r\265\236\024<:\245e\017V\350\214\230"
+	.ascii	"\361\210\220\321b2\0221\024'rxb2\332\212\330\203\003\236\245"
+	.ascii	"\320\241\305zf3Z\f\346\003\372\334\341\rB \320\274\331G\2545"
+	.ascii	"\307\205\363\376\336\005pA\355\3605\221\374\372A\332L\372c\035"
+	.ascii	"\203\300\265\\\254\265\326\362\257\215\344\264\231\377\235\316"
+	.ascii	"\340e-\331\363,5\004[\032pb\343\225\022t\216Z4\312\016K\347d"
+	.ascii	"a\027\021\221\361\3464\363O]\252x\2712\2607\362K\275\267\343"
+	.ascii	"`\007\3245\325L\177\212C\207=\216f~\352%\226pI\310%4\003V\250"
+	.ascii	"18\245\220C\310\310\0043\001\315,P\322\001\220\002\031\2622\017"
+	.ascii	"\021p\275tT\213\213\365\f\201T\205X\266\311\366<\311\345[P~\006"
+	.ascii	"\360\233\304jWf;\244\317\241\223\334\272\251f\243ss\210\255\317"
+	.ascii	"\265\207\035\352\314?\026u\257*\360).`L\216\b\347%r\370\005\312"
+	.ascii	"\256\342\375\241\"\312\016&\266\301:\3506\"b\t$\263!\267\342"
+	.ascii	"\025\352\035\335\205b\033,V\245U\306%\023\304\214\336V\236\230"
+	.ascii	"x,\370\214\"\257,&]D\257\203\n@]\2668\247\322\017\017\314~J\240"
+	.ascii	"\304H\377\275\272\240\237\257`\036q\213J94\022\026o\335\200\""
+	.ascii	"\350#\355]\215F4\311\213\n"
+	.text
+	.section	.gnu.lto_updateMasksForMac.part.0.78.df401c4ddd48d912,"e",@progbits
+	.string	"(\265/\375`\266\001\255\017"
+	.string	"\346[dG\360\260(\035\330\020i/\262\022b^\360S\251\343\277~\204o4\273\261\214w\337)\256@\366\243\2043Y\2130\365\007\305\023\305\036d\336\314\266g\310\345\304d\033\314\352\r\346{\236`\267\316\213a\303\2004\262\211\334)\005I"
+	.string	"U"
+	.string	"N"
+	.string	"\034\273+4j\273\343\307\247\023t\237\036o\200\373\354^\200\373\264\257\302v\252e\321\216\361\261\304\036F\343\020\263\331]\357SI\\\274\312M\364?;"
+	.ascii	"\024\227\352\032\300\365\341\222\3007\216\310\356\272\003q\317"
+	.ascii	"\333\366\330\216`\313\217\261\373\261\224\317\3423o\3108\304"
+	.ascii	"\223zL\330Q\211,\013\305\253fJ;\304#>&\374\210@\304\370\252q"
+	.ascii	"\320]\006s\352h\207]\215\360\370\204IY\320}nX\345a/'}9u\f\330"
+	.ascii	"\023\330L\201\224\037SwAu\214\353\241e)\355\257x\213x\027\324"
+	.ascii	"\003{\302\300\247\311p\3017\361\351\243\270O\251\257\335\303"
+	.ascii	"5#E\313J\336He\261n\333\352\212}\330\257\234\264\374\370\237"
+	.ascii	"\343x\220\262\313\272\251\261*\223\346\304i\277\354\227\271\332"
+	.ascii	"\367]\274\205_\243\315\204n\315\204\035\325\270\254\006!j/\033"
+	.ascii	"\b] \322\b\311\026\302 2\371FH@\244\017\247\304\364\221\020\206"
+	.ascii	"H\234\3573R\177 \246\020\b\034Q\370J\336W\301#\211>#\357+\231"
+	.ascii	"<\220\003\006-\204J\236\t\b\226<\371\331;\231\f\030+\325\240"
+	.ascii	"\312b[\200\224\252j\213J\344Q<Ae\203\252l\217\376\002\3546+ "
+	.ascii	"\200\002\031\253\354\265\013\374\n\354\221^\001\374\013'4\023"
+	.ascii	"\023y:\302\177\270\266\263\340\260\250\347\324\026\027\274\t"
+	.ascii	" i\244\353\211\fj\fa\241t\002\270\235Aw\266\342\326zx\234\264"
+	.ascii	"\334Q\006\341\233\217\310\303]\037\253\317\370f,\021$\362A\262"
+	.ascii	"whg\301L^j\026\324^\220\234\342\351\327\3421"
+	.text
+	.section	.gnu.lto_updateMasksForStickyModes.part.0.81.df401c4ddd48d912,"e",@progbits
+	.string	"(\265/\375`j\006M'"
+	.string	"zG|\017Ep\236Q:w\253\001\031\340\202wn\n2\003\034\363\370P\360b\335t\f\036\343?\300\341v\323\f\376\330\223\341\3422\343*\243-\356\200\251\003\246\026\246Q\246\240F0\351hX4\246\362\025\354\377\222O\b\2212\311\341"
+	.string	"\331"
+	.string	"\344"
+	.ascii	"d\347"
+	.string	"\"\365-\333\307\266(\265V)\336k\241\332\325\351\262\210\211\221\201\320\374\345\225\251\2762\345\265\200\371J*e\335a\\\346\335SyX\360Ul$\021U\253%\016\263Z\225\f~n\202\364\347*\217\204\376Lo\204\376\334\375\224\335\2452np\267\316\225]\365\313>D1\266Z+\357g'y\360;]\016\227\336\320\323l\016\n\356\265\234wt\251\372\216Ig*\260s\306\347_F &R\326\222\342\327\030\2718\007\304\\\3722n1\356v\241\310\016 O\327\030\177\230Kgg\3722j\361\355j\3479)3\\#;\3728\312\305c\217\237Xl\n\035\257\314\245Z\253\356h\305m*@\226\341!t\034\232Hj\214\314\271\3329\307\221\310\\\364\240\333\205Z\353^\030\344+\364\335]\333]\021\273\250\201o\022b\221\022&\344@\334\311\355\240\233\265\326\272}dW\307;`\307\253\364,\177\322\227\277\200\2247"
+	.string	"\312\213\204\362\036\351x\215P\336\242\224\027@\312K\224\362\016\245\274B)oP\312\273Kyu)o.\345\305\245\274i\216\367\226\362\2428\336\023\307k\246\274\215\343\345+\3773\035\330\032B\326\232\025\350O\035r\2421\271\331\030)\2554\007s1\0134\253\326U\317\021b\245l\332]`\322U\307\3312\343\3754w\277\357r\265\250\243\355\323x<\206 \301j\255`\276\3100\253V\3559B\314\300\330R\216\372\027\031W\326,\032[f`l\032R/\337\262?[\335\315\366A\004\252\227\001\327\370 B\360e\300\245*e\315\242\320\245\004c\253U\331\364s-\244Zv\243\366\001<\272\220Tn\235\\>\233\316\346\202\003\350\034\273"
+	.string	"\272\250Ol\023\242\235\004\024\245\213\355\354#K\324\271\266\241\203\315\322\314\345|\250\211\036\347B=\324h\032\326\327\331B\375&\\e\3046\341\273\372\33013;\271A\235\353\256\263<s\033\356:\250;\r\013\251\244\353]\243t\260\276\206\255\353\253\375\374\342\032#\266\t\255p\235k\224\017\321\223\264q\275\214\245\347\326i\233f\210mP_\013\221\326Z'\354\333\334\215\210\035A\202_$\201\376\274u\0048h\3467\r\355F\333\201\2250\313\265,\310!\007\332>\237\355QC\244;y\266\331)\226h\254\270O\211\257i\004p\256\266&\236\006\315\215\023\347Q\240?\315V\242\303\013I%\214\273\233\001\021\333v{7\343Kk\265\222\260/s\343\267\367\262\201\376\344\376Y5~*\234:\274\37099\365Xd\250\021\325\033\372\321h1\303\207!\205\324\317\351\346\002\330\373\240\302\251w\363\365`\364\372\032"
+	.ascii	"\177*\236`\240\360A\361|+xN-z0x>( \257\201\322>\305\370A\361"
+	.ascii	"f<=A\361t7\353S2(i\204=\334\276\271K\300\003\372h\3773E\340\215"
+	.ascii	"\237\r:\t>\021\3016\240"
+	.string	"\207\212\214I\t\323ur\031I\255\265\346:\311NzTy\020\n\252\324/\262<c\200w\203R\202S\370E\245>\"\343J3\354*\034\023\007\350\244\026\320\357\335`\025\f\374\342.\021\273j\221:@\0014\261\345\332X\233\260\326Z\225vr\t\260\211B,C\2138\260\361\032+\343\3479R\347\330\003\321\243\206Z\306!\300F}\264\343\231Jk\025\276\270\267\363;\0338LM\241\035<\360\213G]a\310UW\355\356\207\323\001a\304u\002\200\201\250Q(\306\214R\306!\231\031\021ia\222\306\220\002\221\252\252:\021\260A\253\232\202\322d\332\f\266\327S|gf\020n\201{\212>\374\327!\005\202E\003\260R\253 \031$\261\314L\267d\340\217\202m1\013B#\301\021:\342\177\306$\337\215<\374f\313\271)\217'\205\262\026\237\213\350\331M\265\001\325\264\247\2610^\022\306\225Z\325\324\363\340\207\236C\241"
+	.ascii	"uk\210\311#\266\225\340)\250\256\307P\262\226\001\244o\356]e"
+	.ascii	"\275#\344O'\230\214]\374\361\314B\324\002B\227\327\277\311N*"
+	.ascii	"\207]60;x+x\325q\265\026\035\0069\256TTp\242t\231yC\211`\227"
+	.ascii	"\243d,\246\254\343L\250\224s\036BqC7\317w\n\244%<\224T\021\332"
+	.ascii	"\201\024\b(\274\211YP\002\2244\322\214s\343D\022\204\226\"#\\"
+	.ascii	"z\020\200?M\271\026i\241(p\334\353\247\344%\246\330x\033qTmn"
+	.ascii	"%\2121/\r"
+	.text
+	.section	.gnu.lto_.symbol_nodes.df401c4ddd48d912,"e",@progbits
+	.string	"(\265/\375`>\003\305\021"
+	.string	"V\233iI\360\316(\035\200-2/G\023\255 Xr;\311\224\373\231k!}\265L\206\217\254\027\270&uv1\021\261C\230ZG\265\241\245\027\331D\366\036\001\274\030\315Gx2\361\203\036\250~k\320\022\330\346\203\fD\223\326\033I\"SS"
+	.string	"Z"
+	.string	"S"
+	.ascii	"\357\351FF(W\021UH\bM\221P\256 \"\253\035\334\355\243_\022\264"
+	.ascii	"\013\t\204\"\350\223\3508\227\313\345\016t\013\371\016\024\325"
+	.ascii	",\035W\217\324\251W:S\263\326|q|\320\377]Y7\224Z\305T\313\322"
+	.ascii	"\324\360\367\037t\263\030\265\326:\366\203\272\377\030\254 Z"
+	.ascii	"\372!X\372\037V\3726V\377gk\255\177I\245\357aW%\fL\350_)(\013"
+	.ascii	"N\350\037\201\306U\363`\006%\205\3760.\230\030\227L\215\f\215"
+	.ascii	"\203\031\b\252\257\t;Y\321\0012\237\024"
+	.string	"&\375Z\247\240O\313\300\031\262)\351\317N<'X\220\364}:2\326\363B\325\001\262\017\344=E\260\004\202\f\236\037k\314\274\2175\316}\231>\006pn\252\002\212\034\361\343\214\013k\300&a\350\036\217\316\275\t\032\013\f\242\307\243\230\350\261\350\334\337h\031tJ\036olw\007w\0331z\334Z\036=&\227[\342\271A_\304K\037\310\245\037\037\231\273-VX\270!IL\242H$\007\203\265\335\260\251\375\240\004\360x\356\006\020\216\303\030\362\030;\205\\\340\364\b\231\300\314\013\271\343\354\bP\356\352\224\260\361x!\213T\354R\220\271\310\001C\026\305\226mB0\2341\3445\305\220cZ$*dQ\271\235\020lB? \240\002!\"\253\007\227\"p2K\243\336Smo\360\263\213\030a\237\215\362\216\3641\244\"@~4\226\346\246\344\226\231\270\247\024\206\341a\032\007O \354\222G\333\303\270&\202$H"
+	.ascii	"\311 \021H>A\267\263t\327\302<,\315A\317\200\325I\020\306\022"
+	.ascii	"\331\227\331\006\223.\021gk\351\221\215\360\rr\220\372qH\302"
+	.ascii	"\250\345\221mH\303@A\200\272\204\371\376\343K\036\230\013\320"
+	.ascii	"q\350\232\367\266d\322b\007\367#G\0039\373{7\362 ;\001"
+	.text
+	.section	.gnu.lto_.refs.df401c4ddd48d912,"e",@progbits
+	.string	"(\265/\375 \335\255\004"
+	.string	"RL!#\220)\031\016\377\377\377\377\377\377\377\017'\276F\304\333S\370G\370\274\355oB$im\267\266\311\336[\312\024\033\260,\340\203\004\034\240\200y%{Qv\225_,[\255\235X\243r\2636\225\005\250\033\345\tK\307ip\244\177\372\246\277\016p\206@\373\201\334\201\273a=C\177\241\257P\236\260<\202\362\216\364\253\277\364\333g\364\023\375T\216\222\031k\222\213}\240\370C\361\224V\230\2214\262\207>3{\344\366G\004\004"
+	.ascii	"\243\022\341g~yM\212\022\224/"
+	.text
+	.section	.gnu.lto_.decls.df401c4ddd48d912,"e",@progbits
+	.string	"(\265/\375`\345(\r\264"
+	.string	"\212\034\211>W JI:\351\236\027\025\341\321\314\340\275\033\316\007#\275]X\005$\023\255a7\"\357\261q43\"\305\360\336\217\327:\323\021\324x\254\032\370\030$jl\243\021\274"
+	.string	"mS\324VS\024\267E\rE\333\022\224\\\231\004\004?\006RVUj\207\021\236\005\213H\342\336R\246J\003\332\003\354\003]sm[H\323\366J\026\301\352\363\260\223>1\005a5{\300&,P\215\265\345\275f=\346;\357q\032\034%\336\263\367*\231A\3500\203\260Q\273R\202\235\366=\205\346\314\211B\233\016\037y=\334B\222:\270\266o\035f\312X\262+f,\264%\303)\227a\274\333\264\f\323\361\235\216RzoD\220\204%c\213^\210\235\273\035U9\254}/\321\363\335\230n\336+A3\r\001\263\364a\273\033\245\364\206\335\310\231\3611\366\207\222"
+	.ascii	":\327i8\231P\351\3359\231`\001\262\307\207\376,&\f1H\n\\m\347"
+	.ascii	"\322\262\013u"
+	.string	"Z\272\220\270\241\337`\215\271\350(\361\\%*.Y_q\274\245\355\013\303\361\033\3131\030N9\216\333\316]\330\3556\275\267\214\245xa.bTa\360\356M\2018\216\2470\225\032\205\211\222Q\315\3411\031\307\261\031k\251i\026Z#\251\013\336\2757D\210\236\020!B\234`Qpf8\366\234\005\345\313\034N\036v\202\2021\333M\263\007\230R\tz\306B\317?Z\350\301y\372\"\363\324\366\334\204\262\300j\234r\026\276r\256\302e\347\364\336\364\336\373\022X8M'\311s\223\340\264d\335\233~\203\037\350'Q\202\263\360\n\234V\323\254\233\004\207f\"\211F,\211\336\275iO\210\0206`Lp\374\235\366B\364*P\266\302g\234z`\264\223(\361\232\374\272^\367\246;9k\270\326\250i{\007\240g\017'\377\261\207\363\n@\357\001\312\303\034\316f\r\247\017s8y\254\373\272\200I\241\355G\240b\277"
+	.string	"\275\033s8\233\260\027\203\325\345R\363\216\335\233f\260\001\333\322\245l\313N\370\t\247\f\306_\267_\315\033vo\232S\225O\\\254\264\375\300\034N\313\032\3163\224\353\274\335\022o\364\354s\356\260\317\371\2249\234(k8Y\356g0\375\343\241\257\007M\005\001\376\0262dB\030\001|\202\277\343\376\006\300\337#\200\177{\351\f0h\002|\303\337YX\344\374mF\345t="
+	.string	"F\323\026\034nD\203\370\207\270\t0\317\317\027\320ak\333\025P\320\002h#?K\240'\320;\207\277\251~&\321\035\326\372M\356S\376\177=\202\277\203j\377\261\364\374\247`\347o\247\017\334\376\315\201\237\335Z\202\233\277\215~n\372\371\306\317\314\237u\374L\343\377\371\327\f\252t\004\315\341?\317_\235~\216\362\263\224\237\303~\376\372\371\311\317\351\317`?\213\365\206\237\253~v\362\263\327\177\235\277\032\371[\303\3376?\247\371\271\356g\270\237\275\374\314\366s\226\237\325~6\373\271\312\317c??\375l\374\371\350\347\023~f\361\263\320\317+~6\341\347\f\374\214\201\237+\360s\t?O\340g\025?\377\374\354\200\237Q\374\254\200\237\023\360\263\001~.\300\317\033\374'\341\347\n~>\177\006\376\357\373?\367\263"
+	.string	"~\366\360s"
+	.string	"\376\263\375\327\373\217\366s\207\377y?\367\374,\301\317\021\374\234\341\377\b?\357\374|\3633\372\177\315\177\277\377j\376\363\375?\363\277\314\3770\377\301\376\177\360\177\355?"
+	.ascii	"\376\376\376\376\376S\351?i\374\024"
+	.string	"\210\005j(@`\"\006\3572\257\210\3330\321\302iki\266\233\245Es\207\307P6\316pl\351\265vj\340\0160WZ\332n\270)k8o\203\003M;K7\371\2447)\001\272'-=\033%,\307\322j\fuk\234\324\223\026\223\252\245\331\366C\315\346M\013\213\354\256\254\323\312\032\315\314\254\321P0\276Zd\316\217\355\354\2156\365\204\316\256m[\261YVhH\265\355\025\216\\\331\302e\325\320[-2N\233\254\227>\315{\343\203\022<8\246\336\275P\"r\226\244\361\230\342\361\365\325c(\222El\330\372Z\220j\261\367\230\316\230\034i\240\332\366\024N;\275\260\276lI\331i\272e\276H\t3\242$\253\331\302\315\032\277\0373\300\370\212\rU\024\232\333\366\266F\232v\312{\234\336\246\016\346R\021\257}N\234\364\023\024\367\307N\323\314\214\257~r\223B\022\252%:\256su\023\276\314{\241\020"
+	.ascii	"\306\003/\347\311\027\263\252\256w\023\260\250\035p\265\rU\242"
+	.ascii	"\244\267\250\226\352\223\2323iK\336[\274\267\223\244\344\210"
+	.ascii	"\031\227\034&vq<\332\276\226\241T\235E\325I\316{9m61/\024\323"
+	.ascii	"\347o\025\336I\316\245.oI\332v\n}\005\234\362T\344H[\331\374"
+	.ascii	"\370jJ\001\322S\357 \017\322H\320\344\275\311\36461\230\025("
+	.ascii	"(\037\026[ja\260\336H>\006\347Rp\341I\214&%m\273H_Y$PXv\\\035"
+	.ascii	"\351!\266\204l.\025\222E\306\r#\334\306\31448\342\3326\221SJ"
+	.ascii	"\020\263\277\266-\244\255\252\227\226\016%V]\365#\313\333\221"
+	.ascii	"\274SM\325\025\245\266\357!\214\367\3772\241`\351j\3733\274\207"
+	.ascii	"C\343\306\225\037m_\273\320W \350\373?\257\222y\357\275a\223"
+	.ascii	"^f\022\316\331\206\331\347\317\341\312\026\334Z\302\355^%\315"
+	.ascii	"<4\211\025e\324?\3343\2717\231\341\246\227\271\f\233J.\245\274"
+	.ascii	"9eH/\020\tn"
+	.string	"X\220\273L\247\234l\363\366M/_\245)'\r,\323&s\2316\223<W\251\231\2747u\342Y\216)\223\274\f\233rZ\2065\2352\\\245\233\274aJ \250R\323i\311\326t\342Y\206)\235\226JSN\031\264\232W<jL)\273p\224\245\322\265\301$\245d\362\270-\323\346\235\273\227\307b\\\246\005\367J5\231s\312\035|\226\344f#\251L\331\344\016LIT\315\253\344\266\324j\336\253\225\324\3422q\220L\335.\021vK\006\221\272K1\356\235\200\351\336$_\267{o\362\336\013dJ\245\367\366\340Yf11\335\013\325\303t\245\222h1\356\35511gN\3130\252&\020\332\224\260\254+#Mr\326\235\233b\242a\311(w\351\336\313f\320,'\034e\332\262\327\227$_\032\266\001j\313\206\017\037|\246.Qli\303\273L\246\210\367\227\250\264\243\370LOzo\034\200\313\223\226\336eB\211"
+	.string	"N\031\213\233\242$\365\302ij2\322l\233\352\\\331 \342\003\212\343\332\016\353jiG?-\323\f\254\204\244\354\253m\347h\035\357\247\306q\373\211\203\346\275\312~\332\351\273W\271\303\f\202\031\204\355\242BB\226\205\376}\303\251k\370\311\201\265\235\3539\345\364\230\2041\233\264\3505!\323\366\335\3647S\333\3404\023\250\200,\211k\313\033j"
+	.ascii	"\275\2270TY\363C\322VC\323\020\353\031\275\344\264\311\345\327"
+	.ascii	"\311\367\362oe'\265\fn\336\253\3040\3060\361\265m\245\206\301"
+	.ascii	"i\207\216a\243Lo\312e\254\222\234\254P\020\334\313\035N\376\373"
+	.ascii	"\343\016g7\231\303y\001k8\373\002\275\223:N\\R\310\332f`\r\177"
+	.ascii	"\035\200[h(\fY\343Wo3m\253\232\327\276\264\037B\246P\340\223"
+	.ascii	"\213\312\352\201\036\007\307\23015\r\220\2554=\240\036sK\f4\257"
+	.ascii	"ir\322xy\351h[\2770\227\326\264\255x5\317\251\213\032+m+\231"
+	.ascii	"Z\206\323\257U3"
+	.ascii	"\327I\223Aem\t}\b\370kg\275\273\335\311z\230)q\256\0301\265n"
+	.ascii	"C\n@\240<\351\341@\341{sB\367ZwF\212\333\023\036s\2665\365\361"
+	.ascii	"\245\305\305\325\271S\314K\2236=tG\022\256"
+	.string	"\031\234\326\271\n\246\216\205\277\276*\247|Z\301\013\026z\fUpp\225\255\216\013\0178\206\017HT[[\365\302<i\222\030$xY\274r\344\250n\257^r\270\320\216\220\265\255]~g\321\020Q\022\203\241\t\275\226\252\245\262\361\327mb\261\344V\232O\335S\232\242\353\265W6 \r'F\234\332\326-\267\363\262\265u\345s\032S\320$\305e\251Y\232\215\n\nsaua\371\262\362\252f\245\216\235L\023\356\nmwx\027\262r<\251i[\257T,5\r\355\254if&\004\313\346\b\363\304l\373\0131\310\376JV\253\240\340\271\227\212\354\254\004\026\271e[\0358wh0\230b*\324+\025\247\025\252\216\365DI\223;||\022\330h\262l+\006T\202\221\323\302\005={\r\251VuD\350\360R\250I\226t)R\253\274\304\244UIu\302nP<Wi\005=\274\262\037\250\2465\213\323\330\r\352"
+	.ascii	"]s_uJ\225R\301*\224\032\245\206qZ\323\252\365\032\244\ny\017"
+	.ascii	"\177\325\264\032\251H\330\315J\001^av\362\232\210\355\340\261"
+	.ascii	"CnGA\322\022\305\2231x\367\246^\365\t\247\325\311{\252\223\272"
+	.ascii	"\2446a7\250\364\336\300`F\006K\205\020\035B\344\224\3712\027"
+	.ascii	"u6\351\322)K\253\314\264\255\\P;\326`8\331\342\2642A\3170ASs"
+	.ascii	";\fY\212Pu\241\277\321B\177S"
+	.string	"\245\002\032\207\347\243\r\b\372\033\037\350o\236\320z\244^q\212A\305j#~Tn\230\3203\006g\375\373c\f\316\337,\321\337\\\364\250\032\253Z\025\266%\257\255V\245\301qYJJ\203\266\017k8k\263NUe\327\331\220*@ P\244K\225\266\266\242\320kH\262\230~t\337\034\026\225(>\252\374\345\361h[\245\320\030h\030\f.\370X\001\205\250\266\257R\177\237\251Q\035\370\363K\323\366s\314\341\254<\200^{`hc\001\017J[\034\264\nz\346\342\316{M\342\264\363\352SGI\223\036\350\223\022\221\323%\317*F[\035\251\322Y\023\030I\332\036\325BoTf\305Q\2358\2559\252\215W\245\nCi\251/F\323\232,\246ZC\tNM\326\275\267\312\2509\352\262\326\320I\246\027\307\t\346\027\002\347\007\2151\247\013\366h\020\364(\023z\240\037z\240\035\372Z\343e7(\344\210zk[g"
+	.string	"\275\3228\327\354\325\030k\273\303\005\375\300\032N\rX\303i\337\1775Y\225\377\315\315\225%8)5\364\365Z\275]\361\325\316\366{\257\371o\200^L%*g\350[M\367\371\261]\231\321\366\3001\364\315\027\002: \\m{\017\215\001\344\302\340F\314\227\235\221\266\357\275\277\323\264^?\365R\024\324]\333\3431\207S\347\f\320\033M#\031[[k\233\003\314Q\246L\253\261\375\324YY!\317\316\256\361\252\250"
+	.string	"\237\020Q\023s\367\306\263{|~P\332\366\030\035\034h\326\034\351\253\013|;n\0309\233\233k:T\214\307\223\226\336\205&\237\f+1o:`\037\027\224)\035\346TAN\256\267n\372\236\264\230\334\344\260\241\347\243\355\317\033_\276\364\226\220.*|\371\312j{\0332ooulnn\335d\263\264gvxb\350Ep\267\245\335\366C\242\025B$R\212\nz\206F\244#{T\024T$\032\221\307\237\241\020\022QP\221\370c<\"\375D@D\204T,\032\025\201\03402\266@\032\025\201,\204C\"\213\034\036\213\206E'2x\032\215,\360\023D\201\021\t)\034\262\340y\213\021?G\343p\003D\243\320\004\310\340\261\204a\021\021\211\036\215\214A\304\242\323Ht\0029l\300[\214\020\"\211+~\212FEEFA\036\220\303\021\220\304\025\030,\b\036A\27482:\021\034\"\262\b"
+	.string	"\362-F\f\035\375\f\035\005\025\221\030\200\034\0361\024Y\264\3151\210\203\f\026\207\216l\212CG\265\005r\2508$:\221A\023@\303\016\020\217\366x\034\032\205\204\204\300\027GFA\326\210<\252\317yaD\036\211CC\025\036\220\034\034\203\021"
+	.string	"\221\030\026\t\213\301\r\202\306\341\021)\350\302h\305\216\320\2608D$\022\002\205\206G$\0334<\002/D\n\205\220\301\241\243\021:CD\026\301!RHtT4$\0019<\016U\f\035]p\354\300\013\"aQX\201\320\320\2104DdQ4:1\200\341\006\214\212\206F\017\025 \213\303\343\320(\201#\361\303\0036 \213HF'\212\206\310\343\213\021\202\307\013^\b\215\306\017\202\204)\204:G\241!R\270\241\303\b\037\336b\204\013\343\217\013\243\006!R\bB\220\361\034\036\2119:\305\020\216\"\030\211B\236\022pB\240\200\b$\234\370 \030\002\b\021H\021<\241\"8\202\b\0312h0\002i\024\036\215\b\022\2460\0321\340x\302Q\230b\210\024\n\035!\365<\210h\034\026\207C\35090\221\201\211\016\\"
+	.string	"\337\201\007\032x\240\301\371\016<"
+	.ascii	"\002\362\300\004\020z\023@UhH\264Bx$\202`\034n \204\343\213\023"
+	.ascii	"\202\210\310\243\004\017:\341(L\221\"\310\270\301(l\021d\221"
+	.ascii	"A\023@\310\"\021Hdd\264\200\240\r\362\030<\341(,B\022\027\340"
+	.ascii	"\302h\005\0162Hb\003\364\210$\256\260H#\022\204\206'\024\211"
+	.ascii	"D\3501H\024*\032\235(\032\021\221\302\r\020\221A\037t\030\006"
+	.ascii	"\205Dpa\264\002($\302\351b(T\024\341\204\013$\341\016\362-:\334"
+	.ascii	"\350hh\374A\032\031\031\1770\b\025\207\300cP\005\321\260X\024"
+	.ascii	"\266\b\322A\006;@\026\211H\300\243!r\004\244Q\210<\336\f\207"
+	.ascii	"\212B\243\3150\210!\2108d\364\200\233\003\001\235\370P\002\004"
+	.ascii	"\032\200\006\2158\016\205\214\212\202A\306\237 \026?E\242\260"
+	.ascii	"\350'\310x\374\031\321\223U\347\346\202p\325@bq\274\005Qb\265"
+	.ascii	"\325\300*m\226]Q5Qik\217\2645b\257n\217\374\002\323*M\355\221"
+	.ascii	"\312\266S\031\304\216\322\214\256\355\024\"\304\022\271I\336"
+	.ascii	"K'u6\344\226\210\265\362!\245\353\316Z\331\252\034(Xhk\025\216"
+	.ascii	"\213\325\030]\220\272\235\271\246\220%\252\232&\007oGSi\252\221"
+	.ascii	"\224\260\313\353\272\242\223E\203\311\216\246\205\341\006\345"
+	.ascii	"\217H[+e\245\354\017f2\223f\006\220T\007\225\303\347\267>n\177"
+	.ascii	"\364\325\005'(e\260\250\351@k\302%\r\375m\024\032\316\022\277"
+	.ascii	"\246\263\036\235\344lB\243\027\203\007\033\032g\003\353\016\312"
+	.ascii	"\313\371\227\266\274;\252\334L\201\0219c\237\352\223U\023\026"
+	.ascii	"\326t4\033\206?#y2nkX\031\026G}\343\271I\367f\361\225!\226\264"
+	.ascii	"\304\343\022\263\004\213\215[\034\2677H\224\270\032\227\315e"
+	.ascii	"Y\265\265NL\304\314\224%\323*S\250+[\323\3266e\340\203\017H_"
+	.ascii	"[\313\364;\234-hzQm\355\322\357r\312\242XIY\032\257}O\324b\300"
+	.ascii	"\265\2653x\210\r\267\267%\231#OE\314\320\343L\331{\365\333\263"
+	.ascii	"0\252\034\316M~\335&\240\025-pO\364\356\022\312\007C\224\032"
+	.ascii	"Q\274\264\275\205q\253D\242\304\355\230,\221S\266\265I\267J("
+	.ascii	".ixI\253L\"$l\253\n}\006\350\327\223\323\337\355\256e\267"
+	.string	"D\246m]s5(0zU5\257\215\n.)\203[\250\222\3114\007\343\224B\b\221\214\310H\232$\215\001R\n\020\204Bi\242G\346\035\022`\005=M*\246\220\314\310\210H\222$\331\030\003\334\235\231\250\267\316\0176\373C\226\350\365\230\031Dw\365*^}\034\377j\266D\360\305\377L\333\203\337?WX&\037\301b\f\272T\201w2\250\031#T\275\243S@h\305m\213T\250\262Wfu@\256F\037\360\327'\013\2722\262I\24003\f\224\212PUkW\375y\331\0171vo4\325\371\013\\\343\312FQ\373\333\240]\202p\264s$<\206E\354\312\361\340\375\026o>Q,\300t\345\347\034C\231\027\252\020\252\206m!\265\273P\b3\325\307?\271\024\007O\2140\316K\237+\263\354T\026\277\355\241\024\236\206\016r\320$1tp\0269\336\f\257\232\265O\330\3540\264\035\321"
+	.string	"\023\316S\263\031#\360g\013\220\201\377P8\005\b\001\265\003\372\256\t\217\t\375\251#\220el3\273D\360\250j\350\213\373\226!\367\335\306<\244\216\336\037\300\035\204\207\031\020<\342\352\361\254\350\004ox\254\"\203\204\2713\213\023]\316\032\020\343\336F\210\250\214\203\263\200i\213r\204\263`\202\021wQ\360\317OP@\365\254\347H\263\260v2DK\027\001\002\f\003Yk\327\275Gk\324\315S-(\343\214\036\001\035$P\302\326\034\217\320\335\276\253\357\353\002\036\177x_\250\302X\370~y\227Wry\3202\215\274\023\221\306t\346\215\2076\255{\306\334\215?\344\370\020\302_\005\203\n\204\311\234\034\\\305"
+	.ascii	"\262w\357D\346\013\372\030e\320\341\340\2010\262K\256\3608}+"
+	.ascii	"\213\013\361\307\241\301M5\332\304\213b_,\3605w}\307\336I\t\021"
+	.ascii	"\324\251\363oP\307\275V\223\254\210\352\004\226\256w\221\306"
+	.ascii	"\337\365\315\017oJtcz\221\026\330\3078\222*5\274\316\227:\316"
+	.ascii	"\222>\272\242z\324\"\002!xh\201\264\356\016\270\214.)\373\244"
+	.ascii	"\270\305$M\320\210\032\226PB\227\237\323\230J\313|\237\314k\340"
+	.ascii	"\t;\024\006\341)RO\006\222I(9\375\006p.C1\370\f<\nHe\202'\355"
+	.ascii	"y\341\301d\350\034V\177\302\246\345\016\023\342\023J\346{\250"
+	.ascii	"\346\361\0353\007\274 \352\003\226m\202\361\312.C\340\335\026"
+	.ascii	"[q\257\227[,3\304\267\213U6\017&\243\313Q\250\372z5\363\232i"
+	.ascii	"LktD\267\362b&,\037\356]N\244\250& s\003K\325\235\217\030s{\357"
+	.ascii	"\320\266\336\204\205\267\2431\020\037\364%\253\355%\005\350\022"
+	.ascii	" a\3679\325\306\273\203ri\351\261\361\032>\310g\3611|?\311\341"
+	.ascii	"\200e,d'Kxg\340\262E\336\271\342c\225\002\361\317A;|\200\303"
+	.ascii	"\332\025}\263\002\224\366B\210=\231C<\355q\304\253\300\202"
+	.string	"R!_\306\346\341`\266\224p\276\262\f\202\274\215\021*\325\244\250\b!V\261\223\327\b.\3548\241@\273\361\033\263\263Nw\212\367\271\224O\372\265\3445v\0010!\024\217\\\005tsUhelC#\336\035\327\217&8\205\266\254\214\306\255\314X\362T\312\230R\t\343&\202\261>t\270\023\030\311eE\004> o\265e\230\226S3S\2152\213?\027}\307O\3645r\344\002M\t\263\333E\236\275\b\254= {\340\257\304\215\223\003\004#1@I9\223\312\016XS\232/\236vO{\016\201.\f\3360\321oM\245\306\"!\"\260\3560\256\"\351Q$\256\321\352\357c&\350\fx\360?&\027?\216\377Y\33688\213\265\203\035\305\034E\026\336\305Ct\373\323Xr\217\307C9\232\251\n\260-\n\202\324,\223\235QbX$\233\247\2064\303\2206\210\001\026\363]\234y\275\222h\357\345\310!&\276"
+	.string	"4\202\370\326"
+	.string	"\023\325\242\330=~9R\002x\231\214&\245\217\220AI\rQd\216\317z\2336,\242\223\020+\252Hw\226\372u\277lFk\376\314\211\344 \177\034}\304\361\200\266\034\365|GVf\004`\212O\025\232\3765P\256\035qSMi^\251\234\357\020\357\220\221%j\240\346\037\364\346\"EL\232\353\bo\263{\346'3\001\3502\2141\237,nh\301X\227\353=\315%q"
+	.string	"nH=&^\260?\nqXJ\030\314\271{\372R|\234\222l\311M\n/\036R+\004\236\266\024\275=j\271\035<\333\203\223\242\302a\202[e\252!I\375\313\377S\366\036\241\335\204\346\n/\215J\327\317\243iT\\\326\0070\245\301p\313\233\210\333X\021\214\016\374\373K\007\231\360\254K\023F\236d\310_\263\f\260~c\001V\270\007\\\224A\331b\013/\3344\346\2721\241\246</\3068\344^V\236\351\020\036\020J\347l\321\224\211\206\314\352[\3503O\\\177Z)\037\240\036\375n\327\262>>\"\177\340\001I0]@jnp\212\027r\201\027B\342\\\331t\341C#;\f~\020%\007\353`\310S\313\221L\246l\335$\230\220Xu8\226"
+	.string	"`\246\321\240\312s&\361<\036Y\241\317\257\332s@\377\311\020\t\313\266\231\3157\327\300\206\333a\326V\317\350Z4\025\270X:|\224\235\352\346 \001\b1Q\231\332\214c;\274\027\324\330M)\"\341\370\221\230\2615\356\f\330\262\033:p\357\245\222\324G\370\347\022\335CX\236M\351\217=\337\213p\315)\336D.\367!1?\264\355\230\354\263\215~\304\221U0\347\245\261\227\306]\367\337\027]\366\273By\021\276\2275\273\241\230\006\375"
+	.ascii	"]\001\275\207\371\n\026=p\273\2002\203\374Q\341\032\276\215\245"
+	.ascii	"c\020\006,\027\347\342}\304'\227\266\327\\\263ow\001\264!\227"
+	.ascii	"\364<\246x=&\321\217\302\303\340\252\340\367b\037\260\246\017"
+	.ascii	"B\273\310\016\327\254\250\235\034\337\037X\002\361\347\371\177"
+	.ascii	"\035@\\C,X\377\362\332\220s\243\374\017\370\336\272\323\233\027"
+	.ascii	"\326\373\340\235{f\315D\350e\336\277}7\270x\0075\271p\256F\331"
+	.ascii	"X\221\017\375x:M\251]y9\322\374\013~\263\177\334i\366\016\261"
+	.ascii	"\304\372b\036\374\365\374>\006\330\204\373\223\362\0216\207\222"
+	.ascii	"\211ZZ\303\244A_\264\350\323\247\273pk<\212\r\310^\004\336u\265"
+	.ascii	"J\256S\033\270\263\252\177\225\035\0061\241\275\310\256\330N"
+	.ascii	"z\245\005\303b}\307fO\372@~\277\274l\263`\275j\233\356.z\377"
+	.ascii	"\270\376@\346\361{\356\327\236\266\300\377\r\217I&C\366\236\277"
+	.ascii	"f\177go\365\217\277^\343\254s\231[R|\354h\341\254:|\366`=?i\t"
+	.ascii	"\023\360\275\025"
+	.text
+	.section	.gnu.lto_.symtab.df401c4ddd48d912,"e",@progbits
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\001"
+	.string	""
+	.string	"rcModeActivationMask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\001"
+	.string	""
+	.string	"rcModeUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\001"
+	.string	""
+	.string	"airmodeIsEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\001"
+	.string	""
+	.string	"isRangeActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\001"
+	.string	""
+	.string	"updateMasksForMac"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\001"
+	.string	""
+	.string	"updateMasksForStickyModes"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\001"
+	.string	""
+	.string	"updateActivatedModes"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\001"
+	.string	""
+	.string	"modeActivationConditions_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\001"
+	.string	""
+	.string	"isModeActivationConditionPresent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\001"
+	.string	""
+	.string	"isModeActivationConditionLinked"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\001"
+	.string	""
+	.string	"removeModeActivationCondition"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\001"
+	.string	""
+	.string	"isModeActivationConditionConfigured"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\001"
+	.string	""
+	.string	"analyzeModeActivationConditions"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\001"
+	.string	""
+	.string	"pgResetTemplate_modeActivationConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\001"
+	.string	""
+	.string	"modeActivationConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\001"
+	.string	""
+	.string	"modeActivationConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\001"
+	.string	""
+	.string	"modeActivationConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\001"
+	.string	""
+	.string	"modeActivationConditions_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\001"
+	.string	""
+	.string	"modeActivationConditions_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\001"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\001"
+	.string	""
+	.string	"bitArraySet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\001"
+	.string	""
+	.string	"bitArrayGet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\001"
+	.string	""
+	.string	"bitArrayClr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\001"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\001"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\001"
+	.string	""
+	.string	"bitArrayXor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.df401c4ddd48d912,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
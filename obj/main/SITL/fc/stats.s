@@ -0,0 +1,515 @@
+	.file	"stats.c"
+	.section	.gnu.lto_.profile.c851fd1b8a2abf6b,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.c851fd1b8a2abf6b,"e",@progbits
+	.string	"(\265/\375 \224U\003"
+	.string	"D\005\210"
+	.string	"\n"
+	.string	"\330\331\340\372\016\002\002"
+	.string	"\002"
+	.string	"\001\352\263\360\321\b\002\272\264\263\242\004\002\002\001\002\001\004\316\305\253\235\003"
+	.string	"\005\200\202\255\250\b\006\262\374\202\245\005"
+	.string	"\007\362\354\276\360\017\006\002\b\240\342\234\212\n\n\013\366\222\265\231\t\030\002\001\002\003\003\003\002"
+	.string	"\002"
+	.string	""
+	.string	"\b"
+	.string	"z\b\222#"
+	.ascii	"\364\255\330@T\372\224f\022D\b\003,"
+	.text
+	.section	.gnu.lto_.ipa_sra.c851fd1b8a2abf6b,"e",@progbits
+	.string	"(\265/\375 6m\001"
+	.string	"\004\002*"
+	.string	"\006"
+	.string	""
+	.string	"\001"
+	.string	"\001\002\001"
+	.string	"\020"
+	.string	"\007\001"
+	.string	"\001\004"
+	.string	"\001"
+	.string	"\001\006\007\013"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"?C@\211\265\013z\003X"
+	.text
+	.section	.gnu.lto_.inline.c851fd1b8a2abf6b,"e",@progbits
+	.string	"(\265/\375`\""
+	.string	"e\004"
+	.string	"\302E\025\"\220)\351y`\212|4\036Cq\245\020-\363\345\353\235\204\020\314\314HL\006\322\372\310\220\315\311\226;\005\377c\033\253<N\202\020a( \203\361\005}\001;\2745\020\342\276i*t\341x\234t\277"
+	.string	"\205\375\357e\372\214ef^\277\f\225L\036\024\374\273\004\001\026"
+	.string	"\240\314\025\203\365\314\001=\006na\b8"
+	.string	"\005\236\250\013\274X\261\f\310\212\212\326\364Z\024\232T\205\001\300\265\225]`\371\322"
+	.ascii	",NY>\213h\005\030\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.c851fd1b8a2abf6b,"e",@progbits
+	.string	"(\265/\375 je\002"
+	.string	"\242D\016\027\260%\351\254\210%g\315aD\264j\3010\314Z\304\252\355&\233\224)\377\023\377@\216Yk\223cv\200\bX\241\255\020\267\301\326\304\240\337\205\361\327\352Z\273;\210\234.\002\006"
+	.string	"S\020"
+	.ascii	"\243\342\365\274\023\305\002\260m\003m"
+	.text
+	.section	.gnu.lto_.pureconst.c851fd1b8a2abf6b,"e",@progbits
+	.string	"(\265/\375 \027\271"
+	.string	""
+	.string	"\023"
+	.string	""
+	.string	""
+	.string	"\006"
+	.ascii	"\230\004\002\230\004\004\230\004\006\230\004\007\230\004\013"
+	.ascii	"\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.c851fd1b8a2abf6b,"e",@progbits
+	.string	"(\265/\375 \227\225\002"
+	.string	"\004\003\213"
+	.string	"\006"
+	.string	"\001\002\b\001"
+	.string	""
+	.string	""
+	.string	"\002\001\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	"\007\001\002\t\001"
+	.string	""
+	.string	"\002\002\n"
+	.string	"\001\002\n\001"
+	.string	""
+	.string	"\013\002\013\001"
+	.string	"\002\002\013"
+	.string	""
+	.string	"\r"
+	.string	"5\013\210:\006\r\005\370\211\304\253\213kV\332\305\250\031\214\245f\260\360\331\255\0010\336"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.lto.c851fd1b8a2abf6b,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_statsInit.21.c851fd1b8a2abf6b,"e",@progbits
+	.string	"(\265/\375 \312\225\005"
+	.string	"\362I&1pi\323\030H\361`\020\254\260\025P\350\226N#R\213\213\034\305\"D\030\363a\"\262\216qc\335\377\177\353K\264b\336\354\306\337\264}kVn\231\002O\221uI\227\025'K\314\\$L\234*+F\320\224\246R\305\213\242\252\370x\233\3329\016\237\200j+|\200"
+	.string	"\230\333\220\206O\323\354\275\f\352\301\347b\265{}H@\021\273\005\025\024\3739\f\t\177>c\017\021\031p<\020,L\354nT\204\304\022bg*dc\343\262\204\f\312\356\0167\316 \327\374%\377\344\337\004\b"
+	.ascii	"3\003f:\343)\334\341\232\270\nA\274\f\021.\307\242\235d"
+	.text
+	.section	.gnu.lto_writeStats.22.c851fd1b8a2abf6b,"e",@progbits
+	.string	"(\265/\375`\215"
+	.string	"\235\n"
+	.string	"fTJ@ m\225\016\320\332]\251\004`B\263\364\002x\353O`\200\340\013\246*a\313\"\321\"/\337\337\3208b\200\372\027\372\254{"
+	.string	"\300"
+	.string	"Bi\201#\235n\277\231\034\032n\375\030\273\"\177\223-eJ\0018"
+	.string	"7"
+	.string	"7"
+	.string	"\007(X\243\013#v7\323\006\337\01657\377\251Op\335\347\020Sp\205\034\253\f\"*:\021\244\220 pO=\021t\241\314\210\307\356:\271.\301}\335\366\207\355\r\373\223\316t<\352\317L?\242\245\021\006\214\r\273\244\257\304v\2704D\220\330~\332\237\360\323v\224\201[\354\2328\250v\275\016k`\277\354\235\022\177a\237\304_\336l\020\031\001\352J\214\372\3241\017\026>\210\262\345\277\022\257Q\235\243R\350\024^\201\200\377\300\005<y\356\227\357\211\277\256I\"\304\202S\t\224\237\355}R\031\330\327\357\373>\253\311\001\232\220\214\006\215\261h\235KG\3130\232,"
+	.string	"\310\005@\206\341h\231\345\302\033\001\031N\326\331l8\231\304\333\303U\223\241\204e\255@\032\202\273\273\020K{\200\226\347\254\372\271\203\326J\025\017"
+	.ascii	"3\2413h\214\254\202\203+\200j\037\244\260\210\013\300\204\253"
+	.ascii	"Q\341\031L\271\004\333\254\246\214;\034\263I\032\230\332\003"
+	.text
+	.section	.gnu.lto_writeStatsEntry.23.c851fd1b8a2abf6b,"e",@progbits
+	.string	"(\265/\375 c\375\002"
+	.string	"D\0053"
+	.string	""
+	.string	""
+	.string	"$"
+	.string	"\005\001\006\177\001"
+	.string	"\005\001\006}(\212\001\202\200\200\374\342\203\316Q{y"
+	.string	"?\202\210\200 wu\276\001s\275\001q\274\001o\273\001"
+	.string	"\013/root/repo"
+	.string	"\026./src/main/fc/stats.c"
+	.string	"\003"
+	.ascii	" D\312E\003(\002"
+	.text
+	.section	.gnu.lto_statsOnArm.24.c851fd1b8a2abf6b,"e",@progbits
+	.string	"(\265/\375`5"
+	.string	"\325\007"
+	.string	"\202\31635`m\322\001"
+	.string	"w\005\205q\206\"\031\267\365\265\270\003S\317\252\337\256\235&W5K<\026\264\004\376\267\031\323Hi\020bp1D\345\274w\\\315i\204\020)S\n\266.X\206\311\260g%<\205\ff\363\254\013{\027\001\303\005\204\353e\020^\317\302\355\247U\320\301H\327Q\217S=4\031\370H\3627\316\241\331@\250\024\310\be\342\352g\\\203\301\2670\306\241|Nu*E\221\324\311\222\247\264\033\034\362\361\032\3600\352<\272\331\334\226Ja\177\332\335\265\202\354\247\363\351W*\021\222\201\217\335\210R\312vT\310\205\355[\254\331&\347B\373\216\020\204\350dw\237V\\{j\3761\016\020?\333\263b\260\273\316\370\221\270\365\266\tl\027\330.\t\020"
+	.ascii	"3\241\315\037xg\356\3544\f\f\177\325\243\250-`!pv\324\302D\255"
+	.ascii	"*\317\365\350\202\313\313\020\340\322-\332\371\004"
+	.text
+	.section	.gnu.lto_statsOnDisarm.25.c851fd1b8a2abf6b,"e",@progbits
+	.string	"(\265/\375`_\003\225\026"
+	.string	"F(\215J\300\224Q:t\216U\201\034\020\007l+\253J\200\331\376\023Q\030\226\210\334\n\377\f\311\261\231l\027\003\242\t\355\350\337\246\365'\254\366\363\376\f\243;\r\002\216\"\222\375\227\3322\3453\251\376\356\323\215(n\274\354\023\2627\2212\311u"
+	.string	"l"
+	.string	"}"
+	.string	"\345y\357\321^4\033s8\2142|*\236j-\r|\356\200\361\323\345+\3643<"
+	.ascii	"\372y\325\322v\203\274\334\325\373\206v^@\325Z\311\036q\332E"
+	.ascii	":\303f\332\376DO\341r9\027\307\017\247\254\362\306\323\303CV"
+	.ascii	"NC\350RkU\345t\270\303\002OGH^\236{r;\341\212\317\020\356D\347"
+	.ascii	"\r9\033\263\030Sk]\306\345:|\307\357n\335]\002\273-"
+	.string	"\024\023|N:\034\265\2736w\361\032k\3259\260oq_\206\275\320\347\306n\370\270\317\375\r\375\344\206\341\001\376\360z5\016\356\2266\356\240\335\207\265\201v_\364U\tyS\232\027\245yY\315{\322\274\253\346U5\257I\363\246\232wl^\261yi\363\316\346\r\233\267\231\227Y\022T\250!,\301Z}\202J*p\"\225x\321w\317b\0379p\230\364\1777z\251\266QC\245\307N5=\022\341J\2631i\354\377@\364\304F\232\2754\035\035G\344\237Q\332b\323%\267\237\225p\243\331Xk\235A;\225[J\262I\274\024\273\320\310\247\205\347\207\357'6\275Eg\2534+\335V\3308\270aw\317\376\315\204\3550\036\243\265\027Z\027\rM\277\370\320\255x\267\306\002\037\327\375\362\017q+\002\264u\316wQO4\272\203\366E\271\0032\n\274.\230\230\254%\213\221\256\n\344\205\232\226\r\351\202\305H\230"
+	.ascii	"\373\302@\003#e\257\027\214T\225\2657\220\202\023\300Z\333D\026"
+	.ascii	"\336]\300\200\217\333\023=\006\001P\b\n\212CS\032\346srJi\001"
+	.ascii	"=\273\037\236\256\306\301\331A\307\241{\036\357\201\323@F\206"
+	.ascii	"~\212\"t@\031Ai\246\035\2546i\024\246\317\350I\263\272\005\310"
+	.ascii	"\252U}\002t\260\352\224\256\266\364\337\354\301\314\f\375T\365"
+	.ascii	"\225H\350j\020\036E\250A@\306\024cfLHA\031)H\016\300\002\021"
+	.ascii	"1\353\006\021P=clj\nm\007\263\340\235}\313\265,\025\3364r\311"
+	.ascii	"\307\272\244\256\256cq\336\260\210\264K\004XC^s\207\307W(\251"
+	.ascii	"K\356\013m\311\210O\220\344.JO.If\022\206\355\326\2706\325s\270"
+	.ascii	"~\f\354\301\231Yx\371\372'\036\217\273f\313,\007\201@\026\310"
+	.ascii	"\351U<\263lO\217\200Y\316\223\200\017\252'\212C\376\263\374\346"
+	.ascii	"$\303Z\224U\016\013\301)\260\320d\032\324\306s\235{Jvv\006\233"
+	.ascii	"\251\032"
+	.text
+	.section	.gnu.lto_writeStats.part.0.35.c851fd1b8a2abf6b,"e",@progbits
+	.string	"(\265/\375`"
+	.string	"\001\345\f"
+	.string	"\366WVB\020s\223\016\030 \321CPQ ep\300L\335E\033\233\013\302\013p\366\351\206\217F\242\307\327t\267\206vL\006Z8\363/\302\020\332\210"
+	.string	""
+	.string	"\200\002\200\002\354\317\263\301\220H\035\333xb\367\336R\246\024D"
+	.string	"?"
+	.string	"E"
+	.ascii	"/\t8\004(u\230\001dw\251C=\361\354\360i"
+	.string	"\306\314?\351!\332\3469\004\260\211\370Km\013q}\016\272\034?4[\350\211\244\244\320Nz~\330@\231\006\0363\021v\327\223\312\235\271m\t\266\033\330\277\002g\271}\027\035\237d\215\355\263t\316\241(P\017\3731\361\340\320\231\366_\034Fv\016\345\005vE;Zv9\b\207f0\035\232\273H<\234~ \036j\016\337\302v\307~9\267\262 \234\331\001&\024\242\212KH=\016I\333\312\220\327<\200\306\346\362\025\230\256Eud\373$^\257\030=B\t\343\230\266\206\ry\355\232\301\321\225:\220zRG\326\370\267*\2625\375i\301\b\002$vSb\202l\t\250CE%\025H\260\347j\004\343l8\030U\225P\027L6\026\250\352\302\250\021\004\2660\220\\\024\307\262.*\377VE~+\266\324}\024\004u$\343\276\215\3378\361QxSA\277\212\207\220G\r\026>>\031\363\004\344\373\204h\007\032"
+	.ascii	"x\013\302\2671\374\020\370T\032\324\b\245\215P\317@\342\252C"
+	.ascii	"iZ6u\274l\b\016\020\005\303\\\341\224\232\300uQ\301\365\367\264"
+	.ascii	"RT\273:Wq.0N\\\314;-M\323\024\272\327\2261"
+	.text
+	.section	.gnu.lto_statsOnDisarm.part.0.38.c851fd1b8a2abf6b,"e",@progbits
+	.string	"(\265/\375`\230\0015\016"
+	.string	"\306\327WE"
+	.string	"\2216\035\330*\261\323?+\223\276\344\331\030\245\372\337\277\307\375\250rv4;\b\217\364c\200w\013\bE\257q"
+	.string	"\nH\264x\007\353f\332\241\377\377\377\321L\255/jC/\330\356\263;l\216\244i\223\275S\n="
+	.string	"C"
+	.string	"L"
+	.string	"\273\213U~\251\2631\354\363,lw\237=;\307\253\312>,q\001\225\332]\372)G\334\273\214\225\347\277t"
+	.string	"$pt\031"
+	.string	"\344\360H\340\225Ggw}u\270\347m7\260\375\300\216\t\002'R\273\225~\272^1\307\341!\344,\2262n`\376\351+>*\354n\022\261\306\244.\370\275\344\207\365.\274\233D\256\321w\271\204+fv\353\346\323\f\256O\315\rX\237\325\013X\237\036\371\212%hCE\237~fi\037\361$\037\365gh\001!s\"GQ\246XV\257V\212\260\345\202\230\001!v5\354\320\261(s\206\211\237\036c\033\361\346\340\024\277\227\316 \235\022\f'\325\313\207\231\026\2515\251\033\273\034F\210A\020T\225\r\037)^\004\2460!\304A\210\376p6\316\303m\364#\201Z"
+	.string	"y2\372\021m\224s\300Z(\202\210r\232&\242\230\355x\377jA!C\"K\244L\261- *0\241\3340\326Y\016\223]\273$4^\003\344\223\370t\205,\236\024- p\002)X\267\001dX=/\033\2611\356a\201\023\211\306\341q\227("
+	.string	"\310\363\b[\f\303E?\034\031S\035C\233\025VIL\266\342]x\327\305K\3509\004\234(h\220\274"
+	.string	"\356>\035pmX\354\311^X]\027U<5\202\017e~a\2276X\220\241\204\262\346\255\260"
+	.ascii	"l/ \247?\375Z3\006"
+	.text
+	.section	.gnu.lto_.symbol_nodes.c851fd1b8a2abf6b,"e",@progbits
+	.string	"(\265/\375`\321"
+	.string	"\345\006"
+	.string	"R\312%,\200'\352\234s\2513\034\002\023\2301\\\030S\204D7\342\031\220\031\230\033a<\024\377\t\277\264\322Jk\334\322\032{\376\334mK\231\002_\244\0168< \034ILb\302A\232\343\251\374\276"
+	.string	"\345\217`\371SN\365 \002\242\201\371\313X\303\330\272\230a\361\242\342L\377ow\377\032\305\230N\r\211\253\215\236\r\332\340\023adj\273s8\332\027 S\303\002\313\\\360\377J\205\356\3159\347\302\322\276_\271V \370\177k)\271\204\237\177\006\003=\272\273\025\f\260\377u!\033"
+	.ascii	"@ \030\020\334B0N\242o\006\301\276A\270\f\n\324\003\200\003\200"
+	.ascii	"\003\200\203\017\370\330\023\306\303\266L\220\245\002L\325'3"
+	.ascii	"\203[\f\304\307\303\330\241\244\300\0026\3524\004\243\bE\226"
+	.ascii	"b(\314\253\240"
+	.text
+	.section	.gnu.lto_.refs.c851fd1b8a2abf6b,"e",@progbits
+	.string	"(\265/\375 [\355\001"
+	.string	"\262E\016\022\200'\35230\003s\207\320\"\372/d{'i;\245JX\007\257`\033@\n8ZL\211m\232\242\255\231\022\243\3174\t\332q\264\314\303\250*{)\262\017k\313\273Z\b"
+	.text
+	.section	.gnu.lto_.decls.c851fd1b8a2abf6b,"e",@progbits
+	.string	"(\265/\375`\307\020\025R"
+	.string	"Z\207$\036U@PBJ\007j\212\253*.\"h\241|\361\202\017\232O\247\337h!\016\326\216\376R\222\022\374l\360\26302\267\331j\355m\345"
+	.ascii	"\373<eu\251{s\266\370\024/F,&,\325O\0163\317r\302\360\3250\036"
+	.ascii	"\304\252\017F\2336\344Bq\324(;b\267L\001}\001\321\001\331\001"
+	.ascii	"mw[w\237\311\\`\270\233\231n\2552\260\356\366\214\344\027:\317"
+	.ascii	"\361\013\f\007BF\267V\026\316\222\211S\031^w\013\004\304\003"
+	.ascii	"\004\024\343\225\305%\213f\345\346\035_\0167\373\"{\020"
+	.string	"XN\302nL\375\341\267s\033#\371\fS\333\323\031;,7\326\356\372\026\354\371\307\207\303?\276G\300\372\360\216o\345\016>.\302F\230\332\303GzJ)\216M\230!ar\270\353M\260\347\265\177X\266\211\007\300\236{|\234\307=\276\263\354\253\274\223\366c\323\305\216)&\355\301i\253\242r\334\365g\264\237\307\230\214\317zM\250h\257u\267:2cr[kw\345\263\313f\334\236\317\270\354$L\374\307\324d\335-\237\255\335K\346\0207\314!b\342\276\226i\276\365\227}\313;>\226;\370~V`\305\317*8\005K`\363_\001|\206z\006p \347\2772\277%\377a\370?\307'L\234\200\377~(\321\300\317\013\220\370\257\300\177\377\r\361\377\312\377*\377\255\374\277\373\277E\210\357~\276?\217\370\177\004\370\037\304g\376\333\373\231&\350\353\177\031\370\031\350\347\237\237C\374\334\3633\001?\363\374\\\363s"
+	.ascii	"?{\370\031\200\237s~\276\371\371\367\263\314\317\374s\314\317"
+	.ascii	"\275\377_\376{\371\377\366\337\354?\336\177.\377\261\374\237"
+	.ascii	"\341\177\335\177\351\177\264\377\355\377\002\376\323\375g\363"
+	.ascii	"\362\362\362\376\233\300\337\363\371\177\310QeN3E\225\335\355"
+	.ascii	"3\247\271\266Trs\252\365lN\243O\235fjeO\2278X\246\350\263Y\027"
+	.ascii	"}\3464\247\313g\223I\353\251\303\243\352\005\305i\313\262\216"
+	.ascii	"\321\232L-\025ec\351\314\2516\333h?\351\346\265\246v\036\320"
+	.ascii	"m#\352|\262\264b7fU\212\331\266\214\n\020\305\334\2126S\265\t"
+	.ascii	"$\332\r\204y\324Q%\224m\265W\340\2522\207\215\206j\352\036\240"
+	.ascii	"\333\356\250n%w\265\273\225\335-\343\264\321v_\3454\301\242\242"
+	.ascii	"\272\241<QmC\371\326\324}\327\242\270=\233\323\255\250\320[\221"
+	.ascii	")X\307h\225\f\326O\264\234\354T\211\326P\335\315XX\260'\325\225"
+	.ascii	"\273~\221\342\003\nF\316K\221\016#J\220t\341r\207\264\020\347"
+	.ascii	"\034\302\254\345Le-\314\345\202\266\2254[WTux\355\204\212\210"
+	.ascii	"\321\301\005E\341\256[xp\276\232hq\335\365\227\213\375\255\312"
+	.ascii	"r7#\225\266\301\221\3351\r|v\243l{\212\204\331\035\3331\034W"
+	.ascii	"\327* #c\271&l\003\bf\363\002/ew|\003O\341*\264\355\031\036\214"
+	.ascii	"M\341aa+|\205\2530\225\357\330\311\031\007\246r\236\266\233\251"
+	.ascii	"\273\201\200\200\200xl\344\232\\\311A\263^\037\3560E\312\315"
+	.ascii	"\035\215\257\256\273r\024\266b\027\367t\367\204\251\f\345T~\335"
+	.ascii	" h\262\374\350\341v\327ka\033H\240\302\241\265c\3171\260?\333"
+	.ascii	"P\0037\261sC\273+\225k`'o\233\247\206Y\245\224Ae\317S\366l\306"
+	.ascii	"3\\\253\247\0373|\260\f_\245Q\233\336\262\212I\022&s5]\336\302"
+	.ascii	"\332\273\236\247$L\360\034\2531\033W\241\020\0201\253\322\200"
+	.ascii	"\222\261:\216\201\2270\035Sy\216\343\316r\f\303\327>\230\027"
+	.ascii	"\214\315\t\023(f\217\247\225\212B\327\326]Y`\341~\371\250}\227"
+	.ascii	"\205\267\252\340\245,\312W\016]P\210\202\251\356\330q\237\336"
+	.ascii	"c\352\254#`8\322\032F\304\336\266\266n\027K\013h\233\302C\200"
+	.ascii	"n\252E\205\337.\033\027\304^\310\273\353\315q\271\330\023\276"
+	.ascii	"\020q\343\272:n\252D-\233\266@\345%qz\334Z\343m\214\211"
+	.string	"Z\n)\\\034\017\264\024\"b\367\n\213\f;n\364\027G\230&+l\325\021Q\274xp\335\270q\237x\302~J\232Bn\334\3651W\354\275\272\272X\036\2028o\370\362\303\303C\214\005,>\233\361\021\266\005U\005z\246^(\203Y\245M\025\002\325)\013^7T\004[\367C\t\030&UU\f\267\266\007\314Q\325\211!\241A\203\341Vi??h'U\304b|t\323\024\255\031\324;\203sX\333~r\020\303j\305:\235\367\211\273\235t\371\214\340\340E\007\305JI\335'\266\013\230BU'\366\253\221\226e\310]\277.e\\(\031\367\311\351N\367\211Uvs\032\017V\256\013\f\326]\177\237zY\330\367f`\377\033#\006\263\261\264\247Z\254a\205\301\353^\"\002g\213\220\033^a\354=\201zO\3403n{j\250\256\025\361\036\027\333w\331\227\351\353\3466:\345l\250\363\347\277\026\246^\346c\232"
+	.string	"\341q$\f\347\375*\177\225\f\205\333\331\r\355\336\224.P\350\217/\357H3\310]\337\303b\337\223\301\376\376\276^:\273{FL\333N\346\357\034\3036\334\343\003\272W\"\332\335\243\232\205\rK\262\304\272\353\177\237\276X\267R\247\333v6\247Z\312\246Z\223\247N\3338>\3644G7[\255\347\032\355\333ms3i=Gh\266Qg\263\r\303\242\b\302\344\022\013 \3628$\201x,\032\300\247\342\246\250h\202\232\037\005\001\223\210\037|,4\340\240\205\n\0255@\002`$\217\304\n\2106H\303$\022\206\013"
+	.string	"\220\210\202H%#`\022\321\003R\n#\006\306\022\222\212+\206DF\241\213\026\026\354 \211\305\"\021)\210t\024\322 \035'0j@\223$\0321\230\261A:\n\221\304\n\214\032x\370Q\020Q\320\270t4"
+	.string	"i$,\25602\022\221\216\302\232\242\341\221\2704\302\220\203!\tB\344\217fDP\362(T\n\3229\021\36184\016\215\330\2278\301\300\211!\023d>\204b\004\212\021\276\017\241\020\022BqB\210\375\t\241^2\031D\262`\237t1L\022\217%\340\374(\bH\364B"
+	.string	"\"\343\322\212\037[$&\215\035\024\ra\b\213\303\242\0372\b\343\2304\2528\"J\n\225\220\304\"\234\244\tC\343:\\\332\300H\214\031\006\207EI,\216C\245\341P\204\337\217\214\224\002x\222\322\360\bL&%\035\2015\310\240\021\361\2051)\0052ydD,\276\350\200\f\016\221\210I\022\r\260H\301$\222X\024,\n\223I\311 "
+	.string	"\311\340P\322H\\\222\271\220P\n\237\0162\260\200%\n\002\022\275"
+	.ascii	"\032\211B$ \321\021\t\f\332)\032\026E\020\032\207AdR\230D\332"
+	.ascii	"\024\223\222(\b\306\030\351\252Na\243*\242\026\202\312\216\024"
+	.ascii	"\332\266\265j'\003\365\256m{\323fr\232y\303\223[\232tG\214\032"
+	.ascii	"YR4\366G\273d\343\351i\305\265\235\024K\204\3105\233\221Y\002"
+	.ascii	"\245\361cv\313j\274\250Vte\227l\016\314K\330\227\326\205\325"
+	.ascii	"\na\356\030\307I\340f\305\274\353}\313!8h\212\264 eM\354bQp\005"
+	.ascii	"J\307][\262\337\324\224WT\b\0305)\265-A\030\216\245R\251>\001"
+	.ascii	"\311\241\327\203\006/\312\260\257\036]\222 -\374\200\262\nYa"
+	.ascii	"\331\025\201c\250\2018\206\030D#\"\"\"\"I\222\244\003A\005\204"
+	.ascii	" ')\255\007\0210)\263h\212$IA*\303\034\264\nP%\300\bZ\220\367"
+	.ascii	"\261H\272\235\245\270\223\220\250\030\240"
+	.string	"\324d\"\343#\b\304\304\347\363\326\032\3112\302c\271B\244\334\204\234C\0078\362d\004\034J\227\336P$|]N\272\016XS\201\r\006f\031\215S\325\236\33303\253~-\376H\315>\222\ff\2212\360\bX\374\236R9\221\256!\200\237\346\036~}\237\222\345K\371r\316\317\b\267\372\27546\320b\315\366\360\3140\300\354\"\237I\235c]\321\220\bA\216\377yl\337\0310B\303)tNd\212VZ\316I\272\337&\034\372\037\f\346c\204\037EL]c\022A\230\001`\013\303\222\271\007\341}Jv:\275\310\344\234)\013|02\216\302\370\023\f\340C6\273\214\366\345\363\313\313\343\032\360\270y\300\267N\216\3141\220=\215n\262\322\215\023\273H\324#\001\344\373\0040G\264\200\212W\266\003\253"
+	.string	"\002\026\361\242\333\361u[\213\301Q\357\233l&\b\322\310}\2642\363@\005vR\306\235UF\306WA\257\342\345\006\031\200\343P\262\202\321\\a\215\341\264\020\313\257\204.\261\330\035\327\0061H\310\211\214q2p}Zf\247\323\233H*Q\256\030\027]\006;\032\214\340\365\022\025\220\006\202\304\201\207\256\330\216\226\247\324\017\204)\270\224\306\037L\360_\3171\026n$\363\354Y\224F\322U\267\346y\005\307\367\376\0136\203\231\221x \304\306\245\020]B\277\311:\t\340\244\200\022\264\307!J\200T\022\\j\225=\r\227\016\245Y\r\303\031\326\317\032&\0162\013\310\353h2+\247\3540J\273o\256s\254\277\021\005\021Fb$\217\347\002~\003\303\352\325\230"
+	.ascii	"\372\320\341\245;\374\247\210\035\200\032\f\276\001\030\001\005"
+	.ascii	"\257)\361\fp\r\206\n\034\220\227$\324&\\\f\0221\270)O_\021\305"
+	.ascii	"\"\3439\227\373vHH\340\274\001z\362\320|\007\204'+\177/Z\207"
+	.ascii	"\rLm.\347\013}\221\342\333\017\253\226\264\276\277\372\027\232"
+	.ascii	"\206\001|=\362\027\032\n\341\t\210\202\006<\321\007\220\207\365"
+	.ascii	"\030/I| \350\007x\037\371\236p3\274\237\213\237\361?\226_-\327"
+	.ascii	"\322/|\2545=\r\247$f\372o\373\235\r-8pL\265\f\266\214\241\340"
+	.ascii	"\314\251[\024W\265\033\345\263\356\0359$'B\336\311\246\312K\320"
+	.ascii	"\035\355\b|\206\363\303\\\340\032W\370\033\230\376\364\266\336"
+	.ascii	"\325C\366\372.h\302\030j\177\361\375%r\205\\\005"
+	.text
+	.section	.gnu.lto_.symtab.c851fd1b8a2abf6b,"e",@progbits
+	.string	"writeStats"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.string	"writeStatsEntry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367"
+	.string	""
+	.string	""
+	.string	"statsInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\001"
+	.string	""
+	.string	"statsOnArm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\001"
+	.string	""
+	.string	"statsOnDisarm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\001"
+	.string	""
+	.string	"GPS_distanceFlownInCm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\001"
+	.string	""
+	.string	"statsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\001"
+	.string	""
+	.string	"isConfigDirty"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\001"
+	.string	""
+	.string	"writeEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\001"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\001"
+	.string	""
+	.string	"dispatchAdd"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\001"
+	.string	""
+	.string	"dispatchEnable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\001"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.c851fd1b8a2abf6b,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
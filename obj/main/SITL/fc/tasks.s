@@ -0,0 +1,1612 @@
+	.file	"tasks.c"
+	.section	.gnu.lto_.profile.2c0afeac36faa605,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.2c0afeac36faa605,"e",@progbits
+	.string	"(\265/\375 \300=\005"
+	.string	"$\t\264"
+	.string	"\020"
+	.string	"\354\301\314\336\005"
+	.string	"\001\215\230\315\317\002\002\002"
+	.string	"\002"
+	.string	"\003\314\345\244\232\005"
+	.string	"\004\223\317\352\353\001\002\002\001\002\001\006\276\376\210\236\003"
+	.string	"\b\275\236\357\212\016"
+	.string	"\t\313\233\235\316\016\n\257\373\341\351\007"
+	.string	"\013\376\376\316\323\004"
+	.string	"\f\376\303\253\241\n\017\305\352\265q\020\202\312\321\202\003"
+	.string	"\021\316\305\360\246\003"
+	.string	"\022\357\223\257\302\013\030\002\002\002\003\002\004\002\005\002\006\002\005\002"
+	.string	"\007\002\b\002\002\t\n\002\013\002\001\002\f\031\346\300\255\206\004"
+	.string	"\032\224\341\366\346\003"
+	.string	"\007"
+	.ascii	"@\fP\306v\371\214jZU\302\322\251\0137\200\005"
+	.text
+	.section	.gnu.lto_.ipa_sra.2c0afeac36faa605,"e",@progbits
+	.string	"(\265/\375`\r"
+	.string	"\245\003"
+	.string	"\304\002\001\001"
+	.string	"\017"
+	.string	"\001\001\001\003\004"
+	.string	"\001\006\001\002\001\b\001\t"
+	.string	""
+	.string	"\n\013\f\017\020"
+	.string	"\001\021"
+	.string	"\022\001"
+	.string	"\001\001\001\031\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"# \260\0021\264\003\006\016p\022\370\336\203B\300\327\305#!x"
+	.ascii	"o&o\333\371\206\333B\005\021\312i\3008\037\002s\r\301@\260\354"
+	.ascii	"`\251\2033Y\334^\t\216\223\020\2367\214\301\311B\303\0019&\331"
+	.ascii	"A\333\n\356\006"
+	.text
+	.section	.gnu.lto_.inline.2c0afeac36faa605,"e",@progbits
+	.string	"(\265/\375`x\003\345\n"
+	.string	"\222\313(/pM\322\030\214{\225ew0\366\343\2763\317Q\016\367\361M\244\350\227\276%\025\2454H\032@\005\252\252\302\027\237dB\310\036\261\244m)e\n'\216\004\231\210\b\371\301ARR\220\240\025\031\013\005^<\260{\231\b\217\021\266@j\002T\363\364\372K\353\355.;z\314\214\315\245\302\206v\357\251\225\030\226\006\211v{\004\301lX\264\f\201px\220f"
+	.string	"?\277{\371G\332\34144x\016Tds\251@\257J'vw\262\356\036\224\224VI\241`4\236\361\323\371\205\335e\370|\244rwW\177z)\004M\250!\256\222\021\031I\323\354\006P\"R\314\254\016\022\2402a\206Cq\f\t\214\3001\301\b\311Df\264\314V\003I\244\001\035i\020\"=\277k\032\217\253G:'\253\326%\350\346'\300Z-#>-\n\266\370*U\257W\243#z\353'\315\360.\305\377\274$\315\205\253\311\200\016s\n\341\347\347,\220\021\236-f_l\006-o\210\336\274<d\216\214\221\235"
+	.ascii	"7\252\255\033\037D,Y\f#y\t\331[h\326k\214@\366\260\351\034\340"
+	.ascii	"\\I`z\255\025\r\322(\375\232\236\004\316r>\200\244\373\302M\363"
+	.ascii	"\r\347dj%\353\344\241\371\217G\262\305E.PM@\031"
+	.text
+	.section	.gnu.lto_.jmpfuncs.2c0afeac36faa605,"e",@progbits
+	.string	"(\265/\375`\351\004\035\017"
+	.string	"\206\022<5`U\223\3060\305 \016\266HK_\200?\376\247p\302&I\262h\354`[A\024B\215\031\264\214B\004\356\037\377\2006\267f\tYb\304\022\"M\222\275e\222\001+"
+	.string	")"
+	.string	"/"
+	.ascii	"\253g\202\336\260\203A\316\220\007\b\372\302Qu\006\330\243\346"
+	.ascii	"6\323\265|Y\226e\273O\356>g&tj\351\372[\232\371\3712\342\b\332"
+	.ascii	"\340\231\375LE\333_6\277\254\376fV\316\255\201`\306\334\206W"
+	.ascii	"*oV]fR)E)\316Y\325I\365%xg\277\023\323\024-\"\2215kY\357\r\261"
+	.ascii	"\352q\316u\375\260\352\025+F\361@\017t\206V1\354\201u2\371\211"
+	.ascii	"!\205\262D\"\301\256|K|\304\001\001\031Q\330^ 7;\200\325\215"
+	.ascii	"\361\241%\211\352\260"
+	.string	"x,\036\212\202@\256\030cU\275n4\r\230qk\316\251F\027\253#P\370\274\013\262,\212v\037\217\200\214\2501uERX\220T*\313\030\340\302\241\252\016\021`hiDhFd\2440I\241\320\032\342&\240\261\303\323G\210\023\213\3551\t\250\013\332\355(\001\236\202\037\220\034\353\032\353R\200\021?_7\313\310\255\021\341M\232\343\240\364\215\023\213\263\337\214 \023E;\221\"\274\344\341\344Ah\242q\301\213\257\213\243\361\332\320\305\356\022\327a\247\216\376d}\025\341\276;W\r\002\316c\226\271e\351\247|\227\343\215\336\221&\036\255\325(\214\030h\260\016B/\375'\312\243\031nZ\276\275\247\201\262X\256\024\206i\255\342\f\256\260M\253\221\273\250keT \330\200\303v\373\241f\366\310\320\324\2526g\003\034\271AW\023\2127\253\302T$\257\355\0211\013)d^`(,)g\032kr\206f\372w\233"
+	.ascii	"\237\244?~\003z\033\356\365y\306\241\373kT|"
+	.text
+	.section	.gnu.lto_.pureconst.2c0afeac36faa605,"e",@progbits
+	.string	"(\265/\375 2\221\001"
+	.string	"."
+	.string	""
+	.string	""
+	.string	"\017"
+	.ascii	"\200\004\001\230\004\003\230\004\004\230\004\006\230\004\b\230"
+	.ascii	"\004\t\230\004\n\230\004\013\230\004\f\230\004\017\230\004\020"
+	.ascii	"\230\004\021\230\004\022\230\004\031\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.2c0afeac36faa605,"e",@progbits
+	.string	"(\265/\375 \354\275\003"
+	.string	"\022E\021\035\2407\303\001\377\377\377\377\377\377\377?\363\377\377\377\377\377\223\223\232\310\211\210\254n[\246\024\256\230'\266\210\371ak\230G\333\302\2340\037\314\005S\006\346\200\355\264\005\3718\315\242$\210\207\313P)\355\3352.\002\025"
+	.string	"D\004\202  \013a\240\220\252\016p\356!X\030\211\267\200\342\272\272"
+	.ascii	"\002f!h\223\030\234\005\026\373$|\271\260\263Q\261\027d\275\001"
+	.ascii	","
+	.text
+	.section	.gnu.lto_.lto.2c0afeac36faa605,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_taskMain.129.2c0afeac36faa605,"e",@progbits
+	.string	"(\265/\375 \362\235\006"
+	.string	"\242\214.2pm\032\003\240qN[\022\345\277\271\341a\350@\301\320\317\302\215\241&\022\002\275i\304.\212\3322*\006\376\372\300JU\261~\206\320\223\337-\211\224)\005\222a\352p\026*\317\024#\004\f(\324H\007\271\251\036lx\036\316\246\363`\224OCP\352a\212\257\242\250\3700\327\335B\315H\264\211\366\372\260\226\321\272\362\377m\241\226I#\222\202\223\277\"\005\345#N\204\003\323\326\254u\207=\246?\"z\371/D!\377\205\320\003"
+	.string	"\273\214\007,v\025\013X\354:[\023_\033\2270J(@F\377_\323\3604\233\265E\276\200\254\217\231\244\360\277\fdY\270\315m\r\332&\264\265\002\b"
+	.string	"2\003&j\006.\034\200y\227"
+	.ascii	"\210\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_taskHandleSerial.130.2c0afeac36faa605,"e",@progbits
+	.string	"(\265/\375`\253"
+	.string	"-\013"
+	.string	"\206\324L@"
+	.string	"Q5\035;o\006\277=~\037)GZ\212\303\201\"k\020\323\267\375^/\213\016\215n\001\304\22061\036\343d\202\341\323E\320aUuE"
+	.string	"\315 \357\300\n\005\307N\265\364\257\337z\223-S\n9"
+	.string	";"
+	.string	"8"
+	.string	"\273\233\324p\360\023\223\n\372\021\021\364\t)\035\223$\023\252\026+\261t\211\0310\261\240\340!\216\260I\353\364\342\251\253\004Q\244\252Uv\327\032\212\244;\273\355\004\266\021\330\027\020\252\352k\226u\305\030\360\332\235\360\242\261\254\251\302\203\304\366\325>\210\207"
+	.string	"\217\202\340\215\335\013'P\354\216\007\\"
+	.string	"\362I\340\223\354\023;\200\354\323\240\r\343\343\206\325N5\"\220pm\037X\"\tz\207\320\304\222\376d\227\013T.F:\303\276\210\217\370\370\034\374\300\243\017?}O\366y\371\324?J\254\250\020\322\227=\202Tf\260\217\355\356Zb\260\217\372\003\237\005\243\311(\340l0\236\327\341:\314Q\276\006\337\205\263q\f\266M\346\242\3318\357\333(\001\3349\300x\033\247\353\274M2\356+!)\232\021\2655\235\324\0242Z\0260M\355\257\243\017\315\261\n\023"
+	.ascii	"2\003\302p\311\302Z\021h`\366\202.\240\326\005\256$J\026\\\025"
+	.ascii	"aW\322`\241\300\224K\260\304j\312\270\3137\333\223\n\263\242"
+	.ascii	"VA\001"
+	.text
+	.section	.gnu.lto_taskBatteryAlerts.131.2c0afeac36faa605,"e",@progbits
+	.string	"(\265/\375`\277"
+	.string	"\275\013"
+	.string	"\346\325PB O\234\01601\351\211\"\0018\360\260\3001Kp)o\304\007h\257\342qc\240\222a\r/<\326\210p"
+	.string	"\005\032\225\303\307\373\246\005<\377\261\232&`\023\016n|\003\b\271\2630\004}\262\367\226)\005="
+	.string	":"
+	.string	"?"
+	.string	"v\213\203\036;\351\310p\032!cw\257\210\341\333e\324\315\177\352\024\357\343.-<\312\214\b\211\030\001>\223\274\2406xO])|\235\352$\301\356Z\275\257\302=o[\201\355\003\366\021\004\366\345\356\256#\207\255j\353\037\377T\365)\225\027*2)vQ%36\234%8Xl_\355{\370\207\355\037\023L\331\275p\"d\0274\340\002\326'\201_\252Oy\001\325\247\267\216\240\351=k\200\240\b\273\310\335\203D$$\032SY\361\251[+D\2600)\211\177L\365hE\353i\243;\210\207\030\371\032,\201\244\367>}R\365\3718GLt\330(i\211\rr\032;\002Z\003\316\247\303@\004\342d\331\b\003`L\243y\264\215\350\302\034\\\240\316\346sa\231vi\0068\004\201\223]\242P(\273,\340^n\344\360\002\030a)v\017\264\312\210Eg\264=\037\005q\021\232\"'-u\023"
+	.ascii	"3\241\201(\006\210\243\\u\330\246a\254\232\023]\206\007x\023"
+	.ascii	"%\013\256\256\260\213\037\314\261(\373\n\246\\\202%VS\304]\236"
+	.ascii	"\252\311)\232\332\003"
+	.text
+	.section	.gnu.lto_taskUpdateAccelerometer.132.2c0afeac36faa605,"e",@progbits
+	.string	"(\265/\375`."
+	.string	"e\b"
+	.string	"F\020<8@o\323\001\230\265\307\21213\220\204\036U\207\263\273\377s\214q=f\266\206\354\277\210=f\024\032\335&\035\021t\325\217\361\r\2705\250A\237\212\366!\266\377\275\311\226)\005)"
+	.string	"-"
+	.string	")"
+	.string	"\227\376l\227\207\036\2339\2410L`vw\306\216\177\327\317\277\3107`It\315,\354\256\025,m\334\361\266\rl+\330F\t\366S\277Z\230\006\013\302\313n\306*fUR\005\004\263}\265\037r\324\367\224\2057\273\034+)\273a\202\0174\227\005\037\270.\255\013\\\001\352\227H|\344$\235\377q\351\320\204\036\274\004\270[\256K\2156E\205\036\264\236\254T\027Qd\207$\215'\373\326\356\256\243)\235\203\366\3614x \215\343BY\2003N\007\321u\274\231=L\220\247\363\231\031\327M\016\201\267\b\215\233\336\266q\023\013G\2676\232\314PR\215\"\311\232\t"
+	.ascii	"2\241\243/0\\(\033\025J\301\220K\260\304j\n\270\313\213v\222"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_taskUpdateRxMain.133.2c0afeac36faa605,"e",@progbits
+	.string	"(\265/\375`n"
+	.string	"\265\t"
+	.string	"\346QC=0\345(\035\300q\343\017\201\267o\3116\006l%\006\346-\270PB\177\243\034\030\313\255\311\375\243a\016\001j\020\321\2079M\342BSR8\203\006\332\201<\235,\2421\021m\237\354-S\n0"
+	.string	"4"
+	.string	"/"
+	.string	"\273;\243\311\277\313\250\237O"
+	.string	"\242.;!\2172\2415B`\003S\3223\023[\035v\365"
+	.string	"U\252\034\320\356ZY \310\255\335\266\203\355\006\333\002\0024\0135\273\037\263\002\033\323bP6\333W\373)W\371\376\322\360\300n\311\013\314n\310`\205\3165\317\0176\327\344\r6\327\374\331\001\036\236,\307\345\262b\031\020$\263\226\350\214\315c\304\n"
+	.string	"\225\312\254\251\214\366\005\206\236\365x\330\337\301!\022SE\224\035\2424\272\354\313\335]\307\226\375\327/U}\316&\023\036\204\2104z8\225D]g\301\025\230\373x\023^\35049\211Y\032\205H\223\353\274\371A\260\211B\324\315\223\311\324\315-\334\2036bJv\324\256\360\364,\307\313\002\017"
+	.ascii	"2\003\302p\036\302V\rt\205\275@5\017\274\264\356}\027\326\013"
+	.ascii	"\300r\261\226XM\021w\271\251\366h`j\017"
+	.text
+	.section	.gnu.lto_taskUpdateBaro.134.2c0afeac36faa605,"e",@progbits
+	.string	"(\265/\375`|"
+	.string	"\365\t"
+	.string	"6\223E:0\217\323\001\007\240E\232\r\007\t\252H\203&\273\234\0164\227\337\301L\225e\343\330@\277:Fx\f\257:\345a\211\013M/\203\224\022\\\377\362&e\023\3036DB\366\336)\0053"
+	.string	"4"
+	.string	"4"
+	.string	"\035\365\270\370J\247\350\337u\316H\232^7\034\247\325 v\362\362\362S\203D\325N\352c\274\3533\203<\315\251I\330]\317\221\334\270\265\333V\260\215`\333%3\231\205i( \366K\233;g\373\323~\310E\304\267,\314\331\3550y\355\226\007.\330\\#xg\273V/\260]\263h\263\274d\255f\265\202A\022\263\273\001,Y\354E]\261\235:\214\250\240\246\314\333\254/m\366\004\305\374x\nP\322\002CQ\223]\232&]\331\257\273\273\246*\373\255\277\316\351k\270\231\024\017\314n*a\003H\024b \215@ X\362\002\354yB\210\360C\352\274\207n\024\372\210:\017\f;\317\200\277\b\020\330\221\276\017\354\270r_\227\252\2740\203]\320S\345L\373\223\230\037M\037\016"
+	.ascii	"3\241\367/\306\325PU\330\013T\363\300\013\353\336na\275\270`"
+	.ascii	"\251i\221X5-Nr\314+\361\fj\017"
+	.text
+	.section	.gnu.lto_taskCalculateAltitude.135.2c0afeac36faa605,"e",@progbits
+	.string	"(\265/\375`\r"
+	.string	"e\007"
+	.string	"r\31646@o\323\001\230N\254lU\372\201\271\006a\254\356\337\037\363Dj\214d\034Q;q\202\240TP\233tD\320U#,d\\s\003\027\266\336\304\320\374\370\326\332\226)\005\332\303\025\0029l\242+\313&\254\200Z\036-B\373l\321\202\210\"\320'\024\255L\213\236\202b\022W\0267\f\313b\347\273\251CR\033@N\027\020\243T&l)*\322^S\305\343\224\001\273\366\353\022\212\264\246\376\277\220\324\332d'%\360\341\262\360\362s\314\310\374T\261\224t\332:[\233\370\204\263\311\242\234?\244e\345\377\022\212"
+	.string	"\340\312\300\004\032W\224\0074\256\312\2650\376F\276)mh\244\304\374\217\260d\316\311\325F1\307\033u\316\r\303\377\2467\352p\241\333\036\264UhK\022\b"
+	.ascii	"2\241a/\360\270\340\n\346]\002 VS\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_taskTelemetry.136.2c0afeac36faa605,"e",@progbits
+	.string	"(\265/\375`\310"
+	.string	"\255\013"
+	.string	"\226\326QA q\223\016\034\204\346\217\201\270\r\2001\241\324\037\207`\215B??,\314&\215>a\241\367\031\372\0049B\300o\300\334z\257n\320\b\024\201"
+	.string	"Hy\210BIq\f\300\027TM\257I\333{K\231R@"
+	.string	"<"
+	.string	"?"
+	.string	"%{!\341`!\005\215\335\255\224\344\331\341\323\314\374\237\034\263q\332\341\244\341/Cq\244\324W`\205\305\f\212\253\3604!!\266\237</p \231\227\004\273\353\3348\fw\274\355\006\2669\3669\001\177\273\273V\021\373&\177\314\264f\372SF\345\005\002\027\273!-5\266\004UDP\266\237\366K\334Dv\023\n\306\354zP\221\262\333\0310\201\351p\3005\361\360=@<tf\307x\027\3770\345\264\227\020m\214#\277\251:\350@R\355\356\264\277\204e%Eu\304\367\210\327\007(0H\311b\377\304Qx\370 <\241#\277\035\372\035\361\360\252\031V\220\330\360\221-v\247\245\216\330\001\030\003O\350\263`\264\341\271.\016\013\200\255\r\006\302:\243\312\202Pm|:\241\312\272\260j#\300\242\b\236\253\032\211DWEu{\025\261\202\026\245\017\005\201TF\265A\241\374\346\247\232\017\224d\214xG\271j\021"
+	.ascii	"3\003\3369\004k\250\212\355U\205^V-\r\234\321U\370\004\327`\001"
+	.ascii	"\226\213\265\304j\312\370\345!4Y\025&h\254\312\235{"
+	.text
+	.section	.gnu.lto_taskBlackbox.137.2c0afeac36faa605,"e",@progbits
+	.string	"(\265/\375`\204"
+	.string	"u\n"
+	.string	"\266\023JA \307*\035pF??Sp\"\021,\220\245\\\331\220ki\b"
+	.string	"g\301\260\006@"
+	.string	"Yb\250\353\3677\324\273\300\"D\330\003\205\304\022\264PBR&\300e\322/\002`\253\3614\314,!{\357\224\0026"
+	.string	"7"
+	.string	"5"
+	.string	"%\035-\tv\327\243\257\213\257t\212\376e\327\214$\3525\344\264:\324`\016l\310U\345\260L\306\313>=H\325\234\031\211\335\365\034\311\217\233\273\355\t\333\020\266o\001\261\277\316\351w\t\005\002D \330e\335\026,\215\2139\331\330\376\264\217\362\024\3611\016kvG\\f\273\345\203\033\f\3161\234\323\235\253W\350\316Y\264\007\274\204m\346\025\264\025E\035f\253\315(u\371\247\356\364\202E\300j\332\354\253|\345\344\223x\3034?\236\363M\335\271S\n\002@\201Hj\336\354\0225\251\313~\335\3355m\331\017\241\305'\004\252 \211> X\372\020\374u\302\214\320C\362>\fO\004\362\204\274\017\f\275\316\202G\032\037\320#\215F\240\267)\367ui\213\302"
+	.string	"-EU53+\265\303\322\374\350\203\027\002\001\r"
+	.ascii	"3\241\013h`\257\267\314\260\267\321\026\206 Qpw\007\214\272\204"
+	.ascii	"E\254F\213\273<U\223S4\265\007"
+	.text
+	.section	.gnu.lto_tasksInit.138.2c0afeac36faa605,"e",@progbits
+	.string	"(\265/\375`\356\01356"
+	.ascii	":[\260\023C`\250\325\030\253\022`[\230o5\373\2728\277\346\004"
+	.ascii	"\263\b\005@\352\204\311\204\244$\013n\301\337\n\362+"
+	.string	"e\334\007R\0352T\241\316KD~\374\355\322\236\330\260R\246\f9p\321\266m\333\266&\245L)\245#\001\022\001+\001\316\301w\006\332\234\177\357\354\2639\367Xg\036\353\254c\235s\2543\356\235o\255\263\215un\337\231]\235\327w\376wvwn($\035\255 ^i\036\316\364\305\261\366\347\245\262c\232tX\267\264\235\271[\254\307X'5\222n\t\003cpk\226\021(p;lF19}q@\030C\023\206\366\276Sc\263\274tk\226]f;=\215\276M\206\206\231\005\355}_\344{\265\333\304!\241\2410(\b\374\371z\274\235.\207\273\331Zv}w\271m\021p\315g\262\211C`M\\\310\026\241H\016\260\036\256\t\254\320\202\264\231\223\311\272\363\303|\323_\316%.\004S\342AI:\230\004h\346<\202\304\177\321\366E\277\234[\336\213j9OH\357\332\314)\004\351\313\031\304uHEr"
+	.ascii	"\351\034\020\307\375\370rf\371\315\314\351\303\326U>\272\355"
+	.ascii	"=\231\272\347\225\263\275\247\325Z|\337\367\312W\035\375\253"
+	.ascii	"\201\252\030"
+	.string	">\275\347r\035\342`\322\354\261v\033O\245\273-\302\373\276\354\315g\216f\242f\3561f\276\300\234S\023\237b\213\316Jt&\032-f\007\246\r\325\252\243~\252a\376\241\3340\332\366I\\\221\263t?\\tf\t\024\274\233\355\357\300\254\241*\331\3175x\366s\3223\314@Um\241]\277\3017 &\031e\205\376b\241K{\301\220A\203\206\266\331\365Slui\211I\211\376\337X\232y\003\207\242\377\203\345\264\271L\373\357tEE\351k\334\357\337\314@\314\035z\313\207\333\373.\027pki2\020\334J\232\345\020\"\274\233\315r\213h\233\355\227\241\365GKLZ\345k7\031T\264\352\317\217\335\375\3242\227\200\362\201Q\255>\311;gF\021\345\335d\241\332\220\264\252\362\223\314S\245?\224\271\327\367\273\230W\347\021\035\326\374\240\245\315\r\336\331\351\235\217\357l|g\003\254s\201wnzg&\326\231"
+	.string	"\316y\351\346<\200uVb\235\223Xg\244w.\262\316G\357l\304:\013x\347"
+	.ascii	"\254s\321;\003`\235\211\336\231\370\316C\356,\344\316C\326Y\370"
+	.ascii	"\316A\266\315\245\211\337^\256\250\b\375\3207\363J\350\243\240"
+	.ascii	"]\354\0301>\027\253\035~\363yz\322\305Z\363\327\335\321\303\315"
+	.ascii	"\312j\233\035\376\322Y\357\241,t\341\007\245<\027H\224\023\264"
+	.ascii	"\252\262\317\020<\215\345\254\323A'"
+	.string	"T\242\007\375\032\374\240=z\202\217{C\226\006\374\377=PHW\357\374^\247\203l\212\357\275\237\332\336\373\276\275\270[=\307=r{\337w\001\367Y\313q\211\270\\.\324\205\266\315\366\036\247GK\332.gl^t\315\016\356\330\307\267\301;z\267{$\211\273\304\273\311\373\335\230,\352\362\223\277\323\r\261\372d\253{\350\372\271\357bc\033\377\033\367Pv\233\261{q\326\330\264\3076\276\r\006\323#\276\307Z\t\311\226\232\355\327\037\361\354L\035J_\273\335tM\376{\337v\237\264\314.\0247\212wS\367\266*C\226\237\\\231\214\030X\324\366\320\3762n\270\352\264\271\337\031\221\322n\250\271\3572g\376\276o\222\355\262\306}O\316\224f3c\r\356Ql\351\271\275\356\301\337>7\006\307\025km\377\240J\243q\305\316\330\002P'\236\246T\264\3600\305\002JJ\n\006\205\030RPSSO\023\240^\300"
+	.ascii	"r\211\003/\242^<M!"
+	.string	"K\230@\262@\361\264\002YB\352\005\362\200\020\267p\001%\205\234j\321B\n\251\233V\365w\361\207>\324\252W\362\317\r|\260\300\033\240\312S\340}\311\2303\255\252lz\217\322\025\234\231\252\017U\232w\263\351\207xP\225L/$\360L\337T\200\332\245'\360NTj\376E\005\310\235\370\023\252\265\244\253T\266\315.}\024\223h\220\024*\321\221\264\231g\021W\364l\bg\364R\273r\266t?}\345\246\313\032!_\030\347\352\225\251%eq\345\031>\364\326.\263\035\360RW\316\254\334\313e:\324\215\2705l\2707n\264\315\016x\007^t\200\273\262=B\240\261\337\215\020\255\340\261\235\224\236\304M\351wey\234\376\027\224\304\nY\232`\322\277\231?;\351\273\217\003\221\376\315\262\032\351\227\312\312\212\357;\372\342z\364GeU\214\276'\340\215\216~\023\360KXP\002<\257\350\0034y\027\375\021\026\020"
+	.string	"\217#z"
+	.ascii	"\357T\304A\364\276\244\007\3256\3541M\253Z\375\332~j\311\020"
+	.ascii	"\337\227=\364\001\200\360\250\201,d\031d2\"\"IR\222Bc\260\002"
+	.ascii	"\021!\"\242\007\0200\205\212j\223\f\007U\324j\250\216\321\327"
+	.ascii	"\035\202+3\335\200\032\374\267]a{ \323\335\274\270J\203z\017"
+	.ascii	"Q\0230\002\262\310\033p\270w@5d\255\034u\371"
+	.string	"\3056\222\031lv\0019\326\033\"\347b\211\342d\237\244\275\3656\371\317\nj5<W\202\326\240\025;\177\207\004j5S\025\022\362\300\346\263\243\003\263\374x\337\262\017\356\026\027\332T\022\325\333\224\245D\312\n\216\264\353@6\246\be^\247\323m\303\330\244Z\321}\315@Q\246\314zh\343\247\254\366\232\375D\013\361\0017i\027\265\020c\202\302\nL\212\266\216\205\372\2365T\032\321\275B\306\rwt\355\340\300\266P\332\026\027\025\245\f\254%\n\035F\337\004\2214X\245\b\273z\277\364\314\344am\370\217r\226T\372\300w*\026[\316\222n|\236\\Fb/6%\210#v\n\361\201W].\344\203{\254\301]/[\341@\361i\025\253\220B\333P\344\276Bb_\373\247[`W\210j\363\240y\370s\373+\034\377\344\3424*\210!dJQ\366\354\025\371Zb\024\330\230^\364|\255\2266\214y\\\374"
+	.ascii	"\230\366*\325\343\317+HZ-\003t\\\206\2509\006tK\255qX\213\033"
+	.ascii	"9Z{\b9\367N\001\t\217\206\237\033\262c\203\274'\335YzZ\350\231"
+	.ascii	"~\356\003\325\245V\224vF\224\251[\350\353\fV$\274 \2449\314\346"
+	.ascii	"\202\"H\3717\236\243\002\210|\214\310\341\303d\206\227\237\343"
+	.ascii	"\220\342x%\376\311\247\310\177({tz\335Q\016S|\263\001\367\330"
+	.ascii	"h@\016\346\022\036\365\270\275\257\227\035\217\371\361%\277\245"
+	.ascii	"\261\264\327\233\242\263\032"
+	.text
+	.section	.gnu.lto_tasks.139.2c0afeac36faa605,"e",@progbits
+	.string	"(\265/\375`\253\006e\036"
+	.string	"\226\256\265H`\246u\003\215\314\267v\273\332\320\035\377\242\t\324\263!\305r@[\241=2\351\005\232\266\341\265+<\007\303\007u\340\362!,0&\347\237\217+\266\355v\360\2241\355\006\022\237\222\016\236\301\273\030\013\f\036\311<\373SJ\001\246"
+	.string	"\247"
+	.string	"\246"
+	.string	"\017\326{\302\374\331\245\234\351\r\013\t\364\004#&\f\020\302z3\005?{\317\t\322R\367-]\270(5\375\370\313\254;\223\002\236\303n\245\356W\262`\221\340\264\336\356\323\3575\233\307&\021\262\017"
+	.ascii	"\2132E\n\003\341\217\303\322\216M\002K\206\235I\335\2338\021"
+	.ascii	"\313A}Vl\315\324\266\215\265\373\311\205z\201[W;\330\2607\353"
+	.ascii	"\036\026\325\215H\365#\304\236\004C\021\201me<B\222A\350\270"
+	.ascii	"e\333\267\206\365>P\264\241Wy\370\254\330\231\263,\315\266\215"
+	.ascii	"\375\252\2538i\347c\267\256\326\372\320\255\253\\\r\3477\257"
+	.ascii	"843L\350W}\013\377\302\273\350Fv|\326E\224\351\263T\244\360\342"
+	.ascii	"\361\331&\321)\316\223\250\375U\224/\201e\342\367\370\261\336"
+	.ascii	"\235\253\bH\025\221\364\013\371\034\226M31\235\217=\275\b?\302"
+	.ascii	"\337\277\213\310z\367\244\362;Pn\261y\274\355\215\376C?~\375"
+	.ascii	"\"\361r\214\332S'\315N\307\372`\337gI\346\023\247\356r\346\240"
+	.ascii	"\375\260\177d\275;\264\277I\311\3544\220?l\352~\346\246\215\373"
+	.ascii	"\256w\005\336\217\240\344:6\177d \001 \255;\0325i\340\244\365"
+	.ascii	"\036\366>\016\355l\312\251d\005(\253{\0313P_R9\341T1gd\200\023"
+	.ascii	"/@M\345\250\210\304\251\234\017\357J\272\263?\351P:\225^\245"
+	.ascii	"\217u\262\356\245\177\351c:\231\036\355g\272Y_\323\337t8}\332"
+	.ascii	"\351\364;\035\217\007\341Cx\253\005\376\204G\341Wx\026\036\206"
+	.ascii	"\217\341mx\244\327\341w\370\036\336\207\357R\340\277\022\374"
+	.ascii	"\030^j[\031\217\312j?\304\213\350\227J\"\321\031\237\325\312"
+	.ascii	"\342\177l\371 D\317%\344w\255a\212\200\220\325\370H\312\344\261"
+	.ascii	"9\244\345\223\236G\177\332\370\354\re\326n\344\300\341\344\306"
+	.ascii	"g\265\2406/c\350g\324\236\306\261\2063\307\017|\327\372b\225"
+	.ascii	"\367^z\016\3168\376\322\355\356\007\304q\237\034\344\251\\~\351"
+	.ascii	"\030n\200\343;\370g\343\256\333\332\350\226\345Lr\215\307-,\277"
+	.ascii	"3\216#\271t\373\233\341\035\313_^K\307\276%Z\351\225e\240\033"
+	.ascii	"\304gZ~\343\326)(\2774\335\352\200\370\374\343\331\370<\267\277"
+	.ascii	"\236\317"
+	.string	"]\271Onu*\177w@\032\246\343\226\345A\231~{o\374\322=\374u\341\245w\347\312>X\t\376\261\234\311\247Kr\333X\307r\241Q1\252\370D\225\023R\310Y\250\237\002\200\230\250!h\213\0343J\375\311r #\021)n\003\020(\205\306\206J!\035I\007}\362O\303x\250\215^\031\205\221\303\304\025&\313\362\266M\243\252\252'C\256\232\245\005\271m-{T\340 \032T\033\247\216\032\214V\024i\350\237X(\005\342fdin\215\300vxt\033\277\335\030\357\"\n\211\370S\0130\364w\0204v\n\256v\243\263\216\221-Z\340\306\350\226\241\240h\367\200T=\177\201M\250)*\003\212\016\303\241bI\021.\330\006s\332\345\321\n\025\2267\275\262\332\276\257\004\347\252\352A\277u\373\340P\206\336\240\337\230\265o\373\340R>\31746\315\005\262\374}<\333\204\377Z\206\020\301\245\364\ni\016\202\016"
+	.ascii	"\221\325D]\016\t\001u\365\320\330\341\305W\025B\266#\320H\213"
+	.ascii	"g\237hUC\002\002\276)\016Q\356\353&\202(\007a!\350\301("
+	.text
+	.section	.gnu.lto_getTask.140.2c0afeac36faa605,"e",@progbits
+	.string	"(\265/\375`B"
+	.string	"\255\b"
+	.string	"\346P=9@\345&\035\340\245\345&\246\364\216\355\016=e\200 3E\300\247\203\345\013m\323h\026Q\363\001#\364\020\\\n!\3162<\201\304\234,\214\365\bz\025\026\315-\"\233l\231R,"
+	.string	"-"
+	.string	"+"
+	.string	"4\033("
+	.string	"\273Sz\276c=nN`=\302\220{W\317\177\312\253\221\224\313G\022]\003\034v\327\372\221J7\274\355\004\333\013\266g\002-\273\034\251"
+	.string	"\033\023aN\266;\233c[\325\376\311Q\272O\005\013\354z\220\274\354N\006#l\036=\225m\277\344&\235=\203i*Y\247[\307\264\273\r*_\271\360E\036\215\021\322\177\217~\310zT\370\257c\244){\212\024\202\330\257vw\r?\254\237\377\253\203\032\031/\020\017\240\355\342,c\237\r\264]\234\304$d\305\304E!1m\223\237\002g\026\021\232\344\262L\223\234\271\267B\317\bj\330g\361\006L\237\355\214\243\002\013"
+	.ascii	"2\003\302\260a\234\"5\246f\323>.\243&\025\355Z\305\203\273O\252"
+	.ascii	"\025\2230\311"
+	.text
+	.section	.gnu.lto_taskTelemetry.part.0.189.2c0afeac36faa605,"e",@progbits
+	.string	"(\265/\375`|"
+	.string	"\205\t"
+	.string	"f\021?8@\217\322\001\230NL\r\n\312\240q\r\231\265\3308\225GEp\213\341\324S\243!\253\342j!\242\017I\r\303\tZ\324\0314\017\253.3\207LSj\210\264vo\271S\n-"
+	.string	"-"
+	.string	"."
+	.string	"f\371'\262\031\326\307\206I\313\356\316Ke\335\273\302\350\371\207];\245LW\200T\307!\301c\246aw\235y\334\362\266\031l/\330\327\0026\204\377J\177\221\342\267)\224!\264_r\227\367\027\311\332n\310I\312\356\247pi\204\354\362\340\005\230\313\370\r\346\322~\313v\te\317\001\024\335\200K\302\253mq\001\177r"
+	.string	"J+\246\241&\250+k\214\253*\373\337\177\271I \331\345xqY\020\2512b\373\366a%[\243\271t\035\204\007\364y\030\205<\034W\261\tx\343t\022]g4\267\210\031\372t@s\343\272\3111\260h\302\303\315\221H\304M\315\343\252\312\016+1\f\315P]\331\316\002\024"
+	.string	"\031\213\021\261\002\343\202\271\212\f8l\323\360\233-\200\367"
+	.ascii	"\nW\343Em\2753\b\312ygvZ\260\231\274\323,p\355\305\224\323r\372"
+	.ascii	"\265e\f"
+	.text
+	.section	.gnu.lto_taskUpdateBaro.part.0.190.2c0afeac36faa605,"e",@progbits
+	.string	"(\265/\375`3\001\325\r"
+	.string	"\206Y\\D\020\217(\035\023bZ\272\027\211\020"
+	.string	"\374\360\031\336\235Z(\f\200\304,\3419\256\202v\342\257H\210Z\321\357\007w\214\r\002\253t\256\311\026\240\211\212\300\354C\300\022\220\207\201+\250\336\230_4B\310\336R\246\024F"
+	.string	"I"
+	.string	"F"
+	.string	"\266E'\217l\025\017Mf\206J\021\242r1\347\334.\267\344\243\307U9\362\237\372\345\003I\217\372\201\026\276\261@\253D\213"
+	.string	"\240)f\214t\370\316\272\212\200%U\214\313\214\301\234\323\332\205\033\273m\007\266\025\330\317\020~\210\253\370\254\225*\344\214)\234\340\311V\2054\322I#\001\342j!\320\216r\037E\344\247\214I\021=\364\310h0piU\373\037\016b\364\320\303\22799\214X\2313<pi\002\332e\346\031\330e\274"
+	.string	"\354\022sy\017\001''B^|\350\313\373\233\270Z+\273(\333!\354;"
+	.string	"\303\n\025\024&u9S\333\353\320\177\337\263\376\022\021\026,\245%\351\242\274\362q.\211\035\325\372\325\375\fcA\313\234#\257\226\271A\2328\371\352O\271\332\017\234\2073!\202\206kP\201\363`<\b\\\207\363"
+	.string	"\344\341\272\256c\003\300\233\r\217\303\323\200\266\215\204\315\303\321t\266M\347m\033\032\376P\340\272\r\364\371t\233>\316%I]\023\361b\371\330R\304\250\256\30690\273\363\321\177\316\200,\311_\335\004\001\035"
+	.ascii	"Q\013B\272\00171\356\ft/\365\312\214\306\022@\036\030\341\212"
+	.ascii	"Q\217\025\n\030\002\344\003\031G\201 \253\211\3110\274E\243\024"
+	.ascii	"\326\005\242 \230{\206.\352\234N\013m\246\3544\020\\{1\305\241"
+	.ascii	"\251q\357*c"
+	.text
+	.section	.gnu.lto_taskHandleSerial.part.0.191.2c0afeac36faa605,"e",@progbits
+	.string	"(\265/\375`\031\001%\r"
+	.string	"\346XXC \217\232\016pH/\004\004\244B\241?a@\337\356A\f\301B\017\350\031G<\320\003p\016@\326\264\026\232\214\004+\032\006\365&\021\204p`\240\025\026\b\034\017\332q\004\207<\006\324\272F[\262\267\224)\005A"
+	.string	"J"
+	.string	"@"
+	.ascii	"\273_\202G\037\240\036\253\023\230\036\341\007L\217\233\307\237"
+	.ascii	"\260\375A\261g\307"
+	.string	"\370\027b5\037fD$\231\335\265\036\025\304\275kB\317\007]\003\\\300\360\3348\324|\354\256\251\fw\274m\005\266\031\330\327\020\376\264\301\261a\367\2444c;D\030#\376\362\267<\355\333O\361\361Y\234\344\315\2139\036\237\273\220\030\305\346xxw!\251@\337\236pXd\240\220Y@=\266|\376\225T\034\020<:\323\276\212\257\360\376\225\030\300\256\207\230\027\001#U\033\304\223\037\271\262\240 \247*\007KI4\363\033\230\256\251NQ\212I\226\354\267\270\013\315\027a\n\\~\364\350s\323\343\365\244\303\022$bL\244\204\262\224\272b\205\207\253*vL+L'\314Ww5\020\341\034d\33552\341\252\220ip\0202O\347A\027\222m\333\b&\300X\007\007\302]\235\205E\260B:\227\307\3026\316\352(`M$\333\254N\3236kc;\257*\376\b\251\211\352\212m\215<\f\226\035FB\207\332\r=\033"
+	.string	"8g\340W\357\201$Z\306a\025\272\262\n\020\020\005\303\\\341hc\305\346*\244\316\023\257\f"
+	.string	"-\f\365\224\302b@\036\b\341\236Q\212:\247\323B\233);\r"
+	.ascii	"\327\036p\243E\364\273\312\030"
+	.text
+	.section	.gnu.lto_taskUpdateRxMain.part.0.192.2c0afeac36faa605,"e",@progbits
+	.string	"(\265/\375`z"
+	.string	"E\t"
+	.string	"6\020<90\345(\035\2003\226\201\213\016`_\200\2339\314\362\030\251\317\333"
+	.string	"\255D\206\035\037\311\036P\023\200`\233<\204\350\201\341ai\013\030\036\356\321U\211\315#X\264\375\275\345N))"
+	.string	"+"
+	.string	","
+	.string	"\266\313?\220\315\240V\025(/\273;/\365\343\336\025F\317/]7\031\032\207\234\307\314gw\255\331\270\345m'\330V\260o\005\251\356\037\251\303qpi\b\355\233\374\304\373Gr\300\256G\212\312\356\207pi\003\315e\347\004\230\313\370\001\314\245uy\022\333\035\206\275\366f\215HhKL\300[\370\252oV\"-&-AEY\343\343\352\311\216\234\005\226\335\213"
+	.string	""
+	.string	"\266C\256\204<u\373%\235\257\262\025[\003&\n1p#L\323\".\001_\236\355a\003q\363r\230\243\020H4/m\233\236\002g\020\2306\271,\323\246e\033^O\376P\250I\025\025\027"
+	.ascii	"8g\340\256\266\212\024\034\243\331\032\234\342\002\362\300\b"
+	.ascii	"W\214Q\023L\017\224B\\p\n\214\271\247\351\242\332\351\\\320\246"
+	.ascii	"\313\316\005\200\023\017\344hi\372\te\f"
+	.text
+	.section	.gnu.lto_.symbol_nodes.2c0afeac36faa605,"e",@progbits
+	.string	"(\265/\375`\344\007E\026"
+	.string	"\006b|G\240\330M:"
+	.string	"\016_[\027q"
+	.string	",x\225?\236\27600\354\310\374@\277\nC<\232\237\270\272?\301\236D\022^\207W\215(\327r\255\017\\\353C&\023\215\364\243e\334A\243\243X\361\031\312\373\252\177\303\324\254\225$\355f"
+	.string	"e"
+	.string	"l"
+	.string	"\346q\344!5#\013\251\211\241X\321m\245\340\206At\223\201\274[\004\003\334V<\347\004C\262pN\2363\234\273\212\207n-\273;F\202;\213\320=#\024\3050,\350\036\323\031K\r\350\256?\206RCp\277"
+	.ascii	"\017\3342\006\370xI\315\300M\303\026\212\"\031\330\234\237\223"
+	.ascii	"\313\225ia\030\206\005\356*p\316y+\013#\3560\021\367\224\020"
+	.ascii	"7\025\020\367\216\017w\016\017\367\223\016\267\016\016\267\223"
+	.ascii	"\rw\023\r\367\225\fw\024\f\267\224\013\367\227\205\333+\254p"
+	.ascii	"3\241p+\231p\377$\334I\"\334H \334G\036\334\343\323\335\345\340"
+	.ascii	"\346jpo1\270\265\026\334F\354tg\271\351.\342Z\305\344\032K\267"
+	.ascii	"\rP\311D\222\f\244g\037H\001\033\325\243\333\343D\315\266\316"
+	.ascii	"\266\350n\220n\214tG\272\265h\320K\0310Z69/\253\254\262\242\334"
+	.ascii	"\272\332\254\017WCT\263=C8\036n\315\345\24321_7\232\035\215\320"
+	.ascii	"m\237nA\2665I[\217?\264u\005\242m\317n\224\3753\033\323\305\307"
+	.ascii	"\353\273o\254\270\257T\334=R\334?P\334AN\334X&n\034%n0\022\267"
+	.ascii	"X\323E\245\"\223\350R\215TU\211n\213r\212\264N\327/\f\217\356"
+	.ascii	"T5\001\254.2<\272,F\251R\212\204*\351B\215P\325G\372\306\222"
+	.ascii	"\207\344\251;\272;\345\316\270Dw\247"
+	.string	"\352\224:<\272\002\310\036\335\0342gd\242\233SK\262G\027g\004@\3222W\322\315\325\224\236_\306\300~;\2728r\206\244;S\233\350\332J\227<\032\200\203\2501\024\f\351rII\2621\006 \003\021\242\325\030\021P\024H1\212\210\200\204\022C\364\001\017T\300(}\230\332\311\302\200\250\013\314\2074B\345b\035\3305\331\232\200\356E\326\001\223P\230\fm\257\370\307m\375\254\300vp\351v\240\201\252\334\212s\201\2043\243?\002\204Z\246\353\261**\216\274\210O\023\364\037\345!\340IZKv\320\303R,k7\256%K\343t\310/\301\237\310\\%\233\2765\357\315\272\235\365\231u\263\3536\353\356\334\030\252\242\"U\226\277\272\361~\310r\333\020c7\001\331fo]\244g\376dHx\002$\366\273\023\003\2345\020dH?\376[\2440\026c<\312\003\367\352\r\256\347%\244\311t\037\230\230;\246\337"
+	.ascii	"\035;\267X\025"
+	.text
+	.section	.gnu.lto_.refs.2c0afeac36faa605,"e",@progbits
+	.string	"(\265/\375 \231\335\003"
+	.ascii	"\322\310\033%\200\305i\flFb$\255&h\202&hn\230f-b\343\213\177"
+	.ascii	"\340\023\366\333n\037\213\217C4\202\233$\231\002\336\325\002"
+	.ascii	"7/\037\016\230z\rp\345\351g\305\224'3K\216\f\331\037K\221'\355"
+	.ascii	"8=h\250\006\f%\210t \322\252)\325tj\332\230BL\037\246\006\246"
+	.ascii	"\013r\341<\347J\354B\354,\315y\205\231\363\b\256\363\366N-\b"
+	.ascii	"\003\004\0017\021\300\324\034\003"
+	.text
+	.section	.gnu.lto_.decls.2c0afeac36faa605,"e",@progbits
+	.ascii	"(\265/\375`\321n\315\322\001\332\363\212\247T \fQ:\035\224\322"
+	.ascii	"\360\203\320\216S<,\216c\326ex\333\325\255\034\"\210\347T\217"
+	.ascii	"\0314o\326\211\374\235Z\313.PC\277k8\202\003\007[\333\226\202"
+	.ascii	"\340g7\365\372\320<\352\364z92\317\207\247\311S\025\264\344D"
+	.ascii	"\n\325\300\324\"\341#r\313-\245\224)y\t\206\n\254\n\237c\205"
+	.ascii	"\177\016\024\3769t]\262\227\034\270\254\"fX\177\316[\227\034"
+	.ascii	"5\3769g\3742/\317\356\271;\373s\306\370\347|\361\317\311\342"
+	.ascii	"Vr_\335\031&\032X\177^\256\322\243\tR\017\254?\347\006\377\034"
+	.ascii	"\027\374\235wg\343\251\034\345\246SxlwX?\316\031\276\357\316"
+	.ascii	"\316O\262\336mn\310Pz\316\375\363R\222\302\372q\306p\022\364"
+	.ascii	"~7\354;8x7\354\307\321\302o\277;;\257'\207*\007\\\023\326\217"
+	.ascii	"\263\204?\bH\262\\fS\362fW\020g\276\313x\267\231\227d%qK\362"
+	.ascii	"\\\266\273|q=\211\252\003`\0301b=\037n\232O34\266\246\313u91"
+	.ascii	"\200\270\360\201\365\343\314\240"
+	.string	"\303\201\301\377\006\260\231\223\340\251\267\257-\315*\374o\350\336\362\221\333\027(\370\202\371&\204\263e#\2319\367\244\n\326\177\343\305vc\305\357\315\024\377\233%\3766d\370\333X\341=\227g\277\r\036\317C4\215\275\255 X\277\215\034\177\233\"\334\303\345\331y,\207/\b\2239\254\337\006,\213e\201]\262\026kdX\277\r\024\377\377\f\3446s\220\374\225\203d\037\371\307\345\213\353]\252\2033\2515&\317\336{\317\207\213\003\212\322\024\255\363\217\307v\302\272-SeX\177M\030\3765{\374k\346\370\305R\343_S\306o\230\227g_'wgk\271\273\263o\335\335\331_\323\203_`^\236\215\275\356\316\306|\331*\343\210c\3325a}\203\n\031\216&X\177\215\216l#Wm\"`\224\224X\177\315\f\3765My\006\230\266\034Q\260\376\n\317,#Si$6\274\264\036\3603\025Z\205,H\023\353\257"
+	.ascii	"\206\243J=\376\025\3448ZA\b\337\312\273\263al\020\342\251\311"
+	.ascii	"\215a\375\025\262\370\203\220]\3403y\351\362\305i\275)\316\354"
+	.ascii	"\"3a-8OHbW\317\246\374\3426\263\213\334bC6\003\247C\313\326/"
+	.ascii	"\004\344/\244\302\263R\005\256\247\261(X\277\320\216\377\355"
+	.ascii	"\222;\036|:']r\307h\270\344\244\214t\233\271\3434\217\231\260"
+	.ascii	"\231\017\037z\366\213-Uh\266~!\035\177\341\032\177\341\031\177"
+	.ascii	"\341\027\277\375\362\354\027\342\340\033\353\356\354\027\272"
+	.ascii	"\340\317\005y\252\274;\033\217!\253\203\222\005\353\347W\370"
+	.ascii	"\337&\026\363\227\377\266\210\341\013\363\370\357?\204\b\377"
+	.ascii	"\305\246\367\264\336;\207\033\2573-[\260\306\\\260\363\377\205"
+	.ascii	"\371\313\033\024-N0y\207\224\027\031\254\277\3442IJO\254\237"
+	.ascii	";ib/\270\013\263\367N\026\3674\205\365\363$\374\001\177\356\377"
+	.ascii	"\205<\214\311\013!X?\037\302y\277;;\013\217\253\036M\260~\316"
+	.ascii	"\203'51\363\244\314\222\311\231\037\275\347\362nI\032\214\227"
+	.ascii	"\207f\031\005\333\341,\351\364\256\325\264\304st\330\016G\330"
+	.ascii	"{\322\340\262\367\376\377\230\017O\301U0\025l\005c\301{\370\n"
+	.ascii	"\356\273M,\005Cy\234\004\313a)\330\t\266\303Ybv\244\rfG\326\362"
+	.ascii	"\331{\3272\254\234ia\320\317[\360O\377\370\247`\370\247]\370"
+	.ascii	"\247[\370\247X\370\247}\374S>\376\301\036\177f\335c\273\247\303"
+	.ascii	"S\302\\=\261\276J~\036\327\345:&Lg\260\376T\217\177\235\022\276"
+	.ascii	"\371.\317\376.wgs\245\032\377t\214\177\272\305\271\363\356\354"
+	.ascii	"Oc\360\337\201l\330HZ&\206\025*X\377\226\302\266\353\370\357"
+	.ascii	"6\376\373\214\377\006\343\277\257\270\260\023\361pS\006\213\222"
+	.ascii	"\331\031\215\177l\306\205sF\344\210\233\216{\207\203\366\216"
+	.ascii	"\245e\371\223\343\336]>/\006\244\3719\177l`\034\314?\345\023"
+	.ascii	"3=\26559q\013\027u\230I\006]\377S>\223\226\256\334\017\337\237"
+	.ascii	"\322\314\n\001D\270`&\314\205g\340*\234%f\227\302Q\342\324\203"
+	.ascii	"\272r8\271\367\2534\270\351\005\363O\371\304STw\355\362U\365"
+	.ascii	"\ff\371\2474\303J\251\273\266\301\230\177\312'V\022'\206\361"
+	.ascii	"\217\231b\304\350\342t\345._UG\n\023B\030\326\237\362\271\367"
+	.ascii	"\377\203\271\360\325\275\303Ibve\252D\371\377x\013\207\3411\f"
+	.ascii	"\004\367\300^\230\f\007\301<\260\017\374\003\213a0\\\206\227"
+	.ascii	"X\b\356\302C\360\327mb.\274\343q\026\326\022\341\037')Ea\246"
+	.ascii	"\377\020\"`.\034u\345p\220\230=*\005\253\373S>{g~\350\371\360"
+	.ascii	"\301\006\007\221&b<h\214uyv\207\273\263\037u\362G\367\370\243"
+	.ascii	"M\376\350\030\177\324\006\1774F\3077n\370jlib\375:\220\277\356"
+	.ascii	"\3035\356\323\230-!X\277\236\34344\032\177\355\203\277\316\301"
+	.ascii	"?\270<\373u\023\037\201\013\377\034\205\177\216\343\237\305\370"
+	.ascii	"\347\034\374\265\\\236\3759\212\277\363\311u\356\316\376\347"
+	.ascii	"\345\331\217\371\370c:~\001F\302\035m\323#\222\2045\356\317\274"
+	.ascii	"\311I4\366\350\006\323\340\245\25467\254\377\377\232\271h\356"
+	.ascii	"\231\333\274i\356\363o\231+\b\302Ms\347\356]f\326q\027oMi.\336"
+	.ascii	"%\223\331\224\022P\032t\272\375\337\2674\367\310\326\013\347"
+	.ascii	"M\177\201\305\307\365\306\272<\373\255\334\235\375\230\311\377"
+	.ascii	"/\223\277d\376\357\333]r\0031\226\006\233#{U"
+	.string	"\302`\r\330Sc\345\312\313\020\254\037\003\341\377\177\377n\230\013\346~\271b\256\3636\357\230\353\367\227\313\355\362\232\331\373\322\336\224k\205N\t\214\263\367\376\267\211\0273N\236\244pZ\202 \374\377\3341\367\312\335\222\331\224\034\256\355\213S\017\312\225\303A\322\351J}e\226\2753\377\246\375\377\374\207\020\341\216\271Q\256\\f.\273R\237\235\002\226\230\334\215={g\366|\250\001\323\225\243\t\216\376\033\206?\337\345\3316wg\377\225\302/\226\233\3456=\\-\302%fw\353\235\231#\304\"&G\034\326\177\363\370_\017;\307\303\376\033w\373\256\033\\\0173X\377\r\343\227\357R\271\315[\345\377J\271{\257\215`u\267\336\373M\315V]\\\022\326F\367\363v:888x?o\377\345\342\372\356\354\013\256\f\3767\211\177\334\345\331\277\202\177\335\345\331\357\344\362\354\233\367\363\227\311\316VV1{\\\357=\007"
+	.string	"J\362\354\260N\357\316\376!\337\375\362\354Kw\353ns\203k\367W\311u{4\211\331\231\2753s\260\0174H\332\260~\013\360\277\033\354<8x7\330\317"
+	.ascii	"\216\357\316\276p7\3566+\270I>\204\b\237\221\214\344\334\244"
+	.ascii	"9Kc\006\353\037\201\377E\362\032\252t\021~\003\377[\301\276\203"
+	.ascii	"\267\202\375\234?\337\335\331:\227g\377\337\266\r\370\322\222"
+	.ascii	"$iF*\310a\322x\342\201\365\377e\373\277h7\355\256\345&'\254\036"
+	.ascii	"\327;\323B\212\306D+\016\353\273\206o\221\313\374\273v\325>\204"
+	.ascii	"\bo\263\324\323zg\3365\335{\322\275\030\340\334\213\001\232\007"
+	.ascii	"$\251m\353\307\374\231\227g\363\273\263\377\265\022R\306\260"
+	.ascii	"\267\366\257E\240?\220\271\350\264\321\377s\320\323\371O\313"
+	.ascii	"r\f\275\316\375?\n\030\226\370\370\327\b8\302\001\272\035\035"
+	.ascii	"h%\377\277\201\226\373\377\364?\345\362\257;\310L\020\262\\\222"
+	.ascii	"\177\335\374\327\006\320H\376u\334\177vr\344\355_\273\031\371"
+	.ascii	"\327lZ"
+	.string	"\355_\247\241\375k\"g\377\332\354?/\321e\377\232L\223"
+	.ascii	"\200\177\035\200\177=\301\277\246\340_W\360\2573\370\327\034"
+	.ascii	"\374\353\260\177\275\374\327<\377\372\302\1776\362!\374\363\r"
+	.ascii	"H\001\371\317\024\370\327?\3763\021\355\343?\217"
+	.string	"\320_\231\353\036X\356\037/\371\317d\332\353~\370\277\034\374_\037\r\325\365\177C\320\\\377\332\003[\377\177F\363\370\3271\376s\f\255\377;u\251n.\317\017\376?\n\377\257\301\177\026{\022\376\323\266\377\274v\363\374?m\221\353t\212\377\334\224\3656\377\251\216\0232\206G\377\323\247\377\214\247w\374\353\343\377k\301\372\n\377i\327\177\226\242u\374k\246\253\377/\262\207\366\2575\220\343?cx\341\177j#\257\335\240\370$\332\352\3779\374g\f\177\363\237J\375\347'\032\307\377\235\272T\317\304\3605\377i\330\177\306\360\370?E\372\3277\376u\325\277\246\361\257e\374\353\251\177\035\365\257\235\376\265\213\177\255\364\257\221\376u\t\376\365\b\3765\362_\257\370\327*\3765\361_\017\3775\007\376\365\006\3765\212\177M\201\177=\201\177}\302\277\216\300\277.\341_\223\360\257\035\360\257G\374k\021\377z\001\377:\001\377\332"
+	.string	"\377\272"
+	.string	"\377Z\204\177\r\302\277\376\371\327 \376\265\007\377\031\360?{\371\317\\\376\363\226\377\234\345?_\371\317}\377\231\312\177\336\373\317S\376\263\223\377\254\367\237\227\374\347\274\377L\367\237\353\376\263\334\177n\376\347\270\377|\344?\273\375g#\377\231\371\237\211\374g\021\376\263\331\377\333\375g!\377\231\354?\213\375\347\260\377\274\374\317`\377\031\310\177\376\361\377E\376\363\327\177\346\372\317[\377\257\345?\307\370\317M\377\331\305\177\016\301\177f\372\317K\377\031\303\377o\360\237O\374\347\022\377\031\347?\333\374\343&\377\327"
+	.ascii	"\377w\204\377[\200\377\373\377\237\346\377\215\374?\333\3773"
+	.ascii	"\377\237\370\377P\376\337\302\340\340\340\340\377\266\371\327"
+	.ascii	"0\345\237\002L\002>x\020\301:\337\235\375\034\240\370s`\342\377"
+	.ascii	"{\311\236\263\221\032SE+\237A\263l\"\031\314e{n\3075\321\355"
+	.ascii	"\272m\267\357\266\222\333\334s[\356\361\236\333ItT\333\232\225"
+	.ascii	"Y\357\314KC\210\016*6\372)\310\343O\201\022\376\024\030\341O"
+	.ascii	"\201\032\177\n\310\370\377\206cc\263\003\343\303\372g\263m1\035"
+	.ascii	"7\266\326\227\223l\013\311\341\304\223\332S#0)\205.\256\374p"
+	.ascii	"Rm\033[>\324v\3336\262\337\366\332.\262\217\354\264\355\266\231"
+	.ascii	"\267\271\3316\216\307w\033m\263\355!\233\310\233\225\223\307"
+	.ascii	"\376z\353\261\364\261\303Zx9\331\266\362\275\214\300\244\024"
+	.ascii	"2]\001\262\331\366\330\222>4e\217\256\322\225|d\320\272_\236"
+	.ascii	"m\266\317p|,\277`a\375\024Pq3\n\232\370.\373r\305\245\207\365"
+	.ascii	"O`\206\377\004~\374'\330\343?\001\035\330^\006\321|Npi`Al\350"
+	.ascii	"\240X\241\002\362;\310]M\03111~`\275\177h+9\030LX?\340E\265\002"
+	.ascii	"\273\320-w\017\0336>3\203X\377\0049\266\327\356\252\340\004F"
+	.ascii	"^\323\346\372\335%\207\223\006\013no\321\351%\365\330z+\234-"
+	.ascii	"|L\240\260\376\t\236vV\2050]Y?\260\376\re\366\216\215\205#\225"
+	.ascii	"\304\217n\353\370\215\305\343\342\276<a\375\200\373J\316\316"
+	.ascii	"\213\331U\016\236+O\316\215\026FF\310\266\3328\376\2260\351X"
+	.ascii	"\377\006-\37474\341\377\333\306\357\252\252!Ev`\275k\340\245"
+	.ascii	"\251*.\260\376\rn\374\377\001os\323\3303t\027&\203g\260\3362"
+	.ascii	"l\222h\314Q\301\3727\240\361\337\340\203\377\357\251{\267k\264"
+	.ascii	"0\223\004\353\337\240\203\377\206\031\374\177G"
+	.string	"m\250\r\265\2376\f!}0\236\3266\fT\317K_\027\336\206\201>\001\"\246\013\357\031c;\355\027\273\35167\214\335\3427\323v\261\266a\240d^\226\27537\fto/!\245J\332\272\360\236\275w\341\226\\\225\254\n\272fyw\366\367t\341[I\251L\220'\326\337\323\3073\037\032\270vw\337\3722\\fS\362$JO\247\031\372\347\267\314q\231I\222\226\007\265?*\032\316\303\232\230_\3403\020\025\2436\345\027\370\274o\201\271\310][\300\224_\240\331}\013D\253d\371\005>\321\300\354\247m\214\300\244\204\200V\0274\020\355\317/\360\276IA\371._UOB\na\315\210_\340\034\032\210^\361\342\334I\350\023M\203\232A\317l$t\020\035\203\222A\005Q\300\335Q4h\231\333D\003Q,\217BA\243|O\032\032\250\305P/m\\\234sh j%O\271|^jUp\332\254\352\262"
+	.string	"@\177\217\0234\f\220+VxX\177O\033\352D\301\340\276\270\256\005\375\362(\230\355\207\304D\020\355\202s\206\206\035\030\326\337\023\004\345\202\372a%d/\344\320-\217\372\331\bF\221\"\003\353\007D\265\374\277\020\007K\021\272%X\377\243Z\320,8OUz\026\232\005\305\"\f\324\202\006\r\353\357\331\342\337s\305\277\247\006\377\036(\376=H\3745\214\341\377\350\224G\371\344:\3205X\320S\352\300:\304\317\243S\266\031\336\2162X\277\006/\3745l\341\302\252*\3745\304\361\177\324I\005\253)^\302`\235\257\214\205\021\273z\006>1`\233\223\345\026\354\207\026&v\365L\023\313\341\3542FE\354\352\371\026&v\205\002\001\342\204\312QH\234M%lbWO\224\354\336\341$\351\364%%\034Kt\354n\001\201M\354\312\354\b\222{\267"
+	.ascii	"$\261+\263.j;\304\256\236xh\220\262\260$\260\035bW\317@2X\313"
+	.ascii	"\005h-\340\326v\210]A)\221\304\256\320P&.b'%v\365<\022\267&%"
+	.ascii	"v\365\314\361(3c\241?F`RB\240\r\314Y#[]0d\207\330\325\323m\215"
+	.ascii	"M\354\352\211\022A\223\240o\350\031j\206\262\241w(\034\352\206"
+	.ascii	"\312\241th\036\032\2072A\327\3204\264\016=\202\026A\215\240m"
+	.ascii	"\250\035\332D\221\240h\250\032\332\004]\202\342\241J\320\271"
+	.ascii	"\333"
+	.string	"D\231h\331\243B\320!eP&\026\31412\233R\002ZJ\234RS\231FV\bC\354\304\2560\023\312D\303\312\220\304\256\236\331\te\346'\f\350\341\214M\354\352\231\204.E\220\022\2732K\273\002\265DC\231x\255\311\211\20621\023\267\205\260f'v\365\354\235\311\2538i\020a\200~$\375\362l\241\0066\376\032\310\370k\330\342\257\201\006\177\rO\3745 \361\317@\206\177\206)\3743,\341>4\330\324\037\032\326\237\341\b\377\233\206\366@a\240]\231M\031\201\276'\347\027\352u\233h\017\364\305\347\253\254\003\355\221\271\320\246\021\230\224$\36499{\357\037z>\3444YQMm\315\245\227\305)\007\326\237\201\214\243Y\350\216\334\247\325\264\354\275g\241O\350\325\345\213\323D\006\235h\026\252\003\203\240\"ve\266\205\362@\265n\023\315B\261>ge\255\017=\031\324-\231\\\177\006\036\3743L\361\317"
+	.ascii	"\305\321\253\1774\006\352\204\346\300XP\326\252\352\260\266:"
+	.ascii	"\243$&\f\353\317\300\304\037\004)\034u\312\247\313l\312\f0\372"
+	.ascii	"b\314\370\274\314\246\344G\264\234\234iQhu\250\r\224\006Z\205"
+	.ascii	"\336@q\334&Z\003\235z\224\n\225\321\005\255\201B=]\013\267\016"
+	.ascii	"\302\302\322\253*N\352l\364gH\342\027\353\362l\f\202\374y\304"
+	.ascii	"\360\347\351\302\237\347\n\177\036)\374y\364x\346\273<\033\001"
+	.ascii	"wg?"
+	.ascii	"\317\034\177\0366~\343\003yV\360\260\346\243\222\255\2040$\313"
+	.ascii	"/\360\231\273\246\356\033\026l7$)-\213\271\346\226\341\206T\331"
+	.ascii	"\313gF\374\002\237\2753\263<]\013\266\016\312\376r\231\220l\246"
+	.ascii	"D\004\265\273\226\231\313\364\210\026\222L\004-\311R;Q&MF\377"
+	.ascii	"\3513hG\223t\032tI\017j3\032\f\252\244\277\350@]\006u\241\307"
+	.ascii	"\240-P$\355E\207\321\202\032P?\265\230\333\324hr\325g\036y\013"
+	.ascii	"O\341\267\263*~\201O/\215&\027\271k\035\316\222\374\002\237="
+	.ascii	"t\330\bLJaT\337\217\334D\243\311R\362\224\314\254#A\013-\311"
+	.ascii	"L\253iuP\346\245\321\344\036yI\325\001-\t7\375\347&\331I\216"
+	.ascii	"\242\225\346\354\275\343\211\351!#0)\205P}>\3704\232|\005\333"
+	.ascii	"e6e\211\2763g\357\035\215f\352.!\224%\371\005>\263WX&\233\372"
+	.ascii	"\340\354\317/\360\016\215\276\241\275\262\020Pv\347\027\370\314"
+	.ascii	";4\032\214\244'!\215\200\226\345\027\370\314k\032Mf\346\266\276"
+	.ascii	"\265\274\206&\307e&\231M)\204jSsj4\331O\333\340\240\324\324\373"
+	.ascii	"T\207\262*~\201O\034&/\004q\020@k.9<\272\222\256`\375<18\233"
+	.ascii	"\216\313\314e\t%\250,\332Ok\271M\275\345\227\266h$zo\004&\345"
+	.ascii	"\004\224\236\234[4\226\217\302A\251\251'\355\370 L\020\213S\037"
+	.ascii	"\361z\242\203\353\307P\307\037O\345m\270|^\f\020K\262\247w\346"
+	.ascii	"\334\323M\215\307A\251\311\004'rM>\017G\330{V\3342\355\t\021"
+	.ascii	"\247\023\017\227/\216D]\232\263w\346\236\206\362yKA\314\234L"
+	.ascii	"zO3\331\260{|U\021|\366\351+Z\212\256\242\3714\025mEO\271M\275"
+	.ascii	"\247\243,\241G\336\236f.\350\307\020\203?\206%\376;g\370\357"
+	.ascii	"\214\341\277\303\205\377\216\025\376;Q\370\357\334-\221C\002"
+	.ascii	"S%\n\353\337a\253\323v\267\251\357\264\\\022=\307\303\313\362"
+	.ascii	"N\323\351\271\013^\374\210\\=\363\034\2271o[\377N\347Jj\322\250"
+	.ascii	"\345H\203\265\022-\207S\004\314\211\007\326\177A\013\377\013"
+	.ascii	"T\370_\320\343\177a\t\377\327m\272\210^\323p\035@\221\274\200"
+	.ascii	"\342\002k\375\246\217\274\206\323n]\303\205\200\325{\222\206"
+	.ascii	"\3139\323{R\316\275\030\334\213\201&\242\005\326\334\372/\314"
+	.ascii	"qm\344\347u[\013/\247)\2547\270;\373/\300\361\277`\204c\346\345"
+	.ascii	"\331\036\356\316\326i\311\262/;\260\376\013?\3204\221/\347\226"
+	.ascii	"%\326\232\310\177A\342\222$\313V\231\026B&,\233\201\244\013\326"
+	.ascii	"\177!\252\214L\210%m.p\3545Y\006\274\342\002\202\365\003\336"
+	.ascii	"\265\252\031tX\377\205&\275\fBfFL\035\326o\341\013\377\333\324"
+	.ascii	"`:\310R\031#R\200\274\016\262v\321\276\364\221\301Z\373\320?"
+	.ascii	"\3702\n\251\305\017\033N\240\244"
+	.string	"\271\361%\fse\212\327W\216\262\0256\207\206\365[\340\343W=\031n\351\fs\335\246\356\3228\342\272\264\225\336Br\027\344\206M\177Q\306No\361\270PP\316&\254\265\2260\212\214\031O\260~\013a\374_\357\270M\235\345a\307\330\024\326\017\250\261\376_\210\273\256\200\021\304Z\353Pv8\033X_\245_\244\252\030\301\372-\350\310\241q\340\035IV\244\260~\013V\374-\300\340o\241\205\256\302\\\324j\034\301\372u\312\360\377\32734\215\333\32452\230\317Z\362\226\357\32152\227\374%\335\362W#;5\325\345\253\322\351K_\3208?\334#L\322\374m\255\227\264\262\313rJKi\031\267\251\251^S\3450Y\020\007\311B\357\\g\226T\331\214N\232\332`\222\262\210l\370\360\241\306i+\007\022\327\377\257\241t\324mj\245~j\322N\227\257\212\331\247p\222de\021yj\245n\241]pPjz"
+	.ascii	"\036\027'_\362\205\327c\353\327\361\302u\214\027tcY\260\3260"
+	.ascii	"*\314\250\342\303\303\372u\250\350\027\177\241\302Z@\301\372"
+	.ascii	"u\234\360\277\315\367\242\231\376\213\217(4\324\260~\235%\374"
+	.ascii	"u\344\370\353\304\361\007A'\3453y\360\362\305\221\220\362\305"
+	.ascii	"\251\221\264\322m\352$\335uR\376\323\003\343\304\001\033CS\333"
+	.ascii	"\372u\322\270\036\262\004\267\207uN\223\321\334|\311\221G\206"
+	.ascii	"\365\353\210\361\327\361\301_\247\353\231\313\334f\026\314dz"
+	.ascii	"\230\275\313\tf19\220\203RS\tW\202\316,\230\377j\300\304\262"
+	.ascii	"\210<S\036wk_[\177\316\031\376\237\003\001m4)9\303D\233TY\001"
+	.ascii	"\202u\036\223\301\370\301\350_\260\376\034@\3769^x7\20472U\032"
+	.ascii	"wBI\322\261~\020wUU\302\250\036,$\300\364\371d\306\311U\213\273"
+	.ascii	"\026X?\210*\03242\225\023'\301\252\247\020,\212\226#X?\210%\241"
+	.ascii	"\f\241\fa\024\317TM\323\262Y\003\353\367\371\343B)\241\224pj"
+	.ascii	"L\314\232\225\226\"\204+\306\024_z\272C\242\007\005%\214\272"
+	.ascii	"Fz\024\017\221'\260\252\355t\352*\023F\205\215i9a\375>q\302\027"
+	.ascii	"\302\027B\247)'\301\252g\205\026hi0\2041^\350\024\207f\254\r"
+	.ascii	"k!\214\324\351\211\221(\034k\377/\264\2011\265\344\352\254E\013"
+	.ascii	"\241\213\036\336\325\264\256\234?\260\200!\t\231^\350B\230&\312"
+	.ascii	"\220\033>`B%\241R\246*\342\224\246j\343)1\363\005\353\367\261"
+	.ascii	"\022\"\t\2212\025\221\247\277\245\031\237\242\207\206\211\365"
+	.ascii	"{@fp\220\205S\220\033Zde\314\260~\017\272\204\t\303\321T0{\372"
+	.ascii	"R\204\333\330\202\222t\3469\232\234%%'i\260\346On\206\313\351"
+	.ascii	"\266\2065\027,\356\030b\005\353\367`\b/\303\0019\031<#xLX\363"
+	.ascii	"\300-\273(NxX\277\007X\374\001\371\030& `yXs1_=z\214a\375\036"
+	.ascii	"\304\340\177\233\374\357\323\257\236\205\354)\350\305\013\007"
+	.ascii	"SA\351$V$\023y\201E\307\227\347`\376\264h\341\\\224N\202UO\301"
+	.ascii	"/i0\374\236s\301\362\3342\2035\337\222:\2456\222z \365]\371+"
+	.ascii	"\034\313\347\245~uc\337x\302B\343)\005.G\024"
+	.string	"\216e\213\337\020>0\254\277\0033*Tx_\017\026\022\340\226\361T%\320fM\260\212Z\225\347}7\200o|E:\2001e\nWK\253\236\326\226i\227\226\223\026\326\317A\223\275\275t\312)M\225\031\306\261\205L\035Z^\036\207\"\202\230.\274=\250'l\\\3579\224\377\222\266\3402#\003k\376d\317\020\002(X\307\235$\275A9\23541\001\356\211\03036N\\\252\br&;\314\206\\F\025\205)l\311\222L\225\266\274[NejX?\0078\354\354\222,m\336\340\272X\301\3729pAG\227\251\f\300\374S\346\240%E\221!F\211\022\345\223\020\275\032\035dF\244\210$I\002\202\326\232U\206R\345\314\023\254\377\203\017$H\210\236\304\356\314\322+;\2724\254\377C\022\034\334\025\362\004f\204\245\004I\336\333\333\246\361\344C\212\276+C\312\352\321\326V\343\344\351\313\t\016\214>71\254\177"
+	.ascii	"0\330\330\022\340\374S\232\t\371\224\364\250\234kk\005X\376)"
+	.ascii	"w\016\246\274A\254\337\003\02444\256v\215\364\250\r4\236\270"
+	.ascii	"\246\370\340\334\234\022O{\256\326\267\206E\313\226\377\027n"
+	.ascii	")Qg\004\261~\017agg|\352\032\351Q\030\240\364\241)\237\273\252"
+	.ascii	"\257\312\r\254\337\203\326\220!B\236\262\310j\372\326\240\226"
+	.ascii	"gYY\312\274:L\245> \313\nIc4\320"
+	.ascii	"\264\214\2159A\335\232\002\251\350\205\205\245\314k\244G\355"
+	.ascii	";\2474UfmT\274\224`\375\033\224q\016\306\301Rf\017\026R \316"
+	.ascii	"\235\223`UV\366)\323`\375\033p\361\277g7%s\233)\031\016\344J"
+	.ascii	"\365\236T5A\235\262\212\003t\312+,P\3609\220\377\364\231\226"
+	.ascii	"\341?l\366\240r\354\300:\375\373\301\243\n\f\326\177\323ZHq&"
+	.ascii	"%\361\245\255)\316\324L\231%\267!\270D\263gl\201Yr/\336\203c"
+	.ascii	"\361.\276\203\347\3407\370\026"
+	.string	"\377\342>x\026\327\301yp\034\334\212_q\255\333\344\\\377x\216W\341q$-N'\276\324\243F\314I\260\252F\225\223`\325\023'q.\316\264\347\354\222\206\351\312\227\2733O\347\036\347\342.x\f\0342'\301*\263\336\227dp\032\231\031\326;\217\257\232\033N\202U\317\264tp\317x\363\213\342Tt\234\213?q\250\026N\3608\027\357{\006\207\027\275g]\325\3349\tV\241p\266\205\351\240_\0030\034\355\227g\277\006X\370?\247\301g\240\311\340\372!\2643S6C\217\212O]*L\340\230\270\324\363\251\273\226\201#c\177Xs\345\236\341\224uw\205\365\003\362\2452\036>\310\260~\r\352\370?\207J\231i\376\336\354\260~\r\340\370k0\204\363&\376\3426{8\ffZ\357=G+\351QYa\375\032,y\t\372\355\331?x{\366k\260\203\277\006R\3745P\342\\)\247\t\240\216:\254_"
+	.ascii	"d"
+	.string	"\370\013\200\n\177\001\324\361\027\300\032\177\001\204\361\027@\025\377\016\203\374;\370\361\357\320\204\243T?\237\n\3624L\240z`\375[n:\330\201\001\223\002\332\260@\212\225\007\335\243\254\213R\352\374\0240\035\203\227\304K\2171bl\230\310\006\225\204I\377\364\234\216\251+X\177\207f\032\006\320\303\377\013s`\034\tT\302\372;\030\341\377\251\227\277\315\324K\212\206\215t\244\237\261*\016\3223[`\224X\177\207\037\3746S.\351Yn\302\352T\035\240\214\241)q\316\344(\363\207\365w\310\301\377\323-\177\233\351\226tH\217\221\216\224\322iu\341e-l|d\260\376\0166\370\177\232\345o3\315\222\226\345&\254.\205\200%abW\367\257\357\317\t\353\357 \203\377\247W\3766\323+\351\362\001X\235\352\2021\254?%\276\002\245\351\005\353\017\300 \377O\373\3766\323\276\024\2106\322\221j\2568Mq\260\333\240\374"
+	.string	"\261\376"
+	.string	"p\241\362T2\325\355\275\367\252\216\024\230\263\254\362\300_\350\005\200J\224TJ\224t\312\224\275\275\032\032u\374\003`\326$}\322$\325\323s\342\344\214\323\327\237Y\027\377"
+	.string	"D\335\245xwi^\232\267d\311\025/\313"
+	.ascii	"t\376\031\370\315\245us)s\367~\231XQ\312^\245\364@G\22729R\226"
+	.ascii	"\033\313(\3743\200\223\223\253 \230\001X\263y\345z\260\220\376"
+	.ascii	"0P:\211\025\311\t\024\222\303\007\326\237\201R\\\334\3272\314"
+	.ascii	"\221#84\234\276\376\236P\370\177\352\326L\335\356Z\017\026R\230"
+	.ascii	"\017\376\234\202\334x\366\356\204\003\234#\3156*\254\037\003"
+	.ascii	"5#FR&\357\275#1{\024\216\236\323\327\237Y\257Rzx\f\226\374\323"
+	.ascii	"\264T\355\323\"ER\346\353\364\336\225z\277\312\221\3529}\375"
+	.ascii	"={\225\f\017)\023'-\317Yf\306\377\013\207y_O\254\037\003%\377"
+	.ascii	"\377\373\370\177\367$e\357}\nev\245\222\315\376\277\177\321{"
+	.ascii	"=\374\337\334|3\370\177\375\377\343e\324{\025\335\231\336\373"
+	.ascii	"\035\303\307\350\222p\\\3205\364\336\245\232\226:\322mr\313\222"
+	.ascii	"jr\313RZh\212\222%\325\227\244\314\226\262\260n\323R\226R\271"
+	.ascii	"\324\221,t\267,eS\317\222\322\351n\275F\223[\022\322mZ\352R\275"
+	.ascii	"gu\235\336\224$\325\335\230J\013MnY\312&\267,)\013MnIRM\035\253"
+	.ascii	"\35341y(;3\013\311B\f\267$\251\356\206%e\241\273eI5UA\013\323"
+	.ascii	"C\307\247\365\002\214[X\216\033\326\264\324\241\236\254\222\224"
+	.ascii	":|ML\254\256\245\367\033\307\324\225\235\257\367\fz\267\302R"
+	.ascii	"jI\252q\353\224\370\240\224\344\222\260.\263\367\276\341II\013"
+	.ascii	"\253/\361!\335\316\327D\206\325;\231\222P\177\352\275\367\020"
+	.ascii	"\220\230|\275\307\345C\342a\325"
+	.string	"\235\230z\237\2403{\177\352\035\351v\276\336;R\357=UZ1{\277\241\323\264|z\352\275\252\347\251[!\3311\365\216\343\374\352\244\232\334\264\260~\354\216\270-\273\013&\322mr\302\352\313\256%K\311\335\220\330\272S\357\375\212\341K)\252?\254S\"\350\027\222\226.\254\377\002=\236\2325q\365`b\375\027 \341\251\020\0330]PhX\377\005m<%\273\201\243n\016\353\277 \2153\323zg\342l!?\\\330a\315\207\204u\231\301\232\331\274\021\245\013\3534C\241\333A\207\365_\360\2033k\352\256\220\310H\177\310m\021\002\207\365_\220\203{y\245_=\274\253\26599{\257\362p\363\302\013\f\267\036\237~\345\234\021\264\222\224Z\235\241\311\302\204\365_\020\243+\335ZZ\031\304\372\377)\335\352\301B\n\023B\330\330\240\336\263\367*\017\267G\022\"O\254\323\255\224\207\322\215!5\260N\265p\224\264"
+	.string	"S\006\353\267`K\232\225^\245Xg5\222p\245:rs\013M\037\326o\301\023\236\346H\255\300\302\224@a\235\326H\255\204uh\244|Y\3418\2032\306\n\353\033\036\320\342\262\207\365[\240\204\333H\253\370\224\225\336\204\365[\300\306\0370\245\2212\351\302\244\215\306\f..$qX\2472\240\32005\301\372-"
+	.string	"\302\3776S\252\251\023\256\352\304\244R\237Nmi\361\202\n\353\007L\225\377/\254\200\305\317\f\2372\215j!\250\347\226F\245P6W[7\262`\375\026`\361\267\300)\215Q\200\336\267\304\372-PJa01T\r\201j\332g"
+	.string	"\255 \321\303\372?e\372\333L\231\322%\023\267\277\240k\323\341\354\275\212\203\032(f\220@\301\372\001\240%]j\236-\361\202u\252\204o \231\"VX?"
+	.string	"\356\370\337.i\337`\366\231\314\254\343sZV\316\264o\274\315E\253\203\261\261.\274g\232\224\"\3554\033\315\036\274\315\264\357/ri\337^\306\224\272\360\236cZ]x\317\353\226\366\335\305\306\007\257'J\356l\264\0317(X\232\035\353\007@\021^f?os\013\3560z\233Lf\326q:\255\030N\301\235\267\235Z0\226\025\376\276nl\035\330s\323\205U\246\003\353\007"
+	.ascii	"\027\037\223f\271\001\267\230\333\334c\366\237\333\230\250%]"
+	.ascii	"xf\271\214\333\236s\353\007\300\024\377\n\322l\247\206\032*\276"
+	.ascii	"-6\260\376\n\270\360\257 \217\177\005M\376\025\250\371m\260i"
+	.ascii	"2a\021\351\312\262\265\334\346\336\262\237\344m'\227\317\353"
+	.ascii	"\001D\240\354-[oc\271|^\017H\023\305\331{\337\360\341\203.\003"
+	.ascii	"\\\003\334\372\n\266\201\361T\303\372+x\342\377\277\3736\225"
+	.ascii	"]e\363\335\346\266\262\245`f\357qS\350\334\242(YB\311Q\346\226"
+	.ascii	"V\366^\216\362\242-K\021\263\017\037r^d]\205\251\240\237\203"
+	.ascii	"\036\177\016E\370s8\343\317a\214?\0070\376\034\274\370s\230\342"
+	.ascii	"\377\273\311o'\027\253k\300\241z3\273\201\365f\362\363\273\t"
+	.ascii	"\002\002m\361X\302\315\013\371$\213\330\343J4\204\034\021\244"
+	.ascii	"\242`\213\024 \223G$\354X A\203\005\026\307\350\004\221P\304"
+	.ascii	"\205\027\362!&A"
+	.string	"\020U\260\304\023:E#\261\302p\035\252\255J\202\210=\341\210\224\300\332\252EF\225\205\003\210\330!\r\031\222\255\211c\t\"v\b\003\021;\244\223\256`U\024V5\0052\251\246\250\360B> 8\260%\254*t^\310\007\003\035\326hD\232\240\200HT\205+\321\004\017\313\016%U\243\210\235\"\213$\032*\266\254\003\210\023\340\274\220\217\0212\005\bd\021\331"
+	.string	"d\361X$\302y!\237!\2258\004\201,\022\2238/\344S\001\253\022\r!\2117/\344\303\022\005\201@\0261\260DA\302\021\033,\360B> \210*\204\210\255J\304\026\201rV\020W\241\021F\311\233\027\362)\032*\202\350iE\024\r\025-\020!\221&"
+	.string	"\025M\344\004\035\213+XuM\"\211 \210*H"
+	.string	"R\221&\274\220Or5\026\001\255BD\026\003\243\332\"[\f\353\220*\201uH\225\300\nVE!E\021[C\\\205\210B\342\261\250\004[\001\240\234\335\252-\213s\324\026\223\310b\322D\016+\242\035\256C\305\266\246e\327V5\201\255@+\002h5\252\307\240\"\212\226U\215:\255\b\2405YdW\022-\253\032o\214\304\243\021k\220\232\\Y\210\350\351Q[\343Jb\250\bE\320\261\310\0029\204\201\270\0329\300H\035\272\200\266\303\025\254\332\356\025\254\212B\273\006\245<8D\242\232\221\311\243 \215a\247-\036K\020\036\213\352\tF't\220I\265\0018\310\244\332"
+	.string	"\236\233\017|\332\244J\344\203\302\nVm1\210X\301\252\255\206\027\362!\016\223 \210*\202Tc\211\240cq(\251\326XX\201\212\332bk\024\261\266\252\261\210hTG\254`\325\226\347\205|\212F\"\210\242\221\b\204<\241h$\246\rX\301\252\255\315g8\026\325\023\236XL\256\3075\210\177\b\004\360\200"
+	.string	"#\030\245?\302\001>8\300\007\373G8\300\317\317\001\b\360\303\237"
+	.string	"?\271m\333\266=2\022\255',\274\220\017\021;\004\202\210\035Z\207D\354PM;L\"[\242b\222\310\256$\210\330\241\234\226\035\266\353\n\242j\202\210\035jY\244\t\"vh\207\035\332"
+	.ascii	"\035\325\241!\344\210\022D\354\320\316:\004*a\005\253\266|hm"
+	.ascii	"\331#\024\023\264\255\212\025h\330j`\213\206B\304\266h\002\350"
+	.ascii	"(\302hD&w.$\327v\035B\362\200@h\250\202\310\330\266C\025+\320"
+	.ascii	"\206\027\362\001Z\333\325H4\204\034\201\201\245\300hD&\265\020"
+	.ascii	"\261-\022\241)\250G\231]\213\214*\213]4d\207\212I\024H\360\244"
+	.ascii	"\240&32\271j\200HT\323\027\362\261@gH\224\022\211\352\020(\211"
+	.ascii	"$\256\311\n+\020r"
+	.string	"H\007\035\213@H\342q\345/\344c\224\004a\224\334i\207\025V\242#\0240p\002\205\r2i\302(\251c\263\266\352\t!vM\252XO\030%o\222\255\211c\n\352\211dM\2625q\341X\202-j\325\026E\2625\261\303\016\327\241b{,:a\224\3249\226`\331\225\210L\232 &u\332\225\004b\362B;l\371\261\004[\201u\250\210\302:\244&K\020\2239j\253\2220\256\307\243*D\254Q[\225\304:\244&U\b_\310g5\256D\242\232\001;$\022U\264%\256\311a\005\"Q\004\006\"Q\345$\374\f\211Duo\"Q\345D\242j\263\002!G\260X\2236\311\325h,\252\330,V\240<\202\204\b\"Q\335+\3618\201\226UW\023Z\021@\0250\256D\242\b\266\270\201\035\"\223GA\233\265i\327\240\244\332\342\254C\305\226\b\2114\001G\305\b\022\"j\206\212P\b\201Vc\n\365\350"
+	.string	"\366\230\002\022H\303O\033t,\036\213\352\320z\202]\215\304#b\016;\034\201L\036\005Y\030*bs{\034\016ev\310b\005j\331\364\204\023P"
+	.string	"\031\221\303\241\215\"\205\3658\034\332I\225ENQ4\252\304\032v\370B>\002hs\206\351\013\371\264\304\242d\313\206`\207Fk[4da\005\021i\034\016w{,B\022\207\3034\271\036S@\016\207)\233\\\331\242\343p\310\201\216\305\025\303\341f\217E\"v8L\217\310\"[4\256\303\241\260\035\266l\321\250\363B>\354Jt\324z"
+	.string	"\264&U!\326\003\020l[L\001\242\350\030\344\201Q\321\261h\364 \004\002\f\t0\202\021\210\025\250\310H<\026A$\331\"\020\006h\215\326\243Q=&\327\366X\034\002\251kR\250%\032\0165\260X\223D\303\341n\331\242q8\334j\253\002\r\207;\251\n\021\365\n\202\";\034\356\025D\244Q\267\305c\tm\361X\3449\226"
+	.string	"R\327\344N\266&\210\307\242\022j\253\222"
+	.ascii	"R\327\023\310\344\021\t\033\216%n^\310\247\330\032\255\311\325"
+	.ascii	"\btT\037Pl\215\326\235\366\250\002\263C\342zb\005QMa4\252#\212"
+	.ascii	"\255\321j\241\330\032\255\272e\207E\"\024*V\022+\321\021\n\303"
+	.ascii	"\022L\240\250Y\211G\265e\217E\336\016'P\202>\026M\034Y\342.\022"
+	.ascii	"\261\231\035\216\bQB\315\210\020%\b71D1\277\220\017[\224b\003"
+	.ascii	";<\001H'\271\266\254:\264YvM\002\001\251\351\312B5\242(\"\032"
+	.ascii	"\342EC\026+\020[\224\202\263\303\225Xd\261\222`\213R\324\254"
+	.ascii	"\303\225\350\b\005\266(\205p%:j\331\242\024)[\224\"\257F\225"
+	.ascii	"\310\242\310\344\252\001>\202\204\210\224-B\026Y\254I\023\027"
+	.ascii	"RPO\214 Q!]\223E\255\232\\\211\206\326\266\246}!\237\"\242\241"
+	.ascii	"!2y\024D$\252 \330\344\312\242\230\004\032\300:<\361\201\b\037"
+	.ascii	"\020\240\210hh\347\210,\266EF$\273&+\260C\f\353\260\210h\250"
+	.ascii	"f\267\306\"v=\261\222(\"\032\272\260\016\217AE\243:\3049\006"
+	.ascii	"\025\215\"\2067 x@\004\326V=q\004\244\256'\324V\005\022&Y\025"
+	.ascii	"C\241\240\242\320P\005\221\321F\005\221q\b\002\241\025"
+	.string	"!@\030\n]`\211\220I\022\311\025\250\310\242H\242\210h(\247\035\006\251( \213i\220\212B\2615r@{,\241\210h\350f\035\342\254I5\005\240\244M\373B>\254P\253\016\r]v8$R\261cTL\266\352\t-2\211\203L\036\005\351\260HC\324\264\354\220\305J\202\305J\002E\nj\262\0042y\024\224s,\3011\030ox\332\027\362A&\217\202&\260P44\001\231<\n\332iW\334\234\265U[\026][\265E\361\323\022\341\204`Y\225(\005\244\021\347\347'\331\232\300\320\252\2609\22682\022\021\211\330i_\310G\005\210#rh\bI\244 \304\021f\207+\216j\003\200\324\242\017\024S\\\370 \005\376I\201C\244\300?*\016\241\342\037#\034\302\b\377\034\341\020B\304\026y\264\001\301\003\326V=\261\032\211\206T\024D\242\232\263\262\025@\242\200L\036\005\tW \344\tk\213L\232\230"
+	.string	"\253>"
+	.ascii	"\231<\n\332\020t,\006\221`T\213H\254l\021\206vh\264\002\035\213"
+	.ascii	"C\226X\034R\217G@\303V(\250hT\241\201-\032\211\b*J\261\222@&"
+	.ascii	"\217\202n\222kk,\226\2609\026\215\324\023T\020\231p<\002\022"
+	.ascii	"\256`\325\023\330\242\221\210\024\220F\025\311\225\005R\347\205"
+	.ascii	"|@\260I${\\\331\n\330\241\221z,\016]H!C{\\\3315I\324\"\217\255"
+	.ascii	"\232\202\305\006\"\013\343\315:\274\260\0161\254\304d\021\022"
+	.ascii	"Erm\327\023\332\343\232L\026\021/\034\265E\242J\244\246\310i"
+	.ascii	"\325\006X`e\213n"
+	.ascii	"\3306\271\032E\214X\331\"\fk\220\332\036Wbr5qD\026[\242\241\""
+	.ascii	"\366\210$r`\213\354\232\\[\366H\250US\260\300Y\203\324\326\210"
+	.ascii	"da4\256D\243\261HE\253\246`\261\323\036\213\220#\214\306u\304"
+	.ascii	"Qrm[\265\001+1\211T\301s\244\032\211\330\"\206VMQ\274\t:\026"
+	.ascii	"\217I\365\002\031\214*\261\330\026\223#\222\310\022Gd\261U\223"
+	.ascii	"E$Z5\005\013\r@\310br5\241\202\310\204 \025E\253\246`\241\203"
+	.ascii	"\323\276\220\017\bdQ\303#\211\326$\210\026\211L\202\2509J\266"
+	.ascii	"\353\320j\\[\r\354\360B;\f\001\302\nV=\341\210,\266\304c\221"
+	.ascii	"\n\233uXB\233D\232\310\220\\\213*\212\355q\005*V b\207X\242 "
+	.ascii	"\013F+\320\261\204\265U\223@Ej\212\241\0212\305\n\242jL\221\201"
+	.ascii	"\r*\2528\"G\264I$QM;$\300O{,\026q"
+	.string	"\020\b\r\327VM\016\327V\005\"*\032\032\325brey\332\341\b\355\261X\224\376\317\317\210\013* \001\0228\321\207]\301\252-\b\242\n\020\307\242:\004\202\230dA\370\360$\327\226\250&U!\342\260E\"S\254I\035#\022\331\200!\372\377\302:45\224T\272\350\260\344\274\270\372bf\216\003\341V\006\245\034Q\302\177\240y\221\272\"'L2\204\215\007\023\326\302$\377\233I&\242\267\256\374t4\221h@+{Tq/D\362\177\363\260r\311\346\312\334\237\027\326y\357\347\205qX\215\253\351\013\216\253\271u)\203\346\310[\016\026\256\"R\334^\370&\247C\006\216*X\013\331~^\350\266\323\224\211\021\327f\304FK\271e\213\371B#\377B6\334\002\312\223>3X\347\334\235-\\\373y!sppI\017\254q\204E\204j7vl\301\300Z\250\346&\234\363\372r\246\241\r\245\302\256`-\204\353"
+	.ascii	"\032 1\246\0209\313r$\n\222!/<\373\027\232\3452\233\271\2757"
+	.ascii	".\254\321\273\263\257\224\237\027\016\321<\002\243\304\204\224"
+	.ascii	"\325\264PFi1\366\302\262\177!\331u\262\007\301\3068a]\341\356"
+	.ascii	"l\341\362\347\205c5K2\232A\304\204a([S`\023\354\205a\377\302"
+	.ascii	"\345\325\323p\035\370\232A5\005k\341\335\331\027\355\347\205"
+	.ascii	"`9}t\200A\202\b\247|\3609%a\035\025\345\003\353\007\032\356b"
+	.ascii	"\302\304\313\307Y\315\032\234\026\230\257O\207\344\355\210\002"
+	.ascii	"\326#-\033\303\\v\241\2270\252\001\177N[]\351\262\r\310\024\027"
+	.ascii	"\347\222C\003K\030\230\255\024\310\215\261$\220\207\320\t=\253"
+	.ascii	"+K\322\352\313\312\333\301\301\344h\301\332r\302\232\242C\350"
+	.ascii	"\202\357\340\022\\\272\342Plz \tv\345\270r{N"
+	.string	"JX\377\013\255R=a\207\365\250c\222C\202H\254\246 \214\245\024RH\321\314l\223\016s\025@0PT$\022\352\262\244\365\001\023\200\203\013Mt\231\240'\035r\204FDD$IY)d9\321>\252*\005!\205\322\033P`\3530/\204\004E\262\334\356\231\304\350B%f\272\f\330B\031e1\t\343U\037\026B\177y!\r\021\325\bue-\251c\350\2636\021RB\341b\257[\201`n\035Ue\305\260\023Z\b\224\217\271d\323P\347Hy\032}\3662\3228\340\037?V\351M\242\275\3502\334\t\302M\222\205S\361.\324+C\261yy7T\315\232N\2157lD=z\2211\215\300ja\310\367\335k\n\026\303!\221\301\021\341\250\335iUC\262\237\241+/\373y\3215sM\004^\003s1}x\350\003\004W:\214\316\223\243\b\247\221`\277\202\230L\026q\2568\031\021\244\221\374R\204\006"
+	.string	"\361\3453a\313n\350\022\020y\271%\215\2135\211\017\216\377R\261\351[\r\300\303\354\350\227\340\004\206\374\337\367\311\022\271M\245\200|P\024x\312~\357H\020\271h\005\321U\212\036\221\025P\352\213(B\310x=^\024#\325\356\017\204\355t\365\370\312\317\320n\302\304\375\300\253\213\037\2768\332hc\250R+J\346\202\361\252\253\273\362k\317\250\357\254u\374\301\004\321\b\275\361\343N\232<l\006\002\006\207,\334\004\005n\b\342\303A\351\270FQ\252\372"
+	.string	"\355\247\301\341\360\273"
+	.ascii	"\262\250\365\310Y\341c,\337\206\rx\226\356\266\255\204\311\354"
+	.ascii	"B\210E\247\324\261\343\271A\250\230S\253\032\002}Gd"
+	.string	"\377\311\246\243\335\317\217\361\370)=\017n\032\233\240\331\337\357X)Rf\350\305R\202\006/\006\231\23515\231.\260\260\212\024\003\320B^\250\231bn@\251\005[<\235-\210\340GS\326\251c\001\f\373_\021\t\030\267 \3467\004\217\006\345\306\331c\252U\265\0356;\327V\344\313\255(61\375\272'\357\320d\272\266\n\362<\362\330\030\307\303h\336\252\035E\317>\376\323B\235\340\246`\220\212\tf\3612\212\230~r&\003\365\222\231_\330\306\374\230\253\227\315\036dm\204\342.\366n?\022\264[\037(\367\265e\274j<LHe\221\366ER\201&\325\327*\245\371K\221\210\004\263X\034\262\330\247\346\013\b\"\264\3711\344\200\230-!\317\n\037k2\375\322Z\323<\202\331U\331\323.\257\254o\246\253\320\264pq\336\323\007\242\214R]fIvA\013\360\324\254\027\363x=k\216\217\325\321.\310\274K"
+	.string	"\315\303\225\003\211\020\220\\R\034\tIW \275`R\361\003<u\017\327\317\310\255\006\037\3074A\243\306\267\216\004\321\303\220gs\332r\205\313\371@8\317<\355\2345\370]:vB\275QI\003\r\362\245\261!z\322\301%\007i@\355#\023tB\006.+F\347\335\304Z\f\316\332'\357\366\266\027G\234s\306\334+\005\003\272\200\242iX\027j\270{\033x\227r\025\3566\330C\0026\320\344\227\252\037\262\242^\216\312 \253\021\"\344\237liB*\240G%\203\265y<?\224\020\017Q\360\204\200oDEQ\177\204_j@\266j\326T|\2433-\326]b\245\232d)\214\312[A.\340\271Zs\334\362\323\225\025\240b\312BeC\322h2,\002\263\350\232\241\272\225\375\005\217\310\016X@\2646.\356!\227"
+	.string	"\211\\\234\007\267\251\311S\230\231\263\372\240V\261(\263`\273\302\222\207\344[F\333\2127 \217^v\240\344\nY\314\241iA\001"
+	.ascii	"\306\265=\207r\200l+Q\0251f\376P\003\361;\b\231\300\034XP\256"
+	.ascii	"\b\3134=\232\031\230\250h\016h9z\037\r\037t\303]\316B\026]\367"
+	.ascii	"\226\202f\353R+\322\251\201M\247\273)B\217|\227\013\244S\321"
+	.ascii	"\306\177d\021\311\276=\037\277\026\350\025\373@\361\311UV\335"
+	.ascii	"$[p\202\031\3763\262\220\235\323;dC?\332Z\267\004\241\310\263"
+	.ascii	"v3\224\310\364\252\022.\006\355\317\035T\235\027>\324\013\350"
+	.ascii	"\034!\225\320\231\013\342?\215-y\3635h\356\301/\317\315\231\026"
+	.ascii	"Loz\367\232\346\033z\274\271\261FHJp\\\303\200\213\275\257\003"
+	.ascii	"\\}\232CS\326\233;\2426\343\241J\2065h\275\241vW\330?\004M\357"
+	.ascii	"B\247\262\376\023Q\272\353@\361\366K\347N\277\343\031\314\320"
+	.ascii	"&\200\231:zV\036\274\233\373;\003\r\322.9\177~?\026\246Z=x\363"
+	.ascii	"\213\216\tQ\372\206\027\240\023F\240\276\221\034)$\273\244\226"
+	.ascii	"\025\034\n2en\364\\\031%S/\304\311<f%\027x=\374\231\214\341A"
+	.ascii	"<\031P\004o\016\0138\355~y\234*\203\254\373\256"
+	.string	"\017\361\360\277:\274z}\264\275I\262\305e\312'\370\266$\252\340\363\035\314N\334&J\021J\210I\311\241Q\372(\371\2222!\367\032\356wI\356p\241\310=&\227\361\023Z\016\237\343\003f\221\325\300\361\254\211*5 ?\335\374"
+	.string	"v\201\225g\345N"
+	.string	"\213\b\311d\332\306\210\031]\"\364\345\256\030\363\357\013\327\265\216b\024r&\314\223j\351\007R\036p\246\230 \356\2017\177,\243\027-\374\3001\004\034\345\310-xI\311\020\t\324P\324\335\317\030\226*\2227\315O\225\016|\334\203\246\330\2364\322$\370\236\333\031\006c!\021k\222\360\207\027G\322\2143\305\202tS\025\270\206\346\301\352\310\221\254ed\247\351|\031\225\035\007\353\274\220f\276\177\363\322\235\373,N]=\200\212\t\b\346\206\204\222\316T\263\265\230\nC\002\0202r\350\362\237\346\301p\240\367\326DbK\\\370\005\277ze!\033\034\033\330\273\310\217\341/\362\205|\301{\322c\217=\374\n\001\305\374\020k"
+	.ascii	"d8\202\374\267\342w@\354RJj\300\361\203a\224\003[\373\354,\324"
+	.ascii	"\266\336\304:l\343<\236\305\236\352\233\323\324bR\313\300j@}"
+	.ascii	"\200\b\224\367 \260\362\211WW\316{WJ\306\365\307\t\206\r\214"
+	.ascii	"B\344\3269\355o\344\210\211\204"
+	.string	"\3562\203o\026\307\321\350*\331\271\346y}\223g\0271K4]\236\rO]\352\302\033\321\325>JgD\004\243#\3168\334u6\005\315A\303\241\264\321\260NU\347\216\357\033\304\020GbP\246m\356\311hxo\353X k\217\271v\2369\362)21fA\270\201\3042\366cs\233\353\311%+c\223\2037\347+\246\320\322!\246B\242}+\355#\270\355v\303\324V\345\027\307^H'\367\021\370\3222\322`f\255\3230\035#\003\260\202b\237\340Q\b\357\037:\025Q7\026\020\031L\035\257\034\270\260\236t:\263\264\347\227\263\254\362R\220\272*\235\006\023A\231\366\240\237\030\t`\232\234\255\246\325[\202\207\310\263\233\346\003~\341\311\374x\211\336I\334\315\3005+D\177>\237m\255\2635\207\370\322,\224\002v@/i\256\320\022r7\227-\n\346\335:\260\024\024\243VK\004\223'\350&\023L&\337\376"
+	.string	"\246\236H\363\t$\267I\367\313\n\321Q\224\366\031\363\325\322\250\251\2359L1a\222\234A\030\272Nk#\357\034L7\357\3220S\245\3549|a\316Sn\323\254\240,\227\243x\027p}\372\247>\3058\032\321\332\005\304v\n\272<b\374\365\245\333%\342\004\217\214\323\254:Ck[ZPq\365\304\320\251\350\362"
+	.ascii	"\245\310\206\360p\223;\035!rR\354\201gBH-\006\030\351\302\275"
+	.ascii	"w\340\024o)\261l\020,\300\230\240\226\275t%]\264\034\256\030"
+	.ascii	"i\036_\020'ud\021c\276\235\354!a\027\307`6\216\216\006\202\352"
+	.ascii	"-\204k\267\220~\275R]i\256\356\353\311c\262\372\035v \241\242"
+	.ascii	"\304\231\212*\b\251\360H\377@\367\330q\206n\371 \036R,\261\331"
+	.ascii	"\005\006\213@\004\b\212\367\241F\375MZ\210\r\351|I\213\212\344"
+	.ascii	"=B\224\202\273\375^\033D\256e\313h\374w@\203\264K\033\t\257\205"
+	.ascii	")\345\b\374}\235(\371;\312,!\275L\266\217\b1T\036WB\023\261\020"
+	.ascii	"\325f|\233\347K\202\036\034\342\3224\363\340;[\370\230\265Y@"
+	.ascii	"\312\002\324\216\354\017$\253\265\340\016a,~o\306\371\222\304"
+	.ascii	"\341\312\320Q\243\226D\263\232\241\b\211\314\317k\350)\277n]"
+	.ascii	"(\312\350n\001Kd\336jiG\215\322\212\251g\033\255\200\221x`\377"
+	.ascii	"\2739:\177n?\336~\312d\377\216R\274\373$\261\272m\325E\2676k"
+	.ascii	"6\371\243\200\307\300B\275\244W\331p\277F~`\316\320Vx)\327-^"
+	.ascii	"f\215n\020\376K\261l\220I\350\017&R\266w6$DS&\305\242\363\027"
+	.ascii	"\334\006@\337\212BbOXfuB\274\240\017\005{#\b\357\277f\273\246"
+	.ascii	"(\300x\320\261\262\004\255s\273Mj\252\301;\324\t\022\006`5\216"
+	.ascii	"\212\353\216 S\264\024\261_\005\335\004\244\030cmW\212i\2602"
+	.ascii	"\361\205\356t (Y\212xS\300\020+\0176\213\374\277\bk\r\234L|N"
+	.ascii	"\006g\024\325\374\302\334\320=%\202\2278<!\304=\335\270\006\331"
+	.ascii	"<\220\360\277a2\365\233\003W5MY\3563N\004\371\n\363\020S\270"
+	.ascii	"\251\237YEX\005Y\021\314\370U\233\025\213\246\027\373&\226\242"
+	.ascii	"s\211\245A\003L%\276\206\210rH\\oY\021&fd\326\\%\2426W\035`Q"
+	.ascii	"a\301\310]}\330\347X\323I*\315\254\320\262\032\336\214s\207b"
+	.ascii	"\221\333\bG\004/\304aU\032bP1\211\307\262{\330\222\251\245\204"
+	.ascii	"\300\033\265J\206(,m\200@\016\234\325\340\206BP\215\213`=F\242"
+	.ascii	"\343\235\202\236\030l\245m#a\277\353\3652\307K\300^\326h\250"
+	.ascii	"\304t\351\343\361\037'\300\373\314\300]\270\201\275\201\345\370"
+	.ascii	"\307\016\344\247n\035\177U\365\315S\203Xh\037E\205\025\322Vc"
+	.ascii	"O\036\276\303\375\023D\244a8\350\265\027\036'\303\315\205-\353"
+	.ascii	"F\302\177\234Pw\226\363\300\334\263/X\311\344.\344\016\345\362"
+	.ascii	"\257\362\260\375\227\036\353\341\234\2654n)\314\362-\327\357"
+	.ascii	"V\376\350\330W\br\003\344\223"
+	.string	"5p&r\227\253\265_\013\200\205C\250\251}U0g\243R(=\217\345\203\363\244c)\334\352\016T\267n\262p]\276c4[K\315C\177d\353\261 y\036W\361:\026g\212\242\356\006\244\224\252\016\234Ux\234\020\255&\326\240\251\025o\331\201\030\364\306Q\317&\256\225\313r\320!l\230\231A\366\216X)\b\250\004\367\b'\2715\355\233\006i\227\213\003\236H\356\327\177z\016\f]\361i6\252\315\213u\254`\3315\016\3214\tM\351gWt\376\334\261H\220|d\322\304\330\245\311\243s\033\206\326\270y\001\\\2121RyS\306\3404\361\031`v\233\031{\210_\250\007g\252\2774~\032\2508\363\330\020\030\212C[O\335\370\tX5\224\211\035\220\201H3\005\225\261/pp\330\226\007h\350\016\b\";M\261%w#\304*K-|\313S\261H7\220\374'\315 \244!-):=%|\313\210"
+	.string	"'0;\315\034H\340\320{\322\311G\321Y\020gN\237\372\212\035\001?\316\034\"C\006\275"
+	.string	"\305T\202\250\017\370\334\314\371\362\301\016{`\233q\260\377\200\253\317\224Hi`%\227\357\322L\256A\020\002\001\336E\0177\304\341\344\354\030\b\026\261OP\240\016\"\371vxqe\312W{\0032\351\320\263\354\355\353--P\034\242\365\377\020\342\247~\241\013\030\252\212\344\005Xf\3241\310K\034\231*\005\320\217W 0\213\335\013$\260\001\201\266\2652qy\322\326\345e\331\\\220A\226+%\274\026\330\233'\201\364x\372\016\304\214\270;\315c\":\211\271\377\306\212\275T\303\213\017cV\354\325\335\342\344,q\004\017"
+	.string	"\321\376tL\030\341\261v0?S\336\274\253\312\260[A\307\227\276\217\244\247(@\363\027\216\001\025\006\217=\315\306@=\2510\020\276\212\247\205\215\003\376V\315\313!\002E\261\025\262G\375"
+	.ascii	"\340\250\"\346B!o\2733D\n\231\007\215A\260Wm\"\261\033\353\313"
+	.ascii	"\235$eh{{\350w)\t\372\235\177/g\322H\340\330\215\335X\303\200"
+	.ascii	"\212\370\243Q\016\334\240\246\321[\365\314\372\371~\3262G\262"
+	.ascii	"\205"
+	.ascii	"\343 b%v\312\321\342\020\022N|\304\213\006\317V\200\353C\374"
+	.ascii	"\347\315}\270\250#\311\350k\240\331!\220Kh\274\316\007ZC\337"
+	.ascii	"E\006\304V\344\262\335L\034tN\213\030X\247K9\033\375\"\033r\336"
+	.ascii	"z\321K\365\336\347\352\247\267\254\271B\207\377\314\346\024\320"
+	.ascii	"d,G\275\317I)r\265\361\322\315\306\2234\007\361\007\023\341\035"
+	.ascii	"+$\227E6\327N\016\356\230\344\31227\326\303@\314\230\343+hw0"
+	.ascii	"\020\212\344\006\013\232\b6\240\022\255\\\320\021j&\027\272\316"
+	.ascii	"\345~+<\223\327\347I\264,\036\031\304|`\"\241[\264MN\211\203"
+	.ascii	"\341 FKA\273\272i\222A\257E\027(\340\207\341\201w\007\374\220"
+	.ascii	"\201\210,\341\355\243\330\237SV\304}\237\356\237\377\275-W\213"
+	.ascii	"\031\037\263\334\242\264\265\364\200* m\030\b\353\257\264\353"
+	.ascii	"8\376f\374`7\264\211\032+2\200c\246z7\037\204\215X\032]I-\263"
+	.ascii	"=\275\356\351\366\3579d\346Gx\221\036)u]\357\246\314\207\324"
+	.ascii	"\327k\b+\3515k\327s\337\372\240\2256\230\fB\020\006\254G\306"
+	.ascii	"\2332c\367\306\262H]V\006q\221\302\315\263A\3119\321\333\034"
+	.ascii	"\372\022'\024R\bi\2174}\302y{E\220\246y\201}\r\027\230.1bw\301"
+	.ascii	"=\214\307;KU\240\311\206\f\020cC2~\222\027\311\302w\304{&69\354"
+	.ascii	"\320"
+	.string	"\016\037\r\321\355\244\0249\320\266\2552x\365\211aE\021\2314+\212\323Ljf\276\355\231\252a\332q\345XdX\003\"\365+I7>\033\330]\020HPs\300'\233m+;!3f\224\264i:!\177\312\350\300\214\356\200\207@\372D\300\315\267\217lT]\016\321\335\303!\230\244\224\213&\305&\356\363=\263c\343\035\024\346\317!\321\210\032^w\301\363%\266_t\373`\313\004b2=!\3529\215\254\307r\273\337\037\035<\217\331\327\244\335H\356U^8\354/\303\370\b\240!c\335\005\312u\246\302\243\3051K\016lL\374\210\023a?M\002hKKh\305\3771\265\267x9\215\245\322\202.V\222\343\177,\243\273\tX\034\356,\004\037C}\315r|\316\207\177\365\221\212\032\334hK.j\024p,\244\247Rk\227o\260\325\253\357\347\207;t\307\265\257<\017oK\215\376\013M\022\362y\f(\002p"
+	.ascii	"0\266\360\237\345\200\372\373\215)\017\356\251\376\251\033\204"
+	.ascii	"!pk2\b\354E\306\254|\221b\373-\230\225\372\346\276py\370\231"
+	.ascii	"FI\026\254|\246F\334K+f\005\216\357kS;y\341\256M\227\220\026"
+	.ascii	"i\336\337\200<Q\3143\263\013ny+\002\207\365E\332\375bA\\u-1\357"
+	.ascii	"$\374\201\233\333\001b>jn\212i\272k\342\032\206i\323?\314\032"
+	.ascii	"\324~\300\206\230]\350\325\013#'\325y%\227W\n\036\330,4\252\373"
+	.ascii	"\"\021\373B\331\2727\003x\255\020\345\201\366\003<\232\017\243"
+	.ascii	"\347\371\360@\362\357\bg\367a4\032\327x9\214\313w\t\270\316n"
+	.ascii	"\270du\351\036\307&\377z\310Ys_\t\305\336\340\215\275\375\001"
+	.ascii	"\274\226\307AL\307P\234\007f:\272\337\215M\235\364k\002:\027"
+	.ascii	"\031v\n\313\bB\375\203uQH\343\233~k|\371\0358\020\357e\216 \177"
+	.ascii	"\203i\263]\271^\275S\037\372x\201\373\343\206\001}\301\325\031"
+	.ascii	"\367'3M\361\304\364%A^\257\234\214\356\271\361\320\343\034\257"
+	.ascii	"\2535\226\3553\262+{\313\001\327\006\335\217\3453\3279\b\365"
+	.ascii	"\235\273\250v\311\244/\351\323\365\217@\322\025"
+	.text
+	.section	.gnu.lto_.symtab.2c0afeac36faa605,"e",@progbits
+	.string	"tasksInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\003"
+	.string	""
+	.string	"getTask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\003"
+	.string	""
+	.string	"tasks"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\004"
+	.string	""
+	.string	"cliMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\003"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\003"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\003"
+	.string	""
+	.string	"mspFcProcessCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\003"
+	.string	""
+	.string	"mspFcProcessReply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\003"
+	.string	""
+	.string	"serialConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\003"
+	.string	""
+	.string	"batteryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\003"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\003"
+	.string	""
+	.string	"acc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\003"
+	.string	""
+	.string	"rxRuntimeState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\003"
+	.string	""
+	.string	"blackboxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\003"
+	.string	""
+	.string	"taskSystemLoad"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\004"
+	.string	""
+	.string	"taskGyroSample"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\004"
+	.string	""
+	.string	"taskFiltering"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\004"
+	.string	""
+	.string	"taskMainPidLoop"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\004"
+	.string	""
+	.string	"imuUpdateAttitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\004"
+	.string	""
+	.string	"rxUpdateCheck"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\004"
+	.string	""
+	.string	"dispatchProcess"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\004"
+	.string	""
+	.string	"batteryUpdateVoltage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\004"
+	.string	""
+	.string	"batteryUpdateCurrentMeter"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\004"
+	.string	""
+	.string	"gpsUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\004"
+	.string	""
+	.string	"compassUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\004"
+	.string	""
+	.string	"rcdeviceUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\004"
+	.string	""
+	.string	"pinioBoxUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\004"
+	.string	""
+	.string	"blackboxUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\004"
+	.string	""
+	.string	"calculateEstimatedAltitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\004"
+	.string	""
+	.string	"batteryUpdateAlarms"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\004"
+	.string	""
+	.string	"batteryUpdateStates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\004"
+	.string	""
+	.string	"batteryUpdatePresence"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\004"
+	.string	""
+	.string	"accUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\004"
+	.string	""
+	.string	"subTaskTelemetryPollSensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\004"
+	.string	""
+	.string	"telemetryProcess"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\004"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\004"
+	.string	""
+	.string	"baroUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\004"
+	.string	""
+	.string	"rescheduleTask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\004"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\004"
+	.string	""
+	.string	"mspSerialProcess"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\004"
+	.string	""
+	.string	"cliProcess"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\004"
+	.string	""
+	.string	"updateRcCommands"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\004"
+	.string	""
+	.string	"updateArmingStatus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\004"
+	.string	""
+	.string	"processRx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\004"
+	.string	""
+	.string	"setTaskEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\004"
+	.string	""
+	.string	"rcdeviceIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\004"
+	.string	""
+	.string	"blackboxGetTaskPeriodUs"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\004"
+	.string	""
+	.string	"dispatchIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\004"
+	.string	""
+	.string	"schedulerEnableGyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\004"
+	.string	""
+	.string	"isSagCompensationConfigured"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\004"
+	.string	""
+	.string	"schedulerInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\004"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.2c0afeac36faa605,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1112 @@
+	.file	"failsafe.c"
+	.section	.gnu.lto_.profile.c68c3985d98c05ca,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.c68c3985d98c05ca,"e",@progbits
+	.string	"(\265/\375`\305"
+	.string	"\205\b"
+	.string	"t\013\271\001"
+	.string	"\025"
+	.string	"\220\254\202\314\013\f\002"
+	.string	"\002\001\002\002\002\001\002\003\002\004\002\005\002\001\002\006\001\240\342\234\212\n\002\003\270\372\352\363\016\002\002\007\002\001\004\304\375\251\277\tJ\002\003\004\b\b\002\t\002\006\002\n\005"
+	.string	"\002\001\b\257\253\313\240\016\030\007\002\001\t\345\227\312\267\013\004\002"
+	.string	"\002\001\n\207\330\300\037\002\013\324\210\217\002\002\f\353\262\334\316\001\r\302\327\301\252\013\016\353\323\235\254\b\017\316\362\227\372\013\020\260\222\312\332\b\007\002\001\021\223\210\212\227\004\006\022\315\361\362\357\016\b\007\002\001\023\353\303\321\231\004\024\302\260\202\373\013\025\301\275\326\260\016\026\305\310\337\235\016\027\240\342\234\212\n"
+	.string	") \260\2021\032\336,9\274\2002\261%\340\206d\\\344V%\243+\264b\222rG\271:\320\335\200\t\b \001\311\bH\226"
+	.ascii	"\346\205\006\2305\356x:6\021f\200\001g\347\026\016\t\230\034"
+	.ascii	"\016\201\001Q\004\314\001M\001\312+`\021i7\005s\"\004\356\366"
+	.ascii	"\306(\236\033"
+	.text
+	.section	.gnu.lto_.ipa_sra.c68c3985d98c05ca,"e",@progbits
+	.string	"(\265/\375 \177\255\002"
+	.string	"\204\003s"
+	.string	"\017"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\001"
+	.string	"\001\004\001\b"
+	.string	"\001\t"
+	.string	"\001\n"
+	.string	"\003\013"
+	.string	"\003\f"
+	.string	"\003\r"
+	.string	"\001\016"
+	.string	"\003\017\001\020"
+	.string	"\001"
+	.string	""
+	.string	"\021"
+	.string	"\022"
+	.string	"\001\023"
+	.string	"\001"
+	.string	"\001"
+	.string	"\f"
+	.string	"\250\300E8C\250\32655\200\001p\007l\344\nn\036"
+	.ascii	"\003^\232\202\001\026"
+	.text
+	.section	.gnu.lto_.inline.c68c3985d98c05ca,"e",@progbits
+	.string	"(\265/\375`\026\002\355\b"
+	.ascii	"r\213&-\200\251i\f3\301\303\003\006c+\322(\340G\232\324s\353"
+	.ascii	"\241M\261\310\216E\"\372\271\0013\260#\343\204\214\032\261\335"
+	.ascii	"\266YkvK)S\377;\244P\262\201\001Ab9\272\364bw\233\241\035R\372"
+	.ascii	"*,\026\016\336\221J'\236\377\246\372#\265\3544\220\307H9i\333"
+	.ascii	"M\215j\374\260$V\264\343\211\001\342O\321\341\310\344SI\263,"
+	.ascii	"\303\224\017\310\202\007\002\007\314\020H\005\b\214\bL\270=J"
+	.ascii	"\231\217\225b\372\310\344\177\236S\356\356*_\345\265\273P>\002"
+	.ascii	"\344\300\356>\357\254.; \300\"\232\033;\201\302\322\273\301\272"
+	.ascii	",\360+\3111\347g\262\340H\355\374\251a\020\035\230W\217\255\222"
+	.ascii	"!@,\f|QR#@\fy\331W\020\031\203\347\0327\344\201d\220b\362\"\373"
+	.ascii	"D\303Z\003\317c\307Mp\355\030On\3070Md\260U\334\336\313\362\250"
+	.ascii	"\202@\347aA\213\226#\031\360\004\004Xp(&\227N\304\031P\206\303"
+	.ascii	"G\342`|L.p\353+\317\230[\f\027\371\241\274\242\f\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.c68c3985d98c05ca,"e",@progbits
+	.string	"(\265/\375`\033"
+	.string	"e\004"
+	.string	"2\306\022\033\220)\351\260mwwKk&\370\235\273\273\273\253\314\020\370\026\375\t\301\233\310\224\002\252\210\035\037\fj\001\031\303|R\202\016T\240\210\006\024\240H\263=\336\364\344\304\331\266\033o\347\234T\325\n\243\327\202\224kY\244\2748[\362\024\034"
+	.string	"a\263i\343\356\324`\177\352v`\230\001\334=\n\t\264\013dn\006\034\025\260\013`\253Qp\f\232LA"
+	.string	"\027"
+	.ascii	"\315\f\002\314\212k\001\344\202\033\320\356\2460\234\347\344"
+	.ascii	"\354\313\262\204\006\206"
+	.text
+	.section	.gnu.lto_.pureconst.c68c3985d98c05ca,"e",@progbits
+	.string	"(\265/\375 2\221\001"
+	.string	"."
+	.string	""
+	.string	""
+	.string	"\017"
+	.ascii	"\230\004\003\230\004\004\270\004\b\230\004\t\230\004\n\204\004"
+	.ascii	"\013\204\004\f\204\004\r\230\004\016\204\004\017\230\004\020"
+	.ascii	"\230\004\021\230\004\022\230\004\023\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.c68c3985d98c05ca,"e",@progbits
+	.string	"(\265/\375`u"
+	.string	"\265\004"
+	.string	"\222\305\016\024\200\251\35130\0033@\366\0267-\021\217~\344\326\222L\001\252\272\252\317\310\270R\024\b\203*\023\350\371\200"
+	.string	"G\f\351u*)\336\320\225\335aW\023\351\351\316\223v\3465\270D* \200\002\031[\017\266\354\0068\256\b1/h\335\234C\366\016q\315\263\223X\241!\034.\034\013\214\210\233p{c\343\3443\002\326\024\341+\261Lf\324,\273\021\0070\234\365\025\302\006\n\b|\001\361"
+	.ascii	"'\201\232\362v\213\251\201\225NeMP\200\313\341\323v.\254\271"
+	.ascii	"!"
+	.text
+	.section	.gnu.lto_.lto.c68c3985d98c05ca,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_failsafeConfig_Registry.49.c68c3985d98c05ca,"e",@progbits
+	.string	"(\265/\375 \242\305\004"
+	.string	"\244\bk"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001\212\001\206\200\200\374\342\203\304\341\037\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\307\007us\336\006uq"
+	.string	"\005\001\006'\001\f\005\001\006\035\001'\001\201\300"
+	.string	"?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/flight/failsafe.c"
+	.string	"\004"
+	.string	"\236\n\013f\361\024u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_failsafeConfig.51.c68c3985d98c05ca,"e",@progbits
+	.string	"(\265/\375 ^u\002"
+	.string	"\264\003Q"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\036\005\001\006'\001\024\001"
+	.string	"\n\004\344'\001\350\007?\202\210\200\300\001\177}\302\001{\301\001y\300\001w\277\001u\276\001s\275\001q\274\001o\273\001"
+	.string	"\007"
+	.ascii	"6C\202\272\003\215\001\221\224\273/-a\240\b"
+	.text
+	.section	.gnu.lto_failsafeProcedureNames.52.c68c3985d98c05ca,"e",@progbits
+	.string	"(\265/\375 \201\335\003"
+	.string	"\004\0079"
+	.string	""
+	.string	""
+	.string	"<"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\370\231\n}\273\0012\206\b{\230\317\001y\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\005DROP"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/flight/failsafe.c"
+	.string	"\nAUTO-LAND"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_failsafeReset.53.c68c3985d98c05ca,"e",@progbits
+	.string	"(\265/\375`e\002\265\017"
+	.string	"\306\233cE\360\220*\035\352|\t\345YiG\261,\2633\002\365ph\336F9\220\322:\306u\033\353\225\314\357z\333\037 \362\310\333\377f\363\306NM\316\270D\376\f\222#Vv\312\232\3742\257\227\206\304\304\022\262\211\224)\005G"
+	.string	"I"
+	.string	"U"
+	.string	"i\217Kw\232\216\231\3462\255\231\316\247/\300\333 \323\361\262\233a\346\306\312\"\f\b\333\007M\262g\234\305\262oQ\245\264n\273\033\252\207\223\236$\377#\376\241R(O\017\301\356:Q)\r\267\336v\001\333\006l\005\003\252\234F\031'\025\323\354~u\251\252\003Z\247\020\246\234\3615\365)9\\\362\022!\315.\206\017\237\304W\027\374\017\217\036\235\344Q\217\376I\367x\005P\203\211X\225r\306f\231R;\330\347vw\255+\266\2467\231\3762\255\311*\333\313m\b\207q}\265\330\315vOgG8\213\025`*\246\262m\324\226p\025)b\353\323\215\211k\364\323X\343\244bb\335S\215v\274:\365&\334\205\203\242\323\003(0\033\253\250v\347-O"
+	.ascii	"\226\335\375\360[~B\00442\322=r8P48\215w\t\356xx>\234\021\t\210"
+	.ascii	"\363\tM(\210\200H>a\005\020\247$\354\210F\241\007\001\207,xD"
+	.ascii	"\241I($\nAV\351\334\352J\002\016\262\222\232\354\203t\266\202"
+	.ascii	"\323@f^\215\026\322\331\013.\023\"\363R4\025\203\307`\265\331"
+	.ascii	"\255\301c\300H\315T\016\376\302\005\350\212\271=\370\253\205"
+	.ascii	"+&0  \003\0211\325\001SC?L\201\223{\367v\203\034\006\036\207"
+	.ascii	"Y\231\301\021\337>\354a\\}\330\303\270%\001\307\370\2724qh\266"
+	.ascii	"\370>H\315(X\006k\345\261e\314\022e;v\017\327\004\b\361pw\256"
+	.ascii	"`\225\312&3\0060N\177r\366vHF\270\032\007\200\030!\307\335\214"
+	.ascii	"\375\210\373\301\340d^\264\225\f"
+	.text
+	.section	.gnu.lto_failsafeInit.54.c68c3985d98c05ca,"e",@progbits
+	.string	"(\265/\375`("
+	.string	"\245\007"
+	.string	"\022\31647Po\322\001\240\020\"\217X\221h\300\0240\236@\227\255\254\221\274\004m"
+	.string	"4+\232Ey\314\277\035(\314FXX+df\234\215\354\373\366\017)\026\266\250F6\331;\245\346l:\330E=\331\205\315\017\303B\346\301\246Cv5L\316F\347f\300\332Cg\233\037M\333\246\246\356\253\215%\200\323\007L\313(R\330\247\226\rq\024%\311\250\254x\007Yv\304G@\001\246\335=\360C.\"\341w\\z\"\004\337]\372!\353\022\301\"\245\001\3622\202\237]E0n\330\2576\226\354*\241z.\002\337\356\305\027\263)\211\342a\373\032s6\313\253i\217:\251(\361vwF\216s\207\234\377\323\0132R:\222\3500\243\260\273\206\035\t\343\216\267M`\333\300\266I\013"
+	.string	"3\241\241\037x\311\334"
+	.ascii	"6\361\224$e\025\206\256\341q!\214\227!\300\245\353\264\363\t"
+	.text
+	.section	.gnu.lto_failsafePhase.55.c68c3985d98c05ca,"e",@progbits
+	.string	"(\265/\375`\003"
+	.string	"-\007"
+	.string	"\362\31525`m\322\001@_\002\fC\\\214\226\200\037K\324~H\220\262\322\305\n\321,\352\275 ,\324\211\236\030o\255\220$!uHQ\310\223\"\304\363`kdo)S\n\336h8\025\345\351XT\025?\t\bV\247\212\013\026\245\0207\230'j0\276\0308X\374\\\027\026/\334\376\255\222\254\231\221B\330nxHf\331]\003\037\344\234\203\257q\350\007P^;\364A\323a*\300\307(;\233\023\245Z\330\177\253$\333\351\324J\311\004\323\355Jt)[\002K\033\266C\366\305\347xG\310\331\3432\266\200\n\222\b\021\224].f>0\035\276\013L\207\212\361\354\231\371\367\370;\241\030\3216\321\263r\260\273Nm\233\270\365\266\tl\027\330\276\b\b"
+	.string	"\002\013\255\262\030\005\205"
+	.ascii	"]\303o#F\026\"\017w\305\324N2"
+	.text
+	.section	.gnu.lto_failsafeIsMonitoring.56.c68c3985d98c05ca,"e",@progbits
+	.string	"(\265/\375 \365\335\006"
+	.string	"\362L06Pm\222\016$G\213\307r\300\334R\337\360\263\264\363\207\251y\371\252\326\r\373w;\332\302\356\274\021\257h\332\377\315\314\024)\352Lj\031\002\030\274\314\326\266F\210L\001k2\233\313\352p0\353\212\036\206\005\214sE\007\314j\210\032\255\0233\002g\017\033-z\262L\213\230.\013KC\002\021\234\370!\n\262\001df\302\375\250)\342r\264Z\342\363\312\265\272\037K\253\007\003L\242w\372.\364`\306\227JX\372\337\017^FJ\006L2G\247\225$\251D:~\320c>@"
+	.string	"\275\265\333\030\025\343\204\"D%\263\213P\243[\337v\353Q*\345\002\205#\205\372.\n\231\371\343H\025\035\366/\370\r~\213\b"
+	.string	"\002\013\330\210!\005\205"
+	.ascii	"]\303\377\"\306\022\"\207;gj\347\023"
+	.text
+	.section	.gnu.lto_failsafeIsActive.57.c68c3985d98c05ca,"e",@progbits
+	.string	"(\265/\375 \365\335\006"
+	.string	"2\31506Pm\222\016d,\316\264h+"
+	.string	"\r\333\364\263\264\363\207l.\370\257\326\r\373w;\332\302\356\274\021\257h\332\377\315\314\024)\352LjY\200\030\274\214\326\266F\210L\001g0\232\313\342l0\353\212\035\206\005lsE\007\314j\210\031\215\0231\002g\017\032-v\262L\213\227.\013IC\202\020\234\370!\n\262\001df\302\375h)\342r\264Z\302\363\312\265\272\236J\253\007\003J\241w\372\016\364`\306\227\312\314\034\222\376\367\203\026\024\223\001\221L\321)%K\252\221\216\377\363\227\017\020>o\3556D\3050Q\204\2302\273\b5\272\365m\267\036\245N.H\270\021\250\317\242\220\231?nT\321a\377\202\337\340\267\b\007"
+	.string	"\002\013\330\210!\005\205"
+	.ascii	"\357\232\267\204 \341\316\231\332\371\004"
+	.text
+	.section	.gnu.lto_failsafeStartMonitoring.58.c68c3985d98c05ca,"e",@progbits
+	.string	"(\265/\375 \372\335\006"
+	.string	"\362L04`m3\006\260\2015\0379\0019\001H\301\217%\252=\224n\250\236t\207iMz\345\303N\234\350\305\274]\351\300\032\252i\261:o\244\260\341\313\222$R\246\024\305\254Kve0\332\225M\315\202\202\206\311f\203v1L\214\313LK\240\233\303\205\233\232m\343f\365\33514\211\\\305\304\023%jo\250\366\301\037\233"
+	.string	"\321\177\203\272\303\036\020u\206e#8\320\236e\315\241,\017>\244\n\016\024\017,\265_\007\306\213\326\323c\250\215\t\037\235\f\244\374\237\022\351$rD\243\255\253vm\211?\321\r\2622\0212\372?#\206;\303\256\366\206\001<P\307\320\202\360\277\320\003Q\270\321m\t\332\026\264\265\b\b"
+	.ascii	"3\001C8\343s|\241kxZ\b\343e\bp\351\026\355|\002"
+	.text
+	.section	.gnu.lto_failsafeActivate.60.c68c3985d98c05ca,"e",@progbits
+	.string	"(\265/\375`z\001-\016"
+	.string	"\366\231\\D"
+	.string	"\221(\035\317Z\252\"\232\317\375\237|K\232\217\365\262\177\204\372\030\366\303\243\341\235t\204ie\215\376\227eTTU\277!!\326\3375F2\377\254\001B5\302\344\336\b\\Ddh06B\310\336D\312\224\002D"
+	.string	"D"
+	.string	"K"
+	.ascii	"\351\247iL\323\232\351|\372\001B6\324\3148pb\027\345Uc]/&\204"
+	.ascii	"\355s\230d\3138K\265\031\013\312\311K\315\356F\365p\322\223\344"
+	.ascii	"\277\345[\227Rzf\013v\327\331\245p\270\365\266\r\330F`g\201Z"
+	.ascii	"r\236\203\366\310Mp%\022\250\300\370A\320\266p"
+	.string	"\022\240\016\325\356~\370._\205|\020\177\3160\312w\177\376\b\376)P\231I\215\240a\312\227\315:\245\262\330\307VWl,\275y\351\355\2455,\235=\r\037/FG\363\364\n5{A\2450}3\267\fT\305t\200\r\224\210S\276\234\252\372\223\033\206\360\024\021\264]\223\017\037\305[\022BDD\340_\352a>\254\004\244=\201\202\306\226\213\353\244%\003Hm\317\201v\307\223\357\234\255\026\227I\356xx>\234\021\t\307\371\304\222\n#\034\311'^\3408\240\330\021\215\242\007\001\2070xD\261$\024\022E\016\226\351\272\322\240\205\313\244'o\364\005H\207J\346\035\315\246\033\rP\323M\217Je\252\251\3020x\f\210\306\"\323t\321a\005\325v\360\025\017T\004  p\002!1\343\003\343\200QeF~\356<[\032q\035\3120<%]@%<\013lQ@\364\004s\023\310dQX\360*\344\234\321\326"
+	.ascii	"\254\303\216\006\306\255\341\354\032\255H\336\226m\002N\016\263"
+	.ascii	"r\320#\007\202\332s<\004\250t\213\326<\001"
+	.text
+	.section	.gnu.lto_failsafeIsReceivingRxData.62.c68c3985d98c05ca,"e",@progbits
+	.string	"(\265/\375`\n"
+	.string	"M\007"
+	.string	"\"N35P\215\322\001$\241\252\013\201\336E\362(,\002\002\343\320\017\213\322*\237j\266!{\372h\240\005}\003i\177!3c\006\302\305}\bb\232\t\r\330\337[\312\224\002\266T.V\245a\256\312\212\231\005\205\013c\305\206\253b\210\226L\213\025\2121\207K\0263\030\226E\252\333\277U\221\252@G=\376\265\311U\365\225|L\036?\234C\013\330]\004\177\343%\b\237t\350\bM\236;\3645\223\303+\345\242\324\311\223\335qRG\366\337\252\310vZ3\375GM\204\024|\354\202N$\013\002M\031\26676e\203\203\215\267w\026\240\217<>\035#\273]\324\212o\317\315\277\306!\005I\204\013q\236"
+	.string	"\t\273\353\344B\022\267\336\366\200m\002\333\030\001\t"
+	.ascii	"2\241c\037\030\302\004;T\241\270&>F\344%D\016w\316\324\316'"
+	.text
+	.section	.gnu.lto_failsafeOnRxSuspend.63.c68c3985d98c05ca,"e",@progbits
+	.string	"(\265/\375`\204"
+	.string	"5\n"
+	.string	"\306SH> M5\035$\004\202#\200B\002\f7\3444\227\313\234\240\210\021n\311$\220\017V\r;\232n\300\200\210\001B\256\0370L@ \006\261\004\n\263?Wd\232\315\376\330\213\233\366\255;J\231R3"
+	.string	"3"
+	.string	"7"
+	.string	"\033\217\307\214K\254G\307-\254G\177v\211\207\246=\312\203\002\324\211\335\305\364\301\277\347\347\377\302!\340\350\363\274\004\354\256\023\0341\270\365\2665l\007\260\177\021\341'\325\201}\307\356\256\265d\377\364\307Lk\2463\323\277\"\022BLR\273\013V)V\025AD\210\330~\332\257p\013\337O\236!\273$\016\037v\303\211\003\033\016\232H\275\252\306\016\242\006\241\\\371\022q\317\212\232z\221\020Q\b\271\273\006\357\261\273"
+	.string	"|\f\317\320\361!<:\201'\017>\372\036\353\361\032I#P\234@\271\262\003\227M\3432\002\027M\266\351:\005\272N\205-\224\fS\3512Z\005\203q\016\030\3202\030L\243U\020`\026\256\303(\030\3366\031\207q\266\215\303\"\341\336\261Z\362\200\t*\220\206\254\232\362$\246\r"
+	.ascii	"2\241=h`<\020\022\002\001q\217\220A\024\330\205T\013\006@p\261"
+	.ascii	"\201XM\001wy\321N2"
+	.text
+	.section	.gnu.lto_failsafeOnRxResume.64.c68c3985d98c05ca,"e",@progbits
+	.string	"(\265/\375`6"
+	.string	"\305\007"
+	.string	"\262N56P\213\323\001\200\340\310x\2533\022\017De\037s\003`l\310\236\371"
+	.string	"\324E5\333B\335\037K\036gp\344Y\0242\315p$C^\300\345\033\216%\013D\233\310\235R\266T.\330\305e\262\013\233\033\204\203,\203\315\204\354\322L\313\306\315J\2005\205\31367\232\266M\013\334+\310\300#\354\250\307?\246\262\263k`2$%\222I\344jk\016j"
+	.string	"\241\335%\360/\216\261\340O\\\232\343H\237S]J\216\257\324\211'S\321fh\210\377\256\224\r\213\320\243\236\rzQ#\354S\253 \373\321\257\254\016\020\ni\367\3414\262\241\374\240\260}\313\235\035r0\264\027\215\034D\246\335\235*\361\356\261\363_\361\311\367\361\036%\005\273\353\370} n\275m\001\333\003\266G\001\f"
+	.ascii	"3\001'~\306\232\271\013\266\333\224h\244bW\236\353\271\220\323"
+	.ascii	"\005\353/\343\202K\267h\347\023"
+	.text
+	.section	.gnu.lto_failsafeOnValidDataReceived.65.c68c3985d98c05ca,"e",@progbits
+	.string	"(\265/\375`\320"
+	.string	"%\013"
+	.string	"\266TK?0M\225\016\b_\373\2727\310\370s\307\3468\310\362\247V\027-\333*&M1bf\2209?lg\324\365 \007C\n\373\312PU#a\rU\205\0273(\013\310\221DK\2641\356-eJ\0019"
+	.string	"5"
+	.string	":"
+	.string	"{U\211\007\252\024\273\233\351\204\177\0165?\376O\307\350<\320\341C\302\025r\264>\274\"\236\bJF\026\272\237\236\020<.\363B\300\356:;/\302\035o{\200\355\016\373\005\002\241\214\031\246\315\240A\276\273\002\340"
+	.string	"\202\305)\310\376@\251%\373p\225d?\035\237\206O\353\323\317\200\270FLD\354\216b+\226\025W\027l\037\342\217m\342\237)\242\204\331\326\276A\025\365$(\250^\241F\024\0160p\031\263\215\340\251\355\241AUc\365R\201\272\332\232\177\233\304\264\273\001|\3243,\360+<\232\343\211\276\307\3421v\350\\\001\256L,\027\n'\243Q.Y\347"
+	.string	"F\313\\\262\004\032E\223U6\234l\262\341M\201e\223u\266m\223A\276=\\%\0218\301\n)\007#i[0\371\316z\023\254\345A\265\024\025\252\201T\210\024"
+	.ascii	"3\241\265h`\254\267\272f/\320\346\201\3468\274\021\013\266\233"
+	.ascii	"\225\324\265\022\f\210\373\224\030\244bW\236\353\271\220c\r\266"
+	.ascii	"\274\f!.]\314vh`\n\n"
+	.text
+	.section	.gnu.lto_failsafeOnValidDataFailed.66.c68c3985d98c05ca,"e",@progbits
+	.string	"(\265/\375`\006\001\335\013"
+	.string	"VVO>\020Q\225\016\304\303\260Rph\020\004\210P\315\375\037\311\315\\t\003\271D \022\220\035f\251\211%\315Z}g,U\022{\303 "
+	.string	"\n\nD5B\371y"
+	.string	"\331\032\t\256-Z#[\312\224\002:"
+	.string	":"
+	.string	"@"
+	.string	"\036l\177b\221\375\342\035j\257\342\250\240\222\261\273Q7\\t\250)\362!\026\311\306e\207\245+\205#A\002\273\373\021\317\013\234\226\t\261\354\256s\3432\334\326m#\260]\300\276\205\3719\2226\004P~\273\032Xux\232f\266\022>\302\303\2260!\2779W\034\036I3\273\313RO\366\341\252\311~\032>\255O\347\323\237PJ-\242\213]\f_\215\365\254\025\001\252\272\340\004\013R\322\260}=\005\n\250\337\340\220zU\2656(|\320\362\263\215\271j\023I\245\002"
+	.string	"\361\315 q\26537\261\t\200\332\335\003~\367\022\230\337\341\226\033t,\277\363\270\005;6\030\243\306T2\232\013\304\301.M\f1\330`\034Mt\200]\235\210\371\200be\200=\0172\237\030\362x>q\322\355\341\252)\201\006o\244\032\324\223/\017[\301W\027\001(\025\222\020)\0211F\371\345\356f\252'\030\027"
+	.ascii	"3\241a)\260\205\267D\320\222\036j\021\210k\204\344V\023\316a"
+	.ascii	"\335\005\333\315J\352Z\t\006\304}J\fR\261[\236\013\272\220\243"
+	.ascii	"aly\031\002\270\374\300(E\325\330\256R\006"
+	.text
+	.section	.gnu.lto_failsafeUpdateState.67.c68c3985d98c05ca,"e",@progbits
+	.string	"(\265/\375`~"
+	.string	"E\n"
+	.string	"\026\323F=@\245*\035\240\327\355\212j\376z\367\236\236X\003\350@B\224@\347\235\022{\210\304=\222\264\277\032\266!t\323D\313Hf?\371\315e\030>\201\210K\205\265I\\\234&\327\321\366\336;\2455"
+	.string	"3"
+	.string	"5"
+	.string	")\223\332\356v\323\343\373\346w:\345\347\033\204\245\323J\306'MXq\030\340\302\023U"
+	.string	" K\335uy\021\242\244$\300\354\256%\030b\334\365\266\033l/\330\247\001,\232\306*\364\\\331R\232\326\273\306\032\201\313\200]\325\355\300\312\352\t\210\355\373\257\213\244\223xv\304Dv\227{\265I6\367z\316\237-\340ck\037\263\b\036Q\350\274\353\007\260\031\2146\013\200\2226_4\350%\243\312\3562\370\343a\024\376\307\253+D\362\340\253/\242\274\322y\361rD\025\262\361\022M\362f\217'9\003\326X6\234\f\310\323\311p\272\320\203C\307\303\351\":\031\210N\363\001u\026\004{\022\233O\027\362\274O\307\215&\360\030\323<\201\264@\332\336\204<\3509K\227\226\255\300\234,;\020"
+	.ascii	"2\003\303\341\306X\240j\224\207\001\202i\330\217|\016\017\225"
+	.ascii	"\036[\3432\016G\205\036T\210\227+\200\313\327T\32340\005\005"
+	.text
+	.section	.gnu.lto_failsafeOnValidDataReceived.part.0.86.c68c3985d98c05ca,"e",@progbits
+	.string	"(\265/\375`O"
+	.string	"u\b"
+	.string	"\362\31787@\217\322\001\230\215\221\336\375^\236\013j\005\217\004"
+	.string	"\241Yd\344\226\361\355Q\277^\237\345f!\206\303\211\216\376]G\303%\262\032 `<|\317\246\230\365 {\313\235R\336h8\233\366u8m\233\037\206\005\256\263\315\006N\363\314\215\367M\r\201;\007\2167?]\347\315\3146|\\EY!\305UR\t\253j\3126\006\306{0\273{\2007Y`\244\3045\241$\377 \314\376.\002\032P\355\356\201\037r\026\204\277q\351\210\020\274\351\322\017a\227\227\216\025\017\225\022|AMY\343\343*\312\216\031\004\220\335\212W\313fH\022\016\373+\221\235e\227\377\260-\262\360\310F9K\265o\235P\264Xvw^\252\306GW\030G\376W\277\230N\244+\346tq\230y\004H\330]\007`\334\362\266\rl\027\3306\t\020"
+	.string	"k\023\030\017\327\270a\030@\036\030\341\212Aa\"\340\214X\3249\235\026\332L\331i"
+	.ascii	"\270\366b\312i9\375\3322\006"
+	.text
+	.section	.gnu.lto_failsafeUpdateState.part.0.93.c68c3985d98c05ca,"e",@progbits
+	.string	"(\265/\375`\205\032\345p"
+	.string	"\352\2560'M0N\352\031\003K`\345Cl\337A\257E\321\255\021Ww\253\312\031\315V3\305\245\301\033\232U!\224\207\245\256P\\~\352\371\204_\240fi\240"
+	.ascii	"\020\006\241o\2452\r\225\361]\350n\200\243\034\204P>u]\275l\270"
+	.ascii	"I\022\231RJ\001j\0020\002h\002\\\247d27\367`\277p\325V\326`\006"
+	.ascii	"w\025\330SL\264\225\0050+4Q\200\031\027\250AB\270\f\244'\020"
+	.ascii	"\240V\310\355\244\237p\377\361\262OE\223\366c\316\202\353&\334"
+	.ascii	"}Y\315\307|\003\354\b\224\273\312bn\026z\217y\311(\332\312L9"
+	.ascii	"^@1B[\331\331cQ*\367\302=\247\202\273\256\217\264\222^\241\365"
+	.ascii	"x\231\207\207\307$\003\345\222\273;\240\252\237\034\334\005\312"
+	.ascii	"$H\220h)_\267$\22253\304\004\224\215TAE\333\245\340.\322F\334"
+	.ascii	"\266K!\344U\367\216QP-\024@\331H\241\316i\033\311\366M\333H\""
+	.ascii	"\334\234R\321tZ\034mN\271M\247%\264U\367\2125\343\352\344\030"
+	.ascii	"\337\267N\251\221\274\244l\344\262\221\035\307\314*\242\3542"
+	.ascii	"_\351:\266\267\223\264x\036a|\337\327\251\221\277\366\315\326"
+	.ascii	"5\033\361\313\273M\005\342\303\224TT\023\352\311\251\211iI)\t"
+	.ascii	"\311\303\221Q\021Q\007\016CBA@?>\0334\364\360\354\350\344\340"
+	.ascii	"\334\330\324\320\3140eb\2260/\312d\213d\337\001p\271a\306\266"
+	.ascii	"\232\212\261A0b\361\017\016FF\243\247\330\344\227\230\217\026"
+	.ascii	"\214^a\251\032\021\367\372-j\305\245\034\n\023\271jT\023\352"
+	.ascii	"\260\212?\025Vq\247C@"
+	.string	"o2|\213Jq\246=?F\272^R:L\372c\205\220\004\243O\\p\017~}\304\322X\331\247\277<7JV\345 \323\353\"\275&b\233\240\300\230k\301\250\037[3\215\301\016\317;\254\320\034VX\342C/<\200\b%\253\330\306;D\271k\020\220\022\"m\216\016\276\035\235\026\245\373\237\303\366\3310\027\347\032\016\273\207\247\332;p?\\'\007G\256ox\354p\233\267h\r\035^\223\254r\233c\"wM#\353\3214ml>\323v\346Li\313\260Q_\214f-\030\225\2621\215\317\027\372-z\303c\330$D\026\264\264`\324\007\233#\346\003\332z=\364\0265\363\245\0376L\fQ\240\334\r\261\321\276\220\251\335uZ\264F\362%Y\225FF\243\225Cide\235\024\214\226\265`\313\261\247#\337\242e_\316\262IR(0r\246L\017\227c_\376\3141/V\350}\337\326k\017\033\353r\267i"
+	.ascii	"\222U\357\373rs]\233\003hf\266\311\314&0\353T\003^\003\257n\006"
+	.ascii	"{Y\313@S\202\366\"\275`\207\301W\224\355V[2%\333\033UF\360\306"
+	.ascii	"!\312\301y\224\231\257\374\370p\333j)\263\2139\364EjOx\313\334"
+	.string	"1\005w\341V\275\305\313\215E\366M\266\355\330\314\262\335Z\255\315\207-\237=\236\326\244w\212\326[_\3210In<\255,w\212\026\352\303X\311\3637\203\215\344\253y\265\362[\257a\336\274\177\332\344+\035,\371\037\332\312h\344\254s\355O\313~\033\332\t]\245\215\310\247r;\266\177\027\211aKq\320\360\273\t0\205+\373T\366v\347\332\366;\321\256\212\2277\3069\227;\247|_\257\017\354\257o\271D\f8\340\200\266\221\355;U\361\2011\027\367Oef\255\026\371<f\217v\206^\336\310?\336\266\002-\363\002\rxC\221\257X\307\210\350\365[\334\375\323\376\263\317\376,\343\276v\243\003\334<\030\002\t$h\033\371Ogv(\235+\343\352\n\332~\177\266\313s\257\313\037\271\247p\210\326R\201\362}\337\017\334\213\235\305\002n\036\030xC1h\033\331\337S\332\207\310p\223\316\321q\371\243?\225\037"
+	.ascii	"*\266F-\374j\314SRQM\250V\241\371\251\2114;1\235\233\230\316"
+	.ascii	"L4\316K4\316J3\316ILg$\246\263\007\246\363\021\323\331\310\235"
+	.ascii	"\213\334\231\210\351\334\201\351\314\201\351<\304t\026b:\007"
+	.ascii	"\2713\020\323\371\207\351\354S\343\274a\306YC\017O\215\363\316"
+	.ascii	"\214\263\316\3229\207\351\214\303t\276\351\274f\233\245s\r\323"
+	.ascii	"\231\206\351<C\343\314\244q\226\231q\216a:/e\234ab\234_\226\316"
+	.ascii	"\312\245sr\351\334v\222f\344\322\231]:\277;;\214s\233P\2022#"
+	.ascii	"}_\261G./\032r\357G\347u/\351N\322\255B7\221\304+\326\342\371"
+	.ascii	"zC\251\037b\243\315%i\201h\202\265x\032m\216\272\004\321\243"
+	.ascii	"\375\244\rY\213}\313\276\376\020\005ku\035\233\030\025\033\023"
+	.ascii	"\271B\025\\\242\252k\305\027\213\007\347U\247\32404\225\021\270"
+	.ascii	"\004O\035\033\031\214"
+	.string	"\f)\317=\247F\0062\214\236E\303opnq-\356Z\026\r\337~\255\304\005x\245\343\362\307\243\247r\362\257\250\347\337\220H\251y>\214\251y\276\351\354\364\036\323\200\030-5\317\367|\t;\250\200Iw\276\375\230\037pEg\227\231\302\367}\251\330e\360D\347\343\226\333\325\3256\322\243@\023u~\247\375\330\375r,\356\232\025\277\342>]\026n\230\033\3266R\347\373\257\235H\f\001\316\252\204E7\200\205xD\257\3067,VxZ98\264\231\317\270\247u\250\035[\352\303\\0\b\016\305\301\0161\030\022r\310\261V\243Q\320x\257\210C\205n\225\211\n\f>F>\301\366\331cAh/\316\001\273\365z\002\024\002\267\274K\231\233`\320S\271\271j\313\273\360\351\340\323\0014\310\315E\220\035\372\262`s\013d\377\342+J@\307yMh\263\201\030\205\2410\353\216.\374\357I\316/\233\344U\351~\212"
+	.ascii	"\">}\326\234\270\325\242\276%\f<\242;2\265\rKjDd4s\357F\240\206"
+	.ascii	"\247\266\340N\213\366d\232\034\351qk3\273b3\216< \\\371\266\373"
+	.ascii	"\"\206;cK\240\327o\325\371(\334\371\"\217Po\024\253\316\214\032"
+	.ascii	"Tr\236\312yx3\300-\276H9\262\005g\007\356\316\2352)Q\324\002"
+	.ascii	"\207\304\2552\035\221y\221\205\021\310\312G\310\005\355\346\251"
+	.ascii	"\214\3637R\214\270Se\021\234\377P\345\346\201\254U\246\nFj\330"
+	.ascii	"\330\374_\265LQ\034\314\361KlQ\223,lw\3322\2734|\316\235\312"
+	.ascii	"A\0059d\364\263\036\342V\217\330\274\272l\341\020n\261y\303="
+	.ascii	"\363\206\262\217\365\314\341\232X\241\351\232w!\356\334\t5_@"
+	.ascii	"\314\212A\271\031\344SIS`\322<\263\213\303\337\334\351\021\033"
+	.ascii	"\220d\0364q\346\227O\363<\204`R\346\317\274\320\314\327\312<"
+	.ascii	"\363\201\b\301\336b^\346\373\351\310\345\217T\367\341\256\365"
+	.ascii	"\210\371v\322\246\264\303\355\341\r]>\001\326\0302\264\375\311"
+	.ascii	"t\273?Z\230o\301#gv\203\270B\274\2410\317$\366\"\260\353\267"
+	.ascii	"\306\220\\c\236\312\376\322\215G\262\236!\220\021q\353\216LM"
+	.ascii	"\311\362\251\334\355]\370\233\231\344h2\004f*\352\231UB}\363"
+	.ascii	"\303\326\330\331\2209\\\230\262\253\261iO\316\330\321^\352\247"
+	.ascii	"\304\006\273Y\354\001\211\026qB\004\002$L\320\001\b$D a5\302"
+	.ascii	"\nkf\003\253\022X\"\220 @\220\265\200\007#N\220\030!\204\215"
+	.ascii	"\325\006W\016`Y\205`e\245\001\214\325\t\021'BdeY\215\270\302"
+	.ascii	"\n\301\n\213\311#\232\2548\020\221\365\001\t\021\0348\235\360"
+	.ascii	"\240\003\022\037p\340\004\002\t\021%\234F`e95\375\360U\bVXN'"
+	.string	"\256\256\260\234\226X\272\212\353\273\250*\360''\316'z\335-\234\b\t\364\262Y\322(\007\202\225\212\372\247\017\363\025\375\364mD\013\016*\266F,\037\236\232\304\311\227\213\251Wc\233\260\273\2475\252\331\216\275\023\326\366\264B9\264\375\251\035\233\3321\004\013(O\253\222C\233\331$\251w \207\266\r\213\271\247\325\247\247\035[\347\311\370\264\3468\364\001\2300\216j>7\233\317P\315\347\247\346sS\363Yi\3529i\352\031\250\371\354\323|\356i>\3474\237Y\230\346G9\325$*NQ\034D\341\037\037\037\267H5\265\372^\035]\370 Zo\204\200\214\213/\334~"
+	.ascii	"\302-6}\017\036y\320D\246G\372\246O\022\202I\227\236\311\177"
+	.ascii	"\264\322/\375\017!\330[\322+Q_\207\273\366mI\337\3266\244\237"
+	.ascii	"\352\333\022\330\225\243\231}\212\201Q\036>\207;-z\352\321\033"
+	.ascii	"\275\207\347!\234\246\035}\363\031\375[\021\302\344\212\330\\"
+	.ascii	";s\253LR\231\030M\340\030\360_\321\314\316(N\031\350\0027\b\231"
+	.ascii	"\022B\025}k\341\242\357+\232\027\215\020\037Q\236\210\276\001"
+	.ascii	"\211\236H\306\234a\224\252\323S\271\303s\220R\346N\2253:\274"
+	.ascii	"\024\207\367\351\2536\361\300\222\326(\2020Ma\270\325 \266\177"
+	.ascii	"\301\207\204qq\350\231\235S~\314\235\006}\264\265\"\364A?\364"
+	.ascii	"<GLp\247J\027B\337\326\240\007\321G#\360\001\357v\022RqV\321"
+	.ascii	"\221\301\200{;\255\264\314N,N\031p\372b\004zI\033\005\220\350"
+	.ascii	"\025q\313\273,\235=\330\177Ya\\4t{.w\372[3\213V\330\316E\242"
+	.ascii	"\241\322SY\006\206$\240\377D;\303\004\234\331\231\3059\2037\024"
+	.ascii	"\350\013h!\b\322S\031\007\r\307\243\357\024-\263\035\232?\365"
+	.ascii	"\363>6\202(\340P\034\224\322{\354\274z\027w\252\344\362\363F"
+	.ascii	"Uz\317\347{\257\225\213,\324]\021\273~\313\303\206&\277:\273"
+	.ascii	"\004\202*\250\362\030%\221\302\312!D#\"2\222$\351\202\n\020\210"
+	.ascii	"da\036\307\232\007\022\200$5\212\224\214)\241\231\024\224\224"
+	.ascii	"2\354w2;\255He\247\227|\263Ge\0052\2371n.\330(\300Q\021\035~"
+	.ascii	"?C\217/\335\371\273K\n\357/\264\035\225\034\355\256\263o\307"
+	.ascii	"V\241L\320\220:\243\324\272t\246\016,\026\t\232Xp\360\005\213"
+	.ascii	"\273 \314\342\036\b\022\310y\360\353>>\037I!\b\335\317\241\253"
+	.ascii	"\235\312\334\0038,\273\325v\022\301R\357\300\311Iw\020\303~4"
+	.ascii	"\211\261\313\301&^\b'\357\243z+\025M\211\312\212\334\212\001"
+	.ascii	"X*\246\245\363\276\211\357\020\273\322pd\266\256\273\370G\305"
+	.ascii	"\030M\324\2567C\025L\013\n\377J7\370T\240\213\264\310\024\361"
+	.ascii	"\267\372\t\252\273\207\210tB}\203S\002\371AO\362\272\b\332\340"
+	.ascii	"\314$\271#\344>\331,\341\344\267=\020\314\305\276\333]\235\342"
+	.ascii	"-\234D\276\ti\366\001\322\334\021\322\244\222\027\240p1\027:"
+	.ascii	"_\031\233h\263\302\211\215\317\354\217X\314\227c\262\"P\003b"
+	.ascii	"\373]\b\207\235\321\t\016\327\333O\nb\220}\tl`~\373-vP\307\260"
+	.ascii	"\333\371O\230\315\355*\322\"#\233\241!\212\261\354\354BE\247"
+	.ascii	"}\022\306%<\b\350\337.\033,\321\205\355L~\357\"\260\363E\240"
+	.ascii	"\003\240\254\350\370c\301\217dd\354\3229i\2147G\250_4^F\bmW\301"
+	.ascii	"p\207\006E\315\270J,\016\273X\310\025\n\274\3369z\312ml\375W"
+	.ascii	"\320\235e\2375\237\216\020/\f\237\337j\343\233q88\306q\212\367"
+	.ascii	"<\236\024\370p>2L\316E\032\211\204lJ\326Ymhj\331&7u3~\005#>F"
+	.ascii	"B+\210\023\341\0131l\3624\236\203B\261\262\277\243\273#6\331"
+	.ascii	"<"
+	.string	"=\207#\376q\226\263\357\356v\336\314\016H\256\200\211T\222\313.\221\273R2\207\361>,\255]n\373\360\016\271\264!\224oe\336\b\021\357\002\254\226e\243\253%\361\235\r\276oP*8\222]q\f\314\324\211\\\241\374\201\255IS\353NN\352JY\317\311W&\230\005\306~\375x\013F\267\272A\203\334\252\020\366\366C\324g\321\355\031\0043:L\3116\017\033\025\022@n?\230b\317\343\020\346\333}W\317,\t\n\360\266\r@\326\004\234-&\352;\3205E\243\241\017b\254\n\235U\024\305I!\360K\030\016H\206\013\233\003\331V x\\\251\237[\273\251\032\376U\233\213\316\370\346\351j>\271p\252\362@\241\223\374\016r\362\302\033\206\203TV!.\221&\334\302\344\016\r\334d@IL<\343\2137\216?A,W\263\246\243`\266\"\316\203\037}\310?(\f|\242\345\365\2607/\206\342\367\003\224\317"
+	.string	"\371\372\300\311\330\352\207m\271\265Q\336\236\212Z7\254\356\006\255\335\003\341\215=!\303\241i\201\272\252\360(\035\257{Z\262\340R\3671\005/\361>:\215\005\216\3602qp\2739\bC\217\3008q\001D\243\265#`\226}\345\354U\b\2261i\320u&\373\270\342X\020@-1\003@F\t\215\363\214\007I\360\024q\013\013\230\221\231l\027p?\264Q}v\tsU\b$\214>\223<\234\036@T\246s\301Y\212\233\32749\334\314F\256N1\251\356E\225\304\213HL\021\372\237.\335\205\016\0315\202\220\332\035<\b"
+	.ascii	"\203\200\266\321\334\305\244T\005H\376\026\305\025`\376\230\025"
+	.ascii	"\311\305eI\263Q.\371\302\311\307DMxL\006\240)w.#t\rh)\263(\026"
+	.ascii	"\363,\274~UM\262\242\375n\344\351\224^/\327\005\020\366\\/y\257"
+	.ascii	"\362p`\232\274\235?E\244\210\242\016\277\326\200N\\\214\361\324"
+	.ascii	"\037\272\340c.\006\027\005Y\210\b\341\260\274\322\207\203\033"
+	.ascii	"b\264\374`\3679\036:\3513\032c7l\346\217\363\367\233\302\\\265"
+	.ascii	"o\275\323\200\314>\353A\256\0276\n\312;\300N\331\315\376M:\305"
+	.ascii	"\303\361\250\303e\253\363\362\320\367\202\037\352\211p\250\315"
+	.ascii	"\214\334\006\211\246\206\321-?\312\256`\366\003\3552H\n|\224"
+	.ascii	"\225\342\210\204l\354\t\007"
+	.text
+	.section	.gnu.lto_.symbol_nodes.c68c3985d98c05ca,"e",@progbits
+	.string	"(\265/\375`[\003u\020"
+	.string	"\226\232dH\340\262(\035\220\306\210\nM\374Ip<\n\332+\3559\244\026\b\253\244T\234\201|\016\342\330"
+	.string	"\370\331\223\272*O\377\3457\277\304\006X\234\030cH6\224*\b\275\303\270\273\327\024\375W\257\3735L3\202&n)\211L\001O"
+	.string	"S"
+	.string	"Q"
+	.ascii	"\007\3729\006ZB\201\216\220\322\017"
+	.string	"\bt\fJ\257N\032\006\325/['Y\234\332e3\035\250\364\032\320\3441\340*V\033\"\365g(\331u\263\244\177c\373\207Q\n\356\257SF\025\370?Dv\235\304\371\373\367\t\241,\245\224\242\206\260\375g\n\001\377Y\365}`\3724^\372:.\375\031-}\031,}\036\007\375\035U\037F\203~\217J)\377S\220\225\376\247\251\025\370sp\301^\030X**\370\313\300df`4/\032W\005\226\206\324u\202`\300\002\027\264\300\373(\341\325(\350\277H\320\227!\350\273\b4\226\211\2675O\274-\017\305\333\3722x\252\222\263\237\310\353\232\212\3221\3039\341u}:rc3#\361\276\246\222nP\b\225\360\276>\2155:?\"\357\006Z\344\3550\365<\"\274\235\022\257\007\232r=\265\026(\274\023vu\306\357\314\350\033\323\001\267\240\253Xm\210I\"w\342V\203Tc5\036@+`SFV=^"
+	.string	"&\274\"S\271G\n\034\221\227\223\351\266\302\306\216\363\222|*\362\311HD\336\001'\224\205\200\2308\257\350\033\361\212h\032slr\224xM\235I\246\001F\250\b:\357\2056 \320\002\251\232\222\007\"$\030OR\265\007\201\314$y\306(\332\224\270\265B\250[\021\026\206\366\206^24\001.0\3031\360%\347n\220\336\207\261&A\022H\200d\220"
+	.string	"\t\220"
+	.ascii	"\222\202\344\017\032M\226n\022\301\240\f\257\306,}\343>\203\333"
+	.ascii	"\311~\231\375G\210?\3027|\343o\370\206o\360\215\376\330[\344"
+	.ascii	"q\3441\006G\212,\265\tP^\334=\320PRH6\227\001"
+	.text
+	.section	.gnu.lto_.refs.c68c3985d98c05ca,"e",@progbits
+	.string	"(\265/\375`i"
+	.string	"\375\006"
+	.string	"\022O'*pM2\034\037\034\013\251p\257B\247\252\252\252\252\252\f\252*\216X\023\300\337\023\"\210\023c#m\250\021\322\032!\204\354-S\n\016\254`\033\201Rh]g\226\315\252vR\2521s}\231[\244\310\312\224)\360\006\274\231wz1\003\274\226Wz\237\251\363>!IOLJHFDB@><:86^5V30\246^<\253\205\243\024\357\304+1\215x!\336\207\327\341mx\031V\2057\341E\230\036\274\006\323i\215\032}\246\252\321w-\250\275\274\321Zy\233\351\336_G\257\b\034"
+	.string	"f\b\236ZA\300\371\026\323Q5\275#\003\340"
+	.ascii	" \020\034K\2658\330\235\276-8\266\305x\032t`\207b\f*\223\257"
+	.ascii	"\354\2001\236&\300\016\030\003&\300N\2461\024\233[\213E\2645"
+	.ascii	"\237"
+	.text
+	.section	.gnu.lto_.decls.c68c3985d98c05ca,"e",@progbits
+	.string	"(\265/\375`H/\265\311"
+	.string	"\2328\351DX Ja:\215\001\220\333S\007?\351\013\315\361:\312[\204\235\354RH\032|R\272\314\016Z~\235\371;\367zP\220\312\327A`\241\367\226;2\031\302\306\326\242B"
+	.ascii	"\320\266M\006]\226}\367\367\244\020,\3030\b\206~\326\270\353"
+	.ascii	"\212\323\257\344\247s\250\241\262m\245\2242\005\254\003A\004"
+	.ascii	"u\004\333\272%\031\320\205\345\326\270\305\373d\335\202<\340"
+	.ascii	"KK\334mqk\\\027w{\220\345\007\210\226]\005\202\354\223\225\350"
+	.ascii	"\347+\375\354B\037\323\351c0\332(M\223\300Lt\007\226\350\274"
+	.ascii	"\306\353d\233!\356\361\022\221\323|\222D\337\2068q]\235\rq\036"
+	.ascii	"\357\320V\216\235c\233\037l\035.\206\355\257\2379K\346\300\271"
+	.ascii	"\371\270J\337~8m\235\375p\376\302\321O\263D3|\bb\332\220r\341"
+	.ascii	"\315\231\316\023-]FK'\247}\234-\301\276\330\214,\263`\305A\261"
+	.ascii	"S\316\336\230\034m\261kR\236\024\211\343\322f\3010s\271\213r"
+	.ascii	"E$no&\033\213\306\226\261p6\316\252\261m\354\031\353\306\316"
+	.ascii	"\3315\326\214Mc\233V\316\212\271\035c\311<3\367>b\341\372\212"
+	.ascii	"a\211\225\263_l\030 #s#wWB\366\255\230\231M\303N\220\272\354"
+	.ascii	"\352+\356H\213\320>^\035YV\371\255\225+v\r\350\310\334T\273'"
+	.ascii	"]\266\313\177\364c\260\201\225\263n\026\f\250\310\334S\347\325"
+	.ascii	"\020\0333<\203\337\206\335\312Y5\273\206\235 \367\361\312\213"
+	.ascii	"\b0mW\326\350\366fVPT\201\316\017:\264 \036\362\275\300\211\266"
+	.ascii	"oV\006\333\354`\301\334z\261]\256cdn\346\336;\310\312\005q\242"
+	.ascii	"\272\371w\211\366\300\336\266\303i\353\352l\207\363WK\337\373"
+	.ascii	"\202\026R\352\"Kt\376F\351[7\372\326\213\2765\323\267^\372\326"
+	.ascii	"\207\276\215\241\205\334,\321id\251\354\034\231A;a\326\360\030"
+	.ascii	"\273\371\326\250\217tf\321J\320\332\3327_\2053\023l\331\317\024"
+	.ascii	"\033\224\233\233\357\201\266Q\254\024\333\264d\277}b\305\236"
+	.ascii	"\303\224[lo\346\0176\332\340\202v\363\355\330#\260\332\033|\203"
+	.ascii	"\2765:\203\254\321y\255AX\2423[\r'\b\353\344\267^\366\313\202"
+	.ascii	"a\250(\345\036\333\2339\264\363\272r5v\263\005\273\266\211e\336"
+	.ascii	"\202Y&\307`\203\373\034\367\327\336L\013\226\3676Z;\001\220\265"
+	.ascii	"\023\350X1b|r\346_}\246%:\265\325\260A\006\356\005\030\260Y\377"
+	.ascii	"\275\200\r\322\373\355\217k\201\252\270\t\376KA\005<\250\360"
+	.ascii	"\277\016\256\350\n\340\277\331M\341\277'\374\227\002\377\315"
+	.ascii	"@\251\302\217Kt\330\321\363c\005(\233\234\347\307\016XS4\001"
+	.ascii	"\b~\\\374-\215+\201\007\3758\001p\326\347\307\035\b\361\335\217"
+	.ascii	"Y\274\271\201+\364_\024\377\335pC\220\273\021\370_\364\017?>"
+	.ascii	"\300\326\322\177\271$@-\364\3741\357\177\0314\327?\276\300\377"
+	.ascii	"\2713d\376\233\371\237\346\177\334"
+	.string	"\1776\377\341\376\267\371\355\211\377k\256\211\373\301\r\360?\304\177\024\356\341\307)\374v\312\177K\374\367\001\377e\300\177\027\360_\347\307\032~;\364[\241\337B\360[\016\277\005\300o\211~[\364[.\377w~\314\344\277\370\277\273\377\236\377\315\377\375\177\357\177u\376\273\323\301o\317\374\266\356\267sn\002\376\013\375\231\203\377\216\370/\002\376{\200\377\206\370o\001\376;\200\377~\370o\207\377\022\375w\350\277>\377\345\371m\333o\315~\333\343\267\314\337\352\370m\223\337~\375\226\353\267[\277M\362[\255\337b\375\266\310o\207\3746\310o\201\374\326\352\267\312\337\356\370m\362\2676~[\365[\017\374/\373\217\366\277\311\1770\277\235\372\255\324oc\374\026\352\267O\2775\376\247\362\333\017\374\226\305o?\374\326\303o%\370m\004\277\355\360\377\315\177\272\377n\3763\377{\360\237\355\277\206\272\272\272\272_'\316\317s\342\027"
+	.ascii	"]w\001\0031R\356\031\027d\251IZ\260kA\307\031\0347\343\037:e"
+	.ascii	"H6\267\233\377SC\377\347\311\252\211\255\356\266a{\212\347EQ"
+	.ascii	"L\016\272\275\261X\020\324f\213\007\221,-`e\013=z\210\211Zb$"
+	.ascii	"J\030m\240\350\373\f\311\201w\344\300U\347\336\226\251\234B\352"
+	.ascii	"\320\201\253t\261\210\213\217d\322\350T2\243\215\215\233\357"
+	.ascii	"#C\277\307L\362\266\211\223X\206\212\255\3138A\305md\322\202"
+	.ascii	"\035\037I9OVl\3346\261\r\214\f\201\271\213@S^\274\264\3506r["
+	.ascii	"\360\036)\372\230\n\3178\246\361&\246\201\253\364\336\233\002"
+	.ascii	"j\274\264\270v\022i\204\253\216\306g{\320\371\222\344\b\331\315"
+	.ascii	"\357I\352\377\267\3476\"\367\3363t\230\033\351\344s\253c\255"
+	.ascii	"\321\377c\261\245\340\177\336\370\277\210\022\230\3338\3675\247"
+	.ascii	"\221\240\031u\034\304\376\335\366>Z\025\037`Eu\264\272\001%f"
+	.ascii	"\265\213\307#\305!\344\266*B\211\355=\264\217\307\342\t\345\036"
+	.ascii	"\202\022\333T\373\351\013\225\335L\253\342>*\367\320>n#\b\250"
+	.ascii	"\243\025\025\224\230\221j\bJ\314\212j\213Ym\241}4\"_\0347"
+	.string	"rh\213Y\251\331bJ*!(1%\025\224\230\225\021\233\346E\027rF\232\257\037m6\013\352\270eH\3550\"\205\334\240\230\312=fo;\326b#)\330{\207\0229\306x\303\2469\271\311p\232bT\332\016RNW\312}t\203J\242\334;\211\223\322\226\322\240\310t\333B\254[\321\205\035;\252\305\336\021H\355]\264\333m\357]\334{\357\220;\230{\347\020\202ZJI\355\235,\222\332;\212j-\366\276ce\322\250\240\304\256\224GjQ\304\226\333\005\263h\227{\214\025R\213\025\235\354\250\275\267]\243\227T4\344n\306S<ZZG/o\032K\025\365\224q\303fS\3210p\f\273f;Eu\301p\201\241v\2249\236\030\265\\\034\361\223~{\363\203\215\307\021\033}\244\262H\001s\363yb\340\"\336u\226\251\\\"\347\346\337\272\377\312\271sl\030\253\334\373h\237\320H\315p\363UZ\242\223"
+	.ascii	"V\303y\341\034\375\306\001\242Z\002\205\354\346\241\031z\230"
+	.ascii	"$\233\214u\201\341L\027\231\245\225\257.0"
+	.string	"\226t\313\260\"q\226\027\n\353\215\0171 wK\271z!\226u\225p\245\211\263_M\270,\217\314\020\307d\213\033r\267\234\245\226k\345\262]\271\313\345\216\271g.\233{\345\246\271s\267\315Us\263\33477\206\273\345\322]3\327\315m\273q\267\313Es\277\\27\314]s\337\256\227\353v\305\3342W\206\213\345\202\261\315\013w\251\374\256\335\033\304k\214\205\363\037\225\221m\020\226E\310\335sn\220\377\210\3546\313\236`Y\302\335\263\253\346\002\330\362\022\231\322\\Bq\362\343?\212b\266\224r\233S\240\300\266\020a\322\026\366B\235\225%f\342\256\\\200\261\274=\224w\003\025\205\266\323[\324\222\313\026\232\345\221\331X\034\334\345\2023\002gy}\300]\253]T\243AV\026V[Q\005\347\215\246\232\027\022\310\030i\211N\f\340\364\257\332\326\300\346\260CR'C\356\346\213v\364\233\246\341D&\231{,"
+	.ascii	"fV\324n\336\355\204\321\337\251\242\277\023\246\277\003\203\376"
+	.ascii	"\216\215;\226mp\371q\344\346\357\310\320\327l\364\365\233\276"
+	.ascii	"\226\242\257\273\3645\226\276\276\322\327<\364u\225\276\216\241"
+	.ascii	"\277\203\243\277{\323\337\225\351\357\270\364w=\364w4\364w.\364"
+	.ascii	"O7\372\247\027}\265.\022\333,\272I\2768\311\330"
+	.ascii	"q\363O-\372\003\273\316\026\235?\317\364\317/\375\323J\377t\322"
+	.ascii	"\3271\243\257\263\246?\266\245\257\303C\037\213\216\223~f\243"
+	.ascii	"?\006\214~\334\025}\272\034E\223h!\204>\256\225}]\036d;:\354"
+	.ascii	"`P\353\001D\207\321\317\2330N\\7\307\255q\256\301h\001w\3633"
+	.ascii	"\2201\005\306\215\201\266\214:\353\"e\026\267\367\255\2723.\325"
+	.ascii	"\245q\223\367\306\265qq\330\346\255q\247~\221\266\312/\034\033"
+	.ascii	"\347n \274w\013lK\250\0277\310\214f\026e\354f\237\251)\"\312"
+	.ascii	"0'O\310-O7?;\3713\323\3029\353\260\346\242n\346\261\032\316\334"
+	.ascii	"\344\350\031\354XEv\344\346\235\314$\177\211\211\262\245y\363"
+	.ascii	"\363\327\237\275.\f\2373.P\200\334\254c5\234\366\311\321sWv\241"
+	.ascii	"\315\224\326\022\031N\322\310\236p\341\2663\256\27067ge\345\255"
+	.ascii	"%\306&sn\2165mC\224<o\361\314i\241\246,'!Q\206\310\221\2333\222"
+	.ascii	"{#\206\326\f*ZeXXlZHr\3209\t\222\346,\t\021\"\331H\021\210\242"
+	.ascii	"\\W\234\244\355B\326#Y\344\331\bVC\222\t\203\243\250L}%\271!"
+	.ascii	"DH\226\316\326\f5(7_\303\323\013/`-8Z0pe/n\302pT\371\361#\327"
+	.ascii	"(R\026\325\030\201y\021\223c\207\306c)\025\326\243G\276*R\026"
+	.ascii	"\345\214\330\214Hr\354\\i\213\022re\305\243c9\305\353\346\354"
+	.ascii	"\303\247N\314\033\330\315\207\240*+\343\350\320\221ylX\263\302"
+	.ascii	"\252\002z\003\002#F\336\361\314#\310II\021\263\027?\\g\300\340"
+	.ascii	"H\273q#\343(B\342d\313\331\230\234|\306a\353\274@\331\322\002"
+	.ascii	"\211\325\323\232/\0324r\r\007\250\211\311\301\345\346\312\220"
+	.ascii	"\032\271\352\271\306}\272C\254\240\271a'\0373V1\276\020\321\227"
+	.ascii	"\221ed\252\263i\034\222f\224_\230\201I\231L\225\221op(\345\334"
+	.ascii	"\234\247~?\244T\271\371C.\364\207\266\376sT\216\3022\212\204"
+	.ascii	"\366\276\242K\323thaI8\267c2\266\211\3352\214#\247m\354\272 "
+	.ascii	"\253h\227S\204\334\234_\354\214b\302d\351\242o\277\3400\032\270"
+	.ascii	"\2704f\342\326`6[]\342\342\360W\231l\304"
+	.string	"np\235uK\n\355\343\031\335Q6b\271\273\273\306\0343Tv\221\237r1;\345\026\266\231\215\270\315q\031l\346EG\331\210\325\220\t\232\363\222rC(\303\375\214\007'\250\020\232\240\231\223\267m\342\272\02717\256\303tX\216uK2\367\214\03639 [\035*\370\221\223a\214\216SN\034\240)\314\027\326\334\214\341\354\2227\330\236\300\336\330&\236A\263\341R\203\3633=1\f\271\372\322\027\332\322\027\022\242\361\234\006\023\307\243\355J_\250\207\276PR_\210\206\276P\f}\241\026h\360\031\0351-smg\356\033\227(\247\233/d\324\327(\f\036\023\324\225\006\244L\f\tC\272\224\335\234\301\\6\254\245\224\f@c\2164\235\274\351\224\325\315\341\270\031\177\321-\202\346B\360\3608\353\241\343\346\343/?N\273?8P'\307\315\315\027yt\354\245\247\355J\034\330\026\264c.\027i\321p\233Qr\323"
+	.ascii	"\221\345\343\rJK\362f\246\306R##y3\316\202\331\360\226\177gg"
+	.ascii	"-\352mG\025}\254\205'\310\027#Jn\276\366VN\034\3031\226\177g"
+	.ascii	"\367\205<6\321\364\261\025|\345\337\301r\266\254\275\270\371"
+	.ascii	"AU>`\306\307\222\233\361\232n\021\304\025b\247L\330\031\"7\037"
+	.ascii	"\257\375\230\312\275\302c\032\330\373x\243t$\323\334\fd5\234"
+	.ascii	"8\355\350X\355b\215\261\261\335\374\023\204C\337.\2618\3146q"
+	.ascii	"\0306\323\201\332F-\022H\324vX\220\217H\312\346\246\234dc.\242"
+	.ascii	"0\223PfMn>.\373\255\025\374\004\223\371(\367\236\222\225\315"
+	.ascii	"*9d\270\351U\005\244\b\363kG\r\216\222\0327\343(X\312"
+	.string	"\361\030\206\202\3074P\356m\304cAq\3666\006Y;\201\265\023\344\256+,\2623?\250Jcpt,vrU\361\361\346f\273\201\3440\231p\226Z\260\302\2745i\002f\313r\347\365\305kHZW\027\376\202\202\026\227\024\322c\215\327\361W~\003\0133\346\346\263\261kg\333T\234\031\276\270\270\262\370\360\322\242\343)\233\261$c\265\265\205\253l\003\236\310\211;\227W\316\034o>\020\214$I\260V\b\333\001E/-\256\235\332\024\2708otV\026\326\na\003\223\254\263\n\335\\\235\026\330N\026\222\253(\031\216\374\b\306\332I\356\242\034\001\274t|\360Pb\335\214e\323\364\226\266-mW\212\0249[\366\340\370\322$Ks\310\220\"\030\212^ZtF\252`\230y\005i\342 \267\016\204\0225fZ\370\331\242\202\303J\351B+\023Q\210\302\004\213 \221X\202\205!\t,>\020\241g\002]\321\013\201"
+	.string	"@W\0221b\b\344\200\362|R\224\210\242*\316t\b\202\252\246\240\002\001\220\016}#|DK\351\371\003\022G\024\241Jj/\365q\370\r\005\207\351*\034\372xB*\023\nL\276`\317\307\341J\"T_\007\b\250\200\002\005\023%x\0208Q\302\b<\023)x'\240\030\372\225XQU\310\244A\210\n]I\304\b5EW"
+	.string	"\323_\004+O\035A\253\300`\020\270t\262 \016M\254\304\021ID\237\220\t\204\025U{\204HWG\345\371\254<a\022QG\230D\304Jk\222\020\r\236(\007\200jVU4\375\375z;\026\304\241/\247+\021\377\207E\272\252\300$4\005\357\207\n\223\200\301\336\356\207\252L\331\207\252\273\367\326\336\217\227D\024\001\024$.\241($\021\003\220\366\224|YE\227z$\230"
+	.string	""
+	.string	"t\211IES\374\204(Qe:\241)\205\260\204\024\035\326\264\267\236\200\252(FPQ\254@!\n\237\024M\251/=\327\240+\211\360\361\320%\340*dJG\370\004\320\243a\355\375\210)D@B\304\232\366\210\"T\020\226@\301\022\272\252,N\370\271\357>`\212\n\321$}\r8@"
+	.ascii	"\007\0354\355\336\201\007$< q\276\003\017\216\216<\340\340H\237"
+	.ascii	"\203#\274\362\204C\265\207\246XJ\207\"p@y?\024MC\025\273\240"
+	.ascii	"\212\236\n<\221$\004.\245\275\r(OM\352\005A\030\272\222\210\246"
+	.ascii	"tD\022QCS\312C\354-\371R\235\024\375\001W\fS\342\017mJ\203=`"
+	.ascii	"\212\252CMh\220\310t\002)\330S\342A\177\300\224'\004\202Xy\273"
+	.ascii	"\244\036\nC /\211)H,\032\372\t\201*xkO\345-1\245\353\n(Q\225"
+	.ascii	"\300\007\r\366|<k\212\256\020\002}\351\017\270\244#\004.\351"
+	.ascii	"\025|\250\222\257\251\267\244\203T\023\301\336\n\341\020\270"
+	.ascii	"\366\202Cb\212\256B\024\276\224\203\212\242i\022z\002\r&\tK,"
+	.ascii	"\365L\254 \"A\200\002\272\366J\240\277\341\b)\260W$\004\372P"
+	.ascii	"\225\211\207\n\205=%\037\257\211\251\307k\352-\005\251\3510M"
+	.ascii	"Q\242sEU$\244a\317P\007$\244\341\312\344\013\200\nl\352\361\222"
+	.ascii	"\230T\240\277\225\211(\004r@\211,V^o\0050E\177\036\322\341\352"
+	.ascii	"\353!\361\206+S\217\227$\004*\255\303\341\222\312\363\245ED\036"
+	.ascii	"\0221\310C\227z)\022\317\227\252<\240\252\246\035~@\336\n\024"
+	.ascii	"2\375`\020lJ\325\240U\355!\361~L=\025<\225I\205\n\224\nU^S\312"
+	.ascii	"CU&\036\222\232\372\202T^\022\020I84!4\304\3020\310"
+	.string	"\223"
+	.string	"\b\ti\210\376\206K<%\337\ndA\335\200\246L?\3247L\211<\b4\213^\020\375\361R\016+\257\203\335/8TR\321Ti\345\255\340\003\256*\257\350J\037>$\242\351\210u8LG\364\250\274\225\307\301\321*\004\356\324U\210\256@\317$!0\035\256@\341p\211\007]\001\\}\275\023M\231R\026)\272b\350CS\244\033R\020\005\201=\020~\300`o\205\006\026\206\"\240\301u\035\246J\353\320Z\342\207*\251@!\020\004\364\203_\220i\250tB\222\020\370\023\366\202\035\210V\036\006\031\254B \223^Q\025MM\370\r\201)jBo\355\235hJ\221$\004\256"
+	.string	"\242>4\225"
+	.ascii	"\345\231\020\204\252=%\242\016\312K"
+	.string	"A\364\243#\023 R !\002\332'\002E\352\251A`\017i\304\252\224\004\f\"\215\020\002{K#|\251:B\204\007t\355\255'\254 \004\212\320\224\366\004\207\303\017x:[\362\026O\024\030\314\214\261\031\271s\312\326\310\240\005k} \027\365#\013\220\235d\334\034\030\226+\237\235\246\311\214\030x\250\351jS\344f+Vp\225\006V\262\210\254\255a-\273\221{\223P\333\320\"\233e\263\254\266S\344\261\321\226\2542R\313ijzT\261IC{\242!\206\b\226:\r'>\312\334|v\247\376\275wP\2177p^n\246d\034@e-\310\346\312pUn\342\brEF\205\331\320\224\300\320\3145l\360p\253qs\216\222\245<\217=\217\335<\206\353\352N&2H93\223\331\223\326B\263J\f\007\204\004\250C\203\264\211\232-9\305\0202CB3\232&\215\001\323\024@@hh2\030-\303\334\r\023"
+	.ascii	"S\310S\242 &\225A'#\022&H\nR\250\f{\006\005\327-\373\f\030\200"
+	.ascii	":\t\231\026\221\311\241v\354\211\303G\"E/*\323\263\006\025:\310"
+	.ascii	"\244E<\fD\277jcB\246<\254\217\365h\031\024\232\b\207\002_\300"
+	.ascii	"}C\212\be\226l\032\370I\221?\304\317\007\377\b\nl\202(\007\303"
+	.ascii	"\2678\027\220\324W\025\215\237\326ij\344)\036\325\367\032\362"
+	.ascii	"\275)\344M \234\211Gv\320\255HxzgN\265\347c1#\223\257\2007\375"
+	.ascii	"\244m\324Q\025\374\373\"\210\305i\211\354\001\272D\351\267L\205"
+	.ascii	"\303u\337\206\372\211X\017H`\036x\355V\330\365\365$\225\362\037"
+	.ascii	"\230\251\270\2267cK\206\317\312\305}\021\355AS\251c\025u%;\270"
+	.ascii	"\013\374\307,=+\027\254\206[\377\304\t\262A\304\360\317\256\311"
+	.ascii	"\333\317Rw)\273\276\304\276\342O\2309c\005\332XQ\350;|+\245\023"
+	.ascii	"\022U.\245g\365\022\311\341?<\341Q\377k\355\004<SB\241\032$v"
+	.ascii	"c\331\344\365\rn\227C\344;\031\353,\035\246\005\327\n\003\230"
+	.ascii	"\264\317\324\032\030A\304b*\327\333\307%$\276\r\362\036\f\331"
+	.ascii	"\343Pp\371\332E'\201\275+\310\003\333f\273\033\363\032\004\203"
+	.ascii	"\315x\"\371D\275\231\356\225\333\237\0136\213\260i\221}\235\237"
+	.ascii	"\276\257D\350^\n\251\371\220\006 -\332r\031 \233\352\311\232"
+	.ascii	"\362\b\035\022yhc\035\013\221H\352x\031X\227\223Q-N\326\324\321"
+	.ascii	"\220\\\347\354Ej\376w\034\242+\275\023\331\256\270C/\316o\246"
+	.ascii	"[\037\233:\356\2178\377\235\252\n$\026B&^BX\207:\341\275YS\231"
+	.ascii	"\242\310\005\250%\3427\357\323\231\301\347\335\241\236 \206\""
+	.ascii	"9'\241\026\300\254\316{\f\230Wv\220E\032\374\317\303\271[\225"
+	.ascii	"\265\023\277\307\331y\224\027\023\306\216%\3741)0L\262 j\252"
+	.ascii	"?4\007\305\345\357\317A1f\352@\213\371n\321\313\275>y\203\233"
+	.ascii	"\177\240z=S5w\266\002H\325\215\323\n\313@\005'\250\304\311\322"
+	.ascii	"uI\235F\347v#B\265z1\265\255\\Z\326"
+	.string	"Y\0210\357\325\f\3374\354\001J&#5;\375\342\244\340\240\272\301\004\226\347\2072P}\247\016b\306\023\226\342\274\315\017\340&\300)S\370\f\325\205\177)V.\244ch5i\035\263\310\375\377S\234\353\200\t\307?\332\344\365TR\r\212j\325\301\271\326\340\357\240ke\315tN$\255z\257\232\210\267\330\r\02726\001\255\245\205\321\245-z\223\221\365e\230\377\021\332iW\215\374\226\307O\310[\377\377i\t^\246\214q\302\254\252}'^\214R\336w\277\3449\"d\002fK\364\253\b\340\020\200\f\324+\332\314=\344\026\342\3334\032S\376\340\f\027s*\177ko\347~En#M\256\271e\207V\231\206H\022\310\342\203\013\210\242\007\231s\376\r\254\217\363m\n<\244\226~-\013\350\263\030~I\313R\036\301e\236\003\246\326\025\001\025\262\352\007j\371&Zrf\322db\220$\306\f\364\024\005R\005\372"
+	.ascii	"N\371\315\032\244\002\247\t\330\"i\210\372"
+	.string	"B[\200x\264d\2252\230\277\355\025e'\262\316b\353\024%|\004\332\234]FG?\3743\253\207\357V\002Lx\302~+\302J\301\341\001\224\023E3\371P ew\2139\370\243]\335\277>e\034\364\303\222\247\177nv\250\302\222$\212\262\210\200g\261\303\245\\\271\n\227\275\201n\024\302\215\t\340\373\031\250\023\2557rZ\374\241\233\230\\\353?\203\305\0358\207im\367E\rQ\237)D\035\236\032\270{\376C\002\211 [\tP\"\340\225b\276l\203\003q\001\367\234\253\256\253\326\230\327\252\035\272\336\235>\352\332\"\265.\212CC\341\243\002)\251\275\210lr\037\341\375\016\360i\035\343\f\001b\350j\274\207tR\317cq\347\335\263\356\031\237\246:!s\210\343\3758N\006{\360#\212\260 v\3263Q\267\013\275\307\303R\352\244\325E\342\261\317\315\352+\006\030\256\310y.\203\331\350\355\323E*\3770\310"
+	.ascii	"PFJ\251h\373\f:\271t)\320\330\360\365J2\023\245\270=Xu\241\354"
+	.ascii	"j\251\314\323X("
+	.string	"G\177\216tD\023\351\025\030\254\201+\346t\204H\216#d\214\315\332\227\232Vi\312\001\351\271D\227\311\023\246\233\020\333\250\221\024t\227h\205\211\3214U9Z\226D:\001EDQ\253f\274\366\021w::W\233\342\346jgO\226\374e\351\315*z\016\322\225\320\374\223/\242\245\241eU\350|#\352b]I\222\032\\e\350\265\217\031v\030h\354\353p8p\346\013\036'\211\376\322\261-\321_>l\213\361\332\3411\365Z\231S\033:\344\223\034h\312\234\233\257h\032\322De\322\b\327\375\207\274A\024\250~G\017\177\255\263\200\314\344\327\023\232\372Mr4?'Kh\016\253\005\324\253\274-I\217\tk\001#\344L\317\216\301/\272\342}M\016\212\303\3204\224\365\370@\025\357W\034\375T]8b_`$\230\002O\231y\373\250'4Z\220v=\n\363&*\333s6[\301\r*\305=\301(\370\r\232"
+	.string	"\013\2410\261\312.\213\320\240\031\223pF\272\244L\365\266\204\331\274\352\2738\361\313\326z\211\223n\245k\240qI1.\373\254:3\223\305\032[\231\264\2310\314"
+	.ascii	"M\304\026\321L$\027Y)\027o\242\325\034\007\224\231\222\311\255"
+	.ascii	"\264\364\217\347\234\347\301\nU\306\201\235tl\256l\340(F\257"
+	.ascii	"`3\312\001o\332\311&0\200\333\271\331g\r\346@=u\020\013(\271"
+	.ascii	"1\245_^\026_\362!S\234\270\026\345Y\t\341$\252\020\267l\021\030"
+	.ascii	"\275^\361\235\271\371\177m\004iu\247`\2706u\t\3379\221)\356\362"
+	.ascii	"\332\326\210\273Tn"
+	.string	"\365Q\037\334pMt\225\202\261\336\333\222X\354\023C\306\026\243\253\374\312\246a\212\301\016;\247H1\371\004\327\222\032,\264\222o/\336S^qhj)l\222o\364\344\344\232\261_\315?x\212\335?"
+	.string	"\232\206aL\213\272\326\254\215y\240'\263\271\361\324\237@e\243\313Y\f.\233\233\322\323\262K\232n\225P\210\264FA\030\013\3009\350\264\344\253\341\374\004\332z|\247\217\305\223\206J\300\"B\340\210\210\336"
+	.ascii	"}\026t\264\334Yj%b1\370w\327\317\374\275II{{N\376\024\363\031"
+	.ascii	"@0\022\352\217c\266A\016\245\211$IA4c0\304<\315\236btE\237\251"
+	.ascii	">h\277q\332\226i\037\364\376\253&\213}\207\311\270L\371Z\177"
+	.ascii	"\372\234\341\237\004\314PF\2565x\"\313/lV\261$/\235/\216%\026"
+	.ascii	"\304\227\215\017\340<\226\375\020\2313J\367\300^C\270\016\201"
+	.ascii	"G,M\023\315\017\204E\022}\217`$9Up\216\202>,~\336\236\227\f\330"
+	.ascii	"\373\362?\361y\025}1rt\361\365e\217\233f\300\273;\327\234\376"
+	.ascii	"~\257\037\317\274\214\237x&\320\3748\350\215\343\360\262\215"
+	.ascii	"\362\377\200\234\327\356-h\301\312\377\r\270Kl\340&\253\214\203"
+	.ascii	"\237^J~\\\036\271[\266\227\353\255\310\003\200_\211\237H\343"
+	.ascii	"4\300\234\373\250\365(>Y\350\340\356\30655\337\r\352\277\030"
+	.ascii	"\257\254\275\302\317\363\372]\255x\233\237\210\331p\340\221\312"
+	.ascii	"a\232\275\376\320\026In\3210\322\250\336\013\036\360\204\355"
+	.ascii	"/~\324\tC\355\343\353\260\211^Nm\017\350\222\033c\022\355\340"
+	.ascii	"dq\367\355\377\223\177c\365\327\345\241\336M\312^\347\310\201"
+	.ascii	"\214N~T\253\023a\342\266\003R\004\254%\371\256"
+	.text
+	.section	.gnu.lto_.symtab.c68c3985d98c05ca,"e",@progbits
+	.string	"failsafeConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\001"
+	.string	""
+	.string	"failsafeReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\001"
+	.string	""
+	.string	"failsafeInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\001"
+	.string	""
+	.string	"failsafePhase"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\001"
+	.string	""
+	.string	"failsafeIsMonitoring"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\001"
+	.string	""
+	.string	"failsafeIsActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\001"
+	.string	""
+	.string	"failsafeStartMonitoring"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\001"
+	.string	""
+	.string	"failsafeIsReceivingRxData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\001"
+	.string	""
+	.string	"failsafeOnRxSuspend"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\001"
+	.string	""
+	.string	"failsafeOnRxResume"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\001"
+	.string	""
+	.string	"failsafeOnValidDataReceived"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\001"
+	.string	""
+	.string	"failsafeOnValidDataFailed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\001"
+	.string	""
+	.string	"failsafeUpdateState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\001"
+	.string	""
+	.string	"failsafeProcedureNames"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\001"
+	.string	""
+	.string	"pgResetTemplate_failsafeConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\001"
+	.string	""
+	.string	"failsafeConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\002"
+	.string	""
+	.string	"failsafeConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\002"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\001"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\001"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\001"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\002"
+	.string	""
+	.string	"enableFlightMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\002"
+	.string	""
+	.string	"unsetArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\002"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\002"
+	.string	""
+	.string	"calculateThrottleStatus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\002"
+	.string	""
+	.string	"disableFlightMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\002"
+	.string	""
+	.string	"crashRecoveryModeActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\002"
+	.string	""
+	.string	"setArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\002"
+	.string	""
+	.string	"disarm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\002"
+	.string	""
+	.string	"isUsingSticksForArming"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\002"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.c68c3985d98c05ca,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
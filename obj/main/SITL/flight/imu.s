@@ -0,0 +1,1664 @@
+	.file	"imu.c"
+	.section	.gnu.lto_.profile.d558f6ddfa29d91a,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.d558f6ddfa29d91a,"e",@progbits
+	.string	"(\265/\375`\\\002\r\016"
+	.string	"\364\022P\003"
+	.string	"-"
+	.string	"\255\234\214\225\013.\002"
+	.string	"\002\001\002"
+	.string	"\002\002\002\003\001\335\276\216\252\016\002\343\267\245\270\f\003\240\342\234\212\n\004\335\264\214\277\017\024\002"
+	.string	"\002\004\005\002\005\005\352\263\360\321\b\006\331\265\256\232\002\022\002\006\002\006\002\007\b\002\t\002\b\n\007\n\013\247\320\217\212\001\f\357\322\207\337\001\006"
+	.string	"\002\013\002\013\r\016\017\332\231\247\036$\002\t\002\t\001\001\n\002\n\021\022\233\326\340\375\t"
+	.string	"\023\261\317\360\375\017\006\007\002\007\024\026\302\260\206\302\t\020"
+	.string	"\002\001\027\030\362\330\255\243\r\022\002\t\002\f\002"
+	.string	"\002\r\007\013\002\013\031\032\033\034\035\311\313\233\264\003\002\036\242\302\263\302\013\037\203\366\244\240\016\n\002\013\002\016\013 !\"#\375\374\375\264\f\b\002\005\002\017\002"
+	.string	"%\327\235\250\225\n\004&\313\304\355\226\017\003'\311\204\277\354\005\001\002"
+	.string	"\002(\221\326\260\227\004\006\002\n)\301\246\230\212\004\n*\231\324\344\225\004\004+\240\202\262\202\016\030\020\020\020,\247\243\357\305\b\024"
+	.string	"\002\021-\343\232\341\250\006\006.\323\361\227\336\b/\233\307\233\231\t01\240\342\234\212\n"
+	.string	"A\250\021Q\201ad4Hi\322\312\030p\202RBV\036\021"
+	.ascii	"M\342\034*)\243\240%\205\302\306\001/\244\017\311\f\242\371\237"
+	.ascii	"B\216\336\353DF\361\243K\336R\032\030&\004\b\023\001\315\204"
+	.ascii	"\225\212\377\233\376D\034\226\001i\020\355\352\225\214\303\177"
+	.ascii	"\346\013\263B\342\017M\0056\312\223\204|\002\036!k\304\335\032"
+	.ascii	"\351P\257\3231\237L\351\274i%\300F&A\332\331<\202V\006\242Tv"
+	.ascii	"}\350\221\272\026\366]_\tt\264\247\306\252\241jZ\315\377\241"
+	.ascii	"\031\006"
+	.text
+	.section	.gnu.lto_.ipa_sra.d558f6ddfa29d91a,"e",@progbits
+	.string	"(\265/\375`c"
+	.string	"e\004"
+	.string	"\"\306\020\026`m3\0060\f\303\261\224"
+	.string	"G\2038-\220\276\271\223%\245L)\252\311\330_\030\204\276s\334\247\225\352L\221\370\020vx\203Y0\t>XA\340\002\250.\353IB\2644\217j.\325~\367nU\274\021\" \300\202\251\311\016\b\354\271\302"
+	.ascii	"\027|\036\246\215\216\r\f\t)\006j\221\263\004h\030N3\335:\020"
+	.ascii	"\201\216\3000\350\311\r\1774\215\255\231m\205\376z\265\017'\r"
+	.ascii	"\205\361;\030\013coa6\"\211C7\205\032\002"
+	.text
+	.section	.gnu.lto_.inline.d558f6ddfa29d91a,"e",@progbits
+	.string	"(\265/\375`\210\006]\027"
+	.string	"v\335bF\360\220(\351\272\337\362/\215;\340\227\023^\\\023\265\225\311]u`\3376\232\356\033\372\213\215\377\356\n\226r`\355\273\002\377\240\302\226E\257\"\002\277t&\251\274\034zQ\351\327\204\002\344\376\017\361\327\254\241F6I\001F"
+	.string	"W"
+	.string	"X"
+	.string	"\260w\260\3347\367i\336ZI+\367\326R\361\3256\364\254\374\320v\002\027\363\037%\204\361a\f\034\345I>\b\005R\330Fy\002\267c\205Li\373\211\265<Q\331\266\333\263\242\254\255\205\374\310\212\263\266\017\036\344\316\205\256\266\245K\252(\323v"
+	.string	"L\333"
+	.ascii	"\223L\256\222\242K\013\214\246\364\350!\206Wq\026}h\253hc\345"
+	.ascii	"e\203I\004\001\243!\361\213C1-7&H\231\001\207\013\024!\177<\362"
+	.ascii	"M\256A\234\326\366\251\230cv\023c$\037\262\322E\004\013\030\221"
+	.ascii	"7\223\013\376\237\350\201]{G/r\f\216\331\324\314\272\234\341"
+	.ascii	"\220B\366\361\002\320\"\0179)JxDi\333\255 \345\371\250<Np\312"
+	.ascii	"D\305\"\3600\242\304\n.U\314\300ft>\3601\033\032]\266XyI\351"
+	.ascii	"6\220\236\0247\001T\\\305\0320Bt\370,@[\2252!\361\007I\b \341"
+	.ascii	"\031\377\253m\211V\031k[\241\035\3740v<+\252\264=q\177\233$K"
+	.ascii	"\333\b7\270\361\312\233\303\342\322 \343|I\250\331T:\262\255"
+	.ascii	"\355\231=\241\f\026\366\374"
+	.string	"\276\023\302\247|\304\363\316\256;?\334\251\255\235%\260\300$\037\311\001\200\243\250!=\007Q\311L\222T\2461P\002Q\210\250\314\003\022 sa\212\247i\304\220\0044\023\264\244\245l\314\001bE\200\002\311\342\252\241\304K\307\030\340\r\226\330\235\344\237,\277\315\275o\205\300|\037\353\321\026\234\215\271t\t\331\311\252\340\316\206\376\206\252\240\330a\351\002|\324\250\261$gu1tJ\343\npP\373\346\327\206\013\264\00635\322\255\261\215\341\327xa\212\364\335$<\337\315q\264^-O\272v\200\302\224\305\357.\227+P\250ub(\253\363\235'%\026\257{\215\3140\250\313\311K\3746\324\324\363\001 \247\223\b\317\334\236\2569\300..=5\204\270\303wb\233ju/N\216\254\314\266\234aK)\341ni\204\205\354\\\356\213\273\3511I\370\245*\350\035\353\263\326v\002)\227\206\214K\250\265?<\353\031,"
+	.ascii	"2\205\2459*Ok\226d\261R\231\263\245\270\b\351h\207\344\254\030"
+	.ascii	"\3645\247\352\241~\252a\220\005\215.\363j\004\024\335)&F .9\220"
+	.ascii	"\177\035\340+\025\253\212\024clJ2\2553\202y\277@\204\251\315"
+	.ascii	"K\326\036@\315\375\364\324\303e\032bI{\300\027\342oY\315\325"
+	.ascii	"\331\330S\007\224*`p\363\2537ay\345\032\352\376\221T\022U\025"
+	.ascii	"F\024\356\306"
+	.text
+	.section	.gnu.lto_.jmpfuncs.d558f6ddfa29d91a,"e",@progbits
+	.string	"(\265/\375`F\002]\n"
+	.string	"\002\01711pk\322\001\374\377\377\237\221\351\001"
+	.string	""
+	.string	"$\201v\032u\313g!f\314\257O\305 \221"
+	.string	"\345\353\357r\360\263\307\\\024\264\210\004\021\225\324nr\247\224\0025\2708\327e9\216\fN\205\345\331ht.<:6\234\345\331XWD\245\036\261\203\273\234\025\234\265\200\214\364\224^\351mh\313\320iazB\330f\n\022\246Mh\021\376\203\366\322\266sK\264\243\237)\255\246\264\333o\362\024xF\366\t\252F\357\275\207\257\234\275\272oS\016\261A|73\026\231\350\003\005\364a\214%\354\355tD\214"
+	.ascii	" \3109[\264\277iM\2635\355.\306\361S\343\307\0358\203\252'\263"
+	.ascii	"\333K=\361\351g\333\210m'\265\264\314\022: \200\202\231*Y\017"
+	.ascii	"\001\304&P\3019a\271\357\225\023\273\326\264\307C\bm5\207 \273"
+	.ascii	"\253f\320\354L\n\321k\360r\005\006\021\274\315\226\343cA,\213"
+	.ascii	"A\003\222\356d\250\221Zz53\274\235\004\033\204\233\370\031\343"
+	.ascii	"\265\201\254\340\254\313\373\034\203\023\371/x\235\360\366\004"
+	.ascii	"\020Dbb\034\253\331\362^f\300\247\322\026\230\222\311A=\036C"
+	.ascii	"\223\222C\371\272\341\204\272\001\330\013$\345}x\201\270\200"
+	.ascii	"\331\bC\201\003"
+	.text
+	.section	.gnu.lto_.pureconst.d558f6ddfa29d91a,"e",@progbits
+	.string	"(\265/\375 D\305\001"
+	.string	"B\004\r\024\220Mc\347\250\377\377\237\352vz\372\002\n\006\252<\223w\312>y\222\0279\344\217;^c\305\370\342\212'\216\370\341\206\023\353\301\005\017\034\360t+\314\214\n"
+	.text
+	.section	.gnu.lto_.ipa_modref.d558f6ddfa29d91a,"e",@progbits
+	.string	"(\265/\375`\221\001U\b"
+	.string	"B\n\035!\2407\303\001\377\017\365^5]"
+	.string	""
+	.string	""
+	.ascii	"n\214\232\210\210\210\310\310>6o\266\357u.Y{K\231\002;\226\370"
+	.ascii	"\353\213\272\250\005\244\312\373{lzI\211\206f\305jV\311\206\305"
+	.ascii	"\347\235\231\306M\345\202\224#\225\312\243\203\001\342S\230\307"
+	.ascii	"`7\235rg\276\362\327\026\370\246\274qe\377\200y\224\037?\231"
+	.ascii	"r\246]$\311\234\033Vk\277\024\321>]\271RN\270\212I\250\201\275"
+	.ascii	"T3\3060\315\001`\002)c\244\007\021\200\031T\330m\263\237\001"
+	.ascii	"\002\f\366x\346\341\254\275\245\206\376\tH\177\265Z\352\214x"
+	.ascii	"%o7\004R\017\247M:Iou\247\265\244\307|\200Wg\207A\030\212S9\242"
+	.ascii	"\332\334dCLD\215-\276\300Y~\217\266k\013o\230\350\316\033\362"
+	.ascii	"\366/,\332\243\226L\304\350\026|\264\266+~\350\317\343:a\234"
+	.ascii	"\"\\\350#\363P\365}\300\207\352.\345\222\234\312\235\3561\354"
+	.ascii	"m\262\005\362r\336t\261B\370\314\253\007"
+	.text
+	.section	.gnu.lto_.lto.d558f6ddfa29d91a,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_q.71.d558f6ddfa29d91a,"e",@progbits
+	.string	"(\265/\375 P\275\001"
+	.string	"\304\002C"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317\202\200\200\204\002"
+	.string	""
+	.string	"\200\001\317"
+	.string	"?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001"
+	.string	"\003"
+	.ascii	"8\202\263(>\200\""
+	.text
+	.section	.gnu.lto_qP.72.d558f6ddfa29d91a,"e",@progbits
+	.string	"(\265/\375 \231]\002"
+	.string	"\364\003\214"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317\202\200\200\204\002"
+	.string	""
+	.string	"\200\001\317"
+	.string	"?\202\210\200\320\001\177}\304\001{\303\001y\302\001w\301\001u\300\001s\277\001q\276\001o\275\001m\274\001k\273\001"
+	.string	"\003"
+	.ascii	"8\202'\013\342\030(\002"
+	.text
+	.section	.gnu.lto_headfree.73.d558f6ddfa29d91a,"e",@progbits
+	.string	"(\265/\375 P\275\001"
+	.string	"\304\002C"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317\202\200\200\204\002"
+	.string	""
+	.string	"\200\001\317"
+	.string	"?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001"
+	.string	"\003"
+	.ascii	"8\202\263(>\200\""
+	.text
+	.section	.gnu.lto_offset.74.d558f6ddfa29d91a,"e",@progbits
+	.string	"(\265/\375 P\275\001"
+	.string	"\304\002C"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317\202\200\200\204\002"
+	.string	""
+	.string	"\200\001\317"
+	.string	"?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001"
+	.string	"\003"
+	.ascii	"8\202\263(>\200\""
+	.text
+	.section	.gnu.lto_attitude.75.d558f6ddfa29d91a,"e",@progbits
+	.string	"(\265/\375 4\205\001"
+	.string	"T\002'"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\031\001\025\001\002\005\001?\202\210\200\030\1773\273\0014\273\001\274\001\273\b}{\275\001"
+	.string	"\003"
+	.string	"f\nK\tz"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_imuConfig_Registry.79.d558f6ddfa29d91a,"e",@progbits
+	.string	"(\265/\375 \234\235\004"
+	.string	"T\bj"
+	.string	""
+	.string	""
+	.string	"&"
+	.string	"\005\001\212\001\206\200\200\374\342\203\366\201\023\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\326\006us\250\364\005uq"
+	.string	"\005\001\006'\001\006\005\001\006\035\001'\001\226 ?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\030./src/main/flight/imu.c"
+	.string	"\004"
+	.string	"\237\n\013&\361\024u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_imuConfig.81.d558f6ddfa29d91a,"e",@progbits
+	.string	"(\265/\375 /y\001"
+	.string	"\""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001\031\005\001\006'\001"
+	.string	"\005\001\006'\001\304\023?\202\210\200\030\177}\275\001{\274\001y\273\001"
+	.text
+	.section	.gnu.lto_imuComputeRotationMatrix.83.d558f6ddfa29d91a,"e",@progbits
+	.string	"(\265/\375`\271\007\375\034"
+	.string	"\306\360\245H\260VU:\326P!\215\202b8A;\025+^\307\302E\223\264\377\357'\3019\bD\361S\360 \320\342s\224\341RQ\350ICW|$\247x\307\375\301\343O\335\276a\272n\352\326\354\355a\030\246\241\351\332\222&\223L\001{"
+	.string	"\207"
+	.string	"\237"
+	.string	"\267\354\267\317\357\236\337<\277w~\353\374\316\371\215\363;\366\373\346\267\315o\330\357\232\337\257\337\256\337\255\337\254\337\344\357\325\357\375\375\337:\340\325\003\210\224\234q\316\024\3074S\212t\322\303\266Z\203(Q\204\002\261\002%0%m\0216LI\2059\311\366\242N\303\331\272!\203\304S\2319goqh\222>\311\252M\372\n\256P\322\267\b\3149\375\340\n\026\352U\3334\3336\3335!\265}\325 \362\203fA\223 \231\255liEz\304\310l_4\216f\210?\253Dc\320\".\306\266\020\321'\243#\016\034XJ\036*\030F\266\262\375\331\305R\372"
+	.string	"\376h%\272\203\016q\3215\347\024`uR!\037\254<\2244\210\020\327\240\222\326\020,%e\253D\275)\035\177\020\177?\332N\300\357\r[Wsm\330\277\207~\013\375\346\375\336\375\326\375\016\372\235\373\215\373}\373m\373\r\364\273\366\233\366{\366\373\347\001\313:\226B\222\247d\306\210Y-\271\257\312\355jUE\016\252\222i\027\214\213\261\241\355\235~1`\263e\316)\344E\247\016 H\220\340\351\373]-\231\200E\365j\304\234?\232\356WK\037\272\325\325&%\227rL\225B\336\002\355\302\305\266\274\365\r\217;\006\252%Kmw\353\033R\351\032\350\025+\265\325\255o8\025\344@\253H\3156h}C-\271\007Je\312ls\353\033F\341 \250\224(\263\305\255oh\274EP(F\333\312\366&A\241\236\330\314"
+	.string	"\021\251\223&\265\225-\020\005-.\t&\n\360\301\250\250\347\341\202\205\242\f\025z\032\212$\030\365\210\220:\364\002"
+	.string	"\360\321\006\nH=\017GGH=\230\323OW\2726\n\240\221\372-\320CK3dD\345\354\220\320\3561`\274\320&]1\331a\f\276Vh\375\322g]\264`\321\343\303\263=\272\305-\317\261\024\356,\212\023&tvg_E[\035*\234\315\tZ\234\251\222)\366\022$^\336ll\2677Q%\223\315\201\274\377\256\004\263\251Y\030nkV\227t\030K!\320\265\257}\325m]\253*t\024Kak\315h\0324g\324P,\326\266\366U@\001\200\221\250QX\306\311PM\220$\265\262\034"
+	.ascii	"\003\021\031\342\346\021\360\2344\210\020\003\025I\024Ic\030"
+	.ascii	"\306s\b\rR\254\007\221G\331\215\235\356Y\247c\242<\361\303\273"
+	.ascii	"\231\034jg\267\2243\306\255N_\t\312\261G\032\341m\266B\251\323"
+	.ascii	"\026\204,}<\317\301\312P\rW<\210\274\326l\fjN5\261\273\375\023"
+	.ascii	"1/s\240\237\341B\322\016Q\353\345V\324\022\237\275\304W\225\316"
+	.ascii	"ZT+\202\320\254]\016>\311\350\271g\240\027\345\226\013\336\025"
+	.ascii	"\227\322\347\237V\005\314\243 \tT\002X;\200\370\343\370\300\345"
+	.ascii	"\203\224\314\2575\344\372\347}\033(\001\346^\222\002p\356\244"
+	.ascii	"VB\312\216\261\261\232\031\020\022\213\343-\322\363\f\261'\335"
+	.ascii	"\304\342\270\215\330U\023\031\n\232\270M\254\203\367[y\333\326"
+	.ascii	"\331\301\373\255\\\255yn8\211+C#\234-k\322\235:\221\377\357K"
+	.ascii	"E1\246\f\2362\006\273\200\253;\377\017\213\f\371\324\">\177"
+	.text
+	.section	.gnu.lto_imuConfigure.86.d558f6ddfa29d91a,"e",@progbits
+	.string	"(\265/\375`\002\0035\025"
+	.string	"\306'\211I\260\324Q:\331\255\r\177\372\"\242\247\247b`\3630\230\354^=P\376\025\330\026\303\362\261\263\215\227\255\274\350\337\312N\013\033\237\250u\360\351\317\206'\270\3202G\225\377\006\247/\372\017\376\026\b\366@\217P\2555n+eJ\001l"
+	.string	"h"
+	.string	"y"
+	.string	"O2\211\205\355\3733N\204s\031f\371$y1\347\024/m\034[\274\274h+X\200\273/\307;\247\211\340\203\326\245U\355\013=\006\356\275\021\226s\236\020B\232\323\367\342\004\255\313"
+	.ascii	"\027\020^\352_\341\245qv\221\373T\314\0271\355\212\224\3149a"
+	.ascii	"\233\342\270+\316\377\320]\274\036\235+\313\301\234\323\312\353"
+	.ascii	")q\357m\273\330\336`oN\033\376\320\001\277\272\337Uy\3466h\255"
+	.ascii	"9yb|\032\257\361\301\007\272t\315\250\347]\372cx\371\025}\246"
+	.ascii	"`\364r\032\264};\272(\354\257\346\376\330\367\375-\357\375,\241"
+	.ascii	"\372\025\252WT\255\242\352\224P\215\022\252EU\237\260\324\256"
+	.ascii	"P\335\n\325,U\207R-C\365*T\257\252U\252o@l\002\36225'\211`\223"
+	.ascii	"\031\022|\304 \310\te\375\2453\371\347\003y\202\217|\024\305"
+	.ascii	"\243jQq\355\n\026\364<\024\002z\262\366\005\fz\236\270\007xV"
+	.ascii	"\307\256=YE\222\341=4\360p-\200\244#\255\2659\\I\007k[\341\262"
+	.ascii	"\344\206\035\216\364\223Kz\253\265en\344\337\200!s\316\030\377"
+	.ascii	"\306q\304d\263Yx\271DxT\277\347X*z\232n\020\f\n\341\2313\347"
+	.ascii	"\262\273\332\353\\\354h\320\272\033\263\233ZL\304\2546c\023\223"
+	.ascii	"\261\031i7\331\314f\033e2\263\332\3556\332hn\005,\203\271\251"
+	.ascii	"\241\301n43\264\232\007\230\r-V\003\223\331B\300`X<\202\230\331"
+	.ascii	"`\267q\264\301D_\356\253\271?\246\340\364\224\333\035\253\254"
+	.ascii	"\017\365(\357\200`%\245UY\030#\273\252\225\r\022\341C_\001\203"
+	.ascii	"\244xT\257\365\357L\240\200\023\301\312^\347#e_{\242K\244\025"
+	.ascii	"?\035\220eS\366\026$\265\253\312\2650\362)i\n8 \300\002\221\261"
+	.ascii	"b\007\337\362P\304t\337d8\331\222\035\342\323\371\220\020\212"
+	.ascii	"HS\032nY\207\270\3173\323\236*\363\006k\355\265\373\007\326\341"
+	.ascii	"\310\360\336\2260\334\3403\024\270\303\361\261\374(q\231\330"
+	.ascii	"@\277M\3241 \251`\310\007[\346\370\201\263\214\341\215\365\270"
+	.ascii	"g\266\253@\330\346\334\206\256k\334\3203\362\264\335,q\275aB"
+	.ascii	"\302\013M\303\247\001q\006\207\230\364\234\257\321\202\203\032"
+	.ascii	"\272\345\205\260\310"
+	.text
+	.section	.gnu.lto_imuInit.87.d558f6ddfa29d91a,"e",@progbits
+	.string	"(\265/\375`\224"
+	.string	"\205\n"
+	.string	"\206SH?0\247*\035P\270\365\327\213\356\323Tkp\336\371\b\347=\027\341]dT\230\312`aTT\005\375\177RAE\335&\f6\221Pw\314\210\240\350\"\270M\265*`D\023"
+	.string	"\0235B\366\336)\0055"
+	.string	"5"
+	.string	"5"
+	.string	"1\332\356\326\031r\322\351\224$\377\255\033\204\"xJ\351\370\244\r\343"
+	.string	"\005\026\361D\023P\"\341[\227\032\242I\312\311\303\356Z\206\"\307\315\3356\204m\006\373\013\001\276\030\311\207\347\374Qw\356\3421\202\270\022\224\344\315~\201r\252\354\323\235)\373\322\247|\2266\253\005vQ\267\005+\343\b\214\330~\305$\373\300_\253}\254\226\021\276\246\273\3531\016e\267\364\320\207\035\300\306g\235\263\307\341t\347\354\3167\017\002|\3100&\350\211\264?!\371\320\b\263\215\332h\232\240\177Q\347\223\274D\344\263\002\316\\B\035\257\202&6\036\205D\255\3600\235\232\361|\352E\301\237\205\306SA\337\347\251\225\327\236\356LQ\004[\033K\323D1s\202_\331F\001s\252\034\376\031\0013p\2226[d\021"
+	.ascii	"3\241Gh`\255.\303\362\313\230Ach\210\223\330E\375\254i!x$\246"
+	.ascii	"Z\321\205<0X\177\031W\\\272\230\355\320\300\024\024"
+	.text
+	.section	.gnu.lto_imuResetAccelerationSum.88.d558f6ddfa29d91a,"e",@progbits
+	.string	"(\265/\375`\227"
+	.string	"M\t"
+	.string	"\026\220<90\221\322\001 \\,\021\350\210\325\251\2378\3731B,\204\242"
+	.string	",kFc\026\n\201\265\206\355\001~\003\006\343\215\251\311\303 \025,\020\216\367\005\372I\007fJ?\267\335;\245)"
+	.string	"-"
+	.string	"-"
+	.string	"\377\330\263i.\202\354U:2V\260\335\255\363\343\336\245\347_\344\236/e\272\354(\354\256\345\227\332\270\347m\017\330&\260\277\020'\271\360\301Sc\224\344\277S\277\224\235\316\232\227\320\346$c\266h\222\323\303>g\247\312\356\004\264d\022bv5b7\373\242\255\020\333\001\007]\321u\2501\374\312Y\354\362A\223<z\314N)\007\353(OY\311\333\225\261\302\203\237\230\300\nn\333\340%\026"
+	.string	"3\273\213\340\217\004\016\201H\"\255\216\" 4\211\207:\2415\210j\210\353*H\300\033\205\003WG\333\306\325\217\270\347\354T1\300\274N\023e\177\313\374\226\273l\016\025"
+	.string	"3\241\215(\360\rz\373\250\274H\355`0\362'\226y\030\f\001\343V%\0320\f\340\200\370\234\342"
+	.string	"\355\022U\002\272\206\223\2050^\206"
+	.ascii	"\227n\321\316'"
+	.text
+	.section	.gnu.lto_imuUpdateEulerAngles.91.d558f6ddfa29d91a,"e",@progbits
+	.string	"(\265/\375`\271\t\305*"
+	.string	"\332L\354\017Ap\350\312pS\263\312\016eB\250\200\315\276\272\226\342\337\212\347N\266\n \200\320\276p\346\205m\323\033"
+	.string	"\320TH\026\345\322\322\350\036jJ\001"
+	.string	"\250\314\271\013\364\300\036[\207\025\214\223A\366\336I\312\024\324"
+	.string	"\332"
+	.string	"\366"
+	.string	"_7\370\232\301\327O_/(\327\n\310\265\323\327\t\276F\360\365\201\257\233\312\265\001r\315\364\365\322\327J_'}\215\364u\201\257\177_\037}M\240\\\033\221\353\001_\013\370\272\350\353"
+	.ascii	"_\003\370\232\250\\\017\221k\337\327B_\367\2766\277.\277&\277"
+	.ascii	"\376\327\273k\375\2204\305\215\b\270\3634\313\023t\266)\345\242"
+	.ascii	"\330V+\233\266\335\320+>\2165V\316\363$\322\322\276a\023i\251"
+	.ascii	"D\026\332w\324\r\355\354=\211R\366\366\347<\317\340\235\250P"
+	.ascii	"{fI~\205\326^\006_\361LL{B\324$\033\270Yb\247\350\254\214d2\246"
+	.ascii	"\001B\3342\210\222CgA\364Egd\244\323y\236\272\246\253\343l\270"
+	.ascii	"\333\313p\236\247\267x\346C-\244\266m\330\206\262\207\214\002"
+	.ascii	"\347p\240\030\342q\353V\347\"\241`\342\266\356\262nu\255\022"
+	.ascii	"\372\305K\326}J\264\250]\335\352"
+	.string	"X\377\034\3618<\241]\270\\\335\227$\357\256M\333\214B\341\034't\236'\005\353\233nQa\205\242\245\301X\2600\265\264\272\266\351Z1\373cdk\333\363<\305\356(\023\303uM\205\336d\241C\266\200l7\2152\365\030\356-\0332\334<[\335\024\213\013+\024\207\305X-ji\215aj\251\3575Qs7dl\363l\267\241\222\347y\236\373&\266\222\347y\236>\023\373\353\257\257=|\355\365u\207\257\273\276\346\3605\327\327[_k}\235\3655\326\327W_[\355\032C\271\236`\256%\230\353\b\345\272\252\\\007\3115\325\327S_K}\r\341\353\007_;(\327@r\035\3655T\377\334\022\323O\351K\277]\322\225\364\214\375\216\224T\340H\307\256s\275\300\227\336\210\306\243\337I<\002?zS\035\361\370u\257\023xoL\0328\242\321\350\266\220M\343\300y3\340F\277\235\200\001?\001'\337\210\307"
+	.ascii	"\\\312\372\264)\372\322\027\242\024\247\005p[\303\206\325b\200"
+	.ascii	";\221\021\035\300\227\324\020\217\035\256u\242\367\246\240\311"
+	.ascii	"#J\031\272m\245h\260\222\350\254\245g\270~he\324L\227\327\327"
+	.ascii	"\227\251\245\026\365\370>\364\327\225\rBZ\241\333 B\230Z\364"
+	.ascii	"\335\211\314\314(\346\327\273\320\217w\264\344\315\333\"F\254"
+	.ascii	"\026{w\302q\261\362\346\321\303\261^^\t\217h\374\227<iG\224\342"
+	.ascii	"85Iv\236cO\373\277i\216x\364:\207\357uMI\266 l\206s\266\030\267"
+	.ascii	"\376u`\240\254{8pO\326\275\016\254s\365\016\007\302!\036\207"
+	.ascii	"W\357:\020\r\3618\274\n>AU\303\005X\220\306\n\025`-R\004_\200"
+	.ascii	"\225p\021<!cF\220J\311a0P\310\b\322\b\013\223\021$r\033S\362"
+	.ascii	"<\023\207\240\322f\354\303\336\2043Y\242D\302'\\\313\0065\365"
+	.ascii	"\320\031f\204K\370\353\210\306\252G8\f5pe\2034\214\235\033$&"
+	.ascii	"\226Yu\023Y\322\220- \033\261\232\320\366\b\327\217n\215T\275"
+	.ascii	"\207c\316]"
+	.string	"[\031\334\"Kd\207P=8E%\365)\b\227r\360\007\020~L\255\017a\332\205\263\007\367\311\2319.\212\216\2070M\267\354pp\237\235\03459\340\352\330\342\346\210:\020*\n\212A\203'\006\013\376$\265C\307)\033\272\035\023\246\351\032\264\025[\360\nvsw\n\362\006\3419]\301_\227\300\351\207\340\t\376\246\037@0\245\177\374\b\323*\3649p\237\034\037\307E\241\341\321=\3024}\263\220G\365\b\251\b\253\b\325V\213B5S\313U\2231\265l\272onNM\2164\260\246w\352\3540\335@\200\271\250\201H\005\rrhD$\005IA\n\315\001\340\002\221!\342\346\021 -3\020\211\021-)6\254\001\003UC\371\211\327J\202/\213%\205\013~\315O<Q\307\264\372\n@\032$\274\003\366v\247\271\203m:P\021\211\n\236N\034'\202\004\376\332\033\024E\252\245\313\307\310\357\304\307\357c/"
+	.ascii	"=\333_\371\233\013\315\233\247\3600\333\336[\"H\340\257\275@"
+	.ascii	"z\271\037!?\213\276$i(c\347\241\371j\2302\214\223%\f\362{\304"
+	.ascii	"O\r\301\017\036\241(\363:@h\333\026l\232\006\271\021k\203\223"
+	.ascii	"\036-\250D\264.\222j\362%\211\314\216\3252W\034!@c\314\fB\b6"
+	.ascii	"XK\312\227[\250\305\274\016l\340J\003\216\211\246\271q\242/\211"
+	.ascii	"\250\f\034\360\005\022\2210\241\375\314\311$F\255oA\026\177S"
+	.ascii	"\356\355\267\234\327\313_\343c\210I\326\017(\030\356\223I\375"
+	.ascii	"\304%P0@[\223\314\t\t\354\313\345.\371\261\0247\234\267\252G"
+	.ascii	"\303X\020\221x|\037\035|\217\323\263\\\226\t4\202\256\r~\376"
+	.ascii	"pd;\021\306\305\301c.\264\342\225\002\301w\314\220\270\221\367"
+	.ascii	"SX\234;\320\216\310\224\356\246\300\364\027\317\316\250\206C"
+	.ascii	"\027\236\033\333GZ\037\245\367\212\347\326q\326l\234P\003"
+	.text
+	.section	.gnu.lto_imuComputeQuaternionFromRPY.94.d558f6ddfa29d91a,"e",@progbits
+	.string	"(\265/\375`\335\b\265)"
+	.string	"\232N\244\020?`\246J:\005S\263\364\244:e\345g\t\251\217-\271\267\037\264v|\274\242_\004\324\366\265L\311\213\366\201\nt\305\333\315\247\243OgW\025v\177S\247'\0348\374\327?\244[\333\244\245\235d\374"
+	.string	"\337"
+	.string	"\377"
+	.ascii	"G\277Z\347\222\203\325N\311\027\305e\354<\033\215\275g\363\331"
+	.ascii	"k\3546\366\033;\216=\307G\273\266\031\237\261\236\323X\215\331"
+	.ascii	"\330\215\341X\216\351,\322\234!<\342\020q}SD\255M]\331\232%0"
+	.ascii	"\370\230\260\330k\242\002\215\223\023yjToLUn\356\211\224\022"
+	.ascii	"D\2171\2315\227Q#\262\365\200\212\213\002\345\257\326\232\345"
+	.ascii	"rG\020]R\t7L\340\206/y^\3073\2275w\3011\231\352\233\233\221\275"
+	.ascii	"Z+\204\225@t\3114=w}\347,k\326\242\303M"
+	.string	"\265\"Q\264W+\036\204\275\"\272\\<?Q\227D;Q\227\273\266+\310xK\352\360\311 \034\230D\265\326\342\225x\315\304!-\205\237k\353\241\006\2438:6\023\253\216\370\b\342!\236\036A\340&\005\342\022\271c\n\177\370JtoB\252Z\253\351x\312\321\271\3159\324Pk\335\031G\347\303k\344\335\355\261\273s\273D\273\227\272k\342E8\337\340~\236?\327\240\376\274\221un3\271W\367O\370%\341\026\265\315\344\254\265\262\375I\224x\030\007\275\272\275l\341R(O\235\267\031\270\213\3076\237d\327\302z$\273\326bcp\031\357\227\363\274^F\343\355\362\236\227\313|\336\013^\343\265\3406^\n~\343\335r\034\257\226\347x\213\017\034\306\316r\340/6V\003w\261\257\034\306\313\300_\274\013\334\305\253\200\316\265\242s\023\320\271Ut.\025\235\213\200\316\235\242s\017\320\271\006\350\334\002t.\001:w"
+	.string	"\235+E\347F\321\271Pt\356\023\235+\200\316u\242s\003\320\271Mt.\023\235\273D\347*\321\271"
+	.string	">7\351s\221\350\334#:\327\210\316%\322\271\303r.-\347\226\345\\a9\367\345\334Y\3165\007\003\376%\032\024\2730\374g\365\210\265\326\nk?kmF\245>Nt\260\211#\324\365\256\027\370\231\240\030\002\037\360\257\246\023X\372"
+	.string	"DR\217\272\227\323\245.\245\350\351Q\267]\240\037\324\005\274K\312\323\241\212\177r\272"
+	.string	"\255;=G \037\244]\2003\235\353\363\f\262\356\302\233\036\340R\212(\\\353M\037\356\261\360\2453\275<\263\365\342\227\236#\260\017i\347\246t\341S|J\026"
+	.string	"\\)\351"
+	.string	"~6\310?\244'\335HB\f\216t\327\005\212\241\360\251\273\243-\243\037-\270\321o"
+	.ascii	"\372\311\320\372\024\025;F\223\370\335\243\331t\\\361Tog\333"
+	.ascii	"\325\263\236;xj\335\f\311$\240\267Z\333\254\206'\336H;\005\037"
+	.ascii	"\336\006\240\033\344_\333L\022\351\037\224\247Y/o\"Qrxe\220\226"
+	.ascii	"\322\301W(\304\372\202\254K\335a\241\302;p\237\177!\326\377\024"
+	.ascii	"\211\372\312'\331)}\213\336\340+\234WWp\271:\306\ndd\307\020"
+	.ascii	"h\307\261a\231\021m\210v\034#\226\031\321\210jb`h\3071\252&\006"
+	.ascii	"VfD\243\022\314\246\226\331\234`6\267\314\246\232\030\330Q\214"
+	.ascii	"\2614#\210$2\262c\b21c\232\261\314\210\324\342x\006\"M\254\206"
+	.ascii	"\031q\307\"\324\230a,\246\305\200a${Q,3\212\315(\216\235\241"
+	.ascii	"\025#H\355\221\206\213\263b\332\361xVD\302\253\026\326#\3510"
+	.ascii	"7\007\2477|\360\025\322\2543\270\\\t\370\007\370\327v\267\265"
+	.ascii	";\320\365\"';\254\235\254\207\017\323q\037\250\313a\025>V\fE"
+	.ascii	"\315]\021$\246\343v\366\t\261\343v\266\265\372n\t\013r\335\352"
+	.ascii	"a\203n\022|\027\314\200\\O\360\260A\275\252\357\2420\"\256W="
+	.ascii	"lP\f\325wU\370\220\327\251\036&\210\b\301wW\270P\327\021<L\320"
+	.ascii	"o\352\273b\036\324\365\251\207\t\3629\360\3351\373}\375\353\007"
+	.ascii	"~&\350\306\300w]8\220\327\275n\340g\202zH\273\002\017\200\224"
+	.ascii	"\250AP\002\rBP\215\210\202\202\202$Ic \003\021)j\016\021\340"
+	.ascii	"$\206\320H)\2242\352\2231\017\202\242\253$\352\022T\336{\243"
+	.ascii	"\214\356bA\"\223#\335\343R\236\302\371\236k\370\372\252\246\205"
+	.ascii	"\222\266\324A\276\200\360\263\252\"T\352*\255\361\357\272\276"
+	.ascii	"L\255Nx\313\347a\323\334\222\350\2209e\362\216w\363\334\337\335"
+	.ascii	"\002\347\241*\255\375\303\204{@\253p\231\277\202fc\350\206\250"
+	.ascii	"!\315\277C-M(\277\330\206\275c\"J\254\200\266A\360\340=\202\245"
+	.ascii	",\273\332\305*\370\303\266\376 q\274\246\033\207\037\326)s``"
+	.ascii	"\252\351\203Y\353z\274\224\254\223\302\203dS`\201O\303Z\246$"
+	.ascii	"C\373\313\365*\252\020a\256\207\325\253U\374\327c!R\321\326\\"
+	.ascii	"\362\227\022\320\306x\t\001\335\030\257\020P\215\361\356\024"
+	.ascii	"\r\026\031_'\214\326\013\241\350\b\240\222\353\302\304\217K\213"
+	.ascii	"\377\311H\277\252M\310\267\271~\213\230\242\333m\234\377\003"
+	.text
+	.section	.gnu.lto_imuCalculateEstimatedAttitude.95.d558f6ddfa29d91a,"e",@progbits
+	.string	"(\265/\375`E\004\025\034"
+	.string	"\366s\262E\240\\M:\2048<\361\220\366\305L61\345\r`\320\252\005\t\036}\001&(_zc\266\0245\245Dm\334\2540\352\323sBy\341\373\350y\230\240\033\0166\207q_\343\317*\243\022\335\330\255\021B6\2212\245\235"
+	.string	"\216"
+	.string	"\242"
+	.string	"\226m\252\264rN.m\031v\354\3621\333W\373N\276\033/5\303\2579\177\244\2512'\217\201\023\210\227>'"
+	.string	"^~\037"
+	.string	"^z\264\327\234Gd\206:/\266(q\346\234\263\035\362\361\260\227\030\202\362[\035\375\220\302\353\206C:\354\300\017\034L\177}\nr`t\034\212\f\2204\247\372\001,\245\035*~\n\272\254\300!p\343\310\355PJK\032\332\024\254\241\022K\211)\206\243\241\037\224\022\223."
+	.string	"\\\322\3473\347\374\324\325\006\256\246\032R\230sZo8\034w\354\266\253l?\260\277\n\001\001\3246\001\244\277\351\036\347\243\266H\377n\223\355#\360{\002\nW\222\316\261L\305\247"
+	.ascii	"m\241\025\2733&\314U\322\"Y\300\372U\2172\303wr\214!\375\355"
+	.ascii	"\322\037\002/%L9\345v<h\332\263y5\335&\373\333\353\365z\336 "
+	.ascii	"\366\247\356\271\324/@\252yD\265,T\357\210\352X\250\206\211\352"
+	.ascii	"W\250\026Au\b\252A\251\226R\375}\352\375\324\372\251_\340R\234"
+	.ascii	"r<t_6\2137o\364\350\314+yE\267z\373\376\223S\3118/\340\230\021"
+	.ascii	";\262\342\274\241iO>\031\331\362\352\361\301<\314Q\006\r\032"
+	.ascii	"\300\313\236=\325\021\340\254\230\344v\033|-\254\034W\265E2\017"
+	.ascii	"\032*)\3426y\335\274\003\b\256\214\213\303\273t\340\002\356\315"
+	.ascii	"|\016\346\234\341\367\037P\356\016\024\0241\266\207g\371\021"
+	.ascii	"\347\234\020\374+\307\362\301w\272t\b\021\"\300K\271\267\332"
+	.ascii	"\222\242io}5\347\004\r\200<"
+	.string	"\373\251\303\260\364\006\300oy\326j[\252\235\312\255~H\224(\261\021\266\226h\332\323\363\346\234r\367B|v\377\324\353\222\323\225\264s\316\371}\312u\017'/B\004\r\t\2010j\021TT\004\003Hf\240\0060\206\204fF*R\b\261@1k!dbh\006T\364b\326\240\307D.\202\212fFDDE\263\030\217\366on\020c\350\201DN\027mk\337\234s\302\026\350kc+\333\363\336f\324\211s\322\330\274k,2\032\031u\372\333\250\003\307\2471\211\217m\221\274\2632%O3FM@3\356\"p\355\354\004\330\306\366j\306%\327\032\243\256E\313c\223g\215\273[\0211\3633\343T\005\013\026\300K\330^\313\226\224\270\257\275\032[\235p\305\275\255\016\315\027^\006+\374\242pUor;\251\377(Q\2501$\303\030\203\306!\223`$MA\241\305p\002\221)\263s\020`U4M\n\035\363"
+	.string	"\227\204\335\241MhI\237\261\303\221h\202Q\227\262$\024"
+	.ascii	"\025S\026\330\320\230\211:!\325[$\346\340\024\301M\tuwR\214\347"
+	.ascii	"\353\352\232=X\026;`\b\203o\305\231\274l\361\217\315\247\370"
+	.ascii	"\201\355\354E\344~@\201\372\252@\343d<Q\022\214\317\031\230\005"
+	.ascii	"\350\366&7\265\300\001\224W8\004\t\361\221\235\340\231\261\307"
+	.ascii	"\211\356'e\252\337m\215\301$ \266\bF\007\177\307\376a\207\032"
+	.ascii	"~x\262!\356\373\215\343\3619\\T\357\356\213\272T\303\274\003"
+	.ascii	"\005M\305\360\374\326\203\032"
+	.text
+	.section	.gnu.lto_calculateThrottleAngleCorrection.96.d558f6ddfa29d91a,"e",@progbits
+	.string	"(\265/\375`A\002m\023"
+	.string	"\206&\202H\320\360(\035\333(Y\006\373\314\017\356\007\016\251g\242\002\266\330\217,\001\0241\004\315\360z\377\212^\350\026\325\374\264\270^\035\207\263\237D\345\332\314\325\fr\214\030O\272`\3048\303\316\271\365\bEj\b\215\326\310&R\246\024m"
+	.string	"a"
+	.string	"t"
+	.ascii	"\016Y\242\3159\301K[\306\006\357\362o\006\337\343\335\247\315"
+	.ascii	"\274\204\026\266\021i\3169ri\002\247K\377\303"
+	.string	"A\270\354]\202\b\257\231\001[\f\232\\\2159g(r\220\357\322;\200\357r5\334uo\325\345\317\3343\211\264\023\262\331\315\327\013P\303\261\3411\023=\021\024E4\277]kf0U\223\311\234\323*\233\331\334\362\266\021\330.`\253O~\211\321\313.\375\230\357R\357\335w\251\332\373|\200MW\273\020b\350\245\243\215\023us\354{sk\266\247^\275\347\376P\265\312S\247<5j\325\240\252;T\315\241\352\223\252M\252\376<\265\\\265\247\352U\265\252\372 (\026G\263S\2401g\205\361\306,\222C\035\336\363\333\367E\334\307\006-s\\9\036\232\t\366\261\251\375D\332O,I\324\321\336~\354\203h\226R\272k\243\244|\227y+\242\373\335}lG|\211\007Y\347\353X\305Bz\231\205v\005\203\006\252jm\007\254]\234\321X\004\333\231+a\030\201vs\254\373\214\025\031\212\246\017\214c\022l\316\227"
+	.ascii	"\325\322&\334fd\030\245\200\251\222\201\254\003y\361\021\377"
+	.ascii	"i\2556\3149Kr'\001\301\327\271\f),*-'\322($1\254\225\020\246"
+	.ascii	"\201\312\n\013\203\260e\345\204\025\242\270\274\204$!n=Hq\ta"
+	.ascii	"Z-\227\020\264m\334\353[\263G\314\306\341\366\337\304pT\350\310"
+	.ascii	"Q[c\033\2656y\255\350m\216mpW\373\016\220c\277\355\330\273\210"
+	.ascii	"\355\210\247\265\025\260\3642\016\036\017I\363\310\264\247\324"
+	.ascii	"\232V\346bHr\277}\f\351e\342C\336-0\021\321w)\267\304B( P\002"
+	.ascii	"!s\212\017\320\341\037\205\366\232\355\t\233\231\210a|\325\303"
+	.ascii	"\t\033t\021x\325\021\303\007\361\351\3408\r;N\311\217\003k/\232"
+	.ascii	"B\241\022\201\030\2135\020\270b\220Q\203\347\3434\364N\317f\b"
+	.ascii	".I/\203\237H\225\026ta>LY\350\031\336)\306\3718\300\316Zl\330"
+	.ascii	"\364\\]\236\026\357\001"
+	.text
+	.section	.gnu.lto_imuUpdateAttitude.97.d558f6ddfa29d91a,"e",@progbits
+	.string	"(\265/\375`\272\001%\017"
+	.string	"F\334dF\360\262&\035\260\330\037\026\223\375\022\034\260\340\017?\366\270D\221\302\210\342\321\321jr4\372\227\360\222~5j$\250\200w\023?\303u\216\233L\3411\036\026\027\024\226\f%\026mb\323y\271\340\367\350F\366&[\246\024P"
+	.string	"L"
+	.string	"P"
+	.string	"\022\273\200y\351\223\315\343\241jILl\310p\343\332]-\206\370\351SbQO~\206\022\362\201\336'"
+	.ascii	"0\346\362\023s\f;\340#FO\b\206\304\007\002S\032G@\fX\311\356"
+	.ascii	"\036\305U\003\370\242\232\241\354\256\365\0039\334\331mo\266"
+	.ascii	"\023\330: @<Uo\232v\005\013\372\357\361-x>\264R\321\263CO\343"
+	.ascii	"\214}lw\327Q\306\376\352\317T\255\252>(@\217\035\340;\374\330"
+	.ascii	"\205y\005\331\226\224Q\002d\373j\377\304kN_]p\310.\b\234\234"
+	.ascii	"\335\320\304\006>\227%\017\315\007\252K\034\007\036l\270\\(}"
+	.ascii	"9\212\260aQC\212h\026m\025N\377\031\213\236\255SC\243\302ns\215"
+	.ascii	"\357\261%|\205\313gw\025\370*~3\362G\\\232\304\"}\226y\251\261"
+	.ascii	"@\216\025J_w\350]w\327\213q\306\266\313||\220BGJ\003-\rD#\216"
+	.ascii	"AiE\324u\246M\304\333\211i\304i\245\b*\334\004\b\332\n\2272\322"
+	.ascii	"\266\256E;!1\211\202\250\323J$R\247\201\302=\266Q\306\037\236"
+	.ascii	"W\013\025_\346g\234\306\216\216\336;\323e\362\034\026\214\033"
+	.ascii	"4,\333J\3006\202\2770+\204cw\027\330)w\261\215\004\" \320\202"
+	.ascii	"\031\251\333\006\002Co\311\300l\340;Y\016Zk\023\r\202;;\030\202"
+	.ascii	"|\005Q7\270\373`\240\206\220\311\351h\006\342\\\216\254h\225"
+	.ascii	"5\024\263\311\321\214\277#[\024\310o\324\t\213\330G\013.\311"
+	.ascii	"\300\377\373\352\031Y\020r\273\262\036"
+	.text
+	.section	.gnu.lto_shouldInitializeGPSHeading.98.d558f6ddfa29d91a,"e",@progbits
+	.string	"(\265/\375`{"
+	.string	"\365\t"
+	.string	"\006\322D> \305L:X+K\024S\347\340l\350x\240t\330\253\250FS\231\nP\3251\324`\001\225FT\201P~/\277\234\235v&\201\273 H\004V\200\300\211\022\001\001\360 3\265\022B\244L)1"
+	.string	"3"
+	.string	"3"
+	.string	"\013\362\361\337\352\350\227\3765\264t\002r5\222\365\375\024\\7\026\206D}\006\001>t\227]U\344Iu@3\347\264\246H\216\033\274m\007\333\t\366\037\263\016\223\366\354\262\244\013\263\377\315}\331\352\207\034\223\225\212\274\007\2009W=\336\304\201.$\252\267I6\306\013\f$\217/CV\005\261\232\006\313n\316R\fk\215iO\337\302>\206)\017\255\334\216\300GR.\334.\314\037\303o\304\312"
+	.string	"\224\026\260?\373\311\350\2138c\244O\035\364G\341\301\357eG [J\\\001\336d0>\035QD\301\351x&\304\212\016\304G\334\204.\304\314\201A\026\022!Q\004\002\205DL9\277/{b7\232M\217\362\313N\300\213\275\320l{\225\353n\330\326\017"
+	.ascii	"p\b\370T\307\253\303\216\251l\200u\267r\215\004\035\343\303\205"
+	.ascii	"\256\341\n\023\344\374F\033,\217k\216*\035\212Z\005\005"
+	.text
+	.section	.gnu.lto_getCosTiltAngle.99.d558f6ddfa29d91a,"e",@progbits
+	.string	"(\265/\375`\034"
+	.string	"\245\007"
+	.string	"\262M36Po\322\001\340\304\224ZV\332]\232\027\350D@7\026G|8u\274\"\024\266&\371\354\331\314\320\t!g\315\314\021F\231\207V\272F\255\351\322/\226\354-eJ\001\356p@\036+~\034\032\254\007\206\ba)xb\007\223\210\034\002_\021\013X\374\\\027\0263\334\376\255\226R7#\255\360\210;\r\013\310E@\003\246\335=\340\0362\341\237\016M\021\312k\207~\350F\251\016S\001P\243L\331\234(5\303\376[-\331O\247\006\270\234l'\231\354^\244^V\005\2426lgv\306\357\270Gfw\2173\235\n8R,JZv7n\256\251\016\337\005\252C\325x\366\314\374\177<a\205\324i\233\350\211A\330]\247\266a\334z\003\333$\001\016"
+	.ascii	"2\241\221\037\030b\202\2219\032\023A\305\201\330\fV%,\327p\341"
+	.ascii	"\020#fl\342\256H\263\341]\367\006"
+	.text
+	.section	.gnu.lto_getQuaternion.100.d558f6ddfa29d91a,"e",@progbits
+	.string	"(\265/\375`D\001-\013"
+	.string	"\306\323G>0\305*\035\216\373\371^\357\362\3754\\M\340\260\301R\223q\026\034\\\021\333J\016\025\0013V\304Z\254e\330\032+\006\t\275\\\031\021\021Zeq\240D7\212Vx@L*!d\313\224\0023"
+	.string	"2"
+	.string	"6"
+	.string	"\337;\227G\360\336}?\360\336y\264\003\274d\255\006\004"
+	.string	"\306\313\300\356\202\263\343\343u\364?\362\0022u\272\0228\354\256\225Li\334\363\266\023l/\330\177\t\347vw=W\366]\277\247jN\325S\325\252\352c2\007b\251o\b\330\315\270\331\226\326\315>0\266\257\366C.2\336e\272\301\356\n\246\262[2X!-\235(\242\303N\264\366\371\022K\031\326\356\276\205\034`\322M,\373v\267\301'yI\311\367xg\013\223\236|\347\233\274w\237\034U\201\226\013\2457\273<\351\344\260\003\243\016)\304\331\263!\201>\340H\"\3423\001\001R|: \320#\212\300\215\306a\305\203\b\216\302P\0041\345\236\333\271\362\347B\200\206\232\027\346&K\370\331\nW\233S\026zJlN\216\312\026\035"
+	.ascii	"2\241+h`\\xQ\001\003\315\001C\200\0340\026\005iE\005\002\264"
+	.ascii	"\001\306\005Y\242 XT\300@s`H\024\344\200\261+H\003A\024\265F"
+	.ascii	"(#2U\203\007\020\\lhVS\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_imuSetAttitudeRPY.101.d558f6ddfa29d91a,"e",@progbits
+	.string	"(\265/\375`\366\001\205\016"
+	.string	"\346\032_E\360\2226\035\300\367y\326\312\353V-\206o%KtfR\275g\3215\347\f),\330\223sM\325\241\3327u\3007\343\017\273p\223\210\251\242\343\2608,\266a0B\371Y3\237$,\204\355fG\332D\312\224\002G"
+	.string	"F"
+	.string	"N"
+	.string	"\330\243\237\366E|\004\351(\247\234\355\336\240X\354\256\002\037\300\036\r\234\300\365h}\300\365h\222\235\343!\270\"!~X0\321cw7\355p\322\223\344\237\304\263\357Tz\2028\330]\347wz\271\365\266Gl3\260\363%\243\3747RY\311\177Fpc\245j\321\222\035\226R9\330\267vw\2551\366e\376\316\303_;\352\3172}=\0353m=\255\231\316\247/\240\0033s\272\006\036\273\027V>V\025k>\330\276f\313\350X\020\306H\020JCS\325\020\034\320&\325\366|\005W"
+	.string	"\264KNc\002"
+	.string	"\307\3566P\361\231n\202\347]\217\377v\\S\365\205K\rS\256\354\3247\030k\3315\215dz\r\201\001S. Xre,_\342)F\330\256\351\237\177\342(*\370\036\036\235\022*\236\025=\341D\035J\374|@!\313\034\311\310\3536\321\211I\367\221\260Q\350<\336\306\205R6\022\021\203PJB\233\b\004\nmZ\270\327\030c9\031T&e\231!\343A\016\206Km\b\277\261\201\021\365R\245\351h\324"
+	.string	"8\240\rK\355\bwQ\323B\325\322' \360\002\242Q\355\262\200ie\006\002\033l\206\224\315\300\336\016^s\r\343\034\354\007\331\030/\203\361\220s\016\026\245\226\267@t\267d,\331\300\236\245\361\333\002\0033Z\003\255\027\213\245"
+	.ascii	"\215;bmL\346fv\020\362\236c\016\212\032\244\345\2050\310"
+	.text
+	.section	.gnu.lto_imuSetAttitudeQuat.102.d558f6ddfa29d91a,"e",@progbits
+	.string	"(\265/\375`\306\001M\016"
+	.string	"vY\\E"
+	.string	"\2614\0358\350\217\223\261\226\033t\025\217\313\334\351/\021\362\227&\343ZX\365R\351@\b\215\031]#\264\204\016\307}\020\333m\357\224\324X6\022\365\253\252\022 \324.\001f\252\300\210\365\025\227\210\220m\345N)C"
+	.string	"G"
+	.string	"H"
+	.string	"\366K\334D\367\031\207\306vuN\234v\027\304\006\256O\002\037P}~.\240\372tg\3378\b\263\037$:h\260\341\331\335LC\274\273\354\374\333\034\373L\336\245\305`w-?\023\207[o\273\200m\220-\265(\234\374\307\245\250\310\177\2267\250\017c\212E=\033\364\244\202\260\377\331\335\265\276\330\257\371\261\323\374\326\301\177~\346W"
+	.string	"%\251\226\r\246\213\bw[zv\2548]\214\260}\017\273F\007\b\215\215\004\240\016\202\353\323\227\001\322\206\020:\260\203\022W\3243\246\266\3501`\214\226\332#\177\201\ne\246\332$oq\032Um\3558\016\025fw\027\370+\316b\302h\333\252O\005.82\036J\262\307\226\374\315Up\327n\351\237\217\342)L\374\230O\007\031\236r\f\347n\021\be\244e'\022H4\n\021\262\nZh\224\211H&\031\350\303\233\205\021Rv\262m\244\314\003\334\353\213\257\035\034bIWj\210n\240RBCdQ\317A(\3474\246\376\220\312\227\361\031!~\214\037\210\210T\237\027\\rxr\004\b( "
+	.ascii	"\203\221\261\340\001R\001\377\311\f\006f00\204K\366\240Z\331"
+	.ascii	"\330\360H\220\310\333u\\\036\213\255X\267*N\316[\260\334\215"
+	.ascii	"\370e\347\316\345\260\335\264`\033x\022Y\204\230h\376-\254\307"
+	.ascii	"{\362p\214\314w`\245t\027c\245\344\256C`\201ly!x2"
+	.text
+	.section	.gnu.lto_imuQuaternionHeadfreeOffsetSet.103.d558f6ddfa29d91a,"e",@progbits
+	.string	"(\265/\375`\206\001e\017"
+	.string	"v\235hG\340\322&\035\222"
+	.string	"\224\236*\272\3203\345\361\263\275\224k2\032\274\316x\214\"\212\312'AZ\245\373q \330\335Z\327\223\2760!M\315\355\244\306\f3\306\030\225\021T\030\251\b\214\036\327\223\\\222\352#\226\220-eJ\001V"
+	.string	"N"
+	.string	"X"
+	.string	"!/}"
+	.ascii	"\367-\355\225M\362\002\006+\263\016\306\310\b\320x6\340\364\330"
+	.ascii	"\005=\025q\326\267\250\311\362A\276\326\267\356\303c\024\021"
+	.ascii	"\352\341Q\222\215\210\221>Xj,\001\205\320\021\340k\211\""
+	.string	"/1<|\346\351\362\2752G$\273\353\214}\035n\356\266\037\330N`\337G\006[\2513\373\032\206ah\205\261_\273;\247G\267\2719\247\243\246S\323\0079\361\221q\370.\023\356\312\302\242\375\331\\\220x\355\267y\332\2779\340\nYX\013\215\026~\t\037<\315kV\267Q}c\373\327\016\232\217\320\356*\370f\004\335\267\352`\347\344+T\232\243\002%\177\244\350\3647\027\020\204\343\3313\004\004Buf\255=\003w\375\314\273\032&d\300\222\310\234^\r\fi \362\351:\252\277\210\261Q\317A\371\316\215\335mp\3428)\276\3147\257\260\344c\337|\026\356\033\247\007\357\365\300\370y\241\251qe\350\030 \244KFVN&O\205\202\211\251\302\004\317\202)\302\311+I\245x#\005\214\272 !\345\251\240P)\217\004\356\025\306\231\347y\021-\207\016\013\365Y\234\343H\243\272\330\216j\022\227\276\034ww7"
+	.string	"i\233\230\362\261\221\252\266\354\240\332\f\033Qg(\236\227\325t\232\001\035"
+	.ascii	"b\b\270\352\034\206&\034D\261\260\253m\330(\265\343\336\020\034"
+	.ascii	"\030\020\020\bJ\202\301\334 \021X\334a\371\370\032H\220\030f"
+	.ascii	"|\331\f\345p\031\001\006vT\217Ie\b\254\222\244\030\005\256\221"
+	.ascii	"\257\304\253jdV0\367"
+	.text
+	.section	.gnu.lto_imuQuaternionMultiplication.104.d558f6ddfa29d91a,"e",@progbits
+	.string	"(\265/\375`\324\006}\036"
+	.string	"V\271\275E\240\326Jc\324\213\274\02489*\324`Dd\020\243\031~'C\024\222\006\326\210\021\360\024\315\351\311\016\323\036\234#)\327\206\002/M\216\227\343\346XPc#\021\310H\004"
+	.string	""
+	.string	"\f\310H\304\200%\237l\222dJ\001\261"
+	.string	"\213"
+	.string	"\260"
+	.string	"uU&\020Qn\205\327l6\273\315v\263\337\3548[\316\236s\257\265g\230\206k\330\206\341|\3038LW\337\\\224\003rR\n\304M!\360FE\200[\225"
+	.string	"mV"
+	.string	"\260i\330M6\013\317\256\b\257z\216a\031a^\323\340\tb\312 fguM\346\234M\026[\325\263(\264\203\001\366\233\231\034\324\202O\303+L\226\255]\370E\230\323\300L3\247\231\217\2709\207OM\352Y\354\3208<\213=\333\360,6\254]\342\341\211\371;[\322AF\2249'\360&\034f\031V\233\316-de\033,Y\n\3149+\311\312@\270w\333\242\266\bZ\226\007\001\356\225\333\\+\273\271U~s\251\034\347NY\316\225\362\234\033\345\241\rt\232\ruY\247\3136]\226\351\262K\227U\272l\322e\221.{tY\243\313\026]\226\350\262C\227\025\272l\320e\201.\373sY\237\313\366\\\226\347\262;\227\375]V\347\2629\227\305\271\354\315em.[sY\232\313\316\\V\346\2621\227\205\271\354\313e}\227u\271l\313e{\227e\271,\357\262\342ew\227\375e\345e="
+	.string	"fH\2122\253\250\233\363CN~\3279\326O\247.\3478\277\332=\307\307\2012\006ons\253\033\033&\243\260\3464\257r\271\370\232\323\034\031\2033\2279\325\214\314\2171\030s\230O\305\004\307`.3\266\"\307(|y\313\245|w\371\213p\314\210\217\210K\357,o\021jYHo\313@X\244\360\376G]\332\030Y\214\311\272\212\337\235w\361\211\217\021\342\255x\214\330\375I\336\377_d\f\216uy\207\274\021\212~YG\341zs\316\253:G\030\211\f\275\024\026k0\236E\037C\210*-\322\304d];\334\340\335\234s\312\227h\275\233s\316\336\2545\f\033\200\327\\,\263\005\006|\300\b\234\300\n\274\300\f\334\300^\025\276\272\"p\361\246\266\244\324\226,\004\250/\013Y@/\n\023\262*H"
+	.string	"^\310r`\001\b\201\253\013\b\365\253\026\206\b\\@/--.\240o8\275\2337\353-\021\001D\354cu\272\023\2527\335\211\351MKg\n.]F\r\355\210\322\231L=\351JA\244'\035\035Ih\364#\243\037\243\260\350J\210\036\365\"\341\320\211\204>\024t\241\252\007=F\r-\007\320\223x\310"
+	.ascii	"\203\304V\310\234H\375\347@\227=\306 \234\273\233S\254\310\347"
+	.ascii	"?\337Y\031Y`\275\347>\337\321\215\301\253\363\274\347\1772\006"
+	.ascii	"\255\276s\236\237n\024V}\347>54\2701\177\250Q\\f\315I0\241\224"
+	.ascii	"\224\024\024\322\034 \003\t\204\210\332\021 \235\203\314\310"
+	.ascii	"\005TY\206\032c\343\375\211\364\224j\332F +}\241\346\316q\033"
+	.ascii	"\350t&l$B\263\006\212>P\026k\344\f\276\022H*\f\0210\265Q*\315"
+	.ascii	"\233p\224\330\\fib\347\024\344\326)\334\303y/\310\036fy\f\344"
+	.ascii	"\337\341\032\372~\351\360@CO@\361\2536\004\235\306\"\223\367"
+	.ascii	"6]&h\260\005\016]\032\"\3411\370\026\226\244\233#\354\252\272"
+	.ascii	"e\336\030\275\246\004\245\005\277\335\247\r\363\016\326g%\243"
+	.ascii	")\354\035\2274|l\323\006$0\334\310\325\276\320\275\275\225H\226"
+	.ascii	"-d\300&b\206\fl\002f\310\201-\221AH)K\274\024QR\261\336\376\021"
+	.ascii	"\355\026\300\254\302\tjq\370?"
+	.text
+	.section	.gnu.lto_imuQuaternionHeadfreeTransformVectorEarthToBody.105.d558f6ddfa29d91a,"e",@progbits
+	.string	"(\265/\375`3\006\265 "
+	.string	"\026\377\317H\260TN:\344\225e\203WR%\205u+\t\327\035Jx\305\364\356\266\313\234z\3342\367\227\241&\200\035\345\272HD!\034W\370&\254}\341O\351\317\372\253\305\241\241m\200\337\364?\024\362\343Q\327\261\277\255Y\262\223\224)\273"
+	.string	"\250"
+	.string	"\305"
+	.ascii	"/r}\223k\233\\\327\344\232&\327\242\\K\271\276\\\257\\k\001\230"
+	.ascii	"(.Dh\227\330\234[g\\f\231\b\344\205\336P\375R\r\323\333j\315"
+	.ascii	"\241:l\2345\350\230_J\364\2101\347\304i\260q*\252\342P0\0253"
+	.ascii	".\fh\364\305A\3161\rr\231\b\022\260\227\332\270\322\033\034t"
+	.ascii	"\216\230\313$\005\027\213*sN\002*Z\200M\305 \251"
+	.string	"k\353\f\245q\2455:\354f\346\007\034[>\346\3642r\221ME{\351\rME\233\352h*\372\312\236\242^,\346\216k\013\004X\2269\347\357+\364J\367\312\252bz\323\022\341A\267f`\316\351\325\0221B}\265\r\300\266\317\246\021\tX{\346\334\352\230\016\021\"\005\344G\004\035S\262*\333\234X\252e\345\241=\246\254.T4U\325\252\226\212\326*Z\205\013\253Z\346M\341*\033\357\301\366\312\332\253\260U\316\247\260\345\032J\256\237\344\332I\256\233\344\232I\256\227\344ZI\256\223\344\032I\256\217\344\372'\327>\2716\222\353\236\336P\363\364K]\244aj\"\255\241\032@\256\207\344ZH\256\203\344\032H\256\177\344\332G\256{\344\232G\256w\344ZG\256wr\235#\3278r}#\3276r\255\223\353\032\271\246\221\353\031\271\226\221\353\030\271\206\221\353\234\\\343\344:\003\016(\224\3347\t\322\233\216\273"
+	.ascii	"\2601x\273\370\227\353\fG \231Z~\230\023\013\200\355\267\353"
+	.ascii	"(\254\235v\333}\020\250\223\332\025\013\323\225N{\017\330\b\224"
+	.ascii	"\377\305\357\244\214B;\20161\273\202\241\300\346\242\303uG\013"
+	.ascii	"\250\357\377\032\230\323\365{q8\006\227nt\275\212\251\030\242"
+	.ascii	"\004Y\326\2230`\322\241\316\333r\364\247\363\256\034\335\351"
+	.ascii	"\274(\2767\235g6\n\263|g:\017\311(\314\362}\351\274 I\357]i\201"
+	.ascii	"2)K\322r\364\336\221\030\350\022%G\277\241\370\352\362\275\367"
+	.ascii	"_\224\"9\342\373\355\304\231\226\336{7\372\207\2430k\317\254"
+	.ascii	":\334@\215\230\3146\347l*\"\325\273\352\320\215\261\225\005H"
+	.ascii	"\243F\031T\203nP\f\352(\337\205)\251\237\005\b\017\244$8\370"
+	.ascii	"M\220b0\365\213\262\252\360\363\355LE\241\201\325\317\002\025"
+	.ascii	"\225\325\017\347\205\245r>\205m"
+	.string	"S\220\224a=\313\274_!\322Ut+Z\210N\345,\226J\f\351\"1t\240\363\204\236\373\020\324\203.\024t\240\341\030\3749\320u\024\372\234\347?=\257\335\347<\303\337\237\336s\235.cp\347\362<MG\372\316uf2\304F\240\316q^\264\273\3165\347\271\357>@\312(|\372\3579\300\233\323\034\3475%6\257\375\346>\272\333\274\247\346\272\357\fG`\315u\300\306\340\314i\2562\227\2379m8\n\225\316t\231\353\314\272\316b\376r\242/\017\230\307\344\216;\314\003l\250Q4\245\fe\250\344\244\240\240$Is\360\002\221!\352\006\021@1T\254\202\232\226U\315\001r\322]\332@4C\301\006\222\02302P\230|^\327#\210\0342\232\027\027\275\336\n\202h[\3271.\203Na\230W}\340\275\022={F\310\017\f\344\334\"\364\337\030)\331\353\327\371\370\276CB\034\264u-\252$\356\241\323"
+	.string	"\356]"
+	.ascii	"\262\027y h\304\235\3643,H\302\013\b\233GlD\357s\335\264k\234"
+	.ascii	"\316\f\221\306\211\342aZ\221\363\036&l\274\304\244\032\234\345"
+	.ascii	"\035r\237C\337N!j\330\322\275@\3469\335\034X\320\355%\312\036"
+	.ascii	"%T\347\205\227\202\373\333l\030'\222\241~)l`\313HD\340\347\203"
+	.ascii	"Cq\t=\244,m\236\217\nRjq\234?"
+	.text
+	.section	.gnu.lto_isUpright.106.d558f6ddfa29d91a,"e",@progbits
+	.string	"(\265/\375`s\001\315\016"
+	.string	"\346\033aD\020\257&\035\203*"
+	.string	"\267\t\310\030\006\037o\352\215\177Z\330X\374\263\202\030\\\305\017\332\230 \303\365\247\324ZB0\276\027\225oM=9D#"
+	.string	"\n"
+	.string	" Bl\246&*\204\005\211s\322\215{B\310\336R\246\024N"
+	.string	"J"
+	.string	"P"
+	.string	"v\347\3616\212\335\361\001\004(\336\376\271\254hx\200Q\031\021c\367\313t\303\267[\021jn\376\365\261 \303I\005\311\343na\026\036S\022\n\360$\214R;\236\bn\354\356OO\n^J\346\365\261\273N\222W\341\276n{\3046\207}\024\001\313\2517\353\232\032R.F)\303X\346#X6\211I\236tU\200a\244\234\375\211RM\366\341j\311v\032\323\364\005\323P\323\232>\200"
+	.string	"0f\274\237dvWV9\313\"\332\300\330\276\217z\314\311A\3709\027n><\332'\001 \256\311\223\\c=\252\376t\330\201\273\301iA\261\234\260j"
+	.string	"\316I\334\204G\303ew\023\310\274D\210\377\362h\021M\273SX\217\227>\346\0058\250J-(\233.W\207j\n\361\364S\027\261\371/v\360\211\376\307zL\345h\301\322\345*s7\366x\230|\264\254\244\201\210\366\200A6\242\201|2O\210$\363 `\020\204\220PV\002\002\205\262\316\327\035\256\226\234\260\343\251\035\317h\340P'\330\306t\243S\221\241b\niTft\271\302,5\371\317o\227\213Z\362\245\252\372\"\265b\3464V\005\" `\202Q\210\224\033\320\b\r\021\031\312\f\225j8\235\216\346X\024\\\004\365\301\316R\245-"
+	.ascii	"l^\254\315\362~6\276o\2355\302CX\t\360X\216\272\305\345\332\360"
+	.ascii	"\374\3412\026\314\346\234`\347\377\266\306\355)\340s` \325\036"
+	.ascii	"C\033\205\033\233\200\313"
+	.text
+	.section	.gnu.lto_imuInit.part.0.132.d558f6ddfa29d91a,"e",@progbits
+	.string	"(\265/\375`K"
+	.string	"}\b"
+	.string	"R\21788@\217\322\001x\255\345\2600\372\"E`a~\200VH\016\246\252BH\021\265^\3122%\227F\331\b\242\b\342\f\374\204\023\222\016\250\005\272\254\375"
+	.string	"\027\250\330\312&r\247\024>\230\336\234\034gb\363\030\270O{"
+	.string	"9\210>\035\207\3734nz\f\274uD\237N~\022\021\035\005\204\254\350\264\217\334fHv\n\354\201\270)?\317\233\022\263\r\177\255\242\334\220\322\312P\r\325\224m\r\364WB6\302W\"+<Zl8\262\354\321\276\300\2007Y\240e\244\265\241%\250)\353\365k\025ek&2@\262\3531#\263%\321\005\305\276jdc\330\343Ul\217>L\262_\276:\331\263b:X0\273+\037\325\344\244+\274H\376U\0070\235J\327\200\023\310!\301/\315\302\356z\023r\307\333N\260\355\261\315\022\021"
+	.string	"O\023\030\027\314V\224\3003<@\024\fs\205\2730aqF,\352\234N\013m\246\3544"
+	.ascii	"\\{1\345\264\234~m\031\003"
+	.text
+	.section	.gnu.lto_imuUpdateAttitude.part.0.136.d558f6ddfa29d91a,"e",@progbits
+	.string	"(\265/\375`\345\002\335\025"
+	.string	"Fi\214C\320\232(\035@\224\004U\363\344\244\225\241\242\206\211\273\177R\345\211\234{\360\223\003G\2070+\265\375\177\1778\321\322\301\246m\203\227\314\301\200\200\203K\232\t6\bf\346\216\027\352\b\361\333@\204\220M\244L)y"
+	.string	"o"
+	.string	"w"
+	.ascii	"4"
+	.string	"s\356`\3023g\314\301\245A\337\245\315\rt\227\334\013t\227\366\213\330N\311\260\312\356\362\230\217\211`\310\013\026K\306\3149\301\313\355q\325\275Nr\253\237\312g\200\343\366\032W\367<\t\262\207\320\002\273\275F\033\357\3645\326\270\344\032x\211\"\306@\f \257\317\250B\271\317\350\322\255\031Wp6s\316\323\256.\306\226*\201\177\236\2049\247\317\202\3354\267\275\302\366\005{\275\017\273\023'\375\313\247}\300\216MH\315\265+\335\034\357\307\315\345a\177\237\335\236TwR-95\307\251w\325\372\330\177\001z\00343g\214\233\231\251CJ\t\362\331o\337W\362$>\315\037\333\237\245l\343Zb*\2373\346[\204\031\242\343e\316\031\2724\204\357\262\373\262\224\375\371X\365\261\324\221\244\340bs\224aU\373F~Du$)\034_\320\311\355\256\034\213\006\016\035:t\227r\177\346\307\347\234\223\003u\334\236v"
+	.string	";\366\240n\227[+\013XKo\366\253\334\212\207\017 @t\227\273\237m\331\353\234s\265\233\343\320u\305$\\\\Z\306\376\224\367\230\212\257\343\020\356qOw\251\033\341F\02520\226\336\242\360X\304IJ\215~\355\321\315\b\236\217~\347O\302oNV\223;)\341\353\\\272\024\352_\227\016\246\220\204\022\215D1\2440\302\2711M\030\341\240P\241H\002u\340\304aT\"m@\231F\242\210B\024\300\242\007(J$\020E\342\206\2043\0024\221D\224@\221x\002\037 phb$\202\2500\024A\375\362\220\375-l\267\032k[\336\346\0304#\322Ez\253\\\35053\"P4\364o]\330\n\364[\273\202\005\335\261}\251\271\270.\201\332\0302\350_\336rclYj\255]y\337 \007\026\032rA\327\035\006\230\007= \200\002\031+\335\006?\022\204\313\030L\016\372\013"
+	.string	"F\361\363)\232\227BI\216a\342\3726RWa\235co\344\200\231\017Y\32448s\035N\261\375,\006\314#h\373h^\343-W\301\222q\013z\334\256I8~\340\376\363\307\031\273\303.\211\3720\377\265#\261$"
+	.string	";\264pv4/\204,\370\n"
+	.ascii	";5^\340\361\370\274\331\361zI\221\263\206mM\331e\200\324\336"
+	.ascii	"\271 \346\340\243\307\027\234\352\351p\213\265\317\t"
+	.text
+	.section	.gnu.lto_imuQuaternionHeadfreeOffsetSet.part.0.137.d558f6ddfa29d91a,"e",@progbits
+	.string	"(\265/\375`\276\003\005\027"
+	.string	"F\351\216J\260\022R:\360\215\244"
+	.string	"pi\262\r\222Q\n\364\031\330\203\305_\231\005\251B\372\2624\340\006\372\200\334f\377\263\377\373\333\177hh\234\221n\303\365J\022\030\301\004\365K\326\013\310\020\023\347\032\363\241\230w\352\n\301\376\277\211\334)\005u"
+	.string	"s"
+	.string	"|"
+	.string	".\213l'\332\261L7\254>>\017\372E/>\274\235h\347\325W\277\333\002\332"
+	.string	"Rk5pj\002\260S\223\007p\235\316\243\270N\327\017\332\354\322\276\331\345\351]\230\245\305\346c\333,-7\343><\321\003"
+	.ascii	"H\354\020\303X\353pv\272&\216\373N\022\347O\337O\356\373\342"
+	.ascii	"I!\320V\211\036J?!>ON\276^j\255\206\211\270\351m#\260}\300&\025"
+	.ascii	"\004\307\271B^\362d\335 \333\3231:]B\247I\350\364\310\211wI\247"
+	.ascii	"E\350t\b\235\206\321\351\027\235v\321iJ\247I:\275tz\322\351\247"
+	.ascii	"\220\300\253\330\257\326\236c\220:\2026\245\270\321\217\364\023"
+	.ascii	"\277\366}\245\"\321\366%\035\313x\303:$\3433"
+	.string	"n_\322y\005Q\347\016\026\300\033\005`\2472\362(.\227HIGG2\235I\345\361D\321\270\321\205>\214\233+wd\313\035\212(\221-wb\365\264b\223n\310\33234\363>\221\225\361l\016\266!\273T\257u-l_K\275\337\256\346:\240^\233\300J\250\243=\007\016\327\272\220;\351.UOE\361&y\265\352Tv\311\025\340\324[\261\233G\317\375\356\016\200\352\375v\026\376\3444\367QV\266\315k\270\b\253\265\272\370Lo\252\371C\247\326\2003\357\303q\235~\201YOS\277\240P7\003:2;\313!fzfe\203\rm\226S\241\206v\201\302\f\003M\306f6s\2033[Iq-\003\315\315,\247V\273\231\225'\353\006\371\305\237\314\037\347\212\255\007\333\261\365\213nw\336\223\273BL=\037\222\352\222p\311\332\013\256\225\305\240d\247\224\217\240\024os\r\216ue4\352Tl\007\267\252\202"
+	.ascii	"\364\243\205\221d\355\007\347\341b\254j\352T\021$\300\3008\371"
+	.ascii	"\264t\363\350\2239\262\366\204\230y\037\311\312x\001J\250q8\005"
+	.ascii	"\215r\002\022\242$\222\322h8\220\002\221\271\252:\0210\275D\024"
+	.ascii	"\bU\250\260\245\3550\004\353\"e\273\321\375\321\n\3001\311J\305"
+	.ascii	"V\235|\223\017\225\377_\370x\234\355\234&U\202\360\210\003\202"
+	.ascii	"\n\023\253U<|0\344\312VS\035Z#G\330z\325\303._S\377\246\016/"
+	.ascii	"\221\026\3000\264A\311\0326[\006\331\343\271]\252\231\353\276"
+	.ascii	"tX\333\344Ua\353\n\252m\005\021\016j\347\212\243\036\004(\252"
+	.ascii	"9#\022\232\327'\"\273\304\341\263\200]\b\260\212\006\312\316"
+	.ascii	"\250\342\025\334X\227?\345\241\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.d558f6ddfa29d91a,"e",@progbits
+	.string	"(\265/\375`\r\006\025\027"
+	.string	"\326c\203H\240\332I:|\257\241l&\r\022\251q\233uh\215\305`\320a\214%\324\325\253\360\354\030\017_\210D\357:4.\205\327\201\373W\001"
+	.string	""
+	.string	""
+	.string	"d\321\023/\037\245\361\r\255Wbku\207\354\226E>\265\270\204\354&\267L\001k"
+	.string	"r"
+	.string	"m"
+	.string	"5\207\202\376\327\316\2018\365\276h\272\027:@\2112\365\272\230U\024\307\245\336q>\253\347?t\357\242\324g2\223\276E\221\276\343\250\377d>\313\350Ar?S\3641=D\027\203;\030\356\365z\275\004}'\023\301}\034\350\203\315\241\367\bp/\312\377\216\225\347]\364\377WE\261\342\370\373'\002cg\265\326*\324G2\377\203"
+	.ascii	"\002e#\372W\266\326\372\363\210\350\223\331\020K\024\304\207"
+	.ascii	"\320\237\205\025\326\225\212\252\017/B\177),\251\035\026\325"
+	.ascii	"\025\225UT\325\212\241\357\330\302\303\217\320\016}+\034\372"
+	.ascii	"U6\364\251h\350\213e\350O\301\320\227r\241_N\013\375(\263B?\214"
+	.ascii	"\302\265L\350C\231\022\230h\204&\nA\367\240\277d:pj\320W2\241"
+	.ascii	"\316\305\340<\236N\322\005\027B\377O1G"
+	.string	"!\327\220;k\255YI!\203%\310\303\321x\311#\032\357v\313f\364\274\220hl\303\265\324F\215\257\331\307`\271\341\030WW\321\307K.\347>\336q\327\350c\250\345\334\307S\342g\034\362\302\261\246\206\246\304\315\230\206$\232qU\037K\212\376\030U\377\313\256\317\005E\177\313T?\213T\277w\242_&\252o\306D?L\211>\031\211~\377\311\t1\201\002\006x\303\366d[`b\266 \376x7\376\304\360\306\313\365\333\215\277\022H\007\364$:nh\325|r>\2744v\265\312\264\030\271\321q\322\341'\035\006I\"\034\006yM8\374\221I6\006y6\246\341\341l\272\032?\355\354\253\361\256\306\240\270A2\232\304\240\325\030$k\374s\303S$O\271C\n(s\310\034[i\033oB\036R\3106cr\2501\020\211\242\330(I\222Bi8\300\002!*\233\016\021\200\220'\221C\321H(\201\224\350\001"
+	.ascii	"B\300\343\342\031\005\001k\251\032#\020\"\215\001\212\315\301"
+	.ascii	"V\234/{5\r;XO\326u\224\226v\022_)\215\216\350T\221H\330\3110"
+	.ascii	"\2247\341Db\311+3\201U\331\356\252\206\3102O\353\216\341px8S"
+	.ascii	",,\005\333\335!\372\031\263\317%\374-\247\317\237\357\r#\236"
+	.ascii	"D\240\317\251\222\024\215g\335\264v\036\3148\337M-I\374\007\266"
+	.ascii	"8{\2721t\325\365\006\023\277\263\034\344\3408\313q\320b\302,"
+	.ascii	"\225 \240\216;\3206\020\270_\263\221\357\363\252!\377E[\021\254"
+	.ascii	"\037\232\"\016b\343\353w`\2631\346\343\232\013B\264\320jx^|\206"
+	.ascii	"\353\321*"
+	.text
+	.section	.gnu.lto_.refs.d558f6ddfa29d91a,"e",@progbits
+	.string	"(\265/\375`\023\001u\n"
+	.string	"\206\336K.`i\223\306"
+	.string	"5"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220v\305\206\216\307\3074\3661\353\300\001T\377\315\032m\320oD\335\rm\"\215\220M\244L):"
+	.string	"?"
+	.string	"B"
+	.string	"\rG\227\243\f\206\336\314<*A\275\254\203\333\006\267\027\267\026\267\nn%n#n\037n\035n%\266\021[\311\026b\013\331:l\027l\237\325\261mV\306vY\317\366uR{\004.\031\203\322\nk\245\260\324\tk#\234B8}\260\226\301\351\305\332\212S\212\323\211\265\021k)k\235H\233HU\244K\244C> :\016]\032\372\271pR\314\224,\215,ep\024\362,\364h\225\275\212\004\026U\304.\003\366 \326 v\210\037\224\200\003\230\021\307J\215\205\034\366\321\260k\242\017e\231\211*\312>Q\342\b\231\026\232\3661\255c\332\306\22415\323\315\bC\007\2002\220.\016=\311\002R\230\205M\254\342d\032T\235\236r\342dD\312Xd\276\371d\013\032\227\245/\023\230\216d6j\325{\257\215\240qI\346\263\266Y\273\254%\224Z\337\003\213\201\275g\177,`2*\333T\226\t\t"
+	.ascii	"L\233\"Hk/w\031\227\323\241\366\253%\256\210\306\rNx\013\020"
+	.ascii	"T8\204)"
+	.text
+	.section	.gnu.lto_.decls.d558f6ddfa29d91a,"e",@progbits
+	.ascii	"(\265/\375`\035J\035H\001\2328\372zW LQ9\351\302F<\035\361\230"
+	.ascii	"M\300/\322\b\016\027\210\273B\311A-\b/\034<\021\324\255\341\006"
+	.ascii	"\346\211\331\231\037yn\300\2541\0309\257\254~\253Bj\364\352\""
+	.ascii	"\261\371\213Y\177\235\256\365\342gW\036$7B\214\307\267\370\335"
+	.ascii	"I\367\002\261Z\034\331\221\220\275\345N\001\251\006\265\007\307"
+	.ascii	"\007\357,\347\227\033V\r}o\271\360\343*"
+	.string	"\321\371e-:\2574\202y\220\265\350\254U\225\350\274\355\201os\340:E\007\327\253(\311d\214\246\034\235\234\321?lx.p\240\265Y\020e\023-}\337\301\327\327d8\311(3k\260\257Y\263\251\t\\\220\211:k(5\331f\215\374E\346\020!\214p\03496/\316\373\246\303\177\227\221A\311Hd\364%k'\225N\215\253b@\030\235'=\326b5\331d\035V\347\253\235\360: k\260v\252qC 06\307(D\210\0229\336\274\340\373\206\303\357-\370\315\206\337h\370\357&^>T\272\336\\\351\013\244\271\202\232\206rFR\247d\322Kj\262\275\274:I+\251qCn\030\334\207\020\227\312R\313\313\331J\272H\335\251\341f\206\245\357\033\211_\353\030\241\353j$\335\325[5\331\\\177k\365\217w\220.\022d\346|\225\246\213\253\217t\221\0327$\337\0268\322\340\2269\347\020F!B\020\237"
+	.ascii	"\231\203\357[\f\277\231\340\026\322Cj\362C\023q3\304\211\252"
+	.ascii	"\357{\013\223 \347\372\341\254yy\365\303\371&\202\337Y\230\203"
+	.ascii	"Zt\236\235\205\001~\312\2426\326Xm%\347\013\216\253o[5T\343\260"
+	.ascii	"fS\023 3\247\354\2474\225\354\005\232\277y\364\216\366\321:\272"
+	.ascii	"G_\325d[u\216wU\317P\342\203\266\2525T:\026\331\265#EK\2152g"
+	.ascii	"d\215R\363\332)\250i(?9\325u\345\214$\361\266j\027\355d\221l"
+	.ascii	"\370\005\024:e\316H -:qO\202nE\326\242\323\250\022\235\357\251"
+	.ascii	"\033\225\210\032\225\267\276\357&\374\277k4U\333\250\311\226"
+	.ascii	"\241"
+	.string	"\245hx\031\233\352\031AOC\371I\013LWY\313\3200z\006\325\216\326\027\251\260\237,cn\254\360}=\203_\273\340\3277\3341ZFM\376\255\243\316\363\204\314h9g\241Jd\313\221H\337W+xE\3169\327\277\235;yyyy\365o\347k\032~M\342W2\374\232\004_Y\213\316\327\037\270s\037k\022\203nz=S\353\334lBfd\316H\2416B'\rJ\337\327\035\370\025\203\323\346\345U\f\316W\034x\250\026\235UN\235S\223\025T\274\227\370\340\366x&\004T\007\254\316\234\276\2574\360k\005g\315\253\025\234\257/\360_\227\025\b!q\314\370\021\347\250\0063N_p\354v\304\264hM\351[\355\272\276\251w\257v\325\315K|\360\237\247<\2263\262\332\335\234\233j\035@P\255\0030\337\266\232\240\234\367\365\210\377\332Fi\204\013\026T\337\312\306\250ep\302v\246\357\205\370\257k\324"
+	.string	"\r\311C\236\251\371+\232JW\353x\330\320\324`\322\367\257s\257u\177MS\311\276\326W9?\345\234=\264\2306=\226}\177*\321\331W\265\350\274\240\022\235\365\f\211\3279\242s\252\n\231\247\344\234\205,\233\026\027x}\333\f\334\317U\220$1\372\326(mS\270d\tc\213\342\306U\257\254]\331\322\343\355\310_\345j\230Z\246\202\251d\352\230*\246~\251q\225\206\232\254p\177\355R\275<\325+lj5\n\026\2621\270\252\345k5nJ\355\302\322E\231s\016a\024\"D\210\372\003\017\315\326\004\267\221\265\350<\252D\347]\300W\302G\361[\300\357\341w"
+	.ascii	"\237\005|\f\340\243\300W\001[P\211\316\277Z\371\253X\035\253"
+	.ascii	"U,T\324U\236\2223rC\233y#\344G\337\377uJU\253i\225JM\326*\177"
+	.ascii	"\215R\245\374\"s\2562f\346\243\003(;\312\316\276\026\304\223"
+	.ascii	"3\027+\266\234\363+\331O\342\257OjY\255R\221_\013zB\346#=D\240"
+	.ascii	"\2209Y\346\234\215B\204\b\021\302\244\3022\344H\317\255\271\026"
+	.ascii	"\235C\225\350|E;\207\263\374\301{\3601\376\211\177\361\033[P"
+	.ascii	"\213\316[\211\316\307\325\242\363\310Zt\342Jt\366\022\316\230"
+	.ascii	"\346\267\031\240\177\177\300\"\375\307\313\322\277\tX\020\200"
+	.ascii	"H1\254\340\277b~\013\200\337N\360\373\333\005\374\337-\177\037"
+	.ascii	"S\374\315\322\337\370o\237\277{\376\006:rd[\bz\321o\002\245\260"
+	.ascii	"\260\305\201\2773`;p\242\323\240\377\242i4\205{\370M\013\374"
+	.ascii	"\366\350\002_\n'\372M\021\236\202\216\017~\376&\006\033\370\233"
+	.ascii	"\233\344\257y=\001\013\202\277\326\371\333\003\333\373\233\026"
+	.ascii	"\206\371\265\217\0036\316\341\277e\177\217`?0\242\006\340w\365"
+	.ascii	"\003\005\177\243\260\036\370\217\227\345\357\ft\340\357\274\277"
+	.ascii	"\213n9\360\333\r\030\035D\nC\327\340\2779\376\277\371\035\230"
+	.ascii	"8\271\345S\260, \240I\220Q7\370\353\b\033T5\250\036\374U\304"
+	.ascii	"\337\"l\006~\213\201\025~\313!Em\213\342\267'\376\033\375\347"
+	.ascii	"\200\211c\360_\265\277\213\254\005\376\226QI8\317o\n\331\005"
+	.ascii	"T1D)\374\035\202E\341\377\233\337u\b\356[\034[\201\337\216\240"
+	.ascii	"\200\235\300_# \302\337%\354\t\326\204\021\034\304\017\360[\t"
+	.ascii	"\374\307\253}\001\374\367\356\177\232\377uW#\205\312\224+\255"
+	.ascii	"5q\n\376[\374k\003\376\272\200\277*\340\357(\377\357oJ\375\215"
+	.string	"\346o5\177\327\375M\367\267\231\277\347\376N\3637\233\277G`\035\360\267\333\337e\376\246\3016\340\377\320o\312\375\265D%\361\013v\001\026\376\307\375\007\363\237\2061\377\345\376\303\375\367\362_\314\1772\367\371\257\001\376K\371O\345\377\224\377i7\377\273\302o\031\360[\016~\253\301o\217~k\200\337R\360[\242\337\006\375\366\347\267\375\333\377\215\367\267\234\277\227\177\333\375\355\346o\345\337R\376n\362\267\327\337[\177\247\177\013\371\373\352o\035\177\333\370[\003\177O\375-\374\233\306\3372\376\206\361\367\213\277[\374\035\202\277\235\376>\376M\202\277G\360w\f\177\033\377\026\301\337\303\277]\370;\351o\364\357\337\337\276\277{\177w\340\357\r\374\235\342o\025\376N\341o\n\374-\201\277I\370{\001\177'\340o\240\277=\370\353\317_G\370\273\304\337\034\374-\342\177\212\377o\376\327\375g\363w\377\255\301\337!\376>\372\373"
+	.string	"\177W\3607"
+	.string	"\376\246\340\357\242\277\211\376\346\360\367\320\177\274\277\366_\021\360?\205\277\203\376\266\177\377\257$\374\325\304_\035\360\037\305_?\370\353"
+	.string	"\376j\301\3778\377\341\374\277\373\257\374\257\346\177\231\377U\376\243\360_\351\377\227\377\025\344\345\345\345\375<\310\377\207\305\357\201[PhY\371\370\204\344\270a*g\035\241\320r\336\360\364t\034\341\212\n\n\255)o\200B\313T\271\305\030\252\232\221Y\307\374t\2257\344\247\334\224\321\256\250,\200z\312\242\202Bk\242\332"
+	.ascii	"\205\226E\225\321\262\362P~j\232\202\361\224\2476d\264\2546\031"
+	.ascii	"\355\212j\b\n\355\212\n\n-+\254\306\200A\327\304\206\333\020"
+	.ascii	"!>\252\034\324S\2461\203G\323\324P\034\024\362*\317\345\\\247"
+	.ascii	"\270\310S9.g\002\344\314\343jj\256)Ges\212\243\341T\245\351\252"
+	.ascii	"\"s\316\037f8i]\345\247\270c\315qP^W9{9)\345\0319\347\354\301"
+	.ascii	"\021\031\227\211\324\270\343\017\0369\312E\316"
+	.string	""
+	.string	"\310\310\234g\344|\2549.\347|\3149\357L\361@\346\254c\b\252k\306\214\234\253\214fd\036\3076\0279\367\024:6*(4\255+\022mQ\320\272\362\013\344\261BE]\345\256<\2275\205\321\216f9*\347\\\337\340.*\033n\372^\257\0376Bh\210\365\375\317\022_%\026\315\034\0377\372\376\247\f\276]f\230$gm\372\376\247\013\276Hz\326\324\252\250\240\0349\"\305\tNy\325\364CM\337\377\204\025)r\235z\246x\250\220\371\242\374\302C^\223w\310u2\241rS\022\016\304\332Te\320Q^\326\254$\021r\203\234V\264\374"
+	.string	"\322\367\002A\242\345\234?\3245Vs\336\372\376\307\n{QS\376\270Y5y\265\320\264,\330\305\n:\"3\325\t\203\310\017\225\036/^\234\367\277W\277X\335\005\0049\243]\031RD\331\367\372 \361{\305"
+	.ascii	"#?\302\372\332kee\343L@\346c\220\024\326\217\024\376o\325/\217"
+	.ascii	"\377\316pu\334\035Bh\274\224"
+	.string	"9\366E\216\345\234\205x\332\3460\271\321\267\306\325\242\023D%:o\016\022\277U;E\260\310\214\364\245\240\022\2357x\314\274\261\232\322\367?.\360\177e\260qs\310\234\372\276\202\325[\243&o\215\252\344\201\312\331\206\006bfea\313<5\225\301}\350\216\356\224\320O\023\216+r}\357#\207\377+\365K\203\206.'N}g\360\b\251k#\246\357}\332\360kY\013\035].f\350\2720n\324\225Q\2237\306}1vc\\\250\016\222,y\362%\324\244\265E\004\337\373\254\341\373$\361}\240\340\373\230\341\377>]\247\237\2725\267\026\267\351\3321&B\332\372\336\247\t\376\357\321\326\001jB&\306\214N\263u\232J\255\013zB\346\343\251F.L\313RJ\235\236rn\265\t\323\262\314\273\331\322\261x5i\353\330\032n\345\3309i\266N\253\251\351\312\031i\353\364\025\273<\356X1\013\323\262\3149\363"
+	.string	"\2512&\253\347\372\344Zt\326\256Jt\336g\006\216\343T\003\222e\337\373<\341^\243\263r\366\214\215\013\312\332\272\255\303\364\030k6\205\325\234\226\312$\266\t\024\272\256\266&\323m\264\216\310Z\274u\227\243\262$M\360\226W,\235u\222[\230i@F\325\004o\t\246\332=\200\252\t\336W\316\310\267\227\277\333\350\372K\265\253qU\371\330\346\2022\254&x\313\206sK\327ql\220\020\\LM@\253N\231s\246\263_6\016\204\023T\3165<\020k\323l\177\267ai\267\032W\225\233\216\036\224\2315\301[\366\033K\327wj,\034[g\335X6Vi\357\354\033;g\323\3305\026\215\265\263m\254\232\232\264t\226\310\273J[\261B\350\354\020\333\025\202\213)\036\032P\322(sF\366\033K\327v9Sy@&\327\004o\031\004\205\007\333\231"
+	.ascii	"\\3\325\253E\231W\337\367P\241\241&m\031;\346\327\226\261d\252"
+	.ascii	"\232\0327%g*\r\300\250\226<\251;\2768\211\271\367=[\370=3\340"
+	.ascii	"\367\304\300V\314\007\241\037B\232\312\364=\217\034\ff\307,\262"
+	.ascii	"\253\004'\032_,\234\005S\2236\314\223\rc\311l[\b.\246,\3404C"
+	.ascii	"\031\306z9\030\020NP\271\t\213\203$5 \351q\243\f\351\342\003"
+	.ascii	"\337\363\224\341\367\217\264\0175n\b\004\224\250\225]\001S\266"
+	.ascii	"\331'v\n\b'\250\np\251\242T\373[\020O\316YS\254\204)\253\034"
+	.ascii	"\325\270)#\260\215)sF\3326\273\3667$_J\333f\251|\bjB\346\251"
+	.ascii	"\223\b\221\"_\313-\266\213\305b\265X7\373f\271\330,5i\333,[\b"
+	.ascii	"3Jr9\207\303=\226\203\217\337\340\3434\370\230\f>\366\202\217"
+	.ascii	"\263\340c5|l&\245\312\221\315\030\251\276\307]h6Y\2236\212E\226"
+	.ascii	"\331\263\037j\272\242X(\366\214\203\232\271<0K{%\215]\362\274"
+	.ascii	"\337a\203\177{f\346S\207\314\252\216\231E\006=\341\212\372\321"
+	.ascii	"\367;[\360w\330\360w\322\360w\316\360o\305n\307\272\013\b\314"
+	.ascii	"4\030_^\364\265a$n\305Z\f\211\252\321\027\203Jt~G\f\177\247\t"
+	.ascii	"\376\216\021/\313d\t\336*\303\303\255\357wpx-!3%\317)\271]\362"
+	.ascii	"5'\335Q\213\234\035)\313\265\205\207\243\215\253\357O9\3705i"
+	.ascii	"\221\330-+^0\252\034\271\335\372K|P\355~2\210\0379`\340d\350"
+	.ascii	"\373;k\344?O\220\231'kY\372\376\326H\221\240\031crV\021K\204"
+	.ascii	"\007\316\034\035\261\276?\333\340\237t\230\203JtZ i\310rD\351"
+	.ascii	"\373\023.\313j\325\244\375\321xF\366G/{\016\032\345\217\246c"
+	.ascii	"\257j\\\325P~ZCGY\243h\251\343\346\274\226\312Z\325u\371\260"
+	.ascii	"=,VM\332\253\333\253\256c_\004\0357\344\034\004\257\353\312B"
+	.ascii	"Y\251\240'd\256q\262\311l\334\226!|\242\200X\035\361\375owX\036"
+	.ascii	"5i\255\254\016\243\016n\330\031j\\\0252\327\bR\273b\343\266\264"
+	.ascii	"\2625\254\f \234\240LpK\243\304Y\212\270\0219\357O,\370\2673"
+	.ascii	"T\301X[r\006\207\315\321s\243*\316\255\357\317(\030\307+\215"
+	.ascii	"$-\276\364\375I\206_\223Wcm|\3155\002\006\007Y\337\237_\370g"
+	.ascii	"\022\374s\013\277\003+ea\330\250\0327e\004\2705JK\303N\325\244"
+	.ascii	"\225\2623\254T\347ya\243\f\342Z\"Fv\336\237X\370:y\222\022\246"
+	.ascii	"\257\225acd \2405Vo^}\177\346\300?\247\360\317(\374\337\266\260"
+	.ascii	".j\322\276\260OF\310\234\253\274\260\331:\201p\202:\241\207\034"
+	.ascii	"\345\230}\321y\225N\320\021\231\245|\270\272\330\270-sF\032\205"
+	.ascii	"\b\261\363\003KY\221\363\336\224\303\277u\262Mv\006(+xHsK\025"
+	.ascii	"\r[I{l<d6\362\241\213\221\327\364\275\351\005\337\304\202o\246"
+	.ascii	"\341\233H|\323\013\327\320r\244d=\371\352{\263H\rf\026\276\331"
+	.ascii	"\003\037Y\211\316\2339\360\315)|\266Jt\236\255\026\235J#!\033"
+	.ascii	"VR\240\372\376\316\301\357\200\206>c\315\2460\025!H\2249#\325"
+	.ascii	"4\233\232\3545=\267\246\321t]\215\233\222\233l\\p\2474\203e\t"
+	.ascii	"De9\007\307y\351:\215\220\214\255\027F\310\350\224\340_\2532"
+	.ascii	"m\246k$\213\\\25227\006\276\215\323r\225\f\03490\372\336\316"
+	.ascii	"\341\206k15\331q\277gW\031-g$\220m\302\021f\255\357\353\321)"
+	.ascii	"tt\336\212\301\267o\370v\n\376\\-:{Ksywi-\271\273xp\225sSw\021"
+	.ascii	"\302\313\271I\250\326\001\324:\200\033\246\305E\345\274\267P"
+	.ascii	"\360m\023\334n\257t@\220=l\3602\345\243o\t\022\001\347U\017 "
+	.ascii	"4\254\030\023\n\2346d\372\372\370\007 3m\222i\372\336Ji\265`"
+	.ascii	"\353{\017Nn\3408w\\\0319;q\200t\232\313\271\352h\002,\313\263"
+	.ascii	"\252\237;~\352(\361\301\337 P\347,l\206\237\247\323\302\334\221"
+	.ascii	"\365\275\007.\374\2733\207\22392\314\344\330!&C\220#}\357\341"
+	.ascii	"\n\337\303\216s\352\234:m\314\b\342\302\242\341\346\254\361\323"
+	.ascii	"\306\032\326\334\fB\372\236T\036h\2344N\032 \332\344\226<Y\346"
+	.ascii	"\\u\344cEN\353I\337{hz\372\031\343\351\214\252w\025\231\253\256"
+	.ascii	"\216n\f\340\303\013\034\267e\206\342q\224\024\304\007\230S\306"
+	.ascii	"\317(0g^\222-\353\204\372\t\343\347\3319S\346\313Y\337O@\005"
+	.ascii	"\237.~\276\370y\314\0356\322x\365\375\004"
+	.ascii	"I\374\237-~\236\237!`\340\334\364\375\004e\370\023|\235Mg\023"
+	.ascii	"\211,7v_BE\306\336\200\351\373\t`\324\251s\346#\034/\033\006"
+	.ascii	"\303\214\0173\357g\006\272K\306=\301\361\237\347\204\223\302"
+	.ascii	"\223\323\367\023\034\361\360.\227z\226\245:\220\215a\303c\271"
+	.ascii	"\223\306-\206\231\0279r\314e\035B:\225\211\352\312\271\352\b"
+	.ascii	"\037\315d\360\352\373\2425\f\007\216\271\254gY\352\002UG,\234"
+	.ascii	"!q\023\347\346rM\n\235\\\226\"4;\273Zg\204\314G\020N\250\200"
+	.ascii	"b\360X\352\350\373\"0\374\233nL77I\017\345\254U\306\226\247\252"
+	.ascii	"2\2505\340\2402\322\367EE\322nb1\323L%\t\247\334\204\304\002"
+	.ascii	"23\323l\t\222\027}\331\3544\2351\323\245\357\213\254\260\231"
+	.ascii	"\305|{R\027\305\324\222\246\213\371\245\306\r\201@\0231\312\316"
+	.ascii	"3\335@8A\23106g\2061\313\\Y*\3159\223\313\034\235\271\306Tc\246"
+	.ascii	"1\317\230h\314\272\2324\347L0\346\234\271\005\2152g\244\220\235"
+	.ascii	"\230\224\034C7\313\325\200p\2022\341\311\032\223\006\323LM\232"
+	.ascii	"en\324\201Y\306\2043\311\370XqC\247\344C\b 74\314\3558\357o\222"
+	.ascii	"1\307TA\ny\323\327\224\333\251\312\361\245E\337w\240\203\177"
+	.ascii	"SLM\232q\370\356\253mN\337\337\361\370l)\242%\007\277\203\035"
+	.ascii	"~\2073\246\027\\Fi\005\327\367\035\344\360;\204\301\357\240\005"
+	.ascii	"\277C\033~\207*\3707\337\334\320\274\330\301\271U:a\242\234\372"
+	.ascii	"\276\303\024l\256\231mBalA\324\372\336d\373\317\223B\0211j}\357"
+	.ascii	"\225\376\302\3255\243\357M+AsH\322\314\372\336\254\242\226g7"
+	.ascii	"C_S\r\273\350\020\206A\217\325\025\037;\250\334T\373M\260\366"
+	.ascii	"\022C\036\2358}k\032\0227\251\370\300iQ\226\365}\007!\346\327"
+	.ascii	"\315(\346\227)\345\250*\327\320\200L\216G\006\026\315\255\305"
+	.ascii	"\262/\362\311\007\227\264\032\372\232g&\232\231\374yx\262D\221"
+	.ascii	"\341\321\367\035|\340\233=C\306l1\351\333\365o\247\211\274i\366"
+	.ascii	"\363\354\214M=\245\365}\007\035\370\346\023\263\354\347\261t"
+	.ascii	"\300d\201\321\367\035j\340\233d\377yJ\220\006\013\254\2579\206"
+	.ascii	"]tp\302\200\207\356L\215\221\260\233c\277)\326-\272\013\b\242"
+	.ascii	"vT\261\351\033T"
+	.string	"\211N\023\214\304\315\260\346\232\362\345K_\240Jt\236\b\r6\233\230M\362]\033K\346\246mM\f\027\227\351\345D\252\353\254\022%fc\311M\257*V\246.\210\222\035\027^6\222J\222\2302\304\260\223\232a\311\324u\341\352\272/\252\344\225Q\366=\021\027\021\"\346\326\031F\256,\354\353\207.\331\243\312\221\233[@l\224i\313\276\246\221\237<\256\256\271\276f\021\263\252\r\0201elde\231B\230T\365\2201K\"\026\344\246\020\373\345\312\335]_\023\b\376B\223E\247\257\371C\213(\233<L\036\346\025\003\226\320\351\342\351j\273C\232>n^\345\325\265\215\3655{\230f@\332\306\3645\255\204\256\230\315\031\351\373;\236\312\344\n\030\225\276\347\260\306\274a\3360upYR\247\334\212\222\261\234\341\246\2165pZ\3148\322\367wf\325\177\036 \274+\034i\372\376f\225\231\003\253\005\023\271\333\224\237\324"
+	.ascii	"\326\327\344\020g\3260k\2306x\342\234bm\204\274p\021C\306\264"
+	.ascii	"\361\265*#S}\317\201\r\377\346\324k\322\234\272L\214\316\362"
+	.ascii	"qg\r+L\213\2353\213\213\323\367\034\252\340\233Q\325\244A\343"
+	.ascii	"\342\250S8\n\0241\345\316\024\270\032f\370\365\3428\237A5e\310"
+	.ascii	"\370\233\t$h\215)\363TU\006g\020 yj}\317\201\t\376M\030\257I"
+	.ascii	"\023F'-T\316T\02789\342![\266\364=\007$\346\013\363\305\005{"
+	.ascii	"\303S$l,L\337s\300\201_\335T\263\205\331\242\332Ud\226\352\340"
+	.ascii	"\244\215K\006?M\322\214\301\351{\016-\360o:9}\355\016e\031Ni"
+	.ascii	"]u\360o^5\217\346\361kuj\202\027P\250(\331\340\257\375\357\002"
+	.ascii	"\3240q`\240\251S\223\267\316]b\241r\223\226\006`f\033\340\360"
+	.ascii	"\177\361\360n\222\236\214\307h\325)o\310p7\246"
+	.string	"\3577X\301q\342\\98\1771\303xp\264\2265\374\312Y\323ss\260\332\372\336e;Y\245}\335\350\373\273J\347?\217\251\005\247n\255\3577 \337\334\2737\227\213\235]\0279s\312U\215\035}\277\001\013\177hN\2336\225N=\313R=0\216Bp\232X\031\351\373!6j.\0335Wm\315\232\253v&i+\013\373\312UUGBf\224\311'}?\024\006\177\b\r\315M\203\346\202\2359W\344\225\324T\256\232:\242\243\273`\370\230\363\021\231\245\214\304P\325\035J\274|\365\375\320\030\376\320\026\376\357\231\344=\323NGWMM\0278i\203\265\270\364h\321\367CVe\312\\0&m\206\240\310\220\371[\235\302R\234\246(\357\360\177\345\222W\356k&\344\026f!8i#4\006\016\356\212\371P\316\331)\347\036<N\253\266\251#1\177\273L\350\310\222\364\275\220\031\230\327\344\005s\271\216r\256\301"
+	.ascii	"2\254\2367U\270r\337\013}i\371K|p\273\\/\325\016\002N9\367\030"
+	.ascii	"r\202\231\t\035\331\262\345r\251y\352\356\004\303*\013[\346\252"
+	.ascii	"\252\2433\315\205\0219}\271\360$Y\242\025\325\367BT\370BN\370"
+	.ascii	"\277Xj\362b\271n\367,\037\203\222V\244\302\2269We\300\003\303"
+	.ascii	"\314\226\225\2767\313}\"\203\213'}\037\324\006?\210\016\377\227"
+	.ascii	"\215\255\3221\272:\272\261\240,\t\034\257e\316\\20\327\240\344"
+	.ascii	"H\322\367Ae\370\277V\252\334+\227\n\037\247\260\032\027\030"
+	.string	"e\020\021\374 \252\264\264\2536\007\213\312\257Z\320\330\233\262\206\276\277\273T\377yzoE\226}\017\364\006\277\332\325+%y\245T;\243||c\201\330\021\231\301\201\302\220\235\354&k\3169W\345c\233\017\304\230\225\205-/\332o\262\207\206&A\352\364\275\310\013\345?O\327}1\323\244\357\177\241\234\365\250\301Yf\251l\204\312\\Y\363\245\3575\273e\026\355F\030\253\276\367\t\217\231\230\031\304\272H\227\335\221c\337\003\211%\257XU\303\003\2253U\b`r9\203\003\215\341\337&\327\311\357\327\357\327\005\353\234s\356\332\221\002D\2072WM\035]0s\214\027\022*}\017\244\205\377\327\367\177\346\246\251\234s\r\023\231\247\234~\316\277\276\232\265\036\375@\325V\002\374\2779_\001\036\310\331\351mH\316\271\332\341%kM;,\310f\\\316OYG\bdQ=e\345\200B\313\242\332\020\251o\030TaR"
+	.ascii	"\"\005\n\201E\241\017\210\344;1LQDQb\022\2124\224\242(\004\340"
+	.ascii	"\302o\030\024\032;\\I\204\007\016\301\240Q(\034\nw\212\251\221"
+	.ascii	"\251'\004\246A\240\261\205^/\250\230\032\231n\t\241/\365\375"
+	.ascii	"\370|\256$\242\030\f\372~J\251oi\004\fC\242R:\024\356\250\360"
+	.ascii	"\241\301\233\026\205\303\237\251\"\025\002\211\301\363J\"*`\241"
+	.ascii	"\224\006}\250\t\305\023\212E\037\323\322\3607\264s%\021Dt\005"
+	.ascii	"piD\222\020\230\001$t\005\260\204\"\320\2478\374\365\254\030"
+	.ascii	"\022\231\230|=!\260\330\203&\371\210\350\013\"\374~\276\036\026"
+	.ascii	"LC\023A\351\225D$1\215Hb\"\372\t\215%\370\bU\264Y\354%1\375\244"
+	.ascii	"=a\022\223)Lb\262Ji\222\020\r\236h\f\300\342e\3014"
+	.string	"\374]b\312d\017\304\202\230\026\201I\350\211\036\007$t\007\t-\032oq\347\276\324\207\224\242E\224\330Kb\022\021\324CS_\220i\tM\221\304\364!UJ\002\022\231V(\002yX \r#0L\241\224\022}$``\2118TQ\024\372\210)F"
+	.string	"\203L\3004hD\301x\001\016,\250p\"EQ\030\227\200\033R4\t(\r\002S\024\207&R4I\350\367\363\331%#\nt\t\230\342\367\363\365\244B\343\320\204\317\222\021\305\357\347;\227\214(R\264\210\2360.\001=\024W\020\372~C\277\237\257\367Sqn\240\0304\264\204\246E\026(zC(\321\370\023"
+	.string	"\024E\212\026U\250\260\200\t\306%\240\001\222\204\300%\242\317g\203\321\016\007\"R\242\217ID\n\024\236`\\\002\006!\rQ\020\352\200\032\203>\f\240A\337\017E\312\201H\034\232@\203i:$*\245\370Y\200}\222\204@$\037j\002\n\025$p\002R\3208T*\002\200\003\021Hh\f\300\240\017\230\002\205@\240\364\274\222\210_\2178\342'\200b\222/X\002\232\372\322bO\021\t\021\350\0220\305\n(\234P4\016\201/\240D&\017K\300\264H\002\232\372\202\306_\320W\001\022\252T\004\006[\360\245E\022\212'\260\240\302\211\245!\261\204\013P\220\372P \336\023hjdZ2\372\017HD\205h\022\276\007 l"
+	.string	"B\b+v\036\202\0028P"
+	.string	"\007\347CP"
+	.string	"\t\022\n"
+	.string	"\201\004>\b$l\232\246\275\"\032L\022\212@D\203F\022P$c\nLS_\021\212\022U \371P%,\202\232\242E\025*\206g\332#\246\251\217\310\205\337\260\002\306% P\332+\321\301\177*\210\240\323^q\005t\t\230b\025(R\257\227\nm\240\022\207\351\017}\241\307\244\202G\003\225\205\332s%\021D4\210\022\240\330\373\375|fz%\021\006H\257$\242\250\224\372\226F\b\207KK\303\037"
+	.string	"\226j\261\327cRA\264\002HL}(\244CbP*\324\333\271\222\210\364g$\246\305\022\305\336\n45.mp\3417\f\366zg*4\016\177\275\336\016\021\025\3020\354\365v\212D\264h\024\366z\030I\bt\241\327;\213B S\261\327\333\t\242\275\036O\332K\213\300\340\320\225D\024Q&\026\351\006H(\321\247T\334`D1\005\2660\302(L\332`\205Q\b\fn\340\001\b=\020BX1\002E2\006\177B\340\bb\3218\"\001\351\nT\030\364\t\211h*\004\366\220|(Q)e\352\365<\274\200\022\231z\2753-\002\203\275\336\351K}H\275\336\211\306"
+	.string	",\366z\247\013\277a\360\376Pb\257'\005\nO\020\226\220\002\205\300\223\230\252\360\023\032K@\362\241'~?\021:\024{/\240#\374~>,,\001\311\207\022\317\264\330\0032\241P\201\216\2002\261H\321;A\005\024>\350O\350K\213B N{\0268\341\n\201*\b\213\277\023\310T\264\305\236\211\022'\370\230(q\002\317\371+\001\264W\022Q4\266\360\241\330C\001i\210\210\246E\337\322Y,\242D$$\337\016\372\202/\210\302\310\264\204\215\275\027P\244\242\261\005\\\354\241?\340\013\350\bEc\013>h\017eb\221\242hl\201\007eb\221\026\215-\354\024\215-X\t\220\350\375~\276\023\006\337\t\023#\210p\246W\022adZ\352\r\211,\222~?\337\210\"\021}\001HDB"
+	.ascii	"\332;\301\301\007\034\200`dZ\"*\242\304\236b\257\003\212\302"
+	.ascii	"\310\264\344s\246A"
+	.string	"c\021=!\034\002\323\037\232\242#\030\231\2268\240=a\0220\350\353\021\207E!Z\f\022&\001\203\"\374~>\314\002\311\207\236\360\245>$\036bQEO)\t\250\324\373\375|?D\237\322\357\242HC\023\302!\260\b|\001%\376\020\321`\020\250\342|\001E\2621\230\200\246\276\023h\220i\311W\37411\202\b\277\237\357D\177B\013\244E\037Z\201T\004$4\365!1\255\020D\177?\021\212\300\017\350\0220\025\032O\030\227\200\034\212\275$\240\n\341\320\204q\t\350\303\004t\241\267\364C:\321`\222\320\327\013\006}KE\037\030|D\033\f\016\211W\351\227\002\231\314\035\030|,l\0215\006}/\234\305\236/\365\215 \034\002Scp\210\242\310\224\264!\275\222\210\"S\322\210!\260\303\222\2114\3503\213=\341\020\230\372~\303\n\024\231\222\200R_\320\246\275\022\035\244B\340\216p\030\264J\301\240E\352"
+	.ascii	"\tE\231\212;H(\312\204\302\007-\022\215C\023HB\343\220\230\364"
+	.ascii	"\223\366@ \221\n\201F\3144DR\272i/\204T\b4\356\244>\024KF\341"
+	.ascii	"\031\034\016#\3203\213\351\317\2104$\252 \034\002\205D4\365\031"
+	.ascii	"E\300\001\006\030z\005\f\315\002\206\216\001\206^\261\242Y\254"
+	.ascii	"\350\030V4\013\026\035\003\213\216!\206\276\222\321\207L(qD:"
+	.ascii	"\034\022G\370\234\004\t\023\026\254\220\202\004\360O\204q\t8"
+	.ascii	"\"UJ\002\006U\214\020\002}K#~\304\342\b\021\036`\250+*\213\032"
+	.ascii	"C\375\177\2329\302%\305\207\230.#FH\013\t\331\032\r;\220<\264"
+	.ascii	"`!cnY5/\224T\031\003$*\006\232\023\271\253V\307M\262-\216\311"
+	.ascii	"\033\026\030\256\026\2234\253\200<\235\201\273nAVP9\214\204\341"
+	.ascii	"\022\0017Q@\300\234Yh\356\nH\324\227K\005\346\fOK\337\277&\277"
+	.ascii	"vv1\353\3129\017\375\320\331Y\231\322\367Fv\370?\271\\\256\020"
+	.ascii	"\313 gH/)_f\264DEY^\251\361v\332\330Y\322\364\225w\272\265S\216"
+	.ascii	"\026s\324\372\236m'\226\237Y~f\3513\213\315\313;\311h\220r\336"
+	.ascii	"\377d\303\201\323\326\304\311X;\307n\324\271\301\365}M\236W~"
+	.ascii	"\301\322f\030\242uZ1\227iym\352\252\234]\\\326,\373JI\031\271"
+	.ascii	"\242\262\244\306\311\351\330\352\213\364a\353\221&C\3373y&O)"
+	.ascii	"\235\257\222k\312\\%\303\321\177F\371)e\315\247K\227\265\255"
+	.ascii	"v*[R\025\244\357\215\270\340\023y\"O(m<(3;\317~B\371\352\342"
+	.ascii	"&H\337\323\314\254\372QS\246\345\314\205\002D\355NG\337\033\211"
+	.ascii	"\341\377,\273I\232 \311A\365\304\224\022\345\n\rn\372*\371\351"
+	.ascii	"\245\344\034\263\341"
+	.string	"\305K\220*y`?\307~\212\325-G\032T\302\316\257\023\213G\027\274\035\247\023\261\036]j\234\234M\232\344\310\300\230\\ \310\2352+\031\231\311\271\204\247\306\013.6\243!H\220\234]bm\246\022\253\016\310\311\365\263\353\206\032+\027F9\212\374E\316#\365,K\031\221)a\303cI\224s`\031\371y\244\347\300\241\302\344\355?\317\275\321&\026&\216\220\237C\204\234@\352Y\226\332I\022V\307\353+CU\035\365\235X\214(c\254~\366\260:\201\334>\345\036<vr\024\251\343\265\314PUGB[_\320Xe\375\004\362\363\207P\0273\031;\372\376\324\352Y\002\004\315I\337op\206\203\212\252\357\357N\254\240\251\032\250\352\260\002\204\305\250\323qsbH(\312Q \2121\305\024cH\252\250\351\243\024@ @T\026\030\216\250\233|\023\300\302\213\215*\0035\2152\247fFD\222$\2054\007\202("
+	.string	"MB\244\275\206\322r\324#\013\362\264B\r\016\013\tl\237\356\371\020o\273\325\324\256\220:[\b\242\200\2701\363*GW\036\222\212\325\356.\267\315\262\271&w\350\266\377I[h"
+	.ascii	"\026f\177"
+	.string	"\b\305w\271\3660\026m\307\"\374\242\311G<\320\fxu\307\225\275(\027U\262!\020k#\366I3\250jQ\253=\270\252\234*H\006-f\247\333\346\262\2627\177\321\263\334\266\005%\316\\\237\370\340\003\025\241\223\032X.\341I\264,J%l\313/\315\036\300T\310\273H\324\377\344\226\364d6^@\270\311\306+\377\206eD\2662\302+{\205\225\234\326\274B\027\033\342\360\275-2\325v\031# \006\356q\240\301\034\005\334>o\300\200\324#`\214\362\025;\347`"
+	.string	"\365\300\204)\261\312#%\353>5f\322\376\204\267\311qG\242\310\255(Ur\2035\fu-U\343(\214\306\211`\214\t\264\320{C\334\212|\263E\225\017\310\242X=\030\203H\201\023\232\362\306\033\270\336m\265\213\2561heR\027\240\t\243G&Gn7\004\301\301\205\002pa{n\3463\302\034\300\266\222d\321\030\351\026\263\235\244\267\225d1\324\360T\373\351\033\022\323\232\0238\243\241k\275$ rb\363\020\262\243\f\243c\007\317\222\207N\001\3653\233\210\345\\t$"
+	.string	"\352ea\002\241;\202\f}+a\250\"\222o\032\203\324\031\311 R\304\302\335\270\0161\3435t\203!\242-\322\005\020\306\211D\211\225\026\233\244g\027\252T\251\364d\327\246\3760\r"
+	.ascii	"^\314 j\327R_\240Ns1\265Z'\222\036YV7\212\305n\312\343/Z\310"
+	.ascii	"\275\360<\342"
+	.string	"\t\232bz\243\222\274\356\330\254\211\243\213\f\336\016\335\222\342\347\316\336\207%\320\222\033\371\270\346\233N\355\230l!\377_\372\036\246\265O\017\001\213y\315Oby\201\2135\377\024\311\340[o\206#\265\320y\203>\0066\323\376\272D\ns\035\346`\227\324\031\233\253O\221;R\240\333G\300\321\353\232$+9\256\247\3108\240J\r\342\262\377I\212'\0339\n\b\032R\231\374\346\2201.\301\023'#\001\300x\024\030\351\002\3557\324\332\364\345\300\220j\216\344\252\203\231\016\261\225`!\262GSv\b\2306\275n\354\0360\240\336\274m\f!\334\347\303\236AT\223\274.rD\251(w\\\"wS\277@\335!\030\240\223%\270\220\356\226\242\373f\277J\226\353\260\023\305\266;\021>9\236L\266W \177#\372\206\337\320\372\305V2\201\241\202ny\r\361\335\321\003S\305q\363\220\245?\252\327\3425I\t\242\331\264"
+	.string	"\022r![>[\274B"
+	.string	"\260!(\203-D\315\315V\212+\346\264\351LS\270"
+	.string	"\357\262\220\027\034O\220f\254Sw\315OorV\314w\364\244\025\366\215,&\335j\213*)z2m\271\013>\244\30357\334\241.\301\302\215{V\213\364\302$s8\247\342%eb\217\376S\230aw\036\336I\225\241\240\304\363\256D\205\nA\212\337U\002p\377~rR\371\033GnW\340\207\244\001\236-@t\207\261=\027\006\237k\016\323p\020\323\331\344Q}!s\207\036\362\031hV\274\330"
+	.ascii	"\"{!\201\334\371(xs\377\313s\356KI\bA\017Q\r[\\ \255\307\241"
+	.ascii	"X\272\252\177\227\310\022\301*a\016@7\277 \016\204\n\002\243"
+	.ascii	"\310\001L\336\353\001\346\215\354\341\320:\202\347\221\342[\304"
+	.ascii	"\327<\022\325\016L\231O~_l\033\362X\2413\344rOx\266e\254\362"
+	.ascii	"f\n\364\006\007\335\256h.\2226K\360\317u(o\247\333\004\200L)"
+	.ascii	"\256\376\217p\002\036Y7#\033\002\310Y\331,\343u\231d\262B\242"
+	.ascii	"Y'Z\265\225\204\261'\213\220\271@6I.\327\034\274\370\37678\223"
+	.ascii	"7\265hb\3422\034K\022cM\311\013I\201I\352\304\352,\303\032\202"
+	.ascii	"\345\213\320\347\310x\311\274\202\201\221\300\017\177\275`@<"
+	.ascii	".A3\227\017O\336\362\213\212\364\346\024E\224\247\300@\327\003"
+	.ascii	"\253\203\003\314\"\252c\227\273\335\220\227F\022E~\345l\314\346"
+	.ascii	"'\372\334\373v\347j&\3373\201S\031=\223MV\237c\375\001Hwyq\024"
+	.ascii	"\320\203\266\327[\251\263\025\276\002S\333\317\355Q\347X\353"
+	.ascii	"\326r\331\357\307\370\035\372\257h\336\221\216\230\213\377\370"
+	.ascii	"\263F\264a4\243\316\3408ot\006\205\227\300\220\343\002Wf0h\372"
+	.ascii	"\312G\260\336M\314\007\326\017\232A\340\332\263J\216x9}oJ-l\""
+	.ascii	"\240f"
+	.string	"\005\302c\206\023\312\177\357\254{\005\207\r8*\267\374\030'\r\233\350.\024\233\033\364G\220\306p\327\023\205]`\244\005-\2016\225r9\204\323\230\352\272#\276\313\200/\377t\"\2102\274k\200\224\027\224\304\313\n:G\017n\307]\202\t\362P\031\001\234)\234-\261G\332\311\026>!\216\346\220\001b`\263\013\021\317e\34661\005\031\205C\301\203\205\303{$x\372\2104\001\216e\216A\305-\231b`\315#\203S\274\251\320Y\274\373Tli\244\277\013\356O\004\350U\"\313\366<\240'\276\307\030\320\206SL?5\242t$\220\267\200\362M\266\323\277\314\013\271Y\315\316\247`\257\270L\243q\035hS\364\336\366\340P\316\037-\314\336\331\217\205\342\0333\205[\n\257h6^\bF\005H\313\210\371x3\246\037\311ag[\354\217\325\205\217\273\317\017\b)\225\005\352\272\227V\226}mz\2602\rq\212\002"
+	.string	"\2236l9\310\315\240\330\303$NS\265+'\212\177\227\372\203Q\271\347\271\\\340\365A\204'\252\002\023\275\305\004\277\217\236c\252\316j\305\022\304_$g1\0265\341\210\315\277\372:Ic1\316|\340\025\t\203\2666\332\003\244\251\350\312,X+\f)#V\355]\344\273w9\375\370\203\231\277\2300\231s\275W\035\322w\263x\243\2431\277\004\016\254\230#\222'\022Uz-O\034\t\265\036\237}\240i\261e\223\326\235\265\236\b\301<\343`6\365\n\035m\336\342\260$tbW\222Ow\353\246\032\202X\261\211\302\001YmR\345\360\036<\273\352$P\006\022^$j\274\312\201g\216!/\331\322\364B\241=\t\374;\350\307\243u#'\\\240\r\257(\277t\221\274\t\315\244\016\317\215\020a\252\231\317\233\331f\3236\316\205(vrvZ8\351\240\370\375"
+	.string	"k\367Q\242\214\r\375\230\333\363v\022\026\376N!H2\204\\r\232W\2615g"
+	.ascii	"C\263_v\313\267"
+	.string	"\370=\020\362\226\003\211\023\231%~v\265\330'\374-\357T\275\001c\nHy\264|\220Nm}4V)\257\312*\257\352w\034r\270\303*\001\036pp\t\267\236R\320\0052\251\306\317\036h\026P\237\243\212\327\370<\201/\321\245r1\334\377\306z\276j\357\n|6Y\213\342\265>\307K\001L{\337'\322]P\f\337\304\227\027\262\227U\366=\332C\302c\023\351\230\327\023L\017\346\306\222k:>A\240\252\240S\250\347\220\315(\241\201-\004\212\245DE\016PL\272\3760\275[\263\202\213\241(\266\2467\006Ch\370\217\365\255\261\315!_\201P\030\351CY\360\002\334Q\037\341\350\024T(\232\264\001\372\314P)\302\024\320\307\331\264\004]\246\361\244>\301\377\337\200@L\222!R\033\2449O}\207a.\274\300L\f4\320tD\224S\205\224\240\201$\021\020Ec\r\243\255\177ym\3603\307\3629\033\305"
+	.ascii	"\365\322[\rw\214\003\305{,~\336&\362T\345\006|&\330)\302X\336"
+	.ascii	"\373\352>\241\327?\tuK\224\243\307M\177VE270\350t4\024\232\315"
+	.ascii	"N\234\032\213\275\246j\b\340\004<\223\251\344\261\003"
+	.string	"\037|f\006\253\305o\017\304U\b\202\257\207\320t^i~}\371\255x\225\357M\372 \253\007H\263b\352\250*\215\273\257\001\344B\237B\027\035\246w\372\216\222S\360\225\0234\216\002\\\n\030\364\373C\277\004\236G\200b\377C\312\375\\q\260\002\245\177j\353\242\314\007L}4`\033\272_\024"
+	.string	"@\017\311\367\243'\332,/\033[\243\362\271\235\205\336\033b*\374?\257\360gt\177\017}\265\377{\213\337\345\342+}\026q\256C\3243j\230\277\261]\327n\271\276\004\365\351\230?-\262\002}\237Sh\260u\373?\364\332\370\331y\224\335?\271\375\t\\V\316\307B8s\376\252o\347\340\215L][<<\376\033\246\341\213\"\375:\333\350rv\020~\226\322\243c\326bC\332Ax\323s\231\023\356\262"
+	.string	"\215z\223\023\322\307\006\007\237q\202\317g\214\270\371mF)\347M\215|\257\326\242\br)z/\023\215%;\f\273\317Bc#P\027\250\272s\343\031\032{\322\211/\376s\214\247 \336\217\277\216\361-\217#\t\347\367\305wn\227$\277l\306\333\225\376T\366\226\377\025\376h\307\036tv\241"
+	.ascii	"M\364\356t\3417\362\307\\\214\260\313N\t\275\022\356)\230\276"
+	.ascii	"\357\034K*\267\\/\b{\354\374\377\326\031{[\304eK%3\347\277\270"
+	.ascii	"|px\013o\331r\032\245\215\306\2572\230\200\363\377\371l2\301"
+	.ascii	"\362\20636\223\272\216x\215G\330\304\303o\332~\246\035%\351\315"
+	.ascii	"\324\312i\266\205\3724\373Yp\3132\257\213}\315\333\232\367D("
+	.ascii	"'JN\262\031\370\266\260y\025\314\236$'\004\336n`j\254\245n\211"
+	.ascii	"\311\316\374\224\3751g\017\361\217\270\335\300\375\204\303N\204"
+	.ascii	"\376\320\261\320\355@c\r\371\023\256\035\373\316d\"\302\274\271"
+	.ascii	"\377\200\314\211\373\271\254{a>\214>\247\246|\035\"\362S*\n\237"
+	.ascii	"\030\250u\005"
+	.text
+	.section	.gnu.lto_.symtab.d558f6ddfa29d91a,"e",@progbits
+	.string	"attitude"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\002"
+	.string	""
+	.string	"headfree"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\002"
+	.string	""
+	.string	"offset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\002"
+	.string	""
+	.string	"imuConfigure"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\002"
+	.string	""
+	.string	"imuConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\002"
+	.string	""
+	.string	"imuInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\002"
+	.string	""
+	.string	"canUseGPSHeading"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\002"
+	.string	""
+	.string	"imuResetAccelerationSum"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\002"
+	.string	""
+	.string	"accSum"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\002"
+	.string	""
+	.string	"accSumCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\002"
+	.string	""
+	.string	"accTimeSum"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\002"
+	.string	""
+	.string	"imuUpdateAttitude"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\002"
+	.string	""
+	.string	"shouldInitializeGPSHeading"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\002"
+	.string	""
+	.string	"getCosTiltAngle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\002"
+	.string	""
+	.string	"getQuaternion"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\002"
+	.string	""
+	.string	"imuSetAttitudeRPY"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\002"
+	.string	""
+	.string	"imuSetAttitudeQuat"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\002"
+	.string	""
+	.string	"imuQuaternionHeadfreeOffsetSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\002"
+	.string	""
+	.string	"imuQuaternionMultiplication"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\002"
+	.string	""
+	.string	"imuQuaternionHeadfreeTransformVectorEarthToBody"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\002"
+	.string	""
+	.string	"isUpright"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\002"
+	.string	""
+	.string	"pgResetTemplate_imuConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\002"
+	.string	""
+	.string	"imuConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\002"
+	.string	""
+	.string	"imuConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\002"
+	.string	""
+	.string	"accAverage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\002"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\002"
+	.string	""
+	.string	"gpsSol"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\002"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\002"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\002"
+	.string	""
+	.string	"acc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\002"
+	.string	""
+	.string	"sin_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\002"
+	.string	""
+	.string	"cos_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\002"
+	.string	""
+	.string	"isFixedWing"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\002"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	""
+	.string	"compassIsHealthy"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\003"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\003"
+	.string	""
+	.string	"acos_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\003"
+	.string	""
+	.string	"atan2_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\003"
+	.string	""
+	.string	"pthread_mutex_lock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\003"
+	.string	""
+	.string	"pthread_mutex_unlock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\003"
+	.string	""
+	.string	"mixerSetThrottleAngleCorrection"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\003"
+	.string	""
+	.string	"degreesToRadians"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\003"
+	.string	""
+	.string	"pthread_mutex_init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.d558f6ddfa29d91a,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
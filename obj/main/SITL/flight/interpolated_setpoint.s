@@ -0,0 +1,766 @@
+	.file	"interpolated_setpoint.c"
+	.section	.gnu.lto_.profile.70884db279804641,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.70884db279804641,"e",@progbits
+	.string	"(\265/\375`J"
+	.string	"\235\004"
+	.string	"\304\004>\001"
+	.string	"\020"
+	.string	"\363\325\356\265\017\f\002"
+	.string	"\002\001"
+	.string	"\002\002\002\003"
+	.string	"\002"
+	.string	"\001\240\342\234\212\n\002\003\004\005\354\207\264\260\016P\004\002\005"
+	.string	"\002\006"
+	.string	"\007\002\b\006\007\b\t\n\013\016\017\020\367\376\334\304\001\016\021\374\351\233\315\016\002\002\002\002\003"
+	.string	"$ \360\002\252!\017\2370\013#\201i\007\372\315\264#\214\223hW\2059Y;\336\002\243\263\031\024\243\f\003\027\030\364H\022`\032\006\034t\356F\r\326\300z\316\005N\031\211"
+	.ascii	"\334e\357\332XJ\337\325\227S\001\206"
+	.text
+	.section	.gnu.lto_.ipa_sra.70884db279804641,"e",@progbits
+	.string	"(\265/\375 l\375\001"
+	.string	"\264\002`"
+	.string	"\004"
+	.string	"\001\002\002\t\002"
+	.string	"\203\001\001\001\204\001\001\001\020\002\006\001"
+	.string	"\001"
+	.string	""
+	.string	"\005\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\004\003\021\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\007"
+	.string	"@"
+	.ascii	"` 8\030\314\343*Uj%\244\r`\001"
+	.text
+	.section	.gnu.lto_.inline.70884db279804641,"e",@progbits
+	.string	"(\265/\375`\242\001u\f"
+	.string	"FVI< q\222t\004\023p)`\277\212~\026\216\024\0306\2760\tD\360L_\037\034^\260\237\253!d\301}\026\264\216\332"
+	.string	"\013\035"
+	.string	"\001\001`\204\213\222Y\377\241\262\376H\342\233\335[\356\0245"
+	.string	"5"
+	.string	"="
+	.string	"!%\211Q2\303P\266\374\232N\327t\356\r\203\353\205O=\311L\313\305\013\322\251\231\231\317o\356Ef\nx^\025^\030\356K\355~!G\"\263\"\360x)\0042R\022\214\343\246*\035 \2500\027{<a\365\274\324\314\254\n\375P\255?\307o\324\354\r\204A\035\351\233m\036\250\"\375\003\306Q\221\177[\360lt\304"
+	.ascii	"|\001\b,\337\246\036TP$\0308\322tl\350\036\307`.YFc\364Q\026"
+	.ascii	"!R\214\260\314\214\231\217\232\330\220\362\240cs\004)\n\0320"
+	.ascii	"2\340\270\306%\335\212\t\247D\201\321r\244\316\302\212\377\257"
+	.ascii	"\247\313\314|\216\301\375\250;\311\254.\007\360X\342L\255\321"
+	.ascii	"\340\303J\307+\363Rp'H4\224\364\365\222z\241j!b\035Mq:\034<O"
+	.ascii	"\235I\004\016\023\006\254\37315\013) 0\002\342\330\230y\275$"
+	.ascii	"\003Wrp\206O\221:\306`\270\025Fh\023hJ\366\254kq\017%i\203m*"
+	.ascii	"\036\257E\022I\212\003\325\001\324@X\311\200\253!\233\253\226"
+	.ascii	"\005{ \030nCy\231A\016\310,\f2\222Z(\300\363\241\211(i\363Q\f"
+	.ascii	"d\265\240\361\250g\261X\330\344\226\243\327\344\272\250X\024"
+	.ascii	"\300\r"
+	.text
+	.section	.gnu.lto_.jmpfuncs.70884db279804641,"e",@progbits
+	.string	"(\265/\375 \353\005\004"
+	.string	"B\007\026\037\240'\351\377g]\017\336\244\252\272\354\307\212\337\254\352\370k\237\274\342\276\263\366\350\3356\221I\006<=\363\004\301\351\277\006\274yU\226\201\036\240wz\210\337 \216\021\331\005B\212B\017\033\356\346\272\361\214O'\306\023\353\247o\305^\261\316Dk\341\265L\332\245y\026\037\001\017"
+	.ascii	"\372\b*\\oU!0\\\024\301\245,\242\020\001\256P\371\300\032\334"
+	.ascii	"\2638u\241j\201N\255\316Y\334\006\260"
+	.text
+	.section	.gnu.lto_.pureconst.70884db279804641,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"\231\004\005\230\004\020\230\004\021\204\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.70884db279804641,"e",@progbits
+	.string	"(\265/\375 O\r\002"
+	.string	"\024\003C"
+	.string	"\004"
+	.string	"\001\024"
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\005\003"
+	.string	"\374\007\374\007"
+	.string	"\020"
+	.string	""
+	.string	"\001\002\017"
+	.string	"\001\002\020\021\001\300\007\002\021"
+	.string	"\001\002\r\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	"8\203\024\025\334%\2142I\330@\033"
+	.text
+	.section	.gnu.lto_.lto.70884db279804641,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_interpolatedSpInit.38.70884db279804641,"e",@progbits
+	.string	"(\265/\375`p\003\245\030"
+	.string	"\206\255\234G\300\030Q:\300M\254\021T%\314\243J\263\0348:\326\320K\026\"r\037\2341M%1\341\200G\r\005\372c\3566\272\027\317\35012\352\367\224\206\272\347s1J\347\202\\\374M\223\013\305t\201\301o\244\221M\344N)\203"
+	.string	"\200"
+	.string	"\213"
+	.ascii	"\254\360\3647\262h\353.\244\366\"\026_E\372\016%^\276\324Z\021"
+	.ascii	"\234\232Bx\212\363}\332\007\362 \265\347Z<@\255CJIj\325)\360"
+	.ascii	"\203\360\324\272\253\300\323\360\002\300S\327l/\005\202j\272"
+	.ascii	"\270\330\221\251\265\256\366\206\367\237\356\376f\355\364\333"
+	.ascii	"Y\363\215>g4\2258\333\351\007\240\326j\203\013\372\030\274\300"
+	.ascii	"\375\314\217\207\214\357\217>\223\210\2248\031\237\247\b\265"
+	.ascii	"V\317\022\027\343\006o{f\333\203\2755\002\325\020z=1@\265\372"
+	.ascii	"\030\330\275\331y\344\326\343g\366<w\267\300\356\366\345;\367"
+	.ascii	".\322\370\304\213\240\bk\005\312\361\221H\304\302\034\247~\013"
+	.ascii	"\360\364+\302\307\217\234\317\354\331:\333\\\"\373\257;d\253"
+	.ascii	"^t\337<\367\333|w\213\247\351\3247\215\332\351\020\234>\321i"
+	.ascii	"\220N\323\235\376\350\364~\323s\247?\200\236\311r\241\246Za\364"
+	.ascii	"\320\324%\252D\307w\177\221\375!\376\321\316M\276\212D\001\b"
+	.ascii	"\231T\302E\321\370\024#\251yi;\301\245\230\367&&\fW\312\360."
+	.ascii	"L\265\326\234\323(:\347\362\344P4p`\261\300\323\323\356\214)"
+	.ascii	"\245\020\350\304<\002LI \354\017;\253t\263t\301\025o$\321\265"
+	.ascii	"m\342M\314S\341\250\265:\360\227\234\t\b\207\330\331\031S\202"
+	.ascii	"\t0\315\373\024\327\036\321\232/\351\376\350(*a\226\202\326\266"
+	.ascii	"[k\265\255\277\365\221\234\347\362sx\344\231/y\300\323y\245\004"
+	.ascii	"C\336\310\005\037er\274\333\330R\244\013\344GX\313\305\032i\255"
+	.ascii	"\016+Z:\257\227\315\b#_\261\331\206\022\244,e\327\002Z\017\031"
+	.ascii	"\223\321F\025#J\214\264\026,&\233\215\264\036rE3\301C\302^\253"
+	.ascii	"\036\262\205b\345\232\251X-8\340\230l\234\255h\261\330l%\352"
+	.ascii	"\352_w\310\350\025\316,\371\354\017]\"\237\236\254jW\313Dpq_"
+	.ascii	"(\270\270\317\031i\001\232f\376}K$\256jOIDn5p\346iQ\233Z[\302"
+	.ascii	"\204\371\3228\267\265\331\307\222\242\302\257X\310\261\242\323"
+	.ascii	"\240Jj_\n\205\213\nD\250a \345\2343\bQ 2\021\2158i\f\200\002"
+	.ascii	"\2211\263\016\020`W3I\322\032\"%\277\211\244\260q\216\030\355"
+	.ascii	"\223\232D+\315\255\007\3444\032\234\375\3177!-\177\026\343\237"
+	.ascii	"3`'!P\001\240%\344\360\245`\310|l^n\371m\346\335\277\231\272"
+	.ascii	"~\0246\223\325@\222\325\231\264\272\270\257\006C\027\225\377"
+	.ascii	"\216\004\320\335\272-/\b\345\360\327\3404\272\357\333\366\310"
+	.ascii	"\326k\221\360d\333\215m\332=G^\245\323\25353p\266\275\255\273"
+	.ascii	"\205<\243\0241\341H\300\246J\245~\245\267$\035a\376"
+	.text
+	.section	.gnu.lto_interpolatedSpApply.39.70884db279804641,"e",@progbits
+	.string	"(\265/\375`0\031\255l"
+	.ascii	"\272\260\024'J \216\342\351\247\267\310\"\004x\2379W\360\222"
+	.ascii	"\370\300\213h+\020\351\214\313Z\317\207\230\3353\324\202\236"
+	.ascii	"2\235\310M\250~\nC}\306\005\201\017\246\013\020\354L\206\305"
+	.ascii	"\314N\322x\263S(\\\324B\341\204i,\254\265$;\245\224\002N\002"
+	.ascii	"0\002o\002\316I\327\031\351:\037\265\263\321u.R:\023]\347\241"
+	.ascii	"v\026R:\007]g \245\363\217;\373(\235{\2563\317u\276p\235\231"
+	.ascii	"\327y\347:\353\\\347\345uV^\347{\235\223\327y\275\316\337\316"
+	.ascii	"\236t\356n\013\212\344[\364\203\253\376\342\036k\244\332\002"
+	.ascii	"\213\230\244>\3512\335}\335~\335]\272\275t\007v\267\335\202\335"
+	.ascii	"a\272\007\273\t\233\311\334\314M\206\333\f3\313\374(\253C\324"
+	.ascii	"sD\323Z\270\2674\227\376k\300\376\322`\232\332bzL\0272\223Pq"
+	.ascii	"\332Hfp\311\004\215\3240E\264\b\032y\322\246\301A\211\013\344"
+	.ascii	"\366D\034\027=G\b\274\374X\243\353\240q\254\013\267M\265\037"
+	.ascii	"vmH\023(a~\334.\321\330\212\244h\356\032\271\372~4\325\366\330"
+	.ascii	"\273\004\234\200\321\263\352$\317Xv\262\231\237\314Lf\376,A\326"
+	.ascii	"\037Vm\311\0250/:xx\366\336\331Q\313A\324+d\331=,>\321\336Wx"
+	.ascii	"\220uXv\216\013\030\226e\261X\304\262\223\314\314]\245\365\236"
+	.ascii	"\314\355\272Ww\267\241*\355sdYV\253\331D\267\223k\013\335N>\007"
+	.ascii	"\375\354,\254+\253*\252))\rQ\031\240\236\234\232M\030\230\226"
+	.ascii	"\224\222\220\216\214\212\210\206\204\202\200~|zx.0wt\226\312"
+	.ascii	"\233\\\337\237\334|\275\272y\2628mC\353,\254\303\276Z\233\230"
+	.ascii	"(y\354D\2663k\323\f\242\324\320\255\314t\225\2312NE\246\247\310"
+	.ascii	"\024\272T\333\032\332/\036\025\330\031\002\001\035\312\214\027"
+	.ascii	"\177\372k\247\277&\227.\336\204\30514\024K3Y\271\342Kz\255\244"
+	.ascii	"\207\307V\305\223\022\331\376Dp\244\274>Z\243\222\360\330\250"
+	.ascii	"\270\321\3324\223\367\304\213\210\206\326\244\250;\027\362\240"
+	.ascii	"\211\007u\340\201\003y\320?k\225\234\341\221Nd\263[\211JX\302"
+	.ascii	"\246\361\330\352\334'\t\036\233\022\357q'\315\223\244/81\225"
+	.ascii	")\346\334\234\364\316\005\026\270\016\006q\276\304c\203se\"\233"
+	.ascii	"\\\027J\375\276ur\247\355\255\327\236\266!k\223eYf\233\232\377"
+	.ascii	"Z\325(\270B\027\266S\"\333\341Jd\304\311\264\371\332\327\332"
+	.ascii	"\322\334\225)X\226e\237\266\2715k5\363\273`f9\314Di\002`\337"
+	.ascii	"o\027T\243xi\314\255\353\320\255\246:G\323\021<\343\bg\307\217"
+	.ascii	"p\310\216\3177\036\337\232\352\3312\322\347\225#\020\352l\335"
+	.ascii	"\236\3579>\026\266\226\217\r\351\342\005\f\030\267\223=\257\324"
+	.ascii	"`\314#u\371t\314\363\314\3679>C\310F\352\205\347ye\234(\336\n"
+	.ascii	"ql\310\340\272\360\r\310H\345z\346\257gZ\3312\263C9\277\021\327"
+	.ascii	"\214\360F\221Q\315!\257a\273Q\201\004\221\026\344\364\222O\327"
+	.ascii	"g7\205\263\242:6\215B\001\006\324\250q;\251\214\362\305\021\016"
+	.ascii	"\324\253,\306\n\225\272\365\351x\347\225_\306w\330\366\036\273"
+	.ascii	"\352\374\316\337\276\345\353\374\035\214:B\031\325\034\260\374"
+	.ascii	"\006\264\243v\275\362G\304-F\035\357;\277\353{N\0324\b\334\347"
+	.ascii	"\240\202\337\343\002\237|\347\367\234(\336\372\\\237\374$\232"
+	.ascii	"(\2244\257\n\341\322\212\334.Y"
+	.string	"\226\r\301]B'\332\340\276\353$\337\340\362\236r\275\217\240_\036\365\237\333\206\343\306Sj,\013\205Z\340\023\200k\023-\223\346U\366\377W\242\2116\366\373\2674\022\352U\376qf\247\227\367\264?*\032\207\230\366h\314\3437\236\231\2010\357)\327wa\267\334\026$\210j\217\326u\220\215`\376\354\332\370\336K\324\340\215\342\0325\207d\336C\363\247c\356\257V\253U~&\314\327\271\331:Kw\023\351\276\346\226\240\331\247\220\366\322|\026\344:\003\361q\235{\220\215u\231f\261\034\016\204\201\265`s\227\263\007\233\027h\302f\256\276\322}\243\367\272m\264_\363\f\0311\272K3\f\002:\260\371E\0076\017\320m\263\213n\233[t\230\346\255\016\323,\300uf\261\343\274\342:\253\270\316)\2563\212\353|\342:\233\270\316%\2563\211\353<B\307Y\204\3229\204\2163\210\245\363\207\353\354A\3079\200\2453"
+	.ascii	"\327\271\203\2163\207\245\363\206\353\254u\235\263\224\316X\327"
+	.ascii	"\371\352:[]\347\252\353Lu\235\247\256\263\324u\326p\235\243\256"
+	.ascii	"s\206\353\fu\235\237\256\263\323un^\347\246\353\214\341:3]\347"
+	.ascii	"\245\353\254t\003~Q\307\246\247c\251\317\360\027\0225\274\324"
+	.ascii	"/\315\211z\r\317$B\036\002Q\357Z\354\266>\303\337\020\232,6N"
+	.ascii	")\203\301\217\351\231pS!\224Sz>\004\203W\222`\374\032\324;\035"
+	.ascii	"\276\211\003D|z\250\277\016\202\177\360\364\255\205\261\371N"
+	.ascii	"\357\201QG\250\343y\224\346\353$\036.=\335\013\371\347[y\211"
+	.ascii	"\3425\275\220\3678\3212i\030\276\351\177NT\216\351\227\036\303"
+	.ascii	"#\305a\372+\230\201\217\367\361K\337\207M\374\202\244 \221\242"
+	.ascii	"\244\364=\007\202\322\221?\022@ \266\221\222\264\026\275p\024"
+	.ascii	"\214<\"{6z\361\004\374\032\257E-v\364\004S8\032{^\215Z\274\213"
+	.ascii	"_;\373%$S\370\246\234\275\206\277A O\300\007\371\025\310_\375"
+	.ascii	"\t\366\370\256\367\361\037\247\307g\370\303\322\265\001\267K"
+	.ascii	"j\234\016\372\345\021.\351\227p\313T\347s\317<\2565p\352\306"
+	.ascii	"\305#}\322+\003\237\234\371i\345\211\305{\212d\345/\017i\225"
+	.ascii	"K\342\006H\005\016\364\305\223}\353\325U\243xb\337\342\307\276"
+	.ascii	"\345\352"
+	.string	"\236\004G\260;z:\376\341jb?ud\n\237\241\232C\362\321\027\275\330\177\240\321\037\021\275\321\037\005J#\213\276\315\264U\342\226\264\305-l\364t\334\205\355\202\3315\300'\361\211 mw\226<]\377b\235\222\206Y\244\230'mw\356+\025\341Z\374Z\0276\rE,\322\226\t\366\274\022\t\360\276\303\343\374\255_#\372\2628\242/q\344N\316\n\034\324\253EO\307.\324\005\324\365J|\220\322v(\354\225\212q\3226\250\353\223\370\030\245\355O\216\037\340\327\\\310\371\016\344|\037r\276R\261\210\264\rr\276\337U\211\374q\340\005\370\265\n\266\230\336\332\"\035\211\206\276\353\303\276\243e\204~\350;\332\030\364B\337\206J\b\245\221\320\244\226\301\303\241\240\357D\247\300\217lq\337\261\n\026,n'\203\236\211\326\302#\034T'J[\235\020\221\376y\237(J\200\210\023\004E\320?O\302H\023*5a\266"
+	.string	"\001}\016\274\264\345\003\375\245\"\327F\345\322\034\370\016!\211\234(^Z_\b\204?\236\326?\177U\244\r\n'S9\237\026\372\347{\316\215l-\213\374|\263!C\2154<\242\327\363t<\277\266\3054mK\343\b\347\202K\243&PaY\326\371\0018\276\312\314\306\276X\004\325\370\341,c~\2319i"
+	.string	")\273<C8\276\276v\324 \302\361\025\006\026\206\203L\306\030Y\230\231\263\354K\307\227\227\227\212\245\025``<;\302tx\255fc=\310\304T\230\361 #\353b\226\221\231y9[4`FF&V\003\f\254\347kG\020\263\365K\314Y\326\302\213\306\217\257\261\035\036a@\234+{e\231\215\205\221\3550\373\342\241"
+	.ascii	"\216/3\247\016\262\035e_fca"
+	.string	"Zf\r0\020\246\003Lk,\314)\246\345U\306C+\253\212\311v|\225i\231\221\221\225i1\367\330^\331g\302\366M\350\247q\004\334._\312\366\315\327Rn\221y\3245\213\305\017y5%\"\\\305\2570\362l\363\236\262\370\346\220Gc~\264\034Qj\246\314O\n\236}\"\3511\037:Y}V\320m]'\331\347x\3443\356\202g\222$\267\223+\276\337\236\264\3237\246z\301"
+	.string	"\212\305\002\267L\220J\270\332\315Iu\352f\314\0231`\256:\310m\"\277TA\0259\334\032\325\255\360\200\223\305\251\033\025p\336\244x\023\257\342\357\234\250\\\232\004\217\342S<R_\024\317\304\237x\024\277t&\nE\005n\227\215'\276\017\355\250\320\024P\320\300\304\363@\343<R\241K\236X$x\251\265A\304\022k\030I\374\210/\361k`Tn\306\313x\022\177\373\026\323\214x\345\\\233G\252\225\210,7A\361\b\315\324M\210\027Q\302\326\0221\304\267\030;*\264\352\r\025\2107\364\3033\336<x?<\b\017\037|\274\207\2516R\001`y!!"
+	.string	"\037@\007"
+	.ascii	"\202|\007\r\177\215\365To'\330Eq\3700O:\024u.\350\324'\007v\317"
+	.ascii	"&\317&\267\223=u\263\3419\374\021\032i$\225k=\363\363\3113\312"
+	.ascii	"\355\351\206o\252=\032\227\236\254\327\372#\017\344v\t\230\365"
+	.ascii	"M\002#u\311\220K\234\fO\307$z\353b}o\300\307\330\345)\205\005"
+	.ascii	"\326+\263\260y\204\203\202CF\316\251\331\367\246\373\365\340"
+	.ascii	"\026\244\031\277\306N1\236\327f\f$\237\3222~\315\252o\374\322"
+	.ascii	"\233\"\037\343\026n\227\352\372n(\335,\346m\361eA\300-\215\340"
+	.ascii	"\323\331\007\371f\377\201\273\326\317\351\352\251\376!\255\376"
+	.ascii	"\352\225P\250z\253W\232\203\345J\325\267\034\252\277nw~M\035"
+	.ascii	"*\204\207\030xe\202\3611~m\352\241\016\271~\352i\334\005\201"
+	.ascii	"\372\250\201,%\221SfFF$H\222$\205\306\221\005\204\030\306$\254"
+	.ascii	"n\021\300(\347$34B\222\024*\215\001\037\f\020\350\270\347\263"
+	.ascii	"\334Ng\262\004\025H\021\020\377\013\266\004\225\260\036\337\320"
+	.ascii	"T\275\300g\275\2755\250G\233\351,+\241\271\2617U\370\340(\374"
+	.string	"\372^\325\233\177\247\3178N\202P\227\376\216C\026\363\255Q\361'\303%e\215\312\253\251\317\342ln\004\343.K\354\303U`\223\310A\335<\375Bw\240\253\362\235\353\350\001\020\2268\272\347\177\200Qk\321\0073\250\331\265\f1\016\2644!\243\016\213e\340\366\334GP\301N\344q.\272\210&\370\301M\263\366\tX\302\357\352'\200\366\034\376c\261cPG$u \016\342\261J\373\224\b+\004}\304N\314q\320\036\240%I\3769\030\366\247\336!\205\235\260J\270\353%`\222z\\\245}\364i\337\347\247\221\273\023\361\036;\376\372\234\315~v\006\243\312\"\007\266\245L\216\353c1\033\341%3\256\245\247\260\230\031\200e\f\325\236\001\204\354\273\363\356\205\001\355\366\267\227\331q\257\205\364\226H\202\377\261P\331\246\310N9M\301\255\372\026%\001\024\221\231\227\370j\304\247\240\257v\222\256\266O\362\255\013\024\355-F"
+	.ascii	"9\260F\202\017\300Shr/\270qA\312\200\224I\340\265\241\241\267"
+	.ascii	"\227\030#\373o\354\374\335\243\202 :\274\241Dr\274Z&\316\032"
+	.ascii	"XC.\017EW\346\205(\321\363\302^N\241\2200\3300\200\270\336\252"
+	.ascii	"\232\227*Zch\001k\016W\254v\331"
+	.string	"\230\247\225t\025\357\202\253n2*\274%z\217sa\206\332\001p\b\371\205\004\340\t\353|\224\267`!\002G\276r\304\323)\032\377$\236\364\026\253}\351\331\201g\336\t\230\203\334\354\3012\026\264U(\227\272\354\207:\367\036\203d\306\033pu\252\026#\211\350\032z\220\204G\3270\363\022\361\232*\336\205\353\032\300,>p\237\326\324w\036\221w4\006\314\347<\351\253e\34496D\237E\013\320b\277\036\332L\3357\224\267\255\037\272\310\334\363\223\032\247\306\216\241A\254\3743\217\303J>'\367l:C3\017H\027\225|R$\020;Z\204\356w\354\006\245.\317\031\304\261\033\260G\322\027:\231\231\316\301\222@\333\016j.\234\211\340\376B\255\226\376?@\245\244\216Q#\026\230=e:\340?\2113i\311d\2505k0\227\304\bAN\377\2639\224\003\013$R\321\357\320\260bc\2665\324F\254\"\346\220f"
+	.ascii	"7\250<\022(t\350;\250\002\261\rl\017Bf\260\250\315X\036\312\215"
+	.ascii	"\023\2701\022+\313\223\353\002\303\2177\343a\224(@\362\3042\300"
+	.ascii	"\247;\301\021k\n\027\253\030\005\2410xNB\236\341\230KZ\300\317"
+	.ascii	"\004\007Tp\262o\336'\260\320\200\016|\350\343\201\3266H\252]"
+	.ascii	"\002\216\327\345/\236\3271,\366\377\214\035E\2356`\305\254\350"
+	.ascii	"\326]\261\261\265\363\027\242,\2473\233\005\021*\232\331\271"
+	.ascii	"\345e\343\030>Px]f\210\210\206O\354\340s5\257\034|\220@\330c"
+	.ascii	"Q\344O\317U\223?\027\245\0037\270\302\034\300t\r\004\256\351"
+	.ascii	"\250C\211\335Z\001\232\275C\361\254=J\364\003\274\027\324\313"
+	.ascii	"\361\252\271J\330(\331\271\316%\276\021\035\"(\254[\030\367\026"
+	.ascii	"\321\251lA\276e\310\314\212\335\376\205\347\032\337\341\227o"
+	.ascii	"\260\204\341Z\035\370\bEy9\265\330 \013\323`\252\204\261R\326"
+	.ascii	"\224\2251\212M\334E\226\313*)\304\2430W.Pr3\300\250\226z\274"
+	.ascii	"\304\336#\216b.s\231^\202\347<\207\004[a\230\f\236\t\246\315"
+	.ascii	"j"
+	.text
+	.section	.gnu.lto_applyFfLimit.40.70884db279804641,"e",@progbits
+	.string	"(\265/\375`<\005\365\036"
+	.string	"V\267\302I\240\326Q:\004&\"\236\350\321\260F\007\030\354\244\257\034\003+\201ax\352<\222\242\356\001\371\216\345\031\364\311+\267\036o\177\240r`z\233\276\323\353 )\210\033F\203/\306>&^\255\327\322\332\217xk\3777B\b\3312\245\257"
+	.string	"\233"
+	.string	"\261"
+	.ascii	"4{G\027\t:\250DX\242\213G\260 |\237\303F\313je\242\322\252\265"
+	.ascii	"\326\330A\354\245m\337\306o\364\330E\222\350\004e\006\035\205"
+	.ascii	"\254\270\324Zq\003>c\276$\017\300|Ia\274\347\266\032m&\213\235"
+	.ascii	"fI\322\355\361\317\033r\252\206\225\241\241\317m\004\230\212"
+	.ascii	"\222^K\222\"b\261\264$\244\235\2357LEG\227\375\213h\305\325\321"
+	.ascii	"\306\276\210\216\310\001\265\326[\235\200\024\221\321\236\246"
+	.ascii	"pK\025'\311\003JIP\334\206B\344\f\023\027Un\365\0351\004Z\032"
+	.ascii	"\0244"
+	.string	"g\236\2142fC!\272\347M\255\325;4,\272o\267}\264\r\264I\034\001{\364\201\374V\344\345\263^\376d|\"B\263\\C\"\252.\005q\002\203\305j\365\361\016U!\021Q\265V\003\377a\033\354W\002\2139U\242J\254\006^\306\320\315\032z\001\355\027\233\030\\\332d\237\036\217\307-\246/\354\353\370i\276\343\017p\342/\363\034\177\314\256aN\274o\345\332F\256k\273\246\355z\266k\331\256c\273>wm\356\272,\327$\271\246\345z\311\365\005<\311F\225\023\356X\253\211c\227\352Un\315\360{\374*\304y\270<\2215Uk\245\205\260i/o\367\330\001\277\372\032\245p\2024\244I\027\r\235Q\232\214\316\350i\024F\231TF\311'\302,4\364\2441\272XB\251\240IOzNQE\021F\005\367\370\030m\262IK\212\241J\t\320\206Y\370\022\027cJ\336\225\303\321\351\314\227&e\020c+"
+	.string	"-\251\002\252%B.>\376\365r<\311\232s!!\315\255\323#\224\236\301\036X\337,\244r\251\355\004/\262a\201\224Zk\003\237\310\215;\037\352\2459\360xCYd\350\322\023K\330\365\263\307?\b\322\330B\322&?x\317<\375P5\005h\303\354k]H\317\207r\207\337~\350g\276<=\203VTF?\001\316\261\371\345"
+	.string	"s<\334N\217\307\353\341\b\250\220aG\001\270\243\363\371<\340\304\360LX\235\007\235\334\207\362\267\003\221#\215c\003\334\331\365x\200\272\337\205\f:`N\247\307\343\323\001wv8`\316\206\235\216\006\334\316.\307\303\341\370~8\233\003\356\361\350|8`\257\347\303\321\210?'+}q\243\267\022\\^?4h\263Q'\207\362do\343\215\332l$\310DT\255\366U\243SINJ8\214~\266\326\352C\243M^\002+\306h\022\242(\t\025O\027\013\374\352\262%.\"XQ\006Cot\004\202\307\320[]F\245\005\226&d\255\265\316bT\206\302P\257P\213S\330\025-\231\f\245\321e\250AH\306\020DB%2\nR\234\254\001\240\002\221\261\2729\021`!\224\206\246J+\303\034\317\t\321\001\225~0\023\234\272\330R\2136"
+	.ascii	"7=\362K\002\260{\021=\256\321{K:\250I\262\345\354\263U7\251\224"
+	.ascii	"\2460\3125Y\300\001d\324\260\245(9w\311oB\2625\357\325\354\023"
+	.ascii	"\231\022<,\0047y\343R\262\226\333\326\360\270\317\353\262fv\212"
+	.ascii	"pO!\372\326\226\327\214\270w\001oQ\204\030\307\257\322\273\023"
+	.ascii	"\261:\f\247\210\242\204^\b\233\263e\005\0047\313xh\333l@\357"
+	.ascii	"7\315\026\241\374\r;\031*\332\244\232\360\260\237q\006\342\202"
+	.ascii	"?\020\200\253\377\022\225\352\\\246 \207\257\233\202\331\257"
+	.ascii	"\326+\244\375s\ns\262@\315\376\027\364\355\032\363\007"
+	.text
+	.section	.gnu.lto_shouldApplyFfLimits.41.70884db279804641,"e",@progbits
+	.string	"(\265/\375`\330"
+	.string	"m\f"
+	.string	"\226\330WC\020q\224\016;"
+	.string	"\001\254\020\304M@C\007\0024D\003<Pq6\261\310*\nw\314\351\217\214\305\177\375Y\rMP\030\315\022X\004oE"
+	.string	""
+	.string	"\310{8\320|<\r,\315fF\253\317\321\032\331[\312\224\002H"
+	.string	"@"
+	.string	"E"
+	.ascii	"\036\375\003\201\372\211\t\022\0267v\277KO>z\204\232#\377\342"
+	.ascii	"\021"
+	.string	"K\234xq\362H\217\033\016a\001\226\0175\004t\200\241!\343\215\244j<\023\334\354\356S<K<\221\314\213\307\356:O^\206\333\272\355\007\266\033\330\367\004>\334\335\265\246\034\237\362\303L\247\246oil\2600P\355\242V8VF\\\031a[dglg\332Gq\024\321S\354\302\035\273\036PZ\354.\002/\300<n\036\300z\204\007`=\332\266'\201(\245\\YQM\240r\030A\221\200\2322\347P\035\3040e\313swI\252\"p\315\031*4L\331b\333\027\256b\025fw\025\370*\276\202\363E<\332BH\376\364\350\207X\217\327\001!VJ\271\262?R\252\211\003\\\206\341\003\375\321\351@\231\026\3520\016B\004\254\373\200h\241\r\353@\331\325Q\230\220\201H\270@\331\247\302\365\261qW\307\200\265\020\266]\235\246mW\346\333\303\325\224\023\036x*\347\251%\266\243nJ*\342\324\250'\311\021\020"
+	.ascii	"M\204^\316\206\307G\2217\304\351\031\b\242\250\020`\023\2671"
+	.ascii	"\034 \227Q\212\032_\261L0Z\ryU\305\232!\267\253\350\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.70884db279804641,"e",@progbits
+	.string	"(\265/\375`\216\001-\t"
+	.string	"\262\31546@\255\322\001\2171\264\262n\314\341w\337qxT|\232\025\334\327\005\032!!\361\341\355\026r\031\036\022{~K\256h\333\266mk\034\372\204\004\332\266\245\353\345\220[\246O\fW\036\204\303bEY\315\213\217\312\252D\027\341A\270r\013\331xYV\037\272\304Z\025\016\254T\020\031i]VS\036f5\305b\210^f\265![]\310\314(!\361\320V\003\260kz\251\335\255\232\\Q|:1\312\304\002%\036 1\301\210\rD\214\020\342\004\020\227\262\273\377\370aS\002x\230\004_\035\036A\216\306q\342\301\376\3476\005\232l\333V[\353d1\263\301p\372}\337wa\021\274\312\242\251|(\240\325?\273\236xv\325\032?\377\035\024\231\335\335\030\207\340\1778\021(  \003\271M\007\200Q\bVZ\025\222\241\026\346\273ad}(\236)\365\b\016\340"
+	.string	"\016p"
+	.ascii	"\007p\0208\374\201\200\263\264\264\205y\330\220\200\336\267\270"
+	.ascii	"-\022K:\006\036%\226v\34209\261\006\2079\f.\376\021\t\303\214"
+	.ascii	"Y\231Z\353\217\001"
+	.text
+	.section	.gnu.lto_.refs.70884db279804641,"e",@progbits
+	.string	"(\265/\375`\002"
+	.string	"\235\005"
+	.string	"b\016(+pM2\214\001\200\367\bx`g\\\021\247\377\377W\222\362\031"
+	.string	""
+	.string	""
+	.string	""
+	.ascii	"b\251M\013P\013>{\263\255\021\262w#\220\337\b\221)\317\211\331"
+	.ascii	"\314\264\005\322\026\3475m$\375L\353H\003\240\273\270<\213\n"
+	.ascii	"Js\024\227\335\204e'\261v\021\353AX\336\303\332'&%\352$#\"\323"
+	.ascii	"\016Y\007\221\376\361l\017hwp@\337h\256\221\021m\214\265\016"
+	.ascii	"j\0336\203Z\205\235\240FP{\2406\243\326\2402\201z\240Y\240\262"
+	.ascii	"\230\312N\321\n\032z\002,\264P\232\322^\224\246r6j\366\331>7"
+	.ascii	"\t\007\004\001l\371\240\356\315\002W0P\023UC\024"
+	.text
+	.section	.gnu.lto_.decls.70884db279804641,"e",@progbits
+	.string	"(\265/\375`y(\315\256"
+	.string	"*\023Q=Z0\f!\245\016o\037 \361`\f\271\037K~\026\322\217\307;\004\\=\332\357\257\253\003"
+	.ascii	"\210\230\001\377\363\312\247\225R\025\335a\251\002\350\237\357"
+	.ascii	"n\341\026sm\225\033\341*\0010\020\004-\007;k\372\3622\265\304"
+	.ascii	"\244\216p\\\264\300\311\314\204\016s\230z,&\0219iRJ\231\002`"
+	.ascii	"\003\324\003\347\003\035\312!\207\003\f\215\2562)N\332/\003\205"
+	.ascii	"\3632\0302c\374e\270\370\313T\361\227a\342/3\304?\037\371\317"
+	.ascii	"?2\220l\0047ah\214\020\302X\336]9\332\016\306\030\221\274_\306"
+	.ascii	"\005\377\377\\$\023\311\\y\013G34\017\371\234\205\303>C\337\303"
+	.ascii	"\025\376\322\320\347\013\022\247)\261\f\315Z9\251\241e\374\305"
+	.ascii	"\021\252)6\023\202\277h\2226]Y\245\307\263w\350g\360\277\363"
+	.ascii	"\217\201\207\f\315X\370\353\245K\373\013$NR\2744*WFt\275Cs8p"
+	.ascii	"\340\300\201\307\003I\256J\314\376\030)\274\347\204\177\314\031"
+	.ascii	"\377\030&\374c\314x\266\332\371\f\302~B\241\bH\336;F\214\343"
+	.ascii	"\001\304h\361\217q\342\037s\203\177\314\222?\214\026\3760V\370"
+	.ascii	"\3030\341\017\223\3055\300H\361\2079\342\317\355\370s\023\370"
+	.ascii	"\3634\376|\t\177\256\305\237;\371\005\374\006\177\036\203\377"
+	.ascii	"\013\n\374_\324\370\277\214\361\177\301\342\377\022\305\377e"
+	.ascii	"\211\377K\f\376\275.\374{n\374\241='\374{`\374{W\374{O\374{w"
+	.ascii	"\374yV\370\363\316\370\363\264\370\363\244\370\363\220\370\363"
+	.ascii	":\377\355\306\237m?\341_\266\2758\266\303w8\252\200\334\037O"
+	.ascii	"\261\331\363~\240\035\232\247\352\302\216\344\375{\213?V@O\337"
+	.ascii	"\335a\005\364~\357\340\277k\360\327t\374\265\224\277\036\343"
+	.ascii	"\257}\360\327J\374\365\013\376eY\370\243a\271\177\374\206\311"
+	.ascii	"\360\227\353\003\307W\336x\272\3638N\2275\t\352\222wv\343Z\232"
+	.ascii	"\325\370K\263\b\374s\027\307k\270\004\034\315\301Vj\260\232R"
+	.ascii	"\206R\336\237\263x\t\372\035\316\351}v\362\317B\374s\347\217"
+	.ascii	"\251\374\343'\270\b\226\202\240w\240\336\373\005\237T\215\243"
+	.ascii	")yc)x\312c)N\353X\252A\263\367\037,\255\351\322\373O\r\306\025"
+	.ascii	"`\\\301\316r\362\221\244\267\037s\341Xk\347q\024\234\036\023"
+	.ascii	"\t\332kj\252\220\315U\345\375\030\216\303`5\376\323%\374\247"
+	.ascii	"t^\374\261\020\376\370\211\333\314\3409\270s\r#\340\033@\300"
+	.ascii	"/0\301A`\013=\334\205\215\340h\006\354\365\030xx\2354\322\267"
+	.ascii	"z\207\326\314\330\r\261\343\222\367_\200?>\362\004\370\351\036"
+	.ascii	"\276\002\177\234\241\207\357p\206\336g\216;\030\266@\344\037"
+	.ascii	"k\341\255\fz9\324\354`\275Coj\2406\210\236\362~(\266\320\343"
+	.ascii	"\030\247\367\362\277-\234\225x\233\377=\363\237)\030\301%[@D"
+	.ascii	"&@\005>\316\311\r\003\n\374\347\017\023\310\371\377\017|\002"
+	.ascii	">\304\277v\362\237+H\340\037O\371\307^\377X\372\217\245\374\343"
+	.ascii	"*\377\230\204\034\201|\001\002\377\357\225C\374\343\342?6\302"
+	.ascii	"\361\024\374\347\007|\005\377\232\351"
+	.string	"?;\340?g\360\237/\370\317\035\3763\003\3763\207\377\254\341?g\370\3179\377\031\347?\307\374\347\336?\276\373\307u\377\230\313?\336\362\217\265\374\343\271\177\234\345\037\307\375c\270\177\354\366\217\261\374\343\265\177|\366\217\231\374c\263\177L\366\217\225\376\361\324?\356\361\217\277\376_\003\377\330\352\377Q\374\343\346?\256\372\307T\377X\307?\206\372\307O\377\330\371\217\227\376\337\304?N\372\377\255\377\357\360\377P\376\237wwww\367\237{\374\303$\375g0@?F7\313\250\323\250G\235\335\246\003\3750\205\200:\363\246G\235q=\3324\262YF\233F\313\2503\013\277\ta\261;r\202\265\243\n7-\201\272\f\"\245\037\246\215t\tmv\266\3361XPg\026\240w\245&\223\355\347\006.SJe(\227\37441\006\"\245S\263\003I\227V\315\336\255\224\303N\244A\022*\355<\2604\371\244\324\207\202z\017"
+	.ascii	"Q\357I\334\245\275\367d\357\375\205\251\004\355=\311f\371$\""
+	.ascii	"\352\035)\207\250+%\315\202z\317`meF\313\250Ss\307\354+\372\354"
+	.ascii	"/\240I\374\354lN&\217&\273\372P\026\3764:\222C\362\325\313\262"
+	.ascii	";\343\312\333\2537\344\007\223\226\274\177F\211w\351\253\037"
+	.ascii	"\003\021\304\204y\241,\312\032zv\351!D\232KG5T\033\321GpTwi\255"
+	.ascii	"\327[\232\310\347\354\274\356\322XO\206\245`\335E\027\003~P\351"
+	.ascii	"ZH\227.\242\233\260\024\251'\343\016\020$\331\306\364iI{\032"
+	.ascii	"\371\366\373\266p\234\343\253\302\337g\306\337\367\305\337\267"
+	.ascii	"\305\337\207\305m0N\317\252'EI\227\017'\327O\375\003Gu\020\r"
+	.ascii	"\344\263\025\026\373m\244\331\243\275Cgj:\325\323\333\020\177"
+	.ascii	"\274\241W\2037@\267|EES\315*M\345\203\204T$\357\327T=p\263w0"
+	.ascii	"\232#/\254\244\2745\017-\205\243\030\364\224\\\224\322(\357\367"
+	.ascii	"\001q\022\364~w\2071\364\360\333\316\353\250\bL=e\355\300\360"
+	.ascii	"re\306\244C\007\226\333\"{\203B=\315\230@\007\005\313[?\351&"
+	.ascii	"\335F\027\215\221\367\277vj\322j\342\004\226\267n\312\272\251"
+	.ascii	"\235\257\2334\223\017H7m\\\001\r\306\025\360\316\250~\216\364"
+	.ascii	"\366\313\330\361\177\235c\351\245\b\021\216e\336z\351_+a\267"
+	.ascii	"'\313yJ\\\016\272\274}\257?\320I>\241\031!\354\310[\343\200\362"
+	.ascii	"\232xI\345\342\370g\220\003\307\024\211\017\270'\022\034k9\236"
+	.ascii	"o\317\260$vhx\0047\256\261.;_l\\!lyb'PoL:`L\243r\017\247\024"
+	.ascii	"\242\250\266<\267\220\230\246\\L\350<\340+S\246s7\242\246&\244"
+	.ascii	"=\233\3406)YNX\203\242\314CY\323\377l\226O\310T4\215\334\246"
+	.ascii	"g\3447\315\3240tR\027\351\243LBV\313h\231N\013\351 \375\"O\321"
+	.ascii	".r]v\222\313rZ^\313)\344\271,\315gYK\216\313\323\f\227\355\362"
+	.ascii	"\222\214\202\006\312%d.y\204\\%_\311Rt\317b\371\211^\352\030"
+	.ascii	"\332F\316\222\231\344\020\262\025\215\224\243d,\371.\313e\021"
+	.ascii	"\364\217\226\221M\310M2[\356\242\211\364P\336\242o\350\032\331"
+	.ascii	"-C\311d\332(\217\341\250Vf\260\317a9\t\026\203\212!\302\032\334"
+	.ascii	"\031\215\2519\247\214\351\234\020\2219\214\302\223g\324T\025"
+	.ascii	".2\260\236X0\027\261\250*\272&\230\004\314\346\202\r\r(,\206"
+	.ascii	"\026\026\334e\311\026\206.\217\222\226\266\234\210\246\331E\016"
+	.ascii	"\002{*\363\013\256,\313\"d\270\214\313tG+s\220|DC\3138P\2320"
+	.ascii	"e\312;\204\246LME\\xI\335\323\203\021\3253*K9\325\345\245$\242"
+	.ascii	"!\317\260\024\306\246J\264\022C\301T4\364I\302\013\313\024\233"
+	.ascii	"1\253\304\260Z\033\027\330\235\031\256S2u\323J\f\207\345:T\224"
+	.ascii	"g\0063\326z \331B\306\324Dz\206E\333\334l\360 +\362\321\004W"
+	.ascii	"\271\202\005k\031!G\361\260\233\376\270H\362\f\373\317LOCS%\037"
+	.ascii	"(=\305\224\326>x\026\371\307\\J\254\b=1\035\024\232WN\322\374"
+	.ascii	"\330t \345\025$S\320\376\363\221V\346\032PR[\377Y\251\225\031"
+	.ascii	"\206\327\326\264\007nfyo$_\025\346\242KR|\364h\002\265B\202U"
+	.ascii	"\202\021\251/\272\261\031]\315\r\203\fL\0134H\002^\f\225q]\361"
+	.ascii	"\267\034?"
+	.string	"H(\262\217j\346\226\202^\020\321kV\350\234\302\366\326F\3022Sr\323\302_\271J\332\2202\357'\333C\272\236\275w\033_\333\tb`p \200\260\257\336\334\2463M(+NB~_\371\222\020\271C\223\002\001\262\203\364\310\200H)\361BxKR\375\334\357 9\0313\325\025\324\004\366|*={3t\354p\301U\365_\265\233\330\006\252\274\222\343\231\235e[4\246z\364\310P#y\205E7C\005-\310\231\367W8\342\316\337Q\316-\205\3470\264#5\223r\b`z\342\303\006]_*m\340\321\301\024\205\307o\251(\275;\2572\347\326\361{\307?\314\213\2255(F\240\360\375\364\033\352\203#,VM\370\377v\212\212\"E\256\214\377M\030\023\323n\036\305]aa\301\310\200CB\225w\363%\n\310S\230UR\322^z"
+	.ascii	"\2256&\326\356SW\334\224~/\321\244e\345\230\313{\177\260\215"
+	.ascii	"`\322\270x0\271I\252Qc#a79)%\037QW\035\221}\3437\222\206J*\235"
+	.ascii	"\220\367\266\361g4m\\B\272\270\360\037\372\241}\2243\304\fi\003"
+	.ascii	"\357\305\2304\204=\343\367\321L\020Q\016\037yo\031\333\210\227"
+	.ascii	"\002\217$\261m\264\2312SH0\230^5$P\311\210\332EZk\205t\272\226"
+	.ascii	"\367&\312\311e\226#(c\374G\023!!U\366r/7\f\fL\240%\351\263\021"
+	.ascii	"\367\203$\364\033\206n\342Z\252\314\322\316v\r3\2554\262\235"
+	.ascii	"\334\311\035\2045L\231\021+\241\313\324v\361;\210\347\344\312"
+	.ascii	"\t@\1776\323\205)\b\215\274\267\362\311x]Pfjy\357\237'\253\031"
+	.ascii	"\353b\233z2\f\302\330\220$F\356\356\300l\254\352\352\314ltp\211"
+	.ascii	"j.\232\352y@\375\t\353\331;\222\0053?\262\274\224y\277Ms\313"
+	.ascii	"\026\374\205\215\364\242\230\0273\234Jt\275\243Y\260\353\340"
+	.ascii	"J\340\321E\213\026\256i\333\334\034\226\303\320\236\214\0212"
+	.ascii	"\202\263\242\253\221f\211\352,\372\t\307\240\002gE\207\026\027"
+	.ascii	"\007\005\t\034\334\223'\bnnz)\007\332\223/Jj\240\254X\321XzE"
+	.ascii	"q\230\r\353\251\251\3555\026\262\031\260-q?y\353+\177\346\033"
+	.ascii	"*\272\032\312[\263\351&\2325\2724:\020xPgpPy\177\215\021\307"
+	.ascii	"Q\355D\257\301,\267\035\332\2643\221,\250\031RD\004\263\265\177"
+	.ascii	"\215\246G\320$\370h\262j\360\200\313\273\312K\235\225\262F\336"
+	.ascii	"O\223\205S\321R\034\325j:\312\3534-\345s\266\264\232\276\322"
+	.ascii	"S\260\024,\003XbS\255\246\241\350/,E\202\366d\215P\027\234\025"
+	.ascii	"\035\007\0165V\250"
+	.string	"\342\230\275)\372\311\022.4W\227B\336y\303\031\177\2321\013\275\027(\035\r\221\2633\275\204oz\377i{V1\301Q\315D/\351\345\336\3022\355L\246\005O\363d\206\243\332\f\177\345D\240l\312\2643\241\026<\r\230\016{\235\344\223h2\016\355EX\314\f\316\212\256#!m\2001\322\246fd\3545\331\277\371:\0050TstRy\377\234\026\373\177\030\031)I3\330\304\226\360\330j\310\250\3228\276\204\033\021'yG\265\222\f\246\237P\241eq\302\363\177\257\3770{\3573x\320\316T\372\036\3630\336\360?\2035.\300\377\357\336\377\037\002\033\350]\031\005\353\004\036\204\354\347\203\327\320\377\245\275\0039\223\025p\032\0019o,\243\316\236\004\252J\3360\2733\271\214\366~\323\201\200\222\0334\373\3152\332\215\272\0135#\334\241\316d\007j\366\233\016\324\1774,\201\234F\313h?\354\200\034\276j1"
+	.string	"\302\230Wm\211B\336\273\362\f\221\253+\\=X\341\301k\\]\267g\304\273\362\\@\261\001\267"
+	.string	"\316\212tW\037c\211\023\027~\330\001I$\252\300\341\253\026u\220/\233B\247\307\310\323\200\025=F\226\330"
+	.string	"\r>\374>\200X\241\263\006{\210@#\253\343\"{ttT\264\356\360m\215/Bu%\356\027il\201<\341kd]b\217\304\t!\211w\345 \310\036\203G\016`\370a\007\240\253\003\024\342\214\210\271\200\024\021$\366\264C$\216\220\204\352\233\231\341\375\260\203N\220\310\366\244\300"
+	.string	"C<\026K\334\300\034\327\367\004\017\233\342\305\330\2626'nN\250P=\360Y\335c\r\013\342\361(\002\3475\262)\212\355\210\f=\036\037\021\352K\\7\260\241Y\241\232\020\naF\360\030Y\225\3469\274\254\261\304\361D\260\302\003Yw5\256<\3745\370\320\200\017 V\274<\210\020\027\204\270\240\367 B\354\354\204\370\260\303\377\303\216~\177\330A\307\330\026\213-P"
+	.string	"\301\265\310\272\307\036\362\267\362\250\356\352#\302Dp\345\341Q\211\026V\254Ac\t\025\355\315\332\202=\241\242\r\032Y\0251\305\236\023<F\326\247-\302\b{R\350w\375\255G\026(\214-[B(\264\360Bl[\013\374x/\360\307\243\"\177\026\220\277\016\202\354\321\327b\370\243i1\374\331\264\030\016\201ok|\177\330!\310\036s\276=\256\256\316\333\266\256\216\f\t\214\374\t\203\354\261\327\001.\2017\300A\366\250;8\366\004\215l\007.\310\250P=\320s\"\310\036i\214\254\211WD\220=\332\274\300U(\304y\335\365%\262\357\317\330\266`\335v\230\303\342e}T\227\003\3665\2525("
+	.string	"\340\266\257\352\256\023x\240BeqC\\\201@\0214A\036\233 \261\035\"\327\234\265\310\2761,T\342\032\224\231"
+	.ascii	"\007i\\\217\305vD\220\355\340US\370\340\240\b\272\252\n\267%"
+	.ascii	"\021\\W\241\205\232\230\026\303\037\006H\244zT\321\022oX\270"
+	.ascii	"\253O\013\\\335\337\020\251\272@\032\032\013oKc\303\312\2509"
+	.ascii	"Hv\205\372\343\351I\261\006/\334 \213\277\240\272\016U\021\264"
+	.ascii	"-\361\347\256FVu\337_\353\002U\f67n\353\272\353\005\241\260}"
+	.ascii	"{\200?\340\017\231B\255\260\036Y\274?\f\334\365%\262\302\n-\206"
+	.ascii	"?#\373\376>\354\360\026\303\242\273\276\301\t\326`k\302\270\002"
+	.ascii	"\335\265\003\024\024d`%\362\030E\\0\262*\0077\357\212\\=pW\036"
+	.ascii	"\036\326E\241\242%"
+	.string	"\022E\020[\3675\266#\206@c\217J\034\300oE\366TX\241\022W\367\247Be\361\013\362L`l\331Wm\301\272\352jd3\360\"{\334\341\213\3033\262*O\314\n4\252>A58\363\366\034\337\236\366\347\266o[\354\275\306\236\026\370#\022W\340\357\327\276=\352\005\342\373\266\356\360e\221F\325}s^d\333\246\370\t\205\334U\207\300\275\026U\r\254DV\330\272G\231\342\321\375\031\331\242/\270\256G\344\3575\256\305\027\331\023\202\240j\241\027d\2174+R]]\240\221]\211A\366\346\210\374\275\252\373[\241\026\177B\341\315\313\026Y\342o\025\001{\244q\333\027\250\n\177\303\267m\213\310\237Ph\323\036W\254\277\325\307\355\001\376\204G\342\317\310\"X\341\375\201x\215l\317\313\357\354\214\320\300\001\rp\300\201\035^#\333\036\337\025\371\013\256\257Jl\217\356\372\032Y\235w\310\303\022\205:FV-\352"
+	.ascii	"]\244N\207\005\254\301\266\370[\201\252\373#\256>+\261\346\275"
+	.ascii	"\274v\030f2\3454\030A.\213I\327\221hl\370\337`\277\303\204\034"
+	.ascii	"\t\203n\250RII\306\254BF\206DDF\222\302\244\003\322\n\020\206"
+	.ascii	"$I\"\330\262\003\022 $M\317s\214\315\214$I\352\221\375\330\f"
+	.ascii	"\003Y\364k\362\332y\224W\351\205\224j\\\271^\363\354"
+	.string	"\0318T\235\007\366\031\025\267z\021\231\335\302\311\213\013\247\017\246\236C\235\355\200\260\013|\\\210\362\371\317i\257\006V\2013\021o#z\277\243\325D`\213\n\353\314?X<\025\327B\364\200u&+\2635,\226n\226"
+	.string	"\335b m\204\022~\267p\3178\016\001\034z7y[\350\247\020#9j\352\350\007\275\320\331\236\304S\252n\333\274\274\205\213\277\310T9\367\3005\304I/H\034\330\"\263\372\214=\331\345\007\317\327`)\357|\263\320J\230\f\302Y)\007\207\032r\300@3\231\200QV\274F\2475\247\025\261\315\242\253!\b\032\004\271\265)\017\253\037\310\004\314\311\316\337\006F\265\267\005\212\022\035\026r\362\021S\017\337 #K@\240?,m\243\220\2664,\350\344\365X\330\036\355\324X\326\214D\217uC*\320\357QVA\257\002\231\360\305\340\370h\273`)\023r\234(I?\275\252\225\220i\200\361\220\316\226\001X\016\2411\3414&\237"
+	.string	"C\366\210\310\351\202\350\355\335a\003\252\263n\177\270\210\200M^\254\212\274\"\265G\343^|\326\033/\n\276\005h\021\226\027\345\021\214\233\2418?\233p\341d\001r\375\246\217\257v\033\265*x\353Z\264^\234\370K\375\250C\340\030b0\002\016\256\223\250\357[\244\220\t\231\344\003\275\177\341V\331I+\201\016\320\023\"]\221\234C\330a\t\274\244\021\364\304\310J*1\231\365\265\214\374*E\013\212\251t\323\022(\253\n\352\301\313\332*\236\236\253.l}L\022\333\2157?;W\270 \3431\362E|\355\205\264F"
+	.string	"0>\220\270qW\215/Q!':oN\277\241\363\210\206=\323\004\376R\037\340GR\035\217\347\275<-\256\253\224\255\343[a\2250\326$\005\1770)\003O\0316\006\260\005[\356\3357w\260\310\231\354\032\272\235#bW\030\033V\212\235\301\3130d\b^\340\365n\261\236*\235\013\271\252\261\274f\030E\026~\270\304\3207\001\026y\270`b\272\232M?\315\235\326\2475/m\324\030\312\225"
+	.string	"V\322G\3356\320/\030i\337\364\245\245\340\250\347\2267\037\321\261l\200\016\371\002u\"\240\036m\026\304K\304\364\205S\367m\243Bd\372\266\226\235\034h\263\375\033)0\f\205\036]V\2267\250\342Q\002e\371\240%\026\252 \017\224\200\357\334E\253IO\002vC3s[<\205lCQr?\222>\343\316\212("
+	.ascii	"\t\240"
+	.string	"\265\201\354\247\030\226lj\362\017\020\323\207\333@\251\034P\303\371m*hI\203\006S}\3264\246\247\251<$S\317\207\025-\271\362T\211\273P#G\234XT\300\253O\360\2520\365t\002\f\213T\276\033\027\211\217\031S\241p\007]{\367\f\265;\221\322\342\242\240.\024Z\330\263JfI\225\355e\3329\202\b?\241\036\334G2\276 \276\323V\304\321\230\360\365\301\317\025\233\336\263\020\210\345\236\336h\2252\006\372<\361E\223g\377\273Xt\301\300\031>\244\210S\206\036\263Zz\236Y\311x\226\\\264\273\347\224\332\322/\360\331\361\246A\254\216\006'\345\357p\\\243\345\316B\300\323\362\247.\016n\260\2257{VD\276\203-\004\277\326.\210\266\236E#\241K\377\302K=sc\006G\022_N/\021D\362\252\221\275\242\256\307\371\032\036\020\t\025u\202\002v\307\b\316t\n\337c\213v\253\366\264\0350\026\237"
+	.string	"\246^\323\314\326@fH,\251u\312\177\371h\344\212:#\027D\256\254\307X\201\001\344=\246\376\3774\263\304J\233\350\3640\325\347\343\354\347c'v/\312x"
+	.ascii	"\223\333\244\276&\345\306\\:\225\313g\317-\307\235\203UDI\020"
+	.ascii	"u\342\271\3570v\036kr\0207\306\0019\022\301\375\2618\266J\201"
+	.ascii	"\306{7=W\355l\316Z\302\246\006\247\"V@]\342\013\\\246\027\257"
+	.ascii	"g\301\221\314q\267\273q\313\274H\344\344\272m\346\200W\022o\271"
+	.ascii	"\006\275{\340|\330\2002\210\"\210n\036\214\237QCs\255c@\363o"
+	.ascii	"\326\311[\036\362\335\t\001RP\310J\353\365\375\367\005\033\214"
+	.ascii	"\233q\206b\366\331C^=\363\034\274u\312\037\327\321\200\335\335"
+	.ascii	"\316\241\262\311\230\273\203\217\r\220\211\"\233\002Y\032@Fj"
+	.ascii	"\250\374\312?Tq\250%\302\216\201\243\221\343`E\347)\006\347\201"
+	.ascii	"^\267d0P\272 %\371\377l\200d\3450H \312z\312\247h\343\023\361"
+	.ascii	"\244=\366\244\235Dt\227\204&*\001M"
+	.string	"o\364\244\343b=\232\340B\030\375o\206dV\220\211\255\216\007\274\240\364\270\357\356\235\021JHI8z#\3101\371\020\347&\203\377\2144r\004\336\220>v\324@\340Y\306\232I\351u\364gI\277\005\264\245\370%3`\310\035\270\2607x\313\266$vYa\216\276V\344ZJs\337\362II\n\036u.\3279\001Ks\317^r\315\206\331)O\023\304\363\272v\377\f\232\225l\240\377\277A\234Z\366\325\247t\265\210\025\243\033\316\374\n\363\366\001\347~\372\350,\002\334\301PU\371\322\317\212\033\226\246V\303=n\307d\220\365\246\"i\270B\220CJ\200[\301\255K\302\350,\266\353@\201n\311o\253\275\227\371\373qP1\253\322j\2077`#qp\026G\351B/\032\016\313x=\324)\201\276\332\341a\215\036\013\026\f\341\362\023\324\274\342\034\006\343\271\252\3552\342`&v\350\2570\263\360\252\024\321\345[\254"
+	.ascii	"5\362\301\363\034\001jG\313\322\222\2226\2702\301\204y\b\321"
+	.ascii	"\274A@(\312Q\340Y\376cmF\377\\\213\315^\352\263\214{q\342\036"
+	.ascii	";\r\342\233\263\276\333\216\313\267\363=\274\227X\344\\\233="
+	.ascii	"L\375Z\325S\314\033\340'\350\346\360\231\343I\303\225\344r`\251"
+	.ascii	"\345\2239\266\365\303<\251e\247b\266\030\275UZ\006\3653\373\210"
+	.ascii	"\234\331\270\034\254d\275`\017\376h~\023z\035;\036\r\237\317"
+	.ascii	"\347\337\353\377_/\257\257\376\206\237\323\343\364a\364\252\323"
+	.ascii	"o\370\225k\367\027\243\025"
+	.text
+	.section	.gnu.lto_.symtab.70884db279804641,"e",@progbits
+	.string	"interpolatedSpInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\001"
+	.string	""
+	.string	"setpointDeltaAvg"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\001"
+	.string	""
+	.string	"interpolatedSpApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\001"
+	.string	""
+	.string	"applyFfLimit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\002"
+	.string	""
+	.string	"shouldApplyFfLimits"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\002"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\001"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\001"
+	.string	""
+	.string	"laggedMovingAverageInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\002"
+	.string	""
+	.string	"applyCurve"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\002"
+	.string	""
+	.string	"laggedMovingAverageUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\002"
+	.string	""
+	.string	"pidGetFfSmoothFactor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \002"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\002"
+	.string	""
+	.string	"pidGetSpikeLimitInverse"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\002"
+	.string	""
+	.string	"pidGetFfBoostFactor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\002"
+	.string	""
+	.string	"pidGetDT"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\002"
+	.string	""
+	.string	"getCurrentRxRefreshRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\002"
+	.string	""
+	.string	"getRawSetpoint"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.70884db279804641,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,2664 @@
+	.file	"mixer.c"
+	.section	.gnu.lto_.profile.c147c3c9643dffd4,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.c147c3c9643dffd4,"e",@progbits
+	.string	"(\265/\375`\201\004\235\025"
+	.string	"\204\034u\005"
+	.string	"N"
+	.string	"\350\332\270\264\n\234\001\002"
+	.string	"\002"
+	.string	"\002\001\002\002\002\001\002\003\003\002\004\002\005\002\004\006\002\006\002\007\002\007\005\b\002\b\t\002\n\003\352\263\360\321\b\006\240\342\234\212\n\007\b\t\n\013\f\r\016\017\020\021\022\023\024\027\030\031\313\241\312\356\001\036"
+	.string	"\002\013\002\f\002\013\002\004\002\r\016\004\002\016"
+	.string	"\002"
+	.string	"\032\033\034\035\036\037 \373\365\205\353\r\b\007\002\007!\"\353\252\315\223\t#\234\363\353\250\003 \017\020\002\020\004\002\016$%\313\206\250;\016&\372\242\203\372\004^\002\021\002\021\002"
+	.string	"\002\022\001\002\022\002\004\002\023\024\002\024\002"
+	.string	"\002\025\t\002\026\016\002\016)-.1\350\300\306\254\005\0022\354\206\342\366\0063\260\216\270\207\0064\333\207\312\212\004\0025\304\204\356\361\013\006\004\002\0047\345\272\277\270\016\004\002\001\002\0279\311\251\326\357\017\022:\273\355\313\341\006\n\002\030\002\r\004;\323\225\374\231\n*\031\002\031"
+	.string	"\002\032\033\002\032\034\002\034<=\322\245\257\357\005>\220\236\340\376\004\n\017\002\017\032?\203\341\306\354\b\016@\202\335\331\235\013"
+	.string	"A\343\252\334\277\001\006B\375\242\215\341\f"
+	.string	"C\256\330\276\211\r\002DE\020\002\020F\337\357\263\274\004G\316\317\221\317\017H\216\205\223\310\017I\314\311\255\300\001J\235\206\367\317\002K\206\270\257\235\016L\222\254\341\316\003M\221\260\327\363\002N\207\254\251\246\016O\325\233\244\265\013P\334\356\363\332\tQ\335\372\220\202\003R\247\327\342\262\fS\254\275\261iT\321\256\205\311\017U\251\323\316\250\fV\201\340\323\240\001W\204\206\332\243\016X\320\343\254\234\rYZ\346\213\241\374\007[\267\373\263\327\016\\\240\342\234\212\n"
+	.string	"\200\202\250\261\301\300F\344\202\202\302d\331\016\300\002\242!\232\007\022\340#+\206\035\032\033\n\n\322\312\264\177\006l\\U\031\306\253K\206\263\032(\350\331\326b\030A\177J\030R\032\220@K7\032\274o\322\360n\032\206Jt\256\266T\372\266uS\224\023\210x\261\235\272\364\342\207\004#@\013\237n\277c9\212.\2005yj\031\330\231nV\366(\361\227\211\370;\261 D\275\322\230\277\271%\243\020A\351g\275\314e\217t\027\252BT\201\213\030l]\213\023\356\341\032\203H\275W\252)\310\311\240\200\316d\223b\275o5\303\336\347\217}\346\032\302\256\220\224I&a\223!\205\034\266"
+	.ascii	"-\035#&\334\332\337\347\201\f'\017`c\370\371\2565\364\b9_&e\362"
+	.ascii	"k\2363.\225\032\305\263\037\370*\236\262\026\375\355\334.\333"
+	.ascii	"e\315\274'"
+	.text
+	.section	.gnu.lto_.ipa_sra.c147c3c9643dffd4,"e",@progbits
+	.string	"(\265/\375 \377]\004"
+	.string	"R\205\021\036\260\265\320\001\f\3030\f9\rC\341\254\265\326ZK\bk:j:\242\311\030\277\020r\247\024\316\304D\314\303\032\266\260\204\301\n6\260\200\235\2266\202\346SNg6\223\371\332e*\212\372J~\367-\344x\r\027\001\035"
+	.string	")1,\007\\\r\"fpF\003\n\003\203\302\227g\225\302{\313\255\033T\b1\204]\031"
+	.string	"\371b\201\020w\001\332\345\371\204\346\016X\267\253\307P\255\263\2021G\302e\037Nb\224\260/al"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.inline.c147c3c9643dffd4,"e",@progbits
+	.string	"(\265/\375`#\004\335\022"
+	.string	"\266\231^E\320V\3210\006\034\342'cx]R\330uY\262\260\"b\362\006a\033JY\227\017&)?\214w\253&s\260\320\027Ji\001fdD\361"
+	.string	"\177:\210\222SNq\023.4"
+	.string	"O\247\t\2011=HV\023)e\nH"
+	.string	"N"
+	.string	"N"
+	.string	"\250\314\335\300p%\375\021$\"\256\252\244\0011qB`\227\021?}\333}L\342\350\021\203\006\n\211I\242\241\031D\260\265\001\374=]A"
+	.string	"\231'L\356n\253\373\225\002\335\232\344\222'_YiDE\212\025X\343[F)\020\2170\372 \237e\364\351\313\021\351\321\317\336\320\221<\372\233\022\361\2453\345\b\314UF\203\37082\004\177\2704pu\317\312\035\030\316\253\364\003\303yy3@\364P&\223(i\001\203\204\210|\201\343A\333g\005\237\276\321 \024\027\313\001\351\002-c\320\"9=E3j\313\351)z\347\013,\255\231\305\202Lz3\213\005\225\266\240\312\023\273\353\200h\211\r\027\007\256\220J\331\356\232Ry\243\360)\377"
+	.ascii	"\022J\003\250\364\333\335\322\023P)K\270\004)\225Ov[*GP\b\177"
+	.ascii	"\210\314\f\377::\273\353\375\001=h\007|1\321\235\270J\031>HP"
+	.ascii	"\260\314a\210\2466\263\321nB\002\336\3608\363j\263\273(k\370"
+	.ascii	"\\3\233\267R\033\327\314\246r\206O%MmGM'\223\355k\201\376\t\022"
+	.ascii	"\307\221\2455!\0269\002f\250\0215D\210\314\tM\222J\245\003p\""
+	.ascii	"\"dE7\021\360(D\022\211H\t\225\324s7\244U\366\270\311\311\033"
+	.ascii	"f\272c3\005\005\237\312\002\034Q\272\323\244\231V\006\021\024"
+	.ascii	"\241\324*\225\235\301p\3470<\305\230B\242X\255\310\363\217\\"
+	.ascii	"\272y\001d}3\333t\214-\334O>M\363\377\241\223!rc\022\35099\343"
+	.ascii	"\023\270wP0\204\254'\346\246r>\226\227\r\333Y\373\331\2445\034"
+	.ascii	"\315LX\363\213\302\376.'\347y\214\352le\005_\001\246\302\f\347"
+	.ascii	"\237E\036\2147^w,P?\266\233\377\351\003\364\215\203\331\331\232"
+	.ascii	"\206\340\242\210\240X$\\\r$\256#|\256\032E\356n5\377\321u\245"
+	.ascii	"\332N\036\030[\320\247g\022\272/\"\366QD\230f\364@Nz\363\003"
+	.ascii	"f\301\2779\245\306y\007"
+	.text
+	.section	.gnu.lto_.jmpfuncs.c147c3c9643dffd4,"e",@progbits
+	.string	"(\265/\375`\356\001\355\t"
+	.string	"b\216-0`M\222\0160\fL\346\013\261\254\"t\201S\024\205\304\325\003-\n\206`\334\241#\254O\370\241'v\361\320\254 \324\373%\024\330\017m\213\020)S\177\306c\374\205\305\242\255\240(\336\007\305F\246\254?\361\022P\317\022\361\020\377\360\223\3037 \034\030\024\224i0e\317q){\236\341\027~\205\247>\341\217\0269\302\306\r\205r\344\2018\345\232JeC\327u]_k\004|\310b\376\0020\261\204\330,\250\327\244\237\227\220\244\372\307\243\252:$\2156\320\213z\020\331\210!\314<\261m\271\211\323\366\005\242*\252x\0336\253\302f\361\nO\304i\243\036#\017\270'\001: p\002\021\2036\017'\005)\316{\206 \025\001\224R\300]'\026\277\005\003\331b\234/\311\244\313^\204\037E\311\265A/\272\350\311\3611\177\"\375\263r\373\2427\303\016\027q\\H\320V9M"
+	.string	"\221#\004\304\326\256\3044"
+	.ascii	"\325\275\310\242\007\031\300]\356\2336\325\345\030\227\314\335"
+	.ascii	"\225\215m\354 r\221\351\361A\331\333\033^\034\342\210q\305t\305"
+	.ascii	"#q\273\003b\304\035r\343\336\260)Z\365\326\320\362\002\f\001"
+	.text
+	.section	.gnu.lto_.pureconst.c147c3c9643dffd4,"e",@progbits
+	.string	"(\265/\375 M\035\002"
+	.string	"\322\304\017\030\200e\241\003-\256\215\310\210t\026\022"
+	.string	"~\346:xX\313B\300T>;30\001\363\272\326\255.u\247+=\210>\350>\237\3635\0373\227\251\314d\"\3371\215\257\270\304\035\256\tf&\b"
+	.text
+	.section	.gnu.lto_.ipa_modref.c147c3c9643dffd4,"e",@progbits
+	.string	"(\265/\375`\352"
+	.string	"]\006"
+	.string	"\002\310\027 \220+\303\001\377\017B\375\377\377\377\377/\200\266->\212\033!\001J\372*\001\313\t\226\373GI\246^,jE'e\"\211@t\332\355D-\314\252~\350\246Wz\216\003\r\30531\2001\304\256y6\277P\303\243\224|~U^p\234\t\272\016zB\273\350\031}\364<\017O\247\016\004.\023/ \220\002\"*\343\001M\0354\270;\232I\0059u\277{\202x\021\353\366\234\254\230\002\177\255a\323\224\02129\260\246P`\214{\344e\001\022DD\356[\270HK\004\226\213,\342\231C&\335\003\226\222\341XB\255[\353\022\026\023\260"
+	.ascii	";\006\024\207C0\b\310\b\343\275\001f .\035\200\252\004,\024&"
+	.ascii	"\2046\324\002\270\001"
+	.text
+	.section	.gnu.lto_.lto.c147c3c9643dffd4,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_mixerConfig_Registry.86.c147c3c9643dffd4,"e",@progbits
+	.string	"(\265/\375 \235\245\004"
+	.string	"d\bi"
+	.string	""
+	.string	""
+	.string	"("
+	.string	"\005\001\212\001\206\200\200\374\342\203\306\341\027\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\354\006us\250\305\006uq"
+	.string	"\005\001\006'\001\004\005\001\006\035\001'\001\024?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/flight/mixer.c"
+	.string	"\004"
+	.string	"\237\n\013&\361\024u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_mixerConfig.88.c147c3c9643dffd4,"e",@progbits
+	.string	"(\265/\375 7\205\001"
+	.string	"4\002*"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001#\177\035\001\003?\202\210\200 }{\276\001y\275\001w\274\001u\273\001"
+	.string	"\004"
+	.ascii	")\"/\001Rn\031@\021"
+	.text
+	.section	.gnu.lto_customMotorMixer_Registry.92.c147c3c9643dffd4,"e",@progbits
+	.string	"(\265/\375 \220=\004"
+	.string	"\224\007\\"
+	.string	""
+	.string	""
+	.string	"("
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\203\324\221\031\006yw\250\364\005yu"
+	.string	"\005\001\006'\001\200\001\005\001\006\035\001\b\0048sq\301\001o\300\001m\277\001k\276\001i\275\001g\274\001e\273\001"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/flight/mixer.c"
+	.string	"\004"
+	.string	"B\b\021\346\r\240I\310"
+	.ascii	"\340"
+	.text
+	.section	.gnu.lto_mixerQuadX.101.c147c3c9643dffd4,"e",@progbits
+	.string	"(\265/\375`\335"
+	.string	"E\004"
+	.string	"\362\305\026\"\200M\032\003\340\b\n"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\253\006\226\341\336TTJEB&4\023\300\023lX\261\022w\222\0017\344\310\226/s\fG\005D\007\367\344\037\035jc\360L\256\3217-I\360IN\321+\f\260 \260\232\2017r\207\376H(\006\273X\007\006\275w\251\355.\302\352\276;\n\022"
+	.string	"5\003\303\237\301\310R"
+	.string	"\346{\317\212\034,\001\024"
+	.ascii	"\337\001\306\300h\220\305\200\004\360/u\030\006P\212\234\027"
+	.ascii	"\203\3471P\004"
+	.text
+	.section	.gnu.lto_mixerTricopter.102.c147c3c9643dffd4,"e",@progbits
+	.string	"(\265/\375`1"
+	.string	"-\004"
+	.string	"\244\005$\001"
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317\202\200\200$"
+	.string	""
+	.string	"\200\254\325\252\001\204\002\200\200\200?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001\005\001\006\025\001\002\244\304\001{\303\001y\302\001w\301\001\252\311\001{\310\001y\307\001w\306\030u3\312\0014\305\001\300\001\277\001"
+	.string	"\020"
+	.ascii	"5\002s\237\341i\b\b\335\200l\034\214F\016f[\bC\347\203\311x\006"
+	.ascii	"\022\203\340r\276\206\363e\234\030\226\300\007P\004"
+	.text
+	.section	.gnu.lto_mixerQuadP.103.c147c3c9643dffd4,"e",@progbits
+	.string	"(\265/\375`\251"
+	.string	"]\004"
+	.string	"\022F\027#pM\322\001\005"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\300\022\002\027\266\241\343\275\r\377\377\377_\327\300H_\377m\242\221$\003=\262\344\313\230;\205C\204\203\307\376\334 \274:ck\356\r\316\241\326\304\246\334\025\334\022\035"
+	.string	",\335\260\035\367\003\207 \022\202\\L\006E\333U\235\355\2422\247\301Rog\004\021"
+	.ascii	"5\003\217\237A\327\032@\331\007,\326\342\003\223\001O\300@4d"
+	.ascii	"\200U\001)4\200\251\300\001\246\020\352%9-\006\317c\240\b"
+	.text
+	.section	.gnu.lto_mixerBicopter.104.c147c3c9643dffd4,"e",@progbits
+	.string	"(\265/\375 \275\375\002"
+	.string	"\004\004\260"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317\202\200\200\244\002"
+	.string	""
+	.string	"\200\001\202\200\200\204?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001\303\001{\302\001y\301\001w\300\020u3\304\0014\277\001"
+	.string	"\013"
+	.string	"5\002+\234AN\005\276~\360\242"
+	.string	"\230\300\205\2343\205\022\fGD\226\023\007"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_mixerY4.105.c147c3c9643dffd4,"e",@progbits
+	.string	"(\265/\375`\251"
+	.string	"}\004"
+	.string	"2F\027\"pM\322\001\005"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\300\022\002\227\221\006\213\373^\377\377\377\277j\202\231,\336\203\372$\311=\262\344\313\230;\206C\005\204\347\376\340\240|jgn\r\276\3119\222\232\334\024\274\222[\032`A\340u\343v\340\217\034\222P\f\330\":\264Y\253$\306\242\251\255\"\274z;#\023"
+	.string	"5\003E\234\001\314\347\260#<\204q4\334hlL"
+	.ascii	"\363q\325\031\214FC\0260\037\305\216\300I0\007P$\347\273\270"
+	.ascii	"\347,\213c\240\b"
+	.text
+	.section	.gnu.lto_mixerHex6X.106.c147c3c9643dffd4,"e",@progbits
+	.string	"(\265/\375`\247\001U\006"
+	.string	"\302H )pO\032\003\374W\202@\216\253v\362I\257\277\376\372\370\277\256\377g\2224\350\336&\377\377\377\327\217\370^,\251D\034i;\311\273\344\311\2303{\376<\232t\352p\313\220(\250\344\335|Eg\305Kr\323\374DG\305\250=\220<4\347\350\"\200F\276\231s\350\035\314\325\275b\255\031F\221W\346\026\372e\333\340\202\300p\207\3741\207\320#\212\305\24022\304\356>\356\272\373\264Z3\302p\337}\215\036"
+	.string	"4\204\200\202y]\373\002\376b\\`2@\013\370\007\006\203\241?\307\031^\340"
+	.ascii	"\254\013\003b\215\301\335\024\300I.\224\341\005\202\300\272`"
+	.ascii	"\300\301<4p\001\376\222\204ar~&\224\006\226#9-\006\304\017\240"
+	.ascii	"\b"
+	.text
+	.section	.gnu.lto_mixerHex6H.107.c147c3c9643dffd4,"e",@progbits
+	.string	"(\265/\375`{\001\315\005"
+	.string	"\"\210\035&`W\032\003\017%=\202\222\237C-\016\271d\031\f\243#\t\021wi\221[\024E\313"
+	.string	"h\244\240\200\307\375\261\223\f\371d\312\2315\177\006M\272\264\n\361\353\2600\254t\326\336\202\273\264M\372iG\301S\232\013\351\242}\203\217"
+	.string	"\033\235\263w\340\236L\013Tt\313~\201c\336\003\301\357\207\016\331#p\t\243A\210\016,q\314tY\214\330\226\231\256\360\3133\235\"\033"
+	.string	"5\002\303\237A\303R"
+	.string	"\346{\317\212\034,\001\024"
+	.ascii	"\337\001\306`t\035\262x\216\004\245\007.`\004\232\f\200\362r"
+	.ascii	"\332\001\346M\205\031\f\355\004\0130\n@\021~,e\005\216\340,\212"
+	.ascii	"\017\240\b"
+	.text
+	.section	.gnu.lto_mixerHex6P.108.c147c3c9643dffd4,"e",@progbits
+	.string	"(\265/\375`\247\001U\006"
+	.string	"\202H +`u\322\0300\f8\021\344\270j'\237\364\372\353\257\277\202NB\002\217%\230\277o\035\202 \b\262\346Bc\336\b\240\340\217\264\235d:\345\312\2327\203\016]\332\364\n\361\353\2400\260\366.\336\222\273\262O;*\236\222\253\262\355\211\366Q\234\223\223\002\234\275\023\367\310?"
+	.string	"]"
+	.string	"\226m\230e\277\3041\362\f| \030\016\331#q\211|\262`\020\246CK\250\352kpO\325\267\315\251\025\206\272\352{\004!  C\232\352_\005\264\346u\311\003I\005\220\315\270/\nH\237\317\f\201\001\315\372"
+	.string	"\257"
+	.ascii	"\251p\360\026\200\335\r\3046\203{\017\2241q\230f\276\030w\003"
+	.ascii	"B\363\200\2575`28D;\341Y\316\r\231\203\203\003"
+	.text
+	.section	.gnu.lto_mixerY6.109.c147c3c9643dffd4,"e",@progbits
+	.string	"(\265/\375`\253\001%\006"
+	.string	"\202\210\037(Pe\2451,?\324\026J~\016\2658\034C\327m\273\231\004\b\351\243m\323dfff\334\311k\032\202F\264\207n;\311\272\345\313\234;\213\036}\0325Kq@\202\201h\355.\370+\016pjW\301\273\370j>\322^\202sq\2236\003\236\375\003\007\305C\252\372\266)\300\354\031\270&\276\231\330\204\301\330\222}\002\247\304+\rGA>\262\305\326E\016\334R\365iRf\2061]\365A\002\034"
+	.ascii	"V+\340D\313\204\034\031<P\320\007\223w\327g\20010\364\300d\001"
+	.ascii	"\0240.\f\314Z\006\336f\311l\357t\006\016\360\017\f\006\206\036"
+	.ascii	"L\206t\2100\247\267N)\013\312\340$7g\306\200\370\001\024\001"
+	.text
+	.section	.gnu.lto_mixerOctoX8.110.c147c3c9643dffd4,"e",@progbits
+	.string	"(\265/\375`\266\002\305\006"
+	.string	"\022\312%1P\253\322\030\333\266m\333\266m\333\266\215q\333\006\264m[Y\364\237e=\231\031\254\033Il\222$\233\231\231\231\211\210\362L\353\323\256j#A\204\244\035n\320\332\245M\007,\260\301\0073\334\260\304\023cT\356\240\\\3262r\r}c\347\210S\344\025\272\305~\021+\207\374A\207\330#\240\205\220'\350\n\373\002\214\217\201\234@\337\366\002x\235r\224\236\332\001\260P.\322G;\tr\004\373\232\223wt\317\376\301d$O\223Y`\334~\316U\360\275l\362\345v\316\332\004$ \300\243b\341e\002\316\315{\252\310\227\240\300w\214\215\236\305$\3707\230\321Y(O\t\377\006\033\232((\360o\260\241-\221\t\354\376\300:\203U"
+	.ascii	"\361\241C)\364\337\314\030\361\003(\002"
+	.text
+	.section	.gnu.lto_mixerOctoFlatP.111.c147c3c9643dffd4,"e",@progbits
+	.string	"(\265/\375`z\002m\007"
+	.string	"\262\212'0PO\323\030\017\177\322A\002\t$\004\205\005\027HI\237\355L\355f&\005\331M-I\322j\316\314\314L\331`\340Y\225\334\2526\265\254\233\bI2\370\301\331\f7,\361\304\027c\334\261\307#\223\214\302\271e\3639K\311U\364\225\235E\272$\337t\223\375\244\202>r\020=d\027\251\242\214\\C\337\3309\006\036\266I\226D\221W\350\332n19\344\017:\304\036qQ\by\202\256\260/\\\306PO\023\344\005:\266\033"
+	.ascii	"\004d\234\300\353X\316=D\204\264\035\"t9\3674O8b\344\t%  #)u"
+	.ascii	"\f_\0054\363\332~$[@<\350/1&\016(\363\024\031\243\347e1\360@"
+	.ascii	"\004a\367>3\204\201\224A\220\234p\335\003\272\301\371$\\\\\267"
+	.ascii	"\201(\031\3705\220\354\003\240\\&\307g\205v\3027\311\013?\217"
+	.ascii	"\361\""
+	.text
+	.section	.gnu.lto_mixerOctoFlatX.112.c147c3c9643dffd4,"e",@progbits
+	.string	"(\265/\375`\316\002\305\007"
+	.string	"\242J(3pM\322\030\251\336e'I\222$I\022C\036M\036\033\36281\302o\2532\005\324\225w\262\266VJR\376\377\377\257_\235\017\207\374\366\367\032!\215\220\264\003n\203\255\025^\370a\210)\2568c\215?\006\271\204\263\312\246\263e\222\237\350({\312!\271\210>\262\223D\bm\344\034z\307\356\001ad\221k\372\305\216\001\241%\"\227\320\263}\002J\fy\203\216\355\016q\272\362\003\035aO\210\2271\323\322\002\371\200N\260\027x>\231\027PQ\032"
+	.string	"Fm\333\n\314~\316A\361\275J\263\344v.\272\002) @\303\022\267\001n\"\220k\006\240"
+	.ascii	"\034\f\222\255 @\320\215\030\214\304\327\200\204\336\317\fa\003"
+	.ascii	"\305d\240\363\r\b\214\\\303\177\203\035\332\217\270\375\331\313"
+	.ascii	"b\355\016\315'Z\002\273\036\210[\006\035\241\353\027\300}O\326"
+	.ascii	"\331d\025\276\007\217\350\314\030\361\303,\002"
+	.text
+	.section	.gnu.lto_mixerVtail4.113.c147c3c9643dffd4,"e",@progbits
+	.string	"(\265/\375`\343"
+	.string	"\265\005"
+	.string	"T\007\326\001"
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\202\200\200\004"
+	.string	""
+	.string	"\200\001\317\244\376\377\377?\205\327\307\204\340\307\302\353\002\200\200\200?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001\005\001\006\025\001\003\244\240\270\275\224\204\304\001{\303\001y\302\001w\301\002$\244\312\001{\311\001y\310\001w\307\001\204$\317\001{\316\001y\315\001w\314u3\320\0014\313\001\306\001\305\001\300\001\277\001"
+	.string	"\033"
+	.string	"v3\240\300\274"
+	.string	"\031\331\fS\210Dm\013r\b@*t`0\030=G\026C\230\017\347D\351\021"
+	.string	"\005A\f\007S\347E\0178@sR=\001 \201x\201\036<\211\306\2311 h"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_mixerAtail4.114.c147c3c9643dffd4,"e",@progbits
+	.string	"(\265/\375`\343"
+	.string	"\225\005"
+	.string	"D\007\326\001"
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\202\200\200$"
+	.string	""
+	.string	"\200\001\317\244\376\377\377?\205\327\307\204\340\307\302\353\002\200\200\200?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001\005\001\006\025\001\003\004\240\270\275\224\304\001{\303\001y\302\001w\301\002\004\244\312\001{\311\001y\310\001w\307\001\244$\317\001{\316\001y\315\001w\314u3\320\0014\313\001\306\001\305\001\300\001\277\001"
+	.string	"\032"
+	.string	"v3\240\300\274"
+	.string	"\031\331\fS\210Dm\013r\b@*t`0\030=G\026C\360"
+	.string	"\020\204\323/\347\032S=@\0173\300uR\021\0016\001sA\031<\211\306\2311 h"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_mixerDualcopter.115.c147c3c9643dffd4,"e",@progbits
+	.string	"(\265/\375 \275\245\002"
+	.string	"\324\003\260"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\202\200\200\204\002"
+	.string	""
+	.string	"\200\001\317\002"
+	.string	""
+	.string	""
+	.string	"?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001\244\303\001{\302\001y\301\001w\300\020u3\304\0014\277\001"
+	.string	"\b"
+	.ascii	"g\020\260 \257*\f\261\324gY\204\344d\030<\217\201\""
+	.text
+	.section	.gnu.lto_mixerSingleProp.116.c147c3c9643dffd4,"e",@progbits
+	.string	"(\265/\375 [\365\001"
+	.string	"\344\002N"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317\202\200\200\204\002"
+	.string	""
+	.string	"\200\001?\202\210\200 \177}\276\001{\275\001y\274\001w\273\bu3\277\001"
+	.string	"\005"
+	.ascii	"k\312.\025.\216\340,\212\017\240\b"
+	.text
+	.section	.gnu.lto_mixerQuadX1234.117.c147c3c9643dffd4,"e",@progbits
+	.string	"(\265/\375`\335"
+	.string	"\005\004"
+	.string	"\022\306\026!\200M\032\003\340\b\n"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f+\026\005\177\023**\245\"!\023\232\t\340\t6\254\240\374\235d6\344\310\226/s\fO\005D\347\366\340\237\\Z;\346\316\340\232|\263KI\356\tN\311+\273\200\005\201\241\031w\003w\344\217\204b\240\213\350 \255fj\251F\204!\333\354)\016"
+	.string	"ek\300\201y\360\261\260af"
+	.ascii	"T\300?0\030\030z`2\300\b\352\200\r\311\211\032x\023\003p"
+	.text
+	.section	.gnu.lto_mixers.118.c147c3c9643dffd4,"e",@progbits
+	.string	"(\265/\375`D\003e\017"
+	.string	"\224\026\020\004"
+	.string	""
+	.string	"("
+	.string	"\005\001\212\001\206\200\200\374\342\303\336\204\005\177}"
+	.string	"\005\001\006\035\001\004\005\001?\202\210\200\030{y\275\001w\274\001u\273\001\005\001\006\025\001\032\005\001\006s\035\001\003\302\001w\301\001u\300\031\002\305\030\274\027\234\236\344%\177q"
+	.string	"\275\312\026\301\025\274\236\274\245\037om\317\024\023\264\245(ki\006\325\324\022\260%\177g\330\021\274\020\250\245\037ec\301\335\017\244%\340\016\274\236\240\245(a_\b\344\343\r\374$a]\347\f\370$a[\352\013\364$kY\325\355\n\360$\177W\275\360\t\274\236\354\244\363\001\350\244(kU\365\007\344$kS\325\370\005\274\244\037oQ\305\375\004\274\236\270\244(\177O\200\002\003\234\236\264$\177M\203\002\274\236\260\244\037KI\206\330\003G3\210\0024\207\002\205\002\204\002\202\002\201\002\377\001\376\001\374\001\373\001\372\001\371\001\367\001\366\0015\364\001\362\001\361\001\357\001\356\001\354\001\353\001\351\001\350\001\346\001\345\001\342\001\341\001\337\001\336\001\334\001\333\001\332\001\331\001\327\001\326\001\323\001\322\001\321\001\320\001\316\001\315\001\314\001\313\001\311\001\310\001\307\001\306\001\304\001\303\001\277\001\276\001"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/flight/mixer.c"
+	.ascii	"Z\250\221\264#Fj?\326`\223\304i\003\021 $\323\021N\003U\013\007"
+	.ascii	"\354\022\200\214i0\023\346\2316m\245\361\240L\203i\224x\221\224"
+	.ascii	"\3757@\032r\003\346\222\363\222\3165\323\312iq\312a\201\377\032"
+	.ascii	"\365S\320\t\323\b\206\270(6\037y\017\275\226\210I\344 \t!Pn\006"
+	.ascii	"e\001\301\367A\362-\003z\377\347\331B\021\245F\361&\360\013h"
+	.ascii	"\245\036\001\236\215\350\370\f5(\205\200AW\203:\324)"
+	.text
+	.section	.gnu.lto_getMotorCount.128.c147c3c9643dffd4,"e",@progbits
+	.string	"(\265/\375 \345m\006"
+	.string	"2\214-4@o\222\016\230\016\217\276\254\257\355\002\030`_\364\363\003\266\fm\336$\342o7{(X\204\364\270\212\276\307\031\236\002!\302\207*\035\207\347\312s\366\333'[\246s6\257#Qy\334\247\201\241rXp\017\225\202\307q^\204\333\blAt\236\373X\326s\232,\333L\330\006F\215\342\033R\221\353v<\001\302b\245.\bS\n\033"
+	.string	"\306\bO\237\211\260e|/\331L?\216-\340D%\301$\223tj\311\024\252\304\343\357\037z\315\006\007\241\257f\033$\f\307J\305\bKf\346\232F\257\342u\013\322\313\007\t\nV\022\0253\b\2319b\245\213\336\372\023\374\005\277E\007"
+	.ascii	"2\003\316:#f\b\3055q_\b\022\356\262\251\235d"
+	.text
+	.section	.gnu.lto_getMotorMixRange.129.c147c3c9643dffd4,"e",@progbits
+	.string	"(\265/\375 \367\305\006"
+	.string	"\022\215/4Pm\222\016$\307\223\202\204\252J\357\326\246\257)\3466>8V\036\177\261l\355M\005V\301\035\026\315\260\343f\211)b\005\267p{\252\332\235\273m\244\021\"Sk2\326\346\201\342\304\216B\002\265\200\020\031\250\003N\324X\0161#p\325\260\261b\247\252\254h\311\262/\344\036\346\363\"\276\037\315\326\256h\210G\256X\341}4\025\272\007P\361q\333g\036\367.\276R\276\320\327\355\336\345\204\304`\313\234\330Rr\004\212h\374\327[.G;\256\327\244,C\324\022\023\t\020\224\314\214\230\006L\205R/S\341\303\350Uw\335zT\332\320B0\220\247\256R\220\231;\fD\321_\377\201\237\340\267\b\b"
+	.ascii	"2\003\346:\203i\b\3055q7\002k!2qWL\355$\003"
+	.text
+	.section	.gnu.lto_areMotorsRunning.130.c147c3c9643dffd4,"e",@progbits
+	.string	"(\265/\375`\f\001\215\r"
+	.string	"\326\031]D"
+	.string	"\221(\035\240\023\376\336\360\341\235\225\317L\223\214\306\322Q\351\274\350\017\215\252=\323\251y\t\030\200\354\276n\031\030\301\260g\220\027\313\003\350\252\026\321\016\365\367]e\030u\003\206R\200\327\257\261\311'{K\231RI"
+	.string	"F"
+	.string	"I"
+	.ascii	"\363\364\301\222\221\362\270t\001\354\322\037\007B\366\036v8"
+	.ascii	"\235eGi\0053g\250\355\212\247\336\343\252\347g@\342\b\027,L\237"
+	.ascii	"\350"
+	.string	"\021\323\360\r\360\215b6\347<x=\371H\252\031\2209\247\325\364e\270\345m/\260\255\300\276\027\266\252\345Uw\334\247nU\3653\006j\244l`\211\331\030\341<\265b&\f\251\002\304U\177\352j\337>\t\277\305\232\227x\030\272\312.\031)\234\337\203\026(f\002\3542\373\200\3532^\300\365\220\017Z\363\224\227\211\302%\226z<\356\211\215\251]\341\2437\351\356\212\216\340\345\205\207]\2247\227\334\203\307^L\320 \251\016\377\233\353+\327ZB\031\375\304W$\376\007[(\321\233.\375\222\345\254\300\244\200(&\332\262C\221.\312\306J\304\n\257J\333G<\233\307C\342\340\323q \256\003\300!\234N\344\302\326\321@\022F\266\t\0214\317\006\241\243\205t\037\215C\300\034\005\221N\003q\\\247i\302\371U\361\3017\230\321*\261\364\367.\307\325]/\216\020\034r\3340\331\221K\\\224\337r\006)0\004\026"
+	.ascii	"r\b\370U\323\240\006\226\342r\016\254\336\025\201\0232\343\032"
+	.ascii	"\215\220b\202r\315\020\204\b\200\212}\013\007\200\tX\255>\214"
+	.ascii	"\205D\021\035*\242p\227\0305\344P\223\267\253\224\001"
+	.text
+	.section	.gnu.lto_mixerIsTricopter.131.c147c3c9643dffd4,"e",@progbits
+	.string	"(\265/\375`\034"
+	.string	"]\007"
+	.string	"\342\31514`m\322\001@\203"
+	.string	"\347q\003\261\303\254fp\267w\020\301\203v6\035X\263\350X\247jWC\030\n\336Z\004\r2\206\f\277\305\257\220F\301O$\233H\231R\276X \246\242\312<\315\203C\005\321\360\"*\206\314\273\300\211g!\260%\201\201OcY\360Qq/\255\216T\013>\nr\352U\365\330\305@\376\233\311\351\365\230\006\272\310G6\276\207)8\371\354\316\347LwN\0030>\271\331\321\223\252a_Z\035\331\231vNk\372\223\200\226\262\260\355\206\266\225Eq\332\207\355\216M\031!\241\343\353\221#\364\216\f\254De7>\335\370\365\274\374\207\334\201\234\230d\"\317\023@aw\235\231\310\342\326\3336\260}`\233$\r"
+	.ascii	"2\241\215\037X\307\304\2028p\231L\242\021*\020\327\3045\004\225"
+	.ascii	"\237X\202\345p\315\231\204\371\004"
+	.text
+	.section	.gnu.lto_initEscEndpoints.132.c147c3c9643dffd4,"e",@progbits
+	.string	"(\265/\375`V\002m\022"
+	.string	"6!vG\320\224M:\270\340\200\204'\236\256i\204P+P\300V\013\331k.\227\026X\217K\345\034\030\b\031\255e\321\266\315\032u!z\022I\252C\237I\264I\225\247\035\031\007\177\214\334\215\255\003\2773\326P\031\215\330M\244L)]"
+	.string	"Y"
+	.string	"f"
+	.string	"\022~\230\374A6\361\201\036\243\365\231m)\227\016\312\r\323\213\246\335U\360h\225\324c\312OP\217\334\007\240\036\335\262\207\234\246b_\344\203C\344\264\273\236\246x\353\234f\313\357XJb2\3279\022\327"
+	.string	"2\033.ew\037\364\314\221\3012;\226\335u\306d#\356x\333\rlC\260\323EI6\371d[\303g|\251\335]\340\023}"
+	.ascii	"S=5\250\307\324\222\331\205>T\343\367\270\303L>\366\350\317\240"
+	.ascii	"\036\257\035\017\222\221\022\257\274\3314X*\217"
+	.string	"}nw\327\272cw\237\3351\2469.\255\232\316L\037@\001\035 \024n\273\"nHv)\342`\361\331o\337 Ns9,\234\366\033\256\305\025EN\330n\303\266\013\256\271\206z\214z\031\257\241R9\342\364\004\264\373z\314/:\r\027\277\250\3621\025\314*\037s\002\"@kB]\234\355(\230\204hk\006\267[\021\233\335\027\002N;U\243\233\026\260\274Y\225S\003F7M\251\252\207\341\343\b'I\356\256K\225\307A\376\241R1\f\005\216Ya\201!\370y02(\341\352[9\bidB\232\007,0\004?\001~Ya\251<\254>/\214\201Ym\310\340qX\271|\336\013k\306[9`PF\305\362B\020dy&\264\327\271\325\035_\310\217\217v\372\375\204H\333\276\0315\247E\266\364R\330\223M@\311\266\b\035\221\222\223\323I\236\366$\244\226\036<&\034\355\250\240\303\265T2 \220\002\231"
+	.string	"\311\016\3714X\017\355\331\020\\Q\330\303\206-\027\367\334\300\26151\021P;f\263\341JN\335\222U\362\213\2606\201\037\204\261\t\374 \214\274\263\302 \002\235\021\234\350\307\030\271\244#\245\225\303b\245,\336\206\315\036\317\366\025\347pZ\244\232\216\274\234?`Wl\234\005\332\343\307E\260\301)\303>#\341\266"
+	.ascii	"2y\300\322\345\266\353\351\001"
+	.text
+	.section	.gnu.lto_mixerInitProfile.133.c147c3c9643dffd4,"e",@progbits
+	.string	"(\265/\375`\326\001\035\020"
+	.string	"\026\334cE"
+	.string	"\261&\035_^\013\375\r#\024\214\006?\031%\336=\372q}\3508\322\331\rI\376k\214\320\320K=\335\026\f\303\016\242\310\354\252W\246\353xU\200Z\177G0\232\320;f\276\331g\252\206H\b\331[\312\224\002N"
+	.string	"G"
+	.string	"R"
+	.string	">\210"
+	.string	"\233\031\016h\354n\370v,N\254\201\261}\217K\266\353+\020{\026\213\205\346\265\273\233\272\274\364\b5K~6\362\301u+\217\035\016=\035*\025@\227\001\032\330\335\237xj\350N\231\331\310\356:\271\216\303\215\3356\003\333\b\354T\020/*\330c\352G\314S\\Fetr\202=^3\225+\207\007\317v\036\360Q<\306\236\377b\024\267\362\334\243\357\026\366\230\341p\225x\231\362\263W\247T\225}\270\332b\307\264\026\323YLc1\035a\032jZ3\235\317gqL\237\nq\312\317P\243F\030\251\034U\250g\351\341\007w\001A\333E\211\370\254\267 \361\007\224\347@\330\243*\b\211\035\023\336k\034"
+	.string	"\265kZa\257\304\255\250\272\361\312\335]Q\233`\251\021fj\240R\207\355\320iL\264\335\025\361U`\020i\001\376\204\220@\027B\242-eBI\210\202\204\255B\210D\264}H([\310"
+	.ascii	"\217,\200H[\312hD\332<+\323\341j\213\027\334\340\230\364\024"
+	.ascii	"5}\001yp:\037l\310\254\022|\337N\246\232\022\270I\211H\315\364"
+	.ascii	"#d\304H\345\034\252*j\001\030\227\031\033L\275\006n)\017N'j/"
+	.ascii	" @\002c\210\261=\223\320r\304\270\023*x{c\266\021+k\244\314:"
+	.ascii	"R\205#\202\302Y\004$\223\356\210c\030\200\211o\204e\3102\203"
+	.ascii	"\3079\347\262n\255o3\345m\t Z7\240\033f \300\262+\214\366\020"
+	.ascii	"]#\004ATM\214K\263\341\024\211+\f^z\272\321b\367\364l\326\212"
+	.ascii	"\305\210\260\261\373:Dh~\036\345\232bT\234\336.U\006"
+	.text
+	.section	.gnu.lto_mixerInit.134.c147c3c9643dffd4,"e",@progbits
+	.string	"(\265/\375`H\003\265\027"
+	.string	"6*\224F\300\330*\035\342\261(G\247\231'W8yp;\b\020m/\341\236\203\212\245\345o\206\t\355\200\252A\305\226\255\244\270\335\020Z\2125H\" \232\nY8E\024DA,\373B\377a01\313\337\222\240\275\211\334)\005y"
+	.string	"y"
+	.string	"\200"
+	.ascii	"\323va\233>\245\311\366\245}#?\002{\216\307b\2559\2148\251u\267"
+	.ascii	"\300\b\302\317\002\307\241\237\340\001\320O\303\354\242\357z"
+	.ascii	"\3247\371\325\202~\265\326\325\3628\354$:\301\2250\237\004Aw"
+	.ascii	"\321v\3539\351\306\251\351F\223\023u\253\201\005j\255\347\301"
+	.ascii	"\220`\215/\230\300\350\t\031\324m\006\342\314\370a\273\3562\306"
+	.ascii	"M&%\tB\255\325\322v\243q\207\267\375\302v\003{e\004\n\210@\001"
+	.ascii	"\362II[\207%o\263\034*C$\333\036\357\372K\316\204\307\367a\022"
+	.ascii	"-y[\213~N.G@8br\264w2\2718\373`\255\265zw\330%iUI\372\246$mS"
+	.ascii	"\222N\211\322\250P\272\206$}\242\322\246)]\232\322\342\224\016"
+	.ascii	"Ai\372\334\277\001r\200h\371 T\353\214\021M%\232\276\037_\311"
+	.ascii	"\203Z|\347\2651\026ia\037\311y.\276\263\206%\277\007>\253f\265"
+	.ascii	"\306\254\\po\342\300\374~1"
+	.string	"9\312Zk\317\314@O\033\342<c8\225\fa\255\325\201?\245\304\006\337\307\016\375<\255\230{\224K\331\341\320\241\003\3754-\tWT\306'&d[\032\360\237\334g!\017\356\371\356\321\317\363~`LQ\221\037\370\34144\276\207\031#'\353\025\264\264\327]\372\374\234I\342e&\315X\334pK\373Z\r\001\342\317C\351\206\373\232O&G7\241\373\240\007,\021\256\n\242u\030\274X,Z'V*J\220h\231\030\261B\321\002qb\245\363\332Y1\310\261+\005\353\265R\341r\275V\246]\354`\335\035\272\207U\202\020\305VFRm\027\360\310\026F\307\027\336\356\3018\212\271Y\325\016\270B\023r\332\233\375\020,Ctq\251%\360\303#\211\025\233\335\022\301\275=\262\205\331_\271\315\236\006\004\265\251\235QhF5\213\332\327\322\304\344(\341Z&\204\265\316\034\370YND\241\202\005\013\364\263fSD\304"
+	.string	"\345\036I\250a$\006\225B\306\031\032\221@\n\n\n\323\001p\002\221\271Q\017\021\300ATC\005\315v`|y*y\272\237*Oox_+\031Q\177\335\032\264"
+	.ascii	"\223\005\255\002|h!\305GcQxCl\376Pq\265\362\250r6i8\b\330\006"
+	.ascii	"Hwl\227AQ\360XaPh\372\241\214\267&\024;9\341X\250\232\267\271"
+	.ascii	"E \342%\331\005u#\220\004\244\376A^\\I\203tqxX\n\264\315Y\206"
+	.ascii	"\273\244L~\320\312\261\226_\320g\020\226O\240\254\241Mb\363\037"
+	.ascii	"\222\237^AX\357\272V\213\247\364]\r"
+	.text
+	.section	.gnu.lto_loadLaunchControlMixer.135.c147c3c9643dffd4,"e",@progbits
+	.string	"(\265/\375`\t\002\225\020"
+	.string	"&]kH\340\260*\035\270\207\242es\022\312\313\211xU\250\372\016A4\237S\214\211"
+	.string	"\177 \016\202f\032\t\r/\023\247\310\260\265\267S\007\251\331\321\243v\207\031f\230A\np\020\237\3452\\J\231\367\342 \362\361\t!\233\354\235RV"
+	.string	"R"
+	.string	"Z"
+	.string	"\024\204\303{\344\375\315\323\301\257zt\236\374\227\027\260Q\262F\324A\017li\321\370\030W<\021.G\207\223\237,\243j~\036$\\\257\034\356y 9\036n|\214\030<\320\353f\303g\\Mz\362!\267\2225\272>\301\005\273\353\311\0325\334\341m\267l\207\330\223A2(\205\331$j\212p*#L]l\317g\367\374\364=@:9\243\335n\206\335\216\305\2512\">\273\375\023>\351\317Q\\v\372\314\266\020\325\n\313\230\230\316\356\212\274\032A\370J\340\001\276W\357"
+	.ascii	"\276\327\177|\262q\234\214\355c^++r\273+\006\271\\j\356b\324"
+	.ascii	"`|\\5%r7\361\2026\303\2430\273f{\0328-\321nVs\3076\205\273p\r"
+	.ascii	"$\266\273\nZ\230\006\274\2628\365|\260\351d\245)\004cb\243\\"
+	.ascii	"\205I@\215\335\025\371)N\253\340\207x\365\205\224y\326\253\237"
+	.ascii	"B\376\200\016\032\235Lj\356h\331\242\013\243{$T\"\2610*\021O"
+	.ascii	" <\030Ep J\0305(\021GJ&b\bd\322\004\222\222xB\"\225\304\017\271"
+	.ascii	"\247./\017mp8)\252\002)\314\240M\365Pz\233\"\237\224\305\266"
+	.ascii	"o\322\313h\267\325\334\271\267\273\373%\370\244\036\212r+U^\252"
+	.ascii	"\271\2333\225t\033\315\fLM, \300\202\241)\333\006q\201\375\356"
+	.ascii	"H\227qR\356\262L8\037Q\004\277\265g\251!\005k\033\217\343`\202"
+	.ascii	"\372NR\f\356\203u\bN\245\206\365'\313Y\006\344\020\026s,[\305"
+	.ascii	"B1\226Cf\032\223\304A\326a\313\223[\335\tkN\332\t\256VN\210\237"
+	.ascii	"\031\0327\334\001\221\206,\3377z\335\316\005\311"
+	.text
+	.section	.gnu.lto_mixerConfigureOutput.136.c147c3c9643dffd4,"e",@progbits
+	.string	"(\265/\375`\303\t53"
+	.string	"ZU\320\022FP\\R:q\360\0344\305\022\b\"\315\211\375\2358C\306S\f\026fb\206Hr\3323\300\203]\367\243\b\030\"FTZ!!DFL"
+	.string	"\244P\3577\004`\024\024\034\250\273\315\221\001\217\236\375\337\b!d\357$\003\031\001\n\001\034\001\3211\035\375/\227\366\321z\350%\271\343\321\026\301\367\262\276\227\276\331\273\354\370Y\303\001\253\270\200ilP\275\367}\217g{\001\360\254\322\211\332\263\353\207\332\263\335;\272\207g\331a\262;\357g\320\367leY`\250\357\373\"3\223\240!\267\201_\317\336D6y"
+	.string	"CBDAF\240\"\361gX$\f\002\335\226]3N\366]\tA-f\325\001\210\215q\202\207\236\\\350\311\211\240\2409qP\223\033\241\007Z\017\320qA\327\001hHpquy"
+	.string	"\211r\247>\275\267\273\031\301DWBX\327\221\377\340&\037\336\352\310\213\326\241\"kvw\373R\003;+\315(X\270\244\244\253\371 \035W\263\b\006\256\356\026\227\335\351\270\276V\247;v\232_\343\201]*D\336\256\021\312\306\232\024\231\3125\177IK\363\265/U\341\372\302\354\312\300\331F\310\351\270\274V\"8K\360V \221\347\"\023kUz\337\367d\307K\346\025\306\256\204\367}\033k1\273\336F\357~]wW\350\006n\005a\354\252f?#g\267\206\315\317\016@\366\377p\"\245\203\205\373N`L\352\265\256\307\367\212\217_\363\262\337gUG\260\0256\315m\243\3159\205t\212\205\373\032\347\347\234\237%D"
+	.ascii	"6\272\211\326(??\353\355*\356iL\240\210\212j\317\032\345aX]\325"
+	.ascii	"\353Rm\377\355g\244\372b\275b\n_k\252=\313*\345\250{V\370\257"
+	.ascii	"\373\354\n\347g\367\235\356(\247t\006\353V`\200\305\335t\351"
+	.ascii	"\233i\351jo%\026w\022\322\221\020\267\321\333\336F\240 \356b"
+	.ascii	"\213\233\350\342\376\001\342\036\002q\013]\334\301\0267\260\305"
+	.ascii	"\355\266\270[\0267{2\357u\305\235W\334x\305}\007G{pZ\360\275"
+	.ascii	"/\220?>\357\034\373&\345\322_\355o\373\311|\355\276[\017\223"
+	.ascii	"d\330\246z\354\020;*\216\263uP\2117\326\375h\177\r\004\236\232"
+	.ascii	"(U\314\325\372c\322\222/3\202\337\\\224\252\343\321f\265\324"
+	.ascii	"9\243a\372i:\224\260\316\230\374\346\002+\333\2629\314\301\374"
+	.ascii	"\223\257\274\362f\323\n\3630_Y\305\230\205\371n\267\320\225'"
+	.ascii	"\227\325\307\n\377\345\236B\301\266~\362\2631{<v\217\307\304"
+	.ascii	"\343\217v`\025nKx\274\202\274\354\341\211\314=ZEM\241\rf*\351"
+	.ascii	"t\302\371P@p\347\207\201\350\256/\230"
+	.string	"\203q{U\341\367\234\352*\355\214\355\005\251H\211\023\314\317\226j\201\231@\026>\351\033\240\036,\347y. \241\335\335\341x0 A\337\027\313I\357w2\254\0338\264\034\332\263\300\243]\336\0263!:90\300\374\354f\213\224{\315k\006\312\313\206k\201\362\363\244\323\377y_U\342\270\r\016\224\221\362\273\360\344\334\\\347Zx.\325\266\331\315W:\247mFf\251s\226y\275\314\335\0349O\004\356\372q^\347\001\n_\013\252=\233\243N\332\262)\346\307\222\332\206\350n\334\304\346+\221\322\351\376\360\271\020\032\262\\qF\337\027\013\302\333\272O\\\356\311u\372\210\262\211\276\357\353\344\346oF\364\305\3166\t\250\031\371k_\020\315b\352\035\365\200J\352\306\324\013d\r\026+\246\\\250@\302\230B\361\002\031EE\003\371`@\307\220!E\205\254\021#\006\025rxf\365\f\326d\257 \227\244\252g\225\257"
+	.ascii	"\344g\273k\204\226r\236\022\035\257\2444\244\224\227r\016\277"
+	.ascii	"9I\371j\335I3\234\244\333\214\032;1\222\244\025,I-I-m\343/l\244"
+	.ascii	"\333\222[\272\314\273L{6"
+	.string	")\177\3141Y\331\236\020Q\006\3535F\003\271\327\241\202\314\224\227yg\3127\223N\277\276\357\373\0061e\0039\3074M\351\2742~\300^D\206\204\211\243R\255\360_\220.\346pH\334\030\225\313\232\224\016(?\273\255)SI\333\\\332I2\274\325m\007\240\357\373B\370\361\224t\347\243)\007\303\340\252fZO\017p\217K\273\223\\p\326S\001e\262\f\n\355\t\366\240\251\276\345\264\255\252\231b~\366p\372s\224\331i\321\361\306\2744\346b\246\360\206\230\213\371Y}\2540\0261'\3219\037\227\246\027\321\230\217\362\243yi\372\250Hv9\332\235Xw\227\300UOH\370\r\200\322\250\2010\304\030C\210hd$IRI\007\200\002\221\251\272n\021p)d\254D$\315\262\033\001\362\207\301\357\3778\024\3729(\021\035\237\255\272\203\270Q\263F>{\3762\273S(\266\013i\034.\331[#\325/D\270"
+	.string	"UZn\321H{\177\030\032\263\025\337j\333(\3053\"\330\360\201\264\235\352\370\017\273\323f\272\315\205\231*\001E\217c\026p7\356)5g\371\002NQ;@e\221N\032\204:\337W\215\260\215ld\350\222\375\254\347\020\"\252\3161o\275\317"
+	.string	"\257\342]_ \035/f\357\317\037\342>=\214\345\234\371\261\321\331\22409P\341\305\344:\313j\365\227\260\033\337B\361Q=\307\222q{6\370S\177\300\2365\243\313Z\261b\261e\250\237\372\231"
+	.string	"\005w\261;+\244\227\343!\016.\222FJ\307\323"
+	.string	"\353`\241\222\316ST\201\n\250\030.\024\242\355\300m(17\236\234\267\245?X\313\005\326E>\247\241@\332~\323\335\311\304L\375@\240\310V\023\324\236H\024<\305$0C\334(\226\r\2274\323Q\223E\022Z|\201e\342!\020\366x\204]\203E\t\256\261\253@c\312\272?,\037\265M\202\210\255\032\001\227\326\024\374r\025\247\343\335i\334y&"
+	.ascii	"\026\017\246\335\005\336`)\363\260\006\300M\204\357\323\261\322"
+	.ascii	"\201\"_\243<\035A\245\353\304\031\005\301\003\001\020\032\270"
+	.ascii	"\304\356\027\310l?5\334\016\267\013\222l\333\357\t\367*\324\351"
+	.ascii	"MN\206\004A\204\0244\244O1\343\354\003y\330\314\021\310k\220"
+	.ascii	"\007\270\177i\216\265dC\360\037"
+	.text
+	.section	.gnu.lto_mixerLoadMix.137.c147c3c9643dffd4,"e",@progbits
+	.string	"(\265/\375`\236\003}\032"
+	.string	"&\361\252I\240\230Q:\020\274\361\332\017@\303x\324\277%\201\203W\007\217\263\2550\324\372j\306\026\226\236`\323\\\351l\370\343\337\006Y\355:\2662\316\235\026^\203W\341u\230:\316\211\333\0078;!\017\230\216\355^\366\t!d\313\235R\226"
+	.string	"\212"
+	.string	"\230"
+	.string	"\265\276\270\201TkmY\001\371\320\300_\304\207\364,\361\241i6\224\227\272z\243*<D\300Z\253kc<\370\340h\362\264\274\351\322N\216b*\244;i>\357\363\307\310\366\033\222\3239I\307\021'l|&\n*\351E\2679\262\344\370\271H\376<EY,\2128\275\350\007\230\370\254\240\013\234v"
+	.string	"\235\367\003:|X\314\220\216&|\234"
+	.string	"\344F\320\031)Q\200p9\333\2449R|\337\373\\\n\302\373\r\311\245\370\034#\324Z={r(n\226\333V\262\r\301\336\0323h\227:s\205\354\317H\271\341\360\006\3310/\037\372Y\337\335.\337\375-\367\335\253\023\335\252O\263\204\323\2519M\322\351q\247\305\235\016\3514\235\323\273\323s\247?\340\301\223\213\0265\254\354\257\254'\202U\352\2220\351\306}?Q\221\201\235\262\346&"
+	.string	"\241|"
+	.string	"\037\304\357\021Y\211\324\361!}G%\240j\2552\017\375\200|8U\266gy \264\017\211\270K\255AJ\220j-[v\221\017]\222\237\366}\374\007\355;+9\025O\360\324D\"\265A D\272\027l\277~\244\006FW\353\216\003\333\024\236\004\013\360T\353\316\f\322\215l\24061\361=\261=\3571\277\036\225]-\\!\217L\013\263\353d\312\\\2658+\211\252\375\216\347dgF\235\326Z+U-\314\206"
+	.string	"\036\335\216\020\330\036^\304G\005t\265V\007>\221\234\231\200'\032\"\304\2071:`m\006=\227\265\273\277\361h\271\223\210\337\271\277\351P\355\367\275S&\340\022\317\225\332\f\356\372LP1\262^\360\226u\331\205\021\344\375z.l\001\260\317d\257\034\230\004\233\030\316\354\003\315*\347\205\341\006\026\232\206\201\354\225\003\263q\341h\250\201q\310\340\272\201Y\260q\321\310f.\006\004\034\353\360\222\271pb1\231KU\326o\020\357dS\217%\265\265\221+\344"
+	.ascii	"=\342\313\2063R2_-n\005\205\327\224Z\226=\317\225\232+<\211\205"
+	.ascii	"\026\023,\006Ij[2v\265\031\374lb%\n7\256\366e\017\005\234\362"
+	.ascii	"\245\0164\rt~\215H\344fV`\237\340\200j\254%w\215\304\245;^\310"
+	.ascii	"\303\025W\033\356\213\336\212\341\343\375|sHE\013\233\270B~E"
+	.ascii	"\250Q$\243\220\204\0022\023\310\004BcZh1P\002!\307\312<\020h"
+	.ascii	"g\233d\031\003\021\344Z\251`t\254-;\222\037m\343\313\b\264\244"
+	.ascii	"l!\226=<e\3610@\353p\345\242aM\264@\216\t\376W\354?\024\262s"
+	.ascii	"&$c\2105-r\003\320\376)\243\362\017FHo\274?\016\370^%Wo)\f\322"
+	.ascii	"\374\234\n\203\240X8\273\n\357j\007\252\221\305C(;\342P\240["
+	.ascii	"Z\340uo\274\024\faj\3543\214\255#\\\271\006\2023\305\340\370"
+	.ascii	"\3528up\230\350\\\327\267\212\006m\274\204\242\002"
+	.text
+	.section	.gnu.lto_mixerResetDisarmedMotors.138.c147c3c9643dffd4,"e",@progbits
+	.string	"(\265/\375`\t\001\375\f"
+	.string	"\246\230XC\020\261$\035\203\313\301n\027\240\211_\345\301\254\245\262\023v\327\333V\360\022\205yO?\271\300\354\266\302\303\326\0325\030\365\237B\353\2259\315\252\252\252\3127|]I\"I\033\203\033\255\332-B\310\336R\246\024C"
+	.string	"E"
+	.string	"E"
+	.ascii	"32v\367\322\016\266\376\342\375R;|\232\232\377r\003\247n\343"
+	.ascii	"B\207\257J"
+	.string	"Qa\261\301Yx\037\235\027\033\036\237(\334(_\210\225\353\3439N8\033\267\362\254\024\354\256s\3432\334\324mg\2669\354\177\004 \254,\366I\244;\237~E\240\306\n\223\024\273\030:\032{\003Q|8\351\366a\374h\317I<F;\3115VH\305*\231``\354n\307\241\021X\207\005\036\200:|\007@\035\336c\315v\361\350ao\032q!Zr\3029\3410\312\316W\333%/\331$\240\305\356~\374\231\233\220\340\273\034z\002\t\311\026C\224\235\375\022\227\261\311w\261\211i\362\333\241o\032}\374\001\0216;\032D\331\251\226RvN\250\266\3301\224\037\235\223\330\r\342\221\205P\300D\256\221\006\f0\007\013\256\007\330\207\310\005\222E\270<\006\030\004!$\273F@\240\354\362\304\275\262\274\334\262\351nD:\202\332\342J\205R\2529\331\361T\024\327P\251\217\221\311\251\2203\376vw\237\023<\225\n\027"
+	.ascii	"1\003\373\334q@\343\224}Yb\326|\210\342<\2042T\212\210\232\003"
+	.ascii	"1\366aZ\202v[\342o\233\030\272\220\301\352\364K\023\201c\034"
+	.ascii	"\276Q\366BU\343\375$\322\271\346\023"
+	.text
+	.section	.gnu.lto_writeMotors.139.c147c3c9643dffd4,"e",@progbits
+	.string	"(\265/\375 \370\305\006"
+	.string	"\022\r05PO\222\016 [\036-\367-\206\020\303\016`\005\023\001\305\304\251Q\264\376h\333~\264\216\261zo\260\356\237\265\331\231YFUc\201\241\030\036\370\316j\237\020\231\002w8\226\207\202\372@P\003\003\345\260"
+	.string	"\037(\205\017\354X\021\220Cp\005\341\261 \250\252,\270\321\262o\224\360\261\205\036\306\223\353I\265k &3\324xQ\232\"qI*=q\271\306J\367\232*}\305\205k\334\275tl\031/{-s/\344\013\220\231\371\033\375+\360\200\261p\311\334\250\241\311Mj)\371\273\031{\231j#Y\226\025\r\225\231\314\204O\244X\035vkR\201(\312\352\002\0202s\027E\034\375\3657\370\017~\220\007"
+	.ascii	"3\001K8\023\350\370\032\272\f\3622\004\270t\213v>\001"
+	.text
+	.section	.gnu.lto_stopMotors.141.c147c3c9643dffd4,"e",@progbits
+	.string	"(\265/\375`\375\001\335\021"
+	.string	"f\342vF\340\360&\035\337DQx\256\200)\214^\325\223u\357\"w\326x\005\340A\274kE\223`\2463,\314\317X{\335yt\016\352\177\327\245"
+	.string	"\303\360\204\031\326\t\316s\030\330\007`\207\224Q\033f\026-!d\023)S\n`"
+	.string	"_"
+	.string	"c"
+	.string	".\3671\227\204\323\362\021&QB=\332.6\3521Qf\331I\177\355\354a\261\031\240\033\273\353\351\007w\327^\267\226\254GM\223\345\367<AS\354\003_\0365.\246\006D"
+	.string	"0F\033Y\222\r=|\322\200\256\324D\334\\\037\036\204\t\366\2017O\256\301\356:?p\303\275\335\366\212m\020;K\002\256T\035\373#;K2k\216\275\245O1\335q\017\2727MG-\235\232>"
+	.string	"\004/fh\bwkf9\366(\016\205x\320o\337\017\272\217\037\032\005\304\362\007\314kA\233\335\ry\t\037\350&~\242\345(\\\324\275\330t!\f\206lwC\036\255\240{\374\270\307\366\250\235\300\326b\237\304\177\002\237ijq\027()\251\324\366\330\251\201\0328\332\356\256\266\340\233r\372\016L0\031\017\256\2349\352}\354\325\205\f\023\260\263\273#\376\212\263\240\340\363<ZE\245\372l\264r\346\324\250\017\257\0211\031\311\31044\212\001Uu4\36522\236\342*\f\363y|\301B\371\317B\333\343\225D\t\007N+g\366+\251\373Dd\205\222!\245\342\261LHIU\220\340\255\244LT\274\223\025\006O\344\200U\026PV\036\213J\265\362P\257\3265\307\021\214\216Z\352r\201d\360\222\315~"
+	.ascii	"\241\347\035\261\242\001\371\327\213T\0364v[\377\210~LN\362\237"
+	.ascii	"\377\363\216\030\207#\030}\211\252\343\023\222r\252H\031\362"
+	.ascii	"Mil\373\244\233:\210\001\223K\356\364\244\001' P\002A(\245\007"
+	.ascii	"b\002\217ud\035[6\rC\324\301\315\002-\323W\236GC>\005\\5\037"
+	.ascii	"\251\234\354\026\347)>\333\020\200\342\202\200\316\007\030\327"
+	.ascii	"\354\246\305\300\335lK\222\233\016\277\017%\211`\266{/m\244F"
+	.ascii	"\334\255\211\2638\260|\332\r\034\303\356Fb\241j\274?\221\316"
+	.ascii	"\205\237"
+	.text
+	.section	.gnu.lto_calculateThrottleAndCurrentMotorEndpoints.149.c147c3c9643dffd4,"e",@progbits
+	.string	"(\265/\375`\302\030=l"
+	.string	"\332\260X'J \016\333\031\003\307\301\021l\030h\344\323\300\231\364\177Y\032\375\f\263\303\177\275\311\241\242\35544\221!\244Z\362\rs'16\352\311H'\247U\360e\377)8\216%J\311\250V\037"
+	.ascii	"\250\233\327\002Xc\302\030\264\264IJ)\005V\002)\002\177\002\255"
+	.ascii	"\363Q\353l\324:\027\3518\023\265\316C\255\263\020\217s\020\217"
+	.ascii	"3\020\217\363\017\217\263\017\323\271\207\351\3342\235y\230\316"
+	.ascii	"L\036\347\035\036g\035\246\363r\307Y\251\343\234d:#w\234]\307"
+	.ascii	"\271\233\332\200\212mkq\331_\203\347\232e\347\270h\220`\342:"
+	.ascii	"\260{L\267_w\230\356\276nkw^7\227\356.\335x\275t\245'\275en\346"
+	.ascii	"\006\344\026\323d\2309\346\313\360\003\227\006\356\020\302\241"
+	.ascii	"\251S\\\004\323\177\314\f\303\327\243\273\3472\241l\212ut\256"
+	.ascii	"\353\246Y6\322\217\257Ncx\356\025%\341\233b\235\342\236\027\356"
+	.ascii	"+3\373\214\364\004urW\252]\002\267\t\255\327'4\0373\273 9\272"
+	.ascii	"oTr\323,T\266\364\336\263\271 iW\352v\330\233\234\232\241\353"
+	.ascii	"\342\265t\331\310\037o\241d^\222\243\273\327Y\344\352\262p-\033"
+	.ascii	"iM\222\202\007rvV\313Fzka&3\343\361\265\3354\327\321\270\221"
+	.ascii	"sb\350\272\356\207F\262\211e;s\327\265\335\263\357\224\034\177"
+	.ascii	"\33417&_\\\027/\004wX6\322\251\211\222\215<\266P\262\221\374"
+	.ascii	"d\206\323xo\2562\256\221,O\321u\335\251\327\240\237-\265AC\024"
+	.ascii	"T\206'\247&\fLKJIHGFEDCBA@?>=-\017sGg\251L\"\217\357On%U\006"
+	.ascii	"\2653\3205'\240\205\265\324\2657\360\265\206\276\216\342#\343"
+	.ascii	"\305\241\272t\206\301\263.sg'\370\323QCu1\260\311\364\323\340"
+	.ascii	"Y\3371Io\311\006\375\307\305\235\256\335DBc\030<#\341\316\231"
+	.ascii	"\334\256\227\224F\350\244\021Dp\244c\007#\310\035\321\265\021"
+	.ascii	"]\234\027U\211\260p\340CX\256\270P\213\331u\320\023\225\264\r"
+	.ascii	"\032\b\256\177\340\336\334\307\312\005\336\243\244\332\251\223"
+	.ascii	"{\023\207JZ]\267l\315s$J\301\315M\017\236\261\035=\264\225\251"
+	.ascii	"\240\347\316\326\234\331vt\3329\022\231q \355\3013\265\243\007"
+	.ascii	"C?9\315\327OsgR\\\347i\251\244\222\202J\361\352\260T\322\246"
+	.ascii	"\255|\231hd\236\214\362\2219\022J\037{\320\226\360\215\371\017"
+	.ascii	"\236\355\035\235\\\327m-\355ehPw%\225\353\272\354R\264\264f\016"
+	.ascii	"\315\354!0\367\0223\021ao\242\206\335B\373\374\317\367\216\367"
+	.ascii	"\371 \326\2625d\215:\022\274\220[\331\265\347\333O\"\327\214"
+	.ascii	"_sz\276\275\300\335-b\333o\276F~y\313\360\362\371BnR\027\242"
+	.ascii	"m<\317|\260?\252\211fQ\362<\257\314#ktA\016\363\373\313\033\210"
+	.ascii	"\275\363\235W\362\316\030\025\341\310\333\f\230\324\371\235W"
+	.ascii	"&F\333\226\257\363M\326(\346\331\016\3720\316\362\373\332\310"
+	.ascii	"\3007\260z'\346Y<\327u\225\375\f!\251|\027\341\203\206\363\f"
+	.ascii	"\301M\277yV\237#<\355\236v\311F*\037\005\233\344S\313t\362\275"
+	.ascii	"\254m\234\234\250S$\231\253XxK\223\337+\f\372\241\031\3730$\362"
+	.ascii	"\271\327\364\nH\210\270p\221'=\024c\030\255\346k\351\272c%\270"
+	.ascii	"\t;\215\f\356+\215d\0325j$\033\211\374\246{\373\260w\256\353"
+	.ascii	"\272G\246\344\220o\276^\036Z\331t3%\375\207<;\331\013\365,s\013"
+	.ascii	"\366\031+\356+|#\207\2674\307\313y\373\252\257\230g\373\237\312"
+	.ascii	"[\311~\007\254m\306|\221\207\334\311m\036I\346\036\fxK\373y\364"
+	.ascii	"\236\270X\303\261\017c\306\203\372S\231\373\263\331l\226?\003"
+	.ascii	"\346\276\353n&mm\356\260\316kn\367\331]\232\301\272\257Y\211"
+	.ascii	"\004I\234\355\327"
+	.string	"\334\325\201\315\315\036\323\314\325a\232\265v\234\207\264\316\r\264\316>Z\347\036\355\327\314\243\2714/\320]\232w4^\263\216\306k\316\321:\343h\235o\264\3166Zg\253\326Y\201\326\271F\353\234@\353L\243u\236\321:\313h\235c\264\3160~\234_\264\316.Z\347\026?\316,Z\347\025;\316U\255\263\212\3269E\353L\325:\037\320:\243h\235\rh\235\013\340q&\240u>\321:\233h\235K\264\316\003\264\316\002\3608\223h\235\003\360q\036\341\343\f@\217\363T\353,\242u\016\321:\203\350q\376\320:{h\235;\264\316\034t\234\245v\23470\2355\264\316QLg\250\036\347\f\255\363S\353\354\324:7\265\316\030Zg\246\326y\211\351\254\324:'\3658#\005`\234\236\332\204\2003?\227<\311\274\245\334+\254\t\2011<\225\223rU\202:\354\245\364\330\004\227\332\375\034_\3463\305\254\225$G"
+	.ascii	"\360\315\344G\274\001\340\213L\335`_w]7\214\251\t\337\f\312Y"
+	.ascii	"j\263fn\005\025\306 *\251\240\006{\364\303\240J\322T\232)5\""
+	.ascii	"\006C\274\210O\202\256]A\240Y\333\022B\260L\210G:\003\002\205"
+	.ascii	"1 \276\310\364L\365U\212\025\272HW(@\037S3t\212b\236\r\203T\346"
+	.ascii	"E<\362\233\212\251\256\351TyA\317\350\251\037\256\037\276\337"
+	.ascii	"i \326\203\027\016\357\341\223\b\325\304t\350\242v\355\300eK"
+	.ascii	"\207G\342\343\220g\345\360E\246[\260/\005$H\213\244\336G\013"
+	.ascii	"_\007\023H\275\357\251 \245g\211\240K\364Tn\253\344\206\0371"
+	.ascii	"\205/\316\312\306I\260\362\273\r\337sS\275\352]\317\023\f*\030"
+	.ascii	"\332\361\032\314\324i\370\3162\315\303\276BO]Jc\223\006E\211"
+	.ascii	"\020\365F\320\367\nE\307\364P\377\2575*8\007Bv\f\"\220\007\215"
+	.ascii	"\330\265VQ\312\233\237\316 \227\241\361)\356\023\245\207bN\377"
+	.ascii	"\364IP\263&,>P3'+peN\1774\207L\223\006T\2766\341\276\246/\362"
+	.ascii	"\316\251\276>Oe\f\317\364\315\201\365\f\320cxd^\324\320\215\n"
+	.ascii	"\323G\360\272P\005\323\263\364\030\360\325\214\373<q\350\227"
+	.ascii	"\336\210\320\311\032%oKz\245?\346E\005\327\244$}\203\360&b\301"
+	.ascii	"T\320\323#\3041\210n\332\2472yv\013<\212\022\b\236hh\311F\366"
+	.ascii	"\331[\210]k\"\245\223\303\363\354\347\223$\3227\025O\363'\317"
+	.ascii	"'P\236Q\242$\033\211\364\375\276\205\325\367\350\317\246G@\351"
+	.ascii	"\241X\321\037}\022a\2233\321,P'R\202\240M\304H\017"
+	.string	"\215(`\223^`\364Gj\246o\3213\231\322\322C_\342Q\276>\335\270\217\373\222\215,\372\"o\032\354\013\230\202\033\013L\242\1778\3266!\234\371\251\301\023\316[J\364J\303\301,\032\350\207\365\237\035\335\333\316S\331\202\245\004zP\340(\237\277\300\2275_\267\210\022]&\351*Q(\202J\260\337\361eC/\364^V3>?\364G/\"\\\214\257K\327uO\260\273\036\366\264\202\345\031\027\227l\244\320\373x\317`\301\004}\207\001\275\317\227\240\357h\226\005\036\3501\270\225\025\2225\376|\273\357\001XB\256\234ZM\035ZZXUAD\210`q\001i6] \361\302r:\257\034\3601\322\234\341\374\352r~\325\240\001\004+K\253\253\353\212\310\253\351\374q\325\202\253\231\345\274\372\342\302r:Sx5\235\315-%'\026\221 Aj<\360\003k\310\017\256\254\255\036#\315\031E\\W*\200\\a\255"
+	.string	"B\302\310Hs\206\322\020!Y/\200\220"
+	.ascii	"\302u\265\265"
+	.ascii	"\325\254\372\341\265\204%\204\353\312\206\363\253\213\013\006"
+	.ascii	"\226\226\323\331\364\032\202D$\007\326V\026\016'\027\226\227"
+	.ascii	"\327\327\217\226\177\210\360\302:\222\2655\345\034\"$K+\310\024"
+	.ascii	"W\326\325\326\324\017/\"S\"\222\270\331\205\3455\345l6\275\246"
+	.ascii	"\230xb}t?\003\356\277n\252\036 \234\r\316\347cS\216\327\361e"
+	.ascii	"\3136\214h\304\036\312=\376\212\231\226\006\362\361=p\274\017"
+	.ascii	"\035\177\343q\274\335\370\326\322\307/j\202\330W\352\251\334"
+	.ascii	"d\272\257\350\205\021\214\352z\037=\277F'\036_\306O=\242f\206"
+	.ascii	"\016\321\306\273=\215\267\361EV+W\253\237\002\265\262Ezhu\301"
+	.ascii	"\024"
+	.string	"\005\336\352\221\214\321\266\032\237\300+\360\035\235ck\326\370\336\302\346\325\372\030\237\300sY7\310J\001c\343\374\266@ML\225\306O\331\030\245\2073>\306\323h\343\3612~\306\0371\306x\030/\343\243\304x\235\367\241\300h\201\250\366\267\341\305\377\2234\027\377bq\250\353]\274\222\031\rO\215z*\277\264\253\036\211\366\227\205b\361\211o\006\306\202\211\267o\362N\300\336\200\025\202\305\001\213\223\\\361,^\251&*\270\327\263\342\221\030;\252\211\025\n2\264U\262\352\273\212\225\315\230/\376\004V-\344\250\372#j\327\252\212O\361]\217\364\022\235\203z\366\311T|\247i>\325\247x\244\304\350\334\211G\361T\357\200\025\2560\212B\213o\006\231i\340[|R\016\324\365\003\276\201g\217\"\242x\003\376\200\357(\nP\261D\024/\002\356-\340O\274\001\004|\001\\O\300\273.\234\370d\232Z_\265\312\231\301^"
+	.string	"c\364\226r}\223\351\242\2756\037p\233\027\312\333\223\211\367\262\n\216\371\342\034\260\254\211\327\211\363\227\246\315\356]\324z\004\246\205\330\267\204\"\240\364\360\332\213<4\346\272bP\003|\t\001>\200\037\200\304\013\360\0355D\364D\006\f\343\277\277d#I\374\024\233\3670N"
+	.string	"\337\177}\\\234\026V\003\201\372\250\2014\005\225B\206fDDAA\222$\215\001\261\005\204 \306\2343n\021\3400\347\234\032\031\021\222\202\024\n\303\001Z\355\2441'\\!\267T\214\273\273\372\377T\260\237\376\326\237\342d\241\336\330\337\030\254B\264LA\016\232\333O\326u\265\214\3259\263\361S\204K<\342\305/\322+D\374]s\325\\\321\315\357\022~\3147\237\265\300^F\245\001\345\243\223\177a\"\021;\214\200R\236\341\220\316/\206[\244\300\352FTg\035x M\341qTK\023Z\3424\314\312\007\306\233\313\323\242N=\033D\271\210\006\200\327K\312/\023\306"
+	.string	"\246\300+c=o\375\f[A'\31756\342\031K\322\345\311\026\347\025\335)\302\276\376N\252\311\007\020\246\276J\007\343\023`\020\037\203\342\257\233\305\fW\374\031\217D\247\256~\234}\3360\313\250\026\310\035Y\221`\031\225\356>\024\370N&\240\020\r8^U\202J\204\323\037\227\323\202=\021\275\225\273\213\243\02768\200\246\007f\013e\375V\304I\353\214\241D*\037\274\305Sv\220\016\007^\302\037\312 \316\f\317y&\206\036aB.g\2030:\323d\276|\003:\030b\bUok\r\n\302:\037\203P,5\336\266\030\002\306\037\314\t\346\226\240\273/\3262Xh\031\033\367\n/\321\b\032\013q\227\301J_\301K\314s\277@\303\260\026\225\264\271v(\342\0379\216\300\264\337g\322\023^~\\\f\245r\224\261\335\375|$P\260\177x\273\302\207~\332\034\266\260\276\025\277\260\371\367\213\267XkQO\260\327"
+	.ascii	"\365\212I\031\203?\320LeX\013.S\200\244\325\360&G \205\006\016"
+	.ascii	"7G\3170\373\246\364\3569}\271\217\271\037\3115\360\242\353\020"
+	.ascii	"N\263\300\324\233\031\340\332.\240\003\32146v\357\016!B\024y"
+	.ascii	"p\321\350\017\t\326!\335\304\221k*A\rc\343Q\354\rok\364b\266"
+	.ascii	"]\224L\357\373\317:\273\020\2666\3652\205\231\263\2417\231\r"
+	.ascii	"\355>\324i\004q\274x\206\367a\312\r0\234f\354\277\3425\210.\347"
+	.ascii	"7\304\210>6\317J\314JS\321\241\255KP\233\326\204\005\023)\233"
+	.ascii	".K\277]\nMw\217a\204\005\300Pl\313\314\373\227\200$V\222\227"
+	.ascii	"\373\310\342\220\243Dh%5\213\353\237\321Q\343\240\216\005\202"
+	.ascii	"Ix%j\214\024\245\341g\273*%wC\323b\370\333-\212\020\034k\344"
+	.ascii	"\311\337\266\341\r\0302[\006\330\2405"
+	.string	"\202\355\331\354\201\250Z`\263\375f\302$m\2518\312\023C\352Z\317\360\326\026\302\361\215\222\343\271\025\342 \342\321\037'<r\341y\351ceot\220RC\313\307lQ\2100(Z\230\234\2269\034\206P\325\206\212!F\031\347\354\260\220\322\356\022\201\230\007(K\250\n%1a@\220\302\3550\277\304\2166\310WN\244<\305v\261\202\233'(9\247\n4\306\230\361v\250\340\217\376^+b\230\2756[\0302t )8^\242\370n^%bH\210\223:8F\253\343#\"\003\267T\003\036Z\207@s\314\251a\201\022\365:\034\204\276\210u\275\003\331Q\270P\324\200W\311\221\274\016\342C\355\213y\t\263\233\"\307\020\252\301\370\030\363\206\375\002\237\002_k\177\244\364Qk\207\216\316MY\030\322\"\320\032\364a'\377\003\301$\016\217^\311\224\221\361\255\231P\354v\f$\036M\216\001\363\337;x,2EP"
+	.ascii	"\025\026\260\2224\tvpMc\212p~#^\217\205.P\332\3108'T"
+	.text
+	.section	.gnu.lto_applyFlipOverAfterCrashModeToMotors.150.c147c3c9643dffd4,"e",@progbits
+	.string	"(\265/\375`Z\023\r["
+	.ascii	"\252\233\030\"M R\322I\007Y\232jUtiQ\227-\210\211\377\366\256"
+	.ascii	"~\270.\376\265\"c\021\341\022\003\f\257nvC\ng\311\242\002\001"
+	.ascii	"\200\240*Y!V\200\365\317\303S\366f\3669\323\265L\227I\364$\242"
+	.ascii	"\273\"\230w\322\345\361j\326\310NR\312\024\002\317\001\033\002"
+	.ascii	"\265\227\247\366\026k\357N\355%\326^\264\366\326\367\276{\273"
+	.ascii	"{\331\202\0379U\226p\225\3014Ur\bD\n\210\216A\201\013\231\323"
+	.ascii	"0\237a\036d\016d~2oa\356\302\274\307\314\307\354\205\031\006"
+	.ascii	"\346/\314`\230\233\314b\230\3110\3671\3731\227a6\303\307]^\263"
+	.ascii	"\3062i\226\3250\241\263\333\242\3032\032&\\\343\3406O\240\023"
+	.ascii	"S<\263\315*v/\360\t\256\221\321\300\355\343\016\342\354\344\366"
+	.ascii	"\030p\215\317m\n\231II\247@\220b\027g\310\205\235\234e\231\013"
+	.ascii	"\267\300.0\223_\340\030X\006\016\3033\360\030\246\201k`\033\370"
+	.ascii	"\006\376[\243\2310te\232M\374l\350\262\2762\205d\216\230\031"
+	.ascii	"#\346\310\037^\363\212\323\020\016\314\323\311\027\3025\030\266"
+	.ascii	"y%\rs\340e\233W\n\303\370\266\t\b\304\2255\206;\366\336bt9R\323"
+	.ascii	"\027\230\316.\n]\212\"\243\254\205\365\310x\313\021N\331\322"
+	.ascii	"\316a\005\2738\3034M\245\030\335\023EF\243\370\310EDF\253\221"
+	.ascii	"lw\207$$i\231\212+_\222\360\371\220\246\251\325KX\332\"W.\274"
+	.ascii	"M'c\247&\246%\245$\244\243\243Q\021\321\220P\020\320\217\217"
+	.ascii	"\261\207\247\270CD\353\237\232l9\217+\234\2266iK\312\330iM^7"
+	.string	"\221\300\226\205\231\352\016\022%s\034\270\246\245^\3211\034\303\202'\364\022\tlx\254\224t\307HXP\350\2439>\316Yi\2439\302*]\264\003C\220\213:\330\311\271\231\302\206\307Dr<d\202\\\013\311\325\250\272\265\270\016\332\2011\205-\n\003\005\256Ey\353\037(\354\363\004J\033\335\270'p\255\255F\245i\352\326<!\246\2609\341\"\007\2565\tQ\267\346\244wD`\2422I\243 p\255#r\200[\003\264\004\255.\275\3751\341?$}6\313\302O\025\205\241\2308\034\270\246W\217J\346\3228\217[m\311Y\367\016\2144M\267\323\226\260\361B\361n\313\330e\257]\241\021\002\306?9m\234\306{\016%he\220\347\304\337x+\036=\317\251\316\024\217\202\257\306w\376\004\247\306i\234\370\2553+O\241n\336>b\326Q\302B\025\244l\0345,LA\250\247x\027\311\325\234V\343\250\017\205Q"
+	.string	"\321^\266\350\267\311M\343\315FIw\326d\270\302\026\270\244\351\2768<|\203\226\246f\"\352\321\263\262\356\254\017\367\257W:\2434\354\377\234$\b\263\355b8_\3054Ec\261\334\003\277I.Wat/\0302\204\310h\237\377\030\215\3236x\247\307\204\203\337\224\177\271\314Wqt\f\237Ne\235\2102\316y\\\f\334S\203\326t\226\331\211\310\227\361\355$M\316x\007n\003\266\\e1\020kN\023#2\312\357\321\206fN\023\263>\334\345r\326_\322\220d\f\333\236\312.\007\362&k\357W\355\365\3423\274]\265\027\b\247\341\345\332B\362\026\336\nj\357\017~\362R\300]x}\360\036o\217\332\313\243\366N\240\265C\0077ys\260\030^\034L\206\367\006\367\361f\261\037\257\r.\303[\203\315\360\322\340B\336\031\335+\243\366\306\250\275X\357\205\361\336\027\2657\201\332\213"
+	.string	"\027\362\272\340A\336\0038\220\267\005\363\361\032\300^x\257\030\006\336\002\370\013/\013\376\302\273\202\301\360\252`0\274)\336K@\367\016P{\005x\257U\367V\325^\252\332;U{\245j/\212\332{\242\366\232\250\275%\272\227D\355\035Q{\003\250\275\"j/"
+	.string	"\2657D\355\215\252\275P\265\367\251\366:\325\336\246\332\313T{\227j\257R\355M\252\275H\357=B{\217\265\327\250\366\026\325^\242\332;T{\205joP\355\005\252\275?\265\327\247\366\032koO\017q"
+	.string	"~02z\204mN\021Jq\240D\\\224\020\347:\267\032\346\350\2518\324\243\376>e\335\331\214\206\262M\252\2704MY\244\365\023\007J\020\246iz\325\326n\017@p\343\006\221Q\2503!\243+\270\325\300\200X\2420)\372r\225=\274\r\t\255\370\006\2558\213\253m\035J\301P\230n\202\020\332\032\224\342*|\374\307+ b\243\274\341\254\017)\370\217\267\250\243\214c\300)8\0032\217\334\031\236\227\036\367\361\337\375\240\244{\272\323{8E\360\222\032\242\177z\023\030e\235\023\031\320"
+	.ascii	"\341t(\270;9D_.QN\037\341\320\251\240e\177y{\177B_n\377\264\037"
+	.ascii	"\323\315\033\020\217c9\313\300\301\372\273\374\251P\203\366\352"
+	.ascii	"M\347q\024u\2247\\1\313\002X\323\324L\004\323\233\356T\207\351"
+	.ascii	"\027\300ai2\320\227K\305t\206\361\321:\361\031\2021\307\r\270"
+	.ascii	"Z\t\246S\317g\307G0\237\037\030\263~u\265#\346s\007\037\2423"
+	.ascii	"\004\243\216\027p5\237\004\216\244|\316\255\270Z\020\323L\020"
+	.ascii	">\b\034\211\371\3243\246\270z\004n\376J\370\371r}z\252\230\331"
+	.ascii	"(\235o<S\fc\202g\025y\330\303\301\306k|\202\263\223y\320\b\316"
+	.ascii	"\311Q\306Y\322z\224\322\223\276t\324\211\3438\256t\023ln\374"
+	.ascii	"\306\223\376u67\250\254k\244\357F\240\203\310i;\036e\374\316"
+	.ascii	"\221^$8\367T\276\035]\307\271\016\214\277\370\321\223\212\306"
+	.ascii	"/\211?mN\020\323S\254\342 \271\235)~q\265\f\210\307\003\251\331"
+	.ascii	"S\263\253\325\034\360\350$\307\023gh{3G\317\254\017y\212\304"
+	.ascii	" \246\363\0034\201\253\031\375j\370\007#2;\304S\331\256T\210"
+	.ascii	"f\342 p\265\"\251\242\177\206B1\025\375\262\205\346z\320\253"
+	.ascii	"\315\335m\021D\337`\357\017\255\351\370 \372m(\3342t\240\347"
+	.ascii	"\020:\372\241O\365\t\375D\326\203\376\304\227u\032\007:\324\236"
+	.ascii	"\2256?\3579\016\237\243\377\371T\035\237\2378c\343\001@\272\304"
+	.ascii	"\222B\220C\302\300l\034\3072(2\226\001\004a`c`C\214I\336\372"
+	.ascii	"\321a`c\\\310\006\202\304\266\260\304\266\260\304\266\260\214"
+	.ascii	" \265\216IHF\220ZGA\270\306\222Y<B\204\200\341(\032Aj\021\371"
+	.ascii	"J\212\355\034\203\214}\021\351\252\001\226\034\343\352\022\342"
+	.ascii	"\325\265\200\230\022X\021\r\030 \222|\240\201 b\3100\256c\327"
+	.ascii	"\027\021$\216\013\270\222c9\200\302\272\214\200e\025I\n\361\342"
+	.ascii	"Y\256\252\260.\r\222C\254\306\202|%\205xY\021I\"\207Xq\205\211"
+	.ascii	"YU--X\221\2560\25310\2600+#\0273>\225<f\016\332\344\001\232\375"
+	.ascii	"\314I\216i\306Q\271')v\341\342\004\fp\002\\\030\340Ni\2706}\271"
+	.ascii	".>\343G{Z\232\002\274\205.\r'\215\007eo\331fQO\005\262<\001\316"
+	.ascii	"k\030}\342\306\346n\214Y\037\376^\374\220,a\372r\215mJ\311\243"
+	.ascii	"rDR\334\342j-nu\005p\250\272Ug\001\273\"VU\343\270\365\3351\020"
+	.ascii	"!\304aa\351\313\355$\257\241>\346\034=\244\257\307\230\342\026"
+	.ascii	"O\236\005Y\0028<\277\030\307\333\3461n\033K\337\221\331\221\335"
+	.ascii	"\221\345\221\345\021\031\355\341\206fN\023%\026\264x\235\247"
+	.ascii	"\223\272\376u\013\004\263<\225t\206O\224\304\200\364\345\022"
+	.ascii	"\3450\215\250\230r\346\216[?2\341"
+	.ascii	"\350\025!\177\300\325\366T\377\231\333s\2425\035)=S\247\372\023"
+	.ascii	"\\\226\247\362m\352R\357z;\225o)\220m\231\272\n\023\200\034\305"
+	.ascii	"\245\266\347\032\205m.WY\254\r\263a\210\214\242h\200\316M\207"
+	.ascii	"\273&\\\007r+\247\362M\005?\340\\g5\314\003w\226w\250\254;;:"
+	.ascii	"\361\255\243N\023/\361\023O:\243\254#q\023O\202\2434D\276\304"
+	.ascii	"\221\340\362\374\224<T\225-=8~\271_D\022\347:\005\332\204\257"
+	.ascii	"8\022g&n\177s\364\376\314bh3\372\022y\264\314"
+	.string	")8\342\"\216|\217 \336\263\200\007\360\021?\037\003\275\334\346T\034\025\007H\020\302\005p\246s\363\273\003\340Q\027\361%8\274A\345\033\213\201v\250q4\004\025b\206\204DD$I\222\264\006q\005\304(\b\341u\003\021\360\240tT\215\210\220\244 i\f\034\346\no%\007'\344P|]h\242\031\217\371\020\303`G\306^\006Jt\235*\230Hp\370g\312\267\023\343%\017y\236\347!I1%\221\301?jOOm\026\341\025\031\034QJ\301\3358\020.m_U\253H\373\027~\224\350\3330]s\001VE\005W\304\235.y\266\244|\211\ni\252/\241\276\253\330i)\335\0172)\240\374&\332}\250\252\210\377c\306ya\304\315\263<\255\210\343N\356\236\2709\3650\267\034\204\276\224\245\320\223\244\005O\274\3348\300m\252\344\367H8t5`\207\331\n\3011Z\003\031\253iV\002%P\3154(\202"
+	.string	"\350`\277O}\254\307\231\b tjN\\ \374+\202\202\371\311W\016\313\310\214\207\240P\"T\210\356\024\2104u\"\241\002\203f\035\202\005\bz\354\232\331\354\302sS\313f\324bg\371\320\264\235\310\357\376\237\032\\\242\336c\375#\031\341\231by\314Qn\007"
+	.string	"\303\304\313\f\347\210\206\350l \216\221\t\226>\036\273\026\232j\361U\0175\245\206\342*\334\360\243N\016\002<\216X\334\240\036\021k\245w\364\316\332\033\243\305~\336i\311\036\361\257\337\270-\205\032i-\273*H\206\347\377\364\343\024\306\364|x\021cS:\302\223iK\320\310\222\f\017\265\343\32270S<'\355\373f\221\021\356\333\250\035\334g\3142\032\201\331\327N\271-\304\367\260\341\f\0312\r\355\313K\r7\225:Z\357\3030\013\370\264\2330\333q]\352w\203\216\305\214E,\256;\343\305\225\315\316H\020\367)\024\342-z\226y\306\007\341o"
+	.string	"`\313\206P\006\343S\270\356\270\341\235EML!\030BA\270C\204\2123\255X\rszp\004\005\035\2233x\330i\0052yv\207\230\357\223\326\tt\354A\212\244\005\340\375Ok\367\203\364}P\335"
+	.string	"\022:\034(K\252\007?2\251@\211X\241\254}A\363^\341F\226\347\025\002y\260cH\345\007%\256*M7\250\036\225\215W\240\205J\366\216Bi\004\022\214\311\250"
+	.ascii	"\333\335\303\235\316\343\216\006\303\201\202O\322\303\t\311E"
+	.ascii	"\212\023F\337~\b\263\201\224>\277C\034e\245pc\304z\020\277\001"
+	.ascii	"\007\030\325\225\206\254\205=\306\214\251\312\213F\016Q\3728"
+	.ascii	"\334\314\317q^\216\024&T\277s7Q3G\306\213w8u>\233\2751\213\265"
+	.ascii	"!\202\377\244\210i\2442\020O\212}P\335\315_Ix\tPW2\030\224\277"
+	.ascii	"\034%\343\375\353\027\003\260\233PdMSE\r$\t\317K \r\352\034\337"
+	.ascii	"\362a%Y\324"
+	.text
+	.section	.gnu.lto_applyMixToMotors.151.c147c3c9643dffd4,"e",@progbits
+	.string	"(\265/\375`\201\t\0355"
+	.string	":_\224\024C`\246N\007s?\334\246\033\217Q\217\322\030\256\332.Z\264\232\302#\215\256\207\027\242\365\270\t\260,\202)\177"
+	.ascii	"\036l\224\343\312\271\372\262\321\007\361\252\310g\026\233\314"
+	.ascii	"1\354\026\207b\230\220\335M\356\235RJ\0019\001\026\001B\001h"
+	.ascii	"l\264\031\2760F\310\0063\334\323\332\0321\355\304\321f\270\306"
+	.ascii	"\222\rH\206\333\255\f\2779\335\240\262<!\3240\334m\334k\315V"
+	.ascii	"\3541,\327W\354\366\016Aevw\367^\006\2352\b\265\323(\024\007"
+	.ascii	"3\260S\024\310\314\356\314`r<1\264s\2375Z\177)v\032;\373\350"
+	.ascii	"^&np\367\2469`\bi\275d;U;\311\266\027\346\265S^\240v\312E\346"
+	.ascii	"=\001t\\.\tep\276\304\b\272\367\016\337\211\021\253\215\2465"
+	.ascii	"\023}\261\217\214\212\220\202DC\300\337\252\372l\212\276\027"
+	.ascii	"\271}T\350\0222j\220I\256>z\"w\304\215\310\272\250\273\310\032"
+	.ascii	"I\256\205uaO\320(5(\036D}:~P\351\2720&Za\357.\256\333\214N\324"
+	.ascii	"D\314H\017\001\307\372\327uaE\234c\276\272\265P\211\330\262U"
+	.ascii	"\037\225\0221e\373P)\246\033 \301\344\027\272\024gI\236\206k"
+	.ascii	"\341\2250\245\333\2720\"h\324\275\367\350i\220FQ\251\2733y\301"
+	.ascii	"\244\016t\351\007\025d\273\265\203%\275\374\273\255O\224\331"
+	.ascii	"\365Q\"f\244\335Gu\357eG&\305\232\223\232\271c03\221YU\006\266"
+	.ascii	"\323\337\267\233;h\352\017\1775R\337\t\220}\177\337[1\307+\306"
+	.ascii	"6"
+	.string	"[\374\246J\341f\247\355\324~\203\025\351\372\251O\277\217Y\320\3466\366\037\375>^1\372\223\205\377\357\223\373*\324\357\337\307\273V\323k\254\270\245\360\225\013o\244\013\333i\177\273u\n7\226g\246\354\362\347\263\251\321\221\374o2\247\031\275+\220\355\335\3613a^\2359\254\316T\252\363\006\r\031Tg\f\027\200\316\026(X\347\t\252\263\204\b\020\0364\230\356a\247uO9\3709K\255\316\t:M\363\001\003]\246\271@\217i\026\256\316Q\326\231\300\352<\340\347\f\265:?\375\234\005\254\316N\253s\223u\016\260:\003\260\316L\253\363\322\352\254d\235\223Vg$\353|\244:\033Y\347\"\353\034\264\316D\326y\310:\003\255\363\317\235W\237\263j\235}\326\331\266s\352sF}\316o\235=u\356\016A(n\311Fc\273\367\307s\320\245K\343\252t\232\3562\335c\372\231[\216\201<\310\314\230q\035l@"
+	.ascii	"\357\364\t~N\337\364\355t\n\360My]\0020=\200?L\n\254\314\361"
+	.ascii	"\302<S\256\337\344\024M|\003V$l\256]\025\253\364T\017\306L\365"
+	.ascii	"\031P\274\345\232Z\235\265;\025\351\227~\300\263\037\377\030"
+	.ascii	"\375\351[z\245o\270ve\220AE\354\344\314\025\370\245\244W\302"
+	.ascii	";K\372\365\350\221\276\217s]w\374V\374\302\316\243\257\261\\"
+	.ascii	"\323\223c\007f\214\375&?\255=\235(\205gZ{\372\370\b_\340\301"
+	.ascii	"\362\264\321k\251\021pf\017\037\274\221F\337v\370<\351\214\317"
+	.ascii	"\225N\370\bO\341\337\314\221\371\344\302g\016!\302\0339\341\237"
+	.ascii	"\216\217^\013\251\222\007\004\375&\023\355\206_\366(\024\307"
+	.ascii	"\217\034<^\276\307\030^\302o\370\376\002\322$\241{\204\265\360"
+	.ascii	"\030\276\277\342\354\364\235\021$Jx#K\330N-|\243io3\005\t\363"
+	.ascii	"\254\350\203\037\341]\317\221I\307D\321+x\002\341\211>8\007\005"
+	.ascii	"\3217\336\330 3\245\222?x\346\024*\274\221\020\336\005\361yC"
+	.ascii	"\347\365\\<\364\276\177\360M\350\310\004\376\357\207\276;\016"
+	.ascii	"\277\255`'\360\333\355\216\222Y4\034~k7v\356\275\023\270\347"
+	.ascii	"`T\265"
+	.string	"\032\262\034\001\374bj\306\213\255\252\254a\fbV\026\321j\213\206\214-\032$\200X=\342\252\006\326\226U\025\360\006\326\b-\342\0261K\265\272\2221#\312\205V\225\312VSZW7\260\262\206[/\\`\301h1\214\201U\2255\264\322\2321\234rb\242\214+\255\341\026\221\2505\004\246u\3653Q\353\336\201'G\327\365\306\243o2\020J\221\203O\241 1\350\003\007>\352{\217\332\234\227\357\371\275\227\313\350\233|\340\035<\223Z[ \002\377\305oK~t@H\274-\356\305o\252\033\243\024\315\b|\313u\272\\\276\351\305u\371\363\213\276\311\335O@\316\270 =\023\356\266\356!k\204\320\210\236>\352\301\030\312J\251ujw\272\241,\324K=\373\227\322\370\234R\304\002\365\255\326\350\334\322\031\374&\257x\2064\374\343q\006-|0\341?\275\007\001\377\364\375UhP\023*V\261R\304\202\305v*"
+	.string	"\235\033\003\244\327\350\275\367\022}\223}\311<\340\205^\262%\347\324\fo\240A\013_\303w[\233PC\203sd\032x/\275\307oE\025\270\005\265^Q\013\027\313\212f\334E3\267F\220d\316\034\346\231\017\375\022|;\327\246\347\300\341/\004\200\277\250A<#\0313\206fDDF\222&\313\001\200\002\021\2622n\021\200\271tE\nR(t\312-=/ B\305\331w}\034]4"
+	.string	"\237\373\303&\376\260n\220Y\013\237\344\323d\236\216"
+	.string	"\334\b\202a8l\207O\317,\b\030n\230b\322%\022\306\254\270\214\344\253\016L'\311\205\271\362Iu\257P\211] \0175sU\222\221\205_S;j\366\3365\013\302\022\332\273\004\216\326\006B\326n\370\232kWJ\220\365\251\244\266\237O\2419N@\245\320\363\331\002\301\276\235\3318\253\"pX@\211"
+	.string	"F\364\034~\331\320Y\201\345\351"
+	.string	"*\352\3324K\347g\230\312+(K\020N\023\312\336aN\032B\013;\312*\313y\257\375\016\351\226+\n+\376\004,>\234\364\310n\265\2327B_\316\030\246\367\207n\t\247r\360F\037'aN\216\374~\324bVDM\001 \224\312|K-\t\017\323\265\364\024\001\226\231\2477\302\023\024\t%=\374\246\202\302\234#`\304\266\214J L \004\246H\005\264\244\030~i\"\233\357\212o\f\315\366T\206\035O\244\332tv\031\3766\356\275lj\312\002\371\216\350N\233c\204<5\364\"'7=.\023T\302\275N\020\f@\277q\203\250\f\203\263pQ\316\300\261\210\327\257"
+	.ascii	"\030.\200J\001]}\006\344H\312\t\225I\236'\356\002\214\26235\201"
+	.ascii	"\375\017"
+	.text
+	.section	.gnu.lto_updateDynLpfCutoffs.154.c147c3c9643dffd4,"e",@progbits
+	.string	"(\265/\375`\342\002\325\026"
+	.string	"\226\352\225G\260\032Q:\270q\003\264H4S\031|\221\"`\220eQ\031\363\353\032\347\020\305\311\177\311\264\346\231\036\366\255\356\034\025\330\337\266r\035\210\346\334Q\370}\341{\216\372L\211\b\366\266\272\217\223mv\300o\004\021B\344N)|"
+	.string	"u"
+	.string	"\206"
+	.string	"\343\3019\332\236;\027)\351\025\331]\006~ \036\364\247}\036\357!\273O\t\227ve,)\262\273c`\005\342\301\324\007\204\007\277\013\b\017Zfg!\220\2633\007:#\035 \\v\227T\032\227\035\374t\312\374\230\232\322\r7;\370\342\337\2272\342\351\234p9\337\001\236\030]F\234m\252\320\347\n\\\316\227\332\335\373\370T\201\253\315\031S\263\273\2367\234\213;\274\355\f\266I\3303L;\264\331\263w\265\251=\366\277\335]+\217m\232F}\350\226y\320=~\367\233\304\351\322}~qN\203\246\351\2574\255sz\212\323\2379\371`\301\235h\312.\213\336\227\345\201Fl|\350\017z\314\f\347g\337~\020_\210\307\241\233\371$\212\016\213\004\361?\276\220\035$\342\353b\237\242\206\256\312\321\356.8\350\032\240\377\300\371\217\033\344\222t\354\356x\320\306\261\003z!\267"
+	.string	"Dd\312\211#\232\301\264\350E\371\264\307\243~\372\002\262\342\033\371\021'\ta$F\022\232\310i\321\355\250\216:\233\004\230SmU\031\376\246\232\262\351\314.z\020\237l\2734\004&\235z\241O\200B\244\350\004\216\332\334\335\231j\217\023\350\334C\210\322\235\025;fHP\234\330\246\027\227\024\245\004\264\350\204\271\212Z\322\377\370\227C\312\221\016F\320\215\332\207\234\250\204_\303\260\325\374m\025\036\2746\310%\351\002\266\241)Y\253\030\331r\261X.U\201\016 \"\264p8\234(p(I\254b\255\r7!P\345\207X\314\365\262\211\211\260\n%kE!\326*_\257\033\025"
+	.ascii	"\253h^\345\210\025\213\214\331xX}\350@\266V\033X\244\352\005"
+	.ascii	"#i\f\330\005\242|\2211\227\353E\216;\332\277U\236\373\370Q m"
+	.ascii	"\341\321\264\006\212\272\344-r_t9\232\222\357\310m\351r\001\306"
+	.ascii	"\20473e\324\306\240a\376\346SA2\342\315\270\362\263\203\320\353"
+	.ascii	"%\201*\243J4*\0305 P\2021c\305\033\326\031!O,\251O3\317^\314"
+	.ascii	"\254\035\247ML\241PA\260\002V&\3366\035\257\027\303\242Mb\341"
+	.ascii	"\356\3322\256\030\226L,%\231\320\n\f\254\016\3461dF\302\214L"
+	.ascii	";b-G\2024\375\330\242\275i\016P\203\313ZH\016\033o>\013\364\314"
+	.ascii	".L\251\232\r\2515b\r\0234$\302V\024\327\275\232\023K\2761\324"
+	.ascii	"\232\345\246\303t\024\020\203a\355\031\227[\n\363\207P\006"
+	.text
+	.section	.gnu.lto_mixTable.155.c147c3c9643dffd4,"e",@progbits
+	.string	"(\265/\375`\003\001}\r"
+	.string	"\006\231]E\360\2226\035x\005\232\244M\211j\345\224f\374\234\245yaJ\312\021\350P\274\2241\232\264-\2168\243O\323\344\223\240\031AS\243a\313\376q\234\253\033\260\232c\316\030Fy\004\355\332\030\004\307.\373\275\211\224)\005G"
+	.string	"G"
+	.string	"J"
+	.ascii	"\262\272\210u\351\317\356\361\261e\022x\271A\221\361c\316\211"
+	.ascii	"\255\212\357\373\252\357\262Z\375\374K\004/?\257J|+\004*8H\004"
+	.ascii	"\020"
+	.string	"M\325'G\n\036\217\271\202\020CU\016h\316i=\211#n\353\266!\330~`\237B.\336\225\353\343\3379\314/+\365=\036|\244\204\020O#5gJ*\310DI\033,l\337c{\325V\260\340\373\310\301;\247\212\016\006\235K_\355\2778\214\3570\035\f`N\024/5\346\034\023\370@\347\322\300?\326\003\327ZQnJ\232j\320bCS\205\250]\242\311\324\234@\205\005\300\033.vYlk\260\276$1v\230\324\306\227\332\033\247?}/Sc\002\025.h\216\312\265I'\372\223\037\363kF\013\021@hL\013\332c\250\3132\3432\023#N\363B\244Qf\262q\016*h\021\274\020I\006\021\322\204l\323$x\243\254\353ND!\026\215t\331\006m\303\274\013%\032\006\013\330H\013m\230\250#a#\003\314\231d\035\346q\\\207y\306\322w\305\006\2256\374\n)@\257\r\211@\037\026tg\003\025"
+	.ascii	"2\003\326\031\235b\320\237'L\205#`\261:\344\002M\023\225\222"
+	.ascii	"\304\325M$\332>X\3502\003\204\261\325\373La\260\0025E\270#-\355"
+	.ascii	"5%\334\224B\355\001"
+	.text
+	.section	.gnu.lto_mixerSetThrottleAngleCorrection.156.c147c3c9643dffd4,"e",@progbits
+	.string	"(\265/\375`("
+	.string	"M\b"
+	.string	"&\020<8Po\322\001\017\333\205\275\352\321\256\027\266\236\273\353\305\032H \375M\237a\204\302\326\304\30071\201\333.!&\251[DU1S0\242\027:\006tu\324>\331d\357\224\002)"
+	.string	"-"
+	.string	"+"
+	.string	"\227\356l\226\243<v\340\024bQ\342\262\2733v\274;\354\374\237\276\361\276\321!\200\302\356\032z\037\306\035o\333\300v\202\355T\246\037^\235\026\223\3570+\273\027\255\230eI\024\020\216\355C\373\"\037\351n\362\312\233\335\215\224\223\335E\360\201\346\262\340\002\330\345\365"
+	.string	",\232\031\031\026)V\030F?u\022\257\374\017SX\005\357]\372Va\227\023\032*/\031$\330\262Q#\0309\354_\273\273\216%\373\001Z\004\350\263 \242\033\227i\265\322\254\343\314S5\211-49\207\206\r\3040E\333'4\263\n1=\004\246\017Z\235\034\245urP\373kc\311\001\b"
+	.ascii	"2\241\213/p\340\002<\230w\t\240YM\001wy\321N2"
+	.text
+	.section	.gnu.lto_mixerGetThrottle.157.c147c3c9643dffd4,"e",@progbits
+	.string	"(\265/\375 \371\325\006"
+	.string	"r\31505@m\223\016ppX\332\230{\345\231I\347\0132\205\312,v,a\313\004\303\243\217\343\025\226\267FY\034#Y\006\026\357x\335\020\273L\260T\360\2707k\t\221)c.WF\242\322\304M\003C\345\260\020\037*\005M\304\\\021\361B\260\005\221\271\342\306\262\256X\331\262\360\363\240\245\003=\337P\267\271\013zb\321k\326\351.\242:=\bp\321y\243\3378\017f|\245\314\314\341\347\373~0\300\244Dk\307eV\214\272$\231D8~\354+\267\243\036\330s\322\266\001*\b\205P\200\234df\264t\200\352$U\200\352\0045\212\365a\267\037M\360t#\231\306\351\243 d\346/\323,:\354o\360\037\374\030\001\007"
+	.ascii	"2\001\0378\203+\016%\256\321Z\210L\334\025S;\311"
+	.text
+	.section	.gnu.lto_getMixerMode.158.c147c3c9643dffd4,"e",@progbits
+	.string	"(\265/\375 \365\305\006"
+	.string	"\362\214/3`m\322\001\300\303\001\020r2&\277~)\332\315\2201\234\213h\247\300\210\265\326[\266\253!\f\005o-"
+	.string	"\330S\004\251o\361k\206\252\327\241\215v\2232\245\326d\336fb\342\270\216C\303\364\300\340 \246\005\216\323<\t\227!0\025\261y\256CQ\317]\256\275\212R1\225\206\354\217~A\337\303\024\236\274\365\346{\244\267T"
+	.string	"\215*3\373\002\245r\330\257\254\212l\247S\003N.\3421\224]\214\f[\223V\362a\373c_|\220\207|\f\025*\252x0\"\261\030I\331\275\034\346\003\322[\345\002\322\233v\034>\241\177\221'\204\260\314\212\240\247\005aw\235V\314\270\365\266\013l\033\330\336\b\b"
+	.ascii	"2\003\316:#h\b\3055\2617\"g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_isFixedWing.159.c147c3c9643dffd4,"e",@progbits
+	.string	"(\265/\375`\351"
+	.string	"\345\013"
+	.string	"\026VO>\020O5\035\204\243l\030\364!\b3\311#\365\004\345\021$~]2\311\336a\304\315\372\223\376q\260\306zl\214\tp?]\214\002"
+	.string	""
+	.string	"\b\321@\205\372r\021b\361\272\237\322\337Z\333[\246\024>"
+	.string	":"
+	.string	"?"
+	.string	"\035\033b\003\007:\346\376}\b\005H\261\260\240r\355~\232\364p\356S*\347w\2377}\2428\314h\301:\341i\270\2540%\273\253\341yT\035\224\335\265\202\274\f7v\333\tl\023\260\217\t\222\217\216\366OGm|\020\226\300\321\203\216\371\234\354\330\345M\327\024ckt\022Q\320\r\373\353T\226\354\317\225$\333jU\365''#\204\301\273\310\332\rm\274v\205\251\ba;\224N\305)K\251;\304\317\025\243SQw\267\223\006\035FZ\"\001*\207\021\030+"
+	.string	"|\223\225\360M8\374\350\032mx|\223\035S\220\375\317v\370\330\355>\262\035\376#\307\325\b\021\333a\013\004\256L6\313\204\013F\3234`pq\260@{pQ\200\321*[\004m2\300\031\b\226M\323d2\233\006\371\366s%\311\b^\200\240\364\271\354\246?^)\027 \n\375\271L\345\005\333*Uz|\022w\030"
+	.string	"f\204\366\337\206\262\265u\003\313:t\001\315\272"
+	.ascii	"\013\264\2533\026\236B\240:\277T+E\001\3428D\272V\0370=([\\\023"
+	.ascii	"\205\260 m\210<\356:\252j@\352\252.+O"
+	.text
+	.section	.gnu.lto_areMotorsRunning.part.0.222.c147c3c9643dffd4,"e",@progbits
+	.string	"(\265/\375`\013\002e\022"
+	.string	"FbwH\340\322&\035\252\002"
+	.string	"@S\351A\225\315\026\346\274\207\301\036B\237z\371\263\305\314\311y\311'\277\276\274\332=jq\2722\036\026c\252\306T\233\032c4\346\214B\004=U\351\341\203\025r\274r/\263\270#m\357-wJ\001d"
+	.string	"]"
+	.string	"b"
+	.string	"`\225A\2058R\234>\235@\373<\n\243HTfP$+\376\016\346\310\\\007\310+\250G\255 \367\271\"\254]\202\267\214\337\247\334H?\377\340e\317\f\03100\226O\021\330\213+\312\bS\242\303W6\210\365\350\210\300Z\344\376\314d|\366\030\003{\211\221\300i\311A\255\325\232\207\273t\333\033l\227\330\021B7\366ewiFS\031=\345F\357F\307\013\335\007p\372 \240\246V\231\244 \325f\032\221\270\354\027z\264\357\013]\205?\363\026\244\342\231\313\374\240\237\003\255|\205c\230\\\300\n\223p\304\2422\320>M/@?\345\007\320\317\3732\025\037\364\346\363\330\347\231\025\337\307\333\247\037\373L,\001\364s\356\001$\032\227\254\265V\251\340_\271?q\024r\250i\031\002qs\264\213\263\017\001\224\303%\376\260\357\342E\016}\036\253\\\344\"\372\271\213"
+	.string	"\211\346-\034j\265\326\022\177\350D\236\317\363i\f\255x\230O\277E?\343~\366(\343\311\251\211\031\271b\222\367{C\307\017Q\\\034/]`\203\306\2167\335S\253n\265\312\020\241\305\362R<U"
+	.ascii	"\233\214\260N4t*.\245B\252\263@\201[u\023T\234\t\253\305\215"
+	.ascii	"\030\260w\341\204\305\245x\036\213\333l\307\357\215\251\216\220"
+	.ascii	"W(\375\217nHI\2570\376\037-\225\366\3405\036&l|\354pm\313\210"
+	.ascii	"\2718\236;\364\364mgcl\233\356\367A\215\271t\377\032\362\027"
+	.ascii	"\207\221\352PP\0020 @\002\202\224\326\016Y22x\325\333I\322\""
+	.ascii	"\231\204\361;\315iq\367\211\264\002 \376m\307(\001v\fmJ\314\320"
+	.ascii	"\200\253\307\340\032S\211\b\020\233U\210\273\304\030\252\205"
+	.ascii	"m\201\271\364C\002\277\267\333\225{\033\2308\030\221\372\320"
+	.ascii	"7\364u.O\026\313\361\253\312x\032\013?\330\246y\341\026\230\205"
+	.ascii	"\266\237\367f\013<h=\356]j\f"
+	.text
+	.section	.gnu.lto_mixTable.part.0.236.c147c3c9643dffd4,"e",@progbits
+	.string	"(\265/\375`:$\255\243"
+	.string	"\n\007\211:H\020\020\345i\215\001\357"
+	.ascii	"i\t\007\372h0XO\f\031\020\035\202\213\206\001x\230\3200\360$"
+	.string	"\260f\271}hOUC\240>@\224\033\b\216^\337mP[X\312\327\235\3574\031\306:\315\2176/$\240\\\305jD\246\224R\240\003L\003\231\003^v\305\213\233\302\236~~q\207^\205\231\r3\025\246:ed\202\334\252\272\220Y\234\371y\213\022\310F\215\363\r\234\003\027s)\373\030'=\352\025\346P\230\257\272\220\215k\002\007\251q.\306\354a\354\321+\177\302%&\251vwH\006y\305\f\326Y\320\350z\321_\346$\027\351BN\202\306\346\255\b\363\262\013\271\350\353\020\033w\2416\304\235\310ID\257#]\310Ov\310\215\032\367\276o\322\220\033\221\223G\372\220\363\310\210\256o\374\334\355\210\004n6^\334v\355\246\3414\bM\247Eh\275\326\323|\372O\003jA-\330\204\234\034\034a\004,Z\220m$\344\325Y,\2770\367N\t\354A\317\316b%\275|\336&s\2033\363\351\034\262\225\216\201"
+	.string	"\271"
+	.ascii	"\271\332\327\256\335\340\302\270)\376\371\371\301\001 \013\210"
+	.ascii	"l\243\037\257\356\303\344\276.\300\263\3730\233\300\346\336)"
+	.ascii	"\321\025\317\\\334\241\036\262\215I\336J\307=||po\366\274\362"
+	.ascii	"0\226/\020\\\233,\034\236;\\w\270\214\324\362\330\255\331\251"
+	.ascii	"\243\204\233\276\352(\3517\3726I\204\363\313\276\357\\\025d\033"
+	.ascii	"\363\274z\316\326\327\364}\247r:\204g\317\331j_\273Vn\314\355"
+	.ascii	"}\247\034 \333\350o/\035\225\216q\260X\3066\025\275\257\035\263"
+	.ascii	"8\375\342y\275a,\022\324\217/\356\260y\327\206\253\rW\277S^\337"
+	.ascii	"\263&\367\227\245Bv\235\027O\351\030\333\0246\367\2129\366\005"
+	.ascii	"\332\211\203j#'\200lc\222[\357+\253h\341\325\037t\365\334+\245"
+	.ascii	"uf\025-\236\375A\027\377\373R\375^ \333\310\356=\347\325j\234"
+	.ascii	"\264s/\331\224\335\231[\256\323<[\215\023.z\3374k\234\367\235"
+	.ascii	";\321F&\201lcS/\035\333\330\266\322\261\215\314\r\307\314^S~"
+	.ascii	"2\007\366\034\333\273\301\252(\306\346\360}_\2516\276\027\017"
+	.ascii	"#\030\331\355\\\363\214\366\3316j\320\230!#\006\214"
+	.string	"\027.Z\260X\241\"\005\n\251\250\023&\240J\220\030!\"\304\023\210\017\036\234\232:p`\332\240!\003\206\013\026*,\271JJ\nIHG\023$$\215\212\220DGc\373~\343\311\355R\262\257\266\2216E\261k\034j\032\207:\261\220\3170\3242\fu\fD\207\221x\350/\006\271\213\304@o\221Hf*\310Y\360\231&\006\362\025\200\255\002P\247\370\003\003\344(\374ZJ\317\353\347Q'\362\354\271\t\300\206\302\323%\360\334q\022\"x\301\372\210.S\354\264\b;\035\242\315\240\327>\355Q\013\004\307\237\360\032D\373d-D\247\371L\361\332\ftO\3004\341\033\377\320\022=\221\322\326|\246nZ\030\205\262r\274L\215{\3502\345\256\235\332t\223\235ki\343\035\356\232C\232fJ#\347\033\342ZC\034\234g\030@c\030\300\2057\253[\030\323\025\342\254q\204\226\210\246\034Ps\023'\0161mJ[\273"
+	.ascii	"\350\264\251\230\343\022\230\2740\354\2246m{%\037ks(a\\9\006"
+	.ascii	"\214S\370\322Im\211,\b\205\315g\372\245]\222\322&mB6GB\353#2"
+	.ascii	"S4>S\252O8k\tZ\242\234y\322)m\212Y\033\265M|\246fY\274\210h*"
+	.ascii	"m\n\226F6\237i\031\225v\"3\305\342DFdW\372\030u217\266%\250z"
+	.ascii	"\036,\355Q\013\364\304[d\225\376#2h\333\364\276o\023\266\217"
+	.ascii	"\221\205\271+\373\006"
+	.string	"\321\324\373\276\334`\213\315S\315\334\242an4f\016v\002_e!t\307\344;Y\027m\301\323f,z\tGT\260'\034\016\336\321\2538\253cM\203m(\0243\276\367\345\033\213\213\201a\357\013\366A\302O\330\241vGO\224\f\224\350\253\307O>{t\020\372Te\320\360\370U6\336i\331\357\260,\370\215y\226i3g\330\267&\354\247\273g\267\303zb{_\260\226>\003\360,\223$\024(\0205n\305\217\031}\321\227Y)@\236\020\372\366\302\274\320\031\247c\254\004?f\023\316\346\211\206\311\357}_\030W'\300\323\312O\270\247\234\267\364)wl\243\321\027\245A~\021\321#\337\230\027\025$z\242>b\212\306?~\343E\263`\276\250\306\3270\227\030\325\264\177<<\243c5~\265\273\216\377]x\375c\306\341q]\310\367}]\260\303e\220\203[\f\005\3076\376\027\245a\177s+\005\334b\270"
+	.ascii	"\003\274\245\006|\213/e`\276\310\337\033<\220{k\243\364\240\031"
+	.ascii	"|Vr\354\377\257@\206W@a^\21058s\002<\274\245\375M\330\335\245"
+	.ascii	"\256\314\0241\013\375/\377*\377\r\030l\205\262\374k\314\0328"
+	.ascii	"\311\240\253I\353\314D\351\274\204\253\r57]\347\255\326YK\311"
+	.ascii	"YI\353\234\344\2023S\3119K\311\031k\311\031\211\322\371\210\322"
+	.ascii	"\031\203%\347\245\221\256k.\342:\023q\235\257\\g+\327\271\312"
+	.ascii	"u\036\342:S\265\316\027(\235-\250\300u\246\300u\236\300\2734"
+	.ascii	"\013q\235%\210 \210\353\f\304u\206\300u~\240\357\232\177\270"
+	.ascii	"\316>\\g\007\\\347\006\\\347\036\2563\003\256\363\002\276\245"
+	.ascii	"\231\207\353\254\200\353\234\200\353\274\303uF\240\347\272\017"
+	.ascii	"p\235\rp\235u\264\316\005(\235\t\310\341:\017\320x\3158:N\363"
+	.ascii	"\324\r\327\331\206\2335\327p\235i\314p\235e\270\3161\\g\030\256"
+	.ascii	"\363\013\327\331\205\353\334\242\310\231E\023j^a\301Y\205\005"
+	.ascii	"\347\024~\245\031\305\222\263\324\222sT\333i>\321:\233Xr\206"
+	.ascii	"r\235K\270\316$\\\347\021\"\\\347\020\255\363\223\322\031\204"
+	.ascii	"\353\374A\351\354\241\202\263\223\353\334\324\327\356\016\034"
+	.ascii	"\226\234\231z\257y\203\353\254\301u\316\340:cp\235/\264\316\026"
+	.ascii	"Z\347\n\256\363\222\333{\232\225\332O\263\262\377\232)\270\316"
+	.ascii	"I\2563\222\353|\324\201\232'\270\316\022\\\347\244\353l\344:"
+	.ascii	"\027\265\316\310\326\231\310u>*9\033)8\267J\347\247\340\354="
+	.ascii	"\330\334]m\325X\221\250\357+e1\361\335b\2243\246\007\273\tu\007"
+	.ascii	"\352\376\353\366\323\275\247{\257\033O\267\235\356\274\3568\335"
+	.ascii	"x\335w\335u\355W\332\315\332\267\264w!cA\025[0\003:&K\2261\310"
+	.ascii	"\257\251kE\213U1\313\214U~\r\300wh\025\223ui\3634\f\263\211y"
+	.ascii	"\241\2120c\333961\311*\366\212\031)\377\302T\355[6\3076\245\373"
+	.ascii	"\260\331\270\3037l\016j\311T\277\301\0230.+\324\244X\321;|\337"
+	.ascii	"9\2516\266\241fbn\366\252\027Nv1\272\016\262\213;T\3634\016B"
+	.ascii	"\365\363F\345\262\005\215\013\215k\217\03197wH+\216\205]\013"
+	.ascii	"'\315<\213gI\224\223\222\245CV\351B\016\322\035\337\024\206\005"
+	.ascii	"\201\357A\325c\315\341\006\374\001\317\3544\344<\364\304\212"
+	.ascii	"\001\317AO\204\262)\327\361\314\317\257'\324[\312Ma\377\305T"
+	.ascii	"t\224\240\326\261\226}(k\022\200\234r<s\310\340Qh\360\314\241"
+	.ascii	"\353q\374\030;9yn94\371\251\037+\340Q|\016=\002\276\200o1\305"
+	.ascii	"\237>Y\327\223\247\230\330\261\215\004\264{T:D\017M\003<w\300"
+	.ascii	"\361\032\374\030\267MS\255\245.\004\305\0167\336\211\211F\361"
+	.ascii	"9\336"
+	.string	"\313\332\307\325oP\224z\343\251M\207\261\256\237k\351\366\0165\017\261\314\t\307\337\370\001\272\017\360\003\273\246\257\362\324\337\370_3h\350\272g\343k\374\215'R\373\373\023%C\343c|\215'\352\363[\234\3612\236\306?!\224\357@\306w\034\025\317\n\343]|\214\327\240\366W\027\245\276x\n\017\343[6c?\366\342;\016\365\rb\213\237\360.\376\017u\360P\030\213\374\r\236V\236e\270\305`\035\333\330\342\245\376\322\250\370\025\317\342;j&\251\031\3171\305\253\370\216\222A\361)\336\2654\020\350_\235\230\"\330\327\325yB\326\201\t\252\275\254[\212\030\b{\033\240:\203'Mt\327\365c\316\364a=\241\016\0048\033\232\374\030sx\260E\246\257\376\327 \303\r\355\342\2173\303\267C\r_e\307`\242[\324\311E\271"
+	.ascii	"\325&~L\352\207\\\243^\351\245\376\361\304\312N|\324#A\367\006"
+	.ascii	"\211e1\361'\276\017\211)\202e\300\360k\334\237\343\202\236\206"
+	.ascii	"\372o\223\002\265&&\367Z\370*\213\250\273\002g\211D\257\325]"
+	.ascii	"isG\274+}@f\255vbX\345\207/Q\342\023\347\234\005^\377\334\t\202"
+	.ascii	"\021j\236\372\362C\025H\274s\320EmW7\177\242\203\207\335~\202"
+	.ascii	"\206K\"\376\303\217x\245\232\233:>\330Z\202|_~\210\277[;z\332"
+	.ascii	"\270\210\354\205\374p\313\226\327\n\347\366n!d/\344@\344\373"
+	.ascii	"~5\265\233\3518\210d{\247NS\357\240\325\232u(\354\202\334Tf'"
+	.ascii	"\304\314^\201.}I\264\235 !\2760WT\003\374`n0\304\213x\027\024"
+	.ascii	"%\363\364!^\203\240h\026\304?\275\2175\262\017z\267(\246x$\245"
+	.ascii	"\352)\365u\327\021\304\017\271\346q(\374$sA \336\2414\t.}\336"
+	.ascii	"\250r\200\034\220\261T\030"
+	.string	"\016\3039\266\361\303\0079\013D,S~\225SH\223\232\276\365\324\301Q\221\030\333n\343\307\234\257=T\361?~\236q\317+>\216m\364\320\347\005\360\361\304\36243;\266\321\351\333\203\263@\n)\320\236\\\274\245M\177a\316\260\f\337\267\362\256P\\\322W\231I\314\272w\304\341'\324Y\251\0236\374\214\256c\207\177A(\360\017\322W\231y\303sh\007\317\374\\\377\320\t\036I\310\360\036%y\3415\374\330\003G\246\037\242\346{J\220\357\033\346\202]\317\363<\253^\236_\276\034\333\310\364\025\234\371\321\360\033t\364\351a\243d\240\023\276\272\364\031$|\225\233\017NN\fkD\344\327\314c\0236\362\020\356M\f[\244|\027\303_x\217b\307\363\274\016\035\316;\266\021\203\205\277P\341-|G\005+\274\021\317\375%2g}\240\177\350\262`\311\257\032\375\032\013\241C\"\275SI+\304\022\025}\322\217\271"
+	.string	"Z\351\377K\320\b\3170J\017\242\016\215\033"
+	.ascii	"\\\016\223\005\233\362i\234\351%=\205V\316\031\235\353\037\272"
+	.ascii	"\242\257\036\037\t\031ld\313H\223\nK*\213\211\205\305\2542\022"
+	.ascii	"\325DK\252H\022%\"I\016H6Y"
+	.string	"b}Si\3318\2200\265\232Y\314\034F\252\262\270\250\220(\361\270Z\262lVQ%\221 a:@\301HUs\331C\331\\b-\025\300\342\362a\265\354\301\204\252\353\310\352\252Yu\325\274\" k\231\304\007\023\252.$&T\021X-{l-\233\340\260\272BBU\265\225\244\305lVQ\351\250`u\205d\bUV\001G\310&TYK\036M\226<\264\230M&V\322\352\252\271\305\205\201\025U\026\227\362\252H\026\225\221\034WH\232M\246\226\221\037WVL,\255%\325R\026s\331\244\332\312\272J\202\305\314a\265\354\321\244\032\262Di\353\201+\254\345\217f\326\225\226\026W\325\004\256\212\322\272j\262\304\222j\032)\262DBD*kI\205%U\245\265%\025\225\201\231I\256\264\244\232L\246\226T\262\247\300\036jc\253}\337\264\033\331\017j|\225\231\227\276\342\273\260\3518\3170\261\275\357\353\034\343\f"
+	.ascii	"\007u\204Y\304\354\223\027l\302\320\241\361U.\002$\203\353\037"
+	.ascii	"P\f\250n2\371\346\222g\262g\311[ \202\022G:\243\371\\\257t}3"
+	.ascii	"h\353\333\020\263\323\312\353a,\022[\236\337\333*\343<s\346\210"
+	.ascii	"\207\261h\030\316\326wb?q\361\363F\225\353\362\016\222\301}X"
+	.ascii	"\263\030\277\306Z\237\344\211\\\365\224\274\226\323\372\"8\341"
+	.ascii	"\276\316\333q\312\251q\256Ysl\243\222?\361%\r\363\223D}\236\363"
+	.ascii	"\312\037\302\317q\262\251s\266isl#\363!@\313\353:\352\031\030"
+	.ascii	"\"\216Y\177Io\2138b}\026\234\3072\3358\361\360\216m\304z\r\320"
+	.ascii	"\346 \226}\2248\300\027\207\270\034\265 \346\271\370*#y\"M/\222"
+	.ascii	"o?E5|a\022\254#\204i\321L\307#\357\347\n\210\2601\370#\317.V"
+	.ascii	"\006m\323\345\304>\3050x-4\254\265\fl\3575\303\342\253\374TG"
+	.ascii	"\b\216\212\"?\241.O\032(#K \236\324\316\020\216\314\316<g\035"
+	.ascii	"o\351\362\333N\021\216o\312\215\210\360\2046"
+	.string	"a\033\325\215\260\0051\033\266\"\305\325;\030\212!O\344\307\023\371\"F+ht\320?tnP\025?\376*\205T\325\373\0335\344\255~\354\307;\230\325_\365\320\330@QP=\220\257J\242\021\223\223\372*\017y \357\257^\004?$\310S\375\021\364\260N\324\rJ\201\215//\n\310\267\340u/\311\0060\312\211_\223\350e\214\216\026\023\337\"\336,fPi&\240.\276\035&\301\221\003\246\304W\031\252M|Xchx%\361UN\202\021Q\301\033\301\204\200j!\027\274\020\013\376\2028\013\236\351\257\254MJ\3353\342\253,\344+\370\n\327A\330(\225\202\257 \025\224\340'x\n\376\361\242w\240\276\350\264CN\360\356\345\220U\016\230s\020\250P\007\"\234\316\326\346\204\3705\t\376\277\f\373$@\343\304\223'\202\017\362\022\274R-p1\352\006=\343\314c\324\0278H*\b\244\f\004\377\300\003\371\016"
+	.string	"\004\217\364\245\f\314\231\235{\234}\336\322\007\336\311\234\266'3\\\243\312=\261\217\027\343\\Z\231'u\340}\374\261\260\201w\240\3073\360\r|G\251l=\276\302\227\005\236\3073\360\335e\201\357,\325\217\002\277\343y\270\361\360\035\357i\277\346\004D~\332\2539\3778\377\234\200\336R'\240S\220s\220\267T\201w.\275\2245t\205\357\211\205653 <\340\370\b<L}\220\037\343\004~\310u\217\352$\224\300W@\355c-\333\361Z\244\202:\034\001B\247\241w\202\346\250\362\350$\222\242\034c\f\315\210\310L\222\024:r\n\020\006\204\211 \307\324\003\022`\2045\215;\203\314\b\211\210H\222\244R\217\326zA"
+	.ascii	"7\004\277\036o\211\025\3678G\021L\2661\311`\222\344c\355\026"
+	.ascii	"\361\343\346\211\267\033\341a\315RC\t/\206\252L\220\274\224\\"
+	.ascii	"\274\2251\256\332\325z{uz\206Y\031\333\243\304W_\0315EsA\221"
+	.ascii	"\340\013,\300\007z\020^\312\3541\262\241A\336\r\034l\211\222"
+	.ascii	"\224\252<6\371\317\024\205B\301f \240\225@\367i@\377\022n\355"
+	.ascii	"\205 \177\256\213\352\216\304n\335\317*N\3300\b\022o\\\233zH"
+	.ascii	"\221\347\355\264\333\3412O\332\220\252\221 \036}\33588M3+9'\332"
+	.ascii	"\016\222\353\001P\266\347\226\334A\307\004K\340\242?\275\307"
+	.ascii	"\263\261\254\212\263\273\376h\230i\257\364\240\217\223\031\274"
+	.ascii	"A\307;\032"
+	.string	"\215i\266\252\251^\210\273\304\"l\224\311O&\243\020i\275\322tM\0033\300\231\217\356\002E\343\323g\311\313I\362\315\242\270\177\037wJ\250:G\332xy\301]u\005\223\316=\234\t&A\205k\026\2702\351\322$RT/\355L\322\25742\243"
+	.string	"\203\322\233\263-]\032x\034N\335$\037Oy\272\343\021\354\2379\031\337\005\231\241K$\002\340T`\270\277\002\2427T\230\271\261|iX\251\316\210\344\256b\034dF\245+\3636@,b\266H\032S\247\230\007#\n\242\215\003\243\273V\177}\351`"
+	.ascii	"\023\227\0074"
+	.string	"\r5\2211\332\f\tEH2\226@D\220P\255\231\364\344\377\270\331\242\340\311\234\322\371FhIR\365\346=~\375\251\b\317\0032R\2237'J\301\032u0\206\275\365\023n]\177\027@\354\360\026\212R\341\016\274\372\200\306\332\332\273\345\022Rd\004z\372\215\243#\372%\321\316n\277i\n\340\362\266\0357\207\006p\177\311\246q\334\252J\336\211^x\230\021\3105\224\274\364\036\302\262K\022\363\006Y\013\r:\347\3404\036$`PF\355\2403bd'8\324\276\004\347GG7\n\377X(\306o\311f\017(!\213\";\365\331\317[\310\361\005sp\261\347\340\221-X\332\317,\253K\035y\300@\363\260g\257\300V\026\324H\307\36684]\270\362\002Rz\337\225L\327\210w\332>\237\273\310\326\327xn\0326P\212q\314\364I\230\362\212[r\t=I\273N(\315\235\fP\264\311}\273\276F\247%\225\275"
+	.string	"\361S\020`\374\334\\5\374V\005\212\"\272+C\235\265\261 {\235[\264\345#\226H\303\212\272l\276\024\232\324Y\001\347\301c\224@ \2553\230\366\rP\342_\001\220F\201\321\243\325\247\277\212\303\024\007`\310\376\216\020\240\3321\223\223'\270K\216\013\346\220\032\332\"\370\327\210Q\370h\250|\272Q\375\270S\tGQ"
+	.ascii	"\245\177H?\001aB\005(\241\345\2279\276\0348\tp\377\316-\372C"
+	.ascii	"$FF\233\234\316\256\203l\301\335A\350MJ\212\022^u:\352\272\034"
+	.ascii	"\327(D\356uJ\t\t!(\302m\033\027\026\202\240\2449*\332\360j\345"
+	.ascii	"\037\212R\371^\0314\327\244\033\3338\317u\003\300\242x\202$\374"
+	.ascii	"\212\334\353#\022\310h\366\017jP5.E\021~cz>\377\034\355\357\377"
+	.ascii	"\262\327\215\"\302\316\241\222=\250J~x\243-\212\351b(?*0Dm/\234"
+	.ascii	"\372H\260\231- \365\327Q,t\273M\313\360.)\341\316G.Q\333Y\021"
+	.ascii	"1\t\207cg\315i\246Nsh\252%\2266\\\316\302?\371;\030X\032\324"
+	.ascii	"eQ\251\321Z\276I\002;\324\273Z\245f\323\314R\032\246\335\024"
+	.ascii	"\277\n\301\367FW\342\227!\"*\226\224\005x+\024\033s\370v[\003"
+	.ascii	"\251\257b,q~\234\343\02763V\254\303\336eL\305\312$\350\003\023"
+	.ascii	"~ \217.\363V\207\222\t\375\301\265\201:+\026\225\324\224^\335"
+	.ascii	"E\312r\003\0232\007\353!\020\330\350\356\276\257\332"
+	.string	"x\254+\007\025\365=\215\270\202\373e&a\224\260,i\t\367\344`*\021j\204'\345\373M\003\367_\t\261H,\250r\312l\267\"\220\204\246Nm\310\275\033{G\225\t<\037\335<\267\335\177T\177Ux\323\003\034\230\344\277\247\3419\213\205\244\313\363@\363\005\0134P\2652U\027\321\001C\001X\336U\270\302\002)t\260\333)\324D\362x\026\240\205Q #pW\302~\266\020\236\211A`l}\030\027\"`\001\374h\n\300\033O\024\234H\370\361\335\360#\030\bs~&`\354\267\3061\036\240\235 \276\270\370\343L\304u!Bk(oc\022\232\346\023\300\301m\330\036\032L\257!\260.\305\n\211\007\036\024\b\001\374~\270\032\023:n&\2209\005\266\352\203\r\310\366|\364\323\217w\013!\370,k]\007m*\023`9\236sa\316\225\2221\334\354mk\336\021\3068\261q<\"\201\204\306\002\\/~"
+	.ascii	"\345\301}\213\244\300\324\362H\371\311##\310%\374\344\311\270"
+	.ascii	"\271\313<w\221G2\256\001Eq\203\217\231\233\206\024\020Xz&\031"
+	.ascii	"\330\274\307\200\030>j>\301\003\365\026{\020S[\3629\273\n\037"
+	.ascii	"Fe\023\303\265\260\205\223\f\\\225\236\204\332)J\246-\272\222"
+	.ascii	"\016\260J\333)\245\371\205 \270\022\007\341\271z^\357%\244\334"
+	.ascii	"\265@\245\232\213\016\320\266\223\177B<ZC\240l\027\004\351\267"
+	.ascii	"P\314\246\003\377J\221\027\207\332W\026b\216&\026\320\221\273"
+	.ascii	"&\022\237\241\372\334u\026\236\355[5 G\237\031v\031\361\354y"
+	.ascii	"c\360|\271\274\226\303l\370p"
+	.text
+	.section	.gnu.lto_.symbol_nodes.c147c3c9643dffd4,"e",@progbits
+	.string	"(\265/\375`D\t\375\037"
+	.string	"\006\366\2759@\254Ic]S\333\203T\3132\306\303\0312NM\331\264Z8\315Ke(\254\035\b)Q\017\006J\03133\34347\034X\315p\032\264\003Z\355\303%\360\177\333\326r\247\024\255"
+	.string	"\261"
+	.string	"\247"
+	.string	"\226b\234\355\204q3\347\213{<35\032U\tv\221\330\\\334\323\231.\266p\245,\344\237\036\213{.\346\212\007:m\252\342\177"
+	.ascii	"\244i\232\246\270\377b\242p\335\tO:]|`J\f<\312\204\355JX\221"
+	.ascii	"\347\306\022\231\221\270O3G<y\332T\204K\205x\034\210\363\371"
+	.ascii	"\340\245\007\237\352`S\247M9x=]\\`\277\006\376\333\360,\032\216"
+	.ascii	"'\303\3170|\313\205\223Y\270\231\003\223\252\360\262\323E\324"
+	.ascii	"\242(\374\216\326\373\234\326\276\232f\375m\302\t\t%\274\314"
+	.ascii	"i\033\230\032\215\351\233}mCd\267\313\345r\211u\217f\332\016"
+	.ascii	"\240!\216\316\213\031\322i3\361\372\"\002\351\342\362\312\321"
+	.ascii	"u\004\202\257\206=\314\222T\207\222\342OF\363\025\315\351\251"
+	.ascii	"\367\256\365\242\330\023\024wz\342;'\336\324\304\240\230\030"
+	.ascii	"o\211\363\224X\023\230/%q\246/c:\211\367d\274\356\307\230H\356"
+	.ascii	"\305\034\271\017\263\210m\021\233\221{0E\356\261\230D\356\255"
+	.ascii	"\f\271\257b\n\271\247b\006q\337\t\304\217\316\037\367S\366\304"
+	.ascii	"\334t\335\217\231>\356\305\270~<{\334\207\231\n\276v\362\270"
+	.ascii	"Ww\334Kq\236\034\235\271\255{\243\216\373\242iL\341r\334\247"
+	.ascii	"&\216\333\271\361:6LW\343Z\206\217C\343of\234\215\f\007\312\340"
+	.ascii	"je\201\253\022x\274\001\272Fj\276de\233\254\367]\0274\244'\331"
+	.ascii	"\202\035\351l}\254\017\206\321\245\246d[\265\336sy\354 ]g\013"
+	.ascii	"T\377J\266W\267\266\263=s\237\346x\217f\355\376\214\332\275\232"
+	.ascii	"\231\3739e\356\345\220\271\2073\346\336\215\230{\2670\367m\300"
+	.ascii	"\334\257\371r\337\346\345^M\227\373B\\\356\r\245\335\037B\273"
+	.ascii	"\007tv/h\313\375 \263{e\331\275\034\331\275\037-\367t\262\334"
+	.ascii	"\303a\271G^\271\317c\345^\317m\233i\232\332\b^\345~\317\251x"
+	.ascii	"n\212\031\235\366\326\327V\217/.\342\230\003~\362Y\310?=\324"
+	.ascii	"I{\343\017\024!\301Y9i=\3249i\023\330I\013\\E9\316\002\225~\216"
+	.ascii	"\263W~\346\203\374\323C\344>-\313\001K\313\002U\207\302\262W"
+	.ascii	"S\020\301^\341\2416\230\207Z\002\307W\t\372\303\343N\250E\240"
+	.ascii	"zB-Q\017\265D;!j\301\216{\250Ur|\2016kr\374\t\265N"
+	.string	"V>%(\324\276muS/\340\215\257\315v\250}\235\344'\310\2651\032\2426\270n\032\332\240\372\247\271\365\235\371nh\251\224\267\177\032\205\225\231\323\320R\0351\t-\225z\233\"[\256\316$\264W\276hMB[\200\200\322\222\225\255:\016\b\200\237\2501\f\202t!\005II\nR\351\360\002!\242i:\021\200 \350\221\021\021\211DDh\222\036?\177>\305\347\347\0300\243\312\034\213v\346K'y\006\322\316\314\222\317)\221\342P\350J&\264{<\357,']\371\377\333\262\352\347\304\373\200\207\\v\215\315\272\302\330\312\367Wk\224\277>\220\227KRQhY\250\212\"KEU\022\251*Z\022T\324\201(\377w\307\"\016#q\374\271\257\001\266\306ev/\013\216\037&\336\027\3312\234\275\343\257q\231\302\375\273\261\033\377s\303\025\3155\344%\304B\3746\0273cK\350OK\017\032\262xkqAc"
+	.ascii	"\3346\236\314\265G\ba{\357\314;I\345\271\002\001K\032\235qA\345"
+	.ascii	"2\030\364\342\375a\226\253,TW\210\340\247\261\001\373,\026\230"
+	.ascii	"X{wPk\257\234T\342ZG\343\302\tP\350#\345)\230\036\367\364V\356"
+	.ascii	"|{t\375<g\335\034\032\037\026]p\252"
+	.text
+	.section	.gnu.lto_.refs.c147c3c9643dffd4,"e",@progbits
+	.string	"(\265/\375`8\003u\026"
+	.string	"\3267\231E\300\3308\303\001\210|\023^\225\221\003\\\353\2549&\225A\020\004\001\202\030\234\315w_\367\375\357*\212\242(\212\"b\212\242(py5\232\254\230\221\365\354?\374\274\321\177j\326@d\030\372\251\211\210d\244m\231\002\202"
+	.string	"\204"
+	.string	"\212"
+	.string	"\277\024\317\377\344\363;i\302DI\022$G\214\204\376\"\\\237\b\350\037\"$\310\247\377#\374}\200}\036_\177\207\327\337\351~\035\256\237\263\3757\264\277F\366\323\020\3733d\204\375\030\237.!\374\b`\217}\035\346\365\233\320C\340\272\r\350\033x\276F\354\013\262N\343\371\004a\177}\372\201\360]`/\277\336\362:\253\373\025\327g\266\037\340\371\030\355G\363C\363\303\371\237\366\\\326\267\371Y\177\235\327j\002o\344O\323\027\365L6\354\324oP\377\240\317\200|\232Soq\277\362\036e\372\223\367\"\325\303|\017\002\037\f/ \016\"\320\305T\357R_\002\017\320~J\024((\362_r\352'1}\340\277C\372s\224~\033\245\322\253H\257\221\276]"
+	.ascii	"\350\256\020{S\210_\024a\357\t\260\327\304\327[\202\353%\021"
+	.ascii	"\340;\002\300W\204\327\033\"\364\005\261}?t\220\351\335\020\363"
+	.ascii	"\177\3312\372\261\210\376+\343o\245\312\024\230-{\343Yf\354\343"
+	.ascii	"\250\2136\377\021\365\217\365\336\3303\325WU\b\335\342\330\277"
+	.ascii	"Q\337l\336#\352\223\365\035\373`\333\003\320\273n\336\201\346"
+	.ascii	"\235i\336\205\346\3356\357\034\314\313\272AwU\327\224A\357\353"
+	.ascii	"\005\275\344\nza\220\337\027\247^\027-\346\227\005\315WE\202"
+	.ascii	"\357\211z\340"
+	.string	"\340\345\325\357\202\240\317e\213\226,WD\327O\345\300\374)\256(\242H\212\035&\366\227\370.\003\250\326\217\255\337\312\371V\232\177Z\317\261>c\275Z\005_d~d\222\246\206l\"363L\f\275\320\213`\013\2750\255\320\277\323\234#_;Q\320\356iN\350\023\325kZ\302\364p\2160\0272\0172\0072\3771\3671\317\3511\3471\3371\337\231\353\314s\346:\3469\3468\3467\3466\3465&\216h\027\252\0330\375\252\3543e/P~\252\364\251\262\243\3107\225\272\f\316\307\220]D\366\021\347E\262\207\344\203\261\007K\335\213\375T}\311\302F{\312\256\225}\226\337\322\007, p\242\251\251{)pB\214a|\026\256&\342\245\240\321\b<f@\330\206\301`4\205\240+\\:\0304\304,.\037\330\254\360\260\"\\\025H0\327gk[\026\370\345\273\035\347\364\036x!\004\201c\204+\035\314\223"
+	.ascii	"\312\335#B\341\311c\367\307\225\030k\034\203\025\2628\202y\b"
+	.ascii	"uc\377\342\"q\300\001 \250R"
+	.text
+	.section	.gnu.lto_.decls.c147c3c9643dffd4,"e",@progbits
+	.ascii	"(\265/\375`HzE\363\001**+\262U Ja:\215\001\3041\360\207\236L"
+	.ascii	"\315G\035C\341\235\361\247\202{\343\351b\035\203\313\272s\342"
+	.ascii	";j\205\362\321\324\367\317\027on5D\252\306\260\255i\333\272\256"
+	.ascii	"\353\256\3469\255\347\031\375\267h\333\246\035\342\301\351:I"
+	.ascii	"\222$\323\243\321\227\375m\223{o\271\245L\001\275\t8\013\217"
+	.ascii	"\013\027\302\322\017\312\243\037\344F?\350\213~\220\230~\320"
+	.ascii	"\227~\220\r}\fy\372\030\344\350\247\335\242\363\030\312\350c"
+	.ascii	"\300\242\217\301\250\217!K\037\bO\037\b\216>\020\027}\240(\372"
+	.ascii	"@^\372@5\364_\346\300X.\334-c\227\354(\303\371\272Az\231\243"
+	.ascii	"L#\003c\017\316\007\232\322\377\341\243\377V\247\377\223F\377"
+	.ascii	"\007\251\377sD\377\307K\377\345\024\214;\246\244\301\001\f_8"
+	.ascii	"\262\334p.e\2243^\322(\251J\032\"t\355\rU\322\030\332\2637\324"
+	.ascii	"\320\275\027\334{A\236\022d\t\2273\377gK_*H/\247\206\340\320"
+	.ascii	"\354(\301\371?X\272w\213\316\377H\351\367\350\364\223\267\350"
+	.ascii	"|\317\215~\317\214~\257L\277\347D\277\347\245\337\313\322\357"
+	.ascii	"A\351\353:}\355\246\257\267\350\037\337\341\231\202b\265q\306"
+	.ascii	"v\360\235\213\304xp\231\214\245k#\367>\006\235c\226\210\261\202"
+	.ascii	"\363/\210s(///\357\202\250C\327k3w#\006\035;\001\210IB\304\356"
+	.ascii	"\277fx\316\321\3168\036^\210\340\214\3675J\326\235Y\363\221\206"
+	.ascii	"s\335\217\325\3405\230\016wu\370\241\253\022\227\206\363\334"
+	.ascii	"Q\251FGK\036\234\257\305\364I\304Q\375\030\016~\203\345\260\234"
+	.ascii	"\213\304qp\233|\334\333\013\033\033\031gn\216&$E\264gD\3210\356"
+	.ascii	"\275q\034\fw\264\373f\266_\\\371\200\211q{p\344\201\007\036`"
+	.ascii	"6\036m4~\362u\230\276>\242\257\275\364\365\226\276\326\241\365"
+	.ascii	"\276F\347\335oj(\0252A\314\334\332\266\342\314\301\302\371?N"
+	.ascii	"\203\331\360\032Fs\221\270\r\2339>s\331~\217{#\301\034IC\222"
+	.ascii	"\034!\fV\323\340IW\336\335]\033.\263\237\346\210\360\344*\357"
+	.ascii	"\356n\357\343\221\007\036x\340\201\236\222\005#\314O\316\267"
+	.ascii	"\350<J\247\217\262\321X\r\3431\230\314\261\032\026\363\020F8"
+	.ascii	"\006\251-\266\367\021\253\345\275\241\356\275@\350\336\013L\265"
+	.ascii	"$Pdg>\332\246\217r\321G\233\350\243A\364\217\321\316XhiY9\373"
+	.ascii	"r\273\204\262\262\204\361\300\031s\301].\322\003\366bW$\n\013"
+	.ascii	"\347\243=\264\b\366\276\036\316\233\227w=\234?\336\342\001\215"
+	.ascii	"\002\346\007\0213\020y\332D\205i9\n\212\263\207\255\255,\313"
+	.ascii	"\031\343\007\322\rg\234\345\277s\030y4\334\265\267\227\275w\007"
+	.ascii	"Me\207\217\036\234\357\276F'\306\202tL\206\200#B\246\340\\\342"
+	.ascii	"+S\346\342<=\341|\022P\216\030\331\234$9\003v\345\224\3074\035"
+	.ascii	"#\213\222\344\024l\034\"%\031\206IX\223+G\b\212hK\275XR\005\213"
+	.ascii	"a*\330\n\036\303R\360\361\"\361\024\034\3458\354rA\232\202\237"
+	.ascii	"l\250'\022\324\216x\366\334\355}D\221t3\300\020e\241[t\376\234"
+	.ascii	"\323?\333\364\3173\375\023\251\177\032\365O!\372\247\016\375"
+	.ascii	"3\206\376\361\022\240*ZV\314p\376\215\373\257Y\233\271\271:8"
+	.ascii	"\306\2719nki\356\214fj{\214g\320\344A\312\203f\364\362\345\226"
+	.ascii	"\225G#\252%\b\025[\333]s\337\264\020\020V\227\024\243\303V\346"
+	.ascii	"\277ff\364\260\331YK^\263+\206\317\217\255\260\f|\205_\3006\360"
+	.ascii	"\026\366\302_x\006\026\202\215\340#\230\b\256\201\225`\032\030"
+	.ascii	"\013'\301]\030\t\316\302C\360"
+	.string	"\r\034\004\353\300\\\270\007.\202\265p\016\214\003\373\300?\360\016\\\205y\\$\006\202c\034Oa\252\343\343\336R{\357\271\344\2330\233\313\b\377\235\303s\346\232\201\271e}n\332\217\224w\373t\2713\203\204\201\340(\fC\250\334[\310\230q\357\375;\006?m\341\242\347\226\235\305\335A\223\364\362#\341}A\332s\373x9S'Mr\314\177\347\354\332\214g\3775\273hystq\222\\\376k\326E\206q\354x\313\204\236\210v\024\034\r#\034\033:#\022\206\272e\367M\013\001S\314H` \367\315\225s\337\212,@LNR\214\314-\023*\367\346\3023\356}\374\325\362_\263?\204\0210\220\273\345\226\241\373m\307\320\022dFi\305L\335\217\273\275\217\036\034yp\352\3302\207\312\001\271\274\272Fg\bi\364\217_\034\303\270e\034\330\035P\260\274\032v8c)\244\343\027E\347\225\326q\233\355\275\207"
+	.string	"\360E\r\f\316\350-:o\222\3217\221\372f\023}\363\005}\023\206\346\223s\260\rQ\202\363s\037\375\034\247\237\305\350\347(\372\371K?\377\320\317Y\372\271J?K\351\227x\372e\034\375R\214~IE\277,\242_Z\351\227Q\232\350\026\235\027\316\225\273\310\016n\234_77\356&\324q\037\367>\016\341#|\266\220\351\321\277\035\234e^\336\355\340<\246\323\370\026\235\307m\232\310L\037\271\335\267\213<\272j\366\320]\023U\303\007\316\307W\364\b\366=:\237w\217\316\343'\332\202 \032\004\246\322 \310i\022\302\350\337)\372f[\372i\327\350\374\225\3227s\215\316w@\377\355\032\235\317\200\376\233kt\036\005\375\3445:\237"
+	.string	"m\301-:\177w\215\316{\345b\271H\nn\226\2070\302\313',[l\357\343PP\037)}\360p\376\b\372\227\354\035\240\366\b\327\240\177)8o\336\245\340<\326 \\+\035h)1]\304p\376o\225\377R\271b\024\224S4\272\266\331\336\307\fC\307\034UBp\376\361\032\235\372\026\235\177\351\313tJ\023w\340/\237\312\021\224AY\004\371\003\177\006\301\237\355\376\354\364c,\3109\177\351\344\201\0249\371g\t\214\301>\254\342\307\277\277dQ\302\250\373\357\005\360\006\177\331b\003\374\270\304\217\031\360\227\254\206\037\013)\375\b\230B\246\373\263\234?\267\3713\233?\267\375\331\314\177\213X2\022a\007\376\223\r\347\271\212R)\350?\321\300\224p\336\357/?\240D\003\177)"
+	.ascii	"$\026\370\313`&\363\227\n\310"
+	.string	"D\312\237\254\366_\025L\347\232\004\306\374YL\230?\243\375y\f\003\377;\310H2\030'\337\360\237[A%\005e\005i\206\300\225\374\200?\253e\210\177\270\357\220\271\244x\210\377\274\222\301\222R\t\031I\226\261@\340\312\1771`B\307UQ.\340|\272(\3747\305M!\207p,\005\220G\310\004\300\313c\377\325d+\230\017\266\223\013pO\374\345\0047\001\377\305\340\277\b(\217r\225?#\340\307Q\304\376L\345\277\034\376\222(O\311%~,E\312\377\243w(\023`\224\303\376\307\301N\216\302\177v\370\363\215\277\304N\376|\365\037e\260\277$r\243\037\215\300\237\257\376\353\201\313.9\372\243)\204\234p[\370\207_\340*\236\341G\033\360_\017\\\366*a\037M\262\022\0379\311_\226\220\221\354\300yY.\213\013\374x\353)\344/\034\357\340GG\374\267\205\262\204;\304\201\206(\025\220\211\\\0258\357"
+	.ascii	"\370\321\0160U\036r\345\312\021\034\274\350G'\3102\354\262\220"
+	.ascii	" ?\306\340\177\226\222\370\024>d\257w\370\321\016?\316\313?\376"
+	.ascii	"\313\342\252(\372K5s\225A\377\360\227I\275\377\374\362\024\320"
+	.ascii	"!=\177)\225\177\264\367\227>\362\326_VA~!\263\226}\374e"
+	.ascii	"\230?\367\370K\267\314#\357\370\3138#?\376\372\361\221\277\354"
+	.ascii	"\221\265\376S\360\243\007@\373K0C\376\222LK\227\277\024\033\243"
+	.ascii	"\022\345/\315\200\351\350A\366\227\\\222\374\245\230\221\277"
+	.ascii	"$\243\372K\261\017\374e\024\017\374\245\330\177\227\376\253\364"
+	.ascii	"\337\365\277-\374\330\007:\202,\301\177\207\027\3725\322\177"
+	.ascii	"1\360\337\f\374\367\002\377\265\300\2377\370\257\212\377\347"
+	.ascii	"\257S\3749\303\237\215\376\274\341\317\032\376,\364g\242?\027"
+	.ascii	"\375\271\303_\236\3703\b\177\326\361\227x\177\016\3723\206?s"
+	.ascii	"\360\347\034\377\211~\255\201?"
+	.string	"\343\3703\326\237\253\376<\343\317\"\3703\b\376\354\342\317\036\370\363\360\317L\177n\341\317\353\237\225\376\254\376\371\367\347\364\317\276?W\340\317\023\370\363\n\177V\341\317(\374\231\001\177N\300\237\013\360g\002\374y\204?\223\3703\b\177\026\361g\016\376,\301\237\217\376\322\315_\306\375%\334_\252\371K\267\277d\373\313\265\277<\363\227d\376r\314_\206\371\313/\177\331\345/\221\1779\366\227U\3762\354/\301\376\222\311_*\371K$\177\311\364\227E\376\222\310_\n\371K\257\277\334\372\313\035\177\251\343/q\374e\326_Z\375e\325_\316\370K\252\277L\372\313\030\177)\365\227O\1779\202\277\f\301_~\340/\235\376\222\305_\266\177\311\376%\361/\205\177\251\364\227+\376\222\003\177\251\342/#\360\227)\374\345\t\177i\302_\226\360\227'\376r\001\177\231\200\277,\300_\022\340/G\370K\022\177\211\364\227#\376R"
+	.ascii	"\177\031\342/\003\360\227\033\374e\006\177y\301_V\360\227\024"
+	.ascii	"\374\345\004\177\351\341/\215\3762\303_\006\375%\320\217}\374"
+	.ascii	"\227\351\277\302\2774\3772\377\370\303\177=\360\227\370/\377"
+	.ascii	"\343\274\037\363\3711\336\217\363\374\030\317\217\355\374\230"
+	.ascii	"\316\217\221?&\373\261\224\037G\371\261\223\377*\376g\371\237"
+	.ascii	"\302\217\233\374\230\311\217\215?\336\372q\217\037\363\370q\013"
+	.ascii	"?\006\376X\375\261\211\037\207\360c\022\377m\361\337\342\177"
+	.ascii	"\331\377\016\377\353\373\357\006"
+	.string	"\376\233\302\177Q\374g\341\277&\374\267\204\3776\340\177\212\377.\340\277\"\376W\371/\366\237\310\377\265\377\"\362\362\362\362~\2411\277\004D\376\bX\t\333\314\327\211\025\004\203/}\fl\350\237R\244\354\300\323\377\031\345\214\202\317nJm!a\306\275\265B\0041\231\222%\n\347_`\347\311\223[v\324\365dg\201\035\r%w2\237\2726Fp\376\005`\300\300\332\214\027Pa\302\204\212\315\330D\377\347\222s\311\225\002\364 \223\263\273\273@+I\222\253\241\330PX H\311\222\263\273\273`\353\237_\027\307\3418\2649\264\3778\203\313\206\207\n\016\316?\211\334\263\310I\3434b>\271\333\306\276TN\230P%-\230\243o\301\233\3765\237\234\3779d\310]\003\002\252\245\016/\371%H\020=b@\200\324%\371\361\343h\231h\317\260\312c\374\241\377s\353\334:Z>n$7/J\316.l_\355\020\267"
+	.string	"K\377g\217_\344\331\003gA\321\005\305\204\004*]x\366\320\201\232\323\003\347[\020C\377\247\216_\344\251\343\334\001\242kgiP\346\210g\217\231'\206\227\024\234O-4\311\0272I\234_\301\035\375\n\336\364O\033\367\274q\3228q\\9\013x\261wW\222\023+\352\030\342\025|\321\257 L\377^9\347\177Z\375\"O\253\023\013D\327\266\361\001\223d\035\031\224\253\307\334\016\234\317+\263\313\325\332\033\316\257 \211~\005[\372?\253\376\020F\270\310\263\352\226],\333\352\207*\n\217\236\273\275\315\204\030\272\003e\353\b\316\007\300\034\3753\3069\365\223\352'\3259\343\356\275\267\326~\2323B\036\234\234\335\335\326\272\002\361\2372~\3168\035\206\375AHL-\231\007\347\3331\237\374\357\371\324\276\356p>"
+	.ascii	"\264\350\377\367\370?7\324\325\336\333\206y\334WQ\030\316\377"
+	.ascii	"\376\232\367\202\370\203ny1\370\237\367>\bF\260w\f7a{\357[G\203"
+	.ascii	"\241A\365\260`\233o{Ky=-\300\013K\312K\307\024\322\013+\303\024"
+	.ascii	"\322k?I)y\312p\265\275\236\246\220{g\220\222z:\321\205"
+	.string	"5\205\204\332\031\246\220\033k\277X\203u\367\321\353iKu\355\f[jCmd\027\226\005SR^XSH(\254\fSH/\254\215\364\332D[\n\352\212Jj_e\330H\2579\033\331\205E4\205\354\302\232Bz\355\271g3\350X\321\321&l\211\227\013dJj\327\250\362\001uE\3646u\354\332o\366\276f0\366\325~\333\033\203\275}t]\275\201\322q\323\242\336jDy\201\352\272\307\275\267\207\252\250 ][\352\355\351\356\267)']{;\211Z\332U{\357-\302\323\361m\033\271oOB|l\0320\366\226`\037\367\256\332\373\351\356\267\275\367\323\336\033\275\362q\334\233\007\321\224\261\252jo\255\243\252\355\343\t\f\214\275\261\231\\\032\326\0242H\027\022\2302\244q\3078>\335)\032]\333\270\337x]i\344\323\225Mc\357}\351h#V\226\035\316G\2404\256-7p>\245\326\320\200\240\341|"
+	.string	"\330\320'\024p\210\22618\037"
+	.ascii	"T\3727\211\\\244I\004\333\2418\356\247\017O\350\340\355fd\213"
+	.ascii	"\2317\344\304J\310\031\234O\001\037>|\350\322\344\360\360\266"
+	.ascii	"\244\221\311\223\347h\367\212C\214-]\222\373\352*\304)@\342\301"
+	.ascii	"s\264\367\3666\243\225\266\257\264B\\\2546\\\344p>\005N\364o"
+	.ascii	"\332\371E\232v\216\206b\277 \333`G\226\234\335\335\276\322\n"
+	.ascii	"\201\341\0055uj8\237\002\031\3727\313~\221f\231I\007\204\336"
+	.ascii	"Ri\372$\367\326\n\001\264\205CG\f\234\355\360\03354ep\376\207"
+	.ascii	"=\372\227\255\313\026=I:S\016\257\316L\232s\346\0343\216)\347"
+	.ascii	"\"M:\023\316M-\246\331\031\223\316D3\337\334\267\"9\r\235\351"
+	.ascii	"\245.\331\023s\303\311\013B\371\037\346\364?\270i7Bv^\272\312"
+	.ascii	"p\376\2073\235\006\207\215L\032-`\312\230lf\030S\214\233q\357"
+	.ascii	"\215Tf\315h\006\315\232\032\333\332\0316sL[\322\315lc\2621\341"
+	.ascii	"\3146\363\315\2143\327\230j\3144\027i\262\231hn~1\317\330\314"
+	.ascii	"3Ypmw{\037Mp\322\006\017\207\374\017]\372\037\254\364?@\351O"
+	.ascii	"0G\177\0027\375\t\322\364'\300\242?\201\321\024\323GkI\321\310"
+	.ascii	"\201\363'0\242?\201\r\375\t\240\364%\350\243\357\3255:5\270\321"
+	.ascii	"\227`M_\0024}\t\220\372\276]\243\363\303-:/\001\023\375\233Y"
+	.ascii	"\310\200\226\214\321\262\243\2024\251\230d(\272\240\274@\310"
+	.ascii	"\343\025e\314\335\336Z!r\216d\22068c9\222\200\033+:p\276\004"
+	.ascii	"C\364/\233\225\243\t\365\3666\303\305\0343\305\216&$u\334HN8"
+	.ascii	"YM\232\334\231W\314\343E\232cf\225\347\343\366\300\203\243\236"
+	.ascii	"\024 a0\316|\tb\350{\300\323\367`G\337\003\034-\345\270A+J\215"
+	.ascii	"73J\257\213\007\031\024\316\367`\306\204\002\302t\322\223:\016"
+	.ascii	"a\200\312q\246\006\347{@\323\277\311\265u\374\261\022\265d\255"
+	.ascii	"\tWy\344\315\013qLL\243\334\226(t]7\215\277\t\304\3642\227`\350"
+	.ascii	"\002C\266v\205\263\222\243\263\310\235\251(\234\357A\213\376"
+	.ascii	"o~\231GL$\027i&1\207\034\221\020\002\327\003\311Lb\006\361\221"
+	.ascii	"4\223\230DL#\037\242\2466T\020\r\300\322\362\356\204\272\350"
+	.ascii	"\266\304\351\374"
+	.ascii	"\233F\212\224a\372\330\315\231;\236N\212\330\211\271H\363\005"
+	.ascii	"\334\346\270\217p\026\034#t8\337\303\025}\017R\364=(\321\367"
+	.ascii	"0DO\260\257\321Y\032o\321i\376@\272\331\205\201\316\033\244\024"
+	.ascii	"\234%0\271\314-']\354@9\242a\304$\253|\340&P\352\340\300\371"
+	.ascii	"7{\230TBR\246\224\341I]9B\346\336]o\214g\240\344\370\230\233"
+	.ascii	",\f\235\251\244\226:1w.\337\241E}q\335\231\321\3352$\270/\256"
+	.ascii	"0\363\311\244\312y\362\036!\251\343\306\022\372B\347\213\353"
+	.ascii	"nL\035.I\262/\256\2733x\260\032\330\027WX\231;X\355\\B\366\305"
+	.ascii	"u\367\242\013\235/\256\273\27193\316\354\230\004\371\342\272"
+	.ascii	"3\251\314\250+G\b\352\270\257\320/Y_\\w\346\224y\303\314a^\231"
+	.ascii	"4\314\031\246\016\023\313\214a\3260\255L\034\246\rS\313\3142"
+	.ascii	"w\2302L\036f\325E\232T&\214\3479+\343\234I\225\355\224ub\276"
+	.ascii	"\270\302\366>b\3501\245\f\035\020\371Gx\364\217\330\350\037\201"
+	.ascii	"\321?\232\242\177\324\245\177d\243O\316\013z\323\001\207\013"
+	.ascii	"\237>r\031\357V\325\031\002\005\347wP\323Y\317K\250\034lh8\277"
+	.ascii	"\003\026\375\016M\364;\b\321\357`\245\317\301N\237\003\234>\007"
+	.ascii	"4}\016R\3649\b\321\347\220C\337(O\337\310\215\276\021\031\375"
+	.ascii	"g9q\356\261K\n\2377\317q\376\f'\313\341/\367\005]\225\036\234"
+	.ascii	"q\3275:5\270Egv\203\364\374F\bKJ\026.8gh\023\207\347\312\234"
+	.ascii	"\210\211c\363S\307\311\021+\234\341~\250(\311\262\206\363\215"
+	.ascii	"\260h0rF\270\263R\207P\2717\324\234\321,\227\311f\362Z~\313j"
+	.ascii	"\231-\237\311m9MV\223\321d2y\315Ef\267\034\346YL\0363\306K\035"
+	.ascii	"Rv\313\\\362$\221\334\362\227R\307}\323\312S\350\356\\v\313e"
+	.ascii	"Y\313}+\222\305\366$\321\344\030\273d\341\343V\306(\253\356\233"
+	.ascii	"Vv\322'\231\026g\316-o\271eBO\307m\205.\361\222\323s\344A\320"
+	.ascii	"\034\037l\220|\310\370\352\032\235\030\334\242\363FT\372FO\372"
+	.ascii	"\033\356\3647\314\351o\210\323\337\320\246\277\301\214\376\206"
+	.ascii	"3\375\rc\372\033\216\350o\270\241\265\374\312\271Cu\222\350A"
+	.ascii	"\202\3637P\351ox\322\177F\222\345./\240\271\341\374\2279\362"
+	.ascii	"\223\f%c\301u\236<\035q\276\242\227\274\2412\203\363\213\350"
+	.ascii	"\350\377\231J\036\313U\262\225,v\221\371\230\243<\207e)Rgd\224"
+	.ascii	"\260\205Ab\024\003\223\304\270\367.\305\3048b\234\313\307<\345"
+	.ascii	"h\345\225+\0160\334\204%\367\336G\030\346\370`\323\206!\277\250"
+	.ascii	"N\337\256ktnP\243\313\267kt\" ;\0013\335HaC\205\363\237\301\362"
+	.ascii	"\326\275\363\206\247\005g&b;\222e\272\300\3251)\243p\231y\201"
+	.ascii	"\243\303j\360\236>\306\250\027qsX\r\356\263\007I\315\033\254"
+	.ascii	"fK\321\33512\031\31133=[\362\030\305\240\374H\226OwQXnI&O\212"
+	.ascii	"$o\260\031\243l\264e\225Zqk^\345\327\224d\031'\327(\361\262\222"
+	.ascii	",\225\221\344\251\374\225\205\344\036\331HNR\366)\367\224v\331"
+	.ascii	"F\016\222\2732\2202O\376\221u\224sJ\271\022O\231\227od\253RO"
+	.ascii	"Y\227\261\362\214,#Se\255\262M\276\312\\yg\034%\235\222O\216"
+	.ascii	"*\3572\217\322MY'{\345!\331\230\253\312\271RN~\312M\312;\371"
+	.ascii	"E\336\221i\224t\331G.\222a\224\311\f\225s\344\0272\221\234\225"
+	.ascii	"\231\344%9Fi\247\204\223\217\224o.2o\225p/\331\224qlXf\224Pq"
+	.ascii	"uZ\232\034\t3V#\351\365B\025c\231\265\003\215\361\232i\201\303"
+	.ascii	"\363B\022f\314\342\372b\306\345.\352\352\256y\361&\311%\310\026"
+	.ascii	"#T\262~x1b5X\217\233)&e\330\326\035;V%\275\b1;\0332Vz\225D\254"
+	.ascii	"\030\261\032\234\207\227\314[%Z\331V\036\323L\210\222\223\334"
+	.ascii	"{#\251\222cV\254\260\032\314\207\217qI\022cY\026\204\017\023"
+	.ascii	"*<\216H)\263\312\255\263\250\274U\306(\253\312\243\261\204,q"
+	.ascii	"\222\245\227\022%Q5\344\260\032\214\227WfuuIf\345\255\022G\251"
+	.ascii	"C\350\211h\357!i\214{o\257\322\030\207\244\214\017\264\261*Z"
+	.ascii	"nr\306\222\211\023#I\257$qK\312(+8e\026\2173Y\372\224Y@\270\334"
+	.ascii	"\261+4\222kR|\030K&\345\224\270\036X\r\316\343\206\312\230\325"
+	.ascii	"\303L\362-\n\216q\215[\262d\222\267J\260\257d\351\225\267\312"
+	.ascii	"\"b\311\275\217\275\033W\322\336.\217\254\323\256\321ye\334\242"
+	.ascii	"\363Ec\364\213\262\350\0279\321/\032\242_dC\377e\332\313\266"
+	.ascii	"\277\374R\236\225l\267w\343L\2303\234\323\364\221qV\005\347\027"
+	.ascii	"\315\320\377\3133\245\231\022MY\346\"\313\265r\314K\265{f\204"
+	.ascii	"0G\222l\345ZI\206,\t\030$\306r\255\024\343\025e\214iD\313\016"
+	.ascii	"\356'_CR\237p\3645\270\321\327\020\247\257\001N\3433H/\323\262"
+	.ascii	"\220;VMp\276\0067}\223\327\350\004\300-:\257\341\213"
+	.string	"\276\206'\372\032\214\350k\340\241\257\201J?C\036\375\fq\372\031\274\350g\020\323\3170D?\303\225>Q\037}\242:}\2426}\242/\372DN\364\211\214\350\023m\351\023M\351\017\325\321\037z\323\037\342\242?4E\177h\211\376\320\226\376P\r}\241<\375\343-:/\004G_\b\215\276\320\026}!(\372B_:W;\377\336\023\034\307>R\342\340\334c\322c\322\003\273\373*\017\\\257\311{`Cui/\310\301_\214u\220<\341|\022|\364\3373b\345H\303F\f\316G1+\253#]J\266\3206gO\252\220G\353!\271b\334{\023a\220\253\363\305\f\347\223\300\323+\322+\322\373\272\006(#\0370I\346\335\365\214\274\367e\0329\341\222[2H\264\321\277\310\336\013\307\274eG\221 D\316\027_\310\222\330\350\r1\351\310\201\223\322\246'\2447\243\r\020d\037\234{@z@z^\367\352\352"
+	.ascii	"Vppmw[\353\006\210\236W\217\352\030\247d\b\316'\201F\377\275"
+	.ascii	"\256ss\331@\366\300\371\027\331\373q\266a\200\035\215!=.4,G\023"
+	.ascii	"\274\033[g\230\270\311\231\363\021F\003\027(\036=\272\240`\206"
+	.ascii	"\312\021\036(\022\n\216\017\236\035h\025\017\244\361\251\323"
+	.ascii	":\221]"
+	.string	"\220d\240th\"n|\354H\341\234\225\325\303q\261l+\247\032T\372\b\301\241k\343q\343=\034?r/\266\230\235QBh\256`\261\221be\325\303:\247\324\210r7\004\3655\006O\357\352=,:\267\251\263-$\216\364\252zU\347\361\346\250AdJX\031\030/p>\t\255\336\356\355\336\214\323J\215(wa\247\033\256\2611=\031\357\315\2403\242\206\247\205s\017F\217\312\016\033\037=\252\336T\017/Wn\354D\320\245\207\255\027\303\204\023\224\343\tZ\033\234{/\216v\346\205\22268\367\244~6\203\013\235\023\234{Q?\353\232+B\004\347\036\324\317\316\234\331\301\201s\357\351gR\260\340\361q\306\204\f\025\0248}\372h2GzW\321\242'\271\267\026\b\240\2519:p\324\360\360\364\236\213e[\215\240I\2241a^\340\274`\340\274\347hE\232\b\331\202\363C\220B\347tt\236\213e[\035"
+	.ascii	"\254I\2230\241>p\326\366\335u\236,{\206\310\301Y\327\321x\376"
+	.ascii	"\3670d\001\271C\323"
+	.ascii	"x\364\035&Ij\350\300\262\261\035*tQ\332\216Ye\256F\335\236\020"
+	.ascii	"\276\346\314\321^\370\330E\031#T\246\246G\016\347\207@UW\247"
+	.ascii	"\311\034\361\201\2122\346.\350\016"
+	.string	"\332\032\2576ss?S\252\354\270~n<ICC-N\0344\306\305\262\255>P\211\372\342\272\2731\266\220g8\037)\f\016\234\263\315P\216\252>{\302n\2205#[8\037I\210\03379\252\350\372\334)\321\343\003\r\316G\252\021\027\247\275\\,\333*\004k\242\214A\355\234\301\350\302\371 \330\301\301\3514\n\264j\020\231r\227\247\350\350\202\206\363AX\242F\315\331\346\250\353\311\016j\254\341\025\006\257\325@\003\203\363A\330h\256\331\320h7t\214\221\"<%\"?\322\264]\273\2459\363\262\244y\245\321ky\314\230\031\342\252\352\263'lo-\020AF\340`\204}\0313F\223\361\220e#\312\230[F\216\324\036\265k2tX\f\311\246\212J\230?\214N{)\245\005\302\001Q\334\264p\376\210\"gg:\215\002'Uq\322zj\254\320\245\321h\327ih\030\270T\31133B\013y\315\005\251\275"
+	.ascii	"\035\217v\224\324\346\342\372\031\253\302c\274\333S>@\230G\320"
+	.ascii	"X\301\241\273\\{\321\"\247F\2146\273\336\362\367P7qkXp\276\210"
+	.ascii	"7\255\313\256\265\374=\263GV\034'8_\304\232\376u\226\277\207"
+	.ascii	"\241H\2326;\234/BM_\004\332\330\230\306r\336\250\2423\006\303"
+	.ascii	"\230\2365U\256\\c\t\262\223\345\315\n\316\267\243\217\377{g\233"
+	.ascii	"\325\036=8\367\332\320\3312\303\371\"\200P\241\242\253\3748\251"
+	.ascii	"\262\343\n\203#\"c\206\026\273\2562\024\365\004\311\227\260\377"
+	.ascii	"\275\240\260\271\270\035v\244H9\333\252\350\372\204a@\023Cb\006"
+	.ascii	"\031%\312\331\306(\255*N\332O\231\343U\225\037O\236\234\307\213"
+	.ascii	"e[\035\345\301\022e\214\320\025\037N\346\340|\001`\351\377\327"
+	.ascii	"Mt\023\rv\324\365"
+	.string	"4\007D\225(\020&\025^\0368\rv\345\034\271\002\003\b\316\377\340N\377\332\250\215'\362\022m\251 g4\230$Q>\334\350\"\327Jt\021\255\265\002Fo\214\214F\222\356\005\033;p\326Ht\022}D\177i#\037\204\321>\256\207h\037\232\b\b-(\033\"\200\241b\352\300 \217\310$H\274*8k/-\004\275\363\367zbh\300\371\300\371:H\2215I\236\340\2145\020T\354Jj\013\316\327]%\2374b\250p\276\376\361\2777\2028@\244\340\254\2714\214\017\310:\350\311a\231;\202\363\257\267\256\2710\215\036Zu8\243r\220\256\267\360\022\263\2655\234\377\301\013\372\327<4\017\\\2273\354\r\265\347t\3632\243\005\347\177@\003\316Q<\350\035\232\347\"Q8Z\013)jC!\371\340I\024\260\207\f*8\3538B\271is\006\347\207\310\323\277bz\320=V\344\360\211\243\237t\324}+\262"
+	.ascii	"(nI\264\017\212\367!j\n\205\230\\\362J\277\320U\367M\213hK\235"
+	.ascii	"\335\351+\275\337\330\32094\016\235\245\2554\226\276q\221\372"
+	.ascii	"JK\035\275C\363H\351+4\017Nr\357\343P\035*Zt\020eT\317\347>D"
+	.ascii	"M\241\260B\227\3244t\215\213\324U?:\356\223\320U\032\206\236"
+	.ascii	"\341U"
+	.string	"\200\266\2521(\036<\b\262c\363\246\307\231\177=C\313\360r|\201\016\316\232\n\325\322\261\366\002\347\207p\323\277\216q\221zJ\333\t\003\2037\367\277\007T\346+H\032\375\020d\364Cl\321\032J\307%\267\332p~\b2\375\020c\372!\302\364C\200\351\2078\242\037\202\210\376\321=(\036\022M\2356<86\032Q8?\204\227\306\307kt\202\270E'J\007\265\203\336\371{CS\322\210t\301\371!x\350\243u\376\367R\370r\353\202s\276W;\3219G\355\376\036^[b\254\302\371!p\350\243uh\362\357\t\275Q\262\345\n\316\017Q\245\217\322u\311\253\263\003gtN\303\360 \257\203\237\255\263\037=\342\034\235\373Q9\327KI\303\205<>xp\016\272E'*\207t4\016P\033\231\344\030\316\030n\321y\017\342\334\270\2513\222\211\213C\253t1r\201\203C\221\037\230\242F\r\332\005\305q?I"
+	.string	"L\316.\314\203%nnh\025\261 ll>n\254\255\241gP\020\355\375\002\225\321\203\027f\314\240gP\034\367\223\006\340\344\354\302>`GdI\0362d\320.Cv\320\215\031\203VAq\334O\021\210\222\263\013k\203\206\242\241a@\034wV\b\300n\2040\267\3144\030/\306\240iG\301`\272+55u\2073\022\322\321\264;\206w\245\f\316\017"
+	.string	"\231/_\320.C\304\272\224]$Z\206v\031\342\305\334\362}\245\301\262\345(\227\277\314B\265`:21i;pF\315\220\216ny\203\005\006\007\316\346-:O\262+\350\025\024ygn\3411\265'uX\216\222a:\235\324\243&\211s\bHG\261\234ac\200\344\301\371\001x26\326%"
+	.string	"_S.\022\235\202VAA\264w\2207\3062\313\220\027\236\240b\177\311\004\245\202\n9\343\346\f\347\374\343\311E\242O\320\260\254\017\250\004\271\021\302\334B\363\006\006\330\035C\241`:\2554&m8\227\373\032\235\017\300\225F\301P\260\263Moo;(\036\206$l\224\240\341\374"
+	.ascii	"H\031\215(\023\3345\366%\t&\317\035\223sW\341\272q\007\347\203"
+	.ascii	"\300\243D\t\032C\303\336{\033\3214cfI/;\264\302\332|}\241HP<"
+	.ascii	"`rvaC;\350\312f\0349\212\004\343\335\341\362\004\347\333\311"
+	.ascii	"8\300Pa\303\371 \312\212\024\251s\303P\314\354`\341|\020T\210"
+	.ascii	"\020\251\333b\334\222\006\017\324\022!B"
+	.string	"\316\243~\272x\262\344\354\302\316-\2502\0209~\374@\275\334\3102\032\023< @\216z\351.\037v\362\340\214v]M\327A\251\342\002\202J\377J\271h\217\213D{\240[\t\300\312\362\021\242\234b$\314\035\324\307\220\r%tbG\030h\3648S\303\371 \240\364\217\356@w`\221\360$\n\245*beG\234\016\035\347Q\357*\306\255\245\005\"K\221})K\303\201c\216\313\330\244\210\232\025\234\337\201\024\215b\241Xh\226\336\036\306\242\344\354\356\202\202\370\220\312\203\3328\232Ew\3569rU\355\377=\241>|\252\314p~\007K\254\254\316\027(\272v\226\005`A\276\270p\334\032\2279\234\337\001\217\252\252\363\250\237\366~\"\332Qq\272\030\315\270\2717^8\277\003\252\0313\316\343\355\242$\271\265\264@\234]f\354x\301\371\034\334i\224\n\245\002+\325\330\370\261\003\347s\340\006\205\201\302@c\364\022"
+	.ascii	"\207.9$\206\312\252\t\032\343hZG\256p>\007d4\032\205F\241R\275"
+	.ascii	"\275\347l\260\225e\262y\233\262\2053*u\313\200\340`\205U\301"
+	.ascii	"\371\034\230\351\037}\372E\242O9\216)\265\241\212\234m4\350\230"
+	.ascii	"\271\203\022f\207\027\316\347 \211\376\317\274\213<\363\256\034"
+	.ascii	"\020]PP\032D\241\203G\0071\303\365\002\347s\300\207\317\bb\254"
+	.ascii	"\364\317<\367\304\303\343\003\307\301\323\335\335\321Pt\275\270"
+	.ascii	"BB\036\033\331H\234\036i\350\334\271\223\343\312\251.\250 \""
+	.ascii	"0i\"\247\007\305\023E\207\003\347opF\377g\235:p\033\224\351\377"
+	.ascii	"\264\273\310\323.\223\241\350\3326H\300\023&\312\230\336\031"
+	.ascii	"==\334p\376\006V\222\311\f\206$\265\205T9\265h\304\271\321\273"
+	.ascii	"\343\205"
+	.ascii	"\254\007\316\337\340\n\316I\007\347\234;\345\344\316\271\273"
+	.ascii	"\257\360\240?\340\206\254h\251\251\"\347\347\334\317\234]\307"
+	.ascii	"\210\363\031\307|\302\306\270\351\340|;\267"
+	.string	",\310\0359h8\177\203\030\372\032\340as\272as\266\341`\357{\354\262\272\332ZW \342\342\3166(\236\366~:n+\243\037`Z \204\216\300\335\311\303\271\215Z\217\tX\020\0328_\2036\372\032\234\255Ys\356|\334X\004\bb&\004\320\026\"m`p\276\006U\310\2209\337,\330{\303\330Nu\242\270%\321\374|\373\351v\241\344\264\325\300\371'\333\331\366\367L;1e\302\340|\r\240\350s\355L\363\277\327\323\"\005\215\030\234\21750v\240\202\254\f\017\234\177#\036\022%8\237g~\366\277\367\303\326EF\016\234o\3474\363\277W\004%\312\224\231\263\f\017\2604us\345\223\220\031k8_\203\037\372\"\356)f\314\325\272\244\264%3\310\323\317\200M\247\241\235`\244\260e\300E?\203']\272\234gh\017\260\363l\214\032\222#8\237^\3143,1d8\337N\357>9\223\302\005\347g"
+	.string	"D\377\347\226s\013\266\353M\231pa\311}\245\025\002\205\033b\236p~\0066\364o\n1\205\3342\020P.QH~\226]\344Y\206\353zS{\333\020!\n\230\234\335]\006/\260`9\221\345\336^Z\b`B\3663\005\366fw\222YA\252Y\202\3631\300\243\217\001\233\261\261\363x\242\275w\324\336\\[\347\031\260\333\371y4\3278Q\302\005\347cp\324?\247\334S\254\312\321\026@\265\003@\355\312\264\242\240!\351G\023\207-\013\354\260\035\n\265\276\264\r\252'T\246\265\005\"2\375z_\022Q\\jS&\341\232\262\275V\270\226\305`\260\204P\233\016\203I&\021\320\227D\250Lkk\006\203%\324ve)\260\nO\320PdU\026+\013lW\341\tID\024\212J\264\252\t\300\2258\201\220J\264\240\004p%b"
+	.string	"\0342\261kJ4\201\017@\265\375\251\255zB\270\022Yh\221Z`\310\272P**\256F*\\\004\211\304\022\300\2258\301\227D\264>\n\276$b\004\005\305\023\324\244\264\030\\\323$\242\244V\270\262\301\363K\"\206\254\013\245!\353\302\004\"&VUq\"CqE\t\r\301$\365\304o\205VU\032\n\246\277\2456e\032Ql\327\025#\232\204J\002pj\022\256A\001\2100"
+	.string	"\337"
+	.string	"Hp\032\241\002\233\202?\341:\202-6\215\030\321b\310.\265C!\232\224\252\301\334\026\205\303\237\231\324\262\036(\232_\0221\002\250\006W\244\302\006\024OP\331\2466U\223\210\276$\242\330\200\t\234\240\302D\t_\003N@ \205\317\304\n>\026N\310\360%\021*;\374\031\251\305U\202/\211X\241\270\0221\261j{\002p%\006M \030TM(\245,\264\252\322\221\013\342\320\004\221\357i\233\002[\265(\344S\3334HdRUL\340\20284!A\373%\021J\304\021J\304\237\260\251\004%\"\2200\t\233E\237\022\021C\353\023*\021M\241\022\261\\j\225\204j\360T]X\213\271XTY 0E]\020\207\277\314\266\304\022\250\n\225\326`\212\002\325bS.\242g}JD\021A.\330\266\270*\251+x\020\201D\bH\025"
+	.string	"\246M\021(\021L\233N\f\241\b\256i;\001!\025\3324X\302\260\375A\200\204\n\f\333\037\004\200* \002q\310\252\240\006\225\204+\013C*\f\300IE1"
+	.string	"\013\240\f\b\252\200\n\300\264)\002?BJ\302\225\002@\325i-\241\270\002\245hU%\f&\264*\013\025\024\211\303\266\370\323\256l\013\240\242z\342\310iM\001L\207(`(\236.R\226-1l\213M\277\017*\333\264\001\005`:\frhW\341\t\275\r\355*\374\025\033\320\256\302\225\210U[\342\360\267\262*\212'\020\021\245hU\245 '6m\323\023?\366T\201\303\024CAmq8d@\220\t\017\254\352\264jH\333\364\004p%\242#\224\326$\241\n\031\264\032\\\221\252pZ\231\206\210@\020\321\262)Q\204\222p\025\n\233VP\331\264\203\n\034\246 *\026\325\337/=5@\002\006@\330\200\351\264\246 \252"
+	.string	"\004\021\252\013k+L\233\""
+	.string	"\274@\003\222\210\242\004$\320\026\323\340\206\242\211$\"\nB\027'\3246\005\022\233\212\200\252\217U\235V\f\255\206\342P\205\n\034\246X*\246\254\tVm\223J\260*\013\b\020\327`\t.\202Db\232\201Q\b\"N\350\300\301\374\222\b\245\246\025*p\0040\2706\255P\201\303\024=u\250\"\030l*\241MW\260\320%(\245,\b\207k\373SYvh\242\203\020\t\021*\202)\221Pie\301iM\241aM!\344\224\006\t\327\024\252\2220]\301\304\217\355\265F\032D\020Ql\032\256,TV\205\037\273\241\035\372\222\210\237OeZ[a\023;\342WAQ)\r\226\240$\\\231\330\024\250\b\0246\200\035\266C\023@a\211`\323/\230\376\002\360\337\312\252BUI_\204\001\b`"
+	.string	"$8\241'\301"
+	.string	" \030"
+	.string	"\204\363$\030"
+	.string	"\t\311"
+	.string	"\003@\322\037"
+	.string	"R\331\266\276b\n\325\007\324b\210\202\206%\245\025\005\220D\n&6-\256\300\fKJ+\212\241\377Z\fQ\200@\253\006\207*\b\025\203\332/\211\030\241D\344\300\252L\253\n\240\312\201\205zBm\323\0250\020\t\207k\221UY\bO`j\241B\006\246\026*"
+	.ascii	"\325\237\320EQ(\001\265\330$\324\026\331&\006\250\305\246 \027"
+	.ascii	"l\2532\251AUE\206\342\031\034\376\206\355\220U\241e\207D\016"
+	.ascii	"J\302tE\2732\240\035.\025O\250\305\246!\026*\260T\233\202\351"
+	.ascii	"\004 \240\006\201'\004\323vUZ\201\034\204+\023\220S\312\004\004"
+	.ascii	"\024\246LL\303\237pe\372aR\333\242\013\026\276$b\204p\310\304"
+	.ascii	"4\374M\320"
+	.string	"\302-\372J@j\211@j\233\266E3\211\210\002P\353\013\201\204\352\003\236\3404\\\201\266\276\242\004T\246\265\325\255Y\364\241?C\026\254\312\202Zl\322_\0221\242\310\016\213B\265H\201S*\\\2314\264\340\320\n\325\242\312\022\333\241\260MW\260\360\360c\021\fR}\032T\337\006\365\3076\rY`\325VM\321\nU\226m\372ip\321\256\277\224\230\256\030jS\006L@-6\005\025[V\r\2260\241\026\2336\250J\251p\270\266D\246\246\242p\370\373P\\\213*\253\266E\027Km\272\202\205\220\252\224\266\301!\213`P\375\005\203MIm\272\202EQ+l\032\232\b\006U\023.X\265mS\006\250?v\230d\344\"\r\022\213\353\2066]\261\006)\tW!\233R\200C0\375\255\355\312\232`\207%\260M'\332t\005\213\016*$\021QPJYh\323\025,\210\332/\211\030\361\323@m\323\025\212H"
+	.string	"\256)\330\245\026%aHtj"
+	.string	"\273\324\352bQm\323\025~,:$:5\340\307\236E\265MY\363\304\t*\260K*\204.\200\275\026R\225]\341K\211-\207\037\0258L\221\022[\264ejb\241,\372\3226=Q\\\235J"
+	.string	"WbP\321\247\002p%bpa\311\327\"u!\344\302\222\217\310\205\245\245_;\024\266_\022\001\\\211G%\334\242/\t\270\022O\025\356\t\367\304\005\256\304\262\025\256C\025\210M@\341J\201\016@-R\0134\261"
+	.ascii	"\\\211B\3025E[\002\270\022\211\332\237\232\224T\324"
+	.string	"\262*\321I\365\265\301\265\365\t\207.\254\354p\351H\005\016S\270hW\026)k\302\332\n\323!\016\30255\201\035\266)\253nX\241E\352\"CP\375\375J\250m\312\n\001\225\210\326!\261U\213G*\323\332\376\270H\203*\020hC\221\t\340\252B\233\256`Q$\034\256\255\n \233\266`\207%"
+	.string	"U5\311\250E\352\3027\364\343\302\222/\204b1%\266\030\0063\270`U\026\303\237\312\372\204\214\332\241\220Jt\321\022\255@J\302\364\250\203pM\2252\024\231|\300T]J[\030\016\203>V\025\256)\333\372\206\354/\365 \\S%\242\f\035\212+R\r!\260j\033\\\2234\270\260\344\023\256.,1\261j\013\334\240\002\207)2\250\240\342C\2732\255(t\020\256\251\t+\260\252\222\322\312\252h1\f\006K\230X\372\t\233\322 "
+	.string	"|j\261I\203S\032TY_\213\324\205\017\250\266)\253\244\266\302u\203\013+\233\252\302\025\205\266\330\304.\265E\246pM\225~\324\2370e\001L\201Am\023\261m\032\3724\264\302\246\341\317\027\f\252?_\207V\250\256Ea\312\266Gmq8\\\341KJ\322l\272\364\313*S\232\202\032\\\223\206,\021\210\211\310\372\204+\023\006\240\252\022\213\276V\2502\265\305\246\016"
+	.string	"S\243\023\270\022\205\324b\252\262?\341\252\006\201k\006b\321\247\256m\312&%e\360\251-\254\304\242/)I()\211He\3016\375\204.\200\032\324_\312\372\202*\01358T\024\252D\246\341\317\247\224\026}m\272\202\205Q\333\"uQ\026}\254\352\264\246\300\240\203\301!\233\227~\355J4\277$A\220\n\034\246\350\005\207C\006\370L\240ZdU\026*\353+\266H]\024\265B\365\307\252D\037;l\207L\035\206D'\325G\\\203IK\305\224\375\t\241_\022Q\f\016\331V8\374\371~\354\210_\322\207\023$\210Z\f\203BKJ\353\322\020\220D0e\333&U\330S\203m;d\227Z\037\220\004P\230\256"
+	.string	"\246*\260\250\3050\b\264\244\264.\371\200$\332\225i\rb"
+	.string	"\222P\201C&\037P]\372\265k\213\342\320\227D8\261#\224\210E\037\022UvD;\034\262#\200\212>\2455I84\341\304\376\020S\246\037k\262*pe1d\211@\325\211\r\246+\253\02638\251Ab\323\211\244`\272\364\243\002W\226UY\f}\302\325\202\326\207*\245*\206\253O\251)H<\312\320\252E\225\005\n\327\025\2766-\372\230\232\330\266\005\225X\234"
+	.string	"\203\032L\177?-\253\262\020\256?\026\2702\231\302\225I\267\360S\227~N)\223\036*\232\b\246,\204\303\265M\203C\"\253\266\302\023~l\207\242\252\262J\352\t5\250$,\301\224\232`AL\322"
+	.string	"\f\016\227\212*\273\244BmS\026k\373+\241\002\207)\3305=\022\256\255o"
+	.string	"H\255pm\322?\265\330\344sJ\231|N,PP\025\n\323\245\237\317\251)\3659\245LCEv\310\262\252\321\331\252\305\244\244!\220Jt\321f\360\220\2244l\233~"
+	.string	"(\256N\251O\251i\205\nl\233\210\302\265\203Jt\321\372T\026k\233\262XY\025\370\201\035\266\2774\3117l\233R\237\222p]j\207C\246\242\357\307\036\001\207+\253\022}I\304\240OeJ\331$\337\217-\372\326b\221\365"
+	.ascii	"\\}\355*l\n\n!\350\304\026\207\332b\232\344\0036\245+|\305\246"
+	.ascii	"\025E\241\326GB+\\\233\320#!\231\260@\002)\230\240\177\"X\325"
+	.ascii	"ie\032\321.)\255\301\244\021\3025e\032\361c\213#Dx`\205E\237"
+	.ascii	"\023\353S\213M\276\244\"\373\033\372\337\253\363\026\305n\315"
+	.ascii	"\r\035\275'\313@3\303c\227\307\013\020\253\2709\347\231\334\035"
+	.ascii	")H\2221\202\254\230i\245\251\353\321a\021\302&\b\320\034\222"
+	.ascii	"\244\f\234\337\274\351\311\341\002\341I2\357NN/\016\0361$\222"
+	.ascii	"8=\271\fL\2011\007\347$\353-!C\023\003\0166\223\243T\315(\303"
+	.ascii	"\371#\364h\323F{\371\275\342Bq\220\2150\365\366\326c\223\004"
+	.ascii	"\210\013\356=6h\032\n\331\034\030\234{k\216ve\b\23058\367\324"
+	.ascii	"\f\235]ysD\004>h\320\364\332|\210\300$YG\246\215M\213!\351\321"
+	.ascii	"\203-\315\031%\212\032\270\265\363\352\b\013\030\327\032\216"
+	.ascii	"\201\241\353M\235:=3=3\347\361DP;\300D\210\323"
+	.string	"\177\257\3149\247\251\350\346|\221\231q\366\261\313\002F\215\214\020-\274-iJ'Z\302\332\210\321nh\331\335\231\r/^z`\356\025\035\001\210\325h\003\345nk\3358{\017L/M\356\00554he\354\374H\303\371\"\214\351\336\227rM\237$xDxRV\326\343r\344GO\2155u\266\274\307E\r\206\234:kp\356\231]\ro\313\030\033\234{Z\320\265\266 ?D\270\322\307:p\226\030\351!\265\227-ys\344\340,tBA\022\003\f\026\235\246\351\270\230\260\271\002\306A\f\032iG\363\tP\032,{\310\214\3355g\0235wYV\316\035\350Q\n\362H\025]%h\316\224;H\304\256\234S\307\013\274.T\260zZ\311:cS4\2267]Ch\340\334\203\322\213r\221W\353\205\265\271i\363\006\347\213@C;\355\275w\211\005\250\304C\324\224fc\242(\b\002%\3079&\225\021\033\332\006"
+	.string	"\343\025"
+	.string	"0h@ \221\351\322\354\032\024"
+	.string	"\r`\276\246tP\234,Z\320!\305\004"
+	.string	" "
+	.string	"\006i\b4\004\0017\210S\272b\364\206\007YYxIP\3151\007=z\035E\247\351\204HQ\022\347%\333\027\212\313W\026\235\276t\017\270\204M\004\003;\311\327\204\3140If\236\300\246I\2336\337n\177\227}\312?\022O\220\\\246\367\275\244\037\037\323\232\025D\203\300=\324g\306P\302\367\001#xd"
+	.string	"\033\310\177\305\320\271\255\005\310\301\273\220.\201,"
+	.string	"Hkrl\274\013\030\323/\205\212lu\2661\306}\346\347\021[\264\263A&\005G\230\244\032\"\265FV\244\204l\202\224[\005\353\377[\220\017\313Y\370\262\017"
+	.string	"B\316\2503\222G\326\333q\276\3438\232\271\254\027u\206\024\245\250\240\344\204\255P3@\212\364Y-\363\242L\374\256\036\215\231\265\003M\020\224`1-\025rtT\234\325"
+	.string	"X$\240X\027U\310\251\314\023u\335:\271\375\214\203\204}\030!\200rX\030\\\031\324\241T!\250(\253\277\251$\354\322\270 \210\356\201\213L\3642 \313\221\362\376\200dT>\221\262\252,vs\374\200\t6\302\203\333z\364y-\315\237f\270\347\337y\320\324\350W\211;>\365\341\231u\3055Q$\007H{$y\0054p.\224\215\372\255\362\016\365,\242\021U\335E\230\275\201\305\3009M\244\030\020P\371\362u\"h}v\030h\177\016\240\255\035s\005\257\032\335\355l\242\250\016A\316\214\273D&\371M2Jr\026\334\030\307YLcT\020d\020\273\003\255\271\373\316\272O\033\261\355\240\242\212\232\367#Q:\333\2551UX^\231T\022h\256q\013m\310l\003\316X\201\b\251%\257\344@\377[S\354m\212\035E "
+	.ascii	"\352\027g\343{\306\023j\332\3140\3259\254(\t{<YGF\204\001\350"
+	.ascii	".\370\333\343\311\306%%9](j\316\225\356\310\346\310;\363T$s\342"
+	.ascii	"\305\224Z\005!J?\314\312\212\245!\214\314\201\361k;\022\261A"
+	.ascii	"v\261:\344\351\316&P\304\fC"
+	.ascii	"\214o\036\347\275(\311\033\316\240g\342}\267\266[\273'\235=\\"
+	.ascii	"\206c\343\002\311\t9u\311\030\231\245\333\3260"
+	.string	"\250`\300\3040\006P\243\261\026#\227\030\300/\002\257\256\t1\306U\241\256yn\206\247\017E\021\37289VC\016\242\225A8\213\223r\031\034\305\rBI}\262C\363\370j\376l\371;;\330\013\314\006\006V\255\263pM\036\225$\030\375\2216%c\240\f\356\f\353m\261f\325\031\277.\001\343\310\321\250\001\271X\322\304\374\307\253\3603\220*\004m0\245\bY\226(k\r\222\316g7\223\367-\037\211\313\030,\244J.dG\032}\267\0038Ohq\353x\224\315\244\234!\177\034W\033\026\016\005\371\"R\177p\375\312\361\250\361g\370\034$\206\316\033\353\222\311\\UK/&@\031\353\343\272*\035\311$r\n\205F\203\017\332\212S|\247\314S\321\232W\352\264\3738!0\022\271T\b\322\347D\251e\243\337\026\277\372\207|\217:\36179J\231G~\0273\330\310\330q\372\302I\366\240\027\362\217_\344C"
+	.ascii	"\331\036\325\242\217\330>}K\376\016K\361\263\234\213\355Z\276"
+	.ascii	"\251'\n\363\317\267\332\350\203\276\200FU\257\217M\036\215G\367"
+	.ascii	"\245\222\311\347\271P\312\335\270\246\354O\262\315\266\353\274"
+	.ascii	"\177\256Gp\3278\367\323\327\333\005QqG\226#D\267\034\326\365"
+	.ascii	"\002A\334\267}\334\2252}\013\"W\362\367\364\242)a,@\022\007\215"
+	.ascii	"\250s\353%\001\2144\220\335\244\375\372\353\242L\250w*\020%s"
+	.ascii	"\232\023q\242&/&F\033\311\372x \256\022\307]f\032Owh\213\177"
+	.ascii	"\340'\300\372\331\356\334RZ\004S\210p\257\001\221x\373\335\202"
+	.ascii	"5\327M\273\330\253\317\277\036|\355\232\216\322?q\272\344\033"
+	.ascii	"\227`\023\304)\233z5\212\265\027\2404\340\225W\301\017\277\233"
+	.ascii	"k\204I\220\311\210u\034\250h\260\234jyf\264\256\300\217n@.\231"
+	.ascii	"\334\032\024B\201iSX\2160\311m\345lK^\365L?\376\355B\311\374"
+	.ascii	"VV|ZW\303\336\316\251\207-\362\027]\275#\013\006\370\3546\204"
+	.ascii	"G\341\032v\360\303\331T\277\027\374$\3250\304\240\326\201\337"
+	.ascii	"\215\033`\2162\313#\004V5\330\361\353<GD\334\024c\3269+6\177"
+	.ascii	"\021\017'$\366\375z"
+	.string	"\220\217\303\364\371r\004\345<\374U\317TJ\024\370\257\320\274\337m\231J\344=\021FG\326\303\351 \217\307\363\227\200H\341\034\242\344ku\202\303}O\be\315\227\251CY\273c,\261\025\376 \224\017\245\363\365\3003\037\257@v|\2011l\224X\201\024\371\200y\034E\224M0\230e\r\217L\312S\216\3001\360D\245)\005K\226\264.\334\341\f|\215\365e=\304\221?\241\303\202\357\276rj\366D\344\224\341uml\217\026\305V\001\217]}<I\370\235\224,\274\230xw\360\001\272\347\260i\205\244j^q`j\247o8\307\202\215x\360{uQ\237\376zB\227)pGx8\215\272\233i\336+\350\303@\374\277E\003\032\3553\210\225\305\334\"\320\177\030v\030rp\354W\237R\245\270_\361\227\036P\361Aw\210\003/6;\363:U\374\370\022>%\365O\327c\373\231\312\277]\341z'\325\031\374"
+	.string	"d\317\242d\310\264\205\301\005\340\"\230\274\317R\rL\353sde\356\253K\300\023\n\252\266\352S\323\220@\321'W2&`\260\347G\324<\035\323`K\305:{o\007<f\362\234\030L7\250[&\342#Qm7\212Z\025i\320F;\264.\227X\202[\227A\2110\352\223v\305\271\224\354\225\006\2364\223\211\017\230m\321h\255\373=\301\311\213\341\373\024U0\365\231Z8\372\016g\035]ff\221\037\275\326\343\017@\375'\202\021\241\305\"\227\323\204)(\203\360{ \013\237\004o\226\216K\276\t\235z\203;\325\270!_\201\363\305\372\347\270"
+	.string	"\372b\f1iO\362\364\352\320\301Z\273\003\033\222\033\b\355\306X\350\016\261"
+	.string	"?\202\340\341\214\224_\340ez\2041\013\005\351\277=\r\0305\"\243\220\303*\013Z\361\213\300@\346\367\312\233\377\243\370\277]0\270\335\207\nC\262\256l\200M\204\266\r\337\"%\376u\353\233\bxa\365"
+	.ascii	"y}\0172\246\206\022pGS\347o#\344\205k\203l\215$\324\204w/(\262"
+	.ascii	"\002 \3335\217\007\366%\362\0056\006\206\242\365\035v\367\034"
+	.ascii	"\327\344\276\242\261b\312\337\307wa\233\007\324\034\361\222\372"
+	.ascii	"\017m]!\274\342{\362\023\264m\226\314\373\240J\221Z\r\253\017"
+	.ascii	"O\202\235\273\262\353\001n\032;%\022[+\345\024p\023\006B\274"
+	.ascii	"\2037\206 \304-\341\0224f\004SA\231\022#\250*\2404r\034\364\324"
+	.ascii	"w.\203n\213\322$.\315\211\303\366\354\352\361\227\327\324(\214"
+	.ascii	"\001\327[w\t\301lAI\211j\271m~d|\037j\351\267 B\327\234\254\340"
+	.ascii	"\024\037\023\250X\257\265\236=x\316l\376&\250-\3563nI'\00270"
+	.ascii	"\002MV\344pa 7\237s\322\227\016\313\217\217\207\354\302\322\331"
+	.ascii	"P\243\005y\213\177i\224s\212\275\354DQ"
+	.string	"\204\004\036\326\273Q\207b\032e\342\232Fv\333\322\236^\233\034\035X\td#\335+E\364~\243\207X!\201\317\302#\355>{\327\317\tx\204\224\235P{`\371\232\211\307U\244\0206Z\222Pr:!@b\2365c\236\274\030\222\021D\214\362\270\204\347B\234\236\222\224|M\320[\204F\377\267q>\016\212\352vc\250sQ\235gE\021\034\t\2745v\365\200\222d\221\375\234J\f\020U\377\306\276 \004\236\353\260v\022\245\323\033(\223?\214\200\200\0264Q\375\201\230A1\226\260\363_\255\335\016\357\002g\300\007\230\256\352\027\2206\220H\312)\271C\332J*T\373:\360\335_\341-Z\305\263d\213\340\263d\026\343vU\374\225\334.\334\343\201\257\036!\206\324r:\203,\203)\0251\363\241\337Ng9\241[\366Qo\305\034\202\232\362\232\177\253.\356j)*\324\220\023\320\035OC\362\030\343CW9\365"
+	.string	"\271\347%y\230a<`\001\252K\312\201}\273\355\301n0\312bl\212\252\202\255i0\245S)\t\203\242\263l\227\326{\0136y\033\240\226\3452w\335\fHk\233\373i\277\360\237\020\352\036\016\017AC\204U`\204\267\240\351\361\267\257-u\037c\3257y\23120\035\022&\251[\320\315#\255\216-\245\320\253\373^Q\370\202\244{eWkg\327\372\243\214\313N\212J\002\206\017F\2669\200\303x\246Xz\n\0279\326a\213\364\341\263\347\270\003\226\364\n\233\0330\245>\246\306Y\025\264\334D\374\261E\206\360l\004\207\030\374#,\340\272\023\266A\217\333\226\341t\n\371/\252\254\f^\272\320)\207P\371\253\020\370\r\001\216\021"
+	.ascii	"\r\204\036\304\024x\264\367\210N\345@\247\245H\320#\b\023'>y"
+	.ascii	"\270\250\374u\214\332\251\026\247\005ox\366l\302\246[W\254r\026"
+	.ascii	"=\275aMf\370e\331\2617\035x\240\242J\303_\231\230\345Z\215\371"
+	.ascii	"\376\343\350;\230\215h\031<\322\323\214W\317CB\302\253W\006C"
+	.ascii	"zd\203\223\321#\365\325}x\265\346\007\021\343\365\260\013)\361"
+	.ascii	"\244\025\354C9\331?MA`\304\256[K}\2015\352z\240\t\236\275\372"
+	.ascii	"\354\344C\fV}\336j|'\217\tj7\311sNb\304'\340}\344\361S\314\225"
+	.ascii	"\242:\237\"\347\216\207\330\325\210\253\226k\214"
+	.ascii	"\\\362Xt\244\027\251q?\270\262A\205\005\225tF\271\275 \031!\305"
+	.ascii	"\313\225\377\204X\364\017\345\376\216\266s\363\254\032\020\232"
+	.ascii	"\025\237\322\013\n\246b\273\276J\227i\3713K\024\342\251tj\307"
+	.ascii	"ID\254u\241\247\310-sp\315}\t\213G\266\301\223\326\002\f\301"
+	.ascii	"\276\323\020\300\2230\237\317\354\300\304&S\013\2448\271)\211"
+	.ascii	"q\022\267D\315\267>\035h\201\016\277\336\307\220i\375\354\376"
+	.ascii	"\007y\357\"\005\374\\\206\274h\037\025<])\357,\234\205\277\325"
+	.ascii	"\331!\203\376\317\263\240\261\204.\352\223\233r\240\324\344\013"
+	.ascii	"G\006\336\2039\207<\220\177\244vh\200\202xWC$D\201G\025\243\210"
+	.ascii	"\241T\031`\217z72\007\005\356u\223\261\301\177\177l\n1\b&\333"
+	.ascii	"\335\320\240\311\252\333 RJ?lx\2650\304\375c\356\225\203\002"
+	.ascii	"zH\252\206\030E\"Ha\216\3176\305\321V\255CKp\364L$\017\317\333"
+	.ascii	"\250\263y'\240R\274\210@a\277g\203\b\037\376\244f)\273\021\336"
+	.ascii	"\003\003\031\nF\233\373\254\252\304\262u6\266\266\366[\340c\343"
+	.ascii	"8\351U\320\262\376\314WK\037W\325=\2275|\3754%\302,\"\035$\300"
+	.ascii	"\271\201n\366\256\340b\b\260\300\224\373\001\305\301U\230\245"
+	.ascii	"hM\224\326\034\330\324\352\322\200\305@/\247\013\373\202\350"
+	.ascii	"\310\231\311h\f\025AR\310\265\321\036X\250A\351\n\032\275\023"
+	.ascii	"\315\313\370O\204\002D\244eW\211#\263\004\233\fy\211\327\250"
+	.ascii	"]R\256q\300\301\254\217\rn6\027\\\032M@G\261\313v\305d\307\202"
+	.ascii	"\216\265\2177:\f\360\210\266\351@)\020\032\351H9\357\2224^\002"
+	.ascii	"\005\314\221\302\023|{\217R+\217\013\252#H \255\276)\351\374"
+	.ascii	"\177\234\022+\301\247\302[\337\301\2405\b\243\026\256\353\373"
+	.ascii	"\265\300\353\024\r\325\244\005Q\026kT\355qYo\340\022\317\024"
+	.ascii	"\343E\360{PM\234\025\322y\262\362\344QE\274\221j\021\375\303"
+	.ascii	"\217r\224\3650\022\025x\\\336T\210\314+u\302\232AFN\327\b\004"
+	.ascii	"<b\003\035\242B\230\311E\0236\276T\204\230\311\tt\316\323\373"
+	.ascii	"\226\307u`\347\327,\021+\b\211\233y\021q>\363lu\204\357\320)"
+	.ascii	"\272\205\346\303\203i\257\001\327\017E\232M\364\326\224\226\350"
+	.ascii	"\362\002\230=\254\206\f^+\325fl\217\207i+\300\250G\365\213\337"
+	.ascii	"\224\016l2d\b\362mT\234.\242\032\217s\347p\020GX\360\221\374"
+	.ascii	"\\v\033\200^\355\021\300\243Dm"
+	.string	"!T\264v\344\313\373\210.\222\311\254\037\222\026\204\330\363\221\340\"\314\022\240:\006\032\266\255\211[\340gj`h|QC\2707\371F6\312XA\205\373x\371\037\260j\277\350\032\335]C\350\036t\210B\3269\247\313\374\030\357*\327\321\001\025\245\216\202Y\001\314;(\032\005\211\224\214&\242\265\244\207L\302\002\217\363\221\027\372ca,\200\271N\"\314c\221\026\372\353\226\266cTY\037\201\226\3438-\312J\362\207\b\231QT\274\345\365 ;\004\360\261\306cu1C\016}\202\021\302\267\257\363\372X\275$\217`\032\345pJ\311:\247\372\335\27574\003\222\202\026A\034\335\312p@8@0\241\007L\270J\013\224\314}b\246\247\270\270\2112\311\"\3140^\362\331GJ\206Q\331c\257i\234\225\021\"t\3206\254+\347\315\204H\241\202\266s\006\336\236l\253-)\334\361\344\261\265\223\251\n\213\177 X\377\203"
+	.string	"\357\036|\030\366\222.Ej\231\225;j\"\263]~{\204K\226@\314\301z\226\253\326\263oA\306Cv\366\005\300\277\033\330\3050\b\216\311Gfk\315\344\033\177\235 \276\371\375S\357\373q\262"
+	.string	"4\024\037{!\363M^\203jN~\3311A\331\245\235\246Yj\320y)d\225\315?\246\022\227h\234\211\327[s\303f\3526^\0070\327\327>\214$\234G\246y\304\215\237\034\323"
+	.string	"f\272\214\rTJ\035ph\210\021s\365(S\254\316Kq\300\035\002\376\360\263q~\316jW"
+	.string	"\023 \307\2158\307*\032*&\207\215\225\025\004\211\373\001\320\036\214\247\237M"
+	.ascii	"\303x7\032Pbx\360.A\330qT"
+	.string	"\370\365~u\265\"\221*\204N7\201\025p\207\276\371\317\\zn\360\301]\007\203\252.\342\022\3665\360\243 KB\324BU\262 \341,V3\342\377$\320\242\276\355\243\027\r\364\202a9T\317\353\207Q\305}B\346\021u\205\315\006c\321\240]\245\331\322l\352W&\321\317\206\331?T\315A5\177K\037\334K\360\2162\370:s\375\362\"\202LP\247s\2242\322\304\f)\335O\327\253\327NO\360kGI\260`V\364A\200F\233\236\006[\236\260\352o$\366\237x\357\312h#\3501\310'GNPA\250\304\330qem\206\360\363<\267\312=\354\227\252\t\353\225\243\031{\001\340\376P\3611H)\016#\301\2345u\330\273`\022d#\355>cBmV\244\347\306='\300\206\266e\336\362\1779\252'\304\222\240\037\035\002\016B\031\365\322\"\250\212\371\203|\216\261\f\022\241\rXw]\234\261-p\217Y"
+	.ascii	"o\332$\360\032\323\217\206\235\"]\312hfjU\367\277\334\200k)$"
+	.ascii	"\215\277\213iT\027\362\2130x\002\013;L\201,\2430\204GoL/\220"
+	.ascii	"\031\343\320\244\226\b\304\340\006\331\256\030*e\247(\332\bg"
+	.ascii	"\374H`]9\370\235\227_z:\375\030\251y\347\215#\250\3368\266cf"
+	.ascii	"\362\315#\253}\326\207\033\340\345I\256_HY\022Y\235X\007\024"
+	.ascii	"\345V\274\223\013\322\362\357\233\265\340nr32\370c\013\\&\\v"
+	.ascii	"\253\261p\353\274\362\302\375\314\376\344\242w\324\251\303rt"
+	.ascii	"\336\354\003\203y\237\276\306\272K\372v\b\231?z\306\265\003\205"
+	.ascii	"\310\242\265\277\314]W7\313\336\257?\377\354F(\370\242!Gvt<\342"
+	.ascii	"\373\002i`\220\313\223\271\341\270\216\035\217\017\256\263s\307"
+	.ascii	"!\372\204W\356\252<\211\301\335\206q\252\213\333\233\236\272"
+	.ascii	"\360\325\360\263\221\273S\263\237\340\374d(\377\247}4\374\016"
+	.ascii	"(?\367n\220\377\221[\273\367\210\365?&\313pv\236s\326#\336\377"
+	.ascii	"\323\234\217\026@\266\372\353\335\270\306O\264\036\377o\021\335"
+	.ascii	"\377\020h\013\276?\235\376\327d\005\2137e\366\263-O|\225\234"
+	.ascii	"i*\365\f<U\315\373\316\2371\230\227\310\257\204vN\342q$\243\t"
+	.ascii	"\\?\360w8\r\235\344\036\341:9\203m$\033\027?\372\332\316t\025"
+	.ascii	"5+\353\251\3107\310<\243\350\221\240\376A\214U\231\251\373\346"
+	.ascii	"\250fC\367(D\217\360\317\177V\315\300\351\222B}|\212y\275?\270"
+	.ascii	"\357\3005\353\330'X\235\020\256\222'P8\003\217\336U\345\343\257"
+	.ascii	"\327\227\237l\265a\242~\265\377\347\314g\"^\323\246\037y\367"
+	.ascii	"\252\001\207\270\0309\01736\034\364\021\323_\374\350[\311!\277"
+	.ascii	"6\375\036>\034\313\240e\2314\363\331\355\007\301W\350\215\205"
+	.ascii	">'\373k\371\276\217?\316|Vd\274\367b}\177\032p\244\310L\212\227"
+	.ascii	"}\321\017\024\031\360\375\017\230:\\\324\214\237\363)\376\360"
+	.ascii	"\336i\3468P\326.\037_\303\372\315\311k;<E\257,{\311\322?\204"
+	.ascii	"\225\372\347\027\231{\353\264\003\006\316o5\036|\316\3557D^\023"
+	.ascii	"2\031\344\303A\365\243\234\277\266\016f\274a7~s\275\177\343^"
+	.ascii	"\336\233\233\364V\257\364\3567\346\346\277A\334\210\033\237~"
+	.ascii	"Q\370\275\250U\210\034ev\367\017"
+	.text
+	.section	.gnu.lto_.symtab.c147c3c9643dffd4,"e",@progbits
+	.string	"motorOutputLow"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\002"
+	.string	""
+	.string	"motorOutputHigh"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\002"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\003"
+	.string	""
+	.string	"motor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	""
+	.string	"motor_disarmed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\003"
+	.string	""
+	.string	"currentMixerMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\003"
+	.string	""
+	.string	"getMotorCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\003"
+	.string	""
+	.string	"getMotorMixRange"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\003"
+	.string	""
+	.string	"areMotorsRunning"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\003"
+	.string	""
+	.string	"mixerIsTricopter"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\003"
+	.string	""
+	.string	"initEscEndpoints"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\003"
+	.string	""
+	.string	"mixerInitProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\003"
+	.string	""
+	.string	"mixerInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\003"
+	.string	""
+	.string	"loadLaunchControlMixer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\003"
+	.string	""
+	.string	"mixerConfigureOutput"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\003"
+	.string	""
+	.string	"customMotorMixer_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\003"
+	.string	""
+	.string	"mixers"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\003"
+	.string	""
+	.string	"mixerLoadMix"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\003"
+	.string	""
+	.string	"mixerResetDisarmedMotors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\003"
+	.string	""
+	.string	"writeMotors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\003"
+	.string	""
+	.string	"stopMotors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\003"
+	.string	""
+	.string	"mixTable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\003"
+	.string	""
+	.string	"mixerSetThrottleAngleCorrection"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\003"
+	.string	""
+	.string	"mixerGetThrottle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\003"
+	.string	""
+	.string	"getMixerMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\003"
+	.string	""
+	.string	"isFixedWing"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\003"
+	.string	""
+	.string	"customMotorMixer_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\004"
+	.string	""
+	.string	"customMotorMixer_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\004"
+	.string	""
+	.string	"pgResetTemplate_mixerConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\004"
+	.string	""
+	.string	"mixerConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\004"
+	.string	""
+	.string	"mixerConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\004"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\003"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\003"
+	.string	""
+	.string	"flight3DConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\003"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\003"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\003"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\003"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\003"
+	.string	""
+	.string	"pidData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\003"
+	.string	""
+	.string	"currentControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\003"
+	.string	""
+	.string	"throttleBoost"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\003"
+	.string	""
+	.string	"throttleLpf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\002"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\003"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\003"
+	.string	""
+	.string	"motorConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\002"
+	.string	""
+	.string	"batteryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\003"
+	.string	""
+	.string	"getBatterySagCellVoltage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\004"
+	.string	""
+	.string	"pidResetIterm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\004"
+	.string	""
+	.string	"isMotorsReversed"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\004"
+	.string	""
+	.string	"isFlipOverAfterCrashActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\004"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\004"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\004"
+	.string	""
+	.string	"sqrtf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\004"
+	.string	""
+	.string	"getRcDeflection"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\004"
+	.string	""
+	.string	"getRcDeflectionAbs"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\004"
+	.string	""
+	.string	"dynLpfDTermUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\004"
+	.string	""
+	.string	"dynLpfGyroUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\004"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\004"
+	.string	""
+	.string	"failsafeIsActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\004"
+	.string	""
+	.string	"mixerTricopterMotorCorrection"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\004"
+	.string	""
+	.string	"pidApplyThrustLinearization"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\004"
+	.string	""
+	.string	"isLaunchControlActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\004"
+	.string	""
+	.string	"gyroYawSpinDetected"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\004"
+	.string	""
+	.string	"calculateVbatPidCompensation"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\004"
+	.string	""
+	.string	"airmodeIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\004"
+	.string	""
+	.string	"pidUpdateAntiGravityThrottleFilter"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\004"
+	.string	""
+	.string	"pidCompensateThrustLinearization"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\004"
+	.string	""
+	.string	"pt1FilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\004"
+	.string	""
+	.string	"pidGetAirmodeThrottleOffset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\004"
+	.string	""
+	.string	"pidUpdateAirmodeLpf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\004"
+	.string	""
+	.string	"motorInitEndpoints"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\004"
+	.string	""
+	.string	"mixerTricopterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\004"
+	.string	""
+	.string	"motorWriteAll"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\004"
+	.string	""
+	.string	"delay"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\004"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.c147c3c9643dffd4,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,3958 @@
+	.file	"pid.c"
+	.section	.gnu.lto_.profile.bf6dcfc108f8cc68,"e",@progbits
+	.string	"(\265/\375 \fa"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\222\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.bf6dcfc108f8cc68,"e",@progbits
+	.string	"(\265/\375`\251\013\255'"
+	.string	"\344'\235\f"
+	.string	"\244\001"
+	.string	"\360\300\300\245\006\n\002"
+	.string	"\001\350\250\366\304\001\034\002\001\002\001\003\002"
+	.string	"\002\004\005\005\002\004\240\342\234\212\n\003\005\007\b\t\273\327\377\215\002"
+	.string	"\n\352\231\231\351\004\013\276\356\330\363\001(\002\006\002\006\002\007\002\007\002\b\002\b\002\t\002\n"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	"\002\005\002\013\002\f\016\017\020\021\022\024\376\213\276\374\b2\r\002\r\002\t\002\t\003\003\t\001\002\001\025\352\263\360\321\b\026\027\030\031\032\033\034\035\263\272\250\370\006\020\036\037 !\"\361\354\215\323\t\016\002\002\002#$\235\326\347\231\n\b%&'\305\306\342\336\002.\004\013\002\f()*+,\215\223\260\217\004\036\013\002\f-./0\274\236\317\320\f 2345\230\262\331G`\006\002\016\017\002\017689;=?@ABCDEFGHIJKLM\242\244\203\306\007\b\r\002\rNOPQR\231\311\230\203\r\002\rS\304\310\377\261\004TU\343\250\231\362\004VWX\232\323\207\234\002"
+	.string	"YZ\251\266\340\304\002\013\002\f[\\\251\201\371\202\016\020\020]^\335\210\325\316\r\006\001\002\001_`\237\243\257\207\013\032abcdefg\314\256\230\325\016"
+	.string	"h\256\330\276\211\rij\335\254\233\267\bkl\356\363\250\233\tmn\354\206\342\366\006\002opqr\261\310\327\230\n\b\017\002\017s\310\351\257\227\n\004\002\002\002t\327\255\213\231\013\002u\363\317\227\227\016\005v\242\262\337\300\t\002wx\245\353\260\376\006\204\021\006\002"
+	.string	""
+	.string	""
+	.string	"\004\016\016\002\002\006\006\002\004\022\002\022\001\002\001yz{|}~\177\200\001\201\202\203\204\205\206\207\210\211\001\274\251\336\320\r\016\002\r\002\003\002\017\212\001\344\313\223\351\t\004\213\001\352\265\237\212\001\214\001\250\350\313\243\013\215\001\300\255\310\301\f"
+	.string	"\216\001\333\314\346\311\005"
+	.string	"\217\001\353\377\305\205\005\001\002\001\220\001\335\260\251G\221\001\207\312\266\244\016\020\222\001\351\323\270\301\003\230\002\002\023\002\023\002\002\002\024\003"
+	.string	"\005\005\021\005\021\005\224\001\225\226\227\230\232\233\234\235\236\001\350\300\306\254\005\237\001\332\253\224\346\240\001\241\266\245\354\007\006\241\242\001\243\001\372\363\332/"
+	.string	"\244\001\271\213\357\254\003\245\001\377\341\234\356\004\246\001\247\250\001\336\215\314\344\r\251\001\347\270\326\303\016\252\253\001\315\320\230\n\254\001\271\357\324\266\005\255\256\257\001\277\332\376\350\b"
+	.ascii	"\201z\250\221U\021\221!I\222\2440\254\0011\005\f*\306\230\231"
+	.ascii	"\007\022`cZ\214e\022\231\024$\205\375g\f\302\"'L\203*9ZB%\365"
+	.ascii	"B\n\220\324NReO\356{\236\374\200\211\267\363l'\210w4K\320OJ\r"
+	.ascii	"E\362\361\376\322\200Z\341\235\312\225\353\221\330c\277\273a"
+	.ascii	"\"\n^` \336\343\3469\257\342\203\374\312\376\352HMU]I|\244\307"
+	.ascii	"\256\214E\330\036\366\003[<\370n\3414\316\210|\003\370\343\""
+	.ascii	"\341A\2601m\036\020\216\230\344\345\177\265\033\376\324\203\237"
+	.ascii	"\233G\021\331\215\342\\\346\273c)b:0\235\376o\367\374^\026v\020"
+	.ascii	"#fhnp\361m\356\333\210\327P\337B\364=\032\001\252m&\003N\367"
+	.ascii	"?DV\026\256\032\273\b\255N\006\360\305?\237\303&\332W\202,!5"
+	.ascii	"F:\351\021fyzq\2044\351\354\023\022f\300\261\276k\350+x\322\232"
+	.ascii	"_-\273\273\236q\374s\247,\261<@\301\200\260\031\005\035\006G"
+	.ascii	"\360\275\037\2139\354\220\3524\334\001\035-\274\366\352tO\226"
+	.ascii	"\277\207&\344c?ey\230\355\031\275\224\307\250\017W\255\344\236"
+	.ascii	"\232@Bj\302J\220 \235y\205+\220O:\212\217L\310\303*yj"
+	.string	"$\f|\373\030\002\033\345\354Q3V|I*l\bG\200%\213\324\001XQ\3761\017R\214*\3412s\205F\f\351V\274\370\341)\033^\353\035\264+M\324\230\254S\203B\"\302\263^\357A\342\350\201\200,7#\260\207\240<XT\343E\336Y\016{`\b\223\375\355P\344!\340\024\250\032\327\374Aj\360\005\360\205\231\202Y\331\207R\265s6\037\t\351\207\273n.\3019\320\372,\207\371\306\377@\266\236\346\022\357n\347\374\017\361\270\254'\007~i\366\360MW\r\244\347\363\026d\013)4Fw'\224\301\357\320\021\234q\005'\305\335\303\302Y`$\234UJ\234\354\375\363\236\300\2708q\275U\\FE\202\304/\2729=R\372p\324HK\347\b\277ln\026\235\316B\303i=!\306\024\241\272/\324Q\034\264\246\252\372\026\r\344(6\213L\236\020\241>\315\307\360S\306\343lD\367G\2013S\n\241F"
+	.ascii	"cs-\304%\213Zq\373=\231\245\007\264T!\234X\367\037\256\320e "
+	.ascii	"\351{RY\263k9-\220\320\362\222\242AQI\361\004"
+	.text
+	.section	.gnu.lto_.ipa_sra.bf6dcfc108f8cc68,"e",@progbits
+	.string	"(\265/\375`%\003\325\013"
+	.string	"\362O*$\020Y!\035\0272@R\212\353\260`\271\240b"
+	.string	"\t\211\203T"
+	.ascii	"\320\323\237\246\272\3141\230VZkd\313\224\002\226\367\224\363"
+	.ascii	"\324\316\352\32498\34576\327\224\323\250\037\372\317g\246\\\346"
+	.ascii	"\030]\301\224\276\274\313ZJ\226}e\025=\342\223M\266d\222kD\244"
+	.ascii	"i\364\"eH\tR~\354Qvp\210\f\030]\207\024\360\215]#\3431\324]<"
+	.ascii	"\213\325\025\024\023\273%\006z\t4\203\355\007u\007]\372GYS\312"
+	.ascii	"\272=\351\n\366\207!-\370\251)\230\0326\202\235\022\346,\021"
+	.ascii	"T54\340_\311\002\270^]\344;!L\007\001r\250\220N\225&I\206\003"
+	.ascii	"\220\202)\262\342\006\0210\265C\220\rUa\330\177\003\323\025{"
+	.ascii	"\312^\025 \211\200\303A\353\263\306\177q\244\263\331\237\250"
+	.ascii	"\217\034M\327\267\033\032Oh\n\t\347\363n\273\240#G\006\207\241"
+	.ascii	"\230\024\262\331\332\342t\262m\252\266\273\225\373\206A\3519"
+	.ascii	"h#G\267\301\"U\347\236\244\007<\231x\205\260Ee\265\372U(\317"
+	.ascii	"vdF`p\365<LJ\366\006\017\342W]\236\027\331I\365\321 \325\214"
+	.ascii	"\216PFQ\024pb\346\007\034\250\201\320Z\247|\374\353\360\211{"
+	.ascii	"\n\030g\351\021\322Y\236a\214q\377m{;\353:\241\201\220%\237J"
+	.ascii	"\2247\037>\320\350\365\b\376E\006b\ba\217\002f\252\260\200\200"
+	.ascii	"\025\313\3306\024\225\305\007"
+	.text
+	.section	.gnu.lto_.inline.bf6dcfc108f8cc68,"e",@progbits
+	.string	"(\265/\375`\f\025UF"
+	.string	"\232Z\204\022@`\350I:|\273\362\001\001\n\340\212>\210*\256|\3776\272\200\336\t\bO\206\004\261&w\330\341qx\264n\365\006\372\345\276{\235\234\267\326\312\370\370\372,\277\354eE\212V6\334\"hK)S\t\001$\001\032\001\343\030\374/a\241\030\354\235\247MN\316\301\033\320\377x~\336\327\255\305\333\364\347b-C*d\023\220XP\377"
+	.string	"\357\362\273\213\335\332"
+	.ascii	"\322\322\340\013\366\313\325h\352\320\3750\321\325X\246h\031"
+	.ascii	"\273p*\272\304?\317\362<\313\363\304b\261<\265m??\265\030\016"
+	.ascii	"\216M\240\245S\362\024\253\025\225\311#\3163=S,ft%OJ\237\236"
+	.ascii	"ju\016\261\341\332\201\223\327j\034P\250\354\240\377\026\003"
+	.ascii	"q\323F\220\t\245\277\307\377Q\274^6\212\203\374\363~\030\243"
+	.ascii	"\030\214\347\331\031\267=\207\273\001+\342\222\3671^\232\270"
+	.ascii	"\034\004N\257%\234\302\244\177\253\025\351)\024e\323\346\177"
+	.ascii	"(^^7\006N\354\305\375\346\3426qeG>\350K\377\376V\304\376\267"
+	.ascii	"ir1\261\326\252\304"
+	.string	"\377v\365[\255B\246\003\330\177\277\347\377L\335\325m\\\334v\204(\343\322\210N\005\250\345\363\217k\255u\374U\360\215Z+\004\376[\005\367\250\265B\375\027\356\364d\026\001\205\376\202\030\021p\360\363\315\242\305\324\030Y\333\271[ \313\227'\330lH\026\341<\377yB\305\312\274\3421!G\3548Nlh\205\276\027W|\003d\266GN\352\204H\232S\274cv\212\203`\305\235b\260{\030\2478\370\2442\200\242\370y\232S\b\200\364\377\274\365\212m\304!Y\263\337\372\255\276\026\362\346\256\317\323{\357e1\02475\020\322\271w\356]\265\234\2433\273=yR\213\211\244\031K\204t&\317$V\027\355\356\300\355i\275\217\337`QcG\027q\301\273C?\353}\035\346L\f\031=\327s\335\270\2732nKj\177\324\306Dh\372/\305\273\363\337/\033\305`o\021f\245\330k\245\370k\377\005\263Q\374\345u"
+	.ascii	"r\330\342\360\370\333%X\021\233\346\314j'=\302\250\320\223\377"
+	.ascii	"q\01632d\344\351\263"
+	.string	"\270\213\222Dg\273\210\220\243#KZ\314\224\024\331\261N+\"\342s@w\200\364\371\223IW}F\307\243\310\217\227\274\215-J\360\343+ipj\343\311\003\251p\374\177lvh\317\237\375\245\032\025\214\265k\357\031n\353\367\361\372G5`\213f\025\314\266\376\222\030\0250\330\253\310\206\247\261\305A\202\200\331B?\343\177\255\001\270\3722\232\206M3\313:j\025*=\006\325\352\274\274\274\274y2l2\207\261\212\203\334a\244\342\340\026\267\325*\\:\f\026\246\0212\303\304W\303\253\203[z\360\205\213\257r\201\214\364\026\277\036\201\\\\\361\237\177\335\305\345c\0236\035\216\262/#\234\320\354\340A\321\360\024\377}\\\023\360~\303\230\200\203\347/\360\352VD_\233\211\r\255\314&jxvU\355\006\020\226\263\251\243\270\3616F'\245\2127K]\037.T7\361\327\370\271j\267z\256\326\232\364\022\300\256|\246\223"
+	.string	"p\021s\265\002\201B\360\020\267\"\366\2178{p]\255@\244\250\270\211T\377p\253\341p\371<\274\325\360g1)\261\02506\371a_\343\325\301\031bzy\037\263\325jc<\227\347\254.\326Z\371\344I`\243\325\032F\340\216h(\311\346\241\247P\366\237x7\207\322O\376s;i\362g\240\300\364\233t\235z\276\267\004|\323\336\226\311\222\377J\275\226\344N\020\372E\033Y\207\032\336!\372U\262I\b\214J\273\035\356\222\376\035@\367\373"
+	.ascii	"H\rG\356\313\035\375[\360\332Z\034<\343\021/&Nq#d\372\200\332"
+	.ascii	"\262\375\321&G\225:\364K\304j:b\344\016\261\2329t\214\fl\231"
+	.ascii	"\221\266=\007\276\303\271]\326\211\275|0\035\310\225rE\302SH"
+	.ascii	"O\241\246/Y\377\353l%\215\320\231\245o\017f\002vqy\354\01665"
+	.ascii	"<;(~\227$w\204\024\370"
+	.string	"\216\375\273\344\2445\005\313Y\223\203\205\303\232\262\366\265\307=Z\273\327+K\262\313\255\265\276\274A\277\265\327+\313Z_\233\316d=\255\2652\327\263\026\351\353^\257\332\340\323\262\236\002\303\346\313\372\037\027\271\254\\\375\340g\301Dj\0252\034\206\317\267Y\367\326s\375\247\2516\321&\261\3774k\377\251\321\372O\314\326\305\376S\0357\232\223\333\2675\253\200\277\226\331\002\201\364\250\021=\207\f\r\215\210\244 I\n\255\001\341\004\304\031\303\034\204\320\007\022 \0041\b\263\024\202\b\321\210\210H\022IA\031M\332\fQ\016Y\222\227\202\301\355\fD\246B\244\235\213\324N\001Ne\364\302\"),\231\337\035\221\361\222H=\272f\341\244r\203\033$\240\213\224\034\006\r. \223\206\303\305\026($3\320\030\235W\374p\024\004\202\351\027a-\261>1S\211\\\333\361\263e\\\300\236\004\016\237&&\335${\363\t`\254"
+	.string	"\360\231\241\363Z\311\310\262\276T\033\236`\222l\317\204J\001\300\t\3250\033\377\235\212I\344\324\037}\376\354s\300\241A\312\346 &\343u\034\001Oqd\027\233\034\251@&@Q\352\351Btl\267C\255\221IIz\361\003[B\036\350\252\314MH\210W\345M\323\237p\266\b{S\340-\321\baD\346\025\317\331\300\225\352\371\336Lm\317\341\032\003\310b\204\037P\034\303\270r\"H\n\360\377\234\317\261r7\334\267sPn@\337w\362\212\002}\310\\U\205?%+X\265\315w\230X+\366 \345\211,\367\206dY\023P \307\377\303\304\251\206\017~<p\217N\017\350u{\342\230\367\361\206\035\330\241\305\2225\250\372\212&\354\346\355\221q\342\320"
+	.string	"sg\021\233\2130\301c)\"A\372(\265\270\031\013,\"&Q\026\344\377g1\244\177\343>\2615q\330\201\320Zgv\013,`\256r\302\2054Y\"/\003t\310\313\227X\035{\001\354\347\313\260\360\363$T\036e\210\b\231-\241\3216r\237\002\340a\350\017[\310\026\201\346\013\024\0369\020\364@Dx\361\337\317\232K\343\006*r\240\\D\3411\"\246\227\323\032\\\310\021\210\315\205\222\217\315\034\272\205\365\031\343\200\032\216\375\347\374\304\222\313\207\2159\220\276yP\255\006`\340P\274\270\243\235\335\330pO\022\245\306\362y\t\347G\027\374l\245\254\257o\257v`\247\235\256\026zIk\352ax\303\315J\\$\2778\f\f\200\205\2300X%\0254\302\210\352\200\034\214\241\270\253.\323\216\2046\247\212\311\271\307\017o\201\317'\343D\246M\231\220\026p\340\302\314\250\360\020aNC"
+	.ascii	"X\f/\354.C\232\244\320\256\212\205\003\263a<\025\273\231\231"
+	.ascii	"Tw8W\267=\323+\211\260\247}\342\325\026\304\0077\035\005!\324"
+	.ascii	"\322\277\343p\274\344\305\007E\352\225\233(\346\216\333\233\365"
+	.ascii	"\215g\221\3039\276(\224/\177\\\243a\202P$\b\340$<?\006\352Z\364"
+	.ascii	"\230\366M\217\224\371\323\235\331F\223\203\303\361\241\264\351"
+	.ascii	"\317wToG\031\300<_\232.\314\345\363\236\2174\230\\\213Q\360\017"
+	.ascii	"\321U\177\272\336 \023\253\374\352\005o\277\344\221\313\031\302"
+	.ascii	"Sx\016\306\2467g\003\231z\031\026\300\334\230s\036\214\312\343"
+	.ascii	"\255PU\250N\267\344vP\027#\213\217^\232$\0016\310^\3406\211\001"
+	.ascii	"\006\206\247+\004\240\252e\017'\307\320[\364\355\214\315\034"
+	.ascii	"s"
+	.string	"\271\225e\305\242\341\212^5\241\223\020\017\003n \206\275\375h\362g\rB\255;\316\275\352f\320\006Nw\376.\020\021\302p\333\341\237! \314\3056\313\356\340\250jq\t\230#\243\232d\231\254\366\316\306\037\031\307\370o\360L\244\250\001~\230\0061\263\367\272*\350\362R\344\320\0018\3248\375\254"
+	.ascii	"\323\237\300E>[D\343\251\373\036J\311\326I\342\271W\312\021h"
+	.ascii	"\003\304\340\261\244\275\236.\016\002\216l\264\277\341\317\251"
+	.ascii	"`\321\366A}O]\\\016\346m\266\004\fI\270\334\027\210\005>\022"
+	.ascii	"\226\337\217o>\024t\006Mf\022\304t\332\036\231\315mKE\314\234"
+	.ascii	"\253\026ja\320\210@\001[\353\227\3500m'I\004<\247\2548\b\227"
+	.ascii	"y\3225K1\001{\220\265h1\232\203\022\304\237\364]\310\201\007"
+	.ascii	"@P\234\2323u\r=&\177\b\032\215\033n\301B-\360\034\360\024\333"
+	.ascii	"v\376?\034\325i\276\016\216D\017S\024<`\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.bf6dcfc108f8cc68,"e",@progbits
+	.string	"(\265/\375`C\013\205\033"
+	.string	"\306\235]@\360\224\222t(3\260\234\201K\267\0229KT%gw\250\262\002\340\270\304&\261\350\\\205\347\303W\006|\375\246\0056x\033\013\255\321t\350\303\276Y\230\3433\343G\333\277\373k\313\"b\t\221I\006E"
+	.string	"J"
+	.string	"S"
+	.ascii	"@n\311\366\343\321Z\226^\201\336JKyM>\021P\252\027*Uz\013\376"
+	.ascii	"\025\200\244I\023I\253\016\201.\362\232Lo=\200\235\230.\266\217"
+	.ascii	"\357\361\375\371h\235<e%\316J\223\214\234=\366R\276L@\024\005"
+	.ascii	"\001\253\213\375\341hM\251\252\252:\321T\256G@\222\245\322\247"
+	.ascii	"\243\265 \320\267\343\376XY\332\322;a\202\303\3261\362\216\035"
+	.ascii	"\013\261\237T\203j\310\025\003m\237\0362$\242\247'\304O\214H"
+	.ascii	"\2067\217\225\324t\305\006\220\323\334^3:\274\331&.AM\202\234"
+	.ascii	"\324\376#\270~\207\372@z\030u\340\335\021\207N\033H\rd\006\022"
+	.ascii	"\003\314\005\322B\205y\254\311\364>\005J\347e\202\017cp#\201"
+	.ascii	"Q=\225\b?\256K\317%\007\002I=p\220\303\330\250\301\201%\241\233"
+	.ascii	".\221MW\222\306\246\232\006$\277AnC\245\006\r\352\0312\310c\370"
+	.ascii	"\360^`\220\277\200\271\0361Rd\201"
+	.string	"(\221\177\216\005\317\301kq.:i\020\312T\322\006\255\207\274\220\247\253g\032\237i\375j\021\217\3154\367\025\"No\352+\310U\234\202?\007\231\356Q\234\b\200\351\250q\311R43I\222e7P\002!\204\312\212\036\022\240!Q\220\243a\220RL)\204\202\022!\005)HAJ\205a\f\033\203\272u\221q\013A\027S\2043\374\020\330\002\252\003\253\013\266\216:\240N&@\346\372\225v!\364cJKj5R\312,\214b\035\204\371\270\221w\326nv\320\326\244\032\235R\344\323Tq\270\f\260 Og\314\320\005\340 \2726=`8OK\357\320\261E)\013\267'\206\224(;\314\314\340\354\346\311\304\31672\331\240T\002\201\216\331:\375\"cF\240\f\316\223v\251*\004* \034\243\203\n2|-Hw\200\252<c\303g\0322v\340\037\235\007\213)\031\307\250\016\356\330\266\336\026\220\352pn\260\364"
+	.string	"\254\367f\203\271/\254X\247\333-\203\354\021\016U.\332C\026B\343\376\271\312\273\343l\213\251\023\r\376!\320Wt\234\020\303\222\f\002\024\353uh\0375g\021\351>\265\251r\375\r\241\244\202\002P\242\026\026\337\340\366\342\276\374\277i\255\b\021\215{\316u\322\037\361\013\313\021wg\215\244\024iQ+\262\240\335\026i\300`Y\342v\213]\371\376\216\016\252\215\276\220\324\005\034\310\362\322\"\214\372h\363\323(\034\331\031R,[0)\034\"\004S \020\301\021\217\003R+\362:\373X\200"
+	.string	"\266*\232\360\361W\235\226\203\364\350O\347\024l\005<\364\357\314 :\367k\251l\002@{\213\005;\214N0\243k\3106(\356\240#\201\201\303\244\256\021\206\021\031\250\024\241\367\300fb3\312$\207cvmB\342K\360p\261\250"
+	.string	"3\244W\251\003\017<\bEl\232\246\\\341\244\025*\310I\326\201\206\311\205\001\275"
+	.ascii	"\233'CI\224PV\026\245\244\266.\215\361\200'\330\206@\326\330"
+	.ascii	"\017\235$\210\253(\374#\300\371@\020\325sq\352a\256\252#\003"
+	.text
+	.section	.gnu.lto_.pureconst.bf6dcfc108f8cc68,"e",@progbits
+	.string	"(\265/\375 \273\205\004"
+	.string	"\262\013#(0\353B:\300"
+	.string	"\327u]\273G\250X\327u\035}\343\002\322~]l3\252\221\375>\"\002\307\336s\020'CZ>B\222\037)>N|\224\270\214\270\204\270|\370\350p\331p\311\360qaF\205\217\t\227\b\227\007\003\320\340\262\340#\301\307\201K\201\313\200\331\352\252n\352\242\356\351\232\276\322G\372FW\364\205.\350~\256\347v.\347n\256\346\313\\\314\275\\\313\214r'7\311-2\203\314\036\327qk\314\030wqy[\225\265VE"
+	.text
+	.section	.gnu.lto_.ipa_modref.bf6dcfc108f8cc68,"e",@progbits
+	.string	"(\265/\375`\001\005\365\023"
+	.string	"\246\332T> s\222\341\bp/\b.`%\222\201\320\230Z\202\334\335\210\001ix\357n\344PT\267Z\t\177 "
+	.string	"\335\261\001p\354f\275\371\333\375\033\3326#/\255\210\366\253\f\233u\023B6\2212\005<"
+	.string	"B"
+	.string	"H"
+	.string	"\223\274\3239=\345\236NN9\247S\244\\\244\356\177T\313\024Fa\230V\030\004\345%\235!\345$\225^\245\032I\001Z\216\037\026\t\321Oa\004p\200\374\202\224?\346\365\222\335O=\0027\213\017\0344X\220R\236B\222\2378\033\034+\242Kb\237S\330\223\001\251\237J\357}\333\250\334\002\231\362L\235+\017\224N\177\205\265Q\033\335\b\374\231\2374\232'uR~\222\240\323\244\334\244#\336\001\216\245b\241D\324\3454nr\231{\334T\342G\273\346\317U4\017q\365\2219j\307\234.\356l\356\\k\231\013@\251$\"\304\203\370\260\207\337\224o:p\330\240!\303c\270`!T\036j)L"
+	.ascii	"\201Z\tG(\204\003wF:\f*\214T\203\334\260\361\311\310\0324*\354"
+	.ascii	"\306\031\313\210q\301x\276\370O\365\245\013P"
+	.string	"\013\256\260\b\221+~\252\250\216\027\353b\212\312\"Q<OH\334\204\202j\036e\275){-\263\236te\357\227\371\364\200:\027\200\221\250AE\305\330\020E%I\2069p\002\021\252*\363\0208e\250LR\220t`S0H\035\263Um \267\032\373\262\322$\021\n\355%+n\r\316\204\002\021{\272\311\336R\352\244^\331\326Vt\217\247\234\303Hr6\341\016\231\224|_\273!\354\217\264~\327m\204\314R\260\312*^\303\335S\212f+\230\003 \001\200sw!\0274'\337v$\350 \227\313Hr\344\"\215\221%\261\265\317\324\177\335\013\025\365\301\324\264\320\245C\332\002J>\372\344z,\0246\312\025\2534\224\220\206\312\353\3224\251\235'\236g@\242\251D\rG\377\267\334\267=\241\0161\177\232\245\273aC\370\375\265\023\002V\317\225\217\317\034\276S\350\002\201\344\374\340\215\313R\362\202\tpaW\261\246"
+	.string	"\202S\372\346u\220\275\301\321\260}\342q\350\353q\200\277C\304l\344O\034\177P\020#"
+	.string	"8\2404\276W\324w\272\2064\377h\375y\007F[r}c\250\177S\020\244\005<\034\264\364\306\313eJ o\217\030\331\3168\362\217"
+	.ascii	"\307\303\263:\346\362\001"
+	.text
+	.section	.gnu.lto_.lto.bf6dcfc108f8cc68,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_pidNames.64.bf6dcfc108f8cc68,"e",@progbits
+	.string	"(\265/\375 -i\001"
+	.string	"\005"
+	.string	""
+	.string	""
+	.string	"\034"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\002\206\b\177"
+	.string	"\032ROLL;PITCH;YAW;LEVEL;MAG;"
+	.text
+	.section	.gnu.lto_pidConfig_Registry.80.bf6dcfc108f8cc68,"e",@progbits
+	.string	"(\265/\375 \235\245\004"
+	.string	"d\bk"
+	.string	""
+	.string	""
+	.string	"&"
+	.string	"\005\001\212\001\206\200\200\374\342\303\337\221\023\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\327\006us\350\364\005uq"
+	.string	"\005\001\006'\001\006\005\001\006\035\001'\001\370\303"
+	.string	"?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\030./src/main/flight/pid.c"
+	.string	"\004"
+	.string	"\237\n\013&\361\024u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_pidConfig.82.bf6dcfc108f8cc68,"e",@progbits
+	.string	"(\265/\375 2\221\001"
+	.string	"%"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001\024\005\001\006'\001\364\003\005\001\006\035\001\001?\202\210\200 \177}\275\001{\275\001y\274\001w\273\001"
+	.text
+	.section	.gnu.lto_pidProfiles_Registry.87.bf6dcfc108f8cc68,"e",@progbits
+	.string	"(\265/\375 \236\205\004"
+	.string	"$\bl"
+	.string	""
+	.string	""
+	.string	"&"
+	.string	"\005\001\212\001\202\200\200\374\342\203\317\322\037\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\376\006us\324\006uq"
+	.string	"\005\001\006'\001\236\003\005\001\006\035\001\003\216\340\003?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\030./src/main/flight/pid.c"
+	.string	"\004"
+	.string	"\200\b0\313KQ\204\f"
+	.ascii	"\016"
+	.text
+	.section	.gnu.lto_resetPidProfile.88.bf6dcfc108f8cc68,"e",@progbits
+	.string	"(\265/\375`?"
+	.string	"\325\b"
+	.string	"\326\221@:0\345(\035"
+	.string	"\274{\216\213@e\003}C\0234n*v\0269{A\321\016:\316E\2131\001|Kc\226\032\215\366\23340\030 x\304eR0H\016\311\261f\311&[\246\024-"
+	.string	"/"
+	.string	"/"
+	.string	"\332\243\346\004\332\243=\373\345\337j\337Ze\264`\273+\241\307\275\253\347\237\344\0013u\272f\032v\327:S\0337\274\355\003\333\013\266[\002\273k\250\262\317\37253\271`0\t)\273\032\001"
+	.string	"\254KT\001Q\275\375\215\355\253}\221\217xgY|`W\205\342\332\375\024\214\240y\364\367\2027\213\366\357'%\206\325.\352\323/\271\311(\373\307\243M%\355\363\321/i\217\nm\212\n\375\264\206\254p\304^(x\262\277\223\302\016\373\331\006\237\320\006\342:\007\317&\022p\207\343\331D\222\024\001\261\205@rb{\220\220\235n$9\006\346D\237N\2228\256\223\233o\237-T9\213q\305^\027\020\303\031\375\f\007"
+	.ascii	"2\241\307/\320\301\205C\227\241\233\325hp\227\027\355$\003"
+	.text
+	.section	.gnu.lto_pgResetFn_pidProfiles.89.bf6dcfc108f8cc68,"e",@progbits
+	.string	"(\265/\375`\213\001\305\017"
+	.string	"\206_kF\360\262&\0352\3239\033\375\256CN:\372Dg"
+	.string	"\212\266J\022\266\035\377\334\022~t#\340;\256E\351\270[\013z\275B\253\322\032\320\200\325m\"\264\201\033\177@\013\"\370\263\303\200r\027\314\250\021!do\271S\nU"
+	.string	"U"
+	.string	"R"
+	.string	"\026\311>\r\276\300\365\231\235\300\365\351\221\215\343\240\314>\254\341\302\332\261\273\233\216\260^\202\267\214\243O\251q\344c&4G\360\365x(\322\247\024\260\273"
+	.ascii	"P\033\344\202\370\2022Ei\002\346z\326\023|8\036\n\346\0213\331"
+	.ascii	"]G\017\345\341\276n;d\273\201}\235"
+	.string	"_\335\362\321\252\321Q\243\037\022`\206\215\007\341.\207\226\217\345\2310J|\365\333\367W<ly\215\365\203\016\024\273{\320gYcq\325\350+\347d\244\016Y\030\336\370\331\335\221O3\310>\017\310\026[\373\274f\373\321~\212\253\030\375\313\360\001\273\251\235\027\273 I{\272\347\267\270\213N\236\304\247-\210\256{\237\276\350\372T\365\303\013\030\342=?|\310L\216\b\036?'%9*\246\252\2779\315\334\273i\\\327\250?\2350\305\226\245^\317\372\004\361\311p\371Q\212-\325\335%\251\306\330\240)~w\327\232\262\263\177?\026\334E)+\234J\027\202\200\302\2014\237\224\240p\240\215e\202\004nEe\253\300E\240\260\235\204D[\211\001w\240\224\320\306\322u\241M\003K\377j\312\247y\206\243\303SR\323\324\030c;\232\251\372\304\221K}!\271\324\177*\037\r\261\307\245\264\202K\315Db\344P\365\324\204"
+	.string	"\211\267\371m~#r \263\001\035"
+	.ascii	"3\241\361i\f\246\001}\332.\221\265\304\230\035\314\214a\314\240"
+	.ascii	"\035\266\314\024\354\210\246\021\230\226\202\021.\207\246e0\013"
+	.ascii	"\346]\332\240Z@W\313\201\270^\245iV\255\004\342\342\206\210\262"
+	.ascii	"\301N{{\016\370\223r\347\232O"
+	.text
+	.section	.gnu.lto_pidSetItermAccelerator.92.bf6dcfc108f8cc68,"e",@progbits
+	.string	"(\265/\375`'"
+	.string	"=\b"
+	.string	"\026\220;8Po\322\001 [.\225\373Nb\226\237\361!B\364p/S'j\350\334\241\2705!\274\304\n#K\214\"\033\255\343\252\031\252\263\337\312Hb*\245\214\206,\331d\357\224\002)"
+	.string	"-"
+	.string	"*"
+	.string	"\227\346\354\230\177\036\373\224\316\342Dfwg\3548w\310\371'\371\2463\221\0165\t\273k\330\2310\356x\333\005\266\021l{\001\276\367C+ \343e\301e\367b5\263*\311\002\302\261}h_\344#\334=\247\274\331mQY\331\335\003\033"
+	.string	"\\\022\\\340\272\264\336\271\002\361\344\006\rU)V\030F\277\344&N\371\037\2460\n\276\273\364\215\272.%\fJ\310F\t\256\354\217\004#\207}kw\327\361\344U\333>\225\202(\206)\204*\335\030&\250\250c\314\343\220\215\346\026\001\221\201\036\246(\373\204&V%\246g\300\332\210\326\271iZ\235\234oom\b"
+	.ascii	"2\241\205/0\340\002,\230w\t\240YM\001wy\321N2"
+	.text
+	.section	.gnu.lto_pidOsdAntiGravityActive.93.bf6dcfc108f8cc68,"e",@progbits
+	.string	"(\265/\375`\026"
+	.string	"\005\007"
+	.string	"2\215/3`M\323\001"
+	.string	"\031\0048\241\253"
+	.string	"\022\227\2555\006\353^%\202\002\264\266\211\002\326\232\376\20065\375\252?\332\002\200b\201\354z\373\302f\003\334\250\367\2262\245\226\"\206\251\202\027\304\303\024\341"
+	.string	"'\246\005\t(Y\0240\"0U5X\360\242(\013Bq\357V5N\013,zq\352\325\3511!\227X\221\027\371\306\035\277\303\026\346\344\265?\337\034\200\277\253"
+	.string	"\206%?v\254\244f\330w\253\032\333i\227\351\314\364\337\300\007\212\002\311\356\366\361\354\3113\361\260}\333\230\r\371"
+	.string	"\001s\366\270\261\235c\303\214\244\354F\250\032\317\236\231\177\220;OIG\313T\236\001\t\273\353\3242\027\267\336\300\366&\f"
+	.ascii	"2\241\205\037x\306\204\005\371\300`>\263`Q\344\271\206\357\f"
+	.ascii	"Q\302]\226f\303\273\356\r"
+	.text
+	.section	.gnu.lto_pidStabilisationState.94.bf6dcfc108f8cc68,"e",@progbits
+	.string	"(\265/\375`="
+	.string	"\345\b"
+	.string	"v\321@;0\345(\035"
+	.string	">\333\314\031K\220FF\316\350\205MYpA\003\265Y\3026F]y\333\260\317`\t\n\243\253s\260\377\016M\020b\3241\305\230\212:j8\366\0275\331d\313\224\002,"
+	.string	"/"
+	.string	"/"
+	.string	"R;\301vi\320\226y\b\262O\341\3108\221\355\356\214\037\007\257\240\377\222oT\253\3235\300aw\255\252\325\306\035o;\301v\203\355\226\353\330\262\357\372U\325\227g\305d4\0203\273\032\263"
+	.string	"\353\"a\"\034\333W\373#'\001\3572y\263\333\021\303\262\033.XA\340\022\341\005\333\003\250\230\362\243o\362\027\206\037\342\213\222^u\351\227\266\313\203\327\213J\rJg\376M\233\306G\206\326J\n\006\005\226\322\231\035\2364z\330\327v7\241\317\363Ex!\221\250\363\276Q\367"
+	.string	"\342H\003\376t@\034i~\024\023\234Hb\2168O\305\374x\026\263c\340\216\024\362\346\327u\336\344\204{mc\313\222\025\003\020\013\b"
+	.ascii	"2\241\263/P\300\20530\352\022\026\261\032\r\356\362\242\235d"
+	.text
+	.section	.gnu.lto_rcAliasToAngleIndexMap.95.bf6dcfc108f8cc68,"e",@progbits
+	.string	"(\265/\375 %\025\001"
+	.string	"\320\030"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\177\001\001"
+	.string	"?\202\210\200\020}3\274\0014\273\001"
+	.string	"\002"
+	.ascii	")\242\f\240\b"
+	.text
+	.section	.gnu.lto_pidGetSpikeLimitInverse.129.bf6dcfc108f8cc68,"e",@progbits
+	.string	"(\265/\375 \365\255\006"
+	.string	"\202\214.4@o\222\016\2305\350\364\030\232\005\3613kA\224\t\005\300\350Zah\275\224\375\353\375\266\271\033X\321\310\330w\024\201tg\nvM"
+	.string	"\032\330\2005\322\310\226)o4\n\025\347u\034\032\252\007\206\027Q%@\274\315%\3614\005[\234\205\353u,\353z\230,\373\3302\237F\361-i6\351\212\236x\204\005\325\335GT\035\266"
+	.string	"\214\017\226>\363`\343\370N\3316\27686\002\022\025\004\226L\213\322K\246\270\223\217\037{\314\r\251\b\366\244)\363\020u%\243\302\304%3_\246\003T\335T\001\252\256u\024+b\267#\235@PZ@!O\021\340 3GP\350\242\267\032\374\032\001\t"
+	.ascii	"2\003\3020\037!h\327D\334\0208fl\342\256H\263\341]\367\006"
+	.text
+	.section	.gnu.lto_pidGetFfBoostFactor.130.bf6dcfc108f8cc68,"e",@progbits
+	.string	"(\265/\375 \365\255\006"
+	.string	"\202L.3pM\322\001\240+\3448\367\312\250\371\357\227\207\3144\206<Xkt\003\254\2775\365\201\206\230\202,\370\261\t\254*V\003l\005\331\251\310\340\213F\366\2262\245\256\250\004\353\3620\r\f\226\303\302\203\260\020\036^\205E<\212\300\327E\001{\230\353\302\236\024\367\312I\2354:a_\344\321\037\277c\t{\362\331\235oOt\227\np\241\311\220\0353\251\031\366\333*\307~:u"
+	.string	"trP\262[\021ZY\023G\322a\033\332\222\377q\020h\177Z\334\350<\205\203bDew\337t\201\350\256= \272S\215\303'\364\037\362\346\001B\3116\231\247\305`w\235\331\306\342\326\027\330\306\b\t"
+	.ascii	"2\003\346:\203i\b\3055\0217\004\216\031\233\270+\322lx\327\275"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_pidGetFfSmoothFactor.131.bf6dcfc108f8cc68,"e",@progbits
+	.string	"(\265/\375 \365\255\006"
+	.string	"\202L.3pM\322\001\240\361\272\3253\204J\363\303(Cb\023\2212\027}\272\001\326\337\232\372@CLA\026\374\330\004\004\312N/\264\202\354Tdpa\311\336R\246\024\246&\205\312\362.\016\r\325\003\303\213\250\022 \036uI\274\251\300\226e\341z\027\313\272^\024\367\272I\2252Ja?\344\321\231\317\361\204=y\354\316\267\007\272K\r\300\310\344\307\216\230T\r\373muc?\235J\220r\2020\262k\361YY\023G\322\261\r\355\310\367\370\007\264\263\02698G\351T\210\250\354\356\223>"
+	.string	"\335\265\013@w\272q\370\204\376A\336:J2L\203y\002\034\354\256\023\323\\\334z\003\333\031\001\t"
+	.ascii	"2\003\346:\203i\b\3055\0217\004\216\031\233\270+\322lx\327\275"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_pidInitFilters.132.bf6dcfc108f8cc68,"e",@progbits
+	.string	"(\265/\375`\023\001\365\f"
+	.string	"\206\226UC"
+	.string	"S\225\016\273\r\355\007\274=\310 Z\375v\025\263\307\222\3303\021+\341\347\027\034\034\350@\230 ;^\264\006\033\320\375\021B\222I\300\265\b\203\350UU\365\377\f\2638\344\224}AN\0357O\366\336;\245A"
+	.string	">"
+	.string	"D"
+	.string	"#{\027$\032Nb\273\253M\022\236\305{\245Sz\376\005T\275V^\247\013\304\224\017|}R\004!\304\017\001\300\026\315\240\210\310q\223\313\r KJ"
+	.string	"\235\335\265\374@\017wv\333\rl+\260\357\005\366\017\213\205\260<E\354\227\374TJ\337\2429\201\342 e\227\303\350ci\324\030&0\266/\355\2478\211\367\022\f\037\260+\"\003\306n\230\300\233\312\253\303g\262\327\312\td\257\366l\035\017\0035>\220\t$\0037vW\377\374\223\263\340*\230L\331\253\005q\306\007bX,$\3034*\373\214\260\002GK\366\260\017\273\n\224_\302\027R\362\337\253\237\312^?o\362\r\n\033<@\254\344h\207*9G\004\240\321\026\342:\006\237\255t\261\207\363\331J\332I\202h\033\2054\n\033\004\222\346\351L\032\247\200\271\022\250\323N\034\327i\230p]\357\254&\313U\005H:m\017H\3763\235\252q\034\177\320\003#/D\357 \356\320\264\330\036\004\036"
+	.string	"2\003\303!\302Z\300\231%fS\230P\267\302<\301\204\005\001A1p\005R\203@9\260\f4a\024\t8t\205\325\202\340$<4b\305\244a\301"
+	.ascii	",\027k\233\325\224\340^\\\316\233\355A\205\031M\253\240"
+	.text
+	.section	.gnu.lto_pidInitSetpointDerivativeLpf.133.bf6dcfc108f8cc68,"e",@progbits
+	.string	"(\265/\375`M\001\275\r"
+	.string	"\266\031\\C\020\221\223\016;Q+\375\247R\315,\302<\r\257\200\322\245\020\300\264|\276X\221\023\247\257(\264\366-\372^\237f\232\027gI\216\345k"
+	.string	"\024\201\302\261\221\360\213\322D\024\020*\355\374f\215X\262\211\224)\005E"
+	.string	"F"
+	.string	"H"
+	.string	"\001\256\303<\200\353\320\235]\343\037\210\375\n\027('`v7\323\017]v\207\226f\347g:\032/e:\3046\334B\245\266</\244*X\002v\367\253\247\205\324)3\323\331]\247\227\312p_\267\255\331f`_C\276\352\307\316\362_\377~+\323\271y\374`n\224d\354b\210:\026\006l1\302\366\355\267\330\234sl\026\021\t\n\034\350\376\221\376\261\247\030\236\001\354\320\231\366M|\245\273\252d\270\353\341\005\213\335\217\200\007`\207\037\017\251N\224\035\2161\306X\244\353\322\343\370c\214/\252*\266K\027\246 \252\270\242\201\312\030_*B\031\022.%,\365Q<\005\311\017\341\221I\336;\364M\256C\004\252\227\016+\034N2\332\237)U\305\276\306\030gXS\034\332\207\324`\023\332(( \031=\320F4\036\017'\032-"
+	.string	"i\242\222\315\343a\221\220\221\355\223\211 \220l%\236L\302\346 B&\002\ne! \346>\032(\023q\034(\343|{M\201\361\313a\343DO.P\223\25167!\357\371\253wPj2\246\001\034"
+	.string	"\255s\340\314\200{f0x9\354\013\023\305\271\027\f"
+	.ascii	"[\204\252\032zW\f\363\"\306\024\264\003\202\375\234l\243\356"
+	.ascii	"\007\2561n\270\016\024\001\343\300`>\t-P\243\205\273\004\006"
+	.ascii	"\f\302\220{\326\341c\245\f"
+	.text
+	.section	.gnu.lto_pidUpdateSetpointDerivativeLpf.134.bf6dcfc108f8cc68,"e",@progbits
+	.string	"(\265/\375`+\001\035\r"
+	.string	"\366YZB"
+	.string	"\2216\035\200\364yGK\276\r\330Y\370w\376\317X\223\203Fw}\256\020Pz\366\307\270\316\201\341'tP\210R\254\312\316\240\372 \365\377\377\357"
+	.string	"\300\244?\030\275\242\230\272\3543\177\373\275\211\224)\005E"
+	.string	"G"
+	.string	"D"
+	.ascii	"\037@\035\346\005P\207\346\354\031\377\\\366*fPN\340\330\335"
+	.ascii	"J9p\311\035N\232\234\257\361pD^"
+	.string	"w\270a\371\024J-=-x\023\246\216\335=\314S\305;\311\324xv\327)\362Vn\352\266?\266\023\330\007\005\232\351\324\3649\013B\274\340\342\356\205\230cc \213\017'\335\376\347\227\334\361K\334\004w\222[|W\366). Rj\354\256\307\241\017l\016;\246wlg\332\037q\022\334_L\fw5\270X\261\373\031p\201\315a\200\367\204\2643\324T'\312\214c\2142\223F]o\343(\236B\363=\230\244$/:\364K\024A\007\f\240\214\177\214\361\206\352\310&\024T\355J\033H2B)c\177]\352\310\276\306\030cX[\354\277\374\360\244;\332%\001d\262,l#Q\220}6\221\313\002\340\220\017\006\327H\2659hp\211X\025\204\013\344A\025\222i\325\007\001c#\237\254\3320,\253:\337^[^\001\206\210\030\220\236\320\200:\362K?\013\005/\203z\\U\305\346d\252\215E\310\213|\230\026"
+	.string	"2\003\006j\006\027"
+	.ascii	"k\340\0012\005\002)B\224\222\210\f'c\221\250\225\3050@\271\314"
+	.ascii	"\326\205\004.\b8\251\252]b%E\270K`\300 \f\271g\035>V\312"
+	.text
+	.section	.gnu.lto_pidResetIterm.163.bf6dcfc108f8cc68,"e",@progbits
+	.string	"(\265/\375`7\001\245\r"
+	.string	"6\231YC\020q\233\016\277\b\fR`\324\200@`\217z<B\257*\007N\270\2401\204\262\342\004\244\\\020\t\224~|=\210\036g4\003l\230K,"
+	.string	""
+	.string	""
+	.string	"(jV\360e\271Jn"
+	.string	"\267\331\233\375\001\333\366\226;\245D"
+	.string	"C"
+	.string	"G"
+	.ascii	"\234R\030b%\334\335JGX/\277[F\355Sj\324|\314G\345\322\204\264"
+	.ascii	"b\353D\237"
+	.string	"\222\300\356\016\350>H\006Q\244\033EY*\271\376\3734\341X\266\256\344\021\363\331]\307\255#\271\251\333\016\331\356\330\037\t\242\370\335]\353\211}\317\273\217\021\020c\244;\007\356r/7\266e\276(q\357\366M\370\2373?q\024\332=\303\370\222\354C\302\222\013\215\335\355|:\001\200\317\003\337P\237\362\032\352\363\031k\366\214\177)\033\"F.\fn|\026oq]\310\342\267\214\372\304H9l\320vD`c\370\212A\003\rlw\270\212\f\005Rv\327A\212\2336\370$>\315\341#~\373\364?\250\317\177\2275H8\302\020$\276\250\356\256H\025\305\376\002\231\245\001$\335\341y`yT\241\t\022,\n\021*\013\026\250B\325\201e\225\207\343\313\003\002V\205\256\013\2532\337^OT\376\020\031]\013\210\216\246\2428\300I)\325S\354\374*\262\340\327\3330\235<D\227Ki\005\277R\2521q, \002\036"
+	.ascii	"2\003\006:\306\313\0164k\273\n\326Rdv:3Vd\254j]pD#F\210\202\204"
+	.ascii	"\321U\303`\302-0M\321\246=\2306\301\\\327\245\336\306\206\316"
+	.ascii	"\344\264j\372E\210 3n\334(\033\362\264\267\347\200@Q6]\363\t"
+	.text
+	.section	.gnu.lto_pidUpdateAntiGravityThrottleFilter.173.bf6dcfc108f8cc68,"e",@progbits
+	.string	"(\265/\375`\177"
+	.string	"%\n"
+	.string	"\026\323F?0\345(\035\300q\343\373\177\260\357\364\207\276\277\310 o\200\200\177T\031\216\036\363\003\230)rf\330\355\377\214QXr\"\263\364\037|\263\026\006\032\002\026\3022\t\210\006\031/3\021M\310\336;\2453"
+	.string	"7"
+	.string	"2"
+	.string	"\007v\267\316\220\207\247S\206\376_\327\210#\352\264\333\370\244\013\263\027\003\007\343\212rX$\342_\227\031\243J\312\202\206\335\265\024G\215{\273m\007\333\325v-\234\001\201\226\361\0362\273\254Z\202\225m0%\033\333\227\366O\216\022\336e\027kvg\002\304v\227\301\n\335\267\204s\270o\364\b\3347\207v\201\303Z\3331\021\301`\t\263\330\264\211\373\204X\031\260\2224\373)W1\371#\2768\311\213\337\374\023\367\355\363\353\210A\300\221\2225\033\206\222\023\304>\335\335\365\374\260\357\372\247\224~\240\021\bz_\b\354\374\361D\210H\025\fM\210F\022\265B\364@Q?_\251z:\366H\240\257\202\236\367\325\rl/"
+	.string	"\200,5U\264\223s\332\026%y\321t\242\336\242\005\017"
+	.ascii	"2\003\302\260\301\204\325\t%\342\275\204j\025\004\016\021\002"
+	.ascii	"\320\020\340\300\224K\260\315j\212\270\3131\233\244\201\251="
+	.text
+	.section	.gnu.lto_pidInitConfig.182.bf6dcfc108f8cc68,"e",@progbits
+	.string	"(\265/\375`\363&\225\221"
+	.string	"\212\345\3101F\020@N\247\003\363x\202\f\352\212[\371,x\027r\246\240\230lS\357\374\267\275 H\341\0208;\022\013v2\210\227b\235\354\254\340@\027\304!xm\361?\347T0S\272\245\331\r\370B\007p\211Dn\231RJ\001\333\002\353\0022\003\032\\\347*\326\231\212u\236r\235\245\\\347(@g(\327\231\312:g`\235\237Xg\f\254\263\223\353|\301un\222:3I\235-\260\316\025$9/\261\316J\256s\222\353\214$u>b\235)\270\316F\200\316E\2563\021\240\363\004\327y\b\320Y\202\353<\005t\216\340:C"
+	.string	"t~\340:;`\235\033H\235\205\244\316\fX\347 \251\363\002\251\263\002@g \251\363\217\3249\001\240\263\017\240s\217\353\214\300u>\340:\033\220:\363\260\316;\256s\001\327YG\352L@\352<"
+	.ascii	"\3209\307u\026\340:\343\270\316R\251\363\215\324\331\006\320"
+	.ascii	"\271\306u\216\272\316\001\244\3164\256\363\214\353,#u\006 u\216"
+	.ascii	"a\235aX\347\027\327\331\205u\206\272\316-\2563\213\324\371\311"
+	.ascii	":\257\270\316*\256s\212\324\331\311:7]g\246\353\214\302:\237"
+	.ascii	"\270\316&\256s\211\324\231\004\320y\304u\026q\235\227R\347\020"
+	.ascii	"\326\031\304u\376p\235=\244\316J\326\271\303u\346p\235\223Rg"
+	.ascii	"\240u\276\3279\275\3166u~\353\334\276\365!\272\307\253\305\350"
+	.ascii	"T\225+\352\247\026J]\200\323~\272\371t\313u\267\320\235\247\373"
+	.ascii	"N\267[\003\231\233\271]\340\376\303J\234C\007\261\375\004[]\325"
+	.ascii	"`\nl/\350\251j\333\222>l\201\342\270\235\254$\307\316\245,2\265"
+	.ascii	"\206\0319k}HX\340\336\323\002;\013\371\255-z@\017+u\272\226\207"
+	.ascii	"\347\016\b.\303\tk\\;\222\272\215\373M\205^\201\330n<\327\352"
+	.ascii	"\227\332`\372\324\356\364TU\215\352\224s$u\332\302Z%fng\356\024"
+	.ascii	"\272\016\261\233\302\026\241\252k\002\361Q\3256\033,#\251Snk"
+	.ascii	"\023\267\323\244&q;e&2\347u\333ReR{a\013\256OUU\251o\003c\211"
+	.ascii	"\277m[s\fK\354\0270\240Z\260xZ\341\"\205S\023\023\212\023&"
+	.string	"J\220\030!b)\004\210\017\036\224:pH\212q-\360\235\310m\315\354<2za\365\013\273\324\202\305\321\247\216\303\330\323P-\200@\374\330``T\366\245\247Y\304\351\262\343Oy\3764}\205\357i\027,t\n\026\350\270SS\331\327\234fb\312q\024'\270L\354\020\301\204\022@ I\215\330\3020*\373\202\323$\336tY\227\233k\002m\316\rC\225u\221\360#J@s\021v\351\314\342\320\223\306\227\330|-;\004\020\210\236F\262\226\307\250\354k\331 \306\372\303\230\230{\bk\245\260\244w\200*\373B6\007\333\002\t\025\247\353\350Iv\311P\027\230\305\361\266z\214f\363\025\327\327vV\\\003;x\241\351\007\341\245e[\250\252\332v\332\305x\025\335\201@TUe7z}5\003\320\314\036\207\231\2330\303\020\024K\2725m\006\034v\252\315\321\240vls\031?\003\200\227\361Lv\253^\214o8"
+	.ascii	"\274\215[\323`|\2145w\003\343{\016\362\355\371\342\331\227~F"
+	.ascii	"dc\022\351x\033\211tn\247_W\307\331\274\370\036C\276\271XC\264"
+	.ascii	"\0035\356A\275\213\377\270U\217\210\227\005},\325PI\335\221\331"
+	.ascii	"XB}7:F\237-\306\024\3608\026\337\342\351Y\374\205[\361OG<\031"
+	.ascii	"\274\201\244\212q|Z\361=\347\030e\252p4AX\016\272\207\00652H"
+	.ascii	")^\205\323\247\370\224\257\351\235\334L\320\306\335\r/C\005\303"
+	.ascii	"\277V4}\243p\374\353\300\364]\\d\232\314\242x\246\267uk\234"
+	.string	"\242\021\027\303N\026\016\306\215\036\306\233\347n\247(~x\2042\233\034^\031\250O\b\361\365\304\007:>z&\275\222\373\255m\240]_\237-\260\325\276\227/\306F\tn5h9\244\356\376h4\n\215Q\243{\371\276\276\223\333\030\236u\314\3043;\340Z^\364\254\256\2606dw%\336\004\211/1\342I@\320\321\251\276s\367G\365\343\016\352c9\342/\362\350\210)\342\231\207t$HO# \245\rK/\"\304/\201\370\020D\332\021_#\020\317\017\317l\244\367\030\351AJ\323\346\347\341?(\275\207\016\257t\244\361lP\324\341/\330\221\217\331\344\360\314I:\021;\237\356\226\240\270SU\225\007\r\215\310\002n\342\304I\234q\317\331E\260\265B?\242\321\276\244\347\360\275\306\001~\322\247x\253\336}\340\367\326\037?\351C\301\276\263d\026\226\320\206\250~,UU\213G\224\226aJ\247=\356\356\367[7"
+	.ascii	"vl\364\036\215F\377n\372\204\036j\334\263\317\316\316\303 \264"
+	.ascii	"T5\353E\372\275\n*z\224\377\355\247p\253^\377\177\333\351&E\261"
+	.ascii	"G[\177\366\225\354\037\325\375\326\315\265\326!c\243\272\325"
+	.ascii	"^\f7\360\225Nf\366\027\334\202\032\006vr\277\341*,\347md\271"
+	.ascii	"\333\351\360\230'\247\257MU\325\177%\007o?\024\267DZ\016\211"
+	.ascii	"\231\253\232.\230\244\252Z\005p\003\022vYIz\323)\267\360v\332"
+	.ascii	"\257\344\210\367lfy\224\271\r\313_\031\215F\243\374k\230}u\254"
+	.ascii	"h\3135\367_\267\320\334P\277\366\323\334\317\276\323\334p\335"
+	.ascii	"\354n6\265\346\323\334h\235\247\271\317\332\255\271\227I\316"
+	.ascii	"\335\206\215r\215Y\031\007\347VC\226fL,,\211<\202\241\031\341"
+	.ascii	"\214\2312_^]\\d\306\210 \306\030\006\314\326\232:\367\027\255"
+	.ascii	"b\222sgY\347\306\272\316\255^gb\352<\264\316B\353\034B\2223\b"
+	.ascii	"\326\371\003\353\034\004:{i>\315\036X\347\016\200\316]\2563\227"
+	.ascii	"\353\274\345:_]g\016\256\263\026\353lu\235\263Xg,\327\371\212"
+	.ascii	"u\266r\2357\260\316U\3279\354|\212\373={\272\327$\002"
+	.string	"\313\362h\377}G\237G\334\352\b\372\\\276\377~\006\337:f\344\365\260\323gX\346Y\342uK<\\\276\235=\325\205\364c6W\244\033\331\226o\3507\364\3529\370-\017\304K\362o\354\354\2717\357\266\244\345~\205\253\357\271D\034|\357i\"f%D\327\275\020Z\332L\340\263z-j\337\264r\364\314\222\302\332\034\226\317\362n\307\366s\202X\0341\257\310a\342Y\371+\337\320U\217\316\243`\205o\203?\241\216\235q\257\3527\370\346[\365\354|\234\252\037\"\3714\370\264\241\nx\220\252\274\006\017\264\243\362U\336\241nOB\220\312\"\346\0247D68\"\035<\1776\345;\f\231\367lJi\243'/\312K\371&<(\037\345m\013\277\006\312\267\013\310<&\325\227\r\3432x\252\377\272Uo\350|\262\f\360\236\374\330\260\317\320\317\207\005\237 zb\200\234\263\243{0\f\276\273\220\210\230M'#\274"
+	.ascii	"\007\303\233q\362^\2204<A\\\360_|a\22254\371\013\230|\223o\252"
+	.ascii	"[\365\274\200Y\360L\276\327\261\242\005\377T|\343\334\372\373"
+	.ascii	"@d\273\025\374c\0012\023\241\216\013\222P__\005o$\262\r\t\021"
+	.ascii	"\351\270\f\017\246\202\357/d\f\314\346\222\347\377\362\253\325"
+	.ascii	"\360\320\320nh\327+\256\222_\362\275\365\247\210\350\263\202"
+	.ascii	"J~\210\244K\362j\242:$\237\344\310#\241\340\217(rh\220\202\037"
+	.ascii	"\"\001\031\211\204W\344\215\274\303-\362g\221\367\202\234{\022"
+	.ascii	"y\304h\202'\362^w\203\363M\360C\344\334\220\033\370$"
+	.ascii	"\370!\377v\217\234\221\004\337i\310?S\213\206\317\b~j\030\311"
+	.ascii	"\361\"\370\303\204@\321\020\372\300C\360\0177\214z\242\251\007"
+	.ascii	"\276\301\220"
+	.string	"\316g\323\201G\304N,\226k\340\035x\207\256zE\267\0136\360N\316\243\220g7\344\207\210_\266\210a\302\324\031\367\030x!\317\304\027\344\031\020\343\204\202A\276\233H\271\347\002uD\2571\3043\336F\007\324\n\374\002\177\341\200\274\002\\\016\003\0209\346\217g\017\344/\020\275\312\020\317\234\271\235:\237q/\353.\201\377\361)t\215\343\343\023@\343s>\276\315 \343\236\315\036\317\356\202\373!\036\223D1\261\233\306\371L\365H\303\220qL\017\b\310\231\341\031\367\016@\340\255\335*\250\b\367\007<\212\342\031\2365\255h\3007\334;\036\2177\340\233\354V\275\035\317\343\033O3q[F\267\376\224\016u\360\356x(nuZ\016I\215\347\t\356x%H<\314&\234\331\025\362N__\001\357\266B\234\216\307\361\005\020\360:\036\b\035\340\tx`\\\216\037@\351m9\276\221\310;\314f\ro\262\263\304\262\216"
+	.string	"\357t\330)\203\235\351s\210m\210gD7nn\247w\316\270\207\343\245^"
+	.string	"6v\222\300r8\236\003\330\215\227z'\274U\317\323\332\306\337\370&\350\032\247\306\333\200\343kS5\276\375\220p\317f\224\232\tpf\212Vhk\024\300G\321\370"
+	.ascii	"\236i\216g\240\361!\016\005Y\252\206H\261P\236x\026\253*.Q\246"
+	.ascii	"\\]Y\005\251R\342\222\245\312\252\210\226.R\262T-\301r5\205K"
+	.ascii	"\325\322\226*/Tv\312\225**VWE\244Ti\351\300QnH\251\322\"\305"
+	.ascii	"E\203*UW\250He\251\242\302\"\025\345j\213\324\r&\266\3222\345"
+	.ascii	"J\212\213\225\325\225\224R\233\332\255\376\232\244E\320BY_\344"
+	.ascii	"n\363&\234\253c\363\335\206\316\256\300\346\207\311\277g3\253"
+	.ascii	"\2147\3333\013a\020\326y\033y\306\"\276V\332a\247\220\020\313"
+	.ascii	"\255Q\246\025\315\276\327<S\235\331?\337\252'\203\245S\366\335"
+	.ascii	"L\372=\325<[9\226)<d'D\344mDt\325$\262(\220\3711\233iN\020*\262"
+	.ascii	"pc\337i\304\276\307\236\t*\206gM\b\373\226\223t\364lf%-\034\341"
+	.ascii	"\"\007D\310\216\214\217\026\362;\371*\216H\373F\310\350\370M"
+	.ascii	"w\006\206\346\301F\370F\363\300\2713\337#\334`\321\316\374\r"
+	.ascii	"K\232\261K!_\033C\212\324Ae\276\315\224\371\313\347\365\375%"
+	.ascii	"|d\225^~\311F\314\027}:\252\006\250\366{\266.<\370FC\2630\320"
+	.ascii	"\276\375\276\373\364\022\267:x<\013\352\225ej\206\311\274\276"
+	.ascii	">'S\325\254\026\257\354\3724\354T\261\264c\302'\321\rW\327[\276"
+	.ascii	"U\020\327\230o2\337c\236\204[\035B[\177\205TUe\361J\026\341\333"
+	.ascii	"\220\333 -\207d\303\202=\226I*\035K\213\234r\343N\204\357q\326"
+	.ascii	"\375\324\317\177\025\006)B\263`A\251;fa$\213F\b\255\261|~\377"
+	.ascii	"i;(i\303\323\205WU\025k\205STw\237n\2565\022\231\024Q\355\201"
+	.ascii	"\0131\366\214"
+	.string	"0\332b\3246\366V\207y\022n) Z\323\212`\274\330\211\305rvm0\217\302-\005B\253\240b\212Wn\375c\rr\323[c\330Yd\271^\277\267\326\007\326\255z_\276X\243\326729C\321\202\331\202\013c\327\3427Xr\3203\313jY\r\305\f\355\276\330YBlVc}\233I\016b6\263T\253\216!~\253\303'\276\215\023\376\220\353\241\302\030\230M\247H)\350\300\232Bxz\225\371G!|\317I\002b\262\272 tq\357!\232\313<<\016\223\336F\020\276\363\344\321\025\322z,\376`O\f\232\346\365>\370\036!9\307l\006\363\324\230\275\r\301\340\367W\322\311\364R\003\361\250$\212A\333\374\335\224\227\357 )\327\345i \036\317\210b\300CLD\306=\0243\\\220\214\223\323\350\304+\311\264!<r\376$M8!\270\276@\335y\362\316\224xe\fD67D:\31179\215\262"
+	.string	"\265\225\277BX\016e\022\257|\201_P\367\212\333)\2331M%\243\343\327Z\213\246\251\252J\343\347\2309/IU\261z\254\311T\2661i*\231Jc"
+	.string	"2-\377#\341\375t\360\035 \243\314\346\210\251\333\345\241\300\371.\026\020R\304+\371\003Z\b\307\372\257\001DT\367\331\031\267a-\235\275c}\353i&n%<Z\307\242/\027\203=\250\322(5T:\310\034\022\021I\222$\303f\002\f\020\004\002Q\026B\352\016\022\200c9J\223L\031\245DD\246&\005\311p3\304\374c\024\030du6U\334\246\201'\376\037*\312N%p\254\377\336\372\006\027\344\347\340\370\364\321\261\322\330\rV\277\252Q-5yT\214\357\235\031^\217\271u\030T\336\031\nD\260S\264\212W\346\022\026\375]1\312\323\232\026\t|\224\345}y%\346\227)^\266>\250\230\031\250\032O\214'\234V\355\323\263\226\234\025\342 5|5\370u\246\241\322D\3026\365\220\023\347%\315~6\007\365\322\277\307}\016\347<\230E\207\255\264\352P\251Xe?\362\277m@]O\223,"
+	.string	"\231\007\213\265\013\r\237\020 \340\027\233\360\3505\255K\260'\243\202\351\0352\301\352\201\330\340\270X\031\341\245\257Ut+W\320?\340\244\247(\355\207\326\3547\335N\017\255\313c-\351\265\376\227\2327e\314w\266\3061h\366\346Fz\367H\325\213!\2735(\250\017\3630\224i)\r\033\345$w\321\317jH$\023i\307S5\200KAt\035\346\317\224n\036\264\326\031e\243\246o2h\r\341"
+	.string	"\007RP\221\230\246X$\004:\315\317?&F\365F\231\301\372(\344:\024\376\nHbv\363r\376\326\324\200\370\350\227\315.yN\365\255^\023\017\307\264\364H\300\031\005\365X\\\301&\364*k\t[C\023\026\004\230d\346D\t=\007\240\262\022\023X\227T\b\307\310IXl,\013KM"
+	.string	"aN\271$r\255\350\267\231o\217\314!2+\tq\020\021\207W\320\220}\177\013o\314g\265\226\264\272\267\305\326L\260\366'r\345r\036\250\370E<~\327\220\203m\260$@*\327Z\276\207\350\225s\316\271\016\321\202\213\363QP\317\026\b\212\206\024v\022L\177\270z\206\224\236\225\225\312\314\021/\371\377\356\234\004\275lQ 6\206\371#\254\334\230\256\341I\020"
+	.string	"w\225Q\301\030\035O9\246@\370\036R\177p\210\005\311\230\344\325\374\300\016K\377\353[\004\263oG\244@\264\350<\266\245\266\207`\204\302\230\362\317\026\215\247\367\035T\354,\341\232\230:!!\257\034\231Q\346#at\205\222\217\255CK\241F\344v\251\247\243\201\237\206\317\324\304M\024F\274)D S9+\365_G\304L\016\265Z\220j\231\313\220aL\207\230\272t\323\310\275D\033\234"
+	.string	"K\027\265]l\270\250&\276\023N\f\020?\331\376'U\037K\004O\224\\.=@r\356\207P>\2326\004\274(\027i\251.R\214\366\342\226UA\206r\260\355\017-6hq\331j -9K\362nEp\226t\353\017\266\023\260\023"
+	.ascii	"\027\213\346z\353$\207\346\224\235o\037\352\275\231V/~\252\370"
+	.ascii	"\302\031\336gj\013{ }\212\234A\247\212\372\373\\t\300\346\231"
+	.ascii	"\345\214f\213\233D\315R\252\312Z\371\363*\330\3704,\317\307\024"
+	.ascii	"\225\221Di\334\321\213^"
+	.string	"\210\337)\2737\336s\327p\214\223\020\272\251z\242B\367\367\310\253\005\355\241\231\035B2\013l<\217\301\r\236\324\335\005vv\201wa\267u\202|\311\245\325\230\363\255$\212T\301w\212\207\024I\346\032\224.$"
+	.string	"\333\022a\314+\264\334\224\b\332=\365\360\f\312\345\214\n\375z\263\b{\254\007\201\370\025\370{~\217B\244\257\2044\001=\222\266}\204l\217\f\302\035\345\302q\003)Q0\226"
+	.ascii	"\266\262f\206\034\331v\215\273\007\r\260\204\232\303<\f#\271"
+	.ascii	"\033Vr\006\233\002\340\020\376\n\254\361\241\315V\306t\371\213"
+	.ascii	"e/9\203\261\031I\352\356U\021|Y\226h\006\373Y\004\255f\377\210"
+	.ascii	",\366\305\341\305\360\334\225\367\033\\\\\2265\302p\215\353\006"
+	.ascii	"\0253U\023"
+	.string	"#9P\005\f\r>\363Q\375\325S\305\215b\255\264\300a\327\346\213\205`\350\343|\323'\201\304\200\323i.\301\2775\207w8\021Z\037uou\202\002ob\326\022\276\3334\370\200\215S\272}:{\226\207\321\265\024\305\361\277\330q\032%\212\305\200\204\320(\216\331g`\023\316\374\204\231\204\317\252\326e\311\357\n\331\221\342\302h\272\210u<\202\244.\353\365\275?\255\216\331\306d\211\322\323\2765\\\021D\200f\335=O\314\306\377d\177\227m^i\270\211F\026\226\213\035B\035\263D\315BR\037\037Z\251\271,\311\360m\353\236\336}]\242\f\310\276H\311\273\231\244Q\344\262\245\256o\277\r\262\261\230ha\370zT\330t)\215\027\315\335\360\022\334\255\2622|\341o\321^pA\253\216We\376\204\016\371\240\213\206D\313`\347\020\004O#\236S\t\232\035\203\246\001p7\230v;\365\316\253\220 \326\3545\254"
+	.string	"\332%\271(\023\330!Y\311\305\320q\324\233\242.\377&0\365=|\330Q\343\342\256\272*\026pWE\2707\235}w\2555\021\307\327R\207\273Ft\330EHqD\0018\341["
+	.ascii	"\353~0p[\002\370\025\336\0247\360 \246\201\200\330\340\343nc"
+	.ascii	"\241Xl_-\177\\\271\224\314\005\271\351I\351\222\316\302\265\327"
+	.ascii	"\231Y\177\366\371\265\f$\307\2333\264\321\363\200h\371\225\224"
+	.ascii	"\320\206\215\347\t\222R.se\263\002\236\273\367\325\362\252h\030"
+	.ascii	"jj\217\2536t/e\351\265\252\347\236\n\222YaO\r\271l\266[\027\005"
+	.ascii	"\265d\337\345\203\224\262\304\224a)m\220\3645>@JA\347N\263X\235"
+	.ascii	"\235\007,\343\2409\271B\r\206\333m\t\324\006"
+	.text
+	.section	.gnu.lto_pidInit.183.bf6dcfc108f8cc68,"e",@progbits
+	.string	"(\265/\375`J\002]\023"
+	.string	"\246\"|I\300\324M:d\243\244\272\363\213\302\265\342\235f\341\203\f\241\017\300\345\007\324\324\335%e\035k\273\004\350i\220\332\272\366\232\216D\274\334\"\n\315\203MKRj\377\337\324"
+	.string	"H3\217~\273\322\276\233\261\3163\273Z#\233\354\235Rd"
+	.string	"\\"
+	.string	"l"
+	.string	"~\214\023\305^\364\341&\273>IL\273\344\002#X\275\232\374\311\367\272z\200\357\3251;\310\311\237E\031\n\001\2424\262\273 m\361\330\253Gg\314\377\355\005lJ8\257:\367\250\216\324L*i\3249\365\024\360<\231(\031i\336\t\224\n /?E\214\2639U\017v\327S\034s\356\357\266Wl3\260\247P\376\321\221^>\320\2539\320\314\2134\337\353)\313V\016\025\311\346\316&g\223\256\260\357\355\356\232\372\330uZU\247\277:]_\364So\372"
+	.ascii	"JX\214\030\217\204\333%\261K\262\271z#\310\237\361\322\346\244"
+	.ascii	"\005\224;l\354\313\270\321\315I\263l%\214\335m\275\332"
+	.string	"7v\353u\266l\177:\265\303S\017q\347.D\236\034\265\353;}y\023#]\317\220\250\037\264\211\304*\034-3\207\250\253\324\270\023\311\331M\240\242\260[S\315\351\243>\356L\306\275x\311K\245\250\303\275vb*\305\332\016v;'\332\256\314@\245\037}MhV\251\207\033\256&\344\324\257q%\227\017\344\23004\372\fB\221\343!\262Y\303i\270V\273\333 /2!\314\013\026\301%\234a\271%\305%\234\001k2\304\20420\340\206\220\305\005\266\300h\300\024\024\277f^``\315\353\005\003[\244\354\336R\037\257t/r2:3\004\225y;\353h$\217\b\241Q\234\2122)\365K\t*\363\242=\2123m\024\201\352\361\016\374\360\230\360\022OS\004\234(X\210\022w\312\n+\003|\354\312.\372:\336t\001\003\013\313\3675 \200\002\221\301\263\rcB\347J\f,\301\254\r\251P\360Y\227\031i"
+	.ascii	"\201\203\261x\033%\335\233\036\344\276\227\335\304)\022\344\366"
+	.ascii	"J\260\260\342\356\300\327\203\354\r\264\025\020\322\270A\223"
+	.ascii	"\334\3333\312\3736\311{\252\254a\300\361\24452\212Y\240\b\340"
+	.ascii	"mYV\231\267jgy\017v]\366\f\334\013\366\002v\213\246\241\007\031"
+	.ascii	"\210\326\334\257L-\207\023\350\006G/\247\350\202{"
+	.text
+	.section	.gnu.lto_pidAcroTrainerInit.184.bf6dcfc108f8cc68,"e",@progbits
+	.string	"(\265/\375`\""
+	.string	"]\007"
+	.string	"\"\r270q\222\016 x\314\026q|\360-7\254\372\037\362Hu\333\177q\330\351\316a\342\267\273=\362\3655w\355\36074\024\024\030\241\034b\037\205\376*\220~`\263\204\310\024\207@\016\230(\216$\"\260\t\210X\2015P\304\220f\021A\2373\321\203\026GY\246E\317*\013Q\0026*\226\tf(T%\245\036\247\027\022\204\376\tU\035S0\223\231\013\367\244(\027W\244\327\030\244W\256\327%\001\364j\307\311\245ucz9\277*=\b\362\355$D}\207 E\323\225E&s#\007'Y\027\314\310_\317\333\327t\025\222\237\222\017\215\225VfF\230\352\326\267\335\232t\200\353J}\001\f\231\371\343:\216\016\373\033\374\007\177K\f"
+	.string	"3\001\3638\303\364\256\001\303"
+	.ascii	"\356B%\265Y%\240k\270[\b\343e\bp\351\026\355|\002"
+	.text
+	.section	.gnu.lto_pidCompensateThrustLinearization.185.bf6dcfc108f8cc68,"e",@progbits
+	.string	"(\265/\375`\003\001M\f"
+	.string	"\006\330S@ Q\224\016L\036\031\006\303.\274i\303\250\344YY4\025\311\030w\235c\231*TA\024X\344K\371\255tR\222\004@(\375\333N\020\200d\021X\300\302\r\005x\2478l\275\357\223\330\275\245L)B"
+	.string	"="
+	.string	"A"
+	.string	"\356\336ICI"
+	.string	"\210\r\036%h\354n\274\034\300\344\360\235cr\250\031\256\375ij~\245)\260\2350A\342@\177\024\256\026N\364.\273{\221\347\007\267eV\232\335u\222\270\t7\274m\003\266\243\375\b\001)\373\004J\305`\377\255\206\330\326M\177uS\372=\255O\347\323\247X8\224\270\223\270\330\225\220\272\261(\230\242\203m\315\256\344M\356L\331e\321\002\305\356\022\360"
+	.string	"\353\320\266\037\342\"4\007\372\364\243\013[\246\234zU\375\350\303\326\335)\332\ra*M\335\214\220\314\030y\330rwA\332\331N\314\025\301\310\013Q\332\260?\342$\334\371%CpI\236t\350\273drx}`aE\215\n\241\f\234O\226]X'\263\274\311$\360t\304\254\263\300\363Q\020\033x\0160\210\033\314A\314\004\360\325\301\301bv]X\254\234\366o5\304\027\371A<@`\250\245~Y)\324\017\333P\217\222\021\003\025\322\355U\372\324\322T\241\001\025"
+	.ascii	"+\013=\302\rO\263\275nh\371\247\306\326\300\020\227`\0167@B\022"
+	.ascii	"\266\016f\354vMl\232\310\255\340\fZ<\216\t\"*\334\001T>H\rYT"
+	.ascii	"\271\355*z"
+	.text
+	.section	.gnu.lto_pidApplyThrustLinearization.186.bf6dcfc108f8cc68,"e",@progbits
+	.string	"(\265/\375`\337"
+	.string	"\025\f"
+	.string	"\306\226RA\020S\224\0160\246\001\002\256\334(q\023"
+	.string	"B\207!\"\257\205$\240\227(\207H\261\017\343|c\336Z#\364\177\316H.\231GQT\022\001\"\304\220\002\0207\236\266\274\001\271Z\020~\263do)S\n@"
+	.string	"@"
+	.string	">"
+	.string	"\021>@\365\250)\276=B\315\315\257h\030\210h\350\350<\356\321\002\342\020\022(\221\343\303\201\035&~X\336(\365\342\221 fw\017\343Y\362D\231\025\315\356:;\317\303]\335\266\003\333\n\354/\b\250?\352Qw>\375\352\322\242\203\367\031=vM)C\366$\332Xa{\263\255<\312\237\001\354\336\300Qcw\023\030\201\345\321\266/\362\027\233\375\301\224\212S\001\027\"\034d"
+	.string	"\331\335\013s\001\325\003\027A2\261\200Qu\204\207\020\022\223Q\242\344\356r\372\331N\003W\b$>F\211b\177\3441\374\371'opI\276{\364]R=^5\2200\t2\"\224)v\212KEa\037\256\236\260\037\032\310\243\201\032d\230\206u,o2\0218\236K\253@\201ca\302u\201\363\240sm\262\317\225\031`\314#!\2734\f\313.+\265\207\251\206\032U\265d[\365\023\342$\244\242\0303\252\215!C\276K\205\312\005\025"
+	.ascii	"\177\b\b\303A\023\226\323\320\r\333\353\bm\001\241\034%=H%\021"
+	.ascii	"\340H&@\327p\220\2113*\\\313\004\021\025\016\001*\037\254\206"
+	.ascii	"\254jd\315\220\333U\364"
+	.text
+	.section	.gnu.lto_pidCopyProfile.187.bf6dcfc108f8cc68,"e",@progbits
+	.string	"(\265/\375`\030\001\005\r"
+	.string	"\006\330VB\020\2176\035l\356V\215\016hU\200&Hp\321\303\304\320\212\340R-v\007f\267\026\252\274\300\266\246\315\216\030\323\323@gp\375\356HE4$\260\242j\320bT0L\312(\315\315\366{\223-eJ\001D"
+	.string	">"
+	.string	"C"
+	.string	"+\376i\330\r\017-\335\212\213\335\2654\303\267OPs\363\251MF\344\201>a*\034B\016\023\244\016\300\b\203K\345\225\244j<\023\310\261\273WyF\360\270Lj\263\273N\221G\341\216\267\215\300\366\001\373 \001>\\\035\331\231\316<\345\247\216\362\307LCM\253\246S\323\2574\0356xg\031\261+\241\004cIS\t\016\266_\331).\0052\355\001\004\266\243\220Xw/\204 \261\373\tp"
+	.string	"\314'ovP\251\227P\226\0345\243\316\356%\344\030\023J'\240\236\230\322\250\352\241P\221\273\013RC\210\252\nD\244(\311\027N\275\252\302\225\316\302\277S\232\032[\344Ib\324k\006\307\322\322}\340\262d\177\\\352\211\003\034\315\243\361\240s\211\030\350\204`\037\231\346qa\036\037\317\245aN\307\205\215X\037\220\005X\310\207%\202%``q4\217\325\261\341l\244\243Y\237,\323\254\352\013\035\256\216\214a\001\202\024Rn\212\t\335\300A^\344\253|c\242 S\032\033"
+	.ascii	"l\263\341\214\351P\262a\2415\325\357\355B\017\005]\357\r~\300"
+	.ascii	"\342\240$\300\025\024v+\2141\231\366\2549\230k8\312,\300\"\214"
+	.ascii	"\001\345\300``\204>c\004w\t\030\260\252\2215CnW\321\003"
+	.text
+	.section	.gnu.lto_calcHorizonLevelStrength.188.bf6dcfc108f8cc68,"e",@progbits
+	.string	"(\265/\375`\376\007E,"
+	.string	"JN\b\021EpZN:\265\r&T"
+	.string	"\013a?J3R\f3L\271\241\341\007\214\273\3776\346\303\216\342\013\020k5\002f\005\261\3543\013\355\243\016\375Q\016s\341\201B{ao\330\177n\321\337\376-\272\231YK\310\226;\311\002\001\340"
+	.string	""
+	.ascii	"\001\267\302\257c\"\035\r/a\224\230A\005\347\252\370)\351\361"
+	.ascii	"!(W4U\274UYYT\242\360\341\230(\345S\242\3766\243(%v\213afi{\035"
+	.ascii	"\202?\213\365?(\023\1772\277\t\337\311\2370\321\215\352mC\360"
+	.ascii	"g\0337\213\252\212\367\206\225\036\025\r\301\237's\024\237\311"
+	.ascii	"\331\230\270\306\315<4"
+	.string	"ih \004\177^\215\306/\327\255^\310\322\366\326\334{\227~\262R\360'_\311\227D17/XY\261=H\323\273r\223s\357m*z\020\372\323\376\007\375\331@\036u\342P\030\004\242\247\355\032\305\007R\260@\205\267\207\265%u\342\360_\264x\314\335\350L\313\253\n\215\202@\n>\270v\034\370E\253k\356\252\242;bi~l|py\375\264\252\326\016\b\303\313\361/Z^6\311\313\030\032\342VUm\236\255\324\026\335{\317\366zc\213\252V \205{/W\254-\256\363\316\231\371\215\231c0\003\207\004\307vS\346\336\353\300\356w'\370f?\031\231\242\036\353'?\005\372\323\250\017\367\372\025\307Nm\252\3761Q\023\350\002\035aK\n\207\252\376\261\2602\0215\261\213\230\260.\235Y\331\242\036\213@\377\311+X\2246vyU-\305\274FU\273\214\371\3666\0313\323\222\202\004\247;#P\272\332\371"
+	.ascii	"Z9\t\255\214\364\270\363\021Z\331\300\337\316F\266r\221\255\\"
+	.ascii	"\340mg\242\273\235\t\330\312C\257r6~\355,d+\013\260\225\203l"
+	.ascii	"e [\371\307V\366\261\225{l\345\242\255\034\300V\346\261\225\001"
+	.ascii	"\330\312;\2662\321V\036\332\312B[9h+\003me\324V>\317\312\326"
+	.ascii	"V\356\256\\\273\362\027\360\264\201\333\272\034\226{\263\376"
+	.ascii	"\374n\33697\344t\177\225?\356\177\373\333~\267_\355_{\220\371"
+	.ascii	"\314\001cg\326vz\331\206\307\307a\247?\367S\013\214\016]j\237"
+	.ascii	"f\352\266\263\222\236\335J\354\245\266ui\330\331\303&\2661Mz"
+	.ascii	"\027\205G\330\303\006\322I\317\n\264pD[\226\277\224o\252\376"
+	.ascii	"\361\264O\243p\250j\260y\232k\352&\330h\\zw\240\321\006\366\233"
+	.ascii	"\017\232\031\313\322L\211\260\035\016\267\036'\332U\310\231\016"
+	.ascii	"hK\320\373uXe\021\261Mf\256Gg/\333\270\220y\031nz`9\226C\177"
+	.ascii	"\236]\343\253NZ\275\367Ju\2271\b\3246\21163U\265\217\371`\036"
+	.ascii	"\006\004\337\214C\210\250\307\022\321\r\276\350\314\351j\036"
+	.ascii	"n\f\232\330\345\t\177\177}U\367N\035u\037\350\032\227\236%u\367"
+	.ascii	"\331~\204\265%]\203\324\006:\251\017\345G6\352j#\035u\355\032"
+	.ascii	"qN\317\233\001\344\322\345\b\274\302\345\250/w!(zjo\003\375\253"
+	.ascii	":F\375\306 &\355c~:\336\214\366\013\302\fu-\001J$\363i\0032\210"
+	.ascii	"\t\365"
+	.string	"T\201\211t\221<\272\030\306p\252ON\225\204SE\301<\221<.\231\034T\034a\0343$\2252\220K%\n\240\244\022\311|J\"U@%10\223\307\345\362\005\224\017C1(\201d\321\304Dq\002\251\302DS\022\371\264\242\tj\351\242\211\201\221\225,\216\313&\246R\271l\"\256M\335\336&\343\332l?\331\025\232\234\255\367i?\206\n^v\205&\344dj\244+49\241PQO^\034\257\274\251\246\032\352\"\241\036\"\nh\005A\r\324\002\332\350\226\236\031;\250\215t\322;\240&\002\203\207%\345\033v\031\177\356\026\220\244A\245\177]\031Q\003L\320\306\276\301\314\306n\2664{m[\252j\237\260\317\203R\005\303\333\3215\025D\320?\235\240\333M\316O?\t\030\226\264\256\236\336i\004\335qi\030\325\021\253,|\305\356\351\247g\001\032@\027{\350Mz\266\023\240\007\244I\211p\363E\356\275E"
+	.string	"\375\272\207\030\273#\003\3542\251\200\234\250\201(\303\030b\206\241!\021I\n\222B:\200\002\231)\253n\021`)dn\210$I\251\335P\007\214X*\fByO\376\267`\274\243\245P\234\227\032'\370\251\220R\245%\231\257J2\005\034\253x\337\365\030\006\365\375\270/\253\260\t\213t\244`\034i\323\260\264\224\013q\027\221\215\350P!\240\022u\301\243\036NB\372\2241\016s\231\236\214\033\203\240CL*\370\352"
+	.ascii	"\215pJo:GN|\265A\242\200C\037KIu\021\316\005\257\364\261\213"
+	.ascii	"\263\265\250\332\205\251M1W\331\344\204w\003\271\022Xg\240\016"
+	.ascii	"[ckgZ=\264U`_R\360\200\r\327jb\005\003\250`3\261;x\210\373!M"
+	.ascii	"7\376j}{\202\017\274\345x\264P\204r\341#\254\353\022\357P\032"
+	.ascii	"\013$\306\356(\f\360\201\316\233\265\376\265J\335Hc\336\265\203"
+	.ascii	"\205\2579\277\017.\363\264\252\351ZP\334\307A\215@\371<\r\237"
+	.ascii	"\354\262\322{(<j\333\265Z\004\302N}\262*:=\363\326G.K\350\370"
+	.ascii	"xf\244\020\203LxIA09\376\021|\321x#^\205\203L\302\t\336\032<"
+	.ascii	"\337\177=\365\366q\316+\231q\332\220G\005"
+	.text
+	.section	.gnu.lto_pidLevel.189.bf6dcfc108f8cc68,"e",@progbits
+	.string	"(\265/\375`R\0055$"
+	.string	"\372D\370\016E\200\334M:\277\nvr\263\2027-\273\360\230\022BGY\335M|\246\206\212\243\3119\210qd\350\306\007V\245}\365XF\036{D?v\nDQ\250\344P\216\265\220\276\302\345&\360\341\022\366tk\204l\271S\n\327"
+	.string	"\300"
+	.string	"\345"
+	.string	"hO\263{\256\372\026[\350\212sRk\355U\331\275\223\323\266\362\263\374\314=-Vs\213#V\306\005\026\031\257;\352<\003&\006\007\256\326\372\340\244QP3\253Q\241\232\203\330\246a\253\330  T\213T\240P\230\323~\331\245X}\n\216\017\325\n&g\255\326\262\b\206P\266\363\347\311\374\305\274Z\203\210\255\325Z#xiw\322\266/v(V\266\232\207\254,)\025\304\306hY\301Sk\365)\375\250<I_T\236\\\"\267\272\256$\351N+\377g\357@4\363\266u\274\272\316\307K\037'\351\221\216#[@G#u"
+	.string	"\307f\347gY\223\376\034y|\251\003/2<\200\216DztFH\234\247}\3468\026\347\324e\250\265zn\035w\334\273\333\246a\233\207M^\bo3\206\021\347\234\203\346\201\265\235~\363[t\337\345\253\270W\236\273K\3621\302}\347^\253\217\237\356\005\270\253\265\310\344w\001\021cg\004Gy\362{\243\353\355\t\031\326\234\263\313\210s\207\330\247u\301l\336t\003\006\013n\366+\370\332\235\340Xn\245W\371\021\320\351\244k\271\221N\366\037\370\224\337\300\315\356\001tZ"
+	.string	"\235>\242\323Ft\272\210N\023\361\246\207\350\264\020\235\016\3724\320\247\003\354\246\001|\272\267\233\376\241\323\274O\357>\255\243\323\245n\232\244\323\224N\357\247\247n\372K\263k\316\t\333\361mfj\3251\267\247\272\221\\\220|\355\307\362k\371\332\267\277\305gso\215\211\230\334o\027}\324&o\2236\207\227\312\006;4T\336\024\247\234\205\256\276T\016m\203\365\324\342z\232\253\351\340\033\361\207\020\363[!\312\223C{&]v\236p\tm\322*\355D3&!\252}\013\233%_\325\030\346\346\344\212\265b)\bZ\241\2751\fh\203\326@\233\021.\300\366\026hum\306$"
+	.string	"6\200\333\210\243\265\251\265X\301&q3&v\265\026\231\312d8\361+El\224'\001\354\321\334p\371\331\236=\234L\n\246\n\266\212\217Y1\241H\255\225)\314\305\260\260[\270\230\337rQ\236\374\331\237=\202\2247#^c\\h\271HK\264\236\306:\304\311\026w\006\310\356\020#-o\271z\250\371\321%M\231\342\224\363ny\272\335\355\3621\322\321-\371E\253\017\271\345^\216\021\016\f\271\245WW\334\0232\272\273H\033\206\222P\0055l\222\362M\005\245\244\202N\006\240\206OS?\341\360D\324o\306O\304T\360\006P\030\2042\"5\b\203B\341\357g8\005\fR\r\177'^"
+	.string	"K\f\247~B\241\f'\")\240\020\305/\352i\252\211\367\213\002\302\b\nK\274"
+	.ascii	"R\375T\001k4Q;Ix\001\244\362\r\241\236\200Q0|S\300&)\237\223"
+	.ascii	"\260\312'\201\200\203T?\241o\030\f\n}\2752\254\323\272`>\333"
+	.ascii	";DiR.\330$\255\2619$\203\0350`\310\355\216\0367\254%\352\024"
+	.ascii	"\254\200]\340\225`\217V\300\026\220c\f#\256\321\036\355\343X"
+	.ascii	"\215\031\355\373t\361\311\2434m\r\033\346\267\022\354\331~\344"
+	.ascii	"v'\316\215\270W/\"\007\267V*m\3212\330]c\fks7V\343\3404\247\225"
+	.ascii	"'\213\036\034\337\234x\215qa\201\311\322\241\204\334!fa\266D"
+	.ascii	"\373\264\363\276\306|\005X\2501(\343\fb\306\0313#\023\320\220"
+	.ascii	"\244 m\200\242\221\263\352\006\021\320\265SE[\254\033\336\301"
+	.ascii	"b7+\252\034\310Y(\277\016\337\2025\300\214T\260\354\206vj\370"
+	.ascii	"\032\211\345)\226\n\241$\211\232\266\316p\220\321\274b\207\366"
+	.ascii	"\363\005\202\225\250C[\0274\353\274\361\020_\372\337>[\3251X"
+	.ascii	"\b\323\362\350\221\322\345\255\260\310\361\267k\025\240?\226"
+	.ascii	"\365\334\202\264\353*Aa\305\235C\037_\315^\2327}\006<\250H\351"
+	.ascii	"\332c\373x(\263`dc\302\331\001\264^OPI.-?\231}\334:\327\030\323"
+	.ascii	"\322\214\022\004\f\361\021z\013\n\215y\242Q+\300sn\356\303\\"
+	.ascii	"\020 \n0\315\0071\036\372\255\261\030*"
+	.text
+	.section	.gnu.lto_handleCrashRecovery.191.bf6dcfc108f8cc68,"e",@progbits
+	.string	"(\265/\375`F\fu?"
+	.string	"\232l\004\030C@bR\007\353\277\377M\367by\326\210>\240\356\220\005\350\267\3459u\315u\033\b\333l2$\222\223T[\007\356\364\226\f\336L\377\200"
+	.string	"zb\017-\243v\261C\236O\023\273\357\311.\331\332\336[\312\224\002l\001K\001r\001\257\267go\036\203\2016\036;'\345\357\376\331\374\327\275v\3776[\246ovl\234\216\250\211\266\213v\254M\273\274s\270\246\356\305\357\036;\347\371M\323\370\366\336Q\317:\330\220\356\313\3421Y\366\336s\217F\371q\316\214\341"
+	.ascii	"\225\356n\365\345\\|\234C\210\357\262<\353\356\302\335}\266u"
+	.ascii	"\335\315\330)[2\036\227V\202}{\261fP\356\303*&\206\023\367Nb"
+	.ascii	"F\316\202\006\003v\334\177#\3204\007\337\336N)\277\312n\357\005"
+	.ascii	"\376/4\224\210\266\223*Dno7)\247\032>\353n\303\317\356\277\345"
+	.ascii	"\247\360s\251q\334\217\003pJ\306\2677\030)G0|\266\351\221\332"
+	.ascii	"g\3277j\237u\330]\217\222\215\035\346`\n\035\013\003\270\367"
+	.ascii	"F\352&\017\377\221\321\261\210hH\310\370\272E\342P\330\262\253"
+	.ascii	"\316\260\277\360\212\b\215\206\375\221\360\312h\355\217Nr\321"
+	.ascii	"\232Z&z\222\226\207\204\342l\\3\222\337\365@\236\022<K\361\235"
+	.ascii	"\331\263\225\025\311.\021'\266\262#\271H\034\302V&$\017\205W"
+	.ascii	"NIz\fya1\032\344\3335A|g&\024}\256HyJ\360<\232\261\314\256\005"
+	.ascii	"\226\034\t|8egk\223\035\336\230\033\265\221W7\352\314\032N\331"
+	.ascii	"\332\332\264\367~\270\317dQ\261\234\205W{o\317\320h\217w\244"
+	.ascii	"w\377\031\356\256\305\335e\003dCV\315\352\177\3665\367\376\216"
+	.ascii	"W?x\234\307if\f\027\350^\260\270\355`\265\324\363\203\265\n\264"
+	.ascii	"\366\342w\207j\347W-}\240\265\376?\352\035\235\257\023B\304\210"
+	.ascii	"\021\355\263Z?\334\257U\274T\351\007Z\311\317\330\240\254\023"
+	.ascii	"\350*\375t\277^\231\303w\346\217\230)by\320\375\343\274\034\022"
+	.ascii	"&N\344\207\236h\237\315\032J\355\363\336;Lk\251\373w\265\257"
+	.ascii	"QP\367\234Y\320\375\337<^\227\377\232gi\345\207>\353\257\325"
+	.ascii	">\373ZG\375\262\304\323\263f\036tw\023\373u\357\275\263\226\272"
+	.ascii	"\377\272\367\336\256\227\270\273\331)\024\263c\271\331'\374\335"
+	.ascii	"\273\0047{\204g\363nU\314^\345f\177\360f\376\033\374\333?\203"
+	.ascii	"'\363\277\340\353\336\221\377\345\177\352\301\374+x\263G\275"
+	.ascii	"\230\377\004n\366\003"
+	.string	"\306\354Pn\366'cv\003nv'7{\2231{\0017;\001c\366\001\304\354Lov\001o\366\2457{\2007\273\322\233=\351\315\016\340\315\216\364f?r\263\033\025\263\037\337\354Eov\2427\373\320\233]\350\315nt\263\277nv\327\230\275\350f'\032\263\017\211\331\205o\366\366\315\316\276\331W7\273.f\317\304\354_\201\206\025\036;\242\001Pzd9\007l\344\b\214\004I\373,\222~+q\233\245\370\316\354\325\322|\244aP\357\246\262;,\205\233\344\207\036\351\374&\330\007OL\207\271i\251S\320Fz\231\307B\250\2150BF\375\340ai\nG\235@c\351\227\3136\216\032B|\327\366\344\016?\311M\257&\3450\030\312Q\325`\336\260\024*p\225\374P\270J\373l_\\\007\b\330\314\203\305\2423=\207\201\036\322Ez\211\272W\367\2342\244c\257\036\351\255y\240}H-\244\207\364?\331\304"
+	.ascii	"\301W<NH\177\2328M\340Y\365\315\320\251\202\266\267O\030\034"
+	.ascii	"\024t\356\335|2j\244\326y\236l\2576\352%AO\276f\036tW\023\365"
+	.ascii	"\253Y\272gQ\273\2000\026\253*w\270\355\377\300Z\250\250\374\374"
+	.ascii	"\037<u\270\013V~(V\373lQ[\251\315\r5Q?\314\344\373T\370\252\336"
+	.ascii	"\336\316*w\013\337\207a\270\267\223\212\017\234$\303\303\245"
+	.ascii	"\321\320\277\346/p\211\323\264\3155\211\237\367B\375I\250{K9"
+	.ascii	"\277\206\326}C\207\374P\341\233\215A\203\027\310\347\324a\022"
+	.ascii	"\336\272\364\r\265\324I\210i\211\364\243y\"\232\035\0226),\253"
+	.ascii	"\2434\231{\224\026\322\343\213\341\250u\310\364\tW\335j\"\355"
+	.ascii	"\371\351'\026\025d/\255m5\253\317\200\310Y+\023\307\2153\013"
+	.ascii	"\302g^\035\356\275\177\255\325\037\2765\365\265\305\314\352Z"
+	.ascii	"\362\255\251d\027\027\023\351\245\354\352Rj\005\220q\"c\025\227"
+	.ascii	"\312\3452Idzq)[0\223\037Rpq8&\231Y\036\224K\260\025\303\257\020"
+	.ascii	"\311..\020L\257\344r\371B\313\370\305%#k\355\342Z\202H\262X\341"
+	.ascii	"\225E\004[&a(\265\222\313\023[_YK-!\327\232J\301\325\002\311"
+	.ascii	"\334Z\301\305B\005\322\213+\253\013\251\265\374BN)\271\262Er"
+	.ascii	"\211d*"
+	.string	"\225K\244\353\326\374u\353%\030\354\320\002\371\232Z\354H\n\361\314\237\225x\213\237\221\226\372\277\311P\236-\226\003\3507\2642\315r\324R\237\240\235\264\004=AK\3459\240\237\264\004\315$\bJ\037xR!\253IsR\325\203\322Y\215\232\001\375\224\006c\371@M`-\377\307\304\200\3766\217\241/\226\323F\244'\310\247(\202vr\223\225\344%p\324\007\374\343G\373\254\323\321\317\316\231\225\216\240\025\bz\0026i\002\332J3\265)\240\233\220T\310\031-\027\320\271jg\200&\020\303X\376O/\033\201\265\274\237^.2@\277\335c`\023\277\tt:\343'\217\210\351\367<\023 <'U\311\035\352\220\200%- \003\311B\316\202\344w\272\366\331%7m\355\230:\033B\001t\222\033%\035@*\233\371\350\241\0248\327\314\203F\036Q\240F-\365$\r@?\333^.\363j\020\217K\322Tv\316\2204"
+	.string	"\235\005=\025\344\035^\225\022\222u\300D\002\200\366\250q(%\021D\306dD\202H\222\024$\215\001\240\002\021!+\326\001\021@1s\216\2116I\232\003]\365\360=\013\324z7X\2246\355iz;G\005\033&\264_\016u\002\251\217\034\265\301\223\020\223\0130\206HT\376z9\247\262\f\t[\023|0C\250\0351\233!\006\037"
+	.ascii	"\b\370\342\324p\t\003\356!\\\375\270\215\254a\0301\267F\316\204"
+	.ascii	"\313\362\340\364\220\316\037\204\324_\220|dZ\204l\022Q\302\330"
+	.ascii	"\321\006\t\274\372\367\366?\037\304*\243\030\3159\207\267\177"
+	.ascii	"\024\371/\377\333\202m\254\220\020\030/g\372|\020Q~5\217\007"
+	.ascii	"\377)i\326h\020hL\335\f\226\203\005,:P\f\260\362\257;\021A<\t"
+	.ascii	"\311\300\030\2709\257\357\t \fSY\204H\"Y\023\023\212\350\342"
+	.ascii	"\017\230\305y\035b\n\210\024)TJ\365\271\357\254\006\037\377\240"
+	.ascii	"\330\t;@\200\352\211\317\277\n\017\331*\033O\265bm\254\307\330"
+	.ascii	"\306\342\363\1778\304\261\276\177!:\243\353(\225\366\273G\t\350"
+	.ascii	"\030yStt\365`)\244\332dq\355\353\326\004#\330\234>\006\225\003"
+	.ascii	"\304E\3056\005\017\n\356&\225\241\310_\320\035\341I\320\332W"
+	.ascii	"\354\235\207DD\373\215\331Jm!\251+\001\021\361\331\3765\350:"
+	.ascii	"H&mN]\330\243\034\033\300\227\210\261f\313]\201\017\f\306\r\203"
+	.ascii	"v\326\253\007P\270\240\356\"{\220\232\333ej\335\232\2147\300"
+	.ascii	"-\217\261\003iu\0043\273[\301\220\232F\034\264\220IO\204\325"
+	.ascii	"\323\214\276\233\370C|\3008\231\317\314\361\310%Y@\356}f\006"
+	.ascii	"t\323\204\340\023\226L\300!\346K\233&L\001\347G:\372*\334h"
+	.string	"Y(\274\276\244f\"\217lUk\327\377\277\003>Q\2004\2618f\312\350u\315\2420~\003D("
+	.ascii	"b\263\356\340\b\032*"
+	.text
+	.section	.gnu.lto_detectAndSetCrashRecovery.192.bf6dcfc108f8cc68,"e",@progbits
+	.string	"(\265/\375`\315\007-+"
+	.string	"\232K\330\020D`\350\325\0305@\370\202\002\204cU4\213\017w"
+	.string	"\215\035KA\342\033\b\013\255\r\225\202\366\023)\373\267I\277\366l\216\257\354~\276\354|\325f\334\206u\004'\2001\200?;\266}\222\312\025B\244\224)\245\024\374"
+	.string	"\341"
+	.string	"\375"
+	.ascii	"\033R0\027f\3120\274\025\030J\236d\023\274+\006\263\357\013\004"
+	.ascii	"\372\345}\225\r\030\002\256Ung\356)\375t\233\212\214\337\333"
+	.ascii	"4\240\3174h\357\013\326\200\217p\255\022upm5m\340\332*\273\314"
+	.ascii	"v\206\236^\344\203\347\030\324\025\350\373\276\302'\322n\007"
+	.ascii	"\203\200?_\017\210\267\323\2659\026w[\325\364\335\345\276Q`\227"
+	.ascii	"Md\007\203\22080\253\177>3&\326\026\323\210\367\262\2128P\207"
+	.ascii	"u\321\026\263\312yE\273\033\005 S\316\326\245\016\236\240>\332"
+	.ascii	"\214\371#\325\365\201j\323[L\037\336\366\360\234s\213\311\303"
+	.ascii	"Y\347\016\3079\251\374\226\np\216\335h3\2463E\260&\b\235\266"
+	.ascii	"\t\345k\2331\217\264\315\031\256n1\263x\315'O\333\214\231\225"
+	.ascii	"\022\275\357\3336\225\376\351\00240zx\315d\032\224J\262\354\260"
+	.ascii	"\366\250\246\322\375F\341}_\366es\252Y\250\231\033\0073\033\231"
+	.ascii	"\327(\001#\224\274\227\376k\225U\362\221?\346\371\244Hz\264\""
+	.ascii	"}\2075\373\346\253\367\366\321\332\217\364\354PTI\2172w\227\026"
+	.ascii	"\033r#a\242\t\357\245\211\265\325\376\2443*'\217\272\227y\222"
+	.ascii	"R\362,c\025\360CRQ\274\324\330\310Qz\037\346\256\244\377\025"
+	.ascii	"s\1774\032\215\362\013a^\235\221Zg\0069g\005m\245\333\250\273"
+	.ascii	"\272\213\032K7Q\203u\033h*\335\002n\316B\254s\220u\016b\235\201"
+	.ascii	"\254\363\217u\366\265\316=\2343P\316\231ws\336\261\316:\326\271"
+	.ascii	"e\235s\2543\313:\343X\347\033\353\274\336\234U\3269\3059\377"
+	.ascii	"\315\331W\347n`\240K\222\r\330\263\354\341t\275R\321\266W\215"
+	.ascii	"\032F\213\231\233[Koa\321Y\270E\266Y9\247\264\312\314\202\271"
+	.ascii	"m\265[fN\261\270H{oTr\031\256\326\332*\213g\317\232\363\351\243"
+	.ascii	"{\305:\247\267\234\177\236\254u\024\027\036\273#W\333]\302\345"
+	.ascii	":\211\261v\300\271\253])+\263\373t\253x/\331\343\260\251\035"
+	.ascii	"h\202\324\275\352\265\207\315\327\231\322\373\264\026\262G\253"
+	.ascii	"\373v\254M\005\335?8\243\312}\373\356f\006\264\200\027=\263\205"
+	.ascii	"\013\336\313\334\377\027\26625\312G:\231\023W\216}\334\032\f"
+	.ascii	"\354' z\334\036\234\2201j\354_\361\355\327\357!_dd]\306^2\260"
+	.ascii	"\030\213\255\255\336\336\350\214\312\300\257\337&\355\334\231"
+	.ascii	"\001\355i\301\202\203\373\2530\255\276\247}5\232\036[\241a\303"
+	.ascii	"\206\265U\365\205]4%F\354\366W\354\245\331\225\357\353t \375"
+	.ascii	"\006\362U\006\300\231;|\360^\246\357Y\330\316\250I>\222#\344"
+	.ascii	"\200\"W\002+\020.\255\233\300\372\0174\246\311\200\b!B\304\332"
+	.ascii	"\352\377\321\231\207\017\267\021\347\330\ru\305\352\257K\342"
+	.ascii	"s\346|\"\211\310\264t\024\246(21\025\207\001\210G%\016\306\242"
+	.ascii	"\321Hd\225\216(\210$\324\246\017D\246%\017\307\024D\243\221\305"
+	.ascii	"p\327\264\364B)\205a$\266(\016\211\306\021'\232\224\214C\036"
+	.ascii	"\017\223H,\251\020\036O\230XBQB\230bI\211I846\t\223\206\270\250"
+	.ascii	"\202h\024\036\213E\243\260\355r\352\364}!|A\315\212\017\232\323"
+	.ascii	"'\203\216\234\252\n\223\220L\243\021$\364\235\344KNT\350U\257"
+	.ascii	"6&\316'\025\247A\265\261\001\374+?<\252\256<Ys\362h\233\246F"
+	.ascii	"\235_\360\203\310\330\202\300\017\002\376\177\371c#\005c5\304"
+	.ascii	"\367{\337\363\250|\215A\177\337\177\260|O \215\363\236\310\336"
+	.ascii	"\036\203\357\2757\311\323z\334+\".\026\326\332j/\345\362j\263"
+	.ascii	"r>\251\024<\203\037\312\003\365\207\367F\257\340{K\247\\n\320"
+	.ascii	"\234\350\300\242$\351QV\343=\022\326\200\250)/\320N\016\236\335"
+	.ascii	"s\250\002\203\3023zn;}\307=\342f\271Z\001\200\237\250Q"
+	.string	"<$\221TC3\222\242$\205B\007\320\002\021\241*n\021\200\245t\256$i\2065\2303\320\210\2728\034\226\250\\}\374\306\213\372\276\325`c!\231'\004\303d\336\3148\021X\271\033d\253\233\2020\037R\351\247\274\030\246\320\026\204\242\3020\357\356\361\205\317\0066\224\201I\345\003u5\213L\375\265aVC\357.\026\002\254\3423F%\363I\354\017s7;\224\261.\272\026\027\304\0028\221\001\036\310\034d\201s\001z^d\3343\323'\031\343\030\325U\366S\366\204i\345\340{J\272\324\225AF\354E\343i\315\024\307y(Wq\001\004\271\206\351\305\320\2467\007\305E\334\001!\200\330\275\207\177\007\330C\204\314)\353\307o1\341|~~\b9n`\027\020\017k\250\3004K\371\001\020\001Uy\326\221\"\036\323]w\260\330\222\330F\365b%\261\3711\00638\371\003\364ab@\207\2728y\037\222\223\250"
+	.ascii	"\177\214\303\236\355%'(8b/\207W\326U\322.\0058\310v\357\365\330"
+	.ascii	"\345\360{\376h\303\320\004\321\025\306\231\254?"
+	.text
+	.section	.gnu.lto_acroTrainerSign.193.bf6dcfc108f8cc68,"e",@progbits
+	.string	"(\265/\375`V"
+	.string	"\035\t"
+	.string	"\346\220>80\221\322\001\3009\0162\342X\372\026\316<S\375\033s\f\360\335\254c\266\373\331\255\371\306\2002\365\2353\312u\013\003\355\300p\240\366\305\307\265j\354\313\237\350\223-eJ\001."
+	.string	"."
+	.string	"-"
+	.string	"\232\235\177\331'Vn\264UD\375\265\256/ad\2465\020So\301frs\331\223\025U\231"
+	.string	"\020\273\353\\E\221\233\273m\t\333\r\266k\001\366'\0373\315\002\2735\330\313\356>\230!\340\234m\037v\225\316\226y3\224h #\001a\311\331]\b\372\201\347\334{\201\347\234\236\274\373\013\257<\f\216\255Di\266S!5\202F\2257{\206J}\331\177\253.\373\261?3\375G`\343\022\177k\331\r\331\321\331\032.&\305v\027\036\267(T1*\301S\006\306H\343\002r\214(6\240\310\324\001C\b&\225,L\360D\"\231\340g\266\177\253.\247\206\236\351\360+KA\037\232zO\003\016"
+	.ascii	"A\204\346\265Pn\b\005\252\"CE9\r\220\016a\271\206\353f\3618&"
+	.ascii	"\210\250p\005Py\254jt\212\246\366"
+	.text
+	.section	.gnu.lto_applyAcroTrainer.194.bf6dcfc108f8cc68,"e",@progbits
+	.string	"(\265/\375`\376\017\245M"
+	.string	"\n\203\244\034Q@PJ\352g\272\355\"l\001\323\360\r\367\025w\n\020\020I\266z1\344\212X\365S\004\025"
+	.string	"s\324<\\\3201\0011\027A\365\021\272\236o\376M\310\274\220\275\271\260\t\273?\007\223\324\341m\356I\004\003\231\213\3141\017\020\020\2205#\351\266)\245\024\275\001\210\001\271\001U\"^\273w\201\260\311\007azk\367^\026\232I\006\235\204\2077\372\3262`.\032i%\314E\346\240\223\360\312\243m\003k\273\367v\021\356#\215\244\253\f\200"
+	.string	"l\323U)\255\336\356V\220\254\313]\033\337\275o\024\b{\235\3532E\262\200\260W9\r\224\317\267\213V$\353\302\327\306\327\304\001s\261\327\225\231\345&\302Ef\216\343j_\257\353wzS#{\367\336\242^\231\351\341\270\372;^-\2544\021\356\314\375\326A\330\026\342A\362x\237\324\020\222\334\373v\304FoBno \\\307\303{\307\216$\271\367\0361\221\260Wf\346f\3536\226\271j\300\213\027A\224\246\323\350\020\276{\357R\331H`\257\277\246\001\366\372'4\333BA@?J\237\036\236\035\235\034\234\344\215\r\262\206fF\346\030\003c|)\022\207\302 p\375\275\263\334A\023\2775\263:\252\025\271.\253\026b\353 \266#\016$\327?rF\\Y\244}\212L\275\007H\363"
+	.string	"q\363\235\276\232k\035\2666\317Y\241qV\370\341\311\2335\035n\263\006%\207#\323\272\346\227\203\366\033\262Ks\032\342\013\027\242{[\306\274p\364\f\n?e\024\034.\0234\241\244\177\306\274\326\372xf\3461a\r\243\306\005\346F5.\033\376\022V\303\2134\232\370CN!\323\013\001&%F\253q\225\340C*\\4f\270\360g\314\353\253\203\321&\375\243\306\365\345@\031\275\376r\300\244\304\200\351z\361\033\232B\246\327L\240\376{\372W\373\207\n\327\334Oy\357m\"\355Z]X\356A\023\367^\366\254.\257\346\241fv6f\366b6J\003\320=\341\003\177\370\301!\320\035X\336r\360\205Y\024\3509\263{\237J\314\f\264^\003\302{\237\"d`\237\017\364\220F\363"
+	.string	"\330k\360{\356l\311\372\300\357h\337\225\267,\264\363 \b@\2119\202\276\"\001\322\225{\257\210\030\332\312\004\334hOO\300^\327\357j\037u\365\265\201\271-\271\362\026\370\322"
+	.string	"\334\326\314\326/\343*3{P\3227\223\366\034[Xn\330\200\347\302\275\367\376^J\245G\264\b(\034\357\210\356'\002*}\023i!\025j\336\323\271\3607\021\260_\351\331\243_X\375B\337Aq\2431s\205w\326\n`\257\375E\036}h`n_W\3362\277a\371K\231\373\333\266m\371\313\230S\2643\n\247~\322\334\324\316'\332\231\251\345\232\227ZH\367"
+	.ascii	"\r\244\273\304;\223\020:\217\020:+5\\wR\3175/\221\232\256\371"
+	.ascii	"\310\250\343\232\213\206\316!\212\316 \336\371\303\320\231\250"
+	.ascii	"\350\354a\350<4t\026*:\007\2753\020\321\371\247\235\225Dg\237"
+	.ascii	"w\356yg\236w\336yg\235w\316yg\234wN\276\363\315;\333\2743\362"
+	.ascii	"\235k\336\231\346\235g\336Y\346\235\217\355\034\323\3160\357"
+	.ascii	"l|\347\227v.\2763\261\235\207\355,\034:\007\333\0318t^\337\371"
+	.ascii	"\337\331\205\316\215\300\207&Xxp\323\"o\345\355n\265]\356\335"
+	.ascii	"\272DG?\351\226\353\236\353\246\353\216\263k\201{\315\f.J\013"
+	.ascii	"<t%\t7\224'\0345H\335v4F\315\364Z9o\374\036\243Jq\372\034&fp"
+	.ascii	"T+q|\310\227\326|\031K\020'\303\325\366\216\322C\261("
+	.string	"w}[37O\302\351\333n\351q\336\351\277\n\024\254\351\221\217\3639xmK\342\223\337\364n\307\305\376`\272\344\317\007\r-\037\230\333\027\315Kg\266\264\355\335LGi\267!C/\214\212\005\203\306\335\336\323\346o\376g\007UC\276\315\2577@\371<\004\2566\034\313\346Z\254[\t3\030\236\305N\thj\002\366\212\374\206\322)\274\302\332\037,S\366\357\017\304\001\313[.\367\336\232\232\377g\207j\241\371\231\257\371\206\252ay\353/P0\035\315#\363d~\346\223v\320\035\3077\276\3147\212?~K\t\313\201j%n\357h\364\253.\372U\367\336\024K\264\n\323]\005tN\347\242\325\027\356*\340Q\214[q\235\320o\314\017\273\33250\267%1/\355\343:\017;\254\205i\331B\334S\202\003\f\212?\361\253UKf\204\371\237\201\232\247\003\327\t\271\300|\327\345\275\030\377\345\233\324\316\241\371\270Z"
+	.string	"\323yg1\035\260W\343\017\235}-\375\313\007\251;\264P\276\342Ko\340:\241+ZzGX\026>-\304\227\362\211/\372\013[8\004\261\001\257\371\355\336;|){\020\251\273I\017\327\246g\321*\320\250Q\274VQ\027\277I\305\362t.5p\235\260\367\232\006\025\007$\220"
+	.ascii	"\260\327\"\210\033}W\204\301/c_\221\272\231\364\314\317\250O"
+	.ascii	"\274\026\f\275\364\335\244\332s1\364\020\273\227\231\332\226"
+	.ascii	"\313\363\336\253 \342/\275g\201\252\r\237\3709C\002\314\002\251"
+	.ascii	"\212\205\363Ij9E%%E\005\225\323\342i\203&\3239\245\002\003(&"
+	.ascii	"\013(\243T\223\351T\341dV1\233\304\n\230N(\346\005TM\0270\004"
+	.ascii	"8\247\230\315\246\006P/Nf\363\235SQT\0138\231UB\251\250\246\003"
+	.ascii	"\314\026+\246\236\206UQ\035<\375\030\n\251\202(\027K'\213\025"
+	.ascii	"Q-,XNE=I-\241\232UK\244$S\271`6\227N*\252\346\262\370v\325\277"
+	.ascii	"\373e\334Dz\306\223\236\177:E\337\342\223\336\350\265d\246\214"
+	.ascii	"9\271\273z,\376\t\205@\362\036j >\304\007\020\313\377\020\324"
+	.ascii	"\002\021=\232\347H\363\346:\017OT\344\341\2013\304\236o\365\243"
+	.ascii	"\203r\350\310\317\314b~\310\307\305\372\347W/\270\034z\204\236"
+	.ascii	"\231\215\334\004\b\006\270\342e.ei\330`\303\302\262j\bz\241O"
+	.ascii	"\"Y:\3203\263d\254\024\330YA\257|\276\225\230p\351\201>Y\005"
+	.ascii	"\252\006S\245\017\217\347\245\354\241\3313\340\317\267\ta'\260"
+	.ascii	"i?\337\201\031\335\217\257\"!D\236\354\274T\247\304+\277I\315"
+	.ascii	"\363y\245\327p\033\354\031\0166-\r\330\253\317;`\206dK\316K\231"
+	.ascii	"Y\035>\203\253<_,\017\033%\031N\002\333\203U\201\365\301\372"
+	.ascii	"\2506\321\022\270;\2606>\234\033\247w\244\323\357M\333h\325\306"
+	.ascii	"I\330e\212$Z=r5h\331`Y]@n\034\253\031y\364ls\364\374;\036=\322"
+	.ascii	"k5\224\036\246\240$+Z\275I\361\216L\322\233\032\211Vm\222\276"
+	.ascii	"\225\210\365m\035\375\213^\313\257\032\251F\f\262)\311\236\347"
+	.ascii	"\371\024\357YF\350\371v\342\364;\317\363\311,:o\374\035\246\327"
+	.ascii	"\371\233* 8\201\356\3350\005\301\2101v\303\006\274<\233\201O"
+	.ascii	"\250\221,C\031B\246\206D\244 )H!\035a\005\204 '\241;\017\021"
+	.ascii	"@)d\214\021I\222\354\254\001\266+/\005)\241V\251\321\f\256T\367"
+	.ascii	"\333\3244:\254\247j\240\t\312;\360\005\351\037\345@\351\210\274"
+	.ascii	"v\021\340\244\247\223\311\0323\ty\237\276\216\333]=\370\223\324"
+	.ascii	"\033\003\244\372\240\323\005^Ae\217\035\341/\264\206\347$r\325"
+	.ascii	"\237fd\206\327.\023\243<\272\005\002!I\307\371\353\b\334\215"
+	.ascii	"-\b\035~5N\331\034\337\246\240K\251\220\0206EC\331\270\355[p"
+	.ascii	"4"
+	.string	"\216\203\327b\242\275\023\357\bk*M8Zm^\312ag5\230\024\263\256P\327b\357\370\031\237TOl\214o\021\256\351\026A\351[\325H\322|*\333\"<&\250\321?}>\2449\007\030\005? l!\177\2006\275/\326\"\220\266\032u\273\307\335V:\022\233\230\333\252\307\353\210\261\374\241\276\023\244\315 \260y\237\201\247}.\245\237\t\367f\346 \333\222\260\335\257\337[\207\n>\340c\207\334\013\236gF\025\357\212\334\373\311\375\265Kf\261\376\t\335\226\235[\315\300\bT\363\333\324\367\326\223@\316\017\036\340\032b\375\003\034\fFMK\030P\206\302E\3053f\364\n\033\n\265\f\3430_\362MA\340\377\236\227cc\332\021\210\240S\037~\025p>*o\226\304Sh\207\221\0326)\260\207)\017\303\0219V\233RBq\3019v\334\231\360\202\005~f"
+	.ascii	">6\351\252Ob4\230$\3204\357\213I\242@\307N\026\013 E\200!\212"
+	.ascii	"\243EC\031\213**C\334\f\253\243\256?6\2221\262=\205\235\351\367"
+	.ascii	"\325\250\025\300z\207\266\346\222c\030\357 -Q\005\260t\343\271"
+	.ascii	"\022\345^\266\342\350R\274E\333]\013\340\235\315+BQz\262D\334"
+	.ascii	"\374\304\2427\226\231\252\337\3360!v\322b?q\257\344\210\377^"
+	.ascii	"\203\335/\300\177o\260Rr\361\235nX\340\222\270\017\004o\n\254"
+	.ascii	"L\n:\217\231I>\267FV\312\307\302\355\321\260q\253\032\337.U\004"
+	.ascii	"\216]\320\303\321\323'\270\324<V*\216+\375\314\217\324\370\344"
+	.ascii	"O\212\360\226\027cR#{'tb\2749\030w\304\253\201\r\371{)3\370\301"
+	.ascii	"\314\217\246\fV:\372\316\307\022\365\230\230\243\315\0358;C."
+	.ascii	"\342C!,\207^\241,\211%\265\337o7\356\361u\037DR\252\264\034\231"
+	.ascii	"\341\214\366\254\304\267e*"
+	.text
+	.section	.gnu.lto_rotateVector.196.bf6dcfc108f8cc68,"e",@progbits
+	.string	"(\265/\375`k\003m\027"
+	.string	"6\355\227F\260\230M:\360!rUO\327\330d\377\307\324\2115z\356\245s9\236O\035\352\247usy\021\335\334\037\317\377\212\351Gqt.3\377\034\336\274\307\275\3579\257QA\234\371\300}\225\331O\212W\017i\204\354$S\n\202"
+	.string	"}"
+	.string	"|"
+	.string	"\356\332\340s7"
+	.string	"z\325\346H*\262\340s\3266|\3038f\276\325\31131\032)=\305x\313i\202\233i<w\237\001x\356Z\327h[\334\265\300\347\256\263\326\311\215\210\370\303"
+	.string	"\312\307\b\034\225\030\243\353-z\303\233\013s\346\016>g\265\352\201\016\303#\333T\320\320\217;(\023cd\r\211\200\tRh\210\226P\006\n\337K\356\216l<\202\206P8U\017b\214\315\240!\"\327s[Y\333\t\355W\0044Vr[0;\003\26320\033\003\263,ga\236}yv\005\263.\316\266<\373=\253\202Y\317\331\356Y\370\3543\233\231\265\200"
+	.string	"4\230\020\331\304\223\030OL]\211G\272(\030f\262\233\354\234\255d\330\272u\217\332\207\235\374\324U\256R0*E\200\022\022C\302\327$\005j\b\204\217\251\271<r\005\212\210\203\017W/u\345\256\336a\0363+U\312\221(\232\004\025\250 Pb\214\006\0024\f\254\227\337\034f\365\227\326W\3678\270|\267y\213\243\254\372Ws\325!\256\376!k\356{Q\327\311s\347\335B*\200n\363\356\256\315\200.\021\357\207w\r\211\346\377*\211\315\310\210,@\371\232t\245\274\326\363+\234\rH\255(\307>\315\335\244\026E\313\251\036p\353\276\237L\001g\313\325\212h9\365\307\030\177\376\243\366\366\223\2167j\315\344\3428\311\276\361\315\266q\223[\343\234\033\n.\274\276\340\302\353\026@\360\364\300\227{`/\231\216\f\026\373>x\207\307\307\303"
+	.ascii	"\r1\235\257;\b0\274|\\\262\r\032^\0342\270z^:\035\\;1\017.\004"
+	.ascii	"7\205\371\360\304\\2\030,\346Z\335\242\035o\244\303.\301\002"
+	.ascii	"\307\021\240\323\272\037U5\344\376\227\244\001\267.\224\263d"
+	.ascii	"\002Qv IZ\022\"\255\030\306\030#,\216\254\202\013'UR\314\034"
+	.ascii	"\306\205\203\242\310\334\3453O\\-\206w\231\263p6%5\244\230{\307"
+	.ascii	"\271\261\324\212Xwy\314\341\224\032RA\250\021\360\250#L\221\t"
+	.ascii	"l(\210\244\205\205s\240\002\221\253\342\006\020Xfb\232\016\""
+	.ascii	":\332:N \177\273\211K^\336\357\374\3360\267\253KP\215.\214/\265"
+	.ascii	"^\003)\312{=\277\307Q\314\017U>\257*c9d\270\225\331\024\n\016"
+	.ascii	"\031\317\3437\314\314\244\236\204\022\300T\262\035W\030\004\024"
+	.ascii	"\215m\003\253\031\265k\326W\003EW\321\264\007\030J\300\231x\311"
+	.ascii	"\370h\272x\342\030\275^\376-\274r\303zf\330\212\b\316\233\f\375"
+	.ascii	"\003"
+	.text
+	.section	.gnu.lto_rotateItermAndAxisError.197.bf6dcfc108f8cc68,"e",@progbits
+	.string	"(\265/\375`e\007\025)"
+	.string	"zFx\017Gp\334Q:e\203\\E\003F\204\330\036\001\234\252\340\212B;JL\277\341 H\3613d\257\366B\t5\326\016D\304\324?v\001=4\365\320eI6\370$\013\002w\t\375CQjnJ\270\326\314\231m\204l\271\223\f\351"
+	.string	"\324"
+	.string	"\344"
+	.string	"?Y\355?\364'\357A\350\317N\245\230\333\b\260\272S\020\316\334j\204\331\271\367\002\373\210\257\307}\253<\347\254\324\203"
+	.string	""
+	.string	"\371~|z<\241\264g\247\313\241\247\355*\305\317%\331c\0177\304\342\324\203\266\214H\016\300\353@\326\327e\033,\205T\037\227\021\371\237\345us\322\262\340l\031\221\367\261>-\333\300\fH\355\345\222\270\214A\316\3730\310\205\254\221W\262\246\005\266\214?\336\363\303\376\326\212\254\371\316\036A\201\363r\266\253\036vH\314\312\353`/\300\344\312G\325Y\037\333U\226m0F\243\346\226\3608\232K\032;\206\343\216/\304\"\217\2376\201\326\030\254\263]!\261?k\207\264\306`\371\024\253\354\321Z\2215i\321\252\266O\221\312\032\335{\037\345\365F\321\252\326\\\322\275\227+\261h<\377\316|'\314l\201\031-\021\274\344%\372\2636\bd\035&\233B\203\325}d\031\350\333\304W\232\252\n\307\374-?\223\301O2\214\247z\342O\376\023\372\363\375"
+	.ascii	"I\347-kX\233\314\312\251\332G\346\037\213j\331\305m\204\271\210"
+	.ascii	"h\350_Z\316\275\227\235y\027;\247\266r\217\255\274;+\353l\345"
+	.ascii	"\234\255\214\332\312\247\255l\317\312m+\327\256|#!4I\343u|\271"
+	.ascii	"wG3\356\252\235hI\256\345/\373\263\374b\177\225\377\353(\363"
+	.ascii	"\227\366b\271\220\226\245\244\214o\366$\r\007\031\247Yv\311\264"
+	.ascii	"\033\025\302\370c\234\212q\227\333@\236\301%\351.\205\257<\030"
+	.ascii	"\247V~E\352_3\352Z\2233;o\356\275\020t?\215,\177\312\251H\275"
+	.ascii	"J\324\257\361\352\342\316\336\336\334{\205\364\223\021\350\002"
+	.ascii	"\003\220\367\016\325|MT\b\245z\242\022*bD=\221\357V\244\251f"
+	.ascii	"\325"
+	.string	"S\313\261\2703=}\024s]\237\255M\327\007\334.\207Nr\227k\247/2U\025\316\2140g\301 \233\272>r*\006-\352\323\353Dz\3327\026<\355\312u\233S\360\264\213:\300q\307\027\032Zh+\231I\324\326l\210q~}6\332h\230\212\2631\223\001\362\336+\201\231\304\327\242\216\332\356\275\021\312\\m\211\237\374\311'\230\230\320\237g\177\354\347\023$\2367\264amv\337{\247\320>^\007\236\034C\356\345\t\315f\235\252{\207\006l\377\272\262\241\301\204\2526\3070\263\211\227\266\017\366\023\b2\016\312\275\367\236}d\007\017\242\335\247\362\345\006\346a\202+Z\264\350\003]'\220$\342e\231\314\\\r\324N\361E\206\313\2730S\0301\036<\023\213&\027\024\204\037\204N2\232\322'\024K\035\\\b\203PKPB'\036\237`\200\"\370\002\b\245\242)\310\"\005\320Ep\251\005\360\204\323\023\220\201"
+	.ascii	"\026\276`r\002B\t\205N\300Ty\037\345\267\301\025Em\330TA`\007"
+	.ascii	"\020e\357\335\232\360,\177s\2456\201~\206\372L\343\203\364^\317"
+	.ascii	"\327\353\241\016:\366\030\353\3518f\016h\273\243\201\b\t\327"
+	.ascii	"\214B\327\323_\3764v\231\275\241\375\224]\251D\240\354dJ\003"
+	.ascii	"\220d\007r\343\022\302>}\344\235\030\036Q\237i\204\220\316\343"
+	.ascii	"\365\363\324\036\257\211:\350\230\205f\327d\314\374!+\035b\234"
+	.ascii	"a\206\313a\346\021\222\231S<\216\206\"\to\016g\003\007\017\036"
+	.ascii	"\320\237\273\276\331O\254.\2617*\347\365\221\177V\336{\205\332"
+	.ascii	"\b\332\337}\305\f\t?\375\325\207]\251t\340\304\207\235\215R\200"
+	.ascii	"\244\250a8\304\230C\250fD\202$I\n\351\240\002\021\261\262:\021"
+	.ascii	"p\255U5$IR\230\016R\004\230\333n\265\211$AH{\362\211UF<\017l"
+	.ascii	"\343$\376P\372\267\222\2755\340I;\3578]\016n\252z\311\t\272\250"
+	.ascii	"\213\312\216V\026\302,\201\025Kqj\"\032\0015\004\344t\253B*\371"
+	.ascii	"\241\005\215[a\374j\207Wq\306\233\030\344\353V\263}\366\007\360"
+	.ascii	"m\367H\372\024\036\3123\334\202\020\206B\231\223@\342\n\304J"
+	.ascii	"z\303\260`4\355\\\304{p'\265_\205\352%A\216q\355d\002\003yB3"
+	.ascii	"\034\240m\356ye\243\020\337\272|N\242\005\315\227\221\023\264"
+	.ascii	"\032\002\374@e\361\271G\351}\r\300\tJ\nf)L:\204\n&l\f\256\202"
+	.ascii	"\334\t\0223P%\200\266U\366\206\234\353_\215\3033*t\306\254N\250"
+	.ascii	"\300\350\305\262\246\220\266w\371\035d\021T\362\034e\022|A\232"
+	.ascii	"\361\f\030\216Z\220\366\210\332\352\322~%+\266g\345\366\226\267"
+	.ascii	"\202\340S\036B\017.D\246\227\241\244\264\f\003\247\004\220fY"
+	.ascii	"\270`G\355Ch\264\"\243w\213\307\250\3264\\1p\333\211\202\343"
+	.ascii	"\376\352D7\305\374\001"
+	.text
+	.section	.gnu.lto_applyRcSmoothingDerivativeFilter.198.bf6dcfc108f8cc68,"e",@progbits
+	.string	"(\265/\375`K\002E\023"
+	.string	"v\344\177H\300\322Q:\243\002\n1\n\315fQ\226i',}\221\306\321 \203*\275\n\310x\267\211\234\334%!Q\007zK\241\202\271\2739\345\267\245_\026\273\rAP`\242\335b\261%\245\356\3753\001 n\226\f6B\366\226;\245j"
+	.string	"c"
+	.string	"l"
+	.string	"&\222f\354\356\211MP\237\266\375\026wa\263{\222\307\343c\340\210'G\324\264\273\254\222\217|\237\362\003\276O\335\271\355\3407\245F\233\017\246H\240)\221C\267\273\035D\341\374\023\331\345d\311\356\326\304)\342R\265\303E\225\br\222B\210\354h\344\310\322\t\246\017=\332\354fb\004Sv\327Q\267\273\271Q\267m\263\235b\307\r\337\347\365A\017\222\323\b\231\030\332\274[T\035\373\032\206\241\223\025\205\375\240\177\245:\357O]\350F}\321\340\214\376d\364\214\321R\243\365\321Q\243/\200"
+	.string	"\020\0177'\321\333\005\021\016Y\245i\244\342B\277\375!\253l\013\271\367\275\331\250\304t\224\302\307\356&\3704\204\310s\357F\223\202\307\007\031\311"
+	.string	"v\003\363S\333'\357]`\240cw\033\3701.\003\203\357\363\351\226\313\245\3731\365S\260G\356i\025\245\332-\260\357\272\251%8\275\331\275\027\255-\202\333\2259\220R\251$D5+fbx\0078B>H\223\277|\252\034\2126\250\312zj"
+	.ascii	"\375G\227\203CU\307+\215\2722\264\003\027\203\370\032\365\271"
+	.ascii	"\247\023\375\305\213\357\343XL\274.&\265\327L[5\227W\204\032"
+	.ascii	"\f,&\253\275&\260\300d\001h\260\016-i\027\n\013L\306\252ih\201"
+	.ascii	"\271d`\301\300Z/,\327\214\306B!qL\366\232\261j\261\330\214\305"
+	.ascii	"\333\313O\245+\030,~fJQjc\033\245_\332\301Q\222\321\031\271\273"
+	.ascii	"\013\026\210)]\251M\241B\274N\245Soa\030>}\264\017\324\225!\036"
+	.ascii	"4nD\263\240\242\362}\202\272\240\307\006\220\220, \240\002!\301"
+	.ascii	"\352\001\373\tl0l\314\002wPy\263x\360a\366_\315\370D\242\305"
+	.ascii	"\315P\200\016\347w]y\1775\374\032w\373\266\345d<\253\273\323"
+	.ascii	"\266\006\310\3752#\0032)Ie\330\305\247\b\337\206\366\334/\205"
+	.ascii	"M\221\261\033 \0340\356\032\004|XHh\n0G\363q\256\r\031\227;\306"
+	.ascii	"\255\305\250:\026\024"
+	.text
+	.section	.gnu.lto_applyAbsoluteControl.199.bf6dcfc108f8cc68,"e",@progbits
+	.string	"(\265/\375`=\r\245B"
+	.string	"jq\334\030@0\240R\0073\210\343\004\213\005\254'\275\251\214\351V,\354\227\333#u\302D\026\330\265\002\262\3739(\354\032\013\261V"
+	.string	""
+	.string	""
+	.ascii	"\305hX.y\211]\344\253\336\257\247\361\366\200Yi\215\310\235d"
+	.ascii	"J\001\201\001V\001~\001^\306\375\213;\030\367@w\255\373\030O"
+	.ascii	"v{\242\333e\373\f\375\360\206\237i\036Y\276n\336\350n\016\266"
+	.ascii	"\223\361\302n\226\211cG\204\220\315\240\034\367\341^\332\001"
+	.ascii	"=\214\013\272\030\337vs\f\342\016m\342\214\300\326.\006\032T"
+	.ascii	"\264\323\005F\207\373zq\273A4v,\224_t\370\313\366\3424S\006\341"
+	.ascii	"\330y\337w\201\347F\241\364\374\315n\2773\035\276\213\357I\235"
+	.ascii	"\257\005\237"
+	.string	"E\257\331\036\234\230\367\325\243\352\007zJ\254\247\303\314 \006J\317\355\270\333\265x\236\324\267\354\350\345\373.A\024\363\276fT\215@\351\371\311\225\220\236]GBzni7\235\347\331[\346`\320\020\255\257\317\373\276\320w\342R\1772-)%!\035\031\025\0219\207\204\232\314\2452\211\314\356ci\373\237/\255ke\376\274\342L\276\215\202\227\352\\\251\356N\r\nN\2523\244\303HO\374\350\211a\026\033\315y\221\\\342\034&\202s\247;\245F\355\315\017\341\360\220\373d\350Pj\324\352\334\260P2\253y\304\231m\333#x\t\265\204\r\211+\221\024:\324\235\332\025'\2138\322\225J\303d\216s\255\3526\025\242\341\354j\324\214\270O\357\3736\327\316\260\353N\275!\016\361\255C\251Q\273\342*\245a2\247\271f\206\337\225\302\373S\306\271Fu\233\374\316\262\376\3478m\315\f\343d\326\373\276\215\255kl\336"
+	.string	"\274\333\375\272;\257\273Y\027\356w\243H\201\335*\341\237\316\276\254\333\345\314\220\202c\005\342qT`\311\275\357\033\001\2163\256h\247\363\334-\266\266\336\255D\246\370Q\252\326Z%\335\277o\335D\033\2677imX\340\360\\\335\307\366\225s!\361\373\335\036\343\032g\303\325\345\345\205\364\214\337"
+	.string	"\243\343'Z2Q\376\261\255\355n\034\345\357bO\321\f\377\351v4\276\330\332v\272\376jA\354\326\026Dz\366'1\327\350\347:\305\217\335zT\374\330n\377\307\307GA\375q\356\0352n\255\214[\003\006'\364\276\340e\274\263,\270\236{\005\377\342M\301\301xc\271\326{\202\217\361\226\340[\334#8\237;\204\214\273\301\225\007z[1qC\227\270\2532n\252\214\233\001\022\367\002&\356\251%n\005\031w\002&n\004K\334\0072n)$n\003\031wT\306] \343\206\312\270\2372n\002\031\367\200\214\333)\343\026\220q\007\310\270\2332n"
+	.ascii	"\031\3673\343f\312\270\227\224\270\2252\356\244"
+	.string	"\214\033)\343>\312\270\2152\356\242\214\233(\343vf\334C\031\267\220\022wS\211\233\251\304\275\314\270\225\031w2\343Ff\3349\211\333\315\270\037\211\033g\334\036B\311\t\035\233\273\025\276o\220\307@\357b\336FqB\017Z&9<\375\223\345\333{\003\350H\264\364\001\336\350\033W\363P\337\030\336\331s>\266\003\034:\276\022aCw\270F\261\351\237\037\340_P\365\355\352\001|\023~\001\274\207\231\273N\007\tz\376\003\306\355\3223\275W\035\247\2002,\275\033\272;(\3137\344&\255\034\t \027\305\246\205\367B\3677@.uJ\f\177\365iu\\\311\tws\360\200\335\252\364\316\230][\244~\231\021\241\3076fR\370\241?K\254oP\341\033\274\205\377@\267\371X\314\3748*G-\237e\322#=\206\377\306>\037\222\336\301\334U\350\221\236\250\r\\a\325\261\005\377\002\271Q>\266\231y{\220\027~"
+	.ascii	"`\236b\316z\253O\353\356>\372\"E\241?\372\234H\364E\217\003\255"
+	.ascii	"\336\371D\357{Z\033\242\005\235\357D\346\002\371\271N\223\217"
+	.ascii	"\355F<S\325\202\374\270\241\367%{\210Y/\364C\377z\252wxZ\253"
+	.ascii	"l\277\343\216#J\234\300n=\201\364,\364~7\267\007o;\275\360\371"
+	.ascii	"\355\260j\227\365^\350\"\260o\205U;w\013\342'Lv1d\363\243{q\230"
+	.ascii	"\357\366\241]\261\236\371\271\r\332\226\nO\341\227\337\354{\323"
+	.ascii	"\242aI\276\204\247\360\371m\257jGM>\326\033U\353\355\232\275"
+	.ascii	"\3574j\302'\237\251\317\355\261zG\305\217\215\374\t\217\033\253"
+	.ascii	"}$|~\344'\033\253v\324\374KX\267:imJ\370?\035\243\212F\f\262"
+	.ascii	"-0h\230\030\030\230\030W\323U\003!\030c `\214u\240\321\344\332"
+	.ascii	"jrm\341\330\002\363Brm\205}\201y!\243b\321\350\006\260h\027\331"
+	.ascii	"\227\223,\354Kl\214\254\353\304\213/\022da]\321h\r\256\243.\262"
+	.ascii	"-\023b\321\034^J\032_8\266\334\346\252z\3615\006%\213\341\365"
+	.ascii	"%\003\0064\354k\013\f\312\025\245\001\255z\266\330XW\024J&&\026"
+	.ascii	"\2056\365\246\376q\177\356>\262Y\026\247Om\367\t}\254T\312\003"
+	.ascii	"8qU\017\375$U\025\203\247\372\244\240$\255U\3021x\3272n;\316"
+	.ascii	"\0345!L\217m\343\013\336\206\333\202\367\255\273v\262\201~\332"
+	.ascii	"\226\246\252\360\021\251\024\013m\n~\352\237m\022(H\360OA\325"
+	.ascii	"\246C\2633\245\307\266T\336\022\256I\332\201\214\360yJ\310e\217"
+	.ascii	"\321\f\377AB0D*\245\202\034f\303B\244T\244V\244xR"
+	.string	"<\253\343\201G\360\317F\264A\005\260\324wK\363\244\\\220n=\360Of_\226D\251\365RZv\331?\352\033\277;\352\203*=|\034\025)\337\023\225\334\325!rz\255O\263r.\244\201\367&\370\207\201\307\221\375\303\273F}\201\217\372o\344A\247\300g99imP\357\204\343VG\255\177z\250w\003\253oO\217%\353G}\003\246\315H\300\023xe\321c[\205\237\323\350\375\320\227I\016\353\206\230^\303\247\021x\247\367D\r?\340\t`\264\001\277\274\nx'|v\241\005\005\274\237\253\206\307\324\016\201\r\250a8\347\220B\206dDDD\222$I\007Q\005\204 \t\255\353\001\0210%d\316\215H\223\244\3160\006\030\347\205\236w>\256\037Rs\335ngT~\025\315\200\362\220\224\025\224\337\276\321\016{gF\374\t[\324\316\257\206[\261\034\242\016L\211}\257\226\275\273\237\021\356\264\213R>\020H"
+	.string	"g\367*\345\236\301\006\251\334\027\tr\335'\302\340\030!R\241j/\301\242\237\032\320@\214||\035)\021\232\210\354nI-?'\243-+i|\b\022u\274txsy\343G\0222`\344\n\340\b\f7\3445k\355@\2345\304\352\324,JG\323.\350\304^/\022\332\002\312\320\311\227-z\006`\305"
+	.string	"\004\030\220\\p\231\321\323\025\007\353\255\311\255\276\260\377\344V\265\240\tq\211\333@\r\220\312P\235\340U\232\233\022K\030\370\271\265\017\235Y\366aA\200\020\266\2306\375=\217\230\321\026\030\021\310k\263\344,q\323\\\276 \245\253X\361\300\254\330\205\035\007\324\345\355 e\007\204\240?\377\275\224E\211\027\033(63\361\253Y\231\247'\230\036\210\367S\272\215\361\025\006\270\034\336\013\002V\254\031\2553\206\256\211\213\b\303|3\\\250\360\204o\261\226l\341\f\265\034\0309\375.\342~J$M\221\022\030+\342\252\257<@+s)ca\323\f\220\322\344\347-D\373\316\037\205\b\250E\214V\320\b"
+	.ascii	"BUa8\243|\230\334t\002\245\377z"
+	.ascii	"\220|E\377\020H\024\204GG\265Q\355w\261\245\355H\2303\021\237"
+	.ascii	"9M0j\265J\021\300\360clh\303\221\344\333\216\r\035\to\343u\321"
+	.ascii	"!p\315\353\205\003C\036\351*\306=u\205\322\314\303<\374R\230"
+	.ascii	"\367v\2416\347qrF\242\037\005\311)\201\374\260\203\215\377\220"
+	.ascii	"\032[F,\351\317Cn\002\307^!\233V\243\254\013\327\313v\365\237"
+	.ascii	"\314\310\357\205\024\333m;\236\365Cyt\335\2662\325\017\322y7"
+	.ascii	"\223\210$\207D@h\234P\214\0175"
+	.text
+	.section	.gnu.lto_applyItermRelax.200.bf6dcfc108f8cc68,"e",@progbits
+	.string	"(\265/\375`t\t\2051"
+	.string	"ZU\324\022F`\\R\007_\bQ\350}Q\352\202p}@\324A\251\371\206\255\353\216%\2167\342\372=\201\261Y\267\264X\306/\252H w\330\340\025p\250\320\321\305C\r>\220\361q\267\004/\017Y\223\346A\322m\367\226I\246\024\036\001\376"
+	.ascii	"!\001I\2566\210^{S\341\245\270\232\322\247\364\233\017s\376b"
+	.ascii	"\213\313\031m\251\027\240\261^\\\323\250\210\371\206\371\222"
+	.ascii	"\032Q\203\340\242Qmy\243\304\272\332~\273\375\211CQ\272\031\214"
+	.ascii	"\366\345,\004..\347\346R\017`]\035r\343\352*\366\342\352j+\273"
+	.ascii	"\321\034\255\3622\201\264\b\226\232\233\2343\323\023q\245\007"
+	.ascii	"\001\035\177|\214=E\342P\310\023\334\321\001\376|loU\361_e{\317"
+	.ascii	"\201\257\335ZzP\023\007*\363c\031\223\373\203\304}\220\210]\343"
+	.ascii	"\021\3579\022v\213e`\227H"
+	.string	"4\024\342\002j\256\260q:\247\021l\324\022k\235\314Y\344\362\270\020.\250\007q\001 \330\350uw\310\234\320\253\363\203\314\351\343\002\235\331\303\177=|=x\\\226\314\331u{8\210\316\271\003#a\335\325\337\234\210\316Y\246\342\002^]n\004\267\254\2601\314\220;\214\221\302\f\271\013n5q\220W\227\033\300\255\253\373t\316&x(\347\354n~\263\266\252\356\3559\3109\367m\267\270\274\001x\267\327uw\213n6\030\377\370{nWcU\377\305'tL\226\360\372\337\357vz\272\336\022\375\220\325/\273}\013\013!2mw;p9(\006Er\316\n\244\256\245D{\330\211\353\355\211\325\325\373\336\346\360,\020\032\216\rk\357\267\325U\377\030Pit\214\225.\346\235v\243-\357?\273\375\247\323\351\264\377\253\333\323\334\t\370\024w\001\216\346\216\204o\037y\234\267\221\263y\027y\2337\221\233\271\013\371\232{"
+	.string	"\337\355\037\366\266O\357\266\021\337\356ao\027{\267\211\370\366\220\275-\354\335\346Yo\007\361\355\035|[\007\337\006\342\333\277\365\266\017\337f\361\355\036\276\275\256\267U|\033\343\333\257\336\276\370\266\037p\2608\255\032\\\016\225\313Yk\032'\203Q\261 \3618w6\3676\377n\270\366+q\r'd\006\311JZwR&,\374\255\033\350\252\273\025wk`\033\025\316k>&\005\033C\262Qy\346\nS\223s\016\356{\025O:\215\226\3519\033Q\354x\200\337C\306[\274\243\377=\360\261\333\357\177O\2606Y\007\320\216\250\005\233V\337\273Y\264\314\235\007\337\273\027t\356\215\327\310\222\006\272\223\344?\277\223&M\0235\323_h"
+	.ascii	"\231\242\363\317\276l\222__\2223h\345\304~J\376\363Y`\\}\225"
+	.ascii	")M\023\005\376\263\335;\016O\007\224\337\177\261\257C\027\235"
+	.ascii	"c\037\310.K]\240\225D\314\367t\330\235<f\324\261\275\367\274"
+	.ascii	"h\227\346\315S\222\365\036K\263\\\215\217%7z\377Dz\177\363\353"
+	.ascii	"\006\207X\2245uspFF\177\364KjWl\326o8\277F/\344\345j\f\316\333"
+	.ascii	"\304$\t\222s7\230N\3314sf\032\025\375\372~\305}\320'\030\225"
+	.ascii	"+\262\252;m7\353:\243\261\342\307\273]'wF\216z\035M\264L\363"
+	.ascii	"\346\271\016+\2551\374O\207\261\n\375\247I\317\242^\2327\317"
+	.ascii	"\337\233V\365ED\3154o^\267wq/M\355a\375\001\304\365\026\304\352"
+	.ascii	"\252\372\b\240re;\360\027\375u\273rC\364\001\"B\\\022R\027HH"
+	.ascii	"QX\001\234R\201\214\222\232\202\3420\002\251aJ\005T2\311\342"
+	.ascii	"\211\230\214J&%\004\241\246\2346D%_\224`S$\241\246\220\352\n"
+	.ascii	"\244\013'\334O\006F \245\230\246L\224@\242 \301\244\002\351\224"
+	.ascii	"\202\351)\271\202\311\300\261\243\244\240\222LSQQI& Z\366\377"
+	.ascii	"\362\201]\001\303\374*\234s\316AEW\300\007x\002/\364\335J(\312"
+	.ascii	"\263\353m\273\233\017\253\2009"
+	.string	"\001\203\365\313\233s^\002\371\\\253\213uu\275\245\253\361}z\214=\177\224\223\325\305<\326\375\024\227\356\362f\342\027\207\304\037j\376r-x\364\303?\312\361i\343\301W\261h93\n\277\273\225<\316\203\006\355y\016'\202\204\t\023Z<\236\027\376\321\016k\016\200[\364\335\0260\254\336\362\374\n$H\363\227>\004]\303\245\007\311\233\326\340\273\0226\031\202\357N\350\230\262\035T\212*S\313\222h\031\342?\271\240vL\3344h\243\334\rw\260[\213\367s\213^\347\2739t\270\336\356\020x\242\327y\242]\030\225\253\261*!\031\3237\302\271\200\303\250\2018\345\fc\250dDZ\222\202\024\032\003\260\002\221\251\242n\0208\210\246&I\322\001\357\201d\360\007TYuv\312\223R\245#\376\226\tr5K\305\374\264D\033\347\267\367\320\020S&\370s\363\230\343\320\350\030-j\363\367\2045{\201C\244\372N\215"
+	.ascii	" \343O\220\003\fU;^H\3241\244\334Z\216M\244\361\013DR\237!l\322"
+	.ascii	"\323\020\363p*b~\r0\365\024n\316-\270\206T\301\"\247q\320-SQ"
+	.ascii	"t\242+\375z/\356\3662;\251\377\022\275\364X\376nU\244\234\247"
+	.ascii	"\200x\225\016\204\"\310\264\360+\213\300\334\222\245\204\354"
+	.ascii	"*S\200\211\be\245#\342:B`\275z\001\330\322p\261\300\234\\\261"
+	.ascii	"$\023x\212\032\233\260K\256vS\240e\330\200aA\217\310cb\035\024"
+	.ascii	"\"\251^+\302?+` 4y\\1~\321e\025\234\377\245\264\207_\365\024"
+	.ascii	"\316W\317qv\tp\273\221\356\312)\374~\007`D\311n\212s_c\356*\272"
+	.ascii	"n\"#U\240`\214/!J\004\330\007\327\0328\363\023 \320w\230\226"
+	.ascii	"^Z9\253\002Nx\324\306\335t\300\025\210\177\303\327UF.9j\374\373"
+	.ascii	"\2106\362k\204\261\320e\367I\312\232=\361*\256\303\212p\257\311"
+	.ascii	"4#\376\336\234uky.\304\377\246P-\366\206\343$\2258:\341\226\f"
+	.ascii	"\251|\336\031\324\257\325i\\\375\017"
+	.text
+	.section	.gnu.lto_pidUpdateAirmodeLpf.201.bf6dcfc108f8cc68,"e",@progbits
+	.string	"(\265/\375`\210"
+	.string	"m\n"
+	.string	"\006\324I@ \307*\035pFO"
+	.string	"y\224\210\r \023,i\235UJ\327!$$\377\003\325)$\236x*-\2645\266hP\202\203\253hg\260\0030\251\302\r\301\340\221\206\004\007r\\\312M\266F\366\336;\2458"
+	.string	"5"
+	.string	"4"
+	.string	"$\333\001P\240\365\222`w\2779r\361tJ\321?\030S\247\032\220O\272\020\013Q\2200\256\250G@\256u\332e\307\310\2222\003\332]K\327\370\272\353mC\330~\260\237\t\376\354\247\227\276\307\031\340\361\372\311\201\335\217\335\202\315\325\030\224\215\355K\373*_\021?3\316\006\273\001l0\273\353\340\006\315\253\347\034\357\225^\301{\265h\033x-;\333\2342\343lK\206\317\t\027\002,\251\263\317\362\026\343|\023s\370&\357z\365}\363^?O{\205\225 H\201\251\344\316\256\255\344\224\331\247\273\273\2361\007\241\b5\032E\204%\021\bf\204\020\034\372P\220N_hQA\272\030}%\222\004\306\027\002Q\337\247c\323I\004~\241\311\004~\233\232\3523f\220j\256h\225t\332\032\033\362.\323\231\272N$\r"
+	.ascii	"2\003\3269\004\353%6\354%\264\325&Hd\334\335\003\243.a5\253\321"
+	.ascii	"\342.7\325\036\rL\355\001"
+	.text
+	.section	.gnu.lto_pidGetAirmodeThrottleOffset.202.bf6dcfc108f8cc68,"e",@progbits
+	.string	"(\265/\375`\002"
+	.string	"\025\007"
+	.string	"r\21515Po\322\001 ;+-\315h^P\341A"
+	.string	"R\231\205\244\032:+\034\212[\363\365\270,\002\361\f\220\217\312\354U\215$\250o.\215\332\263\240`\226\354-eJ\001\346l\024\252\016\36484T\017\f0\242J\200\200\234K\002n\006lu\026.\350\261\254\013R\332\336\255\222R5!\265\260=q\023\227"
+	.string	"v\327\300/\271F\341g\177\256\370\344\261?\3773\375\245\006\220\204r\2635P\252\206}\267J\262\237N\315\264d\243\177l\273\031\333\313\256\274\024\017\333\321\246\374\220\213D\273\3444\216\214@\005\343\342\304ew\241\346\231\351\317]`\372\323\215\307g\364?r\004\026\020\024L\004zb\016v\327\211\211F\267\276\300vG\t"
+	.ascii	"2\241]\037\370\354\020\240k\270p\210\02136qW\244\331\360\256"
+	.ascii	"{\003"
+	.text
+	.section	.gnu.lto_applyLaunchControl.203.bf6dcfc108f8cc68,"e",@progbits
+	.string	"(\265/\375`H\005\255!"
+	.string	"f\375\324F\220\\Q:p\220\3061@{a\001\202\323\213\250\006\304IQR\340Ug\030N\212\2761\024L\007\257\376\255\373C^H"
+	.string	"d\250@\222"
+	.string	"X3\200\337>o+y\006\351\ry\377\032-\211G\377\333>!D\356\224\002\304"
+	.string	"\255"
+	.string	"\305"
+	.string	"7m\201R\373Q\347\202\364.9n"
+	.ascii	"\252O\252\307\230Z\243\"\030B\024\314\247\207r\031\307j]\022"
+	.ascii	"fL\2555\202\033\300n\332\366\263\\\013\222m\364\360\373q\271"
+	.ascii	"plR\"\362\251\265\346\020\334v\336,/\340\274\271N\216\364\231"
+	.ascii	",\006{\235f\271\024\311\177i \276\303\017\212MP\250\343\263\004"
+	.ascii	"K\226\214\\V:\320\"\263u\233\017\247\340\213Eh\254\315\017\""
+	.ascii	"`\214PX\211c\220\200\312\017&\372BPkU\242\347\213O\320\346\207"
+	.ascii	"\021 5\205\274,mXL\352\324\204\277\322\001\0225AfB\037\335r\302"
+	.ascii	"\217\317\221\2320\251\244u)\2719\361t\207\320G\351KC\255\325"
+	.ascii	"4(\\\272i\267M\307\266\b\333t\337\343\221\232s17\026\371M6\242"
+	.ascii	"A\037\244q\336\374V\200\302\324\243\3113=qa\263;4\204\013\355"
+	.ascii	"\366\326dI\311\361\321.;*\211\356\320\376&\223\311\244\267\211"
+	.ascii	"\215{\325}\373\324]\340]~\002\266C\375BA\367r\327Lj \223\232"
+	.ascii	"v\352\231I-3\251c\247\206\235\372uR\237\2476O\352\262\244^\223"
+	.ascii	"\232\226\324?`\353\303c\351X\262j\365\221\364S\221\246\325\323"
+	.ascii	"\253\376\251\337\313\327\276}*\277\350Y\225\233\343\231\016\007"
+	.ascii	"\343\331\315)\034XV\216E\f\377b\317\250\215\344\023=\263\355"
+	.ascii	"\305\306\327\245J\221u\216NZ\265\326\007\001mD\274\370\244V\337"
+	.ascii	"\005\233\304\261L\300j\365Y@\2168q\342\233r\2347\317}\021\212"
+	.ascii	"U\271\346^\351O\217&#\374\n\005\205\013v\212\257Q!!N\255\325"
+	.ascii	"B\232\253Y\3417\335\364\020\021\321y\263\334\203\271i\025\005"
+	.ascii	"\316\025\253\036Mz\202\024%U`;\334-\251+\037\355\242>\376|Ly"
+	.ascii	"\355\320E\347\036ukjEy\303u\247 \022\344\271C\377\313\337\203"
+	.ascii	"j\317Ui[ *=w\326F\005\265\335q\342\025\364\256\236Js\n\200\017"
+	.ascii	"hm\035\206Y\262\200T\026\310\026h\317-\033\357\262\326\236\002"
+	.ascii	"\272\2625\005\346I\242I\323\250\320\332;\030\364A\272\377\362"
+	.ascii	"\001\\N\\H\337\3520\325\003\344\210\246\374\213\316CG1t\034d"
+	.ascii	"\033\216d\350x<\033D\264#\035o\213v\274\022\272\030.d\f\305j"
+	.string	"\354n\f\225&\222\300b7#w\364\302\305.F\213\234\214\335PQ\216\210W#'\341f\243\031:^\356\310\310\210\227\233E\365\376\252\255c\265ui\326\036\204\212\353\016\354\305\177\bU\037(\031n]\236\265\r\332\035\266\203\002`=\035\221\275M\232\341hm\317\333\332\037B\320\007q\233\023\262\345\2472\255\016\230\226*&\262\035\032\307\223\300nk\366\256\350\334\366\305\203\030n1\002\247$\03103\346Ll\207.\260\264\345I\255\231-m\017\324\332\235m\215\250%\253\b\247J\222\f\311dWl\013,\265\003\244\002\333\330\342\210@\255\327\232\013\333\027\0218\345\334Wi\250q8\003\225a\310dd\2440I*c`\002\231B\233\007\020hV4I\2419n\"@Sk(\321\320\335\033f\314\204SM\177\351\336\221M\r\304\020?\007\002\305J'M\230\240r\025[d\204\327xq ]\346\201\310\r\253B@"
+	.ascii	"\365s\264\327\332\207X\337A\277\003\302\275\0348\306\354m\313"
+	.ascii	"\236f\360qL\361\333\346\020\021\262\034\230\346\302\251\201\217"
+	.ascii	"\332D\007f~\302\362\201\224Ld|\033\201j\324\022T\317K,`\027\345"
+	.ascii	"1\236\305\320\004O\001\023\346kD\362\003\361\354\002K|\340\304"
+	.ascii	"x#\b\210\263;\273\033\204\210\224N\025\360\021\372Y\035f\356"
+	.ascii	"]K\350K\274_\263\270\235\351\021L\007\244z\305\346\007\354\f"
+	.ascii	"\251Y\330_o\3329\211W\346\223\327\376\221\354Q\300v!C\305\265"
+	.ascii	"\242\n"
+	.text
+	.section	.gnu.lto_pidController.204.bf6dcfc108f8cc68,"e",@progbits
+	.string	"(\265/\375`\225F\005$\001\352\367]kL\020\020h\351\f\007?\346\032\235[=\214\0369`\033\370\213\313\226<\006\203[\362XPv8V\353\313f\230\247\304xi\263\234\353E\257P/0\013\224:\271\214\351\024\204\251\304\246l\356\235\2705\2216~\333\327\374\371\235%dK\231d\234\006\376\005\315\006\274"
+	.string	"h\336\fT^\fT^\035*o\016\225\367\002\225\327\202\346\255\240y)Py'Pyq\250\2747T^\033%xk\224\340\225\240\004o\004*/\004'x\037(\342u@\345\245q\202wF\021\257\f\2257\206\t^\030*\357\213\"\336\006T^\006T^\027*\357\002*o\013\225\227\205\312\253\200\312\233\200\312\213\200\312kD\304\273b\210W\205\312\233B\345E\021\304{"
+	.ascii	"\021\357\211!^\023*oQ\020/\221\312;\244\362\n\251\274%\204x\203"
+	.ascii	"\204xI\214\340\035\241\362\212Py\rh\336\020A\274 T\336\002\232"
+	.ascii	"W-\301\373\241y\201\230\312\2678\2027\r\342m\022\274<\202\367"
+	.ascii	"\\g\0027I:f\344\372\364\235\264\225*z\270\336\025\341\306^w\216"
+	.ascii	":'\317T\316R\316Q\316P\316Ug\253\363\324\231\371\337\371\367"
+	.ascii	"\376\276\337\357\007\374\361\374z~\301\177\360/\374\r\377:\377"
+	.ascii	"\234\337\3567\363\243\371\323\374j\376\267\177\315\017\367\267"
+	.ascii	"\371\335\\\004\033\300!\030\004/\260{\346\362\322\223\265\265"
+	.ascii	"<\205\352\016\217\037;ykoe\366\267\234\265\214\303\252Q\026*"
+	.ascii	"\342i\312\032\343\311\035\036g\223\237&\2240<R:\352\347E\254"
+	.ascii	"]u\227\227,7\341+\253\205\206\261\253\343\363S\265\307\316.\220"
+	.ascii	"\016'a&0\360\222\3551f\207\020qy\311JVef\035\273\034\002\353"
+	.ascii	"~xj\241y\210\f\007\303\362\023G-+\331\t9\303\021\227\241\200"
+	.ascii	"\270\376\302\222_\033\203F\345\033.\224\304\312t\246\260\031"
+	.ascii	"\013\\\327U\306\213\2733,;\255\372\342\f\2742\327\204!,\363\363"
+	.ascii	"\342\276\316\023w\325\rr\30452v\306\314\316^\357|\337\341\177"
+	.ascii	"\017|\236\3579\237\023\276\317\017W5\234\313a"
+	.string	"\254\020,\220\255\f\326\205\005\256k\025k\t\326\201\t\\\327\225\231\350\tC\266\256UQ<h}\200o\336\370\375\221\305\365\325\001\222\265\355-\364\356\320\216\352\313\317\213wh\370j\265\362\234\004\340\351\023\270\345'o\325\027\347\b\303\230\005\331U\3614\230\303\201l]W\030o\366w\253\246+\2325}\276\321\013cF\367\272\275\234Uw\367sH\245\277\331\276r\363r\206Y\327U}q\367p\366s\253\276\250\3648\033\327\304\203\032\325\0321\245]\365\305\002v\221\373\265\347\360\266\273\035z6\327\341q\227[\325\r\ra\037\236h\364\252\264I\243\367\004\216H\2726\327\316kK\013c\366\247\2375D\276*\327\032\016\341\200\t\\\327\264!oE\276Z\255\237\252\002'L\340\272\246\275\240\306\260\2054\013MW4'\203\223H\226\302\317\317\234\ry4G\214\240\322V'c\336\233\2730\204\353\272\302xqy\334\025"
+	.string	"A\r\344\315 1rJ[\251\214\3178\204a\b\3275\r\306\213\213\301\317\213\273\313i'\203|\231\033\026h]\271\020!\370y\321(=\357>\314\305 \217\326\364\021\353Z\345\315\232uM\223\261.~^\334\264\013\031_\374y\220\361\305E\356\376=\315k-\222+\224Z#\\\327\225F_\321\023\270}\007l?M\373\2320\"\277{V\317\346Y\301\305\263\201\013\270\177\353\267;l\337\362\355\336\352\355\235\265\263y[g\351,\336\316\331\273\265[9[\267t;\267q\026\316\276Y\271u\263q\333fuX\270e\263k\026\272o\353\266j\266m\323l\016\213f\331\366\314\256\255\231U\3332Kf\323t\344\270\300\202\n(\230"
+	.string	"\307\r\0335$\210"
+	.string	"\202\007\034\2401CF\f\030/\032`\300\305\002-X(\220"
+	.string	"\002F+T\244@q\300\211\345c\242\210hH\250D\020\211\021\"\f\b\001\242"
+	.ascii	"\365\003\320\217\007c1mF\356=`p%\312\235e\023\247\357\236\313"
+	.ascii	"\341\343\325\323\367\315\323\367\025L\215\214\374x\361\354\300"
+	.ascii	"\\v\274\201z_@\021]z\337\277=\277:99\274;\320\245\016 PV5\206"
+	.ascii	"\267\017\257k\356\313\267\267\342M\312\037\026WW\234\257\036"
+	.ascii	"\2347\274w\340@y\355\274}\363\336\264\334x\353\250\371\322is"
+	.string	"\252\341\305K\363\235\223C\032\336;\25574\274vc\276rPp%\307\fq%\321x\353\306\210\341\245\233K\261\270\272\302|\343|\371\302\3712\304\225<\343}c\366\225C\301\2254k\216\361\272IO\200I[\210\361\306y\300\340\355\n\r\213\253+\313\267M\2260^\035\262\200\361\302\261\361\200\301\2103\314A1,\256.,\3375P-)\274o(\270\222Z|\345\344uS\300\353\253F\353\333\246\205\003o\232(\337\034\242\360U\026/\232\346\227-}\321\034\342JR\361\236I\031\350\023\b\207\202+\271\225\022EQ\211\rq%\231\360\256\361\325S-\256\244\027+Y\302kF\311W\r\005WR\t+a\362\226\031\342J~\245FK^2(\270\222_\207O\237p%\247x\323R,\256\256$\327Q\202\253+\311s\340UE\023\371\002\304[p\230\210\310\025\030\236\202>eU\206<\201\341q\024\022\362\r\300\333"
+	.string	"\374\343\032~\227\300o\007\216\300\017\257\252\217!\340\373\003|{\354\200\336i\350\331\361\f9\227\221\276\bd\303\347eUv\251\020\225\330\362xUu\034C\016\035\303\2203\307/\360\252\3444"
+	.ascii	"\347\f\244\f<\345\276\034\257\352MJ\024\307\353\314\313\252\344"
+	.ascii	"\260\213\364\001\350\024\304\343UA\323\020dv\3118\274\300\033"
+	.ascii	"\324(\204%\016\354\\Up\272\205\333Y\250\271\002j\236@z\242-m"
+	.ascii	"\221\206\021P\303\312#PV\225\003\033\271\035\036\201\262*4\274"
+	.ascii	"\"\357\351\334\030)6,\256\256\271\253@{\212\324h\356N\352xUh"
+	.ascii	"\351\212*R\n\3050\212TD\230\324\001\274/|\200\025+0?\001\346"
+	.ascii	"\313'\025\261\256+\n\256\344_\352\200\031\233\260bu\366\242\273"
+	.ascii	"\027\237o\364\302\024rY\235\235h\354Ci\213\263>n\216W5\226\236"
+	.ascii	"8\023\205E\214\205\262\274D\2260\016\002;\211\364\205\223\016"
+	.ascii	"KhN\327\016/\253\302\302#\300\276X\004\230\027\033p.\253\255"
+	.ascii	"\207\370\223\224\203\330rr\001[Z\254\342\200@Y\225\223?p\224"
+	.ascii	"\003!\300e%\345?/\253\212\302\036\262\244\330\210W\325T\233("
+	.ascii	"\271\030\245\344\024\353\035\242I25Z\327\365rgf\023(f\017\030"
+	.ascii	"\254\353\272\274lb\365=\362] (\273G\263k\301\213\036\004\227"
+	.ascii	"O\246<\207\205\376\254\353\212\343E\003\301\0352\342\021\317"
+	.ascii	">l\217z\216\202\202\306\027\033\350\343=M\314\362v\326<\321\317"
+	.ascii	"\275\221\256\262*_\021\267\351\346#\202\361\213\311\020S\353"
+	.ascii	"h4:\307D\214_\254\271M\023\255\275\001d\240\237\303B\211\274"
+	.ascii	"\326u\305\321~\273M\\\\\270\320\031^{\034d\302#-\364\326u\265"
+	.ascii	"\301\203\307\302\243\341\021\361\210h|\221\201\376\335\213fY"
+	.ascii	"\330\316\340\2368\332\233\226<G\243\321\275\242~\256\001mZ\230"
+	.ascii	"\f\375\257A\264I\371\0232\352gi\346\022]\320F\375?eYrwY\001\013"
+	.ascii	"\372\2026\362Irt]\264\005\275\254\334\223\344\350.\320-\332E"
+	.ascii	"?\317\002-\364\305\242[tZ\247$K\036\243;\370K\026\235\356u"
+	.ascii	"irWC\311\222\315P?\025h\027\324\344@q\037?'\005\332\206\260h"
+	.ascii	"\030\234\251\273\017\t\364\373\372u\b\264Q'\300\207@\0035\365"
+	.ascii	"\026\232\3347\243f!\fQhE\f\266\203\214\252\221\247\242W\264\007"
+	.ascii	"\267\024*Pt\2129(:\307\327a\224a\213+!\367\003\372\005\273\003"
+	.ascii	"\032\205\260\303\240\023\275\2732\270\016\031uCo]W\034\313sL"
+	.ascii	"\207\224\332\207\275\270\310)$\223i|\361&\372D{\360\223J|\342"
+	.ascii	"\350N\300E\275\213\244B61~i\242\215\240\332i\027\372>%\f\350"
+	.ascii	"\242.Z\373\020\310F\220\304\213#\275\030\211\332\210\033\244"
+	.ascii	"\227+\244\024\242\036\0226X8\324\313n\334f\241N\366\255\343\226"
+	.ascii	"y\240\357\352+\223\246#\032\335#\324C%ZD\013\365\225eI\216nP"
+	.ascii	"\227\350\2428e\340\023G\267\206\3467\316H\242\203\372Jg\222\243"
+	.ascii	";\242I\364\245\022\237\326 \257@A\202\215\350\327}\031\320\""
+	.ascii	"\372J\302'7~[h\326\276\355\233\361E\003\272\206\260\301\263\346"
+	.ascii	"\210\020\275\243\r\207\020\3756\"\372\271\227\373\235\264e\275"
+	.ascii	"\375\354\213\0307\005\3619}<,\007\321.\2601\032\244\227-\244"
+	.ascii	"\024)\306\027A4S\030\237\337\365Z\ra{\n\r\310k\265c\205\375\235"
+	.ascii	"iU\020\215\036\206\350\347\356\036\004{\271\332\235H\006I\013"
+	.ascii	"\310\247\332_\373j>q\224\211\242\321h\001\252\225\035@5>\265"
+	.ascii	"\237\253f=\001\342\0271\022\265AI\364\360\0271~N3\301\374C/\255"
+	.ascii	"\230\017\375'a~\205\037\372\271\377\262E\243\207@]\345\006\343"
+	.ascii	"\362\031\177\271a\037\266GH*T\214/\" \f\220p\317\212h4\361\347"
+	.ascii	"\177\247\021\215\"z\350'\022#P/-s\341.H\272\220\317\247\361E"
+	.ascii	"\240\246 \314\356\254\371\304Q\273h\264\217\261\237\313v\335"
+	.ascii	"^O\306\250\350\241\303\007\305}^\354\347r/\364\353.C\255\353"
+	.ascii	"\223\002 \016\341H\221\202\362\347\372^\232\271\273\313Z\376"
+	.ascii	"\276\334\025x\312\033T\343\203\342>\333\277\013#\333\365\357"
+	.ascii	"\372r\037\201(\325&\311\321\025\261\336\2051m\266\353e\251f\222"
+	.ascii	"\243\273,\306c\310+\373\260E~!\301\370\313\027\367H0\343\213"
+	.ascii	"i\203(\223\267\203SL\363\211\243Y\220[\354z\2016(+\003\274\213"
+	.ascii	"\324\202\334R\327+\332\234\244i?y\323\222\327\021\215\036vWY"
+	.ascii	"\244\027c7\210D\265=(\356\263\273H.\374\205\364\362\263\256\253"
+	.ascii	"\215e/\033\220g?\353\272>\354\305\375\n\306\027\273\201\320\236"
+	.ascii	"8\272\313O\266\262\302>l\221`\220b\370\313\027\367H1\306\027"
+	.ascii	"\271\237'\fZ\330|\342\350\032\361n\006;\370\313\317\265\212\266"
+	.ascii	"&k\n\003\223\355\264\233\226\374F\243QB\356\347\3567\032\215"
+	.ascii	"\022nW\331\035\301\313v\257\373r\335\353\276L\247\362\362\234"
+	.ascii	"\020/\307)\301\313pT^~\303\311/\313\251\274\354F\345\345\270"
+	.ascii	"\333}\271\315\347|\031\356u\276\354\366;_fSyy\215\245|\331\214"
+	.ascii	"\312\313_\030\312\227\275\250\274\334\205\243|\231\213\312\313"
+	.ascii	"e\337\3732\231\312\313^<\365\345+<\365\345\247\312\313U\270\352"
+	.ascii	"\313]l\365e.\266\3722\025\225\227\235\314\374\362\326\367\276"
+	.ascii	"\254\365\275/g}\357\313P8\352\313N\356\367e,\225\227\257\356"
+	.ascii	"\367e\253\003~\231\311\361|\231y\301/O\275\360\313\312\243\375"
+	.ascii	"Od*\337\027>\315\367\177*\357\375\256\346\373\276\227\371\237"
+	.ascii	"\367\267\357\361\376\366\375\234\257\371\376\356p\337\333\275"
+	.ascii	"\315\367uw\363\375\234\020\357\301\250\274\377\242\362\376L\345"
+	.ascii	"\275\231\312{/L\345\373.<\365=\227\357}\237\200\367}\277\345"
+	.ascii	"~\337\227\275"
+	.string	"\316\367Zn\346{\262\317\371~\354v\337\213=\315\367Y\232\367a\315{0\225\367X\232\367_*\357\275T\336_QyoE\345\375S\345}\025!\336w\005\361\236K\345=\025\225\367ST\336KQy\357Ty\277\325\274\327Ry\217\203\312\373(*\357\263T\3367U\336CQy\377D\345\275\023\225\367XB\274\277Ryo\025\304\373&*\357\253\232\367T*\357\231\250\274_\242\362^\211\312{\246\312\373\245\312\373\251\021\274O\242\362^J\345\275R\345}\224\312{(\225\367I\225\367O*\357\235\210x\277\016\361\"U\336\243\312\333\244\362\" \210\367\006\"^\033\206x\221\250\2745\250\274GT^#D\274E\206x\231T^\"A\274KD\2744\f\361\016Qy\225\202x\205\244\340\r\242\362\002QygPyePy\223T\336\030T^\030T\336\027L\360\"\251\274?\016\340\365\021\304\353B\t\336#\225\367"
+	.string	"*o\013*/\013*\257\001T\336\002\250\274+\b\361\252\200\2027\005\225\027\005\225\367\004\225\327\004\225\227"
+	.string	"*o\t*/\t*o\017\225w"
+	.string	"E\274#\250\274\"\250\274!\250\274 \250\274\037\250\274<T^\001\250\274\0364o"
+	.string	"T\336\016\016\340\345 \210w\003\225W\003\225wG\007r\313'O\034] -C\363\263;O\351\254\32234\2206\341'C\317\320\036\326\254<eh\276z\261llO!\\W3Ws\225f\254\003uYKdS&u\f\315]\335~]b\222\372oZ\035C\237\310C\214\302\320/4su\272Fe\314\276\301\320\026|Q\351\027\232\304\032\342\240\222P\n\363V#\365n\223Z\323\032\177\311T\332(u\202\020c\353\270\3673^\251\326\261\217\355\b\210\324|u\023\242\020\001\227Of$\232\301\262A?\367G\237+\253\231\303\221\314\217\256a\354O\203(\fB\363\226\217\336mrk\202\272\320>\232\335R'.\364\343\214\3359CkAV8e\307\005Piobc\3448\315J\316^P\364P\321\003\2479N\027\t\036\365\363\232\34143y\312%\017\317\334\340\031\262$GS\253\243\3561f\247\360"
+	.string	"\335B\363V\207x\036B\323\252\205\352\260o\007\350\263\3555\333"
+	.ascii	"\335\202\026\013\315b\017\356i\211\222#HG2\006hV\362b\342\330"
+	.ascii	"\342\351\352c\003\200Z\206\330\207\307&\307$\203~\356\n\246\236"
+	.ascii	"7\035\f\245Y0\365\210\345\340\254~\002\232\271\005\350%59q\351"
+	.ascii	"\324B[\244I\232\fU\244R\005\350c\215\325\235\241a\361\023\320"
+	.ascii	"Mp\232\346\370K\326\352\243\305\341\321P\013U\341\225$\221\327"
+	.ascii	"\007\212\301\n\315\243\031J\267\240\222,uJ\327#uG2+\264\221l"
+	.ascii	"\354\355\f\216\235\272\372\332tTq\n\255B7\315i\242\303_r\026"
+	.ascii	"Y\253\320cn\311;l\211\211tXcr\364sW8c\301\261\364\023\0174e\256"
+	.ascii	"\013\214\252\002\022\232\3374\263)\317\230B/\031\366aS\336\235"
+	.ascii	"\246=\376r\317\370b\nM\301\230\232\302\346\233.\\(\021\341\221"
+	.ascii	"Yb\360\207\017\341Ixg\231\347\202\036\215B\037\013\242\231W\242"
+	.ascii	"\005\375\\\236\340Y\272\006\023\217\223\002\276j\2426\2737\034"
+	.ascii	"\317\322\337\322L\236\200\255Z\305\243\244\200\255\372\207\007"
+	.ascii	"\232Rg(\005\305\301X\3752\024\232\204~\342\271\371\244\016\037"
+	.ascii	"\035:r\246\372\204F\241\273N\3514\241\t\320'\350\271\t\3756_"
+	.ascii	"\315\276.\241\t\320E\202J\347\226~Y\227\320\036\342z4\t}e\236"
+	.ascii	"'\216\n\366\355[\21762vfYA\353\271j >\226\037^\037\n@p\035^\361"
+	.ascii	"k<\013u\341\025\330d\310\302\013\320\252i\230\311\232\240\237"
+	.ascii	"n\355\267P\300}\303\352\021\304\020\013\027\307`\337\215\001"
+	.ascii	"\364-4E\2175\337\2219\264'B\037"
+	.string	"\261\357l\360\263\256O_n\347\265\235&<z6\330\300\370\342\216\320\003h\243\250v\242\323$x\024\034\241\217b\202g\273n\252|\301\2621xE\204\336m\032\3549\013%\272;2K\330y\351\020Z\204\366"
+	.string	"B\177\320!\364\225eI\020\272\306^Sa\327-\224\206\036]\223a\f\2758=\327\204\330\024=:9\031_\374\240\217&\266\347\f\215\331<\232\231\364\021y\364\345\210\355p\326\254!"
+	.string	"\366\240\005\340A\337L\314\316Y\363x\270\207\247:\352(\305_n\n(e\207k\263\235Vl)E\202"
+	.string	"4cQ\213\003\013@/\260\027\001\0370\3033\263g\330eu\320\327\363/\363\f\276\203\316!&\347\2549\325:,\264\206\327\272\2566\340\216\314\031^k\232\315q\t\325\261I\023\343\213<\325*\210\325\025\032\341#\236\360\210?\334\267\237u]\277de?\257\325\264q\320\273G'G(\374\345\246k\224v\332\r\232\2036>\371\006\245\022\217Y\215\346\210\303\317\272B\331\330fC\300\323q\253\311\370\342\006\315\202\230\\!\232\006\375AV\366\216\326\240\177\303\357\350\207\021ss\326\\[\350\f\2756sd\001\257Vce\253 \026W\b\367\004A?o\370W\211A\315\b\241\036"
+	.string	"\300\353:\203\006@\267`\006\375!o\017P\n.\311\321)\0070\030\302\333ic\250\034\273\370K\f:e\363\005\312]T;\265qr\312\241\321\317m\263\337\256\273\314\236+r\210e\342f\350\b\3029z;\f\230+\307/\376RG\033)s\364\261\262$\236\005\3159\265\311 b\274]\027\360\327\025\324\241EcT\320-\246\346\005\f\371\254\240o\f~AL\204AAsAr\314\202|R\320+\376\004\r\017_\210\375Z\272\313"
+	.ascii	"\002\252\361y1U\022@.\rL\220\256\305\3008z{\313Q\013\177\271"
+	.ascii	"\255\245\313\216[\270\034\275\024\360\3653\276\370\304>;\202"
+	.ascii	"\341/'h#\251v\332\033\036G\037+\313\340Y\223*\t`\031\003\337"
+	.ascii	"8\343\2654\003f\t\373\3518\311$\272\350\347\256\226.>\375\r\252"
+	.ascii	"\355a\371\275\230\33591\342\272\256O\013\3643\313r\332\376\311"
+	.ascii	"\020l\362r]\327\025ly\314\376\375\254\253\323\235\237\262\316"
+	.ascii	"\321\221\255S\326\006^\334\355\257\335\375\373\235?^k\325\232"
+	.ascii	"\2666\360\342\361\224\264\201Y\013\003\2418\261E?\227\025`7\315"
+	.ascii	"\312\237I\0256b\244\240\tp\\ojd\243Y\256\231\273,w\370bU\226"
+	.ascii	"<\265;i\362\3105G]Y\350\220\236\225\032\274\352\234i\261\270"
+	.ascii	"\321\354lv\323W\222\271\020[:\025`g\337h\216\303\301F\020/\001"
+	.ascii	"v\322\023X\255\r\336\255\353\212@?\327\257o\264\013jtP\334g\331"
+	.ascii	"I\337\257\215O\346\035v\266\215f'\315nJ\262$G\227\243\272\270"
+	.ascii	"\216\2109\222ag\263\362\351\226\2475=\247\030\270\247\255\353"
+	.ascii	"jt\243\227\264Z\312B\177z\253\235G\306\034\311\2201\276x\243"
+	.ascii	"\207d\311;\263\3217\374\021Y\340k\351\335\343\332\221\215\277"
+	.ascii	"\264\321?\374\2550\317\252\n\003\241\332i\327uuZ\321\317=\331"
+	.ascii	"\334\027)h\212\037\211\361\307\334\230\024\024\005{\371\311T"
+	.ascii	"\324\350,\267e\236\032\335p\272\350\311\201f\314_\212~\256\004"
+	.ascii	"\035A\273\240\306\327N\372\3111\207}\330\3728\266\265\031_\224"
+	.ascii	"\240Q\354\245\300\273G\350\221\r\177\031A\253`z1\201w\217qG9"
+	.ascii	"\376\362\253\213\016(\372\271*\337\t\206\353\3463\002\343\037"
+	.ascii	"\033;`\254\031\256\211\326\340\330A0\205F?\320\353@CP\305\343"
+	.ascii	"f\364\250\216u\2072\201s\244\363@\027\271)\231s\240e@\263b\364"
+	.ascii	"\214^\031Mc\311\343f\246\216u\177\223\352$G\2739G:t\214/\316"
+	.ascii	"\350\242\265\345\223\216\312;\n\312h\031op>\340\027\r\243\267"
+	.ascii	"\201\216\321\310)Q\355\264\333I\020tx\255\353\372e?\035\367\256"
+	.ascii	"\006\307\213\333k;\035\373\374\216\200\200\306\027at\033\303"
+	.ascii	"\f\244 IL&6\206\031Db`:\nBC\210R\220 J>N\270\320\002\377X::\262"
+	.ascii	"\244\304\301\017$\244\027T\245%$\035\bI\002\341G\b!I \374 q\304"
+	.ascii	"\004\004\351GQH\022\b?> aJ\362\241\004\004\311\004\003F \361"
+	.ascii	"\203\004\024d\t\211\311\003\"E\224\222\214 -\r\001\201\304t\324"
+	.ascii	"cIiii\203 KHLI!\220|\b)\022$D)\211\311\007\322\322\222\322\016"
+	.ascii	"\"$\222xp\322\016!H4 \222T\303\021\320\021\023\020$\r\230\204"
+	.ascii	"$)\raB\"\341G\322\020\021A\212\220\360#i\210\221HR\rG\351\222"
+	.ascii	"\022\223\217#\016\216\2060\001\tI\032B\302\221#$ \200(-1\tQ\332"
+	.ascii	"\021\203\017!E\216\200\004!\031Ib\362\221\001\021\017\220\212"
+	.ascii	"\370 \202\324\203\310\020\030F \375P\002\001\b\222\021$ @B\222"
+	.ascii	"\216:\200\341\310\230\264C\b\222\037\305 KHL\032 1\035\365PZ"
+	.ascii	"B\002\003\b\244 GK\034\370\350q\004I\310\007\"\004@\n\222T\002"
+	.ascii	"\223\020\244\245\245\">@ \001IzAii\204"
+	.string	"\037IC>\254\217\031?\222\206\320`\212\001\206$ /\320\020\222t\024\204\206\217%\"4f\024\255\322\020\244%\032LJJK4\322\236\036\002\227\264\302\300\247N\356\0214\277\334G\004\226\341\350\231\372\271@|K\\\327\315W\004\306\231\216\351\372|\2100]s]\007\251Q\311)\235\311&\013\025\3622VM\035\3114\023\353\3668e\\\262P\"\257\272]\033\316\030\225\034\231%\214L9w\321\204m\007g\030B\271(\252\245\017lrQE\272JX\037\215S\314\2605gm\n\233BTbK\032\372\271\314u\031X\224^\330\233\n)\366\273tiF\373\033\254\f\333\233!]\372\205}\202-\013\252t&\257\214\312(#\0244\313\350d\\\243\204\207\206}\336\314\006\371\b\022\022\346\261*\342\t<s3#Lc#HG\251\237\313@`\234\271~'L\2668\203\300x\261\231\273|\201l\370\b\001k\306\302"
+	.ascii	"\3576-An\341/\017\326\307aJ\262\235\376\302I\207\025\344\253"
+	.ascii	"]P\363\243\372\352\313=-;S\263\002\221\201\335\272\371T\300\370"
+	.ascii	"\265\210\245\353\272\2563\364\223\335\372y?am.\252t&\365\f\376"
+	.ascii	"\201e\322u\345\322q\303?\260\fGY\006f\323\273c\347x\266v\326"
+	.ascii	"\3446~t\222I^]\207\016\336\025\257nD%YrJ\037+\375+}@\334\237"
+	.ascii	"V\372\204_\225>\225\376\263\253_\245\257\f\344\352w\365\355\232"
+	.ascii	"p\365\337\230E\317\232S\372[}*\335\210Jg\222\243\227\322\237"
+	.ascii	"\322EA\266\276\263/\245_\244sv\214\253b\234\205\246\200sd\016"
+	.ascii	"y\275\331j&\263\304B4\030V[\313\030\372\271Z\275\243\350\006"
+	.ascii	"\211\023\344S\253U|\335\t\fjlz\324\366p\350Gifk\366k\263\320"
+	.ascii	"\327\321\341\310|\035\034\016\375:Y\375f?J\027\255\255Y\350\241"
+	.ascii	"\320#\363j\336\262\372\320=4(\375'\375f\027\005\225N5\013\315"
+	.ascii	"\321vd\336H\003\245s\354\241Y\250\f=\266#s\001\2753\375\303\027"
+	.ascii	"\273\230!\276\260\326f\026\332\302K\255\314\255\230i^\353\030"
+	.ascii	"nJ>c\026\312P\275\"\332\221\311g\364\304\230i\236\362\016\002"
+	.ascii	"\315\370\024\242}Y(\013\2573\263'f\202\204\\\022\260\245i&hF"
+	.ascii	"\266P\026z\305\261#\023\205X\003jlU\234a\b\311t\365\235"
+	.string	"A\362Q@\263\363\351\\\027\230\224\013\307j\236k\346\213I\266.\265\275\271\006[\250\n/,G\346\220\327\027k]\204;K"
+	.string	"\227y~X\365\235t\001>\372\271|\004\343\254\3653\251\203\207N\nz"
+	.ascii	"\b\3004\323I\037\253\331ie\241,\364\212\317#\263\206^\025'\r"
+	.ascii	"\204v\325\307\352\324M\031x\325\036\020\225y\300\364\255\232"
+	.ascii	"\304\225%\200\251\013\375\344\264\243\256\202\364b|\223\016a"
+	.ascii	"Gm\217\255H\005\351\005\nRJ\223f\255s\3404\373;k\036@\355\314"
+	.ascii	"\235\026\234[Zyfc\305\254&\024B\302'\216\016\026\261\026\272"
+	.ascii	"\242xud\242(ZY\231\3251;d\241\230\\3<N\025\251\230,\221CH\250"
+	.ascii	"4@]\267\332\232\236"
+	.string	"%\005X\026\247\212I\314\350\314\b\237\266\314\274\020W\350\347\336\340C\201\275t\2117'h)\360\227\376\227/\275\333\224UT.4E1\352\310\034*B\331`\026w\326T\241\214y\364\253\232\275\364V\223\024\376\222\277\024\026\235\026Z\242\2706\031\352\210Vu\017\263\270o\2329y\322R\350\347\262\t=\370v\365w\002w\351\2375\363T}\203\316\332\330XW\323\223\277<Uw!^\334\035T;\355\231\364\2274{i\2563\324\201I\277\315\036Y_I\177I{\020T\226\235\365\315\372J\232\233W\341\312T4E\241\237\273\\\232\273\364\005\202\312=If\177\331\314\245e\254\0212\273\331\366\232MW\276l\306\341<\304L\201j\247\327!&isB?w\252W\240\355\371\332\267\251\346\346\213tf\3203*\023\372\271LB\232\347\334\243\004.\353\2335s\315\272\325\314\3501*!@?\027,\r\\\350\377\364"
+	.string	"\233\f\177G/\375+\353\313\355\241=q\264\223%\340E\221\320\317=\362\212\361I\032\004Z\332\227\244Of\346V\330d&{\013]\341\245\367(fl\205\227j&\353\216S:\225Rm\\S\222%\355\344\035i\312r$\243l\243\323\214\355\f.\252\351,t\205\027^\352\267\314\363\364\250\376\03333\205p\314\036\375\224\263\320\024i\335\2219\224\322\245}\306\242\204\204L\350\260\314\f\240\237\313W\277\223\211\210\366\001{\265P\233\241\230\006\347\322\314\335C\215\245p\336\244r\347\322O\366\241\332D\335\\\377\251\237\344\255\276S\377\251\215\210q\013\255\241\327\246\311p\206\236\016wr3\226X\2106\302:#e\263\006\331_\217\310\246>\"\240\233\324\264\245A"
+	.string	"[Y.\021\341\00647\364\233c\207\205M\343\035\341T\b\036\312\242t\324\366TLYy\003\341\003\033:=\263\206\244m\250\001\311\225\\\333\235\212#]C\027\371)\313\274\332H\037i\024yd\026\372:iM\206\257\033c\244_\347\013\355\211\207\007\253\350\030\001\024\221\221\212\t\303\324E\2100u5\021\017R-_2[\032<\013"
+	.ascii	"\ri\027dT\016\257\224\313\220\246\241\213\342\224\206\264\021"
+	.ascii	"T;\241\t\301\325J]\344W\274{\262\247\003\032Gz1\n\351\333I\311"
+	.ascii	"\204\364\233c|\n\233\"\004\267\3508\200\361ki\276z\2132\321-"
+	.ascii	"|\245\331\253\331\311\201\272\326\022\355\224{\222W\230\237\035"
+	.ascii	"dK\023\227+a\033\254H\301\232\360X\220~\245X\232\274\2345\201"
+	.ascii	"\001c|1H\033\260\226\030\204\327\250\223\361S\321`4\020\262 "
+	.ascii	"d\n\311\220\2106IZ\003\003\026@ 80*\232-\223&\037\023@\304O\310"
+	.ascii	"B\252\"\345\234d\246H$I:<fI\374\234\302\3569\025\242\361\224"
+	.ascii	"\325\214\275\372\017\003|{3,\337\324\271/$\310?7\177\2441D\245"
+	.ascii	"qOt;k\365\020\204G\376\275\0344\274\252\205\216\356\325\b\252"
+	.ascii	"S\251\217\230.\307\303>\214\265~;Dg\217\374\327\037\013r\347"
+	.ascii	"\372\372\243\323\r\2027\223\007\332:\263\314\221J\305\r\207\377"
+	.ascii	"\261\356!\211\261=t'\275\345\361\203 \246 0N\034}\374\347S\027"
+	.ascii	";\204\004\3326B0\265\177\221\373\341\017x\243\367\005Y\321\270"
+	.ascii	"\"T\352~\373C\341\335\374\345\026IQ[\331~\036,\272\215\245\340"
+	.ascii	"6\250\225\226\320v\263\352\273\227\316\242#\332\022\035>)r\025"
+	.ascii	":\200x\322^qLS\345\024\335j\351\0272\336\004U\323\343)\220\275"
+	.ascii	".:O\312\370:\263#\260\322\346\246B\027\345\0130\341NP\2124\022"
+	.ascii	"l\326\344L\245\241#\2369\320\310\002\315jJ{\244\204F\251[7\340"
+	.ascii	"\317X\003\265|V\326\013\030@\025\272\225Qq\\\203\340I\214\004"
+	.ascii	"\"\0340\353\270\332\033\241\222\373|\243|\352v\242t8\033=\\\244"
+	.ascii	"|\262\262\264.\202\371p\251\215\031)\232\351q\n\034\231F\330"
+	.ascii	"\266\226\347`\027\326\020\237\205\207\220+3\330\243\353Bd\020"
+	.ascii	"\345'\264\231\3665\206\271\2049^F\316\006\232\322-\203QlYh\234"
+	.ascii	"<\036_\331\267\3041\202*\027\262\245\234\\\251(\bz\362O>O)iV"
+	.ascii	"E\203\035\030c\037\374\026\252\f\374\240\031\360)\343\241^@t"
+	.ascii	"\036*e]_\017p\375LF\270\017\217R$\202\373\250Z\203<]i\032\306"
+	.ascii	"\035\314\026\344\024\204\361\320\002\205\371\"\264\254\220\344"
+	.ascii	"\001|\354N<jv\341u\027\022\274\3261\277L\372\326\232\263\211"
+	.ascii	"A\251\350\332\f\034\202\344\362p_\310\355O\253o\204\241\021\220"
+	.ascii	"\245\240\203\227\302\312\020\275\277S\262{g\005Z\005\256A\033"
+	.ascii	"\227\351V/X\034\217q~`k\265\320\343\221\030\224 c\255@(\270\022"
+	.ascii	"OQ\177\370\303.\361m\327\373a~\f)\227\nj\300\346\\B.!1\032\321"
+	.ascii	"\327\252\221\374\f\213\360\363\n\204\243\2028#\025\022\271\273"
+	.ascii	"\223p\344\367\215\200\t\023\235\211[\274\241Dz\271y\252\200\322"
+	.ascii	"\201\325\261\024\324M\363\003S?\336j^\020\265\344\271\261\344"
+	.ascii	"\007}\201:\233W\260\036>\230\023\321\224P\225\252xc\345\0356"
+	.ascii	"\355+\272\333\254+0R\021 `\214\337G\f\254\255H\353\003\257\026"
+	.ascii	"\304\355r*\313l)\031\034\320D*\342\270\266\205\353\232JpE\250"
+	.ascii	"\320Ve\271\037\270\336\002\332 e\315q\004\345N+\b\025E\220\231"
+	.ascii	"\3378\247\221)\372\352\355\331\220\272\261:V\346?\243\220z\335"
+	.ascii	"\272\230\300F\316q3OfE\232\275\b\225m\367\231\231\252{g\326G"
+	.string	"\224\224fy\255oH{\267\221d\334\214\246n\304\335v\004\022\3609\271\276\004\211!\232&oz\224\377$\232\321\013'Bl=\234\330\346@<\317\035\301p\304\237\027\235[\001\030\017\261\300p\242{\310\022j4bW\336Qs\274\202bW\037\366-\310EqUz\215\241t\221a\033\177\370S\200ga\3333S\341A\3430\300\330\236\276\255j\225\005\3557\245\240\351&\233\205/\302\226\212@v\266??\231\\ \273\t\257\221\371\230y^8\327\337\202\346gx>rVY\250]\245}\177\310+\207\300b\206\343\326rF0;\321\357\022y\237x .0\005s\204\260NCq\215o\367\004\251\310\371\237\241\327\001$\267\312\306!\374\335\177\\\006\230\347\027T1\343\006z\307>\177\203\227\243j\230\361\016\277\276\362\213A\243\300\241v\017u\033*\247\020Y&e$4C\200\323?\035h\203\336N\311v\224\r\215"
+	.ascii	"\365<\302?t}`z\240\274\261+\f2\232\260\234g\033\207CDh\236\371"
+	.ascii	"\243\t\325\035\304\314\272\200F\365\026\216\330\226G'\221e\226"
+	.ascii	"\301\360\260\371\270\331%U\2667\240\t\026\\\230@IS\231\333a9"
+	.ascii	"Hq\026\037\300"
+	.string	"\006\3375\242\267\340\321\301)\3146\325I\356L3\361\004\275\237G\253I\034\023\230bz\025\331\271\201,\r\332&>\270c\340S\241\006^\216z\2061'\0039\347\307\007Up6\333C\ntk\347\035BL\344x\273\213B\244\240\032\177V>\004`1Z.\237\243\311\355R\263\005\277m\007"
+	.ascii	"k\374\354\326%\350r*<NRf\201\316d\034\235\r\330\376b\302\253"
+	.ascii	"\n\374\257\007XD\035v\372Z\021Y\217[\033\262\033o\313`{B\234"
+	.ascii	"\247\220\306q\b5B\021\273;9\237*K\003\377\b\317q\212\202\312"
+	.ascii	"t\277@\257TT\257\257\271)"
+	.string	"\020,\256\226VR\204+\276~,z\365\344\246\341\272\217\224s\3600\210\022x\f\020\237T\360i\266\026itr\034\2507}v\332\037\224`\205x\273\177\361\234\302\240\212\310\310-O\267\f\253\230i\315\fS\205j\022T,\3325\300p\036{U\245\311\237iJ\252\031\001N\025C\3449\261q\325\233\226\370q\343\360\217\037T\212T\336&\355E\205\264\235\246\nY|B\367(m\203W\272\251\205\215\001:\3654\233\334\3112\f\037^M'\b>\2768\253\bJ\342\270g\320\354\252-\034\"\227\265\317#\026\002\272\352ueiov,\tj\334\247X\346/\304bM~\036_\007\367\002\2309\322\032\003L Um1\007\004\034\214\323\003\210\327\250\236\233\316f52Oo\363\361\304\270\310\277aA\246<\2131\330N,\344\221P\367\022&\235\365\264\246\236\030\251\302*um\372\326\375\255\213a\241;5\264E\237"
+	.string	"\210\317#\017\226\fp\275\027\356\271z\360\020\004\277\245{\350\031\331\323\324\337\354\324[\267\243(\260\253/\206\340z6\235x[\377\004cT,\303L\003\325\355\036\206<w\327\332\323\0233\260B\362&\344\231\313=\235m\327\3721\256\226;K\001bI\177\230AkQjh|sz\235)\375\251\241\353\351\004\215b\303\267\307E\241r\223K%\300\226\371.x\b\235i;\314\244\370\036\266\345\223\022\fa\245\002M\b\325\260\341\202-\373\362\231ED\264\367\311\342\337S\241\216\375\356\220\352&j\335X\227\274\345\026M!\367\316\023t\b\221\317\312\212\263\205\bv]8mQ\353\251\303b\330p\341\336F\f1\f\007nOA\360tv\220\036\241\211\231\t\2247r#\260g\352\251\246\330\t\321-+.v\002-\3528\214[\b\345* K\223fq\354k\307J\3754\351l\231\3055\005\336\236\372\367\033\367*\341("
+	.string	"\201\360J\227\341Y\315\033\215B\020:\263\316\2762\204\332\317\025\341^*\333\300\035\236\232U\245\344'"
+	.string	"\234\036\236\367\006d\274\177\301b\275\306\277\2529\277\023c\340SF\344|QTh\327\250\272$\255\2640\354Q\272'b\212\204$\233\303\310\345I\024U\016d\271\351\225\364\260\033\345\363\365/\341,0p`B\251Y\2645\266i\341\205\212\275\005\243IE\214-\313]]\366\222\370'*Le\034\204)\255\274Z\021\177\026B\320!\231\220\350\352\203\250\215\303l\245N<?0\354\360%\277S\026AM\302\360\257\344\205M\233\336^\bL\233\370\324zJ\263\004\317\006\217\fAEV\007\217\213,R\300=\344\226\260\001*W,\314\241\256$;XaK=\2318\t\367\351\363l\375\222\005?]\035m~\256\233\002%\321\026\275as\371\007\030N\206\254G\250\260\020\026K=-Z\276%7\370\003\207\322\264\200\300\224\206j\257"
+	.ascii	"a_nB\266R$\322\354\305\263\210\r\255l."
+	.string	"\220\351\272G\225\f\n\253\301mkfp\033\2610\322\352\0252\t\267\3057\021\346gZDZB>\\\236`8XC\r\321\032 \235\224n\230\215f\0232}\351\261\003F?~VyV\330\\\232\263\215x\234e\211\266\311\210\017\2760\364\271\016\275\300\274\220M\016\007\213\002\275\334Z\200=GY\235\005\264\274 \346$E\360\302\310O/\374;\374ED\036\023\366+jE\350\r\266\017\035c\241q\312\362\230\311V@O\214\302\231\251Uv%\342\247\354\241~\234\211\330\025E\252\325\250ZN\247\364\312!Vx-\315\221\207\351z5\031+<\036\350\212\247\250\355\250cC}\031A\343\007\022\203\322\245Jz\357\322\327F\211\325\263\315sC\204\325Q\207\260\006\206\225D6\275\312\312\b\233\200\016s\333)\226\020!Z\261\326\032\331A\022\343\276\324\225F\354\322T\266\230\205QP\303\270\211\030:W,\322\300c\221\206"
+	.string	"@K\263\270/\227\226_"
+	.string	"\256ed\263k\300\204v\r\320\017\177\305\330\301\374h\204g\250\036\262\036\036\213H5]\254bf\202\334F<A\246,\304\363ko{\261\2309\276\366P2<Iu\223\242\t%\335j\327\256\276\021\333\341E\333g\236\320\315?\211\320\350\365Z]\306\374\250\376Y\022\352\276N\350`'1\376\226\243"
+	.ascii	"\351\202\005~\350\260\356\201V\214\024\2103\\\013\002&h\300\276"
+	.ascii	"w\245\210\326\345\254\221\315\016$:"
+	.text
+	.section	.gnu.lto_crashRecoveryModeActive.205.bf6dcfc108f8cc68,"e",@progbits
+	.string	"(\265/\375 \345U\006"
+	.string	"\002\314,2PO\323\001 ]\3504i\304\241Z\002A\f'\217RBj\313\212\227BBlco#\2004@4HUE\024\002uvr!*k\214\243\211\2252\245\216\240\006\211zV\004\204$\361\360($\206\211\027U\025\017\"\360D9T\317\232\246\352=q\257\232T\003M/\354\223\274\004\372\033[\\y\356\216\177\001\334I\025\330\320\262\263c\226\352a\377\262\273k\325\330N\247\026\250l4\316\321\355b\272\226MqPDl\3376f?FH\300\f\037A0\003+!\233\t\313n|\372q\370\204\376G\276\260u\234p\231\354\031\240\260\273N.\223q\353\017lc\004\007"
+	.ascii	"2\001\0238#(\016%\\f\207\273,\315\206w\335\033"
+	.text
+	.section	.gnu.lto_pidSetAcroTrainerState.206.bf6dcfc108f8cc68,"e",@progbits
+	.string	"(\265/\375`\201"
+	.string	"m\n"
+	.string	"6\323HB \251*\035/\227\340)\226;L\233\025\004`d\311]\340\201\232\320\221\374\002]!\213V\206\032#h\217\337\262\215\225\221\241\266H%YV"
+	.string	"@\027\211\250\fh0\372\"\030I\021\n\354\233&[\312\224\0023"
+	.string	"7"
+	.string	"5"
+	.string	"\026\346\234r\005\274{\\\355\374\307~\361>\324\243\245\365\215\017\263"
+	.string	"\021\034\276U\224Hi\320z\354\032\362\251T+\2339\247\325\373H\356\355\266-lK\373\017\353\212\007\377\275\372\025\b\232H\311Q&\3149R\3030e\333\202\002\266\217\261\255jSTt\007O\231SH"
+	.string	"2\2303\234p\204\345\233;[\302\303\0013C\003Y\b\002\233\325\242\274\033\327\312\312\240\n*\314"
+	.string	"\354\276v\277\030\007 \254\364\202}\003\017O>\001\227Lz\357\233oj\370\366\005\2019\200\231\244\264f\207*\335\227\3758\003\036\216\303]\224< \213;\232\214\217Hr\034\033\237\016\r\t\372p<dgD\222\232\214C\"\317Hr\241\320Hb\302\324\343\\\327\345\301\211,\265\252X\321\2706\351C\357\371\261\007\016"
+	.ascii	"3\241\017(\360\202\327`\274\027\251\315\005\3618P\214\200\256"
+	.ascii	"\341\004\023\030P\335WR\343\304\235\213\252\035\032\230\202\002"
+	.text
+	.section	.gnu.lto_pidSetAntiGravityState.207.bf6dcfc108f8cc68,"e",@progbits
+	.string	"(\265/\375`\245"
+	.string	"\335\n"
+	.string	"\226SJ? \345Lc\340\360\366\3443"
+	.string	"G\"\203\346\302I\021<\227\337\317Z@D\021\244\302T\243\017\216/5Av\301\001\323\320\211\311\324(\020\n\242(\002n\016YB\021\031\r5|\033\331R\312\224\0026"
+	.string	"7"
+	.string	"9"
+	.string	"\272\f\225\337\275\327R\222\217\257t\216\376o\357\304\310\326\253\354\264\026\360Fz\004$\254\"\204\310\310~\373\324 _sn\030\356\275\2361\222\343\016o\273\301\266\265\017\n~\275tf\337\366\327O\177cP\300\245\343 ,\367n\004\017\334]\bsb\373\036\333s\332\n\013\343m\254\317\007\264\330b\356-\023|\300y\350\321\366\275,\271\037\001\001O9\316:\f\347\234\323<\024k\001~\277\371B\200'B)\255\322S\b\034"
+	.string	"\3304`\037\345%\3137\261j5\037{\350\2574\017O\037j=\240\207k\006\355\2625)\315\001$Q$:\250H&\216G\241\210\022\312\212\024\023\245\n\tk*\211,\354(uaC\037\237P\244\224\025O\247\224\365\224\367\365\322\231;3\267\235\213\276\\\351\n\252\346\003~TJ\323\201\034\022"
+	.ascii	"3\241Sh`\020\016\001\223\203{z8\3275\004\312\202\007\021\006"
+	.ascii	"\020\031\005A\034 \346B\327\360\211Lx%5N\334\271\251\332\231"
+	.ascii	"\242)("
+	.text
+	.section	.gnu.lto_pidAntiGravityEnabled.208.bf6dcfc108f8cc68,"e",@progbits
+	.string	"(\265/\375 \345]\006"
+	.string	"\002\f-3PO\323\001\340\024\nDS\212$\250\226@P\220"
+	.string	"\n\224\3700Y\257\024\022b\033{\033\001\244\001\242A\252*\242\020\250\263\223\013QYc\034\021$eJ\001\216 \007\211z\226D\2044\001\361*\244\006\212\027U\026\017*\360D=T\317\232\246\352=q\257\232\324\003M1\354\217\234\004\372 \276\270\362\334\035\377\n\270\223:\300\241\345\306\216Yj\207}\200\335]\253\306v:\325\300ee\343\031\223\335n\363\262)\316I\210\355\333\306\354\307\t\n\230\341\343GG\300\242\262\225\264\354\306\247\036\207O\350_\344\f[\006\205\303dO\201\205\335ur\030\215[\217`;#\007"
+	.ascii	"2\001\0238#(\016%\\f\207\273,\315\206w\335\033"
+	.text
+	.section	.gnu.lto_dynLpfDTermUpdate.209.bf6dcfc108f8cc68,"e",@progbits
+	.string	"(\265/\375`\214"
+	.string	"5\n"
+	.string	"\226\223F>@\247(\035\260\253\027/\272l\022\271\202\026\0267#\226\2752\373\377e\345\330\367\020\211\020\236\327~\343l\230'%2#\267F>-\244\352\2473\\\343\201\247\021\220\200\334\203\222O\310\3362\2453"
+	.string	"5"
+	.string	"3"
+	.string	"\255\013\002\013vwF\021\317\213\336eT\317\247h*\037H\272\324:\036\303k\006x\222\230\335\275\200+\006hR\245hv\327\372\201\0337v\333\f\266\247\375,\0058\376\361\332\325x\271v\205!(\261\037\332\226[l_\355\003x"
+	.string	"\357)\033pe7A\352\300\356.XA;\2069BvL\376 ;f\317n=\034\331\213\202\032-\312\036\037T\254\2236\260?\340*\221Ob\213\221\376;\346\217\262c\217\r'.\006\036%}\331\241I#\210}\271\273\353\210\262\237\372\245\252\237%\204\004\234O\327m\\\247\323\274\311@x@\263\353Hx>\021\223\302\343017\\hf.\336@\034nv\333\306MKXzD\271\3022Y\225\242IJMe\264+B\372\3172\222\002\021"
+	.ascii	"3\003\3469D\2530p\007\214\025\252U \002qC\004\0034\204=\227\321"
+	.ascii	"5#6\253\323\3025\0020<jd\177(e"
+	.text
+	.section	.gnu.lto_dynDtermLpfCutoffFreq.210.bf6dcfc108f8cc68,"e",@progbits
+	.string	"(\265/\375`\364\001\305\021"
+	.string	"\006\343wG\340\360&\035\3370z\005"
+	.string	"\254\201"
+	.string	";\320\300\023\221 Q\274\376"
+	.string	"x\033\177\377H\033\314\177 \002\310\205\355\330\357_\350\255\365\300\272\360g\344!G4 \002D\250\f\300D\374\200G{\036U\306\2335id\023)S\n`"
+	.string	"^"
+	.string	"b"
+	.string	"\030\022h\332\267\235D\354@1\216\27371\220vm&6\340=\202\244\237\377qh\324\256\n\023H\273kb\002\336\243m?\304E\304\354\220\263q\330\t\260\224\201V\242\306\356~%'\351\036\271\213t\217\272\341\261g\314\177\321#\320t\302\032\215\314\363\264`w\2355\232\232[o{\200m\bv\302\002\037'\272U\027\372=\236\356x:\3654\207\246Q\232\3664}z\272{:>\315=\255O\247\246O\222 Rx\370\340\363\034\031\273\027n7\226ED\321\241\313\023=\355\333\216\371EN\331&\242\360\255\331l\201\263d\243\264\273\005\036\335\340"
+	.ascii	"\202\330\205*\034dg.F0\b\212I\220\235\231\005?r\350\357\370\305"
+	.ascii	"G\371\232\217\272\307\257\250\315\220E\35542\2016*\3454*\307"
+	.ascii	"\244\312i.}\250\303\247\252*Ig\b\344\231\205?\001\303\347f\255"
+	.ascii	"\340v\2631\263+\023\220\252\3224\002{fy\3635\365\240\222\207"
+	.ascii	"^?\206rh\320\232dy\263m2\251\032\354s\2538\0369\320/\362\240"
+	.ascii	"?\344?\177+-\027\314*\266\\0+\016\006\305\205\365`\305\345\300"
+	.ascii	"\305\202\nj\325\002\203\265^,0\317)'*,\327\007c\221\300jY\371"
+	.ascii	"\\X(\023\276\224\327\313w\002\300-\327\352\365\301Z\255\327\227"
+	.ascii	"\262\355\355\021-\221\351\314\035\232\322\021=h3\353\320\310"
+	.ascii	"\241\235\246\364`\017J9\224{\001*yzR\224\036\344\021QO\037\242"
+	.ascii	"'M%\351\204\264\246N}\243$ `\002\021\204\306\003X\t\312\003b"
+	.ascii	"\330\024\303\242\\gJ\306\342\326$\227}\201\351\217\"\254\032"
+	.ascii	"\375q\\\313\203\244 h\224C\214\3445\366\371/\323qq#\204e\r\037"
+	.ascii	"\333\230\231\317` JG\360\326v\243\306\004\222\301\310Rn\331M"
+	.ascii	"\034\213\031\300iL\355\"\003"
+	.text
+	.section	.gnu.lto_pidSetItermReset.211.bf6dcfc108f8cc68,"e",@progbits
+	.string	"(\265/\375`\013"
+	.string	"m\007"
+	.string	"B\31647Po\322\001 \361\205\003\321Z{\b\207\315\303\317\212\310\001\274\253\021F\321\254h\026%+\316\022nz#\304'w\246\252\252hV\336D \351B`\265\020\275\311\226)\005\233\214\223\220\351d\2265\330F\363\310\017\303\202\306Q\220\035-\323 5\234\203\304.o\236\214\223\237m\343$f\356\253\205\245\213I\tj\004#\254\320\017\371\f\371&?\200\364\336\243\017\002x\204\370 \361\260\030i\312\236\"\205\027\366\253\205%\373\337\257\225\300\306I\3055Rv'R-\213\212#\035\266\217\261\255j\033\034t\377B\327UN\337iw\026\230 \340\321\235\215\362\231\261\327\212IB\204ew%\304xw\355\374\203\374\342\221DW\013aw\255\036\211\342\206\267=`\033\263\315\021\b"
+	.ascii	"3\241e\037\270\ts\213k\342z\b\271\244&\203\273\274h'\031"
+	.text
+	.section	.gnu.lto_pidGetPreviousSetpoint.212.bf6dcfc108f8cc68,"e",@progbits
+	.string	"(\265/\375`+"
+	.string	"\r\b"
+	.string	"\222\31775@\223\032\003\030\022\013\353\377A\323\2141\310\240a\377jYw'\005\230\004=!\303O\371\266\235\221\277\026\314\272\002\343\262\260\263\205\344P\367M\352\311\337\244\2242\245$\355\"\024+\0025h\243Y\212\200\320$\036&\205\026\232\230\"\2164A\003\335F\016\334,m\0337=\260;\036\256 \374\240`\006\206S\032\343\374W\250O\214RQ\267,kazNY\326&\330\221\241\336\254\205\235\036\004i\035\017W\355{\205~\331/\026\2706<\314z\3719f5\217\2212W\333\256\365<\277\352\322\316\377\261\322\362?\241\007\034\313\2665\211K\2726\026a\"-\202\231\021\r\025\232\377\363c\201\215et\300\306\022\206\270\363\353j\233\230A\206\005\223R\235\374"
+	.string	"\026\376\367\245T\035.t[\203\266\bmY\002\013"
+	.ascii	"2\241\245/p+\n\"\026\017b\002r\r\327\304\342\341!\210\250p\003"
+	.ascii	"PyL\355$\003"
+	.text
+	.section	.gnu.lto_pidGetDT.213.bf6dcfc108f8cc68,"e",@progbits
+	.string	"(\265/\375 \367\265\006"
+	.string	"\242\214.3`m\322\001@\214 %t\353\375\001\226`\310\034\263(]HD\273\310\002mV\036hS)\367\310W\264A\320B\004\272\333\027\370\252\314\302/K6\2212\245\306\\\024\252\214\32384T\017\f.\242J\200p\230K\302]\006le\026.\247\261\254\313Mq\257\237T\212\243\024\366I\036\035\362\241'\f\312co\276A\322[*"
+	.string	"\006'3;nR5\354G\253\037\373\351\324\202\017x\361\216l\267\"[Y\224v\342a\373\331\223\017\362\220g\207\242\310\001\tRF:%*\273\353\250\013Ho\321\003\2447\335\370{>\377\"G\350@\023\314\263yZ\016v\327\211y,n\275\201\355\214\t"
+	.ascii	"2\003\346:\203k\b\3055Q8\004\216\031\233\270+\322lx\327\275\001"
+	.text
+	.section	.gnu.lto_pidGetPidFrequency.214.bf6dcfc108f8cc68,"e",@progbits
+	.string	"(\265/\375 \367\275\006"
+	.string	"\242\314.3`O\322\001\024\310\246\0065\312\326!\367\241L\211a\236\272\203\306\272\350\002\2615y\310Fj\234*X\243\005"
+	.string	"\305#\n\255\034\343\313\300\204\371 \233H\231R\276T\013\026\306e\036\034,\210\006'a)D\270\0136\341*\002_\030\006\314e\256\013sS\334\253'\225\332h\205\375\221G\203|h\n\177\362\331\233\357\217\364\226\032\220\261\311\220\0355\251\033\366\243U\217\375t\252\301\207\t\306a\312\256E\250eQ\332\211\207\355gO>\310C\236\r\212b\007,X)\341\220\260\354\256\243> \275E\027\220\336\224\343\357\371\374\213<\201\003U\262\216\346\t\200\260\273\316\254sq\353\017lk\004\t"
+	.ascii	"2\003\346:\203k\b\3055Q8\004\216\031\233\270+\322lx\327\275\001"
+	.text
+	.section	.gnu.lto__reset_template_146.7.216.bf6dcfc108f8cc68,"e",@progbits
+	.string	"(\265/\375`\305\001m\017"
+	.string	"\226\333bE\300XM\032\003\210'F\250\234\377\336\277\027\337\367\335\263X\267\210\3116\332Il\352|.\300\247B\260\314\00161B\251\216\247\255\f\313\024DS!X\246 \232\302@`\363\002\215\266@i\n"
+	.string	"P\\+,I$V"
+	.string	"U"
+	.string	"J"
+	.string	"w\265\232Pk\246\007w3\326\257\326/"
+	.string	"\033\210:/\353m\r\004#\206\202\0319jX\030R\270c\223\340\t\267\244B#@\345c/\350n\345!\r\360\331k\262\267\032\346,\203\203\336\260"
+	.ascii	"\202\325\220\200r\2347\214\360\263\020\356\251\002\003x\267\032"
+	.ascii	"n\001\266\215\333\t\337\361\302E\0306\3120M\303C\033\216\034"
+	.ascii	"\216\035\366\342\341\243\017/\2107\3043\021#\215"
+	.string	"XFbZ\211\213L\374\235xQ<\225\342\250\342\270b\"\026\307\026.p\230\222\376\262\322K7\r\3460\023\036#\341EN\024k1\255\245\034\304\005wN:?AAh\020\257\3528\246;^\345q\220\366X\213\376x\025\310[4\3101\035\262\220\022y\265\310Cj\344\231\036y\025\3111M\262L\225\f\323%\313\224\311\253N\206)\224y4\312\253;\023\251\224i:e.J\345\325*\257\356\237\272\356\242\001\033\316\001\325\266q\333\233Fo\036\315\223I\273Ri+Y\373\313\246\257\244\323X\022\352\236\214\372\225R\277r\352M2g\3112\303\322\314\233g\366\3114\177\251\346X\256\331\225m\376I7o\276\271Gi\274jc\231\336\030Hq\0040 \320\":\362\001w\211+\330\206](\007uX\234cYcV\001c\317\241u\2628\314\365\022B\3268\272 9\200b\254\241\023\035\022\327;\274a\t$\232"
+	.string	"\356\301\226A6J\021"
+	.ascii	"2\344\020\007\005\353\212\212\031P\330\2737\203\330i\2730m\356"
+	.ascii	"\363\260\3068\224\355\b\303+b\350\301\025\001"
+	.text
+	.section	.gnu.lto_pidInitFilters.part.0.276.bf6dcfc108f8cc68,"e",@progbits
+	.string	"(\265/\375`>\036\035s"
+	.string	"\212\2640(J \224\322\351\301\237\330\276\314T\330\226\271\344l(\201\237-~\347\\\227Ej}\016|!Q\262\005\3716\374\016$\207\367"
+	.string	"\374\t,\334\251\360\335\033`\266\210y\372\377\230bE\024\341\273L\250"
+	.string	"\207\230\231u\243Md\267\224R\n~\002!\002x\002\177s"
+	.ascii	"\371\370\316\304\366\240}||\317(G\324\273<<<\"\342\300ac\367"
+	.ascii	"\306\215\221+\350rm9\353\322\206n\256\315M\354/\210\026\202["
+	.ascii	"n\r\223\253\206\343~h\013\354\240\341\372\fw\\\0324!ha\336{\321"
+	.ascii	"\204\240j1Kxe\301\363w\357\035\242\3021\027\305\250\334b\230"
+	.ascii	"p\263\365\017\375\344\342\033\223v\033\201\215\\kwJ[\003\261"
+	.ascii	"\266\333\b\252\026Sm\363\222\363\241vj\f6\2215\343\203\017K\214"
+	.ascii	"[A\227\313\253M\027\034j\247e\2304\231%l\334Z\273Lf\217\351\036"
+	.ascii	"\326&\263D\275g\324'n(\374\335\273v\354\224c\250\235\006"
+	.string	"y\221\335{\215I\357`\302\321\332m2\331\235\271\323Zm\355\035Lh\241{\261\310\235\271w-\252Sn\241v\312kmd;U\233\310v\312\334a\230\231\t\223ye\206\366Z\331\355\266\264'd\360\334{\221\235\276\fC\243!\246\245')\376\016\2565\303\030\256}eU%\203*\006\214)\244T\024\324\361\351\205\213\026,\234V4\251`2\246XRB\221\204t\342\310D\t\243\"\242!\241 \240\037\237\236\"q\250\nm\032|\237\261rk\365\225_[\t\261\310\232\320\256\202\366\271\f\276\246\342\333\363\030zv\360\034F^O\3455\322n\016\235K\325uT]C\315\261\233\363c\033\250\234?\t\261bh\262\351\027l\332\005\264\231\206`\266Y\343-X@9\002\220\254\371l\247\036\202\371\266\002\b7o\202zQ\321\226\347\2033\231ic^G\341y!k\232\351\024mq\322|I\255\225\342\264\216-l"
+	.ascii	"\311\232j\215b\007\035~\370\244\237>7@\262f[#\205\t\032O\004"
+	.ascii	"\215hA\3433\007?2!\304\212J\363B\326\304\241K\274\321\342F[\272"
+	.ascii	"\350MG\235y!kni\"\034\350f\360!\263\026j\272\326\261E\f\220\254"
+	.ascii	"i\326AY\232\214Yf\215\314\342\2620\023\031\223\313\003}a\272"
+	.ascii	"\340?gW\334G\254{\202F\261\240\361\331\202\027\311\232V\232\030"
+	.ascii	"\f\262\022\234b\372\302\004\363!S\f\315\260V\205Xr\235#K  Y3"
+	.ascii	"\254\205\301\247?8;FR\270,\213S\236\270\355\362\2248e\205\016"
+	.ascii	"\016\301d\2418\205\313\377gJ\223\240\361\336\333\317v\257)N\334"
+	.ascii	"\207z\206\020\353\336\313\275\205\247\231F3\007\327\230\031\004"
+	.ascii	"f\244\016H1lB\250G\336\363>\317\374\243\001\357\345\317\033\235"
+	.ascii	"\274\026\023\337\347\273\353\257\370=\177\202\035[\327\337\003"
+	.ascii	"@\220x\367"
+	.string	"n\365\222\335\211wI@A\020\357e\220\270\366\272#\226_@{b\330\204\357\344,[\374\206\372V\361\213N\356\240\251\331wr\347\245E\t\016\277\321\302\324y\372\304\367b^b\211\177t\026f\214\3367\333E\243\321\364\235?|%ulO\222\b\252\377\217dL\235\360U!\035\025~Z\307/\360\333F4\032\375w\332\377\317`\214\035\227\033\301\351\333\357'I0\006\235'K\275\227\313\212\033\t\021\210pk1\301v\232~j\003\024M\315\377\337\343t\325m=\233\203\367n5\365\373w\327\227&\036en<\035\310On-\274\001\277y/\371\315v\332_\207/\020l\313\243\376N\376\031\217%\032\215F\371\2610_`\235\205Xg\013\254s\020\242s\005\326\231\002\353<\001\321Y\002\353\034\201u\006b\235!\260\316\017Xg\007\254s\003Dg\006~\024\235}X\347\005\254s\217\2413\217\256\323\254\200\352\234"
+	.string	"\002E\347\003\032\260y\207u\326a\235sXg\003\210\316\005\340(:\023\320}\3157\2543\226u\266At\036\300:\013@t\256a\235\003\260\316"
+	.ascii	"\020\235iX\347\031\326\371\312:[Y\347*\325Y\206\320\231*\306"
+	.ascii	"\320\031F\3435OYg\244\320YJu\216\202*:\037\033N\363\223u~a\235"
+	.ascii	"]\b\235[Xg\026Dg'\325y\205\320\271I\305\320\231\251\3354\033"
+	.ascii	"\255s\n\325yI\251\350\214\242\347\232\223\2543\222u>a\235\217"
+	.ascii	"\210\316&T\347\022FB\347\242.\323L44t\026\3525\315A\2523P\247"
+	.ascii	"i\376\261\316>\326\271G\350\\$\266\231\346\241\352\254\n\235"
+	.ascii	"\205\252\263\025:\247\275\326\035\354\267\346\267\316n\235\273"
+	.ascii	"\301LX\265p\257\224(\022w,\r\342\254\337\272\315t\227\351N\323"
+	.ascii	"\275\246{\256\333M7\234n\274\356\276n\300\356:\335\303\334\334"
+	.ascii	"t\354\324a{\342\360\027lQ\217|\030\320\276\0335\2568\337j\245"
+	.ascii	"j\017\206\324#\363\244\276\343fP\273\213\372\316k\247/:\201`"
+	.ascii	"F8Q4m\322R(A}\252\207\342\330OOKO\017\365M\247O\315\213?\276"
+	.ascii	"q\263\206U\341\231\271\335jE\n\257N\031]_8\262x\027/Z\274\213"
+	.ascii	"w\2676Y-\276\325\344\251\311\261\370\216\323N_}\201JWeB4\241"
+	.ascii	"\322\367<\323I]P\244a\217\001M\035\034;\331\2315on|NZ\336\346"
+	.ascii	"\364B0w\201jIK>4\021\201\317\017\351\235\274b\316\230\271\246"
+	.ascii	"_\361B7^\273\367\236xg\323g0&\317\211\227i\372\024\214\234\243"
+	.ascii	"\024cJ\340c3\341\264\266w'v\247D\221\212O\365\210\216m4\032\031"
+	.ascii	"_\3057\035\275h\r_\372\024\317\204\302\352\325\225V\004\212\353"
+	.ascii	"p\243\306\252\346aV+U90\031}\n\034\226\276\337\264\323\327\\"
+	.ascii	"\221\024 6\350\331a\351~v\247\300\006\r\321;\031\310LH\351S\275"
+	.ascii	"\240c'%\275C\237\342\314\204\030Jz\245o:y~W\216\364(TXW0:\371"
+	.ascii	"\222,Z\253\270\2275\254\252\354\336k\305;\274\313jE\252\214\213"
+	.ascii	"\237\255b\253\013\353\013\353\013\266S\024G~\364'`@2\372\023"
+	.ascii	"\236\205\237N~;\372\246k\247\257'\032\230\320;Y\206u\006\253"
+	.ascii	"\2625K3\357n\3715\326H`\334hy\036\376&\306\231\305\005\275\223"
+	.ascii	"\235\35414\226\261\031\272\370\013\354d\255d\307\256"
+	.string	"\225.\367\336\027~\205\357\325\352+\314.\246\226]&\373\362B\t\323\345\216\335\027Tc\\\236\304\026\267\262\236\231x!\030745\240wr\211\377o#\306\324\031}\211\3574y\317'I\374\300\325\365\024\375\022\270+E\2427z/\277m\3642\342\370\274\263\247I\027}\006\253\027\017\313R\213>\005S\006\215\006\257\222\025\205G\364/\247\207\342;mXoX\242\322\317\016\332\261\363\343?*i7\020\337\311>z\352\320\247f\302c\007\275WT\007\275\253\331\340\262\024\033Bu\320\017}\317\331=\273\2564y\367\032\306\376<\320\373\274\3203\257i\353\016\336K\016^\260\327bvf\221\037\274%3[\340Rn@\341\335{gt\312\016\305\243\340`\003t\350\260\235\n}/\277|\351^\007$\300\203\207\355\024\350[\256\233\342\362\240\201\005\311N\222$\001\203\340\217\017\254\222$\311\020@X\322cI\326\007DB"
+	.ascii	"\201\b\222\034C\222G\210J\330\301A\226\022#=\212 !\342\300\220"
+	.ascii	"\236\0228\020\222$\t\006GF0\342\201\220\"H\210(\031\022D\304"
+	.ascii	"\203\244\006F\220\370\030\222<B\344,\251!\311#H%\034l\220\364"
+	.string	"@\003\344\007I\f\212 \263\220$AJ\035\261\221#D\220 \225\0301\202\004Y\354\276X[\337\344\252\312\202\017 \007\031\374l\022\"d\356\211\"\317*\210\005\257D\327\305\246\202\017\362Gd\252\336\3719t\005\377\003\205{\271\n~\250\346.P\215\202W\243D\343t\3139@\310\241a\314F4j\304\004O\301[\267\256/\022\374\004\357}q\237F\202\037\336\335\241\251E\020\004\234\032 \177j\004@"
+	.ascii	"y rd@\360\203\031\271\007\210\020\364\360\300\013\341\2049 \206"
+	.ascii	"\2076\r\270\261\016\274\016\r\374W\261{\2722G\205\352\235\353"
+	.ascii	"\231e\200\356\321\030p\272\301\016M-\206\235\2162\233\372\361"
+	.ascii	"\034D^\360\n(\360\316%\bC\201\377\361\235\346\b\266\005\336\007"
+	.ascii	"\230\244\rk\230"
+	.string	"S\rv\312=\037=\324\005\272\364x!]\030\330V\002\317\317\036\373\341\272w\253\211G\227\226\"=r>\313\215\026o\206\343\215\016\036\337\313\257/K\340\277\312\334O\275\223]\352\330m\247\325\300;Q\216\307\276\340\275\030\031\205\300\247fP\307\336\261Cj\307#\360\335\f\364\323\361\0078\241\217e\r[\001\003\021\312\275\003\f\370\034:\306\370\031\207\337r\\1\340{N7\251y\242EA=\026~)]@\013\005|?\273\251\312\333\361\235<d\341\005\216O\315\\\034\373\306\215o\250\337{\265\236n<\216\357&\236;XO\300\207%\225H<\330\032\306\002\357\277\276\212\362N\231\247\334S\356\331N\t\020\340m`\r\3606\276UP\372)\373\224E\f\360C\260)\002|C\273I\r[ \330\332;]\264\322\317\326x(\037E\351\007\250,BY\204\355\264\306\177\2252\201`[\001x-\353$\275\2273\036\200"
+	.ascii	"\236\306\003\360Qw\276k=\243\3615\362\324\236k\306\003!\203\006"
+	.ascii	"\326\342\312\257\276\317\374VR\375\373ZkX`2i;=\362\252\267\272"
+	.ascii	"\242z+$\252\376\277\242h\201~,\354(\217`\372\331\351\375\301"
+	.ascii	"\331q\222!\207\352e\274\255\263\202J\231\307\351P}\n&\017\232"
+	.ascii	"Z\023\2132\300&T\240~nm\344T\030c|\252\227\342\330SSLS\037\343"
+	.ascii	"\233\0164\202k\250\302h!\022R\247T\215\210$)H2\034\342\013\020"
+	.ascii	"\006\343@\251-\275\001\022\200C5\315c\322\231\222\032\221\202"
+	.ascii	"\302\202\324)\r\007\3443}\2629\036\275t\312\272\342\3746W\325"
+	.ascii	"\220\240\247}5L\0132\2718\240\205Y\020Zj.\340\370%\2153\240L"
+	.ascii	"\274\007F\313\215@\035u\002\2372\307\340\322\034vD\"u\363\234"
+	.ascii	"<\002T\266\317\177\233o\316L\034T\007L\002\304\201\204#\017\247"
+	.ascii	"\251?\202\264\337+,\007\325<\376\300\017\240VJ$\252f\333?&b\310"
+	.ascii	"\200Vr\236\333\323^l\344\023s\273F,\275U\264A\375\345\371\242"
+	.ascii	"Z\367\221(\030>\216\267X\210\377\3435\0168_\331\b\214\230\234"
+	.ascii	"\230\035\177#1\232h\207\272\335?\344\221#\372\267\375o\201\366"
+	.ascii	"^*\212\301fd\007=\223\262D\021\3459z\2775\3111I\275X\221\374"
+	.ascii	"\f\211\314\330\2266\235\313\211\330P\232\201!"
+	.string	"(\024Y\007 |\217\254\b\334V\231\235>\3232O\246\215\247H\223\337\373\237\322\016M\307\306\353\255b\336\351\013\307|\267=5\177M\370\253\307\034'|\335\223hG\260I\253\375\364\271k\376\353\005B\305B\304\017\241\247\374$\022\367\316I6r\307v}\250\007\353#c\227G\310\352k\005#\027_\333hV\254SO\345\262\314~\r\006\215\255[\247\311\354Wf0\3230\003\031u\224.\033M\3607j>\350\337@\352a4Y<\261D\301\220\247)]\265\302Xo<\361\273\2475z]\222EF\177\344\032Ir\255#6[\335\025\214\272qA\224\216D\250]\226I\216\300\266vB\366\224\031\376\327K\240\037\236\t\245)1\227\261\374F\024\351O\b/\001ySz[\n\244\303`!\204\200aoC\215\2350\210\204\237)\"\033\314\263\003{\024\207\205T\353[\317C9\206\241\363\313\314\3244`E\377'\247"
+	.string	"\001\241\034\250R\325Ar\375"
+	.string	"\223_\341[\257V\235X\220F\356C\274\005\024U\020\353P\017\261\334\304\257\t)\321&(\342\272%\324+3\302$\006\233`\030\276\203`\300F\243a\322\346\303N\f\377+\013\2255\rJF\254\"j\314\211\332\033\361\\[\241\302M$\364\371\203*3H\321\372\323\201\331DfV\246\347\357\302\204lf86\260#t\"\213\356\016D\026\330m\331\321\201X\006\242u\347$\017\260\336\313\301q\3672#\276O@\367\231\003P >\317\\)d\357\324EZ\246\022e\266P\371J_\224ZF\305\344\317A\254z#R"
+	.string	"\263\204M\330\205\360\002\254\271\024-\302p\237Vl\227\3463\2328\353\216\223\243\214E\341\036\207\271Q]\237\225S\022\372\301L\324\256n\227QV\020\310\217RQ\312\256a\362\320\021}\354^c\241E\177\313\"\361\027,\024\263\350\020\326\363@\373\205"
+	.string	"\024\204\3426\312\252:4,\227\325\261\b\213\323\246Qu\250M\003\273\022\013q\247.\273HI\025\374\302*\227\303\247\331\205\263\201\250\004\303H\263\254]\356\276\237"
+	.string	"\\+>,\303B\266\304a\037p\347\244\007FS\233&\2021A\031e\332\003s\t)\250f<\r\235i\233\240\277\353\214\225\230\202+Z>\302\006Z\336\322\2269\001\377\225^\367\312i\215D\300hY\312\221S\256\250GI|\023\317R\346\002%(\350\311(\261\201\240\23770\330\002\006\226\020\333\026\036J\273#\246\024\270.m\3742\023\276l\207\020\370=;S:\203\341\301@\203&\241\360\"-\235\346>m\026\215\333\205\216\212\\\320\243\243B\201&\350\005\"\034 \"\320\250\337\370\024\375\341\266\335\306P\026\266\240X\271\03180N'\350\356\"\036\210\326i\314\\\301+\266\252\354\222PD&V\324\216\317&\242\003\212>\222\024\243\342\017Q\037#E\3671\272\370\026\336\240\256\310\n\315\313ajl\354\227\272\t\305wodi\\Cy\006\263C\252\212\031Ml\253\315d_m\037RD\360\205h"
+	.ascii	"\016\324\030\025\340\231\214z#I\222\207`\031\233\342Obi\326\031"
+	.ascii	"@\274\b\n\232\237*\250\264\225\244\363\264\304\225)\2325\332"
+	.ascii	"\264"
+	.text
+	.section	.gnu.lto_pidInitSetpointDerivativeLpf.part.0.277.bf6dcfc108f8cc68,"e",@progbits
+	.string	"(\265/\375`\234\004\005\035"
+	.string	"\226\364\262E\240\232M:\305\353\030\316\022bW\375\365%kp\031^N\256\b\3235\303\312\206~@\352\3511\204\232@V\362\330\271\366\255\316\304\275^B\217\001L\202!\003\353\214JN>\242<\214\342\230l\315\022\2627\331;\245\230"
+	.string	"\233"
+	.string	"\233"
+	.ascii	"tv*\277\303}\n\207\334-\023\223\247\264/\365'\342\247p\230\356"
+	.ascii	":ie\331\335E8\265\203\360t\347\005\352\251\374\200zj\277\211"
+	.ascii	"m\034\223E\373\353\273\250=/KGU\234\335\245\235N!\236\377v7("
+	.ascii	"\305\207`\245\337\2241\321\0077X\235A\317\314\250\313=\374v\306"
+	.ascii	"0\371\370&\310%\035\222\004\345\230\244\307\253HE\301\204\251"
+	.ascii	"\031u<\376\345\220\351\222j\201!XD,G\235\322\234\347\375S\022"
+	.ascii	"\306\033u=.\005<\006n\330]\377\350\307-\273\355%\266E\330\337"
+	.ascii	"R\276\226o\t\362\213\330\006C~<\365a\324S\025SNMN\334\034\311"
+	.ascii	"\236\234P\236\261\371\324\353\365\346x>\331\263\230\264\254J"
+	.ascii	"\307B\351\020\224\006\177u\327*M\253\364\367\335?\253\264\244"
+	.ascii	"\322\037p@\003\220\335\035=:\353D\267\034\371\325\037\345\237"
+	.ascii	"\362i\337\257r*>"
+	.string	"\317\263+\234\231\254\374\212x,\306\342I\332\255\316D\230\225\2238\273\013\"<\345\371\240\334\207\202\363\253n\345\331\024)R\214d\b\037\305\024,\340Ne$\021l\356\315\203S\n\026\304S\031}g\221\310\214\025\302\007\222Np\332#H\310\217\366\275h\030\350\032m\337~\246\004\206\256\335\275`\346]'\374\"\247F\221\"E=\005\347G\036\002\244\234\337\264W\260\220\037\351\344\3111s\236\363\233W\002\363\311\274\214y>\276\362\325\244]\3360y\326\027p\341\312\311:\236\377\356\036}\\\276\030\271\345d9\356\216/$\353\264=Z~\030\177\205\273\2717\375\nj\326J\002;\036A\003\266\273=_\374&\373^\302\335\366\360$\3110\373X\347b\364S\253\325\323\317 SQMR>\346\356\346\346\204zP\rD6\033>_m\350\206\t\031\221\315\006\207\240\032-j.b@@BE5:\334jE1l@"
+	.string	"\374#\301\205m\210V\364\"\310\026\003\2106\303\346#\203\366s#\242I@`\241\241\332\215V$$t\243\311\177\347\223\325\303-9\\G\023)\234P\016\340Ug\223\016\221\017^\347\222mGx\235\362\t\225W\222\234\343\371ow\027\204\360:g\363Za<\245&$/\277\254\243\2436\220\341\214M\331\264\305&\242\224R\033\031l\304\251WE\201}\r\207\016\036<\324S\331\234\2614\377\372"
+	.ascii	"\"\204\374\030\242\236\206\223v\201#g\353\004\266\302\320\004"
+	.ascii	"\001c\250a(\307\020cDH\206\204$I\222t`\002\2312\263\035\021\220"
+	.ascii	"\301c\246\005j\317\254\256R\213\224tl+\301IZY\351?p3Q\300\021"
+	.ascii	"U\007\230\377\205L2\244\020\327\245\013\244\\aX\240\316^\272"
+	.ascii	"4`\256\205yZ\301\261\204\3014\301\316\302>\242d\246\204\036n"
+	.ascii	"\260\251\360[\323\323\344\201e\241`\377\021\223\204\242\227\273"
+	.ascii	")\247E\302\"\315!\rC0\273\177.,^ P\360\357\273gC\266w\305f\241"
+	.ascii	"0U\344\220W9\020b\003\276\331\035Z\f\271<\t\352C\273<\300y_\300"
+	.ascii	"\220\323\266\013\220\230*\360\274\031\016(=\314\234%\373\345"
+	.ascii	"4\370\254!\263\270\n\344\032C\206\0203O\331\301*2\334\343!\225"
+	.ascii	"{!\272\225\260|\310\204\330\035\322"
+	.text
+	.section	.gnu.lto_pidUpdateSetpointDerivativeLpf.part.0.278.bf6dcfc108f8cc68,"e",@progbits
+	.string	"(\265/\375`\320\003}\031"
+	.string	"fo\236G\300VQ:4O\223\350\206\bW@\031\222(\034M\025Ufh\233=\360{G\2579}s\325\277\301\216\311\326\314^\354\316\204+\250\315\020\t\234\203%n\211\245\374o\243\0350\262\2207\367\256\331\275\355\023B6\221;\245\206"
+	.string	"\200"
+	.string	"\212"
+	.string	"\274\275\335\254\322~\220\013\221}\310\013\317]\035\224#\273\274\007\237f ~\022\370\001\360S\336"
+	.ascii	"\370i\037\210\355\330\3152;\313y@{\2450:D\\vw\365\2518\254\377"
+	.ascii	"x7(e\017\301\371\251\024e\376\205\376\335\2605\215\270\331\303"
+	.ascii	"\217\300\356\n\300\351|\021$\017\216&A9\006\365|\252m\350;\322"
+	.ascii	"gn\354h\031q4\2565\034\360@\216%\035(\034\f\225"
+	.string	"1\027C\n\273\353\323r\367\351\266\177lO\260\265)\337\341\0246\362\343\247o\243G\372\367#G\344#G\223=\353uwgR\177\254\242\356z\275\236\027\353\316N\211\322\250)}\n\245EP:\374\321\rN\3519\245\277\363~\235\322\362\223~\001\231cPcWF\357\313\352f\022\036?\372\355\373G\037\362\221\2342\212YU\343-\356&\344\033\235\310\211d/\362\322w\306\336\006\024d\333\262\273\r>-A\374T}\367\205bv*\365)\317\213}\310\013\031Rl|1rj\250v\007\017\362\243}\246\233\030+\243\355\327\243|8\021+\273;\341\311\241\204\360w|Z\304\210\021\340g\250\037{\006H\251\237\33245\362\343T\025\f\235Y\365\323\347l\361\233\334\211\225N8\311I\n\"Wt$/\321\3034\223`\254\377\356\322T\177\354%>\023\271\244\273n\203b\364X\335\312$\361\2258\213\270;\273\317\257"
+	.string	"D\262\013(\314vA<2J\276\217\375$\221\2672\252\232\fc\277\310\215\264\0347-\027$>\026\313\005ka\341U\003S\321b\0010\r\004\023-\026+\030\212\023-\025\254\325\212\026\t\233\025\315\353f\005\001\201],j^+\230\313\365Z\245l\313\177u'\364\357H\361\301DS\234P\177<s\210\r\036"
+	.ascii	"\313L)\250<\017\016\252\0242\204\245&\275X\377\355\356\202\016"
+	.ascii	"\016jJ\023\f\355(\345\370\340$\375\022\214\316TIQO\212R\273\202"
+	.ascii	"\205\234+.+\027^\004T\345M\0302\314\314\200\237(\325\323\224"
+	.ascii	"S\321\260\201\203\374\310\001\374\024\025D\316\250\313\322\345"
+	.ascii	"QQ\250a8\305\024bFfdDd\302\266\225\003\200\002\221\2622\017\020"
+	.ascii	"X\211hA\232\003$\204ie\227Dv\005G\270\3733\266\005um$\263\001"
+	.ascii	"D\207{\201\377\360R\310\374w\313\252+\202\255 X\325\177]\311"
+	.ascii	"\250Z\250.F{ \301\334\302\t\001\334\307\256\217^\2078\351\303"
+	.ascii	"\301\352\035B\204%\355\306k}\021\330\371>LN+4 \343\367\312mt"
+	.ascii	"Sv\225\314\315\206MY\030o\026\215\033x\311\235\005{\354\266\226"
+	.ascii	"\004\031\266H\226\320\354L\374\021W\233\263\365\336Qrg\226\220"
+	.ascii	"1-\255\334 T\001P\202F\201|\352\001\223\270s/\025vk&\360\037"
+	.text
+	.section	.gnu.lto_pidUpdateAntiGravityThrottleFilter.part.0.279.bf6dcfc108f8cc68,"e",@progbits
+	.string	"(\265/\375`\312"
+	.string	"]\013"
+	.string	"\026\026M@0M\225\0160\030\203I\275\266\037*\224\337m[\023k\3150Gi\343d\3566\370`\246\335~\254Rhb2pH\300\206>`CAE\f\313\202-\246\344\020!\020\371\f\200X6\264\211\224)\0059"
+	.string	":"
+	.string	";"
+	.string	"\020\373\005\344\320\276\005\333\237\221;\333\304\277\bK\251 AA\n\305\356\306C\205\360\356\232X\347\037u\211G\002]+H\f\236\026\307\"\036\273\353\254\301\ro\273\303v\264\377\021\231\316\177\377#\351`c\304\356\202W\212}"
+	.string	"AL\260}\373\250\217=\231\034\332\316\374\367\301\276=\215\234i\377\3021t\317\340\225%\273!H|\330]\216Ckd\207\031\307\200<\336\211P\276\234zU\205\254\004\024D\371r\226\327k8\007O\266\033\272\347\247\276\241\200\177:t\307\223\367\016}\217\201\003y/\025\226p\211h!PP\252\311\212\035\333\335\265\226\254\001\027\r\307i\033\206\313l\251\004\310p\"\207\031\220\321\b\210\0042"
+	.string	"6\321\262ub\205b\215s\331\"\247i[\234\034[-9s\261Z!\025YUM\266U\375\016\367\340\225\177\362\306*\253R\001\025"
+	.string	"h\213!\266\002\343\001\221\330hB$\326\262\031\3242\255\202\367"
+	.string	"\n\027;\266j/\r\r\201\\\235\241\211g"
+	.ascii	"\233\311;\315\002\327^L9-\247_[\306"
+	.text
+	.section	.gnu.lto_pidApplyThrustLinearization.part.0.281.bf6dcfc108f8cc68,"e",@progbits
+	.string	"(\265/\375`\035\001\355\f"
+	.string	"\006YVA \221\222\016\247c"
+	.string	"\271\362\031\fv\354\225\200k)F\360\226f\271o\347GB\226p\023VMT\321\327\307\016(Ir\214\231n\207\b\200\004\224\326\201\003\200\f\200b\250\033\0342\b!d\357$S\nD"
+	.string	">"
+	.string	"C"
+	.ascii	"\365\t\221\222\2665\213MtZ\222\033\205\020q\254\260d"
+	.string	"x\241\221\231\230_\207\tL~\316\003&\277\253\270\343\243\353\324v1\003\217\n\031\220\311\210\017\300\204\203Q\200\035\265 3[up\237\333*h\213\240\265J\226Gn\205X\n\261\023b\037b\035b\357\221\215\210\365\205\241\004\241\314\r%\033\t\342\265\020\321\332E\244\275\332N{\025\321#\267\244\250\244\210n)\251V\246\213\027,2\363\200_\rT~\r!\234\311 \352\035\030>\322\367\177z\200\030)J\237\017\356\356\017\306\202\273a\204d\254\340\375\337\037\022\036,\265F\341\227\222jQ/4\006\r\362\253\0333\371\371.\021\222\251\341\201\004K\370\224\336\271<J\033\033g\263q\032h\331\226\201\\\375\360x\240\331`\333\004\t\032\n\021\260\n\032\007 \330\207\026\202y\024h\266\201\240a[\226i\330e\227G)\007\314\311\r\254n]C[\353\236\231q2Cr\317\237\322\326\235z\365\257\370\214\240pz\033\032"
+	.ascii	"1\033\303\327\r\303\307\020\260\250\310\\\005\017p\001\343>\225"
+	.ascii	"F\254j\020<\005\310\\\335\372f\263\240\026B\303\252\256\226\326"
+	.ascii	"\212\330\t6x\332!V9@\023\234~\247\347\2024%\265\234~m\031\003"
+	.text
+	.section	.gnu.lto_pidCopyProfile.part.0.283.bf6dcfc108f8cc68,"e",@progbits
+	.string	"(\265/\375` \002\365\020"
+	.string	"\266\036mH\340\320(\035\353}\005P\350\2109\034\326\224r`46\002Hd\210\324\240\215\202nF\276\231_\305\007\216\225d\033\253\225\274\372\257v"
+	.string	"\007\2667\021c(\343BN\361 ,\r\034\t\302\nW>Q\177\240U\262\211\334)\005R"
+	.string	"\\"
+	.string	"X"
+	.string	".\231`\267\231\\\\\026\232U\332%S\3546\023\353n\007\333\316\256\230\340\323\007B\237\366cl\303h\216\3314.\206K:\241\243R\223\333\335\357SA<v\225]\314\377x\216Y\313\3115@\013\206\313\321;"
+	.ascii	"\rv\327\241\f\367\274m\223\355\224-K\002\226\247\371\317!k\n"
+	.ascii	"dvYn\330X\017\223G\204$\211\241\013\r\007fW\267\033\304\320\345"
+	.ascii	"#NN&\267\025D\004\266\375\233\253x\331\245\027,\310>\224lVRP"
+	.ascii	"\344v\305\357\323\342\013x\237\241\017\360|\034\201\360"
+	.string	"5\277\275\236\302\377\251\371\274\244?\302l\221\210F\024\201\030\250\374L\255\267`\341\351q\235N\375\370n\247\3463\316\260\t\272\235\307\325\345\204\263\222\257\020\351d\204\273\273@\347;*?\304\247'\260\344g\237>\313\373T\375\355\017J\230\350!\361\342F\303U\252\001\224\234\030*A2yC*\214\265{\267\372bOiO\245\347g\376nJ\253\312\0069\255X#\n)\324\210\203T\b\370\241Zy\240@\217\026\0135\362\251\003\005\222|-\220\b`\310\3077\002B\020\371N+\326\327A\262\212$\265\372Z*\325\352\023\331\226\357V_\034\252\021\323#S\024U\030\333\002\f\303S\365\324\006%\310\317\374\361_\261\3410\002\350'EO|\334]\340\354. \200\002\031U\354\0025\f\3466\"b\215\330\330%\355\224\b\317\255,_\354e\302\303\325\345o\307\305\030\2046i\033\031\332/Q\037\346\017\327\315\002\255>"
+	.ascii	"\213\025\206P\367A.C\226a\244m2\017\031\277\266X\332\035\b'\354"
+	.ascii	"8\305Lc\267r:\016\006\022\352XM\303[yK-\200\355E\313)\236~-\036"
+	.ascii	"\003"
+	.text
+	.section	.gnu.lto_applyRcSmoothingDerivativeFilter.part.0.289.bf6dcfc108f8cc68,"e",@progbits
+	.string	"(\265/\375`\207\004E\035"
+	.string	"\226t\266H\240\330M:\300c\225Ql"
+	.string	"\375\034\230\250\247\274\317\371i\312\306\210\377\240\210\275\307\035\254G\031\016\022`\262x\2374u\333~\b\375\314\022\340dr\371&~\003\2701\016\003v4D\213]\020\022\326\261\266f\t\331r\247\024\242"
+	.string	"\225"
+	.string	"\245"
+	.string	"\237bR\241\226\211\263\252\230q0\347\245|T\252\n\221<\347\227\230\313\264Zyd\321\252\265>\370\350\005\263\217\366\225\370\220l\373QO\362\263\263\250T\023\224\201\255\246\243&fj\255\271\217\270\347\220\037\351\005\220\037\367\307\177\247\315d\344Hw\326~\276\006\243\035]\245\220\350\264Y\no|v\253' \202\2244e9NR\006\303,5nB\0304\347\253G\230Mx4\307Q\t\f\275\3259\020\225\250\224B\033\337`\021\231\363\304\005\244&4\332\031\3405\031O\255\325\007\352\270m\267\re\233\307\2463\002\303\377"
+	.string	"\251U\023\360T2[Gv\236\330\026\373\207\366\261l\373,6k\252HU\252\356\340\202s\215\375\253;\331\371PV\0014_~\364\201\310\217\337\bNT\306\222\200\2638\227\350\255m\261X\034\363\372\260qf\3237\331\364\315N\333\330\350tmN\323\350\364LFN\223\257\272\307O\375t\234\336K\375\223N\177\300t\222\260\243\326\031\3054ui\214\"\344U\267_\345\363\255l\243\362\031\027\374\371T\2665q\326+\215:\275\302\266\236\304\324Z\033|t\005\357\f\004\256\214\fw\334\233\253\"A&]\333\306\240\355\\\336\324\227\340<\343\331\322\366Gk\200\263\270\245\003\320lC8u\215%a\375\264\026\230t\311\265=|\230/e_C^ N\005\246\345]\"F\220 A~$\275H\371\2770\225\241\001&\335]\273\204\211\371r\\\234\321\022\331\307\322\202"
+	.string	"Xi\373\305\257\364Xh\252\265N\250r+>>\324G\353~~\310\217\2736.JY\345\r\340,\372Z?\223\030/\242\251\306\373?q=M\331%\332\\\376\224)ei\251nE\r\251Ku\007\212\037\305b\263Z\211\036=\035o{z+t\030z,vAB=\035\210\023;!"
+	.string	"C;\027=\324>\020N\354\204r\275\024?\273\025(r,v=@9\037\336P\016\202\216\203\204t\274\\/(\210\227\263\331\236\247\225\222\266\305\331\030\266q\366_?px\001\267\210v[0\027\373EU"
+	.ascii	"\363\303\036\346\247\344\267\344\302|y\201\3748o\256r\314\315"
+	.ascii	"\336V\007\353h\r\202i\263v\006\r\344\313\233\305\005\263n\345"
+	.ascii	"[\260V\240\002\333\332\254\016\027\030D\212(\340@#c\266D/\370"
+	.ascii	"\216\254\355\231\272l\250\255\013\247-H\202\224C/\331\022mr\211"
+	.ascii	"\256\031\241\242\262\rc\250q<\246\fR\206hDDd\002\303\244\003"
+	.ascii	"\220\002\0212#7\020Xi\250\024\322\001\335\004\234\224\321\204"
+	.ascii	"pxx\200\265\321\022\272\266q\2509\2456\374\037\333et\204\300"
+	.ascii	"\005#D\331\032\377\025w;\212,\005\252\302\021 \213\342\303l\""
+	.ascii	"\323\003\215\275\322l\237\214\376`\306\354\301\f\370\237_\341"
+	.ascii	"\374u\370\013].\035&F\346\354\337\007\377\214\034\"\214\371\326"
+	.ascii	"N,\233\031\322\337\346vh\350(D\370\254\320u\027\f\270\240t\320"
+	.ascii	"\237\030h|\2456\2517\315\267\022\253\n\027\241\030\246\277~a"
+	.ascii	"23G|P\255\277\207\343#j\323\020\240m\330\232\366\313*\211\263"
+	.ascii	"K\240\013\331|\201\264,\372K\240\017R\204f\244\202\353\233\303"
+	.ascii	"\024b\371Q\001"
+	.text
+	.section	.gnu.lto_pidUpdateAirmodeLpf.part.0.291.bf6dcfc108f8cc68,"e",@progbits
+	.string	"(\265/\375`\317\003\265\031"
+	.string	"\206.\240G\300XM:\300\263D\340\b|\362$\271\330L=\224\274\307Kw i\252\025\300\215@\243\374\001\276\341\215-\242\241\323\005w\225\324\216\336\317\030\205\333\224EtMW\341\334%\234\223wX2\377\017[#\322\310&R\246\024\210"
+	.string	"\201"
+	.string	"\213"
+	.string	"\317\005y\271\211KaU\373Bn$\364!\036\035\316\tE\t\311\234\023\302\245\031\200\2275/\360]z'\360]\332\007b;(\205\205l.\317\025M\003M\236J\350vsN\326\345\342\270\320\301\324'\275\325P\310'qPA\r\"\027O\251j-\376y\016f^\001\245\022*\225V[q\257f\316\271\252\311t\275\0031\246\250\bP\033\362\0268\331x\272\356j\242\026S\035\36005a\316\351\213/n\325m\237\260\215\301^\246_\335\353N!\213\216'3\0361\215\322\265y\303{so\230F\325+U\253T\035\252\032TuJ\325\237\252\245\247\352\325\347\376\023\320\233\r\2149QD\225\2313\244\022\035G\372\021{\254\221\345\212p\327\345h\n\262\233\262\371"
+	.ascii	"\310E\270\f8\2503\273K\337\310\225\354\225\201\236\344\023\335"
+	.ascii	"t;\240\373E\202|\235W\266\217\024\344\032\331\221\307O\242\251"
+	.ascii	"MOM\306x\231s>\270t\004\360rui[5P.D\271\266"
+	.string	"\225\3421AQ\224\263\270!A\301x\213!\024;\274\2659\265r\327\312\321\224ojSL\263\235\250Q\336k\016Z\f\247]\233=\332|\313\341\250\212L\307X\356\367[53\343a\363\374\211Gp\316)\301\211\334\373\270!\3750\022=&K>\270\301\315\314\256\256\26773\333\021\323\250}\322\221\274\3009\305\323\374\245\217-\037w\351\020/=\355\322\177}\"F\350i\273\273\345&\246ihI\330\343g\330\223\315)\332\004\336\271y\355\3006\364\260|Z==-\234\003:?\025Z!,\347\245\243s\001\346\223\343r\211\300\001`\234\233\016<?,\330\216\007\036\020:,\037\236\r=,\034\327\213uc\300\255\237\034\027\013\326j\271X\253\357\rO\0207\006\256\315\032\222\276\225\205\241(2\272\310pi\326\204M\203\305#\202+\272{gn\272#-G\276\244\326\006\356j\255301M\022\306\211\306\247R\272"
+	.string	"\"=p\220\271B\305\311#\330\244\332\320H\324(\203\033\356g_\3043\235\212G\037g\017^\362\322w\tnU\250\201,\003\025B\306\320\0042\"2\243m1\200\002\03123\017\020x8\233d9T\226J\327\2705C\367\301\317S\325\310\024\026~#\325&^0\t\324\273\324\256\370\354\005\253\316\357\023V3\266@\rC\036\205\334kmt\210\027\340\265}"
+	.ascii	"\310*\035\t\004\356q-\260~J\256\r\207\021=\020\204\245\036|9"
+	.ascii	"i\177\341\262\t\370\234\366S\353\f\367M\366F\323\310'\b\221\210"
+	.ascii	"\025\254\311\2035\246o0\316\250mP 2k\030(y \247P\030\301\343"
+	.ascii	"P\001\204\237\351\262K) \366\313\b\326xK\212\311\350\267\354"
+	.ascii	"e\217\3277?\377\317\305\325'\006\261\037"
+	.text
+	.section	.gnu.lto_pidSetAcroTrainerState.part.0.296.bf6dcfc108f8cc68,"e",@progbits
+	.string	"(\265/\375`K\001\345\r"
+	.string	"V\231[D"
+	.string	"\257(\035\300\177\345\fpu\263\372\003\360,\237V\305\347-\2164\247!\355%\2018y\324\200SNy\266\241~\346\220\251\fd\321\334\026\357\222\356\322\377-\216\355\324\026\272\311\332\250\254\275G[B6\2212\245G"
+	.string	"E"
+	.string	"G"
+	.string	",\333q\321\212\020\342\305\356\306C\315\360\323a\246\251\235\374\355\303J\221\242yu%\207y\322Qx\266}\276\247j\346\243yu\023\256"
+	.string	":\223l\300\356\336{J\350R\231\001\256m\237\335\365\246\302\275\3356\310v\264\257!\252]\224X\214\305"
+	.ascii	"Kl\260}\037\304?\322?8\001\253\306ewI\367=\223\315\341X\363/"
+	.ascii	"\346\3500\335U\272\267()\326\2649:Nw\225:\207\301\264N\354z\032"
+	.ascii	"\207\366l\016\355{\260mJ\361\311nq/\252\031\227\0027p\030\233"
+	.ascii	"\020\260bw\021\370\">\002\202\337r\350\021\222\374\311\241O\242"
+	.ascii	"\035\376;\001\01650\225\026\f\2251\353swKTW\266K\332U\277\230"
+	.ascii	"\330\307\302$a\244\256\254Z\266\272b\377\345\377\226\254\003"
+	.ascii	"\001\240\221\307H\001\t\024\262\361\307\306\202\220H\0349h\020"
+	.ascii	"z\300 \206\204<@\342\207h$nt\314\211\200Dq\304q\242\310\261\235"
+	.ascii	"\317VW\234\241\342\002\n\224\246\240\256\324\217\271L\311o1\b"
+	.ascii	"\307y\367t\220aQq\251P\031\3134N\342u\013\001  p\202\231\303"
+	.ascii	"\362\323\031\230\002\277\247\241E\370%\263miE$\266\003 \033\271"
+	.ascii	"\033\223z[\360W\026\320\362\360#:\303\214k\241\316\210\330\346"
+	.ascii	"\336\304D\330\372\261v\003\304-\261\244\254\031 \265\267w\347"
+	.ascii	"\203\274ki\265\365\2047\006"
+	.text
+	.section	.gnu.lto_dynLpfDTermUpdate.part.0.298.bf6dcfc108f8cc68,"e",@progbits
+	.string	"(\265/\375`\366\be0"
+	.string	"\nVh\022AP\246J:W\253\346\336\373\216\255\005\357\365\212\256R\277\372Yj\337\215\251\341{\242\177\264nP\274\243\315\340\307\004DDD?Q\302@a\r\022\250\207<\262\024\205E\034\207lk\2154B\210\224I\006\020\001\377"
+	.ascii	"\032\001d'j\022\216B\031\316\2301s\366\"U\351\006\237\t\351\311"
+	.ascii	"\244}\314YZ\323\244JB\200\320\274\213A\373\230\263a=\033\335"
+	.ascii	"\337\020\277Z\355\272\322\237J|&\024m\217\207v02^wT\266\203\344"
+	.ascii	"/\316\257\326\272\365s\033\244?{\177\227\266K$.\363\355\322L"
+	.ascii	"\273:\227\\\346"
+	.string	"\335sy\027\343\275\354r\205\265\356uISk]\360s\257\322\237RwB\177\232gB\177\356^\313\356\246%w\215\273\200n'W\241\b\001r\303CTk\345\372\331K\216\266o\332}\3236\036\351\2108\024\246A\3644\233\213\306}p\302\335\205H8\265#\361\005\341#!'\n\371\220\357Sw\222C\246\250$\201\260\320T\272\223\034b6\330s\343\364Jv(\037T\0365\265\342\370x\374N\362\207\351d\347\310\237#\237\214\204\353qs\b\327\343m:\351\200\202,\302\265\231Z~j\f\375\356l\003\216\215y\351\305\340\204Z\353~-\356\233\364\335G\355.\210\335tF|\344\027\372\363=\243\016\260N\271\306\201\334I\266\213\214hK\\\215m$\273[H\274Z\217\363\315b^\254!\357\325\220\327\252\352\2107\301\337|\251\230\027\001\363N\ry\245\230\367@\312k`\310\033E\344-@\344%\300\274\003\230W"
+	.string	"\312\013%\344}b\336"
+	.string	"D^'!o\323\220\227\211y\227\230\027"
+	.string	"\363*1o\022\312[d^$\346=b^\"\363\016o\367\013\257\367M\2317\210\362\242B\336\023\3455\205\274\215\362r\312{\b\234\305\212\257V\035\201\214j\221S/\312\337\374q\3764\377\231\237\314\347\354.S\265d\223\217\266\272\265\273|\262\311\207\220\277!~?\257\367\340\356\367p\370\342\030\315*\306\302\037\016)m\366\336\244\255T\233]\205K\272\3316\177\243\373{\363\220\336\355\303\\o\277f\211xih\377\262/s4WcV\007HL\263\016\036\244}I\226V)\301=\007\017\320\276\fH~2\324@\303\370\322\007\021\031\207/\003\r#\013\2303\312P\201\216\352\306#\320N]\240\17744\240\tt\267qk$\240\003\364"
+	.string	"\250\026\360\324P\205\236\272\253\217\022\212\205\275\373\001\004\037\031\240\215E\332Zm\233\332\251\177\364\023\324\324fu\215\022)\327d\352=\240\007\302\n!B\004r\320R3\365\357\336\301\215\b\235\343\034"
+	.ascii	"\255\324K\375c\034\033\200>\223\032\251\225\372G*\305Nj3\317"
+	.ascii	"\321\017m\263\213M\334\323dy\224\202\324{?\377\263\313\021\213"
+	.ascii	"f\321\310A\016:ja#\365\tx\214#v\332Gm\002\016[\330\304\346\277"
+	.ascii	"#\025a\357\362<\354\342\236&yG)l\034hFO\225\"\265\256\204\300"
+	.ascii	"@Em\265\256Q\005;m>s\244\302\306\201\313\035\354\257\271\207"
+	.ascii	"<&\207\216~g\243{H\234-T\266\331wk\264\307\363<g%L\230@\177v"
+	.ascii	"\013\225o\356b\036\021:n\215\316(NG[w\222\335%C\337e_\372\332"
+	.ascii	"X\321\356\353\334\016\331~n\275\276\002/\302bx\231f\f/\027a\034"
+	.ascii	"R\214mp!\003\2050\205\330X\f\260\023\214\205\231\231X\331\n\263"
+	.ascii	"t\277\030\240\b\033\3432[\241\"\214E\n.\027a^-\270\276\312^p"
+	.ascii	"1\200Z\2611\2602.31\2612.\342\357\376\267>+u\326\232\355\r\211"
+	.ascii	"\270\325g\337p\353YY\254\346\317\216\221\243\254\336\n\304\200"
+	.ascii	"\255\032\253\265\222\030\227\034\223`LX\207\321\311\034\347\300"
+	.ascii	"\241u\325Xl\343j\271\006\277\031\237\354\347\326\030\3058\305"
+	.ascii	"8\005\375i\325\347\313; \235\\\"\342\262\341B'7\344\252*l\252"
+	.ascii	"|\351\323\306\212\020m\211s\023v\222%\366\005\253\372\354C\267"
+	.ascii	"N\3256\026\234\252\371J\337L\025\234\252\253\372)Oni\305\b:A"
+	.ascii	"\357\032\255\030\261\360\221\253\242\211O\255\365\310]c\035\263"
+	.ascii	"\031\265D\350\372I\307kF.]r\265V\b?\227+\253\031\275\354\347"
+	.ascii	"~.\205\n\025\320\237\t\372H\037Q|\240\247z\367\002\006>\022A"
+	.ascii	"K\321h\265\225\352)@\251\026*\027\355R\303\2429\320\337\273\251"
+	.ascii	"\227\005\257k\255jA\264\003\200\273\250q8\006\211R\204hFD\222"
+	.ascii	"$\3110\006\220\002\021\252\"\333\021\220\261c&\243IjT\226\003"
+	.ascii	"m\200x\257\256\3208Ea\262\005i\376&"
+	.string	"6A9Q\261\221A\004 \3518\243\227>!\315\236P\322\316\245\310I%a\265\214\200/\232\200)83\206)\231gD\216\256\200%\323\203\311\355\020\t\243M\027|\264\233\314\b\262f$I\364B\275\034\302j\306\006\t\352\261\264zr`U\020\351\344\230\fg\310\032\362\243\354\316\241\337\204\236\333Y2\3564fi'\366\342\242!\243\277\320\310UY\250\372\223\026\234l\034\323\006i\356+\370y\376\034Q\234M\221`2\375\367\361\252\030\246\034\217\220N4,\222\035\2009X\025(\2001b1\301\320[q\372\344{T\340\366\b\265\345\204\036\330\314\311\301\224\240\355\332B\312\210]\b\374\371%\325\227q\022w\242$c\023TLM\034\236Ra7\204\026\215RX\325\307\237\255\306`8#\024\020\222\340\277v\031\362\304\210\370\016\016\233p\310\300\037\341\334\004^\206\353\371\3158\3521\200j\376\310\025>b^XR"
+	.ascii	"2\302\302\324_ZU\016\362\\O\237\222u\240\022\220\330 \243\265"
+	.ascii	"\026\253\262\274\364\0017\003|\322\006Q\034g\312\252\231*%\037"
+	.ascii	"\365\341\025}\230\023\217\356\231\267_\2127b\036\271\224\315"
+	.ascii	"\217\n"
+	.text
+	.section	.gnu.lto_.symbol_nodes.bf6dcfc108f8cc68,"e",@progbits
+	.string	"(\265/\375`-\023\265>"
+	.string	"\312id\026=@\242J:\327\267\237s\223\277\272\332\031\261\022\216\330z"
+	.ascii	"b\231<\215\362S\363\265\362\314\247D\267\246\356~\377\367\363"
+	.ascii	"\377\377\377\017 \204pD(\t\230b\006\034n\330*8\225\350\275\223"
+	.ascii	"\fW\001Q\001Z\001a\362E\003\3632_\362=\363\322~_\371\226y5$\344"
+	.ascii	"\273\344;v\273\372\217K\276a.\363h\320V~\313\317p\345\373\345"
+	.ascii	"n\365\335\265\344\373u\265\362\365\272Y:\021\226F\204fu$V?F\376"
+	.ascii	"*\337.\367\312S+=i\241%+\364\"\n\255\310\252\035\325>T\325\206"
+	.ascii	"\226-\250\351a&\264\037e\367A\2376\0374\367\236*\371\210T\272"
+	.ascii	"\235\222\217\3478\225\322z\242\344\337\201\322\212h+\2374]\332"
+	.ascii	"L\273\0278\311'|\223Nd\220.\227j3\311\267\353.\371\027Ju/%\357"
+	.ascii	"\202&\271UH\362\233\367H\0072\322\200\212\364\237'\221\374\273"
+	.ascii	"!MHH\027B\203\264\034 \315(9\225ow\177\034\314\307\307\364\310"
+	.ascii	"\317\273R\307\022\225\377\346\362\270\226\035\327\322\361,9\316"
+	.ascii	"\205#_\356\3368\027\033\357\252\361-4\2365\343^d\234\031\343"
+	.ascii	"p`4\213\032\275\310\237\273.\016\250\305\315X\234\314\212\233"
+	.ascii	"Q\3615\305\317P\374y\342\204\360\363\371|\232\310w\336\007\037"
+	.ascii	"\274\313f\\\211\334wn+I\264\323A\017\032q>\":\016\332\335\fB"
+	.ascii	"\334\017\210^Dq\367\325\364\303\305\240]U{f<\344\3079J\227\313"
+	.ascii	"\024\256;w\357q\375i\232\246\035\362\331\333\335\005\"\004\222"
+	.ascii	"\371z\026\345+*\312O\214\314\317\003\231\177\370\230o\230(\277"
+	.ascii	"\020Q\276\"\307|\325C\371Z5\346;2\346\2534\224\357\262P\276)"
+	.ascii	"\241\374\311\305\374\307A\371\214\202\362\333@\371\177\236\036"
+	.ascii	"P\276\340\377t\323O\357\365i=>m\007\355\346\261\204G\217%>\250"
+	.ascii	"\366t_\333\200h7\024%K\250\202L\371P\242c\nI\205\276ju=-\250"
+	.ascii	"\330y\320\304\374@\304|\300<\371\177\207\371~x\362\373\f\363"
+	.ascii	"\371\n\363\355\020\346\327\271\223\2777\230\257w\005\233N`7\002"
+	.ascii	">\321_#^\370\"\277K\366\375\020_\347\241vn\250\316\013}\357\202"
+	.ascii	"\036\257\227O\207N>^^\376\034\274|9s\362\351\356\362\335\330"
+	.ascii	"\345\307\311\311\207\213\223\377v\331\3746\267\356d\316\267\321"
+	.ascii	"\235M\363ls_\003\347ho>&w17\017\213;\030\270\177y\3539m\276\205"
+	.ascii	"\272\375\252\355W\330\034\013=[\276\333\232\266C\215\326\362"
+	.ascii	"\323\\-\277LM\276\225?O\313\267\272\247{\f\253z\232|\025M?\321"
+	.ascii	"3\371U\027-\177y\315\344+\317\272\256L\356C\263\306#\223\033"
+	.ascii	"\317\332\205hYn\303\233\306\221\345\036\274cO\023\273V\302\356"
+	.ascii	"\025\nv5c\256\206\212\371\332}\224\003\273z\370Huv\037\006\260"
+	.ascii	"\326u\037~;\327z\370hm\266\036\006\300.O\327z\030\211=\201@N"
+	.ascii	"\273\277"
+	.string	"y\302\003\326[p\332\005\036\316\201u\211\225Z\245Z!\353\031\320=\341#\255\022\365\006\266\322\262\250\250\326?m\322:Y\245\254R\332?\263t*\031{l\266\232\261Mun\275\0040\303\256\227i\347\236\360\321\324\277\371\204\225\332\033\361\211\231%\261qN\016\334\224w\343\204\007\250\277\207\313\266\3039\341#\366\031\274\036\225gs\302_\177\377\336\274\235]\316\t/9\177!4a\004\355\001Vi=\003\264\306;_k\302\004\332/\270zB\376\255\t\3678\206j\302S\353\033\220 ..R\354\227\nU\253(\365OnWX_\203\200\225\324/o\003\001\277\375\215\013k\364\002\005\001'\255\017 \227Wv7\246\353\310E\220\360mL8I\361?\213,d'A\003|\265\255\001\376\300t\243\224M\002\274\244\276\353\312\002\325)\251\357&[\001\214\244~\303\335\034\343\327\024\300B\324\037\255\224\372\244=\223z\2766"
+	.string	"_=N\323Ty5\0018\311\371n\246i\332\307H\212\357=\273E|\372\370J~ +\371\203\254\362\027\325\374\306\252|D\313|He~\344M\363\367<\363\2752\231\337'\035\365\213x2|\261>|\030\276\032\307w\340\032\327u\246\221\220\266)\300\037\216\277L\243\273\250\312\265o\274D\306\346\355\322\324_\321Np\353wg\342[\246}\343\221\274\372;\033E\355\257Y\226V\"\266\261e\\\217\"z\035\372\332b\013\325\207}\205I\026\r\003\037\347\037\250A\2129\301Q\314\372\226\033\366=i\3305\3679h\316sH\313\nk2sb\0258\023g\347\377\247\004;d:\023WQ\274R\2412o\300\2318\n\331\277uEhM\2033\361\221\025\356Ll\204]\304;\023\017q\236\211\025\264\177\312\222\305w\2663'8\355"
+	.string	"\017\264G*\304\347\370\2656\357L|\226\316\231\230\351L\034\365G\216=\357\332\360\\o\302o\341\267Z_\373\026>Z\276%\271\236m\017^\013\177\371\177Ym\2555\340\263`"
+	.string	"d\375x,\f`\371\313\347\2308\366t,|\313\326\277\037\361\025\331G\034\325~\215\250\257\017E\266^7\342;'\237\232\0213\365\301I\352{\021\330\226\3728\215\210\225\330F\304\007\234\215\210\227\326_\362\355\f\362u\215\210?\250\206\370+T\023\242\001\242\005nhB\214\264^\303\227\"-_kB\243T\255\007\361\331\006\204j?|\266/\201N\250Q\020\305\003\017\211\210(HA\222\244\003\361\005\2041\307\252s\021\260\030\243\026\211\210\210\004\"\201Hi\007@\007{\350\327z\231\"h\315\327\257\027:\"L\301Ux\363\026&\350\360\001\233\314\274\031[\203\034\035\177\333,\215\255\344SK\023\365\020j\002\r\200m9\237\033\200\222\274\3433\270\007\321T\306-S\367\001(D\356]\177P\0254\231\247"
+	.string	",P%\256\0329\202G\021`\316\274\243\024\372\003\330D\241\321|f\036\201\211\350gb\263\236h\037Y=\264(ug\207\026U\335\032a\326p\201\354\360\323\204\023\307\250\207\234y\200h\306a\210W\265H\016,%\3333\227W\300\214\243\347\364\236\373\021\263\360;#\221`vf\206\263,~\r\213\270\263=r\215I\362X\335a\3001\005\\,\036\257\271m\252o\201\210\301n\256("
+	.string	"{\346\335\205\222\017(z\241\303\346\275\322\323f\207@\020\035\267\265\2269\205D\"\221\250\030Q(\024\n\205B\241P(\024\n\205B\241P(\024\251@\""
+	.string	"!\303+2"
+	.string	"\2441x\364L\021\3152B\273\231G\316\354v\273]{\267\337R\\\251"
+	.string	"\305%T\317]F\310M\246i\243\276\366\266\321\354\207F\b]M\327i\267\333\322\334\373o8"
+	.ascii	"1p\366\343\274\3774\3666\377\302$?]Z\201[\016{\350C\270\305R"
+	.ascii	"tH0\250\352\335\225\277\204\2264r\357\322\304LZ\":GJ5b:R\005"
+	.ascii	"j\345Z\214\237J\211\365\321\265`\246i\242\354=D\243\032z\257"
+	.ascii	"\032`>\344\2007\201\236\277\234\326\331\0306#\2456*\231\271\251"
+	.ascii	"\te\257\327\022n\313\003_\251\344\252]+!\3063\367\357\305.\026"
+	.ascii	"\377S\342\221m\263i\227\0053 JW\260g3\177\256\034\232\004\n\205"
+	.ascii	"`\370F\361\315\033'\340p\032\300\274\206\324\203\360\230\206"
+	.ascii	"\367\373\344\206Tx?\351J\341\022\232;\3606\336\210\262\204\333"
+	.ascii	"\244.\f\313\345\227\331\343\363\216\345\016\0344_p\321\337\315"
+	.ascii	"7\267\376.z\240\277A\034\203K^\320"
+	.ascii	"\301\356{\335i\232\243\310\263\274\236f\346\227\370\007"
+	.text
+	.section	.gnu.lto_.refs.bf6dcfc108f8cc68,"e",@progbits
+	.string	"(\265/\375`E\bM."
+	.string	"\372l\354\022Ep\336M\032\003\245\324\003\323\242\327p\356 \374\315 K\020?\230\210\tv`\006\250\332\332 2G\007l\2038\203\230\232\231\332@I\346:\352\347s\201\n\255YpI\260\2045\273\031m7\337\266I#\204l\231\002\r\001\032\001\034\001/\205\355Hc\365!\362\205bua\330\276\306\t(?\022\367\001\304\317\"\356F\260\257\372z\251$'\3427\025w&\342^\004\373\243\257\027z=\021\361\323\256\257Ds\025\3355\334\007\f\367\253\341>u\276\322\326\247\307\257Zu@\372mk\351\337\345\374\325\322\206\373\362|/\363\271\262~+\335\215\350c\245o%\340\237\214\257\204>R\372<\254\272y\376\232_\035\r\004\376\317\352k\325T\346MS\027\211>\b\\\352\274\n\352\247\240\276)\352\215\002\274\020\352\201O\237\002\377\004\356\324\3734\"qO\002\037\331\364^\300\327\342\275"
+	.ascii	"\336c1\001x\250\342?\365\366\245\245G\002\276O\351yIo\026\177"
+	.ascii	"\211#\035\375\230/]\266\f\367\321\3167p\364\313\336.V\364YFo"
+	.ascii	"\305{\251\242w\n>SpW\n~Q\370H\301\335(\370=\340/\321C\303\317"
+	.ascii	"_\365\355M\275\235\330\373aZ7:_h\276\217\367)\372\350\371\246"
+	.ascii	"\371[\337\337\373\016\004\243g\262~*w3Y7\221cH\337\365|am\013"
+	.ascii	"lW\260\263\024\366:\235\237@\267\022\366\375\325\b;\327\262~"
+	.ascii	"\324B\376\325\262N\265\334O\241\037\365\334\007X*\022\227\333"
+	.ascii	"\203\307\331y\303y\343f\b\302\317\343v3\270\327\340>07\002\256"
+	.ascii	"\006\367\277\325vt\265?W\353R\035\244\017\207{\360\374\241\337"
+	.ascii	">=\017S\033\360>OS\257\247\251\f\316\270\275\240n^f\337\275T"
+	.ascii	"\005u\242\037\362\323\023m;\001:p1\365!\344\367\016SG\321\257"
+	.ascii	"\267\375\016f\021\360\336\263\331\366\205\361\332\276,\366R_"
+	.ascii	"\025)\356R\337\023&V\253/\t\364\367\303\\\352\027\032\364\226"
+	.ascii	"\372w\177\260\352\367Y\313\317GO\035\255\372tg\371\347\314\035"
+	.ascii	"\177\271\261\324w\323\346\264\372pk\326\274\275\215\266\357\226"
+	.ascii	"\254\357\026\346\013\362g\023\253\317F\366\225\372i\350\217V"
+	.ascii	"\240>\032\331\276L\326\227d;2YG*w\261d]L\271w-\353[\310?\032"
+	.ascii	"\250\037\225;\326\262^\205>U\201:\225r_J\326D_\367\305\353b@"
+	.ascii	"\357jo\013\270\227\305\376\033\314\373\206\373y\376\2568Q\354"
+	.ascii	"\273!\336\023op\327D}(Y\037\372%\353?\345\356K\326}a{j\334Qt"
+	.ascii	"\257\310}yo\211\337\225\304\222\330k\331z\366-\264f\373\336\r"
+	.ascii	"\267o\335\216\330\267\217\361\027\317\212\330W\316\334\226\355"
+	.ascii	"\273\3463\373\242\331m_3\033b\3370\013b_0\373a\337\265\365\260"
+	.ascii	"\357\026-V\373\242U\355ke7\373V\371\315\276S\206\263\257\224"
+	.ascii	"(O\234<\267\357\221%\022d\177\254e_\036\002\366\315\221\265\257"
+	.ascii	"\rs_\032EG\373\2720\332W\205p\337\023g\331\267\304\326\276f\307"
+	.ascii	"}E\024\232\316>\241\353\366\357\352\276\335\205\226\320\276\036"
+	.ascii	"\245\375;`\373t\274\366\347|\355\3131\355\277i\332g\223\264\257"
+	.ascii	"\006\300\203\366\313\260}\267\277\246%\313\202v\031\265\217\005"
+	.ascii	"\330\277\236\366.\250\3758\265\033\227v*\251\003}S\322\321\201"
+	.ascii	"\002\355\275\355vs\273\355\260\227\367\2729\3545\335\267\267"
+	.ascii	"\033\252\206}\333\fu4Y\003\257\221\272I\352\"\251{\304\364\325"
+	.ascii	"-ROS\227\210\271B\366E\337 g/\020\034\273?\342\354\372\230{{"
+	.ascii	"\360\330\317\225A'\343\335a\276\307\275:vs\354u.\335\253\034"
+	.ascii	"\234\305\3615\216\r\334\2327\267\355|m\003\303eA|\305\202~M\273"
+	.ascii	"\262\037\276V\231\022\005\312\023'M\230,Qr\244\3675H\325\327"
+	.ascii	"\037>z\354\310\201\243\267\3273\031\306\257,Rl\367\325D5\033"
+	.ascii	"\2617\366\032bo|\005\2616\366\352\241'\310\256\317\236<t\350"
+	.ascii	"\342\300\031\356\313F\315\272\221\331\021\213\370\375\362\226"
+	.ascii	"Z\366\233e\323\254\254\215_*R\366l\317~\231\254\331\357\222!"
+	.ascii	"\023\372\005\342\243\307z\370\335\321\333W\307i\365\3151\332"
+	.ascii	"\357\215\036\013\342\357\211\336\226\361~B\202\352\210\277\237"
+	.ascii	"\343\266\306\322\330w\2634\376\270\005\375o;c\037\315\316\270"
+	.ascii	"\215\354\377\262T\376^\306\352\253\205\375Xx\277\034\373\356"
+	.ascii	"\303\b\240\0176\334\271\246\373\343\371Z\303\035\353\374\253"
+	.ascii	"\351\366\250\007=\324e\336ie"
+	.string	"<\323u\017`c\354J\305\215\361\303\205\361F\013c\017.\211\357\005\200\223\2501Te\024A\216\210\bM$#M\222\003\220\"c3\0337\020\300\247\003f+\367\325j\301\262\325\013]+\305d\0372r\237B\216\316Px\315\215ZV\b\241!\r\342\223\001\234\351\323\n\243Y]\213\217\263\226\301\202\324`\024\322\346\300, \250D\342\032\013\021\007\022\275\377\342$hp\202\202\214j\2532\003\352\323&[Xq\344\200\266\355\310\322P\320\232V\320v<\004\315\307|w\223\262\034\\\020\376_2\301@<\240\241\236\2271\365v\316\001u\221\nA\220^H\262\232\241\213TO7A\177Z\312\024\";mz@:\326\356\020I\377\341=\250\203I\365\262\351\257\320\211\364\337\243@\324^\354\344\2517#%\nO\"\317\020\361\026cK)\"a*n~\021\227\002\177\224!O\006^\371B~\215\337\315b\227\324\3202"
+	.ascii	"\016k\206K6\336\304\253\177]\\\3120@U\344-\333x\365\222i\336"
+	.ascii	"\314\351\326\"\233\r\200\325"
+	.text
+	.section	.gnu.lto_.decls.bf6dcfc108f8cc68,"e",@progbits
+	.ascii	"(\265/\375`\256\273\325\362\002\336\241\004c\020U \210Y:\215"
+	.ascii	"\001\355\347\242:\365\244\036!\312\327\316=\365J\377\231\241"
+	.ascii	"9J\033\343\254\3179My\210\241\247Es\257\024\351\r.\333\t\200"
+	.ascii	"\030\221\235\272\315s\317=\277\341\264\306\"\303#F\205^B\303"
+	.ascii	"S\322Q\270Q\311)\203\236\371\370\324\204\254l{\313-e\nN\016\222"
+	.ascii	"\020\324\020\3176R\340\036\206U\023\266EN\326i\230T\017H\221"
+	.ascii	"%Y_\017\223]\351Xk\246onO\366\362\330\262\276\320j\037?\323."
+	.ascii	"\251\233\023\235*d\262N\335~\022\037`2L\345nnN\326)[\332\266"
+	.ascii	"\233RK1\332\246\200\211\343\303Zc\341\244)\303\265\226\373\210"
+	.ascii	"tm\241\222\365\205O\333,(\305\3424%U\303\3174K\352D\313\222\226"
+	.ascii	"\245i\317620\341\013E\247M\247=\361\215\033\320\247\254S4VL\016"
+	.ascii	"\035a\262~0\314\376\323+\370\231b\001!\304\253*\353\353\245V"
+	.ascii	"\376\263\331H\2327u\262\376S+O\317\246^,<\2626\373\335Q\235\251"
+	.ascii	"\222\365\203Xv\225\324\231\2050\241\241\312\372\301\263\375\240"
+	.ascii	"\223\375\340\022\261\314Fl\307\225\254\037\024\002\226R\301\317"
+	.ascii	"4,\315\361\324Fz\343Aa\351T\212\203\307\311\371R\375\352\340"
+	.ascii	"\204\245:\322/,w\345\363:\335\335\201\206\300W\274\360\341\255"
+	.ascii	"\372H\n\245MSJ\032%\235\202\237\351\327\323\257\324*\r\302\263"
+	.ascii	"\224\341}\213\330i~\245Y\251\021\036'\347[\265\276Y\362\202\353"
+	.ascii	"\020\"D0\212\310\217\245\255\275\322'\370\231BI\235,I\273\260"
+	.ascii	"\334\225\363\255\342Q\023\342\005\027\205\222\"I\225xhzZ\241"
+	.ascii	"\013\033\350vC\322\345\310\252\037\324\261\377\264\353i\023j"
+	.ascii	"\315\213\216I\332\004\250\343J\256K\326\017Bm&\3077\272b\304"
+	.ascii	"e\375\340\273\217\237w\223&\371]\0221VbY\037\270\267\017\214"
+	.ascii	"\263\017\204\356w\220\032I\205\244C\260\034\332\t2w\320\264H"
+	.ascii	"\312\205\237\251\221\224\210\221t\007V\303rW%\300\275\201\362"
+	.ascii	"4\361\242\"\266\352\003\321l-\305\t\313\230t+\325z\207\303\273"
+	.ascii	"\037oO\262>\020n\037\350\266\017\\K\177\244@\3603\r\222\372\b"
+	.ascii	"r\276o\226 \351U\332\303C\323\023\013@\352\3400\022\037\244A"
+	.ascii	"\322\035X\215g\311\371J\005\233ty\301E\337\327\031\024\"\304"
+	.ascii	"o\b\0272$\253>p\310\376\323\036)\026\217'-v\234\352\227+4K\262"
+	.ascii	"Ny\2449\354h\274wY\037\370c\037\250c\037\030\265\017l\332g\347"
+	.ascii	"\244UX\264\306\276\262>\353&\245b\323\354\263f6vb\2405\b\377"
+	.ascii	"\254g\343\366Y.\373l\332\206J\237\262\220\315\216\f\253\254\323"
+	.ascii	"\030\251\f\374\374[:\203ur\276gG\276,\035\311\372l\225\r\343"
+	.ascii	"}\337\027\377m\375\375m=\333d\037\212\177\3267\177\311}\370W"
+	.ascii	"\325\245\214K\326g\207\354\025\377\254\331N\276\203\237\0352"
+	.ascii	"\337\333\203\361\270\232\250\262>\353cc\340}q\207\025\367\365"
+	.ascii	"\341\016\353\331\251\215_\374\263F\203zp\374\300\362\224\365"
+	.ascii	"\367\336~\007m\362\233\264lj\247\031a\002}_\347\377\254\227\347"
+	.ascii	"\340g\226\223\241hr2\234\034\007\313\241\275L8*\320\203S\204"
+	.ascii	"K\364}\235!\202B\f\323\242{V\253\306\313y=5\226\314H\"\206\347"
+	.ascii	"d\177\377p\223\357r\225\025$\233\312\315\246\261\377\233\263"
+	.ascii	"&\327\34199u\240\326\254!\263\321\3444\251sK\2303Y\377\307\206"
+	.ascii	"\346w\266\361\017l\377\247d\377\027d\377\027\265\2030\320\372"
+	.ascii	"\325\316\316p\332j\f\021&Y\177\215\263\277\252\331 0\320\312"
+	.ascii	"\001\006Z\363[\217\034\023/[\262\376\372%wIk\303Ob\220=\311\372"
+	.ascii	"k\224\375?\257\341gf\313Y\256\235\357\353\224\331\262\226\274"
+	.ascii	"\005\313\241\275/\225\006S\246\360\344D\337\367\r\n\201{\304"
+	.ascii	"5\225\321:o\371\3633\247\3417,[]\025\224\254\277\362\330_c\354"
+	.ascii	"\253rv\316\302@k\005Yi\366\3251{\350\304@+\006\203\177V\235\005"
+	.ascii	"\377\254\230\255mkpb\2405s\341\2375\313\3450*h\316\266\247\254"
+	.ascii	"\301\314<\351\361%\353\253X\366\224\374\265\202\275i\232\312"
+	.ascii	"\372\252\330\276\332\334O2\024\2577f?\304d}5\353\211\227~\362"
+	.ascii	"\340\332\272\336\263\227z\346\t\223\264\254\257\356\330\252\312"
+	.ascii	"\264"
+	.string	"\257\343lU\223\331\353\024\376Y\221t`\273\210e\361\312\372:m\277\203l$\373\310C\260\034\232\206+\003\315Fr\221\374\304\343\344|\227xl\274scQ\256|\004?\263\221L\244C\272\207%\310\232U_\377\330\327P{\013X\304\206\227\230\254\237\322\3319+\007\371\032\23069+\377`\243\225\205\340g\316\312@\216\347\344\036!B\004\255PuWwV\375t\316~J\267\237\232\331O\271l\374b\240\365\251\331^\263\360\317\372\264\311~\252\265\177S\370g\3159\206O\330\342\350\262~jc\037?3\216*\274\272<9\252\347\252\237\304\007\277\023\276o\330\373\276\036\206\\S\326\324e\235k\344\251\377lzg%nM\326\177\236\312R\251\020*\2569Y\337H\35105E\263~\372\356\377\370\231m\344(\347\373\276O\320lTe\375\234\267\257\367-\377\331\335\345\005*J\326\317e\366~\361\317\232g\004\005\207"
+	.ascii	"9\362%\353\347,[O\316\236\020\035:q\354\b\325\2116\241p\370\262"
+	.ascii	"\374\030/\357N\007?\266\263\203\337\3608\371\274\357\326S\363"
+	.ascii	"\313\217\333\270"
+	.string	"\301ox\330\367e\352k\276\357\373?\277\270/3\345\245\354\224e\340;9Fn\302O\314\207\367\216\351\360\232k\347q\330\217\347`>\034\305o<@\275/S\217\b\316\342\340\340\021}\3377DP\b\235\003\315\224\255\r\372Y\310~\276\261\237k\354\347\247\375\034c\373\340\237\365\231i\177\350\333\307v6\007t\366\235\370g\375\361\335\361\233\037\263\301Y\276\226\263\336\327\351}_\016\271\f\034 \321\254\261\026\241\343\273\237u\352\312\371\242\275\357\333\223\262y\221a'\353c9\373l\370g\025\326\355U\016\003\255o\203\177\326=\205\177\326\3430\373xm\037\227\355\r\305?\353\243\030h=6\262\217\253\360\230\037\235\032h\314d\375\0306\206\303q\370\211\305\374\030\f\376r]%\353={_\3470e\262\032\263\226\3651\210\265\247\257\257\257\017\203X\177\2645\376Y?`\240\365\304\375\004\354\263a\240\025\263\3416\374\304"
+	.ascii	"s9\326\202\267\\er\276\316\367u\366\344$w\236fY\277\205}\214"
+	.ascii	"\301\232\366\365a\f\326\247\260}0\320\232\361\317z9\f\264\342"
+	.ascii	"+\030\013~B\200\323N\342\203\247KUz\206|S\370\366\262>\t\373"
+	.ascii	"\030\355\016h\275\037\274\303>\206`\305}\030\202\365{\263/\376"
+	.ascii	"Y\017\305@\353\217\253@\320\343\264\2621$\353\037\227\375\230"
+	.ascii	"\n\016\303d\351ST\326\213\366\276\316\f?*^\266\320\262\306d\031"
+	.ascii	"\217a\3471\031\026;\211\017.tz\303\336\327\211\311\364\3732a"
+	.ascii	"<\001\017\306\023\250oK\230\314V\375\274\357\304@\353\306?+\025"
+	.ascii	"\232T\007\267\374dES\353^\270 M\205\212b\304\017\264q\247z\302"
+	.ascii	"\322\257\222@&\r\023\273\013!T@O\371\375\364\233\230\020\260"
+	.ascii	"\375W\262\324\371\253!\276~?\027\f\177`\212\377\327\343v\027"
+	.ascii	"T\007B\320owA\325\200\001\225\324\360\023\374\300\007\324\237"
+	.ascii	"\252\256\3075OM\307R1\335W\301\317\366\245$\244$@\3507n4\033"
+	.ascii	"\021\232N\247Y\243\376\325\306\377\343"
+	.ascii	"\371u\334*\3437\374\265\230?\r\323\024liR\\3\360\247`~\302\314"
+	.ascii	"\200\365\230\327\224q\f~\301\377\\\2304\340g#\360\247\023\244"
+	.ascii	"B)\t\177\332\"\235\300\237:\340O\021\360\247\304?\035\372S\017"
+	.ascii	"\376\224D\272\302\2376"
+	.string	"\340O\025\220\216HS|\370\323\r\322\002\244\034\244*\374i\211\364\204\324C\312\"5@\332A*\342O_\b\221>\300\304\237\002 \r!\325 =@Z\201\004\376\264\204T\204\b\374)\004\376\224\205\264M3\370S\t\376\264\370\247\021\374\374)OO\252\341\317m\177\266\362?\001\377\257\307\257e\264m\375\232\202\265 \377\357r\006\264\364\370\325\262g\020G\372D\005\021\024\r @\215_mb\221jZ\251\361\253\003\370\001\1775\005\026\352\t\300\f|l\206Z\246\032e\031\277\032#\323\370\327\254\177\025\362\377\330\177\035\362\257D\376\337V_\250O\272i\205\352)\277\337\257\337\350 \277U\206\312\301\372fE\362S\325\f\250Mpy\206\246\372\351\026~\351\237B\240_\374\362\2579\370\341_\037@+\377\254DW\340\352Wf\300\272\244\357\327\035V\2762\277\226\373\265\231\177\275\2232\177\215\366\353\347jgU\200\246"
+	.string	"\003\315u\315\235M'iV\252$e\262>I\305R(\377\272\367\257u\376\324}\200\207_\340\265\322EQ\231t\3765\3721\030\036\366\007\r\360\257E=\035\203\322\203\322'0\340\374)\214?\r\023\313\n\226\020A%!\204\344\257\3375\316z\314{\232Z\227\203\205\013\007\300\317Z\360c\f\254F\274\337\275\255p\232V\350\003R\261\247\320Kl\372\253\034\374*\211\177}\363\253\030c H\025\002\016\001\345\f\254w\177\036\242\340\203\216\340w\177\340\337\037\374w\341,t\003{\003]bu\323\346ij\235\t\017\370\357\341\202\261\265\314Y\274\203\177\017\375g\001\304\2045\371\247\\\330\374+\363O\337\354\324,`\264Tb\235\207\225.\225r\021?[\"\017\375\277[\025\320"
+	.string	"\275\200\004\254\230[\327\374\372"
+	.string	"\017\372\330J\227>q\222J\271\b\377\356A\\\317\374z\001\272\203U\356\317F\376\325\314\237\223`\375x\311\001i\013\024\bZ\313\374\351\223\254\344,N\301\277\347\2641_\375Y\307\237}\374y\307\257\367\032\346W\263\200\371\317b\375\222>9\207\177\227\375j\005k\227\377ci\377\375@\003\374j\207\325\355."
+	.string	"?\370\325'\254\340\007\177^\222\231\\\377A\241_uAAf\002W.\307`m\373S\030\356\300\037\334 =\261b\375k\225\324\370\253T\253\226?\035\300\257\222\360\247 ~\365F\252\200t\001\351\210\177\315\222& M\221n\220~\360\257+\376\314"
+	.string	"\265\224"
+	.string	"\251P\312A\003\376\264\375S\013~\355\346OK\244(\244'\244.\244(R\026\251\207\024\2044"
+	.ascii	"i\007\251\001~\265EZ\302\257=\244#\244/\374j\006\376\224\001"
+	.ascii	"\351\003R\r\322\003\244\002H\001\360\343\031k\332\237R\220\206"
+	.ascii	"\360\353u}\376\251\321\177.+\332\237\252\370\323\242\264\002"
+	.ascii	"\325\002\177\316@\232B*\202n\221^\300L1\370\323\245?\345I\231"
+	.ascii	"\376t\370\247M\177\332\363\2471\376t\206\252$\374\327+\177j\302"
+	.ascii	"\277bI\211j\374\037\273\013\367\360Du\361\337\352\007\272\371"
+	.ascii	"\325\f\253\025W\203\005dP\177\266\241/P\231\377\331\037H\367"
+	.ascii	"\253\301\365LM=\250B`\207_\363\255f\277\232\326\261\320vX:\277"
+	.ascii	"V\262V\371u]\352\376Z\270\226\375\231\001\253\363?\006z\t\373"
+	.ascii	"\200_\255@\262\314\257\363\220\342~\255\007\303\227_\005\363"
+	.ascii	"\253n\377\363\037\364\372U\2431\225H\313\257\266\370\030\260"
+	.ascii	"\354W#\360\337\205\247?P\212\226; -;\360\337\b\370W\262\024\206"
+	.ascii	")\337\377o\207\232\301Wt\225\022\374\327\240\177}\340_\035\370"
+	.ascii	"W\017\377\032\301\177\365\027\236\360\253|\377\232\377\025\377"
+	.ascii	"j\337\257\356\375\352\235\177\375\277\352\177\r\021\345W\355"
+	.ascii	"~\265\316\257\322\201\362\337\347\027\036\340_=\370\217\177!"
+	.ascii	"\f\377\372\344_\235\374k\363_\231\374k\222\177%\362\257B\376"
+	.ascii	"\025\353_\257\376\325\352_\251\376U\352_m\374\353\214\177e\372"
+	.ascii	"\327\367_a\374\253\213\177u\377U\371\257G\377J\201\177m\377\265"
+	.ascii	"\305\277:\340_\031\360\257\n\370W\026\377\372\302\277\256\360"
+	.ascii	"\257\037\374\253\006\377\032\342_1\370W\t\376\365\367\257\352"
+	.ascii	"\257\206\371\325\266_]\373U-\277\372\374U\025\277J\200_\305\362"
+	.ascii	"\253V~\365\204_5\373\325\262_%\373U\261_\005\373\325\257_\365"
+	.ascii	"\372\325\346\2572\371\325$\277j\344W\211\374j\326\257\206\360"
+	.ascii	"\253B\277\n\344W-\370U\007~\025\353W\257~\325\352Ws\374j\325"
+	.ascii	"\257\336\370\325\250_\245\361\253O\277:\343Wc\374j\323\257.\375"
+	.ascii	"j\006~\025\003\277z\201_\265\300\257*\375\352\213_u\361\253\356"
+	.ascii	"\257j\370U\346\257\n\177m\347\327K~\265\002\277\232\374U\244"
+	.ascii	"_\205\341W\215~\225\350W[\374\352\004~5\002\277\372\200?U\373"
+	.ascii	"\325\006\374\352\002~\225\305\257\026\340WY\370\325\025~\025"
+	.ascii	"\305\257\246\360\253(\374*\t\277*\302\257z\360\253$~5\203_\275"
+	.ascii	"\340W%\370U\b~\365\201_\005\372\325\237_\035\376\352\357W\325"
+	.ascii	"_M\177\025\377\272\357\327z\277\316\3735\234_\277\371\265\233"
+	.ascii	"_\263\371u\335\257\351~\235\346\327s\2776\363k/\277\336\362\353"
+	.ascii	",\277N\373u\330\257\301~\335\3745\223_s\375\272\310\257\207\374"
+	.ascii	"Z\353\327Y\277\276\372\265\325\257s\374\272\352\3274~\375\364"
+	.ascii	"k\031\277v\372\365\322\257c\370\265\322\257a\374\232\371\353"
+	.ascii	"\n\374\332\350\327D\2776\376\272\305\257'\360\353\b\374\372\001"
+	.ascii	"\277n\300\257\027\360\353\004\374z\305\257\021\360\353\003\374"
+	.ascii	":\305\257K\374\372\204_\233\360k\001\374z\204_\207\360\353\017"
+	.ascii	"~\335\301\257\205~\r\342\327\027\374\272\202_S\360\353\017\277"
+	.ascii	"\216\340\327\036~\355\300\257\033\370\323\247\377\030\374i\330"
+	.ascii	"\257\205\377\357\376\224\002?\236\361k\340\257\367\257\327\037"
+	.ascii	"c\340\317N\376\274\344\3177\376"
+	.string	"\234\344\327\372\327\371O\347\376\364\314\237\312\375)\231?\025\363\247p\177\n\346O\337\376\224\313\237\031\360\247k\177\252\345O\313\376\224\354O\305\376{\370S\260\377c\377\323\376s\371\177\301\237J\371\323'\177\352\344?\213?m\376w\341O\233\374\351\222?e\362\247Q\177\n\365\2471\374i\322\237\302\360\347'\177\366\372s\223?3\371\277\342\317J\376\374\343\317S\177\226\372s\006\376\214\201\377e\377\235\377S\374x\377\217\373oB___\337\357\200\334_\201\222\377\002\032\002\273\352?[A\226\252\246\254\237/`\203\301\317\313\016\250\275\254\377\346\236\022&Yo)=\245\312\034\037Y_@f\357\2508Xl\250\341\313\372\027h\331\233\006V\017\266-Y\377\202+{?\001\327\324\256\250\262\376\005\315\275e\364|\321\013\302\226\365/\030\262\377\355t\374\334N\233\351\005\374B\255\231\005\201\276\357U\006\301\270\275g\\\326\277"
+	.ascii	"j\377\273\351\233)m\212\233\233\254\367R\306r\346\214\371\310"
+	.ascii	"\372\026\344\355\343,|?:\277:\251\223mo\331\362\001}\337\367"
+	.ascii	"\370\013\337/\315/\316\226\006^N\300\340\242\373\375\365\375"
+	.ascii	"\354\374\366~w\360\363\307\367\213f\371\361\375\346x1\201\301"
+	.ascii	"E\365\274\264\300\340\242?\276\237\234\016\252\300\340\276\336"
+	.ascii	"\327\031b\310\025F\013\027\341Y\234\232\2647\353[ \267oA\332"
+	.ascii	"\276\005d\373\0268\331"
+	.string	"\267\200H^\007a\232\214,\260\254o\201\024\364\007\007?\177x?5X\252\027\226\343Z\001,\016\212\247V\375\336`9\256\025\370\304@5\024=2\275U\337e!\215\250X\326\257@o\377\377\265\371\331\375\330\374\352\360\363\347\346G\207\366[\263\266EKs\313\317\215\252#\367}p\025\245\206L\264\007J\013\b\034\240~\005U\366+(\262_\301\324~\005O[\310d\265\305\314\23137\232p\344\344~bA>\257\223Z\215\346\0302d\272\266\236b\304\374\304\204\336w\310\217\225G\336U\006\233\n\207T\231\254\017"
+	.ascii	"\261\375\377\340\236?\270\237X\372\3642i\t\361\300\001\200%\373"
+	.ascii	"\313\017L\n\207\r\217-\254/]~o{\216\016\221\270\254\017\200\030"
+	.ascii	"]\332~\\p\336\333\024\225\365)p\323\006\342\267\026\366v#\353"
+	.ascii	"S\200f\037O\301?\263\377\262\374\264\254l\360[5u\2004H\240\357"
+	.ascii	"T\216\fN\001\333\376\357\354g\345\277+\277\362S\333K\357\273"
+	.ascii	"\344|\245\202\336\232\366\260\242\357\325\025\b]\203\306\223"
+	.ascii	"&\277\264\377\324\356~eRQsY_\357\367\374\317\002\361\314\244"
+	.ascii	"\241{\242\341\250\263\362f\247\036\331\303\221\345\207e\345\221"
+	.ascii	"\302-\001\223\227\365)p\356\037?\377\353\3134\365\276o\225\352"
+	.ascii	"|\247\232\204\353\217\217U\214A\374C\234b\n\376\353\367\025\332"
+	.ascii	"\002\343}\257\324\330y\337\027\307\331^kL=>\274\034\336\367\245"
+	.ascii	"zrz\227\360\323\231\026\325\323\231\326T\206'1ZT\257\023\325"
+	.ascii	"\227\223V\026~r\322\232\232rz\2272\274gZSO\257\026\225\317{\366"
+	.ascii	"\356x:cZ\302ON/\325\373j\275>\357\023\023\325{\346\234\312\360"
+	.ascii	"t\2465\365t\246E\225\341\351\214\211\352\351\315z}\236\234C\246"
+	.ascii	"^\247\326R\206\032gLT\357Y\026U\206\367L\213\352in\007\234 5"
+	.ascii	"r[Qe\316\272\324p\327\223\323{\303\206\017\246)\037\271'g\326"
+	.ascii	"\273\346}1\232\214w\352\225{_\n\336\327G\326\324\032\246\035"
+	.ascii	"\230\255I\356FS\026\246\254\0166\232\266\262^'\271%\374\312="
+	.ascii	"=\311z\337'MF\257\215\367}_\017\226\234r\357\021,\2674\304\307"
+	.ascii	"\033%\343}\035x\235\357k\343}\227\360+\367\276\357\322\373\276"
+	.ascii	"\277)\037\316\367\305\362yj\332\260\361\276WA6^\037Km2\3367\243"
+	.ascii	"\331\261Q=\235me\t\265]9k\2763\234K\370)*\353m\276k\264\246\366"
+	.ascii	"\331R\331\033\365\276/\316\333M*\034xY\237\202\030\373\377U"
+	.string	"\371\225e\256\0352\202\250ysE\242d\317\037\031~\223>\275/\325\b=\274\366\260\242\357\324T\006\237`o\377\277\261\237X\223.WxY\377\302t\002\350\306vd\375\t\336\354)?\2607k\261J\363\365e\312O\212\023\3138\023\027#\353Op\366\213\362\374\332\357IY\363}_\037\241]\034-hY\177\202\261\375s\322\303C\206N\315\232\254?\001\330v\006\331\200<sd\355\f{_g\217PJ*IV\023&\331\315\225'nY\377?&\277%q\236$\221\312Z\t\025&V\342\262\376\004E6\226]s\314\016\225\013O\372\276Ln\232x\016\325^\363\227\365\023\362\033\362;\362\003\362+\362\323\372\031\371\021\371!\371m\375\202\374\222\340\347\217\353\327\343?\037\277\037j\024\035o\204~\\?\034(\204\321\201\n\375\270~V*\027,w\245\301\356\346\374\270~R\277),\307\245\303\354@\257\332\344\210\336"
+	.ascii	"\273\003\235\363\343R\317\324+X\356J?\341\203\362\300j<\351\373"
+	.ascii	"\002a\323\234\363\343\372U}\020'\nIU\320\020\216\0174J<\350<"
+	.ascii	"\205\201V\n\360\317\372\017n\366?\244\331\377 f\377C\333\376"
+	.ascii	"\207\347\376\207*\373\037\302\366?8\331\377\260\265\377Aj_\202"
+	.ascii	"\350\236:v\303=q\226\324Q\222\365%p\263/A\232\375\377l\374\242"
+	.ascii	"b\234\205\215\311\277\250_\215w\311\220\273\254/\301\332\376"
+	.ascii	"\1774\376\203:\022\006\227$\353\037\324\217\361V;\277\247\234"
+	.ascii	":\201\352\341$\353\031\232\335\302\303\312\221\365%\030\333\357"
+	.ascii	"\240\217\253\371c\3725\375\234~2\360\363\027\343\367f\371\302"
+	.ascii	"w$l\275\203\233]H\232\277\030\277\245U\207\327\036\326W\210-"
+	.ascii	"f%\216\r\240\276\004Z\373\022P\355Kpc_\202\032\373\022<\355\364"
+	.ascii	"]\367\326\250\227(F\246\262>\376\222\326\\\243\371\007\bO\034"
+	.ascii	"l\321\265\316J\007?\327\350:\007\215\235\"\344K\306\252\037\201"
+	.ascii	"\235\375\257rV=\0328\234\274\262>~\256zk\034(yylY\257q\326\302"
+	.ascii	"\310\340x\312zu\263\342\375g{\230\330\334\321\221\365\nG\316"
+	.ascii	"\331\025X\326P)a\\rd\375\b\362\366\372f\275\023\3168\342%J\326"
+	.ascii	"\217\300n_\357k\377Y\fe\313\224\264\265\315\312\006\252\212\213"
+	.ascii	"\221\254\355\234\274X\221\303\313\372\021\214\331sx@\365V\031"
+	.ascii	"so\240x@\364\326\031sw\031\214/mR\253\244q\223\353\204\331\021"
+	.ascii	"\332\261&\327\031\243\323L\233\312\356\360\370h@\327\246\255"
+	.ascii	":zNt\232ap\202@\311\242i\323\2262P(\224\013\3126\246\271F\306"
+	.ascii	"\256K\232\2706j\300\240\253\326jeu\262\246Y\251\254s+\331jf\215"
+	.ascii	"[\271\254r+\232\025\312\352\265\036Y\237+\334\372e\005\2636W"
+	.ascii	"/\353\226\225k\025\2622Y\243\254j\353\225\265k-\262\242\255U"
+	.ascii	"\326\262\325\271\256\255?V,\353\333*e\315\262\"Y\237\254`k\223"
+	.ascii	"\265m\005\262&Y\303\254bV\272\365l\035\262n\255_k\335\272d\r"
+	.ascii	"[\331V\263\225\310\352\266\226Y\305V#\353\224U\313Jf\035\263"
+	.ascii	"\246\255kV5\353\330\252d\315Z\317\254A\360s\355\262\362\370\212"
+	.ascii	"\265\366\270S\003\352|\343&I\227:7\240m\346\304\232vopM\275\225"
+	.ascii	"ino\315W\023\333\301i\201\306\210B\267<U-1\326@\311<\333\244"
+	.ascii	"\241\322\214\313\322\224B\367\004\315\373\001\335\263\001U\313"
+	.ascii	"\310\2415\315\2205\337\327\211\333\234\031k\346:b{]V\032k\216"
+	.ascii	"\324\311\246BS\233>(<:R\271\016\225;M6K\232z\353\322\326\035"
+	.ascii	"\250\034,\272)va\266\244Mk\027\365L\275\222:\233(\254\260\201"
+	.ascii	"\3426vL\322&,v\271\316\224>l'F\rj\267vQ\333T.<K>\357KDL\033\265"
+	.ascii	"M\032%\352\027\2305\274\350U3\353\260kB\337\034\201\3426uM\232"
+	.ascii	"i\023Z\035\266\363\022\006\233\371\261\336\313\007\035\203\335"
+	.ascii	"b\2445\363\227\037\343\331\211\202f0q|4\241\252^\232\036j\224"
+	.ascii	"?\327Y}\320A5\355\276\200\201Z\3255\273\254We\240\320\265\213"
+	.ascii	"z\207\004\332\246\213\212\306J\030\364}\235l\216269\214\245\037"
+	.ascii	"\001\226\275i\340\237\365\021\200\355G\220d?\002\254\375\bj\354"
+	.ascii	"C\020\335\377Z\343k\216\177}Z\241V\0348G\030.[\262\256J\371h"
+	.ascii	"l\021\313\372\020\300\331\377W\251\365\306:\265\332\300\317\225"
+	.ascii	"j\215\372\240\t\253%\201\256T\352\022v3[\002\335\302\244\244"
+	.ascii	"\371\276\316\225Ju\202\242\345\304K\210\020!\324#Wxs@}\b\354"
+	.ascii	"6\006#\364\265\206\036\"G\312I\326\207@\315\306P\f\264F\200\177"
+	.ascii	"\326C\320e\037\202\260}\b\232\373\020\b\331\207`j\037\202w\337"
+	.ascii	"C\233}\017n\373\036\314\366=(\331\367\260c\337C\214\375\007\344"
+	.ascii	"\354?\220f\377\201.\373\017P\331\177\240\271\377\300\220\375"
+	.ascii	"\007\244\366\035\330\333w\200n\337\201\266}\007\312\366\035\210"
+	.string	"\262\357\300\220}\007t\354; c\277\003t\277\203\231\375\016l\373\035\304\366;t\355w\270\332\357\360\356\007\335\355\007u\331\0172\333\017\352\332\017\342\261\037$c\177\r\006Z\317!o\237\003\231}\016\317}\016R\3669`\355s`\332o"
+	.ascii	"\272\337@\333~\003c\373\r\034\331o@\307>\030\f\264r\371\325\256"
+	.ascii	"<\006\253-\233\360\270\222\365\033\220\332o\300i\037H\316>\320"
+	.ascii	"\334V\323T5\374\fR\263\234i\272\341#\353\003\211\331\031xq\320"
+	.ascii	"\372>\034\264\036\350l\037(\311>\220\326V\257\374\252\231\032"
+	.ascii	"%m3\201\367u\022\"\321\201\243L\326\230\212\320U+=skzL\262>\220"
+	.ascii	"\325f\361\317z \250\375\ry\373\033\332\354o\030\263\277Am\177"
+	.ascii	"\303\224\375\rF\3667\\\355o\230\261\377\023g\213\200\201\326"
+	.ascii	"\377\240\331GS\241\200\240\243\246\351\353\211\227\213\253\253"
+	.ascii	"1'W\2750\017\016+_XY\253]BW\235"
+	.string	"\224\220d\bX\326\251\332\354 \245-H\221&L\204E\356t\351e\315\344ohR^\304\234\226\\U\222\246\211.\353$\316\263\367};\244`\276,\211\312\372?l\373\210\312\205\237*\022UH\225j$u\262\355\265\255\032P$*\226\232\265E\243\371\276o\207\020!\200xH\260V]$hh$\013J\220\254\377\3635\204\217\210\272\205\237\352\020U\353\030\f>\033\362k\302\005\f.\245s6\006\272\352\377,\355kp\263\1775\310\325,\016A\034ru<\262&!t5\310\372\325E\b\035 \252\217\264f\336\226\254\253\324+\036&\237\367e\322\006\372C\355\201\237\252\017\325\207\212\2252a9.\rF\006\252\323\242[p\253\276\206\272}\274%\207]S\335\241\362P\255\360S\275zv\276\257\023\216\334\307\243\276o\026\033\365J\325\221\373\200K\252\242\260EC,\307\210\354m}\rj\373\032\254\354k(\333\327"
+	.ascii	"\266\177\225\n\203\355\344\246\026\246N\251RjF\326\312d\255J"
+	.ascii	"\2517\342@Yrfm"
+	.string	"c7Y\003\005&\353kP\262\377\2533\324\032*\224JC}\302O5J\215\221e\211\311\227&%M\246%M\247\257\3618\371\2745f$i\252Q\252\214\257\36189_%/\230\234x\371z\3377H\b\307\007\0322B}\rR\373\032\226\3663\364\355g\270\263\237ao?\003\235\375\253/~3f\203\307S\326\277\356\003\372(\343\006N\326)\r/\350\334X\324\352*\3530\003\323\204\242A\24597\026\r\373\242\303\244eS\033\213\331\017\250\020\235\227\334\334XT\25697\246\271,\2012i\362T\203\353\234scQ\035\207\335x\230|^\247\246\036M!\r\247\303t\340\234\033\373:\223\006\273\235\360\316\215}eY\313\232\033\213\342i7(M\275.YV;\362\323\007*Sscf\346\310\262\346\306\2304\337\271\261.?>\243\303omSsc\3213h\310\246\346\306\242b\327t\331\251\333D\2201U"
+	.string	"\263&P)9\354\203\224\254\271\261h\0312\347\334X\324\214\306\323m\264\234.\243\327h:\372N\263\321yZ\216\266\243\337\350;Z\215\236\323s\264\033\235F\327i;\035\325p4T\237\321h4\237\256\243\367t\034\255\207\237\232N\213\271\036\243\311d\036\232.c\345$i\331\224\013[Z\240]Nr\024-\017\244\260\315\215\3419t\332\013\224wn,\232\225\320\345%Y\007\210)\316\271\261\250\236~\373`jn\354\313\314J\232\033\3153:\354\005\253\245\316\346\017\013\221'\350\231\246\303a0\031\017\310\330\346\306\242\357\353\334g\240V`(\350?_\f\264\262\031\360\3663\244\331\317\340\005\204\006\343\354a\325\344\375@\313\372\031\264\354g\030\333\317"
+	.ascii	"e?\303\221\375\fA\3663\314\330\367\331\333l\272I\025\036\225"
+	.ascii	"\254\357s\267\217\303\364\026\335DgI\313\246\f0gcMk\301O\275"
+	.ascii	"E3y\036\313dzK\276\242\227\210 cJ\205\271(\350\373\276!\202B"
+	.ascii	"\364<\371\300Q\265j58\272\250\037Y\337G\314\306\242\257\244O"
+	.ascii	"[OM,\332\2116\303rh\032\254\017\212E\237\3417X\016\355\035!7"
+	.ascii	"7\366\225\246\237\032\r?5\026m\345\271J6\013\021D\001[\323\271"
+	.ascii	"\365}\262\354\373\200\355\373D\321f\277n\352.]%g\305\221]\261"
+	.ascii	"e]f\247)\257+\353\3730\331\357 J\0176(_K\313\246\032\2401W\003"
+	.ascii	"\354oi\331\324\276\262\025\005\r{B\205mLS\321b\232L;\361S\207"
+	.ascii	"i)\327_zJ\2260\355\365\265\030g\032t5\177@\316\200a\023\352\373"
+	.ascii	" \3318\013\003\255\033\360\317z\037\255}\237\036\373>9\366}l"
+	.ascii	"\354\373\310\330\367a\332\251\034\006ZK\300?\353{\344\354\367"
+	.ascii	"\324m\260\n\274\241\351\222u\332\344\224By E\b\237U4c\241\302"
+	.ascii	"v5\360\033)Ke\2048\317\320e;)f\262\2302\2734\352kX\016\355\215"
+	.ascii	"Q\246\001\0248|VQ0ar\034\226--\037\310a\262\324\331\374]\331"
+	.ascii	"z\3461d\260\032\317\222\317\3334\247\326\324:t\022\355C\357\320"
+	.ascii	"B4\021mDo\351#z\210\316\32294\227\306\241{h Z\211\346\241\221"
+	.ascii	"\350\"\272J[\351 \032K\377\320W\370\251\265\362\327\363Y\266"
+	.ascii	"\362\240\374\005\313a5\017\246\230!\361\201\326\312f0\031\226"
+	.ascii	"\273z\227\340T0e)lK\352E\004\031S\254\324\234\222\\Gk\245K)S"
+	.ascii	"\352dSa\213\212\336\230\364\314\226\006P\320\264VV\313\\pT@e"
+	.ascii	"\311\354\317u\362^\356K\235l{\306V\030\364}_\274/\251\030\021"
+	.ascii	"dL\2617\346\222\244MZ+\245\201\337\244eS(\346\246@\337\367\325"
+	.ascii	"J\323h*\017\240,\361YE3\232[\366R\305\301\0248P\255\224,\325"
+	.ascii	"\242U\002\2246>\253\350\226?\227i\3414\330\r\313q\275LK\"P\021"
+	.ascii	"\302g\025}_g>\243\265\362\\V3G\326\301\237\317he6\231NZ6\305"
+	.ascii	"\3360\023\203j\255T*\035\363\320\364\364\276U\025@1\303g\025"
+	.ascii	"\345\361\002U\247\007\bZO\365\f1\302\224&\353\367xm5\251\233"
+	.ascii	"\324\331D\321t\003\032\245\245\264\r\374\3247\256o\244w\232I"
+	.ascii	"\004\031S\007h\262\001\3257t\215\213\361\320\364\3642\t\341\240"
+	.ascii	"\213N\235)}\205+L\220\255\317\023\335\317u:`9.\024\234\250}\351"
+	.ascii	"\233\002\325L\351\233\224\216\207\246\247\026\300d\201\316\261"
+	.ascii	"\3637\036\366}\265\320\232)\037\0304\275\003\002\313\241\235"
+	.ascii	"`\013\203\276\257S3\351\367o<N>\257\023\223/\350\027\315\224"
+	.ascii	"\356u\340ar\276S\353\221#r\260\242\372I\323\320Mz\206\216\241"
+	.ascii	"eh(\355\204\237\232I/9\251W\254D\3674\350\363x\355\363(\331\347"
+	.ascii	"\031\262\317\343c\237\007\307>O\324>\217\323\376\260N4\313\322"
+	.ascii	"\2333RY\177X\247\227\312\301\317tN\n\007\232\346\rq\323\234\223"
+	.ascii	"\306I\3634\270\251c3\026M\267\260\211ce\325\037r\355?\315\303"
+	.ascii	"\013\362\211\375\340\303K\341\360\2145\211\032\222\365\207S\373"
+	.ascii	"C\250\375!\323\276po\377\351\232\247n\376t.E\223\266\231\200"
+	.ascii	"\372\204\212\233\221uj\227\262y\332&\255{\3236\036d\275/S\332"
+	.ascii	"\246\307\316\3732\365`<\001\306\023h\260\255&i\253\276P\316N"
+	.ascii	"\351\204\236\256\211\301\025U\2255\006\370g\275\360\315\276\320"
+	.ascii	"ng'\006ZA\340\23755\263\204r'\244\213\\\031$\320\272f\326i\231"
+	.ascii	"%6"
+	.ascii	"jtZ\340\322\2700,\024\035\001Kr\326(9\354\330\242\270LZ\220\253"
+	.ascii	"7\027B\323\266\251:5?7.RaO\262>\001\254\264i\343\004\230\365"
+	.ascii	"\262QA\241\243\023\332\341*\257\224\207)P<9Q<g)\257\254\356B"
+	.ascii	";-d\r\017#Y\013\327\020\240\b\0324\3024AYKzk4\207\035[\324+\257"
+	.ascii	"iL\326i\344x\001b\347\216\0301\3023\270\312+e\302\213'\347k\215"
+	.ascii	"\361f&\214\231\013\317\254\001\257x\321B'k\241\334\3276\035\032"
+	.ascii	"\026_\326\3022_\373\252\323\272\223\265\220\314\327\3242\"mg"
+	.ascii	"\262\026\216\201\003\007\027\324\362\324\351\005\002\327|\337"
+	.ascii	"+\020\254\231\261;1Y\377\204\031!\030!\230\240\226(9\324\200"
+	.ascii	"}\275\357\025\210\002H)s\225\365O\200\t\275\b\275l\271\240\254"
+	.ascii	"\2459\277\0349\316\360\031\251af&\353\237\270!\344\"\344\"\354"
+	.ascii	"\022\224\265\244\007\234\262\241\005\227\202A\251\t\"t\273\260"
+	.ascii	"\213\236\025\271\261\254\257\247\303\374gW2Rv\352d\375\0232\322"
+	.ascii	".\334\222&d\373u\tz\233\234^ G~\366r\214\211\211\276O>@\024\025"
+	.ascii	"\t\"F\270v!\233\230"
+	.string	"\265\317\n\233\226P\313\217.M\\\225\254\205Y\324\0368\330<Q\373Y!\227\0302xY\337\004\333\276\211\247P\312\205T~\374\024J\021\242\245s\330\371^e-\301\031AJ\016*]\242\357\323\025\b\236\032o\264\210T\271\020\355B,$>\270\033d\221+W\262\026^9>\222w\345)\353\013\317\204V~\226\355j\223\205/\353\233@\262\205f\033\274\216\020;\302\262\273\261\301\005\312\217\254\205\316\277\371\317\016\263\224q\371\310\372zB\262\255\271\246\254\205aB1\374|\234p\354\316\036\036.3Ll\355\343\307\255\031\300\217[\205S.\004\373Y\226\013\020\"ZY\337D\217\375\013\277~\366\227\246\246G3\353\233\260\3327!\305\004?\205L\204P\324\247\367\245\342\240K\n\\\235%\341\023!\323\017!k\332\366\240\350pr\241\327/l\"l.\261\201$-ka\227\320\205N\3305*e\206d\335\001hu"
+	.ascii	"\377\2547!C"
+	.string	"\211\022!\222L\306.\365!\321\312\372)\314\331\277\360\210\360\210\020I\366y\337-(\266\257$I\202\f\325\306\230\271e\375\024\324\b\205\\hD(\204\311\007)y@\310\320rd-$\",\"\034\"\334\022j\245\340&\204\272\020\207\020J\030\004\304\325[\245\201\230\027kE\215\314\227\254\201\b\2118\211\311\313\372)`\331\357\300\312\210\024T\210%\314\201\205\207\216\253\246\220\207\320\207\260\207\360\007~\n\261\204;\204X\302+\017\362\264\234xQ\325z\2747\200\372)l\355\247\260c?\205\030\373%\354\366K<\267pJX\305\272E\315\371\310\372B*\2563K\240d\235\205R\277\260)\247g\326\027\336H\357\210q\203\312\372B\033\377\331\f\260\0212%ka\324\226Q\002\f\003\326\256\212\233$B\032\027F\375\302\032\330,G\365\270z\2235\017\376Y\203c\204.\244\221\233\240\305\305e\375\022Y\373\027\316\020\316"
+	.ascii	"&Y\301\347}\267\340\330\336\251\253\f\260\2312k\262d\375\022"
+	.ascii	"4\342\036\\\223\316\245h\3603\030'\214!\324\3642}\225\3406\327"
+	.ascii	"CgF\335\232\254\205N?&:5a\262>\nw\366qX]\220M\033h\260\r\233"
+	.ascii	"7A8X\216\013\205(e\322\035A;\017MO+"
+	.string	"\204\331A\365\356\004\363\202u\260\334\225\317\353\264%\n\r\336\t\336\255\351\0236\t\231\204o\320N\220O\270\204\237\301;A\274/\301;A7u\320\367u\366\304\241\202e\207\217\016\326\335\215\207\246\247\025\306\356\240A:\301=\374\f\326y\260NZ\026\214j\215@&\207\021'\035B\f\361\320\254\351\261\352?\030\235\303\223\305i$/\353\240\234\273\253\035q1\262>\nc\366\037\214\203\237A\275\255\367\325\266w7_\220l}\331G!m\007\241;\r\364\007\231\254\217\302\331>\n\316}\024\246\354\243\360d\037\0056A;\365\f.\016\031;\25467&\252)\353\243\220d\007\321\004\325\004\351~\266\007\214\255\210Z\326Gak?\230\346?\353\002\2222jYk\374\2675x\346\301\271\237\315qM\2326\262>\n@\366\203rA3?\313\263\206\311\263,\353\243`\265\037,\243\326\027\207G\326A2[\006\nO\030"
+	.string	"\177l\t\322C\314\203d\376\340\030\265L\332&\206\276;s\262\036\342\237\025\263\021zPL\220\214\027(Y\326?!o\037O\301A\267\240[0\314\007:p\370\310@=\273\213b\005F\230\025\305\n\252\261\322\322\234e\035\374\022\364\222S#Tu[Y\007\337\3262,'\266\254\177B\232`\227-mmjfh4\241d\375\023\250\004\327\202k@6\254\336XS\006[\016\254\254\177\202\0235\265\240\026\236/\273om\216,\313\203Z\326\204ib}`\376\246\243\215\312\230\254\177B\217\035|\006\237@\262\374\276zJ\240\301*b\354\334\262\376\t4\260`\021K\343\304"
+	.string	"\t\313\372\003\210c\305\n\220\214gJ\336\036VT\312\326\024\037Y\177"
+	.string	"c\314\314\200r\254\036\017\224\271\250\023*nY\177"
+	.string	"V\312\312\006\300\204\214\354\007\216\001\\\205\025\t\212\3417\373\355z_&$\300>\257\0010\355\233`\267\377 X\020lG\223\t^\366\037\204\022\224\022\374\302o|\3363/\313\3256\305\004+;\030%\030\005\330u\037&\035y&x\355\233\220\265\377\240\023/\035\006\330\347f\302\324~\t|\373\0176\203M)f%\260\t\006\213\004\231`2\024\232\336\027\bW\220j\253\313~\tT\366\203\\8\210$X$\230\344\207\006\005\250\367\325Z\022\244\302QB\221\375\022\244\366\361\017\315\372\007\215\004\215\374\230\b9\275C\304V\253($U\2779Mw:\262\276"
+	.string	"\364vP+\250\025$\002\354\303\261\207\025\025\316PC\305Gp\310\203D\200f\276\320\356d\035\334\332wlupf\320\374g\211oH\242Y_"
+	.string	"t;\230\025\314\002\262a\337\027\316\234\027V\364*\353\013@m\007}\004}\004\201\340wJ\357\227\227\347\003\304\220\315\030<3Y\377\301\037\017\002y\263!\345fI\326T\260\260\200X\032\336\367}\233?1S\222@\345\b\331s\223\365\005\200\265\203W\301\253\354U\302\224\036M\2702\036<\262\276"
+	.string	"f\354\240U\320\352Ge\245JV\230\254OB_\216\034s$\300\231\232\nVix1T\324kKT\220j%\243V\326$\353\223\020\267O\202\363\306\215\264&\373\017F\005\243\274\236$h\355?H#H\303\013\215\004\253.]\256V/3#s\310P\311\301\031]l\240$4\355?\030#\030\343\307\bx\373\0176\005\233z\314\215pf\377\301\245\340R\327\226\036.\\t\264\262\376\b]\240P\036fW\357\250w\260\033\210\227\211\251\002)[{X\321;\300;`\315\021\234\373\007\356\001\367\360\233\026\357\216v5y\262\177 \035\374\004\322\371Ae\255\227E\323\305\004:\002\221\375\253x*\336\216W\216\034v\t~_*8JhSW\226\365G\330\261\177\265O\355\373 %//{\255A\232\3508as#\353\217"
+	.ascii	"\265\177 \034 \0345\036\"\324y\363\246\311Z&D\217.\215\0337>"
+	.ascii	"o\023\033$M.\320\257!Y_\204\266mg\007d\263\302\013\201W\260*"
+	.ascii	"-\f\027 \2335.'C"
+	.string	"\236Y_\204)\373\007\256\001\256\021A\b\020\r\020\rP\315~;\3400\333WQ\272\230\200i\016T3\224\221\345\254\213J\031\327V\222\254/B\2153g\244x\205 g\227)\003\224[\341\005\242\312\273A\227\346J\326@9L\326\345\265\025\225\365C \263\177\340\030\340\230'-\3008`\034\260\252\003\325\326\036VtI\325\223g\326\017!\312>\020\f\306^\260\027\034\030\253\255?\320\313\025\340\027\020\370\255z1\024\232\274h\bI\366C"
+	.ascii	"\222\005\350\006\354\3625\374V\275\331\f\227^\020h\bW[\213\026"
+	.ascii	" \027\0367\267\365i\266U\245\355@.]\336\254\300d"
+	.string	"\rd\373\032\034\270#qY\003\327\260\033\032\272\031`\262\006n\301n<?\236_:B`\332\007\241\316\376\361\333\033v\003\201\202\027\030^\303k\330\r\370\342\245!^T\240@4 \232\0243\2733\340\2253`\225\025+\300*\261\0365Vx1\262>\b`\366A \333?\260\n\260J\327\034\bK\302\200\3160 \331*&\006$\303rx\244\230\r\351\356\260q\215\035Hv\247\217\264\321\301\006\223\tiT\271\001\311\372 X\355\177\020\005\003ks\373`L\024\340W\024`\225\024)\300*9\3001fp?\356\312d\375\017\236\373\0370y\362\004\253\005\275Kx\023\004q\373\200\307\022\240\223%\300\256\225\t\023`\027\006Bi\332\303\212f9QO7\232\007v\255\245D\226|\304\311\032\330\304\216,J\231\007\321}\017\330\366\017\344\302O \0270\t\246z_\246\253\n\334\346\322\030^\344\310e\rL\362\003\217"
+	.string	"\221\374\312\260\006OqJ\262\356"
+	.string	"\305@k\n\004\377\254\367\340K\b\260\210\020 \221U\353Z@\"\371\315z\337\346\017\314\2245\350\252\204\307V\234!\007\022A\263Gc-k\340\226\007G\366=\300\261\177`\020`\020/ \315w\352*\003\240\0266VC\262~\007|\373\007\376"
+	.string	"\376\220\363\372\001}\247\2562\bZa\245\221\313\372\035\310\001w"
+	.string	"{"
+	.string	"w"
+	.string	"\261."
+	.string	"^\001\257\200X\354\2734\347\267\303k\017+\312\376Pc\307\306\343@\2545\214\305\316\214[\007g\373\035\b\331?P\007P\207\024\034\035\320\220\002\342\220\002VMM\001\253V(8\366\260\276x\230\2244\213P\035X\025v\206\306F\326$\350\366I\210\001\241\2006\200P\300( \r \r`T\337\3346\303\303\211*\353\037X\343\300(\022@\366\205\242\373\007\316"
+	.string	"\316\330\203\226\331?0\0060F\220-\241\347\376\201M\300&>\257\375\003\227\200K\230\214\203\337Z\235\035\250P\325\034\366\316\034\266\217\345;\333w7\006\211\327\231\033\231\327U\221\254\243\217\262v\360;\365\276W&\254\305A\337\253+\020?(m\236u\366\316\332\341\303\333\301\2245[\007\273\201E\271\236d\315\322\301jl\336\304q\311\372zX\335\222\323f-\353s\240\267\317A\233\236^\r\254&\007byy#x5q\320\004\016\034\326\t8e"
+	.string	"\250\273\2557o\33047\034\360p\343\346kx\252\201\031\3172P\016\246\330\260Y\353\253\253\3336\326)\366\306\0214\350\032::2\350\b\2704i\346FX\231\233c\301\236\301(ntmY\177D\023\f\030\326\214\206)\003\324\211A\315\310\001e\334AE\311\272\314\005\362\354de\375\021B\366\177V\f;\006?Y2,\034K\206\r\363\023K\313\246X\032G\224@Y2l\034\373\254\022\322\341\266\207\025\355\351\321c\n\226U\177D\216\375\0211\366E\354\355\213\270ccc\275\304\361\360\325\305\275og\275"
+	.ascii	"\255\330!\322&k\266\215\355\"\304!$\272\306va\335\272\226\334"
+	.ascii	"\330\361\013\323\243r\327\2245\313e\235\343\346\306\033;Y\213"
+	.ascii	"(\263e\213\b\265,Y\3268ST\035Td\330e}\021T\366\317\216\341';"
+	.ascii	"\306\246\261&\354\360Jc\237\301\"b\352\\e\035E\013\222-)YG\307"
+	.ascii	"\344\301\031##gLS\317\016\0312\320:Q\306@\335x!\003\215\303\236"
+	.ascii	"\261U\330+,\026\266\214\265\302\242\261d\254\031~\262N\366\311"
+	.ascii	"\027\326\211\351\f`\314\033\274b{Z\263A_D3,L\207Y\341e\242\322"
+	.ascii	"\300k\016L\006l\221<\254,Y_\004\020\326\311\235\260`\270\312"
+	.ascii	"+\205\347\322p\260E\337\367\n\204\220\016\352\206n\312Y\2605"
+	.ascii	"\341\023\223\236X\326\254\027\373\265\365\254\263\372b\245\264"
+	.ascii	"\r\341b\312:\212\320N\017<\272\254/Bj\263P\330'O\264\300\344"
+	.ascii	"\262\276\210wop\267\177\266\3116\267\215\364\351e\332\262`\307"
+	.ascii	"\326\006b\220\260L\220\260K\326\367\305\316,\251\251\367j\n\004"
+	.ascii	"\233\204M\302.\331K\035\244\270\001\233\240\241\241\222\365\317"
+	.ascii	"*9\273\344n\211^\024I\326\327\013\222\301\252Z\223\3657\320\262"
+	.ascii	"\277\201\024.\256\264\346\006Y\373g\213\260E\236\315\rl\354\237"
+	.ascii	"\035\302\016\341\321\244\001\235\375\263Z\254\326\004S=r\242"
+	.ascii	"\374H\222\3655p\303b\261XlV\234\031\033\344l\326\235N\"C\313"
+	.ascii	"\215\254Y [\r\212\307\307&k\366\307\337v\364m\215\217\254Y\037"
+	.ascii	"\033\313\032\035\027h\326l\217\257\365l)[\223D\003\267\253+\254"
+	.ascii	"\206}\336\246\272-\315\263\375\263V\254\025V\343\340\227\006"
+	.ascii	"\245\005\252\301\224\0349x\230i\320\204\215b\243\330*\340[\023"
+	.ascii	"Ku\266*\210D\254\316G\326\354\324\337\256\230\275e\315J}\255"
+	.ascii	"\347*\314\023\276\254\331\033\254\r\r\202\354\237\245\301\322"
+	.ascii	"\200\032\323\334\261\177\366\211}\302=\3464\240\261\177V\006"
+	.ascii	"+c\356\316\376\331&\374d\233X'\365\351}\253\204~4\261N\177j#"
+	.ascii	"\275\361\023\313prt\\Y?\2039v\354\260K@*8\330\367\354R.B"
+	.string	"f\215U\326\273\357o]}Y\244d\275\371\356dpf\377j\2300X-\250\204\2561\315\253qj\\\0173=\275\035\005\352\231\315\371\216\246cZ\214\034\311z\313I\311d\3412$\353\353m&E\200\250e\375\f\326\362\362\246\254;pd`fg\267\341P\361\332\320o8e[r<e\275\337\374MK[\217\253\254w\233}\327\3036\206\316\331\276\333n\3245:n0a\301\215\330\227\2547\233\f\300\326\254\371\232\366yk4\0051\242F\315\327\316\276/\030:l\031T\241As\346\253kJ\006\357\376\367\2313X-}_ \\\353\016\257\020ve\312l\271\0378\266\334\327\256\222Le\375\020mc\306\244O\032^\f\225\3255\006\365\212\213#\023\022&\314\236\241\341\305P\315\2560\350\324\227/_[\0017\273\2464C\310x{\373\232\2067\313E\273\324\240Q7\267=\203}_-%\353\016\267=\254h"
+	.string	"\350\332\332~h\330\367\325:\362kkz\333\307dx\257\255a\262\240w)\257\004(^\001(33\333Z~\374\332\266\262|k\341\321j\243\304H\326;m\253\375gy\242\232\330u\t\226\3112w#\353\375\024:\251\363\361\224\365F\373Q\271\322\005J\326\373\312\306\362\237\275@\r)9Yo+_\253S\013\363%\353}\026\200%ee\252W\256\362V)\243\366\300|\275\357U\006\303.0+MY?"
+	.ascii	"F\310\310\260\332\372*ey\331\200\006\240JL\254\313\214\016\025"
+	.ascii	"*_\323\316W\311\352\325\264\207\365U7e\312\327\330\367\005\003"
+	.ascii	"d\355\362\002\341\266\377-eKQ\231\b\275\357\020\037kW\036\210"
+	.ascii	"\261\375o(\317\reC\345*\357R\317\032S\024\266"
+	.string	"}\206\017JN\326\007\001e\377\333\013?\267\027vS\235\336\254#+\237\r-\270\275\005\006H\214\254\017\"\006\022$\273\013\310oN^\363\273kmG\257\264A\222\365n\362\267&U\366\254\262\336I6\023 tt\234\311\372\337L\366\02257PXI\274bD\031\313z+Q\205@\301!FF\326\030\304\331\\\233\353\247\266\337\275\274\017A\270\370\262>\006d\366\277\213\340\347.\242J\261O\357[\365\301k}\2531\025'\353c\340e\377{\310\257\307h2\370\271\207\354\032\351S\326KU\202[\363*\003\2147\207\027\325\246\245%\002\024\267-YYX-(k\t\357\003^\324\036\230\350\373\202\311@\337y\243\346H\326\307"
+	.string	"\311\3767\220\343\347\006\362\265\025\336\030e#\3640{38\006[\373\337>\236\333\007&K\337\027\b\331\332\003\2073\203c\240\343\352jc\341\367}\337\253\022\332\352\232\357\325\024\b\225JV\033t\363\270;SU\367f\375\013\356\354\033\3377\266\325}\336\367mz_ ?\200<\314\246@\374{\352\333\352[\007\002t\334\221\221\3657\216\235\343g\363\217;\357\223\254\177\201\234\275\251\002\355Q\213\242\233\224BCK\f\336HD\213tt\225HC,\021\362X\\\002YlHB\266\256[\342\004\013/\270mQ\007\344Q\271\342E\261\001-\363\b\344\243\\\361\303<JJ\0321\177\334#\322\261\005\"\024\302\033\211 \216\b\341\036\221,(W\0305(\031\203D\356\262\002L\025\305\013-"
+	.string	"\241x\241\205\037\367\210d\001y,\2520t\217H\026|\020\340\266*\020\365$\227JE\033\214%\334\226\231\301\270\266nQ\205\333\026\365\030\221\305\026\306b{\202\210\347F\"\332er\b\310\330\272E\346Q\003Q{T\034b\006{n$bh9b\210\210\331\242\304\021Q{bH\205\333\026\3018\"\215\200qL\261L\272\311\024n[\344\363\273\221\b\346\321Qq\310\310-\"\215p\231\310\344\220J\344\"\217\313\243\365F\"\212\220\307\245\313l\340\350(\t\211L\"\177.\261\215\341\310\\_$\227Fn\022\371#*\266GZI9\204\324\"\255\314\026\251\350\202\361\250\334J\312\244\t\036\037\""
+	.string	"\230\304 R\022\331\032\211Lf;\224\\*\211\306\2432\0032yt\221\255\213v\251t\240u\213.\216\356P\2615\022\211\210\222-\fE\227\250T|QD&-?\274\350\026\215n\313\344):\022\261\350\240\244L\232"
+	.string	"ro$\242H9\242H\3713\204L\n\252Lb\221R\350\022\221EJ\025Y\244L\217\3266\206#S+)\223Cz\351*Sc\3733\266\314$\315\374}I,R\212\030*-]\346\261\250U1T\026S\300h\215H\026\222,\230\305\343Q\211\241e\003/h`qb7\340sT\002\265\306d\n\016m\f\r,\227I\023GI \240\016D\264n\221\303\361\205\037\237\f$D(5\364x b\331\266@Jr\241E*.Q\270\314\342Q\006\r\r|\320&\r1[\025LeQ\320\006\020D\260p\227EwEkL\246h\300\204\213l\227\313\244\241\016\313\366hX\342\001d\321qE\253\374\340\036\221,\030\217J\r\277\326\230L\321\016\025U\f]c\213\224\\\242 \"r"
+	.string	"y,\252\200<\2460&\227J* \217)\214\302\027\305\006hxQl"
+	.string	"\013-3\311\347h\200\236\241\013$\013?J\356q(y\324*"
+	.string	"F\021)\31034\036\225C\024\033P\374\270\255\n\306\243\222\003\220\221y\200\rF\346\001\214G%\007\037\026\200B\"\206\204j\005\332%\n\"e\013H%#\020\007\"Z\027\313$\023=\031\220\226-\213\023A\255\213\243;T\"C\003n\273\302xTB\340\036\221\216-\270-\223\210\350"
+	.string	"\016\3748\260\341\203\n\f\224\212\313e\t\016JJ\240\0246\034\025\207\222K\345q\250U\001\301\003,\214G%\005D\312\025((\021\200\bZ\267hT&\300xTZ\220B\220\220\373\002P\253TbQ\204<\256\030Z\002\031\333\030\216G\305\243{D\262\360\301\003\221\262\205\326\305\321-\2728.\333\023"
+	.string	"h\231\313\326\005\222\005\030\216\312\025DD?.3\231L\201\210h\210<\2460\006\333\"dQ\005\362\230\302\310\016\025\267\017\022E\003$6\b\2418\261\301\025&\021yX!\022\305\017\212\243\243$d\017\320x|!\203\313$\362\030\r\271I\027x8\020\341.\213J\021L\343Q\t\264\242\201\344RI\005\r'\202n\273\302\210,a\354\320*\225X\360\020)[x\301\302(\036\265*z\206\212\277\241\242Pi\b\331&U\240]\2420\036\225B\"e\013CE\265mQbC\013\032\220\307\242\nA\343Q\271\223G\267\250\002\205\006\023\033\b\340\036\035Y"
+	.string	"\031\271E\310v\351\2568j]\264-\2540tT\034\nb\266\355\262\250=q\034jO@\320\272E\025\314\004 \217E\025\330!3\001JE\026>\314\004\270%\214m\206\326\230L\201<\376\030\375\250HG\026-\004!\217E\025z\200\230G\030%\212\033\366\215D\f\021[\244\243\213LZ\216\030\"\222\300\230L\321\303\"\271\034*\241t\244T\026}\230D$\212\"%\320Q\371K.\225\2124\013c\276\221\210\242\244\026\255q\204\361\350\230\324\2425&S\260\310cQ\205\241\342\252b\210,\201\264l]\02680\231\355\320Pq\215@\007\017\020\222@\004:x"
+	.string	"\007\022"
+	.string	".\223\356P\253\200\326\307u\211\314e{\224D\200\326\230\344\036]\267\b\344\022\213\356Q{\242E:\272A\244\326e*\255p\300\325\260l\335\026)\t\024\203\321\320P\02184T\024\272.\221\2505v\270\221\b\b\214\255\333\036)\221\222&60\0378\001\224\\\266\016\030\032*\376\032 !D\244l\2415&\221\226\307\342\017\221\262\205\340\213b\003\220\226\255\253\354i\211\314\242\342\021\212\366\250\005\362\210\264,nh\211\310$\263\330\252@Z\026\231\307\023E\311\026\\\"3\001-\322\321\335?/\364|\350\270l\221m\321\276\007 l"
+	.string	"\202\b0~\027\201\004\016H\340`\275\b$\b\t\221"
+	.ascii	"\202\320>\bBi\b\"@\360@H\211\324\272D\267e\266K\"\3202\271\\"
+	.ascii	"\022\200y\204Qd\335\226x<:\266(\272+\214G%\207\226\250\302\210"
+	.ascii	"Y\\\2320\036\225\032\334b\362\210Hu\221\307\324\275\221\210\021"
+	.ascii	"C\0250\211EG\"d\322D\353\026U\374\210`<\246X\032\271?\021\222"
+	.ascii	"J\030\004X\032\271\233\311l\335\242\212\241\345/\251\204A\200"
+	.ascii	"\241\345\312l\335\342R=\301\302\013K#\026H%#\013C\261]\266 \026"
+	.ascii	"\225\356\217\262\001`kL\246(*\335\0372yd\201\210\b\310\375\220"
+	.ascii	"\b\343QId\200\314\034:\022\021\265I\023\306\243\322Gi\200|4@"
+	.ascii	"6\032 3\211A\227It\207\210EE&\321-\266p\001\304$\276`<*\2051"
+	.ascii	"\030\021_\024\225xb0\"\372\304`\3442\211D\306\243r5\036\225\251"
+	.ascii	"\213<&_P&\031\221\307\005p\b\276(6 i\205\361\250\344A\036S\270"
+	.ascii	"%\214G\245\317PKD\364\343.[%\214\226\350\036\035]\"2\031\303"
+	.ascii	"q\2314\nj\215\311\024J\356\321Eq\251\302\321E\026{X4\200<\026"
+	.ascii	"UX&KlP\361\242\250\224\341\250\035\032*\321\272\305%\217\261"
+	.ascii	"\310\307x\2244b\266\307\244\322m\231A-\322\321"
+	.ascii	"\005*\025\217Zcp\303\017\023\331*\221\222&\214\307\027\334b\013"
+	.ascii	"\027,\214\313\342\213e\022\205\261m\211\200^\024\225\210=\300"
+	.ascii	"\030\214\210\031\224\226\255\213\344P\273$\0321\213\313!\036"
+	.ascii	"\036 \236V\251\344\372\034\203E\310b\020\363\b\243H,Jj\321\032"
+	.ascii	"9 \217\305\242\fL$\242\261\330\032\025aH&\217\210\313\026y,."
+	.ascii	"]br9T\354\200<\026\213|2,\223\313e\313\201\210(\351&\r\021\207"
+	.ascii	"\210\314\026E\r\255R\311%\222\320\020\203\021\021y\214\301\b"
+	.ascii	"i\331\272\306\r\2551\231\002\331\016-\333\027Xxp\217H\307\026"
+	.ascii	"\332\243\"d\t\016\310cQ\205\fn\313lU,\333\242\242\343\222\305"
+	.ascii	"\213\344\321Q\211\243\344\322E&M\030\r!\223\212G\021\020[f\222"
+	.ascii	"\006\030\305\243vI|QT\"\032[\267\270,j]\344qC\f\307e\261E\036"
+	.ascii	"[p\231IK#\367GE\036\213E\300v\bYta,\032\207n\222\322MJ\022\227"
+	.ascii	"I7\211\244\341\350\250\035\"\022\223nR\221\303\221\353&\227F"
+	.ascii	".\321E\266G&\262\270t\203\\f2\331\202HD\264[\244\242\013\355"
+	.ascii	"\321\221(\271T"
+	.string	"\006\221\224K\"\362\210$4\266\255\222It\221-\222\313L\242\200\261\b\264\032\217J\236\226Yl\227C\310c{d<fP2\211\255[<J*\335\342\222\b\243\210D$\"\312\340\036\221\216G\304\026\206\243\222I$\"\342Y&\335\241\"\021\321\310M&\221\230D\"\"\237\244\022FKl],\223\206\210D\312#\"R\311\250\2415&\221\210\355PqI<j]\264G=.Qk$\272\034n$\242=j\207\206\212\0240\223\210L\244\343\222\205\321\220{|\301\210,qt\224\\\376\274(.\323\033\211HB:\036\035%\227\332h\310=*\325\027E\245\224\331&\035\025]\254\356\215\202\220\222V\244Lb\321-\236`\036a\2240\036\225\303\0270\013\370\004F\201\231\304\344R\251he\n\335\266hYty\\\"\211\016Z\244\243\253L&[\340!2q\242\204\213LJ\232\b\"%\255`\215\355Q\213\"\222"
+	.string	"L\344\213\244\221\203\220[\204<\"\217E\244V\005\263=\032R\032\352a\022M$\227JE\031\220\222\230\251\213$\"\245L\242\213\326\3502\177)R\2540\036%\211H\353\212\027-\222\210\264.\213.\322e\213\343Qq(\310$\336H\204\005n\017\361w#\021\356P\322\322e\222`\022a\264n\022R\006\030\206\222GD\342\352\"\223\222CD\342o\331\"_$\211\304\037s\3312\223\220D\3426\"\2170\020\211+\023yT2\211\304\0372yd\036\217Z\"\221u\211.\363x\344s#\021\314V\251\344n`l\227E#\346\006#\230\356\261\305\210$d\321\0060\222\220\307\243\r<"
+	.ascii	"\201\b\202\b0F\264\306\244\243!\344q\304\222\2314b\004\027F\213"
+	.ascii	"<*\"\227\255\213<\022\215\305vi\344*\211D\016.\332\245\222H\\"
+	.ascii	"]\346\361\210H\\\213n\321H$\256\313\242\321\220nc82\211\304\025"
+	.ascii	"\206\241\344\221v\217H\026\334#\362\b\204Da,\266\313u\351\276"
+	.string	"0\204LBQt\213'\214\305VEr\251\244B\007$\212\341\215D\034]\030\355\262=2\"\213+\034]\030\355\217\213$\312L\342P\253\002\206\241b\213\243\243\242\211\243\013\243\315pta\264\332e\022\217\312\025D\355\211V\251\304\202\310\302\013+\202\355\020\262\3502\221\307\355\022\017\300\202F\036_@2\207\326\243\222\2312\211&H\260\0204A\202\005v\035\"qLo$\202\231\324\242\003\223\230\302\350\263l]f\021ie2\333\245\321X\374\265.\212G+\222\224H;\211\350\24252\223Zl&\261\035:\272hO0\223Z\004[b\253Tb\301Lj\301\266J%\227\231\324\342\307Lj\221\266G\305!\246\232\\\266\016\330&N\224p\211$:p\221\307\0373)yt\321._\320\360\242\250\302\304\t\340\257]&\271\305e\253Dj\335\240{#\021IJ$br\251T44T\034\301\\\266.\216Kc"
+	.string	"Z\242\n\016>\340"
+	.ascii	"\204$%\322\0172yt\223\216\222\314v\td\0227\264\304$%Rpu\217\222"
+	.ascii	"\230\255\212\366D\222\022ICKD\026\035\217\212D\036d\321\361\250"
+	.ascii	"\004q\030\303\n\006h\335\242\n%c\261UQt\213Fv\311$\"\032\025"
+	.ascii	"\035\215\210D\312#!\221\362\210\030\203\021\f$: \032i`*\223\313"
+	.ascii	"\023\313\326xtq<\221\244D\352q\211EE\026\311\343"
+	.string	"\257\250\310\342\350\302 \200\213d!I\2114l\211<\355\262\370\302\270\024\2727\022\3014r\213HH\230I$*\211~`\034\227n1\0052yt\213nr\311\223\\*\025\371\270\370\221\b\272L\242\213\366\204\213\366\304\212\027\305%\212\344R\251\250\007\211bo8\032\002\2717\022\221\\*\025\215`.\223Ld\313t C\022\261\205\344R\251\350\307\205\001\367\264n\321e\252\255[tW\b\271J\036\022LfQ\371\"y\304#$\264t_\330\340\022\t\221(\224\216\224\312\022?\356\215D\020\215@&\221\220\222C\017<\251l\227#\334dr9\"HB)3\2110 \213)\030\213I\0258\266\320\300A\213,\324\"\223h\221\205\212\231D1\013\301\310$`d!\245L\302h\310M\"\2051\254\320\272E\025\355\221\022\251\270bh\250\330\3232\023\220d\221\\*\025\261\2551\231\002\231<\272C\255\233\\\276p"
+	.string	"fq\205\344R\251\250C\021\362X\244\302Q1\351D\313L\332\340\022a\264F\344\221\310\034:\"\025\221JF\"\007\346\021F\211\242\244\026\355\211\344R\251h\270l\335\243#\n!\362\b\202\220\213<&m\030\305\024D\312\026\220JF\326%\212\340\"\217I\277\013\t\231\370\220"
+	.string	"\027T\330C\"\214G\345\b\327\250\350xD4\002y,\"\215\030Z2G\210\340"
+	.ascii	"\003\263\230\202y\204Q\342E\362\210h\331\272H\372\034%\223)\020"
+	.ascii	"\325\363P\361P\361\340\270\2060\020p\2528\361\302Su\036\034\277"
+	.ascii	"g\346r\244\257\216\005\254\275\226\343\32459\"eC_9#c\n\317\215"
+	.ascii	"\341\2143y{ixl\f\337--95Yo\270\222r\243\006\220,+\331\341&\b"
+	.ascii	"\r!\302\2748#m\240\206Dr\227\331\027/O`\333\210\0232@f\260Y\302"
+	.ascii	"\0377\342\214\2211L\3026\341\302\307\027\203\255\3225\240@)\343"
+	.ascii	"\244\305\316\027\255\261\246(\333\224C\213\023S\227\372\264\022"
+	.ascii	"Se\t\316\336\326\326\313\363\016\231\260@\210\314Q\351\333XZ"
+	.ascii	"\n\227\0249|\254\031\350\034\035[\356\260i\277f\225!Uv\344z\326"
+	.ascii	"\242f\242\354\261OM\347\316\227(Y;\303\336\327\311\263FQ2\243"
+	.ascii	"-\353at\030\245/\210\216\254\317\302\215\341\0349\3023A\2754"
+	.ascii	"e\356\364\330\245M\006'\211\2208B;/\246\257\276\2744\302%`t\250"
+	.ascii	"\360X/=Y\204H\245\201\303:\221\315\230[\203\002\273\276\332|"
+	.ascii	"\270y\263\255\276\\A\362\306\371\004\313\227\0327B\266\337\225"
+	.ascii	"\350\226\2526B(\237Z\036\0326\3028j2\322\342\f\355\200r)\340"
+	.ascii	"E\021\251\373\241\021S\305\216\0274h\206ty\033\204\3510\002F"
+	.ascii	"\315\207t{F\217\235\2217\270\254\207i~h\3223|K\346\330\315\311"
+	.ascii	"\215\241]\211\311zhF\213i\342R#\353:sRs\342\342\206e\360\024"
+	.ascii	"\236\007a\256r\200\370"
+	.ascii	"\207d>,\023\305\314M[\326\3031bV(\263\377!\334\206\n\021-R%L"
+	.ascii	"P\313\035\220.4Y\017\275\f\277|\b\346C0y\b&\355\353[\305\320"
+	.ascii	"`Y\337\200D\330\274\033cq]\200X\300g\037\2346n\273F\034g\363"
+	.ascii	"\035\256\r\327\206mw\346\206l\037\266"
+	.string	"\335\315\221\251Y\263B\332\376\207[\202UX\256\320\311e\375kN@\215\312\223\250,\302.=k\262\210D\251\245O\271\311\215&zi{\006^Rs\226\344\211\335v\304\330S\313z\210\005\243IC\305\b\223\221+U=C\256\366\236V\200Qg}\352\233\332\022\227\031\273$\003\211S'Ze\333\340\001\303\303*I\231\016\363\274\223\2531$\373\320\211g%\244G\326C\261\341\330\1776\225\322L\253\273\233;\2576\\\306\262\036R\031\206q5\237n\177s\350TO\364I\324\016L\210\366\273Ae\257\310\024`\222t\216\016\234\334\327O\215g\212\2332kR\220\2448\270\274\256D\021\006Y\257\372\316|e=|2|\262\345 \370\312\241\006L\207\211\213\301&\353\257\320\034:\031:Qj\316\215}m\305\035\371\221\365W\3601l\016\233@\271\237\225\220I\035\037pY\177\005\031\303%\303%C&AYKp\002"
+	.ascii	"\315\241\006\f.\315VS\326Lt\230*s\236OzF\214\f\223`\345\250\003"
+	.ascii	"\027\305L_sh\f\221|\230d\r\215\016\034\246\254\207G\376&\214"
+	.ascii	"\222\222\022\225\365\220\013\223\245\211\216\211\006\253T\"o"
+	.ascii	"o\210\230\331\332\032\022\001\002\362\003\203\332Q3\034\362!"
+	.ascii	"\021L\266\3470i\033\243\305\207\217\241\020\\\345\225\202\300"
+	.ascii	"G\216:p\3214hbXY\037\nY\373R\027\307I\326\303 \177\033\332\t"
+	.ascii	"\342\225#\353!\220\341\017\025\234C\254!\026\273\244\303U\216"
+	.ascii	":p\321\335f\306\031%Y_\005\246\341\325\360\n\210EGnn,\232e\325"
+	.ascii	"\006\225\365Q\310\031\342\370\320j\210\003\210\025t\002\001\222"
+	.ascii	"\251I\340\306td=\3241\314\001\245\242\032\332 3\262\302\213\202"
+	.ascii	"\223\222\032\316\200\373qYCu6\204"
+	.string	"\032B\rm`\037g\323\\\330\306\222\346\243\3070\352C\033=U\242\340\350d=\254\301~}\201\"\273\223\365\220\306\327\300T\321\002m\016\235\206N\303\031a\240A#>\324\334\030\312\370p\306]\317\027\237\232\216\254\2071Ph\r\231\206LB\273\240\375\212\315\201\201\272\211\235\241\223\243N\235\341\033\264_131h\212\205\315\330\034a\337\207\357\335\360\007\220\2636Y\013\371\004\340\024\227&k\341\235\257\r\345\234V6\262\026\332\321a\224\020\031\263\312Z\270\027$\315\216^\230\2633T\344\262>\212&aT\030\025\332\251\341`\003\036\031b\367\226\365\t\220'G\016P\016Wy\2456\320\311\232\033\033>\255\301\202#\203\207'\214\203\253D`C\013\356J\215R\325f%\357\3028\270\317\214\0251^\274\264b\344e\271\273\023B\203\262\002\215\337\250D\004Q\330f#\3020\306\"-&\241bj\250\206\223\024c\025"
+	.string	" X@\032\017\n\325m\225\017\024\200\rW\316\222xR\232\315\263$TH!2 "
+	.string	""
+	.string	" "
+	.string	"\002"
+	.string	"@A\001\023\200\317\232\240\345\n+8\f\212\232r\243$\302\354[\3450\313\251\n\217\247G#\240C\252\203IIC\357\306q\355\365{\331\342$\220\353^\260{>\350\312\034\f\330B\007*\211\"\202\242\020\224MJ\211\212\234f\347\343k\220\245\2665@\367\225\005\004\224\275\203v\234\343\223\334\242\364`\b\016\315\2320[\336\b\022\254)&'\025c\t\264\007\313"
+	.string	"\305j\254\317Tc,\360\006_\237\225W<\337\321\027o\021\017\272P\234v5,u\376c\314\237g\326S\331\376QO\b\320\243F\233%\235V^\205i\242P\330\245\346\347\223\230E\332`\353]\022\222\3439S\273\024\031\025\3263\217X\343g\246\302\363\272\206S\247dS\r\223\242\325\344\025\367\005\031\260\306\315\016\b\265\313\026\024n\030\311y\325"
+	.string	"D\360\215od\3777\224\344U\232\022|\234\270\016\237U\320\021\212\301N\246\303\314\346\275\256\373!L\260L\205\232\275&%|T[\243\na\267E<\253#\216\323\351'\342\206\363a\352\036\363\354\335x\377\314\306\032'\225d\020\344F\320?\350\346\315\241\n\030 \324o\262\274E\031I\241x\316\270YO\243z\344\230\301\024iCyy1T\n\276\\0\253\364\376\303\207<\221\3678\225\326\330\252`c"
+	.ascii	"\203V\006r\371\243\311][v\203\246\363\330 \302\354\305+\215k"
+	.ascii	"\320\235\b\322E\331\200=\032T\213\256\211\243G\331F\367\273D"
+	.ascii	"\311\0258h\314\276\366\201\t\241\316\374\213\361MBk\354\002\257"
+	.ascii	"\200\313r\273L\210U{\272\345"
+	.string	"V\310\275\264\300\003p\3229\237\222\246\311\352\233\305\243\317\363F>]e\274#\003s\313\006\324\346>\272`\340\f\204\227\240\301\257:\n\201\027\030^h\226w!<^c\241H\312\255\001X\277=EEC<p]\277z\372\020.\224\201P`.\256+\034\335\250\025]\002\005EH\3175-\276C\241\322\344\322J?@C&\225\001N\371Jy\233\257\017\253\261.TN\007\241\356\235\315Wnr\004\361\367\322M\017\233\r\340\274b\243\321\256\3158\361PX\254\221\025\201C\212\230%\177\003q\224h\262P\342\347\264N\301\203\340j\355\330#\251\005:>2\005]u\325V*\036\262\265\313\023Y\244(\3272d|8'\034}\023\363\234\3671\327 \375i\025\350\316\200W\037=\375\rR\304\253j!\177$\203\205\302\004Y\236\001axf\316}c}\023/\337\235\314\313\222C\270\240\261\026\275\"JM\262\267\354\277"
+	.string	"D\200\264\352t\315\277@\335\325w\216/\346+`\370\355\232\331\004\270U\230\005$\205\034\232u\344\237\317D\362Mi~\037%7\210\370\305\215\202\324\031\300\322\334_\373\330\f\320\311\246\300\307\215I\366\321\036]\343\315\346c\022\211\001\035xXq\306\212i\334\222\277\0134J\035\\40\376\323\001{g\301^\224\273\330j\326\005\r\037\211\257f\230l\242@\263\304A\302-\037\337\3520\016+\020<\243M\345z_<m\264\262=`\350ez%\232"
+	.string	"E\036\307\023\n\356>\204\001N+\375\210\226\b\177\310\266f\222\303"
+	.ascii	")M\246\302\323\233\343\210\226\363\020>\302m\376\013\332R\001"
+	.ascii	"Y\322V\0347\377NjXQ\b\260\242SO6\377\306\233\253\301\271Rj\301"
+	.ascii	".\334\t\373\372\262\254\236\264\377gS\212q\243$x\235aW\313\031"
+	.ascii	"\202\316\354{\335Y 7\232)Nv\257\030\032w6\031O\202\212\366\217"
+	.ascii	"\306>EE-f\\\363z\360\351%\216}\277\340\310\360\316b\261\244\270"
+	.ascii	"zx\313K`\024\020\372#\332\332C\301\350\274Y_\215\254C\364\320"
+	.ascii	"z\300\256.\330\260\023\256\227/\355\2374\327T\335\307\254\214"
+	.ascii	"r%\373E?f\b\306SS\2378\272\246\217\242\317\246\313-\362\367\022"
+	.ascii	"\275\336|\tW\365\361b\f3X\005<\364aY5\271S\256a)~~\255\251\303"
+	.ascii	"\306t/\257\177\252\334_\004\367\223\377\021Z\027\blD\213\024"
+	.ascii	"!\325^_\020\0042\271U\005\262\304\344\312\210Wo\276ME\200|M}"
+	.ascii	"\342d\371Nq\217\276\020G\2154 :\337Q\203l\250V\307\034\2376\224"
+	.ascii	"\"\006\323\006c\025\341\217\301\237P\364|\216\274\r_\2313\345"
+	.ascii	"\230\034\\-\231\335\323\262\333\360\376"
+	.ascii	"\344\251\302\006&\364Y@\214f\2273^9\335\025\335>(\321\247\274"
+	.ascii	"\210f\315!\035\240\340\267\005}\214\331\206?\302\267}\311\272"
+	.ascii	"\342~G\244\242*8-\013\234\317A\26155\333\253\262\214\256\300"
+	.ascii	"q\250\213\242\030\260y~\245S\235b\377RN\345?\024\342-+\031\023"
+	.ascii	"\253Tv\374\370B\3046\t\032\031H\325\356lZ\267u!;z\356\3317z("
+	.ascii	"B\215d\257\"\241\224\240\264\322\271O\365\240\245\211~\035M\333"
+	.ascii	"\213\322\206\023\371\331k\357\320K\201vp\363\327\017\355YS\246"
+	.ascii	"\373\017\337W\021\"\304\236\250=\363\232}?\376\t\005\037z\262"
+	.ascii	"\243\271\265?A`\245\257\260\361\213\b\2617'\255\350\204A\345"
+	.ascii	"z\222P\0249X\027|d\347Z\240\213M\326c|\347\376\n\216\033\250"
+	.ascii	"\270\220!\223\365%\320\360\350\345\322u\020\0327Rl\255\034KA"
+	.ascii	"\306\206\211\302\017\264\022{\241\177"
+	.string	"\362l\265\317\0275K0\256I\213\206H4\203Va\312\004\031\\9\313\n\026\255O;\232J\301\307\322\355W2uKaL\272p!\300;r\216\037\035\325\001K\376\b-B\301FF\237\216\275(\2210\276\311\357W;\221\334\311\213\255\334T\300\313\013\335M\271\205\241\210\272\267#o\365~+\256\203 MgbI\013\006\320\027\343\275\313g\0251\366\323\t'\006\301#\322U\220\261\247\353\351].\221\233@w\021*\243\342.l\244\006\231\325\361lZ\036\336<}I\272\372l'\250\316;\362\301X2D\245D\360\346\305\013\202\224\005N\251\245QX\221\002+d\b;\254|M1\370B\375c\206lp^\241di\025\007\037\231&\303\260\203\b\027\316KM\f\204A\by\303\354\346ds\211U\343\272oI\276/\354\312\352\007\214\336\261\030\311$\233S$\321Z\357rf\020Q\024l\364\032\3544$\270\253\357"
+	.string	"\273r\201k\234H\232\235\203\247\337U"
+	.string	"E>(\210\002D\n\250\005\227%\246ri\0339\350\212\037\220\271\346\025\361\334\367iq\246t9\022\247\240\374"
+	.string	"\246\0016\026\2254\324\256I\252\357Pk\262x\246\315u\007\274\302\245rX\320C\376H)\002\034\233\360r\357\353\004\023\211\317\377f\255+@\366\313;LO\214Q\257\246\001\305\334\330\236\272\215\026\351\255\256h\274\355\266\372\001\035\250\r\354\306\rH\323\327u\306\370\363\332\340RQ\327\353te#\362[$\307\377Q\345\272%!~\3132h\352\334\325(\252\222?\253"
+	.string	"\273\036u\224F\345\2611\265\231|\337\360\037k\005\237\350D\201\245z9\001\201\350J\316x\n\344&\2076[\263i\036vt\304\200\005\252\241\243\243\017\016.\t=t:\007\225\320\255\246\353q^T\240\264\251\304\033\253\234\255\251n&\004,\352\302\031\bv([f\3167"
+	.string	"wH\260\260\320\367U\201\214\220.\265G\321\355\226:\0172\344`Vm\0162\307\034\003\270\201}j\312y\346\263V\310HD\031\201\230qf\256\213\244\267\331\352\246\030^uXZ\372X9\227\306\230\2704y}\3638\342i6\227\340\205F\r\371\245\336\314\220\324\313G\317\236\350\367\376@\220\304\b\304;\345y\201\277\024\264\356\222\261\220\006_*C\254\265\210\262\214G\202\271\217\370T\354\354M\271,\265\225\210Q\327}\276\237\2409\0220F\271\225H\036\302O\311\357h\037\277\001\221\367\\\333-\260\315\333\240$?\222\226@g\212\204n\232x?\271\304AX\243\267\366\205\323Y\245\037E\025\312s^\240t\004=\220+.\223\353\213\2157\375^D<nV\257\206\350\004\005\3509U\016[>\345\321@w\343\276^c\254\201\201Y\003\324]\315\004\275"
+	.ascii	"\236\376\224\316\203\372\201\250:\234.&\312\215\034S\357U)\273"
+	.ascii	"\266J\310\350\200\b\243\354\225\300\351,\245\355rh\004$\365\322"
+	.ascii	"\255 \237\306\206F\322E\251\316\201\232<\351\344/\tI\t\314-\242"
+	.ascii	"\332\3679K(a?1;\263\031+T\365ca\306/\020K\002\031J\006'%\305"
+	.ascii	"`\212\035\303\302\306I\035\221\371j\242\244\365\274A@\274lV\020"
+	.ascii	"\b=\025\265\236\232\3427\301\365\270ab\322\342l\374M-\253\265"
+	.ascii	"&\034\303p\320I\307{M\207y\021\273p\244Y\330\277\355\021/\265"
+	.ascii	"wm\252\312\232\\T\302\355\364\367!8\355\215\251%b\233\201\353"
+	.ascii	"\253e\266kz\371\243\177\361\311xw\251\304_\264\230\030\364 \003"
+	.ascii	"\3043C\306B\"~5\361+\263M\361Cq\n-.i\026k<\235azbKj\221\200U"
+	.ascii	"d\177\367\220-8\345P\362\031j\214\216\013v,#\261^\177\227\351"
+	.ascii	"\"\257\270aRv\222\031\326\263D\331\326\301{\253-\274,\355e\234"
+	.ascii	"/\024\\C\321\220P\351\200[\177W\322\035B{-\300\037S^\343\262"
+	.ascii	"\021!B\203\222\032SM0o\341\256\221\253\247\342+F\314?\366\215"
+	.ascii	"CQS\026\017]\241\256\205\035\034\265\003\317\f\005\322Q\002N"
+	.ascii	"jb\357V\371D\023\n\353\246\222\263\032\025o\214;\031\n\343\244"
+	.ascii	"NjZ\211\307q2\214$\200\3117F\273)\030%\357\303\034_\313\342\020"
+	.ascii	"\006H\304\370\211\205e\206\013\337\343\031\247_\231\017\227\354"
+	.ascii	"#\340\375\323\316\365!t\203<`\227\303\246\017\027,\003\340W\224"
+	.ascii	"\326\007\306\203\224\346\243\361\\W\332C\233\332<3P\332\234l"
+	.ascii	"\001^v|\177 \354\305\231\266A\243\222\036C\203\345\276\201\366"
+	.ascii	"\031;v\371\241L\324g\227:\362\021\211\013/v\237\244\240\230\225"
+	.ascii	"\365\033\"\\2!y)\201\2322\034C\235\303#>\236\026\253n\212\242"
+	.ascii	"\243\215\225\254)\372Bj\037>\f\220~\240<\031\325\344\257\256"
+	.ascii	"\321\314B\004C\253\202\323\222ZZ0\310\212\325\340\226\213W&i"
+	.ascii	"\003\316\312\021\367D\227T}\225Fi\334\rN\354=\265Y<;V\fPX\317"
+	.ascii	"\276`\027k\336\023\303\317N\361\017e\274\232\354 A\337\267\273"
+	.ascii	" \244\005\273\347+$\344|\245\205\207\254K\321\366kq\006}\354"
+	.ascii	"]:\253\255\247\262\031\314\030qot\020\312\262\270p\222\025\345"
+	.ascii	"\025\245\230%o\025\017\\\272\223\354\205w\216\305G\b\032NyEG"
+	.ascii	"\024_\343M\2720\337\266W3\353ww\312\337\0020\034\020\006\215"
+	.ascii	"B\255\336\307\3514\262\245Q\367,Q\024\274\307\324^\020\022\373"
+	.ascii	"\024\212\016\337O\207\356\371\354\016b\347\270`\n`*_3ur.\202"
+	.string	"\243\326\177\224\200\335Y\317\034$\307\316oG\263?\200\240e\236fl\372\327\337WS\335w\020\034a\021\310B.\211\304\347\361X\273\207vR\366\313\200\204\257\037\346\216\264q\031\027\343KXe\301u'k3\332Q\3162P\254BA\223\226J\215\302\357\366\201\235\361\345\267\276\033Cl|\221\377\350[\224\322>\273I\303\\\237{R\366\315o\321\177O\353I?\230\315\374\205\352\366\324c\227\353\206\264\267Px72\007\013\020\344\253\332\315\214\203\266oJj8\277\024\222\324\313\354l\220\200#\243\333x{-\350!\231}\271\367\362\261\227\321m(\356\321\232\374z\357\272\315\254\312\360\251\364\243\005\323\342\2116\037i:\201{\232\303\306\r\335d\240\336\353h\237i\210\261$5\273\202\236\313&\003\266\341\245\247\034\026N]\345\006\241;aS^\315\023-\223\223\323\3538Q`O\3117\300z\300\313Sb\333\013\335j"
+	.ascii	"i\232\262\222\343\223\333\034\215s\002Fg\037F\2544\250b8\303"
+	.ascii	"\231Q\372U\353\253\213\034\311\322\351Twj"
+	.string	"@\305\315cY<\322\224h\013x\267\325\272\200\b!\314d\177\272e\b\304F\215:\035s\001Qy\026\320cI\264\037\b\b\313LQ\217\354\326D\207\"{"
+	.string	"\206x\034\274M\004\223y\002\324O\300'O\264\020\326\372\343:dX]\302\214\\\310e\0136\005\243\267\370bI\033~\025\252\272)\351\bEA;\"\212\334\3211\311\245\252\2105\2550\2313\235\nBHD\345Z\340M\017\002\232\246Q\np\267\243\370\0234F3\223\254]\214\233\025\005\242w\211`lJv\260G\255Yq)\026\250M"
+	.ascii	"72D\331q\301>\271b\021\216\253Y,\236\004\357]\275.\324j\364\354"
+	.ascii	"\301\254\266#c=\330\263#\357\323\332B\202.g\312C\t}.#\3668\200"
+	.ascii	"dZk\2258\\\255\210\363\207LT\364R\316h\217\231\346\252\364<'"
+	.ascii	"\271bh\021 kk\261\177G'\231\033$\305m"
+	.string	"R\030\0326\316\360K\314\212z\252f]8\341o\201_\";\346\272,X\377\257\317lh\300B\202\004gM\272\223\006$\310{e/\024\020J@\341-='5\274\227\372OwP\374\274\230X\355\337\352\351\357<)B\247G\020\373\240#!\222\262\251\302\270\202\t\3013\037\233\377\030\235\357#~\327\260\334V\2204Z\347\210:\237\350\363'\225\263HTQ\303\362\251@E\214\301)|\221\217\007\377\224\300rX2\271I\326\223D\352\227\303\270D\211\334\013$\361^\304J\177\2417\242\236\200\237\333\337\254\320\225l\372\275\220\364\343\220\334$\204W\352\257\020\346\016L7\214\356\361\340\342_\177\334\"\006;&\0203\322<\t\240\306\203\373D\0224\005\303t\360\342\214\032\242T\367\201\272\016\302\223(_O\020X&\211\274\350j\34417\200\n8\243\033o\357\302~\035\336\320*\002a\0271\256\r\355\207\354\007E\247"
+	.string	"\f\225\363\2151&\227\305\345\\K\024$\341\324T/p\330\276\210K\360q\303\370\033UwH\222&\226)\317\371\245\376\022\352\373@\002^\353\327\303T}\301\213\266FU\\u\276\342\305E\263\025D\203\246\250ch\353\371\200\001\rh\344B|"
+	.ascii	"\224\267\322Jtn\314\312Wf\341X\303\215\006\304\033|\337\275\306"
+	.ascii	"\331\237\264H\024\200T\260\276\345\206\323o\364\367\276\257t"
+	.ascii	"\363\267\357\244@\343\307\222\300o\233\246\034\246\234\325\267"
+	.ascii	"\300\025\034\342\203\370\n@\307\242\t3w\235\n\234\020]\255\243"
+	.ascii	"g\234(bg\207"
+	.string	"<\277_\024)Z\212\354z\263\360\331\344{\352\233\302\231\352JCI\017\037 !\364e\241\371<\n\321]Wz\266l\311\374\006H\344\274\031\373]\314\373Z\312\226d\275\030\260\224+\255\005\\U\016\265\265=\375\312@\367`l\361s\213N\242\036\231\330\r\201\250\236\007\223\341\026\334P\005h\330\246#\241\261\033\311\211\332\323\002\342\354\357\372\335\013\310@Uy|\361j\233\355\255\272-\322\n\250\264\240\023\032A\244-\003s\270\373^\304\214-\025Sd\023C\003\356\3623,u\215\214\315rTsFE\r\305>\222\003,\315\223\337\373\301|\033+W\237do*\f\327\036g\"7d\b\017u\367\026aB\224\343B\210yq\006\262@\207t\327\204\217\204\340\345g\356R\013|\363e\261\022\2353\b\212\372,\300\255Ee\021\237\017|.\330^\037\370Q/X\335.\257\222\n\223a\177\222ALU\253x!\220b"
+	.string	"3\317%\035\207#\352 \272\342\321\322r\nF\267\225@~[FB\017\260:\3060\377_\\V\373w\221\347%\274\341\200\034\3031\324\006\242\3323\374\345\250\235%\t$U\310\243\223\023\201+Z0\246<\223\234\344\343\254\320\207\f\260\233\361\342\032\341Q\247l\237\345\216\242\373\366o-\035\315]\327\243m\f\006\225\2608\016\256\361\250\322xv\227\264b\177n\234\354\242\215\225E\340\017n\354\346\002f"
+	.ascii	"\326\341&\311&\260n\305\tp\323\244\032\341e\231\231UpX\320\332"
+	.ascii	"\366W{\221\306\304e\243\006\223\367\323\324P\352\b\363\007YW"
+	.ascii	"U\361p\354D\3352\204\230\314\013\347c`\231\022\215MJ\013\221"
+	.ascii	"E]A\323\b\366f2\315\3331\013\250U!\203\036\343.u;H\r\202\314"
+	.ascii	",\252\024K\217Mx\324~\356-\360o\315\037\323\361\204$BI\025\001"
+	.ascii	"\260\366i\237\\\271\341/@\211\324\354\360\260\350\201\222G\032"
+	.ascii	"8\362\236?6\001\276\201\031\233\257\262L\203\240\316b\365<\303"
+	.ascii	"\330\366~\265m\237\310:\201\372\020uI%uns*\262c\342\324\236P"
+	.ascii	"\231<\n\327\232\245\275\244l?\244a\234\227\373Q\035\332\021\303"
+	.ascii	"\313\225\251 \013\361\3738\275\343\021\365\267\021\"!Pb\325\226"
+	.ascii	"7AH\273=9j\256ZKu\214\234F$\350\r\200\256\001\245\273\255\324"
+	.ascii	"\013\202\246[\003\210ZsB\3370\3326\324%\033\353\217\301\200S"
+	.ascii	"\243\026.\2309 \354\335\003\005$\210\316\316\317\327?l\265r\357"
+	.ascii	"u\245H2_FY\220\n1t\207n,6\224f\324xi\276D\254\t`{V{x-\342Y\231"
+	.ascii	"\360\343\373\224\346\346\276Z?L"
+	.string	"\361o<[\222\035R\256\207\261\361\360\221\314\221\243\036I\212C\007sdd\340\003\205c\215\004\321\352je\262\354\216\001\033\373\032\326\221}y\215\003\371\245\336\334|\244\254\216\260y\340X\0029R\331\342\276\361j\007N\356\221\364\023H\b\203\350\327\222B\327\\\217~\334\"b\203\226eK\240|-\313\275p\214\336\330\344'-\336\3063{\"k\310/\2007)\277\333K\252\316\260\245k\326\351\f\254\327l\262\347\232B\227i\346\374\251\213\2727\273^\272\030\034\304\242N\256\004\n\277\273Qr\365\030\325\273\002\260#\021,\251\266B\317\212\327X\353\030\027\326_r\3275\022CF\177\352]\234\255\212\250$\341\206\026\263\005='\260\216\332\347\225\277\315\257\204`}\ttR6\r\033\375uJ\236\206\376\334\202\255\354\201*^\216\322\350?\030\361\275\243\032\212U\366*\177\370\31495R@c[PD\304\377\250\217q"
+	.string	"\303|\340/\2733r\237\272\355\364\n\235A\022oO=\325~\025\371sU0=\2034D\363\311\200-\017\310k\346\204\270\224:\212t\"\341v\336Hm\310\374\\\034\360\017\034\356\"\220\335\037\223\252\260\302\256\026t\303\357\240v\323\350\b\362\222\254\330\311\351\267\007\300\023\333F\204\0311Y\276\310\002rd\214V\374N\302B\310\033\350\177<T\004\ry\226G \235m\212\316\356\fh|\277\372\257\333\020\r\241z\2358\237\022[\305\253H\315`\254q\241F\"I\226\036\305\377"
+	.string	"\332(\327\273\020\224\3465\233&\334\206q\224dU\200"
+	.string	"\210F\226$\"l\223e\0040\026\204\311\223\310\307Q[)R\017\242Z\326\033\234n\017.\007\242\375Q\232\222\237\275\357#3\350\002\224s\241\220\262\346,\335\247i\205!\204\234\037[\273\363T\365\372\277\201\300c\006\270\315\214\374\340\007R{Y\200mv\033\005\371g\215=\"a\315\306\3537\024Fo\226\376\2222\243\271\221\020\247XK\262\267\202\037 \363Vr\317\325J\253vl\266\025\270\347\366\333\274E\017\2068\206ZI\330O"
+	.ascii	"\255\241\2250\320\322$8\271\207\365\372B`\264\232\322\254\021"
+	.ascii	"\025\005Tp N\365?\224\341\213\312b\312@X\222uO\306'\214\225\323"
+	.ascii	"\365\231,\031\272\227\320\201X\346DU\374\n\"t^:wF\003\313*"
+	.string	"\nuKA\206\305+\227\265\220\032\307\037>3\204\350\232Vnnb\324\262\345\253\037\211\316\262\252\331\022\325\360)\356P\177\271D\023]\033\301\311kKxF\201\316\216\037 Q\363\361\002s\273"
+	.string	"\350\306\302F\326l\271y?,\f\364\325[\221\267U\244\346\027>B\2009\324\206\002B\201\016<\234\200Z\232X?Q\270M\347\356f9\222\312M\233\r\"\307\2461\260p\244eA\234F\223u\037Ff\236\021Jgi\314\223\367\237H\373\017\367\302\370-\013>\324+\232\020\n\227\262\322*\003Q\200.lG4\320\222\026@\022=\212L/c\251E\201\322r%\306>-\034H\275\201\027\006AH%\211N\325\221;\301X\201,T\354gEzp\2158\373\311\007\2377\020\201\023\322]\212\020\371D%G>!%v\023\307\221\341V\200\377/\004q7N.\256\376\006\"\334W\"\306\032"
+	.string	"\265\033\001\375\245?\361;\035\377\025\240\314\253w\374Q\003\352\225\333o,/I\020};3@\304$\220\226\025\006\364Hm\346\247\027FV\375j\2630\201\025m\013@h\320\241\332\233\303p\035\366Q\321?\2612J\006\207\323\"\275Pr\352\231\254\213\034\215W9\222\301Xdy\210\362.c\007\036=\3631$}\250\332\374FD\257\033tDMO\200\245\225\315\265\217(\245\327\33173[\307y\031\177<(\002D\247+k\351w\214A7E\220`\177d4p\222\324\331\304\037\201j0\002\240\272\261\017"
+	.string	"4\312\001\311\2204\030\004M\305"
+	.string	".\306\002\013W \345\354\235kd\005\314\270\326\340\202\252\024\273\220\351\254\245\231\247B\037\314\342\263\255\1773\030\023\262D\346\211\211\316\375\330\255\013u\003\331\204>\303a\232\265^\324\b\277\220s\366\\\334\314\030\240eF\203\336\210\007\222\b*\027\347\236\273\346\370@s\304\371Z\371;\f\303U\222/{\312\364\313L\230W;\301\337\036\205\2772v\211\007W\355\252\224\362`\275\002\306\007\302A\007d\265r;\301\222\333\"\021\357s\032;-\330\220G\363\t\b\345\204Z\243\226S\230C\366D\331s\316\n\220*\333}\221\363?\221\033M\365\225\2016\223\270)J\222\007\030?\374.r\030\202\001|66K\321\003\376H\034\264\\7\350\225\026\346\303P\237\360\241\332\t\216a\204\262qA\345\034\023+\313^c\257\\\245\201\234~\361.-\\3V\020pX\367^\017<\b\216\n"
+	.ascii	"\2331\235\300\026I\215~\016\003\347\212O\353\344\233\301\233"
+	.ascii	"O_\376\030DCy7\247,\205\272+\"\251\336\205\271$\200\246\030."
+	.ascii	"\333\217\311\032\352i\320\243VT\310\016\2359H\210\253l\264\352"
+	.ascii	"p`\270v\274\007WF\b\3012V#\247Kt\024,\027\244\350K\207\263+*"
+	.ascii	"\251\0238\3759\343B[\235Pn\371w8!p\n\271\233\205\200\263\305"
+	.ascii	"\211\3378\377\227\221u\255\270\310N\006\337\250\324\306H=<\020"
+	.ascii	"\272'\244\356\025D\024FM\204\\\002\024H~\341\213\272\212[\306"
+	.ascii	"\204t \310"
+	.string	"[E\377\020=\322\264f\350\276\261\241u\310=\326.1K\235\274\243a1\035yRY\343OK\036\3414.;\210\241S\013s\b\274(\234l\242\367~\003\310\233(\212\333\001\2262|\262\254\261\210F\031{\210\224=\215^\320+\272\333E\272d\307\037\346n\204Q\037\331\bA\274Z\364\035G\035\245\2132g\3764\320}-2;\030\361\020\220\035d-\017\354\324\020;\\ ^\fK\324\356 \021u\201P\353Z\\\343\3747\376#\222\333wC\323Rj\362\237\355`\203\261\274K\301\376DL\005\250\314gO]h\003<\013\337\377\354\235\217ab\274\365\332r\270\177\336\367\314\335\373\371\327\3729\276\034~}@\376\205l\252I\276\270\370\363\260\336\270\272_S\337\002\207\257\t\235\022\215g\034\347\2012O\233H\337N\224\221\200\273:\314\323R\302\035\344\376,\361\024-:I\304R(\377\244\312\310_k\330m!"
+	.ascii	"\373r\267l\017\374\036\215|\237FG\324\177\fK\335;\336\363\366"
+	.ascii	"sM\017\335_\335\267\203fZ\257\255\305\204\210\263\343w\236\336"
+	.ascii	"r4\376\221d{\345\374}@\235\343\320:\200\3164\300\3416\360\363"
+	.ascii	"S\231f\341\252\360\\\320o\246\335{\370\261\352\344\327\236t\026"
+	.ascii	"i{\277\372H\327\336\362\255\255\026\247nl)\002w\003\307\317\310"
+	.ascii	"\250E\013\337\260\353\261\034\340\362\320~\216x\313\370\337\301"
+	.ascii	"\342\217\362A\006\354>\370&\020;\027\370\356\240\230eq\271\031"
+	.ascii	"\320"
+	.string	"\211\231?Lz\022|n\212/\231\006\302\377\fq'\323\276\332m\026\247\337\032\347_\264YN\207Br\362d\256\235\276\002\371p\002\331\217\311\3554\203\304k\032\376\227\264\303\314_\323\370Of\374f\322;M{P\356B\333\261\0235I\217t\321P\343\3363\376\024\362\025\333\033+g\256Iv\352>Y9\326\232\334\254\263\034\222h\251!\353\270\276\207\253\372\327\264\330e\325\346>\246\312\361\233VS\277X\256S}^\f\216z\3415(\376\257\301\273\223'*\256\016\232p\250\300QG\016{Tm\361\3549\003;!u\005\357\343 \236:\315\312<\023\020\3659\343cA\275\374\344\244\032\211\263\322\337#\341{\232m\271\241\346;(r\1773O\304\345\201\310\337E\235\314\352\313\021?\001^{\336\251-j4\214o\013:\312\276H\264\374\327\354\376\334\035\227\020\345\321z~\016\354\f\253\236ur\366\340z(\220\300"
+	.string	"\227{\n\310b\024\203\350\311q3\033\274\256\341\267\305\353t\267O\325\007\\\275\313\314\365TQ\f\347\354\272\333\301s\034*\334\002\354cHTx\016+c\202\343\356\324\003F\351|\212\2307\313y\203\252w\215\273\252\353\037\333\001\212\370\315?H\331\337s9\324\264S\372\242\376\244\354\301\212\353\317\374\035\360\357\320\273\231\242~\347d\361\302\033x\"\210\005\357\353\2732#\035\242\373\035\345|\353\256b9\251\331\347\"y\327c\374\224\330_\301\322/\345\273\325N7\323\264\030\"\347\333ur^7\375J\023\316\263\3759\375\213K\360\335\337\275\306\212\203![\3353\257\270|w\330"
+	.string	"n\270N]\212g\037\373\002K\352\316\204\273\352sZ\335\253\035|\264\322q\007F_\336Y\256S\002?b\367\037\250%Pg\031i\252\036\317\221\335b\362I\323\257\333\325\273\275\006\367\003\264\301\316\334i\017\354\357\370\355Jy\2752\327\276q\345%\b\272\\\215\377\236\216\272\245\321\236\005\374O,\017\001\274D\334GY0\221\207\037E\364\361\376+\200\366\320\322\353,\317*l\344`\317x_\324\221?@\277"
+	.ascii	"\332\355\251\226-+\342#\341\337\247\264.\021\371'9\270\354\336"
+	.ascii	"\360z\343|\212\356\334\365\t\241\367\344M\337\217-\374)\360]"
+	.ascii	"\036\276\215\356k\f\214{f\277\224\371=\265\333\366\367v\234\361"
+	.ascii	"\353r\017B\372\\Z\255\335;\330\272\030\3717\370B\352\276\247"
+	.ascii	"\252\275P\177\302\200O\004\271}\316\304\341\236\255\377\\\347"
+	.ascii	"\003\362\254z#\027\341\335\377\375\034J\373\250\316\373aX\307"
+	.ascii	"\253b0\210\271\253\027t\037\026\374\333)G\354\335P\241\211Z\035"
+	.ascii	"SI\372\017\2754\322y\234\216'\315\242\242\351@?\367v9\223.\226"
+	.ascii	"\370\216t`\300\037\276't\001\017\024\376U\342\254\350\241\017"
+	.ascii	"\037\366\375k \337\267~\242\250kj>\023\264\245\216\006\320\266"
+	.ascii	"\2130\036\3050.\314]\020\3251_"
+	.string	"\231\322\344\226r\031R\271\273\300\277\362\346\032\362\226r\257\207%]\265\271.\310\363"
+	.ascii	"\315\267w\033\372\314\264\362fP7\215\365O\344C\241\026\375\367"
+	.ascii	"\201\316\"G\3007\224W\025^\342i\037\r\352\277\255vk*\177\003"
+	.ascii	"x=N\246\022\3231\033P^_\275V\1775-'0\271A\023N\200\311\005\030"
+	.ascii	"\007`\371\231\304;\241<M\271\017l\223\375\215\315\365{\307\335"
+	.ascii	"\377\330\215\375%\355i\301\274\222`R\366\3339e\370\213X\300\314"
+	.ascii	"\022\351+\034\333\322;y\266\037\261<\260\274\353\306\025\234"
+	.ascii	"M\377\242^\026\305)\345\210\377"
+	.text
+	.section	.gnu.lto_.symtab.bf6dcfc108f8cc68,"e",@progbits
+	.string	"pidData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\004"
+	.string	""
+	.string	"pgResetFn_pidProfiles"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\004"
+	.string	""
+	.string	"targetPidLooptime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\004"
+	.string	""
+	.string	"throttleLpf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\003"
+	.string	""
+	.string	"thrustLinearizationReciprocal"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\005"
+	.string	""
+	.string	"thrustLinearizationB"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\005"
+	.string	""
+	.string	"pidProfiles_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\005"
+	.string	""
+	.string	"resetPidProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\003"
+	.string	""
+	.string	"pidSetItermAccelerator"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\005"
+	.string	""
+	.string	"pidOsdAntiGravityActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\005"
+	.string	""
+	.string	"pidStabilisationState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\005"
+	.string	""
+	.string	"pidGetSpikeLimitInverse"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\005"
+	.string	""
+	.string	"pidGetFfBoostFactor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\005"
+	.string	""
+	.string	"pidGetFfSmoothFactor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\005"
+	.string	""
+	.string	"pidInitFilters"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\004"
+	.string	""
+	.string	"pidInitSetpointDerivativeLpf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\004"
+	.string	""
+	.string	"pidUpdateSetpointDerivativeLpf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\005"
+	.string	""
+	.string	"pidResetIterm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\005"
+	.string	""
+	.string	"pidUpdateAntiGravityThrottleFilter"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\005"
+	.string	""
+	.string	"pidInitConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\005"
+	.string	""
+	.string	"throttleBoost"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\005"
+	.string	""
+	.string	"thrustLinearization"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\005"
+	.string	""
+	.string	"pidInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\005"
+	.string	""
+	.string	"pidAcroTrainerInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\005"
+	.string	""
+	.string	"pidCompensateThrustLinearization"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\005"
+	.string	""
+	.string	"pidApplyThrustLinearization"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\005"
+	.string	""
+	.string	"pidCopyProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\005"
+	.string	""
+	.string	"acroTrainerSign"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\005"
+	.string	""
+	.string	"applyRcSmoothingDerivativeFilter"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\005"
+	.string	""
+	.string	"pidUpdateAirmodeLpf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\005"
+	.string	""
+	.string	"pidGetAirmodeThrottleOffset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\005"
+	.string	""
+	.string	"pidController"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\005"
+	.string	""
+	.string	"crashRecoveryModeActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\005"
+	.string	""
+	.string	"pidSetAcroTrainerState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\005"
+	.string	""
+	.string	"pidSetAntiGravityState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\005"
+	.string	""
+	.string	"pidAntiGravityEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\005"
+	.string	""
+	.string	"dynLpfDTermUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\005"
+	.string	""
+	.string	"dynDtermLpfCutoffFreq"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\005"
+	.string	""
+	.string	"pidSetItermReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\005"
+	.string	""
+	.string	"pidGetPreviousSetpoint"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\005"
+	.string	""
+	.string	"pidGetDT"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\005"
+	.string	""
+	.string	"pidGetPidFrequency"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\005"
+	.string	""
+	.string	"rcAliasToAngleIndexMap"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\005"
+	.string	""
+	.string	"pidProfiles_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\006"
+	.string	""
+	.string	"pidProfiles_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\006"
+	.string	""
+	.string	"pgResetTemplate_pidConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\006"
+	.string	""
+	.string	"pidConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\006"
+	.string	""
+	.string	"pidConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\006"
+	.string	""
+	.string	"pidConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\006"
+	.string	""
+	.string	"pidNames"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\006"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \004"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\004"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\004"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\004"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\004"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\004"
+	.string	""
+	.string	"biquadFilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\004"
+	.string	""
+	.string	"nullFilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\004"
+	.string	""
+	.string	"pt1FilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\004"
+	.string	""
+	.string	"biquadFilterApplyDF1"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\004"
+	.string	""
+	.string	"currentControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\005"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\004"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\006"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\006"
+	.string	""
+	.string	"getMotorMixRange"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\006"
+	.string	""
+	.string	"getRcDeflectionAbs"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\006"
+	.string	""
+	.string	"getRcDeflection"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\006"
+	.string	""
+	.string	"scaleRangef"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\006"
+	.string	""
+	.string	"isAirmodeActivated"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\006"
+	.string	""
+	.string	"fapplyDeadband"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\006"
+	.string	""
+	.string	"getSetpointRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\006"
+	.string	""
+	.string	"disarm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\006"
+	.string	""
+	.string	"setArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\006"
+	.string	""
+	.string	"gyroOverflowDetected"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\006"
+	.string	""
+	.string	"filterGetNotchQ"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\006"
+	.string	""
+	.string	"biquadFilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\006"
+	.string	""
+	.string	"pt1FilterGain"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\006"
+	.string	""
+	.string	"pt1FilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\006"
+	.string	""
+	.string	"biquadFilterInitLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\006"
+	.string	""
+	.string	"pt1FilterUpdateCutoff"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\006"
+	.string	""
+	.string	"biquadFilterUpdateLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\006"
+	.string	""
+	.string	"sqrtf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\006"
+	.string	""
+	.string	"dynThrottle"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\006"
+	.string	""
+	.string	"interpolatedSpInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\006"
+	.string	""
+	.string	"applyFfLimit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\006"
+	.string	""
+	.string	"shouldApplyFfLimits"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\006"
+	.string	""
+	.string	"interpolatedSpApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\006"
+	.string	""
+	.string	"getRcFrameNumber"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\006"
+	.string	""
+	.string	"isLaunchControlActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\006"
+	.string	""
+	.string	"gyroYawSpinDetected"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\006"
+	.string	""
+	.string	"getThrottlePIDAttenuation"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\006"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.bf6dcfc108f8cc68,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,714 @@
+	.file	"position.c"
+	.section	.gnu.lto_.profile.bb61863fa261a606,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.bb61863fa261a606,"e",@progbits
+	.string	"(\265/\375`\025"
+	.string	"m\005"
+	.string	"$\007\t\001"
+	.string	"\021"
+	.string	"\201\277\312\340\b\n\002"
+	.string	"\001\002\002\002\003\001\352\263\360\321\b\003\240\342\234\212\n\004\261\312\232\202\r>\002\004\005\002\005\002"
+	.string	"\002\006\002\007\002\007\002\001\002\006\b\002\b"
+	.string	"\005\002\t\005\002\007\002\n\n\005\n\013\f\r\016\017\022\350\300\306\254\005\002\023\354\206\342\366\006\002\024\347\273\234\355\f\002\025\355\314\246\334\007\026\332\322\311\233\n\027\240\342\234\212\n"
+	.string	"\031"
+	.string	"P\204\311#\f\301\204\201\273\235\306HO\004\334\201\306R\"$\346\260(\033v\206\276\370\230I\260U"
+	.string	"C\225\001\371r\024\257"
+	.ascii	"\224P\303\314[\203|\301x\271\334\0130\004"
+	.text
+	.section	.gnu.lto_.ipa_sra.bb61863fa261a606,"e",@progbits
+	.string	"(\265/\375 EU\001"
+	.string	"\3009"
+	.string	"\005"
+	.string	"\002"
+	.string	"\001\003\002\001\001"
+	.string	""
+	.string	"\004\022"
+	.string	"\003\023"
+	.string	"\003\024"
+	.string	"\003"
+	.string	"\007"
+	.string	"-\031"
+	.string	"\001\226\0331{\270,\f0\331"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.bb61863fa261a606,"e",@progbits
+	.string	"(\265/\375`."
+	.string	"U\004"
+	.string	"\002\007\027\"\200K\322\001\372b\306\201\330j\bA2N\227JS\bK\220\214-\212g4\t\301\204\253Cmo\271S\037\f?\277\036\273\013\037\250\037\245\207\004s\261\324\204o\rn\"\025\312\232\017\245\372\007\366\243\304\237p\367\202s>l[\3003,\323Va\277\200U\2659\bi\233x\347B\004\021"
+	.string	""
+	.ascii	")\034%\tf\034p\214J\304\204\351I\300\213\364\303.\256\"C \270"
+	.ascii	"@\002\007\250K\n\027{\223CW\346\344\322\264\006\334"
+	.text
+	.section	.gnu.lto_.jmpfuncs.bb61863fa261a606,"e",@progbits
+	.string	"(\265/\375 \324\225\003"
+	.string	"R\305\021\034\240'\351\377\243\330w\277\212Wu%\026<\252\252*\226\357?\024\366;M\310nR\246?\341\007/\250\372\224X(-\272\273;P3\3102\346,\016\b\256(\345\177'\204\206\322\215u\314:\370uj\200\032\";9\021\021"
+	.string	"@\004\334{3Hx\307p\266"
+	.ascii	"t^Q8\357e\023T\261\201v@\230T\321R\202X\024\303\233&\234\331"
+	.ascii	"\034\f\260"
+	.text
+	.section	.gnu.lto_.pureconst.bb61863fa261a606,"e",@progbits
+	.string	"(\265/\375 \024\241"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	"\230\004\004\230\004\022\204\004\023\204\004\024\204\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.bb61863fa261a606,"e",@progbits
+	.string	"(\265/\375 \250\265\002"
+	.string	"\342D\f\023\300%\303\030\377\377\377\377\356\222\275w\263C\270\033\2212\005_\203N\363\260:\323\2632SSdJ&\326\001\267\312\264\254\004\323\300jL\307\204\342 \016"
+	.ascii	"_\221\240\304\341BtE\207\022\214\0136\024\005\253\002\2712\326"
+	.ascii	"\242\312\326$\340\2365@h\033h\003"
+	.text
+	.section	.gnu.lto_.lto.bb61863fa261a606,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_positionConfig_Registry.42.bb61863fa261a606,"e",@progbits
+	.string	"(\265/\375 \240\255\004"
+	.string	"t\bi"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001\212\001\206\200\200\374\342\303\266\377\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\307\007us\336\006uq"
+	.string	"\005\001\006'\001\001\005\001\006\035'\001\270 ?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/flight/position.c"
+	.string	"\004"
+	.string	")\242\302\254\b\242.\031"
+	.ascii	"\034"
+	.text
+	.section	.gnu.lto_pgResetTemplate_positionConfig.44.bb61863fa261a606,"e",@progbits
+	.string	"(\265/\375 \034\341"
+	.string	""
+	.string	"\017"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"?\202\210\200\b\177}\273\001"
+	.text
+	.section	.gnu.lto_calculateEstimatedVario.47.bb61863fa261a606,"e",@progbits
+	.string	"(\265/\375`\320\003=\033"
+	.string	"\346s\261I\240\326Q:\304\324\3605\2024\354=\370)\035W\346r\177\274\262&d\016\340\265\305$\005`\340\273\304\342[k4x\037R;\232\355\005\3138f\257\005\257\303+\360\0138\0055[D\241\263~TV?\371\277mB\b\221;\245\232"
+	.string	"\215"
+	.string	"\240"
+	.ascii	"\300\217S\234\241\375\251'\253\027\317q)\373e\016\307\341e\242"
+	.ascii	"\343\305\301~]\2346\221\177\343Q~\001u8F!\232\032@\351\350n\004"
+	.ascii	"\215RB\221Uk\035p\321\t\350\332\350\020\302\252\221\022\210\035"
+	.ascii	"\265B\025\260\001z\321s\332\247\361\032D\377\351\334\2525\005"
+	.ascii	"\220\035\265\326\002&@/\342\204\266}\031\237A\344\242\371c1b"
+	.ascii	"T\362\035\335\210Rk\235\301>3^\234\217\031/\356\212\027}\026"
+	.ascii	"\371\217\372\316\223U/\211\024\322\356\223\\Pk\365\364!\221\270"
+	.ascii	"\367\266\003\330\276`\207\b\002\341\276t\352\315\240\347\356"
+	.ascii	"\206T\312\254ol\347\276l\352\235\352U:\237\311C\266y\237m\274"
+	.ascii	"\370%wS0\222x3h\377zsU\330\017\353.\331\236\326\3119\324}cs\340"
+	.ascii	"-\273\215\277\346\277?\346\232\246!\247g\350\264\f\235\216\241"
+	.ascii	"\3230t\372\205\234\206\221\323.\344t\013\235f\241\323+t\372E"
+	.ascii	"\247]t\272EN\323\3264I\247G:-\322\351\220N/9=\311\351\357P%E"
+	.ascii	"\234\034I\212\371\250UDpJ\275\022{\2648\324\037\313\2621\254"
+	.ascii	"\036\210\022W\325V\020\f.y\355\212k[\373\332\227NB>\304U\032"
+	.ascii	"Le\252\361"
+	.string	"\242k[It[{*e\026\271t\177T\305\022\036d\002\255\325\350\200\377\343@(\370L\027]\201\346\323\306\213\344\276\236\252`\320h\231\256\353\306\231\265k\031\346}6\373\250\323).~R\262>\354\316\271%\330\316\254g\t\345%\344\266\032e\013\333K=\214\301\204\303\305\n\340\223\330\366\020\221\246\244\230\030W\266\307*\211\210\033\356\270/\203\324\254\270#\2222\213W\365'$j\255\026`T+og7\366\341\031\362\311\321n3 \334\355\206\353\221\375\324 \004\335r\025~j\033\310\332\315\346\340\202\230\373a\200\023\242Y \335\303\003\204\263\345lC\270\240Y\316'\203\355\007\303\f\310F\273\315z\204\206f<6\306\005\325\204f9\034Nh\366\372\361\036~\227t\026\207\267=\273\254\316Fy\250\265e]\036\f\346l\313~J\274n\274\311Y\027 \217+\232\275\331c\035U\241\2312k?\2100\336G\263"
+	.string	"\2005\256\214vg\2315r\035\276&1\273\2622K\016)O\300,\313\306l\f\353e]\365Z'\314\326`\225M\275\326\276\254\214J\351d\023D\2501$\343\220b\n\252\221@Dd\244\205I\007`\242Q\316\310\016\021\020\262\2422\311\260\277\001_\030@\206\222p4\326>\313\356\n\371\253\375M\323V\350T\272\200\373\\\234\260c\326)\204\206\013\346\207\0177h'\342\214#6\223\030\311I\016.\205\320\013\no\231\263\270\365\270\273\257\347+<\204\302\203@;ux\266\304\224X\323=\276q\214\034\321\266\300\262\221\224^\340\366\305`+c\031\334K`\033\306\256)r\016\256\036\0211&\022\253_x\230`\001\277\f\027"
+	.ascii	"\376\336\032Q\372\262_\032"
+	.text
+	.section	.gnu.lto_calculateEstimatedAltitude.49.bb61863fa261a606,"e",@progbits
+	.string	"(\265/\375`\362\017\035L"
+	.string	":}\034\034@0\242N\007\033\254\324\031\002\021T\305\301O\376\001H\024I\177\215:\225\340\350iAr\237\355\311\t\022\037x\357\003\324;B(\202EdP\204\317M\267\303\214"
+	.string	""
+	.string	""
+	.string	"fh\210\bm\262\273%\231d\266\001\220\001\255\001I\255]k\017\243\265\322}\213\3779\240{q0N\350\263V\026\316x\321\326^0\320\276\3048\266\322\030$\234\022\343\375R\343\251V\024\253Q\013\247\304q\334\302\273x \354\2026\3368\314+S\257\211q\034\217x\275-\332\\\364\374T\263\306P\024\300\245\321\343\340'\005g\250\227\245\302k \001\354\326\033O4k\374\303"
+	.string	"\234\035=Bql\r\340\255n\360\372\326\332\365|\017v\276\034\032\031\307K\324\204\211c\353"
+	.string	"-\340\365\366\351J\256\267FGr\275\325\260\326{\334:\027\373\037\236\fH(\216\343\256\227s\330\267\264"
+	.ascii	"da]YUQ=\247\244\234QPONMLKJIHGFEM&\321R\231D\276G\2675\376\206"
+	.ascii	"\265\243\371\326\325\265\256i6\200\331\263\346\302\215E\350W"
+	.ascii	"\204\203\333"
+	.string	"\n\214W\201\371\262\251\236^\246\214\007t\020z\363\303\265>\343RQ\226\343wk\202[\312\013\337v\266^\354\242\366\240\214\\ql\204\370\341Z\236Q\t\0165\217\337\255\351\355\247=-\333\351\350eL|\342\305\233\230\262\370R\235\224\255\204\027e'\341A\331HGN\266\321\023\272]D\203\316P\017\273\004\310\023o\316!\331\314\271\270Mt\364Z\002\004\316\227o\256|;\262\223wkF6\362p\r\316m\277TK\200\264\3711\311&\304]%\233l|\306q\354\263o\037l\321\335zZ\233\033\215\\\211b\0041\331\324\214J?\244H\225l:\366\033\247\230 \3012\331\240\306\347\032C\331g\247\272[\273\356}\364\212\343Xo)\033\020\327\\\256\365\346\243\265\276\2415\021\216\356\227\370a\307\r\255e\345 \277\252\231\324<\362|t\277\341\272T6\362l\364\253o\375T\031\007\217<\037\037\374\221J(\317\306"
+	.string	"~\365\323\366\331\376\212\276$\257sk\r\206a\273\364\3013\005\2429>m\2555l\330.\325\314@2[\325\302\330\375\352\325\377\313\230\266\326\035>l\227\3767e1\206\320G\323c\300\274\241\265_u\017\263h\027h\374\252\276\341\356O\361w'i\033]\204\2535\t\023\333\245\373W\344%b\023\325\036M#\3703\355\2269\3307WT\222\r\374\257\376\311\371\f7\3017\371\240\376\265Q\333\212\332\037\301'\370=':\005\352c\234L\016\355P\264\331\211\355Ro\265\237p\275\365W\323c1n\257-mg\265\266B\367W\265\366\317f\263Y\375L\264\276"
+	.ascii	"\306\334z\302\227\227\204\007\311\255\031$\267^\340\205\256\023"
+	.ascii	"8\237;\002\267\372\271\336\322r.\256\001\270\240\353,\377\342"
+	.ascii	"\032\313\007]_5\267\266jn]\325\334\232\252\271\365s\271\365\024"
+	.ascii	"sk\251\344\326\316\346\326Q\311\255\241\222[?5\267vZn\335\304"
+	.ascii	"\334\232\211\271\365\022sk%\346\326I\314\255\221\230[\037%\267"
+	.ascii	"6\332[\027-\267n.\267f\356\255\211\366\326\313\344\326J\242\255"
+	.ascii	"\223D[#\227[\277\312\255\217\311\255\335\275u\273\267\376\275"
+	.ascii	"\365Fn\355 L$!\324\007\nM\034\377\310.\306\206\355\230:\267\272"
+	.ascii	"\373\271sq\027t\377\342>\350^\350\357>nw\007\255\321/\240\343"
+	.ascii	"K*\342\372\255/\372\020N\352\310m"
+	.string	"\315\307\372\013;\232\377~e\230\177\365`\357\213[f\276sH\222\270=\244\253\2169\013 \002\202\352\002\035\021=\205;P\242\027\200\330&\317\033<F_\325X9%\177\342 \252m\305\274k\337\231\242\257\276q\355\330\215v\274+\314\002\b+;\006S\017\t\261W\257}\321\r\325\220\001S\251\256\267\255\037B\274\266\264\346\362w\023\307\272\342\215*,'\347z\273\374\fB\3440\277\252]j\233\253+\241Yy^\372\033w\251m\344\031\351W\347\372\251\033g\315\037O\002\366\220\347\345\204\177\221\307\207\364?\256\365\323#\365*\317\257\017r\345\237!y^z\275\003\"H\3556\334\254\237\276\001<\t-$\317K\t\177\244\026\31232\200c\375T\2163x\017\335\235\256\362\031\004\202\373\350((\177\017^\211\276\252\225\200RyV~Y\210\263F\236\223zv\267A:\022\262\331CjS\255\365\354t\250\270Y\215"
+	.ascii	"~\302{\030\007K\234\343\023\005\004]&\377\353w \371\020\362\265"
+	.ascii	"\030\027\324L\2658N\263J\276G\325\274\217\374\017\024M<\376\373"
+	.ascii	"\3766\207F>\244\204\243\270\307/{\342|\340(\357\236\343\007\020"
+	.ascii	"\302$n\217/\r\217\347\261\001\327\301v\260\235\353\255\327\267"
+	.ascii	"p\016a\2518b\r)\255a+n\007\306\0225\027\307\261\002:^\007\306"
+	.ascii	"\323\016\305[\r\347\301{\360\236\353\255\204o\321\fa\371\"\b"
+	.ascii	"\366\371I:\335\005\357\263#\005mw\272\356/x\275\34568~\b\367"
+	.ascii	"}Q\240\340z\033a0\304<\254hS\034[\270+\302\302\310:\234\225\205"
+	.ascii	"\2010#k\261<3\233Q\346\301\214\254\305{\366\342k\254\f\305\004"
+	.ascii	"\345\331\213/32\2600\032(\\$\315>\204\301\020\363p\026#\254\254"
+	.ascii	"l\206\n\"\255\202@\2141\26131\2631\262\2563\027-\304^\260\350"
+	.ascii	"\212!\206\002F\227\2122\263.\002N=F\026V\326u66V\326\245\264"
+	.ascii	"\246\2711\366J{\250q\313\212\300\316\323\222\305\352\025 \266"
+	.ascii	"i\025\241\002\250\372*\373\212\025m\306\255\312*\204E5`\337\331"
+	.ascii	"Q]9q\347;\021\031\364\207\250\266\025\255\236\257\265\026\260"
+	.ascii	"\353lt\331\211\343\230\201\336Q\266\024X\336\001O\247\356\324"
+	.ascii	"?\337\325#\037\222\372\251?\002F\335\314Z/\365M\201\242wP3\323"
+	.ascii	"\300.U_\325L\207\373\\\347\263\370C\204\263\351\340\276\036\024"
+	.ascii	"\234\337\372\355\301\023\244\212\222\213z\347\024\016\214\t\035"
+	.ascii	"<,\2773lO\250_\322)\020\247P:\345P\357~\224$\201z\004t|U\366"
+	.ascii	"\210HM\021\251\323\213v\024\2378\263\342\322\344\274\035\307"
+	.ascii	"\274\301FH\004t\022\345\303\237~\311\367\207\b\201\220\0254\250"
+	.ascii	"\375\364\276\307\255\355\351\273\020\237\270~jH\241\277;NN\257"
+	.ascii	"\035\317&b\343\007l\367\200\013v\202\007{\255\341 \360\220\355"
+	.ascii	"R\247wJ\261\206:\036\255\351B\220\315\306\255\215\251\351\331"
+	.ascii	"j\024q\251\037\246oz"
+	.string	"#a\324\315\322#=\323\273z\242qJ\237\364KwP={\274\225\276iNt\n\330'\375\321P4Q\353\217\036\351=zw\341\217\336\2538\031\024M\\\212\032\202E\351\210k\364[\312\237\333\356\001\037y\343XM\201\336\323\315\003\206C\002+Q\342z\201B\250\2014$\221#C3\"\"\222$)\244\003q\005\204 F!4\017\022 \304-I\204\316\025q\322\376o(\034\263\232\224p\2472;)WJb=\206l\234An\210\201\336\304\312D\365x\002\221}\f\273\377[9$\274\226\327J\354\tf\372\003Sa\007\200k4T\355A\022<\245\307\237\202\313\206-\220\343\020\f\\Y\347\007\344\304\335Z\365xl6]\320\221\177\253\007\241\244\327\342\311Y\241\363\355\226\300m\260\332\270\003Ap\241\370v\367\230\302\306\026\300\251@\365\240B\255\037-{\352\020\253.\304\311\360W\017k\036L\373p\257\253<"
+	.string	"X"
+	.string	"\327K8"
+	.ascii	"\364\241@\231\356"
+	.string	"\221b \020\016or\271A1\242\360G\035\023\357\\~\242|\317\005\311\231\325q\2115\320V\367\2411\367\327\274\264\025\276\231\037YQ'\213\247\250fH\034S\267RUs\306\2648xJt\231\023\363\315\353a\327\317\323\365\035\352y\354\231\235\274h\304\310\336\211\210\325Q\264\032\013\300\337?\tb\"\211N"
+	.string	"*p\370\372\245\211'RZ\254\024"
+	.ascii	"t\273$a\001\250yW\304\371u\301\306L\305~\230\310:@\216%\320~"
+	.ascii	"\302#8t\2207l\375\200\315B-\355M\344\326y}\220\321\240\373w\237"
+	.ascii	"2g\354\021q 7\320\016\367\177\022\023 \253\207\271\263\231\330"
+	.ascii	"\343\327\332\030zK\254\263AX\260E:\305\"\021xg\246\300\271A\205"
+	.ascii	"\255\364\037\256\316ko\004\353u\036\301'\277\005@\024\345oG\013"
+	.ascii	"A\3100&|\242Nl1C\321\252\261>\363\004+\344\0329!\323\210`\013"
+	.ascii	")\3719\253\222x\267>\323,F\336pDc\332\210\262\314\264\b@\027"
+	.ascii	"\355n@\220Z\243Y=\355&\t\032\324Y~\365Q\217\317\322\217\210\303"
+	.ascii	"\250\327\236tD\3044T\021\225RE\253\314\\\245\226)\220\006\237"
+	.ascii	"\007a\361\003\2716|\033\022\264=\336\313\\^\374\\\262\204\340"
+	.ascii	"\035\215#G\340\303)R\003\342\032\023\211\347(\002H\2133\311\005"
+	.ascii	"t\006\357w\360I\177\211S\n\2443\"\354#pH\022\276\231t\316W\361"
+	.ascii	"\331\247 \031\224\342\244\316!9\003\333\275wI\243\236\"\222F"
+	.ascii	"\256\020\203\206\267\320?\300\315}\037\3644?v\305y\3443T\026"
+	.ascii	"\335\025\320\331\226H\361yq\326\304\020/\220wj5\210\327\"\035"
+	.ascii	"6\224\250\001"
+	.text
+	.section	.gnu.lto_isAltitudeOffset.50.bb61863fa261a606,"e",@progbits
+	.string	"(\265/\375 \350}\006"
+	.string	"\"L-3Pm\222\016\244DX\250\344\253h\326\005\030\200\b2\302\323Z\376-l\351\377\273\035\346\332\236\306y6\213\343ff\212D\334\0337\027@\341\332\250\355\223-S[\250\313\253\256*\3630\356rh\250\036\030\334\245R\200p\026+\343\250\201\037f\301r\327{\226\233\262l\013a#\3504\211\257G?\260\233q\204\006\353\251t5"
+	.string	"\225\260\tXtp\364\031\007\233\350[\311\026\372ql\223\b\te\222\371\031\245\344\210\024\262\361o~\372"
+	.string	"a3\326\f\343SQ\311\004\bJf\346\332E\261\"v\333\321\n\207\306\211\007\304)\006$d\346\350\001U\364\326\277\3407\370)\002\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_getEstimatedAltitudeCm.51.bb61863fa261a606,"e",@progbits
+	.string	"(\265/\375 \366\275\006"
+	.string	"\002M/3`m\322\001(\033\004\242fj@\212\034\035%\326_*\266WNY!\232E\275\303#)\364\272\024<Z"
+	.string	""
+	.string	"\212@WoE\237#\"\207\221\354-eJ\001\256P,o\252&\314\273h\305\26005(\250eBp\320\n\205Q\n\201\337%\201\322\352=J\245l\237\035\314\t'!\354w<\263|\f?d\360\327\235\237\211\3560\003(8\030\262\263\r\246\307~\333\354\330FcJ \021\005\331\225\b\225l\210\373\370\330\326\330\222\257\361\r\215\255\226]`\221\007\024\341A\262\273:\371@t\327.\020\335\245\305\255\243\345\237\343-\3433ra\233#\300\301\356\032/l\342\316\333.\260m`\273\"\b"
+	.ascii	"2\003\316:#f\b\3055\3616\002g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_getEstimatedVario.52.bb61863fa261a606,"e",@progbits
+	.string	"(\265/\375 \366\305\006"
+	.string	"BM04`m\322\001@\203"
+	.string	"3P\033\273\376\323\301q\324\277\271?\335cX\312\264f\255\207NR\350u\351\020\\\001"
+	.string	"(&\316\347\226h\326\310\255Ymo\"eJ\001\316`4\360U\217\0037\256zpx\020\rN\363\026\"\\\206\3428L\201\341\206\201r\025\204\224\273\\{\025\245\032\200t\302\376\310\257\350{X\242\223\267\316\374N;K\005\310"
+	.string	"e\311\276>\251\034\366\247\335]\253\310v:5`#%\241d\327\242\264\262(\314\344\303\266\307\276\370 \017\3618\346\325q\321F\025\024$*\273\353\004N\320\316\362\003\355LG\217\317\350_\344\023\211tb\205>O\213\302\356:\255\020\306\255\267}`\033\301\266F\007"
+	.ascii	"2\001\0238#&\016\345\256!Y\210<\334\025S;\311"
+	.text
+	.section	.gnu.lto_.symbol_nodes.bb61863fa261a606,"e",@progbits
+	.string	"(\265/\375`G\001\305\t"
+	.string	"\322\316990\257\322\001"
+	.string	"\003F\301\005)\233\031\017d\310o)\004{r\300p!\252\215\027x\202\332<\337\314\214HL\027O<\361\216_\006\367\335\007\373\223h[\246\017\321J\366\226D\246\327\210Q\221\b\023r\271\236\250\255\026\023\231\313\005\350j\036\271\035MK$\266\376\310\325\233\376\305Ed\006\222\2534\325\231\221\221\245#WS\323\204\234ow\333|YL\261\342\n\025\267R<\3611\204v\367\357\241\330AO\244\371w\304@\331\006L\3014\177\027\350\312"
+	.string	"_\262W\f\003\306\361]\303\017\323i\226\230\201\304\013\334\210Y\\\302WDWA\370\346\366\001j~f0*x-\364\224\351\251\b.\202\216\362\371\211\307\242#\261\3438\216\034^q\233\207\371?4\0201\367\327\260\005\032\246G\227\374\374\333@Tvw\007p\212\373\317]\004# \300\0021\333v-\213\333\265\227kl\016\215\3400\326Cp"
+	.string	"\207\301\341\003\262\303\245\013D\230\206=\330@B\036\276\274\215\323n\357\313\274\210"
+	.ascii	"\033\0131H\242if\207y43a\036\254\033\2236x2^\354\031\246A\347"
+	.ascii	"<\241\r<\036"
+	.text
+	.section	.gnu.lto_.refs.bb61863fa261a606,"e",@progbits
+	.string	"(\265/\375 \277u\004"
+	.string	"\262\312\037(pM2\214\001\360\007\310\363\245\250\252\252\252\252\252\252\252.\267\376\222g\302\\hD\255Eh\023B\272Qk\215\020\262e\n\007\322%A\211\200\271\325\262\213Vv*e\177x\254wpl\bl\215\200g`\\@\267X\273\"\332\024\320\022k#\242\205\210\366\001\332\341\271a2\203\332\005\265\202\332\204g\021&{\2406"
+	.ascii	"\330\022\271\"\231\022yAn\234\235\263)xav1?i\311v\333\371D\005"
+	.ascii	"\004\0012\013\\\024\007L\227\031\005"
+	.text
+	.section	.gnu.lto_.decls.bb61863fa261a606,"e",@progbits
+	.string	"(\265/\375`\213\035\275\221"
+	.ascii	"J\363\2205P TBJ\007-\341pn`6\353\206a\021\3618|*F\275\214\334"
+	.ascii	"'-]\322U\034\276\231\253Y\207\24171\356\243\325\004\300\204\243"
+	.ascii	"5\324\367A\253\211\233\362\335\303\300\243Z\303\253W\002O|\335"
+	.ascii	"\324C\271\206^\364Z\rJ\336\301\333A\266\224)\313\002P\003m\003"
+	.ascii	"\\f\235f\251\216\347\233\271 ,;7-B(\033Y\253\306a\304N\300|I"
+	.ascii	"k\364\226G\372\324\311\206\342g+\371\356L\004\217\035\345#\322"
+	.ascii	"|\365%\272J\254\265-6\323J6\202\355\204\224\316K\325\303R\023"
+	.ascii	"\222\246\356\336\013D\346\213\316H\212\276\347\244\357 \3227"
+	.ascii	"[\312w\030\017?\237\306y\316ul\346>J\347\r\273\367\016\261\023"
+	.ascii	"3I'\215\276\323\322\033zwwww\3744\336\373,E\303\244@-\226\276"
+	.ascii	"\273\322w\017\351\233I\372n\246D\\b\216\001C\316 RJ\344\034\005"
+	.ascii	"\031\361\006u\245\321\237\345\030\356\207\016MU\222\fL\334\034"
+	.ascii	"\2324\214\246f\346\314ZZ\031\266/ji\330p\033\216\303kX\bv\303"
+	.ascii	"o\030\016\307q\020\374\306O\206\343\266\263\032v{;\357U\336{"
+	.ascii	"\017\203\355\314\331\030Fk\033\353\302bB\366\336#n\266\264la"
+	.ascii	"1v\263\272\300\353\r\1771\034\233q\031\2735\321\340K\315\334"
+	.ascii	"\275\316K\360'\375/$`8^c4\024P\367\0361\"\200\222\260)4u\367"
+	.ascii	":W\030\255\340]\265\261!\302\b\375\034\233\340\t\361\232\364"
+	.ascii	"\234\226"
+	.string	"\236\305\322\363\225\364\334$5\022\222\246\340\035\351\021\231\240#\272\216\300\323\3509\231\276\230\272\240!e 8\f?U\260\230\263\027\376\362\236'\347u\366\023;/\317F\377BzV\301\263ww\254\202w\022R\"6\301k\263\f\322\273\261\t\036;\231\013?\r\340\260\277\220\3406\tv\277\356u\016\241A\330\226Di\3642\322\001\256\256\004'J\317\006\360\370\216\r\340\275\323\307\261\t\336\317Y~\306\302_*\3542\252y\311\356u\026\245J2`\276\032\275\223M\360R.\301SKC\377.\203\341\246\346g\030H\374\027\323\3663\377<\364s\317\317#\260\375'\303\374Y\270\366s\027\265\237\227\322\374\f\206\346\3473\377\215R@\361_\205\007\307\340o\250\237\315\224\371\017'\355g.\264\237\311\374\217\341\277\003ga\314\007\370[\3703\001?\337\377\375[\3733\223\237\237\374\254\365s\223\237\225\374\234\365\263\223\237\241"
+	.string	"\3613\325\317X?_\201\371O\364\333/?\223\375,\366\363\363\347-?W\371y\353\347(?'\177n\372\271\206\237\203?+\375\\\343g\032~\226\341\347\030~~\341g\026~V\341g\024~6\341g\022~\006\341g\017~\336\340g\f~\256\340\347\t~\216\361\263\002?'\360s"
+	.string	"\377O\3709\202\237!\370y\305\317\017\374\317\363\263\212\237\027\370\271\200\237\005\370\271\350g\242\377r\376\313\3757\341\177\234\377_\377i\374\207\361_\355\177zwww\367\367\231\237g\177\023\315w\316\230+CD\374`\344\t\2270\317\016\323W)\360]\362\300\3215\247#\253\254J\313\313\371\331^\032\f\nv\223Bba\204\244\361\331\361\006%L\243_Z\313\217\034<\253\364<\252.\317\356\302hF\315$]\212-[s\306\324\335{\206EO\331S\310\224\267\364\r\306\035\006\326b\255\205\205e\3562\235,\336c&}\317Xzn-\336\226-\315%\275\367\032Ya\0021qH\211\342|s\271\034\241\257\2649#\264|iZuO\322\267\027\367W\226\227\241\227\354\342"
+	.ascii	";\232\262\365\206V\327\303$}O\222\364e\0130[\021;\334t\235\237"
+	.ascii	"\335\325P\032\354&W\271*f\335\275V,\200\274\254$\231j\364=<\322"
+	.ascii	"\263\340\376\241J[a\2734\311L\301@E\315]\346eq\364\210\364\350"
+	.ascii	"\\\372\226\322[\357)\177Oi.\266\272I:\fLi\276\241\325]+\253\243"
+	.ascii	"~FEqQys]\001\241\230A\t\223\272F\333\007\266\353\025\321F\006"
+	.ascii	"I\243\267\323O\376\373\360\332\246\362\334\361J\317\273O\314"
+	.ascii	"{oU\217\3632\241\200\316=\314G\177\020[V\340\332\325y\223cm\352"
+	.ascii	"\244T\312\236\210<\305}\217\333\275\312\253\244\006WT\312+!\313"
+	.ascii	"\260\253\233TFI\0261\357Ur\031vo\321U*"
+	.string	"\223\0354o\3212\354R]\034k\250\370:\257\222W\331\274EWy\237R,\225WT\313\260'\252\242e\330\025\325\r\273\272DW\371\304\334\241\274\314\242\033vE\347\2065\251\210\226aM\252e\330\225\025w-\331\374\240\022k\203\305\203\317\226\312\333C\252\310\023\223\310m\351l\336\270{\231,\307e*po\221&3\356I\b\233A\271\365\200\002\342\251\311'\244\240\260\232W\351\266\344j\336\313\005\305t\245b$\235n\327\t\273%\225\024\271Q9\356%@\352\336$_\267{o\362\336\333c\026q\336\313\003\321rKJ\352^+#\251[$y\226\343\336&{cF\265\f\303j&\235\215\205m]\035\316$o\335\270+f\032\226\344r\243\206H\267\250|\3205\352t\376\230\035\361\362\243\321\356\001(-\216X[\243G\241R&>oC\030!k\324\311\005z\n\"&\210;i/\351,~\0365\023gX"
+	.ascii	"VVz\320I\317G\274\241#%X6\254\254\2644\372\306\352+n\336\001"
+	.ascii	"\204|\210]\341\241\321F\322M~\236\350$tM\240\250\334\2449\334"
+	.ascii	"\313'x|w\307'xm$\351}\244\004\217i\345\274d\027<Q\342\325\250"
+	.ascii	"\355\"<\360\316\030\341U\307C[1\232P\322y\247,\360:\362C\035"
+	.ascii	"\021~6\017=\204\235\367\2560\nj3\2132\207\242\267^\351\355\226"
+	.ascii	"\020 X\312`\2215\332@\272\177t\2207\220\366\361\027\022\034H"
+	.ascii	"\331@\320{\237\230\023\020bN\240'\r\312\323\223\207\336j\245"
+	.ascii	"\177W\235\350Y9C\222\325T-\325\273s\245MJ\243\207\321R\\D\347"
+	.ascii	"\260\\\230#\260\211\233\033\002\316\230\0357Q\275CO5\217\356"
+	.ascii	"\321L~\266T\353x/{\307\321\226b:\214f\235[\275.Xrs<G\307eBOD"
+	.ascii	"W\t\025g\313\255\245\270NF\351\315\362\264\232\303\241\365\314"
+	.ascii	"\262d=k\270\242|\t\023\023\3537<\254\251*f\252\004\242L3\n\027"
+	.ascii	".\366\311`w*\200\263;g\214\365\332\361\206\304\202\335>\201\330"
+	.ascii	"\021s\323\362\223e\3456\213\025\273\205\355\260\363Z5\223t\r"
+	.ascii	" Ace\255\356.\213\034\005\263\220\254i\271\335\262\306\273\023"
+	.ascii	"3\273*\343*b\272\2764j\261\334~\301\t\241\006&'\265]\267^D|\300"
+	.ascii	"\341rs\345\367\001j\262\326F\307&=\211\265\364>X\037l\025\243"
+	.ascii	"f\222\016\003]A\374PuD\302L\017j\266,\327m\225VV\241\222k\324"
+	.ascii	"R\341M9\351\346\330\316\rW\022\035T\266~\273\325jLt\241\330\324"
+	.ascii	"\231\361\026\027*j\220X\250\333(~Z(\033\305.\255\256\217\025"
+	.ascii	"rf@Y\322hmi\024\212S\331{\202{C\323\350IT\245\347/\246\255\322"
+	.ascii	"\022\307\007\034!v\310\017j~X\252\2577v*\313\022\261X\354fEt"
+	.ascii	"\225b\352\346\276\330,\033\204\321\342\232\330\036\354\023\353"
+	.ascii	"\304.\261L\254\026?m\226\345\341V\312\366\270\221\315\262@\334"
+	.ascii	"\f\325\301\322E\b\021\312\274\034\n\250e\bZ\344\\Y%\374\264X"
+	.ascii	"7rb\331\"6\t\n\250\345E\305\202\220\222"
+	.string	"\347\314\211\025Atm\342\210\360\2224\205\200p2\031\242Q\213\244g%D\r\007\235\021~\332#\251\235+gx.\367cF\013kNz\0377\351}\326\254U*\304\234\221\2662\351}\306\244\367\001\223\336g,\275\217\226\364>]\351o\253,UOX\232:mT\214\326l\330\242\240\252\244)\270\004\257\217\270\004\317\356\260;\fy\231e\201\341q\202\226\0320\215\242v\331jR\266\244t\b\305E\361\302%G\017\230\273:C\032\2658\322\034>LT\2200\"\006\t\221Foq\374=\307Zp\270\263+\242Q&\"\351V\371\323Vfn\313Tz\356\342\236s{\347\330dsqN\tI\315\025a\301\313\321\0343k4\215\323\310\032\231B\227\247\217\350\273\337\307\207L\024\233\":\322\267\035\211&k\240Ti\264\373\316\033\317\027S\351\245\321\373<\245\357\2726\342\367\261vkdv\334I\337E\350"
+	.string	"'IW\243MD\232#\205\243\302\347\r\230\\\023\321vh\270W\331QD\254\3464\332Ct\235\267\235\246\273m'F\363\336\247\2663\224\347\336\247!\346\004\230\023@\275\260\244|\341\241O\337\322\236Kz\323i)djj\215\006\245]\3228qZ.\004\242\013\005\267\334\352\301\211\272rAT\262\0241V\305\215\233~\003\300Vol\311\2359\336T\220(y\336\260\035\017\207\226&]G\322\267\267\206\013!"
+	.ascii	"6g\323\301\022\305\316\355\274\341\032\210\317\024*XQRm\236\335"
+	.ascii	"\246\261\336\243\274J\256l\005M\361\022\203j\364\251\2165k\340"
+	.ascii	"\230w^\250\335\2347'l\322w\033\267\233[_5\321UB-\267\320\256"
+	.ascii	"xl\374l6\266\013\241\0033<sN4hZm\205\224\231\025\013\024\211"
+	.ascii	"\222\2653\215\2461\342\035\301DJX\243\357II\337\033R\306\f\333"
+	.ascii	"\245\310\262\325\213J\317\263#\203\306vOU.\254"
+	.string	"8ys\322\363\324\244o \334gg\r\304\350&\351\270\2502\367\206V\307\013SVf\335\004D\341\357\350\243\256E\244\b'\324!\360\306\214c\r\341\3607\243\351X\\:\252\306\002f\230\350\r\207? r\025\326@r\"\006#\270\301\211(\034F\020C\206O\006\0057 \251JNC Q\210tD:!!\331P<2\255Ebo\351\247\016\321\025I,\002{\226V\242\3608\3441\255\277&$b\261\251\251\b$@\211\370\253\241\364S;\27014\032\177A7\214\305\031%V#R\320X\002Ht\372`U\221?\304\245\356A\372\200V\0371h\354!\006\215\226i\r\022\325!O\305A\210D{7\214E z\\\215\366A7\216+R\030TW\360\r\240\244\022\203\302\341\257\247\244\"\235P\240\212\354\375\267\376\224\216\276\240\261\205\320\361\307\004D}\306&\225\205UE\252+\004\215\007\0245\315X\325\240"
+	.ascii	"H!Q\317\231Z )\r\205N5N\250JE\023\202N5T%\037\241\246\031j\211"
+	.ascii	"\325\004\220\013\2441(\024\224\324b\035n\260\2524V\025\271\264"
+	.ascii	"\204\302\257(H\0246\035\177?4\232f\020E\030\376\200\302\365\250"
+	.ascii	"\332\360\321H\001\004\001V\240\217\350tD\002.!\203\277\341\007"
+	.ascii	"\352\372[\221$\204^\264`\001\351T\024\332P\217F\"U\311i\025\256"
+	.ascii	"\303\r\b\030\2526,\214\026C\325FO\223\272\"o\320\020\340'F\213"
+	.ascii	"u\270A\361\370\343`E\376\206A\007\026\205\307\237\013J\352\372"
+	.ascii	"k\022\256H\017\324\3657t\002\016\177\300\001\016\024\036U\242"
+	.ascii	"\032L\037CF\0042(\270\241w\n,pa\201"
+	.string	"\013\336)\260 )\311\002\031I\351e$\331u\365![P\233\204kz&\003\210T\340\321\251Hc\035\376|\206\305\"\007\276\036\244\357\267\376:p\032\026i \215\301\242\365L-\220\306 RQ\030@\323\214u\370\353A\372~\300b\tHc0h\375\r\355\352{\001c%\n{\304\342\3202\r\207V\t\006\262\247\244\252F\032?*\362\350T\234\241Dt*\036\203@\306\242\022\023\272\376h49\021ygj\201\204<\026\221D\025\211\300\213F\365\210\264\026\213G\244\037\244/(\\\"\026g\034\325Um*R\2157V\244S\215!\"\022\350\023\032\221*PhCU\032B\"\325\243\222\322\317\007|!$R\217?\033\224\216?\246\325GAo%:\025\201>uhl\372!\213\226\214C\237\212\024\026\211B\253OF\322J\024:\245C\325\206o\t\370\003,\252@\253/\370c\241(\354=)iF\212\026N"
+	.ascii	"!\005\266 \026\205\253\020Y4\"\255LA\341p\t\211(\3745!\001\217"
+	.ascii	"H\244\026(\202\277\325w\034\002o\360\025\217\277\032AA"
+	.string	"4\027\032\0349\256F\3118\277\246\246\2364\325\\\241K\246\210\301\322\326`\204\214,\205<a{\303\213\"\223\305\312\032\031\352eH\023,58\016\350\242\226\244y\016\3055\227DY4\255\265\006\226\247\214\323ru\271\362ffKo\254NLU\231\206\202\372\030\033\022\225V\305\347\013N\f\023\315NJ\017)v\032\265b\254\030;\206\231L:\b\314\234Y\3758\372\355\331\355\230\264\236\034q\352\254i\324\232=-\305\343eK\233Fm\331\323\256\326\206\205$\r\005r\206\205\355N\230VK\343\310\271\317\006\"\t\204'NN\233F\277|i8\306\342\361#ws\310\271u\371\273X\262\202b\2502\3714\007\342\224R\312\320\314\310\2104IsR\n\020\204\203a\240\311\245\017\022\300e5\021*\250F\222\244P\3309\2322`\345KE\315J\330q\324\326\0329J\344\nw+<\231n\250L'x\252\263\3045"
+	.string	"\345$Qg\007\007%La\232\351\252o\206=S\fM\baf\210\312\377\262r\353\036n\263\251\230Wq\263\300q\036m\251\263\\f\302yh\341s\022J\371%\275\257\376\025S\302\365\213\360\2016\0019\037\376G\304~\3045\212\322\027`\020rJ(E\272\223\236\t\351|$\326'\027\203\364\371\036\350\377>\b\264`\245\322\007\307\323\232\270\376\230K'\234Bv60i\273\"-%\211\203\314w\356\224\223.\330\300w6\231\222\332M\300M\027\232\262\206E\030\334\030-\252\331\371y\n\3126\235l\234\037\345*"
+	.string	"\027\214W\265~\344F\202\270\200W0\272\r.)\2250\336P\346\307@\377\303M\217+B\317 \3576\252\347\003\377e\222+U\371\205>\346t\377%{\"\035\001x\016\264O\301i*\327"
+	.string	"\343\213\024Z\224;EjUf\032\tKz_t\245]Y\025\301\033\305\340_\345\036\366\362\020-%\354\255\340D\234\373\275\321\032(J\314\006\223\324l\236\367\210t\306s\223\346\t\233i8\305\312$H);\215\324\370\216\222\303_\307D\327\007\004c\320K\352\204\322\256p!\017cSD\341\344\253\007U\240\276\033\340^\252C0\224B\263 \236\257Y\215-~\250zJ\305\t\366==\221\330\f\332\276N\300\303;uU(\263\355\006\376\n]\321FAR\244\340\320i\353\004\267\204\232I!\347\344\257 \312\307\212\276\272\271b\002\344\035\001\273~\204\3744m\022"
+	.ascii	"\237Q\001\254\200ZJ\302wl\272\223\215\037\n\0360\227j\026\252"
+	.ascii	"G\nQ\020\360\r\342\350\021\271 |\"\266\343\030J\256\002\333\016"
+	.ascii	"\345qN\317\246\306\324\251D\037\322>\245\362!\202K\315\315vW"
+	.ascii	"\355\177\265\354\334\377\314:\232\350\254v\361\006n\r\313\343"
+	.ascii	"S\013Q"
+	.string	"+\230\363\326\355\230Nm~"
+	.ascii	"\240\227$<ve\005\274\344V\205 \317o\304RBR..]>rDL\021\\\223\n"
+	.ascii	"\213\224/\305\307\033|\245(\357\203\362\332w\374k`"
+	.string	"z\260e\032\301Bpmq\362{\274\221\263\272@H`\357\213\302Q\320\377\t\213\215\377\337U,\220y\311\237\235\235\266eO\356\304~\002\016\013\t\326i\204L:\t\327\235\214\343M1Y\203\242\t\276\2062H\202\322\214\242m\020D=\035\333\225\305;\261M\335AK\"\345\237\234m\020\024\243'\022\243\364\017\254\206\037v{\002\327\261\035\374\"o:\261\246\222\240\3525\\\221\325lt\311\335Z\001\376G\317\311D\341\367\376\22379Bi\035\036\3020\b\035\254\216\035f\365\374\303\232>\021\367\370h\211\230\032\336:<x\\2\027\341\303\223\317\036_~\217\327(\346Xe\262\013\026\253\336#\377\022\2244\032\325z\013\342\237=\026n\343D%\207\204\373\334\236\273\34246\b\357\\\331\333\351W\306o\346/d\341G\224\200\261\250#V\236\023\264%\347\240%\330\244\324\2152I]\031\r\230\361\016\360\034\224\304c"
+	.string	"\322\346 W\320\243\213\367hf\276\004H9R\314y\205\037C\331N\354--(\351\305\241c\353\367\373TU\367\204\\\244\251\f\332\032\254\024\302\023\234\262b\230\265\303\030Z\231a`D\217\202\277\320\276\204\370\351\270\342]8{\205`\244\333\325\303\321q[s\320m\241\371\321\n#H\213\346V\222\355\243j>C0\306#\206t\016?\030\304N`!\235"
+	.string	"\005h\341\345h6\332u|\340\305\003\352\260\n\307l\314X\232\274\366\217\304\344\372I"
+	.ascii	"\204g~\201\020\321\371\027I\020\205e\306\370\027\356?\261\355"
+	.ascii	"\250_\367\212\220~S\203\234\257\021G\315o\013\222\377\033%Hd"
+	.ascii	"\304\345i'\332\245!:\365K\364\334\335)\237\256d|\036\227R\357"
+	.ascii	"\032\035\3437\177\f\357\001v)6\202\240P\215\034o\243(qD\224\345"
+	.ascii	"\210\320\204\024\340}/\037\261!e,\013\027z\307\335\306\360\303"
+	.ascii	"`r\216\255LTNd\001\347A{k\367\325~_\342H\337\f\341\363pJ\246"
+	.ascii	"\306\001/\310_;\370)\307\204g\2469\336\362|\004\203\343r\370"
+	.ascii	"[\331*\326\321\271!\365f\346\216\354N\035\363\341\374\227\337"
+	.ascii	"#\274\354\275\320\360Mw\352=&~/\263\226X\336P\237 \206W\362\026"
+	.ascii	"\250w\254\261\365\301v\340\371\215a\033\307\257\371\372\307w"
+	.ascii	"\376\274<0\253\255"
+	.text
+	.section	.gnu.lto_.symtab.bb61863fa261a606,"e",@progbits
+	.string	"calculateEstimatedVario"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\001"
+	.string	""
+	.string	"calculateEstimatedAltitude"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\001"
+	.string	""
+	.string	"positionConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\001"
+	.string	""
+	.string	"isAltitudeOffset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\001"
+	.string	""
+	.string	"getEstimatedAltitudeCm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\001"
+	.string	""
+	.string	"getEstimatedVario"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\001"
+	.string	""
+	.string	"pgResetTemplate_positionConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\001"
+	.string	""
+	.string	"positionConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\001"
+	.string	""
+	.string	"positionConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\001"
+	.string	""
+	.string	"barometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\001"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\001"
+	.string	""
+	.string	"gpsSol"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\001"
+	.string	""
+	.string	"GPS_verticalSpeedInCmS"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\001"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\001"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\001"
+	.string	""
+	.string	"applyDeadband"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\001"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\001"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\001"
+	.string	""
+	.string	"baroCalculateAltitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\001"
+	.string	""
+	.string	"performBaroCalibrationCycle"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\001"
+	.string	""
+	.string	"baroIsCalibrationComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.bb61863fa261a606,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1944 @@
+	.file	"servos.c"
+	.section	.gnu.lto_.profile.7a57cb9ec02d0b1b,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.7a57cb9ec02d0b1b,"e",@progbits
+	.string	"(\265/\375`O\003\205\020"
+	.string	"\004\026C\004"
+	.string	"."
+	.string	"\334\301\274\312\f\f\002"
+	.string	"\002\001\002\002\002\001\001\351\361\316\337\001"
+	.string	"\002\214\216\274\341\007\003\274\331\333\367\005\f\002\003\002\004\002\005\004\240\342\234\212\n\005\006\224\305\200\177\006\002\002\002\007\002\003\002\b\007\n\232\242\313\204\f\n\002"
+	.string	"\002\006\t\003\002\004\013\f\r\340\216\253\313\016"
+	.string	"\002\006\017\331\312\303\304\004\b\002\002\n\021\240\367\360\225\r\002\022\227\241\264\221\007\b\002\002\002\013\002\f\003\002\004\024\025\206\353\317\360\016\f\002\r\002\r\002\016\002\017\026\352\263\360\321\b\027\030\031\265\314\211\315\006\020\002\002\020\021\002\020\022\002\022\032\227\257\311\336\r\033\344\362\241\220\b\020\002\023\020\034\375\251\320\324\006\212\001\002"
+	.string	"\002"
+	.string	"\002\024\002\025\002\003\002\026\027\003\002\b\002"
+	.string	"\026\002\030\002\030\024\002\031\004\002\002\002\017\032\002\017\033\033\004\026\002\026\"#\350\247\211\367\002>\002\002\034\002\032\002\t$%\256\373\201\203\rX\003\002\004'\342\201\222\246\004\002(\230\227\377\334\t\002)\257\260\211\347\004*\265\371\317\206\t+\362\324\245\255\006,\303\306\351\344\006-\320\266\271\326\t.\374\234\315\270\013/\227\213\266\256\t0\376\312\360\275\b1\265\332\223\353\00123\244\376\226\227\01745\235\336\315\261\00567\362\326\362\261\0038\240\342\234\212\n"
+	.string	"R\250\301\241\200\231\231\224&)T\2265P\002cd\264\016\022"
+	.string	"\204R\324!\204\314\004c\021\r\323\372w\315\370)\350\030\350\376Lc\256\244PhO\265\242]\230\341ya\214\352\336\017\343\366F\344\017\243{\241M\360\232v\245X\360\371\002\325\235\007\034_#\246z\340@\344\3542\b\357\347\255\303g>u\213{\301\b\212\342\304\324\2753\275E\207\241\336\256\217%\216\243\322\307\034^\007\323\003$F'"
+	.ascii	"\341\311U\236\240\215\307\031\2746K\342\211rx*V\337M\002\266"
+	.ascii	"\r{\0272\233\310\320\360\342\351\334H\276\312\262W\264\342\323"
+	.ascii	"~}\2647\201\030"
+	.text
+	.section	.gnu.lto_.ipa_sra.7a57cb9ec02d0b1b,"e",@progbits
+	.string	"(\265/\375 \355\265\003"
+	.string	"\204\003\341"
+	.string	"\021"
+	.string	"\001\001"
+	.string	""
+	.string	"\001\001\001\003\001"
+	.string	""
+	.string	"\001\001\002\001\002\001\006\n"
+	.string	""
+	.string	"\r"
+	.string	"\001"
+	.string	"\001\017\003\021\002\003\022\025\031\033\001\034#\001%\001"
+	.string	"\001'"
+	.string	"\003("
+	.string	"\001"
+	.string	"\001"
+	.string	"\033"
+	.string	"\270"
+	.string	"r\n8\003TU@en%0\227,j.\376lYM\026\030{\035\246\2403\020\027\001\304\200\343$X\314'6.\f\004\323\f\013\002\2119\360\317\",A^\302\330"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.7a57cb9ec02d0b1b,"e",@progbits
+	.string	"(\265/\375`\261\003\205\021"
+	.string	"\346VVF\360\2568\215\001\360~\263\273y\366C\262\\\233r\024\035\237\r/p\351\\\222\254\275\255f\357\235h1\235j\354M\2756\221U\356\207\343\271\305a\332\300&\262I\371v\266\211B\221\357\004\371bl3\f\375\311\2262\005;"
+	.string	"G"
+	.string	"K"
+	.string	"\233\222?\307\352\272\024-j\316\251\261|}O\224\037;\347\234\231\007\260C\t\r\005\226X\333\272'>\207\355\373\255X\242Bf{\321n"
+	.string	"K&>\373:Z\026\260\304\002=hlB \t\003\323J\301J\262\007\221'&-cFH\277\315\260br\372\f@\f5\304l-`\205\0237\347\211*\222,L\r@x,\007\224\205S\267\246\"\022\2343\354\366\345H\222RTZh\234y\342\376\233|\301~\001*3+\252ld\303\0274\253\004\035#\013\001%\302\207\2157\324\263!\222\304\313\345B\201\204UL\3501\2019,\034\341\232\251\t\221^\030R\003\026\240\236\325\324A\215\013\205\220\310\216`\353\205\343\214\016H\007\323\277c\365]?\214\003\377k*3\316\b>\260\315\007\364WU\006\005M\n}\215\256\013+\324e\003\243%\231\036\260\224%D\252u\362\211\013\274n\376"
+	.ascii	"\034\006\331\223\254\bU\210\262\253}I\262\243*4\351K\327\205"
+	.ascii	"l^\250\221\255b\002\032#I\352\024:`\002\231)\252\363\022\300"
+	.ascii	"Se\305$\024HH\202R%v\3327\234\303\241U\201\300\b4Z\361\344\006"
+	.ascii	"[\317\200\224Ht5\200\334i\353?\024\221\277P4\226\\\r,\274M\233"
+	.ascii	"\205\t\226~W!\3065\005\367[\325*\251v\3020[*'8\256\\\201\"\021"
+	.ascii	" \311t6\275\227\371A\222f\017\t\210\231\207\330\3338L\330R\021"
+	.ascii	"\033\223Z\257\302\226aE.\272\363Z\317~\025l\336;$\361\237>b\362"
+	.ascii	"Z\305U\373\247o`w\262j\024\021\304^g\\(\225{fG\224\337\325\307"
+	.ascii	">[\213\372fX]\221\334\212\303%\335hjL\257\324\337*K\344<\265"
+	.ascii	"\032\224O-\206J\333\302\251\227b\334\271d\t\210\035F+Ki\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.7a57cb9ec02d0b1b,"e",@progbits
+	.string	"(\265/\375`\021\003\325\f"
+	.string	"\206\02063`U\223\341Tq\350\022\3341W\352\330p\035\030\275\367\b\202@\261h\003\031\315m\0316\b\202 eD_=\351\333\212q\275aacQ\264\356\270\267L2%"
+	.string	"'"
+	.string	"-"
+	.ascii	",\320\352\336]\264N\211\206.\322\2651\fYj\\j\0352\2538\253\""
+	.ascii	"\263jFv\033\255\354\272\365\254\220\r\004]\215<\340\345RQ\324"
+	.ascii	"\316\242\265\006\226:K\035\345[Y\240\220\362\336{$\201"
+	.string	"\306g\334\311i\311\250\361\315\244E\211\344\037w\217\357x\201\026\210\343\341x&\235I\207\233\320&\364\336\004EM\002\255\273\250\024gZ\301\231\326\327S\260$\220D\370|\246\033\201\t$\231!\0378=`Nk\332\005\301IsY[jc\334!W\267\034C\316q\024\355*\034(J\300\001\036\300\007]\250\021I\314(\221\304\222a\016\200\002\221\272\243\007\022\200\302\202\210a\305\030a\220\330\331\2375\004\205\022\241\355[\334B\007\227\026\254w\025\216_\320Qs\220G:f3*V\247\272\261\305\312\024\367^\242b\266V\310o\204\326\345\246X\360\335KQ\346\262\243\231m\313\341\306\021y\003\351\3121,\265\005\243\277.J\203\367W2;A\207\332ojA\314c>*OW\210\3236\257\347U\263\021\245+\032Q\2462\bl\017\330$\207\210<V\2536\002\261\017\357\177\342\264rG\221'\021\211\364g\342\227\344"
+	.string	"\r\274\275\222\313\251\312.\2311\310\223E"
+	.ascii	")\001G\322\025\034\027a=\2401NQ\325\023"
+	.text
+	.section	.gnu.lto_.pureconst.7a57cb9ec02d0b1b,"e",@progbits
+	.string	"(\265/\375 8\301\001"
+	.string	"4"
+	.string	""
+	.string	""
+	.string	"\021"
+	.ascii	"\232\004\001\230\004\003\230\004\006\230\004\n\231\004\r\230"
+	.ascii	"\004\017\205\004\021\205\004\022\230\004\025\231\004\031\231"
+	.ascii	"\004\033\232\004\034\231\004#\231\004%\231\004'\204\004(\230"
+	.ascii	"\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.7a57cb9ec02d0b1b,"e",@progbits
+	.string	"(\265/\375`\341"
+	.string	"\205\007"
+	.ascii	"bJ (\200\305\031\016{Jg\226\321M,\neD`\0013!\322\020]\t\364\004"
+	.ascii	"\276\241\237,\344\365\341\315\332>d\242\333&e\ngX&\231`\317\244"
+	.ascii	"~\257\320\312\265\316H\235D\206\200`\345\341\245r\251\335\300"
+	.ascii	"gk\341\321gcTBu\225_\323Q\376\332\f\032\235\214\316\327\306\371"
+	.ascii	"9\255r\253sQ^\265\215\3402@\251X>\303\351\r\232\346\016Z`\347"
+	.ascii	"\016\230O\356y\247\332_\271\203\341\321\320\023 1 `\002Cd\346"
+	.ascii	"\001~\262\200v\310\206\210\004~\005\n\n\001\323\350\2626\241"
+	.ascii	"\204\201\003\030r\263\263e#\b\211\217A\211]\026\303\256\251\016"
+	.ascii	"k\r2x\374_\343FZ\361w\013\005r.1\327\205\004B\024\240\226\300"
+	.ascii	"\005\272v`\317$|\365\261:0\016\205\320\036_\034\372#L\307\002"
+	.ascii	"\303\021tP\206 |\260\350\320Y7V\301n\021"
+	.text
+	.section	.gnu.lto_.lto.7a57cb9ec02d0b1b,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_servoConfig_Registry.67.7a57cb9ec02d0b1b,"e",@progbits
+	.string	"(\265/\375 \235\225\004"
+	.string	"4\bh"
+	.string	""
+	.string	""
+	.string	")"
+	.string	"\005\001\212\001\202\200\200\374\342\303\275\310\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\346\006us\250\377\005uq"
+	.string	"\005\001\006'\001\020\005\001\006\035\001'\0014?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/flight/servos.c"
+	.string	"\004"
+	.ascii	"\237\n\013&\321 \212\274\001\024\001"
+	.text
+	.section	.gnu.lto_pgResetFn_servoConfig.68.7a57cb9ec02d0b1b,"e",@progbits
+	.string	"(\265/\375`R\002\225\022"
+	.string	"\006\241vG\320\362&\035Rp\335\300\252\tue\334!\001!\365\214\0057\027K<(B`*\307\327\352@\326\362\260j\323\202\360\323\204\345\220\306\234\243\035\211~\260\202\3761\344i3\356\317\2427Dg\346\252@k\311 \233H\231R_"
+	.string	"\\"
+	.string	"e"
+	.ascii	"9vm\021|\362=\332\366\004\336\343\367\003\336\243e\366\217\005"
+	.ascii	"7,\"9FT\273\013\352\n\177\357lw\227\262\307NS\346\023\335\001"
+	.ascii	"\n$Zm\366\330\215\354\360\360\030P\273\351T\242\240R\034\367"
+	.ascii	"\324\251\331d\027\324s=\356'>P\264Z\317sdew\235\264\332\211\333"
+	.ascii	"\273m\230\355\025;{\002\321\247\361\036-\020Q\005\251\311\234"
+	.ascii	"m\233\245\002\331W\211\302ya\375\261[]\232\365\241\337\373\355"
+	.ascii	"VMg\246O`\002\216\202\251]\023\271!\353\024\225\\\374v\3736\037"
+	.ascii	"W\364\031\262\337L\276\031\317WcG\t \2736\b\217N\371\036K\272"
+	.ascii	"\257l?\355\307\270\f\331\207h^`\367\207)$\321\007M\312@^\277"
+	.ascii	"k\360\354\r,yZj\311\215\316\314\322\353q\217C>S9ETY\352\244I"
+	.ascii	"\325dN\025iGH\222\272k\271\216\227\200\231\221\353Ja\222\221"
+	.ascii	"\320\377\362\354\227\343x}E8*\t\036~\303\006\200 \234\320\252"
+	.ascii	"\351\241g\303\234FH\362d\2078R\354\333\335\224#\230\b\004,v\367"
+	.ascii	"-\0363.\0161\025\002\274\274\\bB\n+\267\240\304\302\0210W\f\224"
+	.ascii	"\351\360\362\372\340\002\306\274X`\300\026X\fDa\340\020\204\013"
+	.ascii	"\006\312\204!\f\\\331\366D\377\216\202\234j\324&*\220[K\332\322"
+	.ascii	"\b#\255\223U\267\036$\262\352\335\356n\247@7\361T[\372*\037("
+	.ascii	"\034\0256\231s\252\355\2317]x\240bc8S\206\006OK\0013 p\002\241"
+	.ascii	"J\242\007\217\230\364Wbk\327\202\315\005J\254c\226\372~\215\305"
+	.ascii	"$\026\374\370\305\214\337L\033E\262\002\234\205 \037\"\300\275"
+	.ascii	"jD\246 \236\212H\362\217\022o\340\307\213\244L\323k\002\302["
+	.ascii	"\022\035i\342_\202@\317\265]\305`\\\254\022\335\357;\346\013"
+	.ascii	"\233\323wM\254\325\272\373\206i\327@\304z\267\331V8a\321\020"
+	.ascii	"\301^\250\031\357K\244s\365'"
+	.text
+	.section	.gnu.lto_customServoMixers_Registry.72.7a57cb9ec02d0b1b,"e",@progbits
+	.string	"(\265/\375 \221E\004"
+	.string	"\244\007\\"
+	.string	""
+	.string	""
+	.string	")"
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\203\315\361\037\006yw\350\316\006yu"
+	.string	"\005\001\006'\001\360\035\001\020\025?\202\210\2008sq\301\001o\300\001m\277\001k\276\001i\275\001g\274\001e\273\001"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/flight/servos.c"
+	.string	"\004"
+	.ascii	"0e\250\204\004\232\344\r\240\b"
+	.text
+	.section	.gnu.lto_servoParams_Registry.76.7a57cb9ec02d0b1b,"e",@progbits
+	.string	"(\265/\375 \237}\004"
+	.string	"\364\007j"
+	.string	""
+	.string	""
+	.string	")"
+	.string	"\005\001\212\001\202\200\200\374\342\203\316\301\037\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\376\006us\324\006uq"
+	.string	"\005\001\006'\001\340\035\001\b*?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/flight/servos.c"
+	.string	"\005"
+	.string	"0e\250\004\017\263\350\024E\336"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetFn_servoParams.77.7a57cb9ec02d0b1b,"e",@progbits
+	.string	"(\265/\375`l\0015\017"
+	.string	"\226^iE"
+	.string	"\261&\035;V\360L\326\\\n\247\367\235\303\263\033[T2B\344c6\277 \241:\320m\341OZ\316\210\261\245\202\017k\342\312\036\356\214[\377\377\256ZA\3038\003\2461\203^\327/q\377&\215\354-eJ\001U"
+	.string	"R"
+	.string	"U"
+	.string	"'\200=f\037\200=\032e\327\270\007\263\377ZPZ9vWS\020\316\016\275\033&\352\021j\242\374\231#\360P\323\251R\217\320\243\2622#\200j\003$\331\321Y\235\365LQ\235$$\301r=\353 +W\247byz\030\354\256\263Su\270\261\3336\331^`\337D\376\\\346\367\374\273\341\323\252\351\324\364?\260\0332\n\274v9\274x,N\204!\"\363\237\375\326=\237e\320\243\235\342*P\377l\223\245V2\327\007ccwC\036\255 {<"
+	.string	"\017\262\375\264\177\342(P\227\311p\001\273.7.v\275\004\006\311\036\355\005y\232\237\346-\266\324\241\261\313\275\363W\234\005\005\370\020\217\306\260a\357\036\375\r{T\265+\\\310w\376\330\371\300i\312\251\036U\025iq%"
+	.string	"\3341\260k\352\271\230\223|\031\352\365\2557\210Y\325\240\3640\311\227\252KE\307\013\325\027\333K%\311\0167\302\352\342\243\213B\244\222\323F\032e\016\215l%\013&\321\246\235 <\030Ep\240\221F%\022\264\220i\323F\f\2704Ad\322N\245\222I\003y{u\361g\236\321\340\3001\321\223\250/\366\334\350G5'C\0165\3056\030\324\313|9\032r\307\341\356.\264\310\241~\364\254\303\035+\027\327\222\005\031"
+	.ascii	"1\003\373\274\201[?ieQ\\\363!\n\210\305\032M\b\223\231A`\006"
+	.ascii	"\005'@\237\265V\211B\262\020\316S\2259hg\225\260fu:h\027\207"
+	.ascii	"E\224\275P\325x?\211t\256\371\004"
+	.text
+	.section	.gnu.lto_gimbalConfig_Registry.81.7a57cb9ec02d0b1b,"e",@progbits
+	.string	"(\265/\375 \220=\004"
+	.string	"\224\007["
+	.string	""
+	.string	""
+	.string	")"
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\203\336\201\037\005yw\250\324\005yu"
+	.string	"\005\001\006'\001\001\005\001\006\035'\001\0038sq\301\001o\300\001m\277\001k\276\001i\275\001g\274\001e\273\001"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/flight/servos.c"
+	.string	"\004"
+	.string	"A\210!\345.\320$o"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_servoMixerAirplane.86.7a57cb9ec02d0b1b,"e",@progbits
+	.string	"(\265/\375`\005"
+	.string	"U\004"
+	.string	"\364\005\370"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\030\001\344\035\001\003\007\005\001?\202\210\2008\177}\277\001{\276\001y\274\001w\273\001u\275\001s\274\001q\273\001\005\001\006\025\001\004\035\001\006\303\001{\302\003\002\005\307\001{\306\002\004\312\001{\273\276(o3\314\0014\313\001\311\001\310\001\305\001\304\001\301\001\300\001"
+	.string	"\023"
+	.string	">\003"
+	.string	"\351\200\312\002x\332B\035\270\030\370\t\212\201\023\320^\360\211T5\257"
+	.string	",\302=\320\003\026P\301\221b\365"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_servoMixerFlyingWing.87.7a57cb9ec02d0b1b,"e",@progbits
+	.string	"(\265/\375 \3725\004"
+	.string	"\244\005\355"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\030\001\344\035\001\003\007\005\001?\202\210\2008\177}\277\001{\276\001y\274\001w\273\001u\275\001s\274\001q\273\001\005\001\006\025\001\004\035\303\001{\302\030\001\234\177\273\001y\306\002\276\273(o3\312\0014\311\001\310\001\307\001\305\001\304\001\301\001\300\001"
+	.string	"\022"
+	.string	">\003"
+	.string	"\350\200n\001\205\177F\025\fx\271)\323\026,"
+	.string	">I\225"
+	.ascii	"\354^\026X\204\366\200\f\b@eFJ\320\003(\002"
+	.text
+	.section	.gnu.lto_servoMixerTri.88.7a57cb9ec02d0b1b,"e",@progbits
+	.string	"(\265/\375 RE\002"
+	.string	"\224\003E"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\030\001\344\035\001\002\005\005\001?\202\210\2008\177}\277\001{\276\001y\274\001w\273\001u\275\001s\274\001q\273\001?\202\210\200\bo3\300\001"
+	.string	"\005"
+	.ascii	"@\006\004\2402#%\350\001\024\001"
+	.text
+	.section	.gnu.lto_servoMixerBI.89.7a57cb9ec02d0b1b,"e",@progbits
+	.string	"(\265/\375 \323\265\003"
+	.string	"\364\004\306"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\030\001\344\035\001\001\005\005\001?\202\210\2008\177}\277\001{\276\001y\274\001w\273\001u\275\001s\274\001q\273\001\005\001\006\025\001\003\002\302\002\234\177\004\306\305\306 o3\310\0014\307\001\304\001\303\001\301\001\300\001"
+	.string	"\020"
+	.string	">\001@\230.\307Y@\037\027\032\003*\2466\f\203\300\300'\200/\231j\017\310\200"
+	.ascii	"Tf\244\004=\200\""
+	.text
+	.section	.gnu.lto_servoMixerDual.90.7a57cb9ec02d0b1b,"e",@progbits
+	.string	"(\265/\375 x\245\002"
+	.string	"\304\003k"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\030\001\344\035\001\005\005\001?\202\210\2008\177}\276\001{\273\001y\274\001w\273\001u\275\001s\274\001q\273\001\004\301\001{\300\020o3\302\0014\277\001"
+	.string	"\t"
+	.string	">\003"
+	.ascii	"\0201U\016L@V\367\300\002\225\031)A\017\240\b"
+	.text
+	.section	.gnu.lto_servoMixerSingle.91.7a57cb9ec02d0b1b,"e",@progbits
+	.string	"(\265/\375`u"
+	.string	"\365\004"
+	.string	"rF\030#\220-4\006\177\375\257\205\277\205\377\266\265\221gf\026?\361\247|Qsw\033\027\345\254G\265\276\204\320N2\371\3457\346\314\2339w\366\034Z\364h\322%\303\246\202\342\027\243\202\200\017\033\264\002P\243\013\225\340\301\256\267\305\216q\245qs\354\0367\266\005\0229H(\023\304\272\257\323\204\327\256y\346\211\031"
+	.ascii	">\003\200tId\361\204\177L7\252\320\036\370\230Q\234\200O~Hx\331"
+	.ascii	"\021\314\002\017\355\201\217\215\036V\005\300\200\nh\017|\214"
+	.ascii	")\026\376\252\037,\240\202#\305\352\001\024\001"
+	.text
+	.section	.gnu.lto_servoMixerHeli.92.7a57cb9ec02d0b1b,"e",@progbits
+	.string	"(\265/\375`\235"
+	.string	"\225\005"
+	.string	"b\007\034'pO\032\003\374\374\327_\377q\333^\377\244\361\357\252*\244\237XD\321~\377\377zWH\002\005D\255\216\354\326\032I29\346\260\346\315\234;{\356\006\035z4\351\322\246Q\206S\205\305\335I_\255\362\265\"=*\002\037}S\365\"\214\013&d\262\271\301\313xklq\274\2177\235\313\276@4Dd\"I\374"
+	.string	"\326\330\352k\f\376\362\314)\001\033"
+	.string	">\001\264x\002P0"
+	.string	"\035i\312\024\261\026\024\r\034\332\300\001x\304\024\037h\031\360rS\306\223i\031"
+	.string	"y\202v\340c\200\005S\355"
+	.ascii	"\211\214\252\353W\347@\017X@\005G\212\325\003(\002"
+	.text
+	.section	.gnu.lto_servoMixerGimbal.93.7a57cb9ec02d0b1b,"e",@progbits
+	.string	"(\265/\375 \177\315\002"
+	.string	"$\004r"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\030\001\344\375\035\001\r\001\005\001?\202\210\2008\177}\300\001{\277\001y\276\001w\273\001u\275\001s\274\001q\273\001\f\273\001{\302?\202\210\200\020o3\303\0014\301\001"
+	.string	"\t"
+	.string	""
+	.string	"\021\250\253Q\347\206\352QY\007pP\231\221\022\364"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_servoMixers.94.7a57cb9ec02d0b1b,"e",@progbits
+	.string	"(\265/\375`T\002u\f"
+	.string	"t\022\037\003"
+	.string	""
+	.string	")"
+	.string	"\005\001\006\177\001\035?\202\210\200\020}{\274\001y\273\001\005\001\006\025\001\032\031\030\027\026\005\001\212\001\206\200\200\374\342\203\304\243\017wu\b\310\001y\307\025\370\377\202\017sq\002\314\001y\313\024\023\022\021\020\234\236\350\027om\t\330\001y\327\017\374\302\017ki\005\334\001y\333\016\r\f\013\n\t\274\236\254\227~kg\334\001y\351\001\007\006\240\227zse\314\001y\357\005\357\342\rca\004\363\001y\362\004\003\002\360\226o_]\001\373\001y\372\330\003[3\375\0014\374\001\371\001\370\001\367\001\366\001\365\001\364\001\361\001\360\001\356\001\355\001\354\001\353\0015\352\001\350\001\347\001\346\001\345\001\344\001\343\001\342\001\341\001\340\001\337\001\336\001\335\001\332\001\331\001\326\001\325\001\324\001\323\001\322\001\321\001\320\001\317\001\316\001\315\001\312\001\311\001\306\001\305\001\304\001\303\001\302\001\301\001\300\001\277\001\276\001\275\001"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/flight/servos.c"
+	.ascii	"3 @#\031\221\033M\022\200)/\210M\\.\334\016\265\025,\021\351"
+	.ascii	"\036\244\\\f\2757\302\"\0349[\221\005\273$\332\262Ap\321\314"
+	.ascii	"\262\355\301\354\346\023\226\210\344$l\022\203\226\373\241#\204"
+	.ascii	"\031\351\302\366\003\316$\271\ts\"%\351\032d\312]zT\223\257A"
+	.ascii	"/W\177\330\311%\354\022\341d(!2\350a\025\001"
+	.text
+	.section	.gnu.lto_determineServoMiddleOrForwardFromChannel.95.7a57cb9ec02d0b1b,"e",@progbits
+	.string	"(\265/\375`[\002\005\024"
+	.string	"Fe\205J\300RN:\303\225<\251;\371\027\377\007\202tFP\006\335\034\365\246\205\342:\342\235[\266\373u\023\372\023V\332\336t>\006\356\0012\252\206\2665A\352\310\305!4\025\024p\325l\025 (\243\300G\213c\333&\215l\"wJ\001o"
+	.string	"h"
+	.string	"q"
+	.ascii	">\322_\344\376\323\340W\255&\2024j\375!\360\310x"
+	.string	"j \264\355\273\370Q\316\272\371;\001B\034\032\221\263\004\244\326*\003p\021\361t>\200x\272C\327]\244\341N\235\317\341\342yZ0\321\025#+^\217\347aH\017'\326\273\231\033\212T\005\371\b\351\341\204#?S\"^~\352\364l\346t\241\324Z=y\275\020\267\353\266m\266k\366\334\005W\342\201$\356\367\345)\013#\251\234\255\335\f\332?\233\271>\373\033\f\006\203^!\303<\375z\322=\376\367\213\236\246t:tM\2578=\351\364c!\300*\005O\265~\bj\325\034\024\230\342I\277\375X\220\223i\256\344-\243\212j\255\261i\347\374\3221'(\311=\251f\254*\\M:z~\324\372;p\352\222qN\007\007>\210\240\242\"\236\276\366\005\0347\334\025#+_]\005\001\303\365y\334\335\271UR\331\022\3764a\254\265\232\370N\237A\241\302l\2367\333K}BeU\001\355\372\034|\2158\356"
+	.string	"\037\254\262\307\315\f\342\271\343N\034\246\275\251\266\035|v\374\034\325zcr\030\366\206\313h\231\005Jh\225=G\265\326\023\246\307p\361\211N}\001f\236w\352\223\033\266\301\220\270\024\026\334\214\006G\246\220\020^j\267\333\314F\023\220\241\306r["
+	.string	"3\215$\206\234\301\325bd2\266\026\227\027\013\262\233\313\fFF\303\305\310H\b\230\304P\303\311dH\022'\213\375v\017\353\ny\022ey\240\260}\371W\021\026U\370Z\272:\266\351\032e\2676a\255\265\212\353s\203K9`@\002h\351\206\r\330\276VD\031!\355\354L\241\240\353\363\314k\350N|\250+ `\002\031Ch\036~\261#\215\350\277\342\305R\202t89\301n\311h\211\275{\260\322t\240|a\023\226\031\343\314\311\241\261\206\332\236&\343%\333\205?Z>\230\236\341p\235H\204\235>4&\216\376\230\313\376_\215h1\026\252\035\300 m"
+	.ascii	",\r&F\316\313\327\204 \005\224\256\021=\002\262\213m\274QF\365"
+	.ascii	"RP"
+	.text
+	.section	.gnu.lto_servoDirection.96.7a57cb9ec02d0b1b,"e",@progbits
+	.string	"(\265/\375`<\001\305\r"
+	.string	"\246Z^C"
+	.string	"s\224\0168\251\251R\241\003%\254\033\350\214\177$\373\330\374\365\336\220L>\2609P\r +(}\030#B\277Eh\0248\347\265\031\256RA/\004\fx\004\323Q\352\225\327\337b5\364Gdo)S\nH"
+	.string	"E"
+	.string	"O"
+	.string	"\0052\217\266}\227\257J\366\013~*\274\267\254@\275\364\330]m\344\001\262Gx"
+	.string	"\331\243\266\274t\250Y\362S\016\035\270\314Hy\"\256\"^\007Gv\367\255\247\212w\312\004)\331]g\312\003q\307\333^`\033\202}\017\001\031\263\277.\225\305>\\]\261\377\375\231\263~\220\247\243\246\241\246\365\351\324\3645\"<p(\310\261\373!\006\333\033\261F\013o\370\013k\b\030\325\356nn\227\354\215\375\3318\360<\313/kvS\250h\354\256\001\007\376dP%\270t\234\322\207U\257P\263\027\212D\2271\247\252\036\025\223Q\222\247f?8\300:[\270\214\023\006%T&V\273'\004w\331\241\307\330r"
+	.string	"\n\230\253\303jw\023\300\370\013\006\237\305\243E\244|\n%{\274\276u\002\035\214\013\226)6\361t8\322\366`D\n\201>\033\r\236\t\240\006!\356pD[\006\316#\322F&\025>\027(h\240O\204\023\255\303\2114\216"
+	.string	"o!\017\247\215\266\215\3236\237\351pu\305(#\224\344o]sbGLr\036U\305vT\227\230\264\203\312\222\273\233\242\001\027"
+	.string	"\255\262+-)I\304\273vC\006\331\272\2115\364\330\n,m\037\027\353\343\204}l\266\266\274u]\030%n\266i\301\n`\004\344\003\303\202\n\255"
+	.ascii	"*G\251j\030u|kK\031"
+	.text
+	.section	.gnu.lto_servosInit.97.7a57cb9ec02d0b1b,"e",@progbits
+	.string	"(\265/\375`\316\0025\026"
+	.string	"\206\351\217K\260\324Q:\270\304\302-\035\027\177\270\314\2319\237\262dK^\335\310;\322<\221\211\226&\361\321\334\036B\021@n\250_\342[ap\224n\341}\r;\360}\331\373\202\r>\203\356N\363\316\325\225\247\0252T9\2144B\210\334)\005|"
+	.string	"v"
+	.string	"z"
+	.ascii	"\343M\317\354\246\003y\365A\037\217QT\255\265\265*\\^\004\336"
+	.ascii	"&\235\235dU\232\244J\\:\363{_\2358\332ITN\344t_1\335t\357]\305"
+	.ascii	"\305\215\004-E\225\317\315\307\231n#D\327\023\020\335\177;\324"
+	.ascii	"|\212\034\320I\nt\225\210\213&8\0361\245\326j\342ltE\224\037"
+	.ascii	"\026\247\t\256&\2628!A\275w\332\203\263Q\252jPk5=q\271\273\344"
+	.ascii	"\266\215l\267\3304)\037^d\303\342\325js\311\370\214\227x\241"
+	.ascii	"\217\306pC\376\374\350\337\220\037\351\256\254\370\351\320)\227"
+	.ascii	"\324\346 \243?\277,!nX[\232\r\244\321\335\331w=\355\fy\203l\226"
+	.ascii	"y\337\275\032\251K\221\232\034\251\307\221Z\024\251w\251)\245"
+	.ascii	"\276\200\023\"\036\013\210\324\3723e\244\016\307\244\026\367"
+	.ascii	"\335>\221\377\263\211 \301\354\276\234\262\016\251\216\202B\247"
+	.ascii	"Z\201-\037\315R>\344G\024\336j\311e\340\013\356\006}\244\220"
+	.ascii	"\310\335\231\356\205\377\357\242\024\224\350\347\220\346\366"
+	.ascii	"\370\252\003\2771\242\350\021%\244\025#\207\r\361G\037\227\026"
+	.ascii	"1\260\326q\257d\302\266\264\003`\332a\264\273\363;\220\342\316"
+	.ascii	"\024\375\260\321\"\016@S>\201\264)"
+	.string	"T\240?\305-\021\206\030\332\226\346]\277\306\203\306\341\013Y\306K\364\247\227\310\217\037r\006\241\273{\236#6\315i\324\254(\260\035\257\233\306E\006\363\020\253\221\265p.\330\2742Xhix\311\334\264hb\262\226\013\001\3036\324\304Z80X\254e\002\3537\310/\276\241\316\326H\nP\333\301\003\372\323%B\030\253rg\006P\033\302\013\375Y\356{?\b\341\213rw\376\357\006t$k-\252\314]mO\371\246\377b\335\335s\310\325\262\3669\242\251\235\0225:eS\307aH\333\261+\301\234\360j\255.\037\351I\021,!\206\306\0047 P\202Q\246\354<b\201\325#\275mY\250k\260{\253\026F|\027\202p\210 \2061\315\212\371\2319\353\272\005\013\220\323\3202,\231\254\2749\031!\364h\253\2760\017\b\031\243$\312\037b\261E\344#c\213\245\341L\326#V8\266`\346\240@\2348F\030"
+	.ascii	"\302\200\016e\326\200\212\2537Qx\203\316\216\211m\374B\254\314"
+	.ascii	"l\\\370n\313\203\027<\312\312\031i\337Xl\316h\020\200\310\227"
+	.ascii	"5z\327\203\002"
+	.text
+	.section	.gnu.lto_loadCustomServoMixer.98.7a57cb9ec02d0b1b,"e",@progbits
+	.string	"(\265/\375`c\002%\023"
+	.string	"\226\344\177I\320\360(\035C\245\177\"X\251)\002\316\302D\366\307\374\3156:k\017\237\200\001\t\273\3574\225\t\324vXx\347\333\376b\254\370\222\\_s\347\032p\341\005\347\305y\353"
+	.string	"\366\200\241(=X\330C\336\031\347\017\262\267\334)\005j"
+	.string	"f"
+	.string	"p"
+	.string	"\247\006>\340;\235\027\360\235J\320-[\307\305\233z\036\016\r=I\265\326pm\034\340S\274\251l\375\243se\313\337\371\001\3358\243\271\376\315\035\n\022!B\223\315\223\232M\215\213\22704\230\24493\237\363\004\2473B\204\026\233\313\303\003\002i2\271\027?\222\033g\264\231\313\017\006\265V\313\031\255\303\375q\333.\333\rl\031\023g}\376\211\367\260|\034_x\221\237\235\372/\337)\335\365HBz\311\321\026arm\366M|d7\27456x\335=WzWZJ\351\207"
+	.ascii	"h\032Z\320\2535fd\252B\264\005\211\353~\373\353\202))\303M\030"
+	.ascii	"D\246I\247\326\n\332\277\371\242\301\323\343\236k]\347\237\223"
+	.ascii	"\213\303\211\307\333aTk%9\365\310))\005n^`\320\021\301\204\340"
+	.ascii	"\345"
+	.string	"(\201\230k3\312\367]\355r\304\344\222\355\007g\201\342\200\306F\355VkL\301w\266\313W\244|\3446\340\314\270\325ZM|\336SY\371N\277\027\217@\206I)\267CG8\036\2736\333!\322F\267\214\217\344\277]EJ\344\246\326\327g>\212\247@\3718\247\226\220J}\247\266\312\202\374\314\262\007CH\266.;fA\335*%,\225\313j\205\025\266\260D@M\200\020R@\245\244B\225\025+,!`U\205\225U\330\242R\255BP|}k\276\363So\024z-\214\350[\233AJLp\267H\222|.\214\177\276\271\317\355\212br\351\263\326Zi\202\317\005\367\036r\343.\215\317\216\316\372\344\356^V\203\311\3211\344\2064H5\334\207\227\034}\236 \240\237) \220\002\2412\233\007\n\267\"b\315E\234\277\267\343\335$\004\323\374F\361\320E\214A\005L\315\356\263\225\327\013\005\326\354\371Z\\p"
+	.string	"w\320`\344m"
+	.ascii	"\326eU\352u\2323GS\214\340\226\205\007D\275\236\224u\225{\335"
+	.ascii	"5xiI\016\273\026\374V\276\020Uf0/\330\002\216c\"\202D\347\242"
+	.ascii	"d"
+	.text
+	.section	.gnu.lto_servoConfigureOutput.99.7a57cb9ec02d0b1b,"e",@progbits
+	.string	"(\265/\375`\245\003}\032"
+	.string	"\3460\253H\240\232M:\234\347\321\315\321v@\311Lq\362\260\236\352\267\023,\2145d\f\301)\177X\\\215*\00456\3559z\365\276\256+\372D"
+	.string	"\353\2360\t\300')~\344\205\331c\301QeD\377\372\321\232%\204\354-e\222\001\227"
+	.string	"\212"
+	.string	"\232"
+	.string	"\247\b> <\235\027\020\236~\266E\273d\356\353\325c\315H\372\255\251\265\222\315cu>}_\312E\037\305\220\316Xs\321\236\241\210)y\271\217\257z\205\036\2752:\234\240.N\235^X\231\031/i\222\\HL\233"
+	.string	"L\023\024\207SDb\242\242\361v3(\f\fx\337\021S\031\220\247\317\361\351\261) *+\314O\030!5^\365\004A\232\242\270\347\0030*i\356;/\361vs"
+	.ascii	"\023U\371\252\263\022O\307,N\250\265.\227<\247\257\354\273\353"
+	.ascii	"\333]\237\335\246\n\374\222"
+	.string	"\233\201ST\227\256s;\345\310\222\257\376\333\304\325\230#\016\333=\223_\355\326~j_\254\026\277<\335\257V7\215\037\033(#\016\356\372r\334R\273\377\0311Rnl\357\330\ryyvn\365\2451o\316yq\232w6ye\2247Fy\307\311+2o8y)\363\316\346m\346\345\363\276'\300\225/\027\270je\n\266\251]\024\370\343V\337=\222\275ogOr%E\267\332\2551\3274F\301Z\002\253\265\372\234\356\2031\nz\265\326\240}\226k\331\260\034<\360K\017\341\351D\243T#\326b\313\372\273!\342WK8v\254\277\013\242\343\340\322zl\002\277\2447F\034\344\022\372\317\013w+\265\b^[b\377\027\366}?\021\247\034\335N\270\220x\263\245\366\017\352\205\201\305.\024\322\306\355\207S\021\372\351\305\370\224ZOO\n\355\237\036\263{\2006\272\367Q\236\025B\304\b\036\361+\315,\211c\225"
+	.string	"\002\332]\031\177R[\340U\353QP\223;\031\232\237:]\024\266\320\026\236v\003})\221\361.\213[\266o\r\002\321-\006n\210\210\204\221\002\205m\305\t\262\205\255\004\013\262\206#\"!\024\330\233\213!\034\t\343v\303\221\263\255\357\035\333\001K\227Q\353F\003\274k\001\003\277\\\034`\222\261W\233j\255\016\002\030\351\312\261\233\225\360\264\006\213\330 \344\001q\305\005@0\030\364z\2030\247yzy\207C\227\323\257\372\227\200E\302\226\332\034\037s\247\351\230\230\317i\255Dk\234\246\320e\3268\375\2447^f}\340\013\312\210\203\237\265\326J\177N\353\235\276\326\0235;\034\272WQ\221\341Y\237\332]\023\337\242!F\250q \001C\f\032\344\204%B\")h1p\002\031\242+;\020p8\2440\031\016q\004d\233\023\025\b\324\234\325y"
+	.ascii	"\300U\326\255\226\203bHB\231\252\205g\334\221\035\367\2102HO"
+	.ascii	"#\330]\347 \233\030C\251\347\032\225\n-\332,\371\341\224`\244"
+	.ascii	"y\324\367\256(\264M\267\264Ze\326\346\304\005\245\243\253Vja"
+	.ascii	"\326\310]\362<\372\305\343\220\347\247\245\004\005\f\330E\224"
+	.ascii	"7.<\021A\202\024s\332\306\013G\331 \250\002\007\223\377\220,"
+	.ascii	"\001\024\027A\340\271\367\364\270\013\340\301\231\b\372?5"
+	.text
+	.section	.gnu.lto_servoMixerLoadMix.100.7a57cb9ec02d0b1b,"e",@progbits
+	.string	"(\265/\375`.\004U\032"
+	.string	"6\357\245H\240ZQ:2\376\332]\322\325\364\217\347\257\337\353\316\330\254\237\366\322\217\363\256\273\327\225t)v\\\242[\247\365[\337\245\206{\257Z\b\233S0\nF\301\200\327x\340X\005\333\361dr\306(\264{\366 B\366\336r'\031\216"
+	.string	"\212"
+	.string	"\226"
+	.ascii	"*f\376d\376\356I`\347q\022\337\334\313c\027\345\336\273\303\f"
+	.ascii	"\306W\004'`_\351\007\330W\2061\223yOw\177$\304\307H\315\275\227"
+	.ascii	"l\037\226\005\234\366\316\264a\027m\035iO\030\237\350\n\234("
+	.ascii	"\325l2.Rq\206\215 \001l>\224\202T\031\244\003gL\013`\210\320"
+	.ascii	"\353(\364\221v\223\025\036\347\002\224\203V\270\371X\272\357"
+	.ascii	"\363\307&\233tH\320\373\2763\b>\325lA\237\342\205{/\317\232\355"
+	.ascii	"\306\371\346\314\\\204\23150\323\004\001\265W\376\313\276\336"
+	.ascii	"wz\305iIMT\254\233\316$1\323\334\340\252\306i\bA%\332M6\207\314"
+	.ascii	"=\331\354\034\363\017\320\360\001q\343\230sV\347\235q\316\373"
+	.ascii	"U\377\235\307\027\235\305O\266ur\355\311\224N"
+	.string	"n:y\366\344\023\030\020\324\204\341w\257\215\341\324e\252HB\376\373\2138\306\217\270qNF\200D8\302\t\272;\tc\\\ts\240\262\244b~\217\357c\325+3\027q\322(\003h\374\035\355\312\334{u^\371\301\370Z\0033\t\314l\342\\>D\020\336;cz\023\b\032B\204\025\321\007\236\3049\035\341\305\346\260\217\246\311\2215\265s\374\261q|\203\244s\272\241\246\316\305\376\021pN\262b\237\247\004j6\245N\357\275\227\212\235\323\027\n>\375\312\231G|K\231\341\247%\213\365b\3002\223\270\225\262\1770Q\252R\200M\355\f\3132\363|\n\253\247\214\220\244L#aT\354\245e>q(e\005\346\242n\022\276\204\231\305\237\244P\001\2511\004\265\273\367R\b\336\311\n\376\320+\267Z\314\007\214\242<\fV\211\236\2622\217\203W\353\205\213\365\"]\2408Q\2520A\366\224$V\220<\256\027\351\240"
+	.ascii	"\267X\260\\\244\213V\313E\252z\261\023}\234\202\203)\3262\261"
+	.ascii	"s\274\302RW\335P\243\316\307\261\355\322lJqm\333\327\3601\033"
+	.ascii	"v\204b>,\320\205\251\275\003f\332\224\246jv\354U_*8\244\335d"
+	.ascii	"`^p`X\217\035\267\335\020\337C\023\346\236?}\241i~t\304\346\220"
+	.ascii	"\273\337\264O+\"\236\263\330\331\335\247\021\031{\266\310\306"
+	.ascii	"\247\rwx\027\017\026t\367\006Q\250q0\204\224Q\304\030ED\204f"
+	.ascii	"f\013\323\001\320\002\231\242\255\003\021\2205Cd\264\304Zk\f"
+	.ascii	"pV\305:\225N\260\347\302\021\223\300\027#\272$\334U+\230t\021"
+	.ascii	"\0013\002z\347\372\035P\347Lq\353\204\rX1g\n\274\270\366q\371"
+	.ascii	"\364\333\334\331I\207Q{#rc\306@\262{\f\207\377\306\016\033q["
+	.ascii	"\b$\375\276z&\223p$\321\027\377\265\021\223W\274\3451\346Ga\375"
+	.ascii	"\200\215\252\370b\202\0345\344\231w(fi\020\321\022v\301\301\275"
+	.ascii	"zP\331\306\276\031?\347 L\254\353\021P\027\330\223\201q\334\220"
+	.ascii	"\232F'\025\376yvB\237\006"
+	.text
+	.section	.gnu.lto_forwardAuxChannelsToServos.101.7a57cb9ec02d0b1b,"e",@progbits
+	.string	"(\265/\375`\335\002=\027"
+	.string	"F\255\234G\300\330*\035\231\363\371B,l\333\277N\345\032\360v\202j\224\001(\340%\252O\233\377\022\325f\nm\377\254\277\375`\027E\355D\267\224\357\004\273\356\301\377|\341\020C\t\377\242\003\233\356\2126\365\343'\204\354-e\222\001\204"
+	.string	"~"
+	.string	"\211"
+	.string	"\017r!\264\227\373\204\354qA\372zAa\2555\301\351B O\r\034%\236\316\237\304\323\335e\336e\320\200v *\266k\345iYRk\271`\021\220\247K\333\365\362\322F\035{IrE\304\324ZS]c\001|\226\337\311\264\323\331L\333\007\375"
+	.string	"0\213n\327s:\307[\213\034"
+	.ascii	"v\267\211C$\034\372\357\354\263\263\361\334\361\363\376\357\b"
+	.ascii	"\200A\335\356\347<J\250\265.\353v/\276\342w\327\265\273\034v"
+	.ascii	"\233&#\3668N\267\304\213\257;\335\277\304\323\367\350J\2261A"
+	.ascii	"j<\334-m\334@\273\307\261A$\334\246\261\213:\220\377\024\200"
+	.ascii	"ym.\364\2551\335\367-\275\374\222F\336\231\221w4\362\222\314"
+	.ascii	";N^q\362R\221wR\336f^\236\274\027p\352a\005\303\227Z[\f\311\324"
+	.ascii	"*tH\307}\277\320_\276w\377\363\375\214L\271@~\310\236\210\320"
+	.ascii	"\354\025Wg3zR\204\265\226\025\310S~\320\2226\343\0170(\200g\217"
+	.ascii	"\275\273\241\003_\267\006n\335\263b\217\247\246-\366q\274R\323"
+	.ascii	"\236erE\335\263\017\304\tk<\344\271\023\017d\255\025g?\364&\037"
+	.ascii	"@\344\344\210\247\335\021zC5\036\256\202\223:@\377w\n<\200Qp"
+	.ascii	"<\033\017\273\177Qn\273n\240}\"r\333\364q`l<\334\232\346\276"
+	.ascii	"\t\243\363\340\214\241h\001^\211j\265\263#\236\326\364\211|2"
+	.ascii	"q\322\305\307\333\324\007\346\212\266u$3\262\326\025\016\366"
+	.ascii	"F~$\262U\214\305\312@\n\221\303\262U\214\305\312@b\345r\351\360"
+	.ascii	"\250hR\254D\270,h\220\305`-\226iU7\261\027\n\330*\226\222\361"
+	.ascii	"\354\264H\260R\256\226N\211\224\n\026K\335\024\330\227\211\025"
+	.ascii	",%{\275`)RY{\323h\342\243J\255m\264\201\366\301\215F\365L\006"
+	.ascii	"\217\023\274\324>\377\375,\266\310\310\021t\022K\214\"65\251"
+	.ascii	"}\366'\304\231\236\300e\005\023\355\250\311\236\351\001Er0H="
+	.ascii	"j\002\300\334\017\233.5\331\224J\256\207\215\207\237\265\326"
+	.ascii	":\025\274\324\250\0161 p\002\241\272\353\235\322\356(\262h\376"
+	.ascii	"y\241\266\363V16:\222k\177\250\306\264\006\325\226\203^\325U"
+	.ascii	"N\b\344u\264\252\353\354\013\376\017\317\262P?\032\340%\361\220"
+	.ascii	"E\331\265K\350\3550\331\300\204Sy4\036R\002\365\253\300\006\243"
+	.ascii	"\255\241fO\303 \234\353\030\325\t\207\204\256\334@cTK\350\214"
+	.ascii	" \343a\202{Q\212@[\250\307\357M\244s\231'"
+	.text
+	.section	.gnu.lto_updateGimbalServos.104.7a57cb9ec02d0b1b,"e",@progbits
+	.string	"(\265/\375`\301\0015\017"
+	.string	"f\\cD"
+	.string	"\221(\035-\377F\333\224P<\\\320TFq\023\245\r0\273$\017\313dS\275O&DP\256~U6\354\263\003H\331\355\265>\323\3742*\b\b\372\006\237\330\222\362Q\222\371\300\337\330,!{\023)S\nK"
+	.string	"M"
+	.string	"S"
+	.string	"7\341\007/\227\335\335\016m\023{;\314\315v\246}"
+	.string	"\301\351/'\326\335\225\031\027\273\037\310\006\264C\237\354\032\377Dl6\202\207\nF\307\356r\032\342\247\347\311?\353\234\225\n\3123[\260\273\316\225J\207[o\233\200m\005vB\b\377^ GM\t\027\246\327N\f\r\325\013\2257\366\227J\005a\037[e\261\263\364'K{bz\203\351N\226\346di-\2463\230\216\177\371\261L+\226\316L\037@"
+	.string	"\233\031\rd\354r\270\261Y\032\350\"a\373-\3545\363\023\377L\002g\035\272\304\330HYI\345\215?\332\342+\034\007\211\036\375\350U\036R_q\026\021\374\026K\020\021\211\207\036\205,5;>|\344\246W\377\013\211\362+\017\330\240(\356\350\246\240\224\033Gq\025$\332\356&\360a\236b\344\267\034\332\002)\277\"\305.\036v4\032D\024J\03080\225\274\321\310\207C!\245.\203'*q\246\n$\243\013#\\\311h\002\211\013y%.D\200;\f\"\2173u\235\307m\037\352\254k2=hP\2322'F\036$j\312\201\241e\252\352\267\242f-\373/.\343z\324\267RUA\252\327I\30445& \260\002\031\262\351\001G\02494\030\251\314"
+	.ascii	"\326\205\273\330iyS\030\\E\216\31173.\326v\302$Kd$\266)\0173"
+	.ascii	"\270\nxLj\317\240\345\251\335/\272\343Y\273\320v\244\333b\270"
+	.ascii	"\n\354Z\0069\311ng+BF.\t\2605\225o\016,nq\255'"
+	.text
+	.section	.gnu.lto_writeServos.105.7a57cb9ec02d0b1b,"e",@progbits
+	.string	"(\265/\375`\331\025\245V"
+	.string	"J\217\354\036J0R;\031\016\340\206\363\266\224\223\276\365\rlg\260\337\307\231N\312\353\224\270bz\343\\\244V\370\301\n\2655\363\276]tp\244\236\352\241#\331hgq\036"
+	.string	"@\335M\307q\005:9\356\370\"\237\364\033a\333M\366\336R\246\024\332\001\257\001\367\001j\245R\235d\244F*\325G\242\0328\252\177\245\332\364\251\215Ju\351S\373Nw\217\244Z\274\231{G\265\212\352\277l\352L\035\216>\347\351d/\321I7\302u9\335\217\347\227\373\315\\\264o\021\336\203\177|\336\306\330\267\263\353\330\300!\233\323\343\2553(\217\237;<x\353\344\371\031\177\207\307\335\316\360r\256Sz\225\225np \223w\236'\002\345G\022\017\222\037\3057\221t\350\240\301\311\311\211\213\263\007\355\215\017n\344\332\004\201\366&\267\246O\232\021\020\332\321\334\315\376y\204\237\361>\3013\364\321\036\301\376}Dz\233\1776"
+	.string	"\201\341\315,)\3175\037\033-hy\347\351v\365\321&\312\217C\033\357nX\316\343@&v\203\241\363<\2616\206\262,\243H\2224-^t\273\223\304\341\251\246\244\242\240\236\202NMLKJIHG\300\237iT\372\310Q\\a\225\016}_\326\035\24213\257S\225\371T\23162*%\372\232\224\361\271]\031\233\270B\b@i\257\333\242Qc\016\325\345O\242\211\2749\204\202N\270\214\335K\031\027\r\332\225u\231A\235\306\274\311\312\231\2263\211&\252\340Q\341veZ\304`\335\013A|I$aW\226E\006U\022\201|\276\244\035\020\345\r\237\347\251\242I%\256\234\261p\2444Gn~3`\234\237ht6\307\206\333\225a\021U\374\341\202\346;\274\204\227\262(j\372\262\256\234\245\335\350_X^\302\375fV\316\320\356\363e\321\371"
+	.ascii	"\206h\260r\206\345$\224\217Hfa%\250\3703\013\023I\264]\233\230"
+	.ascii	"1\321M\273PYxU\033\225)f\304\244\230f`dy\236\347\255\224a)\325"
+	.ascii	"\227u\236"
+	.string	"\247u\314\354\354\026q[\215\330\266\300v:\n\256C~4z\222\303\030A_\272\347\367\260&m\254\"\257\366m/\t\251\271\373\253Hq\257\326*\206\006\246{\266\226\240aK\374-\236AC?Fc\317&\013\332\227\356}\331\230\360ETB\352v\251\361\303D\365\f\245v\r\033\3721\335\244\2702\277\373\333~\003\f\235\227*\332@\277p\325\020\335Y^\252\310\177\225\325\313x#\0349\251k\221{hQ\327\"\023\371\212\2147\n\n\036\362\365\234\360\020\362\013%\301\031\302\027d\274\021\217\034R\236/D\251\345\217\217'\266Y;[\360\343\003a\274\362\327\"?Z\307N\262\264\265\037l\343\215\211\320\316\323\353Ut\354\034\340\343\367`N)\272\310Mj\347\320\241\037\373\"\305}\331\3614%Im\037[\3721k\234\024:\260\365\262\335\300t\325\354\257\020\"l\315\013\203m\252\225\230\352$\246\032I\251\356\372"
+	.string	"\250>\362Ss\231j#\246\272\bPM\344\247\366\300Tw`\252\207"
+	.string	"\325B~\352 \246\032\210\251\336\002\252\177\374\324>Lu\017S\315\003\250\346\340\247\336a\25270\325:\200j\r~\352\034\246:\003S\215\001P\215\343\247\3262\3257L\265\r\240\372\202\237\272\206\251\266\300TW"
+	.string	"TS\360S\3230\325\023\230\352\031\246Z\202R-\003\250\216\340\247\216a\252!0\3250\200\352\027?\265\013S\375\200\251n\001T;\360S\2630\325Y\246\272\001\240\232\201\237z\001\005\022PA"
+	.ascii	"V\n\024\244\372j\304\361\310\335UB\252)\251\250R\r5\252\237J"
+	.ascii	"u\020\250v\372\251\233L5\223\251^2\003R\213B\304\032\355\363"
+	.ascii	"\\$\243G8F\315\nH\035\3549d;X4DH\232 +$\r\"\275 \3734F\f\025"
+	.ascii	"Y#\204\212\020q\363`\211\270\r\021\310\203\275\233!\266\243\f"
+	.ascii	"\362\\8\006\233\001\036\0068\026\305}7Z\213\303\r\020~\264\366"
+	.ascii	"n6\370A\274\025\251c7\330\243C\203U2\367\333\344X\r\332\330J"
+	.ascii	"\247vu\232c\337\246\207\236[\221<\266\307\035\036\034\274\355"
+	.ascii	"X\016\336l\215S9;\337\261\177\003B\307"
+	.string	"\212\334Z s\266~\254\361\261?\326\330\372F\343\300\261\217\375\232AR\200\253\346f\205W\260\026\264\251\200\20284\226\20287\254\241\261\217s#\215j\271\215\275\341f\343\20275\366\2027mfj\354\337\004a\307\354\267jNJ3\"`\237E\f\027\241\222\035\022s\306\bk\320\227&B\223\225Uf\rj\374\274\200:/0\363\304\253\226\2001\320\035;\023\3240c%\330\t\300\314\330`\0264\031+\301^l\221oO\\\306\036\211\263\027\226\b,\202-\327\277\023c#\270c\037Q\032\326b\354\357Dm\271\377#\266\350K\310\250\305\332qPX\225\252\365\355w\270H\346\316\234\330\242/\335[\023pyT\214V\355A\031\274x)\037\230A\351Vd\213}@\206\026\016\354\211\373p,\326\0018[\3254\206+\"\213=\034\004/\224\267\"a,\004-\300x!\307\305\276\220c\253\024\2452e]\354\345"
+	.ascii	"2\343\354\370\2626\312\307\002\221\270\025\331\300f\355\305T"
+	.ascii	"x\242P\206b\206l\3032\3032\344\307\006v\204\241\320!\264\022"
+	.ascii	"\312\300^\335\2473D\303\202D\t\353\345\005\226\201E\021\226w"
+	.ascii	":\266\226\351\231\213\322\254\005\371q\201=\235\013 \250\020"
+	.ascii	"\033\334\227\356\221\253\346\202\264\255c\212\202\213 \226\363"
+	.ascii	"<WX\311\364\004\030\376\226\217\216!C\006\371q|\0262\344!l\375"
+	.ascii	"0\022\303\264\217\024H\270@\350\332B\202\225DH\220!D\200`\031"
+	.ascii	"\031\302\243\b\226\217.$X)\250\314ud\253\013+\t\027W\027\326"
+	.ascii	"\317\355\353h\350\276\026\214\352J\241\242|\260P\242\227\273"
+	.ascii	">b\213\230\354\346n\230\212\022\356\007Ov;\317'\036\304\320I"
+	.ascii	"\255\232_w\001x\200R`\3354\356\210%3\024\325Zl\332\025\216\371"
+	.ascii	"\b\355\002\246\313\1771\312Ih\206\231\203\367\224\300Z\f\n\227"
+	.ascii	"j\311F\254\002\373\272\213z?\314)T\tu\332\340\332\302\r\n7\201"
+	.ascii	"\025\3774\255\323\376OX\036\225\235\322\264?>l\330\340\334\203"
+	.ascii	"\023B{\236V\315\037\212!\231"
+	.string	"vkXZ\245e\332\213\241m\224\245=\233\273\244U\032\261'\236\264R{\256[\326\254@\t>\212DZ!\0301C)\013eH\205\0040kU\314\234'\023\025\367\341\311\220\205Q\317\211\017\200\314\234\347\271\342\2437\205Ua\350\302\360\205\241Z\f\344G\244\275\335\261\336\336\330\316494\307i\325\254KW\177\335\313Cs\3160]}\\2\213KS\253L*v\227\314oZ\024>\265*\026\307\334\336\225\036\255=\3242\234\201\311zyj\217\326\200\271B\0014\271\002\004\323\252y\274\026\t\\\325Ss\307D\365\200`\354 :\332\222\230$\265zW\246\nP\374\022R\225\355\026\315\250}\230\270R\277\204\324\2730MH\345\362\251%3\330\177\333\303JI|H\003i\017\277\f\303\350\307~?\301\016\":&}\256\264j>`\f)\305>K\033\227*\024\027\261d\207\332\316 \241\250R\266K\371D\230z"
+	.ascii	"\274\351\240(I\304\246x\261\246G\311\232\220d\221\254\222\rK"
+	.ascii	"\322\265H\214\366\304\273\216\254\271\376\034\327\036\231\263"
+	.ascii	"\211,\330~q\355\347\244\326T.\017\201\265\250QL\004\231"
+	.string	"24\"\"\"I\222\2445\321\005\304 \245\230U=\021\2600\206\024c\304dFAAA\222\f\273\001\214\375IU*\004;Q\202\n\024DL\237\367no\320\234\213J\346\034&^\002z\306\315\212\377J\031W;t"
+	.string	"\261\227\262\016\373\365m\\\245\271\227\217G\364\344\263I\016\3031a*\233\355g\025\250\247mY\007VU\005\202\2076\217\311B0\036\354\303c\tD\002&\341\311\021V\342\007Y?\336\230\306\275K"
+	.ascii	"h\243<\004e/W\304\356\266\217\240\264\310k\005[\376\035\341j"
+	.ascii	"\267\r\332\367\360\207\375P\357\006XX\320\223\345\364\307Muu"
+	.ascii	"GY\325bM\246\006\306'\360(K\312b\203\023\275P\304Q\256\037\357"
+	.ascii	"\365\013\024'\215&\370*M\300\322\2048\223\252\035$\n-\035\306"
+	.ascii	"\313\314k\365I\310dU\252\032\021\320\033/\232\235\223\245\317"
+	.ascii	"\311\260\227j\341d\253\240>\357\030\234\214\177\247\343\371>"
+	.ascii	"\365\361\246\260\364\361y/]\340D\314\267\233\351\006\0235\020"
+	.ascii	"\326\323C\316\017\035h\267\257\227ne\216\347\367\231\371\022"
+	.ascii	"\331\275\017\203\362t\020\260\337Fm\025\345\213\233\234\007\365"
+	.ascii	"R/\235\300\260\335Fm)\352\232i\030\271\373\367\352\r\201\221"
+	.ascii	"&a\300\366f\321\234\273F\301"
+	.string	"\324\272o\261s\362\021rc\300tk\346\021<\\ \340\324z\013\214\361\337\2277\242\342\340\344\340D\377\234\032\211\036\031u\263N \270Mt\245su\356^\024E\320\274\001\367\252\017\373\271\003X\310\353\003\227\003T\307\020\303\257\203S-YU1\345\233M\370\266J\202\021\230[\311H\372xG\330\202\232\324\375\342f\275\337w\t^\210\313\257\213xf\357{\301\335]\004\255\357\243F\361:\377\353\024\254tB\b\224IL\373\rc\312\b\245\221\221BB\270\30317\324\342\n6\031\236t\367\033\330QF\343\034\001l\"<\036\317Jo\205\332\275U\022\035|\224\215FX\254\032\363\250Kms\321\f\002\200I\320\231U\267\322\373Z\360/\256\255\276p\235(x\036\023\250\003z\003\244\306\344w\262z\\@\227\231\002\f\277Sy|\r\211N\2044`E\200\272\036\226G\271C\3738\002\331\207b\377p\001_b\256"
+	.string	":dP\341$\020y-\246+R\321\256\226\272\210\037U\\X\252\310\240U\006\275\030E$\330\321\004\024[\241j5v\324\262\223Rv\335_>hIm\267\013\334+@"
+	.ascii	"\r8\305\330\001\235\344\026&\\\232\250\277\233\027\035\037E\037"
+	.ascii	"\035\272\214\0045\241[oDh\357\214\220f\201#&_Y\177Xp\203~\033"
+	.ascii	"~\250H\271\223+\"\215sCc\261\377\323\320\227\007\276\3300\315"
+	.ascii	"\031\003F\023%=\321h\272<\323\231\251\366\322\351\334\246\016"
+	.ascii	"\365\312\326\207\240:\323\274\271e\341\267\f\337.\003\227\235"
+	.ascii	"\231i\033\321g\337\271\252\231\03236\245*\324\324>\324\337>\277"
+	.ascii	"$\264\032c\231\242\006"
+	.text
+	.section	.gnu.lto_servoMixer.106.7a57cb9ec02d0b1b,"e",@progbits
+	.string	"(\265/\375`\177\036-\206"
+	.string	"j\335\\0H\020PKg8m\217\233E\003\330\006\352\222"
+	.ascii	"\347\375\302\3244\210lt\266lA}\216\301x{O,7\f\030\332\273\202"
+	.ascii	">\\D\372\347\245I\223\343\345\274!\247\205q\201\353ZQ\037\352"
+	.ascii	"\331\256\267\3314=\021\021!IJ\031\350\002\300\002\021\003\275"
+	.ascii	"\004\244\275>\216\275\003\034{\005H{\223\322^\244co\217c/\217"
+	.ascii	"\264wG\332\253\343\330\233\243\330\033\300\261\027G\332\013@"
+	.ascii	"\332{\303\330k\303\330[#\355\245\201\366\316@{\217\322^\243\264"
+	.ascii	"W\006\332\033\003\355-J"
+	.string	"{\211\322^\030\307\336\027\307^\027ho\213b/\013\264w(\355\025\362\351\rJ{\201\214\275?\306\336c\332\353c\354M\215\275\306\264\0275\366\026\215\275+\322^\242\261w\230\366\n\215\275\301\264\027h\354\375\241\275G{\273\330\313\234&\003O\034\026\334\326\325\312\236<+\034 \233\030\236c\216cNcVc^cN\202\231\r\363\031\363\223W4;\271\270\313\305.j`u\373\247\022rxn\231\356\211%\216\263@7\270\245\345'\266\270\304N0\255\241\313A\203a\234\025\322\275\301Y\003\303c\240\356\t\267-\021\355\354\255\310\\c&\330\315nq\235p\333\372\2709y\302n\373\033\334\226\317\270\315\356\f\334\266B\2726\260u]\323,\033\301G0\022\314\306Jl\221\315\323\021\324qU\336Qy\255+\331\021\037?TN\342i\270z\t\323\304T)\262\006e\255\006\274u%C@\ry\024u\\\245\254\330"
+	.ascii	"d\310@5\274F\3454\344pEbH%\306\212\217!\003\217\315AA\264#\251"
+	.ascii	"\343*%f\212\327\f\273E\006\3562\331r\031\032.B\345\347\266\r"
+	.ascii	"\241\252\206hj|\002\f\031x\364#\362\330\0269\214\305TvF\031\256"
+	.ascii	"H\030\t\002\f\336\272\256;\030\270:\206\fd8<\024d`\021\007\005"
+	.ascii	"\031\250\356J\301d\\+\253u1\315\360\254\353\232\364/3\216G\242"
+	.ascii	"\035\362\217\214\227\370S\231\306\214##\0311\212j\020\301x\341"
+	.ascii	"\242\005\213!\241 \240\237\243OjD\213+l\020\207\302 \360\367"
+	.ascii	"V\227\307\230\006\037\335\224\025\024\323X\003'\254g\250\341"
+	.ascii	"# :.\243\"\332\226:\\\256\322\260\214\261\257*g\307\220\253\032"
+	.ascii	"\243\023\353\"5\\\343'\224b%\f\313U\245\375\202\354\341\2611"
+	.ascii	"Z\016M\264uu\206a\274\020\016A\343\341\235\273\251:\\\256\314"
+	.ascii	"\260\0130n!\306\rX\263`6\353p\271\n\303CA\264\t\323BA`\030\350"
+	.ascii	"\247#\353\r\007\226\253\372\3417\024\247K\024\374\006\246\177"
+	.ascii	"\200\350\352\243\017\027\017\235\n\207p\271\002\202\215YJliT"
+	.ascii	"\256\252\371;*\262\\\225\016h;\364\n\216:\3036~B\033\252\346"
+	.ascii	"X\256\312\210_\220:w9p\031\317\370\252\302j\342\214\255+-<\344"
+	.ascii	"2\006\006\301W\207\313\225\026\026f\341\340\262\201\251\025\363"
+	.ascii	"w\264\256k\321JJ\377VXe\341\377\206\254\204\231J\255\244~:\360"
+	.ascii	"\222\270\303c\334TV\312n\341\220u]\267\247\254\256xo\360n\227"
+	.ascii	"\355\356\226\335\"\240_\324\256\256 \003\211\356C\004\235\236"
+	.ascii	"S\bc\350\305a\270\370\213\003\325\226v\200\356\342\034D\021\307"
+	.ascii	"\354\373\261\275Y\013^\253\305\207\336v\3177\026o\241\202\351"
+	.ascii	"\034\324 \206\353*\005d\033\253\265\250b\204P\307\214\t2\220"
+	.ascii	"\305Ym\216S\350Cgf_T\357Aj,\310\306\241\257\250C\250e\324f\363"
+	.ascii	"\224\332\f2P\350@\272\230\250%\226\005T\n\006\275\211F\037\255"
+	.ascii	"\254\212\005w\325\261\006\232\247\202\2366q\005\216\324\241\026"
+	.ascii	"\350?\007\372\217\316\361?\027\302\325\260k\006t\025\"IT\307"
+	.ascii	"\033\347\342\364|z\244\367\371O\217\361\351\205z\230\273&\244"
+	.ascii	"G/\211\024\300\325R\214\367\331\212k:\321\342\3215\036\243\305"
+	.ascii	"\b8\353\272\277u\215\252\261\342\305\013\351,\277\224\0174\324"
+	.ascii	"\256)\300\265\256+\220^\211$\325\365\361\036#\022\0349\022d\340"
+	.ascii	"\212\373,\337\3509\201\326\354\235\371\021?<\361?:\254\307|{"
+	.ascii	"\333\026d\340\360\306%\\S\330#x\341\177zz\360\235\274\340\215"
+	.ascii	"[ozl\300\217!}\270x\312\316\357\300\377\362\226o\242z\017\017"
+	.ascii	"\266\263k\303u]\203,\343q\235\n\226\201`\340^\220A\0067byk\262"
+	.ascii	"\335x\263\216\371\265v\315y\214\207rO;\251\336\333^\031G\220"
+	.ascii	"\317k\276\315\304R2\024\034\005\224e v\203\016\232\247:\b2\220"
+	.ascii	"/\334rkbE\365\236]2e_k\227\203p\355I\261\367\262\273FM\232\263"
+	.ascii	"\262'\231\223\323xY\214\325x\215\227\317\230ir\022\274\f\306"
+	.ascii	"lx\271\f\031\241^\366\n\023\324\313`x\216\227\273~z\371\213V"
+	.ascii	"\027-\034\307\313U\370\214\227\251\370\311\313Si/S\231\302<\366"
+	.ascii	"\362R\n\332\313Rh/+\321^\216J{\031\n\355\3455\250WE{\223?\275"
+	.ascii	"Q\322^\032\216\2753\034{e8\366\"\323\336\030\320^(h/\fh\357S"
+	.ascii	"P\257\023\332\373$\355mB{\235\240\275/\240\275L"
+	.string	"io\023\264w\t\355u\001\355m\001\355e!\355e\202\366.A{W@{U@{\225\244\275I\320^$io\ni\257\022\332\213\302O\357\t\307^\023\216\275%\240\275$\240\275#\240\275\"\004\365\206p\354\005\241\330\373\301\261\327\003\264\267\003\264\227\003\264w\003\264W\203\240\336\f\212\275\030\244\275\027\024{-H{+@{)\360\351=\002\324;\001\332+\001\332\033\301O\257\221\264\267\310\261\227\310\261\027\202\264\367\201\264\327\201co\003\307\336!i/\003i\357\002\307^!\307^\005\322\336\004\322^\004\216\275\007\034{\203\244\275\006\244\275@\216\275?\216\275\005\244\001\033gE\256\b\237$O\341\374\005\226\004\311\201t\230}W\310\241U\n'~9\242\311\226*\335\n\322\3505\334\206d\023-$\341\340\332\246\3548y\f9T:\221-\n\354(\234\277\364\334\326\311\203\231\322\330v|\302\231K2\356SO"
+	.ascii	"PQ\2257\246\234p\242\233\021&\234\305J\270\t\347\245\027\t/\341"
+	.ascii	"Q<\302I\020\341\033|\204\007\345,\277B\270\bq\276\224r\251\020"
+	.ascii	"\364\234 \234\303\336t>\270\007\007\341|\346\037\234\227}\035"
+	.ascii	"\334\203\2770{\202\203wp\027mK3\033\\\203sp^~)\317|\203\007\345"
+	.ascii	"0\3732\270\006N\034*)'\251\356\253\252D\342\332\223\301\213U"
+	.ascii	"\240518\363\316[z]p\f\350ZO\022\212\377\020\227\207\357\202s"
+	.ascii	"[W\005\267\340<\247\365\222P0\205\221\311\n\3437\273\311\271"
+	.ascii	"\306\223\244\323F>\344y\256\205\335\351*\222w\311:\311)\222y"
+	.ascii	"A\006Vp\003\346p\231Sp\306\302s\307\354\253\242\251x*`\nU\211"
+	.ascii	"d\007\354@\267\263\2463\251\327xO?\270\356TeR\235\024\\\346\254"
+	.ascii	"\004\337p3\323sv\236\261)&\332W|\344-\305\323\316\201\236\340"
+	.ascii	"\273I=\311=\315SG~$\301'80\217\331\027\301%x\021\035#\217\340"
+	.ascii	"Ef\314>\306\"\346\316\225\342S\320\310\233\236s\244z\017\252"
+	.ascii	"\347<\331\250\353:Ui\024d\256\351T)L\225\n\225 \003\215\234\321"
+	.ascii	"8G\026\263\246\363hnR\254V\\k\331\306\275\254\320\315\220\323"
+	.ascii	"\374v\302\035T\273\346\344\275*\252\250\020\257\305S\3474\227"
+	.ascii	"\341.n\231\205\f\356n\024\273v\002\351\303\025\247\345T\252\032"
+	.ascii	"T+V\312\370\306V\037\030\025Q"
+	.string	"\275\347/\342\210+:\f\213\304\025\211\274\b\004'\362\300!Hk\270\267\007\364\034p\263\242\201;0\344\r0\360!g\275\204\033\003'n\345i.\320F\024\362\005\024\270\220\004\256"
+	.string	"\232f\303\226"
+	.string	"\002H\f\0178\002A~\200\001\017\322G\250\031p\342V\025M i\302\274\037\007R\300\177<\370\002\324\244!\340\304\271;z>\316\202j\003\334\207"
+	.string	"\037\340?=I\027\240\313\236I'b\271\323DB\003\204\353q$\036\357q \334\322k\307y\2149w\234HD\236\036\233\216\260\337\333r\\G"
+	.string	"\307\361\034^J3\315"
+	.string	"\016\004\200\343(C\004"
+	.ascii	"'n\3455\331n\334\306o\234![W\026R5n\343B\263\245\227\262\277"
+	.ascii	"\332\253\205P\255"
+	.string	"nP\257\\\t2\260\306\213m\3504\331h\2041\3168\215?\257\265\270\275pw\341\346\302G3\214~\364\237Y\226\006\203\024\302\365\203\332\345G]\227\321}\266\242h:e\364\027\036C\032\271P\336\266);1.\343\327C@\237\n\032\252\244S\234\340)\372\256\252\203\272\245y*\306\177+\326\241\226\350E\377\2511\373\242T\036\272\007\244\220:\325\207\346A\355\002\204\201\333[:K\325\n\273\004\351\311\022'\245\245\244&LKKLH`\354\222%\246\246\"I\232\224\24041\025a\342\300\005%M\232(-A\"\344\244d\205&%\247\340\022S\223\n\277%NI\230@9\241\330\204\311\322cPZ:\023vzz\241\t\023\340\"Az\302\004C\223\222'INKV`\342\202\nIM\230(-%!iz\222\204D\264L/(iJrbbjJ*\222E\361\275\254\tzp\242\256\334(\277u\345\302"
+	.string	";\231\307\370\007\257\b<\032\327Z\241\233#&\363\333\325\330\301\\\245J\213\021sB\207\031\327\332\006\"\317\006#\326B\004\233\342\215\f\356rVs\252*g2\227\201\217\3127\r\351\303\265f\312\231\312\2319%K\251\346\314d\251\363\362\027\306\347\306\354;J\242y\232$\024G\266\3640\007\355L\313\211c\224h\302\215e\2513\332(d^\366'w9Q\353$4\357\230}+\307\006=O\031]\347/\357\276\347\363h\236\206\037;Y\322,\211\226T\223T\363\345\3546\247kL\032Y\214k\355\036f\nr\327]\3540\305\323\256\353=\267\311\264\207%\327Ne\207:\2733f\346\300\234\351\370'\304\rjMV\236\245\336mK3Q\254|\020n\371\005u\216\002C\016\313@]H\027\233z^\337t\324>Dr\215\004\261'\344v\243\314\235\314\230\344\235z\206\303;\320\336\364\300\024\341\325\270\227-\376"
+	.ascii	"\203\317~;\033;\250\250\236\374\003Q\236\274\327\205xJ&\221d"
+	.ascii	"\303&\310\300(o1\007\353GDu>;\223\301\203\3267\300\270\326\023"
+	.ascii	"\034\006\031\203+\bF\343v\212ye\205Q\261iY\370\246^\264\350\263"
+	.ascii	"\033\026N\316N\032\016\0069\304\365\303\f\247A\206#?\303y\231"
+	.ascii	"\245,\273\f?\034\263/\206#\271\220\303\177\211\341C\316s\230"
+	.ascii	"s\331\235=\267\345\227\322\305\013\207\362\346\253\222b\266\270"
+	.ascii	"\326B\3012\304\203\271\rO\300\024\303\\\023Bb\016s*(n`8\0243"
+	.ascii	"O\177r\030^\324\266\374r\372S\333\265\222r8"
+	.string	"\017\227\027U\311w\352\336\305\351\234\247\313\331\364'\177a\346C\017M\347\270.\266\250\260;\021\373\013\300\275=7&\213kI\r\335K\322-\310^O\341i\307d^\017\2661\261\314\234\233L\347\301l\346A=\313<\3126\233d\342[T\261\b\266\200-\361\035\256C\362\216\3330\331\271\r\347P\2725\235L8\350\332\224th}S\204\256\265!l\001\235\330\003\023P\\\356~Z8?O\265\333D\013\326\363Mr\320\255=\351\320\202n\364\265\242\001\272\326.\275qc]\311\303\325\204\023.\234\205/y\271p\"\265\026\316,\354IB\253\343\303\317\001a|\3177R\275wdr,\310\033\\WX\312\231\b\345)\371\222\263\224o/\251X\341*|\311\201f\313\254\023\276\302\211\324R\270\n\347$Wr\366\322\273\013\202v\250\342\030!\020\222\026*D4\"I\222d\230\003\362\n\020\b$\201\332by\003\022"
+	.string	"u1H\223\020\225\2204)(\244\003/\202\340\034w\310\316U\362\203i\001\252\246\377\322$\0023n\237 \357\207\321\330"
+	.string	""
+	.ascii	";R\205\344m\354\373\252^I\310C\037\3712H\026`\302\036\213\037"
+	.ascii	"\344\202\2224\004s\306W\274\327V\033w\304\307\376f\321\352C8"
+	.ascii	"\241\361\250\037\334A$"
+	.string	"f\250\032\352\365\241\251X\264\013w:\005p\236\216\005\206\311qK)\316\230\fR\024#\232)\233\274\305\344\353\245\266\n\001 g\260\371_\332KQ\232\321\306\303\037]\342\301`hw\272qEc\005xD\211\024\275\213\t\340\244\033r\202\236c\242*\304*q\226\370Z\211~\242d\276\345\322VR\232\267\b]j=\n\225\220\276R$\032\236o\251\314\301oC\b\340rs\\\262t\223\030l^\302\332;\374\324m\340\n\350\335#\334\341u!H\2143\t\f5\354\266\202\337C\232\334.F\256\021H\201$&GW\346\004\016jAD\234B\330\357\217%\222\021\340d\376 \251\237e\013\034~\326\217u=/\324\261\232\357\036\361\200X\371\262\363s\356N\335eH;h\232M5>\363\272\363\211\344:[\206?#\027F6G3\032\037\317k\2262r\252\013\004\264\253^\177\202\335\245\356\367X\026\320\2419\316\016"
+	.string	"\005\301\230j\372Z\fp"
+	.string	"\211\204\200\265 \223\253\021$\237\374g\370BF\334\263\304%m\262\237\322\231\326\007\306\306,vm@\252o\235\030\321\262\032\256_+\340y\262\240L\232\202\001"
+	.string	"DD\225\027\t\211\367\236\344\026+\214W\306\243\310\254\312Nu\302\315\344HA\3718z\032G\250WDz?j\365G\246\034\372\030\270\210\037\325x$\2732F\307\025\001\204\315\032\343\367\304u\222\205\3205l\n\214\274\207\272\030\021\363\276nL\026Jn\020I\231\242\221 \341J\327z\315y\313S\256\254\200\f!\006\b%%\033\250\374\201\345IoP(i1\034pg\212T\222(\377\367zsJ\367{LQ-xO\225\035\245\021\270\356D\203\234\234\244\226\274\037\202\242\276\276t0\341M\237\326\240f\273\006\343}\247\234\021\376\033O\201\365\224\375\025\022\363:\217\315*!\205\366\222\314_\273\0350\\\2367\300\375\332\265U\237\233[n \201,Y\232WS\317-\r\020"
+	.string	"\213 "
+	.string	"F7\034\t@\300\260\n\320\003\250\177\303\354\312\026\037\214'\013BcxY\354\320E\350X\007\252\007\335\221t\bN\343\236\323q\2278\003\312\351\275\220w>\033\226r"
+	.ascii	"\031R+qC\347^n\020\245\214\001#\326\227\325Z0vU\tLr\315]\226"
+	.ascii	"\246W\002X\031\261\250\221y\313)Q\276*{\223\210\221\034\223\351"
+	.ascii	"\001\021x\025\013q|\216\306\221%G6z\251-\320\216\027\237\212"
+	.ascii	"Q1-\330\241}\3271l\322\240\016\317\0038\303?\r\026B\307\273\217"
+	.ascii	"\303\030\366v\355\f=\236\212\302\231\207 S\362\300\001\250\367"
+	.ascii	"\335\203S\022\3220Z\2333\202\300>_\376\252\365\247\253I91:\001"
+	.ascii	"C\271\007\321\304X\205&r\371]\316kH<\216\327n9:\360\222\t-QB"
+	.ascii	"\2471\234\036L\017\270I\234\246|\025F\345\214\332\021\354\237"
+	.ascii	"D\230\234\240k\276"
+	.string	"$\007\241@\337\004\323\022kx\257F6\022\035p&\320)\342%\233Lp\2219{\235ob\262M&"
+	.string	"\3722\361\227\214\200\3715\"8-\253M\265\352\262NC!b\"\255\210\267\375^\350\"\201\235\353\017\003\232>*\354G(F\245JTCB\217\376\224\2608\226\341V"
+	.string	"\f(s1\300\323\022\3017\274\202%\221\357kv\3368\200\245\033\271\372\246\324\304\232Qo\214\007\355\242\t\221\274\217\304\360\254\254\214r\303`U$\037T\251\\Z\314}\216\f$R\237!\367Q[\364;\020\311%\004\233_\205\036\212\006c\234\261e\260\347\371\250\025v^\245\312'\032\206Hd\244o`N\016\313EZa\345z\020{\b?\270\316\3739\001\n\243\216\257\355\240\236\016\200\322>\310\241\370\023nc|`*\225\273\246\231\206\310\344\243\243LP\207\022\034\302\352\363P\001\345C\247\004\013\247\261\032W\304}|&\371\231\302\211\356\346\300\330\322c\213b\rd"
+	.ascii	"\030`E\033\277\220Ts\302tE5M<J\024\377\034%B\360B\bQ\246l\266"
+	.ascii	"\354\315\03385\360tm"
+	.text
+	.section	.gnu.lto_servoTable.107.7a57cb9ec02d0b1b,"e",@progbits
+	.string	"(\265/\375`\367\020\325M"
+	.string	"\232\2050\035L0\214[\351;s0\304\325\226(\2169\332\f\322\235\227\230J\310\177d\"bio\035\002\024\325\370\335ZI\314\376D\020\300h\307\254\363\220\251"
+	.string	"\215R!]\024\t\357\b\007"
+	.string	"#\304Ai\225%\353\377\377\037c\357\275\367\336$\245\224\002\263\001\244\001\304\001\314\304:W`\235)\254\316K\252\263\322\352\234\304:#\261\316G\254\263\321\352\\\244:\023\251\316C\252\263\320\352\034\244:\003\245\316?\2523\253:\257\252\263\272:\247\2523\252:\237\251\263\211:\017O\347?\235\335t\356\003z\271f<;\232\371\276dKV\310\247\3253\355\216\235\354^v\323\36537\367\006mW\244\323p\322\032\324Z\032\356=\305;n8\356\272>\323hn\3231\236\323W\2625C\225ayZ"
+	.ascii	"\3226\235\032\351ls\330Fg\233e\226\334sd\344\254\260U\352 \350"
+	.ascii	"\f\370\225wa\270\307t\222\233\f\233Hq[\314\021'\256dKV\200\333"
+	.ascii	"\032\270<F\032\216\325\r\344\322\214pm\333\032a\3334\221\302"
+	.ascii	"H\2139\222\266m\350\231\276(\202m\233|j\223E\244m\242,_"
+	.string	"f\300N\256\265\350q\f\3302O\333\266R\217\205\323\036&\233\223\374\266R\022\322\221Q\021\321\220P\020\320\017\273\252)z\232\303\367\313\255\241\210\307\325JCTI\031\235\336+;\016\251\006\003\243t\235\026O\312peI\005\215\304\245\217\266\330qq\243\242\356\252\240\211P\026T\226\260\365P\2265\027\242\300\203\200\214\375\203v\346,\332\\g\350R&\305\327\242\2765\025eQ\006m\220\312\222(\235v)+::D\222Se\204\336+\2032\024a|\323\244\311\264\217\231\201\3719t\332+c\033:\265m\313\232\021\335D\242\0243s\322\303~\353\rO\372\274\372\316\2309\351\377\362:\221\262\340iY\315\222\274\243,\332\266e\0273[\322\274\324\314\035\307\314E\230\205\300\004\257V\330G\316\252_:\273c\365U\357p\300\b;\311Um'\200\017;\363\373\232j9f\250\036t\341MS\370(\303\250\002[P"
+	.string	"\356-mv\362*\206\311=\300\331\246\3257\231\336\020v\346g\024\023\327\345\205\026\302(\213\347\253\361\220\323\037\001e\b_\276\207\225\334\251\t8\231m\334\360\026\363\357\2676\013\365\362\b~\3355\263\340\362>m&\2161m\332?\240@oX\344\314<\016\360\026\343\237\017\244\350u\007\355\304\345}\212N\350*\373Wcf?\006D\347\344Q\240\303\200h_\336\022_\203p\204\244\327r\362\202\204:\353t\303\035\207\001\321\021\322\316:\335\264\007\375\206\001\321\277\241\311.\326\222\251ik\323\330p\3471 J\247\330\235u\266\231\316h\371\344\301\205i<f\006\004"
+	.ascii	"\004\343Y\333r\265\321\305\332\020m\366\267\005-\024'\344 g\366"
+	.ascii	"\261\200\267X\277\003z\322\364\bz=\027s\322\313_\215\271\251"
+	.ascii	"\006\211G~+\314\2523\017\325y\307\352\254cu\316\261:\343P\235"
+	.ascii	"\rh\272\346\033\251\263\215^6c\251\3165Vg\032\253\363\f\325Y"
+	.ascii	"\306\352"
+	.string	"\034Cu\276B\235a\250\316/Tg\027\251\263U'\233\253P\347\026M\327\274\242\351\232\251Vg\025\252\363\324\352\234BuF\261:\237P\235M\254\316%Vg\022\254\263\024\353\034\305:\217X\235\241T\347'\325Y\304\352\034Bu\006\221:\177X\235=\260\316\035Xg\016\254\363\206\325Y\203\352\234AuvZ\235\233Tg\f\251\363\205\325\331\002\353\001\177\364&\234\2427\372\006#l\273\310\364X\364JlvD\317\276\214o\372#\032e\f=\321S\315\021z\240\037\372\021\177A/\224\304\267\\\244\027\256i\271c\216\307/K\320{![\334\317\003}S\2375\277\342X~~\336\373\330\342L4\343\235\353\263\337\264$b\240>\372\353[X\022\273xy!\247\257~\203y\225\213l\022\374\370\2069\225;\326\177km\262\247\371\224;\001\33153;\333L\277I\250\023w>\372f\037\242\035\363\317?\227L\334\030"
+	.ascii	"\332ur\025\303\374S\2608\247g\030\302`\235\241>r\016\277\251"
+	.ascii	"(\353|\371\236'\036\345H\312^t(\027\212\224\213\206\366aP\256"
+	.ascii	"\315(&\350l\n\235\020\320\214\357\271\276*\203\006\246\346\207"
+	.ascii	"\306\307\370\261\376\353"
+	.string	"\377-e\b$|\355;\345d\276U\256\232\267\330\177\373\355=\321\373z.\216\361\334\204I\223\242\234\262/\350rq33eN\266\234\001\304H\004}\002\227\200\006\326\273\370\301z\030\327\315\305<\f\306\360\313\2354n\354\253\261o)A\211\232C\rs'N\212\343u\374\030\337i,\033\217\265\344*\007\323\200y\204\023=\311\322\306\367\234\216gf(\367\272H\2415\347\362\256\213\205\355j\321r\266\331o\355E9/\2763v\326\313\245\013\357\361\n-MI\330'\307\253^\356\334\342\222\300\320\340\251\214$M\237p\221T\334zz\317\365\362\345^p/8\333\304\361\252]\325\033\360;\334\002\301\b\3176<\312\364\325\270\352[\274\023*\343|\371\236\353\326x\356[\332\266\355\024w\tm\302\025\303wL\013o\261\026g\233-\276\331\324)\332\373`\211\006\374#j\310\017\"YA\244\204h\005\t\242\325\243\002\377"
+	.ascii	"\322A\264\266\254\022\330\312*\262\245e\245\205\305\200\017!"
+	.ascii	"B\262~\3648\342\036QC\264\036\330\3621D\212\310\217\005\2000"
+	.ascii	"\240\200\224\020 YA\244zl\r\221\212bb\255\006|lI\021\321\322"
+	.ascii	"\332\222b\223]\375V\336\272#\330\303\323\353z/Vz5\356\272\376"
+	.ascii	"\340\006\351\306\363\220h\305S\375\030\225\037%\300\"\347\016"
+	.ascii	"_w\017\333\266m\223^\215q\\9\342\241\246\265i\003\217F(~\307"
+	.ascii	"\217Q\375\215\027\252\022V\250\342\345\\\244\220\336\216W1\274"
+	.ascii	"+\336y\365\225!Dz\265\237z\036\317N$\301\313\267\264Qqr\364j"
+	.ascii	"<\365(\276\355\332\213N\370H\021\201/N\212\237\212s\221)\234"
+	.ascii	"\024\337\241\216\335\211G\301\345\036\334#\220\2345n\332\234"
+	.ascii	"x\025l%\336\304\373\034/gs\217m\204\\\246\251a\276J\274\003<"
+	.ascii	"\001\270\304w][\201)\336\271\305}\031%z\326\030\221\340\300N"
+	.ascii	"\352ID\375\210\227\272\372(\250\037\261F\r\324\323_=\006<\021"
+	.ascii	"\017\342\237\236\tN\210\027Qw\221\rHw\307\232\016\232\020\337"
+	.ascii	"\200\037\036\304\233\177\032\230\371\360g^\221NO\234\207\271"
+	.ascii	"e\207\367\300\3417|\207\027\317A\303oPf\240!\303\277x\f\177N"
+	.ascii	"\217\3413<\323_\323;%/\262\003\307\334\261\356\213k\372\016d"
+	.ascii	"\213\273\360\030\336,\001\356\355\202\325\233\"\235\212<\362"
+	.ascii	"\025\025=\265\233O\355CO\335u\335dD&\204AO\275\342\307\270\211"
+	.ascii	",\274[\030\246\267P\341)<\3237\321X\343+\274\211\267\364\024"
+	.ascii	"\300|YRz\366k|\323\034\242\321\255\364\320+}\357\361E\200\207"
+	.ascii	"\210A\322{\271H\245\265.-f\007\351\223\216\336\350\221\276\211"
+	.ascii	"m\001\201B\250\201(#\221bH\321\210\210$I\222a\r\241\005\304\030"
+	.ascii	"\006\035\232\007\022@d5\213c\3201\022\t\305na\357\377\013\343"
+	.ascii	"\255R\305\037\376+\227\374\313\304\005\305\004_:\306\207j\006"
+	.ascii	"\3211Z\177\311\0135\225G&\277\3601d\301\346\276\231,0\t\304A"
+	.ascii	"u\031\016\274N\266\225\217\264\340\262\200\272\2416W\211\353"
+	.ascii	"\345\246J\202Dr<\252\t\245\370\3051\355fI"
+	.string	"\311\276\371\341"
+	.string	"\202bh(\3767\217\363L\217\023\201\222\204Y\177\245\213_\353\341Z%\345\017q\262\306\225\202u\027\226\303 <\b\252\376\207\252\263"
+	.string	"\371Ms>\210>\330R'\231\344\325 kJ\353-\375\260\215\377\022\333\266\366\271L3P\326D-\344\0223\367\261\016O\365\037ux\026\235u\231\225\374\313*\017\025y2\037\272l@q\246\036\037\255T\310j\277O\211z\323FE\244S\272\207^\221,\244\f8E"
+	.string	"\300*\016\357-w\252O?\006\334QQ\030\200\223\037\177\024g\204:\262\213cO\317\206"
+	.string	"0\017\254\356\342\032*\237\021\301v\213F\262X\0267\265\336\251\bC\371hDm3\372\272\232\274\354gKJ\267m\224\273\020yY\244_\025a&\343\254\031"
+	.string	"\226\203\227\023\303\230\003\225u-\362\025tY\373\241\007\353+{\\\002\301\234\370\310\335\372\t)\264)\\"
+	.string	"\2320L \326\344w\323z\362Z\246\255\013\313c\375\261\346\036\237\354\307\241\361bi\203\201\243$P\n\244\271\300o\202\277\362\274\270,l/\005'\272&\221Dy\352\362t\371\231\006\024\305_\344\304\233(Q4\020Z{\227\207\375;q\316W7\375lh\212\356z\337w\021\223a\351\363\243\266\033;\344\374\265o\335A\220\326xH"
+	.ascii	":\336\001N\\\341r\312xz\232\2711.n\3052?V\337\005\024m\341Y\200"
+	.ascii	"\2147\265\221\311/W_A\327\223yM\364\002}\006G\226U\232\307\364"
+	.ascii	"6N\300L\212\033\262wG\311\336B)6x]\013\205\346*\002\372\273\314"
+	.ascii	"\246*p\305&@\216\263\260\306\244\304 \007\346S \242\036\\\n\327"
+	.ascii	"\332\026\267\024\227\244h\007\304chO\0212\242\374\373\302\212"
+	.ascii	"\203\361\033e\005\241\022\257\026\316?\276\025S\203\205\356;"
+	.ascii	"\320\211\022\366\374n\363\004s\264\235,\371\003"
+	.text
+	.section	.gnu.lto_isMixerUsingServos.108.7a57cb9ec02d0b1b,"e",@progbits
+	.string	"(\265/\375 \374\345\006"
+	.string	"\"\r05Pm\222\016\244DX(\243F+\032."
+	.string	"\220\001M\001xZ\215\366\252\315jk;#vv\305\r\344av\334\314\"A@\364%\013B,\024\034}X\373\233\310\024k2\026UQm\254\327\201x\340D8\274\tN\203\304\323T\326\313\020LQl\252\327\241\250\352a4\330\034e\026\200\022\033\241\315\314\2066\254!\025\271\344\222\266xs\215\235\356\333\245S3"
+	.string	"\003\344J\257}\\j|-0G\277;\235\273\026\201\216\223\254\021\005BQi\005\232L$\036\277\3471'(x\276\252q\210\006>H\241\021\025\b\265\227\033\275\352\256[\2202`1%f\237:\200\005\b\341.f\027=\373\033\374\007\177F\t"
+	.ascii	"2\001'8#\217c\261\250\360\\\303SF\274%\004\tw\316\324\316'"
+	.text
+	.section	.gnu.lto_servosFilterInit.110.7a57cb9ec02d0b1b,"e",@progbits
+	.string	"(\265/\375`\264"
+	.string	"e\013"
+	.string	"\326UP@\020Q\225\016\030\216@?\322\201\007\201:"
+	.string	"p|\234QVo\321\005\3345\"\260>\314\033\021\265}\373TF\372\377\300 \326\356\306\004\001"
+	.string	"\371"
+	.string	"\220\306\200Ka\244\"\367\b\320\276\222F6\2212\245;"
+	.string	"<"
+	.string	"?"
+	.string	"\236\035\362\320c\005|\2504\260\260\261\273\232\216\360\322\373\245\351\371\022\314\344\003A\2772\020\327\360\351\001\034]\225\335\275\352Y\002E\231\022\314\356:?\320t\307\333V`\333\200\375\002\001-+\312>\353\326\247S\322q\202\006\370\222\214\335\017#9\266\025[\2248\353\366Q\370\341S|\345\235e\027_\323\236\203\307\307\252\306\356Z\036M {\254<"
+	.string	"\366x\035"
+	.string	"\366x\212\003io\026\362\237UAG B2\241\232r\007Km"
+	.string	"2c\2248lw_\321\311vG\007|\025\007\271\340\223xt\206O\376{\364?\330c\352\002\021/n\254B9b\207\242\324\224\b\214\016\001\030\034$\330<\234\246\313\234\271t\233\207\323t\032'\002\204\215\204\007\032\205\r\203\tZ\206\353\264\313"
+	.string	"o\0254\234\306\3316N\243\204\241+J\365o\210qj\205Tti\312\017\377\020\244SHZ\256Z\262'\001\017"
+	.ascii	"2\003\006:\306\022\003I\217}OX\336\0073\240\313\214?\025O\027"
+	.ascii	"\314\262\312\362\322Dp\356\001\\\216\032\304\037J\031"
+	.text
+	.section	.gnu.lto_filterServos.111.7a57cb9ec02d0b1b,"e",@progbits
+	.string	"(\265/\375`\345\003\245\033"
+	.string	"v\263\263I\240\326Q:$ p\031\3243F3Y2\363\321\377R:/\307\006N\3735d\231\341\222\220e\303U\327q\371z\323\343\255\335\237\022F\017\032+\301\365\343\034\234\rvk!Q\276\026\340\002_\340/_\253\376\204\220\275\245L2\232"
+	.string	"\223"
+	.string	"\245"
+	.ascii	"]\262\335?\355\207+;=\324\243v\227Z%\257,\352Q051\311Rk-p\272"
+	.ascii	"\004\312S\234\323\214\247\363\265\361\264e\273\333\355\262!\252"
+	.ascii	"B\007\232\206\370\210]j\255\266\256\261\345\347\360;\362\356"
+	.ascii	"\344Hg\227\274\333\223\nb?\240\320\311I\"\255\220B\003\372\246"
+	.ascii	"\316\227\027\214\017\207xlJ:\215\001\272\370\234\004\224\262"
+	.ascii	"Z\320\200\275I\363d\006\327\211g# \021w\231\364rxF\002\372&N"
+	.ascii	"\255\365N\037\240cE\220\231TPk]\376\001Y|c\337\335\032\273\373"
+	.ascii	"\263\333B\002`H\272\205\373\353|\025\345({i{\3067\007*+=\016"
+	.ascii	"\333]\236\013\351)k\355!\330W=\310\317\376\306\351~\300\361\177"
+	.ascii	"\247{\334x\372\316\020\344\002\213\342qqw8\304-\374\202r\244"
+	.ascii	"\265\275\264[S\362\316\224\274\265K}"
+	.string	"i\223W\246\344\235\225\274\262\311\033S\362\306&o9yI\222w\244\274t\344\235\224\267'/7\357\001\314zp\001\177\344U\253\212\342\227\252E\255p\\\352\337\375\376\307\211%>\265\002\250\324Z\267\304&`2\361\251\035\263\202\001/\274l9\351q\330\222=\353\373\302\304\264\214\307\235\354\240^\373\242j\222\025\3237R\245\354X7\030\2473\331A\375\246\t\b\027\245\247\373\300\332I\3210\025Q\256<]}\311\002\006\r\370\277\007\343i\331\344\216`\027X\324\330d7\026_\230\033\246\275\033A\302\370\337\3308\275\026Z\033\356\236\275;\201\002\377G\033\207\250\205v\237D\367\237U\205\003a:r$\026.`\3000\236\316\376/\211\273\273\301\024e\341q\221\303\213h(k\255:\373!'\262a\347v\033O\271?\274\203.A,`V<.vW!\005\353\223\243\363\t\332\301\331B\344p\270\334-\300\372\220\350"
+	.string	"\241\334[\216.7\002\210Gg\013\362\351\371\001\341\301\026\342g\007g\273\001\351l97\233\023\301\003d\013\312\345\200l\262!\357\275\344\364\237\330\272\322\342\365\020\331\302\225\261Bk\232\332(\013\234\326F\253d\2445\326\321\216\251-[\237\265\326:\266p/\320\230\265>\361\261\030Xu\212W\313z\246\215v\r\234\3265}C\225\342\252HI\246\367\211\006\032&\255\377\264\314\264\314\f\013vQM\251\242\261\236u\255\227\213\270\fqq\371F\016\031I\263\205;kY\237x\016\272\370\022F\250Q \346\2302\0041\"\024\210\310\214\226\354`\002)S9\036\021\320\255E\264I\261\264go\337H\3354\2148\002e\233#\304)*X\313\213\"\317\372\261j\2179\347\256\277\211\217Z\355Y\217U\251e\241\002\325\035"
+	.ascii	"\255E\022&\325\006\270\247T9X\345\024\376\013pgK\204~0\363\273"
+	.ascii	"pjQ\321\376\0342\025\302\202\024\\~\001S\302\221=\232#\177D\320"
+	.ascii	"I\017\261\026\217\232\177\251iV\337 \264d\357\200O\026\3435j"
+	.ascii	"=\367\351\370\017 :\234\265\026\236\234\342=\314S\224\037M\037"
+	.ascii	"\356\276\376\246"
+	.text
+	.section	.gnu.lto__reset_template_81.1.114.7a57cb9ec02d0b1b,"e",@progbits
+	.string	"(\265/\375 D\325\001"
+	.string	"\264\0027"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\030\001\177\344\031\001\334\013\320\017\350\007?\202\210\200(\177}\277\001{\276\001y\275\001w\274\001u\273\001"
+	.string	"\005"
+	.ascii	"@\260\312\021L\273)\255`\240\b"
+	.text
+	.section	.gnu.lto_servosFilterInit.part.0.195.7a57cb9ec02d0b1b,"e",@progbits
+	.string	"(\265/\375`=\002\325\022"
+	.string	"\026d{H\340\360&\035\3006\321\021\b\204\227.\200U\242\255\236\210!\224*U\300\332\257\034\237 =d\263\\\rU\225\2263F\327\253/\023\f'\265\026\037\3429\032\3158\006A0\310\334\376\200\357\201k\346\371*\026\261do\271S\nc"
+	.string	"i"
+	.string	"h"
+	.string	"\237\252\013\350>\345A\272O\317\374\346\222\332\214T\364}Zv*\365\371\036\333\255\231]\366\215\207\266\r\341\351\261\220c\332\335\357SC\330\273\fo\215\256K\215\323\345\337\347"
+	.ascii	"b4\232K\211\272\231\035}\320^\322d\t\207\207\347\036e\264\232"
+	.ascii	"\250\036<\032\036A>Q\007v\327\336\206\273\273m\025\333\t\354"
+	.ascii	"\350\n\250\350)\273h\235\321QF\337#\326J\234"
+	.string	"v3<9-\210)D\342?\217\263\026-\313\310\255\2056\234\343dE'\230\366\025\216x\305Y\314X&$\264\341\240\212lADL\273\341\367\351\320S\373\236\271\n?G\315\310\377\371\315\317\341ZV\275\302\245\315\356\343\343\302\243p=\205\207\2768{\f6\236\233\322\356\216|\232\200\0271\253`Jc_\006\205\017\244\230\355\230\0231 A\332]\223\030\037j\340\340\344\244\373\234\372\030\207\250\252\267\001S2\312\205R\274\335\227\001\037\306\203V\374\235O\263\254V\335g\324\003\211\270\371.\376\002\202\277c\0270>\366\351\203\335\347\365\271K\0235\243\246ZM|\262^\201n\232\202\242\352X\247\311\022\254\2045\307\356\002n\251\240\202\300s\n\311\013\030\303Zy\371`ZXV\021\036|\022V(._\n\353\345#\02118a\205\365\301\200 \353K\331\216\327\034\333\377\205\032\035h\324\250\215U\252\216\347\2109\362"
+	.ascii	"I\261S\2512\333\366\356\241Nj<\302%\275\342\016\353\345\356\256"
+	.ascii	"\252\216\355\002\227\332\251\bN\246\003\366\301&>y@\274\252*"
+	.ascii	"X\020\037. P\002aL-6h;\332Ii;\270.6\017\210\355\270j\357\202"
+	.ascii	"\"\253L\213\300\230\233\247g\234X\033\004\357\222\260\300\302"
+	.ascii	"\332In\357\001+\253't\0340\"$.\3371\020\332\240\t\267\345\313"
+	.ascii	"8\266\261`\263\323,\271\313\272\301Z\372 !\234\037\f\262S\330"
+	.ascii	"#]e\364[\257\020\210\206\343\306\273>l\256\211~\327\034\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.7a57cb9ec02d0b1b,"e",@progbits
+	.string	"(\265/\375`%\006u\032"
+	.string	"6\350\224I\200XN:\373\206\236\262\357P\266\306\201\331\0163\256O\226q|/\347\004\216\024\355\037\036\006%\277-K-\001b\031\370\223U$\313\354*\241a\030\206a\360,\237\351\253\3762DA\366\347\363O\232\370\346-n\022#\211L\001~"
+	.string	"\204"
+	.string	"~"
+	.string	"w\"vt\253p\257vR8\024t\302\353$\334c9#\334\247A8\035\252ru\263\331l\022\335\243\235\017x\007\252\256+\2735t\231y:\270\022\264\325\006\357\3629\265\036iB\367^\316\240\203)"
+	.string	"\3047~\336E\004Onx\337\346s7\364\306\236\227\241\377{\352\272\252["
+	.ascii	"TUUy\356\265\234\3753\253\352\374\013\312\340\236\311\271vq\375"
+	.ascii	"\367\027C2\317\334Qk\301}{\376\367\031\b0\356\345\370\305\225"
+	.ascii	".\316\\\372\227\322\223\264x\030\361K\320\033Y|\f\375\243\212"
+	.ascii	"ONJ\304\244b\021\261I\301\231\245J:\031\322\251\034}\212\321"
+	.ascii	"\253\254x\024\0257+\272\225\024?CQ\\\312\211\3738\023\367\\\316"
+	.ascii	"\022\037C\342\376\355\034q\261,\021\367pg\b\326\001\202s|`\325"
+	.ascii	"\003\037;0\025\312\201\331\270\r\367[\316\034\037K\244\206{\266"
+	.ascii	"\363\306\f\277\302tY\306\2560\334\257\2357^\270W\372'\250\205"
+	.ascii	"]\263r\220\225\335\331\rN\317\260\275$\267H\374&\\\312\267/q"
+	.ascii	"\232\350\314\233\376\265B\300\376\261]@\240\032\232\327\225J"
+	.ascii	"`\357|\tlN\006\3214\263\375\374\232[\240_\373\314\250\200\f{"
+	.ascii	"\355\033v\263\017w\217\345\006\253\272#\353yK\335\347\331\270"
+	.ascii	"/\023u\031G\215\373&\215{<\250\37303\356\305<\335\3339\335\337"
+	.ascii	"\025/\363\220q\331\330ty\215qO\206\351~\216UU\375\t4\003\347"
+	.ascii	"\225y\346\216Z4\b\232\215\254\275\264\271H\222\261Z\376\332\217"
+	.ascii	"\272\266a\332Sj|\240\n\013"
+	.string	"\256\323\236b\245\332\264\241\222B\206i\027Y\246v\211xd\224\323\016HP&w5L\333&9\303\366\033\246\276*\244\333\301\322FJ{\350\227\266\2160m\233\226\203G\230C\336\n\273\307\n\233\227A!0oE\376K\330;_\n\333\211e\016\222Ug\3656\330\002\330\002\264\367\nvM\222\201axH\256\f\006\200\200\250q\024\246q\247DfRP\220\214\001\240\002\251\261\2619\021\240$I\235\032\031\tD\202\214\024t\223\f\344\351\236-\265\tqb\241\035\212<\227\313\\>\256\354\bV\311<\201\013\005Ww\325\345;\207\224\017&\351e)y\364V^z9\231\202\034ABWH\366C\f\030\177\"\363\372\320\220,\2249\365]U1\257\035\fR\204i\324\370\004\237\315n\351%2f\261;_\213{\327\273\342\337\352\356x\247\372l\322*s\330m\341\323\006\215bM\3654\034%i\200\307>(\353\342"
+	.string	"\357\nCB\323\236\"@\270\312@\007\262\247\220\206\276*Iyz\360\253\273\306M\253\315]\323u\301\225\265\350\003T\345\3051\r\035\260\353&\234\272\274\230?\201S\302v\220\001\362\377L\211\256\tF\314\317(\301\322\t"
+	.ascii	"\223\335F\376\243&\326\007\254l\022q\020\341\363\207\303\227"
+	.ascii	"k\211*"
+	.text
+	.section	.gnu.lto_.refs.7a57cb9ec02d0b1b,"e",@progbits
+	.string	"(\265/\375`M\002E\021"
+	.string	"&'oB"
+	.string	"\257&\351)D\225am\202A\034\023\227%\246\242APD\034\356"
+	.string	"\232A3\250\211\236\017"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\bD\330\003$!\016\203iN\306\367\276\365\274\331\374y\350\257\372\244\215|\373d\267-ST"
+	.string	"\\"
+	.string	"]"
+	.string	"\035\r\340\332C\352\035\3227\323\267R\267L\217%\274\244\202\\\277\354n\324s\324\361c\217\274oQ=\356[\350\361\335\221\347\006\216\327\227c\220\265G\366\215\367\356}\333\300\255\374t\276\334[\236\357u\307\272\243uP\373O\376\325zk\217\271\3259\021\333\267\034\004\177\216\013\026\245\377&\37365\"@\270\037\306}\213{\026\367)\236Gqo\"\340G\262_e\037\342\371\223{\220\324\213R\017J\375\007\365\027\352\023\365\r9\300\311!\354A\246\356\260\236\246\216\246\236\256\023L\200&\210"
+	.string	"K\220\004\017\340\bb\236E\244\347(\365\017\366\027\366\215\324\023\373?\315\214L\376\036\262wy\337\222\235%_%\373I>I\366#\357E\262W\275\317V\037\222\375\364\036s_\n\375\350\375Gv\321\373\220{P\350?\357\001\251;\023\363\301};\204\276\0346h\310@\372b\270\220\275\026*\224\276\024&\274\257\204\b\252\336\027\325\367\201\252Oc\206\f\030/^\217,x\341\212\305"
+	.ascii	"M\250\202\305\024|\270\300B\301\025*@\003-\320\013\341\245\306"
+	.ascii	"\213\221\323\002g\205\212\033\0246&jJ\220\240\231\t\321~\231"
+	.ascii	"\230\326\207i\357\222\337\322z\203\366J\353*\355QZ\037i\277\312"
+	.ascii	"\317ZG\265?\345c\255\233\332\203\344\177\264.j\317\221\017\312"
+	.ascii	"\376!\260H\311\343\334\2448aS3\"\0136 \020\243\261m\033\373R"
+	.ascii	"\340B\031\352&\301\272\217V\0356\230\020q\202\t\021'\230\020"
+	.ascii	"q\202\t\021'\230\020\304\225\212\242\375`\214\276\263\b\006\032"
+	.ascii	";\231p;\306h\342\330\352Jv\235\231\354@\230\2201\357\306\330"
+	.ascii	"M\230\260\022\302\212\331\254\\Y\001\266\355l\214\233h\305.s"
+	.ascii	"\306\300\244B3e\3316f\307+MS\bl\017"
+	.text
+	.section	.gnu.lto_.decls.7a57cb9ec02d0b1b,"e",@progbits
+	.ascii	"(\265/\375`+Z\365w\001\352sN\210T \fQ*\3514\364\374X\360\216"
+	.ascii	"Cw\036\034\301\277\246[\232\355\3159\316\024\217\340<\360<&G"
+	.ascii	"t\017GGmsV\332=i\205\025Y*\013\007\264P:=\005\361\304,_\363\266"
+	.ascii	"\260\370\331\305\305iy3\367\031\247\035\370L\324/\316\354EB\b"
+	.ascii	"\331[\356\024X\007|\b\255\b^z\360\323\"\351S\036iw\351;\253\364"
+	.ascii	"\320^\336\\,\225\347<%\2632\347\244O\216^\032\256\266\306Oq\244"
+	.ascii	"\267\036N\237\300\300\300@\353\341|\032#\305\026\350|\372\"}"
+	.ascii	"\352\224\036}\223\036e\223\376\235\245\261$"
+	.string	"\273\310\3404\376\333\312\033\313\337s}\305\366\331.\r\266\305\336\224\233\306\335e\203\316\016\026\350l\271\241\267\225\036+\2625(\215-t\025\2353\255&m\215\333`\235\301\313\032\203\304\323\352\002#\306\037\322\351\351\r2\252\315PW\334\0338R]e\357\264\0360\206fiv\203K\273\350\027n\266\352\226\266M\023\034d\033i!}\244\241t\222N\366ZG\351!\375\244\341ZJ\273u\221\246\322D\032IOi'\035\327J\272\255\2274[\227uZ7\351\267f\322d=\326h\255\326f\215\3543\253le\003y\213u\020\274\032\226M\f\222\351\037\352\001\305\203\337\342\345\320b\333d\313\026\307\006\376C<\254\2267<\035Y\220\255\354\037\035\326ss\346\201\206\3149\017\201\271!\207z\207\0247.\2727\377\220W\224\241\376\262Z\340\032\n\307\226e\316I\213g\303\016\231s\262\215\215\023\210G\243\314\022\355\267m"
+	.string	"a \331\374Y\266\036\246\237\354\364E\n\331VW{\310!\037\226\315\336i=\240\254\315\266ie\317\260R\354\335\217\t\230\231Y\232u\013\313\326ss\316\001\210l\362\3336\255\264n\206\220\201Yc9'?\b}8k\270\361E]"
+	.string	"\337*\033t\212\260@\347\321,i\207\261\241G\002e\3645>Z%=\232L\217\016I\217~\245G\233\322\237c\322\237X\322\237L\322\237C\322\237_\351\317\032\351O\253\364'Tz30\275\211&\275\211%\275\211\226\336\f\222\336\304Jo\276H\217\001\323\3432\351\361\\*d\203\316\236j\031V)\324TxN2\266\032\037KIW\220\255\320\371@+t\036\253\245\307\310\324\003\316J9`\223\216\350\222\376>I\337\006$\375\024\033t\376Z\245\317\302&}\217I/\306\006\235o-\351\033J\232\201\005:\337e)\007v\215\230\364F\026\240\023?\017<m\364\234\306\324\244\261^\002\257\336:\315m\237\355\312\031.\347\254\301\307\217\251M\257\261Ec\227V\271\301\362e\037\333\367\303\311\252\361\333H\252\202\234\355\206\323\006\006\332\r\347o\3676\240K\250\350"
+	.string	";\203\201O2k\212G\343\337\232)3\3022\t\2451\031\035\246\264\036Y\032\277y\244\267hI\313v\223H\364\311W\234\337\346\33116\214\325\263J+\306z\271\305\263_\236\210\261P\340(\340\037\272\025c\247\330\273\233\234\202\001'o\226MDx`\305X0\226\255\207)\231\251\320\257\300+\244\320\207\017\037z\302\336\210IU\300\267dR\233m\320\371\263%\355\"d\375\304\212\304i|\373\226^\001r\351\013'Q\313\234\223\267T\376\241-v\316\322\335$2\347\305W\214e\316\371\277\345b\353\254\235U\332-\326\312m\234}\362N\346\374\224s\036\272\335b\253X)79%?9y\031\200\332\031\030p\376rN~\370 \364\301\254\342\312\263K\361o\261\334\322Y-(d\r\251\326\223TV\343,8\213K\217!\215o\263R{e\350\026\013\320Y\245\225\314m9g\037"
+	.string	"D\231\243\322\030\265@\347-Uz\025\244OJ\217B\232\201\r:/\202t\307\002\235\366\315\302Y\245\0066\312m\233u\273\331\224\314\311\234\223>-\006\307\315I\343\233Ho58o`\240\325\340\374\004\322\037\033t\266\005:\177g\203N\233f\325\254\022\003\273v\021\036\3742\251e\263\234\223><q\310\342"
+	.ascii	"6\376\210T\003^\366\340\030\322[\fN\033h18\337\351\2276\350\374"
+	.ascii	"\237\r:\177{\366[&\326L\203\013%\325\225\333rNZH\237\344\336"
+	.ascii	"\314\032?i\203\316\324\002\235\377M\n\323\2423`\200\253\367_"
+	.ascii	"0M&jI`\217~\376\270\004]\354\376k\304\345o\f\374\315\342n\371"
+	.ascii	"\317\027\202\2773`\200w\370q\231\277\327["
+	.string	"\326&\030\340\025~\323\374\273F\022\377&S\363\250\001\370\373\003=\272\304\371\326\262\013]\303'\360\233E\333e\325\377\036qr\201m;\372\255\321\177\223\\\251\272\337\272\t\375m\204\347\2773\350\376\376\371;\350o\237\277Cp\265\374\226\001\177\233\020\347o\363\357\363o\"e\254\031\253\364_\203.!\313o\263\006\f\020u\347\326\370,\337Q\370M\023\177#\265z\343\272\303\033\033\027\005\353-\323\240\007`\3635\262\366\016~3\205\337\n\257\024\r\242\244\300Q\376{B\333\177\276\022\376>q\237\220y\031\r\374\027\372\317\341'\220\260\026\373\246\346\363[7[\205K\f\b\330\376\237\270\005\277\271\201\277\327[f\253\204\271A\332\353&\257\201\205\323!\201{\244\271.\324o\345\254\025\264\377kon\223_\370M\005\374\275\226\375\215F\326GW\305\337$\214Y%3\376\246q\227\3747\005J~\233\377\237\270'\370\277v"
+	.string	"\374f\001\354\360o\0224\370\211\357\374\246"
+	.ascii	"~K\202\377&1v\235p\221\374\266\350\277G\376\366\360\267\n\270"
+	.ascii	"~\233\244\341\032\371o\220\216\332\360\233@\177{]\261\013\344"
+	.ascii	"\312\r\273?\256\217\013\366[/\277\275\373{\007\320oZ\340o):\376"
+	.ascii	"\266C\373[/\356o)N\376n\303\372[\031C\310\337s\277u\373-\333"
+	.ascii	"o\237\374\266\355\267N~\253\366\333\265\337\276\231E\310zx\360"
+	.ascii	"_\0366)\307\177\020<\347\307F+\340\272[#pY+>\357\371\317\021"
+	.ascii	"\374\317\362\177\313\177-\377\215\300\337\032\340\370\017\346"
+	.ascii	"\277\336\1771\247\373\317%\357\177\227k\360\237\303\313<"
+	.string	"\303\217\327\376\013\364_\r\377\315\360_\f\377\375\371\357\205\377\006\375w\303m@\303\371/\317\177{\356\215\377?\377i\202\377\332\370o\215\377\322\370\357\324\177\243\376\253\202\377\246\360_\343\177\225\376K\374\357\321\177Q\370\257\007\376k\342\277\022\370o\003\376;\342\277\034\374\027\304\177\r\360\337\016\377\345\360_\013\376\016\363\267\227\277\273\374\235\345\357+\177\307\375\355\366\367\332\337M\177'\377>\373\233\311\337d\177/\371;\311\337F\376.\3627\221\277\205\374-\366w\330\337>\376\376\372[\307\337\\\177\343\370\333\306\3375\376\316\372\373\352\357\252\277c\374\035\365w\213\277\235\376^\301\337'\370{\351o\343\337J\177\023\377F\372\233\004\177\037\375\235\342o\005\374\215\342\357\020\374\375\201\277/\370m\225\337\276\375}\302o\221\3766\341\267\035\370\373\304o\205\377\371\376\367\375\217\362\237\314\337%\376\336\300\337$\374\235\201\277=\370\373"
+	.ascii	"\177k\360\377\304\337\035\376\257\375-\200\2779\374m\301\337"
+	.ascii	"\033\376\316\3607\372\333\276\337\232\371O\302o\305\3746\314"
+	.ascii	"o\365~\233\367[+\277\215\362[\270\377&~k\366[\261\337&\375\366"
+	.ascii	"\204\337r\340\277\337\1775\377\323\374?\363\337\314\3772\377"
+	.ascii	"\315\376\243\340\177\335\377\f\002\003\003\003\177\236\016\376"
+	.ascii	"\036\265_\002\005\b\\\322\037\213Qb16\215\t\225\233\212tX"
+	.ascii	"\342Ek\203\nj\310+X\032\377\007\013\230\203\301z6\347\234\265"
+	.ascii	"2\023\237\007"
+	.string	":vTy\370q\336\261\236\311\244J\262\306\217\222\013\027\214\367\223\235\314\300Y\372h\345\205q\361r\214\227\223\327\226<\273\373\237\223\323\224F\213\353\016w\341\252\301\344F&\307\b+B\207\355\254\027\"3\210\3045\376\317\220\024\327m\250\020\367\246e\325\370?Z\251\026e\231\035\\\032\377'*\305X\240\300\302\222\215\357\363\227&\2239'}t\246\344p\233\321\030[y\253\252\273k|\2373)\025\\%\247\353\206\223\246\306\367\311\243\022g\2258\356Z\311\201\312\371\252\0032\2535M\376rU\325\006\367\221K\275$1h-\221\021\005\256\r\034,J\032\277E\001\362\265\244\361}\224\251\031\227\245\305#\3031\305l\254\211\335\020\023.\3106I;\273e\023%\\\226K,\362\212\335\262\354q=99ga2\205\r+q\033v\303N\360\023\f\005\247\3415\253\304j\030\355X\r\237=\256\347)\231\203\240e\250"
+	.string	"\352hM\201\022\203\001\337\247Gz\237\254\364>X\351}\252\322\373L\245\367\201\221\336\347Ez\237\247\364>L\351{\342\244\267d\026\213\035#\301I\372\214\315.\252J|\t[\346\252\031\033\274\247Lz\034\004\0139\036\362!\370H\232sfJf*\241#^\3264\371\313ZZ\036P\030Mlp\0319>\362\213\360\340{x6\250\264\340\"=W9\246\226\270\bF\356\3155\2611\223\323(7\035V\230H\177\351)#B\244E\343\367\220\245\377\355\373?sSU\316\371\312L\346*\247\235\363\267\267\246\265\036~\036{\355"
+	.string	"\376\343\373?`\315\331I\357.\347l\325\244G\342\232pd\220\315\273\234\237\274\230&\340e\005\245\364\262\262"
+	.string	"\365\344U\003J\351ee\001J\351\225\231\236\2060Y\250\312^LP\312\234-\344\234s~zb\n\241\313\nJ\331\224-@)\263Un\201ges\322\213)?ue\013\371)7ee\227U\006PO^VP\312&+\013PJ/\253\254\364\312?\371\251\251*\352)WY\310J/\276\254\354\262\372\201RvYA)\275\314\354XT\232+\254\274;\037Pl\032\324S\2261\265\325T\365s\007\225\354\312br\266m.rU\276\313y"
+	.ascii	"9ouU\211i\252a\2478\335\311p\202k\352\262\311\234\363\206)\247"
+	.ascii	"\257\256\374t\307d\363\035\024\222\256\234\2218\035\345\251\234"
+	.ascii	"s\356\200)y\227\303\354\035\023\217\255,\345\"g\013r2\347\251"
+	.ascii	"\234\231l\276\31393\345\234\321\252\255d\3167~\240\220SS9k\t"
+	.ascii	"M\345-&*.r\35662S\254\240\224_]CT\330\224\310\374\""
+	.string	"\311d\241\244\27222\213\361\252J\225LiY*\347l\323\244H+\254\276\306\347\t\004\022\266\314\002\303g\316\255\335p\001\206}4\231\331\220\272=0\314C\007\314\230W\232\306\347\361\202\277\274\360\216\034\263\030`Y\270\313*\361\016\254\343\"<0\303;p\2160\253=#:R~\274\241\201\361y\312\322\363$I\177\314\205\2670\234\2623,\274e\373\254\317\215,!8\204\312\274\341b\327\370\3077l$@N\bXc\033\277m\203\265\036\327g\336\r8\260\306\235q\rL\003\n2\215\224\3060pUO\323O\316C\314,\263\360\f\253\30440\r|\205\261\354\335\017\\f\267\3149\177\330\360\001C\371\373\242;\261l\237E\257\254\244Ui|\236\"\351\255\233\024\031d\316T\330\n\313\260J\\\365\343\250\206zS\211a\373z\314\234\273\312 q\025\236\262}=M\311\\UA\210\025\231\245\320\207\017\306&="
+	.string	"S|\036\254\364<S\351y\242\322\3634\245'\206\302/\360\233\217\270.j\216_\374\327\357\256\301.:GM\022\246dc\334\"%\"&*K\343\357\250\t\304N\230\t7\341l\225\370\351\002\376\276\271p\236\260\031B\245M\020\344\237\020\244\233\307\365<\375\344\030/\304\2209g\374t\343<\316\336\265\345\026i\b`\303\244\267\346/\347\274\303\267\005\306n\007\177\007Kj\273l\320\211\301\002\235\337qK\277\363$\375\316Z\372\035'\351w\322\322\373"
+	.string	"\013t\332\266\241_5w\312\025\027o\322\364\355\025\tT\203\346\267\357\277\313\313g\373\354\006\247\273dc{g\203N\016\026\350\274{C\277h\232H[]]c\2363\327\314\371B\207\262\313-\363k\346q\235F\371\301q\323\370\222\031\372-\363"
+	.ascii	"1\036e\215\357\030\271\234\3065\335\301E\201K\346\224\t\313\n"
+	.ascii	"\023\005\025\022\004\315R\357\346\231j?\316\302\\,\277y\377\315"
+	.ascii	"r\265\\0;\367\313\333\231\224\306_\372\214\t\312\257\361w\220"
+	.ascii	"\244ww\313\355\362U\267\3149yw\351\350\220x\327\213U\336\273"
+	.ascii	"[\367\341\203P\332\345F\365vv\261\313y\303\005c\354-\007\f,L"
+	.ascii	"n\314\345\246a)T9\254\361w\210\244\337\361J\277\203\225^p\221"
+	.ascii	"W\206~\261\354\244\021\243$kl\301\234\025\024N\211&\314\224_"
+	.ascii	"+\377\245r\253\\9\024\360\017%]\334E\223\245\204\2521\272\264"
+	.ascii	"@\347\215\033\372\235r\306i\023\243\255\261\217\2245\354e\307"
+	.ascii	"\032 Q\340\2464\375h\321\370m\007\314\r5T\032\177\307E\372\206"
+	.ascii	"Rkkr\266\245\t\262a\324\241) Y\006\345>\271m\327\355*\257\223"
+	.ascii	"\313f\225w\355\246\335^i\027\267k\255\245\253n\022\211>q2[\346"
+	.ascii	"\234\357\332E\313\367\013\223+d\216\214\265&\247\037\374\235"
+	.ascii	"\246\364:~\351u\302\244\327\251K\2573\227\376\367\314\314\r\032"
+	.ascii	"\240\221\306f\377\177\231\354tU\345\247\2760c\326\032\227\375"
+	.ascii	"X\003\345\324\370:Q\322\377W\311]r\307\254\362\222]\"B\311+`"
+	.ascii	"\b\216\241Kv\205\\\262\213\274I88A\345\246\257\016G\2500\261"
+	.ascii	"\362\227s\262k\317-/\305\377M\202\344V\211\323\307\327\370\b"
+	.ascii	"\222\037}r\215\257\323#\275Fn\221\306\032\023\266\327\370:Z\351"
+	.ascii	"u\256\322\353\300H_!0}\2055\351\177\203\200\245Q!r\327\370\315"
+	.ascii	"t\301.\r+eM\307\262\315u\001\244\306\275\301\265d\323\313\346"
+	.ascii	"{\221\027\244M\367\365_\017\261\345\365\272?\256\217\013\344"
+	.ascii	"\362\270_W\354\356\270a\267\207U^\260v\363\253\343v]("
+	.string	"\231\363\323\005\2738n\216\233V\225BY\333Z\276\270S\366N\353'?\255\205]\031w\206\214\026?,\033\260F\3633#\\T\345\270\310\023\262\274`7\313\204\227%3\2040^v\022\313\200q\266A\347\223\026\350\334\272\\=b\310\275\256\271-(\327\206\317^\0160\272\306\257pv\265\216\325\272xnS\026\227\270\306\257\020$}\005\035\351+X]],+|'\365$\316\225\325N\\\035\030\254\252_+):m\322\304\b\322\370R\341-8\030.\032\337\317\262\375\3171\277\326\230\211\353\213q\245`\354\244\335\001\006v\211q\030Y`\314A5\2760,[O\234\256'\215\357w\241\376\347\3308\272\246\260\306\r\3303\346\356\212\214\270\333\242\002\237\017\257 \215\237\303$\275U\336\247\353\324c\365F&.\316\257\323/\302\203\313\224\266\265\355M5\276L}\363m\372e\352\300\213\360\340;O\227\t\347\334d\255"
+	.ascii	"z\254\025\2009'\244\311\311\211\237\223$\275_\303\371\237s\341"
+	.ascii	"\250\234\031\203\363&(oj)t2)\302FI\343\377V\331\200\355\346\377"
+	.ascii	"m2\347\334'w%7~\016"
+	.string	"\217\3649X\177l\264\2264\331\321\270\327\364\323\025\336\213\306\317\311\351\177?\253l?5;\231\0036s%\360M\3434;MYR\274\260I\237\206\341\263R\316\032-"
+	.ascii	"\337\032?\255K\237R\331;\203\202I\206\322\330L\262\202\226/."
+	.ascii	"f4~\252Lo\315\350l\337\227\231e\316\271\303\264]\343\335\264"
+	.ascii	"\252\364\211\2231[l_O\323O~r\"\203l\250\016\323u\266\357\253"
+	.ascii	"L\347\265^\227i1=\246\311Xe\207\351/8\231\363S3i\351\2523\310"
+	.ascii	"\300\016\323`"
+	.string	"\272\312i/\243M\254\324\004&\2210\274\037g\234\023\316Y\216\031k\032\277\361AB\305CK\343_\220<\001O7\247\025\"rM\032\377\002%\351/\bS\243\346dc\3252\325\320W\331\330\030\232\033\274\263s\315O6~kwMN?\300\276>3i\3252\025\2063+&V\376x\350t\270\360#\263\\b?\241\256\233\027\344\n9\226\263\226\007\353w\347\206\246\361-\270B\346d\316=\2414\23791[\346\254\345!}\002e\013\307y\346\347\336\236\232\024]\233\306\247\231S\317\007K\024\032\234\306g\231\307eQ\213\262l|\277\306\373\237s\332Q\275q\323\370\026\250\341\341\235b\254Z\246\342@\266\003\020\271\023fy&L\230\237b\036\267\003\325\344w\326\370\374r\352}\271\215\311:\365\316<*<~4\275\355\274\301\321\027\346\004\203\321.\022\257\262;\013\220t?\355\350\316;\353g\223Y\253\213\251\257"
+	.ascii	":\352\214T\375e\250-\017F`:\266t\371y\267\345\f\\\233\342urA"
+	.ascii	"\303\344\325\2515>\267\2308\260\312 \251\373sv~l\261\353s\223"
+	.ascii	"~C\232\271\2713\213U\313T\326\311V\f$\350\2306R\222X~f\261~."
+	.ascii	"\314\342\032\237W,\233\215d\324\362qI\244\220Ai\374\ryi?\327"
+	.ascii	"\322N\271\373e'3\251e*\364\215\311\020\263\277\f\245\345\241"
+	.ascii	"'\006\032\257\036p?\345~V\021\341\301\317\020\301\330\330\032"
+	.ascii	"\237Tn\303\322\260A5\376\031wN\371sr\212\230\201\213\323\370"
+	.ascii	"\033\330\322SJ\002\270\334\354x\323\370g\224\3779\025~\340\t"
+	.ascii	"I\322\270\355\347\316\363\255\247\252$\341j|B9\232\3779<pi?\266"
+	.ascii	"\032\337\357t\373\237s\355\276\27685>\331\316'V\371\272\263\355"
+	.ascii	"\254\322J\372\364Ty\341V\327\370\033\320\322\333\327\235+\260"
+	.ascii	"\257;O'?\225\177NN\225\034=\274\032\177\303\222\364?\325\376"
+	.ascii	"\034\024\212\036\016d\343o0\222~\203\330iv\232\235hB]L|\005\250"
+	.ascii	"\361\005H\223\277\234\265<\350\204\325\300z:\233\374D\323r\344"
+	.ascii	"\006\336\216\306\347\031\376\361?\307gF\025\340\226\220\233\364"
+	.ascii	"?\313\3162[\306C\224\324\314\017P\311\030#?\307\214\2347\316"
+	.ascii	"*\024\362\233\032@4\360n\n\232\306\247\222sI\022$G\254\244\377"
+	.ascii	"\211<\221\327J\f3\352\n\f\251\261\037?\207\374(sr\343\354\202"
+	.ascii	"5F\244\361\031\344\024\"\006$L\210+\375O\260\023\f\007\322\241"
+	.ascii	"7\366\224\370h|\241\027g\216\237<"
+	.string	"\316\034\347\r\024.r\276|\331Z\346\252\255\rz\260\364\370\202\323\370\364:\277\316\035g\327\251CC_\372\237[\347\026\246\373\3159\207\231)aMn\270h|\rwcn\2661\335\230\200Vi\2169o\f9\345\2460\004,I\263\200bn\304\032\333@\233\302\350ii|\rr\351\255\331\0333\216\231\245\031X\306\351la\357~L@I\227l\302\341\340\004%\202\031\231\253\363\305Ie\357\264~\362\223\224\277\345yu6\211\231qj\2355N\032\247\325\211ufY\345yu\272\270\351\306\004\034:\257N\2461\313\234\223>j\230<\251\361\203\3157?\303\301\tJ\204&{\247\214\263\312*O\252\266\223\352\204:\247\354\235V2_\351D\351\003\214\263\341\003O\037\03018N\374\237S\247\024\\\322G\232\306g\fT\253F]\213\306\327p$\375\317(\253<a\370\215Q\001l|\277\034\035,@\276\220\3515"
+	.ascii	"I\257\201+=\237\322\274%\227]\343k\250\221^\003Vz\rR\3515\274"
+	.ascii	"H\237!0}\0067\351o\3061\341\230J:5vp\372\013\027)\247\306\317"
+	.ascii	"\260&\355\244\r:=X\240\323\3643\331\230\177\177\216O\331\024"
+	.ascii	"\260\267\306\317\260\227\336\\\363?G\003@\272\2745\306\366s\247"
+	.ascii	"\231\346"
+	.string	"\246\232?\247\353\210 \247\032?\303\230\364&\237\331\367\347\364\210\031\342\226\326\370\031\274\2447\227o\201jl46\321\244.2\310iP\201K\212\016\034dn\242\371\357\236}c\356\235 \020\016\233\306\246\031\363\314\315=\263\214\271\327AW\316M\346\236\317\233\234\233|\254\025\200\265\002\300e_D\240\234\370\031\244\2446n\350&\031\035\273+K\264\306\3170\366\305*\315/f\030\021\264\340\276\340\266\204\231z\277\t\306\314\273r(\304\301\022\353\321\370&m\3209\"\203\017/^bd\320\242\263J\223\316\354\322Clg\355\n\t\034\227\233v\277Ygn\351\036Y\214\\il\231\f\335\344\342\363%\316oH\343\373g\203N\tX\240\363\031\242\262d\211\013ZC\305*M*\346\025\021~r\376\352\242sUE\252\210\225\233s\277Y\305\224\273r(\224\331\"5\244qs\031\272i\005\363XCe\244qk\331\240\223"
+	.string	"^\336\254\322|3\343\204~r\356\021\005i\212A\223\327&\312M)\277\tg\321\256\234Yu\005\367\327X\304\320\315(cVv\264i\334c\201\316\007Myb\225\346\023\323\315\303O\316_o\220\271j\306\006p</\300\326P\231mW\016\005\275\260\2705\215\037\344D\315*M5sM(g,\004\234\361\315\330"
+	.ascii	"\016\005,`\260\270hl*\277\003\246IjL\343\241\241\233N,\032`\032"
+	.ascii	"\226\306\017J\222\242\241\231\311\234\234\375N\032i\351\234\226"
+	.ascii	"\263\036\215\315d\221#_R^gg\226\315\252e\252\nQM>k\224p\2115"
+	.ascii	"~P\026\023&\330/\315\033\212\\)\246,\260\306\017\202\221\376"
+	.ascii	"&\231I\206\351\226\244\351\240\211SR\246\3611\2541\227\230K\260"
+	.ascii	"\037\021\264%\2062\351o\"1\201\230I\360\326\004\242\206\346\322"
+	.ascii	"0pI\217!J\372_\244\362\"\261\r\021\272\262\325\210%iL\254xe\275"
+	.ascii	"\301Q\344Vi\026\301[Z-3\371\3041\221Y\246xq\242\3264>\006e\372"
+	.ascii	"\233D\254\322$\202_\210\320\225\257F\260\241\242\267&G\213\033"
+	.ascii	"\034]\032\037\203Y\372\233BL!\327\214\b]MEF0\361\302\213\223"
+	.ascii	"\246\211\017G\343c\240\221\376\246\230\322\024\263R<t55uX\322"
+	.ascii	"\207F\227~e\311\321\242\361\201\362\31403\f\373\235\tCf--\017"
+	.ascii	"9dJ7tf\017\263\207\351c\003\r\276\263\f\257\215\314\004\273\351"
+	.ascii	"\003p\r\224$@m\346\016\2534w\230_\034\324mm\220\223\004s6fza"
+	.ascii	"\035n\260\374\360\324\2300\251\306\0072Ku\350\330`eU\302.\216"
+	.ascii	"\254\361\201|\244\277\311er]+\027\252,\340\344\3062Wim\320S\342"
+	.ascii	"\024i|\240\250\364\346\r{\351\224\227\316\262\te\246\276\f\310"
+	.ascii	"\254e;M\033\246\r\354\007\247g\264\260\321CM\372_!W\310\347D"
+	.ascii	"\310MV\034\220\355\310\033\374\346\214\031f\326\205\352\312W"
+	.ascii	"#\226\024\331\332@\307M\0271S&\rsG\0328A\222pR8\244\3145\376"
+	.ascii	"\2053\346\225y\205\375 \360\344l\351E\310\234\216\306\277\200"
+	.ascii	"g"
+	.ascii	"N\231Sf\225\bL\030\374\216zX\\P\335\254\372\234\217\031\322-"
+	.ascii	"\257\261)\003\255\263\373\322\321\370~\237\243A\205\t\227\306"
+	.ascii	"\277 \227Z\245\031\003g\271P]\031\253C]\221\2367\\m\372\032\377"
+	.ascii	"\2022}\361\302\214\312\341\353\220\206\351\034\003\204\201\245"
+	.ascii	"\361oB\335\214\262}<gf\354X\303=\240\300\261\303j\374\0138\322"
+	.ascii	"\337la\266h<\021\272\232\256:\260"
+	.string	"\341\313\262A\317\326\213)\300\306\277\020\2252\231NL\330\357\314\331&\273\250\252\262V\225\007\263\311l\302~6W\2559k\0249\342\221\343K\343[\370Ko\341.\375\361\033\253\304op\240\265\312\271I\253\303\221\264S/\355.\255q\340\217\341\34088\314n\311\273\332\322\370\374][\372c6V\211\331`7\355\225s\314\212\220-sU\325\006n~\374\207\333`\270\316pt2\032_\3106\350\354.\013t\336\202\231\0325\330\357?9g\247\234sp\2356\322\260\037\036\222!P\032\337\002\221\364\307}J\334\327X2H\302\267d\006\217\222*6\274\032\337\302\217\364\307\313[%^\3429\017]\371\n\001E\226\201Y\1779km\200\346\300q\306F\343[\320\332\333\263eL\250\234\255\006\200\246\b\017\020-k\310\032\337B\0133f\260^\347\2343\022}\022\006\267\374!\223\376\230\214Ub2\215'Bn\272*"
+	.string	"\027Sr\203\377\004:\304\241\320\230cD\034\226\200Hh<q\264\016O\310\240\"\241\020\256K$\bY\3201\241\003\206\037\2018\036\255\302$\325\210(,Q\341G \216jQ1)Hd\fA\224bC\005:0\302\t\020>\bV \204\r\220\020\004\241D\320\304\b\026V\365\230\244&\235jP')G-*\222\260\252F;?\002\021BEB!$V\3408\202j\\Z\205j\212\237\021~\224\212DC\343\211#\020\211\0222\260\016\211#"
+	.ascii	"\261@RR\372\300\002\222\220\350h\025&\2058\256C\024!\226\210"
+	.ascii	"F\tX\261D\034\"%\240\203\005"
+	.string	"\004\0270bE\210\365H,\022\231)V\342\320\210t\236\220\224\202\021qh\\\217!\324\242%$\"\3420\204\361\270\024\"\003\022\322\022\221X$\242kP=\301\360x\246P4\036\255E\"\232B\250\"a\026JDIj\322\371#\020,(\260\252\026\300\360s\201\005,\224\212 \004\005\217JE\020,\254?\002a\244\024\302H\211\210\270\244CL\321\3461h\244\264\263\006\211FJ&\321H\351\036\255FD\025\351TO0<\342\343Q5\026\025\tQ\026JE\"l\\\225n\221J4\032\"\t\321\"\365\270\204\217\350\215A#%\020<F\341\021\021fa\\\217C#\265D\220\212dD\034\232\370A\022.\2050DRE \n\221\224\214\303\017.\030\021\207'\030\021\207,\220H`\370\031\201\002C\343\t\236\243\021qx4\3418\274p4\022\"\2210\"\016\223\214B\235\343:4\246\240\003\244\"\241\020\236\340\341"
+	.string	"\204O*\\\205!\024\r\225\320\037\2018\"\025\215+\261H\024$\342PD\024&%\025A 2\346\374\b\004Q\320\030\202(E"
+	.string	"\216EE\022|*\254\030\222P$,f\300\302Qg\003\252q\t\003\021\006I\305\365\270\004B\221\260\210\204\341x\256C\342\b\307\n\304\342p%R\215\303\020zH\0307@\002q\230dTW\265\310\203\2324\\\225\212\305\f\024\rK\260\360\303\001\210\325(T\002\261\016\211#\034Y\b\215\306\0174\350\354\bWa\bD\306\323'I]\217,L\004/\024O\254X\372\300\002\242\272\256C\343\t\346\321\002\352*,RZ\272\260\006\217F\025i\251\002j\321\322:\\Wa\320\272\256j\260h\204\025E\024\250\211\225\250\032\215KD\026\326\037\201H\021\202XLJ*\022\211`\321\307\240Q]\221\206$\212\204K&\030\242\350\341"
+	.string	"E\017\241h\021(zH\330\"\204=\264\242E\254\350!\026}\341D\307 \221\304\252\036\325\022FJA'\032\032U\242j\224\276\203\005$`\001#V\240\037\321"
+	.ascii	"\016\032\300\301\371\021\r\030\032j\300\002\206\322/`\350\016"
+	.ascii	"\201\030\032\021TW!\222R\222\272\006\203\030\324\240\221\020"
+	.ascii	"\211\204j$<\232`T\223\206\353\217\032\\\241\026\021G\370\021"
+	.ascii	"\210\020\305\241\006$!\212\244\241Q\217ZTL\302)\b\215\367G \226"
+	.ascii	"\222\206HHE#>\"Z\207Jf\nB\026\367\250.!\tU\234\353\217@\024\r"
+	.ascii	"\225\204\222\226L\334cP\270\nC8\016W|P4T\342)\301\216`C\260$"
+	.ascii	"\354\252\"-\031\3611xT\221\226J\354\250HK%z\326\025E\024\367"
+	.ascii	"\250\032\031\205+\217N\221\252*\035\315\365G \326\035\022v\314"
+	.ascii	"c\320\250\256\030&\241\306\342ZL\252PTaTM\250\307\245t\205q\r"
+	.ascii	"VP\225X\234\360@\t\023;%\374\254\304\245\"\b;\352*,qtT\215)\324"
+	.ascii	"\022+\214<\306\265\004\"\t\341*\f!\005a\211\"\241Z\202\310\250"
+	.ascii	"c\\K\270@$q\\Z\205\253\t\343Z\002\020R\261H\201\240y\f\252\253"
+	.ascii	"p5\241&\rW\342R\211\025\306\037\"\211\343Q%*\032K 2\376\254\252"
+	.ascii	"\005\210\214\027\326\340\232\022I\034MP\223\206'\324$\241\221"
+	.ascii	"\004\221\321G\270\nC\320\021\256\302\020r\326\244\242\221D\212"
+	.ascii	"\013\307`\222\320(\\\203\""
+	.string	"\024pT\211\214KE\023E\352\321\250\252P\215>\304a\322]!L\272*RQ\3210\351TW\241\021\377\b\304\nc\b#%\240\025\306\nJ\302$\"\243iT\213\206*\212F\245\"u\205\021I84\252G\013+T$\245\245\020R \t\217*\250EC\243QUQ\f\022\207\031\004\215\226\220\224\204,\254\352Q5\026\021\207(\202\253\360\030LZ2\256%P\225\216\027\354\250HB\242\n\253QUA\034\022\031\213\206I&q\230\224\226\200H=\"Z!LJ}\216HB\025\304\342p\025\"\025\225\214\352J\034\201\310\250\341\250\252F#5\004\025\311\210\370A\222\020\004\025J).\024!\025\217\216\252\361\350\204\272\nU\fW\242\017\324\242\"\t\306\241P\2108$R\217K\301\025\302\244\340\n\243Np\305\2220\270B\230\344s4\026\215F5\350\\\325c\212\024E\035U\211\305jaC\212\024\305u\211\b"
+	.ascii	"\307\341\na\320h\t\205Z\264.)\021\207\032T%\026kPU1"
+	.string	"\\\205*\206F\265\210\203\261\270\022\tS\004\213\353\2220hD\034\036\255\305b\3221Hd\024**\016\215\252R0\205\022RPM\022\032S\004\211\214\307\340\360x4n(\032\006\327!q\211G\004\322\n\343\321g=\nS\004\213\226\204(\202\307%\024\307\036#\361\030\\a\f\252\307\245`\212\243\221\310\007]\177t\001\b\253Q\270\2320\"\016\213\214\302\024\214E\022H*\221(<\"\302\200g\375\021\210uIi]*\006\223RP\nq4\252*\206\306\242\f^TR\215!\326b\321\030Bg\r\242G#\341\211\342\360<\006\215\206)\210E\020T\250!\034\221\226J0\252+Q\005\341G]\205%\222R(aG\205Zt\327\340\002\206V\342p)5\201jL\021<\036\205J)\024\221\202\027\326\340\210\2258\\B?4\004B\006&h\300\002)\021\210c\210\365\310h\210\224\"\004q(L\nAd<\206"
+	.ascii	"aAQ\205Q=\006\213\324$\243\220\270\024\034\032W\013\377Q1\347"
+	.ascii	"\036f\303s"
+	.ascii	"A\026F\317\254\315\232YOW\0220s\355\305\013\n\206\317\001-`\\"
+	.ascii	"!\377P0\350\027.B\370\274\320/(\236Y\245\253\212K\232C\311\336"
+	.ascii	"_\343c\260$M\"y2\246\327\345\016e\373\223rew\212I}\030\261\313"
+	.ascii	"\301\005\273i\344\231\262\037[\246x\370\312\326\004\251"
+	.string	"CiX\0343\256x\320m\371\360\007\246\326\030\305\202f9\252\345\250\226F\265\334\300\300\363\f\314\223\223\n\025t\016\001X\344\360\220X9:7\347\302\214\032\274\306\250\\\025\f\204\244?:\005\353\375\321\345E\3055\236\333\336]\214\306(\024\024\n\032\305z\300\205\302\035\215\322\001MY\215\306\350\233e\003\302\004\b\024\f\262\322\037u;\263$\tLJ\241msZK5h\215Q5T\re\313a\032#c\212\223\243l\350\232\n\036O6\326Pe:\344/\253\fF\222\277$p\322\037M3\277\354f\204\305H\242Qwh\201affh\223\016O9\273\310,\206|\275-\317\2166\271]\256dq#R&\375Q&\330\017\273\331\370\361U\226\244@\237T\017\262\223\215\217\230\256\036RcYX\220fK\3168/\326\270\235\271\371B\305&I\026\264'_h\032;\321am5F\207\240CP#\266\252\252o"
+	.ascii	"_m\256\220\177Yk\206\207\037%r\324\bZ\344\222\031c\342\205\242"
+	.ascii	"(\223\016-\177\035d\312\2258\016]\322\244\031\025\225XW\220\265"
+	.ascii	"\nRPyC\304\3340\331\327\0241 \346\225FB\246\313\2310\263\013"
+	.ascii	"\231)\272$?\314\270\024\356o\t\322\207\031\306\334\001\025F\r"
+	.ascii	"\214\016\007\330\r+\224\307\321\036>}Y;p4F\275\320\257%H(c\032"
+	.ascii	"\337*\177f\357\210\231*M\032\243]\350\216\037H794_V\375!\371"
+	.ascii	"#\243\343\224Ce0\001\004\313\021\310#FD\354\211\013\037\321\342"
+	.ascii	"d\210\027\272u\242a\311\211\315\341\300{s\302g\245\261\r\033"
+	.ascii	"f\262\307\220+\344\330\2158x\215\317\241\f\255\201\326\300~k"
+	.ascii	"B\256\220K\324\350\230\322\370\034zPQ\2414\254Z\246r@\032<$c"
+	.ascii	"\025\236l\360\345\230q\224\306\347\214\214a\022\322\030\305\372"
+	.ascii	"\\\027[\234\215\306\350\325\347"
+	.string	"n\370\300zk\214Z}\016\320\r\rLc\264\352\202@4\006\032\003\235\222\373B\273\361\327\363\005\fF\fT\352\350\224S\222 Q\260\034\317\330\231<\033\215\177\201\034\232\2176\241\031\215\272zqu:i1\322\2744\376\321\026G\243\216B\211\360\340g\306\224\35055F_\274G\213K\225e\343\243.*\034\351\241\\\322\370\t\370\237\223\252eYY5F\237\220\234\221\342k\214:}nG+\314\237\017\224\351\002\2706m\3168B]L|\035\234Qab%\206I\250\343\001\224ZD\256\3050\feH1C4S\223$\035\203\025@0X@\036\027*\343\244;\023\300\303\213\214ea\242\005\235b\210HDDi\nRP)\fsf\360c\2338<0\2575gl\030\303Y\020Sy\332i\032(\271\030\003-\264\374\244$eF\341-\220ymQ\307\301\215`\322\025,B5\232\212\217\023\217\300u;\002"
+	.string	"\310\0215\001R\bJ\271\344\255\267\327\275\350\321\nJa\206;J\247\030\013\033\350[\207:\0062\353b\020\364\307\314\377\0243\234W\026\007,/\327\260\325\023B\303r\251"
+	.string	"@\001\205\343'NE\037\"'\004Y\361m3\370\004\023\345\210\361\337\212|\340u7*\320\013\254^D\261\202]\220\3338@\344\226\214\250H\030>\311Z\352\022!"
+	.ascii	"\003\335k\314L\244\325\212r\267\264k]\r\316~\212\354hb\212\244"
+	.ascii	"\372\3007^8e[u\304\240\004k\237\240\370\242o\261\032\330\263"
+	.ascii	"r\302\0170w\323\367\330\272\342\2353\345R(\262{\032&\326\200"
+	.ascii	"v\300\017\005\301\023\366\321@B\230\356&\327s%\201.o:\024\334"
+	.ascii	"*agG\214\t\005\246I\207\017\377\246"
+	.string	"\361=\327\217P\315;z@d\264\315C\340\037\276#6\3440I\324\0038\237\301\017\f\2732N\252\203W\353\033\203\326\365z\332\023\031;\220\315,n3\177\003U\311H\266\013LF\3126\337[\205\201\233^\223N\373X\0022\315\335I\203\365\033\272\004J7Q\235\332\332dv\272\200\266\375\360\240\002M\237\002hf\024\351\002Ih:@\335\322\022;\310edOHpw\301\322\307\330\343R\002\254\346V\220o\347\317Qm\036\263E@\332h\206u\223\214+\346\252-\365\346\231\210\314\n\0065\207\036\320\311*\337\320\302\037\307j\\n\246\26799?\320\251\004\345\0214\302|\354t:\215M\212\252C\360\221\237\354\255\241:e\330\243\242\306\216^\020\021,\205\364\212\251\233\2230\340x\350\217\337\030\021\"\254|\f\2339\261\262\335\335\007%\237\n\005\205O\364\315Y\001\341\370/{\255\255;\371\302\302ZJ\233\273"
+	.string	"C"
+	.ascii	"A\236\320\303\035^{\024\342\335\312L\257\n\241\210\n\303]z\300"
+	.ascii	"\270;m\3212\035\223c\027\347\260\344\031\361\223\032\b\020\374"
+	.ascii	"\263C\257W\346O\366+E`\273\024\346\035\340\3635\317\027_\211"
+	.ascii	"\r\337d\310\037\202I\332E\316|\032\362\303\323@\206N+\357\235"
+	.ascii	"\001\300X\022\206@=\017\342\246\245\353\f\217\366y\343\266\r"
+	.ascii	"\275\243Bjb\304\222\323\360\257Ii$>;\020PS\032e\260\262G\203"
+	.ascii	"$7F>\304!n\243\244\262\275G\276\266\204\0060\232y\371Q]\271\017"
+	.ascii	"\2144\032\331\226X\260\023\006\322UZ]\035\372\r7\2658\026\244"
+	.ascii	"\271~\253;\037\200\002O"
+	.string	"\225@\271\016\370\367\026\262^\213\376\304\234\031\177\375\345\356\326=9s\236\2563\267\220\244c\351\3348\275\331\326\302\210M\237\232X\375}\001\033\255\256\301U\202\354t\277C?\034C\002.#A:\b\274\333\036\2770JMqH!\207\034\275,\016\207\235\326\342\233F\360\371\326]\203%7\t\346H\264\215\257\254\303o ,]#C\310i\020\232\3438\031\370^\206(\202i\213\245v\227\312\\\265\203\321\244vM\223*\360\016,K\202#\325\226\2706\232\to\211\230\300\270\307\220\333\210\375\242\346[\213\225\320\250\3549\311A\311s\256'\212\204\302G\343\217\313\205P\202f\353-y\214z\226\007b\365\264\026\332\035\022y\324(veE\240a\333\245\356\377\t\343\255\007\335\342\332\\0\323\314\202\370@a\333\b]\034g\216\311\021T\004\354A t\027\373\037\025K#57r\312`\265\316P\rrCz\246\241\327"
+	.ascii	"\020\3570#\347\265rC\240\224)0U\036t\312N\f\001\\g\365d=\363"
+	.ascii	"}\b[\240\222o\034*\323\037go1]_y\273\303\343\022\350?\274Vc\314"
+	.ascii	"\300\201\367\355\374\244}\260>\026\311\377\327\"x\007\275\351"
+	.ascii	"\260<a\320\325\260B\326\255=\263\2033T\244\351\312\253\210\310"
+	.ascii	"'!\346\"\003MX(\005\023\245\270\214E\377\220r\"~\211\013R\227"
+	.ascii	"\3032\372\023r\215\3548\0318\264\230\310\002+b4\001<\230\005"
+	.ascii	"*(\311\"\254\370\n\fq\312\220\374\305\302\"\245-bQ'f\361\025"
+	.ascii	"\036F\251\250\2413\267/\337\224<\367\264\365(\227\227\245W\307"
+	.ascii	"\234aM\334\346\234\254\016;\220\220\3040\250\360\315\306\303"
+	.ascii	"\331K\346\262\302\007\253\355\375I\336d\250}`\243\336x\316[1"
+	.ascii	"\006\026\271\275\215\360C\223(\"\207_s\036\276\265\266\347\220"
+	.ascii	"\304\270\256\377s+\217_\202\332\214\323%\200A\020\203"
+	.string	"\311\260\203\027Z\300\336\304n\235\320\3241!\241\372\013\013j\256\006D\355r1=)h\t\177\361\214"
+	.string	"\215T\363A;#"
+	.string	"F\266\274`\346\001\331\312\353\n<=\352c\006\32543\027\316\336+\024\n{\025n:\232\255\002>\n\366\016\207Z\322\342}\"\270TD\b\256\211\360\2233\035\232<<\224\031\202\354\245@\t\357\025\004\273SP\224`\272\347#\263\007\275\021:~:\240\n\373\203\340\020Vb\336\206A> \242\301\013\004\022(\342AX\212\032\201\215\305\fA\020`'\207-\300\246:b$\032\333\272\f\250\345\002\246 \300\\}\b\f\353\356\300yb\354\362\252\021a\252\001nF\341FJ\",\272\253\325V\214\037\270\260\207v\006u/e\352y\303\304\0033\256\334G<\210\316\220"
+	.string	"|JE\355\335!w\332\266\323\340\025\343\205p\031\023\2358\277\022\315\\\255h\305*\321ge\247\342I\f\023\ta\020\345\233\261\322\262\240\232\035\343\256\247\202HF\366`9N$\362\342\362R\270\261\025kM\233\251\004\033\310$\244L@B\272\210\033\261b\206\303\236\316ZD\215I8\377\264\020\210\"Z}\327&bW\324\355\207\346\002\037\310\005MY\201\211\2055\2454>>\223C\233\315\255\310\370O\220\372bs\302\233\377\375\013?\220\310\0022\207\021\263\340\335@\233\345\301?K)\230>9\017n\353l\346\230\235\t\360J\200n\273\3601A"
+	.string	"'\r\f\374\311\234\311\271yp\324\032b\254\231\353\230\365\"\242C\034f\266`r6\212\"\270\204\315\216n\253\246\023\030\024\261\323`\330V\f\325*\225]\355!\242\373\017\276w\377\362\002\243:.\273\203\372\220\021\207\034\372@\034\216\032pG\016Y\231\241\224a;\340\304\270M\373\203p\215Um\262\273\310c\020\364\224\346PY\354\236\337u\370\376\024\237U4\037\324w\362\003\022\206\021\201\246\250\330\b\232\n\235\342\2307fgM\200\2247\260'\327\377\224\341}\215:m\301vQX`;%\030T\255\371\343\376\353\034\210\020\027\316\024Kk\267\271\325y\270\374\227\304aT&v\267\264$>x|\316J\274\240\240\345j\300\201\217 ?b\340r\017\321&\357I\034\033\361\320\332RC\325fV\006J\r\371\240\350\240>\250-\376]\tS\204!\276\261\265\037a\362\016"
+	.string	"\027\350!\315\316\003\220B\253\017\366\2140\274\001\276\0363\020\"xe&;\177\006&\322n3\305;\331,*<\226,\343\177G\002B*\336\220E\340\r\345\256\347"
+	.string	"d4\245\366\355\242\243\325\rk*\302\212KRh\237\364\224\245\274~\f\257]R\330\260\035^\256\026>^Q\300\264\222\025\374\202+/V`\252\227\324\242\325\321\373\202S\001\352\033\220\016BMd\355\255\330Sc\333\341\231\006\374\216a"
+	.string	"6\177\002\371\316\364\277w\356\251)\211\275\235f?\034\302\037U\331n\254\024'\223\365\037\276q`S\211\257\251\3723\024\234o\025HA:\2252\354\241Cx\317i\260\362\350\315\261l\032\264c+(\274\017b\235hyn\257\207\243\262~\007\021\017\262\305\251\223\033@Et\360\016X!$_\370)\327\334\205\027L\252\232 S\353,\rV\374S\315g\036\266<{\033\006\202\f\251\r\3328u3\260`\344\355"
+	.ascii	"4\f\232\324\362\264\177y\206\231\017\004\213D\370\001Q\331X\367"
+	.ascii	"\241\226C\224B\263t\017f\331\212*\352\035\371@\353\244\203\355"
+	.ascii	"Z\\Zr\246\334Cv\322v\247x\274\022\346G\247\246\007\020\035\206"
+	.ascii	"\032\007\340\237\252o\001N\020f\353\204\367\315\222\333}8$\034"
+	.ascii	"\252\002-\310Q\326X\376\032\300\234\341p\276\202\034>\221\253"
+	.ascii	"a\273)\204I1\027\035\n\360\240e)\243\002\203sid\036\327\"\031"
+	.ascii	"3i\314l\300\006\025[\206\317\331-\306\366\357\245zW;.\201\177"
+	.ascii	"\223\332g\233\317\024\"\261 >E\212\"]C\212\331\275\213^\270\310"
+	.ascii	"5\031N\235p\022\376\313\005\235D\350\266\034\216\221\023%\363"
+	.ascii	"\351\240\354\305\360f\020\341p\251\244\3149\375X\013Mix'P\001"
+	.ascii	"&\213\276I\257X\337\330\264]\220\004\365\b\201()\254\216>\026"
+	.ascii	"#\335\n\3708\213\213\320G\250U\003\316\222\270\320\330}+%\223"
+	.ascii	"\3201\334\035\332i\311\334v\217\270\023\375\tat\002|\274\016"
+	.ascii	"\315!d\371]\220\210\206\2276KBQKs7]\240\257\376\246#\320C\026"
+	.ascii	"\"\345\370XOfn\227\222|\b\240\037\247\200~\037\b\342\364K\312"
+	.ascii	"k\033\300';\366\t\226\242o(\232\r@\b\332[\030\001\260J\215\t"
+	.ascii	"\300\3644\216\034\205\243-b\226\023\202\261j\260\267\261\310"
+	.ascii	"\177\210\214qE\026\n\200Z\363\210+\222\301>q>'\212\toO|t\343"
+	.ascii	"\324\343\3262\227\213\346\367\342}\270\267\256)[\235\216\214"
+	.ascii	"\245]\240\036\036\252^\241 \227\370\032ao\305\030\234\372b\324"
+	.ascii	"\324\324\212\307\210\224\016\242g\2251\341#\036\210\240\033\354"
+	.ascii	"\034\005\205\031\333G\373\2374\365\303\354\377\366vP\252/\001"
+	.ascii	"\222L\373\202\021I\001p\024p*T^*\002\343u\201E\326\335b\234\322"
+	.ascii	"\306\273\253\277R\306\023`\315\024\013B&\177V\037\3334\203\205"
+	.ascii	"\035!q\024\307<\003k\241!\366g\336\373\027\364lt\323\241\343"
+	.ascii	"yU\356Y\333\004(\244\036LX\237\272\255\216\002\022\236\260[\305"
+	.ascii	"\300YJ"
+	.string	"t\b\320::\216\033\247\363\224F\216)\315\022\034S\264\317.R\242\0045\332\363<\234\360\275\021\250}\020>\224\032\363&\2634+\234\352\032\374\227\251\356J\r\031\236\322\022\325\f\324\313\317\203<&\216\243A/\0078\245\2460\357\212\233\254\231\033*\253\007R\021\016\313\2523\351\255DP\234}\034\204\271\t*\2666#f\266\265\241:\370\223\321H\257~\324\206\345\311\207\006\366\003 6\311Z|\357\206\331>V\367_\361\331W\261al\334\031\203\375\241\3527t?a\346\262\355\226\n\316-\361_I\027\023\322\b.\353\303\256;]N\305\177\300\307\256|\365\356\201\337\272t\002\203C;\370\251\307\251\246\206\313U\177\363\330\204\260\311\025-|\025\230\216\362HT\337\223\230\273\325\003\237!\334\037U\336\032XQ9QO\336I\353.\233\360J\355\205N\376\254\270\017\364\021\374\330<k\2721\350\242\213\261\321\324\346\327"
+	.ascii	"\360G\020\355O\004\325\376J\317PB\336\220\347R&\\\201\216)\020"
+	.ascii	"7~rq\3733\377\344`\017\240;\375\337\334}\267\232\311@\377\177"
+	.ascii	"\332\353\361y*\300\027p\350g\264\335\207\0056\347\306~\336\274"
+	.ascii	"\301\376s\372\325\207\206Vu\352\341\312\347\037\342\240\321\223"
+	.ascii	"\n\007N~\333\265\027\266q_k\367\024\220:\257\3641\371\221\332"
+	.ascii	"x\205\336w\225c\311\375f\025\313\264\376\3640\2267\323\236&\036"
+	.ascii	">6\233\215\363#\257\303\375\363aI\365q\300\373\315\225J\0036"
+	.ascii	"\037\n\037\023\254\241\tDv\030\030P\366\237\3726d\337\216\237"
+	.ascii	"=}\316D^X;\245\237Xt\274\352\336\3244\240\376Y\034\256\352\341"
+	.ascii	"b\260\243\2727\311t\020\271\243\231\345\305\326/\326\036\244"
+	.ascii	"\362\364\312{\3305\203\032.^LC\351M\362\376\367\367i\324'\314"
+	.ascii	"\337\321\355u\376Q}u\207\316;\236\215Sv\021t\033\023\217\322"
+	.ascii	"\355\270\351\356\201\257a\237\031\232\234x\330\323{gs\230\201"
+	.ascii	"\256\213s!\2740\027\352\213\360\205Syk\362\2217\331\263\033x"
+	.ascii	"\223\263\b\312\303\274\257\362\363\3001,\307\266"
+	.string	"\266wY"
+	.ascii	"\261\366\250\215\206,\3347\355h\347\236\267\336\037d\230\322"
+	.ascii	"\273\305\317\027z\037z'\367\274\300\236\260p2Y\322\025"
+	.text
+	.section	.gnu.lto_.symtab.7a57cb9ec02d0b1b,"e",@progbits
+	.string	"pgResetFn_servoConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\002"
+	.string	""
+	.string	"pgResetFn_servoParams"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\002"
+	.string	""
+	.string	"servo"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\002"
+	.string	""
+	.string	"servoConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\002"
+	.string	""
+	.string	"servoParams_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\002"
+	.string	""
+	.string	"determineServoMiddleOrForwardFromChannel"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\002"
+	.string	""
+	.string	"servoDirection"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\002"
+	.string	""
+	.string	"servosInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\002"
+	.string	""
+	.string	"loadCustomServoMixer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\002"
+	.string	""
+	.string	"customServoMixers_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\002"
+	.string	""
+	.string	"servoConfigureOutput"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\002"
+	.string	""
+	.string	"servoMixers"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\002"
+	.string	""
+	.string	"servoMixerLoadMix"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\002"
+	.string	""
+	.string	"servoMixer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\002"
+	.string	""
+	.string	"gimbalConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\002"
+	.string	""
+	.string	"writeServos"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\002"
+	.string	""
+	.string	"isMixerUsingServos"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\002"
+	.string	""
+	.string	"servosFilterInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\002"
+	.string	""
+	.string	"gimbalConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\003"
+	.string	""
+	.string	"gimbalConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\003"
+	.string	""
+	.string	"servoParams_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\003"
+	.string	""
+	.string	"servoParams_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\003"
+	.string	""
+	.string	"customServoMixers_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\003"
+	.string	""
+	.string	"customServoMixers_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\003"
+	.string	""
+	.string	"servoConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\003"
+	.string	""
+	.string	"servoConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\003"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\002"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\002"
+	.string	""
+	.string	"targetPidLooptime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\002"
+	.string	""
+	.string	"rxRuntimeState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\002"
+	.string	""
+	.string	"mixers"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\002"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\002"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\002"
+	.string	""
+	.string	"pidData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\002"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\002"
+	.string	""
+	.string	"motor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\002"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\002"
+	.string	""
+	.string	"timerioTagGetByUsage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\003"
+	.string	""
+	.string	"pwmWriteServo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\003"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\003"
+	.string	""
+	.string	"biquadFilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\003"
+	.string	""
+	.string	"biquadFilterInitLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\003"
+	.string	""
+	.string	"servosTricopterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\003"
+	.string	""
+	.string	"mixerIsTricopter"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\003"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\003"
+	.string	""
+	.string	"getMixerMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\003"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\003"
+	.string	""
+	.string	"scaleRange"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\003"
+	.string	""
+	.string	"servosTricopterMixer"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\003"
+	.string	""
+	.string	"servosTricopterIsEnabledServoUnarmed"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.7a57cb9ec02d0b1b,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
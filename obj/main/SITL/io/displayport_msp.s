@@ -0,0 +1,557 @@
+	.file	"displayport_msp.c"
+	.section	.gnu.lto_.profile.a41f2c343be2b91f,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.a41f2c343be2b91f,"e",@progbits
+	.string	"(\265/\375`\024"
+	.string	"\275\005"
+	.string	"\024\t\b\001"
+	.string	"\020"
+	.string	"\317\333\366\301\006\004\002"
+	.string	"\002\001\001\317\253\250\341\002"
+	.string	"\002\330\370\241\354\t"
+	.string	"\003\215\377\300\244\017"
+	.string	"\004\334\305\271\347\016\002\002\002\002\003\006\224\217\236\327\t\006\002\004\002\004\002\005\002\005\b\t\230\232\324\211\b\n\361\272\334\207\001\003\002"
+	.string	"\002\006\013\263\326\341\254\013\f\262\201\245\301\003\r\224\243\302\255\016\020\002"
+	.string	"\002\007\003\007\002\007\016\232\207\305\212\002\006\002\b\002\t\t\002\t\017\376\316\322\317\002\003\002\005\002\n\020\240\342\234\212\n\021\375\250\211\317\f"
+	.string	"\017"
+	.ascii	"n\023\307~\2321\026^\312\335\031\036\034\005N1\301\200Ui$\004"
+	.ascii	"\005\034e\323\357W\254\354,-\200\033"
+	.text
+	.section	.gnu.lto_.ipa_sra.a41f2c343be2b91f,"e",@progbits
+	.string	"(\265/\375`\006"
+	.string	"M\004"
+	.string	"\022\206\021\032\300%\303\001\377\377\377o\356\342\377\377\177c\032i\244\021B\032ido)S\n\356\316\201\364\013\237\235\024\212,\277fY\356\b\220c\327\b\024r\204\241Z\215\3413uFN\003\250\370#\244<\341\025uH\233x\b\034"
+	.string	"_\205xl\256\306\004\t\r01\344zE\b\334\210\331pfpQl\260bc\024\260X\004\204\371\244\027U\020@.\013\221\242\216\310\264r\331M\202\341\212\005\237\315"
+	.ascii	"\276\300T\22507\320\006"
+	.text
+	.section	.gnu.lto_.inline.a41f2c343be2b91f,"e",@progbits
+	.string	"(\265/\375`F\002\275\t"
+	.string	"B\016,.pK\222\016\260>\231{\200\006\nt\237{(\004wv\224Y\337\360\231\367\233mK\325\210\032\001@\311\323\201\030[kc$\266\331\275\345N\001\333\337\267\350\252\3514\026\210\320\212\270MM\2373\210\202(\034)W\021\222Q\341\353\350<2\323"
+	.string	"\317\251\203\2644e\270n\013\007q!!r\200\3404\214\203\377}\245\005\335\202\343\003\204\300\002"
+	.string	"\326\333\377Hkb\244c\243\261\305\036\242$\377\300\344om\333\246bd&32\255\034EfJ\276\373\026\335\326\254\320\327\2728^J33\0335\0332\363\341'[\304\2267S\273\233\324*3\227\177\276\2048 p\002\241!3\017\214\221\211\322\005\216\006zi\\\007\210~:\302\203\375e\225%\034\347:\207\263F\307\222\233g"
+	.ascii	"J#gA2\004\306TY\206\330\314\236\024\312\233\r\361CA\200Hp\274"
+	.ascii	"\223W=\327\030\207\222\017\210!U`4\272\314\005\251\242\221\235"
+	.ascii	"\005\016\274\223\273\214=C\252\202\254\363e\t\t\tD\215\016\332"
+	.ascii	"\204r\304\327\032\210\316\251F\312\240\023\243\356H\357\321\023"
+	.ascii	"|\324i i\303#F+\312\020"
+	.text
+	.section	.gnu.lto_.jmpfuncs.a41f2c343be2b91f,"e",@progbits
+	.string	"(\265/\375`O\002\035\b"
+	.string	"\322\313\"&\220)\205\016\330\377\033\277\343k+13#\307\351\322\240\233\032\365\255\036\005E\337\337P-y\002\362\rm\262\267L2<(\325\203A\251\244\243\301n\024\364y\245,\275\0012\230B\234s\016\302\2740\252+K\210h\232F\202\240]zV&\030'\003\213\300\321+\001W<\305\0237\026\356\375\260\177X\347\225\020\210\231\221;Xy\263W\344\365\257\370\341\271fZX\277+\302+2\2518:\323\227\236\302OE\352%\377Kz2$\2062 p\002\241*\243\007P\311\250\352VXS\331\026\210`9\307P\037f-\230S\200o`\030\200\303\324L+\303\205\200\005\211:\006\030t\001"
+	.string	"\344\214\031\003\242\273\240\302\371\013j/\022\206-"
+	.ascii	"\033\362\206\232#N\200\236\2239\306)\364S\215\223u\311\360\033"
+	.ascii	"\232\240''\bl\333j\005\2070\326EA\251\341\273b\260\215\t\237"
+	.ascii	"\021\303[\314\300~\307\245\307*\370\020"
+	.text
+	.section	.gnu.lto_.pureconst.a41f2c343be2b91f,"e",@progbits
+	.string	"(\265/\375 /y\001"
+	.string	"+"
+	.string	""
+	.string	""
+	.string	"\016"
+	.ascii	"\205\004\001\200\004\002\200\004\003\230\004\004\230\004\006"
+	.ascii	"\230\004\b\230\004\t\230\004\n\232\004\013\230\004\f\230\004"
+	.ascii	"\r\230\004\016\230\004\017\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.a41f2c343be2b91f,"e",@progbits
+	.string	"(\265/\375`7"
+	.string	"\235\004"
+	.string	"\302\305\024!\260'\303\001\f\303\212R\301"
+	.string	"-M\\S\007\246v0wT\272\021\262{\333\332\266\275\367&D\312\024/\034\216an\2545\034C\005\243\016\344\361~4\371\032\302@\360Z\211\262\377\2110"
+	.string	"H\210\362\360P\256\264\344J|s>7\224\377\"\341j\365T\004\032"
+	.string	"DK\340\243A\323\300\303y\354\026\374\254\\\3033\203\307\322\360\271\261!L\214O\020\005\230\0200\360\030\360bs\300.\346\250\273?[\267Z\001\340\271"
+	.ascii	"\343\330\252\354\370s5\f\024\001"
+	.text
+	.section	.gnu.lto_.lto.a41f2c343be2b91f,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_heartbeat.20.a41f2c343be2b91f,"e",@progbits
+	.string	"(\265/\375`5\001}\016"
+	.string	"V\\dE\360\222(\035 E7.|\236(\236li\255d\261\374i\"Hc\273\314%KK\265W\230h\307\255\337\020\030[>\1778d.\276\020\245`\023\216,\025U\257\272\307p\365\230z\360mHqT\330\266\367\336;\245N"
+	.string	"P"
+	.string	"P"
+	.string	"\365\324\266\037\3432:[f\202*>\006\256\226\230 \273\233y.\240\236\316\217\324S\231\342\335\247\214\235\377\360S\205\262\341}+\237 .g\201\024\tW\200\3574=?fZ\336zt\371Xb\334D\330]G\357\373p\323\3336\261=\301\376\210\277\004\220 \304"
+	.string	"\037\273\036^Cv\206\366`\361\325o\337\217y\313\306L:\313\262\006K\265\273\030\311\306\336\371\2411+X\320}U\232\213z"
+	.string	"C\b\315\356\013\311\251\035pN\243}\230\323\350\016rxg7\245c\307.\210\300\031\347\324 \347#\001<X*\357.n\231\352\267BZ\274We\225+\2571\361\272!\255R\251D\t\201\260\304\032\3738\236C\305_a\r\\\274w\352s\365\224J\021-^\240JQ\202\201\257N`\206\353\305\024_6x\212\022\205\375\2712e\323\350\r\215\2563\232\036\f~J\350\203\262\201\253\243M\243\200\371S\"\342B\025F\233&\"\235`\020q\240\224L\003e\031@'\241\354\263qY\211\307\232\310\302\226\2154m\3130\320\364)\253|\353&\035`\"\3117\322\305\366F6(a\222'\227\346\356\t\b\341;4\253\211\305\003?\353\341\005\221\026"
+	.ascii	"\266\311\"x\266\301\210@-\336\323\002U\030f\261\366\027\265\026"
+	.ascii	"\003\251*\342ri\361RV\0202CpM\004\020V\304\250\241\213&J\270"
+	.ascii	"\030A\025\331\220\272mU\243S4\265\007"
+	.text
+	.section	.gnu.lto_grab.21.a41f2c343be2b91f,"e",@progbits
+	.string	"(\265/\375`}\001\235\017"
+	.string	"\366\234gF\360\222(\035 \3255]\275\306Qg\205\344\354\306\003\372@\323D\260\210\3552\227b\322Z\345c\337'r|C`b\375\373_4\325\372\002-\005\233pd\251\250:W\242\030W\217\251#\241\025\242*6\275\367\3362\245Q"
+	.string	"S"
+	.string	"P"
+	.string	"\322\237\307\266\357\342/<\373&~'^ ,\227\313L\217\335\345@/0/\343\t\314Kh\342\336#T\317\377\354Q\006\343\321z\261<v8\214\007b\"r\006\274X\021t\343\346r\333\325\365jQ\005q\260\273\326\326\213\303-o\333\3046\004\3739\0028\f\350\330\335\260\363co\322F\212\327\374\366}\231\333Vnc8\243\311v\3674\257\361k&)\361R\2171\234\321\244\374\031\223\224\244NS\305\2051h\341\003g\367E\344\322\013<+\366\347\236\375Q\3730\217\341\375\273\360\220\335X\215\306\356\247\300\234\347\001_q\337L\337Fa\244oE8!\313uF\354\324\240Q\023B\024\231\035-\252c_\306g\240|\024\356T\364-\225y\t\341mW\017*X\300T\372"
+	.string	"A\355\032\002F\316\313Jw\354\217\245\260\204\375\2700fO\265\234\352(\325\360\337\257\001&\210~\312(\204\2022\315S\251\213\360qh\204d\032I8\225:\222\352\244\002\311$J\341:\021gAt2\342B%\0237\002rG\232P\342N]W\342>\337\352\021F\223\f0*r\t]\266%\374\354\327\200\341\303m\005YV\305]\022\rBpb\242"
+	.string	"M\360\333\274&\002P\203&k\005! @\002b\310\252\0366\263 h\233#\264\304\200\207\360\026\207q\314\027\206\376&e1He\307\3255F\301\017e\n\202\341\240<\303\303H\001\371\206\017\n^_`\255A\031\013\004\003E\b\301"
+	.ascii	"\031\315\027\372d\220\340\302\277\033\351\006m\221\246\024\024"
+	.ascii	"\n"
+	.text
+	.section	.gnu.lto_release.22.a41f2c343be2b91f,"e",@progbits
+	.string	"(\265/\375`9\001\205\016"
+	.string	"\206\034eF"
+	.string	"\223\223\016X-\030\214\326\037\257nf\344*\325\020\322\346\354\331'd\331\345\206e\361\361\035\177\332T\215\332\017\267\225\3017\350D\024\002+l\350\377\256\276\327\266Z3\210\376%A\331\375y\336\254h\311\336{\357\224\002O"
+	.string	"P"
+	.string	"N"
+	.string	"`\307\266\317\342-:\333f\202%\276\013\325\2422\323cw\263\317\007\324\323y\001\365T\222x\367)c\347?\374T\271\354\360>\224\317\016\227\263@\352\203\217"
+	.ascii	"\037j~r\334\250\234\365\270\362\245\304x9\330]G\357\343p\323"
+	.string	"\333\036\261\r\301\376K\007\177\t\240\256\320A\300\306\356\206\326\217\275\2418N|\365\333\367g\316\2621\227.c\371\202F\265\273X\311\306\336\371\2411'P\320}e\352,\212\013\206\b\0178\273,!\247f\3209\215\366c\356\242;\230\341\236\335\024\215\033\273 \002g\235S\007\336U\3346\325g\211\264x\257\312*Q\236\003\242\025C\372\244RY\022\362H\2119\366e|\306\211o\302\027\270x\357\324\347\352)\225.)`ZL\361\201\201\257.kj\300\260\234b\313\006QQ\216\260?ww-S6\215\276ht\235\3214\277\211\bT\202\201\253\244M\213\200\031$2\342D\022H\2336*\221T\030q!\223L\013e\026B$\242\f\264q\231\310\307\332h\302\226\2214m\3130\360\364)\253<\353#\032bb\310/\271b\373\222\013^N\022e\323\334\r\321 \274\007g5\261x\340\227yH\001\244\206F\025\026"
+	.ascii	"\266\311\"x\266\201\021\201xQ\013ta\230\305\332_\325Z\f\244\254"
+	.ascii	"\210K\247\305kYA\316\f\241q\231(5\364\321D\021\027#\250\"\203"
+	.ascii	"\023\221T\203V\2114\245PP"
+	.text
+	.section	.gnu.lto_clearScreen.23.a41f2c343be2b91f,"e",@progbits
+	.string	"(\265/\375`9\001\215\016"
+	.string	"\006\034dF\360\2226\035P\243\222#\302\253\315uw\217\376\0345D\354\322\206\312\377O\026)\022j\364\035\023}\241\243Y\004\303>\376\214\036)\027\257\022\006eq\214\360Y\327\237\2145\3157k\246b\013HU\224\264\275\367\336)\005N"
+	.string	"N"
+	.string	"N"
+	.ascii	"\266\375\027\207\321\331\252\t\232\370,\223\313\212\314\315\356"
+	.ascii	"f\235\017\250\247\363\002\352\251,\361\356S\306\316\177\370\331"
+	.ascii	"\002\004\017\357K\371\354p9\013\234\\p\002|\246\331\331Q\263"
+	.ascii	"\362\324#\313\247\022\243\345`w\035\275\217"
+	.string	"\303Mo\233\3046\004\373/\001\007\177\t\240\352\350A`fw\303\352\307\326P\034)\216\372\355\3732O\331\230G\217\261\224\241\302F6\366\316\017\2159\201\202\356(\322\265*\254\231\021'lv[DN\315\340:\215\366a\036\243;\230\341!\273'\0337vA\004\316\256S\203W\252\033\357,nU\365S -\336\253\262\312\224\347\204X\315\220F\251T\232\204>Tb\216}\032\257\201\342\243\360\005.\336;\365\271zJ\345\207\025.<\220\342\003\003G]\322\344\300i)\305\225\r\232\242$a\177\256<\3314\332\242\321uF\323\361' \217\t\006\256\2126-\002f\317H\210\003I\020mZhTR!\304}N2\355\223Y\370\224\2002\317\306e#\035k\241\t[&\322\264-\303\300\322\247\254\362\251\223h\200\211\"\267$\213mK.x)I\223IsWD\203\360!6\250\211\305\003\177\314C\n 4\001\030"
+	.ascii	"\266\311\"x\266\201\021\201xQ\013ta\230\305\332_\325Z\f\244\254"
+	.ascii	"\210K\247\305kYA\316\f\3015\221\0276\266\036BH\r}4Q\304\305\b"
+	.ascii	"\252\310\340D$\325\240U\"M)\024\024"
+	.text
+	.section	.gnu.lto_drawScreen.24.a41f2c343be2b91f,"e",@progbits
+	.string	"(\265/\375`9\001\215\016"
+	.string	"\006\034dF\360\2226\035P\021; c\221\206\314U\334\264\0257D\354\322\206mJr\303\220\002\003.C\274\372\013\035\315\"\030\366\361g\364H\271x\2250(\213c\204\317\272\376d\254i\276Y3\025[@\252\242\244\355\275\367N)N"
+	.string	"N"
+	.string	"N"
+	.ascii	"\266}\027\177\321\3315\023<\361Y\246\024+38\273\233u>\240\236"
+	.ascii	"\316\013\250\247\322\304\273O\031;\377\341\347\013\210\033\336"
+	.ascii	"\227\362\331\341r\0268\205\360\021\3403\315\216\016\233\225\247"
+	.ascii	"\036Y>\225\030-\007\273\353\350}"
+	.string	"\034nz\333$\266!\330w\t\007\177\t\240\366\330A`\265\273a\365cmh\016\025G\375\366\375\231\247l\314\243\313X\306Pa#\033{\347\207\306\234@Aw\024\351\332\025\226\f\022/7\273-\"\247fp\235F\3731\207\321\035\314\360\220\335\223\r\034\273 \002g\327\251\301+*\034\357-\356\232\352\247@Z\274We\225)\317\021\261\232!\215R\2514\ty\250\304\034\3734^\003\305G\341\013\\\274w\352s\365\224\312\017,`<\220\342\003\003G]\322\250`ZJqe\203\246(K\330\237+O6\215\266ht\235\3214\363' \217\t\006\256\2126-\002f\317H\210\003I\020mZhTR!\304}N2\355\223Y\370\224\2002\317\306e#\035k\241\t[&\322\264-\303\300\322\247\254\362\251\223h\210\211\"\267$\213mK.p)I\223IswD\203\360!7\250\211\305\003\277\314C\n 4\001\030"
+	.ascii	"\266\311\"x\266\201\021\201xQ\013ta\230\305\332_\325Z\f\244\254"
+	.ascii	"\210K\247\305kYA\316\f\3015\221\0276\266\036BH\r}4Q\304\305\b"
+	.ascii	"\252\310\340D$\325\240U\"M)\024\024"
+	.text
+	.section	.gnu.lto_screenSize.25.a41f2c343be2b91f,"e",@progbits
+	.string	"(\265/\375`\222"
+	.string	"\315\t"
+	.string	"F\223C9@\305(\035\235\272-\342\300\223c\377\364\307O\310:G\306\230\203\206?\345\213A\253\375\210?F\026\242\241p$|\245\212\213N i\260\002\344\022\204E((\204\020B\244L)3"
+	.string	"0"
+	.string	"1"
+	.string	"\240}r\205\032'\215\224*\215\004\330\335\210\371@v\354\272@vL3\016>A\377 \277V\027"
+	.string	"L'\321SC\330]\247\351dq\353mgl\037\330\317\004\231VMg\246\277e,\225\002\226\335\212\326jS0\023\016\333\240}\261\375\264\257\372\007\3700\364\200]\024J\311n\250q\334\2169\334l\373\036O\005z=\234DUsM}\211\345\357\"\020\333\356\204\201\037\342El\033\307\374Pv\354J\260\242\032e\313\016E\251\030\366\257U\224\255i\355\341\237i\372\n \217K\270\270\263\351\276\217\002\310\343:\tNC\367y\026\"\347\211\016\036\316'v\274/n0\346:\006/\2028\316\213\227pok\212\031)\311\227\246j\252-\024\035\244lY\003\017"
+	.ascii	"\266\231E\246m0\302\210\t\003l\356\251\344\252\232M\351\255C"
+	.ascii	"c\231k8\264,`\t&\036\334}R\255\230\204I\006"
+	.text
+	.section	.gnu.lto_writeString.26.a41f2c343be2b91f,"e",@progbits
+	.string	"(\265/\375`\352\003U\034"
+	.string	"\246\265\272I\240\326Q:\304\253q\361\326\230\001\205+\343N\216\327a\023\313\276\357\213k\321Z\227\246\200\317\037\216\236\311\270n\237\203/\332\213{\322v\303\006\307\204\275\343\\\372\007|\202kY\370;\0356\036NOVj\2364B\210\334)\005\244"
+	.string	"\230"
+	.string	"\256"
+	.string	"b\265\326\237\227\026:\311,\025;\001*\323\025\224\013X>* \351=@\375U\251\021\264\324n\360\300w\253\236\267\326\241\231\t\247\366\215\374\210\357\304\026\307\251U\252\310U+q\201m\347K\023O\333>\221\027\361\331^$qJ(\373-\001&\031Sk\265\371\\\200\371\222|\216\371ry\334w\263$\227\372\374\027OR\r\307\202B\245\2333^\222\006\244n\220\261\021\272 }\244\200\001ol\242\344\323\227D\020\026\305\305F\310D\326\206_O/\236\276\020\376(\225Q\250\265\232\006\2052n\331m\037\331\376`\223\265\3003K\364\350\032J\2636\n\034}\360{\243\304\006\030\323*\331\304\037\335\035\366\311\272R\346Y\352\332\211\377\316\261~\035"
+	.string	"\3249\267\372q\216\344\277\271\326]\363\254\237f\251g2\352\363\244\226-\2659\243.Oj\362\244\336\245\2462\352\367\310\250\204\021xRk\214\243\231\nV\032\177\\\353\337\362\273n\264i\336\235\313[5FUk\245\355l\332\313\333>\237\311\213\246\271\311\235\370\276\225tV \026\242\232\210\325\352\364\363\322\035\316\227\324\351\300\265\354u*9\235XQ[\001\\\307\322\301f*x\345\305\236NIz"
+	.string	"A\037\264O\323*\331\334s\001\f\261\2202\233\340\227%\342\013\230\344\312\226\303\260\b|\372\321\343\273\304\204\341X\033\231\345\022]}1\3212\326\331r\033\f\225"
+	.ascii	"\317\220@\267\022\374\022\364\236\271K\356\216\030 \215\037="
+	.ascii	"\2628\225\020\016"
+	.string	"\"\330\">eD\202,\2652A\220\362/\022~\217\227\036\272\225\376m\035h1\352,]\023\312\306\030\360\f\316F\241\267W\225\02727k{\201\227!P\373\236i[\301\213=\232\251Zk\204\255\3522&L\317\355e\326\254\271\f\240\216Ma~\364\350o\315\336I'\222\210\366\310D\321\2428\302\351x;S\307\343\r\221*r\272-\312\335\226\247\313q\240\371\006\204\2643\"\301\323\345\220V\f\025!\355p%l9\234\355\b7dd\273\351v6 \037\347\220L\350l\274\\Ng\243\021\227N\326\225\262\311\262\226\001\206\021\362\347<\373\3026\317J\300\261\264?'\221\265\352\b\372\326_<\216\230\225Y\200\316\212\026f]cT\027r{\231\276\021\203\006\372`m\315U*\223\343\230U\2460s\226\350j\213\257\345[R\370=\274A\210>(d\276\314\331\033Ok\004\031Bc\311\312\315\235m\017\230\246\341"
+	.ascii	"z.\315>H\250A0\303\224B\006\tF0\023\320\024I\222<\200\"\231\272"
+	.ascii	"\353\020xW\022u\266%\341&\023\3400\342\246k\222\365\346\357#"
+	.ascii	"\f\257}\036i\330\3278\242?\226\265\242\247\211\370B \306AG\231"
+	.ascii	"<\256m\335\003\036\013B\247\350\262\204\314\244|W\356\330x\220"
+	.ascii	"\322\037a>\f;vNb\227\001w\024\315,\301\373S\310\340B\b\304\372"
+	.ascii	"t\013\013\344h\016\202\003q\272\302\037\023f?\035p\215\357\331"
+	.ascii	"\036\261s\277x\332\201\311l\206\214\001\341\257+\b\370\324M*"
+	.ascii	"(\266\232\301cS\310R\003"
+	.text
+	.section	.gnu.lto_writeChar.27.a41f2c343be2b91f,"e",@progbits
+	.string	"(\265/\375`~\001\315\016"
+	.string	"\306[bE\020\221\223\016\300rF\025\256\302\221\226#\024\360\341\203j\223\242\220V\346\232\315k\235\360\276\203\365j\321\"\377\354\331$\252\261z\033\310\230"
+	.string	"P\316\021\255\227\2757(\213\241\200%2|k\332lA\266\355-wJ\001K"
+	.string	"Q"
+	.string	"J"
+	.string	"'\216\242\373\227\341"
+	.ascii	"vY\240\213\335O\304\331\365\351\357\262\355\227\270\211\316\206"
+	.ascii	"!\277\226\025'\245C\265\"\307\356f!\027\260\371\224\017\260\371"
+	.ascii	"\324\020\357\036;\377\340\245\013K\350\255P\217\234\005\273\353"
+	.ascii	"\350\2556\334z\333\003l?\260\037\006S\243\245F\253F\307\031}"
+	.ascii	"Pge\006H\214]\225\260\307\312\230/F|\346\267;\0374f\231\263\350"
+	.ascii	">s\272\226\304\245A\005\017\232\335\025\002\237vp}\202b\214L"
+	.ascii	"\003\030\021\f^P\016\332\024\r\225\022\215\266\201\003\335[("
+	.ascii	"\326\335\016;\024<\332\017\027J\361\336G\345rP\2241\225\035U"
+	.ascii	"\275\252\346C\243\222\260\2047ml\213h\212\320\005\307\325v\201"
+	.ascii	"\203&O\313\356\222\334\2731\365\nbCU\223\022C\373CE\005a_\256"
+	.ascii	"\262\374\371\367{\336\372\261\277\374\235\303\374\037\217\371"
+	.ascii	"\003\025L\022T\364\215\343B\362\244mj\242\211\224\3334\b\230"
+	.ascii	"E#\244\322I\004n\323H\030B&\244\322hB\246\2152\013\243\320I&"
+	.ascii	"\332J\331H\2105\022\205-\3434m\313\260o/WY\037M\340!ES>\311\335"
+	.ascii	"\017%4\255\370\026\0075\0045\274\250\252R=j\007\" \260\"\262"
+	.ascii	"\013=6\263\b\354\265Y\213@Sf\f{\031?{\355\260\264U\203\371g\263"
+	.ascii	"(-\037\341)T{\242\027\303\001PD\364H\230\215\335H\223\r\016\350"
+	.ascii	"{\260\203\300\317\301\016b\316\r\343\005\340\b\201\341\337}r"
+	.ascii	"+&a\221\001"
+	.text
+	.section	.gnu.lto_isTransferInProgress.28.a41f2c343be2b91f,"e",@progbits
+	.string	"(\265/\375`\002"
+	.string	"\035\007"
+	.string	"\242M25Po\322\030 n%\"\245_\022C\322\026\bP\t\203?\251\264\352\225U[\004\311;\2623\033\213\204\273\315\006\220\206\211^['P\271\005+\225\326B\342\3362\005\231\214\f\325\235\315\205y\0342\031\257\tN\304\205Y\0170ZP\302\342x`Gbp\2439^\020\022f1JX\315\325\215\322T<\213\237\037\3676^\001vw\177\243w\r\244R\213A\312n\350\305eI\023\212\307\257}\365;\367\n\242!\232\212Ph\300\356\210\345dw\036\f3:=u\200\322)\243\002\224N\377\b\t\332\233\316\216\020\346\002\204AR\332\235\360q\350\246n[uD\t>JTVLD\037u\230\205\335\335\201D\031\372\323\277\340W\3705\002\b"
+	.string	"\266\231E\246m`\344\250"
+	.ascii	"X\005D\327<d\2070\257k\222\001"
+	.text
+	.section	.gnu.lto_isSynced.29.a41f2c343be2b91f,"e",@progbits
+	.string	"(\265/\375`\002"
+	.string	"%\007"
+	.string	"\002\01635Po\322\030 n\203\240\360\034\2512M\013\004\250\204\201\025B\331\273\005U[\004\311;\2623\033\213\204\273\315G\304\222\224R[\344U\225c\235Z\333\210\264\275e\n\230\214\013\234A\036\353\n5`2Z\022\037\b\353\252\034`\254`D\365\tA\220\274\240\247s\264\036$\304b\224\360\271\232\331\267\255\032\325\241x\025?E\356q\274fvw\177\333;\206Yz)@\331\035\305\300,\313\244\362\361g\317\371\235{\rQ\221LG&\024`w[I\331\235\006\303\215NO\025\240t\332h"
+	.string	"\245\323\377\001B\266\246\323c\244\261\330\270()\355N\370:TS\247\255J\242\003 '-.&$\221:\215\302\356\3560H\031\372\323\237\340O\3705\002\007"
+	.ascii	"\265\311B\241\301\3143\227\225\235t\r\201\354\020\361u\315'"
+	.text
+	.section	.gnu.lto_resync.30.a41f2c343be2b91f,"e",@progbits
+	.string	"(\265/\375`N\002M\023"
+	.string	"\226$\200I\300\322Q:r\251\237\237\303\210n\r\250\006\236\260\274\342\005\211\270\035\341\203N\002\364\340\265\3438\273\353x\351\315\246/]\030\377(j)\300\3669\021\273\r\fB%$\037Ze\002\363\206\023y\207\321\b\370\212\366\367&{\247\024e"
+	.string	"f"
+	.string	"o"
+	.string	"\247n`\032{u\372\225\355K\373A\027\242=W\363\222]\234\322\322\356\270\300\240\352\324\343\t\324S\325\005\324S\323l\037\037}6\325s\3139\342\355.8U\234\366oJ\232\377\241\213\2106\233\177\">\277\0038\236("
+	.ascii	"\266\332g\242\343)\347\272\313\0176"
+	.string	"\034)S\017v\327R\264\205\270\351mO\260\035\301\226/\002@\271\033\331\263\307\232\234=\366\277\335]O\234\235\222\036y\356WU\351Z\245)\225\376\252\364\254\322\222J?\200l\272\321\3033y\214\253\323\013\262Ot\267\342G\277}\237\350:\232'y\0229\361v\3670~\344#\031%\2056\363\321t\204\317-hwg|#\243\244\314\274hfb3\256\016\003\023c\020ow'A\3771\206\025yq\245\236\216\314\022-\200H\314$\004\004H\227'@<\335\204v\352\2643\334\206\201\267*\235\365\233\224\3455v\337$\3311E\345\346\264[\276\324R\355\256\212?\003\2065\300\347\247\246\236J!\342\017\222\267\252\234s\316\035\036n5\331\363\247\234\317\031b\r\227\341R\355\342\250\3701\256\264\301\3779\365+\224\027\303z\372I\262c\n\337_^,\227\016\262*\023\013)\254\314:\201\311^,2\261\0206k\341"
+	.ascii	"\223\271^\300\320\005\302\270Z^ +&\003OL\034\302Z1P&\fc\340j"
+	.ascii	"\274\371\267\0237t\tM,\242\240nf\315\263o7\205\203\022\250\242"
+	.ascii	"\257\200T\360'\035\251\202\b\r'\236x\027wS\365u\026.\310\213"
+	.ascii	"\256\323\346@P\364t\3231ud\272\030\365\300\221@\354\343x\216"
+	.ascii	"\030\007* `\2021\202\220\036\266\227E\266\207d\333\323\007P`"
+	.ascii	"pi\261p\251\1777V\200\300\032\206\220\2231\\6\340\223\"\377\t"
+	.ascii	"\242\2438\005\246\322\003\266y\031\355\341v\341\305`fvd\257\302"
+	.ascii	"\362M\253-+\203?\301>\316\304\201\341\013\007?/@\255\201\227"
+	.ascii	"\246&\264,@\030#\022\2619O\313-\317\b9\245\020{"
+	.text
+	.section	.gnu.lto_txBytesFree.31.a41f2c343be2b91f,"e",@progbits
+	.string	"(\265/\375` "
+	.string	"\225\007"
+	.string	"\222N45Pm\323\001\244\024\241n\336\200(k\327\320P\233^\251\264Y\276\201\371\263\321\b\372\\\2322\253f\027\357\350h2H\242\326\232\274\335\206\327\321\344\355\267-wJ\001\230%\021$s4\325\325I\300,Yy6\f\325E)DI\305\006j\323\211\034\353\212\232\311\262Z\260\"&\245\025\245\271\267\352\004\241\037G\317v\360\274s\252\323G7{nOC\366\341*\310\n3'%\004(\273\022+*K\022\215`\330\316l\311\366{\366;\356\221}>\034`\027d\"\262;\013\0341\217<1\266\375\215sd\326\340\254\3502\241\213\b\220\224\335\031\247\013X\036\301\007X\036)\305\265?\315\377\307\241\206E\b\327m\177\227\203\335\365\343\272\211[o{\300\266\201\355\214\013"
+	.ascii	"\266\231E\246m`\304U\335\341\232x1\321\022\215\333\201\t\002"
+	.ascii	"N\030\251VL\302$\003"
+	.text
+	.section	.gnu.lto_mspDisplayPortVTable.32.a41f2c343be2b91f,"e",@progbits
+	.string	"(\265/\375`("
+	.string	"\035\007"
+	.string	"$\f\356"
+	.string	""
+	.string	""
+	.string	"."
+	.string	"\005\001\006\177\001}\212\001\202\200\200\374\342\303\347\302\005{y\270\347\222\005wu\370\346\362\003sq\270\346\242\005om\370\345\322\007wk\270\345\242\005ig\370\344\302\005ec\270\344\262\005a_\330\337\002o]\270\337\302\005o[\370\336\202\005oY\270\336\322\003oW"
+	.string	"?\202\210\200\370\001US\310\001Q\307\001O\306\001M\305\001K\304\001I\303\001G\302\001E\301\001C\300\001A\277\001\277\177\276\001\275\177\275\001\273\177\274\001\271\177\274\001\267\177\273\001"
+	.string	"\013/root/repo"
+	.string	" ./src/main/io/displayport_msp.c"
+	.string	"\016"
+	.string	"\200\024 \205\fD\003R"
+	.string	")\200\024@\n \005\220\022\223\0243\351A\260\224\360\006"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_displayPortMspInit.33.a41f2c343be2b91f,"e",@progbits
+	.string	"(\265/\375`2\001=\r"
+	.string	"6\227VD\020\2176\035"
+	.string	"\334\340\341\264\033!\240\025\244rz\365\221?\264}60-\325\r"
+	.string	":/\355(0\222\221\367\365\2341\214<\213\277\006(\257\325\r\n@EP`\004\220\006`\220\362\031\202\374\361\375i\223-S\n@"
+	.string	"A"
+	.string	"A"
+	.string	"\026N2JL\021T^vC\314\3417\254\313\353"
+	.string	"\254\313X\341\241WQC>\306\243JAq\371@\321\253\t\217\032\240Wq\354\3567\\M\300\221*\306cw\255\037xr\313\333.`{c\037%\34198\360/\\\232\003\351\277K\037d]\332\017F\364\237\003\2508\241N%Qd\207#\215$\373\325F\n\266\252\217\341\234^Z\020p\331\225\220\212\261,r\005\203m\022[\343g\270\006\022\207\006\204\001\235\246twE1\222lg\326c\002\017,<\205a\373\343#\262k\327\353\360C\\D\307 !\032\0223]\013\252\324i\312\032}\351 \346\265\013\341\303U\026T\237iM\353\362\245w"
+	.string	"]\273\335??\356l4\356\363!\262Mm$c\240q\036\005\330\364`\r<\331\007\353l\034\266\341\360\324@6Ld\316\r\323\204\335S\240\32001\261tq\344\215\023+\006\016\230L\240N^\025I\347X6\202\227\340\bX\261\273\035$2.^\244\264\004\037"
+	.string	"2\003\302\360\325\206\235!0`\210\245r<c\0076\036\260\236\0218"
+	.ascii	"\303\320j\263\361\020\004\253`\211\216I\2762\361)M8p\007\314"
+	.ascii	"MU0\020\032\334\301G\r\350\032\316\304\302\371!\b\340.Dj\234"
+	.ascii	"\242jlW)\003"
+	.text
+	.section	.gnu.lto_output.part.0.42.a41f2c343be2b91f,"e",@progbits
+	.string	"(\265/\375`\033\002\355\021"
+	.string	"\246\241sF\340\360&\035C\037\260\302Q&\21705\221\366\364\320_\242u/\\\013\353\337\340=\350\223\233J/\227?P=\271\310 \021\"\216\363\261\333 \030\326 \303\032\344s$\352\234\244\003\266R.\352\215\324 \333\366\226;\245["
+	.string	"d"
+	.string	"^"
+	.string	"0\017\267\306\306\032m\221\021\360>0\326\335\234\032E\273\341\201Oo\331\247}\024-\033\333\376\211\367\200\366\221\fyn\030\304\240\201!\355\356\366\371\361\001\246Oy\001\246O\025q\360\032%\350\307\327M\314\365\261\027`a\343u\303\341\021uy\"\331]g\035\356y\333\rl\263\354H!\353\nAl\177n\361\byp"
+	.string	"\334p\201!\007i7\334>Ot\177oa\007%L\354\256v_\250\345\307\254\021\r\275|\304|"
+	.ascii	"\371\364\034zy\200]\035\241\007\031hkA\007\332\003\371Hv\254"
+	.ascii	"+DN\321\356.\220\361\260V\27082\332W\361\037\360+*xt\254\353"
+	.ascii	"g\003\2020\263\306\207\026\031i\335'r=h\214U\245~\006\215\222"
+	.ascii	"\235:\fU\266\353R\340\033\375E\212?\342\323+\225\370\327\247"
+	.ascii	"\257\242\th\244\270F}\354\0344J2q)\352\216U^\256\3528\323\350"
+	.ascii	"\323\203~\323a\377\344\210\226Y\264jt|\370_;\201\244\335\232"
+	.ascii	"\245\244\0051\215H\024\271\205d&\303\005\371\003\223\321\203"
+	.ascii	"\024\236\020\362\251X+\024\316\353R:\003.\036\007AcQ\261\024"
+	.ascii	"\345E\202\236\254\244\324\251\220\356[)q\361\270\316\202\t\253"
+	.ascii	"\373V'\033\267\332XV&+[\312\373\266\220\017s\235\312\333\\8\316"
+	.ascii	"\3334\333\361\252\343\307\216\212'\315T\203\355LM\"\2433\252"
+	.ascii	";\266Q\321\217`2\351\324\250R\355\022\223\370\327I\003/ `\242"
+	.ascii	"a\314z\034\314i\264\213e\310p\214\321%\035\270A\336\023Y\024"
+	.ascii	"\376\211\3260k\270\345\302\271\334\320\326A\2342A\357\204\331"
+	.ascii	"\232`\320\n\200\223Z\273TX\275_\270\216\b\317 Y\003\374\303}"
+	.ascii	"1H\260\353g;6h%5\2739F\356\233\255\201(\016\221\b\216\363\261"
+	.ascii	"\362\r\222X\304B\260\274\302\260\360`\312\330\371\327\2521"
+	.text
+	.section	.gnu.lto_.symbol_nodes.a41f2c343be2b91f,"e",@progbits
+	.string	"(\265/\375`\256\001\265\007"
+	.string	"2\313)/pi\323\001\346\364w\372\366\361?\f7=\001\\\374w\240\372\377\377\377\377i\340\365\377\277\337\276\333\354\277U\355&\242\206\325V\365\367&r\313\024N\206'\262\"M\n8\240\020\324\207\202\025\024\320\204t\361\004"
+	.ascii	"h\306\314\212\205\214D\343hb\246F7I5\341\021\204S\016^\271|\222"
+	.ascii	"\273kg\031\203K\222\322\236\332\211\331Iz\266]\\\b\313!\2253"
+	.ascii	"(\307&\267\266\023H\376p\221\0278\310+m{\331)\367\260<\333\332"
+	.ascii	"\306\270\017\216_\032\317\030w`o8\033c\204\203}{B!\233\335\335"
+	.ascii	"\353\227\263\355\032\002% \020\003)\252\034\030\330\201\350q"
+	.ascii	"\220d\250\2145\004\333#\031\344\260Y\177\327\336\3105\207\241"
+	.ascii	"\036\301!px\200@[\032)\005\003\371\345\301:\234\332\251\235\332"
+	.ascii	"Q\355zu\366\024b\035\004]\2031%\022\244\307P\017\365\340\032"
+	.ascii	"4;\234"
+	.text
+	.section	.gnu.lto_.refs.a41f2c343be2b91f,"e",@progbits
+	.string	"(\265/\375 u\205\002"
+	.string	"\342\005\020\024\220\265\351\377\377\377\377\277\026-A4zzj\264\366'\231\002\n\377\231\274\001\033;q1\332| I\332J;$w\354\322\001\242\240\250)\215Q1O\321*]y\004\302\314\213d^\016S\007\001\005"
+	.ascii	"\216 \f\342\352y\013\354J[\302"
+	.text
+	.section	.gnu.lto_.decls.a41f2c343be2b91f,"e",@progbits
+	.string	"(\265/\375`\263%\365\244"
+	.string	"\372\003y9X0\f\245\234t\373\273\256\377\272\376_\376\233u\372\272\357\372;v\250\352\275\333\273\235\275\233\277\273\347\347\376\266k\252\252\243\273\234\361)\257m](\245\266\005NL\374\364\224x\200\017\031e\032\346A\236N9B\270\355\346\024p\321\303\334\016\212~\337w\340XD\342\367\2262\005\n\003\226\003\212\003V}^IHz#\376\270\222\220p\372\310[x/\352\210U\336\217\323G\226R"
+	.ascii	"$IHZ\255\242\205\272E#\233E\017\365\212v\301\315>\266\361\r\324"
+	.ascii	"A3j>\274\354,\260w\302\033\316\231.C\337`\350{\013}_\241\357"
+	.ascii	"(\364}\204\276/z\336\373Y\013\233\261Z\t\356m\336{/\240\271\302"
+	.ascii	"\204Y\325\226\365p\316\\4\234J%\346\025\203@\216\032A\332\326"
+	.ascii	"<\324\236\361\206,74U\372\332\2400\026\274\037O\300j\264\275"
+	.ascii	"c\036_\226\204\365}QA?b\005V\013b\305\256\213\355V8\004!1\220"
+	.ascii	"UE\t\032\253\325Y5qre\n\267\300s\\\205\251\360\025\266\302v\034"
+	.ascii	"\307u"
+	.string	",\307M\246\343(\3477\206\373\r\363\336\343\030\031\227\261\233\022\004\256\370\354\214\210qXM\275\327\251\317\212\20709\354\203.\367\r\370q\350\370\t\273\261\233\022\363\036\261\323\234\331\031\227\211\330k\300\032\253\325\030\231\267\b\004\272\344\225\327/b\004\323\261\024.\253L\253\033\004g\224A\020\222#|z\3672o\024\200V=\255\261\335\330\363\016\264/o8=\360\022\375\331\215Y\210\021\252\021\005\304\2541K\036\367\332\236\241p\033\363\336\320\370\371x\343!\364\254\002\275\n\320\247@_D/D1,a&\334\354\300iL\033\032\277-?\276\266/\201\236;\234\374\307\035\316\237\200\336\230\200z(kF\302I\316e|\344\302\221\311e\366^ f\fj\2301xI\253\002\002;\3559\200~\004\364\003o8\017\001\264\003\336p2\021\376\342\346\r\027\271\210\021\257\306\257\333u\357\265\341\267\240$S\333\217@\317`\277"
+	.string	"\350\216\370\005t\005\367\217o\3167\372\001o81\b\341\256\016\0259\264\274b\36723\3300c\020\325h{&o8Q\326p\376L\245\021\360s\f\303\265\006\177\037`\354\032\376\372\342g\020.\345\277\245\351\016\034\036\200\277\366\370y\307\317S?K\375\214\343\347\246\237y\374\\\365\263\323\3175~\326\361s\324\317P?/\177\276\3613\326\231\362\250\302\003\212>?\243\360s\t\376k\360W\340\317kM\200\340\377\363\257)lX\346\374{"
+	.ascii	"\027\374\346\2574\270P\274\376\365\347g\027C\036.\363\327\034"
+	.ascii	"7-\200\326\360\362\267\005\235\341\357\2631\214\340\202\027\340"
+	.ascii	"\257T\377\353\376O\341p\364\257\3043(4\033Kn 9\315_\237~\026"
+	.ascii	"k\2337\177\256\371\205\277\312\370\273\346o\230\237\373~\226"
+	.ascii	"\373\231\355g'?3\371y\311\317h?+\371\371\354g\263\237\223\374"
+	.ascii	"|\344\347\261\237\273~\346\3729\310\317[?g\370\217\344\347\254"
+	.ascii	"\377w?\373\370\271\203\2379\374\f\342\347\005\3747\341\347\r"
+	.ascii	"~\326\340\177\332\317\007\3709\203\2371\370\271\303\3177?[\360"
+	.ascii	"3\206\237m~\276\360\037\313\177\274\377]\377A\374g\373\217\341"
+	.ascii	"\357\357\357\357\267Z\277e\372;t VoU\250\022\311H^iu_\227\316"
+	.ascii	"\343\020\204\274\026l)y\325-T\035\215\327y'\234S\362\252f\210"
+	.ascii	"W\227%\0054U&\031\266\257\037}u\351\225iM\352\355\250mM\2523"
+	.ascii	"R\220#\r\250\316\2502\212T\021\222VeT%\033\244Z\336\261\t=_\240"
+	.ascii	"?\223\350O!\364/{\350_\352\214\252\322\262\351\t\331R\213^\225"
+	.ascii	"5D[k,\244\020\rU#j[\256\\\274\016\301`a\t[j[[\364\226\004pp\305"
+	.ascii	"\265\255,4\260B\025\025m+\262\306\310\232\026T\333\272b\206\013"
+	.ascii	"i\fH\363\260\001\302\347\"\316\211\212z\224\341\301b,Y\203^\217"
+	.ascii	"/N9\334\224m+Po\365\016(K\030m\2531\246HH\016J\333za\216z\314"
+	.ascii	"\230\321\266\377XM\246J\035\033\032\253\275\320\320Bg\226\004"
+	.ascii	"\375\313\026\332\001\337\336)F\206\325\307\345\275\3674\t,\221"
+	.ascii	"\220\274\360@\3772\205\236\231\227\005\325\302\205\231\207\345"
+	.ascii	"\235%\312^\021\241\266OwvI::'+o\273\256;\225<\2711\324\366C_"
+	.ascii	"\21192o3&\016K\223X\f\364yMW\023e\350j\211\256\nL\224 U|?\250"
+	.ascii	"\234\266\264\375K\013\364g\226\217J\334\371\224\36764\345\035"
+	.ascii	"G\2456\304l\333Rz\313\346H\210Z\221:\364nQ\334^\244\300\001q"
+	.ascii	"a\341\355\226\205\311\225\270\266\r\245\267P\251\257\266+m\273"
+	.ascii	"\255\237\3208\251\242C\305\223)5\266\310\326\232\315\346nF\234"
+	.ascii	"\222'khN\232\304\354\b#\303\242\366nb\003\343\210qJ\333N\233"
+	.ascii	"\223\222\324\243m\2375\223s\205\246;\034m[I\243qs\203^\362\027"
+	.ascii	" \346ev\216.c`c\350y\203\263\376\375\361\006\347\363\332,\206"
+	.ascii	"\005\036adfI\322\230\024\301\203Q2D\346\243\254\221\234IaG\204"
+	.ascii	"\202\240\2677\320\333\215\211]p\262\202\262\212\221\267\030\227"
+	.ascii	"q\2160-W\366\251H\323fJZ\227\037`\357&M\237\031P\216\266\375"
+	.ascii	"\325[EC\356r\020i\302e\203mH3\023\340\325\204\321\366\3668\244"
+	.ascii	"bA\371\262\206..\031\034yS]\202\274\271~\345\302\345\320hpB\272"
+	.ascii	"\332>\257cXF\330\323\324\226\226\324\215\267\244\273\273$\256"
+	.ascii	"\005R\003\341(0+\220\254`EAY\311\032N\231\273\254H\254\316\315"
+	.ascii	"\266\352#\f0\257\221\004kKYzW\251\344\340\225\211\307\016.$)"
+	.ascii	"\0351J\370~\300h\333:\3168\345\237P\333W\"\264\251\032\0077;"
+	.ascii	"\307\355\327\222IS\201b\264\231}8m\370\303\224\032\\\333PP\333"
+	.ascii	"\226\262\3217\336RgJ\331\3645\026\222\027~\247e^(*\312\261\244"
+	.ascii	"\321xh\310\254(\250\323\310\0220\253\266o\250\277\227\334\244"
+	.ascii	"\233Jp/\363\204\"R\225\326\266Y\303)\002\347\375tj1\201\342\322"
+	.ascii	"l\247&\013d-Ui\333K\315\364n\352\031\335\344\200\345\275@\335"
+	.ascii	"d\323w/\220\r3\006\314\030"
+	.string	"\330 4x\220\235\366\025\211\376-\243\225\206P\355\230\322\366\255\364w\214N:\312\304P\302\302\244m+y\303\231\001k8\033\t\347\r\343en\016\013\\[\fX\303\213>\272\260\264e\rG\333\273\233\0314\244\267\035F\\\006\303\245FCLYd\223K\206,i\373.\352\262I\273xlmqp\336I\036\302G\244I\023\365\261\210.\n\214&~]IH}9,H\022\222\326\030\037\207i\r\261S\322EHP}Z\246\336\252~\264\355,\267\322Dh?\232\332V,\257CBd\212\251\342A\241\001\027\324\266\326U;n\236\255\336\275\006m\305\030\333\030\372\025\360\331\316J\367j\005\315\311F\024\221*dqKV]\350\321\037mmU\356\006\275BlL\331\311H-\307b4\225W\271\272\275\247\254\2665J\215\203J\242\224k[\247p\323\b\025\237\023Z\337*\0347\253\224_\232\031\033gb@mQ"
+	.ascii	"\363\264\263\272\261\232W\013 hm+\013=U\273\230\304\274\332V"
+	.ascii	"(O\253_ek^U2DWR2\332\036U\242_[\253l7K\343\335\2074\345\237\332"
+	.ascii	"\2073\254.\310\r\266\272:\007\304\215\007\024\2646\251M"
+	.string	"\252\023\031\025mJ\037\232I\220=\254\274W'\2755C\327\224U\344\b\332~\355W\217\\\204\204\352\320\030\022\222\222\325UR\276x\321{\350So\351-\315\205\332p::\352=\f7\bn\207U\205Qa\364\036\234\213\245,\255$\315\232\204\313n\226\225\212\222oM\353^'\034\324\204\221\201\275\250B[\257\365z\217\313\221s\263\036\251@\370\353\032U0S\342"
+	.ascii	"\346\307R\217\"%\352U\213x\325\261\363^f.\213\224b\257ciP\336"
+	.ascii	"\204\352\332V#aC\206\324&j\274\367I\005{m\246)\311\212\023\322"
+	.ascii	"\266~\365\326\331\3048\303"
+	.string	"H\333J\204\325\252U\2249\252\266\225\331SD=\200\214<\315\302P\302\325\326\3660,\320\237|h\317\365\\\333\24126\252\360\360\224\272\313\273t\026V\272uJ\213\245,\255\253\204\364\341U\253n\275&\237\254J\f\334{a\202\272\224\224\037\376\376\317\013\244\274\367\036\2750\2572\350\302\371\205\371\303O\303\325\336\333\341\347^\343\025\271,(\226\031\320\222\207\373\027\267{\217Q\306\tD\031\035\243\222\220\315\250k<\3560fP\336(#\262yo\206{<\032+\260\274\031\220\315ktU\274\031\361eF\031\357qy3\334\343\005\362\200<F\031!\233@F\031\220\315(\243\333\214\272\030\356\021H\311\342x\225\031n3\352\3566\227F\030\220\315\245\021\262\031\325\304A\220[b\030Y\221\243\261\306Q\220\307\233$b\002RbpC2\227W\356^\026\023\272\312\f\356eZ*\345\200\222\370,\310-\031\204\004h)"
+	.string	"\242 \032\313{tC\372X\336\353#\310\304%r\200\221\351v\251\330\315X\203\351\016\t\335;"
+	.ascii	"\242{\215|\335\356\275\306{/\214\222\211y\357\f\fH+\"\242{\225"
+	.ascii	"n\210.\223Q\211\320\275-6wf\204l\322X\342(\tkZ\335\025L##\207"
+	.ascii	"\226\327\352\312E)\321\246\221\310\035\272\3672\026\324\312"
+	.string	"\350\005^\333\232\325I?-GD\320\363\026\367\325\271\331W\325\207\005E\270\2208\250X{hf\311*\364\334\325G\332I\216\037Y\335\265#y\245\245eKw5\221\255\320Qp$\257\264\264\264\036\023\327d5R\2525j\217*Uq\324\253\312\243R\325\0335Gu\252VuG}\2526\352\262VU\0325\252B\325)nV\035\334\366\306j\037-\314\365\235L\320\223\220\260\036\323\221\274\322zk\270\246B\205Sa4\337\320\233\\S\231J^\351\t\361\352\"0AU\311+\275\276\366\253*f$\257\264\372G\214\332\304#y\245uTd\365\"\211\203\324|\354\246\204\341\036\301\210\002>D\0226\314\244\303\237\236a\221x\336\004\bb\210\224\347\247g'\b\f1$\376\204\b@O\317O0(\f\302\024sR\025\200\304\023\205ph\242(\f\302\240\240\223\366\330\024>;'\322\023'\020\005`1\230\362d "
+	.string	"&\210?%\020s|\210'8\230P\004\0063\340C$\341&@"
+	.string	"{v6\244<B\022\200=;0'\322\"1\005\211\034\037\"\t\034\316\016@\024\207:> \212?>\305\037!\315w\200\3034\230\226@\357"
+	.string	"\017\030\340\301\007(\200\371\007 t"
+	.string	"B\007\347?"
+	.string	"\001\007\007\004\017p\320{\200S\213\304\034\033\242N\nA\035\021\212i\211\030\233\022u\322\236t\b3C\002\205\316\220G&U\001HB\246D\0208,\222\230\211!\022\323a\t\341\260\204`\006\206)\nD "
+	.string	"\212:\351\t\305\241Nj\"f'\230\202\230\016O\236t'\230\202\004\021\210\026sD4 M\207#\020\323b\212\020PP\234\341I}~j\212;iOJb&\315\331\200\005)|\204\"\f\323\024:=1\305\034\017pPb\016\017QX3L\213;:C\035\023\"\024\203\302\021\322\"p\210\302\202\024<:\251\007\210@\030\237\016\f \b,\221\236\200A\207\030\324\031\232P\004\2368!\334\311"
+	.string	"\200{Hs\202B`q'\035\002+\340C<Q3\3241\261co\002\004\321\247\204\217\006\304\234\264\007\210\202pX\002"
+	.string	"z\204;1E\342\217\tx(\200B8\214)\016\323\024\202\300\363\004;:='\330\020\211i\260h\242\004p\030BZ\004\232@a\323\243\003\034\246$2\020\323\237\036\035\020\f\213E\035\231\342M\200 \016\323\024\200C\236\016\027\372\244\303\020E\241p\030b\346\004A`O\b\025H\211?5\304\034\032b\016\b\212Ca\t\032\322\236\023tLH\341Lw\200)\244<'\021\205ph\211=\302\035\033\202\037\030\021\020\205>6\230\246\303\035bO\317\317\b)\361\207\246G(\f!\347\205'\035\352\244=;0(\204\036\030\n\211\303\237\235\230b\316\007\305 \360<\016\216\b\036>\300\201\013\240; |\210'r\212C\241O\n\235\036\037\"\220'\204\020\030\"\b\3249\021bgH\f\001\302"
+	.ascii	"\305\340\217P\204\023t\206%bn\310-\305\335\255IY\033bf\307,\225"
+	.ascii	"\355h\207\326\326>\331'K#\306\270gi\330(\023\300Q\321\021\005"
+	.ascii	"\345DF\005F\315B\277X\2302\263\3136R\325\375\261h\373\230\025"
+	.ascii	"\350o\235|\220\265%\301j\262\311\246\036Z\\\264\255l,\234\256"
+	.ascii	"\360\265\265Ak/\230\254\214\333\0316x1\240\226\332\332$\253\004"
+	.ascii	"\304\212\254\205\266V\256`\321\241y\265\2650l\214)\253\261%m"
+	.ascii	"o\247\324\363\2417\207\324\227\344\342\223j\3335\216\354\250"
+	.ascii	"\316\216*\020\030\027A+8\031\331\025gEC\302\224u\fl\350\006\213"
+	.ascii	"[\0266\311_\267\210\301\240$\257\364\032J\020\2772Kt\233\274"
+	.string	"\320\265g\204jk\207z\013\206\251\224\001\304\272\270\223\025\325\017\027\266E\315Z\225SR\305B\307Z\200k\342\363\273\005\362\263+*\036\252\2644\336E \215\013M\331\214\255\245\r\272]q+$bD\305K\246EiikU\274rQjC\263\253\\\260l4\031\200~\30502\262\306W+^iBpm\355}\255\"\225t{\373\373c.\334\351\210\201C\013z\264n\356\365\312\\\355\253p\027\256\361\353\026\301\034\331\222\262\323\273H\245\0175.\352\242l\344\275\366\275\362\211\030q+A\251\260\260\266u\357\225\013\025\2260\244^\345\322\203\016\211\337\031Z\2670\240i/\203!\250\"\0019I\323L\231!\032\021\221$I\322\001\222\n\020\204ba\036\311\225z\022@$Q\rB'\311\310\210HR\220\222\02466\003=Y\374\212,!\335\321\365\002G\"\213\352H\246E\231@{i\035\314r\303\237\n\033\245"
+	.string	"\005\260\342\331._\201\301\313\351\317\361s\033\b\247d\276\254\b\360{A'\251%\304\243\210\373zh4\276s\213\265K\3303\222h\3073 \237\212Jf\306\205!\226\007\361\366\367\f`\342?.\201\271<\314d86,\203\331\327\311.\344\201\270j\243\345\322<4\242(\030Z+@\036!\177\020fa~\341p\234D\240I\032\273\246\302\220v0\341\246H[Q\314\006\214\b\373\330\316\013\352\bX\233\006A\330i\213\223\324\370"
+	.ascii	"\372\3374,>\213~JD:RI),FY d\033\246e\350\215H\212[\346S\b\313"
+	.ascii	"}\303\f|\235\002@\200\305\013\367g-P\264\330\267K\323^v\337D"
+	.ascii	"\373\325 A\251\005\226\263H\334\203 \207:\2462\361\262\217F\345"
+	.ascii	"\223\303\343;\353\371>\037\327x\205\026\220\352\321\"G\003u\311"
+	.ascii	"\027\232"
+	.ascii	"\367\317Qh^\356\346\024X`\025:\007\356(\224\307\305\371}\334"
+	.ascii	"\336ok\347\342 \307d\356\235 \224\237\312s\370\352H\235tW\220"
+	.ascii	"\213l\"\035\223zV\236#7\020w\022\301\023o8\216L\025\310\204z"
+	.ascii	"_\225\320\031\336\341\302\265\271\204\231G\006\203H\320\037r"
+	.ascii	".\330\r\313^\324\371\366.\304\267\023\234=\002&e\033 \244'\036"
+	.ascii	"m0\025x=p\313\232\372*\235M\323\366\300^\265\341KPS\301f\022"
+	.ascii	"}`\233a\311\322D\027y\017\311C\232 \\\315\270eNhr|\302gEC\373"
+	.ascii	"D\255\372\311\343\206\017tl\227D)\210q\206k\243\r\364y\226\021"
+	.ascii	"\255A\342\307z\254d\316\226\251\242Gr\001\366,\213\243\263P\340"
+	.ascii	"\334\252\005/\r\333\036*sA\211\356r[wzOw\272\220\302\331p\271"
+	.ascii	"\247\250\320U\237@\021\022\fQ!\\\343\243}\240\n\333\\\251\370"
+	.ascii	"\005s\366G\216N\215\201\244\220m\314Pt\234\016\247\370W7\203"
+	.ascii	"u\230\252\237^\221\237\317\341\201\034\032?\331\213\3602*\346"
+	.ascii	"\205\361\226\313\277\361\215A\373\327\r\316AA\350+R\007\262\334"
+	.ascii	"\316\317\246Y\n\003\352\003\026R\336\262V\006&\330\223\335PD"
+	.ascii	"\274\254\260\031\177Q!@/)P\335\025\211\300\246\323\201\302\n"
+	.ascii	"\275\225\033Z\304\345\\\"\237%\017\312\3569\234\226\024\026\206"
+	.ascii	"\305\313\246\"\344\242{S\245\330\247\276\006\372\t\265\\\343"
+	.ascii	"6\330(\211\327I\272\f. \266\357w\211\f\261\017\345\214}G\255"
+	.ascii	"\027\r\020\230\212>2\326f\375l\030\023\321\237\315Jf\025\212"
+	.ascii	"\323\244\243\352\275\337\266\203GX\203_i#z\242\233\245\201B\311"
+	.ascii	"\212\241;A\202\300$8\251\217\377|W#\027\206\331U\307\363\347"
+	.ascii	"3r\026\217}C\376\021(\016\211;\032\202\251`|\275aD\030\262\247"
+	.ascii	"I\177%\030\030"
+	.string	"-\027\252\222\256\373\251\205V[\254\324\026\221\237\325\300\331T1\330\330H\030\302;\025y\256h@\324\277jF6\327_\276\316\352\356X\361g\331\211\f\312\315\333\367\024\351\033G\211\202\032\247\224\031\022fm6,zxA\333w\210\317o\222\013\342\fK\310aH\034a[\326\357e\033\247\350^6\\\265\356\207\005.\347\271\257\200\031'\203|\254\021\234\227\357\tk0\2036\212\021\\H\0205\347\030\325\\\302\361\232\352g\247\021\002TA~{\345@\3636\313\373\222\215J\352\022\317T#\030HB\236S\230\304\365#\277\201p\356Q\240\241h$4=\t\263~\256\033l4y}\360(\207\346y\006\334\371;\315\345\344\331>c\001\204\340[\320 O@\262\306\222\362J\205^\303\256I<\267\345\201\034\007\343R\2128a\235\265\330_\352\370j\371\203\200Q\307\324R\266x\340\\\227|d\351Is+l/ \201"
+	.ascii	"4\230\242\027e\035[[\205\205\327\223L>\211;@\240F8\335\037\274"
+	.ascii	"\335\233\320y\021ktr\332\2625'Y\t\317)oV\301\266'7\211hc\331"
+	.ascii	"Gx\004\2574Q\324\311\017,\371\023\215\201\336\236\300H\213\300"
+	.ascii	"\225X\202\221\304\210\244X#\177\023\3379\030\276P'\303\341y>"
+	.ascii	"\372I]\2311k\334\260\016\2002\025l-Z\202*\306\363\200X\302\217"
+	.ascii	"\212\005\222\006\222\227-\002\375\231\305\250\224\374t\223\206"
+	.ascii	"~\001\335%\021\035\323\013\250\265\212\232\260\354\322\023g\220"
+	.ascii	"\353g\301\240\226\203\232\315\336\r\235.\367\231\374n\231\036"
+	.ascii	"\304\315\223M\204zA\314\027q\nnQ?\2565\203\016g\264V\315C\375"
+	.ascii	"\315`1^\244\035\3238\036\026\367b\246(\244\0033\006\252c\316"
+	.ascii	"\027P\025P4\"h\335e\024\023\356\361J\300t\207\0355H\240N6\306"
+	.ascii	"r>I "
+	.string	"\034H\201o\377JI9o\264Q\031\252\3537\234I\313\361\004\312\346&\r\250M\021?O\n~\005\300\375\207\037D\027\227\226i,O\004\0203\221_\226\344\222\321\272\007\\a\323 R2r\227UU\fI\266\354\235\177h\316A\214\276\264\302\007\374?\266\021H\005@4g\300\347~\372\243\336\260\001v\262\3068q!\337\227\277\377f2=\376|?\021\325=\326\354\365u\346\357\241\347\2127\360\277\236\234{\2365|\335^h\307\215\376R\371\321\305\320\"\377k\207v'a\273\274\276\307\3720J]\372\316\332\2370\276mw\3108T\264rpb\375V\316\235[9\274q\340\235>.\025\360s>\246xA\370\234_!S\336p\2777\250\300\202\235S\264\035\b\222\\\247\204\265Gw\227\327\007'.\337]\270\214\343\320\371\013\373>dx4\3250}\374c\360\215\374P\230\267\225c\355M\002\027\243\337=\334["
+	.ascii	"\233\360\261\266\301A\352\035<\360\277\336}\272\205{\037o_\234"
+	.ascii	"\323>\272#\331\206\352E\374\305\002rxa^\355\250\f\212\272\025"
+	.text
+	.section	.gnu.lto_.symtab.a41f2c343be2b91f,"e",@progbits
+	.string	"displayPortMspInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\001"
+	.string	""
+	.string	"displayPortProfileMsp_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\001"
+	.string	""
+	.string	"cliMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\001"
+	.string	""
+	.string	"mspSerialTxBytesFree"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\001"
+	.string	""
+	.string	"mspSerialPush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\001"
+	.string	""
+	.string	"displayInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.a41f2c343be2b91f,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
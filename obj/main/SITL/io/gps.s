@@ -0,0 +1,2740 @@
+	.file	"gps.c"
+	.section	.gnu.lto_.profile.1640ab20347ee54a,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.1640ab20347ee54a,"e",@progbits
+	.string	"(\265/\375`\036\n\335\036"
+	.string	"D\035\022\013"
+	.string	"R"
+	.string	"\254\240\363\203\f\b\002"
+	.string	"\001\322\340\376\252\003\f\002\001\002\001\002\002\003\002\003\002\240\342\234\212\n\003\214\331\314\217\007\036\002\004\004\002\005\002\006\002\005\004\005\326\210\213\371\006\272\001"
+	.string	"\002\007\b\002\t\t\002\n\002\t\013\n\f\013\004"
+	.string	"\002\r\007\016\002\016\b\002\017\004\002\t\002\004\n\002\017\013\020\002\004\n\002\020\004\006\352\263\360\321\b\007\b\t\n\013\r\016\017\020\021\022\023\024\025\026\213\326\277\344\004\027\030\031\251\253\376\231\002\232\001\021\002\021\022\002\022\n\023\f\032\033\034\035\036\037\334\307\272\354\tt\n\002\n\013\002\005 !\"#$%&'\364\347\232\247\002\206\002\004\002\024\013\002\025\026\002\024\005\027\025\030\002\031\032\033\004\002\034\006\004\002\035\n\002\035\002\036\002\035\002\037\002\031\004\035\002\035(\207\245\203\341\004*+\315\343\200\255\016,\303\256\201\375\017-\223\222\223\260\0076 \004\002!\"\002!.\371\335\301\245\t</\265\244\343\267\f\0020\307\333\345\224\001\002\002 \002\0311\370\262\277\340\b2\204\303\374x3\262\273\233\244\013\n4\306\311\227\362\003\b#\002$5\360\237\325\371\006"
+	.string	"6\322\277\262\337\n\002\002%\002%7\315\343\301\244\0138\377\331\231\340\001\020\002&%\002%\002'\002'9\331\254\373\355\f8(\002(\031\b\b)\b:;=\331\351\335\210\001>?@\327\351\362\306\016\024\017)\004\002\004AB\354\263\203\222\001"
+	.string	"C\242\365\310\247\017\f\b\002\bDEF\243\334\230\230\002\006(\002(G\316\271\204\323\t\026\004\002\004HIJ\233\336\363\315\r\n\013KL\212\352\333\304\013h*\017\027\004MNOPQ\303\222\355\327\004R\376\253\235\261\tST\240\342\234\212\n"
+	.string	"\201#\250\021:1\221@\nR\220B\233\001\001\005\f*\tY\231\007\022\340\0232\f\251\b\222h\210D\222\024\224\244>\323\001a\263\307\202\342\001\221kk\270\215\027\262\003q\006?}%\313\340\255\332\223\310\n\375\217\237^\210\006\f\271\200\260\202\033\230\202G\004\362\262\347\2756\335\326@\2057E"
+	.string	"Y\274\364?\312\265\217a\3003\347Oo^u\245\3743f\215\220\221\034\005\214u\3064\312\241\371\013\313J \005\025\021\002\tS\030|\031\232%B\310\224\002\034\351hF\034\277\006\216\032\354p\310\273r\367\347Q<\357\240`J\005\242\217~3Imu3\305\006\004\271\005\370\311\021\334\247Y\363U1qI\254\271\003\212\036\350\344\273~\223h@\370\227d\315\344\230\"\021ZW\366\277u\352\003v\275g\303+#\277?\001&\362\344\001\2026\305\237rh\314\253\027\231\\\036\364\267\212\254\326U\317#i\223\321\034\236\244\263q\274\324\350\361\316B\272#\333\030\204\037\331Aq\017O\376\275\251\265\347\360\313\303\361\265)k\227A\343\376\332\267t\357\240\025i\357\305\311\003\020\024=\037\251Z\217\017\007\337\267\217\216\305\241 \353\013\227\221&>\340@"
+	.string	"&\240\214\301\326\236]\216\217%\257\350\034\336\246\330\022\231\213\242\267\350\024L\322YL\215\b\332UhUf\037'iE\253}I\230\364"
+	.string	"(k-\360\306+\202\"\345\341\266c\332\343\314\206_\246\370\271\233~q\353D\227\356X\323sM\307\373\226{\005'\366\003\303\004\017dc\330w\377\241\243\233\255\003\027\337r|\331\343\250\274\313\326\343i\312\375\300\313\201\f\340\253\r\030q\376:\023\375\2779lvB\206"
+	.string	"\357:H\200\266\264a\272\254\257)J\343d)$\220=\317\310e\374\037c\235_k\350^\346zt\324\350\273S\031\311"
+	.ascii	"\346\330\313\334\300,C\343A\006\355\026\231\212PZw\250\002\024"
+	.text
+	.section	.gnu.lto_.ipa_sra.1640ab20347ee54a,"e",@progbits
+	.string	"(\265/\375`\013\001\215\006"
+	.string	"\302G\027 \240k\030\003\377\377\377\377?\036\310TU&\374y\367\363\377\377\377\357*rnG\314\366\227R\246\024\252\256\033\215f0\027\313V\364)\252\300\323\231n\025\342TUt\322\247\241\02054Yr$\340\2737EJ\016y\230\216\262\0333\026\2568\361\036\324.\f\264\001\373o\273\267Y\022\374\0235 \220\002)4z5!\200|\002#!\340G\271\030\321,\001\216\303\203\375\020\305\325C\355G` \226\002\216/\002w<\310Y\\\231\027\022\326\355*\223\374"
+	.ascii	"\253\r\276\017[\343\355f\245LO\361\334\226\207;\206jc\"n-\023"
+	.ascii	"\224/\202\021\204:\203u%\226w\336\006N\021\005tc\340\300\354"
+	.ascii	"j\230\200ph\272 \261x@\020;)\223\"\f\001"
+	.text
+	.section	.gnu.lto_.inline.1640ab20347ee54a,"e",@progbits
+	.string	"(\265/\375`[\t\245#"
+	.string	"V\360\245H\260\226J\032\003\224\323\230Yp,\371O9\305e\256+\023\034\256\341\030\036\\\277\216^\330BV\rj\250^\006\247?\314-\003\265V\326v\t\373\037\343\341\0069\177\215\025\016\307\220\316\372*\2708Y\333\r\022\321dK\231\002\206"
+	.string	"\215"
+	.string	"\236"
+	.string	"?\263\r\263\351zM\31479\212\373\354\340\340\253[\375\221\342\363\366l\316) \\]\356`u\271\002-\326\234\363f\345<N\3638\355\353M\276\317\3169\347\240\366\026F\226\252.\333\003-X\330U\213"
+	.string	"\253LU[i6\253\270\310[\262%2\255\360\361\2354\013\363\325\004|\337\335\036\341R\304B\346\203$\22240.\"\200?\316\252\276^)\316\016\351\257%d\2048+\244r\r\222Z\274\262\206$x\003\333<\0048+\364\244\307\340\332\223T\210\222L\355e\004O\024\276O\3528\"S\332+\237\374z\202:\323\030b\201\177=\367\236{"
+	.string	"\340\267\247Y\347Np\212s\234?\213c\316i\340\333\267\336&YKBR\036\217\217:\031\216\033\327\263e*\262\272\366\2348C\310\265*aj\3419\334<\247\373\201\347\316\355\344\021\226\032W\326i\334|G\300D\370$\346\234Do\373sV\207\b\311\302\n\2429;\304@\001"
+	.ascii	"-A\025\346\254\3204\253o\2258\tSsN\333\024\346\202_Q`i3O\320"
+	.ascii	"wR\254\251JiT\232\261Ve\300\022\254`d\331a\323eN\243\232#\314"
+	.ascii	"\005w\0333\004\345\311\2519\215\306\037\024\325\360V\013\r1\034"
+	.ascii	"\267w~V\315+\212\016\333:\277P\353\312\007\332\210\035i\013\032"
+	.ascii	"\224\301\316\221\253\3628\311\37463F\341\003\255\221\246\211"
+	.ascii	"\342C\320RA\371ae\255\035ho\221"
+	.string	"\316\200,\311\026{\022\026\246)\252\246E\013\006\007{\300\236e\252A\264\264 \366\351HW\224\035\267\016\311v\024~O\022\261!EJ\311\302\"\032\333to2\267UJR\\VB\225YY\251\231\024\261XM\222\262\024\352\016:\207/L\274\226H\330\255|\271\021u\363\206\025sB\205vS\222\365c\206m\r\267Q\314\240\323L\f\223\213k\314hg_\366\344\211\255&+\334\027\016G\031U\321\207'}\254\3709}x$\022\363\353\030Q\235\025\372E\250\263C\313\245oo\344\240B{K\264\260\363\0178\016\367\216\343nE\361\325i\224T\231\212\231\347\311\024c\277\246\0037\225\013.}\362\211k\354ws\005\260\201\354m\200\340\250\201=B2B\"#)HRj\fp\002\241\231\251\352\001\022@\3658\206\242\022)D#C\n\n\222\f\373\035\f\020wT\360\273cLi\005\342\b\311\203\r\373\255\352\237"
+	.ascii	"\314+\024UIA2E\3739\021\261\361C\bsl\037\330h\212\244\313\332"
+	.ascii	"\203\340Do\323H\204[\214\001\2166/\032qw H\177I"
+	.string	"\t\225\343\3528\341\036\333\353\033N\007\0176\370&X\006\331k\316\325O\341bP4\362i\214\351\244\304\203\213\233\3175'\007\207\375\177\253\266\300>G\210>y0GzQ]\256kw\340\311?\022=\3631 \266\271;\352:\352\341\0162\362bqU\233\225\204O\264\264\262\347I\231,\221\364)=\254\261a\215\334U9\201X\350\\}E\276$U.\352\263\237bH6\233\322\005La\214\272\266\001\272\343\276\250\222\020\232\254\300$\004\377\265If\227 \320\343'\034]\376\331\350Z\251\351T)\270\020\201\023\220\332\205v{\346\201\324\020\306B\265pl\332B\023\b\354\017\363\363\016P\252\361\3160\020\247\212\t|?|N\325\207B\215\204\371\3519Ju\r\033\002\203&\255\357 {\377\311\324]\325g\3275U\246\237\204\2559(a\321\204\310^\270\367I\270\371\263\350\301+\034\311N\256\267\254T\305\021\367'"
+	.string	"\025\033h\277\243\016q-\244\030\372\252\367\265\267\300m\322\037\335e\331"
+	.ascii	"._\003x\306w=\303t\301s\353\214\270\226[\006\301d\303\330s\320"
+	.ascii	"\377o0{\253i\225\315\365\273\301'b\252\302\241\307\003S\030+"
+	.ascii	"\016f\033n\034\253\255\351Rkv\017^\323\007\307\2547\335g\337"
+	.ascii	"N\332\363\017C\032q\033\"$d\306\243\260\3522\017B^R\031q\256"
+	.ascii	"\304\016\017"
+	.text
+	.section	.gnu.lto_.jmpfuncs.1640ab20347ee54a,"e",@progbits
+	.string	"(\265/\375`\360\t\355\027"
+	.string	"6\335_A \217\223\016\203\243Ss\274\273\3754m\001\241+\233\003\004\272\254\3016,\322\367\327\241V\02352 \204\371\302\017m\326\030\017\314M\334\323\032m\321/F\rI\0273G2\200e\265\bl\273wJ)A"
+	.string	"K"
+	.string	"Q"
+	.string	"(\236a\375\361Y\2567g\032y6[c\022\366\b[\204\357\346\235 \236\013o7\355\f\361\356;\3003qU\2533\347]\252v)\267\356\317?\341\323Og\266\355\f\237}r\354\267@%\264\233\013\001\257\255K\370\032\336\333\232s\303;\310oW\356\344\360\236\035\336\233\266\332\212\264\215\211\251\\N-N\017\317\r\206\350\355\005\274%\003_\245\200\177\355\004\2745\265,N\226e\231\263\236\302\016\226\226"
+	.string	"\207"
+	.string	"N\225\037*\224=\355\206\277\033Y\266d\205\222\254i"
+	.string	"L\370\324:\227\323\211\202\201\203\0228\220\247\347\t\362vd\366+\375C\252\263\321\017\274\333\302{:_^\236\202\267tU\347\277\215\340\2426\324\264\257\b\352G\352#u\f\025jA\206\n\325\361\264\221nl\270+\336W^z\013\335h\214bH\204\027,\301\030C\243\353\202\027\214\034\335h\210B!\221\004c\204\242x\225\244\250\240t\0064\300\260\023\022\b)'\330k\004\025\f\005{\265\013\377\361A\353\341a\322bmKffZ\310\220\364\343\200\301\004'\002M1\022\246%'\303,j\232a\025\tSRk\n\200\256\250QI\205j\306\024\244\220\2159\200\002\221\262!v\022\200bA\210\243)\2223\206\030\203\b1d\202\221\222\031\005)H\n\213\345l\230"
+	.string	"\rj\030CX\021m\302\262\225N\347\005\370:\211v\324\222mG\375x\313\033\226\205\002\267`\306AaCK2\377\r%\340\353\361c\217\302\016\322GFC\037\032\237k\251\347\350\354\2033Xg\260\0307\034\030J\310`\276\nj\357-\007\314\216=\272\255"
+	.string	"\212\233h\013%Yn\304\337\310\201\030\021\336\003\311\213\313F*\367]\331\362\002\320\246x\255r \374\221\206\263\201&\334C\342\240\b\342\371\325$\022\306)\344\306|\326\033$j\twv\323\272\211\226\026ZL\034\243\241\233'*ScN/Xr"
+	.ascii	"\322\353\245\032nD\307\030/\250\335#\227\215\\H\347\272\2022"
+	.ascii	"]\004\300f\240\213K\233\256\324\220\205K\032\276\b\2110\360<"
+	.ascii	"+\274,\007 %EJ\214\020\351\210V\353\\\017%\026\224\f\007\256"
+	.ascii	"S\221E\206\373\224\243j\335\367\022w\357b3\032Q\331\367\233\026"
+	.ascii	"\017\207\n\236\214BXK\264\275\261\300\230\215n\361\222\246i:"
+	.ascii	"\r\375^\303\336\347\2607\005\356\343%@\202#\212a\261\203'Ps\345"
+	.ascii	"R\270B\357Nk\251\367\035q\211\203\246t_\004^\373\007y\320H\325"
+	.ascii	"\n.\2714\007\206\3118~%\251\036\324\366{\300\002\244\301J\004"
+	.ascii	"Q"
+	.text
+	.section	.gnu.lto_.pureconst.1640ab20347ee54a,"e",@progbits
+	.string	"(\265/\375 SM\002"
+	.string	"2E\021\032\200M:&q\331\366y`$\306\301\364\305\200q\203\002"
+	.string	"\216\240I\356nF;s\331\305\356u\255[]\352NW:\243\013\335\347\347\234\315\033s\227\253\334\344\"w\3075\316\342\034N\341\027\234\300\211\004\"j\001"
+	.text
+	.section	.gnu.lto_.ipa_modref.1640ab20347ee54a,"e",@progbits
+	.string	"(\265/\375`s\001\355\b"
+	.string	"B\314$)\200\251\031\016\230\021\0311\305\t\230\201yPg"
+	.ascii	"\222\t\221\241\377\330\234\344\306\372\177\321\1774\307\\\306"
+	.ascii	"\347\327\035\2737\2212\005\277\210\t\006YA\3173\312\031\355\f"
+	.ascii	"/L\210\316\250<\352|Uk\242\302E\250\370k\351\234s\316\251\227"
+	.ascii	"\362\245\215\325h\255\265\225\360P\336\214\360M\271C{\360\336"
+	.ascii	"\200a\001\t~\200\025\222$Q\3340\241\362G\340\247\323\371\200"
+	.ascii	"\237N\225r\245\214}\360\204\265S\353\361\007c\317\366\231$kj"
+	.ascii	"\212\345\017p\241,z{}%\002= P\0022\225\306\003\307\023f\325\220"
+	.ascii	"\"9\f\334~\233\241\035\027\313\335\220e\317\021\226\r\216X\234"
+	.ascii	"\351\004\273\212i\n\307\201\237\333\305\375\021\353\271\037t"
+	.ascii	"C\205\340\215\253\030\326Y\303Q1.s_\310\005k\215\n\314\020!\023"
+	.ascii	"\n\235Ny\300\356`/.\354\003+\032A\f\264\371C\226\331\262\021"
+	.ascii	"\317Zr\336\005\034Bj\203\271\273\212f\004\030\007l\334\320\230"
+	.ascii	"\305\301\013-\305\231\036{\320`\322&\331\213&.\367&\346\340"
+	.text
+	.section	.gnu.lto_.lto.1640ab20347ee54a,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_gpsPacketLogChar.39.1640ab20347ee54a,"e",@progbits
+	.string	"(\265/\375 <\341\001"
+	.string	"\016"
+	.string	""
+	.string	""
+	.string	"\""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\001\202\200\200\374\342\303\314\221\t\177}"
+	.string	""
+	.string	"\013/root/repo"
+	.string	"\024./src/main/io/gps.c"
+	.text
+	.section	.gnu.lto_gpsInitData.57.1640ab20347ee54a,"e",@progbits
+	.string	"(\265/\375`\265\001\375\f"
+	.string	"$\024\201\001"
+	.string	""
+	.string	"(\001"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\204\205\374Q}\273\001%\206\b{\by\275\006\035\001\001\004\005\001?\202\210\200 wu\300\001s\277\001q\276\001o\274\025'G\206\bm\230\367\001k\303'\\\206\bi\bg\305\006\035\001\002\003\310\001s\307\001q\306\001o\304\003\005\001'\177\330\366\001k\313\224\001\315\307\001s\310\001q\316\001o\314\002\005\001'\267\001\230\366\001k\321\314\323\277\001s\300\001q\324\001o\322\001\005\001'\357\001\206\be\330\365\001c\326'\205\002\206\ba_\330\005"
+	.string	"\333\001s\332\001q\331\001o\327(]3\334\0014\325\001\320\001\317\001\312\001\311\001\302\001\301\001"
+	.string	"\001"
+	.string	"\013/root/repo"
+	.string	"\024./src/main/io/gps.c"
+	.string	"!$PUBX,41,1,00031,9600,0*16\r\n"
+	.string	"\024$PMTK251,19200*22\r\n"
+	.string	"\",0*2338476576CD\r\n"
+	.string	"\025115200*1F\r\n"
+	.string	"#,0*1E\r\n"
+	.ascii	"/  \243)\362\005\002\300\252\376\322\021/\270W0\356\"\\`/\005"
+	.ascii	"c\343\224\374\025\250\361\037\301\315\324\326\3124\201\016S\363"
+	.ascii	"\005\270K\367ua,w\373\352\303.\031hL\220u%\2147\035\352a\214"
+	.ascii	"\254n|\304d\007jj\017\253'\2513\246\313n\334\331\254q'\364j\002"
+	.ascii	"4\002"
+	.text
+	.section	.gnu.lto_ubloxInit.58.1640ab20347ee54a,"e",@progbits
+	.string	"(\265/\375 \306M\004"
+	.string	"2G\032&\200K\322\001@\\d"
+	.string	"\243\316TOb"
+	.string	"f\340\031C\214\3244=.\tT\257X\207\232\356\332@5EH\333D\246\020\313\275W\267\247\271\36704\222(\030\242\021\2651\240\346\002\320Ui\2633\310\274 \370\002\314%h\316B\234]\3166\367*\322_\375'\356a\307p8{*\220\031\343\323\324\334\353\344\310Z\324\224\337\t\r"
+	.ascii	" \023\220\t\310\004d\r\006\001\231\200L@& \023.\271\242\030\233"
+	.ascii	"\323\256\001\024\001"
+	.text
+	.section	.gnu.lto_ubloxAirborne.59.1640ab20347ee54a,"e",@progbits
+	.string	"(\265/\375 >\335\001"
+	.string	"$\003\004"
+	.string	""
+	.string	""
+	.string	"."
+	.string	"'\002\002\177"
+	.string	",\265b\006$$"
+	.string	"\377\377\b\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020'"
+	.string	""
+	.string	"\005"
+	.string	"\372"
+	.string	"\372"
+	.string	"d"
+	.string	",\001"
+	.string	"<"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310"
+	.string	"\034l\002"
+	.string	"\002\243\f"
+	.ascii	"\016"
+	.text
+	.section	.gnu.lto_gpsConfig_Registry.64.1640ab20347ee54a,"e",@progbits
+	.string	"(\265/\375 \227u\004"
+	.string	"\004\bi"
+	.string	""
+	.string	""
+	.string	"\""
+	.string	"\005\001\212\001\206\200\200\374\342\303\364\203\023\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\326\006us\250\364\005uq"
+	.string	"\005\001\006'\001\034\005\001\006\035\001'\001\036?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\024./src/main/io/gps.c"
+	.string	"\004"
+	.string	"\237\n\013&\361\024u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_gpsConfig.66.1640ab20347ee54a,"e",@progbits
+	.string	"(\265/\375 S]\002"
+	.string	"\364\003F"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\177}{\001\001\005\001\006y\001\005\005\001\006w\001"
+	.string	"?\202\210\200\310\001us\300\001q\277\001o\276\001m\275\001k\273\001i\274\001g\273\001e\273\001c\273\001"
+	.string	"\004"
+	.string	"@\004\334M\261z"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_gpsInit.69.1640ab20347ee54a,"e",@progbits
+	.string	"(\265/\375`\022\b\r)"
+	.string	"ZI\334\017Cp\350I:#\202\340H8G3\232\203\221\313j\332}\325\367\004p\350ON\033\245d\224\376\237\364\337\336\204\342S\001c7B\224\005\001"
+	.string	"\b\247\276+D\251\016\f\211\366*\004\214\304\213\237\264M\210\224I\006\355"
+	.string	"\340"
+	.string	"\357"
+	.ascii	"fj\245\252+T\333H\265*'\373wofb\016]\021\201\023\261{9q\227\267"
+	.ascii	"9>\\R\n\030W\227Z+\357\344n\216]\336\311~\331\362\366]>F"
+	.string	"O\266\343u\252\212\210\n\256\r\237Z\207\023N\356\203\362\344\016O`\236,/`\236\\\272\273\347\303'\365gb<\300\320\325Z{\355\265;\246/\"*w\274iD\216\315t\377\364\"\342\307/*}\210F\nYglw\25322\nx\313\322\244\274[U\226\024\357J\254\363^\366\245/<}\230\\e}\002\260\202u\243\221\303\230\330\327\335\252\220\214M\f\263\206g5\305\344\230!K\2172w\253:2\362\316\002a\371\225*-\0361\220\241\353\"\210\311\225\326{\304\200f\225\206d\0255\036\205\355\271\362\262\363\017+ \363\256C\255u9hu\365=\372\356\322\331]\013\273\273>\001e\377\026\032\2546`?\355\376\203\322\353|\240\323\245\206n\216A\337l\227.\207\311\215\377\004\345\022\360\336,\204\b~\220A+\270b\323\006\274\331\216x\0348\273\342\332\202y\263-q7\27667\373\250\006mMP\256"
+	.ascii	"\023\370\272\231\023\376\341\327\244\200zp\277v5'P\244\330\247"
+	.ascii	"\230*V\360\203\313j\206\332\246\372io\346\273,\256vf\016\034"
+	.ascii	"1\246\271\333\342iLe\310\"\033\335}s\367\305\321|HOj\255\032"
+	.ascii	"\366b~\326\264\227rre\320\340\007i\314\223/{\00406\2619(\256"
+	.ascii	"\333\035\002\271\205i\322\250\206\333]\273\315\353\240y\0334"
+	.ascii	"/\203\223}\223J^\244\035\357Q\363\032M^\036\311[4y\211H\336\222"
+	.ascii	"\344\335\221\274s\362\222$\357H\362\366\310\313\315\373\013\267"
+	.ascii	"\322F\327'DuM\330\212\n{Ovqp\025\3652`\247\326\250\r'\227\205"
+	.ascii	"0\025\375\032\243\320)s\312<9\273\367E66\331\347q\b\210\257\374"
+	.ascii	"1\366n.N\020\331Xk\255;\rnn\240\360\272k\314}\370\n\364 \002"
+	.ascii	"\373#6\227\224\266\345g\266p\377>\333\352Z3\352\256\361\276\331"
+	.ascii	"\255\300\313\353\013\234\356\335\027,\345\033\300QA\271\373\346"
+	.ascii	"\330\335:\322\302Lq\001\271\256\345\340!\212![\270\3371\223\372"
+	.ascii	"\200\2238\t\314\247V\346.\305B\303\370\301\244*h\302\332\242"
+	.ascii	"\372i\211qRo\306\026\276)\375\220\241\006\375\342.\235\320\240"
+	.ascii	"b\203\342\216x @\\\334\022\367#W\f\020\307\307\234n!\237n\231"
+	.ascii	"\334.\276\300E\361\240\335\245Z\036G\267\224\265Fi\330\353\371"
+	.ascii	"\036\312\205\216\3212Z6Or\223\305:\202\310\336\273\036\216\347"
+	.ascii	"N\227\331\020\"\372\001\276&\0305~J8\234~$n\330\360\035-S\205"
+	.ascii	"\0336|\275_S\257FS\013\032=&\247\033\275\n\003\366g\343\205S"
+	.ascii	"\017\307\357\347\324\343\r\241\336]\333\001\252\201\304\"%\316"
+	.ascii	"\302a\016\372\304]b,|\205\350\200\270#\270\nS9qKp\024\037\022"
+	.ascii	"\024\342!\200\255\001\337\320\344 \330\221\233#\372M\244>\321"
+	.ascii	"\355\311\217\0348\244^v\302^\277\275\224\245@*%5O^OP\216\003"
+	.ascii	"\357\251\217\331\247?\246Q\367\276\247A&\327\037\365.\245\242"
+	.ascii	"V\374 R\357\346\252V?\ra%\224\310Qs\036\256)1\230\213b\225\313"
+	.ascii	"Hx\213\0329B\267\266\346I\243>\033\234ZQ\363\264\250\360u3\330"
+	.ascii	"\b\365\372[VQ\277\256l\242\"D\312\3568^\205\270\306\242\224-"
+	.ascii	"\354\331\r\350\313\235(\036\224\204\207Pa\311P \350\222\262\326"
+	.ascii	"\272\353\247\301\221Aq\200\216\250Q,\005\035B\f\231\210\004i"
+	.ascii	"\222J:\240\002\021!3z\021\020\245CN\261\022\325R\271\032\322"
+	.ascii	"Q\255\375fL\277\306\201\370X\033\212\017\246\216\214\366\355"
+	.ascii	"\274J\200\307\217\3722\276\2248  \327\260\244H\251C\316\227\263"
+	.ascii	"*\276\255\325O\b\222\021\221!\f;\210\025\3325\022\fK\207.W@3"
+	.ascii	"q<\226X\272\361\024\363\005\235\207q\034\362f\213\006\321\231"
+	.ascii	"\364\356\026\213\n+\236\242S\236!\273\265\033\035\332\034\304"
+	.ascii	"nI\372\036%\r\214#\202 \272]\245\205^\236*8\371oU\037\246\330"
+	.ascii	"3$ \257 +>\315\326\217\354\324\270z\013H\2105\230\271\273\261"
+	.ascii	"7\306\177~\033\240\037\257\n(V\267\336\261\2746:\027U\206\227"
+	.ascii	"\001\3024.\217\351\250\t){{\323\376Ey\003=T\335\003q\217\226"
+	.ascii	"$lJ\330\351M~\224\013\fmM\0033\"|\211)\250yj\032xQ}C\263r\353"
+	.ascii	"\353\275*\212\241\336\225\261\035\277g\001\377\013~N\353=\234"
+	.ascii	"\004[A\351\334J\334~u\352\354{\351\031\r\236\032\344Wt\b5"
+	.text
+	.section	.gnu.lto_gpsInitNmea.70.1640ab20347ee54a,"e",@progbits
+	.string	"(\265/\375`\224\tm,"
+	.string	"zL\250\020C`\246U\007s\260{\270\013\242d\322\272\211\244u\327\374\206\344\234\240\262\274c\365\255z\240\310\210\365b\227\364\300\205\fT8\372\247\370\245^'m\334Y\037\210\367@\240\037\353\304l\033\024?7\331R\312\224R\355"
+	.string	"\350"
+	.ascii	"\003\001\3376\374\255\336\357\332\375N\3617\276\337\367~\333"
+	.ascii	"\373\375\366\333\037,\231\341\371\020\226\263\216\350\241,\206"
+	.ascii	"\331Dq\2457\357\300q/\316\354\306\265\f_6\036\242e\3119\343\034"
+	.ascii	"w\313\350\3069~\377j\\;\027\357\262\272\022\250\006\215\252\030"
+	.ascii	"0\"\317\234\227\f\034\267\223\352\270\200\357R\307\327\221R\307"
+	.ascii	"\275v\227\371r+;X\020\032`\n\345\234}\226\211\257n\244\313\025"
+	.ascii	"\341n6\265\226\342k\177m\017\272\021\323\375\250\313!\275\214"
+	.ascii	"E\276\b\347y\214D\334\3138\344oBlM\3772O.I\265\346y\214@pG\032"
+	.ascii	"\237:\022\254,\307\227\367\\CHw$\336\235\016(E\334q\370\367\362"
+	.ascii	"\220tx\350\216W"
+	.string	"w\207'\311\037\377r\003^\306\254\267AnGa\272s\342\344r$\306,\373\265\b9\347\376\342\021\313\373\310\273\035@w\213\350\266\r\b\030\032\226T:Y8\300\035YX\315\371&\r\210\325G\373\271\006*v\255V\327\306\034\230Z;\343K\235\2537\324o\235\254\265\317\207(E\330S\356\006\330\346m\315\351L\352\276\333\304\211\367\242\223\335\371h#&\264\301v0WR\212\005\037\221;q:qZ\253\225\246]\215\355/\346\033`R\262\0213\355g\272L\3159\350Hw\002\251\343O\312D\256\254g\316\371\311\313\264#\325\255l\314\313\374\2043r\365\211\272\233\312\307\240Ps\316R\355a\\L\212\366.\307]\305\342\275\310\"u\354\326\277\374\273\272\n!\273(\255>\332\275\024\276\325\352v\033\215F\321\332*\351\276\337\274\373\375\344\344J\357\246\373\315t\277\227\360\267\322\375\336\335\357$\374\215t\277\003\244\337"
+	.ascii	"\354\367Q\372md\277u\367;w\277\213\3567\356~\337n(\324\034:\353"
+	.ascii	"`\b(M\211\263Z\271\307\3617r\026C\0015\275\215\257\361\347\346"
+	.ascii	"\364\"\234m\262EO\374!\316\326\234cMv\367"
+	.string	"c\b\032\367/W\371$\245\244=m~!\365f[\370\340\205\317J\336\024:{\262\336\354)O\204\350\241E3o>\331&\2548tF\270!`Z\255\351,t\226\306\275\331T\216\206B\267E\250\351\b\2528\205ce\314\242\306\316p\251\267\263A|\334fo\202\200\352\323f1\324NR9\340}\351e\030\022\220\345L\364b\006\225\250@A\367\206\016~T\213\207u\004\270\241\242\254\371\202\364Z\250'c`\\2Yj\265,\031p\211l\314\213f\356\3004\2655{\241D\244\360\243{\364\244\026C\351$\225\273G\260t`\212m\267\207\017\357\305.0\264\301n\267\343w`\264w5\b\021\"R\307\330\342a\030\202\036gh\330j50\275v\306\227>\335#|\016P\225sm}\3139h\300\373I\365~\277\236\003\246\276\345\036\374x\277^T\017B\357\367k\360 *\252\027\325\373\375\242*p\350\240\341"
+	.string	"\201\030U*l\227\200r\261\342\204\257\212\312\247\202j*\205\257D\013\027>\250\244\256Za\242\205\357EUU\013\037ni\345\021\254\254\260\235L\204\340#\362\233s\316Foe\341\265$y\326\231=\365X\376\n\223\307\354\021O\345\2750\263\251>\312Ca\352\230\276\353\271\226,\3237\371\255%\213\241\201\322~\311\372d\215\242\022)(p\254\364I\224,\036\006J\346\372x\316BAA+\332\375\2217\222dw\217\374\"I\026C\313\002X\244\027\202d\223\232\204x \353\024\265\337\307\377X\251\334\325\312\212e\305\222:\016`\245\232\2609\262"
+	.string	"\326\344\363X\267x\030Y\316WR\335M\342w\254]\274\271\225\363\025\004\307\375\307\307Z\277\256\204\ti\373\204\324\361\221\365\260>Jkd\235F\"+\n\257#\200\260\250A<\252\2303E#RRP\220\244\305\320\002\021)\"z\021\320(\205\034r\206\306&%\2054\006\0308D\200V\344\227\023\371\037[\352G\333\311N\203\337\255\335\222W_\316WE"
+	.string	"\274\023\236<\264^\026\357\025Y\033\033K\305{L\310\200\027\273\276K\322\237~z'n\316(\337\325G\251E\214\250\212W\f\252\301\2239^6\364E\312u=\003\305\250K\243\312*\\\216\003\332\022\020\357qO\006\0132JZwb\206j\372\337S\267\313\234\300R\021\213|fs\221\374+"
+	.string	"\371\035\200\004N\017p\330\b\264L\202\373K$B\264,`x`B\201\242W\317\345\\I\303\302>p\250\326\256\316\341\333b\306<\246\\Q\245(\005\036E\007~f\004\016\355\206\022CC\247f\327GABa\343\271\243\334\315\266*|&\374\035\204'\020>\3329t\264\2169W\002\314!\252+~y\350-gl\352\217\253R\354eVs_\230e\336k\320A\214\247\242.d\206\200\342\036y\017Z\276k1\356Vc\330_\352\271\324(\262\t/\374\034\243:\357&\236\"p\253\312\236\205\331T\240|9\202\316\"\236\312\302\002$\243\035:\335\027\312y\241nns\036\341\311"
+	.ascii	"\301\214@\272\314\322\bI\354a\304\372\003"
+	.text
+	.section	.gnu.lto_ubloxSendDataUpdateChecksum.72.1640ab20347ee54a,"e",@progbits
+	.string	"(\265/\375`O\002E\023"
+	.string	"\306#}H\320\360(\035\332\330?\271\211H\r\364-\254\343:\314\3751\246f\224\304]\240\360\251|B\316y8\232\004\337\206^\325[TIF(Y\216\215\326\t\276x"
+	.string	"\364GB2\005\204T\243\241\207\324\247\352\340\253\355o\262\245L)f"
+	.string	"b"
+	.string	"j"
+	.string	"@0o\315\271Sc\305\234a\002\027@\375s\370\020\371\017u"
+	.ascii	"\362\237g\266\322\303\236y\362\240\241FWc\316\tn\007\277\367"
+	.ascii	"\030\336Qg\377\342\352\314\327\244#\033.\346_<\325n>\254p\265"
+	.ascii	"8\322\264dt\335\365\206\243i\f\201\363\275\356q\004\217\311\206"
+	.ascii	"\303\271\236 "
+	.string	"\3149\2556\334\206[\336v\212\355\007\266\346\004'uK\252YR\r\"\325+\251\376\360\370\320\257z\320\337\361\360N=\374O\007\372\345\017t\357\252U\252\0372\340\347\305K\306\2347\275\033\023\3513\002\341\357N\324\362\023\336\234\235\352\237\335b\253\376]e\017\265h\020\203\\\004\260\346\214\220\017\202U{\001\203\331\303\227\263&\r\206\215\201\253\375\02271{\353\023\231\234\350m&P\333\030\373E7\302\340\373\030\005\246\267\301\344\277\326N\030\262\301\201\365\002\331\325\262^ \333\301\333\335r\253\275m\306\307~W\253:\032\035Z\n\013/v\221\377>\366D?\340\242w\313}u\257\242&\307Qd\210\241||\030\371\357\373\034\257w\313\311howG5\334.\217\035\322\364#=MK\336\035;\022\"\300ZVP\\%/W*\245\344\302\222\260\220T\210v\211\254\250\230\200\261\0230\345\204\004\006\272d+\240H"
+	.string	"\307TJd K,&\003U\241\314w\307\024D \311,\355[\036\343(R\332\324i\343\336\256;\212\006\013\233\365XG\225\273{\263L(\306\2146\371\275\277\310\270\251u\300c\242\321\241\3059\347\214V\360]\217%\221\264\243\371\241\251n+3 \200\002\231Sq\003\324\013J\003\253G\374\330\002e\221\207^\"\232\342\212os\026\2705\303&Y\321\376\366Dg\210]\226i\274:\013\244\031b1\220F+\374\342\b\307\246\276q\200\255\241j\005Ph\235\260\233\333\300F{\263\334\304^\230\355V-9lC<\020f\034\021\356Va\206\361\003pD"
+	.ascii	"Q\272{\211,\344\tJn\006S6]\364\t"
+	.text
+	.section	.gnu.lto_ubloxSendConfigMessage.73.1640ab20347ee54a,"e",@progbits
+	.string	"(\265/\375`\351\002u\024"
+	.string	"\006f\203G\320\362h8C\316MFv\266\273\300\373\017)\356\\\032\315`\306$\034H\352\037}\fT\271Q\255\001HT\315\004.\2068\344\320\307}\230;w\205\027\034W@\225\301^\365A4\235\001f\261\376D\335v\357-eJ\001l"
+	.string	"d"
+	.string	"p"
+	.string	"f\361j'\272;\344\301\267\262\253\215KB\265\204a\bj\327g\340\241\017\214\2326\202\004\266\353j\177-\256\306\205\002O\373G?a;\322\316\001\354\022\351\360\355\352R\2142>\264\356\001\304\207\343I\304\207\266\331<\256+Z\225\210\016>=\251\335\205i\210\333\2366\377\275\257r@\267\247J\301\356:s@\032n\275m\024\333,\266\326\002;\342\303\253N\216\337\217\320\225\376\335\007\024\275&\236wu\261d\"\212'\177\266\356\226\n\302>\270\273k%\262\257\373M\216\364\227\200\351W\230vi\272\005\246G\302\264\210\246Y`:\344\351\225\246G0\255\n\323\242\246C0\r\206i\325t\202\351\023\020"
+	.string	"\345\024\323c7\303/\3106\205-F|\367\363\236\364^A<,\025\201!\242\253\020e\351y\017Q\221\211C\220+\257\364\244+\275\027\313\215\272R[\006\343\2437\347I\304\022]\351{J\340\362g\225\216\237zM4Q\225\376\350i\251g\b\027\252\350\023A\rY\034T\235'\024?B\254LU\265ef\3629\237X\320\233}\025_\221\343\033yf\223\317\331\210\017UWA\232\232\3423\225\302\001m4\362\003\013\030\314\344\320db2\n\261\025\215\254\202\276\340\274L"
+	.string	"\035S\241\325\300\300f10\232\230\227\031X\354\206\006S)\361\254Fv\003\303\231\315n`,\335\036\\%2\004\037M<\212\333\325\300\335\017,\347\375P\273\267\210v\203\337h\261\021\342x!\025\365R\373\301i\324ZE\273\273\3427\335)\202o\364\320\022\\\\v\344~\314\320\227~\303\023\220\037\241\226\272d\270F\264\265\373\210\212L1\0029 \260\002\021\262\272\001\324.(\206\246\264\300\b\306\344\212\231d\331k_K\005 \247\371m\335\363\016f\307\270!V\343\215\007\207'\362\233<\216u\276F\357v\226\307\252\351i\347\254\266\212\353\364"
+	.string	"9,\273\215\tZ\256\231wV\234\315\216-\246\313\361\214"
+	.string	"\266W\023\343\352V\230#1&S"
+	.ascii	",7b\204\327\235`ua\202V@}\314\027:\302\201\t\224.hD\200\217\002"
+	.ascii	"\276\274h\027\031"
+	.text
+	.section	.gnu.lto_gpsInitUblox.74.1640ab20347ee54a,"e",@progbits
+	.string	"(\265/\375`k"
+	.string	"]\t"
+	.string	"\326\321@80\221\322\001\2609\316Gb[;\264\3170D\350)\2438\354\256\007\257\034\345\004\273\355\223}2S}\247]\375\222j)(`-\025\372\263\240\021x@\355\266\021\"eJ\0010"
+	.string	"2"
+	.string	"/"
+	.string	"\273\033\325\343\253k\232+\377\363u\327"
+	.string	"^W\355"
+	.string	"\303\345\005\372Z\232\200lc\346\261'\305\347\312\364\210v\327\351}\026\367v\333\b\266\tl\317\002\005\0351#\027\254\fm\260\225\n\263\257a\030\206V\016;\323\371\364=\244\026\031\303\313nE8[\230\215E\304\366A^\3314\007?\366*$\023(7\001V\355r\305F\226\241\n\263\035\321IU8\221q%\216=y\265S\017y/u\300\245\235\375\222\233H\370 \206P\345\275o\276\252\363\355\372\330\003\036\205R'R\344J\261\241\224`\212#T*\206\002\314\235\026P\321\201\343P\021\004\262.bi\353\032]HJ\315\202k\360\314\271\266\273\253}\3226qy/\016"
+	.ascii	"2\003N\035\206YX'\002\202iX\001+\200\266\217\205x\241\207p\350"
+	.ascii	"2\364\313\020\342\322\2654M\003SP"
+	.text
+	.section	.gnu.lto_gpsInitHardware.75.1640ab20347ee54a,"e",@progbits
+	.string	"(\265/\375`$\001]\f"
+	.string	"\206\325OB\020mL:\1778[\333\333\210\n\241b\316\240n\337\033d\210\205\374\355#$\2647ul\222+\030e!\rw\3623\003\006^Y;^\001"
+	.string	""
+	.string	"\005\252C"
+	.string	"4\374\001\036`\204x\300\3605M6\331;\245>"
+	.string	"9"
+	.string	">"
+	.string	"\250\315X\215H\3402\261\273\035\205p\317\353F\247\307\347\210"
+	.string	"\013\305\357\225\242Blg\035\304\001\251D(\212NA \207\221\212I\220\210\b\350\254\250\354\256g(2\270\271\333\016\261\275a\177\024o\031\360'\274\372@g>|\365;\334\353\251fT\243\265>\263\264Gp\322\223}Z\226%\315\324d\177\372\234\305\003\005\342I\260\335\005em\311\352\201\202\355O\354\261g\037\003\327\360\013\t\362\233(\236\212\245>Pz\372\313\207\335BH\265\245\r>\007\317\"\037\300\275\276\264\253\023*\373\031l\3174^ v\2777\230\341zLJ\240\231\3026\347\030\nDvA\037\376\205\266P8\232K\347a:\001\030"
+	.string	"\231\316\262\341t\224\013{\232"
+	.string	"\233\216\200\347m\272\311\370\371\266\324\304\372C\262\n\344\207\202\376xW\266\212\221\211\\\357\220\211\233d\332\031o>\364;\210\240\221 \375\034\036"
+	.string	"2\241u)`\202\037\313\005\235\326\004\006\212"
+	.string	"\031C5(\220\214\247\222\213vqn\332\003\257"
+	.ascii	"I?\225\r\324\241c\306\024G\307R\230\3058\303\370\224\205r\031"
+	.ascii	"\345e\210q\351@\3430eh\306u\352&\310\267\313\312\023"
+	.text
+	.section	.gnu.lto_gpsUpdate.77.1640ab20347ee54a,"e",@progbits
+	.string	"(\265/\375`\300\022\025R"
+	.string	"\232\203"
+	.string	"\035P@\216\322\351\267I\036\021"
+	.string	"\004\006\231Ab\226pI\210\031\336\276N;\235w\036\nO\356\b\036*\303%\320+v\354\332\215\024\246\366\316\034do\262'n\202W\251W\270\\\353|\306\346\205\3713\233\034eV\335\316\254\252\252\252\274\211\334;\245\224\002\270\001\233\001\307\0018\327\371&\306\331fu\256Y\235i\256\363\314u.^g\231\3259\346:\023W\347\253:\253D\347\364:\277\352\354\252sS@\023\230c\252\213\344\265\355\216\303\026\332:\225\n\022\356(\355\226\301\\\006\314l\036\232Y\324\016h\016>i\350\006}\306'\232\207\0330\267\223F\343\240\317\330\203S.\254m\333b\253\314\0340\027[U\213\314\334\316\334cM\306vY\007\034\323\266YbS\332\366,"
+	.string	"FZ[56\317m5m\235\333*\263\314~}\246\325\376\200qIA\t\333\266ez\"\214\304\367\331>22\026\021\r\t\005\001\375\370\364\360\354\350\344\340\334\330\324\320\314\024ebV\"\322M\225>\311Ynw\342)\357\332\246\234\372\250\255\215\332\330\334\330\266\346EfMdF\346Ci\320\325\\\017%\2641\0272#\301\203\210 \200~\232\204\271\217\030\022\3579\342<]\275c\304u\270<\247\353\213Y\304q\322\rWs=\332\216\331$\345\331\022\202\n[~C\004\001\355\236\262\321\022\3425j}\324\0068\026\245\t\3223v\314 \251\361\213\371\201\027\211 \314z\025\004\273\262B\026U\223\226\271j:\357M\333\266\235\305l\222\306\030eQY\365\232n"
+	.string	",\001\f\317\216#\313\376bV91}45\271\266cZ\245\037\310\302\266\332\254\035\307\224\322\221<J_\231$?:\215\242\212\322Ji\321\020!\321\342\024Tj\304R'\325nmd\307|\363_\177tR\252c\345\306\245fJ*\005\200\213\222f\233\265\321\027\323\315\235\b\242m[\366\345\024U3\206f\366%\314,"
+	.string	"\363\r\\\201\337\3071-\004\212\234W\024\220\233\355\342j?\266\253o\b\n\204\202%\036I\363\355\371\227e`\006\347fc\225\260`\336\313\022?De\245N\371N\334W\232I\347!\271\020\237\304\021\n\252Mt\233\215Y\261\276;\326h\265m["
+	.ascii	"\367\226\266cI\3406\322*\263d\254\031k\306\326J#\304)\363\332"
+	.ascii	"\002\277\360.\311JtI\274a\2327\321%>\211g\227\252R\366\\g9&\020"
+	.ascii	"\"\304m\225\370\0304\347\24236\356\306\210\377D\336\373\t\b\271"
+	.ascii	"\372\314\n\214\360^\336*\352\267Y\247S\232r\321\252\356\264m"
+	.ascii	"\333\026\311m\234\360\026w\371\307\271\335L\240\360^\362\277"
+	.ascii	"S\253p\306\f\222\366 \327\027\227\322\213+\202\307\323\347vc"
+	.ascii	"\321\200\367R\304\267[\343L\371\263\252\373O\277\373\244\fs\334"
+	.ascii	"\237\371\201\026\336\313\177#\324;Q\361\227\321\234\373;>4\266"
+	.ascii	"\377'w\017\365 c\222\3044n\177\004i{P\316\002s\303\265\024\032"
+	.ascii	"\334F\030\002\027\336K\027\267\325~\017M9\261\252'?d>S\372?\231"
+	.ascii	"[C\020,/\374C\230\257s\213\325\231\305u^AtV\261:\247X\235Q\254"
+	.ascii	"\316'Vg\023\253s\211\353L\242\313\272G\3208\213\270\316\037\256"
+	.ascii	"3\207\353\274\341:/]g\r4\316\031Vg\f\253\263\222\352\234DtF\272"
+	.ascii	"\316G\253\263\021\215\263Qu.Z\235/\024\235\211f\234\207\256\263"
+	.ascii	"P\3219H\306\031hu\376Y\235}V\347\236\353\314s\235wVg\235\353"
+	.ascii	"\234s\235\003]+\225\240o*'\324\237XJ\234\356d\341\005\372\376"
+	.ascii	"J\323K\206q)\311B8\240%\247\271!WdeO~x\351\316n\334@\335\242"
+	.ascii	"\234\370\206\262\255AO@\241O\226\335P4'\320\016\336_\2329y\310"
+	.ascii	"\022\3615\2760uP\357\244\325\245\207\315?Y\347I\263N\367\207"
+	.ascii	"\316\347{\376\347?.\312\213\f\271\216\371\274\222^Y\317\373\032"
+	.ascii	"\337\240T\347\200\242\205\031\005\254\371\347_s\271\230\207\231"
+	.ascii	"x$\276\304\301\324L0\361/O\342O\335j\314\2129\222c\215\326\221"
+	.ascii	"V\343y#\321\336y\036/\302*C\354|S\023L\264\352\351X\303\211\034"
+	.ascii	"y\272\370\323E`\245n\2608p\334V1h\202\t\023\324\361\020\220="
+	.ascii	"\236\225\276\351|Z"
+	.string	"\205O\216&\347\205\034\207\256\360\032\347s^\347\356\210\224(*\312\343\275y\234O\277x\340\316c\363\346e4\005\305\312T\345\t:f\330\251k\363\235\265\303\201\260Sk\333B\025\300\356\303\177\260<|\260@\200\334Vm^\203\346\237XY\315\363@\3668U#/\315\327\374\367E])\375\320\312w ]\007\3153\320\364\213\226\371\215\3565>\261\242\223\005\241\013\237\022wj\n>\250s\362B\031)\255 2\276d\307q\347\274lp\247\200\325\202E\275\236\274\206G\261_P^\225o\"\242\373\304\256d\277\265m\235\372\252U#\020-\036\030\034`\213\325.y\313}\265j\265\314\366\254]*bE\271!\263\341q-\234\371 <+e\2021\305\017\323\313\300\302>^\231/~\023\312<\003M-bU\003\baA\230\200\205\272\016nl\344ef\237,\221^\333\213\306<3\273\325^\220;\0013T\274\250"
+	.string	"F\212\013,x\321\324D\303\005\r\273\3500C\206\004L1`0Y"
+	.string	"\003\202\n\230\\4\315`\352\260\3031d\274hb\272 F\214&\246\342S\377\220\365o\252\356\351\225G\377|\037m\330\307\273\3419|?\325\206w\3009\0275J\352\335\245\367\"q\277#\251\367:\226\236"
+	.string	"\2752c\013\r\337\342\331?\307Q.\204\206\224\3169W\304\342\227),\003cx"
+	.string	"v\007w\304\263x\035\345\326`\324\225:\350\244\220\350xW\374\177\245\3215\032\2635>\352\270~\215\025\217\300VY\361O\031\035R\361\021\244iI\361*\276\337\244\fQ\374\210O\361\035\345\245\374\247W\"\223V\222X\034\313m\025\3057Z\253TM\270h\325\216\216)M\2042\230\320\222\334\342\275\314\360\275\346\207\245\016\352\260\333\013\203\376i\310va(<\301\t\307h\\\256"
+	.string	"a\3700H"
+	.string	"Xpf+=\206\277\205QWJ\302A\245o/\347\233X\331\002\216\364I)$\363\2145\\0\351c\252\216\036\351\3237)\3031\017L\352\031\300\016\350+$\371\322d_\362\357&\377n\253G\337P=*O~\350\327g\364w\211\323-*\323\327\345'\256\215\357Yi{H/z\346\244\227\344\027\357\245\321\367\212\334\304\252\214^\240>\377d\016\215\274\027\276\003\323\262\344!\271\\\370\256r\252E{\350\232\b\217\355Z\357\210^H\315\212\207\231e\342[\220uS\234P\302\262\260]Is=\346\204\022\n\336D\243\354x'\243w\350k\300\f\272\225d\264\312\320\267\341\326"
+	.ascii	"}L\035-\375\341=\020!m\257\351Z\350?<;\nB\337x[\315wW\260r\376"
+	.ascii	"\311i\320\267\235\tl\201\200\250\201$'\231342\"\"I\222B\032\003"
+	.ascii	"A\005\204\030\006\241dw\021\340,\244\244CC\"\005*\250\221\306"
+	.ascii	"\t\256m\217\2137\322#\316\255\217\201\023T\001\032\ri\340? z"
+	.ascii	"P\360\230d\234r\351q\201g`\236\223\333g\320\035\345K\312B\230"
+	.ascii	"\331m\324NPX\272N \004\364UX\tl3\324d\260\026!\2358 \320\226"
+	.ascii	"\217\240\r$ ]\361*^\254}\341\222\001>\260G\022!\326-m"
+	.string	"\265\272\266\027\304\265F\200\257'5]\304F\233N\377\224UL\302\374\320\352.\b\034\235\257\232|c\220\343\330\223\327\342\"H\357\345\305>\203\020\217E\272\331\020<\021mr\251\003g\025\033\177\330\353W<\246@\342mI\347\246%\360C\375'\372\216\255\277\013\345\330eY;9K\234\271W\017\030y\025\371lI\377\202\352Z/\313\255:\034\024l:\326i\205\313>0^\222\026=\374 \306E\263\231\016\202l\221\340\216\203.S\r\337D\013\203s]\207\027\023\372\271\237U]P\343CW\004-\310~\1779\213 Y\320\b\353\035\321x\3464\026\312/"
+	.string	"a\033kn\302\202\"\277\331\307\261\020(T\366\202Ad(I"
+	.string	"\016M~\030t\346\241D-\345\363q\327\262dT\314\346\345Ie\203\247\300{A\230<\343\016\305\370EW\327\316\f\f!\213\203\017Q\032\231e|\017\234J\2364\304\371\314}'\257\352\204$\276L\024\300\213\343\326\272\351?\005\205W3\223\260\331@#\305L\203\220\212T%\tx\023\203\246x\207\020\215\312\317\031J'\213F\256\272\334\235@\221\255\026}\222\236i}B4\241\227\336\366\342\366{\324Q\214yy\302\253MY'\221i\030`\0302/%s\353\025\327#\211(/Ym\201\374x\2120\017\3208\352 \026\025\254\371\302\257 \206\343^\244\370\351-\203m\241\355UC\214\212\320\r\366\350"
+	.string	"\224\374\213F(\267O|\246,w\207\242kH\250\376\201l\300\271\205\364\314\344\b"
+	.string	"\214\362!\200\303\230\337\332"
+	.string	"\326\022\257\365\247R[K\362\236!n\031\037\fY\301\222M\263&\2449\\8H\255\302\231\262T\264\310R\2127\"\304eQ\023\037r \237I\202\276Il\t\301^\313\364\025\025\031\360\320\361\334d5"
+	.ascii	"\031\020\355_>L\365;\n\357\017\005\243\271\312\320W\035\235R"
+	.ascii	"\334G\375\345\233\031wg\177!Z\305\227\200G\034tG\n\244\353\253"
+	.ascii	"\f\216O\354\377u\227\206E\376O\335\034\027k#\006G+qw\234\333"
+	.ascii	"\265\245\317'\255\352\247\t\353C\"g\005\005\214:s\016\031\030"
+	.ascii	"\034\350\256o/%\355\213\312k\242\277\342\233/\006\373b\207w\304"
+	.ascii	"\344x\020\313\202i!\215\314\207\262\271\232\271\321}r\0053\235"
+	.ascii	"\003Y\270\226\221\033\275\264fN\226\310A\345\212\027\344)\215"
+	.ascii	"\271S\003"
+	.text
+	.section	.gnu.lto_gpsNewFrame.79.1640ab20347ee54a,"e",@progbits
+	.string	"(\265/\375`\235\001-\017"
+	.string	"\226\035eD\020\217(\035mq\002\376\204H\003&\346a\202W\377A'\202\324\230a:\337\243\177\263\2149\211\233b\270\267V\237k\264\314\303\346\032P%\232"
+	.string	""
+	.string	"\n\002\021\274\"p\234v%\230\027\2376i\"\273\211\224)\005U"
+	.string	"K"
+	.string	"R"
+	.ascii	"\232_\271`\335=\251^v\301\005>\240=\3326\203\006\"\016\035\354"
+	.ascii	"`\322Py\215\260b\354\202\234rx\3501\323\f\371\242Gu\255\274\257"
+	.ascii	"\344\331Y\236\275\230\300V-N|%\327\022IC \005\343a\3730hfp\354"
+	.ascii	"\256\323\373"
+	.string	"6\334\232\333\206`\033\201\235\002\002%\007\276\313\301\316\377\360\350\n\240\274\367\350\2034\217\327\027&3\252\226Q\2066HJE\261\257a\030\312XOl\2479No_\3715\247\243\2463MkLg\226>\200\317\311D\362\275%\3345\2053\033\023S\200\260-bol\007\252\266\307G\336\343\250\201\222\212\234\252zMS7\222\013\213\221\330(C\237\304;\0301\242\204=\005\223R\241\212\342\273|\023\217\245,\212\345\227\360K\273G\363\370\243VE&\345+\333\257\002\254\025\273\242\237l\277\322[\005\033T)c\266%\\\004\210\266\033\235\273\263\001\n\371\340:\017G\301\323\001\302u> nC\303]\210\307\207\263\320u\037n\003\216\236\255\236x\202\212\244\205\"\375\220&\343\313\220mz\226?\bC(G\243j\260\225\344\217\2709\262\335\3358 3\265#t\344\275M\323L7\222\253\365\326\023\270\200e\0012\037"
+	.ascii	"L\023:/$\336\337\n\034P\0017u5\270VC\201\274\217 \332\230i\311"
+	.ascii	"\277\323\006\253\200`\200\346\247\234\201\nk\245\326\216\032"
+	.ascii	"x5\273@f\006.0\237F1\232@\017\327D\217\211c=\027&\270\006\314"
+	.ascii	"\343\240j\n\334\355\334\362\004"
+	.text
+	.section	.gnu.lto_gpsIsHealthy.80.1640ab20347ee54a,"e",@progbits
+	.string	"(\265/\375`\003"
+	.string	"\r\007"
+	.string	"\262M14P\215\322\001$\243**\245\275\353Q\271x*Qg\254)\221\f\226\327T\263\r\331\323\203\215\314C\fkb\026\021M\b:\267\302\020\r\037\343\320 \233H\231R\266T \306\301\275\213\203\2700<8\213\005]\205\342\207i\260\234\304{\226\233\304=\265\nR%\340h\307\355\260\272\252\352\207\307\324q\304;`\300\356&\370\034'M\370\2427Sd\362\330\233\237\251\336\256\003\031$N\236\354\270I\275\260O\255\202l\2475\323\247\004B\242\354%\220\335\317\251dC\232id[cO|\200\240\361\365\210\361\241hXx<Hv\243\323\320\257\347\345\177\343\013\"\245\021,\333<\001\024v\327\211e\025\267\336\266\201\355\002\333\243\t"
+	.ascii	"2\241g\037\230\302\004;T\241\270&\246\214 K\210\034\356\234\251"
+	.ascii	"\235O"
+	.text
+	.section	.gnu.lto_grab_fields.81.1640ab20347ee54a,"e",@progbits
+	.string	"(\265/\375`\233\005e$"
+	.string	"ZB|\016I\240\230Q:\020\034u\017\220\\\323zt\246I\255\210\341R\031\032b\235\353|>\255Gs\351\376\213\370u\036t/\00738\3518\215k=\205\321\341E~\005\037\256F\3645\234\337\177b\244\370\301\356\255\225\337\022B\b\2212\311\327"
+	.string	"\305"
+	.string	"\330"
+	.ascii	"\037\266k\035r\351a\336}\221\033!z"
+	.string	"\021\304k\265\322`BUk1\301\016@_n\021=\361D\210\266GAD\221\220\2078\364)\341\252\265\250\303\035\307|I\376\306|\3316V\306\275\327\320f\262X\n{\241\247Y\222\315\275}\210\327\234\022\224\204M\24759\001c\360\f\0138\224:\377\202F,\253!\204\361XR\023\247/\016\303\002\276 q9'\240\013~\345\224\204-\216\222\021\240\254@q, \013\222st!s'\340\220O\362\300\320*\305\261\200-H\234,K`\322\240\217\315!\"\0172J\302\244\227d\003\021\\I\261.\237\2264(\202\311Y\020\211\304\325Z\323\340\021\367\245n\201\230\203\214\222\020\306\371\224Pk]&\021\024~k\337}\202\335\205\260[\372\004\265^\307\036\204\371\362\335Z?\027E|\374\317PM!B\366L[_\352\003\216h\375\200\352r\304]\2555\303\007W7\323n1\004\337\300\222\231\023\3334v\227\267\247"
+	.ascii	"\001\236#\371\005\344^\374q\313\013`G\347\226\203c\273y\324\327"
+	.ascii	"\246\344\2551o\315\311K3yg&\257\f\345\215\241\274i\311\013c\336"
+	.ascii	"\327\311\2132\357y\362\232&oi\362\222O\362\355/\371r\311{\003"
+	.ascii	"\2633:\202\247r\254\025\305\021M\305R>\351\361$\377\222?\352"
+	.ascii	"\275\373\335%\332+\271\361R\233F\365\310\0325\201\330\344\343"
+	.ascii	"\301\222\036\027\361\306\230Z\213\f\236d\243\274\n\353Gh!\342"
+	.ascii	"\030Sk\365y\271\bvI\336e\340\200\350H\002\004zf\024r\342\305"
+	.ascii	"\3238\263\367L\233\356#a~@]\035qWJ;\036\217T\357\231\263&"
+	.string	"\300\323\262\236\311\032\266d%\245jKk\007\254\231\366R?\n_\220!\232\353%M[\333\364\357\365\235\031\353 (+T\337\231i\307`\235v[\341\300Ca\375\237\013\264q\375\352\3334\3320#+'\2764\260\367\314[\363\364\271deDr\352\247.UU^\315\3043\367M\200x9M\001\270l\231\215\353\263y\013\022\220\262\315~\256\311.\373\002\232\3544\253\212\030_\232\">>\230d\242\f\372\017\246\200.Ch}y\256O\250*N\220\206F|\334\025WKW\247\202\363\314Z\367\021\255,b\2161F\263\231\206\265\225x\201\231\242S\231\340<\363\375!o\322+\302Ck?\007\3520\324\0334x\020\372)\2078\360:\220\031\202\204z3(\020\002\332\240\333\375\350<\374`\350\240\313\020$\244S`\333\035\220\206 \335\320n\027\244K\213\365Mc\223\214\304\023\264\236^r\306+|B\256\322O\035"
+	.ascii	"\200^\tEmT\323L\335\363B*S\304\307\307\200NCh\262\235\336s\247"
+	.ascii	"\273\177+\273\365\222\347\255\331\347\335\023\f\223\245#C\313"
+	.ascii	"\326,\246S\302\370\304\203}\276\323\277%c"
+	.string	"9M\363=\ro\375;\273b\005\272\247\370S\267\365\357\311k},(/G\334u\241Fk\\\327\330\232V\301\250\352\312\311Zk\225\221\351N\2530>]\225\b\256\203\323[\336:\247\177\233\332\364\222\345\247~s'\277\351\002M\313\252\272\302R\254Hl\305\232imF!<`\001s\250Q4\243\214T\312\320\214\310H\322$\215\001p\002\0312\254\007\020hY\233\264\006\373`7\216>\025\004'\233q\221j\001~5\026[-\261\035V\217\017@Gq\034%:[\202\321\017'5\005\234\342\270\221\2074l\242\373\020J\265\304\031\234\001Q\320\231%\002\220\211F\237\013\347'@\253\022\367\362\272&l\361m\2059m=\005J\206\261A\337\354\252\267\307\021\222\343k\036\265\f\373\367J/\031bL\342*CIOa\201\315\241\212\377j\207\227\005C*\365\"\376\260\334q\226\005u\225@7JQg\234\341\365\310"
+	.string	"\275\261\037\235\272\216\001\007f\tH\370\2450\213\f\350`\023\260\233\370R!"
+	.ascii	"`#j\315-\363\243\355\200U\343\331]R\023_h\306y\342\354\223a\216"
+	.ascii	"g\204fC\373-\315\271\252\302\353u\026L\023}\177"
+	.text
+	.section	.gnu.lto_gpsNewFrameNMEA.82.1640ab20347ee54a,"e",@progbits
+	.string	"(\265/\375`n+E\245"
+	.ascii	"\252\377H8E\0208og\f\020(\302#\241\210LN\222qc\007G\336^\253"
+	.ascii	"T\231\017\254\257\342\030\035^\037\310\370l/Z\037\347\250\261"
+	.ascii	"\245\240<\304\305\004\326#D\035p\3564\240\252s\203e\371\375\203"
+	.ascii	"B\032{K)SJ)i\0035\003\204\003\3163\\g\031\256s\f\327\031\206"
+	.ascii	"\353\374\302uv\341:\267xg\026\357\274\302u\306*:_\271\316VE\347"
+	.ascii	"\252w\246*:O!9\253(:\247@rF\321\301Y\252\203\363\211\016\316"
+	.ascii	"&\212\316%\212\316$\336yD\3219\252\350\f\205\344\374\204\344"
+	.ascii	"\354Tt\026\341:7\025\235C\270\316 \\\347\017\2563\223\353\354"
+	.ascii	"\301\235\227\336Y\351\235\223\334\271\303;#\025\235\213\357\354"
+	.ascii	"\2763\007w>z\347\rEg\r\256s\321;\023\2753\361\235\207\357\334"
+	.ascii	"\2763\353:\257\357"
+	.string	"\374\256\2637\013Il/\224\365\036\234\367\275R=\364\362\261u\3164\235\356;\335t\335n\335\321n\270\346\340G\276\3015\270\221\0279\221\367\233&:\007\346f\3569\334xu\332\316\224\276\303\001\224W\364E.}\211I\333\b\276/\031\003vE\334*4\035n;6\2223\305I\317\341 O9\301\367}\215Z\216\273\216\215\350\214P\310\350{\345\310Y\345\357\007\321\t\267\0346j\226\033N\3179\3518[PT\242o\031\215\271\2716\202=\210\315B\265R\333\354\332\035\332f\235y\n7\264\337\332M\307\261\321\033\343\372.i\260\025\242\321\001\347\205F\324\b\305f\207\345f\354\027\354\215\362\327V\345\357}\243S\315\262\211\367n\303\305\377\276\3148v\357\373V1\tb\263,^L\341#\323\0272\006,6\030\302\342\004\3377z\365a8\251\327h3\226\037\233\3458\216\337\260\033\206\3437\216\336\260Q\203F"
+	.string	"3"
+	.ascii	"\220\021\003\306\013\027-X\254\300\272\262b8UTS*R\240\220:a\242"
+	.ascii	"\004\211\021QPON\"\232B\200\370\300\344aI)\251\003R\321\345p"
+	.ascii	"\264A\203Q\021\021q\330\262\353\373\221\373\313J\240\262\f\331"
+	.ascii	",\307qT@p~3\326\354fl\251\231\024s\206k+r\314\250Y\232gV\232"
+	.ascii	"\3378:\314\272\241\3276V\025\177w3(]1\243\35442\252\327\320\233"
+	.ascii	":\r\275C\036\300\232\245yV\245g45\223U\b\035\200\302A\275\227"
+	.ascii	"Q\025\364\0300`\350\027~\204\334E\213\027\232\205\013\203|\305"
+	.ascii	"\372_\202#\364\0372A+\r\3020@m\267\347X\303,\023\260H\373\212"
+	.ascii	"\304\007m\325^\322f8+T]G\375!\323[\2674\223W\274\212j\230\225"
+	.ascii	"\245\247\372\254\340*\206Yj\240\2021\244p\001\205\2364M,{ZJ\017"
+	.ascii	"\235=\177b\216\211:>^\342\f\t(Z\232&\026\272\036\241B7\311\344"
+	.ascii	"\264Jc\360\320\350>j\t\005\302\323\r\245SU\304\034\324\255\233"
+	.ascii	"dm\255\206\026N\020\201\243\232d|\330&\301\020\204\322\200\030"
+	.ascii	"\364\201i\230\345A-*\215\354\214/)\225\361\244\265\215.M\007"
+	.ascii	"\244U\005\263O\226\376C\306gU\362s\366B\247\221\215\361\"\221"
+	.ascii	"\241\266\266\030\232X\370\264\313\306f\315\f\03141\317vhe\204"
+	.ascii	"5\"\016q\332|\341\263\036Em`zq\r5\236i\214F(\022\301\314\211"
+	.ascii	"\206Y\207\332\23014\2610\233\330exT\026\226F\266\364\366\017"
+	.ascii	"\031s\205r\26120g\3353+\275\016\263\342z\307\231\264\252,\313"
+	.ascii	"\322\377UT\226\354&Y^\353\276\357\233\324L*W\037f\275\357\313"
+	.ascii	"\256,\303\322\\@3\263a\230\231\n\363\211\030\001i\372\347\n\265"
+	.ascii	"tp\377\316\221\215\352i\247\225\034\336\375\026\017\254\320\335"
+	.ascii	"\221\215h\307\341\033\r\023\320\232\333\214\031\234Hv\232\253"
+	.ascii	"=z\247\362:.\"\335\3217\223\2717X\347L\377\034\341\264\270\341"
+	.ascii	"\231\217k.\347\310v\342\371\276/\f\3669\217sl[r\204\036\241m"
+	.ascii	"\263,\240\262\220\206\337\360$\347q9tx+5|\033%\034\344\243\362"
+	.ascii	"H\3662\035e\006\3562a\314\3347v8\"?7v(\321\0056\3666\3036\251"
+	.ascii	"\032\373Z\333\266\007\005\366\024\330\2724\366\023V9h\330\321"
+	.ascii	"\334\314\260?\001\265\261\255\017\302\251\354g\035E\217\303\030"
+	.ascii	"v\264\207\232\205a\177\262\037\321[D[\241\203awv\213h\233E\202"
+	.ascii	"i;\363\347M&>_\2627\372\246`\235\352$\030)\372\031\314<G\357"
+	.ascii	"\005\217\375\270\205m 2\353\352\262$\262\243\301\263\334Y\347"
+	.ascii	"\f\2151\"\376\267\200\305Hv\205\370m\bE\303o?\037c\342J\377`"
+	.ascii	"\370\353\034!\264\025\373S#z\247\177u1\351 \235\335=\211\355"
+	.ascii	"\377\030O\"q\244\277\3557 \t_\217l\r\\\370\376\206\357\344\251"
+	.ascii	"f\277\323\232\274\345z\312\203\370\276`\255<\200\bVD\252\331"
+	.ascii	"\226\353B!\304\367\365j%!\367\370\341\255d\377\355\b\331\370"
+	.ascii	"\276\036\031h\004\ns\216\032\323\2317\276\366\235\353w\323\215"
+	.ascii	" *N\310\200\353K\300\254\033\\r\265\314\334A\027\342R\222\276"
+	.ascii	"\357+\203\373\257cH\200\233L\263|\201\020!m\263NOC\376\377\035"
+	.ascii	"F\365\363'\302\254[[\362u\317\021\246a\337\311\215\305\213\362"
+	.ascii	"m}\001\211\023\234\245\264\007%a\200)'\310ml\271[\350>#7\031"
+	.ascii	"V2\304[9\244"
+	.string	"m\226\bSN\315\220\227W\243l\341C\372\024k/\031}\006D\345\207\373\017\3739\321\251h[\366\036\373\021K\264\211\241y\3377E\237\345\206\346j\367p\363a?\024qz\212\232\253m\266\233\204\367N\211&\0173\373\021\337\027\331L\366\213\312z\001\335I\377^\022\336\024\315\366\330\243 \324\302\027\346T\346h\322\337\311\334\rw\310\312\313\017\206\331\235\233\257\350\334{M\247\271\365\330\271\363\232\256\271\341\336\242P\267vk\356.\r\327\334\313\21667\227n\323\335cb\256s+\275V\347F\366\333o\232\217\256s\227\353<\305u\226\362\316\\\256s\024\327\331\203$\347\016\220\234\215H\316P\220\234\267\\\347'Eg'E\347&\2563\007Eg&E\347%\256\363\006Eg%Eg\r\\\347$E\347\f\212\316H\\g\f\212\316\027\024\235-@r>\202\344\\A\321\331H\321\271H\321Y\213\235)@r\236"
+	.string	"\311Y\002$\347\b\336\031\002\327\371\201wv\340\235\033p\235\031p\235\027(:\023):\017IrV\300u\026\342:\007q\235\023pg \256\363\217w\366\361\316=\\g\004\336\371\200w6\300\235y\270\316\005\270\316;\\g\002\\g\035\256\363"
+	.string	"E\347\034Eg\001\\g\034\357\234\365\3167\212\3166\\\347\032Eg\032\357\034\300\007\006<\023\241f\361N\2166W\313\343\217\334\326\260\025\214\307w]Way\243\306l\253\263\342\235\334\202\360\252\367\376\345\354H\022\343_\2029\203\305\367p\253\027\327\222tE~\235\262\020\035f)\321\257r\021\247O=\206}p\024\023k\233m\276\227\022T\247Z\255V{\253m\275\357\275o\273\236\312\"\227\354\223\353\263s+\341\312\225\357\313Y\335U\3236?V\357\344\336\361`\n\0304X\300\007y\312\255-\365t\307ij\251\332\361\201T-\242%\340w|\207m1\204\204\200g\362|\263\006\245\305\017\025\252BG\310\276T\3358\315\266)?\335c\317\"\253\201\377\367\205\252\343\375\006x\035\377\302"
+	.ascii	"\257\300\227\351\240\227\360\246\"\307\017\352\255V\200\317\301"
+	.ascii	"\337\302\367m\201p\274r"
+	.string	"\245mV\200\300\265\245\234\024\200\214WR\026\312\216f\207\276"
+	.ascii	"\252\031\302\321E}?\306*)_\b6\036\307\017\361\302\2507>\353\306"
+	.ascii	"\267\204\246\364\362l\374\220\257jgN\377\\\025\212\242\006\037"
+	.ascii	"\243\325s\217\226\243\031\215\257\361\303\274\251<xh\374PZ\375"
+	.ascii	"R\345\355\030\253\244\177\367u\216\\\216]\216ffm\2635\304,\255"
+	.ascii	"z\306\007\320\313\237\361!\316\016\005\206Q\275\350\372\270l"
+	.ascii	"\344T\215\024\035\3768\320\275\257c\017\203\322\275\nH5P\025"
+	.ascii	"\376\336h\227\023ml{\371C$\365\314\215\236\377\265\214\357.\277"
+	.ascii	"\306\2011c\374\3722\276\301\320$\347\272\305\307x\017\311\302"
+	.ascii	"@.\017\343{\371\017\270\266\261}\3610\272\332\306\326\305\277"
+	.ascii	"\370\226s\361\255\366Eop\t\326-\276\271\374Z\007\306d\361-\236"
+	.ascii	"K\257x\026\317N\301\250R\250~\305/\271)\354\003c&\275j\302\231"
+	.ascii	"\275\376\0209\355s\223\367i\335>\345\022X\357\306\313\325c\375"
+	.ascii	":\235z\213^=;G\315Ka\017\t\253o\323\032R\365Vll\252\360\324t"
+	.ascii	"\227\335\032\006h7b\r;"
+	.string	"\032\031\024\330\237\200\240\317?au*\257O\365Fg\203}aT1\355s\3245\0375\365\345\323\240\2312Sf\352Y>\352\2272/P*J\3701bR\274\212o\363\302\230\220\342\333?j\227+\\\236P\234\375YS\352Q<\2337\224\236x\251\3770\005c\223\\6\367iM\374\211g\002,\361&\230^J<+H\r\001\204\3769j\231\023\t\347\213\260\365]\360\224\205\274\031\257m\271\337\362ZHL_\254\271\b\331\327\f\262 \002\013;\034\324\312\223\261C\241bo\205\275\r\264\312\217\261;\247\255\t\355s\205\201\3364\"\314\177\360U\332\270\250\037Q\324[-\324G\375\207:\260\264\344\177=\025\250o\355\n\367\370\276\242y!\236\304<\362\210\366/\003\352#Z\353\364O\337`i\"\336\351Y<\252\351!\021\317\362\025\356\341\373j\313\003\242\251\214\017\032O\b\206\370\246g\003\205QQ\370T\267\234\317"
+	.string	"xLs<\301[\031\342\331\277B;|_l\356>\200(\324\3236\266\037\036\304w\330\022\206\017\357\344\267\207\211\351\ty\230\366\360L\337aY\222^u\341\210\302\020\017\337l\230\204\006\227\214\307N\235\207wb5W\273\244'\355[\"\264\346\204%\245\017\004(\351\225\276\315\373\343'\251oP)Os\265\035\364\362:\364\255\2511KBZ\343+\034\331N\360a\247\305G\322\223\247\370\355\\!\227LD\310\016 9z\004\001\342cG\3138v\354"
+	.ascii	"\262\243=\242\004\311\223\t\230(9\362\204H\311\226\223$F\216"
+	.ascii	"``\204\210\244\017\370qD\211V\023\013\206J\266|\020;\250\200"
+	.ascii	"\307\223#I\214h\001\201\342\304H\211V\023- O\264\204@qRd\244"
+	.ascii	"\331\210\225\023&\027\\-Ar\265\001\022-%WF\2328\271\262J\342"
+	.ascii	"%L\2164\271z\262dI\223+#\257~0\314+\216\343\257-\355~_,\357\241"
+	.ascii	"\274>\311\375~\347\375\360\313J\240\027\001]lR\354\247|\327\207"
+	.ascii	"mIz\265\305\236\235ENy&\317\031\326\226:\244\b\252\036\221\362"
+	.ascii	"A\236\200\003\214}\225u\312\345Az\310\204\230\021<x\256(+a\022"
+	.ascii	"\017>\312s\210\263\222\207s\274\223\217\332\330z\220\027\230"
+	.ascii	"\304\203g\3624\204\247;\256\213q\316\356\370\004\250\353\376"
+	.ascii	"\"'\004\275,\007\353#8P7\253\226\366\361\305V@\301'\fj8\336\231"
+	.ascii	"u\303\312_\007+\237\247\253\374\203\273\301\301\372\276\315\033"
+	.ascii	"\177p\336x\032\257\213\016Q\311\334u\327e\307[\311/\350\314\314"
+	.ascii	"\210W\004\345\215N\355\255\207R\344\267\336C\334X"
+	.string	"_\030\365I\036'\377\344\331i\223w\362L\200E\276\311\036\007{\230<\007\317N\227<\023@]\344\227\374S\240\261<\033\254\240\3447x\226\220\006\257\344?\304\325\240\022\355\255\266\310k\360O\3161:I\3622\370$\317\346!\371\fx\016\031\222w\n4\006\007\203\275\3063J=\225\205.x\f\236\265\340/x\246@`u\222|\255\365\026\374\223S\254\n\306\346\210\237\306;\242I=\331@\034\354*\370#F\276\202g\312\013\243n\265Zo\344\033\257'\370\022\013\004\253#B\213\232\215\"\377T\347\272\247W\344\233N\220\233\2364j5\336\271&[\353}\320\332gk\005\255\207!\246i\034[\n\276\375|8sW\240\256>o%\005\377\202\232\203|\311G\362\004\202\326<x\b\225\260\336\2613\301w\237g\237A\t\\X\357\216hOvg\353\234#Z\235\004}\326\334\n5\245\360\314#XB\273\240f^"
+	.ascii	"\021\020Z\343\034\321\346\352\304\254rG\264\270\b\276\357<\361"
+	.ascii	" \200au\003\367\006\030f\205\272A\360\255\367\304{ \206\265\215"
+	.ascii	"\221-\257\314\272fT{\340[\317\363\316\240\0032\254)\240\240f"
+	.ascii	"\315\232\226\306\201;k\r<s\027\340z\346\310&%\345\256\300\325"
+	.ascii	"L\327\240\ti\263\274\222Y\313t\025vM\273\252]\325@\312u\314\221"
+	.ascii	"\215\270\212i\340\233\317\223\316\240\233\227W\033\315\237\277"
+	.ascii	"\031J\242A\f|+\237}5\201\201o\346\223\316\332\322\253\317C\247"
+	.ascii	"=\277t"
+	.string	"7S\360\023\267\007\300;\271\311\376\2743\263\222\300\3564C\363\205\013xY\340\035x\326\255-\211\274\331K{\310\023Y\273l!\217W\206|/\237tQ\353\226.<\\KR2\334\013\264\315JI\ry\255!\254Y\026H\036\277\276\332f\025x\007\236tkK\"\230;\246\f\030\035\375\356\223S\346\367\242\337\276\275^\f\356\205|\247\255eB^\312\023\316\340\322\253\341\376\353\2101\354\332\330\006\371\216\006\371\251@-\214w\306ic\233\300\367\3337M\201|\002\217\202\020\373\342\235\354-\332\355\235EC\277\221/\266Vi U+\bc@\276\r\tZ]\374\370v\363\361?\200\364x\037\337\024\327\343C\004\362\026\357\214\323\b|C\017x\004\276i\032F\3652\340\017\340\361\001\203\260\250\002Q1\013B\311\020\315\210\210$I\ni\r\262\013\020\b\002I\232Jx\036\022\200D5F\224N\251\032!I\222\026\003"
+	.string	"\004\340\035)\210\266\332\3523\326\212\217\3442p\037C-1\271\270\021\343\005\360\210\030\007\226c\003\250f\351)\016eO\200\0241[\245\276\232DaKV\254\035/\324I\355\013k\310 \001(=V\353"
+	.ascii	"G*R\313\214\305o\341dH7f\303c\006a\206\321@\265JK\357\341\216"
+	.ascii	"Z\034\021\3254\013\001\336\230\247\nc,q\004\021'p\2778\242\037"
+	.ascii	"\365\364T\257\276]\363\001}7r/u\037\007_l/\242\327@\001\\\277"
+	.ascii	"\235\033\235\304`i\323\224\341\230\306\002\206\332\n\0250\037"
+	.ascii	"t'#\360\005R\027\241\317F\313\317n\212\230\004Z\001\366\002{"
+	.ascii	"B\2521J[\0212WC\276\270\327\225\327\335]\305\354\334\263\215"
+	.ascii	"+\312\265>\221\025\204\260\271\206b\235\234\nn\366\343\260\344"
+	.ascii	"\376\304',\214CYY.)r\244\2133A\322\205\226\0203A\200\221<>\253"
+	.ascii	"\311\365\274Jmk\214\370\367_\356\177\267W\354\303U\330\330\261"
+	.ascii	"4N\024It\214\201\332 \255\210\266DT$0\\*\317PhJ;\325H\263\016"
+	.ascii	"2{Qw~\375WIF\305b\300p\003)lIu\364\314\352\247\335\257\211\\"
+	.ascii	"\3756u\310V\266\033\306%\377\242\rZ\003\251\202_\364\357\033"
+	.ascii	"\201\360\317\351%\202\225"
+	.string	"\216\t\216qO\376*%\351/\365\323O\374\020\362{}\013\023,\217\304\3564\204\006\365XHi\301\36622\031\266\n=\212\311\210\351\220C\316\237\366S67\025\225\305\326*Z\263)v/\n\002\326\222\300\375\2426z\006\332\037\252"
+	.string	"\3110\214\360\r\215\021\265\267\222\25662}\224\334|\026\220\372\367xh\257<\335\273\201\365\306<\356\007\227\004:@U\225\021|\226k\006\352\312\207>V0\346\256\022*\321\001\033\272\365\223\024\031\230\206C\252\375\310lI\252E\024\251\036\215\013T\350\232\375\225\265\333Q\350|\356l\227\031\200\277u4zO\341p\016\021 \331+\365\366\347\250\201\307\322\310\215\360\330\375T\337z\231\333JV\223\304\263\357_\320@\3614\\&t\300\275\013\347\\\311\303\224G\026\240)\340\317\3430\004e\355&\246\310>\006y\037\264\205uDu\360\202/\231\316\035\343-P\260\034C\321\340\317\254n\3346\257H9v7g\025rS\310F\376\207\005"
+	.string	"\363\0047u\202\367\225K\311$X\036h\316#\206\tq\373\215\312[\250\tdM\023s\307\220\261\013j\350\300\264oe5\244\354\004`\210\263=\002M\206R9\342\277a\361\273\003g\211\336\006\274\266\237\300\367L\201\227`/-1\325\211:\024~\305\n?\340%\0229+4\316D6fGt\030\3269\255\357A!iR.K\013\206\030_\354\355l8fC\250\307+\005n\346`p\273\366\265\003\333\363\251g#!*\355\2736\244\327[`L%M\226o\340x\273\221<\205\306h\352\177{+\342\326\336k|\244\3540\007\350>zhr8Z\370\357\177Z&\330M\3333\334\271\037{\230'\263\214\331\215\305\317[\254\034\375=\351\235S[\317\025\305\217O%Q\211"
+	.string	"o\2551P\353\340\257\231-\342\007\337}\002\305\377\213\370\205\3358\002\027O\024\361w\301q]\345\326\020\202%\361\244?\023J\\\234\021\314A\254\203\317oc/\031J\002O"
+	.ascii	"\324>tZy\240\211\231J|\347d)\365V\344\342\344\252F\303\325 J"
+	.ascii	"\372$\003\371\371\213\334\203N%\r\327\007ka\033\275\254\r\371"
+	.ascii	"<\021\323`\017\"\3225:\243\336h9l\365\326\004"
+	.string	"\264\212\344\001\016\215o\022<\311\260\345\334\022Q\224\255-\223\020V\"\242\023BOq\215e\2664\226\003<)L\376\023\030\033/,Wc\016\266\270\211J\bsA\\RW\276\306\371\277V\216Y\324\330\r0\267\206\301P\323\345\336\004<\016-\256\345U\210\305\347\003VV \224RQ\214\315\rt(*\254\210s\r\270\272\236\271\222\215_\366\277O\\\270\377n\232\204E\016\361^\202\350\232\226/\312\202\267\006\324\023\231s\\\336\"\240\375\271I\030\373\324\004\357%\354(\033\254B-0\205\340\350\322\354\367\002f\017\006\244)\310\273W\026\036\257A\331\331Aq\277\377\032\363n7.e\276\227\022]\226v\220d\"\325>V\255\260ar\330h\255\220\365)\230\230W\267\340]H}\n\2409\3543\375Q2C_\200\"\351\313#\207\212S\372\246\306\025\374\203\210\b;\006\212\371\230\363\210\bjOy}\211\033h\375"
+	.string	"\356a\256\025PO\321S \356\205\370\177F\225RS\204"
+	.ascii	"\232\332\240]L#\027\003\035\355]O\344\215\003\276s\262\373\017"
+	.ascii	"\330:l\021\0201\261\017\270\223a\036\234\340!\003_w_}(\002\222"
+	.ascii	"x\371\261\272\320\266\236i\227\023X\317\357[\177\235q\345\375"
+	.ascii	"\206++X\220\227+\356\344\305~%'\204.\252\360\261<F\005\276\267"
+	.ascii	"\226\266\276gx7 \n\256\246t\202f\372\226I`\036\213\334+AU\235"
+	.ascii	"\306\211\\\025B\221$+\215\001\034r\235\361\207g\300Tp\275Rq\374"
+	.ascii	"@(`#T{}\273\315\224>m\316\203\207>L\\\356\177\262h_\366/\204"
+	.ascii	"\262W\320\275\b\362 \225)2\354`f\001\354`O\270\200nO\221c&y\005"
+	.ascii	"Y\363n\251d\r\202#\266\ra\332>Pi\334\370S\214\255(\323hn2\245"
+	.ascii	"\256r\227\240\220Y\235\334n\342\247\356)\264\034Pf\320|\351\323"
+	.ascii	"`\365S5\246\022\311f\335\277\271\007$\367\223\260\241\037\216"
+	.ascii	"\324kY,\211\342\373\274[\030ELDq]\365\302\316|\f5\207SP\373\""
+	.ascii	"\275\360\314\352\326]V\022r\246\2131q.V\242\267\362\304 \341"
+	.ascii	"\316\340\277\234\305\3519\220,~\340\331jj{\262\335,\343\315\265"
+	.ascii	"\213>\365\001\250(\032\322\2577\b\204\355\256\344\342\227KP\350"
+	.ascii	"R\0168\355\221\"\272\220e\344r\340\375\022A\203N\377Y\\1s\"\320"
+	.ascii	"\035SP\204\340{\371\233\261%0e\2109\271{\227\3640\027\221[L\327"
+	.ascii	"oL\035(\2761\331DIM\323\200\326\302\313t?\203\236\333c\270J\322"
+	.ascii	"\021S;Z\b!!Z"
+	.text
+	.section	.gnu.lto__update_checksum.98.1640ab20347ee54a,"e",@progbits
+	.string	"(\265/\375`\344\001\225\020"
+	.string	"\246\236lE"
+	.string	"\315(\035\027\232Z\247\345\307P\016\022,\226\203\207\027\206\353\320\3328\241\377*$\r\226\214\022\235\361\265\033\327\252\273bg\365\224\276\242\237\370\377\177'\247\375\023q\300l\362\245n\001\240\030\\\356[B\366\2262\245V"
+	.string	"W"
+	.string	"W"
+	.string	"\307\330.C/\260]\272e\2338\35023r6L\250\245\230sv{\301\017\037\301;j\3532\256\266|\0041\037b\236\311e\344^3\f\001\274W\344"
+	.string	"\352\301y\355*\363\\\0323\250|_\273\203\235\217'\346\251\\\271\006sNk\314K\271\267\333F\331.\331Z\n\0070:\370[\\\346\027\035\274\271\313\334[T\313\250\216Q\275Q\255Q}\002\030>/)\377F\3149\013\203\246\216\304\201\271\260kX\031\003&\n\215\205\215\231 \005\2536\203R\353\340\312;'\213\210\004W\3731\347\320\272\f\353\2449[:\200\230\023\\\340\003\241K\203\001,\2568\347\234qi\2667\276-i9\332\027\3024\2704\264\364\210\273+=V\241\270\362C![\331\035\221x\314G\367\273{\0250\026\227JWC\334\346c\025z\361Y\333\345w\243}'d+'\032\256M\316\313\333\245\331\240\211r\270"
+	.string	"\365x[l\322k~\001\237y\017:DN\321\324!r\212(\220\bk*1}D\2374HF t\251\220\016\025b\222\320\235T$\235\206\001\247F@T]I*\245\352.\300\371m\261\b\246\202\316\311\272\344\322<\273\371\361\260#\213\345V\366\332O\341\346g\305\222\326QE\273\255\314*\232\022(\n\344\207_m\334\216\226\333\371x`\001* p\202\231\224\333b\340\225#A[3Q\221\243`\024\003C\214\273\r\030\351\263.\235\346\363`\333\240\013\347\005\217o\230\255;\030\2363\340\324\006\263"
+	.ascii	"7:\"\312\035\243\371\2256p\255\r\216\035\003\263a\006\246\224"
+	.ascii	"\035|\f\343\006\340\210\200D\t\367\022Y\310\023\224\335\f\242"
+	.ascii	"l\272\350\023"
+	.text
+	.section	.gnu.lto_UBLOX_parse_gps.99.1640ab20347ee54a,"e",@progbits
+	.string	"(\265/\375`\024\031ue"
+	.string	"\232\240\240#O0\016\323\032\003A\213(-\365\263\313+y\220\255\1771<\352rz\315\350\306Yl\243)p\322mOQi\332flR\031:B\326\n\032"
+	.string	""
+	.string	"\001\2027\304\276E \253 \324P^\350\005\027\307\366\337\037Tu\021;F\325\223\255\211$)\245\024\r\002\024\0022\002%Tg\022\2523"
+	.ascii	"\252\363\b\325\231\bt\236Z\235E\254\316R@\347\250\241s\b\240"
+	.ascii	"3\324\320\031D\216\363\223\320\331I\350\334\264:3\255\316\037"
+	.ascii	"\204\316\036\204\316KCg%\241s\222\320\031)\350|\244:\033\261"
+	.ascii	"s\007\240s\221\352L\244:\017\251\316B\354\034\244:\003\251\316"
+	.ascii	">\252\363\006\325\271\207\235yT\347\035\325Y\203\352\254\243"
+	.ascii	":\347\250\316C\325Y\310\316\301\325\031\270:\257\253\263\272"
+	.ascii	":\377\332\331\374\252\263\377\234\373\003)>43ioY>\315\323\365"
+	.ascii	"\321\027\307\235S\2738i\264ng;s3\367\223;mJS\331\321h\036\374"
+	.ascii	"\\\257\247\333\225Cw\305J\231\324u\223M\301V\371\031l\346\035"
+	.ascii	"\334g\234\323em\266\243\235V\355v\271\035\202\364M\313\235\353"
+	.ascii	">\243Z\345\017\301V\225\032hm\365\327?k\253L\342\304\016n\207"
+	.ascii	"\260\2140\214xc\323\202J]\367I\3740#\356\351\337\263\271\350"
+	.ascii	"\333~rjb\372\340aI)\t\351\310\250\003\210\"\242!\241  \016?>"
+	.ascii	"\033zxv4\350\344\f\205A\340\252\376\336[nc?\001\351\332\276\264"
+	.ascii	"\265\323\016\327Q\2137\035\2638\323\2075\367\300\206\305\227"
+	.ascii	"\224\254x\022\333\231#\321hS\341\310L\212\033\225u\207\276*k"
+	.ascii	"\020? \226\217&]&\031\346\247b\357\256K\323\213R\350\212\322"
+	.ascii	"DQz\210\331BL'\036\324\204e\256\254\t\304\341W\002KZ\244\313"
+	.ascii	"$\331~:{Zg\232,\371\372\217\230\373,\351\rK\224x\317\262y\214"
+	.ascii	",}\307\bY\022\3145\350\260-\225I\026\361\234%$]Dz\370\013\001"
+	.ascii	"\006\367\003\210\f\nl\232,I\304\205e\222C~Jd\311/\017\002\251"
+	.ascii	"\nP:\245ezH\272\330\032(\244W \225\220Vw\270\262~Jg\355[\\X\376"
+	.ascii	"\363\266\376&LL\360\342\341l$\311+k\320u\335!\3271\350@*\327"
+	.ascii	"u\331\221\\]\315P\315\374\036\230y\2129\210\031k\316+\177Sc\240"
+	.ascii	"\344\r?\311wq\335y\035'Z\035\017\337S\342D\212\r7\244u\322n_"
+	.ascii	";\337pu-\344\3227\276\317\272Gp\366\227\326\3607\236]\313\353"
+	.ascii	"(\346B\212M-\023\017\322:AZ:\020\r\337A\304\246^\342H\363\304"
+	.ascii	"\264c\351s\365\202\257\354vM\266*\264P(\020\203\303\004\352\364"
+	.ascii	"\230vq\315y\235o-\257\255\234\217z\363\265\016_\204F\342\275"
+	.ascii	"\265\360\207\337Z?\216\336\347Z\305'5\204_%&C\323\350\207\031"
+	.ascii	"Sm\327\340W\241\251\341\341{\314~t\036m\313B\013\245\205\362"
+	.ascii	"+\304\362\364\274\200M7\272\333\347\206\304\0336\273\255\353"
+	.ascii	"\003\037\230%+\312QJ\307\231!b\206\006\232\366\326\357\025\304"
+	.ascii	"\362\232N\365\231[\263\226\302y\323\236u^\fx\252\236\363\367"
+	.ascii	"\3140\372n\006PTF\273!\200\307\256\333\030p@\002\336\310\004"
+	.ascii	"\326V\037\212\304c\005z\315\f\251%3\003\255\246"
+	.string	"\001&\024\321\256s\200\373m\225!\240A\343{L\314M\323\271E\207\003\2616\314\274\006\323}\326\b\3140&\2753\372T\305r\357\356\367J-\315TF\237r\267\367A\257\212\374+\315p\237\031\201%Z\306\234\343&\343\0036\346\036\211\343\226[\337\370\306\\\340~\341\317\236eL\367\310\033w\030\307R\315\302\2241]\367\013\267[\207\341\302\335\205\333\004\373hm\265\373\210+&n\314=\342Bu\033\247Y\202\025q]c\203q\033G\272P?\367\313\371\230\233\255\263\024'\250Qcm\325?\312\356k\251+X\271\257\200P\201G_\356\016\326V\205\242y]\245\325:\340~\371\006\016od\253\3348\276\213\334\034\230\231\327\225\3671?\215\376J\346~*joF\376$\314\252\363\r\325\331F\361\001\325y\001v\036`u\226\261:\307\200\321\316f*v~\301\316.T\347\026\2523\013\035g\001T\347\025\252s"
+	.ascii	":\316*\206\316)\206\316(\206\316'Tg\023\252s\30545\342\220xu"
+	.ascii	".-6E\3278\034\326\016i\371\206\370\035\344}\323\273\362\306,"
+	.ascii	"\323\276\006d\213\336]\320+\271\032\217u\323B\211\340u\223\346"
+	.ascii	"M\301\340wn\354\220x\"~\352\177\312Z\222R/\342\207\354\262\242"
+	.ascii	"\034cp63XD\327\260}'\226j\244\276\361^\267f\224\f\036M\023\342"
+	.ascii	"\243\376\351\3408\235\325\324\031\266\317\311L\210o\346\373E"
+	.ascii	"\317\t\365\314\254\236\223i\211\314\201x\250\177\250\026\337"
+	.ascii	"\025;\203\313YI-\331\251\307\261}LQ8\020\337c\357\0270o\333\230"
+	.ascii	"VBf\006\344\301\317u\221\274\270\243\342}\374\302\033\332i\355"
+	.ascii	"1\210dn\261Z-o$w\035\031\013s<\336\310O\337h\355S$\236\360Kk"
+	.ascii	"\314\232\261\026\256N\377\364RM\357\341\235\376\210\351\233Z"
+	.ascii	"\360x~x\246\207\242\313\212r\024\301\275\314p\350\262K\033\326"
+	.ascii	"q\242\\>\274C\2258?\351=|\3214\013L\351\227\266\274\315\252\331"
+	.ascii	"hi\303\372L\026\245o6u\316#d!\270\315p+\322'}\0214\213\354\350"
+	.ascii	"\221\376g\247\305wE\202ci}\274\210^i\303R,\255\034}\247\265\312"
+	.ascii	"\367\262\351\261*\006\312\307\301\253\264\r\022\324\240\325\351"
+	.ascii	"\364\321j\3646\240E\3422\255\rs\212\242\031"
+	.string	"=Q\311\317+\261\272\303c\220\302\231\333\022Z \336\310\016\337udF\346\216o\344\"!\376l\211\234\331}\271YK\344\251\254\rKZ\272\224\242o\260\267\n\221\t\336,\362\264\2353}j\304[(J\261\320\2061\255@\364M\366B\365|\206\310\204~hL\350\253^\350\006\236\250n\2665\256\036;R-C\306?\2253aAMd|P\017\317'a/\322@\257\203\346\004\177\213-'\326\2065\230%@\337r;\013\240\361\371\005P\360e\321I\351amX\n>\337C\336\264\266>\270\206r2\2353\372T\303\006$>B\367\374\206#=_%\306\327\364\322y%\3730\252[\rK_\023\241T\307\370\255\250\216\361Oe\214\03345<\017\346nH\274\030\317\363\255\305w\345}\0018.\310\261A\215\f.\300\261\2010G\363\215)\r2\260\200\250#\007\021\203\034\025\\@\274Q\245\001q\212\003\353\310"
+	.string	"G\025q\003\035:\252\2109O\267?\t\323\330SSsr\256`\0341k\324\332\336\261z\200\001\336\377\310\307\2471tq\355\365\306\221\3461\332\325\0274N/^\306\013/\032\352\243\211\bM.\336\306\213q\361\337\225\006\t\006\327\305\364`\334\334H?\264x\026^\272\264\330\322\246\205\205\007g\013\300\306N\t\256\t\360\022\274n\232[\032\352\211\224%+\354\224\240\245\032\b\257\0353o\235\302\004\252\364J^\361\001\374\267"
+	.string	"\345\241\305\264\025\337`\352\232O\245\330U\244\374\024\326\254\323\226\317"
+	.ascii	"\276\253(q\376\224\200%Mze7;eU\361Ugo\306N\t\276\224/c\321\240"
+	.ascii	"\254\232\332\332\252\212\227\340e\243\347\364\322POT\2303\372"
+	.ascii	"\024)\3057Q|\212\357,\260\343\267\360P\254\256\260kkk\253(\276"
+	.ascii	"\223o\232\346\321+\371i\353\253G\207\007^hM"
+	.string	"H\023\020'\036\306oY\2550\276\371\232\237F\243W&i\030\377\300\377@\331\324\262\300\216O\310\244\320x\215\025\223\242N\270\004y\351\244\277\244\231\274\235|\351\230\3055\316+Y\262\357\031i^\207Wr\203\370$\334g\r\345\002Q\361\3717\364O\365[T\177\342e\230\370\023\237\202\211\027\252\353\356\237\353\272n\221\325J\365\305\377Q\256\275\225@\241x\204$K\333\0371\002fB\221\022c\232$\206\024\223\242_\\\342\274\274\220\242\213 ,\231\026@X\272\023?X;\021%\220\370\336{\345\364"
+	.ascii	"\340*\"-\223nl\334\017\372\366=\212-\242$\260dX,G`\351L,\267"
+	.ascii	"X;\251G\002\360\375\346\225k:G|\b\305#\376\254\327b\305p\277"
+	.ascii	"\2552\373\002\033\347\215d\343\246c\236G\261\305\322u]"
+	.string	"\024|\177d\311\244Pa\346\257X:\"\263k\336\310\332I\275;\342;\357\215\323\373W{\303\342\"\nr\276\346\260%\244\211\020\267\325\372\277\305=4CO)x\341\244yB\257,\256\304\177*tf\320\344\210{\001\201\377\250a0%\231chDD\244 IRh\r\241\005\204\020\006\231\263z\021\300(\246\034C4S\322$\351Z\207\2214\215\222\245\210o\377pM\2502\357J\365\361H\225\213\346\206\214\207\032\033`\253\321\237\f\024\313\261\026\343\341l\257[\b\257P\330-F4b\207\246\006\250\214\232\031\202\352\b\373\037\331<\241{\201\272L\262A\304\345\320\310\300.A\0339\016\304*\f\364\275\007\220\265\020D\001K\220\374\f\013\337\344 \322\216\374);\2266\310\231`\230k\"+\267\n\322\376\377$\226\235\354\216\321*qO\317y\305e|\007 \243C\200\002\f\254h\250[c\021B\341\302\323E\310"
+	.string	"-\022\333\233\037\352\021z\246\253H\220\321\352x\323\005\262\342\035\376G5\r\267>zYo\304\037\227\343\301\3070s\311\t#-\252\352\"\207\036\302c\201\313\243\2206a\024\260n\213b\362\201\013}. \224\2415\035\320\331P\201\002\300\337\273\312h\034\024\274~\346\305\036h\220$$2\340\262j\202L\2368\r\356yPyZ\257\242\352D\200\034Y\346r\213\346\"\262\n_\235X\212_a\006\203UF\314\201\032\373\233B@\217\f\223\354\336\223u0\363!\356\251\320\342)\216\334@\034!ON\2668"
+	.ascii	"\271\275\333J\214&\031\377\034\37668\245,2\2664\365;\356\307"
+	.ascii	"\006\2177\006\006\3335\374\310\274\343\033z\371\371\214Ox\"\357"
+	.ascii	"\367=.S\016\222\241\272\003\301~7\306\035W\221\016W\251\276\b"
+	.ascii	"R\367\213\004\332\036j\020\376(\263p|[I\262[\276\007\343Nsc\203"
+	.ascii	"#\310\210\376\242\310\263\371\353\002\207\200\037Rk\"\250\250"
+	.ascii	"\223\274K\236U0\302\237\b\334w\374\033\371a\234\3067j\337a\244"
+	.ascii	"\020\314\331\263\206\360\373\030\234\345\256\017\313q\323\377"
+	.ascii	"B\365a>\353Hp~\203\240\350!\351\331\256\377)@\235bKl/\026\\e"
+	.ascii	"\361\301\357\253\b\274\026\252aL\035\326\026\340oT\242\025u\320"
+	.ascii	"\001T!S\342\350~\315\212(\326N1\212\241RQ\033\034\230\325\342"
+	.ascii	"\fP\211.\321?e\030m\327u\310O\020\023\207Hx\032\326J]\315\n\211"
+	.ascii	"\321f\362\374\006\247\245h\271\352N\033\263\325GQl\225\241^\013"
+	.ascii	"q\032\354\004\277k!;\342\336\216\335C\372\265R@\252oSa_\017\314"
+	.ascii	"\264\203u\264\260@\004\2145\376\352,-\206\237\223\332j8\202\322"
+	.ascii	"\235\260<\367j\375\262\020\023>\021\255\01372\214\017\253\250"
+	.ascii	"\303\263\237\325\345\212\210\002p\373\217\202\033\323\301\360"
+	.ascii	"\317\024\216 \276\261 \267\322\206\357 \347\r\037e\337\3568\001"
+	.ascii	"\305\220r\316V\270+}\251\031\3345<\033\222NY]}O\003\362X~\213"
+	.ascii	"\221\001\246w\226'\261\205A\260\241\357\257\225[\213\263\332"
+	.ascii	"v\346\265\340\205\273\227.-\271_\334M\3506C\227\365\2665\303"
+	.ascii	"i\300\224}\0215\334\336a\3362X\216\b-C\003\322\242&y\217$\305"
+	.ascii	"\013+\344\313ir\275\250M\210V\306\206 \307\305\301\274\0375r"
+	.ascii	"\3250+\020\245\017\342\225\t'\366\032x\0201\367 \365\364J\007"
+	.ascii	"}\337@\203\346\256\310?\202\333\227\244\231G\020|U$\350'\243"
+	.ascii	"\024\r\270\203\221\365\260h+\211\r\375s4HJ\245\305!\246\355\034"
+	.ascii	"\263.\016\305m\301\025\b\033\340\207'\341\307\375X\201\226\330"
+	.ascii	"\367\177\331\266**\350\364>\216\334cH19@\224\004\020\247\243"
+	.ascii	"\tpG\221;\003\032\332>\354\264k\3701gt\211\215^\327\016\222\252"
+	.ascii	"\003H\032Z\220y\330\320@\005uz\300B\013\366\0016\001$\274?"
+	.text
+	.section	.gnu.lto_gpsNewFrameUBLOX.100.1640ab20347ee54a,"e",@progbits
+	.string	"(\265/\375`F\020eC"
+	.string	"jk\360\027B@\236R\007\257\317>\230YY g1\353\247>WC\361\243\036=9\2676b\300\320\031F\001\355O\013S \360\303\346\025L\024\204@?"
+	.string	"\301:"
+	.ascii	"\230=\030<\362\356\024\370\263\0026\322d\023\231R\nn\001H\001"
+	.ascii	"~\001{m^\347\036\347\337\355\355t^\327n\327I/:j\270\265\361\036"
+	.ascii	"\235=\321\352\373\2765\332\275t\322\335v.\336\245\206\317uI\205"
+	.ascii	"Y\337'\204/WGw\245|\231\335-\272Qv\327\273u\264\313u\262\273"
+	.ascii	"\343\230R_\326WH\226\366}\251\036p\267\253\360{\325\253\361\373"
+	.ascii	"F\361\364\336\327\212\240\003\034\335U\320@G3\225\304\276\352"
+	.ascii	"$H\263\035\243K|_\353\025~\322G^\264z+=\323\241\236\234\232\230"
+	.ascii	"\226\224\222\220\226GFEDCB\312 \240$\362\347h\314n\021?\263\375"
+	.ascii	"\001\033_s\360\356\371\345Pq\377Dxu*.\205\2609]\220\f\256h\340"
+	.ascii	"\220\314\035w#\253~\023[]\223i\213\226_*b\261\3043\027$\243\026"
+	.ascii	"!\344\031k\343vm\257\344\244\354\315\223\214\023\354\334\300"
+	.ascii	"\227\276\252\026\255\354\315\221\226\312gs\372GFR\276(\212\023"
+	.ascii	"E\201\362CB\312gS\316\247\334\310\224\274r\n\255,\352A\202d\321"
+	.ascii	"\242\324\373\276\356F\226\344\201\364$\257e\220\256\237\234\037"
+	.ascii	"\243\324\317\356\2105\03537x\367\034\342FA2\350\330\347!\356"
+	.ascii	"\026\rD\377\210(\237\315\342rM\223B\227\363\377\361\024\373\342"
+	.ascii	"\3079f[S;3C\342hdGx\204\345\\\345\b\036\362\331D\276q\302\373"
+	.ascii	"\276\375\316g\231w\224w?Ww'\350V\232\005r\230*X\260\310\356\346"
+	.ascii	"\230\332\275!\202\375\366\230F&\352^q\257l\205]\260\302,s\204"
+	.ascii	"a\237\247\035\317]\3163P\261&\036~=\037\2456.\330\"\226\206\361"
+	.ascii	"\236\360\365|\332\335\263kdv\360\233\366\301\243\032l\365\215"
+	.ascii	"M{\033\343\034l\373\232\f\210\255\276\001\266\007\272_\374\332"
+	.ascii	"\257\305-h\332\3730\233\231v\276\367%\357\025\312\0242\355{\356"
+	.ascii	"bn\032\275\352\333\273dL{^\033\036\337\367\313\243\355O\331\335"
+	.ascii	"\251\to\233+\220C\027\323\335\206\356\3216|\347[\240\370\232"
+	.ascii	"}\237n\007\343w^\355k\335b\353\335\351n\373\026\306*\\\213\302"
+	.ascii	"A\301~\333mm>\226v\273\333\271>\251\215\323\272\221\337Y\307"
+	.ascii	"\357\017^\347\355\301\253\356V\036\347]\325\337\004~\276\007"
+	.ascii	"\3647\325\361[\300\361;\300\361\033\300\361{\352\347[*\177G\035"
+	.ascii	"\277\241\216\337O\371\333\311\370\335d\374f\302\337K\306o\245"
+	.ascii	"\374\235\224\277\221\362\3672\177\037\031\277\215\214"
+	.string	"\337E\306o\"\343\367P\376\026\312\337\312\374\035\224\277\201\214\337\311\374\215\314\337?\371\373\230\277\215\371;\347o7\177\027\3637\316\337.\302\212o\216\215\227k\017<h}\205l\367\274X7\201h\234Y\243&\314\244f\256\t\017\200\002e\302\\\350\234Y&\214\224\006\346\025uk\3708\257(\265n\f\017\227\301I\355}_\007\356\366o\371\352\206\3665w\233C\207\016\331]\006\204gJx\t\013\321\001n\307\372\020\241\361\254\254\204\035m\016\360M\t;\221)\035*4\t\013\022^\342$+HK\354v\204\227S\2160\216\251\241\026\252\206\212\375z>C\306\237\026\nIq6s\204\355Y9J\226\207\021\206\325\350\231\022K\377\311\233D #\330\303\240\357\363\254l\204]0\303*s\201F8\255\b\023a#\264\"\f\345Uy\b\023a\347\261\2479\204\213\304\376\324\b)Q\342 ,\224D\031d\006\204\203\216"
+	.string	"a\034S7T\254\221\277\274?w0Y\236@I\334O\344\213d\205\0301\"'\261\220\364\212g\254\017\262\354\007\0371\222\354\347\030\304\210\217@\214\030\3074P\013\370\316\353`\032<\311\036%HL\377\264g\231\307\t\027\027q\016s\361\222\020Z\304`\356\314b\\\304\316#\332\374\355\277\030\343\230\376Q\241~}\266g"
+	.string	"\221{N<\2403\233'\205\215\351\031\352\231\025N\324\0221\345\323\236\241\271\343\207\306\231\3652e~\260\324\214#\"\351\322l\235\331#\226\266W\256\203b:f\310y\330\305\330\202t\346\342\350\271\203\301r\005\233\261\264\335\320\304\324nn\360.\353\314\334\036\307\003[\276\202\305\f\031Z1\262\026\r\255\025\305Va5#F\213+\256\255+\030[Z/\256T\310\230qeu\324\\1X\310\270\242\301\305%\343*i\005s\234\326\216\005T2\226\367\364j\276\342\352c,\017{\241WUa\345\017\276%\332C0\334\354\347c\205\"P\340\273\231mL*\357N\002\330\265T\261M\374\365\201_fO\021\334\356\f\300XlxT\250[\247\027\346\204\245\355\205N\205H\205\261\330\304h\241\002p6"
+	.string	"\026@\347\017\273\2520\257\\\311\356\006\3007\330\354\264\320&"
+	.ascii	"s\n_\317\2470\2008]G\302)\034\203\215N\033'\301]\344\3767\314"
+	.ascii	"8\027Gp\336\367\365\265\366\027\331]*8\210\317\346\333\274`f"
+	.ascii	"aR\251\331])\214\305FG\2052EaG[\023\205]\316\251\262\210iQ\270"
+	.ascii	"%,\355\005y\222>`|\207t\364\003C\323\332\212JY\270\357\001]"
+	.string	" \301\371\303xu\335;\316\274\237\213\343\367}\032\346\026&\034S\216)\227\335\315\302\004\b\367\266\333\355\326\273\262\007\374\001\273\235\037 R\327\034\254\2136\361\240^\034\223\244,\037\210i\237DD7Z$(\\\246\313Im\317\273\362\023\206\302\230OS\370\274\256c?\336\217\251`\341\302\205\354\356\0236\202\321i\023\205\213{5\017\263g\351\204\035\r\214\023F1\305\243}\363v\201x\234Y\301\353\021\226\266\323%\351\002\201c\250qH\307\030\242\021\021\021\221$I\322\032\361\005\204\030\306\334\325\003\021\3208\306\034\232\271M\n\351\320\003a\311\2450\374\"t\254\376t\262\013\177\220\36792\264\353/\276\320Ha\215\311\362\317t\376Dab\247\tD]\032\274\003o\030\3269\314\016O~\036(\325\264\035U\306\304\240\351\222\274\253\313\251_\007\313\320\rR*\375\356\242\277\307\317\204\036_8\361\204\361\253\336 &"
+	.string	"\366g\\\001=\225\204bw\362C\177Ijm\324\021\002/z`0\302\177B\207\324T\221\021\223\357\035\005\252~y*\235\232\006\301\357dw\236\252\313\355\374\320\005\013\n@\301\362\003\355`E\036D\214\301X~\313+4\017\224V\3313b\0244\024\223a\256u\304\3230\351\376\326h\304&\302\270Y\201\377\361e\3025cB\307\263\007\330\211\036\001$\002\376\202"
+	.ascii	"\026\236\270zJ\311\204*\2513\364q\304\371u\273\327\355\370\237"
+	.ascii	"N\304\375%\332\253]\227\201\370q\212\325\022\340\210)\232_2\346"
+	.ascii	"\273\235\372=\373aD\360-4\326\213\275C\345\314\223\242\370\007"
+	.ascii	"\341yDQ v\234\323\304Lh\203\317<\005\362\036:s\230\314\300o\240"
+	.ascii	"\340\022\ru\320\344?\335\347&\373\305\321\256yheH\264Q\346\260"
+	.ascii	"\207\313#\332\340\343\374\323}n\262_\034\355c\034K\374D\333\025"
+	.ascii	"z\351]\216d\232\300M\r\f\373z\206\314\300\r\270\261\321\023\215"
+	.ascii	"\003X\027\"\300ABw9F\321'NY\3715=\350\241\004\262\302p\244\315"
+	.ascii	"\255|m\030\242p8\003\315\250\20502\333\032\200j^U\200\342\204"
+	.ascii	"7\364\311\341J\322'J\2415\253\310\306\214\342&\216\366\237"
+	.ascii	"<\026l\3640\312\260\315\370\206b\246\251:\222\214\177Q\3144Q"
+	.ascii	"Of\2548\221\241R2\343&\367E7\034\362\004\240\022T\021\004l\205"
+	.ascii	"\271\226|\201D\024\307\324L\312yv-O\377\0206#\276\201\346Jd9"
+	.ascii	"e\202\341C\b\302\222\rB3x\243\244B\250Uc\266\0051.\2400\221~"
+	.ascii	"\315\331\346\351 \327\nou\237\262\"5\353\203\004e\013\023z\376"
+	.ascii	"\232CPx\021=\350\232\273\006\033\246\bD\357pn\351\226\024\301"
+	.ascii	"\372\027\313zv\227\341\272\2607\224K\314\245\303\315\262\005"
+	.ascii	"\323\213t\220Xa\262x\":\273\376\003"
+	.text
+	.section	.gnu.lto_gpsHandlePassthrough.101.1640ab20347ee54a,"e",@progbits
+	.string	"(\265/\375`\232"
+	.string	"\245\n"
+	.string	"\246\024J> O\225\016\003\217\001+\230\260\351\003\223 \017\370\367\221\020n8\330r \r\240\036\242\242\373\033\301\301\006\261*\262 o\f"
+	.string	"!\002\022\300\225\0133\021\302^r\221\201\221$\326F\262\245L)8"
+	.string	"8"
+	.string	"5"
+	.string	"\273\021H1\372\230X\354.\246\033\256\035jj\376;\034\203\353\266C\013W\330\021\312\340]]\007FN\234>\217O\n\235'\363a`w\235\\\007\272\255\333>`;\200\375H\240\243\276\335\n\337jO\026\t\222\355\373\037\0367\367`\215\021\n\016\273{\335\2627\366u\353\227\355L{@\001\355\245\007\326]\f&F\354F\001\006"
+	.string	"\271e\315^\301\001!\212"
+	.string	"\004\312\223*?\362\352\307L\203<\007\365\361\237\020\301\213^\312\243\233S\2577\251\b\361i\301\311\317\216\235T\221}\270\032\262a\032\276\364g\246\017\311\013\244U\023\315$\0014E\222\271,\300\262\n\306\2402\261`\024L\006\223l8\273(\300`\232,\303`W\344\\C\226P\"\345\2458\332\201\031\351GK\226\347\254\272]\245\341\023\241*\262\355\340\002\006\017"
+	.string	"3\003\016j\310k"
+	.ascii	"\217\r\234\206e\2036\265\204x\254C\200\256\341=\232(\203\n\241"
+	.ascii	"R\227\305\265<\225\220S\n\265\007"
+	.text
+	.section	.gnu.lto_gpsEnablePassthrough.102.1640ab20347ee54a,"e",@progbits
+	.string	"(\265/\375`i\001\375\016"
+	.string	"6\335fF\360\260(\035x\177;\020\227fj\220\272A\0278>\027$FZ\\\331\f?{\202}\354\337\236\001\357\337\366\312\334\373x\312N\373L\001\370\036\203}\243\223\007\223>\016\007\227\226\246Q\244\323\274\300B \331D\312\224\002R"
+	.string	"K"
+	.string	"V"
+	.ascii	"\273/\027"
+	.string	"2\273a\002\037\340\036\035\336c{\344>`{\264\311\226\361\020\266\005fbV04v\267\323\0177]\3234\371\177\371\006\330:]S\271j\blV\334xZ*\315\203%\003\377\362\334\320Je\002`\260\273N\260\225r\307\333n`{\201\375\027\001$J~\314'(y\360\321G\331\036\257\017nb\035Z\\\250\234\331\341)u\305\276\266\273k}\331w\371;Oo\232\216\232\3262\255O\347\323\367\234E\206\305!\3455-vY\263\032K\023Y\200\340\260\375\264/\342-\246\273\224\036 \0364\350\311Gq\325\250\004`jf+\225\324a962\252+\266?6M+\224\210\241\312\034\347?6UM5\305\312\225r\3501\026\270\335\r\361Od0\341b\245\355Qu\303\005\2253\023\251\020d0Bp\3319\213\213\206\313\253\215\341\313\2036\240\322\223\375\021\017\244\221'R\002:\361F%\244\357\373\210|\"\220"
+	.string	"\217\200|\"P\347\205\272\013\241\217I72\372:\220\016{\"\222QG\362\274Q\307\021\356\265\325\227\035\314,\216\rJS\356H?\302\366P\302\204\020\330.\352`G7\265)|VzR\261iG6\003G\363d\324T\233\004\244 \031"
+	.ascii	"3\241\221\037C\016\213\20767\320\336\223q\3656\362^\025\304b"
+	.ascii	"\201\355,=v\263\241a\006D\326\304\030\314\241eD0\\Bs75\037M\013"
+	.ascii	"\001\230s\t\266YM\021wy\252&\247hj\017"
+	.text
+	.section	.gnu.lto_GPS_calc_longitude_scaling.104.1640ab20347ee54a,"e",@progbits
+	.string	"(\265/\375`\245"
+	.string	"\305\n"
+	.string	"\246\026M< M5\035\004\340gE\354B\314H =^<\264\t'"
+	.string	"Ef\222\005\340\rWB\"\307\232\036\025\202\030`\343\270E\004\001\026$\f\004\007|\"a\020\325%`n\320\261\233\224)\005;"
+	.string	"9"
+	.string	"="
+	.string	"\266v3\214\b\261\273\b\354`<\032\370\200\305c\365"
+	.string	"\213Go6\370n\303\026\360L\025D\251\335\275T\303\267\347\346?t\213\333X\236\025\nv\327\311m8\267\336\266\303\366\303\376\202\035\373\335\035\017\372\253Lk\2463\323\267\b\200,p\016\236v/\204)\366\213\":\274\373\355?\344\206\355\316\245/g\3633y jw\037\217>\300x\332\377p\020\333A\024\002&bF\265%L\310s\252\032\372\220\3702j\261K?\2410\354:A\030\2162\273\027Gj\324{\032\017\230\f}MMO\223\252\364\n\300\003\242\320\240.\031\332\235%\325c\277\332\335\265\006\032\203HVU\"\017\324\022\210Fqpa\223+\302$\002\341\222d\332\005\021`\214\322 \273*\030\226]\215n_\255vl}J|\027\305X\325\027}\344\222\317\301\232Iy\356\3217i\361\230'\270\f"
+	.ascii	"3\241\237(\006\256/\212\020Y$\\\036\323\202w\315\356\302\335"
+	.ascii	"\220\242\006\247\256\200ky!L2"
+	.text
+	.section	.gnu.lto_GPS_calculateDistanceFlownVerticalSpeed.105.1640ab20347ee54a,"e",@progbits
+	.string	"(\265/\375`\257\tU1"
+	.ascii	"\332V\250\022D`\236N\007\335\216\006G\372\211v\342\031\023\364"
+	.ascii	"\377\227\215\303\251/~\306p\230t\237m\0050Hs=c\tw\307\257H7\354"
+	.ascii	"8%)\330\230q,H8\256\217\333\230+\305m\267\345\271\t\331\335\366"
+	.ascii	"\336)\245\024\r\001\005\001\035\001Bw\016\2723\320\235\327\325"
+	.ascii	"Y]\235\177\253s\352\316\350\352|\272\363\257\316\256:\367\003"
+	.ascii	"#9G\302Z\316\235{k\364\361];\264K\333n\335p\335l\375\363\324"
+	.ascii	"QO\231\233\271\253p\277u\034\007\341\262\232ucx\367n\221R\033"
+	.ascii	"u;\312PSG\206w\357\027\204nc\0166\332M\205\203\275\326S\330f"
+	.ascii	"\343\271\276a\267c\250\251\363\302\273\367\"h\224\241\324F\207"
+	.ascii	"M\2246z\266P\352\316\254\240\001\333Q^\034\365\035\271(b\356"
+	.ascii	"e{b&\265Qf\231\343\034q]$\003:=]ox\356\275\304'\322l\377\370"
+	.ascii	"\b\203\300U\375\245\350\371\316r\377\244\326%\030\262\177|\306"
+	.ascii	"Z\330\243\203=\316a\034\017\007\236Mx\\\3544Q\215$K\264\257\035"
+	.ascii	"\276.\251:\372\207\346K\254\313S\245\243\347\260\255\227\320"
+	.ascii	"|\215\005\301\270\374\374I\005\t#\353\377\001\333:\207\367\336"
+	.ascii	"\246\322\356\005\246\345\376\223\272\367\262/\301\302\232\201"
+	.ascii	"\232\231"
+	.string	"\367\230\271\002\363J\025\334c\232\f\006\356#\215r\006\r\032\322F\177\337m\215\242\265Y\324\326\230\355\336\233>\023L\247\3008s}~*\246\303\206\017\350\371\021\356\304\222\336\327\215>\223;)%~Si5\257\223R\177\342\263w\211iy\351/\035<|\370\2206\352ol\261\350\211\235\317\004\221rk\351- B\210\020\2216\332_m\034\236\316J\271\2574\226,\356#<\202\004\312M\"m\024F\033\347\204N\322\373\374\336\213\374g\362\213\024\301\177\222\257I\0257[\276\307\375M\337Y\272\366$\275\217\201\234y\212\312{\331\377V\326r\330i=\222\231M\313\237\311\334\347\3752\346\325\231(t~\022:;u\224n\004\315\326\334$t>\340\316L\356l\300\235\227\202\316CwV\n:\027p\347$wFrg\002\356<\300\235\005\270\363\221;\033\251\316E\2523\221\352<\244:\013\001\235\203\200\316\001\200\316"
+	.string	"\200\316@\252\363\017\320\331\007\350\034\275\f\372\341\326#\031\300\373|\200\3775J2- "
+	.ascii	"?\017\364\255\304k\270\376\371\316r'\226\300YK\363\271uo\222"
+	.ascii	"I\370\314,\020VH\332K\237\037r=\222\203/\374sN\211\007\374\365"
+	.ascii	"\203\337J%\276\345\\\307+\266m\323F\201\017\341\214\351\311#"
+	.ascii	"\203\246#\3314(\277\353w\227\366\213\0360.\fW\360\231t\255~\243"
+	.ascii	"\355\321\243~\177\265_\324\326\234\274\345\372\215m\343H\250"
+	.ascii	"\313\226k\275\247\306sl6fw\352\260S\3239:\310\3539\354\031\013"
+	.ascii	"\326\bk$\305C\322r\216\r\327\214\303\246\265[\023N\313\365\033"
+	.ascii	"\266\035j\336\233\354%3\273\244\335\034\243\230\364\035\233\306"
+	.ascii	"\240\321&\263MX5\357%w\\\373Y\2166|W\307#\031\370Lv\325\351\215"
+	.ascii	"\274\346$\371=\375\201\367\002\352\252\364\300\243I\2769U\314"
+	.ascii	"l\371\336\271Bi5U\r\246\231\306\351\215\316\\}\246\224>S\325"
+	.ascii	"pf\367\336(\356\272\266c\247L\240@!m\364\351\327\376]H\177\337"
+	.ascii	"O,t\231\013\352\275[Q\001XWE\023\247\261h\342\257\212'N\0245"
+	.ascii	"`\245\2402\032YL\371P\265(\236(Q\304*\246(\002y\n\352JE\025\321"
+	.ascii	"\252HLQ,\201\2028e\274\"B\r\261\225\n*#\021\313\312\312H\f\262"
+	.ascii	"%\373\274_\306\353Z\036\273\344kq\3233\341\320\232Q\023c\372"
+	.ascii	"%\rg\231\327\036\221\232I\330\264\242&\022\2467\266tz\006\234"
+	.ascii	"\334H\221%nFd\210\201w\321\322\251-=3?y\331\021\310\214;\317"
+	.ascii	"\205\370\3342\017\211\0039*\231\375`\323\222\314|,\275\213\266"
+	.ascii	"\214\336\317\360\271\265\370\030\210\020\"\320\037\016\275u\355"
+	.ascii	"\301*\373G?\265\023,\243\364\377\354J:\005^\351\203\336\366\372"
+	.ascii	"\222\276\300\237o]{\220~\300'\375Q\035\345\023\002\337\364H:"
+	.ascii	"V\020\370"
+	.string	"\016s'\366k6\317\245\002~\300\377\364(\321\216\336\350\005\3408\372\250\033G(\033l\232S\230\021\372\244\r\243\266\346st\313:\357\r\"\001\257\315\373\270\350i\3642\217\350\207\276\350[I\246E\364k_\361\031C\337d\355\234\236P\350\227yA/\364?\2474\263\300\003\360`\307\322\200\275\250Q(\007\025c\252FD\202$I\ni\f\240\002\221)#n\021p\245S\210\212h\232}\306B\364\207dc)^\265\255!\233\342\3636\277\371\354\277\204J\321\217jr\201\336}+\315:\206t2T4\037\367x\f<\222p\001^f\2152uW\243\216ng\255}X\260F\346@\335\226Zcw5\265\337\rQ\037l\273v\031\265\321Ih\\\033#\252\315\341HXP\002\375R^\224\342\025\334\322\324\b\326l\n\220\205V\312#\247[g\217\226(A\206\300d\273\0343\216\034,)P\032\252\203\0167Sy"
+	.string	"\331!\251\234\020\252\035\203)l*\267L\303\306Z\005\256\261\256\030G'\367\302-\216fvr\260~\272}\267\305\371d\272\215]jf\2649d\005\235\220^\206\205\357,\374\245\270\2330\376\222\035.3T\016Lh\\\f\227,\366\024^\355\220PdV\246\204wh0\277G\fj\020O\027.\252YC\250\212\341\013\375\001\335\364\201\026H\372%\264\344\035N\264v\026\365\024NA\253\321\301\201\0277])g'\260\201m\331\272\356\216\020\005\211\3201I\251$q@\301gCmJ\355\003V\345\021\226\034\335l\373\030\021p\257\231\t\034\366\337S\247\342~\247ZZ\330\247\346\355\222@j\n9\355=(U\003~\345V\026y"
+	.ascii	"\243\234\311\321=\253\363\262}\330\246u\203\033b\376"
+	.text
+	.section	.gnu.lto_GPS_reset_home_position.106.1640ab20347ee54a,"e",@progbits
+	.string	"(\265/\375`\245\003\r\030"
+	.string	"\266\253\226G\300\030Q:\004\301n\313\023\312A\001\305 \2471]~\376\033\217t\200\022,\307\364\276\270p\250\254\272\tzk\370\231\376\301\202\241\366\rX\025\202e\n\216\350\276.\267\213\246\343\016\021k\232)d\340\332\b\331D\312\224\002\200"
+	.string	"t"
+	.string	"\214"
+	.ascii	"\241\255\305s\232\027\251i\307\2146\347\344\361m\016/O\364\032"
+	.ascii	"\317\213|d\003\263\315\240\257\n\227\034\315\301\245oN\2276\037"
+	.ascii	"\360]zG}\227\017\335\262\271\334fc\026P*\212\005\t3\347\024\267"
+	.ascii	"\306[\007?\351\255\266|\320\002\200Q\326sP\306?\257AN\311\227"
+	.ascii	"\001/\204\306P\346\243\262\205z\261P\006\323\r {y6s\316\017]"
+	.ascii	"]\310`\252\240\2059\247u\224\301\270O\267=m/\260W\027\273\023"
+	.ascii	"\230j:\347\354Y\037\370P\373\241\237\226pL0\035\343\377\300\367"
+	.ascii	"E\2555\366\363z\220\033\355\370Af\261\320\217\227>\213\225KM"
+	.ascii	"@3\242\037\227\356l\333K\227\206}o.\220\255j\224\247\256\371"
+	.ascii	"\355\246\361\3243\236:T\365I\325\340\252\277UKU{\252^U\253\252"
+	.ascii	"O@\334\202\243\002Di\310^\261\315\027\2732S\212D\302\361\333"
+	.ascii	"o\337\377\361\233\217s\232\344\023&\334\343\356\351\204\300\274"
+	.ascii	"\256\030\345>\b_\232\302\341JQ\222>+=jrm?8\224\020\004(\370N"
+	.ascii	"\376\244\203\207\017\037\216\214:\227A\274I\b\005X,\342LF$\300"
+	.ascii	"r\271D\356g\340\250\"\246\202\3208\373\274\357|\336\252\017\\"
+	.ascii	"\024\022G\3329\3159%\370I\256\004'GGgE\246\232Kw\277m\316)\227"
+	.ascii	"\306\220\353\315\255\351\006.\213\352z\251oWm\0237\222:\315\t"
+	.ascii	"\223\340\023y\221\023~\320\245Q\250T\337e\254\0228+\3179\021"
+	.ascii	"X*L\210\252\224\230\"\205\203B\314Y\261\304\b\002\254R\241\263"
+	.ascii	"\022W\250T+1\264\271\356\315\005\262\00629\304\344\\\3732\002"
+	.ascii	"}p\373\002\006\375h\006E<\300\323j\371\250\273\220\203{\332\307"
+	.ascii	"b0\201\013`4\321fD?5\353[\371\025\037e0\022#\371.\325\313\250"
+	.ascii	"3\2404\353\3374l\320\2175\273?\206\224\244\300\266\307>z\227"
+	.ascii	"\\\2149]a\2673\202\315\351\272\231Y\232}\222\217\216\227\356"
+	.ascii	"\034\356\314\006L\250A@\004\tBJ!\212&\2300\n\243\306\300\002"
+	.ascii	"\031!#7\021\260%\204\2064j\266\003#h\212H@\233\261\340:1yss\375"
+	.ascii	"\226 \312\274\003\322\254\276\313\342\200\027\331\347\034\310"
+	.ascii	"\211\213\3141\362yvf\324\311t\314w\357\324\016\313\316h\024\376"
+	.ascii	"]\266\241\240\b\307\270\214n\223g\263\354s\263|j\217\203\n\342"
+	.ascii	"\344\262\306\246f\016Jnd\340\233\250\356)\253$z\252#\377\263"
+	.ascii	"!z!=\177\33416\201{g\b\020H\311=k\245\215\372\316\027\320S\007"
+	.ascii	"\243~\335\335\3567\002Y\242\327\255\262\321K\r"
+	.text
+	.section	.gnu.lto_GPS_distance_cm_bearing.107.1640ab20347ee54a,"e",@progbits
+	.string	"(\265/\375`\345\003\315\031"
+	.string	"60\246F\300\226Qc5\006bc\244\360\r$4\307\357\305\356\3204\342u\212\270\032\225\357\344\255\027u\366\256\217\366r\321\261*i\305y&\254\257 H&\256e"
+	.string	"A\321?R\220\260\277\215~]\035\"\036~#{\313$S\n\225"
+	.string	"\200"
+	.string	"\221"
+	.string	"MNE;\265\341\0338'\365\347\0314c\020\247\246'%sN\003\006\213Ae\220F\032\211\207\205\205H\203\203oD\205\031L\022b\360\304\264L\037\031*\026\364\242\300\034[\273\360\013\234\217x\3542'\321/\307\234\275\003\255Q\031l\317"
+	.string	"B\203*\273B\203\305\265H\334K1c\232\216x\3609\231s\302\216\3028\313G\\\355\237Sx@=\226\"|Y@\210\t\247\026\220\217\234\031\372!\302?\307\037 ]\214\251\006s\316F\036P\220\013\272\355\203\266\032ZI 6\325\212\232'4\350\257|PD~\204r1\252\355\365\304\237h-\347\211Z#\3314\246a\017p\222\373r\317\026\340\031\366\214\225\\\031\037\3311\216a\007x,\314c]2\366E\306\272\310\330\026\031\313\002\306\266d\354\212\214U\221\261,\031\273\222\261)2V%cS\217\r\037\013>V>\366\217\215\217uM"
+	.string	"(\247 C5\315\031\"\n\312\f\002\352`\341$[\3118\374+K\251?9\221\\\024\272\370:\313\333\034\235h^\313i:\274\2472gy\313\027Uc\327z\355\303\201,\026\341\300[\262\362\026\220\237A\034\335\230\263\321g\316\\\215\312W\0362\331\031\255\"\353\355\016-4O\3454>\357\351\352)g\335O\273\241\327__\035\034\"s\231\2474Q=\365\227\021\017\367\350\257^Q\rU\212\346U\351\f\214\214\b\237z\334\001^><\b\001<\370\364#\224\213 \337\362A%\371\021\372en\246\235\222x\377\227L\273\"\335\204x\371\344%\n\001\267\230\r\216\234\321lp\244\316LV\213\345\\H\335l2\034\251`FSp\213\331\314h\262[l&\273\331rpX\022\314h\tn1\233\333,\247V\333p\303\352\r\002[\006\035\030M\006\233\311b;\260\233\232\r\206"
+	.string	"\246\264\f95\330\215F\253\301X\275i9O\224\002\243I\220\334u\022F%\222(\341\356\b]\207\371\312\027\325c7\244\363\022\023!%\376\023\265\205\256?\027ED\306\017\237\370\244\256\327K\270#[,\362r\327\315d\007$\367!\307|\271\374\345\367\355\206t-v)fZ\356\362p\310\316(N\250AT\206\f2HY0q\202\202\304\2301\260\002\021\262\032\017\020H\007K\223\341G\210\354[\032m&d[\321Q\021\354\231\221\365\250\004\236=\360\222\240)\032\030\240A;\f.!\034X](\3258\276d\205l2\344ey`\304,\310\031\336\204\030\263\353\f\006\217'\b\304\f$\365.\003\344\346N\346]\320\376E\341\376\342\006\311\017\310\001"
+	.ascii	"/\b$\332}>a\220\325\035/\017\367K0\r\250\370\235\260\255&\220"
+	.ascii	"g\266gT\3465|\0033\217\241\t;\021pN\242>M\345\024[\325"
+	.text
+	.section	.gnu.lto_GPS_calculateDistanceAndDirectionToHome.108.1640ab20347ee54a,"e",@progbits
+	.string	"(\265/\375`\273"
+	.string	"M\013"
+	.string	"6TK@ kL:\270\376\254\002\b\"c A'\341\303C\207\3702;\231\277O\b\366\211\323I\332X\202\266\327\035\244q\315G\270h#\202\204\025\300\026@\247\231z\313=\340\370\264\203P${\223-S\n7"
+	.string	"7"
+	.string	":"
+	.string	"\265v\362\300;\237\233\334\216\177\326!\241\350\371t\020I\337\036\244\313\255B\026\341\302\203\b\332\"D\b\302\263\276\005\304\317.wQk\365\206\342\350\246\267\215a\233\302\276E\237>\207~^f\250\306\f%pG\273\345Yy\262\277Ui\262\277\346\276\376c\302@j\364\021C\255\242QC\205M\t*\333\217\270c[x\013U%(l\b9\240\325\337G?\003\254^\253\031\270\343N  J\260qko:\366\241\245\364\034U\223A\220\226PN\236\365G\314U\001\2645\377\022z\311Io\250\364\371\2023"
+	.string	"\340\247,\200\263\017\003\246L6\031K\367y\335\206\247\201\351(\232M7\201\360\227\251h:\216\357\323t\221V\375V\245\311\220\230\002\030(?S\236*\324\177\375A\305\342y\364s\300\352E\233\201\027\352\273\336\340\202\t\027"
+	.string	"3\241\211(\306\343\203Y\332\216<4\007\013\037u\310\016\302!`9d\002\255"
+	.ascii	"J>\\]a\227=\230cQ\366\271\206\013\016\341_\306\035\227.f;-B\323"
+	.ascii	"\030\024\024"
+	.text
+	.section	.gnu.lto_onGpsNewData.109.1640ab20347ee54a,"e",@progbits
+	.string	"(\265/\375`\316\003\245\031"
+	.string	"\006\357\241G\300XM:p|\350\177b\210\322\344G\003$\350X\230\240\240\237\350+\0364\016\260\354\362\2235\002\035\264\243\211\036{xZ\250\036\206g\222 \232\246B\260yQ\034w\t+X\236\251\347\352E\020\335\2324\262\267\224)\005\216"
+	.string	"}"
+	.string	"\223"
+	.string	"\n.}"
+	.string	"\274,\360\327w\031\217\363]\372D\2563\361!n\345v\256K\333\204\355\272T\227\205\354\251+\345\230\002\300\310(:Rf\316\t[\034\027:\013\\}2\256\n\371Cg=<:x(\026G7]\265l1\376\305\270\214\t\250\234\310\324\330h\361e\304\243v\3355\205\355\204\306H"
+	.string	"\251\206\231\032\033Q,P\205W\364\215\th<\275\250\261\315\342\013\313\r/O\272\201\037,\216TW\r\346\234\326\232\255\305\335\272\355\031\266\021\330\321\001z\306\372\235\357{\263\326\242\333\354G\216$\346\357p\b\231\276v\351\313\276\313\357\223\216@\214\221*\032Dn\241\366l\245\231.\316~\234\213d\257Zg\3259\253~I5\316\252o\276t\333\254\332\025\325-\251fI5\030\325\253\250\376\242Z\256:\256\372\003\036\005\303h\205\213\243\3202\247Q\017\315\344I(=\276tU\265o\177\210\317t\245\027\021\372\222\233>[L\215B\002\023\204j\316\0316{\246K(\271'3\267\326N\321]-L\353\nk\375(\227\342&\fvb'\273Z\230\260\3513\0242x\323\fz\275)\2429\303\003\340\262V\246\241\375\230i\317\253\005\367_hT\337\312]\355i>\236\334)C\211\236\236\357\362[\002:"
+	.string	"\250\355\263A_\223\253RP;\336l\207|\034\214\\\030\343c_\\\016L;\"=c\273\303\233\304\3009\347\002\177\311\231\374\370;.\355\001\bhy\244t\241\366\256Nc\260\330\330\305y\347\273\001\241\230\244\210\002\032z\324><2\020\035`\261\037\330\207\037\r@0\237 \031\214'\200c 6\004\301D\304bA0\227R\370Er\203pg,;"
+	.ascii	"_\373$\336]\373\352\022{ s\305\247\234\225 \253\305A\370|-\337"
+	.ascii	"\002!\202\004\t\337%\211\\\2222U\341\204\317\217z\226\t\024*"
+	.ascii	"\370\025\276\313\021\271$\271\252P{\236\222\002D\310\367R_g\341"
+	.ascii	"\202\276\346\335!/(2\225\310\305)\271\316^\307\345\337\371rV"
+	.ascii	"\347J\316^\367H\245G\017gwO\372UH\335\324fqvgG\253\242\022N\250"
+	.ascii	"a(\250\034B\212\221\210\004QZ\022\347\200\002\021\2613\036\020"
+	.ascii	"XG&-\2445\362P=\234\237\260\237Z\214 \232\\\373\021\255\024\355"
+	.ascii	"\242\226z\\\362\"mp;k\035\346_;~o\350\305\003W>G\030\313\272"
+	.ascii	"a\3712Az\325Tl\026\205\022\266B\301\252\202\2510\252\343\033"
+	.ascii	"M\024fA\027\b\343@&\354H\272\\\201x\277\347C\247/q?\032\202\032"
+	.ascii	"9\264\277\"'v\337\203\355\264\251\016*\3249O-\263\277\"\243\372"
+	.ascii	"\311\320)\363y=v\n]t\313\034gF\311G\266\276\013V\275\211\275"
+	.ascii	"1\323z\207=E\276\247\006"
+	.text
+	.section	.gnu.lto_lastCoord.3.146.1640ab20347ee54a,"e",@progbits
+	.string	"(\265/\375 \027\271"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\202\210\200\020\1773,4,"
+	.text
+	.section	.gnu.lto_gpsInitUblox.part.0.172.1640ab20347ee54a,"e",@progbits
+	.string	"(\265/\375`|0\005\216"
+	.string	"\232\312\300-O0\316\322\351\017X\266\263&kQg\320\333\016\377I6xo\317\037{\3313-\217\303\2721\352q\026\253\\\312\264\375\376qC\324\231*\220t\246\022\n"
+	.string	"T\346\0314P"
+	.string	"\260\216\324\331\350\205\303\313H\246!\025\037>\222Q\326\233\310\275\223L)\300\002\237\002\307\002\270\177ppoXqk\300\301\355\263\342\3160\304\215a\210\273g\210\373\202\rn\236\034\334;8\270uV\33496\270q\206\270onp\333\fq\017mp\257\276\346-\\q\347!nu\210;\035\342~\027\363\306+n\367,\234\024\300\210\353:E\003\335$j\027).\346\276\346\356\346.\347\370'\314\n\352x\227\243G\210\241\304\203)E\323S\353\202\272KaEm\347dp\364\b\317\203I\207\022"
+	.ascii	"\306\264\354\b\002u\335\260#W;l\305\351\366\237@$T\222\214\256"
+	.ascii	"=H\262\355\0253'\347\356\016\327\206\205,-N\241\0317\"i\2408"
+	.ascii	"\034L\017\333\004\241_\336\334rx\333\215\026*\206\271\305\243"
+	.ascii	"\353\036\233\316\326z\333\215\325\305\222@\n\027\247\353\036"
+	.ascii	"\003X]M\217\356\223\3051\3444\037k\357\262\246f\202\232\ti@\342"
+	.ascii	"\210V\367b\016\031|\317\276\215L\255Z\232\251D\226P\034>\326"
+	.ascii	"\302\266f;\231\227u\3374\n>\326\017$\237/\n9\355^9\332\263\364"
+	.ascii	"\215X\016\017#\266\320R\230\373t\374r\260\326\303\210k\361\270"
+	.ascii	".\231]N\327\r+r\265E\254\256\n\271Ov5u\f\331\325\033W\035Kw\347"
+	.ascii	"8v\333\335\347aV\2563\2574\225A]\327=r\365\253\274\365\026,\220"
+	.ascii	"V\034\031\251HQ\204\342\204\t\242\022$F\210\b1$\004\"\350\003"
+	.ascii	"\220\207\016\034~6h\360\311\200\241\347\002\317\216N\016\316"
+	.ascii	"\215\315p\025f5}\354\242m\307\306\247\242\267(c\241\247u,\203"
+	.ascii	"\221Z\270\255H\247l\311\232\202\312\363#97\222\023\203U\204\361"
+	.ascii	"\024a\346\342p\021\234\243\200\233\003\203O\340\275\345\275\211"
+	.ascii	"<\255\243\033&\222\222Ub\310BV\023\277)\2504'qdD\224\b\247\020"
+	.ascii	"?\206\220zd\t\tc\250QQ\246\2038\333\242\305\f,\3334\2354}\352"
+	.ascii	"\210\226\203\276\374\303\327\233\027\006\352r\017u\307\2567,"
+	.ascii	"\270\003\027\237:^\311>N\232Ozh\352\230\366\034\322\270\360\317"
+	.ascii	"\206\3275\370d\020\306\200\212\342\030\240<\301=u\307+\255\243"
+	.ascii	"\023|A\212\326\261\t\346\361\272\343k\205w\206\246\240\220\270"
+	.ascii	"\016\022)\234c\346\376\204\223\242p\256\245\361\272\343\221\324"
+	.ascii	"\307)\212Q\353h\004\337\234\271?\3310=\304\026g\027\340\320\263"
+	.ascii	"\370\320zs\245'Dvi\3029\025\252;&S!\327uo\236v`U\030\343\312"
+	.ascii	"\315o\nJ\317\323\024\205T\\\020\235'\246\324\207\216j\317\263"
+	.ascii	"8\366\361\264\204\277H\224\315\223R\346q]\327\247\216z)\356q"
+	.ascii	"\027\302\030\256\353\266\353\330\363~\341\335\177\327\335\022"
+	.ascii	"t\253h\021g\035p\025\031xM\r\273\356gM\003sa\236!\341\237\347"
+	.ascii	"\260\205\303\3538\200\315\226?\357\"\257\213\206\337\360^\326"
+	.ascii	"z9\033\004\230\254\005+`L\303;[\206\367\021KZ\3032<R\033\031"
+	.ascii	"\327\327\032\367,\276\332\3119\001\2356\257l\235Z \330\253u\352"
+	.ascii	"Z\302\006}bxg\366\f|\205\013\2431\236q&\206\007\202z\233Srbv"
+	.ascii	"f\313\300[D*B\262&\364\031\350\316l\032X+I'\213\351$\2504\225"
+	.ascii	"\356\266\234\031\366\274\024\"\220U\0247\236q'\346\013\337\363"
+	.ascii	"\251\340\016)%\034}Btr\341\205;\002\001a\340\235\347Q\241\025"
+	.ascii	"R\305\363\031\362\220D\260\262M:\032\006xI\013\346\002\217j\347"
+	.ascii	"\035\255\311W\316\353\274\027\301J\222\326$9\2773\344\017\360"
+	.ascii	"k\375+{H\370\346q\220\264J\260\033[\210\351\b\316k\310C\352\300"
+	.ascii	"Q\021p\221\226jm\234\304Q\2552m\253\332&\271Iv\365\346w\206\240"
+	.ascii	"\341\352\"\264y\341\273\326X\031\024xx\325J\301n\264!\302\353"
+	.string	"w\267S\332-\354\306\341\013-}\261\033\007\301B>h\207\322\255\225\226\013\267\\\257\262=\361C\021\201\254\236\206L\314p!\363\013\377\355\232\006u\340(\026\354\324zy\023\200\356.\001\247\320\202\021`\345\272K\001\270\332\370\007\006r@\232\200\002Y\201\354j~\357\342\351\026\223\276\374\312N\235\230\325n\031\270\007\017\365\205;\370\270\336\373\213\327k\245\276\362\254\212\0213\367\247\372\275(\313\322-]:1\247\357Sca\226\260\232\376\307\237>\346\333\201\245\204\243\335=\0033\021\361\322\277\220\314\035`\007\334\315@\003\330\215\370}\340\216\314)}\261\375\317=D\315\025\261`\277\373\277\262\261\333\270\330}\3022\2674j\fl\027\3745I\032\033] Q,7\211{\002\332\016\330}\253\353\026]\312\375C\376sq\006w\307\025\323\351\272\356\t4\355R\335\376\\\303\334\0237I\230\360`w\323\3603I\253\353\272"
+	.ascii	"\264;\335/\202v(\256\366\004\024`7R\220]\365\207R\005K\312\353"
+	.ascii	"K\007\216\342W\366\273\360\217F\243\321\376%\335C\334/vp\273"
+	.ascii	"Xq\267\350\301\315\342\002n\244\035\334+V\334G=\270\215.\340"
+	.ascii	"V\261\203;\305\020w\321\0207\n\033\334'pp\233Xq\023\331\340."
+	.ascii	"\201\203\233\304\212{\204\rn\0218\270C\254\270\207xp\013\rq\203"
+	.ascii	"\330\301\035\264\203\373\303\0207"
+	.string	"\220\016n\017C\334\035lps\030\006V\256\353\272\261\233\305\302z=^\035\330\034\323\027I\034\235\270\274vVF\210\370\341\003\r\n\315\022\261.\361hZ\276\317\"!z\324\334\245T\251\f\352\364\324\254N\310\320+]3'\202\245.\221\200(\353\005\306Q6\202${\237{>B.*\364\312*`/H$ \220\365\002\003\351n\020\317A@=\r\212\032\b\300~5)\024\211\246?\315?\201\370\365\237\351\276U\314i|\276\376>Vl/\232\327_\306Y\261\214\027H\246\333n(\206\216%YE\234\302\261\257KzA\307z9\272\023|\237e/'f\031\b\r\022zR\206\003\0238\370gL\373\230\234\037\274\362\321\362\333Z/\266\243\277Y\246\001\374Z\363nV\313\177\361R\225\006\350\225jI0\322X//T\250\031\\\032\317\344\255\037f<\250\3162\263\321\343\251\2612g\217\3062\377\314\350o\226f"
+	.string	"\277p\332\233%\275X\373%\353\345\210m\372\033\333F\304\314\352,\334\333\223\261p\320g\230\027\313i\343{\237r\377\005\355:\272\307\262\323\264\367>\267<i\314\277IFx\335\254\235\277\261wDV\256\372\233\0375\335A\237X\016\002\031\347C\256\003\225\337\372*\335\367\323t\303\357\254\336O\361$n\226\223\317\352Wv\337\212\345:\241a}\224\356\356\253"
+	.ascii	"\031\367\272n\361\257R<\330OX\275w\242\342\207Mv\200\034p\212"
+	.ascii	"\257j\235V&)^\330d\307\365\363JV/w\263yO\305\352\005\375\324"
+	.ascii	"\235\334\373|$\255S\320Ki\2551c\204\030dU\344f)\346}n(\372$1"
+	.ascii	"\350\221\030\212\243\370\242W\303\374\220\027\202\342\205\313"
+	.ascii	"0\\\032L\374\t\250\023Do\342\237yt\"\372\234\2778\256\273\274"
+	.ascii	"/>$\276\304\217\022#\236\204\221\307\367`\371\314\260~~\331\325"
+	.ascii	"\021\277c\205-\303\0028\304\213\370n\026\r\373\367L\"~\210\034"
+	.ascii	"\372\020\377|M\2031^\251\365\372\342\353`"
+	.string	"\001\3315\254`f\005\263\253C\277\363\327\004\354\222\372\2510\210\241\230\205\336\317\260Q<\330\026\005\205\376\246\2519\254\253Z\323\363\312.\n\300\253\312u\266<\245]xe\273\226\0233\210w-@\"\024\304\013\227_>\004\241\222\342\tB\323:\255\317\240\027\246\275\355\274\322/\310~\255\023\2203\n\360\316\250\363\241\257uZ\371>\274]{R^M:\252\275\0343\2752@\357f=\003\343\335\231\001\231\265\f\314\302\030\325\254i\340993\034\246\354!o\t\253Q\302q-\323\212\301`\270\266\251{\264>|dW=xu\275R^Q\357\0307_\356gnm\035\336\317z\006n~\t\335\001\t56\330\300\004\f,8\241\204\341\t54\baF\215\022.x@\003\023.@"
+	.string	"G\215\020xp\330\b\341;\003\243\033\"ppd\303\203\243\020<\270"
+	.string	"\204\243\fH\270qd\224\241m\210P\203\204\243\022l\330 \341\350&uu\274R\3733mQ\366f+/\336\313zF\336\312T\312^\310\310Y\031\213\316\275\254i\344(\371\252\f\210IX\025\213)w!&?\311N\\$\315p\245U|Hi\256\312L\214D\363\222L\225\274{\263\222\234$I\006\232^\335\021Y!\327Y\350|\356\356)-\222\243\210\311\214\314D\344\336#YH\220\254B\206\022\003\325\361\244\234\235R"
+	.ascii	"\362C\314\253$\033{d\036\271)\031\006,3\345b^\312JYGN\2069*\016"
+	.ascii	"\022})\030\270&*j4,2\261\230\200\022\377\322\240ak\341\214\352"
+	.ascii	"\247:\223lj\037\337\236^3\017\357\216L\323\223\362\0309\265\216"
+	.ascii	"nN\375\002}\376\250qD80oiml\315/\311\264\267\313\232Z\032\023"
+	.ascii	"\355lK\222\313\253B\231\221\251\313"
+	.string	"\025\312\322$\023\372\314B\024\013\003C\203zua\271\222D{\335^+U\266\246hea%\227\357Z\024#\365\n\312\223\344\nP\025M\210\276\264\252b\202lK\341\346-\222\352\222\326\213\252\305\373\233$\003\374\032TBL\202D\212Jr\314\021\325H\0215JMF\241]\\%2D\025\242\006\211\276\251\372tT\235\324\024\006\241Z\250\324\037I^\246\362P}\250F\265\007\036,z\345\030Ww\020}\2512\261J_A]b\233\300P\225\330\2559\016\306\234\322\234(\230\316\342L-\262L\325e\361\376\"\003\271\276\\Ab\340\0325\177\320\2774h\376\336g\013g\374\234y\336\307\267\247\227\346}&e<\025\351\035\031;4\320\242\023\213\244uD\27299*\310'\364H\032&\016\016L\027\362\371\362 I\333\330\232_\240\253\222tM-\215K\276\2024\363R\245hI^\206\347\272n\212\364\214U:Y"
+	.ascii	"U\351\026\266\311\013<-U\220}\037\367$]\256\220\221H\276T\354"
+	.ascii	"*%\033\313G$\337+$%\r\003\033D\356\215\311J\275\246\244]\354"
+	.ascii	"\326\034\333\226\006\2717@\312\305\302\335\275\005\244U\300 "
+	.ascii	"\311@\301\344R*d\336.\272T\313\211\264\203>\271<\305\232c\357"
+	.ascii	"\210\346\\u\"\355\336\324\211c0x"
+	.string	"\"\215\302\201\f\362j\312Y\372$u\002\226Z%\367\240i\025R\252d\365\226 \275\037\221r\\&~E\252\244uZ\223\254x'R\f\340_\021\2752=\322:\031\331@e\\\342i\024\2537\"MRA\262A\237)\021\342\210t\210\032\222\355}\376\224\036\274\272f\211\033\251\353N\031\340\314\202\243\255\001\326\361nf\007\343o,\227/\003\203\232\250\262`I\221R\206FD$IJ\222\345\"\f\020\004\343X)%\274\r\022 \002a\216\3460\016c\022*\"\"\"\"2\022%\225\366\016\300%)=>\350\334t\310\351Q\233\034\337\207\"\222\276\034P\346\206\036\343\321\321\027\\Y\"\331\201\247W\266\033\3103\221\334\320\226\330\364\321R\307v\220\360\223\027\240?\353d\013\255\004\021\223\210'M\"\300!\324\376\2618<7u\306b2\022\2344\017\345J\222\242\257\356\274\240\250\321i\370\250\023\230u\362\377\300G"
+	.string	"\004\376`\020>\364\351E\257\242\250\323\3723\305A<Q\bj\034\200\3016M\250\301\016&s@k\013\274\026\320\343\022l\f\374\027\210r\\\217\023!\306\332 \364\0268\f<+D\203nn\r\034\375h\200hj\342\267\271\242\351\322"
+	.string	"\342\211\377E\264y\351\245a\233xA\213F\364\242\240\006\331"
+	.string	"\021>l~A\332\362\314\313\337V\330rF\223\267"
+	.ascii	"\007A7|G\221&_\016\322t\227S\372\261\370\215P\271\325\036\210"
+	.ascii	">\365B\201h(\236\037\313\025\204\342:\331C\013\227\201\002\221"
+	.ascii	"\321\013\221\036\221=\020\215\241)G+\306\265I1\320k8Gjz\347C"
+	.ascii	"\307~\330@\205t"
+	.string	"p\266\2046\020\341\364\364CZ\003\212\\\f\366\020\331\274\356E\t\302\240\002\255\314[O\f\357\3253\3238\313\007\365\271]\220{\200`\310'd\324k\023\243c{\3465-k/\363\201O\252Z\205\252d\316\357\205<\375Q\313\376vn\240\301\251y\337\265[\003J]\020\312\255\254z\302\323\002\350?\360#\353\266\036\004\330\276\001x\236\201\312.D\331\273\304\271\3256\375\332\013\264\243oo\007\"}\311@~\330@\351\341\230=-\005\t2=\303\004q\\\362\261k\273\004r\310\232\330W\210\037\250cp\333s\361\235\251\373\334a\034\221B-\374\032#_8\035\351\002\3500\323q\312\034\025\201\t\023\270\236\"\214\345Z83\305\036\236\330\\\222\005SX\243\351\016\370W\250\330\212\201\262\262\325V\367\024\356|\324\204QNB\336\355\321b\236]0-\2650\335%F\335k\033\201\026\322\201\033\036\257\233\325\0312\227"
+	.ascii	"\247@\364\233\217\261\006RKb\370\362XJ\017\233\362\t"
+	.string	"\030*\322\372\301\007\316\351\224\273J^\245\036\323\220\200\231\322r\340\202Fe\214\342\264H\335\330\206v\003\270\264F\034\016\\\342^\231r\034\264K==\312\344\217\332\260\346\\pe\023\340@\376\247g\263\025&%\003\325I-\234\016'\350\376^\347\002{9\314\220q}\022\n\330\253\235\250T4\025\340\307?\006R[:?\2202\036\261\002\214\\y\377#\306<\242\205r\270\262\304V ^\201\037\343\314\363\341\0261INS\301\370\321*\273\343z\235\326\342\355s\211\240\225N\235\236Jo\020\230\254\322\311u\206\257\201\243r\373=\225Kv|\264\301N]Ll\357\253\370j:NJ\001\033\211\327\256\022\365tn$\021j\t\353jd7\262\304\302\241\227\215\025\324:\247\354\370\001\370\257[\244\323|;\032z\203\231l+1\213G\375\207H0\200%\337\251\342\204VJ\270F\262Xi\364\314\026\272\376:\032\002$"
+	.string	"\267\016+\262\374\355TGDN\277\253cB\004\201\261\335\203=\030\264V:\340\201\341\324.<\354\330\005\3373\344\222\036\276\320\270\263{q\2746\275U>b\256}\360\372\354\253\204TU\266\262\225\211\035J9\304\212\035L~\233/\261\033e\216\210+9H\376P\200'r\245wF\007t\270Z\001\333\333R\272\364\263h\250\037ttV\373\265\274F\237\365\313Fk"
+	.ascii	"*+no\215\t:' \220\226\027;\225\226Z:\342\005j6\314\021\332R\215"
+	.ascii	"\343\030\001\345\304\177Q\205\"\201[ 9\007H\006\031\232W\177"
+	.ascii	"\001J\002\r\2009\231\024\31767W5b\346\236Ph\265\2464\300\212"
+	.ascii	"PM\321\371\343J~\213"
+	.string	"\f|\276|\320}\263y\017A\356\341\006A\b\300\006%+\303K\317\204S\034\313z\327\200\302\3065\025\316+y\020ED\223\304\254y\027\244:\350Z\220b\350\202\247\275\243>,\002:.\3113#`\260H\351\226#\361\367s\254%\215\252v=\254\340W\322\256\201{\207\3135 S\337\021\203\322E\306;\220C*\026\2777z7\t\332\025\224\342\351\013Gy\t\030\346@}x\253\344w \031\316)%\005\341c\004\322r7\370\236u\374\027-\3217"
+	.string	"Q\2102B\f\370{\260\243\016\313\025Y\364\333\242\030\303\210(\267\006\036nFE\274\006\245U\375\354]\272I\361\376\256\276\327m\"\217\327\266N@\376o s\366\3159\242\214+\021\341\244\033\334\013R9\317\336\216\376=\226\220\275-(\311Pc=.\252+\177\273\251^c\370\372\275\260\240@\310\231\341p\037_@\365\330\363gFP\033\221\312\201\222\237g\317So\311Z3\244d}\220W\354\304\b\0026\034\226<\275\3455T\342"
+	.string	"\220,\312\206\325\267\3516\212\312\322\313\177\376\006W\034U\335#7\364\240\345{T\3176\243\266\2520uo\031"
+	.ascii	"\033\364\316R\027\212\235\206lC\020\b4j\020 \034w\325J\025i\377"
+	.ascii	"\022\003\303\210\221$\253\332c\377O\267_\307\n\264\0232\367\203"
+	.ascii	"\276t\210\2409\352\254\253bi\337;a\314\251\004\210)]@\317\310"
+	.ascii	"\333\372\275,\226V`\231\332B\327\020\363\232\302N\371wZ\356-"
+	.ascii	"r\350A\3056\2062d\036n;\355\246\027\311-\250\202\305\212!\212"
+	.ascii	"1\341\276\226q\350MX\265\252N\256\300S\013\256n1v\220q\357b\253"
+	.ascii	"=*\372\325\004\270@|\217\206\337\034h\272:\005\337\036\016\215"
+	.ascii	"\366\205|\234\376\331\240\315iz\311\336\301\026\360(5\277[\313"
+	.ascii	"gK<Q\253\2626\357/_uP\246\267\200=\340z1\346\013\tH\021Sl\006"
+	.ascii	"\221\202\265\244\214\322\277\005\2044*g\007\214\367\205\355\277"
+	.ascii	"J\031\267B\211\216D\233I\f\215\022,a\2520\244\231\026"
+	.text
+	.section	.gnu.lto_GPS_calculateDistanceAndDirectionToHome.part.0.179.1640ab20347ee54a,"e",@progbits
+	.string	"(\265/\375`\211\002e\022"
+	.string	"v\340qG\300\324M:\270\263(\030\335\202f&\205\320\3710\227\330\360\300\323\301\270v\373*\374S\004\031\356`\f\t\350\365!I\310\247\327\341\375Y?\234\006\221A\250\222m\317N\331\0259P\372\3771E\370\204Q\213do)S\nX"
+	.string	"Z"
+	.string	"e"
+	.ascii	"wA\373\221\367\375\260\327\001\252\322\241\332\3351yt\202\325"
+	.ascii	"c\311\013p\217\360\003\270\027\335/\252\261Y\254\307\253\260"
+	.ascii	"]\263c\232\035\344FB{`\207\221\034\333\220\335\355\036\265\304"
+	.ascii	"i\327\2044\377\343\261\271\276\350\371\361\200x\n8$\211\260\273"
+	.ascii	"^\205\270\343m\243\3306\261\025A\377\036}\030.&\226\377|\245"
+	.ascii	"\247\317\210\037\250\365Q\233\324 +<\\\005\262I\322\034\227\216"
+	.ascii	"\\\032\306\264\302t\302\364\003$\221\202\025\273\036nE\226Dt"
+	.ascii	"2\361\244\277\366\264\357\2678\013\037\351Jf%\331fM\266\231P"
+	.ascii	"U\007\252\335\246\005\253\307Z\315\217<\227l0Z\236\035\243\252"
+	.ascii	"\252R9G\354\3433\356\232z\016)p\362f\275\b\"\033\221\236\233"
+	.ascii	"\274\331@~\351H,J\026V_:\024\203\347"
+	.string	"\360\256\003\307\r\237\334\206w\246\006O\257q\001\303J\376[\341hd\270\223\367`j\306\313\301T\323\227\316\304\002`j\367\346\237\335r\031^\313\256\307x\235\b\355.\312\213\303x\361\207\036\r\203\311430\027(\203\271\250]\255\031\231\227.\006\3534\300Zb:\227l\246k\021pL\346%\353hb1Y\307\262\235\367\257\023u\202\307\215\342XU\203l{\265\031\334\375\201@u\2247s\352K\375\207\204\t))Q9U ~\342\240\306\332a\022\212\036U\277\307\243(\370C\256\240\242\302=\376\023\222\001= \260\002!\253\332\0060\202/\343\026\313\340\321\035\326\270\342YP\262\337\342\231u\303\207\002Q\316A\270\203\203\2121\315i\234([\320\326\006\257r8\272\231\251\231\223\225\020\271sk\355\302\222\377\243\331\003\277\354\206\357\354\306\372\245\215\374l\260\027\255e\2777(\2746A\221fZAF\013\026\331"
+	.string	"\340\0364\002\264\333j\016\346\202\023\310c\003O\216\027\365P\254\262\375\326\257"
+	.ascii	",\2369:~\347\265t\f"
+	.text
+	.section	.gnu.lto_onGpsNewData.part.0.181.1640ab20347ee54a,"e",@progbits
+	.string	"(\265/\375`\337"
+	.string	"=\013"
+	.string	"\206\323F; \261\322\001\244\003\376@\343\221\213\013\223\255u?\320\333"
+	.string	"2\371\305\030b\345\342\3101\377\370H\316\370\341)\224\304\377\035\b\b\b\005\242\nRW\r\202\322\310\200)\255m\223\275S\n2"
+	.string	"6"
+	.string	"7"
+	.string	" \370\372\025\333$\314\245\235\363Z\311\"\364B.l:\273+\276R\222\227\247\363+\375\326i\210\303\343\223\340\037"
+	.string	"iw\r\372\270\353m3\330^\260_\021\326\205\257\201\315p\231\354\024@\237\371\266\226\273\224\177\261\356\333\261\363&\326S\341\355\256\350\325\t\240\327\360\007\237\327\357\005\237W\237\3455\326i\016\245\330\260\246?#\355\274\027mM*3\375\376-\215\331\364\353\311\b\210\354n\364\360\354H\245Ay\356\307}\332\367aN\363s\2171h#\303\200\335\032\234\035\216\374\315:\207\257\332\236\300n\001\r\245i*M\237F\253\324\2038\242\304\b\224\tB<\251V\342\310\300c\312A%J\214\243J\004m\317\323\230I\026\324E\251\314v\235\242\333\023\024\363\030\376\354\327\230\001\331\355\004\037"
+	.string	"8g\340\256^)\342"
+	.ascii	"Q0\314\025NL+\364\317\020\270k\206\2654\006\232\020\327\347\262"
+	.ascii	"\301\026x\352\370\250\022\273L\303h\301`\220\"4v\t\021;\357\316"
+	.ascii	"l\274(\031:C\331\314\333i\001\270\366\200\033-\242\337U\306"
+	.text
+	.section	.gnu.lto_gpsNewData.part.0.182.1640ab20347ee54a,"e",@progbits
+	.string	"(\265/\375`c\001\245\r"
+	.string	"\326\331YC\020\261$\035\210\260\314#\003P\205*\267\022{8\366\207\220\203\244\200a\327\320C#Q="
+	.string	"\b\236 \202\354\267\323\224E\220\251\260*\304m\b\005"
+	.string	"\200\314\360\020Y\001\235K\036\207:^\277\026\211\334R\246\024D"
+	.string	"F"
+	.string	"I"
+	.string	"\017\256^\340\271\n\370\001\352\212/@]?\327\257\260M\262O\357\\6\2043\373\224\340\303j\021`b\244\320\350\330\335\352\232(\236=\361e\276\366\004 b\304\221\300\237G\310\356\332C\342\326\333\206`\233\201\215\030\317\317\\UJ8tbPp\007\263\305\371\3766YlE?E\347C\343C?"
+	.string	"\226&\250\354\202\330\331\261+z\223\3422\267\317\202\344\317\370#Czw\362q\302\301\325\211\366c\336\"{wb\335]\251\231\261\333\005I\241t\32211"
+	.string	"?nQv\206\021<\347\00680&\017\251\031\323F\206\r\bm\222\022<\207\2317pT\230\266\324\374\264E\257\261@.02\007\227ck\370\013\313\263\273\022|\027\247\271\374\227\2539`x\356\352c\3245\241;\004\202\231\224T\227\250\332 \032\261\252\320\b\253@\f\3702!\031U\035\256kT}l\343\223\305!(\27193[l#@\273\202\005\033\246-5\277\254q.\347W@e\276|J\211\3554~s\301\1771\006\021\021\352\232\001! \260\002\2421\363\370\031\320kd2\022\3110\001SbG\313h\210v\272\224\023\241\206O\2540n\235\t4r\204H\022\"6\006}\nd\2369\213\327\210ZK\033\273_\254p\277JQ\334\017\335\007"
+	.ascii	"\334\247\034\315\246\237 \306"
+	.text
+	.section	.gnu.lto_.symbol_nodes.1640ab20347ee54a,"e",@progbits
+	.string	"(\265/\375`\343\013},"
+	.string	"\312G"
+	.string	"\020?@\346M:\206Hm\246/,\037Je\025V\373\224-\312\220y\350\261\220\357w\355\205\376_\b\021+%\023\037\036\336~\345\306\031\347)\277\325C\234bMg\340\226\247\b\240\353i#v\023\231\002\357"
+	.string	"\355"
+	.string	"\363"
+	.ascii	"\025\324\226\202\n%?/e\363\365\322F\376N\3555\037O\311\306!\237"
+	.ascii	"Q\316o\364$\277\316I\376\240&\371\202.1\311\377\023\270$\337"
+	.ascii	"\355OI>\237\224]\357\374-\020\2312I~[\212d\303\021\016\352\221"
+	.ascii	"F<|}\222\352\245E\265\262l\033\030\030\030\330\225[MZ\344qD\376"
+	.ascii	"\034r8!?\024\344r@\216\350\307\023\361=\315\354\370\310\217\246"
+	.ascii	"=>\307\343P\256/\332q:\035W\204_&\034r+\337.\005a\225\303\202"
+	.ascii	"\212W\034\305#\204\033\035f\343\252F\026\r\r32\310\300Rc`\200"
+	.ascii	"\321S\324\377T/\236\311EKi\321\311\253nY4\224\025\315\252*\032"
+	.ascii	"\331o\246\2615E~\241\364H\024\035\324\340\272\256\353\211|?)"
+	.ascii	"\376\273]M\034\325\343\032\340^\211\374>\302\225eW;\177\376\003"
+	.ascii	"\225u\2041~c$\362\t\245\377\003@\003^\206\313\026\212\355\261"
+	.ascii	"E;@\226\271='\267\017\264\3213\367D*&\016\235^\214\205\275\354"
+	.ascii	"\340\352\304X\270l\314\204K\232\335\331\270N\376"
+	.string	"%:\371\200s\3625\311\311\337\024'\037\023\234\334gor\243\271\311\235\245Mn36\271\307\326\344&S\223\273,M\276\037\232\374Hg\362\367\326\362)\231\311\357+\223\317G&\377\317\315\2574&_\222Z\356*brG\t\223\033\fLn\261/\271\251\364\272\256\377T\247\345[j/\306.\037\324_I\327\227W\017..W\252\377\215\257\033[_:\274tt\325\340\"b|\267\311\336\362W\313\re\371\033\226;\321zM\013\303\327g\371\200\322+\027\250\254\344\246cVU\326Z\310\362!\215\345?\2522\201\212\004U,w\2344,\367\234\021\021\246\344;J\2454\226\006\353+\252\210\266\322Q\036\230\f\370vV8\201k \032\345B=\265}u\007(\315\237F\251\2678y\0165b\247\266\037\240\365\375]\316\330h\234h\234\177\032\037\340Q\352#\320vV\3353\315\347\252\3600\332\177%%\343NW%"
+	.ascii	":%*\\F\237\257\253\302\335:E\343\212x\330.*bb\373\264\354\002"
+	.ascii	"dl\302\016-\342\001m\324R\256\210\r\270\335\t\334\236\360%\356"
+	.ascii	",Gp\322\225M\\n\007\357\362\336\356,b&x\324\032@\234\030\024"
+	.ascii	"\027q\327\265\255\240\214\322\314\237E\334U\327\251\034\262\213"
+	.ascii	"\324\024\336\341\266\232\250m\323\025Ia\006\355\341\244p\377"
+	.ascii	"-{\001\032\333\017\251\270\357\332N\351\332\240\207Sq~\362v#"
+	.ascii	"5\311\271\212\275\272\330\016\202\371\r\272\212\205\374x\353"
+	.ascii	"\270\330N\353\\\262\273\212s\250\341\230bU\034\345BE\273\327"
+	.ascii	"\230\351rD*&F\273\337Lc\304\266q\322R\027\022\355\bia\372\376"
+	.ascii	"\350M\374\303\355!$\274;\337\304\\\321\246\342k\273\335\233x"
+	.ascii	"\252e\3406^\303;;\2447q\002\004Q.\324\333C\260\2654\013u\314"
+	.ascii	"\245\336\233\230\330bMvo\376\214\364&\026\262\335\217\224eiw"
+	.ascii	"{\257\336\304vz\257\237Kz\023o=\357\206\333\325\273\033\026\252"
+	.ascii	"1\357"
+	.string	"\206\237\336\367LLd;K\317\332\347{\316\304Nm\223\301\302\306\376y&nv\317\371\034\277\0077x1\361\325\272\022\017\335\006\301&\354\313\357\256\304P\313<-\f\325>\271=d\302%\357H\013\017\337\243\026v\320A-<\214\342\035\261S\336\021w\373\273,@1\201}\356\226\001\207\270\312\200\205\321\016F\261\260\320\355^\003\334\033tFXxkD\007\033aa\241\332\224z\205\373\265:d\264\200\233\355\224\220\037\035\230\242\025\036\321\001\200\333\250q\030h\251C#\"#IZHc\340\002\251\031\3326\021\260\024\244\220\231\021\231HD$\005=@\300L\304\023_ K\006L\244y\274t\t\222V\002\037\260\360>q\310\211\357(d\250\377w\"\236\305\301\r>o\257\273\341d\317\372\n\315\2711\234<\366C&\364GEI\3520\243\370\366\205\256\215o\226\364\217\2138R\322\254\265\344pR\365\376b\366\205"
+	.string	"\207\306;\365\251"
+	.ascii	"B\273E\034\230l\340|\371\376\031H\237HI\371\316\366\200\215\017"
+	.ascii	"\240\314\312L\372\242ET\002>\252\230\361M\3602p\326\320+\350"
+	.ascii	"L\365x\303\205\324R\027\255\202a\265\334\263\016\032<\316\272"
+	.ascii	"'\231z\246Ez\374v\030j\021\360o$\3722\215x\235D_L#\257\023\321"
+	.ascii	"\227i\304\353$\372b\212\b\314\347\234\\\321\3558\033\310\022"
+	.ascii	"X\310;\220\361o?X\013_\311\200\274\"\331?b\213mM1s(\006\001\317"
+	.ascii	"*\030\253B\365N\331\364\3103\357\370\002\356\241\033\371*c\302"
+	.ascii	"\315+s\360\201\206\343\254\255x$\3256\304\231t/\267\357E\254"
+	.ascii	"\341\340\032E\362\367\236\273\255a/MY\261\005\"j\255P2\243lR"
+	.ascii	"<\353\037\256\032#J\336\374\247\004&\340\355Q\001*\3520\267\360"
+	.ascii	"\330\347\004\327\334C\3701\377q\035x*<O%\324s\034tc\273\220@"
+	.ascii	"g\220\277\261_'\376Q\207\244c\276\022\363\274\277\231\034\347"
+	.ascii	"\344\020X\003\3154\f\321BU\003"
+	.text
+	.section	.gnu.lto_.refs.1640ab20347ee54a,"e",@progbits
+	.string	"(\265/\375`y\007\225'"
+	.string	"*[H\017J\300\224M\322\001d\025Ph\226\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" p<\242H\b.\024\311\022"
+	.string	"X\307\205\266\354\035\244~7A\020\004A\020\004\0052\\\341Os\006\360\005 <\264\037\374>\375\344\354\210\036\033\336\304#\372\2738\326\033\021\231\002\353"
+	.string	"\345"
+	.string	"\324"
+	.ascii	"\363|5\213\264\036\037\214\021\243\363\r\363\365~\3412\363\325"
+	.ascii	"\202E\007\216\254\0324\260\256\254\252bP\301x\341\242E\330\313"
+	.ascii	"\002\366U\001~Q\274\276'vzM\354|K\320\276$F"
+	.string	"\204\370\276 f\275\037f\337\016:_\0164\275\033h\276\032tz3\314\364bp\365^p}+\310z'\310\276\021b\275\020r\372c\304\340\364\301|\271\351W\251\371\241\330\364\2350\251\351+)BD\b\020\0379n\330\300\272\252\202\365a|\361)X\217\372\342=\260?\201\357\004v&\360\225\276O\202u$\330\007\370\276\b\326\211\276\370\020\254\353`\217\373\376\006\353A_\274\347\365<\257\276\363\305i\257\256\363\305c_<\347\325o\276x\315\027\007_\375\345\372\357\35333\337\242\3519\323e\\m\335d\236\354a\366Y\374\234\370\255\270\214\353/\336>M\203\266~\225\356\217!\324.%\364Q\271\336\313=\001\\w\302=\223\255+\t\365\001\267.@\327\217t_\224\353D\271\337\341\272\020\356u\266\216\323\365[\256\007\345\036\b\327}p_\263u\236\236\036\346:-\3673\\\227\341>f\3538\271~\203\3536"
+	.string	"z\215\255\303l\375e\3533\266\356\272\365\332\016z\272\027\200z-\374\364R"
+	.string	"\372J\370\311\336\007\371u0FL~\351\222\377\026Y?\213\354\277b%FE\212\315\023'\261~\023&K\224$9R\304&\bP\017\036:r\204\375\033U\265\037F\355\245j\337\253\275S\330\233j\317\024\366\245\332+\201=\t|$\237^T\373]\355u`\307\201\177\363\351?\265\357\251\375\316O\247\201]\007|\031\330s\300\277\361y\233\260\203\265\207\205\375U\373/\3544\265\227\351\371\322\002CD\257\333=.\377\226o\373\236\354\316,\273,k\362a\361\b\210\227}\227}(\273.v"
+	.ascii	"Do\333=P~m\367<9-{,{N\366\233\3546\331A\336\303\262\177\331i"
+	.ascii	"\262\273\262\267\262\347,.\223=f\003\364\334\030T/2W\250H!\202"
+	.ascii	"\367\365\300\003\363\305K&\341\375@|\364\340\221\211\303F\r\254"
+	.ascii	"\370\3130\372\255b\021\357\245\362\241\362{\331\237\362\235\262"
+	.ascii	"7e_\312\256\224=\211\367H\331\217\262\033e/\312N\024\177G\364"
+	.ascii	"B\273\317\345\003\310~\313\036\224\035(\373O\366Z>O\374p\367"
+	.ascii	"\264|Y\374\030\321\333\304\257\311\016\333\375\227\337\312\207"
+	.ascii	"\246\372%In?\222\235\276\221\235\277\310\220\244\375?r\263\376"
+	.ascii	"\216\231-\373Y5n},\334?\303\026\277#\336#\362\"\003\231\247\002"
+	.ascii	"\366\247Dy\022\365\215\360?\362\215\177\210\220l,\372w\340\210"
+	.ascii	"5h\244\f\036\370S\345\027\340\375Tv\251\354P\331{\027\354F\340"
+	.ascii	"\027\205\272|\034\317\226_\013\317\032Gf\301\3224gu\327Y\237"
+	.ascii	"+h\275\023\365\264\331V86\323\370\232\261:l\032}f\254\317\360"
+	.ascii	"\004\260]\bd\376\276\352\255\255:\325\r\343\001\3273\260\313"
+	.ascii	"\300\2179\365\0320|\330T\375\025>M\370\tn\340u\257@'0\325\237"
+	.ascii	"\302w\222\352M\3413I\365\245\360\225\240zQ\201\337M\375P\370"
+	.ascii	"\271^\277\365\2366\365\263\360e\274\245ba\374&\374\213z\027\370"
+	.ascii	"-\250\236\275\022\250\3759\375\324[Nm\3520\246\370+~\306\227"
+	.ascii	"r@R/o\001\275q\244\016\310. \377(\276\321\357\342\007\200\235"
+	.ascii	"\250\221PH\210aDDdD\302HR\220\344\220\002\251\231\031\353\020"
+	.ascii	"\300\223$\355\006\337G\226\364X^0\313\262BK\324\270i\302rNmC"
+	.ascii	"=:\2038\320\326I\246\332\251\221aH\330i\3773tc\247\375\337a)"
+	.ascii	"x\212\371W/\020\033\bV,\032\350\332\354G\032\350!n\272S\346\212"
+	.ascii	"(\360\214\334\346\0360\366\031{\254D\370\346v\337\307\271\241"
+	.ascii	"\035\222\200Y\321\203\306\345(\222\2344\207#\322|\\:A\334\271"
+	.ascii	"U9\211d\216Y\306w\016\222L+\303A\364\013\257P\276\360=e7\001"
+	.ascii	"\034\023.\312\n\033g\201`\205\024\355\220\022r>(^\361\262mjK"
+	.ascii	"Q\345\240\330\267\234\235p\244*\217!\002\260\311\304\205R\310"
+	.ascii	"n20\241\311\202&\254U\b\210\247\3260\200\327\212\017\317\243"
+	.ascii	"\372\300 \007\370\013\253\277\004\027\366\306\035b\340:\027\036"
+	.ascii	"\035\237\"\270\036\n\030e\234=X\265X\017g\357\304\006q \006\302"
+	.ascii	" \334X\323\200w\200\237\302$C@\006b\"\272m>\247\256Z\350\031"
+	.text
+	.section	.gnu.lto_.decls.1640ab20347ee54a,"e",@progbits
+	.string	"(\265/\375`\247\177\315\024\002\372u\273\277U LI:\215\001\256\\M3\021\027\257u\232aDP"
+	.ascii	"U\020U1d\031Kj\306\304,Sb\005P\005\001QU+\273\240\321\326\245"
+	.ascii	"\006^\206\301\031\333\024\262\333\205\345`h5\313\317\274N/\273"
+	.ascii	"I\306\301\375wiyWK\247\207h\211B"
+	.string	"m\313\275\267\224R\246=\n\356\013[\fW\354\354\314\342F\224\205Q\206\271Z\256\234\335\013\001c\333\375W\366e\356\326\231)\313\322\354\323r\247\330\273\020S\333:\375\225\355i\271Xl[\007\245\275sd\245ex|~\177y\267\313\005s\271\\\275\033\303\335r\275\334/vy\265\334,\267\177\027\357TR!9\263!\337m}\320\237P\364O5\3753\211\376\t\246/\335\265b\227\227\273W\366\216\365\232C\362\272\371g\020\315b\357\275\355\345\320\364r\350O-\375\363J\377\264\241\177\272\320?\223\3643\240\376\257\0248\034\256\250/]P\242\3347\233\366\201\np\352\254\344\255\271\371\177\326\007\335\261=\350}\002\364\013\245\007\215\252bn\266\275\367\216\016\f\214\363\272Y\347:\001r.\271\222$\311\355L\375\373\361T\345\346?\257+\244KG\263\217\310-\342\204\013\3265\002f\333t\220x\266\022\027\034\177Cr"
+	.ascii	"%\211\241\004\024\253R\036ab\005xv\303\272\256\232W\310\272\236"
+	.ascii	"\220t\315P\266\335&\227\355\256\335\264\273\344\252]\3465\273"
+	.ascii	"h\227\211]\336\263[\366\273\274J\236\255\331\331\035\263w\026"
+	.ascii	"\217m'I\205\220\002\347E\371\2677S\265\301d\342\373\311\227i"
+	.ascii	"}\320\017\266\007}\276\323\317s\3729\212~N\323\317F\3643\227"
+	.ascii	"~\276\322\3175\364s\223>\233\365A\277\256R\337`[\0361\363\345"
+	.ascii	"E\037\317"
+	.string	"\001\271A.\340\024\230\337\315\307k@\260\231\376\357\217\013v\2307d\360\360\361\333\003K\236\022\0317\377\267G\327\214\265\031Tn\346\361s\243\224&vu\363q\021\035g\271X2PK\210@\261RB4E\2513\362\222<\231r1!\232\242\324\246\274\261\346\025? \3122g\202(\315\b\211\243bc\b\321\024\245N-\371b\243\243\357\007\272Hw\t\243Ei\267<\253\346\3358\232N~\021J\270UW\312\266a\2462]\343Z\376\327\352n\335\0357\353r\335\034W\307\325\2726n\215\213uo\\\032\367\352\342\270S\227\312.o\325\235\361\013u\243\376\303\334{i\357\375\021~\240\373\342\312\240\2414\303\254\215\275\323Y\342\331K\\9\224{3?\302o\313\240\361\262\177U6\215]\023\242)J\215\221\367\343\312o\001m\240\275\303hQzmIVso\346\255\331\017t\253.\323u\302hQ{\251\013i"
+	.string	"MU\256\212\374\355\315\364\340\307\003\374\343\310\\\336\006\371\027P\243L\353\203^\257\251\377+\343>\261\241\355\201af#^\336\276\354\362\306\2700\230\373\0075\313\373q\345\346\337,\372\227\256\351\272\330A#\303L\027(MlW\t'l\n\212\310\315\277I\364MzN\323\312\301I7\354\336n\3765\242\177\275\364/\226\376\205\322<\266\007\375m\322\277]\243\346T~\245\211\301\333\301iS\226\267\343\346[@\355\241\251o\363\364m\025}\333\246C\360Am\223/3\305\305\375\270\371V9\206\017\335\242d7\021s\313\2673$\212\026\0367\333.v/0\n\026\271\233\255\027\253g\227\035\330/\267`l\230\237I\314\315\334\233\271s\203"
+	.string	"\266-\271\231\307\372\240\327\366\240\267>\364m\007(\016\f\264\035X\254-6O\013\336C\202\221t\363O\260\345Zl\334U\027\023\336\255\226`\032\323\312\333\3156\213e\373\257\346\330\021\261\242\274\331b\261w(\216*\3000;\265K\231,\266\233\277B[9[\367_\275F\340\342\254n\266U\354\234]~\260t\267V\354\225\253K\314\255\226t#\212\226\233=X\0374\333\036\364E\372\366\003\272\023\030\030\030h?\240?s1\377\325\2339 \\w7\337\003\372L\333\203~\002\026NSu%\211\271\371\b\320\267K\373\026%\bH\344\356\357\346(\347\303\331\035r\266L}\3317\277"
+	.string	"\372p\266\007=\236\355A\177\353\326v\363\354\236\224vN\033\2626kn\376-\333\032\206\241\304\314\333\315V\3152\261\313\013l\023\346ro\346\016\016\024T\020\255\233\277\201\276\275"
+	.string	"\265\201\366\002\364vi\227\374V\2115\263i\330\351Ik\263\355\315\314\360"
+	.ascii	"1\034an\266L\213v\233f\317.B\t\307Hi{\271\367\266i$h\355\235"
+	.ascii	"d\323v\330\354\235\264cm\006\326f\220\223p}\271\241\371\001\320"
+	.ascii	"gZ\037T\333\036\364\266\3547i\273\204_\355\200\333\205\301c\322"
+	.ascii	"<;\364O\313\376\376\203\265\374\202?]\202\344\277`\377\r\373"
+	.ascii	"\357\330\177\305\376\233\344\277h\377-\373/\363\277J\376\273"
+	.ascii	"\374\357\331\177\325\376\273\344\307(\374'\006\316\013\374W\353"
+	.ascii	"\2770\3747\307\177\267v\234\026\370o\326\177\231\374\227\307"
+	.ascii	"\177\353\376\313\366_*S\376+\345\277p\377\215\373/\226\377V\331"
+	.ascii	":M\234%~\253B&\301Y\201?\037\375y\305\177R \005K\200\n\344\026"
+	.ascii	"\277\345\340|\341\317#\370O\027h$\377\264\203\377\256A) \005"
+	.ascii	"\203\271\1772\360\216\301\237\222"
+	.string	"\375V\355\024\221'uj\200\227\242\375y\311\237\325n\207\323:0\201\235\244T?\346\340$\261\346\262\331\200\225\301t\027\254\374\367\360\247`\377\271\302\237\335N\025\316\007`\267\313\346\2429G@\275\t\226\222\001\253v\212\270\177\377y\007<\367c*\267\273\211\001\374'\341G[\310fg\n\377]8\373\237\376\351\t\376\f\366\343\013,8Q\370\363\330\237\311\376\363\204\337f\370m\212\223\234\016\260\347o9\270\317\237\302\200\307p@G\370q\b\316\004\334?;\3426\340\267D\036\346l\300\217\2238\251\203\016\227\005k\215\374w\304o\305\354\024\013\345\211\215\373m\225\337\322\375v\256\356\277'\3746\313\217I\020\206\357\267P\277\035\363_\021\277\365\373s\321\237U\234\f\370\357\315\177{\376\313\363[\265\253\363?\314\255\340\277\301\377\002\340\277)\374\367\202\377\016\340\277\037\376\213\302\177\013\220\201\033\201K\3025\341\267I\367"
+	.string	"\017\370/\003\376\353\200\233D#\300;\370\371?\200\016\031\004\307\365G\271\264\375\374S\342\237]\370\317\005\374y\002\377\251\200\337\362\370\355\216\337v\375\326\307o\271~\333\343\267[?\016\301\231\200\337F\3756\306o\237~\253\364[\031\326\205\205\341\376Y\2435\262'~K\374\355\320o\327\337\006\375V\310\016\177<\302\211"
+	.string	"\024\277M\201-\360\237!\376l\342<\300\237\205\376\323\204\274\376g\t\277\235\300\3338\360\177"
+	.string	"\024@O\022\376s\204\377v&p\336\300\217\252\377\031\302;0\201I\270\372\243\304\263\341!\372O9\2601>A\374w\004\030\204\333\342\262\200\201\3772\261\311ZN\003`\035g\001\316\017N\017\214\254\214\037{8\t\360[\025\316\017\330\013\213\335\237\357\376\263\003\266\267e/\177\326\373\317\001\374\270\371c2\377\311\301\217Opn\360\3470\247"
+	.string	",\210w0\006\253\371\177\345\027\370\3231?\236\362qGp[\034\347OK\374X\352\324\340\317B\316\f.\013x\352\377\315\237r\360[\022\277\375\340\267\017\300\t\370\337vz8\005?\312\364g\025\316"
+	.ascii	"X\01600\361\265\353\374(\f\377\371\363\343\fV\205\334\364\237"
+	.ascii	"\025d\027"
+	.ascii	"\377I\301\237\221N\037+\002\205\233x\007\347=\370\323\t\374\230"
+	.ascii	"\0019\352\334\360\337\346\177\366\374\330\352\307W\247\206\377"
+	.ascii	"\356\375\267\314\233\340\033g\206?S\375\030\347\344\371oS\226"
+	.ascii	"e\300oW\370m\b\277M\341\317!8w~+\342\267(\374\271\307o\217\262"
+	.ascii	"\217\377\324\371\355\t\277\035aU\300\0058s\270\3747\361\277\303"
+	.ascii	";\370O\234\377\232\271\003\3764\002\377=\301\177\221\376\313"
+	.ascii	"\364_\245\377.\3757\351\277"
+	.string	"%\370\357\376o\323\2377\374\267\305\177\217\376\033\364\337\342\177\211\377w~\375\301\237\017\360g\005\3749\001\177\016\361g\022\376l\302\237\021\360g\006\344\023\376\363\374\263\006\177\036\341\317\"\234\371?\317\257K\360c\035(\374x\353\277\375\323\025~|\343?\361\177\336\243?\267\3713\340\237\323\374\371\357\277\033\370\357\005\376\253\201\377f\340\3076\376l\346\317e\376<\346\317|\3775\374)\b?\326\371\375\321\272?\357\375Y\357\3171\374y\313\237\357\376|\345\317n\177V\373\363\331\237\313\376L\366\347\260?\017\371\263\217?W\375Y\352\317.\376\234\364\347\022\374y\305\237\217\177.\376y\375\263\005\376L\201?O\340\317+\3749\205?\237\360\347\006\374\331\347\317\347\237\357\217\003\177\314\346\307h~\\\346\307d~\f\346\307z?\306\362c\274\037s\371q\336\217\265\374\330\356\307V~<\367c*?\226\362\343\267\037C\371\361"
+	.ascii	"~\354\344\307i?>\373q\331\217\303~<\344\307A~\354\365\343\251"
+	.ascii	"\037\373\370q\327\217\271~\254\365\343\254\037\343\3701\325\217"
+	.ascii	"i\374x\306\217\237~\f\343\307N?n\372\361\322\217\223"
+	.string	"~\274\177L\202\037\213\340\307,~\274\342\307\311\037\037\177l\374q\321\217U\3748\305\217\327\037\007\375x\370c\341\217;\360c\016\3748\003?\276\300\217)\360c\027~\034\201\037\223\370q\376\361\210\037\247\360c\006\374X\001?&\341\177\230\377\256\371\255\332\177\027~\273\301\177\313\374\030\204\037\203\370q\001~\354\301\217?\3746\351\267K\277\225\372q\006\277u\361\343\013~l\301\2179\374\330\347\307\031~\254\363[\374\333\364\177\363\3078\377\355~\254\376\030\375\177\345\277,\374G\373\337\344?\333o7\360_\300\377\262\371o\232\377\376\375\027\315\377\026~\313\301\177\375\376{\346\277f\376\253\345\277x\377\315\362\337\273\377\326\370\357\214\377:\375\327\305\177\205\376{\342\277\303\377~\340\277\036\370\257\004\376\033\201\377\252\360\333\037\277\235\372-\f\277]\361[\243\337\022\375V\305oA\360\277\304o_\370-\004~\313\302o;\370\355"
+	.ascii	"\376\267\375_\373\237\366\177\354\177\335\177\r\002\003\003\003"
+	.ascii	"\177\rO\277\206 ?\007>\020\357\001\242o\311,\312\345\003\375"
+	.ascii	"q\262\321\273\310\336<\204\334di\362\371\375\365hi\036<\320\036"
+	.ascii	"Y\340\272\216\366\270\327\236\21507\377Lv\373\257\342\300\230"
+	.ascii	"\212\313q\3635\374\351k\330\323?\252c\211\352@w\234N{O\025\340"
+	.ascii	"H3\007\006\232\24647\243Zf5\232\314n\276\206+\372\032\342\364"
+	.ascii	"\217\346@\263\2544g\220\271\031\305\312mLQ\324\364\217\342@\255"
+	.ascii	"\376\256pyq3\025\025j\225u#\207We\227\250\325Y6\205I\325\366"
+	.ascii	"_=\271\374\366\336n\276\206/\375\2434\216\336\370\321\032\250"
+	.ascii	"\215\340\225\336\214\0357[=\353\203^`{\320L\004\350(\215S\354"
+	.ascii	"\206\325\020\251\243S\267iO\360\306H\335\214F\001\035\225\322"
+	.ascii	"\022C\302us\005\266\007\375\321\031Kt\306\365\373\300\334H?`"
+	.ascii	"\233\317\357oGU}\020\201'4V\266\320'\035\277\030g\346n\276\006"
+	.ascii	"\031\032\215\201\2768\n\303\246\241NK[a7\243N@G_`=))6n>\003Q"
+	.ascii	"&\264\351\302\361\354-[\345Q\006\330\334QQ\037\\C\223>\272Q\244"
+	.ascii	"\243IG\223\320\245\363\354\275\225\366\316\201\225*\251\212\372"
+	.ascii	"\360\243JG\227\262\333\305\333\003\274\273\371gl\032\037\226"
+	.ascii	"*\\7?\203\237\376\355N\212\332{O\235\314\035\245\204\203\376"
+	.ascii	"\366\366\264\366\303\237c\261\325\340\177\376#Pd\356\245\273"
+	.ascii	"\260\275\2675\243\301\336\222px\330'\336\336K[H'lI-mQ9\251mI"
+	.ascii	"epR\333\332HKD\2202D\355-$'\265"
+	.string	"\2753,-!\215\320\222rRK\332\031\234\324\266\324f\332\"e7s\013i/i\355\f{i'm5-)\017NK[RNjIR\031\234\324\266\244\266\332\326\346\331KIQ/\226vT\206\255\266Ef\253iI\3618\251iI9\251m9\261C`\020aS\303.\314+\211\225rZ\3323d`%E\361\34091\265\266\336\336\226\255iGm\274\2755\330\033K+J/\211\312\302)\341\315Pz\222\244e\231{o\0162\224\270\264\366\022\036\222\335xNaZ{\207)\245\3302\366\336\233\004$&\336\366\262xH<\260\366S\323\336\026l\346\3362\366F\262\033o\357\215\264\367N\243\260\230{_\3618)e\310\330\273\352G\306\306B\222\322\264\367e\003\003'\345\244\306\245\005$\245\211\232r\273`\"Y\247'\255\255\334z[QZ\r\tm?\355\275m\031\255\224\242\321w\3633\260\351\377l\223\307"
+	.string	"\262q\001\006\f\2765?\331\\\255\275\331\276n\310\361\335,\002\320\3175cTv\244Q\303A\212\216\036i\354\235n\343\303\213\361w\353\356\327\214\2573hn\223\337\331%\313I\211!s\306L\335\032\024\346\315e\230?:/\262\3545\271\371\031\2164\3171\247\230s\357$s\362\331\345\331w\202\271r\245N=\214\026\245\337\224\306d\2460k\224yj\316\276\363\013_\fi\224}'\227\263$ j\376\366f\376xp3\306G\326\234N~\006&}\236>}\036.\247\027\253\266\346\265\346\346\363D9\273|\347\334t\301\261%\335|\236\245>\017\020}\036\032\372?\267\250\321\342\207\247\342"
+	.string	"{[sf9\357t"
+	.string	"k(\261:\261\234vvy\336\375\264r^9\353n\231\333i\351\274;\335\3169\254\246\204\200\013\257\346\335Yu\266a5%\004|"
+	.ascii	"i\252KfX\331@s\216\262>\350\323\350~5h\207\306Jy\363y\236\364"
+	.ascii	"Y\005s\021[\252\271\371<H\372\366\312\tw\2761\321kF\301\342$"
+	.ascii	"\313\223;\270\023\212\235\334\031wN9\245\234T\354\362\204\373"
+	.ascii	"O\"\330\206\337Z\031\033N\376\216\032\375\235\246\376N\027\375"
+	.ascii	"\035,\372;r\372;QN6\016:\3136<!7\177'M\377?\231\234M\354\362"
+	.ascii	"\\;\327N\253\263Kg\211g/\255a)\317\265\263\307\251\206\321\242"
+	.ascii	"VX\313j\356\2759x\340A*\303\205\025\036\232\317%8Toj`\334\374"
+	.ascii	"\0352}v\0169\227\030-*\002>\252\232^PJ!g\332\211v\232\235JN\246"
+	.ascii	"]\236g\377y\343\244\n\003\304\313\214\363\354\f\342E\206\222"
+	.ascii	"\357\212N\017'\377\347\327\317\345\177\3728\177\234eW\213\357"
+	.ascii	"G\231\276\233\317$\227\306\031\251\346\315\337\361\322/\301\b"
+	.ascii	"\340)\206\333\326\234\232`l\224cg\330y\344$;\221\330\345)V\244"
+	.ascii	"\215\362J\354T\006*ul\354\030_p\362w\266\364w\254\364w\242\364"
+	.ascii	"w\232\364I\004\350\347\327U\322\303\t\310\315h\032}\235>}\035"
+	.ascii	"/\372:u\372:N4fZ\0374\204\355A\257\323D\237<~\316\267\260\245"
+	.ascii	"\346\315\327Q\242o\303\340\340Sb\2119\265\316\254\277\035\247"
+	.ascii	"\216\223\353\334:s\330\345\251\305v^"
+	.ascii	"q\031sj]&;&\237\337\3375s\245\013\016\234|\0350}\235!\372:]\372"
+	.ascii	":8\364un\350\353\314\320\030\317\372\240\013\260QC\355\"\303"
+	.ascii	"I\016\251\2375\376s\352\244a\333>\320\327\003\315\223\233o\252"
+	.ascii	"\254\017j\301\242\200~J\345\310\211\355h\336l\215@\2353t\220"
+	.ascii	"\270\2019\022\343\347\214\377|:e\244o\177ZOn\276x\326\007-\200"
+	.ascii	"\355AO\030@?c,\275\240)s\363\007\347\0130\247S\016"
+	.string	"l\233[f\271\371#\244\311l\364\226b\2224\277\344=\2562\276L\206\314\213\2223\371O\351\013k\375\02600w1;\367\231t6\235K'\323\251\224\333\234H\247\013\273\314\201\0310\007\346\276lf\212\004$\373\372\025\201\262cC\276N\222\232\274\206+L+\313\214\2320~\031\215\036\302\004K\023<\277\271\030r\231\241\260\266\2645\375\234\345\230\334<c\260\262&GdLN\227~\016T\0163\007\204\f\325\315\317Q\322`p\314\350\343`\321\307q\242\217\263\324\177\346\222c\3101\344}m\211\263z\312,,Z\360\242\220\215\225=\343\335]\255(\224\013\334\222]\226;$5\334\364\242\274e\270l\207s\263\265\250Q\335\214\005\315\333\035\233\233\217CD\003V\311q!\232\242T\030\\w\315\022.X\246\313T\352\352\362\\\276\222\255\330e\246\313rtYJ\216\353\240\344\264\223\2666(\203\343\363\373\273rP"
+	.ascii	"\345\202\3718@\364q\260\364qn\350?\307M)\253\321C\310\336Q\245"
+	.ascii	"\2549b\343\346\343L\351\364\317\366\240\326\n\320s\224\314\303"
+	.ascii	"\017\312H\206r,sG\320\220n\376\363\223\354VV\205\213\355\346"
+	.ascii	"\354vs[v\362\354\226\331.B\t\307Y\332\313\275\231\331-\357\235"
+	.ascii	"dm\006:\326fp\312\rIZ\202\346\343<\351?\257e& Y\325\315\231\231"
+	.ascii	"\225\331\314\213\211\225\030I\210\246m\267\2319\"\315\314\304"
+	.ascii	"y\030\215\220ffb59G\210\251\255\216\315\005iff\326\221\207X<"
+	.ascii	"6\t\314\001Qf&N\202\361BLmU97\244y\226\231d\264\254\226\227\344"
+	.ascii	"\264\334\304.333\261\020\374\325Ai\357\244\254\340\231&\237\337"
+	.ascii	"\037\007\017\320/.\334\324\360\344\254Dur\343\205\324\315\277"
+	.ascii	"\001\324a1\300\234\232E\354\035\f\245\230\024@\2736J\261{'%P"
+	.ascii	"\231\2279I>\222\3132\222<\226\311\3542\213\375\231H\376\022\313"
+	.ascii	"F^(\367\336\026\217n\311\032\236\374\2330\3727t\3727n\3727b\372"
+	.ascii	"7_\332\342Y\037\264\203\355A\263\220\237\364K\314\21557\377F"
+	.ascii	"K\037\333\310[WY\013\253\311\212\307\215\203\342Q\225w\360\300"
+	.ascii	"lp\360\310\\Y]\031H\356\221\203d\257\354#\377\260\313\314\343"
+	.ascii	"I\260\314\322\313\033O\376\215\225\376\r\223\016QF?\270\247s"
+	.ascii	"\026\03064^7?X\247\237\231~\240\3344\004\211,S\345\252|#C\345"
+	.ascii	"\251<#\313\31062\216l\225\2432\215\214\225cd\251\374\224k\330"
+	.ascii	"e\276\372\361\037N\2234v\337\326\26053\214\266\246\375\303l\316"
+	.ascii	"\224\026p'iz-\021i\306\240$;\005\001T\372\372\313W\030\320\254"
+	.ascii	"\331f\251\304\201eJ\240|\225_\334: J\255|\225]\b\261\\3\250\220"
+	.ascii	"m\220\037\254\242\037|\242\037\\\323\017\232\351\007\301\364"
+	.ascii	"\351\254\017\372\240\020\375`\227~0\207~\360\205\276\232F_\375"
+	.ascii	"\242\257Z\321W\237\350\253l\372\252\022}5Lc-\353\203\222`{P\354"
+	.ascii	"w\373\374\306\302n\276\332\245o\373\364\350~,\006\223\301{x\f"
+	.ascii	"n\3423\230\017\367\3412v\211\315\374X\013\336\362|\343\2404\301"
+	.ascii	"\304E\211\001\213\027{g\245K\334\225/o\315\275w\030;l\006s\211"
+	.ascii	"\253\373\271QO{T6\344\2535\364U\030\372*\222\276\376\323\327"
+	.ascii	"c\364u\027}]\247\257\237\350k&\372jY\037t\003\333\203\342,9X"
+	.ascii	"F\304\334n\276\026\323\370\nV\022\027\3304k\203\257\3403\333"
+	.ascii	"\026\242i\2630\023\007\210\257\334\27086V\360\035\266\303Xp\235"
+	.ascii	"]\342+?\036\303d\317\314\275\227\256`&\246\0131\265\325\246\234"
+	.ascii	"Ss\357\355A\260\fVY\025\034L\367\3432\274\304sWk'G\227..n\306"
+	.ascii	"U\202g^\230X\335|\255C\037S5\341S:\371\242\\\213\023\363\206"
+	.ascii	"\245`9\034\207\243`8\f\005S\261K<\345\330\306\024\214\206\231"
+	.ascii	"X\274\037'\304\215\261a\332\246\340'\267\316\342\261\215\210"
+	.ascii	"\373\303Wl{%L\301nq`\224{3-\222\023\270$\r\371\332J_\333\320"
+	.ascii	"\327Q\372\032\206\276N\322O\333\350\247i4N\303K\354\222\003V"
+	.ascii	"\353\373\241$u\363S2\332\004{[\016\250\r\f\264\034\320\247{\372"
+	.ascii	"i\f\372\351\235~:E?e\3238\333\372\240\226\211\246q\230\326\007"
+	.ascii	"\265l\266\007\305bQ\201Z\315\233\237\222\351\217P\304\266Y\274"
+	.ascii	"\252\005\310=)\301\360\021\273\304a\267\314\375\022\302\260\021"
+	.ascii	"\333\246\203\304\334PA)p|~c{3=\370\361@\025\213c\343\201\346"
+	.ascii	"\247`\372\351\020\375\324K\377\230\310\361\327\217\201\340 \266"
+	.ascii	"MM\243\026\367\342f<\004\350\230\310N\2262%]n\276s\266\007}\312"
+	.ascii	"\245}\230\326\007\275t\330\013\357@\301\232`\241\262\262Rb\345"
+	.ascii	"\311PRU\341\250\241\343\n\007\324\016\234\025\243\2717\023h\007"
+	.ascii	"\276a\333,^\325F\"C\002\030\234\032#\177]x\013\367\300?0\017"
+	.ascii	"\354\003s\331%\336\201s\034\353\300Z\277\330\357lJ\223'\037\316"
+	.ascii	"\372\240A@}\364O\037\355\323G\371\364\217\236>\212\247?\320\351"
+	.ascii	"\020\254\017zT\212\3761\r\f\225\252\031\273\373\272\031C\335"
+	.ascii	"6\330\t\243EA O\257\231&\214\222\315\027<\003\313\300R\370\t"
+	.ascii	"G\341)\273\304P\370\3051\f\034\003C],b\302\310\331=\235$\236"
+	.ascii	"\275\244\264\247T\363\003a\250\273\306\356a&\234v\261$\207\013"
+	.ascii	"\020\317L'[\246\365A\177\316\\X/'nr7\037-\242\377\343%\254\204"
+	.ascii	"\231\354\0227a\244_@\333\367\274\257\230\341\244[\307\205Ey\005"
+	.ascii	"7\335\300[GB\231r\377x\340\201\0078q\313\276,\235\217\006\321"
+	.ascii	"G\263\364Q+}\324\206>*\245ql\017z\364\205\376"
+	.string	"\t\250\337\374\263Krp4\331\332C\3437F%\307V\306\314=\223\323\204IR\f7\333\037\326\007\365\351\003\372-\323\246\312\f\257\2337\220i\352\200!\243\343\263\200w\214m\373\300\336O\366\336\025\340\251'K\216\334l\267\365Ao\024\240_>\264M\232\030lb>\344\244\351\2424\266\327\201^\212s\262\f\243%G\f\230\261\274\233o\257P\001s\207\245YE/A\256\230\331\270YmK\275p\251K\273Ye;q\320\b\263\366\2538?\260\334\365\335|\001\210\351\013@\211\206\246\252Y\036\246\022\027\031J\235\257\0353\372\226\\U{\333\241g\345\343f5\355oQ\320\364\202\b\200K\211\022\365\354G\013\tM\260\352)\211\362\017\t\255F\230jv\365m\r\214\226\270\277\331#Q\310\334n\276\006\200j\231Z\226\226q`\013\210\032}\305$K\223\233\257\301\234\230\230J\226\343\364r#\033\273J\226\221\230\354"
+	.ascii	"oV\221\354\204\221\241\264\272N\351\324\034\234\324\315\327\240"
+	.ascii	"M\375R\277\324\260\037\273- jrj,!\362\003\354j\030S\017f\216"
+	.ascii	"\233U#)\331\327\217\267\346\315j\221\224\214\210\335\030\035"
+	.ascii	"7\253J4\307R\036\023+9\342\354\266\310n\276\006H"
+	.string	"T/\325K\035b\273\274\256\350n\364\2420\371\241\n\271:$\007\356\006\220(j\020\034&\322\346S\203\250@\324\276\2750K:J8\224>p\\]\305\272R}\340.\226\271\253\264\220\310 `\315\rZ\f4-\\W}\\\355!B\t\0273&\326%\351f\265\353:UvS\2327_\345\021\004\353RCr\363\r\240\323nHI\335\254n]\314\r\023\363D\346fu\307\345p\252\274\374\371P\265\356\270\362\224nV\263\324\034v\371:U\307\231;:S\\\264\325\335|\rj\350\333\327\241'\260\257CU\034\352\224\034][7?u\353\202Cy\3635\220\241\322Pi\250U?ZHe\n g\004\210\032\034\2563Lgj\215\253U*\025\233){\215J\275\201w\345\306V\031\016lW\244T\033'\030"
+	.ascii	"\210q\202\202\312\300\201\242\245\t\224\277\027/T\251\037-$2"
+	.ascii	"\013\230\353\003\242\346\017\233\371\305\335\251QW\245R2 dOG"
+	.ascii	"nV\241N\275\024\r\217,`7\2533P\0317LxD\001\273Y\225a\311x\201"
+	.ascii	"I\342t\263\372t1K<\212\324\335\254\306\260w\313\034S\254\334"
+	.ascii	"\254\302\270Nv\r\\\227\027w\t7\361\342b\366E]R\227T\027?Z\230"
+	.ascii	"\013\220+\2721\364\213\222\016\270\246\253.t\242n0\335nV\231"
+	.ascii	"R2'k\201[2\260\013\fT\223\262p\350\2440\241\250HW\223\322f\\"
+	.ascii	"\333\362fu\247owW\366\234\350?\375\247\001C\250K\003\242\006"
+	.ascii	"\205b\006L\251\323\\\003\262\301y\322\203\315\325\315z\315\215"
+	.ascii	"\230 R\272n~\006L\255\325\334\375W\321;(6jn~\006B\314\374f\264"
+	.ascii	"\337\217\026\346\022\344\212n\fg\307\214*]\316\\\373\251>\272"
+	.ascii	"\310x\312\340\n\327\3005t\337"
+	.string	"\217\026\022\031\002D=\371h\343C\215\02207kM&\215\225\026\240n\nu\255Q\271\371\036\374\274x\321|\033e\312\303\202\"\346\232o\216\311\207\223\275\377\352\251%\315\b\026\275\247\303\370}\255\005\336\254\365\364\027\273<\026\r\346]`pa\335|\017{\372\004\033\013z\017\\\346\256\355\3464\227\2350\273w\325VZz\352\261\374\333NU\037\322\273(9\306\262\\s\271\216A\204\022.\327\366\005\306\336\315:\357\326\253L\023\247\233\257\265\350-\277\252\026\331{\322\346\346{h\2425\236\001\262\324\354`s\263\276\313q^L\342\252t\3355\226_\2751\223k\312\273\371\036\314\264\266r}\345Wm\217\031x[n\276\0072\375k\272_\305!#\344\006\220\233\357!L\337\303\220\2708-\367\243\205D\346\303\335\323V\252E\313\030 \225k\271\003\334\230\353\213\373\257\356 Y\023\243\213\031)\227\202\366\331\264\ru"
+	.string	"85F\306\366\256\372\200\355\320"
+	.string	"\341\362\245\255M\277m S\2521r\253\326\332\206D\271~\373 \311\224\332\315?\243\241\374W-p\204n\n\024\375D\313\031)5n\326Nn\260\352\340\212\334\374"
+	.string	"\334i\355\206s\350\310\242\242\273\371\001x\323\377\257\325\264\232^\263i\033\3122\251\272\242\373\333\273\352CF\243\245\b\\\223\353\265k.\177l^\334\254\231\244dA\250P\201\005`\211\376u\232N\303L>\354$\244\r\216(\325\250\0351\346n~"
+	.string	"\276\364\257\231\232\211~}\340\331\233\353\fnGU}p\0037\227\205v\363\003\240Eu\275CSi3 \245\235D\304\003`T\226\226\036\336\315J\230i\222\227.Vn~"
+	.string	"hli\256\275&\2170>\264\227\305\373q\202X\226.\353\326A\311\211\304\022LSL\007\321`\026\257\212g/E\371kj\261\363-\211\336\230^\3522M\246\217h$:\211]j1\r\344G\213\351\036v\317\342\3758a\371\245\2717s\307L\331\032\025O\336\272\230\016JN$\314\370\232\332\210\016\263K\r\306\246\301\264\020]\304\342U1\367\324\r\2242h\332p\360 \247/\006=\034h\376u\021\255|\302\364Q\346f\375\225VQ\3251\335|\f\312\350_\017\261KM\344\314\230\22457c\320\324\307"
+	.string	"\214>\006vZ\377\320\\\232Ys\372\030\304\351c\020E\037\203&\372\030\240\351_sY7\265+f\356n>\006J\264\316\241\265v\222\300\365p\362_u\001H\026'7\347\254[\367\245\224q\3635\226\216\036\2216\264\233\257q8\t4cu\263\276\322M\030|u\020\314\212\242\003G\325\365\325\257\235\264\225\b\002\001\321\334|=\353\203^@\240\353\252\233\273*\315\263\233\217\001\226vq]C\273\3206HT\355\251\002"
+	.ascii	"*\261>\300k\302\002\341n\330\202\264\255\335\254\243\364\224"
+	.ascii	"\246\361\253j\334S\036\326\315\307\240\206\276\226\372\257\006"
+	.ascii	"\177l\031r\344\346k/\207\352\031\327P\277\232.\243\226\332n>"
+	.ascii	"\006P\372\372I\313\300\022\367\342\346c\340B_\307\370\257\236"
+	.ascii	" \314\016\262\2335\f\335t\301_\007*\23041An\376\365\213k\030"
+	.ascii	"\377}r\325\330\264\373\204\243"
+	.string	"j\314\315\332\t\350\372\305\027[]\335\3159\266\007\375\005wKK\232\211\304\b92\035@\250\2663LN\364\257\2214\222N\"1B\316M\211&%\206\235NJ\322\246M\032Hb'\321\b\326\245YF\262\334\234\006^\320#\315\232\224\215\275\263{j\333\027aG\260\232\027\340\320j\324\244h<,\355\335\264Y\2309r\325\274\300I\277\203\2323gR4\250\234\022\273\340\333y~O\321,\345\232in\376\031\241\034\220\277\233\337\241\231\226I\313h\335\210i\263\264w\363;p\331K\233{)\0312\251\230TL:\346<Ih\032\255\224\357\351\030l\007\004Lm\357\f\254\252\307\315\357pE\277\003\033\0300\177\313\314-\244\303\021->\277\277\252\245*(7\277C\232\227\324.\325\263wCtl\300u\b\323\357\300\203\013\027\035@b\244\201\273\371\035\242\362\362\354\336\207\235\204\364\001\f\017\333 \213\221w\363\001"
+	.string	"\230%\325\222\005\017/\235\262;j\357\252\005d\001T\356\252\252\017:\311\033\024\255\233\017"
+	.string	"9}"
+	.string	"\364\250K\355\352\260`\321\241\241\344\363\033\303b\246\226\345\346\003\300J\037"
+	.string	"LVn%\235\272{\357\255L\351\262\2345wU\325\207\0344:<\0367\337\0021U\346n]\336l#\262\274Pn\321\267@N\377i\034\352#\245r\353Nx\261\367\226\220\0332\233\317\357\317\002(\372\026,\321\177*%\225b\333l\332\206\n\276H\332\361\023\313\nr\363-@\362\366\206\231\274\240\233\270\274\232;\252\352\203 \0202*h7\337\002-\375\247P\240\330;\022;I\352\303\221}\303\346J]\340\315\267"
+	.string	"\206\232Z\352\344\006P\213\317\357\3572\311:#\345\366\324\211\316YV[\332\315i\333\371W\344\211-\314\315)\333\371\227\023\266\306\313\225\233\323\265\363/\007ba\271\335\23469\377t\310\260l\t\2749er\246\001d#w\376\231)\275T\271\371\034\372\364S\246M\323\322\264\277\331(\n\260\354\3004\367\314\226\202\334|\016Z\364\337\354]\332;I"
+	.ascii	";]J\364l\334\254DIzvc\307\344\363\033\323a\322\366CKj\366\364"
+	.ascii	"\314\272\355*!7\377\314\255\373\022\266\303\305\315\347\320D"
+	.ascii	"L,-\273\261\202\016y\352\001\225\344iY\260\007\016\244\345\315"
+	.ascii	"?\223\222\341\371\371\261\335\234\216\321\315\250\013\302c_9"
+	.ascii	"\241b%Erg\340\344\350\272\362R\344\353+\r\363\013\242A\231p\035"
+	.ascii	"\221"
+	.string	"qs\032\246\363x\2105\335\234\032\261n:`Y\206@\335\234\026I\225\034\264\206\fA\373H\2444\264\3162F\234\320\270\371\034h\244A\322 \351>\203\002\342\335p!\275E\271\371\034\\\244^\251W:\265"
+	.string	"\2601Jt\nn\214\034\032\037>,XU\325\007\235\244*E\360n\376O\030\335\325\225N\351M\265o\024\254:\272\274\255e\272\225r\221\340\331\273\313I\271\243j|\260\2666f\233Y\321\261Lu\244ZS!\346\326>\260\206\325\224\273\371?N\364\237f\331e\232\205~Q`\357\244\252\r"
+	.string	"\243*\240b\226w\363\177\222\350?\265\272U\212\203\204\326\236Z"
+	.ascii	"\330\024\254\017t\017\246/J\322+\333\204\271\204\nsC\025\222"
+	.ascii	"\0317\377G\231\332\260\313\324FJ\025\202\022\255\032\037\244"
+	.ascii	"7\202m`\3137M\303\210\f\246\233\377\303CG\2454\242\322)to\313"
+	.ascii	"\324\202\212\332UQ\037R\251T*\235\322H\034\346\264\252>\004\371"
+	.ascii	"h|e\335\234Nm\t#\342v\363\177\250\364\177\224f\314\260{\037N"
+	.ascii	"\220\013\323\247\377\364\311.\323'\273w\356\255\345\025\264\323"
+	.ascii	"\342\363\373\333\002\003\206m\373Y\200\034\026%\026\375\247N"
+	.ascii	"\251\223m\253S\362\371\215Uij\302\343\363\373{[Z\312n\350f\321"
+	.ascii	"\224\313\322L\323\177\232\224&U\260l\323&\335z\357\215\304\334"
+	.ascii	"P7:\232|~ch\340\323-g%\206\243\202 l\3300\265\324\250\311n\226"
+	.ascii	"\271\241\202Y\242\370\374\306\246\376\376\262\033\266\203\253"
+	.ascii	"\340\205\376Q\277%\352\227\231\252\323\3364\202hv\005Hf\314\330"
+	.ascii	"6\274w\216\037A\2734d\310\240}\3014\314\2379\332W\004\214\353"
+	.ascii	"\351\346S\360e\314\230\261\246\331\026\030jn>\005V\304\210\261"
+	.ascii	"KB\200E\261\351\037\005\023\006\217\0022}\n~\350\243],\252g\227"
+	.ascii	"\250\236\275\263Q\272\311\022\262\346\216\242\373\340Z\341@r"
+	.ascii	"\273\371\024D\351[{\207\376(\027.g\351R\223\033p\200yyl`\312"
+	.ascii	"\274%\361i\321b\206\203\027\246\314\327\315\367\271\323?\232"
+	.ascii	"e\211f\271\315\017<{)O\211rGU}\200\nyK#s\363}\336\354\354l\333"
+	.ascii	"\317F\"\263\001\022&\335\007\247\215'bM7\337\207\311\225\272"
+	.ascii	"\246\317\230\276\217\227\376Q\272%Jg\333~\264\220\372<\234\031"
+	.ascii	"\001c\344oo\272\017\316\267%TEn\376\2066\372G\343~\373w\361P"
+	.ascii	"&\224\nZ\205'ik\253zei\232;j\177\200\312Ia1\323v\36374\3657\350"
+	.ascii	"\351o\270\203\223b\333\354n\332\"P\226\265iR\321\337\300\006"
+	.ascii	"%J\035\232\376\20617'\266\315\003\336;\307\031\\\021\375\r>\364"
+	.ascii	"Q&\026]\373E(\001eB\331l\333\tJ{\347\020\222\23617\354\320\337"
+	.ascii	"P\245om\033\372\243j\267KT\r\035\242:\355-U\2005x\370\213\224"
+	.ascii	"\216\270\233\277!\352\354\fM\213C;\232\226\325"
+	.string	"\342\222X\335\2142U, }\200i\224(\271=\266B\224m\346\007\357!#&\206\226\331\275\367\256\332HdJ\220\302Lr\264L\215\352a%\312\315(\231e+\363v\206\307\315\350\230}+K\263\343f\024\211u\243AC\353\313\342\264\345\231\263\233\337#W\244\b\032\346\225\202\341\201\035\r\263w\250\031\227\027\0377\243F\354\222\377jNC%e\246\247\215I\225\204\314\221\233Q\"\270\n`\017\0327\277G\211F\205\234Pw^\2247\277\007L\377(\220%\n\344d\203\235v\322\216\r\300\340\364\323\2305\0317\007\353\320\020\211\\\213\324$\nb\n\244\316\232l\221\302*D\032\r\005\223k\t\244\321\320\215\3200\210\\\223-R`Q\201\343p%\022\201\223&\327\022\310\243\021Y\\\221A\241\"\"2?EPqx<Q$&\215E\034\241\"\"\322\303z\034\022\005\255B\036\214\212\214<(`0\032\345\247"
+	.string	"\201$\"\032\006!\223\304\023 \034\025\207\f\300\342\250H$2"
+	.string	"\t&\bM\b\301\002\204$\262h\f:Q$\217!@\236\"\024\207\311!\316S\200@\246H\016\213X\030\217FFC!\322\030\024\034*\022\223)\220\304\"Q\005\243\211\243Q\205$q\b\003\007\253\220\261\205\234\026I\243\242\007\244\220$\026!\213\303\243\t$\021"
+	.string	"I\341*\002\"\022M\256\310\242\265\b\025*\022Ql(Q\\\215\214:\311\"\361\370B\211U\0304:Ra4\022\365\244\220\\W\310`AR\210l!)\fJ\036U\364)@\200\260\n\035\021\005\025\211 \034\221G P@DtT,\032\213)\f\306c\212\244\261\230\242\030\256Dy=\036\031e\243\242\240c\022\211>\005\210\242\221\210<\256+\212\306 !\322hH"
+	.ascii	"\310u=\016\255BBcR(t4\0327\254ED\023\310!\211\240\3441\230\f"
+	.ascii	"\216H\256%\202\222G\2355I<b\340\006\005\n\343\252b\230\024\256"
+	.ascii	"\030\026{Z\030\031E\350$\237\002\304\220\021\bCFA\305#\025n\212"
+	.string	"(\356\211\024\016\031\341$\205\305!\243\2638d\204W\021\020\221\031\211\\\217BB\303\264\205\2211(\037\223F\3709-\216I$qh\255\200P\203\320Z\034\"\022\rS\241\025y\224\221\351\207\311\241\320\220\021\b\235\344\220\310\250h5\221\\\221k\005\206\2148\b\211\214A\306\244\361\250\001y\342\210\007\231$\236\020\366\004\217\306\3440\210(Td\001i\264\202\006\021\200@\254ED\023#\036 \201\022/\254\220\2034\032RK\274\260B08\224a\305\260hB\350\314\t\001\304q-\"\23202\032\211\204+\206\305\235\036\rk\221\221\204\321\304z$\216\020*\2420L\016G\254P4\366\254\307 \020\b\234T\004\020I\"\024\206\212\304\242\343\360\246D\221\210\"\013\302\022/\254@A\221\210\"\013>CE\342q\270\236\020\026\005\t\205\2120\030G\024\215\022X\211\206A<CE\"\3210\b)\024ZpbX|"
+	.string	"\322hh\203\360H\310\323\"E\222h\270\222@\036\2070\b\035\207$v\206k\221\013i\222XdA]\213G\343\211#\021\205\234\2425\211lQ\202\007\251\336\340\204"
+	.string	"\"y\034\032\201`a$:a\201\236\343\232,\036\031\203x\204;'\206B\025A\302\0235\"\252@\nq\214\326$Rx\362\004\2050\254Ea\016\213\265\250O\bSa\2124\032\022\256\310\343\320H\230\201\tH \005\013\354$\217\303\024\"xtH"
+	.string	"!\f\342I\026\217\214\"\204\214(\212,T\240\301X\024\"\256@\356\024K\274\260\202\216\260\304\013+\2508%\200(:ra\005R\347)@\024\217\216 \004\241\b@0\231\232"
+	.string	"b\b\331\202z"
+	.string	"\020k\321\360\210B\2104\032\272A\021"
+	.string	"\242E\222x\034\032i4\004 \020\311\025\211\002\205Q=\201\200@\024\r\217C#\235R\220<\032_@\032\r\245EGH\025Ak\n\021kr(dd\201ar8B\250\270\226"
+	.string	""
+	.ascii	"R\210h%\242\020\236\030\036\207n\222\311\022/\254\240\325\013"
+	.ascii	"\024a0\022\251\260\006\025\207I$q\304\232\034\022\035\005\021"
+	.ascii	"\r\203\204%^X\241\203\021@\b\035\215F\021I\364\270\026\035!\213"
+	.ascii	"F\021:)\206\216\214\307\024I$r\370\302J$T\034\222@\032\rm\030"
+	.ascii	"2J \271\252\b\032\276\2004\032\302Y\205*l@Qx@\013.\254E\303\243"
+	.ascii	"\n0\254. \215\206v\036D<\256\305uH\237\004\023\f`B\b\026\351"
+	.ascii	"C$ \204\004\204\200>D"
+	.ascii	"\002\200\200\022`\002\220\276\t@8\004\210\241\"\361\230D\352"
+	.ascii	"\244\006#\261\202\026\307\344Z\264\022\255\311\n4\250@\016[("
+	.ascii	"\032\211\311\240\342\021\n\234U\310\002\005F\310\"\244\321P\006"
+	.ascii	"!\013\343\t\025AC\242\023\024\b\255*\202\206FB\026'\216\202)"
+	.ascii	"\222C\305\225\b\005\022a%:Q4\\\217F*\0229$\n\022\016!\213T!\242"
+	.ascii	"p\bY\204\036W\241\341\232\002\025\2628qt\203D\026\207\204,N\034"
+	.ascii	"\355\b\261\200D\026\207P\344z\324,\206E\032\350D\020\316q\275"
+	.ascii	"\300\020\262\b\205\201DpEZ \205\b\025G\023EG\305\033\244\212"
+	.ascii	" #Q\nEG\305\035$\2628\224\221\303\023H!\213\023G\032h\035\032"
+	.ascii	"\"\217\316\022(\244P\202\305\260(\025a\0252\026\025\207AH\025"
+	.ascii	"9<\201\314BC#Q\213\241Q\212D\032\r\335\254\302\027\220FC9\307"
+	.ascii	"U\210\270\302x4\322\2530\270\n\031[@\016O \365*\334\031\"\242"
+	.ascii	"(\032E\030\223G\303\340*D\001i4\224#t4L\301\230<\032j\343JD$"
+	.ascii	"\032\016\tW\344\221\317\315*d,\022\2620\022\235\320Y\203\212"
+	.ascii	"Fa\262H4\032\t\327\"c\narE\n\221FC\025\b\205F\020\256\310#!\322"
+	.ascii	"h\210\247E\222x\034Z\223E\242\0209<\201\324I\252H\026\341$\261"
+	.ascii	"\310\002\322h(\207\305*T$\236,N\034"
+	.string	"a\"\2431\005\341\031DL\036\327\025\031\204\210F\244\021\221\210h\025j(j\201\b\331B\016\3210Y4\212\200x4\246\350IAD\2044\032\241k\0211it\204\022\r\211\311\342z\\Q\240 \n\365\260 \242\020&\221G\"\n\2411\231\001\345\021\001\271\036s\320\212,\n\327\"bRU\261\2560\344\325\250ER\310\202\210B#\217\222\303$R\310\202\210\"\310\242\005*4\202p\003\213\026-\222\304 #\321\272B(\002!\2125h\335ya\002#\2048\310\365\210\221k\222HD\264&\207\310 R\363\244H\036\215E5\211\034\256E\030\214BB\241\265\250\205F\320B\"\b\207\212D\241\341\232\"\330\"hx<\n\n\032\nu\204\326\"\321\272\002\325\021\nW\f\213B\026'\216(@\256\0258\032\235\305\024AX\210\270\002\231\221CC\"\024g\213$\221hx\024\202\324X\f\302+V\2425'\205&"
+	.ascii	"\021E0\314Dk\2618L\021\224\246\020QtT<\221CC\"\025\210\206'\214"
+	.ascii	"DC7\"\b\255+\216+r=\252F\024E\342\n$\252\"h(dq\342(\025ba\bY"
+	.ascii	"t\n\261\200$\n:U\004\r1rM\2668q>\005\210\265\210\230\004\241"
+	.ascii	"h,*2\006q@\n\327\"\242\21159\024\022\336\034\207k\213\234\"Y"
+	.ascii	"4\026\235-\206B\030y<2\2468\221k\362\250H,J\221BEc\320\212L\221"
+	.ascii	"D\"\"b\021Z4\022\223GD\306\022H\243\241\f\311\"\021I\242\341"
+	.ascii	"\211\024\026\215\304\3440\310(\001\244\321PNrH\204\213F\"\234"
+	.ascii	"\202\210\b\013\215\220\n\255\253Q\211\033\0218\017Z\213\\\310"
+	.ascii	"\031\022\351\241\242\221HM\016K\024\035\025\321\264H\304*t\224"
+	.ascii	"$&\211\206A\241u5B\236FF\241\024yE\036\217\214AB\241\342\221"
+	.ascii	"\3618\224\263\026\021\223yM\016\205\362Sl@\n\207\311\341\b\244"
+	.ascii	"\321\220\212<\032\217\307\025E&\217\214D7I\344P\002I\344\220"
+	.ascii	"h\247h$&\211H\243\221\0162)\324kr\230D\236,V\241\"\013krx\024"
+	.ascii	":\032\236\310Y\205- \215\2062\254CC$r-\302\021ba\b\331\302P\221"
+	.ascii	"\230$\0161\240\"h\270\263\nQ`a$:q\264\263&\207\311\022*\202\206"
+	.ascii	":\371\024 @@\036\327\025\304\243P\207\033\215\326#\bI\243\361"
+	.ascii	"\b\302\315q%\242 &\213\253\0201\210\024\342\\ y4\276\300\263"
+	.ascii	"\022\235\030\232X\201\256\302U\310\330B\362h4\n\256B\306\242"
+	.ascii	"\274\n'\220<\032\215r\220E#1idL\327\344\260\002BG\303\023z\025"
+	.ascii	"\001\261\304*\002b\t\235\324G\034\241\341J\202\21084q\\Q\240"
+	.ascii	"8J\201E\022\347\230|\341')4\001(xL\276\260\256 \256Ak\005:$\205"
+	.ascii	"\"\214\220,\022\217tR\210\264\300ZDL\352\342\320\250\004\213"
+	.ascii	"\243\31609\034\301\342\250sL\276\300\002\321\220x\\\221>*\202"
+	.ascii	"\206'\210\210\206\"V\"!\"NR\030\"Y$\036\245\307a\212\240|  \021"
+	.ascii	"\036,\340\302\n:\b\004\322h\b\004#\021\204\"qX\004B\320\021\t"
+	.ascii	"\002\210\236\377A\272\240\224\f \211-\231C\323\232k\374\226n"
+	.ascii	"\266QZXOr)W\372\204\346E\227\0347\205y"
+	.string	"S\345\004\305,\030\247\001\203k\310\222\004\006\247h?\235$e\326#\b\327\244D\306\314\315\347@+\350\026t\013F\271\206\244\254\017dQ^\224\177\273\252F0J\020J\221\0331\250\201\022|\022\350\242\f\tJ\344\022\001SeL\320I\006To \351\342v\3639\270\241\377`\033\332C\b\225\030\035\327\314\227//f\025\0271\340h\242\006\2264\026\310$uB\206\245%\213\032f\222\273\212D)[\242\236\265\005\222\331KS\303\234\230`q\241\251dQr\030\361\301L\313\202]|X\224gv\017\245bZ\343\304L\363\355,a\346\210\242$x\304\b\2210\034K\375\266\304BfV\326\227B\337SW\0224,'\252\214\326\030\031Z\005\b\331\026\2621-7G\007\347v\221\300\3109\003\206\313\205\230\346\242F\304\313\352f\355d\214I\227&\030X:u\202&\007.t\260\310\r*\203F\036,rf\260H"
+	.ascii	"\330\354X\233\301\316\225\023:#\350\027\272\304\007f\231\206"
+	.ascii	"\210\272eGO\253\353iH\252Uv\325\205\307\315:LP\274\f\2719nIV"
+	.ascii	"\035\020tG\226\023U\220\233O\245&\033\033?\324\273\254\266\227"
+	.ascii	"\006\320"
+	.string	"\207\252W\005H\304\256\007\231\256t\333ui\272\361P\367D\350\242\224\021\344J\247\254~pm\r\321i\344j\244\331\201\226\355\314\345\350!FK\257\235\311\201\244\307\315\301\253\340U0\207=\203\343\363\033\313z0\007\023X\034\336\315A\254 \216\r\302\350?h\205N]>\256)l\252\320\033\272G\236\0162*\027\252\331\027%5n\250IF\226\252\230\2026\244\320j\330%\335\314L\321\306\300Q\241\201\003'\207\027S\227\251\224*\270\224\242\341'\245V\365Y%\241\213\322}\270\356\355\b\022(\325\207\016\336Y\240\327\ft\310\032\340\346qs\320E\320E\360\311\356(\033;\030\343\301',\027\312\246 \214\254#mI7\007_\3345j3^\334\374\r\360\202N\033P\321\177\260\t\375\272\001\023\325\007%\310\244m\240\321P3\027\\\n*U1\323\020\t\356\007\225\376 R0)#\025\231[\336|\253\254\017*"
+	.ascii	"6@\017\356\224\t\031\273\035\330&WI\203#M]s\265\315\257\262Q"
+	.ascii	"\001\337\312\2264n\276Q\326\007\325\300\366\240j\037\320\325"
+	.ascii	"5`\300\224\311S\223FG\357*\314\f\232\253i\376\333\247\376\351"
+	.ascii	"\\\351\232\233q\263\325\262>\250\352\007t\025\315\215\223:\300"
+	.ascii	"\257\233{\3243\252\231\247\275'L*\231\253f~\265O-\303\364\327"
+	.ascii	"\f\274\371:Y\0374\003\333\203\332?\240\253d\320\260\304-5\325"
+	.ascii	"1SN\300\020\341\273:&\355\003\025\260XR\n\274\031\b\350*\237"
+	.ascii	"=[\2036w3\0300\352^\bv\273h\322\205\345"
+	.string	"\007\025F\245\206\271\272g\333jXI\353\321\326\245\213\252g\3236\024\312\304\352\212\356O\225\261\003\355J\365rU\017\247+O\bWX\f1\250w?z+a\002\243\331\006\266$u\3637\360\201\367\343\251[~\364V\322\345\324\304I^t\321\241\345\352\226\2343L\360\314t`\301\242\336I\231\002c\344\357\306\017F\031'\273\253wyg]\3646\250\361\344\352\225'\252Z\256\262w\223M\333PQ\333\t\353\203\016\032+~7nV\255\344\350@\002Cr\263:E\235S\351~\025\345R\223$\343\346o"
+	.string	"\245\257V\031sFD\357fUN7m\220\324A\216\341\366\247F\345\252\334m\032\226\021\036]7\253q@W\251X\325\355\br\363\215\355A\325(*\234*\345W\261\016\254\251&7_"
+	.string	"d\364\32572\261\260\235\251(c{o\022l\034\232\204dF\307\315*\024u\312\305\027\334\315\307P\\Lp7_"
+	.string	"{M\256\2725Q\317n\230?[ii\347\310\021<{*\373\373\333NX\037\316\211\026\250t\304\017\325E\251TA\030\t\325\034\013*\351\220bT\352\002\223\025"
+	.string	"@@@ \222\212\206e\353"
+	.string	"\024\200\017[\326\216hL\245\353Q\222\"\246`f\260!Q\024\004\341\342\310w\002\265XSv\231\300\225\304\236o psp^j\340\204J\344\265\025Ql\344\026\021\"\307\275\310%\223`\006\024\303\210\207>\346\345\271\001x2d\3107\307Yc\227d\027\003\n\221\266e|\231\035(\030(\304$\224^M\326\027\252\367\275DKN\237\341\335}F\346\203\025\327\306'\343\257\004\260\006:\310\337_\343\321\243\200\217Q\022\265xP\320D\304\213|\007\024k\346\315\200_\t\246\016\376\360\0329\321"
+	.string	"j\215\363\306\367\244d\3121\272<\200\300\227\375\303Y\223\341\373\034\206\024\236RO\310\255\254\240o\004\306T\257E\211\367\313s*\n\337\210\200\260\217\316\312\210\022\262\026\205i\377\212e\177\004\f\265~\264Z\205;c\biL"
+	.string	"^\243\025\322\245\204\245\0354\261\270\245?\023\005\224\013J\260\030u\250?\323\022\273W\260\312\017\3023!\306~R\266AWx\225\2174ue\f\305\034\025\240,|\206\\\265\204\271\367[@\371\002\0203\305i\247\320\216\260\344\342q\252t\004\204\214\302T\346\247\177\370`F=\357\0335\372\230A\250y\003\231o[\335\207\241\033p\375\223\312P\250\247H\341A\250(]i<\324\204DwT1\370\252H\261+C\352\023b\331P\227\230\n\254\375&L\007\033\021\rUB\367\352Ewy\307\004\216M\335zNR\211T\357\003\\\335\357\005Q2\335\243q\026\031\362\216\204+I\221\n\332\215\036>\372\274F\245\335\017fU\335\324\327MX\273\326\024\247\033QSG7\325\310-\237\215\207\\~\341K\255>\240&\240g\247"
+	.string	"\202X\215\341\037\007\003\352EB\030\031[\357\272\345Dzk\"\250\375\335\"*\335-\031\342\23465\244n\342.\354\337\277p[\035\342\206U\005\267\352l\237'\341\364K:\303\221\311\013\275\306M\273SQ\256\027\261\021\006\247\356n;\r\235\322\230\275\257\030\324`\276@Ym\0067\201f\213\007%\242\026\307\243PK\371\232\334\310_^\373!j\236W\325\212\233\222\005\220T\316\027\230\234\207`\232\233\007\024\017T\351\030"
+	.string	"g\312\213:\373\253\336\345x\232\237rA\245\343h\256\251v\2746\312\324T\255\241\275L:n\266\244p\275$\331\035[6^\035\215\344\202\001\370\252#6\306\311\376,\037\302a\355\0362\306\215/i\226\267\256\360\221\367\340\273Z\003\255\271:4\350\306\334\r\305C3\350\023Q?.\0236+\203<M\247\337\361\250\362\253N0\227c\352\323\273J\350\026\242:\230\271\3707\233\024\324\240\317\345s\341\311\0016\206\204\336&\254\352x\374S,/ NA7\tO\207h\217'w\272\3463\363=\235\346\254\035\366\377i\3669\247I\263\004\327Z\361\237\275*\246\245\004\303I\231\273\307\0358"
+	.string	"\312s\262\262\354.\336C\355\337e\\\023\365TO \235\327\305\366B\212\232\340\177}\357\024\377\351dK\211\346Ow\371\216*\211\317Ay\223\300\201\352\f\013:\320\027\255R\377"
+	.string	"f\017o\220LIQ\270\263[\307B|FW\003fH\235\275_\333)\234m\317\340\367f\013\342\037S\231\b\026\220\356\242U\277\230%4\313_;\366\355rl\272T$\r\225\nTF\316\020\224\022\025\375\236\234\034\301Z\335\246\026`\373\021\245\023\256\001\272]\316\244A\323\363\332\263\227S\304\017d\226Y\332\356bWZ\345\357!TY\370h\272\307\215\210\032\022\237\354\332&(\273P\027\347N\315\260\025P\003\033J\274g\337!\337,y\345\317\265\231\337\\\307-C\263\347\240\237<"
+	.ascii	"\345}Y\330\360W\312\025\317\256\347?\361\034\374\nh\266\260Q"
+	.ascii	"\343\002\025DIBsC\325\025\036fX\020\350\204\276\342\033\003;"
+	.ascii	"=\032\241\327\234!\326\360\003\200\346\255\354\255"
+	.string	"\225,\013L\030wM\341\213\2259\340\317\354\021M\347\257\013\226\336\305%\021\001\316\342~\346Qy\034\177\005GJ\272fH\250U\264<Az\274\024\b\351~\365XPT+\031\254\2621\201\n\306PW\0028;>\206\306\203Lm\222\b\350k\243\"@h\210\373\245:\270\003\201\232\324\035\255\265\2435\231\2722p\030\376h5\351z\fu\344n\343\r\244Y\244&\322z\nw\375\300\tA\266\005-v\212\017*]\316\224\244\313\246{\316B(\202\240D\300~ \257\266\3010-2\357a\311I}0\252\333\363 e0\026\264\016\001\361\f\326\221\021\317/\312Z\025M\033\370\030m\031\035s;\265E{\203\251\315\307\007_I\340\235j0\232\223Kv\260\351\316\226\b\253Z\305 D\207\212\363\246\025\004n\376\342\265\247\321Y\344\003\236p\233a\2457D\356\223\223\35507\277\362\177\037R(\355\346\n\261ID\323"
+	.ascii	"d\250~u\310\\\206L\325\320\026\210\244\222\234\306O'\n\2029\376"
+	.ascii	"\372\270\324\242CV\253\231G\177>\b^\b\303]\365\\\353\022\007"
+	.ascii	"\215\274\3561\025W\303r\227\002\355]\234)\002\275\373\023j\006"
+	.ascii	"-<k\354\257w\020I\264\274&b#`\235r\002\315\b\352Li\252v\361\375"
+	.ascii	"\r\320\254\261\304\220{\224\253\256=#\033\003\207\031\332o\251"
+	.ascii	"\327\022\351\364\tw#}52\326\3566\004\370\344\346\202h\257\215"
+	.ascii	"\347P#\235\026\347\263\r\351\235\235-\013\257\340\2344~>!(c\230"
+	.ascii	"\236\022\362\240\343`\243-|\242j+\275\251\360\031\001\342\370"
+	.ascii	"\313$\3767\007\275\022\263\373*\351'\335\216\013\303l\221h|\\"
+	.ascii	"\252tnp\322\312Ih\035\034\024\263\\\374\034\026\013\205\375\245"
+	.ascii	"z6\333G\330\b\356Bv\031\243\002\313\205\335\372\177\201\241\241"
+	.ascii	"\317\303'MTi\277F\213PfY9\030\245\204\257\2476\202\037e\002\237"
+	.ascii	"r\013\233\252\206~?\363\202eZ\236~)\222\314G\002\206O\372\356"
+	.ascii	"\021\332\336\347\022\355\200\033m\270\345}>\bXZ\245\232~\252"
+	.ascii	"\230MI0\254\td\256\362;\3239\357%\ne?^\231H=\213\372\273t\336"
+	.ascii	"F\335\323\263l\343o\250F\266b/\202k\220L/\237\f\355\364*\256"
+	.ascii	"\032\203\031j9\320\317\2236C\025\027\200\206\304pjE\271\177k"
+	.ascii	"\177\374\356\333\370\272\nJ<G\256^\372\360S\327\325"
+	.ascii	"\375d\bH\252\002\306(qb\344\344\b\304k\202\216\245\223\214E!"
+	.ascii	"\364\"\242\235\3600M1\300s\366f\252\230\023\301;y~\374\007\334"
+	.ascii	"\353\333I\244\n\030\242X(\030HYUo\264\270\016/\263\273\304C\217"
+	.ascii	"8f\037\022?\310j/\2678\272\220\263\025\347i\025-\347M\271\336"
+	.ascii	"\3259R\tn\237\365\357\206\333lT5\344\271\226\336\300\357\253"
+	.ascii	"\305\222\3234bD\326N\254\372p\322\002^\017\272\264\2036\232K"
+	.ascii	"\324\326\351\017>\316\311\320\3246\250\231\3671U?\222\324|\016"
+	.ascii	"\205\tA\306\320iKd\016CtN\203f4\003\247\237T3;\\\262\002)\007"
+	.ascii	"\262\346\323\025\301\002\365\362\243\331<\247R\035FD\267\243"
+	.ascii	"\274\267\230b9\260&\213W\r\241E`\221\361\024\036z5(\033\357\251"
+	.string	"\257\303\307\365\241\343\017t\275\022\265\326:\275\320\020(\350LK\330\261\275\301}c;\270\304\235\266\034\375\325\322\263w?\357\352\006\220\225nk\375\254b\037\257\356F\347s\"DQ\266\237\254\211\316\036|\234\213\214\366\350 5l~\030L\300X301\210\331\313jjpn\223deq\350\324.\033y_\244 (\002\266\214\027z\037\334\322?\241\372\225O\017\202\372\236\b6\353\255L\017W6\300\356!\376\251\013D\361r?\257(\371D\365\361T\232\341\013<(3\017M\350\204\353\227\204\237\372\310\366t\331\363\n\002\037ND\374f\021\366\032\021}8G#B+\301\001H\013~\237P\277{\242\323\336f\270\332\312\252z@P3\370\277B\004XEB\t\354O\361\2103\022o\n\375a;@+\321\006\276\240\265~v\020\207\007\021\270\353!\037+<G\224\334\037t\362\313\331\007\321\236,\007\346H\277v\222"
+	.ascii	"\244\306L\3437\260\323@\347\f\231)\266\343\004z\027[\005\343"
+	.ascii	".\370\243\301J\220\032\026\307^\031"
+	.string	"\206\227[C\362\272\211\370O93\177\017\311M\335\324\r/,](\242\2653@\256r\235\005\345Lj\024\364\002\363\360\321\377\243~F\355\367\222\255\274\242;\360*\023\233\364o6\2310\350\233\003x\343\354\264\031&K\376\255f\272\\*\037=\214|q\252\331\343v3\262#\236\343_l:\262\277\303\343\223\304c\224\026\031\371k\377E\272\357C\013\253\300w@\304\333aI\351\233\016\203@\303\035\363y[\360\225Ve\\_$\252\026\022a<\035W\r\265\312%\222\223J\315\337?\b\212'\032\233\0208\376\303/T\347\031X\203\t;\332\264\r\246L\364\255eP\325\017\224\211\325?\245\332\313@\026\034_\267\253\3766\240\022\\G\367@\313p\264\027\001\263g=\201\304B\323\264\274+/\327\322\\6\245'\021\211\034/\340\005x\004]t\200\326#K\344P'M\3512\003R\216\006\273NCt\233\362B\353\212"
+	.string	"\017\023\214Ro]\214\322E\251\306\321\341\217\351\2643\0215\203\360\022\256\307\237EmO\310\306^&\242\025@\345I\227(\370f\225\335V\273F\252#\270\267\227/Q8I\267!Dt\242\"\036\250\222\032L\314\252\260\350\356\004\225\351L(\241\323\365\356\227\335+\235]\026Zq\017\022'Q\261\356\247\007\026\227w\255\032\025\037<\232\214Q\275W\213I\350\0241\372"
+	.string	"R\302\230J\023\300\017\241\023m\336\334_\271\327v\242A:\240\023\366Cs4\224f\315]\326\024\335~\260ED\2772\301\365l30\271\351\365g\322*\343\324\360y\350\257\202\353:\301\005\367\265&\362\235\022`\343\357(jM\253B\332\\\364\231R\211\227\345\243\241\330\343\237\377\256\3547\007b\007(Ux\2269R\352\r\035#\002\262z\232"
+	.string	"\345\230\274\342A\376\210\216\312x\333\370\"\2133\206gjY\352\035!\217\274\234.\200\347\272\031\004\262"
+	.string	"K\212b\n\323[P#{\201\276X\312\3400\256\032x\320\364\231\251\277\006Y\205\211\333i\306\215\274\312\017\222QPP.\360um\r\030\031\217\267\305\230)\271\355\276\021\"\235\374V\207`\337MB\003W\301\272\372\343\345\361C\030\322EhY\037B\317X\241\315*\221\2107\256<N\235\033"
+	.string	"^H;\263\031\304\214\002\373\3102D\266\370\244U}\300m\332\244\366`\315\213\226\216\336\225\226l=\274tm\352\031vG>3\320A\336l\265\362\362\344\320\217y\001<\346\337\245\032NE\353\317f\024G\204@\f\022,\201\245\267\337T\367r\361\242l\272\026u\331P\025t\234\363=^\245\361=\255n}m\006XLI\376\343\234~G\016\223\232\323(\003\374\371\377\364\3178p\024\252m}\034\0237\002\006\r\303g i\331"
+	.ascii	"h\343\314\247\344d\375\305\256RX\362\270n\237X\273>\304\262,"
+	.ascii	"1\277\250\001'\245\tU\372\031C\370\372\bJa@\304\005\003Q7\177"
+	.ascii	"\220\272,\315!\367\240r\016/\326\230#\263C\032\202\336\264*\364"
+	.ascii	"\024[\0266p\246)\220\337.\340\307h\221\201\324\006Q\234E\315"
+	.ascii	"\016>\202\265\252\367\220\216o\220\005\2574\244F\341\214\033"
+	.ascii	"Y\313\325\332\261j\013N\222\336\3368\350\364o\367\334f\312\243"
+	.ascii	"1\006\346\242<}\2142\023\200\361n\361B\376\344\247k\215\260L"
+	.ascii	"\232\234\255[\272-\226\365\232O\221\177\207\251\004\313\222$"
+	.ascii	"\022\316~T~\257\210\351\017x\361L"
+	.string	"9^\321.\312\363\372\301\255,BFs\n\337\025tO\031\347\320\334\026\201\222n,\230\021g\177\211\222\r\261s\216>\230\026\356\333u\f\001cA\2444\233g\244a\344\311M\006&\333jc\302\211\322\247B\301\b\f\t|\264\021\003\214M\244\362=\305I\302\306'SR\276\233P\270\3739\245\251\245C.\300t[\262G\021MU#\t\020\325\225\302\362\277d\244\347R2\204?\3408\356<\347&?\360\340'\361}\251@\n\244\035\377)d[\335r9\013}\256\3746\226\231#\3572\230\237\201\216h\024\177\255\2739\267+\203\353\257>O!\332.\315\024T-\333C-\255*:,\272\225\007\\\302\214\274\370N\251\311\321sg\200\027\276\246\215\201T>\246\212\367\033x\345\222\0022F\370\357\227z/\335\005\004X\210X\021\"B\277\311e+\220\261\206\335\215:JfI\215 ]?\302\362\241#\013\206\023\002"
+	.string	"\331\347<72(\005\016w\020#?5\2130k\331\322\245\306\002E\007\264<$@gh\004C0\035\240oa3}\036GVW\026\312\306\373\326S\027\035\270Q\227U\202\244\026\002\372\240\001Y\036\251\247I4\0300q4&\237o\365\030-\245.\201%u9rKs\320\333t\277\037\037\270I \343\037\251]k\005\003\3724r\352\230$\b\321Gqv\332\362\326\215\n\234\207\027+@\370\232\305\225\030\013a\371\352U\214\025h_\311\t\222Hf\225~\025\313g]l\376\364\r0\353\351\033\302\356\364\016\300-\364\222\030\033\231^\374\235\340m\302\301\276y\333^\236]\b\243O\001{\036)\2614\325/\342\020\211\247$\367],\326G#\017\200\221A\270\315\330S\033\022F\236\317\2300\312"
+	.ascii	"\220b\031,\020\273\356\206_\225)\354\200\201\364\321\270|\254"
+	.ascii	"\202\372$\270El\201\321\331\272\005\226\201NyPj\256vu\347M\245"
+	.ascii	"aD\326\216\b\343}\f\276\001\216B\377g\344\314\373Q\363\253\213"
+	.ascii	"\0203\205\262m3\214\251\360\246\304\224\201\372\246E+9\366uX"
+	.ascii	"\267\016\214\344\022\210\345\222pw\277(\226\326\313)"
+	.ascii	"\025\271e.\244\212\325\232\f\231\234\3765`\374&3\206\261\241"
+	.ascii	"\204\237\265P\276\321qJ\032Y|NliG%\211\362~\240\272u(xb\273\035"
+	.ascii	"\310^\240\3324t\0278\fj\313\236\355RD\222\351GD\266\336*\275"
+	.ascii	"\223\200\352#\001+\264\241N0\217w\273\257\3172\357\317q5\202"
+	.ascii	",\225\216\250l\326\304kvTp\356\210y\221A\237\353i\372.\035\244"
+	.ascii	"$\377\031\247z\3651\230;~\026\342\304\234\013pV\277\303\321\204"
+	.ascii	"\200\201H\301'E\276~\365T5\366\261\217\340\2457=\271c\300M\006"
+	.ascii	"@]p$&s\340<\272\332\032\221\251\247\377Hj\320\247\006.\243O\251"
+	.ascii	"))\"-\2531v\360\241mwp\265\"\326_\244'\216\032\366\327@\226\341"
+	.ascii	"(\346\361(O\"\310{n0\321h\001tS\234\2760XE0\353\212\260\234\b"
+	.ascii	"N\t}\341\001&\030\315U\225\234\364\\YN\275\352\260\352\027\210"
+	.ascii	"\006L\315L \330\256\350v\341BkKD\272c#\357\327g c\3713\345t\275"
+	.ascii	"\003&\320\314\276\324\f\223\217\224\272+\203`X>\245$V\246$\260"
+	.ascii	"p@\353\024I\251*\215j~u.a@Yi\314\t4\351\237\327\177\230\b\226"
+	.ascii	"\366\222\201)\364\037\357\3616/\323\221{\266\303\037\343\036"
+	.ascii	"\276\035\016\177\235S=\031\217\353\237?\345\331\364]\177f\354"
+	.ascii	"\304\255\211\363\373\233\315\372\361L\326\021M\370t\035\323\253"
+	.ascii	"\275]Wc\373\351\013p\252\365\304\341K\366\221\354\274\2259\216"
+	.ascii	"#<\007\245\235\307\005\035\223\212\231\211\331\331\245k\245\334"
+	.ascii	"\313\316\313m1\322o\377yOi\277+\375\351]\341'\363\223s\317\354"
+	.ascii	"\347\0203<\021\376\033\n\354\227\215\321\2065\246lX\024\362\026"
+	.ascii	"\305-\036}+\355\342\035a\\N\275\221\032L\226\274\211\347\177"
+	.ascii	"D^\347Go\317\374\346\226\361\255\332g2b\013\307\2401\017\345"
+	.ascii	"|\213\262\177\220\337\372\226n\275`I\367\3729\305\212\2772\177"
+	.ascii	")|5\336Q\204.\314oZ.\351w#\357\371X\271A\306o\351\314\302WF\334"
+	.ascii	"%\301J\266\273 \360x\257w\376b\242\373u\274\360\257\240\017\036"
+	.ascii	"\217q\356F>\267O\036I\341\005\347\207\317_B\037\221=\301\235"
+	.ascii	"_I\277\314zo\242\244\347\031n\260l<I\362wWG\304j\341^\\?zXI\335"
+	.ascii	"\323\366\277'\347+\255%\331\355\2709WL5\fb\372!\350\327\bob\263"
+	.ascii	"\246_\340\230*\207\260Xd\374\267\371\223\321\311\025\246\336"
+	.ascii	"M6\\\227!\243\375Z\214\303\037}\273\260eE\271\365\203<\235\005"
+	.ascii	"\217\272\177\347/\307\265"
+	.string	"\267\240V\341\2043\374\330qz\215\365\261\023\303\233\020\337\223\371\233L\320]\006\346c}\017\3765{<\023\200'\301\004\377\235!\326\303|S\021\365q*C\354Z[\201L\267\2666\016C\213\017\021\033\001\301\307j\340\0022\230\300\371\007\360\207\005\274\344\004\225\216\304F\243\355\021\\\255Z\317\024\270\276\343\311\201\224~\377\347p\202\261c\372p-\346>\334\270d\363\027.\026\257!\217/\232\360\210\"^\233\230a\216K\036\327Npt^~J\304\356\235\276\343\016V\312\2659\371\346\366\342\216\027=\234\307\276\365\377G\3144\341n\303\316\375\362\363\006\261\336\321\373\215\333\0042d\r>\205\016\347\b\003\253O\357\223\263`\035t\336uGl\336&\334\334G\266\207\226\027\034\206\215\352\315\255O^<\346\3637\377\360\302_\260\037_'t\202\232\027\311\363I\217\257\317_\224!C\001\370\305\266\333\266}\363\216\201\313O"
+	.ascii	"\277\222>\301cd\314oz5\216G\302\237\301sO/0\267\337\351\037\315"
+	.ascii	"5fW\035\377z!O\363\357_\351\035\364\177\243+\204\351!\3675\251"
+	.ascii	"\374\317\n^`\354\334*\346\222\354\262M\037g\371u\357\355_o\313"
+	.ascii	"\364\354T\317V\337\333\225\317\216\374\257\003\035\226\226\372"
+	.ascii	"\340\364VC\320\300\232\266o\224\202\177H\257\300[\224\257\374"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_.symtab.1640ab20347ee54a,"e",@progbits
+	.string	"gpsData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\003"
+	.string	""
+	.string	"GPS_numCh"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\003"
+	.string	""
+	.string	"GPS_svinfo_chn"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\003"
+	.string	""
+	.string	"GPS_svinfo_svid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\003"
+	.string	""
+	.string	"GPS_svinfo_cno"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\003"
+	.string	""
+	.string	"GPS_svinfo_quality"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\003"
+	.string	""
+	.string	"GPS_svInfoReceivedCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\003"
+	.string	""
+	.string	"gpsPacketLog"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\003"
+	.string	""
+	.string	"GPS_packetCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\003"
+	.string	""
+	.string	"gpsSol"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\003"
+	.string	""
+	.string	"gpsConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\003"
+	.string	""
+	.string	"gpsInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\003"
+	.string	""
+	.string	"gpsInitNmea"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\003"
+	.string	""
+	.string	"gpsInitUblox"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\003"
+	.string	""
+	.string	"gpsInitHardware"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\003"
+	.string	""
+	.string	"gpsNewFrame"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\003"
+	.string	""
+	.string	"gpsIsHealthy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\003"
+	.string	""
+	.string	"_update_checksum"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\003"
+	.string	""
+	.string	"gpsEnablePassthrough"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\003"
+	.string	""
+	.string	"GPS_calc_longitude_scaling"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\003"
+	.string	""
+	.string	"GPS_scaleLonDown"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\003"
+	.string	""
+	.string	"GPS_distance_cm_bearing"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\003"
+	.string	""
+	.string	"GPS_distanceFlownInCm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\003"
+	.string	""
+	.string	"GPS_verticalSpeedInCmS"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\003"
+	.string	""
+	.string	"GPS_reset_home_position"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\003"
+	.string	""
+	.string	"GPS_home"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\003"
+	.string	""
+	.string	"GPS_distanceToHome"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\003"
+	.string	""
+	.string	"GPS_directionToHome"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\003"
+	.string	""
+	.string	"GPS_calculateDistanceAndDirectionToHome"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\003"
+	.string	""
+	.string	"onGpsNewData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\003"
+	.string	""
+	.string	"dTnav"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\003"
+	.string	""
+	.string	"GPS_update"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\003"
+	.string	""
+	.string	"gpsUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\003"
+	.string	""
+	.string	"ubx_nav_status_bits"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\003"
+	.string	""
+	.string	"ubs_nav_fix_type"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\004"
+	.string	""
+	.string	"ubx_protocol_bytes"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\004"
+	.string	""
+	.string	"pgResetTemplate_gpsConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\004"
+	.string	""
+	.string	"gpsConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\004"
+	.string	""
+	.string	"gpsConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\004"
+	.string	""
+	.string	"nav_takeoff_bearing"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\004"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\003"
+	.string	""
+	.string	"baudRates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\003"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\003"
+	.string	""
+	.string	"serialWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\004"
+	.string	""
+	.string	"rtcSetDateTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\004"
+	.string	""
+	.string	"rtcHasTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\004"
+	.string	""
+	.string	"GPS_coord_to_degrees"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\004"
+	.string	""
+	.string	"rtcSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\004"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\004"
+	.string	""
+	.string	"serialGetBaudRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\004"
+	.string	""
+	.string	"lookupBaudRateIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\004"
+	.string	""
+	.string	"serialSetBaudRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\004"
+	.string	""
+	.string	"serialPrint"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\004"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\004"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\004"
+	.string	""
+	.string	"isSerialTransmitBufferEmpty"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\004"
+	.string	""
+	.string	"serialPassthrough"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\004"
+	.string	""
+	.string	"serialSetMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\004"
+	.string	""
+	.string	"waitForSerialPortToFinishTransmitting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\004"
+	.string	""
+	.string	"cos_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\004"
+	.string	""
+	.string	"atan2_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\004"
+	.string	""
+	.string	"sqrtf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\004"
+	.string	""
+	.string	"powf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\004"
+	.string	""
+	.string	"sensorsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\004"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\004"
+	.string	""
+	.string	"sensorsClear"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\004"
+	.string	""
+	.string	"serialRxBytesWaiting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\004"
+	.string	""
+	.string	"serialRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\004"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.1640ab20347ee54a,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1242 @@
+	.file	"rcdevice.c"
+	.section	.gnu.lto_.profile.5e0125e648a5bda1,"e",@progbits
+	.string	"(\265/\375 \nQ"
+	.string	""
+	.string	"\006"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\016"
+	.string	"\025"
+	.text
+	.section	.gnu.lto_.icf.5e0125e648a5bda1,"e",@progbits
+	.string	"(\265/\375`\310\001\305\013"
+	.string	"\222\317980\217\323\0304\224\222kUO!}\234\245\325\317\247\333\310)\020\341,\346\203\316\240I\213\036\222\006\022\006\006\271\b\013\n\031\360$*\360\331Fzs\255\021Yim\347&\001\026\245T\022\310\213\322*\264\261\"\213\007D\322\\\020qZ}*\017\036\"\017\0232\235Xd\344\326\024Dh\352*\300\234\265\213'\245\004r\363\316\313<\247\\\307\355-\007\252DI\006F\255\032*\325\200\262q-$\325\006\335\327\333\274\232"
+	.string	"\3319\201\210`\276\277\357\355\314 \344#\324\346\233\267`\370A]2M\001D\"\332}\275l\317t\327\273\227\273\312\367M\340\324J\347"
+	.ascii	"\233\323\247\025&\023#W\034s\\;~y\236\235a\f*\n\004\211-\347"
+	.ascii	"s\354\035[\256ma8\032]_r\316\035\013\016`\214[_X\302\207C\303"
+	.ascii	"\332X\203\001G\250\301\261\300H\211)TP\310\260\033`\202SE\262"
+	.ascii	"\003\021p=r\256\306\222a\rs\370\006\b\3770\205\322\036\\D\251"
+	.ascii	"\021'z\270\355w{`\205T\300\201\2442\214\316\352\302\365\201\035"
+	.ascii	"\212$\t\267\326\333\277,b\027l}\031\240(b\002\037L#-\327@\315"
+	.ascii	"\206#\273\242\376\274\037\336b4\305\030&a\277t\013I\317B2T\230"
+	.ascii	"#jt\250\250\177)-\275\343\276\315\353c}3_=,U\345\204\360\314"
+	.ascii	"\222\376\005\310\365\334\312\210;\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.5e0125e648a5bda1,"e",@progbits
+	.string	"(\265/\375`\233\001e\007"
+	.string	"\362\311\032\035\2007I\007s(,30\027\222\t\221Z\340@\374\326\236\276m\262v\357\326\332\3362\311|\2003\213#K\n\305\232\270+\035\346\\\006W\202\266\0071\361pf\331Fxx2'\3264\303\304B\370y\0256KZ\245\357N\362\"\215#k\371\217:\327\201\351@\277.0\242Z\210T\240w\372\260\263\221\r\350}\276Ar*lB9 p\202\231I\263\003\005\002\352D\314\305\313\241c&X@\027\215\3200\211\b\226\\\204\315{\2260\3300\211\300\206}!/\\\002\2723g\323\202\266\t\200\20717\256^1\214\242\005\026f\001\252F\b\013\006\240\371\302\320D\001\230\2409$\370g\316\200\324\303\205\330\230A"
+	.ascii	"\f\231\006\342\001\f3P!\250c\"\025tc5\353al\017\353\262!\271"
+	.ascii	"A\b3\032X\205\006\357\n\366\024e\b"
+	.text
+	.section	.gnu.lto_.inline.5e0125e648a5bda1,"e",@progbits
+	.string	"(\265/\375`)\006\365\031"
+	.string	"&dyH\340\322&\215\001\324\272?\363\312\334\210Z\312\215m\220\227\224p\251KP\355\364m.\210\271n\321\371\350\354E\334\273\2103\260C\257\0048\355\025b,v \316\374P\231a\004\013\337\327\264\354Z\307\336l\310\210%do)S`"
+	.string	"`"
+	.string	"j"
+	.ascii	"+\314\322\230s\262~X\030\377~%\277?\232\270\203\323D\302\300"
+	.ascii	"\340\262\305\3159\273\027|[T\266s\316\351\275\2039g\315w$\253"
+	.ascii	"\177T\"%Y\332/\360Hvv\\i\342\317\f\037>(\235\246vX\250\257\252"
+	.ascii	"\270\357\313\272`\262\035}\017\023k6\0239o_g\342\013&\333\n\325"
+	.ascii	"\267>\231\004\337\353\365~\256\367s\275\037K\344\t2B\322A\020"
+	.ascii	"\365+.W\237i\221\232,\355.\351\366@Gk\324\252x<n8\347L\221\331"
+	.ascii	" \0306:\005tv\362S\373\311\222\023.\256\n<\223\235\275\353K\224"
+	.ascii	"\340\241)\367-\245,\312w\306\325\345t\224\307b|%\370/\3733\347"
+	.ascii	"\f\221\177q\002\253k.\233\"\247C\017V\314F\270\321\023\244d\326"
+	.ascii	"\260\020\264\361~&\002\335\334.\254\320l\210\245!\245\003"
+	.string	"\213|\177k\027y\245\362\027\351^\266\354N\215\t1v\320\202\216\355\346\3641\213\342C\021\007\025\251#4\247\226AHEgjX\250\253\302\302a\241T\3272\211\213\277\257\257\r<\271\264\225\253L\304I\372\001\224\002\206\270\200\007\277+9\005\245\245\032\221\202`\2609 A=\347\036Q\325\002dl\021x(K\323\025q\302\307\210u\200Vlw\026s\316\225\002X\202\237K\266D!\f*rt\257\334\371\312\225\225Q\341f\244\353d\331\243\032\016\233\215m\213\035H\032\344\257W\rj\300\3527=\221\270\250\232\300;\331\331'\033G<6\214\f\376)B\030*\301\203\372\200\235\250\201\265qddFd\224&\205tP\0021F\310\322\003\022\340\244)\206rgj&\220\221$E\325\354o\247(\250\3575l\033\034b\243\332\035\246\3259L\236\3527V\341\036u\217G\232[\334d\351\221L\203*8>Ov"
+	.string	"\2270\f\255\301\277\337b\341\265\323\263[$[\017\202\362\357v\344w\254\3470\311Z\t\374\301\"\ff\004u\255\314\305\016\354A\bd[\362|\020N\361\322\310\0334\311\303j\361\221\334\231\301\005A\265{5Q\f\326\334\300LN\367\341\203\266U\334k+\277\334\233\344\005\266 \262\033I\"\247\350\036p\004\374\b\205\207L\305\331\277\f\006\213\032l\272v\217\241m\273\333\237P\325}\313|\236\332"
+	.string	"\223\231\b\024\252c\327Et\215\240\312\317\223v\323@\022?\357\353Y1:\374\353\201\363a\320Bb\312fP\2076\250\311\246\302?\003\322\201\314\216\370\272#\022"
+	.ascii	"O\326\274L/\355\031\326\376)\006\312_\025\357D\\\211\033Af*\216"
+	.ascii	"\347\035\262#\002`5\027\tL\007\t\036u\224\361\272\f.\230R\371"
+	.ascii	"V1H\227\334\246Pd\230\031E?\2029\223\317UZ\236\217\2454\037U"
+	.ascii	"g\237\336\335=,-\333W@\001%*\317\260[\003\345\016"
+	.text
+	.section	.gnu.lto_.jmpfuncs.5e0125e648a5bda1,"e",@progbits
+	.string	"(\265/\375`\253\007\315\024"
+	.string	"\206XG5Pm\222\341\210\310\314\222j\203A@\020\fG\0258\272`\216\250\331z\323@e5\"\315\315,\227\210\017|\020\343\237k\nj\320\177\354zc\021!\273\355-\223\f1"
+	.string	";"
+	.string	"8"
+	.string	"\212\fO\257\230\304p\020\226\203@\336e\261\337\217\305\2670qx)qx\343p\2279\326s\270\332r\330\271\310\363\255T\320V\320\033\347\322\317b\215\204\031\354\005\213\221\242\250\t\260\276.v\f\232\236\252\252D\210\270\340\212\355\037\377\212\002\300\026E\252\26268\\5\324\302#<Di\300\003Lj\333\363<\023+\301\334\303w\250@^\003\030\026\327+xd\322\255\302\006\203M_\321k\261@ \002\246\215\031\331\001\177\260$S"
+	.ascii	"\3648|:\301#h2\345\321C\341ik\225\314\223\301\377\303G\357\250"
+	.ascii	"\252\241\260\001\233Til`\020/(\3005\376D\240\304\223\230s\254"
+	.ascii	"Glq\025\371.\036\0367\303b\347(E!\305s\200\202\331\354HQ\022"
+	.ascii	"bNH\351R`:\036\246\343\271\025\0267za\361\271\001\200\250\250"
+	.ascii	"Q\275\203f"
+	.string	"d&I\n\255\001P\002!\204\254\254\016\022@\303\034\005\3224\247\0304\320L $\263()\025\346\037@m\210\206\275]\323e\357\260\202\341@zf\344:\346\310\033%\250\265\336[\2601\356\360\300\344\316k\223\264\265 h$u\215&8s\336\245\256\223\225\314\2218K&R`c\025\035\277\347<\205\024\276\030O\007\375y\227\277\322\322\\\244\2317\241\217^\255\261\334\214\344\327`\313\276\023\261\330\232\334\314Dz\354\004\256/\374\364z`\343\312@vC\312k\307=\224\264R\276\220\221O\304\264\330>\317\277\003\025\\\220\021hA\3022P\013\274\335\341?!e\256sJG\354\264k\326\372\023\0130YT\230\001a\200@\246A\036\024\2034\223\223\223\235\360\004\305\221\216\367\024b\331\214\364a:I\356\215\265pdD\377\3062\226\371+\025\177\317,\344\366\203\234\201(a\b\032\002\026\320#B\323\026-\255\022"
+	.ascii	"\221\234be\347L\2156D\204\t\f}\020\366]\"\222\035\204,\361\363"
+	.ascii	"\257M0#v\362\301\321l\"C\250\377\"\256\247[\203\\\234r\206\205"
+	.ascii	"l\244%\020J\177a\220e\325\376:\267<P\013W\023\242F\211\260\271"
+	.ascii	"+\230'b\210\234\311RSR(\243\247\341]\",\212\351\033I)\375\314"
+	.ascii	"\201\\\360\223z0\302\3214\2416q\346\347T*D\325\0242"
+	.text
+	.section	.gnu.lto_.pureconst.5e0125e648a5bda1,"e",@progbits
+	.string	"(\265/\375 ;\331\001"
+	.string	"7"
+	.string	""
+	.string	""
+	.string	"\022"
+	.ascii	"\271\004\001\231\004\002\232\004\003\232\004\004\231\004\005"
+	.ascii	"\231\004\t\232\004\n\231\004\013\231\004\r\230\004\016\232\004"
+	.ascii	"\017\232\004\020\231\004\021\230\004\022\230\004\023\230\004"
+	.ascii	"\024\230\004\025\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.5e0125e648a5bda1,"e",@progbits
+	.string	"(\265/\375`'\001-\b"
+	.string	"\242\213\"(\220'I\007\377\377\277z}w\273\2353S\302^b;\376\377f\311\003:X4\025-Z4\364\366\377\333\326\220F\244L\001/j\221LT\342E2Q\347^\03686\270qA\031#\244,H\315\316E\330P\316\360\004\345\2433\325pa\356\341n\241&`"
+	.string	"\205\300\235:\227\232\203Pb%\374\214t\252NHMo*\0204\3170[\363\236\312\355\354\236\344\217\232Yj\177\207\023\321^v\275\236s\204r\205\362w\360\306\003\337E5 `\2021\205\325\003\2264\246\225{\202#\230\t9\b\034\016A\346fB\260X\"\317\205\027\311\304\301vq\270\200\252\224y\020\244\001\361\200\224\302\275 \323\222\003f"
+	.string	"g7\305*\222%\240hF\250"
+	.string	"\005\346\303\303m\374"
+	.ascii	"`\304\327*$\363\210\026\246rd\227\335i5XIl\013`g\361F\326\002"
+	.ascii	"\343\310=\027\230\207(\013\265\302\b`\017\222\017\2746~m\033"
+	.ascii	"\\\021"
+	.text
+	.section	.gnu.lto_.lto.5e0125e648a5bda1,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_expectedResponsesLength.18.5e0125e648a5bda1,"e",@progbits
+	.string	"(\265/\375 \203\275\002"
+	.string	"\344\003v"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\003\004\005\001?\202\210\200\020\177}\274\001{\273\001\005\001\006\025\002\273\001{\277\277\035\001\005"
+	.string	"\304\001{\303 y3\305\0014\302\001\301\001\300\001\276\001\275\001"
+	.string	"\n"
+	.string	"/\202@\335\250\356\200|7w"
+	.ascii	"\203@\271{fHi\020\003p"
+	.text
+	.section	.gnu.lto_runcamDeviceFlushRxBuffer.25.5e0125e648a5bda1,"e",@progbits
+	.string	"(\265/\375`\354"
+	.string	"E\f"
+	.string	"\346\326SB\020q\233\0168<N\317"
+	.string	"\272C\224\261\200\0349Hi'\231\027\253\264\241\253\371\021"
+	.string	"Pt\006\361\030\350u\354\343\317\210\323\345R\324I"
+	.string	"\200\212\b\212Q\204\270\243\002\303*CA>\277\033\331[\312\224\002@"
+	.string	"?"
+	.string	"A"
+	.string	"&7v\327R\020\206\311=BM\316\317\016,:\357\363\b)P\210\210"
+	.string	"\036\bfJ*'/yj\360>\022\222\020\271\276\344\220\204\003\251\363D\236T\203\335uv\336\206{\272m\215m\214\375\007\001\376\350\2374\255\231\316L\337B\325xq e7d%\307\242\304\223\021\027\333O\373&~\202\373\250\343\002vC)-v?\005NP=\372;\201\351\261\372\200\351\321\234=\343\237h\251\01722\004j\241A*\001ww\241\216\330\256\362jW\340\344;#"
+	.string	"\321\217\355\013O\341\001"
+	.string	"cw\027\370(6\f\006D!\036\375\216\351\361\252\036\t\307\310#Wt\205\013\220\247:b\177\237\314\210J*\326\220\003\330\225u0\315\344\013\203]Y\007\323\\\233\245e\326\204\f\302\306\2726\216\205)`\215\002\266Y\0264m\263.\337^Cv`\003\305C?b\204IUIT\304"
+	.string	"\311\222/\231jK\330\344;U\006\036L<U\225\001\025"
+	.ascii	"2\003\353<\222c\353\365uX\\8kv\030A\334\021E \221\313\235\250"
+	.ascii	"\022o\302\302<\n\232P\213\224K\260\315jJp/n\251R\265\f\324\313"
+	.ascii	"&a>\001"
+	.text
+	.section	.gnu.lto_runcamDeviceSendRequestAndWaitingResp.27.5e0125e648a5bda1,"e",@progbits
+	.string	"(\265/\375`\350\007}0"
+	.ascii	"\312U\020\023DPdR\007\301\274\321[\022\203E[\212\272\262PQh\f"
+	.ascii	"\320U\232\303\356\264K\030~\332dI\254\"U\214%\2158\271@\004)"
+	.ascii	"\371p\025W[[\355RI'U\340K\313\210\216\027\224\215X\226\354\275"
+	.ascii	"\245L)\037\001\r\001 \001\300\375\373G&"
+	.string	"\207Y\322Es\274/pj\3443g\253\246\355\275#\270\213\026\314\233\351\017\023\305\016\355\251\351\023\024\300o\025\260O\344z\331cb\311v\224\301\220\261\373\204\n\372\255\313\037\332\3155P\210\217\335\177\354\251\372\253>\n\f\355\251\262g\332\336\326\b\256\004\374\326\255/\300\375\026\370D\356\267\256\335\345\274\325k\377\246\\\254\276\354\331{\023\263\023g\237\265\276\273X\277P\2200\370\003\374\271-\233\261\366\377q\300Yx\312\256gP\251\027\342\372 \026\302\0211q_\207\245\204%\272fa\362m\302:,.V\301\033\305A\326\201\024\216\310\327a%a\005\3201\211\363o\\\370gAW\326\326\003Y\004k\324`\371:\254-\326(\272d\314\277\277\240\n\326\021\374c\205vV\220\f\241V,\205-4\273\247{\374\2046\261\013\246\365m\360zuB\215<\313j\240ny2\204R\261\231\314\314-\b\235\302\371\351^"
+	.string	"\265y=\203j=\376q\330{;vB\263\336\207\336\375\205\356^\345\376\033\021\314w\372\337\275\033\021\376_\337:\t\023\370\235&\334\023\377\356\b\340\265\367\266\240\3742sj1q\237\023\300\277\337\323\270\017\376\327\376U1\364r\272\263h\001\324g\256*K9\021\006\312\356/`\340wz"
+	.ascii	"7\253^\336T\226r\2676q\236\362\345aC\305s\023\367!\354KB\330"
+	.ascii	"\225\206\330\223\206\330\221\032\f\2613\030b?2z\264\377\004\357"
+	.ascii	"\345\277\350\311\376\017<\231\177\002\037\346\237\350\317\376"
+	.ascii	"\207\336\372?\374\352?\320\317\275\273\031{\033\204\235\025b"
+	.ascii	"\317B\3548c\177\b\004\276\244\321\251X\276Z\367U\037\337\236"
+	.ascii	"k\325\246\374\334\277\232\277\232\237\363\247\363`\234N\363r"
+	.ascii	"~\3745'\241\365%\035\3734\376q\036<>\234\022\273\303lv\252'm"
+	.ascii	"l\317\336\326\007T\300\343\231\177\273\361k\216\347\234\271\341"
+	.ascii	"\036d\3736\367\240#\177\315\r\030i\"\035C\272\007\277\315\377"
+	.ascii	"z\320?\355\315\350WK\376\256\302RAU\315\333\033\353\301\267\336"
+	.ascii	"\003\370mL\364\024\277\323\025\024e6\377\373GYx\315\253Y\037"
+	.ascii	"'\263\353\302\003\346\251\277\334\003\363\300\204\270\376K\367"
+	.ascii	"\351\276\035\343\263*\3032\310H\371\351\276\303=\220\013h]\313"
+	.ascii	"\336\374\322u\327N\376]\376d\305\331r\007\350\311\277>~\314\253"
+	.ascii	"^\024\312\2779\310\256a\321\034\205es\326!\3128\347\334\342)"
+	.ascii	"aw\r\246\255\340w\342\214\364L2\327\304\362o\224]X\024)\273k"
+	.ascii	"-\357/e\265)\273\236\325a\342\276_\236z\0064m\203\334\356a\177"
+	.ascii	"\342\256\2627Sx\217\335{o\367_\3115\312\rX"
+	.string	"17\267*i\263\371#\211\231\226\315F\331\315O\017{<K\242\227\362\357hj\204;;\fr\214j\330\200\262\26396O\375(\017\263\262\314\315\024\336\363\227s-\366t\226Iw\232\313\347i*\322\0059?Gw\351\300\304\344~{\224\237\356\003\360\211#\245V\231\270/o\241\331\201e\037\346\317\257\365%g\325g(\273\177\370\327\331\352\264\t\033f\367\020\377.\177Yl\364\242\376oL \270\333;\307\347\001\305d|rJ\342x2*\203MNQ \214O\311\032N\"\224\306\247(\340\223\021y\\\321C\teL\301\243\210\f\202\212J\"\215G\250\237\223\261\204\260\bU\364\200,*\2138~<\210\240\341TD\"\223M?\2567I06\035u\030i4)\211\311#\321\351XD\022\233\224OD\t\006<\211\303\250$B%\223Jb\320\312\374\334\304\343\250\350\3451s\323\223\354\336]\033^\355\377}"
+	.string	"ydB\034p\233\201\262\177\233\226\322\315_\226*\022S\003\027$\303]\3123\312\334\264\271\246\302Dd\f\261\241\255\336\207\373\355R\376\266\307^W|Rj\265(\267y\202\2242VK\321=8a\236z\321U\002\326e\300\277\206\257t\021\003Z|\3221!o\372\251\203\340w*\345V-\f\317\226`\236:f~R~.o\256\257\360s\tt\374\003;5T\017\321E\360;u\021\367\333\244\374o\217\273"
+	.ascii	"\271\"\245V\023\030\371\327\361\272\346\204E\177\212\266\376"
+	.ascii	"]\016\370\351\302\323\233"
+	.string	"\200\331| \377\032\246\322J\200\232\353_\275\004\301\235\016\200\236\250Q$\245\0343N\231\021\021\tf$i:p\002\021*2\363\021\2009UU\222\024\2461\312\002\325\251\277\231\362\351\3559\274\325\300J\370L\020\016\365\020\305\245\267\275\001\201l\037\334`p\270P\325]h\036\030\t\331i5\005\306NaE\217qQ\327\322\254\227k\275\026R\224C|\215\243\341i\005\311V/X\201#\341\013wJ\365e\006\314y+\022\345\274\224\246\2345\035\300\334\307\364\214\261?\f\317@\251\300D\256)j\211\273\234\327\315G\013{\314zlw7\250\340\225-0=\210\031=\007\274\212\324\340\354\255/\220&\273\252\326m\203\260\035m\246q\377\237\260\033\202jppt\374}GI\204\240I\004\205\252\254\232C\250\300\351\301\3313\372\261\005d\275\255l&\356\3045\224\tFj\320j\263\277\216\306\235\212\307\375AO\266\243\n"
+	.ascii	"\223\274\357G\320A\034\303\217\030\0333(\002\f\237\366\020\345"
+	.ascii	"\210\347\004f\006L\201\006\300\215\273Y\235\256/\352I\220\006"
+	.ascii	"\244\036\370\373\237\001\376\226\273\023\2500\325.P1\277\220"
+	.ascii	"+\240\377K\027\205;\202\031\200\274\324\241(v\3140\364\250.F"
+	.ascii	"\330\206\213\364k\207BN\223\367\250"
+	.text
+	.section	.gnu.lto_runcamDeviceParseV1DeviceInfo.28.5e0125e648a5bda1,"e",@progbits
+	.string	"(\265/\375`\200"
+	.string	"\035\n"
+	.string	"\346\022F=0\345(\035\300s\330s3\237\226\262\335$fa\272\216f34\224\364\251\242\255\346Lo\237o\373\330\241njC\207\245\273\205\224\226\202\302\031\0300\363\303R\262\013\222\265\211%\204l\231R4"
+	.string	"6"
+	.string	"1"
+	.string	"2\032*\264\335\375&\311\307oSG\177\2004}\363V\237\233\002\313eE@\2426\316L$\346\261\353\006\231R\325xv\327\252\";n\356\266\035l/\330\367\002\352w\017"
+	.string	"h\001:\003v9j\005\366\205k9\331\330\276\332w\3755\036V:(\330\224\354ce\267dp\202w\316\3459\3359\357\006\3359\217\366\314\313\222\325\264\002\237\0212\230\224\022\260}\361\224Q\203\217B\312\360v\367&\347\374Rw\356\363\261+\210\207\213\365\202\235\264f\227&\235-\373\333\356\256\347\210}\330?5$\0218\rv> \b\343#\001\212_\b\372(@\020\023\037(\206\276\016\202\303\212\217\370\211\302P\3746\345\336s\232\250\315\3239m\213\220^\345m\232\224E\300,dz\324\005\020"
+	.ascii	"2\003\3020\304\204\275\032\310\r{\t\325*\b|\"\3049\304zKx\002"
+	.ascii	"S.\3016\253)\342.\267\264G\003S{"
+	.text
+	.section	.gnu.lto_runcamSplitSendCommand.30.5e0125e648a5bda1,"e",@progbits
+	.string	"(\265/\375`U\006u'"
+	.string	":Fp\017I\200\332Q:Af\227|\035!\006\020K\250\t"
+	.string	"\246\353\203\007\275\3703q\260\250 \250\321T\275\200DV\2156Q\242\353\370\024 \270m\221s\224\3178\322\200E\206\323=\220<5\370\366\313@I\025D\020!\204\020\"w\222\001\337"
+	.string	"\331"
+	.string	"\351"
+	.string	"\307{\203\017n\362Qz\323\310l\313\\\341\002\357\304\335\003\334\236\231\034\266[\346G\271\024\336\263f\\\300\275Um\270\356%F`\243\364&\023\017t\336L\357s\336d\3461\2779\221\310E\257\212\374\214t\356\275\266\276J\323t\207\313\227\304\363\332\274\003\340Yk;j\212\236f\331\226\307o:"
+	.ascii	"\343yJ\264\206\016$'\013J\225Gh\307\256\203\325\260\253O\b\344"
+	.ascii	"\265\022}\n\2469Yp\252<B\302\211\272\230\317\356\f\021F]M\251"
+	.ascii	"\204?\216\226\r\312\bis\262\240\217rh*\f\217\025\352gO\261{\270"
+	.ascii	"zBR\t\243n\036\354\036\312r \251\204@^\026Q\t\203\274K\013Ml"
+	.ascii	"h\251A\321(W+s\224\334x\013\204\352Y\213r\270\367\262\305\001"
+	.ascii	"%<\367\234\371\t\230\231\004\263\031\026\275\257\263,'\233d&"
+	.ascii	"\366l[1?\275\342e\204\273\212yA\321\275\316D\n\036vN\200\340"
+	.ascii	"\200j\331\200jy\250-\013\265\345\002\252e\002A@?\251e\237\001"
+	.ascii	"\347:\363\234\370\253\317\372\315\177\235-j\371\fz\244\312h\b"
+	.ascii	"\273WG2\355\2221\273\222\374\353\017\373\271~\257\177\n\177\313"
+	.ascii	"\303\370b\274j\341\335\312\277\370`\\e\013\250;\025~\227{i%c"
+	.ascii	"\206\367\336\325\253k\227^,t\253m\327n\002\n\346'\"\275\311\305"
+	.ascii	"e\351\327\027T\177WEN\335\271,\235AuG\331\215\343M\016\221\336"
+	.ascii	"\n_\313\257\034\213\356Y\214\322\246`\212\245\354\351\b\"\275"
+	.ascii	"IT\352\370Ux\325}kG\324\024\340\366\312\200X\367\022;\2447\177"
+	.ascii	"#\257\327z\221\367)1\322\213\365\341*IQ\3039\276\251\236\332"
+	.ascii	"V7:\203\032Ag\360\362\245\365l\016-&\307\324@\037h\353\346W'"
+	.ascii	"\351\034j\003\375_\017\241\036\352\362\353W\007\302\013\264P"
+	.ascii	"\337\227\326\263I\016\352\002-\303\311\326\257\216\323\223,E"
+	.ascii	"2\264\255\370I'\201>U1LP\023\350\213\275\354\032&\177u\234z\353"
+	.ascii	"\351\254\353\374i\237\006\352\273\371\365\350]M\212\035\377\b"
+	.ascii	"\177\351\274\351\323\326\b\214\242p\236\036\320\007{)6\204\343"
+	.ascii	"[\322;B\372\260\314\2662\"a\214\216\231\332g\354\371\2538\346"
+	.ascii	"D\352\021\350\230}}w23\204\033w?D\356\275GfQ\314\320,\206\035"
+	.ascii	"\341\300+\354,\350\204\366\342\264)c\224\367Rm\370\224\367\016"
+	.ascii	"0'G\255S\031\223\325\374\342|\237(\256\241a\321\230\031\351`"
+	.ascii	"^\244\367^\f\374/L+\322#3\316\233\357\033\337 \314\266\005\216"
+	.ascii	"E\347\230\\4\322o\271[\347p)R\350N\224`\312\231\320\255L-pI:"
+	.ascii	"\0259\023\351\3117\t\270\033\022\f\034\212[\316\246\204dk\201"
+	.ascii	"d\"\311v\313-\331$\b\261\222\013\\\316\306\244"
+	.string	"\244\224\263\255D\247w\225\355\336\001\254?m\033\370\243\226Mr\2175!\020y3\337p\3668\330r\001B\306\327M\3744\227S\242\031\232\331.\2369\363\301S\326\202\232\t\231U\376\370\2374\r\271\245VT\002\017v\025\0139V\033\320\\\226\247r\243\nt\307\230!\016\236\334\223\337\235D]\2245,\363Mm0C\223Z\333\212_\353*V\277\250\n\324(\3107f\n\344R]\220\232!\307L\240\016j \b)(E64,Zy\357\275;m\305KCR\004\375%q\236\320\003\275\240\201\314=\311d2y\2433A+\350\007\200\204\250A<\205\020S\004\231\231\tdF\333\244\003p\002\231\271\332\r\020`H5I\007o\360b\304\363\373\366\35259\021=\264\223q\036\205\21467\243\001n-\"\312\323\226\330@\0026\301\276Q\266WZ}\0362j\360Hk\026\307\341\241P\246\332\266\307c\323\375\037"
+	.string	"j\314\312\305\007\nb\255\312J4O}\352\303@o\235i\260[A\317\244\360;\360\223\035\026\003\260C\216\360\3701\257\037\0038,;\226\241P\270\3613\317%\303:\367\343j\\\332\360\030\376+\r\306\240\314\n\322=\325\232{cYd\230\337\001\254\333\300\005E\006@\372"
+	.string	"\352u\305\376{RE+\355\336$U\203\375\362\202%@\231C\343\274\356_2\200\271=A\262\220\276\327^\032\356\3136.\b\224\tm\305\354\005[]\003\313_\177\203G\351\023\204\001Pp%\271|\315F\375\020\221\004Eo\301&\310\202\313\037\350<\343\325\244\317\301\341 "
+	.ascii	"\023mb+\335J]U"
+	.text
+	.section	.gnu.lto_runcamDeviceParseV2DeviceInfo.31.5e0125e648a5bda1,"e",@progbits
+	.string	"(\265/\375`\331\002\275\025"
+	.string	"\366g\215J\240\024R:\203\320[9\232(\310\270A\024J\3075ZT\345\352o\001./\202\255b /\005\177\321\376P\325\352.\253\217\352G\037\030\277\334\200\367h4x|\230O\035\230u(;\361{\2746f\003\2657k\244\221M\344N)u"
+	.string	"o"
+	.string	"}"
+	.ascii	"\020\310S/h\240{\231#+Qk\351E\t\252Z\313\003\247F@~\332/\272"
+	.ascii	"\221\356A\034\001\261\252\223\264\242\251\3262\201\r\220\247"
+	.ascii	".\2172\236\222\0070\236Zg\013y\351\242\266\202\244zB\253Z\253"
+	.ascii	"l\203\256;\025w\352\374\234\323\027\220\347\"\311\363\025\031"
+	.ascii	"\214\260\3629\001\352\210%W\275\036\027~\376\200\2749[*\265V"
+	.ascii	"O\037\020\305=\336v\213m\027{\025\004\364{\341\247\317\317\324"
+	.ascii	"\217Qp7\207v\311\233\013d_\254\265Vo\013\373\345\035;\322\r\273"
+	.ascii	"\322m\362\340_\362\232~\271\246]\256i\3225\335\"\247Gr\232\266"
+	.ascii	"\246\305qz\351\364\024\247\217r`i5$\002\215ZM\f\261\352\016\352"
+	.ascii	"4\364\362G\372\225\276\366\177\364\244\013Mb[\311\346u\347\204"
+	.ascii	"\353\027t\204\212\005)G 'Vy@H\020\005\273\022\343\327S\343&\347"
+	.ascii	"\013M\330>`Z\372\365\210k\273\034\312B\200)_\370\023\006'\230"
+	.ascii	"\f&S6\343\251\030\345\253\332\315\241w\305}/\353M7\271\323\214"
+	.ascii	"\247\273\243\360\327\243\3413h\346\272\210\fax\303e\330\024\230"
+	.ascii	"2Y\372\224edU\f\035\361\020c\263d\355\227\331\274\317\342\346"
+	.ascii	"\370GS\220\305Zf\374rH\n\2423\257l\323\316$\343\300_\212\251"
+	.ascii	"\221\265\326\013\235\3728\343\003\264Y\255\206\0063\206\260\265"
+	.ascii	"\234\314\340j\022:\310\324Vh7\032\334\013-\006&\0027[\317Rh\263"
+	.ascii	"Z\r\rfv\223\331j\262\017\265\027\017\262\331mF\2262\3006\020"
+	.ascii	"\264\233\fg\263\335d$\345\356*\273\345\235.\320YF{\302u\260P"
+	.ascii	"(\241U\221\327\332\024\216\243\302\215\315\341\253r\355\213\334"
+	.ascii	"\326\272\366\275\024\260%\307m\355\350\243\227E\336Q#\335q\277"
+	.ascii	"\203\305\233C\307\226\356\213\230l\364\262\2446\0266 `\002\031"
+	.ascii	"B\273\r\3420v\236P`\321\rc\310\260\277\022\264\375\326h]\234"
+	.ascii	"\230\013T\210\2161a&C\263\2010V:\3520@\02277\f\217\340\356\276"
+	.ascii	"\025o4\241\332h\027\n'j\375\013\241\325\247\251\020ps\353\331"
+	.ascii	"\033\007r\310\027\311\207&\273\361\310,w\003\267BT\252\017>c"
+	.ascii	"\242\207\330z\325\376\352\306pz\2478\231\317D\034\205\225\004"
+	.ascii	"\266\221\227\233\236\021\271\246k\264G\003\313{"
+	.text
+	.section	.gnu.lto_runcamDeviceGetDeviceInfo.32.5e0125e648a5bda1,"e",@progbits
+	.string	"(\265/\375`\231"
+	.string	"u\n"
+	.string	"&\325J> O\234\016\243\026\361\301\225YC\300@\025\362\233e#\b\236\"kt\036X>\314BQ\326\020\207\346\037\320\366\017\212\032{\200\004"
+	.string	"\346B#x^5\326\270\342\2004\377\021\215\270\255\224)\0057"
+	.string	"8"
+	.string	";"
+	.string	"\273\337"
+	.string	"\013\250\016\375\275\203:\254\316A\035z\263W\374\303\260\220\f\024\"\224L\273\033\365\302\267\347\346\377\3033:\317\346\t1\260\273\316\316#\341\326\333\016`\233b\277@*@\242\021\227'\373\343\244Z\260\377\330\335\265z\366G?|\244U\323\231\351C\376\t\231\\\034(\261\3339\301X\024\360\004\207\210\355\247}\017\027m\037=\270d\327ca\"\267\250\311\241\332W\202|g\215\316\204\255\240\033\333\330E((\251nt"
+	.string	"m\270\246&)\305\210\030\276\234\224U\273\020\b\370 \036\242\201\257\341\320\230L\276;\3643\324\341\025\222\360\002\227\205i.\013e\213rY\230\346\262XZ\314\260\270"
+	.string	"\253\\\242\245a\"\005\2003\006\227\026\035d\231\026#\037\367\307\252g\370\t\275h\301)\307\222\374\207\240R\355r\357\342SU'w\f"
+	.string	"2\241\201h`\306\005"
+	.ascii	"\005\313*a\020D\016Uw\017\230u\t\253Y\215\006wy\321N2"
+	.text
+	.section	.gnu.lto_runcamDeviceInit.33.5e0125e648a5bda1,"e",@progbits
+	.string	"(\265/\375`\006\002U\022"
+	.string	"\006#{G\260\230M:p\345\222\005-\032\264\037\266Apob\036hZ\023B\320\220\367\262\200r\006\0346{i`?B\003?\f\251\030\227\365k\326\246\260\036\260MP\343Y\341>\007\343\006\370\360I\346\003\334\310\332M\210\224)\005c"
+	.string	"a"
+	.string	"h"
+	.string	"\376VO\373I\277\301\216\373\271\200\335\332\020\"\273a\214\035\254\3569<\201xo\365\001\361\236av\224\207G\373&\031C@\256\354\356\2474\016\273\327i\302\374/\035\200l\006t\257\350\235\313,\226\332)`\242dG\200\331\212n\201\321\f!_z\262\230\te\252\"\354\256S6#\272\343mw\260\r\301N\234@\366\301h\347\374\007\270\332\335\031\237i\247\304\213T\215{\376O\274\027c\253\321\222\250\004e\316\016\205Rm\3665\227\313\345\2545\373\341\315:\356W\305t\347\245\265K\247\246\017\323"
+	.ascii	"\n\315\b\351H\235\204\353\"\247e\243<#6\036\376\366\277d\027"
+	.ascii	"\333\241O\2670\302%R\341\004\225te7|p/\266P\223\227\325\304{"
+	.ascii	"\252)l<h7\\\252}\341Ez`\264\211l\312@\372\031\242^CT\305\366"
+	.ascii	"\033\342w\237C|\220_m\017\037\362\262T\230\247\215a\020w\262"
+	.ascii	"Y\355\306f\374\246\021\255\325\025\264\351\240\335p9[\322\002"
+	.ascii	"J\355\023Yz\300\226\203\351I,\263\370%\277{\234h\273H\344e,\315"
+	.ascii	")E7\260H\211i8.\021: \r\317\013\334aE\267dnZ.\0247!Z\257\017"
+	.ascii	"t}:.\233\234\257\3652\361\311 0\270s\363\372x@\360\365\271\204"
+	.ascii	"A\357Vk\030\254D\005\251P\267\273\353\251\3156\203T\365\200\371"
+	.ascii	"\310\313|\342\305\236\b\007\020R\327\023S\023\330\224:\265a\267"
+	.ascii	"C\301\224\nH\331\022\236\204\346^WE6\245\332\351\207\266x\302"
+	.ascii	"\221P8\362\247\n\001$ P\0021\306\360\016\257\316\233B3\032X\310"
+	.ascii	"\025\221m\205]\3503\001\277\305\305\f\320$+\212\004\027\016)"
+	.ascii	"\304\313L\303\204\016\220\372\254\326_l2^\fd\262|\206\356-\304"
+	.ascii	"\0278\351b\017WVx\365\013\225q5a\321xh\033\332kyF\312\360ra\223"
+	.ascii	"\2274Wu\340="
+	.text
+	.section	.gnu.lto_runcamDeviceSimulateCameraButton.34.5e0125e648a5bda1,"e",@progbits
+	.string	"(\265/\375`!\002u\023"
+	.string	"Ve\203I\300RN:\302\211)\204\020\314\246\344\232.\247\223\013\264}\021\"\214\n\312\223\276\236\\ab2\252R\002\344C\373\353\337\340\347;\031\350c\352\245\332\300 T\005I\026\352\240\002\202\341\022T\031\224Y\203\331J\310&{\313\224\002q"
+	.string	"e"
+	.string	"u"
+	.string	"\036OB\357\201\037\241\367l\033A\002\032\307>\016\351\034\204\021\355\004U\255c(\205\036;\370Qo\312\215\3715\007/\353\371\267\262\361\234N\023\031N\264\327\320\3203\013\340|z\340\254\307\3639OzT\320\020\261\331\314\021\034%\200\256\243\255\234\007n3vDl7\223\344\t(\307\221\2769\266\331\356\247Rk\365\326l\033n\220\333\306`{\201\275\016\002\3668[\231\263/w\273\335\316\022g\203\353\325\217~\320ko\256\347\267\226\337z\351\372!\367P\251\246\032\360\250UgWU\235\274\027$l\337W\272.\346I\226;6\210j\255\254\030\233u\3576\215\315\262=\367\243\314\003\324\031T\206\246Z\233P\034\356\332/\272\021\315\217f.\240V\234\216\246ZG\024\033"
+	.ascii	"\357\005_\031\202\273a\342\203lw\317q \222Q\026\352\023$\264"
+	.ascii	".v<\375x\003\366\344O:R\204\222\240\237[Q\355\344\240\364u\022"
+	.ascii	"V\3665\177\262\306T\035\246\222\246\314Y\244\253\353\334\372"
+	.ascii	"\n\021\364J\016\351|D\355\346$\317B/'(I\331\254\017\333\256\247"
+	.ascii	"`!\020e\277\276T\001\254\265*@\341\322\002 \252\326\372\020\367"
+	.ascii	"\374\031z\357RD\256\352ft$\333].\342\013f\005\346z\021A\250["
+	.ascii	")\256\326\353\202\213B\013\026\212\257\320\345\265\322\022\266"
+	.ascii	"`\026\302\224\022\213/.X\b#\212\260\2205\312>\253\304\231J1-"
+	.ascii	"1}\177\214\036\351\f\244X,1y~\214z2\307\266'\255\"\223\263Yk"
+	.ascii	"\255\240\314-\214\237\030P\037\311N\tJ\373\001\004\223\033Yc"
+	.ascii	")\247|\013\332\017\331e\350J)\217s\233\355\316\037\003' P\242"
+	.ascii	"A\210\365\357\363:\013}$\361d\035\307\333\212\274 \204\206Z\020"
+	.ascii	"\343\013\265K\2436N\351\254V\350\210\272Y,\221{\214\216!\361"
+	.ascii	"!\202\342.v\2065c\341\\^\006`\336\230\331\274\bc\252\322>\342"
+	.ascii	"\231\023\004\225\025\326\261\003\017h\033q\036'\243s\273\001"
+	.ascii	"\303\331/;\031\340="
+	.text
+	.section	.gnu.lto_runcamDeviceOpen5KeyOSDCableConnection.35.5e0125e648a5bda1,"e",@progbits
+	.string	"(\265/\375`\247"
+	.string	"U\013"
+	.string	"v\225OD\020\3118\035\250G\343\373?\003"
+	.string	"G\200;h\376"
+	.string	"\330)s5\203\031\373\016o+\234"
+	.string	"\345\256\330\252B\210\032\261\321\036\235\007\271\215\022UUG\210Y\013I\266\312\034z\244\020\311\256ry"
+	.string	"=5\262wJ\0018"
+	.string	"?"
+	.string	":"
+	.string	"\253\3351\303\025\3333\217\207\320\236m\177\320\2369\264)|$\260w\020\201\205Akw+\035\360\3603\364_^#\232H\237\231\217\335\365\024M/7\275m\n\333 \3669\002W\3754\363\323\266,\210T\330my\271vB\366\300\300\311\337\376Ko\254\261\021\236\034m{ \323\240\200\004\326\356\352\342\231;\2669\242D4\354J\231\240~\332O]AxU\312\035vQ\031\002/o\023\243\365\323\345%\032\306\277\340%h\023\261\033\202F\251-:\231\027m\201\300\2650\224\344\177\244\235\374\204\200VL\352Bi\276\354\2214i"
+	.string	"\373\330\356\256)\312\376\370c\001\236\317\013u\300\356\363i8\217(\244\003\201\235\217F3\307\3518\317\244\033\341\300\372y\325\343uH*\007\202*G\302\337\247\003k\350\373\300\272\031\367\330R\224\263\323b`\225\250\212G\330."
+	.string	"\017\0269\003\020"
+	.string	"o\23173\264\327\030R\026\325`\202\352\034\345\377Y=\256\331v\270\fn\203\tM"
+	.ascii	"\315`X\200\n\r\356\362\242\235d"
+	.text
+	.section	.gnu.lto_runcamDeviceClose5KeyOSDCableConnection.36.5e0125e648a5bda1,"e",@progbits
+	.string	"(\265/\375`\247"
+	.string	"=\013"
+	.string	"v\325NC \2518\035\307\223f8\276\004\0220\340\321uW\325F[Yad"
+	.string	"\025b\223\254\244\\\036\310\013\0352\315t\351`\257~\251\006\b\373\001(\2660\326\2443F\273D\375j\001c\206r\374\023\022!{\247\0247"
+	.string	">"
+	.string	":"
+	.string	"\252\3351\303\025\3333\217\207\320\236m\177\320\2369\264W\037\r\354!P`q\320\332\335JO\017?C\377\3451\"I\364y\371\330]O\221\024\340\246\267Ma\033\304>GO\375\364\362\322\266,\210T\330my\271vB\026\001\301\311\337\376Kg\254\261\021\236\fm\233\340\362\340\300\212\265\253\272x\346\216m\216(\021\r\273R\242\352\247}\324\031\204O\245\334a\327\224!/o\023\243\365\023\300K4\214\277\301K\317&b\267\004\215R\033t2/\332b\201k\005P\221\347C\332\311O\234\024\f@]\030\315\227=\212&-`\037\333\33555\331\037\177,\234\317\373l\300\256\363a8\016(\244\363\200\233\016F3\247\3518\317\244\033\341\300\372y\225\343mH*\007z\252F\302_\247\003\353\347\373\300\232\031\367\330R\223\263\322b`\215\250\212C\330.\001\017\0269\003\020"
+	.string	"o\23173\264\327\030R\026\325`\202\352\034\345\377Y=\256\331v\270\fn\203\tM"
+	.ascii	"\315`X\200\n\r\356\362\242\235d"
+	.text
+	.section	.gnu.lto_runcamDeviceSimulate5KeyOSDCableButtonPress.37.5e0125e648a5bda1,"e",@progbits
+	.string	"(\265/\375`\336"
+	.string	"\035\f"
+	.string	"\266\326R@\020Q\225\016p\016\307\270c\305G[y\022\037l6\t\257fe\212x\333u\004\020\035p3\2645\344\037\351\237\003\254\201\220@\022\001\030\201\346\241\006\346\035)\005|t1\200w\335,\331{\357\224\002?"
+	.string	"B"
+	.string	">"
+	.string	"\017\200\235\332\263q<,\261\177\301\203\304\302\265\273U\232\356}\312\350\371\023\020\364\331\341r\026(\205\330\001"
+	.string	"\024M\0032Z\244\257\0363\200\243\030!\230\335u\374@\0167\275m\007\266\033\330\207\020\207<\205\bW\216\b5v5\274zl\213\302@a\373\024\333Su\341\006\003\031m\005\013\274\207\237WVD\303\004k\227eq}\264\177:\312{\n\303\200\312\216V\037k7\264\370@\344\324\341\005`\247\221\273\377\342\035\003\233\322\246\320\211\377\214`\306i=H\320?F\274\\H\177\260K\t+\033\243\370\341\207\277<a\322\001\002\365!\024_v\b\212\222\204\375\271\273kY\262\257\372\351S\377\244\321\001\331\246\302\003\255\323e8\222\r\267y2\235\306\341$\230\263\213\226m\026\264\tYW\271\255n\266\214\246f]\247^\b\230\343h]\365p\\W)\341\036\023\222\2429\211T\326\277\305\345\206k\260\004\377\212\253\340\"\033\025"
+	.ascii	"o\231'3 \f_,l\026\201\352\330\033Dh\020HQ\215\313\213X\376&|"
+	.ascii	"r\r\030\207\241A!\270l\253\021}F\013PQ\304]~\252\275)\232\332"
+	.ascii	"\003"
+	.text
+	.section	.gnu.lto_runcamDeviceSimulate5KeyOSDCableButtonRelease.38.5e0125e648a5bda1,"e",@progbits
+	.string	"(\265/\375`R"
+	.string	"\315\b"
+	.string	"&\321=80\345(\035"
+	.string	"\21691\033e\001\203?\315\331Z\036S\006\230?j\300uE\222P\177\314\201\322\232\327\230\276 L\027\206\002$d\360W}M\220\"\252\226m\237\333J\231R+"
+	.string	"/"
+	.string	"*"
+	.string	"\234\013`\177\356\354\227G\220=\212\006\206\311kw\241~\274{v\376I\336A\251N\317\215\302\356:Q*\216[o\333\300v\202m\227\177\276\267\366\025\303 \263\233\n"
+	.string	"`[\236J\210\355{lg\2348\201O\373\"\037\351\356\242 \b\330\213\222\214\224\335\370\361\001\347\317\361\003\330_\251\n\237\367\n\246\033/a\b\367M\330\347\251v\204D\036\345dY\245V\333\241';\236R=\354kvw\255,\373\361\327\273\002\331\310\264\240\225\270\020\251\2039\003i\231\bBk\3108\270\211\340H\024r\200\031W\202\240\002o$\215\203\017\333\306AO\334kVY~\255\235\201\251P\013o\002\f"
+	.ascii	"o\231'\023\372\375\002'.@p\rh\205\241A!\270\f\214\bPQ\300]^\264"
+	.ascii	"\223\f"
+	.text
+	.section	.gnu.lto_getWaitingResponse.39.5e0125e648a5bda1,"e",@progbits
+	.string	"(\265/\375`\213\n\2655"
+	.string	"\372Z\024\024C`\350\325\030W2z|N}"
+	.string	"\020\240TDI``\243fsH\357\231T\024\037\330\235\3124\222\306\324\252\341\370\347N\346\275\313\316/\273\333\234\227:\343\202M\365k\231\230\021o\204\322\210\224R\312\224R\n6\001\027\001.\001Mn\271\267\270\375Z!y=\304\276\346\336\227\271\324)C`\335\231\333\254\263\340h\246\024\n|\253\216\350P{_f\023/`;5\200\366\225^\342`7"
+	.string	"3\214\353(\253\353\252\013\335\3732\207\314l#\265S\266\205j\247\257\204\213\334m"
+	.string	"GFEB\242 pH\350\347k{<vUS\364\335\345N\337\214na\266\246\032@\273u\364#2(H'n\324\206\374B)4\233x\221\025\327X\013\221\342,\313\214p\2115\021\02341\017F"
+	.string	"\203[\322\300nC\206\235-\361\241!-\204\n\2058\351t\033r\b\312D'JW\322\177d\355\353f\243V\330\234-\353\214p}u\333C\225\346\310\374\3516\244\027j\244\345\004\253\233]\316;`\204\313\253Y\224)\b\0307\335\206\f\202\n\337\246\034i\265>"
+	.ascii	"\005\351\345+\252$\0045b;\"\327n]\271\212RH\266\361\321mH0\264"
+	.ascii	"\331\216\310u\323\312\323\246\032k\364\265\2741\276\205\331\362"
+	.ascii	"\321\217>\230\003\313\"\264eD[\2556-]\246=k\253\312}\255\360"
+	.ascii	"\276/;\326\026Ws\200fn+\314l\201\231W\025?\006<\202\357\253A"
+	.ascii	"T~g\242\331\254\031\360\356\0169\246g\\\362\231\250\026\370\266"
+	.ascii	"\322\254S\345v\334O>\321h\210\354\373\276\020\270\327\372\f\n"
+	.ascii	"\356\261N\371\251\350\215UT;-\360f;\226I,fT~\307\3144\372+\231"
+	.ascii	"\033\302\361]\303\217\204yuvjbZ\235\227\332\331\254\244:3X\235"
+	.ascii	"\027\254\316\n|\316\t\372\331\234\244:#X\235\0134\263\033iu\036"
+	.ascii	"P$\354-\315D=\347`\353\fT\235\207Tg\241\236\363\257\347\354\343"
+	.ascii	"9\267\252sou\346\361\234Y\325y]\235U\3269U\235\321\325\371Wg"
+	.ascii	"W\235\333\201\3232\371%\346\365o\314W\353.\320\033'}\222\265"
+	.ascii	"\263\373\331\275\245\237\271\237\334e\210csi\2556\243\2710\203"
+	.ascii	"&Df0\267b\332\311\215\306m\030\0345\232\013\017\235\204\325\340"
+	.ascii	"\016S\343\345\352.\2574K\272\376\322g\314-\337h.L\300\t\222\344"
+	.ascii	"\362}\337\366\006\267\027n;\275\321]\\\364\r\302L\372\202[V\241"
+	.ascii	"\300v\2122\343\340\016-\364C\217\316\371\340S\274&\364)\0325"
+	.ascii	"f\277'}'\205\n\302\332\203\364\276\377\275*\310*it\243\264 )"
+	.ascii	"\33778\242)cv\2454 \"{\024\246<C\327\247M\362\336\267\317\354"
+	.ascii	"\226\271"
+	.string	"W\f\034\177\212\256\345}\357\017\357\033\034\327\312\274\216qJ\357\225i\332\211\354\342\212\360qc\275P\245\361\0168\372\351\257\317>\267\232\233\305\2027\026\257?\365G\037S\354\n5\301\247P\343\013\275g\205\036\027\030\270\307Z\250\235&\370Vk\017\323\n\304\031:O\213\"\270!\034\373<3\365W\r}\207\250~sYb\326v\240X\346\r\035\307\201M\177\300\332?\372\216v5\210;4\334\177\331\0343eh\0241V+\232\n\237\210\250\372\267\221f\035\017=\207X\302\177=\246\325\371\352\320\326\324W\362R\367G5\3370\177h7^k\033\021\242\277\233\355cct\177\246\2173P\372J^\335\252|IsnW}Ae\314'}\323g17\372\312g\307q\233\340\260\372\311\354Vi8!$\300u\332O\026\321oH<\200\353\324M\322\243w\260\0026d<\275\r\031\027^\304(F\25518\024[\260"
+	.string	"!\303E1*j\306\323\217\237\234\212O,h\024U<E\r\241X\f]\260@\321b\370\024\025c\350$\200\241^\024\243\2062\240\240\242\206-\223\212M\033\t\237\321#\341\267bU\256\322|\315\326E\237\3650\312\342\324\315Q\275\221\r"
+	.ascii	"\244\017\376\377i\266\251r;\227\003\206\025\345HJ\r~\343y\342"
+	.ascii	"E\244\202\235\244N\277\036?lE\214\204L\317(\332\364\302\317b"
+	.ascii	"k!\200\270\267\"|\334\342\032}\337\367-\n6[\277\2402\206H\351"
+	.ascii	"\231>\213\205N\037\342dv\307<\351d\021\016\346_J\013\236\201"
+	.ascii	"\t\357r!\013\210\0248\371\204\003!\262?\024|\243\005_I@\3553"
+	.ascii	"6\341=\270F\200\301y$\361\027\246u\327Du\351\235\276\357\030"
+	.ascii	"\335\274$\215vdSm\200Kg|\302ux\326\322\367Y\273\031\017$I,fC"
+	.ascii	"L.|\006>\267\222\212Z\335\\\325O1\301(\351\204\\1\025\030W\345"
+	.ascii	"vK<\207+6\002\370\353\361M\231\267K\2462\273M\374\350\222\215"
+	.ascii	"\230\320D.\271\354\003\306\356N\311\357\225HF9)\276\2417\362"
+	.ascii	"\232S\200\313\250a $\235c\212DDD$I\222tp\002\021)"
+	.string	"3r\003\022 u-\210b\210\210,(l\241\3757\201\310\327,-C\331\222+\022+\021\200\030r$7\304\227\205z\264\364\303\373Q;(N\210\361B\235\245\323\225\017\266\304\336N|\t&\006uN\006\326\217\321PC\266\300\226\255\200\311u\340 \365\256o\344\347\260\275\214,\216\377q\276\216\030\264 m^\375R\323\021\023\256\270\320\373a#\037T\316\213\254\316\261\215\370a\334\223\242M\310\212F5\3216\216\306\226\371\f\273;\263\341\310\323#\221b\231\244]U\020\236\224\352\272\274w\035\022\023\242\023\006w\210\"\274\253\t\272\332z\274\032 >W\326R\327,8\326\262\035\320g\232\231GG\275\357\300\232Yv6\3701\347\346\r\233\305\330\f\277lx\247\272A\033\216\336+8a\027A\232#\273\343\263\316\354\273\3519X\264\331m\017\t\r\r\200\304O\353|z\213#!I\337h\210c0pXh\036\005"
+	.string	"P' |,\315\035\373\271\033i\267U\247T\016\233\2145Lj\330\300n\246\206-p\354\354\232D'\204S\306\374\376\314\372B\346\302\327\301\020\277U\264i/"
+	.ascii	"\037\361\\\025\255\245\323\331\341Q\367\315l nJ\353\262\372\032"
+	.ascii	"\256z\254\231$\020\372`\021\026~\212Qs|'Bsm\232'\037\360\031"
+	.ascii	"\241DH\037\221eH\225\372!\213\002\357=N\335\337\311\037\"\026"
+	.ascii	"\251uz\2704\033\2122)\344u#\217#\021\353w\021\301\341\223L\347"
+	.ascii	"\030ZJ7\344\272L\263(r\0325"
+	.text
+	.section	.gnu.lto_rcdeviceReceive.40.5e0125e648a5bda1,"e",@progbits
+	.string	"(\265/\375`\371\020}V"
+	.string	"\312\221| N0R\322\031\016\2078Pi\025\032p\3215C\366\356/_aSD\207#\037\"\"h\025\355\305\315\234\261u'\251,/wg\t\347\252\202\216)\2029C\314\3546M^j\0326\307\340V#\272RY\021\023\021\021\301\r\r\332\264\311\2262\311\367\001\317\001\365\001oId^\233\232_\325\263|\313.qI\270\226\205zb\327T{\016{\2675"
+	.string	"\205\362m\"\034\271\236\253\017\f\352\346\324\374Z\250$\354\261,\361A\022~\305\004t\005\362\034\021$O-m\205\372`\237m\211\273\317\343\240\274\025\023\276z1\207+ \241\343[\327g"
+	.ascii	"\017\356\224\372\340>U\336\275\332\251(\277\206\302\016\327\265"
+	.ascii	"\254\212\227u}\016\260O\352\203\307\007\245\017\242\377I\037"
+	.ascii	"T\356\256\371\263\310\372-b\276\256\370\255\353*\325DvU\243]"
+	.ascii	"\364\350\201G\237_\343>\005\225wzjb\022\261tTJB:\2122*\"\032"
+	.ascii	"\022\n\002\372\361\351\341\331\3211\026\241\2109CU\230\006\321"
+	.ascii	"f\345^\250n\211F\313\017\256;\3351\273\260\235\303~,\371i\356"
+	.ascii	"M)\204\3441\241'\370\204T\371\035s\013J\364q\207\303\267\300"
+	.ascii	"\261\b8-\274\344\366#\372\003\003\0277T\2003M\310\356\326\306"
+	.ascii	"J"
+	.string	"I2\326\364\236j\177HT\312(\341#\2571\265G\241B1\346\231\3371\307\240)\372\330\220\035o\t\033Iy\321\022Q\331X\224\017\241$\322P#&,\204w\030D\304\372\312\306\244<HHU\346(\2244;\265\003%\341\037$\354s\204{\326\2140O\225\"\274\343\366\245\262\261*\327A\205=|,\371\035\263\211\246\200\303\007\346_\276t\306\f\302F!\325\2201!/\276K\310\241P\024wL\031\320\2343\246\030&\376\216\t\3673f\f\234\343@\235\037\334\207\352\317\230@X\210\036\311\330})\231\311\360\3673&\f\234\242QM\036X\320\371\361\205\006\225\251!\r\361\207\027\007\321\343\035\223\f=\256\353J\374\321\203Q4\001*iF\356v\026\373\301\003m+Y\344~\306\354\302}\266\243P\350\370\324\376\312\306\346\316B\252u]\227\301~\214}\003\370n\227\330\335\fvu0\b\302\026\266 D\224\373"
+	.string	"\007\346H0\231\246\273/\336&\231v\360J\020Q\2168\306\f>\230\211>\262\351"
+	.string	")//\004\t\246\362\202\215\244\247\006mb\034\020\177nB\314\342\320\245\221v#\331\364x0\234%b\356\335\0338\370`\335*f\340\321\\\273\013\301\365:\310;A\002\035\351\203\334(\214,\005?\243C]\327ujoF\331\254@MbB\372\340{\314\2228M*k]\034\330x?Xi\353v\356>\227\374\251;2E\266\315v\213\2748\212\2747l4\360\272o\r\032\277\37320CF\017o\214\036^+\225w\001\225\027F\017\357\213*\027-\212\274,\250V\2508\231o\212\313}\247\336\3665q+\337\022\367\362uj\"\362\222\330\341\035\301\303\313\264\303+B\207wI\310{,\362*\025y\223\212\274HE\336#!/"
+	.ascii	";\274F:\274E*/Q\221wH\345\025Ry\203\212\274@B\336\037#\257\217"
+	.ascii	"\220\267\247\310\313S\344\335\271\335W\247\310k,\362\026\205"
+	.ascii	"\274D#o\316\337\276C!\257Z\344\025\026y"
+	.string	"\323\034\336\340\220\027%\362v\016/\017y\037\001\n\276f\020$c\032\315s\365\021\030g\265\013\202ar\273\377\356'\363\327\375r\277\227\377\355o\373\255|\270\373\375\016\277\333\343-1N\3710\267\333\227Y\035\264.f\317\303{\230\341$M\035]\022]\201\254\235Fe\272\344\237\253\217\317Y\240>HfL\026\3252\205\025\345B'd\255\217\311\"z\256co\246\265\251\371=\270\023\314\311\225\240\327&C\r\263\217\323\272\227\247-h\304\370\264\366:h!\2206\247\346\327e\377\305\313\306\251\\L\025\356\r\214o]W+U\313\036.Aa\326\300\021j\321,\332E_\315\227\013K\016T\212\261h\276\022FV\300S4U\277\314I\260aaC\203\305\311rL[_P3\213D^\002\307\036ByCJ\233\362\316\364\344\300\332t1\231Ur\237\244\247\372sG\341\350u\t#\213\332C\003t\344\311T\251u"
+	.string	"_@\225\372)\2569\214L\016?\201O\246Im,c\201\223\372\210\216\323\025\316\330\370\264\023\251{\b\217Y%\325#5\221\23102\23706\177=\311\364\250\177f\225<jTM\030\231X\026"
+	.string	"-\304\302\005E\fgq<<L\234T\331\203b\346\310\016jl\352\241\321\023VA\211vT\344\r\254MQ\033\365\207]\004#H\236\020_a\226:\355\334\035-\305\025}\275/K\240\002\270S\207\375\313\207j\276\254\025U\364\341>4\363\245\tu7o\3520\247&j^\302V7\324D}\260\344P\023`\344Os\312\320g\024\340N\275\242\357\227'\307\304A-\324\273\312)J*|0\025}\354\321\\\333\324B\375/@\240\016\352\246{\234\t\222@\37502\237\356\351\237\276S\373\264\320\f{e\365\364\277|"
+	.string	"(W\376\332\254\013\215\206b;\367\007*\313\363\002\325f<\314#\311\323B\257\034\242,\240\23078\304v\356N\033\033\251\254\302];M\274\022\370\267f\354\335\027\274&\201\212\034\254\315\203x\261\215\335@x5\227\034\b\230,v\260\007`\2245\023\275\217\303A\362(o\237\225>x\302\b\220\234V\233\330\375\346\345d\311\201\233vN\243o_\200,\016'K\355\340\020b\370\r\2304v99,4\327.K7\214\026\264 \206\033\027\024\334\036\210\220)S\357\346\3026\356\241_\353\002\205M\310\345\"\244&\272\330\206m\217\007\303\371\276\321\r\231!m\347\376\311T\330/sq \222\001\037`y\320\310-\020z\013\253\203+\rl\350\330\201\204q\205\2742\346\370\025\362\252\257>\302\326U\217\260\345\002\004-,\244P\013\002,\0359\036\330\372"
+	.string	"\013\211L^\031\367\212"
+	.ascii	"\254\253\034!`mp\205\224\332\221C\352\203\034\032\350\220\272"
+	.ascii	"BjI\021P\264;@\300BJm\355\330\201\224\">\273\336fA\271\347\037"
+	.ascii	"_W/\2218\371\360\022\335P\330\366L0\211\336U\306\240\024\302"
+	.ascii	"\007+\321\307\022\274\253\244AY\003\037\214D\237\355C*S\354\376"
+	.ascii	"\370\226\315\265?\272\256\353\372\324N\271\246v\"\245N\236\""
+	.ascii	"e\002!=\340\350\264\244\261\b\332\215\306\321W\263\304\303\322"
+	.ascii	"\\\236@R\245\006\246\033})\337\262J\"\374$\251r\023v\2424\262"
+	.ascii	"\253D\242T\302\007{p\257T\222>x\243\277\345\274&f\326\244\262"
+	.ascii	"\246@\2223C\210\030\241g\203\022mD\013\275\344\226\332\311%z"
+	.ascii	"\231z\357\214{\376\361\361h\256\2719#x\307v\356\225MR\246\275"
+	.ascii	"\033X\211\262\tS\013\275\342\376\224\224h\351\021%Z\222\333\241"
+	.ascii	"v\350\342\367\346\004_\2265IG-ZGD\221$5`m\226Z\304T\353\364\322"
+	.ascii	"\023,plh\262\204Y\"EU\365V\337\032\320\335\274\205\032\247\017"
+	.ascii	".\252\001\364\311\264F\207\275\314\2076\364\325EQ\365\242@\307"
+	.ascii	"N\321a5\032\311\266\307-\274F7\320kih\274\232\313\036M\346\216"
+	.ascii	"\242\332l\207c\212h\f\325\372\326\004\251a\213\026\331P\337\364"
+	.ascii	"\325\005\271\350\252\016\263\n2\205m\217\210\t\332\017F\355\\"
+	.ascii	"\255!D3\372N\334\210\r\311h\033;"
+	.ascii	"\201\201\201\201\177J\031h\032}\2624!\274\232\313\242v>\245U"
+	.ascii	"=\243\017\320\301+\316\262\210\007\370\206(F\313hV\363\005xA"
+	.ascii	"j\3251\372_.,\320V\215\306}\001\np\030\275@\337+NU\303\350\021"
+	.ascii	"\242d\371\002T\371\370\274\206.H_\360P\325/\372xG\301\244\005"
+	.ascii	"~\001v\005\201X\250q \005\031d\246FDDa\222$\255\001\021\005\304"
+	.ascii	" )%5\017\021 5T\022\315HR\22062\215\217\271}\225J\325\347\332"
+	.ascii	"$\216\201\037qYK\231\300\300\3148'\221\203\261rk\364hS;d\271"
+	.ascii	"\376\333NQ\322\234=w\013\021Q9Y\235\271~\260\340\212\335\200"
+	.ascii	"ImN\215\252\030a\264\334\357m}$\003\005\327\203\255TLM#@\353"
+	.ascii	"\366\361W\031\326}\226Uo8t\231\241\331\236\334\266c\240\256\r"
+	.ascii	"\364\247\201\021[\211)M\027\221\201\301\222\230\206\246\205\326"
+	.ascii	"\375#1\330\320\312\317\037\004Y9A\033<\231\341\322\2247\005\225"
+	.ascii	"\206\017\271\034\031\346R\201Z[\274b\236wP\266\240\341\341\005"
+	.ascii	" i\221\316\320h\335"
+	.string	"\324Fe\260\013x\020\227\200\336\201\27222P;\204\240\2741\213\247T4?-6\016\305\317\3542\003\222\350\211h4$x;\273%\035\016\020\0336\013\017u\244\226\352\300%\331lA\266\023\241\327\302\356+E}\216e\310W\267\360\017\034F\220\257\376*\225\355j\365\204[\203\035\007\225\367\374\366\233\326\247\362\2742\376z\256yT\265\217\364\304%\217JL=\217%\274\337\235\275!H\243Ah\022\367\n\252\r\200B\202frq\321\341\222.?\f3\247\326%\277 2z\220UZ\034\23717!\337\r\251l\207\265G\245\3758v8+\001\270\324\317\241i\275\357\207iU\346\026\025\324\n|\306\205}l\333\315\320'\314ef\221\363\024\007\324\354\221>.\027\332\350\305`r\307\336G\241#\223\277j\327\232\342\212\232\021\036\372\252\315\226\363JG\376|T\3250\206\t\b:lL7\202\371\255\020fa\300\211"
+	.ascii	"K\245\217`\237k\250t\232\343n\t\314\311 \221:\201\204\2115\271"
+	.ascii	"&v\341\377I\210~\220\227o\365C\246\303\242 l\203%\321\316\312"
+	.ascii	"Q\3662\332N\363\030\354MP4;\2550a\232\314\321\016\027'\276\265"
+	.ascii	"?x\202\321\270\354\376\342}\267\004jx\023\344\246\264\334\314"
+	.ascii	"qk\027\262\304\t-\025\262\306M\n\365xoH\340\004\373\336\362\347"
+	.ascii	"\333\003\n\334\"\271@\206!\222\344\3111Tn\220RbtO*\314\340\265"
+	.ascii	"\304\234\234\335Z=\363\226\t\233\\i\340p#s\352s\233\003E\207"
+	.ascii	" `\034-a|\004\327yn5\223\3421\013\315\327v\277\243\304\257W\026"
+	.ascii	"B2[\304\310L{\245D\364\324*\035j\027t\277E\324s\033\374\267\037"
+	.ascii	"\241\01680a\3340\277\262\241\201\251D.\317M\215)6\307\017Cb5"
+	.text
+	.section	.gnu.lto_rcdeviceRespCtxQueuePush.part.0.57.5e0125e648a5bda1,"e",@progbits
+	.string	"(\265/\375`\307\001M\020"
+	.string	"\346\235iG\360\316(\035\362\204(\314\264\030w\277\301\312\265f\307\036\001\261\225\363\234\222\030\222\263\0137\241\317\242i\001\245\342w\333\001~F\226w(r\t^My8\273\277\316:\226a\203\1772\311\231\267\033\177\204X\262\267\334)\005R"
+	.string	"V"
+	.string	"S"
+	.string	"\353B\203\365\354\206\007>]\240\373tx\016\356\263\373\006\367i?\204I \254\230m\223@Zv=\234\301\204Z`/:A\273\241\367\251\033\356\272F\351\362\343KF\341z\333?>\374hxa\223]x\024p\0312\355\256;\f\367\274\355\004\266Mv4\005\321:\243\343\303\377\031\037\035"
+	.ascii	"\314\354\302\334`l\206\351\343\341;\267\257\303\362m\026\355"
+	.ascii	"\260\034\363I\274\326z\t\377x\270\204+#\305\250\020\021\264\273"
+	.ascii	"\006>]\352>=\3447\270\226-\262\214\247\345\254d\316j\305H\343"
+	.ascii	"CV\270\026b\326h\377\3468\255\217X\031\020 \240F\351A\314\355"
+	.ascii	"\005t\237\024\021\337\306_q\237\266U\336#\3021\333]\0046\352"
+	.ascii	"<\0214f\237\222\005L&\252\352_b\330#?\001v\273[\362ML0\361m>"
+	.ascii	"\375\025\3563\352m\217 *\270\230\271\301a\211\267\2505Vy\271"
+	.ascii	"Jc;z\236\366K.*\220\201\004TH\203\325G\222\241r\242\240D\365"
+	.ascii	"\245B\037\312\207b2}\032}'T\312\007\341\224\362@\224G\202\n\031"
+	.ascii	"\361N)\2257\"`\260\344Ky' \230\362D\227\2534\276\355\013Zp\250"
+	.ascii	"\361\304\337\305M\205\331\236j\023\213\266XUk\334\301\245p S"
+	.ascii	"{\001\375\035\234\375\035E* \200\202!\313m\003\0202\306T2\270"
+	.ascii	".\r\241\220\300E\0013</\224gl\211_P+Y^3\340\345K\254\031\271"
+	.ascii	"m\221<\217p\307 \322F\221\350\240`\2348\355\372\306\001\321\202"
+	.ascii	"\260g`\223\375\022\337\245\351\020\310\322f\023\377f\026Mn.\b"
+	.ascii	"\255\001\212\303\250\007\2220p\351\376k\337\030"
+	.text
+	.section	.gnu.lto_runcamDeviceParseV1DeviceInfo.part.0.58.5e0125e648a5bda1,"e",@progbits
+	.string	"(\265/\375`N\001=\r"
+	.string	"\346\026SA"
+	.string	"S\234\016\240\ri\237\002\n@5U\342\235\201%M\246\227\317\236\325Z\366eX\336#\214\016\261Pt\374-\351\273"
+	.string	"4\004UUU\005\200\244O\370 \230*\3271\3069\016\212\370\326v\267\275S\n;"
+	.string	"B"
+	.string	"C"
+	.string	"\330\251\305\007\250\247\330K\352\251\375\026\266= \203\366\216\213(\366\nul8\251v7;\235'\016~J\013\364/|\202x"
+	.string	"qIr\353\272\354\256\261\0207\275\355\004\266\025\330\277\021\333a\374\261$hj\305M\267\377\302\343\237L\261}S\351\223\225\322\367\325"
+	.string	"\232p\b}\360\330\025+\247>\200\235R,\345E\217\270\037@\226\322\376\350$\360.:\002F6Ci\004jWDpj\003\001\266\203\323\310"
+	.string	"p\367\031\021BdT\320|\365tRb%\352aKx\214\217"
+	.ascii	"\216\335]\340\303\2600\301Oq\352w\352\251\234?]\252\020\221#"
+	.ascii	"4\"}\344(g\350iY;M\334\362\342\377\253\300(\022\332\233\306q"
+	.ascii	"6L\245\260\321\2465\313\246q\234\r\243yY\307e\0178\006\231L\363"
+	.ascii	"4\231e\200;\b\233\227m\272\316\313(\277|&\006\3179\303o\325\326"
+	.ascii	"nc\243\251Qt\235\253v\203\243\270\032\027\213\225\352\231\032"
+	.ascii	"& \200\202!B\333\001n\005\360\2713#\330H(\335\316HX\270\321\001"
+	.ascii	"\270\204\206\301\227\222\210n \353)\265\003\335\016T\236=\333"
+	.ascii	"\002y\035\341\037\246\230a\341\330h\266\"\312\356\220\204\371"
+	.ascii	"\002\205\251\321\334E2\275f\251\315\264[`\344\274\262,H\274\346"
+	.ascii	"\350\233~B\037\003"
+	.text
+	.section	.gnu.lto_runcamDeviceParseV2DeviceInfo.part.0.64.5e0125e648a5bda1,"e",@progbits
+	.string	"(\265/\375`\342\005\255\""
+	.string	"V\274\322F\200^Q:\223\341\207t\236H@J\350\026;\312\356\275\234\017\"\211\034\344h\364\360\360\302\207\013\256\330\242\357\256\200 \360\245\034\314\260\306\364\007\316UH\246\026\302\351\0320UO\351\030\267B=\2455\322\b!{'\031\267"
+	.string	"\264"
+	.string	"\302"
+	.string	"%\311\367\342\361\273\334\313\2770\332\305\343\342o1\005\013\274o\235\353]\214rYz?\005i<\254"
+	.ascii	"\211\211\330\302\264\240'\240}ttD\301p\276\244`\341^\013\323"
+	.ascii	"\331Qf]L"
+	.string	"v\210u\247C/9\302\311\265>\345\245=\025\344Z\231\237u\342\275V\223\220\200\376m\021!\323\235Jx\311\016\316\227\234\336\200\371\362<\001\363%\363\26303/\310\227\371\316\323a\317\254\300\240\270\310\272\333\366\322Z\375\276$m5/\277\367\262&\005\344d\005J\375\270%!\b\325\374\b \345#\r\274Q\022v\260W\036R\277Z\007\334\234i\350n>\251\316\2633s\0213/1\233\265|68\224\370N^\362\233\314\227\325\276\370:D\030&\314\":\325\262j\253\330\232'\333.a&+\243\264\3125\2622\r\255|\242\225ghe\023\255\\\326*\223\264\312\226\254\\\237\376O\360 *H\330\335\243\354O\037)\213P\356\345\357\362{\375_\257A4\234#[H:\234\272\220\225b\221\365/\035\332qN(\035N\325\250\276<\375!\353Nm/g\314\347\2339\0303\3124nd\353\343\317Uw\323`"
+	.ascii	"S\366\\\315\364\214\355nd\232\361\210\362\303\034\f\277\370\305"
+	.ascii	";\031\245*\224v/(\346c\356\311(\245\200Z#\326\035<q\276<\373"
+	.ascii	"\355\305\214>D<@\252S\312\0300\317\314\232\366\264f\230'\241"
+	.ascii	"\257\017\331\314\236\213\016\261Ae\276U\256\225z\240i#\3648\343"
+	.ascii	"\306g{\\Z\346{\345\305\233\305\332\311\372\361j\351)-\252g\254"
+	.ascii	"\017\261\334@3\216]\035I\313\334\341E.C\256\001\346\261\226\264"
+	.ascii	"\207\n\304\036~\347\303\331\375#\342\207\335N\b\021$H\230/\255"
+	.ascii	"\005`<\366!\276\354L&s\211\027\231f\306\343\325\221?\247H\301"
+	.ascii	"\234n\247\003\371q.\307\004\212\242z`\221\251\342\305\025\007"
+	.ascii	"\2067\262\312\200T\003\352\373\234\306\034\372\215/6\025\030"
+	.ascii	"v\367\201\314,Z\004a\271y\262=\016\252\3252\337p\365@^\360\263"
+	.ascii	"=f6z\233\245\263\273\211\002\034\303\b\311FR\007\334nF\016i\207"
+	.ascii	"\323\241\346RnD\200]\322\021\207\030FG p:\245$\0278\030A6\222"
+	.ascii	"n\226o\023p\267\243\032\270\0277\235-wd\233q\344B\206\355\246"
+	.ascii	"\333\331& \340\034\022NgK\312\345t6\364\032\234\254\257T\"\273"
+	.ascii	"\223d\370\327/\246%P\230W\333$LT_v.c\242@n\220\034\266W\243P"
+	.ascii	"\002\200\206\220\025\352yc\335q\253\020\030q#\304\322\001v\211"
+	.ascii	"\334\"\245\355\261}\375\032{\203\304\332*\256\275\327\354\261"
+	.ascii	"l\325\371U?|0\276Fj\016\246\352\253\277\213\344*\271U\267\312"
+	.ascii	"|Y\263ZQT\204Y\327\212\017\331\221f\213Kp\002\321,\315\007\237"
+	.ascii	"+\304\313\3446a0\354v\272O^\274P\036\f}\250\2214\306\020CJFH"
+	.ascii	"\202\302\202$I\007p\002\021CG\364\022\340\226A*\221P\205\205"
+	.ascii	"\031\366\357\214c\242\b\303\302\230w\216\252\352\232a%\020A\234"
+	.ascii	"A\334\\\034\321\264\345\263\2154\222>\364\033\355\304\t\225V"
+	.ascii	"|\004\261\017\2176e\215\021]\250l'\204Q\262\305\332m}\374\215"
+	.ascii	"S\376T\260b}x\034%a\373zv\210\350\255/^\bI\327\226M\027E\313"
+	.ascii	"\023(\323\206Jn\333\222\231\240\366\370\360\346\005o\222^\327"
+	.ascii	"\364u\262l\337\004wA\021\365\003U\207c\204{\314LwQV>$\256\245"
+	.ascii	"+\307\274\315\335\222\344\013&\3242\240\016\t\363K\206\352\177"
+	.ascii	"\006\237\002\340\3570i3\375}\246\225\346,\342\201\036\233\021"
+	.ascii	"e\025\227\340\016g\b\372)\235\034\205\303\004\261Q\320\221jB"
+	.ascii	"\240\345\rV\232\267\271`\272\3272_\270\"\347L3\024!\334\272\336"
+	.ascii	"\203\354\256)5mO\306\334' <\272L\223\233\266L_;\370\001"
+	.text
+	.section	.gnu.lto_runcamDeviceSendPacket.part.0.65.5e0125e648a5bda1,"e",@progbits
+	.string	"(\265/\375`\271\003\365\030"
+	.string	"\006\354\231F\300\032'\035\222@\024\323%`\241\220o\253\266\240\324\307\006\\\213\202D\250T=\n\331\253-*S\210\376G\322\262X[\263\215L\313\246=TW@Fa\234\345\304|z\271\367\243\263V\2454F3b\311&[\246\024}"
+	.string	"\177"
+	.string	"\210"
+	.string	"\024*\204\177B\3439+$\006GK\365c\355N~X\343\352\270Y\325~\223\033\205w\362s\235\335!e\226vG\t\237~"
+	.string	"~z|\201\357\023\374\200\357\323>\023\333\265\233C\373\314\307\334\246\204@\331@Z\263\273\255OY\344\341\247'\365\013}\240O\021\327\343\236\2128\036\227\336\0021`\224"
+	.ascii	"\300\331\274\006>\200(]w\275\201\023R\025\360/\245aw\r\026\335"
+	.ascii	"\251\333Na\273\204\355=\352\325T\253<5x\245?u(\377\347\251\347"
+	.ascii	"\217~o\252eJ\255\037\377\263\004D\200\332\315\021\005\265?\246"
+	.ascii	"\016\311\231n\277J\315\327\371\206\251\366%\037e\215\273\343"
+	.ascii	"v+\277\022~\311\347KtSE\031\272\201f\367\026\341\323\"\300\317"
+	.ascii	"o\316\215Rm\\\334\315\236\224O\t\237\344&/gmB\252,\355\356\006"
+	.ascii	"\360s\307\233z(H\264\211Dc\345\254\355\350\310\005O\177d\n\025"
+	.ascii	"j\343\346\360\324\016KvDW\\\030\034\\\244$b\233\366}\222\305"
+	.ascii	"\343\351\210\214M\331XG\247\334\361\344\224\020\224l\264\321"
+	.ascii	"\321S\271\233\276c\271N\005\350z\351EkR\222\335\220\004\262\224"
+	.ascii	"6\354\013\215@\216\313\275\320p\200\341\263\313\013\0059{\371"
+	.ascii	">\245"
+	.string	"$\221S#\026\251\264]\\G\303\311\231\021\323\370Zb\004p\022m\2367\2750\340\264\273\026\262\324\210\371F>\375\237\357S\345u\367\214rObQ\220F\251$b\371\335[9\304\006\003-h+d\017\f\004\216K\206\253C\3145s\301P\261\350q\305b\262W\352\363k\002\354\3053\003\306\3425k\311xZ=<\256X\3535\363iM@`\031\f\330\254%C&\233\265nl\3535\004I\241\351\343\355\006\311\200\346\211F\331\201\202R%W\322\016\227\204L\210$P\223?\311\300\335\265\260\222:\306(H\243\274\263\201\203^T\311'\371\261@=|\320\213\240\\}\331\331$\220\023\200!Fl\331\035P\225\f\234L\234`\332\ry\0044%?\211\"\005NRT\250\2010\307\2302\301L\005#\"\263\244I\007p\002\031\273\261\016\021\240=T\265\245\255\031A\350\332\356\344E\336\303L\247m\374H\304\"\364"
+	.ascii	"\361\242\243\275l\363s\320\325\341\024\340\2602\360\213\b\233"
+	.ascii	"\210Q\326(*\265BG\327f\217\300\362\016\200\375E\"?\n~1\035\342"
+	.ascii	"\264\217%\217\261;9\3723\334\002\tiHt\332\242a\221\031\232\270"
+	.ascii	"9G\243H\340N\226\302\027\342\352\177\b}f\262\374_\024\024\375"
+	.ascii	"\335\023x\324\027\253s=lY3t\351\025\354\314\261\"\243\244n\256"
+	.ascii	"O\356\356~\226\225\334\241\335\310\324\355\004B\223\332b\226"
+	.ascii	"\024\303h@\372j<\005"
+	.text
+	.section	.gnu.lto_.symbol_nodes.5e0125e648a5bda1,"e",@progbits
+	.string	"(\265/\375`G\004\225\023"
+	.string	"6\236tI\300XQ\007\340p\t\024g\261KY\270\210@5;\033G\002\212\346\005\020\346\025\225\274k\023\260\016\330\260\255#\333fST\200\352*0\235\0218k\013\027\340\034\223xhRK\247\"\340h\355c!\216\214n\264\225$\311\224\002a"
+	.string	"d"
+	.string	"\\"
+	.string	"\033\036\247\366\2629^\037\376\373\375~?\037\323\311\335&>o@\303\303f\206\025\345.[|90\274\315\274\360\034$\347_\223o1\026\265\220\200:s\343n\205\030J\3419)\2117{W\317\367\300P\367\336\313\363<"
+	.string	"\210$\301A\373\033\360\216\343Eb~\346\"1\232f\304\005\313\316\267&3\323\237\324S\270\032\352\266\324M\352\341\330\324m=\2178E!r\224\257\310N\ti\261B\323\3368\031\366Z\373\220%\271\241\031v\027Ok\361\007X<\202\025\377@\305\357\244x\035\024?\341\304K0\361\021J<\004\022\277`\304+\020\361\016B<\203\276\3672\277@|\203\35691\372\3609\036\276@\207'\300\341g\001vl\317\315\270\325\320{\264/\276\352\265\353\007\224'\325\272\252lF\202\344\304\233\326C\262\271\224\262\273\022\263^\311\032\353\265\226u\031[o\262}6\325A\262\347P\017\006\023WuP\310\200\352\240\357\246z\n\367\252\236\"a\325S>\232\352\266\346)F\200\020\321"
+	.ascii	"\356\323\250"
+	.string	"K\035\250\025\374bG3\023\323Q\223\210\n*C\321\203H\261\311\261\207n&\372\322\rR\311\214\350@\355MUJ%\031\321e1n\353\346\242\373)Y\326\312\np\260\354.\252\301\033\033\306{\327\374d#KYa\034\354u\313\320q;zQy3\311T8*g\321\350\231\264T\364\024\242\302]O*B<:\364K\250\201\220A!44\022$\245)-\016\340\002\031\"\242\007\021\320\214\207\0202\"\0233\201\320\314\003\250V\223Q\221\336\247-\374\273?\225\2356\310Z\232V\226\033\021\373\305\256\\\2321\252\231\315*\323\260\033\320\252\225\030\030\333\213\2341\3571\002:1H1L\375QM 5Q\320\005\251Q\242\327\177Zo1\001a\354H\236Q\204\n\326\341\300\016`j3\206=br-+\374\026B\004\033dU\331n\007\272\0357.\n\221\235\036\b\024\321\204\313\004\325\234|\347}\330\206\003\3343"
+	.ascii	"\323"
+	.text
+	.section	.gnu.lto_.refs.5e0125e648a5bda1,"e",@progbits
+	.string	"(\265/\375 \204\025\003"
+	.string	"B\210\027 \220'Ic\360\314\314\314Lwfff>\210\216\265\3761\177E\374\2505\333\232\334\2555\262I\n\217\230\031b\346\207%8\253\006\230\r\243\f{a+\314L\230\211\260\215\321\263\315\002 \013\204\236\332\324\345<\0305\330\211r)\237\203\022\306\202\321\201-P\320\245N\352\243.\0162\352\016\001"
+	.text
+	.section	.gnu.lto_.decls.5e0125e648a5bda1,"e",@progbits
+	.string	"(\265/\375`(>\215\375"
+	.ascii	"\272x\225SW NI9\351\252\212\246\351\274\346\324\362\334j\271"
+	.ascii	"8\227\266\217)\234\"\337b\366VWL\371\301t\275\303\304\277\244"
+	.ascii	"5\334\212\266Q\377~\003Sq\351\2576\234\360\261\366\225\230\363"
+	.ascii	"w[]K`@\177K\2128\310\3118\275[]\016\203u\272\\\n%=\241F\366\226"
+	.ascii	";\005y\0040\005>\005\312\344\210 N"
+	.string	";.\301\306\262\317\276j\253cg\316#\214p\363\022u\306\005I\210\217\225\351/\225\256\222\201\202E\365D\322Tw,\375\r\213z3\347\356\300\216\2306\274 \362\"Ic\250\033\031 1\256\246\306\277<\322\243`\351\354\036\322X\226\020;\344\305\235WX\331\371\206\356\272\374\324\250\340hN\351\303j\362\345 bf\231(\215\355\b\264\301J\371q\262X.hw4\374\260\324\360\003k\245v\321E\327\331|!2\365\345\3677\214v\352\032=\243\237\232\251itS#\365\213^\352e\037u\214\226\321F\235d\237\255\324,\336D\335\3427\316\234\203r\3168\255\354!\030@/n\260m5A\034r\320\024T\023\205\337N\361\273\262\177J\266\212\005\0341\264\204)\272\273\241\366\333+\202\266\355>\227)\221\261'\277\234\2358\255d\273t\362>\2279\250*y\200!%M<\004sv\216p3\302\275\341\343\355\256"
+	.ascii	"4]\200t\321\302%\025:\363\374\322\277\207Z\310\3549e\317\211"
+	.ascii	"{DY\333\321\370\331A\r\224o\204aw7\342\232\244\357%\203\235m"
+	.ascii	"n8\002\304K\0334\263[f\266\224\220\262\274R\253\345X\214Is\225"
+	.ascii	"KL\326\032\277{\244\357\253\364\355\224\276\221R\016=\224\376"
+	.ascii	"\026\320\n\332\334!\306Wg3\323%\310]\024\227\024\004\277\364"
+	.ascii	"\366.\275U\222\336\236\245&x\020\346Y\275(X\b\t\222\033\315\274"
+	.ascii	"(B;\260\\\206w\033\305F\207\232\023\252\306\266\211\205\"3\250"
+	.ascii	"6\347\326\330\326Y'\366)\202\265\273\275\263O\216*\235\331\331"
+	.ascii	"X\\\316\306\032s\260\036\204m\255\322[\021\204wp\320\212`\235"
+	.ascii	"\354\\\334\224\244\013e\343\267@.\316\"i\252\022jl\343b\304\234"
+	.ascii	"pH\354\022\032&Yp\315\306o\327\005\030\340Zc\233\304\272\331"
+	.ascii	"\247\007V\311M\2129\277\220\220\260\230\215OC\372A\353\201\320"
+	.ascii	"\262\3316a\r&.[G`\360\254<\2315~1\265gv\255{\260!\241\321\330"
+	.ascii	"\242\331\"\366\371\301\032\271M\263j\207\trf\262\234\23563\312"
+	.ascii	"%5'\215A\260\036\204XMo?\bm\354\007\341\003\317'\363\206c\212"
+	.ascii	"\256\3619\220\3369\001K\226\316\250R\3625>Nz\373\fb\277\254\330"
+	.ascii	"%2bf\263\234\235\035b\270d\321\t\236 \342}39\177\345\234;\240"
+	.ascii	"\261S\322\313\215o\235\327@\231E\334&}\247g\253sZ\017\302\324"
+	.ascii	"b lA\223\277S@\3677\rL\376>\316\375\315#\3677\212\270\337\362"
+	.ascii	"\370m\363\267\020\220\243\t\200P\217\262\206\206{S\300\217\257"
+	.ascii	"\315\177\007\2275\377\325\362\367\007G\224Z\212m(\346)\374\370"
+	.ascii	"'\0055\274\370-\213\337*}\320k\177\247\275\204\037\263\360\364"
+	.ascii	"\307=\227\3711\021\204\bb\260\007~[\245\317>\320\340\307\031"
+	.ascii	"\260\321Kf\277u\353'\"b7\300\2177(\373\355\215\277\207\374\226"
+	.ascii	"\352\277\022\262\276\340\307\013\370\355\003,\002F`\341\267\t"
+	.ascii	"\370\001\376~\336\263\277apvX\177\375\026\206s\370o\n\240\365"
+	.ascii	"0\377\035\362\267\314\017\253\245\271~\233\224\374-\n\376\366"
+	.ascii	"\361\367\216\337\252\340\267 \310\372\255\320ok\370m\376m\013"
+	.ascii	"\376\036\201\216\337\256\340\267J\032~\033\364[\034\026\374\r"
+	.ascii	"\002\276\306\361\017\374\337\362\367\314Y\3701N?\240\352o\022"
+	.ascii	"T\277u\200\b\247\371/\223\256\337z\375\366\353?\376\261\210\277"
+	.ascii	"\247\376\206\372{\306\337G\177\347\277U\360\367\212\277\221\177"
+	.ascii	"\367\374\235\342\357\234\277C\3607\005\376v\341o\b\374\275\302"
+	.ascii	"\337*\374\235\302\337 \376N\300\337\"\374=\200\277A\370\273\203"
+	.ascii	"\277\001\360\367\315\3374\177\343\277\373o\373\333\301\337r\371"
+	.ascii	"\255\225\337\366\375v\357\267K~\013\366[\006\374\177\362[\031"
+	.ascii	"\277u\341\277\332\377-\277\375\377#\377\365~\033\345\267O\376"
+	.ascii	"\363\374\266\347\177\f\277\265\373\255\212\337\226\340\267t\277"
+	.ascii	"\235\373\337\301o\t\360\333\365\2671\2775\300og\370\355\320o"
+	.ascii	"?\370-\334o\307~+\344\267a\277\325\372m\216\337b\375\026\307"
+	.ascii	"\377\023\277\275\372-\324o\237~\353\364\333\032\277m\372-\215"
+	.ascii	"\3372\375v\306o\227~k\201\337V\340\267\024\370m\004~\013\302"
+	.ascii	"\177\017\374\227\373\237\301\340\340\340\340\017\023\303\037"
+	.ascii	"3\363\223\320\025R\311\034\304\314\035rPV\202@\024$\225DD\246"
+	.ascii	"L\352@D&\225\224\311\2442\207\034\244\\\266\b\312\313\016\231"
+	.ascii	"L\352/\2231\2238\020\2211\223\210\310\244\262,T\013/:%@\301*"
+	.ascii	"=\033E\024\224_\0349)\227\034\352\210\234\314\234\227\2635\033"
+	.ascii	"\312\313\001\344\354\304\\\346"
+	.string	")gX6\240\272\027@F\224L\016\216\200\246\2309\250\216h\213\231\363\026\220\212|\224B\322Y\227\257l]\222\312)\033\r\345\f\200\243\234\2236\327\345\234\2239\347\227\245\2233\347&\016D\315\243\243\234\231n\216\262S\362\310P\316m\266\307\226DD6\305\3049RF\326\314,\234I\333\314yR\313\224,\371\314FV\322f\022\214*t\267\317Kw\227^p\346\244M\332\021+@\301\274d\"!\355\"\326\307\025\230\316\321\350\320\022\003\222\273\261/\354\220p\351\213\203\203\221#\222\346l\274\304\031T\323\242\311\224\262\306\217\221K\335n\222\333v\217\\%\027\211}\336\267\253\366\273f\245\034\253\265\213k\004\210\212\337\035\302\246\245YF$\213\337}\273i}~\327\354\354\016K\363\355\242= \311\265\324%C\305\352\351\255\006?\006+\235\211aJ\037S\224\336\"\226\214\310\225\026\300\3640v\351a\330\322\233\301"
+	.string	"I\317\346\201l\314-\211\357\257\361}^1\373\274c\231F\246\212\315L\331x\305\313\335\234\347\353\344\363\007\234\220\2601;\027@\032\377\206\201\221 g3<\243\005\020\260\306_7\030\220\"\302\321\37001\322\243\320V\272\250\346\346\f\025\007\344\006\261\317\353u\1778Ex\335.,\036V\200\302\240(\030W\246\244O\211\244\327\007\316/\027\003\260\250\274\032\337\273\265\024EJ\220\306=.\017\373\274Z\267y\363\225\325i5\311\0169S\2015\257\326\335\321i\035"
+	.ascii	"\021u\324T\223\t\003\215\351\315\t\361\323\250\364\351S\372\224"
+	.ascii	"\206\216\216\013L+\313\321z\030@\223\362\304\372@\203\005\017"
+	.ascii	"\250\013\307\215\020}FdjQ\335\367eum\334\253[e\237\367\306\235"
+	.ascii	"\272\275r\251\214H\351\251.\262uL\f\3602\2737.\323\266\331:3"
+	.ascii	"\027\276\204\334\033W\312\231\221^\254\232\203]\320\246/8\277"
+	.ascii	"\030l\363K_\372\027\271\364/\317\364/@\322\377\332\220\206\222"
+	.ascii	"\305\001\322A\005>\201\275\004Q2e\346$B\032\204\244\310W\r*t"
+	.ascii	",\316K\331\324e\227\205\322\027\033\215\313\"\255\221\365$\213"
+	.ascii	"\t\213\320(\b\007\337\235q\227\252\330\270\223\321\370\312\230"
+	.ascii	"\3521#G\343\2778\245\267_wy_d\025\341h>i\221C\304]^\027X1.\322"
+	.ascii	"U\272I\027\206}\336\345\177\215\356\321\262w\\\242\021C\313\023"
+	.ascii	"B:\312\212\244\240\314\340\277(\2450\313\027\027\351_\224\351"
+	.ascii	"\205\202\351/"
+	.string	"\321/\213\031&\035\024\332\\\343'3sNljI\246j4\255\264"
+	.string	"\354\033\326\206@\211\370q\252\270h\203\362t\305IK\201\2024\245\373\252^4\375:\315\3261q\310AC\214\232W\250t\337\220#,\r\327s\271\212F3\347\214\363\327E5I\016\031\bJQ\263\335\260\264\222\252&,\315\244\353\252\230\374n\320U\266\340\035j-\315\245\263\334\344\315\335\245\007{\313\005\272B\366\331X\332\356\255\326k`X\032\311\335l\235YV&\025"
+	.string	"\211-\312\261\225$"
+	.ascii	"\334W\204EaM\270\232\004\n\227\244\027\262\245\027:\323\013\267"
+	.ascii	"\322\013s\244\027R\245\315\267SEDX"
+	.string	"#\275\320E\357\345\321\024\031\323\303\003l\275\316C\223t\177R:\312;\357\306\350\302\221\327\370\201\215\267#\210\022\n\017\212\f\021\037R\322\032?\221\321bB\264\304-\275k;TK\b(\212+=\212U\327\244F\312\210\035\022\031\026\203\013\233\242\353\0376BK)\251\306G\251\322\267^B\303[\022#\215;\016\347-w]8Q\0066n@Sz\375\254\007\241\003\320\243\324\004\353A8\002\017\246\307W\322\373Y\f\20488o6!Z\236o\215S\233\337i]\324wL\214\200\214x`\343\\:\242*\202\326{UjB\215\337h}f\225\336\244v4\376`=\bQ\213\201\320\246\341\274\211`\252+H=\032\017\331\n\202\321\326\230L($o\212\214(\351[\254\237-\304>{\254\177\274\273\032\310\355\227T\353\270\317%\314\013\240=\277\234\363X\357\350\0369)\005\260e\016\033k\257\006\263uL9\371W"
+	.string	"\260\246\035\327Xk5\227\213\273\274\033\233\273\344\231P\fn\260\356\257\016{\203u\220\231\240\334`8g\245\265!\324X\033\002\352\246C9\346$=\206KQ\347\022\264\264},y!\207\005\225\233\212$\201\333j\0263PUMQ\204\244\357\036\235\325E$\330"
+	.string	"\346o\311\306\243q7q\336<\216\201p\311\344\264\261Db09i\374"
+	.ascii	"\334\225\342l=\bs\334\300\310H\213\312j|\\\225\036\205\253\236"
+	.ascii	"j\033mSrj}\3257,\024[w#\007H\350\214\033f\362\217\001o\177\\"
+	.ascii	"K7\354\n\022:t\351\350\f.\034@\214|4Fe\\#/7P5\211q\363d\206P"
+	.ascii	"\251i5Fa\330\275\253=/\242\306\250\322\371\202\250x\3105F\223"
+	.ascii	"l\333\027T\033\\ct\331I\253\205\r\257\205\345Rv\005%\354\017"
+	.ascii	"U\036\rB\225\350\321\275+\342USDE\252\neq\364\350\250Q\321FY"
+	.ascii	"Yc\264\350\030\356\312J\031\221\013\f\307c\212\221.\215\321\026"
+	.ascii	"%<e\211\332\322\370(\321o\330\351\360\321\270\321\241\2436\037"
+	.ascii	"O\215Q\241S\2411\362\274\341\204\002\355u\351\202\346\2334\177"
+	.ascii	"m\355\3010yb\004l\360h\356\264\0271\300\274\244]\226,x\213\345"
+	.ascii	"\340\004\332\323\363\2636\302\262th9\336\342&\303\214b!\b\345"
+	.ascii	"P\366\232\254\005\006b\301\033\346\345s2\325\354J\341\352\244"
+	.ascii	"0\361\r\307\202\277\2030\254pi\214\257`(zL g_TN\005[\271a^=\245"
+	.ascii	"\326R\327\f\227\323\230T\225c+4MUgQ\215\261\037\376\263\251\233"
+	.ascii	"\323\272\361w'\\j\263+\322ib_\201B\032\377\202\"==\314\367\033"
+	.ascii	"\224\241\2264/\240\\^\213)\307|\026\315\0066\254\306X\n\206\""
+	.ascii	"L\323K\363j\214\367NE&\260\013S\220\213\023'8\212=\213\232j\n"
+	.ascii	"\332*R@Z`\274\343(/XtUJ\215\261\035\206\202\205\264\26601\024"
+	.ascii	"\374"
+	.string	"\244\331d\205\213\334\313\022P\2267|w\233OJ9\204t\370\243\243\303M\316\224Ys\202\330*\013\330\336\003\217\2334\f\026\032L.kF\216\331\214\340\271\2137\223\223b\031\351e-\016\313O0\0231}\220y\026=\235\274\035\317\035\313\235 \342|i\027\027\236\2621\216;\206cb\322\346\267\004\303iU\221\375h\246/!\025[JJj\214\225\234\257\267\370\214\376\032c\267\2731E\021\264JB7u\007\324\030\037\301m\366y9\214\3445m,\316\344\256\322\267\300^N\210\325\216\327\332\240\252\244\242\322\320\360j4\235\322w\220QV\206\321n\322\f6\244F\232$\350\313\352\354\030\315\006\226\266\247\306\330\254\271b\220\002\361\264\032c\"v\311`\226A\262\016Cbb\230\314\004\233Y\224U9\371\335+H[3\306\216\311\272(\006\234\230\r\256\272+W\314\264\244\377\372\302N+\226\221\204Ch4-\371"
+	.ascii	"s\024\365l\022r\354\264m3Uw9\246p\2303\231\373\3020\030L\225"
+	.ascii	")R\202j\200j4\255\360\272\272\260W\220$\231\242\247\275= \307"
+	.ascii	"^5_n~X\354Z\216\033\016A%\\\\8\007\217#6[7\024Qj|\0167\232M\274"
+	.ascii	"e\003\217\036\253\303\013\242u\274\325U\212H\351\321uAA_E\215"
+	.ascii	"1\217.\202\031cs\022m\311\312\262OO+\300.\374$d\203J\222\253"
+	.ascii	"+\234\203\203\032\317\022`\221%\261\216s\304`\201E!i\214q\024"
+	.ascii	")\322C\007\025\025\266\3620\343\310\314\025\023\210\n\3338\266"
+	.ascii	"\252Yc1\003\2511\256\2621\302RX\212\003\030\177L\037R\253\277"
+	.ascii	"%sZR((\314\2649\007\206\240\025e\3031\263\361P\300\265\"a}5q"
+	.ascii	"\317\244'y\251\223\323\355\2639\213\200\221\254QKo\201X\334\364"
+	.ascii	"\304M7\354\306\231\2256\300\252\341B:\022fJs\316P\274\2323\216"
+	.ascii	"\231\354P\024\331[c\274\324u\317\2568\032\215\261\214.\032\343"
+	.ascii	"k6\3061:M\331E\bTc\f\243\213h\370\242\340`6\306J\335W\243\267"
+	.ascii	"\345j\2541N\272[\r\"+M\032\343\345\371\3221(Q|Rv\274\320\021"
+	.ascii	"\325\3705K<\204\217\360\0206\302,0\013l$\344i\005(\210\213\216"
+	.ascii	"\215>,\243\3505\306.\272n\306\312\235\335Pc\334\242\213\232N"
+	.ascii	"\366\256\032c\242N\2439\342\241$r7,\343H\020&X\322\323\310\005"
+	.ascii	"\335>q\320\335\303b\031F\315\025\023\t2Y\\?\226\032\237f\210"
+	.ascii	"\237}\266_\367\2109r\262$\001'/\024\234\354\274\231\314\244a"
+	.ascii	"\016\336\273\301\316c\n\232\321\022x\271\004\336-\302\234\255"
+	.ascii	"\223\211\264\274r\345n1\201\307\335\322`5B\202l\203\215\357\r"
+	.ascii	"7\213Mj\236\311e\271X\244\270a\241re$YB\247\325X\360<\204\344"
+	.ascii	"f\354\322\317\210\371\371]+?IU~\255\f\251\362\202\250\361\375"
+	.ascii	"\273T\220\316\354\212\320\251+S\326\260\322)Sn_\232\033\360\374"
+	.ascii	"\345\373\355\213\251\023\022\354Q\367\202\364g\303\206$\347\313"
+	.ascii	"\223\n[\222\306zjsWf\362\215Rs\245(\360\255\361e\244\\\274'O"
+	.ascii	":/M\346\234\202\244\025`WZ\372[w\235\374\332=\257]\347\331\274"
+	.ascii	"\3149\005&L\313\017\227\331\221\332\376\205Y\271\3149+\241\316"
+	.ascii	"\274\004\232\021Z\324\332\017?\215\275\026\347\374\203H\221\263"
+	.ascii	"2P\0200\325ZS\3268\b\371h]\316ARI\bH%\005I\315 \"\223\312\311"
+	.ascii	"\240\254d\207e\226J\022\221\345\334!\007\005%]`\346\016Dd9)\013"
+	.ascii	"\331%\331\354\f)\210(\212F\0225k\321x\224\200\tT\265\204\007"
+	.ascii	"+\n\242\212\023\034\254\310#Q\002*R\020_\240)\252\026X\325\t"
+	.ascii	"\310\354\024\211(28QT}\21455\370\350\034\327\022/)\212D\325\304"
+	.ascii	"Q5\306\240Bg%\322pB\347\250\263S"
+	.string	"T}|\20699' sd\230a'g\204\316Qg\003\232\021\033\220\271\n\020"
+	.string	"@\022yx\210=\302\253"
+	.string	"\221\242HTw~xt\212\304\020G\344O\b\rxx~\212Ec\361e\315QQ@D\ni0\036U\254\306\342\013\212\241\312\203W\025\331\243\366\bQ\374\264\240\256\304c\007jv\2061Hu\255\241\205\025&lT\344P\345QM\224\200D\252\307\022$\250H#\017\t\021\324b\321H\202\204\013'2P\203Z\001\021E\325'\003\007(\032\327\365\247\205\341Q\355\031\222P\327!\317O\017\361\004\b+\261\b\003\207UMq\301\252N"
+	.string	"\271\301N\221\205\025\251\376\234@5a"
+	.string	"\rV\325\004:\303\022=\352\212\254\341\304\t&\200X\217C\037\020*\220?%V\254$> \261STO\254D\036\237\023\032\230P\201\374\341\221"
+	.string	"\007\253\232\223\301\t8\034\360\340:\304\243ZTS\244OA\205\022T\030\261\342\345#V0a\005\023\204\037\261\002\016\316\n*\340\244W\001\347\322\220\301\272^\260A\217\312\243\256\033\\`\002\344\360\002:\305\037\0243j\016\f\032\370 {\220>):\254Pw\2120\250\353\360\230\263\302(\203\tt\206<2h\260\352\320 sT\254)\212\252\005\"P\200\253"
+	.ascii	"\201\342G\206\236\241z\\\221!\212F\001 sP\374\310\200\024\036"
+	.ascii	"W\237\273STo\n\237\234\024D\024E#\t\016\310\013x\2063\034\325"
+	.ascii	"\265\b\303\352\323\243\256+\013+\261H\344\340E\375Q\1774\220"
+	.ascii	"\242H\\\211\303\016t\2004\226\330\031\252*^\220\306\022<\304"
+	.ascii	"\341\372\262\026\177\214$z\324\225\b\243\346 \177\326\341z\342"
+	.ascii	"f\345\371A\252G\341Nq\330\323c\324y\331QW\035\325g\205jST- \203"
+	.ascii	"\342\247\205\031t\324\343\313\313\232\203\274\200O\317p]\177"
+	.ascii	"\214\034<\254\310\234u\205\272\026\215$J\250\310\242\321\007"
+	.ascii	"\251\232\020\200N\361G\002G\025y\034\372\304\ba\212\252\005z"
+	.ascii	"\206\307\241\317\fR\355!\306P\303qUM\254\030\366\320\034U\344"
+	.ascii	"O\272\362\030\215-\344\2405\354\fU\023H\342\0132\247&F\006\341"
+	.ascii	"z\025\034 \325\343\317:TQ\244\310\034#\212\"\f.\364\fu\212?\307"
+	.ascii	"\013\324\234\242\221\230\223\023\200\242\221\210<\252\034\340"
+	.ascii	"1\352\030W\343\321\307\306\210\242H\304\353U\200\b\201<\2523"
+	.ascii	"\020\217;\035\334\350\243\036C\254F\3431\204\314Q%\242 \256E"
+	.ascii	"u\207\030\203\314\231\341\300z4\226\340\240\362\3100\214a\006"
+	.ascii	"\241\232\243\356\030/\020\243\356\030{\260\232\223\201\365h\364"
+	.ascii	"\241A\026\215\304\325\307\370\242\256C\023;?C\031R\025\005\304"
+	.ascii	"\023\351\232\036gv\206\352\013<\304a\fG\025\005\212\237\026V"
+	.ascii	"\2543\307\265\304\315\232\243\002N\314q-\241\316@TuT\023\035"
+	.ascii	"\2549#^\326\234\023PX\213\304\237t\315An@\355!\256iq\350sb\305"
+	.ascii	"\261f\270\016]Xq\2549\256%`\340\031\022\217*\322\303qpH\200\260"
+	.ascii	"\001\fL \325\001\241\352\020gPwt\216!\214\304\020E\342\260'\204"
+	.ascii	"\316\021\031\002\304\215\tt\2062\360\360\fI\250<;\304\0314c\035"
+	.ascii	"gu\200M\266d\220\244\222F'H3\306\324%\216\211\225\232\270*.r"
+	.ascii	"\314a\276\036CnFP\271(W\236v\304\241ptaO7\234Fb\242\204zPi\214"
+	.ascii	"\004\t\372f\227U\006\240\307\024\343\003\372\206*\221\263\022"
+	.ascii	"d*A\335\216\320\320"
+	.string	"\236\350\225\300j\252\331\030Mr\247\302\266\272Pui\303\314\273\30564v\004\235\252\372[\"\324kkh\232\210#\030\324\241E\320\"h\232\315K\020~\374\241F\216\246A\341\005y\273Y`\232\210\b\361\225\241]+M\024\325\245\345l\006\372\214\301Di\206B\335*4\274\226\240D0\323\224W\025\250\306N\262\024\255\007\231T\017\271{0\314\210\320\032\243bvpp\213\230\r\021\031\031:vT\3546\004\022\030M\031\t\237\030\315\314\210\214\033\032\243BR`\346\254D\303P\347Q!w\242Bl\266\330X\033Bk\031\201\321E\210Q (\020\364\353\205\344\t\320 G\277\224\204\365\2115F\275:MF\022\026R\272\322\037\3552:R$\270\204\376\270[\260\270\360c\342\343(W\225\245\250\032\215Q-t\353G\023M\357y\276>\255)ma\215Q\036h\217\033\3153$\247r\277\245\340\226\340^\263\347h"
+	.ascii	"\235\260\345\330\201\036\275\274\b\242\305F\026nr\345\326|\374"
+	.ascii	"\320\321=p\225\323\320\223\034x\256N\310\340\025\212\325\347"
+	.ascii	"\203\n\023\031\215Q+"
+	.string	"\324\n\275z!\031\203\224Do\034\2752+\313\201Q\351\217\332\300N&.YL\2520\331\tx\315\243\306(\023e\242SVvZK\202\351\331\337\027\030*utj\256\306\221\275\306hT\027\251\360\344H\211\0074R\324\2364\221A\203\006\nu\303LZI\200\033\217\231\251@!!MG\241\320'\274\245-\023yB\235\352\342\226\244\226p`\026\227\204\326\270j\001\340#J\273y3iN\312\322\032\037\203\214\"\241\001\205t\250sc\363\211L\335rHA\207f\204&)H:#\025@0@P(\027\216\2505\037\023\300\222\310\323\221\030(!S\312\314\214\210\244\240 )T\032\003!=p?yv#\317\2711\311\322\346i\225\264\r$b\374Iv\242\306\016a\211R\334H)B{\216\341\023\336U\224Rc\020\177\374\247.R\330\272z\347\363\311\023f-\246\341@.D\321\336H\313\362\034:2\234'"
+	.string	"\316\247c\341\242\037r\270\237\021\312\311\357{4\257\261y\215\235\30736\337b\325?e>;"
+	.string	"n\356\237'r\211\004*\244\271\016\230\320\224g\325@\352\316\221\254Q\"?\251KL\223pS\002\314\302q\20742>\242rMX\352\2400\305\020F0\260\237:Q\027\300\3212\030\004$\324I\224\273\213\364\264\373\271\355n\321%9NQ\005\200v\025&8+\233\222\030b\203\036\321\227\276\200=\274\n\352\332P2\215\007\277Z/\"\023\331\310\200`9\276(\3661\303;\352\204\177\340\362\025\"g\352+\234\327\021\210:9]\342\003\332,\"\234\0014\240\026\025\276\361rs)\016#G\bwO\252\nV%]\375t\374t\r$\\T"
+	.string	"\252R\365j\257\221\250\006\0137\377}\267l\031\331\320\347\n\277\001C\305}ec\002\005'L\216\263;\315-Ra\035\006\025\"\016\t\270{\200H vD\306\202\353l\363\241\376\231&\364\354\237\3354\362\207\315\036s\211,\001\026,\252+\"\306%*\035\034Y\006\265U\257|v"
+	.ascii	"dn~\324I\224\365\274\352\202\343\206\301\353b[R\032\334\356\260"
+	.ascii	"\f\364\006\026\025\037dV\242\201\313(\333|\330g\215\322\016\305"
+	.ascii	"AL83\220\341J\330\277\367%\317\305\002,\321S/\004\235\372\367"
+	.ascii	"%\2368gyg\342\350+\223\363\370O\254b\320\253\204\236\252\343"
+	.ascii	"\245$\340\305\2215\362/\266\200:H7\275<\224\301\335\232\rU\035"
+	.ascii	"4\361M!\003k\261\301n\\\336\237G>\324u\n\021\305\214\363X\036"
+	.ascii	"\315*t\252\332\0041:b\013\363@\2049KE\323\375cP\337p\002<\034"
+	.ascii	"u+\027\304\244Q,\301\253\246\233\361\261\304`C\264\277\307\340"
+	.ascii	"\006\315\351\302#\346\312\037\022\332\204k\177\217\360\013;\343"
+	.ascii	"D\224q~\"l\230i\374\374\"\236\206\030\313\262\017\322\206*\317"
+	.ascii	"\225f8s\030\223}z"
+	.string	"\307;!\034\260\221\314\275\020\261\r\326\002\346\214\226"
+	.string	"\\\346\037\371BwA\177 \371\301\343.3Ah\377\274\316\354am\022F!\363\002\325\242 \020\357\277\305\031\rd\264,.Y\242\360\r\032!O\333\344\326\336\031W'\007\346\347\354\230\362\357\024\feJ\3466\203E\007\331"
+	.ascii	"\342\214I'^\336\227kX\2018\300\021/\253\212T\237\223\205\261"
+	.ascii	"`N]\254}d\210AQ\274?\022\356\027\277\327G\247\013kg\316\207K"
+	.ascii	"\276c\371u\035\n\352\f\b\342Z\227\036\265Dy\240\322\303\310h"
+	.ascii	"\343\334\370\203\317\333f6\2543\362\330\332$`\251\311[\256\374"
+	.ascii	"\035\205\321\236\225\230\302:\270\004\220\215(\037\036\rt\247"
+	.ascii	"<\233\n\314~\357\330\234*\223<t\367\212c\344\016J\304\240\321"
+	.ascii	"6A\313"
+	.string	"\327\266\206\034\214\215\266\235^_\272\372\367\244\275O\210`N\343J\036l\340H\005%\201Jt\022Ai\\\bhT\0303\201\220,\223\177\241d\373\270\263\023\\Dv0-\335\2102\227\305\002\201]\245~\257\227\255x{-\203\001\377i\031|\220\200J\004\231j\247U1\3313\251\023\3310\214O\006q\326^\376\3747\361<\3527!\205\354\207R\365\272\304`!\3140=\203q\347&gd\266O\255&\005\341\245k=\204\360\205A\266\201t\314\361\364\261\303.<J5\032P\025\226\306m\330\2539\2608\022\343\005\3724\250\316\362\"\024V/\366\257\246\332\235i\207\221\316\362q\314\202f]M\277\355j\253U.y\250y\370d\225\213}\353\367\264\2112\364Q\fn\365\247\2638\302a'\255m6\303\206^\026\001o\204!\242\213k\246c\334rw\366V\341\"B\332\246\333\247}\242\330\341\330\217\245\032\263;"
+	.string	"<\235\242\261\311\213t\2152\366=\350\364\\\307=w\346\211\245$0;\213\2404\221\317\016m?\305\277#\222\225\332%\324W\030t\230\235:\276;\314\2041$\324\267\317\227<1\242'\237O\255\344\323c:\303\036\357YB\202\035q\272x\226\273\215\372T\007G\007\273#{%R\215\022\375\031\242\200\025+\341\255d\235\322\245\362e\343\234\fJ\345\236\0030\256>\253\037_\267\002!\257\037\3325\275\013,\267\013\001\307\003\351\247I\251\224z\307O3n\035H~$E\320\266\034\004X\324\016\\\335"
+	.string	"\250j\3362\250nd\340\210\336m\347Yh\250y\243\216\237j\016\023\351\302F\311u\013\274;\337\230\322Y\350~\375\020\234(\301\233\201\027NXm/8\211\271h\320\242J$,\327\347\270<G\324\221\032D\305\255\325\204\266\021\373\317{\242\327\244\216l!\343D\221\212\275\330\207F\200\206\221\250\207\302\002\267\200#\256gi\232\376nvK\310\271\362_\367\\\301\203\322\005\200\177U,\207TO\375\351\271\n\2301\375\371\222' \3427\225\272\033"
+	.ascii	"\204\177\017\037\325\032W\324\311\307\r\3419\002\307\210M\243"
+	.ascii	"?\302\315k!\365\256\320\246\227\311c\b\311\324\371\240+\240\220"
+	.ascii	"\300\337\231\005\224\362-p8\243\022 \030\271]\216P\261\314\022"
+	.ascii	"0\305\025|\017\212)\210\333%\372\265\237\005\367/\023\240L\345"
+	.ascii	"\202\3255\242\362\336\302\351O\244\371\27270\351\216Sj!\326\372"
+	.ascii	"?_\375\t\335'\306\271\240J\262\035\231\347\n5\016\026\340\266"
+	.ascii	"\036o\237*1\261k\355E\247\005\034\003\2467\240\021o:\333\364"
+	.ascii	"M\016\270\306\335\321\037X\214CB<\276\3670\375\023\317\2229\036"
+	.ascii	"\312\275\356\365b\330\316\0363W\020\037|\"\340/\005\013\271\013"
+	.ascii	"R\210\276\005\b\260\364\252Z\203\006\374_\n\321q\305\231^R\b"
+	.ascii	"\340u\312b\334\367}5\365\232#b\377M#\265\226\016u\211\335DI\303"
+	.ascii	"*c\263\252.\241\017`n\340i\245\332\037\263\371!\257\t\347\177"
+	.ascii	"\336]\351M\346\311\"\026\367YF\002\250\032?\211\\\224\253\364"
+	.ascii	"V\222\247\307c\352\035\311\216\305\212\001\234\241\263)\226\257"
+	.ascii	"\262\360m\353\327\353\237\342A\311\r\342\303\202\3565\316\031"
+	.ascii	"Dq\222\304aB\312f\340a\fc\177XtY\004h^\"\227h\251/\301ul{y\251"
+	.ascii	"Y[\206\005.|x^Wh\220n\350\033\364*\220\234\357\304=T\004\235"
+	.ascii	"\235}\251f\343\263\356o\262\223\240\335u\300\241\0060\352\263"
+	.ascii	"\267\277\212\260\035x\371\300\234*\246\345\322\332\350ge0\273"
+	.ascii	"\020EI\324\316\350AT\313\302PC\216\201\302F\202\201\260\t\225"
+	.ascii	"\306\33255o}\362e\r\206\224\254\025<\304\260\327\366\305\344"
+	.ascii	"l\336\350\274\230\371\025\234Y\036\360K\n\002O\252\212T\2672"
+	.ascii	"\321\232\031\025z*\0249\350I\323\210\020\313\317\035\270\223"
+	.ascii	"7\346\374\211\210j\237\030\277\227r\212\203\315\247\234\313v"
+	.ascii	"\204]\204\347daK\304\216l\022c>\222\005\360Q\037\037$\013j\207"
+	.ascii	"'jR\030-\205Q\027\211\034oG\3451Z.P\304!\332\225\0365\"f\233"
+	.ascii	"\303D4rcH1\206\376/\227\342\306\247\312\354\351\003\211\022\006"
+	.ascii	"\035\001o\244+\352\305\246\346\337\271\220\344\240L\231\236~"
+	.ascii	"\321L\303\034*\351f}\340N\205E\230,\214wC7\204X\335G1\334\206"
+	.ascii	"\256\254\267\017R\021\200\247\277}\204\273'\356\317y\340\277"
+	.ascii	"\224+\t\026\216\324\243\271FD\235\rN\365\204\n\032\234\232\363"
+	.ascii	"<\b\273\216-\250\372\367\310\020\227\203\315\241\375\357\260"
+	.ascii	"w\343v\004+N\276\247\2419\321\037\270LB\206\2447\210\271h\005"
+	.ascii	"\260\234e/h\331m(\030A\271\331/\032\214\023DB\312\340lV\016\236"
+	.ascii	"\361bw\373\r\27062\1778M\020\302\206\022\355s\246\353\201\t\271"
+	.ascii	"e\226\244\343v\035M\300\307\367-*@m\230\035\277\004\327Q\261"
+	.ascii	"8wcP\026\bK\202v\0176\251\230\356\017\361\034\317\236\222\312"
+	.ascii	"\363|\305\276\213\020D\253K2_\361\311\320\341\217\267\304\256"
+	.ascii	"\347\270\317Z[\237\372\201qE\231\301\371'@\2418\364\020\245\211"
+	.ascii	"\310\373\207\b\343\204\367\021/\027\035\221T\013\2510d\3555\357"
+	.ascii	"\362\222z\305\004\221Ua\366'T9M\020\343w\263}\246\351\355\276"
+	.ascii	"\374\352\341\303\335\241L\337\036\316\352KE\177\231\324\004\264"
+	.ascii	"u\t_\t\310\030S\232\257D\233r\365~\312\t\257zA\024\3151\335\221"
+	.ascii	"\271Fj.7\321\0036n&\374/F\rh\375\260\221\213\374\201\370\226"
+	.ascii	"o/\341\337\"\377\314\016\353\006\244\037\303\r\3707\365*\034"
+	.ascii	"\206\t\036\352\373\334\365\254z\246\363\350Tc\345\020\177\005"
+	.ascii	"`\255\212_\245\374\306x^c\376\207L\007\207\365^{~\0069\245\266"
+	.ascii	"V\261E\377\020j(\304=\311\2117\332\317\276S\332\330\360!\371"
+	.ascii	"=\301\024\005'\342\034\001\030\314\276\342\370\361\035\177\207"
+	.ascii	"k\316T\311u\347\177\217;\343\337\310|\301\374#\377\355\232\322"
+	.ascii	"\n\377R\3563\032M{L<M\373N|W\333|M^\300\260\225\326\274\273!"
+	.ascii	"\276\220\257\266\234\200\017*Z_;\032\334\202\376\0353\346:\023"
+	.ascii	"\317\034\026\333\234=\2143~FP\030\202\220\361\367\216+\314\247"
+	.ascii	"\355{\t\316\\\372\340\363\013\265\243\361\177\374\305\356^\351"
+	.ascii	"\n\373Q3\362\243\242#\270\327\364\2375o\276\360\275t\376\346"
+	.ascii	"\217\034\373\234sF\"O\353\331\327e\3665\372\266r\271\360\266"
+	.ascii	"\312\007\001\342\250\374\201\3466\367\224\377\237\375\241\330"
+	.ascii	"\275\256\365~\310\343<\374\2059\337\362\333\033g\262Ub\256\356"
+	.ascii	"\341\223\343\022\277iz\251\371\202\254E7r`\2221\371\205q\331"
+	.ascii	"\237s\357\031\017\365_\230\n\016\236"
+	.ascii	"\356\362(\323?\215\0030#_8'\216\224\027\342\037\362\314\2352"
+	.ascii	"\033\236'\257\001o\267\374\177\347\275{\303\017;\307\006\361"
+	.ascii	"Q\355q\367[q\201}9\210GO\243'\264\275]\317\225\177\264o=\334"
+	.ascii	"N\377w\353_\2631\375\\\367\213\376\016\275\221\370\0271N\276"
+	.ascii	"\225\374\363_\225\373)\017\013\357\030\266\032\177HGM\027\222"
+	.ascii	"v\220\341\326\336^^\360\036z\bjQ\253\271\253|\220B\272\002"
+	.text
+	.section	.gnu.lto_.symtab.5e0125e648a5bda1,"e",@progbits
+	.string	"waitingResponseQueue"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\001"
+	.string	""
+	.string	"runcamDeviceInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\002"
+	.string	""
+	.string	"runcamDeviceSimulateCameraButton"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\002"
+	.string	""
+	.string	"runcamDeviceOpen5KeyOSDCableConnection"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\002"
+	.string	""
+	.string	"runcamDeviceClose5KeyOSDCableConnection"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\002"
+	.string	""
+	.string	"runcamDeviceSimulate5KeyOSDCableButtonPress"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\002"
+	.string	""
+	.string	"runcamDeviceSimulate5KeyOSDCableButtonRelease"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\002"
+	.string	""
+	.string	"rcdeviceReceive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\002"
+	.string	""
+	.string	"rcdeviceConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\002"
+	.string	""
+	.string	"serialRxBytesWaiting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\002"
+	.string	""
+	.string	"serialRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\002"
+	.string	""
+	.string	"serialWriteBuf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\002"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\002"
+	.string	""
+	.string	"sbufWriteU8"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\002"
+	.string	""
+	.string	"sbufWriteData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\002"
+	.string	""
+	.string	"crc8_dvb_s2_sbuf_append"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\002"
+	.string	""
+	.string	"sbufSwitchToReader"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\002"
+	.string	""
+	.string	"sbufBytesRemaining"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\002"
+	.string	""
+	.string	"sbufPtr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\002"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\002"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\002"
+	.string	""
+	.string	"crc8_dvb_s2"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.5e0125e648a5bda1,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
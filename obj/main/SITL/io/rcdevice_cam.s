@@ -0,0 +1,886 @@
+	.file	"rcdevice_cam.c"
+	.section	.gnu.lto_.profile.1b2800bf416ea86b,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.1b2800bf416ea86b,"e",@progbits
+	.string	"(\265/\375`e"
+	.string	"5\007"
+	.string	"B\212'0`K\324\0300zE\2364\001\001\327\367\371'\325\256\377e\030\324\255a^_\b\363L\222$\001[\024LV\302\n\335ZF\266n[BD25\031\031/\314\313\002\232W\0214\211\005@:\f\013\t^\265/\365D"
+	.string	"%\016\017\035\365G\211\221\315\232\340\322\n\205|TPH\032\031\326\027A\021^|Z\307\263\321\321:\224\0138\337\004\005\002\306\013\363\262m\336\363<\376\fwn\336\007(.\242R\321}\327\231\265"
+	.string	"d;`\224\203\303P\030R&\r\033\313\377r\256\3521\021\351\262\312\305 \037"
+	.string	"\3600\013\002V\002\374$`*\004\020`\205\300\r\201\023\023\340\002\330k\236\b\2400\027\311\034\344\n\006aF\301\261\224\026=\361\272Y\373\022\261_`\013\023W\005\373I\342\205"
+	.string	"\004\230I"
+	.ascii	"D2\020`\001\206"
+	.text
+	.section	.gnu.lto_.ipa_sra.1b2800bf416ea86b,"e",@progbits
+	.string	"(\265/\375 \233\325\002"
+	.string	"\322D\r\023\300\2471{\357\377\177\353e\332n7Zj\333\250\2242\245\356\036\311\r\013\223\330=\177\372\310\306\fu\352\265R\331F/\320S~\340\320\227X\241z\333Wp\t\016"
+	.string	"+\003\202\""
+	.ascii	"\346\300\245\206\331\f\001w@m\260\002\241\244\316\214iA\224\331"
+	.ascii	"z\332x\261n\003m"
+	.text
+	.section	.gnu.lto_.inline.1b2800bf416ea86b,"e",@progbits
+	.string	"(\265/\375`'\003\355\020"
+	.string	"\266\331T? o\223t\001\251\347\212\0278\200\233\226\205y0k\365\240\234\315\"\266\345\350\301\302\020\202m\001yTK\036\021\377{?H\b\230\003\b\b C\203\002\214\272e\255\t\315>b\264'\277\021\271SA"
+	.string	"D"
+	.string	"@"
+	.ascii	"\"\035MBh\204\002c\rh\r\250\375\227\211z\324Tg\244\277=\255\327"
+	.ascii	"\343^A33K\371\255\342\310\001Q\204VA\336(\225J%\344p\003"
+	.string	"\250\001|B\016g\225\301m\364h\226\231\227\317x\032\020\325\324nE\002.@C\306\030y\241aC\201)D\215Z\332\377\321\017\020H$\314>.h\b\n*H\213xZ\003\302\251\327\350\023\247%&x\310(\367\335N\321\301S^\021;`\246!_\311\332\230\300e\032[\036\177Wr~\327\357\332\264\222\320\210\005bn\032\201\204I\346~\030\306\351\210\026'H\246\037\225\277\315\243^g\312\3736\357\327\311?%\311\314\3526\0213\326\266\\\025\233aU\221o\326\020\021\270{\324$31\226\255\374((3\251\253;*\002\201\341\0043\364\n\026\\\210>y\343z\237\201\023\205]_\330\330\246\205F)\262\216\371'\363\240\342( x\300Ym\260[\221\242\344\202\2001\236\346>\315.\335DfV\002_\250Q\275bHd(\214\244\260\220\351\200\"\2421\353\001\021\220\271CT\244\255L\233\001P\360\325\027\302"
+	.string	"\342\340I\246lNH~F&"
+	.ascii	"\n\363(-\020\312BwG $(U\241\333!\211\375\017\213\322\034\005"
+	.ascii	"\324Nf\245k\311L\263\210\262\032\261\267p\265\327X\021\313\017"
+	.ascii	"/\325[d\236\310\365\352\267\316[\236A\b7|m0\022\2339\214\376"
+	.ascii	"\274T>O\321DP\233\363\350\360\247\030\346\220\203v1\372'\220"
+	.ascii	"\266+\260\2224jD]\031\021\215\240\314`c\260\372\264\270\367\\"
+	.ascii	"\256\200k\345\013C\023\207\203\\\007\025\324\233%\270\340\254"
+	.ascii	"\327\263\341\016t\3168|4\230<\257\365\343\365\367\202\016\276"
+	.ascii	"yb\375B\275\"\325\004"
+	.text
+	.section	.gnu.lto_.jmpfuncs.1b2800bf416ea86b,"e",@progbits
+	.string	"(\265/\375`\357"
+	.string	"\345\005"
+	.string	"\202I\033 \240'\351\377\340\377\371\227?"
+	.string	""
+	.string	">BU\260\251\252\177\331\266F\316\371\263\337\377\372\275\355&2\311$U\225\246\355\033\210\374\334Hs\222\254\265\326\264\002I\270\361\214\007\216\031\206\334\242e9q\255\225\351\003\207\237K?\327\021%\273s/6RMe\265\236>\251\241{\350:\025L\023`\347\270s\035Y\325\"n\321\344)U\351)\340\217\037"
+	.ascii	"U\213\023\034\032\024\376\343\211@\024\004;\233\211\233\005\270"
+	.ascii	"\032^\001\335\327\004\021\225\002pn\337\006\324\031\002y@73\202"
+	.ascii	"\216\007\202d\240\t\032) \370\016\235\333S\331\200Y\200\246\001"
+	.ascii	"\335%\020U\306\243J\301\314\345\247\275\005p\003"
+	.text
+	.section	.gnu.lto_.pureconst.1b2800bf416ea86b,"e",@progbits
+	.string	"(\265/\375 #\031\001"
+	.string	"\037"
+	.string	""
+	.string	""
+	.string	"\n"
+	.ascii	"\230\004\003\231\004\004\271\004\b\231\004\f\230\004\r\205\004"
+	.ascii	"\016\230\004\017\230\004\021\230\004\022\270\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.1b2800bf416ea86b,"e",@progbits
+	.string	"(\265/\375 \335\215\003"
+	.string	"\344\003\321"
+	.string	"\n"
+	.string	"\001\274\006"
+	.string	""
+	.string	""
+	.string	"\001\002\b\001\003\001\002\032"
+	.string	"\001\002\020"
+	.string	"\001"
+	.string	"\001"
+	.string	"\300\007  "
+	.string	"\001\002\033\004\034\002\b\001\024\033"
+	.string	"\f"
+	.string	"\r\002\002\035"
+	.string	"\001\002\036"
+	.string	""
+	.string	"\016\017\001\002\021\022"
+	.string	"\025"
+	.ascii	"\013c\200T\362p\022\020\\* \343\351\f)X\265\341\017V\266\005"
+	.ascii	"\344@\02663\325\314\003\026U\331\031e\301\3168\305\216g\263\335"
+	.ascii	"\2320h\003"
+	.text
+	.section	.gnu.lto_.lto.1b2800bf416ea86b,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_camDevice.39.1b2800bf416ea86b,"e",@progbits
+	.string	"(\265/\375 D!\002"
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\001\202\200\200\374\342\303\265=\177}"
+	.string	""
+	.string	"\013/root/repo"
+	.string	"\035./src/main/io/rcdevice_cam.c"
+	.text
+	.section	.gnu.lto_rcdeviceIsEnabled.45.1b2800bf416ea86b,"e",@progbits
+	.string	"(\265/\375`)"
+	.string	"\r\b"
+	.string	"B\21777@\217\322\001X\360d\r\220k\225\003\307\023\023\214\270\272\216b\352nw\037\323\267z\373\327\003}P\210\253K\320\330U\024\b\323\215\033\216\366\373)\341\2741B\266\224)\005\3262\033\215\346\260i\\\305\366\240y\261\343\"\004\247\331D\315\343\304\f\201\273\210\315\213\023]\347E\314\267\207\253)\250\005#%\331\367d\251P\241J)\205d\211\213x.\273\313\340\177\026\234\213\352\223\035K\rX=\344\253\217\2572E'o:\346w\262cW\201\225\214Q\276\354O\224\312a\037\256\246l\247\241\2463\323\307\022X.\226\201\326\356\351\325\262,\f\345\3036\310\306Xa\001\344\320?\217\3237.J$\256\335/j\307C\317\220\177\220\037h\224\214\264LP\242'@\303\356:M(\214[o\333\3006\202\355\223\f"
+	.ascii	"2CW\r\314d\202I\032\3331q\205\n\256\241\356s\rg\032\361\230\020"
+	.ascii	"$\334\271W;\237"
+	.text
+	.section	.gnu.lto_rcdeviceCameraControlProcess.46.1b2800bf416ea86b,"e",@progbits
+	.string	"(\265/\375`\306\tU0"
+	.string	"jR\364\021D`^R\007\363\240P\255\023\216]\234"
+	.string	"\003\372*\343\007\037\0164\303\314:"
+	.string	"Ex\025,\3444KB\250x\204)x\025}\261\361\"\224\f\263"
+	.string	"\034s\271:\322\251\340s\2506\b\234X%\266\211\334;\245\224\002\023\001\362"
+	.ascii	"\020\001^\367\3366\353\266\033\315\205{\316\314\275\027\270\205"
+	.ascii	"\233m\355\r\314I\205,\334Z DP6\364j\275Qzn`E\034\254\215\205"
+	.ascii	"[\255\317\032M\331i6V\254\346\352\006%bwoZS\253\314`m5\251\213"
+	.ascii	"\266\325\264\211\266U\346\033\314\300V\037\310J\346\272N\013"
+	.ascii	"\273=0\257\255-y\367^\247g\302E\256\354b\021\221hh\b@\030\024"
+	.ascii	"\002\376|k\317\252\351\273\222\273\367T\326\316\005\b:\347\306"
+	.ascii	"\205\325\305t\350$}\260\364\242%]dM\354=\021\365\236\206\206"
+	.ascii	"a\016@\350lC\342A!#o\255\004L\222\322l\342?\"\356\033[S&g\032"
+	.ascii	" -\327\364J\213m\300\352"
+	.string	"t\264\225\2444\207x\357\210\035~5\213\330!\327\226\035*}5\307R\373\003\023\273\373\352\032k5e\262\373\262G\310\225#-\372x\302l6-O\345\232bi\222\226\366\035\\Y\376\255\326LC\274`\351\363\325E\326\336{\272\367\2623\271\272\232\215\232\271\333\230\031\003\363\n%^:\375\376bF\321c\254\032\204\335{%0s\215\026\223\002I\316\275\227\002\230\016\243\202\233\254U\206Jz3\223\357;#\376\177\263\265J\205H\227\255N\273\367\246\377d+\353_\005\235\223\345~8\350\302gn!\345\315\364\027\256\225\305e=\026\267\234\276\262\375\304\367h\016\347\322\007\261\360\373[K/qE\241sl\202p\370\240\277\367b\375?\231\323\226\336\367\336\313\257\204\271\327\232\233~\316L?\347\245\2373ru>\256\316\013~\316\n|\316\tVg\004\253\363\201\237\263\222\3179iu6\260:#\035\375\234\215>\347"
+	.string	"\251\263QC\233\211\251\363P\2475\013\255s\320\347,d\235\201\253\363\257\347\354K\235\327\325\271\327s\266\251\263\252:\247\326\371UgO\235\273\201\205f\336\235\261\313\275>\006\001\272q*\030(\275\326\r\355N\353g\356h\23278\001t\275\364\375v\264J\277\364\306\037\032\320\033\213\350?\312\263\022J}\222\276\337\320"
+	.ascii	"\377\311H\333\373\027\203\322\3055\322\332\357\2751\320\226W"
+	.ascii	"\002gV^Q\226y3\3557\233$\313\307jU\020\\\336\357\310\032\371"
+	.ascii	"\344\240t\335GV}\243\273\306\273R\232)\321\224h\266U\325\273"
+	.ascii	"\360 \3721\006\347\273`\r\274\343!-\322\033xc4C\333\331\260\336"
+	.ascii	"\233%\201\233N\327\341\320\301\2037\323\203m\025\351-\320\235"
+	.ascii	"\025\215\330\035Y\217\226i\225\363>Z\3433=\373\226\3272\312\037"
+	.ascii	"z\016D\201(\213\3508$\212pB\224\340&\233\262\255\032\277@\223"
+	.ascii	"3n\271v3\305M\306&Nx3O\330V\003|G\233(\214\235\323\314\253\315"
+	.ascii	"4?ay N\002bv\245\307\206;\216\353z\316k@\032n5\\\327o\214p\334"
+	.ascii	"g\270\256\313\230\021\3206l\253e"
+	.string	"\370\216\327\275X\355t\346]jU\370\30255qZ.\350~\321#gS\347\375\257\266\360\204\351T;UTR3\240\\D\255XkD\261x\321\301ER\206\024\215\030@\251\346\244\203)\250\244\212\250\244\324\214(\026\311*'*)\247\027RPSN\311\252\030N\016\216\230\nFT\225\223\f*\252*'`\032\216.k\rh\315>v8~Y\374'\007\335\210G\257\212y\303\265\360w\020p)\235\026\375\223mX\341\037}\253u\003\265\350rn\315\271$\343\304\177\036\261:\262p#)\n\024\211 'O\260\r\237\345\034\033\321?\031\350Bz\002\231\037\367\225\365\260\262'C\317\273r&\324}e\233~\207\225eF\341A\034\210\377\b\336\351\311\313st\340\013MQV\361fr\222\326c5\205\336\327\364\300\037\341,#\240K\353\313\320?\371\364\257\367\264\357\177\276\341?\363\364\020\236^\177\310y\254=\336"
+	.string	"8\276\343!\355\202?\2761\232\301\231\256c\201\020\371\335\226\366\321*x\344\007\317\321\306\"\\\313\212\002_&\370n\353\016\322dM\360N#x\307C\332\003\217\340\215\321\f~\007\035\020\372g\200\304\250q4$\025D4#\"\222$\005\311p\260\002\021\242Z7\021@%%\214\221\2206\205\264g\002\257\b\254\330\274\306\244\255:\312\334\300]\035\334\f\372\220\345`WP\034\234\004\310\231\357l\245\227\305\313(\020\2158!d(r\207\223\224+\243\326\345\b0636\221?\t\212\247\235t\nW8\\\326\265\277F\215@\016\005\tT+\345\334\301O!\214\034*\027:u\013\371\374\006\277\355V}\022{\244\034\276\023\211\372\3527\240U^\030\363-\255\304A8\027\033\265A\030\b \320\030\226\016\034\007\352\322jD\017\0210b\303\237\221"
+	.ascii	"\270Hb\005,\307\220\274qpl\236\207\272\312\223\316\202\253\357"
+	.ascii	"`z\026\213\261\274vi\271\037w\301R\034;\336\353\033A\215Kuq\226"
+	.ascii	"\306f\365x\314\003GH\026\264\037\343\357\t\372\025\323o|U\253"
+	.ascii	"\332)7*+\305e\241\235\303\003\f5\013\323Z\212\250E\033,\277W"
+	.ascii	"\020\327\206Y\361\311\345\324x\351\354\036\230C5\363\314\337"
+	.ascii	"\205\335O\005\300\233bp\253\332v\237u\206!\267\330\fL\265\030"
+	.ascii	"\217 oi\242\260\353q\260\365\363B/\370'z\362\360\261/\216\252"
+	.ascii	"U\2758k\366F\026\351N\033\r^\034\340\3510\341\377G(\327\306\361"
+	.ascii	"c\374*\2744\253\251\362\217\242\352D\201\375N\001\315\222/\350"
+	.ascii	"0\343d.\310\347Q\026*\032v!\274=Un\034\361PT@\330W\b\345K^\177"
+	.text
+	.section	.gnu.lto_rcdeviceSimulationRespHandle.48.1b2800bf416ea86b,"e",@progbits
+	.string	"(\265/\375`\357"
+	.string	"\265\f"
+	.string	"\306WVC"
+	.string	"\2216\0358\253\2231\257P\200\253>;z\031\177L\233\201]\036\240nK\323\276h\314\305Z\312\366\366\021Ep8\230\206\221\340Vv\311^\265\376\377+\355z^c\001\024\261\2368&\252-m\"eJ\001D"
+	.string	"A"
+	.string	"B"
+	.string	"\216\361\357\303bD\030,\260\274\354nT\017\357\016)\315\316\337\360H\016\255\223S\nJQrq\302;\271R\007B-L\002x\036\212\243\205\003\214\223\236\027\274N&&\263\273\316\217\007\272\253\333^`;\332\307\002\207\232>\206\201\351E\206\201\323n\311\251\306\232 \213\020\376\210\257\210\374\263\202P\\\207\266\210}\035\376\262\375\264\237r\225\356\243\021\002\002\326S\312\240b\367K`\004\326\241\277sT\207\326\007T\207\356\034\371\317\307\312SD\211K(\305\345 >!\223:\244\272:(\275\360$\r\333 g\tQ\340\223\330P\260v\367(\207\376Hux=\351\251\301\304\024R\031q\362d\177\235T\221}jw\327\332\301\376\350\001\0256\230\032\353\320<\260\006\032,\233\240y\200qq\313b\204\314C\213\030\007\022;\nx\223\240\341\342f\333\270x}\234g8\332\201"
+	.string	"\022\252\235A\310\177|\3223\036%\311\0253Z6P*\322*\277\304Mh>\212\267\217\027"
+	.ascii	"2\003\3020\323\302\316\021He\3666\332\302\301H\334\325\0010\321"
+	.ascii	"\004{\200\352\211\270\347\020\353-\341\311eJS\361\202\306\306"
+	.ascii	"B\244fue\\\3137\305\223j\262\242KA\001"
+	.text
+	.section	.gnu.lto_rcdeviceCamSimulate5KeyCablePress.49.1b2800bf416ea86b,"e",@progbits
+	.string	"(\265/\375`\241\001\275\016"
+	.string	"\226\235cA q\223\016\037\241x\030\240\021"
+	.string	"\367\247#L\206\306\031\223;\301\330\330~\226\031\303E\314\266f\354o\211\3665B\322\273\025$%H@`p\001\362\342C\224;\200\355\332/\260\330\265\021\262\367\2262\245R"
+	.string	"M"
+	.string	"Q"
+	.string	"'\216\"t\226\013\357cK\036:\300\330\345\022\030\201u\2309H<|\037\020\017\035\262m\234\013\261\325\211\206\212\212\034\273{)\210\207\016\237f\310\257FP\277l&\321\341\003\271\336Tz\231\335\215&Rf5\262\273\316\315\244\341\216\267\375\300\266\003;\t\004\335E\"\324\247\316\024\016\244\354lN\224z\262\377vw\255\037l+\246\253s,?\204\351w\356\326\227NM\037\023\200\304\fMj7C\267ce\300\026\021\347~\373G\031\343\005\fB\347P\254\035Q\2558\325\270\261\313\0358\264\002\353i?\234Nv\342a\352e\203\352\365\250\0330\221R\3511\312\016V\032\025"
+	.string	"\216Qv'w\021\342\006>\213\267\360\274\257\034Z3\211\337\016}\223xX\351[\236\236\216\022-\005\215\262sn[\340\311\303\177\356\256H\365\344w\221\370Tc\224R\207\005t]\027$\032\007\264\371d%\332\305B\326Qc\032\317\006\213\220a\234\223L\002\366\2714\316E\302\331x.\354C\341\322\204X+\311>\027H\323>\027\206\333\253\245~/\252*\006\b%d\214\224\344\217|\212\rf\355\216\276]S\355lB~s&EE\366_<U\301_q\033"
+	.ascii	"?\003\3020\260\215\031\036\013[`&\236\031T\216\262\212W\226\263"
+	.ascii	"e\bk9'\254$\252qRWw\033\f@\360\032\301\254\307\005\027\313\f"
+	.ascii	"\307f\005\013\235\301\255\001\247D\007w$(\033WR\364l\343\023"
+	.ascii	"\312\023"
+	.text
+	.section	.gnu.lto_rcdeviceSend5KeyOSDCableSimualtionEvent.50.1b2800bf416ea86b,"e",@progbits
+	.string	"(\265/\375``\002\315\020"
+	.string	"\366\335iF\360\262&\035\242\353\226\344\022:U\352\263\032\242"
+	.string	" Ffz\237\234B\314\bz\006`\020\343\206\322\274\324\212i\335H\t\324\356Xb\372\320\331\204\027\317\3003\360{\223iaO\006({7\205\235\006b\311&R\246\024V"
+	.string	"R"
+	.string	"V"
+	.ascii	"\006\270\307\223\017\330\036\265\013\330\036\215\262\203\036"
+	.ascii	"~\330\363dX\355\004\331\335N=\034\365\320\0265M\224\237/\035"
+	.ascii	" \353{(\301\217-O\340\210\\\353\332u\256\2210\341\003\262ZW\031"
+	.ascii	"\030U\314&\002\302\3010\302Z\305\f\245\354\256\023dU\270\271"
+	.ascii	"\333\236`\273\263SC\333\243\023\334\225\b\327\332\330Ga;Hy\320"
+	.ascii	"\354~\257Ip\013<\252f,G&\223E\354\360K\355`_g\263\231\017\353"
+	.ascii	"\215}\330\257\231\316L\177\304\304\302\016\004=v)\314\206\254"
+	.ascii	",\316\030Ab\373i\377\365\034\324a/Z\200Uq\250\371\331\r\0178"
+	.ascii	">\213g\254\206\006 \037\226\032p\273\251\203W\333\345A\036\364"
+	.ascii	"I\214~\366\177.C\202\037\302\021Ny\360\321?m\217W\235\241Q\202"
+	.ascii	"&\2253\337\305K`\262/\211\030\b\347B\217\366\3701\356\345Z\233"
+	.ascii	"\027>\214\320\006\327.\217\337b\003\241\342+\276\343 \356\361"
+	.ascii	"/\001\247\021\213\332CiY\361TF\036\t\302H\201g\352J\244n\001"
+	.ascii	"i\245\245\363L.\035\n\001\227\030\214L\235\203R\311\324\221\204"
+	.ascii	"{m\365F\347\234OK\226R\030?\274S\264P\252\255b#Ugr\b\211\361"
+	.ascii	"\214\t\331LR\325\366Fy\320\242\030\020\231*\305KnDQ\332$\026"
+	.ascii	"\325/2 \260\002\031\312q\003\"B\377\312\200\221\310\250\177\""
+	.ascii	"\3416\270gE\231\245\310\341\253\341%E\270,5\240\345]I\271\005"
+	.ascii	"\250\362\214\f98\270\267\255\017m&\0304\353\350\361\336\242D"
+	.ascii	"\304\021\344\275\224\r\243\r\021\351\026\345\036\307\355j\220"
+	.ascii	"\305aWy\312\005K\354\247\004\037\201[L\2246\031D\213\3067\\\204"
+	.ascii	"!\236\233\363\235Ye\321e\364\t"
+	.text
+	.section	.gnu.lto_rcdevice5KeySimulationProcess.51.1b2800bf416ea86b,"e",@progbits
+	.string	"(\265/\375``\013\2553"
+	.ascii	":Yh\023D`\236\326\030\367y\312Cb\335=\002\262\367C\001G\244K"
+	.ascii	"\321\312\024\3156\367h\350;.\327\353p\003\366\314\314\343\355"
+	.ascii	"\037v\314\r>l\360BQ\274\r\006\316\365\352\026e\244.\211 \267"
+	.ascii	"\334M$\221R\246\224R'\001\006\001*\001no\027}i\364\311y\351V"
+	.ascii	"8#\275\326\314\035\345f[\223j^E\337g\227\245\335\235\355\275"
+	.ascii	"o\264@\257\334\240\355\225\033J\253\251\350(?\026\275\275^\231"
+	.ascii	"U0\007{\365 3\2673\367Y?\231j\264\025\354\276\357\227\031+\357"
+	.ascii	"\033Eb\003m\257\315F\262\275\252md{\345)f4\035\025\362\376\302"
+	.ascii	"\252`\261\355\275\357\233\364a=\325A\314\245\022\350\307\247"
+	.ascii	"'\211<\032yvt\212\304\2410\bt\333\037\273\252\357S\334\300'U"
+	.ascii	"\0071\227g\256t\342@M\374\307\207\211\367\030\361$\032\231#\213"
+	.ascii	"\034\211\030\207\360\214\355\230\211\271\016\332\023/\372pb\227"
+	.ascii	"\017{\270P\b\017\017v\235\326\216f\353\2412-4\007\016\271*\001"
+	.ascii	"5W\364\2204\310\262\272L+\207\267]\246\305\345?4,g\273NK\207"
+	.ascii	"\332|\3377\370l\341\253\022Z\364l\372U\003\255U\225@\327\027"
+	.ascii	"\033\304'\013\025\t\006\210\231\340\363\312_\025\002\3631%>\255"
+	.ascii	"\324\246\027:\254Nk\207\361\274r\377=x\337\227=\353Y\243Y\250"
+	.ascii	"\231}\0033;`v\243\001q\032\270\211\364\312\0338p`{\365\3468\266"
+	.ascii	"\327\365W\251\236\031\\\225\3671\334\024\036Tl\024\253>\210~"
+	.ascii	"k+Q\035\226\226\376\267\362\2408\230T\255\336\245L\224>\325\210"
+	.ascii	"\375\367 L\327F\254\377\377\357\214\2163\177`\362\316\362\357"
+	.ascii	"\035^VO\325\r\347G\237\224g&\213\324\326I\361\256\034\016w3\331"
+	.ascii	"~\244g\307\342\262\352(-\245\211\233\b\213p\362\316rb{\355\357"
+	.ascii	"\264.\n\223f\312U\345}\314Q+\177(s\253\357\2031\367Zs\002\240"
+	.ascii	"\263\222\352\214\324:\033\271\316\003\\g\001\255s\221\353L\344"
+	.ascii	":\007h\235\001\264\316C\256s\323u\026r\235\203\\gf\353\274l\235"
+	.ascii	"\225?g\240\237\363O\353\354\343:\367\270\316\311\326\031\351"
+	.ascii	":\037]gc\353\314\343:\357\270\316:\255s\361\347Lt\235\207\256"
+	.ascii	"\263\260u\016\272\316@\327\331m\235[\327\371\347:\263\255\363"
+	.ascii	"\372sVY\347_\235]un\005En\272x\204\005p?mg_;@q\200~\265\321f"
+	.ascii	"\306\205 \306\236T\347\347\373k\032\005a\351\347W\033kf\237\304"
+	.ascii	"\305U\361\241\334.i\f\254\317'\313\364\362|\336\323<\261\347"
+	.ascii	"\213c\311\357A~\362\217\344\332\260A~\363\r\255x\325\030\036"
+	.ascii	"_8f\374#\317\033_\251&\r\317\267[+\275\242`\302\235w\352\374"
+	.ascii	"N\361u^\315;\320g\314\024\177\225\366My\001\224WJ\360J\023\337"
+	.ascii	"\211G\374fk\357\341CL\327\023.\340C;\212\265\213\212\260\324"
+	.ascii	"i}\204\344\r\0237Lo\251\204\t\355\373Vu\226\322s\253Q\250\340"
+	.ascii	"\235\305M\026O\305\334u\035f\204\205\013\027\330^\225\376\267"
+	.ascii	"\346\350\230y\nM+\344\325z\275\336\243^[\255\201nS:*\237\303"
+	.ascii	"\354\235\326\013w\370D<\341\017\203/|\2438\003='\027\374\326"
+	.string	"\363#\234\335\333>\224K\003\377\353\244r[\332}`\373\356\003!\265\227.\3557\233X\037A\335\250~>\326O\354\357\235R\271\3173\353'\226\375\337w\213\256\365\331W\253`\361Uy\037\226\326\202\241}\337\227\001w\226\016RM#\336\204\206\246'\247\f'H49\235(\230\206\314t\340\351\003\223\207&&\247\024M!\230\234IPNI$\234><%19M$\035`2T\211&g\322\t((gR0Z\325\352\373`\314\017\252\336\252\203\036\312}#\310\362\367$\263\343d|z\253\355\270\216\331\"3\252-\305\266\222gW\221m)\226(\306\205\365\306\363-\305&x\030\274E\001z\327u\326w\315\375\346\317_\226/{n\206<\3013\253\230J#\302\255\241\273z*e\021 jL\243O\262\221\316\371\f\227a\364\376f9\340\213x\002~@\321\013x\002\016\303\263\212\336\333\224D/\304\013\360D"
+	.string	">\300/\335\005\026\200o-bp@\006\240a?C\337C&\235s\026~5\364\316W\346}\232\177\024\372\346\362\205\276@\234O{\202~\030\204\371A\312g>\263\n\026\037\223\311\261&I\224\327T\220\324!\227OtF*\367\\vk\307\252V>\321\030\351\334\225\3039\362\346\302\370P.\276\215\201]~\243\221\316!9\225\277\313w\223D\231\302\t\303t=y\336\264\362\233o\216\362\177km\323\200\340\250a8%\225T#\"\"R\222\024$\351\360\002\021\031\032\353\021"
+	.string	"\251B\326II\254\305\002\341\237%\235\37443\370R\351\263l=3\007_\323 \001\003<\203\276Bx\240\030Yd;%\020\036Q e\370 +\326\031\267lRlm\337\244\330\\D\021IXl\233\252\370\2419\237t\270\210\0328\262\023%\360`\217\340&b\230\003.+lOYNP\246\221\245,1\027\345 \223tB\300&\312"
+	.string	"#\376l\b\f\224\3416\n\262q))\027\223o\324+\277\2445\006\021\350S\227\243\254t\370\023\2403\363?\342\271V'\226~\3126\215\bu\260\275s\336\034\262\251=\265gI_\351\023`\353\001\260X=\t\027\214\206\367\t"
+	.ascii	"\\\214C\222b\020\247\223^2\350\330L\t\3631\241\333\244\t\310"
+	.ascii	"j\3128u\213{\224\3266\3119\341\216~\314]H\301\314&\r.\354\277"
+	.ascii	"Ph\217\242\020\005\033\304\212\353\326\301\201\037\357\r\344"
+	.ascii	"\031<\216\227\3300\330\034{\347\315\334\350\260\315\317\366\230"
+	.ascii	"\230\375i\264Q\360TA\234R\232\336\304\231\001\245{\003JXM.Re"
+	.ascii	";\025t\022)\214\034i\037\215\261\357C^\017E\236t\004\005\352"
+	.ascii	"\004:\216$WU1L\220S\371\301\205\316\020\"\3423\205H\227\267\016"
+	.ascii	"\216\350\231\326\243\372\373\273\316>\026\205\257 \303(\252/"
+	.ascii	"\375\2447\227\351\377\304\233\250\361\277\363\235\346Lq\020)"
+	.ascii	"\002\225Qt\002\3331l\307\\\001\203\232\231I\214\226\275\032"
+	.text
+	.section	.gnu.lto_rcdeviceUpdate.52.1b2800bf416ea86b,"e",@progbits
+	.string	"(\265/\375`8"
+	.string	"5\b"
+	.string	"\322\01797Pm\323\001$\203\310\252\220T%\276\351>\234\212F\302\216"
+	.string	"(\267\240\216\370\321PoQ\373'L\346\"\262\216\326\320\210 \021^;\337*\356\330\306\352\377\273\221\275S\n\033\303\225a\013\236\316U\353\207\002\230n2\016m\270(\006q9\320:5lv0N6i\335\346F\300\332\303U\247G\323\352\324\200\373i\345\310\n\034\341\204\fi \215K\264\267\217\225\021\206d\347)FiG\200\342=G\024\214\220Bv6\330E\351a\177\332\335\265\034\331\377\376XY\033)\t%\273\026-,\033R'!\032\333\217\366E>\302\375\223pf\267\343+\355\202\006.\300\234\032x@uj\272U\2352g\253\034\004\331\233\220*HVvw\312\217s\217\234\177\3223\236\250{\274 \354\256\243'\272\270\345m\023\330>\260]\n\f"
+	.ascii	"2\241\251/0.\230\243\022i6\206\224@m\206\\0\344\022,\261\232"
+	.ascii	"\002\356\362\242\235d"
+	.text
+	.section	.gnu.lto_rcdeviceInit.53.1b2800bf416ea86b,"e",@progbits
+	.string	"(\265/\375`\243\001U\020"
+	.string	"F`oF\360\320&\035;\262\\K\203\330\005C\237\321C\322vC\272\200\213sJ*Q\311\254\277L\023\254f\324%\215Z\231\362]\315\262\333\031l\233v\026\331\302\235S\2319\274\323\366\202\272j\n\203\036fE\006\331[\312\224\002Y"
+	.string	"X"
+	.string	"X"
+	.ascii	"\332\213G\006\320\356\247\340\321\013\264G\220\023\310\036\341"
+	.ascii	"\007d\217\337\214\262\177\376\325\354yzZv\204v\227S\021\206\211"
+	.ascii	"z\204\232(\377\346\311\nJ=B\001\273\033`\345\0012xY\251\022\236"
+	.ascii	"`]\377=c\374\270j\274V\254\347\207\204\335u\272\254b\356\354"
+	.ascii	"\2661\330\216`?(\032C\334\230\301\001\241\2221\373K\245\266\354"
+	.ascii	"\177w\327Jc\213\256sk\317"
+	.string	"\271aL+L\247\246\277]\006F(G\205\027\273\037b=\226F\204Q\342:\177\316\323\276\375\025\276\313[\003\007\250\353\240hk\342\3435bF\210\366h?\205\377y{<\316U\240\236\223\242\245`\0025\273\373\300\366\311]t\005|v\027\302\353-H\276\315\243-x^\366\310\371\004i\252z\026,\3262t\237\243d\251\232&\214eF\2251CM\275\3531\006\246\243eH%c\252\273\233Rm\331\026\345\325&)\345]\f\262\242)\373;g\321\301\267\261\206S\336\345\321?\005'\244\221\022\n\027:\023\217\303i\363\356.\204d\324\211\220:o\003i\2443q%\217+\361F$\\g:q!\b\\\312@2q&\245\222\211\333\276\275\322\334|\202\f\314\016 \025UEm\031\300KE\032I\244\201\027\333>\220(\\6V\222\307!\324\226S2\250\"\375\367\330\003\303\3012\243\372(\263E\016\033%\b\035"
+	.ascii	"2\003\006:\206\346\016\344`\355wi\005(a\b\226\265\310\260\026"
+	.ascii	"\013(\204\263\t)\306ib\f\tE{`\240A\275g\025\227Y\334\022\020"
+	.ascii	"S\367s\212*\256:\375\322D\340\030\016&\200\332U\366\367\314:"
+	.ascii	"(\"\257k>\001"
+	.text
+	.section	.gnu.lto_rcdeviceSimulationRespHandle.part.0.67.1b2800bf416ea86b,"e",@progbits
+	.string	"(\265/\375`\205\005\235\037"
+	.string	"\2264\274H\220\332Qc\212\006v\034\032%\034\251\341\221\274L\343$\343\277Q\276\272\023\024#)\244\317\b(\225\0226\201\305j\0053\202\205Z\266\223\336\326e\350\216 \306u\324u\257\342\002i^\030\325\2648\321\261u\333\275\267\224)\005\247"
+	.string	"\237"
+	.string	"\244"
+	.string	"KX\367\246\016n\272\001z\323\351q\316\233\350\005\2347\355\013\261-\004t\317\006\363\364\351\312\2101\212\214$\357\275\266\2336\307{\257\241\251\321f\250\3544K[mz\276\254\307\367\032\033\247\251<\260\214Aj\264\222\001\330\2221G=\214.\005\\\2523&\004R@\032\025E ;m\220\212\312\003\367\336\032\322\213j\226\f\204Rd\334\npF\211S\345\206\227_\275\302@rQKY\317\324K)(*\243XS\220\351\366GC\"\252q\002\270\367\276\t\310T\326"
+	.string	"\267\221\365\334{\375!\341}s\333flg\260M\t\001\317B\323\253S\033\272\250?\307\342\241\367^\t\276\222\026:?\212\305y\263\332'\031I\341q\310P=S-\321\326\346\345\265N\366Y}\236\325\246\254\272\274\325m\317\352\372\364\177\200\004Sn\204\367\036\235\031\273C3\313\307\255~$\367\217\034\351'\371\225kVU\274*\036\007\250$\005\364H\f!\202\320\251\202\f\204\020\241w\252\240\003\276\364\036Q\330\221\032\223\367\246;7\375"
+	.string	"\235\362\213\334\310\212#m\203V+\252?%d\327j\256\365\251Pz\203@\327j\377\370!\275\023aQ"
+	.ascii	"\300\375!\003\346y\247\265\277zeJ\322\202\374\372U2\276y\316"
+	.ascii	"i\332\323\272\026\315 \372\227\024<?\352?q\3364m)\006\306\322"
+	.ascii	"\355]N\240\245\265\220\344\325\340_<\236-\367\336\t6\356[F$x"
+	.ascii	"\272i\255N\222Qx\314\302\362\253+\bnu}\200\326P\254\264\304\240"
+	.ascii	"\323\257r+A~\224s$\352\215H\2347e\301&\305\260s\275\003X\022"
+	.ascii	"\314W\313\330\376\367\336k-\321\236\342S)\273\240\260\240\370"
+	.ascii	"Q,\327\325\2214\026\357\275:N\374-\203A\357\365]X\237sj\r7\\"
+	.ascii	"\036\251\261x\207W\207\211/\264\003\0304\224\320\345\200|v8\023"
+	.ascii	"\272\032N\204\356\302N\267\333\341f*\200n\3267\236\037\237[\b"
+	.ascii	"\334-\227\002'\342\266\263\351r\266\0229\237\037\333m\207\302"
+	.ascii	"\306\223c\235\t\334\316\006\244\323\355l\265\362Z'\367\fY\242"
+	.ascii	"\232+f<TP\n\023\032\263\376\222f\314K2L\353\237:\255\n\210W\355"
+	.ascii	"c\316\365\343\212\030\226\342\354\330\204\203f\211`?\355\002"
+	.ascii	"\245\034\006\244P\211\231\325\035\245\033\310/79\026\237P\002"
+	.ascii	"\2641\257\237\365\311\004T\234\1778m\020!\352\215|\247\255"
+	.string	"T\f\354g}~\226\207\361\231\ru%\303\354OKt\316y\332\005I]\220\\\354w\246\216<\t\177\250qH\306\020S3$AJS\220\244\003p\002\231\2621;\021 A\310\234\320&)l\354\031\355!\274\n5\370\227\251\325\212\353#\r\265;\362\302\260\033\376\202\270\025\002\232\232\366T\214\324\243\246\256\t\312\235\376\263\237p\236\362 \271\007Pf\"\333\022\235X\245\243\307g\345)\330\355Gh\377D\242\236\021\006u\213!\223\322;\n&u\277\240>\233{(\323\201\274\257m\277\031\240\215\376\375\003\035\371\264h\021<\362\377~\245P\013!\003\027\251-\264\021}\201\2647bS\253\207{NC\333y-\201\273\327\225\314\371\324,\326X\032\353\210\374\322\030\001\351\240\247{VX\232h\007\346 \003\207\t3\224\004\316\203h(\300\255c\302w\344\227\233!@\275\"\346\356\322/\264\316\314y\215\026\321Z\033\371"
+	.ascii	"\023\003\347\211\327\0209F\360\032Z\005(\216\272\330\177\030"
+	.ascii	"^\377\006\326\301R\213&v\262\030S\001"
+	.text
+	.section	.gnu.lto_CSWTCH.20.68.1b2800bf416ea86b,"e",@progbits
+	.string	"(\265/\375 cU\002"
+	.string	"T\003V"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\005\005\001\006\177\001\004\003\003\004\002\002\001\001"
+	.string	"?\202\210\200(}\304\001\303\001\302\001\301\001\300\001\277\001\276\001\275\001\274\001\273\001"
+	.string	"\t"
+	.ascii	"@\004\334\201\306\200\b\270\003\215\001\021/7\r\240\b"
+	.text
+	.section	.gnu.lto_rcdeviceSend5KeyOSDCableSimualtionEvent.part.0.71.1b2800bf416ea86b,"e",@progbits
+	.string	"(\265/\375`\374"
+	.string	"\325\013"
+	.string	"F\225K;01P:\320\247\031m\022\261\345\362\376\\hg(\037\250\206\272\277iH\354l\025PT\322\260\355\243\013E\205\345\233\020\026_\ne\240\233B\3553\016\364\241\353/\316j\367\2262\2459"
+	.string	"<"
+	.string	"8"
+	.string	"*lw8X\263u\274+\2617\205\320\020c\307\356\306C%q\355\232O\363s\005\016\356\343\271\276\364\207\"E\016\356\003z\016\370\003P\331]W\035nx\333\013lG\373\031\002\nR\273\033>R\033\2027N\234t\373,:~\311\021R\347\035'\031\354\346\341\300\2413\355\267\270\013\355\035\347\t\330\013#D\330\330\355\022\034\032Au89\001\310\341\273\004r\0309|\273\235\273\332\0222y\316\023\f\352\261/\343\246\215o\302\0244y\356\320\327@\016\257\n:\361"
+	.string	"\261\345\007\214*\264\006\016\223\306\t\345\311\036\251#\353\373[\025\331\232\376\223\004\233\353\201\332\242`,V\203\313\272T\270\034XY\304.\021\302\305\202\211V\226\211\224\002\306\"\\Y\234\200aY\214\330\316\277U\221_zU\343\003jS\0133\222sEud;@\376\005\006\2536\037"
+	.string	"\233+0.\034\202\365\020V\363\002,\240\007F\334\202\036\026\005>\330\201\020\243\tPc\340\370{k\306&@\024\fs\205\313k\002\353\321Q\b\306\363\244{\232.\252\235\316\005m\272\354\\"
+	.ascii	"8y0\217\323l\351\te\f"
+	.text
+	.section	.gnu.lto_.symbol_nodes.1b2800bf416ea86b,"e",@progbits
+	.string	"(\265/\375`C\002\355\f"
+	.string	"\266\322H:0\317t\005v\007\356\030\215\244\001\251%\276\232\361xk\225-\246\255\210\375\273\233\203\206Rp\021\021!\251\331.\340o\341\r\246\247;\354\351\006\023\016\260\367\026\326m\357\275\223L)7"
+	.string	"8"
+	.string	":"
+	.string	"%\366\2242\235J(\021\351\231\304.<\210F\374\033\025L\235\360+\373\373@\237eu\b\245\336]\021\007Gf&o\232^\020\346gF\341\265x\357\275\241oYfv\\@\333\337j/\243=m\3663\331\327b\357"
+	.string	"{\210\327\343\372\336\313\034Z]oko\221\306f}\254\341av\305#\252\177\371\272\256-\f\357\262\351\rI\275\312\356P\317\001\033/\203\245\332\235a\217\305\223\361"
+	.ascii	"\265\001D68<\031\377\370\332sQ!\354\210\216\252\032_\2171)/\250"
+	.ascii	"\350\271\366{\257\216@\364N\333\n]\206\031\031\367\3227\300~"
+	.ascii	"{\016,\321} \340\023'\307#D\216\217\f8N\2216\250\243\0074O\327"
+	.ascii	"\250M\256\360,>g\303h\254&\350\351\244\3721\235L\331\364\006"
+	.ascii	"nL\357]\263\212\007\306\t\310\364\\A8 \300\002)2v\002\361 \335"
+	.ascii	" \260O{\005th\017\315\033\365{<\210\220t\tQ\312\340\367\221\225"
+	.ascii	"\221\301\021\034\203#8\004\007p\030\034\356@\"\264\224+\tF'\244"
+	.ascii	"\221\346\333\331\317Z\336\365\332\022G\026\fc\353\006\346\316"
+	.ascii	",\004\2048\256\001i\017)\273yRS\214\177\031O\234\261ek\241\237"
+	.ascii	"V\006\216\0204\360\003\025;\220n\017\344\031\206<\302\335p\255"
+	.ascii	"\365\004"
+	.text
+	.section	.gnu.lto_.refs.1b2800bf416ea86b,"e",@progbits
+	.string	"(\265/\375 \3675\005"
+	.string	"\342\216&'\200K\322\03230?\0051A\0234A\0234\001\266\303\201\360lv\233m\233J1\261k\237\264M\202\310&dK\231\002'\305\332}n\016eo0\266\306z\306\032c}\261\236XK\254#\232!\232\035\326\fk\2055\302\372@m\240l\004\335\202[`\355\254\231\365\302lKH\244B\267\271\023t\321\rH\332u,B\367\"\312\0220\366i\254\323\330\304\330\2041\200\324B\261\025\212\245\270\037\226\033\322\013wB\372\340~\226!i\245L\036\2212d\003w\326A\367q'\033\275#\002"
+	.ascii	"\003\030$b\203\371\004"
+	.text
+	.section	.gnu.lto_.decls.1b2800bf416ea86b,"e",@progbits
+	.string	"(\265/\375`\247(\275\257"
+	.string	"\212\r\361;U \fQ:\035\026F\017\340\234\342\2213G\243\346R\300\360\377qoTt\347\341\013Bp\216\310\354\344\256{\355'Uqpg\017.\t\030\036\247\016\207\325\027\300\001\374\274\344\226\304c\336\351\365\333Mz\224*b\304\306]L\334\037\222C\2763k\3116\2232\245\024@\003\260\003\267\003vi\312\222\313_\t\374\300v\317w\322\t\200\341\016\276\223zp\342\236{*\334{N!\025\214I\213\363\261\374+\b\346\313\n\251\262\267\277^\356\030\263E\222\277\201i\020\274+S\177\373\2250\027\357\342\177\276\305\243\016\350W\332\261x\226\346\201\346\314\034\342Q\354YS\346\351\310\312\236\227u\377"
+	.ascii	"\272\234SQ\n\267\362r_`\001\006\016\350Z\274\357F\t\315P\351"
+	.ascii	"\226\336\322\030\240\337\271\236\207\244\246\314"
+	.string	"R\035\036\317\206\r\0336\340\324)\211 \315\\\357{\347s\277\366>\337\253az\337\315y\351^\301\215{\0051p6\226i\351\355_\342v/8\006\352D\017[\261N\236\240|\375\315\273WE\226<\221\303\355x^\245;\347\\\003\243\353\252\n\022\334>\004\267S\351v!.\305\355\370\232o8\376\372\024\247\363\350\005\257k\0130h\253D\313e6az\204\371\002\004\367\240_H\375\204\237\3669_sQ5\345/\005|\007\276\331wR(<2SF\264\300\376\266s\341\276\240\373\307\235x\233#\261gM\234d\013\312^\316\320\237v'\256\304\233X\350[f\036Mq\300\322\310\nA\300\234\241O<\316\243\356\304\223\364\205\346\r\033x\204ZD\004\241\322\353K\034\316\243\031\234I;\233\023\351\230%4Cs\206\342\374\227 \221\264\277m\204\3333\244vp\3203\244=\204\333\003\376FC\345\213\353\354oK"
+	.string	"{\021w\363\250\037\351v \276\326\027\315\231\325r\206\332\330\345\013)G\376\266\033\351\001,3\006M\001n\327\220\342\270\206\264\2058\307w\322w\n)\006\337I\373qC\337\322\034\315\246)F\224\272\277P?\273"
+	.string	"\202\234\2319g\nd\252\002cT\375\325\340;i\214SH\035\310O{\020\ni\263\n\232q.\327\037\224\330\337\353\024R/\273`\225\232\234\231-g\250\016\016\364\205\023\327\337\206\372N\212\235B*l\232n{c\004\357\237\341\247\333}\272\235\306\001n;\335\326\352s\024P\202\310\331'\240\333\245 \240e\272\255\2207\231\032\177\200\356\346\261\320\006\350\266f\356\3431t;\223/@\367\247\004\360\002\367\325\355z\177\241\317Z\247\333\216\320\355<\031\274\205n[\354\366\275\027@\267\377}\005\ft\373\210\356\347\351\366\265\247\240\273\235t7\223\356\376\333\240\333?\b~"
+	.ascii	"\272[\001~\335]\342K\367\357t\273\206n\213\324\335~\215\273\255"
+	.ascii	"\216\376n[\202\356\327\351~\233\356\247\351~\231\356\027v\377"
+	.ascii	"w{\230n\357\322\355W\272\375\256\333\355\272\235\256\333\347"
+	.ascii	"\272]\256\333\341\272=\256\333\233t{\222n\177\353\366h\267\273"
+	.ascii	"u{[\267\263u\273Z\267\243u{\220n7\353\366\037\335\256\325\335"
+	.ascii	"\201\335\336Aw\363u\373\003\272\235\330\355;\272\275B\267\217"
+	.ascii	"u\267\205\356\006\323\335\031\272=\254\273\353\272}\001\335n"
+	.ascii	"\243\333\267\272\375\331\355\025t;\007\272=\204n\007\321\335"
+	.ascii	"^\272\335\002\335\356A\267C\240\3335\350n\301\356\376\322\335"
+	.ascii	"h\335]\326\335\021\350n(\335m3888\330};\320\2155\350\276\020"
+	.ascii	"\023;)\002\234Bj\273~\332\232p\023\325CH\333_\035\256\n\302\035"
+	.ascii	"Hb\230\260e\2377J\235\231\223}j=\255=-\371\233Gs\204Fv\365\267"
+	.ascii	"/\270\362}Pi`O^J\235\0175\271:\036{k\177^a~\\\276\302\266\324"
+	.ascii	"\020r\302\353I\245\335\370\022c\320.\333\352\254\366\302`\355"
+	.ascii	")\355\224}\332\262/l\f\013\303^Y\247\305\262Y\266\004+e\243\254"
+	.ascii	"\225ma\233\226\312VY(\353\302\243v\312\253\264m\262Nv\205ejq"
+	.ascii	"\364T\006\346\215l\301\360\353B#\311N=\340{a\252\233\361\202"
+	.ascii	"o$\255\004;e\217l\222\317\261\345\245\024\206\034\312g\034\217"
+	.ascii	"\235\241\243I\035\002n\343%\234B\361,\223]b;\273b\005*V\345\310"
+	.ascii	"\r\313\302*\245@\352f\304\005\342\026\3661-\022N\027\247-wU\260"
+	.ascii	"e\322Ye\315\230\024\024\330\022l\263\320\r\2670\r\267\220\f\267"
+	.ascii	"\220\006n\241\323K`\330\r4,s85a~\324i\375m!\025n\341\022\356"
+	.ascii	"T\020w\272\207;\255\303\035\234B\272\367|Z.\222\022%3\332\366"
+	.ascii	"\264\244tfyH\226~-86\242S\270\376>\026o2\030\215\002\3677\310"
+	.ascii	"[\301\273\242\\Z>\363\360\\\311U\027R\225~\274\0314\350\223#"
+	.ascii	"\177\337\356\357l\244\200=\t\373\273\247\262d\266\345\b\264\f"
+	.ascii	"\n\352\313\371\367\353\336\bV\225\340\330\337\237{\272\027{S"
+	.ascii	"b\365wJ\315\362Et\212\025n.\215\205\246\211\327\226\334\337N"
+	.ascii	"\227p\307|\371(T]K,T\240\304\315\b\202\311\001\376\3558\033:"
+	.ascii	"\251\274\374\267c\2348y\306\250\305m\221k\002\347\223\245Im-"
+	.ascii	"\3721\312\226\274\222g\362I<\372p\377\326\037\365H\334\276\315"
+	.ascii	"\333\334\316\347\252\"\340\203\355\341\276\310\033\3619\266\017"
+	.ascii	"eA\340\376\210\333\te\204\351\201\331\020sU\366do\346z\216\261"
+	.ascii	"\201;\346\nwLv\223\271\363+\201\255\013\356\253e\207\210\006"
+	.ascii	"\233\300\273#\036l\0310SI\221\262\265!\032\270S\373\333?\244"
+	.ascii	"\373\201|\220\027r\203\234\311\361\375U{\202q9=\301h\036\375"
+	.ascii	"\264\207:\364\323\376\214\006\264\356\017\220\346\204\275\270"
+	.ascii	"\265{\373\336\300}\2550\217\357\244\226\355\247\337\354\215I"
+	.ascii	"\022\2302\357\023\376`\262\305\366\343}`,0;\260\277S5Q\262\336"
+	.ascii	"\242G\336\206\365\323\305b\306{\035\021\002c\017\203\356\037"
+	.ascii	"\256%\037\314\215%\211J\tQR\237\365D\005j\255\204\217q\303\314"
+	.ascii	"\311\314\256\247\260\037\255\177\372\\UNf\ni\n\213r~\2145!Ne"
+	.ascii	"_\343Y|S\356\262\n#\322\375\263\345v7\312\234|D\205)\354\231"
+	.ascii	"_\343\221\334\316B\303\204k]W\237\3645\336\351\233L]U;^\307\177"
+	.ascii	"}\217\007\373\260\267\361c\237\343q\274\330\337x\262\347\341"
+	.ascii	"\321\257\361-\372Mx\031\257\374\032\277l\270\033&4G\245]Y\033"
+	.ascii	"x68S\215\261(\002\\\301\247\2212\0019\201\354o\337\214\333\006"
+	.ascii	"b\354\331\362\341\266Sp[\270g\273\335\327Ii:2\202\333\n\321\360"
+	.ascii	"0d\230\320\254&\324\265\266\244\f\267\375z\254\"iyw\177\333N"
+	.ascii	"\341\253\267R\312\361\351U\365[u\226\232\234-X\027<\274\360\376"
+	.ascii	"6\227\247Jo\374X\302x\252\0274k:\364\214\374\235\242\311!E\311"
+	.ascii	"\311\037v\361-br \035i5\301\375n8\347\233\017u\363t\243\203\n"
+	.ascii	"D{\002d\353\357?\371\025\034\244\346\363)\004\3677u\377\212W"
+	.ascii	"\032\241\311\022\267\277\277\364\323\317\024W~r^W\331w9\023&"
+	.ascii	"\211\257\b\217\016V\276\300\002\003m\230\t\224h\371\275\001\336"
+	.ascii	"\324\231\260\304$\3306\314\221\216\032F\300\360\300B\305\312"
+	.ascii	"\213\375\"\343\274J[\316\360r\363\302\317\317v\341q*\373<\344"
+	.ascii	"\230B\266\005\3206M-\031\373\333\305\376\t\263\310\235\020\367"
+	.ascii	"w\213\345\202\353\002\273\240\374\355\033\345\026\275,Y,\037"
+	.ascii	"\017\316f]f{5Ga\306\004\355^"
+	.ascii	"[\276#+\250\240\376Z-\337\264Z\240\210\320\271]\314\326\337\225"
+	.ascii	"#m\270\361\032\317^q!mKc\032f\354\272\346\260\364\332^\371\276"
+	.ascii	"\"z\316\277\326\3127\231\3142\246\2776\317\355d\322\336\240J"
+	.ascii	"Y7\236l\300\270k\217\332;\367\002B\253\311\241m\242\354\354,"
+	.ascii	"ZN>\312s\022\206\305\362\262\r\023\323\321Y9\234+P\361Y\361\370"
+	.ascii	"\272\3432\347Q;gmhpf)\f:\370\252H\331\220%\261z\306E\211b\345"
+	.ascii	"\002\221x\001\002Ji+wS\006\267\027\370tC8/\3002\374\344\211\215"
+	.ascii	"\003\221'\300\201\003\347\006\213\256!\177\343\274O\006G\216"
+	.ascii	"\255&\257%\226\311\022\333$\315\331\241N\250f\02388\373\003+"
+	.ascii	"y\374\316\2524\304\210\361=\321\362\267k\226\270i\224$I\302\227"
+	.ascii	"2\261\345\2710{{\363>\236l\261 \361\002\344\201\263\366\005i"
+	.ascii	"\r\f\333h\324\373\034\232\241\334\306\224ob\351\360\361\267i"
+	.ascii	"``7\253\303\355\255\252\2303^\332<j\3212\324\f\013%\331\026\300"
+	.ascii	"\234\235p\300\371#+\341+:\244=j\207X\266\213\226[\334\320\250"
+	.ascii	"\342@\003F\266\343\305_\273\306\223F\243\374y\231\341\236\221"
+	.ascii	"\201\273\255\232G\255\332\017qhV\322`9\253\342\220:\243\034\211"
+	.ascii	"\375\355\231+|vf\321<\347\034J/@\300\346\322\026-\206n\f\254"
+	.ascii	"M0H\324\006"
+	.string	"\361/<\320,5c\003G\323\t\207\230!fa.\374p{\017\267f\036\265f\216\306\343N\244.\275\275\334L\342\3202y\270G\017\373\003\347\234?\240\364\002\344\221\253\232>\332\376\310\221\221\227\364\267\271X\0345,dP\211[\303dv\307S1\211I\375m\0312+fs\264\035\353\261\267\362\334\314\271*+\371\032\200d\212\027 `\256jjh<\330\236\346e3\347,\025\003\315\315\243\232\264\333\333c\3345t\333\270u\003t\367\315\271{\001#\344\274\214\002n\3019\216,\2610\344\216\231\313\231\371TV\340\031\305|R)\251=\263\222\t\246\324i\346\247RI-g\235\314d*?8\263\216\222Z\216\312HtQ\236\241Oef:\263Nf\346%\006%\3463JIm\031\245\243\244\366\214\312j\317\234\223\231\313&\013fn\352d\265'_VsF\345(\2519\243\224\324\2364\034\b\013\0310\244\214"
+	.string	"va\271\226\0223?9e-\2339sJPg\306\313\331\331\222r\323"
+	.string	"9g9\233xK*\177;\232{:r[:\275\202\323\321\22633\347\224\306\2349\217\035\241\310N\rPB\3472\r\237Sre\345\246\244\234\005\220\2419;\345\254\364<\227sV\346\234\205\315,h\316W9JaNN9W\3618\345,%\222\244\234\237\315\312[\224\222\332\226\363\007\311\020\265\260\274\002\252\364\260\214\367lb5\345Yn\3129\273\037\016\213j\321\367\367\206\rs^\201Y\363\201\355\r\013fm@\235=\004\377\266\265\321me\330\031\266\206;\035)\213\223\227\277\226\206\365\362h\005\373\3257\343(\352oc1L\202\234\275B\352\203\203^!}\247\007B\352P\221\350\001\006!\265\310\210\204\007\311\""
+	.string	"rp\214j\021\b\nP\223DuH\035\301\200 \325h<\002%\217C@\031\032E\217\317\261HA\332(z\222\303 u(\024B\305Q\004a\007!\204(\001\264\301\260\203\017 |0\004\0321$\021BG\035\022'H\026?l\260\252'v0\250\034j\326\2421D\215\272\022\205\2126\320(zT }T )\004!\323\013B\306\016\222!t2\f\021?\220"
+	.string	"A\310\250\222\3509a,\256E\342\b;FF\365\003c\210\033!\325x\\W#\016\222E\234\016=+\222X\324s\200F\321\02344\032!}\202L\024 y\2028\344\301\tc\221\bI\244Y\211\3245I\002\211d\262&\231T\203\216H\021CG$\021\251\022\021\201d:X\320\003\002\250\004\007H"
+	.ascii	"\311$\223*R\004\020\t\352\0050P+@\252E\252*BM\007\251CBF\"\b"
+	.ascii	"\013\035TD\252F\365\004\356\006d\300\200\f<\250\020\266\007\r"
+	.ascii	":h\320!m\017\032\374\374h\220\301\017\356\f~\254:\\\215j\212"
+	.ascii	"\016HP/@\0342\"*\222 \"\002\025@\330(z|\212H!\244Z4Q\\\215\252"
+	.ascii	"Pq&\204\034uH\004b\211\024\251:T\205\216\037\314\250BG\242\253"
+	.ascii	"\016AX\221\307\"\233\244\361X\\\213\216Bu%\216\0202\"\212\200"
+	.ascii	"U\021\024I\340\025#k\204\210*\210\241\"\261\004\007*\326\032"
+	.ascii	"\344*\202g\006\271\212PS\024\325 u\204\205u\230\334\200\221X"
+	.ascii	"DB\005\362F\005\362\006\271\212\b\261\023\202 \242\bCCD uH\250"
+	.ascii	"Xs\242(9<Q4a<"
+	.string	"\002\345$\0010DL\201TWc\210\265\210H]\327\r\326\242\261Xa\035Zp\201pm\024\027\204\324\225\230\242\270\006m\220,\322$\207*\212\240\2658\002\tu\2304Z\211+\t\236u\310(\251\"S!#\221\210\350\030$\024R\327 \265H\205\212cT1@c\302\210\203\024A*R\270\032\035\205\3530\371\001.\"\"\256\253\321Q%*\2569;kr\270\252PW\343\021H\204\2324\036\213\222\352\b\002\004\031\215<@\252I$\261h&\2251\252\030 \256\304\017DD$\261\250&\251\022\025K\220\200\\\325\021*\210D6H5i\204\327\241\343\221\203a\f\tBDuD\262(L\016o\326\344\260fE\036E\f\021\213H59\263\016=\b\221\252\t\023F\"\244k\243\350\251\320\307\"\025\351\263\036\217H\037\232u\230\301\317j,\032\341\244\2124Z\211\252\t\234\034\036M\030C| \"\006\031\215\220"
+	.string	"P\207)\206\003\350\237\037 \f\033\310\200\005pP\017\0211h\250\006\025S\250BAH\237c\321\307X$\022\371\004!\223>=\026\214\307b\022\251\2060t\f:\256Gd\021\316\321\204\261xg\334\345\220\035zl/\343Fa\035Z\244L\231\200v\273\344\302\364\tA\362\367>\357V_\256\276\\\177\271\354\340 \230\234\2278\356\025\270W\220\232\331\255\245Z\366\207\226\034LJg\223K\304j\306V\214\273\202\t\r\035P0\256"
+	.ascii	"B\361\363q\263nV\020\0349W\270\373b\361\331\364\270\353\033\274"
+	.ascii	"\352\022e\n*\346\006\235\240j\307\323\255bk\301\246\324v\251"
+	.ascii	"\302\360\371\370\253q[\264\270S \2249Ci]\027}\247\340\254\310"
+	.ascii	"\260rV@A\335\250\036a\366\356\007\214+\315\276QsH\200b\337\024"
+	.ascii	"B\361\231\020\343\317\311\311\312\371X\032\343Q\223\203\217\n"
+	.ascii	"\353\216\211\211\355\346H\334\223T\020\026,\356\n\317\201\036"
+	.ascii	"Q)\022\206\003u\021\246\374\3338QL\346]\301\343\264T\210,\215"
+	.ascii	"\3618@\322V\220\244\276+\276\314\264\224\374\275H\337L\317\212"
+	.ascii	"\024\021\273\311\303}\363]\362\364P\376%\371\203s\250\202\321"
+	.ascii	"<\211\322\230B\246fDd$I\222\016b\n\020\204\202a\036\351\355\r"
+	.ascii	"\022\200\364D\217:\307\320\314\210H\220\024$\005\205\032\303"
+	.ascii	"\001Lx\272\325\340Z\371\002\225\240\227\363\022O\177N\246\261"
+	.ascii	"2\360\212y\365#b\332\347\270\"#\272\217\226$*\312\021\254\215"
+	.ascii	"\250b\022\255X9\033\274\234:\336\302\206\244\2325\261\376\250"
+	.ascii	"\376\344\225\373\373\237\036!\373\262\272-\201o\330U\306FTi\003"
+	.ascii	"e\034\025\354j\375\036\3620\251\211ju\271\322z\265\b.\t}\326"
+	.ascii	"c\372"
+	.string	"\261\263\254Y\320D \033=s\303F\036\272\263\313\266\214\227\336\357/"
+	.string	"F_\326\246\236\031\b\022g'\305\332'l4\237\316\317C\321\323\0170H\232\374\317]*d\355\322\352\330\263a2\253Ua\024\235y@\360\001\020\210c\306\357+\344\321up\247"
+	.string	"\352$\027\330c\334\266R%/\001\214\204\001\217\307\304w\306\355\333\266\233<\360H\254\370d\305.\275t \027\023\t"
+	.string	"\017\254\312\260R\265s\022n\333\230\275Pk]\351\206\307\257\320\251t\363\242\200[\340q\003\314\370"
+	.string	"\375\304\325\003Z\027kM?\344$i`\343fA\257\021M:P~\232k\303\342E\2556\027\273\260\224^);\354& -\001\326s\262Q@\324+\316\023,\027b1a2+\2078\346\332\320\260A\017\365\023\202\245v\313\233\250!\b0\021\225\373\002\326z\013&~\006Y\301\025\206\222\235\255U\007# \004\362\224\267\261U\222\267"
+	.string	"j\020\"\326O\350\237\275\004V\"|\367r`\227Sl\033\327\272 \351L '\260J~E\263V?\373g\037\363F\363\365\324%\371\372\320D\377\227Q\310\031\311g\202\236\232obBA\210x\257\352\003\270*W\314\330G[=\341%\335\247\356\007\374S\362\n\027\250\343\276\247\240\030KS6_\035\021\277\325\356\3048\254\325N; \352,H\3445\215\031\371\032A\356\005\304\037\307\263\240\021\362\022N\302n}\203 w'Bn\335\342\016\004\005\025#\002E\270\351k\201\203G\310\376\017\2559\2363\2757\327H\341\347\213\312\033\326\016\327\031\203\327\312\030\034\357\3207'\tr\343\265\022?\206\273>\331\321\026u\204\016P\212\022HJ\264\201\f\310\353\346r\332:\335\372,\205z\026\003\006\032B\366\224\rl\222\373$"
+	.string	"\202\365X#\322T\2406\016g6\321\234\233t\022\307\234\303\033u0\265\304\334\275\374\376U\013\337:\2417\247\007\357\332o\215\f\262\214P\035\264\022\257\242/\020\305\027\316\342s**K%K\220\241\366\260\206e\367Q\247\036\274P\252\022\2434\360u\234\016\274T\t\2576P\301\340\nA\262\250Ga?\3266\234\321\f>\031\035%/\306K\254\272\035\314f\272\205\320\250\254\303\376\246N\214N.+F3\264\004\336z-\216Wt\300\356\363\267\t"
+	.string	"\313\300U\360\370\345\033\327\264\241%\374\203t\320\224\360@\027 \245\223\210\206\300\2715B\353\236\342S\022\311\312!o\367\234A[\002\201\243\3106\023\0342\204\265;C\241b\r\005\232\200 \034\247\256/\007\026\257\006\344\300\220\373'_\374A\242\262\334Y\341\013\030\341\231\343\034f\002v\203Y>\0021\002n)\351T\303^w*\027l\250\020\236\221^\013\034q\207u\362"
+	.string	"\316\346&\361\340\361\205b\203dh\337H\306sR#\325\272\340`4~#\005@C\327\236\303 \216\231\241\337\304\003\242\3644S.f\021\326\342\232?\300\305D\210\241\003,\256JQ\325\023\344Dl\f\316\234uB|\370\252x\210\020\366e\031\200\\\277\006I\026\220\322\301\b\314K\0057Wf\240@\266\031t\215\335\231\001/\001\355\210\021|\205\306\307*\312:\032\024\023\320\004\025,\002\217\r\211\030\255\005B$d|\360-\031\362#ET\027\333\344Kk\362\335"
+	.string	"\023\276\340}\031\344\272\037I7\023Rh{\216O\001\2560\265\b\355F\024"
+	.string	"\224\266\026\227;\300]\340Z\226\023\002W2\340\"\325\n5\006\362\321*\252p\235\031V\345\343\214`\300\r\247\306\305\004\347jk\016O\265\215\022\350E\262\364\216l\271\340@\200.\267c]\024\246\311\306\203\240\3227a5/H\335}`\030r%0\200\002{\372\376x\337\363\024y\f\240\254\270x\261dk\023\371\374=(\\\213\343\371\265\211+\346\022\204 \023\2143i\271"
+	.string	"\257t\240\021\007B\247\315\3209rK\275^\343\340\"#\361\034\\"
+	.string	"\bq\240\036\003qg\246>d\327\216bN\200\210\372h\323\024\201\221\251SH\"\374Y\242[2\206\025J]\265;'e\354\307\244\005^\326\003\347\225\251D2\347\021\354\356\313\315\004\027u\270\215\315/\242\365\2750\260\344%\237\224x\224\313\372\345\257\036 \017\007\2511\275\215\206Pn\034\270@\017\342\243*\370\306f\236\213\335\3606I\306O:\255h\257\005\307\327\323`(eR\206\330?\203\223#S\271\030\262\005\021\316d,e\t\325\236H\335AS\237Q\352\254M\261\267n\256\242nTK\234\240\220\226\036&\361\342\3322\003\002\237W\024\372tTIz\223"
+	.ascii	"S\230\377Y\f\202\b\371HZW]\n\020?=/.\024W\330\"\314>\306_\201"
+	.ascii	"<\005\326(\314\004\265\224.\215~\t\204\255\\\217\214\234\n\021"
+	.ascii	"\217\205\304K\002\356N\rL\034h\373\n_\006o\213N\341\025\314\207"
+	.ascii	"\241\244)\023\222U\207LqZ*\336H\274R\201\002\246\372]\223;\262"
+	.ascii	"\237\276\233\016\351\326\220\271i\020h\236#\373\340\0015\210"
+	.ascii	"\357\255.)\324}^\035\355\276}\335o\001.\300\004\364\223U\024"
+	.ascii	"\215\256E\347\033\004\220\024F}\f\274\204\007\345`\365\003\316"
+	.ascii	";\303T\333\0342\205\005\022n\031\315Q\360\027=\264\307G\266\260"
+	.ascii	"i\3467\330\357t\037\354\306\245\306\206>\007\036iWS\035\3736"
+	.ascii	"\277\247\337\027\257\363\372c\0340\216\353\327\340\214\364of"
+	.ascii	"z\301l\024R\027j?\356\210\376\r\346\310\302\323\252<?\013=\306"
+	.ascii	"dr\340\240\241\013\275\r\343Ey\260\317\274\217\320\027\367\b"
+	.ascii	"\364\327\345\026\356o@\277\250\035\tW\262\253$?\033=\205\334"
+	.ascii	"1\353\322>\021\372>\374\341\330\036\3468g\\\273\\\331\\\300\372"
+	.ascii	"\234\3335O\265\301!\r}\267\231_\020\336\207\315\224\265\345m"
+	.ascii	"[\247\341\276Y\275\241\234\n\355zW\252\343A\257\243\301\232\227"
+	.ascii	"\264g\373`\265\306\037\371\363\372\316\215x\276\301f\364\360"
+	.ascii	"<\231\300\347\331@e\234lj\352\307\313#\312\201\341g\274}p\317"
+	.ascii	"\330\227\330\327z3<Q}$\334\356H\367\037\332\246`\331>\264\362"
+	.ascii	"\b\013\265\002"
+	.text
+	.section	.gnu.lto_.symtab.1b2800bf416ea86b,"e",@progbits
+	.string	"camDevice"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\001"
+	.string	""
+	.string	"switchStates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\001"
+	.string	""
+	.string	"isButtonPressed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\001"
+	.string	""
+	.string	"rcdeviceInMenu"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\001"
+	.string	""
+	.string	"waitingDeviceResponse"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\001"
+	.string	""
+	.string	"rcdeviceIsEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\001"
+	.string	""
+	.string	"rcdeviceSend5KeyOSDCableSimualtionEvent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\001"
+	.string	""
+	.string	"rcdeviceUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\001"
+	.string	""
+	.string	"rcdeviceInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\001"
+	.string	""
+	.string	"rcdeviceConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\001"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\001"
+	.string	""
+	.string	"runcamDeviceSimulate5KeyOSDCableButtonPress"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\001"
+	.string	""
+	.string	"runcamDeviceSimulateCameraButton"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\001"
+	.string	""
+	.string	"getArmingDisableFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\001"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\001"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\002"
+	.string	""
+	.string	"runcamDeviceClose5KeyOSDCableConnection"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\002"
+	.string	""
+	.string	"runcamDeviceSimulate5KeyOSDCableButtonRelease"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\002"
+	.string	""
+	.string	"runcamDeviceOpen5KeyOSDCableConnection"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\002"
+	.string	""
+	.string	"rcdeviceReceive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\002"
+	.string	""
+	.string	"runcamDeviceInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.1b2800bf416ea86b,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
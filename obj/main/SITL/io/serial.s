@@ -0,0 +1,1414 @@
+	.file	"serial.c"
+	.section	.gnu.lto_.profile.6fca6f322b6f3fc6,"e",@progbits
+	.string	"(\265/\375 \tI"
+	.string	""
+	.string	"\005"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\035"
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.6fca6f322b6f3fc6,"e",@progbits
+	.string	"(\265/\375`\241"
+	.string	"\005\n"
+	.string	"\304\017\225\001"
+	.string	"\037"
+	.string	"\374\255\365\254\f"
+	.string	"\001\217\203\300\340\006\022\002"
+	.string	"\002\001\002"
+	.string	"\002\002\002\003\004\005\002\002\002\226\230\365\242\b\003\316\243\347\220\007\002\002\006\002\006\004\240\342\234\212\n\005\357\267\360\307\013\002\002\004\002\007\006\333\375\377\333\001\007\303\276\302\323\013\002\b\232\255\221\221\b\002\002\b\002\b\t\n\232\226\312\363\017\013\276\312\240\326\002\006\002\003\002\t\002\n\002\n\f\r\215\311\327\216\r"
+	.string	"\016\265\203\346\305\f\n\017\371\217\353>\020\217\231\357|\004\013\002\f\021\330\342\232\374\005\006\r\023\n\002\n\024\314\374\217\344\025\247\267\224\336\b\n\002\016\002\b\002\003\002\017\002\020\002\017\013\002\b\026\374\373\275\316\002\006\002\021\027\370\346\324\256\r\022\002\003\002\003\003\002\003\030\031\342\363\276\212\b\b\032\233\246\366\244\b\002\033\254\213\274\230\b\002\034\323\201\221\330\r"
+	.string	"\035\246\246\365\275\004"
+	.string	"\036\300\245\203\207\004\037\240\342\234\212\n"
+	.string	"\033"
+	.string	"E\205Y*0L\321\324\314\321\212\0010\330Y\230\031\030\241"
+	.string	"6h\36667}\265@\004\216\"\313m\204\2612\017M\325JK\212-\342\251p\354\212U\232\rB\025*V\b{f&\332\365Q"
+	.ascii	"7"
+	.text
+	.section	.gnu.lto_.ipa_sra.6fca6f322b6f3fc6,"e",@progbits
+	.string	"(\265/\375`\226"
+	.string	"\315\005"
+	.ascii	"\002\307\023\032pM\322\001\244g\377\377\377\377\377\277]\026"
+	.ascii	"\355\001\3420\202\210J\020!r\247\024\256z@\t\315\244&_\037\311"
+	.ascii	"\311\305#\203\314\207c\227QO\363\333pE\353\241\2545`(1\\LEB7"
+	.ascii	"b;\254\f[\357\302@\260$\264\355\3762^\t4 \260\0021,\017\030R"
+	.ascii	"\005\020\300\f\307m\360p\230\006\313\264u;\032\r\030h`\"\212"
+	.ascii	"%@1\307\013^\310\364K\034\016\235\b\241\225\300\317\013\252\215"
+	.ascii	"\254\241\247\341d\303\203\316\346\006D{\\\332\204\342n\304\343"
+	.ascii	"p\004p\300\3254mA\217E\\\301}\343\372\265;\327\215\331!\214\363"
+	.ascii	"`r\032sO\230\003m+\236\033"
+	.text
+	.section	.gnu.lto_.inline.6fca6f322b6f3fc6,"e",@progbits
+	.string	"(\265/\375`\262\004\265\027"
+	.string	"\346%\205J\320\360(\035\242\032\310\341\270\346w\300\024\314\3125\250\t9>\3347\223$\323\316<:\333\214uoP%v\006\264\372\217\037\330;~\373IuD\302+P8\240\227Q\352\205\227\220\300'\031\250\236\345\223\366\033d\344w\333R\312\024p"
+	.string	"k"
+	.string	"v"
+	.string	"\334\362\371Ua\tAMJ\344[\227\351\366\373U\327zWk\035\317\262\261\323oH\343\262\261\215\337\220\206ur\024U1\275\344c\002j\255\364\r\037\023\320\370T\216\376+LB\b\304\321Za$!\020\307\370\276L\327\377Y\263\306;`\216b\264~[\353\304,]0aa\f\271\241\036\222\357\317\364w\251\265\342~\376\227\306\265\326\332\377\310S<\0012=Q'\007\371"
+	.string	"\242\313t\227\351Z\251\357\252\377\343\350\257\322M,ttp\3617\350\003\341$\362r3|\316p\350g\202O\032O\020\362r\350g\3541\026\362l\222\366\245\352\277\b\357\362mh\3517\245\243x6+V\377\230'\237\264.\212\032\376\306\317\362<\313\363T\320\033vEO{\361\223\376w\361\356\337\017\031y\027\3201|\333\377e\021\320\027\267l\177m\rU\341\303S\354#?@\020\216T\271\031\013%"
+	.string	"\364x81D\376E/\376 \342\377\213\027i\215\023\261\363Y\275\374\254arC\030\023\267\253A\3013\316\377/\336\365\355\213\031|\204_\366\252%@_\334\340\375@\210C\204\222\213|\325),\303\263A\032k\254\301H\370C\336\025\222\322;2\240\222\304\237\205\235^\324\3248\320\273\277L\267?o9IFY\025\n\217\263\330\376\274\352\031\307J\227\317\337A\207"
+	.string	"\366(\224\023\306;ba|k\003\024\3067\236\337\226\376\365\b\266(p\001?\311\027\2015\336\311\341\223b\376\230\240\3214\336\244\344\377\214\271\003T\235\336M\020\306\323\273\t~\234\344\263\306A*rpZ*\3353\3421S\276|\215k\316\305\214Y\225d\204\220\312\024\321\276\002c\250\241<g\b2\016\221\b)\210Z8p\2422TT\036\022\240\345d\211\274\350D\202\n\nJ\312({\210\230\3048^C\320\372\345E6:\013}\374\006\220\270f\240*_-\377\022\025\224%n\214~\210v\265$\343W\021\237}\360`\371(`\341p\275\266n\223\361>#*\214\353d\020t\272\332\255\201\346\250,\355\r\255\227d\211"
+	.string	"\274B.\264n\253~~\212\203\006\353\356\274\205"
+	.ascii	"\377\367\334\210\233\020\212 \216\r>4\262,\236\216\341&#\361"
+	.ascii	"(\305\034\005\003g\275C\017\373\244\201\376\232\320{A\311\006"
+	.ascii	"\236\373\374\036\022\267\373\376|v\351\302\236\022\005\215C\322"
+	.ascii	"=qE/\244\\\025G\034\346@SM\250I)\301Y\330\002\017\2313\276\227"
+	.ascii	"XfR\271\343\366\016zd\315\2009\255\330\363\013"
+	.text
+	.section	.gnu.lto_.jmpfuncs.6fca6f322b6f3fc6,"e",@progbits
+	.string	"(\265/\375`\244\002u\013"
+	.string	"&\2213.p\265I:\216\323\303C\247o\231G\033\317\352\277*\276\245\376\3779\001@"
+	.string	"\202\003\207h\030\366\377\377\237\374\200\210\204h\265!K\032!2\311&"
+	.string	"$"
+	.string	"("
+	.string	"\274\324\247\367\t\036\305r\006X\002\3220Df\230\231\004T\303%\257\t\303\023f\316K\252=\364?J>\033D\021\001\255\375\200\027\260\342MFO\3615xz\f\207\037\255\247\347\364\326\267\200\274-\352-\252\363\032)R\\\255\265\306\213\361\024\233K\350R/-(]\241CzB\237\364\247\307z\017"
+	.ascii	"N0x\354a\b\267+\212WT\277\235$\007\227\210\002\244\\y\272\315"
+	.ascii	"\344\3509z\253\315js\2014\241\343|\001T\273$\021\022\302\036"
+	.ascii	"\344\345\002Q\206\"\305z\013\345\342\333hG\25019uff\222\202\026"
+	.ascii	"\030\2261p\002\031\0333\017\021\240<F\030$\201T\315-\026\003"
+	.ascii	"\243l\232\220\245\214\331\214J\235\362P\237Z1-\305\230\334^c"
+	.ascii	"tS\007|\321\2612t\336U\353\313\037KY\270\036x\340:\005yZ)\b\354"
+	.ascii	"\304?\004\342\320M*\032\321\031\t\250\2032=\006c#\317\344j\207"
+	.ascii	"\231Ya\357!\216\330\347\002\026\217\202\265\207\237\243\b\244"
+	.ascii	"\235\237\271\372\027\216y\237\246\335\376q\257Ft\312\002\351"
+	.ascii	"d\237\274n\033\244VvB\215\347\351Yej\211\302\204j\b\360"
+	.text
+	.section	.gnu.lto_.pureconst.6fca6f322b6f3fc6,"e",@progbits
+	.string	"(\265/\375 II\002"
+	.string	"E"
+	.string	""
+	.string	""
+	.string	"\027"
+	.ascii	"\200\004\001\232\004\003\205\004\005\200\004\007\200\004\b\205"
+	.ascii	"\004\n\205\004\013\271\004\r\030\016\205\004\017\205\004\020"
+	.ascii	"\205\004\021\231\004\023\205\004\024\205\004\025\232\004\026"
+	.ascii	"\232\004\027\230\004\031\230\004\032\204\004\033\204\004\034"
+	.ascii	"\270\004\035\264\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.6fca6f322b6f3fc6,"e",@progbits
+	.string	"(\265/\375`\020\001]\b"
+	.ascii	"\342\313"
+	.string	"&,\200K2\034\230\204d\310\305\307\324c\006\253\276\n\031\005:9\004\360\thbm\031\003\253\303\305\356F\217X$je\267\2757\2212\005OTXH\250\033\255\350S\245\t\255\034\002a\032D\2746\332\202\367K\256R~i\233\244\035\352\274pBq&\316C\227\233\300\241\274\241m\030\211\243^\007\002\234@\311\320i)\267\264\036\004\210@\345\020\203PP\315\205\362\207<2I\243\303]d\3344\313Q\372<\037\224\261\2051W\217\375\346}\305\361<s\336\232V(#\362\362\366z~\0042 p\202!3\363\377IL\021\206\313\241\367 \370\226\321\330P\030Z\203f\204\371\373\2748\262F\312\302w1\002{\r\354\312\222\005\356\f5\221\0138\350:\003\2017\026v\024=\302\367\276\031\032\302\273\030\272\002\325?\367\n\200\365B\013\274\020s\013\343\226l\315\231\256\207\266\023\346o\221NDi\334+Xq\232"
+	.ascii	"\355\351x<\353\001\024\001"
+	.text
+	.section	.gnu.lto_.lto.6fca6f322b6f3fc6,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_serialPortIdentifiers.39.6fca6f322b6f3fc6,"e",@progbits
+	.string	"(\265/\375 v\345\002"
+	.string	"4\004i"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\325"
+	.string	"\001\007\005\001\006\025\325"
+	.string	"\001\006\325"
+	.string	"\001\005\325"
+	.string	"\001\004\003\002\002?\202\210\200\300\001\1773,4-\305\001\304\001\303\001.\302\001\301\001\300\001\277\001\276\001\275\001\274\001\273\001"
+	.string	"\n"
+	.string	"@\bT\343\300\004\230G\300"
+	.string	"\314&\260"
+	.ascii	"L!)\327\017\240\b"
+	.text
+	.section	.gnu.lto_baudRates.41.6fca6f322b6f3fc6,"e",@progbits
+	.string	"(\265/\375` "
+	.string	"\025\006"
+	.string	"\302\210!*po\326|\375k\213A\252\277\343n\220\265_}\252\327\037\353\375\215\246eUUU\345|\330 =\317\001\276\301\352\244Q#2\311u\314\2315o\346\\\336\331\334\363g\320\347\241E\217\032\223F/m\3724\352\324\252W\263n\355\372\305\030\266\210\330\362\212\022H\035D\255f-"
+	.string	"\315\334\272\220\363\304\333\375UF\304%\220\030\257@a\222\003\007y\t\217\260,\304\316\324\253\263\3115\374qoSR\331 \367V\257\365C\034"
+	.string	"4\023\004\306\325L\0160\027\\\004\303\300m`\004\270\b\206\201s1\355R\\-\304\242\201\021\340\006\264\013d\300]\320\006\310\215y\003\332\0058\240] \204\314[\007"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_serialFindPortConfigurationMutable.42.6fca6f322b6f3fc6,"e",@progbits
+	.string	"(\265/\375`H\002\005\024"
+	.string	"\246&\210J\300\020)\035\272\342\316\250\327f7\224\fN/\271\221\235\347\356(\002\024l\\\334\261\255\346\217\t~\312\355\214\016\325\357\247\255:u\2407\250'\253$\n\3336E\321%\361\347>\363)\220\317/8\307\3600EO\032\331D\356\224\002t"
+	.string	"m"
+	.string	"u"
+	.string	"\343)\202\360&~\302\305\264\002\345\216\r+\207)\006h\252\326\262\345\362\003\304\323\361\002\304\323\355\340\361ay\213\223v\225H\303\2354\377\345\252P5SC\343#\027\023\216@9\341\274g\233\342\210\233S\b\272 .\227\341a\350\240\207\307\303G\356B\270?\276\027\367}\312\344ns\337\373\374I\331\224\204r7\237\252\222Z\253'.gs\217\267\235\263]b\317\223su~70h\360\352\330\253\361\345\257z\320-zz\317\273\347N\337\203D\304\024\324\001\030\265\322\004u\324\030\324(\304\203~\336\247}\373@\276\317,?\210\366\nS\263\242\311\261\361Tk\331`\374\217\3373\213\347\243\361\245f\364\361\232\236j\255 \247^0\236\336v\261Y\266\347\264\357s\024./[\302"
+	.string	"\365\226\303\241\250\326\252\300\t\002\301\271 pR3\350\356\374\250\036\244\025w\26526p\2535\205\273\263j\2773^\215\333\004\332>\271\213\026\232\204\203\307\350\227\002"
+	.ascii	"Jj\212\350E4\361\364K\223p\224\360y\013Z\310\022\316\266\205"
+	.ascii	"\263@\371\320N\255u\344\324\226}E\n\311R\255\225\201\212\013"
+	.ascii	"\251\370\037NM\201e\036w\352\263\210\247\342\336\367\020\250"
+	.ascii	"s\302\335\324fp}39~\273;\273\264\005\260\025\327\213|\305\\&"
+	.ascii	"\253\n\260W\214\2443\030\031\201\\\211\301^\244\207MD$\270\310"
+	.ascii	"\031L\245%#[1\322\205\3222\231\251\264D\bX6\0016k\255\310d\263"
+	.ascii	"\026\253\254}u\374\024\177 \003\350#\022?\364\373\276\212\352"
+	.ascii	"A\nW\273\273.\251\255m\203jwf\341\320q\227i\202|\256\214\217"
+	.ascii	"\304\271\337\301c\272M\340\303Zk\025C>w\334\367NI\350\224`t\266"
+	.ascii	"\031& @\002\203\030\324m*\002\236>\003\301\335lv\tK4\277\020"
+	.ascii	"e\317\005Lv\235\335\033m\273\\\260p\245\227\205w@\240\247\342"
+	.ascii	"t\3233W\243=xK\036G\";\241\335\266\267P\200\252o\321|\254\245"
+	.ascii	"\033\272\211\300\343T[2_\017\273\033\211\300\244\254$8B\2245"
+	.ascii	"\236{\265\370\t"
+	.text
+	.section	.gnu.lto_serialConfig_Registry.46.6fca6f322b6f3fc6,"e",@progbits
+	.string	"(\265/\375 \234u\004"
+	.string	"\324\007k"
+	.string	""
+	.string	""
+	.string	"%"
+	.string	"\005\001\212\001\202\200\200\374\342\303\376\261\033\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\357\006us\307\006uq"
+	.string	"\005\001\006'\001\344\035\001'\001\215 ?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\027./src/main/io/serial.c"
+	.string	"\005"
+	.ascii	"P\005V\t\036f\321)\212\274\001\024\001"
+	.text
+	.section	.gnu.lto_pgResetFn_serialConfig.47.6fca6f322b6f3fc6,"e",@progbits
+	.string	"(\265/\375`$\003\265\024"
+	.string	"6\344\201J\300\322Q:P\251N\007\024NA\233\032\273\177\247g\201\024\263\314\201\314\n\233\031@&\332\344m\340\276\210\254\363\231\255OLW\234\243\325\207j\301d\3412\025v\020\n\022\220,Nx\351a\026Yh\211\322L\205X\262\311\336)\005h"
+	.string	"f"
+	.string	"r"
+	.string	"\265\013\311|\300\356N\223\215\335\322\201K\306W\227/ \276\216' \276\272f\013y\331\263\337\005K\024\001w\227\244*<>,\357p\326^C:k\376\320'\316\017\367;\322\331^C\226\315\rT"
+	.ascii	"\035\211\360E5\004E"
+	.string	"\215\0167C\0269\247'\372\354\025\355~G\272\234O\226\204\335\365\314\351pn\361\266C\330\206`\323\227F.z\267\031\244\224gs\245D]\247\237n&\321\365Jm\021#\346s&Q\272\271\232\242\2416\273\264M\312c\377EE\363c\272c\267.\364\327\357\3569\247/ \305\007\244b\300\3335\021,\262\276\332[\361\335\355\227>\021\214\307\250}\347\245\321v3\362\212j\246v\327\365\352\007\343k\202\360#\266?\355\007\375Ea\203O\332\2421=>htp8ng\270\323\017_\017\t\310)o\352\301\344\304\003\206\032\276CG\016\036P\275\212ho\370\r\225\236R\353f\004\264:\265W^\203\245$\212\006lA\317\356\276^\355\226'\305\306\335\215\200\004\323\301@\224\217\214\370*&\345\252n3\030\363#\227qw\346\345\313\370\fYx\237W\203\240\211\317\275\3724z\242\207-n\001\261\267\3048\274\310&"
+	.ascii	"0\213\211\207\225\330\fF#e1\362%\266\342B\262\314h\244\311\001"
+	.ascii	"\313>\300f$\214L6#G\312=\3351\205\024\276\033\305\331O?\021m"
+	.ascii	"\013\017rB2\202\003\005\354]\270\224\312X\341\304\217N\220\325"
+	.ascii	"\355(\242\215\341?\024\005P0\004@H>tWU\022\260R\036\263x\320"
+	.ascii	"\026\245R\323\365Ik\274$Nz\241\235\324\314$\362pw7A\250qL\303"
+	.ascii	"\2202\025\221\210\210\214\0264\017\260\002\021:\252\007\021`"
+	.ascii	"Q\025\220\310\220\251G\033m\243\242\361\205\004\365\210T\357"
+	.ascii	"k\264>j\301\025\213\003\034\312'\247\203X\260;H$\230\217\276"
+	.ascii	"\241\377\256\263Ul \232\np\320&P\272\337\357\\\247\324\373\235"
+	.ascii	"\353$\3234J\2678\0011n\022\336zo\200\241\f\223\016\376\362\013"
+	.ascii	"}[\230g\"\216\251 \326\336\253\274=P\217h\301h\226\372\035\030"
+	.ascii	"GG\341\354\362iN\bg_\315R\003"
+	.text
+	.section	.gnu.lto_lookupBaudRateIndex.48.6fca6f322b6f3fc6,"e",@progbits
+	.string	"(\265/\375`\223\001e\020"
+	.string	"\306^nG\340\320(\035ZM\300V\204\347\241\341}\250\247\234`\026\376s'\211\b\263l\032\365c^K*\031J\217\306\352\201\277vMF\255\333t\275\307G\254e\210A0\213\345\007.J\020\240\254\026\007\022\264\202\020\262\367\226;\245X"
+	.string	"X"
+	.string	"Z"
+	.ascii	"\3632^\300\274\334\030\007x\254\367\204\251oS\306\205)_\345["
+	.ascii	"\334\332\316\013\307\307\212 \257\030\026\227\035\272>\025\234"
+	.ascii	"3.\227\"\261\237\326\227\3411\202\324|\340\300\361\261\304\r"
+	.ascii	"A\323\t}+\270\227\035A\214\247\365\271\034n!\224R\303\326\207"
+	.ascii	"\341\346n\333e\233\201}\021\001\267\3717C\313\327;\276\336+\241"
+	.ascii	"a\204>\200\220\211Z\007\tJ/\004\331\240-d\216\207\327\337F\371"
+	.ascii	"2\207\254\240\001\3525"
+	.string	"\205\2432\033\r\206\"\006\2455\301\245=\boS\301\035\245/'JPZ;|\200\273<\210\323\240\234\212u\303\267\261\354\260phPZ=\003\037\020-/\025\f\202\264\231\032\032d\334\270\273.{\267[\221\330O\201z\243\023\027\346m\341\232f/V\020\310\302qJ8JW\037\376\3547\245\370\016\227\226p\232o]\372\247y\t\267\313\211\373\275\354QE\f\006\353\306\n\f\332\332\214\032\031\2730\273\252\300\177\214hq\341\205q\307\005\024F$&$9B\021= \231 \202\300y\304#\202\210d\032\235\274\022\3113!\211J\274\021\323\311\363 \340\322\311\310\344\241\224J&\257\322/\214OV\274\246\237\232\227\275\223I\341\023\273\225r\035\262\262*\236ma^\320#\271\225-h\327}f=+\b\364H)\245saO\231q9\00741\236  0\002\202\234U\035h\t\376\\Km\206\327\236\272\344\f\273"
+	.ascii	"\324|\301\345>\271\005\013\001\210f\022\026\367\345aC^a\017m"
+	.ascii	"\013\272\345\311m\203\237\004\226@\300\375a|B\023\017\374\315"
+	.ascii	"\260%,\301)\202-\004\256\261\207\262\342\033\235\366\221\001"
+	.text
+	.section	.gnu.lto_findSerialPortIndexByIdentifier.49.6fca6f322b6f3fc6,"e",@progbits
+	.string	"(\265/\375`}\001\335\017"
+	.string	"\346\335jF\360\260(\035z\267\377\0071mn\343d\370\323u3Z\350\337\216\301\301\224\320d\3563\r\313E\300\270[Ok{\021\216\367(\316\036g\341\325\234I\317\300Sd\026\321\237S\272nL\223[\200VO\310\336[\356\224\002W"
+	.string	"T"
+	.string	"Y"
+	.string	"\361\002\346\245\212\360\366\370\272'$]\2332*$\371\245kQKQ\261\361\361\241\304\220\0345,\217\035\252\276\023\234'V.\037\270\314R\237\207\307\350\200E\n\022\037_\206\250\261Y\f\317\207\202\372\330\023\264nR\337\312\241&\262\273\206\251\257\303\275\335\266\312v\003\373&\002\256_*\264\036vC\b\375\315\203C\343S\263\313a\207\307\316\2201.\207\335\376\313\217\301,\263\225T\266\231\f\207\315\356\202\\\232\301vy\233d{\340]\030\f`\267\205\007\214\335]\340\003\333\345U|\005\311\226\211\257\021\337Y4(2\234\335\345\f|\300\274\f\n\016uJ\024\255\033\r!Np\007\266R;j\310\250P5U\271"
+	.string	"\312D\023\225e\251W\357\345\006\n\352\\\370\013\n\333.*\304wq\331(\276\304\245+\234\314\247.\375\223yy}\354\bZnrbLpGg)90\252,\373U\202\272\202\321\261\341\203uek\363\001\026@%\241Nz\240\016Bg\022\002\225t\001L\362\2110\322y\240\021'\352\270P7\"\201#\361F\334\207\200E\023@\036g\"\022y\234\307{]\371-\276\331\310p\315\317\0355UU\213\230\364\004BS\226=,r\252\316@\220CUYfB}\217\227\031\024\324y\334\335\235\001\036"
+	.ascii	"\022\023D\246& \275\033\321J(\267\346s\025e\353\3514\f\241\241"
+	.ascii	"u\316\342\021\026\036\023\350\231\027\005\346\245\256q@\b\211"
+	.ascii	"\022\3021\343\351\302\226\272\240\246\310\207\n\367\317\fd\312"
+	.ascii	"\022\\\212\250\026\002\203\306^QV\250\033\235v\222\001"
+	.text
+	.section	.gnu.lto_findSerialPortUsageByIdentifier.50.6fca6f322b6f3fc6,"e",@progbits
+	.string	"(\265/\375`1\002\215\023"
+	.string	"\226\345\203I\320\322(\035R\211\001i\315\326\273!~v"
+	.string	"\274s\311\334\340/#\037\216\335\220\005\005\372\033\267\377\003/\300\325\233\201\277\376\220\342\034\332\b\374>=\203\350\207\321P5\307\276B\206\346\025\364\243\237\177 7T\362\311\336r\247\024p"
+	.string	"j"
+	.string	"q"
+	.ascii	"\363*\276\342eX\001\233N\315\351e\210\fgT\253\r\264\355\003\274"
+	.ascii	"\323\357\002\274\323\315\361\367i\273=\t{\311\243s%\314gyi\226"
+	.ascii	"dht\214\314d\263d\367\343\346\243\213\364R\330\234V\250\021\211"
+	.ascii	"\263\017\2373\002\213Z\211\221\331\313\334\233N\350\271\313\230"
+	.ascii	"YL\356\307\313\032=#\221\317\314\346\262dRk\265\024g5\367w\333"
+	.ascii	"3\333&\266\244\020@<\204\360\342\330\246\333\376\317\2634\375"
+	.ascii	"\355\236\307\335K\245\345\224\276\210\253\032\355\300\244Zg\222"
+	.ascii	"\204\324\033\224\306\211\343\376\333\245}\373=~\316'\037\007"
+	.ascii	"{\205\2411\315\310D\b\337\351\355\227?\372\344\006\016^\277\251"
+	.ascii	"|\025EI\227\323\241\250V[\202S3\370\244\264\317\363\026\257\333"
+	.ascii	"Vf\200\032#\001\002\250\326\272"
+	.string	"\300\b\276\323\003\001IrG\f\202\203.\315/\332\355\254\267\27316\020k\3511\227\346o\345\266\306\0351\211d\373\302\201V\350P}\360\203\002`\304\325d|\006\314;\225K\207pG<>\f\230\002\035\3216\207\373\240H\320\251\265\226\270\370\013\226o\342\324\032\\\362\342\251\357\362N\275\335\034\242\315\334\357s\247F5!\331\220\026\231\264:\231\243\240]\232mc\221\213\023\024\252\024T*L\255P'\246\r\252\324*\244-Uh!LY\251R\241\210OH0\240\302\226\312\005\262Bp\025\242P\300\223\226\013$!`V\006U\013La\261Z\340\311\365\213\343\217\237@4\243\373\361\036\343\317\335T\264\333\231\273\224\256MZ\326EDii6\331\240\246\245\242t\314}\214<b\022\351\263\326Z\275\245]\305\233k\332\217\2477\265\037\230\021.2' 0\002\204\030\324\035\037\202\230>C\301\335NR\352\357<\265"
+	.ascii	"\024\016 \270\341\r\026\331\027^\354\r/\013\334\302\303\210\002"
+	.ascii	"1\002\320\003\021\005rBe\206C\215\005t\223\233\321 \216\031\205"
+	.ascii	"\243\001\326\027O\235>\030#W\227o\222,\200L\341q\336\270\005"
+	.ascii	"\246\324J\255#\240\254\301\271W\373\236"
+	.text
+	.section	.gnu.lto_findSerialPortUsageByPort.51.6fca6f322b6f3fc6,"e",@progbits
+	.string	"(\265/\375`'\002]\023"
+	.string	"\306d\202I\320\362&\035R\216\301^;\260\212, \205\316'\335U*\373R\"\005<\324\354\325\035b\036l\377\261\226\320~\331c\256g\251\360\tp\300X7\002\037 \253\007`\323\016h\224\210\346\025|\361\371\3466\006#\322\310\336r\247\024n"
+	.string	"i"
+	.string	"n"
+	.string	"+d\354*0\376\350\220\304xb-\236j\035A\217\037\320\235z\027\320\235\256\217\275\317\361\356\244\353\251\216\316\225.\177\346\251\231\272\311\341Q\"\213\315\023 L<\267\275d\227b\347\324B-J\224y\370\234\021X"
+	.string	"\215(\221q\230+\224;:\356\322F\006\223{\333\245\r\242\227\322\220l\3472\205Rk\265\024e:\267w\3332\333(\266\244\020rgFA:\204\360\316\354\357A\277\327Y\232~\274\347o\367Ji9\245?\362-\345pJ\372"
+	.ascii	"\341\250V\234(\"\025\007\255q\342\267\177\274\264o_\310\307\335"
+	.ascii	"\\\25759\037N\254\347\201wz[\306\267\231\304\f\032\310|\204\361"
+	.ascii	"*\212T\316\007DS\255#\202S/\220\362A1\017P\353\214\b\215ZG\005"
+	.ascii	">\340\235^\305\003Bt\320\245\371MNH\333\355\256\215\r\300h|\314"
+	.ascii	"\245\331[\271\255[\017\230\204\262\275r\242\030\232T\004Tku0"
+	.ascii	"#\004p#z\212q\031\256\356T.M*\252\005\3710\\\t~D\333\033\376"
+	.ascii	"\"\224\360Sk=q\361\\\006\277\304\251[^\344\305S\377\245;\355"
+	.ascii	"vw\210;s\277\307\235>\325\230bEhd\324\346n\206\030\355\322\354"
+	.ascii	"q&+\027\225\nK\205E\225\362iX\251\260\260\250K+\2540\342\024"
+	.ascii	"\223\013*Vk\325\002\206,\220\205\245Z\001SZ-\240\t\001\207\030"
+	.ascii	"V-\320%\f[ \211\353w\346\333>A\211D\256\250\373\320\217\373\327"
+	.ascii	"\344\2044w)]\243\320\354\253'\2654\1777\350\267T\224\266\371"
+	.ascii	"\217\333\022LB}\326Zk\267\264\303ts\277\275\355\224\247\246T"
+	.ascii	"#\342%\243\344\232\020\003'  \002\203 \324\035n\315\177\bw\372"
+	.ascii	"\f\005w;I\251y\347\335\002X\370Yp\271\013\206#\330\213\316\210"
+	.ascii	"6\006\333 \257\013\300\tD\300\276\205\312\016\207\210\005}\223"
+	.ascii	"\233\361\020\307\210\262\321\200\346\r\r\004Q\220\362\023\232"
+	.ascii	"p\340o\006\262\265\004\247\b\266\300\\\255\334:\002\312\232\316"
+	.ascii	"\275\332\376\004"
+	.text
+	.section	.gnu.lto_findSerialPortConfig.53.6fca6f322b6f3fc6,"e",@progbits
+	.string	"(\265/\375`["
+	.string	"U\t"
+	.string	"fRB:@\305(\035\025\r\343<3FJ\214\272'\244a\021r}\331!\035\330\006\354"
+	.string	"}ld\372D\2465HY#k}c\216\242s2\300C \\\360\370\017\301\025\321d\223\275S\n0"
+	.string	"2"
+	.string	"0"
+	.string	"\0075\205\302\264T\026\253\226\335:]_\220]j'\310.c\307I\207$\377$\307@T/z\372\016\003\026v\327\220\236Pw\274m\215\355\215mW\226\257\177\314\0042X\024Z\273\030/"
+	.string	"\313\222*\037\266G\366\3056\204\366E>2z\235\300\006\326\244q\221\262[\023\254\321.3\230m_\365\220\221I\001\246\370Y\203\277W2\204\277\344'\036&\265[:\365M\276\202\360=.\035\362\340\351\245\357EH\300SC\024\027\253\"~v\375`\344\260\217m\334\b n\023u@\036\203\346\316\306\201\263u\236\320\344\266\t\3328\237\331\351Bsc`\356\301\323M\021\307u\363R\367\2261S\212\024\276\300\030\355\206\017<\225\021\023\200\025\013"
+	.ascii	"2\003\302\260\343\216\213\367\320\226\0139\307\0306\251\r\016"
+	.ascii	"\214\021\320\304\223\222b\272&\031"
+	.text
+	.section	.gnu.lto_findNextSerialPortConfig.54.6fca6f322b6f3fc6,"e",@progbits
+	.string	"(\265/\375`l\002m\024"
+	.string	"f\346\207J\260\224U:\370\360\177F\227\323\231\331\"\3169:\242\347@.F\034f\030\220\017\2354\035\367\247e6JDE8\337\303\267\243\275\201%\013&\350>\264\362\237\322\237\257\350\036\177t\020\325^\177\375E\223\325\"'jd\023\271S\nu"
+	.string	"j"
+	.string	"w"
+	.ascii	"4b"
+	.string	"J\265\225\bqTk\331\300\nR\247\b\304\277\370O\215g\005\312\036\034\225p\350\026cXkI\272\374\200\3614u\001\343\351\2320\235\263\217\024%\356\234\371\034>\252r6\347\325&MY\221sT\004\240\037.\247sQl\001jqB\225\273\211\033\364S\272\357\363&g\233{\336\023\260\b\326\204C\271\234O\224K\255\325\023\227\303\271S\267\335\3016\213=G\004\363\311\277l\034w\356}\207\260\373\tb#\2426\237\026\370#hh\227\307.ks\205\307\022\n\257\316~\371\243\234x\032\265\323#\235\246tZ\024\247w\247\347{\367U4\345pH\213\216Z=<\035\251;(\222\212\367n?\310\367\331\304\357\315^m>\224\340\b\211\204\324Z285\231:\275]c\233\330\236\323\376\3560j^\00676P\264SD\2240\322\215\365|\330\246\021\243\254\270tE 7\0205O\370\r\n\024(\034\332Hb\005"
+	.string	"\006\2075\2164[\n\024:\355|\243\031y\234\355\r/\252p\242\036\265\332XV'b9\350\251\325\2662\3434Z\027\\\256\361\364dE&\234\316\270\273\007\220\334\222\314\265a.${\260G\255u\305\377]F\214\357sj\230\314<\356\324\227\031O\217#B\013\255\231\325\213\353\345\265b\225\274`\256\031\326K\203\205\224Y*\030V\256XKF\302\\\344\313\265\212!Y1\031\251B\300\260\f\255\0309\003\203\305H\023\323\276:\237\367\007\302\245\237\021\375\321\357;"
+	.ascii	"\037\247&\361\213\332\233\265\013mk)\306\3451jI\364\230l\230"
+	.ascii	"\347\220\245p\214{\336\027$\005]\354h\363I\254\265V\272<\376"
+	.ascii	"WhG\247\204Z\235\247\217S\323\236\3547- P\202!\005Q\007\241\207"
+	.ascii	"h\352\334f\313e\023a\201\3138\002\323Z\304\305\242\374\237\210"
+	.ascii	"\343\350\264\303\0268\323\255b\317\355\002\205+U\026\337\201"
+	.ascii	"\212w\214(\017C\023c\r)\220=\220\006\016X\242k<H\330\2017ZD\250"
+	.ascii	"\247\004\200Ai\221W+\3408\335\226o\327\303P\225\322\221m#-8\036"
+	.ascii	"\306\320hM\316\275Z\374\004"
+	.text
+	.section	.gnu.lto_determinePortSharing.55.6fca6f322b6f3fc6,"e",@progbits
+	.string	"(\265/\375`F\001\315\016"
+	.string	"\366[eF"
+	.string	"\261&\035\037\177H<\226N\274\263\346\314~\203q\221ikp\346\244\2073\200\0374S\305\002\325\213\307\270:\246\252\343}\223\036I\027\360\340\326\377\377\277\203\364#\031"
+	.string	"\371\023\220\372\311\201\212\373E\354&[\312\224\002S"
+	.string	"O"
+	.string	"Q"
+	.string	"\007\221\317\342\013\310g\033\342\337e\026W?\377\003T\271\364\360,\206\304\330\371"
+	.ascii	"\0021\304\003,\027\235\030\025\244d\300\200\300S\004\311Q\345"
+	.ascii	"\370\200,\272\261\001\215\313\n\020h\212"
+	.string	"\037\025;%\356\272\276\200,\252\236\2219\2475\003\310\341\366\3346g\373\201}T\017\377h\365F\265F\365=\002`\344@\210\315\271!\306c\322\310Z\314\330.\331\037\333\253\277\271\020\007\314\223\312\206\201\252\375\326mJ\017SN`\316U\017\026s\206\013\234@{\346P\263\355\327\334D\311_\fE\200\036\235\031-8:\346\f\267\220z\r58\\d\273Z\02013\nS\243\203\215\330I\335\323\310\375\352\312\027-(\223\306lW8\212\2216\347\311\201\217c\001E\233s~\304\263/\202WkEc_\025\211\023\257u\212\214\213\212Q\271^'\335a\207*\272,\373q\356\312\376\315/\003\242\216#\205D(&\232\004\316D\324E y\335\311\207C\"\023H8\257d\264u\334&\342H(l!o\264\211\030pwR\342m\244\256\363\266O8\037\347\256|\031XJ\237\342\032\377O\006\270\001ke\372O\336u"
+	.string	"2\260\324\372\237\334}Y\217\254\254I.+\032"
+	.string	"]\204N\311\242\330-\300\220\331\f\214\201\005\250\032\t\205"
+	.ascii	"l\211\242\224[a\n\bx4\304\025A8VH\256\341M\330(c\0132\tY\202"
+	.ascii	"\021\002\025\016\356\n\322\006\247\020Z\022j\207\n\246\031"
+	.text
+	.section	.gnu.lto_isSerialPortShared.56.6fca6f322b6f3fc6,"e",@progbits
+	.string	"(\265/\375`\234\0015\020"
+	.string	"V_nF"
+	.string	"\261&\035;7\fY"
+	.string	"\315#\251q\0171:\307zB\027\300\336$\257\013H\216\177\353\205z\030W\247f\272\002[\254\210@4a\365\026\265\"\021\214\031Z;\227M\2601\355\254\331U\333\366\265!z\357-eJ\001Z"
+	.string	"Y"
+	.string	"X"
+	.ascii	"\217\376N@>f\007\221\217\266\315\240A\312-\377@\314\274\206\006"
+	.ascii	"\f\216\2159?mk\336r\031\341j\213\177\235\227\2140\241\023\303"
+	.ascii	"r\271\334\360\230A\341h\316\031b\255t!Hk\007\006\200\205\001"
+	.ascii	"\206\300^\035\256s\225a\251T;\036\3149\2551,\rw\307m\253\330"
+	.ascii	"\216`\277'7\277\307s\376\3546\277\204\352(\325P\252W\252U\252"
+	.ascii	"\037"
+	.string	"\n\360\023c$6\347L\f\307\204\021]\210\260\235\262C\266c\212\343\244\236\263\002Es\345\341\305H\3668\202\360\373\211\324o.\250h\256T3\013\262G\221\252\332'\361\022\251\333\260\\\300\234.\237\2369?\005>\220\005q],\016\367\343g\367\013\367\036\273k\200\007&\307\213\306\366\257\326\216\fx\024\251{\030\212l\277\272\262\006\f\007\225\306l\247|E\227\315\271r\340\253\360,d!\036\277\bf\330\274h\354\n{\265Z\254Y\244\\\022\237\225\336\260?\027]\032\373p\3169\275.\333j\320\003\\\267\241J\334J\311\tj\2230\301\344\221NN\003PN$\b\\\267\241J\334\212\311\007\205\315\204\353HP^\247\002rI\244\002i\363L'\255\3334n#\245h%\357\244\211\024p\247b\3624T\327yZ\350\233\207s]\326\230\340\nC\036W\3066hG/\253r\\\320>\223K#\367\303\253\305\023\037"
+	.string	"M\204\216e\341G\334+\263\"%\0238\030e\253a\270\232\004QQ\b"
+	.ascii	"\301\177\342\334\313\262\004\254\200\332\025\006\373\212kN\304"
+	.ascii	"\212\030\204\017F\301e`\004\020>S\243\340\262\246\351D-nJB1j"
+	.ascii	"\366\2544\310Z'\024"
+	.text
+	.section	.gnu.lto_findSharedSerialPort.57.6fca6f322b6f3fc6,"e",@progbits
+	.string	"(\265/\375`\227\003\305\032"
+	.string	"\2261\257J\240\232M:\274\207G\0317\n\256\001\020\255\247\211\336\332\342\3601?8x\336?\377\274~\007\332\342\2616U\017\374z\360\246\357:\n\307tM\30198\256\205\337\303\007/^\020\004\234\216\275\034\322&\267\326\016B\b\331[\356$\003\233"
+	.string	"\221"
+	.string	"\235"
+	.ascii	"w\372\323\317\317\023l\357\2251\305\352\336s\001#\030o\001\320"
+	.ascii	"\013y\323\017\003\0318\227|\342\225\030"
+	.string	"\"\"[\367\236%\237\037\020\336\216\027\020\336\266\r\036_\317\363H\201N\216bhkS ~\320\311*\256\340i9\026\036\214\372@\213K\214\007st<P\303wt\321&K\205V\222\017\306\303\f\301*\273\336\213\333\272\240G\017\254Xo\250\332LM\035\275\n\005\255\261\036Q\2759rZ\324\323\321~\360\t\236\260\232\270\222|G\247\342\204{/\323]\317w\2369331\263\311\334\266.\204hW\003WpYu\377\230\317\034=\224\245\335\022\267\022s\214)\323\300\036\365\277~\3763\227:\223\247:\213L\331\036x\256#\345\026)\323\246\374\232\267\340miI\270\272\227E\327\230k\305*\341q\252_\352\007\276\231\317\374)~\025\277\250n-\214\244\310`\204\177\344R>\277C<\322wU\206\302\370\"\374 \277\2008c\020o\224\272\"\323\345\336S\301-\347\214\267g\376a~1s\035r\250\237G\231\250"
+	.ascii	"\256\216\306R\203\361\366\2466e\016\367^\232&}\024\341r\372\214"
+	.ascii	"\037\271\255\260\"\335N:\017\3411u\261\277\205\260\306Q\312\001"
+	.ascii	"\225E\200v3k\330@\277\203\365\265d\350:\210\2319\\J\007\bFQ["
+	.ascii	"Q\240\354\324d\351br\362'>\341m\367\253^\201\030Eq9=\013\260"
+	.ascii	"\t\253\222\bi\333\240\266\350h\030\016@_\375&\233\331\203I\277"
+	.ascii	"\243}3\324A<\323\357\bA Q\2313\361)\277c\346\022_\";\025\326"
+	.ascii	"\275\272\007\263+\331\221\260t\257\316\201\325\223\320\370:n"
+	.ascii	"9\004\017\375\356\226\317\023\336\222\375\364e\027\263\035\363"
+	.ascii	"\246\001g\253]\250\231\341L\035\232N\217)#i\317\001\201\243m"
+	.ascii	"\320\231\331L\0207\233\0207\263BO\215\206\223\365\370|\200\261"
+	.ascii	"\214\201\b\223f\233\335\312\032\255\354\241\231<\245\314v+\031"
+	.ascii	"\024\340\332\210\231\255\304\325j\266\362u\n\275\225\370D\236"
+	.ascii	"\223u\004D2\362\201\302W}fG\217JH\323\3266O\020\352\334\r\262"
+	.ascii	"\177L\342\020cm\203P.\272\227\327{\357\035\373\3078a\355X?xk"
+	.ascii	"\364\304e\b)G\273(\3755\001\343D\354\037\367\225\036R\205\265"
+	.ascii	"\330E\025n\305\302\310\2572\002\303\030E\250q \245\214b\212 "
+	.ascii	"$\"\"B\"\221:\220\002\031\2631\017\020h\2134\205e\fy\364\264"
+	.ascii	"v\r\305\217\312F\375\200\316B\375R\312`\340\005\242\362\360\375"
+	.ascii	"\271\342\033\261\312'\266\210\3328\247\203.~Cl\334E\301\031Q"
+	.ascii	"\336e!\332\270R\226\213\002.y/\177R\231p\360\026\236\t\342!\200"
+	.ascii	" \t6\313\223A\244\303\324\253<\233\363\317\314J\205\322q\260"
+	.ascii	"a\376\020\300\224<\201S\254\260\236(\220\035\023p7\016\371\005"
+	.ascii	"\n`\276\350f\0041\307\313\225\347.*\277\006M\003"
+	.text
+	.section	.gnu.lto_isSerialConfigValid.58.6fca6f322b6f3fc6,"e",@progbits
+	.string	"(\265/\375`?\006m)"
+	.string	"JL\304\020D`^N:\373\307\211\030\253^&"
+	.string	"\247%\204\332\232\353o"
+	.string	"_\320\016tv\334&\233^\333M\230+D\035\206\345w\253C\r\365%p\n\0324\315\350%\270\3115\003\352lK\241V\264\266l\021K6\221;\311\372"
+	.string	"\351"
+	.string	"\375"
+	.ascii	")\233\333\026<\252\252zH\177\235\3163c\361\327\370\307W^9i)U"
+	.ascii	"\260\foq\322\240~9Cj-\363\323\256\005\353j;^\244\252ej\302\250"
+	.ascii	"\252\262\001\037H\177Y\371$\3647\375\021\372\033\201\002\026"
+	.ascii	"g]\331\004\354ffF\346\235\252*\207\315\204\323\237\312s\320f"
+	.ascii	"}H\030\004\376|Bi\017\275g\333,\276\326\207\316\005H\316\244"
+	.ascii	"\265\325"
+	.string	"\n\317\336\217#\335\333\034\311\316\013y\356\020y\223\313\006\237\226\204\0359P\210\\\177R\216F\254\357L\002\203\342\3656\307\"\347\002<b\374\\\312\221\210\025:5\fI\317&24bos4r\032`\243\204\316\335\376$\3458f{\337Br\364\324@\206FL\2104\236g\243\204\316\017\271\332\353C\n\371)D\3628\235\334n\277\220]\266\337\374\202\267\2734\274$aGn{\033TUe\353\205\f;\023\235\371\017\230\031\005\363=\013\\\034\3651R\227\017\034+qbf@\350\362\306J\230\rT\374\263\034}\371\300\271\242\366/9&4Q\325\256{13\210{\211q2qT\265\353\302\324\341f\244\252\332U\341m\003\325\233M\316~\371;\320_\247\276\333o\02086\257 [vP\263\375\300\213\353N2+\271l\227\275!}X\341.c.\360\364\266\263\323\325~\002l\271\351\3143\323\222R\3172"
+	.string	"\266\234\224ZF\352Y>\272\226\215\256\345\242k\231\350Z\036\272\226\205\327r\360Z\006^\313\277k\331w-\013]\313\351\265\334\273\226\321k\371^y>Q\313}-\333k\371\006\030\224\221\0311s\322uJ\025lP u\315\215\213\362\266\237\371+\337\314g>\033\337\255-\307\325\365(\024f\327\206GU\225!\322s\3417\371\367\313_\276\013\326\231,\227j\035\003y\334\310\321b\212i\023\352$[#.U\264\366\270I\323e\001\331\036vv\177\322\363.\265\320\354\315\b\346|j\245\376\372\023\240E-`\311\234e\232\017:\021%\352\242\226!h\215\273K#\003;\021\035j\242n\341\3058&\354`\0175\006\346Jv\006[\330,\346\326<`\373:\330P^V\264\367\350\222\004y\"\372k`\017\347\214c\r\376\376\265\003Ak\236P\367\332\327\003\344V\264\036\002G7\345D4m\241V"
+	.string	"\3078f\317r\350;m\005\3145\017\355w\257{s+Z/\313\234\235?'\242\267\321\016P\207\301\337\267-\210\321Y\3265\363\270ZY\347\316O\317\300\333\027(h'\031\351-\320\356CY\3321\257\370\231\026\2757tf\312t\367\336\320]Q\333\272\235\374\025\272\324Om\005\247f%\343\272\033\2664\273\263\223LDm[-\345tY@\374\023\321\267\355\263\217q,1\246`T\325\360\351\220zQ5uoT\341(r\270aU\034Q\303\006\025pF\224\224\f\016E\0231\246`T\0259\034q\224\003\032\304)+)\033\303\342\324\260j\212H5\214\262\2621t\240\304\305\032RV\303\033\305\242\325\360\307\314\254\334z\227\361\327\336aN\01760\302?\013\275\333?\330}a\003\203~\316\233\232\3326\327\225\241\340R\237\375u\205\002h\027W\350\331"
+	.ascii	"\020P\311[\3265/\344Y\321\204\235\344\037\021`\212'$\317B\235"
+	.ascii	"\251\277\370\004*\365\327\236\366\021\222\306\362\027S?\357\247"
+	.ascii	"\252\252j\220\301\231\272@\277y(15\313\272\246\245bG\317\033"
+	.ascii	"\260\223\234\205&\365\325\230,R;5\263\b\022\366^I\355\304\243"
+	.ascii	"\265\370\250\221\272\231\306\274\255\022\267;\221\276\356qPp"
+	.ascii	"\n\025\366^*\320\337\243\226 \326\007\357I\022 ]?\243n;K97\315"
+	.ascii	"\250\0030\177\326\024\264\372:\311r\267m\261h\005t\250Q(\203"
+	.ascii	"\b\203\002\205\034\221\231\021M\224\326`\002\231*\243z\021\320"
+	.ascii	"M$Qa\330\016\032\323\277\246\252\325i/z\344s)\202\337\325r\312"
+	.ascii	"\016\272D\312M\002\003-\025a \n@\257\350k\354\250\2041\322\273"
+	.ascii	"\367\013\3369\370\020\033\341ox\254\21147$Q%\244PVj\016\250\336"
+	.ascii	"\354\340\2660\252\243\035\020,\370\"\33243\303\314&\b\240\021"
+	.ascii	"\233\301)\305\254\365\250\230\337\201\243kN\255\321\356\372\020"
+	.ascii	"z\340\335c\002lB\270D\235\325\241\254\332\241\267\321\024c\316"
+	.ascii	"\320\372\304\020\223\207x\023\250d\020\370\220`%\317M$H9%\216"
+	.ascii	"A\241\363-\333\222[\266O\350\020\200Z\225\034\303A\340Kd\311"
+	.ascii	"\240\261\372\210\221\212\316\3368%/\324\356W&6T\247\257\235m"
+	.ascii	"\241D\355Ol\224n\271\223]\177\247\315\233]\023\357h\f\033\271"
+	.ascii	"\231_\2028\b\236^\374\345\025\276?"
+	.text
+	.section	.gnu.lto_serialFindPortConfiguration.59.6fca6f322b6f3fc6,"e",@progbits
+	.string	"(\265/\375`I\002\345\023"
+	.string	"\266f\207J\320\360(\035\332\264[\004\335\2318\206\003\3732\250>Q`<\004\316v(\230/\330\376h\021\357\356\363u\266\t\340kz5T\032\244TR\364\351\301<\212\245\036\246_e\220 \0130)\320\204\021\272b\271g%\237l\"wJ\001t"
+	.string	"l"
+	.string	"s"
+	.ascii	"\341\351\201\357(\236\242\305\263"
+	.string	"\002\344\315\f\310\022\016\246\007\252VR4\371\001\340ix\001\340\351\206p\370\217\274\3019\273\n\244\337\316\231\357r\325\247\212\221\251\001\222\203\371F\236\232h\336\253M0GwZ\"\243\274\3458\374\373\034\250\320\021\001\222\303\360-O\031\343\345'.g\233\373\336\247\221\017/\351'\247\373T\221\324Z=o\271\231;\274\355\234m\022{\236\004kC\224#\203\007\257\215\275\nO\376\252\373\334\240\247\367\274{\356\364?~\202\204z*I\252u\303\024\217:\203\026\225\270\317\317\373\264o\277\307/\315\362}f\257/2\253\231\245\030\247Z\311\006\341y\374\236Y<\033\205.2a\t\244\301\251\326\032r\352\005\341\351\355\026\233e{N\373;_\321r\362\302\027\240\332@\324\f\325Z\025\030AsI\334t\320\240\273\363\304\311aZpW\213\263\001\033\r\307\267;\253\366+\343\335\260M)\333\343aH\240H%T\021Q\n"
+	.ascii	"\244RG\350C3\360\364K\221\312\250\235\007\315\304\337l[\270\013"
+	.ascii	"\224\007\331\250\3256rj\307\016\224\362\340\246V\033\203\026"
+	.ascii	"\377Q\361G\234\232\002\313\374\355\324g\001O\301}y\252;\332q"
+	.ascii	"\323\321\346\324\2261QD\273;\233\254\315\257\225\226kt\301Z&"
+	.ascii	"\253\n/\027l\244\262\327\030a\\\201\275\\\343\207MDNZ\243\354"
+	.ascii	"\245\"\306F\0216\266PD\023\231\212(B\300\261\t/\231\270\022\213"
+	.ascii	"\311D\226i_\033\237\305!,u(\205\300\277\370\313\177\340\3440"
+	.ascii	"}\253\335]\223\320\266\366A\265;\263hh\270\2534C>\027g#p\356"
+	.ascii	"{\360\224lS\352_\255\265\202\t>7\334\367NM\0345\275\324\324\346"
+	.ascii	"T& @\002\203\034\3349\034\202\2302\003\325\273\331\310\022\232"
+	.ascii	"h~!\312\236\013x\355\006\2517\332v\273`\341J/\013\357\200@O\345"
+	.ascii	"\210\242\271\032\355\201[\2628\224\330\211v\335\310B\201U}\212"
+	.ascii	"fc\255n\350\226\004\034\247\333\222\361z\352n(\002\263\2622\301"
+	.ascii	"\021S\326|\356\325\322'"
+	.text
+	.section	.gnu.lto_doesConfigurationUsePort.60.6fca6f322b6f3fc6,"e",@progbits
+	.string	"(\265/\375`\033\001\275\r"
+	.string	"V\233`C"
+	.string	"q\225\016;\236\002|\305\205%k\375K\301c\211P\216,\006`n\346\252?i\274\203y\032\205q\254\231\035&\200PS\325TN\260\277\375\377\377\235\246\025s\302J#\360=\377|g#\232\354-eJ\001N"
+	.string	"M"
+	.string	"L"
+	.string	"\332\243m\037@ \362\350\237\t\352\0374\220\224X\331\3758\365\360\321#\324\034\371\207\035\326`\201\342\224\"=b8\304\354\356%E!\025v\250Pb\001R&\230\211\2652\034\366,I\215dr,\330]\347)u\341\326n\273\201m\005\366%\004?\214\351\204\351s\374d\303J\f\006\263]\324\314\306\266\210+B\374\365\333\"\037\346\213\377\235\204\350/\221o\005\013\026\024\f\023\225\335\317\343\321\006\266G\177[\246}\021\037!\272k\202-\273\035RR\354n\001\023\330\0361\027\240=\302w\004+\020\355\372\0310\333\373\t\220m\327\224\3007\021\n\331@<^3/\\\245\234=c-\225\nU\226E\264\250*\223q\220\341Bf\312\032\336\022\252\035\001\224?E\315\224\223\245\241bR\222\375\221RY\366\341\356\256ue\355\257;\336\025]H\303\3618\035\315\306\362\351<\007^\250\323q<"
+	.string	"\336|<\320x\237\016\304y<\256\343iB\270\315\007\304}\f\260\007B\367\341B\036\317\207\273|{\270\272rB\217\247f\236Zb[SLIG\234\252\351In\224r\246EeA\224XK\0055\023"
+	.string	"M\204\336\031\341%L\021\270f\2104\215\350\265\2616q]'"
+	.ascii	"\203K\327(\256\021ek\002\216\213\f\256,N\311 \341\322\253\312"
+	.ascii	"W\316fY\023\n"
+	.text
+	.section	.gnu.lto_openSerialPort.61.6fca6f322b6f3fc6,"e",@progbits
+	.string	"(\265/\375`\372\003U\034"
+	.string	"\006\363\271J\220\232Q:\004KX:\202\0277\260^O\001\3750\270\264\b\b\257\346:\347\tK\353\004\"Nm\313\242\\\327\r\273\037\bf\377\370\325\326\357_#1\255\257\305\300\322{2)\351(\177\256\025\260\276\236\365\3146B\b!r'\031\241"
+	.string	"\237"
+	.string	"\244"
+	.string	"l-\363\221<\311\317\327\030/\252\310\241 \312{\357\003V\240\376D`23\337\351\307\037\376\035X\223\210R\257%!\023\260{W\033\257'\200\376T/"
+	.ascii	"\375\331>\376{LM\321\323l\373\343\003\037\243\360\225<\206\355"
+	.ascii	" 2\272\332d\276\360\340\2522\326xz\255b\221\320"
+	.string	"\242\246\203/\306\0333\243\220)\200\306\027\027\232Qh\317\003\031\3354#(s$\241\031e\2303\242\226\222\2311h\333\254P\005J\213f\f2O\244\247\243c\335\016\031\203\326\246\027\356\275l\207F\242\263\354\314\274\203\231\203\314M\025\313\345r\311\335\203\371P\177\200_\235ko\362\003x\325_s\252\177v\251_\366%\177\254\306\262\372\3449\375\372\243l\271g\226\255\314\362\rLX:\302\001\344\330\\\353%.\317\334,\347\023\246_\375\311[\346\037>\362X<K\352\\\"\236\254.G\260\236\253\237y\213\326\004W\246\034\215\334\2736\370\311,T\265\311\316\313\351&\255r\361\242Z5t\344\004J\325{Q\235\262j\032qJ1\030\264\030\023\3622\242\301\264_\362\002-\306\210VL\025\032\312\347E\365\312J\210\362\336\365\001CP\177\006S\017#b\204\245~\210\3342#\375\241\265~\324\020-b\266\272\006X"
+	.string	"]\323\263\226u\254K\230\260\037\326\272\241(e]\243\006\362\227\232t\213\367^\006\271\247,aJ\240Ec\211a\2024\241\351\027\240\352\225\312\350\020\263u\005m\265\331\n\323"
+	.ascii	"\331%\007\203\320P9\033\351V\310\212\013\223\351\203\276\357"
+	.ascii	"%\312\013\363\211K\361\221\300\217\302\203B\275\367~\351\347"
+	.ascii	"\333\346\007\022 \273\274\224(6\210\255\203\246}@\210STW\320"
+	.ascii	"\232\341\232E\233\031\227\263\037\246}\254\313\272\232\222a\312"
+	.ascii	"`\003\231W\240m$\346w\271\025"
+	.string	"\267\036\211\232\217\267\373 \353\361\354\322\034\316N\307\314\371n!pzn7\352\315w\313@k\201\273\335\344\344\3340\300\340\311vv:\037n\247G\205\312\313\351T\350|;9\034\235\214q697\035/\327\263\355t\266\035\335M\307\206\343\365l6\006x\307\223\343\331|\273\035\3176\2737o\367`\232\023%!R\255m\360\2322\2054_\345\335C\314\334\315\027\200:\310\274\367\336X\255\2319|\353gcLSQ\200\326R \311B\2213GO8\356\001e\356p,\036bB_`cl3\203x\226\b+)H\324\272\f\303\240m;\225\002\023\305\025J\250Q$H\220b\212\241\222\211$\b-j\007\220\002\021\301\263\003\021`\275T\224\252\355\336\210\214\225\002;\204\357\202\223\324\n\332SbJ\366\005\217j\341N\324&\243}\225\242w\021?\rE\300\275\177\364\210^\360-\220\261\340W<\016\3071\245\326"
+	.string	"\t\030\025S\354\007\357\213\203]\027bl\254\rE\210Q\355\214v\007\003-\247\373\324\257\354\037\236\231j\374\020\033\364\351]\230X\031\201!8\314\270\266p\257c\201X\353\374*\317 "
+	.ascii	"\003X\306k\351S\211_\210\252[\351\344\273H9\207\035s\025"
+	.text
+	.section	.gnu.lto_closeSerialPort.62.6fca6f322b6f3fc6,"e",@progbits
+	.string	"(\265/\375`\025\001\005\r"
+	.string	"\366\227XE\020q\224\016\030^\265\2020\371\302N\200\241\355)C"
+	.string	"q\017/\021z+\234\201\005QE\315\254P\030\321@\037\333\226.Xb\311\333\226L\275\002D\024A\001\327,\017\200\033\001\220\375cwk\2374\262\367\336)\005C"
+	.string	"B"
+	.string	"F"
+	.string	"\003\260\323\354\002\260S\1776\215\327\222\375\312\214\013'\256\335\325\344\210\177\2372~~\006D}~\270\234\013P`X\001"
+	.string	"~LMJ\313\211\257\0363\200\251\030/\235\335u\f\001=\334\364\266\035\330\356\330\007\t#\366\353=o\362\313\354,\".\026R\313.\207W\216\205A]\224x\375\355\177e\215\355\332\361\005\351\200\331\240\241Fk\267\"8\265\202\354\321\276\352+\276\233\234\036`wD\245\305nM\340\003\331\251\353\003\245lw\031\370'\025\274\215\214\335=\211S\377\204\235^P^*lx\304\227\024a\"dIw`S\032H\021\203\005+\025q\230F)m\n\026\342C\246\374\352\031\326\213\326\215VJ\242\354\212\212\222\304\376\334\335\265\f\240\220\307\203\2601u\334\203\214?\234\b\236\255\003y\032\267i\244\3153\322>\235\247q\n\230\223"
+	.string	"\3524\023\307u\232\246\356\355!?\246$\to\207\256r\302\200\b]\"\314\336\236\"\n'\214\b\2244P\211\204P\275\204\331\334Q\002\027"
+	.ascii	".[\267e\236\314\2000\314l!~7\f\242\355h\030\213'\225\b\310\034"
+	.ascii	"d\255T\326zj\n8\330\325\204(\306\226q\315\346\302\335\214\"\226"
+	.ascii	"\247\256\210k\371)\361\246\024j\017"
+	.text
+	.section	.gnu.lto_serialInit.63.6fca6f322b6f3fc6,"e",@progbits
+	.string	"(\265/\375`\373\003\325\032"
+	.string	"\006\261\255I\260\226Q:t\210S'\264\212\025\310\352\204Wz\035\237j\324Zs2\315\307\224\256s\2465l\361\301\371g\305\b/\365g\354\323@[x\344\300=\305\020l\314"
+	.string	"\306X!\320P\004\206P|=\340i\032+\371d\023\271S\n\232"
+	.string	"\210"
+	.string	"\234"
+	.ascii	"\037@\236zN{\002\205\334\177+\n|\353\352'\245V \216\033\224\247"
+	.ascii	"\316\331Y\0076\325\017]\024\025\371Rk\225-\223\313\217\300\033"
+	.ascii	"6s\227\201\225/\222\216;s\376\220\317\031\\:\342\221^\320e\306"
+	.ascii	"\327\013\236\325\253xH\343L\213\013\222n\302n\030\321x\371\032"
+	.ascii	"\031\\Y\332b\340\351\263E\257h\222\n\224\214\216N_\305;\212\365"
+	.ascii	"X\314q\254\271\262\264%@\217h\204\220d%F\25474\367O\207\320u"
+	.ascii	"\365\353R2\242\361\371\272Pk\365\334\365\214\356\330m\017ms\260"
+	.ascii	"w\030\363;\317)\036TD\033\344\362=\244o\344\302\036\337\311\266"
+	.ascii	"\024\363\273S?\005y\212\363\273J\372q\t\315\242\r\f\232\353\263"
+	.ascii	"?\323\"\312\341\265a\323\034\370\317<x\227t\372E\247Ir\232\222"
+	.ascii	"\323#\235^:=\307\351\327\\L\375\242\245\202K\2550\212a*\025\205"
+	.ascii	"\302\361\340\355\023\361\237\202\216*\203x\245pX\243K\255\365"
+	.ascii	"\346\324\032\312\323\307l\357\264\037\344Br\007\342\f\253U\251"
+	.ascii	"\310\244\326\212\343Yy\232\3405\344\351\030\353[\252\357\266"
+	.ascii	"\212\357!\347\356\236(I7\213\226\232\013+\212\352:z\224W\301"
+	.ascii	"\341P\311i0\005\200\227\250\036\\\266\342\355HB\367k\003\204"
+	.ascii	")\250eh\202\231N9\224d\214\353;\216\234\331\003@\226\202XC\023"
+	.ascii	"\214\277\266\207C\3011\270\252\265V\210\312A\320Tk\235\235>\241"
+	.ascii	"bv[\266\317\241>\224\265\016\315|&o\002b\f!\202\024A\236~\377"
+	.ascii	"\364Q\007q\350\003j\205/\272\232\254g\346\353]\205\274\371\211"
+	.ascii	"\\\tO\200\246Z\205\276\363\221<\311\216\357tj\032\017\217k&\002"
+	.ascii	"*h$|j\364\247\206\301\326\001\350f\3330\200\004\355\304\b\035"
+	.ascii	"\237\f@%l?\002\274#\341\204N\355F\373\221\331j2\237\232N\217"
+	.ascii	"l\347\366#\223@\3006\024\264"
+	.string	"\233\f\310f\273\311b\300\372\2651\344\031\304\324\256.B\253\223Y\237cH%\315.\326\274y\271-\312;\212,\367c>\326Z+,\302\313\245\331\330\214%A\242\221\351\244|aM\235\334\327\025\271/a\226\025\316A\226\234\005XxdY\3501%\365Z\237\177\033\222\356\203 LA\251\231b\261Xu\033r\\\372\035w\211D\035Q8\346HSQ~\220\001H\2501,$\215RF\221)\211HDH\2326\320\002\221\251\262\r\021\020EJL\212J\263\031\210v&-E\362\017!\2765\370d3\257|\207\307;\370b\t\277\241\202\376\034\022Q\253\330\372\221iR\272\364U\246\217\2445Z\330\304#\325\213\376\315j\373j\321\270J\232\326\373\266\251\222ui\262\266\376\256\n=H\021d1[,m\334\217PY\262\203&eo\320z\203\335\343{\2172@\356Z\311\354\352\327\326$C\212*\030\241\2020\3672"
+	.string	"\261"
+	.ascii	"1@\260\346\274\226a\314\300\305\275k\177\311\302\017"
+	.text
+	.section	.gnu.lto_serialRemovePort.64.6fca6f322b6f3fc6,"e",@progbits
+	.string	"(\265/\375`\t\002\025\022"
+	.string	"VbyG\3200'\035\333C@\312\342\222h\0373W\235\035\216b\307R\327?~\322~\034\233'%=\3350\304\262\315\021-E#Ds\374\ttM\237Q\352a\224zyut.1\211\3314\0030\211\022\331\267\204\220\275\345N)f"
+	.string	"`"
+	.string	"g"
+	.ascii	"\237\226\3317^\343\331\0339\321\f\355\330\335OA\330\273\254\335"
+	.ascii	"\\\224\275\343\246\324(\363\201N\340\2064\013_\336\311\316\346"
+	.ascii	"\206\206HH#O\242\240rn{\254\tc\"\367A\002\347\223\303\245$\321"
+	.ascii	"\231\261A$\304 G\230><\261B\231\250\267\235\244\252i\026\342"
+	.ascii	"<v\016v\327q\026j\270\275\333\276\261mb\307\006\001v\355%\236"
+	.ascii	"D\315\370Xwl\220\377\374\253\007\335sF\313\031\2552:j\364C\004"
+	.ascii	"H1]P\332\315p\353\261K\363h\304\203n\277\346\333\314\362\002"
+	.ascii	"\006\262\007\305\274\365\351\212\214\236p\354\326\020|Z\201\367"
+	.ascii	"y\226\355G"
+	.string	"\373)\256B\366\037\027\257v=$\301\330\335\0046\340}\016\370\b\367)\017\200\0131\361f\377\305\215b~\217!\200\3613\220\373T\355\210\246\250:\310\356\302\271(j\021Rb\312\204\324s\222\220PH\245y\245Q_B6d\"\017\333\021N\344r\240\306\356\232\330\266p\026+\005xv\367d\305\207\\~\317\247)\300\342g\237>\214\373\214\272\372\231z\275\355S\247\n\212\246\n&\336\224\310\206*\206*-\025Z*,\340|\265\300\007`\013KK\005\374pJ\211\004\024\360\325\202}.\360c\001QV\276\224\027\354+\t`\327\204\326\353kq\271^\037\253\266\327\035\033\350\236\222\216%\030\215\351\224f\226\214\t\2423Dt\215\027E\b9\311D\036w\355\345rw\227S\332c\334T\020\375\211\252\2468\245\036}\226\343\267\3078U\251\237\321\t& p\002Bu\324\003\241\300\256\323J\330\243+\365\356\261\354M"
+	.string	"o\366\251\345|\202\t\250D\306\207Xl\301\356j\313\206\333\264\3342\213\215\023\034\327\n\251Y\374\241\260\373\266\355@["
+	.ascii	"\026\372\023\350\343~\213\270rZ\230\030\321\371^2D|\007D\032"
+	.ascii	"\262\276oD\335\316E\311"
+	.text
+	.section	.gnu.lto_serialGetAvailablePortCount.65.6fca6f322b6f3fc6,"e",@progbits
+	.string	"(\265/\375 \342E\006"
+	.string	"\302\213+2`k\222\016\203:\202\216R\023\210\242T\266\364\313\251\b0`\237\2574\264v\263'\241U\241\350\013\363\005"
+	.string	" \344\353\372\210\001\270\013\274\302\267\366\367\226)c,\t\227\251\312h\0325\265\205\351\242\3200\225\246Y\002\246\0302Uk\240\250\252U\260,\206\016\007<\370\360\325\350\206u/v\330\\\257Jw3\251t\b0\341\271\354\261\316!\305W\222\030\372\357C\201\221\017\013$\363\223\215\322C\352\020\375\234\257lp\300\331*f\361\231\210F\020\034\"\231X\303\212Z=\3536\243\022\214,\344\002uz\024\204\314\374.\220D\307\376\005?\301\037\021\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_serialIsPortAvailable.66.6fca6f322b6f3fc6,"e",@progbits
+	.string	"(\265/\375`\200\001-\020"
+	.string	"\306\237pF\340\322&\035R;\246\202zW\033#\355f\036\336\376j3\270\242\370\212\016\310Ic[\324\202\370f\002\\\275V\016\236\337F\360}E:\373\024b\3340\303<\355\307\212\020\367\321\201 \275<\304L\030\261do)S\n^"
+	.string	"U"
+	.string	"_"
+	.ascii	"\221A\003\027\263\376\371\344\bp\325\314\024\355\330\3756\ra"
+	.ascii	"\355\360\273c\262\236E\250\311\362_\236A\023N\006\031 ^\013\222"
+	.ascii	"\340\260\261\341\260\347\215\027\223\321\245s\b\035\004\231\020"
+	.ascii	"\001\342\311@\205\305\220P^+\365\260#\330)\"JR\341\351<M%\273"
+	.ascii	"\353\264\3614\334\246\333f\331\036\261?\024\177\t\375\231\323"
+	.ascii	"\360\257[c:a\372\032\204\02298\336i\220vs\226|"
+	.string	"\354\213\310\202\304_\267\377\3710\243\374\027\313\267\265,>\256\233\033\273_\202G/\320\036o\273\330(\333\231\366O<\310\345B->\355~PZ\261\273\nl@{$\360\001\331#|\200\354\001,\231\252IC@\320\270hy\210\311\245\004\262\321\021\003j\2173M\355\210h\310d\017\333\022\036k90cwGl_x\212\224\002>\273K\202\342E*\377\347\321\025Vy\233G\177\225=\246\236\204T\257\207\375\001\f\232\244\231\0370\271\2441\034\036G\252=\366\367\222\312s\224\243\206\203\225\307\016\026R(*\\\354R\\\004nE%\205\302\001\360\211\310\004\023\256K\2556\025\267\251p&)\333I\267\332DB\254\242\220\352\266\025\225\252\333P\337^y\374\241k5\\;1\243\350\263\262\303~\372qa\210\031\351\317\312 T\227\300hL\207L{\214j\001M\032G\244o\264\004\"R\222\311\036\207\273\273\361\017\031"
+	.ascii	"Y\b8Z\315Sz\r\244)u\335\t\301\030P\035\301\202\210\212e\303\355"
+	.ascii	"\342\354m\323\006\232\006`6\352B'\204\315\221,\323\272\355d\n"
+	.ascii	"y\366\264\027\227\002\252\205\252\240\261\251H\274\256I\006"
+	.text
+	.section	.gnu.lto_waitForSerialPortToFinishTransmitting.67.6fca6f322b6f3fc6,"e",@progbits
+	.string	"(\265/\375`\243"
+	.string	"\225\n"
+	.string	"v\023H= \345*\035\340@\260c2CF\023 \351\215\002\212%\256\226\226\361lh\n\002\3571P\377\263\217\275\030Af\224\007\247\033\027\240 E\200\230\0022\270\206\250X$\371\2625B\366\336)\0055"
+	.string	"5"
+	.string	"6"
+	.string	"\225\316\320G\020g\342h:W5\251\325HgL\325Oy\243]\366\3311\236f}\261N/{C\213JF\034Y\237\032\206\335\365\024G\217\273\273\355\007\333\013\366i"
+	.string	"\266\306\321H:\266?\355\233\034\026>\226\361\201\335V\251\262K*8as\316\344\013\272s\233\023t\347\034\3321']{\360\372\330@\231\331]\217\206\270\316\360\\\247\177\261\225\324\335\335\352nr^\321\331\026\027\363\242\237b\203\325P\324Dg,\251\221R\020\2334\315\217\253\274\231\266\354\307\376:\247\257\021\020\341\030\257r\331]\005\b%\360s\3408\344\201"
+	.string	"\215@\021\311\373F\236\304\b\024\341\205@\222\3471\3607!\002\275\322\367\201^\207\334\323\2267\266\225\232\006=q\030\335)x\002\203\232\245\003f\245\366G1/\006\023"
+	.ascii	"m\231'3\360\316#:\326R\\w\365\002\rc\035\2502\251h0/A\273l\221"
+	.ascii	"w\t\240YM\t\356\305-U\252\226\201z\331$\314'"
+	.text
+	.section	.gnu.lto_nopConsumer.68.6fca6f322b6f3fc6,"e",@progbits
+	.string	"(\265/\375 \336\035\006"
+	.string	"R\213*2`M\222\016@\203\017E\"\017\2438\213\021)\315\024\240\320uel\321ox\360X\250\223oA\313ZI\022\022\031\334Q\353=r\006tq\024\333\b\331)\256\343\036\2405\031\b\027\301\r\247\275\250ID.\242i \247e\b~\023\033\330:\357\301\206\251\232\354cP\301,\276\222\026\333\370\204\312>\277\006:P\250\234TZ\214\026\226\236\\L>\376\304\374k\375BC\314\020\212Y\253AR\322V\n#\004\344\345\370)\005\236J\f \036\027#+m\033\343\310\230+\236)\222\002\023%\345\002ph\373\232\250\214\234\345\177\360'\374\236\b"
+	.ascii	"3\003\316\231\001\342\313]\303\265C\030*5\031\334\345E;\311"
+	.text
+	.section	.gnu.lto_serialPassthrough.69.6fca6f322b6f3fc6,"e",@progbits
+	.string	"(\265/\375`\222\004\375\033"
+	.string	"\266\262\262K\260XQ:\360eIJ\234DV/\326\n\236\260\250\252\241\030\315\241`H\nC\306p]\374+MP\376+\277K\037;\345\351C%<\216\350\225>pX~vV@\276\b\371\300\263\230\256\375}g\255\004\304~4B\b\331r'\031\244"
+	.string	"\226"
+	.string	"\232"
+	.ascii	"\242\3541\247\t\263zQ\261\\R%9\212\266\253\214\277s\361\030\031"
+	.ascii	"?\255\fP\216\332\201\266\031\366\300\220\311\312\213l\272j.="
+	.ascii	"\265\203\207\212)C7\031\207\301}\005\264\331\210Q_`\\\345s\023"
+	.ascii	":\313\222=@9\016\264\275\260\021\242\206H^d\273Q]~O\341\330I"
+	.ascii	"\2312t\023z\312>@\213\030\035h\203aSQv\277\367.\240\310\026T"
+	.ascii	"\313\017\335p']P\027\037[\\\364\351\251\226\305\333&\020\362"
+	.ascii	"\0202Q\232m\005\r\021\276\367\372\203\242\250\225\244p\357\345"
+	.ascii	"ZCo\347\326\231o\303\314\023\230[\0303O\372[G\372YO\377\363G"
+	.ascii	"\277y\2443)V\036me\321V\266b\345\266\225\253\255|\001uEp\t\372"
+	.ascii	"\237-\367\002m\301r\235D$:.\344\367-\031\355\264\360\225\370"
+	.ascii	"?Vq\003\007\262\373H\374\372\\\022=vP\206\367\246\b.\262\204"
+	.ascii	"\362bU1'%\201P\221J\004"
+	.string	"8/\215g\203A\032\205\340\225\371@\036D\366#\023_\335\233+r\344\336T\001\027(/rz\231\361b\371\326x\221e\314Q\236\352n\200\335Q\212\336\225{\257\253kp\311&\2730\031g3k\250]\235\004\231\334\336\325\006\233\372\332L\377\367\326/\250$\202.j\230z\215\357\030\357\t\f\016\254\276\366\276\223`\323_\241\004\361IK\003AU\202\310&\"P\023\331C\316\005\\\023\333\352\232\376\341Q\354\334\200\250f\0179\026pB\243{O\274\306\266\262\232\354\037\"o\365\225|\330&\212\311\001\351\316\361K\214\254\356\231\222\016\336\023\255FqY\317\327\255\254f3\213\330\251\257\361{\277.\210:\321z\306\234\316j\0231\277\001\224\217;\307\374\244s\315\205\234i\356;\007\257W\340\351\200\003\213\215\025D\236\0168\260\230\310\303\341\346\203\345\327\202\0176\260\330\315\216K\007\346\002\001\263\311q\275b;\256\005"
+	.ascii	"X'\304M\314\305\243\243\023s\251H~\347\306\346\232f\016,\306"
+	.ascii	"6izl\222\2073\022\303LF\200\272S\354\3770\305\256C!\312POM\251"
+	.ascii	"y\322\364\227\336:\022\314\342D\353\031L\355\321@u+\333#N\333"
+	.ascii	"\357}5\fB\275\314\324n&\233_Tdj7\206\f\3655\256\351\351\031\317"
+	.ascii	"t7I\003\310\227B\313\211\272E\325D\374\267\257\251\007eu\356"
+	.ascii	"L\257\375\"\336S[\250q0%\rR\n\221\210\210$I\r\351\300\002\021"
+	.ascii	"\271:\007\0200\310\244\212\2269`\212\322\361\335\351q\246Q\312"
+	.ascii	"S\202=\212d\021\357\242\377B\221\357\026\344\321\362\326B\275"
+	.ascii	"d9\003\354a\234\246(\351\224\006\377\267\340qS-H;KU\206\363\001"
+	.ascii	"\027\320W\365\034M\22074\271q?\301\341(\340W\\\334\305\220\343"
+	.ascii	"\263\031\302&\007\333\327l\003\334t\266\342w\0015IK\263\275X"
+	.ascii	"\316\200\365\n\002\321\350\032:EB\024 ]P\b\340\377\026\271\272"
+	.ascii	"\3166\n\n\222o\315{<\034+k)\002\ft]\247A\373c>d\026\242\274\b"
+	.ascii	"O\231<\345C5"
+	.text
+	.section	.gnu.lto_.symbol_nodes.6fca6f322b6f3fc6,"e",@progbits
+	.string	"(\265/\375`\177\003\r\021"
+	.string	"\004\031{\004"
+	.string	""
+	.string	""
+	.string	"\002\304"
+	.string	"\177.\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\270\320\202\202\200\006/\177/\260\206\3618\272\320\202\002"
+	.string	""
+	.string	""
+	.string	"\005'0\301\204\001*\1771\234\211\365\321"
+	.string	"\220+20\1773\346\206\316\220)41\1775\0022\1776&\"\300\003\0023\1777\0026\1778\252\333\34264\033\300\003\0025\17797\177:8\177;9\177<\250\212\250\332\001:\177=\270\215\221\313"
+	.string	"\005\310"
+	.string	">`;\177?\002<\177@=\177A\377\377\377\377\003>\177B?\177C\220(D\300\003\002\300"
+	.string	"\177E\002\301"
+	.string	"\177F\302"
+	.string	"\177G\303"
+	.string	"\177H\360\372\250\002\305"
+	.string	"\177I\307\3712\005.J\305\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005,K\001\306"
+	.string	"\177L\037"
+	.string	""
+	.string	"\200\220\200\001\307"
+	.string	"\177M\311"
+	.string	"\177N\313"
+	.string	"\177O\312"
+	.string	"\177P\317"
+	.string	"\177Q\316"
+	.string	"\177R\315"
+	.string	"\177S\314"
+	.string	"\177T\003\001 $\003\r $\003\r\013B\003\020\017\320\371\216\307\003\001b\003\020\b\350\274\307\343\001\001\302\001\003\021!\204\223\242\253\001\001\244\017\003\024\023\"\003\025\b\003\"\271\255\362\217\002\001\204\006\003\026\n\027D\003\034$\221\205\327\307\003\001$\003\034#D\003\035\034\"B\003\035(\300\206\275\355\002\001\344\001\003\035'\244\006\003\035&\304\006\003\035%\007\007\003\035'\231\365\231(\001\244\n\003\035&\300\327\351\371"
+	.string	"\001\304\n\003\035%\013\004\035\325\007\004\035\231\365\231(\001\325\013"
+	.ascii	"A\250A$cyj\346\242$5s\260\002\231\252\232\007\021\340\220F\210"
+	.ascii	"\030\022L \025\ta\320\003\366\225P\234\355\214\022\317\346\215"
+	.ascii	"N\225qj\245\335\235\216]qE\031c\266\331\352Z]8\f\345\332\342"
+	.ascii	"\317k\342\347H\370\362\376,\365U\301\346\265\305\301$M.\262\256"
+	.ascii	"\356\342w\223\266\306\024\316G\270\377b\265\322g,\315\016\214"
+	.ascii	"\244\324$P\314\311\206\353\330-\277\317\237\320\030\"` \356f"
+	.ascii	"\2102@\227\310\345\243\371\204\346\007c\362\200\362v\251\001"
+	.text
+	.section	.gnu.lto_.refs.6fca6f322b6f3fc6,"e",@progbits
+	.string	"(\265/\375 \301\305\003"
+	.string	"\322\311\030\033\240'\351\377\377\377\377\377\377\037x_\332\332\367\326\372\355\177\373d7\322\310&R\246\263\214V\027\346\343^W\321\205\363Npt\374\334\265\021\265r|p/0\236\216#\367\310x\0317\235\307C2\364\245\260\302\017\2413i\200[\362\247\276\2527!\240R7\366\265\"\235\035\361\036\037\336zVMo'\377F\006"
+	.ascii	"v\306b\321{C\264R\305C\026\001\017\226(z"
+	.text
+	.section	.gnu.lto_.decls.6fca6f322b6f3fc6,"e",@progbits
+	.string	"(\265/\375`\377=\335\375"
+	.ascii	"Jy\tTV0\314\034\246\016m\264\026R8v-0\341\274P\341B\201\027\026"
+	.ascii	"\220!\351P\337p\335\302\234\277a\2055R$\342\307\307o\276M4\033"
+	.ascii	"\212\032?\326L\005\263K\213\353\241P\206\372\245\013EpV\221\215"
+	.ascii	"\262Ny\350-\360\024r\254\b\233= G\033\b![J"
+	.string	")S\244\004%\005Y\005Io]co\336\201o\315\311M\017>\256\274\253'_\204\323\274_\001\271\232\215\336\316Slr:\"\032\374\317,\360\233\253\371\350;\360\240k`\3210l\330x\332\3735\030\177\375\026\021\031\213L\325\261\345=T\022&\204\347\205\023\177\f$\356\232\251y\005~sPN\361YE\006z\226\267w\261\251\034\224Od\035\262,\270\240\274\223Q8\240D\017\311\t\273\267k\357\257\006\026\r\032PJ\300q\t\362\215S4\021\212\037\315\266\363\006#o\237-\024\226\326\306\303sO\346\371\267\367~4Z\022\312\313\373\265\224\177&\222sN\206\340\bY\253\3138\377\232h)P\\Y\333M\266a\373P\b\271\313\373\263\315\177.\221M`<\0236;\034\236\274w\307+*\304\\\323\3413\t\242a\021\034\257\274Q\260\n1\bI\237\221\022/\244\033\360\032\264\260)\232\f&E\360\246P\271\007"
+	.string	"\345\005\322Q\312\333\020\343\240\r\311\311\373\210\030\020\034]`E\260\021L\210_\\\210\205<\036\202\211("
+	.string	"\027b3\234\246_3nb\313\246\020\363\300\202\372\252g\204\351\341u\254\020\017.\335\\M\372Mu\216\357\317Q\234X\275\313/\270 V\303A\216\\qu\200y\007\262\224\334\031\365\345\310\373\363\n\376\207\3750\037\336\303W\334\207_\f\210\363\036\377\300@~\277\275\327`\321a\260\262\351\337\265\367\376xM\317\b[[\261+\211P\001\377\0350 \256\303x\372\252\207we\371]\345z\340\270\023\232\224>\265+b\355\375}<\365\337\341\277\003\0170 \236\303q\372\265\366\251\335\016\nL\017\313\326\006{\177Y4\224\3745\025\255\235\354\307o\374\347\360\n\361\210\2758\266\303w\370\315\200}\220\324\274]\213\004/H\221W\336\217\255\370\343\fD\224\f\304\3075\370\343&\376X\005\177<\345\357\345\206\337\360\033"
+	.string	"\f\367\035x\360\232\006\253O\231\030F\031\242\200?\016"
+	.string	"\021\037\342"
+	.ascii	"\020_\311\337\214\r\257\020?\004\234\210w\3403\374n\200\321\036"
+	.ascii	"\227\341\261g\245o\177{\177Q2\214#_Yy\177\007\370\343\r\210\372"
+	.ascii	"\360"
+	.string	"\020o@\374\007\360<\207U\210)xE,\214\204\n\007\220Y\336\377\230\253\013{a\260\\\355\275\246\367~\341D\355\016\253\007\177a\255.\027F\362~\rx\356x\205\210\001\253\020\361V\207\307\\*\304\036\352\333Q\0040\246\266#\357\242\326?\326\201\247p\226\266\311\251v\257\336_\n[\315\247\0170oL\205\253\360\213\263\376\361\025\306\372\215U\355Z\275w\223\222%3/i\336\030\360\nqc\025\253?A\352\335\203\317|\246\367\336\213\370\325\210\377\342\025\"\307*\304\177\274\366\237\321\202\004\3465\300|\375\317\037\376\376\302\377n\323\377\372\355?\203\371\375g\262\276\260\226\256\337\377;\013\003\022P\301I\277\202\377M\343\004\013\370\336\344\1777\265\377\270\001\3778\251\265\367\217/\030}\034\377\367Q\256\300\177\326\373\302\321\341\342\037w\370\201\343\3763\016\023\344\225\274\314\001o\237\220\314\360\377$\377\333\204\354\003c\300"
+	.string	"\203\205\377=\200;\273?\376o\f\374\343\n<\370\307\026|m\004<\377\337\003\250\003\361\377\304\3777\376o\n\377O\370\203\377\317\327\367\377~\377\277\367\377zxH\246\373\3176\346\036"
+	.string	"\377\032\310\177\016\372\317E\377\231\350?\013\375g\240\377L\375\317C\377\371(O\3773\212\377\234\"\367\370\377\224\177\366\203\377\377+\362\377A\260\276\344_\037\376g\343\276\360\217\211\274\006\374\317r\377\031\356?\263\375\347\264\377\\\366\237\303\376\363\326\177\236\372\317O\377\031\351?W\3773\363?\267\377\271\345?'\3773\t\376\263\b\376s\b\376s\t\377\271\003\377\031\003\377\371\203\377<\201\377\034\201\377\354\301\177N\300\177\326\360\2375\370\317\030\3763"
+	.string	"\376s\005\377\031\345?\227\374g\376\237\017\377\361\340?\026\374\307}\377x\307?\006\362\217\363\376\261\363\037\277\375c\r\376\361\005\377\037\370\377G\3761\336?\276\373\307t\377x\204\177\374\341\377\231\377\230\002\377X\356\037\303\375\277\217\377\207\373\307l\377\277\301\377\177\375\377\361\037\243\375\343\263\177L\366\217\307\376q\314?\026\373\307a\377\370\371\217\233\377\230"
+	.ascii	"\3778\203\177\214\301?\346\3778\377c\374\217\377\377\017\377"
+	.ascii	"\337\360\377\303\376?\353\377M\370\377\267\377\277\340\360\360"
+	.ascii	"\360\360\277X\3757\n\376\037`\004\001ZW\266#\334fI\220\232\267"
+	.ascii	"\276b!&@%\244L\220\370\353=\315\367\272O\367i\0368\0065E\206"
+	.ascii	"7\001\342\237\377\211\275\377\260o\357\231\036\211\230\3058\303"
+	.ascii	"\277\t"
+	.string	"\326X\203\336\037\002#\274}\232\366$\310m\224I\2070\364\f\275\323\364\330h!\321P\260\321\222v\233\2559\037\n6ogq\241k)u\233\267J\263\2534\271\277\275\006\311\247\327Ti\2366o\357\351o\225&\245\327\370\244\330\274R\032\033-$\037l\243U\365\241\320k:M\257\221\262\3405U\037\033\270\252O\212\215\226\324\307\246\006\311\007\367\267\3321\035\332\213DS\242kIMz\3579\257\225\346\330\273\264\247\323\324e\235\216t\325\351F\035\317E\275J\235\245\367N\343\365#\251J\362N\373\234\315S\025\246D\357?\272\316\002h0\215\211>\245\301\275\227x{z\237VK@\255\342;\023=\335\244\327Hs\246I\325c\211i\325D\177b\201}l\264\222\252\035vpiY\373\364\245\301\326\376\003\251\207k\321\274\335+\210\211\026\fjN\336@\330\260\236\2679B\277\276\367p\252\tL\343)\227\272\322"
+	.string	"\357\360\253\357\364\231\207\267\323\234d\2358\306q]\2275\235\266{]\247\347\2165]\327\355\336\245\030gp\202q\006\254\232\fi\026q\377q\255\207\226\373\251\223\032mH\364T\335^\355\246\341\360\333yTLD\365\364p\240\337t"
+	.string	"\306\240\322\301\377\310\242\215\255\355\272\003\230\267^\333_$\310\326\362\376\343\017\377\327j\370\325<X\035g\357\212\274_\b\216c\223\206\360\225\345\375jY\240\346\330A\323gG\271\034eB\362>\373\327fzG&:\242\344\255\370*\312\233\367\256\313\250t\221-\"\033d8X\370q\261\215\341d\271II\265X\t\025\265j\f\247O\305\016\020kO\017-\325\323Ak.,\264j\232\"\035\250eD\006ot\215\266\201\372\273\376\304e\303|H\210\225\342\355\312f\344H\f\335\244eh-=CKi+\335\245[\350+\315\245\275t\226\206\241\303\264\013\355\244\3014\225\376\322V\215\245i\350W?i\035\032Jo\351\033\332\206\256\241\243\364\224\306\241_\350\034\370\325UZ\351\365\222f\372\274\306\203\343~\034\201y"
+	.ascii	"\324\266\226\tq\234\241\221.\nS\261\202\315\252\2534\222NR\262"
+	.ascii	"\262\312U\277\254A8\216\f\217\251p\273\022\371\357 4f\325C\272"
+	.ascii	"HLw\024p>r\271\310\241\316\336U\310\220\023\2019V}\243O\370i"
+	.ascii	"\026\022\220\362\322U:\007\247\341\271\026\025\230\342;\202\343"
+	.ascii	"Nt\357FF\2549\210\256\312"
+	.ascii	"\2028\016\317Q;\r\340\002h\320\260*$\256\370\002\274\321\300"
+	.ascii	"\326=x\205\330AI\020\235\024W\202\336\275\2126\016w\002\373\370"
+	.ascii	"\227\274\361/\371\342_R\305\277\244\210k\242\r\024\267\344\224"
+	.ascii	"\367\227\250\340o,\344o\324\343o$\343o\274\342o\304\301\337\370"
+	.ascii	"\202\277Q\211\277q\210\277\361\207\277Q\312\237D\217?\311\031"
+	.ascii	"\177\022+\376$"
+	.string	"L\374I\204\370\223\354\360\347\206\374\371\017\316\202W\210\232\204.\201_\026m\002\327Mw\210\362~N\307S\320\0171\013\361\271\032\177\236\3053\270\340\t\340'\270\003\212\201\374\213n\374\213T\374\213J\374\213'\370\023\013\371\377\340\343\177\215\343?H\034\003\274\242\334 \301T\365\212\361\035\326\327H\336~\033\316\216J\307\257o\247k'-o\237)\026\016\241\250l\305\223\345\304\224_\354\330I]\227`|_\t;\250+V\326\013\353\213\005\303z\025#F\206\372\311\232\341u\324A,\227\201\331\005\205\r]3\035\246\233\312{Y/\343e\276\234\227\177d Y.\307e\037\271G\206\313v\371.\277\3459\374f\272\314\363\271-\273=K\207\264\314\206b\2723\365\205\361NjRzM\222\2215\277Z.\350\362V\356\302\261k\221U\200\025]\351\262YF\303s^]\372\203\301F\017b\246\201E\203nqc\315\256"
+	.string	"\233\370\376\300*\3045\257+>\275\267F^\331\214\274yd5b\225]\013\267#\376Dj>C!\242#\210\247\263\203h\223\311\216O?<N\204cl \177\026\b\177\026\216?[\306\237\345\352\342\262\316\300\352\313{\016\345h\250\303\216E\336\317R\361g\255\374\331$\376,\020\177\366\206'"
+	.string	"\253\020\251r\325\324&\201\206\326\342J5E\254\243\352\\y\347)\024\031dtJyg)\234vH\006\247\226\267\017\0349\307\r\315GsB\352\205#\337@\023Z\"\221w\276a\304z\333\312\362\3164\262\r\2238\2476k\3365NP\t\226\345\375N\361\360\300\250\346\235\255\030\2178D=\362\224w\226\221g\344\032fhAyg\247\243\024\210\214\316\212\277\220\357+Y{\221$g\345\277Yd\027+\226\244}y\377\306\341-\232\2168\311\r\346\375M\357w\304\300\244\356\007H7\344o\246\224\003S\373n\253&.oVj\037\261!1\241E\335\030\036)\2217\013\205\342g\304\344v\304\346\260P\303_\351\331\026\254\022\373\244\361\216\235\006\253\363\024\313\334\254\244\006\273\r5C\311\025\316\025]\236\361\354\323\2636:\360\340\373\240p\340I\363fk<K\203\032wv\265\2624\376I\2146\226\264r\370\340\217"
+	.string	"\216\005\344\343\2237\353\364}\371\251/\0070oV\306\253\035\251y\203Ml\f\271$\273i\336\254\013\366\005~\377\215\205\361'g&\276\336\344\370\247"
+	.ascii	"\377\033\221ez\266\351\314h\t\211\307\022\030\336\220u\007\177"
+	.ascii	"\0250$\026\t\033zH\351=\311\315L\357\354\250@\001\345\367\373"
+	.ascii	"\020\277\333\217\255j\033jG\241A\322\2217\036/\360\362>*J\363"
+	.ascii	"\360\332`\360\307SR\266\206\357Jb\357\206\305\301\321\343Z\202"
+	.ascii	"\235N\351QY\035V\005\236\243\246\364\032\262\301\016,\225\265"
+	.ascii	"\371!\304\032\261E\354\020\273\202\rb\211\360\313R\331\234g;"
+	.ascii	"K\363,,\2255\001\004EPG\327\212\224-\375>\f\2466\036\252\374"
+	.ascii	"\330\024,\020~Y\025\317\362\366\316\252`wX\024x\216\372\366\237"
+	.ascii	"\222\261@)9\0134\230\004\336\375\030\"\242`\177\304\336\246 "
+	.ascii	"y\263>\324\025o$px\360\313\366\b\201\332aD\305\206\277\212\224"
+	.ascii	"\177\005!\234=\301}\\\213\344\376\370W\330\343_\341\216\177\205"
+	.ascii	"\036\374+\254\361\257p\306\377\331\032v\252\345&(\307N\263]\\"
+	.ascii	"\316\224\214\347\fX\205\270\215\354#\333P\312\214)\214\213\377"
+	.ascii	".\034\341E\217\260\2747~5\342.\362\233\360m\206U\347\212\377"
+	.ascii	"&\262\007\1778}]E\361\337C\302\016\005\203\362\336Bx\211\n06"
+	.ascii	"0\026\221\035m!\377\373\232\211l\301\022\234\340\360\b\221\274"
+	.ascii	"w\340\016\362[p\003n\301\005T{\227nA\224\302\336\245(\030g\200"
+	.ascii	"q\006[*i\006\030q\177\005&n\202U\210\370G\207\337\177%r<\256"
+	.ascii	"Vy\177\205\236\274\274\315'\001\032U\326N\205\312\300\205\356"
+	.ascii	"\006\373\366~\363\275_\221\004\323k\224\367\326\313(f\264(\273"
+	.ascii	"\346\275\201d\024Nq\177Gy\357\037\272\255\306n\253\255\355\004"
+	.ascii	"-\016)\312\320\207\217\215\306Yh\f\031\321\241\303\007\233\235"
+	.string	"\335\336\362`\201\306\215\007\266\216\002\261\346\3466\035\327\214\302+1lJ*\310\013\371M\207\343J\200\370@Q1\301\301m\2712=\223\035\276\267\271\270\337rE\251\244\035A\024Tl7\034g\234\276\275\034<\005\022jj\233\r\377\345\034\021A\225\240=\261\341\255\375f+\203\252Z\313{\363\320u`bGZ\204;vl\264\261\276\0233\233\271\242}\366\033\215i\210f*E\257\253k\227\361\275\030GD\203\304\250\242\033\023d\277\313^D\345\334\310{\217a\260\"\021\245\036bY\247dK\211\314F\336;,[\241\270\320\223\262\311{\203}\337\256Q\242\361\226\367\376\302x(SFg^\031\r\0331\303\273)\323\\.|T\275ee\355-\0170\214\2102\246d=Z\277\267H\264\356d\320`YY\355+\017{8GD\203E\266\034*\247\367\367\325\321_\r\262\253\024&\216\337M\245\3652T\373\317\001h"
+	.ascii	"R9(\032\r\365\001\345\310\261up\027.\2125\302d\330I\375\326\021"
+	.ascii	"\326\206F\266\243\366\376V\334EA\335\365(\232\342-\236x\202\362"
+	.ascii	"\376\024i\215\032\373FW\236\221\253\023\022\327\334\323\357\033"
+	.ascii	"\031E\332\364\254.\357m\243/F\214m\305M~\314\255\255\251=\343"
+	.ascii	"\267U\327i\2718#myo\247}\244\225\307\305\226\367\226\201\323"
+	.ascii	"\356\362\246Z\270))\355\027\036\212yr$\f\031!c\372\375\302\005"
+	.ascii	"\357j\021\225\327\264[\020\357\\\354\320\023k\332K\373\310\306"
+	.ascii	"u\251,\307F\332H\273\232\247\303Z\364\303\304\203\264\2116\321"
+	.ascii	"\256\236\344\201\035\021\r\246\200\246Gl\027\375\256\356\243"
+	.ascii	"\302\263\336\225\3676\232s\003B\n|-\360r\363\311:\3071:.\224"
+	.ascii	"\233M\335\324-D\242\363\204\216\210\240H^<\021\246\005\375\026"
+	.ascii	"\222\300S\r\216\214bn\310\020\257?\237\367\331@\025\254\3050"
+	.ascii	"\022\206W\343\214 \2055?\277\201\266\n\034XE\330c\253\330)\264"
+	.ascii	"\202\f\277\206r\327\\P\320F\221S\030\305\310\214\244\312tt6\017"
+	.ascii	"^\342;V\341\340\226v~\363\250\321\371\370\2619\231\261O\274\373"
+	.ascii	"\304\3061N\343v\2166\023't\032\211\224\210\227\323\322\236\356"
+	.ascii	"\351\266\341E\022lD\031\264\325F\335\331\256\371m\263M\034\305"
+	.ascii	"\230\n\205\362\336%J\372`\354X\022\332$\204\310\361\024\022\346"
+	.ascii	"\375'%h\036\277\233\006\033\222\330\364\356C\200\254#T\016J\232"
+	.ascii	"z\0206\005\022\022\352C\017%Iz&Ej\256\264\214\274>4\264*\r\232"
+	.ascii	"\320\206\372\210\030\216\217\300\343\222a\333_!\316\273\240\317"
+	.ascii	"f\f\203Q A3\243\214?\216\302z\310\253\207\350A\224\254\034\""
+	.ascii	"\016\212E\202\232\250\232H\306@\016\214\242\267x\365g\226\026"
+	.ascii	"\365\367\177Z\220\367\336q\326!5\203\276\261D\265\006y-\250a"
+	.ascii	"\234\240\312\321\201$C={w\201\200\314/\315\245\273L\202\340\203"
+	.ascii	"\005e\262\375\320BC\210\266\356\b"
+	.string	"\013\314\200h\335%\024\004%\017\263\001"
+	.string	"#\222\314V\311\216p\2371\030\270\340a6<[\\$\206f\373\354\300\263\005\304\303l\310\240}\216"
+	.string	"\021\202\017Ge;\363\001\004"
+	.ascii	"<\314\0067\312\241U\3120[\232K\016\320\250\f\207\n\230L\231f"
+	.ascii	"\323\331,\272H\242\t\234\315\242K\262en\267\215\306\2641\304"
+	.ascii	"\021"
+	.string	"O'\b\310\207\331\360\362li\312\2244]2\033E\036]d\363\345\3116_\236\032\306}i\266Lb{\202etG\243-T\251L\026G<\235-\033\352>\265\262m\276,\231\311\242\262\215\312\3546Z|(\362\345\271\301d\217\200\272\321\345K\373\001\271\002\363\"\343\204\302\270\321h\362\245\271t\335eL\264\231\204\202\200\211.\233\313\020\234 \240\316\020\334e\322\004\006\210\212\260\302\\&E|\340\266\031\020\341\214Iq\2332N\020P\334eS\2046\352d\266\2404\333\247\363$jB\264u*Y.@Q.\231\311\017\250(\333\350\262B\213|i.\241I\230\022\332\3462\006\332\272\255\322\202\005w\246\035\201\305\202\021\026\030@\224\244E\032-\360\2249\301\351d\252\304\264ntD\t*\256\f\007\2402$(\233\313\0204\210\256\274,]\220\315\020>\274<+x:\233%\337\262\204\266\315\366\205\377\002\030\200"
+	.string	"\0068`\246\350\272\310(\007\334\350r\003*L\247\323\002H\326\265"
+	.ascii	"\332\306\310D\037f\303\f\224\303\313S%\212|&cZ\240,\264U.E8\241"
+	.ascii	"Oe;\003\235i\231O\231\013\2700\2230\306V\271\204B[\021Nds\211"
+	.ascii	"\301E\026_\222 \234K\344\213\f\363\311B\301m\243-T\331\\\206"
+	.ascii	"@\272\311(2F\006\352\236\320>\243\027\264\034[f\262\305\350B"
+	.ascii	"[\021\315e\013T\271\214a\233\313\030~BK\013\3232\223\214\341"
+	.ascii	"(Q\020\230I\021I\246\363\tm\335\246\b-\320\013\321\266\205\276"
+	.ascii	"\264\027h\231/\315\017b\222 \210x\272TP2\2350\321\026\n\003\242"
+	.ascii	"u[>\200.\223,\315eK\033\225A\316@K\230m\2639#\223D\316$cP\242"
+	.ascii	"P'\024\332\256\020\3356\352\342\342,\241`\201\213\213\323\225"
+	.ascii	"i\021@t9\223D\276\310\204h\225\256\314\263\271\274\320>G\270"
+	.ascii	"\310V\304\322M\212XB[%\006P\247\333\222tA:]\231$\362\245\271"
+	.ascii	"\204q\235\316\230(\262\005\312\242t.\241\355\023\351\362d\"\333"
+	.ascii	"\230$\324\005\331\002\215\"\227\321(\324\002\345\022\351.\233"
+	.ascii	"2&\0350g\240Q\0247\232tA\312\204\210\236@\233Q\344\f\024\331"
+	.ascii	"Fe\220.Qh\013\312\303D\241\255\210%T\211\301\007RZf\210$\b\021"
+	.ascii	"\304\026\331*\235\0340\266Jg\314n\221\0350\211>\235\305\326M"
+	.ascii	"~\340\355\t\226%p\227C\217\312d\353\201\271L\202\200\266..2\026"
+	.ascii	"\230q\217P\227\004\026#\324%\241\025\261l[\332\017\030\270\310"
+	.ascii	"\250\tm\314\322\345\315\344\263\204\031\350I\322M^`\006z\002"
+	.ascii	"uI\020\341\204\226d\b&3\tB\313T.\217\337\022uK(A\331\\\272\\"
+	.ascii	"\340F\223L\0227\212l_\222Q\023(\270Q\344\321\330\"C\260\300]"
+	.ascii	"h\353\266$\241I\230\026\244\353t\206h\241)'\356\303\\x\347\263"
+	.ascii	"\205rp\235N(\207\222\021P\267\215i\231\255{!\212\254\340\";P"
+	.ascii	"\300\t\321$\007\232\316\245\333\322\224q9.\215\317h\f\205\350"
+	.ascii	"\363\205\202\213t@q\246U6EP\312$C g\234!NhI2CT\020}Y\2724\235"
+	.ascii	" \270P\347\263\304E2\240\203\333\\\312\360\023\300@\221\255\233"
+	.ascii	"T>e\220+-\022\332.]\226n\263U\212\340B\235$T\360\035:\200\200"
+	.ascii	"\301\204\0212\300[60\223Kh\033\345\340\\rh.\2231\034Z\240Q\016"
+	.ascii	"\033*\020L\023b\224\203)\b\013\327\001\236U'"
+	.string	"\220\315H=\342\024\007\250y\234\f\272\371\270\271n4\343\222\037\234\365\217\r\343E\324R\024\361+3y\r\243\366\372\266\220\326ab\210!\037\273u\022w\303\205t\357\n%\006W\336\227\036;e\354\321W\347\005D\217\204z\025\264\372\001\264\377\270\310\244\362\266U)h\310^\3369\311\310\346D\244\313G50H\212\355\016\316\304\n\210\305\216\335\306\321r{<\254\352\364 \221\037\252\252L\3674gu\350bN\013\322\025\266\250\313[N.\350\252\303\342Jh\316\315\215\205[\"\272\352!<O+\330\267g\341p\\\2126,\246\0255\036<X\266\004\340n\202kK\350J\214K\272\t[{\226\r\343\035\227\354b$e\355\330\301\246\225\320\203\230Am\"t4\314\320\236M\3631Xx\2237{\226Q\300H[a#\307\330\030[\206\273\260\364\006O\200\370\311\t\261d\317\226\031\365H|y\345\235\270]\371\254"
+	.string	"uu\261aj=A\314J~\220m\265"
+	.string	"{6\314\f\350\005\331\327K\323\375\276X/\222@\276\275\232\223\351\220\265\211\260\252\212\335*\366\325\300\013D\311\031\262c\310j=\273\365v\227\325\2237\233\365j\233Pl\n)o\026\213\275b_\326\212\f\307?\016v\ncu\036\013Q?vP\203\275S3\220$\025]\241\261:\236\r\205s\2503\343\343\201l\262t\3100gh\204$I\222\016C\025@PPL(\031,\303d\017\023@ShS\232\032(\021cJFD\222$\251\354\261\031\240\n\200\205\005A\344\272\002C\346"
+	.string	"\0313\003H\361tP\222\003{\342c\031\375\024:\272\306\201\212\315Z\2420\236\fM\356Jd\037\034\261$\306\027\007\230"
+	.string	"\275\232\372\332\033\341\003\021F\366\200\234\227\304\356\317\020\n\357\216\227\262\246\377y\024[\236\245\357>v\346\203k\352\273bN\271x\261\354}\260lox\312\023\203\302\235\022\205b\005O\006k\234\203\255\265\327\f3\333|b\211\244end\013\3704\356\332\\\254\367\376tU\316\360\004\306)\274\013a5\323\367\343wrn\251\242\306\035\350\362\256fN\344\306|\340\016\267\t\257\030c\337I\237\276FC\226\251X\260\t\310\r\354a\255\243\306\240M\204*\331d\255\351\351>\tu \ru\222\021\300QQ\264\206\277\210Q\007A;+:D7\265"
+	.string	"o.3A\321Zp\246\353\221;\256\034\230\256\206\007\323\315\002z\222\360\313q\233w-\332\377\236-\331[\2508[\024E\247\217\205q w\272\307\354\265\234\325\030(\337\260;2\013\332\344\030\317\363\225\375[R\257\t\233\033z[g\235o\302\341\033iXj\006\202a\373|\033\234\030\030\214k\031[\216\037H\2167\033j\223\232M6\021LL\267\237\315\361\257+5\322A\302?\365\240\"\352\371\274r\234\375\\\326\213-\301\200\362\323\213W\344G{\b\303[IfvoR}\346\225U\253\203\352\345\315\351\253\3226\302#5VG9\003O@\033,R\220@\317\243Sp\252\375\313!OX\212\362\031&%\027\005\030\361\374\344\222\317\225\222b\263\216\363\027`\351Z\233p\357jn{\214\242\240_\257\270R\240\212\356\336\313\204\016W\013:\264\201_\316Z\267t\013\262H~e\nX\337\237\372\f\256\332"
+	.string	"\255\273.\021\365\245'\024p7"
+	.ascii	"?\277\324\322@\230\372\264h#\226\353\007\361\206\211\255\035"
+	.ascii	"Z\246\373p\207\356$l2\274\214\tL\035^h9\016\355\273\201\027z"
+	.ascii	"\026\317<\336\271\212\\8B\266\334[\316c\372a\034=\226l\204Fl"
+	.ascii	"(\374\207\316\\\322"
+	.ascii	"8\346\274^\367\324II\204\275\360r\365^\372\r%\233\312\211a\257"
+	.ascii	"/\200)\321\333\224\223n\356\002\323\023"
+	.string	"S\376\304\373\321\302\254\177cX\277\205\336K'\214\364\"\203H\324\314\365\n\024Ry\201f\032\223& \0213H\275J\311\016T\210\376\330\240z^\266\251\355#\361\016\343\370\361jpOv\253\335*!\347\263\212\272U\222puY\336\025\033\322\345\2132\302\337;t\2211fo\333J\357SB\202v\001o\030QW\016\t\365\3463\355\224a\270\376\262\306a\262:\272\312\256\023\266$\b\273\021U\305\245\272H\244\316\354\3708\265J\313\257d\231:\001\323\257\212\f:\372\301X\022\302\350\373\177\230\362\327\301|Y\201a\343\202S\217\246B=\320\275\370\271\203\306\272b\013\005\215\250\223/zb\205\345\264\211$\336\302\241a\324n\365\370r\210\225qFw\261\261\272V%0\340K\363\022y\372w\337$\253\376\355\263eJ,LD\033a\345c\373\251\213W\342\365N\275\246\252\r`A\302\205f\251\223\242\244\001\032\t"
+	.ascii	"\310\026L\203\346R\213\252\207\330O\302[&\307\f\302[\210\233"
+	.ascii	"\320\220>n\f\031\006Oz\322e\001\304\361\277\003& ?Q\234ED\360"
+	.ascii	"4\312\223a5x\357\334\342\313~5\310,\321\2458\360x\324\375[\251"
+	.ascii	"\225\221\201k\367\333\366"
+	.string	"\005y\374\235\341\344\240mg%\227\231\343\370\333\253\033.\227[\n\361\230?\254\343\0168\274\345X\006\253\3420\354Hz\211\371\235h\304\220fHy 6cp\204\246y\233}\t\263\216\004\270\234\003\361S,pp\343G\024\336v\210b^0\362\201;\313xA\2632K\240X\332u\345\005\310\227\275\304\227\223G#\376\301\213h@\b\264~\375,~\336d\t\021\031\t\252\fee\207\316\306MB\2149\2109<\312\337\305\205Bc1@&\007\344\226\202\273@\224\261:5\252\230Q&($\247=\315\206\342\362\\\001\322\226<Q\346\336\021*\342\021 nC\305\204LQ\370\004\341sDHd\202\230\037\233\371V\030\305I\200\203\310jss\340\013\226\353\333 \371\373\205\3416\201l\020Ygb\372\332\310\351 l%\353\354\365\031\343\232\343\224R\370\023\303`\035x\276\207\317\f+\2540\337\250\n\002\340\303\005"
+	.string	"=q8y#\030\f&7=\207\322\215\231\2729\303\027\250\252\211\334a\245\232\245H7\034\351\276\352"
+	.ascii	"U\244RA\2362Y\347\264\t\244C5Ao_\257\026\n\fW\371\235\017\034"
+	.ascii	"\243@\335\b\233\232#\341\206\336\337\227L7}'g\271\027\362\316"
+	.ascii	"\3713\201\274\001\226\301uQ\354a\216\rs\316=\335\316*@\371\022"
+	.ascii	"qI]\306IL\2248Z\032\263\270`\225?\2128L\343\314\001\223\211\302"
+	.ascii	"\357G\251Ov\bQ\006\231Q\300\342MDB\266\006\3017\204\232T\177"
+	.ascii	"\336v\020~{\356\031\350\270\316XV\017C\035\377\320\362\250\243"
+	.ascii	"\270S\177(:\f\346\374TQv\332|k!n:\216\020\025\227x\375\252\300"
+	.ascii	")\232\222\3518\\\254\200\310\355\013\235vo;P\234,T\313\334\333"
+	.ascii	"\2350\234Op\002e!\340\030\314u\367\373\217\020\253\256jHy\256"
+	.ascii	"\202\277\026\212d=\016H\206\363\001\361\212\225\271\032\006m"
+	.ascii	"\021~\225\262\215\236\310\017\377\341\221l\343\302\020\333#\315"
+	.ascii	"j\3270\020\366\234\227\021\332b\250~\3226\305\254\236\216\275"
+	.ascii	"\220\032\331\327\245c\336o3\375)t\034\222\032\246c\360\233\020"
+	.string	"m\312\001gGLp\204\006\3141\227\207\302\237p\t\210<<x^@\356~\212We69\355\304R\243\366~\220\342\265\037\227\345(\361\315|\345_\217\002Z+\271\312\244\206\346\312\257V\307(\n\tg\b\370\347gz\262\021\210\372\267\201%?tt B\314?\214\332\fF\"Yi\220\231\202\315\245\314J\352\262^07\267T\312\375\225\341\375\2725\335\333'\325\216\340\322\232\253p\333\354a'_\347\251+A\230\377\335\274\300Ps+\315sV\2032qJ\266D\356\334:\347*\302\334\225h\244\f\255\331j\020\214#\300T\234\036\216\027\272\210\t&\270k\343F>X\352\355\314\261\362\244\270*M\273%+\370\234t\357\036f\257?\324\374\005\271\006E\200\370B\016G\020S\366\003(H\271_\tq#\266\314\234\362p\344\231>\005\255\300\343\006\363\210I\246\b\f%[\n\3646\354\256-\360\207\347X\035\361"
+	.string	"2\277\320\262\313\304\311\377\007}}\234\034b\206\346g\245\240\nC\303\031\032\221zK\333\327\332WA\216\003\034\365\rq\177\317\307\274!8\221~\233\004-g<\002U\025?\211\266\314\370EG`V\377\215\222\201\307\007\221|\370>\b\376\003_}8\262\301?RF6\364\303t\200\206@\004\326\216\272\222\003K\345V5\203Q\336\372\327\350\031\312\321\210\217\335\330\313\017D9\005\315\211P\016\235\001|\b\3176dy7\360\345\031\\BP\330\213\335\321@\004\373\256\210\001\200\262\214_\021<i\0071_>\221\362\313G\251x\263\203\263b\326\270\034\227\260\205\2554'm\007\346\325@\203\374\274@V\032\223\314\004\026\311\300\n\375\306\331/\244U@\204\r\374\3018{\355\020"
+	.string	"P\225QA\b\330\270\320I\371Xlh\340g\312\265+8\314jM\275\206&eV\224$f^\261\345;T\377\223\374D;\324\251\224e\226\325]\334\364\254<J\321|-`/HF\024)u\013\222#+\243P}\376=\034\177\177\346\217\013'\252Ib&\017\rfv\365\023\254N^\t\245\351\266$G\3458\335\016SG\356\0138\326^\316\030c\352\323\202\205\304<\201"
+	.string	"\355!\304\254ml;\277\b4T7\274G\020\270\366\357\257\016\013`(\375WP\227\005'\307j\013\032\243\362\347\nm'w\257\275\243@\033Fy\220\3716\016@\310\343\230.\317\302p\311N"
+	.ascii	"\023\351\033\371r9_\0352\020\277\221\207e\037\255[\300\320?r"
+	.ascii	"\370\273S\332\035\255\247\005\003\315\036\201s\030\030\276\177"
+	.ascii	"MvD\364A\013>F\274y\213\232s\252\322\352#b\340\207\276\355{<"
+	.ascii	"\350\220\213xD\234\315\250\"\316U\230\213\201\377\003\360\361"
+	.ascii	"jr\020\0240\332\267B\020\377)CT\221\007\222j\363\340\216\235"
+	.ascii	"Vl\221\301\326\002n\244\263Z\314%L2\362\227\245=\333\221\234"
+	.ascii	";\342\034\305#\0161=\266!\374Zu\352F\330\316\355\311\032\343"
+	.ascii	"\352\017\332\276\020\264gX\3029XmG\365'\212\343\330\357\345$"
+	.ascii	"\351u\200\026X\277X\304\247@\2739o\035\322\026\340\262\353?\362"
+	.ascii	"7\033\204\267\217\376l\"\237r\203-\242#\370\347\317\017vh\375"
+	.ascii	"\021\300\345\327\342\263\361\215\177\027{\240\323\223\300g<\031"
+	.ascii	"\330Ha/\371\235p\320\353\026\263\313c\231\227\355\312\354T\377"
+	.ascii	"G\344\317\001x\030\226n\270n\024\254\205\341R\346\377\340b\037"
+	.ascii	"vK|\001n\352\351\2543\\\004\334S\232\202\374\264\256\320\261"
+	.ascii	"\032u\343\266\315\347\277Y\214\211\334\277v:\361\362\302j~/l"
+	.ascii	"Fh\237\336\257\0346l\370\253\266\263~\315^q\337\207\217\317\005"
+	.ascii	"\267\217\003\227\231\371g\354\213\343\316\213\211\274\3100\244"
+	.ascii	"\364\330\220\315\020\264W\202\223\315\375\377a\300\346\302H\370"
+	.ascii	"Fr\037\376lW\373439\373\244\347\235\257r\2178>\237h\254\377R"
+	.ascii	"o30\3138w\334\257f/\312}\034\242\372\2578\016\277w\bw\020\235"
+	.ascii	"\2351\305\360\231\320\016"
+	.ascii	"\311\246\374:\021_\340\327\216?\b\320\275\320\237y\275\217j\227"
+	.ascii	"\301\205\330+\331c:\302\357\304\353\t\305\242\350\025\367[\376"
+	.ascii	"\034fS\312\243<\333f\361i\331\230\327_\320\035\317\215\354W\306"
+	.ascii	"\033H\033\020\022\2339\365o\036\276\247\236\373\023\300Ww\367"
+	.ascii	"\220\276\265\355i\372\264m\257\331f#\037a>|\001\374n+\326\034"
+	.ascii	"\260\203\256?xX\360\267z\342r\223\304/H\346\017\241\206\222\326"
+	.ascii	"\345f\212\260\275\325mw*\254\033"
+	.text
+	.section	.gnu.lto_.symtab.6fca6f322b6f3fc6,"e",@progbits
+	.string	"pgResetFn_serialConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\001"
+	.string	""
+	.string	"serialPortIdentifiers"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\001"
+	.string	""
+	.string	"serialFindPortConfigurationMutable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\001"
+	.string	""
+	.string	"serialConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\002"
+	.string	""
+	.string	"lookupBaudRateIndex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\002"
+	.string	""
+	.string	"baudRates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\002"
+	.string	""
+	.string	"findSerialPortIndexByIdentifier"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\002"
+	.string	""
+	.string	"findSerialPortUsageByIdentifier"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\002"
+	.string	""
+	.string	"findSerialPortUsageByPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\002"
+	.string	""
+	.string	"findNextSerialPortConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \002"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\002"
+	.string	""
+	.string	"determinePortSharing"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\002"
+	.string	""
+	.string	"isSerialPortShared"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\002"
+	.string	""
+	.string	"findSharedSerialPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\002"
+	.string	""
+	.string	"isSerialConfigValid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\002"
+	.string	""
+	.string	"serialFindPortConfiguration"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\002"
+	.string	""
+	.string	"doesConfigurationUsePort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\002"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\002"
+	.string	""
+	.string	"closeSerialPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\002"
+	.string	""
+	.string	"serialInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\002"
+	.string	""
+	.string	"serialRemovePort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\002"
+	.string	""
+	.string	"serialGetAvailablePortCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\002"
+	.string	""
+	.string	"serialIsPortAvailable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\002"
+	.string	""
+	.string	"waitForSerialPortToFinishTransmitting"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\002"
+	.string	""
+	.string	"serialPassthrough"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\002"
+	.string	""
+	.string	"serialConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\002"
+	.string	""
+	.string	"serialConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\002"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\002"
+	.string	""
+	.string	"telemetryCheckRxPortShared"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\002"
+	.string	""
+	.string	"serTcpOpen"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\002"
+	.string	""
+	.string	"isSerialTransmitBufferEmpty"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\002"
+	.string	""
+	.string	"delay"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\002"
+	.string	""
+	.string	"serialWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\002"
+	.string	""
+	.string	"serialTxBytesFree"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\002"
+	.string	""
+	.string	"serialRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\002"
+	.string	""
+	.string	"serialRxBytesWaiting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.6fca6f322b6f3fc6,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
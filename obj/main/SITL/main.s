@@ -0,0 +1,264 @@
+	.file	"main.c"
+	.section	.gnu.lto_.profile.8efc2e3e1141bee9,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.8efc2e3e1141bee9,"e",@progbits
+	.string	"(\265/\375 \034\305"
+	.string	""
+	.string	"\220\020"
+	.string	"\002"
+	.string	"\231\317\260\204\001"
+	.string	"\001\314\337\304\332\f"
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.8efc2e3e1141bee9,"e",@progbits
+	.string	"(\265/\375 \036\265"
+	.string	""
+	.string	"p\022"
+	.string	"\002"
+	.string	""
+	.string	"\001\001"
+	.string	"\003"
+	.string	"\001"
+	.string	"\001"
+	.string	"\002"
+	.ascii	"\271A6\200\005"
+	.text
+	.section	.gnu.lto_.inline.8efc2e3e1141bee9,"e",@progbits
+	.string	"(\265/\375 v\r\002"
+	.string	"\264\002j"
+	.string	"\002"
+	.string	""
+	.string	"\006\301\377\257\207\003n\001\201\200\200\200~"
+	.string	""
+	.string	"\004\002"
+	.string	""
+	.string	"\002\013\001"
+	.string	""
+	.string	"\n\001"
+	.string	""
+	.string	"\004\200\200\200\300\002g\001\n"
+	.string	"\b"
+	.ascii	")\033\336*\360\024\035:3\233\366\262\f\207y\375\006\260"
+	.text
+	.section	.gnu.lto_.jmpfuncs.8efc2e3e1141bee9,"e",@progbits
+	.string	"(\265/\375 )-\001"
+	.string	"\370\035"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	"\002\002\006\177\0012"
+	.string	"\001\300\004\0012\300\004\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.8efc2e3e1141bee9,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\264\004\001\224\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.8efc2e3e1141bee9,"e",@progbits
+	.string	"(\265/\375 \"\205"
+	.string	""
+	.string	"8\026"
+	.string	"\002"
+	.string	"\002\001"
+	.string	"\003\020"
+	.ascii	"e\020\274a\001"
+	.text
+	.section	.gnu.lto_.lto.8efc2e3e1141bee9,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_main.14.8efc2e3e1141bee9,"e",@progbits
+	.string	"(\265/\375 \317\275\005"
+	.string	"\222\312'1PM\223\016$\351\252\301YF\313p0,LJ:5\255\204\270[`i)T\225\037{\271\321Xs\026\311d\3206u\007:\n0\320\266\021Bd\nKP5E\024\254\246\210\202\322\305"
+	.string	"!\201\255\005\205\0136X\326\005\235\353\320>,\024\256\375\003DkvE\232\220q\211p\330\217`\315m|_f\346N\343\037"
+	.string	"\nAI\246\305\212J^\030\023\217?~\300\005iH\374\023\004\211\327A2aI\311L\370\264\240)\363:\320\224q\034\215m\361\336\234\203\314\274e\027\030\335\3657\370\237\277\"\b"
+	.string	"h\310\f!"
+	.ascii	"\334\255\331\344\315\325\344\302\227\004#\243\005f"
+	.text
+	.section	.gnu.lto_run.15.8efc2e3e1141bee9,"e",@progbits
+	.string	"(\265/\375`\023"
+	.string	"\325\006"
+	.string	"b\314-5@\215\222\016<\314\266.8\351):O\341E\016\313\315\245\357?\312\320\231<\177\375\356\032\350X\035\221\212\355\030\006\004CT0}B\350\347\025\364\b5\262\211L\001s2\237\316\306\363>\235\215\347q,\320\313\004\\%\034Xo\241\252\254\207\251\\\304\256C\354\2674\203*P\036\304p\312\"\0324\306\366\016\017\255\243\273Q\213HF\006\201\241\316\021\252\313\314D\274\270\r\261/5A\3221bOA\020}\b\200dR\234\230dF\2350\376b\276~d@\002 D\344Q\222\231\017Mc\273\352\260]\267\240TgQ\274\220Jm\025Mf\336F\244\212N\365\327\374\004\277)\r"
+	.ascii	"\024\013F\023f\201; \037\315a\304\031d-\227\274\f\001\344\200"
+	.ascii	"\333i\263e\340\306\025\212\023"
+	.text
+	.section	.gnu.lto_.symbol_nodes.8efc2e3e1141bee9,"e",@progbits
+	.string	"(\265/\375 \323U\003"
+	.string	"\362\004\022\035\2605\215\001\3144\212\245\022\030\272\n!\031\306\327@\273<)\240\210\210\016D\344\226R\246'\033\2524\\nTpTi\f\224H-\222\032\267k\037\t\240\036\366g\332\335=\025\214Y\316\353C\313\262\001<\246\303\375G\001\r"
+	.ascii	"`\0200\b\030\2445\210\301\f\003\324\003\200\003\300\360\271\352"
+	.ascii	"\247\270\270|v\032O\2039\006"
+	.text
+	.section	.gnu.lto_.refs.8efc2e3e1141bee9,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.8efc2e3e1141bee9,"e",@progbits
+	.string	"(\265/\375`\327\003\305\033"
+	.string	"\0263\266K\260\226Q:\366\363\216\036\222\306\b\021F1\\\276\360\332\217\332\t@\031\005Ha\214\320*\236\321\004\221\214\024A\323,Yg#\263\315\333\3452Tjt^\370\344K\267\r\374\277\340\331e\346f'P\220\341\032pQ\"\022%\215\310\024\222"
+	.string	"\230"
+	.string	"\250"
+	.string	"\215S=\f\251\374\004h\3273\235;u\270\"U\346\007\247\002\365\021\021\247\350Z\244\346"
+	.ascii	"{\253Q\343\256eT\247\266Q\007y;r\265\267}\335\315Yf\326\032C"
+	.ascii	"\272P\344\036\234\304>\\\374\343|\031\310Y\271\333k\367\245a"
+	.ascii	"E\311\362\302\027\2127l3\212,`<\002\362\254\364\230\263!<$\317"
+	.ascii	"\256\221\206]\343\377!Q@\326\317ALG`~V\361\037\352?\360\377\323"
+	.ascii	"\177\247\377\277\377\275\377@\376\003\370\237\344\377\252\252"
+	.ascii	"\252\252\352\177\355\277\225\177%\"HZH\035O\247\213P\374\177"
+	.ascii	"\323\256n\273CW\236m\241\353\331(\223T\332Bo\023\021\350UF\243"
+	.ascii	"W\265\242j\273\333\206};\307K;\247\332\032z{\327W\2655\235Kk"
+	.ascii	"\320{Zt\345\245\214\256j\332\352\\\333\316\235DdNMQ%jZ\203\256"
+	.ascii	"g\212\346x)_\265\231\t\324\345\331\237^\317\231\356\326]#+\323"
+	.ascii	"}\356\3326\t\203\232\207%\250a4K\361\2702\272@w[_\260He]\\K\241"
+	.ascii	"G*\317Ow\260\203\036X\266\267\273\201\032g\271\373\347\356:1"
+	.ascii	"P\254\254\304\b\332P\"\237\236\270\307K"
+	.string	"\t\232N\300@\242\261vgC\361\314\202ljb'^j!\376\t\001)\341\322=\344\022\243\212\320\210\342!g\247+N~D\t\206\342\247xi\\\"\364\305K(^\307\347\343_M\343\250\370\260 \240ZA\344gD\334AE\tG(\276\003y\016\302\353\231\311\0073q\217\274-d \207Ni\013\227\036Br\305P\331\200\2624u\356\375\r \374\212LwRw\037\200irtCH(^\002\031\376cw\n\230\333;\234\314\370\363\031\206\331\365\317\360\212\027\374\027\273\t\334>\0037\331L&\236\007G\201Y\366\370\354\224<1\033K6\223\275b lF\304`\037j4\332\005\233\255\214\321\314\032\315yp.l\260\240\341u+C\230\260\333M\017\2544ul;3Z\254\264\321\314\230\f\203\tXO\2713@|\200\323j\245\371\272\321h\346+f\346c\256\036\223\231\345\254\fA\376A\004\006\021&\224"
+	.string	"p\323i\340\3406\223\371\220\317\311\241p\303!C\0052\2063\223\301H\274b\246\355\205\323B\342\264V\351B\025\365\263\021>\302\275\025\252SoK\374\265\230Q\024\212\277l3\222,`\204\202\022rB\2741\345K\232\002\004r\257\200\272\222\022H\250q4D\224RD`\220\n&\220\240d6\311\003\200\002\031\262\235\003\020h7'i\335=\001\266m\314I\002\210\202\342\230\201\334^\005f\210\246"
+	.ascii	"\320\3259\301\251\007\211w.1\235\201 ^7\260D=\3542I\344\207D"
+	.ascii	"l\226I\0326^n\206\330\330,\305\321\333_Be\300h\027\257\301f "
+	.ascii	"\320\243!\366\211\264\"\244A\220&\273\203$\2045\305\353\310\377"
+	.ascii	"e\304'\r\201]9{\241\374\211r\242\004\367i\347I\235\265\346KD"
+	.ascii	"]\366e\017b8\266=a\007\316\035\327P\2776j"
+	.text
+	.section	.gnu.lto_.symtab.8efc2e3e1141bee9,"e",@progbits
+	.string	"run"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306"
+	.string	""
+	.string	""
+	.string	"main"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311"
+	.string	""
+	.string	""
+	.string	"delayMicroseconds_real"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315"
+	.string	""
+	.string	""
+	.string	"processLoopback"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317"
+	.string	""
+	.string	""
+	.string	"scheduler"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321"
+	.string	""
+	.string	""
+	.string	"init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.8efc2e3e1141bee9,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,5562 @@
+	.file	"msp.c"
+	.section	.gnu.lto_.profile.e437537c03190dc0,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.e437537c03190dc0,"e",@progbits
+	.string	"(\265/\375`\211\n\325\030"
+	.string	"\306\036jI\260\226Q\032\003\374\220\213\377\321\323\346\314f*\245x\317#\336\2356\215\361\274\013n!\346\034~\254?\314S\372S\372S\242[\331\237\305\327\031)\273w\361\302p\370|\310\365P\204Ib<\036.\020yB\232mm\"\223\334\001R"
+	.string	"K"
+	.string	"["
+	.ascii	"\017V\007\213\r~Yg\360|\301.\n\022\214`\326\007\\nyg\231\345"
+	.ascii	"\357\307\227\224\0032\243\305\300\253\013\254v\002\003\236\002"
+	.ascii	"^Y\003,\016j\370\016\352\253w\325\251\001<\277\367\327\345r\331"
+	.ascii	"\346l\264\b\262\f\217\344v<\225Zc\311\005O\262d\230\"\253:\255"
+	.ascii	"\020\3539+\210\365\303\216\263\302\364\233S7\303<l\007\3359\254"
+	.ascii	"\277\336\360k\265Y\303\232a>\337\025\307\240\273\276\260k\013"
+	.ascii	"\273\256\260k\n\267\236\327\2545\357\004\t\3534\323<\363L\204"
+	.ascii	"u\231eV\027\302z\3141\303\254\007\272\272J4$\264\252\0324BE\274"
+	.ascii	"\237\220T\257\t\024\024\220\004\231D=\351\370\031\037C\035\024"
+	.ascii	"\034N>\264\036\240\177\366\031\006\212D\234\222\304\230\311b"
+	.ascii	"\264\265\347\331\263W\026\311n\307\020\036\220\205\f&\335\316"
+	.ascii	"\263\347#j\205\216.{"
+	.string	"\217\035\273\265\316\263n\263\356\350\352\352\356\363\234\003R\316\235\212*<\214\006{K\212\344p2d\242\361D\3456>\"M\024#\2350\361\376RM\341\345P\252\035=K\214\2174=z\376\362Eq\362B\251\210H\374\233KM7z\f\031\301\2040\214\350\236\b\251\224HIj\n\302\215\373\366m\333\266o\263\266\315\"\241\327N]\033V\244bj\034\335\200\312\250\241\315\240\002\222\221\202\202$\3110\006\220\202C4\223\346\001\022\240#\025\315\203\310!\202 \221\200$2IRT\224\202fX\003\021\210\252\330\317}?:\037\336\366\233j\306Jud\366\205=9\234\275\032\212\222\177\215at^\240\253g\007\371\251\205\001\227\360\255\354\022\357\fOn\210\361B\bS6\232\\\020\273\370\312&\006\n\251\302\007B\210\305\345\331!\002\220\272\331\243\266\333\200\232\272B\b\220\202\323\221\b!\024\036\352(^H+\002\266^"
+	.string	"\270\346N\374V{{\232U`\003\216\277\f{f\022(\222\034*\"#@k\233\0362b\213\300\331O\344\353'f$$H\016\210\034\341F\311\nBh\242\334\017\"R\300\f\325\314\257"
+	.string	"CW\262Q\352\3435nt\004\271\252\301\200?\002k\002\222UI\316P\r\307An\241\342*k\354\377=\365&["
+	.string	"\2577\021\203)#p\204O\234\351\345\354\362\377>\203\232BW\030\363>W\231\025\360\376\210I\314\303\324]v\317}4\366\343ln\362\215\334"
+	.ascii	"\376??\326\354\205\360\203%b\375\330\212\305\007;\352`\2442@"
+	.ascii	"\030\344\214,\364\322\314\236\213\326\272C\021O\273\225\311a"
+	.ascii	"1\364\201,rCp\354\220\350\342\376\244\267\245\007\032\274{\241"
+	.ascii	"\033t\032B\037\265+<\371O\003)\302\006\272\240:\200\f"
+	.text
+	.section	.gnu.lto_.ipa_sra.e437537c03190dc0,"e",@progbits
+	.string	"(\265/\375`\360\034\r\030"
+	.string	"\202\216\"#\200)I\00730\00330\267D3$\211\361\304`d6^\206$h\035\224\320#\210\222\264f\311\336)\005\356B<\2302\324X\2544."
+	.string	"-\024\227:\034\212Q\224\312E\203~0>\264\nC\2710=\356T\n\377\356\373\377\276\376\356\253\277\3724M\\#&\225\240\227\021.u\240\006F\317_\250@\0023\275\242m\033mo\333[\375\350\275g\236\004j\265z\031\215\276\367\236\304T\210I\321\316;\226\210i\304\304\rp\240\"\201Q\250\021Z\232\2440\254\001\221\005F)\b\325\320:\022\200q8\004\222 \007\221\0241\204\020\204\2141\204\020\001!\004\231\231hLf\332\034D\b \3632B\340~:\213\240\256\026A\325\004\037\204\340\244:@\327\325\340\254\275\234\302\355J\020 \033\3409E\032\033V"
+	.string	"\356g\035FW\003H\202)\317c\377s\374z1A`\304\221\213\205t\017\236\357W&\203\206\t\3048\025bx\335a\355=\225\350\031\373\256\217\243ny\235\202\224\322\314\002\360~`_b4\241\335\340\352\373\215\344\314\237"
+	.string	"\351/\252\350\034\233\303\022\366\362nO\324\264\201 \033\342nM\330Z'\272\006\240\031z\330\334\243\357\307\214\260\004x \330\004\020\373!y\343\234q\022\231\336\001%\221\214\334\013\340\277\213`\343\361\307\346T\234Q\nq6n\326\016\227\215t83\375\351\256\0368\255\372\366\333\016\367\031\246\020\217Z\243l!\366\027\241\022\007\314_Q`\362\370\302wt\235\236"
+	.string	"\264\314\36324\304eU\243\240\3470\017\0044\271G\3314;v\3260\200E\212WL\353\001@\230\307\tVA\030\213\334-W\034\n-.\2465\026\bn\025@\241\371\246\033`\230\025VV\304\211\025Lj\220e\243\246\006/,\312\023E\362\201\204\367\b\275\250\344sq5d(B=+\203\262\232=\006B#\242k\n\216\323\236\3247@p\260\235\273\313\374u=8\212I\355\345"
+	.string	"\214\334\276\btN\352a\206\3436\333\367b\202\250Y*\0349\336K\036u\326\200\363w\345/~\354\322F\377s"
+	.ascii	"\314\266\344?\005\321\201B\275\027P\235\365\027\243\333S6\324"
+	.ascii	"\336\271ml\250\203/\2616Z\361\222\220\301\"\241\224\304pT\234"
+	.ascii	"\260\226\t\245\034a&\027\205\271\257\227\252(')\350\341\366\370"
+	.ascii	"U\026d\340\272\003\222\3702\022\360W,\351\001\364\274yC+iQS\t"
+	.ascii	"\215\315lQ\266:!i\251\007\026\365\312\215d\373\246\306\215\336"
+	.ascii	"\367\252\353?\205\343W\362\235L\f\211!\022\324\244FME)\214wP"
+	.ascii	"V\225J\262\357\346\344[\222M\310\356\252\315+\237\023\244\016"
+	.ascii	"\306\315\343\304\030\360&\342\222\211b\327n\007\364\022\006m"
+	.ascii	"\334\201\317\314`\302\227!\325c\"u^\261\345@v\374ch4\007\034"
+	.ascii	"l\275k\320\333A\353\005\236\002"
+	.text
+	.section	.gnu.lto_.inline.e437537c03190dc0,"e",@progbits
+	.string	"(\265/\375`S4\325W"
+	.string	"zP@\021CP\236J:s"
+	.string	"\223\331\376_c\324\240\326\210F\305\216r\343\017{\236\221\227\353{1{i\370\307("
+	.string	""
+	.string	"ho@\274\326Z\301\225`\346tC\n\034 b\"\316\300\003#\007W\310FXD\373\233H\231\002\366"
+	.string	"\375"
+	.string	"\026\001{\214\336\255\324seQ\027\245*\376L\215d\317H\226-,\372?8GN\034A8o\002\001\373\326\244\341{\335\351.w2ol&H\214\370\320aC\205\t\020\030"
+	.string	")\370\331\243\323\376\340\350\005\031\"(\300\026M\371\314*\253\352\371\365\027`\327\247\017\352\367E\331Z\213\204\305\251z\325\253\311n\3425\255\030\370\372u\251xV\266\327\031\035\266\243wR\337.\241G\357Q\343\327\373\365\"\033\257\211w\215\3470W^[E\357{\231\375W\270\346gt{/\362\fs\345u\323\247\367*\373\214\316\337\026\320\325{\257c\205\362LLLl;\376G6\367\001\213\202\342Kh\346w!\216\034\250?\366\354\2379\310Z\021\331N\037:\3638\367\240\001\344;\305\210\272\360\336;t\346\037\t\253\377\033\317\277\227}\357\275\305?\310\275\027\352\357\237\231N\254{\257\320?\340\036T\004\201.\216?\312f6\232l>\013\036\372\205\t\275E\333\267U:\001\307\336\354\361\321'\233\317L\232\246\325\321B\002\263p\031\370\371\377\242\271\203"
+	.string	"\026_\364S\367\231\251\365\3401\264zp\026C\212?\363\214b\025\305\246\2369\231\"\004\301U\\"
+	.ascii	"\026>j\025)\376M=GE\2068\302G_1#\f;\361\024\347s\222\254\370"
+	.ascii	"/\317\343\216\206\303k\346\035\217\202Q\276\375\317\277\352\203"
+	.ascii	"\232-\237\37733\363=\253\352y\275\314\314OSUUUU]\231/\333\333"
+	.ascii	"\344\231&W\206\n\350\350Qf\253u\211\361\025=}\212<\237\344i\303"
+	.ascii	"vt\316\321o\346\2318\245M\317\350v\331cq\252\370LP\225\214Z\254"
+	.ascii	"\034J\021%\331\253F\362\270\352\214\222\215\246FUX\342\314Q\306"
+	.ascii	"\034\351\003\362N:\017\337\276\334\342Q\364,\213\222\203\253"
+	.ascii	"pU-S\033\223\033\262\022\373J3\236\031\331PiM"
+	.string	"\002\350\312w\331\211zC\260\020$\317&^\363\f\321\262\335\306\300\222\0201;\205*VQM1\262\237\370\027!a\001\2003\217\376\322\342\363w\304\303\350\376\317\353\272\246i\2326\363\371\246\251\312_\017\302-\250\257!\256\303\032\377}\336\332\213\204\305\312\3162,\2732\"\233\357\t\233\263#\245~\003D{\003:';\314\237T\227\246w\016\304*2]EG\227-\205\006\305N\201R{%Y\323\203&O6\"H\264\200\226\276\030\303\334\230P\021uI\001\253s<:x\007\206\310\205\262\254/7\033\311\263\t\226+)\\Di\351\37433\274\203\360\276_P|\210\350Q\024\214\210Y\226\241\247\267\211G\266\204\001\235\235\255=\243:B*\\\370.\265\224\336\220:\003G\357\315\321x\315\274\250\366R\374w4\234<9gg\225\004?\227\271\233\223\213\203\033#\206\013o\371\363c\243\006\215\335\\\334\333N\224"
+	.string	"\341\201\203\005\n\021\0364\340?\210\025\374l:\231\300\245-1\276=\377\177 \266\267am\372\345\317;\345k\317\023\362\201\342\262\235~\236u\234j|\310\226\034_\343HX\366'\005`\205\326{\025\tf\257\026\321Q6+ad;\035>\365\337[\254\354'-V\366\217,V\266\217\377E\264\242\262\235n$\313#\265\006\303i\240hz\346\003\267\317\253\2134\001\326EZ\212(|~\355\343\017\237\337\326\336\244v\3436\250\307\267\351\275]:\371\220\265Q\261H\246\324\210\025-\345\261o\365\255\342h\273\303>;|5\275W\223\332\356\320o\254O:\256\2706\005\336\353{U\236\201c\\{\001vt\334\024]\225\007\246\016\3332\3677\201y\252QB\226\005\371E?\331\250>(\016\344:DC7\240s\217\336rw\326\307l2\314\370\007\240\004\372\216\204U\374y"
+	.string	"zf[\335\351\032\f\372y\234\202Sf\206\f\3257\232\233\316/m\022\303\316w\031Ef\263\305\b\203J\250\022\024\r\021\222\222\221$I\n\035R\n\020\022&aPJ\353\370\022`\242$F\2434\214)c\b!\204\004\"\"\"\201\210\210\004\"\"\222D\351\036\365&\240@dS\305)\344\311>\312vgP\251ex\342f\312\035;\035n\031\025\023\315\357D\254}\263\234b\225\223\246\351\332\240\257D\372He\212Q\267r\001\002"
+	.string	"\214\214\035\n\263au\326\244]i\341.\f\274\252IY+I\221\255~\325j\006\343\223\306\301\365|\013\325h\377\245\224h\231\205\324\275\343}\035\333\247\226\307\370;a\0051\023|\027\323\332\230\234x{\033{\304\204\361\243\233\013\260eA\fz\0265GPC\024%\261\031S\276\r2\272\346l\013H\350&\b\327\210\223\250P\300]\250\232i|m\372\234\312\246\nR\037&\212\016\274T1\025\337\fp\324c\214\034\322\340\222\315(\277\274\t\353=\006+%\036!\260\324\005'\315u\246\271Q\241 \304\257u\236\342\337x\253\364\372YF\307[E^\241\b\325\037\230\032\003J\020\325\027T\307\360i1X\354\242\005\034f\032\230\0234\371\021S\336\251;\335"
+	.string	"\257q;\340W@\3132*\232\313\230~\366/\312\270\264G\375\247)\263\230\246\027a\364\036\276zx=\233\270bx?R\373\365\317\371\323\022\212D\220O\235{c:qI\354H\rW\200ZU\255\252''\205[]\n\275\345!0\036J+\341l\351\005f\204\021\025\037\367\361\255?\371i\204"
+	.string	"p\305@rf\343\361\013[\2625\332^t\356\036,\271\215RU\330\3172z^\277I@S\264\252J\311LH\253\355b`4.T\374\254\200N8\353\351\263m5\221x\305\336\235k\246\330\307\254\310+\367\201t\017\352-%\276\360\263O+\324\236\375Is/\306\250\272\2111\017\347k\315\320\302\347\260\276\36008qxP\327\377\204\203"
+	.string	"\225\357\257.\225/\262vs\235fu\254r\217<\257\t>\206\317\030\231c\177x\2051\275G_\025.y\031\226\244\366<\334\202t\254%\f\227\245U4\240\275\351\274h\317\271>\227\270S\221\343\021[\004\251\377.\340>7z\204G\033\276=\310_\252\340\373\317}\007Qm\342\234\031\257\2767wt\317{_\274pE\351p\034'\177\334\016\302\301\215\332>\344\310\305\375w\267\025T\262L\2242\025\220\027$\017|='\003\333\026\0337_\273\376\003\355\222\026!]z\276\204C\345\264\334\271bK\316\314\235\335\254\204\374\266\275\020\270cH\316\204\356\330f\352{\243"
+	.string	"Klv\035\272\205\313\241D\264\347L\250\335\207\361r\363\212/\301\327@D\207\351\016~(ej\334\tV\033\201\370\242C\f&\373K2F(\367\334\212\"?\351\003l\325\311\212\371\376\205E\277\267\355\206#\3115\262\302\270B*\031\251\211\257\376I\211 j\307\305E6:\b\2619|+\007\346phFy\317J"
+	.string	"\322LUr"
+	.string	"\344\b\024\265\222\002\305jO *\257C\2259\b^\017\325\2529\031\243\313\312\335-J'\233qx\232\021}L\246\346A\306"
+	.ascii	"$\351Yc\n\351ML\004\366\207T(\232\340\203M\360\\IW\035\340A\023"
+	.ascii	">j\371\202\221\311\216Z\022\373\001\262\256\325\360S\230"
+	.string	"\277\320\\\213\024\236v\234\250\025\263\372\327Y\257\371\226\304V]\327\020t\317\275\003\235\036\365\260\233j\307\261&\007\302\024<\034\3706\354h}B\275\3100}7\311\234P\002\361!1i@\231rc\346 \2618\n\371\321\202]\351\234\272\022\366u\221"
+	.string	"\224\206\321k\020dZ>61\262\272\241Y@\311\2124c\"\343\"\335\347\211O]\247<\353\361\r\024\214\0378\337\023\2502\023]\t\261\317\316\352\244\037\234\255[\224\373L\300\021r\236 s\356\r~t\215dR\263\"\273\344\016\263\305^\253zt\360[g\374\033P\004}\231\367\350\350\034\2418\200\264\225\232\031C\267ohB9E^I\247{\001[\305\314\224*[\335\305\315\267\304%\021\226\024\362\205\366$'E\304\242\366\b\203gG6\016\3709F\021\355r;\242\035 z\f"
+	.string	"\334\365\3450\253']Vf\251\033\333PQL\227\200qt!.>N\232#t\025\342\371\354>\030\206\335\216A}"
+	.string	"m\225\217\274iC7\351\037\021\\\357\3360\257\227CR\231<\031\243\215\314t;&O\265\003\236hx\216\360\275\365\374\026\257=\331)Z\353\331\220\222\312g\025\252\272"
+	.string	"\\\2250\357\236\276\200\021\255\3606\013\316\006\325]PK\321"
+	.string	"\213\357\204o\235\274i&\374B\006\266>\217F\355\201\333\260\376W\222\343\233\201\006\3160\336\246\022\236\0335\232\275Q\017\333=p\344\232\353x\336j\231\361\323\250\312\365\250Ceh\340u~\374\323\317\377x~\214PG\376\374z\212\370\301zPV>R\362N\364c\334vK\327\234\tGa\307\235\361\364\214k\021T\026\374\325`\376\301y\201+`\232\005V\245\324>\b\020\213\264\221\202+\266\037\b\274=\205\320b\314\242\251\266\257\276\361\264\341\206nv\255<\204\273\032HZ\270\tQ\310w\242K#\214\003\027GBPxCvz)\324\365\235\311pL\301\021\237\357\261\353\025X\r\247\216\205\371 I\240\254\0053D\210"
+	.string	"o\231^\245$"
+	.ascii	"c\304\f\2614\333v\207|\366\025Z\301\341&\231k\324c\236\316\251"
+	.ascii	"\032\320D\0356X\206t\374\375\217]C_k6\245\341xE\220]Z\271\341"
+	.ascii	"\024\336\222\031\265\234\242\021\303\234\215\325\316#]@\373\""
+	.ascii	"/L\321\r\210Pwn\205,\356\035\3674Q(\362\f\351\375]\342@Z)\313"
+	.ascii	"\371\2043:$\365\375C\222x\177\220\336B\273\301\201\327<\\K\207"
+	.ascii	"f\304\230J\266\340\3059dS\317Q\242\017w*\2666\330\277\200-yj"
+	.ascii	"?B\301\025\351\265\031[\035\213\346\323@p\0170\242;T8s\245E\323"
+	.ascii	"\231Y\"'r\t\323&M\221\210\235\260\344\202\206\3512\312\371?\224"
+	.ascii	"\022\003\002\340\317\203\231a\3356\345@\271\250\277&T\272]\203"
+	.ascii	"yk\230ccPw\204\f/:G\222\005\231$O\006\222\256]\323=\315\242b"
+	.ascii	"Ox\273\360\214\021:\354\354\346\021B\001'+\273\240\337\300\347"
+	.ascii	"\242\223\262b:\206\254j\305\220\003\267I\034P/\320\333k(y9"
+	.text
+	.section	.gnu.lto_.jmpfuncs.e437537c03190dc0,"e",@progbits
+	.string	"(\265/\375`\337P\025@"
+	.string	"\006q\212@\320\332$\351\244r\221$\013\227\036.\003\244\262\002\257>\245c\f\004\003\220\202\001\f\316\260\024\b\217\341\n)\256\343\346\006\247\036`\262\300F%\207\027\326\001\372\217x\004\312\t\362o\263\273\021\262\223\fk"
+	.string	"z"
+	.string	"\200"
+	.string	"S\213\255sr\305\304\\U\031\n\335Sf\373\267\0369b\200\367\336\273\353M\344\207\214\267\t\371\237qw\003\312o@\211\327\303;'{N\342\263>E\025\361\201\21400\353\214\231\367\224+QrO\331\357z\357\356\030\333\301\226\260@=\350b\376\205\245\360\037\275\217\333o=\022[\207\354\247\263\237\333:\306J\310\360;\323l%"
+	.ascii	"\005\367\344\203+\333P\250\r\360\336\337\267M\356d\234\206\346"
+	.ascii	"\213\330\276\223'\020eQ\206\254\334\0045\301iQRY\026%N\252\216"
+	.ascii	"\374\244\305\220\321f\340%\334\035\357$\322\355\375m\362$\343"
+	.ascii	"\2577\276\300\001\217z\312V\243\032\261h\261&\037\244\214\335"
+	.ascii	"\223[2\223f\343F\313\021\272Xrj\345\3176\331m\022\357\217;\035"
+	.ascii	"v\20788\365I\221\210`$MG\307\321\266\243\361\300K\004\310\245"
+	.ascii	"\241H\016Rn\256\340M\036y\321a@\243cYB\244\321\203n\003\272\003"
+	.ascii	"\377\212\260el}PEV\031\320\255\207\320u\352J\270J\270\024\374"
+	.ascii	"\353\301\357\236r4\276\003\304N\201\321\327\026KX\301<2hW$b\006"
+	.ascii	"l\177\001\213D\354z-2cU\205\203##\203FF$-\312\255\214\223\250"
+	.ascii	",\312v\025\030\337{_\356)\235\311d2\355\262\246\246\300\243\361"
+	.ascii	"\345\250\264\026.\332\013\254\214L\215\320\200\302\002\252m1"
+	.ascii	"\\!\317\0057\203\2319\226T\265\203\254\204\254\204K\003\272\001"
+	.ascii	"?N\013(b\f\361\007w#\221\337Hd\007\\Y\0041\315M\227cl\266\322"
+	.ascii	"\007McVI\254^\256\204\256'\024\364?U\241\313U\267\n\235\223\207"
+	.ascii	"\006\320\035D\036t<\3506 \036D\241\235p{\326l\340\237I8\312'"
+	.ascii	"\241\004\334Sv\031\261\335D\242\311d2\335N$bG-\317\314\\(\031"
+	.ascii	"\202\242\250\242\364\212\315\210H\222\244\220\345\342\t\020\204"
+	.ascii	"\243\231\234g%;\017\022@\2600\206A1\220\303(\204\202 \bB\220"
+	.ascii	"!\206\030\203\020Cdfddh\264\315\001p!\026\267\303?\330\316\212"
+	.ascii	"<\360\246\002\360\257t\346\207\325\n!\r\220c\020\205\253OO\300"
+	.ascii	"e@\377\t*\306&\225\362\367\212\023NI\211\027\270\217\322l\342"
+	.ascii	"\032\241\351FY\020X\343\252p06\332\356B\260\212\3544\310\370"
+	.ascii	"Q\303\355Zi\336\027b\344\371dN\251\3029 \024\027\201\f\321O\251"
+	.ascii	"\334\005\204\340,"
+	.string	"\261\313F\305h\210\003\342B\220\372\316\215%Pd\r\352\246.$\211^g\313r7\2409}\350\272\201\224L`\343\212\236\224v\340L \217Rd\306\\*\335[\016JJ\245s\341\031i\345\243'S\342\211\3079\337f|\250\366Z\246\315\321V\330\306\030\313H\036\311\320\216\324\ng\006\317AK\"i\366\336+\240g;a\364\313>I\332\035\211{\230\025\365\271\254]\254\236&\205\253$\337\336\224\013\322f\2315\340a\t\212gI\346>^\037\347\274\367D\230K\314\215\227\335\022`\306Q\230;\321\225\264\222\206\364\350\372\375\355\306+\314:\215.\355f\353\356\371u\321$J`\276\320t\277\266\3169\t\300\241/\241\307d\2218\032\371\344D\301\373TL\247\334\353\206\270\036e4\257=&d\315\t\330\254Z\020\325\020Ke\244\202tm\342\362R\316\240\314H\035\342\007\322x\224\323j\211@\330m2,Q\223"
+	.ascii	"A\201\373\314\364B%\355\025\367\2717\236\377wJ\240\301\256WK"
+	.ascii	"j\231\020\362\016\274\232\371\344A\b\247\f(\035\226\233\013E"
+	.ascii	"p\2444\314b\025\237\212\267\b\023\227\037t\317\334\236K\226d"
+	.ascii	"\013qg\332\333\374;\325vpE\231\300\372L\242aH\262e\271\002!\313"
+	.ascii	"\017Z\322*\214\307\005\250\320{A\346:\306\003\207\256N\253H\035"
+	.ascii	"\026|\022(Y\253\200,\033G\016\255Gf\020\342\244\346\031\377\226"
+	.ascii	"\2478K|\243\247\333[\233\365\224\217\367\344C<\356\244g\022j"
+	.ascii	"\317\222\343C;t\230\031c\253{-\016\013&l\221\340\033\304JCN\262"
+	.ascii	"\204\341DAC\266\201\315\301\004\202[l\030\367\0272\372\b\306"
+	.ascii	"CP\203\f\236\215F\231&)\213\036I\n\317r\344\227\031\201X\031"
+	.ascii	"#\tv\022Q;\005\"\252V\320U\007\031\205\241\217/\276\272\271\360"
+	.ascii	"\367\r\330\207\272\277\251\376-'\303\3070\210\"\224\007\013\255"
+	.ascii	"+\342\215\252\335!\335\300\221~"
+	.string	"\2326\006\310a\371>\232\354B:] \030b\340%\266N\255\216H3\202G/\375*\247.\277#\336\220\0036\024\2350@\b\223\033ybgk\035\332\021\305@\351\207EI\274>\034\224\277?Q\023\003`=\314V\330\237\270\034?\347\t\216\216\223\276\253\267\3001\221/\247\"\326@ \027!\274\232R\364\251\003?\363\310\346\352\004\026\215\217\217\371Pc'\360d\345j\327\3455\346F\021X*\276\037\353\323X\205n\213b\377@@Htj\350-u\t\360g\b\025\205Et3\t\266\026YG,\304Kb\342\334uR\250 u\335\232\200P \260\323\nd\211:\260\3309L\375\022\247/\262f\313\312V9?q7\345\356\b\267\250\265P\310T\317\213s\f+h\026\224\257\357\335\376w\337\225\3016\030\027\274^\251\366\001\363\366\245twW\222pit\177\355\025\005<\360Iv=)\226Q2o\343\262&"
+	.string	"\240\353\314\322\327d\235\202\351\311\242\214\374M]xe\377\302\222\250\374\347\365"
+	.string	"\354\305;\t\314g\3231C\375\334\260\273\214\306\232f\315\212x\254H\210\n\374W\360\316\204J\307\336>\217"
+	.string	"\005\324\326Z\376Hv\243\220\270\355\274\250K=\020\007.i\310\020t\214\216\316&\177\336\r\331\326\022\037 \317\346T\303\257\243@3\212\254\177EhTp\002\301|Q/p_;\266\216\210J\345\367(}\204\345\370-\354:\230\365)\310\037\266\"\030\031\371\344\376\tLzg\3408\027\352\372\303\340g\335M"
+	.string	"\200Ny\200\003H\375\331E>F\003\205\003rR\2564\345\320#A\0204]O\202Pv\253&\032\201\t};4\275\277\225\024n\220\024\314`\017\320\005MC$\254B \233>\261\242AN\210@\373=\274\2441\276\345i\325\036\t#K\037<\342I\210V\342\254\3433 dt2\206\356W\201\020\2237g\327\212Wn\327OU\030\2637\273\370h\354\003v\255=\\\020s)\007\035\257\032\241)\336\261\215\351\376\261\032#\347\305(\303"
+	.ascii	"\330\321\0302\302\252\350-qL\2101\327\312\234\320\272E?G\366"
+	.ascii	"\357[Z3\357\267CQo\023\265N\303\330\241\315\274\255S\2443+7e"
+	.ascii	"\3122\271\214\256e3\2726\362\230\037\334\303\256\312sa\276\230"
+	.ascii	"U\3300\n4V\276\325\3636g\021\270`Y\346X\220\360\036\212\036L"
+	.ascii	"n\244C\250n\253\321\033n\305\265\006\2100Dx\211a\264\317\023"
+	.ascii	"\"&\301R=]\026\342\021/\325\b\001\263\226\266n\204\200\356+\254"
+	.ascii	"\227\007\325\3311S1\205\262\205]\260!\350r!\245/(\366\377I\223"
+	.ascii	"K\354\202\027\206\207\271\034\004\264\253\006g\227(\354\203\027"
+	.ascii	"\232P\363\"#t\202\005\231\351\0324S\200h\037\026g\201X\216\322"
+	.ascii	"\032\273\204A\324n\376\366\310\337-"
+	.string	"\221\3123\333\273\241\320.\200\320k\036\024\374\240^\201<\210\377T"
+	.ascii	"\021K\002\274sQ<\216M\256\311\373\244\031a_<g,\2473\344\005\270"
+	.ascii	"\260\2378\305 H\025\030\2025\265\310\305d"
+	.text
+	.section	.gnu.lto_.pureconst.e437537c03190dc0,"e",@progbits
+	.string	"(\265/\375 8\301\001"
+	.string	"4"
+	.string	""
+	.string	""
+	.string	"\021"
+	.ascii	"\230\004\001\230\004\002\231\004\025\271\004B\270\004D\232\004"
+	.ascii	"G\231\004J\232\004K\230\004L\232\004Q\232\004R\230\004T\232\004"
+	.ascii	"U\232\004X\230\004Y\231\004Z\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.e437537c03190dc0,"e",@progbits
+	.string	"(\265/\375`\313"
+	.string	"%\b"
+	.string	"\262J&/PM\223\016\243\021E\314,\002H\003J\304\250k\016\2066/\307\224F\3372tf\212l\001d\2739\"TIG\202R0\245\205\335\335\232\224)\027H\023\007\316Kx\224\021\006\031+\313\004[\251,\355\206.\020\220\212\363 \300\254\344\004$KAiT\024\361f\351\\\034\306\260RzvX\356\246\253\234W\233\246\201\341\021yfa\2052\341'\270\353\300\b\027B\222\273\217\273\353\344\330\320h-\303\302(3\253\013\252s*\247E'\257\274\242\223\242"
+	.ascii	"\177\237\351<\340\3479\0221 \240\002\251\252\363X\222\240\001"
+	.ascii	"S\002l= \227\036\352\365\001\036\302\314Av\003\361\340G\201\375"
+	.ascii	"\037l6\300\217\343\266+hC\033\320\206\033\263\025\352\352\330"
+	.ascii	"!<$\367\243\302/\n\n*\356\204\335\004\313&\367I\314\035\260'"
+	.ascii	"\312.\203\336\263\320\200X\320\020\342j0\204\204q\f\206\206h"
+	.ascii	"\243,q\303\302\233`\013\036J\021"
+	.text
+	.section	.gnu.lto_.lto.e437537c03190dc0,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_mspDescriptorAlloc.175.e437537c03190dc0,"e",@progbits
+	.string	"(\265/\375`\036"
+	.string	"M\007"
+	.string	"B\01623`m\322\001@_\002\234P\270\030\314\177\213Y\343\261\211u\323\234\3464\331e\326\242\013\002\"\027\3625X"
+	.string	""
+	.string	"B \315\266\363\265\265\226o\324A\366\2262\245\326d\252kz\3255\275\006\006\205\351i\254\353e.\246\252\005\3539P\224\365,q\337V?VLG=N\3758L9\3705\365\020\025\236{<\232\304\277\360\203Eyx\347[$\335]\003(:9\262#'\325\302~\333\335\265~\354Lg\246\357\006JP\020Dv%F+{\342F0lol\213\277q\216\215\261\026C\231"
+	.string	"(\024\001\242\262\273\017\363\213t\327N \335)\350\330\023\363\337\361\226\241a\0023\316\023 aw\2350\233\270\365\266\rl\027\330\016\t\013"
+	.ascii	"%\013\335\264\030\t\023\f\002\246\2248\251\270\263\250\365\346"
+	.ascii	"\302\222\005\313\303\265b\022&\031"
+	.text
+	.section	.gnu.lto_mspFindPassthroughSerialPort.182.e437537c03190dc0,"e",@progbits
+	.string	"(\265/\375`\211\003%\031"
+	.string	"V\357\242H\300\226M:\263\377@1\246\301;\350\030\231\306\226^\025\002-gb*,\020\231W\214N\022\255\025\316\253\353\263\266}\275\274\033\277\025#<*@T\330\246(\371O\355\310\251\n\313+\367\341_F\242\331F\244\221M\244L)\224"
+	.string	"\177"
+	.string	"\220"
+	.string	";\267\256\353\360\371a\204\030\242\346$jN^\202K\303\204\227\376\214#\361\030&\200\247\302\247u\203I\215IjN\236\313\274\277\200\227\341[\300\313\035:\354b\270\002\345\267\n\363\221p<\261\335b\027\r\244\3601\361\3602\023_}\342\222\323\022\231\031F%\276\273\001\243\021@\n\376\\~"
+	.string	"\214H\365P\271\325>\327\211Z\321\225\256=7\017\372}\367\003$\250fI\232n?_\332\f|!zZ\301\272\325VW3sN\253\355\346s\263n{\3106\003{q\001\263\366\244\310\376\r\333P?\316Pj\233\b\n\320\264\312\376\322\2312\370,\214\363\322\333.\375\027x\371u \345\bH\246\243\315\213\351\346\354\3578\216R\274B\266\325.-,O\272W\254n]w\263\244Z\\\251CP\275\002\325\340\247\226R\375}\352\375\324\017"
+	.string	"#\003wb\250\311&\341M\021co\026\221?\\<\351\327]\355\333\347\371JI\034\276\t\304\233>\377\331E!I\305\204\227\267y\374;A6\204\007\211\020\316I\223\361\237*H\bY\\\212\273"
+	.string	"\306\322\221N\246\243\251\242\350\210\344\346\314\001\\\331\001(\306\032Lh:\305,\032\256M\201Fo[Ym\270 \023\270\n\276\332\177\350\315t\264\\\360\207\334+\375{\001e<\322q\3451\365YE\277\265kl\364\266\226-@\333\230w\277}\255J\246#\217\233]\t\2447u\034_!R$\246T'z\"z\332\315\355\360\235\252zE3(\207\337d\250p\316\330q\247:\001\360\322j\01367\0274\274\032\260jlhv\036l\320y\345\210\266\020\223\263\203\343\322pC\203\343\262\240\263\343\212y\361+\247F\307\265\341\365\322q\265x\363\337\\!\353\312\207\201\032\272lk{l\267$\215 \331\316\374}s\316)n\316\016>\004\026\3169e|!\030\036\300(q\331\357\236\340\210\215\251\367\214Z\200\b7g\343\236\371u\346\344\003\312js\376\356\"\214\021\267-\"\222[\b\311\262\254\355\351"
+	.ascii	"\262v\202P\f\363\004\305\206\240\242&o\"\370\3563\252\242i\311"
+	.ascii	"\004E\226\r? `\2021bx\036\215Po\214\t\342\211 \356\303\202=\222"
+	.ascii	"G\204\276h\\\036\327\252\311O\326u\013'\246\326 \332\026\314"
+	.ascii	"\335\200\030Vh\016\316c?i\237\257t7\371'\261\261\313\246\326"
+	.ascii	"\267J\234\252\21517 \331\003\220\023Z\034Y\036\264\232\260\n"
+	.ascii	"\304r\"\274\027\327\224\336\357\314\332x\3340\271\270P\022\322"
+	.ascii	"\205\"\334\242\350Z\330\276\021f8\301l\341\230\213\0202\305\003"
+	.ascii	"\023z\224\306\374\027\3336\330\240\b\346TH\221\037\244\020~\221"
+	.ascii	"k|\273\017\231uY \003"
+	.text
+	.section	.gnu.lto_mspSerialPassthroughFn.183.e437537c03190dc0,"e",@progbits
+	.string	"(\265/\375`\361"
+	.string	"\245\f"
+	.string	"\366XXB"
+	.string	"\2216\035x\"9\231/\251\025\350\375\021\333\027+}!\343\002F\237y\004\263\215\355\207\317\224.\032\246\331f`\202X\372\021!P\237\252\352\353\300^\377\377\0036\220\377\243\375n\016\373n\264\211\224)\005E"
+	.string	"B"
+	.string	"C"
+	.ascii	"\232\351\260:\201\351\320\233-\343\321d)\021%]\n\226\335"
+	.string	"\2654\304\267K\232\233\177\3211\336\307s\251\303U2\360\271\240\021\3403\"iHFx\027=5|\270Lj\301\356:\275\017\207\033\3366\003\333\n\354;\b\361\2462\255\231\316L?s\320\210eF\203\026\273$/5v\004UH<\376\366\346\213\274a;v\276\0316`\274\030\036\276\335x\340\320V\365\264\177\342(\266\237t>`7\264\222\262\033\021\270@u\350\370\335M\\\276\024\365\205I\365\001\312\312H\2728\365\252\372\256\344(\2574UY\370\235\211\322k\202\0250\272\027\\\276\030\246]\301B\336\2434K\200>\264|\234z\354\350I\005a_\332\335\265\206\354\237\374\325\003\032vu\200@\240pa Z\226m8\0024\354\352\210\260\t\301>\262\214=88\231\210%!d#by`\231\305\241\361\305\371\300,\355\2720k#\356\245\325\220!h\324\362aPN\302\344U\334\277\246J)\265'dy\317"
+	.string	"TL\214\002\022"
+	.ascii	"\357b\314\3043\243p\b\206\370x+|\252\rp8\306\nF\263L\346:\241"
+	.ascii	"\211\213\273f\353L\220\214\242\233\247N\213ky*!\247\024j\017"
+	.text
+	.section	.gnu.lto_mspFcSetPassthroughCommand.184.e437537c03190dc0,"e",@progbits
+	.string	"(\265/\375`^\003\205\030"
+	.string	"f\353\235K\240\324U:Fb\033\201F\343W\372] w\352M\270\257\321\241\327\004\n\226\247\250\013\351\350\341\217\262\203\020\323\367\367\336J\023\003\t\024\f\373\303\257"
+	.string	"\277\352S"
+	.string	"O\201\265\350e\232>\216\235\027\322\213g\254l\337\267O\310\226;\311\213"
+	.string	"|"
+	.string	"\211"
+	.string	"\227\231/\031\307<\344\304\341U\221\030\376\264H\336{i=\342\270\277\\-\326Je\226\266+\216\317B\177\271\277\\\255\027\337\202\004\004qV\013\022\220\350++#\222Adg~<\025\335\204o\250\252\254\253\303\220\037\357\341+\262\006\204\374\212~\252iY\214txp\3758\330\027(\021B\336\303\367\241\226\301\333\326/\370\266\263 &\324\344\307\263\004\2205\220\274\370\n\364\333\325\252Bp\357\345\212\376\200g"
+	.string	"gf\030\314|\200\271\027\004,\363\367\212\260\251\b\204W\2230\253\266\232\331\226\241\036}\327\022\301#)$\257s\314\304\\m!\363\355\275\367r'1\177\305\257r\025\177\212Y9fV\206\235\370\267\312\312\245\255lm\345\266\225kW>\313\237n\222\210\002\032\367\006\245J\356\261\264\321\304\314w1s]\341\263\202ry\305\246\031\342\024\314+\363Q<\005\356*6\034voR\224\361^b\001vY\275d\342g\346\313U\254\301,\373V\f\"\253\314\024*\324\243e\233\330\230:\356:\307\253\341\365\335{cb\311c\256N\275\306\021\250#\363\247\031\353\027o\213;N\322t\311\356\247\t\353X\233F\273\232\262mXs\375Yb\264\ra\207\324\220\256\246e\317\260`[t\277"
+	.string	"\211\324\216\321>\320\"'5\233z\264\266"
+	.string	" \217#\257s\037&A\032m\013\323\337\230|\027\177q\303_b\234\234z4\307|\251b\201#iDW\323\232\243\027\344\324-\f;\t\316\323\246f\273\325\364\234\266\032\236S\007\245v;\273\347\304\320\\\243\3419uh;8\027th\265\333I\243\231\261\215\307\346F\353\261\331n4\027\361\336\336Nb\tNG]\357^/\034!\216\275\243\0333s2J!su\212\t5\202r\311\310\206\216=\227\030O@\255"
+	.ascii	"u\346)\315\314\240A=\312&7\202\307^\347X-|\020a@\324\275\272"
+	.ascii	"\243\374\034\016&\244D-]H\306\013THWS\226R:\201du\037S\245a\204"
+	.ascii	"i\t%\246\240\252\205\001B\250q<\203\214S\304\314\214\004\023"
+	.ascii	"d\244\005\315\001\220\002\0212\354\006\021p\27562\245\205J\007"
+	.ascii	"\2176\206\366\bE\204\373yzP\365\315/\204\337xH\230\233N\224\372"
+	.ascii	"\245\357\322#&\314E\225\226\215\344M8h`d\352\206\374\234\ni\035"
+	.ascii	"\035\003e\201\366k\036\023\300o\231-,S\244*\351\347\177ry)J\306"
+	.ascii	"4\365\355\"\327\346\022\331,>\t\200\375#\257\3161:\275\225\004"
+	.ascii	"K\002`\224\201\235h\016\rL\266\031u \222;\355Y\237\300\206\236"
+	.ascii	"!5>\250\006"
+	.text
+	.section	.gnu.lto_mspRebootFn.186.e437537c03190dc0,"e",@progbits
+	.string	"(\265/\375`\254\0015\017"
+	.string	"\366\032bF\360\262&\035\222n1\306\315\364\344-J\327\313$\255J\270\036.\234JP\277\021\262\304\3457\330\n\257\211\027k\213$8\374F8\240\313\312!\276\223\3142,\022\310\306J\230\347\377\r\200<>\022\017!\273\355\226)\005O"
+	.string	"L"
+	.string	"L"
+	.ascii	"{\311\230\300p\323\332]-\306\370\322\321'v\311O\324\221\237\365"
+	.ascii	"\220r\250@\357\223A\313\261\020,.\277\260\226K\007;\037h\372"
+	.ascii	"\347\250#0\335\260\331\241\002M\217%\322\314H\314\220\021\001"
+	.ascii	"/D\275Hv\327\372\201,7\200\333\336`\033d_G\024*\350?g3\035~\360"
+	.ascii	"\220\242g\207\236F\030\373\027\214\030\021\216'[\325\237G\345"
+	.ascii	"\264z4\360\261\313aH\317\256\244\214\023#\266\257\366k\236bt"
+	.ascii	"\025\026>`\367\024#g7\\\340\004\330\245\303g\363\022;\201y\351"
+	.ascii	"\221\315z8\"/\320Zy\032DS38\242\312\177q\353\267\032pP,\210\026"
+	.ascii	">\216Y\330\r\314K\254dwV54\366ol\2634\232\227\017\273\336_\364"
+	.ascii	"[\005\007J*\304\376\212\333l~\tO\350\364\337\245\337\315\313"
+	.ascii	"Gi\243\206\313\212\016\261T;*\334V\022\301$\304\241t\">\001\245"
+	.ascii	"t\"MB\310D\244\235p\235\006\312\274\245\240p\232\312\266q\332"
+	.ascii	"H\270\217'\324%j[<+\221\344\247n\222\031a\214}\256x\372/3\360"
+	.ascii	"HI\013P\377\301\264C\020t<\254J.\256:\340G\024\200\006\220\325"
+	.ascii	"Y\004) \220\202)\321y\377b\204\321\270N\310\006\300\317\223\311"
+	.ascii	"\334\026e\271\236\245\345\023\342\016\324q3\354\307\244\355<"
+	.ascii	"e\235D\223\216\220.\220\304\255\2377\233\350\320\253m\242\216"
+	.ascii	"e\353\305l\230\003\r\266\353\367\0134\217e\264\233a\365<\031"
+	.ascii	"\020\231\360\320\005\206\3743\336\355\343X\347\0322"
+	.text
+	.section	.gnu.lto_serializeSDCardSummaryReply.188.e437537c03190dc0,"e",@progbits
+	.string	"(\265/\375`^"
+	.string	"\r\b"
+	.string	"\362N56@o\323\001@!^R\004\370\367\253{\007\3341\363\305\001_S6\346\273\227+An\026V\253\033\217\252\0035\303\200\260\002\033\364\337bt\226\330\375\375nD\312\224\002!lA\335\341\200\260Ol\360(|b\347\302\"gc\013\304p\305\220e]Q\323\355\247U\316\t-\336\204R\030\346E\376\301\364\035*\354\201eE@eJ\203\247\332\020\021\371\315iR\362*T\263;-U\303\376\264\273k\345\354\217\376\204?!}%\017\311\356\305\213\313zT\211\207\306\366\323\376\307A\262\217$\016\260\313\241\220v\273\003\023\300S\356\276\251N\301\007T\247\234\331)\3578\026\323\221a1\362\355n\324\215g\317\314\177\3103\233H{b\020v\327\271\2110n\275\355\001\333\005\366a\021"
+	.ascii	"\357b\310\304c\240\321\342\302\353\234\200\273D\350\002\026\002"
+	.ascii	"\201\001Z\340L\\\316;\016\206\\\202mVS\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_serializeDataflashSummaryReply.189.e437537c03190dc0,"e",@progbits
+	.string	"(\265/\375`J"
+	.string	"\345\007"
+	.string	"\262\21644PU3\006"
+	.string	"L\300!pf\335\361zh\245\265\371\304O\301h\344\355\0352\n\364\215\366\310D\254\210\246Ef\206Q\325X1\200a\246\177$FK\233H\231R!\255!\326\323\001i\037\t\361\300\360\221\236L\223\035N1\220C&C\030\226\311\315\274\247G\257\013.\337E\304hq\211Y.XGT\232\004\301\312\004\021\fcKQ\001\3355\340E\345\313\210\\;9\030;ZO\377\337\350\265\036\331\3202\315G\222\2318\3717J5\377\250\224\220M[\303\326\"\036\331<\262\260\300\357\301\240\3743\241\006\227\251Ns*S\227\007*S\335\332\030\317\217[ %\r\023\322\177\031=\274\031n\265I\f\320\2118CK\341\177a'\342p\243\333\026\264=h;\023\020"
+	.ascii	"\357b\310\304\303\277h\270`\301d9\235\003Q\350\224\002\002\343"
+	.ascii	"\f\\\316;\016\206\\\202mVS\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_serializeMspCommandStatistics.194.e437537c03190dc0,"e",@progbits
+	.string	"(\265/\375`\034\007U*"
+	.string	"\232K\210\020Gp\334Q:\313#\266\246\276\032\217A\266\373\253\221\31628@@\214\206\026)\007\0251\204\330.\326\232zM\365e\242\247\311\324\002\323b(\322\200\271\213\2064\375\260\035\206\312\005}\227\261\\\207}\373/\376'\204\310\235d\372"
+	.string	"\334"
+	.string	"\366"
+	.string	"\301\273v\237|k\256is\257s\350*\023\261\023G\201\340ez\356"
+	.ascii	"\272e>\225W!\276\013\307{\356\255j\343r\257\263\210\033\350\256"
+	.ascii	"\262\363\002\326\253\272\373\254W\231\310\274\246@\323-Bh\242"
+	.ascii	"q\262\362v\357\0356\022\266\316\247\316s\320\022\337\023\004"
+	.ascii	"\376|=\336\216G\227[\325\264-\221\317\200k\013RY|\317ZRI\264"
+	.ascii	"\311\006\255\226I\016T\360ck\242\371\2504\305\364\212h%\211X"
+	.ascii	"^\356\302T3\214\033\325R\352\273THJ\314\217\257%\243R\001c\216"
+	.ascii	"\244\371\330\025h%\241,\317\004\036O\250\226J\256K-T\331"
+	.string	"R\362\265\344\220\264\277\242`\256\225\024bsK\315:nTK#_\177J\247Tx\357}\330\321\252\001\232onT\313$Ow\312\037\357\324\001\027\235\262\237\222)\375\2016-y\364\366Ii\2646w\341\336\313\026\251\\\236\001\234\371\027\230\271\002\363\032$H\333\367\232b\352\342{\206\210\221u3\231\350\357\036\325\023\215\311\322\341\235\035\320\3141\220\354\221o\353l3Sc\352\"\263\323h\233\311\374\240)Y\234pW1\253\226\215T\313E\252e\"\325\362\220jY\350b\347  \325\262\360_g\004\357\372\017\374\244\226\r\334\371\017H-\007\017=\003S\313?\325\262o\265\334[-\363R\313\273\234e\236\324\262.g9\227Z^s\226\325\324r\272Zn\325\262M-\177\3503s\245|\0230\367\372\210\263s\325\324.Y\027\373\277~\350\233\371\374\260\2171\363\330\306\261\360\263\320\210\342]\025{\323D\223Z\033"
+	.string	"\356\221T\232cE\277\302\314\263\301\314\273\372?\037e\036\037\354V\210\2072\331\357\362~G\231\246\2326\367\336\b\272\253\302\364>\353\327\215\335\305269nP\257O,0G) nWO<`\013{g\304\212\362\330\231\325\324\256\231q\300\376\330\031\024\313\274\236ge\264ta\302\223\346\200\375\223k>\332\327\316u\2179\301\351~zm"
+	.ascii	"\306\255\350\021\316h\343Xm\276\231\006\017\003\330\356\275\277"
+	.ascii	"\342\337X\257\036\351\346\247\325\376\035\311\212s\202\363!\351"
+	.ascii	"AG\327;\223\255i'=\317\016\244}\266\266:\271T\3526\325\357\006"
+	.ascii	"gL\325\332L>\210\265;\351\211\206\371\303\313@\244\200\272\263"
+	.ascii	"u/\223\004fVq\262\020\253\026\224\035\n^\376E\004\377\352*\217"
+	.ascii	" a\2174\261^\355~\330S4\250;\\]M\246\355+Lm&[;\364\203\035\317"
+	.ascii	"\320\332@\007\373\211\331\307\016\375\004\n{$\003\265\245\251"
+	.ascii	"5u\221\203\366@3\2578\262G\"\350\276\322v\226\246\315l\003]\300"
+	.ascii	"\212\023\234\016\033\307>\027/\354\003KH0\224\322%$\030#\226"
+	.ascii	"j\264\220\241;JR\352%%\026\315GF3\224b\fe\274X\021cx\224\244"
+	.ascii	"44\022\300H3Z$\r\227\220\220\222\206<\247\216w\025\353\326@Q"
+	.ascii	"\323\321F\255\236f2\3211\255\007\020\250{\3203\2644\330\300~"
+	.ascii	"b\257[=\275\367\336`3\201\r\324\217\276\2041+z\2242\226\201A"
+	.ascii	"\341\002l&#8\232\255\361\0255\001\250\231\226\336\320\177\034"
+	.ascii	"\315z\354\204m\364k_\377\210Y\227C|\362\026\007\216oN\217\b\345"
+	.ascii	"n\242[nmzQ.\007\226'\205\310\365`\252\251\213j@\274\245i\343"
+	.ascii	"\365\241\242\240s\272\026\330]\023\253\020\275xz\327\037s\202"
+	.ascii	"c\363\240\343\233\371\031\f\0316\330#7\254Wy\372Q\242\240\\]"
+	.ascii	"|\254\256\205F\255\343pd+\355\327\3144\265wX\211\272\210\250"
+	.ascii	"\177O,9d\260\234Y\342\023\336wX\205z\250\037\324B"
+	.string	"\315#\203u\346\201\025\330\230^39AP\200\216\250Q<\345\020C\346\314\210\004)I\232t\200\002\2211\253y\021\2609%E\223B\261f\037F\314[\363w\3557WI\203Cx0\025P\232\0035\234$Bg\327\245w\251\2328\2648'\365\304=e\007\377\244\305\016\225\306\277\277\307?TYm\366\223\232\242\r\230E\350\350/6\030\244u\322\334'P:VCC\017]@4\260A\361#d\020>\021\"\377\2652\301\252\365\3005\334D\001l\237[\243v\246\002\256n\326\246\013\237\213\306\022\356~\3724\322l\013VA\220k\276\2141f\276@\352\236\214\204\365!\n\204\231\f&h\306\364\361\004\305\202x\265\2167\035%N_\364\247\221\331KSJ\316\005w?}\363l#w2:?\345jv\252\364\247P\364\333/\355e\325\301\304\2215\355\214=\312\236\272\200\304u\342\266J\3430N\340\256\226\032\200"
+	.ascii	"\025\027\323\2176`\376\316+\001\303\300\364\204?\231\215\344"
+	.ascii	"[\002\206\265\026U\020\272\252\347\302\333\324F\032\200\205B"
+	.ascii	"f:\242e\260\221HqB5\024\241\006"
+	.text
+	.section	.gnu.lto_mspCommonProcessOutCommand.195.e437537c03190dc0,"e",@progbits
+	.string	"(\265/\375`=&U\227"
+	.string	":\362t4F\020Pke8\367\243Ef\3508F\005\213\025V\330\352\2320\217\375w\354\3178\230\315eYo(|H\"\216Mv~t\\\352'\226\202\327\341\033x\r\276\310\361a\234|R\252\036:N"
+	.ascii	"\031h\020F\366\2262\311'\003\353\002H\003\274\005\030y\th\336"
+	.ascii	"\001\214\274QI\2745\232\227F\021\357\f\023\274P\315+\200\221"
+	.ascii	"W\006\022\357S\363\006`\344\005\240yc4/\214\346}a\344uq\304\353"
+	.ascii	"\324\274M\315\333\242yY\030y\231\206xW\f\361\252\030\342M\261"
+	.ascii	"\274K\313\253\324\274(\214\274'\2327\251\210\327D\363\"5\257"
+	.ascii	"\361\210\367\310\210\327\250y\213\212x\211\210x\207\232\267D"
+	.ascii	"\021\257\020\021oP\363\002\021\361\026\233\367\247\210\227H\304"
+	.ascii	"\233\016\361\242\315\333\313\313|\203\214\303\244\036\021mRz"
+	.ascii	"onM\362\354\2632\3233V\016\370\343\371\373~;\377\336\177\304"
+	.ascii	"\257\367\313\371\343\374n\3763\177\232\177\315\207v\277mX\034"
+	.ascii	"\226\365\270\340^\207\245\341\340\356\003w\205\370\270\305\361"
+	.ascii	"\375\261\340+\323\323\334gY\356\341\331\363\335o\205\362\274"
+	.ascii	"\357x\275*\240f\\\030f\211#\021\305\330\331\337\261\253\263B"
+	.ascii	"q\234\304\3015\351$\261_.\327\f\236\271G\342sVH/\206\257a\353"
+	.ascii	"\307\232qQ\232\353*VC\361\351\021V_\277V\032\200\210\2232\244"
+	.ascii	"(g\237\367\225l}\221(q\313&^\034;vsA\336\254\220\233U\003gp\305"
+	.ascii	"Bs5g\263B\3735VM\\sk\222\24059f\n\273i\260\214V$\326\213\365"
+	.ascii	"y\213k\216P|Z\346f\216?\023\244\311kn\035\013\372Bf\020\016\352"
+	.ascii	"\351J\025\2376\241G\"\032\2017&\017s\t\027\346ehO\267\327\335"
+	.ascii	"N\353`\026\310\214\037\340\022n]W!\255]\241\247D\273\307]\241"
+	.ascii	"\335M\211\020\242d\264z}y\213B\347\356\345\370!\206\374h]\235"
+	.ascii	"<\313\254\353\034\215\205*>\335\271b\363\356\341\036w|\027\""
+	.ascii	"\233\256\253Z^\231u]i,\214\342S\243'\021\237\362\221\210O\013"
+	.ascii	"@\340\270H%%\227\236\001\332\242\200\321\r\256\353\\TC\331}\213"
+	.ascii	"\245?\377\\\261\350\321\271\357Q\212<\214\027.\234\232Z\260`"
+	.ascii	"Z\241\"\305\222\022\212\023I&\220\214GFEDC%\204\202\200\212?"
+	.ascii	"\304\024\355\030\214\334s\035F\341YJ\340\227\027Ou.\f\3618\021"
+	.ascii	"\036\307Z\237\272\246\246.\334B\356,\370\274\b\030\307\247\247"
+	.ascii	"\t\231\334\231\356p\341\025pW\361#u\3478\326\370\346\340\234"
+	.ascii	"M\310\340\236\002\375Q&\371\301\006a\363\314\363~\340\245\267"
+	.ascii	"+\005)\307\204\2119\233\220\271\035\205\025\264\211\216\033\237"
+	.ascii	"\310;\032\267\304\322\204\354\355I,\300$M\340\351!\341}1\242"
+	.ascii	"%\350h\341\201hL\211\032\300d\f\235\277\211\302GO\310\244\334"
+	.ascii	"\bN\321\033=\242\037)F3\342\213\336\020\332K\240\235\261\220"
+	.ascii	"\331\203\262\210\231!!\306\003\00395!c\362\"\022bL\320&6w\312"
+	.ascii	"\"V\306?/\340\340\020\3375\346is\301\0236\246\344\350\351\216"
+	.ascii	"f1\213\363e/\314"
+	.string	"\230\2227Ky\214\273)U\266\370\220&&L\234\035\225\"\226`_^AcIb\327!9{\023\2611F\376\221Z\327u9l\214\354\013\300w\333jw\273\354\276 \006\335e\366\030\036\300\004i\326l\036\334S\310L\0025\332M\305\006*v:\267\347\217\351\365C\354\237~\332\304\376\035\330!\001\214\246!{\340\207\245\335\344\325\\\273l\307E \327\320WY$[\030\022Jo\235\305y+[\301\335Mkw\023\327\302\370\201\035v\361\023\250\331\210\316\334\232\305E\022\271\263\276\334\361b\302\205\342]$\025\244\017\3740n\242:%\253\263\231\204\302*\363\204\304\202\324\"\204\323\262\027d\020,\307s\310\266}\225\247\213|Cr\341\207=\375\371\346!\262y\321o\311\374\002\373J\375\350\200E\306n~cL\245\327\031\214`\323Il\266\267^\335\221#R'F\301p\033Rn\006%n_\017\223\240\370u\263"
+	.ascii	"\236\336\250\300\311\374j\256e\256?\365\t2\321UCl\316\270\222"
+	.ascii	"\263\202\241v1\320\200\037\266\267\353\303c*\233k\177\370\323"
+	.ascii	"\035\007\2372\203M.6\354f\373\341+\305\305\206\373\257p\323\303"
+	.ascii	"\214\321l\313V\226\257l\037S^\331a\225e\037\256\026\207\t\347"
+	.ascii	"&eyJ\027\227\276'\313P\270\266\\Y[v\362\265\316\240\332r\017"
+	.ascii	"}M\264\345e\032eZ\304\016\316\215yX6\3333ryWV\265%\313e6\342"
+	.ascii	"\360\256\254j:,+y\032l\003\347\266\252\215-\223m\337\373\352"
+	.ascii	"\300@\262\234d\373~Xey\326\304F\226qH\337\314\301\271\335\260"
+	.ascii	"\\d\373T\320i\203*\227\277Z\216\273\226\223|\265\265\215\313"
+	.ascii	"\225Umy\335\276\342O\204\370\364\312\336R\007\316\315p\3110\227"
+	.ascii	"g\353\312\365e\037\207\2552\236\376H\237\356\217\322\327&\311"
+	.ascii	"r\245\302\207\273s\311\243k\263\355\036]\333\311\356\023\360"
+	.ascii	"i\276o\342\301\021\343\026\304\217\370>\213\022\357\261<\316"
+	.ascii	"\367W\254T\231r<\337Cy\362\275\357\331\322\226x_F\366!\376\213"
+	.ascii	"5\357\221\274\313\377#\313{\260\003~\377u;\337+/\347{\257\273"
+	.ascii	"\371>\331\3653\337s}\315\367k\363\"\215\274j\363\036\215\274"
+	.ascii	"64/\021#o\r\315K\303\022\357\f\315;\244yeP\342\025\322\274[F"
+	.ascii	"^\255\346\315j\336 \315\013\244y\261\214\274W\315k\325\274?\232"
+	.ascii	"7\206\346\205\301\310[\325\274>\232\267G\363\276\320\274TF^\036"
+	.ascii	"\315\273\303\310\353B\363N\031y[@\342e\241yW0\362\252\200\304"
+	.ascii	"\233B\363\242`\344=\001\211\327\204\346-\241\210\227\204\346"
+	.ascii	"\035\241\210W\204\346\r\241\210WG\363\202P\304\373A\363\346h"
+	.ascii	"^\017\232\267\203\346\345\240y7h^\r\2327\203\346\305\240y/@\301"
+	.ascii	"kA\363\342h\336\n\232\227\202\346\275\321\274\023\030y%h^\251"
+	.ascii	"\023\274\021"
+	.string	"4/\004F\336\007\232\327\201\346m \211\227\201\346]\240ym4\257\002\315\233@\363\"\320\274\0074\257\001\035\204\017\200(A\237\316\031m\007'Q\276\350\311\t\272\321\0244j\370\265%9A\337\350%\272\257\245\004=A\277\310%\350\313Y\256\221\222\352\276\243\007vX\003?\211\317Q\217\024\303\"H\242\216e\351\b\372g\355\016\233\300\316\242>\021\210\262\256^6\266\2574\0265\007T\211\272dI\226\376\234\243o\226i\234\247C\206\003\336\211fk\037\372\007\365\311D5#\232\021\237\376J\037\357\350\231\345\030gY\223?\021\246%A\360@C\360@w\033\302%\016\324h\007\372t\"\020\031\350\032A\322T\006\032mC\230\203\0309\246\007}1\375Sv\3035h\017\300\256@k\320\017\243@\243LAC$reZ\364\221T\320-\016\350\n\372v\0074ZG\260\360x1\372x\035\264\347\371\002:\006\001]"
+	.string	"\001\316\001\242z\200\265NS\331\320z\251B\221\242R\241B|\032\325\007\002\215F\317h\032UVT,\374\260\031\235\326\021\324\303LF9\327\3051\235M\023P\312\346\322\322ej\020\275C/Q\333\3247U\205J\201@\313\343\354\302b_)\244\346\322o\310\031\023\004\346\276\013\2321\225T\004\231\030\233m\201x0:Y\247Sb@\031Y\267?\t\324\367#9s\213s4\343O\366\311\332\270\006\347\371\265L\262"
+	.ascii	"2"
+	.string	"Z\200~\236\247\226\321\037\354$Dll\037i$j\234\234\352\305\013\361\351S\377\315\3232\2649og\272\370\331\253G\017L\037\243'\016"
+	.string	"\200\016\340\013"
+	.ascii	"\202A\2509\233\335u\253~\020\375S\246\256\253\217\266:\214\366"
+	.ascii	"\3217\202\016F\243\314@>/\\\364\213\376]\235\213\3566\201\177"
+	.ascii	"\314\344\2374\016um\253\263)C\377I\007\355\201zV\313\020\330"
+	.ascii	"\317\246\316\352\2179\272\245\212\235\03100(\210Q\357\370aM\215"
+	.ascii	"\326\t\324\303L\332\320\242fl\033\035\264\207E\033{\371\013\220"
+	.ascii	"\251Y4\212\007vX\202\031\025\r?\214\251\323:\201y\314d\332\237"
+	.ascii	"\002\361\212~V\024\252Y\321Lj\334\024U\b\262Q\321Lj\2308\261"
+	.ascii	"P\212?\325\r\022\n"
+	.string	"1E\027\200\226\306Y\306a\0174\303\344bC\242f;[\235\026$%\376\354E\205\272\332\310.\b\374\256V\361\324\274\300\266\241f\373\263\231\306$\365\352tH\362\263D\263m\214:,]\202\376 \304$\260\264C\240}\020\342\271\226<\340\275\252G\\\346S\223\030\200\361\250{vT<\37405\217\352\307\017[J\023\nj'\313joR\300\310\024w\316I[\03702?{+\342\3276\302tWR\365(\365\233\201J\230I\024}\242Q\374\361\034\225Oq]\327\004\226\221`=UPu\252\205\254\026\022\237\236h\365\254\2173\311D'\355\252\206\234\247>\213\353\352\225\3002\036\313Arq!>5\321\277r&\370\326\005\311\251\221\372l~t\247\002\361\250\235z\031\254,\311\317\205@\211\004\343\207\035\261i22@\255\001#\310#\3740\243n\346\337\033\240VY\021Q\027\r5\021\340Pw\231\277%I"
+	.ascii	"\233\355\376\224(p\261\034\220J\262\016\231\312\022B]\"\250\205"
+	.ascii	"\336\f\n\353\243\006U\217\251\255\037X2Dieai]Qi1\355\0068B\230"
+	.ascii	" ]\0375\264|lMYE]aYYa\355H\221E\265Ee\225\362\250\342\255+!X"
+	.ascii	";\322\252k"
+	.string	"QUmU\375\250ra\n\310\324\215-\252\036YS[F*!?\246dH\265\254\250~\270\200\225\225\343\n\253jk*KH\217\252\027\256\260v$]\341\320\322\242\332\201\225\225cK\013+\007\020-+\243--\036\235C\007\007<\254v\020wG\r ZVQWUSVQ;\262\264\242j$-\026\020\252\254\250-,\254\254(\241\271\256\267\223\375\201\246\260\216L\372#\211\247{\261\017\032g\035\031f\272\037\254\215\2005wr\337\347+\325\317\347\323\013\214\2654\205?\016a\314\316.\243\211\026\346\213\022a\306\346\234M&\177z\3121] \325F\366\357\324\322\324\276\267\243\r}\354\337\235\231\331\340$RC\023\351\337\025\201\226-\251!\317\033\reM\003\007\304\031\372eqh\016G9\262\031\206`\351!}:\017\210B\372X\274\240H\216_\320#B\372Y\322\370\266\264z\013\r+\242\265\327A\220\356"
+	.ascii	"H\007\351%:\254\006\322JxW\215E\207~)\257\366\236\366\243\237"
+	.ascii	"\026C\377\200\241c\250j\030\352\320.\224\253\252\017D\032\235"
+	.ascii	"\f\370\371\036\235\301\013\335\243\225\222\370\332\322v\252~"
+	.ascii	"\241\177\fy4U\377XD\037\032\362H\243\363\326\345\310W\312i\207"
+	.ascii	"\013\275\243\177'\246\tU6\247\013r\246Z\350)\026\272\205\273"
+	.ascii	"\016\004l>G2f\216h\320\020"
+	.string	"\237\262\320\227\223\206\007\270e\366\3505\231\312\025T\350\025Rh\025\324t\036\276\024\326\240pB\243`B\237\320g\323v\216n\366\272\316\021\016\3361/\217\370\324\204\376\232453\322\270\251g\210j\031.\204?\262;\344\222\303\341\222\246f\333\242-,f<\275\303\004\365\177\365\371\234\206\031A-_\354x1\341m\350\321\233kQ\002\t]\302\021\235\007H(\007\217\004\347\b\"\364\bz\375\246\351t\323F\204\303\020tt\b\307$Z\215\372,\302\"\310\267\204\373`\232\343\036\212\324\303\034e\021pg\032\315\321\316\021\3171\317\321\217\370TG?pi\bEd\017S\t\302\007\rB\363\335\2146B}\026\307\364\335Q\317\361\357\310\347\310\207\370\364\203>og\332\002o\264+\304k\026u\n\3310w(\344\302\244\342V:\235\222\002\352W*;G\216n<\260\025\315\266\312\276\225\376\235\353X\343\253\253\352C"
+	.ascii	"\316:\330L\240\0210\240\023\340\240\r\350\377\265\3337h\016:"
+	.ascii	"\275\373\312\"\270A\277\271\344{\353\322\305\317*~\267\300Ms"
+	.ascii	"\260\201"
+	.string	"~\225\005\272\001\fz\201\276\236\243\363~\307B\f\372\202\013\272\371\376\300\016\273\270\370\315\373\035\237\026p\251I(mA\377\254\361\355\001\366\234\234R]\002\245\357\227\204\2128\365\t\246\232\235\255_G\316\033\033!\237\024o\224\356\326\351\224$(#^\215\243o\374J\343\350\300%\231\344^\335\271+\314a\227\245f[\023\236\234\240s 57^\232$AAA\037N\033\361\352\273\365\363\256c\315\216\340\3272\006t]\233D\320\034\202\237Sz\316-PSf\360p\372S\224\232m\377\212|YA\321N\026)\203\006\250\342 -P\222\026)332\222$)\2445\"\013\020\b#a\032\326\362\006\022 $-\213\303\2129$\"4\223\024\322\030\310r\007\326\330\265?\332\327\027\356\276\031\202\313i3\013\274kQ8 \006\372r;\261\025X8\324z\223\274|\347/hC\202S\267V[\312\321@\030\370\222)"
+	.string	"\202\n*N\246\037s\024u\217\311]\250\233\244\244\341\274\204g\023\035\357\024\202\t7?Z\221]\007\340\210E\230\316\255\362\370\f\206\265\271\230\243\327_U\006Q\313\223C\005\346\037\301\301\270\023\225\374g\211B\342\270x\377\023\334\212\25037\021:\016\206\243R\351q\332\343\256\350\224\225M\n\\\343*\372\312dM\270\024!\267\306zF\351@\305\340A\361\035iV+\260\342%4P\376~$\300L\367\032\265(\375\223p\356\323\037\373q\363\b\242\315\207\357\340m\030\261\203\r\370\027\254Fs4\376\270\323[L\016}\\_\r\016\224@\370\332\270\203>-\002r\232\334\357/\005\360\3705\001\206\b\374&^C\246\3216\224d\207\335!\336\245\337\245qr\200\201\262"
+	.ascii	"\020i\335\370&\036\203\0317\214\350\252\022:]I\017\376Ul\264"
+	.ascii	"\355c\366OG\244\327k\260\214\002\234\305-\341\226\230\013\264"
+	.ascii	"oV\353a\347\324Z\021\207\271\350\323\\;\2656\254\316\203\204"
+	.ascii	"\205\376\255\200h\314nO\237Yl(\351\022\202\003\376L1\240\036"
+	.ascii	"\275\006\200\231\231\246\363j\263\016b\036|\332\375\n\265\033"
+	.ascii	"\347\003\255\bk\327\333;e\300\220\021p\023\317E8;^Z\231l\b\004"
+	.ascii	"\265N\330\025R$\013<\300\224\037\f\362\312i\311\277+cX@\236^"
+	.ascii	"\310\257\221\336:\376\022XO*\200\375?L\367A3\271\201\316!\345"
+	.ascii	"t\244]d^c4-\310\367\274\254k.\021\332^(\266~/\232\363\207\234"
+	.ascii	"\374\224\315V@\322t\204\007\203\270> \333\226\240\\1\331\022"
+	.ascii	"\373\2465\030\2056\031\230C\340*%\007J\343CA\375\035\234T\204"
+	.ascii	"\352\267\336\210\254S\3023\204\363\\w\026w\350\365^\2317\235"
+	.ascii	"Lp\260\316V\316\315\263\t\347\341#\221\361\220\254\310\024\025"
+	.ascii	"\241\177\313\206y\323\350\342\277\230-\025\235\322\301]\367\251"
+	.ascii	"\226X\026\013T\372\222\r\375\2757\227\252\017\223\224a\224\344"
+	.ascii	"\027\024\367\234T\355#\3512\357\307\357"
+	.ascii	"}\222J\347\335\013)\221\215\253\307\250\007 \202s\360\254\343"
+	.ascii	")f\273\002\203\235KB\220\244\037.\324o\302\001\2241\"\342\211"
+	.ascii	"O\372]\306\216\233\253\006\374\214\335Su\202r\001\374\220\225"
+	.ascii	"\374\361,\212\364\017\250\215\240Fj\232_\277\333Ad\317\356(\235"
+	.ascii	"\304\325:d7Ua\177\021\374![\303\207\211\311\016\227\027J\023"
+	.ascii	"\200\264\202&\006\375\210F\263\253\222Ic\235\230\252o\277\251"
+	.ascii	"\261H"
+	.string	"\264\204d\347\364vG\204&\256\373P\n\356~~\273\267,\3127e\234\2023\032Y\203U\345\314\221t\255L%5\324\207\313\337\246\307Io\363I\360\313\027\325\017\222\377\372;\351\332\305(\207x\327\317\2736S3\"\233F\232\302M_F\260\353\2559H\3673P\317\264\272b#\341\b;\363\3108\346\030\2450\333\300\306>\304\310-\246+1Q\006%\377\350\263\203c\177\036\321\256I\363\254?n\313\340\340\333\335\362o\033\263\207\213&\026UF\245OX\023\303\022\2203^\213(\2463a\310Z6.\313G\005x\023\320x}\022#\371\311F\027\357\024A\224m\244\270\316\005\006\364bJ\3253\303\353\001\227\240dI\340\223\366M\374\260\216u9A\034\013_\3121?\370S\264\005\275\001\013jf\357+\214\013.o\006\323\337d\202J\216\363\350\336\321\034JZ\363\031\252\320\345\271Y~=\366h\247\255c+g"
+	.ascii	"J\213\277\303I\374\205a].\305kB@\270\r\346~\331\213\271 \375"
+	.ascii	"\320\313\214!R\301#\373S\262\017\321x{\005\001\226\241t\346\233"
+	.ascii	">rY\035\330\200m\274\031\341\304D\n\302\340,\005\335\372\373"
+	.ascii	"\377\021Q1\202\202\206V\325\3025m\202\202\307\330H\235\334\226"
+	.ascii	"\016\346\247.@\bb\035\333\237}\025Q\370\300\013\332Y\213\023"
+	.ascii	"\334\025v\016GN1\217\312\376;`X\241_\007\211b(\227\276@\355\222"
+	.ascii	"v\344\273\030\331\245\323B\262\004\376\331z2]\2465YW\363\365"
+	.ascii	"\252vwy\0062n`\301S\276\315\375\357!M\236\b\245=#\227\024\357"
+	.ascii	"\301\301\370\201\241\023f\201Cy\224\301\242\t*L\375\255l\333"
+	.ascii	"\247\004\3648A+\022\213\212{\0262\335\355\200\220^\2227\335\337"
+	.ascii	"s^\263 \344\2164L\324\254.7\225\314\361\r\226\325\235*\335\036"
+	.ascii	"e\230\242\266X_\303\r\312\234\344\013\271G\247m\206\177Z+1:\372"
+	.ascii	"b\276c#WU\234\307\2002Y\354\256`\317q\235\n\305\2362\205C\332"
+	.ascii	"\270\345\335>B\301\330\340\235\263\\Q\217\360\306\221\374\003"
+	.ascii	"f\202\207\241\005\b\304\315\006\\\374!+\r\f\327EQ,)c'\023N\274"
+	.ascii	"\324\200HTk\305\00307\355\313\2728\312\031'\371\024\225\364\\"
+	.ascii	"kQ\216\261v\003\351sCp\002\036\204\275\324\017\013\264\"\\\262"
+	.ascii	"\361\260\370-\024\347y\213\325\026\372jC\001v\f\362 *\247TD\213"
+	.ascii	"\331J\345U\005f\345\310}\251\210\2568\211\205\302\224\243\371"
+	.ascii	"\332\310\241\323\234\023\220\330x\030\256$G\036\303\313)1\006"
+	.ascii	"Vk\260y\214\377\366\340e>\242\202\345xawM\257\360*\231\314\254"
+	.ascii	"\307\375\232G[;\2524\341S17\213\016!\3057,\313\245\005"
+	.text
+	.section	.gnu.lto_mspProcessOutCommand.196.e437537c03190dc0,"e",@progbits
+	.ascii	"(\265/\375`\276\241\245\376\001\332pk\270R\0200'\251\244\003"
+	.ascii	"\277\260;\323\335\335]\323\177\377\177}\177w\377\325\375\377"
+	.ascii	"\315\230\371\377\377\315f\367\366V_\325\327\3777jd\226(\267P"
+	.ascii	"_ Y\203;x\007\357\340\035\274\343#\023\205\352\240[\371\220\262"
+	.ascii	"3\350\016\265;\036\r\034\306\361\366\t\331IJ\031\330\nO\n'\f"
+	.ascii	"m\227\366\266\226\367v\226\264\267\261\274\267\257l\320\333u"
+	.ascii	"\"\3646\335\366\366\234\b\275-\367\336\266\222\366v\334{\033"
+	.ascii	".\355\355\267\367\266\233\261\267\333\214\275\315f\354\355\265"
+	.ascii	"\264\267\253\274\267\251\244\275\255\366\336NK{{\312{\033\315"
+	.ascii	"\330\333g\357m\263\264\267\245\274\267\313\214\275\035\345\275"
+	.ascii	"M\226\3666\224\367\366X\332\333b\357\355\260\264\267\301\336"
+	.ascii	"\333O\322\336v\362\336n\222\366\366\327{\233I\332\333^\357\355"
+	.ascii	"\256\264\267\271\336\333[iok\275\267\227iog\275\267\227\244\275"
+	.ascii	"\215\365\336Vb\354\355$\306\336Fb\354\355#io\033yo\027I{\373"
+	.ascii	"\352\275m\225\366v\325{\233\312\330\333S\357m)coG\275\267\241"
+	.ascii	"\322\336~zo\0231\366\266\362\275=\304\330\333N\357\355&co\013"
+	.ascii	"yo3\245\275\275\364\336V\332\336Nzo#\245\275\035\344\275}d\354"
+	.ascii	"m#\022\275]\364\336\006b\354m\"\022\275\375\343\275\355#\355"
+	.ascii	"\355\036\357\355\241\264\267\205\336\333<\322\336\336\361\336"
+	.ascii	"\326\221\366v\216\3676\216\264\267\203\336\333@io\337xo\333H"
+	.ascii	"{\373\347\275\355c\354\355\036\022\275\315\363\336N\032{{\347"
+	.ascii	"\275\255c\354m\344{\271i\354\345\304\3672\342{\371p\203^\376"
+	.ascii	"\362^\366\262A/3\337\313\206\357\345\302\264\227\t\337\313\203"
+	.ascii	"i/wy/sI{y\313{Y0\355\345\300\3672`\b\275\374\367^\366\003\241"
+	.ascii	"\227\373\336\313|\037\364\362\336{Y\317\203^\316{/\343\031{\371"
+	.ascii	"\216D/\333\221\350e-\357\345,i/cy/_I{\271\356\275Lg\354\345\271"
+	.ascii	"\367\262\234\261\227\255\274\227\343\214\275\f\367^~K{\331\355"
+	.ascii	"\275\334\226\3662\333{y-\355\345*\357e*i/\253\275\227\323\322"
+	.ascii	"^\236\362^FK{\371\354\275l\326A/Ky/\227\245\275\034\205\203^"
+	.ascii	"&\343\240\227\241\274\227\307\322^\026{/\207\245\275\f\366^~"
+	.ascii	"\222\366\262\223\367r\223\264\227\2778\350e&\031\364\262\327"
+	.ascii	"{\271+\355e\256\367\362V\332\313Z5\275\274|/g\245\275\274\244"
+	.ascii	"\246\227\261\336\313J\322^NR\323\313H\336\313G\322^6R\242\227"
+	.ascii	"\213\274\227\257\214\275lU\242\227\253\336\313T\306^\236*\321"
+	.ascii	"\313R\357\345(c/C\225\350\345\247\3672\221\264\227\225%zy\310"
+	.ascii	"{\331)\355\345\246\022\275,\344\275\314\224\366\362R\211^Vz/"
+	.ascii	"'\245\275\214T\242\227\203\274\227\217\322^6*\321\313E\357e "
+	.ascii	"i/\023\225\350\345\037\357"
+	.string	"e\037\306^\356Q\242\227\207\336\313Bi/\363(\321\313;\336\313:\322^\316Q\242\227q\274\227\203\322^\006*\321\3137\336\3136\322^\376)\321\313>\357\345\236\264\227yJ\364r\362\275\274\223\366\262N\211^F\276\267F\332{|oN\332\213\363\336\233\367\332\274\227\306{g\030{O@\2427\210\rz\201x\257\214\367\3060\366\376@\242\027\006\211^\037\336\373\302\330\333\003\211^\027\357\345\301\330k\002\022\275%x\357\016i\257\016\357\315\301\330K\002\022\275-6\350\305!\355\275\341\275#H{mx\257\b\214\275!\030\321\013\202\355\375\300{=\260\275\035x/\007\322\336\r\274W\003io\0064\350\305\300{/\220\366Z@\203\336\n\274\227\002i\357\004\336+\201\2647\002\032\364B\340\275\017H{\035\360\336\006\244\275\f\330\240w\001\357\255!\355U\200\006\2754\2747\001i/\0024\350=\300{\r`\354-"
+	.string	"\211^\026\357\235\301\330\273\202D\257\f\357\215\301\330\013\003\211^\002\274w"
+	.string	"i\357\013\031\364\272"
+	.ascii	"\200\336\026\336\313\202\261w\005\fz\0050\242W\205\367\246`\354"
+	.ascii	"E\201D\257\212\367\2460\366\242\300\240\367\204\021\275'F\364"
+	.ascii	"\232\360^\023#zK0\366\006\340\275$l\357\b\357\025\341\275!\244"
+	.ascii	"\275"
+	.string	" \274\367\003c\257\007\357\355 \355\345\340\2755\"zK\210\350\335\340\275\032\2747\203\355\005\200\210^\022\"z1x\357\210\367\032\2677\025\321+BD\357\005\357\265\340\275\025l/\005\"zC\210\350\245y\357\314{e\2667FDoQD/\314{\321\367\236\333[E\364~{\373\275\\\364\251A\356I\0260*\315\343}!w4\017\221u\247\332U[qSqGq?q+\271\233\270\225\270\221\270\213\270}p\377\340\026\342\326\301\035\304}\203\333\207\233\207{\207\271\311\214\310\334\205\271\217y\2179\217\331\2169\013\363\025\3469f*\314k\314m\314o\314Q\230\2450\203q\b\273|\2653\024\334\270\001\245\252\251`\310<1\311\3432<R\224\032\204\352\247m\250\301#\"\255\0344\242r\332\031.\207\201\214\265\0044\374@3-\316\0220\253\227v\206\317\261\244<.\303\244'\033S\270\fC\320A\226\325\254"
+	.ascii	"\217vg\214\346\200\334e\365\330\376\321D,\2226j\2203\363q\326"
+	.ascii	"4TfC\363Xv\263j3\334\316\261\275cg\370\324qC\226R\221\317\306"
+	.ascii	"!g\025\b\2643}\243\205\005H,H\026\312\223CB*\376\310\341\350"
+	.ascii	"\211{\353\244L\030\332\024.\303\326\331m\344\316\360Y\221P\020"
+	.ascii	"\360\026\244\b\022\371\225\2703WJ`\006\272\r\026\271u)r;\001"
+	.ascii	"X\224\003\023.\316\324\237\341\240\025<C\274\"\234\251;\303\273"
+	.ascii	"\242\023vn;\360\337\036\247\354\262\220H\344\214\337\316\360"
+	.ascii	"\t\325F\026\270\267\314\327f\245\2673y.\270\332\252|\024\357"
+	.ascii	"\214\264T$\024\004\264\351(\202D\"O\324-c\331\231"
+	.string	"+Yk\315@$\0229T\244\233K\262\306\3078\212V\342\366\007\2519\303\263\345*\314\306n\f\2673o&\020\312[\323\021\210D\362\300is\301\265\266#\306\332\2561r\b\3117\206\254q\005\"\221\310\035\322X-\207\251\274\360\200\347\013)TA\017U\036\006\212|zPy\214\321vg\026\b>\333\030\265f\022%.$\0229\303\347.\213-\227\261\331\316\360)\005\006#}\2204\2064\275\004&\240\310'Ca\262\034\216\022\303\203\235/\244\316\314O\263\216\313\020\211\344q\202\3175@\221\317\235\"\003\304\356\f\237\"\354\346,\207\355\3142X\r\017t\276\220;P%\324\027\227!\022\371u\202\317UQ\254\275\313_\334$\207\235\234\200/@\"\2070\247 \221_(\366D\221\317\375*\276w\231\213\273r\330\353fO$\222\351m\n\022\211D\261\"\024\371\264\200G\240|6\247(\237\273\273*\260\220\2635"
+	.string	"\320\243#\210\002\225\304\2370C$\362K\305\237.\270\200\204\013\034p\300A\fUD\2100\273\361\","
+	.string	"A\204\210"
+	.ascii	"\374Wq\236\247\n\273+h\260\273#\354\356\230\321h$\200\005\026"
+	.ascii	"XPbn\213\\\277x\327mD\r\336.\313e\267\254\340\006.\340\376\255"
+	.ascii	"\337\366-\337\356\255\336\346-\336\336\255\335j\331,\213e\257"
+	.ascii	"l\335\322\355\334\312\255\225\215[\270}[\267m[\266]\333*Ke\325"
+	.ascii	"6m\247,\332\236\255\331J\331\262\215\262d\013e\307Vl\303\026"
+	.ascii	"l\237\254\223m\262_3\254\220!\006\030\b0\200\027\\h\201\205\025"
+	.ascii	"\004\240B\n(\250H\201"
+	.string	"\342\204\023&\230(!"
+	.string	"$\214 B\b |\340A\007\034\324\224\330@\203\f"
+	.ascii	"@\002\203\021\306t\231\".X/\026T@A\b\232\031\231\230\"\fz\326"
+	.ascii	"\357\340\022n\341\032\356\227=\\\304M\334&#Y\247k,\207q\315\202"
+	.ascii	"\"\227"
+	.string	"\304\213\"\244\303\333\205K\223S\037\357\026\n\374`\023\324\343\r,\321\224\324\353\253\274^\300S(\307\337\034\257\337\234\\o\037\027B\276\234\304\237\261\275\033\272\2371\275\b$\261\345\321\240\031\351\300\253@\210\360\256\212Y\007\032\032\257\035\006MI\263\255HM\311\263^-M\242,\210D\260\210]\371\342SW\230E'\245\325;\347\305+ge\315\312G\223S\027o\034\327V/\234\0243\216\2635\035>\232\234\274x\337\226PU\275nY\274mW\274lWPV\275k\355\004\325[\005\213\023\025/\0255\343\031\223?\037MNS\274iR\355\304\025\251)\031\325;\205\002&Dh\020\350b;[B\3525K\342\225\262E\244,F\224\237\261(\024$\021!\023\224\203\222\244\243w\254\372\300\342\264\203W,\211\031\207\016!+\037MN;x\303\232w`t\206?h\373\304\203\267&Xv\370hr\n\342uR="
+	.string	"\302\240I\211\246\344\r4\256DM\311\240\336\257\020\314\375\214\3150H\264\202\213\230\f\265m\230\351\310Px\244\331F_:\206C\206a\210\331\004\360\302\003\030\342*Wf\244i\310\013\277P\337c\210\024\203\227\037-\215\343\257]"
+	.string	"\344\026\326\260X"
+	.string	"\342\353\025\372X"
+	.string	"Uf\315\f\215\005\251#F\372G\257U\330\343\024\032\220F\204B\265 \257\2420\327*\3508E\017\327\2707#MCt\214b)v\302\335\211%&\314(\3611Q\343\202~\306JH\236u"
+	.string	"\320\230\204FJ\351\021\314X\004$\027\265\274\005\021l\0322\343\020\022\273\032\204(\374\001\031{0\244\rQ\260i\210\214;\200\302\2449\250&\004\246\021\362\021\036^u\304\016+ N\344\017\260\360`\3225\365W\334\232bPz\232\343\301\255.\301\305\033T\030\035<\356\004\001\217\330o\331\032hq\006\214#Ja\""
+	.ascii	"*L\317\016\253\027\274\004\2521\237U\223\270b\f\370\270\266Y"
+	.ascii	"\031i\032\272\342\021|wSm\244\342\224\212\227\311\254(h\211j"
+	.ascii	"\021D\206\244\370\002\336\221\342\365R-@\"\221%\232\222^*\n\037"
+	.ascii	"\034\341\261\324\026\020\031\202\342\n`Xp\261\313ZS\260i\b\212"
+	.ascii	")\370\240iH\211C$\321 )\365L\020:\376\340\b\017\245\226a3\276"
+	.ascii	"@\2045+?h>\232\234\3708\246G\212\016\036\314\246!"
+	.string	"#.b\341QT=@\"\221|\204\207Q\303\374X\341\017\216\3600j\224\210O\031!\"\256\325\004%+>(\020\352\251#\2568\3651\034w\220\020O\037\220w\260\017y\t\251x\013CH\3425\214\302\373\005\215\367p\217\027\261\2177Q\213\267\331\\\314\310\020\262\230un\320\365\330(2\264\222\243,\261\211(\245,J3\021Q\356\315\r\207\215\303/YG2B\3118\27077(d\206A\230,Y\201\003\374S:2\212\363\343&\036U(?\001iblJ\356\245\3200,\220H\3446\220\320\020/\357\360.\r\221]F\300\256\017(\001g>>\341\246\332\266J\330\224\035\006-\274\250\363Fl\321[\201\034\2274\003-\n\225\350\270\334:v\355\221\311\261I3P\013g=6\222Y\305\325\035\341e1\342\312\215\201K\321%?\367h\234\340\252E\213Q\313\321%O\225K4\026V8\013\002\370\n*\b"
+	.string	"\253\n-\332\byO*\217\343[\212\274\252\243\3568\206\215\035\311\310P>U8\337\361I4e\226\322\270"
+	.string	"\325\372\271gs\202k\226,\"\262\034\325z\252\314*L\001\205\247\240\342(p\240k\226\357\036\315\216h\315@*\316Z\330\370fu\301\225\3136\037\2621p\025\240\\?\367(8\301\025\313\203vwQp\305rN|\262\307\323^\330\204] \223\005'p\305r\224\353\251\362\252\231B\247@\361\024'\034\305\333,\003}\342\273G*\3075\224\201N\270\007/\341'\316>p\311n\256\211\233p\366\t\274r\023\257r\273\033\204V\265\261h-\274\260{l\253?\307\267\024y\325\247\2043\026>\335\246\300\230j;\335\374~%\271\003\252$E\025\\\2712tX!\230\216\210\246\tg*\303@e\344\330d\212\f\003\255W\036\264\024\\\311O@\232\204\370\2207\273\355J\237]\355\320\024\317-m['\322\034\317\314\225H>\312\241\00187\3551\356\210G\271\022\273G\272\037\036\257`"
+	.ascii	"\205D\""
+	.string	"[\340s\357\345_\216Y\216vG\274f >\227\217x(\237\0018\323q\r\224\"\\zua6c\231(qu\314@\235F\224\271r7 VD\325\276\001\"0\025X\341\030\2467\035,;\320\023\214\312=h\327\004\025\211l\232\201\337\230\003\235tsW4\t#\234\204\006\364\356\221\357\350\327\f4\302\317\234RRC\243m?\n\036\271\350M%%\240w\217\205Gf3\020\332v\224l*H]R\003\3365t\212\250\256\007\225;\307=\260F\025\005y\377;\240\t\226\251\370\\\024y|V^?\224\317\304:\237s\313\031\320Vg\030\330s\235\345\246\334\317-1W.\255\340\212\037\262\\TC\364\364d\216\247\275\300\\\311V\270\213~\034f=\311\"\307\323^\266\310\273\206\212pT\355m\346\243\225\354\346\346\300\273\206\242^\027\341$z\246\360|\224\222\335D\257\334\235\253\353\271\016\272E\016\311\271\242C"
+	.string	"\341!\274\315\216_@xM\223\212C\301M&\365V\327s\235\213\315\255\325*>\201\374\334Y\273z\242\307\323^\002W\013\357\032\372\301;\360\333>]\222\335\\\017\376\301\217X\200\336=6k\3504\003y\360\223LjmEw\320S\343\207\203w"
+	.string	"C\357\326\b\252\221\243\031\210\203_P\212J]\362:\373B\237\215E\020\252\321cJ\235O\315=\350\271\316\226x\315y\203\223x\t\r\276\301Q\204\235\031\\\203\253@\004\3003`"
+	.ascii	"|F\t\006\027q\022#\216\301K\360\253\274k\250\361#~\202\\z\243"
+	.ascii	"\005\351e\226.x\210\213\260\340\027\274f\r\005Wp\013^B\030\005"
+	.ascii	"\257\300\003\n\016\263\244y\361!fN\363\f\020\233w\r\225\371\314"
+	.ascii	"K\370\305\\\246\030s\224\n\023\317u\026\346\177\361\374\343#"
+	.ascii	"\331\315E\017sT\356\004>\217>\2035\237\303d7\267\376\254\365"
+	.ascii	"\034\307\364\237\177\022w\272\271,ts\r \350n\r\243\032A\232\201"
+	.ascii	"\372gJ1\251\3439\301RZu=\327\331\024\272\007\177\006\371n\215"
+	.ascii	"\245\032B\232\201\226\341\270n1\365\\g\337l\362\256\241\374\036"
+	.ascii	"\374\366OQ\262\233\233\242+\327P\242\2735\236jD5\003\361\317"
+	.ascii	"\224BbBs\034\303\325\250r\001\n\211D2\320n\215\253\032F\232\201"
+	.ascii	"P\2573\034\033\323\244\226\352x\256\263-\310l\306\fH+b\030\250"
+	.ascii	"\323\210\273_\311+\001\002,\210\261\023X\231\341\345\246\021"
+	.ascii	"qv\344\f\035\177\324\330bF^\271\273o\302\313B\247\021\227Yf\311"
+	.ascii	"e\203u\256t\262\177\262\177\257R\347\301\r&\373\257\302\030\033"
+	.ascii	"\206\\\373\256\375\353\271>\301\345^k\377.\246E\t\211\261\366"
+	.ascii	"K\376\316>$\373$[\315/\256,$\323\213\354\215\360\020\033_\\Y"
+	.ascii	"\267\332?\023\302\334\210\370\006\235\332Sq\020\031\024\256"
+	.ascii	",$\023\324>j\377\372\360\260G\271'\262\177\235\230\245\204\304"
+	.string	"<M{\247\375\353B-JH\234\\\3323\355\037\f\211\211H\373\244\375\203\201\260\b\321h\177\264\177\2373TB:$\332\003\331\277\236cRB2\354\261\367\261\177)\314\006y\354\205\366/E\230[`\216\275\016\300\263\"H\246\003\355\203\374\342r\024\371\331\333\350C3\344\312:\317\276\207\257y\235\375\316\336\231\230\270\335\334\277\306\323\242\204\244\367e\373p\377N\034\026\345\031n3\361\332\272\212 \231\006\267\t\357\326\346\212l\331\346\262\177&\210\331A\271qe\001n\007\356\337\013\017\225\220\352\372\266\375\346\346\276\364\266\367\366/\206\302\"+w\333xp\314(E\220LY\266\265L)\324*\202d\252\333\276\202\3265En{n\377\006\360Wd\006\267\035\267\177?\243*k\333v\023\353\201\321\n\344\312\252\262\275\266\177G\343RB\372J\333V\333?\024Z\212d8\333F\203\201\231\220rQE\312\266\245\354_\221"
+	.string	"\334s\302M\341\312B2A\331&\333\277\243\365\265\020\266-\266\177M\330E\ti\005'\333O\366\357hT*0\331\376\332\277\027\bO\340\332\356\332\277\213\035\232\260\334\326\332?\024rE$`m/\331\277\036L\002\002\222\355$\373\327rTJH2|\203\362\331@H$\022\2114adw\377\212H\244\016+m\316\356\037\367\304"
+	.ascii	"\031re!\231\220&\370<\201\334\204\224\217\035JH\276N\334\375"
+	.ascii	"JrE\"\221\310\276r\227+\022\211D\356\207\354\362\036o1\311y\274"
+	.ascii	"E\235\016\342-\"[\007/\314\227.\342\205\221\353&^\030\266V\342"
+	.ascii	"\205i\362^\230# \364\302D\215\320\013\363\224\366\302(\337\213"
+	.ascii	"\3121\025^\264\215\327xQ5n\343E\275\370\n/\312\305YxQ-\266\343"
+	.ascii	"E\2270\"/\232\244wxQ\253\346\341E\203\264\017/z\243o\360\242"
+	.ascii	"=\334\307\213&7\350=\273\274\367\334\262A\357\031\370\336\263"
+	.ascii	"\257\251xO\275\246\342=\363\270\311{\272\211\320{\2465\022\357"
+	.ascii	"i\326B\274'X\373\340=\277\372\007\357\351\305]x\317e?\361\236"
+	.ascii	"P\255\344=\237:\212\367T~\320{&\261\023\3463\210\007\275\247"
+	.ascii	"\021\t\275g\021{1\237@:\350=\211X\noe6\025o5\354(\336Z\330O\274"
+	.ascii	"\225\260\225\274u\260\225\274\265K7\361V.\255\304[\2674\022o"
+	.ascii	"\025\354\"\336\032\330B\274\025\260\203x\353_\337\340\255~\355"
+	.ascii	"\303[\373\232\207\267\362\365\016o\335\343&o\325cD\336\232\307"
+	.ascii	"]x+\036\367\361\326;\336\343\255vl\307[\265p\026\336\232\205"
+	.ascii	"\257\360V,<\307[\2570\030o\255\333\336J\367\336:g\354\255r\357"
+	.ascii	"\255V\322\336\032\367\336\n\227\366\326\267\367V\267\264\267"
+	.ascii	"\266\275\267\262\245\275u\355\275\265J\332[\251\274\267\252\031"
+	.ascii	"{k\332\366\326)\357\255h\333[\317\336[\315H\350\255R\336[\313"
+	.ascii	"\322\336\032\345\275\225,\355\255P\336[\307\322\336*\366\336"
+	.ascii	"\032\226\366V\260\232\336\372\344\275\325I\332[\233h\320[\277"
+	.ascii	"jz+\223\367V\257\264\267v\325\364V\256\367\326\255\264\267j\325"
+	.ascii	"\364\326\345{kV\332[\227\324\364V\254\367V%ioMR\323[\221\274"
+	.ascii	"\267\036I{\253\221\232\336Z\344\275\365*\355\255V5\275\265\352"
+	.ascii	"\275\225*\355\255S5\275U\352\2755*\355\255P5\275\365\351\275"
+	.ascii	"\225H\332[\2255\275u\310{\253S\332[\233jz\253\220\367V&co]\252"
+	.ascii	"\351\255J\357\255I\306\336\212T\323[\203\274\267\036\031{\253"
+	.ascii	"QMo-zo\005\222\366V\242\232\336\372\343\275\325G\332[{\324\364"
+	.ascii	"\326\241\367V\241\264\267\362\250\351\255;\336[u\244\2755GMo"
+	.ascii	"\305\361\336\032\224\366V\240\232\336z\343\275\325F\332[\177"
+	.ascii	"jz\253\317{k\217\261\267\362\324\364\326\344{\353\216\261\267"
+	.ascii	"\352\324\364V\344{\337L{\237X\323{\304\367\376\320\330\373/5"
+	.ascii	"\275\367\362\3363\215\2757\254\351}\341{O\230\366~\260\246\367"
+	.ascii	"]\336{.i\357\267\324\364^\360\275\0174\366\036\260\246\367\177"
+	.ascii	"\357\275\237\261\367}5\275\347{\357\367\214\275\327{\357\363"
+	.ascii	"\214\275\307{\357\357\322\336\333\325\364^\313{\237\305\330{"
+	.ascii	",5\275\277\362\336\327\245\275\247{\357\347\322\336\313\275\367"
+	.ascii	"V\214\275\217{\357\341\214\275\177{\357\335\322\336\267\275\367"
+	.ascii	"li\357\327jz_\345\275\247b\354\275\332{\237f\354\375\224\367"
+	.ascii	"\036\315\330\373\263\232\336\233\275\367R\214\275/\253\351}\224"
+	.ascii	"\367\236\314\330{(\357\375\230\261\367b\357}\230\261\367`5\275"
+	.ascii	"\177\362\336;1\366\276IM\357\277\336{&i\357\275\214\275\357z"
+	.ascii	"\357\271\322\336o\275\367Zi\357\227\357}\226\261\367KH\364\036"
+	.ascii	"\353\275Wb\354}\222\367\036I\332\373#\357\275\221\264\367E\336"
+	.ascii	"\373\253\264\367V\357}U\332{\252\367~\312\330{\251\367>\312\330"
+	.ascii	"{\250\367\376)\355=\221\367^\231\366~\310{\357\224\366\276\351"
+	.ascii	"\275\027\222\366\236\351\275_J{\257\364\336'\245\275Gz\357\203"
+	.ascii	"\214\320\373\243\367\336(\355}Q+y\017\344\275'J{\377\343\275"
+	.ascii	"\367a\354}\217\367~(\355\275\320{\317#\355\375\216\367^G\332"
+	.ascii	"\373\034\357=\016c\357\203\336{ c\357o\274\3676\214\275\377y"
+	.ascii	"\357}\214"
+	.string	"\275\357y\357y\322\336'\337\373\235\264\367:\357=2\355\355\346{;\361\275\215\230\366\366\341{\373\313{\333K\332\333L\021z\333\360\275]\230\3666\341{{p\203\336\356\362\336\346\"BooI{[\360\275\035\270\275\r(Bo\377\205\320\333~\357\355\276\355m>\021z{\357\275\255\227\366v\336{\033/\355\355\273\367\006o%\247\"\322\2152H'\235\225\262\2720\033\251\203\274\221\316f7O\305\242\"Q\021\310M\324\324MU\025\312g\007Q\312\352\262\354\255\005\\\271{d\364>*z\033]\025{\f\t\361(:\212\225\345\327@\210\336@\316?\336Dg#\305\034\307$6\273AR\304q\243\204\305\366fI1\350f\271\002\324\026o\024\201n\266\272n\2300A\371\354\037G\"\226\247\324\345\225\305\313\242\206+w\006\210\206\323\354\347Q\002Np\025\024|\373\370\001\272\307\333G\361\247\307k\242\212v\272\251"
+	.string	"\301\237f\307\340\307F\233\217RrH\350=\304SL6\021:ce\215-y\354x\363(\"\233Ov\234\275\262\304\230:t\034~\t\273)\313q\316\312\022[\252\3554\216\016z\3438\333!\301\030\302(\302\020\302\024\336\214\221\335\224\225\241|v\320;\211O\254\2540\246\032\r@7\336@\\\314n\\\205,\260+6\201E(\001mC\360m\203\271\006\355\237\267  \f\264\033.?\347\243\253D\246O\317\333\247y\336=|0}7i7T\250\240|6\317U$\032\025\355t3\271\363N\302\340\301\344\035\345\326n\332\332P>{\347*\\!2\213\236,k2!\300"
+	.ascii	"\214\370\r\020)\300\2410\243\2618\3010G\036\244\243\363\006\243"
+	.ascii	"%K#\317CW\205\314f\342\271\031\007Sw\224\243K|\314P3K\251\213"
+	.ascii	"K\031\342\024f\340\2217\227\003\030`G\263Y\200+\267F\022\037"
+	.ascii	"\236\321\254\360\264\227}\035\363\341\031\361\325\317G+)\007"
+	.ascii	"\003w\223%\206\267\033\274\026\334\016\317[\256\b\231_\274\234"
+	.ascii	"\277\320\301\254U\241\342\205pYC3\323\360\314\274\0023\345&\013"
+	.ascii	"\t7v0h7x\"\344\235\031\236\217\256\006\013\t\317\205z0"
+	.string	"e0\2120d0Qn\370n\374n"
+	.ascii	"\001Q>\231\360\314\343jp\020Fy\036\254A\271\313a\2240`0a0\226"
+	.ascii	"\251\366F\360\206\313\r\027\224O\356rF\272\352\302,B\262\t&i"
+	.ascii	"u,\256\334\345\262\345\314e\020\246\311\327\026\246\227`\340"
+	.ascii	"Y\260\020\246\353\230\344\n\374\003l\2773\340\022\345\277\267"
+	.ascii	"\037\023&\353\346\313\222?\277\245\037L\324\331o\013\345\276"
+	.ascii	"\303D\335 \302 \271i\036\351c\362%\235\371\272P\336\373\231\244"
+	.ascii	"\003c\205\223\254\332;\037]\365-\365\214\316zg3\276\300\254\006"
+	.ascii	"\023\224\363~\032\365\300D\341\374<\301@\341\334\b\302\311\221"
+	.ascii	"\003\345\223\363\316flB-\221K\251k\310\fW\356\342\335\235\361"
+	.ascii	"\354\316w\347\021\263\226\263\335\016\230!\307\244&\030'\034"
+	.ascii	"\241\0368?~hIrU\345\211\227\305\212+w\223\324\365\\\307\253\210"
+	.ascii	"\263\034\3139"
+	.string	"\013\020\230\244c\022\t\313Y\351\n\354J\335\371\312\331\214\353\376\264\255f]\362:tsg:#\030 Ds\211K9+g\271 0=\206\254\234\213X!2\275\342\340\316qg\263$\230\0358K09`t\340\bq\302Q*Q>\031\316\nq\351%\204\227\205\f0\300\310\375\224\n\342\004\327@\016\002\337F\375\204I\\R\f\201\207\221{\0331\005\302\374\n}\224\222on\347\267'\030\033I~|\334\230ml\347\266(\230d\021\230\035\030\035\2663\222\025\341\322kg\255\312y-\021\221\352\360K\025&\025\2653\025\303c2E\336\024Z\210\023\026\203\245\020\212pP\355\254e5\270L\233rN\253B\267\034\2231X\n\207 \355\006\241\204\n\342\\\235\204\240\035Y\024 \032\210c\004\t\216\222%(\237<\345\214d\325\345\210/\320\333J\353\245\317\322\017\030\006p\202\375\224z\341\004W@t\215+\340\231"
+	.string	"\200?\301\336CL\201\260>:\037\245$\332\331\031\215OF\342\331Y\311\252\217iv\022\235\315\336D|A\223\013\200\262\224\237DK\024\017g+f\210\260\356\316NJ_Y\224s\031\026 vp\312\212Q\316CVxL\262\257sR\027J\207\263V\301\016a\326\234\034\3319\320\no\t\345\364\202#LR\264\033\004\023\372\346\006\345Mt\307\034"
+	.string	"\272\266\325\343J\266\204\352t\032\361\205\026\212\310\237R@\234\340\372\367\240]C\353\337\033G\234\223 ?\027\376^D\276q0\005\302\366\n}\224\222cb\3471&\250ZZ\340\0244\261s\021\253\2710\260sX\023T\3121y\002\324\342<A\313p\302b\206\006\373\224\270\242\220\201\235\213X\3111\275v\23689?\031C\305\216\311\230\241\301\27400'\347!+\271\245\327N\223\257s\223\263\037\016\031\332\004\375\362\301\006NY\361\006\224O\376:\017YYaz\27553\371.\016\032NZ3\020\314\227\263\020\023\016\025\264\013g-D\323`]\013\355\006\321\204r\341\264\325\021\202\204?\200\250\026\272\205\363\206\023\207#G\207\362\311L\336;\370\254bee\231f\003\315\256\205\023Xk\255\256\307L\213\n\013W\356\f\234"
+	.string	"\320\236\303H\035\027\347\nN\226\016\240\220H\037\006\252~\017:^\241\354\365\003\240J\202\030r\274*.\267@\371d\2577\020\217\b\013:Z\201\253\337\321\236\223P\352\341\371$Ivq\235\273\274\316\\o \216@\230\036\340O\242"
+	.string	"\256\334\231\275\024\320\033?\245rNp\355{\343\332\367\376Y\321v\324T\241\357\350\215\223\b\313\303\363QJni\235\267\354\320+\253*\034ZSKf\326\222s\026\036\n\365Dd\bGPE\336\222!Xg/\2531%I\316J\316~z\250\020\030.\344m\020DP&\034\276\026\240\026\307\017]\302\001D\225r\212p\004U$"
+	.ascii	"\345\223\223\334\005=/4\b\212\224\200e\252\305\341\2023\2103"
+	.ascii	"\210\362\311H\336?|zY\2111\213VH\232+L\341\312\335#F\316G\n\321"
+	.ascii	"\"\245\034\241\242\221\307x\021\0259\263U5\257\254\316Wh\217"
+	.ascii	"\241!V<\252\022\227TSg*\024h\016\034RS@R\314(\250s\024\372s\224"
+	.ascii	"c0(\034&\352\203\363\245H\216P\013PPg\260(5\224\347\351\354V"
+	.ascii	"\205HDy&\202\203\210\352`)\233C\n\235\232\316N8\315\363\220+"
+	.ascii	"G\250\330\364\030//B\n\227LKg\246BB'K]\224\006\231IG:'\235\202"
+	.ascii	"\201P\220\376\202\f.\217\214\316G|{gF_\021\225W\304,\332\001"
+	.ascii	"Bt\006r6\273\332i\247\245J\216\020\013yD\227AO\r\313\2173[U\227"
+	.ascii	"e\021\373\350q\366q6\3239\351\216rp=\344\206\316nU\200L!\036"
+	.ascii	"g\241\344\tW\307\303m\007\340RG\216\263\216\236s\355.\007\025"
+	.ascii	"\034g\266\252?f\321N\020\3209\350l\366sN\351\312\351\313\021"
+	.ascii	"*\002=\306\353\354\006[\325\337\262\b\205+7F*\005\032\344\247"
+	.ascii	"\024\212\023\\\371\370\316[T\360\035\rr\021arh>JI\033?g\033g"
+	.ascii	"?\250\263\f\306\fP7\316([r\204\\\370\371\fQP|\336=|\316U\371"
+	.ascii	"-\213v\272\231\342\312\335\036\236sO\030\f\031\362\202N0C\346"
+	.ascii	"\271\fzN8yf\253\352[\026\361\016\353\234w\316f'\234L`\254\310"
+	.ascii	"\311qz\345\354(v\345$\346"
+	.string	"\b\261\220\207D\"\025\200\362\311:_\021\245vj\235[\nX\246\332\234\0369?~\240|2\362\314V\205\307,\302\301&\226$\241\250q|\r \347\222cR\311\211\225c\024$')\t\345\363x>\252\262[\342#\007\3479g\263\237\304\235\245\323\3101yu\026\311\021\342\224\243T\242|\342\024\251\3222\205\227\305\t\235x\363N|:\251\246n\230g\237\315\317\276\250\023\352\311\346\214U5\367\305\214+\222Ca\032\357/S\347\220\234\252\"\022\311\323\302\236M\247S\316U\216\221\034$9HP>i\234\315\370\304\252\222cf\361\2628QCW/L\206%\327Q\330\004\326\232\t3N\360\031A\374\004\254\354\335\234%9\313f\240 \3767\254e]\022\b\031\007\202\233\272r\2304\003\311\370\337\260\226n\260\t\254 &b\374\207\307\200\361\037\3162\234\001\352\303a\234\315|\264\222MN\243\233\024E9d$"
+	.string	"\361\341\234U\025\266|\321\303_\270x\017ON\037=\206\\\360`\202\363p6+\301M\020v\356\270A\2213v\352\310!\033!\357\304q\346\310)3\313ACC\371,\3019I\025\330\362>H\232%\\\271\025h\221\200Z\375\224\3029\301uo\357;\234\377t\370\016\347\264\023\bF\361\264q\336\310\241\262\226\323\326\206\362\251\303;\311\\\245\347\265\323\315"
+	.string	"\354\035\265:\007vhm9\220\3409\2648\t\316R'\317\315\271s&s\336\342r\344\344P>[\274\223lB\r\257O\251\213\204+7D\024\021N\267\237^B\250\204\\\365\036\244w\034\336M7\034\207\363\r\347\037L\311\353\364\b\225\013W\275\237no$\237nTfO\360\304\224\222\335\204\253\353\271\216\033[]\317\tFR\245\256\347:H\324\352z\226k"
+	.ascii	"A[\207YGY\022\222\031\330s\235*\302\bl\370\b\3169t6\374iG\224"
+	.ascii	"\\\352\b\222\020\256\334\230\275\017\320$?\275\334,'\262L\023"
+	.ascii	"\b\314%\2405\357h\222\247aL\320z\354\203\024Z\004\017\301E\300"
+	.ascii	";\032\004\337\315\311\222c\327\f\024\002\253\032\270h\305\372"
+	.ascii	"W\001s\360"
+	.string	"r\364r\370r\370P>A\360#\025\330R\255\004R\357\307\203\022~$\036*!\337t\305\254\353\271\316\271_IvA\212\020\223\016\256\254{\374\2017!\337h\017|7\0070G\260\031\350\003g\227{\340\234\310\030\230\375$\346\375\354\362m\240-;\335\254\373\225\344\027t\324tpp\345\326@;pn\312\341\322\201s\"\213H\273*\254K^\247\346\312\215\361\262\301\271\374)\305\310\023\\\361\252\023W\274\363 \033\201\273\221W\002\357\347\362\251]\027\236\217R\222\003\0338\007\006\353\035\025\242\235\226\r05\220\201k"
+	.string	"\003\317@a\275\002uXG\207\201\301\013X\340\027\250\300-\300\254V\350\206|\211\203\253@\027\nL\340\024\370R\333\350\230\274\260\255M\240\213\004\"p\t@\340\0218#V\265\343\217\020Ms\207\314\264)\020`>\300\001\177@N\263\232\031\032J)s\300\271\312\024`\003\030\360\006\234\375t*\224c2D\323\\\227\302\335 \212\324\261c\317I\\\261\013\253b\307\237\033\307\240\034(\237\f8\017\362Ye\352\217\311\254n\203+7\346(\0034\371S\252\306\t\256w\017\302\343zw\366\343\230\277\365\301:\323\340\356h\362\"\224\\h5\364\002`\330\343\216\332\344\305\214\332\034W\227/&\0138kM\3411kP\300k\240\341\n\020\252\\Y\\\266\264h8gM\341-\275v\022\200\200'\340"
+	.string	"G@\217\272\344\370c\306\311\\\222-XJ\016p\316\232\272c\032\240"
+	.string	"7"
+	.string	"\213\027"
+	.string	"H=RD\320H\021\026w\313\031V|\006\031\276\302\250VQ\005RM\311p\326\232\262cz\355tsS\350\030`x\f\0048\f\347c\220\nuL\232Q\233\203R\342B\"yZ`\300\335 \216\324\247\343Rw \344pl\213\013\211D\276\240\254D\216B\234\216\312'\224O\002\234\375\370\324\232\262[zQ\221\342E,\203\027\332\202\263\332t\254\342"
+	.string	"\n\211\334a\240\255LU\3101j\352XUEf\205\330\205\314f\314QV_\352t\032\021"
+	.string	"W\356\214\026\006\305\344\317\275\021'\270\332=H\347\325\356\234\370\304\nO{\341\271D<?\022v/&\217\201\235V\241\217Rr"
+	.string	"/|"
+	.string	".\374\205$\025\351x\325B\036\022\311c\244\0069.U\344!\221<F\365\350\210\244\013\345\323\205\253C\212\031?\250\230\361C\272:\244\210!\243\207\026.d\304"
+	.string	"\242\0048\330\320\301\352\220\"F\013\034^\270\b\301\r?\250\270!\203\325!E\214\027A\374\320\"\206\212\rV\207\0241t\220a\203\013\025=\274p\341\342\305\r\032\310\350\241\205\213\036r\330\201\207\002\274\370\201F\016!d\364"
+	.string	"\304\213\033\316\031/\f\200C\013\023\364\260\003\01713^\214\3407p\017-\034\320\302\205\r=\300\354\300-x\260\341\206\030'\016/\036 C\207\034v\340\201\004\025\304\220\261\203\001r\260\201\007\022\024e\364"
+	.string	"\304\213\003\264\220Ac\00411r\260\201\007\032Z\3600\002\033b\354\200\200\034z\330\301\305\0176\210\220\321\242\0021\026\320\302\305\016\026h!\303\006\004\334 \343\007\013d\340\3208\364`\203\013\027/\016\200C\013\031?\274\360\301\007 b\364"
+	.string	"\204\b\0311p\270\004*\360"
+	.string	"\034\\\334\200\356\r)|\210\341B\205\0171\\\250\350a\007\033\\\250\270\341\207\030*R\214\330\027>\264\370A\205\214\027/~P1\263\273\373\265\303\037\262\034\306E-k6~\320b\324=f3\216\021\024\312\372A\373\201\271\006Z\353*\335\007\300\264\363\344\326\272W\272s\030\233"
+	.ascii	"E.\2117v\264\323l6o\310\370\020[\240RW\240\223n\016\212=\321"
+	.ascii	"\211\301Q\272\b\263\031\263T\023]\235N#\376\020\243\255`\\\271"
+	.ascii	";'\367:\327\244\257\216rr\347#(U\230V\342^\255<\211\253\262\204"
+	.ascii	"{{\205\013{c\272\265\275\272\215\265\241-\331\326^\331\310\326"
+	.ascii	"\230^U\250\274V)\353+\030T\316EP\252ZM{U{\3170\353\253\232v>"
+	.ascii	"\202b\346\303\225S\316M]\244\257\246\274\257XD\224&%u<lB\323"
+	.ascii	"R\235N#\276\270r;\330\321\374sQy\330\210\326\264\342!\246\nW"
+	.ascii	"\346\203\320\230\257hG\243l\320\365p\245\213\017\251g\377\341"
+	.ascii	"\311\236[\363\031\227\315H+\316\2402c\255\031\250\236\235\365"
+	.ascii	"\232_\352x\212^\315\316f\034\203\004\255R~\026\205X\n\3014\243"
+	.ascii	"m\231jg\274\315\210\213C\371\254R\256\002\223Cf\321\021n\264"
+	.ascii	"&\222\031\310CY\215\362Z6C.\004R\210 Q\316G\230\2301\311\240"
+	.ascii	"\274\222\321\205(\nA\024\002\310\214+;#\313\f\273\031v(\237\025"
+	.ascii	"\312\031\213I\035\253b\257c3\360B\364\270\021b\250\212y1\001"
+	.ascii	"\373\343ea\202+w\303\300^\303\364B\354\b\302\020,D\216'\211K"
+	.ascii	"'M^\235\324\257\327&g\276\020@3\374\220_!l0A\364\352z\365\002"
+	.ascii	"\f\321\343\323\025\"\311\205\270\245\365\272%\030\002\211C+q"
+	.ascii	"y\306\362\"df-y\315\342B\363eh\311c\274\230X\200J\222\274*\231"
+	.ascii	"1HCX\224\244\013\222\317 !\354\242\324u\304\310\353\221B\032"
+	.ascii	"A%#\217\361\002,rwe\365z\305\244\351\033\202#X\264z\214\327^"
+	.ascii	"\025\223\252N\275R\321\340\335IMi\221\262[FU\250\327(\232+uE"
+	.ascii	"\240\346\236\230E\225HU\276\022\241\211\203\301\002\324\316\370"
+	.ascii	"B\003\227\263\003\013G\020E\236\362,D\251\271\r\321\342\324\364"
+	.ascii	"\3524\003\221f\215\013G\260\330\364\030*B\316X^tK\246\245W\246"
+	.ascii	")G9\031h\320\316\234,]\006)Js\313$\244\327$\262\243\334\n(\024"
+	.ascii	"4P\306\240 }ETX\020\346\221\321\353\321\214&\215\223\243\234"
+	.ascii	"\f'\3204\301\341[!\217\346\353\004g8\202)\240\214.\203\236W\321"
+	.ascii	"9\313K\016\b\321+\020\035\232\255*D\313\037mK\037=^}$i\260\340"
+	.ascii	"z$\031\252\302\024\342\361*\324Cc\244\216\307\325\2163\0359^"
+	.ascii	"u\374\320P\335\345\220\3021\026\004\364\032t\203\346\tF\037\220"
+	.ascii	"\362\306\031\313K\314\013Q\265\361\363j#\210F\b\214\023l\251"
+	.ascii	"?4K\325\347\214\345\025\346e\250\256\366T\236\327\236\0344A\216"
+	.ascii	"r'0\254<4F5y\316\362\002[\326\235\252\363\272\263\203\206\350"
+	.ascii	"\004\211U\207\306GE6O\0246\237\3707\205hx\300\340I\244\321\201"
+	.ascii	"x\306\352Jd\026\035~\371\017{\320\004\001}\241\271\341\345\234"
+	.ascii	"\325\225\270d\336\360g\376\240\3619\312\3610\244\341)<gu!v\331"
+	.ascii	"\022XH8\370\023\002\231A\204A4\370\245\313\031\253\253\220\313"
+	.ascii	"\267\374\\\214f\fa m!\024<cu\0212\213v\272\351\306VXH\205\217"
+	.ascii	"M\024\246\325\225\340\312\335\254B\244\302\243\304\272\236\353"
+	.ascii	"\020\036\326\365\\\307K]\317u*X\362\025\b\370\007\006\231\311"
+	.ascii	";\3125\001\336\375\235\263\272\320\226~}\277_\322L\226\243\034"
+	.ascii	"T\337\025\276sV\327\031\263hO\357\337[\232\231\223\323;\313\303"
+	.ascii	"\373\363\204\314\300\275\341\235\225\272\314\356\354\376;\247"
+	.ascii	"\0316\030XvU\264\234\261\272\2440\213\262`\371\263(g\322\216"
+	.ascii	"r\\X\320\256\234\263\272\306\230Eut\177\335\323\214\2242\272"
+	.ascii	"3R\327\330\234\334?\0275\003eL\356\214\324%\306\364\262\022\367"
+	.ascii	"[\231\232\001{\022wV\352\022[\302\275\375p_L\336\316J]a\204>"
+	.ascii	"\352z\256\343\326\366\273U\315l\035\223Z"
+	.ascii	"mg\244.0\246\027\333\332\317v5\263\004\006\333\232\222*g\254"
+	.ascii	".\260e\021\025\265\237\212\221\231#F\324\322\246\374iHf\254\252"
+	.ascii	"\2464\321\316~4%3RZ\316\240\314\022\245\224\375R\226\314(\367"
+	.ascii	"\312\234\242\234\263\270\022\227EdP~\262\345\f\323\022\024\246"
+	.ascii	"\327\230\330?\2665\203\024D\354\254\304\205\270\364\n\003\373"
+	.ascii	"\303\272f\212\f\301\210\236\334\311\233\374Nh0\231\351\201*\315"
+	.ascii	"H\304\021|\223\307\314\b\375\353\234\305u\270dr\257\237\311\273"
+	.ascii	"~\257&3:p\226r\274\013\211\253\220\231\307\313b\207\031x\327"
+	.ascii	"P\266\272\236\353pm\375\\Ofl\314\370\314\374\320\b\033\243AF"
+	.ascii	"\206\362\371\255s\021\256\301\245\326\362\327*\233I\316\354,"
+	.ascii	"\317H\\]\262\276\344\317:\326\277\344l&\323<&%b1\225"
+	.string	"$\371\225\240\311|\301Y\362\222\344\254\304\005\270Dr\344G\222&SHx\204i\244\310o\204\212\f\227-E\316H\\\177WV\377\025\340\237\325\031\211\313\217YE\365W\255\311\360\355\351Q\235\263\270\374Np9R\327s\235)\251\177\212F\233\214\235\026\251s\021\256\276(\250?\352M\346\n\316R\212\274:\032WN\200\242\203:kq\3411\237\210\374Oq2V\342\340\210\340-\225C~\245\234L\3331\231\002\212\006\235\f\033\215+\001\200\311!\2636\344\234\305u\347\324\364;\321\310\"\2436E&\215\206\035\r<\032z4\364\232\316G\\wK.@\332\216\313\217:\235F\324\341\312\255@\350\216\004\247\336k\320\204\224Z\234y\257\206\017Z!L\277\020)eL\314%\245\177\t\312\030\215\301\342\225\316Z\\V\222\220\376$\260'G:#q\2651\037\004\346\351\017\362\256R\202\376\3500O\007\352]\032~4"
+	.string	"\233\201~\364\247m\211\253K^\307\250\3507\242!(\323uL\312p\025\235\217p\241m!\252\206?\321\321'2\274\034\262\260d\226\254\336\203\340\032[\222\200\006\027\231$Gd\220\320\030\\\001\n\211D\322(\244\301\244\200i|A\371<\363\036\004\027X\213+\027&\220\377\343\327[\032\2102E\254d\256h4ul\222\311\037\357*\256^\266\232J8\\\271\353\243\307\357\243GfJ\252\307\031k\353p9$\364\017\375\310<\021\021b\362\330\361\363\270!\343\324\264\343\234\265U\250\3439~\035A2K\307d\222\214\222M\216\0356BB9\262\266\b\203\360\262\270\341\312]\034A?\216\0362GFAL\240\033?\320\017\031\242\037\277q\306\332\352b\343\347\267\001Df\bg\211\207\214\220\215Q\020\233\244$\224\317\377l\0012\213xY\214`\tp\t\035\233"
+	.string	"TRg\303}z~\037!28p\226\202\336s\306\332\322r\236'\177\036\033\247'\377\264\277\277\303\272\357\\\347\337Q\312\364\310$exl\236\242l\246\246P>\257sN\2625\307\254c\023\177\203u:\215(\202\326k\233+\033#\177tlg\203!\370\300\251\374)\265\201\023\\\013\013AP\370Sy\021ORc\0378\262\371#\023\021\017\2774\021\017\337\210\206\205\204\203\207V\2740\337^\266\b\006\0022\333\n\t\337\205}|{zMx6\324j\353.w/V\344\331i\311\322\205\355Lk\251\230)\356-?\323\352l\302V\320\315\311ma\363@\007"
+	.string	"\377"
+	.string	"\341x\304\274\345\271\331\224\271"
+	.string	"\325\366\367\226b\032\220\264\252p\340\312\335\252\201:\370\003yP\337\201\274\373\336D\230\206\247\250\346\006\256\334\230\243\f\234Po(\346\037:\250X\261\316\t\256\204\017\332\232\201\332\345M\204\331\307\031\025%\326Y\206\201\326A\3027\024\007"
+	.string	"I\025>\r\\\271\r\305\fD\007\2253\f\234O\337z\201:\370\332\345A\204?\241.\342)\252-\003<\\\007\177>}f,\n\017\003|{|\257@\232M\030\213\345\r\305L\261\031\3430(4\233\262\026\362\316\366\336PL\303\221\226\331\005*"
+	.ascii	"\303\366S\352\004'\270r\341\362v\342\230?\013p9\f\333E<-\341"
+	.ascii	"U\340\312]\275\274\267\036\222\230(dP\306\362\230xwo<%1`O\234"
+	.ascii	"4\271\023[\332iy\333-\211\361\352\342\332\322\222\005\313;\313"
+	.ascii	"\331o\031\223uL\256\200Zb3\026C\036\226MY\n(%X\316\206Za\313"
+	.ascii	"+\201\357+o\247\022\320\256\373\031\270\025c\344\305\212\274"
+	.ascii	"\"6c2@]\331\224\245\310\263\252;{\321\002c\032\266\323\022\264"
+	.ascii	"\351\336\206R6a+\242l\306b\200\262)K\361Dw6\324\002[R\240*!\337"
+	.ascii	"\304&\356\272\234&\320s\347\246'{W\272\345\276k\303\304\246I"
+	.ascii	"3P\317\375\0026Ob\206\330\204\361\030\024\022\311S\024\343d3"
+	.ascii	"\306ayH$\217\rYL\223M\231\0131L1Bl\314\320l\322\322P>[\356\355"
+	.ascii	"\3044 -\023\231\0228\036o\214\222\r\225\230$\233\265\030\274"
+	.ascii	"@*\021\260\022\367\266\322\026c\024S\024\267l\302\313\002\002"
+	.ascii	"\016\200i\362Sj\306\t\256[\266\274\341\340b\210b~\274\275\227"
+	.ascii	"\036\260\3450M\316\001^\022\240[\333\333\355\354w\376\261\275"
+	.ascii	"\3332X{\263Uy\257\275\332\275\305\3548&\371\202,g\207M:rt\225"
+	.ascii	"\243HK@fS\241b\023\027\003tLV\320\343\314P\310n\020G17l\344\352"
+	.ascii	"\b\301A2\275\230\237\030\0336tWl\262\330\251\275\227\370\334"
+	.ascii	"\262\004t\300\225\273iS\336ix1<1\311)}hgo4\275\030$\316R\363"
+	.ascii	"\354\214\265\354[\232Iy\233\361\025\017\217\311/R\316I\226x\314"
+	.ascii	"\262(\3572\277\242!\316Ra\2243\326\022oI\006\345M\006X\354\302"
+	.ascii	"\005\3129\311\362\2169&\366\036\263\021,\006\376\025\001m\270"
+	.ascii	"\330\f\332\024\332\024\212%Y\336-\337\032p\345nX\230\r\263\310"
+	.ascii	"\267\007FG\301\022\246'N\336O\276\024\357\354\2340\233|\275\233"
+	.ascii	" \026\261\\\371B["
+	.string	"2\361z3\261i\026\347\344\274\230]\\\357.\235\"\334\033\327\331rK\353\275\225,\262\255i\231-\263\336\313\236\242ZZ\326\222%?\305\263c\322\f\353\\\264\224\202T\327s\235\273\243\272\236\353\334\025\325\365\\GI\222\267\022\230<$\357$g\031>\312\241}\344\215\344\354s$\331\315m#\357#\007\200\337\215b\030\230\221\363QVsY\344\352]$\250\330\344\353\212iU\365\266\312Q\354:&\271\252\316EY\211K\252\2517\325\216\3422kJ*\352-%TT\202\263\224$\352|\224\205\270\204zzC\365(\0329&\213<\235\213\262\016\231D\210\374(VQ)\017\227C\234\336C\200\024\243\240\234\232\204\274\233\214\212J\234\245!B\316GY\205K&\246 E!KE\246\233\244\245\033!B\226\212\262\b\231^\f\270rW))\212\336\250T\343V\t\314N\350B-LA\205\024\252\201\206\001$\323\031"
+	.string	"\b\006\3424\217c\b\357\024\200\017HlFzhH\037\023\303@\203\0015\331\300\f"
+	.string	"&\t\343\005\326\006\241y\265\332\034\303\\+\372\252E\345\2570f\375<MzZE\242w\376&\311$\0353\022\257|\317\025"
+	.ascii	"\271h}\360\361*4Y\250P\003:\245\3638\2646\264@s\215\032A-\254"
+	.ascii	"\312\372\262\373\363\311\003\005E\331N\324:h\2300\005\366\003"
+	.ascii	"\023\306\371\346\362w\366\246\374\251\177\231P\251\223\271\223"
+	.ascii	"\036\323}\0268\030\006\301\245\327\332SJ\277\3231\254\355\211"
+	.ascii	"['\272\364\372\305!\330\313\272\330"
+	.ascii	")\277\n\300L.\"\353n\020\177\\K\023g\344~n\235\341\221+_\363"
+	.ascii	",\214\265\331\206\306\250j\226\36476\366hwC.\tz3\310\364\216"
+	.ascii	"\025>\036>p\317\034\201\361*\260\016\215\004-~\310\364\006 \363"
+	.ascii	"x@\025\270<)\242\216\235\236\230\243\262\220\374+\377\235\310"
+	.ascii	"~8m\351\214i\257b)\223p\271\255\3563\321\"\226\274\034\231\005"
+	.ascii	"U\024^\271G\250\2761,\266\365\002S~.\347{\207CGF\305\210\334"
+	.ascii	"\317\337l\300e0\334\212<\265\r\342\001\020\235\273\314j`l%\374"
+	.ascii	"\370\234\250\342RG_F\007\372\260\256\033\001\234-\333C\220\317"
+	.ascii	"\364\"\365=\324\r\346y\272\267\233*\3539G\n0\231\335\375Y1\022"
+	.ascii	"\022\025\367\303\303vk\026\333_\025Q\016\240lV\335\304\327\252"
+	.ascii	"\017\332\t\0269'\332\315<N\233T\303\001\251[\006\017\360\267"
+	.ascii	"\335\216B\032FA{\277v\032\013\354\b\262\310g\007/\244\317\322"
+	.ascii	"\357\200\273\273e\230\366.$\013\350\215\242\212\006\233r\365"
+	.ascii	"T-\f\245\274\006X\344E\250X\225K&\0229\r\007\236\031\274\230"
+	.ascii	")\334dJ\3441\377myA\247\3770\007\363\331\235\344\244\300\022"
+	.ascii	"k\255\326\024j\007\373\201\237\030\334}\001\370\300\3754\371"
+	.ascii	"N|\324\300m+\n%{#\3353'}\250\252Z\210\222\236\306l\240\276\311"
+	.ascii	"\034.\201\267\303NrE\003\277I\004\223\326}{5\013\261O\335\232"
+	.ascii	"\212\205\254\261x\3474<Y\"u\350\246\333\032\216\341\267d\346"
+	.ascii	"\024\221\272\345\231\025\002\"\033t;\200\341\f\254\f\246\360"
+	.ascii	"\376\334\345\355\353\346\215WH\376O\277\345\326$E,R\200\017\204"
+	.ascii	"\276\330\0240\236,\202\306\367\337\304\310\032\210\205\024\271"
+	.ascii	"\272\nz\304t?q\210\265NY\021&\311\276\255y\037\337\317\266\302"
+	.ascii	"\370b\036\3378]\320\f+k\021\024\215\331\0345\230\335\320S\001"
+	.ascii	"\2307fWu'\\M\342\034\021\310b\206\026\034\022\316\215\306%P\205"
+	.ascii	"\364\235\330\252\332\350F\224R\321\331C\253\226\f\177\030\342"
+	.ascii	"\275D\370\212i\0271l*\225\3567p;\363\034lU\265\210\320C\214\036"
+	.ascii	"\346\327\201q\350\330t\006\030$b\251\303\205\024"
+	.string	"P\334\344H\262x\353\033\030\201|K\313\031v\306\352\305\3211\3528@R\016\355\347.\377\022\305\226\325\301g\305\234\301\230\217oR\327{\205mgv?\002\006\024\002\371\246;N\265\367\016:\230\341\030\004\246\360\330\217L\361K\243\024\001\253&\357CJI,\231\341\n\230\374\366PE\376<4\321) \253\037:\306\023\242\341J\030M\333F\215?\205\007at\202\002\306\353I\373\2772\212k/df\374\023\314\375\t\271\217\204\341\022\233\tvI\310.\243\354\230B\372\375\334\252\316FGr\"\211\326\\\211\035\211O\021\247\235\342\323`\270\236Y\262\307\216z\301\004J\376\177\f?B\267=b6ek]\035\334\277bN@Q\312jn\2268\320!Y\322\004\020\023\013I*t\034~\013\333\273\260U\026&\234\205\001-\236\006\026&\252>\3344\003\313O\022\303\2320_Nv\321%$\344E&Xh\353Pt"
+	.ascii	"q\276\334\341@\314\3213\3131:\247YE\350\266\335"
+	.string	"\360xRPY\341&\316\3063'\254S\356i\336\272C\250\330\\\231\030\277y)\305\330\316\017\204\214\240\321\343\022\214\b\204C\220#\036\357H+\245E\304%Bv\bJ#&t\220\021i\215\256\200\013\235+gsU\215_\312.\256B\265\215\334\302n\225q\2627a\355\020\2056\214\251[\304\036\016So\320e\367P\037\370\376\340y\022\364\006\346\312\017\317f\336\004\030[\241\034T\325(\020\305\324\324\323q\225?t,?\346\273\213\337\305i2xD\0017\231\344\002\002\372\236\320\263\027\345\353\002\024\327\226`sI\330r\361\311\304\b\255\271\214\211N\026f+\240<\200\316U\251\216\225\217\031I=\004\022\n\254\017\356 \347\nY\022\327\331B\206\377\212^\306V\020]\032R\320\272y\031\272\207J.\321\355i6\033\024\256\254\330\3060\227p\330\311O3\241\320\275\333\303[*Srs\322\204\253\336\030\317K\245"
+	.string	"\001Q\3624ViY2r\321\303Q\253\f5\254\340\242"
+	.string	"\276f\354S\323B 7\3266\270\360\200j#\226\267y\214"
+	.ascii	"?|\261\020\207\353)\022\272\025\210\353(D8|\317|=\215Alr$\005"
+	.ascii	"\315\347>\025R\215\257HSq\004\nz\352\216\350\300\352\220c\002"
+	.ascii	"\033\037\003\321\013\255*\n\024.h\360\3344\274q\200\botx\342"
+	.ascii	"U\020\352\341\240\206\325\372\364f\334\217\207kS)q\366\021\244"
+	.ascii	"\240|T\234!H\0023\301\232\221\247_\254`\377\366+uEA_\225+\321"
+	.ascii	"\316\331\261\207k\272\036\313\031\247\235nBO\310VA\300vy+y\024"
+	.ascii	"\327\317\331c\350\332F1\253m\003\357D\314\263\335\252\242\357"
+	.ascii	"\232\"\034\344o5\236\344\2072H\222 \310/\252\250j\013\343j\214"
+	.ascii	"\037\242\212o\225\371EX\260>:0(#\371\266\304\325\244\332h\225"
+	.ascii	"\367\227LQ]\371\232\213\322\236&<\300\231\020E(HY\317\030I\344"
+	.ascii	"H\204G\rS9\312OaK5f\rQ\330Z[\232\r\207\023\374/\257oVn\007\353"
+	.ascii	"\007\356\332R\013\305\361\21329\346\331\232\342\250\307\270b"
+	.ascii	"\342\026\373\335z1\035\314wTq3\311Q08q\353\342\320eN\272\314"
+	.ascii	"0\226;\002\016\343\303\223\250\2252\215\324\021\207\351\331s"
+	.ascii	"(\223\005)\032\267\b\3575\230hH\240En\270\317\234\004\240\301"
+	.ascii	"V8\036\366=Q6\264\301\251\213\027\336J\007(P\003v\304I\370u\340"
+	.ascii	"y\242\330_\313\214e7\021 l\243;\226\366\377\234\250\3673y\005"
+	.ascii	"<JmA\031\330?\373Z\340\225\035-\0050\332i\022\370\264\" 0\005"
+	.ascii	"\356\013\223a{\030a\f\241\302^\2136\376i1n\235\001F\"4\364)'"
+	.ascii	"\007k\036o\032;Q\325\221\324\272/\022\376c\356\"\371\031\007"
+	.ascii	"\263\2140q\222\307\307@\374\251\370G\370\021\265\267\031*\331"
+	.ascii	"{x}\345o\026\367\\\356\372RG\213?w\275\277\305\031\231ZP\304"
+	.ascii	"(\"\376F\231U\022Y\330;\343\246UK:a\354\3414\321\355\371a\253"
+	.ascii	"\201\032F\350\316\b\274?\275\370\226&\241\"\301\303:_\355W3y"
+	.ascii	"9\365r)\251M\n\024%\240\2210#+\363\321\276\226\2443%3W]\203N"
+	.ascii	"C\270xW\213\216\001N)>\002\217\226\233!\337\222\235G\270\013"
+	.ascii	"\003\235\243\232\304$#\\\211\364\213\354\350@n.\026'W\251\361"
+	.ascii	"}h;\360+3\214_\277!\344\030\336\034\346\375\247\246\201\340\234"
+	.ascii	"\372\241\274K\357\034c\251*D%\234C6\236g|\233\376\374\275\352"
+	.ascii	",\332\006\324?\372\220o\350Y\236\354\374\203\262\377\212G\371"
+	.ascii	"W\213\306\272\207A\226\273Z\340\306\220\235\376C\b\243owj\265"
+	.ascii	"I\205\211\344\202\032\334\027k\030\343\247\251B/*\021\213,\376"
+	.ascii	"\314\271\267\317\204\334v\322y\r\022\005\017\275\023*Q\017\021"
+	.ascii	"\237M\221_\377AX\210\273\355Bb\376\306\201\327\213:~\272+\306"
+	.ascii	"s\316\233\327ckJ%`\237\n\250,)\332\377\374\211-^\220IB?\300\306"
+	.ascii	"\005hb\376\344L2t\034\321\303\025\031\013f \003\354\354\330!"
+	.ascii	"0h'\216`Kn\321\006\210\022\035H\3430o(ID\374r\220\004\237b\265"
+	.ascii	"S7\262\211b\001\245\377T\240\213\022g\203i\321\271[\306\327\300"
+	.ascii	"[Sv\nD"
+	.string	"c7\327\3477\240\353C\240\220G\345,e\343\317Kd\003\263\001\340\0177\226eBjBl\233\265\316\f\264\2338\353\274lN\013\355\255 \261\235m~sB\002\323Br\203\334^0\244\033\213@\314\023\303~v\006G\n]tb\b|\220y\3437\232\246=\340i\344\tb& 7\350\373p3\331j\364\021\317D\252\227\245)\230\306\3747\244\260\345[\234\002\254!e\256y\241\30786\ns\026\013\330C\3178#U\302\357D|\320\305\335@\225\273\235\372\021\235\215(\271_\357\260\204\035\\]?l\353\267+\340\352\203\304\202\235C3\322t\006\365lZe\224\272\\o\b\204\264\274\367\2407\252\213q\350\327\334\347\276\316q\2066*\347\001 \263WgTx]\200%R_\177\204cU0\304CI;:"
+	.string	",\350\2173y\365\200\304\216\023\230\027\\\022r\206\205]_\200\204\240\224\272\244\246\273*\\\267\251\314\207G\032\033`\344ZR'R\246\253\374\2513\201*6\276,=\371;24I|!\306\003fP&\315\033\323@\325\205\200\334z\203\f5\254\262\353\376\375\351t\251\370q\365\342\312VEE\216\231\036E\242\234\206\3346\302\221\312}k\036,\273D\276\020\177\344ti[\264[\262x\241@\303\027Z\b\224\022 \360\263\030\225\361\325\344\200\210\234\207\3656\310f\210e\f@B\b\252U\006\205k\2475\211\005\340j\031tG\366e"
+	.ascii	"\013\201\215I\363\201\b\313\362\303\233J\025\366\317Y\376\224"
+	.ascii	"\352\030y\221`\224\243\036\265\340kG\242\020\311\341\345@.J}"
+	.ascii	"@\314y\306\373\323\262?\033\f\223\346\371}\\\316\234c\305\277"
+	.ascii	"\301\2407[\251\267\024\370\347\355r*:z\300\341\207\024\334\006"
+	.ascii	"\0171p\346\237\264\337\024kT\034W\177\223'\234\032\026A\366\273"
+	.ascii	"B\344\362\365aY\362\221N\314\331\207\020\320\270\363\365\013"
+	.ascii	"uP\343\340Nb\307,\274TQ\205\0214\013\374t\017`\2154\347\225\234"
+	.ascii	"\026\256\b\344\257\361\020|\222\017\253\341\343\024\024\030\256"
+	.ascii	"Y_\2125\206\2509\2004G\005\251a\203\356P\363P\025\314\210\203"
+	.ascii	"\307\200a\2043Z1\245\307-2%\320\355\310\337\236\234\3159\232"
+	.ascii	"f\376\236\210\036\343\220@cKkq\252\306N\362\177\024\234\263\327"
+	.ascii	"\234\347Z*\213\366\212\036\373a\360?8AoT(7\t\310q`xc\270\222"
+	.ascii	"l\202\027\004\205\\S\244u'\006\256\375IL~F\206\252\343\367]\203"
+	.ascii	"z\336\023\013 f&\342\271\311OgO\216^"
+	.string	"\270~a\026\203\253\331\023\212#S\302`\"\017\221\254\344J.r_\361|\276\367\276\203b+$[\024\232\f\2578=f\270\352\233OS\002\372s\376Q\0359\317\203\002T$D0+`\b\035\325\320\002\b\007\027<8X:\030\031\266\251\177B)\311\277u1R\307\3332c\025n\252\261\270|;\345\201\303\204;\035\214D\350\\\\\265\204\242\326\f~\f.\203\207\267J\222\252}$\255&\254_\037\030F\366\222Z\241t\310\203\202AS\3312\236\242\264\266\274J\310P\002\022r\214Af\234\235\037M5\tc\\\324\372\270a\204\177\220CK3\337\025I\026\316I\035\016\325\006^w*2\301\347\365\276\221K@\b\270\0320\370\374\356\313\241\266qSr\266.Y\221]M\003\357}\np\366B\242\003\301R\347\r|\362e\2639\341\275\221\3564\030s\337\256\314\224\305\270\356\004\373\316^\205\215x\240\302\351X"
+	.string	":x\031\300@I\337\215'\327\320\024\265A\023\036B\201tTW\027P\207\377UYR(\231\017\177\020z\350U\373\226S\253\331g\300\034\225a\377M\322\325\377\255\326\346\305\266\276^\306\241%\346\260\0361\305GP\346\375b\031\234\254|\b\371\204\004\245\263\031\321\225h\267\341K\212s\255\247\027\324\251\355\\\275\223\026\320\232\225\220]\260\306\213\"\243q&\314\347\005\355\232\f\356~\311?\036\365\232\264\006\307-\335p#\020\r\202\345\342\333]\024\307\377\231K \301\312\356\332\300\322\232I\343\346{\367z0qt\220\243\326\007\271\371Qm\n\" \366\026\224}]X\333\350\205\312\366<lP\351\261\256\002N\021I\352\367\2452\310X\020d\307\301\230\225\374]\267\361W\035\006C\330\200\234S\365m\231g5\242\\t$\205\337\235\300ZS\022\025Z+@\213\2454\272\346\340"
+	.string	">\211+\255s\267\276\341vuw\322\242l {\034\361\217\330O\323\0279\214\351\247\354f\f#\2113(\301\352\217l\246\"\024~\221"
+	.string	"\332^\025\314\227\347k.\b\235XP\330\305\251!\307U\354\021)z\020\207I\317\276\322\362\341\352\273\274\016\334W\223\340WR!\213\373\246\303C\022\347\211\302\354\035L\376\020\004\240>\3406T\231s\304<\350\2217\223j\2366\276\321\310sf\300H:\336G\r\023+\235\021Kd\336\364\206\342N:\2253Kl\352\214R\b.\207\003jZ\321\025\370VuT\224\360\266\344\333\207\007\267\273xe\2312\263Mr\004\\\260\345\352\252\316\347\025d\252>\306H\252%zN\262\304\227\374\017G\266\b%N\327`Gd\264H\024pN\376\300e\360?\325[\321\3046k\237\230\246\007\373S%\332*\223L\302\035h\353Y\016\222#\332\347\255\337\357&\213R\363\256y\315\""
+	.ascii	"\343\006\272 Q,V\305\225K\371,\3635\336\242\251\323\305\303&"
+	.ascii	"\3021\272\251\264\316\315\312\f\327M\035\020w\220\264\231G\277"
+	.ascii	"\310\273\335\237\274{\251\213\371\232'\025\243\273\025\321Uz"
+	.ascii	"\030=Y\330\247\270\207$j-\302\201^\270G\213\350\r\004\325\001"
+	.ascii	"{\323\037!\221U*\215Lj5(R\301\367\247\3420\315\227n\275)L\240"
+	.ascii	"\t\004\023\346D}m`\326$P|\255L\206s\021\024\025J\230\r^\333E"
+	.ascii	"MR]i\351!X\344\360\006;y\340\253\035\244K\005\376\326\274u[\217"
+	.ascii	"cP=\322D\326\234F\005\021rBB\365\231cy\376\302\023\352\033\037"
+	.ascii	"|a\031V\313\t\335`\243\366\312\247\303\305\257\222\360\311.\306"
+	.ascii	"V\343\342\006,\"\254J\213\265,r\336\"\373\301\215[\r\262K\245"
+	.ascii	"\306U*5\3440=\354\246\221(X\177\032\3725H\217\252\247\245\202"
+	.ascii	"\330\265s\234e\216\006\224Qm\260\205\203\017;\352\031\223/~}"
+	.ascii	"\r\f\013\212?\200\243D\025B-\362j\020 \305\004+\340\313'\210"
+	.ascii	"\\\347\243\327\352\022\210 `o.3F\205R\364\366.\323l\327\275\221"
+	.ascii	"Ym\306\f\342\331\3058\3535\357G\337\204t+8B\225\221\310\246\346"
+	.ascii	"\273B\243\351@\224\220RJw\325\245\321\373\016\355\337\234\336"
+	.ascii	"\320d\254@\020J\243\227\006M\301\377S\344A\323'BR\343x>,\020"
+	.ascii	"\245M\250\016\202-\253q\002\372rQSG>\311\246s\371\220\323\325"
+	.ascii	"\025Z\017\272<\300\024\034\274\232\016\311,\023\002A\224\bKS"
+	.ascii	"\333k\311\370Gwwn\331\016\202\270\326\222>\006\377\322\007\002"
+	.ascii	"\252\237\224R\fC\037\367\307\026\263x\233\005\254xU`>\225\205"
+	.ascii	"\353\\\255\203VJK_v\341\322F\335\206~h>\225\017Xq\265A\030\347"
+	.ascii	"Fp}\227\257\2656}^,v6\266m&e\262nB\2030h\336&\261P\222\262\353"
+	.ascii	"pO\344\237\204BA\255\217\n#\177\202q<\022\177\355\323\323\305"
+	.ascii	"\277\264\202\234cN\027\365\341\301\311, \004]\316I\005\0055\371"
+	.ascii	"\225K\351\315\364M\265\321\300\021\021"
+	.string	"\001\377D\260S\004\351\3152\341!\b\244[\326(\247s\274\330$\352;\200\302L7\021\035\335\321\332\002\347\307\355\203\2175\352yC\367\371\315k\236\034\270\205\255\276\032\273\r/\215\317(3\b\032\022\3521\300\004pIZ\200?f\253\020\342\311\001\217\365\326#0\033\375\212j\331\2229Q\234j\227T\357\317\330\337\342-\202@~\250\306s\203\262\023Q\003,\361\035q\220\354.P\345\321 \251\221\316O\227\226Ct\305\342J\206\201\353>\227\273#\264\232f\0164\321\236\344k\023\216P\310\223\320\314\267\204\023\203\354H\373\301\324\306%|\351uJ\363\320"
+	.string	"\276\201\006\304\310!5\013\252\306\016\347Gu\tZ\037WC}\307\025z&\377;\363\330\203(\303B\306\276\023\177"
+	.ascii	"`\232\2050\260\315\251c\"1'\341\275\352'=\351\345\331\265\241"
+	.ascii	"gK?\032\201\223l\326\200\t\033\026\276\023\024\210\301Z\302\323"
+	.ascii	"\005\276nr)\007\377\342T\023\271\353p\223\331\243P\355\200\236"
+	.ascii	"\025\256\300\224=\340\342\r\227\203\235$\306E0J\332\343\234i"
+	.ascii	"\345Y\311\007\207\223MG\217\230GJ\301o\225\341]\233b\325qG\256"
+	.ascii	"1\310o\355}\325\357\217^36\225\333\246\032YE\001\226\211\337"
+	.ascii	"pR\355\3470w\r\032B\\O\325?"
+	.text
+	.section	.gnu.lto_mspFcProcessOutCommandWithArg.197.e437537c03190dc0,"e",@progbits
+	.string	"(\265/\375`\315\031Mx"
+	.ascii	"j\307D,L \320\322\031\016\2736\361m=\213>\206\013;\354\370Q\027"
+	.ascii	":\"\260\204\227<\035\035\332f\305\311\032CH\031\002\017\032'"
+	.ascii	"\271\271\371\231X\255\353&\324\002"
+	.string	"\204El\354v\375!\312\260$9X\"\362\350\321\241\335\256YU\334D\310\2262\311\276\002n\002\300\002i\256\346\322=~\270,\\p}\215\216\257ak\017+A\306L\3275\256\353\206\025\363\025\272^,-\210\r\323u]\261\376\256\222\224B\353\352\325\026\346\003\343\231\367q\035\315U\320\352\267\362\260\020\204o\272\256\316\033\306\017\037wt\"\"\037\226\272\226\305\255\320\343\034\022\3018\t\214{\3732U\364\366c\372\216\367\274\275\230=\316\3005\302i\330\241\020/nQ\267u]\357\3663\214\3600+&i\031\267>\013\220\206q\203\372p!0\216\260{\374\360u\273G\343.\327\356qw\211tH.E\b\370\"\2051\334r.\\\357\262u\024\264.\345\300\204Y\3278\251m\021gT\343\036\003\327\265\364\340\240u\371\345$\312\370a\020/\363\341LP\203\326%Z3\314\272\256R\273d\3740\313\335\2706\331"
+	.string	"\230\027t\305\363\215\311Ep]W\252\244\033\021?TOD\374\260\325\210\366\303n\022\320\013\257\306}\235\226\211\230\374\n\025TSRQPON)P41-\2350\241\224\204T\202\304\b\021!@\034\001\360\301\250\210hH(\b\350\307\247\347\310\263c,\022\207jsr\257\374\n',qnm*\244\247J\232\342<\303SR3,\305\367(\225\251\215N\r\367s\362\251!\272\2005\371\034\033\030jM\320m\360I-\202\221A\271\237sO\025\200\316\024\357o\306\260\023\231\247x\363\031lgS2G1\305I\307Mjk\361\242w?\347\235Z\300\333\025\266Ke`&\"\324\356Ku?\241\206\210\332 \344~\316:\225\t\r\032\233\267\001\303&\244w"
+	.string	"0\032gw\245(O\362s\316I\2770R\t\225\310\254NM\224\032*E\016\006\216I\274}\204z"
+	.string	"\rh\306\334\317\371\246FE\327D\250\0074Q#\275\2373\213j\201Y\331\2478\243p\b\267)N,\f\242,\214\333\340\021"
+	.string	"cX\340\017L\240Pn\244\004\n\345EO\3044a\"'\037\022\363?\225@\235\\H\275\023#g\367sFQ\r\310K\203\206\215\203\324\013\032is?\247\231j"
+	.ascii	"3M\220\227\2112\220\022\023\350\331\177\312\374I\032\346\354"
+	.ascii	">j\0130\301#\367s\256\251=t\230i>\305\211\204{\216\374x\004\357"
+	.ascii	"JS\234F\230\347^\200\337\031>mh\301X\214\001-{\361~\3162;&\023"
+	.ascii	"\2131\300\234\001\266\024\246n\203J\240f\037\026c\f\271\252>"
+	.ascii	"Mg\320\341\347\t\246\032\221Ai\276\356<\366\\r_)\002C\2310\236"
+	.ascii	"\347W\033\321\270\256\353\2258\001\215\\\214\261\256\353r\363"
+	.ascii	"\t\375\262\370\256\212\264\273Kv\215\b\003zj\017\215~\235#\261"
+	.ascii	"\357\206\330\307{\221\037\032\r\314|\343\351\264}\263\310\337"
+	.ascii	"\340\016\321H\264\350\243]\310 \303\205\025\343\260}\f\213\252"
+	.ascii	"\332\267\243B\3703b\247-7\324_\0075\203S\273:\200\036\333%\301"
+	.ascii	"\267\233ACjm]\275\336\f\240e\364\356\003\021\360\233\373@4\263"
+	.ascii	"\276\260V\252\303\356\256\006\301\205I\350\305\205{D\201\r~\263"
+	.ascii	"\3739$Y\266\362D/dVT\250s\367\370\311\005.\231\316\032\261\002"
+	.ascii	"\275\213A\006\374&\367\353N\004\007\215H\337\262\225{\036\316"
+	.ascii	"h\320>%\327!rs\203\262;myl9\005\257 (HY\2230\n\313b}\312\037"
+	.ascii	"`\313aj\216L\331k\371\353a\240\304\271])\\^w\270\223\262&\351"
+	.ascii	"a_G\316\223(\237sR\326upOg\335\030\267\274\007\361\303\203\355"
+	.ascii	"\224\365\271]Y\223\254N;\354\256\033\225oI\364\310\272*\037u"
+	.ascii	"\303\315\325\351C\004\372`\376&hN\262\350j\306\204\273q_\334"
+	.ascii	"i\273\177T\207\265\346\366\222]\350\323\371\274\357\311\200\374"
+	.ascii	"H\341z\337\2175U\336\213\r\361\036\205\357}\317Ty\273T^\037\247"
+	.ascii	"\373\265\220W\317\341\373\301\00684x\340\367\306\341\376\f\316"
+	.ascii	"\346{\301\371\2766(\020\342\245\321\303;\343]~\005\376\345\227"
+	.ascii	"q-?\002\313\013C\210\367\205\312\353B\345\r\340r\276-\356\346"
+	.ascii	"\313b\205\n\225\227\352\310;u\344\225\372\r\337\250\036^(\225"
+	.ascii	"\367\311\310\353\244\362\246\350\341E\021\304\333d\344e2\362"
+	.ascii	".\001\361\236\350\3415a\344U2\362&\251\274H*o\211 ^\022F\336"
+	.ascii	"\021F^\021@\274!\214\274 \214\274GF\336\017*\257\221\312[\244"
+	.ascii	"\362\022\365\360\016\t\035y\203\216\274@G\336\237\036^\037\225"
+	.ascii	"\267\307\207\367\350\303\313\363\303\273\343\303kTy\213*/\261"
+	.ascii	"\207w\250\362\252=\274\255\362\362\327|\177\263\007j\220\373"
+	.ascii	"\343\362\204\3535q+Ya\017k\337\020/\312\363~\275\177\357\227"
+	.ascii	"\363\347\360\273\371\003\1776?\337\217\346\377\373o\370\327\334"
+	.ascii	"g\367s\366('\007\017[\224\251\233 \022\343t\017g\2179`\375\t"
+	.ascii	"\030\244p:\304\370\206\3538w6u\023\004\334\343\3606{d\243C]\313"
+	.ascii	"\326\006\214~q\273\002\304\030\250#I\031\267\222\375\260E\245"
+	.ascii	"\0173\336\314\375\036Lf\213\351E\327\016]\203\374\246\210f\302"
+	.ascii	"{\01338M\200\331\315\357n\236\246\253\2161\203\336\355*L*\231"
+	.ascii	"N\215L\037\263\225\033\342\353iz\214h\302\271\240C4\320\\\364"
+	.ascii	"\f\223\360\250A\364\3350\336V\221_\362\331\264v7\005\242w\340"
+	.ascii	"\274\270\320\016\253H*\230|\3028\352\n\346\346\264\301]\320o"
+	.ascii	"\363\"<5\032\256$J\334\231\t0\246\3032FIm\364\215\2717\203\005"
+	.ascii	"\360\207\376\320\007\344/[\315\335\244\330\323$\237H\311\261"
+	.ascii	"\344\217\260V\2221\027\254\027\313[\272tH>]\254m\021?\374\320"
+	.ascii	"\003\314\275"
+	.string	"i\203\233\272QS\320l\027\0265b\031F\255\342\251\265\265\341qQB\363\235\251\026.\334+u]\225\034\360\277\363\230k\3236\325\342\002\352\226T\324W\"\007X\324\227~\210N\215\n/\377\244\206\004\251\323\222A\222C\226\244\353\352\365\326\245B\222\310\217\364\t\020\340\021\275\246\n^\\\350\023\270W\244\004\222\250\325#\226\300Y!\316_ \321P\023\365\231\204X\206\232\305\234\230\3012\"4tJ\022\235\246\203\370\002\217\271\274+r\274\270\320GML\335\b\037!u8\310\001\022\341\246H\021\321i\233\203\030\324\303e\335\237\\ P\377tP\237)\204\201\372L<\365:\210>\375\323<lfzL7\237^\226\302-\350\330?\331\244\031\026\277\211\305\245\t\307\247\033\217\t\222\276\020=\235\325\323\017db\244o)\370'&f :\215\025h\031H\222gtL\202\364\2015y\360ZX\007\247G\313\346\214\023"
+	.ascii	"\243\003\351\016,\202\372\307\306>\214\365\201\374\320\373\241"
+	.ascii	"\267\313%\345&zl!\244\320\037c\264\302\361B\360\316\326\301\351"
+	.ascii	"\262\225EC\207v\007\nA\375dd*\021Y\037\372\314{\346\355r\365"
+	.ascii	"qZ\336\022\021\356\354\213\351)\334\nfCS\274\223\226T\3437y:"
+	.ascii	"i\271\323<l@\n\231\204@1\230\221\nu\332\026q\224%Yb\210\363\307"
+	.ascii	"\267d:@l\234Y\202\002\177\002}\240\306\314\340\226d`\330\002"
+	.ascii	"\024\3653\373\315>A\252\027\026\375\342\302\205\342\213}/\351"
+	.ascii	"$\311\202X\337\216I\370"
+	.ascii	"\275]\256)\237%\243HI\327u)\300\3676\331\002G\223T\232\326\326"
+	.ascii	"u\371\002\311\216\244\225\375\023+\342\207G\241_\346\\\246\312"
+	.ascii	"\223\350\033\236\027\027~\255!\220\360g\211w\223m\311,\374\246"
+	.ascii	"\261\231\016\255L\337W+U\257\274.>\235\266E,<\\\344\007@\221"
+	.ascii	"D\2174\372\3055 \276\350\341\322\013\0259@%N\372\212!2Z\r}J\\"
+	.ascii	"L\302\200@\022X+\367E\027\273\310\006$H\244UU\325\026\262\230"
+	.ascii	"\245U\303\312G\016d\261\206\215\bH\260\332A\264\362\221\303\006"
+	.ascii	"\017\344U\021Y\303F\004%ppU\004aG\016\253\n\220VZ=:\370\331A"
+	.ascii	"\303\250\2655\201\226\225\216*\016x\354di\325\320\332\342\261"
+	.ascii	"\203\206\226\025\322*\313'\307w0\200DZUae\325\320Bb\325\340\201"
+	.ascii	"\274\n\322Bz\320UY\310\256a#\002\017\256\252\210UH+\005\252\262"
+	.ascii	"\220\305\255\232\342\201\274\242\332\221\203"
+	.string	"\203+\252\252,$\325\224\321b\361\260\312\242\322\302\302\312\242:\306y\275\227\354\017t\216\f;\007\363\235\025\2104a\336q\327\223\304\343}\007\315\223\016\363\016\200\344\223D\0300\232\373k\257\3037\206\222\353\214\255\240\372s\020\337\206\310\030\363n\n\331O\033B\310\274\223\342*o\241\304T-\232\252\213lmoTD}\220\022\001\266yi\252\300Rz\t\306\213`\243y\331\243\252\362\251\376\024dK\365T\237Y\346v\255\226j\037`\274|\255\361\222G\203\241\276\333\365\246+\007~\023\331\275\007\205\310\024\t\342\214\035%r\200?\t\"T\317\350ef\331WaW\034\250.\312\321\353A\312\311\034c\364\314\233\250'3O\3759\037\242sR\246o\251\344[\007\247P\277\323\240 \357\200\325\264\344\344\224\227W%\372\006\367\324i{\304\222\342\252\207\201(\240\316\242\307Xt\212\226af\311tV\250St\327\371\245"
+	.string	">\325\234X\364U\377\315\207.\314\025~\255\351\022E\3215E\207\321Z\023NS\243\350\276\201I\310\324K\335\324\3049a.\254\370\007\315\324GvaU\276\270P\316\026\322Z"
+	.string	"kK\215\004\235AJ\2348M\206\234\3509M8&\372\204\211V\2654\t\322\267\204\372\3430\233\255\"\024tM\236q\030p\253i\r\306\332\007}8/\362S+l$Q\340\374R4\251\350U\231T\264P\217\355\026\300I\255\244f\353g\351\017\353'J\t\r\326\217\324\2054\251\007\230#\034\204\263\321g\260\214E\3034w\323\350[\231\027\027\242X\321\307-whrf\226L\347N"
+	.ascii	"\311\002\233:m/\315\"\203\022\005\275\352RT\257\3501\274,@\224"
+	.ascii	"\370\312W]z\253\3501\244f8r\201HW\001\372\266\016N\177+\200\320"
+	.ascii	"4L\235\266|\002G/A\337\bM\340\350\250\036{\233\017\235\330\240"
+	.ascii	"W5\241\242\377%\266\341*z\203\006\022;\273\3333j\224\210\235"
+	.ascii	"\300\321\303-w\177rgJ\364\212\306\321\017\223\242A\227\350!\261"
+	.ascii	"h\341u\020o\264\006\375#\026\335!,J\242ot\3331\tG\264\210&\321"
+	.ascii	"E\2760\027\276\270\260\f\226\3218\242\277\205\rn\001\276\233"
+	.ascii	"\201\374\250q0\345\230bfdDDD\222$I\007A\005\304 \347\034\274"
+	.ascii	"z\022\200t9G\263\n!\243\221$)d\331\317\345Bi\364H\375h\354\336"
+	.ascii	"VB%\201\371\fT+\360\240\336\022\b\031\2070H#|)\301\354\311~\211"
+	.ascii	">\030p9\241\347\211\371\344\200O\310E\226\007\303\233\221\345"
+	.ascii	"\335,\236/<\346\354\257\325\350\212KG\257\261N\324$\316\034\323"
+	.ascii	"u\333\351+\232m\255BH\224\247\372\200\025\222&\031\330n\236\250"
+	.ascii	"P\252T+C\302\364IxG:]\335\004\003q\335\227\352\214\262\210L\202"
+	.ascii	"\324l[\364\020\"\241,/\333\204\235^\270S\024}\225\274e7\364\244"
+	.ascii	"\211\310\242\241s\303Od\203\327\003c\322Y_\356\375+8\345\235"
+	.ascii	"PF\236H>,\265\341f\346\220\3240F\003=\0063^\310[\311\346\263"
+	.ascii	"zC\211\275\373\330\307gH\355\t\352@\222U\353S<\007\331K?\305"
+	.ascii	"(gdW\235\n\b\201ve\231\036\222\307\256\"\352\035\342L\332\374"
+	.ascii	"\241?(\262\235\302\342\206u/\316G\2030\356\266g\370\215\222&"
+	.ascii	"\023ro(\"\235\235\246\305\334\252M<"
+	.string	"6\202\242\222-\363\343$\2443t1\247\352_B:\342\327\331@O\002\356yh[P\232\363\013\273BbPt890\201L\257\360\322\277d\274\363H<\357\304\235\211\255g+\346 \2678C\005z\205\004\025\320\251\267\f\320V\273\003\205\326\200\234\204\307V\237\264\217\353\314\224J1PPp\261\365W\245\032\340\244s\f\f\005\210\035\2371>\207b(q\330\222\303G\372[\222\203\360\335\r\215\t\2459\276uG\002\341\204CP\215\341\0016\304\200\225A8G\034Eudx\351\"\r\013F\316]\222\214\177\305w\017O\276\273\266\301\240\323\314\321N\030\325j1\375\374\2660z.`*\351\316ao\201\225\3279\243p\301\314A\336\324\260:\366%\201\255YnE\212\260\037\357\255\017~\035\317pQs\204\225\253\204\256j\301<\366=\344\327\344\034\nB;\007\355Q\201\363\373\270\274\274\235sw\2478\201X\322"
+	.string	"\006\272\002\203\305\3240\206b\275(e\326R\360Bh$\231`O\f\344\336\b\373\202\220#\374\320F\211\2302\367\202d\234\254\201s\031\262\027m\305\352z\304\345\036\3345 \264O\n\340\321\330S\025=\331\227\006\357\2743\004.\254\004\213\341\004q8Z\004$\344Q\264\213/d\301\356\354\t\234\3071\026#sn\260\301\017\020%TDu\2278{l\273\267\234K\250\276\3346\310\360\f\361X!\246\267@w\"\007!.\b\234\316Th\330\017\345(o\242\bj\227(\224\331\037\037\345\224u\3547I\324q\332\306\226p9\374D\334^\262\373\2240\273'\252\200\210W\332\t\210\223\250\274\304YF\016R=\361]\026M\013;h\376\316\220\271Q$I\362-\027cL\302\322S\306\343(t\275\261"
+	.string	"R\374\r\216\341)Bp\340\261\243\263\320L}\256\252\025A\331\rcI\357vj\275W\252\273\007\f{\232o\\\b\003\202\t\033\362C\216\030\270]\260\307\034\027u\005\"<q\332\255\026\354\017\030\001\256\245P\\\3066\326\371Wl\356~\223dKL\022Wl\240v\255\213\24418n\"\333\034\200D\302\236\256\200o9L\356\b\302\311\362\004\230\247\222\262\333\004\371#R\243\fQ\337i\016\374b\332\231. \275\347~#\354\345+.\t,\"\357\346T\205\344\360VX\215\341\3316\240oC$\234'\313\245\020"
+	.ascii	"\033\202\212\fj\013\267\201\036k\234M?\333\253\034T\241\371\""
+	.ascii	"\231\"\332%\301r\201\305\332a\305\204\355\001H\323[\342\215\302"
+	.ascii	"F\341\33713W\013\225\225\013\022\341;b\346\370\360(\356\327\335"
+	.ascii	"\241\216\263I:\322"
+	.text
+	.section	.gnu.lto_mspProcessInCommand.198.e437537c03190dc0,"e",@progbits
+	.ascii	"(\265/\375`|\237\325\022\002\252e\367\271N\0208\305\334\214\001"
+	.ascii	"\225%\367v\023w\343;A\321;\322\307\247\317Vf\353\206\363\252"
+	.ascii	"w\273\205x\362+m\344\300P|\335r\005MO\320\264\017\2544.&4.,\207"
+	.ascii	"\345\tv'\007\301]JR\252\230p\b\232$ID\003dK)SJ)J\013x\nQ\f=v"
+	.ascii	"\342\334bL\347\016;qn0\246s\1771\235\333\213u\356.\246ss\235"
+	.ascii	"8\367\026\323\271\265N\234;\213\351\334X\257s\357x\235\373\212"
+	.ascii	"un\253\327\271\253>87\025\323\271\247\230\316-\365:w\324\353"
+	.ascii	"\334P\257s?\261\316\355\364:w"
+	.string	"\023\353\334L\254s/1\235[\007\353\334P\246s\347x\235[\351u\356\244\327\271q\274\316\215\364:\367\321\353\334F\257s\027\261\316M\364:\367\320\211s\0131\235;\350un\240\327\271\177^\347\276\301tn\037\246s\3670\235\233\347u\356\035\022\316\255\363:w\016\t\347\306y\235\333\306\353\3345H87\215\327\271o^\347\266y\235\273\206u\356\031\257s?M\234\233\206\204s\317\274\316-C\302\271\235\257s\307|pn\030\246s7?8\2770\235]>8\267\260\316,Lg\031\257\363\n\353\254\362:\347p\202s\013Xg\0260\235q\370\340\034c\2043\f\246s\312\353\214\362:\257\200u~a\202\263\213\327\271E\t\3167\274\316*\020\341\234\202\327\231E\bg\033^\347\032^g\032X\347\025L\347\031\230\316*\230\316(x\235S\200p>\001\353l\002\246s\t@8\223\200\351<\002\020\31620\235E"
+	.string	"\3029\004\2543\b^\347\017\200p\366\300\353\334\001\020\316\034`\235Q\274\316\033"
+	.string	"\341\254\001\3269\003\2573\006@8_\200u\266\300\353\\\001\020\316\024`\235'\360:K"
+	.string	"\204s\004Xg\b0\235\037"
+	.string	"\302\331\001\257s\003@83\340u^\300\353\254"
+	.string	"\020\3161\260\3160\274\316/\200pN\300\353\354\302\353\214"
+	.string	"\020\316\007x\235\r\360:\267"
+	.string	"\302\271"
+	.string	"\2543\013\257\363\n\2573\001^\347\001\274\316*\274\316\002`\235\003\360:\237 \3019\205\327\331D\007g\024X\347\022\2573\t"
+	.string	"8\237\360:\217`\235Mx\235Kx\235E\274\316!Hp\006\361:\003\200u&\341u>a\235M^\347\017'\316\314\327\371=q\036\341u\026\341\3049\204\327\031\204\023\347\017^g\017Xg\017\257s\007\037\2349`:o\360\301Y\003\246s\006\2543\006L\347\013L\234;|p.a:/Yg\022\326y\204uV\262\316I\326\331e\235\333\327\231\035\301\371Y\347V\272\271"
+	.string	"R\306w\366\243\367\177cM\234+ds\332\302MyZ\373W\373X;Y\373U;V\273V\373T\273S\373S{T;S\273R;\264\335\250\035\251}\250\035\250\035\247]\247\275\246\375\246\235\246\335\331\336\354~\354f\354V\354F\354\256vG\273\333\272\321\272\325\032"
+	.ascii	"\314\255\306K\037\216\326\342i\024p\314Rv\353\315\0237\003s\036"
+	.ascii	"^F&E\233R\206\271X\213\217Y\200m\002\265\3224*\250\262\333f\362"
+	.ascii	"\300\336\345^-\376\205\201n\3224G\232\244t7\224\335\216h\233"
+	.ascii	"\003w\207g\371\026/\2654\200%=*\324Q:\026\212n\3324\033\206K"
+	.ascii	"\312d\243\364\253\016\200I\233|\206\322\253\250x\331\355\210"
+	.ascii	"\013\006\351\246_\214N\354O\016\345R\274\214\0321g\365\030%R"
+	.ascii	"$t\356\272\304\336\3044\002l\016\362\232\303u\360\022:\202m\242"
+	.ascii	"9`\256J\325\250\354Vi\304\034a"
+	.string	"!\325\213\330\217\034\007/\221P\372\346\322\364\224n\364\201\035\254\2715 J\242!\024\254\2710\260\240h\027\232\337\360\037\346%\207\300y\330\3551\304\210(\004\3546\274\207y\31128\017\2677|0\345\370\016/\273\325\031|C+\304R:N\024\r\264>Rv\313,\003\363\322\306i\360\362\206\004l\023\315\001^aT?\312n\275\206\004l\023\255\311>I\031\277\266\272\306\223\227Nc\002\260*\300\027\2279\221\031k\352\220\244E\322}1:\f\327\2205E_\271\263\242CT\264\225\373+\352\203\261\331l.!y\371\270\"\203\346^\263u\002\207\202d(\033\233\202 \013\233\315f\211D\356E^*\262\034\333Ds@P\032U\263\331,\321-\253(\013\271\213\030\366aK#\326\320M\233\346H`\020Za\263\231S\242[\206\241\354\326\221Bp\277q\023VQN`\306\2328\313\246\265\351\027#\r\312n}"
+	.string	"\321\365"
+	.string	"\242;\003baF7\007D\027\004\210\016\004r@*\3507n\317r\030\0215\233\315\245\036\035\336\035\220\224\256n\016h.\b]\003i9\346%\267\3507NA\"P\263\331\\v\313\334\202y\331\255\n|"
+	.string	"\275\3507\376 w;\214\276\232\315\346\222\271\177p\263\265\033/\273mCa\233@\t\b\n\242\362\200\262\333\250\n4H\350\001\312nG0\267p\247\365\032/UX\241\245\325P\272I\323\314!\361'0\0064\030\335\334iv\215\220\037ja\2639V\242[.@\353\314m\326g-\335\003\007\0202h\312\224q\2715\233c&x"
+	.ascii	"\312nyL\311\2165\217\226&S\361\f\2322\316 \024\224\335f\340\354"
+	.ascii	"\336a2x\244\331Lbtk6\233&8\204\262[\257\376j\341\227\b\314\304"
+	.ascii	"\354\b\340'\357y\306\330l6O\234\264\007\267[\2669p\273\375%\r"
+	.ascii	"4 \353kgu\325\006\033"
+	.string	"t\320\266\255\b\374$\224\315\216\265\222\307\270\277\2301\270^\257\327f\307\032\203\353\365zmv\254\271\305H^\272\331:\332?z\255\325:\255\321\332G\367\350\2636\353\262&k\036=\326b\035\326`\375\325^\335\325\\\035\327[\255\325Y\215\325;\372\252\255\272\252\251z\252\245:\252\241\372\251\235\272\251\231z\251u4\264s\264R'5\216F\352\2436\352\242&\352\241\026\352\240\006\352\237\276\321>\335\323<\275\323:\235\3238m\243k4\215\276i\233\256\351\031\375l\232\236i\231vvL\303t\223\257\034\311V\206\344Gv\344Ff\344EV\344D.\302\210|\310\206\\\310\204\\\345A&\302\202L\345@\006\344?\366\343>\036\302|\274\307Bx\312z\234\307x|\307R\266\343:\246\3439\016\302r\f\204\343\030\216\337\330\215\333\230\215\243\374\203\327X\215\323\030\215}p\017>c3.c2\346\301c0\274\220"
+	.string	"\027\020p"
+	.string	"\003\264P"
+	.string	"\026V \300"
+	.string	"T\020@"
+	.string	"N\244`\002\205\022$N\030aB\t\"B\200"
+	.string	""
+	.string	"\t'&\037\230\357\b\"\204"
+	.ascii	"\302\007\036x\350\200\203\r\332M\203\f0\270\240C\311\222dD\231"
+	.ascii	"t[\366\273\255\337\032\316_\270a\272\331\332*\307h/\307\311;"
+	.ascii	"\212g\363\203\310{\255\252&\324\235\366\024*{\006y\243-\001u"
+	.ascii	"\373x\002\225\341x\367x\332\360>\223z\231I\243\312\250\2365\336"
+	.ascii	"dK6\335<\250Z\003\021R\032\317\266\236\244%\233\356\261\246F"
+	.ascii	"o\261kw\230\007I3\217\336`o\322L\244\224\325\373\013\262\333"
+	.ascii	"k\004\236\036=IP\310\356.G\251&\201+\003\350\265;\356ik\206\321"
+	.ascii	"uh9\021\021\357\254j7\026\353\002\330V\323\23343\310>\231\217"
+	.ascii	"9\307\261\303\203]\243\215\236$h\265\373jF\220\355@\020\220\023"
+	.ascii	"\265\025\233\264\221\343\327\202!\241\220\007\001zWA\003\273"
+	.ascii	"\251\214\252\246\346\204\252\244<H\232\311\363\216\212\332\032"
+	.ascii	"\373j\204\222\353"
+	.ascii	"\326y\222v;I\345\354\274\233\352\274\231\350\272\227\350\332"
+	.ascii	"\274u\3505\373\344\364l\353I\202\262uC\243\3359\242z?\274\225"
+	.ascii	"\326\272\223\326\360\324\274q\244u#\245I\321\274\217\304\272"
+	.ascii	"\215\304\352\302\274\213\300\272\211\330\023\351\364\371&\315"
+	.ascii	"\200\261&9\216\032{\356\313{h\206m\306\313[\b\332\325\0354\323"
+	.ascii	"\305\345\r\264\325\375\2635\345}C\252\333G*\312\273\007\252\233"
+	.ascii	"\007\352\311{Gg\246\311;\247\003\021\343\027\027N\\T\225\r\023"
+	.ascii	"Bh_\\5ht\220\004-\352\276y\223f\210\330\223!o\233\256\t\362\236"
+	.ascii	"\261\323O(N7\315\f\316\214\r\357\031\240\032\3362P\032\335\316"
+	.ascii	"\031\032;\315\336H\232\271\361\216i\230n\276I35\254\210\231\031"
+	.ascii	"\316W\226D\341\233\242\323h\022\256\316\221K;\306/.\253\025\362"
+	.ascii	"\361\321\331\221\033\033\235\031\271\b\253\026K\374(\374\342"
+	.ascii	"R\2546'V\007\235\213\020iF$\"\350|Hm6\244\006:\027\0026\023\002"
+	.ascii	"\3529W"
+	.string	"\363\232\007\363\360\234\211\3345\013\336I\235\251v\315\201v\036$9\353\234\001\265jT\375\2655\373\265\2619\367E\233\207D\1778\363\2555\357\255\2519\013Ik\236\246\2419\353\2115\347\211\2059\343\2015\337\201}9K\275\232\355\274<Hrv9\327]U\r\351\266\232\347\266\246\234\203H5\313IE9\003\201j\216\203zr\206sj~sj\267&g\267$%\246\3466V\004\023+\302\2213\333\225QU\364\331#\320\253 \303\037\036$9\211X\022Fw=\314\022%9\213\234\327X\355Mr\016\371\263\331\033IN!\347\264;4:\037i=\274\316j\230U\005q\331\233\344\274!c\023\300\345\030\344Mr\332\260\336c\306\251\335\230\207\221\3134\tV9W\3471\266gOiF\303p\202\225\361\213+i\307\250_H\200\221\325]@\200\221U\316\243\037@\331W\204g\230\264c\324\006h\354\026\032\031\275"
+	.string	"\204\315\002a\325W\030l\002\f\022\361\001\b\266\n\202T\027@`\007 \020\320O\350u\nzyn\002\257Q`Ep9\006\351\275\034<V\204\0363Nw^\202\315@\312\006\240\316I\350\330\261\353\023`Z\2318d5L\332\261\353\021tm\002]\233\227\300\326\"X\022l\254\007!JD\332*'\352!~8\210!<"
+	.string	"\2509\t$$\355\030\365\tZ\233\240\211\371\007v\002=f`\300\342zl\310&\301*'\314\231l?\r\035\365^\216\023\373\002\220!B\332*\007\314\337!\233\021X\022\271h[\357\345x\261+8YUu#\227\213\320\325!\200`d\225\263\345\037\004\345y\320\006\321U%\355\030\265\00769\203#\325{9Ql\013\216\205p\275\370\344\035\350\330\201j\016L0\352\r:\006\252\333\215\205\301\311\017\360Mz2\261\035\b\002j\302&\301*\307\3115H\306\360\200&\265\302\257\306\244\035\243\316"
+	.string	"\203\f\226\214\372\002v"
+	.ascii	"3\214D%\216\317!m\225s\344\035JX\022\205o\212\275"
+	.string	"\227S\304z\300\221\262!\362%\t\tI;B=\"\344\326$X\345\004\271\262\223v\214:\371\323\356\005:O\032o{/\307\210=i6\233K\235\031gY\021\214\356zz/\007\210\025!D\211H\273\265\337\350\310\370\213\b\354n\363\256\3567\0203\272\341\236E3\204N\310\241g\215\347\r\r\251HH\307  \034\033O\247\032&\022\035\247\323\321\311\2706#\324Dch\306\206\220\216\313\310\031\211ww4eDM\323sb\2329\2321\352\244\234\257\031n;\311=u\220\3644\n\200'ch6\233\3546:;\315\r\244\2317@c\356&\346\233kL@\037\266\314\345\2475#R\304\350\213\214\207\b\257\020\317\354\022\304\206\241\264fD\n\301\276\330D\233\303\020\337\222eq\201xf\227!\226\313\245\2505#B\304\350+\2229\006v\313\345\310\rA\210\342\315\214/6\213\325r\301\241\344\002]r\273\375A"
+	.ascii	"<\bf\227&v\207"
+	.string	"\t\224\315\246\f\013\314^\2750ryR\002\340\273'\032m\f\213\361\253\213Vd\360\303\nWI\365\255\f\021A\026N\3023\273L\271Ty\333(\251\376\344I\370\rj\352\332\236\221'\357jYU\037\336\344\033\262?\220Fwu\335\336\236\230\0344\323\375\360oF\304\253\fO\306\035?|S\263\206\336\232DV\320\024\306\255/\r\316|f\027,\027-(\346\267[\263VQ\263\021\036\312Kj\bm\331\267N\375V\242\037\307\337\260\234\3738\276\033{\244:\242\315\253I\004\034\337\226\375\007im\177/\027\313\264\244#\002\257\322\b\215\"x\2618\220\216* \002Q\b\317\362\343\312\005\3023\273\200\261B(&\260\312\027\033\344\"&\242\005\036,\220K\231\222\375\311\200\313YC\275\210EA\370\326B\222y\030f\226\207\355y\021\363\341\222\226\346v\373\301wc\263\220?\"\237\004\"R\244\020<XcuP>"
+	.string	"\342\2609.\3216\227\2677\267\333\026\317\203o\251WuS\231\207\001\241D{\370\2242\252\214;z\370\246^\315Me\036F\355J\256\203gv\211cmPL\330\031l\215\213\334\234K]\235\333\255+\327\301\267[{\260w\025\347D\232c\370\200\003);\303\312\260N6\006\204\304\r\236\203\r>\004\262+.\r\236\331\005\357\257*m\306\324l6Y`v\321\373H\027!.\260\013\337[]\372J"
+	.ascii	"l6\233,t\313\377\370\220.\177\334P\335\262K\240\213\240\240\333"
+	.ascii	"-\b\326\f^\203\357gd\006\037\202\332\225VY\267[\267\323\025\226"
+	.ascii	"\007\017\345^l\024A7:\300\340_\346o\230k`\233\315$\030\032\261"
+	.ascii	"\273\220\314\257,\001\177"
+	.string	"\231\357\304.\342B(\002\260\331l\266\r\263\213\241\013\242\267\rw\221\336@\355*h:\3630\314cN\017\017\345\016j\034\264s\237tj\267\022\375H\177\203\364\030<\003\376\372\030\340\365\265G\270\035\376\257\355BbT\250\003\024\372\221\276\235\373\021j~\264\321\0309\375\312\027<3\253\204u\021\024L\246f\263\331\302'\332\034^\360\275\330\035\220]\371Le\036\346y\314\331,\fU\0359x\250\322\013*\263\301C\271\333\255\313Cj\267\r\340\276\225\351[\354\360-\034\n\375\323\357\360M\330\024hZ\373\243\211t\372\225?\247IX!jP\362\374\205o\250\342\222\350\262\350\262\350v\353Q\233\303\030\277\362\362K\276\031\340\362\350b\365\266Y\276\333YI\241M\302\252.\203\030|\344I`^\234$#\337n\r\201\246\264+'\232\025\301\300\003\035\253/2\307\005\017\345n\024\267\225~\3333\344\2215\273+\353\220"
+	.string	"O\276\362\371R3\3630\334\342\275\362\273\325\373\344'\233\322\376\236\2211F\316\263\222!\335J\377\315\206\020\352\275[\355\300{\326\316\352j*\3630\322w5\253\252\251M\223\260:\232.\037\312\037\304\351\030\215\374\220\366"
+	.ascii	"w\255*\333\231\377#\367\346\350\335O6\241\221t\325\234\331H;"
+	.ascii	"\363\255\314\020\245\353\314\223\004\212-:\337T\215\362\241\314"
+	.ascii	"\204\273\032\271\334(\356\006\326 m+\363o\3647\314\006\360\366"
+	.ascii	"\231_p^t\274m\370\304\350\333'i\022\323{F\306\3705\371P\276\022"
+	.ascii	"Ar?G\243\270\255\314\267fz|ey2\356\330W\272\261\226\351\376\337"
+	.ascii	"\267[\217$\225\005\312\270#w3]\366\377\357\331\237@N\2772\177"
+	.ascii	"\336\353\241pC\361\013\317\213"
+	.ascii	"\217\267M\267\334/>n\267\354\273\254-6\002\305\370\365\257UM"
+	.ascii	"\366\241,\001\367?\245LO\306\035\271\225\371\377\rj\302\026\t"
+	.ascii	"\340\237\367\314/A/C\3366\255\314\273\332\224t*\3630\374I\335"
+	.ascii	"n\275\001\353\030c!\214[\231\307\234\357\204m7\272\337\036\312"
+	.ascii	"\314\377\324\034\003\214[\271\333\335\233\3264\334C\353\370\355"
+	.ascii	"\246M\300\302\257\255 \374s'6a"
+	.string	"q\374@\034\353\306\276\266\334\370\337\032\031\251\242\374l\214\3220*5\3765\305:\267\257-\037\374h\2075t_[f\374g\204#Q\036\374d\323\021k\030\277\230\336\321\f*/\376/\256\262\212\220FDy[\374\\wyTM$,\376,i\225\035U\023\311\212\377\212\253 \350\263\233\342\247\342*\b\362\350\272\016\212?\212\253\030H\004\n\322\304\357\004\344:\366\265\325D\322\301\277\024\027\004\245\304\237\003n$l\372\265\325l\"\361\343`\363\252\241*\3427\212.\333\334\204\370\207\372\307\220\036\325\017?\020W\331?\"\255\326\303\357\223\006\004\250\303\277\203\266\206\366\265\3656\370q\272\253\203\364o\370i\264\326\b\032\343\317\340\257\341\273\371\031~\032\256\266~_B>\206\337\251\247e\203\352\312\337\304\273\"\244\202d\267J\207\306\032\331\035\337f\226R\267\257-E\366E\256*\331\032\tf\316\206\n\221\275\bWS"
+	.ascii	"I\367\243\220\335\220\253.\036\222\021\021\363\030d\257r\265"
+	.ascii	"\002E^\240\262\013r\225\375\233\032\021\271\360\307\016X\200"
+	.ascii	"\016]C\330\373V\030\221\026~m5\221\204\260\357qU\005l\003\310"
+	.ascii	"c\327\343*\013E \023R\366;\256\262 B\327l\302\264Q\211Vq\273"
+	.ascii	"\245c\2573\201H\216=\210\210\016Bt_[M\244\346\t\3352;\034{\034"
+	.ascii	"W\225\315&L\033\201h\025\267[ff\346\026\346j\317\214\320M\277"
+	.ascii	"\266\232H\315\023\272e\3666v7\256\2668\003j6a\332h\331*n\267"
+	.ascii	"\314\314\314-\314U\267i6\233\315\346\t\3352{\224\231\253n\221"
+	.ascii	"\"FD\315&L\033133\2670W\335\246\331l6\233't\373B\276\205:B6\003"
+	.ascii	"=\222\373\177\372\177\366\214\214\361+\013\300?\357\231_\216"
+	.ascii	"^px\333\364\367Z7\024\316\212\324X(\3630\314c\316\3663\231\030"
+	.ascii	"<\177(s\373\231L\f\036\177\016f\237jV\226\2318+\307\372\261Y"
+	.ascii	"I\365:+\227^g\245\021\353\254\3641qV\352\2308+k\2308+iX\347\244"
+	.ascii	"\225uN:\2328'\025M\234\223\210&\316\311\302\3279)\350F\315I7"
+	.ascii	"GjN\262\371Ps\362\207\0175'\327\034\2509i\366:'\245\274\2469"
+	.ascii	"\351\3447\315I\246\327\271=|\235[\300\016\353n\377\034\247\271"
+	.ascii	"\365s\235\346\226\257\243\315\255^\2675\267x\255\326\334J[\261"
+	.ascii	"\271\235\353js\013\327\214\315m\2317\233[/\326\271\365i\265\346"
+	.ascii	"\266\247\325\232\333\234Vkni\264Zs;\323j\315\255\214;\233YC\247"
+	.ascii	"if\337XgV\311\261\232\331\"\327jf\207XgV\307\311\232\331\034"
+	.ascii	"\326\231\275q\262f\326\346ufcL\234\377\372:\177\24435\277\325"
+	.ascii	"\235\232\277\352O\315O\304\243\232\237\372:?\340\353\374\177"
+	.ascii	"\256\324\374~\016m\376\276\327\371\371\232\254\373\2054Z\363"
+	.ascii	"O\273G\367\347\261\3637\371T\36339S\363/\371P\363\353p\240\346"
+	.ascii	"\207:N\363\347pg\363+y\263\371\223\232\261\371q\264b\363#\265"
+	.ascii	"Z\363\037\265Z\363\033\225p~\"\326\371\207J8\277\020\353\374"
+	.ascii	"A\254\363\003\261\316\377\303:\377\215\022\316\357\303:\177\317"
+	.ascii	"\353\374<)8\377\016\353\374:&\316\237c\302\371q^\347\267\301"
+	.ascii	":\177\r\023\347\247a\342\3747\254\363\333\274\316_\363:\377\214"
+	.ascii	"\327\371\237\257\363\323\2308\377\f\353\3742(8\277\223u\376\030"
+	.ascii	"\023\347\207y\235\277\371:\373\365u\366\310\327\331\255\257\263"
+	.ascii	"C\2328\373#\323\331\035Qp\366F\023gg4q\366\305\327\331\025_g"
+	.ascii	"O|\235\275\b\353\354\210\254\263\037\262\316n\310t\366\302\327"
+	.ascii	"\331\tYg\257\276\316>\370:;\021\246\263\013\276\316Ne:{\340\353"
+	.ascii	"\354\200\257\263\377\275\316\356\307:{\337\353\354CXg\347c\235"
+	.ascii	"}\357uv!\257\263O_g\327{\235=\357uv\274\327\331\357Xg\227\276"
+	.ascii	"\316n\307:{\035\353\354t\257\263\317\261\316\036\204uv9\326\331"
+	.ascii	"\2010\235=\356uv\270\327\331\337Xgwc:{\033\323\331\331Xg\217"
+	.ascii	"\276\316\376\203\351\354kLgWc:{\332\353\354h%\234\335\307\353"
+	.ascii	"\354=Xg?{\235\335\214u\3662\246\263\223\261\316\316\203\351\354"
+	.ascii	"c\254\263\2131\235=\314\304\331\301^g\377z\235\335\213\351\354"
+	.ascii	"]\254\263s\261\316\276\305tv-\326\331\263L\234\035\213u\366\035"
+	.ascii	"&\316~\365:\273\325\353\354U\257\263S\275\316>\365:\273\324\353"
+	.ascii	"\354Q\254\263C\275\316\376\304:\273\023\323\331\233Xggb:\373"
+	.ascii	"\022\353\354:^g\207\276\316\236\343uv\245\022\316\236\304:;\216"
+	.ascii	"\327\331\221^g?z\235\335\350u\366\242\327\331\211^g\037:qv\241"
+	.ascii	"\327\331\203H8;\320\211\263\377\274\316~\343uv\237\023g\357a"
+	.ascii	"\235\235\347u\366\235\023g\327a\235=\347uv\234\023g\267\361:"
+	.ascii	"{\215\023g\247\361:\373\315\211\263"
+	.string	"\333\274\316^s\342\3543^g\177\2368;\315\353\3543'\316.\363:\273\363\304\331cXg\207y\235\275y\342\334W\246sG\2368\267\225\351\334\220'\316\375\310tn\307\023\347n|\235\233\361\304\271\027_\347V<q\356\304\327\271\213\23487\342\353\334\207'\316m\370:w\341\211s\023\276\316]=q\356A\326\271\211\260\316-\310tn\352\211s\0072\235\033\360\304\271\377X\347\366{\235\273\357\304\271\207\260\316\315\307t\356\275\023\347\026\302t\356\351\211s\353\275\316\235w\342\334x\257s\337\2358\267\364\304\271\355X\347\256c\235\233\216\351\334s'\316\035\204\351\334r'\316\r\204\351\334qL\347\206{\235\373\355\304\271\335X\347nc:7\333\211sG_\347\376\361:\367\032\323\271\325\230\316\235\366:7\032\353\334>^\347\356q\342\334g\254s\2331\235\273\214\351\334d\254s\363`:\007(A\337:\"\372"
+	.string	"=\263\214!\022\036\226G\267\033\357@\237\224#\321\371y\223& \277\361I8D\036\237\"\022\033A|\276\245$7=\317r7\004\007\347\341\261\306\3309\"\231q\347\356|KIft\236\345\356\016\206\347\274\213\234\357\275C\274\024\034\034$1{\2038\337zW\033?\002 A5\224F\2542\374j|K\035i|;\004\322\250\350\006:\302\210\"\203\352rfr\363\375\226h\363#\360\021T\2634\202X\305\253\371\366*\234\321\370\374\352`K\240\214\303\347w\034\225\346Y\356zp\315<\340\237bt\346{n\210\313<\313\335\231;G\366PJ"
+	.string	"\224\3214\"\244%P\206\243;\277\345\362<\346Y\356\316P\\\207q\230o*\341u\005\315\247\021\273\2467\277\345\346\256\317\"\215l\214\224C\221\302\b\2208\231\310\35787k#$\033\212\023L&F\242?fD!\277\347F\322\036\237Ej\345r|f\031Q#>P\244"
+	.ascii	"\210\302H\217\2213\032g\216\337rd\215/\003d\035\343\324\310X"
+	.ascii	"N\222\361{\021l\361ePT\254\032\361\352Q\374\216\333J|\031\b\353"
+	.ascii	"\212\\\215d\001\025\271B|\031\006\017\261F\252\210\334\350\341"
+	.ascii	"\367\234\224\341\313\340W\2505\002\205\344rf\322\366\025~\203"
+	.ascii	"5\021>\213\264\217\220\247\3125\242\003\205%G\365;nDi\360Y\244"
+	.ascii	"C\270^t B\344\275\n9\225qQm!(\370M\255.\336@\365\032)\202\242"
+	.ascii	"~\353\t\005\276\fwu\200`#@T.g&\200\337\210>\177\317\"\275S\201"
+	.ascii	"\237\337{5o*\223\202\2072W\245}b#:Yg}\337r#6\206<\2134\b\013"
+	.ascii	">\276ojun\217\307\310\315W\342\336\367\333\310\f!/\203\334\264"
+	.ascii	"l\204\206el\372\3555\342\324\373\030R naS\231\207\371\252z\345"
+	.ascii	"\235)\255fry\337u\216x/\003\333\235\017%#\232\313\031\363\356"
+	.ascii	"[.Q\3721\244\321\035U\253*\325T\346a\216\036\246IT\213lh\273"
+	.ascii	"g\226\221\346R\265{\031\316\326\\j\252;S\347\303Tu\246\316\032"
+	.ascii	"\036\312\234HC]\335\273\240\335\212\2072\003\201\313\332\341"
+	.ascii	"\202V\202U3\320\321}S\005uT\314E\225B\340\006\347\276\365\362"
+	.ascii	"\202\274\b\356\202\344\332\224wA\006\345\276\365\352\200<\213"
+	.ascii	"\335\\\334\233r.H\334'\311\250xpq\3128\270D\270O\222Q\245or\312"
+	.ascii	"6\024\226\274\267o\351\017\267g\261\223C\201\262\255-.\005\333"
+	.ascii	"\234\022\215e\210\034\333w\335Y\364Y\354\332\032\177\324)\313"
+	.ascii	"P\310~\274\353H\005[\223*\305\302\326\336=\244z\251\341)\275"
+	.ascii	"\272\360\324\336\245R\271\322\264P(\263\322\336\335\243R\261"
+	.ascii	"\320\364\224V\312\252>\264w\017\251W'x(\263\217\335>|T\231\240"
+	.ascii	"\207\020e\024\nK\021\271\036\337uNg\317b\347\243\004ffC$(\343"
+	.ascii	"S.\351(\373$\225\372C\326\247TJ\"\373\244\032\325g\004\017\345"
+	.ascii	"\346\361)ey<\276\251T\236\251\214\fc\177J\243\246\2137"
+	.string	"\366-\035\022\373\020\\\353\302\002\225A2.g&\326\260\357\270\033`\317Rw\345\372\022T\366\360$\361\276>I\375{\364\032T\346\240\b\201\343\365I\265\277F\021<\224\223y\335]]\337\324\277E.B\345\215\r<\256o\257\031[\037\002k\220\3263\3130T\322\240`\177Zv\\\316\230\355\240\326\267\030\222\322\231\3651\352 \033\201\260\236Y\006\242\022\006\305\007es\3077\326\3673r\307\273d\177\206\221M\342Oo\032\002\031\211.5\177uS'\b\256\236Y\306b\022\3221\371(\243Q\306\243\f\253\f\253\333mk\275zW\355/\356\003VVb\036\250zf\031\327\244bb\325\273p\177^T0\311C\025\303\251o\252\357g\344\324\273{\177\\R\316d\025\305\240\324'\367\376\264\242f\222\324@\020\360\242\036\004\352\037\026\3243\351\327w\006\365.\334\337\325\323\357\241\204`j6\233B\236\336%\373\253\352"
+	.string	"\313\271\355\364)eyNG\034h\252I\336\241\230 e\361\ta\027m\372\244\335\337\020\n&\246\367?\240\251\314\303l\340\317G\003\275\364)e\324\245o\352_\006t\334$\201\240\b\001\030\227\324\361\311=\277+\006\032\n\375\246\372Ys\324H\266\241`\213\236\345x\027\316\357Q\t'\251\226\206\326\247\364\356\241_c\3223\263\350$\317PD\260\360$\315X|>"
+	.ascii	"6&\313\222\336\335\363[\304\361\314,?\311\261dXR\214%\210\207"
+	.ascii	"X\212\212\\\034\357\252\371%\372!>\372\031^\240\213\213\255\021"
+	.ascii	"\310\257J_\026`\337\264\262Xp\230\310\253\373\301\005\324g\\"
+	.ascii	"3*0\355F\372"
+	.string	"\277B\372\336\251\363\301\025\026\343W\n\034UM%\251.8z\227\312\367h\364\314,GI(\024\245S\362\211\005\207\t\200\315fS\211\005\272\344v\353\342\031\275K\345k,jJ.\241$\241I\035,OQ,SSn\267mb\321\273d|\213\023x(W7\321\247\224\345\021}S\371\f\207\236\231\245*\211\003%\2114\364\256\032\037\037\373\366\376\354\016\034\371\336\264\232\004\037\230\004\374\274\205\236\231\005\213E\313\333\206O\222B-\364*\320\r\376\216&\301\2075\215@\020W\022\350'\350\b\310+\331\303\223\b\364I2\276\242\037\260d\016N\364\347];\276\241\033bI\032(\"\2226\311\033\026\036e,ggn\267\355\340\r\017\216|AU\3151@\300\307G\362I\323\366\371|{\310\247\323\223\226t&cz\336\335\333\2736\3173\263\254\271W\024!\230\254n$K\264\215\345\355\315\345\261\333\263J5\307\360"
+	.ascii	"\226\270=\303\336yf\0269\267\021e9s\366\365\307\270\270\243\247"
+	.ascii	"3\347\026\331\362C<\314\371\326\371~F\346\274K\266\207\207S\347"
+	.ascii	"\022\356\350\253\016&\332\370\306\261\361.\331\236\264\206\324"
+	.ascii	"\245R\r\t\004<\253\361.\334^\035\215gf\301s\373X\036\2273gP|"
+	.ascii	"C\370\332\233o\032\337\317\310\233w\325\366\346l\364\334)\323"
+	.ascii	"\236^\236\233h\363I\262=\271i\3153\263\bq\245(\313"
+	.string	"\2313!\314-U\327\216\205\257\365\200\243\217\316\255c\351c\371c\td\021t\273M\236\325|'\"=\277g|\362\311\246\315\001\017e\f\232\351\366\363\377\314\354\371M\335\363\352\321$\366\264\246\rh\232A7\216\205p\004j\2665\b\367\346\366\371`AdI\244y\367p\257hf\321e\333A$\372C\346{F\346\223j{C\316gfit\323X\036G\240fT\202h>\2421\337\316\216\371\326n/\250a\254\256\031\024\265\214\254\371\r\323\315o\251{?/\317\314ru\305\230\002\303\300\\\376\345\333\345[\270=\237\026\030\267Ke\004j\226\243\001\231]h\\\256\026'\033\002\016\3105GW\313\335j\231y\266\324\334\2702\276\345[\271\225g\371\036|F\306\310\370\026n\217G\252J\303\200\207r\262\231\356\312\277\331\365q\345\233*\366\350\216!\211-\240C\303p\177\372ov\025,\2432\211\031Na\334\252"
+	.string	"G\030XC\270\022\375J\257\364*\337\325\262\034^\245\271\234\271\005\247E\307\333&\207w\231f\037\221\234\017\223"
+	.string	"\037=\274bPz\326\360?\b\214\324k\301\226;\305mL7\312\225j\341\361i\371\371q\273}\253\315\341\225\263\340\231[\206Z\212\274mZ\200\303\263\340\331\3503\022\207w\231\376"
+	.ascii	"N\254\216\205!~V0\304x\346\226#\267I\305d\311ej\301\241\324\002"
+	.ascii	"\205\272\3356\214\217A\322/Sn\312\303x7Jc\345Ly\327N\fl\254="
+	.ascii	"\356\321\255\261\360\205\20723\3123\267,\271J(&I(\237T\013\253"
+	.ascii	"Z\3013\2674\271G(&F\311\350\n>i\027v\224\200\027/\276\251aC."
+	.ascii	"\236\\\241\226\250\240\026\357\242\305\267daA7L\2717Z\252|T\360"
+	.ascii	"7\250\340[\270\260\237\024\\\271;-X:,>\005\337\317H\026\337\222"
+	.ascii	"\205\371\330\360\314-Z\256\215\026.&\240K\303\255\321\342\005"
+	.ascii	"\326\"\326\"\226X\303\333\360\375\214\254\341[\2620\036\260&"
+	.ascii	"\021\246\343\302C\231\275\022i\340\341\316@\t\361t\345hxw\317"
+	.ascii	"\013o*\3630\177eQ\004\254\370\224\025\337T/\351\fe\256\323\215"
+	.ascii	"\221\233\341\333=/9\025g\3555R\305\267T\2578\024<s\213\217\366"
+	.ascii	"\021\305\007\300\306\326\261%m\255%\032u\273m\361P\360\355\326"
+	.ascii	"\036\250^]\3151\034\240\315\353j\3524@\212\2676\021%\254E\320"
+	.ascii	"D\212o\304\303\023\374\265`\002\023\274\253y\r\025\240\004\204"
+	.ascii	"U\263\244\265\004\357\362\b\222\240q\004\201\200h\321\021\274"
+	.ascii	"\373\323'\303\367\016\266!\\\"\340CQ"
+	.string	"\200\270v\257E\356\207\b\336\365\321\013\301\367\0166= \032)\026\036\312\254S\203"
+	.string	"\004\326\025>0\327\336\301}\340\335\241:\017\374\005\360\202:\360\314-u\355\034J\020\020\316:\360\256\017\020\016\3345\022"
+	.string	"\005\n\303\001l\340\315\355np\003\337\327\250\006\202\250\220\201\357\244\262\274\f\274\253u\t"
+	.string	"\003\257\226\266\227\210\201wuz\\"
+	.string	"H"
+	.string	",`\001\261\023\025(#\003L\366U\340\333*F\001\266\024&0\201w\265.-\023\022xfn\273\332/\224\025\274\252-\202&\274Y\316\3556\211'\201\357G\255\b|\357`\3731\205\351C\001\002\337I\020xW\353:z\200\264\335\201\242\210\325\346\360\001\337\210U\016\370\013\364\250k"
+	.string	"^;\305\030m\300\367\034\222\314\303@1\340/\320#h\001z\255\323\231\315\341\002\336\205\353\372Q\3003\267\bi\227P\224-\214Kd\213\240\t6\207>\257\200w\345\2401|\273u/5\001\ri\226sa\370\326\347\233\246\210\323\257\334\366<\f\3571=\342T\0038\367\214\354\371v\353\r\250]<S\231\207)\361P\036\261;\241\365\372\226:\242D\177\322\337\364'}G\212@v\026E\"\351[\257\347\240I\217\360\205\256\026\007\n\001"
+	.string	"\371Z$\231\026A\023\356\240\315\341\013\337zH2\017S\224\200w\230nwD\257\\\317\201a\221\230\023\206PN\b\331\024F\255#r\036\350\307\3061\ni\202\013\217"
+	.string	"\037\224\036\002\330\323w\200.|\017\331AY\201\251\257\325\261i\0214\201\200_\241\251\3059"
+	.string	"d\316;UKo*\36304PN\334\230p\030U,\241\245\36153\0322\232\350Hfm\"\f\360-|'\225\005\242\320\322\240t\337L\343\031\340\273/\020\216M\264N\224\025\230[\376\332\230\226\300\026\346%\247E\320\004\227\333m\013\277B \034\033\311^_\270\270\241\270e\260\205\260\205\320\355\266"
+	.string	"\337;\242\211\\@1~\245\361N\325\212\0131\322,\347\262\360)ey,|S\265\336>HK\fD\213\241K\315\325\n\210,\343\327\242b;\270\302\267\216ZG\004x\346\226D\026\021\245\005R\335:4l\317\b\360-\234V\321"
+	.string	"\252\203;\210\b\016\016\340YG\255!\025"
+	.string	"Q>0\265,\262\177.?-\220*\225_\237\n\337\252i\005\t\340\231[\032\331=\224\026H\025\312\233\314/F\254\220\226\307\326\203\220\276\265.=v\332bm\271\272\3008\335nY\253"
+	.string	"\276U\323\372\241j\371\234\370"
+	.string	"|G\266\007\002\357\332"
+	.string	"\300l\246{\342\337\254\252t\342\233\232uu\276,+\t-\316\354\362t\251\361\266aW\313\222N\235\017s\222\302\rK\347R\224\224\031\204\232\013\202g\342S"
+	.ascii	"\362\242\303\304\277\320\304\302K\240@\342K<\007Mvz\317H\022"
+	.ascii	"\377jYr'<\263K\r\326\315\005')3\210\324\3066\342O\370~F\216x"
+	.ascii	"\3660\353\315g\254\307\304\204o+\023\336\251Yb%\350\260ji\214"
+	.ascii	"h>\372Jx\3660\013L\3043\273\360\260f(\001lC\n9\244\234\310!\205"
+	.ascii	"\003\266!\005\030/X\220\262\002\306\211\0306\324\300\342\206"
+	.ascii	"\021\330\206\024`\304p\261\242E\f\0308\244`\206\024&lC\n0V\314"
+	.ascii	"\360\242\205\tT\244\234PAC\b+Rp\210\221\302E\r,`\214\330\020"
+	.ascii	"\243\006\027+np"
+	.string	"W\264Hq\201\031RR\274@\301\310\f\022HY\221\202C\f\025)h\300\301E\212\026\027\300P\261\002\006\013\203\305\r7\260h\341\306\350\030))b\300hY\260\360\030.px\241\342\202\224\025,h`\021\303\305\212\031X\220\324\300\202\006\027/\030\020#\345\305\nHb\254P\201\212\024\031p!\001\0301R^d\240\006\027,\\\260H\321bE\212\0073\270H\321\242\305\013\025I\032hx\261B\005)8\240\222\242\005)\\\340\260\201\0257\240 \005\f\0263xh\201\303\005V\304H\221\222l\361\302\305\212\006\254\210\221\"e$\206\213\025-\\\324\300\342\006\005\274HQ\251\241C\016/P\360,zE\213\024)4\2641\\\340\360\202\0017\254p\341\"\205\r*Jb\300\230\001\203\034V\314\340B\002+n`A\303\213\224\f\250H\201\201\301\n\034nH\301\202v\305\n\013\024)b\244\230A\251\"\005\306g"
+	.string	"\205\005fh\241\302U\001cE\003T\244\300H\262\212\024V"
+	.ascii	"\243\305\211\025\300hq\302\005\213\024-N\250H\201q\"\005\017"
+	.ascii	"\374b\005+RN\304x\361\"\345\304\222\231y,\346s\364\f\305U\335"
+	.ascii	"\245_\334^k\245!\036\323\263\355\202\356\027\267\t{DHP\330\263"
+	.ascii	"m\203\227~q\277\351\233\336\337\311\376\243\317d\234U\315F\224"
+	.ascii	"\303#\3217b\327\021]WQ\224\002i9X\037\247Ng2\301\2508\033\255"
+	.ascii	"\374d\315\325Tf\324Z\003A\255\305)\315\017\241\247\214\031\241"
+	.ascii	"oD-\304\251\263Mk\355\313\002>V#c&n\352\274\341r&\023\216\212"
+	.ascii	"\216\226X\207g3\263\n\233\203\275@\231\200@\203UF\265 \226\017"
+	.ascii	"z\222(<\27546GP\007L\205\207\005zV'\347\037\350\375\254GtD\341"
+	.ascii	"\265\345\374k\031M\373\005\3522\263\n\234\363x\201~\3402\370"
+	.ascii	"\267U$\306\257hX\376?\377\243\022t\303\377<I\324\335\037\215"
+	.ascii	"\221\263}t\320(.k\363-Mu\252,\317\312\331\233w3\347\241Rd\002"
+	.ascii	"\250r\244\202\243\254Y/$\232\207\341\016n<{\303\332\374\337x"
+	.ascii	"7\353\021\245\350\335\234\315{Ys\200\250\245\323\343\241Lb\325"
+	.ascii	"\357\243\242\364>\337\210Y\327\377\321%\262\254\323\263\357y"
+	.ascii	"f\025(\317\177\317w\224\347\235/\013\261\206\241Y\007\374\352"
+	.ascii	"\241\334\271|\207J\223R\345I%*Kn\347\375\252\235\311_\347\331"
+	.ascii	"\241gV\251R\271\362\266\371\235g\213\376u\376\202A\2736\266\350"
+	.ascii	"\3771\353-\347\331\241\367\301gd\316\373Vw \230%\226\226\205"
+	.ascii	"5-{(w\240\253y(\313>\331\325c%[\375Lc\377L\357TMb\305\031(\307"
+	.ascii	"\336\253\332\233\316\232\254$\260\237\351\225e\337N\203t\177"
+	.ascii	"\217#UR\344\005j\002V\t\242\nX\210\022\303\222C\025-\036\356"
+	.ascii	"\333\370\307\371~F\332x\247j\017\202YC\315\343\241\256A\263\324"
+	.ascii	"-\321\\2\250\342\345m\303\001(!\242\002&\246\302\203U\312T\316"
+	.ascii	"\334\272iH\253\250\032\013i\232c\030{(/\355:\354\255\337:v\\"
+	.ascii	"\311V\377\322\322\273\223\023\031d\213\215p\177\351\337\372\336"
+	.ascii	"\324\037\210\022\373\363\247\016\373\032_\222U\343\335*$\231"
+	.ascii	"\207i>A\262\264\006\363\373\247\361%Yew7\377\324\177\032\377"
+	.ascii	"r4T6\3777\3376\377|V\\l\263\331l\366\327C\231\327\254\274>\255"
+	.ascii	"(\207\\{}M\337\331\327\274\033g\205\3653\366\2423\336\225Z]\351"
+	.ascii	"\341\375\363[A\253\252\247\271C\301{\232o\005\255\216~\246\216"
+	.ascii	"\205\360g\276-\263*zg\020\225\270\034\222T\344>\340\240\006\032"
+	.ascii	"\241\315!\013{R\247\356zh\211W\177\365[\232!K\357\374\352\237"
+	.ascii	"\020\371w\376\007Q\261+\221g\343\246\254\323\230\177\352\373"
+	.ascii	"\307\274K5\007\210S\217\006p\324\2036\227\217\277\267\216\373"
+	.ascii	"\034#\334\367\373\357\241\367W\206\327\367\017\363\357\367.\367"
+	.ascii	"0\377AT\330\225\306\310\371\337\367.\367\214\374\346\177\334"
+	.ascii	"\324\026\f\035\r\242\207\336\224\334\224\234\326C\331\204P\243"
+	.ascii	"\215\306J\376x\017\354\026\253}\225\\\373\327\361"
+	.string	"7\257\343\333\252\214zm\024\367u|\362\307;Q{ \372\345\343\0058\032\213\235u\365Q\362\243\357\372.\342\024XdZIZ\344\273\217S^\326\265\222\036\326w\327\246\270 \237Y%ZR\206\002\371\356\332\224\326c[\311\030\013\241\234\343\373\343\267\343\267|SXo%`*q%_+\310S\221c\002zP\003\254\315\3460\246"
+	.ascii	"\214Rs\215\365\0017\351\366m\217<\255\036\367\306gV\251S\221"
+	.ascii	"z\333$\335>\311\366\336\370\"D\277\364\236\221I\266w\034\335"
+	.ascii	"\001\342\024\017\002\202j\214\365\016\306O\256\275\017\226h\365"
+	.ascii	"O\337\031\177\204A\257E\232.\247_\373\352\241\314=\302\365\305"
+	.ascii	"\036\341\376\364}\361\235\250/\020\365\232\243\201\363{\222\302"
+	.ascii	"\233\302\270\325\352\241<\"\324TI\263o\235\272\255D?\364o\324"
+	.ascii	"\372\241\357A\215f^]\005\375\244\331o\020\325\325Fc\244\270\243"
+	.ascii	"\004K\005\257d\207\212\236\t\323\222\250\344*\252\370\036\324"
+	.ascii	"\036\244R,\334\030b\325T\211\317\254\"\244\204\n\205Y2\225(\345"
+	.ascii	"5m\216a\252\b_\t\324V\334\223\023\342{\221w\023C8|G|\346\331"
+	.ascii	"\312\316\320\373\341\267[;Q\224\306\250\212\343\177\350]E\247"
+	.ascii	"_Y\0035\303w\034\205\357\206\237\224{F\026>\b|REN\370\314*}%"
+	.ascii	"J(K\305\273\035p\314+I%I*\177n\bB\022\243R%H%8T\002U\004U\006"
+	.ascii	"U\b]\302oC\244\301\367\352'\243\266\b[\352\241L\327\007\377{"
+	.ascii	"\334]\r~\013J\375L\023\273\204\224\3174\212\210a\311\220\320"
+	.ascii	" \221w\037\237\256\202\210%?7\222\211\202\017B\331\223\225\232"
+	.ascii	"X\302\263c\245~r\355\3511p\261\004\007\205\215\300w\021\237\032"
+	.ascii	"\001\033Knl\334A\300w\037\237\026\377\236Y\345\261\344\211\022"
+	.ascii	"\202\251d\246\204F\305\252r]\201Y\201\371\303\262\323Cj,<l(\277"
+	.ascii	"\347edI\314\223\334T^U;\265\207\357~\221\313k\211\366\360[\216"
+	.ascii	"Uz\367\033T\241\357Y\245g\247)2\344\275\357E\030|F\016\371\021"
+	.ascii	"\036\237\344\232\370\370\376\237\262\230\036\312\374T\265\264"
+	.ascii	"\267g\303\256\016\251\261P\207\220\347%\342r\021\252\227#)\370"
+	.ascii	".\004qY\204DR\360[O\310\235\335\\\316\364yIdY\250\204\227d\364"
+	.ascii	">%\262\034<\301\350\033o\032Dh\256\251\367\274\354[\006\342\220"
+	.ascii	"\")\227\336\365\372\226~&(\227\276\245zxvr\205y\317\313\274\345"
+	.ascii	"\336Q\235Q\013\370\236\227\267\324+\241\005\374\256\313\373v"
+	.ascii	"k\r\346\204\344\246\215\205\317\313\271\245\024\205\033\352\261"
+	.ascii	"\2004\022\305\370\265\250\347V\234%A\304\246\316\233\277\273"
+	.ascii	"&z('\245\336\361\036\005e\324\345\334\222NDR\352{\256A\370\264"
+	.ascii	"9\377\326"
+	.string	"\204b\374\212\367! :I\357f\226@\342\356>\031\34747$\225\306\t\331=\227mlv\357\n:\211\005\325\325\375;}Me\036\006\350\241\314YS~\247\035S\231\207\021t\272\372q:\272oA\247\237\033s5\313\036gA\336\347>\031}F\312\275\007y\021\006i\272\234~\345\034\200\200\274\313}\b\2034F\316\270w q\237\344s\342\201\273Y\216\211%\341>\031\347\244\363Vc\371\205b\342\365\366n\334\322\325\307\315\355[p\251\247\rg\251\225\325\366-\342R#\233\316\362\n\205\211U\333\307\366-\342\322\"\217G?%\372-\270\224\370\203g)\205\022\365\343\335\262%\3045\237\245S\323\340\332\263\217K\206j?K\035P9\265g\371\226\364\322\202\226I(p\244=\373\270\204\347h\317\2742\2644Ba.\211\226E+E+G+8Vp\240\225-I\361\232c\330y\3503\257(-\203^\232B"
+	.string	"\275\220\366\036\357>\276\237@\234\336\343\223kKo\255s\366)eyg\337\202Kbn\366\314+\320e\017\312\007\300\345\316\222gei\245i\345i\345)\352f\322%-\273\346\030r\312\242\22686\006\311\336\313\310\276}\\*\3421\265\274\261\261\216\275\363\030{wmiH\254j\371\324@\b\246\345\314\222f\345\nkEK\313\365\260w\261\357gd\330\273eKAs\355v\\T8|\356`^+``\337k:\352\200t\t\035sS\030\267\332\370Z6\305H\360\332\275\336\277\276\237=\221b^\017\202@ \\@]<H Q`\360\330gs\330\365\217\250C\214\253\214\204qQQ\316\346P\251}\353\235\353\333A\032+\247_\331\265\336\267\276\237\221Z\377|:\300\262\316H\020\017\r\261\336\263\260\376\343tx\355x\346\025\037$U\rx"
+	.string	"\\I#\031\\Y\303"
+	.string	"\220\310_\275\357\370~F^\375\307\351\340\262\212\222\004\242`"
+	.ascii	"\370G\002\270\322\366\266\022\027\347v\353V\253\177\0355\252"
+	.ascii	"\206\264\265Q\\\247z\257\372~\002\t\241z\026?\352hL\275^3]\227"
+	.ascii	"z\237\372~\366\334\255\310I}J\240\217**\231\276\361\250O\211"
+	.ascii	"\372\026\324Q\304S\345f\343P\317\274R\227\343\035\352;\330@|"
+	.ascii	"F\222D\233yen%\260N\354-\257kX\b\335d\341\373N;\324\216.!\210"
+	.ascii	"|\311\302 I\305O\"~\262\360\033\bb\322\361\223\212I"
+	.string	"\353'\035\377\023\237BI\353{O\237\240\244\347\374\353\001\351\354\031\006\360\022\315\274R\367\242\263\246\364\204s\356\025<\227yEoE\210\022\327T&\257\n\260i\330\230\367\235\036\261*\243>=\033\323\366\364\335\0038\330\b\304\346l\263\331+}.\363\312\337J\340Nw\217\335\220\222\346\327\224:\257\254\361J\232\357g\017\t\032I\032\013!7\024\257\b\256\f\016\272\335*k<3P\351\363J\235\277G\241\225>\357?}\002\317]\331_\017H\247_g\036\312(\330\005U\333\331\372\275\007vAF\035\363C\372s\374\r\267\t\334\226\357[\232\036|2\017e\366\373vM\251\250\235N\337IeT\247\3675\245\226\357}\247;\020T\322yv\2735\211\335\317\264\261\020\306\255\035\323D\306\303\231\336\233\336\225{F\242y\322\351\223L\317\274b\270\202\350m\343L\357\356-\016Mg\036&)\257a\226\022I\302P\240"
+	.string	"&\347K\357\356-\3724\323\024\260\233\256\343;I\307\273\332\242\016\364\223N\320g\355\024\2579>\311\364n}Fz\216g\325\024\255\256\364\314+\213$Z(%\220`\221d\2554\256<\256XW\254J\3574\332\203\243\342\343T\346\345\245\311\365\244OY\271z\3227U\261\321\031\333\347\264\220\032\013]\304\234Y\206S\306\214\342\327\324\3710O5E\257\026>*\322?\237\024\322\307\300\373\321\b\327$\024\253Xj\024\177d"
+	.string	"\036\375\003>\035=\013\360\316\270\216\232\204\"\317tE\306\rb\343\324\251\362\320\027\322\037\251<\374i\273\321\177$\t\223\033=\013\356\254DM\0021q\n\343\326\034\212\236YF\r\022\035$\320\304\242w\311\020\347\210pH\222PB"
+	.string	"\222 \221\340\220\241\303#\303\307\307\355\326\215\022\275k\207\b6\364\3142~H\212PJ"
+	.string	"\374G\022\242\241C\304+\231\346\030Z\340B@B\257\302\235\037\013\202\236YF\020\311\215\213-\250\364C\325\212\212\354\303r\222e\031RjH\b\203\b\240"
+	.string	"s\030"
+	.string	"\f\005\"\201\242\312)4\003\024"
+	.string	"\030W\220PTZ<\220L$a\026\205Y\220+\023\001\n\b"
+	.string	"\002~g\351\230\356\217\016\366\341\250\341\231'{\005\205\304b\2777\b\fM"
+	.ascii	"\337\242I"
+	.ascii	"\037\320\300\321d\006\207Qpz\253\270\214E\263C\322\236\326B."
+	.ascii	"\204^\222\006\026w\373?\256j\2106\006\271E\2753\356\234z\360"
+	.ascii	"hl\226\207\341\275\354*\226\354\204S\271\306\002\022\337\211"
+	.ascii	"\206F\220\221\214Zx\002/}\31030\025\247\241\345\005\032\312h"
+	.ascii	"\272\316\371Z\310\213\204\350AP\n\326p\017r?\267\375\365\317"
+	.ascii	"\313\351\\\325\310\251\370y\254\361\025\257\303\006`$\362l]Q"
+	.ascii	"\335$\004Qw\264%\227>\263^$\tof\302\352\244\314\232vv\243\032"
+	.ascii	"\235OhZr\264\226zE\t8\210i7\002\f\241V\232\272\326\276\027hc"
+	.ascii	"\215:M\253\026\275@\\T+'\026\245Z\303\353\347\024\271I\265\233"
+	.ascii	"\353\335K\366\314\374]\373,%\275\356\200\377\340P\271\334\211"
+	.ascii	"W\203A\303@3*\2339\227\271\253\227\004\f\346\0363\334\313\276"
+	.ascii	"\364_\224,\346_\331\264\\S\256\023vQ\031.\023)\230\363\342>@"
+	.ascii	"\026F\256\346b\232\270Fe\001\364\210\204\202\213\022\223\177"
+	.ascii	"\007:\227\350T\320Nr\343\n\351 \273\261\303\035r\0324ktP\363"
+	.ascii	"A\350x\351I%h\316\330\262\001\313^p\"\326\255pE@\216\036\336"
+	.ascii	"\353\327\270\003\316C\231\306?\374)\304\210\241p\336\303|H\214"
+	.ascii	"?\211\244\352\241+#\024*^P\323\303D7J\310\345\022\231b\367\256"
+	.ascii	"U\033\267B\353\030\240\006\201'\372\226\300QZid2\313g\031\310"
+	.ascii	"\306EW\370N\"g\013T\362\024\311\216\214u\320\221\363\276\346"
+	.ascii	"\232w\206\201;\n\364\270\256\332\216\235\312HV\250\327\226%\b"
+	.ascii	"\267\253\025\333@o\034\264\270\376\337]\313\321\0355\273x\255"
+	.ascii	"0\\_\371\037e\303\246\"Dl\200+\222\345\244(\342%oO\320\274\342"
+	.ascii	"\377\0374\n\"\300\240\364\005\025`Q\204\\\276$\316\210\306\234"
+	.ascii	"\264\036k\b\356ckH\346\224\177h\371\304\\#\3405W*\350\230P\267"
+	.ascii	"\371\355\005\241\026@sP\361\350'\313\276\323DU:\342y\243\305"
+	.ascii	"\266\307$\013w\235'\240\320\377<\260\213\020\017\274\214\207"
+	.ascii	"\266\177\"*\n\376msH\232\200\201\025\252X\004\022\001\221\265"
+	.ascii	"3\311\374\234\251@\200\224h\272\266\267\245\037\201\252\354B"
+	.ascii	"\232\233~)\370S\363\264V'"
+	.string	"\354\004U\353\030\374\034\217\307\344X\255/F\0021\022\226\325\241\017|@\207\240\032\013\311B{\332MM?\375\2245\360t\263\317My\335\n\311z[\f\257\236]\320x\255\222\250X\301\264%Am\315\315\325\203\322\t\022Zm\3436\311\305\304\272\307\020y\257N\252G\007\260\260\310C\205\3056\377\330m\203y\362\204\265`D\261\035d\300\002\353\314\035\254\215\341\322\2046ED\227-\371\261x\201\367X\215`\035\32292\013\023\321\211\322\256CMyg\240de\267\272#\326QK^\265\375C\345\030r\325\006Gy\263\355\216S\244\201M\016-\341\372\330i\340<E\032X\344\324\n\202\342~\233>w\246\tC.\032\341Q<u\351\202\265h\277\370\365\260\323\334\016\355]\342\024Y\373\004\320t\345\026\326<_x\"o\2631\304\37055\314\331hx\036\247\2735\224<~Y\2726\267\360H}2\006\330l\374"
+	.string	"\036\243\223\210\0343\017\311\255\366\033\340\023\004\231\221P\332.\307o\231\272\372gV\344\310\366G\301\227\321\234\304\216"
+	.string	"\340\235\032\032\300\0046\366\243Z\274]\316\254\310)\324\031RE\"\356\323\230\026p\376\335\371\352\341i\250r\261\272\271\216\235Gv\037\211\022&\314\235\366\362\265\304\242S\346C\261\374UZ\253\216\fA-L\230\344_q'x\217\331[;),\363Uk\204\031-\372\340w/{\326\200\330\356\221\001j)\210\035$j\237f\274\026Z^\306\2511Gv\353y\260\325\273|\250\261^\242+\367%\226l\006N\213ps\355D\360\004\236\302\005_\204\256o\321\330\\~d\333\306B\220\020J\330\361\271q\013$\246\007\357\200\241b\325\356N\377\034\374]\226\204\326\233j|vE\261\353\343[\371p"
+	.string	"f\006 \207\334\b\007\374\273\302\236j\334\031\303h\203\215\r<x\2218\276e\301\200\236\310 \316&as\214\376\315\226\240\022_xPjD\251E\320\322\371\260H\354X\375\2376\262\013\307\255\312E/\244\332\223Y\2638\314\322\337\2139\327U\336\333\317\317g\325\211\345&2^\204G\310k/x#\006\260#\204\355SJ\217g\342_ez\333#\273aM\250\213\203W\272sv@\020\r\306s\256 Y&\227"
+	.ascii	"\266\026\364nn&p\347\226\215\203\236\213!C\002\357w\264\234\237"
+	.ascii	"\202\030B\221\0021\003\024\241\302\321\371\267\242\261\310d\246"
+	.ascii	"R\203L\341 \037\264\201\232\240Q\273\214;\017\367\037T\307X\337"
+	.ascii	"\215\274?\2564\305\341\337\324\223\210\b\306(-\235\236\027ME"
+	.ascii	"\273k\3318g\035\336\245\323\007\337\020X5\352\245\222!\256r\241"
+	.ascii	"r\233\374\013K\222\t\212\\\273U)\004h\263h\327=\360T4q\t\215"
+	.ascii	"\227\"\207\241\231\215\006C\023z]/\272f"
+	.string	"/*\332 \356cJ\337\235gL{S\253!\024W\266\341\324\f5&\272\211\225\020n\024b\n\004\263\277%^t\007\177\3223\bHv\313\223E\265\357\272Z\022.\262\274\250\\\312\036\226\346\001\364+C\347\360\201\223$\275\0164\262\260\215\210x\306\006\260\314\350\036B3\2500\001K\262N\232\337b\261MQ\357\301\277\216\177g\362[>\313\005\321\323\373 \005\026\216 wY\211\217\002\367Jo\321\271\332\202\306\004\267\275/\037:Ar\206\350`(\263\242\234\017\306/?\302\347\261\0050Fu\367\307\322\230\254\016[\321E\324\306@\026\215\231\025\370\2659@{\351\304\331\335\2778P,\322y\3601\021\227mt\242[D\255\205\fa\274\254\201\363\332\301\007E?%\246\021\006\223k\034\026\376-\034\266\357'\215\241\254\231h\fB\235\314\215\27309\016\362yx]\306\253\271.G\230\341\003\367\244;\243\273\211L"
+	.string	"\201\025\261\207\334\327\273Z\377u\333\347Y)\001!\204\321Y\304\001\2749\035i\222q)\364<*\237\277\004\252\320\207\221J\f`k\261R\370&E`\323\263P\177\030\260\017\035\310}\316\204\033\201\352\220.\225@X\356;\2075\360I"
+	.ascii	"\3713\342\246\373\r\026nC\252\027E]6)P&&\355!HF\"\273\224\326"
+	.ascii	"W\020\265\257\262\002\262G\273\305\220-\005\302\306\353\372\344"
+	.ascii	"N9\310\257o`\336\262\303\216\300{\022(S\304gI\177\352\232\255"
+	.ascii	"\305\n\245t2&\327\2411\252\232\221\341\364\217M\212I\b\346Vx"
+	.ascii	"\234\0336_\311AK\200\202\377\361\037\t\311]\245\334\340O\224"
+	.ascii	"~u\355\3030\240\311\213m\207o\312\245\343m\244S$Cm\227}\341\264"
+	.ascii	">X@]@\034\276\324w,~\275\261\373C\301Z\275\241~6\313\255\341"
+	.ascii	"\b\006\266\313V\256OW\013E\"\021=\n\232\003BZ\035\307t\030\302"
+	.ascii	"\n\023z\354\271\323\321\0027W2\025\247*\333\233$zs;V\021\263"
+	.ascii	"V/\336\270\275L\301\024\006\367\025\270\316\204&H\225\317\313"
+	.ascii	"\222\327M\2672Y\037\224\216}\240\333\020g\231LRm\243\031n\371"
+	.ascii	"\270\323\3237\316q\212\352@$zx\210C\313aQ\017\216h\270\305\370"
+	.ascii	"\223\216)^\236\303G\340GG\266\261\214\251\351\300\274\016\203"
+	.ascii	"I\017\272\017\030\274\246\236\326\363\006\201\262:K\244+?1r\267"
+	.ascii	";\250Q\013K\271V\224\331G\210>K"
+	.ascii	":\236\211\tp1\233\201\016v!\004\221E\033\340\335\rH\332\200\263"
+	.ascii	"\tt\002\021\201\370\312(Y\311\322\024KMr\220\337\355\220\237"
+	.ascii	"\201\265l\316;{\317\322\316.\233k!\302\224\210\310:i\f\320\213"
+	.ascii	"\021(>\227v\232\362\271\215w\2611\226\t\025\236\305\247\260\320"
+	.ascii	"\025b\030s\242[3\202\"\206x\003\375c\313\344J\324D\312^\316\337"
+	.ascii	"xOV\240\325\241g\275\314\241\221\357.\bv\003\005\017L\270\243"
+	.ascii	"\270\253i@(0\ft\364\351\025;e\344\r\202X\035\004Q\350\325\376"
+	.ascii	"\261r\212\307,\323\320\204\370\242\253\3464\261q\312z\024Lp("
+	.ascii	"I\345\322\200F\360\226a\365\007\234\266`\216\340\002R\004\354"
+	.ascii	"\026\356PW*\322\254)JA\030\212\025\t\255P\234\237\r\311\256\247"
+	.ascii	"!b\331&\345\016R \022\002\367\233;\201\352\021^\207\325t\013"
+	.ascii	"\307\245\316\340\315X\231.\262dR\030\b\247|S\002\317\317M:\375"
+	.ascii	"\275\200\367\220\345\300\332\035\207i\367\357Z\270'.\226\261"
+	.ascii	"\211\351\007:\322\304\257\226t\336>E\177\202i\030\347\366\316"
+	.ascii	"s\bi.M\232\250\b\253\360\245k\213\344-.\006B\006\300\007)\201"
+	.ascii	"\215\345 b{\277\211\200Y0bN\253\267\244X\f\305\272p5\235\316"
+	.ascii	"\006\217\271W\342\305\375t\233\241\205\b\314\350\327\f\263\307"
+	.ascii	"\321h\202k\203)m\272q&\t\"\232\007\212\223\340\331\253\002\372"
+	.ascii	"\r\273\375z\311\\~\322\275\325\242\201\377\260I\330\346\003\344"
+	.ascii	"m\330\353\240\224w\231\231]\030@\367a25\224\024\204\n)S]n\350"
+	.ascii	"\345\316N\234n\316\307\235\272\016$\374y\021\326L\342\303i\236"
+	.ascii	"\337\243\354\303,X\344\364\333.Bg\030\332\346\274I\034a\304\013"
+	.ascii	"]Y\034\230P\006I\f\243\351\263U'\025\035\275\334\326\227U:J\251"
+	.ascii	"\222\213\244*\032\342\316\215\360)\316\004\307v\325@E\337\240"
+	.ascii	"\005nj\f\244\031W\311M\223T\250\353C\330\324\212\225\025\206"
+	.ascii	"cD\245\251\022A\331`\220\211\024\216\311Z0K\210\224o{\211(\002"
+	.ascii	"\357\305\2707\355`*\276\300\031\324\304\025J+\222\215Xh\366\331"
+	.ascii	"\253t\214\252\214\304q\306\326*,\210\372\234\360\301-e\001\303"
+	.ascii	"$"
+	.string	"RRD[X\355\313\352\241\2132K\246\030\213\013\375\262\025\343\327\276$W1Q\364,\220\314\253\267\273\333?\177n\347\312\202\235\330\304\205gh\211H J\037\355'\245;d\235\224\342\341P\374\325\002\370\3172\330\267\371z\3632\0251S~#\245\214\364\206\265z\003\n\315b\263-\016\326\r\200\nR\274O\237r\022%\365s&r\366\354\334\374\336\335bBe\276\365<\246W\231\314\263\t\374\264\360\351\2672*\222f\257\023B\204E\nA\256\206d Z\"\334\210\276\264\367\224~\363=\300d\r\251\231\314\212\374\334\220\312)\025\332\312\255\242-\2341\331\026GZ\366\022\005\273\361\f\2022\235lY@\246i\357\266@\220\226,\260\323\371n\275\202\377\002\212\264\337'\344\331]\204f\350\2351\210\361&\200\031\317\245\233U\312\3256)\301\237\276\313]\231:\262~$\301\204\\\341\206\022\234\222'\226\307\312\227\204"
+	.string	"\033\317\002=\224\201\346\314\317\364"
+	.ascii	"\037\325<\247v\223%\267-.`Y1\201$4\260\270\206\327\346\235\223"
+	.ascii	"\251\354k\312\364\246\230\331\376u\265\277J\bA\303y\002\261\222"
+	.ascii	"SS*\234{\236\250,t\273`\305t880\273\351\271\242\250y\244\214"
+	.ascii	"\347\303\271\244^\231\342?\243\366\242f\335\025\376.G\372\361"
+	.ascii	"f\311\323&-"
+	.string	"\206e<\244\214\305'\317\034b\312?\016\tNq(\276XA\306\261#\013`\211\302`\264M\n\210\3713\034\371\031\212\326\201\375B*\303\006\345]\3609\341m\002\017\2145]\352\211N@J\003\215\027\004x\226\303\020hl\377\267i\200\021\017\"\003\354\232\364\301\327\373\370\307\202\2648\304\021\251\302\243\002\250\341\002\374\037\272\223\232\375m\360v\201\300\350I&\246\364`\230\276|b\337\t>k\n\272\226(\3311\0172\023\243\302\343`\262[37xE\2208p\300bS(\t\332\036]M\237A\341V\377)\336&\374,\372r\3674\003\217;\f7Z\261\370\233t5\004\256\355\034\025Q\005\257\002\241eQ\243|\346$\227&v\370\224\017BP\326*\217\220\221V\361v9{\346\216'\334gq\\\357\030\013\275\353\205(Y\322\325\343,\023\b\316J\023\223R.\216qD\224\245\352/\340\245a>/9\211("
+	.string	"@ \306*\350Q\2606\252$\265\311\006\3712O"
+	.string	"/\261\357.\"\216dAy\013\235\341#\351\021\224]\253\346TP.;\213\321\300H.\332 \267\006#*\2246\252 a=\270i\214<j\354\275\016\004Z\223\327\003C\205\366\201c\310\263\b\351\332\210O\021,\005\267q\342\272v\375\365\260\223Z_\031 n\1775\341\240QoB\343\322\212\020\356\213\260\237X\2446C2r\202\206%\227\270\216\311qJ\202\340\020\2706\264G\034$\035%\310\t\275Q\264\224SR\300\271\333\225"
+	.string	"\263\321\227\343\232\253\024NW\265\246\364\"\2242\035)\255\203\016\2656\346P#\r*\312c\024r\347\225\177\r\347\027r"
+	.ascii	"<b\033\320\322\2275\250\201\341\022#\227\227g1Y\021\036\366\017"
+	.ascii	"\177\244\033\260\245\237\024\310\264+Y8\271\357\317\276wka\270"
+	.ascii	"\207wu\272\027T\330\301\024(\314\032C\236\202\350\220\263g\n"
+	.ascii	"f\002\267\276\275\224\261\354\324\217\327\251\367\304\317\201"
+	.ascii	"\255h~`\301yZ+e\370\310\235\024\213\200\305\241q\r3\275d"
+	.string	"\342\214G@\262\302\033\272=i\236\006\030\344\313\353\2213(M]\025}U\2633H8\013\367\322\372\242'\b:\004/\254MY_\303\367\033\006\252\323\366CI8\244\211\323\327kRcT-{\242\227\242\207|\355\215\354\276'f\347!`w{(\356V\\\263\303\331\303\267\236\033\240\316\t\311?\245.\334\r@\202G\202f\021L\t\037b\237\020\"@\002\203\247\300\272#\003 \232Mhe\325\037\203UxrR\200w\f8j\177P\234\016(\177\306\"\356\336\246\006\356\200\235\245\257\223\302]\361\357\253\210\353AB\313\251w>\031\036,@\251\226\031:\226m\031\325w\203\201\321\005J\256\033jn`RK\210\357\033\023\200xvr\0046YH~:\303\035p\021\373Aov\353q\356\357\303\243\257\371{\373-7 ]\377\245]$\331\251\362*i]\\\216\367\023X\361\212\031\332\234/1^D\312%\341n"
+	.string	"x\211\234\360:\376\364\341\004~X-$\022BQ\2001\325q\004xM\227\304\351~:y/\313^\023\215\302\2334\270\350TW\210\365\372aA\304"
+	.ascii	"\017O\340\367\375\345\204i\327\351\351wqS\3309\1773a}\204;w\305"
+	.ascii	"\006\347\261$\336\002\320\356\206\3548\315\230\204\264uX\355"
+	.ascii	"\226\230\177\325\274-\f\331\221\0075\214\316\262]y\363\315\347"
+	.ascii	"7`\363*Fd\230\252_1l\361\317\314\235=A\263\211J\232\316\320\003"
+	.ascii	"\305\207\r\347e\353RD\324\204\243\035\242>\314R#\315\235\335"
+	.ascii	"\256\334!\373\2244@\350\331\356\342\347^\216\013[\265N\251\237"
+	.ascii	"\004\b\001L\354\312\364\251\353R\334C\271\r*k\350)UVi\020\r\347"
+	.ascii	"\016C)\377[\033.\342\005\220D\031tx\b\241\364a\016\313=v\244"
+	.ascii	"\202\250\037\217\242\340\026:\316\2161\235+\303\266\244'L'\f"
+	.ascii	"s\244m\033W\305\232"
+	.string	"\006\240\225\357\314\336\005M\270\313\004v\257\366NE\212%,\3655U\335\270\0018g{b\263\224\344\035\217!2&\365\314y\224@\013\207\232v}#\241*\370\234O\314\\\306N\207p\236%\003\313\330A\035A\205\311\fL\365>\036\344\344"
+	.string	"\232\002\344\026_\377\3214\266\206\276\374\321~\227\274n\f\347\026`\313ab_\243\016UT|\273B\016\260\217\214\370"
+	.string	"\230\336I\216Z9\021\b\243\235%\237\335G\017IP\016\343E\037DlJ\377\204\342\311\002\246\334\227`\230\256\365\027\300\252\323\344Q\342\206O\3442\247\210\302\230\267\340\362eH\205\350\226f\315~\033\211"
+	.string	"\345a\231\034\352\273-\321\270\3348x\246%d\022\245\231\223\026y\252\356\376\210\315c+z\235\233\377\347\267\022Q\370A\243Xk\214%x\262\244G\335V\206F\b\300xj\024\201\3154)+\264\031H\355r\013\207Z\f\241\262|\362\022Dhwv9\257\233\267\345\306A\266\205?=\024\310\315\227jF\033\366\233\235x\344\003\037\203\270}\211\321_Wd\361\350\n\202\023-\340\033a\342Sr\275\372'\22510\275\243gm\032^\276<\266P\025\240s\372\316J\rH\205\200L\272iW\322F\212\020\263q\361\016\265\231\252"
+	.ascii	"\032vWt\027@\344t{kn\255M\311\361\177Z\203}k"
+	.string	"\234\311\304\216\222\305Q\230jM\374\262\207\333\372\266\251\367\235\343E\330\300\224\350In5\315\033\247Lx\276\264\026\316\250\333\305\252k\270qH`\337\306]\213\331\027\231d\016\376\304\027\214\253\212C$\352H\205\300\257w\036#]0,Xi[\3133\006*A\260\263\276T\201\224\304\227\"O\265\312\350J\2759\034B\005)\002)\366\360\244)Ta\022\202\265gfj\202\202\"1@c?\373\320M\003ZB\262s)\007]\304]\2228p\027\215\313&\330\245\347\367W\215\315\310\355\004@pb\247\232\362\006\f\346\314g\351\005R\"\227\243\036^\365\312\\2\022`V%?<b\214\237\n\377d\230\017\341\342:\360x\221\355\226\007\302\272+\317L\277\222\004\364%\013b\323\017o,\262\002q^{\366Bq\236\230f\213\243\333+U\327%\240\217\310wX\234q)%\200h_,\300\335\207\314\354\207\021\f\247\""
+	.string	"\343\226\234\026\233oNZ\025\220G\327\300J\273\326G9\307\311@Z\372\271\220K\373\316w\256/\356\020\251\360\343\373\fq5n\267\337\210\3249\335\027\n\nKF\255r\271\243\224M\037UA\352\317\0355\333n=\242\266\354\344\240\223?\230\202Y\027\364\2173\247\363\301\273\272\002\251\373\223\"\205\273He\234j\270\342M\f@P\236\026.\f\357\316\367\341J,\026\006\0050\232;.\345,\016\224\215B&)\361\322\2629\300\262\333(\262\303Q\223\211\020Y)\321d\037\271HQ\212D\220\337Z?\364q\261!6\373\322<\240cL\363lU\301\303\r]\376\253J\231\333R2k\315\221\254\251>NE\343(\256\241C\251\343\306F\344j\273\277\017/\267\223\003\211-\351\243\354\306<\206\366\375_#Wb-\206\330\236\030\007\305\210\276\033\301\227\260"
+	.string	"f\231Du{\022\211;\221\334\346WP~K\177\210\235\320\272\277\020\036\027\231@;\207\027\007\263_"
+	.ascii	"|\253\247\274 \3364Jq\336q4HF\017n\267&\017\254\201\206f]\355"
+	.ascii	"h\336s*\337\330XK\367\365\366%\206*Y'\367D\200%\263G\321\204"
+	.ascii	"\024^\be\361$H\334\230\211\261\265\371p\340\273\342`1\265\262"
+	.ascii	"\300]5\211_\251\317i\362\355E\2459\340\254_Y\002\315\243\225"
+	.ascii	"v\234\213In-\204C'\211\372^\001"
+	.text
+	.section	.gnu.lto_mspCommonProcessInCommand.199.e437537c03190dc0,"e",@progbits
+	.string	"(\265/\375`\203\fM9"
+	.string	"Z`8\025?@\350M\007g\026e\250\332\022\243\032\377\013+\002\216u\222\225P\233^\341"
+	.ascii	"\222=\221\030-Q\215D\245\023No\310h!\n\235\212\274m3x\315\030"
+	.ascii	"\202\307\233&6\332\336\335\366\336[\246\224\002D\001\"\001E\001"
+	.ascii	"uZC\243:g\272]N\373\034\247\323n\334\0164C\341`w\004\f\f\t\025"
+	.ascii	"\272\034n\007\361\330\314c-\022Jyl\016<\355\021?O\321\356\256"
+	.ascii	"n\267\273\3258\306\275\013\251\033w\353\3627=\242\202\031\254"
+	.ascii	"\215i'\347\246UOh\376\320\246\263\351\3626@>\230\301\276\252"
+	.ascii	"<\370y\032\374\376\367\245\220fs>\353\263\223s\266\352\004?O"
+	.ascii	"\3258[W\277#\210x)\211\340G\255\210\033\245\234\363\025\321\207"
+	.ascii	"\252\247\250C\251\236b-\355\2166\275\323\177\375)\350\324\304"
+	.ascii	"\004t[\366\267\252\251\020\305\377\266\037\375\351\315K\214\241"
+	.ascii	"\035b\333;S\222\346A'\264A\236\234$\017D6\005\035\216yA\372\233"
+	.ascii	"W\205!\253\362M\251\235s\215\311\275\322\034hGg\315]\261\346"
+	.ascii	"\234U\332\2759j\313\244\250\303-uj~FF\005\263U\277\025K\311\024"
+	.ascii	"_\003\221Aq\223E^E\2119"
+	.string	"\347\246d\030J|\261$\330\247\301\265&.D7\2549\223\346\201\310\266\240\270\r\234<n2\354\321\025\213\216\243a\032\301i3$'\331\304q\233\374\212b\246\006s\316~F\206\206\376\212\225s\356G&\225xCy\267\333\350\356!\335\356X\030\273H\366\340\364^\332\242B(Vb+\374nP.^\274#\037;\035\027\342-\227\334y\037'\036\377\222\347\2343\306\312\366\323\376'\203\02109\363iw2p+G\2734`\362\264\353\251r \252\247L}\315n\257\353nF\277\234\217n\306\310\2118\241\335\261\235\311V2\003O\035`\"\221\357k\007\330\261w\301\253S\244\317\353\237\035\374\005\270;\206\326;\262\375\315]\351\254\273\333\313\003\303\307\356\346\327ce\267\343\347\363\371l\234\245\273\277\263|\351\316\302\343\274\255\274\215\273\003\177\343\276\240\277\025$h\277\021\264\337\007\332\357*\364\233\310\364m\200\375."
+	.ascii	"\374\246b\277\t\264\337S\355\267T\373=\200\375\216j\277\005\264"
+	.ascii	"\337\001\330\357a\373\r\240\375\206b\277\205\355\367\223\373"
+	.ascii	"\035l\277\235\334\357\246\366\233\311\375\006\266\337.\373\335"
+	.ascii	"\262\337,\373\375s8\357\225\375V\321\357\224\375F\321o\314~?"
+	.ascii	"\372\355-\202\314\371\022\344\346\207\0136\324\314cO\276|\227"
+	.ascii	"\316}q8\3678\377n\357;P\212u\364\024=I~\354MS{\273t!\344\204"
+	.ascii	"\203Nx}\304\214\362\331\035\217\371\304m\372\362b\3105\216\t"
+	.ascii	"71\341\325\311L\002\327\276\b\020\nh\375D>\354\025\363\222y\315"
+	.ascii	"\274#_3\252\247\253\033R\317\305@\004\277@\315\273\346\035\351"
+	.ascii	"\342\225n\371\274\344x\311w\327\240n\013\236\366\330\357e\307"
+	.ascii	"\251\340\372\332\237\255S-\371\272\253\260r$;=y-F\277\257\305"
+	.ascii	">\347B\272\345\244=\256\266\214tw\374K,\037\274\324\203\267\314"
+	.ascii	"\363k\026w\277L\227t\311\312\\$HSn,\236\242[\312\375pw\007w\304"
+	.ascii	"'\227\327H*\356\207\245\234K\246\212\273=\270\"\020\376\344\204"
+	.ascii	"\217\222\231\005\267\203'B\035\262\031\364\365\306\226s\306\200"
+	.string	"\310\023\221h\023'\036\205\352\351\200EH=\025G\261\264\\s\007\206\217\315\234\363\232:!o\024m\217RW,6\310W\214\337\360MR\261\262/H\021\272G\251\254\034\354\203<\001\026\333\241&\300N\222\370\230\256G\347\234\223be\273\267\036\2353N\210\263t\2121\366\2636D`_\251Q\234b\177\340\202T\374r\006\303\320\016\310\003\255@\235\213\247\315\"Ku\244\247\355Y\030\002\2429+\034M\003\302\225\321H%\243\306\377\330\222\221\203\204\207\017\035\270\212\306\034[+\266f\304\340q\243\350c\230#\204\321\270\245U\344J\301\303XL\241\303\210#\250\305e\304)V\234\220\201CK\3252n}\320\3422\256\255\005A\207\021\307U\216\0321p\\iq\031\257 \f\273\250c\213\353\212G\261\310u\3456\275\034\3158K7\231\311\365\001\335_\325\337\\\030\314\302\n\260Xw+\300\215\345\205\277\320\247\r\277"
+	.string	";fq\344\025{Gf\341oKTv\027v\307\377\217\\s//\210\340\311/\327 \210t \r\232\003\217\252\312\274J\005d\252\03450\353\303\304\251\353T\"\346j\373\003\366\225\210\330\361\230v\006\220<\230w\354K\001l\240\200\037\252\344sy\227\250\021\"\200\251\260\023pN5y4-j\334\024V\235\314=RO>\013\226\001X*\n\017\300\253[\024^\351\230y\004Dy+U\036\212\007\300\002\2068\300\260\016@\331Oy\225\006\016I\371\262\227J\225\367\312\025\325SG\352\265\376*U(\f"
+	.string	"{X\230\257\177\266\020Ca\225\220\020\253\217\230tx\230rM\2309\246\037\216)\306-\2551a\245\343\234\363\021\370\204\345\231\274\312%\213\220zOx\265\304,\013jy2 \026\002\200\366\250aD$\221Rh$\020\021\221$I2\034\260\002\221\241\"\326\001\022\240\244A&\2312\314\020\211QR\032\366\rO\r\340\f\201UU\337x\225\375\306\360\022\360\006n\003\347;\347tws%g\334\216#\353\217)\313\313\007\254g9\004\312\224p\221\004\032n\030\353\371P"
+	.string	"\020\360\033"
+	.string	"\336\347\031\244\030K\310\301\217\022\355\376B\200\274\363?<3j\243\201\003J\371\224i\317\342sp\232\206\234\250co\34342\233\025\031\255\275w\212\t\276\357\331\207\345+ =\334\366\334\216J\303\221\307/G\026\251\020\r\342\345\250D\223\212\257H\022J\224aH\360yv\234X\277\241\323W\001\020\264\"?r\035l\\vNx\327\020\343- \350\326\230\373\241@\300dNM,\220\346`\205\200\240\370\357\375E8\t\243\001\367\212\034'9\306\226[M\316\022\237\032\374h\261=3\312\262\324\244\270\276\341\302\350d\r\221@\311\033\005\206\250$[\363\350\351c\373!oz@\023N\260U\f\235]\024\005\215r\325\335\270\247}\\\036(\274\221\343\025\221\342&O[uY\013\203H\277\253~9@\036\214dUQ\232\274(\205a\371N\2213r\t\270+\3567A\276"
+	.ascii	"#\342\344\224X\261\227/\341g\025C\305Z<:\362\371\250\243\360"
+	.ascii	"L\n\342\031\2662O;\374A\200\203\273\372\220\2201,@\324J\245\353"
+	.ascii	"g\341\236\236r\267\365\036\005B\277\007\260\203L\210\266\262"
+	.ascii	"\025'\315M\375\026#\001\n\032k\240-\226\005\343J\025\007\336"
+	.ascii	"\337{\271\034\300t\211v\241\301\347\0349\342\367\364Mw`Z\252"
+	.ascii	"\fDe\302`\325\2161\266\016\236\2719\354\264S\323\355\337\223"
+	.ascii	"F\263\357\037 \r\251\2300k\235\n"
+	.text
+	.section	.gnu.lto_mspFcProcessCommandWithHandler.200.e437537c03190dc0,"e",@progbits
+	.string	"(\265/\375`\277\004\305\034"
+	.string	"\266\363\266I\240\326Q:\204\2204\021\262\217W\203\206\004\034\251\300H,rI[:\215\t.O3\231\205\262\311\202\305\256\243\376\\C\233\343>tp\353G\201Wr\234/V\b\272^Z$l\360\303$\360\364SK\337\314YK\b\221;\245\246"
+	.string	"\230"
+	.string	"\236"
+	.string	"N\303Zk\0033\240\364CN\214\265\332\253\221bX\253\260\201\023\310N\332\366\203\374\311\307?\031\204\200\214\036\024a\370\216x\325Zo5\037P\236\034o+O.\216\377|f\302\310b%9.\375\361y\237Q\375\3064|r2a^l\362\221d\364\342\262Q\202\023\230\325\257\020\035\215\024\211\320\322\254\250Gc&pi\370\364\225d\024\343%y\240\030\037\307\327\310\002\025S\324\033'`\265\020r\252#\370A\364\202\356\223\210`\370\206\204\202J\223\270D4\213z%\215U\250\265\232\376\212\214n\332m_\261}c\217(\0022JX\236\232\336\3046W\314\212\tIF\255\274#\331\346\242\277\252\340\344lOu3\253J\370\325\345\243_l!\217n\320\376X\327\206mj\232O\3756S\317|\311_\273\324/s\341\037s#?\355C\376\231\251c$uIR\2232\352\221\244^\0315%\251o`\263\310"
+	.string	"\262pq%+\265\002\303\272T-\362\t\017\333>\366\314vl\t\211$\026\246\216"
+	.string	")\224H\036\345s\251\263@\255\366\240\300\"\bed\221C\371\334H\tZ\253\275\240)\020d'k\324+4\021R\276`\353J+\026@f\311\215Y\333\003\016\375\217f\307zD^Y}\301VU\271A\255\217K\333\021Cm\273k\347>\320\377\306\255\021\3325\201KQU?\325\257c\213\210\026\271A&w\205\337XFA,\343\006\255+\351\002\340\202\332\352Q0\317hmm\373\265E\350\320\377\350\326\f-\317\264\375\232@%.\276/@4\314\037\376@\325\320\253\213G\275\230\270D\314\261U\374\254\222I\352\251i\212Oe\324q\345GY%(>\221\236\006\2578\243G\245\341\304\177b.\331\177\242<y\241;\030\3163\207\323\355lzN\235\r\317\251S\3539s\026\267;\327\346FC\216\016\256\304\235\271\013\270\335\031\333\345F\344\354\340\200\210\031\347\200\347\324\271\355\204\300\321\271\341v\347\315\301"
+	.string	"\353xr\273[\217N\267\273\315\204\365k\303/N\371\242\314\231=@\274Q\322\254"
+	.string	"\244+\0260\377O\271BK\021\311\327dD\361\2372\266*\226n\2207,,l\313\214@y\263\201\3767\2635\276rM \023\326i\226\024\242\257.s\203\377\327\021\217&\030\001\264\2662k[\233C\007\372\237\257d\313\212\326\320\362\234p\361\352\222\025_\242\244\355F\021\201<[\250AL\205\234R\252D$HAR\230\f\007\300\002\021\261\243\007\021\360H\353\024Q\232Ba8\337$8\373\2326\005#H\326$\204Y\031\242\246\351\026.A\"\265\2462\325\303\215\352\251\335\201Q\342\354\023-\336\342K\377\276v\r3\345HgI\034\020\247j\034_\031\201V\017\337\002U~\243\3511F\026\020\222\007\362\254\177\221%\224\225\225TA\266\f\b/\275Dl\266\236|\353\036\201\026\213\322\227\307t\331y\223\342v\352I\230l) \322=\236\007\013\013\277\301\261RX\3541g\001\020@\224\337\250\3433"
+	.ascii	"\367'\252\240A\216\352\243An\373\312N\372g;I\353\034\372\007"
+	.text
+	.section	.gnu.lto_mspFcProcessCommand.201.e437537c03190dc0,"e",@progbits
+	.string	"(\265/\375`]\016\375L"
+	.ascii	"\272\203\204\035R0T\312I\007%\307\021l\257\002\0319\244\312\216"
+	.ascii	"v \037c61f4U\354\033\316\326 [\033\263\300"
+	.string	"\003\035\353\271\266\337\317\350\265\274\025\341\250D\356\361\203\203\211\037\370\3663\304V\027Y\263@_\0029\326N\303\0335\225\225i\317pk\322\210\224I\006\306\001\243\001\276\001\007\263:\2662'\252\270j\255\351\b{\263MGx\231\322P\361\253\"S\243\0248.\270Z\277\230x\327\235\273B\366?\034\210\007\361!N\304\3116\375\262dd\\!\307[\332\r?\306\226r\352Z=\362\355\215)\202\020\027\023r/%\274>\325;My\013\203\304\273.\207\257\203v\031Vy3\303AX\220(oshj\375\322\301\205\370*U\317BR\315\023\232Z\353\213\353\366\306\tf\002\023\nh\331\222\321_\347A\310{8\301'\247\016Y\036\361R\353W\214\205\361\305[\346{\245\2606\265Z)\341\245\326\032cY\360\256{\226s\tY\"\016\"\305\250\004\336\316\216>\300\325Z\213\206.D\257;\257\203^\327P6\310\304\247"
+	.string	"\372\361\351\341\021\356\350\004\2019?_\017'\275\261\341\355P\335\331L\334\237J\2710F\266\260(\247\247\330:P\226\377l\221\351\300>\254|O\326yN\235\251.d\276\206\314:a\220\261Bu-$\025\026\256!\263h!\247\360\316\327\2206(Y\347\334\0219B\345kH\254\223\20184cg\316\300\301\032\244\244\034\2703\262\222b\362\234\027\243\374\307\344\212}\347\320\231\332\361k\310(\347\212'L\240\270\026\262\212{;#\346uYJ3)\307\001\300Jj\311\3235\344\222sH\013)\003\337\220\035"
+	.string	"+)\252\333\034\356\312\016n\274\223\225F\302|\rIu>\260\305\215\206k!\225\360\316\347\004K\215\013\n+\251\251\243\3074\252\b\353\210\234\035"
+	.ascii	"-\344\024\237H\336g\001UhH|Q\306Sx\204\0233';"
+	.string	"CE\ra\336\031\325Z\227\237\242\244\276A\337\275\231\335]\262\213\363CeK\266-s.\272;\025\313:s\234+r\363<;\311-`p\002\256\373\311\362\217Pn\237\326R\211!\034\267\2734\376\304\021\217\373^\342\242\330\362\n\342\335\034:\370O/\372$b\211\"\324\214\355\264.:M\357\352\346\b\025\261\247&\226\202\273U\260\302E\243p\246\b\2573m8h\3203@\357\262\246\250yZ\022>\355^\360%0\340\325Z\025(CTj\020\224\204\r'\240\327\261\350\031qmK\266\260$En\356~\031\271\223\273g\340*\016\315\366\223\335\035>^\035@\336\t|\2749|\2748|\2747\202\2746|\274G>\336\032A^\032\022\030\035\211\257\003>\336\006N\346;\003\201\203\375\007\334\3537@\307+\303\307[\344\343%\272\021\337\030=^\030\357\362}q/_\027\037\373\016\360\036\376\026\377\362eq-\277"
+	.string	":^\025;\274BO\373\006\245"
+	.string	"\372y\330\327G\207\267'\310\313\003\344\025\002yw\200\274:@\336 \220\027\330\343\315\351\361\376rx}?\336\336\217\027\347\307\233\366xo~\2746?^\336\217w\327\343=}\274\335\343\345s\371\236\202n\233;b$\206Oa\253\365H3\212\252\246\033\313\272\021?\022?\231?\355\347\362\207\375]~/\377\330\377\3457\273I\354\230\263mJ\006\204\241\342\327\320\0223.\263\212\004\001g\275\252E\247"
+	.string	"\262\262p\021\242\366\265\335t}\374\210}\016r`|\354\036\314\236\271iZ\220\241!_5*=\2434\343\202\013\362\"n\304\376lS3!#\004A>\034u\340\025\016\324i\2538\243\fs\0343r\363g\255\265\006;\271g\37600\335\230?\243\336\263\307+\374\247\241\202\240A-A\023\305\224a\2120\360\246\233\260\013G-\256Z\370S\023}\323<Y\312=\223\205\334\312\351\344\257\223\313\003\265\351[\361z\3276\255[sTb<\361\nZ\324\274F\327\034\275T8\0215\352]\247YJ5\307/Fn\006\031\365\213.1\\g2\233\244\361ur\203\332\247\317\274"
+	.string	"[\320\254,\313\f\341\270\336RFD\252\227\022\365\2367D]\324PI\230nFR&\362=oT\264\017\013>\240Y\364"
+	.string	"\335m@\373\364.q\213\230\205\377\204@P\256\r\311\221\252:\325N\213\323\311 $]\312\264\237\354\317\316Cs\345\207\243\330\216\350{\332\344h\242\206\342\335>\b\372 \230a\332ld\264\212\206R\321BJ\272v8\"\215\030\264!\034w\323\311]Q\244l\216\207\243\203\300\312\204@\217l\232\\\331:\212\235\3359`\264\214\236J;\316\025\233\027B\317\206\321\313G%Fn\252`\206\215G\f,;q\221\330\265K\334!\002\376S\004}\262\027\225\225\301Uu\215\025\027\250r5fC\264jr\243q\334\350\337\022\253\331\323%\254\006^'7\212\333hb\243\323%\226\232\"UF\037-K\264\354>\250_2\264F\037\365\213\304\350\032\355s\202\305v\304\031\302\314\n\332\311\025WBi\364\007\255Vi\240Q\245-\331\300\252\214\334\\]'\227\033=\007\350\311~#U\336\340\216b\314\347"
+	.string	"\025j\250m^\t\215\321\355D&f\231\346\242c\364\317~\232Q\005\033\002Q\222\222\217\246\242\037KJJKH?<<\340\017<\340\020v=|p\323\260G#1\r\333\002\f(\350\241\204\204\0165HR\362\221A\023\023\217\246a\312\224DB\217\037<p4\ry\220\2206%1\365\017\033\303a\022\322\022\223\005M\303%\013\200\f\225rN \001H\022\223\256\207\022R#\r\223j 1\rw\213D\004d\250T\364\303\007\017\245\"$\246a\021\221p\227\200$1\0255--1\025\245_\305\357\274\367\374I\321;v\364\305\264\255Q+\266q{\2300\226\035\335#\307\\\212\331\222\202\247\257\200\260\201\034\032\034\016V\324~(\3061aM8\3203\232\247/\266\034\003\366D\003\355"
+	.ascii	"P\313r\314\226\271n6ut\003\375$~,\3131`N\320\3007\200\260\003"
+	.ascii	"#\207\006\227EeF\237\3557\222\310\241A\341%l\033\260\244\354"
+	.ascii	"\264\260u>8\341+4%\224\032v:\005\264)\235~\342\304\352D(h\260"
+	.ascii	"u\272\337\222\314\204\be\003\2712\270*b\0244\211\\\231r\t\317"
+	.ascii	"@\304\232B\314\"VA\257\013\266\300\222\306U\325\3455A\353h\237"
+	.string	"\267\343\334\213\006\366\004\375\265\237W\306\240\031\002\013\330\rF`_\355\302\263\2663\341\024\247.@?=o\0373M\233\016\361D4EC\3651\355E\231U\227OO\216\222#\241\030^/\204\376:\247\317 \216H\220\034\361^\370u\n_\246\306\200I^X\303C\264\202\372\372e\030I\244\"Z\341\355M@\257\363u3\001EU\344\346\205\235\\\242\027\251Ak\356\234A\240\376\0058\242\245\321\351\344BP\006(A\007n9\340\260\221\0075\324\236\300\237\216\201\351F\005\007\201\006j\250\247\367\232\006N\247\335k &\216J\204:\250q:\201\024\250\201,\344\fS\306\314\314\210\214$I\222\016\021\005\304 g!5\017\021`5TF#IA\263\214\001\270$Z\311K}8wq\276'?\237;\340\033\207Z\362?\r\251\222\201\201\370\270T\003\252)y\326\216J\023\374\347\334)v\316\215 x]\326H\212"
+	.ascii	"\271\356\307\346)\271\016\323\006\271-"
+	.string	"!\030\307Rb\262C\025\f}v\356a\344q\342f\241(\320\317{(e\265>x\034\234\343-:f \275\034"
+	.string	"\372\220\212\"\225\021\017\351\270\203Z\035-n8\230\257r0\312\200\225D\344gdn\022/\006\013\211LS\345#\330\2768\034+\312H\331\022\bH\223\264Nj\366\325\225\324\301\306\275\257\335\250\321\237\331;$\255\226(\352Q\3532"
+	.string	"RLl\032\371i\001\344\267\334\267\270\022\013+\372\275\276vD\342\347\273v\026\220\276eqsU\273\243\245\330\n7@\020\315F\245\250,"
+	.ascii	"\243"
+	.string	"\223\0205\226\361\355\302\371=\275\320\302\370Q\331\262\335\022%8V\372bz\360\252\372z\231\244tn\225_l\327\276\262d28\346E\357Y\253<T\342O(\212r\324P\375\230\016\034\212\205XZ,@*\234:\206cA\"\272R\366\013\261\351|\210\360\260](\261\305\307\271\3523\340\367Pz\351\341\241Bq\016\017N\246\343\371\210kH6W1\321\270A!\032\254[l\201\330\231(\371 H\007\204\270\217z\332\341z\202\013\211\3351\220\033\034\b\266\b\3555|cO\271\260\321h\271.!`\002\322\225\265\344\337\356\036|2\220\334k\346\360M\0036\260\222\026\250M\007=#\323*\367\324\262\254aRf\006\351\214W\303H\021\322%\315-F\"\231+,\324\245\007\030{5\371#>2\314[d\266H\307R\312\313\202Z\003\253:?28\027D@\273\256ME\262\370\344~\220\346\222\227\npR\2314"
+	.ascii	"\023o\024\035==\3560\031\224\321\247\330\275\251H\336!\360U\243"
+	.ascii	"\320m\322\366D\007\311\274J\244\020#B\322\330\256&\322X\266\203"
+	.ascii	"`\320L\360i\275\023\325\324\032\f\037\026\237bv\177"
+	.text
+	.section	.gnu.lto_mspFcProcessReply.202.e437537c03190dc0,"e",@progbits
+	.string	"(\265/\375`j\001\265\016"
+	.string	"\226\032aF"
+	.string	"\223\223\0163\341\002M\315\370\357\315\243\335@6\235\213d\324\206>$\277n\300Ma!\370\213q\024\257\252\350\223\372"
+	.string	"*/e\206+\305x\372\273\252\034\322\t,\021\356*Z{\026V^\301\200E\255\221-wJ\001M"
+	.string	"F"
+	.string	"S"
+	.ascii	"\007\262c\236\007y\216e'\3409\346\223\335\343\363eG\\0Xfr\324"
+	.ascii	"\304O\227\032O\376\266b\206\367u\227g\275\201\n|y\337\207\253"
+	.ascii	"\f\240\303\202C\373V\244\002\0169#B>T\214\237\223\335u\364>\017"
+	.ascii	"7v\333\016l\227\330\337\021\276\334\335\265\246\354\317[\036"
+	.ascii	"\374U\243\017\200A\020\030\021_\325\330\355\360\002\262-\214"
+	.ascii	"\206\352\363\366el\355gY\263=Q\004\354\215}\213\017\027\315\315"
+	.ascii	"\356Lp\314\b\262G\373\253\2538\035L\371\200\335T\214\232\335"
+	.ascii	"Y\342\027\301\tO\264P\3329{\331\226\335%\321\220D\253\213;\266"
+	.ascii	"\251\001K\250\272\214x\256\005X\350@E\035\333\244\277\260\220"
+	.ascii	"]\037\374\260\211\001\357\002\005\344\331\246\317`\310vwA\013"
+	.ascii	"\r\031\f\344\2009\346\247x\216I\375\250V6\274\020*\361e\317."
+	.ascii	"\252\213\003!\316\244\033(\224D\034\346\220I\3114\332*H\2000"
+	.ascii	"\332B\234i3\001\231T\022q\333\005\022\211\333\264\271\227\253"
+	.ascii	")k!NKEW\242\310\202p\311\270\331\271$g\375\244\213;2Fy\204)B"
+	.ascii	"D\021\342=K\232\020\205\026\245\332\023F\361\236/\023  0\002"
+	.ascii	"D\220\356\006_\2141\336~\341p\204\3150\023\372\254\f\266\240"
+	.ascii	"\001ro\322r\261\207\330hcM\302\332\207\004\025\253D\001\361\331"
+	.ascii	"\2641\232\333\033!\314\245\250i\330\310\216\361\314\266\"v\205"
+	.ascii	"\375L,oWbWbMH\"\232\253\356\001"
+	.text
+	.section	.gnu.lto_mspInit.203.e437537c03190dc0,"e",@progbits
+	.string	"(\265/\375 \321\215\005"
+	.string	"\362\211%-pU\323\001@\025\206\310|\242\007\374vY\277\n,\205\275\216J\246\021\261\357\034\211\330\211\021\005"
+	.string	"\216\241pf\254\231\025\211\251Er\313\024\247\246+\253\370\312*v4\026\025SX\306S\341\326\305\300\370aY\030K_\353zR\030"
+	.string	"Jv\373\312\037\022\221\312\035\021\212\340\266\332\377ir/\277\006z\275\177\023\243\307\242\034P7e\004hP\360\321\374W\351\363\017\351\227i\203H\234tF\335\315\213\321\251r^u\243\004\256\323T\016\024\335}\311u\025\375\352\341\377\f\t"
+	.ascii	"3\003v:#,\\\347\032\356\026\302x\031\002\\\2721[\333uZ"
+	.text
+	.section	.gnu.lto_.symbol_nodes.e437537c03190dc0,"e",@progbits
+	.string	"(\265/\375`\3609\205\211"
+	.string	"z\272\244&T\220NV\303\001\030\f[\307\246\233\256\273Mn\211\366\271\245\353\335\177\n\377\034\211\027\234x\355\2157\236\317\236\360\322y\356\250x\207\346\334#\347H\033\017\n[~\036\353\027"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.ascii	"\220\211`\372\345y\327\214\367\220C\365\343\366`!\211{\005\032"
+	.ascii	"\231\222\fb\002I\002M\002\224[\250Qn\302C\331\211\017\312Oh\224"
+	.ascii	"\211v(\257\320\203\262\216\007\345\335\214r\221\2142\224\035"
+	.ascii	"\224\215tP\216\022\243\314\203Q\356\345\240,\005\007\345\177"
+	.ascii	"Q\366\271('\251@\371\247CyJ\2132\023\026e*7(\003+\345\243\025"
+	.ascii	"\345**\312A\033\224\2059\224\257\324\240\214\005\207\362\360"
+	.ascii	"\206\262\225\024(\023iP\316\202\002e\244\031\224\201dP\246\235"
+	.ascii	"@\231H\f\312A0(\017yA\371f\002\345\035\027\224\177ZP\026R\002"
+	.ascii	"e'\201.R\212n\322\bt\213\"\320u\001E\367\005\026t\215'\272J+"
+	.ascii	"\350\302\020\002\335\243\n\272K P\266i\312\037|@\031\004\033"
+	.ascii	"\312,RPFq\re\022\216\224U,"
+	.string	"QF!\006\3124`\240\234\202\022e\034#]%/\320e\301\005\272\271\"\335%It\207\220\3502\311B\267\005\"]'C\272O\260\320Mr\205n\024!])A\272P\254\3205\252B\227wD\327\007\244\333\243B\227\312\024\272U~tW\360\321E\2625+\205.\321>\335#=\272F\230G\227\bs@\271\2665>5R\202\350\2002\317.N\222\016\213\215Bw\b;\240c\274\262Ft\213@Y\030\333\324\324\212\350\306\370\270;\272A\272\325A\304\271'\214\304\t\373\360\220\266\331m\023\272@\334\002]\0323\241\353#\267=\206\226\307<\036\217\305e\201\356\316\222\265e\020\332[\206\004zp:V\t\335\037\236Rn\327\354\n\233#\203\217\017\027$-\326&\241[c$|\203c\036Gx\207\021\326Q\204eD\030\026\3041 \3161\204q8\273\204\260\n\030\360\353\207u\202\360\314\207g\334X\206\215O"
+	.ascii	"\3021~0\214\036~Qc\023x\330\205\017nA\343\022v\270\325\203{\360"
+	.ascii	"`\326\214o\3108\265\203G\320\301\"\304\270\302x\225\203U8\370"
+	.ascii	"\364\342\025.\016A\005n\035\266\321\342\034\r8\305\006\\\203"
+	.ascii	"\305576\206\f\225\256\363j\211\252\035\332X,9k\245\306\036\341"
+	.ascii	",\360f\247\244\260?\032\233\005\205\2752c_\306\026\235\260\273"
+	.ascii	"\030\253\263`\2050\266\311\276X\241\fRJ\003Hl0\203\tt\205\270"
+	.ascii	"\240\373\243\245\306\306\246\206GJ*e\222\022\026\200\232\232"
+	.ascii	"\232\232mA\027\bK)!\250\022\255\206Q\371\317\343\\\252S\311\215"
+	.ascii	"^L\"\372\017\203\365\310\211\036\330\357\353\036\357f\253=\275"
+	.ascii	"\363J\353\235\372s\346/\353\t\353Wu\371\267\232U\227yT\324\200"
+	.ascii	"1WSu\364_Rzc-\372'5\261\356\n\255XA\212L2M\036\276\260\217\200"
+	.ascii	"\277\272\013\334\024\025}=\336\315\326Sk\225\306;\225g,\343\030"
+	.ascii	"\354U[,?\326\245\252\344\306/\376\316\213\246\271I\225\350]0"
+	.ascii	"\315%\326\241\260}\277\262h\351gE\"\231\336w\265\327;\"_^#\371"
+	.ascii	"\316TC%\004\371\202inO\335\006p-nrgr \305\222\2244\232\346\322"
+	.ascii	"^\3114w\307g\262\217\301\272\225\203\304H\352|[\254]\255\212"
+	.ascii	"\366J\026pF \017\032\305\257\034\032\362\222r\302\255\230\246"
+	.ascii	"\211Z\3027\250\031\304`\232\030\370\316\004\002\007\017\031\022"
+	.ascii	"\006\323\034\361#\352\222i\216h\"\323\024\361\362h\232\"\\D\025"
+	.ascii	"\001\242n\313p7\003\321\037|kL\363C\335\tT\224\363\340\241S\230"
+	.ascii	"f\207\227:\323\354PmL\263C\377L\223\200\347Pi"
+	.string	"z\346e\\C\375\375\3004_\374\245\312\235i\272|\233^x~\254X\020L\223W\276\252\317\252z\364_j\2456v\261\022\177X\203~\264{\257\300_\373\372\275\307\2537\177[\177O\327h=sY\354\213x\356\253UY\277\353s!\302NB\361]\265\321\253\242\360\244\036x\340\0348\007\025EE\321'\252\211\227\302\323D\365Z\2423\360\225Xz@08\006m\304\363\202\177\036O\022N\242}<-\370\021\337\3439B\204?O\021\355\0244\b\"\236\037\246\360\364\340Txz\250\035\374\th O\016\317\301\217xr\250\034\232\246\322t\220\347\206*<7\314\314\270\220\347L\225\221q\ro\205\247\206\372R\257\360|i\227\337\361tq\227\376\226\376\361\\\257\005\370\300b$u<\267\022\021\355\254`\202\235\333\025L@$g\b\251\223\023\t\345\"\216\262\217#\224{\214P\376Q\2042\020\"\224mA\224\203"
+	.ascii	"\321\305\r\241\\\304)\033\021B\371\310\017e\\\020\312I|(+\271"
+	.ascii	"Q\026\262Q^\002\2042\013?(\017\365\004\302\027V\324\237\202\025"
+	.ascii	"\365\017\364?\275\247n:\036e\253\237\362Z\323z\307\216\377\254"
+	.ascii	"e\376\317\260\276q\371\247Z\315j\201\005U\264\370\344\334$\b"
+	.ascii	"\002\352\221H\022'S\372e\340}2\224\261\213^l\242\277\363O\b\222"
+	.ascii	"M\371)\330~\324\300\031\360WY\206\n\330\255\326\232\346;\177"
+	.ascii	"\332\251\313F)\244\314N\263\230\303\\\2774X\262\330\254V\345"
+	.ascii	"<\234\266{\320\316AE\341(\272\207\304\315\023m\302K\3742\f\237"
+	.ascii	"\027%\352\3517\250\031\374\266\020\311beS\276#q-J\204^\027T\022"
+	.ascii	"\217C\342\246\005=\242\036P\205(gS\237\252\0244\210\017\356\341"
+	.ascii	"[\234\024\345,M\342\030\240\0214\322T\224\304\315\r\277\022\311"
+	.ascii	"\263\254\017\211c\234\017\206,\217W\031\r\276\334\213\235\266"
+	.ascii	"&q\307&>\333#q-<\243\323\246$n\2068I\334\\'A\036\231\b\004\311"
+	.ascii	"#SC/\303X\340D\tqd\206\332\034.\030\f\251S\355\n!E\311\221A\276"
+	.ascii	":\306+J6%\215\354I\032\2211 \331\\.=\202\fZW\316\225[\021d\320"
+	.ascii	"\244y\232v\"\351sC\353\244\357'Y\362j\371],HQ\252\3349\013\351"
+	.ascii	"\263\202\025`\306\221\334\242\244\317\020'\351s_\205\374a\247"
+	.ascii	"\3616\004\3713C\254\220?s\200Y\313j\314\037\326\257\352\362\235"
+	.ascii	"<\260'r\347\255\001XXLs\200\325\017\240\362\343\261\227Z\251"
+	.ascii	"\213I\304\2410x\004"
+	.string	"\374\371z\274\277\275\255\247F\333\371\231\316e\261\n\253\260\231W\317\270z\246\325\357\225\265\232Q\265\356\375X\337\353\222\322{U2v1\211\350C\027\006?x\344\300\372\363\371\367x\267\266\325\236\032\315\353\316L\026\203=\254_\325\345\255o\371\313\260zUeT~\374c]r\245W2\326\241i\306\030\273X\213M\034V\241\007u\177\324\300\372S}\214\257uN\254\275\346\335x\246\031c\363\357\351Z\245y\fm\366\263\032\003\363\230W\273j\313?\206\025\263\352M\300\007d%uYL\023\346Xa\226\336Xw\017\223\324\304:\024\276\260\203G\325\201\365\347\357\353^\345\371\337Z\367Dn\373Z\323vf-\2531\207=\314\253a\\\001R\210|2[\372\035%\235\310\237\022[\316\246\244\223\371\302\023\222M\346\213\315J\241\242\013W\244\021\331d\272\250dN6\231-*\223\315\312\234+\247\303\262\311\\\226\003\221\271"
+	.ascii	"p\240\bi\237\360\023*9\344\233\252&z\367&f\343\225\370\rz\267"
+	.ascii	"\007\025\027\277\247_\02627I\374\310\241_U\314\247\306\b\267"
+	.ascii	"\311\034\r\317\222!\024\200\370\245\211"
+	.string	"b\304C\355\360\035T.s\223\200\346Po27\257\330l\314\230\tR4e}dn\3160\001.\311\235\314\001`3\004\264A^\203K\335\277T\227w\351\026o\351\037\231k\t\"\241\307\246dnV\2604A))\366$s\363C\257)G\n\334\376\340\355\026\025\345\020gT\262\211\034\232[\177\310\2419B%q.\242\025\300\321\275\240"
+	.string	"D\375\340\037<l\r\001\355\034*\215o\370\231^\005r.&\213\222BS\346]C\375\227\352\263))4C\354\334\223\024\2323\255/A\342ZH\234\013\211\233a\275\2208\030\037\303OP\035\227dH\234\t>\243\350(\024\223h\020?\005b\035\246\2028G\275\263w\364SdO\300\376\235Enj\356W\337W?\325\253\313"
+	.ascii	"\217\310\2657.s\363}\300\b\345\206\327\332i\335\200\013\260\026"
+	.ascii	"\026\3455f\275\021\314\030\301G\006V\227\201\030/\223y\271L\213"
+	.ascii	"US\253\225\252Q~\354X\321\216\315yc\321\223*\361\207.|a\r\006"
+	.ascii	"{\027\365\323m\016\360O\277\377\325_\247"
+	.string	"\376\306\347(^{\314-\306\326\323S\363Z\323bv\3744K\311:V\035\005k\033\257\277q\265*\212\345\177#q3fu|\325R\335\275\t\025\355J\342T\306^Y\264c\312\326b\337 \366PXW\"\251\212\226\025\374]\035\243)\213\n\236\216\216\200\017\003l\275\216\304\251\340\253\256^\277\334al\r\323S\243=\rf\307gU\346\037kX}\371\267<\365\254\206YUO)u\021Ul\342\023\177\350'a\243\336\353Q\003\375k\352\327\217\362\345p\330\3545/\305\353\333\337\374fs[\367\324Z\357\240|\326)G}\254\302\036V_\355j\371\263\332\347\252Q\307\217\275\222\361SFT\021ULr\342\211\330\303a\r\205X\250Cs\324\2532dhf&I\322\032\263\031 4\224\363\250\203f\372\023\200\214f\325HPF\037\023\211D\"\tD>\244\305L!\037\376;\035l\240o\340\342:Xv\023\303"
+	.string	"\342\n\304\320\352^,\303Y6ko."
+	.string	"\250L\203\035\370F\364\304v\201\032\213\231\204\203j.\017\304\210d\207q\227\215Z\206\316\267\245\343\307\257\006qI\234\331\360\235\201\24715\316Q\343\220\365\237\222\264-\306CgG\254\371\250\220;\216\0213%e$\372j\0073\177\023\227J\332\235\222H\373i\206\360\374 \315]\350\033\251\033T\001w\006\274\346\017\0327K \252]2k.\331\271\224P\007\357\271\t\307(\257\264\020\204\334\341SU\352\n\367\340\252\3405\035\334\326\237\224:P\360$\321\210\235;\311\\\204\373>kO\t\317\272g8Y\006\213\n\302\351c\352m.\321\257\361\252\203&m\034P\023\016j;\223[\372\264\333:\006\265\365\327?\263V\257\336\245V\207\242\016T\351\237\231\013>L\0036\301\264F2\235\273\361\f\342\033,\302\211W\2223\b\032\247C&M\022O\013$\323M\321\3022\225(\b\322"
+	.string	"\255\023\310yT\267\3532\205\001\366f\340\310\346\355A\244\335\242R\361\234Z=\231 \320\035\f\235w#\363\3756\n\342Pj1\267\313\377y\363I\241\003\363!\244_;_\267\270.\376\216\301\211\031\020\345%\224\214\362\276|\373\312\206\217\206f\237\351\227D\213Lp\201\212\300\032\260;@X\025\207\261E\343\362@\202\320\336~j&u1\307Sb^\256\210\371J\"+\241\332\276A\374\314j\3531\013\217\304\247T\242+K\301\247\t|\"x\240-\365\234An)\362\332{\350\271\2049\375\332\006p2\004YX\227\035\264\365v3q\020\253tg\300h<{C\345-\220?\206TF\323\3068\203\240\216\273\230\253,\325\303\256\031!\263\233\001[Su\232\265\334\343"
+	.string	"g>\267\275\376"
+	.string	"\261\303o\262\201#O\b\223<37\261\203\246l`\3417\274\032\310\261\361,\205\202\257\204\005\t\336\254\264,\323P\276)n\330\264\242b\t\222\261\225|0[p\n\307\205\n 7\035\215\314|o\036\254\260'\337\370\345\035}\013\242\260\335P\300\037y2\340\357\211\256\020\252A\224\304\b\326\352-\211\233\323\3716\230+\371\203\005\260\236v\373nna_\361<\212qB\373.\241Xl\220\2400\270+\221\363\321>\332\bx\037A\312\353\207!\017\331\2141\021\202\371\221\367\327\005k\242\3709_\360@\177\375~w\231P\362o\301\212w\253\204\312F5\030$\thD\006F\344&\277"
+	.ascii	"T\217\300\030\037\374\312/\024\347B\223\372`\nV\334X^\307\316"
+	.ascii	"A\214\333\t\027/O@\347\024\232\347\215\271\2608\346\003\342s"
+	.ascii	"\be\225"
+	.string	"\347&\340b\313\003sz\f\337w@\256C\362\274\0367$\212\013\302\3444\360{\303TH\252\036\313\221\0330\325\204ly\034\260\001\264\340\206je5\034T\321\242\276:\206\313>\365$\260M\333\352\367\263\216\0263\\\316\037\306\003\337 O\222`\201U\022+ \347\253\200|\036\rSuB\037\202\0169\3477\341\017A\0230\223C\275\037o/<\022\325\250\257\272\037\250>$\344\004jV\255\007\342\001\030V'\203\351\306\b6\220-L\037>\315\376 9\217\353\304\332u#\322\374y\202\321$\035\310m\370O\177\265{\347\273\031\276\220!\026\240\336\317\273\222\024\035^\275\235c\236\023\341\340'\303\300\200s(\344\342u\016#9\222\243\232\243\370}\355\244\212,=\347\322\\\375W\242#p\316\315!*\213\233\216\371+\200*\201\374\265\n\373\036B\311N\243\201YI\013V\357\217o\246\002\263\204\352\304\225\\\327%"
+	.ascii	"\177\241\306\221s\336c\311\262\244\3032/\335\0354\351V\304r\\"
+	.ascii	"\347\300C\347\213\374kFB\205\317\303A"
+	.string	"/\350A\f]4\375\354+R\250\375?\253^=\307\223;({\035\346\275L\225DP\377w8\013\246\375\036/\351\241RD\376u\020\314o\f~\275\307\031\310\367\256\177\365]\253\3455-6\037\356\030\234H\210\030\210\337\310\233\n\001u\372\224n\353\273\274\210\022~\323\377l)c\313=>\233^\016\036\237\343\276\257\205\fWm\322\214\343\247\301\024\363\307\036{\224\310\263V\337N\214\312?\323\253\232\032a\245\\\301K\fG\2057\275 X\204\330\3752vf\316\271Z\\\200\265p\363w\274XNM\006\036`E\347\232DY\211\211\306#\036\300\355\355mc\211\242\267;c\225D\352\261\234f\205\357\246\337C\270\354r\237i\250\222\2373\260\3073q\007\232\252\r\306/\316F\364\007\001Mz\020\322\r#i\367\272\210\005\367_\017\216\026\036\001\026\007j}\254\245\323\321b\036\337\335\237\016M\363\304\251G\343\312\032"
+	.ascii	"w\004\364\237\351\332\340\2003H5z\365\352G\240\240\320\313\325"
+	.ascii	"\200fs\213J\004\306.\373\352\215\237\365\3532\352\207\244\245"
+	.ascii	"5;\233\235h\302\333\334\323\354|+\227H\2354\376\340l\362\273"
+	.ascii	"\277Oe\336aa \bkkw\256*\347\365\007\352A\b(\265ks\263\316\327"
+	.ascii	"\357\233Q\234\372\tS)\026\n\302\305\300e\357\330`\005)\352\337"
+	.ascii	"4\205f\271\264\336X\254F\3556\251\217\020\316\206\341\254\023"
+	.ascii	"YRS\2029\004\344\353?\033\241.\036q\264\267\253\325\227'\213"
+	.ascii	"?\306\206\276\355\033^\003\244\236\251\2650\247\306x\026\026"
+	.ascii	"\302\276\236i\220tB\"]g\326\223p&r\233\2658\004\bH\312Y\025\254"
+	.ascii	"\321\352C'\363\351=\267\361"
+	.ascii	"\017\230uO\200\337l\370\314\031\006\366\335}\223\307\343\003"
+	.ascii	"\341~j\261\3008\312\"Z\327N\020\bV\325P \224\301\225(A!L\005"
+	.ascii	">\006\272\\\371\25529x<h*\274>n\245\304\362\341S\033\035\301"
+	.ascii	"\236\277\232\224{|\n\331)\003\245\233\251\343\225\242Y\265v\227"
+	.ascii	"So\307inI35\245G\332\031\035w\254\2722\"yN\345\332\007}{\373"
+	.ascii	"\2150O\231\177\352\335\365\325\372\036H\272g[\225XSGjo+\236\216"
+	.ascii	"\227av\313\353\033!\301\301\245\371\017\356\345\355\375\346\245"
+	.ascii	"\255\373\306\331\361\351\374\311\321\251\375\305\354\341\351"
+	.ascii	"\375\344\245\325\371\304\331\361\351\376\345\320\251\371\305"
+	.ascii	"\354\345\365\374\344\241\325\371\306\355\360\351\374\345\320"
+	.ascii	"\255\375\304\354\341\365\374\346\321\324\371\304\355\360\355"
+	.ascii	"\376\344\320\251\375\304\356qMD\177\301=\274\275\237<4u\237\270"
+	.ascii	";>\235?9:\265\277\230=<\275\237\312\003\270\270F\341\341\256"
+	.ascii	"\203g\343\352\337S\277\032\262\253|\305\363\226\372\371\020\372"
+	.ascii	"\213\367\340a\356\030\2246?\035-\002\205\033&\370e\251\335\352"
+	.ascii	"W\f\354\351\265\301R\343\220a\225\264jK\221\344}X\3611Bx\301"
+	.ascii	"\327Ze\373\251\210\322e\006\023\3612\001\356\345\335\204\017"
+	.ascii	"\333Qo\370\264l\237zZ\375\373\233\332\362)\331^J\343Gk{*-_\235"
+	.ascii	"\361\3241}\232\326G\275V\373S\013\033\357\013%\265\205H\230\367"
+	.ascii	" \345\212\217\256\351\324\332\\UY\345U\355O\333O\244O\035+t\311"
+	.ascii	"\241Oz\322\025"
+	.text
+	.section	.gnu.lto_.refs.e437537c03190dc0,"e",@progbits
+	.string	"(\265/\375`\017\t\235$"
+	.string	"\352K|\017F\200\326\3160\006!\245\321$\330J*\210\023\322\377\311\240C\013\220\266\b\346\311\002\005\016\255\221q\312J\177\242\330.\347(\266\3139\212\355r3\3212d@\353`'\250l0\013u\344\242\313\310\300ku\357\275\267L\001\332"
+	.string	"\357"
+	.string	"\357"
+	.string	"\243vU\340\332\326\240Px\324\314\347Q2$X\223-$\023\036-\322\363(\225\017\250\247\365Q&%\032F\236Ga\360\374\331\004\364\323\323\262\264\223\360\347\334\316\371\031\345\314\211\316\237H\260&[H\260\210PI\365x\302\301\224\024\343(\347O\0269\277\315\b\277\2018\277}^\366 \374V\221{{\360+\345\346\367\314\301\257V\203\337)\037<t41)1\3705\026\215l~\213\230\1776\277\337\202\363\271\324\324\234\177\247\340WK\360\237%\030\301\306\275M0\177|{[\224uq\302_\2675\232_3\262\003\277]\\Jf~\217\030\370\325Q\340\327\211\300oq\300\357\013\001\377\026\341\257\f\360O\221\371\303"
+	.string	"\374_\301'\212y\241\365\374G\375\f\350'H\177"
+	.ascii	"z\236\020^&@\350;98\037\377f\344\007?.B\375<\354\020{\260\305"
+	.ascii	"_\037T\321\3631\314\275>\006\020\350c\370\270hQ\332\321\305\271"
+	.ascii	"\255\245=I\212yq%1Rd\310T\324\023\216\245\032F#\235\217)\332"
+	.ascii	"\313\313\202\305\n\225\270765\264\262\344\361\213\311\226V\226"
+	.ascii	"\225\316\257B\244\320_\243v851)\021\177\245\201Tt\301b\375U\005"
+	.ascii	"\321\253\201~|[z^]*A\274z\205\370j\035\225\270\267\241W\245D"
+	.ascii	"A\373\360*\031\230\207W\223\034\301\262\252\242\222jJ\232\201"
+	.ascii	"T4\022zuE\030\241O\231\303\363\364\217\357\346S-\313\016\237"
+	.ascii	"^\261B'\007\327\026\364\251\032\332\0232d\230\027\023#WD\204"
+	.ascii	"L\375\350\261\303\251i\370\351R\022\207O\215E\240O\2150|\252"
+	.ascii	"\342\347Q\346\206G\0015<\332\227\341Q/\030\036\325\273\360(\236"
+	.ascii	"\205G\225\025\016{\355\351\022\240"
+	.string	"=\325\302\"\022\304\007\324S\216\033KIF\030G-t>-\n\023\350\307\267\267\274B7\305\r\312\331\230\226\221\254\253\252) ?\242\240\236n,)\031a\350<Z<\"\356hQ\030\246\037\272\237^\272\350\345\341-\357\346\340\334\330\326\375\\#\332\317443\342\237O\234\200\330\317$q?\305z\366\263\t\327V\022$C\373\231ue\365a?\205\004\221\212\202zrb\260\237L6j\310\210a\263\237/l\366\005\034m\337/=\373\356\351\341)\357\352&\354+\367\326&e\335\027\315\311\230X\027\227\026V\325T\024\217\034IHF9\177\223\031\370\327\307\263\257\267\264\253\243\233\223\260\037\245,y\324\371\305\"\354D8\373\020\320.\004\264\363|\266\007\330\354\022{v\201\313\316\203'?f\262]=\271\243'\227\204z0\235\354\367\344#\002\277G\203\235\257\213\233\233\rvN<\354\207\206\207\355\004nc;S"
+	.ascii	"\370\343_{\201 ~\334?p\370\331\031\271#\0309\n\231\321\325\366"
+	.ascii	"]\355\023\347\217\035\205\373a\302\235H\270\017\tw!\341\036$"
+	.ascii	"\334\177\204;\006\341\316"
+	.string	"C\263\357\320\3548\007\366\233\003;\315\314>3\263\027\230\331\203\0066a\340U\256f_\341j\316W\0347\206\373\272d\354\260\257GF,\202\366\265\250\311\f\332U\300\276\274,\312;+tsS\206l\303W\327\322\306\276\272\226(9\222ueU5\334U\252\037\034v\265\307\016'\b\273\272taW\225.\274\232D\003\251\350\202\302\256\266\360\331\325\025>\257\026\371\354i\323\347\323>\276<\274\323\366ty\332\247T\342\326<\354i\031\362k\263O\273z\366\224I\201S\250!\244\022I\022Q\230\224\024$\323\001AG\267i\r\021\340\0379\035\305\023<\277J\243\363\021}E\312\245\345Ei\371\237%\206\200\244X\3171\256\nD\031N<\254,\022A\245f\225\250&dS\341\243\177C\220\022\224\205\305U\240\001a\037\307\321\213?B,\244\257rhU\017\360\034\252\002\342\375\3020mN $\337qH\231v\265"
+	.string	"\370\373\357\177pLz\036R`\020\235M\034\222\f\2708H\262\202\337\304\320\2107\334 \270p\253<pdHUX'\207\244\007\r\337B\264\037i\177\225\270\255\301\001\036\013$\364"
+	.ascii	"\036\217\266LX\316*"
+	.text
+	.section	.gnu.lto_.decls.e437537c03190dc0,"e",@progbits
+	.string	"(\265/\375\240\302A\001"
+	.string	"\325\366\004n\241\307?\033T\0208$)5\006\312\027\256\253n\006~\376\357\231\374\303{E\267\207$\357\335\\\232\021\377\264\226\221(\200\177\177K}\213\261]`\rV"
+	.string	"\247\301-\222$k\003j?g6b\251\213\307\204\215\215\215\364\273\242\274\232A\007v\231U\232\221\255k)\273\255\334r\247\251\027\244\033j\034\321\255 ]Q<\275\252\227\036\343\213Y\"F\333H\230\023\025\214\0178<\275\352\213(\236\236\376\302\203\n\345\355\bUI\206\024O\257\352\373\311>\304\037c\034\0044#\272\301\347\343\2139H\361\364\266\216`d\237\n\304xz[\253\030(<=\255\367#\232\247\300@\341\351U\213\214e \033t\031\341\351)A\372\202\302\323\203\022%\316>\242\f\264\304\bO\257\232\217\222\276\214\262\334G\224\355t\225\204\024F\030\b\273\242V\311X6"
+	.string	"\002\205\247W\035\372\222\342\351U}B>\031>$\237\n_\n_\221\017\312\007\303w\344c\3629\371\244|J>\033>\027>\026>\032\276$\337\220\317\310\367\302\367\344[\362\305\360\255\360\265\360M\371j\370\242|3|M\353\324G\344\003\272/\310\207\202\314G\224\217d6\226\210\221\006\244\222P\341\244d*Q\f"
+	.ascii	"r\206\247\267\026\361\021i1?b<\275j\233"
+	.string	"\217(\273e\261\016\202H\361\364\246t\230\021\214\360\364\266\316V=*DQ\021F\360\021\345\240\265\214\225F\177F\246\204\250\353\027\037QN\221[0\340\353\fO\257\032\307\322\035GU\342\262\200\376\221x\245i\201H0\373H-\373\310(\035\350=i\021X\005\317\211,\353#\325\366\221F\366\221C\366\221X\373H\252}\244\321>2h{\321WGw]Y_\306\313\376\352\245\363\264\232\306c\211\030e@\316E\027\315e\235\352<\235\366\\\227\265\350\274\234\247\233\220\220\302\b\005\271!j\034\307\036d\360\240(\324\204t\324\352;\266\271!\247\254/Cek\321u\254\017)\241h\034\307Z\364\023}e\205#\323\\{T\255Ec\311O+\034Y\f\002\034\236\336\326\026M\325v\353Tk\321Y\236\267\344;\0172\020\340,*\335\3722i\3732a\3732_[_\371\265\023\275\246\255d\250\266\257\245\263\254\351\302"
+	.string	"\341\365\310\3722@\3669@\231q\346v3\226\210\021\006\026r-\244<\215%b\264\307\244\206\250^m]gTt\234\236\242\253\350\271u\252\345\364\333u\024\r'\247\331n\206BL\001=z\374h\304\255\235\t\365e|\354\025j\245igVd{\231\252}\031\033\3732N\3732J\3732E\3732-6\013\267\322\264\022X\221\355\217{\373\307\273m\005\005iS\232dmu\305f1"
+	.ascii	"H\224\325V\265\313\021\223V~\002\362c\265U\215c[DIY\"$V\tH\334"
+	.ascii	"\033\273\002\214\t\310\315V8\262\030\005\021\005\374\270sK\301"
+	.ascii	"\n\261\322\350\317\210T\022\352P.b\245\321\337\230\324\021*\213"
+	.ascii	"\265\214\350c\214\201\344\220D\265\227f"
+	.string	"\242\303\364\020M\246\313\264\022=\325g\032\2116\242\273\264\231\346\322`\272\210F\323R\275D'\321A\264\020=\246\211h1\375\265N\365\221<\367\214\227\271<\203Z~\261\2261 H\234\325VU\204\021\364\021\326E.Z\341\226b\237-\034\004\371\261\332\252\346\250/\332\207\204\024F\300\"\271\035\354\r}\204\335\301\362`\245g(HuQ\247\264\220v!\245\200\037\331\213>\222\365X\037$\016\272~\316~\366\006\213\203\255b\245g[\205\224\0275\216\343(\375\243U\220\220\302\bH$We\245\217\260?\362\023K\304\350\004\271 \3248\216\217h#\275\305\200\037?V[U/?,\212\243\020\202\334YmU3\324\025\266\032%\201\037L\254\266\252q\177\246\036\3110\262\317\nG\025\377\370\220\320\025e\265U\215c)K\244\217\260E\354\221\334\027\225%:\302\306`\247X\"F@\2420!T}\204\345b\255`"
+	.string	"$\024\307G\034\374\210\263\332\252\022\325V\350\315h\200\326@\2126p\374P\311\372G\257\375B'\261\322\350\t@DT\037ZKg\255S\375\343\372\207\206\241s\220\220\302h\003@.\250?4\326\3350"
+	.ascii	"\022\212\177j\204\320CO\007\226\036\243z\362\264\365\217>\373"
+	.ascii	"\253Z\215\013V8*\013`!y\273\021\204\032\307R\235C+i(\f\200\204"
+	.ascii	"VX+\223zZ\024\331\024\027\325F\007+\034\231\2073/j\034Ku\016"
+	.ascii	"\215\343i\304 c\034d\265E}\3239t\324\005\304\037il\324\346\320"
+	.ascii	"q\303\253\252\257t\017\255C[\351\035\232\207\216\352\252u\252"
+	.ascii	"sh\252 \337X\221*\030\031}\243\327\276\361\307\276\221\307\276"
+	.ascii	"qj\337\330\264o\204\261ot\261o\004z\362\261\213+\312\372\305"
+	.ascii	"\273\375_7i\247u\252i\350\245\030\232\311F]T\323\32034\223L\235"
+	.ascii	"\0250\324*\253\004\013\227\"\255~\261\307\3765\223\226\341\216"
+	.ascii	"\021\3424F\313\320K\304!WC6\262~Q\306~\361h\277\330b\277\030"
+	.ascii	"\264\177\215t\235\364k\"]\264JM\340;\262\242ME\326\372h\3035"
+	.ascii	"\022\n\252\241\243\254\021\260\"\333\023\305\354\023\253;KW\232"
+	.ascii	"\266\203\025\331\352\241\347\017-5\342Zh\026:\250V\242Yk\026"
+	.ascii	">X\220\314\265\351\024\300\0370\216d)\242Q\350 `\025/%]4\320"
+	.ascii	"u\020\233G\343\006\217\254\237\267~-\3010\033\242\3435\013\f"
+	.ascii	"\336Y\326'\332`\367\3301\277\240/`o\254\230\263cr\321\332\245"
+	.ascii	"E\316K\326,\0306\314\216\026\371\240`\303\320\255\265\215a\322"
+	.ascii	"\003n\241\022"
+	.string	"\205J\257j\252\207\222\256\254OT\332Z2\260F\202\202\260]\326)\353\205\305B\346\205\315\302\346\035Yb\327E\030\257\370\262D\353\237\315c\271\020\021Q\205\262f\361\200nI0\236d\375\341\334\376\331-\353\224\275\353\240\206\217\243\254\237\307R\377\0033\016*vzY\377,\365\254\235QlDF\326Z~Z^\304\201e\375a\332\256c\261\344\032?S^d\375!\223\375\241t\177\330E\227\261\b\2111\226\365\207WT\330*\353\224\235c\277\316n\261A\236a\216\355b\207\020\203\244\361\213\237\225-s\254\224\225[\341\226\214q\220\0261T\017\3261\2651w\255n\302\302e\211\306\261R\330)\353\224\225;+\307\022a\247D\237c\034\337\b\023\225c\221\260L\210A\322\370\250\265\363\211=\270\300\003\017\334\241)'\237\255\337\330(\353\224\205c\241\254\261n+\334\2224>\"\"\251QE\251\n\307\246\261N0"
+	.string	"\022J\241\t\026\352F\323\321$G\253?\224\332l\333\n3\037sOX\266 \214%\270&Y\177\030c?\371J\324\003E[\326\037\022\355\257\323\327\261j\327R\345\246$$\353\017W\354\017\177\366\205c\230\260e\254\331\nG\346\341M\0135\216\343%,\332:e\231\260g,\023\026\214\315\216J\274\362\321%\244\325\027\336m\r$\310\b\024V\t\233$\036\016\2658\245ee}!\335\276P\312\276\020\nK\306\036Y\247\354\2245\222A\032\307eS6\214\035\303"
+	.ascii	"HH\005\032zT/\021F`\247,\330ZF\364\221\306E\356U\217*J\3258\226"
+	.ascii	"f\360\300\203\237\r&_:Z}!\326\376\3311\266\210\f\241$a\244>'"
+	.ascii	"KSxd\315\212\261_WX\304Z\262\276\260j_(\265/d\332\027\276\330"
+	.ascii	"\027\242\330^\254\020#"
+	.ascii	"QC\266\262\276\013\306\313\305\333w\355\366*]i\332\f+\262\275"
+	.ascii	"ke\337\205\333w\327v\026\353#\013\317\302\244P\312\232\215\262"
+	.ascii	"=\326\351\323X,`\2204\026\313\341\304'G\326w\317\266\2118\216"
+	.ascii	"\343\365i\355\357i\355]!\373T\226\007[\265\376\216\232\020a\222"
+	.ascii	"\365]\254\315R\2619\326\351\005\254\216\270\270\336Q\001\275"
+	.ascii	"\310\372\256\216\315\2028^/h\327\275\275\365\202\366.\215\275"
+	.ascii	"\306+\262\265\221\241\210\344dD(\353\273+\3669,\2613X\"F{\212"
+	.ascii	"\303\212\312\326`\245\326)\033\3056\221\261Q\254\023\013\265"
+	.ascii	"\302\221\305?H\034\344m\321\032S\215c\251\007\031<\030N\253`"
+	.ascii	"\224ZM\203}*\266\340\241\242\n\t\r\351~\260J\006\313\224\217"
+	.string	"\212\350\b>\311\b.\355\007Q$\2610V\271.z+\272$e1b_\260R%O\342\262>\360\315\b\310d\257@\262} \327>\220\307>\220i\037\310\202U\241\225\240LYe}\340\317\376\346\302\006\025\341\254\324\224d\375M\205\005Zc\3435\013\305WV\326\337b\373\177\036\263N\363^\006\263\227\303d1+\034Y\034\277P@\220\027RX\3258\2163x\260\316h\003\212\242\265\230?W\363\227\374\004<\263r\364#\353o\034\373\033i\177\007\355\f\265\322\264\034@\341\355\377\260\354\241t\245i\327\265\025\331\352\262\025\331\256gQ\266\214t\245i3\325\212l3\034\226+d\322%BY[\221\2225\303I\326\377\245m\272<\327r\331\001\031e\375\037\222\375\337\220<eh\027\366\263\222{\234>\"\203J*\353\377y\3534\307\371\342\262\254\246Y\3777\265}?\243\375\337\317\366\265Yvk\264\"\333'\027"
+	.ascii	"\233\b)\363\221\365\333\265}\016Y-#\311h+\034\231f\213B\315j"
+	.ascii	"9-\003!\272\210\361\364\252N\362\332:\315j\271\311\005,\030#"
+	.ascii	"Ot\255~[\265\337\306\330L\2027\\\370p\313\372\255\212\235\315"
+	.ascii	"\262\222\233\255e1\313eX\226\344\263u\232\315r\222\257E\362\364"
+	.ascii	"Z\032\307A\355\n+KbZ\375\026\305\276/o\337g\267\357\203\333k"
+	.ascii	"\274\322\264\367-\331-\324\212l\357\023\262\357\213\356\237\321"
+	.ascii	"\212ls\3300\353\254m.\353\373f\354\257\323\fF\344\316\n\036\234"
+	.ascii	"\364\231\310\265\bc\f\206TA\350\254d\235\271\362\327\177 \253"
+	.ascii	"\245H\033]\376\312C\330\032/\250\274d-\204\375\362\003T\315\372"
+	.ascii	">\242\375\177\235f\257\334%\215\3438\213\314\305Q\326\367\371"
+	.ascii	"\354\347]\311\177\340\356\241\266B+\353\353\272\275\343\025\331"
+	.ascii	"jepm\320\310\341$\353k\266=u\003\314\006\252/6\302l\310Q\215"
+	.ascii	"f\250\032c\300\3749JJ\f\207?3U\345'b\2201\216\245\204\242\271"
+	.ascii	"\311)?\021\201q\374\263\027\215\343\370\177\276\312V\271G\216"
+	.ascii	"f\037\371G\336\221\2632\326:\315<\262\216\347\030y\351\332\353"
+	.ascii	"_\213d\036\031G~\"\006Ic\237\326\016J.L5\216\343\f\036\350\244"
+	.ascii	")A\244f\364u\327\276\246\332\327S\373:j_?\355\353\246\275\201"
+	.ascii	"\214}\255\264C@\332\227f\032\317O\177\236\261\202\271Y\206\312"
+	.ascii	"Q\266\320\250f\275\206\331\360L\343L-E\230\254\257\215\366\317"
+	.ascii	"Vd+D\266\327@\273\315\262\"\333m\204\267\317Z\331g\333\366\246"
+	.ascii	"\256\310\366,\221\235\213r&\312F\317E"
+	.string	"\331\305E\030\341\302\240\\\244\343\370g]\007@\\\327\001\370\322x\374\204\265\372l\327>{#\263\370}i1EJ\326g\211vV\221\205\326i^\361g\024\353\3335\030T,\026\307\322!\373\243\004\305,\353\257\035\264\305\275\275\275\275\265\203\366l\2745\336~\266\262\177\266\322\264\353\230uo\235\" \307_\303\254q\367\375Hci\034K\213\271J\314\221\260\254\237\341\366W\004\264\354\336\336\212\200\366Ym\347\025\331\036n\245i\237\213l`\\E\300\016BC\342\345\205\313\336k\333\353\221\3659P\271\242\326V\375\327+k\226\265n\325\262\332\255V\326\274\365n\305[\267\254\324\025\313\332e\235\256\\\326*_\347V\272\257\322\257oQ\264\270A\261\203\223R\027'\227\205\t\232\336\331\0220Q%fa8\374k\221$b6LY\313\210l\034\323\300\022\215c\351G\370\327\"\277\b#\254\\\326\261\265l\205[\222"
+	.string	"\327\030j\034K\2776\3717pY\235\254l\030"
+	.ascii	"\305\361\017\223\0066\2620\001S\215\343\330\003\0172x\260\336"
+	.ascii	"U\001R\303@\257F+M+\263\"\333g\242\375u\314\376\232e\177\225"
+	.ascii	"\262\215Kv\206\256\275\001\217\335\301J\323~U\332\377\372\344"
+	.ascii	"+\333\277\246\255j\253\324\004q\034\024\307qM+\024\024\225\225"
+	.ascii	"\365\272\266\341\353\023dk\264$\215\311\3428.\262t/\226\300\310"
+	.ascii	"\332\267\"\333\257)v\b+M\333\256\310\226\204\225\246}\013\366"
+	.ascii	"\351V\232\366:\373\324\225\246}\007\366\253+M{\017{5\262\222"
+	.ascii	"\255\323\fV$\322\342pL\2201`"
+	.string	"\262\276\004\366\327#\007@\\<\3025\330_3h\327\2755\203\366\277m\\\221\355\277\212eP\224*\271\260\021\006\266\322E\235\334\262\376W\260\177\355Z\275V\"\254\320\020TL\026\307\322c\261+\351\306\016\251W\034\307E\340\0220?`d\275\016Y\277\276JW!\027a\204\263>`\261W\034\307\253\224\001Pq\374\263J\213a\342\370\247\270\256\003X\327\001h.\251\253i\253\237\367\245+M\273Wd\273\004\270\201L\t\317\020\365\342/3\201\377\307\244s\013v\200\027\270s?\032J\1770\372\273UV\035\277\030.\225\237\013\377J<\006\356\224\337\215r\345\266\375?\254(\340\206_\006\371\357/.\333\277\337\334'?\320\350\256\375\233\001\377\036\341w\235\374\333u\325\376\225\b\004\300\277\351dF\370\267\0257\355\317N\240d\266\365\032\256\311\317\342l\275\t\374\307\274?8s\301\037\004\300\357*\t\022\340\017r\200"
+	.ascii	"7IP\203[\366\007\005\360\377\200\\$\177p\303\037\344\360\007"
+	.ascii	"#\360\007\037\360\007%\360\273\323?h\001\367Hp\003\277K\366\263"
+	.ascii	" \b\202\370]#\355\b\177[\302\037l\341\017v\340w\307~_\365\367"
+	.ascii	"M\371\251 \370\201\340\b\334\"\377\016\272\371\177p\177\020\347"
+	.ascii	"w\305\376\340\210 \363w\303\\\260?\270\343\022\371\333\r\004"
+	.ascii	"y\202\317?\370\345\017\302&\202?\1770(\230\302W\363;\361{!\310"
+	.ascii	"\302\225\006]\260P\017\356\027\213\003\004\201\333R\203F\177"
+	.ascii	"\360\305\357\016\361\215\360\335\370N\340\333\t\"\005a\374\340"
+	.ascii	"`\f\355D\213\351$\277~\242\231h*A&W\310\037l\201\353\345{\362"
+	.ascii	"Q\005\237\202P\277\333\265~\t\332\370\203S\277\313\365\007s\270"
+	.ascii	"A\376\340\216\377\227\366\007\255~w\353\267E\320zP\343\002\221"
+	.ascii	"\361\361\377\204\376\337\317\212\025$\301\355\361\273W\277;\343"
+	.ascii	"V\375\356\324\317\371\273O\277+\343w\221~\227Hh_Y\303\376c\332"
+	.ascii	"\037\364\361\007\263~7\305\277\263\354\377\027\345\242\370\177"
+	.ascii	"O\377\017\351\017\006\371\177N\177\220\353w\203\376_\322\377"
+	.ascii	"\213\361o\261=u\201\244\1770\354w\177\250~\327\347\377U\375\301"
+	.ascii	"\"\177p\354w\343\240\022\267\005\007\270\b\224\374\277\035+\261"
+	.ascii	"\206\313\202\377\327\374\261m\272\377\030\370e\n\360\267\325"
+	.ascii	"\277\315\373\333/\177\013\346o\275\374\255\336\337v\371\2013"
+	.ascii	"~\367\304\017l\372]\023\377\376rK\374>\026\376\226\312\277\273"
+	.ascii	"\\\022\277\217\307\257\203\374\232\306\317\342\374\372\352\327"
+	.ascii	"-\370\265\324\257W"
+	.string	"\360\353\035\277\346\361k\024\277>\372\365\373\353\241_\337\370\265\215_\257\370u\215_\027\375\232\352\327Y\277\216\372\365\013\277^\372\265\327\257e\374:\305\257S\360\2679\376\366\306\257\235~\035\377-\325\337F\375\355\214\277]\372u\327\337&\375\255\324\257}~\335\363\2671\376v\352\327\360\257\201\374m\325\177\273\377\307\325\332\370\333\035\177+\343ok\374-\324\357;\376\276"
+	.ascii	"\374>\367\367\031\177\337\314\357\303\240U\362o n\317\017\214"
+	.ascii	"\372\201R\277\013\377\276\017\177+\375\3330\027\n\343\337Q\367"
+	.ascii	"\371\267\313\277u\376-\317\3376\377\275\303E\301\337\276\177"
+	.ascii	"\233\374\333\233\177S\271<\355\006~\340\324\337\212\370\267\r"
+	.ascii	"\327\371o\326m\376\255\004\376v\002\177\013\201\277}\300\337"
+	.ascii	"F\340\007R\271;-\n\277\253\363o(\327\205\337=A\333\376\255\001"
+	.ascii	"\376\226\203\377\227\202\1777\271\314\232\277\305\340o/\370["
+	.ascii	"\001\374\255\006\177\233\301\277e\2709\277\017\314\337\376o\367"
+	.ascii	"\337\346\277\375\375-\360\367m\371}c\376\326\375\333\340\337"
+	.ascii	"\262\277\357\312\357\263\373}\\\376v\375}y\277\357\356\367a\371"
+	.ascii	"\177R\037\327\357\342\374\276 \377\206\341\336\374\276\031\277"
+	.ascii	"\317\351\367I\375\356\373\373\260~w\371\357\027\256\215o\311"
+	.ascii	"'c\375\362\357\370g\217~\037\322\357#\372}B\277O\305\357[\341"
+	.ascii	"K\372}C\277\317\350\337+pG"
+	.string	"\374\373\005\037\211\337W\342\367\301\277\253\374}\316\3375\301\357{\376n\362\367\231\370\335\022\374\273\304\277M\374.\t~\037\007\376\ruG\360\373\004\360\3736\370}\031\374\276\001di\352\257\267\374\272\313\257\363\376\037\364\337NW\004j\277\033\202_;\371\365\364\327G~\235\366\273 \370\365\223_O\3715\335\017\264\372\201W\277\373\201_\263\375\256\007\376\037\n\376\235\363o\346\357v\340\327P\334\026~\275\374\365\315\257m~\315\3745\322\257O\360\353\034\3776\301\357\327\373g\357~=\374u\376u\360\327\354\257\213\277n\177\355\376\032\370k\342\317V\177}\374w\t\352\376-\002W\304\317\306\375\333\003n\210\237m\373Y\266\237u\373]\026\376\035\342\337\"~\227\003?\260\307\017\304\372]\020Y\254\222\237=\373\331$?\333\344g\315\376\275\001w\003?+\344\337\031p5\360\263D\377N\341g\213\200\270\037~\266\305\277O"
+	.ascii	"v\271+\374\300!?\213\342g\177~\026\350g\203~\266\005?\313\202"
+	.ascii	"\237\365)\361\357\016n\006\240?\333\374Y\347\357b"
+	.string	"\340g\341\237E\301\317>{\376]\201\177[\340wU\370\215\271)\374\227\376\254\t\376\337\021\027\005\226\003\377\226\200{\302\017<\362\003\247\277{\201\337\365\360\003\307~\267\303\317f\340_5\370\331\006\260(\374l\207\177\223\340\232\360\003u\202_\224\270%\374\300%h\277\313\246\001\225k\177n\201k\201\267\377w\346V\340\007N\371]\n\374@*\277;\201\277\275\362\003\237|&\370}\313\337\227\363\373Z\3705\330\257\317~\375u\004\374\353\177\bD\360_\003\377\017\340B\340w\037\360\273\"\374\356\007\277\266\342r\360\273\031\374.\206\337\235\371\177w\256\314\037\254\033a\205\373\215.\374\331I\206\362\377\272\374\331\354\317L\376\034\345g\207?+\374\177a\334\343\317\356\237\375\271\306?\217\371\331\365g\377\377X\374\373\203\177+\340w\213\273\003\227\370\347\274?s\371W\254\037\b\201\337\035\272\302\214\345\007\236\360\273\256\033\374\367"
+	.string	"\\\340/"
+	.string	"?p\003\356\3763\333\316\340w\177?\020\004n\373\347\253-\256\357\3179\262\216\020,\270\372\007\252\340\262@\016\230nv\327<c\037\177\367\377\353~\r\007|\006\367~`Op\314\013A1?\260(\030\346\007\016\005\301\374\233\030\324\373\201:\301/\301*P\031\024\364\222\277\376\034\366\003\033\360\003M\370\201+d"
+	.ascii	":\377\337\016A\260\313\037\264\373\203ZX\021\301\272U\307J\374"
+	.ascii	"\037\365\033/\370\177Y\377@\016\206?\342\277\376\307J\375\333"
+	.ascii	",8\007\324\020\254\362\003\271\374\300\274?H\345\007V\177\340"
+	.ascii	"\227?8\345\b\370\177\200\240\334\377\333O\300\177\214\241\201"
+	.ascii	"?\220\203?\267 \030\245\375\017\374\215\303\037H\007\264\362"
+	.ascii	"\007\337~ \226\261U\271\216\370u\340\304\377\270\342\007& \b"
+	.ascii	"%\350\366\377v\202\3016 5\310\366\007\235\034\203_sG\371\017"
+	.ascii	"\200\377\370\365\007\217\377o\355\017\312\374A\265\1777\371w"
+	.ascii	"\332\037L\373W\342\377\353\300\277\245\374\017\376\307\260\377"
+	.ascii	"\247\374\1777\177K\201?\330\344\377\025\377`\373\007\177\177"
+	.ascii	"\020\355\007\356\375\301\377A&\377~\362\037\311\277\235\374\277"
+	.ascii	"\375\377@\360_\304\337z\360\037\203\377g\374\1778\377N\373\177"
+	.ascii	"\035\370_\363\037\253\376\275\367_\304\277\305\374?\266\377\372"
+	.ascii	"?\202\371\203K\376\240\331\037\034\373\203a\177\220\310\037\344"
+	.ascii	"\372\203Y\1770\372\007\255\376\340\216?\250\343\017N\375A\250"
+	.ascii	"?8\343\017\306\370\2030\376 \322\037|\361\007]\374\301\026\177"
+	.ascii	"0\305\037\f\372\203?\1770\376\203&\376 \211?\b\377\301\347\037"
+	.ascii	"\344\371\203\315?\310\374\2038\177\320\346\017&\377 \t\376\340"
+	.ascii	"\007\376`\007\376 \210?x\201?X\302\037\224\300\037\344\360\007"
+	.ascii	"7\374A\020\376\240\007\177\260\203?\310\301\037$\300\037\334"
+	.ascii	"\340\017\002\340\017b\370\2033\177P\346\017\272\177\360\367\007"
+	.ascii	"\377\003\277\374\300\274\037\270\345\007\326\375@,?\320\312\017"
+	.ascii	"\244\362\003\243\374\300'?0\355\007\242\375\300%?\320\354\007"
+	.ascii	"\226\375\300\351\017\034\373\201C~\240\327\017\334\372\201Y?"
+	.ascii	"\020\353\007^\375\300\252\037\230\343\007N\375@\251\037\330\364"
+	.ascii	"\003\223~\340\321\0174\372\201.~`\n~ \211\037\b\375\201;?\360"
+	.ascii	"\004?p\304\017\034\301\017\f\301\017\364\300\017l\341\007\206"
+	.ascii	"\370\201 ~ \006~ \n?0\002?\020\204\037\350\301\0174\300\017\334"
+	.ascii	"\340\007j\360\003\001\360\003\217?\020\370\357\275\177\213\371"
+	.ascii	"\267\336\277\361\376M\375\267\226\177g\371\367\225\177K\371w"
+	.ascii	"\224\177?\371\267\223\177\247\375\233\311\277\317\376\215\344"
+	.ascii	"\337c\377\026\373\267\364\337^\377\336\372w\326\277{\374\233"
+	.ascii	"\307\277s\374{\352\3375\376\355\364o\246\177+\375\373\350\337"
+	.ascii	"D\377\036\3727\213\177\013\375;\305\277\203\376\375\363\357\370"
+	.ascii	"\337,\370\367\013\3776\361o\370\337<\377f\376{\371o\023\374\273"
+	.ascii	"\004\377\036\301\277?\360o\021\377\006\361\357\025\376\235\302"
+	.ascii	"\277O\370\267\207\177[\340\337\023\370\367\003\376=\302\277C"
+	.ascii	"\370\267\206\177+\340\337\t\370\367\001\376\315\301\277\t\360"
+	.ascii	"o\001\374;\203\177\007\340\337\027\374\273\346\3374\377F\376"
+	.ascii	"\373\370\357\342\277\205\377n\377\255\377_\215\377\"\376L\344"
+	.ascii	"\317E\376\037\213\377\027\346\377\351\375\277/?\313\376?/\377"
+	.ascii	"\257\313\377\313\373\177\\\376\337\335\377\333\362\347\034\377"
+	.ascii	"\372\377g\367\377\270\376_\335\377\303\362\377\256\374?\270\377"
+	.ascii	"\007\345gA\360\377\330\376\337\332\377C\373\177g\377/\311\377"
+	.ascii	"+\373\177\323\377g\344\377\211\375\277\260\377G\344\377\005\375"
+	.ascii	"\277!\377O\310\377\353\372\177[\377\017\310\377\373\361\347\026"
+	.ascii	"\374\317\360\377\260\376_\007\376U\307\377\273\372\177V\377\217"
+	.ascii	"\307\377\333\361\377l\374\277\250\377\327\342\377\255\370\177"
+	.ascii	"(\376\037\320\377c\301\377[\301\377S\301\377{\341\377\231\370"
+	.ascii	"\177$\376\037\374\377\236\377\217\347\3775\377\037\316\377\363"
+	.ascii	"\300\3773\376?\342\377\333\377\357\367\267a\376\026\313\337Z"
+	.ascii	"\371\333\263\2775\373[\261\277\265\372[\370oq\376\266\205\277"
+	.ascii	"\305\300\337~\360\267\t\370\333"
+	.ascii	"\r\376v\370\373\276~\337\220\337\347\343\367M\375>\031\277\017"
+	.ascii	"\306\357S\301\357K\301\357{\341\367\235\370}\035\370}\"~\037"
+	.ascii	"\001~\375\345\327V~\r\345?\221_\177\375Z\372k\231_#\177V\313"
+	.ascii	"\317R\371\331\267\237M\373Y\262\237-\372\331\241\237\025\372"
+	.ascii	"\331\022?\253\374Y\021?\033\342\377\207\237]\341g3\374\354\361"
+	.ascii	"g\215?[\374\331\340\317\352?\177\371s\227\377!\376\\\367\347"
+	.ascii	"\270?\303\3759\372\347\252?\353\370\363\215?O\375\367\362\277"
+	.ascii	"\313\377\260\377`\377\252\201\377m\377e\366\366\366\366~\f\206"
+	.ascii	"~\013d\375S\236\001\304\"\304$D#D1\"\022b\0311\214H\266N\211"
+	.ascii	"G\210\322\023\211\020\301\236\241\213\370EB\n# \022\020Q\017"
+	.ascii	"_LcG\016\352\021\"\017\342\025\t)\214\200-\344\250\210X\304#"
+	.ascii	"\302(\"\027U\033U\252\022e\251~8\221\343@\267\322\225\246=\335"
+	.ascii	"\212l/\242k\377\304\257!dD\262\\\321XsfWY\023\205\020\275\206"
+	.ascii	"\310Q\261e}\021:\366EH\355-b\220\242\027\027\\\252,m\021\265"
+	.ascii	"\204YGEVY_\004\213M\374!\342g?\304\227\375\020Y\366CD\331\017"
+	.ascii	"\241\266\177\342\025\321*z\005V\2275\\Q8\246K\256F\326\017\221"
+	.ascii	"d?\204t?\204\217\375\0207\366C\310\270A\3041\245Q\240\241Qe\375"
+	.ascii	"\020\361\215\2516NH<f\343\304\251\"\017%RldM\224\312>\356\236"
+	.ascii	"\022\267\264\274'\"\024\r6\213\017\213\237\265'\"\r4\246)\024"
+	.ascii	"N'\322\b\202I\237\230eM\234Al\372\017\034B\261z\022m\002Ja!\204"
+	.ascii	"\213Y\326D&_\374\037\330\316X\022\223\2255Q\306O\t\353\fMF\326"
+	.ascii	"\317{\335\177\240\353D\207\324[\326g\341\310>\013\\D\0301\246"
+	.ascii	"~\352\262>\0136\366\327)1\211\210\024\024c\365V%\"\305\035Y\211"
+	.ascii	"\263>\0131\366O|A4j3\222DJ\\\021%\313X\021\221\250\255{a\205"
+	.ascii	"F\213\023\211~\342\020\321\305Zf\0023\026Q&Y\317\304+M\233\245"
+	.ascii	"+\262%\262\330pb\013\337\220,Y\326\262\316_+\262\375\211+\240"
+	.ascii	"\f\001e\375\023\205\210*VT\351\302\262f\177\330qI\313\372,\304"
+	.ascii	"\373\353\333\030\247(\361g\270\347\213W82\017?\232\210?D\237"
+	.ascii	"8\bH\212\007^JWYU\"\020\021\0051h\235\022\177\210q\353V\007\205"
+	.ascii	"\306\326\347\300\223}\016\200\355s`k\237\003S\373\037\212\031"
+	.ascii	"\346\265>\306\334bPeD\343\356\\D\335\354f\324=\301m)\032\346"
+	.ascii	"\r\361\206yC-\\J:\264\252_\206]\206z\3030\303\352\020\314\320"
+	.ascii	"\313:\035\346\r\271\260]\276\230P\215\372 \366\366A\350\355\203"
+	.ascii	"\340\262\017\202\272\017\342\312>\210\270}\020l\373 \320\366"
+	.ascii	"?\3142\3042\3042\2742\234\342\336=9\362iBG\205{\322\366\266\346"
+	.ascii	"\346\346\004\n\033+\0047\2242\2642\2142\214\033V\031\316\r\351"
+	.ascii	"\206T\206oC\271u:\2342\204\342\266\246\246\266\226\275\201Ac"
+	.ascii	"\205\2540a\205\256P\207S\206iQ\206S\206mJRjm\324\233\\\227\f"
+	.ascii	"\372 j\354\203H\332\007\021\264\277\001/\373\033\230\333\337"
+	.ascii	"\200\332\376\006\310\3667\240\265\277\001\034\373\033\230\261"
+	.ascii	"\277\001\242\375\r\304K2`\t\003\345mx6,\003\202\342\002\223\365"
+	.ascii	"9\034)\242\226\r\215\214@\266\204d\250d\230dh\266N\207e\303\351"
+	.ascii	"\260l8F\314r\241\307T\365!\231\021\023\005\3655\300e_\003q\373"
+	.ascii	"\0320\262\257\201\033\373\032\370)\"6d\341\245\212\222\254\303"
+	.ascii	"\326\032ZjcY\377\203\335\036z\r\267\314"
+	.string	"\242J\336|\254eH\340\262X\241\037#\260]d`C\"\303 \303\256\241t\3705\0342\0242\344Z\247C\257!\0207\254\265\214\203\326\027u\3505\354\301\n1\301\320\342\266\265Bq\311Q\315\350\177\030\333\377\340c\377\003\217\375\0177\366?<\355\177X\332\377\340b\377\003\212\375\025\300\354\177x5\254\222\273\303\322\225\365\224\260\313\216\024l\325T\030\352P]th5\244\032>\r\223\206HC\032\303\031C\250\241\216!\216!\3230\306\320i\230c(5\234\032\362\030\302\030\332\030.\ro\f\233\206;\206J\303\032C\031\303\250u:\254\032\032}\370bx$\034cD\306\033\220\320\013\016\035*\226\242^,\252C\024b\206BE\364\340\2028\024E\211\306\261CW\204b\214\314hR\305A5%\004\343D]\213\374\340h\241\326B\0135L\02356BD%\242[\361e-\342\303V\251\030\032\272\300B\035\252"
+	.string	"C\035V\tq<Q\247\206UB=<8<=\340\325\212\254/$\350|\266\322\264\036\254\310\366+h\331_!\311\376\n]\373+\\\355\257\360\264\277\002\321~\006\276\354g"
+	.string	"n?\003H\3663\200\265\237\201\250\375\f$\355g\340g\037\003v\373\030\200\262\217\201\351>\006\260\3661@c\037\003,\366U\370\262\257\202\224}\025\322\366U\020\333W!\272\257\002\324\276\n+\366S"
+	.ascii	"\223\307\305-\322UE\005Ox'\244\n\267\b\355\326\251\220\213P\313"
+	.ascii	"\327\265\325\355\253\225 \327"
+	.string	"\220\026V\025\356\312\bY\230\242X\270\b\353\202XCZX\325\337Tk\256\206P?\005\272\375\024\242\354\247\300d?\005\351~\nU\373)(\321I\251\303\342\343\223\3659@\251j\343\241\306fE\225\"t\022\204\272\266\025}r\025\235\"\224\023\306\t\251\b\253\b\341\204s\353T(E\370va\224\365L\212\320-\373`\200\"\216\241h\004\327\206\264~bZZ,1j\342\212l\237\002\212}\024\272\354\243Pe\037\005\267}\024\310\366Q\360\332G\341j\037\205'\265%\302\027\\\342\244\33021pI\306\274E\355E\227\b\313\204\230\b\321\204M\204i\302\263u*\\\"4\023.\021*\311>k5\311\313\230\2558\226\256JZOR\204\372'h\331?\241\312\376\tm\373'0\331\277\020\211p\032\024\025&\226\365\177\241\021\341\021!\331:\025N\205b\027\026\021\2161\t\247B+!\352T\030\025\206\261D\2144"
+	.ascii	"\264Ge\022N\205<\342\025Pp[\267P+M\373)+\262\375\ta\302\260?"
+	.ascii	"3\t\257\204`\031j\fJ\334\226\254\211\270Sh\324\001\311\372'D"
+	.ascii	"\207\b\205\b\273\204\\\302/\241\327:\025J\205[YB-\226\210\321"
+	.ascii	"6\003\262\243\006\351!\224\n\201h\241b}\211\n\245B\037\324\244"
+	.ascii	";\352\226k\207\303\311\tQ\377\204x\377\002u\373\027\200\333\302"
+	.ascii	"\037\253\230\221\034`\262\376\005\216\354_`\310\376\005v\354"
+	.ascii	"_\200i\377\002@\373\036\274\3546\226\262\357\341l\377\302\035"
+	.ascii	"\302\252\264\027u[\204Uw\247\316\310~\204:\2049\266\340~\360"
+	.ascii	"\262\246\222\016\257\250ETY\337\203\226\360\206pj\235\nq\b\245"
+	.ascii	"l\320E\2058\204Q\277!C8\230\024k`Q\201\321\352{\350\261\357!"
+	.ascii	"\306\276\207\243\375\013k\b\233\320X\244\310\222\3659(\225Q\221"
+	.ascii	"\314\336\222\224\304\301H\"\234!\224!\\\0222\t\237\2044\204N"
+	.ascii	"B\250u*l\022\306\310EjGk\324&\241\221\260I\370\002+\351km+\216"
+	.ascii	"\245\303\033lq\023\031\375\016r\373\035\226\354w\370\261\337"
+	.ascii	"\341\306~\007\244}\023\306\354\233\200e\337\004\264}\023\270"
+	.ascii	"\366/$r\205,\r!3c\322$\312TY\325\027\204L\r\311\227\rnfQ&b+\222"
+	.ascii	"\264t+\334\222\004\266\354\250jS\275\267\2656\252\021"
+	.string	"-\256\025\327N\230\302\335\342\206\021\372\bW\270W\204@B!!\013!\n\267N\350\302\305\342R\205C\356\236\260\205{'\fr\361\204?n\027W\214\253'T\341zq\363\\..\030w\214[u\263\270_\326\2510v\253\334\235s\351\320\244L\331\236\214\301\261BH\332\326\242\302\330\235\342R!\262ql\343+\032w\344\f\312Z\246$\356\t\033u\303[\222h\024V\250L\315\211[\332[\264\310\336Zd\t\026j\030\213(\221\241(\234\022-rk\031\031U\030\273gY\250^G\204\261\013\246\224\344\243i+\216\245m\214#[V`@\263F+M+\302\212lo\302\f\227\312Z\366\363\261Gt\227\365M\200\261o\002\320~\t[\366K\250\262_B\221\375\022v\354\227\300\264o\2011\373\026\330\262o\201*\373\026`\333\267@\223}\013 \331\267"
+	.string	"\330\276\005\260\366-\300\264o\201\237\375\n\330\355W@m\277\002\323\375\n\f\331\257\200\325~\005\226\366+0\264O\001\275}\n\300\355S\200\310>\005r\354S\340\305\376\004\270\354O\240m\177\002D\366'\340c\177\002R\373\023H\332\237@\320\376]i.\352R\223\"\373\032\322:a\331\362\302\313\025\342v\271\\\353\324\035\342\006Y\265\252\242?vPG"
+	.string	"\222\213d\264M\212\346\260\252\356\020w\213I\321\034Vus!\245`\022\324\227@\333\276\004\226\354K@\310\276\004\246\366%\240\264\1777\013\217l\nQ\326_\301\364pq\2709X\351\331V\"\325Du{\270:\202C\244\024\340\303\207\234Z\325\207\213\345^\271Vnt\235\272=\\\036en\017w\207\017 8\037Rrj\325\036n\225\fj\034K\251\236$a\"\324\227@\274\037\201\274\375\b\320\355G"
+	.ascii	"nS\211\265U\231\306Y?\002e\373\021\b\262\177\367\306\335\251"
+	.ascii	"41kLl\270R\353\324\235r\243\246.\024+=\333fR-\246~L\334\032R"
+	.ascii	",\242\301;\035L\255~\004\246\334\032U+T\215\213\004gEF\326O8"
+	.ascii	"\240~<e\375\b\270\030\343\322p\233\326\251\353\344\316p\235~"
+	.ascii	"I\330\252+495\366\213\030\024j\253\017\201/\373w\231\\\031W\202"
+	.ascii	"\254e\375\273Kwe|-3A\r{T\026\366#k7\306\206\273Kc\276\264 \313"
+	.ascii	"\272\350*\271Gz[oWY\273G.\220\353\202%b\204\0019:\252\033c\001"
+	.ascii	"\363c\305}\341\032\271In\221\213\344\302X\247\356\221K\244\335"
+	.ascii	"\243\340\230:j\034K\203{Y\334#\327\347\312PJ\f\334\020\242>\004"
+	.ascii	"\346\206r \231\246e}\b<\331\377\335\025\256\220\313b\235\272"
+	.ascii	"-\334\024(\330\274T\270E\337\334\026n\020\353\243\215*D\363\272"
+	.ascii	"s\332\372\020@\333\207@\221}\b\020\331\207\200\220}\b\004\331"
+	.ascii	"\207@\217}\bL\355C`i\037\002H\373\020\030\332\177P\214\2240T"
+	.ascii	"\300\004\255\004\365\202[\234xE\311\372\034\262\004\265XQ\331"
+	.ascii	"\242\264\005\337\272\300\300\005\345\202P\237\320\005\261\260"
+	.ascii	"D\214\366\024\350*\270%\2706\344.\310%X\rv\tz\t\346\005\251A"
+	.ascii	"\274\340\227u\032\334\022\264\323^\301-\301)\3019\fV\304q\024"
+	.ascii	"\217\226Zt\365V\215ci\356\322#I\215\031\375\007`Q\013\326IeA"
+	.ascii	"9e\375\007@\331\177@\023+\301+\233G\021\267\261#V\244T\202Up"
+	.ascii	"\262\216\200E\251LI\t\306\371\246<1\222\226\365\037\020C\312"
+	.ascii	"\003\210\366I\250\006\2418\321\261%F\326'!\313v#\001\312>\tE"
+	.ascii	"\366I\310\332'aj\377A'A\265\240\332\203i?\274\242I\262\376\252"
+	.ascii	"\006V-\302\301,h\344\212\230\226/V(X\026\234\006\317\202I\202"
+	.ascii	"H\202M\202G\202K\202hA%A&\3534h\026$;\273\305\006\031\363\222"
+	.ascii	"\262BA\263\240\215\240\325\nG\245\337\3044!\362\305,x\025\034"
+	.ascii	"\262\302Q\245\320%\f5h\026\f[\313\352\360\346\336\266\342X\272"
+	.ascii	"\266xsB\226A\237\004\030\373$\240\330w\200\227}\007\\\331w\300"
+	.ascii	"\333\276\003\314\366\035\360\265\357\200\350\276\003l\354; \206"
+	.ascii	"\220\013\204\323\024P\\Y\337\001>\\\301\256u\032\364\nF\231\370"
+	.ascii	"t\254pT)p\265y\375\246\301 +\034U\nc\334\364\217\274\257\274"
+	.ascii	"Voe!\213\252\220\254\337\2009\255`V\360G\320\307:\r\002\t\366"
+	.ascii	"P\013b\231\305%\211*\t\002\361\031a\211\250\013\226\007\305\025"
+	.ascii	"Q4\266\004\365\033\220\265\337\200\245\375\006\374\354\217\240"
+	.string	"\307\203\025\002\005J\217\254?\002\335\376\037\254\n\352X\247\301\035\301\251\007\251\210?\3068\326\241\205\032\334a\205\032\307\361\005\036x\320\372\3003{\321\352\257qY\2028\2029\2027\326i\220\252.H\245F\244%i\204\350\376\bM\373\017J\005\237\316\252ly\313\372\353\333\2300z\324' \0300\324 T\260F\220F0*\330\024tZ\247\301\247\240\214\007\231\2023\324\304\004\237Z\032\301\245\025\216J\273\005\237\200{vT ZR\026\016\242^\341V\232\026\203\025\331~\004\242\035\203xW\0065\226\365\031 f\307V\336R\270\371\320\005]\004\177\202@D6\216mD\211\302\251X\313\332\242Bln(\240\264\b\272\b\006\275Q\203EA\245`R\020)H\0244\n\302\b\036\005_\004\207\326i\320E\220E\320Ep\005\026\321\\S5\216\245(dU\361\202A\237\001f\373\f\030\262\317\200\036\373\f\200\332g"
+	.string	"\321>\207\275}\016[\3669D\331\377\217\305\203@B&\210c\2628\216k\366R\320\220R\326\347\260\266\317\201\310>\207\036\373\034\230\3669\020\355s\370\331\027\301\313\276\btz_\214\242+rd]\025\201\027G$\353\213\240\266?\002\227 T\263-*Y\036\020\017\270\005x\007\364\002\354\262N\201\\\200Z\016\264\313?\\\200X\276\250pu\\\200Y\3262\f\200\342\230\206S\253G\344\303\255\232Sx\031\022#\352\213pc\007Wd{\021\222\366E"
+	.string	"\332\337P\267\277\301m\377\300+@+bY\272\214d-\r\032\262\211IZ\312\372\033\324\250"
+	.string	"\247"
+	.string	"\253\254S\340\0340\016\016(\205+\032\307b\347"
+	.string	"\234\003\312\001\245\254pK\022P\363\242\306\261\030p\016\030e\005\343\240\013QU\265:\204\223\3215c\353o\210\356o\320QTT\005\225\3657\330\330\337\320\364\006\205i\243G\220\254\335\244eY\236p]e\375\r?\373\034\316\200hP\236"
+	.string	"\315\336\200k@'@5 \033\260m\235\002\237"
+	.string	"\233\224\245\001\321\244\254P\201O\200`\300\"RtT\267'\3001\240\022V\032\335-\200\242P=h\303f\310%\021\352\207\360e?\204(K\200L\200PLa?Y?\004'KB8\333\017A\232D\tl\213R\326\017\241\307\376\017D\002\234\256S`\031\220l\204#O\200e@#]@@\206T}a[H{\255~\b9\366C`\332\017\301h?\004\026@\261\034&\312\\\217\254\017\302\030`\030\b\\\366\017$\002\224\316\005\231\262\"\353\037(\005\352\350\002\007\306H\326S\031\324\251'rvPE\250\320\230b\223\323\302\336X\032\303ZA\325\335`\n\263A\013]\323\227'-QKXP\325\244\364\246\234|\211B\211\215\340Te\255lD\241B\205QQ\231n@\211N\2751Q\265\251\005\231\332U\340\f\240\020\260\013\370\002\030\004\b\003\b\004\330\003H\005\324\002r\001["
+	.string	"W\354=\340\0230\n\344\001\264\002\246"
+	.string	"\356"
+	.string	"\332\330c\266\027`\020p\bX\003\330\004T\261\303"
+	.string	"i"
+	.string	"\227\2001\200J\300\251\215\007t\002V\001]"
+	.string	"\243\2001\220\005\320\b\210\002\210cs\001\372"
+	.string	"\257\200X@!@\246\255\267\277"
+	.ascii	"\211\200_@ \340\021\360\006P\306\006\003\314\001\374\001D\332"
+	.ascii	"b\200E@)`\026\320\007\020\n8\004\350\005L\002\376\354.\300\255"
+	.ascii	"\235\267N\201:6\365{\313\276;kA\245A\305N\211\264*\t\021\265"
+	.ascii	"IKH\224)\007[t*M\016\314[\327V43Y%\231Z\253R\343\244P\320a\035"
+	.ascii	"i\332\352\212^\225E\225\346\204\240\306\234\250J\\P\231\370 "
+	.ascii	"\313j\345~\f\2711\003\fP\307\206\262\261\260\3223\024\200\262"
+	.ascii	"0Y\021UV$C\314\020\036\321\251&Rb\240\2160q\005a\342\241\204"
+	.ascii	"\265\002\352\330\361\376a\245\321\023\212`\021b\025\215ci\215"
+	.ascii	"+\354\215\030{\231)\212\204\312\004\324\261q\374\276\020}\214"
+	.ascii	"q<\345\026m\372\242\262\243\311\016\263($K\321,\331\007\n,\007"
+	.ascii	"57y]\261VQV2\223\216'\321<\2056\206\332"
+	.string	"\003\3054\232\243\314\206\250nF\232\242od3\242\354\r\030s+\242LUkuV\354\242P\241\200:6\021\035M@\035\033\210\0275\216\245\300$\"gp+\223\336,Vd{\020\346\366AX\333\007\301\310>\b[\373 L\355\215\345\337m\333m_Y\223\2360Q\222\265\025v\f\013%B\262>\b4\366\377]eS\331s{\312:\335t;\016\256\212\272\351\266\034\017j\024\271\035\0346\335\226\3226q\241\307\344\201\007\276\034KwrA}\020\200\3665\204\331\327\240\267\257\241\272\257\241\313\316(6|\277i\033]\212\260\262\276\206\273\275RW\232V\203\025\331^\003\334\276\006\262}\r^\373\032x\354kh\332\3270\264\277\200\352\376\002\242\354/\300l\177\001[\373\013\220\332_\300\213\375\005\374\354+`\313\276\002\340\366\025`d_\001^\373\n\210\356+`\306\276\002T\354\177\200\267\377\001\224\375\017\222\354\177"
+	.string	"\266\377At\377\203\032\373\037\034\355{\020f\337\203\272}\017\334\366=8\262\357\201\220}\017l\354{0\264\237"
+	.string	"\275\375\004\300\355'\300l?\001B\366\0230\265\237\200\243\375\016\366\366;\270\262\337A\332~\007a\373\035\334\330\357\200h\037\001a\366\021"
+	.string	"e\037\001\323}\004\374\330G@\215}\004\314\330G\200\321>\002~\366\017`\267\177"
+	.string	"'\373\007\030\262\177\200\037\373\007\240\332?\300\321\376\001Z\354\033 \314\276\001\256\354\033`m\337"
+	.string	"c\373\006"
+	.string	"\262o\200\033\373\006@\3327"
+	.string	"\320>\007u\373\337I\033\251n,\013-\353\177#\355#.YUEY\357\027]VE\332\262>\007O\3669\214\201\003\363\373R\027\345\262Q\354\024{\305&\332@\273\305V\261\2076\213]\264\205v\3206Z\247\333\305o\317\027\244jG\335.~]\276P\267\213\237\336\357\313\n\267\244\271\264\254E\266\213\337\335\017o\205\243\322^a\250a\274l\331.v\274\177V\270%\2355\206\032\307\261\230\355\342\227\267\226\255\\\206\344\326\266\206[\232\246\354\300@\377\333\347\373\347\377Q}AV\251\t\204:` E\311z\355\332\360\355S\2243\313\263\312\372\034P\355s\220\264\317\301\320>\007@\373\005\250\356\027\200\272_"
+	.string	"+_\276\226=\257d\214e\375\002\310\355\027\340\311~\001\246\373\005\320\332/\300\323\017\357\331\247\310\205\207\336\216\254_\200\244\375\002\fm\340\317\256.,\266j\221\365\327\267_\335oN\214\226_\226\037\226u\372\253\373]\241\313>a6\374\352~V\036\320eHG\227\252\007\"\304Hc\333\372\005\210\367\t\360e\237"
+	.string	"w\373\004\250R\205\n\0223!Kr\277)\353\364G\345\027'\225\362\025\375Q\371\301\031\riam\t\273\204\244\261h\365\t\300\265O"
+	.string	"\033\373\0048\332\377/\312\357\255\005\221X\354\347\366k\373AY\247\277\267\037\333\023!N\276\242o\2775\326\307\013\006\204\031\272\342\252z\260\203p\201Bd\353\017\300m\177"
+	.string	"g\373\003\b\333\037\300\326\376\177j\277&\323(\236\222\254\247\2773\342\2171\216\255\262P\323~h\353\364\327\344\327\344\307Ds\275Q\365\264*\305\326\352\017 k\177\215+\273\022\375\231\375\226\374\224\254\323\337\3313\022\266\nK\364w\366K\302V\375\030\200\311\220\216.U\017\236C\246\300l\375\001(\355\017\300h\177"
+	.ascii	"C\373\003@\261\377\337\2210\"K\256\340\262\336\360\013\373\371"
+	.ascii	"(\3624\343gC\307\217\337\226\0235\352\350\207DB\n#\240\n*;\250"
+	.ascii	"I?\246\251\252\257_\221\237\330\317\310\217\310O\372#\373\r\371"
+	.ascii	"\215\375\300\326\351/\354"
+	.string	"\327\364\f\365\023\362\f\3228\016\372\205\375\202\374\274\2124Q\247~UErDw\374\260PPQ\303~/^GB\n#`\n*<\250\277\260_\326Z\026\364\032\302\301d+\203\216\213\201\2520h\035\2574\355\257\213X\025\325\002\225\3657\230\362\343z\362\003R\324B\343\006[\326\337\240\354\247\265A\327\376\006V\373\033@E\177=\2564\334\220\221\r\\D\177e\3266\005)\353\337\225\217\373\005\257\305\216\254\177<tS\031\213\024Y?o-\373\017\364Iu\311b\226\3657\360\311\361\323A%$\002\007fOK\216\037Up\215E\232\320\017\307\177T\3041PF~7\314\330~r\334\270\023\321\n\234\032\321\333O*\270\005G\324\216\254/\200\351/\352W\203\370\002\311\025\263\037\324\17756\031\231\026\027Y?\357\367T\266\244n\353\211\006\r\025\027\324\266\253\207\027\255\254\177N\277\246;4\2658\353\013 \310\276"
+	.string	"\250\230d,\001\031R#\353\337R\016:\212S\221\365\005"
+	.string	"c\377b\374\224t\026\265\2750Y\377`\b\177\224\224H\311\372\002\030\332\327 \fR\366ic\240"
+	.string	"\203$\353k@\335\327\240\312\376\177F\377\025I\241\202\210!\372\257\350l\325\272\242\320\342B/\353Vm\303\177D\304\027A\212L]\f-"
+	.ascii	"\215\307\215\254\177C\177\236\372\265\270Y\206\242\302Tv#\353"
+	.ascii	"\034\2574m+f\303\177,4H\222\266$\353\377\267\342't\366C\205\""
+	.ascii	"\353\237\n\341\024&.K\262\276\006O\366W\2651d\321/B\260\f\211"
+	.ascii	"\272]\371\002\263\226q\375R\374\200~A?\024\277\270\335\373\375"
+	.ascii	"\254\323\237O\033\346\255\230\265\311\224\226\016\310\213\372"
+	.ascii	"\363i\365\200DE~\200\214\372\032\244\355\337\212l\257\001\331"
+	.ascii	"\276\006\\\373\032X\355k@\265\377\266\352eDW<\315\272K\360\211"
+	.ascii	"\\\212\244\254\257\301\214\375\325\313J\026\016\355\2266\213"
+	.ascii	"\025*\226+\321vK{\005\013\325\256\245\266y\355]\213\327rY\247"
+	.ascii	"\355\226\266.\377Li\351\352Z\271\177\303\226VKK\027\202\0209"
+	.ascii	"\2731\036\374\206\274\340\"\205\250\237A\226\375\f\242\354g`"
+	.ascii	"\266\237\001\222\375\f\214\354g \335-\225\266\312:\315\320\316"
+	.ascii	"\305\001\0215e\375\f\202\354\026\304k\206\366{k\206\366\031d"
+	.ascii	"\355\257\2554\355\337\306\301\205\301hQ\226u[\313Fd\343\370\247"
+	.ascii	"-\032\245\225\262N[\270\326\355-\224\366\255\205k\327Z6\242\217"
+	.ascii	"43!a\255\345\262\265\257(\255\316F+MK\200\025\331>\203\033\373"
+	.ascii	"\031\324\330\177\373\344-\333\337\252\265N\210pZZU\262^\213l"
+	.ascii	"x\373$\250\204\332U\224\3653\200\261W\241\225\246=\266i\253\364"
+	.ascii	"\002Z3\2604Y\"\034\002%\254"
+	.ascii	",\353vI\353\026m\227\264f\037\370\230{\333j\321Z&\353\264]\322"
+	.ascii	"\236\r\205\274X\313\322\352c\260e\037\203+\373\030\250\355\277"
+	.ascii	"M2\325\222c\341\202\250\235\2663\352\344\344\324\332i\313\204"
+	.ascii	"'\247VE\322\226\265GZ\262u\332N\333\"o\307Z"
+	.string	"#\355\324\367S\027\215ci;mi\264b>\277$arj\300\251\262\270\250\240v\343\225\246]\243+\262=\006<v\030\320\027\253j\326\307\300\306f\255Z\255/&LR\254\022K\304h#\001\252R\205Z\254+Q6\006;\365#\325\201\220\273\032\253\264\203/,\253\255j\253\325\372\020rd\265Ue\322b]\344\242\n\034Ymme\246V\253\215\212\262\332\252\266Z,\027k\205\204\024F\030\220\312\322ju\335Ym1=\265P+\334R\374\343\303\200/0\253\255j\223V;UGm\301\332\255vH\333\325z\265D\332\2576\253\005\322r\265?Zi+\244\r\262N[\255\366\306\333\246\326\351\031Z-\375\323\362\b\303B\315M\255Vk\203\345\261\302Q\t\211#\2065\235\315i\240\217\201\214\035m{\\m\036T\232\232d}\f\202\242Wrd1]\326\355U{\305GM\257\335\241#\214\322\222\253\254\037"
+	.string	"\273\375u\332V\265:\222d\255(\313\272\325!\324s{K\312\372y-\325\177 \261\312\02034\252\026\007\321E\\\034\325\342ho"
+	.string	"\273\320\211\351\312\372\001\250\262\037\200(\373\001X\333\017\200\331~"
+	.string	"\300\366\003\360\003j-3A\\sd3z\312\372\001\260\332\017\200\216\r\\Z\221\355\003 \265\037\200\0252\226\364\024-\211Z\214u\332.\265J\355R\213\324\302\230\332\340\207\034\220!\325\242]\f\034IZ\037"
+	.string	"q\273\205\021g\2508&\313.n\314\te-\302\206\267I\355V\223\032_\262>"
+	.string	"\240\354\277=\222\276\360\211\205\261q\375d\375\267FE\303: Tn\020\265.\326i[\324\016\265)\270\250E,\220 \321\337\036\026\n\271V\037"
+	.string	"\322\375\267-Z\026\301hl\006\327\256h\205\326i\313\242U!\326\246`\253\230\242-\013\026\b[\305\001\251JiK\004mY\276\264\372"
+	.string	"\300\261\017"
+	.string	"\250\375\267(\332 \037\n\257;\272\254[ )\260\205\022\0301Y\037"
+	.string	"*\366G"
+	.ascii	"\343\025\246+\272\327\376\264>\353\264\215}b\356\243Z\341\202"
+	.ascii	"6\264\261o\214\003\320n\260m\305\261\324\003\0172x\240#fUc\353"
+	.ascii	"_p\267\177\301\223\375\013\314\366/ \262\177\237\357\013\021"
+	.ascii	"\332\027Z\326\276/k\231\tj\212i\361][\326\0336\334W]\277\300"
+	.ascii	"\020q\342\345><)\234QQ\326\347\260E\211\227\035\353c-\212\347"
+	.ascii	"\243\262>r\340U)\371\362|\\|]\326\251\017\317w\247iP\257Vl\375"
+	.ascii	"\013\222\366/h\261\237!\314~\006\274\375\373\264\\\241b\226\346"
+	.ascii	"%\353\257oT\242D\347\334\242qW|U\220\240\335`\263\342\253\363"
+	.ascii	"a\361eY\247\276+>\272,\215c\262\rW|Sx \335`\253\306\261\024\350"
+	.ascii	"D\306\235TP?\303\330~\006\255\375\fU\373\031\236\3663\020\355"
+	.ascii	"\337'\027\227\227\020E\335\335\027Wf\002\243=\006\343\210N\212"
+	.ascii	"\0311\b\327\030\230\254\277\306M\263\017\321\027\307Pt\321\r"
+	.ascii	"d\026\360\272B\335\020\346\033\003\333;+\262\225}\302\204\250"
+	.ascii	"J\262\230\354\235U\213\f1\373\331;\233\362\261\226m\210\333;"
+	.ascii	"\333\332`\004\013\325\314\367\345\003#&\271\363\005\341\032s"
+	.ascii	"\366\003l\357\254\252&\204\265\303\332;\333j\342\225\213\332"
+	.ascii	"+\260\2753$H\356\366"
+	.string	"\316\252k\021\255\026`\200\364\210\332;\253\232\371\216\374\222\034\355\235)\361\261\371\334|j>&\276%>(>'\276$\276&\2764_\233o\315\367\346{\342\213\342;\363\301\371\320\326\251\317\314W6\302\237\247\260\212\242f\276\256\337\025\223\275\263j\034K\2053\270\234\340u\240_\003\267_\223d\277\206k\277Fj\277f\305>\0060\276\"C\270\030V\246Y\037C\025\237\030\232\217\310\352\202\313\224V\326\3070\304'\305P\265\217a\306>\006\027\3734\325}\232\266}\232\262}\262\225\246=\315\326>M\324>\215\213\375\231\275\375\031\272\375\231\263\375\231\257\375\373z\\\331X\242\365\226\265\357\312\307\303\027\233\201\311%E\327\251\357\312g%6\224\202Z1\325\3723G\3733?\373\367\355\350\340K\025\240\255*\035$\226\226\206\344\270O\307\n\025\307dD\244\"[LY\373\2506\334\227C\002U6\270\262f}8."
+	.string	"\262\344\351F\326\277\357F\260)J\335\226\254\331\037>\250xz\325\"F\262X\330Z\2471\323\223\312\313\232&I\221\316E\372\222\345\2255M\331\323\214|I\201\205dO]\310\345\240AB3Ecc\212\2439\342$I\334\213\254\277\002\260\375\025D\213\024\241\031c\212Z\365x\002B3\306\202\372\345-\353\257"
+	.ascii	"),\214\206\310Rt\353\312\211(\353\253 \217\306\213\306\213\206"
+	.ascii	"\310\016\"\026\r\256;\227\352\225\025D#\3444Dh\244\303)\252\230"
+	.ascii	"04R\232/\035H\306\202\252\206R\2444\035\311\232fH\361\206\222"
+	.ascii	"#\030)\262V\201\033\215\026\215\026\r\227\021\261\305\221\323"
+	.ascii	"\030\232 \247\3412\376\370`8\251\301\2255\315\226\313C\332$&"
+	.ascii	"k\032 \304\025HHPW*@\243\301\242\301\242\311*B\302\"\302X\241"
+	.ascii	"\244\t\215\217\323d\3452\264' \271\210\305\021\032\215\254\257"
+	.ascii	"\002#4Q\232\350/F\230'\271\255j\f\037AVd}\025LYY\025\3252@\261"
+	.ascii	"r;\220\260t\n\251\037KY_\005I;v\024\325\332\246!\271\265-30\264"
+	.ascii	"308p\320\350(f\271\320cZ_\330\335)\3458\215\016\252,4Q4Q4S\321"
+	.ascii	"!\2715 \036\320\0215\033\247\231\322S\300\2600\313\232Fj-\303"
+	.ascii	"b\327\306$\215\306\211\306\211&\003\227\247!FM\220\254\240y:"
+	.ascii	"\r\224\226\254\005\311\\\220\254ih\374\220Z!.1c)\260\242\221"
+	.ascii	"A#\203fFR6J[\252A\303t\232\031\031\313\235\220\274\024\310\210"
+	.ascii	"\021\303\365\032\322\302\362M\205\340\244d\375\024\260\240\201"
+	.ascii	"A\003#\307\375\326\210|\270m\005\347\234\2628e\375\027\354h\220"
+	.ascii	"h\220r\334\223V\227\025L\254,\311\372/Li\212h\212h^d\200\362"
+	.ascii	"\361\3222q\232\273+\316\030\002&\b\215\321i^\230=yb\306\243\207"
+	.ascii	"\013\0279\016\315n\314\026\0274+R\232\204\204hZd\200b\345\256"
+	.ascii	"\220\260\202{Y\252D\321\2608M\013!\335Q\022'\232\025A9#(ahV\200"
+	.ascii	"\371\351\310+\212f\375\027\206R\244\310q\031\240X9\032HXH\222"
+	.ascii	"\204\354\310\372'\360h\202h\202r\034\215\250\24340[=\262\376"
+	.ascii	"\t9\232\037\232\037\232x5J\201\346\314l\266P5\321\323\243\211"
+	.ascii	"\213Q\027zL\272\210\230\265\237\275\323\304@\036yU\0353c\336"
+	.ascii	"\230\216\350\306\210\241\203Ad\005f&\214\nuB\234d\375\023F6\230"
+	.ascii	"Me\331x\254\341e\375\023Af\2523\325\034\207&b\210\324\227\254"
+	.ascii	"\177bj\246\313L\227\274An\356m\213X\345\023S]p\341\222\3432\354"
+	.ascii	"XH\230\f\252\260\211\220\226S\326?\341sw'S\227\001\212\225[B"
+	.ascii	"\302\352\"\353R\221\365Mt\231\241\316P\233$y\031\343Z\201\303"
+	.ascii	"a\227\365M\300\315`\231\3012\243\205+\311\313\030/c\214\332\352"
+	.ascii	">\243%\255\350\025=B%\353\231,O\373\265\275I"
+	.string	"=\231 \263beFn\005\323\240\311\212\272t\264\244\210\026\025*3sZN8\264\326(\323\247\245*\237\231c\227\030Y\251\"\305eR\344\225u%E\312\214\334V\223\0255\270\344\246\204.\3563r{R\212\270\275\371\210B\201\227\365M\314\210\022\245\250\326vq\302\241\265\245\005\006(/\f\333\3176\003e\005\213\2138\374\310%m\025}\bYs\342\366\031(Z\356\253\n\335L[\211\271\265\265\034\027\226\004\t\313\b\205\335\212\254_\"\215\t\223\0315\036A&Iw\324\335U%\345\007\3553ji:j\243\252\"\255\211[Y\013*Sc\236\330a\031\371\314\021#3gl\225U\032/A\371ly"
+	.ascii	"\030\227H\013\"R\312>s\366\0313\021Fx\335\226V\225\237\254g\224"
+	.ascii	"\314$\231A\362\272\254\272\241-Y\317L\237\2664W\305\201\034b"
+	.ascii	"\337\244\344\200\262\236!\0032\2411\025\225\365\177\323*3\242"
+	.ascii	"Y\277DUX\330L\221\004x\255RU\214\214\210}\246\210/\036V\221U"
+	.ascii	"\227\224x\232\03123d\206\210\236\222\016\255\252\020\r\353,\236"
+	.ascii	"\221~\206\310L\220 \f\"9\336\262\236\371b}\b\237\244\350\330"
+	.ascii	"*\201\364\343\307\214W\006(\237\274\237\221\222\016\255j\213"
+	.ascii	"B\256)I\327g\274\234\240\300\201$\353\347\315pI\001\303r\343"
+	.ascii	"\232\t\322\345\312\310^\3263Z3@\326\351\335f\266\256\253\260"
+	.ascii	"\220j\312\372%V\354\026\304n\355K\374\370\360QT\3532\204\203"
+	.ascii	"I5G\323\027\035^z\364\230\351\322b\301\272\202#\353\223\2202"
+	.ascii	"\263cf\307\314\325\005kJvo>--\254\267\031\253\317\\i\tC\225\266"
+	.ascii	"e=\303\303\370\263\0329\342\221%M\207\216\031\252\027\200\\o"
+	.ascii	"8j\220\335\2701C\265\202\305E* ~\t\361r\204\3433TBr\030E\333"
+	.ascii	"\264*\331XY\326'\2415cc\306\006\013l\3648\242\222\365I\320\230"
+	.ascii	"\211\232\211\222\251K\332[WF\232\262>\211\242\231\246\231\246"
+	.ascii	"\031\250!E%1\246-f\236>\003\245\205K\006\024\031Y\317\3200\376"
+	.ascii	"\254Oa\254\216\262\236qz\335\n\037\026-H\374\314,\315,\31509"
+	.ascii	"\3311\331Z\251\004m\231\221\361\031\246\"![]\222\210+\300\274"
+	.ascii	"\362\276\362\224\224V&';&[liN\256d\375\236)33oNz^Uw\372\365\304"
+	.ascii	"F\326\357Y\233q1\343b\346\310m\222tG\035&\205YQ\315\274\370\314"
+	.ascii	"\021\212\033R\032Y"
+	.string	"\317\030\345+*3j\3263ED8\237\025\024\273\247\254g\210\212O\202\344\212<y\202\006%*\310\330\212\0253-2@\371l1\300\226\222\335[\325}\021f\006\222\031\026\237i\341C\262\342\002G\327\314\317\314\317\214\212\256\240Z\322\035U*\017\305\027\320gT\314\244`\022\033\231I1\203\002\216M)\212\310\005dl/f\202\204[\001\250\023J\342\226D\312X\222\033`\300\314\304;\202\\\222\356\250\300%`)\250\3100\237\211\221{wC\364\242\354\215\021\2231\346H\225l\004N\206\f1D)\3012%4\270zRx\361\202\374\002%Zt\303qeT=\362\3130j#N\211\036\036\0362/\303\216\275\262\256P\201P\246\224\tAr92\357\007\306\205\316\347\316\316\016\271\205\211\222\335\333zc\210\025\017\352\221[\240j\250\250\302Q\352\352r\334\317\350\304R\036\223\254\017/\301\202%\307\355E\201\330\302"
+	.ascii	"\311\372p\221\2719\244\225\fP>]Z#\032r\321\252\026\256\026[\220"
+	.ascii	"tGZ)[\"ek\362\037H\202\033?\226d}\330H\312\245 \251\254`q\021"
+	.ascii	"\r\023QU\265:\314!\025\023\202\234r$\225\264&\"Ix\310\311\210"
+	.ascii	"f\265\220C\306\025!\342\222\205\214k\225\214\276\232pe}h\230"
+	.ascii	"\2666d\024'b\022\r\256;}\004j-v;2\n\362\315\bI\021(H(E'yOgY\037"
+	.ascii	"J\335\317+.Ik\222\205%\353C\2418q\202|\0224j\262\242\262\\+\252"
+	.ascii	"<\255\035\371$\257\b\334\020hZZZ\025\026\265\025Q\262>\264\013"
+	.ascii	"\211\206D#\262\321\340\272\2536\271P\221$\353?\305,Y\"\303&\025"
+	.ascii	"\004\t\253\372eV\005*\353?\333\224(A\232Y\265^MV\324!\030M\262"
+	.ascii	"\314\212oZ\336\242\260e\375g\021d\031\262L\246NJ\t\022V\265\305"
+	.ascii	"\302\321\343'\353?}\220\221!\247JB\261\2650w\310#GNI\320\002"
+	.ascii	"\t\306\023\207\364H1)r\354\327$C\016$\030\032Wo\325X\250\251"
+	.ascii	"\003\234\033OnE\216\034\273[\273W\344,\n\031\366\233\243\322"
+	.ascii	"\006\2265\022\3147\003\tK\026\221\037(\244r{\273\313\372(\330"
+	.ascii	"\262\217\202+\310!\310!\255\236\323\334\335\026\225 4\342\254"
+	.ascii	"\217\2026$\027\222\013\351\025\306i\356\256\352Kz\2231\325u\244"
+	.ascii	"W\232\f\255\031(0\202\324Bj!\267\332&Nsw\354\326\212+QH Gn\241"
+	.ascii	"\301e\211r\263\365\207\222 \323\254\217\202(2\013\231%\203v\304"
+	.ascii	"\327&\004*E\326G\201\fd\017d\017$\226\001\222h\340\350\302\342"
+	.ascii	"\356\t\026[\345C\210\2271+<x \2572@\371ly\300\021QUU\210\244"
+	.ascii	"\372\303\007iu\344U\221\212\357\b\230->\262~\036\020m\253\216"
+	.ascii	"\212\f\266\252\252\337Q\321\034V\013\304Im\255\f\007\016d\216"
+	.ascii	"\fP>yA\257\244;j5\313P\022t\005Iud\016\261)<|\262~\236P\353?"
+	.ascii	"\360\210\302\347*\353\363hMM\311\260\311h\275\222\274\214\251"
+	.ascii	"\212Q\271\363\222\365yj\320\240\201\224\032C#\352\250Z\345\243"
+	.ascii	"K\024)\205\214\272\203\341\202*\353\032\300\263hT^\326wfAB!\237"
+	.ascii	"\304\306\312|\262\276\323\311\276\223\210\322\225\220M+X\\\364"
+	.ascii	"KR\322\241\305\242\240kK\202\234qd\323\007\\GbY?\017\311\364"
+	.ascii	"\037\330\302\2175$\023R\206\224\274%IY#\227\232\332\316zd}\247"
+	.ascii	"\326F\306\030ryr\212\261\226\365\2358\220I\310$\231\272\031\252"
+	.ascii	"\223\236\027\261\212\365\264$\3537\301 \217\220GH\243 C\206X"
+	.ascii	"|iA\026!\213\220F+X\\\204\001\227\237\022\352\032\013\244QZR"
+	.ascii	"\214\267j\326o\272\2119\022H\f\322E\221l\215\343\245\030((\246"
+	.ascii	"\361\004\200(N]\230\252\261\320R\007\303$LA\240\262\376\221A"
+	.ascii	"G\2728RH\204\021\220C"
+	.string	"DiQ]\262F\256@\262X\247oC\266\270\264Hd\242\2429d\177}[\333\202\365m-R\305\211KP\230P\263>\022\0052\305\017\f\372\230\022\003\222\365\233Z\373\013\330`J/^ }\216\374\371\201\356\220\264\024rY\277i\265e\366\216\214\177\340z\203\b..\3537s\354_f\314\017\024n\331\241\244#\3537m\3547\235\252U\0310+X\\t\001\226\222\335[\013\242\264\220\352]\006\fQ\205\325\n*Y\313|1\376\b\221\340\311u\001\373\017,\002\001\323\242J\326o\272\310\313\223\351\222\001\312g\313\002\216\234\354\234\264\242Q]\210+\202b`R\214\262\376\316\024;;\031\274\fP>[F\030\343\244E\211e3\202\362\205w\247\263\204\210\fQe\266\020\347\316\352\246\262\376\016\020\352\216\216,\317\"S\267\202\305E#\204\311\251m\375\326|D\265\352\200=|H\re\375\035\030S\246\310\\\311"
+	.ascii	"\345\223\327\2769\315\335E\035\275\370\221\261r\231+@-gP7\262"
+	.ascii	"\226\241\"CgE\004\255*C'3\327\204\311\026P"
+	.string	"\f\242\323\026\037_U\202,\212\2423\252\256\224\207\224E\227\254\257\023e\313\274\311\274\311\304)\331\275UY.mt+\244\\&n\372tV\225\265\f\234\361'\211\225$\\Y\313D\271\235\2337\006\252\232\006cI\027\224\254\257\263D\306M\306Mf\312\344\352\r\341`\262z\215}\021s\344\311\023\031\266\020\326X\305\230\324\0335\216\227:`\177\240\210\311\301\266\226Yy\261%$\353\353\374p\342\004,\bD6\245+\353\3538\245\245\311\240\255F)\220\\]\364\013\312\353F\326\327y\301\204\211\f\032\007BV"
+	.string	"$\206\0244\326\007\212!TA\262\276\016\212\2622\231\263\fP>w\033"
+	.string	"\211\313WXCG\316d\314\320\300@QJ\"\243\304mc\222\265\327%\211\013U\266\314\021\231#2\323\fP>[:\350\302\332;\003:Me,\311ZfZE$E\215&B\204\310\030\251\200\324\r6\375c4\245\306\330e\214\344\264\251*\244\254e\300d\212l&IGP\302d\304\330\035Gv*\302\302\210\260,z,\261AD:\234\322x!7D\346Kg5\211*\313\372.d\355!>\272\366\b\236\013R=\336C\246k\005\213\213Z"
+	.string	"\252R\332*\336\031\265\t\341\272L\027\222*\025\224\254e\264d\202\330\020\323\242\"k\231-\337\225\253\034>\262\276\013G2@d~HI\201\340~\310d]\315\305ua\311\370\330\313\323J\313\372."
+	.string	"m\031,\337\335\023!Oqw;v\310\\!qm \021\353bu\231+\237\325\227$pY\313\3600\376hY\031c\312\372y\331\347\313\307\322\215\254\177\002*28dp\310\350\230\256wQAV\344\270\214\216_\325\333\324Q\3262T\306\037\024>\302@\235\340\311\226\211\222\211\222\231Z\227\224\354\336\266\342\031a\350l\\f\n8\246\032\247\227\265\214\224\361\007E\223\216,\276\270}+\n\243W\006\005\225\343&\340\005L4^Z\352\240\030\004\307\345$\353\237@L\246I\246I\206\306\034\bG\036`\022&\314\35124\302\350M\371\221A\261\006\0213\227\002\013\tI\206i\215\3438^\212}\274x\220\245t\225\265%\3432Lj6\310\272d-\263T\364\361\037\270RS\204\251f-\023C\tF\322\t\220dZ\310\264\220y!F"
+	.string	"=\031\243\313\274`m,\205\021\222\265L\321/\013T\215\266\254e\210\330\2521\251\225U\3262.d\206\362d|d|dV8\371@k\030\303\306\2261\241\313\254h\201\230\200\304\310ZFE\261\r\030$\006\222\033Y\313\244\220Aq\325#\tQ\3262?2(\316\304\274\351\220A!\023\024\244\215KS\215\023Ha\201\222\265\fPQ\306\224XH\312\376\007\353qo\357i\253\3216\242\202\00656\212?8\023\355\030\346\030\346(&\007\361l\251\0037\213\307\217]\326b\212m[\216P<\311\372Li^\336Qo\f\002j_~\324\3131\276\244wY\037\253\305\266)T\212\314\262>z9va\336\330?nY\217xx\276\030\030\307Q9\210lL\243\375\325\027\267\377\221z\244\352\025\315aU\2058\360\314^d}\246\217\026-lU\006\213\215H8\341\320\332rS\203b\222\313\222e-\313"
+	.string	"\345s7"
+	.ascii	"\243b\027-\247*'rr\307+k\b1\020\0251\020\274\252\374x\345he*"
+	.ascii	"C\316G\326G:b\022\024v_\262~\016\222}\234;R)\266\335@\243\262"
+	.ascii	"\"\353\343\224\034 G)G)G1\231\034\250\266\266c\024\231\263\267"
+	.ascii	"\037\243\374\246bL\275\262>B1\376\344);\302\360\262>\272\345"
+	.ascii	"\240x\362d-[\2151\320\334\223\250\026'N\212Q\234\266&M\216iV"
+	.ascii	"\305&\317\3731\215\b\347B\212\203F\326\307\031\262\377#\223#"
+	.ascii	"\023\"\021\324\217%\234$\353\364\230\344x\226\243b`\230\0379"
+	.ascii	"\250\261\221\321\007?\261\305\217g\377Q\311\321\254h#\357\244"
+	.ascii	"%QgY\257\324x\245i5\3009\222\035\311\216H\226|\300d\372#\022"
+	.ascii	"\035\006\006\020\264\254\217G\214?m\214)\252\222\233/cck\031"
+	.ascii	"\033\3074\250\334##\351\007\277\321r\004;\202\035\3050\260\035"
+	.ascii	"\303~\024\273\226\0333|\274\340\340\272t!\313\3727qC\206\034"
+	.ascii	"\245\300\2408\212\207\2334\204\203\211P\006\220\263+\307\257"
+	.ascii	"\037\216\"G\322\254\177\223\266\1773\345\342:z%\200MIJ\215\013"
+	.ascii	"H\215\242\254\217]iY\212\274e\375\233\255\375\233\032\373?j\035"
+	.ascii	"\265\216[D.\027zL\325\035Q\242E\262>\002A\002%\f-\353\337\300"
+	.ascii	"\330\277\t\332\377\321\307\321\3071\253\003\250\030i\001Y0\264"
+	.ascii	"\270\315\215\021\022$\353\277M\3721\213\250\267f\267+I\242\262"
+	.ascii	"\376;\267\377\343\325\327\351\361\352\330\243\003\250\370\210"
+	.ascii	"\001yT#WWvd}\214J%Q2\227\365_\266\375\227l\377\307\252\351\261"
+	.ascii	"\352\310#\2045\216\225P\241\242\306\361\322\007\232\212\306\025"
+	.ascii	"\037w\f\2535h4\311\372\357\217\375\327i\377G\034_\247G\034\307"
+	.ascii	"\034\031,\366\tV\207\264\260\266\276\250\210\n\222\365\221\352"
+	.ascii	"\307#\211\0325\353\277C\373\313.\373?J\035\245\216S\276\240\370"
+	.ascii	"'H\253\224\344eL\230);\243\254\2176t\370\320\341\310\372K*\373"
+	.ascii	"K\263\375\037\237\276N\217O\307\032\300\240\370\347*\270\224"
+	.ascii	"tG\255\206\021]\311;B\271eV\264\214d\375\245t\177\271c\377\307"
+	.ascii	"\246c\323\321\211\r\212\177\246?\265\037\221j\223\320\221\030"
+	.ascii	"\306\004v*\242U\262\376R\305\376\217K\307\245#S\007P1\222\001"
+	.ascii	"\274\222\276\326\252Xy^kY\037e\\\361\222\027g}\233.\3736p\373"
+	.ascii	"?&\035\223\216JlP\034e\325\276\255G\325\261)G\030\253o\210\230"
+	.ascii	"\224"
+	.string	"\253\254o\303d\337\346\313\310\350x\324\001\324\217\017\022|\340\311\251\265\2019\322\226\365\361E\356\342eHS\326\267\311\261oCDD\364&\2542\305\210\324\336\320\020\224UN\211\230\\\026\026,\334\242b\306\\\274e\375\021n\373?\n\035\205\\\031\253Q\032D\245-\272\326$\306F\222\024)\330\\,\255-\271\254?\"l\377\307\240c\320Z\266\032\245@T\314\242q\274\366\301p\332\026$i\353\347\207\255BqE\215e\3748\222\365G\330\330\3771>\306\331\007\304\032\013\261\230\262\242\306\361\332\007[\315\256\252F\326\037\361\"L\030\343\030.\227iE\025\036I\2626\212\321C\222R\f\311\372\312\275}eUOo-c\203b\032T\277.MVT\237YX\214\036Y_\331\305\330\305X\005\006\305?;~GEWo@\254\"]\256dm\364\242&\346\006R\326W\022\331WF\367o\274\373:5\336\031\271t"
+	.string	"\025#m\320\003h\356M\213\310\020\246\254\215x\254\022\024\030\253\254\257\204\332W\266\330\277\021\313:5b1R}A\361\017\327O\211\310\207[[D\227\325\302hw#\3657f1\326\021\271\260X\340\240pdm\324\262\341F\273 >NVYg\260\"[\031\270\225\246\315;\264\354\337Xej\254b\264\222\002T\234\324\201\2200 C\212[mnT#\335\215V\210w\031\352\027c\216\307\223\254\215s\033n\244s\221\264\211\271\312\032\271\"\333\233\340H\\\234q\n\033\024\377T\021\2734}@\004\222\262\342\006\021\267\213M\350\211Qn\225\302U\251\352!\205\203\003JY!(\0356\204\204\265\025\307k\037"
+	.ascii	"\273\224\205\315\310\372&\260z{\333"
+	.ascii	"H\033\202b\033BZ\245!\271\265j\034\257}\360\363\002\244\005F"
+	.ascii	"\3267A\022\033\233\321\315\027\024\377\354h\215\\: \036B\262"
+	.ascii	"6\266A\351\001\266%\353\233@h?\351e\377F\265\251Q\315\270\306"
+	.ascii	"\006\305PW\256\322\220\026V\365\213\214\306\236\321\211\221\035"
+	.ascii	"]T\262~\222n?\331d\377F&_\247F&"
+	.string	"\306&)@\305H\006H\032\272\342\002z\00265\242\341\t!\241\313\372\311\260\375$\217\375\033\225L\215J\214g\035@\305H\017\240\016\351\350\262\343\306\254\350\222\265\321,h\206d\351E\326O\306\330O\022\355\3378\375:5N\215e\033\202\342\237 \256\0261\214\323\227\273\254\215HV\241\0339\304\354\227@\013\031\331\257\310\027\024\377P\265oC8\230h1\221\021\225\365K0\267\177\343\330\3248\366\033\002\006\305?4\332j\321\034V\224R\230\031Y\277\004R\366o\004[\247F0\243\030\222h\016%bN\214b?ke\f#V5\225\030\233Y\326\277\022|\255S\343\227Q\232\002T|\304\200/$\2731\276\24543\271\254\215Rb\227\354F\345\310-\353\227\240j\377\306.c\227QH\nP\037\340\315\275m\335\250Cc\221\265\321\353\213\334\2304\353\227`j\277\0045\200\374\355Xkd\235\032\201\030\203d"
+	.string	"\213}~fRrj,\035\0218/Y\033\267p\020ue\375\022\314\330/\001\026\226\361\007\030\002\302d\335\370\243.\355\311W\326F\037l\025\220\f.Z%\370\211F\213b@\254\261\020\232\224\020j0\032TG\315\372$\200\263\262*\352e\260\370\005\007\264*\245`\230T\024\213\254O\002\260\375\033\253\246\306*\343\216\020\3268f\"EFU\002B\303\210qG\261EP,\351\nS\326'\301\023\025\2251\307\n\026\027M@\256\351\003\215\324FE\nP\312O\005\02400\262>\t\204n\334\230z\0226A\375\250\332\260\001\224\262\202\305E!\344\252\224\266\342\330\355\203\326\247\212^V\326\037\001\224\375\033k\3240F\255Fi,\365%\032\307M\037"
+	.string	"\341Z\324h\002J92\222\305-\353\217 \311\376\215O\277\b#\254S\343\023PJ\006(\237;\022\276\200n\260\371\352\210\344\216d\375\021`\355\337\350\364ujt*\346i\260\330\207C\324\336\331V\034/}\220\251\264M\353\262\376\b\234\366o\234\361uj\234Q\274\323`\361\013b\321\235\\\022\361\256\313\211O\326\037\201\220\f\031>\035\035@\375Dm@\215\361\345U\215\343\245\017\206=\270\212"
+	.ascii	"\321\305\210Q\026\274\222\244*v\002\003\206\261h=\006\3056\330"
+	.ascii	"\242q\354\366\201\320K\354\245.\t\022\022\215\341\364\b\230\257"
+	.ascii	"\254/\202\260\375\033_|\235\032_\024\251\254\020T\374B\002hQ"
+	.ascii	"<\275;\271\273\241\254/\202!\3737\022M\215D\306\"V\b\352G*\001"
+	.ascii	"G1\272\222\252q\354\366\001\320i\nhI\272$\224dH\326\027A\f!!"
+	.ascii	"\343\320\032B\f$GD\303Y\213\033\207\212\2002\256|)\312\332\310"
+	.ascii	"\202\255z{!4\315\332\270\302\370C\005\232\262\305\356?\360\247"
+	.ascii	"\226E-,\353\207 L\212\024\306\240\035\307\261\2174.\002@T\351"
+	.ascii	"*k+\004p\373\3051\305\275\033\343\033cc\320\215q\034\007`\314"
+	.ascii	"\222Q\007\277\021\350\306\240\352\330\033\223\254\237g\374\371"
+	.ascii	"\017\024A\345J\024\343\217\321\307\2152\341\211\211\241\004\244"
+	.ascii	"\347$\353\207\200\310\376\277>\377"
+	.string	"m\374c\024\307\361\221O\032\033\001\t\333\177\375\352[\327\016\376\341\312\256\004\370\257\331\237\004f\026\210c\2539\2508\216W.\333\207\331\317\214\r\342\377\177M\034\307/\204\202b\237UH,\352\205\220X\224\321Q\310-\352E\034\364b+(\nj\025\n\21222\n\212}\216\261X\224\221P\034\365\302\030\213\3051\204\304~|V\241\240\370E\034G\305\306X\350\347E,&5:\n\211E\031\t\211E\2758\n\211\375\274\020\212\241b\243\220\324\206Q,\215\3629\266\020\373y\021\213A\2758\306bQ/Vt\311\360\321Pe\312T\226)AP\220\254D\204\202b\"\027M?FF8!)TL\027\307+Y\212\330(\206\213c\002\304q\023\224\021\335O\214\365\f\b\216\b\250\354\007\352\002\027@RPq\020\234\317\032\303\teA\305q\026PN\354\"\216\343\230\001>R\2708\307\n\347c\243)\036J\021\307"
+	.ascii	"\210\245q\354\"\216}\326\030.\216c\2378\216\177FM\3228f2\nE]"
+	.ascii	"\270\210\343\245\f.\342&\237%)\3428\223]9{!$&\005\265a\311\230"
+	.ascii	"X4V!\365Y\205\206\240\342hL\027e\264\305|\210\304Cq\034\257x"
+	.ascii	";\372\002\351\256\030\206\2652&\310H\326\007\301\236\224\250"
+	.ascii	"'W\344\245\370%\023\2314\211\262%\353\203\240\312\006\322\003"
+	.ascii	"\007\230\254\245S&7\034YK\3353\032G\222\262.ra\333\314j\230e"
+	.ascii	"}\020\250Ig\226\200\020e]\334\242\333\035>\272\266\262>\b\306"
+	.ascii	"v\321\216i\306\231\222\254\017\202\257]WW\274r6(\246a\026\215"
+	.ascii	"\343\245\016\330\033Z\232\234\262>\bv\354\277\230\245xeo\261"
+	.ascii	"Q\347\245\030\367\270\342\225\025,.\272 \272\324\301\366\022"
+	.ascii	"b\305fe\235\026\257\004u\324x\252\222u\261J\221\356F\2202&E\272"
+	.ascii	"\342\234\022\2238$\305\271\342\221\323\321\216\257\254\237W\244"
+	.ascii	"\202\203\307\234\212\"\225\342\224\243j\213\037t9E\217\"\034"
+	.ascii	"E9`\334O\r0W\262>\b\216v\224\"\334\212\027\003\r\351Eq+B\331"
+	.ascii	"r_\246"
+	.string	"\332\250\270\025\331\330\351\224\030\271\254\377\201'\305\265'T\242-Y\027\235\034A\241\304I\326\377\300\330\376\213i\353\264\250\326\305D\032\243\210\326\336\3051\232\262\376\007\254\212L\212g\016\210\345\242Y\377\003SfDL\360\224\267\224\245\354\353\264XV\234\256`\261\317\b\242 a\t\257\020\001\271\221\365?p\264\377\"\222\342\364KE\331\217\254\213G\204\224} h\377\305\261iq\254h\244\003\250\037\254\r\320\200\354\306\210\240\nd%\353\242\221\252\262<\037\262*Y\337\003cN\230\201\204\026\366uZ\f+\022\361\005\305?U-\215$\037M?\0323\352dh\001#\262D\345\362\225uQ\212\304\250\r.\353{@\216\210\t\274H):\022\362uZ\024R\354Z\301b\037Wn\005\022\326\212\203l\207V\326\367\200\331\376\213^][O`5\262.rE\241\274\030\312\372\036\220N\303\300\220\001\371:-\002)\376\350"
+	.string	"*>z@\230\245\017\\'\0301Td}\017\360\330\177Q\353\305\037rA\252d]\314\242Kcs\362T\304b\277\314\361(\313\372\0368*\366\210\026\227\206<|\200\001]\021W\210\261qy\263j2\302&\305I\221Gq\007R\222,sYWI\203X2)/\"Y\337\003)r\254\323\242\216\342\215\347\242\216\"\216\"\325\003\214\224\274\320\2502\365Z\250i\252g\037+zfgY\277\003R\366;\220\266\377\342T\321\206\316\341\242*\207OI\330\2216\251bT\226'&%Y\327(\372\210i\342\"\353w\340\310>\207\"5\246\265\314\256\330T4*.a"
+	.ascii	"$\264\302\026\226bS\221\250\370T\234Qt*B\025i\254\323bSQF\261"
+	.ascii	"\251\350\302M\tO\r\b6\265gE\250\337\201\034\373\035p\212\221"
+	.ascii	"a%\212C\023\223\365;\240\264\377\027a\024\223\326iQ\251x\204"
+	.ascii	"D\\!$\032\307\322\242R\361\005"
+	.ascii	"q\005\tU%\273\267\252\006\n\263\342\326\352\267\200\267\337B"
+	.ascii	"\226\375\026\350\366[\230\262\337\002\334~\013l\373-\240\355"
+	.ascii	"\2778\324\002gG\024/[B\324\350\212,\212+\240x\235i)\n\275\270"
+	.ascii	"b-+\3231\304F\326E\025\033^\024\032\256\341\240f-\200b\212\""
+	.ascii	"\nwn\314\355\310\333\213(\276J\225@)r\243\030T\004\"n\305H#+"
+	.ascii	"\306/\002\375E\237\342\317*\035\216\025\371\231\222\365J\265"
+	.ascii	"\322\2644+\262\325Q6\274\030\3571jD9\366\356\246\235\374 \342"
+	.ascii	"3F\bV\007&\205\016\242\030b\030\366\007\321\335\025\027\305\224"
+	.ascii	"X\034\030\242^QI4Oh\007%\232D\374B\254n\263\037\2702\326NI\253"
+	.ascii	"\310K\027\252\322\224-A\276\264\"L)\362\270\314 \202\206\"\353"
+	.ascii	"\352>\252\306H\360\356Z\210\251\022\246\333*\325-\261-Dj\266"
+	.ascii	"\2432\246\005\221\352\263\372\330\240\250]\261\323r\343\306\021"
+	.ascii	"\262\254\263\020\353\260l\"1)\234d\375\026\276\262`\371"
+	.string	"@\343\f\357\312\211X\264\025\024+\220\262~\036\321\312\177`\260\312\0250pV\336~(\364\330\304\350\346\276x\305\255e]\305E\222W\244#\353\267\300c\177\005\003\205J\244B\224#\306\255S\342\024\242\224\f^S\210O\210n,\021\243\255$\314\215\032\307\322)D(D8V\332#\216mT\375\264\222\356\250\305\024nc\\\266~\0133\366O\204{\2245\242\266\252\264\230\tI\223'oD\251\220\306\024\323\\\326o\301h\263\021\333\210]Z\3449\001\303v\267\177\342\232\023\355&'\304\205\0235\"#DM\262N\003\002\323b\312\372\"\250l\250(\"UQ\230\325\021QI\216\253)\206\334\026\365\255JGTGU4\307\016\352\022\261\006\t)\214\200GaW\324\350S\026\021\210\f\252\217\031\304#\302,/\352\224\210FdBTBlB4#\236\021\227\020\307\002\320\026\336\035\246\b\236\035b\006\030\2340!"
+	.string	"5\002\220\311@B\013.\330\2749\035Z\270@"
+	.string	"p\223\271\301\362m\3420\241\315\036a\206\fG\027\206\233L\266\311T>\201\260S'\304\323y\302\333<\201xB\207\347e\301\204\323\204\343\363\205a&\0060xw\230\"\232Nf\006)@\241o\363\205\225+d\200\231M\025nzF@\267\353|\3320wZc\006\020'x\234\035\226L\036\342\t\036\247\r\206\347\230x\362@?\230x\036g`fS\005b\t/"
+	.string	"\236\243\001\211\323d\262"
+	.string	"3\233L\343\216\363yB\206\016K\245Sg\246\210\202\t\346\t\313f\t/\254\\2u\224$2@\241D\270\251\302\222\3113\264\261Q\"\237J8D\315\0133\237%\334\017\033`\001\304\005.\260T\276\317 sy\201\023\312\017 ^X\251\323c\243\243\354Psl\227\320f\017\362\304S\371t\362\354\274\"Dh\360\332(ux^\026\240\307Wg\204\022\356\371@"
+	.string	"\370\205\356\274;\255\b\034^\027\224\037\\8\371\3560E\330\300O \374\206\260\201\237-\017\364\0034X\002\024z\334y:o\232*\324\300o\b\250\nP!T\beB\237/\217\321%!8s\302\204e\223y#\200\006lha\251|Yx\302 nzF@\177\360\t\023nzF@e\232%\234K\270''\204\373\034\r&8E\324,\235\037Np\301F\311\203\204\223\357\016\023v\225\260\316\353\301\005\250R\004\374\342\310\374.x\216\206\001\200X*\235+\220(\001~q\002\320\001~q\006"
+	.string	"\27784\313\367\311\354A\301\313\002\374\342\034\241<\036t\22469\260r\007\004\030\332t\332\370n\340&\363\251\323BU\200\252\2004q\001\247\b\370\371\222\300\260\323A\247\004\f\317\321"
+	.string	"u\3628\231Oe\007\226\357\005\340\027\347\270T\301\204\323\204\023&\230p\232\260l2o\210\360\2133|uF(u\230J\022%\300O'\b\350\216\263\371zxa%\013\360\213\302\314s4\300\314&\023~\223\360\213C\003\007=\300/\n6\360\223\370\034\r!\226M\246\t&X\200_\034\231\247\322i\202\n\317\367\331\003\333(oz\232\312\017\360\213s|\216\006(\0068\371\276\300\204\266::=\315\246\263\371+\341|\346\300\316\346\357F\371\352\350\367\331\303\243\233\257\316\023\206\2668M\346\023\016Q|\216\006\347M\223\231\264\271i\3420C\300/\216p\2037\271\343.UxyN\210\350\261\371"
+	.string	"\2778\302\345\333|_\023\240\312\024ll\2243O'\354\374p\201\022Vz\0302\241P\026\340\027\347\207<a\243\304yW\200_\234\232\017\360\213\343\226"
+	.string	"\2778\356\233$\026\341\027\347\370&\227*\300I\343\233\\\252"
+	.string	"/\225/\013\306\006l \301\025\201C\013/\314|z\340\246g\004T\b3\233*\360@w~\307\034\230\351\001\rp\236%\344\300L\017d\200\034\3328utJ\220\271\240\004\036\350\016\315\362}\216\206\367\271\324q\246\200\243\334\371\271o\222\007\332\241\251\002\262y\002\017t\007\003\374\206\2609\201\007\272\003"
+	.string	"\270\371\356\364\340<K\300\360.\235\037dB\344\340\3648\23790\024\252\004\261l2O\340\201\356`p\234\371\220\301\273t~\b6O`\201\007\272\343\276I\f\260\021\003\370\b\327\300F\0328\211\303\274Ar"
+	.string	"\323\30020"
+	.string	"\234\315\0230SG\331\203\002\231%\223\004\264\330\314\261I:o\232L\022\320d\b\020(\020s:\354\3644\223!@\240"
+	.string	"\f\"\337\035g\nN\021\314e2\004\b\024d\3406\371\004\301\346&\b\033\341\031\f8\200\276;J\r,\231<\033\304\261\303\005\260\021F\3024p\022\372|uz.@\363.{`&\f+7l\363l}!v\2340\024Z\003\343(wX\330\306F\311\362@wf\006\220\301\t\345\363Y\002\001x\224\037<\250\340\204;x(\001\003t\251B\007\350R\205b\007\226/\374t\362\360\364@\00103\363\034\r \340\364\214x\227>\026`&\n\360\323\231\0035\276;L\021/\254\364"
+	.string	"t>O\340\350\347h"
+	.string	"a\251\303\354\031\361\356(5\020\204{6\320t\002`\371Tv\360\020\""
+	.string	"'tx^\026N<\225;;=!r\240J\235\033%\254\364\240\301m\230\317\267\371\342\3543\240\001\013h"
+	.string	"\t&~'\001\002!@ \204\366$@`\303\006\b4`\303~\0036\2600\f\303\032\220i\236"
+	.ascii	"\302\204\323\204\367\005\346\005o\262\351\204*_\026v\236\316"
+	.ascii	"\025\336$\024G\251s\302\2533B\tez\230\201\223O'\314\303|\332"
+	.ascii	"@_\017<\320\235\342\363\335\351\201\302\320\267\007\005/\013"
+	.ascii	"\317w\251t\352\300N\347\210\2327\271T\301\005\250\022\3362\260"
+	.ascii	"\257\b#\341\235\027\206\236\b\361&y\240;B\3709\032|8N\030\312"
+	.ascii	"\314q\341\347<\231K 4\t\277.\330(A\360@w\\\3709\032nzF\354(\337"
+	.ascii	"'\254\301\262\371\262\320\344M\317\bh\373\204y\330\233\236\021"
+	.ascii	"\354r\307\206\205\342(un|\260N\017\264\tC\235 x\240;H\030\232"
+	.ascii	"|q\224\320\026\216\3017y\302\314\206\223Ba\007\214\257\316\b"
+	.ascii	"\245\b\022-\374t\362\004\337\344\006\340\247\223g\bu\376^X\311"
+	.ascii	"\302\262G9b\277/0C\274/0Clx?\205K\345\233\202\016S)\342\371\336"
+	.ascii	"\334\364\230`\002\026>a\020\031\202O\030\304K\202\371\332\274"
+	.ascii	",`\320T\362\2040\361$*a\245\007\023O\342\023\006\241\002|\032"
+	.string	"\023\312\035#4\031\242\003\017t\007\203\216\322\006\bm\241\307\3465q\001\035%\354\204e\236\243\341\335a\302\260r\231t\237\312\367\204\316\201\233\316\035\337\t\345\222\205>{\2349>\350\013\3674\231;?\350\262\351\264y\241?(SG\207\271\323>GC\261h<B\231\316&Q\347%\221\274\261qq\224p\322\306\371\nq\224p\362\251cc\"\351|*G\f\227L\036w\307\331|\227I(t\311\34496\235L\270\371\222x\237<"
+	.string	"\330"
+	.string	"V\276.(\341\344\te\te\263\347Y"
+	.ascii	"\3709\032H\274K\034\236\242\007\037\264\307\004&\017\264\305"
+	.ascii	"Q\212hBmZh\217\t6\"0K\260\021\201\031|\177@\021p\363\335yI8?"
+	.ascii	"8\237'p6"
+	.string	"\270\341\321IB{\222N8\371BN\361\205\034\343\206\r\"$_\310\231\021!\t\3378\241\031J(O$\207\307\227\347\004|,\241<!S\203\314\201\227\314\0225(p\215O'\254\334a\302\320\027\t7{\234\315\023\313\"\206\345\013\265y\312\354\022\312\023\302\343\213\243\343\314I\302:\312\231\022\312\0233\0368\030K8u\21098\314\234\342\222\203\216\362\t\367\274M\340\222\303\262\251\034\261T\276Kd\t\247\216\273\344 \\rX\276\305\347h0&y~66\312\344\362\351\264y\237A\234&s\351\264i\276\233\b?G\003\bNf\r\\#\343\002T\371\241\331s#|\223\360\323\t\202\031\344\201\356@yp\216\260\362i\3029\302\005\033\245\316\b\f\320\247\223\307}!'\331\223\244y\276\260\215\362\251\314\261I\302N\347\210\367i\204y^\030\252O0\361\274\340]:w\364s4\200\220\201\361X\302\251\223\f"
+	.string	"\361\346\306\t\235y\237=\313\327\306\371\344\221\251q\301\206\tC\223\357\215\022\252\303T\336dx\216\006\023O\020px\220&\236A\036\345\216\315\323\267|\217&^\035\236\036\0177:\312\234\340\273d>\233\314\r\2228=:<\031\236\313&sD\022VB\223;=O\330\205\227\007\032"
+	.string	"\341\253\243\264\t\302\317\227D\223i\363\\2w|M\346\316v\301\346\315\2611\241\334\331Eh\007\035%\211\246\223\251\202\315\263fG\331\201\004\317\215\fS\231\241\311\264y\241=&\236n\322D\2172iB\271S\204\322\270/\317\t\370x\201\0065/\211\347\273\304 \211\323d\332<3\360\274;\312\347M\322\346\tM2\241\320\347\005Kf\022f6{\206\"\350\230xB\2130Ty\223\\\366(G$\241=#\240\304g\023\2324\361\274\201>m\212\317\321"
+	.string	"\302\360]:?<_\023\314\035`\022ZBy\242\206\207\251sC\363BN\362\206G\307\371|C`c\243\374\301\317\027~w\2342=7\3572\t\327@sl`&\210e\263\004\035\035\347\023\tM*a\245\207\020P\036\234#\274\323\001\326Q\372\240I\033\347\nP\036\234!\254\324a\233N\0356GG\207]r\370-\337\227'\204\373B\237=\316\016\313f\217\363\211#\344q.s4\254\f\261\323\323l\237\243\001\312\203\003\202\223\311\203\343\276P\036\234!\317~\223\301w\351\374"
+	.string	"U\216\200\3567Yt\302=\312\340\233,\001\312\2033\\\366(Mp\302=\312\355|u\230:J\234\344\013\355\241y\223\357\322\371\3015\341\324\031A|m\232\316\344\273\343\314I\302/4\t\345\301\251YrH\276\320\236$\224\007\307x\002fB\225#\240\304\3422\211\243\334\031&q\224;B\227\230\264\021\201\231\304Q\356\024\211M\250M\222\311\343\342(E\300<=O!\f'o\336\345\362\205_\035\236\035g\207\031h"
+	.ascii	"z\222\320\035\346S\204\007\032\347\363\r\001\216r\347\007\367"
+	.ascii	"$\217;N\030\332c\223\304Q\356 \207\360s4\200\200\303\203\341"
+	.ascii	"\371\3560E,_\f$^\017/\254dAhl:\231\320\347K\242\251\302N\t\020"
+	.ascii	"\307\235\022 \226\257M\363\004\264\331\302\013\355!\302\320g"
+	.ascii	"\217\t/\264gx\342\t\277;\257\316+\342\bmu\2346N\330\371\004\001"
+	.ascii	"?\235<\030p\232\312\0210\323\004\330\231\003\365\360B{\212o\217"
+	.ascii	"\216\262\003\033xu\226*\350(a&\016s\211\241\311\334qM(w\334e"
+	.ascii	"S\271\263\343\264i2w\202N\020D\030*\200WGi\023\242x4\321\243"
+	.ascii	"\244y\276p\363\355`\204\237\243\301\204sDr\251\002\334|\233\312"
+	.ascii	"\235\347\313\343B\223&\234#|\276wG\251\001\023\316\021?\330)"
+	.ascii	"b\371\272\320d\352lhr\331tv \301\204mJx\227\316\235\013\336\344"
+	.ascii	"R\005\023\316\021\277\245\n\357\322\271\323\232\350Q\026\341"
+	.ascii	"e\363\375A\223/NS\311\002\221\347\205C\300O%\f\005\2768M\345"
+	.ascii	"\323\367&]\033&\216s\205w\351\334\001B\223\302\027r\222%\224"
+	.ascii	"'\210/\344$\215/\344\300\317\321\260d\362\234\260B\2237K&O\013"
+	.ascii	"bUa\365\260.\231<,\334d:A\360\364,\233L\017\324\270%\224 \350"
+	.ascii	"\t\261d\362\020\233\314\017p\tK&\217\021\266yon\220\360\363"
+	.string	"\3451\361&a\035&\234l:_`>\2359\031\336\245\363\303\t\230IB\371D\201\t7\225E\021\030\232L%\nOg\t3,\224P\2368\276\260\362I\\\342\030\227:\316\034\350\373\314\201\223\360\013\315\360\3560\341\240;\203\354\260d\202\200\225#H\2108a\371\27674%\224'\222\305\340\0139\311\343\211\347K\302i\363>\2239P\345\323\206H\24412\335\fP\246\teM\223\251\3049Bw\222K\345\233\243t\301\351\324I>\337&S\371\204\223\316\247\215\362\202&S\211c<>\235\317\347[c\223\204\216P\312\210 \363BN\262\311|!g\347\371\302\313\231w\351\374 \002\003\230\271\303\\\341\325\301i\226P\323d*Q8\302/\364e\341\371\342\3400\237\"J8utJ\350\220c\323\354Q\352h\220|\241=2&\224:\3573YBy\"\271|a\345\023\347\205\233\314\231\027\230O\345\333d\256"
+	.string	"C{\23690\322\327d*q\202\257MSIb\251\\\016\341\036\036\270\307\231|:a\347\216\214\216\316k\223\254I\302\315\227\tm*\237p\006\030\352t\216H\336\334\354\035\236g\262\311\334\021.\337\227\007\206\366\234`\251\244i\227L\036\342\013U\276O\233&\363\325Y2\217<:N\236\233\233c\322\204r'ysst\201\311\003M\336\334\020\237N\330Fy\223\314\201\235\316\035h\362\346\306\350\3441\361&_\022\317\036\233\344\r\217N\262yb)\363\332(\237I\235\227\304\253S\2046_\236\035\247M\022G\tM\302\312\021$h\340\347h"
+	.string	"\301\346\346\335Qj\200\307}a%\013H\022\226\314\017\317\034\370G\202\223\307\304\005\2369\360\206B_X\311\202\315\363\347\3441q\001\233g\013}a\345\323\347A\005\020\317\034\021M\246\223\307\005\345\373\034\221T\362\300\304\227\347\004\214\344I\352\300\260\363\231\003c\200\231;L\235\344\013+\237\301w\351\374\240\344\201\177=;L\227\207\351Br\307f\331\276:8MeRGG\271\003\325q>\341\246\323FI\334y*\2230\364\311\274I6\235I\035\245\r\315\t\245\316\273L\356<\225P\3462\351\204{\224\307\347hPr"
+	.ascii	"M\302\315w\307\250\243\343|\272B\350\373>q^\017%\224'\202%\224"
+	.ascii	"O\3669\032zv\230\031tt\234O\235c\0033y|%\224'X\350\333\243\243"
+	.ascii	"$\321"
+	.string	">G\203\211'\b&\236H8\031|yN\210\370"
+	.string	"\013!\204\316'\b\023O\035%\363\371B\215\302\027V\262\220\003}\2377/\013&\236\303'\f\242YB\311\302\323}\302 d\232'@{`%\034\342\t\203@B\223\357\016\023n\366\260`\342il\236"
+	.string	"\205\2766\316'\b\233\247\021~Q\260y\312\300Ix7O\200\266\260\243|\236`\363,*a\245\007\033W\t+=\274;\312\347\r\0206\341\034\301B\223\317\327\004\363\303\020\356\341i2\335\345\373\362@}\360s4@A\320y\233MeN\207\035\347\363\204\345SY\342\351\274\221\201&w\224O%\b'\211\347\013\025B\227/\364\371\222x\237\305&s\2075\241\334a_\235\345\222\271\323\266/\254|\302N\035&\317\360\335Q6\365\273\243\324\200\373\034\rP\250\222g\307\211\243\334\361u\360P\002\216r\247m2ul^\0176L\370m\342(w\220\317\321\360\352\27466J\002@\22366J\037l\363>\223A\033\233\022fll\224\033\205\rI\033\033e\333\332\330(\267\215\215R\370.\235\035H\274O\341\363\325\321a\336\264$\336%\333\301C\t66\312\366\265in"
+	.string	"\206*\337\025\340\022\226/\254\\\362\264\240\363\332\330\224"
+	.string	"e^`\363\004\301\346f\007f\232`\3029B\b\205\231#\264\216\262\007~2;\200A\006\370\205\336\3348[\370\3712ux\230\260N\317\316L\007\017%dxu\2246PX9\202\004PGI\202\004s\t}\237\260r\004\211\341s4\0207\f}a\345\n/\216\222\330,\241|z\310)ag?G\003qY\\\276\315\236\340\362\305QB\335\233\033'\334\323\241\003%\234:\306\347h\310"
+	.string	"\2324\241l2wdJ`\200\233/\364}\362\300\316&\254\034A\342\002\033\022:\3037)\363&g^\233g\2173\304\363\205\337\017p\363}>{ldN\300L\033%\217rD\021V\232\320\201\027\3323\204\302\317W\247\204\016/\264g\346\305Q\302\315\327\346\371\202h:\2310\317N\017\264\351\264\301"
+	.string	"\312\204\276\317\027\206\236\310\201\225#H\020_\034%\254\343$\241\243\363\332\350\350\364\334\300\312\021$\220::o\207\023\317\027\206\225&\2746O\347\r\315\t\245\016\017\2249\003+G0\2078Mf\363\251\364"
+	.string	"\006\035\245\r\023f>;<\235'x\200\225#H\324,\235\314\347\013\342\206g\005\034e\bX9\202\204\3619\0320\270)B\337\023\226Eh\322\371<\201\323B\205\360\213\363T\302D8)\002\207w\207\t\3638\235+\020o:x(\001n\3668;\270;=!\200\313\013@\233%\234\313\232\r0N\223\331d*w^\026\240\257\216\315\t\233\"4\331\301\371<\201s\334\351\201\262p3\271\303B\223$\336%\f\375}\370\020b\251\343L\356\264!J\274\315\344N\373T\222`G0u\2246.4\371\034\r\006\200\213\311\337s4\3006=O\030*\0024i\342\205{v\216.\3308u\222\311\026n\3668m\222\311\337\363m\226p&\223?\350\363\205\3664\223\311\275l2]H&[h\223\311\003M&\177M'\023\312\324y\223I \234\204\241L\035\343s4@_\236\023\360\002\226\357S\231\003]"
+	.string	"\bP\2309\002\204\236&\316\002L\3644\231:\013`@\003\222\r \301\004\b\357\262G\307\246\311\004\341\t\355\001\341\001\260\211\267\251\243l>_\270\311L.\225\3573\007\346I&kH\274O\236d\262\205\241L\235d\262U\302\312e2\331\276/0\241\311d\353\202\215SG\303\314\246\n0\263\311\244i\236\260T\276\317\366\t\203\260i\366\234\240\204\225\036\226\312\227\005\347\363\004\n\0274O\030>G\003\0236\361>_\235eS\231\002\0236\361\"\341\346M\206&m^\026\\\260Q\216\320\321Qv`\302&\336#\0236\361j\030\232d\362\204\270y=\274<'D$U"
+	.string	"\021\302}m\232J\030\332dn8\271\001\025t\223\t\242\t\265i\231<P\026\232\354 \202\nn\007\021T"
+	.string	"\2666\"0\331\347h\200\366\214\270"
+	.ascii	"\232\374\2604>_"
+	.string	"\030\252\334i\241\320\367\271\\*\177/\t\245N\210\036\236\235\335\223$\361.\241=#64\371\3320I\274\036\240=#\3347\371\362\234\020\001\355\031\001|yN\300\320\236\021?h\317\b\366\325Q\332@}\316\347\033\202\335\301C\tpR\004\016p\223\371\203\3668\231$\336'\b\231\022J\026:x\b\376\336g\017\254|\276<;/\354\302\317\321\320\303\263\223t>O\340\330\330(A\200>_\022\314\3472\001o\222\205\020F\b\241\001=<;\310\246\223\t\367\3508\241\3573\bM\316\274\311\036\236\035\267\205uz\240/\013\257\207\036\236\035\2317\331\304a\352(\223\304&\016S\247\204\344\360\205\0242\360\302J\026N,\225/\013JX\271\004>\2417\311\034\034fN\362\206GGx\303\243\223|!\307\005\0218$sd\240<\316\247\207\347\273d\222`z\350\341\331)\302I\034\245\b'\363\207\243\024\301\204M\\"
+	.ascii	"n\252\320\303\2633|\223\304\367\251,\261|\n\341\347h\200\346"
+	.ascii	"\300\312\235\235\025\232L\362\334 M0\237\260\362\003\354|\022"
+	.ascii	"\235\317\0238F\022?\021\\\030\232$\361z \361z\bQB\371<\301\371"
+	.ascii	"<\201Sl\236\260gt\2064\360s48\237'p@\200>\235\320\346\013\005"
+	.ascii	"\300\261'\271\202\363y\002\007\t\273\260\026_X\tC}\033`\036\242"
+	.ascii	"\bP\250\222\247\204S\207\270a\303\023\0061\003\337\b\233'\234"
+	.ascii	"\320\341\341)\001\t?G\303\r\bM\347\316\216\b'24\351BSi\302R\331"
+	.ascii	"\203\002\346\b\231\020F\344\r#\262\b#\362\006e\026A\2317\230"
+	.ascii	"\310\"\230\310\033Nd\021rl`gS\370B\n:<;\312\02066\312\342\013"
+	.ascii	"m\301)\302\371<\201\003|\227\316\017M'\023\266ya\347\023\304"
+	.ascii	"\006\240\312\024\234\317\0238\027\3508\235"
+	.string	"&$}8M&\016\n:\312\036\017/\264g\006N\232x\227Mf\022j\303\334Q6O,\223p\016\016S\347\246\006\3124Q\002N\317\210\327\203\363y\002g\370|a\035\346\t\302&\023N6`\003\334d\366l\023\312\0177<+4O,\201.@\225\037\240L\023%\224p\352\334<_\022N\343s4\004\340N\236\367\t\002\354t>Ap\241\311\016;/\f=\001%\232x\227M\025\226L\236\"\t&l\243<\276K\347N\022\247g\304\273\fBm\2300\224\t+ah\322\005\250\022.\346\330\300\314\022!\240N\020\rxu\2307\316'\210\027V>i\\\260q\352\330<_\022\316d\017\217\315\360\335a\212xm\224O\024\232\033x\276%\234<\030\236/\363\206\t7\337\245\n\313\247\3229\242\370B\316\207\027\232\323\276\260\022\016\321t2a\345\263\007\207y\323t\332\310\274\260\222\205\367\005\346\016\023\346\331"
+	.string	"\rN\223\271\363,\301\005\033&\034\342\325\031\241l\276G8I\002\334d\366\374\276aC\207\rZ\320"
+	.ascii	"\n\333F\003\017t\007\004\036\350\016\bM\246r\007\004\233'\024"
+	.ascii	"\004\r3o\317\333\303\201\267\311\324Y*_\017\317W\247g\371\346"
+	.ascii	"\330@1<\22596\372\177\r\035\223\313#\305PY\315\334/\206\215 "
+	.ascii	"-\262\026\372\\\251\313R#\245FJ\315\024\274\005x)\351\320\222"
+	.ascii	"{\315\224\342\025\034ilY\327\304\375\224\342\306"
+	.string	"\360\360\242\364\037\230L\323Q\255\332P\240\324DY7\220#\342\001\233\322UV\315\333k\242<Q\022\244\305VE\271\354\360\311\372\253O\323\026\026y\245\021\265\035\365^\234\231\371`;Fi\241\355\007\320\023\231\027\036\350l|Y\373!\324\322\343\254\206\023\343\220\331\036^\215\332\361\312\227\325\232\220\232\263\232\263\232&f$\324,yM\223\032\264L\347D\305\213\032\264\032&E\0327\276\256\370z\204\251m\215\331\177\215\331\f\023\213vd7V\243d\206\352H\n\212$3WWPp"
+	.string	"\225Ai%Y\250\310@\342\025&\245\241dJ$/M\351\322:\322\262\r\343l0\241Bv\006\367\265\227\303\310\214Z\361\351+G\2221(Z,\313\0271Ef\346\306 \301\233R#6#\227b\312%l\037\321\002\327\002lF\313\252#\007\212(\"4-2\024\032\214!\322\231\"U\250PU_/\364\222\270\024+\206\314X\235|\311\320\"$\3164\270\350U\275\240X\245<\265\272\256\251\032.\032\035xDC\332\202\024\325\252lTVd]\243U\003\3445[\257\331\3125[\354\336^+d\212\221V\327d1"
+	.ascii	"*\216\177j|\324\374xM\326\245Y\3050\305u\035@\366Q\2064\246\325"
+	.ascii	"=z\324\\m\2378\276\212\256\261\224]\303\243\206G\315\025\261"
+	.ascii	"Zc\365\232+\246\032pw\30566\310\n\026\245\"58jp\324TYi\242zM"
+	.ascii	"U\215\016\025E\324x\324\350\250i\321\205\352\n\271\322\005\306"
+	.ascii	"\243\246F"
+	.string	"M\215\232\251'5Q\257\231\252\261\321:\025\341\262\253\261Q#5\374\262Z\322\306\312A\241\"[c\02753jf\324<\335\205}\241\3264\275\346\251\206\306Zu\343F\230\032\0325ND-i?^\366\212#O/Z\240W\003\243\006F\215\f2\022\202\370\260\033\243\364\032\031K$l\004\311\250Y\252\211\261\255\252J\\\231\305\217\352\017)\273\306\250\306\250\006\t\303V\315\321k\220\326/0_\246Y\327\274 \256\360\301h\242\002K\013\214\354\032\0265,j\210\2604\325\264x\rQ\215\213)3\234t\271\250\031*\212bv\204\n\211\355\212X\013p\324\b\355.$?\310\262~\013\230\366_\243\202&\253\030\0179\005\325\244\220Y\021\235\262W\203\202\206k\005\022\325\242W\023tD\342#\365R\003DCd\n\234\027-\271\330em\202\244B\251\306\207fl}\242\002\312OMLc&\203E\023\243\2541\200\301"
+	.string	"\006\303\230\033\177"
+	.ascii	"`\204A\3141\214Q3\"S\2215\2060\306\0377\005\217\262=iXP\017\036"
+	.ascii	"Y\277\005*\366\217A\017"
+	.string	"\003R\306\262\312\232\361\005\3314\364r\0132\244*%\346\210s\262\347\345\350\245\221\306d\fu\331b\221\250|\214\345!\245\212)\234\214\260\270d\371\324\326\222\240\341\365\330T\352\260\222\356x\304\321\330\002\267%\307O\032D\254\212z\234\3128\324\324\250\354\214A\302\263!x,\264 s,\301\201\305J\326D\243\f\265f\345\305H\226c\215\265\005Z\227!,\305\"\301\"W\300\270]9:a\001\rq\263rd\"r6\r\313\232\330j\355P\261d\356\250\204DL\355g\007\230\221\032YK\305\326\234\360\030\232r<\372M\203\240\325\311\215q\022\212Q\2255\0205\f\214\254}haNmY\033A5\re\035\203k\313\217\267\252{\305\350.\t\024.\300$8\244\242\334\214\324\f\364\304I+\353\325k\212\217^\326R/\037\035VO\220WnyRpdM\344A\224\303\311\211\225\275*.aj\306)5x"
+	.string	"\211J3\272iY\305x\321d-\210\030\326X\326,\226\360\3124J\036\023c\223+!0\342\226 \261\264\034\321\215\235\031\317<\250\336"
+	.ascii	"33\226}\031\221\262S\262%\200\031>\320\222 \275\240T\241N\313"
+	.ascii	"\214bebvsYk 6\244\246\251QZuU\025t\244hD\312\336\021\022\262"
+	.ascii	"\242\022h\332\232\022#F!G`\244\030\033CN\225\232\350XH\263\214"
+	.ascii	"lU\021\033\033\253*9\n3\006\251\341v\005f\346\006C\212E\004\371"
+	.ascii	"\204\016jjH\212\214\362\301\030\325\364+\306\323\033\f\247!H"
+	.ascii	"*T\232\260\334\262\306\320\265b\350*\n\211A\305\361\017\006!"
+	.ascii	"\030\274\216\241\353&\030\222\032juV\026\206 sC?\265!\034L\252"
+	.ascii	"?\216!\310V\026\213Z\361d\013\b\330P\r.\252\034nxH\264\204RB"
+	.ascii	"/I\340\366\264\3608\017\fX\353\006P^V\307\200\205\241\207\r:"
+	.ascii	"\250 =0D\325\214@\271U\315~p<]\001\265\260\325&T\252\240\334"
+	.ascii	"\270\201\241j+\004!a@\206\3408\206*\f:^|\3355\321\201!\007\223"
+	.ascii	"\021\255\251\333:\345D\305\021\025\260\311j\344\005\211\212\330"
+	.ascii	"\323\023\006\033\034\004\305q\212\370\204\225\024\022*\3241\330"
+	.ascii	"\220\022\252\255\035\271\222\212\002\206qb\261U\343\247\002x"
+	.ascii	"\343\306\\\\\243\r\243\225\024\3059\2606\206%\fK\030\234\250"
+	.ascii	"8\370B\262\033\203A\30618ah\272\262\325\025\205\241\t\303\f\237"
+	.ascii	"\247'\325.y\307\231\232\031\006\246\266\216\310uu\205\202\005"
+	.ascii	"76\006%\275\256\371\310\"\227\365Y ccHz\233c\001\214\215\\\332"
+	.ascii	"*R\205\212\341\250(&\306X\214 \030^\350)1B\304h\207\326\222\343"
+	.ascii	"\305\224\"c\216l%\256\232\202\210\206\032D\342DJ\346\242k'M\231"
+	.ascii	"\223\033\242\261\333h6\254\354\2650\262w\005\245\013\003\013"
+	.ascii	"c\324\323\n(+d\316\270\240n\260\020*\346\205\3618R!\303f%e\202"
+	.ascii	"\"\305\235fQ\346\"\006\n\264!4!@\202d\246\007P1t\206\001\250"
+	.ascii	"\030D\b\226\r\f?WZ,\027Ax\030|\212T\227\2134\032c\210e\360\204"
+	.ascii	"aT6\210\366d\272\024\251`\2228\215\001#\264z+\002E\214\221\324"
+	.ascii	"\021*-\2320.\316\212\276\306h\300\030\213\210U\250a\2464zu&\334"
+	.ascii	"\rM})~\025\243\200\211\331R\225\211\003b\245H+\313\232f\013\315"
+	.ascii	"\026\232.\227\371\271R@\020\240\033lw\247\351\222'\224V\211V"
+	.ascii	"\311\343\022\324\212\2632\006\257\005\372\025\t\242e\212\347"
+	.ascii	"\0233t\262\242\311\330\230-\343cG\231\226\236\262\226\371\312"
+	.ascii	"\340\302\027\035EY\323X\241\261BS\267\032\031\335)"
+	.string	"\300\311\022)\254,\247\251K\221\205K\\\3264X\236\006\346\310\327\224\254i\256p\331?\r\335\361l\314\2201js2W,\021\020;\025U\220y<\216\300q\241\241\362\205\315*\211)k\032)Rh\344\326\r\3428\032\003Qy\361\001SR\007?M\334i\344\206pq\202b\005q\373\247\201\223\231\032\242qy;\213\202\264B\344%\355\305\233\214\216.NWP\216b\301)-nQ\267\026O\300\340\371\3446\344\226\031\037\273$Y\323\254\261-\330\333\333\333\013\023\307?4k\231\206\215\346\311i\326^\374\321m\t\375\264\372\247q2s$T\244IJ\355\230\246\005\207\025+YK\177D\354\316\2324\231Qq'\203k\215\006-\266\033S\302\2255\315\022\232%mQ6F\023\351^\326_\301\022\0322\0322\032\263,\227\013\016\t\017%\001\230\005\250t\305O\324&u\252$\206\342$\346\234b\fU\rM\202"
+	.string	"\303\025"
+	.string	"0X<\032\216\207Se\226\273\001\024\200\017[\262\204jH\250O\304(\251\2242F"
+	.string	"\006"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	"\001"
+	.string	""
+	.ascii	"\272-z\253h\360\321\301\370\003c\265\330\375\237\037@"
+	.string	"?\3366\200;-\266\317L\2170\024\006\346*\223\355\225l\013]\254\354\207[\017\340\327\305\355A\353\027O\306\253\323\256\343-(\236Z\245\310\033\312]\006R\363wz\311\337x\377+f\3358j\265#Py\020Y\032\bp\316\372\366|\263\357\005+:\023\305\250\316\222\023"
+	.string	"OE\005Vk\374\206\332\243%.';\272\374\204 /$\253\372d.-\221lG\226\215\037*\303\037l',\213\342\024\024\316+~Sp3I\37343\003\270\273(,\306\r\260\007\021\222B\341a\253G\\D\251P,\275\214:\n\341|\233\242\347\200D\206\004\204\220z\006x%zZ\177\217\331s\025\2014\245\241t\273\376cs=\024\266\356\3324N\372\017\005\\q?\037\262\357\005\004\242}2\223\325\270\r\336\002\232\nA\001\356\265\261`\216\333\354j\365\347\374D}\375\344\221\305\013\343\253\224v\272\3501\244\304\321\337\230xP\030\212}\330\033=\246\275\271\365?\254\333\325\241>\206z-5Kw\363\2417\026\267\377\3201\236#\244#K\t\222\202\300~"
+	.string	"\205b\037-\213\312\232\n\315\001\200 \264\353\257\235\241\331\362}\220\377"
+	.string	"\353\225\206\223\324e\007\021\223\324Z91\300\301\232\005\307\217\013\371\3326b\034\210\214p';\332\335{\316\301\335\211\227\230\3336\200'\243\001cT.\325\243\262\267B\f\217\322\263,\237_\357,L8\213m\312\351\237\270D-u\0243Q\223K|8\304\205\242\374Y\355_\304\260\213K\312p/0\354\303jz\304\331\033teD\020\360,J\004\370U\254h83\265\303/O\273\300\035SW\034v\372\r\nw"
+	.string	"\215~4,\007ib\2473\260\007\301\374\335\217\303\262b\r\033x\316\303\t\346\355\333M\f\310\211\356]XD\225\030js/\345h\372WA\361_Wx\177\310\n\030\177\274\207\200\034}~\317\375\241\n\033\303\337\374\201_B6\t\3647\330\030\032>Y\033-R\263\332\211\330\361\316\260\023\337\017J\271\244m\213D\345\244\211\336<\246\360\3033\356\001c\f\027+\261\351s\266\231e\221\221\331$3\215\026\217\027sh^\362\250\206\365\013*\017\310"
+	.ascii	"c\347_\343V\276\002yWk\005\256\204\342\361~\356\311\217c\221"
+	.ascii	"\267\336w\2062"
+	.string	"\205uC\224\270#h\331\207!\006\315\235\033\0258\326\005\035\321<\337I\263c|3d\025\350\271Xf\305\033NN\274<Y\201Y^\237\222go\206\310\300`\034\336\231D%\t`\212HZSG_\241\344\346\220X!\241j0\202\202fK\355A\230\234\013\235\326\030\270i\275\201\005gH\272\351s\372\311\201\262\305\035\3677\333\033\201$\002lUP\036\030\013\0258>\034y\3649\235\316S\361\r\324\313\367\310~\363\327\361\373\013t\034~zQ\214\224\016\230\177\371i\001\na\277\214\356Cp\275\331fPt6\004\n\326\001\277f\013\213\234\217\335\272ycd\242 \271\366\260\301c-\240\215o\031^Q\225\306\346\330\242\034\311l\037l\\BK\250hq\214\007\341M\323\354a\214@D\036\222t$\220\367\231\363\250w@\302\215\303\255r\312\003!|T\345\243\023\205n\2645\224\227Fq\353w#\220E\347<"
+	.string	"\323sV\304:h\210{;=\004\250\373\312*|@\355\354\262\3570\315\350\340\370\361\214\373,E1\320\355\026\tg\232\377\222#Hp\002\210\347-\260\022\017X<\203B\013\201\034\r\r\026\200\232\n\331\203w\235\261\233c\355M\233A\275{\342y\036\032\302U\007\203\3542\250 \364*\234\233\302\017\263@\350V\232\330\027\222\213\242\326_\331-\232\205\351\264\200y\250\224\227\207\365\234\317`\352\253w\207x\232\261I\230\360^Z\261\207R\tH\350c\346\352\365/\374\267/\037\030\336\255\340\370X\b$\364p\331y(~\376u\001\374\267s\275+\370\225\313&0\3106v\"CSyr"
+	.string	"kXc\303\2636\2368\232\340e\2153\371'2\217\265\212\346b\005\203P\302\024a\\\255\204\252\251\357\247Ec\326\320u\003\360x\317\257\276\302\004'\272\225\310\264\271"
+	.string	"\007\326\377\202\300\2169\022\360~\325.\261\022\316t\n\377P\0270\025\001\225\2370\301\031a\2501\364\002\271\fB\377\335~Q\340Z\270\360\323\370\222\347\3436\2376\233\334\023fv\021R\036`W\376\304r\3037\227\366\203\030\202\201*\322B\373\306XxY\004\257|Q@\203\177=#8\351\246\356\025\330\374#\230\323\303PD\247\r\024c\356\303\372\330.\027\021$T\210\373\244\013\254[\220\267\205\317\244G7P\207-\016\250\002\374\256\230\222\205\231\203r\322\340\033\204\037\016@B\263\250\345\"4*\256\271$`+E:\305\f\227]Hv=r\252om \002\225\315+\235\331\304Zw\3058j][\214\177\013\227\243\003\252\367P\n\207q^]"
+	.string	"\270G\035\332\022\245x8\020\240\203\3606(\350\006@\374k\t\024 \234\025-P\245\001\316\243\036,LP\320y\2112\300F\372\214\331#\226@at\334\0201\362/C\n\367\341(\324\2038)\030k@\231w\301']\373\242@\215w\r\030\022jz\340\025\232\241w\321\026\f[\256'\343H<\n\017\021K\376\353Lz\274\251M\026\254\240\323"
+	.string	"c9?i\027\253P\006\340\2006\036\367~\r\350\363<\234\334\024A+I\245p\226u5\361*\343\223\224\231\351\356\022\356\3608k^\230\340\267\206?\016\374+\f\306A?\372\212\372\335\335uh\266a0a\244\277\030&q3\f\356\316\001\177T\315\3525h\0031\004\221\003)K\340\275'9\302\245\224.\017\274j7\021\226\004\367\265pmD)\004\324\372\370c\b\b\363w9=orqv\233\300\324\271\337\006\205\326"
+	.ascii	"z\373\250`\347\374\346X\240U\251\243\265\305\344\036\367\017"
+	.ascii	"a\340D\331\301\267`\333\374\fV\034\225V\003\2036h\272^\273\314"
+	.ascii	"\b\211\273KqRn\257;0\r\030\365\035\242W#\362lJ.\340@f\232\002"
+	.ascii	"\b*\007\250;S\233Q\365k\037\032\312\373k5.C\336\271\037/&\312"
+	.ascii	"P\233Tj\237\274\360\006s\r\032\360\303\322\273)\227\3369\020"
+	.ascii	"\036\311\302\276wa\310\253Q\247S\330\246\343s\362|)\2246\025"
+	.ascii	":)\323\251\256F\333*u\260P\360\325\227\240.\231\202\200\350="
+	.ascii	"\273\260\363\2772@)\272{\207z\001\326\f\304\324\224\263\023\016"
+	.ascii	"u\034\311m\242m`\316\3171\243`h\220\006\242-q\207GK\024\251\024"
+	.ascii	"\370>\327\232K\221 \221\326\210\374\022\234\177<\f*\302\004T"
+	.ascii	"\016~\177[U\302v\n\f\340\3127\t\n\354\216<|\325\275\273\017\361"
+	.ascii	"\314j\0059\237\237\032l\016I\325}\260\201\331ps)T\365\357cC)"
+	.ascii	"\tT\227\224\3059\313A\020R\315\235\242\35075=\357z\213]\241\002"
+	.ascii	"_\024$7\177ANF\002\307V\345Z\375\t(\363\245(\242\003_\276F~b"
+	.ascii	"\206\323\335Ok\233TN\256\017\260m\212\344~\210\266\004r3\246"
+	.ascii	"\230\360\302\337N\340\247:!\034q\345\275\245\020W\365v\t\235"
+	.ascii	"/\345-\033@v\332/\274\226r\032w\363\003\220\346\274\033\026\024"
+	.ascii	"9\320 \227\366\203Cp\213!\370\235\031$\364\340\254<\025\234\034"
+	.ascii	"\310&;\271\316S\331\nP\377\r\321,\236\304\254*\023\276|\306\025"
+	.ascii	"\026\"\201\220';\354#\307{4\376\342.\376A\200G\270"
+	.string	"\236\020\205\337\361\373^\225y"
+	.string	"\371\241\227x\005D\005\240-!S\260\br\304\355\315\rE\314#P\2237\364\237]\323\372\207.3^\206,:e\006\031*F\273\217\357\243d/\301\330M\206M\241\3645\340|\353<\005\374\240\022\220\022DKn#\333]\023\201\005\222c\342 \023\231LS\364\351\255u\251\370\346\313/#\016\301\370\025\321X\027R\335h\270\305\2472\270 W\336\325\351\361>\177\210z\027z\205\234\024 \263\331q\364\220\215\366\306k\374Pt\007\231\216\320t\333}\230\314*\020lU^|#70\277\333U3\205\355m\222\317\213\006-\244\215\3310\024<oT\003\213\362\250;\323"
+	.ascii	"l=tG\345\243\025\3640^\032\337G\216\027m\337;\264\365\245\377"
+	.ascii	"\355\333p\024,\003\326[@\371\314\206\345'\342[?\323Kr\264\205"
+	.ascii	"\033\0262\032Mu\227\361b"
+	.string	"\244\245\210\005F\205\227>L\313\220\255\3471\341\b4B?(\277\334\232u\30644\256\326.\211\276Y\317\036\215H@\202\301\302\225>NV\350x\030\321%G{S\023\005\237\004q\221\202\336\231z\3123$\340\206\370\216\310V8\310^\001\211\225*\306Uj\f\"J\203lA\274\037\371@\357\213s\b>%\327\034\224OmN,ZZ4\247\241\323@\304\232\032\336\356]S9\2431U\200;T\002X\216\030?H\3565\\\254\366%R\315\002\312\366t\207\003\300^\374\314\267\273m@u\215\303\024\270=\224\244\274\356P\031\026\375\r\252\316\321\204\036K\021L\007,\177\006\250%\350\244\220\276\216\004)M\303\365\254\002\303\202\2671\222/\"'C\240\205\314\332\253\271\303'\206\037F\255\366\327\025\206\020\023v3\032\376?\2373\264\344\240\230\253\204\271\266I\020\214\360R\355\033I&\036G\027\300\352\344\220\352&\204"
+	.string	"V\027\334w~\207\336%PJ90d\205L\004\200\266B\356q2K/\207\241&\241\205K?\271gF\2244\035\3110VK\267\3624\273\366|I\350N\024-\335\b\177Y\331\263\334&Z\242\224\200)\024\376c\357t3\250IY\304P\027\025\\P\302\254=\332\"\224\243\367\277JG\220\3608:kO\237\276\314\f@hii\232\222\350\031\210.@J\236/\273\275t;\340\361G\f'\350ej\372>\251\241\2048"
+	.string	"\\\247\336\263\245yX.\302\371\361bVf\204LBH\225\032\357.8\005\350\327\344/\026\312\303ax\235\360\003\253q]\335W\370\255\267>\241\377\036\265\fB\020\320T`\360\245\210\307\023'\206\310>%>\307\351k'\253\025\\\013\204z\326\003oi2\210\261kz\343%\306\0035 ,2IG\201\246[/\247\230@\270\273A\342\252Q!\0035\251\023\214x0\347\356\205\376i\247\325:\225x\216\374\021\362\255,\243\250%t\222y{\345v\245\363\330"
+	.string	"\006|Z\320\271\023<o\223i\222\365\215\211\235|\205\013\262G"
+	.string	"rP5\225q-\231V\bq\025\205\254\223\036c\005\f\336\261w\212\353\330\216\2268\334\2125C\024P@C\007\232\200\215H\303v\037q\3577\274\372\306\2626$\200a7\215e\314-\321H,w\225G\030QL}'\334\230\243\b\310\250\220b\275\003\317\2143\b\360\004\242Er85\237\3207\032M]2h\022\017\250\177\216\t^\242w%\3340\225\320\260\311\036\237\346\203\rh\365D\253:P/\327\232\266\305\350d\221\320\230$\024\334\020\243y2TC\266NAS\203=\256\233\331\023\321\262V\337\301\257Y\355T\223\242\367\266\034\307\274\227G"
+	.string	"\364j\322\242\266\355\0323\277%\361\270\017\371^H\333\320v\204"
+	.ascii	"w\362\325L\245p"
+	.string	"\3173\307o\342\220Bli\204\271p\214 \310\203\310J\214\215\261/^k\232\257+\177e\347\322\b\376\007\244\bxO\026#\374\357\321\2218 \213>\037\304\356qv\007\003\031\215\245\026\372\321\215#\344\2648\326\005\333V\231\317\" \225\223\\\335\341\303h\023\337`u\221~:dq}\246\247~\032\225\036Z\244\301n\337>\214\255\033f\276f\374\301\036\241\321*\257\275\342\262\200\016\335z\350\327J\376\256Y\212\224\223OLKbE\271U\201\034\376,,\302\364\002\255WL\333\341\335v\357\321\230o\227\367\275]R\265\255+\007\257\275S\316\024\220\260v\251##\262K\367\035\211\0076\314\306\3214\t\"\304\023b$QIh\203\365\267Z6=\314M\370\215\274\362\3025\031 \261\201\202\320C\227\261\364X*%\016K\340\320!\215,&d\206,A\027\316\356\342\312\300\002T\343\356M\234\323\0272\327\325\335\f"
+	.string	"\337\020(\335\241vBVM$\004\252\342Z\034\356\250+\205A\317\251(ys\277\355d~\241\273\354HAT\261(5\235\351\370A\331\020\351\233w\331\003'w\223\001\264\206\002FE\233\351\250\347\306Ks\2646?\307M\314\232a\211\225\310\204Ir\2068\007l|5d\022\300\360\005\t|j\211\326\360\b\334\213\343\007Z\244r\314\364\337/\202\311\313!<:\225\355q\3262\n\323\315\004B6\2455\352\364\220\3539aa\234_a:~4\200\316\035"
+	.string	"\277\365\230\333]\031\207)MYj\205\244\323.GSq\226\034x\200\021t\333\3175\331\201\240\306E\250\227\355\025K\204Z\245\244\360"
+	.string	"Fl\003\321"
+	.ascii	"h\264\214\352=\375\257OF\336\200\376Eg\215\367\343\373\256\007"
+	.ascii	"Te9I\266\002\231\004h\2508\032\321\254\306\242\317q,\0225Sh\361"
+	.ascii	"\324\311\355\214\242\324\035\313p\352\202\350v\242G\034\233\304"
+	.ascii	"&pj\257\230k\2126g\330&^\f\002\206\371\016\214\204\314\352%v"
+	.ascii	"\246@\315\356\234\336\217\210c\3560~\314\331R\021c\240\001\221"
+	.ascii	"\336\221)\243n\330\021j?s\372-]\031]\242[\331\337H\350\303\236"
+	.ascii	"J\360<\203\210\r\325V\020\343\367\373*\307\216O\372\275\210\f"
+	.ascii	"j\001\244\250\330M/\032\361P\374\300\366t\2130`q\216R\n\355!"
+	.ascii	"\347\323\304\2701\252y{\3507\314\357K\243\217\243\337',\340a"
+	.ascii	"\200\200li\241)"
+	.string	"\207\247-\300&\031\230\003dC\324\234\177=\334\257b\036\222x\255S\nD\354\232G9\262b\355g|Vm\200\246%bF9\217i\001hWn\333\357\314\206HE\211'6\316v\313uGE\370\303\327W&7%g\370\341\301\245~I\301H\224d\200\315\007\210\013\256\013(\322\031\334\327\211T\344#/\n\362\032\241n\277\034\016\0040\247\317\201\031\352\273WC\003\247\226p\021\335\024#\331\270w\263!R\3128\273\302\177\313\b\332\374\243\257V4:\371\030\224\2040\303\350\360*\251\300LM\362\020\347\310!=c\376`\260]Kc\364$s\033\256\371\2055\217v0G}\\\266\b\312^\377\244\275Q\355M\343ji\026\247\315Sq\313\262b\246\b\360;M1\201}\355\310[\256\340\350\301\347(9\021\216\023e\366\214)\346u\335\217\034|\370\346~\243\331\234\231C cE\336\250\227\312%\322\216j-\316"
+	.string	"\244\316\342gv\005;\300|\227\306N\247F\245\313o\262\256\363p\232RHp\227\373s\201\315H\344\241J\220\240\333b\223/\305\376\034\231\212\310\320\350\223XY\031\370\301\377oD\216mQu\372\b\350\254!}.2L\240\246y\314\354d\264\210\244\277\202"
+	.ascii	"\245\373\366/\362J\302\257\337m\n\316\276"
+	.string	"Z\353Ch\036\177\235(\200IH\342B2\017\360\226$\227#'(\217\242e\371\237i\221\233\023'\317\374\265\206eq\271\366:\274\2256\303\272\334\230\2702\361\234\032j\204\265\246"
+	.ascii	"\013MZ&+2\2760x\352\265\366\247jT\221wF\206k\262\035\300V\275"
+	.ascii	"z\205\315\245m\021\230\304KuR\013\264\372\231\212!~\030P\272"
+	.ascii	"\030\241\245\247B-\360s\3701\033\351<i\355+\n\263\007(C\326\267"
+	.ascii	"\220\332)0\004{\222+<\235\350\240-\353\344)\035\344\365\207-"
+	.ascii	"]Dy\031\360\334\3775\305\013\\\033\005\201\355{\017\214\360\234"
+	.ascii	"\345\356\367\326\321\310,D5\317:\250A\360~\300\342\324*n\021"
+	.ascii	"la\266\257\205\3738\001\303T\236(f\200\bz\301\353\200%\334\262"
+	.ascii	"\036\001\300\355\251\226\b\2313\231t\254s\004\353RP+\026\230"
+	.ascii	"@\007g\216\362+#\263\323\230:U[{4O\237Ub\f\3639\234W2D7\331\305"
+	.ascii	"\376\030\023\214\307\324:\004\271\365\022\300\330\310\377\f\307"
+	.ascii	"x\300S\031\214&\330\257\317\245\370p\354\216\362zE\211\276vD"
+	.ascii	"\242\350N\006\273\030Au\206w\366I\022\250c[a+\353C\271\304\036"
+	.ascii	"\221B\002!\r\240~\255(\245\225\027\236\035\036=\212G\177\rU\371"
+	.ascii	"\256\230\275\020\277\202\333\317\236\351\266\257\003\232Y\352"
+	.ascii	"\310#\254\303-]\355\262 9z\352h\226\377\334\312\266\306.!\357"
+	.ascii	"\205\205+\231\005s\252\264\234FQ1sG\272\364\027SC8\026~\2418"
+	.ascii	"7\201D\032q\333\274\304\005\033\262P\210\366\032q\204\003\253"
+	.ascii	"\340\303\353i\030\377\331\236\277\263'\361\315j\314\2468\256"
+	.ascii	"Z\371\260V\341\t\031o4\331\247\f*\204\035\302}\376(}\367hn\365"
+	.ascii	"\362\272_+\300y \037\335i\344\262J\302\315\256\f\271Z\242\003"
+	.ascii	"\375\253\271\361FI\321\306\267\350+\371\207\314.c\204\2118u\006"
+	.ascii	"\231\305\33552UzlOd\331YOPr\r5\203$\3632Y"
+	.string	"Z}\312\334\253\261\026\30135\222\004\030g\271\254{\307CP \216\034\255.\364@z\331\260L\231s\361}\226xa\341\336\342\320\367\346^\233\340\002\217\006\333\371\324\035\361|\264\037\033\217\242\372^\326y3\323\371y\b\205\251\263\376\367\221F=\277\2758\354\351\016\2210\023\003\246\257\320FR\032m\215\b\213%{P*\226e\222U+\r\026\257\270\016\325\344\030o\370\026\357H\006\2646\301\344\317\347\356#\377\301C\311\300#\313s\253\321s\n\250_\r:t\324\177$\033\337\204\016j\25640^\240g@q\313f\264dx\264i\360\343\023\037'\231\3208b;B8lhs\344mX\351\021\266=\355t\340\206\334\343\330J\343\016\251\274\252\316\354\230|\3377P!\341;\231p*\333\336\215\313\355\020\243\013\2166!\213\"\342\206L\233&\215\215\t\222\236\356\035\232x\376\020\341\016\270P\326+\301\364\345\031"
+	.ascii	"\261S\2235\263h\253\267\253G\342\262\224Q\273j\266\241z\234\216"
+	.ascii	"$\211\022\211\345\031\310\212\231\253O\307\263O -\201\002\262"
+	.ascii	"\201\360\276\304\233M`\211\202\033\252z\330\300*\234h\325\252"
+	.ascii	"'\246\332\033\350D\210]kFl`_\327\baM\235\240\035\214\331-2\336"
+	.ascii	"%\001&!\314\224\001\360\273\247\221}N\270^\263\321\214\213\300"
+	.ascii	"\216\035Z\016\222\264\353\036y\250\037\222\216\357\327\225\332"
+	.ascii	"\266\205\fx\347.*\314\022'\215\004\342sZ\276\363\325\364\201"
+	.ascii	"<\b\032\344\270\203;S\023x\023-@\242Bef\330\217\241h\210\352"
+	.ascii	"\242k\207Z\004Z_\265P\032\207x\001\371\"\277\331\\\006<H\321"
+	.ascii	"\335\216\264\324\365\332\306\342\315\262\007]\215\221\241\330"
+	.ascii	"e\230$\205\370\331q\315\354\365\367_\f\343\376M\302\226T\352"
+	.ascii	"z&\244\230\231\\\353a)a\250\026\0056/\001 \307\004\023\323>\331"
+	.ascii	"\237g\\\370\370\013U\372\305\004\020\210\261\034n\3456\275A\340"
+	.ascii	"\364u\212C\232 w\215\n\307v\212\353\230\025b\177\221\030\353"
+	.ascii	"\321e\020\346\260I\354\026\212\243\020X\272\375\244\317Jq\372"
+	.ascii	"\221\231\261\334\250K\360KJ@7\265"
+	.string	".l\332\371\324%\323YW\271P\030]\206u\274\220\376\277m\262H\346\332 \351\321\t6\276S\f4\373\"\212\306 \223\331\006\204\2361\231\320Gt\f\246t\n\254=3\264!\031\315\312\031\370-FL\323\351\215\301r\361\333053\206<\217\214%m\305P?\032\370\035?(\233\237'!0\027\006\n\305e\246\222\026*d*\301\036\316\3135\007\326\336\353\013\023\027;\276\032\221q\317\307\006\013R\374\315Ah\277%4\333\341\037\\\373\337\314\210\227\350\003\251\224\0327\3205\023)\354F\365\007\277\307\234\304\355\324\201\003\001\234\337jr!\3428\353\3344\350\376\356\2169\3379;w\370\002\376w\327\305\315\t\262\366\317{S\251m^\341\313,4\372(\271\367\363\255aR\256\030\360v\236\332\213A\373\fL\306\316\242^\32045\230g\263\372].\366\230M\220`.\252\201\225\360@@~f\354b(\363a"
+	.string	"c\272\335Pv'Z\3141\"\362\355g\334\364\2312\215\247"
+	.string	"\272\004\031\3201\260\0216^\362\343.y\3252\245\307mG\232\360\310\274\254\272\346\246\260D"
+	.string	"\355\031e\"}\270\320\t\\\324WA\323$\334\nv1A\342\003\246\261$GS\347\303hn\267,\373{\253D=D\374\3177=\364\217\005\177\310\372\305\005\261O\342\365\035\352\27613\214\233\325\310w\302\3314\306\235\222~F\267\026\337l\2677\364\275BA\264\020v\317r\223F_X\321\002\306\fE\260qGU:S\227\277\023\274\326f[\237j1W\374\353\022A\035\215\270\321T\\Cr\313[`(\371[i\277#f=\b\224e\322\236\362g\331\203\022mf\261\231\334\3775\270\023\361\002\035\207\222\270l\022p+\030\262\224\226x\026\254\r\374\022s\207\250\371\256\200\352\261u?\253\321 "
+	.string	""
+	.ascii	"\234\275\256/=\217S\366\243\242\365o\333/\320\310r>~\377|\266"
+	.ascii	"R\332\007\273d!\372\330[\263\213\244\276x\262\362)\323uNd\032"
+	.ascii	"H\310\337\213\315\332\007\300,\032O\b\027b\365G\332\bFy\265O"
+	.ascii	"\362\324mpS\306I\204K\207NcN7_8\353\340|\222\026\222\272\026"
+	.ascii	"D\230#\332\\I\303,\337\250\254\222\344\027}\rR\347\307\213[\255"
+	.ascii	"t\352.\323zy_\277\03743,\250\242\363#&\032Z\003"
+	.string	"|\241\277\224\\\023\213\244\243\251W\345e\2525\037\035`\016\350\324+k\256\320m\353\034\334\311\317\340D\274\361D\022\267\311\353\336r\300,\326\024|\374\240\\\326n$\240\246\034\263\324]\351^\235\006\346\244\312\213\r\026\016\233\222\310V\ff\020\376\203t\305\240\007\342U\003U\272\236Q-u\032S\306\343\036\226\025a\177\372\332U\330\316\"\312D\316\222M\331\302\024T\237\267\356\241\b\020\"\250\252\r\370\347\232\227e\001A\001\3465\370\020\302\323\003\201\316\227\377jL\363\267$\376E\303\345N\213q\326\352\325I\240\331\t7\034Y\003r\303w\201Ss(\371\2258=S\370\377\356\301\001v\004\n\304?\007v\201\364a\201\f\342\276\311\017\006|\352\001\317\020\352!\214\023\212\333\252\351\250\347\237\362j\035\332r\376\304\356V\340\275$\314h\203\227\322(%\212\335\221bx}8C\226\250%H\326\320]\f2p\211"
+	.ascii	"\300&\037g\235\3617Jl\326l"
+	.ascii	"\341\264\3346\013\337\223\250\235P\r8[\216\366\226e\226\312\311"
+	.ascii	"\253\301\302\001\371\027\240\030\272\004\177J\013\337a\332\242"
+	.ascii	"\271]\305\331\200/\036\005/\206\247\326\340l\304qCR5\r\001U\304"
+	.ascii	"Xd\214\324t\351Ha\016Kq\210`XD\222\022a\001\315@\f@\003[=s\345"
+	.ascii	"\251\274\256\275\036\305p#fo\334\254\334F6E\3074z\023\216\245"
+	.ascii	"\024'{\377\244\377i#\305\220\325TJ\333u\244Q\315\371\310\230"
+	.ascii	"\032\245Cw\306v+\316\244\212\2622g\254q\264\2161\341\200\314"
+	.ascii	"\"\223Kz$O\230\rNf\236\271|\037\364\351\210\316\262.I\006\232"
+	.ascii	"\225\365\013\004Q\362w)y\324\323\370\005\370\364\3114\351\221"
+	.ascii	"\332\211\363\3700\342\372aa\335\301\303|\273\016Y\263\314\335"
+	.ascii	"\241\206k\213\355\224R2\n\255\343\201\263\241\025,@\221\344\025"
+	.ascii	"\300\007DC\202\240\241\204\312\276\255\305W:\242-\030\243\370"
+	.ascii	"\037\230\001\361\334P\214-L\370\264\212\360\377-\373+\222R\325"
+	.ascii	"\275\037\347\350\216\352 , \212.\273S\325\367\375\266\026\342"
+	.ascii	"=\230\306\313\323}9%\202\3432\260\215[+\032d\243\250\350+z^#"
+	.ascii	"\273Ec\321\342eh\377)f\030\204\001\037<W]\025\212<}\314\327\036"
+	.ascii	"%o\232\r\366\337\214I\261\236\357X\037\202p\352h\205\300\213"
+	.ascii	"\373\277C\002\203\004\213A\330e\021X<9G\331\323\037\267\306\t"
+	.ascii	"\003v\020e\272\360\302\314\350\303;\203\024K\227\361w\177\211"
+	.ascii	"!\222\325\301\304\017\200\356#\204t\376\234~\211Xv\267!vF]\355"
+	.ascii	"\362\362\362\371\311\274\2303\313NS:\004\201\257p\240\002Q\216"
+	.ascii	"\326qk\231\264\311\321\341\321\346}\247\333\270\300\370u#\326"
+	.ascii	"\020:\336\246\225\3736\313\035\216\017\315\362\007\313\370\222"
+	.ascii	":\305:\356D\244t\314\225K\244\345\304Pn\021\277\260\265\336("
+	.ascii	"\227BW}\016\364\227{JN\36187\277L@\n\246\301<\031tw\306\3218"
+	.ascii	"V\267\2644\263\3111\211~\232\341'\3255.E0+S\353\257N.x\265\202"
+	.ascii	"\f\177D>{2>>v\266\236N\033\004\026&\3273H]\345;@\247R\220\213"
+	.ascii	"i\300x\345S\004\332\004\246\371,\342\205\030n\212\230\037\255"
+	.ascii	"\317.\327\223\364\005\026\220J\034_T\373\370c\370x/\334\325y"
+	.ascii	"\017\264\332\204\262"
+	.string	"L\220\004B\013'\033 \373\254B?v+V>Pm\264\311\013Yd\036\352\263\253\326&\213\250\240\217c\313-\302f\317\326\277\024\021Z\205\337iN\327\200\351\304\334\037\302\315-\213\362R\300~\340+)\216W\304\247\356\027C#G\346\337\304\251\215C\314(\005\237`\343\363\327$w\036\331\0224\324\200\314\366\204m\360E\361l\365{0\203^[\344)R\373S\347\364$h\240\253\365:\307\026zl\331\247]lJ\031\276\210x\360\341n(\267)\367\363\211\353\314\235?\230\016\006\213\365\361R\326\273Li\322\024\240F2\340\b\372\2219\355\023BM\263\022I\272\234\t\310Gu\223\017\217\215<l#)\364C\323\370\3637\343\0253\026J\260\230q\251\324Q\353\3712\023\337\205*\201\032\254\340\343\027o\337\375\316\344\212\314\203\364$=F\231\025\320K\003\375l?\264G\360R\212\365\231L\323n\220\255\201P8"
+	.string	"\212\271\017\220\253^\026\013\344\362\210\331\n\256YuN\030\0037w\261\243\252)\256?M\252\261\205yf\b,\340A@\033\252\206\333\337\202\356\2052{@\02276\244g\255\226\307\221\0242e\367\242\3051\261!\363=J\016g\227~5\330*\241M\3165$B\314\250*\233\343\273x\242\301\265\376n\260W\340\263\376.}\251\301\351\311k\205\001s\r\0017\3704\336\317\2435\230\307N\263\356\033\224X\220\0048\275\270\230\006\013\333\037\\\006\003\300\340\026\267\357\322\255S"
+	.string	"g\036\007\261yD\220\f\206\013\t,\256\301\316p\357p\366J\n;\r^_D\275Ur\251\323]k\036\030Z\007\026\344M\2063{\322\361&0Q\031\356\335Rd\200\251\006\317U\364g\206t\311\370\200q\373\256\310X\001`\340&\300t\324"
+	.string	",\305\244/\265\224\220\004\007-X7\377\035\227\261\034\244\212\342\355\253\262\"0\034\212\307WP\300\325:\232\250V$\235\306\"o\234\214\277\343\312\245b\301\313\340\r\235\360\210M\320\317\360\320\035\244\257\300\2601\344\327\210\354\300\312\370m\375\333\360\026$\007\214\236"
+	.string	".\362i\371\236\270\355\036\321\316h\307\206\341e\214\216$\336}&\216Y\006\231jq\276F)\037[\304i\306x\026\ty\276\344k\243\302~\016\377\f\354\275\236c\222\272\361\261\r=)a\345Ix\254\026\322\346\240W.Y\350\006w\306L\341~a\335\322\353Yk3\254\335\373\264\2358\340\004\006\337\237\203\013\303\242\252\230\326\177@\203\257H\313\b[\253\272>*\354\205\024V[uB\230n\t\323\313\205\264\367\n\336+\252\227\314\207G@yI\362\307M\fauJ{B\003@qa\335\207n\360\344U\324\177:xi\220\210\207\034sS\330V\223\016\001\3336c3\271Ju\360\235\f\336\2636\376Z\215\002.\231\351f\224I<\305B\375\0337\235\267\315G)\370\217P\336x\205\272\254\376\335z\b\206\224*"
+	.string	"\262\271^$\334Y\032%\005x\363\333\257\241#\230\353i\300\243\263\216\350\333\r\232\335\3126\330\341Uc\342\301}\304\371 \254\205\205\314\332\364|Ms\34601\247\273Y\354?"
+	.ascii	"\244\377\002h\326<\332\3478l\201\022\272\261\255\240`\362\324"
+	.ascii	"\263~\241\222k\233O\236%\244\264\207\363\337\265,:^\005\341\346"
+	.ascii	"\347\244\213\303\365\372\247d\356CB%t\215\210\267\322\254:\255"
+	.ascii	"2\331"
+	.string	":#d\373\277\261_\231x\001\263r\210\322\221~b\252t`y\310\t~\240\260'p\fG\375\322 \365a'\001\253Xt\354Y\220\275\210(\034\365p\330E\033\3433\024&\212\236#o\334\356X\221\272\t\016\311oQm\330I\324\361)\366I\024Y\006\362X\332!\240\023R\324\253\270\336J.\3631*,\250\300!\021A<1\234n\255\337@\tz\246T<T\315\300c\020h\221\f}\r\375\352\246\206\024\221h\320-\277\222~\n\226\3018\375c\277\233e\002\375nl\240\227\313\262\360\2710[\025\253)\234\017m\376\214\247S\330\302dF\031\236\370\350\257\315He!V\321\212'\004\257\234\267\302\0345T(\240\203\303\252_\305\203\222\223\3335JDf\353\347\242\334\232\311\003\322j\210\240\211\374\2512 \334\033\326tQ\314\243\020\007\236\367\004\247\345^u\347\207\326\350\202I\377j\311\0266\246J\372<7"
+	.string	"e\230"
+	.ascii	"!\013\270\264R\251\260\220&&\340k\2619\364Z\375g\344\321\251"
+	.ascii	"\262\322\267\2224_\300\242\262m\350\227&\335m\332\022L\0265M"
+	.ascii	"\026\2452_~\372\275\246\221\021\354\320\372f\321\203\276\220"
+	.ascii	"\321\371\007\216\275a\032\336\243\263\320\234\201\254\351w\032"
+	.ascii	"\234\b\212\225'h\025\025\355\013dk\307*\370\211\214\361\037\307"
+	.ascii	"^\257\366\261_\372\030\013}\203\243\225m\021\347\202)\336\364"
+	.ascii	"<.\235\327L\276\244\346M\321\377\n#x\306Hr\257\242+\365\005\337"
+	.ascii	")\032\214(`?\2363\221\257\240\226\266\312\236RhY\033L\206\035"
+	.ascii	"\272\305\354\315\fd\237\340\217G\272\235l15\247\302y\275@f\027"
+	.ascii	"\242\212\016Z\212ia\034\311<T\207A\346\020U.5M\016bf"
+	.string	"\207&\\\"\376\235\340\230\226\360\022/\373\306\001_>6\3104\320v\312\261\211^\036\253\344\372\327;\224|\027\177\313y\253\303J|\002a\\(:\316\001\306\252\340\315\245\005\007\333\245\305u\371\233=d\1776\323[\314\2510X\3024\356[\025\213\250\025g\007\315\002\334\341%\016\203m\321)\003)\337o\347~\337F\324k\364\370?\226\345|#"
+	.string	"<\031x\374V\246)\336\211\277\227\020\322\243\244\360\234\013x\320\002\225[\345\232d\216\350\032\002lUv\346\367'\352Wnq\277\251\254\223\f\277;L\377&=-\2040\361L\225\302\214\366\030\267\177\302\277\372\244\317\205\021\230\355\372\264P&\205\004\377\001\013\330\325\317\3454>\231\363\371\006l\244\254 D\233\027\234\351\1773j\251\231\204Wkn\311\204\207\315\230\013\330.7\327\374+\275!\340J\2761|F\252>\2260\236'I\002\343\035:H\261\201';\241\206K\320R\006*\204\rts\252!<.\301@\377FeZ\275\036vK!\347\021\375\251K[\373M\221\021\004\234i\230?\013\224@\300r\365\270#V1_\306\237\332\212\244\325M,s\244\022h}\331\263>\243\2503\b\317"
+	.string	"U\276\256\314\300|U\342\2509{\357k\323\025>H|\210\235\335\276\270\351\005\205\231\201\332\261\317\037:\263\234\377,\320\336\251-\360\2470\033\037"
+	.string	"\271\230\262\254\374p\264"
+	.ascii	"\021\314\372\347'\307\241\344C\224*\346\234\270o,N^9\217\330"
+	.ascii	"\f|\312\365'[tT0\346\203\242\225V>\243\3549\303\314\244\346d"
+	.ascii	"\205B\3450\221*\373b\003E\344\311\351\335\243w\340\334\013\343"
+	.ascii	"\301\017\355\025\344`\270\207\2708i\3213rM=\371\375\217N\301"
+	.ascii	"\\\034o\"\245\324\303H\215\035\311\317P\320\242\205J\375x\001"
+	.ascii	"\274\325?\232\237)\240\251?\332D4Wd\016\323)\351\t\315\3157\230"
+	.ascii	"fi-\314\203\303\272k\320,Te\177\271\034\231\350\032CeN$b!\302"
+	.ascii	"\267\214\031\255\256G\375)\353I/\004\262\311\232\314}\200\234"
+	.ascii	"\262\344ag\377@\365d\310\247:\237\263\355\371\372\237"
+	.string	"\347\363\240K'A\032\213\nn&\330\314\004r\033)\022\3206\177\032\260\312\307\330vg\372\002@\241c%\254\020\346\322\217\013\363x\377\356z\027\25624\266\022k\336,\203\241\257\275\370s\0333\\D\312\007vE\344\221\325\036\033h\336\036u\362\350\275B\216\242\247\211\206\371\205\311h\347\001,\374C\204Cza\r\337\360w\341|\200ID\357\227\275\177\241~^\002\277\371%t\332\343\334\336Du\2069\207z`sLh\314\017\324\265\245\213\242\332n2\232\215\367\3159\223\305C{;5\031\243\233\203sr\006\264\306P\024\240\b\013\226n\303\366\013\246\021w$\330\035\301eq\033\031\035\224\343ZX\"\301\272JX>e\205\214\274\007\031\355l\262+&8\231\374UQ\323\270\002G\277\324o\322\231\227\020\035:\215d\205&9\300\347\243\243]\2409\375\347\331/\245i\343\201\313\277\373\344\204yD\023\346\213Y"
+	.string	"}\346\267\322\020"
+	.string	"\351\3236\306\354\365Y[\325\f\1778\227\310\2401\352`\002\275Qb\004\255\033\021\205G\177;p@;u,#\215\003\022\362\b\212\016\234:\3629\244\026\352s\364B{b\323\247\364\375\301\227\221\002\225\217\005\206\351N\365k\021\306\251?r\026\323s0\240\235:\235\361\330\371q$Q\346#\300\273\334\262\366wM\337\001<\252\177\0219F\bVG Y\204\202(&C\353\360\256\362\2202\233g\202IP\002`qo\003\252 1\006r\215\260c\333\232\002\231\327\301\332R\317\337o}@t@\346%!X\336ff"
+	.ascii	"h/\306\003\267J\b&\316pe\377\3504\340\"\211\017\002\267\341N"
+	.ascii	"\356C\301\316[\200\253\031-\3022\312*\211\307\330p(\261\273\227"
+	.ascii	"[4\370W\3479&\241\232\365\226\271;\317)\037\352L?;\356\354^Y"
+	.ascii	"\035\312C\207G\330F\256\312\210%\275u \203\260\024\016\215\261"
+	.ascii	"Cy\n\226#\250c\311\342^\322Y\030\375I-t\330\266JC{\214\251\033"
+	.ascii	"\221\302\267\330r\227\003<FxIP\300\316\307 \2501\272`}v\336\005"
+	.ascii	"z2\302\342\355@\304\327\324\224t\224\364e\365k\227i\3471k=g\347"
+	.ascii	"\355\357\254`Y\207\215\003cPI\323&\320\204)\230\316\300G\207"
+	.ascii	"j]\272\230\331N\325\366\037H\236\007\255HE\336\264\262?\r\027"
+	.ascii	"F\255\030\216\223*\274\341\242\b!\241|`\351\335\265\205\275\304"
+	.ascii	"fY/\265\225\355*\216+\320D\213\363e\270\260\363Y\352\315\323"
+	.ascii	",x*i.\033\345\366\201\372Y\232\355\306\205\023\025\351\177W\215"
+	.ascii	"\016\004q\302\341`l\2760\250\3721+\310\314,o1\2217\272q\235\035"
+	.ascii	"!\315s\211UQ\023\220\377\034\\\241\322%\301\356\351C\351\212"
+	.ascii	"&*\216j?4\325"
+	.string	"\210\177\216R@\204\317<U\b\034=`{,\n0\273_\256L\360\221`w\220\261\016\221\2155#\364\343\350\376+\355\351\220\212-\016S\350\261\233\351h\351l\333,c5\006\353\246\202@l\030\302i\003\310(\321\364\007\215\257\255\371\020\207G\0131\325\031K\332\347\023$\342\025\353'\335\364O'C\177\217\362\320\330\242L\321HC\330k\033\316\374\276\275\242\336\243\214\267\0356I\006H\310\260\236\206K\266\356\n\273\2667:\232\322\343Jky\221K\323\255W\030\332\337\332\205-\bl\351@6\341\313\361\001\373\204\017K\211\372<Z\344\316\321\024rR\300d\207\375\224>@L\001(Y\005_\3629/\224\367g8\370F/ha),@~\264\355F=\323_\036P\346\030\366+\253\226:Cg\272\250;i\200\030\355\360!Ea\253Hn\343\3734\206\016L\227\365\206\326\24475\273`q\235\002\034-Pc"
+	.string	"\306\240`\344\031\313f\374|\255\362f^\357E\364C\211\365T\004\001\315\252\361\245Q'\3030\261@\223*\001I\372\2544\371\226'o<\356\210\363\243\004o\336\003l\205\\\3768\023\313.\306\330\032x\316\362M\321\337\340`\255*\306\261\0312\037\254r\323\216\233\322_\327*\274\020\rR\262\270A>\211J\242\231\341@\345]\236C\275\246\226{\004\260j\013\211\205\316)mC_1\006!\022\320\316ugL\t\003c\322\344\236D\007\301\006-H\264\264\223&R\316\364\002}\300\343D\224Fe"
+	.string	"\361\0240\237J\311/\370\241%\270,x\304\001Q\246\310\241\331\301\216+\361\220z\345\344\355\277\206\273I\377\"\326\230Z\022\334\026,\031'J\232\206|\\\301\273\320g\252\333;\2736&c\r\207*\006\307\355\336\223\267,bd\273b\344I\256\263\302~\331U'*\232\330\357#Z\t~\360\205\3602\372\3420\264r;\313\201\006\347\236X0\2509G\226\020Gc;\370\273h\033h\360\315\222\230l\262\022X\b <\3220\277\272\031T5C\256\374R+=\212\310~z\204\005\005\236G\255\277$\262Ch\2207\207\231\333|\033\363\357\223>\252\335~\271\241\032\001[\217p\330\023\305\316C\013\245\340\241\362s\245$0\212\270G\262\262k\233\236'0D\210\277="
+	.ascii	"\020\030hz\303\274\326Y\247VR\376\373\241\274\233&`w.\353\025"
+	.ascii	"\220Vs\245\256aM\367\b\232\370b02JD\326\351\225\372\035\023\224"
+	.ascii	"\204:\356\222\030\301\277\tt\356L\037O\327\345\237"
+	.string	"B.\316#L\256s +\031b\205\037T\236\021o\024a\364\301\b\231>\367\327y\021\372\353DH\372\334V\234P\n\316{\327\224E\341\343\225K\2020^f\334@\203\275S\221\222u\336Z\033\316kSz0\222\250u\305L\365\362~tWbG~\310U\326\373\242\005\254#\214!r\261\241R\b'\271\033\325-c\360\253\317\001\037\365R\026\315\030J\351\240\006\031\205+\244/\020r\313\037C\236(LHKP\212\263\225Ra%\236%\201\210\351\3027rfM\211\245\210|"
+	.string	"\244\305\234\3049\013\030Jd\301z&\257\267\321\020/\205\311\3665\227\357z\314\007Ek,0\036\274\342\214CK\322R\013\241*\363pW\256R\016\324\324\320\004\223r\017U\274\001\311\256\210\216l'\301\fe3\254l\370\257\227\254'_6\335\375\307p%\375\334\b\033WS\231\372,\314t\244\263lj4\371%\017b>\322\210\26521\363X\300\274g\250\003\273\021\312(i\"V\202\223\016dF\371\230\273Z\026\343fc\365\336p\320\314\204\374n\272b\220\304#-D\214\006,\024\004\361"
+	.string	"4\374\245SY\253\332\200b\023Iif\003#T\340\032u\366\327\214h\212\365c\035\327.]\036k\253\224 \036\306\216\013\367o\343\344]\346\202\2357\264\"\273\356\321\027\342^\177\"\236|3m/\016\231a\031\026&\331S\354P\372\347\031\357\3067\361\366\266nIP\370\033lK\213\373\203;\347\204\233\220\315$$E\347\376\007\316\245O\bD0\3131]\306g\207)\032\200\345\332\002\030\335\355q\216\250\232\003l\3216\360*\314\250eC\215\377\2243\343t\217\234\373.-3b\316~\337\316\321o\250\361/\2073\234{\3724\373\302\326'\351\306$c\277\027(\346l\347__\245` x\177\347-\t\007\271``\203\033#=\274\375`\231\367\023\305\214Uz\177r\306\263>\377\252\265\\\330\360h\326~\207:K}\f\201\2233\253\300x\230\374\336\347D\026\275e\270sy\335Z`u\250\004\017\211\210"
+	.string	"\270\r\346\216\335\242=\375\340}\365g#\230\312\037n7\226\0360}\253!\300,\315&\b\331x\247f\177\035\213\365"
+	.ascii	"\006\307L\307\261_\326)a\356\236\254\331k\351\325$P\317\222s"
+	.ascii	"6n\255\032\nt\265\3131\205\373\200\375\n\276\366 $\307\370\363"
+	.ascii	"\n\377\n a\215\025\020u\214v-\231\301z\232\013(y5\363X\343\237"
+	.ascii	"\277\266\313X\253\376\026\312\362\370\023\327\024\345R\237/\025"
+	.ascii	"?1\301p\232\356\202\230\337\227\254\241t\217\362\222&\246\t\304"
+	.ascii	"\016+<\344Y \"\312\330\246\347o\025\177uh\203\272\342\225\235"
+	.ascii	"7>="
+	.string	"\016\035|&\212\350\332\335\334\334\247I\347-\277$Ity\201\200tH2\210\314X\331\345\370\303z\211T\2630\302T\020\203\360L#,L\310I\001\242\025\374D\200\231\205V\343\304\2752\317\372\314\025\t\307\312~\337\273u\007\265z\220a\2512\373\257\234\226\r\360t=\250\234\004\367\322V\330Si\333\314pnn\"R\001\377e\360\361\257l\357\261\031[ \304\"\026\013\023\320\322$\\g\356\360n\201\202\003\347+\030\377\034\264\205\2447\361\321P?\243\2024q1\250\032\266\307\035d\347\005Bo\034>\257\027\222JB\005\361\330\0232\222\030/\365\006\2750jC\016\002gt\216\354L\343\272\333@\3624>h\300\001\307\031\220}H\255\002B\025:$\021C\340\274r\230\340\003[\bVl\212\305o!\003\365\303\363\307\356w\370\377\254\3660LL\357\301A\017\002\036\334\324\013\216n\266\036\200=\205\353\241\221"
+	.string	"(\024\030<\364}_~\364\225\361"
+	.ascii	";m\226\\\200Y\355\2150\252\277\233p\307 \2538\303X`\221\272Q"
+	.ascii	"b\243\235:t\177\317C\n\356\317`HB\233\344\304\267\211\356G\020"
+	.ascii	"\214\257\207Zg\336\317;\305\340\210D$\271\341\210\rk\372\332"
+	.ascii	"\036{\357\201\313fb&\362HU\247F\223\036\260\362C\361\270O\304"
+	.ascii	"C\341U\375\346\361(\345\370\\iK\373g\fCTn8\354ags\234\2102\374"
+	.ascii	"\223\332\242\007\001\036\353\255\003\360e\276\317\034p\234\254"
+	.ascii	"\306\312\"O$\020\002\270\311\300=\001\210\251\250\356\307o=\236"
+	.ascii	"\027\245\020\034p\035\247\371\231\017\306\\\230E5\031]\254c\364"
+	.ascii	"/0"
+	.string	"W\237\027\177\372\376\022w 8Zfu\213Y\2637\333)\354\310 \370\315\310\327\2310\305\236\372\016\221q\361g\322\344\274\250\3114PH:\024\257:\274\2219\351\251\275,w~\301\301(/&\263\007N\376\360\t\322\033\215\024E\374\033Ww\242\017\177\t:`\020_\"\334\322\246\236p^\227\030wo`\3438\276\221 \377\360j!-U\263\035\327\025c\017\356G\300\331\332JM\366\t\213\3625\323J\374\263k\302\r\305'\325\020\365YF \021\257/\237%\330l\311\316\3512!\313\262\357\321+\237\230\363\375\306\243\251Cq\243v\250;\352Q\242jU\371Y\264'\211\231L\027\256\001\206\273\320\032\327\233\301!L\205\372\330\335{e\016i\032\024\210]\362\347\303/\227\034\002\330\356\301ox\2445\"\206\240\372BWx\f\252\3158\013\032\367-;pJ=\204(\213\353H\030\202L\021y\022y\236\205\260\214"
+	.ascii	"L\3216\214\347^\353A\363\b\r\017\316\270\350\354E=I\260/\365"
+	.ascii	"\222\334\233\232S=\020\263\240\001\251M\354ud\305\322\007\"\335"
+	.ascii	"\241\377\211<\0172K\321;{\357R\376\210)-\004"
+	.string	"3xQ6\2319u*\301\261`\323\355\2134\3128;2RX\033\020\205]\341t\016P\3067\212\034U\362\304e\034aUp\362)\267\\\032\202M\022\325,\342\t\303K\rIS\246\034\217\356\006\206\363\006\243\261& \335\256\345\224\315\340\016\211\337(\222^\035\305h\222\030jR\nI:\350x\021\335K\222\343v\241PJ\025\035\370\225K\361;\334\333\366\263\234\365<I\021\023\351<\031\363'\225)\246\027O:\266\022\324\316\262\231\007\031c\224\3655D\321\342\346\025Ab\006|\221\003E\345\023\200\322|$\306\371JCt0\365\351 XP\353am\003\367\200\253\353a\0019M\003'\236\354\236\nq\225Yr\220V\023\353i\177\033\375\tf\367\224\034\261\f\226o\230\346\263\252\244\263\272\252M\0074\\k*z\027\031\230\204\265z\337\331\306\300\377\246@\330A\365\207\260\231\034\305-\362P\376\313$r\307S"
+	.ascii	"\305\356]\232\346\034\003\205Q\223\004\222-p\n\223\315\330\333"
+	.ascii	"\360\333\031\360\255\342\026\376\2322/\366\2062\241\357\355\332"
+	.ascii	"\357h\307\327/\305^\354\202\372\342F\001*\242\243\363\314\234"
+	.ascii	"\020~\0173$\r4\013\236[\305\n\243\250c\221\204f\275K\303\217"
+	.ascii	"\352\346h\254\317_\352\035-\302\004\331u\221\337F\232\336\016"
+	.ascii	"\320\360\230\302\020\256\277\017\245S@\366\2225\027\217\362w"
+	.ascii	"\230V\003\320V\372<e\345\375~\035\177\231\373o\240\305\243$\375"
+	.ascii	".]t\271K\376\377:El\243\2509\273@\363\\\200\367\n\343e\025\254"
+	.ascii	"\357\025D\367Rh\243\340\340\304l\343O\340\272G`\332\204\251?"
+	.ascii	"\003+_D%-[\246\360\357\b\\q\260\320\263\2074S\345\351\250\366"
+	.ascii	"\031\r\252g\n\224\340Mmx'e\326e\266\214\371\311\200H?\307\020"
+	.ascii	"\017?\236\206\347\243\273\201\373\337\030\364\353d<\273\316?"
+	.ascii	"\036\335\361\036;\320|\244-\017\307"
+	.ascii	"a;\266\323Q\242\355h\240\205\013D|\221\r\017F\322hK\334\217\373"
+	.ascii	"\222\330\373\257\254\375\006\267S\002\036p\2621}wLv\031\350\201"
+	.ascii	"\233\322\357\261\237\322\377\037\201\313\344\373\311\250ga2\317"
+	.ascii	"\367p\202\371@y$\033[9\035K\243/\325~\261\371\023`\016\361\347"
+	.ascii	"\325\245\373\331n^;\273\364\007@\367\031y\301\374f\346\023\257"
+	.ascii	"\276\027\247<\373\312\215\277\246\373\276\244\\\274\372\351\373"
+	.ascii	"BO|\372N\335\335\221\336\216U\226ia\177\t\236\243g\342Q\317\266"
+	.ascii	"k\316\002:\332\271\220\263\367S\260\020\030\270\214u=\006\306"
+	.ascii	"\335F\375o\374zY\337\363^\177\036Eya.\366\244\320.\246u\027\230"
+	.ascii	"\351\342\315}\342\336\271\302'b>p\222\305\235\321T[q\"\320\311"
+	.ascii	"5\240\276\230\354\021\350u\003\254\363\204\324\374\026{^(\256"
+	.ascii	"\213\353\f`\277m1\250\346\231l\200\217\257\021u\307\250~\311"
+	.ascii	"\226\003\341\216E\377\272CC\237\275k\275)|\243+\2709l\265\320"
+	.ascii	"\261a\236\227\337\354Q\256\002\3511\255\013\037\253\337]\367"
+	.ascii	"\340\200\006\375\021+X\356\272/B\342\376<\376\340\354\360\336"
+	.ascii	"\357\264Ctz\020fg\207_'\261\272\256\n<\335V\016C\243\273\251"
+	.ascii	"\340\364\372@\357f\307>\311\t|Du_R\201f\243\355\236N\265\307"
+	.ascii	"\316Y\"\272\307\325\375\bs\325\214>\032\301k\315<\3172n\007\343"
+	.ascii	"\016{\362\005\204\365\315@\032\3025\026\313\376\213\024hum\356"
+	.ascii	"9\273\367\006R\033\332pl\031\346S7\246\336y/\344\351&xi\032\267"
+	.ascii	"v\366\212k\246\374\330g7\346|\343\300\315\266\324\337;\275\354"
+	.ascii	"\002\273\215!\271\352\222\361\252'\023\252\303Q\rmT\"\347\255"
+	.ascii	"\0350\211\261\027\365[\230I\243\004\017\240\241s\223>\276\255"
+	.ascii	"\364\353\017\2079Lvv\366_\236\336xK\337]\r\234\323\177\267\367"
+	.ascii	"\266#\017\235L\207\355\372\306\312\261\236\177\275\233k\363T"
+	.ascii	"\016\272\352\301Q\313s\25173\322\374\357\3403\377\375\263w\036"
+	.ascii	"O\341\326\377\247.\361\030g\267,\305\034\345\262\213\344\361"
+	.ascii	"\220\355\036x<F\0165`\215Cg\f\333\320\025\227b.\t\317\306;\036"
+	.ascii	"\366\314\346\235\017\234\020\017B?lkE\326\267\332\373/\217\302"
+	.ascii	"\324\254Np\343l\310S\216\026\270\277\342*\340h\222\222}U\335"
+	.ascii	"\203\306\021ncF\312\344\2713\022|\277Py\366\226]\274\313\214"
+	.ascii	"z'\006\270\356\370$\311\267$\317\272O\255XW\246\0377\332\317"
+	.ascii	"\"\303:\016\335\314&=\n\3161l\271\177"
+	.text
+	.section	.gnu.lto_.symtab.e437537c03190dc0,"e",@progbits
+	.string	"mspDescriptorAlloc"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\b"
+	.string	""
+	.string	"mspFcProcessCommand"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\t"
+	.string	""
+	.string	"mspFcProcessReply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\t"
+	.string	""
+	.string	"mspInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \t"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\007"
+	.string	""
+	.string	"targetName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\b"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\b"
+	.string	""
+	.string	"motorConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\007"
+	.string	""
+	.string	"buildDate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\b"
+	.string	""
+	.string	"buildTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\b"
+	.string	""
+	.string	"shortGitRevision"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\b"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\b"
+	.string	""
+	.string	"featureConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\b"
+	.string	""
+	.string	"batteryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\b"
+	.string	""
+	.string	"supportedVoltageMeterCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\b"
+	.string	""
+	.string	"voltageMeterIds"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\b"
+	.string	""
+	.string	"supportedCurrentMeterCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\b"
+	.string	""
+	.string	"currentMeterIds"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\b"
+	.string	""
+	.string	"voltageMeterADCtoIDMap"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\b"
+	.string	""
+	.string	"voltageSensorADCConfig_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\b"
+	.string	""
+	.string	"currentSensorADCConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\b"
+	.string	""
+	.string	"currentSensorVirtualConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\b"
+	.string	""
+	.string	"acc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\b"
+	.string	""
+	.string	"mag"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\b"
+	.string	""
+	.string	"pilotConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\007"
+	.string	""
+	.string	"servo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\007"
+	.string	""
+	.string	"servoParams_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\b"
+	.string	""
+	.string	"customServoMixers_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\b"
+	.string	""
+	.string	"motor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\b"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\b"
+	.string	""
+	.string	"rxRuntimeState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\b"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\b"
+	.string	""
+	.string	"boardAlignment_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\b"
+	.string	""
+	.string	"armingConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\b"
+	.string	""
+	.string	"imuConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\b"
+	.string	""
+	.string	"currentControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\b"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\b"
+	.string	""
+	.string	"pidNames"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\b"
+	.string	""
+	.string	"modeActivationConditions_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\b"
+	.string	""
+	.string	"adjustmentRanges_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\b"
+	.string	""
+	.string	"compassConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\b"
+	.string	""
+	.string	"gpsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\b"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\b"
+	.string	""
+	.string	"gpsSol"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\b"
+	.string	""
+	.string	"GPS_distanceToHome"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\b"
+	.string	""
+	.string	"GPS_directionToHome"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\b"
+	.string	""
+	.string	"GPS_update"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\b"
+	.string	""
+	.string	"GPS_numCh"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\b"
+	.string	""
+	.string	"GPS_svinfo_chn"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\b"
+	.string	""
+	.string	"GPS_svinfo_svid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\b"
+	.string	""
+	.string	"GPS_svinfo_quality"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\b"
+	.string	""
+	.string	"GPS_svinfo_cno"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\b"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\b"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\b"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\007"
+	.string	""
+	.string	"failsafeConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\b"
+	.string	""
+	.string	"rxFailsafeChannelConfigs_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\b"
+	.string	""
+	.string	"serialConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\b"
+	.string	""
+	.string	"blackboxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\b"
+	.string	""
+	.string	"flight3DConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\b"
+	.string	""
+	.string	"rcControlsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\b"
+	.string	""
+	.string	"gyroConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\b"
+	.string	""
+	.string	"gyroDeviceConfig_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\b"
+	.string	""
+	.string	"pidConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\b"
+	.string	""
+	.string	"barometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\b"
+	.string	""
+	.string	"rssiSource"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\b"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\b"
+	.string	""
+	.string	"magHold"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\b"
+	.string	""
+	.string	"motor_disarmed"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\b"
+	.string	""
+	.string	"serializeBoxNameFn"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\007"
+	.string	""
+	.string	"serializeBoxPermanentIdFn"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\007"
+	.string	""
+	.string	"sbufWriteU32"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\t"
+	.string	""
+	.string	"sbufWriteU8"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\t"
+	.string	""
+	.string	"sbufWriteU16"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\t"
+	.string	""
+	.string	"currentMeterRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\t"
+	.string	""
+	.string	"voltageMeterRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\t"
+	.string	""
+	.string	"getBatteryVoltage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\t"
+	.string	""
+	.string	"getBatteryState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\t"
+	.string	""
+	.string	"getAmperage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\t"
+	.string	""
+	.string	"getMAhDrawn"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\t"
+	.string	""
+	.string	"getLegacyBatteryVoltage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\t"
+	.string	""
+	.string	"getBatteryCellCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\t"
+	.string	""
+	.string	"getRssi"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\t"
+	.string	""
+	.string	"sbufWriteData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\t"
+	.string	""
+	.string	"checkMotorProtocolEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\t"
+	.string	""
+	.string	"accHasBeenCalibrated"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\t"
+	.string	""
+	.string	"getMcuTypeId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\t"
+	.string	""
+	.string	"getSignature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\t"
+	.string	""
+	.string	"sbufWriteString"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\t"
+	.string	""
+	.string	"getManufacturerId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\t"
+	.string	""
+	.string	"getBoardName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\t"
+	.string	""
+	.string	"getRxBindSupported"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\t"
+	.string	""
+	.string	"rtcGetDateTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\t"
+	.string	""
+	.string	"getGyroDetectionFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\t"
+	.string	""
+	.string	"blackboxGetRateDenom"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\t"
+	.string	""
+	.string	"serialIsPortAvailable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\t"
+	.string	""
+	.string	"getMotorCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\t"
+	.string	""
+	.string	"findBoxByBoxId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\t"
+	.string	""
+	.string	"getEstimatedVario"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\t"
+	.string	""
+	.string	"getEstimatedAltitudeCm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\t"
+	.string	""
+	.string	"motorConvertToExternal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\t"
+	.string	""
+	.string	"motorIsMotorEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\t"
+	.string	""
+	.string	"motorIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\t"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\t"
+	.string	""
+	.string	"gyroRateDps"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\t"
+	.string	""
+	.string	"getRebootRequired"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\t"
+	.string	""
+	.string	"getArmingDisableFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\t"
+	.string	""
+	.string	"getCurrentControlRateProfileIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\t"
+	.string	""
+	.string	"getAverageSystemLoadPercent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\t"
+	.string	""
+	.string	"getCurrentPidProfileIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\t"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\t"
+	.string	""
+	.string	"getTaskDeltaTimeUs"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\t"
+	.string	""
+	.string	"packFlightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\t"
+	.string	""
+	.string	"systemResetToBootloader"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\t"
+	.string	""
+	.string	"systemReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\t"
+	.string	""
+	.string	"motorShutdown"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\t"
+	.string	""
+	.string	"sbufBytesRemaining"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\t"
+	.string	""
+	.string	"sbufPtr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\t"
+	.string	""
+	.string	"sbufReadU16"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\t"
+	.string	""
+	.string	"findSerialPortUsageByIdentifier"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\n"
+	.string	""
+	.string	"sbufReadU8"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\n"
+	.string	""
+	.string	"serialPassthrough"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\n"
+	.string	""
+	.string	"startRxBind"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\n"
+	.string	""
+	.string	"persistSignature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\n"
+	.string	""
+	.string	"setSignature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\n"
+	.string	""
+	.string	"sbufReadData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \n"
+	.string	""
+	.string	"signatureIsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\n"
+	.string	""
+	.string	"persistBoardInformation"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\n"
+	.string	""
+	.string	"setManufacturerId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\n"
+	.string	""
+	.string	"setBoardName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\n"
+	.string	""
+	.string	"sbufAdvance"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\n"
+	.string	""
+	.string	"boardInformationIsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\n"
+	.string	""
+	.string	"setRssiMsp"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\n"
+	.string	""
+	.string	"rtcSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\n"
+	.string	""
+	.string	"rtcTimeMake"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\n"
+	.string	""
+	.string	"sbufReadU32"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\n"
+	.string	""
+	.string	"serialFindPortConfigurationMutable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\n"
+	.string	""
+	.string	"setRebootRequired"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\n"
+	.string	""
+	.string	"featureConfigReplace"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\n"
+	.string	""
+	.string	"runawayTakeoffTemporaryDisable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\n"
+	.string	""
+	.string	"unsetArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\n"
+	.string	""
+	.string	"disarm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\n"
+	.string	""
+	.string	"setArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\n"
+	.string	""
+	.string	"blackboxCalculatePDenom"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\n"
+	.string	""
+	.string	"blackboxMayEditConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\n"
+	.string	""
+	.string	"readEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\n"
+	.string	""
+	.string	"writeEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\n"
+	.string	""
+	.string	"compassStartCalibration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\n"
+	.string	""
+	.string	"accStartCalibration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\n"
+	.string	""
+	.string	"pidInitConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\n"
+	.string	""
+	.string	"pidInitFilters"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\n"
+	.string	""
+	.string	"gyroInitFilters"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\n"
+	.string	""
+	.string	"validateAndFixGyroConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\n"
+	.string	""
+	.string	"resetPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\n"
+	.string	""
+	.string	"loadCustomServoMixer"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\n"
+	.string	""
+	.string	"motorConvertFromExternal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\n"
+	.string	""
+	.string	"initRcProcessing"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\n"
+	.string	""
+	.string	"activeAdjustmentRangeReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\n"
+	.string	""
+	.string	"rcControlsInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\n"
+	.string	""
+	.string	"findBoxByPermanentId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\n"
+	.string	""
+	.string	"rxMspFrameReceive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\n"
+	.string	""
+	.string	"copyControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\n"
+	.string	""
+	.string	"pidCopyProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\n"
+	.string	""
+	.string	"changeControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\n"
+	.string	""
+	.string	"changePidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\n"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\n"
+	.string	""
+	.string	"resetEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\n"
+	.string	""
+	.string	"sbufInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\n"
+	.string	""
+	.string	"getTaskLatenessHistogram"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\n"
+	.string	""
+	.string	"getTaskExecutionTimeHistogram"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\n"
+	.string	""
+	.string	"getGyroPeriodJitterHistogram"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\n"
+	.string	""
+	.string	"serializeBoxReply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\n"
+	.string	""
+	.string	"initActiveBoxIds"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\n"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.e437537c03190dc0,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
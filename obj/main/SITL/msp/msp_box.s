@@ -0,0 +1,842 @@
+	.file	"msp_box.c"
+	.section	.gnu.lto_.profile.c5c9869bff8dc476,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\b"
+	.text
+	.section	.gnu.lto_.icf.c5c9869bff8dc476,"e",@progbits
+	.string	"(\265/\375 \271u\004"
+	.string	"\024\007\255"
+	.string	"\013"
+	.string	"\317\225\334\332\017"
+	.string	"\001\240\342\234\212\n\002\316\240\376\350\001\002\002"
+	.string	"\002"
+	.string	"\003\331\263\352\325\004\004\315\346\253\367\016\005\342\351\332\356\006\f\002\001\002"
+	.string	"\002\002\002\003\004\002"
+	.string	"\007\356\225\345\247\002\002\b\234\241\301\342\004\t\320\200\266\313\001\022\002\001\002\005\006\007\f\214\227\337\207\007\n\002\b\002\b\002\001\002\001\002\t\002\t\002\001\b\017\334\305\363\307\006"
+	.string	""
+	.string	"\013"
+	.ascii	"c\n\006{\271\216\244\026t\256\273;\237\004)B\005\310\356ji^\262"
+	.ascii	"\2016"
+	.text
+	.section	.gnu.lto_.ipa_sra.c5c9869bff8dc476,"e",@progbits
+	.string	"(\265/\375`T"
+	.string	"\365\003"
+	.string	"\342\204\f\021\300%\035\377\357\372\177s\227%\255\021\262\332\3362\245\026Rz\230\244QW\211\230\361\371\363(\372U\274K'\244&\354}\3016<\016(z\033mq\"# \300\202)\232;\221\200K79\032\264\005\334\265[\030Ep\226\271J\266\302d4\361\271l\243\024\203]\026\334\262\371:`\002*"
+	.ascii	"\030\360d\314\0065\361l\317< \200\016\2659\204d8181\026\3401"
+	.ascii	"\300\200\0135\004"
+	.text
+	.section	.gnu.lto_.inline.c5c9869bff8dc476,"e",@progbits
+	.string	"(\265/\375`\370\003\035\021"
+	.string	"\266\030XC\020\221\223\306\220=\006\024m\276\247\203"
+	.string	"\343\177f^=\324\217\277\212O&\340P.\322\315\253d\346*\341\233"
+	.string	"dl\021\005\025Y\363\001"
+	.string	"\005\002"
+	.string	"\b"
+	.string	"(\300\346\017\027\007\332E4 \270{\267\275\245L\001D"
+	.string	"E"
+	.string	"H"
+	.string	"\ts\340\305\200\210\002\351\222\0365\311o\037\331\340y\264$\253s\201~\230@!&\301\234\b\357E\264\005\215\351d\211\250\f\032\323\251Z\307H{\270\327\220\356\356\276w\260\273'\257\237!\355\305\356v\276cw\023.^\272\030\t[\361\264\270\307]A\264\303\214TK\256\273n\246\027j\\lx__\240\306\"\223\002\361\216GP\223QQ\302\364v\273L!\254x\260\360\206\273\202\206B%\003\216\317\nw\005e\365\325\006p\245\001wD#\322R\223\314\236\245%s\316\220&\001e3\022\260'o\231\271\2073\361^\2443\250\023)9\"Q\r\245\033\026\031\003;\254\227\017g\214\224\237\216\303\373\221\246B#U\001A\023\351\212\322\203\022\201\241[wnv\002\177>F\372\334`\320b\254\013J\034i3!r\330\030p"
+	.string	"\370\361\016\2445\030`H\270a\274\206\021\244\241lF5t\030\2071\244,'()\325\360\032f\232\302\006\214\026\367u\310e\332\371-\315SZJ\362\001X\250\201\27533\"B\3222\312\225\003\200\242RED\017\022 $9C\342\244\023(3\023`\230<\3136\326\fi\b\275\245\004\200D\343E\n\254'\301\004\331%\t\3423j\264\227\213\225GHx\0344\222\372\240\271o:\246X\327\337\027.\325\005\007V\352B7\252\356\322~]\365\013\323hu*p_\3757\300O\030\025\244U\032\240\f\031\377B\"\304\277\331M\335\377\273\023E\267]\371\033\303kN*\301"
+	.ascii	"\310@\210\201{\230U\177\027\037\352\237\320\265\361\300\2717"
+	.ascii	"DU\213\344\326?S\343i\221\013\214\245\345Y\353\362\246{SK\003"
+	.ascii	"\b1\325S\340\336\326\2043z\005\222\260\007\241l\245\337\001y"
+	.text
+	.section	.gnu.lto_.jmpfuncs.c5c9869bff8dc476,"e",@progbits
+	.string	"(\265/\375`,\007\265\017"
+	.string	"\026\023>7`5J:0T\006\340\036r\210\032\243\217\232\032\3143e\222$+\006\340\311\007\301*\202\302A\300-\300p\210\3336\376\261\3067\360\277\241\326\376@\250I$\2154\231v+"
+	.string	"."
+	.string	"4"
+	.string	"\247\201\327L\255.\233W\037\365\225\034\216\252\026}\263\332\266m;Ss\332\236\367\236\327\363S\007\312\035\350\254\0329\252\367sJ\210\005/\317^O\250\2447\252]\035\341\217`\276\375\005\233\007\004X\200U1"
+	.string	"l\211\217\270?1\305B\016\221\f\r\375ais\"xK\321\034N1F\"\030\266X8\327hP\024\2140\336ymUY\226\303q]\223\t\205R\251`0\333\331{\273]\341\265\231\214F3\201\017\355\3402'\254\231\237fg\001y\202_\255\266_\2252\310\003\037\334\227yh\213\2451\306;\020H\214\020^\340\366[\347\246\t\302(:\306\313\345=Ib0\036\017\211$\200\220\250\021}D\"IA\n\n\225a\f\020#\221\242\315\001\022@!+\004c1\342\210\200\020#4\002# \n\205y\352\264\006\034K\347\371"
+	.string	"\225%\365V\371\234\313\321c\004\314e\002\344\t.\270E_r\202\323\202\337\352\273\032K\264\274\266k\315\314\204\007\227\030FT\220M\366>"
+	.string	"\f\024\267AHA\032F\003+\210\001\234\354\307\355\337w\306\320\013\333.\027\217\221\265\217c\372\337#\210\250$\016Q;\226\030\371\265\300\364\277\264\353\350!1\362\371L\347!F\007Yt\370\344u\374I\227\013\304\256\300*\275Uz\243\216\362X\3100\207\330\313_\257\032\030Wr\n\033\032"
+	.ascii	"\024\300|7\250\244\\\216iy\013!p\347qHD\354=\215O\364Q\373\300"
+	.ascii	"\346\231\336\260\350\0203\034\330\222\334j&\r\210\030H\242\344"
+	.ascii	"\362\206\236\262\340\307w\313\224\021\023\001r\202L*8\251\362"
+	.ascii	"\325\275\354\001"
+	.text
+	.section	.gnu.lto_.pureconst.c5c9869bff8dc476,"e",@progbits
+	.string	"(\265/\375  \001\001"
+	.string	"\034"
+	.string	""
+	.string	""
+	.string	"\t"
+	.ascii	"\230\004\002\200\004\004\200\004\005\231\004\007\231\004\b\270"
+	.ascii	"\004\t\271\004\f\230\004\017\270\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.c5c9869bff8dc476,"e",@progbits
+	.string	"(\265/\375 \301\275\003"
+	.string	"\002F\023\035\220)\351pJ\357\356j\317L4\333\374\252\026O7\360\3032\345\215\223\335\biD\312\024\033\020\212\002:q\013\346_\bw\367}\016\272:\005\235\201\036\325Fr|\314\214\307W\231\020\320\207R\263'\371}\265\177s\021\362\201]\235~F\021"
+	.string	"\270"
+	.ascii	"T\270\2640j\0278\252\360\020\260\035\250\370\f\004\fmj\030T\347"
+	.ascii	"rMl\021\355\262/\310\004\024<\200\""
+	.text
+	.section	.gnu.lto_.lto.c5c9869bff8dc476,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_boxes.44.c5c9869bff8dc476,"e",@progbits
+	.string	"(\265/\375`\312\t\r."
+	.string	"\332S\224\022;0\352I\007\345\262\274\337\016\001\032\025\003\261fUUU&B;}\037\305J\225\200;\347i\201\360\031YB\226#?\207\354\337\020\333\203\3003\224\023Wf\307N\262\355'\377NI\006\027\001\022\001\031\0018A\240~ \373\343\024|{\302\371\222h\353|\262c\005}\372\337\366\303-\370\036K\347;C[\237\313\216\027\370\321\376i;(\256B4\037\304T\201\266\336%;\346\252\243}\323vN\f4\255y\2373\263c\006\204\332-m\277\224VJ\363\276f\222\354\230B\003H\332%m\037t\020)\315\375\230B\262\343\n\251\"\355\214\2667z\260(\315\375\232\016\227\035[p"
+	.string	"\250\035\321\366@\b\207\322\374\217\271\002mud\307\027\036\020\322nh{_\204B,\374\257\351\002mid\307\030 \b\322\276\267\235\257\201\236\232\0032_\240\355\213\3548C\004;\355x\333\363\246\356`8`3\006\332\252\310\2165H\330\243\275\317v?\022\370\254\271 \223\rm\217\331q\327\004;\332\361l\3173\341\016\r\027l\266\241m\210\354x\203sIeI9v9\332\351l\257\203#\007\002\267\2707\022\216\263\317\331Q5%\2570L\241\233[\353B\034\363@\333\317\216\275\234K\312\361}|/\n'\216Q\347j\352G\264?\020\037R\033q\276\311\216\251\004\351\357\333\357gehI\342Lv\\\325G\377\240\375M"
+	.string	"|K\317s~\311\216\255^N\177\240\375\202\256\036P\232\353a\236X\262c"
+	.ascii	"l\364\333\355\277\013P\267\303\351\230\347\325\213\321\317g\177"
+	.ascii	"\037\254\337\303\302\351\3166;\0160E?\236\375y\004\334Yz\035"
+	.ascii	"\023Tv\214\365D\177\235\375r\003\350,\275\256\231);\026\360J"
+	.ascii	"\364\303\331\037\207\300\233\245\3331\1770;\036PD\377\232\375"
+	.ascii	"l\n\250Qs\273\246`vL N\277\231\375g\244\312\250\371\035\263P"
+	.ascii	"v\\\340\341\364\207\331/\306\300\203Q\363\273\346\347e\307\006"
+	.ascii	"@\351\347\262\277K\326o\241\341x\314\227\223\035gq\322\177e?"
+	.ascii	"\026-+E\3073\201\266?&;\326\342\323/e\377\224\003QN\270\3367"
+	.ascii	"\311\216\017\\\322\357d\377\023\004M\216\256\327|\004\203\372"
+	.ascii	"\223\354W\262\205\344\350{L\302\354x\253\221~\"\373\213$\030"
+	.ascii	"r\364=$\332:`\3662`\260X\353rQ\243\255K\303\326e\233\241V\243"
+	.ascii	"\313\006\033[\215.\253kD\262J2\3440\035\033\222-U#\326u9\237"
+	.ascii	"s=N\347\177\274\316\001y \037\344M\367\363?O\344\202\356\310"
+	.ascii	"\037\371$\247\344\230<\223wrO\036\352\335\336\307\377\370 /\344"
+	.ascii	"\215\374\221_\362L\236\371P\236\312W\371,\257\345\275\374\227"
+	.ascii	"\037\363d\036\315\247\3716\357\346\345\374\234\237{;\257\347"
+	.ascii	"\351\336\317\377y\274\317{\275\337{B_\350\377\036\360\023y\370"
+	.ascii	"F\357\350%\375\340WzK\257\3517\275\247/<\335\316\036\347\217"
+	.ascii	"\016g\220/\036rx\356l\365\031\267\317\026\210\332\241\031\325"
+	.ascii	"#;\276o\372\364\261\317\267\023.\315C\247\354\330\235\353\223"
+	.ascii	"\376P\373?\201Z=\374\371\204\372;\355\027\344\264\366\241y&\312"
+	.ascii	"Y\201\3721\355\317t^RA\f\321\366\374\313Yg\364S\332O\0305I\r"
+	.ascii	"\204^v,\345y\372!\355\217D\365h\025\301\374\223\035Oy\226\240"
+	.ascii	"\376E\373\031U)ZE\210\241\355y'\007\367\310\252QW\352\222!S\024"
+	.ascii	"Y\344\030z\321\224E3\225\025K\213J2\365\352\212\251\307\250\273"
+	.ascii	"\256l\030\325-AT\211\352:\206^0U\231<\252C\364.\3311e2\311\256"
+	.ascii	"S\367\fi$\256\306\251\013V4\252C\251{\226L\211I$\326Ec\225\353"
+	.ascii	"q5\256\312\252\353\305\341\013i\306\256\311\251Ku\32705i,\252"
+	.ascii	"aTlQ\245\272\304\257tl\250,\236%\323.\024\305c\272\032\305\310"
+	.ascii	"\324\324\254,,\300\255"
+	.string	"\320\266\341k\004\205tM\252\354\232\242@\202\231\030\252F0\255\353\305\341+U\331\365\250\016\007\334\261\244\312\016SvU\206\251)\273\232!\323\262\2421L\353\036Yue\313\246\256\222l\211\034\246\253\262h4\256J5\231\226\255+\330\326]\211\310c\252,\226]]/\016_\035\3305\271\224\272\310\"q\251\246\304bY\325]S\240\031UV-\243\272\353r\230\\\3314Y&fu\331\225\254\250\262\312\024\311\016\325+\024J\263t5\202\251\311\"\321\300u\241\341\006[\213\0253\332\326\272\002\200\300\250!<\202\220eXMP\224\024$\031\306@\003\021\321\246\003\020 \344\334\334f3j\222\376\2229\245\332WlX\230t;\025\307\033IV\311\255\005z\203\3550\t5YX\211J\235\f}\253\312\222(q\265\327?5/\024\374\036\017)\212\024Bk\257\3102\2774\340\2225\301\201\255O\004/\342\031\034$u"
+	.ascii	"\252\006^)\013\306\005\214\266$i0\322\203\201\375O\0172\342k"
+	.ascii	"\220\204\252\177\016.\023#U\3476\337\374%P\023\263TG|\362sw\f"
+	.ascii	"\252\030sY\025\264\221\272,\331\231\301\315\233\265\223\310\337"
+	.ascii	"{\202\357\357\303\"\331.X\241!\250<q\244\341I-\3460>\335SY\205"
+	.ascii	"3\2228[\302\346\351\323\334I<\203\365\323aQ\325\376\250\034\211"
+	.ascii	"=\326\260r\364\222_\243\264O\347\"\320\027\275\3449\210\205o"
+	.ascii	"\177\371\"8\260\377#i\t:k\223\353\365\tW\220=/\032\b\233\023"
+	.ascii	"\r\242\311\211#\301\344\342\201`y\321@\330\345\033\"^O\242\273"
+	.ascii	"_\030\346\321\003"
+	.text
+	.section	.gnu.lto_findBoxByBoxId.46.c5c9869bff8dc476,"e",@progbits
+	.string	"(\265/\375`0\002e\023"
+	.string	"\026%\202I\320\362&\035\2420b\277\001\n\206j\237\225j\220d\373\346\307\237\363\211\300~\206.\016L\t\t\026IP\223\240\321h\373\225\236\261|4'\016\272k\362"
+	.string	"\237b\312"
+	.string	"\221\3309\b\246A\371\327qJ\314\036B\b\331[\356\224\002o"
+	.string	"e"
+	.string	"o"
+	.ascii	">\377\231\361k\200\330\223\323\2153n\204\244j\025[\026/\200;"
+	.ascii	"\365\036\200;]\022f}\2127'_\3578:W\276|\330\273\371[\224\b\221"
+	.ascii	"\331\315\244P\353\300t[\215\344P\350\234Z\330\001\022\233}\370"
+	.ascii	"\234\022V\324J\210\3148\314\r\272)\375v)\233\205ro\273L\3221"
+	.ascii	">\021\315t.;\222Z\253el\226s{\267=\263\035\301\226\027\002\376"
+	.ascii	"\274\213\177\367\241\233Zz~\274wJ\313\225>\200\t8RQ\006\224j"
+	.ascii	"\365P%\244\332\2401N|\350\037/\355\333\027\362o^\371C\257W\033"
+	.ascii	"\234O6.5\360\036\344\333\274\032Y\036\f\307#r\252\261\243VQ\301"
+	.ascii	"\251G\274\323\3333\366\312\266\224\366\201\316b\346\342\006\177"
+	.ascii	"\265\216(B\252Ud`\226wz`>4\277\346c\264t\277\225\271\300\317"
+	.ascii	"\370c.\315\335\312u\2158BI\345\257\334\337\fq\206'\261\320&("
+	.ascii	"\251"
+	.string	"Z\303\007H\340\n\006U3\372\321\213;\375\322&\250)\240\303x!x\314\266\314_\200\013zj\r!\2708\221\206y\023\247~\211\341\036;\365c\270S\272\277}.\355<\305thd\325\366\020}L\355\322l\021&\023\004)\032\342\345q*0&)+)-&(\337\312S*\310\200'\324(#2\340\t\006\227\027\226V\313\212\tK\013\305\365\322\032!`\320E\305\325\202\001AWk\345\372\345\361[\274\304\351\306\355\210{\321\177\373W\3631\232\337\316\271&\241\331\232\252niv@\203zKUH\313\316c\314\021J\252\317Zk\345\226v\026\267\353\355m/\001\261\303d\023\242FV\311\225\021\246\b\351\006( 0\002\203\234\274m\\\341\035\342>\277\221\256m%\362\324J\216B\027\300\315\317.\267\254e8\026s\221\230\024\241\341\373\303\264\302;\202\240/>\"\266Z\253\021\260F!\242\273\223\354\002{{"
+	.ascii	"\224\351N\315\213\255\276\201\231\020p\234lK&\353\251\2731\021"
+	.ascii	"\230\227\225\006GDY\203s\2576<\001"
+	.text
+	.section	.gnu.lto_findBoxByPermanentId.47.c5c9869bff8dc476,"e",@progbits
+	.string	"(\265/\375`%\002U\023"
+	.string	"\266\244\201I\320\322(\035\242\021\234\005\356o3W\016\031\251}\304\033\017V\306,\tN\372?d\302\242\314\272>\340\211=S\026\343\357\027,\304\325\314\002\256\272\334\221/\270\252\254o\256"
+	.string	"\335C\"\244A\351\034\021\224n\257\021B\366\226;\245m"
+	.string	"e"
+	.string	"o"
+	.string	":1\313\004\21096\340\270\203\306g\251VQe\361\001\276\323\360"
+	.ascii	"\276\323\025\341\324\247x\177Rv\360\243s\245\314\237\035\234"
+	.ascii	"\347%\205\030\271\321L\t:\0167\276\223\221\337\211\233\323\t"
+	.ascii	" x\265\233\207\317\031aG7b\344\266an\017O\306y\227\266\033M\356"
+	.ascii	"w\227DJ\343\021\320\355\346\022<\251\265Z\326n6wx\3337\333&\266"
+	.ascii	"L\t\377\376sOK\357\307[N\351\237LL,%\0258\252\265C\023\221\212"
+	.ascii	"\203\306(\361\237\177\274\264o\337\307\347\031\345\377\310^g"
+	.ascii	"jN\266\021\251$\274\350\357\214:5\213\367\304>\246\302YM\bd\304"
+	.ascii	"\303G\255b\202S;\bO\r\314\3331\033e{\245\335\340A\354<\032\274"
+	.ascii	"\265\342j\f\325*.p*<\275\212\0073h(hts\276n\007i\347\206k3\001"
+	.ascii	"\235Qin\316\337~ac\016\232d\262m\341D-Z\324[\252\225V2\364B\315"
+	.ascii	"z:\030\027\222--\352\t\341\371\013\331\201\327lg\270\213\227"
+	.ascii	"\202\234Zi\020Z\034\350\302<\211S\273\300|\257\235\3720{\336"
+	.ascii	"\247\r\\\257v\023#\233\026\210\030D\310n\316\026g\022\301\220"
+	.ascii	"\240\"^\034;\004\317\363\254\227\325\n\313\212k\245rb\371J\312"
+	.ascii	"\213\213\345Z\265`\254\026\224UH0\274*Phqi\251\\,\253\226J\005"
+	.ascii	"\346\242\"\031\340W\013\013\246zy\275`*\224\353\027\307_q\024"
+	.ascii	"#&\236\320\367\240\237\367\223n\007i\206\273k[\237\304\254L\023"
+	.ascii	"\27093\240A\301\245)\244m\3771\352\240I\246\317Zk\375\376\324"
+	.ascii	"'\027\334\357\216\362\001\327c\006'#\233\344\006( 0\002\203\244"
+	.ascii	"\273m\\\341\035\3426\353\034\370\332BcI\255\356\006\324\002\210"
+	.ascii	"\360C\224\337c\270\215\215\272\215\264\306`\002\236p\301\240"
+	.ascii	"\210P\224\342#\"\253,\354nb\037\244%\344\366;\331n\333\026\372"
+	.ascii	"*\336\221\260\031h\to\320\004\233\310#\273\3604o\254\005\346"
+	.ascii	"j%\254#\246\254\341\334\253}O"
+	.text
+	.section	.gnu.lto_serializeBoxNameFn.49.c5c9869bff8dc476,"e",@progbits
+	.string	"(\265/\375`\220\004\365\030"
+	.string	"\006i\231K\240\220R:\220\263/\200\004\023\246\024Ap\236\330\245\237\027M{\030X\007\262Y\237\201\337\341\306U/\250\355\336\255u#\365H\340\277\t\004\330\306Zp\375p\276\005a%e\317\310\002\002\247\245\025\004\272\n\312\377\366\177B\366\336I\006\206"
+	.string	"w"
+	.string	"\204"
+	.ascii	"\371wG\274\370\017\237G\217\267\323\345p\253\212\257-\366?u\023"
+	.ascii	"\022m\307$\316?J|K\217\245\b\333\303#L#\267\213!\227\230\304"
+	.ascii	"K\312s'd\221\345\025\355\210\356\204TZ\035\221\023r"
+	.string	"\310\346Te\023\216\307\256\027C\n\361\222\034\254\2726\205l \371\030\035c\224\032.n\3640\035yI\243\275\030e\371\005\344K\356`\221\260$\265O\335zH\352X\213c\220sn{L\372\274A\336\375\220\356\376u\343\006\001\306\003}\252\f\304\\\211\233\365\352\357Mq\345\346\314\261\323\356\247\216\275\315\356\337\351t:\355\313\354\276\363\337\375\371\353T\333+\266\255b\333\030\333\276\330\266\275\266\037\262\223\021v\322\226s\317TG\226\252[&\272\373\274\356\266\317\233\264\002\267\335\217\272T\361\316\r\017\311\231\211\325\"\347gJ\237\344\256\366\363\"\353\325\334\003\254W\273\330\315\366\247R\276\325\007\036\253\0349\007\275\266\236`\311 v\340ns\305\357\265N.\340\301\224*\374E\360Wf[1\367\036lI\t\rB\256%#@e\027\ne\013R\001\330>\013\013+\327\n\356nw\213\213\375\261{YM\322\235\213\223"
+	.string	"*y\206\201\253\275\026\211\n\315h\337\f<\013\370\250Y\316\031A7\314\261\202\257R\272\272\212\230\306 \264?\n\327\253\366>z\266u\246\343Rzo\223\3443\353\357\013\325\231\321\276u\367\360U3\271\234\0036\303\227[C\274p\033\250b3|i\221!\n\177\032b\\\204? \r\361\247\"\240\207204\277\232\341\220\346\307{\346\034\347\313l\007^\322\234\253\323\003\254\202wt}"
+	.string	"\301fu\341\234s\376X/\313QGx\233\204\365\352|\242PKhiG\276\265\264\253\255H-@a\024\302C5\233\36022\365\351\007\310\254G"
+	.string	"\207%K:>\361\306\302.F\002\225\222\3045\266\3033(\034\354\013wPjE\351L\332~\2404\206r]\207\361\030A\220\007f\250aX\304\bV\"A\224\024$I\n\035"
+	.string	"\003\221\241\242\003\0208\251f6\0059\007\237d\\\273\225\254)&\215\200\267U\320\005=Y\212\024X\021p\222\204\177(AE\007X\225@\312\016\237t\341\236\024\272\336\337\312)y2\370R\307{R\350\37261\276\342\323}\026\263\221\315\352\260`n\375]\2331\005=\362\273\002\277"
+	.string	"?,\375\300>\242\2069D5(\373)SbG\021\332$)^\321#\273\fu\025$,Q\303H\226\314\031L\220"
+	.ascii	"\326\037\322\377\335\213)Wg\315\203<\353#\356\274jt7S8v\317\277"
+	.ascii	"s\354\255],s\255\236<IX\375\250\001"
+	.text
+	.section	.gnu.lto_serializeBoxPermanentIdFn.50.c5c9869bff8dc476,"e",@progbits
+	.string	"(\265/\375`h"
+	.string	"E\t"
+	.string	"\326\321?90\345(\035\336cs%\032jn\304\203\t+g\r\217\342\rc\207\"\332\324\036\254\3370\0067f4\236\2149\365Q\n\262\200 \307]\247M\032(\205\214\254\262\331M\244L),"
+	.string	"0"
+	.string	"0"
+	.string	"\230?\355\004\230?w6\313\343\307\376\325B\275^v\027\252\307\273g\347\177\344\002)\225\351\231i\330]gJ\265\272\365\266\021lC\373\232\177\226\245S\323\317hZV\024Lv9b\002\026\366PZ\266\277\261\235\261\024`\341i?\344\"\335]\030\037\330e\245\234\354F\216\023\264?\307\027\004)\037l\250\311\327T\016j\200+^\302i\273\032\f>\311\205\205\006R\302\374]3+\025"
+	.string	"\256S\306\354hJ\355\260\237\355\356ZY\366]\377{\f\244\315\243#.B\375\351\2206\317C\210\003A\212\t\b\020\374\2108\3301\360\026\222\020\301\321\266\211\340&\356\263U\226\035\\`'\315\260&S\237\332\240-\037\017"
+	.ascii	"\357b\310\304#p4\341\202`z\240i&\344\301\006s\215m\205\361@5"
+	.ascii	"p\005\314\rPQ\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_serializeBoxReply.51.c5c9869bff8dc476,"e",@progbits
+	.string	"(\265/\375`\353\005\005&"
+	.string	"\212E \017I\200\232U:\237\344\024\241M~o'tv<\341Tb],\277\377\332*\\\337$UcK\265\025!\263\365mV\rR\273O\030\022\273\367\212\276\371\355\226\177\r\353\240F.\204J\355\024XO]\340\021\231\026\021B\b\331;\311\334"
+	.string	"\321"
+	.string	"\340"
+	.string	"M\\<#\\\345\227\370\316\244\231\375\3129\311I\225s~\320\016\330\2473\364\267\373MW\342{\022\306urV\212\242\312Y\371\240i\354\323V^\200\372\224\375\216\372\324\327\315u\345R\276\223\244\320IW\316\271\206\177\320\216*\337k\267\330\367X\013{\261\253\232\312P|}\375\251+\b\242\205\250(\364\230\016&\360\266>\212r\034\266^H*\302\361W\202\244\242\033g\321C\241\341q-\342\021j\201i\206\226;\177\207E\031w%b\343*JA\t\023\020"
+	.ascii	"\305!"
+	.string	"\0243\201\252\372\325\023 \211G7em\\\206B\300\252\241\344Z\304\033\250N\2171NG\022w\\\024\235i\021q\240\263\234s[\f^|\346S\343\024\232\244\242\034\277\353\205\234s_\242b\321\033\300\273\217vw\256;m\021\006z`\267\013\274n\023\270\325{\300\233o\001<;O\376:o\362\007`o\347\374\351-{\324;v&\177{+\357U\275\324;eo\243\354m\314\336\276\367\366\017\264F\262\032<s\246\361|\223\267\244T\204\274\371[\375V\376\247?\352\227\272\332\375>\226g\351n{\305\2574\002\243!HM+\272\333*\267\352_uK\305G\365f\337\371\245/\312\253\272\201~\245\357\326\021\224>\263[+\275\017\307fS\327\215\252O\245\333\006\372\024\026\317C\304\327\320\t\353\214\210G\351/\273\005\272\024\332,\250\314E\020;\232M]!\200\272\333\247\367P\177\362\251n\245\242:D\321f\301"
+	.string	"9h|2DC\367\023\215\025\"\262PN\244\316\344\254l\360\264-t\343@\025\033\273"
+	.string	"^1\317)\f\001\\"
+	.ascii	"_\030\247E\234\314\2104\213\253+\347\240\2041$Z!.\2460\027\363"
+	.ascii	"*\026\352S\0028\315\342b\223\374U}\213\305\202\023}\370\027\022"
+	.ascii	"\016\226r\016N\350r/%\320\037\237\266\355\246\236\350\246>\035"
+	.ascii	"\200\177\365\005Y\\\300-)\243\337}b5\3125lRl\354\237\201\233"
+	.ascii	"(qdXI\353(~\022\306\027\243\030-#<\222a\025c\234\302\0212\305"
+	.ascii	"\260\212/\3669\232\021&\201\367\371\032?g\023\335\2519\370\314"
+	.ascii	"_\035FE\234\304\004o\233\226\335\025\367\263\234\320\335\023"
+	.ascii	"\345\340g\371\205 \026\272K2\212\020\301=;M\215a\031vPe\b\351"
+	.ascii	"8\206\277F\030\347w\237={3\325\026\037\3078.\207\220\300\373"
+	.ascii	"\354V\002/6v\177-\202%\245\261Rwz;8\335\315\375\330p:\234\n\333"
+	.ascii	"\355\245{\020nC\320\316\204\372\303\263\375xx\341TdX\203v\030"
+	.ascii	"r/t(l:^\256\027\313\235\260\371\240?=\034\356\033\204\240\235"
+	.ascii	"\211\022>\275\0245\025"
+	.string	":[\212\332\215\327\253A\350\351\235O\216W\373\331\355x\265V\371;V\352\251#[~\030\270\214ac\313\304\300xp\362\366\260QX\212?u\266\3139\343\336\314U<\244U0\022r!H\210\271\305\306\343\325\214\327\016n\024\2538\305\303\236\272b\036|\254\343E\302\312\\\305;\013\220d\200[OH\316W\3255p\001\003\265\\\017\346\277:\007',\3412\035\200\r\340a7\3175\200up\007\300}\346_K\316-l\316\310\300B,6v\004+\265\007\247Id=|\0324\347\234Wl<M\025\200{\360\235\327\200c\207\226!$`3\210\fs\250a0\206\bR\314\020\n\204F\204\026\246\351`\002\221\202Vu\020P\310\206\222t\023\3042\370\337(wsG\341x\n\320V\212\013\245\013\215\n\350\346\370\030\233*\344\002X\250f\302Y\365=\261\024<\276\013 \223oa\324\225\232\021\321\246\025C\243."
+	.string	"\027\212\202,\026\227\023\253\331\030S\202\216\023\226\214I\377\023\204\36003\035FL\021\2038v\366\320\035 \0177E\225\210\207\033\022\265\324{\353\031\"\300\376\227N8H+\261\204\374N\t)\007jE\037R+\266\206\301\f\013\r\250\230\007\246\034\270\021k|\261G`n\234a2M/s\315\245z#\001\351\003'~P\263t\021\336\261\311\314"
+	.ascii	"\202\376P\024\346\206w\206\004\b\301 IV\003eE\357t\323\346\257"
+	.ascii	"\r}\001\203z\013WT\016gx\374t\313\020\377$3\275\247\217,\n\262"
+	.ascii	"\373L\317P\001"
+	.text
+	.section	.gnu.lto_initActiveBoxIds.52.c5c9869bff8dc476,"e",@progbits
+	.string	"(\265/\375`\360\022-L"
+	.string	"z{\214\033B@\236N:W\303\"\214\t6\005\322\361I\273\266x\346\324\361m4\031~\177\203wc\217\323x\034\310AK\254\361\033\321\203\261\021\200\037"
+	.string	"E\212t"
+	.string	"\300\357\363\256\373tv\237\034\031Z\263\204\220\275\223\f\257\001\202\001\260\001\257\323\352lS\035\317\366\334\225\332\263\307#\265g\335\356\303\317\251\2757\003\030f\346\317\373\276Y\331J\025\025\325Sc\365\372u\356m\200u\237\205\245\340\312\252*\001\325\202)\004R\007\f\024\210\202\"\360\344\324\304`"
+	.string	"\223\200\245"
+	.string	""
+	.string	"\224\222\220\216\214\212\226DC\312\244\020\362hl\3315c\267\237D\217\216\316\035Y\327\263\004\243|\030\253JY\340\025"
+	.string	"\376j}\200\207\314,y\344p\316\243Rl\365\007\330\207\253\374\236 *\370\207\251\374\276`\305\222\"\211;\241\023p5\232r\207\356^\234\206x*z6K\021=ie\201G\260w\251==|`U\022:\363V\007wo\330"
+	.string	"\336\013\340\275\303\025\251\236\264\262\273Gyq\242i\f\265\"5\311\233\363\2539lf\307\263\303\004\326\327\351\221rB\247\334Z\241mL\360|p\370\251J\031\364N\353\204\270\266+'t\306\255\231L\035\234\253\221\303M\367\202\236\301*\025\305\256y\274G\021:\357V&\3010\211\367\342\254\203\007\374\356Uyi\340\250iexg\022s\001b\334\360R\333\003\264q\301"
+	.string	"\266\\i\213\026\234\264v\244\265,\370\b\313\215\260\\\301Ej_\252\021\255UhR$'t\242\255J\203S\360|hu"
+	.ascii	"\366\347\354\204\316'\253r1,\016\024\254<{\362\314\t\0262;\322"
+	.ascii	",\312\213\263\t>F\245\2251\271\361\204N&M\2620\334*9+\004\f\257"
+	.ascii	"H\236\327*D5~\222d\314U\311\310\026\261\313\035\217\221}al\274"
+	.ascii	"\360\276oc1\262\262w\203w\347:\335M\241{\t\r9+\361\252\355\221"
+	.ascii	"\312\346\347\235\343\2778\0175\025\247\314\265\b'9-\233z\246"
+	.ascii	"`?\343\342'w\216\366\271\005\235\035&^\354$\214K\264\335'R\340"
+	.ascii	"\213=\0175\005\247\314&\300\"\334\247j\003\260p1\324\374\233"
+	.ascii	"\202\345\256\036\302\307\367_k\365\317].\006\221\232X\367\f\032"
+	.ascii	"\370b\235\004\350\244\"\n\311]\335s_8?\273\237\243\207V:S\351"
+	.ascii	"\316\270U\244@\342Fa\304}\342\201o\023%\216\270I\034qo\215x\232"
+	.ascii	"\267\b#\356\020 \276\367\316\220qC\270\364\375\340}o\243\243"
+	.ascii	"y\027\265\270\227-n\"#\356!#n\245\021w\262\305-\324\342F\266"
+	.ascii	"\270\217-n\243\021w\333\342f[\334k\213;\267\270q\213\373+\256"
+	.ascii	"\360\240\235=\0033\235\271\327H5\320;e\327p\271\364\017\374\367"
+	.ascii	"\3764\177\337\217\346\207\336\330\375>\234\007\366\005\337H\335"
+	.ascii	"\\\332\007l\343\262\371_\363\270_\263`u\321\276\035\"\372\f%"
+	.ascii	"\034\335\364\337\360\220\"\262\351\267\341\361\244\257yt'\321"
+	.ascii	"<M_M'\355\3343\337\353\363\231q?\346z\335?\236\327H\346\234\266"
+	.ascii	"\367}\223x\335\311\271\376\235\3732\355fB^\0328\2533}\273\037"
+	.ascii	"\257\363\361W\210\023\331\244;D\304:~L\337\f\231\323\375x\031"
+	.ascii	"*(\346"
+	.string	"\334K\266\205f\b\367\347}\347\256\216g\241\326\037\335\311\263\370r\235<\334\343\334C\201\034\273\234H13\206\210o\322_\315;\320\035\206\3615\211\310\020rSz\b\371x?\"\303&\205O!\201\374l\006~N\0312+\206\301\345|DnR\265#\362\367\320\331i\276)o\344\236\362\363\317G\344\f\371|\337`\206\226G\b\332\027\232\246\335\240S~v\210\\\347z\355v\301S-vP\361\217\240\313\226\354Rl\003\304\201\356\227\365z>\332\263!2;\250H\205^\017\377\371\220\272X\2206\330\317e\273\352\303Q\367\313\352\206q\335Z\327\255=+\"_\315\245\006\025\277\350\334)\361\302U\275\265!iM\371\331\177\313\244H \203L\245_\275V\253\3148T`7Z\n\324\336\227)\241\333}\303m\334\270'\303\263\215\327`6\256\034\206\f\031\332\263\312\374\273[Q\221C]\343\205\253Dt\334\234\f "
+	.string	"\210\351O@t\n\266\004g\n\306t\024g\364VT\346\326\202}\302\b\310\317\306I\236|\023\223\314l\034=\352\322\262\354I"
+	.string	"\241\243PV\256qBT\226d\n\006`\250\252\204\\\221Y\311'h\232$\244\210t<\346\027\325(TD\346\221\222\0219##\2241+\371\342\246L"
+	.ascii	"F\334\246H\001dP\247T\304$\240\"6\021\1779\353\263\\\"\002s\252"
+	.ascii	"\033\033\021Q\206b*\025q(?\373x\255\266\315-\350\352tk\300eZ"
+	.ascii	"\307\367eFh\354\304d\034\372kg\273\203\007\266\357\241=\333\346"
+	.ascii	",\215B\275p\265\213p;&8\005S:\215\301I\262lV\356\275\t\345.\310"
+	.ascii	"\365\270f\345\036\224#r\311\232\004\037\371\030\2311/a\374\017"
+	.ascii	"mw\210\021\370b\001/"
+	.string	"8\364\340j\301\302\320\301\342\305\214\0276X\270@\3168\013\0330r\273\300\352\301\325b\305\215\0345\262l\314`Q#\313\005\216\034YX\002\232\353\006\f\034Y:\270\270pd%\347\274\236\251\364V\230\251W\376j \353\373\246Y8\364G$\003}\347\256\354\005\244\277\326\3563\006\216\321\236\305\262f\210\026\307\304\013W\325\262\362\263\227\213\n@d\026\013\202nR\341-_\"\265{\261\376\035\255Q\006\221\227\211g\350\350\234\211*h2\264\362\350\217\211l/\025\021,w\265\200\330<\257\376\276\241\320\260\216\257J\360\035\350\244a|T&\262\n\025Fv\n\007\371\024\326\251Z%H\221Y1\013.\347\017\006\377`}\337\367\255z\220S\344\003~\203\331\023\301\334\307\364\302L\200\"\033\235\310(\362\303\006-j\261\203\207\324\303?\177'2;x\370\207\375\270Jpb\037\023\371\202\227\032<\314|\346\022\027\251\246"
+	.string	"\351\rZ\220\251,3\016+l\224\357w\271\030G7\213\253\005_l\231\037\375\307\336<A\342\025\355\233\232RB6\005C uDQ\212\350\211'\312\227\373\211\260I<\220\237m\364+P\"g;LV/\312\315\365\355\246-\312\207\376h\214\0252\006\256^\224K\254\213yp\204\340\002[\371y\227\2131\345t$\314Q\355u\276\357\233"
+	.string	"\tm\332\205\005\201\021\304\214\312\317\316\347jI \253\320\001.\253\325\352\364\\\355V&\221[\264/\\\355\241\274\225\033\207\r\362\302U.\270\020\320E\342\262\035\337\367\035\302oU\332\320\342\240+\0268C(\275o(\\\254\343{\302\001\201s\250aH\005\021C3\"\"\"I\222\024\032\003\301\005\204\020&\235\3316\021\340\244rP\251\022\222\224\244\270\003\237\220\362I)-C\001J\230D\235\223\364\245"
+	.string	"\212P\020\211\233l\340x`\205\246\364H_\251\032d\004\357\231\361\350\242\201\223\307hve\301\220]\216\372\307\270\341\"\207\234.<\236y\274f;\367\"[OP<D\252R\354x\253\213\335\020\250\236Lm~\002G\335\021#`;\226\265#\211_y&-\273)}m\326l\371\221h\311\024+\233\264\250\374L\007\342\247\222{Rh9\276\247\351\321K\034\251D\f\250O\236\"\314\257[R\216\242uCU\347\271\214pg'%\214^\346\370\376>\345\022\326\277"
+	.ascii	"\315\205\270xC\227\024\324\224\237h\201\340\206\036\367\2575"
+	.ascii	"Jt\345\277\333"
+	.string	"*\375\355\201\033\352\341\304\300b\237$\003\316\323 \b0\016\360\034\017\035\3478\212\230\215iLR8zn\262g\024\251\314\316\"\231PH \337-\241[f\006E?\3352Y*R\b\375\214%\002:\305Y\231\322\303t\244\016)\257\245\tr\233\271)\r\2528I\"\227I\276\260\"(T\305\2742\362\330\317\344\324\224\247\026\372q\022,\372\203\314+!\376\356\374t<M\204\244\021\005\206E1\207\b\365\300\214[\261\323\301\235=\310\264\302Pn"
+	.string	"\0058W.P\314Aj\221\220\031\204\\M;\225ozrw-\357\022\314'\025F\3564\263\374\322\314\363\335\244\331\244\250#1Mb\304cf\200h\336\222\232u\361u\271\253\022S_N\251\352\371t\230$\r\263\374'\327\272\206\266\364\334}\031T\245g\243\233\226B=p\332@\027{\302R\035B\351\2163"
+	.ascii	"\217A\3261\263\222\300G2\032Wo\273\200\213\220\304f\217\370E"
+	.ascii	"\201Fg\204\033e{\025\260 8\002+Sfz\261\237\033\232=\367\265d"
+	.ascii	"\250`\221\356\\\256\b\327\272\206\355\370\022\026\346\344\343"
+	.ascii	"\t\002\267eh\017\007J\036\004\204>@\202\222 |\237!\356\277\251"
+	.ascii	"\334\337\267p\272\235\317\027E\322W\203\256\243g\3404Y\256&\313"
+	.ascii	"\227$\005\034\016L\365G\247\3706\322\032\226M%<\347k\210#\336"
+	.ascii	"\216PZ\001\006\346A\215\354\204Sg\374\0178k-\320\"\342\354\200"
+	.ascii	"\254\303\335-\177x_\251*[\226UmV\241\366\341\027Z2\006\001$\212"
+	.ascii	"\336\207\023\f]PD\206m\335g\257O\341\225\200\n \3065\340\356"
+	.ascii	"@\354\b\232\312\001\224)b\255\006"
+	.text
+	.section	.gnu.lto_getBoxIdState.53.c5c9869bff8dc476,"e",@progbits
+	.string	"(\265/\375`;\002U\024"
+	.string	"\326\247\214I\260RN:\373[\314\341\n{\222\321{\r\213\002\256)\307**\373\223>/Z\205\366Z\311\253\274,\343\355Z\227\246\276\375c\006\037\221\352\375b\035k\234\341\203z\343q\304\311\355\347y\260?b\233\242\206\215\220\275\267\2242\005{"
+	.string	"l"
+	.string	"{"
+	.string	"\337\027\013\343\266N<\217\325Z\344\242F\255\276\005O\020\3564\260&t\247\\\022\272\363\377\0314\270\275g}HA\233\202h'\303\253V_\255Ql\317\202t\312\346\236\257\317\202\025\256\254\350\n]EMi\022\244\304\233\365~\344\t\327\024\020Y\317\003\313\0167\202\360z$\266\345\t\021V\210YO'M\264N\364\330\3372P/\307\f\252\324Z\317\274\236\320>\334\377\034\376S\370\231&L\277-\035\177}\207# X\250\335\337\036X\252j\002\201\343\361\367\371p\037\375\333\3438\216o\243_\362G\316\247\235/r\376l\235vC\316\017)\037\244|J\371S\362%\345\367\344\263\344/I"
+	.string	"/\255\013c\255A#X\315\232T+\026j\367\277}\177\227}}\373t[\250\235\260\262\210\361x q\325ZQv>%\334y_\310\374(\013\266H\357\256\212v7\330Rj74[\301\322\226]?`9\036/{f\330\037LX\253\316\201\354\007[T\334\335\273\013\303\321X\251\030\233\214\f\335\311\035\023\201\245\243\005\256i\202\005\222b\374p\350\370\213\247\272\264J\310\221\246\365\3766\266\013\333%@\267G\372\274\033\312m\324\316\230\371\252\270h\303\313\333\371\265\241;\267A\033VMC\253\304#\312\352>:\017\ri\001I\0012"
+	.ascii	"!\345\375\303\032\226\025\230\027q%GC\214m\203\004\321\302\313"
+	.ascii	"\004\035\261\245\344\305\246#\266\314\273\244\350\210-\030jp"
+	.ascii	"fj46\226\231\232\313\rN-e\300\305\032\230\233Z\216(\336\324d"
+	.ascii	"\377\357\253+k\033}M0)\321Y\363\021\323\207)\322\265\344\243"
+	.ascii	"i\0356\320\377\260\257\202\353\334wd\255E\020\270\240x\224\265"
+	.ascii	"\326\n\3228\244\177\026\027^\336\254KFte\351\332\347?\236r\354"
+	.ascii	"\240\001$ \240\002\021\272\343\006\374\305\003)ci 7\220\266\274"
+	.ascii	"V\034\302\370\n\212>X4\270v\350\200\304\252\366\305\027b\300"
+	.ascii	"\345\303(\222\311\264\230@\211\353\320\333\017\303:\233\344\354"
+	.ascii	"B\306o\366\230y\013(G\356J\343J\314\267r@\347b\023#M\212W@#\324"
+	.ascii	"="
+	.text
+	.section	.gnu.lto_packFlightModeFlags.54.c5c9869bff8dc476,"e",@progbits
+	.string	"(\265/\375`\251\002u\025"
+	.string	"V\347\213I\3000'\035\333\243\366\210\316,\3569\352DX\340P\265\352\b\200\335\241\276\350&7w\266!\342\335\036\311\177\277\256\276\036\376\20624?\377\207G\020\004sL\373L;\377~\221\253uv\024y\237\271\226\3507i\204l\271S\ny"
+	.string	"o"
+	.string	"x"
+	.ascii	"H'\241\263\247h\331\241w\"'\035\246\033\265V\232\310C\304\207"
+	.ascii	"\364\037\342\303\345\340q\352\376\032]bHw\352\374\337\251QU\220"
+	.ascii	"\327\253\371\213\036\230\265\341.z0P\004F\026\254\016\374\334"
+	.ascii	"\351\355\3468\344\003tWG\357\347\342\205\20798\223R\002X)l\300"
+	.ascii	"z:4\204\247\210G\366n\346\036\370\220(*+\310\007\350\323URk\365"
+	.ascii	"\344\365|\356\216\333\036\262\275\300\236\037\002^![F\247=b\260"
+	.ascii	"p\232|\371\277\336t\323\375\322=\351\364?\004H\265@\211\252\225"
+	.ascii	"'\230\243^\205*@\274\351_\362\231\376d\223\246\271\223wJ\206"
+	.ascii	"Q\255\225|\t\037\3304c\002*J\001\215M>\274\255\363\177&\375\245"
+	.ascii	"\331X\3233\002\241P`\325Z\216<\364\201\361\341\264\237t%\335"
+	.ascii	"K\n\227\325*\024%UkY\300\263\361\241\313\361\001\246\273;wgF"
+	.ascii	"\244\033\333o\261\bN\327\372>\023wa\213Re\225\243a7\203bl\356"
+	.ascii	"\256\264\314\363\fB5\342\n\307@\210\252_\270\276\023\377>\310"
+	.ascii	"._\020*\021W\027\212\361\323D'\210\036\233\241\350\305\017\306"
+	.ascii	"\315\304ar\322\365\237 \324\346y\036\373\247\227\334,\215\262"
+	.ascii	"\206\326\256o\274W\210#\177\255-\0017\317\363\244\372\271\312"
+	.ascii	"\331\032\273\334\315\365\331\007\240\304\253\020,'9\233J\230"
+	.ascii	"c9\311\331\022\334p\265\027\316%\005\306\244\205\305\326@\346"
+	.ascii	"\201\313\013\214\311\rW\013\340\025\222\234M\305\301\rW\243E"
+	.ascii	"xI\251\321Vbp4\222\001\266\335Zbh26[\f\215,m\276B6\035we\344"
+	.ascii	"\212\330\354\316\262%Wg\313f\006_\353s\f\207+\266\007\376\345"
+	.ascii	"\341hkz\307\3245\367\277\217ZG3\246wf\f\212\224Nk\255u\\\237"
+	.ascii	"\017\374\353\b)I\204m6 `\002\221i\267\r\277\030\351h\362\353"
+	.ascii	"\322o~U:\rK\r\205\255~!\222\031w\366M\264\276\357\357 W\217\024"
+	.ascii	"\214V\271\311Cu\205\366M2-\377\356\314\215\013\217a\207\202\252"
+	.ascii	"\363\201\0251\002\354\326\265K\016\224lNUj\024\357B0\034u\030"
+	.ascii	"\271\357]\327~\321\332\f3\f\272\250\357\342\250\026l\370\273"
+	.ascii	"D\007>\261\036\206KK\374\220Fw\257&R\246\362]\221\314\324\206"
+	.ascii	"'"
+	.text
+	.section	.gnu.lto_activeBoxIdGet.part.0.69.c5c9869bff8dc476,"e",@progbits
+	.string	"(\265/\375`\242"
+	.string	"\205\n"
+	.string	"&\325H>0\247*\0350\337\214\210\210@\225\375wos\310\311:w'\\=\003\025\016\214\234\007<\003lu\027E\261\021\243\204\026\312\251\217\b\252\212\03087!\234k\241\033T\f/Z\333[\312\224\0028"
+	.string	"5"
+	.string	"4"
+	.string	"\033N\211e\333\033\216\311\247{\261UE\345\340c\306`\327\323\036\265\344\247k\302\223\237]\013u\375w\b \226\240k\205<\023\016+\235\335\265E\344\216\267-a;c_\013'\266o\377+\331\030\333dc\036mk\336+]F\202\336\266X\326\264/\340\003L\227\221|\331%A\240`\327\313<:\302\362\350\360\005\312#\274\002\345\321~"
+	.string	"\007\233z\347\317^`\363M\036\255\301\345\273G\237\343\350\310w\251\377\236.\017E\245\302\254\360pw\327\372\262\235V\247\363\336\177\nD\2070\262\273z\320`]qA\026\023\243\315\023\375\321\2146\017E\210\003i\031\030\025 \355#\3424\r\203\267\320\205H\333\3306\221\2069\\}\371\337\037\016d\252*\210\272\223R\225U\025f\373\222\327\023\270\001\256!\266\001\020"
+	.ascii	"\3571\036\026\356\320\206BY\340\fc\312\225\271\025\220\007F\004"
+	.ascii	"\22709O\316N\273k\216\240\316\360\220\232B\363\322k\313\030"
+	.text
+	.section	.gnu.lto_.symbol_nodes.c5c9869bff8dc476,"e",@progbits
+	.string	"(\265/\375`N\003m\020"
+	.string	"f\230^D"
+	.string	"\265\322\001!h\306\270B\036N\370\034\342@kZ\004\274\"\017q\310\005lt\342\344\327\223\264\237,\375\177\023\312\377\377_O\225\025d\205e`+\305\314\272F9\027B\306~WB\224\220-\311\336\222$\231RL"
+	.string	"N"
+	.string	"I"
+	.string	"\017\341\245\260\016T\3009=ER$\370\227g\335\364\340\331>\365\020\274\313\323b\274\353\272\356\300\267<\003\317\202\242\362\2709#\005\b\307\222\223_y\316\334tJ\024df\224\311q\023\207\371\231yDth\3169\013<\333x\314\034\322\020\320\257\33222J\324`\320\255\332\250\023:\202`\320\253\332\251\031\"\b\203\336\265cpF\f\301\240o%\366\227g\233z\n._\241\345-<x\031\226\277\260\362\021P/\241\347\234\314'*?\241I4@|p\3600\257\001\357@\006\\cA\331\315jF1\213Ii\253\244&\267\337\013\233\037;\272.{Q\353Z\213V6@\364\252\336\266\3356,\222h\321\233\232\242\317d\320\242o\247\350\327\016Q\250\271~*<\334\264`\221\317X>\242"
+	.string	"\240_\267\337\n\">&\260\334\266a\\\370\330\321\2447\327]}jn\220\244ch?\222\203D\tK\337N\222\215\350\374\020\"\200\344\035nW@9Pd\3219\320n\022\\\017\217Rt\032\232\r\264\033F\020\325\242\023\240\327\326\001\364\236l3\220\237\030\327TM4K\250a<.)\n4\245\205Zk\340\002\251!\323\006\021\300\030Bb\013%\230QPP:*\223\303'\370\301\216\213\034\250zC\225_<\303\327\346\204d;\224\265\2532\211\005]Y^\265p.\244\267\223&j\244\266/A\276\366\231\343Z\214\307\224$\302\222Q\217(}|\007\274uq\357r\t\005iz4=4\341\361\332\220\223\3675d@"
+	.ascii	"\310\022\352^\f\n\307qw\027]\bPt\231\347\250\371\210\257#\"$"
+	.ascii	"[iQ\336\203\300(\236\256\002"
+	.text
+	.section	.gnu.lto_.refs.c5c9869bff8dc476,"e",@progbits
+	.string	"(\265/\375 z\265\002"
+	.string	"\"\207\023\034\240'i\f\343XUUU\347\377\377w?\021\210\342\343\177\373\255\265\326\266\375-I\n#\202\251\031\330\215sf\320\027\264\t\032A{`6,\027\226J\222\241\027Z\262\204\332A\335\3242\265R\213\324G-\325#\001\354\350C\333\236\263\347\212\001"
+	.ascii	"J\224&"
+	.text
+	.section	.gnu.lto_.decls.c5c9869bff8dc476,"e",@progbits
+	.string	"(\265/\375`\t#e\234"
+	.ascii	"\252\375\2207S0\022JJ\007\356K\314\241\214\356\2773\020\211\372"
+	.ascii	"2\020\214\333aU\342\252/g\0209\210-\370\256\346bx\001@M\272\373"
+	.ascii	"\356\367s\205\256}^`\217\260e\343\2718\356\316\243\"\b\"\253"
+	.ascii	"\252\250\252\252h\275+>\210\231\231\221\253sw?\221T\262\245L"
+	.ascii	"\001\337\002n\003\210\003T\022"
+	.string	"\254I\232`L\031\221.\300>j\332H\326\267\220\225\351\232\317p\335\231\216\315\344(/\323\245\314\300\0163\0036U\202$\301\324\364\215\265\276k\254g\274\225\004\373\250Wg\r\2225w\235\236\307\254?\354\243B\031Nkj\013\2308\034\250]2\253\323\263\027\376\302o\034\3458n;\023\301n\347\256.j\260hY\243\305F\342*\333\356\264\230K\034\257\261\332\016\362y\233T0<\245+v\367^\tr\250f\2105G\244\351\237]\3539\310z\236Z\317I\353\002\254\306Y\370\013\207{\237\334{\007\270\251r\272\301\326)o\361\235\323J\250L\250\347\025S\327\240\241!\326)\317\017+_\366Q-\340(_\371B\301\310\r0V\020x>%\345@\253\262\003\r\243d\210N\251<\177t\262\3409Auz\036V3\226\302S8\312g\374\344\f\205\243\374\347y\257\362\336\373\013~\237\023&\333\261\367R%\321\272"
+	.string	"E\006|\306eL\306kP \240-\231\273\027z^\362\373\316\230\tC\355s\310\2759\260v\272\250\205\235\331\335\373\374\221@\002\tt\326\202PrcM\217\302\312?\"\254\034\306Cp\024\001\036{\362\344,-\375pv\372\r\326\377b\037\340\353fp\237\365\214\200\312y\214\200z\236U\t/a0\273Dr^\261{\237=<J\234v"
+	.ascii	"y\362\334\230\335\025\251\321)?\271\311\371\213\275\216\"\203"
+	.ascii	"[\344\327]r\357\345/\f\234\367&\371\213G\315\275I\036f\006\230"
+	.ascii	"\031H\223\\\t\031S\323\217X\337+\211'\373\250+\227PG\374\275"
+	.ascii	"Tt\022\277\345\255\027\335c\340"
+	.string	"\201V\337\363w\027e\333HI\377N\333\376O\323\375s\020\315?S\365\177n\312\373Yk\r\337\375\304\337U~\356\200QH\363\024\367\371\273L\212\f2\320\274\375w\373\257\364\263]\021\377\277\376{9\330\377&7\340o\257\003\206\324\375\207\340o\033?\307\3603\335\317g~6\363s\231\237\311\374<\367\263\230\237\303\374\f\367\363\333\317l?w\371Y\355\347\264\237\261\374|\345\347\263\237\247\374\\\366s\224\237\243?C\177\006\373\231\311\317]\377\245\374/\373o\306\365\363\221\377\f\374\215\365\363\326\317C~\256\3729\352\347\247\237\235~^\372y\306\317G?\337\237{\370\271\370s\321\317\303\237\207~\316\341\347\026?\003\177\376\375l\303\3172\374\274\302\317)\374\214\300\317\"\374\034\302\317\023\374\247\362\363\007?\347\374\354\301\317@?\237\370\231\202\237#\370?\346g\005~N\340\347\002\376\313\360\377\200\237\007\370?\366\263"
+	.ascii	"?\373\374\334\363\263\372?\357?\230\377q\377\255\374G\373_\345"
+	.ascii	"\177\006\377\265\374\307\311\313\313\313\373\323\033\3764\310"
+	.ascii	"_\300\\\321h\223\201a\2212\221\343u\301~\214\275\311z\313&zG"
+	.ascii	"f\013\272\202\365\020`\035\246\336\313O\347\022\263\233\364\327"
+	.ascii	"\033zh\207\255\310{\215\360\240\230&\376v\362\016\243\3431*\002"
+	.ascii	"\004\312\r\035.1nAtz\233\"\353m\252V\365&\231\367^&\233\347e"
+	.ascii	"\032\345\234m\230M\374:l\271\201\377\351\265\177\0015\334\213"
+	.ascii	"\244bwf\335*K\336X\340\336"
+	.string	"f\355^\245\025r\004\253\246\322\312\306\022ju\221\312,d\017\363Z!\227\320{{\256R\211<\301y{\226\320\333\274GlM\276O+\344U:o\317U\336\344\002K\245Us\tM6{\226P\253\346\205Z]\022W\231d\312P^f\317\205Z\221\271Pg\223\304\022\352l.\241VA\360\232e\034U\263\314\356\252\212q,\225W)I*\311$\261\266|:/\334\275,\006\3432\033\270W\312\311\204K\332`)FkJFO\222N& \311\350\312y\225kK\"\316{\211\030\t\335$\f\220\317\265\213\305k\310\034R\027\t\306\275\005\334\347\275I\367\"\371\256\335{\221\367\336\036S\352yo\024\211\245VR\322\275P?IW\ni\006\343\336\026\213\223\322\\B\257\234>\2630\250\326\215\361D\262\326\205\263b\256Pd\223\213df\325j6\225\361\272y\023\373R\372\262v\327\217\r\023h\027!Z\326g"
+	.ascii	"PG\224ZI'9\313\022\305\326i#a+P\330\232O\216p\264\271>&\347\336"
+	.ascii	"\003F\370\300Q\345\245\323&\322F\326\035H\236L1R\344i\n\033Y"
+	.ascii	"\221\276\342)& ^\235\236\256\267\376\337\340\360\b\362\026cK"
+	.ascii	"\b&;\032E\250<\033\306\220%\036\235\276\207\360\223\377\267\227"
+	.ascii	"\304q\027\327)\230\316X\336\227\035Y\347hg5\020\376\272H\036"
+	.ascii	"7\031P\023\250J'\r\247V\220\006rc\005\206E\327?r\344\314\216"
+	.ascii	"\230A\370h,\235 [_F\235\366Pb;\303\353\364)\323\272\243up\264"
+	.ascii	"y\364\325\223%9\332j\007\331so\216.\255{\237<\032G[\361\032\324"
+	.ascii	"\3632\201\260\244\n-5\002\373\262EMo\345\326[8\253nKC2\"\302"
+	.ascii	"I\245VcJ*\332RM\365\363\274L8WeTD\354.\2239\301\324\017_\331"
+	.ascii	"\n\323\326\265\336ju\224\316\2153\n,\331c\355 \236~9ul\362)\255"
+	.ascii	"\254\323'\016\324\022\n\023\033\020\254\3123\262%O5\226\034\271"
+	.ascii	"`:}\327\020\353m\345)\225\351\264\233|o\247\004\240T1\353\264"
+	.ascii	"\307\324L\307\316\240\24019\332\315^z\372\274W\254\233\275l\245"
+	.ascii	"\035\345\3632\t`\224\305#g\203\207S\232\336\336X\337JI\355\274"
+	.ascii	"W\254\223v\274-;\355\031M\203"
+	.string	"\243&\032\351F\371\274\320\033/f\246\304\230\326\263\t\225\207M\250(|o\031\\Tp\240\351\3646)F\303\250\342\341\025\326G\034m\030\255l\030\\\326F;\310g\003Kl\240q\351\240a^\2634}\263\255o\243\263\034\016\367Bu\306Py\006\351\264\221\276w\022\204\0379\222tj\373\346\251S`\3104\361x\r\253\341;\216r\036\333\235\321p\032(\317\221a9\243\266\037Z,f\f\313\331\247Vo\210+ s\031\224a:\365\312\307\023U\036\027\301rK\275+\254\247>\352\r\227PY\211\357\366\tO[\031]\026\331X\223\245&\"\235\336\216\375V\314FQ a]a\037\025'\314w;\304\362.I\247#\234X\350\016'c5:\275\205\376\366\313\202\371\220\207WD\247\207c\037U\347\351\273m\242\2066\347\325i\216\227e\002\027E\344L\247\267L~\273\304v\355d\321aE\251Sv\262\217\032"
+	.ascii	"\227Pm\022\337\255\022\0342-xB:-a\221X\256\234+\346\027\035\235"
+	.ascii	"\336n\261G\2249Z\260\264\331\261\217j\213\370n\215\254yygX\235"
+	.ascii	"\356p\tuk\253\303XG\224\322\225\235\266\0353ht\372\033)\034\267"
+	.ascii	":p\330!\326K\316E~\335\245^\031\026\037Qvw\te\002\247\t\215&"
+	.ascii	"]\200\334\016\271\325B\221\301\305\254\\F\274$;\265B\276\003"
+	.ascii	"\2256e\256\323\333 6\353\277\031\261\245\003z\004o}\005_O\315"
+	.ascii	"\037\027\323D\304 \221\351\324\372x\025\2507;\036XjWmF\235\332"
+	.ascii	"\035\226\007G\257\305\366\370\316\224\030Q-u\353\201\340"
+	.ascii	"kQ\355\325m\216\377\346f\n\225\016\2531\353o\255\376\233\336"
+	.ascii	"\230\227\033Z_\326\257lRR\266\312\207cG\024W\216W\032\266.\252"
+	.ascii	"\333*;E\004\n\312F\005`\226D\206\227\252 n\243t\350\234\2541"
+	.ascii	"IR\325\226\324\244\001\362\364d\235\270\264\320(\255\3008\233"
+	.ascii	"M\353\364\343\264o\3145g\270zc\322\3400j\272u\352\315\350\372"
+	.ascii	"\321\354\3242]\214\332\345\310\221 \253\023\022\222]\272U^*,"
+	.ascii	"Z@p\241\361T\272]\332\211\221%\303\255S\233\224Cf\246\255\016"
+	.ascii	"\312s\344\216\206\227N\277*c\304\2603~\2346\314X\025\232\035"
+	.ascii	"\227\261B\"\303\312\270\235\321\373\241\246\203\251S\273\354"
+	.ascii	"\264\243-5\316\236\335\372\244M\332\243\037\247u\233[s\206\353"
+	.ascii	"^(\023\326\312\022''\253\274=\322Ab\006d\254Skt\271\264\016K"
+	.ascii	"\031gbFX\235Q\224\273;{\305\250\210\330\341\370\250\322T&\357"
+	.ascii	"\366\276\312\r\220&.]\275\206\352\313\351d\r\036\225\0256 S\352"
+	.ascii	"\035\2173\245\232^\312azQI\222\344\3149\332g\032\215\tg2\351"
+	.ascii	"\300\221\271\365\352\n\325Q\247]\327Ep\024\202\266{\323\361\334"
+	.ascii	"m\222\317\373\354\037x\321\336\220\365\f\201j\363\362\030\002"
+	.ascii	"\265{8\312D\273\f\313\361\327]\032!\343\246a\262\273\367\312"
+	.ascii	"\004<uF\246~\320\315\315u\330\017\252\2742Zwoc\306\364\263\350"
+	.string	"e\003-E\223e\206e\026&\332a\232\t\177\335&\016\230\220'*f\262\013#\202\311\227/\035\227f\2636\303\013\354t\35786\"YcA\332\332\372\215I\017L\026\033n^\336o\275$4E\334N\333\255\323\230xJ\311N\233\210W\341\031\002\r\f!\224\214%\265a\335\350\322\305M\210\026\357\260\313S\221Y\2624\227\365\262\023$(\0236sP\250\021\2657\027V\323\365C\254\323\326\322i\226\006\327\0264m\013\216V\224\031\274\036\275'\2434Vl\306\240\241\365\0250<[R\236\342\254\274\2574\2302]t,gsU\027\246\f\313zF\302\r%\332P\232\312\3152\275\0027w\231N\023p\025\0352\273\036}\366w\224.\353)9\316{\225LrVBtJ\345\307\016\271A\203H\247-\305\3676\263G=\220\230:\205\200K\250 \364\2366gk(\320\240\202\f&\220\360C\341\004\027X\370\231"
+	.string	"\303/\006\025z\206\302\340\n\027CAC!P\321\350\002H\200\241!\027\303!q\330;\376\202>\b\215*\017\304\242\320\2218\354\261"
+	.string	"\006\207\322c\320H\024$\002:`EpH\005p\210\202Q\205`\321\305\021\030dA\302X$\032\207Ac\357\030\214\2418dB\213\241\260x\214\201\207\203\031\202Ga\261\006\234\013\235"
+	.string	"\036\205*\0208\006S\350\001X,\222p\024\252\300I\241C\020\260\250\304\361\247\201\217\347B'\202~A\"\341q\350B\001c\013\340P\212\026C!Q\021\210\023<\002\2171\034\203-t|"
+	.string	"0\222p\024\016\205$z\030*\n\302\3203LA\3000E\220\b\330\002"
+	.string	"/\004`\f\366P\302\013b\t+\206B\026;;\026\2348\026\201E'\216\301\024|\036$,\006\207\301\026\3531\320\240\002\r8x\321;\007\036X\340\201\005\3529\360\300\347\363@\003\337z\r|\366x\034\246\360A8\004\024\026\203\306\035\242\340\321\330C\f\006\034\217\027:\301\302\205\n\"`\260x4\002\r\211DD\304\240\004V\f\203\326\370c\341B\205Q-\036\213\354\217\306\022\202\300\234\340o\205\n\306\237\016F \321QX\302\013\242\212\234\343\017\305\005\253\361(T\221^\b\250E\021\001/\210%\020\205Ca\021\211\013\235"
+	.ascii	":\n\265\020\016\025\240\023\\Ad\241\030|!$\272\031\"\022K\370"
+	.ascii	"\331\254\b\032\213\301\035\202\305\237\221\007`\017%\216\303"
+	.ascii	"`P1X\364+\022\217D\242\001\210E/\202\277\"\341\020\013!#\260"
+	.ascii	"\030\264s\241\023\306_P\021(\210\205\361\327B\310bH4aH\024\036"
+	.ascii	"\201;\b\217A$\004W\020\211\004\360\241\270 H\004\034\3760\370"
+	.ascii	"\025\203F\027\277\027D\025<\307\013\021pbQ\260\bt$\022\213@8"
+	.ascii	"+T8\016\203C Q1X\204c\374\035\177\034\034\207B\027\275\373|&"
+	.ascii	",0C\013)\254A'^\020U\374\212\214D@C!\220\b(\250h\004:\361\263"
+	.ascii	"B\205\027D\0256E\240PP\032$\002\266\360\202\250\242\267Dc\343"
+	.ascii	"\350\216\214,\305\215\2463\030\366(o\312\362vJ\3064\207%E\371"
+	.ascii	"T\361\266H\035\0315\223\0352(Z2\031\225\"\253\340\234:\220:\265"
+	.ascii	"N\253\233R\226\\\336\2205\257<\254N\255\032\013\204U\323v\215"
+	.ascii	"\305\273Us\236\036\034\3272\251\336u\030\231$u@\322\314\250\233"
+	.ascii	"\022\202\246\265\032J\335ubg\227r\262\324\234\244\025\321Tzg"
+	.ascii	"O,\252:\272(\034:ftj\351\276\242\364\3601w\306\314\2579\304\315"
+	.ascii	"\232\021\303\013B\203\213-c\311\344\334\265\035\226\314o\213"
+	.ascii	"\330\271F\272\001%\327\351\347\276|\267r-DL\213\2261b\330rLq"
+	.ascii	"\353\364V\314o\301\3300;kF\214x\351\224\227\354\243\366"
+	.string	"t\371n\343FD\231S\262\364\005\216'\211\216\034\026\356\267^\354\033N\023.j\220t\312Z\354\243\n@\204\357\326\215g*\013\t\325\251O\033\033\035\021iM\235\336\262\375\335d\273\270E)\323\243S\016\254\370n\327\272k\307\322\207\345b\325\234\316\252\267No\325~\273\305\246\261%}\370\350\224\t\320\222s\306\364e%\213\305B\027we\261\374\326\212\275\242.\225VD:\265\200}T\265\212\357\026\315\3025\315jtjC\345\354\210\271\345\250\323\333\263\337\206\331)j\236\2203H\235^\n\024\337\255\031\216\322iLJ\231M\223e\235-\373-\024\033\305G\215&.\235^\214\003\202\345\250R\0011\207\342\030c\204HdD\223$\031\016\302\n\020\004\302a\024Jf\007\022\200E5\316)\350\320\214D)\244=\003\376\022\034\222z\n\262\331Hg\021,W6\302\351h\3028\372\374\023.\n\nu\202]n\313"
+	.ascii	"\247E\300\314\261\035+K!\326\263%,\233\0249\021\020\374\345\345"
+	.ascii	"^\367C\310l\363A\370\345\334[U\227.i\255,\255\017"
+	.string	"\n\313\214\362\227\212\324h\034\222\227\256\227\227\200BB\224\220\tQt\243N\343K\257nXa\366\353\270\267\327\240*t\033g\312\233:5\237\027=\314\016\321\341\264|6\034\300\013g\233S\\\202\035\353\362\2334ZC\272\352\364\020\276\347_\366\334\337\247\243^Z\307\231\260\3231\234\337\2236_\223'\261bG\224\263\313\307\023\177\3639\261\200\034w\223j\335\214\036)\340.\\\352\016\233\345\376\276\b\021^\026\025\226\204\rM\3324\232\232[O\322\262,\246\201l\255\231\205\265\037#\326\204\217\034z\215!;p\256\n\f\212\221\343\270\342\315\264G\215\261E4\341\275\233\356\225\226\302\371\004(\234\360\272\230\266\237\376\013\212\301\ry(\310\222\3277V$\206\2558\027)\333\376\366>J&\026\221\244\276S1\302\304\300\361@\002\007H\n7(\211\270\224o%\037\201\025`\214\334r\313(z\224o`~\343'\370\341"
+	.string	"\037\270\242\304\341\206W\035\306Q\024\203(\3167/YJ9\260\313C\2601`Iy\245\\H\252\201\273\3553\313\\\322G\2631"
+	.ascii	"wF\251Z\005\032\241\327L\027\373\013VJ\202\"\244\240"
+	.string	"\271\26423\201ft2=[\232\354.\213\204\002m\201\206%\270\310\276\252\327\n\026i\356\277\335\272\210\027\217\371\323\332{{\231\271P\270H\366}N\024\311%pE \r\212\325\030\024\317l"
+	.string	"\246m*@D\325\274\300\355\256\0046Q\272\031 \030\247\001qU\313\224\273\366\327%\274\331\202!<\035[7)\353\030\341N\267\032\032,i\231\275\231)a"
+	.string	"2\034^\235,\001\242R\300/\317\003HYh\013\220\376\216\\\324l\210|\f\211 \311U\0370#\304#\037u\367\004\324:2\\\331\017X\355g\266\024\\_&\351\334ih\025\207\\\021scT4\034\340\304Z\223\252?\235\2667<\037T\3409\236\303\343\004\345\f\340\260\244z\343\372r\277\243U\206\031\2755~\261\360\321e?\265\003\224\216\357\265<8\016\275\260\205u\007\020\2265\306W\224g\227\026\307\211b\303\266HZ\223(\314=\027\200\330t]\354\222\230\206gO\272FP2\251\330\321\007I[\313\330bj\244\301\375\272\367Y\301?\236\022\361'q_\232\007\257#@p\230\335\240\210\314\216]\331\257\023\375VE\205\316@[\233\001\031\024e\200\244\r\026\242P\363\024I\026\017J\250\311\031/#\236\374:\r"
+	.string	"\"Ah\227G\272\002\3167\210\225\224]\352\325\210\027d3 \352<\202\0241\377gO\034\224\2157\252\227\\^\220\221\344 wt\026\201<m$\271\302\004\003|:\035\256*\230\255~$R\250\022~\226>\360\216\347L\255\244Dv\340\226\274\316\035\252\221\345\240(s\272\201\364\273\227\013\023\277\207/\364\2711\204o\304\241\345\r\335\022\327%\356\022en\321\272aYqX\300\020\"\007\320\255\0049i\017\\S\250\374z8\317n\004\303/]hOD\360\312\247I,&\375:&\266\222\216\343p\213*\376\270Y\244a\233\020\275=\340\202l\bF\206P\n"
+	.string	"\355\0363\017O\025g\211\323Y\241\303\375\225\375X\233k\314\204\267DR4\241\221 \321A"
+	.string	"i\f\210\315Mf=$\351\n\3661\250\371F\263\225\017\235\f\340<\304oh\017\007\374\307\322"
+	.string	"\b\222\303\364\031\373\177X\215\374p\223;\2064mj\002\236\234&bb\360\b\330): \355\341\275\0010\217\2670\227\377\n\221\271\025\177\330\002e\361!\256\216\f\305y\n\322D-\354B\322\210\202\343\033\264z\200c\314\013\t\026\255\376\201\206\344\375l\020w=g\333Mrh\353\330\333\300\034\355\364%\213%\265\235\376'Z6&\033\245\222\003X3\211%r\221\373\016C\210q\222l\353\221M\214\311\302K\325\313)~\006\272\336\217\3127\230\266?\b\245K-X\206\206{tR\230\266F\216\316\361`\240\034\330+?\353\214i\230<\370L\024\340II\002\327\030\361\322\225\031Ztxl\305\371\022\223Y\377\252\314\2058\372"
+	.string	"\202\033;\007\375N\361\006<\260\252P\330\332\202B\342o\315\211\201:"
+	.string	"\366k\022<es\007\177\214\317\212C\354ey\367r\230\361\202\307\013}?f\272\357\317\277t\027>\240M\317\253\2111\260\336$\240\255\\\206\305\275\361y\001`b\263\275\346\273!<\330\373\356\331*\377\264`\231y\237\221\250\314\231\342\234mo\221\357\216\024;5\277\226\2035\317aHs\245\314\024\243clnL\017J\373%\304^\350\207|\246\036\207xn\234\325"
+	.ascii	"\356\214P+\372\221d\244\363M\3738|\021\361`\337\256\243\360\305"
+	.ascii	"{\356\325[\264\033su\0312\032\204\030\002\377/\362\031xl\325"
+	.ascii	"_\345K\021\2576\002#qb\317\205\307\201-\301_\371\347\332\356"
+	.ascii	"\256c\224\017\271ol\345=+9\271/\213\003\347G\364\216\330\034"
+	.ascii	"\270Va\333\234\241m\334\013\367\007\244N+"
+	.text
+	.section	.gnu.lto_.symtab.c5c9869bff8dc476,"e",@progbits
+	.string	"findBoxByBoxId"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\001"
+	.string	""
+	.string	"findBoxByPermanentId"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\001"
+	.string	""
+	.string	"serializeBoxNameFn"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\001"
+	.string	""
+	.string	"serializeBoxPermanentIdFn"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\001"
+	.string	""
+	.string	"serializeBoxReply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\001"
+	.string	""
+	.string	"initActiveBoxIds"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\001"
+	.string	""
+	.string	"getBoxIdState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\001"
+	.string	""
+	.string	"packFlightModeFlags"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\001"
+	.string	""
+	.string	"modeActivationConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\001"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\001"
+	.string	""
+	.string	"pinioBoxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\001"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\001"
+	.string	""
+	.string	"bitArrayGet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\001"
+	.string	""
+	.string	"sbufWriteU8"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\001"
+	.string	""
+	.string	"sbufWriteString"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\001"
+	.string	""
+	.string	"bitArrayClr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\001"
+	.string	""
+	.string	"bitArraySet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\001"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\001"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\001"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.c5c9869bff8dc476,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1541 @@
+	.file	"msp_serial.c"
+	.section	.gnu.lto_.profile.31ed5a8dd7a83378,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\003"
+	.string	"\n"
+	.string	"\f"
+	.string	"\023"
+	.text
+	.section	.gnu.lto_.icf.31ed5a8dd7a83378,"e",@progbits
+	.string	"(\265/\375`\311\003%\017"
+	.string	"\006QA;0\217\323\001\240\330\031\376b\371\374Fq#\370g\305{|\016\036&\215#\264\261T\352\231\033>\311\300\300\300\300\252\240"
+	.string	"#\b\305\236F\373\366\037\221\210\210\210\210\220\275\367J\224\344\016,"
+	.string	"/"
+	.string	"4"
+	.ascii	"\333+\227q2\022\322}\355\364\331\373\267oO_OO\017\022\244Z.4"
+	.ascii	"}\315\177~\315d P`<?\377\233`aRM\317lT\347\334\240b\254VL\256"
+	.ascii	"\307\036\033\017*\313\336F|\366\201\256\004)\205j_\3430\374\265"
+	.ascii	"\326^\360l?\2179\305\013\037\032\"\264\337\275\317\275\037\b"
+	.ascii	"\023/1\257\277\335.\033\\.]\237\371s\360\221\264R:8MA\3042\332"
+	.ascii	"\310\223\344I.\350\220C\251D\343*\\3\244l\374\030\216g\317/\330"
+	.ascii	"\341s\002\263;\n\030Ke\244\247\002g\261\302\240\030V\236\311"
+	.ascii	"\257R\202\324\241\247\230I\304\001y\256\bVk\023\363b\215\304"
+	.ascii	"~\377\331\211\243$\205\037\350\001\007\370\347\240.w\250\201"
+	.ascii	"\256\240\222\024$\005)f\r\200\002\"\242\252\016\022\200V\031"
+	.ascii	"h\032c\025\315$-HA!\323v\356\201\234r\226\214&R\247X\262q\031"
+	.ascii	"Q\352\n\354\224\371'@,g\251\370\220,&\326%\357\0168\210\361:"
+	.ascii	"@\004\032o\371/\037\003q4\243pQM\232\3318\374\364\t\346o8\220"
+	.ascii	"\225,\321c\254\376\"3\251Ou\\\271\216U\2709\373\214eAg\204\232"
+	.ascii	"a\276\334*\336\256%,4\325\263\256\036!\363\r\313\367\205\225"
+	.ascii	"\r\004\205\234d\272>\341\006\321\234\257\317\305\350[\355k\\"
+	.ascii	"K\341\260s\030\023\304\314-T>y\024\220~\264\266\265\247\375\266"
+	.ascii	"\313\347\205\005s6\007\271\356\3367\315Q\370\275e9\307j\211="
+	.ascii	"\364\340\204yn\306\031\365\367So\\\365\322dD\375\344\372\025"
+	.ascii	"3"
+	.text
+	.section	.gnu.lto_.ipa_sra.31ed5a8dd7a83378,"e",@progbits
+	.string	"(\265/\375`\267\001\325\006"
+	.string	"R\007\024\031\220)\351\377?\361\241\334\335\335\335E+7\240\357\022\372\376Jb\333\226;\245\352T\220K\022\2138\274\030\276\240\204RF\f\372\201+\365\246\0248\273\335\233T\215\315\324\235\343+9\352Q\220=\215\307D?\nhA\0333@r\375~\316E\212\004O\250\301\335\033U\353\033\300\002!+v\021P=BL\316\202\202\024\322\376\031e\220\230\367\234\215c\343\264\225\205\037\333\245\323\2108)\033\366\031\20757\3617\216\314\350Q\242 `#J\346U\001\2308sRt\246\302\207v\240{\322sD/R\336g\2033\227\035\315\232v\345\f\"a\207\241&\230\240\377(5\211\213<n\b\200(B(|~\001\036\266z\263\"h\256\367\203\035\345\n\204\213Q"
+	.ascii	"=\351\307=\246^\320"
+	.text
+	.section	.gnu.lto_.inline.31ed5a8dd7a83378,"e",@progbits
+	.string	"(\265/\375`\344\017\3659"
+	.string	"\nKp\017C\200\336I:\023\214fR9/\3129|\351\354H+L(\236\355\304\270\250\034\341|\303\247\227\257T\377=]H\376A\217FI~\022l#T*\273E}\340\202\263D\257\230V\260\n\375\266\033i{'\231\002\324"
+	.string	"\333"
+	.string	"\353"
+	.ascii	"-j\255Vv\b\027U\243\030\322\016\276:\264\335\255\033\034\304"
+	.ascii	"\026i\t\033x\305\204\351\300\341l\301\354x*6\243\271\301\227"
+	.ascii	"E\372\n,\213t\025\275!!\036\335\205\272)\357\255r\267\312J\210"
+	.ascii	"\364)'\360F\275k\317\222\033{\306:+\005\245m\2429$\307l')\357"
+	.ascii	"\264Zko\247\350\367\354tSS\277i"
+	.string	"\307j\255;\033\352\274\235\211\306\244\031|\355\2421\351\005\337\257\2457J\016\251\265\032\035\311\351O\177.I1gZgkj\247\253\305\265\021\231\\m^wv\366\223\344j\363\262\263\323\331\036\277k#m\025\227p\374\324\336\013%\253\240\3252B^\333\311s}\377\351\265\326\032\332R\362GXY\236\336m+\370~\275R\022,\254,\017\317\016`\221-\263\312Z\307Z\177\223RJ\305ZI\334sNKSJ)\245\224RJ)\245\324\224\356\356\216\220F\262\202s\326\342\254\300\236E\213\300o\201\223\003\303\200Xk-!\213$\221;2\344\321\343\350\217#\035\375c\222[\312\230\221\351\371?\377\007\224F\322\300\244\204\376\321\237w\267T&\375:\216\265\002C\377\377?\347\234\223\316Y=+\223$\353\0022\206\310\237\025(\223\264a\023\333\231\322SZMC\237\326%\311F\306\355mZ\006!\363\023\204h\351A"
+	.string	"My\302\363\257V\261zI\024+\323\335\260\314\310\342\371\242x\021RP\027\r&\353\221\351^j_Jx\300\327\330\341\246\245\363X\201R\206\235\2575\035\035\177\325\377\335\277\032\002\247\377_-q,2\354xYCI\r\376\352\b\355\206\263\2417Mm\001\364Lr\207\030Y\333b\030G\256\255\260\031;;\352.\324\342\334\026\f\331h\210\364\204\2645\263\021Ne\t\257Z8/\266\nJ\030\341S\336\021\371\322\372sa\203\320\234\242H\305\020;\207\260}<+"
+	.string	"L\353S\021x69\264\214\335T4\025\237\036\254\025\353\200\351\370kz\227\034\260AB>\035\177Kr\013\326\334\216\233\216c\323\220i\372j\352\364\371$C\tg\3106\204\357\257\266i\013\341T\257r\022B\370\324w\336\023\362J\b\0259\313\371\250Rp\307\361@\317N\207z\2167(=zg\336\240\364(\nmi\004_\207szO\274l+l\306\003\357x\224IOZi\313J[=iQ\352.\004\301\275\031`\243\270\215#x\340.\314\007\337\365}WzSH?_\334\372dp8]\244#\221e\003~\026\332\236\270\243\373\212Y\023!>\027X/\320N\2172\306L\3548\244(\321\232\026\375$\375\310\321\023\234W\367Z#\363%\001\206\357\364\205\357\223\276h6\251j\253\274\302\244Sy\027\b\207\2155\007\216\b\330B5\350\001WWZ\332\314a\315\321\2313\262"
+	.string	"q&\315!\232\357\311\017gV\nB}\314L\320\215\277\350\202\225\205\244\311B\026\0231\036V\343"
+	.string	"r+\r\f\033\276\233+\256\315\313g\237\225\202Cw\236Z\255\212\244\016\366d\216\016\321"
+	.string	"l\257\217\2672B\373\204\314\022\213\363\306"
+	.string	"\205\274\022\245\313E\005\027\231>\375\254\306\232\257\001>E\303\205O\037iQ\264J\360\335\265\255p*\033(\275\036\302\n\2372!\345\334\300\03192\221"
+	.ascii	"j\317\271^\nu\226h\242\270\231%B\322\260\210\272\2171dH\002\230"
+	.ascii	"\322\027\341h`L\232"
+	.string	"\302\251|o\212\227E\311\262\026\201\274\250AI\245FDDD$I\222,\007\341\004\204Q\306\030\273\362\022 \025=\312jjl$Ij\354l\007#\017\007(\205\272+\352\265\270\203\204\303L\314\200\tVAQ8\237DB@Meg-8\223A\341\343U\221\311\225\263N\255yT\267H@J7y\356\240\222\335\\M'\327-\020N,\225\322;7r\220b\236\t!\373*5\033\240,\333\300FC\214\262\214\b\312Au\340\240\224\313&\376\305\025\214D,\355\372\333\321\261\030\254\213\250`!\3252\375fc\202\236\316\274:\246\333Z\034\374\255\013\235/\351\270\267+v\363\311A\2023\346\206\306\021\376\375\"\252\261\326\004\221\250\350FLl\274\343(kg\202\031\262\265\257\203\3576\231\224&\254\032tTl\r\017]\322\232\242\004@\372\252\225\265d\3428\2400\260\372\272~\221\233\350\261u\357xJ3=\335"
+	.ascii	"\375\340\240\237%\325tA:\317\221\001En\267%\013\033\215:wq\357"
+	.ascii	"\332\344h+\305?\275\314\254pP"
+	.string	"\267\213u9\347\210\252h\206\030\025\307\267\201y\260}\276~\232(\323W\334V\365\212\312=Hlm\\\321Nc\253\034^p`\373\243\027\023\217*\202Y\245\004b\211\300\202\276\256\221D\320\204\325\355\314\231\332\035$e\023i\301\303\221\215\362\220 \024\251m\211\364\375\247\023!0\2468$\275\360\021\225\n\201A2\3073\360QW#K\242\364\240M\235@\364D\227\330G\211\256`\245\225 \377\264Dzt\331\026zh\362\244\265\325\337\b\206\267\241u\230\251\321R\226\013\371B`L\036k\246V\271\306*\bG\025s\317\340\232w6\227\n\350\376\217\033ep\005\210\021]\351\261N\210\362\3017r/\341\353\215\316\372i\376\001m\200\240x\306\bu\241\266\f\271\270\254\345\024\204^'\364\016eXd\3179\257\b\333\225\231=\244H1\315l00w\3656\fve\267\271\314\343\236\305\206\303\013?3\203\021\316\306"
+	.string	"\317\224s\231j\375\\\243 \301\355yD\310H\235x\255f\266\330\316\023\306\005\245.dC~\206\234\2515`\346`}\313\330#.\314\b\024\004\021t\367R\036+\240H\373jbG\267b\320\225\355n\250\270\203\230\332\365\267p\003\215\376\302\r\334\314\357uA\340\217\221\234!3\3454c9\375(8\201t\367\227/;\0029t\177*\031i\2658\206\362\354!`\007\363\251\356n{L\302\3762\224\337\035\027\323\371K\320_\026K9'\213<9\234\240@\376\375:+\206f\033\300`\020;\023?\017\227\222\346\366\344\343\276\036\212\267\237\301\013O\356\215g_G\354v\303\324\322\003\3575\t\035\277"
+	.ascii	"\334vK\t>\353\313=\342q\353\302kA\223j\233\337\305\304m\362Y"
+	.ascii	"\302\205q\230\r{\266\233*\244\302\312\304\204\263l\nSd/\257\205"
+	.ascii	"-\013\002\245\f,\370h7\214 \311*5cs0\243\374w\355\032\300i\300"
+	.ascii	"\n\275\023\374\0357\033\251Gs\333N=\232\333\342A\37058n\215,"
+	.ascii	"\n\024\315\345\217\265\343\007\202\335\201\205P\302q\237Kq\376"
+	.ascii	"\344[<\335'^\346\003\373\307\341\244\020\301IA`V\004CO,\036"
+	.text
+	.section	.gnu.lto_.jmpfuncs.31ed5a8dd7a83378,"e",@progbits
+	.string	"(\265/\375`\375\n\025\031"
+	.string	"V\034T< \217\222t"
+	.string	"L\320"
+	.string	"\310 x\341S4\273\242\017\322@\350\274O \206}=R\273\231\233\006!\320\001\200\001\206#\223\f>\366\301e\002\030\212)\3631\306\200\177{\254\335\215\020\231d;"
+	.string	"D"
+	.string	"H"
+	.string	" \356\274r\351\302\247\r\242\222\2244[X\3117\227\274y\313\310\240'\322[+\372\3768X\247\247K\342K\232lH_=\214\257\212z\253\227\371\356\321c/\352\221\374\212\034\304x\021+v\032T1\343\261\021\314k\351n"
+	.ascii	",7\310\201;\354]l\372,\310]\235\001\315\025\3263\2676\020\f\341"
+	.ascii	"\322\276\324m\320-JP\331b\341\274\224\307\313\322\3644\207x\005"
+	.ascii	"\202\276\rVf\246i\232^\345\003\355*\325kD\257\274\242\303T\374"
+	.ascii	"\245\030\324\214\350\303`\363\301\211S\220\270\240\370\021\363"
+	.ascii	"L>\312M\\J?)q('\202\016\206j2t\004Ny(\227\241\237LN7z\366\020"
+	.ascii	"\225\033\260\357\360\3215V\242\362\324\032\242\006,@\376\301"
+	.ascii	"z%gA\317\243\307\351E=\005=\3134D\200\030\t#\221T\031\311\001"
+	.ascii	"\002\242k\357\360:!}\244M\320\333p\220\247\351\237+\322S\037"
+	.ascii	"\340\t\326\217\202\265\204S\322\nV\026w}\326\347\263\260q\301"
+	.ascii	"\002\200\320\250\241\271S$#I\nJ\031\346P\002!CVU\017\022`\243"
+	.ascii	"\024\004\3414\313\031h\030\231\222\021\211D&)I\013R"
+	.string	"m\251\007,\347\tv\330-\0338\311Z\372M&\210\334e\374J\212{\301j=\202M\332\302\312{\205\300\205\321+\277\327\325\233\342\230\013\273\347* \223\244 \2678\355Hb,1!\372`\363\032\177\346J\3372\307n\354\276\223\nEK\0201e\n\ri\236(\371\373\032\232\r\026\316\304\244\205;U\254e:\222,\324\221\374x3\273.k\tYJ\346\310\245<\351)s=\274\202\3437\342\311\"$\33029\332R\fA\037=\330\342\313Xx\375:\225q\232\364\342\312\344\032\341\202\023\341\007W\341\272\200\034\274\214WV\f\277\320\270Q3B+eL\314\206\221`\2344{1\235\247;\266]\274\247\213\272\r\272\350\275 \024^;\370\227\252\352\r\204\234~ma\255\350<\267A\365\322\364\005;\364.\351o\201~\325\206\177\337\376-\245\006\343\232\272s\252\"lU\357\362\245:\301\255\314\302\023a<T)"
+	.string	"\303c\\\260\\\023\fr\245&q\262D\375\251\273\274\362\271\027f\346q9k\370v_\231\t.\2652x\332\005`>\313\330M\242\002i\330|\017\371\247o\274\025\360\033\020@\t\246\221\360K$\245\t\301\333"
+	.string	"\241D\355~P0\240\024V\271g\303v\233C\303\210\274\201\020\326"
+	.string	"\013N\200\360\002a\234U\301\244"
+	.string	"g\375\243\334=38\347R\033\367\303,\221\020T\365\037F[\254\222\240\250\265K\013\036\r\353\240\257j\230;yj\016\316\371']\214O\245k0\233<\252j*\334)\361\031o\323 "
+	.ascii	")\266\26292"
+	.text
+	.section	.gnu.lto_.pureconst.31ed5a8dd7a83378,"e",@progbits
+	.string	"(\265/\375 >\361\001"
+	.string	":"
+	.string	""
+	.string	""
+	.string	"\023"
+	.ascii	"\205\004\001\232\004\003\232\004\004\232\004\005\232\004\006"
+	.ascii	"\232\004\007\231\004\b\231\004\n\231\004\f\232\004\r\231\004"
+	.ascii	"\016\271\004\021\231\004\022\231\004\023\232\004\024\231\004"
+	.ascii	"\025\230\004\026\231\004\027\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.31ed5a8dd7a83378,"e",@progbits
+	.string	"(\265/\375`\025\003-\017"
+	.string	"\226\224D:Pi\224\306c\214w\r\253\332TS\377cUUC\200[\tuZ\343\323\354TD\345\346\361F\276\216i\312\242)d\366H\264\020\022\363\021\321\215\320\222F\004\001IH\354\2262\0051"
+	.string	"4"
+	.string	"2"
+	.ascii	"\272{q2\246\320\326i\215\337KHq\316\262\320\343\321\021+T\307"
+	.ascii	":k\373\367\006\235\347\023\315\261\004\240\351\231:\232\347S"
+	.ascii	"\261\021)\330~<}\243\005m\372\275\314\006\350{\026\310\242\273"
+	.ascii	"\326\347\274\202\233m\332\335'r}\214\333\210.@\335\036\3113\200"
+	.ascii	"\272\275\3409<: \245I\t\341\002\324<\200\355\275+\273\004_\244"
+	.ascii	"1\013+\303J\001\004\263\17779;\227\331\231zE\365\f%\232A\333"
+	.ascii	"\\\001EI\332{\022\247\025tWN@w%q\213s\231W4\317h;Ac Xp!\255\022"
+	.ascii	"\037\220\"*\b1d\225 r0\241\302H\343\"\334\214B\0216\r<\223\247"
+	.ascii	"=\0360\177:\250\001=1M\307\004\222\3267\204\334\365\311\313{"
+	.ascii	"\307\002\352\264:g\250QAB\254H\222\024\246\320\001\200\202\221"
+	.ascii	")3\036\021@I\245LH\244$\205\322p\351Q\324\306H0gf\355\211\210"
+	.ascii	"\365b\032\314\333\207\266w\335\325\265\232\003.=|\252>\241\302"
+	.ascii	"O\254x\355\277\316\0342j7+D\352\320?\027J.\227h\020\331A\231"
+	.ascii	"\3261 \315\310\037\370\r\221x\235\177\207^}\004\n\251\270\322"
+	.ascii	"#\341\207o\323\007e\222\321\222l\344I\242\323\332|\245\302i\327"
+	.ascii	"3\210,\263GP\227\335\232\030SE\005r\300(\026r\324\324\326\274"
+	.ascii	"\221yFJ\311y\215W\235\237\257@0\255\205\311\241F\276kD1zh\230"
+	.ascii	"\002\035\251\346\334.$\035\r\017\360NP.\017\311\237\025m\236"
+	.ascii	"\356&\027\241\221n\226F\246r\036\036j\251\231Q"
+	.text
+	.section	.gnu.lto_.lto.31ed5a8dd7a83378,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_resetMspPort.19.31ed5a8dd7a83378,"e",@progbits
+	.string	"(\265/\375`\001\001\205\f"
+	.string	"\346WVB\020\221\232\016H\315,@p\20212*\363\256\320x\211[\225R\362K{V\200%Q\276\214\337\270\265<\234\222\225\034l\2627\242\222\350"
+	.string	"\001*\024\300\330%\344\202\252P!\205\347\330*\032\351M\344N)@"
+	.string	"A"
+	.string	"F"
+	.string	"*\272\267\234|\300\356'\306\305\356D`\020\315\243\347)\351Q\363\017\351\321\235]\343\263\304rft\200\271\261\273\225\222xw\330\371\177y\307\247\342\035N\fv\327\360S\001q\353m\037\260\035\301~\206\236\036\324\021\366\243\335]\353\307\276\313?}\376\361-\277F\320\337\004\210A\205v?\204r,(\302@a\373\033\333\021\264\023(\350\356\342\3714\020B\206E\246\001\234\032\b\b\330\r/\0368\207\366Y\0361V\004\363\331\360\200\266\244"
+	.string	"\377]\241\t\031\240\024\365<\251}\275\205G\302\n\216\250v\205\263\3004\273\273\300_\201!\243h\2348\221\0369+)D\240\300\220'\250\363\236\221@\256jo\027\340?S/@\034\324s\036\215\223\2304\221\"%\334\005a\202\324\254\222\355\003"
+	.string	"'7\371 \023\341\264\314Ag\303<L\022bb]\232\334F:\033VY\270,\254\"\321\266*\244\200\263\216\324*.\313\264j3\367\321\352\307q\006\204\242)\276\332#\017\025"
+	.string	"5\003\220\347\214w\201e\342\t^4\270"
+	.ascii	"\200\314g\025\f\243\322az\367o&\3042\266\230k\354q\230\013N\200"
+	.ascii	"\275\2400\030\026\240B\217;\274h'\031"
+	.text
+	.section	.gnu.lto_mspSerialAllocatePorts.20.31ed5a8dd7a83378,"e",@progbits
+	.string	"(\265/\375`\324\004\025\""
+	.string	"\226\277\337H\200XN:\243\2300\317O\034\307\0237oL\223\025\345\276\307\244\025\305\202\034\004\235{t\212"
+	.string	"\344\250\356\337&g\254\354A&q\263\346L\322\322$$\315\255\344\367|\031\034\236\313y{\273\317_\024af-\331\204\310\235d\320"
+	.string	"\300"
+	.string	"\315"
+	.string	"^\306\3426\374\b\037\311\323\330\207\366T\005M\2053\250_+\030\274\244[\262hw\364/\273\031\373\0260(\276\031u^-\007F\344\206vG\371c'+\236\331\242h\352j\002\335\034\334\275\315\004G9\301\356(7\257c\217\356\236c\217r\2219\fOU\215\230#Z\334\275\027\330:\330W\213\357\371x\251E\317\256E>"
+	.string	"'goJ\224\306\367\316\264\n\353\307\267\300\340:\211\346\340\330n6U}6\253\353\274t\306\355)\300M\213\220\237\362x\016\240qc\211OiU\321\024\307\325\030\257\254\255\237g\316\026\223.?e\325)\324%\214\353i\257I%U\355\233\235\200X\22519\257\254\256\327\264\350\336\313\025\251\314:\327\234\231\305\230\331\004\363\331#\367\336!)\037.0\211\260=\312\223=Z[\250\254\b\223\017\345\th\007\222\231Y\374\311\007\003^\356\275DM\356$\004\037\354(\213@\252G\036\345#\331\243;]\271 e\374\372\375\264#8\363v\244\223\252u\255F\245J\331\374\253\177\3202')\325#u:"
+	.ascii	"\226\r98\252627\215\265\277\230O\264c.\fw\016f\240\037\237'9"
+	.ascii	"\367\374\354\314s\264\363\216\016\316\315\357\315\263\rZ\271"
+	.ascii	"\006\255\354C+\367l\345]\257r\312\253lmetW\371<\363\334i\345"
+	.ascii	"j+?(\351\306\230-q\375\326\274Xuhn\033\312\006\344I\376\263\037"
+	.ascii	"\355g\376M\346\253\361\327\222\250\b26/\226\006\255>\rbK\215"
+	.ascii	"\017\324]\363\364N\220bX=\222\203zz\327\r\264\316\034\351\n\324"
+	.ascii	"s\354A+\364\233f.\212\025\213\324#{\372k\357\215\005\201\"\007"
+	.ascii	"g\325F\3465\027K7\013ey\372mnF2n\003*\277Hf\373\3052k\033x\376"
+	.ascii	"\003\373%O\233\331\bB=\222\247sb\\.\226\3606\niw\231\245\017"
+	.ascii	"\246T\255#^K\005\">\226g\261p^\310`3\330\243\266\037\346\013"
+	.ascii	"\333\331h\377H\307\033~\245\303\356^\252!\276\225\021G;\260\026"
+	.ascii	"\366\350\331\035\347\002lI\306\374\325\225\027<\320\032X\226"
+	.ascii	"\267\275\370\217\262\277\006j\364\255\316j9U\353^\231h\314|9"
+	.ascii	"\373\213S\330\332\30330Tu\216\231=|J\n\2412\"\001PCbp)\210\""
+	.ascii	"\310\341\004Q\351\250Dp\210t\302)\247\311i)%\016\205\030z+\202"
+	.ascii	"%\230(\360\222\224L0\t\215\210CaS\217I(@\201"
+	.string	"\2444\f:\211hrZ\0022)!-\001I\f\235\200\n|X\330\024\034\002\211B\341\020\350k\336w\016>\303\240\310\301I\365\024\\\317\354GX?\252N\363\311\353\276\351\344\315.\001\310\262\362\243,\237<\234\376\251\2605m\344\353^\327tMs\324\252\276>\271\034\215T\371M\367\372f\2574\310\316\336\324\244\374\347\275\367\372\322N\240\353\250\226\3764\2377\335\235\3443\265\351\272\243\332\t\3248\235d>\257\277\370k?\303\254\254O\363\211\376\332\246\223K\316\\\364\361\023aH\033U\033\323\376\242\362_\007U\2501\034\204\214\202F!&\030\221!\031\321j\fP\0021\350\316\266\001\020p8\232\244\220a\f\023$2\307\323yF$8\276\002\376\017q\\\352S\032\301-rI\0175\372\256\021B%\f\234\002\336H\302\210D\263\377\r\351\006\213\233'\037\353lQU\265N\t\243<o\332\237\263\365!\013S"
+	.string	"\272\360\270r\365!\317\366\223\211f\225\n\201-\225\306\303\212\310\205\272\030\320\030\354 \020q"
+	.string	"w"
+	.ascii	"\221$\013?CU\035\222\235\340\025o\206\017\005\327\221\311\232"
+	.ascii	"\260\353\263\246\235\315\351p\b\253Y\3558j\346\355us%\002\212"
+	.ascii	"\023S\240S\005\264\t\205\220v\r\221u\rD\274*\373\372\361C\316"
+	.ascii	"\353\204?"
+	.text
+	.section	.gnu.lto_mspSerialReleasePortIfAllocated.21.31ed5a8dd7a83378,"e",@progbits
+	.string	"(\265/\375`G\002\255\023"
+	.string	"\366\244\201I\300\224Q:h\367\007xI \f\357h\005%w\275\212\356\226\324\004C\217\203\315\327\032j\031\246s\002)\205v\274]\333\327-\316O\367s\365\3444\223\375\243!\230\006\231o\n\021\261\277D\246\177\333\021G\214\020\262\211\334)\005j"
+	.string	"f"
+	.string	"p"
+	.string	")\341\247\307\023\370>\303\017\370>\r\263\217>\346\354s%jtCv\327\244&\254\367\306\373\223\260\203\337\364T\302|\236\037\030\001D\253\305\016z(\273{R\253\361\026\310\344W\262\342\3463\304=o\305\250f;\251m\360J\037\216x\\wiS\233I=\356\tlB\264\332\315%\330\262\273\226\264\232\207;\274m\020\266]l\031!\033S\275\331cL~w\327\212c\227\276\363\207\367\271\301\367\334:\245\245'}"
+	.string	"\037R\216\002@\273\034\222\214\354n\322Hq\237\277\307~\316\327\371\304|i:\220\330\310tZ\302\217>\316\245O3h"
+	.ascii	"{\217L\270*\300\240\334\t\244\3351\345\323,\341\347K\266/\355"
+	.ascii	"\267\270\013\330w4\\\300.\216\321\320\356\250\300\001"
+	.string	"\366\t\365\335\330\321h\314&2T{\202J\236\346\223\037\033\273\231\306\214\023\"B\207\2477\207*U\314\371\230\311\"\266)\\\350\002HT\3042ce\022+b\021\3432b\276O\251 Q\021\221\035?(\006A\017\232\355\f\207\261Z\311\331]\007@\177\301\362Q|\332\202K\236\366\351\273\276OP\345\016\332\215\352\365\272\317![\215\232#32Iw\003/\221\345\322rAH\275N/\252\027\230\023\n\005C\352\005\346\301Kd\265H^\"\313\245\304(\225\n'\225\230rIh\271V&\030\325ieB\211.\223\212\001\263Z)\321\364b\261DSi\334\177\025\307\346y\370\003d7\2432Po\016`\233%\235:\3226*\217r?f\262\310\275Oo\226\371TKz\334g\020\233\020\r\t\231L\222\023E\352x\343\370R\016j- 0\002\204\030\303y\315\370w\fq<\007\022\231@\302\321\324}O\263\301\227"
+	.string	"\013\227\t\246\242\310=$\004\367K\b\276\245\241\r\330wL\367\002\262\304\300\242@\214"
+	.ascii	"\364@\242hS\250\354\341\220\261\240o\336\\w\250\002+\345m)D\260"
+	.ascii	"B\020;a+\3160F\363\236\216v1\026\361\016*\315\365\335z\232\373"
+	.ascii	"h\257\272\342N\333\311"
+	.text
+	.section	.gnu.lto_mspSerialReleaseSharedTelemetryPorts.22.31ed5a8dd7a83378,"e",@progbits
+	.string	"(\265/\375`\\\002m\023"
+	.string	"\026\244~H\340\322&\035\322,8\342r\006Xw\013\2062h\211)\215Q\213+\200n3K?\373\357\277\024\307\n3\257:\266\266V?\233T\265U\244\260\270\0061\2242\036\"\210\352\326\355\343\341\f\001\204\377\273\"\177B\310&r\247\024h"
+	.string	"d"
+	.string	"n"
+	.string	"G\273c\311\247K\276\317\203~\331F\037u\366\265\035\231\237\244\3355)\t\353\271\361\356\344\353^79\225/\177\347\bB\334D\031\354\036'\262\273!2\031NALv"
+	.string	"T\334|z8\307\221\034\331x\204\3108p#4'\304\327.gd0RO;\tN\221(\273\271\364 \354\256\245(\353p\177\267mc;\202-Y\002\327\327>\205pv\310\374x\221K\272\2730\325\231=\302\344Wsl\360>=77\245\225\223\226*\375"
+	.string	"\037\222R\016\003\267]\232%\245%\232C(\356\363\367\\\332\267\337\302\257\031\374x\027\257\373\264|cj@fb='\337\247\307\217t\237\337\013t\237\366y|\232\301\317\005'\257\367\270|\233\302\013\252\361\004^\rQ\214\302\034\"UmT\005y\321\017F\300(\314v\352C\031@\333-\311&\244\n\332n=h\376Q\303\206\207\323\231Y:\251aM\007\214\364a\333\302g\260x\266\333\212\335m C%"
+	.string	"f#)\3501Z\272O\251\236\355\306\202\346\303hI\200C\264\275\341@*\006:\273\353\340\347/V\276\211Och\311\213\237~K\345\r\361\206\323\256pE\201\325\232\200r\235TR*+\247\024\021\r(\225\025\t\256p\305\002q\212\311\205S*D\265PX-\225i%uR\231R\302\226\311\344\200W,Thr\255V\241\t\034\367_\315\331\371\007\364\201\350Ec\236\316<"
+	.ascii	"\304\004u\226\220\236\221F\347vw;\235\331\245\343\024\324\323"
+	.ascii	">\221p\212bD\304\344\222\234\004\244\2167\215\256\344\237\332"
+	.ascii	"(\247. P\002Q\312\252<\317\030\322xK\nm\255!+j\337\263\361\220"
+	.ascii	"\210\005:\364\241\031(+ou\331\025\252\300\257\327\314\353\241"
+	.ascii	"\035:\346Mn\031\336I\2018\2065\210\327\005\303\t\0340\224C1\006"
+	.ascii	"[)4j,\350\315\317\365\0163\325He\203\2120\210\247-\362\2363I"
+	.ascii	"\306sE\220\031\216\033\330A\345\271\276[\231{i\257:\305\235\366"
+	.ascii	"\221\001"
+	.text
+	.section	.gnu.lto_mspSerialProcessReceivedData.23.31ed5a8dd7a83378,"e",@progbits
+	.string	"(\265/\375`\255\036-`"
+	.ascii	"\032\224\370 Q@P\322\032\003\177S?\003\002\234\211\214hB\004"
+	.ascii	"\246,\004\221\240\240I\324\3450YM\326\251\230\264\273\275k\377"
+	.ascii	"\f\341o\202\342\356P\326\366\177XT\331\f\232;\261\037\034U\177"
+	.ascii	"\003v\327]]dz\315\212\252\252\242\215F\233.\2625)\245\224)\245"
+	.ascii	"\024\360\001\340\001\003\002\2553P\353\374\343:\373\270\316C"
+	.ascii	"\327\271\307\347\314\323:\357\370\234u\\\347\017\252s\216\353"
+	.ascii	"\214\343:\013]\347\233\326\331\246u\256q\235iZg\017\256s\007"
+	.ascii	"\327y\246u\016\266\316@\237\363\257u\366\271\316\256\353\334"
+	.ascii	"\272\316\254\353\274\266\316j\353\374\254s\267\f#\257\345\026"
+	.ascii	"s\355\343\310^\025\246y\257\226\225\355\253\227t+\3513\232\027"
+	.ascii	"\306\031\035\2206S\362\201\372\332 {\263:\253\b\030\261\245^"
+	.ascii	"Y\312\355$\314\300g&\201\031\310\314\2527\231\261i^$\227\024"
+	.ascii	"\242\334\231[\254\307Hh\350\b]\363\276]sO\336\227\254\211\227"
+	.ascii	"\334^\231\254q\330^\335\276a{ef\206\222\"\201\217M\266C\205\026"
+	.ascii	"\251ve\026}_2\342\307\320\307"
+	.string	"\216\202z\nAtjbZRJB:\002aTD4$\024\004\364\3433\354\341\331\321\371\220\203#\274\261\251\241\361\320a&\b\374\371\334\226]\325\367#\367\017\213\252\243\240\236\302\310y\bb\026wjzk&\267\2637_\272\342JIHU\332\374\b\204\232\033\0259i\242&j\220\231\023\037R\243\254\242[\035\304\341\252\013\232\013\005\265*\200\230\034\361\037\037$c>\3541\322<E\300\224F|GH\347\203\363\313s\340\224O\031\034\247U!\374\241\006\201)\275\374FUZ\272\255\320IZ\bNiC\305\331\302\234k0\245\017\267aR3FS\304\303\016\035<\276\003\217\231u\031l\001\270\325\\\312\026r\374\317(\351\353*1\355\3764H\333\2528\200\231C\r\354\325\017+\006\213\323c\212\017\026\342R\336\370\265\304\222\211\230\224+\313F\253pJ1j\320\373\276\215\244]\006\026\f\1770X\254\254\245\315"
+	.string	"\025\353\261l.%\016+V%C\243\312\017\0139\343\255\212\367}\331\223XY\315\"\232\371\355\230\271\004sO\b\001\314\r\370\226\003\300\2544\247\263\320?0\340\rv\034)\254\266\\\213\275\306\t\253\033\276\202\016*\235\225\323\302\235=\351 Z\016-\277o\362\024\253\002\234\222\316k!\032\226\357\233\375s1\004Y\272\216\302TJr\352g\313^\324\251Zx&m\277\t\001\313\374\200_A"
+	.ascii	"\304\322sBq\253\251\037\337\226\274\350^\267vZ\250\\oF)$\t\353"
+	.ascii	"U\354\310\2666\"\363\246\354/\247\265\021\031\005\362\276z\311"
+	.ascii	"\246\tv+^\365=ni3G\3209\224q\032Y\346\t:j\314"
+	.string	"\241\"\023\305\353\"\313LA\337P\314i\241\220\351\264\266`\f\210t\375&\267\r\303\035\276\027\350\234xU>\275iS\203S\213\332\310\256x\244\031uer0\034\007\356&mB\031\265\243r\275\243 9\314\376\233\334u\334v\301\033s\334c\200'\230 \307\035\346'\346\013w\234\317\n\027\356..\023-\334[Z\036o\334X\330\033V\270\257\254W'P\341nS\235H\341\236\362?\240p\2639{\362\265\232\001D\215{\255{\212\355\325]\340]\266\2119_\027\336$'\314L\347\276/U/\351\\\370\306`V\261{\3377I\310\273\364=ff\321hS\356\373\276#\270g(!\357\002\327\253W\356\021\330^\373\033I\273\327\f-\3131h\225O\231\311\250\372\247\323i\024\377&s\377t:\215\302\337\305\334J\232+\350%\315\b4Y\367\212\206v\013\020tN\021tF\021t>\301\316&\\\347\022\256s"
+	.string	"\2523\t\327\031"
+	.ascii	"\240\363\210\237\263T\353"
+	.string	",\242u\216j\235\241\\\347'\237s\210\326\231\350svr\235\233Tg&\327y\251uVj\235\223\\g$\327\371\310u\006\341:\033\251\316E\2563\021\320y\350\347,\324:\007\005T\244\320*\237\036\307P$\363|\317\330Nz\325k3o\276\302\366Z\301\267Y\257YE\352\222Zm\236\227\326\3207\271\355\"k\363H9\302\204\322\233\027\226\271\371\265l\212\004~\003\236\315]\315\333\330\025k\336\0276%K\007\325\242\b\321M\r\231j;\323\026\264\202fz\212\025\223\006\264\342i\344\2144\337\"\323\334:\250\026\366\363M\356\270\251!sI\024\317\347\233\354\341\203\337\\er^<<0l\311\023\332\201\313\314w\3302\363k\231\231\024\003\317\202%\350\346a\r\374\240\225\342\373\302\314\236\320*\335H\272QP\2431\374&;O\277u\024\016;m\245O\274\f\346\023\3376u\304\303F\225O\325\236o\272\343"
+	.string	"s\002\317w\371\376u\324\260\241,\f\231\246\241\310\246\027=\036q)\306;='\336\357\231\005p\266\001\306$\357\334\377}\013\371Z\273\332\363=3\001\376\244\370\243\352%\357\332\367};\277\316\256\366\324!O\262v\324\246\270\310\350|\223\235Lq\341E\361f\200\240\210\r\317\211\327Xme\037\276\311+\t\255\2513\203X\345L\333\310\272\337_\312\344\np3\367[6:)\024\247lL\024\217\255BUC\330dmd\333o\2602,\314\0068\231\037)!\357"
+	.string	"\235N\200\355\265\375N\322GUc\236`U_7]d\325G\322:\302\276\230q}\366U\263+\255\t\274\210q\3755I\334\023\272\342\231Y\004w\032}\300\274\357K\202Y\001'\302@\2579D\271-\365\207\024\215\300t\362\256\213\354\277\372\353[\214%\222)p\260\342\277\017\354\213\024JC\007\233\334\260\001\222%\332l!\232^\215\013-\003\026'\217\026\242\225\241\371f\216\366r\213\306\320?;\017=\330q\030\331\301^\303\t\003T\256\213\2123J\007\321\256t\370\246\262\271\2448i\264\020\355\310L\353Ps\033-D{\006\035`\003P \270\260"
+	.string	"\203\225E{\340\242\305\002\035\274\330\240e\026N\032\0243pq\301\013\n:x\261\001\221\203\f\212\033\020Y\270xAt\032r\213\016.pA\364\240E\013\027D \331\333\352\373]\314\312\3658[s\273\217,\227,gk\317}dM\260\211g\025U\217|\337\367\215\272\353R\203\3629\273\256\264\247\022t%\276\205\221\366\244\353 [X\210\272\271\256%\321"
+	.string	"\302H\375\210'\021"
+	.string	""
+	.string	"O\"\016"
+	.ascii	"/]F\210x\251\357-&qD\021\037\005'\342\201B\314\2448^K\226\250"
+	.ascii	"7\250\217\272R\204z\237\020%b\330\234\230\272\256\245z,\365\\"
+	.ascii	"\247HQ\245\211\211\370\337C\007\025\275\247)Q\320\236\036\310"
+	.ascii	"\324\013\001e\r-\304\003\221y\3044\247'6A\323qz 3\357\tmb\362"
+	.ascii	"\310F\340\231\232\226\236\311l\351\237\220e\276\214\351\223<"
+	.ascii	"\022\004\276\317z\315\202\226Ij-\025Y\245G\322Ad\305{=\364\307"
+	.ascii	"\224\336H\322+\3753\351}ad\300tp\215\212\322\023\251K\372!tH"
+	.ascii	"HaF\244o\221tGA@\374\321\227\021\304\257ec\244^:\2706\344\350"
+	.ascii	"\233\374?\342\234xF>\204~\350\213\214\210\276h\007\321\267\022"
+	.ascii	"\036\320\207!\003\2679\364<^\222ZA/\364\275%Vw\265\007\"\350"
+	.ascii	"\201\236Y\fz`\330\227\347\013\357\002\320/\177\036\350\267\212"
+	.ascii	"?\357\013\363\362\364y\034\303\367\231\340m\030\207\277\226u"
+	.ascii	"\221\302\255a\031\021\365\227\226*2\324\\\032\005\212"
+	.ascii	"\327\032\032\025\375\236\226\f\242\235\177\0379~\205\"\215\267"
+	.ascii	"(^\317\177\226\361\355\307+\215=\017d\276=\241<?c\200\264\344"
+	.ascii	"\335\327\243\360@\244\233\024\272\363\311\342[\362N\347w\276"
+	.ascii	"\217A\336\204\001\376\252\204\274c\030O\177\300\366\252\363@"
+	.ascii	"\246\333\023\372\341\255\214C/\311;#_\373H\204\255\340s\236\371"
+	.ascii	"\370<\032\361N~\370\240\030O\3058"
+	.string	"\237\363\352\rW{U\021<\225\021\347\237\220\001\202;\250\222XA\320Z\206JDD$I\222,c\222\f\b1\2222,\327\003\022\240\0025\bd\234cP\021\021!\033\241\240\250\255\034\217\304\264\244\253P\2649\200\3362\304\253\225b\373\0263wF\234\215\237\362\223\212\216\340\373W\347+\327gv\225\256\207i\222\005\003\277\226\343N\013\265\273\256\037`\273(\177\272X\013\310\337\241\224\202\344\236\301R\303\232\304\311\037\177\247F4\333\360\206H#5j\370\205\033\276\301~3TQ\234z\350\334\247O\332\242\277\250\001\201\177_&~R5\215\332\225\245\365\206\260\370D\037\031\300u\277\273:K\371\331b\226\317,\3337!\363\006Zbd \"\206?\323\340\007\006\221r\354Q\355B}H\340OT5\016\221\257\276\224pi\345w\244\220z9d\300\231\273*+\300<\267\352\277\240\232\035\237Ln\362\013\332\225\310\250"
+	.string	"Le%Z\036\016\334D\337\244\020\326v4\246\330P\310v\247!W\275\246\344:\\\337\001T?\365jW\036T$g<}\275\312e\003\244m,C9\t\263\206\255&\b\006\223\205\344\342<\261\353u\353\350\300\330\351\022\374\3451\201q\r,%\256\t\225\365'\243[\020\344\224|\225\207\307\007\272v1\363*\007S\034\262\264F\310\264}93p\202\217\241\330\027~>\223\002\034'"
+	.string	"\337#F7\210\311\264\371+\344\034\206r\017\312\264\212\024\275\021\350\376\303\204L\371\n\3501r|#\016\307\330o\363\304\337=\213\274\272\271\031\363\217\357\301\250\177\333g\003\221/\266\007\342\327\321\254\254LT\206\315*.r:v\251\342*\215C%\2049\"\231\226B\361\235\247\360Y$\302;q\2412X5\256\354I\372f\306h\273>+\034F\370\343\314\262G\224[A\231%\241\337bV\336#\204\202\236\256E \005\266\325a;.p#\301\300\241\362d\002\215^dj\354\024\326[\272t\257Z\241-\022\235z\264G\2321\b"
+	.ascii	" \001\001\216\330\343mrY\215lP\327\003^\001\367+2\342\215\241"
+	.ascii	",\326{{\302\035\373K\243\232\017J\314\221\311c*\242)\341\344"
+	.ascii	"\350\311 \177\272\016|(u\342N\277\204\362\342+\353v\321\r;\357"
+	.ascii	"\212 \252w\244O\030*\324\207\261(\363\322\250\221\204\347\332"
+	.ascii	"K\006E\034\352\217MHr<\203u\207\217/\210\242/\001\327B\345(\335"
+	.ascii	"d\017\255\022{#\306\266\237\024\373\220\276\311[\354\206\207"
+	.ascii	"\177\345\202\241\340\231\216\301R\366\325o\315\303\251\360\230"
+	.ascii	"R D\230\205\001tGi\263\223+\331R\311y&N!Z.J\233\205\260\300n"
+	.ascii	"\347\225&\270Qd\273\250\234G\024T~o\253\231x\250R\313C\r\232"
+	.ascii	"\216\f~\036\342;\202\312\302\211\275m\352\2060\326\232\301\317"
+	.ascii	"\270G\270A\275\007\021\021]\361Z\031<p\311\257V\201c\267ty\027"
+	.ascii	"\330\207\n\032?\212/\332\320|\361\227\257\016\232\004\035\355"
+	.ascii	"\304\261\031\250\374\2710\311\352\303Ta\207\332\300\372\377\221"
+	.ascii	"\375\253\255\260\347\265\213)E\266\227\354X\275r\210\227G\007"
+	.ascii	"wm1\364W*\177n\343\033*p\254\202~5\2243.[WI\213`*\336\212\226"
+	.ascii	"\031H\017\305J\005\372\356\374\304V\277\341\031\326\240L\246"
+	.ascii	"\236;\213B\252[\324\251k\263\321'\335\325c\362\313\005\203.x"
+	.ascii	"\205\001\230\263\364\315$\333\311?\021\023\022\265 \177\337\342"
+	.ascii	"\265e\005\013\2547\b!\253\307\f\345\306\241\340\2363<`\262-8"
+	.ascii	"\327c\215\373\356\312!\227G\210\271\323\211\354\326\204\036\032"
+	.ascii	"\325K\221N\022\300\351\244\314\\\001D\227X\035\002"
+	.text
+	.section	.gnu.lto_mspSerialChecksumBuf.24.31ed5a8dd7a83378,"e",@progbits
+	.string	"(\265/\375`\203\001\235\017"
+	.string	"\006\236iE"
+	.string	"\217*\035/{\017U\001\222lXh!\322k\332\016P\312t\016x\t`<\013\305\035\310)\307\265\242\325\372\206\232\315Lk\324M\303\212\250\252\372%\361;C\264\202\302v\217`\203\202\231\232\005\371do)S\nU"
+	.string	"T"
+	.string	"T"
+	.string	"\346\350.\023,@9u0\006\333X"
+	.ascii	"aR\2031'\350\255\007k\3020\f\037\301"
+	.string	";j\3522\256\246\374OK\214\353#\271\214\032\026,\204\306\307\212\237\333\314\313k\327\327\247\3228\002\345\373\332c\t\226\320\365\241\\5\017\346\234V\327wrs\267}\262\335\300\276-\277<\355\216\007\357\325\313\356\003\b\340b\005\204\027s\302\302\030SF\276\210\260\215\2629\266\025\305g\250\323\f\0237\346\212C\314e\316\331a\006\335\245\201\270j\337\304O\240\016\216\020\330\230\253\331\005\005\340\007p\227\335\005p\227V\275,\345\2353%\205\313\234`G\217\373\225\231\212\225\336\354y\334n\035\260\204\255\2248\347\234\321\234\325\355\254\302\230d\270\255\202H\367\301\037\341.9\253,^\033J44\202\357n\366\324bk\221Pi\270\266\030\326\267\253b\203$\372\211\335f\274\035\354NTs\016\336\233\356\264_s\360\347.\013 \242\217\005\235@\022\342H\304D!$\232\020\352\034\362|\200<J\"S\204\020\323\310\003\361"
+	.ascii	"\215\274P\311\344y\n\230\024\"*y'\022\251\344q\300\371\030u\277"
+	.ascii	"\257\3258i!S\262*\271*~\355\235\f\f3\266\323l<\260\262\033nw"
+	.ascii	"_\257]jhmg\035U\256\356\313\2669\002  \240\002\2413\356\377\030"
+	.ascii	"\346\321\356\004\270f>\326r\265\352\027cp$\210\205LEA\370\266"
+	.ascii	"\323\367\311\034h\311r\353\235'C\336m\0042\214\220\305\032F\023"
+	.ascii	"Z8h\2045j\236\335\307^\236Ev1\007\\\007&b\272\326\023"
+	.text
+	.section	.gnu.lto_mspSerialSendFrame.25.31ed5a8dd7a83378,"e",@progbits
+	.string	"(\265/\375`\250\003\r\027"
+	.string	"\006k\225G\260\030U:\360F\375'2\254\266\371"
+	.string	"\027f\312\017\352\356\300\2343\306\217\364k\007(\205z"
+	.string	"\221\266\201SV\360G\005V\\\037\226\252\027\fx\274\225\347\341\355i/\311\323?B\337\346\032[/T\2274\262\211\224)\005\200"
+	.string	"w"
+	.string	"\201"
+	.ascii	"E\300\323\264\305P\0214\347,\340\003\312\303\303Ou\265\257\373"
+	.ascii	"\016\332w\037\216\232\263\007I\320\234\273\002\246\021/\275\023"
+	.ascii	"m\3739\256\203f\027\001w4p\242\021:\021>\256\3149U\003\016\023"
+	.ascii	"^\202\177\t/w\306i\227\340*\315\257]*\020\362\273\341R\034\004"
+	.ascii	"\t\270\020\342\001\200\263\2010C1\242\220p tI8\0338`\316\371"
+	.ascii	"\336\265\004nGU\324`\316i\275\341P\334\341mW\260}\301\336\241"
+	.ascii	"\366\301\271=\366\203\3743\377\361\313\234\307\037\363\335\037"
+	.ascii	"\340@w\352\274\037\365\237\377\364\036\277i\325%\251&I\265\213"
+	.ascii	"T\217\244Z\224j\321\252C\221ZJ5\030\252W\252u\325\027\360\022"
+	.ascii	"4\004\3417\247\211_\226\251D\022\261q\240\337\246\371=\223l\003"
+	.ascii	"u\020k'D OxT\346\2344\227\216 \362r- \004\361A\342\301\017\022"
+	.ascii	"\006?<\304\234\246\315\347g\301\352{8U\244\340\320\245T\264\266"
+	.ascii	"\205\032\375\315\244#\242\025\361D\361\351t\226\006\026*C\300"
+	.ascii	"\315\2456\334\225"
+	.string	"\341#$7\334P\212\210-&\005\327n\271\3647\271\267b\344\275'\3279gme\341\356\005\037(6\305\342\222\352\3328\031\364\267]\004/l[\263\375:\021\016\342\2343\201?dBL\254\361!\274\324%\3614\361\351t\364g\324~S{-\2475\355\367\275\313\033<'!\\\354\350\317\336\325ts\00173\f0\327\312\365b\215\0164\260f\261\331\t\346Z\265\306V\330\032[\013s\255D\254\031\313\006\204\271V\243\315M8\332\334l\216\354\265n\031\320\300\302\031]\262\232\034\331K\005\303a\275T\255Q\24620\343X\216kT\315b\261Q\265\233\007\347\366x\003\213-`j\004c\305\224\245yiI\330.\255\033\350\354\216\334\234\222\326\226PccB\362\241vf]\226\270\254\2542\005\307iev\224d\344\203Q\323\306\254\2706\205\n!\204\304\225\001C\250Ad\205\004\310\030$\221H \"m\2129"
+	.string	"\003\021\241Z\007\021`)\205\244D\022%\205\007\003J\236\362\300$\333\211\021\2034$@\326\224 \205n\324\266a\304tg*x^\0215\346&\024j5\342\336\265\241\034\2253y\243d\326"
+	.ascii	"B\222\016A\204\217\201\373o1\0047\223\330\331y\033t\344z\256"
+	.ascii	"\024{\203n\314\003\036\203\267\n%A\365\242\2655\335\267\312s"
+	.ascii	"D\324\033\305\002\316\036$9\025\241Xb\206\271\035\220\n"
+	.text
+	.section	.gnu.lto_mspSerialEncode.26.31ed5a8dd7a83378,"e",@progbits
+	.string	"(\265/\375`\266\r\275A"
+	.ascii	"jm\374\027=@\350M\007\310#a\251\264\254\274\344 \343\216\232"
+	.ascii	"i\217\372a1\267X\022\020\374\210&\022$a\221\242 D\373\340=\250"
+	.ascii	"\302\025!\221V\356\232\251uZ\301\035\"\"\"B\233\354\275SJ)j\001"
+	.ascii	"Q\001t\0016\f\254!\204b\320\275K\242\230.\237\352GL\347u\307"
+	.ascii	"u\327\351\276\323\275\247\333Ow]\263\3162\267^\003\312\273\263"
+	.ascii	"\210\215\027\333x\314D\346\276c&\266\372\314-\267\\\333i<\315"
+	.ascii	"\247\351\332\216\211u>\344\374\032\345`\373\364\\\333~\226~\216"
+	.ascii	"n\260\255\366Mv\236\326\323\366\0361%3y\313"
+	.string	"\220<\032s/Z\f\266\325\2443\205\253\266\357\214\261wLP\356\255\322\337\275p)\352\260\235\262,y\313\336\002\307\220\210c;\226\211\306\306\275Y\372\273\367N\265\312\036\330\367\236#$M\336\262,k\026<\016\221@\253v\346~\323p\332\206+\322M\367j\341\323\347^8\t<\305\266\312p,3s\263\3516-\263]\n\347\226\026D\242\250I\247\322\275\327J\331Nk\253i\007X[}.\335vS\022y4\026\211C!\033\\\325\364\275\345fvS0\t\025HX\230\274u\022\231F\370\233\233\324\205\320\336R\247%a\234]\006\315\212\037\215\305*M\244\222*\001\265T\031\264)>\354Bhke\320\244\270\320\256\245\2600qkV*\030\354\200\205\t\224^\217i\315;3W\013\241EI\225\367\336#\2366\351O#\254\35559\246\031I\235\bea\324v\355gie\356\301\016\367^vg\032\223f"
+	.ascii	"\315\334R\314L\204\331x\f-)\375\276\353\007t\346<\357\275L\365"
+	.ascii	"\333\330\177CG\255bU\034\271TG\255\r\376\214[\310:\341\tp\241"
+	.ascii	"\324\340\205P\310<\232\246\337\346\f\307l\237\223D\210\355_\013"
+	.ascii	"\367\210\365\037\210\034\2772\267\304\314!\332\321\210\377\r"
+	.ascii	"~o\374\273\221\023\220\314\243-\225^T\202\275\267\f\213\333\257"
+	.ascii	"\025\231H\277\262\326vf=\225\237\037\006\035\2652\363\204\246"
+	.ascii	"\213b,6R\n\347\300m\250\017\245\340\376\302M\267\202\333\331"
+	.ascii	"\352\367\212:J\317\277'\357gv\001\303\333Y\365\312\262g27_\027"
+	.ascii	"\224\223YF\017\242\301\336{-\bj\335j\\%\372Bdm\265\277\355:\005"
+	.ascii	"\334\363\310\351\204\314\243\314pL\3776\346N\357ka6:\323h\270"
+	.ascii	"n\031/Z\240\3102QBD\3475k\310\320w\232\261zN\367\204\256k\256"
+	.ascii	"\3528\335SFg\007C\347\006\035\327\314`\201\202\256\323,utV\032"
+	.ascii	"\235\023\034\235\021$\235\243\212\316PE\347\003Dg\003C\347\002"
+	.ascii	"Fg\002F\347\001G\347'\243\263\223\321Y\300\3219@\321\031@\321"
+	.ascii	"\271\211\350\234\034:#\207\316\307\242\263\021\351\\D:\023\215"
+	.ascii	"\316\303\243\263\320\350\314\016\235\203E\347u\350\254\022\235"
+	.ascii	"S\242\363\017\235]\350\334\001\026\\\355Vme/\263\305c\234\314"
+	.ascii	"\030\253O\332(\336N\021\377\364d\216\017\300\024\007\363\245"
+	.ascii	"eC\002\370\031\201\0365\241MU\274K{\346\255eCz\237\0230\371M"
+	.ascii	"\337\316eD\362\203t\034!\255x\333X\026\327\322\262!\335\262H"
+	.ascii	"j\333\234m\f\371\301\276F\201o\214G+k\307\024p/\332\204\026\215"
+	.ascii	"T\244\370\224a\267O\343\007\331C\344P\374\211^?P\353\253\024"
+	.ascii	"i*\216\334\037\242\245\326\360P`\242\256\346M\350\bR\023\251"
+	.ascii	"\370\032\336\0035\241kk\255\304/~\233\255\031!~\003j\021N\364"
+	.ascii	"\0065\241\214wd\311\230\341\267qW\001#F\370m\334w-d\263\002\r"
+	.ascii	"\252\215\327B2d\004\255\301\027T\315g\f\231\350\336\213\025l"
+	.ascii	"\253\013\204\002\301\253^\370\303\177\321\342\207T\336o\255\027"
+	.ascii	"o\247\360\257\356\346\370 8\373\215\347g+\236\334\034\211;\227"
+	.ascii	"\\\345v\357\345Fk\253S\315\334\212i\311x;[\274\322\354\231\\"
+	.ascii	"\244\331n\225z\366c\344E\315\326\214\260\301\367#^\026L\001\363"
+	.ascii	"\0065\241\301oc\346\325\214\223\265g\374:\263M\363\224H\355\366"
+	.ascii	"Y\365\353\007\311\223kB;\332c+s\313\2463aj\34185^?P\223\253\024"
+	.ascii	"\251\327o\203\266\217\265\352\241\276\210\221#H}\346\326M\007"
+	.ascii	"\216Q\352J-\034\244\233\007'`\372\352{_\023\312 \002\\Cv\260"
+	.ascii	"\300\241\365\325C\210\226\212\t@\214^\\'\264~h\341\b\346\020"
+	.ascii	"\373\220C\354C\227\330\222\307\026\227\216-\326\213\353D\030"
+	.ascii	"\016\035\253\027\327\211\255\260\255\325\353k\3072\214\353\005"
+	.ascii	"\330\262k\370\203\213"
+	.string	"\307\226\026\330\n\266\354z\336\252\352\241\265#\214ky\003l\331e\345\265C\253\313j+liU\005\305_`\\aV?\276\276\302\254\210p\267_\013\373\240\333\223\244!d\243Sr\234j\007\354\340\271\003\331\033a\261ez/\026\016v\335\364\027\307\243\334\264\327\352\\\034\222\252\033P\253p\314\214\376<\263\306R5\203?\353\275\026\262\301\331\203d\331\250\3409e\245~\301\2371cp\006\337w}\367\013\350V8p\223\221\244]\342\355\244\361\301&W\3123\225\215F\312\363\225\364A\017%3l\211\213z\004\237 \003\326'@\360Mw\245\352\243^\207^\023\352f\232\275n\213\351\260\376I\212\032T\037>P?#\221\334\001=\355\231<\006\376\300\035\003\037\244\023\r,P'\316\345~\316X\201\357\275~\320\027}\276\271\300\367\310\f\322\305,j7K\177}\216\200Z\310\226f\2558\324k!\231\347\032\261\250"
+	.string	"\205\004LO\252n\275\346\323\246]%\"\360(\262\236\300\333\270\324\204>\375\200,\023?\340\351\257\360\0029}\353\371\232\247\211W\272Y+x\247\217!\350Q\tIO(\026\234\370\001^\300\227\020\361\002\002|\005<:\276\262gr\201\027\250\221,\347\020C\246FDD\222$\3110\006Q\005\304 F!\342\r\021P\2514J\315\210HR\220\2444\034"
+	.string	"9\355V\237\262Rf\036\006\315!o\300\tR\031V\257\232o\200U\2670*\260'\3256\242\245\243D\361\370\260\364S\210|\223\272\001\254\243\310\024T\272O\301\013'\005Cy\272 \324DDr\021\215qUgW\231'\3235r_\020J\236\023\n\250\246\346\337i-\203\312\313\260'\250\024\345\006\251\242\270\363\211\352\023\327\304Y\274\271(\252\360\2414$\212\227\273\r\372\377\n\362C'"
+	.ascii	"\331H\177\020\350M\314\b\305\2152s\203\220\242\035\363'\224\212"
+	.ascii	"VT\205P\2004\224\300UNd\351O\034\\v\216\325T\370\317\254K{Z\361"
+	.ascii	"bC=\272L@\332\330?\317{l\003 O\307Pq\013\360\214M>d\033o\226"
+	.ascii	"h3\031\005A\271b>\362b\021\31600\016 \003\202(`\335@\3428\214"
+	.ascii	"\026\340\350\233\260\373&S\t\226\347R\211s\374\016\37357\221"
+	.ascii	"\364(\\\232\230\234\214\315B\364\367,\276\321Q\333\\QI\321\034"
+	.ascii	"\341\370w(O\253\232q\227kh\374\204\f8\232\034\227\247\2475\223"
+	.ascii	"BZ\247\350\031e\224\031\205\342(\352\266\315\004\314\303\026"
+	.ascii	"E\021\374\212\227g\226v\314\366\245h\206\027\311t\210\363=\242"
+	.ascii	"\0166Y\231-fH/sL\2619o\2723f\223\260T}\347\351}\017\274\302\215"
+	.ascii	"\255KTf\205\2311\211\004\247L,\201t~\034\302J\342\013\250\207"
+	.ascii	"P\330\315\353\345\203\371^:\rM\226\332#9\277\350V\360\314\270"
+	.ascii	"\024I\320f\211c\251hVF\254\337M\310\200Ohf\371\271"
+	.string	"\225\356\030\214\026\275F\305\355d\215\356A-\206w\270S\362\253Ns\244\203\205\f\346HY\363\357\362)\363hYGg\360j\247\370\016\276\001\006\226$\312\260\217\363\222/\200\t\226NF\363{\211\236NkL\360\334\006Ow\365b\242"
+	.ascii	"\301\271\260v\030>6\026n\222S\n\263\b_\317@\357\271\373\3236"
+	.ascii	"\370\306z'\262E\377<\rY\357\375\246<\212\032"
+	.text
+	.section	.gnu.lto_mspSerialSubscribe.28.31ed5a8dd7a83378,"e",@progbits
+	.string	"(\265/\375`d\006\025#"
+	.string	"&\273\324H\200ZN:[\354\261W\376\224\230-6u<\3755\230\273\302\235@\340\371\017w\274\352y\310M:M\233\332\006\252Y\255\261Q\207\241U\340cj\022C\035\354\201C\016\217~\201\317D\301\366V\221\337\244\021i\204\020\271\223\f\300"
+	.string	"\262"
+	.string	"\311"
+	.string	"C\214p"
+	.ascii	";\372erJ\233\206\020\311\360/\030\350\320\t\025\273\261e\346"
+	.ascii	"\336\344\203\233l\001}BDBw!\035\360]\242\227\215\237\265\314"
+	.ascii	"G\336I\322\2232.\340^*7+\367&{\370\001z\223\223\350\231\274I"
+	.ascii	"\022\257e\322\312\250\336\300j\2022w\357\375\361\274\300y\263"
+	.ascii	"\374\200\363f\003a\325\256\347\245*z\232e\333\225_\001\316K\321"
+	.ascii	"8<O5.\331\264\354\256(fWs\222*1p\035\257.v\005H\234xX\365|\232"
+	.ascii	":\252\340\307S\324O\023\200q\206jd\262\245\232ST\3113v[\303H"
+	.ascii	"\264}\261\373\300!\317\374x\232\272\335i\270\367\262-\032\237"
+	.ascii	"\316\2753\263\0273\3730\237!\002h\322\226z\310o3\034+\013\245"
+	.ascii	"\030\307@\307\022\204\276\31523:\344\0252\023C;9}\301m\315\255"
+	.ascii	"\034\025(2\013\275\312\n\364\336;\201J\212!\003b\204\334\344"
+	.ascii	"#\2357}}\301\255L\021J\311\3261'\207\266\253\230?A\215K\020n"
+	.ascii	"*\346'\177\003\377:\353\034\354\234\363'\277\200\207\235}\357"
+	.ascii	"\372\003\240\226qx\226{<\313*j\231\307\263\234\362,\243;\313"
+	.ascii	"\273\324\362\231Z6S\313%j\271w\226\355i\371\f\020\034\277\260"
+	.ascii	"h\2737G]\233\233f\222\025\371\327\017"
+	.string	"\366\207\275\231\317\3741f\365\314I\374(\227r1V\303\216\312\033\345\273\304)\001v\211\327\031\233\225\013\207\215\215n\356l\nWH%[\367\207\241B&\244\354*\216\273\331;YZ^nD\313\206u\222\\\315\252\304,[\233K#W\266F\027\265r\235\314\253\326\317\254\035\315\224I\241\326\216r\346\326\341\346\310\274\225X\314n0\245\243l\346\225\311\305\254\\fY\230#s\214\267\255N2Xm8\033\007U\215\227\2715\021%\270\303\271c}\315\354\341\203}\261\354\005S\3064b\017Y\355\356\217\335g\307[]\323\233\226\322\203*K\263mf\020W\373\3514!\236\366\203v\232\205F\207|\2273\2178\332.\013\355(\007<\231I\234\013p\213\210\022=+\031\347\315\363,\213\\\216e>\201\302\276\250\323\t\244\002AAa\277\020\252h!\b\030E.L\244\026FBAS\005QP\033\t\211\232\203\"\264"
+	.string	"\032\n\n\tQ\030\t\211~.\206\200\210~AA\341/\302\016\027\031\t\005\177/\212\212\202?5y\337T\274\236"
+	.ascii	"\246\264\322\224z\211!X\234\316\271Z\261\354\213\3143\243\207"
+	.ascii	"\334k\234\356iz\243D\243\327;(\270-$\026/\300\201\247z\306\244"
+	.ascii	"\366oL\203y\353\nK\273\212"
+	.string	"{\316k\313\346\205\346\300\372\212\254G\354\213\274\276\330\217C\312M\032\361\345\275\367\252]\245\005M{\tH\300\252\030w\340\211v\332\345\031\223\217%\022\366\002\3216\231\332\266\030k\211\233/gW\361\317\271\353^\226\233\376\2241\226\343\200\\A\231o\316\016\200\203\250\2214g\024S\244JD\202\2440I\313\001\220\002\221\251\253y\021@\271C\254\206\024\226$9\2172\272\013\277b\005\022(\332\242\233\2164i\304?Tf\301\203\001'\316\372r\243O\342\013Yz\262\006m\242\262{6~ \301I2\365\002J\305\256\024e9\232\2538@C\021>\224\242\264\233\001\203mW|\207\215\263[NZ\336\242\251\223\361&\234\320\342Y\367\031r\201\332\002M\032[\345\035\253\254\2035\001a0e\310<\203h\226\243b\275\210\355\324\232\306RO\222\246+\237\234\nH\333\231\246\365\207\026\f\366\232?\326\263\317M\031X\320"
+	.string	"J{\306\205\375)\026\2249q\301\221\004N\231Zot\"\213\0241d,\3231%4n:\255\271\341\350\3003\310\276\244\327\212|\252&\020+@\367H\373\256"
+	.ascii	"\202\226f~8XU\206\341&0\240#Ys\342\375\201\255\263\346XA\325"
+	.ascii	"_\016PDZ\365\341\275\322W\343\017a\021\223l\376"
+	.text
+	.section	.gnu.lto_mspSerialProcessSubscriptions.29.31ed5a8dd7a83378,"e",@progbits
+	.string	"(\265/\375`\230\016eG"
+	.ascii	"\nw\224\032@@\244N\007\037\302\257\346\b\201\n\216 \300B:B\356"
+	.ascii	"\336\211&\005+@y\346\221\020Df\377]\203\f\004\177\207\207\305"
+	.ascii	"\023A\227\343\302\2333\2702\025;\354\"\352\356\216\221^\322\233"
+	.ascii	"\354\275\223L)\233\001u\001\232\001|]f\006\023\345h}\335\373"
+	.ascii	"Js\026DF\033\031jFr\224\363\025%q/Z5\276\346"
+	.string	"u62\304L\034jn\265\276z\324\tO\251f$\321\234\206\003Q\337S\232\363\032\020\355\231\031Re\321\214F\003\021\340S\272\301\355\332\313\220\351\275;\274B\302\234\263\206\266F\267\353+\366\272v\3058\335\353cn\264b\315\366\214\220A\302\234\243U\276v\262\365UJ\305\321\034NG\271\214\356\355\312q\267?}\356u\350\016G\312y\315\317\232\234\243V]\325\372\332Qgb}m]\211\365\265\337n?\036m\313D\2709\313:i\316\371\352\247\264\037\272\032\365^\302\2573-)%!\035\031\025!\217\256\261\330\022\331Umz\374\266\2139S\235&\\\231\036xIJZ\025WJB\352\363\002jiT\374\250\200ZZ\233\033\251OmrM'\270\350\r\026\244\332\240\207\224\211\327i:\325\343\241\345\035\227k6\301G\035}O/.\223%\330ht\206E-\355\315\213*\226\236\2213\257\323T\242b*{"
+	.string	"\271\\3\tn\211W|"
+	.string	"RKss\242z\200N\024A\257\323D\242>9\343\020q\321\226\230U\251\b\331\024*B3S\231\316\2540\275\3171\020\264%^\275\316U\271?d\236S\26548W}\254\2127\251T\3168D\274N\323\212\312D'\212\240\213V\206_\215Zs2-B#S\245\340"
+	.ascii	".\275\316\013\3105\3410&R\31097f\242\245y\003\360n'\322\335K"
+	.ascii	"\272\221(\002]\370\274q(z\003\353k\361\211R\016\247P\002\317"
+	.ascii	">\325c9fyQ\277>\373\354\236\231\223\f\037\266\372\353\373\322"
+	.ascii	"p\254\203\007j\251\357}\236\240\220\341\024\372\203P\342\244"
+	.ascii	"\353\263\001z\236\242\266\242Ya\227Ac\370\360\350\217\031&\352"
+	.ascii	"\263\265\273\024`\323G\323\257u\002\037\236\305\376\257\240\373"
+	.ascii	"\303?\365\377\236\310,\216\254=\270\235,\374\253\235!/M\270{"
+	.ascii	"\004\t\354\314\251'\260\004\016 \331\2131P\363f\355\237\255\265"
+	.ascii	"X\377\025t{\312\360\241\356.\341s\264\332\234\263\203\366\277"
+	.ascii	"7\016E[e\007\353\253\277\327\271sYs6\201\216\341\303\356(\031"
+	.ascii	"~6<b\240W\372\327\272\217\270E\270\270Cd\271\270\223~\306\033"
+	.ascii	"\313\243\356\021|\317\333\352\210\273\212\312\307xO9\324=\201"
+	.ascii	"\223\361\216:\342&`\304\r\345\342\036\340\342\026\340\342~B\342"
+	.ascii	"\016\340\342v:\302\r\300\210\273\311\305\315\204\304\275\204"
+	.ascii	"\304\255t\304\235t\304\215d\204\373\b\211\333\310\210\273\310"
+	.ascii	"\305\215D\342>\026\341v]\334F$\356b\353|\336\304#n\366\210{5"
+	.ascii	"\342V]\334\357\342\306F\334>\302\023\305I\001y\335\345|vX\230"
+	.ascii	"\001\327\274+~\306\035\317\235\215{\033\367=w>w2\356c\274\355"
+	.ascii	"\3668&\270\370\235\277\351v\273\206\3735\024\264\320\371\314"
+	.ascii	"9\273f\332\321x\032\317s=w\343}\355\006p\323<%,{\261\306\302"
+	.ascii	"\215\337^7\254\247\240\363\351\346~x\312\273<\006\036h\373\361"
+	.ascii	"\002\301\316\354\343\037\"\300"
+	.string	"\036/\326\020\260\373y\232\367L\317\375<\357Ek\231H\337\021\036\353\245\226/6\004Cy\213 h\303\n\3149#=\2079B\347\034T\311:\236c\315\t:\237\016\305\346i\235y\233w\364y{tz\314\0042\372\243#8I\362\211\221\340#\032Rp\221:\237F\237aN\213s\016:\304\213\274p,N\313#\356\365a!\336\375&\351%\355PM\\O\253\035\264\257\007`\273_'\256\367Bi\007+\037^\227A?^\270\005\201\335\330\f\373\320B\352\301\223.q\366\206\023\005\227\341\261\327\215\310\207'\315y\314\231\2153\026{\331\272\337)\257\033v\346\353\306\276T\334\360\205k\007\335\357\025\327{\261\264\003_ML\371\230F\276\b\376Q1\302\315\371k\251\236\370@\272\213\276p\311\231\201\210_\364nDjhiHD{.)Z=\362\301\350\376\216\217\314\342\207\222E>\273\251\364\370E>\273)\364"
+	.ascii	"v\277\373\345\362z\301\316\264zO\362\244\354\305\2768\241-\367"
+	.ascii	"\215\216\330yq1\206J\356Z\"\021g~\265\177\213bD\216\370\316\261"
+	.ascii	"UK\210\300\320\021d'N\362\253\236Hhih\374\251O\276\307\361\013"
+	.ascii	"rL\002\331\034\261\003\343\201\262\\@\204\306\267r\303\330\f"
+	.ascii	"\264G!6\311\026\037\254\202\017&\211R\016\245o.haB[\316\371\001"
+	.ascii	"\006\357\243\301-t\030\335b\201\022\206\213\260\031W^_O6"
+	.string	"\270Xx\271X\271\270\300.(\271\302n\254(\336\200\021\203\013l\335\"z]\bS~\035)g\204\251\bS\262.\\\331\241\306\227\327\352u\201\205\227\212\256\256\257\244R\311\265\365\005\366!\206\262K)\206\262\353{k\001\f\025.\300\270\224)b(\273\256\274\\\250\350\272\332\002S^-\030\320_1\270\300\256\302\276\276\300\256\334\350\230S\030{\2628\246gk\344\233R\326?\237\246*\217z QP\272?\250'\360\216\373\240\236\200\033T\3159\347%\005\036\365Y\357e|\325\373\243\007\317q\362g\252D\274\363#\024S$\026&'\025\213P\317'\3169\234F\320\233@HJ<62\324\234\325&\020\2129\032\360xY\020\300\24093\365O?\340]\316\360\316\314I\326{D\fM\215\004\271\b$;\206\350\b\2623'\304\213\230\372\020\357o\004|\0312wO\357\364\002\376\007\003\374\323{]\362\304\030\272"
+	.string	"\277\300\r:\206\303dYA\245Q0N\277\362\375\361\322\254R\304\254\350\331\354\b*l\367\343\335\025\360\\\022\002\364\316\363KQ\217\240\324\r\254\031\023E\372\f\026\353\007@\301\320\355\261\200\001|\202\357\346a\210\307T\312\214\007\"\274\205G\242c\240\002"
+	.string	"\037"
+	.string	"\252\245\320\317\356\370lm\034L\264Tc\244\372\266\tki\277\351\335H!\037KX\206\307eZz\246w%\205j\226\206K\217\345\222V\320'X\342T<f \327\223\254\322/\275\2339\223^\351\235\b-\r)`\367\303p\357\362\200\004\261\227\f;3\351q\201\031\250\2014\306\020C\250dDDA\222$\351A\005\304 \007-4\017\022@&A\006!Bu\024\244\240\2445\226=\003,"
+	.ascii	"h\003\246%\226:O\f\235\372\221\013:\355\300s:\230\031?g\3522"
+	.ascii	"\232|6\034gTz\2153\t\324\023\203\026\231E\221#>\243\232\003\322"
+	.ascii	"D\004D#\034\236\025\022\317\001YL\337\355\246\361\023\244\222"
+	.ascii	"\250X\226\246\250-\372\320\254\256\375\035\206\346\326\030\247"
+	.ascii	"\227My\210\001\020\207\224\252p\030%q\331\375:\022\006L=?\365"
+	.ascii	"K\025)\224yS\200a\r=\344\206\036\020.1{$\037\336\345`\274(\335"
+	.ascii	"\325\234{7\346I\350\215\261Z\374\t\210\257w\337\263'\265\325"
+	.ascii	"#*1\247\336\260\223\303\034N\327\365t\252fb\016\375\250\267\351"
+	.ascii	"\036\222\271\320z\035\257G\331\250v\311V 9:P\b\203\034\225(\346"
+	.ascii	"\316\310\300\360?\254*\311\300\200\b\334q\036\240\375\035e\343"
+	.ascii	"\342\033\327P\260)\263\302\356\032ts\226\033\342\234\342h\020"
+	.ascii	"\254E\035m`\240.\300\334Jy]"
+	.string	"\177\200\326\361\277\022\374\"\213\2313\235@T`0O\r\334e\316\007\\\177\324\177\bM~\254h{0\b\332\331Jg\026\235\020\365\247!\241\246\"\032d\001\360r\347\370\234\004\373 \036`j\227@&\342C\360?\267@\036\345\033Y/\363.[\205\340\340\r\212\n\304\253\325+\324\316:\246qcr\365\037\206\205\351\206\252\316\300\346\320\307\332\3378Ss\342C\202Vd\230\203!(\370]\3141\3264\243s\306\360\357\"\f\223Z\301],zj\322"
+	.string	"s\354\r'\301\352\271\227\315\n\213\360e\023\205{;\020\275I(U1!\205c\314\310\266\221p\347\243o\245b\200\230\267\312]\210r\207\313\215\367)# \336\247\343\330\r"
+	.ascii	"\214X\230\3018\343\310\340\274\016\213i/\320+\021\320\001\303"
+	.ascii	"\336\375\222\354S\225f\232R\022\230\023\342\357\n\262Q\206J\345"
+	.ascii	">\004\314\377M\020G,D\302\272bx\031\223\272\211\306\034\250\334"
+	.ascii	"z\234\215,*d:\212*\2012\006\334a`.jGE\t\331\237\022\210\233\212"
+	.ascii	"\246\253\312|\"W\371U\001"
+	.text
+	.section	.gnu.lto_mspSerialProcessReceivedCommand.30.31ed5a8dd7a83378,"e",@progbits
+	.string	"(\265/\375`h\005e!"
+	.string	"F\271\313H\200\332Q:Ee\r[\265\r\032\343cA\327\237\251\216\312K\345\342\365\t&\220\210\332\215\237GP\243\203\3516f\262[Z\233:\225dH\202\300d\326\217F\231c\247\363\261(\310\210\n\2400s\313e4b\311&r'\031\264"
+	.string	"\253"
+	.string	"\271"
+	.ascii	"a7\376\310\267\261\247\362\006}\356\365J\0321qBy1\352bO:Y_2\320"
+	.ascii	"\356\255\001\342\274=\320\177L\"\352s\305\334\003\315\276r\240"
+	.ascii	"\335K\266\340\226\215z\b\025\005W\353\205.\200|\356T\230\025"
+	.ascii	"\331\275\303\006\274\340\274ef\376\2223\211b\024h\310e#\200\225"
+	.ascii	"\232\252b\362\336!\216\207\027`\336\236\3771o{\353\350m\246-"
+	.ascii	"\273\242\374\037\177\341\227\302I\201\276\333\260n\226\n\320"
+	.ascii	"\254\274\351\001V\225\002\254\212\244T\325^\275\334\001^\275"
+	.ascii	"K\0070\222;z\200S%OZ\225\331\217\2573\200\277Zm\023\356\275\\"
+	.ascii	"S\240\215\363yf\206bf%f+\025\314\032x\303\031d2w\370\021\211"
+	.ascii	"s'\372\001&\363\207\037\2178g\261\324\224\270\331\262\202\301"
+	.ascii	"\031\226kA\002\260u\037\334f\251\367\354e\304\255xX3\246\257"
+	.ascii	"\222d\303RK\336+\365\224?\345TJ\360\273n\371DR}z\313O2\225\036"
+	.ascii	"e\005\347\230\227~d\342\334\255\305R\373\231A\342\220\252k\314"
+	.ascii	"C_m-\346\227\267\263\230\2712\321\255\262\320\255r\320\207?\201"
+	.ascii	"\013\377\237[e\035\236\312\347\255\262m\247\262\251S\331\236"
+	.ascii	"\225K[\3456+W[\371\b\314+\264\344\232\027k\367Z\255\251\3352"
+	.string	"{\305\353\304_\354\037{3G\361\003\004:\250\207\252\332\367u8\350\221\227\341\272\2343[\277\314\220\332A\257'a\312\003\365\310\037\217\274\021Mr\37643\n\206.\251O\205\372k~P\265\357l\206L\370\243[\213\313~?2m7\222\306\226\257\315\2303S5\215\371\250y\342yA)\311\007\231F\244\177\271\321l#\022\347\232<\r\222\331$\202b`B\333\306#\316\225m\373Us\244P'?C\241\354\020\301b\034a\267\231\332\357nS\016\025\222\037\033\235L\205\263\366\223\301\"\230\260\307\030w\204\304\250\222\262\t\323\242\300\331\275\367\302\3130\234\367\336\034\030\021\031\fpu\2710o\337=BbpIq\274\313\003P*\234\230xv\311\326d\201Eo\347\323d\001E\223\222N\2673\352\365\230\226v<\016N=\335\217SO\327\274T\244B)\005\217\251\227\344\324\323\341\232R(\351pK\274\036\256\250"
+	.ascii	"\357\234\230x8\026\273\035\017w\033\336\227\267\263\210zH\252"
+	.ascii	"\177\214\022\305\236\312{\203H\370\330\217F$\236\250\037\004"
+	.ascii	"\271\200\005m\016\352\331:P\036\365)\017Q\371\250?\024\b\317"
+	.ascii	"\031\203\263\033X\354\352\321DXT\271\372\222 81\353\301\244\336"
+	.ascii	"#?\007\325\3429;\300\205n\241C\352\230\030-e0\332\307\347JC#"
+	.ascii	"3[\213! \313\240\216@u\203J\013\265N\317`f\"\246N\267\257\270"
+	.ascii	"\025\206f\252\246\2256A\030\352ek\016r\250q,\306\030C\310HhA"
+	.ascii	"AAA2\034`\002\021*\253;\021\200\261deR\320\302p\036f\357\274"
+	.ascii	"\303\377\037)\021.\352>\020)\356,\202r\f\226\023\363N=\252\024"
+	.ascii	"\035\270(x\277\211\301y/\2160\370\302>\003y\337\260\f\275\237"
+	.ascii	"\355|c)c\007\247\276V\323\257&\004\246\240\33146\346`~Q8.\270"
+	.ascii	"\307\302\363,\031\003\021\002\200\310\227\321\230\341\271D\310"
+	.ascii	"w{\252\274Q\003\bj\357\350 \t6\202\306\220j\244s\335\221b\201"
+	.ascii	"\204NQ\202\004\0338)`\230\234-t\024`\320\277dh\202\222]4\202"
+	.ascii	"\033\315\336{\273P+\022^\004\221\266\030fo\220\237NU\213\217"
+	.ascii	"u\254(\030\336.\357\260v\231!\365\272\211\235\3140\277L\350d"
+	.ascii	"9\334\254\257\274\030\f'H\335l\342\272\034\355@\\6,B\363\027"
+	.ascii	"\223\327)\026x\341\343\177\0254\222\342\207\363W\345\032tW\003"
+	.text
+	.section	.gnu.lto_mspEvaluateNonMspData.31.31ed5a8dd7a83378,"e",@progbits
+	.string	"(\265/\375`O\001}\016"
+	.string	"V\032aF"
+	.string	"\223\223\016\360\333\027\004N\t6\t\315\2419\232\261~\"\303\035!Vw\256\006\235\330\003\305\330\261\251B\253}\006\207xX)G\024\316\003\331\352.uU\251\003\262[06\364\206\326d\234AU \226\354-wJ\001M"
+	.string	"H"
+	.string	"N"
+	.string	"\330\247Kv\217\003*\233\002\201\305\013\020\255\234\335\325\024\305K\307\246\324X\362/s"
+	.string	"\251/\345X\313\347\007\317\247\022e\200\257\345*\027\274\340\030!\340C\311\221\027\f\217\313<\256|\247\030;\023v\3271\365\261\334\235\333\336lK\260o\"\3270\fC\253\312>\353\237\007\177)\243\237\211\264\240\371\276rcWD8d]\263f\205\355{lk\264\035D(\035<\371\200=\335\204x\360h\037\306c\224\316B9\201]\225M\215]\260\201\031d\237\006?\202}f/\020?^'\244\256\316a6\206\323\340\262\335-\361g\2204\030H\021\203\302\342\242\303\205\217\253H\275\270TW\226zM0\263\003\025\203\330\016\275\325e\273\250\022\177\3462:\3701\237\036\231\304\247L\260\317\353I\270\344"
+	.string	"\3022\305\320\006OQWv\336'\003\205\013\233\007n\003m\236\b\311\353*\210F\241\216A$\033>\234\267\215,\210F!\215\003\367\ti o\244\221 p'\332<\215\324u\236\346\001M\227\253\252\354\246\204\313\244'\271\273\213E\032\233\034\343\340\300\324L]Y\301O0\251\372j\t\2116\002\036"
+	.ascii	"\357b\314\304\223|4)\334\006\255\2008\310X\013n\241a0\364|a\270"
+	.ascii	"\205\006\276\n\217\263`\214\025\007\301\232\b\357\t\024\201\207"
+	.ascii	"n\207`\31156*\214\013F\004\250(\300\035y\332d\020\264\003)~6"
+	.ascii	"]CPP"
+	.text
+	.section	.gnu.lto_mspProcessPendingRequest.32.31ed5a8dd7a83378,"e",@progbits
+	.string	"(\265/\375`~\002\335\023"
+	.string	"f#\177I\300\224Q:\333p\206\324E"
+	.string	"\025w\004Y\374&\030\220Nj\3616\206\335g\206L\037\013X3\213\231b\263\242\177p3]\036u\337B\346\340pG\t X\026A\"\330^2w\034\324\377\335\277\024\274\213#\237\220-eJ\001p"
+	.string	"a"
+	.string	"k"
+	.string	"\341A\317l\247\225\2339:\340\375\260\325X2\347d\255\212\317.\252BP\256\316\374\361b\003)\325\201.yGx\241\355\004\207\023\252\2608j\341\003;#r\013b\340!)\331\311\311]J\005:H$Rp7ReH\212\246\025\256\246+\r\354N@\245\340h\262%H\222\355@W\020\270\232\252\nf\316i\275\341rn"
+	.ascii	"\267m\302\366\213\255+\002\237!\023\347\234\017|\031\032<\210"
+	.ascii	"=\007\375\232\360\340\327(\207\004\252g\243?\3337\352\362\330"
+	.ascii	"\337\337\357\367\363\356\354\367\376\023\251\016U\r\256Z\256"
+	.ascii	"zW\255\252~\n\n\221&\334C\020\315)\342\327d&\201F.V\266\257\366"
+	.ascii	"c\374g\366^\315\005\314\2713R4\247\217\201\027\210\007\355\273"
+	.ascii	"JxP\374\200<~\221\337C\231\370L\035\017\177\310N\342\301_7yK"
+	.ascii	">\366u\330v*@#7\347x\035\275\315\004+]M\247p\310\300\225\220"
+	.ascii	"K\002\305S\342\205\r\250@\230\204\246\244\322]\241\334\355\005"
+	.ascii	"\t\251i\324\312])\202\343Cs\206\333p\355~\210\351D\355\027L\177"
+	.ascii	"\323\375\223\216\266\343\037\205\342'\264\226\205\337\013AL5"
+	.ascii	"\215\262\335!41X\204\031\331K\345\226\313\206\030WLFfaF\366b"
+	.ascii	"qp\305\274X\255\230\214\345\302b\330\214L\214E\003\203\305X+"
+	.ascii	"\337\274\234\273\323\245\3719n\230Q\245\344\234s\212\0044\\{"
+	.ascii	"\002\205\026\273\302\217>\240,\261,\205\373\222\233\202q\242"
+	.ascii	"#PzR\005P?&\264[2\372\233\177C\311GRmG\177\307[EI\243JA\260\375"
+	.ascii	"\364\204\0335 `\002\2219y\007?1\006\343\275\027\355cGojPB\"E"
+	.ascii	"\b\254\002/\255`\271eqM[\334\205\334=\232\343\272\224\227\235"
+	.ascii	"\346\2473\270\\\334\201)\367v6V\337^\314\f\017M\327j\361\210"
+	.ascii	"\227\330\006\022\245\277\200-J\323\357\021\\`\240\253\\\003\325"
+	.ascii	"\301\205\016Vp`\0358\353\251\254\364\034\301\332\320L\247\210"
+	.ascii	"/\371\253\034\3405B\023P\261\366p \331\331\352\222\005\032\005"
+	.text
+	.section	.gnu.lto_mspSerialProcessReceivedReply.33.31ed5a8dd7a83378,"e",@progbits
+	.string	"(\265/\375`\324\001\325\020"
+	.string	"v\337oG\340\322&\035\242\017)\316\267\361\f\"KJ\350$\207\350\030\347\325\372\364\324\226a`\377\350\037"
+	.string	"r\372\320\306q\205\256@\234~\017e\210\236\243\331\335\331H\325\345A\2468\200\337\205\346\270\254\304\346\312\326\211&\233\310\235RW"
+	.string	"U"
+	.string	"_"
+	.string	"\013\242\344\323\f\266\317\237\244\310\341d\332\231\036\034\356\322\376\212\263p}\007\346$\273\261\0352v\305\004.\331>-^\200\366\271=\200\366i\227\275\343\324a_\nt>\320\214?v\227S\023w]\272\374\217\037\tm^\227\"\013v\3272\264\tq\353m\037\260\215b\313\225.T~\216?\266\370\341\247\351+\355S\005\366\003\304(F\036\331\342Kj\t\373\331\356\2565f_\374K\337\371\267Mz\212Hg\232\264Ni\231I\337T\312\241\303\3467>vk\216\202,\321\234q\342>\277\375\217&\371<\357q\335\247e\332\033;\022\323\2511\332\266\203\217\020\214\312t\352i\206\304D\370\320\204L)\300b\250\332\025NC\352UU\205x@!c\013\027\272\260I\375\r\fH\305\316\325\306\360 \320({\345#\213Q\237"
+	.ascii	"H\334\034\205<|\240\r\003pB;u\030\335\266\273\250\027/\031\b"
+	.ascii	"\340\310\201\321>\257$\031XP(B%O\374\237\007-\027\257\373\346"
+	.ascii	"\013J\313\305\353T@\260K\261\276\007\036\270\"\361\300\225:e"
+	.ascii	"\342\302\242\372:p\305\003W\334\213\212e\305\245>\22031`\226"
+	.ascii	"\327}\234\006\026\353\343H\342>[\215y+\252A\024\2432ne\273#N"
+	.ascii	"\214xR4\273\301m\244\224p$\300\206R\364( \337\342c\313VR#(\022"
+	.ascii	"\"\232\321\227\247\006$ `\202!eh\007\257\030s\274\251\302\025"
+	.ascii	"N(\320\005\226\367r\026\033sL\r\265\274\322\301\036/\267%R\275"
+	.ascii	"n0\023\345\213\230B\226\220\276w:\271!66\f2\214F\333\233\211"
+	.ascii	"\211/\226~\262\375\303\2151\330e\231\365\3061$\214\022?\"`\243"
+	.ascii	"\200./\332G\006"
+	.text
+	.section	.gnu.lto_mspSerialProcess.34.31ed5a8dd7a83378,"e",@progbits
+	.string	"(\265/\375`\305\n\2057"
+	.string	"*^D\025CPdR\007SH|\224\034\246\026)\367\341(j\264T\216J\260\017\355x\032\236\325\306\2222!T$\312%h\342\230D\324\002\001\245Az\215\310\t@*\2516\236Q\315\321\264}i\215[\332\266\367N2\245@\001-\001@\001\316\272\373\345\007\230\"+\260\324\323^\367\002\304\350\230\247\324\266t"
+	.string	":\333R\240\343n\217\372\331\353hB:\230\263\027\035\231\234\245\022\032\002\320\331\003^\324:\273:Q\353l\277\335w\\*\226\215\240[\230`\366r\316H\017\245\215\375\276J\275\003\374\353\002\002\024\001 \032\022:\032\215\212\304\241+\f\002\177-\273>~\333\177\036\300\370\3725Vm^-]\300z\244:\255\254\024\244p\200'XU\274\b"
+	.ascii	"\225\267)\230hHh5P\007'\213S\235R\326\004ZN\3068\231s\f\037\251"
+	.ascii	"N1&6\266X]nT\224\342\304\365\002\325\236\226S\235[\353\360\017"
+	.ascii	"\323\316\311\234\\x\350~u\211\271\253E\346d\202\205+\207\263"
+	.ascii	"\2621\247:\313\326\367\262\226&\013\007\033\201\027\326\323\201"
+	.ascii	"\353\203<r~\234\352|\256EVU\232>\347\b\310\234K\360OX\267\305"
+	.ascii	"\326\345\355:\301\315\2213\247:\243\254B_u\324\334\253!\230\205"
+	.ascii	"\202v\321\343\205E\305\3275\302\034hV\361\212j%z\272\315\361"
+	.ascii	"7\307UWS\370\235\315\331/&\323(\237\027V\025\307?\0179\347\306"
+	.ascii	"\315+,\357\001\336\355f\272\373\252;\330\"{F\370\254\316\324"
+	.ascii	"\342O\252\321\231\302\177\272\373\205\273a\222\361\244+\3139"
+	.ascii	"gh3\303\243O8{k\234M\214\326Y\3742\236tfh\355ib4\270kvw\020G"
+	.ascii	"3\003I,\347\254\301\214\237\241\321>\305\331\256\221\204\275"
+	.ascii	"\231\324:{\364\377\246\231D\350\375\375\315\331\350\023\216Z"
+	.ascii	"umP\024\356\303N\344\270\271\362\037\326-]\342\007\233\272\211"
+	.ascii	"1\353\007\353\256\020\301\275\270?\360/\356\016\034\315\275\201"
+	.ascii	"\307y3p9o\005\356\346}\344m\336C\276\346-$\304}\024\3426\nq\027"
+	.ascii	"]\334D!\356a\021\267K\304-\034\342\016\016q\003\207\270\177A"
+	.ascii	"\334\255\0207\353\342^]\334/\304\215\203\270\375\302\021\234"
+	.ascii	"T\335\027(\227\257J\263U_\240<e\347\254x\234\273\234{\233\273"
+	.ascii	"\233\373\032\\;\031\237kW\016y`)\315V\306\272-2\321='0N\307\232"
+	.ascii	"\227\344\257\333R\023-c\212i\037\343o\355\272)\355@\317\336\356"
+	.ascii	"\266\035\307L\315~\245\007ms\002z\230v\266v\235m\013\030^_\353"
+	.ascii	"\341yH\376!\006\215\346\311Y\n\301\331\266\001\f]\317Vm3\245"
+	.ascii	"\372\345\277\351U\2138\312\231C0UQ\313\211\034\242\377\364\304"
+	.ascii	"A\205\360\222\270\r?\f/"
+	.string	"\2478\367i=\003\225\351!\341\007_o\030\366f\204g\247\3254S*\240\035\023\212\373\216\265\356;\025\212\003z\307\202\3138\261?|\356\273\363\331\347\bn\213\217\220\350/\225V\370N\366Jq?/\225_Z\034X\037=\341\373x\352\361\005\035`y\241\330\233\215\357\252gS\252\2563P2\340\207\265\337h\203\357d\300\377}\360_\020s\211\224\220\266\301\003\277\315c\316I\375\357\335\257-<\314,\006\270\375#-\257\031\366&\203?@\365\313V\360\355\273\3263/\001f\277\373={\273`o*xW\322d\352\227yLD9\270;;u\330\3679g\331<\363\314\320\276\256\216\027\266\337\207\201h\273?\370\035\b6\r.Z\235\343Y\317\352\236\336\372\335\"\334\216\004\233\006W\306\025\255\233\341\306y\323\343\212R\327\274\346\036\002\270\333\304\t\354\315\365\327\275\352\326T\352\227\031\250m\242\264)\332\377\244\032\236"
+	.ascii	"\214\277\233\205\013\354\315\377b\0303)_\236\251_\266\267\345"
+	.ascii	"\275E\331\225+\277\2277\232Jnc\251i\207\322\t\251\004\204J\376"
+	.ascii	"\234F@)\221G\037K6\234J@%\221OA\247\021?r<-\255\020r\032a\303"
+	.ascii	")\251\251\t\tB\251\\RB&U<)\233\210\222\240\222B<)O8!Q,A%\355"
+	.ascii	"\310\221\304ci\250\225&\344H\302\221\\R\326xR6!9\341HjBRJ*\221"
+	.ascii	"&\024h\344\323R\022\t\n\211L\"\271\322\354\017\006\306\201a\312"
+	.ascii	"H\371\362D\275\324\026\001\037\326\306\254\242\n\317F\301]\325"
+	.ascii	"\370\216G\221\205\341\005\370\260\036\255\320W\370=O8R\3250\\"
+	.ascii	"R\270\017c)\342\200\037<\221\267\nK\333\341R\025\003\340\215"
+	.ascii	"\037?\251\326\204\211M3\023\355\342:>\214\2545>\264(\334\207"
+	.ascii	"F\264\001[\275W~\207\247d:u\244\271\007k(\0036~\017}\037`\302"
+	.ascii	"\304^\305\005\312z\032\177@\337\0324\f\270\250\344}\262H\302"
+	.ascii	"\204\344H\361\215q\342\366\210\246S\346\204\336<\250\007mc\306"
+	.ascii	"\0311\226\373\234{\225!ghn\204\037\372\252\035\355\320;(\322"
+	.ascii	"\347\204O\035\336\024\376\263`\357\013\335\221\316\211\017bH"
+	.ascii	"\374\030\330\311D\\\302\331Ya#C\tK8;\256\2635\347\234\215\037"
+	.ascii	"\326\356/f\013\314\214\321\203\025\251\302M\013\330\301\326\033"
+	.ascii	"\200\313\250a4\347\210rfFFd\024&I\322\030\240\002\221\2412\316"
+	.ascii	"\001\021 54N\r\005\221\324\316\001D\006W\360\236\204$\327Q\377"
+	.ascii	"\273\020<\250\336\211\017S\226\214\215\341\210`\220\343\372\b"
+	.ascii	"\254e\b\356\230\252\222\201\254 \356w_\347\0011e\220G]g\326\363"
+	.ascii	"\022\303\376\253\325\242{\t\2378\240s\273^\250\356\346\027"
+	.string	"C\206\377QKk\212k^\200\241\327p\363E\207\335m\226ji\230\037\315\323\022*\267\034i\020w\214\217\035I~\245\357\343\"\303\006\367\3622\322S\016\337e\332B\247=\255J\232\356\374\277\276\363\265\016@a\302\177N\b\252bf\317\2257\r;\361\226R\224\202\253\312\363qV\004\2571\374\360\3048\272Y\335\262\272\253c\216D\202\213\t\2049\375\311]\201\235n\243\332r\215\351\354B\337\225 )\t\360Y\b\200\2031\025\255\232\024\342\277\355*\245F^'\327\004B\341\356`\347:J\332EN\376B.\376\273\310\270\221]\206\321+5\0208~<\341\360y\n*\200\322\256Zy\353N\206\246\031\275\207\376\265'\223\036jmaf\r&0\223\340\224\335H\206\001`\373\243T\200\243P\322?UY\210N}A[\305\226\276F\360o\372!\266M\343\007\016|k\fC\003\363\037\212w\345)\3140(b\243"
+	.ascii	"\260u2\233~\315\020d}:\232cchg\037\004\371\002j\315]\214\226"
+	.ascii	"\253i\214\367\r\27598\341\f\231\353\245\317\"S#>\315\233>{\n"
+	.ascii	"\233\351\037"
+	.text
+	.section	.gnu.lto_mspSerialWaiting.35.31ed5a8dd7a83378,"e",@progbits
+	.string	"(\265/\375`\333\001\375\021"
+	.string	"6!xI\320\360(\035Z\370\007\352\247\035\352\261\231$\217\002F\022\032Y\273\264!U\210(TT3\020s\257\002\205\213D\240\242\277\024@\255\217\342\377\221U\020\001,\341%\006\320\223\017\263\330\n\320\f\246\3002\0367\332\032\331[\312\224\002d"
+	.string	"_"
+	.string	"c"
+	.string	"s\356X\333\343}\334\335)\205]\225\372d\\\205\371\261\253\242\200\03057\021\201LS%l\376E\007\270\241\037\220p\026\267\250\347\342&jnT\246tl0h!\210\307x\240I\250\006\022r\210\003p\214\232\256\273\312\2040\272\317\335@-I&\243EhsM\215\3149\255\264\360\303\375q\333=\266\025\330\327\021\266\243\230\036/\032\265s\316\330.\217\275\213\351g\230H\314\274;\366\312jy\334\035\245z\243ZW}"
+	.ascii	"\025v\320\314\204\377\211\232\223&\212\307\\\222HA\307\335\276"
+	.ascii	"\356D~\316\253\313\343Z>gS\203\317\315\347"
+	.string	"\306\234\273\220K\207\250.o\273\330+'X\340b\330w>4\004n91,\236\0028B A}%\337.\310s\002Q]\273EAO\333\375\f\247\027K0\033\263zh\022\022!c\316\334\021w\016\034#\246x\226O\027\344\321\200Q(\333'_\301BRS\032\232s2\260\275\341<\013'\252%=\3159\033\250x\021\212\017ti\027\006=\355\322\177}\227\272$5\245\023\271\270\337\353\016\201\027\031Z\023R\036\254\200.\225\017\233\210\\(9\001[/\t*/\024V\312I\t\n\313\004|\261D\n\330\245\322\002Y+.\027\310Z\355\346w\307OqU\215\033\212\336Q\312\207}\327\375\003\350\026\324;\222?\354\223r=\362\262\262\016\252\345q\200\332\267ZiS\313\250\215\307\271<n\371\342\256\366\271G\320\261\365f92\215R\r' `\202Ae\311\003\257\030\035\207\026\375\020\345w\363H\251\361\3164-"
+	.string	"\005\013\034\033\233\265\367\230\373\266\331,dm\314\321\036\005y%+\233\006\244\267\025\215\226\021\r"
+	.ascii	"\033-\n\277\021\211[\334\312tqT&\307o\243\274\200\306\366Uw\230"
+	.ascii	"Ru0\264F\354\327>\021\367\272\372\023"
+	.text
+	.section	.gnu.lto_mspSerialInit.36.31ed5a8dd7a83378,"e",@progbits
+	.string	"(\265/\375`\027"
+	.string	"}\007"
+	.string	"2\01647@\215\222\016<3\316a\304\306\362\312\271\225\377\335u&\024K\257\327\n]a@\250/\3711\307\033\337D\204\305\3370\f\254\343\3652{\304k?\366B\f\264O\210L\001s4\r\033\017\326\t1\200B\237\350\340\331|\"\007\013E\215\301\027\250\203E\210\353\302b\206\313BS\200*\243#\301\322\230\367\327\203j\353J0\373\362\004\270nrQhC\312\211\bN\231\244j7\325\221\210\213\252\265\204\350U\253uE\227Z?A\361\252\215p\262\352*`\366\\\366\240\306\327\222\320\364\226\001\017\324V\216\224\314\213\325JvVI\307\337\314\243G)w\312\202\017\021\013\022\225\314\214p\243\243\276\321-H1\332\226\365\001,d\346O\3330:\354\177\360'\374\251\n"
+	.ascii	"\357b\314\204\326\342\270\227?M\204\320\214\013\243[\260\370"
+	.ascii	"e\bp\351\026\355|\002"
+	.text
+	.section	.gnu.lto_mspSerialPush.37.31ed5a8dd7a83378,"e",@progbits
+	.string	"(\265/\375`\\\005\025$"
+	.string	"\252C\214\016D\200\236M:\231\367\205\354!6'\347\227O\263\222\267\335\210\336\360\361\226P+\031WW\203\n?\0034\213\002_\\\334\222\377\334O\221Q\247\206J\227\307\006x-\316\335\004\003\\\030a\027\322\2104B\210\334)\005\330"
+	.string	"\305"
+	.string	"\337"
+	.string	"\373e\241\210\253SYP6\210\324>\227{\365\336%\307\020\256Ny\001\301\020,\275\324\266\220\241\367\340\223\267\326%jfj\rNp\205\323w\361\260Y+V\231\231Z\353\004\023\225\037\217\345Yz\266P\fB\371\tq\201\371\274\250\325Zs\016~\200\374(\336"
+	.string	"\371q\237x/\006\357\033\355\375\274\231\245\215\034\305\245=\337\346\001\354\"\244\250|\251\372A\375\024qgB\220\210\025\244\350\315\311\025\360\246\360\345\003\254\253#\267\211\016\330\230\371\0324a\022\210\374\231\020#\347\217\212\216\342\205\036jI\004\374z\210"
+	.ascii	"\004\371\346\234?\037\025E\f{~@\001\277)\361\034\302\247\316"
+	.ascii	"\205\247V?\037\335\223\371\n\2562~\260\256\200\2476\017\265V"
+	.ascii	"\323\252\337\325\r\340\266\345\330\326\331c\031\265jP\3635G\376"
+	.ascii	"\326G\353h\320W\321 ?\016\330\013"
+	.string	"oB\216\224/UE\242\350pk\255P\273Zv\020\212n\223\341p\270\346mb3Pp0\377\320\203?\202\177\375B\357\362\027x\327\217;\232{\300\303\356\363f\232\324\345Im\023\251\311\033\365\270\324\242I\275\027s\323\222\372\r\002tm\375\276e\247\326 \303A\325l\024\243r\261\037\315\037\366\213\271h\337~\031\177\354B47\376\333\303\265&\255\326\240\214\362\243\315\374L\357bM\270zV\315*\\p\322j\025\342\"8t\003\344\307\370d|~\fS\343*s\242\374x\273\347\203\371\264-\306\302\327\253z\037s\270\302\322j\255D\037Mb\004\203c\315\2076\211\243\235YR\206U\177\306-\260\344\236\252\212\024\035Zh\307M g\312\027\337Z\201\265K\\O\016\027\331'>\226\302E\037\315$*h\007\337\316\357\250\360\267\3741\026\306\275\005\371\361\005\260O\2404\240\223,a\331$\326\212\325\341b\347"
+	.string	"\344s%\215\013\035\332FdI],\222\016Y\233-\033n\305\025"
+	.ascii	"\310+\317\256\270\r\320|kQt8\206)\023N\221\253\345\336y\220\270"
+	.ascii	"\r\200\345\225g\212\n\022?\350\217\225.\343jY\350O\344\356\377"
+	.ascii	"\270\370\331S\3718"
+	.string	";`\224\265\326]\nQ\272\242\350\220R->\354(\021W\313;\362\313\363\3023E\005\331\216q8\273\027@4\265Zk\321\033\243g\001\356\261\322\346nf\220\037\277/\200h\201\272^6\003\302\235*\3335Nf\224\203R\003N\274\035\n\246&%[\215&\034L\242\016\035\322\322\b\323I\307\333\245]\222\323\221\216\227\204d.\351l\330\214\234\214\220D$\245\243u\342\355\230D\037Q\260a\224\304\3235\315`jR\312-%\031)\345\216xM9\n\013\274c\322\361rN\273\035/w\006\353_\305\333m)%`\246\307\217Y\324J\371\347j9@\231\311\340A\250\310\326(\321\317\265\262h\232{\260\377\307\027\331\033J\364\333ZM\370\031\301O\232-\027k\255\365\266Z\266h\273=\310\227\033>\245\2025\327\312\226\360s\031\354\311\034F\326\326\220j\211\024\035\322(\363\017\250\337\333B>\315\307X\224\003\326\376"
+	.string	"\202\276J\301^M\217\0333\252\205r\271v\210\217=\rm\271\367\255E\255-\342c#\\t\004k\333\223\033e\250A0\204\220#D122\"B\242R\215\001P\0021\n\036;\020hX\232\244\320\030\216\210\240\314\223}|\316\310\320W{H\250\210d\311\"\313}\035\fOn.a\205<\300\244&%A\331\337\234G\036\306'\374Q\373F\220a\211C\341\374\353\177j\237\317\202\023\313+\270\311\264ns\222\335\322D\212\266\203\353\020\241\226`\262 \233\274;A\321\331@\t\222\366w\320\\\f^\241\320\315\212\367\"\002S\266\372p:\341j\301\017\rHJ\201[\352kq\371\"\234\302f\375A\221J\347\231\223\210\233\007BQ\203\"\330\001D\210\271\261\304\264U\222"
+	.ascii	"\214\355\242\220 \264\002d\340\257\340:8<.\354\244\271!\275\300"
+	.ascii	"u\013\273\221^9\\\023Wr\003\"\031\036p\255\254L\302P\001"
+	.text
+	.section	.gnu.lto_mspSerialTxBytesFree.38.31ed5a8dd7a83378,"e",@progbits
+	.string	"(\265/\375`\b\003\315\027"
+	.string	"\306\353\233H\260\330\230t\342\\]JE\217!6>\177U\020\352"
+	.string	""
+	.string	"\021\231)\2731>X\350Vw\322\216$\313\2664\032f\370\347\271\204\205\372b3\254<\037;K\2503[7N\310\211\352C\234W\205:9nC\204\220\275\345N2\212"
+	.string	"\177"
+	.string	"\211"
+	.string	"\367g\222yLy[/\240\274m\033\334\257\277\263\210\266>\022\205N\263\264\265i\213oF\3609\005\330\016\"4\233\353\243\n\343D\007W\031\300\250\310@\215\333\316C/\266\023U&\207\016\fz\266\016\241Y\021\360\374\260\270\023\235\0275\246I\256\212\214\226\177\301\2705s=&4[\213\327\332\240\212m\347\305\206\242\216V"
+	.ascii	"\035O<\255\331b\264\037\374\005\336\354\312\214\333\316\251\031"
+	.ascii	"\341\336\313\224f\273\235Ig\346&\314,\201\231&\tD\035\276\027"
+	.ascii	"M\366\275\327\325\255c\376\271\350o\323`.}\b"
+	.string	"<\233\245\255\224\373\2763m\312\177!\200\004\366d\270\343\322Q~WE2\350\032\255\021\034\037\376\300\337\367f>\363\205|\342\220D\n#\017\007\341?~\220G\267@FR\357\217[s\275_O\357\336k:o\317l\202\357\303\243\373Z\277\267\373\031r\327\305\312\275?\232[\2469o\371<\336c\202[\025N\274l3\273 \031\021y\003\031r\275\"\n\036\030M\322P\353\230\324e7\360\007\213p\t\f\255\261\241\247\221\272\032\201x\306X\273\370Ed\004\361N*\307)Gs\300;\224}\372\220\016\347\205\224\2709\357\275\335,\\Q\013\3551\213\022\243l\035S\0278\\G\313\225\347\366\214s0\313\013(\265u9\345[%\224\022\243[\230\331\303\203\344`\300\021\0350s\352@p\336\203\033\"\357\275\017\212\377\201\342\337\270\345\020+z\332-_Dy\373>\361U\t.\247\223j\302\352\304\312\331\020\032q\342"
+	.string	"\302\002K\205J\205X'U\263\315\202\01757\252\323JCj\205c\002qS\203c\262Q\255L\013\n0*uR\231X(\224\3124\372\335WQ\331\224\0060\002\0351\276\0326j\035\227\224\204J\2257\223\025)\315\315\256q\r\331\276\317O\344\256\213\214\b\005\220L&\223\237)\313\256)\270y\340\312ON8%F\267\274\336{\257\250u|\342\317\302\007\226%'\251\271\332\262m\327\230\023\334\354R?\370; `\002!t\271\003\177\f\263\241u\0046\241\016\307(m<\325\306N\215d\233\303[\217\226\026Z\244\b\201\230\005\326\305X\370\240\200\364Y\233\256Nm\236\377*\013\323s\321\212\257\231\324\226s\332d\371f\253f{\360\226\300k5\216\312\222bG\363.!{\215Z!\207\177)\272\034\367x\264\305\031>f;\b\032a\260\b\331\221\266\357\322t\340\016\255a"
+	.ascii	"\313h\035zi\271\f\023\241J\207\033\2367\336eS\333\311"
+	.text
+	.section	.gnu.lto_.symbol_nodes.31ed5a8dd7a83378,"e",@progbits
+	.string	"(\265/\375`\247\006u\033"
+	.string	"V\254\247IpZn\016\263c\020\224\343\250\211l\001:\200\001w\314\266\322\271E\203lH\375\323\002>\235j\3339\004\t)4\350\030\n\300\271\036\005\002\201"
+	.string	"\344\234\037\203>\024f\267\373\266\353\276\232\246\252n/#k\023\020Q\243D\222\f\231"
+	.string	"\223"
+	.string	"\223"
+	.ascii	"[\tj/=m&\022[\300\210m\344\356\225\253\365\216\323>r\021\033"
+	.ascii	"H\317\363\\\027b\377\200\330G\267\222\211\340\370\260}4\\\223"
+	.ascii	"63\017\333\330a\003M\347\260o6\b\355\232jvZk\363\275B\"F\303"
+	.ascii	"\26613l\036SwI\246\215a\330:K\304\013\273h\276\326\016\253Y("
+	.ascii	"\260\253\260\207\024\266\320TZb\0312a\347\230S$\354`\204\335"
+	.ascii	"\232\247\353\272.\204\335\343\364`\300\356\347y\236\035\354\035"
+	.ascii	"\324}\337+3\255\267\326N\256\234\tlN\256\301\3061\265\326\251"
+	.ascii	"W\352\007e\327Tn\354(2T\237M\262\360Q}\336R\253\317@\375U\336"
+	.ascii	"I\177\215\3454\346I\301\346\344\242\364\244\357\262\233\256\353"
+	.ascii	"\3320\246>\351\377\3440\"\372l\234\203~\032\243\262\177\333V"
+	.ascii	"\\E\007}\217\213\350;\231\374UC\236\202=\245\023\3531\334\275"
+	.ascii	"\3038\347\037\205\347\243o~\376Ic'\315\330H2v\200\030\033\tc"
+	.ascii	"\007\275\330C.6\321\334b\027Mm\255\306b\353\265\025\233\200\212"
+	.ascii	"m \305>\200b#8\261\023\230\330\n\244vS\324\006P\"\354\247\260"
+	.ascii	"{\216+VB\210\330?\026\261\237\306@\276G\225\276D\225D,\310\367"
+	.ascii	"P\356s\\3[\321\367@3\275\223\270t7BgE\211\332\373`\234\323\373"
+	.ascii	" \354~\006FK\330O\357y\260{\262N\213\315\330{(Ozr%.\366\236g"
+	.ascii	"\306?klm\313z\376^u}V\351\0166'\007\345g}^\227\3538(i@\320\365"
+	.ascii	"\245\272R\365\245`\177\253.u\362Q\375\250'\345Q\375'\330\227"
+	.ascii	"\340\306\224\r\325/&\213/QI\354\322\352\017\225C\370\030\332"
+	.ascii	"e\367(\\tG\214\301\347\275\356Z_^o*\360\027\26077f\225\227\262"
+	.ascii	"-\244\315\267o\355\tL\272\006s\026\327\326k\277]\272c\351 \303"
+	.ascii	"\303\327~\013{\013'&\345\250\375\237\214l\377\367\372\273\225"
+	.ascii	"\211\373\366\331\327U\231*\310\332\376\272t"
+	.string	"\377\361VF\346\355\247\311]\373\\\276$\227 \265\217\302\2553\t\343\206\206l\337ea]\026,4\243\232w\245\220\346=v\235<\223%\033\321\374*\013\261\277\276'\373\251\322u[\225\017.C\001h\250Q\024\b\224\214H\t\005)l\261\341\320\002\251\"j\016\021\200\030M\031H$\220\210*\022\021z\200#NNZ\225I\241\253\362\205\222a\017FG\t\301ep[e\363t\242\205\316AZ%\273\3564\264\367\324\367{\353c\214\016\360\362d\235\350\227\316\007\263\270\374i\321\307d\245m\003_\345=~\211\237\267h\"\0371\261Kt\016)\212 \205\351\372\236\357\f\275\306Q\236\250\317\367\177o?\3367\254\357\027X~~)\001>\216\301<'\343<0\375\334\254\275BH\300\320\233]\213\375\222\334\317\217\3606\306\333\371\036v\225\300\325\263\204\237n\232\341\254\350\202w\353?1\243\310\366=\b\001\361\223\305"
+	.ascii	"i\034\254%\203\350\277\314\302\241\002"
+	.text
+	.section	.gnu.lto_.refs.31ed5a8dd7a83378,"e",@progbits
+	.string	"(\265/\375 \251}\003"
+	.string	"\002\311\027\034\220E\205\016\377\377\377\377\377\177\\\251\t\255\225M\225<k\277a\260\233\340\210\335R\246\277\236p\370J\304fov\244\017\351?\372\216~\243\373\351Vt;\375\246_\375\245[\351\016\314I7\320\324gY\340\013\341\003}*\031\032\2408\243\370S\034\320\213\342,\276\342B'\312\202=\276\375\001\001\004"
+	.ascii	"3\005xJ\2001I\031%\212\031"
+	.text
+	.section	.gnu.lto_.decls.31ed5a8dd7a83378,"e",@progbits
+	.string	"(\265/\375`\fJ54\001j\003noV LI*\351^U\023\026\006\001\021\005Q\020\021E\001TT\r\3444ae\001"
+	.ascii	"E\224\375\343\253\274g\245Dk\265k"
+	.string	"\364\374\013\203\264\302\212Tu\215#\215\256\b\361\373f\247~\276\252(\335\340\247I\fBFa\022\373\335U=\214Q\275u\2556\302\b\331[\356\024\353\005\346\006\031\007\235\003\347\254d-\006;\326b`\276\025Q*;\361q\025z\334\342om#\363\\(W\202v\215\177\321\240\277y\350\337Lo\032\177+\265\262g\360\035\031t\322X\206)\246\265<\322\3707\016\275\025\353\030\375\242\237v\226z\362\222\325\334\226S\034\226\026vmG\251'/)\263l\345\274\002u\214n\262k\226\016H\306J\271*\300\257\234\327\377=\325Q\r\325Rv\355\030\355\002\004\b\020 ~\204r^i>np\303\030\272B\253\322\370\327\013\375\315B\177s\240\2774\320_\027\350oF\233\005\320\233\351\\\223\346EZc\2362h\316j}N\273G\207\276\247\240w\313\372\234\277\025\f4\313\342\224(5\266\201_u\256R\215\271)j"
+	.string	"{\251G\231Y\343\377\026\215Mc\377\354j\001\355\231\333>\353\267\201\005\264P\354\332]\331\320\026N\232"
+	.string	"-\2335s\307\242LP\016\3569\371\355\031\240E\273r\332\323\311NK:\024\237K\273\341|\027\353s\276W\364\267Tn\315\374\366\314N\261ez\311!\347l\216\013_c\276\037\234.;\364\2224~\027A\377\3331V\317\212\261a,\031\233gW\273g\275\334~\261`\216\327\234\227\260\310Y\272)J2{9\347[7<5U\336l\320\254"
+	.string	"7\370\201\354\236\255\263ww,\nE+\033\263g\005\316\246\355${\262\322.\315V\316+\320?\242\003\273g\257\330\264\273ne\245]\333\003\226\254P\351\372\313y\375\001\201C\346\207\016\270\035|\313\207\236\316n8s\254\317y\253\005\265\\\254\235]?\330.\302\2455\233\345\274\362\b\275\230\321\221\326\370\366\r\275\375p\362|8o\323\354\026k\206\026DM\343[.\324f\261sv\215\263X\216\311\226\331,\347\254\203s\305\226\246\324xE\3169\333\277\2356\203\203\203\203\366o\347-\026\212\255\317y\201\335p\336\316@o\225\320\247\331\r\347W@\317f7\234\277b7\234\266\r\350\226\212\317\031E\265\346\264\2343O"
+	.ascii	"\324\336\332\032\333X\237\363A\350\231\355\206\323F\261R\354"
+	.ascii	"\352\301\252\335>\261Nn*\255y\315y\345\351!\202O\312\032\037"
+	.ascii	"\003\350\255\207\363\016\016Z\017\347!\200\266\3659\263\316\032"
+	.ascii	"\2605j\032_\004z:\353s\366\330\r\347o\315,\340Yk<\371h\374"
+	.string	"\333\262\337\206Y1Kv\233`,sZ\316+\206\353b\311\231)\215\355\022\313\304\256\026\330\261\217\350\3407I\266\212\345\274\362\344@A\rY6\276\007\364\266\311y\310r\007o\364\326\202\323\016Z\013\316\257v\303\211Z\237S,L\371. X\020 \260b\277\r\313`\353\276\345\003\370M\007\374\235\257\211\277\273~\363\233\tP\001\255g\364\374\346\001\376n\341Z\340\357\021\\\023~{\346\352H\340\226\370[\275\025\200\300\245\300\337(\356\004\376\233\241\204w\271<V\205\021\277\365\340\036.\t=7\203w\300o\022\340\267\026h\033\243+\201\026nH\300R\277=c\373\232\314\337\036\356\b\367`U\370\206\037\013\3766\003\277e\200\037\320\025\341\177\207\353\374Xy#\220\302o\271\334\0202H\341h\037\336!\005[\227t\016~,\346o\017\\\020@4\336\177\013p?\370\233\202\2771\374\226\213\005A\222\321\337\003\370\233"
+	.string	"v\205\337\026\361\334\007\354\220\360\333\034\023)X4\024\027\003[w#\360_\b\374\327\003\253\302G\370q\337\337cw\001\030x~\273\363\333\236\377j\025\370\255\206~rI\374\026E\211\337\232\370/\345* \305\r\360\341\377\317\365\340\347\177\002~\234\344\357\241\333\301o\313\310iI\372\273\313\345\340o\022w\203\337\346\215\371-\031\266\025\277E\3766E\033\375w\304\177\201\332\311=\300oY\370\255\361\267u\327"
+	.string	"(~n\001\376F\262]~\313\007B\2053\340\307pUn\006\r\327Y\376\236\373/\001\376\246\273\003H\301Vp1\370\217\302\252p\016?\216\362\016(\316\037#\177\233\345\267r\277\305\322`\377\273\\\001\330\t\374V\003\022\370-\333o\247\374\326\255\204\337j\360[\024F\270\300oM\370\355\t\326\002\277M\341\006\340\277\207w8\n[\001\036\"\202\255\340\031~\223C7Y`\321\234L\037\013\334\016\177\007\336\n\376{^"
+	.string	"\374\037\363_\n\376V\376\275t\177\376\343\375\037\243@\210\313\341o\277\277AL\360\177\356\277\207\nz\307\2469\210\337\274\277=\321Vw\303oE\370-\005~\213\326u5\374GaU\370\333\304\177\f?\346\361_\237\377\362\374W\347\2778\377\025\376\327\346o\301\277\321\374\275\367w\336\337a\376\276\373\273\356\357\271\277\341\376~\373{\312\337j\177C\371\373\354o\262\277\225\374\355\365\267\217\277y\374\275\343\357\032\177\317\370[\352\357\027\177;\375\315\342\357\344\337$\370\333\205\277\223\376F\372{\205\277\323\277U\370\033\205\277M\374M\302\337 \374\035\201\277\027\360\333\260\337\376\3756\347\267>\277\255\373-\007\277\325\362[\267\337\246\3607\320\337\"~\033\344\267E~K\3657\210\277=\374\335\363w\006\177\023\340\357\016\377\273\374\266\202\277w\376\306\371\373\346\357\376m\321\377-\277\035\374\257\346\177\207\337r\370\377\363\337"
+	.ascii	"\277\005\361\333\024\277%\361?\205\337z\360_\355\267\031\374"
+	.ascii	"G\373\217\342\267\f\370-\332o\003\177\253\346\267i~\213\346\267"
+	.ascii	"~\277-\363[2\277\305\373\355\335o\355~\313\345\267[~[\345\267"
+	.ascii	"Q~\013\345\377\211\337>\371m\332oI\360\333\021\374V\004\277\r"
+	.ascii	"\301o]\370m\013\277U\341\177\340\177\300\377e\377\311\376\257"
+	.ascii	"\370/\367_\303\340\340\340\340\217\263\3767\352\317AZQ\b\370"
+	.ascii	"q\217c\253\037\277\200\227X\357H\226Sc\314\003\350\270G\216\013"
+	.ascii	"\027\\g\032\333A\353s\366d\273\341\354l}\316\343\020A\253p\016"
+	.ascii	"\034\302\266,0\2524>\016\215*\03479\266\272\f\3268\306\201o\234"
+	.ascii	"J\034Il4\306T;j,\310\244i|\034'l\003"
+	.string	"\323h*!\230\215(X\215\361\214\033-.\265\030\215\261\f!\233\240\026!S\377\2056V\362\254\224M]\n\353I\032\216\212!\310\004\327\3707}\350\217\241p\214\030h1\2524\306OJ2$8\032\377\006\f\272\342\360\212r\2451va\203\025$HW\343\337\270a'\334$\314_\274\376p\213\343\246@\300.J\215\337\207\231\376\013-\230\340\027&\314\204Y\200\311\235\311q\353<`%f\016/5\037:\325%75\306J\247\227\250A\246\306\2771\303\311;H\344\221\244K\343\337\020A\357\232+x\253\345MJ\217/PM\257\201}\205\251\271\353e\324y\307\2664\007\230F(\207\246\2666\346[w\234\266\344\235\375}\320I\343E\371\205\306\317+\212\352\251\361\355z\375\372J\354`3s\346\267\017\343\261p\222\321\370}=v/a\324\320\231)c2\215\351\020\302\367[&\255\003\231\003\206\270\250\027\032\217"
+	.ascii	"\372\345\373\252\302#\315\036\031\034$P:r4\276c\256\0300@p\214"
+	.ascii	"i\374\233*\364\033\344\201\351\331\365"
+	.ascii	"\346\375\212\001\361cSfP\351\006\306a\360t\304\246\214Y\277\374"
+	.ascii	"\342\375\027\314\265r\324\272q\326\370Z\237\323>\001\372\375"
+	.ascii	"\302f\205)\320\313]\030\260+\215\357\335mZ\0078\334))eG\272\314"
+	.ascii	"@\271\232\226\360\260\343\222\367\002\216\265\306\267.)X\345"
+	.ascii	"\251\361o\240\350\2664\335\2211k|\265\204!9\262l\374\233$*\327"
+	.ascii	"]\226\364\235]\333\221\352\311KJ&[q7\313\235\263\353\225\373"
+	.ascii	"\205\273W.\226k\345\312]5\273v\315\266\320\026eM\366r^\313\312"
+	.ascii	"\316\300@\361\007\273\3414\255\317\371c7\274Uy\222v"
+	.string	"\305\253\361uK+b\266\243\361\205f\320\377\267\355\262\331\365R\371\235b\327\334\264\346\234\337A\337\025\331\272T\256\232\025\221*\300\277S\007\230,X'\376\357\332/\274\231Csc\253\361\205y\350\205_\320\377J\351\212\022\004J\347\260\t\263b\225\366$\255\f\240\225\2704\261\035/\035\\a\215[\310\2707\240\312\262\222\227\205\235\222\275\314t=\022LQB&\273\257=,:\204l\341\310a\357\206lU\021i\321t\247H0E\t\247\312\264\366\254^\370q\205\330\335\330\303\252\262gW\314\312\211\355\335%\367\354:\271c\027\355\222\335\262kv\301\356\327]\257\222\233\3442\271M.\222\033f\327+\326M~\275\356\221%\255\333%C\031C\314\207\275\333qq\354\b\262w_\020\273\313\333\203\004S\224\360\205\035\220\275\234\327+\035{9\257W\354\016\271Y\226.-+M]\320\225\314\362\002\361s\201\034\201\263\313"
+	.ascii	"\237\253\335p\036\314\3552\2226\226\027f\305F\276L\321\272\\"
+	.ascii	"w\353db\007$\256\361\205`\350\205Fn\021\0364Og\2744\276\360\307"
+	.ascii	"%\322\343\006\311\361\232\202\312j|\341\214\013D\b\003\275P\211"
+	.ascii	"\036\365C\217\342\241G\351\320\377\366\270<\266\264\310\364\032"
+	.ascii	"\323\361\344\254\t\263\343\321\370(\034z\201\3659\217BA\217."
+	.ascii	"A\217n\241G\255P\r\254\317i\343R\325\300,\334\334\2004>\352\302"
+	.ascii	"F\215\223\313\222|F\343\267\006O\221\265:\037\215\357\f\2736"
+	.ascii	"\270\226\345\255\361`\324\225\202\272yI\027J\\\242\016e\335p"
+	.ascii	"\\\261h\374\337\030\277P7d+\226)\215\357\223-\373/\324\231\313"
+	.ascii	"\302\262\325\370\302\260w\377\205g\025\225\240W\343\353t_\374"
+	.ascii	"\027\266\0216\267\033}]\344(\325X\253k|\033,\350\373\256\367"
+	.ascii	"_\210\003'\304JK\343\333@Ao\023v\227l\\\331\\\241\267\353U^\245"
+	.ascii	"\033\301,-\177\277J\377\210\016>&'g\261\234s\007\035.Sx\271\361"
+	.ascii	"m\250\320\263\365`'YC\201M\222\266\027\260\004=\240KnQ\304\002"
+	.ascii	"/\207\215\274-\361P\203g\026wFK\343\277\001\273\017-\256\016"
+	.ascii	"\256\3617\270k\273\0353\347e\336V\317ii\200\0222\335\327_z\257"
+	.ascii	"\203\262\251\002_b\272H_w\261i;7\347\035z[\177}\246\375:M\243"
+	.ascii	"\261k\3675\337\273L\233\351\353-m\267\243\264\346(\233\"t\200"
+	.ascii	"3\376@\b\311\256\006\361r\260]\355\206\363\307\372\234?\375\310"
+	.ascii	"\374\330\030\\\334\004\033\377$\203\376o\275\316\263k\217\351"
+	.ascii	"0\357\"\355\345?k\316R\304\3044\336N\022C\316>\226l\345\274\216"
+	.ascii	"i0\215\327A\331\2241\332\352\307\366\205\225exYN\374S\n\372\323"
+	.ascii	"\t\3727^\232\335\034\fe\343\237c\350\317%\250\315v\303\371\023"
+	.ascii	"\f\375\331\2056]\327\331\225\202\346\222yl\031 J\251\306?\207"
+	.ascii	"\240$\310\331Rp\332\301AK\301\371\323\007\372\023\007\252Ag\221"
+	.ascii	"\373\260\245\244\3278\216\207Kp\016K\343\237Q\350\217\206k\247"
+	.ascii	"\2624{@JZ\314No\357\255\327\272\255\325\272J\2375\225\236\322"
+	.ascii	"i\355\326h\035\245\2614\224\266\322l}\245\237\264\024\2736\\"
+	.ascii	"\223\275\313\332\354?k\021#}\304\212L\025\340\237]\343\244\207"
+	.ascii	"8\211\201\245FSI\341\\9a\005v\260c\260\n\360\313\256\3116\315"
+	.ascii	"\346\nF\025\340_\027A\322`w,\n\205\242\034\263\367\202M\263t"
+	.ascii	"T\371\332\255\251\002\374\262k\354\340\323^r\251i\354,\2559\211"
+	.ascii	"s\367\"3\3511\022LQ\302\030eb\366\372\007\021\300\255\"p\235"
+	.ascii	"\325\\w\335\222"
+	.string	"\200\325\337^\316yI?\345\355\365\022\256y\364\025\t\246(\241\013;A\013\346\357\037p\r\244\207\354,\255Y\352\246LM\025\340\337\210\016\032\256ot\216\235\344\232\241\316\253\246*\300\277\234W\020 ~@X\274\031Xf|\3007\003\321\016\331n8\357j}\316\233e\320\277\307z\265a\001\030g\326\270\327n\262\346\237\234\035W8\2764\276y\207\336\244Co\266\241\035\266\303\004\315\027Y\343\233I\320\233@\222\364\227\371\242\016m\206\216$&\215\256\366j\027-\234\316\032\337d\321\005\270\365\346\262i\035\320\321s\363Z\323\270\265\200\336[7,\312\204T5\266M\316\240=bZ\210}quf\246\361\261\026\264\203`7\324\262IA\273G[\331\365r\355\343>np\351h|\314\004\275\275\334Y\002{\271\363\370\bj\351\254\317y<\004=\346\201v\216\356\252\326\361\316\3218>\242\203\347,e\261\234\327\027n"
+	.ascii	"\353H\033\230\274\274\333\367\263\274_\270 \251b\226\275\301"
+	.ascii	"\240\321\370\031\236|\371b\206\261=\2532o\314\036\026:1K\274"
+	.ascii	"\233a\006e\230\021ll\2021W\274%\330\023<\261\276&\215\237\001"
+	.ascii	"\211\235\235y"
+	.string	"\247\266\364c\373\023\316u\221\262\244\313\315\273\306\263!;\003&\231!k\313\026\263N\303\233\024\016\2305'@L\272\233u:l5\204\254e\230\302\202\305\234\373Y&\371>\270\361\230\263r\212bf\2719\227seG\304J.gM\3461\246\234\031',\223'fiGY\265\365\243\3613d88\024\370\262\274\276v\316@\315\210\"\323\326f\276Y\262\fu\202+\313\353+g\252\017h\225%\261\037Un\276\351`\245\241\242\243\261\351\206\325n\240\372\274t56\251\320M\231b:\375\300%\263\274\316-yY?\332\244H1\325~\226\027OiH\226\257\037\200K\302\250=\245\271\261\024\324JK3\241\374\240Y\314k\216'\313\017\255\250'7\241\3305\235-\037\\\326\254\314nf\236\331\236U\031\006o\017\213IV\021'7\317\336p\226<Z\3745~\037\212\2730[\242\304\304L2\373d\351\307f\313\364"
+	.ascii	"s\032\273If3D\313\325Tcs\211\271\262\350\n\\\232\253\331d\013"
+	.ascii	"\207\031A265\224\200p&\223\016cuL\021i\202a\t\t\022S\211%\313"
+	.ascii	"P\347\2172?\220\344\344y-\321\002\273\251\344HT\227%\215\315"
+	.ascii	"/\020[[n\215\315$'\363_\250.}\2015~\237\026\250@\300\306\357"
+	.ascii	"\271\202uS\b\226\351u\275\344\344$Y\206\262\231\022\2075\365"
+	.ascii	"\227\233\250>\340\214\275\030\253\323\272\351u\263kD\007\327"
+	.ascii	"C\277\220xQjl\032\371\016\325\034\225\275\3067\267L\256_x\323"
+	.ascii	"ue\226\244\361{\300\320'\200\254\206\224Tc3\353z\355\245\007"
+	.ascii	"\203\257\261Y\344o9T_\376~4~\237ID\213\225\235\262\2619d\207"
+	.ascii	"J\213'r\215\337c\0045\201\334\f\362\013\205Tv\\\365h\374\036"
+	.ascii	"!\350o\376\370\2056P\274Tm5~\317\025\372\236\035\250\225\225"
+	.ascii	"\351\343g\231,\223\001\027\325\007\\\245\264F\212\217\246\342"
+	.ascii	"\341\233b\201\245\361{^,\227&\217\013r\316Ly\005\230#\201{\231"
+	.ascii	"\212\352\003\016"
+	.ascii	"\324\223\300'<\354]\230$tZ\215\317\343gR\231T\346\216*G\242\354"
+	.ascii	"a'\0306\246t\334\334\361F\006\360\005$\215\315\034\226\216\207"
+	.ascii	"\307Z\024\230\306f\225MC\231\270HB\245\261\211\243\361\304r\244"
+	.ascii	"1il\336\370\033\231Z\034\023\345\223\021\254\033`j\3240\223~"
+	.ascii	"'\\\233\316Z&\365\324\370<q\246\fS\2069\243\357t\253;\227}a7"
+	.ascii	"g\b\271\272\254`<yz2\245\316$<\302\254|\355\344\301.'Q7\245x"
+	.ascii	"\226\224W\32646\241p\306X{fM\032\2331\252\220Ua\342\371B\315"
+	.ascii	"\027\346\0133i\027\266\225\251\250>\b\377\274$\221\322\370<2"
+	.ascii	"Z\2640\235~\272\222\200\245\311\322\3707\233n:aU%\305\324\350"
+	.ascii	"\374\374\322\032\177\307\f\372\233J\245\311\302NG\016\004\240"
+	.ascii	"X,\360\226\230K\366l-\253\322x\325@\225$\006\236\231\315l&\255"
+	.ascii	"\032\037\325\007\363\f\224\227\027\372\354j&\271xeAi\374\035"
+	.ascii	"*h` ^\203\346\234\253\222aV\276\360\2326\030T4\232\340<1\255"
+	.ascii	"\031k\374\03504h0"
+	.string	"`\007r|i\216\001\257V\337\322Kc\374\267SU\246\f\3563\003$Xw\346\270\017K\345\b\023\030\24316\203\2338\021cb\241\203\f_\0135\215\257\243\006=\326\263\230\f\316\303{X\017\315[&<\311\333\313Q3\020p\2352\350u\276\240X\257u\354<\3540\271\033SB&\214\022\346\005\243\361\227/X\f\232sN\366d%^\230\2550\307b\336\254\027.Wp\2151\036\0061h\306\032c0\230)\271F\025d\310\031\031Sd\215\257\34367\207\357:\347\234\267l\320\234\230\354u9\276\373\333NW\030\221&\215\261\035n\322I.\257\300\306\230\213-\263@\342\270\2444\306u\177\023\016\251\262\027\327\030\323\331\262*\265>\034\215\361\226\277\241\2027\220\254i\214\265\350\254ppX\316\002\275q\305\035\313\331\361HJ5\306Xp\023\034/#?\254\032\343+;R\331\317K\247\b\025*\370\315\362i"
+	.ascii	"VW\345\370\255s\334\324\360\373\372j\214\335t\242\240@\301l\366"
+	.ascii	"\212\251\013\263\3625\345\230\355\306l\357\254\2521^C\257"
+	.string	"\310\270\342k\214\243`\265\254f\005P\rK\271Wb\310\r\301O\030G\224*Xr\374\027\346\270\230r\333\321\370:J'Np\032W\033\332qZKam\3255\306g\034\254L\025\301/\230\212h\2755~\316\035\372\343\262\333\025\227a#\230,'q\356`L\305\375\345L\205\200\263,F\230\276\266\2600<\366\236\234\2632\347\035:N\033R\353\361\230\231DF\017+\215\261\030n\362_\310\001\030zvM\216\231\230\355\300\223\021'\304\241\204\213\335\222&\2733\342\264\370\032\277\317\264\362\313\233\322\3709a\350q\027\366:>\362#\030L\230s\316T9Y\006\003\032maV\3762U\324\207\037\177\035\203\331\264\034\254\032nL\032\343$6\355\277\360z!\322\026\330\030#\031\004\0344k\374\276\277\375\027b\032mas\215\237\203\205\376\267\357\377\314JQ9\347)s\315Q\312\234\363\267\267\246\265\037~\035{\355"
+	.ascii	"\376\343\234\377\337\223\340\300\232\225N\274r\316\366\f\332"
+	.ascii	"5E\251\352\202\374\377\037rN\332\234sT\223Y\217$\206&3\245\334"
+	.ascii	"\344\204N\nC\223Y\017\251\2465\363\340\220\315|\344\246u\231"
+	.ascii	"\304\313d\3169\331y\315K=\244\362\3222\211\324\264\346\250\274"
+	.ascii	".\223=yI\252\247iUJ6\231\365\220\262MfK\251&\263\245\024\206"
+	.ascii	"\274\224\223yI\211\007\272\264\224j\312\262\224\352i2S\222jZ"
+	.ascii	"\352!e\327e\266unk\217$S6S\322\3119\303X\267\22299+E\345$\227"
+	.ascii	"~\312=\366\236\362\216l\351\300V\0379\347d\032\030\253\245pU"
+	.ascii	"f\272&\257e\021S\316`\362\023\007I\233\\s\316-\2622isfZ\243r"
+	.ascii	"V.;@\225s\316K\333\245ET\326\311KJ0\224V\313\034&\345\262E\366"
+	.ascii	"\342as\316Y\252\311\314j\t\324vf\266\225\225k\3226\301X\346\255"
+	.ascii	"\f\246G\024j"
+	.string	"\226\264ft\314\206P\301\300\\R\360\220\2405~\016\023\372c\"v\305D\260\026\tkN\336D\031\303Z?.\202\263Z.\307\306\205\020(W\032\277\312\315*\210\006\301Bv\374^\364\3015>\016\230 X\370G\231l#G\343\343\260a,|\205\255\222\320I9\333\261\342\035\330J\330\224\363\024\006n|aV\376rT/\n\2014\"\252I6#6@:\0222\217\303\"!\254\026\211whxs\202\212\"Q-B\022\213\304\021\214(\216\306\021T\342\020\004\005H\221F#!\236\241\"\221HC1E2\356\250G\243\211\f'\324\025\251\tCE\"\321\317\213B|`D\241\246H$\207\027\205 \032\t\211 \032\t\035S\265(\002\321H\b=\301\210\242HH%\202\340\304Q5A\224\224\002i\323\202\212t$\202J<B\026\207G\024Hb\005\030\212D\025\351\007DI\037\f\025ExQ\210\364\210\250\002"
+	.string	"I42\"\036\235\036"
+	.string	"\24104LOPQ$\026\211\303\243\364\004\242\244\024\310\f$PHU\3421\003DI)\2208/\n!t\024\372\031\201\fJ\301\302P\020\t\241\243P\206\027\205PQ$\036U\244\210t(\311H\250H\024qD&\211\230\300\310(\251X4\026m\324\240\324\005\"\362\004\201\361X\244\032\2136D\303\324\b\253)\362(=:\323\343\b\310Tm\341\203\025(4\024!\223L\250\304b\t:*\212D\2258\314@\317\211\f\206\210J@\016S\243\364\004\244\020\251\036\215&Ru(d42\212\300\004&~\220\026\b"
+	.ascii	"\325 \204\020Q\305\260\004\022\362\350F\003%J\334t\310(T\024"
+	.ascii	"\341hx\034a\250\230\246)2\f\325a\b\035J\250)2=\346\fY\340\263"
+	.ascii	"\201(\351\203\023H\310#\r\027\"\036\323b\252\002=\007\036$\300"
+	.ascii	"\003\022+lT$\232\006\215\240!\rJ\221Z@qL\207\206F#\325hL\301"
+	.ascii	"\341BDI\037\250I\306s\2508<:2\2020A\032t\002\022\362\bGE\372"
+	.ascii	"\250G\325Dq\204\026\214\220\322\023\220\310T\310x4\201\204<\322"
+	.ascii	"\220\006\205\200\204<\332I\203\206\3520\004$d\211\242\321\204"
+	.ascii	"T\035&\031\rY\020\001\ty\304A\r\262\300\007%P\230@\217:B\r\002"
+	.ascii	"\302\3001\035\032\246$ !\217t\206\316\324\005\"\022\213@\036"
+	.ascii	"S\026\210\307!\f\364\244F)\206(X8\323\240t\310XB=\032\221n\322"
+	.ascii	"!\343\021N\203,\240\036\215H:H\243M\252\016O\030J\032\246@S\027"
+	.ascii	"\210'R\027\210'P\025=\346\f\rS\022\214\210C\024\307\224\210("
+	.ascii	"\351\203\025j\316Q5\361ssTM\244,\020S\241\364\004\024\212C\244"
+	.ascii	"\023+\216;Cu\030\302\212\343\316Q5Q\302\nB\303\024FFC\020R\243"
+	.ascii	"!b\316\213Bl@\006\341\250/\nA\224\224\342h\230\036U\244\210\242"
+	.ascii	"\361\350\310(\024\200\241bz\221ADI)\220\347QE\272DI)\356\320"
+	.ascii	"\221\320E\252\030\032\021\2316\252Q\0222=\236\351\2218$T}\220"
+	.ascii	"A\352\321h\002\ty$D\006\345\250G#\022F\226hA%\262@T\205\"\240"
+	.ascii	"\"\207F;i\320Q\252\"[8a\002\tyD\201\212L\223>\220\236\240\242"
+	.ascii	"H\034*\246H;iP\252\016\325\023H\310\243\233T\035\252\310 !\233"
+	.ascii	"4\310\004"
+	.ascii	"\022\362\210'Ej\001\205\232\256 4D\272!J\372\240H4\221*\206F"
+	.ascii	"#\f\035\t\241iPN\321HD\036S\f !\217n\324\024IDd<\221C\242 \265"
+	.ascii	"HL\322I] \236\030\252\303!\024h\304Q\022r\005\241\264HHhd4~\020"
+	.ascii	"d\242(R\211\031\030J\217\303\"\244\217\032\024\002\022\362\210"
+	.ascii	"\347hL\207n\324\027uP\203\220%\322#\242\212\"K\244IC&2\b\t"
+	.string	"y\204\301\304\211\022CGB'\262\204\321\220\205c\252\026\2117\251\013\304\023\351\321\360H$D\352\250\305$#\bH\fE#QE\"\036\205\220)\222N\250+\322b\317\216\372\242\020\"\214D\0167\"\245G\021\252\321x\024\201\323\302QM\217R\243T\345\200\f\312\240\006\215\330`\005\344\260D\321HT\205\212ID9iP\t\352\321hb\202cJ$\"\252\305t\210x\203\204<B\"\251\300\260\"\035*\226\220\252\303\343P\3220E\320\nc\212\025\204\206F)&@\252 \022\025\215 \250G#\022\216\032\344\001\220Z$&\241.\024\005\245\352\360\030\224\252\303!\244\244\240\r\307T\025\032\036\207EBA\252\321\230\"=\366\250A$\324\"1\311\346@@ \\\200\202\t\022@\205B\030\r\211\307\024\031\204\204<\022\201\204<\022Q$\016\217D\b\035\221\"BT\360\377l3\223\370\311\r Vl\200D\240"
+	.string	"j\231\262\306\312\223\325\032N\213BSc\246\326'\202\324U\032)x\254\212\f\252\272(\370\rk\255qQ\203r\312\030\341e\353\251\361\316\211\204H\213\266\306\277\245\3623\215\253\0039s\330\021,\362b\013\232\271\207\023\003\315\233\324\0316\362\302\315\017\206\023,\327\205n*\207\031\026C\001+*]f\206)\243Z\023\207R\271J\243\322\370\f;\303\316\325FE5"
+	.ascii	"\214\212\2273\177\231j\306\207\377\\\362s=\233,=\241z\322\370"
+	.ascii	"db\203\300%\2034\276\006*\350)f\357\354p\204\371\242A\n\372\237"
+	.ascii	"J\310\374th\201AA\343\262f\340\3702\325\344\246\034I\322(\024"
+	.ascii	"#f=\032\t\276\343\241J\222m\035\271+\362\204\356\214\027\006"
+	.ascii	"\273g\222\\\211\322\205\365\244`a\221<\207\3744\362\237D\316"
+	.ascii	"\"'\227\013\203\202h\032\237Z\347\326O\2563+\237\\\034,sV:\271"
+	.ascii	"x\002sV\342\301J\254\264\240\234\370\032\320\320\203\261\033"
+	.ascii	"N\035\353s\332/@?\207\340h\261\262\327D\310\231\206$\031\265"
+	.ascii	"\306\347\217[\202\301\301\301\301\300\234\225\316\037}\0069\201"
+	.ascii	"\374\374qk1\260\026\003\036\0330_MJ'\326\236N\221.2\345\325\033"
+	.ascii	"N\223B\003\215\017s\356\206J0k\316\352f]\232\267\031i\032\237"
+	.ascii	"<\326\035-_\274\200i|\re\350\177.M%x\b]\032\030/4\227pl\213\232"
+	.ascii	"\254\035\246\323\315\325\230,[:0[\316\330\032\331\221\034\246"
+	.ascii	"\240\217\033~b\316\252\263\305\330\2149\245\306\253\315\030\031"
+	.ascii	"\266*7L\026;\202\260\360B\205\265r\254\224\274m9m\230h\312\334"
+	.ascii	"Pr\245\206\017\017@\200t\2354L/\272&\203A\032KI\23524\260\271"
+	.ascii	"\305\331U\216\275\353\007\345e\343\234\372)c\006\0262,\r_'\324"
+	.ascii	"\t%\225\345\365'|\3421\206\243\3615X==\231N\266gU\336\305m\341"
+	.ascii	"p\262\345L\360|q\2760\235\234\\\231\212\373k\0232\b\250w:\235"
+	.ascii	"NC\246\342r\254\372X4i|\237+\203\203g\013\rln\201v\327d\3572"
+	.ascii	"\361s\323r2\375l\201\325\204\200\3018\322\370da\351l\320\370"
+	.ascii	"\330\322\325\370\\\302Cp\234\370X\353j|*\357\215 a\22445>\225"
+	.ascii	"\256\207\227|p\3115>\223\366\216Gl\007\025,\215\317|\263\254"
+	.ascii	"\0326/NW\310Y\220;&\215\357\363$M\032S\320^iM\305u\024\026@\270"
+	.ascii	"\002o\nj\231S\203\245\261\251\306\3643\373rv\245\261\th\327\272"
+	.ascii	"|\021\003\202\244\314\313\230h,Y\206\332\271#2\025\367\3073\266"
+	.ascii	"\246\f\212\231\233hL?\034H%\243\231~f\037]\\\215\036|\024\244"
+	.ascii	"\305I\231g\254\227\n\364\232\324\360\020\265\2723\265\306\367"
+	.ascii	"\3211f\214\271g\3112\024\220\222\222\250/s\214\222\027|dn\356"
+	.ascii	"Ii[\343\200\374\001\205U\250\303\001\244r\\&\306 g\035B\312\320"
+	.ascii	"\310\314(\255\001\363\025@ H<\032\225M\327\335\033\023\300\304"
+	.ascii	"\013\354\224\201$\347\030rfF$I\222\302>\007\362^8\245\274\374"
+	.ascii	"\205;\306\344a\326Z\340\350\203$\377g\367"
+	.string	"TZ\314\244j\314\021\020\211HE\030\177\352\310\006\013\0038\214\316\341\346\bC7I\324\376R\225hs\272\032\236\0207S\204\035\206\361 \377RX\311\022\330\tr\016*\362\335\020\213\253\246\347,\366\367\360$\307\r\005S\325\222\320\243^w\201 \r\0204\225\274\341B\376N]\t\230Xzx&\224@_A\312\244\3347C\375\314\0210\264GT\031\247\357\255&]\310:\034\236dt\232\001\217\215\223\021\351n\"3|\\g\250r\312\f\242XQ\203\241Qj\203w\313u\345\336\304\221\nH^\330@\260\260\003\332\244\235\032:\211\212\007$\365\346o\222y\341PyK:u\360M-f*?\234%\233M\006\215\025g\327\260\205hIX[sC#\2160\344\247\223\303I\223\034/\325)\307\263\200\230,a ^\263\361\277|\333\204\351\367<\303$\030\3778\251\373\277i\200e\223+\027\3478&9\203\027\300"
+	.ascii	" \212x\b\200p\302\3466\264\230\220kd}\210\276em?\250\226\022"
+	.ascii	"\372\232\206V\3204@S+<\032\351\317\273\273y\253@\251\372\350"
+	.ascii	"D%D\273B\303+\037T[\355\210\362\032S9\364\\\320S|\3553V~\315"
+	.ascii	"y\306\035\013\3205@\026\302\013\b\316\2451\020\254\327\0024Y"
+	.ascii	"\\\005aW`\226\t\274\013\034\024\350\347\260'\360\253\276 \334"
+	.ascii	"\020\f\030\353\207r\360|\026\310m\313#l\007\270\226\347\267\335"
+	.ascii	"qF"
+	.string	"\321\254\312\264\354s\332\200g.\2473\017t\352\301\205\210%i\r\271Cu\366\210\213\234\r\035F3o\271!\216\247\203\360\223\357qh7@\033\351\237PA\241\377\2575\335Y\2545\334-7_\320\362\344u\246\036$\351.\353&\277\034\260\233\032F\353\350dn\313\235K<\262\321o+?\362@\226\245}\213\021REs\226/\342ol\240\324\003\226z\355\321e\3032\235\242\323\233\031_\025\2248\336dw\271\375m|\303\275\022|Z-b\263\325\210\252\334]\013\272\351\216s\020\367\007\272HT\366\320\377\355\215\246~^\224\200Hh\365a\337\340\277\345oV/\003\372\\\b\277*\301\0338\313\246\334\275\264\224q;\353\337\001\275\226F\326\003\301j\200\020 \337\t\b.oSj/I [t\341G5\241<\255\353\033v\216oG\200\213\022\225\222\017\362\277G\240\204\n(\177\266tVDR\275Y\017\036\240"
+	.ascii	"4\310\006\020\206\256\356j\224m\310\242\372\223\276\203\245\260"
+	.ascii	"R\364\340\201\327\223\223Z\205A\343R\037E\272(x\232\213\277\254"
+	.ascii	"\266\013\316\003\026\302'\nK\333hD\375\024\332\261\t6\002\357"
+	.ascii	"/\323\205\315\244lju\3643Z\255\357g\313u?G\003\356u\336`X\305"
+	.ascii	"\342\336LR\353\215\263b\r\361\321\023_\270\315\311\364%\221p"
+	.ascii	"\372B\257\323\314N\265HO\233\202\332v\333\204\242#\213o\357\036"
+	.ascii	"\016\"k,1\006\346\363Y\263\270\364"
+	.string	"#\003a\216B\344\306iQ\037er\275\007d+\341,\0245\274\304\372\275\272\020\366\371\233\211\304\023/\202\f\220.\326\315\034$\367\3144vF&\036|]\3678j\372bO3|9j\206\242\307b\316\351\377\267\3226\240\t\"/m;\227\250\365\247\363z\020B\310@\272\330N+\0320\251\016\021\177\025K\333\345D\304\225=\240\032\337\333(I2\344\270\b]\202\021\003\23142\212<\350\225\370\372u]`t\303\364\343S\f\300\030\023\224Y\003o\275+\207[\362\335\211-\205\002\021^N\230\006\215l/A\317e\204\323\234\374\351*\021\225\037\372\226~ve\037\222\\\327\364\274\n\255d5\321\245\030\020\033[%\336\220\255\226\223WT\244A\3774\2332\232U\024\271a$?\2720\331\326\271\264\020\220\263\277t\323"
+	.ascii	"\005+u\371\035\021\005q\362\016\006\331CM~M\343\233'U\222\017"
+	.ascii	"\366pO\263\245\310Js\335R\226<\376\217\354\303r\212\366\301/"
+	.ascii	"\313\246A\341\317\032\017\277\342&\200a`oe\227D\204\330\005u"
+	.ascii	"\352c\246\013\370\022\306\234n\035\200\216!\321\301k1\001\250"
+	.ascii	"\177q\016(\025c\177\257%\017R\205\251\304\200\330\346\204\rW"
+	.ascii	"\022l\336\021@\247\016\230\034]\"\216\005S\263\360\352G\321X"
+	.ascii	"2\234f\320\354\254<\306\300\321=\336\250\321|\r\225N|\316\021"
+	.ascii	"z\241\312\343t)\226\221yla\335\266J\003\310\0220\230nMY\007\223"
+	.ascii	"\273\210\226:\363\240t<3\377\356\036\376\217\030\251\257\355"
+	.ascii	"L\024\223;\253KE\232\363\305\351\246\006\246Kwp\352\3425\325"
+	.ascii	"h\023\"\n\336\304\212\004\232[K#\025\351\222=\340Rh\341w7U\035"
+	.ascii	"\027\001+\267\313zQ\267\241\206K\274\351\177\244\200\026V%\305"
+	.ascii	"\322\rG\220\341T\265\177\256\243cx\372~\206\321\212H<\f\303G"
+	.ascii	"\t\005R\017;]\360\f\344\326\214H=\314\2040\323\254\020\356\343"
+	.ascii	"N\303\217\327P\300\377\f1/\034\312\330B\206r6\361\027\377\371"
+	.ascii	"\321\353\265\203?\255"
+	.string	"\320\3334^\255\235\033\255>\023v\271\302$O\356\310\212\246_P\324\020\264\372\201+1M\344)\027\006\r\345\004gZ\315\016u\313}\216\355\204\322\207\236\355\027\377J\264\360\225\341y\366\316\360T(\367\210\262+\304\246t\bm\2636\330@Y\256\370\273%\035\270\213\345Q\265\024\032\223\217\034\030\036%\003*\312f\332\270;\236kfK\230\362X\200\t\373\245\322\345s\254\274\314\004\332\004\020\005\005\022\374\303Z\337U\253\267~h\367\360\262\004\274\177\354\373U\354\334T\025\246_\200\324'-\204ugWW\036\325D\274\321\312e\223\2201!ll\\\362\273\316\030\260KW2\322\"\240a\227\337\355\007\034U\266\252\220\334\316\315\267\366\262\322\357p\211\355g\t\325\267\225\331\032\307\361\345\020\264A\036!\370S-\016p\357*9l3\200\003\f\210{\013\311\333\271\234\242\236\301\277K}\367% f\332\220\357#F\367"
+	.ascii	"\032\017A\362\027\355\346\245\\\023x\355\204eYm1\2424\332]p\203"
+	.ascii	"\352\270\316>W\027\330k\3574p\275&\005n?.\2735n 9\"\023\002\013"
+	.ascii	"\316\306\334mF\334\310\240\355b\322\375\004\327\016M}\371}2\023"
+	.ascii	"\220\330\206K\310\007Zb\025d:\324Q\360\245W=M<\005\310c\301a"
+	.ascii	"(\300Q\211\267\223\024-eZ=\212\217c\203\266\021^\216\201\347"
+	.ascii	"\205\364\r\361\367\327 t\254\320\tU&`]\352x\207\255\270Q\261"
+	.ascii	"Nfy\323\251\270\257\230%\275\005\327@)\030O{\363\255\364\204"
+	.ascii	"g'\326\204G\275\223\277u\316\277\240\bP\373\257\327\307\371\034"
+	.ascii	"\006SO\201\370\033\260\016\203\n\341cK\234\007\232\037y\315\004"
+	.ascii	"\222\2067\023\003\236\243\f\206\3547\355\013\316\360\tv\256\346"
+	.ascii	"\225\306jT\255\027\200\305\363\214\270V\331P\366\035H\225L?\354"
+	.ascii	"J:\300\346s\270P\303W\337\225\003\030L\"6\3763\177V"
+	.string	"\227\375\005u|J7\367:`\351\357!\337\314\204\340\257(\fR4\252h\365\3619\300\235\372\330\324\250jV\213\213\002/\036\217\222zZ;\325SK}w\351\001\203\245\372\342\217\006&\266\355\034\251izJ\304\313[\213\201Q1\243x\f\276\327K~)?T\265\017\375<\330\002\372\300\205N\255\201\250vc\215\224\244I\242\245\374\027\203\351\317\214U\265\306\343G\007\310<\341b\271\006\035S\371\204\372\222+,rOd%\\r\021\276\343\355\201\235\223=<G\3262Q\360\304\021lX\362\264$1\361\337\315\310\224\276\256\221\n\355\016\321\203\202\266\220\324\230Q\224\217\211\251\n&\266\224\312\212\253X\001\376s\032\310\2356\266y\204\276\322\003'\246\335. \302\241E\354\360\240\336\216\315\344\2732\200J\272!\344\314l\033\266Xl8{\356\324\203XyQ\365*\300R8\217\f\336\273o\266\013w\r\366\007\243\274"
+	.string	"b\334\3072]\226\262Q!\375\026xJZ\370^p\350a6Zh\\i\023\331\200{\310\271\033\205\242\364?\247\013\031\254\030\362-o}\221/\001F\333\030\030\245\354Bt\217\376t@\366\177\373\375\030}D\335\373{\023\335\370\205\326\177"
+	.string	"\247o@\3255\022\271\266_\2235\263\030\006p#A\335\305\262\026\272|b\304\303\247\271\271\247~\002\204\267\021W\327\267\337\260\tA~0\375'J\356\213\356\266r[\315W?\215O\3369\022\275\033\277\257\273\357\331\344\002\220\1779\366\r\221\001\323T{\257\n?ci\237\306\336\360\365\013\210KR-\004\342"
+	.string	"\246\257eg/\274\251\372\035\225\357\215|\003\371\335\271\034#;\277E\372i\275 \332\313\331\317G\273\270\006="
+	.string	"\377.\313\021\307\346g\314\241\245/P\370J\305\321\244f\233b3\313\236-\033w\260\372\371M\343H\366\353\346\f\230X@\354\005\362\231\335\212r\263\337.\343f\332\016\256\270\205\350\375\255\023\274-t\0173\031[\316\033\350\370\231\302/R\035\204\037P"
+	.string	"\206\332\2301\374J\"\371\006\370\215\254\023y4\203\3172]\237\344\353\334\214\271o\351\333\001n\375x7k^\246\315\211\304\2271\325\241\223\036\211\311D\262\247K:\210'\303\016\214\367\020\256\220\331\r\356W\336\350o\2413\367{k\364\206\310Ku\322\036\306X\315\024\333\225P\230=w#\033\213\251\230\343\351\303\257\357a\230\266\027\362\202c\006\336\241\032g"
+	.string	"\303Ye\207w\007\372\337Ny\250\035\250\346\372\031\263i\327\033\223G\336\276-\266h\351\207\350\277\215?\220&\336\263\263z\3708\344\351\245\3055WyN\303\035;\354Lsvv\370Q\343A$\036\276N\2650\005\352\022\355S\371\325T\353\251\242x@\3612\317e\332\037\231<\302\035\037\251{\244\217\323\373"
+	.ascii	"\370\347\330`xs\277\001l:\\g\234\315y\323|v\226\274g9\033KV+"
+	.ascii	"\247\027\334(\376\275\313\026\304\337\301?\260\016\376\372'\235"
+	.ascii	"\nN\3667\273\002"
+	.text
+	.section	.gnu.lto_.symtab.31ed5a8dd7a83378,"e",@progbits
+	.string	"mspSerialAllocatePorts"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\002"
+	.string	""
+	.string	"mspSerialReleasePortIfAllocated"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\002"
+	.string	""
+	.string	"mspSerialReleaseSharedTelemetryPorts"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\002"
+	.string	""
+	.string	"mspSerialProcess"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\002"
+	.string	""
+	.string	"mspSerialWaiting"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\002"
+	.string	""
+	.string	"mspSerialInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\002"
+	.string	""
+	.string	"mspSerialPush"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\002"
+	.string	""
+	.string	"mspSerialTxBytesFree"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\002"
+	.string	""
+	.string	"serialConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\002"
+	.string	""
+	.string	"baudRates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\002"
+	.string	""
+	.string	"mspDescriptorAlloc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\002"
+	.string	""
+	.string	"crc8_dvb_s2_update"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\002"
+	.string	""
+	.string	"sbufWriteU8"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\002"
+	.string	""
+	.string	"sbufBytesRemaining"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\002"
+	.string	""
+	.string	"sbufReadU16"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\002"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\002"
+	.string	""
+	.string	"serialEndWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\002"
+	.string	""
+	.string	"serialWriteBuf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\002"
+	.string	""
+	.string	"serialBeginWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\002"
+	.string	""
+	.string	"serialTxBytesFree"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\002"
+	.string	""
+	.string	"isSerialTransmitBufferEmpty"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\002"
+	.string	""
+	.string	"sbufPtr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\002"
+	.string	""
+	.string	"sbufSwitchToReader"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\002"
+	.string	""
+	.string	"cliEnter"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\002"
+	.string	""
+	.string	"systemResetToBootloader"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\002"
+	.string	""
+	.string	"findNextSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\002"
+	.string	""
+	.string	"isSerialPortShared"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\002"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\003"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\003"
+	.string	""
+	.string	"closeSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\003"
+	.string	""
+	.string	"waitForSerialPortToFinishTransmitting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\003"
+	.string	""
+	.string	"serialRxBytesWaiting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\003"
+	.string	""
+	.string	"serialRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.31ed5a8dd7a83378,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,324 @@
+	.file	"motor.c"
+	.section	.gnu.lto_.profile.a4b23c1eba835a26,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.a4b23c1eba835a26,"e",@progbits
+	.string	"(\265/\375 K\215\001"
+	.string	"4\002?"
+	.string	"\004"
+	.string	"\301\253\323\333\017\022\002"
+	.string	"\002\001\002\002\001\305\377\344\314\003\002\240\342\234\212\n\003\240\342\234\212\n"
+	.string	"\005"
+	.ascii	"`\013 \260\222w\327\022\f\260"
+	.text
+	.section	.gnu.lto_.ipa_sra.a4b23c1eba835a26,"e",@progbits
+	.string	"(\265/\375 \027\235"
+	.string	""
+	.string	"h\013"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.a4b23c1eba835a26,"e",@progbits
+	.string	"(\265/\375 =\325\001"
+	.string	"4\0031"
+	.string	"\001"
+	.string	""
+	.string	"\024\341\222\204\270\002j\001"
+	.string	""
+	.string	"\002\021\340\222\204\320\002h"
+	.string	""
+	.string	"\017\362\353\201\300\002f\002"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\r\001"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\220N"
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.a4b23c1eba835a26,"e",@progbits
+	.string	"(\265/\375 ;\255\001"
+	.string	"\304\002/"
+	.string	"\001"
+	.string	"\001\001\003\177\002\001\004\002\006y\001\004"
+	.string	"\001\300\004\001\004\300\004\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\004\001\007\001\002\006\035\001"
+	.string	"\006\035\001\007"
+	.string	"\002"
+	.ascii	"\276\210\261\2016"
+	.text
+	.section	.gnu.lto_.pureconst.a4b23c1eba835a26,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.a4b23c1eba835a26,"e",@progbits
+	.string	"(\265/\375 b\035\002"
+	.string	"\002\004\f\025\300%\035\273\276\177\323\377w~\320\246\277\037\226\2405\322vJ\001\272\031\267\024=\300\366\261\301\270[\271D\253t=u\341\222\001\221\204V0v\211\006"
+	.string	"4\005?u\372g\303L\221\007B\331"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.lto.a4b23c1eba835a26,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_motorConfig_Registry.15.a4b23c1eba835a26,"e",@progbits
+	.string	"(\265/\375 \231u\004"
+	.string	"\364\007i"
+	.string	""
+	.string	""
+	.string	"$"
+	.string	"\005\001\212\001\202\200\200\374\342\203\246\277\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\346\006us\350\376\005uq"
+	.string	"\005\001\006'\001\034\005\001\006\035\001'\001\206 ?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\026./src/main/pg/motor.c"
+	.string	"\004"
+	.ascii	"\237\n\013&\321 \212\274\001\024\001"
+	.text
+	.section	.gnu.lto_pgResetFn_motorConfig.16.a4b23c1eba835a26,"e",@progbits
+	.string	"(\265/\375`\300\002%\024"
+	.string	"6c\177I\260TN:t.q\n\016\367\256R\003Z\003Rdd*\317#\323"
+	.string	"\256\352\251J\227\347;[\200u\331x(\376\372[km>\371\250[\356\033V/\340\304F\177\331\226\207\220\204\341\326\\`\267OY\347\305\326\310&r\247\024f"
+	.string	"e"
+	.string	"r"
+	.string	"g\332y\254\326#\253\251Z\313\005>"
+	.ascii	";u\371\001\340)\354)\340\251mv\020\002@\001\242L8\361j\255\341"
+	.ascii	"\2720\354_y\177\323v\372\355\264\371\270\0270\222\032I\236\323"
+	.ascii	"\3575\204\002\353\204\004\372^\270"
+	.string	"\204\030]\367)D\372\314O\006\321\367\272'(\"2\222D\237/\t\265V\317\221Lq\203\267M\263\355\300\336WP5X\255\265\201\377\2443B\226Tk\375\213S\177\007<\2650\2037\244g\366\354\222g.\222\375\027\256\240\030\336#;\266\323&g\372\351s\367\234\323\027\020\202\005\327\225\324\376(\353\211\336\221\272\243TJ\317\335~\351\353\232^\303\366\234\253X~\312J>(\332\272\265\234\232\001\354\224\345{\211\355O\373\267\323\260\005\326\360\253\r+Y=d\024\310\330\2252M\366;\fhw\3600?~\257\373\225\236V\354\200\226\307sM\326s\354\352\231\275]\250\241\"9v\221b\316c&\263R!irZ\372Z\310|\007\007\034\357\2255\363*\025\b\270%\224)\232S\325T\"0\361H>\003\355\232K\315\242`n\274\335\331\374Fm%\313\342m\2108\275p[\202\301x\r\264s\036$f>\334T"
+	.ascii	"@S\003\342F\234Pb\031\027\232\250#\332\20448\341MM\214M(C\313"
+	.ascii	"\t]d\026qfh\241\216(\322\302\222\262~\217LA\307\256g}|\202\341"
+	.ascii	"X\263\343\216\200\304A\027\311(\343\306v\265f\313\347\n\271\n"
+	.ascii	"\234;\261rZ?\323\310\277Zk\375\024|nl\277UD$H\205\317\354\371"
+	.ascii	"k\273\304}d0\220Tk}q= \260\002\031:\242\007'1d\337\023\031\036"
+	.ascii	"\242\311\275\213W\256P?/\3207\271\374'r\221\025~X\371\302\332"
+	.ascii	"\003\204\263\207\204\202{M$\341\217\262\304\210G\211\225\352"
+	.ascii	"\276\205\314\271\335\210<|;\322\201`\357$\007\2767\2159\314\241"
+	.ascii	"\021\252\200\367\206\206\332\305\333E\207\207\257[\261\213^\270"
+	.ascii	"pZ\216?\226\262t\025!L\253m\206\205w\266\274\354jg!\254\371i"
+	.ascii	"\267Y\f\213\340^\250\033\357G\244s\345'"
+	.text
+	.section	.gnu.lto_.symbol_nodes.a4b23c1eba835a26,"e",@progbits
+	.string	"(\265/\375 j\035\003"
+	.string	"D\005f"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\020\177\006\260\206\3618\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\300\202\002"
+	.string	""
+	.string	""
+	.string	"\005\017\007\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\f\b\201\204\001\r\t\001\021\177\n\377\037"
+	.string	""
+	.string	"\200\200\200\002"
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\004\321\371\216\307\003\001\244\006"
+	.string	"\004"
+	.ascii	"F\020\002\2275\313\340\013\201\202\002"
+	.text
+	.section	.gnu.lto_.refs.a4b23c1eba835a26,"e",@progbits
+	.string	"(\265/\375 \ri"
+	.string	""
+	.string	"\t"
+	.string	""
+	.string	""
+	.string	"\003\001\002\002\002\003\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.a4b23c1eba835a26,"e",@progbits
+	.string	"(\265/\375`&\016\345L"
+	.string	"\352\210\344\035T@R:J\007\236\211V\t\367\352\222\255\025q\244l\320\\\017K;\220G\3345\231\371i\035y\303\336\216\255t}\326\274\365\023\341D\264\024\263\366\356\316\372\013aU\343\214\023\273;\347\356\016i\"\331]\312J\t\205^0yI"
+	.ascii	"xhK\342\354\222\021+e\n\214\001\307\001\324\001_*c\013\266S\353"
+	.ascii	".B6\265Y\016\320X\262\375\262`\2334F \305KYw:f\233X&\266l\227"
+	.ascii	"X2{f\315l\231\025\263\310%\3330\337,\313uN\273\205\335\375\031"
+	.ascii	"\377\355K\266b\213\325\342G\367\261\b\013\251(\276\246\234u\247"
+	.ascii	"1~b`\340D\f\r\213\362\334T\317?\352\367\254~\303\324/X\375A\326"
+	.ascii	"/\224\ntC\375z\331\260\021Z\200j\024.5q\331\245l\n\263\201\t"
+	.ascii	"\227\337\"u\267\334\276\\V\230Dc\332<\006l\201yqy\263N\325\306"
+	.ascii	"v\375\231\226\375Z\244\213\025\342\016\320x\rX\245\251t\326D"
+	.ascii	"Y\243\206\313\243P\277.\314M[\027\346\213\352\211\352\022\327"
+	.ascii	"\307T\301A}\005\365\005\215\332\300\372\230ke\257\026\tc\257"
+	.ascii	"|\323\265\272M0\355\264;\345\341$hYV\270\374\002\365\013\304"
+	.ascii	"U\200i\032\327\251_\030f--ma\230\347j[\037\223w\205i\353Z\037"
+	.ascii	"\363\337\037\376\235\262T0j\303\245ccu\247=U\370\245E\305\345"
+	.ascii	"\323\3651\353\2560\377\243\375\357\362\337\314\377\260\177?\030"
+	.ascii	"\363?\315\3775\377\325\374'\363_\210C\361\337\354\177\332{\374"
+	.ascii	"o\361\363s\002\377\342\370\367\202\177-\3707\307\277\023\374"
+	.ascii	"[\301\277:\376\315`\027\3707\202\177%X\020\376\333~\026\362/"
+	.ascii	"\217\1779\370w\203\1775\370W\305\377+\377\356\2778\377\326\376"
+	.ascii	"\345\377T\377s\376s\371_KKKK\373?\3663\331\237\243#i\023\225"
+	.ascii	"R|mv\201~\235\255-\002\377\313\356C\220D\267\017Rf\225\007\256"
+	.ascii	" \r\\\376\177\321\207\322\r\354\351\264\211\303+(\340\020\b0"
+	.ascii	"\305\236\264\215\b\320WR=L\241\212\345\261\271\323\336\026B\025"
+	.ascii	"K\030\246G\3420=\002m-<\002\273\323\242m\210\025\004\356\360"
+	.ascii	"\n\2528\274:\026{Z\330\300\276\n\032\251\302cq\330\345X\264\r"
+	.ascii	"\257\202\305\241\020\252\330\363Dj\311\026\027v\200Zb\275\206"
+	.ascii	"\302~\201\351)H\264%\207\351\261\307\272\027\013H\023\021\350"
+	.ascii	"~:\022\307\202N\333\245\224|A\tK\360\270iw\017\300\244\024ul"
+	.ascii	"ar\350\344\330\355D\251\250\373\001`\232l$\233\004J=\365\022"
+	.ascii	"\220n\002\230\272\201\333\311\356\006v\367\r\361)\355\236\301"
+	.ascii	"6\234bb\3526\3760\365"
+	.string	"\023\320\013H7c\221u\025\207WQ\307\233\027\362j\252WH\201;\325cP\304z\005\264\352\245\356\336&\352TQ\310\031.\231\005\216B\305\204\013\227\257-U\376\301@\026\311\303\237WX\255\227U\216}\325\235\352\324\202Ma\\\\\226@&\317\002\231?\013]\360\244MLR\\\376\254\304\301\332\030$\242\210q\311@\036\003\333B\304\232\372\325\302\262X;6\335\307\263)\252*P\224U\241m\0325k6m\243\340^(V\315\"\027m\237\370\242\331\263\254 \322\224\315X\264\355Z'6y\244\354R\246\314\nm\267\026k\223G(\2402\023#\006\316\327\020'8\354\224g3u\223\353c\266\340#\252\331\317\316\031,G$\227\347\256\372\031^b\264\300t\031\202\210\261\"\376\033\331\032\261^\244\276L-\022Ip\261Rb\313&\377\333\021a4\036Q\226\207\234qX$\017\341\254\037\253\024\230c\206\205\370\244"
+	.ascii	"\216\021\261\252\037\\b\245\302\233`\0301#\270\274\r\013\365"
+	.ascii	"K\225\204\227T\215Y*L\226\330"
+	.string	"\201\235<\371Rvk\302J\250\3108\007+~\302U\2334\332Z\230\345\254\314\212\255X\2071+|\205\221|\305)Wa \026\311V\334\303\371\b#\371Ozc+\236\022S\366\023\203\307l\312\025'[\231\344dZ(\r3\250*\303?0\225Er\325\177\322n\254\031\\\305>0\325&\215i\007\311\331*\013\263\345l\200\030:g\222\030\243\301\244\232\262\203%\305\241\t.Y\312\215\321\211\313\0171P\026\311Q\252\023P\274\324\234L\016\0219D\211\325\227\311\372\362\2532\017U\2112\"^\266\352\313\254\372\262J}\371C}\331C}9U\177^\302Jl\256\266\230yQ\262`\214D\330\222\222\222\372\002(\212m\340\033~\034\036)]7hI\325\263T\0079|\321:\230\311F\316P?\016si2\305TC=\327\300\307\037gg\214I\226\025\227/\235\352\271\210\215V\232\231\f\\2\221\n\244d\001\006"
+	.string	"D\262\324\300D~vb#?\215 @\nihh\270\344\031\230\206\363\023\313\320\374\364\300\261;\310O<Qt\007yv\017\330=\240\224\022\325$\b\263|)\254\037[\037SgW\230\034\303\355\334\224\343e\2102*\\\246\250\231\251g\027x\351\314t&\016\262\306\256\215\311R\244\354\254\215F \233\030\202D\260\212\347 /\223\242\233\252\273["
+	.ascii	"\260\344\n\fM\270\274\023L\374\217S[\241L1\n\221a@\303\304L\023"
+	.ascii	"\003y\232<9\022Y$\277\260O\3504\365\300%V\245\236\177\263\203"
+	.ascii	"\304\356\016b\023/\222\341;w:4H\347#* \t\007zb\020@\322Q/\207"
+	.ascii	"mw\242\277$\020\204T\240/\222\221;Z1\304C\312\341\371`\237\315"
+	.ascii	"O(\005*\304\313\035\331\360rG\265\"4\307;\215\3143\005\335\257"
+	.ascii	"\374\375N\037\021\021\356&\351\2507T\372\320\243\032\321\311"
+	.ascii	"\313\351\214p7D\347\017\251\344\365t\350\320\371\273\271O(w$"
+	.ascii	"C\307\207+\032*\223|\350O"
+	.string	"\227;y\004\360!!\336\005\350\371;y\344\216|>\244\363\235\2743W\377@\r\006j\330@\341\3466n4p\243\001\3636n\334n7j\334\352k\334j\247P\016gt\301\231\303\375B@m(\017\251\227\3434\352\355\330\321A_\304\342\275\243\323\027\204\366z\276\240\034\337\271\323\365 :Y\374\204r:\037\274^\016\023N\035'\212\343\221bw\302\016\033\257\247\373\371N\023x\032\354N\330\321\263;a\007\3219\304K\372\361B8\177H;\350\317\207\204\343\374!\351$\371\320sw\032\235=zP\241\233_\016\327\243\2473\215zC=\264\347\333\201\372zG?\036\316\327\203\005*d\343&\307\303\221\200\352p\240\275\242\237\216\363\207\304c\302IT;\221\214p\"\240\347\317\207\017\017N#\"\r\214p\250.\247#b\301\323\355rN#\024\355\371\212P\024p\273\034T\250\306\r\345\351\220\352o\267\034/B\350"
+	.string	"\203:$\303\327C{\273\240\334Q\020O\207\333\005\r\371~A2|\210x\270\335\2567\304\323\355"
+	.string	""
+	.string	"\323R\n\371J\002\306B\0041\237X\311J\303\345\271\316\305Z~\216@&\022pJ\226\251:\3536\002\345 q\022\"d\257\263\226\260\034\036f"
+	.ascii	"c\204K\356\342\026>\204\250\346i\301\242\236\030\303%ekkK\205"
+	.ascii	"51\200!\321\372\"Y\213\203@\266\356(\027\272\232hT`\221\034\371"
+	.ascii	"b\322T\277\001\200\376\250\2010\250\030322\"\"2\223$\351`\002"
+	.ascii	"\221\251#\242\007\021 \261\223jHd$)H\332\r\001\002\352\274\336"
+	.ascii	"\201B\342\333\030\364\202\205\317&#\347\363\006\252~\325\322"
+	.ascii	"\207\256\316\005\2342Q+\354\b\003\304\021\361\013"
+	.ascii	"\0339E?L`M\264\341\376lb:\237:/A\304\016v\036Ax\225\362&wV\223"
+	.ascii	"\3158\314\336\301\231N\306\321\364\3619\361\017\227\375\013`"
+	.ascii	"\f4\302\026\305\317\343X\f\271\314><\232V$\323n\371@cS\233\027"
+	.ascii	"\252\326\002\177'\021C\035\251#\206r\030yL\334-'\202}\271\200"
+	.ascii	"\240\302\245\335\3637\363\003\350\357\375\2563m%0$q]\017A\"\375"
+	.ascii	"9\227M3\362J\017\305XX\210\303t\035\261\253t\0026ra\345\n2^\004"
+	.ascii	"v\351$\246\222\300\300\f\300P\214!#T\222\277\021\311R\227\213"
+	.ascii	"\030m\345$\340\265f\241|a\234\236a\314\252\357\350\227\201\357"
+	.ascii	"\342\2662\376j@\234\200\267\337\220\223L\250\264}i\306"
+	.string	"\337+\233Z\254\266\023\313\336\2316\241\002\300\243(k\037\017\0332R\376\211\271\374\034X\253\312\357\234\t\013OL\231N\223\374r)\211`\t\320\013\372\306\r8\t\222\267\332\257\240\353\0023\236\334\t\375,\001\3000.\201Y\345\003\322\232$\215\344J\331\357\021\236\bX\265\224Rky\343}\326A\325\207\250v\350p3\204W[\350\2206{<\001z[\256\033\303\2779'\016ET3\t\026U@\031~\336\267A^.w\2722\350\rZ1\024\217\013\233j\361w\004\224\350\3005\265p-\006-\202\253\245\322\016j\021\025f\022y\267w\327\333u\247\345\031\325}\243\023H&\330u\020\214P\260\307\251\350=\345\234\2562\326\327\216\3061\244\232i\377\f\304\250\314\323\233y\323\020\217\037r h\271\313-uG\030\035bvN\272\231\361;8\221\212\343[\037\024\237\351w#\332\355\334P\366=\243[U\377\022\267"
+	.ascii	"zBN\356E\332C\177\244Q\233*"
+	.text
+	.section	.gnu.lto_.symtab.a4b23c1eba835a26,"e",@progbits
+	.string	"pgResetFn_motorConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\001"
+	.string	""
+	.string	"motorConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\001"
+	.string	""
+	.string	"motorConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\001"
+	.string	""
+	.string	"motorConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\001"
+	.string	""
+	.string	"timerioTagGetByUsage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.a4b23c1eba835a26,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
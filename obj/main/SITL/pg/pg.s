@@ -0,0 +1,509 @@
+	.file	"pg.c"
+	.section	.gnu.lto_.profile.5b60458b168b453a,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\004"
+	.text
+	.section	.gnu.lto_.icf.5b60458b168b453a,"e",@progbits
+	.string	"(\265/\375 v\005\003"
+	.string	"\304\004j"
+	.string	"\b"
+	.string	"\276\356\271\327\016\004\002"
+	.string	"\002\001\002\002\002\001\001\227\267\273\373\r\002\004\262\375\360\257\007\003\002\001\007\262\211\373\251\013\002\b\276\362\342\333\004\t\303\341\316\304\007\004\002"
+	.string	"\002\001\n\266\257\264\322\r\013\333\205\320\333\016\002\002\002\002\001"
+	.string	"\007"
+	.ascii	"Q(\2243\f\270\202\224E=\247\224\031\332\006\260"
+	.text
+	.section	.gnu.lto_.ipa_sra.5b60458b168b453a,"e",@progbits
+	.string	"(\265/\375`\016"
+	.string	"\035\004"
+	.string	"\002\006\017\022\260%\351\035\206a\0300\026\3156\262Ik{\313\224\002\356\002\024\206M7C\244\354\270\"Dy\217z<!\346a!\351\370JeJ\201gV\003u\f\305U[\260G\216\266\261|\001\035"
+	.string	"\020$e\b\266\n"
+	.string	"\331I\215sW\326\316\034\0057\020\035\304\"\204\305\022\322`\001 ,U\214V\300u\310C\3520g\250\021\324E\260,\323\254(\013\234\001\244\332]\205"
+	.ascii	"*\3033-\335\224u\005\030\002"
+	.text
+	.section	.gnu.lto_.inline.5b60458b168b453a,"e",@progbits
+	.string	"(\265/\375`\207\001\245\b"
+	.string	"\322\215-2`M\222\016@\234\261\204\rP\\\323\307\354P\261k\340\013\f\332\224\231\252w\006\241\226\203\220\005\230\342\032\270$!\347\376\332V7\333lk\255\221-w\n\037\205\331\210\316\206#)\364\241\263\341LS\246\312s\331\030\314:D4@\252'\016\320\013P\\Hp\004,\335\237\302\267\364\332}\007\370\221\231\321\321\026v\355,\354F\351\r\260\"\304\203\244\352_\246\020\026\227f\340\366k\240\317\340HCFI\245\177\t\2756&\262\351\273-\f\177\200V]Q_\332\333\027\304\333\256\345\356\30543\023z\206\314\274>\272"
+	.string	"\177zP\257\023\340\2557~\b\305\310L\312Kw!& \200\002\241\240\214\017@\025#\337\255\234u\234\271\364 <\002\220\034\003PLp`9\353\320I\271\"\360"
+	.ascii	"\336\302\332\234\003?8)\037\267\341\277\035g\032f1\261 \346W"
+	.ascii	"\357Ui5\320p\200\260\257\345k\304z\305\326\022\313j\257Z\214"
+	.ascii	"^R[\371\315d\264\213t\r\r\270\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.5b60458b168b453a,"e",@progbits
+	.string	"(\265/\375`\377"
+	.string	"5\006"
+	.string	"\342\n\035\"\240%I\007\243\373u\256\002#[\313\377\377b\331\357\260\252\252E\t\3425\fL\264\326\332\316\233\310$\003$\357n\354\033\353d\212L>\274a4\202\360\356\325\225\365\016\360_\007\311\224H\017|\215yUw\364\305r=\361\210\027\\S\022\347c]I\363+;\212.\223o\031=\364\023RJi)\314\307\320\177E^\313\341\345L\232\365\212~9\370\021\r\036\020\037"
+	.string	"9wB\272%\322\0204Q"
+	.ascii	"\302B\200p\214\2731\207\021n\250\346\bC\363\"\004\210-~Y\033"
+	.ascii	",\253=Y\021\235Awg\001\037\314\f\340Um@\333z\001a\314\345J\f"
+	.ascii	"=\340@\t\020\246r\267\212G\212\025@qK39)\200\033"
+	.text
+	.section	.gnu.lto_.pureconst.5b60458b168b453a,"e",@progbits
+	.string	"(\265/\375 \035\351"
+	.string	""
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\b"
+	.ascii	"\231\004\001\205\004\004\231\004\007\231\004\b\231\004\t\231"
+	.ascii	"\004\n\231\004\013\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.5b60458b168b453a,"e",@progbits
+	.string	"(\265/\375`\035"
+	.string	"m\004"
+	.string	"2\306\025 \300%\303\001\300\377o\233\361\373Y\357\353\"d|\266Y\033\334e\207\326\bim\357\266\367\2262\005\273dii\327\\\2624u*\r\204P\274\004\243\034\001c\037\355\243\300\342\256\021*"
+	.string	"sx}\203\221\242y\224\252!\r\177\223\312Xa\316Q\273Q\256\234\327\204\347\t\025"
+	.string	"H3FS\302\212\206\201\0202\002&\006\314\205\222w\230\316\226=\234\265\303\036"
+	.string	"\\\fH\004-{\305-H}\323\022\245\222s\215m\021"
+	.string	"\302\033"
+	.ascii	"\034"
+	.text
+	.section	.gnu.lto_.lto.5b60458b168b453a,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_pgFind.9.5b60458b168b453a,"e",@progbits
+	.string	"(\265/\375`\371\001\365\021"
+	.string	"\346\242yH\340\322&\035\222c:\037\350::\025A\346&\332\207\270\3331:\305\232\227\324\271\203\016\372\355u\\\350k\312\206\333\340\333\020\221\334\322\036e\2529\346\2141\346\214JI6\205\370\035^\332\223I\313\356\266h\204\354\275\345N)g"
+	.string	"_"
+	.string	"i"
+	.string	",\023P\247&\302\317\253\026\244V\3203\370\022\372\331}\204~\356\b\323\035\234!\035;8CH\227\340M#\353\034\235r#\313\307pN\344{\275\366H\363\265\"Ma\3639i7`\237\207K\331\240\207\207\204\310\227AnP(\303\364\271\342\276\366\222\330\f\311\366\331<r)\265VG\330Wsw\267\r\302\266\003;\222\004\356\270\203?\235\321\323\321\361\264\373"
+	.string	" \274B\222\260V\0167!\025\307\214\201\342\264\337\276?{h\233\f\363\027& \343\251\265>\310\257\3714VJK\303\203!B>j\005\025|\372@\007c\233>o\307\330&\333\033\355\373\374'\346\240\005\317ZC\330\214j\005\027\330@\367) \276\305]\3048#\364\313I\026\035\212fT\264\342-\256PNl\306\224\373--\215\007\020\345\374\220+s\267t_\3737\324"
+	.ascii	"\3758\332\341\212I.p{\013\235\333\255\t\220\327M+\336\374\320"
+	.ascii	"\251\333(t\265\272P|\241\013/\376\211O\237E?\347>|\274\231\365"
+	.ascii	"\240\321\343#\023o{\304#\310\266+\263\301VD\311Q\243\2047f\227"
+	.ascii	"f\f\236pZY\255\313I\265V99\251\274\223\312sa\221\320\342\251"
+	.ascii	"\254^\274\223\021\247T++\257B*\265\362L\226\371\306|\240\313"
+	.ascii	"\025Da\021=\214[\2266\306u\212\314\266Lp+3\203\017\223[.)z\005"
+	.ascii	"\205@\347K\343\033\241\272Zg\016\363\211^t\222,(z\030\212~~\003"
+	.ascii	"\210\230\331p\305\244\313Zk\245N\360$ @\002\204\234\345\001y"
+	.ascii	"y\3211\261\331\330\2030\370\242@:\227\031\370\250\337\213\254"
+	.ascii	"\262\345\264|\263H\273%\275\270hb\017\205\201\037\275&\03294"
+	.ascii	"t\027\005\364SU\226\335*\333\376\320\236\240\r\266|=\271w\370"
+	.ascii	"\031\341\345t\347\024M\376/+\"\303t\0312"
+	.text
+	.section	.gnu.lto_pgResetInstance.11.5b60458b168b453a,"e",@progbits
+	.string	"(\265/\375`;\0025\023"
+	.string	"\306#}F\340\322h8R\335\024\314\371\331\315\224\223\330\320\231J\257\023\263\366\342\246\225\352#<0\347\025\345\224\177&j\226\326Xa\314V/\212\312\271\232\340\373<G\236k\234w\275r\3654S\0300\355\002\367\311\336{K\231Rl"
+	.string	"^"
+	.string	"i"
+	.string	"\274\0056pzh\336U\342\303\323K\304\207\226\331<\006\324"
+	.string	"\260\201S\301\264\273+\035q\331G1\0045e\376\270r##\247\233}\024\301\222\017EK)\035\016T\260t\002\004Jw\313P=\364\310\351n\016\202\t|\274\b\242\262)\221C\351l\251)]\rx\262\273\027zr\320\3252\307\225\335u\346t\035\356\323m\323\330V\261S&'z\342$\375H\n\332\321\362g\363j\251:\366\301\335]k\216=\246I\316\373G\306\364\351\273\177\024\323\240\230\3260\235`\372\251"
+	.ascii	";\252\337\256\315\217\310*\205G&l\337\357\235h\346CV\361\001"
+	.ascii	"\332]\324C{\306F=<\312v\36240!x\332O\361 \331w4\027\260\233C"
+	.ascii	"\303h75l\331\364\334\335\231\332\210u\200g\367\366\234\337\342"
+	.ascii	".$\200\236\300\022\237c\211-\275\033\266l\262M\341E\025T:l\013"
+	.ascii	"g\301\3620\305\263\273\251"
+	.string	"(?Cv\251\274\242|D\355\226+\237\363\311Mg&\321\353\205\256\372\251\345\360\025)\360\373\213xR\0225A\302\341\324\362\347\023\031\303}0\247][\003\177\005\354\345\223\240\321\276\320\212ai\001]\255\230\332%\305\005[\271`\253\f/,0+\227X\314*\245\304/X+\266\222y\275b+\024\217vp5'\004\242D\323\332H G\324\240\232A\b\233\316\234\nj\210\302\227=\"p\370\210\016D\325\r\275\035\251\252\343\216\020\\\021Z\376\254=C\276\031\241I^S\037@h%)\335t\346\030A@<\240\352\3700XG:\212\240\273^0 \200\002\0311\355\001\001\302\313\330\036\212\326\n6\2508\024\261\b\273\017\330\n\0055\\\331\337\312H\227-\036\332*\017\311\361\352\233=\205o@\330\270\254\252\265\013b[A\254@l\330\\\253\336 Hk\336\362\264\003*\025\244@\202\254\034B\322BP\214\211"
+	.ascii	"\321,\256\276\220\2271\" G\001/\301\314k%C1\013\261\350_\266"
+	.ascii	"\316&\2742"
+	.text
+	.section	.gnu.lto_pgReset.12.5b60458b168b453a,"e",@progbits
+	.string	"(\265/\375`M"
+	.string	"\325\b"
+	.string	"FR?7@\217\322\001\300\026|=\016\206\211\345\035\355hc<\001@\027\271\271\334\320\217\376\217\314\212\207\314azD[,\245ab\236FK\327\260\003\035I\300`2\270\255\224)\005."
+	.string	"0"
+	.string	"-"
+	.string	"\376N\200\035f\317`\207\366\354\024\003R\200\013c\305\262\273Q;\356==\377\251cJ\246\320\023\200aw\235%\223\306\255\267\215`;\301v+\002+\005*\273\031/\327\262 \n\210Or\325\347\237a*dw\265C\373ck\207\327l?\355\213|\304;\n\364\201\335\223\311\311\356\247\340\203\3540!_e\317W\024\331\356\305\202_bQ\341{\034\372 \354P\365\252\347\306G\013%\312\227\375\215R9\354_vw\255'[\323z\324\2370\033\247So4['n\235\030\361\340"
+	.string	"\0217\235'j2\346:\234.Np\\\027\265O\364\313\352\311\360\305\022\351\310\230TM\2659\211|\311O\275\241\205E\322\t"
+	.ascii	"2\241\373/\260\301\205\003\227\321L\305\003T\210fu:\\\303\013"
+	.ascii	"a\222\001"
+	.text
+	.section	.gnu.lto_pgResetCopy.13.5b60458b168b453a,"e",@progbits
+	.string	"(\265/\375`\327\002\375\026"
+	.string	"\346\352\226J\260VU:\364\006X\376\342]\204\232\267\316\230\033\252\201\214\306\257O\266\211\302\022^\246\231vg>P\301\212\364L\337\277@\330\261\353\031X*mP\177\320\377\330\376\300AS!\312\371.\234\372K\260\3510\310\020!\204\020\271S\n\205"
+	.string	"|"
+	.string	"\202"
+	.string	"6P^\364\371\225\361by\324x\021A\202\230e?Oh8\t\f:2\232\324z\246\326\204G\240\236\337\020\240\236_\322\303\363\026\251\354%9\212\341R\231\217\363r\001n\211\220\223\021<\270\223aK\017\013\337\203l\300\205\002\206\324p\361\235\016\035Sn\265\377Nwn3*\256\350\3600T0\024\204\"\345F\013\267\210\267\303\274\325\350\376\367\225\334.\251w\353pJ\312\324ZMm7\236\333t\333/l3\260)\216D\277\370\242\177M\375\323IH\210\017$l\233tV\rKO*\020\361\306\317}\277}_\306\217(\274\206\t\350\202h\334\347\377n\024\2439#\241\240\317x\317\260\307\360\311'\304\207Z\353g\370F6\r;\357Ffv\241\206\274%FB.\027\355R\302l\223\202m^\274\035\263M\333\341y\030\261\027U\260X\253\b\037Ky\021"
+	.string	"\245\324\276\320\207b'2\222\253\324\232\373A\252\365<\020\253\262\326\332m~\216\353\230\tU\253\361\266\325x\221\334S\211\235\017\032U\nk\255Ul9j$\027ec8"
+	.ascii	"k-f4@\344x\204\253\263iw\377\3733\360\300P\022$B\243J.\260t\326"
+	.ascii	"X\256i\0070\321\301\315\350\222\177d\232\333\220P\326J\203\361"
+	.ascii	"\221\\5\276\317\315\376\350\024\267;\362c\210(\207.m\320HQoW"
+	.ascii	"g\2373z\230 =Rxs6Im\242\224\324\246\222\272\274\357&\037\216"
+	.ascii	"\300Z\275\326\206\345\332\n\256\226*\264\352\205\345J\261\\)"
+	.ascii	"\033\232\231\232\224\352\005K\275\240\334r\255^\251\t\255\326"
+	.ascii	"+\3453\347\233\363\030\304\361\200\243wo\020\314\300\003\222"
+	.ascii	"\277l\374\356\254erv\346S\242\250\270\346\332\016\036\320\335"
+	.ascii	"K!+\220\234$\261\2608\001~r@\344\352\302\027G<\240x\340\035."
+	.ascii	"\271&\360\346~w\2253\210\243$X\204F\225T\214\253s\214\207\020"
+	.ascii	"eI%\372\036\204\025\313\trw\334\373\2166 0\002b\234\313n$\302"
+	.ascii	"\013\232\314\321\364\fn\305^p\374k8d\346\027\323\301\333\250"
+	.ascii	"\330\232+\203d\310\326_\216#[\005[\353k\375K1\274j\034d\020\007"
+	.ascii	"D:X0\205\202\270\204\276\332\252\205/\264\264F\260`\265\312\340"
+	.ascii	"\016\027Lh<\242\371:\332t\262\205\300\236\235\357\260(#H\324"
+	.ascii	"\261\260\303o9\372\313\344\034\275U\270\230\t\200\343tk\330\351"
+	.ascii	"Fj\256\261\271NH\022$LW \003"
+	.text
+	.section	.gnu.lto_pgLoad.14.5b60458b168b453a,"e",@progbits
+	.string	"(\265/\375`\334\001%\021"
+	.string	"\266\341tG\340\322&\035\242\232\361\311\203D\231\030?\335eH\026\025\362\222\326\t%{\034Y\033\003\360a\217i\231\342\242\321\265M\342\354m\271\366\275\317\223F!\322\241YGG?W\334f\017\016[Q\tE\006=\261\204l)S\n_"
+	.string	"]"
+	.string	"a"
+	.string	"=\210\020d\332\227\361\035\326yd^\262\233\023D\333\rOl\300;\347\360\002\272s\336M\272s\266\275 \205\345\326\303\0257\3079\001\202\206m7\004U\305[\217\232-_\0046\363\350\221\270\306\006\262\235\221\300^\221\004\343\366\342\261\247\r\314\225IR\331]g\rl\304\315\335\366\003\333\022\354\204\020\351\357?\277\310\201\376\020\247=R\272;\317\2551\235"
+	.string	"R\212l>\b\f\355\336\334\200\254\016\016\207\013\333\367m\\\266z\220\271\236\331\312\257q\241\230\007y\302\r\333\356~1\366w.m\226\375\331@\256\305"
+	.string	"\373\302\021\241 \316\270\017\353?\2569d7\305\021mwO\234\300;W j\350\007zf>C\261 \245\273\326\225\364\323\001\265\017A\\y\363e\276\360\034+%\275\354i\342\250\310F\222\235rj\233N\371\032?v\n1h?\212<\350\214/d\324i\033\274\335\027\003\177\006\323\342\263\220\351\316uz\241\227\030\361@\261\303C\2237;t\245\352\330\217\273\273\326\034\373\341?\342\245K^\326\340\222B\255T&\016$S\007\324*\266\244T\031\342\311\244R\263\240\234^\300\323\013\350\202Zi\001YT+\020\305\304\251\027\223\n\204I\245T\340\027\322\\s\374\330#\354h\021\233\245\337\352\254\236\252\332\330V\265\n\215\272\242I\212\350H\005\013\371\032O;\235qP\342(\204\252\216C4\025\203\017\321+\215\374i\352c\017\037"
+	.ascii	"\326\324a\030,\326\323\361P\263\327h\323z\bb\2313\342l\240\325"
+	.ascii	"\302C\364n$\246\210\230 \3045\033L\023D\250\260\240XP\367\200"
+	.ascii	"\332L2\266\002#\203\032\001q\0031\340\312\022\306\r\252\006\334"
+	.ascii	"\003\303\026\240\"6u5\215AA\001"
+	.text
+	.section	.gnu.lto_pgStore.15.5b60458b168b453a,"e",@progbits
+	.string	"(\265/\375`o\001\305\016"
+	.string	"&\235dE"
+	.string	"\257(\035\307\370$\325\255\215\244)r}\003&\013|URC8w\007j\306\330c\037[\347q\337\037\264\337\320+\363lu\213o\326oN_w\351\213\371"
+	.string	"\315\251\3064\020\273v=xi,!\233\020)S\nN"
+	.string	"N"
+	.string	"R"
+	.string	"\033O\373\255\217"
+	.string	"\037\216\274\263kR\302e7\344\360\201\356\233\303\316\266\037\342\"@;\246\205\034X\317"
+	.ascii	"B\345\272\331\335\317\300\005\304o\3325\3427\335p\360\t\372w"
+	.ascii	"];)q\261b\231\236\034\203\335u\256X\026n\275"
+	.string	"\355\r\333\r\354\313\002\351\370\360\337\256\362kL\247\246\017 \312X\020H\261[a&\333\231\r\306\203\355\373-\207\205\334\204\027\274\304\334|\305\016\261=\226\277D\276\342\315$s\262\273\236\210\355}K\033\264=\333\232Wq\314\234]\f5.\273\313a\004\231\342\026+\002%4*\325+\247O\331xz}\313\265\027S\f\t\032\226\031\005f\007\305\250\236\016\210\251HP9\363a\016\035E\204n\227\202\002\377D\351\303\3570\022\277E=\354I\242\302F\006\245u\312\231\035\242R5\330\327VMl.\355=\345\347t\351N\323\034\027\206\360\231\020\002\321D\245\004}HjO\007h\364\201F\237\204\220\307\307\347!\201|\035\032\026\215>\244\257$\022\221>/<\335\3464@J\306\314IQ\356dj\247\034\265\037x\344W\276\353\016>\2040^\244\324\344\277\3549\314\247\323\277\336\211Qs\001\245\305i\352]O\020\033"
+	.ascii	"\034\312\213L\333`\304\255\026\2244\364\234is\250\226\217n-\020"
+	.ascii	"KV\314\022.\214\204\317\262\b,_\212\210\320#g\260\021\324\022"
+	.ascii	"=l\210\206\004\300\212\240j\300=0L\240\"\203\023O\252\025\223"
+	.ascii	"0\311"
+	.text
+	.section	.gnu.lto_pgResetAll.16.5b60458b168b453a,"e",@progbits
+	.string	"(\265/\375`o\001M\017"
+	.string	"\246\\fF"
+	.string	"\257(\035\204\b"
+	.string	"\375e\024\005\240\306D\005\306\337f\253\375\350)Ech\337\331\"\2707\243\204Y\2405\361\350\207\276*%\311g\025\225m\277\376\267\377\377\272W\314\033k\030Z"
+	.string	"TQ\360\256'\226\354-wJ\001S"
+	.string	"P"
+	.string	"Q"
+	.string	"\007Y\373\227L\005\230\332\356v\312\301\333\212\t\r\316\212\t\315\354\022\274e4}J\215&\237\345\031'-T_\310\247\354\244V\036\006|)\371\ti5w=\222|\250(A\224\\\357z\202\023\033\325W\362\330a\260\273\216\252\357\302\275\3356\005\333\006\354\203\0018(4\314\350\f\334U\216\213\225\315\232\017o\375\366}\227\307@\016c\215\032J\313\356\376\3450\177\374e\375nj\273\373\026\337\365\021\007Moy|G,"
+	.string	"X\251 A\333\0055>\235\301}\032|\201\355\223;\306\366a\203\330\236\317{l\262Y\004R\357\272\024\361\335\240f\261\020\250\230\343"
+	.ascii	"q\352\325\207q\214\342U>\354\r^\310R\032\342\307\f\3413\035\334"
+	.ascii	"\256\210\002_f\202\004\277\203\307\3669\365\261\023\bW\240\270"
+	.ascii	"\274\234b\216\306\330\244>U\025\033D\305\177X!\315\232b\313\350"
+	.ascii	")\337\272\337y\242PI\r\332\020\221:\021\251{\3409\340\350@\245"
+	.ascii	"\216n\003\303#R\250\324E\030\215J\235\007<]SX\316\305d\220\235"
+	.ascii	"\024\365a\205\264\251*^\200A\245v\302h\220w\200u%9\341q\273#"
+	.ascii	"%n\"$E\336v\225\267}^\005lx\245\020\211\341\345\356\2564\002"
+	.ascii	"\r  P\002a\020\261\003a`\367\035\264\316\371\3331\2226H\302\242"
+	.ascii	"a\032\336\032\372Uoi{\3613\264\220\316\n0\241\235P\230\"\266"
+	.ascii	"\267\303|3\3356OL4\027\341I\357\263;\264\373\305]2\303\354\006"
+	.ascii	":\003\265A\276\224;\227x\002"
+	.text
+	.section	.gnu.lto_pgLoad.part.0.29.5b60458b168b453a,"e",@progbits
+	.string	"(\265/\375`@\004m\033"
+	.string	"V\260\246I\260\226Q:\024 r\332\350F\021\305WS\211\006\245}\221\bX\020VZh\275\357\2752\213\236Xl;3#nl\007\233l\327\252\277\3751\t+\216s\247\220\337\b\305\032w(\374\220\002_@a\001]\223\337\356\275wJ\001\211"
+	.string	"\221"
+	.string	"\224"
+	.string	"\362=\035\0357It\215:\217\335{\370g\230\335%.T\273{\023\276\326P*\017\245\243;l%\212\202)?\352\236\243\307\300\270'DOi\337\351O\273\347\350\271\200\335\246\036\325\356\270\340\325\t\302W\217'\340z\rO\343z\265\177\303\016\036\350D\333v\360`g\237\217<\2443\275(\212\322\332\035c\257S\306}>%\365\361\245Q\322\317\347\201\267\271\362\273\n\372\222P\\\0168}\341\354\256\303\024w\275m\t\266-\330\224);^\210V\374\307C\373\376\221\007m\177\342S\201\202\344F\374&wb\030\226\356\312\277\032\230\335%/8\341+\023\335\227\324\\\0034\256(\356\216I\256d\367%\265\257\321~\261\214\023\302\327"
+	.ascii	"\3624\256\237m\2632\342\372C\344?`U\221\233k\204\212\334\302"
+	.ascii	"\0371\364]\361\262\"\204>!\037\302s)W\035SZ<\366\247Ne\303\234"
+	.ascii	"\273\224/"
+	.string	"\005\334]X\216\372>\235\017\3040\333\377\241\223\024\026H\305\315\253\017\377h\200\025b2\321 \334\3310\327[\257\271\344\234\363\300\257\210E\220\334\362\203\326\360+9\341\256\020\004?\213\204\216?\243g>x\233\243'\250#\247' \271%g\fOz\272\263\311\266t\314\241~\030\230t\b@\372U\245]\357\375\265JS\031\351)#-?\376\227\261\2411\243\264\213\264\325eaT!4^\365c\375L^eF\227\305\320\224\302\343\331\206.\322\300\310;!N1\r'\250\304\020\365\345L\233%\206h\224\212\036\216(\256\321\345\rQ\243\026@\034Z+4\336\330\\\223#O\f\376\240\223#9\344HYM'\004\005q\243\345p2\021/\331\bZ\216\332n8\017t&\303Mw`0\333\211\315vb h:\266X\007\\.\306\200\306\267\035\031.\026\342v\303\305`\247;\233\006\310\337\307\0253\217l\307L\343"
+	.string	"\315\2409c\330\236\341Q\205\244\324\333\271\344\002\3625af8\355\n\027\344\215|\340C,\033\242\226,\242\371\343[\031\303\263d\b\347\255.`\013\025%\247'\327|\315\003Ok\270\230*\252\223N\327<Q\2269\351\274\223\323 :\210\004\005{|A\020a\250\221L\305\020#\"$#\232\264R\030\016p\"1t\267\r\021\2609DG)\024\226\335\001\026\353\201\320[\222\006qJJv\245f\223\036\037\004:\216\026\2007\265G\215{+\210\326\312\301Z\264\\\306I\221\202\371\211\024\024\342(\004\240\201&\023\206\031oe\224\037<\214\221\202\0051\366y'\bO$J\370\336#}\301\177\323\346\301\266\213Zi\003\\\200\221\006K"
+	.string	"\320\317\216\3740F\312\265h\002\211'\252 \267\022\320\207\035\2374\336\261\262\205"
+	.string	"\364\2633\300U\241\231\"\364\341\342f\235\223\276\020B\265_\320\207-\241\250}>\242jQ\273\371\023\337\262Gi\362!\016}\220\275\265g\3041{H"
+	.ascii	"\321~V4*\352O\222\027\376\371\024E\005"
+	.text
+	.section	.gnu.lto_.symbol_nodes.5b60458b168b453a,"e",@progbits
+	.string	"(\265/\375`\177"
+	.string	"\365\006"
+	.string	"T\n{\001"
+	.string	""
+	.string	""
+	.string	"\002\035\177\016\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\204\202\202\200 \t\177\017\252\333\3426\272\200\202\002"
+	.string	""
+	.string	""
+	.string	"\005\022\020\005\021\021\002\013\177\022\024\023\025\024\f\177\025\002\r\177\026\002\016\177\027\002\017\177\030\020\177\031\360\372\2508\001\026\177\032\377\037"
+	.string	""
+	.string	"\200\200\200\001\023\177\033\003"
+	.string	"\f\344\001\003\004\r\204\001\003\004\f\250\270\275\324"
+	.string	"\001\204\006\004\004\264\345\241\253\002\001\225\007\003\007\004B\003\b\004\263\244\257\024\001\242\006\003\t\t"
+	.string	"\210\373\227;\001\342\001\003\n\f\344\001\003\013\004\221\205\327\307\003\001B"
+	.string	"\026"
+	.ascii	"`$7\313w\2501\\\343\235ap>\225\221\217\351O\301\360\354\265L"
+	.ascii	"\267w>\202!ML\234\020@\007\020\f.&%\202\020\216\250\304\b* \236"
+	.ascii	"d\350`:\001"
+	.text
+	.section	.gnu.lto_.refs.5b60458b168b453a,"e",@progbits
+	.string	"(\265/\375 -i\001"
+	.string	")"
+	.string	""
+	.string	""
+	.string	"\002\001\002\002\007"
+	.string	"\002\003\006"
+	.string	"\002\004\002\005\006"
+	.string	"\002\006\007"
+	.string	"\002\b\002\002\006"
+	.string	"\002\003\005"
+	.string	"\002\013\002\002\005"
+	.string	"\002\003\004"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.5b60458b168b453a,"e",@progbits
+	.string	"(\265/\375`\375\022-Z"
+	.ascii	"\n\225\314 R@\220\322\031\016j\026c\235p\250\251"
+	.string	"\210\341\270|\354.@\034\221c\341O\200{&\340>\263\363X'Yd3#J\214L\002\373\304\320\024MA\364@\003\203\002;\375\007J\326\223%\3758\034\350A\265;\365B\261\305]\373S'Z8o6n\"e\n\273\001\360\001\t\002\373\266m\353\266\\\226\271Zv\312\227\312V)\256\223\325\262El\331\252]a\240\305e\205\317\212\2351Y`<x\316\365q'\220\214\0370\3712\327\275fY\266e\356\332}\326\356K\360\003\255\355\331\252\355V\"\335=\206\034\260\366E\003L\263{]Q\300\n\022a\332\336\236P5,:O\326\037\304\360\271i\274$\217\263\035\370\274\321\225e.\332\277\344t\237H\311`\221\221y\034\316\024 UE\351\207RV\241\202Y\252e.\212\204\364!\244\347 ](\033e\231)\226\354\373d\211\270\rq\355\225\203\320\211y\361y\013\322o\ntWW\267)\320W\220\362\354"
+	.string	"(\017\200\376'\375\21200\033\246\2251i|\376\013\266_\314\206\266\204\304\347rm\3272Ql\223G@\301wjWku\257;$\326\b\261&\r\237_ \375z]\207\252)8\232~Q\240[\267(\320s\312\263%\320\004\226\374\233\265Z)v\306%e\207u\257=iQ\212\023->\277\356"
+	.ascii	"h\272%P\030M\266\206\324\304\317=\337\371y\310\350\001\374\374"
+	.ascii	"\302\277\2745\232\201\027\367\377\002\374\\\302\277&|\377\267"
+	.ascii	"l\214\003\360\263\007\377\323\376\225\341_!\027N\300\370\277"
+	.ascii	"\366o\013\377\335v\004\026\330\216\005\306\277+0\020O\n\377\311"
+	.ascii	"\376\2775\360/\n:?\027\360/\t\377r\360/\320\277,\376\335\375"
+	.ascii	"\253\342_\006\376E\340_\024\377\372\374[\342\337\236\177s\376"
+	.ascii	"M\377\207\371\017\346?\334\177\243\377_\377\315\376\377\376\243"
+	.ascii	"\360\177\356\277\334\377/\377\301\376\307\375\327\372\177\342"
+	.ascii	"\377\331\377\233\272\272\272\272\177\227\363\357\226_\007M\315"
+	.ascii	"1K\346k\346f\030)U\273\325\265\233\266\352\251\311\251\331\311"
+	.ascii	"\244\212\2343i\324p\361\2323\022\253\253\224[\236\361\311*s3"
+	.ascii	"\361\254n]N\221\325\263\233\270\253\200\316\256\0026fB\210^\350"
+	.ascii	"\371\305\222.\232\245\313\0212f\271\204N\rN\215\037a\346\340"
+	.ascii	"V.C\005K\n\237\314M\263St\310\200y\221\342s\317\\n\331\254\364"
+	.ascii	"p\342s\233\274\263\264*)\263S\007Y\026\032\225\364;\226\236\177"
+	.ascii	"\264\211\307\356\306a\263\366\021)\007]\233%\261\273]\340\377"
+	.ascii	"\331\273\036\335<\332\306\244F\240\020\237\236@\037\253[\355"
+	.ascii	"\351\265\217F&\225jl\262\206\354Y{\312D3{\264q\245B\236\312\346"
+	.ascii	"^{\273H\205\254\301\270*\217\306U\251\362tQ\251v\257H\036c\030"
+	.ascii	"Q]#\223\nid*\221=]l\265\231\304\251\264\250D\032\257(\221<F&"
+	.ascii	"\021i,R!{v\264Yu\251\221\204\n\210%3\026\373\006\023\024\361"
+	.ascii	"\310\243f\\\225\375\326\275aI}\\\240\033Jy|#\362\330(Hj7\220"
+	.ascii	"\236\020\225\2732!U)\273\250f<\242\354>\202$\243\231&PW\265\376"
+	.ascii	"\261jj\017\250^J\3526\200\251[\335V\353n\265\273yG\250\265\333"
+	.ascii	"\211\307\270db\352N\37205\224J\226\324\315a]\242 \215\314*%\020"
+	.ascii	"\331\027s\3314Vu\227\375FuL\231*W/u\367\212I\227\310\034a\370"
+	.ascii	"\354\002x9\274\346\240\314l\204T\325\231\001\373Z\3214 W\320"
+	.ascii	"\370$[q\242\370 \306\203\334ZNR_q\342/q\274*9\304\314\361\t\267"
+	.ascii	"\026\273\333\207G\334\342V\205\317o2\375j\255\033\306\004nK\314"
+	.ascii	"\213\021{D\022,\253\365\003\215-\230V\227e\242e\255\354\332\252"
+	.ascii	"%y\272XDs\216\210\037h\265\254\224\375Z\265\244\005C\274mY/\333"
+	.ascii	"%hesDp\227\021+\246\022>\377@\332\265\003\211\344\223\235\034"
+	.ascii	"\211[\002\303'\217\335,'\271\245\371C\330Vj\344\254\304\b7\331"
+	.ascii	"\261\345\264\332\325M\026\234\235-\233m\224\243\262brnrfF@\301"
+	.ascii	"\343~>\276\276\370d\257s\327\0171_F.\356\"\002\367d\2152\345"
+	.ascii	"\365\001\216B3\245f\013\200\2535!H\370\344\275\031\312K\036\307"
+	.ascii	"LeH\242\370d\255\313\221x\302u\005\305YiUlH|2\026\013\261\314"
+	.ascii	"\237\361\020\3501\271v\230N\031\r\261\263\036\322\353\260?C\031"
+	.ascii	"\3119\311\177sS\346\203\025\025\362\310\230\333\323\222\317\357"
+	.ascii	"\226\322\357vX.\231\310\005^as\254lk''s&b\263vd\310\030"
+	.string	"\032 @x\b\233\020MNX\274&\030 -\344<\344f\250R\221\245\017>\031\210,\315\2502|r\220\307\2355T%\033\034&e+\266\342\253\264k\240Vh\f1\362\303\371\n\307\313\212N\t\237\354\343q6V\324\306,q\233\232\342\252\355\243\032\035\033Z\232\320\250\316U\013\345\215i\206\216WE\311\264#MJ\212\243\366\352f\215\232U\306\211\223\023GmW\2538^Re\312\260\334\030\n\007\030\334\225U+\247\251)\210\362\351+\206\243\211\364K\007\216\267$:tpr\223\275\203K\343\265\230:\306\343\234\344\245\251@\250\360\311;\226\016\311q\2104`]Zd\266|\344\310\301H\037\236\265\253\236\226\250R\222R\020\034\351\3177n0\322\247\253U\0356(\245d\263\033\312\201\034$\025'\246\215\273i\362\300\266\204\317#7\345(\217&P2\035>\212\360\t\007\005LI\345\363\334)+\261\022/}"
+	.string	"c\013\207\030\304[\030\3338/-\235\024T\324\325\036\201\242\331\322\221u&-\303\3052lD\273wU6\035;yT\3613\215\263\361\334q\2439\307''-\335\316\206\330\032\026\237\274\303\345p\310\254Q\006\303_\321\356wT$\f\366T\360\001o\206=a\214\030#\370\200'\370\200\250\b>\340n\330\023^\006\013\337\257(8\024\376\364\210f\030\r\375\212~\202\302\031?\004\030\031\315\370\375\216~\274a\020j\303QP\306\360\350\307\213!\3243:q"
+	.string	"\016\321\320\243\00152\312"
+	.string	"\200^\360hx\202\017\270\001\217\350\327\013@h(D4\354\t\005\350\r\375\204\206\302\037\b;\303\240\320PX\202\350\327\013\006\371\200AA=D\277\242\016|@\364CFGG\032\004\331\240\020\260\030\006\205\200,\210\204\216B\360\001I|\250(\330\373\365|\351'h\361@\013\0277\360\356\342\005\004/ @\357\342\005\020\320\213\026@\351["
+	.string	"\355\206\227Q\342G\300^\360gxt\024\374\301\031\372\315\350`\330\023\342\374b\360\260'\354\005m\204A8\004\207\302\"_\317\004\0370g\030\364\363\001m~>\340N\306\320\367\353\031\241\303\240\026@i/\207\"\341)\024\366\202DDB<\034\200GC\3470\310\305\360W4\203w \240\r\022HA\004\017\322!\026>\340\217\017\370\363+\022\242\341g((\374a\021@p\b\334\235\277\260\3342o\306sg0\353\3447\305uev\367\216N\332\026\2677>\317-\201~\327\226\336\300\3739\316x\206a%\201\341\302\205\275\200"
+	.ascii	"\203\032\245d\227\263\227/\022D\210WrV\336\222K\245\013\226!"
+	.ascii	"mm\354\366\201\tU\232\234\264\234\335\300\320$=\210Md\351\016"
+	.ascii	"\224\345\025\222,\347\2653s'\314\216\251'>\031\013\253)Y\216"
+	.ascii	"q\371b\004\256\214\t\237\214\306i;"
+	.string	"WK1)|~\356\270\323<\322\354r\205\2334\357FV\032\037gQ\373$U\003\215\371\270\177\3315\247\212t\225(:j[u?\246L\331\365n\354\bF\236\201c\362\306gY\031\033\001\202\nL\243\224lJ9\033\261e\273*N4\212|\201\235\305\3008\312N\262{\251w\305\366\201n\211\303e\203+\313\223s\2243\024\254$nD>\271\b\235d\201\225\250\2414f\030D#\"\"\"\"I\222\244\003A\005\204\030&)\265:\0210%\243\314\214\214H\222$\351\230\007\245\257\224\262\223\351\325F\017\373\002\355T\023/\005y\310\203\351\036[\\_\r\226\361\220v\234\n\245/\032u\002\204\236)\241\312\226\204)\365\344\372u\224\213\356\035v\221\232\022\002o\035t\226\361\210\241\024\026\253\220z\320\243\303V\323\017\2132"
+	.string	"_Q\317q9p\r\220\345\321%{\276\234Fg\306\342\032\302\030\031\362\343\022\204\007mGy\374-?E\234\210\\\370\347\213\200\246\300\n\341\177\r\b\321\013\247c\350\204\355~2\327\347\345D\336\272l5\006"
+	.string	"\343u\272\244\f\342\225F\300v\211B\034Z\304Ro[\260\2230\373\221\321\255\017\234\355\024\302\371fx\321\315\325V\211CJ\260\300P\003\b\236}EZ&\256\354\206\253:qN\316\212\207\302\211\3506\371\340Cw\216\331"
+	.string	"r\002<\353<\254\023\207\246\365\330\242\240x`[\362(&\302\210.k\203r\333\001"
+	.string	"\001\372\312\233\005\372\370\334\322x\316\005\212mW#\303\261v\256\254Q\353\203\254\361(\377\352\373\220\240\365\005d\302`\033\204\307\217J`|\314\267\247\023\b\324\r\211\252]\017\262\022\267\2761\347i\353\022\324\356\006H\265\335\261\0316r\031\340\325\202y\005\237T\265\366\301:&\006,\006\375!\206o:\304@\334\357\247K\234p\310T\307R\3426E\275\217\324m\"\002\003\364\005s\315y\324x\350\335\320\321!0\330\363s\302\t\206\312\276\374\034\234\277\004G>\020\3568.\316w\201T\345\373"
+	.string	"\201W\226\307\340`U,\255\205\002U~\307\232\240\342\220\236\353\267\312S\242\233$\353\3235H&\302\272\371.a3B5P\211\233\264\223"
+	.string	"'\005(A{\310\242\004H%\341\016\222\362\026\345\375\376\231)\261\277\364\021\360\207{ph\n\200s(\2379\376\2240N\365\212\004\303\367L\247\002\261?\340b\373\256\205\276\265E\213\200\225\346\333s\314z1\354?\246\034\357\020\310\034\n5\204T\032\n;n\274\371(p\200\346ZK\264\022\\\211\273Q\314e\360\300"
+	.ascii	"\034_\252\013\2326\215N \322\0162\200V\201S\316 \217=\007J)\354"
+	.ascii	"\342/'\207\007\226\005Q\301\207\217=Ce5\351\246\001\003\244H"
+	.ascii	"\307\321\220\n8\210\243B\375Y9~\317\351Eu\300`\264\230\201\255"
+	.ascii	"\003S4\257\275\211\036\275\371\373;\2764\357\206C\347;\277\215"
+	.ascii	"\214\3757y\247\301\031\307\257\306\357Z\341\030\370\373\027\366"
+	.ascii	"\232\255j\271\2047$\037%\017\2727\342\027\371\243n\265\362H\037"
+	.ascii	"\213\310;\233L\357\214[\037~\361\377\271\376\246\r\375\354\303"
+	.ascii	"\351\205\357\231\303\305[\033W\373\200\371\362\316X\0179\342"
+	.ascii	"\307\331\220d@\275\f<iq\031~\"\374\020\304Yy;\346\3654,zv\314"
+	.ascii	"\375\261p(W\344\276\353*"
+	.text
+	.section	.gnu.lto_.symtab.5b60458b168b453a,"e",@progbits
+	.string	"pgFind"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\001"
+	.string	""
+	.string	"pgResetInstance"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\001"
+	.string	""
+	.string	"pgReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\001"
+	.string	""
+	.string	"pgResetCopy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\001"
+	.string	""
+	.string	"pgLoad"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\001"
+	.string	""
+	.string	"pgStore"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\001"
+	.string	""
+	.string	"pgResetAll"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\001"
+	.string	""
+	.string	"__pg_registry_end"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\001"
+	.string	""
+	.string	"__pg_registry_start"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\001"
+	.string	""
+	.string	"__pg_resetdata_start"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\001"
+	.string	""
+	.string	"__pg_resetdata_end"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.5b60458b168b453a,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
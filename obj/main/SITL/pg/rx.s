@@ -0,0 +1,332 @@
+	.file	"rx.c"
+	.section	.gnu.lto_.profile.759c2718d36a2321,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.759c2718d36a2321,"e",@progbits
+	.string	"(\265/\375 w\275\001"
+	.string	"t\002k"
+	.string	"\004"
+	.string	"\370\276\230\215\r(\002"
+	.string	"\002"
+	.string	"\002\001\002\001\002\001\001\344\325\316\376\002\002\240\342\234\212\n\003\240\342\234\212\n"
+	.string	"\006"
+	.ascii	"@\bp\017t\006\214\260\313j\003X"
+	.text
+	.section	.gnu.lto_.ipa_sra.759c2718d36a2321,"e",@progbits
+	.string	"(\265/\375  \275"
+	.string	""
+	.string	"h\024"
+	.string	"\001"
+	.string	"\001\001\002\200\004"
+	.string	""
+	.string	"\001"
+	.string	"\003"
+	.string	")\202_\302\330"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.759c2718d36a2321,"e",@progbits
+	.string	"(\265/\375 =\325\001"
+	.string	"4\0031"
+	.string	"\001"
+	.string	""
+	.string	"\035\200\200\200\250\002h\001"
+	.string	""
+	.string	"\002\033\200\200\200\260\003f"
+	.string	""
+	.string	"\031\200\200\200\360\002f\002"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\f"
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\220N"
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.759c2718d36a2321,"e",@progbits
+	.string	"(\265/\375 K\035\002"
+	.string	"\244\0035"
+	.string	""
+	.string	""
+	.string	"\n"
+	.string	"\001"
+	.string	"\001\001\003\177\002"
+	.string	"\004\003'\001\206\by"
+	.string	"\001\300\004\001"
+	.string	"\300\004\002\177"
+	.string	"\001\002\006w\001\001\006w\001\177\004\177"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\tAETR1234"
+	.string	"\002"
+	.string	"\340i\312"
+	.ascii	"\340"
+	.text
+	.section	.gnu.lto_.pureconst.759c2718d36a2321,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.759c2718d36a2321,"e",@progbits
+	.string	"(\265/\375 ve\002"
+	.string	"\022\004\r\026\320\2451\024=\256:z\002\250P"
+	.string	"\215q\335\030\220d\253-S\n\3039\271\350|n\t\024\262B\214\272\304\025\354\343\30253\271\201\226+\267\246\212\246v\211\b"
+	.ascii	"\244`Ze.\316\213c\016\257r\241\246\225`\264\r\264\001"
+	.text
+	.section	.gnu.lto_.lto.759c2718d36a2321,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_rxConfig_Registry.32.759c2718d36a2321,"e",@progbits
+	.string	"(\265/\375 \227]\004"
+	.string	"\304\007j"
+	.string	""
+	.string	""
+	.string	"!"
+	.string	"\005\001\212\001\202\200\200\374\342\303\246\377\r\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\307\006us\345\005uq"
+	.string	"\005\001\006'\0012\005\001\006\035\001'\001\230\300"
+	.string	"?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\023./src/main/pg/rx.c"
+	.string	"\004"
+	.ascii	"\236\n\013f\321 \212\274\001\024\001"
+	.text
+	.section	.gnu.lto_pgResetFn_rxConfig.33.759c2718d36a2321,"e",@progbits
+	.string	"(\265/\375`\265\002U\016"
+	.string	"\026X[E\340\226*\035\004\330\343\274(=\337\241\307\266\320\220\371\261`\016\2214\020S\205>\243(\216'&\273\373,\302\260\352\243'\004\263@\355\212\303\22468\274\221\016\336\226\221\342\305BN\275\366\003\2015\022I\320\336)\005A"
+	.string	"E"
+	.string	"O"
+	.string	"\317\361[y\334\353\004vm+,\273\247\003/\b\377\371|\001\360_x\016\370\317\245\355\342\221\005\360A\313\305\354\256Xk\274<-\375\353\270\306\254\301NS*\354\256\251Y\213q\327\333f`;dWQ+\256\373\023\2006\213\367hy\302\277\016\017\306\025\306(\370;Z\270(\357\206\377\002\377Q\225\335\214\333K\214\366\354\023F+\r\373\231\335]W\233}\334O=\325\006M\327\351\355\276\350E\331\335\367\003\307\306\366\251\0357-\001F\314\213\254\302<\374\311\207\303(\b\361&"
+	.string	"D\334\245\216\370\022\022W\222\273]\342I@\023oi\r\3401:\022\320\t\351GV\007J/\3021\235H\220\333\247\013\241(\016\244%\200\t\352,\241\214\361+\033#\377\200v\212\253\254\334\022\016E\200\360@\004\002\203\005\215\351t\"5^`\221\241I \026)\232Tb\3524B\211$r%\2028\036U%RT1\216\244\2709\367\231\2556g\030\262\213U\027F@i\375y(\032\f\360vg77\204\263\006\237\1776\207\0164* \360\202\22199\006rB\357\312\300\306P\006\007gp;@\024\206\340\222\302\030p\311\013c\270\207\305\b\256\262@V\2140"
+	.string	"\230M\240\352M\030\002\334\t\203y\261\201\313*\220\025#\f"
+	.string	"\027\206\240/+\2460\b\202\211g=b\236\247e\236\363F"
+	.ascii	"\3153%\344\360\242=d"
+	.text
+	.section	.gnu.lto_.symbol_nodes.759c2718d36a2321,"e",@progbits
+	.string	"(\265/\375 k\025\003"
+	.string	"4\005g"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002!\177\007\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\300\202\002"
+	.string	""
+	.string	""
+	.string	"\005 \b\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\035\t\201\204\001"
+	.string	""
+	.string	""
+	.string	"\005\036\n\001\"\177\013\377\037"
+	.string	""
+	.string	"\200\200\200\002"
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\004\244\013"
+	.string	"\004"
+	.ascii	"\\L\032\341^\\\326\316\241@\001"
+	.text
+	.section	.gnu.lto_.refs.759c2718d36a2321,"e",@progbits
+	.string	"(\265/\375 \ri"
+	.string	""
+	.string	"\t"
+	.string	""
+	.string	""
+	.string	"\003\001\002\002\002\003\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.759c2718d36a2321,"e",@progbits
+	.string	"(\265/\375`\300\022}["
+	.string	"\272\236\304\"UPR\032\245\003\253Z\224\326E\bWUY\334\335]5V\270\005\365\216gf\354\274\276j&O\270\266r\027\031"
+	.string	"\220\002\224c[\375\3351\032\264\271\254>\r\334l\377\333-\240\022@\002U\025I"
+	.string	"\202\230\026-\022U\243Q\226\226I\367q=il\333\223&e\n\322\001%\002$\002\0208\251\322"
+	.string	"\013Y5\333f\2254D@\365fI\265e\255D\310\272\203\3349v#\277Q\376\255\372]\274`!\213\\\253Z+\373\306\225T\016\031\024e\034cX7r\205\320\n\332\017\254\036pd`~\246Ue\305%AsA\245\236\231\326\n\204\026\240\226dl\207\0346Yx;/\375\373d\251F\320\212N\310\256R"
+	.ascii	"\226.[l\326fU\3653#\3653 \365\263b\275\031\247\3321Y(\023\303"
+	.ascii	"\024\2337\331\324\233Y\352M\252z\023\252\336\354Qo\022\353ex"
+	.ascii	"\352et\352ep\352ei\352e\\\352eT\365\262!\3652c=\207\325\363\233"
+	.ascii	"\n\264#h\273f\331l2\305v}\323\354\231\317\226\220\215d\033\362"
+	.ascii	"`MAS\277)h\262\261\261MA;\177\251\314W\025\210\217T!2[f\223B"
+	.ascii	"\313\325\266=\303\264\343\211\3153\221zB\217\255\020\355\034"
+	.ascii	"\244\242`\035U\205\234\332bK\215\361\244~\245\352\253\254\215"
+	.ascii	"z\255\243z0\035\324+)\250\357Z\022\264\277\250_.\t\332JY\035"
+	.ascii	"6yb\251\334\305\213\313\204:4U7\322\366#\326D\354\016\233g\240"
+	.ascii	"~\247|\304R\277xP\375\236\240\355\330\236\240\235+\212\260%A"
+	.ascii	"k\201\\\022\264\272#h\377\226\320\377\376\374\233\300\277\266"
+	.ascii	"\177\007\370\327\200"
+	.string	"\177S\374\253\342\337\005\376\355\371W\304\277+\376U\340_\240\177\021\3707\350_\024\377\006 \364/\211\377TN\374\314\364\257\b\377\376\376\365\375k\364o\321\277!\374{\364\357\b\373\301\277\347\277D{\302\177\240\237\325\374k\302\277I\377\006\377E\377\225\340\177\327\277\f\374\033\343\337\007\376m\361\357\320\277,\376\373\374\037\363_6666\366\357\177\023\202_D0C\341\004P\035DL\266\261Q8c\334FF\t{\b\325A=\354%\024\304a\224\221\230\\2\006\021\223Q\306NF5P\017\227\2128\206]\f\352dT\017\235\2042\002\021\223PFb2\352i\213\020\345\3301\2529JYY!q\330;\232\236\226\212@J\"\022\252\273\272\267\212\215.\"\320\375\004U\354Z\372\261ZL\312\035LW\226\240\026\331\335%\232\230\244\240z\250$*\201\352V\302T\324M\016\b\221\312\256a\225\302!O\255\303F\367"
+	.string	"M\335\302mew\013\273\273V|Bv\273"
+	.ascii	"D<65u;\t5\365\223p\313F7W\361\3222\022\223RP\267-\253\344\261"
+	.ascii	"o \205{\354\256\250bM\n\245\264\216\356^\037\352\321\330CN\023"
+	.ascii	"f2\223B\244c\205\3153\223\237\223\354\026/\001\241{\350C\304"
+	.ascii	"G\0173l2\016\234\303y\t+\341%\016@u/\361\022\033\236\356%\333"
+	.ascii	"\356\001\273\007\230N\244n\260B3O\313Q{\236\334\316Hlh\264\314"
+	.ascii	"\231:\222\242\016\267dQ\035O\330\220,4\ra\363\347\033\246dD\035"
+	.ascii	"P\310\240\036\247%X\025\233F\204fY\3051J6O\353\372=\203\006\216"
+	.ascii	"\327\2336G\257/3`\302\204\035\253v\300s\364\362\245\316\215\216"
+	.ascii	"\226#\226\225\265\222!\217\265+)\034K1c\326\f\2238K\252e\231"
+	.ascii	"#\227.v\304\310\031\263\324\242\225\347\347&&\362\016\216\201"
+	.ascii	"\213\f\204\241\230\006\306\301Q<\003\327\300CX\007\027\341\024"
+	.ascii	"X\005\266\201\2030\0216\262\024\363`\030\330\007?q\013,\003\263"
+	.ascii	"\300+p\017v\201_\340\037\234\203\2356\311BxxF\201m\234\221\335"
+	.ascii	"C,p\272V\313\177\313c\345\005X\030,Y\326Jl\261\3747<{'k\016\230"
+	.ascii	"\033\013\341f\246!U\307\356\376n\211a]\375\260VY\316\370 f\211"
+	.ascii	"\365\337\302\260\334\352\354\235+^z \263\025\207\353\230ue\314"
+	.ascii	"\313\215\233\345\325VI\341\b\205o\254\225\b!P3\241\321qT\362"
+	.ascii	"\360u\274\215\255\325*\235\002\034\006UE\204M\266\303x\232\204"
+	.ascii	"\024\341\201\347\316\223\025d(\202\264\365l\335\301\301G\235"
+	.ascii	"3\275iZ\302u\240\200`\342\262\363\324\002\035:<u\001P\267\324"
+	.ascii	"\224\021\256\030\334\260\371\232\003\354\233d0\2362\203\272\227"
+	.ascii	"\354hu\321i\201\332\227\220#d\356\324o\223\345)\347\255M\362"
+	.ascii	"\024\226##:5\217\006j\320*>-0K\242\244\327\260\331\003rX[b\263"
+	.ascii	"&\314W\375Rqa/Q\336x}q\263\034\303er0\263\004\303]\250\274\274"
+	.ascii	"\330\f\263Y\245\023P\017\263\204-\273\373\346\305b\272\336\360"
+	.ascii	"\222\3430\034n\303n\370k\223\354\305\\\347\035x\313\205n^\034"
+	.ascii	"\246\215\r\354\311\325\017 \223\313\341\230`\"^\020\345k\271"
+	.ascii	"\206\2736\311l.\204d\303JV\263J'd\363\b\201e)\006Vb\305\217\234"
+	.ascii	"4]@hf\032\021W\2203\370\300&\243\2519\375\030\203B\026\0366\311"
+	.ascii	"g\352\034&[s\016'\304\027\"RY\3655*\3655&\225\311T5\313\027\270"
+	.ascii	"\220\324\327\246\352k3\324\327\242\352k.\324\327|x\351\222\024"
+	.ascii	"\003\306\325\205\321\224\321\301d\254\254\002\013ka\255\277\307"
+	.ascii	"\346DK\206,\034\365\234e\003\"f\262\3304\367]h\234u\276\362\367"
+	.ascii	"\360\230\033\216Ml\2766\254g,\266\362\367\210\350\232\302\222"
+	.ascii	"\202\247\236"
+	.string	"\253\314\262\306\300Z`\223\257\252\r\332W\n\020/d\021\002\204\315\363\325\317V\213E\302X\236\037\330\374\331\0214N\336\316TBpyYV\261\351C#S\317N\370\311\231\352T,\245\"[\205\305R\3229\206\265\223\223\212\332\243N\027\026\362,\345_>m\242'\007\343\221\310\346\347p\325\377\236\032\224+'QUQdNi\264\220\0301\217]\226\224a3\311Px\350\003\325\005\326\205C\345\237\326K\305\356\3461Cv\221\311\207\266\263\375Y\331\"\320\375\233\360u\013\327\034\301j\022-K@\216\242?Sv\017\243\204\021D\031\207Q?\210\311\250\026\016\247\204A\305\216\022\022\223\335A=\f/b\241\204\016)\241:\016\316\024\315\001m5\200\277\031?Gg0\255\321\001\316\026|\021\013\036P\347C\n\341#\342Y\212\363\t\342|<\340\314\307\003\312\212\202<\337iD;I\350\245f\232\236\350n\227\253\325"
+	.string	"\376t&\032\004\312v\247\217\3273\312\325vg\212d\352\316\264v\024\307\003\262\370\251\201\006\323\036\357\344 \350:\234\257\002\016x@"
+	.string	"\256\353\241\247\357\344\325;"
+	.string	"\203\001\0301\224j\217!\243\205\214\026\264\307\220q\273\311\200q\253\207q\223\241\271\"\235\031|\321\210\377\200':\024\374\375\320\241\020\250/\305)\2418\242\024\325\331R\034\257G\344\373\315PBA"
+	.string	"sG:t\206\236\273^\322\017\005\356N%\324(\327C\3174H\3514\002\"M@d\224+\002q\356z(z&\375p\276\036\212 \256\306\313y\360\353\341xHF@\241\240\340\231\236\350\316\327\243\201\013\346R\334\021\022\032\024\341\004\246\004\370\234F9\035\210 z&\371z:t\327;\232\371zGU\004\335Y\244S\312\035U[:\303(\227\344\373\365\2029\243\037\020=\203>\ft\250"
+	.ascii	"\351y\242\274s\202\323\210\347\223\340(7#\tH\004\300\316\350"
+	.ascii	"W\224\236"
+	.string	"h\221\007gP'\301\271\373i\200\366rB\276^\020\007\343Vug\212\204SBC\030\235>_\256H\207SB\312\341\224rG\266\024\375\241\350I\202\026<S\"\242_\210\240\022DD\277 \222\256\200\264\247\224\303\361\220h\234\273 \022\320\327\023\340\004\326\b\342\316\244^0\227\324C\317\235\t\364\027\324\345\210p\277 R\016\307\363\365\212\202\277\337Q\212\323\241B\273_\017=\2018\"\240\021\356<\312\241D8\035\232\342zi\212\226\330\365p\301\236\017\351\307\205\221\022\232\332\202\270\030A_\017\251\366\333m\006\212\0176\260\240\352X(\241C<\340\220\257\227;\032\322\241\351\020\013"
+	.string	"\202i\216\b\267C\312\321\300\245H4R\021B\2616Uc?\310Z\312,\310\220I\027\233\017\013c\261\325\241U\020*\263%\205$\254\333I\305\217\227&7\216\3449\213\005\201`\250q@\307\020####\"2\222$\351Q\005\3040\310$+\036\022\200t1\2279\307\206f\232,\373\377\006\022\017"
+	.string	"\213\304>0\371\373\211\374\361*\254\347\224L2\354\030g\313\360:\315n\240\215\261\363\t=\241\223\023\360z\257\022\302\233\210\252\007\220\005\034L\007bw\212P\250\bh\372\327\200\356\267\270]\250\231\303X)\264\311\030\326\304)\257m\367\237f\356\214.\364\177\223\252\017\035\344\200\215\006\313\341\243\370?:\337\376\271\3104\332L\272\033(\003\020\r\353\303"
+	.string	"J\244\345\246\203\346\346}\345\313\025\177V\254d\331\340.\n\344\0020|\224\254\274\220\221\\\023_ZT:\330\023\3409'\2579\204\270A\002\223\274k\001!0\311m\343%\340\031\020\236d(\263+\020\005\213\264\306\227\264\270TKF\314\f\356\235\bY`iA\324\372\236\202\222\2630\036\205 jyD\246W\030\210\270\025\003\035|\bW\024\332\205.\357\303%t\352\217\331\242\017%B{\0328\030H\253;\007\\\365!\355j\336\227\202yo\304\267,\307\370]*8Q\314\3372E!\311\016^\247\276\364\305\231>\t\371h\367\252q\020j\310WT\\\031\322v\350\231L$"
+	.string	"\212\224\216\031\250!\325l\377\277\200!\327\234L\205lV/g\2726\247\302\261\025\372\342\335\326A\020f%\030\301\335\372|J\220\006\254\334\177\353F\005\r&<q\357\243f%\356\f\221\317\223\222\f\252\274\237b\002\214\024;\255\013)~\350\024\261$\034+\032\272\377\234Y-]i\323:\366\3113\307\235\352\372\201\360\230\315\001\2739wG\250\215+eP\017\0258>\337\322\225\004\254\373,\006E7"
+	.ascii	"A\035\202\361s\361Fk<\257\374\2064\217=\362\326\362\276\t\274"
+	.ascii	"(<h\344>\226u\364\200\307#C\024r5\200\225\211|\327\262\2608\311"
+	.ascii	"T\320^\tL1@\367\235\t;.:D\003`\242\376\033\266\313\026\257\210"
+	.ascii	"W\340\337[\243A\373\b\017\226*k)\367\210\354i\317\232\2668|\261"
+	.ascii	"k\027\020\334\001\232\370\370\2556\215!%j\245\320[\2412@\257"
+	.ascii	"\037.ZDH\231\034\337@\0077\026\307\340\025$\242Z\360\025L<1\365"
+	.ascii	"\326O4\374o[\303(\215r\275\265\360\317\336\272\365\204Ui\357"
+	.ascii	"\256w\241\bXm\260\217s\002\362r\020\276{\306\255\332\240\204"
+	.ascii	"O\305\324\261b\215\022\361m/\3679a\340Pr\027\252=\037\370\311"
+	.ascii	"\016Z\013\370\375\337\202\003z\020\362o\277>(vG\035\334\337\367"
+	.ascii	"\267Z{^\234r\327\007x\270\2725\200_\025"
+	.text
+	.section	.gnu.lto_.symtab.759c2718d36a2321,"e",@progbits
+	.string	"pgResetFn_rxConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\001"
+	.string	""
+	.string	"rxConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\001"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\001"
+	.string	""
+	.string	"rxConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\001"
+	.string	""
+	.string	"parseRcChannels"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.759c2718d36a2321,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,287 @@
+	.file	"msp.c"
+	.section	.gnu.lto_.profile.f0bbdc7682c9e455,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.f0bbdc7682c9e455,"e",@progbits
+	.string	"(\265/\375 b\275\002"
+	.string	"\304\004V"
+	.string	"\006"
+	.string	"\332\205\333\362\001\002\002"
+	.string	"\002\001\001\240\342\234\212\n\002\237\275\226\271\002\004\002\003\352\263\360\321\b\004\376\314\317\334\f\b\002\003\002\003\002"
+	.string	"\002\001\002\002\002\005\277\257\241\307\t\b\002\004\002\005\002"
+	.string	"\002\005\002\006\002\005\002\007\002\005"
+	.string	"\003"
+	.ascii	"w\202\t\362\330@\033"
+	.text
+	.section	.gnu.lto_.ipa_sra.f0bbdc7682c9e455,"e",@progbits
+	.string	"(\265/\375 6\025\001"
+	.string	"\230*"
+	.string	"\004"
+	.string	"\002"
+	.string	"\020"
+	.string	"\007\003\002\001\003\004\002\001\005\001"
+	.string	"\005"
+	.string	"@\025\034\024\r\227\0303\203\331"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.f0bbdc7682c9e455,"e",@progbits
+	.string	"(\265/\375 \306\305\003"
+	.string	"\202\306\024\036\240'\351\317\371\244\300\263\370\027w-\276\273Q<\033\002\377\377\367A\341\377\023\261do\271S\377\367\256\n^\025\373\266\356l>\215\307%\013\242\020\372\007\216S,\2102\030\177u\213Dr@\275a`\024\316\305{\025\340S\357G5\263m53\323<\216\b\016"
+	.ascii	"7C\2030.AW\304\322p5\220\224\013\030\215\352$V\261^\005v\223"
+	.ascii	"\036\313e5[\203\001\026"
+	.text
+	.section	.gnu.lto_.jmpfuncs.f0bbdc7682c9e455,"e",@progbits
+	.string	"(\265/\375 6}\001"
+	.string	"d\002*"
+	.string	"\004"
+	.string	"\002\001\001\f"
+	.string	"\002\n\177\002\b\002\001\001"
+	.string	""
+	.string	"\002\005\004\002\001\001\017\177\002\003\177\002\t\005\013\177\002\005"
+	.string	"\002"
+	.ascii	"\0035\334\006\260"
+	.text
+	.section	.gnu.lto_.pureconst.f0bbdc7682c9e455,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"\204\004\002\230\004\004\231\004\005\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.f0bbdc7682c9e455,"e",@progbits
+	.string	"(\265/\375 \274e\003"
+	.string	"\342\004\017\030\2405\351\017.\357\274\252:\352\377\377\377\337P\3646#t\315\332\266R\246\317\303SupH\277\217\307jv`\262\352\233\344\323\307\322\n\233\001\220\224\246Qv\232\362\242\374\211k\247\225\023"
+	.ascii	"H\t\300TN\213\035h\f\246D\227\223\255\262\377\312\202RV\251*"
+	.ascii	"\361\025\201T\001vs\201\272\252\205og\314f;`Y\030\264\001"
+	.text
+	.section	.gnu.lto_.lto.f0bbdc7682c9e455,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_rxMspReadRawRC.20.f0bbdc7682c9e455,"e",@progbits
+	.string	"(\265/\375`e"
+	.string	"}\t"
+	.string	"\346\022C90\305*\035\210\343\302@\364dy\346"
+	.string	"\253VJ\ro\354\326\020\016\240E\371cd\221\241\256[R\016\230S\260c\004~0Q\213\346h\022`\343\301\305 \301]\355\336[\246\0242"
+	.string	"3"
+	.string	"."
+	.string	"\357\350\354\351\347\252\330\210\250`\263\335oZ~\231\\\352\013&\227\020\343\336\325\363\017r\f\214d\305:]\003\032v\327\272bY\334\360\2661\266\027l\323\002\227\330.E-\300\226H\231\206\355\316\256\330\216jk\024\272\277\"n\331\024"
+	.string	"\227F\325\276\307?\272\177\022'\330m\315Fv\277\004#P.\375Ql\373\034\001\224\335e\360a\017\201\3603.M*\351W\227~ir\031\241\200L\341\341U4\224\326\354\357\244\360\302~\\\330\262\255\216\177\375\032\325\227\225\215!\316C'z8\016\347\340\001}\270Pic\332\006\334\311\214H\240i\332f\350\303\001\315\316F\232\031\003\213F\236mr\"\3216+\337>.l\031\036\240`\312\266'\036\363\002\f"
+	.ascii	"<\241\005(\306\013/J\020\224k\370p\026/\307\204\006s\005*\034"
+	.ascii	"\334\355Q\255t\204I\006"
+	.text
+	.section	.gnu.lto_rxMspFrameReceive.21.f0bbdc7682c9e455,"e",@progbits
+	.string	"(\265/\375`\250\002}\024"
+	.string	"\246\246\204H\320\356*\035Z!A:\0327\324\003\207\n1\231Af\343\230j\215g\321D7R\254M\256\222\374\207Uc\356\033MpT\236\357\306\233\255\313+\270\302\013\256e\207\234i\340E\337`t\301\303\037/\235\321\b\"\233\310\235Rq"
+	.string	"l"
+	.string	"l"
+	.string	"\273\267\237\240\335\035\211\007\214\237\336=D\374\034\017@\3744\314f!`\246a\364\322C\332]\224V\020\375\361pw\207\n{I\234c\250\022\346\363\356\241sy\211\303\366\3423\223\242\tg\346s\234\371\030\226f1\031\256B\002\205\320$\t(\364\236K\030\233L\20682\327\367<DGV\364c\223\271,!\330]\313\232m\302\235q\3339\266\017\330\222Czc\357\\\244\211\205$\240\365fw\\\367sl\234\3477\335w\213\357\3353\224\016/\255*-U\372\036\020^|\001\200vc\20206\305\024\322p\337\337\363\021\311\330\265i\261\341 \374\236\236\207\302\365Q\220\373\001ww\344\323\006\306Oy\262-w\377"
+	.ascii	";\217\207\234\261k\203\"hwIL`\374\024\t/\355\347\276\003\273"
+	.ascii	"\256\345\036\001\037\365\346SM;T\177r\344Sal\333\244S\257\343"
+	.ascii	"\235\210 \223\036\356\356\206.\360\251\035z\242\021\321jB\265"
+	.ascii	"\275r\240\027\210\321\356\232\370\">\202\345\343>\375\300%_s"
+	.ascii	"\211\237rE\315EL\006\355\207`y\2158\277E\017C\023S\016U=\255"
+	.ascii	"\203\274M\210W\251\247\345\310"
+	.string	"d\320S\2579\035^\221/FL\006U}D3\233\006\251\257\254^\254\004\016RV\253\023\006(\032)\252\223\326\202i\224\022\025\227\n\305\322B\255R'*\024J\313\205*\0011K%\245\205Za\261Z\250\323n\2577\243v/\2001\225\371O\211~\211\023\245|\234\033\250T\342\347y\227\270\035\244\243\230\f\226\364\306'\232\271\241\372\033M*~\334C\242\250\362\002\357'\212\272\241\247\231 \255F\366\022m\267.D\002C\316\303\321\324\033\0075 \220\002\23122\017\242\300\002\217\360\250\035\007\230U\245\255n\025\0016;\242\360D\265\032;\346\001\022\253%,q\342t\240\334\313\212\346-A\233=F\322\002\202X\016\231i\250q\323\306xi\b\264\204vk9,Q\252\006t\203\341\202v\022 \221P\205\0330\2406~:l\320\204\300\262\245\005\327\223\200y\341\306\204$\224\215V\233\341u\260\241\321\364\004x"
+	.ascii	"P6]\364\t"
+	.text
+	.section	.gnu.lto_rxMspFrameStatus.22.f0bbdc7682c9e455,"e",@progbits
+	.string	"(\265/\375`\250"
+	.string	"\005\013"
+	.string	"F\325M? O\225\016\303\322@R\240&\003\340\207K\024\211,\304f\004"
+	.string	"'X\241\226\374\024\307\270\206\276\272YL\371^N2\370\242\234_ m\t\004\320*H\213\305\353"
+	.string	"\215T\n@\350\223M\244L)<"
+	.string	"8"
+	.string	";"
+	.string	"\366\016\302T\017b\240:\\\354\202\233r\270\367L\323\363I\317\032\260\302\324\267\272f\bZ'V\222\317\224M>6\254x\354i\341;eB*\273\353L}\027\356x\333\016l+\260\177 NM_S\026\312\243@\270\253\na,\212h\302\203\355\333\036\331\022\333\231\366C<ct\215\t\027\260\353RAb\027L`\003\221G\203\237h\217\221\017\320\036m{\001\203Q\231\2768\336\0217<@\260\310\022->4\250E\332U\002G\212S\276\260\277q\021\"\277\203?\240|\352\321\007i\217\327\307\236\030*\300Z\031\254R\2066HJ}\331\317vw\255\256\230\316\322E\300h2\335\346\003!\304\005\360\205\322\361h\266\020\267m2\026\315v\341<\033\205\2009\035\f\267u\034\016\267I\300\275\272\f1\251P#\364\367\264\307\016 \303\007\215\364=-\225\202\272RRS\016"
+	.string	"o\b8\252\343,\026\n\035vHe\b,\266\025\177@\020\211\020\265\206"
+	.ascii	"\271\214\276I\005#U94\227\332\003"
+	.text
+	.section	.gnu.lto_rxMspInit.23.f0bbdc7682c9e455,"e",@progbits
+	.string	"(\265/\375`\315"
+	.string	"\005\013"
+	.string	"\266\323JC\020\251j:\307u\304J \004\232\004\357\212\024{\301>\013.b\256\263\330\316;\f\301"
+	.string	"\026\304\201(4\227\226\317\272dP\0364\222\260"
+	.string	",\006\b\245$\fQ1\0073\020Q\2102.!\267\261\021\331)\0052"
+	.string	"6"
+	.string	"<"
+	.string	"\3357\247\327p\337\2727p\337l\332\020\236\252\354Y\350\b\002\331\356zZ\312\315W\323\277\201cN\224\351\365b\261\273\256'*uk\267\275\261]a\177#vj\252\032\212}\313\356\256\265\225\375\364\257\027\256\301\203\007\007\273$3\t\013\333\030"
+	.string	"\260\375\214\355\232\226&H\274\332\037p\002\346\013\204|aw\325Z\260\233Nx\023\n>(\372:U`\007Dl\367\364\323\016\337\022\237B]\247\352%&'9\333\343\tHL"
+	.string	"\227\214\341#\316\026\375\300\250\333]\n\237\005\362\241\211\255\224\270o\230\023\227\200\b\247:\013_\331)5\276\020,A\242\f\322\250\360\0019@\342\005i\354\354\341\204\310\320#\215\036\b\354\204\236g$=\216\203\305\3207z\245(\216^&\335[V[\031\343\005;i\"v\307\023\361=\024"
+	.ascii	"2\241[/0.$@\020\250T#\030\2412\225p\251\200&\225\331\323k\237"
+	.ascii	"\331\245\006\273\342\032\305\n\343\201j\340\n\230\033\240\242"
+	.ascii	"\200\273\274h'\031"
+	.text
+	.section	.gnu.lto_.symbol_nodes.f0bbdc7682c9e455,"e",@progbits
+	.string	"(\265/\375 {\235\002"
+	.string	"\202\304\020\035\260%\351\270%\216\035\210\020\210d\002\315\006Ub\030\212`\340!\204\220co\255\265MR\377\227m\f\331\375\227m\2062\020,T\n%\\'\274A\212\016\361\027\315\004,\217\037H\314\320\266\007\323\375\037\001\004"
+	.ascii	"]\217G\0021 \3034\265*\003"
+	.text
+	.section	.gnu.lto_.refs.f0bbdc7682c9e455,"e",@progbits
+	.string	"(\265/\375 -i\001"
+	.string	")"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\001\002"
+	.string	"\002\002"
+	.string	"\003\001"
+	.string	"\001\003\003"
+	.string	"\003\004\001\001\005"
+	.string	"\001\001\t"
+	.string	"\001\003\r"
+	.string	"\002\005\002"
+	.string	"\003"
+	.string	"\002\002\004"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.f0bbdc7682c9e455,"e",@progbits
+	.string	"(\265/\375`\227\026\025g"
+	.string	"\n\251\234%S@\216J\352\355\301?@\317"
+	.string	"\261H.\275\030\263\327}\222U\017\270\272\313FZx\322\321\037{R\021\361&b\242Y\211\375\013!\273w\301J\204\216o\2665\343\356\304\216a\221AA\034\264\312"
+	.ascii	"\377\343\300{\324\322x\251\372\327P\220\273\257\364M\366N)\005"
+	.ascii	"\034\002>\002L\002\355q]8g\302\304\370\361\252\233q5\265\352"
+	.ascii	"\t\214%8\335\025\231/aN\260\030\037\023&g\013*\027\035\"&\314"
+	.ascii	"\r\025\030dH\266\3660p;sK'\257z\233\273\371\263\203\277\245\305"
+	.ascii	"%YKg\316\310\234\334\017\334\336a\365\250wX{\214\203\3610+\306"
+	.ascii	",0\235\266\303\005Z\366T\205{<\303\352\\n\336xX\375x\265\035"
+	.ascii	"\211\327\266\354(\277\272\204\305\320\276\245\3010\027\027\233"
+	.ascii	"\323\253=\306\325\272\333&}\"\006\246\210\232\226\0375'\267\346"
+	.ascii	"\212\004H\231\026^}z\232\243ug \207\033+\313\257v\b\270\211\240"
+	.ascii	"08\025\221$9^u,\177\234\201\306\364jo\200\375\351g\335#J\370"
+	.ascii	"\225\234\2349\250_\312\242h^\365\027\234\212?\203\274J\273\025"
+	.ascii	"7k\233c3;s\214R`Y^\365\340?\253\212\001n\017Zy<hm\024\330\003"
+	.ascii	"\b,BJ\007\236\246\224\223\016\261\256u\352\205\334W\024\260\032"
+	.ascii	"$eW\\\257:\330;\024\017k\007\363'=\242D\347\034\263V\316M\007"
+	.ascii	"Ss6\272\037\260\343~\200\216,\005#\223U\355 \334\355_\356\365"
+	.ascii	"mjs1^m\367\352\366\246oy\227/s>\346\2345\350\254\234\225uy\325"
+	.ascii	"\2278\023\177~\360&\355N\234\253u\306fn\346\334\344y\037i\272"
+	.ascii	"\230\274\332\343?\353\033\200\333\235\215\263$\227\350\307\355"
+	.ascii	"\037\3264\032\365\017\353/\375gM\3003\254\236d\327\256$\303\232"
+	.ascii	"\244jf\236\035\245\221\247\327\253>.t;\022\327\372\220\"e,3W"
+	.ascii	"\316M\037"
+	.string	"|\034\373\322z\265\233\376\263b\317\260.\273}\307qt\273\316\217\343tOw\032A\257\335\251\001\nt\267\007\235\323\235:\300\001w\247<\335~\243\333\245\272]\331\355P\335\336\324\355L\335=\246\273\321t\273\206\356\206\322\335\\\335\335\325\355#t;\207\356n\321\335o\335>@\267o\350v\261\356\216\322\335a\335\355\325\335Z\335\r\324\335f\335\255\213F\243\321n'\321\255\206u\373\034\003\277\346\317o\373)\375d_\326\217\345\302\032\024\257\022\316*X<\034n\356\261\272wO\376\353\353Ie\327\366Q~L\207\022f\316y\007\326\305\3349\001s.&V\254\272w\\Pv]\377\365D\205\255+YJ\2600u\354\210zA\342\305m\231\003\006\363\005\207\333)\366d\2454\031\314'R\204\215\031\006\301\021.7\262\266?\342]\016EA\002\255/>\034n'\315\371\206\034\363o\264=\016\207s(U.\276\221"
+	.ascii	"\002\344J\n\210\201u\252\353\255\t\003\265q\024N\223\376\263"
+	.ascii	"\216@\342\3761\270\017r\346\252\021\022}\202{\365\305v\375R\n"
+	.ascii	"\200B&\366j\r6\342\256q\303]\203\005w\315\030\356\232 \370\275"
+	.ascii	"T\251\263\035*\274\3325=p\327(q\257Q\334k\032\356\265\f\367\372"
+	.ascii	"\205{U\202{5\202{e\342^y\340^\247p\353\242\270u[p\353\246\340"
+	.ascii	"\326!\301\255[\001\267\356"
+	.string	"\n\267.\n\267\232\006\003\t\371!\376\004z\026\034M\351\251\352\325V\311`\022r\324\201\326V\273\340V\251\340\240$X\004\016|Be\302\235\266\341\346\222\202;5\202\233\n\016\334P%\356\265\264\210\333\355\341p\233\351?\241J'L\334\nU\232\307%\2457%\033.\306E\220\267\254\032rj\227[X\364M\350\247\302Q\342\344\252\355\325\237Bbe5\263\340\366\271Wz\324\273\322f\024\314\364\304\341\226\305\273\3640+\376\361\004\267\261).\306\244\366\203\254\314\241;|t\277\323G\375\214\247\361P\377\364R/\343K\370\244?_\351h\375M\017\243\201\232\273W\376\213G\246[I\354\365\254\372\342d\034J\325\223\217\317,\346\003\335\356\305\313x\232\247\027(\370X\277\362c4\230\023KI\233%\265\024\334rn\266ku\357^\371\331\341\322&3+\245I\371\360\004+\2132\223s\223\001 \006T\264\254\344C"
+	.ascii	"\265\237\bVs\3233\254K\317\264\343\203\311\266\354\261\204\343"
+	.string	"\225x\330n`Y\231\201\337\330\352\222\245Nj\224:\373\"n\027\203\333c\300\035\305\177V9G\023\247Be8\031\223\213\313\t3\323\022u&kM\242\242R)\354P\212TA7qh6\230ht*\325l\317\366\265\305\310\253i\t.\266\"\217\244i\322d4\304\220\234\r\301\355`\236*\237\251\322\301\274\231\241j\232\304\222\315\006\332fG\214\030)\024\206\312\362\324)\024\\Z\2157\033\251\023\007$4\3208\311\330\311\222f\206\355\205\314\2702\365j\333\224\320\364L\233\334\313\006\231\027\330\342q\245HN&\033h\233\030\270\323\234\026;5vjL\231,hf\250\233\2547\036W\314d\252dPw\272\324)\323\213\241a\341\310\253\251R\372\"g\013F\234Y\372\"=\332\260\200E\205\371S;Z\346`\224\341-\270\375\273\327lL\346\234g\350\2329\251\224\323\256s\017\352\326\361\324\021\350n5\247\335\275"
+	.string	"/g#\224\"b\260\2200\243\215\366\220\273\2419\037\255\212\022X)\217VSH\247U.\036U(\372$\263U\021\351\314\331'\037\217E\025\313\354\203tfe~\201\246\364\334\264*\346\3432\373\344c6z@\036\255\224H\247Q\351\203tZ)\263\323*\367\344\2431\331t\314I\237\354\264z\313\316\245\262\007\351\\*\221N\253,\177j\302J2\343I\221\035T\236\003y\314ONU\306d\017\024\331\\\346\265\234\235k)'\021\310\271j\231\\3Ny\024%\350\223\322\023\343r\203\223\322\3252\037\241\310!\313\234\207(\031e'\022\305&4g9\264\250\243*\313X\312y"
+	.ascii	"\247\234\213\236\2419\347b\316\271&Y\325\314\271F\017\222\351"
+	.ascii	"\344\2243\025\220S\256*\212-\345\374\\]\242(\221\316\253\345"
+	.ascii	"N\254\211\223\231\231\232Eg\3465\253$v\026\267\262\214\234\263"
+	.ascii	"\207\301Le\024\\\364\347tKth\271z5\r\016\230\037n0^mL\004\267"
+	.ascii	"s\031\001\343E\213\013\323K\022\030\230@\3140\311z\240a\256p"
+	.ascii	"f\327$\214yU\343\344\252\311,\310\267P\244\315\315\265\232g?"
+	.ascii	"R\210[b\346\346s(8\\\032\346\331Sy,?\346\241\357\345\335\336"
+	.ascii	"\314Wy\270/\363g^\314_y4o\345ax\271g\373\270\317\362a\036\355"
+	.ascii	"\337^\355\277<\227'\3631\274\226O\373.\017\346\267\274Y\357\017"
+	.ascii	"x\201\r\233\364c}\254\220\017\013\f\252\330\351\021\272H\270"
+	.ascii	"\003H!$t3 \266;\355\373\265,\220-\302M\302\204\003&N\020k\372"
+	.ascii	"\004\n\021(D\254}\002\305n\207\302\304\016\267\211]\372\026\t"
+	.ascii	"[\240\313#\266<\"\267\365\361\270\274\242\037\0210\230\202\330"
+	.ascii	"\336\b{H\276V'\034b}\210\354\221p\250\202\350\250gt\303\016\375"
+	.ascii	"\332\226M\n\362\200?\017/\257\246\250\327\"\370\343\025\r\217"
+	.ascii	"\204@>/\353\262\355\020\360\347\202\367\366\\\036\322\260}A`"
+	.ascii	"\205.\0019\354Q\317w\363\266l\022\360\347k\207~H:\340\017\t\203"
+	.ascii	"\340c\215|\304\036\022\346qS\034\365\222\200\301\337\333;\n\n"
+	.ascii	"[\366\005^"
+	.string	"\340k5\270,\333\026\261*\330\243\"\340\004H\275\024IB\""
+	.string	"\206\216\202F-\330\3277\001;\024\314\240\375\365\200\200?\037\353\016y\304\026\207G\034\366x\304\036\022\217\333\006\333\226\375Y_\326%\"\n\342\370l \"\n\276C_\001\356\217\330\343\025\r]\260C\357P\b\374i`\205\"\274<6\351\367\366\222~-;\304\241\r\276\276\036\021/\370\016{\274\"\340\317\350\r\006\221\\\236\257\005\032\n\376ZV\310#\022\036\361x\276\326\345\375\\\267\3350\364\343\275?\340Pg\304\021\261uy^\267G\304\033\032\366\\\360\334\241\013w\347m#\020\3046(d\333\020o0\330\206\300!\262yy7\254P\204\026\035\bm\220\323\262C\277\244`\313\202\330\036\365~-\353\366\274\300a0E\016\373\366\204\214\\\266%b\205\210\255\016"
+	.string	"\300\025!\364\204\206z\254\220\257\305i_\026'j\200+\334a\373\262\310\340\362\330\267\367n"
+	.string	"\034\n\021\333\036\340\n\327e}\301\226\205\257\355y\331\n|-"
+	.ascii	"/\357\305\300\025.\007,\322\257\005\213\324kW\370Z\236\336\333"
+	.ascii	"Sq\304\002\201=#\037\316Q0H\001O\367\362L\354^\340o\210{\267"
+	.ascii	"K\341\201\003\r*\300>\020B\027)\004\261\r\001\374\365\220B\370"
+	.ascii	"Z7\004\210\f9\240\322\26363 K\246-!N\264W\251\250\322\033\017"
+	.ascii	"\344\340q\245\210N\361\305S\327\t\235\336\310\331\n\342E\310"
+	.ascii	"\253\251\ti\225\rV\2322\312\264*\265A\204H\226\2644@K\204\334"
+	.ascii	"Hk\374\224\234\345\232\230\201\322\250\2218\247\2243#\"#\"\222"
+	.ascii	"$I:Q\005\3040\310(+n\022`d1\3271\251\244d$)H\215\275v\003\005"
+	.ascii	"\271\314J\275`~\020\302\266\035]\356 w\026\253P\263\356\022n"
+	.ascii	"B\235l\022).\374\274\221\0250\2233\013N7\f\364\222z\032\371\232"
+	.ascii	"\2445\363\361\r\207l\356\360\271}\263\250F\260\270#\305\313\266"
+	.ascii	"h\334hhQb\230\211\374+\363\005A~\314\374\266j\254\303\227\310"
+	.ascii	"L\343D\353\327!\270=\004$:\241\347\213o,\334\r\374\220\312\b"
+	.ascii	"\225\376bm\006\336\265]\271N\334\306\324\3761\265,\266M\016a"
+	.ascii	"~\322^\374\253\340\024\374F\353I!!\217!5\246\340\312\234\224"
+	.ascii	"R=U=:\271\374\216G\341\031@\001\377\2409\r:\333\276`\r-E!\023"
+	.ascii	"\253l0Z-\334\354^\303\037L\361d\325\016%#\201\317\354\004>\327"
+	.ascii	"\206\352X\351\245\266 \306\201<\274\021=)\226\030\361y\3631W"
+	.ascii	"\326\001\224-\360\305\227\311\004\261\336{\2013\343\373\204\021"
+	.ascii	"\025\374\365\257\036\250\216%\266\"k\3721\264g\242\302\366M\252"
+	.ascii	"n\237u\177\013p-U\022\207\366\033\013bN%H\375\333(\373\233\317"
+	.ascii	"8E\031\313+\322\024\214\222\020\353n\270\377\234Y\221.z\316\375"
+	.ascii	"OS\225\007\247J9\317\237\232\244\037r\262\335\321\330\264\313"
+	.ascii	"\363\366"
+	.string	"\254\202\004_\024~\254\307\007\362<{\002a\214\357t\340^\223\365@\201\267\323\343\241\274\245\334\007uT\366\021\372\320\263\307\022\306\347\304\312\210\366n\240T\373\365\233vVH&M3\365\260\2534fs|30S\304y{\f-\357\333@\212\213\260q\211\252\035}\331l\315PY\026J\016\r\266\033\217\022\b1E^.\007\2170\267\263D37\365\017>`:M\377rN\260\267\325\025\206\364\273\275\336R\302\310\364b\003\327\271\217'\203\006\250\030\335\002\246\341\2737\350y\273\202\035,,\320u!\305U\003\232.Wb\304\306a.\304\354bm\275\345\337\036\002\240\215\2536N3\201\032`\266A4\236\250\214\304\272=,\036O\220[\262\255\004\241v\361U\366\222\277\023\236\300dJ\204E\243NJ\272\353\002=_\266\022\312\354$gG\tfd!\037\364\317`8\335@\254\260\321\324#0\004\332\005q\316\314"
+	.string	"\004\364\302\243~\277k\256H/\253\013o\312\371\323\207NA`\361\376\221$JV\031t\217J\030\262B\364p\343\304\315/)\004e~\347\357X\006;\271/& \272\202\f\345\0214+m\316\335Z\331`\3560\372\321\b\bR\226G\222\310\261\205\235\022\371 1\004\316\223D"
+	.string	"!\320[(9("
+	.ascii	"|1\225\205\327\370\336|\373\263^r!\032\r\257\310\313Q\312L[\372"
+	.ascii	"\037S\260My|\021\034\364 _\022]\212\016KA\320\210\343\355s1\227"
+	.ascii	"\301\"\262,b\247B\325\314\304\356\334VY\022!d\374er0\343\275"
+	.ascii	"\364\2005\331r\251i\352\304\233\005\337b\004x;\214X\0358\226"
+	.ascii	"NXg\303C6=n7\205\366`r\004\347b\306\240\024\032\376\2579\366"
+	.ascii	"\004/q\360D0uv\016\343c\b\202\307\253\317\317B\374\f\3763p%\037"
+	.ascii	"\206\234\r/+\360^|*w\370b\026\273\360\225sK\354\201\270\232\317"
+	.ascii	"\005\240KT]r\367\007"
+	.text
+	.section	.gnu.lto_.symtab.f0bbdc7682c9e455,"e",@progbits
+	.string	"rxMspFrameReceive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\001"
+	.string	""
+	.string	"rxMspInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.f0bbdc7682c9e455,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,2083 @@
+	.file	"rx.c"
+	.section	.gnu.lto_.profile.6817abb10635b1b8,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\006"
+	.string	"4"
+	.string	"A"
+	.string	"L"
+	.text
+	.section	.gnu.lto_.icf.6817abb10635b1b8,"e",@progbits
+	.string	"(\265/\375`\227\003\215\025"
+	.string	"\264\034\213\004"
+	.string	"O"
+	.string	"\354\256\342\024\004\002"
+	.string	"\002\001\001\321\332\305\303\017\004\002\002\002\003\267\335\335\337\n"
+	.string	"\003\317\253\250\341\002"
+	.string	"\004\330\370\241\354\t"
+	.string	"\005\350\373\222\243\013\006\201\303\362\317\t\b\002\002\002\005\002\006\002\007\002\b\002\t\002\002\002\002\b\240\342\234\212\n\t\n\013\f\357\220\305\366\005\n\002\n\002"
+	.string	"\002"
+	.string	"\r\016\017\352\263\360\321\b\020\231\212\366\300\001\006\002\002\002\013\002"
+	.string	"\002\005\022\242\264\360\361\003\b\002\f\002\f\f\002\f\023\024\211\373\302\306\005,\002\r\b\002\016\t\002\017\002\020\b\002\016\025\026\242\302\263\302\013\031\032\033\217\224\332\351\013\020\017\002\017\034\035\036\037 !\231\233\302\213\016\002\"#\323\331\354\253\b"
+	.string	"$%\256\334\323\366\007\004&\307\233\244\242\007\016\b\002\021\002\022\b\002\b'()*\347\346\214\201\r+\264\370\341\227\005,\374\327\362\373\r@\002\023\002\007\024\002\007\025\002\007\002\026\002\007\027\005-/\350\300\306\254\005\00201\274\205\242\255\006"
+	.string	"23\354\301\314\336\005"
+	.string	"4\377\245\346\313\017\b\r\002\r56\365\273\261\345\005\030\002\031\002\0317\202\245\236\333\0068\274\201\267\213\007\004"
+	.string	"\002"
+	.string	"9\205\326\204\336\017\020"
+	.string	"\002\032"
+	.string	"\002"
+	.string	":;<=\267\205\240\220\r\026"
+	.string	"\022>?@A\324\351\375\343\005\032\r\002\rBC\323\343\357\213\016\006\n\002\nD\312\267\354h\002E\225\232\322\306\r\b\033\002\005F\345\274\275\032G\347\273\234\355\fH\223\335\346zI\b\002\bJ\313\331\347\361\004\002\002"
+	.string	"\002\007K\342\201\222\246\004L\212\254\201\341\006\f\002\034\002\007\002\035\002\035\022\002\022MNO\260\233\213\233\tPQ\321\265\255\355\007RS\240\342\234\212\n"
+	.string	"|\250a\275"
+	.ascii	")27\322\024\244\220\341P\202b\246\250<\021Pi47)\025\2461\367"
+	.ascii	"\225\306pb)\264\317\374\002\326O!+\207\221\220bp7\362#\351\303"
+	.ascii	"f\261\210\275\364K\003\023\261\224=;\330\247\331(X\324HR\013"
+	.ascii	"\321X=ss`\375\234z\2174\377AN\024\304\b\336\033\300:\306 #\t"
+	.ascii	"D\251\263\240v\372\260_\302\3462^,\351\213Mr\205\230\272?\331"
+	.ascii	"\356\276\233\215z\254\276\t%\026\274&)\365\305\232\256C\021/"
+	.ascii	"\257t\335\251>\337\374\223\025%\334\020\034\"\210Y\334\266C\022"
+	.ascii	"\355gC\317\030\301\304\340xK8@k\026\242\023\273\325\210\352D"
+	.ascii	"7\200\001o\022\177\304\377\0252\260\023\342a\317}\203r\216\301"
+	.ascii	"\241}?=LC\004}8\"\366\273\017\224/\b\026\203{@\233\325\367\347"
+	.ascii	":\352\230"
+	.text
+	.section	.gnu.lto_.ipa_sra.6817abb10635b1b8,"e",@progbits
+	.string	"(\265/\375`\235"
+	.string	"M\006"
+	.string	"\202\310\027\034Pe\025:03333\023\002\273\036\251\371\360fHHTs\354\220_\362\345N)\252N\2009\232\242P\201\346\3073;s~\243o\315f\306\\\364\262h\275\312\224\235\254dF&D\037\016\306b\205\237\330\007u\r\345\ns\"(\250\227&\351U\227\026\242\252\244\300\336\006NV\275\r\017\b2 `\002Qx\033:\3016\366)\313!%\244\341\022\3325Bt\b\215}H\032#\364\213\0012(\213\256\026\026^"
+	.ascii	"\222\370\327.,\005\033>\315\2166X\004\365pb\260\360\310\034\356"
+	.ascii	"s\312\200K\243[F\257`\351 \030\035T\337\315m\224\3358m\232\017"
+	.ascii	"\036\336\210\035i\274f\261\034l1Z(b0\370\342\302\r\001"
+	.text
+	.section	.gnu.lto_.inline.6817abb10635b1b8,"e",@progbits
+	.string	"(\265/\375`P\007\325\033"
+	.string	"\266e\207H\260\224J:\364ve\215\034\207\242\370\177v\3577\017->\005\\\335\335R\033\267c\357x\373!\314\032!tQ\227/\326\\ev\367\331\377\203\316\257\321B<\372\243\035\330:|>\223\241\207\243$#\233\r\222F\310\336R\246h"
+	.string	"r"
+	.string	"z"
+	.ascii	"S>\324\\\200\270w\305\004\312\345\342u\274\360\365'o\3655\247"
+	.ascii	"\276\232\346\271\222\347J\236k\b\332\326\343\344\355\307\327"
+	.ascii	"\361'\351axcx\377\333l\f\013\275~y(V\032W\016\362a\245(\272\233"
+	.ascii	"\350\247\347\037F\322\324\363\255\374p\260\251\347C\371\362Y"
+	.ascii	"\207\273\273\305\177G\315\3163\230\302\377\356\350y\236A\334"
+	.ascii	"\217\340#N\274\337\357\216w\234M\335`y\201\037\267\327\361\366"
+	.ascii	"\337\034\375\241O<\214\304N\004q$\201\272\330W~\302\343\353\b"
+	.ascii	"\202~!1\205\361)\\\207\261\326\214\204\225FLXkh,\365\277\311"
+	.ascii	"\253\265&\227\370O\203H\354\020\227h\262\211\207_\036\376Bb\322"
+	.ascii	"\341\3622GY\253\253MI\331\202I\223\243\362\344\277;\364\254\273"
+	.ascii	"\311\245\356.\237{)\242T\037\312\013CW\"\r\007m\214\031Y0\006"
+	.ascii	"\\\202\316\270\303\267G\240V\276\247\262\333\357\3032\222\262"
+	.ascii	"h\264\244\0251\003\013p\b\277Jx\035\257\364\375\224\266V~\363"
+	.ascii	"\300A\003\006t\301\356\t\003\321\037k,\244\326\307?\035\301G"
+	.ascii	"\222\200B\036\274\002\247\363d\313q\235'\033\200\333\374\247"
+	.ascii	"]\335\3752\243\362\003\374\245\032s\374\314Q\252\001\272\343"
+	.ascii	"\247\356\306]F\004\3630Y\321\2202\223\376\227\t\377\177\262^"
+	.ascii	"\nX\325\273%\001\001Z\265\374\200UN\002\356\341\177\370\016\034"
+	.ascii	"6\314\214i\310\260=\\\324\335\004\216a\254\273a\370G\027\212"
+	.ascii	"\226D\221Q\345\216\223\302D\234\242\200\271[\330\361o\205\357"
+	.ascii	"\367\241\207{)^\330\270y\205\034\376)muU\027^A\324\022\324\360"
+	.ascii	"Z\2115\034tF\2422S\361\362\t\327\215\037w\030\255\006\230\327"
+	.ascii	"\313I\242J\305J\303\273\2654,\264\177\270\001\200\236\250!=\305"
+	.ascii	"\310\310\0054R\222\202\244\003p\002\031)\242\262\003\022`\004"
+	.ascii	"u#\235!\210\030sf\202\t\222\024\224\223\036\234\007\303\325g"
+	.ascii	"G\017\257\255\254l:\234M\376\204 "
+	.string	"\321\221\206Xy\217\344\2128\344\007\030;\232\215\345\024g\202=\205\367\177O+\032\3006\233\b9\353\377\320\377\365\353\032#!\301\320\330\324\255\253\b\366G\234\304\264\017[\362\320\265\257\333\213'\203\016\215#\004\353\214\037^\006\001\320\234zb\356h\204\023\312\346W\2069\360\304\032{\307g\204\222\357\301\327\005\367\240w\217\002B\370\232\232R\316\370\276\271+\203^!\303]7phu\270\013\2319\217\202\244_\224\271\200\331\247W2%\017\312\241\315+K\370ulM\232G\241\203c\360\255\224>\t\024xT\330l\317>)Q\366t}\341\257\276\007\333\r\004\213c\263\261\022\337\003\342\331z\002b71\355\314\374\210J\002\313\n\021\240\nwHx%e\r`c\362\251\261\237\304Cg\024\240Af\304\276\242\361\316$\323\242|\n\340\314\230b$\3524\333\016C\222\354\216\366\221\353\016\2100\376!\"J\254\222>"
+	.ascii	"\316\t\354\207x\240\215xn\371t\307%\342\342\234t\316\033=\325"
+	.ascii	"\304\313$,\307Ga\206\nL&"
+	.text
+	.section	.gnu.lto_.jmpfuncs.6817abb10635b1b8,"e",@progbits
+	.string	"(\265/\375`\264\003e\020"
+	.string	"\026\327I90q\n\351 %U\256'\021\304\321b\234e7U8\023\"#\"\003R{5\t\003B\035<\224t\304\303V+\217\261\313\177\277\266\326l\202\273\376\367\346\376\375F\032!R\2465"
+	.string	":"
+	.string	"="
+	.ascii	"(\035y*T\371\210\246W\230\024L\312\227\225\313J\311\202\337P"
+	.ascii	"\036\226\2505\246\317L\037\376\227<R\037\351a\310Z:\251\004\255"
+	.ascii	"\336\351\223-\"{\210\274\344t\"i\243y\r\201I\203\234A\245B\230"
+	.ascii	"Q3\243\312\221~\200W\210\210\b\017\305b\213\361R\250\366A.\355"
+	.ascii	"\322<\254\013\262\005\313\326P\030;\217\007\260n6\302 _\260\034"
+	.ascii	"\304\201\006cZk\255\232\262\244\203M\203g\360\013^\301\237\374"
+	.ascii	"\207}\030\331\321A\306@\030\243\f\266(\b\212l\260\006\216\025"
+	.ascii	"&\330Oh-G\t\306Hp\372&\364p:?\311\213\363!\211\250IQ\257\373"
+	.ascii	"\214\207\357\360\0346p4|\206UV\211A\f\177\3415\026V\205\2734"
+	.ascii	"\251\351"
+	.string	"}\220\245\260\305B\003\252\243\326\322I\217D\302\027\241@o\003\341;D\202\242$\2407\340\301\272\006i\250\321L\254\212d\264)\f\233\001`\002)VC=\021\240T\206\220C$\244 \005)\264\006\246w\311w\341\037\223\347}]-\224L\035$\333\207\032\205A\305s\355\036\033bF5:\002\032\377G^\256r\037\367k\247j\346\245\317u\327\037n\354\261\300\0366#\341\214\376S\262i\376\250\031r\311\302\374CM\242\330\264T\211\371\362\232\023\253\311\001\2276\305\263'\300;\025\251\006B\362\246b\212\224\337e?\\p\222\017\b\236y\f\371\035\301\272Ex\217>\326\344/\031>\252\362 \0165\325\332B\027\321\303o\212\222x3\312\334*n.\002\206%\034x\310\005\001(\"ff\250\252\315$J~\004h3$\271\"\357#\200\334\216\021\220\341\237Y2\230\002z\337\353\245\263\277\246^$\205W\276\004\370"
+	.ascii	"2"
+	.text
+	.section	.gnu.lto_.pureconst.6817abb10635b1b8,"e",@progbits
+	.string	"(\265/\375 z\375\002"
+	.string	"\242\307\026\032`94\006\005\240\030\f\001"
+	.string	""
+	.string	"\371\377\377\225\377\231\206@d\371\257\217\004B;\256\222G\362F.\362\220\007\362\217\347\361\216s|\343\032\3178\306uq\213V\321(\332\304\223x\021O\020\327\303\033\316\360\205+<\341\bO\0077x\301\t\236\006\232\232@\013\270"
+	.string	".\345PJ\231\002"
+	.text
+	.section	.gnu.lto_.ipa_modref.6817abb10635b1b8,"e",@progbits
+	.string	"(\265/\375`\207\002-\013"
+	.string	"\262\316)+\200k\226\00330\003\210veB&t\312\231\263\224c\3336\233f\335D$\220\330\266\270\177\214n\332\2249\b~\212hm\357$SN26\020 \332"
+	.string	"\3601\f\365BgQ\241RLoBB\257\b\205\320\007\325\354\030v\236\227s\344\340\256zV\357\321\254\3033\026\365\b\270\"\237\316\230u\236\234\257\213U9\316n\363\334\034X\006\243\244\247\364:I\232gfG=\251\027\216\224"
+	.string	"\363\304\f\r\350\265Sx\t\245\362\254\354\256!\201\351y\331D\242\333,xZ\236\252\341\220h\220\372\2370)O\353}\346dD!\216Y\250AQ\244\250h\232Rs@\002b\234\242\273\001\021p\035c\nUiSh99j6\213}Z\361\0323\1776G-C\353Q\242\334*\341oL\242\344\202\375\250\020\271\305\331o@\316<J.\b8=\335T\207^9\024\273\356\306u\024\202\031\251*\253\244C\335\274\261\\d}Yf\002\254\025\223\3373\363\2234O\226\331\202d\3078\342\3722\312z&\350\0221\313\213\231\204\362\340\375SO\323\177\017\006\315\266=\342\022\003[n#\363\322/\367\347+\342(^ \255\243\306vI_"
+	.ascii	"\220\343\202&GNR\204\322\321'\362\257\225\020|z\b\200\250\026"
+	.ascii	"Bz\b\357\376\243\257\301\031"
+	.text
+	.section	.gnu.lto_.lto.6817abb10635b1b8,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_rxChannelRangeConfigs_Registry.85.6817abb10635b1b8,"e",@progbits
+	.string	"(\265/\375 \226E\004"
+	.string	"\244\007i"
+	.string	""
+	.string	""
+	.string	"!"
+	.string	"\005\001\212\001\202\200\200\374\342\203\376\241\033\031\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\344\030us\355\007uq"
+	.string	"\005\001\006'\001\020\005\001\006\035\001\004,?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\023./src/main/rx/rx.c"
+	.string	"\004"
+	.string	"_\304\202Yt\212\"o"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_pgResetFn_rxChannelRangeConfigs.86.6817abb10635b1b8,"e",@progbits
+	.string	"(\265/\375`}\001u\017"
+	.string	"\206\335hF\360\222(\035\022\366C\234!\276\345\224v?v\330\233\352\325\211\247bA\355\245\353\327\325\353\2119\275#\337\255\325\003E\226>\263t\250j\353\006\266\362\260\314\bA\366:\256ml\365zEL\355\266J\b\331[\356\224\002R"
+	.string	"Q"
+	.string	"W"
+	.string	"\335A\266O\227l\034\017\301\375\313\307J\214\307\356z:\302\3622\274e,}J\215%?\346#\340\r\325\312\364)\003\320`B\bXm\220\013X2\264\303\036YV\250(_Z\256\207\035\001(S\255Z\036\271\007\273\353\250Z}\270\267\333\376l;\260\337\"\234\273~\356\257[>Zct\214\321\357p@\324\020\331\261\333\241v\2634SF\211\277n?\364a+\316\242\364\227g:\223\207N\026\343\220cwI>\335\240\373, \337\261\375h?\305U\224\356R9\201\335\326\217\331n\250\300#\335\247\303\207l\237\001\240,%b\300lt\030"
+	.string	"l\304Pp5O\331\354\013w\221b\240fw\031\3702\022\006\021\220\304\247\257\262}\036"
+	.string	"u\234b\315Q9U}\352\304Mc\273F}\312\004*\326,\365z\330\345\r\030c\345\307)\326TY2\264\027U\027;4Em\321`X3k\313\016\240\217P@\021B\"\223\017J\310\003a\302'\024\362H0!}!>)!}\036\351\363B \017\005\357\344\033y% \026U\370|\236\005\221\350\363:\341^[~\314\273\027,\232\223\242\246\272\230\233\241\034U\233Hr\251,\266g6\251w\275l4\304\036\227\273\273\322\t.\225\243\031\002\035"
+	.ascii	"3\003\3769\204i@\272\266,b,\201\225\221Y\242\203a\320\216\245"
+	.ascii	"\236\360\264GDka\314\024\0023P\227q_\205TKh]\354U\021\250*\034"
+	.ascii	"\334Y\325X\263\022\035\334\213\033\"\312^\250j\274\237D:\327"
+	.ascii	"|\002"
+	.text
+	.section	.gnu.lto_rxFailsafeChannelConfigs_Registry.90.6817abb10635b1b8,"e",@progbits
+	.string	"(\265/\375 \226M\004"
+	.string	"\264\007i"
+	.string	""
+	.string	""
+	.string	"!"
+	.string	"\005\001\212\001\202\200\200\374\342\203\307\362\023\032\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\305\031us\350\314\030uq"
+	.string	"\005\001\006'\001$\005\001\006\035\001\022+?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\023./src/main/rx/rx.c"
+	.string	"\004"
+	.string	"^D\200I^\212\"d"
+	.ascii	"p"
+	.text
+	.section	.gnu.lto_pgResetFn_rxFailsafeChannelConfigs.91.6817abb10635b1b8,"e",@progbits
+	.string	"(\265/\375`\366\001M\022"
+	.string	"&\243|H\320\322(\035\222%\332\311n\013F\"\026\300\255\273\213\336z\313\203\354\333\335Y\340\261\351\310\0060\347\017\327\341\337\266\235/z\363\362J(\n\257\"\276\340\nW\027\370\030\321\007\022D$em{\306\225\t\266\032\331\233H\231Rh"
+	.string	"b"
+	.string	"j"
+	.string	"'\221\217\206\331:\256\373\231\027\312\241\t5\3159\303\025a\001\377t\267T\330A\031\277U\230\037\364\023\\\257f\2539\370-\211\0368)\033\355[\221\201\343\343\274\353\215M\246\022u\202\347\261\303\277\217A\021\b!)\333\354K\231\270!\023\261e\320=\357\npE5\033\317\025|0\347\264\326l\034\356\323m\353\330^\261\325$Z\340G\317\221\327\307\036y\356GE5\370\335-?u\274\372[\365\256ZU\375\024*\207#\301\320\2349\275 \363(\316(\361\335\355\353|^\213\273\200}g\243S\215\316iH\310\303\2169'\312\243\035\234\036\r|\027\261}\265\017t\026\260\347hJ\002\314\331\016'\306\234\272\024\237\234\036\255\373"
+	.ascii	"\371x\n\030pE6\037\300\265['\002\320\023\323\336\027\367\246"
+	.ascii	"M\033V0}\353\003a\207i\227c\246@\034\327\256\360\0272\b~\346"
+	.ascii	"\234\r\374\241\013\257\003J#\036}\032\371\030\215j<\276q\t \355"
+	.ascii	"\242\366\333\333\244\320\333\206\324\335\275\r\n\271\272\037"
+	.ascii	"\f\332\220\230\366\234r\271\337\363\336\242\002W\203\006$\323"
+	.ascii	"\336\"iH\n\261{\263u\262\253\277\"\254`X-\226\230\027\026K%\201"
+	.ascii	"\345\005F\365\212Y\251Zf\\%vQ\231q\2053\256\220\265RM\b]\\\257"
+	.ascii	"P\205\304-\n/\256\320B\253\345\nEt\261\257O\320ODAG\261\225\201"
+	.ascii	"{3\270\024Gv\227\024\345rol$\345\206;I\273\245\231\002\321o\316"
+	.ascii	"9\345\336\254\237\311e\244*\321\310m\274\214\004\367\306^p\271"
+	.ascii	"#\033\" @\002\204\030\026\017a`\357\035\232\033'\313\312\342"
+	.ascii	"\276Q\0205\312\244\301\206\360\013\350kLz\f-\370\252\235\265"
+	.ascii	"\335\377Va\343\231ZRh\016\250%\344Vw,l\320\315n\fPen;\233\260"
+	.ascii	"f?\035\3552XDv@\364\220\365}#\353v.C\006"
+	.text
+	.section	.gnu.lto_resetAllRxChannelRangeConfigurations.92.6817abb10635b1b8,"e",@progbits
+	.string	"(\265/\375`r\001U\017"
+	.string	"\306\334gG\340\262(\035\220\2418\bL\347Pd"
+	.string	"\325|\217\321\326\306\237[)\341;(\272\201\345F\037\r\025\220\271Q,\326\323T#\021\271\026\260\241\300\022\34681\236\353\310-T\370Z\340\360\020\226qb\272\222X\262\267\334)\005Q"
+	.string	"P"
+	.string	"U"
+	.string	"\333\247M\266\316\301\023{\030\212\017\260\036\273\353\251\t\313K\360\226\321\364)5\232|\232\213\274\304R\253\323\247\f@\223!!`\345A6`\331\320\376zT\255PQ\302\264\\\377\372'\305\215\324\252\345\321\023aw\035S+\021\367v\333\237m\b\366g\002w\375\362\341\035\357\272\017\340#p\204.>3vA\324~,\316\244\261\342\341\355\203\376\013\306c\230\036z\306\235Bp1\330\213\216\335\035\371\364\003\3563\201<\210\355G\3733\177a\272+\345"
+	.string	"\201]\tU\262]\220\201E\270O\2037\260}r\017\t\321\307\345\356\256\364\202G\355\364c\203\245\304\301_9\375\360`a\201\2125\017\220ixM\027s\323\303\236\234\243l\366\206\307P\270\335u\340\313\350\300\001A\216\212O?e\373\374\353\nbnZ\354\250\304\232*\313\206\006\243\352b\203\247\250-\232\fKfm\331\035\027\242\237\210&\214H%\241\223\021HB\205\320h\004\242PR\372\n\330\204\244\364y\245\317\033\211@\026<\223\017\203G\022b\322\205\320\347e \221>\017\004\334k\213\346\\\315\016\034\025EMu\261\247\206vZ\232\271\342\310\243\252\376z\2673\323QN-\243\324\253\312\263-\352]a\216\225\035"
+	.ascii	"2\003\376\031\343\206\306\341\364\367s\267\346C\024\203\t_f,"
+	.ascii	"p\r\245\2100\225\307\215\265\027\346\242.\350\2762\tLT\246=\235"
+	.ascii	"\331U\006\250\312\034\264\263JX\263:\035\264\213\303\"\312^\250"
+	.ascii	"j\274\237D:\327|\002"
+	.text
+	.section	.gnu.lto_nullReadRawRC.93.6817abb10635b1b8,"e",@progbits
+	.string	"(\265/\375`'"
+	.string	"\365\007"
+	.string	"\342\01677@o\323\001\230.,u\332\2550u\243\201j\202\372\005\314\277\016cXj1\366\032\311,\310-\022\372z\242\252\006\231\253Ow\344\305\265a\220\333l\030\313\254\233\020\231R\021\033\307e\020\232f\3632\357a\003}<\216\302\341\223\001\326<\237\214\237\214\334'\003EMNDO\307\235\304&\243\327u2bs\037^\004\027\224\310\236!\245N\366\253\245L\266b$\227\003\226\335\214\031\231m\261V>l\2036f\273R[a\001\374I\3059+z\331HP\265_r\023\360\323\342\002\273&\030\225\335\211\340\202\315-\317\215m_\344#\240C\235\035$\200S\bFJ\314\356\214\234\017\\\267\364\235\353\026\305\361\360\032\372Gy\005\34213*\205\256\232\206\335\265\216J\0327u\333\006\266\031l\223\004\f"
+	.ascii	"2\003\202\341\243\302^\025\220kx\227E\3531\241\301\\\201\n\007"
+	.ascii	"w\215T+&a\222\001"
+	.text
+	.section	.gnu.lto_nullFrameStatus.94.6817abb10635b1b8,"e",@progbits
+	.string	"(\265/\375 \366\335\006"
+	.string	"\222\31516@o\222\016\230\265@x\266\022\\\321\0312M\200\370\r\352\nf\232 \220\331\315\201\271\033Jt<\267\233\346Z\213\316\240\345\021o\021\347\033\227\211\223\215\335l#2\005\230\326\321\0360\320G\013I8\210\240\300\036\216\b>\021|\241O\007\364<0\342q6g\020\030|Z\226\301w\305\354f\025PP\025\037I\216\342\370f23\2476\336]\032,\b*\231\246\030\230\\\251R@\376\376\243\277~\347\276\"\035\031\225d\242\003\231\033-(\2311a\003M\253c\t\254V\232n\254V\377\013\f\243\267F\017S\200\305\311\205\311Kf|TG\267\272\355\266\244\231\220\017\227\322\211T\007\320\220\231\273\322\t\243S\375\017~\205?#\006"
+	.ascii	"2\003\202\341\243\302^\025\360v\031c\272&\031"
+	.text
+	.section	.gnu.lto_nullProcessFrame.95.6817abb10635b1b8,"e",@progbits
+	.string	"(\265/\375 \370\365\006"
+	.string	"\362\31526@o\222\016\230\276D\030\006n\034.D\030\262\025`~\201\265\303\233\033\005\221\335\034\230\273\241\302F\323\377\272\216\260\342\311O\023\t\370V\t\334t\201\355\257iBd\n \314\2039\200D!l$\321P\202\002\177:%\370J\360\215B\036\321\373\300\210\327\331L\202"
+	.string	"\301\207\221H\360\035\263Nu\263\253\200\302U|<5\267\361\005\310\314\334\251\276=\254^\\8(\231\250\030\230\\Y'\036\177\177\323\007\374\255}A\032b\252\310D\0072U,&\231\221\263\201\246\326\261\004W-M7W\255\177\205\005\323Yc\007*c\221rA\362\222\031\237\343h\326\226\335\216\364\340\243Ee\245$uj\3130d\346\r#\225\321]\177\204?\341\327\b\005"
+	.ascii	"T\b\203\347\220\254\202\343.s^\327$\003"
+	.text
+	.section	.gnu.lto_rxInit.97.6817abb10635b1b8,"e",@progbits
+	.string	"(\265/\375`\354\017\315I"
+	.string	"\032{H\033?@\242N\007\363\246Q\227\335Lw\377\267)\331u\224\\\334\335L\375\353\347\342\265\362\214\303\356\353\230/s\2301\342D]9\026\202pv\301\t(\265\211\211\253\235V\034EE\2037\331{\313\224R\243\001\205\001\250\001\203\324\330H\265P\034\310\246y\363>\3673\356{\356c\334\251~\376\327\3103R\334\320\304q\214\300U\300"
+	.string	"\366\276\035\315/jl\004\2316\007Q\272\030\307T,7\257\235\257\214\353\301\276\327\303\215\321\270e{z\210qL\035\340:\273|\037\236\327\t\360\352,v;^7\362\256\221\316.c\247\025\351\226vi\273]#\333\247^\007;\265\3314\235\324\370\f\002\337\033i\226\263\035\300u\266\351K\255\263\253+\265\3166\020\227vV\333\342\2324\216c$\213\204\273\3738\265J\354e\f\221\345-\306q\274\225\333\230LfT'\371J\365>\312\2607\251\246\244"
+	.string	"DA=951-1\225\222\220\226GJ\243$\262\210\310=\266\354\232\037n\377$\203w\203|g_\336\324s*\275\272\237:JX\341\336\350I\031\243@\247.\265&\341\314\350\326\005b\213M\272J\320l\372"
+	.ascii	"\326,\266\330\304\005\315\244+\204F\262<~\347\366QT\240s\016"
+	.ascii	"%\306\237\234\344\274)\216\357\355\231\304h\371%1xY\236y\224"
+	.ascii	"p\347WR.Q\240s\256\224\204\305\221\256\254\3159+\277\\\263\226"
+	.ascii	"@C\\\320\254\312\n\001pH\242\333y\025\234\331\332\037Q\201\262"
+	.ascii	"\271\362(\301\316\261\370\336H\031\243@\331\334\250*\211\024"
+	.ascii	"4k\2626\341\314\324\276\210(\r\316\f\355\335\243\013\2321!\373"
+	.ascii	"\226\035C\236\211\375\352Q\240N<\257KF\264<\225g\316\025\013"
+	.ascii	"\021P\220\317\371\227\235\205\375\037%\304q\334\377<\203zWy\367"
+	.ascii	"\237\350n\024\335J\253\317n\230\316\r\301u\205\334l\317\317S"
+	.ascii	"\3111wO\360F\nK\214\353\341\023P\233\217\331\311\016u\005\037"
+	.ascii	"\304\345\306\261\263A\273\242\013\272\200A\203\206\326\3316\033"
+	.ascii	"!9#7\005\373\252Q\003\372\343\227d\373\034\366%\325\271A\262"
+	.ascii	"\3138\216\331\314\204\262\r\250j)Z\t\007\313\264\231\"jDk\034"
+	.ascii	"\257\231\tUkD\"zn\026\274C\306\361\370\021:f7g&t\311\253\221"
+	.ascii	"s\327\376\0349y,\2279u\330\034M\343\237_\377\314\204\036\tt\346"
+	.ascii	"/W,\016\312\232\243\356\241\355\346\340m<4\021\306q\334\240}"
+	.ascii	"\215\263\001\321\356\346l\213\030\301\266\217h\235%\362\202\027"
+	.ascii	"\227\b\366\325\345\025!u9G;G\353Y\305\235\241\363\033[\351\233"
+	.ascii	"\032\273\211\266\033E\212\367\247g\026UDFDg\376\352\246\206}"
+	.ascii	"\216v\273\323\233]`\347)\335$D\200\370\220\374\356\340}\336\034"
+	.ascii	"\374\214\367\206\243o\256\243o\013G\337\007|\317;\313\307xc9"
+	.ascii	"\325\373\252\3756\220\374\266J~\027h\277\t(\277\007(\277\005"
+	.ascii	"(\277\003$\277\253\332\357f\373Me\364=E\364-\225\374\006\220"
+	.ascii	"\374\216j\277\241\334\357'\367\333)\371\335\224\374fr\277\227"
+	.ascii	"\334of\362[)\371\235\324~#\265\337K\344\367\221\373\255t\277"
+	.ascii	"\215\330\357d\3217\262\350\273\210\350\233\310\375v\217\337\307"
+	.ascii	"\366\273e\277Y\366{e\2773\373\375\354\267\227\320\222\2565i;"
+	.ascii	"\224\003\336\243e\346\245\354cpJ\231\231\263\"\331!-O\312J\371"
+	.ascii	"\311\3202'\345\226I\237\033\262CM\\\3552;\237\177\025*m\214\211"
+	.ascii	"F\364\230r\024)/s\236\336\315q~\243\237\017\003\346Ud\325\276"
+	.ascii	"xA\312\357W\370\347\341\372\r\364\\^\305,e\267\274-\263\327\261"
+	.ascii	"\342\201\b\331\316\226r\264_\306\366({\335\025v\277\203\336\355"
+	.ascii	"e\314\020]\\\223:\231n\370\312cy\t\021\275\031\331B(u\266\337"
+	.ascii	"\312_y\r\275U\370+\254u\366(;\236_\341\331\031D3\215\302\314"
+	.ascii	"\321\376$\013\2315D\342\312\007rY\367\201\334\335Z\337\326eD"
+	.ascii	"\205\t\330WW%e\266 \366S\244(\263\273I2\312\\\371\025\241<1\312"
+	.ascii	"\236W8M.\tDDJf\027\323\214\223\331\347\334\233\244\371\263\314"
+	.ascii	"\321>\032*I\344lh\224\345W\271\254\331\264W\331\247\376w\305"
+	.ascii	"\355\356\350\200_e\022\371\007\237\035\244\032\3146U\005\355"
+	.ascii	"\323`2!pYY\336\023\320\2739L\244-\312\310\314\322\031[\013\373"
+	.ascii	"j;\370n\370\f>\362\376,\312\004\240r\002\303\362W\023e\267O\322"
+	.ascii	"u\344\240\377\310#\201\223\300K`44:n&\202\325\376\fv\362fnv;"
+	.ascii	"\267Jl#7\315`\032\r\361([\"O\034fk\373\207<\021\230\r\n,EJ\353"
+	.ascii	"\354\021o\315\242\357h\373\203\274\220\035\355n\rG\3416\270\255"
+	.ascii	"u\226\365\262&.\321\n\214\305\2120\313\213\301o\316\264\275*"
+	.ascii	"\027\270\213\325\227\377\202\303|\314do\320S\t,\007\317\021\250"
+	.ascii	"\022\307`\036\rC\213\207\327\326\013\0330\264n\264`QcF\212\025"
+	.ascii	"^[+\\<u\245x\025)\276E\016\031]:\330\030\336+\264xxm\361\360"
+	.ascii	"\332\242\021\243k\306\326\n\257\033[ZJ]\303F\013\257-\0345jx"
+	.ascii	"m"
+	.string	"!\251`\236\247\364\b\266@\260\034\326\0062\237\035yp[\207l I\017\331\241\r\331*w\310>\226\310![\345\007\212e\276p\307\027\"\344\220\177O\341\024\254\316\013\344\r\031J\317\330\032\201\\`\357\367\350!\220\375\317W\271\274A\271i\211\037\220]\372x^@\367\357\274\340\353\367\367\002\002\266j^6!\276\377\274oO\227'\021\252\325\306\356\027\316+\347\3759 7\003\344\376\363'\355:\343\030L\200\200\354cq\252r\200\214`\f\261\231\253\262\323y9q\2329At\217\\\363\265\323\366\267y7\257\235\367\316\213\347\305\223\227'.\221*\316\251\262\n=\277\206\313UC\225\263\262\024Z\243\233N%\323\250h\234\325\305\304\f\357\322?3\"B\333\342\232\037\335\233\321\340T\200e\356\322\244|\375\026\276|\336\237\335\202-\220\021Q,\177\365 .~\244Z\264S\231\211\303\223\361\340\346MYy9\004"
+	.string	"%\"gC\245,\307bb\255q\034\307QXYD\366;_\013\231\031|)P9\332\216F\306\351Cv:4-M r\226\224\205\037\323\265d\347O@YY*;\261!;\264Fe"
+	.ascii	"\371x\b\225\243\262\277\207?\3452AEJ'"
+	.string	"\205\312H/\203\214Ob\374)\177x9w\312OM\331\351\2003\345\246\374t\210\224\231\006\235\216N\357\321.e\020\371\r\215\255=\005\201A\250a<\343\224D3##\"I\n\2224\006\241\005\304\020\007\331\231\007\021@\245c\020\031I\223\016_\303\277\200}\241\305e\242\315;\275\2036$7F\324\303Q\215\352a%\t\326Q\247\017\311j\037y\007\235\3052\204F\036\036M\363\031\212z\353\0055\036\212W\002\367P\002\353.\367}\313\216\266(\310\234%\351\022\233\310\354\234&\202\361\333\005\260\177@\237\326-\303\240\022\263\352\205\271\b+\350N\234*\333\272x\205\344\307\202$\334+\030\027\0324'\027\350\331\377\307?=vTddN\245\341\231\304W\022\004qC\304\221\257\n\242p\372\3301-V\216L\006\334,\334V6A0\304\264\f~n\tnb\345\337\252G\300\220\375vs\\\344a \235\033\253\205"
+	.ascii	"\234\334\274*\315r\206\300\202\032\214\370\351b>\304\361\207"
+	.ascii	"(g\211\326\337q\241\331"
+	.string	"MI\215\230\3745\320\311\220\252H\305T\203#\016\243Q]\223\026o?UU\341\262\311\370\351| \333\312}\303\225R\301\204\240\346\027\210\244\364m\017\020\304+\255\335}\326\206\206,\021\341C\241z^2\"\357eb\271W\321HA\352\b[\353\274\344\0356\361r\371\016\342\264R\312\353 *\016\332` \321\3162)\242\300\026\213}\264\004\f\316\0023\371D\357\231\273x\242\003\362\305>\242\353\3629f\325\266\374s-4\f.\255\034\276Q|m\\\034\313SUz\205\007\302\242\250\361\214\364L%\365\031v3\002\237[\215\261B{~\364;sH\355Qq\215\013\253y\003_I\340\217[q7g\370j\302r\230\034\"\340%\224q\b)_6\206\371j6\361B.H\366d\013A\203\021f\241J\n\0035b\207E\334\353\315\217e\340yFH\201\233\324\373\003O\363\277\316m\210+\221\265\265"
+	.string	"U\361\361\367\266\315\033Dc\341\324\205UE\035\350\356\002\357/\017Z\311a\004?\224\322\031\211\256\270\345J"
+	.ascii	"\334D\266s\351\313|\2150\376j\003\270K%\215q\t+\3760\362\b\270"
+	.ascii	"\275\232R'\343\204OY\334\344\202\261\302\245\342\246@\b\025\204"
+	.ascii	"\034\007\2425\307Q\245\240R\3730r\006(\365\306\241|X\321\202"
+	.ascii	"\006\305\211!\270rP\374\311\260X\0238B#\210\255\006"
+	.text
+	.section	.gnu.lto_rxIsReceivingSignal.98.6817abb10635b1b8,"e",@progbits
+	.string	"(\265/\375 \336-\006"
+	.string	"\202\313*2Pm\222\016$\243\252\302K\264\267T\325\272-\271\322\363\346*{Kv\325\376\335\316\356\b@\205\032\217\233\231ic\250\200\025\222\2008x\352\260\255\355-Sg0\232\3064\215=4,8\260L\213`\030\201)\b\206\306$(\252\261\313\225\305\320!\201\007)\276 \r\251n\307\023\233\253\325\351n,\235\016\0030<7\372\253s\230\361\225\022C\377}8 JQ \311\374\214V\022e\032\361\3709\177\371"
+	.string	"\201s\325k\343S\216\222\n\021\225\314\213\241F\253^u\373QIdrb\201:=\200\204\314\374,\320E\307\376\006\177\301o\021\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_rxAreFlightChannelsValid.99.6817abb10635b1b8,"e",@progbits
+	.string	"(\265/\375 \336%\006"
+	.string	"\202\213*2Pm\222\016$\243\252\322\262\263\351\205\005\030"
+	.string	" \226\361\346*{Kv\325\376\335\316\356\b@\205\032\217\233\231ic\250\200\025\222\2008xj\214\326\366\226)_,\230\3060\215A80<\260K\223`\226\201\247\210\206\306&\246\251\261\212\225\305\317a\001\007+\276\"\035\241\256\307\024\231kU\351f"
+	.string	"*\035\ndp\356zks\250\361\215\022?\377}H"
+	.string	":Y\2702;WJ\232H\240\217_\363\225\021\0224S\2658:\355\bY\220\240dZ\f7J\365\250\333\220F \241\222\312\263\351\005(d\346Wy0:\366?\370\r\376\213\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_suspendRxPwmPpmSignal.100.6817abb10635b1b8,"e",@progbits
+	.string	"(\265/\375 \270\355\004"
+	.string	"\322\b!*pm\032\003\240\335!_\022\035J\364Uw!\251\341\352\300~lN6\236\230\2111\305"
+	.string	""
+	.string	"\001\007N\342s\024\026"
+	.string	"d\367\226)[\0256%6%\304\261xHkJdE\370\2120\246\234\\\327\224\224\267\032;\003%V\336\323`\314\274\0026v\017\013\237H1\332\275\234L\033\n\2008\277Rg_Ro\263\372!Y<\337\356\312\250\321La\266jG\007\033\247)\024$vw\270q\030=\352\217\370\017\177#\b"
+	.ascii	"3\003\316\231\021\340\313]\303\311B\030/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_resumeRxPwmPpmSignal.101.6817abb10635b1b8,"e",@progbits
+	.string	"(\265/\375 \270\355\004"
+	.string	"\322\b!*\200M\032\003\300$B"
+	.string	"\253\030P[\213^\nE\321\240xD\304\340\330\206C\033D>f\b\261\260\267\233\361(<mqo\231\002[\0256%6%\304\261xHkJdE\370\2120\246\234\\\327\224\224\267\032;\003%V\336\323`\324\274\0026v\017\013\231\221\342\333\275|\246\025\005B\235_\251\263'\251\307Y\005\235,\237\322\356\312\270\321La\266\252G\007\033\247)\024$vw\270q\030=\352\217\370\017\177#\b"
+	.ascii	"3\003\316\231\021\340\313]\303\311B\030/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_setLinkQuality.102.6817abb10635b1b8,"e",@progbits
+	.string	"(\265/\375`\355\002\235\025"
+	.string	"V\347\211I\300\322Q:R\020\331\007,M\004S\212\220\307\270\353\367\035w{\200\024_\346\311\333<\021%\343}\354N\371P\365\222)\231\252\020\207J\245\276F\262\300\243(\024\007\027\\\310_R\210M\202Q\375\320xf\033!d\023)S\nu"
+	.string	"f"
+	.string	"x"
+	.ascii	")?\t/\301\233\204\227V\265\r\034\270\235\310\006\345R=\242\245"
+	.ascii	"9{+\0260^\372f?\275\027b\212#\212xXT\3159_\013\342\267\213\241"
+	.ascii	"\004Wo\376\215\316\312\351n.rx\b\252@\315\240\362\031\312\341"
+	.ascii	"Tn88\242\323\001S\346\234.\335\216.\250\002\304\244aD\307\003"
+	.ascii	"\236\344\b\342q\243k\217.GU\\0\347\264\346t\031\356\361\266/"
+	.ascii	"\330V`\357\200\236\271\350s\227\276Kx\371\225G=\202\374\340\350"
+	.ascii	"\225\335\273\321\335\331\007\347\n\331'\372K\336\373IXj\021U"
+	.ascii	"\273T\335R5kT\217\243Z\034\325\341\250\226\243\032T\365\252Z"
+	.ascii	"E\365Q~\003\252\352\207\313\325\234>W"
+	.string	"B\346O&\221\bU*\250k\337e{\325~\321U\334\336\263\2315\247\207*\2449\347\212W\306\313V\320\247\205\337\331hZ\361\352\264Pd{B\f\035n\013w\003\234\b\3625\351\250\225\305U\372ia\270b\022M\270\362\203\017\336\217\\$\221\005W\302x\f\232\205XlY\240\334\235\272\306\216O\t\3606a\311\0260\001\304\267c\367\305sQ$\253\273{\034P\316[\334\205MF&\013/uE\334\023\357C9\240\337\356\316\362-\341W\202\317IG\255\354\373\276\242\305\027\0212\017d\264\231\003\330\314\213\214\301\f\214\254V\243\211\001\220\321`\265\006\023f/\260\n-\307Xjj\257\232\332\013f\006\243\275b5\231\027\213\211c(\310j\257\231\230\230\332\313\325\233_!C\300\361\303\331\034\321\245\303\026\365\273\225\302\326\272~\255\025\217\250x?M\222j\252Jj\351L\222\306\024\n\251\022\225'\020\262\326\216"
+	.ascii	"\323\347\234\262\2637\036\227\265\347\031\"\256\334q\023<\311"
+	.ascii	"\300\245@\300\3239\205\273\013= \240\002\021\251;\017\323\003"
+	.ascii	"\336\016i\267P8\262\207\177c#\004\224\f\240\215#\n\004\b\256"
+	.ascii	"\235\270\001\022\264\256\361\254;5\2662\266\3711h\031\334f\024"
+	.ascii	"[?1\274\247\331YQ\314\300\016\316\362\2411c\334\020\rm\031\235"
+	.ascii	"\331\270\266Y\222E\233%\343\302\032V\344\024a\035u+@\201T\002"
+	.ascii	"\025\030\235\026m\017y\213\212\325,|\207\206\241|x\026\332\303"
+	.ascii	"Z\216\3021\24411|\357t;%\345\267!<\356\252\321\273\f\024"
+	.text
+	.section	.gnu.lto_setLinkQualityDirect.103.6817abb10635b1b8,"e",@progbits
+	.string	"(\265/\375 \362\265\006"
+	.string	"\342\314/5@o\222\016x\255\345\350/\020\007\353l\b\215\213\273\020>\202\204\031f\260?\002\260\337B\215\276\242\212\375\3077\313\304T\315\241V\302\353\020H\230\231\231\fBd\n\236P51H\200\250j\nA4|\250Js\207#\212P\024\341\207\232\034`'F@\316f\353\301\023!\310\262\"\314dYW\332\200\302U|6jn\343\013\220\231\271+}+\300P\261P2/^\\2\345\235x\374\315\374\255}?\nr5d\342\227\251Ab\222\231%| \320\247)\001\246\257u\203\351\373\372\225f\035\331\222\026\213\021\226\314\204\216\243W\333u+\322\001\0226j\013X\310\314\033\t\313\350\256?\302\257\360c\001\007"
+	.ascii	"2\003\3169\003\027\016]\306#VS\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_rxUpdateCheck.104.6817abb10635b1b8,"e",@progbits
+	.string	"(\265/\375`\023\007\305'"
+	.string	"\332D\030\017Ep\\N:5%\201`\021q\207\357vE\3343\243(\367\214\275\360M\324n\r\002\257z\r\202\3428\007p]\313Q\306v\213\214A\213X6r@\247k{\007OC\340%\303\324\007\255\177\260[\223F\244\311\235R\341"
+	.string	"\311"
+	.string	"\335"
+	.string	"\325n\341+\375\363\243\024\225\270\222i\r\006w\312\2409\3354\024\272\311\025q\266\244i\252\300\013\320\233\256\325>\332\323Z\\\215\205{i\032\004mK\232&\025x\t\275\251\364"
+	.ascii	"\347\315\335\201\347M\333f\320\240\205\213O\232\325\370\231\021"
+	.ascii	"L\312\2354M\006w\310\213\007\016\t\001\b\002\372\361\371\371"
+	.ascii	"z(\3574w[\213>/\002\007!1\264\030\307\270\016|\227\221\017\031"
+	.ascii	"\021\"R\244\0020{\320\356\3508\346\306\343\304\314vLpB\334\370"
+	.ascii	"\250@\307\377\034{T\037\037\377\361P\356\250\276\002Al\350xO"
+	.ascii	"G\201$b9*\312\213\020\304\006\331y8~\002\215\201\301\250&X\333"
+	.ascii	"+\215\261\027uGf\3455l\354\253\356o\314k\247\224\246\351\343"
+	.ascii	"\304x\324\312\213\220\246\251\253q\314\306Mt\373\"l\253\260\317"
+	.ascii	"\247f\251X\372#Ep;r\356\310\341\252zj\232\246\\\273H\3277\235"
+	.ascii	"E{\345=(\335\276*\036\007-\227K=o:\277E\353\n\343\350\345\251"
+	.ascii	"g\241B\3234u\340_9\026\241\177\344\246K\f\353\215\303\363\346"
+	.ascii	"\367\001\032\3321M\255\253.\355\244W]\244\375]\272evS\257\372"
+	.ascii	"@\257\232\311\325\006\320\352\245'\177\002W\373\223|\325H\276"
+	.ascii	"\352\243W\271\215\320\352\"_5\221\257\032\330\253\366y\224\373"
+	.ascii	"\347j\237\253{h5\212V\237h\265\211V\357\\\275\274\352zV\037\301"
+	.ascii	"\331\314\216<\316\302VM2\255\261\254K\313\230\\\316^\345\217"
+	.ascii	"\362j\267\371l\276\225*Z)\352\302l\270\224O\261\177Vq6o\255\315"
+	.ascii	"\035\321n\376n\006i\276\246hA\312m\355\307\021m\256\253.{;^S"
+	.ascii	"\205\263\031`Z\366o\377m\030\322R\271CB\027\351\272\373\333\353"
+	.ascii	"\371\027\317\236\321\374\333\2336\254\356\234^\317\004\257D\350"
+	.ascii	"\366\230N?\260a6R%\260\007\326\276\200\241\336h\242\267'e^,\027"
+	.ascii	"\317\3343\0322D\231R\214t\222v\267\346\376p\217\323\300!*j\203"
+	.ascii	"\300\334\320"
+	.string	"\221u\325\345\271\310\243\205Z\363U\361\334\3114M\315\342I\324E\016N\316\fz\264\353\217\271[\321?\342\017RRh\214t.\346D\273\373\266W@R\027\007\314K%\372n\221\376\200\023\270fjJ\224l~\255\323h\201\353\nF\346U\227\036\252o;\230\341\257\230\245i\327\215_\352\032\355\225\374\370Z.\333 \356%D\227\272\267r\005v\320\320\031\016\0326\361$\254\032f\005\255\256\252\252\256\250\004`ieMeq\020VM\021I\374F\bS\f\205T\302\r'\246\254J\f\261\200\246\262N\b'\faE\t\253\206\035\262\254\204D\242\026\325\217\251\236\266\210\301-b\320j8U\025\244\"b\005\237\200\276B!$\006\263\256\256\210\301_\262\353\273t\313\\\205\234^\207\022\334g\303l\033X\245\256\365\262\317\032\330\237\300E\372\337\241-\363-\024\235o{U\250\267\225\211\222\215\235](le\30742"
+	.ascii	"u\212kR\275!K's5\216\n\030\031A\213\364"
+	.string	"\212\223\251\250\315\022\210\234\0312K\313\264Fu\300\366\240\233\264K\373)\337-A#\247\211\232)H\346\234\016\013\tPP\347Mt\267\326\346\200\336\342\350\371I\332s](\335\336\234\013a\355\3141m}\332P\340\r\251s\362[\244\205\224y\340\344\314\370\026\031\200\233\250\2218'\221BC\224$\205)I\032\003\240\002\021!+\333\020PF4$I:L\307\310\272\304G\323\265vl\310\204\227\315\001\360\206\360\226\206\354lK\355\274-6\27236\355\2353*v\r\204\342D\002\247J\317\021\254{<\017\300\217\372\2210(8\325\270`L\342\321d\340\361\266\3340\036\250=\334\331\031\"\372\333uz\251\3063\005\006\2543\bG\\\240\234k\361w<\005\373\013'\241\270b\357Z\341i\363u\f\371l<\340\230\r\357\273\306\032\224\367\027\347\251\311'\035\202w\306\225\263b\":p\336\205AH\331J\311c\344"
+	.ascii	"\314>\300$\261\351\004omL_K\222\324\302\007[\363%\347'\202\304"
+	.ascii	"`\030\325:n\004\360\2512\321\376\235\203\270\362Wn\344Q\023E"
+	.ascii	"\267\376O\226\036Gx\013T\276\267\377e\203\b\2710\006\324\352"
+	.ascii	"\037\314\231>oH\346\307\222\352NZ\273`)\363\t\270*%Y\224@\255"
+	.ascii	"\327AS\037\222\323*\206v(K;\370\273\230\241\362Q\"\216\331\001"
+	.ascii	"V\230\201\031\243.\340:\214\006\204\340f\317\216=\243\006"
+	.text
+	.section	.gnu.lto_getRxfailValue.105.6817abb10635b1b8,"e",@progbits
+	.string	"(\265/\375`\234\003%\030"
+	.string	"f\253\227H\260XQ:\355\266sJ\024`\022\022\2002;\301\332\360\2611\2508\017\203m0#\347\330+\211a\344\257\326\372U=d\213#\343\233\365\024\326\007\345;\374\221\261%\036D}E\240\274\f5\347\213\245o\215\220M\210\334)\005\177"
+	.string	"~"
+	.string	"\206"
+	.string	"M8\f\342>_\252\314\302\243\326\312\272\rd\263l\357\264w\022"
+	.ascii	"\035\211\346\255\225\007eI\255>\0046@^\264\355\377\370\021\220"
+	.ascii	"k8#n\267\003=&\035\221\250Z}\256\232\337\320\213\3636\364\342"
+	.ascii	"\322x\355\344H\305pg\315\267\235\324\321+3\362\350y\241\277\225"
+	.ascii	"\027\237tUTO\312\227\030'\312\207#\202V\207\2437EN5VC\271\235"
+	.ascii	"cO\255\325s7t\342V\335\266\n\333\013\354\365\021\265V_\315a\021"
+	.ascii	"\005M\240m\330"
+	.string	"\211\304T0\224\214xG\265\006)8\020[\304\207\\P\3410aC\312Q\255\225'\310\205d\360m\\\264\006\016\363\273\213\276l\217\242\324\322\003\211\265\337'\335\202\020\241':\340m\006m\037n\356\f\373\033\f\006\303xe\330\236\246\361\364\214\247[G\372Y\236^\321i\025\235&\305\351q\234\246tz\305\351\271\323\257\001\220$4t!%\265\232\bJ\325'1\027\351R(\307\220iR\372\241\226J\264\240\001\246\r!\302\374nw\327\3467\371\231\240v<\211\022\036e\002\351?9\224\n\026^\363\273\027\2758\023J\225]\256\344\356\261\315)\236/PL\241\023\337iO\233\262\344L\336\344\337N\271%\212F\243\027y\254\r'\320g:l\305\223mN\275\310\251\310\311\"\361\223L2F\225\250\210o\304?\362\005\350\305\237\250\366\222\030\325Zs\276d\3737@LY\253\355\274\337\334\005\306\260!\366\363\363\302"
+	.string	"\033\r\323\t1s\205\230\271~2\2748\270`3\017.\035\033\313:\304f\256\0172\331\314\305\362\335\036\326\225a\0019\027@J\223B\351\305\215\261\265\016\305\375\213\034\213\033\341\314\256\226\204\355\325\272\347\266\270\260\326ZI\361\367\032Umk\237\343\021x\215\222\253\332\347r\340f\320\343\222;\27308\226Xkh\211\313\225\247q\337TN\365@:r\034(0#]\232\275\016h+\rH\237\312\2538x\340\343C\003E\250Q4\302\230T\210&(\021\005\205R\311\030\200\002\021\"\263\033\0210\275\203\214F\013,\215\001x=Yc\241\007\235\266\247\302\307\275\200Q\n\264\246%*\370.F0\266\013e'\205(A\265'\177\307p\200\030\330\032\337\037\3722N\2705=\2770\347\254\300X\201\346\204\003\343)b\r\320)g\350F"
+	.ascii	"Y\377$\305t\013\327\002g\241\200\207\371\320\b\245\213\217fP"
+	.ascii	"\013\324\232\033\333\221\226\234\036 \3603\371\250\336\310dN"
+	.ascii	"\306\253\251\335\n\004\373\tj\376\341\300\203\n_\222\220\r\202"
+	.ascii	">\236\033:\034S\001"
+	.text
+	.section	.gnu.lto_applyRxChannelRangeConfiguraton.106.6817abb10635b1b8,"e",@progbits
+	.string	"(\265/\375`\302\001\355\020"
+	.string	"\026!sF\360\356&\035C\006\312\265~\355c)\254}\032\216=.GL8\tO\257\347w\313\362#\330\027l\017\264\333hZ\367\031'o\322 A\231\303\342p\357\024\217\222B0\005V\215\3073\033zh\235\tk\311\336R\246\024_"
+	.string	"V"
+	.string	"`"
+	.string	"\377\360\372g#g\354fHA\264\273 .`z\364\200\266}\235{x\031\226`B,f"
+	.string	"'\351\305\347\305\356\347q<"
+	.ascii	"\367\230\357\340\036\325\346\260CM\230\337rX\222\325l0\264\231"
+	.ascii	"+$@s\001\tE\223A\217\021G/\367y\306\320f\231\245\220\335u\302"
+	.ascii	"\320*\334\361\266\035\330~`\347\201p\225\306(\24752}\372ww\357"
+	.ascii	"\3713\376\375%\247c\246aL"
+	.string	"k\2463\246\277q*qC\273\314mW\346\026c\217b\021\007\333\367m\007R\371\217\033\324l9\273\333\251\330\335_vg[A\234\347\365\036\026\001\034;\343\321!\332\375@\254\300\364\350\317\224i\177'B.~V\310\362\346Sn\020\225N\334F\\*\324\222\332%\021\3620\235\302\265\240-V\205\253\207PE\240a\347\232z\026/If]H\202iw\306\300\0172q\231v\3677\217>\013\367x\275\210\332\017\322N,o\207\201\341\006\244Z\343\005/\351}\376\3212d\303\203b\2260\354O\226Zc?&I\271HRT+\357\204\265Z\261D\006\214@8Q\265\342\210\t\312J\345\342,\222Ziy+-\357\244D\265\362DZ./\325a\026\312H\313Ka\261Z^\367\305\016Wi\214r\351@\3413.8\033\322\207qQclGuHLe\360\244\0320\2476$3aK\212*PzR\247K\013"
+	.string	"A\235\242\364@\377(\"\021\037"
+	.ascii	"&jeb\343\225M\330\243\216\276\333\336\252\365\270\332\362>,\256"
+	.ascii	"\271|\347b=\267\231\262\034\210\007T\251_\202\243\251+Eu\214"
+	.ascii	"[\327\205\321e\315\035\033c1\250%4L7\215\361\200\r\320\204M\241"
+	.ascii	"\203v\001)\001\247\252\221\347RP"
+	.text
+	.section	.gnu.lto_readRxChannelsApplyRanges.107.6817abb10635b1b8,"e",@progbits
+	.string	"(\265/\375`\330\003\355\033"
+	.string	"ft\265H\240ZQ:\035\313a_!\340\274\t\006\340\032Ek\274\375J\t\357\362I\317o\016P\305\350\355\317\357\"\252\356V\177>\034\364"
+	.string	"\205<l\204\001/\216\002\274\270xQ\253`\240\302\324qV\333\322w\264\372\023B\310\2262\311\237"
+	.string	"\227"
+	.string	"\246"
+	.string	"\277uz\315\325\3070\343;\"\326Z\027|\\\004\346G\234\303\310\217\364/\362\343\356\213]\326\307\263\226\266;U\340V\201\036\370\214\204\202fj\255\261\346\261\246\200\323\337w\305\264\327\254\314\222\034i3m\237t\232\303(\352\304\001\275\206\2267\"\244K\315\260As\250\210M\007\332xUN\330\221\333\335<\200#W\364\222* F!s\251\031E\024F\204t\n1\251\373X\203\323\235\266p7\212#<\017\341\202\270\017\274\007\337\221\030\034\271\335\271\234Pk]>q\271/\353\273\273\264\273\026v{)\213\202\207\177~\334\363\220\037[\275j\252q\361Z\276 \031\322\346m\371u\"\313\276\360\t\3040)&\201\nb\252fz\272\341\272y\273?\033\347\364\250\210\333:va/\223\367\306U\362\266J^\233\222w\365\340\327\374\357[R^\222\344\035G^Jy\233\362r\363~"
+	.ascii	"\200)0\270\357\270\324JTDS\261\214M?\036\374\177\347\335\357"
+	.ascii	"\215|\370\342L+b\3674\244\326\312B\262\027&\371\022\355A\027"
+	.ascii	"\257g=P\317\327\203X\353O\201\371\321\305/\262\007\376\310\225"
+	.ascii	"h\017\233A\003\377|\271\272\251\225\335\223\215\013\323\207\257"
+	.ascii	"\262\241\243~~H\205\003]\352\325Zs\236>\245\303\007\020 \310"
+	.ascii	"\2177\375\341i\231,id\324P\242\323\375 C\243l\336\362h\323\004"
+	.ascii	"\204\276*\332\352U\0175x\331\rl\"\344\305"
+	.string	"\334g\272\223,B\257\326\332O)\355j\234[\003\355\252\271\033J\250jC\274i\204Yk\205\260\207\362($td\374SF~|\037\310\316\211\310\221\032\027)\331\274\266iN#TU\343\"\217\315\333\237;Q\361`\227Z\203rvw\336\244\204\204^\255A\020\226\234\311\211\275\217\217\001kb'\305\017\217\316\n2\305NO\217\216\tY\2712\007-f\261\026\263X\317\t\035\236\230l\266\"\346\340\265>?;\263\030\013\037\237Y\214\365\253\275u$\3751\266\224\301Rk[M\3636\200\022\023\326\355\205\027\274\354\241%\273\302\225\261\311\376\263\\\212\226\264\367\2614#4%\376IS\"?\216\243n\347\344LQ\215\213\337\237\355\264\326ZW\315[\0020\202L\225\257\276\360?\022\006A\"]m2x\331\260>\360$l\27300n\330\270\270\2647\212B\200=\324\257T\270\200\001\3039\306l\332-\233\321\023\323"
+	.ascii	"\337t\367\006G\2501\034\2061g\fBD&\220\300\206J\222\016P\002"
+	.ascii	"1\212\331y\020`\251\030hg\f7\372\021\360C\213\223I\033@\301\262"
+	.ascii	"\373W\275^\230\027>\2124=\367\267 \355\301.\314Q@\230\207me\306"
+	.ascii	"\275\230\201\337\2228\270\337\022\304\276\006s\037\317<\246V"
+	.ascii	"-\n\200D\245;\370T?\271Z4!\\6\266K\017\247\261\004>\307\0353"
+	.ascii	"i(!b}\333@\030 \252\344\210Pw\020\271R\274M%\256\003\207\253"
+	.ascii	"\247\256\0310\002\253\227b\211\203\021\f\322kzT\236\336\215,"
+	.ascii	"?k\201\322\261wJ\303/\246\034\250"
+	.text
+	.section	.gnu.lto_detectAndApplySignalLossBehaviour.108.6817abb10635b1b8,"e",@progbits
+	.string	"(\265/\375`\024\013\355:"
+	.string	"\nc\004\026AP\346\316\030%\256(\364J.B\251\242\306^4\202\200}\230\317\346\237~\312\207l2\\g\327_l\327\260\362\345g\002\242\351i\"\"\"\rc;\023\bF\234\355\366\376\356:K\233H)eJ)\005Q\0013\001X\001lG\271\245s\234G\340+\372.[\351\022A\270\b\303^\231{0\033{\375\226cc\3035\324\3558\037\375\216\275\r\244\312S\016\360}\243P\275\262\201a\257\004\032\311\366\252\366\221\355\325e\276\263\004\366rI=\241a^\004\337\367M>\024"
+	.string	"|\324j\264\031\371n;\t\b"
+	.string	"\240\211iI)\t\211t<2*\"\032\022\n2\026\211\303\226]\325w\227\273\245R\317\324\360(\227\\\355\024\327\002\342\240\036"
+	.string	"n\272\305\001<\031{\353\246\226j\332\007\324\242pnfco\315\304\236\245\351\301\365\222\332"
+	.string	"\220L\237\276\"\346\246\"\213LQ\366\236X\233+\271Q\361$\265\005+2\245\367\304\246\250\024\376"
+	.ascii	"\342\2654\211#\237\214Ii\244\243Z\037u\327Z\033\251E\361\242"
+	.ascii	"\342Y3\312\326D-\225\331\330Z\017\251O{bij\223]\023\027\272\""
+	.ascii	"\326\364 1K\334\270'\306D%`\247\304\213-\225\264\327\263%\202"
+	.ascii	"p\203fcR\232X\300l\214\331\303\336\023c\026\270\"V\346-Y\263"
+	.ascii	"j\203&\233#C\3130\025\t\347\254\316\017_\221\264j\\~\201\371"
+	.ascii	"\017-\277T\002\357\373\266\\{\220\245\227{K\365\276/\273r9\326"
+	.ascii	"<\240\231\335\0043\253`&\256\b\277\276\023\337\2227a\201\216"
+	.ascii	"F\300\004\331w\262\253P-E\347\326|\007\315\364A\026\264\nV}\030"
+	.ascii	"R\2774\255F\305\n\026,>\0053\316 \273\276SU\037\315L\373\231"
+	.ascii	"\026\376Sj\035\340\b\264\355\337\311[l\377?\221\376}\371\037"
+	.ascii	"\346\306\3532[\334l\354\242\312[Y\305\366\332O\344\272CkB\313"
+	.ascii	"\272\274\220\205\2349\306\fo\345\323'\370\241\005p\020\320\353"
+	.ascii	"\271\230\243^\376N\346\246\220\366\007\220\037\215\231\350\214"
+	.ascii	"a\350|\241\350l\241\302T\321Y*J\002\321Y\001\3219A\3075?\021"
+	.ascii	"\235\231\372\256y\251\353\232\225z\2569\251uF\262\316HD\347#"
+	.ascii	"\353|\324:\033\025\235\213Vg\242\325y\210\350,\304:\007\265\316"
+	.ascii	"\306\241sq\350Ll\235\207\255s\273:\263\255\363\312:\253\253\263"
+	.ascii	"\257\316\235\241\351N\312\327\345\031\367}\321\267H!\341\253"
+	.ascii	"\267\342Q\351\273\356\272\356\271\356\270V\231{\312\306\242T"
+	.ascii	"-\032\246\305\344\350/\334f\230v\332rpsi0\314F\356\321_x]\336"
+	.ascii	"\0216\341\272p\333yi:\267\353v\364\253|\233+\355\231\206\302"
+	.ascii	"\260\327\"\357"
+	.string	"chI\224\300\035\337\t\250\2630\373\264\361\t\234\346a9z\247Q\322\257\\\246T\244m\030\270\202gv\251\270V\274\225S\3071}yz_\317\305I\257\340\331\225z\232N\223(\177E\357\024\342\207\260\371\276Y\367\031\234\237\031\"\342\377q\261 H\033\\\363\224z\234\255],\354\323\023\337I\312\004\317\217\246\227\027\362\220\373d1x\232\020?p\366\360\261\271\360\030\276\r,\376\323_\370\006\323\352s)g\352\207\256\212W\240\213e\270\247\371\270Z\\7\367\315}c{->-\357\bU\"l\216\310\t\275\223-|\324_\221\255I\333@;\017\240\2057v\005\016\306q\236@8hA\357d\251\217\372\317\"}\323b\330\225\353;\032\206\357\3735\305]\247\355l\340\320\241\003\333\253\324\267\230\366)YZ\023\032\327|t\346\354\214P\315\364-\204\364\341\262\207\357o\370Q\357y$\372o\304pN\373y\370"
+	.string	"\002\004\333\353\360\333\256\031p\335\3515\241x_\207\006lY|go\261qD\340`\366\265\361\351\362Bb\373\240\371\366\330o\277\303\002uy\241\036\373\030\374\312\206\357\344^\323\352\377\362\356)\365k\331A\273\03115\347}_\n\334l\272M\tn\266^\371\004\n\024J=\035,\003\202\r\0323nl%\261\262\256\256\262\252\232\254h\324\270ra\203\245a\205\205\345BFUk\003\204\325\325\f\0237\260\254\264\264\266\252\204\270\n\202\016\255\244\016\255$\326\f\027W\311*-\033I\bG\316\252a\245\225\274\221\225\245\2254F\273\372\321x\370\367\246\327\365^N\310/s\262\266\r\004G2bx\004\371M\247\206'"
+	.string	"\311\307\220>M\222;\267"
+	.string	"\357d\t\312&\t\277Fa\202\352\245\245?\036\375Q\354\350\025\374\332\\\235\032"
+	.string	"K/\341_x\251\325\031\205p\">\344\355(\365\024\275\021\003OP\364=\355\243\340\337s\351\023<\373\023\312)\303\232\230Atd"
+	.ascii	"\007\001[N\003\321\221\244\256\215O\322\013\212\3074\301\231"
+	.string	"]&n\023o%\267\335\037S\217\350\2046\227\210\276\003I\377\222\316\266{\3062\273N\027\212\267\222\350\233\314\311\327s)\275s\350_\370\327\320\267\\\037X\232akB\223\336\311D`\220*\374\377\021\241:\351\203$\275\320op\023\364B\337\336\245\302Uc\021\364O~e\352\373\276/\362\235I_\341\005\231}\322>:Gz'\367\234\347_\330\324h\352;\355\231&l:\024\365J\037\204\331\370\376\216@\316)\364\260\006B\351\215\317\203Y(\355\253\013\344\001\200\350\250q$%\235S\204FDD4IRh\f\200\002\021)\262\342\006\021`\251T\020\221(\031\306NM*/\333\257\215d\026B\346mt\365\004\316\"M\254\2142\th\351\216\375\257&\236\311\343u\275p\327@\212k\363\253cr\002\211+\202\024\372;\033\307p\332\f\331\316hP4\327\022\322\024\0054\363\247\212\016\032\002t\320K\312t\305"
+	.string	"g\327Z\371\252\260\271\200\315\336"
+	.string	"p\n>\353\004\263Y\204Y\300\004\357\342\261\031\202g\371\033\031\370\026\215>\t\"N\031\207q\200\"\363/\223/\206\254\244\250\254c\224lJ[\343\2075m\270\033\261\241\365\333\3759ZC\337$\242\203\343\225\t\334\276P\256\007\370\315\334m\360\3319\321\3618\247\340_\351\211\233H\270cC\2564A\232\\ s\244\021`\201\022\371?D\264\004M\303\005\004\250\274\304\037Nw\001\335\355\224\n<3\211\205\215\304\344J)\302\262\013<=M\023h\306k\005\222\020,\313\316o\354K\232|\261$\td\351\016?\303\022\030&\331\377@\213\311[\376\311\306\227\227\255\214\271\341\335\345m\374 \223\362\244B\353\032|\345a\030X:\257\264\211\026\322\203f\004k\033\027\0205-\377\036\244\021\212\377\027\307v\233\260\321\035*\371\264\263\202\372\217\021\306a+\361a\307\221]\3034G\f\325"
+	.ascii	"c\270$\367h\004\230\312\250V\353\371\212\216\362\233\013\332"
+	.ascii	"\275\"A\002\201\376\f@\313\350D\267|\001\334h\206\305\351\f\035"
+	.ascii	"\350\3447\237\254l;K\257\245\007\352\003\364\242\200F\307\330"
+	.ascii	"}\2130\030IB*X\351\301\270n\023G\216A@\347\177\265\365%\210a"
+	.ascii	"\374\362\006\003'*1>\365M\331r\300]\3710\272\270\306v\340?"
+	.text
+	.section	.gnu.lto_calculateRxChannelsAndUpdateFailsafe.109.6817abb10635b1b8,"e",@progbits
+	.string	"(\265/\375`\233\001M\017"
+	.string	"v]fE"
+	.string	"\261&\035\200Q2t\026\030\271>?\371c\036\025\217\351\235\341\b\037\320\223\333\230a_\002Z\356\006\315\032[k\215/<\022\247u\371\321l\001r"
+	.string	""
+	.string	"\006\265\214W\206\265\271\260\020\233\350\330\265$\356\275\245L)S"
+	.string	"M"
+	.string	"P"
+	.string	"\361\360\375#\036\332\366\310\001\224S\3574\270\004\330Xh\311\261\261\333i\232\341\251G\3704S>"
+	.ascii	"N\365\230Q8|\005bx`B\\\204\007\322\203A\306\013'!\037\314U\304"
+	.ascii	"\261^\310\356\036\347\351\302\261dv\220\354\256\263\305M\270"
+	.ascii	";n\233d[\263\237#\334\316L\314M\205U\376\330\235*\225\306\376"
+	.ascii	"\333\335\265\316\330\207\375\"\247ANG\247\241\323\317i\325\364"
+	.ascii	"=L>\270^\270o\320\331u\375\370\354\013\330\242\203m\224\035\262"
+	.ascii	"\235i?\304oP\207A0h\367B\214\025\273\235\001\017\310\016C\016"
+	.ascii	"\0224T\237\036E\313+\224\357n\342\224\355\256\336*\221\252z\017"
+	.ascii	"2,U\3316\271N)\333]\004~\316I\230\374\232C?8\235\342a\352y^;"
+	.ascii	" `\271\273*u*^\031\304`\260\022\207}\021\037\221\362k\234\242"
+	.ascii	"\222o\035\372*\361\360z\234\023\b'\005\244RI\002\224\023\322"
+	.ascii	"\266\245\214\002x$\262\262i+\233vR\262\240\244\215\266\223&\362"
+	.ascii	"a\223\003\322\246\241\230L\233\026\352\366\017\302\314\307\206"
+	.ascii	"\203\216\212\367\330A\352b\033\244&Y)K\364H\221\332#R\276\005"
+	.ascii	"\365\251\212E\215\036\031\2504\261\307\024\r\242\216\274\\\334"
+	.ascii	"xOO\274\031\255  \260\002\241\200\254\007\340\2007lM\302\005"
+	.ascii	"2\210V\340l\31396\217yF0\016/\203\016P\213\024\025\004\t\230"
+	.ascii	"\210\234\217q$\355m1\266tB\220i\004\221B\224A\003\224\327\224"
+	.ascii	"2\3604C\304\347\253\027\315R\320%kl\327*\003"
+	.text
+	.section	.gnu.lto_parseRcChannels.110.6817abb10635b1b8,"e",@progbits
+	.string	"(\265/\375`\303\002\375\025"
+	.string	"\346\250\217J\260\022R:\342$\264ax\304\316\377\300\306\024\023\355\243\312\262\372\361_\332\244-\217+%\336\2536\023:\323\350\253VF\305+\301\277\221}e\335\245w\007\007\357\2169\365K\266Q\3340\273\207\257\207\036T\216\324H\333\233\310\235d{"
+	.string	"t"
+	.string	"~"
+	.ascii	"\rl\260\t\306\323\005\276@=\035/RO\327\266Ku`\257\r\0045\331"
+	.ascii	"\024\375\350\356\027\367,k\332>\262*\025y\332\366C\027w|;v%\315"
+	.ascii	"G\221\225\303\361\375i\303\007\021\305\252j\351D\270\311\002"
+	.ascii	"@\"\347\325\303)Iw\223en\212\242\b\210$(W\251\023K\240J\350\\"
+	.ascii	"\370yS\326L>\321\351\316\317pW\346|\262\"t\367\316]\311\341\333"
+	.ascii	"\372\356\206\330\335\007\273\023GL\271\222\231\267\013\244\231"
+	.ascii	"(=+\252e\236]\327\201\177\310\215\276\344\177\177\353\301o\255"
+	.ascii	"s)\235+\212sY\234;y\356\005\004\020\362)\377\343\243\033gx\325"
+	.ascii	"Nti\304\215\376\340\356\213\366\302%\215\200\202\242\034\214"
+	.ascii	"W\261'Z\362tw\2033\003\372\251_\236\b\262Q\325\rdp\272'\343\351"
+	.ascii	"\311\335\235@\231\251\005\237\273G\361\024\266\377fN\240\233"
+	.ascii	"\007I\251\003Q>2\365\364;\036\223E\256M6An\217!\033a03\220\026"
+	.ascii	"W\236|\340\206\217Ig\0027\207{\021?! \312\274\243\277\220\225"
+	.ascii	"\270\270\322H\324N\325S\2223\004k\324L\253\317\337U\217\034\""
+	.ascii	"\363\3663\225d\036b\352\tJ\325L\253\r\231\347\037=I\246\240\327"
+	.ascii	"\255\373n\217\364\0251\361>\247kAV\277\223\325\331\205\371\035"
+	.ascii	"\311$9\246Y\312\347\013/a\307'\264\tr\233C\026\0060\207\275B"
+	.ascii	"\254\305e\226R\243\2151\030^\\bta&5\332\253F{\271\304Vd/\030"
+	.ascii	"\r\346e\"\262\263\027\026\332+f6\243\275H`\237y\206~\r:h8\335"
+	.ascii	"\030W52o[R\325\305Tj\336\250T\312)\373\0264\225\221\262\310\342"
+	.ascii	"F\3476\207\027\273\273Y'\257\354\342\023}B\360g\250\003\302\315"
+	.ascii	"\341\354PE\336\335\332gP@\320\353n\224\335\2253\301\306\356\206"
+	.ascii	"p\272\227\321\3022\0226 p\002\231\"4\017\341\300\357;\332\006"
+	.ascii	"\202:ze\002\013w\236\312\016\232w\367*K\212\260\003\265I\377"
+	.ascii	"\221)1\321\205\231:\354\360X\252\270\3239h\263\3048\353 p\244"
+	.ascii	"CC\306v\241\301\013\026g\212\035\306\0035\234\330btY\016(\tw"
+	.ascii	"\233>\340\\\346p!3b\362\200B\330\205\3042\r\213\373X\255+37\300"
+	.ascii	"(\335\275q\327S\f&\\\360}\b\227/g/\2333\265\346\t"
+	.text
+	.section	.gnu.lto_setRssiDirect.111.6817abb10635b1b8,"e",@progbits
+	.string	"(\265/\375`\275"
+	.string	"\r\013"
+	.string	"&\325K@ \307*\035G\336\3011\311\004\027\001\260\022\317\363C\372g\341&t\003\211FQ\206\354\202Oi"
+	.string	"\255akXH\023$z\214\347"
+	.string	"\230\bp\303\200\020\034\324\277\221\n\\\262\374\005Y\262\367\336)\0058"
+	.string	":"
+	.string	"6"
+	.string	"\031\356\325\241\235\340\243\3116\240(\340\230-\330\335n\226<<\2352\364\021D\323)\310\247\202\210\242\232\335\275\354\262CLIi\341\354\256\245J\374\270\353mS\330\216\260?\021\322\267$\250\020\020\357\n\260\353q\263\255\201Z\300e\373\030\333s\374J\370\030\311\007\273$\b\036.\257\032*\245\375\224\277\302\303J\256\273#/\332\356\ba\207\313\353\302\031\270W\371k\232\263e:?/d\007R\222\201\375\331\001\220\374\023\203\"y\325\253/\342^?/;\245\255l\265\220\223\274\331\243I\316\226}\272\273\353\311\262\017\373\353c?\245\001\236\316'\362@\356\003\202\025\033\036\220\305\235\315\350\353F_\007\372X`t\235\017\3546\031{\031\236\257\323\360\274\257\303\214{\272\223esN\023E\353\364\005|@\311\013\205\270W\211U\203\232\210\334\r\023"
+	.ascii	"2\241\305(H\202\201l\274\227\252\346`\341\257\356\024\341y\341"
+	.ascii	"\026$\027\206a\030\r\204\017F\301e`j\264\270\313O\265W\224\272"
+	.ascii	"\255-z"
+	.text
+	.section	.gnu.lto_setRssi.113.6817abb10635b1b8,"e",@progbits
+	.string	"(\265/\375`\361\002m\026"
+	.string	"\366j\222H\3200'\035[\200\344\034lGJ\352\206\027\3437\307\215\307T\313\032\202\351V\356\3339\213A]\250\206\365\237\301\267\225\251\252\316o\240.?`\236EFV\234\332\0050NP\344<X\003\fE\366ffV\362\311&R\246\024{"
+	.string	"p"
+	.string	"\177"
+	.string	"\227\177\331\336\336I\340\236d\343\326\234\035\252H\304\313\021P\325\276\210\217\300\035\351\306rN\016FOs\366\bX\200x9\273Hx\251\247\205\227\306\3313\336#\232"
+	.ascii	"B\004\351\224n\3149k\353\341\270\207\022\\\305\3718\017]\273"
+	.ascii	"\236K\261\347"
+	.string	" h\262s\003H\266\333\001aX:\027\257\235\216\256l7\202#s\316\373\256\026v9\325\216\2239\247\225g\227\341\356\270\355\025\333\005\354U\020&~\302\306/\262\204\027=\317\245\377\022^~\357;\370\364\023\305\363\311\321\237\335\033u\207\354\203s\316\351\025\262;\324\"\242:$T\323T\r\242\352\017Q=\023\325\036\242Z\246\352\230\252a\035\352\227\252]\241\272\245j\361H\277|\322\017\252Z\245\372\001b3b\354\316\373\315y\341\227cZI(#\333\367\225\276D\363\022F\360\303\342ui\323\330\257\260+\237\330\312`\253\033[\225\312}\030\365\347\327\302\"\034\352F\234s\032\360\237\236\242\201_ti\007**\341\345k[P\255u\355uYo:\212\025\026\233-\274l\355\227\016\332\370a\342\371\310\325u\215GNg\322`EC\306T\\\033\202\213\236\307\367\375Dgq,W\\\253.+G\177&/6`"
+	.string	"w\310\3626!\270\247\002\341\273\322Q,\235s\342\354\016\031\334\357\003\037\f\035\305\262\037-\266\333\fLL\33023\201\205\201KL\314\255e[I\315\255Vs\253Qpay\251\331n1\265\022\232a*\264\334j200\267\332\253\227\363\025\362I\316\216\241\310\372Voq\223"
+	.ascii	"\005%\274\274\357\007|GN!+\262\007g\033\262\256\221W\225\313"
+	.ascii	"\242-\025\310\322V\233tY\267T\370\261 \013\312\320\371\220\334"
+	.ascii	"\265\037\0132\362\246rA\343\212\033\031\221\n\231\037&\034@\263"
+	.ascii	"\235:O\r\217\225\355l\237\013\032\243.5`AJJx\351\261\0018 p\202"
+	.ascii	"\231Qd\033c\001\253\315 \\\215\221\313B\325\221\325\276\272\271"
+	.ascii	"\201\237\021\274@\232\201\020\030C2k\217\271\032\235L\327\347"
+	.ascii	"+\002\206A#\356\005E\267\214\257\f\301\016\316:\200\232x\310"
+	.ascii	"\302\326\370\361\257\221}\313\345A>Wk8\247[\346\210\350\005,"
+	.ascii	"\204\254\2006J\026\036\3212\211E\206*\346x\021\026j?',6\200\221"
+	.ascii	"\302\234\206\375\216r\031X\215\006zIO\367oO=\024[\373\364"
+	.text
+	.section	.gnu.lto_setRssiMsp.114.6817abb10635b1b8,"e",@progbits
+	.string	"(\265/\375`\016\001E\f"
+	.string	"\366\325PA\020q\224\016;p\234\033h\343_\255\303\003\021\037K\310\2673\304\354\242oMw\310!s\356?\2545\202\036\375\003Bf\354i\336\f\254\250 "
+	.string	"P\345\2574\031\200UX\r\230G\373?\331dK\231R<"
+	.string	">"
+	.string	"@"
+	.string	"\227z\370\366XA\315\315\2676\226\316\343\036+\030^\301\004\036'\0322\336\004\330\201\2022\361Hx\341\232\361N\220\300\356>\365\244\340\2312\255\315\356:;\317\302m\335\366\307\266\001\373\240p\025\304\272\310\0375\235\232\376\005"
+	.string	"\215\030\336K\330\330\255\220\202cK\252\025!l\037c;\323F\240`\273\210\004\353\356\006\022$\273\337\001\027\250\274\362f\313\370\367a\005\210H\241R\234\354n/HLt\2504\004\305SE\352"
+	.string	"\027, \274\026G8\037&#j\344\356rj-^\035\214\3008%\212\375\023\3774\037\204#\214\362\335+\177\024_]9\037-nd(e\212\375q\251!\366\003\037Mc \322\026\214<\241\213;\032Rv\221\262+\364i"
+	.string	"\272:\231vi\002\030\023y\262\013\002\206e\027\346\333\303U\220\312\f\016%%5EKZjc\017\362\235\237\372\346\244\234\243Z\352D\345p\033"
+	.string	"3\241o)\360\202\257\301^\324h\016\r\217\003\2364\020\200\340F\345\024\016\222A%\t\002\266\025\177@p\210\020"
+	.string	"\207"
+	.ascii	"]\303\027&0\251\272O\245\306\tw\037\214\262\bc\2011\212\252\261"
+	.ascii	"]\245\f"
+	.text
+	.section	.gnu.lto_updateRSSIPWM.115.6817abb10635b1b8,"e",@progbits
+	.string	"(\265/\375`\212\001\255\017"
+	.string	"f\237kE\360\260(\035\273\337#\233^\356\345\301\226GE\356\206 \321/?\271\301\206S\305\374lh\214\247\255\334\332^\001\325\262j\364\245\026\202\253\332o\334\035\250qoA\232*\030\255\327d\364\335'\364\253o\367\336R\246\024W"
+	.string	"O"
+	.string	"["
+	.ascii	"#\337\304m\256\337R\336\2160\305\304\200\331]\217C#\b\035\n8"
+	.ascii	"\201x\230\357\210\207v\331;\0050\354\353#\006\306\214\246\306"
+	.ascii	"\356v*\342\256?M\227\0172\341\016\200V{\375}\270\222j\261w`w"
+	.ascii	"?\363\334P\223e\202L\273\353\244\325<\334\360\266\033\330N`'"
+	.ascii	")\376I<\274\036\206e\247\304\r\2269"
+	.string	"[&\226\352b\377\355\356Z[\354\230\026\375v\207`:\2764|\351\367\322\372\322\251\351sp\370p\250\335\366b\267C\316\306\346\300\033\022\277\375\366\375\023\237\261GF\271\214E,<\243C\033\305\036\035\3768\007=*P\243*\230\375\fHP\316\343\001j@:7N|jK\030\311\323\240\276U\321\227C\372T$\303\226s\353-R\f\350\354.\003\177\305Y\234HJJ\342aHI3nJOU\21572\204\210e\316\327\324\317~\214\272\n\n\241]\331\002?\305iR\376\313\241U'y\332a(\026\353A\352\202\t\310\247Rk\325\265V]\005\324H\252;\255X]\251\303*\023\222UgA\245Zu#\031\330\337j\013\356\327\300c\223\003\323\330\213\352\2738\216\003\b  \361\360c\345\247\007D\356\356K\325\305\371\220(\322\t(h\310\322\307~\315mB\374\027G\020\021\211\207\"\375\314_\315\212\215\033"
+	.ascii	"2C\333\220\200yw \314\332KUsX8\bw\376\366\247<\326\210\007\257"
+	.ascii	"\256\335gX\262\262\344\324r\227\360\026`\234D\236L0&S5\320\\"
+	.ascii	"x\266`\224+\313\007\366\001\227\017X^T\215\355*e"
+	.text
+	.section	.gnu.lto_updateRSSI.117.6817abb10635b1b8,"e",@progbits
+	.string	"(\265/\375`M\001\235\r"
+	.string	"V\030YD\020\257&\035\343\261\204CU\207}~\276\n\025\261>;,\275.\355\370gs\177\207q"
+	.string	"\031\204.\340\036\326\022\364\213I\377\3467\266\330\026$\320#@\005\020\001\200\251\230\254*<(\\\373\203X\262\367\226)\005E"
+	.string	"E"
+	.string	"E"
+	.string	"\033\327\2433\233u\024\207\025\320RaB\314\213\335\225o\303\263G\3704\363\241\nM\315\306i\217\230\311\341a\216@e\206\305\306\231\374\225J.\016\223\212E\203\223\360\224\363\261\273\326\215\273p_\267\275\300\266\264\017\"\361O\003\203\214\315\tI;\033U\322\247\301\376\353\272\316\306o\305\376\313\037U}N"
+	.string	"\026\024\334S5\273\026:\030\273\212*<tl_\355\213\270K\366\227\b\316\330\315\020\"\305.\352\200\t`\217\035\347\270\036\341\003\233\237j}X\225\236\346\307|\236V\232\336\334\2442\255x3>\rD9m\312\t_\306,L?z\312\266\234\234\354\233\260\315\032\240j\261\253\035E\2675\320Q\2421\354\2178\211\221\337\301\020H\364\333\243Or=\"\005\037\020H\002\221\220\317\234#\017"
+	.string	"{<F\246\034\2312\004\204\001Hz\246Hzl8\344\3403\245H(4e\007E:\334\267\002\363Sh\271X\221^\311/q\177hz\003cG\355\006\240\227z\201\226\013\304\324~ \322\007\037"
+	.string	"2\241w)\340=NX\240\223\352\263\013\272\226\332\013\325\252@2\236\222\f\0077\263\32556\001\301"
+	.ascii	"\315O9\003U\030Q#\213\243x\251\314b\234a\005e\313\300\250KX\304"
+	.ascii	"j\364\270\233}\022\211\325d\247n\202|\273\254<\001"
+	.text
+	.section	.gnu.lto_getRssi.118.6817abb10635b1b8,"e",@progbits
+	.string	"(\265/\375`\366\001\355\020"
+	.string	"\366`qE\360\320&\035:\262\270\360e\315\203\352\027q/I\205h\254\333~\177\343\340\3778\"g\273\035\211\226\t\303~\260]\315\211\302!\264eL\276\263\r\321&\364h\031\210$M\363%\306\227\332\300\351\326\b!{K\231R["
+	.string	"T"
+	.string	"_"
+	.string	".~\216Gwy_\326~\203p>"
+	.string	"\355\276H\036-`{\364A<\204\213\275\021\t\251\227\021\034\0170;A\273/\256\364\220\3541\017\222=j\206{\207\232\236\257\231$\370|`\254\326\313a\205\253GK\005Ev\3679\317\230\326\227\251\231\354\256\223\325\242p\307\333>`\233\304N\226:\236oc\b\250<\353\321Ge\217$-0\243\002\307B*c\366\353K\255\261\017ww\2554\266\323\037%\322]w\007Ls\300\364\b\246E1\035\202\351\r\2465\230\3164\035a\032jZ3\235\231>"
+	.ascii	"\217\033\237\326{`\273\023b6vED\301\341\256\337\016\273\251\001"
+	.ascii	"\232n\231B\325\364\253\233/c\216\232\351;4\252B\215.V@\251\252"
+	.ascii	"\207\271a\225\367\230HE0\323\202\206\013\222T\213\335\313J*b"
+	.ascii	"\3213c\325\341\313\335}Q\255\361M\331U\301\210\027\252\254a{"
+	.ascii	"\301yL\333\256\212\200O\342;\f|\233G\257\234N\331\343\365d\346"
+	.ascii	"\207\206\353\"\036*,\rPNL(T\027rJIK\307\265t\234\003\023\312"
+	.ascii	"\n\227\322\241\270\022\020\237\036\250t\\\204\323\251\343F\257"
+	.ascii	"\324\341*\215CJ\310\304\320\222\222`d6$I;4\306\366\207\212\244"
+	.ascii	"\3643\207~\350W?#\335\224C\265\235\325\205o\023\351(\244\"\r"
+	.ascii	"\220b\005\204rX\312\211\220\236G\203\013v\f0t^k\003\261\230\f"
+	.ascii	"U\" p\002\2411\343\rM2t\367\024/\225\300\255'\233p\331$n$\005"
+	.ascii	";@\302od\013\221\373AI\250\341T\212\310bo|\211}l\025\034\277"
+	.ascii	"\214\302]%w\311\234\247\005j\017\347YH<n\330q\016\020'D\200\230"
+	.ascii	"\274\370\250i$\226\205\312mW\320\003"
+	.text
+	.section	.gnu.lto_getRssiPercent.119.6817abb10635b1b8,"e",@progbits
+	.string	"(\265/\375`\211\002\355\023"
+	.string	"\226\346\204H\320\322(\035S^\240\277\230\334e\003\264TS\304\277\253{\312U\364\2643usu\340\243\245\036\242\314\025\276\355\363S\246\256\003NU\3203PS\023\236h3\235\245\314Y\\\340H\300\277\257N\376\215\325~B6\331R\246\024q"
+	.string	"e"
+	.string	"x"
+	.ascii	":\032\231\3778\202\016\216\023sN\031_\347\324\277\2538\220\314"
+	.ascii	"W\314|\342\346\347\222\017\212\2449u(\377< \374\267zK\376\323"
+	.ascii	"\263\344i\354\224\r\034\240qM\200\r2\037\005|\206nAKs\352\\\013"
+	.ascii	"\3425\217\2535>\250\222\342\nhCJ\270\234\354\261\303W\225\253"
+	.ascii	"\305\2239\347yW\233\034M\025T\231sZq9\016\367w\333\013l\243\330"
+	.ascii	"\033\006B3~\217+\270\350q\377|\027\371/\356y\217?:4|rf\332\263"
+	.ascii	"u4]\036\373q\356\216\035\252[Rm\"\325,\251.\001\325$R\275\222"
+	.ascii	"\352\021\251VE\265H\210T\247\242\032\365\251O\341\247\006\255"
+	.ascii	"\226\337\3351\2525\252\017@"
+	.string	"ebG\356C=\346\274\351\005\2315\276\242\021\337\375\366}\026\337\371<\247\002\020\212H\366B!\210\376A\307N7\235\240\327\373Q\233sF`dW\252M\355\310\336V\202\246=\213\254j\037\262\"\250M\355w\303\226tZ\324\376\3264\323\236\204\023\3118\355\003\035$&\240\030\027\354}F\206\213\262\021C\311F\202\246sN\331.\217\377\222\340N\340\345\250)\020\177g\226\303x\205s\326\020\370.\376\242\305\357\371g\n0\230\374\007\356\212\316\021\023\320\203\036-\032,\260\254\300``b'\277Rbb\256\230\230\353\002\214\305\305\365\212\301\270RX~\301\320\022sexy\211\271R\272\331\343\334\035\267Z\340\360\330p\317\373on8\"4n\310\332\330\226{2[\232ueK\215\004\366n#\211\362\257\315\240\201\036\247\033g\316\312\334\332\357\255\311d[{\333\021kWk\262`\220\315\003-,Y\026\311\226\254"
+	.ascii	"#[\222\203\317\b+ P\202a\350\252\033\223\024\272\016\023^\272"
+	.ascii	"\204\264\030.W\022\327\214\n\226_\234\254\302i#\0219Q0\004\344"
+	.ascii	"\3137n'l\037\360\005\243k\315^\306\035C\260\203\355\266\223-"
+	.ascii	"\303]%w\335\232\374\260\275\262\363H\025\3056\021B\f\235(~\302"
+	.ascii	"\001<\301~\211,\365]8\260\257\270j9\260\037z\371R\035[k\312"
+	.text
+	.section	.gnu.lto_getRssiDbm.120.6817abb10635b1b8,"e",@progbits
+	.string	"(\265/\375 \356\205\006"
+	.string	"\202\214-2PO\323\001 ;\263R\201\362\\\332\027\242\223\260\026\031\371\201\3768[#\3156f\313\f\300\246h3\263\tDV\370\215\035P\323P\t\217\266\255\224)\005\226\"\n>\n>\b\007\206\207'A\211\027A\236\"\032\340\233\230&\370\236m\257\231\324\002L1\366K\276E\337\303\024U>\273\363+\347.5@\003\313\215\275]\251\034\366/\253\031\333\351T\001\220\013\355\032\224]\214M\313\256\270\223\017\333\226\375\370\"\037\261\034\023*\260\353 $\305\302\204ew\337\300\t\234\273<\344\334i\307\3433\372'\371\002F\243\222i\327\023@aw\235\231\226q\353m#\3306\260\275\021\b"
+	.ascii	"2\003\316:#h\b\3055\2617\"g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_setRssiDbm.122.6817abb10635b1b8,"e",@progbits
+	.string	"(\265/\375`\302"
+	.string	"-\013"
+	.string	"&\026M=@M\224\016\003\327\375\001Yw\025e\264\2138\b\001\224\370\004\304\002o\271u\023\316r\367\177\003\220\227\210\006-\006G\272_~\263\260\227\223\007\260\302^\301>\021\212\255\226\f\262\267\224)\005:"
+	.string	">"
+	.string	"7"
+	.string	"0\037\231\016\255\331'\316m\330\002\243\215PF\212\335\215\252\341\332\237\246\346\007\330:\177\024\205+d\373<\311\356\276{F\330@\231"
+	.string	"\252\335u\212\266\t7\274m\004\266\017\330\257\002/}\nRBc\273\b\024\273\022J\033K\002\216\350`\373\017\333\312\035\204v\f\216\035\273\0304H\273\334\304\221:\224\274L\373\036\376A\373\005\004\303\335\013#\322\356Nl\200:\034p\002\323\003\223:C+R\365j\351L\200R\205\375\214\207\340\370\034\214ey\321\241\237M\207\327w\177$\013\245Q\005O\226l\356\223\232\301\376\333\335\265Z\330\231\236~\361\277c\374\032\230\313\225Y\330\204\311\026T\024h,\t2\030v\t\360\205\262\271\342\346\212\f2\025M\274\\X\244Dl5\300\\\361\201e]\361\301y\256\026v\345\321\317{\216\234\324\266\034\344E~\367\n\244\035?\r\023"
+	.ascii	"2\001/~\364\021\202\300\0350\206T-\203\027\330+b\303\374aAta"
+	.ascii	"\030\206\321\200\030\340\n05E\334\345\246\332\033\n\363\326\226"
+	.ascii	"2"
+	.text
+	.section	.gnu.lto_setRssiDbmDirect.123.6817abb10635b1b8,"e",@progbits
+	.string	"(\265/\375`\300"
+	.string	"M\013"
+	.string	"\266\025NA0\211*\035(\360c\200\207M\221\021\245w\274\250.r\022NW\250w1\324iM\333I\321%\365\301\315b\005\220~$QH\245@\371\241\026\024\034\333\244V!\300\307\312\2200\345\250\332'{\357\235R9"
+	.string	"="
+	.string	"7"
+	.string	"\362\030\356\325\241-\341#\200u\030\320\2411\253\355n7K\036\236N\031\372\025\021u\n\362y\021U4\263\273\227]n\210+)'\234\335\265d\211\037w\275\355\t\333\020\366%\002\237\\ p\210w0a\327\343Va\037\324\006\002l\337b{\216?\020>f\362\302.I\215\266;j\254\241\274f\250\224\366\t\274@x\330\311uw\304"
+	.string	"mw5~\240\2742\274\201{\r\213\232\363e:?;\262\b+I\301\376\354\bL~"
+	.string	"\203$y\326\253O\342^?/;\245\265\022\330BR\362f\217(9_\366\351\356\256\247\313>\354\257\217\375\224J\007\037\317G\362@.\324\241"
+	.string	"\201`E\306GT\261gS\372\272\322\327\211@\026\241\316\363\201\335\006c\357\342\363u\030\236\367u\226qOw\272lNj\252h\235\276\202/8y\243\021\367\032\321b`\023\221\273\001\022"
+	.string	"2\241\305(H\202\201l\274\227\252\346`\341\257\356\024\341y\341\026$\027\206a\030\r\210\001\256"
+	.ascii	"SS\304]~\252\275\242\324mm\321\003"
+	.text
+	.section	.gnu.lto_rxGetRefreshRate.124.6817abb10635b1b8,"e",@progbits
+	.string	"(\265/\375 \373\345\006"
+	.string	"R\21505@o\222\016\230\022\314\325\t/\023!ru!\250I"
+	.string	"\313\313\273\245\266\246\254\265\315\036P\327(\tD\354\214\343\032\020^ w\271\207\265\256\024\336\203E4!2\005s6\235\b;\021F<4@@N\234\200\233\314\224\204C\204\024\024\025!&\313\272\320\356\340r\030\177EK*\201\314T\270\243f\026\027\244\357\013O+\326w=S_s\003$W+}f5\327\361\005H\027\372\333\315\021\264\244\200JB\311\334(\275$\313[\t\371?\217\271\242\212|\2564\031\227\245\021\2154N\\23XP\203\251\25753\3659\217Vm\325\355H\031LH*\030\310j\013X\310\314\033\006\342\350\256\177\302\217\360\177\004\b"
+	.string	"\004\013\330\210!\005\205"
+	.ascii	"]\303{#\\\026\202\fw\305\324N2"
+	.text
+	.section	.gnu.lto_isRssiConfigured.125.6817abb10635b1b8,"e",@progbits
+	.string	"(\265/\375 \363\255\006"
+	.string	"\222L.4Pm\222\016\244\004\252)\372\255\210\243@\325\2404\004a\fd\031]\276\236}\373w\313\2163\002P\241\306\2633m\332\030*`\205$\264\2605Tk\355o\"Sk2\234\3478\317=4,88\315\213p\031\201+\b\206\347$\252\3529L\226E\022\"\001\bC\337\215\245\210XQH\250\034\355\330\\\215':\255W\251\333\261\224*\002T\200\332\351\263O\303\213o%\221\364\267\261\265[\t0!\301j*\311\034\235RR\204\002\331\370=\217\371"
+	.string	"\301\263\325,c4P\372\020y\240df\0161j\265Y\267\245*\214\230N.\354\323vI\310\314\333\205Qt\354o\360\027\374\026\001\t"
+	.ascii	"2\001#8\343\216#D\250@\\\023SF\220%D\016w\316\324\316'"
+	.text
+	.section	.gnu.lto_rxGetFrameDelta.126.6817abb10635b1b8,"e",@progbits
+	.string	"(\265/\375`~\002\225\024"
+	.string	"6&\207I\3000'\035\373\017\244\364A\334\203\006\264\246r\343\217#\263u\211c\257\376\240`\257\f\334\205\217"
+	.string	"~\340\251\305j\371z\\\201\251\272h\252\245\005\210+\313b\237\267\377\006\0070y\247/\353m|\352\233\255\233Z#D\312\224\002p"
+	.string	"f"
+	.string	"v"
+	.string	"F2\007\306\2346\247\217\224\2129\201$.0^4p\264\355\023\275\204\214y\016jze\002\242(\233\340\326\234\223\034\271\200\327\305\360\"\257\213\033\342\274\213\341*\317\377\321\033\370\246\240n\312\231\213\036\036~\2245\341\310\234SV\322\350\206\"<MU\017^q\312\232\020A\225P\317\217\256\035J\237*l\301\234\323zS\352\334\257\333\256\331~`\253Q\006\372t\177\354\207s}\354\230\2326\252C\254\006\031\325\263\003\177\217\230:\366\244\0336\252wT+L}"
+	.string	"\037\\2\312\273\200\2323\247K\307\244\022W\004=\351/\025u\3553\275\347\227u\244/\301\\\311(?\254\233\360\203~\222\206O\235y\016TDSWs\002\017\\4\311\bc\313.\252-c\313l\253\332/z=\277\254\033;\275\365\235.\360fV@~L\360\241\324\017\013\t\306\t\032!K\333\001Y6\\\260\325\r\331/\335\200\210\240\234\017J#|\332e\232\332\023j\372\033]\335\322z\372P\177a\373\340\003\\i\031Q\371vF\253\204x\234v\177\374\226\327\227\002R\f\032\305a\333\366\024-\343\234S\201\217\342M*>\320E\337V\3647+\257\213_\224\337\214\241\242\236v9\266Pb\303\335\\H\226\034\016\227K!\2603\261\341n\020d;\023\233\n\003\033\256\246\253\340\341\224\222\027\035\371\242#Yn5\034\231\242\333\221%\"\316a\260\351H\227\\NG\312\200\275\207s}@v\244\267>\267"
+	.ascii	"\331\037=$\361\3331\264#\032\266Q\327\371i\r\305\016\305\333"
+	.ascii	"\305l\370\331\270\020O\223U\030\341\025S\02089fj\274\230ml\027"
+	.ascii	"\266\263=\223\377t\026\022| g89\331\0071 p\002!\242\343\003N"
+	.ascii	"f\350_\221\332scm\220--\026\315\3159\261V\314\301\005\234\265"
+	.ascii	"f\210\326q\265qq\026gi\305\212\216Yf\234j#\215\247\360\334i^"
+	.ascii	"\361\214\033e|;#\2330\364\214o\001{\254-@Gb\3604FX\353L\\\312"
+	.ascii	"\024\201\300\226HV\2118\204\0314\200s\332\266\314W%\354\r\355"
+	.ascii	"\023\201\322 s\221\366j\202]\330\f"
+	.text
+	.section	.gnu.lto_getRxfailValue.part.0.163.6817abb10635b1b8,"e",@progbits
+	.string	"(\265/\375`\365\003\r\032"
+	.string	"&n\245I\260\230M:"
+	.string	"\f\333\200e_$r\037s\212\200Y\200\007\033\301\230#\347`T\203\0011$\242\035F\0251\330\271\316\346 W1\364|0\336\306O\317D\356\024\026\307\016\333\223}i0\021}]@\031\261j\226l\"wJ\001\215"
+	.string	"\231"
+	.string	"\210"
+	.string	",\274\265\336\230zRk\t\341\324\t\\\247v\220-\236\022\251\3316\313\246\\\316\266?\344NA\2661 \272\335\026\374\360\031Aa\325Z\216\247\003\376\nO\347\r\204\247\253\343\266\267B\n\356t\331\374y\244\023zka\220\t\237`\\\035\351h\234\336\324ZE\035\321\004\301\327\225\245/\242\256\btp\243\212\f\001:\334\\\360\206\n\225\221"
+	.string	"]\021\210\200\t\307\230G}\272\320\r\315Y\340\256\226\205Z\253\177\333\335"
+	.ascii	"n{\3106\316^,\0015\211J\371\270\222K\001\"\r\264\244`\310\213"
+	.ascii	"\221\024\024\024)\214B)A\225S\321\324\264)\233\220rO\354\003"
+	.ascii	"\326]\331\204\024`\351E\351\204Uq\345\003\232}\266\005\321-\207"
+	.ascii	"\204\245\030E\271\037y\313\276\337\344Nl\321\344}~\231]U\217"
+	.ascii	"\034\261\003\323Kq\237\303\"\273_\317\3467e\332}\376\331]aQ\337"
+	.ascii	"H\315G\362(\213Jj\207\002\2326eE\312==I\320\241\200\006T,\365"
+	.ascii	"H\275\037K\3028(]G\034aB\355%\213\233\035\017N\rN;\302\204\240"
+	.ascii	"\227\001\256Zq\024|+\247\372\340\36385\210\020\324\017\261\267"
+	.ascii	"bU\3446\317\360f\364n\340\362\250|\356\314z\315\327E\2046\211"
+	.ascii	"\022\363Gs\037%i\377\254\034g|\273<\333<\341\367JO]p3\313\004"
+	.ascii	"\346M\275\211\320\206\305\346\217\276\323\227E\b\025n\205\246"
+	.ascii	"l\327~\256\246\232\253I\265\301\351\243N\300\227%\b\225\3204"
+	.ascii	"3\227\347u\035\254\313d\327L\2075\323\264f\032\244\231^qz\212"
+	.ascii	"\323\247\231\273\n6j\215q\246L\336"
+	.string	"\331\301\241\365\2203\02522f\"6\033c:\007\274s\342\347\004\217\216\214\304\220\243\003\243\365\360\3004\274zrd2\330N\254\345\030\316\212\331\270b6\312x`>clF\033q\f\230\374\311\231\215*Hr6\212\266\347\227\311a\r1!\335G]C\r)\024\334p]\330\016\327\026n;\324\262\031\271\025\027\2726WS\266\007\020-5\004}u\225l_\370\026\fZ^\225a\003\007\016\341)\270\227\261\373\215\261\024\023\033Bty\366\020\356\322\374\236\254\354\016\277\342!N\250\221,\303\020b\004!\221\031\td\202\246u\240\002\031;\323\006\021\240-\224F4M\215\232\365\016LP;\020;\243\036vgR\254bC[\234\377dN\362\344\3132\306_\357\033\020D\034\326#j\254\313\315\314\027\261\n.\226}\236Q\270\234\037\036S\301\302\023\240\"zZ\374\335\241\227$\t2\2775\336\003q\257t\202c5"
+	.ascii	"_>\214\b\216!2lD\211&\177Jh\236\317\006\305/\022\200\303\330"
+	.ascii	"\037\204y\262@\245\256\341\260\353\214\346\304\377L\bD\261\362"
+	.ascii	"J\353\31556\312z\2005a\336\342\352\020\307S1\245\243\001"
+	.text
+	.section	.gnu.lto_calculateRxChannelsAndUpdateFailsafe.part.0.172.6817abb10635b1b8,"e",@progbits
+	.string	"(\265/\375`\316\002\225\025"
+	.string	"\246\247\213I\300\324M:dg\355\026\305\331<K\247\375SS\354\021\333\232`{p\205\231\264\342\023\257-5Dd\004\260\237\375\355\271\202\036B\232\341\241\255\026\t\301"
+	.string	"\226E\320"
+	.string	"@\b\003\360\034\262\366\177\351\304\004\215\032!do\271S\nz"
+	.string	"k"
+	.string	"x"
+	.string	"^a\301\001\262\355\025\226\034\313\236C\372\021\220D\324\343T\244\326\\x\272\031.\373\n\374<:W\222\310|\235\257@\330\200\200\026\376]\367\271d\343a\324\343i\254pO\326\306\240\323\222\221g\246\324ZY\243\0049\347\200#\242\252\347"
+	.ascii	"\022\232)4p\364\260\306\035\271\323\300\255\306\204\222\2216"
+	.ascii	"Q\244\214\250\256\273\364\031w\24449\311\327Rk\365g\266\233u"
+	.ascii	"\333H\266C[N\005\364\272\027\220\202\261\3436b\310L\356\344\342"
+	.ascii	"\274$\237u\217lK\257\2504H\245?*\355Mi:\245'\225\336)-\237\373"
+	.ascii	"\1772\223h\004\270\325\372\263;R/P\027\036l\337\276\016\307f"
+	.ascii	"\33196\313+\237\3039Sl\346\352\b\344\225\366I|)\347L1\257j-\232"
+	.ascii	"\202\2525\207\340\324\004\300\323\224\243x\247\363'\336\251}"
+	.ascii	"\021\001:vtq\246\373\025\233l\274\240\033\301vCi\206\217\023"
+	.ascii	"\273\271\270\271\337/5EA\275\005L\313\345\332\003\032\204fr\347"
+	.ascii	"\275lAD\n\303.\316v\214\267\333\240\351\307\2164b_\305W\304\310"
+	.ascii	"\314\314x\247\273+6\033U"
+	.string	"Br\375\024\177\212\321\274^\336\251$R\023r\252\033\217y_\271\037\262E\321z\230\270\321\344\316\276\314\363K\334I\346s\360\003\230|\355\324\207y\017\260\004.\032\031\027\233\032\227(Bh\001pK\345F\fo\304\260F\006\206&l\211\260P\345\304/\007.1\264y\275\304\220\365Y\367\310\327\035<\222\364t\202\305\367\313\274\325\372\330^\255[fK[\201Q/\217\361\276\005\3673^\276u\261Q))\230\031\302a\"\355\005\f\344k\226&d@U\005\241\255\016.(\304\f\374\026Wd\212\302\317\rE\335\"\317\333\030\337y[\322\264a\307s\243\275\303\207; \300\"\2512;2R\fG&\370\001\335\3076\261p?H\036\215\301\216\215\341D\300\263\265&\2102\036#\210\210\207\025,\231h$\033n\036\335\376\360\026\333\225\213\231\274\225\267C#\\`\023L\203C\037\355\227?$\001\377IvJv\2573"
+	.ascii	"\333\316s\222\026o\033oF\027\330\ryf\204\033\263\330\035\346"
+	.ascii	"@\274\334\311\331\331]\033!](\300\342^\\\300\0200h\350\276Jj"
+	.ascii	"\212\205\203\254\355N"
+	.text
+	.section	.gnu.lto_setRssi.part.0.175.6817abb10635b1b8,"e",@progbits
+	.string	"(\265/\375`\271\001\005\020"
+	.string	"&\036gE"
+	.string	"\261&\035\240z\360\266\377\357\301\247\337\241\027&\255~\216\3546\364\023\347Y\376\207\234\343$\034\362\230a\215\261\241G\323\211\323\006K\336Z\245\273\326\327.A(\376\006\361!\016~\375\330\201\215D>\331[\312\224\002P"
+	.string	"U"
+	.string	"S"
+	.string	"/q\023\247\307t\216\273-06\273\037\202G\033\310\036\003\234"
+	.ascii	"\366\230\007\301\036\355\223\260mR\371d\327\370'b\013\260X2\264"
+	.ascii	"pvW{\324\020?]\023\236\374\364TP\327\273\236\236\n\207\247\200"
+	.ascii	"\303\216\221\335u"
+	.string	"\326\341\216\267\255\300\366\002;\031\004\276\257\342,\354\216\271\317\370+ \254\310\300\331\335\316c\rM\227\255M\366\201\305\362\342N\323}\354S/\226\367J\220q\367O\230|\227;\266/cz\313$\035l\312\203\310\243!\212\2478\275eb\217]\0204\016d\217!\260c\315\177\246\307t\371\255JeM;7w!\301\177y\264h\224\367\036\375\021VB\312{\252!\030\024\345k\352]\177\2002\002G\312+\2259R]\254\360puew\244!\226V,\235\377\376g\271\342\311\331\335\220#g[\342\r\314k\336\302\0034\\\370Dlw\037\250\006\250\225\366x\231\253\003!\216\344c!\206@\033G*a!\216\344\023AT*m\036\006yN6\355d\323&\210>%\032h+i\036\020\223(\2046\255\002\211\264iy\270\272\362HJQ\254\252.\266\241\3720\036\243\363_\374\001\201\260\307{6T\241\376F\312\f"
+	.ascii	"\231\372\231\277\030e\273\251{~) `\20216j\007\2012\210\224\f"
+	.ascii	"\214\256\221\241\301\274\244y\343Vd\017\235\255\213(\0173\016"
+	.ascii	"\367M\203X\f2g\3565\260\345\325Y\331Lc>b\270 2>\017\260YI\032"
+	.ascii	"'f\254v\253\214\310\024\361\026>I=~hv.\3548^\362\344\354\354"
+	.ascii	"6S\266\r\200i\257\004K|;O\bc"
+	.text
+	.section	.gnu.lto_setRssiMsp.part.0.177.6817abb10635b1b8,"e",@progbits
+	.string	"(\265/\375`\300"
+	.string	"\r\013"
+	.string	"\226\025K=0M\225\016C\210\323\2268\361\032\310\214\226]\022\346\361B\235\337\177\375\231w?\0354\330\2061\304\253\241\007\303\260\252\203\203\271k\360\300\300\234\264\251)2,-\222\202@\215mo)S\n8"
+	.string	"7"
+	.string	":"
+	.string	"\266p<\332\267`\333Crg\213\370\027a+(\244D\032Z\273\233=*\204w\327\204\235\377\357\017\257\364\271BJ\013\236\024\207\023\001v\327\016\006w\274m\212m\f\373\004\002\216i\b\323\n\323y\325\377G\232"
+	.string	"\270vG/\327>\210\036&\330\276\375\317cc\2305\257\362\204\342y\252\363oG$k\332\023J\367T\307\272\333\240B\207\335/\3431\266\201L\336\203\252-\226i\025\322\217U}\f\317\240\371\022|\200\313{\217>\327x<\toD\376\242\221\252z\005\256P\276|M\215|\270"
+	.string	"BT\002\224\257T\224\025\036\256\236\034\030\216\033\260\341\004$\260h \256H8[\306\3312\r\246@&\253l\\&\211X\333X\266\f\201\246m\031f;\017WOv\260\034\254@\032RE\331\206\352o8\207\212\345ri<j\b,\003\024"
+	.string	"[+0\036\270\201!\005\002\006\271\004V\003\001*8@\024\fs\205\003\247\305\276\302\211W\331jN\3736\363vZ"
+	.ascii	"\256\275\230rZN\277\266\214\001"
+	.text
+	.section	.gnu.lto_updateRSSI.part.0.179.6817abb10635b1b8,"e",@progbits
+	.string	"(\265/\375`\353\001E\021"
+	.string	"V\237nG\360\262&\035R\245#\363\310*\311\324\204\227\302\205D\362\232\316\034j\267\034\360\"\303\016\304[\313\211\360\271u+\241\336v<\177H\016-\330\230,\362\343\324Lp\340gJ\230\212\270s\f\006\214\034\251\332\"\331D\312\224\002V"
+	.string	"Z"
+	.string	"]"
+	.ascii	"#~vg\t\036]@\364H\372\200\355Q\273\310\366\310=\236\204m\227"
+	.ascii	"\013f\3317>\263\331\021\02110<B\273"
+	.string	"\333=j\315Y\3274#\313\0179\215`\261\326\265\204\3050\\\003\304^\032iw\257\363\244\020se\nx\f9\355\256E\031\356\355\266\027\330V`'*i\215\351\214\351\217RV\212\261ka\350\307\312\304\0277)\254Bz\315lb\337Qa\243\204\320\276\266d\233\305*(\tZ\r\b\034?B\217\317\271\217\342<6g\226\357\230D\346\303\261\334\307q\361u\314\331~\216\313g-\211\332\027\r\245Gg\3327\361\023\254\317Z<\332\345\020AW\3314\225U\250\241\241\243\306\214W\372\260\252\246#<`\202\\SU\317s\003\036nb`z>\270r\310\\\332\017\276<,\225\344\322\226}\026o\321\342w0x\222\207=\372'\333\343\225D\346\323c\303K\016\255\020\311,\202\307\0039p\202Z\t$\225\306\032\257\255\316\330[Z\213\001v`J}\252\224n\005~\037\350\021@a\220\372T%)\253T\030F\360"
+	.ascii	"\3303\255\204\335J\330\255T\r\276\316\013Q:\223\210A\b\251\260"
+	.ascii	"K\001\301\260\343l\347\265\325\031\353\374\023r\310\bzQ\027P"
+	.ascii	"\302|\322\224\306\336\346\377\334\205\22721\331\036Kd@!v\350"
+	.ascii	"sw[\25246\214\236. \200\002\021#3\017V\204\301(\211\241|\230"
+	.ascii	"\235\366\026u\303V\240\215\214dA+\213\2716rg\360\007\254?\217"
+	.ascii	"\205%~\214O\227\205\"\331B\306'\265V6\201\302\275\026\330$Q7"
+	.ascii	"\314\b7\224\005!\bh\2079\237\307\3344\206\266\022\354l\254v\253"
+	.ascii	"L\221\356\205.9\247\267\320L\331n`\244\275\002\2704\247,\267"
+	.ascii	"^\213\307"
+	.text
+	.section	.gnu.lto_setRssiDbm.part.0.183.6817abb10635b1b8,"e",@progbits
+	.string	"(\265/\375`\370\002\345\025"
+	.string	"f)\213I\320\360(\035#\221\351\220\321F\031\310``\307\246'z\300\254H\332\221c\210\203\253\203\3404x-)\3641\325\324zA\320\373\230,\332\256x\241\f?\214\006z\3739/P\214\226\301~\263\020\220N\206\376/\371d\023\271S\np"
+	.string	"s"
+	.string	"t"
+	.string	"\r\026\327\241\344\323 \316W\334\236\303b\324\256\007\033@\273\277Q\374\034"
+	.string	"\252\254\362?\333oj\362\267<\236U\332G\361\024\267\337\324<wg|@\273[\340\323$\342g\310\003\204\237\362\"\341\247\375\023\266m<\337l\034\377\205X\001\276\245]\016\217\335\035?\025\304oW\t\336|\227k*\303\206K"
+	.ascii	"\007O'\273k\221\303=o\333\200\355\004\266nV\251tJ\245Q*-\252"
+	.ascii	"\364I\245\303\223\364Ti0\224V\225\226\377\375\037\2211$K\273"
+	.ascii	"\030\232\226vf\006\215x\317\177<r\301\302\226\330\256\245\\\026"
+	.ascii	"\270\314\370\222\306\317\353\\\355\373-\356c\253L;\013\337\205"
+	.ascii	"\202\230\234\022\273\253\372\354\341\251\211\013$\366|KJ\273"
+	.ascii	"[\362I;O-\265\307\351\360%)\035\020i\367U\330\374\035\253l_\307"
+	.ascii	"\366\034\026\031(\225\361\227\034\242\236\024\245\327\311\344"
+	.ascii	"\212\036\303C.\013Y(\374\024\225%\242\027\252\324\223\312\033"
+	.ascii	":\0229\331\344\251\341\312a\324\304\335E\340\013}\350\345\333"
+	.ascii	"|:\002\f\026~NE\005\251\202\372\035\223\377\342A\022|\033\253"
+	.ascii	"\304\344_>\375X\370\251z\237O\r0;|\275\253\324\357\034\345\250"
+	.ascii	"\210h\307\204\223MRk\254\340\301U\032\373$\315R\351\217Pz\245"
+	.ascii	"2/ZJke\276\\2Zl\026\276h)-\007*\020\030\300f3\331\312.\223\026"
+	.ascii	"\331\330\"\033'\300Z*\243K6\033MD\034\243\360\222\215\025b1\331"
+	.ascii	"(\2574>\301i\316zpwW\265\3066K\375\032G\252=h\265\302\317\357"
+	.ascii	"\034\345C\021\321\207\262\364!(\375\320\324\321\317\217\316\304"
+	.ascii	"Ji\250t\245\022i\307\004r\017\205)U\3514\332\365\b\034\324\224"
+	.ascii	"\212\340\374\354\350dr3j IF<\230\035=`\002A\250q4\306\b\025\310"
+	.ascii	"\020\211L \225\264\320pp\002\031\263\344\006\020pW5\313\030\303"
+	.ascii	"\002\241\331\217\347h\\\315\335\350\004y\\\203\340\2340\332\\"
+	.ascii	"Ztf\250\245\023\301\244\"7J\230\205\335_4T\350\363\tG\335\251"
+	.ascii	"\231\327|n.\203\035:j'\356\b\245 \364\237\274\202C\367|\213\200"
+	.ascii	"-\356\312XJ\310\336\3673\321<@\215\322\306\006\032\3662M\b\276"
+	.ascii	"\264\352(\324\371\024\317\367\361 \2513\273\312\264\3553\240"
+	.ascii	"\376h1\354\035<\005"
+	.text
+	.section	.gnu.lto_.symbol_nodes.6817abb10635b1b8,"e",@progbits
+	.string	"(\265/\375`\370\007\235\036"
+	.string	"f\361\260=P\252I:\244\262\376Nz\243W\177\207\300Ok\264a\020\367\016;\304\016{%\214\2741sh\225\240!x\035]\177\325U\327Q\316\364L\347U5\246\276.\341\334\002\231U\324H\333;\245\240"
+	.string	"\234"
+	.string	"\237"
+	.ascii	"?\333\221A\307\276\r\rj\310\2617\2438\fw\303yl\330\255\254f\r"
+	.ascii	"\037i\230\355\234\261_#\303|b\230\016\214k)_\234\313\205\353"
+	.ascii	"\224-ld\261vDWX\256&\223\311<\025kF4\305\273(@\261?CO`0a\265"
+	.ascii	"\022\336Cb]\211\216\260\235"
+	.string	"\262\232\"\254'\204\373\374\314z\340\267\322\266\002\b'\226\026\324\354I\002\261nd\302\371\260\306\273Z\033\362\260.\3643\207C54\237i\232f\2075!)\275\261C\034\326st\250\026\307^{\217\327}wF\366\266a\035Gm\003\260\024B\204?\260r\b\223D\360O\342\265X\020\327\303\224\317r\262\022\313\272\323\326\232\323\225\365&\342Z\323\271\336\323Zc\032\256\365\350\263\326\2272\335\\\347\321]S\262\342;U\326\213(\225c)\2539\345[e5\245\374J\224\365\035\205r\260'\377R:\271\227\262\311z\022\223u\244\b\027JHK\326\220(\226\333J%\353GI\326\212\220\254\023\035Y\333\031Y\327\321\"k:J\344g9\304xJ\363\200\331\332!!kDf\220\365 *\264\002\362\261\037\007S\372\270X\217\375\033\312c\003\300\251*\305v\272i\016\327V\024\260J\235\227\240\225\326\307r\300j\300\370"
+	.string	"i\322\306\030\020\260\0328\217"
+	.ascii	",\r\315"
+	.string	"q\300Z\200\356oD\246\f/\nX\251\034\bX\177\305[\230Tw\204\212\252WH\250\3723\016\312g\376!P\237\367jG\216\370\365\363\375\350~1\263K`\345\257\336\370\357\231I\036\375\247\254b\366^a\366Yd\373\341\330^\013\314>Ll\377\025\2667\301\366]_\366\\\274\354\267|\255\2237M\323N\220\274\327>\313\273x\215\213\375t\031Y~\213\001\225v\024,&K\002n\342\346\373yzwF\006\3479\273Q\007>V\001v\256S\317\326`\370\227!\313\342\b\330XOw+z\223S\206\201\333\352\221^\363\r\030\376V^\253\002\212\257\202\363\305\250\312\252\276\370\t\213\310x-\250\252W6T\241>\354Y\024|\277\342)\\\036\2422S\024\252\320nP\260\n\t\005k\0174\367\351\265\211\344B\301\032e,p\276\272\331\303\253s\240`}Bs\252$\233\237\361\226\324u\274\335\251\237\2716#\203"
+	.string	"\210hf\250\214\fV\037\r\352\3179\006\202\026\324\247\342o\252>\261\375i\304\320\206\001\200\212\250Q\024%QkFR\224\244ZX\003\240\002)\252\342\034\021\300\020\265\214\210\bI \201\00435\0356\210>v\323\f1\201\254\233\237\037\336\313\3767;\274EZSD)w\342WlJ\363t\303J\373\221\244<\037\350\325\277Pixi\205`\276M\033\272!\276\201n\013\356\231\327\020\023\322\024\304\204h\300\300A\351(\221\004\343#\304\323E9\374\325il.\002\236\210cn\267\301\246\325\245m)iCk\323\221\006\303/\327\027n\266\351\215\356\342\215\322\355c\253\353"
+	.ascii	"\227\031\200\330ZL>-\221\245\201\n\201\253 \355\314\030\306\300"
+	.ascii	"\262\272\353\020F\230\026o\264\211V]\321\350J\016&p\266\326\251"
+	.ascii	"\223\340\360C*\207\363M3\304\332aj\366\\\006dF\347\257\322\242"
+	.ascii	"\345\314\2777\255\241wZ\323\207\027Z\234j\273\213\\\335/\024"
+	.ascii	"\005&C\264:\332yb\3238@\264\203iI\340\346q\333\361\3343\260\336"
+	.ascii	";\213\221\026tfK\374\001"
+	.text
+	.section	.gnu.lto_.refs.6817abb10635b1b8,"e",@progbits
+	.string	"(\265/\375`\375\001\335\017"
+	.string	"v\352q?0\211(\351\300\300\300\220\305\217d\006\355\347ji((((((((((\007\314r\322\235\034\243\266E\220\357\232\271\267\233n\021\230\306f\201\275!\324\376\017\331\326\366\333>a\263\204l\231\002\\"
+	.string	"`"
+	.string	"a"
+	.ascii	"\207p:\310\365\036\2337Y\337qu\216\255\213:\217a}\350\352\023"
+	.ascii	"\235\376\361\364\215\3475\370\031\370\227\352\263N\3078\335\262"
+	.ascii	"}\305\351p\363o\373\324\326lc\231\267\256\207\3603\263\303\273"
+	.ascii	"\202\037\341S\230/\356*\353\021\373w}\341\2267\306z\254\352\225"
+	.ascii	"J\016cN\211\237p\212\372\334\020\360A\236\376p\365\016|\316\250"
+	.ascii	"o$\372\366\362-v\315\345Z\354\232\3145\261gb\307\300\277\304"
+	.ascii	"\236\305n\211\275\022;"
+	.string	"\025\273\213\335\270\030#\352\030F\2572zE\243C\215\177\031\237\030_\300ah\213\234\022\352.kE\376\262\236\0249\221c$z&\361\026\250\307\210\247\"\376\201\336A\364~\372\020\003\224Sw\247/v\210\365&\353\032\217~\371\350\031H\277@\276\362\361\320\343\001\361b\013\310)S\376Ly\2322\200\033~\236*\365\027s\027\277\245;(\2673\200^m\216\276\006\253\237!\376\027,P\344W\240\200\365'\300_\302\250_\022\363K`~\204\370\"W\377 \375\210\364\033\244\027\221^\343\352\241\237c\310JBp\315/d&\037\270\261O\376\332\244[>\351q\223\035P\032\224Aw\242.H\005\275\242\023\024\301\373\202O\301\233}\340\031\350\017{\207\025p[\224\276\342\363\024\237\016\202x\b\255?L\362\036\255sJ\0353I\317Fom\235\212\023\300\336N]s\372\214\203H\277\036\351\326#_\211\364(\362\001\022"
+	.ascii	"/\201g\0027^\224\224\300S\005\274&\236F\342J\214\035\341\274"
+	.ascii	"\206\034\262\001\301\254z\226\205\255\305\301a\355\001\013\251"
+	.ascii	"\265[\246\303F\362\255S\n"
+	.text
+	.section	.gnu.lto_.decls.6817abb10635b1b8,"e",@progbits
+	.ascii	"(\265/\375`\262^\025\207\001z\206\306\214T \fY+\215\001\325\243"
+	.ascii	"fg\251\321\037\347\234\371\2101\260\251\236\232\337\036\003\345"
+	.ascii	"\251PP6\035ED*\335\222kvE\262\352\336\327\b\301\340\210\253e"
+	.ascii	"\373\231\215\215\356T*7c\351\271\303\252\3248J\326\356\340j\342"
+	.ascii	"\251f\022\314\017\0251F\366\336[J)S\212\007\316\b\016\tj\030"
+	.ascii	"\212\346rk\021\005e\r(oj\231<\317\304\324\034\301\372\377U\342"
+	.ascii	"'\330Ir\007\335\276*r\033\353\243R\351\375\256\334\377\240\371"
+	.ascii	"\225f\314\033\326?V*\311Z\262\206\365\305\333|\370\210\241\302"
+	.ascii	" \361\021GuQ\363\367\207\274x\327\214\033\244_\2325C\230\352"
+	.ascii	"\r\251\027\206\305\022\312\232\373\346\326e\211PVf\231D\212\313"
+	.ascii	"\231\377\342]4W\216\r\224\026Z\226\027\357\226y\203u`\034x\007"
+	.ascii	"N\202{`\"\230\f\243\341.l\206\227\340$>\303_\270\t\316\201y`"
+	.ascii	"&\330\bN\303>0\022\374\003\227\3410<\206\221X\t\016\202\201`"
+	.ascii	"0,\206\213`!\330\013\017\271J|\004s\035\333\3007\240\366\336"
+	.ascii	"\370\210U\350\221\371\207d\260\205\370\361\021\277\310r\361."
+	.ascii	"\337\225\003\274c\376\241\030\030\253\r\037\247\260\340#8\013"
+	.ascii	"o\361\344\275u\240!\367\336C3\240 \207p\225\224%.\346\364\376"
+	.ascii	"!\253(C\370\nc\271\371\261\330\262\334;y\304+\350\220{'\361\256"
+	.ascii	"\230@||\022\263\374\362_<0-\220^\354^ \001\003\311 \2070\215"
+	.ascii	"+w\353\262D@\262\266\274x\370\bv\272Nn\235\017\007$\031\263L"
+	.ascii	"\322w\345x\362\3367\332\334;\017B\340#7\357\312\3618%w\325\020"
+	.ascii	"R\r\226\262\275\223\034\004qp\322\200b\206E\004t\266\272@\247"
+	.ascii	"\007a\322\037k\035o\311}`g@\307\002\251\372\260\3065\206\216"
+	.ascii	"\265~N\253\254\344^\333{\367\004 J\034\034\326\350\3759\177\336"
+	.ascii	"\245?\341\322\237h\351\317\"\351O,\fC\317"
+	.string	"\340\262C\b\326?]\2447\373\322\233u\351Mez\223,\275\031\226\336\354Joj\2457\257\322\233R\351\365_z]\227^\257\245\327F\322k\256\364\332*\365\271?\3475T\372\214&}\246K\203.\320y\331\3346W\031t\335\354\236k\367D\305\205\365\363\225\364\004\373\006\235\017\274A\347s[\372l\226v\300\221vp\201\316\347\235\206\240\227\036OI\2776\226~\212Vz,x\247\257\353K\257g\227~Y%\345p\177\316\377]\240\363\267I\332\301\3759\377[\327%\247I\0324\256d\207 B\370\350\270d#T}{XoQ\261Ci\207\365\357\217\364\377\235\273Y\256\362j\271Wnr\357\344\336\373!\260\\9\036'\237\375t\247\007\302\203\020W\313\245r\345r\022\211>\371\352\262\334;\031\304\001\007=9\210\344\3118\365\257\216\364\267Ez\253\\+W\t\200\033w\017B<;1\331I\366N\366\354"
+	.string	"\232\001\266\301\372\367\230\376\002\340\274\201\027"
+	.string	"\347K\220\376\027\016"
+	.string	"=\311\031S:\260\376\357\224\373\246C\365c\256\f\326R\202r\226\340\b\023\205\365\215\322\203H^'<G\237\r\365D\006\271w\362\377m\273Q\256\362\272\335'\277k\027\312qro\345\336\373w\311?\364\353v\331\256\223\234\234\262\241\236\274,\300K\\\224\215\277\275\223\034\004q\2403\203\355F\233S\377\001)\207\013t\352\373s\336Cz\323.\223\253\334\340\252\375\242\335%7\217\311\235\334;\331\203\201\274\201\322\004\353\013 \345\361\332!~\246\277\033\23490\360np\036\247\370\376\234>\027\350\374\257\222\377\236\335$\033d\251\027]{m\357\344\205\024\252J[\022\254\237\274@gz\177\316k\344\036\261\361\240\255\031\027~\363"
+	.ascii	"aN\270\330\020u\265\002@\365\374f0\203\200\f\n#x\363c&\004d9"
+	.ascii	"\366qy"
+	.string	"\003\217\r\2204\334\177\t\200\003\357d\276\027`\314\237\367\262\336\335A\001\215\343\317v\377=qU\360\362\337\013\374\367\004\030\250\3733\221\214\017\364\237\346\355\300\233\377>\271\371\257\266\206\215\337\217e\344.X\033d\272\037\377\375w\312L\001\260_\005\277)\346\277\n\3703\227\377~\370\257\007\177\356z\206\377(\\\315\314\373\361\213\274\345\307\b\310r.\376\353\374f\206\377j\227O\004+\034\005\217\360\364\343c\326\362_\276\343\374&:gw\357\254\224 \317m@e\004Z\315\245\300\345\213bn\375\267\356\177\334\265 O\3758\315Y\260\374\267\313\006\264\3406\032?6\312W.\021n\362\201\377\236\270\035\320o\030\001r\177\316\300\177\335&\220\255\3749\312\177\207\\\016b>p\177\\0\016`\r\374D\256\362\366_\300\177\360\353 \377\343\362\006\006|\220\327\376\277a\005\374x\0017\002W\350\317OrW\220\004\234|"
+	.string	"\277\016\301\237+\300\204\355t9\355\177\027\034b\347\327+\334)\214B>\313]\330\004\214\377\356\310H\256\246\267~\f\202\\\344\307\030\240\313c?.\243\001\243\023\367\350\277m&\362\3370\230/\203\337\324\362\377\004N3\237~,\202\034\344\277\024\370\357\336\325\254~lw\303t\340\024\374&\332\217\225\214\340\3677Y\370\361\007\314\330\037c"
+	.string	"\223\351\337T\272-\374\367\001\177\016\301\177\331\264\t\373s\n \377-\300\177\3712\330\177E\370s\t~\374\327\312\177\225\377m\362\337)\177\366\361\337\270?\367\3701\221\037\217e\036\004\300(\262\360\317(v`\021\036\206d\035yC\376\372\357\361\277(\262\327\177I\360_b\316\361\337\021\374\267\370_\247\377\256\377\315\340\317]\030\227\340\277)\336d\025\376\013\210\003\205\377\266l\3777\370\037\364\277"
+	.ascii	"\377]\372\177A\\\276\361g\032\367\300o\252\360\337\345\355@\007"
+	.ascii	"0\007\371\327*\374\307\032\334\3745\211\267\237\277Y\201\377"
+	.ascii	"Y\376c\371\277\345\202\377\0328\227\007\177\275\200\0230\362"
+	.ascii	"\025\373\237\355\277\333\177\265k\340\377\333\321_\037\340\317"
+	.ascii	"\036\374\031\204?\207\3703\210?\177\370\363\320\237?\370s\b?"
+	.ascii	"^\200\325\237/\370\263\001\376|\200\\\365\337\347?W\374\231\352"
+	.ascii	"\317&\3703\013\177^\377\234\364\347\025\376\\\364g\017\374\231"
+	.ascii	"\003\177\326\300\237-\360\347\022\177\216\300\237I\370\263\210"
+	.ascii	"?/\340\317\t\370s\372g\363\317\370\307\200?v\363c6?\306\372\361"
+	.ascii	"\337\217\375~\334\367c\027?~\372q\231\037\363\375X\357\307y?"
+	.ascii	"\266\373q\227\037\317\375\370\312\217\255\374x\004?\216\362\343"
+	.ascii	"\266\0377\371\361\321\217\323~\254\344\307g?6\3731\331\217\213"
+	.ascii	"\3748\354\307`?\366\361c\036?\376\372q\327\217m\374x\306\217"
+	.ascii	"\247~\034\365c\250\037\233\340\307L?f\177\274\364\343\244\037"
+	.ascii	"\203\340\307H?F\361\343\017\374\330\003?\346\300\2175\360c\f"
+	.ascii	"\374\330\002?>\361\343\023~\\\201\037S\340\307&\374\230\204\037"
+	.ascii	"\213\370\361\b?n\300\217\031\360\343\005\3748\204\037\207\370"
+	.ascii	"\261\320\2179\370\261\006?\006\300\217+\370/\006\376K\374o\212"
+	.ascii	"\377\242\370\257\231\377^\371\357\220\377\"\377\373\343\277:"
+	.ascii	"~\274\363\337\271\377R\375\247\373\277\345\277\224\377\206\371"
+	.ascii	"q\316\217\361\217\377_\267\377\002\376\367\315\177\333\374\267"
+	.ascii	"\357\277\313\377v\340\277|\377\235\372\257\366\337\023\377\343"
+	.ascii	"\376\237\370\257\230\377\356\3757\357\277x\377\275\373\257\227"
+	.ascii	"\377j\371/\226\377\"\371\257\331\177\313\376K\366\337\304\177"
+	.ascii	"\217\374W\354\277@\376\013\366_\036\377\335\361\337\257\377^"
+	.ascii	"\375\267\352\277*\376\013\365\337"
+	.ascii	"\t\374W\304\377.\377\271\374\237\362\377\355\177\222\377\\\377"
+	.ascii	"\265\374\347 000\360\347I\341\367\221\361;@I^fX\337\207\t\233"
+	.ascii	"\226\302\246\337\316\275o\262\253\312\352\r\007HZT\016\254\333"
+	.ascii	"\332t\224\324\351\254\341\264\247U\346v\035\005ma\227\244\341"
+	.ascii	"3\226\336\307Fz\355\344\3525\245^\273N:\354\343Q\203\261\034"
+	.ascii	"{Z\177>Y\351\357ur\376Z\355*\265Z&c\302>^\205@\226\003\213\207"
+	.ascii	"\374%E\214\r\254\3573\325\244\311\225\006g\"x\262f\f\353\373"
+	.ascii	"D\245\245\3512\033g\233\253\236\277\364\327hJ\215v\345\256\317"
+	.ascii	"~\272kCn\253\244\207\367\204I\177\255\344*\265\222\\\305\341"
+	.ascii	"L\254\347.\3755\022\245F\242\317*\2607\217-\021\320\322\352\272"
+	.ascii	"\230\001\323g\277o\267+\203\003\332t\fI##\323e\034\366\336Q\273"
+	.ascii	"\t\315\330\326\362~\327e\246]\021!l=\220Hm\344>{\357\247\275"
+	.ascii	"o\3748qx\261*rmD\bZ\213\027X\353\261`\316\226\260\037VDL0\257"
+	.ascii	")yD\304r`<\245\331\311\236;2a\260\260~\317\212\2600-\344\356"
+	.ascii	"\275w\326v2\323\201\226"
+	.string	"\253\030\035\264\020L\267\243\006\326\366\344\005\206$\313\2124<xh0\025l?\256\301\356\264\314l\371\370\037\274\340L\206\033\037=x\274\334\375\221\301c0\266\320\370\202\003\207\326\201\367\336\033\211\262\355@\262\334Y1:\374\372\353Z\007\234\033#H\260\326]\332\353\177P'\255\005\033-^:\207\021\036X\220\271\f\017\036`\0139\254\261dei\033>\373)\257\n\031\214Bc\361\204\353\332\206\321\025+R[\377\203\035h[\201\246\267\264VU\2277([\260\346\366\2245\356\025\0355Q\352\002\261>\217\221\364\272J[]_\375J\317H\367\336N\311]\025\204\006\267\247\365\267\263\262:\230O\236\276(\265\214\353\031'C\345L\016%\326\367\3231\362\256\344\300bh,+<\2639)x[\032\306}\202s\006\254/\006\326\347\221\221\376\367\370?\367\321j\357\r\303Ln\253'\235\363\277\277\346\275\035\376\235\233\257"
+	.ascii	"\376\353\275E@a\357'<\344\336\373\242I\307\336\216[\034\266Y"
+	.ascii	"\2677\224\227\223\003\274\256\240\274hH)\275\256.H)\275\266\023"
+	.ascii	"\224\020\247\013V\333\313IJ\271\367\005((\247\021]WR\312\343"
+	.ascii	"\276 \245\334W[\205\335\325\335"
+	.string	"I/\247\r\325\265/l\250}\334\312\256+\016RP^WR\312\343\325\005)\245\327\325Vzm\237\ru\264b\001\265\255.l\245\227\231\255\354\272\362\221Rv]I)\275\316\356\030\026e\330`uA\366Xr\235\244\2406\325\024\327\321\312\247N*\331\265\365\366\276kQ\333j\327\355-\200\275\271\272\254\364\2164\356\224\247:\252'\267c\327M\356\2755L=}um\250:\247\273\353\244\212t\355]\344\tiO\355\275\367\007N\311\272\375\343\3269\351\340\332/\242\366\266`'\367\236\332\333\351\356\272\275\267\323\336\033\265\342J\356\255\345#\205\234\232\332;+hjs9\301E\355\215\327\366\246\\I)\277\272\206\340\234(\221{E\322\351J\275\350\332\310\255\347e\225*\235\322\366\213\275\367=\223\"\257\260\372\260\326Sh\220(rK\254\277\323%\275fq\265\213\253\324.4\013Sj\357\253\016\306\234\270<\340\314"
+	.string	"sz\203\365w\244\244\232E\032\265S\266A\260*\t\220+/rPp\244\301\372\327*\256\245~\035\245W\344\272\017\3548Q;\342a}}\\\240\023\350\376\234\032j\350ZE\n(G\365\003k\f\372\370\253\324\307\254\245C\327\206a"
+	.ascii	"\261\245\032,\177{gy@ol\361\325\300\372;>\322_o\245\336\271M"
+	.ascii	"\226\332G\257\016\306\274Xy\370N\2154\211!\213\214\352\315\257"
+	.ascii	"2\277\311}A\251\275at@\273\332\323\372\333VY\036v\342\260\344"
+	.ascii	"V`}\2354n\332\f\261\222\325\2075\233 \025\300,\241\201\365u\366"
+	.ascii	"\322_(i\376\306\023\334\033\013\033r\357\255&\243\371\033\017"
+	.ascii	"Tr\207\235a\256\276$\371\333{\377\317k\362\337Uf5\331\357:\311"
+	.ascii	"\001\007AA\263\034eQ\247\276\216[z\235dz\035$\351\237\317\364"
+	.ascii	"\345\240=\371*s\245x\374H\232Y\236a3$\013\326\271L\022*\352\311"
+	.ascii	"\314\023\326\327\371q\225\371\320\036j0\222X_\207+\2313\345\006"
+	.ascii	"\224\030b\366\234\276(\201`\235\301d\275\253|\\\016\263{z\256"
+	.ascii	"\370\341\230\202\365u\254\322\246\275\367\276\217;\321\307\235"
+	.ascii	"\177\376\222\245\007j\205\024\275\274\240\0351n\270\320\341\335"
+	.ascii	"\271U\341\013\273\273N\322~(\371\354\274\234\305\340\021\226"
+	.ascii	"\f\302\2651\"\003\353L\227\273<\327e.\271\356\203\256\275\217"
+	.ascii	"\271\256\307\315\336\307\236{3\2707\003\215\344k\b\333\251\257"
+	.ascii	"\343b\213\226`\326\022\r\032\326y.\310l\263\322R\207\365uv\372"
+	.ascii	"\347,\031\013Q\207\230\031\326W\222n{\357 \2341Y\220\f\301\372"
+	.ascii	"9_\322\203`\313Qx\240|6\324\027\027+\031\n]\225L%\303\345\270"
+	.ascii	",w\225\331J\226r|\314o\327\311\275\335\366\336\277{Sr\224\234"
+	.ascii	"f\225>\371\n\263\314Vr\222\214\366\245\267Tc%'\363ZN\"S\027O"
+	.ascii	"]\226{\357\263\311\326]\024\035\375\034"
+	.string	".\351\315i\322\226\335\202]ZM\216X?\347\254-\247H\372\034\035Otf013\003\353\347\310\310jYy\225\331If\322$\0132;\311iNf>8s\"K\363g6)\303\n<\365q\316\244\307\301K\2173\227\036\307J^\202\335t\001#\206\365q\326R%8K\322?\237y\301\361\n\013\343B\202\365P\0201\363\303\314L\031\366#;\362\006\211\022,\254\363\221\377\342e#\231\352\366h\315\b\2025\336\027\350\314cC\317EN\3005.\326\260\356!\"\246\315\034\321\201F\354\317A\262\220\214\304\347\231=!`\362\220\340\22736\326\260>\216\221T'/\320\371\265\260\016;k\276<\225\001\311`)\262\262\226`\235\301\250n\027\017\226Z\231\026\326\331\307\320\363\017\021\200\350@\202u\356Aw&\367\265\226y\344\0358eu\3073\311\344\336;hg\310\262\312G\326\221m\360\211qr\302\372 j"
+	.ascii	"AB\241\021\304o\206\220e\266\221\261v\230-\311\304(C\312P1$w"
+	.ascii	"e\034\371F\316\221\2752W\376\272\312l#k=o\335/P\331F\316\272"
+	.ascii	"Nx\216\311m\245B\032\221%\252$\343\002\316G\363\334\237\3638"
+	.ascii	"+\322\007\377\322\007\365\322\007\351\322\007\331\322\007\227"
+	.ascii	"\244\017\212\245\017\346H\377\f\343\312l2\207\344\210u\276\262"
+	.ascii	"\312U7\331e\366F\352\271\352\317,r\213Lu\2732\\\025d\246\330"
+	.ascii	"`\235]\344\027W\251!O\365\371x\272\302\372\301\032\251\t\366"
+	.ascii	"\276\032\316\033\030x5\234\270\353\002\235\032\334\2373\257\030"
+	.ascii	"z\226\342\2712Sc\303\372B\216\322\200\222\301\341\340\201\365"
+	.ascii	"\237U\004\246\301\r\251\303\372\227\f\016\304d\322\025j8\226"
+	.ascii	"s\370\016l\211\317\330X\276\341)+\362\302\360\340p\226\035@\226"
+	.ascii	"m\262S\336\371\t\277\301n2\024f\223\217\030\360*q vr\374\207"
+	.ascii	"\327<\b\007b4XMN\263J\331\324\270\360\021\017\357\335\272,\237"
+	.ascii	"\r\245\366C\f\246R\341\343z\t\304R\316\027B\224U0*/\3102\020"
+	.ascii	"\227\3319\357F\224\225 m\267\237\200T\240\365\276@\347\223\367"
+	.ascii	"\347\364\303ix\200 \311ta\375\340\013\277\240\023"
+	.string	"\356\353!s\203\307\034\326O\321\244\330\3145\223\256\235|\234\301\345\r\353\247w\351S\271\364\351\232\033\036\323\246\353^<1\222>\375\241\207\303\200\321I\253k\023\210\365\323\031z`p\260\264\210\223\372r\f\346\312\361"
+	.ascii	"v=\301\372~8\357\177\360\276\315\035\177`\375\204'L\235\034\025"
+	.ascii	"\326O\243\260]\035\216\231\036^aX\037\355K\275\324\361\\\265"
+	.ascii	"\355\275i9"
+	.string	"\256;]\272\266Ff\nkL\2071\027\334\345\230\016o\271\007!\256\003\205\351\364\336\307{3\340\2717\0033.\310\261\311\251\217\216I\357\227\335\340\370\312\260>\252%\013\306r\263\310\226\344\300\032_\301P0\354V`}t-\375\357w\225X\016\307\3511r\201n\260\306Tp\225\253\354\200\255\004\241\222[\271w\262G\3478C\212\027\254\217\242\245\277\035\316\236\300\300\300\300\333\341<:d\312ur\322P\321\246\r\353\243_\351\321\032\351\217\243\270i(\313\267@\254\177\225\330\r\267\275i\301\303b;ns\242\263w\222\275\367\0059k\316\270\b\303\032\007hj`\375\243RG\251\216\276\360 \004:\325\003\257m\t:\225\353H8\262%\006k\324\305y\262\270PYb}\224\005\332\342\017\342\214\355P\222a}\f\306\322\037\200\311\214\253+\254\321\025\331\356\314c\302\305\r\205:\252\342\017\346,\211\213\272\303\372\030"
+	.string	"I\321\343\321\247?xyP\325\331a}\fx\244?\352\364\007u\314\204\315"
+	.string	"\303\372\030\344H\217\201\326\2325'\340e\262\253\356\023,6Z\177:N\246\220\211y\363\023\220\314\355a\267\334\302\372ds\272\371\0374\333T!r\345\246\315T\216*UC&:\214\264A\203\346T\023\224n%wX\226{gu\330\251\242\304n\315\231\346\247\232\267\034z5z`}\366HI\323\003\302W\246\314\331w\225\323\203\353\013\225\231\237}dz\312"
+	.string	"\333d`}.\273\360\361a\271'w)\21513\026X?"
+	.string	"X\362\236w\212\271Lv\325\005gb_\222\374\001\206\321\262\367~\212\371\233\232\233\035c\260>\277\234at\260r\374\275\235aN=\261 T4\330\370\235\221y:\301d?>\2522n\376fD\212\031\033\224\272\272\363\356\204\362t&\211\356\301F\311\036\326\347\335i\267\246F\327\233\323\313p\307\023+X?"
+	.string	";\322\007\340\006\035\235.\273>\311\247;.\310\275\263:\344taS\023\202\365\003p\334\262E\227\005\235\335\225\311:\341\214\213:6,X\3169\0239\310x\356x\264p\221\345\347\\\317\223\221\260(Qv\312\370\362j\224Y\261r\016}\355\245)\333;\253\203\016\032\033;%g\334O\271\035?\265\272%\310\377\301\223\256\312\r\033\254\017\200\026\351\377\237nn'\225\313dWa8;\003f\311\337\336Y\035p\240j\230\271q\302\375\244\3628\224H\030\247 X\237S\236\273\234\274\325\300\372|{\234V\017\2546\254O)\217K\333@A\303\303\372\214\3628-t_8\036'\003\356\214\013\326\277"
+	.string	"/\375\317'\347\223\223\315\204}\204\361\001\231X\260\212\t\020@\254O((\031\216\2756\254\177\301\224s\355\202%\351\177\252\235j\372\254\203\317\206\312Kr\256y2\206\206\365/\270\241\344g\023%\247\031\212(\234\036_n\226\333\212\313C\016\033\034,\326\260>\323N&g\362D;\227l\bL\377\363\354<\323VL\360\331{\307\226)\333*\313C\316\337\216\2668\254\277aK\372kv\317\026?\263\316\032\247\326U\236-N\263\241\247}t\353"
+	.ascii	"\316\313N\0161\033e\260"
+	.string	".C\217`\276d\301\372\033\336\322\255\323\306\230\345\r1K\257S\307\255\363\341\200#]p\234\\\027<I\231\220d\357\024;y\234B\244\374-O\2613\207\336\330Iv\0369\213\234\310\223\310i\344*O\261s\307\317\032\247\326\203\240\374C\247\330\331\025f\331\203\346\354\t\r\037\275u\276\013\236\244LXBfy\0069\207\\\345)\344A\311}\n9{\234a\267.+\271a\344D9s\226F\003\007;}xz[\247\376\317\260\023\210[\262\307\031\254O\260,\032ZT`\375\rC\322\377\364q\225\347\217\324\257\f\256\r\326\367;\337\025\260\257\260\364\033x\244\337P\343\374J\363\2266\350\260\376\006\254\364\033\252\322o\220J\277\341)\275\005m\322[\220&\375O\033'\227r\016\r\035\027\276\343\362\342\t\353[\320\227\342\344\005:;\334\237\363\214q\3168i\374\301\036$Sx\264a}\013\366\322\2372\376\007Q"
+	.ascii	"\353\322\206\265\276\217;O\030?\261\376 \3262\0049\205\365-\310"
+	.ascii	"K\177Z\235W\177\220GO\b\2244\254o\001\227\364gU[ \232\032X\237"
+	.ascii	"Ti\224\005o\033\340\330\220\202c\353|\361\223\352?\247\256^\256"
+	.ascii	"\023A\340\0335X\357\334\237\363t1\364\363\005\235\334\022\rk"
+	.ascii	"\235\373s\336\202 \351=\334s\205T\336\253;\333\262\264\200+\275"
+	.ascii	"\005,\322k1\367\204:\237N\025\270\310\231\026\r~\3515t9\367\271"
+	.ascii	"\317#\232\263,8A\240\370\334N\247\237\307\274\227F\t\247"
+	.string	"\024\363?\270\303DN\307\013\254\257\341-5\001M@\223,\2707j\226F&\255\315\306\0227n6YN\221:*d\260\276\206 &\033\223\215\211\205\345lj)\305+F\036\326\327\300\225\252Qc\376\005\367\316\202D\341\326\254\370\033S\242\306\t\326\327pe\2421\321\230~xfnK\263\005\231'<?\2710WeJ\260\276\206\243\0313f\337\257\325Q\013\245\341\304c\005/0\013k\263/\210\215Y\246L\020\230\275=\223/5\223\003\275\272rC\317\034s\223/\003N\306\372\2606\305\3408\236\027^Tnd\001\243w\235p8\372l\250)(\310\267\364AML<\263\316\314\273N\322=%u\021dm\031t\226>H,\275\207kz\2513\355\362\236\336k\373\210\225A\226\034{Z\177A^\351\203\254\314-\346\026\263K\210+&\335\315.;:\356\2204\2606\271`:\253\255,0\366\376\007q\214\350"
+	.ascii	"R\004\353\0079\245\307T\256\231\245\2129\327A\357\265\021dT\310"
+	.ascii	"7\3513\250\221\253b^\311w>G\257\035,B\366b\231\241L\372\fyoU"
+	.ascii	"L+dS\031\262L\231bR\321A\326bi\302\335\244\202\302\210\223R#"
+	.ascii	"\303\223\364\031\314\322(Q"
+	.string	"t\033#e\234L\221\222\304\372\031\200\244jjf\333\335\373\324\222\215\240)\031\302v\263\355o\313\355\f\326&\224l\367\367\327%\n\326\3673\327\376\007Q%O\220x\231k\346\223,\274)D\362\234F\306\221q1\235`\256.=4zX?\303Vj61\233x\251 \020\r\315LK\273\\\355i\225\355,\256\016\301$\226\264\256\344\315\264\n\366L%\246\022]&\006\020)\005e\007\205\365+\2103\317\3143]\306\20061\313\235\305\325A\007\316u)\321\314\314\356\231\227'(\252;\254_\001\217#GL2\023\200\316R\354\3758\2035\231\330\330\327\013\254_\201\220\2534\205\230EL\350\3321:(I#K\323S\246e\313\322$r\263\310o\0161\221\346\030Fi\200\t\222\005\353+_\376\312\224X\233bC7\211\344\264iy3\004\353\237\373sb\330\027\350\304\311\373s\036\210/\375\31503,#\315"
+	.ascii	"\311\201\201\351\262\023\300\355i\225\361\255\345\001\275\231"
+	.ascii	">L\037qW\250\330\225%\026\254\017\004\226\336\324qM\036"
+	.ascii	"&\217L\205\223\333\n\204\330\236V\231Wj\002\300\233\251\316{"
+	.ascii	"\270\246\227\311e~=\356n\030\373\262\3502\033\263\334V\333\303"
+	.ascii	"\201\266\322\003\301H\177\023\207\311ev\345#\016`!\245\315\366"
+	.ascii	"\220@+\322c`cf\375\036\2040\271L\033W\356\356\250\335\002\322"
+	.ascii	"L\314\022\203\230\032\257anq\200\332;j\267\320e\246\267\324\272"
+	.ascii	"\271\225\2514\200\362\003\016\203\\z\fjf\225\031\303\2542g\230"
+	.ascii	"2n\316(3\245\307\030*$\2320'\254\255\254L,37\310\236\267\032"
+	.ascii	"pO&\214\233X=g\222\360!\2616\2572\225\211\244\006\r>\fH\322c"
+	.ascii	"\360aJ\231/L)s\312\2342Y\230,L\027\350\025\334\236\326\237\316"
+	.ascii	"\016\2650\247\0267]\360$\211[\256\301`#=\006\027\251\031eF\215"
+	.ascii	"\245\375\2501\267\ten\363\311t2\235\314'\021\310\224 wVV\207"
+	.ascii	"t\307\0261,\254\177\363x\225\346\223yF\345gL\372\23795\332\215"
+	.ascii	"\032\r\250\0013\027\260\261\353\004m,\213\007\326\177\177\272"
+	.ascii	"M\232\363\214\027\2359\260\026`\330\\\267\031\242\007\206\207"
+	.ascii	"\265^s\235\374\017\362\2449\211\345a}\277L\346\1770x\306\257"
+	.ascii	"\315\031\326\377\241\222\376\247I\352\347w\345\202\266S\037\007"
+	.ascii	"\264\034F\322k3W\2379\223\221\327*e\373\302\322\225\376f\344"
+	.ascii	"yM\346\352\345\362\312u\200\262=eY\302H\177\257\334y-\346j>>"
+	.ascii	"\034g\302>\302\320\300\354\307)\375\305q\347\336\036\031\034"
+	.ascii	"\005zxZ\017O\203\311\313\323`\356\266\362;\253\230\351\261R\366"
+	.ascii	"\244\366\345\032L\020p\013\231\026Q\034\330\037\326\247\240I"
+	.ascii	"z\nh\244\277\266\273Jm\227\305:\234\301=\361\303\241\005\353"
+	.ascii	"S\360TWw\305GG\227\301nBm\035e\310\275\263<\354\210!Q{\302\372"
+	.ascii	"\027\300\244\277\336\262\345"
+	.string	"\312]&\273\ng\005\f!H\376\366\306\342A\277)\363\345\007\326\277\320$=\336r\365\334\034\246\273\311]\225\200\034{Ze\310\364\230\356j,X0]\320v2\323\201\231\323\005\034rrdp>o\252T\321V\356\325\336G\033\034\340\274\340\260x\001\205\246\255p\371@\231\025\310/X\337\007Kz\225\032NSu\350\332X\032\\I#\2624\327\254\b<*[dJ\201%\352\020[&\324\003\020KIE&\220\221(\\[\326\250T\024\fZJ*\n\006\245G\022:2\022\327\226\375\240\016\231\212EF\342\207\225e\372PA\261\310d4*\031Q\026\224V\244V\311\210\032\t\325\242VW\246%\275\"\025\255-{\036Ih\211M\372\320\264bh\211F\022K\354\tMk\320H\024B\240%\032I\354\260Jk\0211\351\3449\222\220\232Dl?\260\253\232\202\270\016[\"\366\004\226X,\022\223\316\rG\022\372"
+	.ascii	"\200\241Z$\n\215\0240\322@\202\005H\234\0201\002\021\t#(p\002"
+	.ascii	"\221\210\022D&H\\8\222\320\207\242\241ZD!4\222\300\222PW\246"
+	.ascii	"V\250\032\371\034I\210Ej\205I\026\340\250D?\305\013\030\004\240"
+	.ascii	"\205%%\021\002h\217$t\264\364\341h\251\310\310\224c4\302&Kt\264"
+	.ascii	"\244\323\022\031\217\226L\343\321RFj\217\214j\361TE@d5\313\252"
+	.ascii	"\353p(D[XR*\322k\273\224\207\252\361\210X\024\242C\225e\322F"
+	.ascii	"%b[\244\262\350W\242\243%\241\235\026\326\226%\036\251%2\360"
+	.ascii	"\351@\210U\301\210\202\237!!\226I\211\230B]\227\200z\206\352"
+	.ascii	"\312tD42\226`\211>\255\n\201\246\325'\t\205\317\021NkT\213V5"
+	.ascii	"\005\"\313\036\241\352\252d\244>\200\202\025\212T$\021M\353N"
+	.ascii	"0\004\241$&\023\t\020Jb2Ad\3315\310\323\301\220\220\272^\340"
+	.ascii	"Ibbs\b\241$&\326DA\020b\2039D\226E\200\020\273\263\303\226P\331"
+	.ascii	"U\270\324\323\302*$\026\211ML\302\rm\221\272\022G\264\320\022"
+	.ascii	"\213B\246\n\254`$N\240UY5\211\211UW\fIK)$\261\220\002\220\272"
+	.ascii	"\216\320\264\006\035\031\211,\211\246\365G\003V"
+	.string	"\205\026\204EuD\223\360\004U5V\320\022\215$\232\326\223]\231\212\305\0214X\321\323\003\241$\024\303$&6\305\001!\224\204b\310\352\360\260I(F\020Y\026\303\007BI(\206\254O\022\212\021I(F\\`U \262l\211%\366\204\226\025\026\177\226\330\023p\226\330\023.\240D\226-\321\252,O\321\272S$\266F\025J\f\215\352\022\313\304b`\325\342R\222\320DS\211%\342\n\354\016\253B;B\333\244\242\320\264\372\f\325\225\310\024\002\265\304\221\221(l\205#\232\326 \rT\030\032\325VXd**\n\213<\244\300\026\231R\030\022\213\302\024F\022E\353\317\220X\024Z\240\204\246\025\310<\222\320\021\023\nu\370aX$2\241P\207J'\004\325\241\322\tF\022,\211\246\225\202\241\232\202\250\026\251%\232V\237\225I\211\230B\210\244>\200e\225&P\024\032\217\210&\206\306\021\332\"\265U\207\031h"
+	.string	"\304\323\201P\273\n\227\204T\246\242\320\002E\242\320\250\251D\253\036\001\021Yv\3258\302V8\242h=O\270@\n$L\230(\241\266\302\341\022\323NkdR\022\301\303\202\260D\321j\266 \\\327\0212`\325#\243p\004v(TW\rF\245V\2702\225h\241\270\264$\304\240Xd2\372\024\213L\306\036\021%\212E&\343\016+"
+	.string	"\226\310XB\253\262j\211\243%\f^D\\U\243z\224\376\003\020\016"
+	.string	"B\bM\350CP@\007\n\350\340|\b\n\030\032R"
+	.string	"\bC\351A\030\312-\273\252m\253N\240h\3659\322\221\221:,B!\f\001\001 \204\370"
+	.ascii	"\204\007C'J\2200\002P\222\332\262-\230\350YW\022x\316\323\036"
+	.ascii	"I\310\350\203Q))I\251h\303\n\227%Z\325\266H,a\250]\312Q[a\313"
+	.ascii	"\232\255J\244\026\255LJ&Z\"a[TG\250I\3046g\025\"\025\351\266"
+	.ascii	"U:1TW0\022\213)KdT\"\266\304\241QI\204Q\211\230\244A%\032\222"
+	.ascii	"hRB\201\016I\250C\245\244\263I\035\032I0\t{\332#\t\261\352P)"
+	.ascii	"I\303\222\332\232\030\032U\224%*\342YR[\023\355*l\331\240zd\024"
+	.ascii	"\256\246J\224SD<R\232\200:TJ\n\266D\036\200@\022b\213JkkT*\""
+	.ascii	"*Z?\024\031]0\002D\213tD,\032\371\260\240T\344A:\"\"\365\fA\024"
+	.ascii	"\205k\313\244\032\203j\261m\225V\244\226h\bbh\024\242\030\n\325"
+	.ascii	"\341\017\013J\305\034\244#\"\022\321\020DKL\"\026u\206 \324\241"
+	.ascii	"R\022\321PE*j\211,\260=hK\204\243.\265p\002\003%L\350\244\340"
+	.ascii	"\323\032\231\212t\324VX\002\211UW#\265D\323\272\263\266)\030"
+	.ascii	"K\020\266\302\021,\bK\f\205j\211\2425gmS\240\300X\002\313\324"
+	.ascii	"\n[\023k\233\302OQI\351\001D\246\261\004\226U\213\224\326\024"
+	.ascii	"\212V\237V\205@\321JAK\324\246\306\022X\025\324$\342\t5I\270"
+	.ascii	"\226P\264\366\b[\341\210\034a+\034\021d\211\324V\330\232P\223"
+	.ascii	"\210\255\221\251D\323\352s\264\324\264\342,\t\223\212VsU\207"
+	.ascii	"\304\024J\353\322PmZ\213B\342\252\262\027\232\324\342\022\323"
+	.ascii	"\b\243\242\020\tG\035\022\327UM\241Dd$rh\211\320#\341\t%\"\321"
+	.ascii	"\021Sq)\350B\253\262\352:4\022Q\020\265B\226(\211imWP\227\330"
+	.ascii	"\r:jQX\204"
+	.ascii	"\323\256j\n#\261h\035\022\223L#1)]\241HE*j\022&\245=lQ\230\302"
+	.ascii	"\250Dl\205E\245\245Um\215$\212\326\f\254\252\256G\352\b\265x"
+	.ascii	"d\034!I(\"\305\222\021\005\303\242\022\022\253\256H'\324V\230"
+	.ascii	"\202\330\026\215\240\016\225NX\211\302 #\261He\231\210\232\204"
+	.ascii	"IDMkN\021Q\023\223\220\250I\230\324\303\256J\353\252\002\235"
+	.ascii	"\255\312\032\031)\345\250K-\264\0274\030\031)\265LE\001`\211"
+	.ascii	"MB\242#&\024\352\260eZ2\0223\250K-\264Dj\nb+LA\\\325\341\005"
+	.ascii	"\253R[$4\"Rj\231\204DGF\"R\253\244\224\304\022\025\255AC%\342"
+	.ascii	"\252.\021\031-\025\211\324$\341jDT\264\262DD\226]5\f\211D-\321"
+	.ascii	"\310\264\343A\261ie{ZVhD4d\022\242 b\231P\260<\253\221%jZ\211"
+	.ascii	"T\226\211\310\210]\213z\332%\265e\265j$d\213Da\tM\253\206\226"
+	.ascii	"(\204\326HdB\325\241R\222n\217\364s\245%u\375\320*)\255\037r"
+	.ascii	"\232\204I\231%:\"\032\031\225D\250GFa\211\242j4\n\221D4\255\025"
+	.ascii	"\264D \f\265F\"S\372\241!\021\034T@\001\002i\221P\323\372\241"
+	.ascii	"i\375`$\n\223>\024\255\354\007!\n\214\304\244\374\037-s\212\351"
+	.ascii	"q\313Q\225G\206\nM\232)\201\360\241c\204"
+	.string	"|\t\362\025\305\243\315\237\030t\317d\242\003\357+\207/l\331\002k<<T\317\207\001\256\244\021Y\352\201\301X\312,<\300|9\305\264E\351\221\247\247\202J\304\266Y^\3262\311P\331\022\303\372\031\254HQ\257#^0\354\260\234\236\0163\027I\342\250\352\314\031\267L\337\024[\227\035bR\316\260\326OsX\\\\\314\251-\346\023\317\337\\\036\013-\032\320\214ks\3621\307\002G\006UV\231,(\025\252\303-\252\013\026\r&\315\301\203\r\324\025]V\303\307\227\3349g\006I\23204NG\351;\023f\t\326(\034\n\207V\tn\2533\034\2708\241T\216V9\313\264\200\001\206\003\233\224\215\r}\033\202j\275\340\001\350v\364M\n\224,(h\224\373\343\212\323\017\254\317\341J\212\266e\344\235\326\036\030\016p\351\217B1Bc\231\005\006k4G\t[XU\224J\324I\237\002\356\330\250\035u\242\211"
+	.ascii	"\002\306!\317\232\234T\266b\300\320\241D\t\232\326g\200+U\300"
+	.ascii	",I\036M\213\213\032\203\306\016k\024\r]\"\226\376h\022\375V\200"
+	.ascii	"\025/\246`\215\036A\217\240H\256\225\325\231\001<\211\211\262"
+	.ascii	"\362\207\222\035E\202\232)\275XdA\315\320\262 \223\0279\220$"
+	.ascii	"\177l9\323\306!\313\b\216\313\331\302\304\215\\\021\263\313\\"
+	.ascii	"\030\235\033\326\350\020t\bJ$\350\304#\346.\320\215\330Q\"={"
+	.ascii	"=\342\346\260F\221\330\0160\210\032\f\320\244?*D\267\271-\320"
+	.ascii	"P\231\0059\373\264\335\2316ya\247\032t\354X\026\b$\223\371aw"
+	.ascii	"%\020\354\004D\213b\342\2075N\342\004&\004\353$O\020\252\037"
+	.ascii	"6z\230Er\002\201\240i\302\343\274\313Z\336\214\220\355\310\310"
+	.ascii	"\024\n\231:\027:\264\020<\260\2644\350\227\006\343RF\213\230"
+	.ascii	"\227\326\2216\246\264\303\272\252\nHW\327)\247\327\265\343\005"
+	.ascii	"\3265j\2407\312:@\265\216\336@m\\\241\365YAm\240\\ZO\216\260"
+	.ascii	"]\271;\256\254\200\201ne)Vj\260\3620\320\202\306\370c\2404N\301"
+	.ascii	"\221\353\003\261\245\032,(\rtF\222\260\255-t\006*\343$#\363"
+	.string	"r\027\304d\354\006\326\307\200J\372\243X\332J\017\221\247%[P\030\332F\0133!UWg)$a\203\262\272\236\221\245b-\355\350>\032\365_%\272Q\252<&\335N\311\235\325\345d&\2047b\332\244\371\333RY\035Pe\233\206\274\250\303\321\363zX*\346 %\225Qf\210fh\223\f\007\263\025@@@D\034\024\312\306\311}\023@CK\313\265y\036\007\231bfhDD\222\224\224\221\312tH\350\003^\356\220\206;r[h\360G2Zk\345\376\243DRA\222e\2479t\361df<\"\034BK\312/Z\304\215nNR\177\226\221G\034G(\314\202i\303\021\347F\357\371\344\307_&X\0036S\200\247\020k'G\fr\255\311-\207\022g\030S$0\243[J\222\374\266;aW\020\013\034\217\332G\204\377A8CJ\033\324\021eX\363\303\224NfE\311\363/g\325\365y\352\337zL"
+	.ascii	"\023_\300\200a\363\213\266y\371r\205\343Yf\336\216x\201\254h"
+	.ascii	"[_\265\\F{\2455\204\272\247F\237\347\331\214IQ\266\2538m\224"
+	.ascii	"\306q\261\034\037;\026z1\r\337\2347\257\n\240\f\016\232\t$\315"
+	.ascii	"\313\332\323\227&%\234v\\;\277\376\026\260\320\2414\254\205j"
+	.ascii	"\322\327\354@\025\024\025\224\274\022\235\330~\f,\220;9\323\214"
+	.ascii	"I\343H\205\364o67\362p%\212\262\301J\335\364\345J\306\031iX0"
+	.ascii	"\224d\304$\350\313`|\321\024t\260|\276d$\030e%=\226\026\224\r"
+	.ascii	"_\226R\017\361\356\211\341*\331\222 \350\t\247\371B\203\323\275"
+	.ascii	"\347}\303\362e8a\f`S8\302\004\217"
+	.string	"\022\002\200\362\226JMp\337c\314\255z8\352\320\354+\302\311<S\rx'\234\343 }\264t3\360\251\2211\305\364(\377\265#e\212UIr\204\241\005\264{\370\023A\247\213U\257G\271\326\340Z\331!\374\335\301\253,t\373\336O\206$Vv\n\227\007\272\nZo)\006\017\024\346\033\004\0030U\254TY\244\374\001\332ei:\211Z\203\2628\275[\250B4TZ\346\306S`\253\245Sm\346\375\033\213\030\226\f\247\222g\324B\024\270\271\204Py\004>\216\203\337\224\tr\n\371UP\326\212\317\376\0372\2213;\206\243\371\220\336Y\r\033?+M<RM\267&\351\271_\022\3168\215\0245\023\231\302\020+\247\023Kd\316lY-\363\353g\306d\227\035\356\270I1:\364X\322\224\364f\247{\213\312\334\301\r\fE[\304\303\003\351@\016+\314\225wg\375\3005\2033\322\302@\240\315q\272\nE"
+	.string	"\027\207.\007+\017\0173\257hu\271\251Su\344>\271e\3263\307>.\"\031\213\t\360x[G ;\016\206wF\366\020\355\341\202\351\300\226u\230\315_\313lx\347?\223\262\240Xd\274\320\016\354\244\324t\022\023\214;1\006e\376GkX)\224\364\260\305\243\264\243\357\177\3557[\027\376k|\332\271\227\022\007uFlwL\344\367Dn\332\376\236\272\002F\207\307\362v\366\272\366Q\227\0266\366\202\276pVi<K\030TM\351j\212\241\226Z\250"
+	.string	"\204\276\024\366\227\312"
+	.string	"\301\360_C5\223\017\320r<=\364\026sP&\215t#\032\323\346\344\213\177\243\273p\221J\225\300\314\220\200\0178q}\333\202}\371\"\227+\316\027\235o\327o,\b\255\306a*\215\224g\265\243\334p\020n\261\257\222\032B6\017`\321\273\236\301\224y\375D!\300<\004\r\352\264F\"\" \355v&\226\231 \373B\257%\361H\272\236\330T\303\323B/\342\016&\203\034H\205\352\270\336\177('dn\020'\227\036j&\365\004\013\240\324\363B\004\267\330YJ\373"
+	.ascii	"+uc\245\303\225\213\177\206\276\346v+\013\351\225\246\327-~\311"
+	.ascii	"s\351\244\031\364\013\323\256Q`>F%8\006bj\201J\351A\201\206\324"
+	.ascii	"\213|\306"
+	.ascii	"Gs$\264P\267\263\244k`\267\215\271W\217\t\350\001S\021>HN\017"
+	.ascii	"\017y\275\372|\006\372B\r#_\314eZ\200g\256\331\356{\201\221\367"
+	.ascii	"\2505\236\016I\315\263\2517\f>q\202@Y\343\030\224Ec\b<\237\361"
+	.ascii	"\314\1772\007'?6\234\343\356G:u\327\365\236V\353\263Z \b\376"
+	.ascii	"-\0365sj\226a`uC\022lEQl\2551>_\016\276\207\007\241\213\274("
+	.ascii	"\314\231\030\306\301\220\262\270\222\235\272\305\244N?b\302\257"
+	.ascii	"J\235M\216\004\274\252a\340\333D\214\224\364H\322\215\013g\210"
+	.ascii	"g\361uN\003p%"
+	.string	".\216C0x\303\004\t\302\203\303\351\250o\260\"\253>\230\212gT\272m\034V\004\303DHI}]\307q\030\347\345\304\325%\231\240\024\317\020\277\2168\360\256>\313\251\230\302\346Q\001Q\203\231\3728\201Y*\007\177o\301V\203qP2K\345K\3458r\351\230\231KtS\265\334\316G\362:\206\017uB\213\007\3145\355\355\323)\333\007\205Y\245\344\003\352}L\240\324:\377[\254\025\223\326\346\007=\340YMn9\223\f\277\3414\307\035\300\361\261JO\241\273Z\366\321\226\3752\264\334\265\203m\b\256\346\377\300\232Ybi\301\357\2629\35164r9\313\371)%\226g\310\247\206\330\271\370R\314HHa\221\334\026=w\335\355\017\361\b\300]\345PQ*j}\004\215|\021\313T\330O\272U\214\030\260}B\256\\v7~\372\342\360\353D\374P=Ro\351\251\027\352!\355#\001[B\013[\315M7"
+	.string	"l\370\330A\314h\325=\352\211L\234\241\023\034>\247x\313:r\243\307\357\243\202\247\200\333\024$2\337\322r\205\177\353R\253\353w\344^H9o\366\025$\311\006O|x\177\230\fl~\037\346\357\354\264\031k\013\004\006\300\255\r\202\204&\251\306y\375c\204\312\027z\b\321=2\274\223\255\224*\244V\272\314\362Y\311TJ\251V\017r6\2306\033\304\313\026\032Y\nZ\324\377\301\327\312\016a\342\273\274\031L\345\210\030\005h\337cZ\177@\256\200\360\022q\313o\345)\3370\225L\315Z"
+	.string	"\022_1\241\002\260+\020\275\027;\307\226\212\321\272\234\240z\034\312>\311\274a\337s\353\033+WJ=\220@\257r\244\230\221\177H:\207\370lv\311a\277\221'\013\242\312\3006\242z\207\276\255]5\231"
+	.string	"S\340\337a\227\205e\200\207\343\005\316\221t\210\252\226\370\353\221\n\223\315\351H\034?\331\232\311$3\220U.\232"
+	.string	"\277\237\211\353\214\177\207\347\261\326\350K\245j\016\352YYu\024T\345\3665_\271\234\002\004\221\277'\377H\271\2625\376\001?P\362\352fSP\341\t\n^\276\312\236s\022\022D>h\202\202nj\031!2[\023\017\240\267\3257\323\356\327]\262\fh\311\342\317,]\357\342\372\025\036L\034\"\203"
+	.ascii	"\224'\2624\225\022y\243\367\320\004 \300oD\334\266\364\340\303"
+	.ascii	"b*\203\235\314\305z\031&\206f\371\355O\312\356\025 \231\216\314"
+	.ascii	"\017(\376@V\360\035Fa\252\207.-8l\311L\3378sx\246_\333\r,\372"
+	.ascii	"\362\332\362V\203\371\303D\245\342\247\232\320E\261\257\213\374"
+	.ascii	"Cy5\373\257Ulh\tg\254\023\272\372\344g\2600\370\034\355'?\375"
+	.ascii	"k\177\003\241\353\275\b\353N@\023\303\210\340\340\303\304\350"
+	.ascii	"\242\006\301(8D@\t*+\232\260\253\237x\236\025\337\3546D\032\302"
+	.ascii	"\004\230h\b\314I;\253\215\245n\335\210\333\331i\036(\007\302"
+	.ascii	"[0j{m\244V\251f\361\2376-\355*\361V\032m\005D\330i\bp\223V\035"
+	.ascii	"\242&\301\320&V\241\035\020[\344\362z2\020\313a\004\217F\243"
+	.ascii	"\213\324\333\\\264\235|\237\006&&\341\342\313\340\031F\377\273"
+	.ascii	"\302$o\013\036\207\341Sm\314\344 \251\250\225O\351\322\033\r"
+	.ascii	"\273\037\315\2328$Z\025\214\255z\215$\013Y\030\326\373\256\034"
+	.ascii	"\227`x\237\222\021\222\343\272\365\345\376\035a\221uj\346,\324"
+	.ascii	"\2704\366E*\270\201\354\350\362\204\332\206\374\267\352\335\357"
+	.ascii	"CL\220\006\202\347\366\250\177\375X\223\216\3019\314Bd\266\361"
+	.ascii	"\373,f\201\034`\004\025\002\371\024\205\"HeqAF\376%BB<!\217\216"
+	.ascii	"\353\273\343\347\367\231\334\022\344\350\r\202\267\360\027\226"
+	.ascii	"e9$\021\216\023\t\343\262\343\362\021}[\223.\377\242#}D\336\025"
+	.ascii	"\r2"
+	.string	"\255\312wH`V>\213\005\241\341\303Ic\261/\356+\236\300\254rZ\026\373F\t\250`\273\261\214\360\242\302\204&\355g5\306\r\005>\335\004\342\307\374\333ir\362\241#>\330!\353Q*b'[Sx\034\340W\215\230\n\275\214V\215\301\300\022\267\222\214b\021\257\013\033\r\033\026\246\214U/a\025\034T\260t\035\247{\356Q\234p\021J\322\340\021\234\301\022).\b\270C\267|X\372\320\314\222\303\241y5\342\3651\231\251%s1\210*\264\276\226\362\252\t\370\332\355wU\030?\216,9!\254J\022\264y\200|-\273z\"\225i\223O\353\323\263M\302\313\203R\322\377!\003w\223-\027\027P\bj\313\371\374e\203,`d\303\302x\301J\373\370\367\373Nz\312\377A\206\267\302\276oN\247\204g'R\213HE\002\207\024g\200aG\300\271\276\324A\332M\260\305\351*\205\344\215e\324\311\243Z\374"
+	.string	"\330\340=\370\351n\251t\324\300\341\013\240\301\255\f*\006?.[\322~\030\356\353m\003\311t\003\034\222\277\237\330R\031\03402\211@>3\270w\302X\253[\341i\351\245.\255\216\275\300\316Ey]|\005)\240\025T\233\210\361\004\3066\036\203\006\332&U\331z\346\025R\243\002\004\275\372\005\t\315E\r\360\005\343\212\323/\020L\177\001\2042s\375\346\033\022\301\346\377 \021\177<Ixt\201\367\r5t\353?\3165\321\223UN>&\312Fu\220s\312\255\303\211\223Ra\307\203\260\332\305\235/\340\256\217I\030\031\213\036\344\246FHA\343\305t\261\240n\032K"
+	.ascii	"\360o\"\356<\204+9\236$\013\227\314\300\244jw!\323C\313\304\336"
+	.ascii	"\270)\214\326\032S`\350\005\370K.\032\225\304\344\030\302|X\343"
+	.ascii	"s\005@\217\003\220\320\0208\356\237\274\025O\310\266\354\265"
+	.ascii	"\202Y\273a~0q\325\274\357\333\036\201,\231\003\363\370\336\307"
+	.ascii	"rQd(\251R\277\3667\200I\310\335d_\022\224\356\022K\364\201M\001"
+	.ascii	"cM\003\350\013&\370\340Y\223\002\002:\245\325/\002\221\037\365"
+	.ascii	"\210\253\312\220v\276-}\220\305\t|\220\216\260\210(\205f&G\202"
+	.ascii	"\240nS\022\240p\362\374)T\004O\234\001\217VD\357\t\235\033y\272"
+	.ascii	"J\017\205\021\021\250\226\262\360c\302o\310aL\ba\017\330 bd)"
+	.ascii	"\3359\027U\377\243\304\243d\341\261v\355l\220\376\353 \333\321"
+	.ascii	"\n\002\2472\240\223I\227\006\260\002=\225\371tH\367\212\013\372"
+	.ascii	"\312\272#(aO\266\n\272\361\363\232\t\036Q\257`\r\2140\036w\005"
+	.ascii	"T\334\326Y\305\327x\331vEZ\255\366\2123Y\363\351\277\321\003"
+	.ascii	"\036\003\255^\300\270\\\215\242\006\013\354=\035\364\341\253"
+	.ascii	"\332\206\250\304\217\301Q\255\216\022\354\223\205\236\021!\007"
+	.ascii	"\323\366P\356Y\367\360\273\237\203\352s\330\343\370\323K\357"
+	.ascii	"\260\360\0219%\300wP,a\2539\375E\374n\225\275yIC\030\373\027"
+	.ascii	"\375Z^\276\317>v\302\335\321\373\344\353\366\326\363\351\360"
+	.ascii	"=\213>9M.\365{\241z"
+	.ascii	"\265\264C\214\207\350\375:\320\003{m\325{\326\024\326\246\217"
+	.ascii	"N\360\215C\340\354)\233\347\3517\n\266\333\355\004c\314\331\327"
+	.ascii	"\275\371t\3467\240\235\007\226\366w\f\f\316\35033\276\356to\003"
+	.ascii	"\240\321\250/\204\276Bu_\334?\261\2732q\236C\371D?\272c\355'"
+	.ascii	"\215^\215\353\363\264\271\267\210s\375\305~CV\323\but\336\037"
+	.ascii	"\242\237\347\270\037+\223\300\300?\247\367\261\371`Is6\\\222"
+	.ascii	"\013\365}\321\331\370\317\315\302\372=\233F$?$\374\026a#\345"
+	.ascii	"1\250\373\t\307\245\246:\276\336\353\370-.\034/\252L.z\300\356"
+	.ascii	"\351\004X\227\364\374\362\017\367\330\360\r\234\346r\344\363"
+	.ascii	"\323[g0\240\322\337\374\327\031\356\t\375'u\300f\005\375!\354"
+	.ascii	"V\204k\213}!\372\213v\370\2447g\274k\363\263=\374\261df\024\267"
+	.ascii	"\242\344_\345\316\361w~\343\243=\217\307\320X\327\213\375\217"
+	.ascii	"\007vUD\332"
+	.string	"\356\231%\034W\215\027\210{\177\224\003\304\266\261\316\235\252\177\310\317K\220\033\251o\227\322w\264\316\274o?\325\304\247\366\316\0223\307\257\301\327\3468\241\3446\236\037\232M\372\270\371.\351\356\271\313vX\262\341d3\177\274b\322\374\263\241\343\t\376\231\300,}nJ\373\\;\341\346&R\366\221M\362\356\317M,\033\f\030\312\367\007\267\300\352\332\224Nd3\235\354\255m\275\356\230\360q\210i\346\357\367]\214e\232\254\236\036e\302\350e\3747\267\333s\274X'J\365\326\316\036H\276\341\362-\005z\352\316\345\343\252\203\024'\276o\021\362<*g$\216\360<>yF\356\002\207i\333\354{\361W\214\303\017\3413d\353\326\303\177V:s\366\366;\370v\201?\367\361\251h\323z\033L|Z\376\362\007\332\377\365\367\301\274u\237\231\267\037/\263\316n\321a\276\243V\356\020>\274\030\236a\370;g\302\327\301\017"
+	.ascii	"Z\035\201h;\314-\375\tWu\005"
+	.text
+	.section	.gnu.lto_.symtab.6817abb10635b1b8,"e",@progbits
+	.string	"pgResetFn_rxChannelRangeConfigs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\002"
+	.string	""
+	.string	"pgResetFn_rxFailsafeChannelConfigs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\002"
+	.string	""
+	.string	"rxRuntimeState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\001"
+	.string	""
+	.string	"rxChannelRangeConfigs_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\002"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\002"
+	.string	""
+	.string	"rssiSource"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\002"
+	.string	""
+	.string	"rxFailsafeChannelConfigs_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\002"
+	.string	""
+	.string	"rcInvalidPulsPeriod"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\002"
+	.string	""
+	.string	"resetAllRxChannelRangeConfigurations"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\002"
+	.string	""
+	.string	"rxInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\002"
+	.string	""
+	.string	"rxIsReceivingSignal"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\002"
+	.string	""
+	.string	"rxAreFlightChannelsValid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\002"
+	.string	""
+	.string	"suspendRxPwmPpmSignal"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\002"
+	.string	""
+	.string	"resumeRxPwmPpmSignal"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\002"
+	.string	""
+	.string	"setLinkQualityDirect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\002"
+	.string	""
+	.string	"calculateRxChannelsAndUpdateFailsafe"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\002"
+	.string	""
+	.string	"parseRcChannels"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\002"
+	.string	""
+	.string	"rcChannelLetters"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\002"
+	.string	""
+	.string	"setRssiDirect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\002"
+	.string	""
+	.string	"setRssi"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\002"
+	.string	""
+	.string	"rxUpdateCheck"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\002"
+	.string	""
+	.string	"setRssiMsp"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\002"
+	.string	""
+	.string	"updateRSSI"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\002"
+	.string	""
+	.string	"getRssi"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\002"
+	.string	""
+	.string	"getRssiPercent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\002"
+	.string	""
+	.string	"getRssiDbm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\002"
+	.string	""
+	.string	"setRssiDbm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\002"
+	.string	""
+	.string	"setRssiDbmDirect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\002"
+	.string	""
+	.string	"rxGetRefreshRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\002"
+	.string	""
+	.string	"isRssiConfigured"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\002"
+	.string	""
+	.string	"rxGetFrameDelta"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\003"
+	.string	""
+	.string	"rxFailsafeChannelConfigs_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\003"
+	.string	""
+	.string	"rxFailsafeChannelConfigs_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\003"
+	.string	""
+	.string	"rxChannelRangeConfigs_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\003"
+	.string	""
+	.string	"rxChannelRangeConfigs_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\003"
+	.string	""
+	.string	"linkQualitySource"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\003"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\002"
+	.string	""
+	.string	"flight3DConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\002"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\002"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\002"
+	.string	""
+	.string	"modeActivationConditions_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\002"
+	.string	""
+	.string	"scaleRange"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\003"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\003"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\003"
+	.string	""
+	.string	"failsafeOnValidDataFailed"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\003"
+	.string	""
+	.string	"failsafeOnValidDataReceived"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\003"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\003"
+	.string	""
+	.string	"pt1FilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\003"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\003"
+	.string	""
+	.string	"pt1FilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\003"
+	.string	""
+	.string	"pt1FilterGain"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\003"
+	.string	""
+	.string	"rxMspInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.6817abb10635b1b8,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
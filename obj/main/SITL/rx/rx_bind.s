@@ -0,0 +1,296 @@
+	.file	"rx_bind.c"
+	.section	.gnu.lto_.profile.25d4cf9bd3a9e882,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.25d4cf9bd3a9e882,"e",@progbits
+	.string	"(\265/\375 1u\001"
+	.string	"t\002%"
+	.string	"\004"
+	.string	"\314\207\332\246\017\002\002"
+	.string	"\002\001\002\372\266\366\312\016\002\002\002\002\001\003\363\240\215\235\004"
+	.string	"\004\307\253\231\017"
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.25d4cf9bd3a9e882,"e",@progbits
+	.string	"(\265/\375 .%\001"
+	.string	"\300\""
+	.string	"\004"
+	.string	"\001\003"
+	.string	"\001\002\001\003\001\002\003"
+	.string	"\003"
+	.string	"\002\004"
+	.string	"\003"
+	.string	"\002"
+	.string	"\004"
+	.ascii	"*1X\202\274\204\261\001,"
+	.text
+	.section	.gnu.lto_.inline.25d4cf9bd3a9e882,"e",@progbits
+	.string	"(\265/\375 \340\255\003"
+	.string	"\002\306\024 \220)\351\357\016\3043\354\255^Ob\231n\273\335\273\342h\335\016gff\324\016j\310!R\312\024\017\375\241\252\020\317\351\323\005\212@\177\3569d@$\tf\002\366\277<\340d\361x\320\234\r\277iUU\352_n\206T\026\346#\324\321\250P\230GG\002\f"
+	.string	"\237\202\003\265"
+	.ascii	"l\\\031\"\b\026\216he)\240\354\253\243\217 \027\313\001@\331"
+	.ascii	"\273\2016"
+	.text
+	.section	.gnu.lto_.jmpfuncs.25d4cf9bd3a9e882,"e",@progbits
+	.string	"(\265/\375 N\345\001"
+	.string	"\244\002B"
+	.string	"\004"
+	.string	"\001\001\003\177\002\003"
+	.string	"\002\002"
+	.string	""
+	.string	"\001\300\004\001"
+	.string	"\300\004\001\177"
+	.string	"\003"
+	.string	""
+	.string	"\002\002\001,"
+	.string	"\004+"
+	.string	"\300\004\001"
+	.string	""
+	.string	""
+	.string	"\006"
+	.ascii	"@D\315\303\234-\250)\330\312@\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.25d4cf9bd3a9e882,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"\230\004\002\230\004\003\230\004\004\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.25d4cf9bd3a9e882,"e",@progbits
+	.string	"(\265/\375 HU\001"
+	.string	"\310<"
+	.string	"\004"
+	.string	"\001\374\007"
+	.string	""
+	.string	""
+	.string	"\001\002\004"
+	.string	"\001\002\005\001"
+	.string	"\002"
+	.string	"\006\003\004"
+	.string	"\007"
+	.string	"\240\020\\"
+	.string	"{`\260\232\325\202"
+	.ascii	"6\320\006"
+	.text
+	.section	.gnu.lto_.lto.25d4cf9bd3a9e882,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_doRxBind.20.25d4cf9bd3a9e882,"e",@progbits
+	.string	"(\265/\375`\274"
+	.string	"\245\013"
+	.string	"\346\325O@ Q\224\016\237!z\2430O\021\301\224BDt\036c\004\371(\032\241\202\005EM\212\243\235m\237`\267\352\322Q\311v\351x#`"
+	.string	"\204\207\274p@2/\003\240\031\035`8k\021\331[\312\224\002>"
+	.string	";"
+	.string	">"
+	.string	"\223G\333F\220@d\355^\210\307\202\224\tE\311\256w\351\207k\207\232\232\017\240\333\016\005\\\341"
+	.string	"\030\035dX\035\t\0368\275\340\020\240+evdv\327\311u\033\356x\333\fl_\354;\b\"\257\270\3708\211\244F\371\331\336\226\nb\037\256zpu\324\0373\255N\247\246OQ\022\246\221\312\267\353\361\335X\222\310B\204m\221m\331\316<J\263\274\306\nT\213]\357\342\002\001QU\235\246\034\243\374fLBV\303~\254\001\312\210\022\032[\342x\b\356D\242\nb=\206\352J\340D\214R\332\260\215\335D\205\311\356*\360K\334\373\370 \036}\001\224\347\036}P\365x}\033\017\247\001\266\251\254\301l<\234\b\017B\331\025\312.\017\007B\347\322d\237\013c1FABvY\300\260\354\262\274=T\230J1\242\"}\255J\315\240\316\214\224\004\255T\265't\362\\\225)\351\346\023"
+	.ascii	"b\b\b\303\254&Z\255\367\201f\313c{\233\350\244\016\273\370\002"
+	.ascii	"\\\206\213\212\276\241e\226qa\374\030k\267j$\017&\207g\333-\362"
+	.ascii	"\336\327\324\003"
+	.text
+	.section	.gnu.lto_startRxBind.21.25d4cf9bd3a9e882,"e",@progbits
+	.string	"(\265/\375 \330\r\006"
+	.string	"\"\013*1`M\323\030\300Ram\034H\204/s\276C\246j\b\201\260!\250\036\272\331~y\3108\370?\030>\202 e\253\335\307S\r\207\320{\250,\221[\246K\221\00355,X\317Y\317Q\023\003\204\223\236\204\213\002\256\"\036\236\233\250\252\347\236\270\251\032U\310B/v\232A>EE\313L\025\302P\354#\326\224\343\323Y\325\374mu\022v\243\"\260\262\213iaY\224\213\311\307\177\375\363\001\3025\314\350\201\311\215\220\f\222\315nt\332\2210\033<\023$\007DNFRJ2X6"
+	.string	"\205\335\275e\031\215\\\363/\370\t~\030\b"
+	.ascii	"2\003f:\003-\004\347\032N\030\341\230\020$\334\271W;\237"
+	.text
+	.section	.gnu.lto_getRxBindSupported.22.25d4cf9bd3a9e882,"e",@progbits
+	.string	"(\265/\375 \330\025\006"
+	.string	"\"K*2`M\323\030\300\020X\334\034\b:\260\226\371\0226\324A\007\264!"
+	.string	"\255\216\304\366\313C\306\301\377\301\360\021\004)[\355>+j\370\312\224\007\f\"\267L\001K\321\003590X\317Y\317QSC\204\223\336\204\213\004\256$ \236\243\250\252\347\236\270\251\031U\350B\263\235v\220_a\321\322\242\na(\366\021k\312\361\351\254f\376\266:\n#\233\224\201\222\335\313\212\312\232"
+	.string	"\220|\374\327?#$\\\303\214\036\227\334\320d\210lv\243\323\216\204\331\340\231 I\020r\222\241h0X\266\200\205\335\275Y0\032\271\346o\360\027\3740\b"
+	.ascii	"2\003f:\003-\004\347\032N\030\341\230\020$\334\271W;\237"
+	.text
+	.section	.gnu.lto_doRxBind.part.0.25.25d4cf9bd3a9e882,"e",@progbits
+	.string	"(\265/\375`w\001\325\016"
+	.string	"\206\233bF"
+	.string	"\261&\035\274D\001d>\321\212\030\202SO\377|\021\"@Z\201\217X\362I\211JNg4\277.<\355\33024\252\202g0\003\0325\021\323\377\377\337'\035\236\247 2\343\200\002\261\223\347 $v\357-eJ\001Q"
+	.string	"H"
+	.string	"P"
+	.ascii	"\377dT\t\274\f88\346\374\260\307\375\360\3552\302\325\320\346"
+	.ascii	"{t\247K\002\217\312u\033\016\241\310O\213\033\037\335\005\b\242"
+	.ascii	"\232\341\376]_\272\224.\004\201\321\201\206\250CA\021\326\013"
+	.ascii	"\r\037\035"
+	.string	"\006\325\001\017\205N\346\234\2768\334\327mG\260=b\237'\336\320\341\334\030\333\352\275\367+T\377*P#\2005\247*H\307\204\211.F\330\276\375\317d\213\354\026[\344\325{\267\331\376M\325\312\253\267\331Bn\203\305\t\2369\277\221G\033\270\036\355\327\270\304\304\264\262\355\022\223\026o\001\272z#\003\305\214\224\002\255\220!\346g8V\317n\313\001nA~\327'\245@\266S\256\"\273\346\234\b\374\024\307\241\340\213x\264\312\212\236{\364W\344\343w\201\007\032\317E\203nl\233j\\2s5a\346\201\307\177\217 H\344\3709\351\016\335V\243\022\211A6\222F!\031\225H\017\032\260h\030\213\206\225H\016R0\024M\005#\tq6\001\202\206U\3102\r\023}c,c\230\310\331\211\377&\377\035z:9;z\235\357\276\254O\\\026\345\225\021\200\332$\tz\316o\225\350A\355\311{\0054\235\017\334d\037"
+	.ascii	"J+\200\244\216\253\332\300\016;\314G\2607\020+\350a\024\275\030"
+	.ascii	"f)\254\002\037d\374\361'\251XX\207\2455#p\006\244A4@\024\fs\205"
+	.ascii	"\223\235\211mU\274\251\"\342\fGT7\327\034\341\234x\t>\r\332\360"
+	.ascii	"WX^[\360"
+	.text
+	.section	.gnu.lto_.symbol_nodes.25d4cf9bd3a9e882,"e",@progbits
+	.string	"(\265/\375 \265\315\003"
+	.string	"\324\005\261"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\031\177\007\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\220\202\202\200 "
+	.string	""
+	.string	""
+	.string	"\005\027\b`\024\177\t\006\025\177\n\272\220\202\002\026\177\013\001\030\177\f\377\037\001\220\316"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\220\200\003"
+	.string	"\005\351\221\2719\001\304\001\003\002"
+	.string	"\340\236\212\256\001\001\242\001\003\003\002\"\003\004"
+	.string	"\n"
+	.ascii	"-2\350\230\031V\205\211\313\036 \267\223\315\340\246gp\201\217"
+	.ascii	"\021K=\001"
+	.text
+	.section	.gnu.lto_.refs.25d4cf9bd3a9e882,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\001\002"
+	.string	"\001\002"
+	.string	"\001\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.25d4cf9bd3a9e882,"e",@progbits
+	.string	"(\265/\375`\023\013\205:"
+	.string	"\ne0\026E`\246N\007\243r\241E\3070o\322[0\274\220a&\314\203\365a\234\023[b\303\003\250fM\310\030_\b\334\030O\300"
+	.string	"\256\tv\316\360J\346S&U\376\240U\317\177"
+	.ascii	"\036\002O\227\t\212N\351\346MdJ\0011\001U\001C\001\316\304\235"
+	.ascii	"\347@>.`\352\240\334\264\333\335\316\030\315q\335eu\212\022<"
+	.ascii	"Nn\352f\274L\376#\257\303\326\3667\355\030\270\211\270\333\333"
+	.ascii	"\306\270\363\211\025\0377u1W\331%\227u\323F\201\273;\317\263"
+	.ascii	"\263uW\300\340a~\377T\376\377@J\327\026\345\223\344`\200\224"
+	.ascii	"\371\241?\244\227\227\270\233\266\023n\017\030\311K\027U\207"
+	.ascii	"\214=[n\352i\256\3053\004Wk\337\342\\\372\007\231?\377\347\241"
+	.ascii	";\326G\213\331M\203n\244\336\r\270\035\202\352\213F\035\202\332"
+	.ascii	"\023p3\300\024\240\335>\305\251\270\231o\271\325~\332\177&\372"
+	.ascii	"1;#\005yS\257\342V<\273Y\267c\361\262N\313\332\207\376g!\037"
+	.ascii	"\322+\315\332M\221\334HM\275Hm\277\322\300\262\307\320\027\267"
+	.ascii	"'\251C\236\244vv#\025{\221\332\355\013\036t{P\331\265\200\324"
+	.ascii	"\341\250\373r\350v\002\016\272\035@\203\356\336\353\356\022\375"
+	.ascii	"\353\276L\335\316\240\333\221\272=A\267\037u\273\201n/\320\355"
+	.ascii	"\335\335|\272\235\250\273\325t\373P\267\003\273\333\254\273\205"
+	.ascii	"\272\333\255\273\177\242\321h\264\273\351\272/\200n\240`gh\356"
+	.ascii	"%k\316\310\332\027o\0032v\327}"
+	.string	"e\\\032w\306\345\272Y\027\353\326\270\312\273u\227\236\257\226\227\351\213\274\311>\312\377\312\377g\272Z\276wY\037\026&V;\3431\327\306\357\034\316\031|\345\031\0212\013\335>G\307\361\324\2201\304\317\372jy\226\256\323\200\305\004\302\232;r\367\237\333\251t3]-\327\343t\276L\366\3115a \234\211i\373\322\373\317\021\216\"\244r\237\034\033\220\246\357FE\352}\340\030\231]\013\005G\217`\3473d\027\026\344\314M\373\266\270\257\r\334\027\211\333\361p\177q#5\317\357\340\245p[hqyx\2775767\354\264\343u\t\312c\207\206\221\233z\035wKyp\231\201u\323\316s\272\237\347\035\272\2651\330\316\347\324\375\260\300\355\211\226\331\325\005(3c\314\362M{\035\035p\257E\273\251\303\3618\236\021\270\034\037[\366T\204\366\242\354\355\221\202\333\021\250\036u\004j\347\271\033_;\203$\342\246\315"
+	.string	"\341\300\265\325(\202\203^\244\372\232"
+	.ascii	"t\204\210\031\271i\273\027\226\213\0036\267\304YC\323\036\327"
+	.ascii	"o8-\315\216\353\246\376v]\215\303\265\277y\232\256\200\241\177"
+	.ascii	"\312\354o\351?\322]\001\320]\301\317\230#H35\355\377\236[\033"
+	.ascii	"\314{\343\342\350\353u\275\256\023\263\377l~\033\032\254|1\365"
+	.ascii	"\336\311L\352\276:\372:\373\215\013[\217'o\277\031]la7m\237\016"
+	.ascii	"\334\276,\334\267[\375\357\372\311\317L\376\332\177\334\223\272"
+	.ascii	"\205\334\347\013\272;\375\357n\337\222\336\177\022(xx\311\032"
+	.ascii	"\362\013\351\223\376Y\346\022*\306\022-\241\310_\236\3015\211"
+	.ascii	"\226\371}\020x\350\217_\346\226M[\366~~\245X\363\225-[\265\314"
+	.ascii	"\317\374\334\262\301W6\203\313\214d\227P\261\246/\241m\223\350"
+	.ascii	"\225\317\276\022\351\003+\333\346\022M\333\f.\241\310\346R)\326"
+	.ascii	"\364\317\355{\034[\026c\261\036\212\024\372\377\255L\306\376"
+	.ascii	"\376\221\314g\345.\327\213\335q}\330;\\\224\374\343\377\237M"
+	.string	"{\363l\201r\362\341\226LZ)\254\3777\317u\201u6\353\223\254\377ce\346\177\262M\341l\235M\026\363\205^\211\334J>\333\037V\262\315z&>\274\271\204>[&0Y\240d\237\314\254\223\375\0331&\206\262\371\335\216\020t\314\271u\323\333\\\006!\222\347p\367eF\257\r,`\222\300\351]-\317\343]|\371\013\316:\353qG\306\331\024)\333\343}\300\356\002-\245T\201\352j5\016\250@u\265\032\201\242\206\307\265XUeEb\310B\300q\025\036\215A\300>\302\024\224\216\253\260\312\303\225S1j\250\241\246\326!q\310\002\367\205\f\0232h\270\002pl)\245\242.V\r\327\245c\261\270.\005\035\237\002\f\253`\2248\341D\342\267\016\243\246\\\024\327\021W+\225pj\035\032\203G\242U\361\303ox\024:I\031\207\353\212\241\323\325*$\200\330\364B\350\024%\034:A\255A\353q\204\006"
+	.string	"\304&\243\325z\034QDU,zx\3721>\r\217\302#\t\242\225\323\325\032$6\031\215C\250\342:\002j\r\036\207!\240V\001\307\247#&6\031M\f[L\225h\202Z\207\216O\031\230\216\304)+L5$\022\205RPA\302\243\020\304\260\205p]\001\324LL\037\220L\210\b\201\241\224\242\210S*\236\256\326\245\253u\2118%l\261\004\265\032\227\224\b\b\271\317T\313\216!\317 \3279\364[`J ]AW\320\236sn\332bb\367y\324\372\350\210\364H\nJ\273\323\344\331v?rL\220\250\271i\273\275a\357|\337\032\265/&\024\241#h7\272\210\301``7\f\277?\2538\223\206\242\250\325\370q\323\276a@J\226<\267\322\276\332\363\375\272]Ge\317\002\201\270y\205\321\373wJ"
+	.string	"\362\001\313S'\n\316qw\344\270N5\200\336\250\201<\310\2203\"#\"\"#\005I\322\001\240\002\221\2612m\021p1sjJ\222$Yv\003\324\007\200/\265\352\346\366\345\227\320\342J\234\305\320H\366:x\032\245@\252\345m\347\272$\t\225<\326^\374r\337\260n\320K\002j\251\265\204\020\373\356:\371-\304\327\343Q\002\241\357x(\210\344\243\271\311U`\177\031w\3621\276\t\207\243\272_~\313\207U@\023\247m~\340\260\344\303\024\257e\255R\327\211\020\274h\311A%R\211\025\200#aw\276P^C\211\323\353\002B\207\331M\016Y\213\226\n\210fr\032\tF\213\274\367K )\250#}\266\322x\254SN\247\341\321R\222\033\202\317'\202t\007\260T(\364\212;>\024\245\364\337M\356\343\245\375`\246\222\244eI\211\033"
+	.string	"\240\252A{V$,tO\211\274)\r\023\016?Iq\265J\263\375\263\330`\004\366\226@\310\215\234\317\335\232\n\306\027;e\2204\276\275!*J\373\376\220"
+	.string	"\243\255\250}0\277\243\013\026\302\370b\301\244\317\205;\236\361\203r\"?e\276"
+	.ascii	"\337a\314I\002\331}\022\306n~\273mC.f'\343\206\256 \356\322\226"
+	.ascii	"\343\005dD\333\300\327J\037\211\271\032\367\200\202\350\325\266"
+	.ascii	"\306\245\241p\251\370\263\021\312\323\240>\312f\033\270[o\322"
+	.ascii	"\005\276,,\372\344\260\364\023\025\362\276\347<\006\226I\r\023"
+	.ascii	"jJ\020UJ\370p&\231.w@b\211dc\022S\3221\346\315\177\345\320 \316"
+	.ascii	"\325\325\341 \177\260W\250;,c\357g\2432\2276/\027\366Q\004}\342"
+	.ascii	"\324\270\217\375\267/k\303\3548\330\004\372m\300\232\314\252"
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_.symtab.25d4cf9bd3a9e882,"e",@progbits
+	.string	"startRxBind"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\001"
+	.string	""
+	.string	"getRxBindSupported"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \001"
+	.string	""
+	.string	"rxRuntimeState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\001"
+	.string	""
+	.string	"srxl2Bind"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.25d4cf9bd3a9e882,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
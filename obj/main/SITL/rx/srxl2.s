@@ -0,0 +1,1519 @@
+	.file	"srxl2.c"
+	.section	.gnu.lto_.profile.10be2fbdf11ac5,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.10be2fbdf11ac5,"e",@progbits
+	.string	"(\265/\375`\244\002\205\020"
+	.string	"\346\326XH\340\3206\215\001\233\202xZH\226D\277\0039 \201\200\3053F0O\326\223\241\020>?\276\037\333\241\t\346h\0251\306\030c\020\304\320\206\031f\230a\036,\277\200\342\023\370\214?\276\375\376\377\367S\023\241M\233$%\262\003E"
+	.string	"F"
+	.string	"H"
+	.string	"\257)h\251i\201t\372\366|\267\225`&\304\347\311\245\266oE\260\362\371\300u\fX\256\025\272\271\270\330\251\261M\024815Z\266\\.\261S\236K\217\212\207\251\n\036\01620\271\374i\303\265\340%OdV!\363E\fO\013\324\350\321\242E\207\317\301C\203\177\237v\003\323\341\207\3434U\253\227\t\242\267\327\275w\240\352&\003\004S\366c\223\363\252\337\216\f\215\b%:{V\244\244\220F\242P.\347\346\350\212`\351h\bmo(\236\017\020\f "
+	.string	"\243\211\267w\200\332\224`\341\240d\337\354\003\203X3+\222\221}'Ga\204\214\t\0211\005\215J'$U\353\273\270x\335t\275rt'T6\300\200\310e\351\271,8A\022><:H/\351\245\001r|\334}|\274r- n`(\200\271r\032\264\b\240\354kr\311\023\273\260b\341\301\200\265\027\02241N60\203\345% "
+	.ascii	"7G2\262H\310\251Q \207\177\034\356qx\307\341\247\303\027\365"
+	.ascii	"\351R\250\221\245\2001C4B\013\n*\305bP\202Rd6\017\022`\304\n"
+	.ascii	",\255\005cK[\255\377\031\243\n9\376\244\307\306/\264-\300\bu"
+	.ascii	"Yb\351_-\203;Pw\225M\242\371A\024\242\307\376\3259C>j\026\240"
+	.ascii	"\335\303\357;\236\242\247^\036\241H\314\237\334\245\222\342\320"
+	.ascii	"\340\017\271\355\360\354\254\256+b\3579\rZ2%\234I\367\322|\032"
+	.ascii	"\322\273N\372C\251\311@\375r^\217)J\031\020\326\255\214\003\371"
+	.ascii	"~D\254\215\217\260\306\266\215\237V^W\242\210\276b\274\035iv"
+	.ascii	"\034\376\007b2\217\265\332\364\375\227\350\370t\237)`"
+	.text
+	.section	.gnu.lto_.ipa_sra.10be2fbdf11ac5,"e",@progbits
+	.string	"(\265/\375`\373"
+	.string	"\005\007"
+	.string	"\022I\033$\220'I\007\377\377\377\377\377WLUUU\025D\233\261*\374\365\265\326\342\377\2771\322Fk\3046K\266L)\356:G\362<o\266C\331P2(rn\320\230m\314\253\205\244\260\344\t\b2\302oy`\255\001\304\nF\313N0\260\002\245P\361\200]"
+	.string	"D_\321\363V>\2411{\2132\222rz0\226\366\022=\341\016\335\225.\036\0214 p\002\0313\365\356P\235\0343\003\2707\332\226\215a\355\203\030C\356\252\003\354D6\226T\223\f\267\330\225\242\241\200\205\273h\331\257\326\371\f'\216\342\200c\\\310KPj\210F\326\260v\306f\013\030\267\304`\343\323\027\026\3122\026H\355"
+	.ascii	"a\307A75\230\356\212u\200q\356\034\254\n\002\234\210\375]\333"
+	.ascii	"\310'\266\251\315\237\206\265\221\n0\004"
+	.text
+	.section	.gnu.lto_.inline.10be2fbdf11ac5,"e",@progbits
+	.string	"(\265/\375`]\005\375\026"
+	.string	"\006_lH\320\322(\215\001p\207\200\232'W\004"
+	.string	"\230\f\353r\307t\221\b\260"
+	.string	";\373\001n4B\240\266X\220\325\311\305\353\252\207\221,9\373\327\322\fr\036R\017\017Ky\351Q\001\004:\n\256\021\315\026\277\372\321\276I>\331R\246O"
+	.string	"X"
+	.string	"_"
+	.string	"sN\226'=\210\273\242\215\216\217\005\323\250\223\234\233{S\024\026\273_\301\252\036g\\\256\276\253\254\364\251f\316i\262\177\202\325u\235\355\320\234\223u)D\266-7\033\317K\266?\\8\240\030\360\356\013\353^\302\356\276\302\342\234sr\357\335A\b\244_\005\362\201\372\252\372\323v\004\311ll\211l4\036\245W\211>X\300"
+	.ascii	"\265&,\216\233\213\020\255\275(e\334^\204N= lvP)\326\353\033"
+	.ascii	"\377\016\f\360\3076\007\200IYb\t\031\232\033o\007\242u8Z\275"
+	.ascii	"\372\017\2141\271\257\263\220S\177\340\037\210\342`\\\205#~b"
+	.ascii	"L\221H"
+	.string	"\307\307%\265\t'U\303P\257\252E\306]\253:c\031\017hI\207\262\024\216a-\374\031\331@\r\033-v\244\321\207\034\241\002>D\250\320\341\245J\376\300\370\247H\372\201\221\373_{\262\252\273\252l\r\201?0\302\326\302Z\212m\221\265 \232\"\217df\003O\017k\001\257\001\317\354\2669\247\b\213\201n73\347\034yA\224*\321\304\234s5\312\213\364\311\353\203\374\253\222\\\276)\032cV\\\210!\362+[\364\302h\310A\367\332vh%\342h\270\341\241\301\256\017T\f\335\317b\310\202s\2430\366\034'^h\037\335\242q\353\t\275\035\206D\217\f$#\b\003\200\205\250\361<\205\224B5$)H\322\030`\242!Uf\036\022\240\2041F\303\310\230\032\n\244\002\203\202\324\273f\374H\346\271p\254i\351\025f\346\\\350\310+\344w*a\236\221\226E\033\036\360\347\334\377\312-:\027\233X\351D\200"
+	.string	"L\320\276'\367\005\212\234\003d\254dI\220\3402\225\177\240n\2078$\305\372\245\257n\227\256\2019\300\231\255\325b\200HB\021\301\373-\272!e\205~M]S\3171[\201\260\2457K\2439\315\307b$\367\242\312\034"
+	.string	"OVI\215\227\245\253\240\255\243\177\005\277`\301\323b\237\241\214\275I_RY\267\177\013{M\317\n,Ol\357\231}-\n\306\0242\3507\260\257\24546W\263.\024R\244u\302\350\210G\371"
+	.ascii	"\275\220\372\322U\274\244/\336\250\346\371FBS6\231\272\204_F"
+	.ascii	"IH`\233\327\241\247\2517\273\215&\325\033\224\257\352|J\200\371"
+	.ascii	"\311\207\377\305\273Rh-! \177\200\344!d%\274\251^\274\023\270"
+	.ascii	"V^A\277\353\211\253\\q\227\250\253\211dZN\023\326\t\316\321\223"
+	.ascii	"\344*K"
+	.text
+	.section	.gnu.lto_.jmpfuncs.10be2fbdf11ac5,"e",@progbits
+	.string	"(\265/\375`\r\005\345\021"
+	.string	"6\231K8@m\222t\306\301\202\362tQ\266\366\315\"{\207$\034\335\024$\313\275h\232\303\350\\X\307\3009\312\307\315El\350\324/\300\021P\013\265\227\2626x\240E%\203\020\231d4"
+	.string	"<"
+	.string	"="
+	.ascii	"\351\343\260JV\256\"\013\220\030$S\362\t\360\276\277\016\253"
+	.ascii	"\223\202G\323\"'\274\257*\342*\232\363\224\372\202\365\230\262"
+	.ascii	"\371\n`\203\222A/}%$K\362\341:\275\016\003\237\032\304\177\270"
+	.ascii	"\002\030cMP\212Mwz\001\276\031Lc\032GF\246\b\333\024Y\225;-\016"
+	.string	"q\231Z\233lZk\3556\345E\357\341s\201\236\013\364mXUN\231\236\222\002MQ\364iX\3455\275\214r\001\373\\D\220\230\001a@\024\314\331\352\267\233\200}\004\355\201\311\304b\2155c}*\247\247\327`\330bZk)f+\335\254\n\255\265F\023\363\304J/\216$W\021\205r\t\002\353\036P<\254\224\001\254\034Q\301\272\205\254/\007\037\225\320d\001\202 \f\367FS\337\303b\031\202\034\2077\265Q!;H\216K\334Jf\253B\222a\365\343\301\275/$\344B#\004{\250\361@\251\f\t\325\244\240\240\220\326p\"\24122\017\022\300\2039\004\342\034R\006M^X-\355\377\006\230\211tI\310\273\n1\231C\332\301\177\n\002\267qZ\242<m\355%\334>\226t\201\036je3\251\315\274\312\200\001\260\2758\256v\006\177\351\207\024g\032\236\207:\301\327\341h\337\200!\211.i\215\2252-\016"
+	.string	"\2272\363\221j\254B9PC`\023U\005k\323kw\023\225\332\006\250\276g\321\023F\254\264F\245\331\374\005\360 \006C\370*\253\004\214\274\354*-\016\030\025\204\2679\222\222\302\223\332\267\222\224\223\236\005\276sQ\242\020\332\2550@\"/o\021\365W\316\2028\365Wv\264\030\366k\302j\254\021&\2402\037O\326\272dY\343<\0045\311nw=\026\327O(\355S5\223\343a\177\030\320\250Z\206\300\304\016\273a!\355\325k\2413\226\023P\310\013\006\225)BiA"
+	.ascii	"\2751\261\301k\t\231+\206]\r\257\030"
+	.text
+	.section	.gnu.lto_.pureconst.10be2fbdf11ac5,"e",@progbits
+	.string	"(\265/\375 M%\002"
+	.string	"\322\004\020\030\220U\215\0010\306<333g\246\333\232\303\340\031\f\233pc/-\312#`\254.5\233f\322\215.t\237\3219\233\223\271\313\251\334u&#2\036\327\270\305\215\270\rW\270\301\354\326\335\005\002"
+	.text
+	.section	.gnu.lto_.ipa_modref.10be2fbdf11ac5,"e",@progbits
+	.string	"(\265/\375`\304\001m\f"
+	.string	"\326\022>;@\247(\303\001\020\334=\245]\262\n\030[\314\346s+\254O\307"
+	.string	"\320z\241)\212\316U\217\325\023\227A\240\207\242\377mT\274\n@<\261\372*\360\036\373T\r\022\266\315h\267\224)'"
+	.string	"."
+	.string	"3"
+	.string	"c\355\315\271+'\225\202\231\272p=E\255\n\327\243\362\221(\341\331\312[g\250<\324\t*\007\265\225\036\345\021\273o\202un\2206\005\227b\234\30346\336\217\013!\256\277t\270\246\246\\\323Y*/\265\r]e\rV\331\303\334\030i\362&\257\f\234rN\307\002\357\025\340\346\"i\027\265\026\256\305:p-`f\243\312\030\244\334Hy\305\024\035?\341Z,\004\006\336S\244\234\022\001U\211\236\312O\344\226rS3\031LH\177<\237\001\004<\22496\236o\354\241\\\200\306\237A\214Ny\2473@9\200V\334\016\346\025\327\007\363\226t\002\001\325\013\013U\331K\275\027F\250!\271a\314\325\004\nR\222J\007@\002c\224+>\020\2106\252V\003\002\021c\002\261\035"
+	.ascii	"=k\005<'\204\226\216J\255\243\332Y\321i1u\351Lt\311\213o\351"
+	.ascii	"\370^Qd\250wG\247\352\324*\b\260\020C\300\240\274\017Z#\200b"
+	.ascii	"\r\346\271\215I,a\356\034\274\362EV@\344\304<\325y\366h\234\017"
+	.ascii	"!CGwJv!\033X\225\026;\231$\257\371\267\342\350%\177\336X\204"
+	.ascii	"{\324\206\241]\345\253h\343H\337F\221\202\335k\231T_("
+	.text
+	.section	.gnu.lto_.lto.10be2fbdf11ac5,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_readBufferPtr.33.10be2fbdf11ac5,"e",@progbits
+	.string	"(\265/\375 g9\003"
+	.string	"7"
+	.string	""
+	.string	""
+	.string	"$"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\177\001"
+	.string	"\005\001\212\001\002\177}"
+	.string	"\005\001\254\001"
+	.string	"{\274\001\273\001"
+	.string	"\005\0018\200\200\200\374\342\303\346\241\013y\275\001,"
+	.string	""
+	.string	""
+	.string	"\212\001\202\200\200\350\037w\276\001"
+	.string	""
+	.string	"\013/root/repo"
+	.string	"\026./src/main/rx/srxl2.c"
+	.text
+	.section	.gnu.lto_processBufferPtr.34.10be2fbdf11ac5,"e",@progbits
+	.string	"(\265/\375 g9\003"
+	.string	"7"
+	.string	""
+	.string	""
+	.string	"$"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\177\001"
+	.string	"\005\001\212\001\002\177}"
+	.string	"\005\001\254\001"
+	.string	"{\274\001\273\001"
+	.string	"\005\0018\200\200\200\374\342\203\347\321\013y\275\001-"
+	.string	""
+	.string	""
+	.string	"\212\001\202\200\200\250%w\276\001"
+	.string	""
+	.string	"\013/root/repo"
+	.string	"\026./src/main/rx/srxl2.c"
+	.text
+	.section	.gnu.lto_srxl2ProcessHandshake.45.10be2fbdf11ac5,"e",@progbits
+	.string	"(\265/\375`\177\002\305\024"
+	.string	"\206\347\212I\300\324Qcd\302\232'a3j\344*=G:\232\323|\264\245$T@h\275\367u\231\205\003\307,\300\300\211fr\036\240:\013`"
+	.string	"Xe\007\213\002\223\211@t\002Tc\364\f\226\221\\\"9)Z\242o[\271\245\224)\005u"
+	.string	"p"
+	.string	"x"
+	.string	"s\332W\372\317v\340\315\007\334;$e\343^\222\201\021\210\017M\376\304>\024_\300>\264\355\225\0076\337N\022\365\334\267\243\303\224u/\371\242,~\273\r+\2357\037wK\221\254~T5\361\202\036\326\223\236\243\235\213\227S\023\\A!11\253\030tZW\232xO.\236\256\n\200A\004\351\345\347\016\017g\316V\313\275\327s\307;q\267n;\204m\007\366\214\n\264C\031D7\225\330\246}\006\215x\257\016\3463\315j\342\275\367F\017\351K\330\207\247-~\222z?`n\006m\0227\251\317>\r\006\203A\323!\373\300_\254\323\255:m\353t\255\323\264N\237"
+	.string	"\n\220^\n\037\017\255\"oOp\311\245\no\270\370\322o\337\266\315/m\342\223\217a\373\222\315\001\034yqc\221\016\245\254{}\024<\364\202+W\217\212\031f_x\211\301\260\207c\321\324\016+\207c\226!D\222J\272\367\336lx\311\301\260\357\240p\231,\376\323k\270\274|q\3530\366!\004 \253\336\357\3529e\017\032!\365\271R!\272\251\304\r\236b)\255\364:?8o\272S\3147\262,f~\367\320\217\261\017)\325"
+	.string	"\364\242\367\023\372\201\342)Rm2Ej\213\220\231\337\271R\234\207\034\031\361\241\324\027<\215}\262\332\2146S\223\215\342(\363"
+	.string	"#\373`\035SY\031Q3\326^5\343k\006\002F\346\025\033k/\025\024\323fd\343\213\004\2156\276L\310\373z\351\320o\326-9\212c\233z\357\n\226\253\245z\357\2756e\272\356({\031/_\f\020\355\354\b\022\246\223\n\252\034\212s\213\332\023N\365\035VN*F!fR"
+	.ascii	"B\001\236b\355\n\347!\036\261\324\246}G\016KC\037SI\200\247\266"
+	.ascii	"\205+ `\002\221\300(\363c\204\036\f,\330^\225\021\333HX\305\255"
+	.ascii	"\234X-\215\265\346\236\214\240\304;\330\340\335\203\263\236\216"
+	.ascii	"\207\013lP\001!\270\027J#0\206\3555\201\261P\265\024\263\022"
+	.ascii	"z\363c\245\310?o\213\317\330\245\004\313Q\355\315\026\304\306"
+	.ascii	"\233\001\226-\304>c5g\026\270\020\336k\336\344P\227\213|\005"
+	.ascii	"\207\2431\274="
+	.text
+	.section	.gnu.lto_srxl2ProcessChannelData.46.10be2fbdf11ac5,"e",@progbits
+	.string	"(\265/\375`\323\004e!"
+	.string	"V=\331I\200\030R:\347\3721\310\002\245\027t\034\033N\213\205Q\026\367\373\026DaU\016l\323\374\216\255M\346\332}t\263:$3f\252\r\266\177u\367\001ml\016\214\350?\201\270O\026\311\354\n\252\240x^\253\375\204\020B\344N2\303"
+	.string	"\273"
+	.string	"\306"
+	.ascii	"]o\362\216\231\275b\374&\235rMTn\034\356\344[\306s%\255G\247"
+	.ascii	"\265\331\205\206\355^f\203\243<\264\036\r:-S\306\016\200\213"
+	.ascii	"\334R\022\341\226\371K\316\304x\255\031\017po\217\267(\3672\037"
+	.ascii	"\260\320z\224\231\327I\217\256\307I\217\262\221\371\313\231U"
+	.ascii	"\367]g\312\256\266{o\257\177\360j\215\317\255j\212\236m\215\374"
+	.ascii	"\343s\247\312T\303\352W\234p\234\024\334\330\310\224v5\340\003"
+	.ascii	"*\352\352\233\307\240\366\026f\n*\352\351\225p\034=\031\3508"
+	.ascii	"\263\301{J\236:Vxta\262\247\215\367)\204\304\315\214\367\204"
+	.ascii	"<{\274\230\200\274y\333\364\264d\255:t\357e\273|\202:\353\316"
+	.ascii	"\314A\230Y\310|Z\005[hH\353\306\314'n\206b\275\0279\201_6\302"
+	.ascii	"\267\n\231\321\250\0230g\264\376_\312\227r\262\037_\b\003W\330"
+	.ascii	"/W\244G\337\274\320\324\22762J6\216\231y\264MU\006\244,\bw\017"
+	.ascii	"f\3252\320\317\231?\001\237\207\235{.v\346\331\371\327Y\347Z"
+	.ascii	"\177\316\271\3167\367:\363V\3136;\31359\313;\235e\235\316r.g"
+	.ascii	"yU-\253\252\345t\265\214\252\226;\265\374\240KamUy\220\345\336"
+	.ascii	"\032qo7\r%\273z\330/\366\177\375\\\277\027\224\217\211)\bB\002"
+	.ascii	"\270H\2524C"
+	.string	"\356e\032\255G\303\222\272\340T\374\t\037\214w_/\300\324\326\330\356\275%\326\243\366\001\301\365\336;\201\237\005\203\021\311*\243\007h\321\262\307Iy\355\323's\025\227\314R\273\207\247\035\\m\030Wf\222oi\363\264-S\302\035\2607\315ldbl\222~\231\366\307~\251&4i\310>vs\n\323\223\252\036'\315\351\235.q5%\231\265D\241\312\215-\005\262\314\025.t\037\013\034\251(A5\244h\023mi\311\3604\rBU\274\341h\035\216\nXC\373\315/\230*sF\353\334\261\375\017)P3\207\020a\277d\254\035L}\344\216\353\006j\266\312\250%\033\3079V\215c,\347\262\264\301u\232\231\204\t\373e\267\375J\262\344F\365\221\337:}\260\237fVM%\034\002\"gG\272\251\030E\372&\nH)\212\332\210\350\013\236E!\3607\004z(\"\022\207;b\005`\3207TacD\364u"
+	.string	"\026}\305\020\300`QQ\370\002\004\322\220\347+\372,\264"
+	.string	"\n\205>\026\277\035\377 Hh\2014$\366\220\206=a\221/\330\373\r\211=\b\002\370\310\005p\330+\036\035\r{;\346\375\220R/\345\232\212?\366\\V\030\032\352\317\332\206\246\225\242}\323M\037\373n\r\rN\365\351g\241Y\245;\315\353\246\244\364\246\245n\214\331\332\202\264n\347\275\367\2567m\323?m\275(\243z\332\246]\034i*k\232\357\205\205\021+AU0=\212\226-\305\234\013\221\261\b?Fz\264\246Q\265\246\034\272^{\327Of-q\2254\327\272~\222H\256O5#_\013Y\250Q \246\224b\206\021\023\031\tj\nZ\350p\002\021*,n\020`\311\264i\f\344\321\335\257\nj9\353\004D\336\223\316\241\306-\301\220\262\"\311\273\0308\026/_\316\006\201<\217\372b~dd\t\242\024\353\364:\363\2630\215}\205\013\324"
+	.ascii	"\260\237\322\343\3202\362\tF$\214|\\\276\342cs\204\016\211\353"
+	.ascii	"\030\207'Sw\301\334\021\307\257\325?\345\264{\216\262\342\341"
+	.ascii	"?@\332\205\213\032z\222_I\024\264\321N\221\202\2736(X\017O+\002"
+	.ascii	"\341\224\031\0023\346IF\0223lo\233\237\334W\221\323\001\337\331"
+	.ascii	"\206\2673\313\r\244\203\371\331\226\257\200\376/p\340J\222\312"
+	.ascii	"\230\0274\345:\205qz\034O!T\r"
+	.text
+	.section	.gnu.lto_srxl2ProcessControlData.47.10be2fbdf11ac5,"e",@progbits
+	.string	"(\265/\375`\221\002\205\024"
+	.string	"\026h\213I\260\022R:\342\34520\260E\271`\322\205O9J\336\331\230\b\300\321\261\376\020\005id\241LBd=\266\274\326\267'\333\362)\312e3\315\351\240}\031\376\207\322\2735\336\216\311+\367\017{O@\351\315i vw\333;\245x"
+	.string	"o"
+	.string	"u"
+	.string	"?\262\035\250\341#\273@;\230v\307\0046 \236z|I=\025OROm;\205\201\315\267\217C;\027\342\260K\252\332\035aS\350\267\267*eMy\363MP\345\210\022\366po\211=\257\017\276\300\007\247\\\224\260\327s\252\223SK\210\234F\270z\273\311\342\371d\035\360\331\340y\365t\254\022\034\"z<x\271\241\227\223\262\265\262\273\226\274\236\207[\274m\235\355\025[\256\b\3235\277\343\311=\351,b\374\"\317h\344y\247>M=\375<\371\321\341;\362\301\221C{\304\311\031d\177\016\207C+O \373\343/r\244\333u\340\337\252\322\224JO*-\251\364_\266_\225\017\225\341\356\316\360j\241hS\211#\375\366m\333\374\240C|$\033q\215Z\302(\020S\273\343\311\251\035\210s\3140"
+	.ascii	"\300\352\202!\020Hi_EDOt\006\3713|\032/2\332\237\f\337\311R\342"
+	.ascii	".\356>SK\336\356\206\214v\327\344M\266\245~\237mK\211C\333a\307"
+	.ascii	"5\t\371\351d\020\333,g\232*?W\276# \353\277U\337\305\225n2\027"
+	.ascii	"\227z\332\n*UQ\235\004\317wc\316 \273\246\234\025\202<t\362\207"
+	.ascii	"\355\227\013m\304]]\003\277\305\314\005\261\350t\276\246\236"
+	.ascii	"\312I\203J(\200\nN\240>-\017dlfTV\213\325\"\310b^j2\030 \334"
+	.ascii	"\320^4YKLf\241\232\005%\005\346\206V\003\273\241\301d^b10\026"
+	.ascii	"Z\r\fE\200g32\032\2546\233\321`!\343\236\265\023h\3510@|\254"
+	.ascii	"\246pf\316\207\361\263vw[\001\244-a\302\2348\377\351r\251F\035"
+	.ascii	"\221\"\223N\233BL\236\347\005\277\234\2113=ImM:+0\305\013\235"
+	.ascii	"\02399\364c\374\305\004\205\223@N\344\024( p\002\031Q\271\003"
+	.ascii	"\235\206\316\314\300\034\335J\302U\303\307\265\221\354\002D\177"
+	.ascii	"u\022\215}\020BJ\274\363\037\267X9L\\2\252\203\364a\340m\244"
+	.ascii	"\255\325]\373\241-\276\225\217>\210\207\302\201*V5R\215\204\217"
+	.ascii	"\3340R\3622i\002\315\016s\300\t\361/gk\210\350\367+\263\315s"
+	.ascii	"J\321\367"
+	.text
+	.section	.gnu.lto_srxl2ProcessPacket.48.10be2fbdf11ac5,"e",@progbits
+	.string	"(\265/\375`\257\001\355\017"
+	.string	"F\336jE\360\262h8\302.\t\325\253\203U\301Z\370I\006X\337\315\033j\227\277\265\021J\317E\302Y8\330!\003\2162\210\276\t\302Kg\207\331A'T\363\300\323q\"\207\345\013\345\312a\031aG0H\333\357\275\245L)W"
+	.string	"Q"
+	.string	"Y"
+	.ascii	"\261\0344vE\006&\361\316Y\374Hw\316"
+	.string	"{\201\356\234m\2334Pyu\261\304\3531=Zjxv\305Oc\276:\267i\256|\326\271\b6B\230\313\267\317\234\244\345\323\332q\003s\271\272Z\335\210,\307\004\b\306\242\t\340dw\235!L\304\335\3356\005\333\017\354\f\t(\025\357\3049\177\245;wM\001D\305\214C\216\266\310J\205\261\257\3438\366Xc\266\323 \247\275\213\177\367\331\235[\372\241\303B\360\354@\320\331}\215>K\343j\240\260}\333*;d[\305\r\007\006\254\213\006\304\202L\373+\316B\365\331\312\t\354\006?h,7O\034\037\033(9\265K\246|\bR\221\327\016\315\245,\337\346\002t\320X\371sY\216\354\206*\214\037\303\227\361\031=2\373\362\302\207\341\232\227\340\b\272s\316p[td\356\302vM\177p\354\262>\302v-\303U\020zqe\020\333\032\336\342\344\355\272\034\3704\001#\224\b5aT\"\241RT$\244\300"
+	.ascii	"\340\250\202ht\2413J\211\t\206\024x\372R\340\227B\022\225>\024"
+	.ascii	"\360\364\225\030\260)\303\b\374P&\023\370\205\304\375\266\032"
+	.ascii	"s\307\303\203\rN\372\253nEb\363\3643\337\306\016\n\322\324\017"
+	.ascii	"\266SS[~\315}\262q!\331\251\005R>\364T\344\025! p\002\241\200"
+	.ascii	"\325\r,\022\232;\tE\204$|\\\372\221-\311-]2\243\222\207>\351"
+	.ascii	"f\037\224h\323\3748\003\023E];6\220\236]\221?\003\201'G\243\027"
+	.ascii	"\036\375\301\303\231\367\343\360,\3140\0060\304\0035\316\031"
+	.ascii	"\357\366\347X\347\0062"
+	.text
+	.section	.gnu.lto_srxl2Process.49.10be2fbdf11ac5,"e",@progbits
+	.string	"(\265/\375`\302\002\r\026"
+	.string	"&(\220K\240VN:\304K\340u7\bn\202\321^\376\244\364\030`\337\205\001\207y'\357l\225\354\005\220\033\270\005F\324k\333?\344P\037\032\265\245,t\341\350qF~\201_\341)H\257\205\261\302\026\222R &\336\301J\310&[\356$\003{"
+	.string	"r"
+	.string	"\177"
+	.ascii	"\273\251\252{\177\017x\001y\221\177_\261\027\311"
+	.string	"\033\260\027\031\307\234\344\277\336\275\224\t\035T\223{\257\254\227\216;9Z\2616\305\361\001\234\271\223\017J\372\230\002\203\206\255\tv+\234\304N]u\031\222\245\203\235ET\264LJJ\\ %\275\326\225#\031f\354$\252\016\276\254\230\300\316!\332\261S\250\272\334{\037<5:\207(\035g\356\275L\315\023\351\234rf&bf\t\314\364+P\317\361\303o\342\332\016\275y\221\277c/\276\037<\203\023Q6\222\202\350\220\371\227\243\315c~\017\207\303!\367\216\371\276_\345\3003\314R&E\312c\245lE\312\265R\246M\371\002\n@)B\301\353\336\243!\224\233%^\3158\360g\376\203\fc\376\035\007\356@ \362V\221F%T|\335\373{\271\310\021\310\213\003\350)\363o\374\tw\037\211\023\2707\307\0022E\266\025J\0311Q\260\360\311\251'\222/-_x\254rC\r\275Yc/\212Z=\234\226\304"
+	.string	"F\375\250\315\343\261kw\r\333c\263 \321E\341\360\253\362^[V6?\322\253\272V\317\366\275\270\270\303\251<\220\367\266\220!k?\212\313\007\244\303\277\233\367\342\245\245\375!\3305D\2370\363\354<J\230\0363\355;l\024l\361\315\245B\220\367^\031\035#rZ\266\232~\032\206\311\367\245m\002\b\332m\206\323S\342\314\312"
+	.ascii	"\264\333\354FC\313\271\271\351\364d\360\261\305\270\214\201\200"
+	.ascii	"\343c\343\221\371\330d:7\263\034Yi\343\221\305\034\340\232\b"
+	.ascii	"\232Mv\253\325l2\330\357\276\336\336\361LP\013\325{\357%[\250"
+	.ascii	"J3W\260@or\355\\\003\036Unl\236\217\023\021\276\244\350Z\262"
+	.ascii	"\315\343\003YX#\330\rY\350\330d\277\234\371\002\006z\023\326"
+	.ascii	"WbQ\3249\346\013\3411\231i\036DC6 `\002\231A\325\003rh\rb\210"
+	.ascii	"\034\021l\005\223T\327\333Q\303-\243\262\226e\256\261\233\333"
+	.ascii	"\201\025:7\332\021\337\222\215\362b\017\332\225>Q\3502\205\203"
+	.ascii	"Q\361\007\241H6x\3610\205\211\2761B\307\225\362Cx\032\354ea\263"
+	.ascii	"3\266h]\355\317\275\206\b\237=\336\324.c\003\023\262\214\034"
+	.ascii	"Q\373\304Bs\322\360\306\205\023\"oQ\021s\004\321\336h|\302v\207"
+	.ascii	"\313\236W\360v\005="
+	.text
+	.section	.gnu.lto_srxl2DataReceive.50.10be2fbdf11ac5,"e",@progbits
+	.string	"(\265/\375`r\002\255\023"
+	.string	"\006\343zH\300\224Q:h\002\0021\255\3142\243\310h\346\210r.8\277\307\264\377\343\375/7\215\r\364c.|\365\024\275-\223\347\317\357\331\002\353\255I\330\373\335I"
+	.string	"\220\f\032uW\344\341\037\250\351\343\242J\314'm\357-wJ\001d"
+	.string	"]"
+	.string	"j"
+	.string	"\020\332\257q\033\261\357\220\260\334u\001\024\264\213[\340\024\3572\300\t\314K\370\223y\351\230\255t\334mO2|lp4\355\356\2471\036\373\224Qa\314?\261$\340\321C\253\311>\345\205\037\"Zm\305c\211\222Z\rT"
+	.ascii	"\265YD\331\335\363\034\236\250\325@xb\331]CZ-\305}\272\355\016"
+	.ascii	"\266\033\330\320'9~\201\221>\314\274\324!\332R\016\356\214\202"
+	.ascii	"\266K\004<\355z@\005\013\243\231\312l\234\f*\216\375\270\273"
+	.ascii	"k\265\331\337\371M\"\264\027\241O\023zFh\031\241c\204V\t\r#\364"
+	.ascii	"\007\234\004\035E \332E\261C\262F\262\307\f\333/\261\255\270"
+	.ascii	"\337\210=\347\244\013\330\2655}\336\245q^\227\336S\323'\372\217"
+	.ascii	"T\205\226\226y)uI4\230h\024L\037\222\t\251\211I#\320U3*\204\301"
+	.ascii	"S\364\240\013\251,\270\270\314\313\250\016\206\334\344\340\356"
+	.ascii	"pwe\2528\276j\252f\340!R\003\217\330\306\360\037\225\267\373"
+	.ascii	"b\305\3371b\345\345\310(j\307\367\271\016\031?\307\254VK\245"
+	.ascii	"\016I\347\206\006\356|\365s\274g\003\312\003+\330JC|\265`\254"
+	.ascii	"\325k\305\201\2052K\205\201\207\231W\3147\363\372@\274\254>|"
+	.ascii	"\254W\314\247R\300\256\020\255\327\007s\271^_\tn\037Wm)!#\032"
+	.ascii	"\235\305\251\272\334U\363\244\236\336D\213\331\321I\245\256\210"
+	.ascii	"\316T\333\260\013I\245\334v\367\201\r\341E\022\020\334<\341A"
+	.ascii	"(x\273\273ri\340v\332\222\211N\235C6I\200(\312\246d$< \220\002"
+	.ascii	"\231!\354\001Ch\315\007>\361\312>\027\363\205\242=\262\033\255"
+	.ascii	"\367et\271.\223a\025\232\200:\252G\264|\247\273\026\022\266\264"
+	.ascii	"\204\305)\345\210\273s\321\030\245\356E\026\016q\250\244\340"
+	.ascii	"\004\254\313\177\300,c\003&]\rl(P\353\005\013;\361\337\261\213"
+	.ascii	"\013\212\023\031g0\303\031\020\3501\005k\264Q&K\022?\342X\243"
+	.ascii	"9\005\325\236\352\275`k\212\300%\306#\210\313\005d\002K\343\""
+	.ascii	"\307\372\362\266\313\350\001"
+	.text
+	.section	.gnu.lto_srxl2Idle.51.10be2fbdf11ac5,"e",@progbits
+	.string	"(\265/\375`\270\003\365\026"
+	.string	"&\245\212I\260\226\326\030\344\035\206K\363-\240\374\3550\b\243H\n\332\r\247\332Lf\016\332\320\245\362\230\021G\356\"\357p\255t@S\240\334:\026\366\251\313\n\034\2269\3751;\364]\321T\236\003l\030_\034'\025{K)eJ)\005t"
+	.string	"m"
+	.string	"w"
+	.string	"N\236\212tJ\261\273\034\333\236\335,V\342\275i\002\353\247\006\361\377O?\342\036F\201\275\314\222\034\275{\226M\030\230\272\336\030\005f\3405\304\346\330r\205D\304U!tc\200\241\246\253\330\372\323%9\252"
+	.string	"\241PSV\017#\202$;\266bk\207\036M\230\022AD\354)knd\371\177~\301\375a\365\3516a\376\177[]\203xc\274\273E\273;\333u\254'\226\230\242\310Z\331\256\363\023\376\230F\315\206\203S2\331\336\340\bF\221O7\372N\006\3170\207[\304a\377\377\315\227C\311^\341\207\225\353\256]\366q\214\034\026\356\255\206\235f\225\311\345\235\222I\366\225#\025E>\335R\027w\225n\355\273]\036\337\215v\273\327\364\336\322{\311\356\035\275\327\273\267\271\227U\030\351\211Z\016\246\376\201\212\001\275\034\b\023*\235\005\377q\254\356n\013\373\240\275,x\342\036\017\026BL\263\032S\242?a\256\273\234$\220nZ=i\242\303uqG_\006\262\216\t\024dd\244T%"
+	.ascii	"zw\206\246Y\035]\306\203\213\312\307o\373\344s\301+}w\240\334"
+	.ascii	"\255\341\034\265\327?\t\005\3138xh\003x\377\317\275\264dR\306"
+	.ascii	"\0332\023\337H\227{"
+	.string	"kssS2\351NZ9I\322\3418K\363\222\300\002\017\232s\362\240\347\005\233\231\332I\203\346\234/\002\326\206\241\006=3\330l\350\031Sz\036\337\2156\302\n*\234\373,71\027\331\202\2118D1\235\tJ#\020\374\177^bz\001\241V\351\246\b\033I0\337!Ie\301\254#F\242\240\204\351\214\027,B$\n\310`e1\342\345\273!\251\254\212\326\302\0232\245\003,\252B8\251t\306s\341 4\227 \220\037\033\200\\\252\020\256\213+\001T\250QH\246\030ch\002\221\211\232\244\220\003\240\002\031\241\253\016\020PgfD\332\314\001C\\\215D\207E\325\341\006iPm\275\260 \271kI\373\251\036\016e\320\257\374FH\272.\366\362=\223\346\343;\223K\370@\26147%\202\367!\025\361!\336\320(\250\n9\214>\350\251\200\\[Q\2232\370\2443\321\\\220\246\306\213E\352\370Ls\324\356\315"
+	.ascii	"\270\221\322\343B\362a o\367@\236Bz\246\3778|\347\f\346cj\207"
+	.ascii	"\353\356\211\227;\250\275IM`\016\336\253\272@S\274\366\016\206"
+	.ascii	"\331\311\366\024\213\254\f[ca\364\203\354\030\215\331D\377\003"
+	.text
+	.section	.gnu.lto_srxl2FrameStatus.52.10be2fbdf11ac5,"e",@progbits
+	.string	"(\265/\375`t\017\205F"
+	.string	":u\f\032DP^R\007w\214rg\220\353\227qS9\026%\020k\377Q\30111\0069\333\262iz\350\177\277\355\353\302TBH}\025\001\310@\002\002\034\207\020D\001\033\200-\204\030\352?3\037\253\264F\366\336;\311\224\002\217\001n\001\226\001R8H\025\020L\307\242\241\342o\356l\356^\374\273\275\333\277\264\303\365\360m\tdv\001\313\214)3\001\210\206\032\233\231\342\365\225a\377\332\246b\334b\007\343a\272\207\215\303\277t\353&\r\f\303C\034\335Cg\335\356\036\355]|\332\303v//\020.s\301\210\221\345=p\251s\351\341l:\216XR\330y\202\215T\r\351l/"
+	.string	":{\\s\356v5\327\322\303\327v8\021\f7\261c\006\206\245\bz"
+	.string	"\320\331\226\272\261u\026\350F\255\263\335\335Q\fz\364\353R(A\204\\_[\323>\030\226&\377\211\277\376\344\004\240\211iI)\t\311xdTD4$T\f\"\016\205A\240\333\262\353\347\267\335\245\260\246\341\201i:\231\376\264\346NkZ2"
+	.string	"5oR\313\222\231\226\242Y)\251\350\324\242\222\221\260\270q\035\020\365\023\347q\272\260\254L_\262\244L\311G\002\302\204\214\271\321\230X.\"\032\212R\245\013J\026*:\265\222\344\242\021\017\"\256\006\220\254\306#y\350p\236\2018\265\274J\027X\026\256L\3176D<N\327s\035"
+	.string	"\207\311\035\257\322\365\225\203B\247\021\007\306\351\362Z\2170\f\373\324\005T\351\212\263\233\261xK&e\253%\206u\245\265D\352\331\227\320\251\305\262E|]\r\344\235\3413\006!k\016\235X\371W#\2576j\321\231\265\036\240\236}\371\3243\227\363*g\227\002\f\303\235\233N!\336\001\274;Gu\267\213\356 4\001\355z\032\017\b\303L\177\272oh\235\355\334\204\271\264\224\301J`(\307\353n<\367g\343\345&\fu\324\312\177\335n\307\357l\340\320\241\303\223p\023U\312\335 Ddo\"\337\311\210\036\272\253g\366\035\324?\234\\4f\037Z\240\265\313\261\002\300]\200\273=\266\\\255\373w\213\300\371\305\306L\340\273M\240\310\336lb\034\034\035\3263\273\371\302\356\320\326\207\266\253h\363g'\235\302\337\250"
+	.string	"\302\360\222\006\355s<V"
+	.ascii	"\307\234\315\377e\317)kl\271\352\231z\346\345\345\037\3327Z\377"
+	.ascii	"\026]\352`e?\335\316\306\333\334`!%\325:\353\357B\337\374b\177"
+	.ascii	"\333v9O\363\266\217\365\324\213\354\315\027\255\263\006\306\372"
+	.ascii	"\236j{V\271\332-\275\312\017\355\366\257V\253y\372\233t\007s"
+	.ascii	"\223\030\346\036\341\346\0261\314\035\302\315\rb\230\373\203"
+	.ascii	"\233\333C\207\rn\356\f\376\346m\301\315\035a\230\033\202\003"
+	.ascii	"7\367\002\005\303\334Q\311a\356\003\316\346\215\204\3625w\002"
+	.ascii	"G\367\342\305\373\311\315\355\344\346nrs3\ts/\271\271\225\334"
+	.ascii	"\334I\302\334Hnn\243\233\373H\230\333\310\315]\344\346&rs\017"
+	.ascii	"\271\271\205\334\334\305`\356 77Q\230{(\314-\024\346\016\006"
+	.ascii	"s\003\335\334\256\233\273us\263\300\334k\233\373\335\334\271"
+	.ascii	"\315\355%\0344y\036\021"
+	.string	"\003\3739\001\336\026\205I\321\177\334\364hu\247\026\352\025\374\2117\325-\"W\022\320\222\320\031A \212SeFx\bD\217\374\b\357e\234\020\375\303\375Ec\253=\236\345\372\024\r5\311OG\376P\037\2760>\"!%L\370\020\277\244B\357iso\264\236\305G\262\3025\367\274\226\031_\266\310/\276\227\315\311i=\257\364\276\370\354\365\355\265\361\033\330P\020\235\370\205\276\bz7k/J4\203rEH\313\243\372,\321\253{\263\340\243\210\217\374\005\357f\262\221\345\023\r\304\001S<\277\243?@|\305\374\303\207C\206\317\342Q\323\212\031\002\rBf%4\241\330;\345\230\025D\370,\334\035\277\330\254\316\036\361\241\355b\301\276l-<\222\254\256\013\235\0029\370\335\257\331{\226\275i\341\217X\271\231\271d4\332{\345\275\322:\033|\207sd\326\234h\034\374\363\3475t5\016|\017\223\313>\336\216\276"
+	.ascii	"\276\013\245\372\305O_ny\3027K{\340}\352Ek\364\230zus\031\376"
+	.ascii	"\300+\361\331\372k\337"
+	.string	"\375\f\357h|E\263\313;\273\362\245\354*\353\325\342~0f\313V\371\352\335r\364\261\256p\341B\353l\373\354\224\032\215\331\202\017\365v;\031f\321\354\372\024x\265Q\201\313\226}% \017\264\304\240AC\353,\373A\2737~\236\307}\352%\374\3201s \352\231\027\031\367\241x\274)0s\240v\317d\244\200\231\322>\264\375\332\375\254Q\276\366>\377\003\211^\373^\376\223\027\r#\301\024\215\030U\311\032T4hPI-\271X\262\260PUcJ\251\\J\r\253f,oL)[\034T5~\252\212E\225\210)\0321\252j,C\344P\026[*A\324\214\034\312\033\311\034\312d\215\030,h$\245\2247\222\t\220\232\312\306\2242YEE\245L\016\245V\276\302\337\344\370E\2603tV\177\365\344\364\235\343\262\334\353\005\366\"A\322\334c\365\346\364\256\025<\277\230\315i\352\301%l\236M\035\276W\246"
+	.ascii	"\177|\256n\247\226\304\307V\364\204\376\266\307'\361\235\267"
+	.ascii	"\342\253\\\005\360\320'\036\340;\374\007<n[D`\030f6\3019IJ\262"
+	.ascii	"g\250F\007\337\353\321\323\273\231\334\337"
+	.string	"\322\206\026\352\003<\027\325\233\262[6S \311\273dI\353l\323\277\221;\321\330\252\207\022\246\030\226<X\nCy\016\2642\265\005\251v}b\354\322\302\310\351\333\360'\354T\231\2760\275\307v\372,uY\372\217\233\213\n\260+\353Zzh\277\226\333\210:28zus\"~\204\322#_\304{\230,U\372\217s\343\327\347y\215\236\322Z\234Z\\\332\036\025\207\372\344\237\250#\227\204%\351=\256\343\206t\005))D\335\023. >\204\361\221\017\342]\f\232\361?\316\215\217\3475Y\220\036\372\347gA'm}{lyfV\332\322\366\374m\237\336\301\237\270\353\263E\344\210\354\371\2009\362\217\336\343\273<FbF\006\324\360\370\214\017m7\333\362g\244\340\227hxEP\377\364\\\037\352\302\270x\370\017E\217|\017\037\2018\250a4&\025C3#\"\"\332\024T\322\001\301\005\204\030\345\244\263\r\021"
+	.string	"\255c\314\241\231MA!m\006\n\300RQ\306\272\372\t\340\252\201\211\007\331y\364\030\362\362\233\200D"
+	.string	"z\250\243e\244\257i\275&\t\230\376\020\334w\036Y\321\235\315H\343\325\230\n\026\310\345\3006A\350\304\377\225J\267\r\370\374\220\013\026\215\267pWQxq\302x\021\024\270\320 c\326\223\303\321\266"
+	.string	"\315\333[\033\351?\303Ve\3727(\275\307\024\b\205&q1\004\\'\003\032TL\237\367F\237\312\001]E\335\306]1\352\343\201G\212c%\032\274\272\346\207\223\266!\210\367\360\"\214\244\241*\n\304\035\227k\321\f\251\375 \006\234\r\373\021\020\253\374\375\215G\327\001 \024\342\r\210\304yJ\036\017\002+\275\036\317WA\232.\201\274q\0310\210\361U\265\357\234c\023\200\337\242\315\302\237?wxF\35609\033\210\346\272\263I#\346T\005\201\230L\225>m\212\344\217.\022\312!&\017!A\r\322\356\001?\023\232\f\217a"
+	.ascii	"\340\255\006\2414T\2129\"X|\036\240U,\220P\025\203W;\004\304"
+	.ascii	"\nt\352Q"
+	.string	"\347#\261\347\312#\007\226B\027\255+\301\220lI8'\3002\225\273U<\252B"
+	.string	"\t\260\346_\334\232i\346i\266\275\354\226\237\274 \331]\221b\021\n \003\341\321\242B,;\023+\311W\307\233@\270\377\2053\211\314Z\214\377\363\n\320b\333J\243\222\021M\033Y\034\266\317\026\333\233\315\301@"
+	.ascii	"c \350\270a\0334AHF\325x\206#&\333\341\243}\201\032\310\b\264"
+	.ascii	"W\230s\224\255O\261\246mi\273\241\215\022\237\350i\032@;\302"
+	.ascii	"P(H\013\343\013J\007\320\350\316\006o5+\253\234}\034\223\366"
+	.ascii	"\002*\033 \233\\\276\335\261\231\352D\367\223.\260R\024\252+"
+	.ascii	"'\364\f\204.\316\007\247\030K\210\033'0fR\0169\302s4\231\367"
+	.ascii	"\301[\214\244\b\313\202Kj eRm\364\307\006+D\206\ty\306d\003\312"
+	.ascii	"\0323\233\3149\251\257\337\f\362\307\256\367\221\350\330P$\261"
+	.ascii	"\027\222\330m\3336r\021\244y|\025\357\322\223\005(\177"
+	.text
+	.section	.gnu.lto_srxl2ProcessFrame.53.10be2fbdf11ac5,"e",@progbits
+	.string	"(\265/\375`G\002\305\023"
+	.string	"\266\245\206J\260\022R:sL\036\234\263f`\001\240\203\017\321\nm`\003\263\321\363\023G\220;si\267\345\354>\343b\361\266\315\376\342\277t\375\372\303\037\225\254}\t\247?%\311\216\262\230\343\nk\252\205]pJ\030\301\372=\331D\356\224\002t"
+	.string	"g"
+	.string	"r"
+	.ascii	"\365\247#\251V2\201OV\247"
+	.string	"&o\"\236\256^\"\236\332\266\n\203\233q'M\364@<\344\330\031I\325J\276\266\304q\027i\270\023\347\267|4\027W7\247\341\201\250\027>Lz>\274\321\307a\206!\201\034\032!F|6\341I\023\t\250\321W37,\360\03315\342\323\205\256\031L\273\007?;\370l\346\004Y\251\265z\362|\037n\220\333v\261\355\300\236\272\2668-B\247C\350\364(N\267\016\274Y'\372E:M\351\364\322\351I\247\017\240\001T\216\210\036\250\305A\326^\371\2432Q\245\237\003\177\373H7U7\372\221=Z\346*\274K\245T\255u\224\261\307\323i\337\374\240G\237|\212\333\201\032\\5d\365E\330!C\b\301\251\027\254N]\341\234\366\205>t;\321\206\223\324E:<\234l\214\333Z\001=vUsw\307=\322\r\370\374\364vG@:\245\226]\026\016\360.\236\004s\235\3071\027\027\361t\356\336TM\341"
+	.ascii	"g\351q\332\026d\363<\326\376\351\006\320T\224niN\245S\256\330"
+	.ascii	"\3351\212\370\245\020|\252\231T\366Y\274\005\212\317c\032\314"
+	.ascii	"<\017F<\375\006\235\020\312\031\302\311\315\322&usw\354oY\226"
+	.ascii	"\245\367\027\256\220\022\223\275\330^3\232LF\203\r\220\241\315"
+	.ascii	"6fk\261A\210\311^l\263\f\017fj#\206\245\250\\\230\251\305\274"
+	.ascii	"fj\257\331K\213\354\005\253\305\274R\002\230\206!V{\331h\264"
+	.ascii	"\332k$s\337\337q\242Wr\253\013k\255U,\231\266\204\t\363<\357"
+	.ascii	"\322(\250\221CAw\307\3579\213(\342T\324\024\262\"tY\033\262?"
+	.ascii	"\212Aw\227\312)\0200vA!\213\330\332\007O\022\f( \240\002\221"
+	.ascii	"\032\365\3270\2100\340\336\031\032\307\003m\305/\377q\254\334"
+	.ascii	"\206n\324LZ\342\354\366q\205X\320\3200+\025Q\360\254\302\226"
+	.ascii	"\207\306\030\276\177;\207\231\004i\223^\213\270A\f\206K\366)"
+	.ascii	";G\020(\230F\214\253\243\342\260\031!\343J\363 \023q\337\201"
+	.ascii	"\221K\005+\n"
+	.text
+	.section	.gnu.lto_srxl2ReadRawRC.54.10be2fbdf11ac5,"e",@progbits
+	.string	"(\265/\375`\357"
+	.string	"\275\f"
+	.string	"F\031ZC\020\221\223\016\033\236\013T\240\341\343\232d\007bD|Q\007@G*\223\025\007\006\220\246\350\271\326\276\261\026\323\372l(3\332\367\022\321\016@\r\024@L\220\377\340\324\273\200\"J$\202`\026I\333{K\231RH"
+	.string	"B"
+	.string	"E"
+	.string	"'\361\022&\2372\272l\340\274t@\221\241\331\215\230\307?\340_^"
+	.string	"\374S\021?\335i\236|\316\nuw\255\\\335\001\017.V:V)\367\321\n!\343\254\247\312J\225\271\361\354\2563e\305\341~\267\335\3006\003\373\"\001\3601\377{\374\235\323\371\322\277\b\264h\225\314\330\325Pcca\274\025/\266o\333dwl\273\264C\024\230\036Sr\217M\305pI\220i\037\346&L\217&\017\260\313B\223b7\"p\201\353\317\361\262\355)\033\017\006E\371)T'\312\215T1\323\372\240\332\342\247\327\b\254\027\252\254a[\364\023\243kW\265\300\227\271P\341\332\335\217\370\363M\340\337\365\254\033`\201\202\006\314I\326\330\021\225\332b\337\255\262\3300\275q\351%\021\007#\231\246}$\2008\031\351C\202\220\211B$\315\302\203\322\326a\020H\310Hi#\301J\033\246\205>\"\f\264\221` \003<\242\220m\030i4\332\260N\334;\345"
+	.string	"1\223!\375\023LU\261\235j\317\211\246\034\200\204\352\324\016M\310\007\021"
+	.ascii	"p\b\b\303h&\232\255W\364a\205\252\255L\261\376\022\236/nA\027"
+	.ascii	"234\366\200\021\002\025\016\356\002R\r\266\bMcPP"
+	.text
+	.section	.gnu.lto_srxl2RxWriteData.55.10be2fbdf11ac5,"e",@progbits
+	.string	"(\265/\375`\272\001}\020"
+	.string	"F nE\360\3204\035\002\325\306\316\355bd\033\203&\001@\362\370c\3375\342\003]|\364:\214\234>S\321\036\213J\374J\215\n\r\353D\b\303Sdf\266p\033\330c\377\364\262\212\235E\260\235\321\022\263n\264\211\224)\005V"
+	.string	"Q"
+	.string	"b"
+	.string	"(\276\343\030\345\320\356\007\030<\273\033b\220\354\361\303z\3327\361\023\337o\034\364"
+	.ascii	"\2734,xv\303\020\033\310\036\035~\300\365\230}\273\036\375\331"
+	.ascii	"4\036\326\354wD\234R\340\330]NC\374{~\376s\036\002e`\236\030"
+	.ascii	"\203\335u\2022\034n\275\355\002\266"
+	.string	"C\354,\t7\352\352\320\353\325!\245\3024\023\223+;\204I\005a\337\332\335\265\322l\277\371I\307\371;4=\312\322\032\226\026]\351PLgX\032\273\322WL\307\230\266\254\264j:3}\017\002\252\030\027V\273\033V9\366'\366\214\260}\373:\266v\315v\206\017 \251\240\223\212g\323\353\274A\211\224\f\223\rQ\212\002)\020\351\325\"S\222\206\276L1\370\230f0\365Wx(\0363l\374\226\353\361`\215\322\310\310\013\212\027`\252@\032<D%\351\2457\221\210\331.K\243\276C-\205\220\332\3212\225\244\bnWP\311\203\252\037&\205\3615UQ'U)W\316\020+')\332\271t\023,\233\210$Hy\361Z\270\027\217[\241\320\251p&^\013'\342a\026\013'\036\347\302\302\342qZ\270\267Vi\\\262\372)i\214G\352\243\376\342\200oc\007$$\233\216\364A\352\306I% 5%\371t"
+	.ascii	"jvK\007}\027\357\211\340\333<ZB\227\007;\233\234\344Ao\252\351"
+	.ascii	"s\036# p\202\021\261\355\001\362\320\356\016\214\241\205\346"
+	.ascii	"\353t\017\216i\237\333\200\025\023\2521\223\255e~q\251\214/\230"
+	.ascii	" \216\022$\231-\023kb\214\016\362\231\274\333\246\f\243\214\365"
+	.ascii	"\300f\212`\203\305\f\310\214^&gH\364\253\271\260\205\220\223"
+	.ascii	")\020./\332G\006"
+	.text
+	.section	.gnu.lto_srxl2FrameTimeUsFn.56.10be2fbdf11ac5,"e",@progbits
+	.string	"(\265/\375 \357\235\006"
+	.string	"\222L.3`m\322\001PX\003\313\b\356\224\302\247\326\200=P\202\bLx\262B4k\265\376s}!\340\027\252"
+	.string	""
+	.string	"\024PW*zA\302\2175\377Y\262\267\224)\005\266P\b\r\230wq\230\347\036\030\024\034\234\345]\034E\340\nb\341\271\210\252zN\212{\365\244N\034\245\260\037\362\b}\016Kd\362\326\233\237\211\336R\001:\234\f\331q\223\232a\237\255zl\247S\013:(\023%\273\026!\320\2364\222\217m\215-\371\036\377\320\030\262\270q\005|F*DRv\243\233>\020\275\261\013Do\252q\370\204\376A\316:@&\326\265yV\022v\327i]\027\267\336\366\201m\003\333\030\001\b"
+	.ascii	"2\003\316:#f\b\3055\3616\002g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_srxl2RxInit.57.10be2fbdf11ac5,"e",@progbits
+	.string	"(\265/\375`\271\007m,"
+	.string	"*NP\021E`^N:s\206\177\013\036l\325\031l\313\026\373\225\315\360\205\242\007\034o}\252\347r\022\337\365Bc\203\022\"j\262zW5;b-\371P\247\210\356B\305\303\037\237\nX\370\013\" \3757k\304nB\366N2\377"
+	.string	"\362"
+	.string	"\b\001gL\317TV\275\343\227\232\270\020\351\321w?\365\313\316\354_w\233\3258sr\231\257\324\346\027\r\357r\262\247{\261!\234Zf\244\211f\234X\321\321\256\220\036\025\236wy\243idm\367\305\256\345\351c8\036 g/0dr^2\350\004\351\321^\236"
+	.string	">\232^"
+	.ascii	">\372 \302S\257_2\001\362\2571\3062\273\234\227\303\273\244\205"
+	.ascii	"?\227\357\323\256\017\002\205\202~\276^\312\303\350y\355\332"
+	.ascii	"\207z\220wa\203\3241N\354\016\311\325\221\003\271.\304%\305\312"
+	.ascii	"\210\r:\027$\317\334|\315\252\310)\240\255J\222\337\326}[Z\266"
+	.ascii	"7\204\344*\353\351\232U\326)d~H\212U\322\362\036u\344\370\204"
+	.ascii	"Pe\207\030 \322x\376\316\352\246\234Ie\321\363v[w\200H\035\247"
+	.ascii	"\005\343\234 UH){\202\t\371=\332-\032;dmhH!\267\274\0139\347"
+	.ascii	"\266G\344\325\033\300\273_\324\335\"\272y\016\002oB\200 \340"
+	.ascii	"v\343*\020\363\210e\333\210Hq:\022_c/\317\230'l\354\267\217\346"
+	.ascii	"iJ\364\237\364\211\024\366\307\024t\216{Z\305\325V\2449OI\350"
+	.ascii	"\2371\301\"}\202\343\236\371\004mx\356\306\242l\023\275\312\356"
+	.ascii	"\035o\321E\265lW\035\216\fn\312\366\371\231s\316\347U\236\t\007"
+	.ascii	"\335\242{+@iT\\R\266\3316\347\037\341\356~\3611G\005\230\344"
+	.ascii	"\234'\364\303\\\214\213\376\223\243M\003\311\376x\264\217\204"
+	.ascii	"\217^\031s\343\022\233\213\262\315{\343\306\272\262\356Uv/\241"
+	.ascii	"l\220\313\033\267\276^\335Em\233h\350fo\341\227\277\201\217\375"
+	.ascii	"\003\332v\020x/o\241\237\275\203|\266\177A\266}?\333\275\237"
+	.ascii	"\355\324g\033\367l\243\251\3553\265}S\3336\265\375\005xH\234"
+	.ascii	"\235\236\034\315\234\2014\377\3448\250\231\257\237\375^~\263"
+	.ascii	"\363\354\331\375\245\217\026J\272\344\330\336\360mKe\2151V\251"
+	.ascii	"U\307\252\003\037\265e\024,\360\336\257<0o*\177\255\302\303\377"
+	.ascii	"\313\352c\005\222\236\317\321\333\275\"\327 \366G|}g\262\326"
+	.ascii	"\205\032b\363J\304n\035[\263\320\373*I\346O\350\016\335\273\203"
+	.ascii	"\215\357*{\200\031\362G\332\273\r|(M<\274\3646\260\320\255\352"
+	.ascii	"\363s\353\177\316;\"Y\026\326\273J\f\245KI\332+\360\275-\310"
+	.ascii	"\340\272W#\277\273\227h\313\037.-cAk\272\200\341]\345\361\033"
+	.ascii	"2Xp\r,\274\007\266\324!{\233\262}\272\201\355\345\327.\334\275"
+	.ascii	"&Y\225\366G\3415:\"\027g\352Bu\257K\326&\013\2308\271\334\n\245"
+	.ascii	"H\240\346\327\n6\345q+\225:+k\230\2025\313\357\254Z\264\002\345"
+	.ascii	"9b\255[0t\206\303ih;b\251\331mx\333\221\025\272+s\302\227\300"
+	.ascii	"\335\035>\247Do\311\234\335\334\327\220\022\270\345\034\365\243"
+	.ascii	"\234\366p8\037\322\234\263\204~I\207\221\364B\211\230\241\251"
+	.ascii	"H\\\3621)\021\223\232\226\210<\244\246\243&\022H3\222\232\224"
+	.ascii	"j\214p*\002a$\275P\"fp*\246\355\302\350\201\f\247\"\323\320\251"
+	.ascii	"8TJ:\2321tQd\032\032\025h\342\022Rq\330D$\026\207\277e\376\365"
+	.ascii	"\352%\260(\3064 \321\315\343\207\231\206\373+\016\006o_\210\272"
+	.ascii	"RA\273\343\277Kto<c\344w'$\321\204%\201W\251\205\"\251f7w\202"
+	.ascii	"1\211\b]e_e\303\276\333\202\354\315bY\"*\033\035\265\255\r\037"
+	.ascii	"\365]\024I\265\260d\357\266\rb\205\254U\352\233ZG\255Cw\251\310"
+	.ascii	"\\\275\203\323\333\273\247\030\016\266[\325\263\202\331\037\323"
+	.ascii	"{\227ke\342H]\250\376U9\334\326\207\375\241\312\251tj\235Z\207"
+	.ascii	"\217JH\246\331\315\251w\252\037\004* {T\233\226Gq\205\n\346H"
+	.ascii	"\216!k"
+	.string	"C\303J\331~|\005]e\237\371\236\027X\2251\3157t\373\354\t]\340\255\212\201\361=\320#\200\217\250a(\343\024T\n\r\215H\032I\222t\200\002\221\261#z\021P=3\251$I\n\212\031\003+PH1\266N*G\251`O\330\",h\"\266\334\356\247\013i\235\313\270U\265\272\357s\3034\256\f@\"<>\263\326 \243\256\264\fDX\013//\212L\032\242\251j\231\360?\373\220\331wc\303])\205|\273\243\334\3332D\0166\355\240\217\266\216\250\367\342(\320x2\357kF\022\n\b\"\231\217\234r\241)F\200\305\300Bq\302d\342\n\336\277W\220\257\254\223oL\026\353I\300;F\3612>\303\n%p\016ZT\307\370\221GZ\214\tM\264+\316\n\246\211.\231\016CK\304\r\343J\026\303@\223\330\313#\301.\357\326\277=F$y~\212\320\243/\203\227\303B#\302\240h\254\361K"
+	.ascii	"\035\036w:\351+F4\004\032\325(\336\321\236}\242\023pY`\353\257"
+	.ascii	"\310\024\211>\257+\241\241\rs\220\366?\312\220n\212\200\337\200"
+	.ascii	"\344\317O \330\330\300s:6\025$\306\354\3207eU\235\332\251\376"
+	.ascii	"\0233\213#vj\314\351\206\344\363\366\024\232\371\325=*"
+	.text
+	.section	.gnu.lto_srxl2RxIsActive.58.10be2fbdf11ac5,"e",@progbits
+	.string	"(\265/\375 \366\305\006"
+	.string	"\302\f/5Pm\222\016$\243\252\022a\341\312Z\322\n\030\242a\fd\031]\253]\327\266\265\273=\277\t\322u\003(\236\233Y$\b\030\272V\200\\\211\202c\267\326\376&2\005k0\231\006\216\265y\034\353=0(8<\215\265y\230\201+\210\005\353ET\225\365.[\026K\210\004!\304\276\236J\021\261\"\021\254\036\375\360\\\215%:\256Y\251\333\251\224*\002T\204\334\3517\220\303\213/%\261\364\273\321\271K\t0Mh\035\215d\222N'YB\205\230\376\317_\316\034|\276\272e\220\00468D &\231\333C\214^u\327mG\023\260\021I\246\201\352,\b\231\271\3134\212\216\375\r\376\202\337\"\t"
+	.ascii	"2\001#8\343\216#D\250@\\\023SF\220%D\016w\316\324\316'"
+	.text
+	.section	.gnu.lto_srxl2TelemetryRequested.59.10be2fbdf11ac5,"e",@progbits
+	.string	"(\265/\375 \343U\006"
+	.string	"\322\013,3Pm\222\016$\243\252\214\252\353\326\r(1[\213\2007Wi\037(\2245\373w;\273C;o"
+	.string	"\305s3\213\004\001C\327\n\220+Qp\364\270\305\275e\nc,\027\b\r\225i\032\252I<4D4\f\225i\026\203\247\t\007\252QL\023\325*X\026C\207\007\036\374|G:\252\256\350\212\315\325\252t7\001\225\016\0076<\227=\3269\344\370\002$\206\376\373\220 Dt\365\"\313\004e)y\"\231|\374\234\257|Q\340\\\025\363"
+	.string	"\025\200\214,HP2\261\206\035\255z\325\255H\031>\030%\326\325\351\t,d\346g]\032\035\373'\374\b\177F\b"
+	.ascii	"2\003\316:#h\b\3055\2610\"/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_srxl2InitializeFrame.60.10be2fbdf11ac5,"e",@progbits
+	.string	"(\265/\375`*\001\205\f"
+	.string	"\246\026Q= 1T:'\006\360\310\002\257U\241\234\214\335\3351g\235p\264e4\035\016Y\266\001\033\373\b\333qB,A0\244\314\375\013\001\bQ\300r#((k\340\374\217l\314\020K6\3312\245<"
+	.string	">"
+	.string	"C"
+	.string	"\001vO\255\026\273\243\001[\266O\217\037\240}n\027\240}:\264m|DmE\325\"\261r\354.'7<\274\206\376G\034\200h\022]\037\nv\327*\232,\334\362\266\013\330\276\330\177\021$\"H\210\240R\237~H\373|\230(\335\020/\2144f\217\"\225\031\354g\273\273\226'\373\253?\223jU\365!\221\017%\323K3v+\304t\354k\272\340"
+	.string	"\261}\265\037\342\"\302\257B\017\030$J\361\260\232\016\022\275\206\333\245e\322\3360\320\213\276\300T/\nRd\237\0058\241\241\342+8\226\004\237-\312-\243\301S\3408\n\317\004\265;\272\350\2378\253\343\316\243\027=\337K\200\333\356\"\360\003\237o\201\264\006s\300\001\310\3738\220\307=\340d:\234\306\3738\f\305\035\204\215\307}\272\316\343 \343>[y\362\006\003\361\032\311\t\226\250J\002\227*O\332\341:\f\216\237r\006\324\213\240\366yY\251\021#\036"
+	.ascii	"2\241]h`x\370\"\226\201a\267\243\231\017\201\346&\030\320\017"
+	.ascii	"\020\214\247l\350\021\332\360l\365\231\256\312\006\254\273\004"
+	.ascii	"I@\030%8@\273\241\340\226R\242B\203\331\330\001,c\305\301\250"
+	.ascii	"KX\315j4\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_srxl2FinalizeFrame.61.10be2fbdf11ac5,"e",@progbits
+	.string	"(\265/\375`\255"
+	.string	"M\013"
+	.string	"v\226O@\020Q\225\016\210\242\234\004(|\205\336\007\203\303:\"$"
+	.string	"\353\215\357I\013\242\266.\240\037Q#\350\211k\013\fBs\332D\330we\002JE\200\240`\030\004\025\344\343\213\343\356\373\266\306\215\244L)<"
+	.string	":"
+	.string	"="
+	.string	"\273%\027\250]\220\200\005P\036\r^\344z\244<\344ztg\33388b\001\224\230\261\201\005kw1\025\361\356\331\371G\361\312'\362\236\023\003\273\353\374D\036n\275\355"
+	.string	"\266\007\330G\020\256`!\377\371-F\333ZeP\317\006\275\324\020\366%\273\273\326\222\375\323\0375\255\231\316L\337\222\311\bu\020\235C\270\033\ns\254*\306 a\261\375\264o\342'\272\237.\374#\252\366\002\006\023\222G\266\311\177\252\032R\336\251\353\232z\321"
+	.string	"\002\224\241;2\252\315y\240\022\024\215\224\n\203z\256\344\301\257\340.5v?)\256B\363M\217\246\300\345\277G\237\273\036\243:\035\316\201:\303\024\200\340\3318\314\263a\0228\r\"`\331\306a\230\021k\0236\033\326\321\264\r\263\200{\311j\311\007F`k\365Q\220\375\314\345\2778\214\214or\002\215\346zT\360\001\007\353\306'C\203dj\017"
+	.ascii	"2\241\265h`\3610\002,\305\034\326\356`\302\250>$\265CS+\\\324"
+	.ascii	"\322\004p]\354jV\243\301]^\264\223\f"
+	.text
+	.section	.gnu.lto_srxl2Bind.62.10be2fbdf11ac5,"e",@progbits
+	.string	"(\265/\375`8\001\305\f"
+	.string	"V\227TD"
+	.string	"\221&\351\034\232\rC[\300E\333\372\224\2066\023\350\373\023y\245=\375\311\364|\336n\346<W\350\177\030\2105\277C\213L\371h{\033b\001"
+	.string	"P\213\226\r\234Z\234L\303\247e\370\220\267\277\221FH\222\001>"
+	.string	">"
+	.string	"C"
+	.string	"\035\222\323\231r\2502C(8\366\300\346x\351\316u\354,\340:V\324\316\214*%\001\323\214\207\030\034\231\211A\023\213~\242>7g#\215~\032\006\231\331\267\221D\\x[\003m\023\264w\001/\303\234t\227\316\241\364\355\250Y\303u4a\331\241B\265\362V-j\364 \211v+3\263\260\245}\257\007"
+	.string	"\220r!\375a\225\tb\245#\273(s\342\323\267\317\325\243\257\230\205\350\223\312\031oE\2202u\034\340\250\360\3014P@x\006l#\034\343\315\3060\226\311$x^\367\\\307!\207\345\032\237_\214\314U\350\200v\321\027\013\267\270\304\005\256\226\344\230\254!-\206\271PC\216\233\033'O\244\007\024J@\023\254~@\026\\H\321BX\212\206\225\200<$\330G\013a \037\315LF4,C\226i\230\007*\267\022\266t\223J\321\255\300\rU\2612G\210|z\025\314[\365\343u\256\214k\324\034\312\200\322\3266p\360\002\034"
+	.ascii	"2CO\025\330x<\264+\002\270\016T10\0063\327{\212\235\274Q\200"
+	.ascii	"\270\261\305i\214\331\310\030C\3000h\003\b\342j/h\007H\f\256"
+	.ascii	"\021P9~T u\031\375\325e\001[\300e^\264\223\f"
+	.text
+	.section	.gnu.lto_srxl2ReadRawRC.part.0.82.10be2fbdf11ac5,"e",@progbits
+	.string	"(\265/\375`_\001\305\016"
+	.string	"\226\235dC"
+	.string	"\221(\035\037\021\252\252\267\234\240\210\301\245N\350\b\037\264\32636\031\f#rRG\261G\252\2431\352#\2417\210\377\245\346\177\231\3775 \250w\336\217\r@6\004U>\234\n\222\326\332&{\023)S\nP"
+	.string	"P"
+	.string	"O"
+	.string	"\333\212y\331\355\024\374\031A\374s\027\355\2438\261l\373&~\002\345Tv*,\r\313\207\222W\314n\267\375q\234"
+	.ascii	"\374\313\017\200\177*\342\251kf)?MR0\\\017{\366BC\206I\312\206"
+	.ascii	"g\3073\rdw\0359\334\357"
+	.string	"\266\033\330v`\037&\351\030\323\032LC-\375\264t\366\327\2570\235w\371\017\300@\002\017\273(\261\032\033\342\275`\261\017;\331\033\033eo\374\362/s>N\335\242\274\2649\037\250\257\260p\216U\315PY\240y\227\323[L\007\272\325\300\262\246}\025\357Po1]\300\006Q\363\265\272\241\272\013.\345\257\370!\360O\323\237tx\232\n\365\253\022y\303\300L\237~EB\2251\253f\372l\224\334\260Ao\021\022w30\360Y\\\b\371+\177\276\t\376\245\036\366\273F\244 \311X\252\313\232=[m\3311\255\211\351L\f%\t\017D>\"Qg\202G\363!uH\021>!\020IT\001B\211\013`\217\007G\244\304\215l%n\023\201:\241\315\303\215l\036\005<\242\360\3416\322h\304m\033\333\371l\265\345\303\336\221\031\325\350\211m\215\032\204DU\252.\333Z\214\247`\324\214~\005\002\3360\240\246\001\033"
+	.ascii	"\33774\031C!\326P\206\020\201\251\220\314\f\374\245\002\001\344"
+	.ascii	"\201\021\256\030|\261\001\221,\224\036\342\334\f\303Uc\001\335"
+	.ascii	"\254\202\344\274\223\235\366\240\335\257\204\300\275\233\303"
+	.ascii	"\204g\330H\r\244y\364\265\005\017"
+	.text
+	.section	.gnu.lto_srxl2ProcessFrame.part.0.85.10be2fbdf11ac5,"e",@progbits
+	.string	"(\265/\375`>\002-\022"
+	.string	"\326\237qH\340\262(\035B\261e\367\034\216\001\023\303D\350\004\003\005h\340L\222\320\257\017qe\302R\357y&I\fFCo\207\316\267\334\023\331PEL\bl\022S\302\214\347h\0275G\367\225q(G\317F\201M\220F6\331;\245V"
+	.string	"b"
+	.string	"]"
+	.ascii	"\325\n\272W\227\335\313\257\261\350\325\237\235\346\365\025\034"
+	.ascii	"\274\224r[(\354\2201\013\332-G^\235\240{\365^\200{\335N\200{"
+	.ascii	"5i\377\274\334\r\201\320\241B\013\332\335\217\312\234<\235\033"
+	.ascii	"\351\303N\237\363\031k\021\3619\340"
+	.string	"[\210dw\335\215\270\353m\227l?\260\247,/\265\007\005\217I%\322+{0\223J/\257^\316\254\260\354\226\264\233\345\205[^J9\323\322 eG\\n9\360\260\311\244\350\301\343\3658\337!\361\343-\356\302\026\331u\035S\237\232\310\345\351\227\244O{\216E5$\016\371\233\023\017&`\027\346\004\017\235\366Y\334\346\365\233\023\003\345\206x\215\037\006\017\025,\314\307\354}\2400\3733N#\274p:q\257\224\202\320I\257\362\303\367y\f\021_f\024\bR\0043\030\027\232\022(\263\346\177\305\371=\207\201\301\273\314\251\222\371X\t\367\2723{q\231\001\331\314\332\2441\246\333\267\335]S\030\033d\232v\32334\375\3563\021\300ew\245\346c\003\3160\002\303\024\353S\211a(\242\016\200\254\023+\002\030\246X\252\026\004\223\021\200KTQ\243F$\r&\343\3523\031?U\352\024~\250q\365\215B,n"
+	.ascii	"\307\217%\212\343'\262=O\202B;\230R\032c\021.GH\207\246\002("
+	.ascii	"dNz\235\3430-\230\331Ey\314\267\361\033\022|\331\253'\230Lv8"
+	.ascii	" \200\002\221B\363\3334\3200\377\303\342(\024y\017q(\320\201"
+	.ascii	"\377\323Vim\311r\335\235\222\320\034\032E\336\261)\306!\311\253"
+	.ascii	"\332\334\372\215\224k\317D\3710\033A\212\016]d mJ\242\205\373"
+	.ascii	"c\372\023\337`\366\002:\\\307\035\331'\224\340\021\215\035\226"
+	.ascii	"\265\264*U\352CT\003\013\026\031\214\353\342Zi\032\203\371/\235"
+	.ascii	"\235-\177\332\3136\031u\255\226r\036O\027\246\311'`<"
+	.text
+	.section	.gnu.lto_srxl2ProcessChannelData.part.0.86.10be2fbdf11ac5,"e",@progbits
+	.string	"(\265/\375`\266\002m\023"
+	.string	"6\241wI\340\322&\035\252l\264\313\362X\324\357*CL\340K\t\242/\304\226\346\344\214\317\377\t\001t\352-\214\300\353CY\216\357\247-\3744}\367;\331\002\212@\246)\216k\242A\211\360\035C\260+\327\345u@\237l\333d\357\224\002]"
+	.string	"e"
+	.string	"`"
+	.ascii	"\"\036h@\026t\257.\273\027\207\001{\f\226\256e\326\341\324\202"
+	.ascii	" \355\226\t^]\322\275\236>\240\364\312\235\244\364z\032\333\257"
+	.ascii	"\231a6\217\227)\366\265#\230\332\217\335\375^)\212\303N'\007"
+	.ascii	"\363\247"
+	.string	",\246\345\364>\347Z\254\270\311b@|\n8g:\331]w2w\275\355\006\266E\233\316\265!(\007:\r?\310\236\355\207\364)Vn\314lw_\363m\366~\310\035\035;\220v\327B\367:\375\332\313\3179\317{\356c\317\346U\276vtT\252\216J\201\221\215\325\320\330\"t\2578\257\337\254\234h\207u9a\343\346\315Ji&2b\303\221\202W;\350^_\336\306\336\253/\3433`\257\321\360\3450\0137\373G\277\241\362Ux\305\232\227\261J\257\247\367yI\016\037.B\270\314\333\2444S\356\334\356\256\251\t\3334=M\323\257$\007D\354~\270%-\211\032\304\342=?\317\017\364\033\375E?\316\277s\223}\277\310\3506\210^CB,Cfv\313\241\023\331\253\201\340\024\033\331\030M\310\214\252\023b\t\256\013)\252\"\301\025\327\022C\324\030NH\221\344\350\205-\260U!\\\245Z\242\n\005\327\030"
+	.string	"l\201\020\310\007\341\n\034Q"
+	.string	"\250HPBJ(\212 \006\224g\224\t\203\024\327H~\256\361\023S\340\352C\215\344gB\300\254\f\341\370\265X\254\361\233?q\241/\246\224\322th\222r\226\226\360\2448.\353\321\335@\351t\322\303\310\274\314@\250qP\210\bRfhd\342\202\202\264\030\220\002\2212\263\r\020H\306j\n\3224\006\355\210\"\2735c\376@\2045Q\367\013t\342"
+	.ascii	"\252\005\275>\315\347\335P\026\355W\024\020=\346\353Q\272\264"
+	.ascii	"_W\240\250Cff8\207\231\252\367\314hm\264a_\271\365\034\250\306"
+	.ascii	"\312\231\312@\202}\347\357y\243a\"z\032\263\025\354=\264DG\323"
+	.ascii	"\254p\222\263\327\325\037`Q54\360|\220\331\235W\037s\\3\006\360"
+	.ascii	"G\020\023\305\371\350\363\003"
+	.text
+	.section	.gnu.lto_srxl2ProcessControlData.part.0.87.10be2fbdf11ac5,"e",@progbits
+	.string	"(\265/\375`\351\001\275\020"
+	.string	"6\235jH\340\260*\035\350B\036\210\201\244\207\2108\246;\035$Y\222A\017\006\346\0238l:\005\342\254\344:8\2452\262hk\356-\311\035\013\254\276\f\031\036\362\300\016\351c4\031\224q4F&\022\220Y\356\035\213\244q\243\275S\nO"
+	.string	"Y"
+	.string	"V"
+	.string	"\257\336\013t\2576\313o\361\347\325\242\020\326Md\360\266\204\347v\003b\306n\031zu\002\357\325\244\215\363r\3675\023\230\315\306\356~\264v\362tvH\277u\372\333g\215\027\257\233\233\007\224O\002\357xDv\327^\312]o\273\201\355\b\366\244\020\263\226\332\367\372\232_\346\177\371m\267\177\202\364a.\363\231\337\374\251\241IMP\271\037d4\251/\007Y\007\312\214\212\003O\024B\332bT\235\030\025h\300j\200Y\311\211\274\277\220w)\371\240\035\326E\313\321i\037\305K\326]J:Y\307\n\314\204\301\253C\336\253\313\033\350\002\363\b\272\323I\017Ky=w\025\027\374\0216\205\363\261W?\354^Ok\214\0267T\\3\007g\034\217ee;\333\005\257\277\035"
+	.string	"\316\205Mk\346\230\224f\332yg\251\b\3333==\323\357\024\310\020\020b\367$\007\307\316\352\n\022)\214\362G\253d9\221\031\005z\243q\364\200$\024\307SH\372\200\343h\234"
+	.string	"\232J\343)%a%z\210\340\310\b\264\320\215@8\251\302j\022\210\210d%\242\276\225\370\235J#\323G\022Q\037\310\001\207\030@\361\033\303P\374\346E\\\364E)\315\266\307\244\007\273\320\355\n\245\371\230\003\340`\330l\240-O\312\3421\032\001. \220\002\221\261\341\003B\0059W4\302\243@P\202\276\340*\362\240\263\204\302\336nv\271i\243\214\001\030@^\241E4\f\363\303}{\340C(\210c0"
+	.ascii	"\r\3238c\253\321\273\327\225\324\261_\207I\202\214\022z\210\360"
+	.ascii	"\021\314\311\016\217{\206J&-\273d\243\256\26561I\247\035g\331"
+	.ascii	"k\261 \347\003\351Vo\377\to\f"
+	.text
+	.section	.gnu.lto_srxl2ProcessHandshake.part.0.88.10be2fbdf11ac5,"e",@progbits
+	.string	"(\265/\375`;\002%\023"
+	.string	"f\243|H\340P%\035X6\263\203\330C\323lD\315o=\303\302\020\224P\t\2039J\326\265\320(R\364\020\334\027\203bC\231\3649DTR\337\316\314b\032Jc\020\303b\310'*\243\005A\223\270z\231\251\033\231\264\275\311\336)\005e"
+	.string	"h"
+	.string	"d"
+	.ascii	"O\272R\3546\234\017\3305\212A\265;.8\365Hw\352\361\007\352i\367"
+	.ascii	"\002\365\324\242\215\343\343\356k>=N\267\335\365f\207\213\247"
+	.ascii	"\334\224U\364e\247\217z\202\254\0244\256J"
+	.string	"\3202\234\2233\232\320'\307\200\347\266\001\204\266\303\005\320\352\251\361\250K\037\232\216\224\004^](\273\353N\303\355\272\355\025\333\016l)\024[D\253>\230\260\311\211h\232\243\037\33369\211\231&\344EJ5\037\254\335\321;=\324\357\364i\337\276\223\350\223x\224?\240\236j$\311S\r\267C\343\006}\350\310\306x\322\2356\211g\2721P\314o\362\307\251-\342#bg\272\021\221\215+\013=\260H\272\355\002\221\234Z\001\026\310\345\227\304\333pB\306\r\002\362\245\035T\266\2429k\366c\352\234!\323\215\035\251e\233\345V\223\316\220\na\223\323\247:\n\320G\362\204\027\371\331\251\377RO'\214Y\226\r\363\251\230nw\247\201/u\341\345#\235\316\327\324S9\247\204d\020)\331r\344\226\2345\317znw\327\323\310vIsUzVi\371\245\377\036#-\004\020\355\376l\355\b \314\347\002k\221\371\\"
+	.ascii	"\2000\231\327\f\f\f\273\020l\371@\227j\226\022\023\n6!\314\263"
+	.ascii	"\t=\231\227/\306c\ta^\t\002\277f\300\320\263\360z\205\336\207"
+	.ascii	"my\224\234\251C=\254~0@\355\344`\356)\325w\361\027)\017TT\262"
+	.ascii	"N\334rp\006d\b\210=\204\312M;\302\212\374\314\"<Sf_\305WT\220"
+	.ascii	"\360}uVI\351\030\232\367U0 p\002\031Ih\007`dE\001,\005\202\356"
+	.ascii	"\336\013\331\266\024\247Z\212b\267\204s\264x\034\211\037d\372"
+	.ascii	"oi\360\326\"\236\022\221]N\2543\326:<uds\246\013\3306`\230\007"
+	.ascii	"]\202.q\251\033\013\357\030\212@\201\362\270\212A\252\270\247"
+	.ascii	"SS\263\312\265eQ0;Z\262\270\210&\222\357\016\367Y\0016\222\344"
+	.ascii	"\334\213\3704\030\367.<\006"
+	.text
+	.section	.gnu.lto_srxl2Process.part.0.89.10be2fbdf11ac5,"e",@progbits
+	.string	"(\265/\375`\353\0015\022"
+	.string	"\306\341wH\300\324M:d\220\003"
+	.string	""
+	.string	"\376\313\027\365\247\342\334\365\340U\224\200&\031$%\350itt3\032\352a\002\177\266\347'\232[\\\363\027k\233\364\026K\331>M\r\"\273I\314g\332lo\273\214\004\2548\004\244\221M\344N)_"
+	.string	"_"
+	.string	"c"
+	.string	"{cj\332\035\037|\232\201\367\351\361(\335\247\367\002\335\247\375\031\266g5\323l#\037\203\3669N\2248\242\332\335\357Sa\234\366\311\251\354h\276\211\355\346Sr*K;D\233\212+\327\300\007*\305\211M\207C\221zQ\344I\227;\266\034)\t\274[\261\354\256\275\236{u\333\031lK\260%\205\332\235[\275\331+\351\371\361\347:i\235\322\222\223>"
+	.ascii	"\003\037\324.\212\252%\3733\237b\034\351\366\221f~\222YG\263"
+	.ascii	"\033\325x\001\316\270\265\332\217\314\372\364o\274\210v\243\032"
+	.ascii	"o\233\274\035\023,\216\354\216\016>\035\301\373\024 -\345\307"
+	.ascii	"\331\211l\022\214\313S\263\224\366k\334\006\355D6\037\260\001"
+	.ascii	"R\211\021HNU\355\227\013\362\342T\b?$\364\306>\217\031\005A\273"
+	.ascii	"{\321\306\360'\r+\336p'\016)Cvw\245iD\007_H\246*D\354\361\231"
+	.ascii	"\256C\326\002Ae\365\200\222\261\342\352+}\311\345\013\031\304"
+	.ascii	"k\372\257\356S\247D$8\262\312&\322\216\201\311\213\327'\3757"
+	.ascii	"\036 Q9z#\025\310\001`8\341\203+\326\202\221\2010-0\200+\326"
+	.ascii	"\212\275\270b^1\031\231\005\232\360\304`\212\n\fM8\363\321\204"
+	.ascii	"\237\314\253\025\363\201\341\314\227r\300\260\020\256\360\213"
+	.ascii	"\301`\341\307:\013\216\346X\247\367\226\316\367\361\037-\025"
+	.ascii	"\\\344E\227\356s\336\202P%\321K\247)\251\026\234\002)\r\321\300"
+	.ascii	"\261\352\302\372\017\211>Q\252@\266EtS=\024\021\321\t+ `\202"
+	.ascii	"1\007\251\007\325\t\2009\033\211\320!\024\313\316Up\350Y\323"
+	.ascii	"\200\332Yd(\2671\301\310\302\200\274s\224\343\"\n]\216r\300\343"
+	.ascii	"d\347\033L6U\236}\020\275a\306p\342\310\320\032\255\bvr\007m"
+	.ascii	"\226\205\002\206\"\343\n$\251\323>\264/0:\257,+\224\227\\\325"
+	.ascii	"\036\006\206\320\361\271\327\2061"
+	.text
+	.section	.gnu.lto_.symbol_nodes.10be2fbdf11ac5,"e",@progbits
+	.string	"(\265/\375`\341\005\355\027"
+	.string	"\206\243\210G\200\234N\007yn\227\002G\267\374\353\205\320\\o\325\327\256G\305\231\232\315\374`\334\323P\033\251T\237n\331D\321\210\210Zq\273\236\202\202\026\266\273\377CIo\210EH;\266\036\210\371\007]\005 \033C\226\"\311\224\002r"
+	.string	"s"
+	.string	"v"
+	.string	"E\325\274_\214\326\205VD\304\023\205("
+	.string	"\"\201\375\360\254\305\303\263Z=;<\247UO\3234\345\360I5x`\003\002\253\001h3<\243U\f\257\344\273\246y\231\\x\306R\231hAA\005\237\243?\252\024|\226\211\023~\326O\t=\313\304\b?\020J{>"
+	.ascii	"r\360\303\352\314}\336\006C\366\232&\230\027\3633\227e5\200{"
+	.ascii	"\357e\360L\225\231\311\266\\\326\304\347)}\237\251\374\263\225"
+	.ascii	"\036\317(\217g);\236\301t<\207\345x6\2468~\352\306\263\230\215"
+	.ascii	"\347(5\236\253\364\275\227\271G\343\231\254g\274T\225\361Q5I"
+	.ascii	"\310\306x\250\n\343\237^\274\223\013\036\263-\370\250\023\306"
+	.ascii	"\345\215\3057\255\330Y\025\006\312\\=RM\361\302\212\202gO<o\251"
+	.ascii	"&\336\250\226\320\245V\037\254\372%\252 \0229\253f\304\007N\325"
+	.ascii	"<\306\210\231\254\036\236\343\334\226vn\305\264s\234\311\243"
+	.ascii	"\353.\264\256\264\234\316qg\373Q\r\013\bR\316Ic\363\210kM\b\344"
+	.ascii	"\274\335\222r\245\0226/\245\2347"
+	.string	"\332\034\306\f\212\326\260\347\210\307q\3056j3\277rv\334\252{\315\220\364(\334\361\3362\312\3616\273\236\241\351\242\2053\300\201\212n\234<\233\263<\361\"RT\035\353\371\312\371l\346\343\371\314\374L\032wD\336\305]0*\350\013\244\202\0164\025t\362\334\352\023j(\300\227\037G\204@\2345#\231\023\320\005\234O@\277B\373\007\f\222\254a\351U>h\0139!\223\306\255\311\261 \\\303\322u\266\332\223\21093,=\007\355\0336m\2044\225N\242\302\222\323\024\337\226\374\312 \2562\242\357\347$\312\364\023\372\274\213=\237\267Q\327\363\346\365\034\347\245\033K\214\355\270\343\005o\250\201\fDE5\243EI\312\r\300\002!*\262\003\021\240\220F\031\"\201\220\0042\021\205\231\007\2607L\350x6\347\001SU\357\335%\177wLP\240\335\247G\360W\254\302S\306\354\021r\263\017_\035\345\"kW<\357"
+	.string	"\246J\313\341\204\326\352\354\035\243\211\245\",5P$A\275\262\312\300\361\251\230\303x\236\332`\362\227\233\232l\345=w\366pfU\270Y\013\250\227\033{\037\220\221\\\234\333\272\273jFY`~\364\252\244\321r\213\253'\374\201aNY2~\323\007a\006 \347_T\3415\365\241\267\3042f\310\027\252\330\0210wh\261\264\206"
+	.ascii	"\362@\316\201\313\207)j\330\340\220\317\225X\032\340\322\227"
+	.ascii	"\3511\"\314\354#1\0057k\267\223Putf\230\367\005\325"
+	.text
+	.section	.gnu.lto_.refs.10be2fbdf11ac5,"e",@progbits
+	.string	"(\265/\375`%\001=\013"
+	.string	"\026\337Q4Pk\222t\230hch\024N\020UUUUUUUUUUm\013\250\336\f\002\261\241o\3641\022C\337\374c\315\242\265\215\020\333lk\215\020B\b\3312\005>"
+	.string	"C"
+	.string	"G"
+	.string	"m\254\237\352\216zF\375\322t\247:[\237L\027\347\262\325\345\352\017\325\037\365\260\375s\371[\275\341\362F\353\216\313\235\325\031.g\264\336\270\234i\277\260\316\326+\365)\365\246\323q\373\375\214\002\022\225\031\355\210\264kzj\237Q!\322\316\344U\344\207\374y\375=\351\220/Io\344\206\274M\005\364\006\365\005i\200\264jz6\003\310S\323\333\374\310\027\346\027{\305|\337\0165{}=\271\202\237\357\233\002W\2400AB\204\350\207\300\364\037@}\007\261\337"
+	.string	"\376\f\342/`\272\002\250'\210\035\001\374\003\2247\020\237@\354\026P\257\240\364J\354\023P\217\221\207\210?\201\357"
+	.ascii	"\277\001>4\371\007{\007\363\017\324_\364\r\364\255\035\317 \027"
+	.ascii	"\350LR\0029\203|^\344\275H\213t%W\364\302\007t\n\374X\351\021"
+	.ascii	"\225\217b\237@\375!s\t\354\221%\177\216\274q\356H\344\f'_(r7"
+	.ascii	"\351,\322K\321\t\370\0310\260\377\302\373-D=\r\004\001aL\364"
+	.ascii	"J\027\034`@f\036\263znh\033\"3\026\370\n`m=d\025\242"
+	.text
+	.section	.gnu.lto_.decls.10be2fbdf11ac5,"e",@progbits
+	.ascii	"(\265/\375`\022Wuh\001\332TB\201R \316\250\225\306U\365\330#"
+	.ascii	"u.\327\241u\0376\tn\332(\262\n\336\035\242\323#\017\202\027\207"
+	.ascii	"\222\243\310S\227q\224\210\330n\354\201\016B|q\364r\0273\260"
+	.ascii	"\270\332-_\016\271W\213\022\"\223\001\240\005\320\364,\273\335"
+	.ascii	"\327{z\021B\222\310-\245\224)\372\006\370\0074\bB*\323\016\261"
+	.ascii	"N\267^\326\307}\226{7\331!\226\207\355q\311\222\332I\023+\233"
+	.ascii	"\234\2624*^\325\316nj\322\303\203\337&\253,V\224\212\256jf\210"
+	.ascii	"\375\361\276\020V$iV`\001\322\334{\3713\304\346\250p9J\313-5"
+	.ascii	"\334\201\205E\030\270\367\322\207\003\007\016\0348\340\274\315"
+	.ascii	"\344\003\003\376\235\323xYy2\227\355\312\361\241\374\222\245"
+	.ascii	"\306\265\304\352\320\371\202\305\203\212\305\277Jm\267\216\313"
+	.ascii	"\262p\356\322\214*L\213\177q\350_*\375\333\244\377V{\254\354"
+	.ascii	"\325\r\214\347\"\255\020\214\325\215\033f\335\036\f\033\2677"
+	.ascii	"\004m\004\377Z\374\260\330\326\300VmP+,>`\205\373Osn\215\361"
+	.ascii	"\302\264\370\026\213\226ag\304\270!\303+S\030'#F\r\035\324\334"
+	.ascii	"\023\214\333\030p9\204YiT\377i*\223\312R\017\252'.xQ\242,\276"
+	.ascii	"-\323;\225'\333\250\0320\\Z?,\276\r\242_\231\366\205\213\234"
+	.ascii	")6>\246\305\326\305R\253\251}ya\361\001-\324\177\232\333\006"
+	.ascii	"\327\007f\361o\241X\364`y\321\\f%B\310\034\261\370\177e\332'"
+	.ascii	"\353\264\334>5\f\224(\333\342\333+}\353B\377V\205m\252UH\230"
+	.ascii	"\344\260\3302\331&\252<'\213_\005\365\177\300\312\264K\277\207"
+	.ascii	"\017V\351fo\261\275\267\006\354%J\241\031\213\355^\352\334,\315"
+	.ascii	"p\273b\361kS\277\342\351\f\344t\007\225\247\314\240]\301\307"
+	.ascii	"5cP0\323PQ\206\315\342\nX\307T\246\006\225\314k`\225\373\271"
+	.ascii	"\264\334\313\275\227:\326\307\23153\213-\233~\325 \337\302\302"
+	.ascii	"\252\201\230<\234\036_H\220\374\005@g9\343\205\2160`\262\264"
+	.ascii	"\3740b\361_\301|\t\001.j\213\305\257f_*Z\335\273K\345\005\230"
+	.ascii	"\276\232\365K\315R\371.YR\263\351\005i\356}\245Y\375*\263~\251"
+	.ascii	"]^\275\324\276c\016\034|p\352\206\35053>\263jO\276\\\345\311"
+	.ascii	"\257Mt\325R\267T\346\206\312\345\025K5;M\323r\237\355\215\247"
+	.ascii	"S\263\316\226\230X\374\n\246_7d\235\302\302\302\302\272!\277"
+	.ascii	"\026\321\270\362\344\252\227\341\364\313\342g\305\342\327\036"
+	.ascii	"\372\177\275R\361*\263\346\275.\367nJ\253j5\257B\251V\356R\211"
+	.ascii	"\201-\257\346\336\373\036\374?yu\255\306\345(-\267R\315V\017"
+	.ascii	"(\271\300\275w\006\016\034\252\020\253\215#\343z\347\243\003"
+	.ascii	"\245NH\224\305\257+\364=\210\362\365W*\265\256V\251\314j\367"
+	.ascii	"JW\323\252\332\353r?5\355\275\377a\256\302\345\334\275\261\300"
+	.ascii	"\224{/\177~\017\037\252]\235R\34140\355\215u\225\223\303\013"
+	.ascii	"Z\231\300\275\227\034|8p\260{mJK\343\177@\323\324T!SCi\3619\240"
+	.ascii	"\237\001\375\t\350\235\332\223/\202\376+[=\253M*\234\t\366n\332"
+	.ascii	"{_pJ\031\244\013\263\270\266\325'\225\031\200\372v\017\037~\225"
+	.ascii	"\312tp\b\223\020\226\261\370\036\364\253\3331h\355\017\347\321"
+	.ascii	"\257\001\310\265\260\006 W'?\257l<9Y\265\334j{o\035\034 b\313"
+	.ascii	"m\361\231\225'_G\373\324\236|+O\276\326\347\256=\371o\225'gP"
+	.ascii	"{\362_\313\352r\250$\312\226\232\305ui\353X%{]V&\367\360\341"
+	.ascii	"7M[l\357e]\342\275\227j%@N\255\0048\347\200,\231e|\253\377\272"
+	.ascii	"\344\257J\252\330\206\373\344\"k\253\355\275\254\200#\230\205"
+	.ascii	"\t\314\342/kO\326\225'G\271;*\t\027\312 \231J\302\337*\214\217"
+	.ascii	"\331\273+f\037\376\246\241I\rq\235\377$\362\377\315\206u\263"
+	.ascii	"\371\317\253\377. \356&\356\020\273\344L\301_=\b\341\310\315"
+	.ascii	"\177\026\331\342oQ\374\226\350\267{'\370m\372[#\025\213\004\367"
+	.ascii	"_\267\337\236"
+	.string	"\360\344\277\006\310\026\370?v\225\330\376\253\302\311\177\241\326\354\b\216\341\317\023\270+\370/\013\376\253\006\202\337>\335\264\337~\340&\354\b\276\363\347\007|,sP\235>\2267\370\255\n\320\376\213\353o\223\2772\375U\002\177]qQ@B-q\366[\021\031\374\026\203\377&\375\266\005f\267\354\257\037\376\232\363[\251\352\341\257\370\222\375\225\203\277b\370\255\221\016\177\r\300_A\360 I\205\r?u\226\003\3775`\300\177\r%*\372\327\260\233\303\201?\007@\352\370?\007\260\374\017gS\b\323`\341\177\002L\3300X~[\344&\371\253\002B\320`\3448\377Y\302o\305.\230\006V\311\205\377<\341\257\277H.f\2730\340\310\177Q\030\251OW\371\333\254[\344\267Y.\221\016\254\340\345\252N\365\252y\207\374\027\353\332\017\376|Z\255\254/\347b\241\256\217\261\373\374\347\006\327\353\312\266\270=\376Z\273N\024x"
+	.string	"\374\347\360\267\202\227\353\277A<\376[\371\0177\345\377\227\333\341\335\357}\007s\r\232a\017\300\177\002\3766\312\335\361\333*W\307\177*\177\r\241\0010\347?\273\374\226\356n\375\226\355j\375\265\354\267}u\371\3273\raRz\376\363\353\177\240\0077G\326o\237\\\034\177\375\372/\326_\213\334\017~\253\202\253\377j\300\352\257B\376{\343\257G\200<\001\377Ep\r.\370\257\215\032f\333\316\032\277\005s\253\376:\243\326\370+\214\2772\377\312V\343\376\337\375\227\306\177\223\177\225\263],\336\225\372\253\214\277\206\250V7\312\336]"
+	.ascii	"\377\271\244\002\377\233\226\353\267]\377u\361\377\374\317\006"
+	.ascii	"\374\267\305\177W\374w\351\277,\370/\n\377=\3767\305\177\205"
+	.ascii	"\376[\202\377n\340\277$\374\027\304\177E\370\357\207\377v\360"
+	.ascii	"\337\016\377E\300\177\r\360\337\f\376+\200\377^\360\337\236\377"
+	.ascii	"Z\370\357\316\177s\376\233\377\213\377k\177;\370[\302\337\226"
+	.ascii	"\371-\340o\377~{\367\3330\277\355\373m\227\337J\371m\333o\271"
+	.ascii	"\374v\357\267W~;\345\267n\277U\362[\262\337\216\375v\311o\215"
+	.ascii	"\374\366\310o\201\374\326\353\267]\277\325\372m\326o\257~{\343"
+	.ascii	"\267U\277\225\361[\252\337J\375V\004\277}\361\333\f\374\366\347"
+	.ascii	"\277\336_\243\374\037\373\253\222\277&\371\255\213\277\036\371"
+	.ascii	"\353\215\377\032\3745\204\337\266\370\337\367\237\313o\241\376"
+	.ascii	"\372\337\262\370k\361\257%~\313\364\333\026\374\225\204\337\252"
+	.ascii	"\340\267)\374\026\205\377D\3775\3747\3767\361\377\355\177\340"
+	.ascii	"_C\374\366\204\337\216\340\267\035\370\355\210\277:\375v\003"
+	.ascii	"\277\325\300oE\370-\b\277\375\360\333\017~\353\301o=\374\325"
+	.ascii	"\356\257t\177\225\362\327\271\277\312\375\025\355\257M\376\013"
+	.ascii	"\376U\354\257a\177\005\373+\222\277\342\370+\326_\255\376\372"
+	.ascii	"\364W\021\376\312\200\377\203\377\377\376\207\371\337\374\017"
+	.ascii	"\346?\331\177\261\377+\376\327\375\007@aaa\341o\243\366\343\344"
+	.ascii	"\370!P#\204\330\314\220\253\t\325\322\342\357\324\225\251q6d"
+	.ascii	"]\372\266\b2\261`\215\013\261\334J5LS\240\344\002w2\271\301w"
+	.ascii	"\230\201\177\0070\"\345\210\305\257jN\3144\367^\342?\013\350"
+	.ascii	"\341\277\313\206\375\356RI\343\306T\246\271\367\376\273kb0\031"
+	.ascii	"\f\210\307T&\376;nb08\214\224\2610%5\270v\325\236\334Sy2\376"
+	.ascii	"R\025\006\214\311\342"
+	.ascii	"\357\204\351\177\300|M)Zp\026\233v\317\224:\215\351\313\036\027"
+	.ascii	"\245\026\253\207\246\347E\013\256\202\257\3343%\215\023S_SN\013"
+	.ascii	"\316\313z]\234\206\004z\301\\0\037\336\202\373p\227\312\304Z"
+	.ascii	"\216\261\330$\236k\333{k\2512e\016\376\316\221\235 \372;;\364"
+	.ascii	"w\2544\276\303V*\363u\030\357K\235\032\035T\344\376,\376\016"
+	.ascii	"\f\375\372\272\334\202\372\272\374\235(\375c;\\\007\204H\031"
+	.ascii	"\223\305TjT\036\2243\026\177\307\211\016K\251L<\005\313\335&"
+	.ascii	"\361\\\233X\224\233\226\243Tao\035K\246`(7\255\342U-7\3250\215"
+	.ascii	"\254P\031\210\231\314\270\330e|\235=]u\252\350\353L\321?\216"
+	.ascii	"K;\317\250\210\301p\370\r\277a\246\035\343#\353ss\303O\352\322"
+	.ascii	"\236,-n\313aa\305\013\232\305\327A\323\377\361\032V\303h\270"
+	.ascii	"\tv\202\323*\023\263\341\262c3+\345\325\314\376\341\345%Kj&\223"
+	.ascii	"_S\357\254\214\330`\023\263a\262/\315%\202J\314\206\231D@\251"
+	.ascii	"\214\030\330\336K\037\033?\256+)9\370:3\364\r\223~\316\030\215"
+	.ascii	"\307\352YZ\2172\026?\307\212~\316\023\375\034%\3729:\364\217"
+	.ascii	"\225\340\260\271\251>0\026c0\234\2442q\3307\216\315\2167\265"
+	.ascii	"%\213\223\366\336\273~.\017\013\013\013\013\353\347\362\217\221"
+	.ascii	"\330\027Z?~X\035Q\241\323\344\344\266\305\210\225qb\b\230\036"
+	.ascii	"E\254\360Z\223Y\210\211\340!e:\366\266,\026b\323\367"
+	.string	"\243\te\361sjh\302/}6\t\206\213\322&\377\254@u\tTV\302,f\224|\202?e\230WXx\361k\356\275/`\205\253\242\334{I\270e\320\214L]\023\313\031<\205]`*\334\003\307\3008\260\016\374\003\277\300<\260\017\f\004w\341$V\342(\f\003\177a-\034\004\313\300\\x\006\336\201k\340,|\205\275\260\r\\\205i`,\234\003\337\300R\330\2522\361\026~:f\201\241nm2\314\026\213c\311\211M\nN\251\204w\257\302\021^\275\377\007+\341\315v\007\351~\360\026V\201\235r\356\336:\306\224TL?f\334\232\201T\232g\236(\t\361n\3432\306\256y\251~\233\024sGx\363\nm\262\331\245\311\374+\341\305\203j\341B\251\326\367E\211\233\324\b\361\326\365\253\202\025\257K\002b^\264\224\271\373+!\336\272V\266\022\230\017\204\b\tc#p\357\245O\246\261\006\206\305\005\360q"
+	.ascii	"\365M\326\236\354\241\362\344\343\360\351\037\2578vR\033\022"
+	.ascii	")\214\nc\361\355\3729^!\200'sp\026\037gO\037'N\037g\251\217c"
+	.ascii	"D\037'\206\276\205xF\225\035A,>\216\013\375\233?\375\233+\372"
+	.ascii	"7M\364o\300\364o\200\350\337\344\320\277\271\241\177C\245\177"
+	.ascii	"\303B\337FP\337\346\212\276\315\232\276\315\021}\233+}\233)}"
+	.ascii	"\033\025\3725\200\3725V\364k\240\350\327\220\351\327p\351\016"
+	.ascii	"jO~\315\223>MS\237\206N\237F\211>\215\226>]\355\311\247y\322"
+	.ascii	"\327\203\372\232O_\327\351\007V\271vJtoN\352~\355^\005k\026\r"
+	.ascii	"\227A\346\233\305\227\312\317o\035\035W\323\342\001\334)\032"
+	.ascii	"4Aa\023\243\223\322\005-\315\317\252\260\273\003\213b\2073e\005"
+	.ascii	"\313l"
+	.string	"\356\312Y\260>\030*.\334\215\273o\027Je^\271\337'\327\3552\237\256\334\005\266\274\254\024'\025.Gig3\351\375P^\265\377\347\312\3355 w\352R]\271\313v\333\356R\311\201-\037\315\2757\216`\022\tW\r~\263\366\344\234\234?\026?\216X|\rE_\263\351\3533\375-ipV\257\212\013&\264&3\322\376\220X|\317\226K\374\232\002-\276\366\322\367\200\211\233\222\354\232U\346-\373\035\253\201UnYv\227\314\246\315\336\225,K2\276\326\322\332\206\376\357\222+F\243\224z\022ei\363\206\265\026CI\230\315X\332\226\237\305`\365\211G\217e\222\257,#G\333\034\030\222\252+=\354,\276G\354\230\212%6,\276f\322\257jE\256\327\375\312\231\332\331MA\3144\367\336\377\257\221K\344\016\251\314[\344\227\353v\335\036\037n\221\233\243\n\326\274*\t\210\3615\213\\\255\313\243\342U9"
+	.string	"\214Ks\357\315\301\207\003\207\024\254\372\3464\376q\203T\274*\020q\203_\327\207M\253xj \344\312(\257\220\312\274_g\031t\274\\\331L\031\377\027\310o\0208\023\354}\266\367\276"
+	.ascii	"\347\213\334\022\210\3055\355\347\027\210\003|\350\b\263\370"
+	.ascii	"z\353\017\315\350\017\233:\204\332\223\207w\353\352\250L\237"
+	.ascii	"\273c\353\324<\246(+\213?\344\242[\260\253O~a\365\311\037\356"
+	.ascii	"\351\017\351\364\177\263|\272\230\251r\207\343b\231Q\t[\262\370"
+	.ascii	"b]]\2531\036l9,\2767\324\316=\037g^,\376p\251_\345^T\270\212"
+	.ascii	"W\345\200\260\261[ue\\\032\327\306\235qcT\346\255\361\233\274"
+	.ascii	"S\227\352B\335\032\027\206M\253yU \304\234\250\271P\373\020\305"
+	.ascii	"D\331bMyk\\)\021\2268\r\251\021\303\302O*\007\177\210D_\255\366"
+	.ascii	"d\232\312\223\207]\372\303\030\372\303\026\372\371\214~\016\324"
+	.ascii	"\033.\213\337';\275%/,\376\357\323u\212J\213\222\263\370\256"
+	.ascii	"\260a*;b\303\342\347.\332\353\315F\2212\013\262\304\222\351\205"
+	.ascii	"5\317\312\364\300\232fT\274\224S|(\351~X/3\313\faE\222\206\312"
+	.ascii	"\354\313\312\217\236\315\242W#\357FSl\320\376U\270\273T\016\323"
+	.ascii	"\266\304\312\334\246\313d\013\257\212\273\257\322]\262d\354\030"
+	.ascii	"Kh\003-\2405c\317X1V\2602\355\240m\336\202\261a\272X?\030LQb"
+	.ascii	"x6-\247ig7ma)\353z\fZ;{\327B\257\313&\257\330\264K\226\324if"
+	.ascii	"W\203V\213\345\253xj{\211*\003\"{\214\030\007\016\267\313\210"
+	.ascii	"\024\275\003\340g3\235\227\265'\177K\345\311\317G\364o\375\276"
+	.ascii	"\250\221y\341\303C\2640\277\372\254\227\314D\257\213\212\305"
+	.ascii	"\317;\3643\326\026\313E\207\314\0131Y`l\311Qz\317b\271)B%\025"
+	.ascii	"\304\342\347\275w\006\352\237~\372g\236\3769\247\177\266\351"
+	.ascii	"\337\336U9\225_e}x:7\204J\364rX\374\323L\377<\242\177\366\320"
+	.ascii	"?\255\364O)}\274\332\223\345\354\034\024\254\002\n\224\2561r"
+	.ascii	"Pr\336\222\215\026w\013E\007\210\333\025\035\026[\270*hS\350"
+	.ascii	"f7\327E?\261nm\327\213\022\324\222\305\307nO\332\240\330\330"
+	.ascii	"\241\302b\333VS\266\234\302\264\330\252Y'\377ip\252\004\231\242"
+	.ascii	"t\262v\241\226\210a.\305\244\244|dYl\233\330\264\3774\371F\325"
+	.ascii	"\231\"h4Y\376\256\324,>n\242\355\231U\372Oc\207\274A\251a\361"
+	.ascii	"\001il\244xm\335Y||D\037s\215\331%\023Mc\307R\237\305\307ScL"
+	.ascii	"\316\004\271\013\274e\362/8yT\\\266\305\307M\372x\225'/o\225"
+	.ascii	"W\222\025a6\311\337\340\327\024\213\301\226M+\230\3000Y\374\373"
+	.ascii	"\247oq\374?\267ClV\025\274\3137\355\324\004G\323\256\260R^\325"
+	.ascii	"L\313\356\270jV3\365L\035t\302\362\203\260\026Z\025;|4m\020["
+	.ascii	"\304\022\261G\254\322~Y$\026\2105b\003e\304.\2231P\356\300<\207"
+	.ascii	"\311?h\274\222\2700bqn\342\345\220\214\016+D,\316~\347n\242\303"
+	.ascii	"\215\210\305\371\213\215\242\323\203/\354\311\342\334\367\276"
+	.ascii	"&\035B\352,\316^l\232\030V\334\024\213s\027\313W\346-\013"
+	.ascii	"\213,\027\255\007\026&{Y\376,yK-\333R\036P\216\021\003\273\311"
+	.ascii	"\021\025%\213\226\347-6\215+\313\013\027\371\007\r\336\2301j"
+	.ascii	"\026?C\034\036^\336\333\362\021X\250\307#\353=\357\t\226\271"
+	.ascii	"baq\316\253\202\347\031\016*\203\026\347+i\023X\222\f<\336\236"
+	.ascii	"\343\336\362\335\325\273\331Je[j\310\246\304\213I\340~\252\332"
+	.ascii	"\220\323\302Ok\207\224\347\273\347*\036>\274\317\310\003\r\315"
+	.ascii	"\342l\367\332\343\017\355\311\342g*\271\356\247\241\021\342\245"
+	.ascii	"\215\320\342gp\322y\312\002\256\006s\230\261\370\231\256+\017"
+	.ascii	"\210\021\213m\375\\\316Q\336\367\"\316\310\225\305y\356~md]V"
+	.ascii	"rw[zL\026g(9qNku\026?\303\326\031\216&\016k\207\226\305\037:"
+	.ascii	"\311rC)\250\246\226\335.(\371\343a\246\246\251\006\030\254'\317"
+	.ascii	"n\303!\\\224\200X\234\333>\227\205\306\254aqf\373\234\r.\030"
+	.ascii	"l\026g'/\2636\266gq^\373\334\260\356n\013\007\024\264\037-\033"
+	.ascii	"\361\311\272X\006\2536 \340LN\316\342\373\260\211=\227\211\345"
+	.ascii	"3|eo\246\016\226L[\366\223\325\006\234$\253F\r\263\347\2639\252"
+	.ascii	"\254\263m\361\0017\374\247\321\201B\033\303dq^>\223\3754C-X\352"
+	.ascii	"\312,\276\217\231\316L\236\307~\232\363\006\214.E,\276\017\023"
+	.ascii	"\375\347%?\315M\227\335]\030\213\357\003\246\357\343\205\344"
+	.ascii	"HrX-\333R%\336\306\210\201\335\320\301-\237$y\016\0336\241\254"
+	.ascii	"\211Y\234\301\206\314;*^\322\356\244\314\fV\r\031\222\215\324"
+	.ascii	"&\202X\204C'2\316\310\310E\236\215|m\361\332"
+	.string	"\2638\023\251\2029dJB\260\34034\177\200e\224X|\037(\2452\2170\f\r\"IXX|\037&.\256\034\304\007\212r\214\230\226k\022\343\002\362\034\204\207`\334\225\305\271G\376\361\237\246F\n0\013\221\037\317>\350\242\352|\334\025\330\006\233\334\024/\333\304\332aC\213\305\271\313:\301)\034,<\273@L\336\261\303.\325\262-\225\323\302\020\206\t\334\273j\3039\270\025\265dji\345-\375\005J\016L\207\037\223\030\213\363V\223\254\254\214U\367\336\273\312\001B\356\224\273\252j\203U*\371\312X\374\013\206\324x\215\214e\367\336[9\244\023\302\326\024\003\230\204\306\3253V \332]\234\305\007\314V\377iL`\341\263b\225o(m\374\235\241\262\2073\230\006\245d\033X\356\212\352\307\330\025\r\032?L\330\224\366\312,\376\005*b\304\3102B\\\020\222D7Y\231\223\2638\313\020Bd\313\205\305\307"
+	.ascii	"\250\377LE\205\317\204\310\302;\234`\021\202\355M\267\301M\r"
+	.ascii	"$o|\026\037\003\237\376s2K\325"
+	.string	"3\327\256n\252$\006\276\350\232\030\354\362S~\312Q_n:vN\342\260^<G-\257\021\265\264\244\305\231Ev\361\237\206\206\307\0312S\331En\201\004\311\025=!>eD\2602\024~\272\311\332\"f\313\333\212\0256\r\357\354\246\2551\245\222\334\224\233\230x\351\274\363\316Kz\327\264\260\221\225\236\227\340\364l\200\271\201\241\206\376i\246\236\204\2046M\r\303\326\2576-\2239\313\2209\007\003\003\317A\255\264\346\202&\357\251IF\360\347`\221\223B!=\177\372=V4 \340)Eo./\371\312\224\2170\213\337\323f\363l\236\022?\2773\214\336\314 8XL\330\300\374\f\203\201\300\235\305Y|6\357g\003H\230\0258'\003NI\025\213\337\243D\277.\353\331\327W\227u\271\245\206LV\272\272t\251p\035\f\2350\205\365\344\320?\265\324\223\013\227S\213\336\222\236\033\372\365\324\222\317,q8\\"
+	.string	"Z\374\236\244\376\231W\317\275\275\032\246\273\013\204\272\026\326\n\227\353N+u\347\225\023\357\347\025\035+MT\n\355nw\336\325\235\334\273j_,-\240\344\300j\302"
+	.string	"\335\230T\371yw\343\364\365e\313\342\003\352\037[f\222[\364/\260\275\235to\347\224)pp\247\024\256\250\233$M\210"
+	.string	"F\371)\205F9\303\206\f\213\317\270s.7\241\361\0066'w.\215\235I\201R\357*\3350Y\326D\017\312+\335\005\"\372\027b\230\235O\314N7\267\263\263\263M+\325&vU\033\206Zz\224q\235l?\333\354\216\344\213+\213\317\264\323\211\026\036a\200N\326z"
+	.ascii	"\2312\343\036\271\\j86S\236\305j\277\\\377\323\236B\023\022\005"
+	.ascii	"\355?\215\006%2\314\2405\311\271\242\027\370\305\022\241\262"
+	.ascii	"\243a\361y\314\350\363T\321\377IFv\237r\222\246\205\231]3N\277"
+	.ascii	"j\251\347\330\330\006\274\334S5[T\240\344\002y\314\300N1\260"
+	.ascii	"sI>\340\317%yE\2028\2618I\222S\211\036\276\350\022\366S\311\022"
+	.ascii	"\247\211\027\033\223\305\007\274^aS\234"
+	.string	",>\217\020}\236\252\257\363\310\327i$\001{\327e\226TrW%7(\225\247\221\020JWg\221\237F\340\314\030\t\263\370\024BsC\0065Xw\0229\207\030\341A\247\004\313\331#\204\212\302\303B\337\302\237\376\351\243\236@\200T\270\272\334Ry\253\017J.p\214\227\2257\213o!\213~\255p\331\313k\rN\377\247\016\346\251\343\354\262\220\264\200Y[s'\2536\310\341q\307\314rr\375\354\372\317\035'\217\372\305\346ha\272\333a\261\207\237\237\\\031L.\207\240\3055\313\332\223kW\345\311\267\200\246\265\264\334\206_w\202bF\364O\254zfe\235.jR\273\2319in\351\327\323E~MR\317+\346yU\301\344$\215\223\336\223\346N\322m\240\313\322\336dX|\0132\364\317\032\365\274q\243\362\341\345\236\3121cZp\322\257\225/\377\234Q\317*\346Yu\266\250\313-e\263Ewe\203W"
+	.ascii	"\243_\317\0269F\214S\006\337\251$\013\256i\361+h\321?\223\365"
+	.ascii	"\244b\236TV)\304\306[]\240\344\300vr\271\301+\314\351W\253\224"
+	.ascii	"\245\244\354R\210\232\257\262\345\220\314\357M\316\342\345\331"
+	.ascii	"\336;\203N\035!\330SW\335^\031\213\361rl\234\230[l\026"
+	.string	"\377\247\n\346\251\342d\261\201\313\317\247\237,\376s\305\351\324t\327\314\254eY\214\301\374\374|\322\271\n\242TeqU\326\236\214\241\362\344W \242\177*\235K?\231~2Y(z\357\335c\rJ.pW%7\274\202\226\376_o\377\274\227\222{o\252s\271\223L7\371\257\257g\255\033~\234zk\001\376\343\377\002$X\356\2469\035{\357*F\023a.\335\310`\237x{7i)I@k\252I\213\306\323\231\326T\205\2473\255\255\324\024D\251Brk)=\235\355]\241\251I\tD\326\256\360t\266\247\266\212\274\251\272\227ZJ\273)kW\330M{)\203\247&\255\251\247\263\245\251\nOgZS\373Lk\357\354\246\245$\213\246\235\254\260\317\264\300\354\263\254\251\235\247\263\254\251\2473-'\225\005\224W\221\030r:z\340\250pOM;\352\205\325Rr\007\357i\231\265\267\354]\325V\354\344\306\333\273"
+	.ascii	"{[e%\267,\321\250oLxQLmKYu\271\367\316\360\202i+k7\341)\325\215"
+	.ascii	"\367T$k\357\"L)\366\213\275\367\376@i\211\267{T<%\035V\333\305"
+	.ascii	"\212\2751\330\313\275_\354\255T7\336\336[i\357=LZ-\367\266\261"
+	.ascii	"\363\244|\361b\357*\237\027\333J\tn\305\336V\215\357m\352\351"
+	.ascii	"l+\353\007\016\355L\271\235\226J\365\311E\326V\356"
+	.ascii	"-ZI}\246D\266]\354\275\353\237VN\301\bc1.\034\323\002P\212\305"
+	.ascii	"\337\331\242\003h\021\361H\202\205\f)\0201%BA\240E\305\324\346"
+	.ascii	"\250(\210&5\026\357\221\230\"\b\363\22002\221\"(-\236P\002\205"
+	.ascii	"\261h,\022\213P\022H4Ea\204!\244\023H\013\307t\304\020\322\t"
+	.ascii	"\3440\004\017\f!\235@"
+	.string	"\332\b\031\213C\027J\030\321#\243\034\013<E\207\240c\220\017\232\022\205\216\220\200\322\264\030\024\004\004\302O\3201\310\302St@a,\036S$\007\250\020\022Q\220\261\310\301\021\211\304\001\006\"\"$\243\321\3108L\201\320\024\212\310\214\302QP\021Z\224\237\242\0032EJ,BQ\030\211$j\206'\030\035S\244F\306\341\020\021%\302)\322h\024t\246\220\006\001\031\213)Q\021\351\004\020\020\316\b)Z\"\rB\217E\020E$\222D\212\"q\362\020\322\b9O\321\001-*\246\030\220(!\002it\f*\026\321\b\031\213#\320\030\213h\nE\"b1-\032E\\@\221:5\035t\300I\213F\021I$lL\020\021!\r]@2B\213\212\351\316\216P\221\210\370\201\024I$\362\271\341\031a!-\036A\220DB\b%aAHDZ4\"e4%\246\310\363\210\246H\242\006\220H'*\364h\270@"
+	.string	"5IB\"r*\370\344t\320!=\022\217:P\200DOJ\204\204DI\020\021O\030\021\241\270\271p\264sTDL\221DB\"\216\351\210$!\021BD\364\210c\002\205\261\230\246\305\"\244\221xL{P\"!\0214$R$\221\250\002\322B\0161%\202\330yP\361\210\032Q\024\372\037\200\260"
+	.string	"\020BH\032>\004\021:\020\241\203\374\020D\370\371\021\001\204\037}\020~.\nD\302\005\024\250D\021\211<\242i\361x\202\315\b\243!\243\b!cq\204\013BE\244\233\"Q$\024\240\307\241\220F\217P0!d,\236\320)\320\007 \b\025\221P\340\364):\f!\235(\"\242\307\024\311\201\321\250\250\310(H"
+	.string	"BF\364\"\201\206\220N \3631=\272\251\005\243\342\005(\034S\264\b%B\323\013,\224\200$j\300hTL\203\214HC7(\220\b\fG\310\"\344\021\212\nI\250\220Q\004\232\022\217IF'J\b\"\022\235\300\220\2428:\032\221@IG \024\211\0044\204<\006\351 \201P\024\207\214F\024H:\326\034\021\213\202\216\347\221\020Z!\t%:B\0021DDLQ\203\n\025\217G\324\004# c1\203\024h\210\202h\302\250\b\204\002\211\350\310\247B\212\"\321\243\220\261x\002(%\"\201\212\220\216i\t\350\021\022"
+	.string	"7(\0211\250&=\242&\030\213AG\241b\321i,\026\351\022\202\320\024AI\304\"\255\203$\"\232@dttDS\243\210\240\343\005H\024=\242@A\240D(\214\023(\"R\300\204\243!\013BDF)\220\3501\205\t4%\232PL\203&\200\n\031i\340X$\372\030\213A(\022\t(\211X\004\224t\264\001JB\"\002%\021\213t\220G\243\343\021\355IQ\344\320\220\221\rz\204BZ!\303\320\220Q\212\024$"
+	.ascii	"d1\211\b\204\002\351\004*\224\"\035\031\213\027\240G(\244@\250"
+	.ascii	"\t\305\224hB\361\210\ni8\032\245A\304! \243\024\211\b\204\302"
+	.ascii	"XL\221\032\031\025!\201\202\216>BF\305#z\0044tD\004\004\024t"
+	.ascii	"D\002\025\221\310c\006\241\"PZ4\"\341\350\244H\342\020\220\020"
+	.ascii	"\022\361\004\020\022\351\0042G\210hD\204\002\361h\230\002E1D"
+	.ascii	"\3201hx\202Q\006\202\216A\331\350\230\032\2152\b\211@\201\350"
+	.ascii	"\b=\016\205\214\304\242\"\243\240!\0050\204\200d=x\200tK@\022"
+	.ascii	"5\220\213H\344\021#Q$\322(\0036'\220J\240%\020S \205\214\304"
+	.ascii	"\020\027\b\211@\221PP4\"i4\350\210d\204\314\021\022\201\006\025"
+	.ascii	"M@A\030\215\212)\321XL\221\250\020\017\ni\361hT<\036i!4=\032"
+	.ascii	"\035\035!\225\020B\"\236\3001\0322\026q\372\024\0358@\036Q\023"
+	.ascii	"\212G\241#Z\034*\246FT\250X\203\004\272\371@z4\032\201\022\235"
+	.ascii	" \2320!\243@\250\220\221\006\322\243\321Q\r*dT\204Q \016\244"
+	.ascii	"G\243#\034\244\321\250\230\036\031\r\321\224HB\b\211xB\243)\024"
+	.ascii	"K\240)\024K\350T\037o\204\210h\b\242\"\321\304\021\035\032B\032"
+	.ascii	"!)\2759\246#|j\216\351\b\324\204\"\032\204\222\320\220\002y\360"
+	.ascii	"\300H<*\221t\314!\246D\020I\307\234c:BDO\tA\304\023DDD\n\240"
+	.ascii	"DB\305\233\364):$\035y\210)\021\004ZD<\016\321\244@5\350\021"
+	.ascii	"\n&B@\242\304\315\021\025*\232`t\034\221t$\"\026\217(r'5\"\031"
+	.ascii	"Q\340\006M\211$R \321\343\020J\"\351\210sLG\030I \246D\020'\020"
+	.ascii	"I\b\021Q\022AG\233c:\302\202\221\004$RJLK\034\323\021<H 4%\246"
+	.ascii	"%\320\242bjD\"\221t\3341\222\200D\242AF\307\021A\307\235\024"
+	.ascii	"\265@\320\321B\n\224j#\tH\017\240EE\023AG\035bJ\004A\204\032"
+	.ascii	"\215\304\024A6)\020\b?\251\261\210\244\207\220FH:\236\251\261"
+	.ascii	"\230\201\020jDQD\032\221n\214(\321E\213\210G\022j\036\324\001"
+	.ascii	"C\b\017DI\307\0226O\321\001\211\036\241\220\002i\270\321\021"
+	.ascii	"z\344 52:r`\223\"EaD\211\262\220P\321\242G(\230\2509\242BD4E"
+	.ascii	"N\201BH\215E\244\341\177~(\220\201\0076`\001\035\324\301\003"
+	.ascii	"Q\322\021\311A\322\221\003c\221X\304A\320\021\311A\207\236\023"
+	.ascii	"\210\307\233\242%\004\021\2172\221\221\321\b@\347\377\241\\\265"
+	.ascii	"\2627XE\f\224\034\004\253\265\311 \003\367a\334\177\335.\323"
+	.ascii	"\272\270Q\345g\361\360\355\347C\270/\265\272:\213q\230C7)@\354"
+	.ascii	"\366,\036>\251P\306\244\311\342\003@J\377\303\266\341\022\220"
+	.ascii	"5<1l+.(\371=q2laVEHe-\023\216\271\372R;Y\200\271\202\2131L\303"
+	.ascii	"g\362\244\024\242\23520\222.$c\232\3440'Y\214*KgY\360\206\251"
+	.ascii	"\021Fgv*\031\356y\221\215)[\252\342W'd\270\374\220,\314\214\034"
+	.ascii	"7,\0362\031\216!Q:\341b\361+\363}_\210x\211cb\361Pl\270\244K"
+	.ascii	"\271\006\345~o&\003\213\004\362)\311w\303(%ex\204\031\311!#r"
+	.ascii	"\226\227d\t\230\222\215]\231\231(Hr\330\035\322T\245\342\310"
+	.ascii	"\026\2754\305\204\207\021\233\266\366\005\257\305\260\310\251"
+	.ascii	"e\007\225[\227\305C C \303!4J9]\364\220P\t\334U16\374\303\257"
+	.ascii	"\017\207\f\205\360q\315QQn\035\035)\2008\336,>\006\\\3640\210"
+	.ascii	"U\312#\004B\306\342\003\002\315y\005Z|\f\254\350\177\370\343"
+	.ascii	"l\301\302\256\320G\345\243\331CR\230\347u\272\270I\266\340\035"
+	.ascii	"\351a\227\352\026\035IZt\235\203\230k\215m\006W\336\263rg\314"
+	.ascii	"%\217S\212\323\256\262c\270\343\274+,\214\261\245c\312p\253m"
+	.ascii	"\353\t\037\331\022Jy&\3140G>K\001\263<\031f\235n5\272\266\226"
+	.ascii	"\027\252\220Dae#\025JLT\222\253\354v#\006\225\216%f\242\002\303"
+	.ascii	"\352sC\033\313\263\234;-Y\266X|\f\352\364?\254q\206\261`\230"
+	.ascii	",\342`|X\365\337\256\333cH\343\006\213[\230.\213\2072\206"
+	.string	"3>\2441\2141\244\361A\326\336KC\032:f\366^\322\251\225"
+	.string	"\265\022"
+	.string	"\207m}9\311\370\030D\321C\252\237\017a\330%<\236\274,\316\303\251\241\224\246\303\312*2L\236Wt\314Z(\255\030F\32591J?,>\006e\372\037\2768\273\234\364\320\334,~z\032\266\250;K&/_\232z\n^\227\254!\324\207-\na\374\235\261x\310\"[\341p\311J\262v\323\312\304"
+	.string	"\307\276\232\232\206+\352\316\222\211\217K\263\362`\022\004\310P\305\207+l\262r8\005Z\r\367p\017\227|\364\026+\302\327\334\273j\003M\225\275\266%C\245\017\227n\332\260L\314\026%\fb\224)\223\t\353Z\216Be\r\243\225\204\305\231g\302/>\356vPY\234\315d+\025D\314da\360$\346b\262\240O\226\322\237\002\346\204\224\021\013\334\002T1\006\370,\230\003\315\304\355\264\034\230\311\340Q\231\241\325\226A\215\312\324\030\\\006\200\276\247'\373\311\025\264'\026?\303\037\037_\016\343\223\245\004\306\001R\300\004\206Z\250\3631\244jH\330B\206I\245\22425#\264I\032\003\343\025@ H< \222\312&J=\023"
+	.ascii	"\004\314\213Uq*\347\230bff$IIRc\332\fX\351y\242W\370}l&&O\027"
+	.ascii	"\2540\202\237\345D3"
+	.string	"\263\260\242\230&\365\027\230\310H|\347\336\215R\022\257>\217\312\2028\223\330\177\210\350\266&8\233\024In\266\235\377^\002;\216\240!\351\363\311f\361\322<L\3272\004A\312\030\301\273s\003\t\203D\363}Q\333\350$\017\232_\305\272\335\221k\231\345\2663\240L\013u\220\214\001O\213/\204v\200G=\207\007C\r\032>\261r\331\243\236\321\343VK \002\304\030\351J%G\373,\032w\005\364\345e\r\\\321\0012GY\362\224\037\321\242\r\207wZ\200{\302\026\272\205Cc\001wL\340\b\340\226\217\016T\354T\202k\277\351\n\274\rD]\202\n\306*B)\272\032\242Q\335\230\240\311\201\234?\377\327\243\017\177\016\304\255]\023\220}-\001p\354\020\364\037\377hN]4\236\330\006\356\017\352\004\220\225H\267\243;%\333\024\355\036\322@\300\365\3020V\036\202t)\022\032p\306H\241\336}\314\253G-\316"
+	.string	"\006\212\274\376\206\222R\343M\267\025s&"
+	.string	"E\022\3343\256;\242\300\036M6\005U*\334\007\035\2532\206i\345\226\265\354h=\006u\223\235a\235)n\215"
+	.string	"F\372x"
+	.string	"?\034^\327\272Gc\3236\353T\327\234\376\246-!/\364\034\210-7\271\002\300C\250\f/yQA\306$\235\211\227\275wd\264BX\004\270\331\265\r\217>\002u\356\217\2016J\252_\215?mQ\300\020\206\330\3354\036:5\242R\f\225(\233\350\253l\241\334\377\204\206\232\375\240\231\364\353@\322d\256/\034<\"\016L\t\300%}\t\314#\242\024K\372j\031{\266J\013%+\263Nd\307\367\320\314\021|\315_\037\b\325\260\311%\245<x\n\224\325G&\377\344@M\026]-\031\204\315\016\020\365U\305\f2+\327~\301\327\006\370\263\270\0376\222\204\353?\363"
+	.string	"\023\225\r\341ri\231g\375m\201|;q\340\210\"\031/>\030\302\347\316,'\254\336\025\327\316|=\243\030U\370\006\360\347\233\030\004\350h\220,\370\375z\267\325Q\326 \303D\341`L;\223&\273\335_\363\347F\347Ib'\247\026\025\030\031\207j\217\376\243\347\375\306:\2348Mc\fo|\0037e\233o\310\001G\303\331\035\373P:\215\001\374\002\336\350\031K)L\214\304\271\362\242\247\027)\300\311Ck8\300\325%\330\220\373\213]_O\353\357"
+	.string	"\037\316\271\227\311`+"
+	.string	"\376\005\222\232\247`\002J\306\205[\357#\"\030\205\243V\033\347T\177\274\335\264\242\316\347\327\003j\025\243\374\247\020\3178T\375\304\017\212\207\302\214\332i,\224\266\375pD\005\326\215\356vw\310\303\347\256\026\211\342r\276\b\256\264\035v\n\221\261\206\336\\\215\256\002\013dK\260\202h\361pL\357\257\323`\252$\246l\3014]\370+OM\243)\217\004a\344X\3277a\322\355\312m\016\246=\253\314\344#\303\017\3347A\036\\\362\375/ZLB\373-\013\211\345*\240\373v\034"
+	.ascii	"\217V|\216!\203@\240\216\247\273\275%\314~7+\026*\242\013k\343"
+	.ascii	"\341\212C\005c\211f\020\352\026\363\361qj\325\2109\002$\262\023"
+	.ascii	"\211\231\270\2730%e\253\372\244\320pWr\206\347\r\265\020\017"
+	.ascii	"\375\210R\357QI\351H\377N\375\316+\375\220\274h\261\017\372\302"
+	.ascii	"}\217b\270\347Z\006Gd\266w6HG\026+\005\212\313\346\306\224\320"
+	.ascii	"\306\246\274\302s\217\311h\361\320\034\232\3206\361U\202K\206"
+	.ascii	"WqR`\n\366^\020\303\261]o\320^W\202\007^\257\253s\257\364\215"
+	.ascii	"\307KAr\254v\260N\007\020\264\363\224\355\342A]\034^\213\274"
+	.ascii	"\264\002#2\373:Fe'q)0\231\304v\2005f\372\266\314\222PW\273\254"
+	.ascii	"3\205\311\t\224\244}\343\266fL{Y\027\250?1|'\270QI\211\301X|"
+	.ascii	"\357\231\334\t\002S\265s\022\316\262\244\252\330Z\335H\356\226"
+	.ascii	"i\220\204{\022\n\237\005\366\260\257\030\t\231\312\364\242\317"
+	.ascii	"c\321\3051|\351\233{+\005\224\360\\\266\351\255\250\240Wp\243"
+	.ascii	"$E\325@O\222\360\007\302}\374=\377?\212\023\r\256\353\036\256"
+	.ascii	"\311\354\221G\311\036\224\2461\206\t\332\031O8^\315\315\r\271"
+	.ascii	"\314\005\\\026%\343\237n'#\366\351\004{\250A\3302\001(\214\n"
+	.ascii	"=\350\256\312\251\005e\245\"\240h\350r\351yZ\007\2134y1E\001"
+	.ascii	"\307m\277\340\r\250\364\331\200x\341:Bg\006Y\032\244\324V\350"
+	.ascii	"\215\r\241\004\211j7O\335\277\221\023)`\345\0364CR\007\333\311"
+	.ascii	"g\253T\242\354L\222\214\\5Xx?L\2756\034%\002\353\213\260\373"
+	.ascii	"\232\023\037S\243\254\316A\3109\005\247\300\375vv\365:\346\223"
+	.ascii	"\321V\357\270\253\204\300C\202C\274\305\374\352n\356\323P\200"
+	.ascii	"\027\311/\247 O\007%\244\216\037\020\247N\310\274\353\324\254"
+	.ascii	"v\331,\007\210P\224\362\336\241\021\322y\270\003A-\313f\335\313"
+	.ascii	"\202\236\023\016\273 \025\261\f\351\025\233p\245\340\363\365"
+	.ascii	"\367\327\344\341\207[\331\335\236\301\316\033!\366\210\r"
+	.string	"\333\202n\217m\342&\300\036\321\227\002\030DU\306\021\007\0354\363\201^\302\365\022<\265\215\t\204\033\361vTK\240\232\003\334h\003\001\035\032\247\256\302\b\321\223Q\3300\031\2408\213\222\240lr\374\313\301\363\314\nh^L\255\001i\027!j\034\375\235\275\233\003\031j\330\003\224\373\311\365q\t\033\227%\246\247\342$\252B\247\320\343\306\305\220y\237\307\022N\004\352D#\255@\027\236\333S\302EBqen\241\t\017\r\340r\3626\256\017\027\021\244\356\345\215l\301\377\355\037\235I\225\245\2722\3118\217\270o\274V\252\2429q\363\217\224\033\006<ma\247\024\231rm\032+\321\227\210\204 \235\372\177E\2020+\202\354\320\321H\004\203\355\\\013i\306D\020\031\007W\252\025\236,\017\027\204\335^eelkhu\022\212y\262\204\2712@\2775\276f\307\365\276z\334\307\232\213\f\350\373m\236\264\242\2649\220"
+	.string	"\276\205.\243\341L`\257\265?Hg\243\276f\373p\234"
+	.ascii	"\200\001\020\020\363\245\375\376\306\nUuw\311IRD\023\344\330"
+	.ascii	"\017\217."
+	.ascii	"\306\226]m\001\234\026,\230`q\2614\227\207l \225\f\354\005\247"
+	.ascii	"^M\245\332\t|ce\372\217\2035\224\261\312\230 \322\304\341\315"
+	.ascii	"}\\\321\337\013\n\2625D\303\241\025m\240#t\345\375nh\253\361"
+	.ascii	"\007\362\360<)\265}\256n5\325\273\035mZ \346\303\275@[\253VA"
+	.ascii	"\257\006\032\207E\254\261|6z\035\245\b>fz\3410\323vd~&\204\306"
+	.ascii	"\3532\261_\311\"$\307)\364\370{\321\345R\376\325\376\366)\366"
+	.ascii	"@\353\323@i?\016o\020\233\245\023\376\2419\002\020\203zTd\332"
+	.ascii	">L\007\363\f\223\207\361\325\230\341\271M\356\002M\242\024\211"
+	.ascii	"n\214\035\261\253\017\373\326/\235:mBa\322\341=_tPA\3424NU\232"
+	.ascii	"\200H\262\t\212\206N\007H\033\330\nR\330\240\267\314W\361\256"
+	.ascii	"\251\020\201\266\277\307\352@a\321(\376\036\211\007\203\337A"
+	.ascii	"`\353\342`\323\266\277\2363^\025r\374\re\254\320\324\367\t\200"
+	.ascii	"\235\352\333\203O\344\241\366g9\300\205\262\275dv`B\301\323\036"
+	.ascii	"\346\3603\022\206u\344]N\265S\020l)v\006X/\244Z<9Vja\371\221"
+	.ascii	"\016z\013V\004\250\240\256\206D?\232\f\351KP\374\363b\252?\003"
+	.ascii	"\303\313;\250\t\206)\217\323\260m\035\275\240\326\237M\271\f"
+	.ascii	"\332\b?w\341x@\222\304\177$B\323\323\003\202\230\360wO\300\021"
+	.ascii	"\342\315s\371\321s\271\270\260~\310\373>\232\314\f\361^\202\327"
+	.ascii	"\310\270\032g3h\"\221\357\260()X\350"
+	.string	";\276\366\373\324C\035\231)+\246\271\006\270\377\211\323cGu\373?\205\363;\305\016+q\207e\345\201}I\017\230\352Z\310\323\322\262s^9+\361\306\024@*\324W6p\354\240\242q\3132\316\226!\242\333Qt9Sk\215\355^K\251'\3562\227\376Dl\003\271c\300\320\334\030\020\276\350L\377\233\232z\241\337\221\270e\221\243\244\301\214\302\321\350\337\361\223k<e\212\265\220\t\177\350p\365O\246\303\243\222\325\301\330o\2031.\n\335A\243$f\346\233\033\340\365oZ\b@\t]\370+\036\372\026\303\345\315\312\250\rpa\230\244\277f\231\353\024\007X\224IT\216U\303\275/m\n\324\375o[\037\372{\335m\263\025}\022f\177\n\3251\222\0279\001;\215d0R\277c\223\224\001#L\360\317<\212\\\213\347\302N\304\301\006j\330\350\036\207\301\023\224P\035\021\352\256\362\341\302\037\034\203\225\023\210("
+	.string	"\373\213\037\264\007\206R\"\033"
+	.string	"H%e\020\256H\024I\255\227#\315\246\356\304\0260\301&\007\222\345\262v\341\003d\023+o\221\314\217&\3448ZI\314/3J\346Y\376\r\344TfM\324<\275"
+	.string	"!2\332\227S\t\254!\217\355$\230\021\253\216G\215"
+	.string	"\324/\324\321\346"
+	.string	"5T\300\363\310\270\230:\214\025\\\\ \357]\227\362o\n\331(\260\020\313\262\312\262\246 n\t#w\232\032\326\303\246po\f\0233\217\313\304,\215\274\002n\372l\226,\254\200.\224B2\022\243\004\f8\257,\376sg\271\370\336~\344\306\221\277\362\217\002`A\353\bR\244H{\020\200\212\2042;\252&B\0366)\t\262u\016\346F\220t\362\202\2069\346\313A\022\275w\343)\272\252D/\016\261\376\335W\002\372M\231\344\"%2\035\243H\214\034\006\006\222Rb\351\2138\361\221\365\245\354]\361v\035\016F\366\200\217\355\364\023\356\251\342z\241\243\354\262"
+	.string	"\242!"
+	.ascii	"\315\257R\024\211\351\026\202\301\313\303\025\234\253v\351\366"
+	.ascii	"\361\3614{\336\325\240k'aG\350,\305\004\003\020B\311\333W9$\204"
+	.ascii	">mo+\235\\'\224C0_\270\360\237\334S\030t\370\213\244Th\232C\212"
+	.ascii	"\206\rA\230l\024\202p\320\375\020\277|\"\226\231\302mq@\214N"
+	.ascii	"r\210\326<\376\354\341"
+	.string	"\363\350\257\366\361Th\033\257\242\317n~\320\245\027\201\363+\027?\273\356\346\355WG\377v\377\221\276\215\366\366\333b\f\265\327p\263\211\357o\211E7\211\256\217`\215\227'}\372\2511\201o\023\340/W\377\333\033\363\334\276\230r:\220\227\247\317\346\321\032\272\351\017_\037x\374\273k>\202{\351\324FJ+\354^\316\363Y\374}t~G\262\363\346\266s\367o\236m\315*y\312\374I\307PkXw\276\211G\374\271\301S\265<:\375\317\f/\323\325c8\261r\177\231\034\r\214\311-\237\to\027\310\"\333=\341O\232\006\206\346!\323\274\020\356\025\347Kl\213\221-\363\227\215\262i\321Q\217\371\310\354W\225q\344\371\266\230\3214/\342\020\007\333\016\004\352\267U\236\250\3227J=\320\267\017\316\215\266\241\321/\002\374\3337\357q'?\272\367\357\266\233\327\275\272\367\262\205u?|~\365/vM\304H\251"
+	.ascii	"\374\321\325\177\353I\342\277\326w\3040v\320\277\214\3374\336"
+	.ascii	"v\373A\244\333\251\007^\356\004\0074\301?\247\2306\3011\347o"
+	.ascii	"\0257f\326\234\205\211\276\2569\334\343\362\216\347\033\316'"
+	.ascii	"8=\345\"\207\346\351\005\317#\034\307PS^p\255>0\206\244w\273"
+	.ascii	"\375\204\355\223a\315\343\217:\252\340O\300GJ\343g/\247M\230"
+	.ascii	"\353*d\321\370\336\232\367O\337\323z8f\006\353\337s\257\365\374"
+	.ascii	"\373_\360\017s\243\275i\343n<0Oc\257\352\341\271R\326]\306 K"
+	.ascii	"\370*\330\353\232-\346\352j\246X\373<\366\272\377\225\275\235"
+	.ascii	"\317\235k\0265\033\225\033W\264\002\037:_$\340|\347\325\037M"
+	.ascii	"\374\366\024\275\301a\263\023\37756gZ\272\243\270\365\017\017"
+	.ascii	"1~\364\2077\242\327\016\310wy\230\2220\366D\367UJ\236\363\372"
+	.ascii	"O\005V^r\237B\363\325~Xi\242\306\037\316\257\322\002\005\230"
+	.ascii	"\322O\370V\331\310R\245IW"
+	.text
+	.section	.gnu.lto_.symtab.10be2fbdf11ac5,"e",@progbits
+	.string	"readBufferPtr"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\002"
+	.string	""
+	.string	"processBufferPtr"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\002"
+	.string	""
+	.string	"readBuffer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\002"
+	.string	""
+	.string	"globalResult"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\002"
+	.string	""
+	.string	"srxl2ProcessChannelData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\002"
+	.string	""
+	.string	"srxl2ProcessControlData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\002"
+	.string	""
+	.string	"srxl2RxWriteData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\002"
+	.string	""
+	.string	"srxl2ProcessHandshake"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\002"
+	.string	""
+	.string	"srxl2ProcessPacket"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\002"
+	.string	""
+	.string	"srxl2Process"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\002"
+	.string	""
+	.string	"srxl2RxInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\003"
+	.string	""
+	.string	"srxl2RxIsActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\003"
+	.string	""
+	.string	"srxl2TelemetryRequested"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\003"
+	.string	""
+	.string	"srxl2InitializeFrame"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\003"
+	.string	""
+	.string	"srxl2FinalizeFrame"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \003"
+	.string	""
+	.string	"srxl2Bind"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\003"
+	.string	""
+	.string	"rssiSource"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\003"
+	.string	""
+	.string	"microsISR"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\003"
+	.string	""
+	.string	"serialWriteBuf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\003"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\003"
+	.string	""
+	.string	"setRssiDirect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\003"
+	.string	""
+	.string	"serialSetBaudRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\003"
+	.string	""
+	.string	"setRssi"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\003"
+	.string	""
+	.string	"scaleRange"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\003"
+	.string	""
+	.string	"crc16_ccitt_update"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\003"
+	.string	""
+	.string	"serialGetBaudRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\003"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\003"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\003"
+	.string	""
+	.string	"sbufWriteU8"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\003"
+	.string	""
+	.string	"sbufPtr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\003"
+	.string	""
+	.string	"sbufBytesRemaining"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\003"
+	.string	""
+	.string	"sbufSwitchToReader"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.10be2fbdf11ac5,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1851 @@
+	.file	"scheduler.c"
+	.section	.gnu.lto_.profile.c60ff4c304b43f03,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\013"
+	.string	"8"
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.c60ff4c304b43f03,"e",@progbits
+	.string	"(\265/\375`\326\0045\027"
+	.string	"\204\033\312\005"
+	.string	"="
+	.string	"\376\363\357\260\004\022\002"
+	.string	"\002\001\002\002\001\002\003\002\001\002\004\003\002\001\001\240\342\234\212\n\002\214\204\226\247\t\032\002\005\002\005\002\003\004\222\354\265~\b\002\006\007\002\005\002\007\005\351\237\362\376\013&\006\002\b\002\t\002\007\002\n\013\f\002\f\006\007\b\t\352\263\360\321\b\n\013\310\350\226\306\013.\002\r\t\f\002\f\002"
+	.string	"\r\002\007\f\r\016\017\020\021\366\331\241\233\fB\016\005\002\017\020\002\020\002\t\002\021\022\002\021\017\002\017\022\227\314\374\033\023\222\353\236\307\007\004\005\002\005\024\202\273\266\361\b\006\f\002\f\025\026\267\343\241\205\002\002\027\261\356\366\275\006\b\030\247\253\337\233\013\002\031\213\304\205\205\n\006\f\002\f\032\033\352\270\372\363\016\b\034\271\377\336\260\b\f\002\f\035\264\221\325\251\f\b\036\234\360\206\323\006\002\023\002\007\037 \217\346\223\377\b\004!\201\273\366\332\b\006\002\b\"\371\303\201\363\r\b\r\002\r#$%&\302\321\376\347\t\020\024'\354\300\371\217\017.\025\002\005\002\025\t\002\025\002\026\002\007\002\026\027\002\007\002\027\002\025(\256\213\222\035)\267\267\233\272\004"
+	.string	"*\332\255\257\006\004+\271\213\357\254\003\002,\374\362\246\225\007\n-\262\341\350\310\n\004.\233\304\365\321\002"
+	.string	"/\217\300\363\341\f"
+	.string	"01\242\201\366\343\007"
+	.string	"2\313\322\375\213\007"
+	.string	"34\262\366\247\332\005"
+	.string	"5\330\364\253\023\b6\313\347\307\230\001\0057\346\330\236\230\t\004\f\002\f8\371\210\310\233\004<\005\023"
+	.string	"\007\002\023\002\0079\243\304\235\364\fZ\006\002:\240\342\234\212\n;\236\376\250\313\b<\347\273\234\355\f\002\002\r\002\r"
+	.string	"\200\230\250\021&\021\022:m!\303\032@\002\203\020Y\231\007\021\020A\2430\022\222\024$\205e\r\3330\277\267\321\276#\230\345\327\032\007"
+	.string	"\017\223P\242\271q\261!\030[\374"
+	.ascii	"J e\231[\244\017\323\001\205\236`Z\315\262\377\n\n\020\342\222"
+	.ascii	";3\007\345--\2571\323\344\004H\233\317\003j\356c\362\001Y\222"
+	.ascii	"\026\272\247\240\244I\210c\377\017\253\205\210|;\034\375\334"
+	.ascii	"U\373#='p\007\325s\206z\2402\250\341\332\007@l\016\263'\245v"
+	.ascii	"!\3626\031\202\367\356\316OdP\323s\314@S\203\3012\273\214\020"
+	.ascii	"\004t\333\316\310\315u/E\"\002\266\346l\234!sc\005Ds\352v\031"
+	.ascii	"\272\323Y\211\305v7\007\321>\367\221.\326\223\003\207\227\253"
+	.ascii	"\374\234~\315\341}\310\021\213\r\016\207te\273 \257\375\316$"
+	.ascii	":\262\254\241`\265\332 .WR\201Mb\200i\314\307\207\034\210\005"
+	.ascii	"A\376\266\211\337\210\0341\330\253\273\363I+\247\215u\200\006"
+	.ascii	"L\342p\214\007n\320`F\317\243%'~>Q\274Dj\020\223\307p\373\235"
+	.ascii	"\271\225c\232\2252\301\030"
+	.text
+	.section	.gnu.lto_.ipa_sra.c60ff4c304b43f03,"e",@progbits
+	.string	"(\265/\375`\027\001\325\005"
+	.string	"\262\006\022\021\260\364B\007\220\205\320T\033X\330{\302\t\221;\245\316\320\202>\373\364lg9\033\315\314L\314.k\251L\331\211\222#{A\236\366\361\216\331\230\214k\241\330\304\020\007C\2416a}\260/8\nlW:\252w\262"
+	.ascii	"\001@\250\240\222Y\303\030\220\0029f\335\022`\230,\253UM\305"
+	.ascii	"\205\366\177\003q\221\307\216\223\tf\220#\354z\037ny!\304\203"
+	.ascii	"\362M\274Os\200\305E\361|\235\020^N\375\316<Pmq\311\354\\':\213"
+	.ascii	"^\262'\322-\345\r/iA\323\333J1\302\274\025\343\317\375=\364\232"
+	.ascii	"\n\006T2u\364\354\220`\322k\377*\236\007C\337\304{\247\r"
+	.text
+	.section	.gnu.lto_.inline.c60ff4c304b43f03,"e",@progbits
+	.string	"(\265/\375`\253\f\205,"
+	.string	"&\274\313G\220\232J:\260t[\023[\320\245ZB8\247\227O\343X\373\223\233\247\367\331X\326x\206\255\325\b)\264M"
+	.string	""
+	.string	" G\303\317\250\251\262j\225\b'\316&"
+	.string	"\213\256eM\020\312B\347Y\004\005\3000#9\031[J\231\002\251"
+	.string	"\276"
+	.string	"\275"
+	.string	"^\342\307\217H\253\246\345\n\212\206\217*\374\330\333\217\273\335w,\277c\371\035\215vh\306\215\207\236\274\357\346K~{\372\023\177\026\335\375\373}\276]\374\004\315\027Z\375\271K\317\315\017\332\346\003\255\"XU1\375\331\247\177\217\360\325\204\370\263P\317\271.\355\213*)a\036\256S]\214=\2131\306\205b\313`\331\241\306\302ox@\375\257\233\237H+\354n"
+	.string	"\374\377\300\352\365\252\304c\272\233\347\263\305_\305\376\230\032\nO\250\330\257\251\241p\302w\277\276\355n)\361o\342`UY\030\206\375\265\211\223T\225\205\005\375\016\276\303\025*B\034Z\250\2138r\334"
+	.ascii	"\"\340\t\206LA\023\025D%\016\214\216\002\027R\036\360\210\277"
+	.ascii	"\260\221;\243.\330\242\220L\205\230L\034E\243\215\\\203\007\001"
+	.ascii	"\231\013\246\351\016\364\363\364\261\250\264]\37790.\361\221"
+	.ascii	"\356\036p\003I\314\245\273q\356\243\303G\373c\303fE\306\303\277"
+	.ascii	"f\021\331\372\"O\200i\267\346\202i$\323\222\371h\373\355|@\216"
+	.ascii	"\225\363\200;Si\327ti7\362wZ-VTo"
+	.string	"\032\304i\331|Yi\363\267_\3519\017x\036p?\376\002\304\177\f\320\237\275\3719\216\337\371\305\351O\037\267\261Y\241\315\3179\373;\271?\215\366s\373;\213\226\315\312\211\331w\3541\024\257a\343W\310A\277i\337\340\242mkM\\\2613\330\342\206:\327\200\341\302\377^\337\362-T\240\302\202\225Cw\nG\f\206U\205\f\200\"_4\322\360|\202\217/\301\210\213\214U1\233l5\244\0323_\376n\234\350\274&\255\217\252.Kt\036\201\267\253;Jw\b\344\356\323h}k\344\315\354\212<\232/\177B\004\234~\003#\256GU\201?8\017X\243\206~\252\007n.\230\226a\177nb4\261\253\340\243\334\001\322\366\223\310\2357\320\311\271\202\377,<\321\177\244\355\222\234\344I\337\376\274\302\234\211\327\036\245\332\272\311~w\337l\361\177\271:\264dZ\356\223\266x\"\226\0135\246C\367\t\017\001\342<`"
+	.string	"\361\034\232\260\034\327\r1]\013\203\006\016M\265\306\017\344\374\247\356:\237\333E\313d\213lm\276\210\271t\275\005\205\375\231\244%~\356vbo}l#,K\255\347s\273f\322\376`\"\2447|\366\230k\213V\226R\233,b3n^s\372Y~\226E\373\335g\271+b%j\\a\342\313\326N\261;\304Xe\351g\331[*/`W7d\231\202\2032\266\326\364\363H\352\306h\275\200a\r\365\263\205\256B>\003\341\202\325\343\220\020\025\250P\211\026\352-t\204H\264O\372D\201\366IK\210@\013U\2468\373\364'\021g\241N\236\227\370\f\316H\226\257\335C\207\201\026\2501\265Cf\246\204$I\222J\007\261\004D9\310\234\243w\022\340D1\305\321 bjDF\202\004%IRn\2459\316iU\203\264\204\337?\312\267\021\215_\236\263\312"
+	.string	"4\002\376U\237\212j\333&\032Cl\026PU\263\013?\350\201O\357\307\222N\371\0376Q\343W\027\032\231\3355W\374\3662\337v'}f\317+\223GZ\017\221ts\367\316\254\004c!A5\022\025\271~\b*S\241y\243\303\354\032T\2077\302\034\260aTq\210\270*\216^\3730]/>6ZM\251\321\300\373\356Z\300\265,\332\037\234\261\n\217"
+	.string	"\022\244>s\027\306\017\f\344i8\2617J\"\242\314\020ML\235\273\024_i0\247\207\375\362\223`^\025\242\261\3339uH\207^\312w\006\312\317}\371u6a\031\245\007tb\231_\256e\344T\004\242\351F\332\270\220\276N%r\302\b\347\216\032\252\303d\252NT\204\365\")\360__<R\221\222\004QT\336\361\2706l8\220\234.\332\236NXH\370\303#\373\361_C+3\366t9\003g\233LPf\255\023\022D\027\303\336\214R\266RZcN\033\241\205\027)\310\366\362U\325\270@\304\332\252\177\243\330\200\016\243e:\230\f\201X8*\207\270\354\374$=b\332cI\205\3708\024cG87\355\322\0267\313\222\334k}\027\351w\245\036\233\352:JM\354(cI\tgu\375\361\232\213lm\317+\317\034\004p'\374\231\272\340\372\357\243\206\234\253,\357uT\240\031"
+	.ascii	"q~\372\")\001\314u\345\375\n\354\316\033c\251\245\223\r\245t"
+	.ascii	"1\272\253+\356-[\377r:\3715~\3666r\356\232^\245\21208\332Mc\327"
+	.ascii	"\\\253k\022IE\265\006\375L\213\021\304E\212\236oxi\345\347\367"
+	.ascii	"8t\331\266\234\323\033xA\236\341\212\277\2674\253\r\"\026\202"
+	.ascii	"\210\2338\\\234n\264\016'#\021\377\233\321G&l\224P8}\205\302"
+	.ascii	"\347\265C\205\301>\342\361\020\251\311\017\223\201\255Y\372h"
+	.ascii	"\370\003\262=\324Q\261\270W\374\2148\202$s%J\r\023\005u\363\303"
+	.ascii	"\036\334\201w\367\301|&fS\23292?HI\340\245\246\234\352\234\340"
+	.ascii	"\355\332\237\311\231\370\260U\333\365\016"
+	.text
+	.section	.gnu.lto_.jmpfuncs.c60ff4c304b43f03,"e",@progbits
+	.string	"(\265/\375`M\006\305\017"
+	.string	"f\322;9Pi\223t\210QU\025\233\f<\354i|\352\230\211\250\252\206\254\021\242\n\021\025\"^\240\241\351\306P \240a\330\307\377f\bu#\353\300\260\210\037\343\232c\332&\2264\231d("
+	.string	"*"
+	.string	"1"
+	.string	"]\220IO\352\335\376W\303\016<\244\264\326\332\267\026\245^\324\243|%\225 \274W\305W5\311[]\275\364\240g\206\021\202L\232\340\347\317\304\300J\316\271\367\007\201u*\270(\304\310\210\313\352CL\275\377\200\351M}\362\255X\346\005\306\271O\221\003y\001\254\005\220)T\362\203\364\350\340 ;\033\032\024g\303\233\312\270\205\321X$\231\n\206\264\005YARTo\242\210\034h\255a~\300\317\260\204\217p\347\202$\r\220\005\332+\fAk1\350</[\270AO\300\246D?\302\233\300\325\346\312\303^R4l\n\367\350\272\006P\002\250"
+	.ascii	"\023\326\004v\250\201\311"
+	.string	"C\266 M\235\016`\002\021SU\365\022`\361\201\006\304Ie\034\"\206\004SEq\242\030\327i\016\310\225\024\226\326\352Kj\341\202\035\3238\347\272\321\201\013\331,\016)\265\365\036\375O`\336~\266\343\\\345i\320\\h'\240\212\336\005\025\301>\332\005\037\032\236\360\251[\030-sm\267\216\021]\016\b\231I\346\205|\216\275c\026'H\376TFyH\252\231Y\225\246\304\341\200g\023\223\3437!_\324\202:n\021\030G\032\3718\340;\026\216\373\017O\005\226\375#\271\341\013\033\022X\274\003\347\225\323\025\304\253y\245\210:&\r\333\331\323L\355\270Y\202\317!t0\346\271\300\3729>\316\374~\237\264\373\327\023\244\317\326\032\220d\214\026Q\243\253\245\306\027\241\247#\346\324\020\222S\013^.\261\220\331\223\250\204\365\3619 \264\013\001c\201\334\017\177\203\204q\316\324\324\353\275\371?\362\350\255\030h\367*\335\313"
+	.ascii	"\024"
+	.text
+	.section	.gnu.lto_.pureconst.c60ff4c304b43f03,"e",@progbits
+	.string	"(\265/\375 z5\003"
+	.string	"\242\207\030!`O\322\0010\f\274d^\002\007\t\t\202 \b\\\005\211\002\035$D\354T\247S\271\003njx\007S\242\031\272\240\373\231\236\331\231\234\271yi^\231\027f^\256\345V&\345\233L\311\215\334\351B\346c:f\343c\314\305\247\230JL\304=\\\303W\270\2049\270\202\033\270\200\357+\351\312&3\033\005"
+	.text
+	.section	.gnu.lto_.ipa_modref.c60ff4c304b43f03,"e",@progbits
+	.string	"(\265/\375`\002\005\265\022"
+	.string	"VVA5PI\233t@C\007Q\273\231YU\244\313\030\234\231]WEU\2033C\370\314"
+	.string	"CN9\212\337\327\377\3777\033\304\264\225\351\006*\024\207\354\352\326\215\255\021)S-"
+	.string	"/"
+	.string	"4"
+	.ascii	"\020\324\013s\316h3\005Q\207+\277NH9\244\314\363Q\326<\227:\243"
+	.ascii	"v\252\323)\237\230\271(_\264-\247\362Wd\340\216\001|\243!s\252"
+	.ascii	"\234\003~\001\274{2\316$\235\221\362\b!\350\031\235\323\363;"
+	.ascii	"\023\020\315\304L\200\357\330\345jm\2615\372<\275\\\363\273v"
+	.ascii	"\251[\307Z\324W\026&\255\343E\352\363\260M\362\253bJy\031\314"
+	.ascii	"\3066\333\335\240$\006.\230\224\t\020<\357\035\245s\017Pb\003"
+	.ascii	"%J\220bQ-6(\006\026Q\201'p[*\313CD\345ly\210\250*L\3412\234\t"
+	.ascii	"_9VFA\227\364\216]\025\313Q\246]\307\242F#!\002\004\326\332}"
+	.ascii	"\260\203'\022F\206\374c\352\251R\266\3435\331\266\002\200\242"
+	.ascii	"\250qAs4\222\246 \031\016@\002\202\020\031Y\007\021\020\2454"
+	.ascii	"\226\315\314\224$\205\016I\203d,\316?\346\370"
+	.string	"\371f;\030\353av\333\323\210\261vT\311\241_\221\020\301\311\237\213\377\255o\315HN\\H\341J5\n\333\240?\267\357\301~\026z\354\361\201\005B\\4\214\003\320\027CR\300\261\200<T\344\250 Z\311\256~Z\001d\212\275\360\352\002\302\270+\305\350i\005\323m\353\030Y\336\2645\376\330\221_d\373\363G\f_4\030\302\240\310\332\370\n=>3'\266\376!+\254\020\300\354\272\3034\336^\270:\303>\324 \026#\306\262\257\230gf\t\271\031\342\216\223\fP8!\310O\240\312\371\260\347\362\2147,RS\032\235\332\302\221\275y\210\300\226\233\353!\263cK\001Sg)*\310\240\213\377\327\305\364\222\301M\224\177\006\263\341\350\320\274\207\273\317\212\373\017\333\n\232\277\033s\016\364\220+\241*:\276\311\026#\214\337\330\374\250\rT\250\177\334\366\017 'Eg\307\b\352.\312bE\247\341\230\f\304\214b\343"
+	.ascii	"\343\234\t\221g\0033h\226W'f\3537N\247o\347:7\2720\321\213\277"
+	.ascii	"\342\020\237F\340\371?\036^\214\232&\367\f"
+	.text
+	.section	.gnu.lto_.lto.c60ff4c304b43f03,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_queueClear.36.c60ff4c304b43f03,"e",@progbits
+	.string	"(\265/\375`r"
+	.string	"E\t"
+	.string	"\006\321>9@\217\322\001\270&\204\362r\337\303<\003\200j\004\021\3101\313\256\352\244\363\376x\027dX\262\371\341\307\320\3416\332'yQ\024U\021\026\036,O\353\311\371\360\376\336d\357\224\002*"
+	.string	"/"
+	.string	"/"
+	.string	"\266\237q\310n=,\355S(\025#\257\335\255r\343\241\307\220\177\324\001\300\321\367\2101\330]Gp\204q\313\333&\260]\355k\002\276\351\323\020\240x\360\323\007\321O;B\"\036\264\006u\001sQ\310\317\016\277(5\354g+I6-P\275Z\004Jv-b/\3132S8\002\230\257u\"\351\246\007\353\265\271\237\272\210U|\223\035\274\362\212~\316\f\326\311E\024c\246\361\035\367\n\335\374\037\017A\001\245]\321A\037\344!\237\3268\336\266\360A\330\0224Oe\340\016:U\363<\2253\340\256a\363\352C\327y5\023\356\263\225\244\f\245\202\271Dr\302?G}\223\237p\n\235\016\375\f\020"
+	.ascii	"i\3317c\032\203\fo\177\007\"V+\202\213 \n\3007\250$\220j\033"
+	.ascii	"q\345\214\013cZ\260\370e\bp\351\026\355|\002"
+	.text
+	.section	.gnu.lto_queueContains.37.c60ff4c304b43f03,"e",@progbits
+	.string	"(\265/\375`\211\001\325\017"
+	.string	"\246\036kF\360\262&\035\260X\036Wn\316\020\216+\004\211o\204Q\303\260S\360\367_\\\235\025\036\264\372~g\274\277f5k'\335\327>\264\262\026\354\214\331\2608\f<\347\237\245k\027\254&\224\214\263M\f\313\020K\366\2262\245X"
+	.string	"R"
+	.string	"X"
+	.ascii	"\027\240]n\017\240]20A\271\373W\002\346#vx\200\3613\347\307-"
+	.ascii	"\t\017x\374n\251\3355\031W;?um\304c\275x+\22551\217\021\202\215"
+	.ascii	"\n\023#^K\334Wx#\344\261t\017\273\332\020\002\372\210y1W\320"
+	.ascii	"\311\234\323\352\342\201\270A\267\335\331v`?\f\007o~\315\352"
+	.ascii	"x\360\336"
+	.string	"U\253\252\277E\360\371\tR \234\023fVd\362\2208(\016\336\376\347\303\034\362_\374\205:h\235-\365a\013A\036\2379'\311\245M\266K\003\3616\312\016\331V\265\337\3426\250\337\260\034\300\234-\0265\346\374\024x\301v\351/\316\321.u\t\360\204P\351\354q\3169e\202\357\202\366)dd,\231\225\316t\206\210\026\216\270.k\3735\201<-J\304\266;\\\006\3136\347|\340\307xx\362i.\255\262\242w\271\364W\366\260#\250\031\262\002G\245\263\335\351y\305v]\366\227\322\006=r\314x[v$\222^8\241\244D\213JL#\f*\025F\026D'N\003\t%\003'2\235\270\222\003.m\030\231\270\224R\311\304\205\276\371m\371.>a\007H(\223~\247\035v\n;=\241l\377N\213q}\242\332\325\tm]\016\315D\320\356\017%\371\356\213\355\225\240\343\261\323\260\216Oc\016\316\t\036"
+	.ascii	"i\355\233\202\341\257j\356\2500\221F\214j1\204q\2776\244\002"
+	.ascii	"V\bmK\n\302\033\023\305\363\202\302<\n\232h\211O\314\212\242"
+	.ascii	"\013).281V5\334s1\316](\021\252P\256\251\363\236m\237Z\332T\257"
+	.ascii	"\275\204\371\004"
+	.text
+	.section	.gnu.lto_queueAdd.38.c60ff4c304b43f03,"e",@progbits
+	.string	"(\265/\375`\275\005U#"
+	.string	"\346\376\333H\200XN:\243\220^\026\351\320\"\367\363\324OJ\021\230:G\2451O\201\227\216\260\210H\240\177\n9\350\346\333\314\210sE\366\220\371\350\n\334.\347e\201qo\006\036\243\246\372\363\323\352?\220e\326\214l\223F\b\221;\311\307"
+	.string	"\275"
+	.string	"\313"
+	.ascii	"\352Q\003'\022\363z\3242'1\257\314l-\363\265\276\225t.\342\205"
+	.ascii	"\367V!\241r\257\222\0017P\217\262\3629\351Q\365\001\322\243\016"
+	.ascii	"\036$\261\322\225I\247S\3215\201\315\335\253\034\366\020\034"
+	.ascii	"\034\224s~*\317k+\375\267\372z*\017\230\242g\007\255\022?\306"
+	.ascii	"\177lOS\314&\273\366\b\211\352q_\207\244\027-\272 QS\357\361"
+	.ascii	"PO\013g9\234\316\366$uZ#of\316\334ay_\352q\240\2174\be,Z\024"
+	.ascii	"\013\307\317\263\302V\026\221 \024\323\331^K\264\217\335\316"
+	.ascii	"\2002\332Vq<x*@j\271q\266'\344\231\263F\025\367\256\367,y\232"
+	.ascii	"\262\226w\341\336\313\366\b\025u\006p\3463`\346\b\314(\207mb"
+	.ascii	"\274\310\272\255\370\207\300\226V$\330U\334L\337$\276\2700\331"
+	.ascii	":\346K\371\024n\362\257\270\210\317\354\217|\226\036}\277\353"
+	.ascii	"6\313)\016\271%\265d\357\230\225E\333VfvV`\334U<\200g\307Z\326"
+	.ascii	"\271\271\330Yx\256\337\206-\003Ov\376\235\226W\236e\337i\271"
+	.ascii	"\307\263\254\246\226y\251\345\364\264\214\242\226O\324r[\313"
+	.ascii	"\366\264|\0028j\310)\252\272\006\243\274Nwj\256\032j\226\344"
+	.ascii	"b?\331-\263\222\317\3445\351\300\2172ZYa\027\343\217\361\n\226"
+	.ascii	"t(_2\322\225\374\301)\016\251u\357=\024>\030\337\353_H\217\302"
+	.ascii	"M\003L\312\013U\001)\2465w\357\3659\312\017\002\250\232\332\250"
+	.ascii	"\3331\207zNK\323\346\365\307\030\227\024\355\035\243\235\366"
+	.ascii	"\233\354x\372\215vj\227\\\032\225\350\230\311\351\350\235\335"
+	.ascii	"m\271\276\2640\331\272-\"\316~\363\215\213\203\236&\244\336\313"
+	.ascii	"\004\201\237\005\306\211\356.\203<\302\265d\357n\267\212\\\232"
+	.ascii	"\324\023Sk\342X\320l\237\251\306\216\311Pb\305C`C\306\021\330"
+	.ascii	"U\374\3451\264\311-\313\320\237\375c\327"
+	.string	"\320&fY\326WJ\007\340\314\331\255\241i\2033\222\266\025\257E\316\235n\270\240\317\205=C\330\357\1779\357\275\027]pa\357\364\231 \313\214\310\342\230\217\252+g[\351\264M\033}\275\205\270\025\242z\357\225\300\257r\263!\376\325QNAD\224\036\325\351'NI\344\226Y\007CC6\305\021\220\213\223\203~\214\204T\274(!\204\"\350h\270b\b\210h\030dt4\374\351\341\"\026BFC\027EEFCV.\275\253\330\332\237\245\314kp\243\261,\353\275\371w=C\233\232e\331\372\263\003\201\315\027\226\272\030\366s\342\273\351\206\003\372\374\367\353\302d\353n\233cL\251\365\3277}\346}\260\356\212`\302,V\023\257\032>\365\327|\362~\315\363\346\371r'\243\304\277b\017 @\244`si\326\216\373\361\314{\355\tI4#\322\246\341\210\005\336zKQ\350\246\204\226\327j\373\232y\004\220\375\221)"
+	.ascii	"1v\f\346\177i! \214\212\273\021\023$\275\370\332\216Yp\236\356"
+	.ascii	"\365\271\306\210,\236\255\305O\362\310\314\033\276F\264\020\346"
+	.ascii	"\001w\250q0\004\rsHdF$\020\221\304\031\016\200\002\021*3n\021"
+	.ascii	"\300-dFR\220\333\001(\376\fe\307\361\233}H&\315#RG<\033\271\272"
+	.ascii	"\346/j\022\313\321\f\264\265d\207\355\030\265\221\301{M\233\242"
+	.ascii	"\211\210\002I\364; \271#\360\324\007b\370\351\247\360\023\202"
+	.ascii	"@\002\365\232\307\255\rt\205\300\367S>\263D\335_N\334\033\261"
+	.ascii	"L\341\252\215\006-\221\326@D\\5\341\337\f.G\210\273\211\246\231"
+	.ascii	"\350\210\206K\023\202\211\360\177X\002P\341>c\207\334\333be\252"
+	.ascii	"\357\237\217\b\201itW\276\271\226\"\013\342T\314\304\362g\306"
+	.ascii	"\r\b8\005\212FS8\2635!\363\245-\017\262\221d Z\306\013\372k\215"
+	.ascii	"\256C\314\"'8=Q\277\240\357p\375EX\004,\316\321xn\200(\360\234"
+	.ascii	"\324\3331\361q\206\255\317e\376\3360?\367\244\t\367\215e\235"
+	.ascii	"\032\347\251H#\324"
+	.text
+	.section	.gnu.lto_queueRemove.39.c60ff4c304b43f03,"e",@progbits
+	.string	"(\265/\375`\354\002\315\026"
+	.string	"\346k\226J\260\226Q:\024\306<\277\024\004\347\321;W;@\243\271\353\326s\337_\177#\220\354\026\357\0204\b2y`\377_\177?\200Ot\317,V\375\215\275\237\235\264/\376\304<\303\365K\300\023\337\031\242!\265a\"#\215l\"wJ\001\201"
+	.string	"{"
+	.string	"\203"
+	.string	"\002\304\3333\273\264=\247\375\025?\232\235\205\354\253Zw)\230j\355\315\270"
+	.string	"y\352\336[\306S\362"
+	.ascii	"\306S\00353\323\336#\022:\217\003\320\213&\265\366X\033\302."
+	.ascii	"\027{\3678iG\215T\334I\363kG\255\350\200\202t\2679\232\030:\245"
+	.ascii	"'\202?\202$\3514\\\024m\216P\024\255\350,\210\213\004\304Q\352"
+	.ascii	"~\346\376\367\331\244t\013\222\244\033\372D\335\324Z=s:\f7y\333"
+	.ascii	"B\266\021\330\373\022\217!#k\255\t|\030\007\276|\243SW\210\315"
+	.ascii	"\347N\375\330\252\310\260\344\303Q\223m\016\367G\021\244\244"
+	.ascii	"]\236\335\253\315\003>\234Dxw\366\352,~\026O\253\250v\272\334"
+	.ascii	"\351\224\373\356\024\235&\3514j\247Gq\232\212\323\342N\357N\317"
+	.ascii	"9\375\026\007LM\220\300\360\250Uh\b\245\366\240M$\356\273\375"
+	.ascii	"\236\377s\351\2738\322\354>\013\311\332\005\022\370\242\303\221"
+	.ascii	"Zk\314\251k\310\323.\327x\232\262\005Q,IY?x\241\205\276\221#"
+	.ascii	"8\350`.\t\315\347\246,\314\223r\322E-\271\266\016\317|\316\n"
+	.ascii	"@\340\266f\337\206\217\213\220\2353\311\b\020-\221;\215\3705"
+	.ascii	"|f\210j\255\317\331\206\235\206\314F\310\351\f\324RanH\346\251"
+	.ascii	"\035\027\365\204\373@\336N\243\270to\004w\3426\207\336\025\367"
+	.ascii	"@QR;ww\214R\304\004W\342\366\242\344A\211\270<\263\354\027\346"
+	.ascii	"\033\3623\235\3306\20499S'\206\323#\272E\003s\355\370<pIh\305"
+	.ascii	"X\023rpxX-X\214E3\300/\n.\030\253\347\365\202\261\312^\375\356"
+	.ascii	"\374\026g\360d\004\\\032}\332\370\337\033<\025\001\227\304\353"
+	.ascii	"\270\212\312\372\306\266\267\021\250\345\271\024AW\273Df\314"
+	.ascii	"U\266j\313]\260\343g:\261S\271\001\206l\260\315\341\305Zk\035"
+	.ascii	"e\256\332\325\376\367\026\341\224\341a\227\203\212\253\332\324"
+	.ascii	"\006\035\310\r\245-wn\220\375\323F\037\307s\320Z\0015 `\202!"
+	.ascii	"\205U\007i\366I\033\326\336\334\2310\356I\213=\362\3015X\316"
+	.ascii	"UX\261\242x\376\261C\365\313\246\315\206\325N\\\n|\201\213z\263"
+	.ascii	"`\033W\244r\234M \233X\022\332\310\0067\264\305\002\tl\341\016"
+	.ascii	"u\307Q\353Or\336\350\226\342W u\035\270$\270\333\364\t/\n`k\324"
+	.ascii	"\225\242\225\0211\366\007\267YF\345\215\264@\256\216\337\234"
+	.ascii	"-\326#h!\"\020\237{\265\375\t"
+	.text
+	.section	.gnu.lto_queueFirst.40.c60ff4c304b43f03,"e",@progbits
+	.string	"(\265/\375`1"
+	.string	"\005\b"
+	.string	"\002\21767@\217\322\001p\201\211\\\200\367\251^\002\214f\320!\223\213\205k>8\001HS\374\206\274>-\246\204\273\317$/\212\242\352cN\r\ro\273\323D\322odo\271S\n\3066[\346\320Y\310\0300\216\204hPx\220\330\306\221\233\002k\021\331&%4m\223\231\271\207\253%U\202\220V\034\274\204\303\354.\202?r\222\216oz\364\204\307\243\027\222\252\005\245\271/\362\351\023\337d\n\247\336\273G\337\251\3531\222T\035\253\320k\331\023\364\024\303>\\-\331~V\b\300R\321\240\354^\264X\233\022Q\034\266?v\306\3778\310\307\334\300\324\030]'\017\213\023\313\356\224\236\027\270\0361\017\270\0365\343\334\037\347?\344p\265\261\322\211@\177\227\204\335\365\353D\243[o\333\300\266\264m\022\r"
+	.ascii	"i\331'c\232\372\f\267\254\224\030\333I\363N\214\025 e\213k\342"
+	.ascii	"n\004\326Bd\342\256\230\332I\006"
+	.text
+	.section	.gnu.lto_queueNext.41.c60ff4c304b43f03,"e",@progbits
+	.string	"(\265/\375`^"
+	.string	"\335\b"
+	.string	"\226\020<6@\217\322\001\320\316\311\231AL\265\330\025\0049\230\330\2144\310\370'0@\333\362\266!J\353Gi<f\266e\212\242\270\036]5;\242\273\273P v\354nR\246\024*"
+	.string	","
+	.string	","
+	.string	"\027\253\227\335\b\035?\360\3564\027xw\332q\355\251\371\027y\306E\305\262\235HO"
+	.string	"\205\335un'\324\255\267\215`\033\332\216\t/;\222R9\354gVS\266\323.\323\231\351?L#e\243\262\213\361\202Y\024\307\372\260=\2621\037\344!#k\004\321\003\365V'\001\252;\207D\242w\3474\200\225J\242\256\255\245\224/o~M\275\305\206\351#\217v\371*S\270\225\337\356|\267\336\335\265`%\243\224\001\356p2\317C\210\301\323\320\001\301\b\207\005\b\330\311@\220s\340\217\204'\203\023\237O\006\261\270\327\224S\203\222\232*n\242iv7\301/\371\n\344\007\017"
+	.ascii	"i\331'c1\345\315hE\371\263\320\234\220\034(C`1K\211\255Q\214"
+	.ascii	"\2700\316\016#Z\260L\\+&a\222\001"
+	.text
+	.section	.gnu.lto_deadlineHeapSiftUp.43.c60ff4c304b43f03,"e",@progbits
+	.string	"(\265/\375`\235\004\005\034"
+	.string	"\306p\255H\260ZQc\020\025\344\317\3637/z9\263\214\b\327\030)6\322\025\020\235\023\221\264\354\361\t!\b\217\215\245I+\002\352\255Ms\013\022\336\356\262\243\376\240o\354\f\307ot\022\020Z\327\367X\311\017\263\334h\357-eJ\001\220"
+	.string	"\223"
+	.string	"\233"
+	.string	"O\375\037\333\301\022\245\211\2342(\311K\323\275\367\301G\303\312\217\255\217\265e\373\325>\221\027\331\035h(^\335KC\250\311\2757\202%\224\037\025\274"
+	.string	"\371Q\374"
+	.ascii	"\362\243w6\323\323\236;\303\203\005\2050\352\336\373\2626<\326"
+	.ascii	"\335\311Q\264u\347W\036D8?\023'\001\374|>\257)~\275:\372hqQ\254"
+	.ascii	"P$\310\215\377\274\252\370\335\2106\bT"
+	.string	"\324\372\371\252\275\317E ;\210p~-^g.\334{]q~:\367\314m\353l\327l\261F\246\371\224\273\365j\026\253z\365\340]\036\370\223\007\336\"\253\332\262\252\353\253/\240\025\006\311\005t\357\212\252\251{4\016y<\371\224\035\024\373Q^\244\273\024\264V\030\351\f\235\fi\371\001\344\020:;\023\224\350CO\250\3315\261'\324\350\356$\201\025\374\322\031+r\356\211\024C9ds&7\303>\016\355.\224\253\007\322\313\"\347A_\242\273P\356\327\227\263\032\236\240b\241\374\370\033\340\301[\373>\320\223\214\030>E\215\360\215\\\250\373\021[\035\250 \367\3367\200\027zv.\250a\027n1kz\222Z\366\302;\340-\t\001\362\224\304\330\221\"z\003\311\022\2004\004\311I\013\226\233:\306+\313\262\007\236PPUk\355\312>\311\305\037IM?\240\220\364\350e\021q$\263\201\322\221\265+\233\303\257\304"
+	.string	"(\335{a\266i72\177\244\347\336K\241\312\255\234\276\216\217\366 \253\307\221\221\037\253\265\303') \257V\031\302oK[\215|T\256\213\366\366?\037]\354(\362\311\350\325*\253\345K0\310Z\036;\355UX\226*8lw\354\017\037\376\340:g2\334\213\206\316f\250\211"
+	.string	"\304-\206+o\250\2063w\346l\030\324f8\232\332\fgq\264\323\026\253\221$\316\0164\331h\323e;C\344:\234\037\314\333\213&\213\315^\246\355\366r-0Z;m/\034\212\332^\255\224w\273\343\363r\211\323\021\317\366r\220\226\307\377y9eD%\226\326b%\255hS<\360y\305\361\302\306\317\225\233:F\274\367\336\221\306\226\271M\221\261\034.\025\213\2022\320\245e\237P\303\304\230\004\224\234\230\204\300"
+	.string	"c6h\272\220\311$\240\2644\016\227\244\2066\377r\363\322\205\3062\bc\250q4\347\03422\"$\022\210\220\264\2301\220\002\031\263\242\007\021`AC7\244 \207\315\3141A&M\017\303\302\363\223^B\262\242\264\343\326\220\004,m\223\332.\344Ch\365@\210pr\234\030Ss\301={\200\021\2074"
+	.string	"J\316\206H\232"
+	.ascii	"u\313\220\355\317H\260\200\370\303S\n>\\\330M\251\212\265pj\016"
+	.ascii	"\270Of\321\274.\034\252\215\222\225\310\323\210:d\337f\254u\022"
+	.ascii	"\243\022\374\212\302\250\325{DlF\253\227\314E\026\220\345\235"
+	.ascii	"\b\252\330\210\375\374\331\206\357,Qo\256\374\2761\351\177\227"
+	.ascii	">\307\037\2700iW\333b\244\330e\324\342\313\265\276\324AjU\232"
+	.ascii	"O\035,\n4\210\312\bH\275:\355%\223\334\377"
+	.text
+	.section	.gnu.lto_deadlineHeapSiftDown.44.c60ff4c304b43f03,"e",@progbits
+	.string	"(\265/\375`\231\0075("
+	.string	"\352D<\017J\200\234Q:\277\362\234\202(\241T \206\340\200\020\215[\261M\013\325\331\322\020\035e\203\255\007j\177t\267\334A\332\331\372\230\334\352\367f\335\\w\f\254\321/\f\2351\235gW\271&\323\247]\361\233\244>\231%\204\020\262w\222\001\332"
+	.string	"\323"
+	.string	"\336"
+	.string	"\030\t\005*\347\274\276\355+\371\222S\365:e\202\206\264\223\221\232\336\004\301 eB=2\252M\300\204qQ\350$\235ECj\363q\002Tk\244\301\317\016R\177v\003\273\327\237x\355\356\337\356\033\371\221\340\223\235\325\261\234qD\261\3129;\350\007\352O\332{\320\237\346y\320\237\035\354.\363\226GN\233\330\024\227\254\3119\327\360\216\3067\370\025'\246\246\350i\342\033\354\337\"f\224\216G_\323\nQ7\225Nf\224\204 \217cJ"
+	.string	"\343Rv1\3120S\342\022\220G\315\270\261b\202'c\214\253^\030\343i\361\311\310tQs\001\227\034c\n\324\300\322\"\351\236\352\213\233:G$\223\226s>\325/\212#\361b\234#\3627\255\220s\356\253td\361\226\275\273\247t\367\211\356\024(\270\251\177%\360"
+	.ascii	"\343j\254\303\347U\336=\327z\317\376\345\315\363\333\002d\267"
+	.ascii	"\003\310n\357\3746\200K\275u>\365\316y\362_cO\362V\237|\247\262"
+	.ascii	"\333\250\354\366)\273m\312n\343\337\276\277}\003=\2535]\2650"
+	.ascii	"9/\205\265\311[N\245\223\226\177\tn\351>\227w\001\336\213\356"
+	.ascii	"^\246\326\006\213\020\255z\036\364J\227;\226\316\312\265\202"
+	.ascii	"W\200\307\302\240i-Z\033\307\016\352\025\273;\026\233\365*\r"
+	.ascii	"!BpJ7\204\b\300SA\320\264ckc\311\230\211\255\006\365j\304\261"
+	.ascii	"z\035\364\363*x\345\357\016h3\322x\253K\001^\37133S\233\2217"
+	.ascii	"\376\260\312\240\376|\336y\222_\352\237:\332\375(C)'\177B\342"
+	.ascii	"LzEN\221\350#y\025\360L:\024\226_\250\032\366gY\3644\266gAs\342"
+	.ascii	"\0259U\344HM\241\272\200\2349\330\327\265\302L\261\212Q\350\340"
+	.ascii	"\213\017\320\030\202\342\246\356\356\200\002\230mu\271\341\345"
+	.ascii	"\005\313\016\006\200\007\240)\276\301\330\304;\370Qn\022\001"
+	.ascii	"\303u\2448\025dxf\350]6\n\\&\216u\031\366'\250\273\215N\306v"
+	.ascii	"-\0369g\tb>\306C\337\307\317\026\272\335\320\237\030\257C\251"
+	.ascii	"\257\244\360\206\375\236\030\006qI\210\211u\364\251\256\266\361"
+	.ascii	"J\342\304p\233w\305)F\221\203/\346)\311\202t\301\272\277\374"
+	.ascii	"Vg\365}4\256\261\356\225\032\013\375y\361\231C\352\213I\b\346"
+	.ascii	">X\007;\261Iz\372M\240)\366\301}\177~\234\203\257VR"
+	.string	"\215\373\316BS||\252\233k\234\324$=\roXw;\274\231s\3168-\002\b\267\313\371jE\354n\307\336\b\350zB>\265\307\301g\001\367\033Z{\354\006\334\017\367\033\241\300h\347\223\031\355|\330\007\002Gd\372D\204\310\361N_\017\227#\342\t\341\324\022\270\241\242\334\3317 \036\216\3507\204\023q\353\325\212rB\273\332\215\327\253\001%h\326\b\307\253\371X\226W[[\341\261\216\250_\360\262\372\342\022\342\341\332\203c\364\230`\314\260\013\266\005\322g\213\007\337\243\256\203\214\266\331r\251L\021&\242\253\302\266 \205\222m\266<q*\311|)G\334b/\211\330\263\273C\366\n\357\321\f+\350\221|U\347\036\246\353\240W\275\261Ep\303\203_\365\313\344\305\262\306\221\244\020SQ!\262\300\301M1\250\256,\252\016n3Uq,\206S|\200F\224\222\255\030n\362\272\200./G\001\260\200\023\2438"
+	.string	"\376\0236\354\317\362\303\301l\001\200\241\250q0\347\030Bf\244D&hS\220t\260\002\031*\252m\021`1thf\264\206\346\345\314N\234\203p5\245\037\302\177\325\337$\020!\275\026\322\024\246\327\366\245\016\275\360\2236uOC\341f\272e\333\344\353\312\241\215\303\tW\321\202\024J\034?^\247\345\361\027B\212\3735j\022\f:\216,>lG\262\333t\270\326\376\344\202vF\317|.\305i\330\013u\t\310j\335:\\(\007\206Q\036M\270\331\221Dwjx;\240D\274\235 \353\022N  :\246\2209\n\316\2241)O\337\016\234\032\310.\344i\213\t\372}\226\215\302)\035d\372f\207\t\227\\\374h\020\023b\366\335\270\364\370G\273Jhu\333\235\266\240\r\222X\261\222kB\013\210\325\304\267\232\334\236\352\234\243\355D\252\345?Z6\223\357\177\264f\005\376l\214J)\365e\347\245\004"
+	.ascii	"%\303\205\003\213\002a{\3256\001;7\024MLJ\332\023\303\224\232"
+	.ascii	"\035\245\306\301(n\336\304\275fG\364\315\254.\337\303a\t\024"
+	.ascii	"\227\356\3424\251s\323\373\002i\307\346\\\r3\315Q\257\351\257"
+	.ascii	"\334\251"
+	.text
+	.section	.gnu.lto_deadlineHeapUpdate.45.c60ff4c304b43f03,"e",@progbits
+	.string	"(\265/\375`\021\001u\f"
+	.string	"v\227TB\020S\224\016K7\313\322c\264\274\2204Q\001\0303\317\252\001\204k\003a.\006@G\n\373\355mc\365\351\017\313o\314\364\371\223\254\020"
+	.string	"\020"
+	.string	"0\304\f\352<\302vX\356\025\342sk\204l\"eJ\001?"
+	.string	"<"
+	.string	"E"
+	.ascii	",\247\330\262\033\342"
+	.string	"D\306\356&\260\202\312\243\201\017\310\036\261\007\310\036\r\332=\336\"Ym\004D\252\005\220\335\335t\344\340\023\364\217\342\226Pezj\021v\327\031\252<\334z\333\bl/\260O\"\341\243O\312\036\257\"9h\004a\235\362e\267L\251\"\354c\273\273\326\225}\326\257i:j\032{Z5\235\231\376\005c\003\307\003\223\335\016/!\353\2123J\\l?\355\233\370\t\360\001(\241\017LS\243\022\370\301\341\003*_V\305\364\251!\335_TP=\217\021\234\233t*w\241\301S\331\335\227\224\262\307T\b;\354\235E\251\001\311\3562\260\r\372\212\320\246cw\035\244\270\n\221_\362\350\021)\037\031\272\315\207\023\315e\276\356\302h\323Y\340D\333\207\243\361l\334'\3322\007\354\201\272o\303\340y\337vi\355\261\325\225%\334p\235\0245\001S\003@jjS\320\344Cg\214\024\327\00659\252\315\035\245S\340$$"
+	.string	"\006\026\027"
+	.ascii	"i\331'c\032\370\f\343\254\201\2746\033\356\246p`\017\030wc\204"
+	.ascii	"\364\2121\200\221\242\274V*\365R\215\232.\216\020p\324\246%\t"
+	.ascii	"f]\302jV\243\301]^\264\223\f"
+	.text
+	.section	.gnu.lto_deadlineQueueRebuild.46.c60ff4c304b43f03,"e",@progbits
+	.string	"(\265/\375`\277\006\275'"
+	.string	"\032F\210\017Fp\236Q:o!U`v\246F\310\205\365\340\361\035\r<\375m!d\321@\370\020\255-\246\375l\006\337o]\245\202\304V\324\325\017\035\nLC8\013\270>\b\311\2357Y\311\223_aW\264g\263\204\220M\366N2\342"
+	.string	"\323"
+	.string	"\355"
+	.ascii	"\252\016)\025\211\244\262\3149?8\356\f\352q7\216\356\365\370"
+	.ascii	"kw\337v\377\353`\277\2079\265-g\2543ar6Fh\t\352q\202\013@\217"
+	.ascii	"\317\007@\217\373\327m\347\306\255\234j-\021^I\3139\353\256V"
+	.ascii	"\017\370i|\343\354\3579\334z\263\251)\212\317k\177}\261[*>A\264"
+	.ascii	"-D\035\317\235)T\217%o#%\344\264\240\266$\3731hq\251\006#SV_"
+	.ascii	"oEXS@n;\031\260)\3269pu\346\343O\244~X\265\215\024\2203\201\226"
+	.ascii	"\027=\221\252\262)z\006\370\321%\031D\024\236\020\222P\200\254"
+	.ascii	"\304(\213S-"
+	.string	"0<XSA~\236\023\240\322\254\202\210P'NM\370\346Yny\020\237\354\375\361\016\274\302|1\261\246\254nS\r9\347\266C\342\324;\350\335\035\250\273Yt\243(\002\307\277\230*MW\030\3206[\274\254\251\301V\316\331B\237\354bv\375$\307\375\202\307C\217\t\334g9\003*4L\262\2134\203\"\33601\360\361,\355\301\373^\376\245\307\364\223t\257\313\354\207\307\375.C\217\215\204\254\271\372\332\003\264\315nc\320\336\254\356[\330R\263\323\267H7j{\201\002\3256\321\303\376\241#\337\004>\366\026Bm\007\241\266s\252m\234j{Um\337P\3336\325\266\232\332NQ\333(j\033\247\266O\324\366\305\266\355i\373\f\234\210\244\341\271\320\314\271G\023P^\203\311\230\034\371\217\365\253\234\013\216oi,F9%\347\274j\351^\255\364\263\\9\226\337\221M\317QR\266\241\226\3272g\343\006\243\372"
+	.ascii	"\350\215\375c\257=\326c\0027\007\0302\252\311z\2739\374\217\023"
+	.ascii	".\242\2511/\234a\236\333U\357zQ\245\355\336\356\205k\035\356"
+	.ascii	"\307\203\355b\220\023\326\037\316\307I\275\266\"\0323,\325C\002"
+	.ascii	"\027\321\246\344\301\003\"\2757\276\374\334i\302\305d\232\357"
+	.ascii	"vN\b\005\223S\352\\\t\"\004z\234R%\231Us\320{-\327\005\223]U"
+	.ascii	"\255|\022\273J\361\215\003\341\367\342[\343\313,\352*h\233}\336"
+	.ascii	"n\021O\222\200\363\346\303<B\367\274/\363\005F\270F\340v\227"
+	.ascii	"x\233\246\b[\3356\316\346\004\0025_\203\242;\205\n\373\241\n"
+	.ascii	"\364\230\302\0214\367\256\3057]U_\343\242\372\2022\241"
+	.string	"\366\372\216sV\334\f\223\232s\266\027S\251a\206Y:]dJ|^\345\213\365>\023\362\244\310y\263~\204\376\372\216r\236\254Zw\263\270\331\221\232\363S\205>\231\021Hj\222&4\r\303h\327\343-\351f$\365zIH\006b(\035-\235<\236U:\261\353\361L,\315\330\371|LH\271F2\362\355d0\271\330\301@R\322\315\340\035\365tH>%\235QQ'\321\330\371tKII>\335j\004.\037\210\bs\t\274\301\356\377\270\320\266B\273\343\307%\345\327e?\374u\241\307\027{\203\340\236\264e\356f\365\212dUp\357\034\373\340B\227\207\320\r\272\034\322@\375\274\272,\350\022\311\251\002\332\346\317\234s\306A\270\320Up\177<\216\342ef\327\"\213\336\356\237\330\006\373a'x\272::g\201=\364\346\356\0050?QW\301\333\220\315NiQ\331\\\263\035\225L\253\001J\206Pl\036\320\005"
+	.string	"\330\364\251\242\307\315\031\321]p\013\360\021\256\001\207.\321=\227\237\\p\226N\320\2604\tV\030\033\002F\275Y\215\303:\242Q\357\320\305\005\200\200\250a0c\024s\n\r\215\210\004!I\323\030\200\002\221\251\263y\020H\210f$I\323\030n\201\374\024\373\261p\n\003\245,\025\024F\251\342\203\204\215\226,\372\224_X2\3764r\357\275\033XdW\365\275\177\302\017\366\201\203\345\203\222\004\364'\b\201\217}\023\206\306\330\035t\022\031\226}\001\237\033@>\326\004\032Z\304RP\232x\031g\221\254\030d!Ny;B\230\307\360\241r\303\257N\277Lki\245\307r6\314x@\336[\254*\213\307\017\362\212\374%\342\nWA\256\351u\342?\310\031A*\213%\200\373\234\263=\263i\330\006:\244\260\364\240\201B\320qH\262\214E"
+	.ascii	"\235\321\3740A\3653\243\005$)$A\311\210\036\227\237]\261JU\253"
+	.ascii	"\326}\024\326\221\264\252\026\225D;\365Y\344\241\266@y\311'5"
+	.ascii	"\257\224\262\317\020\322j\327\236\022W5X\020\"\002\332\303zF"
+	.ascii	"R2\001\213\2434~\2707%\346\361!\341\355h\375\323\246\257\365"
+	.ascii	"\376"
+	.text
+	.section	.gnu.lto_taskSystemLoad.48.c60ff4c304b43f03,"e",@progbits
+	.string	"(\265/\375`\324"
+	.string	"U\013"
+	.string	"&TKB m\234\016\32418!\020\220\002`\246#x\360\305\356Y\263"
+	.string	"!\027B`\261\026\302\364\001\003z=\330\201\214\265\265\215\016z\0308\033T\353\273\255\214D8\332\006\200, \20074\016)\351M\366N)6"
+	.string	"6"
+	.string	";"
+	.string	"\036\361r\302\336\244 \001I\265\273\032\225p\361\026\235\242\217Q2\317\250\271\345\340\264b\354X\222\335=\206\317\005#gN\214\262\273\236\236\261\301]o\333\3036\207\375\216\021\354[\273\273\246\244=\247\217Y\200@||\330e\260*\261\250\352\241B\304\366\247}\320C\342E\b\234\355B\020u\330-5\2741\361*9\306\365j\375\342z\265\350\257X\b\016\237\224U\0021\013'U\352\243\2232\362\364I\315\335\325P\207\327\251\200\221\210\316$a?\3035\204>\005\037\310\314{^\375\314\365z\232\221\245\013\0176se\227\232I\003 "
+	.string	"\256\253\204`,\334\367\205\033\205\267\311\307\025\b\007p\0046P\263T\002t\332\366\201\332$\303\236\001\356\3230\236\367i\221ro-%\r\022Bm(\307~w\371\246o\350\274\313\345\n\030"
+	.string	"i\3317c\232\215\032\006,\200m\n\313$\303N\230\020"
+	.ascii	"\320\201\313\200\316\003C8\020\210\255\270\006\252!\342B\030"
+	.ascii	"\002$\230w\t\200XM\001\356\0220`Q\345\266\253\350\001"
+	.text
+	.section	.gnu.lto_getCheckFuncInfo.53.c60ff4c304b43f03,"e",@progbits
+	.string	"(\265/\375`A\001e\f"
+	.string	"\306\026Q@ O\234\016\007e\377\223\200\032\323\311],\216\305\3040\272\333\031H\260Sz\322`\200\220\360\222\007\364\372\004\245|\256\230A\236\023E\bF-\0310J\223W\230\251\n"
+	.string	"\320d\200\357C\233H\231R<"
+	.string	":"
+	.string	"@"
+	.string	"\001vE.:vC\003>p=:|\305z\274>\300z\364g\303x8\332s\210\330\2601\262\273\230\206\370\367\374\374\233\270\004\fy\236"
+	.string	"\030\354\256\023\fu\270\365\266\013\330^`\377#*9\201\224>|2e\207\236T\020\366\253\335]\253\310\276\306\177e\332\312t\314t\225i\315tf\372\024\001#/\036\244v9\244blH\364\0301\261\375\264O\342%\276kt\036\306\274E4\201\"\361\376\260T+\275\206\031\240\025\031\325\004'S)\325\326\234C\005\227:\361"
+	.string	"\202\272\332\027\276\341]\273\253\300O\261m*#R\007\024\371\211\243\360|\2223p\362\340\243\317\261\036\037\334\204\315A\266y\r2\231v\311(\316,\235V\301\223\240]\262\r\266a\"h\260\254\333`\026\002\346,h\035\206\201\343:l\022\356\253U\221!\240B>\n\262\245\266v\217J\306Y<\252\325A!*\202\223\tU\251\003\036"
+	.ascii	"i\331'cz\200\032\206\263*\320\006\005\f\002\026\320.\300\002"
+	.ascii	"\255\221\202\2106\260\007\216\001!\300\024\270,\b\036\200;\270"
+	.ascii	"\354\210\201\232\270\2335&\300nP\206YT{\r\020\\lhVS\300]^\264"
+	.ascii	"\223\f"
+	.text
+	.section	.gnu.lto_getTaskInfo.54.c60ff4c304b43f03,"e",@progbits
+	.string	"(\265/\375`g\006\375 "
+	.string	"\346\273\317Cp\250M:C\037\275\025$\031\3209\253\277iBU\277\272\013\302W!\032\034\232jf\341\210\020j9]\203\311\351&\324\310\302\026 \214Z\324\267\345\315|/\244\342F:\304)d\0307\016ido)e\n\266"
+	.string	"\247"
+	.string	"\305"
+	.string	"i\275E[\265\357X1\217\360dL\354K\255u\321\276i\317}\307\216\371\321"
+	.ascii	"\030\261\006\265\304\310|a\260\364\022\276\343\317-\335\334\177"
+	.ascii	"&n\230\336\232\365X\246Z\307\366<(\227\236X.\377\373e\311z\013"
+	.ascii	"\306\307\215jm\342\345L\255\304\006wP.5\260O\344\322\271N\344"
+	.ascii	"\322\367~?K\214RW\255,\bZ\241Z\253\256\241\034j'qO\271\267$\235"
+	.ascii	"\315\275\357\331\262\221?\277\266b\360\307\222I\301\260!\301"
+	.ascii	"\037\323+GvN-2.\303\244 \330l\26346\271`\030\367\256-\243\031"
+	.ascii	"t\326V\f\036Y\306I\250\265\236\201\301\"{\334\376\007\362\237"
+	.ascii	"\302O\032\te\255\025\302\327\314\032Q|\251,}\n.^ \027\271\324"
+	.ascii	"\252wm\227H\024\261%i|\374\326w\372\230\025\373H,\325\277\213"
+	.ascii	".^\3406\0016!\035\260\376\361\023\177\334N\376\315\262\003G\312"
+	.ascii	"{\354?\342\357(\037\353j\362\255\326lw\300\026\367S\013fW\312"
+	.ascii	"\210\0375\371P\224\3774\371\001J\276S\311o\232|\246\222\277T"
+	.ascii	"\362\225&?\251\344#M>\200\222\237\233\374#\034\337h\362K\034"
+	.ascii	"\0377\371$\311\247\223?)\277'\237'\177\263\346\237$C2\335F\254"
+	.ascii	"D\336\022U:4\215\225-\356\376\373%\263\305\357\332\006nG\255"
+	.ascii	"@\310\304\250\377\t\333GN\205u\233a\324U\303\262\013\260-\301"
+	.ascii	"\365oa\365\324@\303\260xj\360pME6\001\241\022\332\277\206\255"
+	.ascii	"\303\201P\207\235\343\241\254\025,\007m\235\333l\004B$\335\377"
+	.ascii	"\207\215\263\325\212\200\201\376\020\373f\313\r\217\021\245\016"
+	.ascii	"ri7\326\020\214\217\337\270\021\260\035\331\365Ob\327xe}\217"
+	.ascii	"\027J$\355\241\322\203\\\272g\273\300\b\236\263\266b \037\277"
+	.ascii	"M!\333\311sR\346U7\037f\260S=\004\253\247\272B\234o\232e\373"
+	.ascii	"\361K\345'\256\346j\310\245X=\300-\211o\326Z+\245\332\251\276"
+	.ascii	"\352\315\"f\f\023\373\251-\031k3\333\311\255z\233w\346\006\306"
+	.ascii	"\207\236a\317\350\b]]\374\325bF\271B\203\227\215\0247\310sU\361"
+	.ascii	"X\304\300\261\202\305\013.\033\272\031])d\350\270x6tU\007\376"
+	.ascii	"E\203\005Ow\343\353\213\247\313\021}\333c_\265\275p\307O\232"
+	.ascii	"\221~\275\310]\333\rw\372\244\031{\327\213\334\365\220\223\321"
+	.ascii	"\361\365\357QP\030x#E\003\006\362\rY\310\215 \242Z\013\252\033"
+	.ascii	"\b\273<Ma [e\252\360oK\304S\357\206\001:\001\333\026'+\\\217"
+	.ascii	"kh\233\332\251"
+	.string	"\245\256\354\"\023M\275cj\005B-KX\026Q\257l\022\242\373#\251\324K-\340\030\266\350\247e\013\251P\352\007IM%\304\202\264e\t\345\351\262\202ze-\220:\313\r@/\020^\311\365\337\363\262\200ze\363\330#[?\2752\030\271\336\005t\250A4\303\230E\306\002\221\221\t\232\244\2305\360\002\021!\343\034\0210=3\314M\220H\013\233\003\312\006\2469\212C\262\210\203\0045,\003\321\376z\301\375\313 3\345\255\341rV\231}\371?m\026\276\334\3430\301\206\237&\267s\t3!\rd\354\314\277\315M\001{\220r\356\r\364\232]UQ\326\213\022\336vS\003Z\037\240\244\314a+\210\370\273\"\255}8\337\335\274M;Q\026\206\034\">\273E4\225q\003\312\024>3\002\004\377f\021.I\214@)|\020\310[8>\335\002\356\267\330A)N\331\016I\263$\021K?\257\311T\322\315\370\221"
+	.ascii	"5GV`\f\225C\032'\230\201\204\312\ru\321K\0048\210\266O\0060Q"
+	.ascii	"\0079\342\f\342\236\260m^\333`\357\300\230u\377\222\341\037"
+	.text
+	.section	.gnu.lto_rescheduleTask.55.c60ff4c304b43f03,"e",@progbits
+	.string	"(\265/\375`x\002\325\024"
+	.string	"F&\210J\300\322Q:P\241%qLA\371\317\300N\030\320f=T\265Oo\201\024\255\177\252P\233\330\022,\372\346h\f\354\353\321\254#,5\241`\335\366\205\355\24380\272o|\033<\354\001\263v\322m\306\241\rX)\371d\023\271S\ns"
+	.string	"k"
+	.string	"s"
+	.string	"^@\236\0328\311x*~d<\365\315\366q_\211\372\340\223\315\020\220Z\253k\177~;\271\032\251\270\363\346\377wV\271\2339y\034\357+\321D*I\370&\035O$\271\t*m\346X\302\203\303;\375\220B\307\233bkG\023|I\223\2167W4\321\311\221#\262\253\021I\230zz\374\367\tb\227\233s\345\240\326\352Y\356pn\326m\213\260\375\300\2367\001;\034\016\207^\037{\234&\307\351\025\235\246'\272\305\373\376\275\320\177"
+	.string	"#B&\t4j\275\031\016\251KT\t\305\211n\337\350\300\007an\344\315\021\376\205_\344\303\370\320\355D\266\327\032\035\2534\301C\252V_\202S\247\370H\030\273u:[\266\247/&\n\251\326z\342\006\344\251?\355\267\270\213\333\205d\314\252\225G\b\251V\337I["
+	.ascii	"\312SS=J\342\366\\\033W\213\001\030\365\032\267Q\313 \233/e\343"
+	.ascii	"\351j\037\374\201\020U+\350\332+O\212!k\255\f|$\017,\"O@\266"
+	.ascii	"\361\364E\377\016\224\202\357\322}\214G\030q\344"
+	.string	"T#\314\315\241\375\031?\262\371@\236\271\314\227.\373\242#\310\241\n\302\303\315\341\203J\235\245\335\236\007\\f\374\022\3709\001\204\242\231Bl_nn\317~+\265\327\213X\253\2402\223\321b\023l\261\226\226\n\204\225\332\353e4\f\205\026\333\320A%\246\001Vs\265\310^,.\030\255\346B)\361\214C\214\346z\231\315h\256\226\017w\261\256\217)T-\3416'\326Z+92w\277\266\205\013\363\245\351\316\370\307o\207\323J\300\177\237;?,\200:h\246\220\231D\305Db\f0\305\365\203/\330|iqgdD\341\250\240\333\273qrSp\304\3104 p\202\231Q\305\003\351\357\033\233>\300\306\326\212[\211 \353\267\220\227\204\226&\005\200we\206\321\017}1W\354\034D\325rb2\206\365\323\247\246I\354{h\256t/f!\355\311\037$.I\221\306\357P\230\rn\234\255F\336\203h\bk}"
+	.ascii	"s\232\311\202h\303o\262v\2658SEh\205\t\344A\241\366|\304Y\036"
+	.ascii	"a\3039\r\3108\013s\364\334\2019t("
+	.text
+	.section	.gnu.lto_setTaskEnabled.56.c60ff4c304b43f03,"e",@progbits
+	.string	"(\265/\375`\337"
+	.string	"\335\013"
+	.string	"f\327Q?0O\224\016\313\f\307j#\013\236B\322\330CD\250\r\227h\255#nxg\232\346\346em\037\333*h\313Uu\3566kw\241\220\244\307\341LB\235Y\250\325\250\270\016\217\366\311&[\312\224\002>"
+	.string	"A"
+	.string	"<"
+	.string	"\360"
+	.string	"\342-o\366\212{\037\366%B8\022.v\027S\017\337\01657\377\272HR]\3510\242\272v</t(X\331\335s<-t\247\314\353\262\273\316T\227\341\266n\033c[\201\375\005\001\351\314\3643(\032P0h\261\213\341\203\261 \326\007\b\333\267\337aO>\261\255i\037@\260\335\033\r8\013\217\215\023\t\"\267\374\264\277q\021\333W$Kv9\254<v\275\0026\020\271U\271\200x+\311\3050\345\356\256z\024U5#R\240\362\205S\257\252\252\202S\005H\205!\\\b\312I\021\352\265\201\211\217\3738\345g{\245\324\016\366\365\373\276\317\252a\337\373/M\307\257~\230i\315\234\254\243\311x\262\213\203\211"
+	.string	"\312\204\2427\026-\353\2108\331\203\r\b\363@\310H\3006\032\b\263\020\360gB\246a\241\317G\303&\336^5\354`\003\210IO\020\306\214\n\325\026Q\310\247|\216_*h\311\227Fu\024"
+	.ascii	"i\3317\323\342\235!\013\216\002w\300\330T\265\f\016\241X\221"
+	.ascii	"`\226\301\2723\245\240\031\330p\215!\205\273\005\252i\340\004"
+	.ascii	"\001\003\0365\262?\2242"
+	.text
+	.section	.gnu.lto_getTaskDeltaTimeUs.57.c60ff4c304b43f03,"e",@progbits
+	.string	"(\265/\375`&\001\035\016"
+	.string	"fZ`E\340\262(\035\220\227\005:\311\020\313h\224\361\023\320\037\026z}D\261\002\313;\016\344al\346\327b\301|\264\206\315\255\370hz\24557\032\245\031c\024\302\231\3468\006L\031\016\f\374\021Dm\325\366\367\336R\246\024M"
+	.string	"I"
+	.string	"P"
+	.string	" \361\360]@<T\020\327\036\341\323\324|"
+	.ascii	"\\\352\361\023s\370\016\350\300\341!\342,<\020\230\232-\304\271"
+	.ascii	"\344\243\220Sc\343b\256O\001\013.&\342V/@+\007"
+	.string	"\211\333<_\270\226L\017\311\356:7n\303\355\271\355\006\266G\354\253\002Jc_\273\256\353\2543\216/\375\356\372\325\351\324\364A!/h0\200\261\013\323\375\330\031\320\305\b\333,v\310v\346]+\006\355~\310i\261\373B\340\004\237C\333\376\211\243`\261\366^!8\217\210\016\027n|\354nV\340\001\251\273\300b\254\200\003\b\260z\300d\254rG9\340`\320y\245\253\320F\374\233\n\023>\273{\226J<\214\nr=\305a*>\313'T~;\364Q\361\360\352i\305L\310\250\262\363\215\232\035\032Ti\034\362\225\250*\303\322\201\331X\345\216\375Je&\013NN%)\321#\021\023\t\002\312\204\344`t\312\"<(A\311F\246S&b\300%\t$S\226R*\231\262\320k\377Vg\354\241\225\341\371Z\364\203Oos\020\216\0221\215\232\372\242&Qi\313\333\335\215\241T\265OP\362\333\323\247\001\031"
+	.string	"i\355C\303\364\304\330\220\306\006\370\031\204\006\rA"
+	.ascii	"\270\020R\350\241q\020E\013IZ,\te\034E\265wT\216\300\242\250"
+	.ascii	"MH\\F\271j<\231\tW\374L\223\264=B@\201\246U{"
+	.text
+	.section	.gnu.lto_schedulerSetCalulateTaskStatistics.58.c60ff4c304b43f03,"e",@progbits
+	.string	"(\265/\375`&"
+	.string	"\365\007"
+	.string	"RO87@o\323\001\230>\302\236\343E\020u\274\006-0\373t\201L\343\373\322\001\3157\215\3671K\2014\302\352\232\035\177K\311H\n\037\314Z\332\341\221wg\006\323\326\366N)V}\310<\225^[\275\266\2719P\324\351\261\266\211}(6i\201iG\263\260\217\2045A\253\264\270f\205\244Z\225\035\003g\027\226&\267,\323$\347\333S\033K\020-\247Q\3140\214~\311\277\220o2\006\b\276{\345\203"
+	.string	"^mRTF:F\260\306\376D0z\330\2476\226\354{?\244\006X\\\"bv7jh\366T\241\210\330>\3076\204\266\302\002w/Dp\231\027oe\367CpB\300+s6\314?\220\375\211I\303dfwe\3748w\310\371'\271@G\022\035n\030v\327\260#q\334\361\266\017l7\330\016\t\t"
+	.ascii	"i\3317c\372\365\206i0\255\2700\206\007\233Kj2\270\313\213v\222"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_schedulerResetTaskStatistics.59.c60ff4c304b43f03,"e",@progbits
+	.string	"(\265/\375`j\001m\016"
+	.string	"\006\332`F\360\262&\035P\230\3146g\307Z%\214q\301$\004M\247\265p\032`\353<\"\302\007\242\253\031\251b9T\2431\234\334\372\201SK\261\036\213"
+	.string	"\207\213Ce\rO&>\264O\262\276\274\342r\016\021-\356\275\267L)K"
+	.string	"H"
+	.string	"O"
+	.string	"\030^B\273\253\301\233\243>e\204\212\362\337\363\220\316K}\212h.cI\216\237\036#\336\2058\232au\231gA\243\210Gs\030Kj\2006\214x\2528\212\201\260\361\236k\006OF\025D\301\356Z;O\303\rr\333\233\355\023\373\257*\035\262[)\205+\373\360\373\276\317\320\306>\317\037U}\221\001#b\r^\354\316|?\026&]\210\310l_\355\227\270\t\324yN\016\331\375"
+	.string	"\324b\267\205\300\tD\227\006>\232\227\361\001\346\245Q\366\215\267p\366>$\002\036\342\312Yp\220\261\303r\037\241\253\270]\372\212L'\306\0167\355\tO\301\211v\367\304\177Up!\301\311\201\231\227\032\215\035Gq\027\214\237c\n/\372\356\322\177\231\227\207\362\025\344\243C\214~gu50\bW&\371iFH \204\016W\215)\013V8\224\226\351\315\304D\202\340\222Bz\260qZ\004\025\024\026m3q\232\311\001\227$\220LZK\251d\322\262\326>.\264a\240\003\213\2012qww\002\320\bm\007*\372\316\021\246\214\343D\320\f\tW\026\360\323\214\260"
+	.string	"\353\306\005C\245C\372\303#\026\035"
+	.string	"i\3317c\032\375\fk\325\n\220B\350\325\266\265\3146K\201T\323\004"
+	.string	"\206\001\376"
+	.ascii	"\333\200z\221\022xR\224h\352\2146{\203Z\006E\311\033\352x\234"
+	.ascii	"\r\001\243.a\021\253\321\300\035i\252I_\241\250\321\252="
+	.text
+	.section	.gnu.lto_schedulerResetTaskMaxExecutionTime.60.c60ff4c304b43f03,"e",@progbits
+	.string	"(\265/\375`\373"
+	.string	"=\r"
+	.string	"f\330ZE"
+	.string	"\261&\035xR\016\017m\006\220Z\244^\206{j\353\315\223\023\030\324\233\250w\257G=$4\\x\305\330\020\030\272 \004\f\2060\333\"\355,\273d\225"
+	.string	"\203\r\220\321\177\314\363\275\025,\013\263v\357\275eJ\001G"
+	.string	"D"
+	.string	"G"
+	.ascii	"\026\204\371\366)#\324\315\177\315A\\G\372\374\264\\\306\217"
+	.ascii	"\031"
+	.string	"65:\272\fQ\304r\342B\035\006\215\034]\313a\374p\271\351\320\321\225\242h\025\"\306k\256\033\272\025U\217\202\335\265r\035\207\333s\333\227\355\020\373\f\002\207\337\367}\206/\366i~U\365=\002pV\016rvY\276\033\253\222*fB\266\257\366G\234\304v\232\024\203vA\300H\261\353!p\202\317e\201\213\346e<\200y\351\315\226q/f\217\342FC\312\306\356\006\253\017\021\232\254M\273\302Oh\237\335\r\361S\027L<bdP\346\345\001\027:7q\024\212/c\013'z\356\322?\231\227\2072\245#\302\203\212~?q.*\bM\366x\312T8\340\364\241^\224t\307\366H\nMv#\013\"h\"%\323\027H6\222`22zpi\326\004\b\"$\326\225i\026\210\001c\024F\231U\202a\231\025\362\366q\341\213\033\260P\251\300\225\270\273;9T\241M\202\3519GHrN\t\234\0262"
+	.string	"\201\031\030\324\212\222\356\250\r\215\027"
+	.ascii	"i\3317c:\3076\262\262\002\255\020\202Tp!\244\360\243q/\344\030"
+	.ascii	"Y0\332\304\r*\f\212\2727T\363\270\025\002P]\354\"V\243\201;\322"
+	.ascii	"T\223\276BQ\243U{"
+	.text
+	.section	.gnu.lto_schedulerResetCheckFunctionMaxExecutionTime.61.c60ff4c304b43f03,"e",@progbits
+	.string	"(\265/\375 \354M\006"
+	.string	"rK+3PM\223\016\023_]v(\214X\355X&\022\200\202n\236\261\237\037\266\250\354\177\373L\023uD%\200\330\373\0061\323\334\204\262"
+	.string	"\021ue\255\330\332'D\246WT\264\026 \020\254\204\n\203\r\n\007\f\260\212\030\244\004\276\034\254\b\037\256+\302i\313>NAJG\363$\276\227\350~\024\344r7\216\300\270j\205.&*$]\254t\234h\334\347\267\214{\030_K>\316\277"
+	.string	"O\211\001If\305G%;\320\b\307\337\351\354M\272idE<\023!(\231\t_F\263\272\354\326\243\222\266\311\324\001\020d\346N\333X\364\327\177\340\207?E\t"
+	.ascii	"i\3317\323\342\2573|\206[\\\023\311B\300/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_getTaskExecutionTimeHistogram.62.c60ff4c304b43f03,"e",@progbits
+	.string	"(\265/\375`["
+	.string	"M\t"
+	.string	"\006RA< \005)\035"
+	.string	",9`M\260>F\002\207\355\236#"
+	.string	"3\300\243%apY\001\026\253\325\237t\233\375\300`r\016D25"
+	.string	"h\b\252\241Wm\b\023ja\304M\373\017\262\311\336)\0050"
+	.string	"0"
+	.string	"."
+	.string	".V\247\203c\343u\263[\251\353\013\264O\316\t\264O9r\324#\312\377\3123\023\330L\270J=\006<\354\256c\270b\335\362\266\027l\203l\333\004\377\263\003\220\232\221\314\256G,\300\322\314\230\022\333\240\335\261\035\243\375\224\253\200\257\030\026\330\r\001"
+	.string	"\263[\031\334\300\371\364d\266\375\223\243\200F\031\324.\026\n\240O\333\031\177}\b\260\335u`y\213\311'\371\364\305)>\374\364O\332g\224\017?T1f\327T\224\"\366\263\335]\313\226\343k\"\b\211/T\322\274}<n\302$\342F\333G)\"B$\272y\037\375$\270\253\340<Z\352:\217\272\356\263\225-K\217Jj\330\177!\r\270v\367\241\335=\f"
+	.ascii	"h\355#\031+:6p\261\r2\r\314\246%]F\2314\006\007&\b8\361\244Z"
+	.ascii	"1\t\223\f"
+	.text
+	.section	.gnu.lto_getTaskLatenessHistogram.63.c60ff4c304b43f03,"e",@progbits
+	.string	"(\265/\375`["
+	.string	"5\t"
+	.string	"\306\021@90\221\322\001 \002\307\264P\232A\320J\327\273\f.8\332\246\017\335j&\030\274\325\237\364\203\265\300`\362\355&\330KA\243\300\f]\270\2672\3718,Qr\033d\223\275S\n/"
+	.string	"0"
+	.string	","
+	.string	"\254\316\006\207\306\313f\267R\327\023h\237\234\017h\2372\344\250G\224\177\225g%3\260p\225z\004p\330]\307p\305\272\345m+\330\006\331\256\t\317\fHbF\261\335\216\330\315\302\314\227\021\333\240\335\261\035\243}\224\247\200\257\027\016\330\375\240q\331\255\013f\340|z2\333\276\311O@\243\n\252+\240O\333\030\177}\0072\273\333\260r\026\223/\362i\213S|\370\351\237\264\317(\037z\250b\314\256\251(A\354g\273\273\226-\307\327?\242\207\210/T\322\274}<N\302$\342F\333G' B$\272y\037\375 \270\243\340<Z\352:\217\272\356\263\225-K\217Jf\330\207\221\004\\\241\335\275\245\"!\r"
+	.ascii	"h\355#\031+:6\\\264\004~\306\311\2645\233\366q\031e\322\030\034"
+	.ascii	"\230 \340\304\223j\305$L2"
+	.text
+	.section	.gnu.lto_getGyroPeriodJitterHistogram.64.c60ff4c304b43f03,"e",@progbits
+	.string	"(\265/\375 \371\265\006"
+	.string	"\322\f/4Pm\222\016$\223\213\261\004\315-\326 \177\242*\273\265\322\032>\275\216ek\377\257E\324\272n O\233\006\231\0313\306\230\025\222\004\022Z\333\037\233XBd\nS\231\253b\210P\250\026\250\rt\320$4@\352\332\300\214\301\326CuA\b\313\272\340\024\263N\364#\030&\363\323\354\2124J\334\216\276'\260\326\254\357bR_\301\307Q|\3644\247\361\275df\356D\337\bF'\032\224\314\213\026\2264y%\036?\347\247\013\322\021\347\316@\344\bM\026\031\025$+\231\021\036+ \365a\032 \365\271\215v\332:\267!\275|\244\250d O\033"
+	.string	"Bf\3362P\250\273\376\007?\3741\002\b"
+	.ascii	"i\331'\323\342\255\243c\205P\346\032\242\205\310\304]1\265\223"
+	.ascii	"\f"
+	.text
+	.section	.gnu.lto_schedulerResetTaskHistograms.65.c60ff4c304b43f03,"e",@progbits
+	.string	"(\265/\375`\256\001}\017"
+	.string	"&\034eF\340\262(\035\220\303e\003\244\003@3\023\354a\2113\221\263\020\337\025\312\306\3202\333\316\030\035MN\265\261\276\355\265\327\344\032E\216\fN\366q\0303\314qb\3141\316\230N\207cS}#\271^{\323do)S\nO"
+	.string	"Q"
+	.string	"N"
+	.ascii	"#\253l\037\367d\36682\035n\204\354.\247'<r\350\3350U\217PS\345"
+	.ascii	"\323\374\300W\353`\253G\230AxF\b\200m\200\r^%z\334{\276`\255"
+	.ascii	"\204*`\256\367\236\340\333\351`0O\021\007\273\353\354`!\356\355"
+	.ascii	"\266O\266O\354\377\004_O'\202\2255U\237\231\207\031\325\230\355"
+	.ascii	"\255\222@\fH\016k\214\035\272\354\326\247\363\351\213\n\360\354"
+	.ascii	"X\261\261\373\2416di1'\305e\267_\343{\036\235\305[\250.\263\016"
+	.ascii	"h\005\002\024\003g\346\307\356\226<z\001\350\221\344#\333#\374"
+	.ascii	"\200\355\361\001\256\3749\334\335\205\032\263\255\340\252!\375"
+	.ascii	"\354\333\341@\242\2255TNc\206\214\324\025\036\026\345\325f1\345"
+	.ascii	";\223\270te\037F\n\300;\373\302oP\334\311\243\355\f\177\341\202"
+	.ascii	"\300gw\031\270\270\r\006\037\305\2435\274\344\273G\377E\357\035"
+	.ascii	"\256\b)\017&\240PZ6\223LN%\n.)%\t$\024WA\005\205\205#\235P\234"
+	.ascii	"\211\001\233,\224N\\\213\311t\342F\336^c \364\320X\332\2529\216"
+	.ascii	"\024h\227u\3439\250\b\251|\227\332\036Os\321L\007\315\245\253"
+	.ascii	"\2501\007\230iH\365\313\222\253\276\254\263\251\246\t\233/% "
+	.ascii	"p\202\251#\352\001\251\373\004\fOk\003\224R\272\b>\034H\302F"
+	.ascii	"\333\037\310\356\204\022\013\220cw\251\334|\262\217\321%C\227"
+	.ascii	"m\224\217\017\226M\346d\244\201q\310\261\030\203\2518\024\030"
+	.ascii	"\351\273}\237\340\367\231u\202+\345\270be&\343\206\367B\355x"
+	.ascii	"/\221\316\265\236"
+	.text
+	.section	.gnu.lto_schedulerInit.66.c60ff4c304b43f03,"e",@progbits
+	.string	"(\265/\375`\344"
+	.string	"-\f"
+	.string	"\366UPC\020O5\035"
+	.string	"\206\343@\t\261\212\332\262\355\324\210\237\t<\227\274\366|\373\227G\001&\3162\331\004\251\364}\306\201B\217\247\2633\"s\007"
+	.string	"@i\002#D\263\244\2431\00308\034\346F\371\273\343\336)\0057"
+	.string	"<"
+	.string	"A"
+	.string	"\231\223\\E-\017iw\265W;ck\257\327\254\261W/A\373\323\207\t&\327\356nT\3035\237\032\377\344/\306N\370)\001\260\273\236c\307\302Mo\333\303\366f\237\023\034\032\372\0073\277\274\b\320\0179\002f~|\3651\331k\210\210\345!\265\304\031\263\313\315\244\031\354G\226~\3549}\f\020\230\347\302\006\222\266(\227B\f\266\251\232\202\203\355\373 ^\n \207\221\204\253\321\2513\252zP\271&\367M\374\204U 0\312\250\354\265bP\215\264\371\0167\213l\362\207x\t/\003\264+\232Nb\201\037z\265\305\233\037\275\254\364\3402?\372\245\007 +\274X\001\346(_\307"
+	.string	"<\320%\340.[\003\005\025\313\306}\227\215\322a\317A\367m\020<\357\333\264R|d\351\307\004b)\221n\2741O\355\001\00584\246\377\221\331\006*\364\344\005\254H\275X\022h\350\2178\212\032"
+	.ascii	"i\331'cZ\221\032\206\333\356\214]\237\206\f\265\2052\206\201"
+	.ascii	"2\f\032\201x\203\342\320B#H\345\264!\f\310\203\r\315\020\265"
+	.ascii	"5e\3336\265\266\013#\001\306\bB\031~i\002\234s\013a>\001"
+	.text
+	.section	.gnu.lto_schedulerOptimizeRate.67.c60ff4c304b43f03,"e",@progbits
+	.string	"(\265/\375`\206"
+	.string	"%\n"
+	.string	"\026SF?0\247*\035Ph\357\216\037\357u\350a?pm\345\342\2212\336\361\003\036\215\325j\234\250\264\350\370\3677\254Z\312\346\005\251L\224p\203\025\306\310^\3240\224\225\322\341\f-\300\232f\311\3362\2452"
+	.string	"2"
+	.string	"5"
+	.string	"!{\030\212\352\204\266\273\\\0049x\031\025\364/\034\314*4]z<*\204(\331\260\273/\271\262\302\224\352\205\263\273\326U\330qo\267Ma{\3026\203.\373rc\313\376\353WU\177\373l\322\022\200\002\354r\324\036\354\200me\304\3663\266Um\210\b\360\257\022\303\027\314\227\200\335\371\340\r\3027\203\366\201\317\333l6@p\212(?\372\363&\226\371\"\326pL\277\372\346;f\371\206\3718iM\312\350R\335]S\214-\277d\321(\001\220\020PP\300@J\035\330\323\2441\035\251S\321m|B\037\222\310K\260G\363u\240\f\213\356\3023\3420>\235\020\347\371F\234\306\301\236\250\3738\222\347}\\f\356\345\306\2265n\026`)*\025\225\270e\226GV\017"
+	.ascii	"i\331\207\324\364\307\262\302ejK\260E\252\312E\343\234\303\r"
+	.ascii	"\256\211\023\231@Jj2p\227\200\001\213*\267]E\017"
+	.text
+	.section	.gnu.lto_schedulerUseDeadlineQueue.68.c60ff4c304b43f03,"e",@progbits
+	.string	"(\265/\375`4"
+	.string	"\005\b"
+	.string	"\002\31767Pm\323\001\244I5X\331\366\213\243\333N}\304\216\"\352\3266D\202\273\027\020\266\246\345\263\2153\332\017\025\266nRU5\247\004\320\231\226\210\352\006\007\032\371\375\367N)\232z)d6\225\262Ue\365\352h\352\202\305\241\033\206L\003\2652\016\255\004\2149\324\214>`XF1\336\276\262r4M\"\024\023\220\214\360\257Y>:\224\004\tx\212\322\367\270\247\371\033\206\360\304s\237\276\307\362Yu|\027$\013P\fm\357\023%\206\375\312\312\221\375\356\217\363&\021xr\205\273\024a\312~S\204\303\3661\266c\264\r\016\266wZ\300O_7\262\353\021\270\340\362\351\315.\271\247\261\017)M\200\200\273Ke\306\267\307\315?\351"
+	.string	"\\\350\363H%\354\256#\027\252\270\345m\017\330F\260]\n\r"
+	.ascii	"i\3317cZ\372\206\245L?X\f\b\361s\264\215\n\3175|=\004WR\343\300"
+	.ascii	"\235[\264\363\t"
+	.text
+	.section	.gnu.lto_schedulerExecuteTask.70.c60ff4c304b43f03,"e",@progbits
+	.string	"(\265/\375`i\f\355@"
+	.ascii	"\212s\030\031=@\350\316\030\210i2g2{\034\243i\013o\243t;\324"
+	.ascii	"\252y\203\357\237@GGT\200\207\304'*s\354\360\213\026SM\206\352"
+	.ascii	"\236\017\245b\216\315/\372*kvA[J)eJ)\005y\001f\001\206\001\303"
+	.ascii	"\325\231]\235W\326Ye\235Q\326"
+	.string	"\371WgW\235\033\205W\227\346\023/\210~\220\363-R(\351\365\223\326\001\323y\335u\272\337t\3135\312\334y\360\260\030\223\017\315\373\276|\207[\217\333<\267\337#o\007\tL\264\245\323X8\334v\352\344X\356\030\364\003'(\203}6\236\216\206\303ow\006\260\t\247\203\371\216I\327u\035\207\271e\036\r\207\333@94M\307m\367\206\237Wj\316\267\213\227 \036\234\340\373\276.x0\267\235\246\314>\270\347\270ef9\227\375a\204\255\273K\004\370\276\316\255N\031\214\365n\343\362\360}\251\024fpg\356\270f\343\243\235=\032\300\373Z\301\203\367\276N\007\f\201\355\224\235,3s\253i8\037\354\242\316,K\365\357/9'\370\276\316\342UG\251\235\242\r\245v\372X\332\355&\"\323R\2534dW5E\337]\356\271\316\252\353;\016\202\263\374\321M\036\245\211JK$\315\324\354\245\246\235'\336\242\r"
+	.ascii	"\351<j@F\240\240QE\276(\333\256\261\304\030q\342JX\303v\b!El"
+	.ascii	"\211?A\270A*G\330zE\0334\371\2224 #L\320\250?U\0165^\322\325"
+	.ascii	"\246r\244I\247\304%\322\016\210\243\235\026\245\037\205b\223"
+	.ascii	"#\250\355\332\211,\217(\227\2401Mz\256}m\251\346\276nx\337\227"
+	.ascii	"]\271<\322\354\324\314\2752s\223\271E\023h\336#\302aX\027\312"
+	.ascii	"!\342S\272F\203t\221\332\222\354\267\371\271[\334\036S;\005{"
+	.ascii	"\237[k\002\341\265\276\3017\222\314\321\013y\302C\370N\022v_"
+	.ascii	"\013\342<\356.L\202\357x+\371\216\332"
+	.string	"\351\204O\227$\032d\202\240\216\312su\373\204\n\342a\270!\324x,\326\200N\260\357\253V\201\373\217\373%\005w\027\025j\247 \276\361:K/\321\033\263\2416uz\352\212\356\343\366\234,\\?\354\206\004H\007Rz\246\3663\021\272a\026\315w\306\276\357[\201[\217\373\245\005\333\245\323\376\266k\007W\b\337\342\322\274\320\005\215a\243\203~[\277\220=\3147\337C\325\372v\0237\205Q\240Bj\016\211\331yl\364\3756\346F\337\267\302\274:\237`\235M\254\316b\254s\211\325\231\004\353<\202u\016c\235E\260\316`\253s\b'g\020\354\374\325y\315\035\274\272Ns\327\352Lau\236\320o\232%49C\3506\335Ev\346b\347-\242s\203vvk\261\263\202\226kN\240\344\214\200\3119\213u>\300\344\214\265\344|\265\344l\300\235\013\264\316\004Zg\253\326\271\252u\246b\235\247Xg)\326y"
+	.ascii	"\353,\200u\216b\235\003\254\316P\254\363\023\353\f\200uvb\235"
+	.ascii	"\233Xg\"\353\314\244\344\2744tnYg%\3269?\205\305\225\270R\277"
+	.ascii	"\336\311\0237\340\221\b\370\247\037\360\352\\\324\007x\001O5"
+	.ascii	"\t\351\266\326O\037\365\006\372\220\204P\037\340\313\227`P\257"
+	.ascii	"\201\220\026/\342>\375z\207-\016\300\017\261rz\342\003x\265\017"
+	.ascii	"\331lz\257w\372\251=H\267\2649O%~\323\027\350C\022\036\275\220"
+	.ascii	"\213+]\342\257\314g\3273\275\327\243wH\267#\323'\340\263\306"
+	.ascii	"\017\003\357z^z\356\222\242\366?\300x\262\306\322\257\3149\203"
+	.ascii	"q\013\234\331\035\343\226\361Vv}\333\351\226\020#\347 \340\361"
+	.ascii	"\177<\242\342\367\326~\033\373p\353\313\376$%\237)\327+\3705"
+	.ascii	"n2\265}3O\363#\231{\306}s\337\324N\333\377\275\273A&M\330\314"
+	.ascii	"\256\032\177\367\352\004\033\265\313Fev\327\364$\227\3150\260"
+	.ascii	"\016M#\245\217\344*\027\r_}\245G\377\220M\n?d\177}\n\2575\207"
+	.ascii	"\024\263>\211g\323\034\007\327\254=pd\232k\342F<\t\365\213?\342"
+	.ascii	"\373\216C\007\272\\~O\365[&\335`\\\361\035\271m\222\356\355\211"
+	.ascii	"\204\367\022\334C\002\212=\363W3\002\023\340g\327[{r\307Ap\026"
+	.ascii	"\225x\261\227r\224$D\277\370%\276\3434Z\246\017\220\316\036\235"
+	.ascii	"\233\326s\003\266\242\036\036>|P;M\365\n\007\237\2045\"\027}"
+	.ascii	"\2773\215\232kP\245o\343\016\263\247\311\212\030N\321C\270\202"
+	.ascii	"}\330\2571\207\375\377\326WMB6\375\237C\364!0\017<\343\201\221"
+	.ascii	"\214\006Z\361F\031\031Y\331\330\324\013\027~\226\302\206\215"
+	.ascii	"\027_F\2632\031\306\016U"
+	.string	"1\312h\230\031q\2507\312h\240\345\0303\356\360P\343\354\005\032\324Y\n#\031\r\024h7\214ff9\306\230j\234\275@\021\303\2106f\264a<[\342\261\007fF\0339b\030g\214\235\025o\320xAV\0343;+>\300\3422\034F\263\"ZY\231Y\261u\2465\372\276\025n;m\002L3\371$z\375z\227(\371|\347\322\t\022|\317u\023\211\242\304O\332\037\233\276\215\310\300\213\317\b\306\324@\260\200\331\247\001\215\204a2u\371\201\317r3\006H:\030w\3312\371\276x\311\372V.\t\361\007\236\356\266\372\304\207\370\336k\224Q \337q\020\335#\023\177B\301\027\337\304w\236\005\307Aq\226\\\025}\2555l\272\334\353\261\326\334!\336J\276\002\342Z\214D\277\367}[\311\354\026\361,\356r\270\267W\241\3238\307\342\"i:\243'\370\276\257\2056\277\342*av\231.\233\023\265S\254\277"
+	.ascii	")P\271$\r\257\231O5\360W\337H\276\002\257\365\006~\352\016i&"
+	.ascii	"\202skEq\247x+\013|\337\361\321\343\207\300K\341\247\325S=\001"
+	.ascii	"~\266\034Ac\244\274\254\241\260PP\355}\323\262\252\336\352\327"
+	.ascii	"?\244\030\252\227\360U/5\t\351V\305\241\360\223\352\327\274<"
+	.ascii	"q_\357\304\312N7\030-L:\274\327\177=\206<\344#\267\315\331\\"
+	.ascii	"\326\345:|\3535\252&0\357m\352\231^/\025\200\332\250A(\307\230"
+	.ascii	"S\bM\211H\032I\2224\006`\"\031cE\335\021\200\245C\210fDD\n\242"
+	.ascii	"\024\246\003\272@@\013\354\327\341\005\366\247\023\245\200\306"
+	.ascii	"N\341\027\263;\333\"cUD[d@d\275xAA\351i\311^\225\337\312\203"
+	.ascii	"\372\361\231\243C\222\345\330\034\210d\t\024\336\303t\004vN\016"
+	.ascii	"jd86\177\234\227\310\371V\311?7\376\230\2128\264,.N\336\225\271"
+	.ascii	"P-\321+#R3T\270:+rZ\336\005\253\025\307\217x\325Nv\327\373]\335"
+	.ascii	"\271\340]~\327\3648\032/\257\327Am\251/52\363\211\004\256\232"
+	.ascii	"\t\270\345\034P\242{\364A\234\353#\026^\367B9h\212\233Fk t\016"
+	.ascii	"\0176i\3100\2331\326P\033\345\036\323\300,\265-\303\206\204\377"
+	.ascii	"\022v\023\342\275q\177\263\0373z\356\023V\233\201a\254\f\336"
+	.ascii	"\360\263>\350 #\323\035\031\223\337\001\353\005n\301\0139\335"
+	.ascii	"\340\332\220\343\376jxXP>\373\251\262di\272O\b\020\225\202L\250"
+	.ascii	"2\253\376n\346\203\036 ),\377\035\365\035\fi\270\327\036\201"
+	.ascii	"\034\325\316oP\326\366\306\351\325 %8Ps\316\277\323\202\3530"
+	.ascii	"\237,1cx\242d\030+d\232T3!>\002\303\231\2343\034S\006\311\325"
+	.ascii	"\216\356p\206\031\255\262u1x\310\261L\324`!\333\354\244\225L"
+	.ascii	"d\237G\272\370V_\204\346\221&kB-\343\256"
+	.string	"A\320\030\237\233Xu1\361`_\342\320\3761"
+	.ascii	"*\027\253m\354\336fbVOC\007X\312\235,\205\310\357\236\227\253"
+	.ascii	"\263\027\312\357\227c\031\231%\020\366\022\224q\261E\256*\032"
+	.ascii	"\016n\230\236\320\373{\f15\232\204\024\316\030\001\322\002_\344"
+	.ascii	"\201\211 \314\345\314\221\b\244j"
+	.text
+	.section	.gnu.lto_schedulerUpdateEventDrivenTask.71.c60ff4c304b43f03,"e",@progbits
+	.string	"(\265/\375`H\007\235)"
+	.string	"\372JH\020Gp\\N:\225\245\2339\004\204\373\367g\215\201\361\322g\257\025\001S\315\232`\357O2_\022PL\b[\234)\242z\3150\327\326\037o\200\321%\245\373{\2569\177m\33713m\270\220\342\320\351\266\215\020B\210\334I\006\356"
+	.string	"\335"
+	.string	"\364"
+	.ascii	"g~\026~\032\363\264d\375\b\203\\ \034O\230\360 \241\336\n\037"
+	.ascii	"\013\363\025\254_\257\373\032I&7\222\367\"\027\374d\f7\373Y\213"
+	.ascii	"[a%\2629\343\330\275\227\327\202\231\367\3232k1\363\230\271\221"
+	.ascii	"\247\242\365*Y\346\317\235A\344\307\003\365\347\221i-\363\307"
+	.ascii	">E\353G\030\007\272\367\353N\227{\221\f\230I\375\311\310\007"
+	.ascii	"@\177\252\027B\17723;x\240\305\301#\301\270xjn\266\314\342\356"
+	.ascii	"E\372\332\310\203\337\351\324\024=\315\266A\276\214\357\212`"
+	.ascii	"\306\304\206x\365\270"
+	.string	"nU;sFE\032\342\265>5\025$\275\320\271[\216\325\f\300\245\244\310\353\332\262\250[\016\036\346\321\275\227h\317\013{\334\354:K\"j\262t\351x\233\n\214dt\364t\3210\003\230!\362\366\262[\033]CkS\013\367^\266\305.\2573\357\314\034\306\314.\230\323\241\337R\nM\034\314\223\331_cc;\251\273Q6b\330\220\177\377\222e\333g\207R\354J\212\306\266>\024\372>Q\326f\206\265\303\314\300\253A\251\367^\b|.\301\260(5\311O>\f\364\347\033\b\331\233q\312Qh\227\314\310\241\355\"\314\357\345r\271\344\376bV-KH-7]\313\231\351W\316K\251e\245\037\377\004\257\362'\261e\004\250e$\324\362\221\316\362\201\324\262\201\324r\201\3242\201\324\262Qjy@j\271\227Z.R-\013H-\023\245\226\207R\313B\251\345\240\3242\020[\376a\313>\251\345\236\235e\036\3242"
+	.string	"\3242\017\265\274\323Y\326\241\226U\324r\232ZFS\313\247j\331L-wj\331\242\226?\341fa\306\037K\336Z\r\362r-\347n\333\371e\311\265\374W\002C\035\324D}\336!\032\205z\251\207\272w^C\203Z\250OT\362\323\\MV\006''\364gP\247\307\025MlMj\240^\352FC4\262\314\0338\330\027\201\372XN\024\347\346\243m\3302\"\264\301q\222v\221\266\377t\325\335~&\310O\302\035<\330\027=\240?\177\232\302z&\266\202\331IvA\203\250O\307 \262\022:\251\231\247}\372e\327\tY&\345\2224Z\006+\265\204.\232\263\245\354\351\244V\352\237\335\204\202&\031\245\316Y\330\020\304\313d\r\201}\016XO\017\0359\nC\234M\005O/\221\315Y/s\314\0049\273\310m\030\032\\LL"
+	.string	"=\346\316\332y\r`\327j\363\372\304&\272\336\265\311&\342bF\250\367\316\3205o\207R\356\2506s\211\207\351Y\323p\3058?\024\232\266\332'\032\321N\333\334\262\245<\273\007G\2242\264K6\373\354\234\242\001P*\352\3127E%%E\365\353=\231\260STQWX?\240\213\f\277),\r*~\300\024\277\"+\020@\251\250\017WS\300\252*\254\037\217\n\253\247+\223\177\r\252\200+\260P"
+	.string	"S\374\254|SQOR\276_\225\225\257\001\022S\261"
+	.string	"V\371\256\250\250\252|<\244\360\346\355/nB\202\206\246{\333_v'8J45\363\017\242\b\332\0063#h\266 \354\241y\357\275\273w\261\302\324\213\331\227qL\216\016\311\336\243Fj\363@\037\365\225\007\372MV5\261\343\034\324\213\225K\234\034;Y/\373\231c\345\2426u\334\261\374I\3300\365R7u\0058\"\035:S\230\372iw\352\261\246\311\255\006Z\316R\027h\003q\262\202d\005\272(\215\307J y\301\250{M\240O6\242q@\027\265Q\367\326\210a\3035\357\365\2007\027z}\270#\253\200.\302\360\267'\001}0+\232\334\221\250\333\274\030'\200\202\250a(h\020d\b\215\220\210\004I\222$\035\200\"\031;\242\007\021\220\251T4#ZX\234\264w\324\021\t?L\2451\370\310\272*\345t\270\027A\343N|\020o\033\"\350\266\205\245\017\302\271\227\036\004=\363R'\257"
+	.ascii	"#S\305\316\355\342b9\241\375\307\324\252N\277S\214l\2126!S\256"
+	.ascii	"C\330'\216\030O\331x\244G\201E*\246Y\022B\257D\351\007H\260\363"
+	.ascii	"\224\243,\021\312k\356\361\2045\001\341\320\365\261,\037\177"
+	.ascii	"H\255\203\325\te\004\b\264\207k'`P\213\364\nQ0*\3618\024N\242"
+	.ascii	"\200\341\017 \2701\325\245 R+{\274\320,\017\300\357%\037C+\242"
+	.ascii	"\341>X.\037v(\242R6Q3o\272/\332\177 \216\2052s\212\035\323?\364"
+	.ascii	"\345k;\340s\nj\273 /=IQ:\036\020\005N\275\247\260!\004{\221\323"
+	.ascii	"Ygm\177^h\202k:\365\342\\\227\033\021\212\236yra\357\006\021"
+	.ascii	"51e\tdy\311\252h\327\251 \312\346\303\236\273\314>Q\004\256?"
+	.text
+	.section	.gnu.lto_schedulerSelectFromDeadlineQueue.73.c60ff4c304b43f03,"e",@progbits
+	.string	"(\265/\375`\252\021e\\"
+	.string	":\234\244\"L N\323\031\016{\365(\367L\321\213v\024\330\204z\263\334\306\252\301\327\242\205\2720\213R\004\250\211~\300\222TX\025%\017\3670J\254\243\263\234\327\020\352\2113;\2752P>\020\220\033\362\021\"bf\266\237\247\006D\"do)\223\f\035\002\346\001\036\002\347[\242\035\241(\331\2337?_Tx\235\n\276\267D\2722-\\\316\365\262NgS@\315\264\315y\036\336\020&j^\234\\\206W[0\227 \340\305I\227\254]b\005\273\3047\3738p\226D\253\336z\261*kw\370`\031\276n\357f\211m\366\356\353\330\372%~\326\372\370X\031\242p\273]\342n\275n\203\304\314"
+	.string	"2{\333\332%^Mw\221\354\317<\315\327\234n\211\273\313f\231\256\317\270uLH\305I\334\033\331P\315\336\245\353\334\001kp\230\230\360\023\220\034M\221t\235K\327f\350r\346\360\252\372\301\221vs{\227\364\212[\305\202T\240\360y\363\263\256+\211\253kd\230\312\255]\2312\t\310\374\351\321\3741F\222\210V\257h\026\026\303\253\313\274{\270\213A\362\270#\033\264\256g\177\330\254k\034"
+	.ascii	"\033\300\360j2=\230\277!\331e/Q\322u\226\\S\363U\306\317\272"
+	.ascii	"\306\235\330\270#\203W\207\327\020\274\332V\2346\271\310\247"
+	.ascii	"q_\241t\371\250$\324\223S\023\323\222R\022\322\021r\203\006\243"
+	.ascii	"\"\242\241\243\261H\024\n\032\n\203j\332\274\334\013\231\035"
+	.ascii	"\354\001\023K\362\2503tS8\331\034\233;\024[X\t\374\224\366\030"
+	.ascii	"3n\256\027&&U\021\246-\355|p\354\024\346Mogz\003\303K\302\026"
+	.ascii	"|\207A\205\354\315\033\340\331X\230+\271=\t\311\215-\214\013"
+	.ascii	"\037\245#\334R\344\026FjI\223ym\274A\355\032\324\364\262\260"
+	.ascii	"\021\321\311\035\027\212\026\310\343\347\r\360l\f\313\211\322"
+	.ascii	"\021i)\262\316\025\036\232\373\321\354F\266\2602.\246Kf*lp\275"
+	.ascii	"0\263\324\003\035*-\234\316\003&\246B%P\266\\/\254\203\024\305"
+	.ascii	"\037>uw\243\204\205\204-B\030#{P\324\331\030\364C\2750h\024["
+	.ascii	"\330\223\205R\036<\212}\245\311u]\037\247\311*\223=\335\340\235"
+	.ascii	"\216\340C\007\303Q\314+EB\331\002v\272\263S\214\311,l\261\256"
+	.ascii	"\3532\230\330\330\227\303w\031lw\355v\207Z\004\201a\036\210j"
+	.ascii	"x\277\fXX\212\031\256\353\252\366\215'\f\302F\353\241+\007\363"
+	.ascii	"\373\251\202\335i\367\nM3\346\377,W\252"
+	.string	"\241\221\026F\237\3409\311\230\326\264\320\005\033m\317\271\265\236x\252g\364\356\213\030|0\356\367\355\335\345)\351$\273+\3431,KL\355\356R\204\303@\343C\337\272\256(\376\336'\201\275\332\325\255a\303F\360\352\214~\234\247u\317?@\270.\016\234\322K\341Lm\264e&\361\273\371\2414\313\2364\211+\375~\265\006\347kM#\277w\301\024\355d\276\013\347Z{\363\265\246\367\313\240R;\367\351\021O\365\256\216\035|\260\375\334\036\230<\257N\302e~P\350F[!\301w\004Q\026\274\370\317\356\363\\\217\220\275\332\362\360\301\007\363\021\274\372\026\340\251\307\355i\342{<\313({\307}j\373\265\013^\245\340\231\247\355\257\213\003w\343\230\334h\273\017\352\211\371\332\256\262\2534\362^\035y\255\210\274UD^\b\210\274\017\020y\201\034y\177\034y\0350\362\3728\362\3668\362\3628\3626p\344\335Q\304\313"
+	.string	"\021\257\016#o\216!^\0347l\324P\340p\2763d\3048\362\302x\341\342c~\252\223\371\r\270\234/\213\343}W\250Ha\344E\361\270\177\352r\377"
+	.ascii	"#n\347+\"\004\210\017o\363\365 \325\201CT\022\352\311\251\311"
+	.ascii	"\310\313d\344]R:\362&\031y\221\212\274GH#\357\206\"\257\206\263"
+	.ascii	"\371\032\025}\356KD\344\035\"\362\036\211\274F\"o\361\310K4\362"
+	.ascii	"\n\031y\203\212\274\303\253\371\n\211\274A\"\257J\344M\211\274"
+	.ascii	"-\304\313B\274\017\242\204\307\334#\263\266\246\371\342V(\201"
+	.ascii	"\200\326<\265\216\313\355\374r~\274\037\316\337\346\237\373\321"
+	.ascii	"\374j~6\017\332\375\235\276\275\001m\323v:\033Q\236s\242|f\002"
+	.ascii	"iX\223cV\324\300\f'x_k\210v4\217v\356\251\202@\272\223\224y!"
+	.ascii	"\312\002\220\206\362\031U\261\357`~?\032Hw\232\257@\016t\217"
+	.ascii	"\376\321J}\232%09p}\264\003\375\257@z\273\354\200?XrYv-\305\370"
+	.ascii	"\350\267I\203\343\321S\335\243\257wu\204\247\234(\237\\\027\243"
+	.ascii	"26[Ni\240U\271?@8)\r\2300)b\0172\250;\262?\202Ww4\227q\222\351"
+	.ascii	"h\026\315@\277)\002\223\0037G\353\350\223\201\260v9Z\215\262"
+	.ascii	"\007\360i\264\246\016\004\242/\321\2028:\202\350\235\327\331"
+	.ascii	"%\025\226\262D\033r\224e\327\322\312^--x\025G\277\316\271l\004"
+	.ascii	"?fax\203e\026\f\240r~\326\325k\312\2135\240\361?\250\\\033\213"
+	.ascii	"\361\330RK\360*\213\276\001\225\003\204kJ\255\350\240\272\020"
+	.ascii	"\255\242\237\367\031{O"
+	.string	"\274\246\031\023\313P\243mQn\212\036\"\21175\327\236\030K\274\211\334\024=E\022'\022\366\032\205\275Ea\027\265s\211\310^#\2627-\"\333\350\307F\3334{7t\345\002(\031-l\306\214K.A\024\r\327D\f\235\027\366\360`4\212N\352\363\025\210\330S\r\243o\367\364\313\n|\360H\220\353\302\\\343&G\244J\260\223\306\315\\a\260\245\027\033\304W\271\363\016,\213\026\2058\264\260\235\233\n=5\222\304\205:\202\350\222/B}\272\247\177\317@\300'\321\315I\224\020T\2437U\266\207\250\3364Esh\347\0069\365\246\251R?\265\323C\007\265\2139x\270\271w{\265]\222\260vA\251\337\363\357\377\2122diB\215\266S\232S\236\f\025\340\320Q\355|\234\277\254Y\026h8\2437\025>\265S;wK\334C\327\350\2739\003{O\314p\320\260\025\350\356\363\025\250\213\003\335\330k\tf"
+	.string	"f\3220\301]\303~\335\023\220\033\234\332\307\276\243\350\223\030\300\374\206\301V[+:\307\213\377d"
+	.string	"\210*\330i\036'Y\027\007\033\304\204r\b\026\327\t\"YC\206dY)]M\200\025\304J\305R\205lUq\245XX\\\334\312Z@YDY\304\006\221\252\304"
+	.ascii	"\013\207\020\253*\256\255\240\013\224WDdPP\245D\240hK\002\"X"
+	.ascii	"\\XU\026\024\215paieai-`\2055\244\212\210\221\003\204lU\345\270"
+	.ascii	"RrY)'Pn1m\351P\016\301\312\301ED\251\245U\304\312\270V&\264\224"
+	.ascii	"\023\024\271R\006\261\332:A\004\253j\310\t+\255\255\023&\242"
+	.ascii	"6\213\002\245\326\t\256\254,\255\023\304\270\256%O\223\311n\332"
+	.ascii	"\246~\236\035\031\362\272\232\271E\322u=3\340h~\272\027\361\031"
+	.ascii	"\263$\n\352F\357\221\250C\330\350=\026\265T;\027jDoz4\352d\b"
+	.ascii	"\017t\320d\211\316aK>\201\350u\002\3217:\364:uh\033\355\334'"
+	.ascii	"\250\336\324\t\252G<\013T\243\255P\027\317z\017\317\2303O\215"
+	.ascii	"\266\005`i\222\321\0344\277\300)\275h\021M\0378\220[\203SR\321"
+	.ascii	" \332\271L]<\213\342\361\227/5\323\212^j(&\031\336\327u]\235"
+	.ascii	"\370\376*\315/s\230b\364\246K \372\203\210\226\321ZQ2\274&\021"
+	.ascii	"\335\005\351CZ\211\203\350\030m\304$\333"
+	.string	"\343\204N\237;&'\277\342+M\360$\261\352\253\244\236j\253\376\035\267#\033\226j\334F\203"
+	.string	"\022\222\322:h\0337\270>SV\245\315\022\222\224T?\317\313\234$\027\275GR\335\241\235\213\224\354M\221\311~\236\0275I,z\323\243dC\265\023\251_4\337\361\212F\352\363\275\006\223\f\257\311\306TZ\321\307\2760\350\032\267\347Q\273\350\356\343e)\205m\355\250O\006U\003x\204\342\201\3719\245`\0050\251\321V\2527\364\221-\252\202\206\336\320\337\262\224\"l\203\246i\323\242\246\241\257'\215S\024\376\346\220\230\312\217]\204{\220\225;aGM\207\006\317\035r\250\217C\234Fu\354\033P4X6\030\213m,\246oP3Q\276\023\310\252\3020\032\325\261g"
+	.string	"\363\223\341\020tU\277i\366@\003i\b\372M6\034\375@\201i\250a4\006\021S\206FDD$I\222t\341\004\004)I-3\017\021\200\255CG#I\222\244\003\260\356|"
+	.string	"B\001\310\332r\013\252B\326\217\362ej\n\b\215[\230_\275,iv\337\177\211Z\336e\275v\nf\251C\300\336\347E\231\354\254t\373\240\022\f\360\232\241\234Ma|\233\331\2766\"{\335\217'dx\330\f\fK\327J\017%\276\211E\\\"M\026X{\n-\214/\311q\254\230\020qJPH1\354h\314\005\216\031\364\261\221\0133?e\363k\357\342\327\365\225\365P\327QO2fqKV'&!~\n\370\210\227\322(/\241\306d0n\301\335\241\243\"\320\363\364\027Y"
+	.string	"\354z\n`z\265 \177\005\2648\301\203\375P\336\371\327\020\337l\023Z;A\016\005\267\341\3770\020(\274\321Tr\345=Jr6O\232}\344\312\263\251vv\245\351\313f+\3649(\212ri\005B\021;\312\035Q\211\351\322s\301\213\211w\206\026\205\022v^\236"
+	.ascii	"\201\302x\177\005\322+X,?`\025\264\315q\027H\345\334\034\316"
+	.ascii	"F\177\207l\274\313\215N=f\321I\033I1q\013\003\265\245\016\003"
+	.ascii	"++\241\340\334\217@\265\030\236\324\326*\001cG\013\323QX?n"
+	.string	"\320(6\274\340\313:=\372\236E\254D\345s\001o\372\261\265\273w\365\001(\336\256d\001\252\371;\244\221\246\241<\340\037\230\013BQ\034S8\303\337\325\316\206\007\2141\323\2678k\240q\311\305l\301\272s\007\352\023\321\206<\n Y\214\337v\374\302Ju\230\313J8.jQ\244\031o\272\250\313\322)J\004V\301\374{\323\212g\314K\300\216\301\232'\226>8\314\314\310\251!\300\002D\004\213\315\030\267O\366\354\311m\032\3664\317\344\002z\326\272OK(\254.c\221Hz<\335\374 \177\037~\367\021\001-\236\205\225\005\327\305\337<\340)V\252\343\23304T\017\276\035\301_\200P\255Zh\250\031~\327\353\250.\330\222l\004\216\267\333c<f\357\316\370\314\273\314\326\250F\302\257\356>{\031u\235\220\343\007f\306G\310\254\326M\317\305\304\337V_g\245`\333A\317R\326\341\323\221\277Q\"\302\255"
+	.ascii	"\300\306\357\214\261\221A2sI\275\003\222\244\353\225\315\255"
+	.ascii	"#\341U\215\326\201\335\240ZOT\377\362\361\367tp\034\344S\nlB"
+	.ascii	"W\033\2648\300\330\367\200\317\013+\332\217\266\250\025\016\264"
+	.ascii	"dv\033\360%@\343\344\224\003k\206\272\002\227%\"\233~F\270\277"
+	.ascii	"f'&k\243\251\340\273~\002\f\tcV\r\310{e\030\213\301P\200\275"
+	.ascii	"\341`D\265P\356!\371-\032\241\355+P\303\363\275\262\354\362\""
+	.ascii	"w\230'l\356\224\365\024sV\003"
+	.text
+	.section	.gnu.lto_scheduler.74.c60ff4c304b43f03,"e",@progbits
+	.string	"(\265/\375`\367\024\025j"
+	.string	":\262\220'N0\220\322\031\016V~\231X\304,\333\365V\375W\214\327\301\312R\177rG\037\023\351w]\247D\324Fd7\201s\325\263\307p\304\223~z9\246\022\344\002\225\2260\250\311k*\b\202L\r\300y\217\203z"
+	.string	"\336V3n\230\344\357\275\245L2q\002&\002b\002\201b\204|\357[\372\231\315\341\232\333k\246-\355\251\331a\\\333^3\355\206\247\351\3613\373%\263\256\307n\231\3531\375\314\022\311\232dy;4\263\303\366\344KZ \030!\323.\231\035\336\0251Z)Y{H(;\343{\235PL\001`mjx\030\247\177\331 `\200\201N\273\303\031\016fw\270@\376eO\005\f\220\312\272\256\303\313\355\351n\267\303:!\306\025o=\027\223\2631]\346\240v\256\232\316*\013dw\370Tx+\217\341l\307\362,\357r\270\307\355\320\013\024\beg[\232\274I\035\t<\343\342\367\245\345[\220\347\"\004]\277\234k\027\316\022\023\374\256\345\024\376Gu\233BW'\b\234\301\225\255\253\027'\031\336\206\374s\312\310\312\271.q\330\302\234^8\020>5\362\177\324"
+	.ascii	"\004@\376\n\021\243*\347\272\245.\tss\342p\026\371\332\265\036"
+	.ascii	"\004&g4\370\255\353:C\370t\237v5\344\327\226\316\310\210s\345"
+	.ascii	"R\227\204}I\013\\\327%\213\247\013C\370\324\350@\352S\364?\352"
+	.ascii	"\323E\356\362\335\351d%:sK\266\005\256\353\232\324)l\021#\217"
+	.ascii	"\002\351\204\211\022GF$F\024\021\r\t\005\211\b\001\002\350\303"
+	.ascii	"\217O\217\221g\247H\034\352\344\bq\324\024mF\356q\020(\221\244"
+	.ascii	"\255\352(\336\216\364\206\267\354\302'P\241f\030$HfK.l\342m\013"
+	.ascii	"\2270[j\331\302GYn\224\305\215I\240?`\\\316\2648s\306|\234\025"
+	.ascii	"\036\201\342`mE9\336r\r%\300\215\237\334\363\240p\021\016\002"
+	.ascii	"M\272\324N\224\366!\243*,\024\224\006\215E\300\360\020xK\030"
+	.ascii	"\2440\b\264\250\214\230)\307[RAK\230\200\302\226\347Ea\240[\245"
+	.ascii	"\375\003\336\222\354f\313\025\370'\3577\226<\371\222&(\326\245"
+	.ascii	"v\237\265\367\250\020\367\204\215\177oN\230\307ly\002j\024\347"
+	.ascii	"\204w.\326\325|1\354\3040\023x\230\344:I\314"
+	.string	"\226L\3169\022\353\002\273\020o\tf\266\374b\034\024\t\315M\335\205\236X*\334.\311\252\005|pJ.\257\247iV\037\233\236\026.\257\243\350\212f\030$;\\X(\020\231%{\007c\204\033]\341\027\227\303\355~\204\267l\242@[Q\224\217;kq]1\343 \260\256\353\262\222\253\353\233\342\273\234\267{\235\335\036\036\002\350\224<\277\036Jx\226y\320\3354\272\333\262\232\334]\205\225E\204\353\272\016\260\f\002\025\017H5!\231\020\364\005\024\340\2244\325T\244\025NB-u\372\004\024\\\023\321\002\0273)cQ\225I\035\003\365)\217\3466-f\007-\243w\364\263Z\270\342\301=v\007\375\344\033\266\342\253\245\223\261s|\345\316\251O\217\235z\365\t~Y\361 1\213\\\030\212\274\rUGs\300v\303\301,\215\017\332\020\256\253\221\001\366o\250x\270\261'[@}\252\243\303\\\bl\252\255\t1\037"
+	.ascii	"u\327\201\007\370J\031}\273\377\334\351Y\2713r\342\315\tU\335"
+	.ascii	"cKD}s\300\226\306\b\273\331}\340\005\211\354\3116\002\t\370J"
+	.ascii	"\t\324\247\357 >0_/\232\353m\257\231\366\034\202\366\276\366"
+	.ascii	"S\352\335\336d\336\322\232i\200V<\270@\274[\301\005|e\214v\361"
+	.ascii	"D+\023\364\273\352\252]\347\025\367\230\237\362\013\3116\223"
+	.ascii	"]\"\357T\221w\b\312+\204\310\033\204\310+e\344\2152\362B\031"
+	.ascii	"y\237\214\274@\212\274?\212\274ND\336\246\"/S\221\327\007\312"
+	.ascii	"\333\243\310\353A\221w\251\310\313\303\207wG\017o\007D\336\343"
+	.ascii	"\016\257\016\r\212\274\031``\001\216\363*\360\273\357\r\"\257"
+	.ascii	"\215\"o\215\317}i\020yg\274\356+\343^\2761\276\346\013\343f\276"
+	.ascii	"Iw~_\374\312\327E\013\026\347\362]\361\267\257\n\346\005\200"
+	.ascii	"\310\233"
+	.string	"\202yQ0/\022\363\236(\362\232(\362\226(\362\036\025y\215\230\227D\221wD\221\267\250\310Kd\344\035*\362\n\025y\203\214\274\"\214\274!\214\274 \214\274@F\336\017F\336\037\346\365\341\341\355\331\34152/\017\363\3560o\221y\211(\357\220yuP\336\034\346\025\026yq\210\274*\2217e^\264\310\333D^f\336S\r\265\261\225\221\341,K\3539\327\255A\036\326\273TN\312\327\374f\376\273\177\356\257\373\327~\347\177\345\177\376n?\227\377\355\367\362\342\356\001\331\354\275\230|T\376v\270\246\310\02224i\001@\272\273$\33785S\377\350\2406Y04\265S\232*E\266\251_\367d\315G\253h\246~\232\247.|\331\300\246\367,\273\332C\203B*\271\261>\372{g\262\027\230\\+p\313J\304\207\376\363W\376Y}J\375\351\017\375\254\346\237\377\351\2331\351\274\234\361\315\020\302\247\377\307f"
+	.string	"\253\350$,d\222\257\364\351F\223\206\356\356J\364lH\001D\217\355\225\324\236>\036\022\004nA\251\247?`\316\2411\331\230\275'@g\026R\030\201\207\017\274\336\3307[\032l\206Tb\354\347=\005\327\234_Sm\255\261\330a-\177Zp\231\020\002\226\243\260\024\244\226\b\310\255-\365i\217\306\021\023#(\307\342\313VL\266t\\;\367\276\263\n$\3705\323"
+	.string	"\tp\342\206\317g"
+	.string	"\276\334\255\354\034\226\313=\013\222\004\245\212\022\220`|\245\005\335wiX\270Kv\325\220\030;\024zzly\372\251\t\021d\022\236.\200\211e\347\222r[\306\235\246\341\242\213\275\323i\227$\022\235\027Q_t1u\303|^\351aI\273\342\301\023\200\025\202\222\247\307\226\2133:\354\251\326Tg\034\311\263J\024f\361\027S\216$\341\212?\021\225\325\273\371\343.4s\006&\t\307ws\027\255u\273\347"
+	.string	"\236\r&\341\2128\232\325\030=\344\214K\022\216c\264\212\326\"\262\030\261\037w\023\\seM\265\035\034\335h\364\006\213Ct\270\003Q'L\247\331MOp\330c\2739B\3349\235:\365\332\334\031\351*\035!\f\336E\242\200\\\302W\n{\307\337\335U\216\013\306\351\177\341\022\220P\204\353ju\3452\t\354\205La\027\371\004\t\205\257DBQ\221+ \245\030au\325*\3208>]\222on\264\002\035#/+P\355\264o\364\212\274\254\262\253.\265\373\371d\215\005^\246}2o"
+	.ascii	"\t\230\016h\351\021\2542\341\335\034\355\213\361\bD\220g\022"
+	.ascii	"\240\215\003,\007\301/$\216\3212z\027\371\002\022\215\257\334"
+	.ascii	"\333\375cO\2652A?,\036(d\356pzl\317\202\r\315t\251\017\346\f"
+	.ascii	"\2100&\t\207\362h\017Zk\267\210j\243M\b\301M\fl\312\214\311\240"
+	.ascii	"m\320\350\030\235A_\314\231\331&\253F\317h\021mb4\215\256\321"
+	.ascii	"\017\363\313\343\305\221i)*\251\311\211\211\311)G\220\216\343"
+	.ascii	"\323\222\024\220#\016\237\036PJQ\350\220\rXx\214\222\312q\034"
+	.ascii	"b\243\347I)J\202\017P\024\034\231\226&\210j:>=I\345(\022\247"
+	.ascii	"\242\226\236\234\226\236 \310\261\304\244\3244Uc\bjG\323R\324"
+	.ascii	"\222\222\020b\223\022\216#\323R\224\017\245\343\023\017\024\005"
+	.ascii	"SJ>\2165z@)M\340\3644\265\203g"
+	.string	"\310QG\323\002?\224\216\n\3508F\3458\3728B\365l\216\027OG\037R:\216<r@%5-)1%\345x\202Jzq\264N?\216OIQNNOIC\247\325\233\311&\260\246L\320\317\252\257v\351\326\374\256\240\353*v\300\335z\374\256\360\340\275P,\300)z\227\252\217j\r\243Q3\003\016\234\327\034\022"
+	.ascii	"\315\177c\210\260\001 \204\2262\355D\217-\0133\2661kO\321o2\373"
+	.ascii	"Tt\213\324\251F-\305\362\315\212\t\024H\215\242\325.I$\032\364"
+	.ascii	"\213F\352\016\256V\350K\246pA\fM\211\036[\024Y5\214`\204A\023"
+	.ascii	"=\301\210!1\002\306\211\276X\r'\032\007\223O\360k\252a\264\006"
+	.ascii	"\351\222\311w\245\367l\016\351)\025m\242\207\364\001M4\372E\r"
+	.ascii	"\332\335UW\035\225h\f\032\315K\276\261\222R\217\272D\013\321"
+	.ascii	"\245_:\325\250\217:\b\207\2547Wm\270N\252\211Q\177\216\271W4"
+	.ascii	"\245O\320\210\304\034\211\376\337\221\270\352\322\232j_\005\250"
+	.ascii	"\031"
+	.string	"\303\206\004Z\304\242\3577\345+\t\327cA\267h\321\035C\335\331\b9\035\212\232\250Gx\321\241\250s\276\206\232\350\371\241\016\302\314C\373\3527*A5\250\205\264\360\026*A\252\035\250z\240\352A}\032\324\3054\3035\242\307\266\265\222[\210\2044\223)I\222p>=:\251\265\026%Z\321\200goI8\037>r\026\255u\344I\355C\204&d\330\2249\272\256\353Z\224w\035*S\252$\341\206\222z\321\017,z\005U\027\273a\021\3229rA\272\255\351\224\177-.\325A\330\244\372z\347*^-4\325\270\213(D\337\355CK\240\330)\377\274\244\344\200d\250\307VD\207\020\343v\021\235t\303W\fS!\372\003f\030A!\020@\r\002HE\034\035\225\246\332W\024\325 [\231\332\351\036\224\177V/\034\252\243\236\032HC\365\263\314\214\375\324>e\264\372\222o\222\264l\255\020\324c@\272\253\332\330"
+	.ascii	"\351*V\233\"\242\271\362\357G\007\201\240\250a %\025c\b\315\214"
+	.ascii	"\210HR\220$\035\001\005\304 '\2514\017\021`%C\216\325h\222d8"
+	.ascii	"f\236\034\177`M\207\333\224+\377w\030K\f\243<\275\221`\200\360"
+	.ascii	"\210\304!\2371*]9\001uzR-(@\211\340\217D=\246|@\211\345 \020"
+	.ascii	":\003\342\242nC\250\257\267\021`\316\023BR\266l\367\274s\001"
+	.ascii	"nMI`\333i?+Z<\305\221\353*3\301w\fK\271\377\367\201u\350F\367"
+	.ascii	"f(\213&<\027\320\242\301\211|HS\022F^\224\324\267:\035d\204C"
+	.ascii	"\315b@\374\360\313\020\300\016\034{\221\333\205\266\305\207/"
+	.ascii	"\210\236\t\202\202\313U\364C\027\267/\035\337bGw\360\372y%y\305"
+	.ascii	"\344/\240\023\307?\224\315E`\205\310\201\235\354\233\361\016"
+	.ascii	"P\326\204,\251\236\267\021\212\365\347\321e\261\017M\013\321"
+	.ascii	"3\360.\306EGU\201c\020\2721l\321MJ`\030\030\256I\241Xp\031\242"
+	.ascii	"\204\023\210\036\322T`J\370Y\211\227\005\272\300\251\226\200"
+	.ascii	"\023\262\251c\2104P\001\"BI\322\246\3067\024\230\007x\230D`\323"
+	.ascii	"\003"
+	.string	"\273\245\231u/\013\f\023\267Fj\361\320}\350\324\333yl<\241<\345\347\204\204\327\017\343Q\3330e\274\f\031\212\350\361\377:\204DB\347k\023\356\201o\371\302\372)\024\361Xo\0135\336A\f\223i\243\200\265\275 \315\231\376W\200\231\020{\263\025\245\n\260\003\204\333X>\244\261\337\2035\025QOd\312\020?X\310\245:\330\332\243\027\312\243\360ed\301\242\237 \240Wy1AqMJL\215:\244h\2320e\341F\351\231\f\374\244\271\375\377\231\360$\0268\230\213\201-\370&\305\275\341\221\340#\321\247\023N\230\314d\031'\355\0255\251\256s\026*L\330UJyv\270^\233P\307\216\021>\347\264X\352\"WN\245t\302\022\017\007\330,\217\212B\224g\307\213\247\037\300<\275P\006\251\311s\211\177nM\007\203\277\232s0\325\237\354\021\204A\340\313hrf\305\272\224\200\330\253_3:2\311\243"
+	.string	"P\261\246\337\243~O6\336D\"\013g\372\325C\200\003\323\316\024\277\023{\337OO4QTs\t}\303M\307@\313\235\342\237M\220\216o\357\017\007\323\232\314P\031\241\367\026\242\022J\370\226\231Y>\375\241\240\306\013\305\020*(%E\370|\334k\273j\310\253\330\226{\253o\211&0\\\301\264\360h\025\b\253-{\224c\346\326\302\034\346\256\327\266\340y\316ZVI\315\272/B1\366\201\021\205F\227"
+	.ascii	"y\0217\025)-\030A\225\260k\224\034\026\266\375\337m|\322\353"
+	.ascii	"QB\350#\244B\002 \r\221\023\351 B\234\266\352S \242\366\0171"
+	.ascii	"\336\2237\233[\346\035\362\270Q\003CO\227\301\177a*\372N\276"
+	.ascii	"\363\277\366x7\365y\321\231)\303\320 \376\366n\246\204\016\304"
+	.ascii	"\236\251\336T\016\312\334\3140A\374\335\024?Y0\273\312r\r\224"
+	.ascii	"I\314\301\371\310\322\334\215\005)(\326\b&kW\354Y\314\317\024"
+	.ascii	"n\247\"\300\0212z\307\273\314M\221\277\034v\321g\0367\316 \233"
+	.ascii	";[\235\374\206m \352\214\030\036\260z;`\307\204o\272\026\342"
+	.ascii	"?"
+	.text
+	.section	.gnu.lto_schedulerEnableGyro.75.c60ff4c304b43f03,"e",@progbits
+	.string	"(\265/\375 \363}\006"
+	.string	"\342\313,3`M\323\001"
+	.string	"\321v\0044e\005K\345\344\035\207\313\364&v\275o\375\267!\204\370\007E\027A\277\325N\203 \020d\007\366\214,\200K,\330\266\355\336)\005\206\036\032!0\024D\006\0205\245\003\202\204\tQj>"
+	.string	"\236\024\":\027\246\211N\307\333Gn\300dUJ\262\350\340\277j|\217\177T>\206\033,x\355\322\267\232KYE:\212\356$\203\237\355a0V\330\267l\344\354(il\021\365\034(\273\333\267\262#2$\303\366\035_6\311\275\213\315l@<\200\244\354\356\214\026\277\016/\377\035\307h\025;\274\b\354\256\241V%\356x\333\001\266\247\355\211\t"
+	.string	"i\3317c\361\2003\304\305\027\272\206\317\2050^\206"
+	.ascii	"\227n\321\316'"
+	.text
+	.section	.gnu.lto_getAverageSystemLoadPercent.76.c60ff4c304b43f03,"e",@progbits
+	.string	"(\265/\375 \374\275\006"
+	.string	"\302\314.3pM\322\001\240\253\020\304y\032\260\255\304\025\340\365`\1778\214\234\001\325F\210\335v\266\372\200\311T\026a\250\212@\177\367\016\001\206\340\377\370\261\354/eJ\001\236,\217\202\250h\240\034\246\213\223x`\210p\323\2738\013\202\253\t\3529\212\252z.\212{\335\244\036\\\252\261_\362\b}\216-0y\354\315\307@o\251\002\033W~\354h\245z\330\007X\335\330N\247\016x8\331;(\273\031\237\225Mi' \2663v\344\213|$c(]\\\226\024\302\201a\242\262\033\035\301\r\240\267|\001\364\246\037\207O\350\237\344\013\232\216\007\313\254g\200\302\356:\261L\343\326\333N\260\355lw\004\t"
+	.ascii	"i\331'\323\342\2543\202\206P\\\023{#r\026\"\017w\305\324N2"
+	.text
+	.section	.gnu.lto_deadlineQueueUpdateTask.part.0.90.c60ff4c304b43f03,"e",@progbits
+	.string	"(\265/\375`\006\002E\022"
+	.string	"\246\"wG\320\224M:\304\226\031\374T9\214"
+	.string	"\302\002\373V`\032\360\346\364*3"
+	.string	"H\030\030\332\317\301\230JR\213\332Ahk\373\325P\300\340\b\243{5\203\\\315P-\204S\232\nz\200\375\302\310\213A;3\261do)S\na"
+	.string	"`"
+	.string	"c"
+	.ascii	"\321\337Q\272G\357'\335\243}\027\266_3\303l#\377L,*\250\310\206"
+	.ascii	"#%\273\273z\324 \243\034~wL\330\273\b5Q0\237\226\363NE\343\321"
+	.ascii	"\311\2302\025\037\016\033\324\202\310h \256\320\001\321\212\023"
+	.ascii	"*Z\f\252\355\206\343\271g\017m'\023\345(\224\313\356\332\013"
+	.ascii	"q{\267\255\301\366\002;\037\004\327L\347q\367\001\234@`\262\333"
+	.ascii	"\341\211\311\222\210J)\216\373\355\373\270\033\3719\247n/\253"
+	.ascii	"\304\276\245\315l\376\315\177\361#\330a\230\311\313\231y\267"
+	.ascii	"\333\222#\273\273\362h\005\336\243\n\274o{\331\251\2243\377\275"
+	.ascii	"^\303\021\360\255\207\2313\355\023\275\b\366\032\316\003\354"
+	.ascii	"\376\364\250\261\373!xt\002\357\001\177\342\200[-\341TB\265g"
+	.ascii	"h\3622\253\222\222\370\210i\216\365\003\220|\220\250\002Y5\265"
+	.ascii	"e\324\024K'\333\254#\341\020h\261\235\34140\244\b\331]\0062>"
+	.ascii	"\303\345\017=\332\346&/{\364o\272\307\324\347n\340F\023\026E"
+	.ascii	":\371d\275\002!b\213\221\ndE\275\345\307\016\024\326\037[\323"
+	.ascii	"]\204\377\036229\343z\251\201\206ai\305T\260\221\020C\001\306"
+	.ascii	"\265\262 \363B\263\202i\271V,\005\314\272\020\323Z\325\260X\255"
+	.ascii	"U\312v\n\335EGw\204\272!\250\225\247t\300\250\267;\275F\340\021"
+	.ascii	"K'\3736\256d&\177\310\023\274\224\227y\251{\3544\245I\004\334"
+	.ascii	"\335\215\007~\215\261E-\211g\304N\316\347'\007\204y\205\332c"
+	.ascii	"\007- P\202A\f\313\003m\366\201\241E\026\006X\"\240\301\370\006"
+	.ascii	"\352D8\f\001\275>e\322i\210\255y4\372\263QX\0336\030*\254\001"
+	.ascii	"wlc\n\331uh\205\321\244\276\2115\325\005 \025\0020\200,\334w"
+	.ascii	"14F!\fA\274\364$m\355\266\247\254\r\204\326\214\273\221\be\312"
+	.ascii	"\232\033U\003\322xh\247h~\356\265j\f"
+	.text
+	.section	.gnu.lto_rescheduleTask.part.0.99.c60ff4c304b43f03,"e",@progbits
+	.string	"(\265/\375`T\004\005\031"
+	.string	"\206\354\227E\300\330*\035 \203kg(c\331\377\203PT\255\037-\351\214q\244\240(\316\230\223\353\024B\037E\004\244>\326\365p\025\251*\t\001\352>\035\305\301\306g\304\026q\001\203\266\211\235\203\301<\341\n\261d\357\275S\n~"
+	.string	"\213"
+	.string	"}"
+	.ascii	"\273\023\306WKy\034\354JTP\334\336l\226\322>\222'\211]\211\n"
+	.ascii	"\343\354\372H\302\333\305=xu\204\3615\347\007\304W\372\002\342"
+	.ascii	"\253\375#\266a6\307l2\307\t\331\377\f\271\310\265\331\335\322"
+	.ascii	"\353\f\362\330+\235R\214\371\317\035\247v\223\275\312\332\255"
+	.ascii	"\306\251\200\033\215tc!'e"
+	.string	"\260c\013\017\3516\243\007~?\304\034x\031\343\306BJ\002\027G\025v\327\243\215{t\333&\333\034lz#\300\237'O\021\027_\257\fQ\256\312\203|,\337\242\005\226\305Trh\003\226\366\003\006o\303\370z\305\312\31394+\257\357\214\375\01340\304h\030w6\311\311\205\374)&\375\300\256\273\024\333\365 O\2365\337\235\211\317{\024\330\201Z\022\001ng\330r~\224'\207\022;P\353\333\302\206S\033\022\206h\027w\0017\352\374\037\327\233\230\312(\263\215:\235\033\242\335m\360j\013\243\213\3729\230M\"y\312\373,yy.y\ty\0336\210\223y\t\030\332]\t\376\230\024)\237HK|\345\021\304\261B\016\355\340s\322y\3413\344\330\351Z\254\231\311\241\001\310O\233\204J\276&\347}\277\016\032=\037m\312\344\354\361\024?\207\303\341\320\023\210=\222\026G\322U\224\246\367\371\347{\267<\356\177"
+	.string	"\003\024\212ve\f\213\266G\225R\344\273_\313\177\345\357\375\301\037\314/\364w\371h\337\377\362\237?ta\020L\033.]|/\001&\035\371AG\322TJ\262:\354\250R+\024\007\027\252\004i\007\203\b\226\t\205\350\023\204\025jDk\007\025\342\304*\225H\231H\224N+V\t\202\002\253L\240V%\024*\325\252$O\327\037\205\330\370V\314\231\347\351\356n% \345\364\201\036t\344k\246S\346\371\367fH\200\350\3549sqZHc\022g\202\340\274\fR\363\3531g\217\355\023b\235\037|\2044\371\306>\321\315\234\360\211\370\204\222\257\241\304\327:\017\374\002\032l\214\320\031Z\250\301TE\234\022\231\021\005%)\210a8\220\002\221:b\035\022@F\256\224\216\3621)\250\037\345\001\246\001\024z\277\327.\224\004\242\2315#\365\253E\030n\230\313)N\214\342\003\351?I\030\334\255\337\3424\345"
+	.ascii	"\023\315g:9\221\330\0027\301\330\331\237\207WIBCQ\ri\007w\210"
+	.ascii	"B\b\240y/\211\007\002\375\256H\370\215\033\016>\023\205\245J"
+	.ascii	"\177\326\347\002\030u\270\254\0256\225(\006\310+\n\272P\235,"
+	.ascii	"\301?\245y\365\031U\372uw\270\307`\233\n&\230P\020W=\257%\343"
+	.ascii	"\351D\352g\247aW^i\314\031\230$s\226\254Q\227\272\n\364\027\307"
+	.ascii	"\374\240\373p-\351\241\236\037"
+	.text
+	.section	.gnu.lto_setTaskEnabled.part.0.100.c60ff4c304b43f03,"e",@progbits
+	.string	"(\265/\375`\221\002E\025"
+	.string	"\006h\214J\300\322Q:pD\376\320\376u|\034B\265\005\3472\2302)h\307\023\006\307\325;8R\2412\314,\214\004\350\240\272>\2731+@\003\241\276~\001\006A\020\004\021\2440P\22431@o;\004\232\355\367\230\265}\262\267\334)\005|"
+	.string	"r"
+	.string	"p"
+	.ascii	">\n\333\272\237w6\216\217!\352\225~\324\f{\324Za\247\373\363"
+	.ascii	"\335[\254\225H\347J\327\316\377\360&QU= \314[%\254\025PO\207"
+	.ascii	"\317M\207\257\246\201\0323L\230x\350az\001k\2448C|$z\247\361"
+	.ascii	"\313\231\tr<\361\240\221T\366\2008\237. \316w\222\310\220\252"
+	.ascii	"\001\001\362\346\201\340\316\324\233.m\2002R\016\270k\025\241"
+	.ascii	"\326\352\307\350\334\257\333\016\332\226`\313\017\001g\372\355"
+	.ascii	"\373-\316\302o\362\213I\367\245\234\034\031\353\315\317O\272"
+	.ascii	"\322\356K\271W\232_\253\007\264!G\255\243\202SC\030Y\303\373"
+	.ascii	"C\235\375zy\312#\031%E\367#\227\217\3257\245\215\222\262\373"
+	.ascii	"\221\313\310w8\245\210r\300:\265\224\037u7z\231c\005\376,\245"
+	.ascii	"}\025/\332\335\350\305\255Z}\212\234j\035\027\234\232\001\353"
+	.ascii	"\224\344!\342\351<\001\361\324\001\273\253C\210\303\312\245k"
+	.ascii	"c\027qn\201\240\037\272B;\375)\347\007y\205&\337;\365i\342\351"
+	.ascii	"\356\003\02191\262\312{93\243\236\230-\371\265k\032\344{r?\305"
+	.ascii	"\303[\030\357O\325S\225\264+\264\310_\304/U\020\b\244\033<I%"
+	.ascii	"W\350u}\326\r\332\242\264H\245\351\221\376I\245\227J\313\217"
+	.ascii	"\377\001\204 \360Q\253\257\312G\345\241.J\004\264[\f7Uf,\025"
+	.ascii	"b-\263\225\312\004\332-\206\023-;\261\315Xr*\263\013\262\033"
+	.ascii	"\254e%\206\001&\263\335`'%\256e\230\331`\270Z\315\006{\331\226"
+	.ascii	"\237u\203\266\317\202\332\221\212Y\231\026\005\221\034)\336\302"
+	.ascii	"$)\331Xb\t\220t\355\230L\276g\020(\034)\242!\035\242\325\n}\023"
+	.ascii	"\305\375\220=;\214\033\253\326\332\300\177\201\263\340\007\345"
+	.ascii	"\304SqW\303\025SE1f|B\342\n\035`\304\f1 P\002!\311\3146\350\334"
+	.ascii	"\302*\355Q\313F\032\210dw\370\312Ms[A\034\257\204Kc'|\207IW\342"
+	.ascii	"g\273g\036\361\220x\023\237{\264\225eYn\242e\230'\\\257\035\373"
+	.ascii	"\t\301\\|<@\030\203K\210\357E 6^\304\274\005<k\261\343\225\315"
+	.ascii	"\223\365\231m\201\345\274}Y\203\274\357\365\243a\361\020\216"
+	.ascii	"O\265Z{\301\343b\312\343\334`\355\314\003"
+	.text
+	.section	.gnu.lto_getTaskDeltaTimeUs.part.0.101.c60ff4c304b43f03,"e",@progbits
+	.string	"(\265/\375`\267"
+	.string	"\315\n"
+	.string	"\026\225I?0\211*\035\344"
+	.string	"\206\215\206\224\200\210_IC!\312a(\\\266\236\273\203 j\253\257\2717\2040\332\245\035\210Lxn\322\335\377\214\bBK^\375 v\302\037\215\203l\003\212|\262\267\224)\0059"
+	.string	"8"
+	.string	"4"
+	.string	"\036\374\n\240$\006\006\204\274*\354\356\366\370\360J\366\b\337\220=*\201{\327\204\236\237'T\351z\327\341\005\030\205\023*\300\223r(\311\354\2565\001w\274\355\t\333\030\373\024\001\337\177I%B\302\356H\314\302\246b\004\004\366]#{b\223\354\2115\377\275%\202\337~\026k\276%2\303\256\n\366`\367\263<ZB{\264\277`\004\300\266\237\340\nH\016\266=o\340i\273\213\361_\036\037\377\300\243\337\221=\252:L``\312\230\265\274\332\033]\376\224\n!\005\242\245T\226\025\036\356\356ZWvL\303\230V\230\316\007\234\nO\247\te\336\\\270\016\006\007\247c\261\351\266\214\013\315g\333p\335v\2010H\243\303m!\020\210\333&\266\363pu\345\273NIU\250\"\352\214I?\254\252,\333\320\301\252*\023"
+	.ascii	"hm\371\264\354\343X\336'\016\224\277\240\001Q0L\256\320\313\020"
+	.ascii	"j\253\240\261\232rU\320Y\225\0034\271\211WxZ\210\324\024\232"
+	.ascii	"\227^[\306"
+	.text
+	.section	.gnu.lto_schedulerResetTaskStatistics.part.0.102.c60ff4c304b43f03,"e",@progbits
+	.string	"(\265/\375`D\001\r\f"
+	.string	"6VM< 1T:\244\224\b\002\035\005pa7\214\267\001\221\b\204\323\306\0366\210\177_(|C\030W\362\216\316\200A\323\302\334%\004 X\214\304\205C\2024\002jt"
+	.string	"\254U\262\267\224)\0059"
+	.string	":"
+	.string	";"
+	.string	"\021\236"
+	.string	"\366h?\205m\020\311\235-\343\036j\377\002\205\206\025\215\335\325\036\225\304\273k\302\316\277\352\217Q)t\rP\342\360\034p\b@\301\356\332\321\341\216\267=\261M\261\317\ni\325t\336\373/ Bq\355n\330\250\261\"\"\f\023\266o_\005\262!\020g\336\003=\365\201\336\226H\316\264\257\342+\272\247>~\354\216p\265v=\004\217N\340x4\360\b\366.*h\252\331\367\301\3370{s\026[\001\324\356R\374\325\005\t~\211G\337\002\3668\2111C\224\033\306\362j{(\344G\251\331\347\341\225AC\251'+<\\5\331\232\216\232\206\032\227\005\032N\245\203\331\"\3410\017<\027\214\003\013G\203\220\251l4\013\307\321$\007\274E\300pZg\3338\rr\270j2\203\023/\221b\260\252\236\354\006ou$Q\263/D\346\254\tP\263\017\304[\334\326<\037"
+	.string	"i\355\353Z\033\325\3130nO\300\032\032\214\001\373\300\300\300|"
+	.string	":"
+	.string	"\013"
+	.ascii	"4V\202\301fY\r\002L\275_\t\b\210\202a\256p\023\266\330g\2348"
+	.ascii	"\202\351\234}f\347\002\233\316;\227\005N^\314;-M?\241\214\001"
+	.text
+	.section	.gnu.lto_schedulerResetTaskMaxExecutionTime.part.0.103.c60ff4c304b43f03,"e",@progbits
+	.string	"(\265/\375`\231"
+	.string	"-\n"
+	.string	"\246SE< \345*\035\240HH\244\001\222\006^\235\302\r\310P\020\b G\352\002\004\25248\022k1\216s\265\341\313)Q\272\003\221"
+	.string	"\t\bBZ.X\243\031#\240\375*k\236\354-wJ\0012"
+	.string	"2"
+	.string	"4"
+	.string	"&\266S-\203\366\314\303\330^\345\245\203\026`w\273O\0359x\215\022\364?\373\206\345R]\005\\\037\217\004\227\001\016\273k\r\310=o\233\301\366\307~B,%\266o\177\226\2629\234O\3331>L]\206\222\341\272Z\216\321\376\311Q\300\313P\336\354\212\310\254\354\206\n\237^\320|\036\274\303}\312\027p\237\366\0034\215\013\237\344\323\317\340>=1"
+	.string	"V\361f.^\355\023F<+\352\200KK\215CUQaVy\271\273k}\331\032\035\037\376\347:\r\266]\217\233mCf\242\207\211\022\310\3049\344\371F\024'\321(\"T\352*$@\244.\364\225:\017\202=\213\321\327\231<\357\3538\227\253/C\300\324V\272aU\205\331\343l\322S<\203\330\356~\374\022"
+	.string	"i\355\223\231\r\225e\030\267G\214!\251\207"
+	.ascii	"\001Q0\314\256\320g\270\236\263\317\354\\`\323y\347\262\300\311"
+	.ascii	"\213y\247\245\351'\2241"
+	.text
+	.section	.gnu.lto_.symbol_nodes.c60ff4c304b43f03,"e",@progbits
+	.string	"(\265/\375`;\007\r\035"
+	.string	"\326\253\245Gp\234N\007\301\250\017\367Y\217\342\240\266df\025\333\365\314\353m\323\372\361)\027\005\240\350U\0160\347\200\335\256\347F\225p\025\346\003\177\001\374E\021\235\021\351W\263\nRMk\031 *\206\343D\257\234j\333;I\231\002\222"
+	.string	"\220"
+	.string	"\226"
+	.string	"\177\344\341\215:\374P\016\337\314\rOl\2717_T4\274\201\234\341\2130\004\263\333J\271\360C\013\337x\025\276\305d\n\337a\362\204 \364\225\360\r\206(\302w]\226\362\351-\313\202@\370^\313\017\0268`\200\366U\203%\264\257\242\224X\001\2507\233\315\246\361;-C\t=\3658\021\241E@\350:\340\214\372\t\362\331\266m\333\364ILC\252\0237y\305G\312\336\215\337vI\210vw\257u\335\226\254\373\273\337\2640\323r\013\230\322#\310\335\r\240)M^\320\210\031}\376sq\233y\313\2264\352=7\237\216\227\370lO\357\361=\307\343\233n\307\267\234\216\357+9\276\337p|\273\335\370\206\303m\333v\017\331\370\216\3035\276\255\320\370n\233\361\203v\336\220$Fd|\263\305\370\256\002\343[\231\255\276\321\362\213\357d\360+\215\026\027\337g\304\002h\325\267Y\246\372\250<E"
+	.ascii	"m\361,\2137\256x(\025\377\224\342\235P\374z\342U\023\337T\342"
+	.ascii	"\231H|1\367\325\b\240\210\024\r\301\203\202x\005\037\002gK\216"
+	.ascii	"\217=I\336s\203H\216\217\030g\241qI\003\036p\234\304Yx\344\275"
+	.ascii	"%n4gvx<F\335F\246\210Xj\344)3\375\351\2749H\237\222\031\340\305"
+	.ascii	"A\366\224a,\321\207,\321\2450v\343\325Tc\205cQ\224\214\005\t"
+	.ascii	"\263\332Z\0306!\241\367\230m&\344>%\016\312\235\331j\263\240"
+	.ascii	"(\237\036\037V!13\350C\026\350C\354,\017\276\303\232\342\226"
+	.ascii	"\362\374\274q\2519S\357\035\217\276\035\307.\316\\m\346\320\035"
+	.ascii	"\367\035\3019n\315\227.\337\231\363\342\r$\211q\340\220\320\235"
+	.ascii	"\253\3778b\242\326[\231\272\272\217\027;\225\271Sc\\]\270\304"
+	.ascii	"\270\013\257K\023\337\352@.\006\262\313\342\265\263:\320\270"
+	.ascii	":0M\321VO]u\365\037\223]\375\207l\345\352\277\027\243B\262\236"
+	.ascii	"tr\365\034\027\353\204}\361\242\256\3037L\256\330\325\207\306"
+	.ascii	"\325\255\260`\234\247\005eK=\3235\352i\365b\"\026^\033U'U\237"
+	.ascii	"B\262\252\003\337\024\211\233\315q\f\231Q\r*:V\026]\252\350\275"
+	.ascii	"\367\225\302>\246\216\bX\007\200\202\250Q\034\211KjdfA\222\302"
+	.ascii	"\262\006\240\002!\242\252:\021\240\024\224\216\221@FDF\202\272"
+	.ascii	"\260\003\300\016\303\251\342\315\022\r5#\271U\357&\217U\202\242"
+	.ascii	"\322\251\254\354\341\261)\372\314@\246\005\305f\366*\0045\\\\"
+	.ascii	"\333\302\021\374\207\372\036b\332_\274\013\323 \243e\004\327"
+	.ascii	"\362\f\001)[3\003\036.\314\250]b\271\342\022\336\245\373\256"
+	.ascii	"\305\200\013\372\232-\273\271\325\371\327\302\352\261$:\316\024"
+	.ascii	"\277*\371\2424_/\272{2\006\230\\8\271\3732\373U9dr$U\340\365"
+	.ascii	",x\361\002g\007\004+J\300\020\020\032\263\330o\227\016\275\226"
+	.ascii	"\367\246\265\362\013Jz9\204\016\275\213\264\250~\257\233\261"
+	.ascii	"\2454\363\365E\363.,k\371\362\341\035\205vL\306\221d Y\353\341"
+	.ascii	"1\216\242\361\344\234\323nh\212\210\326u\024\201\024\313\256"
+	.ascii	"'\320\240\200J\2347\312p\344\362\375!\027\300'\323\242\272b\367"
+	.ascii	"\177\264A\324\f\277@\276\n"
+	.text
+	.section	.gnu.lto_.refs.c60ff4c304b43f03,"e",@progbits
+	.string	"(\265/\375`\242\001-\r"
+	.string	"\366%_8@\213\223\3063!vm\321\352^\247\3079\206aC:\206a\030\206a\030\206\261g\035\367P K>A>\243_}\330\003=m\230\326'\354\356\266\277\t\331\204\220-S\nB"
+	.string	"R"
+	.string	"V"
+	.ascii	"\232Y{\361R\274\324ky+K)\321J\244m\322N\221.\246\027\355k\250"
+	.ascii	"b\364\276\317i\361V\274\325\213Y1o\200\225b\235X-"
+	.string	"ke\243\345M\234\274\222\027\342mk{\247UZ\237u\255\223\036\204\354\224`gcOZHB\223\316\2548\237\266k\332\253vv\230\307\250\351s\021\300)-}%N+LX\225\260~PZ`\315X1\226V\221R\222J\222^3\002B\017\313\022\260hGe9*\272\241\254\006E1&[MtB\"\304\344\246\255f\nR\310\2718\247`y\310\201$\3309\207`\267|\340\303\300.\331c/\303\232B\027\275\214\035\313hr\300)Q\024\232\350\252\350\0269\036\241\315>\033\2734\273F\001\217\017\323U\251\261\274\352\214se\304\330\210I)m'\3236vN\354.\"\253\266\230i)\330^\002\372\306\007{g\007\353\207\246z\350\250\035$*\207\215u\303\206\252A\263f\320\250\030\230z\241Z-T:\302T\244Z\220\213~t4#\344\304H\264Q\nul@)\005\316i\004\316\251\221(\225YF\311"
+	.string	"\362\332~y\301\271\250G\026j\373L\037;\021\310\016"
+	.string	"\017#c\253@5\303"
+	.string	"\367)\215\275d\376\232"
+	.ascii	"\334\032z\215\200\026!rO\003F\242\231\rD\t\350\245Pz"
+	.text
+	.section	.gnu.lto_.decls.c60ff4c304b43f03,"e",@progbits
+	.string	"(\265/\375`\031=\005\361"
+	.ascii	"\372U}KV LA:\351\177U;\340\350Q}\356\250\244g\266\253=\313\t"
+	.ascii	"\241\230\355\307~\275\210<{&\037t;]\253\"\370\006u\215^\021Z"
+	.ascii	"\355$<2\332\347a\243\246\323\313\013\262\022\265>MR\236F\243"
+	.ascii	"U\026C\021\324\373u\016\356\263\0075f\365dQ4\273\211\224)\342"
+	.ascii	"\003\244\004\330\004=B>\303{\f\345\200\321\234\311p\231\007\213"
+	.ascii	"\236\367\331_\177\320\263)\352\231\003a\032\030\310\034\b\337"
+	.ascii	"P\225G\f\217a\350\3418og\312\031\034nm\337GT\031j\016'|w\251"
+	.ascii	" \232J}\037\251g4\352\231N\365\200\323\324\263S=\337P\377\314"
+	.ascii	"b\263\244,\227\260\\\260\363\244r\252s\343\24403\035m\351\202"
+	.ascii	"\3172$e\332\236\351\330\214\255\344d\335\273\274\367RP\303\226"
+	.ascii	"\246\345\266\345*>\303-*\250\266\266g%\365\\\306r\234\306l\251"
+	.ascii	"\031SUr\206\225\307I>8\301r\f"
+	.string	"\205\247\f\225<\327\310\016\207\363\336'\025\236\3438\206>\341\267\373<\357er\357=\b\277\t9f\302n(\220\230wy\366\204\203\034]\220\316D\357}\212\020\341#\302\372\03025E\265\034\205\341\030z\001K\371\007'\236*\223\3342\035\300\"\200}m\357\202z\276@\310\201|\201\360*\250\314\343\306Nr\220\206\0046i\313m\266\r\207\324\226\266'A\205r\223\377\327\207\237\204\034\315\265\375\b*\253\261\022\206\206\340%\3473F\273\315\362y\321\356}\356\344\024Q\265ai\373\020\324\t\262\334\023\277Q\317!\204;\034B\370VAp\217\320\326q\217\260\347r\217\260\335\270\203\220k0qF\322A\310\264z\336\035\025P\312\223W[\017\334\341\b\227\205H\225dd\335\265{\237\033t\322p1\032k\373'\367\bU\356 Lk232\022C*\227\206\205\271\360\221b\200\250\001#\255\236\321?R\275A\224"
+	.string	"6H:\004~\253\342ofCE\365S\247\370\340\244\200\255\023\177\372"
+	.string	"+*\034\013\n\340#\242\233\2444\370S\002t\200\251\227\002\300\375s\005\177\177\240T\200\237A"
+	.ascii	"`G\003|\256"
+	.string	"\001N\372\b\277\235\200\006\366\204\237w\330&\255t\262Y{\317oGh\r\\\020\\\347\267\b\260'6PP\242y~\206\361\267\207\0224\t\254\316\355\237\006\246\035\347O\221\264\b\236S\017\376i\337\317E:\004?Sz\006!\035\343\347\036-\203\330\327\372\363\212\237\003\360\263\212\237C\374L\201\2371\370\031\003?\023\340g\027~\336\340g\013\374\314A\005~\376\360\263\006~\316\340\347\013\374\314\302\006\370\205\026!\206w\360\247e~~\200\n'\240\360\346\207\177j\3270\374\346O\225,\261\005I\037R\234\031\232\2105`\001\030\2455\357\360w \225)\377\235\374\227\373/\245\223\177\017\375-\304\341o45\177zv\341\237\"y\341m\347O\271z\305\213\237/h\312\300=\374i\216\253\177z\303\251\251Sp\361\234?\215\372\273\305\337@\177\023\377\336\300\337\025\370[\205\277\017\3607\b\177{\360w\007\177\217\370\273"
+	.ascii	"\177s\360\267\006\177\203\370\033\203\277?\374m\301\337\024\374"
+	.ascii	"\335\363\267\360\347\300\237\321~~\376\374\3673\331\317q?\203"
+	.ascii	"\375\234\346g\275\237\301\374\334\345\347-?\333\375\214\345\347"
+	.ascii	"+?\313\375\374\366\263\333\317m?\257\375\234\366\263\331\317"
+	.ascii	"F~\026\3739\354g\037?\357\370y\353\347\346\317W?[\375L\365\363"
+	.ascii	"\324\317R?;\375\334\364\363\322\317I?\037\375l\364\263\362\347"
+	.ascii	"\022\374<\202\237C\360\237\205\237;\374\314\201\237#\3603\321"
+	.ascii	"\317\r\370y\204\377U~6\361\263\210\377V~F\376\f\202\237[\374"
+	.ascii	"\234\376\f\364\237\203\377\024\374l\363\363\317\177\300\377y"
+	.ascii	"\377\227\374\234\363\037\315\377\r\376\277\360_\002?w\340g\026"
+	.ascii	"?\257\3603\t?\247\370\331\001?3\340\347\005\374\214\342\347\003"
+	.ascii	"\374,\302\317'~\016\341g\020~\376\340\347\021?\033\340\277\212"
+	.ascii	"\377X\376\327\375\277\362\237\356\177\331\177\030\376\317\375"
+	.ascii	"\017\021\030\030\030\370\353\304\37566\376\r\250\002\3574\335"
+	.ascii	"\247>/T\r\327\025+f\210\277\371\336}\335\267\267D\354p\226\306"
+	.ascii	"\023#V\332^x\325\277\177\341-b\336{\245\202\317\3134\3129\007"
+	.ascii	"Y\207S\326\340\246\377\001\020\303\363*\351\374\314\250aN\212"
+	.ascii	"l\034\304\375\353\356]j)\035\240\025\265\324\252RB\323\272\312"
+	.ascii	"%\020\345\006\346\325R*\241\335\273\341.\227J\023\262\356\006"
+	.ascii	"%\264\033u\217\262D\361}j)\3572\353n\270\313[\004Bi\251\025\245"
+	.ascii	"\204V\024\265A\tM+\352\242i]\236\273,b.-/s\303E\323\322\273h"
+	.ascii	"YQ<JhYQJhZ6\030\211\322\030g\224\025\277-#,Diy\237\234\232EL"
+	.ascii	"\236:\245g\326\365r/\257!]\246\006\3676\263\230^\212\252\330"
+	.ascii	"\315\250\356\311\210IQ\026?\357\275\0258\031me\335e\235\322\220"
+	.ascii	"\254{\207\030\275\270N!(\237u\327\213\353\224:\232W\006\322\275"
+	.ascii	"\0268\335\253\344[w\357U\336{k\230\315\347\275W<JN'\247{\255"
+	.ascii	"|\234nS\371\004\351\336^\003\343\026\245\204\266\225e\342\211"
+	.ascii	"\032\232\363&=\225\354\274^\264\230*\232\322\354\312(\243:\243"
+	.ascii	"f\220i\333gl\270\224\271\261\366V\006\332eZ\017\307\210Ip\214"
+	.ascii	"\214^\357P\222D\254m\036_9\003\345\332>\350C\025\303\320\036"
+	.ascii	"\323_\336=\246\3014\336\260\350y\2255\320\013\206,*\242\310\327"
+	.ascii	"$\305\3327^{\341(\333|\341s\342\326\266\303\230x\337\351\304"
+	.ascii	"u\345\265\r@0I\275\355S\355\345\036.\fm.\r\226\302\363*o\214"
+	.ascii	"\234\222\232\321\313d\216\270\275{B\225\301=\265m\273\003\\;"
+	.ascii	"\247]g\271M\222\245\223\026QYq\202e\312\213\363F\225\272+He\300"
+	.ascii	"\302\264m\272\032 u`}q\352\031m\316\205?\032i\260\374\242R\372"
+	.ascii	"\255\2514\224\216\353(m\245\345\032\256\247t\025\206\366\\?\271"
+	.ascii	"C[\312;\301}\355\204\353\254\0260\346\2277\267\200\300\271~z"
+	.ascii	"\201\017\313/"
+	.string	"z7g\327\364\244\347\332\255\231\206\351\275X}O\332X\217\353\326Lx\003\004anK\311y7\327i[L\026jK\025\222\217M\257m\333\341,FO\315\262&L\250`\221)\3336\233\r\232\251\202j{\333C=\227\241\335\255\365\222Vk%\fm\250\345$\235\206\347d-\3146\264\271W\013\214\323\004\264\255\236\032\204\361\021!B\204\320\n\027\032\265\033{[\245\336\336\263^\n\311d\031\323J\302l8U\222\370I1{\222\270{M\317\345\327\022\bX#\351\032td\231\023{\n\001\211\320X:Rf\001\232\222\270.\373\233\254\215\034\256\207RVL|m\203YQ\212D\205UG}lc\034\250K(leD\230j\214H\331Z\243\201\255\334<q\002\371!\346\024u\252{\016\361\321\t\343g\205.\f\f\211\215\036`m\337`\177;[H\373\330i\343\252Cj\213\303N\356 l &\336Avn"
+	.ascii	"QZ\265\355\341\016?|X- 2j\370\370J\215\340Emi\313m\313\240\017"
+	.ascii	"\035Vc\312\314\320\335\341\261\336\022\256+e\254%\215\263\255"
+	.ascii	"\370\234v\\\230m\270\344\271K\2561\335\325<\032G\357\350\254"
+	.ascii	"nv\215\326\321^\335\243s4Vo\365U\333\350\033\255\305\320\346"
+	.ascii	"\372\233\252\253\226a\274\364e\275\341\362y\243n\270\344\260"
+	.ascii	"\374\2424\230`\371"
+	.string	"E\3234\027\363q4}\272\251IiV\222x\271\223\324\2149\001\322\0261y\367^\273-\321;.\356\343@\256\263\272\351\026*K\023O=\305uV\317+u\223\326\004\313/Z\366%\r\f\bG\355\204\264\305I\031W+{\211\002\211i\223t\024\207\326\\\f\206\331\270n\355Z\256/X~c\367>E\370\210P\221w\2467"
+	.ascii	"\373\024\252\006\357\226>\247f\030\231\332\341\303\346I\237\030"
+	.ascii	"\215\266\315\354\250\267TC\335\226\n!\353\336\242\226\332\361"
+	.ascii	"\273\267h\2079\003\346\f,\331V\220%F\324\247A\324\226\201E\212"
+	.ascii	"\022\244\266-\243\2310\240\026F\246m3u/u\323\233\251\225r\226"
+	.ascii	"\317f\262\367\0261g0d\316 \b\367\243\350Lh\237z\251\215\304l"
+	.ascii	"C\031ZoXz7b:\276\206\340P\377^\266\221\020\220L\332\223.z\033"
+	.ascii	"]L\316\275\037\206epyi\332\376\f\263\375\267a\001\327#\332\366"
+	.ascii	")\225\372\024Ie?\376c\250\017\003>\313\254\021\225\031\315@\265"
+	.ascii	"\0047\220}\204\357<\365]\247z\300\0017a\\hD\304\324w\220\204"
+	.ascii	"**\252\255=;^\017\301\223\241\327\326&9\234U\227h\2275K\351\266"
+	.ascii	"\354\214\332\332\032,\022\206~\316>?|K\202\316\001Q_\002\376"
+	.ascii	"\234\320\032\271-{\303\342\322\332A\266\204\213\rg\333o\310\241"
+	.ascii	"~\303\225\230\230%\302I.\224\260K\253\007U\264\306\213\214\322"
+	.ascii	"\214\206[\"Q\330\360\274B\3540\251\355\031\365\251\007\003\263"
+	.ascii	"a>Yi\227,]\314\261{\255B\250UaE\226\302\330\354\235\224@?9\325"
+	.ascii	"\006\261A\254\323F/\004\221\253\032kN{N\216\336|\231!\3458\362"
+	.ascii	"\343\207\017\021'a\\\021\rR^_\366k\211\347\206\227W\272\366!"
+	.ascii	"l-\251\031\335\352\232\3013\303\352\260:l\227z\361\360\230\272"
+	.ascii	"\250\260v\334v1\333\316\223\026%ym-\027\240\226V[Rs,e>y\242\242"
+	.ascii	"\305f\331\254\364\017\017\232\324\034\323i\242T\325\245\r\013"
+	.ascii	"+]#s\342x\311\310J\362\264M\333\274Mx\344ui\235\211m\331\032"
+	.ascii	"\266\206\275\302\263\341\314\361R5W\305^1\345\245\331A\262U\266"
+	.ascii	"\312\"9=%5\243\266\355-j\nO\375\255\022C\255\222\245\301\201"
+	.ascii	"\311\302\026\233\245\361\333%\313d\247\202pO\362\304\264\235"
+	.ascii	"!\0055\306\325\366\303*\352A\200\342\271wk\315i\231\266\251\365"
+	.ascii	"\206E[H\222\232R6\212\241\226ie\334:\331'\021\"|\206]YH\200B"
+	.ascii	"\373\341\023U\345\247\372\241Se\036w\230\303*\257\264H\355\254"
+	.ascii	"asZ\312\273V\315\0208G\234\244)\272E\262G\\y\177~\366\310.{\260"
+	.ascii	"\251-\363\236:X\2604\241\326\250\277\b\333\244h \r\215\002\003"
+	.ascii	"\3235\276-J\214H\231\322\327\227\376\205\361\221\324\034\263"
+	.ascii	"dn\224\275\371=\375\263^w4\302\350\fQ\313\224I\323\250\367\013"
+	.ascii	"\022\234+\"J}i\364i\032f_\017\267\266)\232\326\002\242M\214k"
+	.ascii	"/\370\246\304\341\264wF\315kR&\207\231\246S\227\302\340q\231"
+	.ascii	"\341\241\336\335\245z\352\005\262\243\206e\206V\336S\275>\223"
+	.ascii	"\305\005G:\306\002\253\256)\351\230T\f\230Y\217\032\315\226\352"
+	.ascii	"\335\220\253k\233\342\351T\251O\275p\n\206\241)\030\216\366\363"
+	.ascii	"2E\350KjFq\304\234t\210\001T\317\034\355\322\245\367>\306y\267"
+	.ascii	"eK\357\331(\024;\273\245\244f\224\227\230\360\314\240\251X\260"
+	.ascii	"\244W\266\2609\231\316\30012\225\216.\275\"L#KjF\207OM`b\256"
+	.ascii	"\314\345\230;\013\242>\245\302i\025hZ\245}\370<\257T\013x9[\352"
+	.ascii	"\271}\b\243\244rQ\32288\2704N\205\376\251E\270 \251\232\3624"
+	.ascii	"\256f\355/\354\254m*\245\265\250rI\240l01IA\301j\373\234)\365"
+	.ascii	"8\200oo[\256\354[\035\337\0242nni\033\337\233f\210\220\2513_"
+	.ascii	"T&L\322\266\024\266\256\f\243\252\344\2144y\332\326p|@\312\340"
+	.ascii	"\314-Y\362\207\323\246*Q\222\256\361e\246vN\222\232c\352\225"
+	.ascii	")\246\255\237y\272\226e\b\220%ggi\332Y\372DCK\237\2522L\025g"
+	.ascii	"\r\027\221\2602m\217\223\245\376f\357Hjv$}\326PC\372d\266\"B"
+	.ascii	"\243\260\247\260\266\351\223\217\230\216\262\310\251\277\021"
+	.ascii	"#\222\032!\222\222\215\215\245d_5\222\232\321\036\245\034\312"
+	.ascii	"\"O\311X/\310dK\263\322Z\340\242\f\271\321R\177\243$&\326\303"
+	.ascii	"\006\r\2204"
+	.string	"\fH\n\026\344AR0\276\314{\255F\200z\311\273VV!l\304\206\0249i\233\202q\211r\365\265M\235\255\245\246F\221\227\322\306\213z\2337\036\251\017\036\351\227\360^~fA1\275\274\322/Uy\327\343\351W\032\335\202\246\304\255\003\273\366\356\332\336\206L\275\215\r\365\251\016Nw\354PR\001U\017\260\260\322-\266\272J2 \204\264\245ZO\267\330\r\347\256\250L\256m\232\203\331\374\312x<i\233f\345\374)e\275\265Mqt\021\234+\345\022\265(5:\376\224\324\2544\233^\302\251\252&\222\331\325U\217\233=9\247\332\226\225\025\263Y\236\273\364\362\341\354.\300:\252\266W\217\250\250\230M\b\215\033\021\254\233\312rb75E\002>6(\250T\n\307I\230\244f4\225\322\251\202\3423\3236e\262\233\r\030 \02445>\234\240\251S3\361\363B\355\330}=G\274\246\206\372\021\23465\241"
+	.string	"\254iR\323%\246\343\300\234\300\026\220\274\277\244\244 b\216\216\332H\275\367v\001\342\224K\215R\243.\034j*4U\036\316>oT\215\321\217;\342B\261\300\300>a\326\037\264\377\230ng\313\207p\206\372F\323\321w\232\253P\361\202\026*\200!\364c\2234\026S\030\304\030b"
+	.string	"\021\223AE\024v\216C?=1\200\210\253\0130\206\206V"
+	.string	"*\302\310\001\002J\2213\024Z\205j\376\202\204\013c\361\230D\226X\201\210\202~\214\305\022G$Q\211\t\202\202\210\214\306!cM\222\305:C\021)\214a\350\370\"9d\254iA\\\203lrE\n\255B\302\277 \201,\361\323b\202\232\277 Q\002y\004\262"
+	.string	"9t\374)\n\tS$W\027"
+	.string	"\350\200c\343aE\005k\222\350\302:CQ\250\230\2041\201\236d\321\250\202\016\362\001\311\325\305\007\237$\022\271\032o\220,x\220+\326\035\344\005#\202\210%$W\0258\311\325\005O\322\270\376\034\327\026|6 \327 \030BD\025H\027\306b\262H\264\200\017\020qh\005\2415\211\214\241\")\303\312\202M\022y,\242p<\022\375\340\f{V\030\206\204V\027p\200\200R \215Eb\3228\244\203\034j!\347H\\\203J\270\321\240"
+	.string	"\037\220\253\013G\001pX]T\260\"\211x\206\353\261\207\002\017H$\217D\030$0H\256\310\026-&\200,\"\211$\030\207\212%\300\370`\202\320\320\021\205\344\317\032\264\252"
+	.string	"!\001"
+	.ascii	"\274p\201\0042@\376\024\223H\025D?A\304\037\n\214+\f\305\243"
+	.ascii	"\t'`\020#y,\232\200,\256\240SB\322\270\302\260\016\201\202\212"
+	.ascii	"D\036X]\360\260&\211@0V\2543\360\030c\0302!\007\306\212d\213"
+	.ascii	"\242\n\030\3045\005\016\377)\036W\343\352B}\b\"t \002\n\031j"
+	.ascii	"\216\"\001\036$\300\003\341Q$\300\204\211\004\210`B\275\b&\322"
+	.ascii	"$\213\017@H\341\270&\223E\b\f\035c\270\250 \371\027$J\030\207"
+	.ascii	"\204\204\206~0"
+	.string	"H\032\211\206~\202H\026B\304\243\213\241$\262\370\002'\006\361xL1\\Y"
+	.string	"\251p\003\264\006y\200h<\001Y\264\t\332\220d1\324\302\250B\t-~6p N\360\027A\304\344P\322\303\221\370\342\307\256BD\026>\200$\276\340\001\"$N\320\320\020\t,\202?\353\213\037\233\037#\021\n*r\005\320P\361\270\266"
+	.string	"\264#L\022\223\310a\214d\3618T<\266\360S\024\"\032c"
+	.string	"\355$Y\210`BE\246\320I\262\300Y\223\304\025z\220+\202\210F\027E\025<\311\024@\353\261\210\\MH\"\211A:k\320O\214\022V\027\304\343\nC\n\037\037b2h5A\210H\205\013c\021\206!!\017/\030\207\212I\242\237U\206\023d \nqH\262\210qL\032O\240\300j,\006\001\021W \017\317\340C0\326c\211\344\320\320\261\004N\222\005\212\244\261HT\203\034ja%Z\211@\240&Y\b?\200$&m\222\005r\305*TL\2527a\242\004\020+Xx\200\372C\342\270\006\021\001\255/~\220%\214E\242P\211\237#\262\004\t\020\310\025\311\024+\021P\315\324\226\035W\332\324\f-$\220\221\301\025\224\262]_`a\240\r\365\225\365\fz\305\315h\006\241\244\220\2020\247\264\r:\005\235R)\276L\024B\202p"
+	.ascii	"T=X\021yj\302\"TR\303R\024\223\235\322r\346\305\027\\\262a:\212"
+	.ascii	"4\265\r\032\005\215\202I*\f\235\252\004\221\036L:C\006eL\360"
+	.ascii	"(M\327\221\262\243\340r\347GW\224Q\267\2351R\245E\375\203Ei["
+	.ascii	"_%\021q\006\225\266\212\034\233_\360\322h\"\361\n\264\20053\232"
+	.ascii	"\334uI\327\266\312\314\376\236\315D\366\367\344\227\222\215P"
+	.ascii	"\343\261\244/.X\304M\254\210\017l\207\212\213\2201i\322/\325"
+	.ascii	"Yd\244\031%B\345K\331g\321\364\036TL]\323^_\020%8\256\264\325"
+	.ascii	"\323\263fl\206a\262\3200$z\255\246\312\334\232\321\003\323\005"
+	.ascii	"G\245\255%\303li\026\300\037\034\236\252\0353\244\353\302\305"
+	.ascii	"K\231j\301X0\026\217+\316\336\335\342-\361\222\353kk\303\034"
+	.ascii	"\356st[88|}\261R\236\214\364\355\360\002\035\326!\t\364j\313"
+	.ascii	"\205\313\t-\260\253\261 \027\031\036\034l\330\331Y-\036\304\300"
+	.ascii	"\300\256\242"
+	.string	"\\w7\203N\213\215\220\260-\031Q::\213\345L\234\275\347\305\b\210\255\273\305\302\367\310+H[{\305R\031~\201\022\366\265'\244\203\362\343\013\023\367\307\331*\234\304\t\206lH\2161:\354\334m\225\234\037{N\035TNF)\212\223\212\\\207\251K:\343\261\003\013X\025\266\333&lV\312\016\363^\0317]^\254+N\233$\032\230\350\334n\245\334\302\031w\250\251\265\265Q\330\253\214\232\022\024\253&\344\216\t`[\373\326\301\r\276\034~O\316#\313\017\261\266\315\207\023Z'Nob7\332\332\266\217\321ab\306\243\311$J\221\333#E,4\345\222s\225I.T\215\023*_|\321\253d\025\002\307\254\311\f\013\332-\364v\355\203\023\307S\307h\340R\324\326*\371\320\312\312[^\232U\373m\002\205\230\250\0034\344q\242K\225A\212\231\221\031I\222$\035s\024@ PL*\232N\227>\037\023"
+	.string	"\024\346C\262\034e\035BhdFD\244 IA*\313\032\324\355\305\231\205e\240\331a|!\314F\0036(Dj\260\002\225\220\037|\365N"
+	.string	"\202\243\211\276\005\365\220f\004\244f\2149B\270qTW\031aG\230\345\\v\245*\261\316\235\273\330#\223\221\334\235\240\037nh\325\2030\324\274\003\240H\273V>\260\265t\332"
+	.string	")\020\234\217v\223A\0275'\320\200\306\317\344\360\226\367\342\265\b\017\026\210\255\235\270\036%\3016\244\260\001`L\274;\036\032\231a\301\371)\335\214q\n\336\343\374\002m\205G\242\336\020G3\003\235\032\307>\316|\370\330\306\215"
+	.string	"\265]}\226\203\337\334U\026l:nz\270\001<\210>\264 F\023\271u(#\240\373\n\333\r\342\252\212\035\005=\021@-\037[\372K\271\r\356\237\216\214\324Q\327\373{\263\330\264=\r\231(]\304\360\324\313*)|\273\026\354\363\n\210"
+	.string	"VJ\336>\364\002\210F\201\264K"
+	.string	"{\016a\300\314\3144,\314o\253\212\264\244\022\037\0349\255q\215\232.\347\262\300\320\024\263m /U\312k\275\035\341U\304b\342\234g\0211 \372\206\365d\362\023\305.\003\374&\253\363\346mi\0170?q\352\231Nf\367\251Y\374\\\234\221\305\031G\367\2647\321\251\344.rS\241 \025\36288?\305\200\234\213\217\367s\357t\035\350\032\017\243m\370E\233\031\022\3141\364\302\322X\322\020a\nE\257|:"
+	.ascii	"\006\033\367\265\231\036\035\346}\276\205\332-\336$@\226\352"
+	.ascii	"\001\013\321\3350\204^\2138%*G\260\205/\004\027Q\343\350\265"
+	.ascii	">\304\201\304\020\025r1u|ja<\200\342|\207\322"
+	.string	"\325\006\030=X\223K\227\332\263\372\244Q\337\245`~\016 \n\027\257@`\357\273H\037\263x\254\213\377'(\260\220\222\320\244\254\345\305\031VBA\207\204_j\200\365\377\262&\205l\020z\214\276\361\006\376G\257\366\241$\337\215\203\316?\372\374w\354\016\312\330\340\300Q\260\363\363\t\324\314\331#\013\357\211)\275[H\355\343\242N\240\f\330\233\356PG\001\310\230\005-J5X>\252\241\023+\234\327\304\333\332\013\003d\001Bv\245\310\357J69\005\t\3201\352Zq\260b\227\036\350\217(Z\233S\267i\0302\362\276\235\234\372\t\306)\250\245V\241\377O\271\025\033z\253\266\005\225A\344W-c\215\212)\324\001\343~t\005Fa\315\026\243\320\373@`\022\277\272\013\036S\364'\266Kb\332\"Y\201\024J\273<\243U\201\372\225zk\315Sd\0174\005G\321\302\352\355\322FY\2516\321\345\336\254\216\276R"
+	.string	"pr\252\231\364e\335\254w\252ez\3341\255\366O\250g*\252\305i\377\216\346\267!^>\305\223\242\305\270\310\231\303B\317S\204\242m\005\337*\264\357\031\036\305\034\342\001h\257\241J_\315UEeB\027\215T"
+	.string	"Y\257T\250\322\272\321\371\315AZ0\021>C\3343\225\204\260\022b\330yV\317\332\3215\207c\356\364\320\221\363\311\321\266\272\202\030ID\316\023\365f\346\335\266\250\327\222\344\340\347\003\245\201;\241\2715\036\026\357\030\204\004\326\343\235\253\357\331\257\215\307\036kl\335~\215\257%iR\362\376R4\276\200\023U\"(K\247M4\177O\304\022\370dB\313\271\354\224Y\346\355\013\203{@\212F~\2115xMF\025\276\216\003\004\b\374-\313\236\3218\310s\346\265f\312)\314K\317\320~\342_\353$\275Y\267\374\211\352]\335\3568\241\212\215\357Kk\321[w]/\264a\274k\353\307\367\003_\361\324Sa\354Zp\224\251\f\250z\021"
+	.string	"\304F\317\231\370i\3501\271v\031\331\234\232\033\021{\027\2404\374\032*Tf}\177\331\301\035\033@\033\253\354\370"
+	.string	";0\353["
+	.string	"\335-\313\030p\223\254{\212\377;\251\211\347\376!\202\016\226\364\035\332B\370&@\257#~\032\213SY~\216\240_\241c\344\222[A\232F3\b;1<\222\350\033\361\247%@\342\314\372\214\310r\350\3405!O\244\206!\337"
+	.ascii	"\037\354\201\223S\247\326\no/\233h+\\\313\356\263\331\333\267"
+	.ascii	"\327?\344\361\366j"
+	.string	"J\307\256\347x\177\f\225\351\004\245k^\246\r\\\336\340\326\211\364\027\026\377@cF\335\242\354&7\341\326\367\361f\210\221S\023+\032\332)_\027\233]#\223-\303\315\031"
+	.string	"\223\267R8\215\263\241\365\003\317\207\377\216\210d\255\2528\f\206\216G\215$\017 \030\361?\217\036\220\036\361\237\321\316r\276\324\371Ip\033\2758\333\0218x\254\222\333\223\350\217\031\004s\300\312\274\222\201\323]\304\250hU\341\340\372k\276\017#\270~"
+	.ascii	"\213\345f`\250&\236q\005\321\030\340\t\354\357\245\376\201j\002"
+	.ascii	"P\215J\002\230\373C\003\210\352!\210\370\034\275&\226f\243\025"
+	.ascii	"CS+\276X\301@\250\372>\220$@S\235\323P\202Fm\350\2360\213e\351"
+	.ascii	"\220\346v\253D\3123\177@\221\340{G\303\013\303\361\323>\033\255"
+	.ascii	"\330fn\215O6\300\212\347\251\264\356\230\373\007!D\3266\261."
+	.ascii	"\r,\030\020Yk5\275\337\030\fL\031**\"KS\227oa\001\255\250}c\371"
+	.ascii	"{qnx\313\3737\306\n\262\t\3320\314\227\023\257\252\215)\227\376"
+	.ascii	"\215Hk\3773\346\311\200\256\240\027)\266\322!\362\2259\204\315"
+	.ascii	"\235\261\232"
+	.string	"\353\337C\007S\037\215\016z%'\233\005\236\340\334\242\233ac\223\310\311z\020\001\3759\321\305RY\232\221\210@)7O\347\321Kn*\250\243\2325J;vJ\027t*\037\022\3509\275\261\236\256\312;\bq|C\331\212\257\346B\330.!\221\372\310@N\2106\261\016x|\260F(\212t\372\376E/\213\356\324/u\321\360\033\251f\300\257\002\250\210\247e\331-d\206\372\212\246\227\260\306\322\304\342.\337\036\247\217\362\251\306k]\223\030\n\032\247\324(\001IN\001J\331\001u\004\302F\301\310\375\263R\354!GW;\273\211I\001\310\203\264.\217L\213%\021\251ud\023f\245aCQ\027\227\362\334I\262\035\370\211zP\276\303\215\030\3649J*\226\220\304\265\302=\025\217\326&)\264\324*|6r\254=B\340\004\027w\200\204[\002\235\327\227OF\267\n\303\245\351z\314\017\340\237\242\f\275\352gU>"
+	.string	"\372Kx@k\341\300\210\007\017\270P\001\243\202e\260\212\031\262\003\2627\257Y\257 1\331\327\257\273\370em\361\327\327\364\355/ ft!\315?\350\217\210\265\003\003\366\305\303\340\346\303\240\342P\374u\313\r\016"
+	.string	"\224\351\036\273\241\034\270\323\216T5\215\243\337\306\264\222W\341g\3771\007E\2264\354\256\237\365\311\201\223\021-M\037\266\024\247\245\300\201\302\234\370\021:\007S\324\207\343i`a9`\311\b\013\b*!\254'<\372\0171\236\221\261>\214\243\f\321\321\303\3024\226\253\266\221\022\"z\002\261\336\334\001u\366;\353\276A\"\330\237l\\\214\274_\314\241\254\035\350\206\327\002\364e(\007\272\3473K\362\355\307\201\242\345\035"
+	.ascii	"\200\245\375\376\036\304\001\3750\304\210s\027\231!\267\253\354"
+	.ascii	"\337\265\236\213\235+?\310\200a\275+p\310m\257\314\355?\321;"
+	.ascii	"(\242X\251\344c\253@\304\215\b\2256t\334\346B\242\215\275\327"
+	.ascii	"\366\227\243\346=\3528\006gl\204x\3730+\034\220\206\3265\271"
+	.ascii	"d\346\004"
+	.string	"\300\2040\327\371?z\203\007;\n\274b\234\313\346\216\241\335\f\004\004@\221\317\"Gq\200\332Y\364\300\017\206y\376{3\347\377\362re\224t-\272\335B\251\327\363\324\2453`\317DJ\207\211C\3642\212Q\223Y`\220\331\220\257?:K\002\016\0378J\234`\375\2564\332_\316\352\356\035\237\372W\267\364\2060\235[s/D\317\340\375#:aiQY\327\242\017\211}T\336\277\311\275\327m\227&\210\177\267\351\036`\257\336W}l\025\256\334\352\224/\373\315Z|\265\260g\364\267k\273\252V\223\2405_\374\314\324\233\244\232;\364Q\302O\022+\2761\372\335\273\323\334\3649k\002\300\337s;\315\323\315\243-\353\201c_\320\202\314\353\035\245\323\032\253\251CY7\002\377N1\343\225\367;N0<\002p\370\375x6\236kY|j\035\320\3444\237k/\031ab|\037\264j\273\374q\fA\346\314\330"
+	.string	"\303\371!\027{G\314\351\334c\374\226Mj\310S\232\033\332k\362-\347;\034\366uD\1772\272z?\343t\316q\315\271/.\037\315\363\353\342\313\003_~a\377\312\212\333\326\277\025']\213\314k\022\177\332M6LLf\263\344B\271\251\002\366\020\371xu\021\376@\2307\300n\264\340\347\227\211\267\320?1\377\302\036pn}\261\217x\254p\257\344\204y\001/\223Ww\265\275t\301E\375\307\031\213\267\265p!1\003zH\311\177\333\336h\337\327;\233`\357\201,\263<.\274vl\002c\243~k\177\202\260\355;\313\321\036\271i\207=\260s"
+	.string	"\336\005\361(\200\2561\327e\360d\251\177e\273\002^R\017`\361\303\2333\356[\275\3103V\372\240\331c\346\247^o\363l\310=\354\305\266\342\341\30251\367BIy\001\347`@\316\035\360\254\371}\366r\225\323\261\341\220-ZfG\260V\253\257~\333\347 6\021f/\365@|\303!g\364'\260\211\332\005k:sOt\323\214g\373\272\326\005g\313G\232s\222\232\265P\267\312\334\327\335s\367\024\356\376 \326\321\020O$\3370\177\334i\032\240\241\312\264X/:\362P\322J\373b\317\205\212I\030\246\260^\305K\304\357xN\375\236?N\2608]\247\373\252\366\246\311\"\201It\226\377\347\354~\364}\366\235\316\207\2306\320 \263\r\2156\326\276\371fA\253\343\352\033\\]\360t"
+	.ascii	"\364\021\202\347\373+/\323\360I\210\027\033\357H\377\216?\271"
+	.ascii	"\357\345/\370~7k\276\035=`\355\362\022\\\267=\364\345?\363O\321"
+	.ascii	"\373\017\367u<\264\030\247\366\016\330\246y.\372\335\303\207"
+	.ascii	"\256k\333nN6\325%\263cfw*[\233\r\236\370\276=\371Q\303\276\304"
+	.ascii	"\245\341\234y\362\225?\032\343\037\323\263\210\266\326.C4i\345"
+	.ascii	"\223\313\274\336\273\356U\312\255\303 ci\211\037\326\267\207"
+	.ascii	"2\206\004W@\345(\217\306\255\254F\013l\363v\274\211\371\177\376"
+	.ascii	"\313\365\017<X\3606\221t\335\264}\320\367;\377\367?\227\354\007"
+	.ascii	"\253#J\323\266\017\232y\213\365\360\"\376\262\324\367\036o\007"
+	.ascii	"\312\326ml\026=r]\003\371l\237\252_\214g \253\337\316\334\234"
+	.ascii	"\316\206\347&\r\355\324\272\002"
+	.text
+	.section	.gnu.lto_.symtab.c60ff4c304b43f03,"e",@progbits
+	.string	"checkFuncMovingSumExecutionTimeUs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\001"
+	.string	""
+	.string	"checkFuncMovingSumDeltaTimeUs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\001"
+	.string	""
+	.string	"checkFuncTotalExecutionTimeUs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\001"
+	.string	""
+	.string	"checkFuncMaxExecutionTimeUs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\001"
+	.string	""
+	.string	"queueClear"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\001"
+	.string	""
+	.string	"queueContains"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\001"
+	.string	""
+	.string	"queueAdd"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\001"
+	.string	""
+	.string	"queueRemove"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\001"
+	.string	""
+	.string	"queueFirst"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\001"
+	.string	""
+	.string	"queueNext"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\001"
+	.string	""
+	.string	"taskSystemLoad"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\001"
+	.string	""
+	.string	"averageSystemLoadPercent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\001"
+	.string	""
+	.string	"getCheckFuncInfo"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\001"
+	.string	""
+	.string	"getTaskInfo"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\001"
+	.string	""
+	.string	"rescheduleTask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\001"
+	.string	""
+	.string	"setTaskEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\001"
+	.string	""
+	.string	"getTaskDeltaTimeUs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\001"
+	.string	""
+	.string	"schedulerSetCalulateTaskStatistics"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\001"
+	.string	""
+	.string	"schedulerResetTaskStatistics"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\001"
+	.string	""
+	.string	"schedulerResetTaskMaxExecutionTime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\001"
+	.string	""
+	.string	"schedulerResetCheckFunctionMaxExecutionTime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\001"
+	.string	""
+	.string	"getTaskExecutionTimeHistogram"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\002"
+	.string	""
+	.string	"getTaskLatenessHistogram"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\002"
+	.string	""
+	.string	"getGyroPeriodJitterHistogram"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\002"
+	.string	""
+	.string	"schedulerResetTaskHistograms"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\002"
+	.string	""
+	.string	"schedulerInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\002"
+	.string	""
+	.string	"schedulerOptimizeRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \002"
+	.string	""
+	.string	"schedulerUseDeadlineQueue"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\002"
+	.string	""
+	.string	"schedulerExecuteTask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\002"
+	.string	""
+	.string	"scheduler"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\002"
+	.string	""
+	.string	"schedulerEnableGyro"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\002"
+	.string	""
+	.string	"getAverageSystemLoadPercent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\002"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\002"
+	.string	""
+	.string	"getTask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\002"
+	.string	""
+	.string	"histogramReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\002"
+	.string	""
+	.string	"histogramAdd"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\002"
+	.string	""
+	.string	"pidLoopReady"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\002"
+	.string	""
+	.string	"gyroFilterReady"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.c60ff4c304b43f03,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
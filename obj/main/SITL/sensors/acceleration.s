@@ -0,0 +1,1480 @@
+	.file	"acceleration.c"
+	.section	.gnu.lto_.profile.a99562ef6bafc67b,"e",@progbits
+	.string	"(\265/\375 \nQ"
+	.string	""
+	.string	"\006"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\036"
+	.string	"$"
+	.text
+	.section	.gnu.lto_.icf.a99562ef6bafc67b,"e",@progbits
+	.string	"(\265/\375`\032\002\275\r"
+	.string	"\326\222IC \253\2525w'\373\256`y@m\355{U\205d\245\307`\030&\005\352w\267\360|y\303\266a\301\"\204\343@"
+	.string	"Ab\005\001\004\001\f\255\3124M\263/3M\3234C\342\336\376[\356\275\267\224;\311\0355"
+	.string	"5"
+	.string	":"
+	.string	"$\346\261c4\331\020#\001?[/\312U{y!\202\t,\267\273\030\332)8\370\367g\257\336O\247\223\276\225\0132\025\355\246wwWPvj-\350&:\257\f\240z}z\303\235\f\370x:\234\315fs\325\254\261?d\036\267\217\233\233\333\3139@\006\004"
+	.ascii	"\3002\016"
+	.string	"\233/Z\310\265\334\314\361S\235g\355\322\023\316V\022K\362\207\356\345\240A\333?{\366l\357\334\361\034\330L\006$,gKz\230`\263\b\032\332\224\206\n\r :\361\201\n\344\034y*+\n\031D\223-\b-\224PxX\353H\b\355@\335E\271j\257\2152\002\206\031M\343N\216\251%\022\\\0022&\235.,\214\372=A\352\345\343\302>\372[ \305\224\262x\225\213\225*\026E\002\260\024P\334\315\320\346\242\315H\250\321%\241\242\232 #Ii\271\001\220\002*\"\352\001\021`I)wR{,\373\006\027&\b/vl^\252k\346f\212\223u\001\363y\367r\026\324\251\326\3761\236\302\304\231\355\316\362\206\335\253\216*\215R[k<\nWa\f\271~\017\316\343\023\344+\347\022nzZ\251\330O\3227\2216\357s\350W\341\004\303\360\323\371\214[\300s\003F\013L\203\314\007\345\242\3138\366\006\306"
+	.ascii	"f\03539\305\350;#\003J\006\225m\367\220\244;\006"
+	.text
+	.section	.gnu.lto_.ipa_sra.a99562ef6bafc67b,"e",@progbits
+	.string	"(\265/\375 \372]\004"
+	.string	"b\006\023\035\240'\351\377\377\377\377\317\f"
+	.string	""
+	.string	""
+	.string	"\021\377\377\337Y\243\267?\336\377\nk\315\221-S\n\236\030\364\366T\226\266\0357V\f\003\371\217hQ*6\261_#\352\260\233\2345\303\026J\302\203Z\240\232\307\277\217\310\001[.{\3667`$\032"
+	.string	"*\341c.JxXQ'\202j\274&\036\330\275\301BM\033`\347b,\251\266\227\302Ij"
+	.string	"\nvT\032\203\2050\216\035\030C\260\245\245"
+	.ascii	"U\225\312B\234\312\264\227\3406\320\006"
+	.text
+	.section	.gnu.lto_.inline.a99562ef6bafc67b,"e",@progbits
+	.string	"(\265/\375`\021\003\375\016"
+	.string	"\206\223G? m\225\306\360N(\211\201\376\225\225\345c\204\254\2428\t\004(\215\315]a\235\247\220\264x\032"
+	.string	"\354\032\t\264\027\036\001\210"
+	.string	"\t\020\3527Gk\330I\377\322\327T\274]\377\177\361\350\023)w\n4"
+	.string	"4"
+	.string	"7"
+	.string	"{2\236k\247\037\01600\260\353\tE\201\bTk{/\035\214@\300!$_\275\224"
+	.string	"+@"
+	.ascii	"\344\230\347()\354\356\344E\252\371\221\224\273\273\221\257X"
+	.ascii	"\213\004:\007\316\201\027\315\323\226,\346\212{\312\013\273\373"
+	.ascii	"k\315.\312,\251d\314Wr\333Nm\355\004\220\035R\254\tq\225 \004"
+	.ascii	"\t\312w\252\222\251JDPr\3465\031\215\002\363\347\316\247\031"
+	.ascii	"v\367\323\345kw7{\346@\210\037-\372\267\212-\b?N\0316\200}\236"
+	.ascii	"1.FZG\267\344\230\322bJ\020\273;\261\305\034\0309\360-\001\377"
+	.ascii	"o\0012\222tc\251\262G\250K\f\025,x\320\310\007\3044\3146wh\""
+	.ascii	"\002Tb\322W\212\025^\346\330\030\351\240\277h_\370`\006\372d"
+	.ascii	"<\036\275\334\360\241\"\204\316\bX\250!E\251\204Dd\026\024$\315"
+	.ascii	"\030p\"2Uf\007\022 UE\203A$\200&\252\241\211\013\013\3539\300"
+	.ascii	"w\212\203\036\301\252l%\307\352\032\201u5Z(\363j\245M[:\r\216"
+	.ascii	"\256q\202b\354\320\036]\332\267\327\020\206\026\3448\222B%\301"
+	.ascii	"\301\256\024\331i <\1775\367\230\336{\020\257+M\334\3134y\022"
+	.ascii	"[[\371dF\211\02332\330\004\001r!O.K:+\221[\306\225\207,5\322"
+	.ascii	"f\027r\304\026\267\215\362\360\306\b\023\250\\\312\253U\0248"
+	.ascii	"9\241M\254\250\314\370hw\330vv%H\2705\325^\327\177yp\323\263"
+	.ascii	"\252\304\301\3567\376\3136A\360\243+\246&\273\356\272y"
+	.text
+	.section	.gnu.lto_.jmpfuncs.a99562ef6bafc67b,"e",@progbits
+	.string	"(\265/\375`\314\001\375\t"
+	.string	"\202\217..`k\222\0160\fCE\223\200L\274\210D*\025\004A\302k\005a\247"
+	.ascii	"\242#\270\020Z\363("
+	.string	"\372\373\327\363r\277s\332\321f\344\357&\223\f\204\312\347\035\"\r\033C\345\316\nuL\t}\027H\005\322B\316\234\371\221J\216\271\033K\237Dz\274\276$~I\375\305kB\3456\245X\"\rQQ\377)\243\210\223\265\326\232\023\211D\200\350=t\200/\205< \r\240\002#0\373*Rk\345\3539~\343\001\213\325]0C\036\306u.\203\231!\317\255I\257I\235\233\232\242h\\\3476\230y\354j\2124\250\355\007\264_\007'\344\246$\233\232\222#R\033!4{\317S\200U\0018 `\242Q\354\314\003\233 \347\253\226\261\0045/\007m\243\005\005a@\021\013\266vy\201v\313\002ed^\256qQ\007\257O3\336^`\263\347\235$|\022 \357-\206=\230B\334\203\315\356\206\243\210\204$\305Y\222\2651 \2205\022\005:L\320\364\240\265V\217 f\016&\3305\240\331\003\007\216\276\362\327 2"
+	.ascii	"\347U\314\227\217\364s\001\306p8\214\276\337\241]\214\220\027"
+	.ascii	"!L\323IMj\300\r"
+	.text
+	.section	.gnu.lto_.pureconst.a99562ef6bafc67b,"e",@progbits
+	.string	"(\265/\375 >\361\001"
+	.string	":"
+	.string	""
+	.string	""
+	.string	"\023"
+	.ascii	"\232\004\001\232\004\007\232\004\017\230\004\021\231\004\030"
+	.ascii	"\232\004\031\232\004\032\204\004\033\232\004\034\270\004\035"
+	.ascii	"\230\004\036\230\004\037\231\004\"\230\004#\204\004$\230\004"
+	.ascii	"%\232\004&\230\004'\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.a99562ef6bafc67b,"e",@progbits
+	.string	"(\265/\375`\017\002\005\013"
+	.ascii	"\022\017,-`m2\034\226\023\004A@\0303\004A\020\344d\213\002kj"
+	.ascii	"\360^\212\260\2017%k\253\307\326K\t\330\270x0\325\fBC\236X\231"
+	.ascii	"Rr>@4\233\202%4B)\203P\217\275=\250\2036Dk\255\2169\307|c\220"
+	.ascii	"\306<cN\315?\333\317\334\263\365\f`!3\306\226\013\314(\225)l"
+	.ascii	"\226\340\026\033\301\313\345\300\314\244\222\r \222\3251r\262"
+	.ascii	"\226\310Z2\314;\333N\205WP\365\200\002J}\265\255\346\225-'@\235"
+	.ascii	"\226\3642\355f\256\331j\216ti+yf\0233\247\330N\314-\203v\232"
+	.ascii	",{\275t\227\332\244v\310\022\030\351L\002P\250\201\271s5RXPR"
+	.ascii	"Hc@\002b\224J\362\021@\265s\322\314\302$\355\006d`\225\352\222"
+	.ascii	"\006\234|\230\26723\212\254\367\340H_7\334\370\334R\033l\335"
+	.ascii	" \227\300s#\272\263\024\312)\342.\307\365W\233\313X\325\274\021"
+	.ascii	"*\226\307T#\035\353R`\251\312\020\"\31684a\327\017\332&\\\316"
+	.ascii	"\333\246#G\225\n&\376\226\310=\004Q\242QNn; |\347\330s\370B-"
+	.ascii	"\302\214\007\347bU\317\006\034\347\035\277\254(\022\005\001\252"
+	.ascii	"\n$\212\026Q\302\205\317\343fZ\366q\265\271\n\303\344D\257G\334"
+	.ascii	"\032S\230W\177\346\036\002)"
+	.text
+	.section	.gnu.lto_.lto.a99562ef6bafc67b,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_resetRollAndPitchTrims.41.a99562ef6bafc67b,"e",@progbits
+	.string	"(\265/\375`g"
+	.string	"e\t"
+	.string	"\226\321A< \005)\035 a\310\216\022\342I\300L\300A1\332VDA\3278\002\323\376P\b\301~\354>\026?c\203dN\230`jH"
+	.string	"\007\237\205\201\241\271 \343#\250a\3317\302m\311N)-"
+	.string	"/"
+	.string	"4"
+	.string	"\237\235\013h\237\026m\232\217\254\375\253\265\261\002`wi&r\361R\364\177\362\200\224\352t\271-\354\256eJ\325qg\267\215`\273\301\366M\3669\273\273\316V\366]\277\234\233GLA\315.G,\300\302\346\013\211\307\366\245\375\326M\304\273L\377\354\256f\\v\307\004+t>=~@\013\234\315Vv\370\200\2412\r_\3456\305[X\fX'\320\354\360\257\n\207l\213\247\\8\204\202\221!eF>}\223\366\271\201\300\224\330\240d\314\036O2\013\t!\311\253\020\022\\\311{\210\370\030F#\260~\314\201>\320+\211j7\3528ND\303\n\206_\027\322\317\023\221(WC\n:08\321UZ\002\301J=\343>\r"
+	.ascii	"2\2419\034\030.,\310\256S\t\267jBL\274\241\027n\301\220K\260"
+	.ascii	"\315j\n\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_accHasBeenCalibrated.43.a99562ef6bafc67b,"e",@progbits
+	.string	"(\265/\375`*"
+	.string	"\355\007"
+	.string	"\022\21766Pm\323\001$\243\2605\350/\346TX!\370VU\2317d\244\372\207\376\203%\203\330\206\317S=\313\361\324hbf\232\313\300K\254\235\017%\243~Vk\373\313\235R\2564\330\2748Tf=XUEI-\233\032fi\022\273\250\215\2542Mj\b<!\254Lr\346\314d\346\343\256\"\325\001N;\373\001\227\253\352?$\235\257\2078(\230\354\315\277y0r\304A\264\002\323n\005\303\307I\022\376\306\243':\360\336\243\337\271<^\001H\034<\331_\0075\303\276eUd\033Z!\364-\230\216\024\201\222]\320ieQb\211\303\266\307\3168a\301\343\355\337\bt\f\223\217\210\312\356'U\343\333\341\346\337\343\261tq\342\205(\0161\r\273k\350\205,n\275m\003\333\b\266G\002\f"
+	.ascii	"2\001\3138\343\350#0!\366K\3401\323\313\246}\256\341\217\021"
+	.ascii	"n\tA\302\2353\265\363\t"
+	.text
+	.section	.gnu.lto_accResetRollAndPitchTrims.44.a99562ef6bafc67b,"e",@progbits
+	.string	"(\265/\375`["
+	.string	"\315\b"
+	.string	"V\220<:@\3056\035\340z]\267$?0S\026\2519F\024d\016\355a2\212`Z\f\350\brC\304\370\030\032\325\263\034\323)q\\X\360\360\311\356D\333,\2752@\345o\373\357\235R*"
+	.string	"+"
+	.string	","
+	.string	"\363\2259\273\345\240\307\276\244Ra\202\332]*;\316=r\376E\027\360B\024\217\231\204\335u\364B\031\267\274\355\003\333\b\266S\001\243S\027C\033\004E\311a\377\262r\303\276dL,\005\341\356E\230\332\225i\002\261}\237\364\357\363\221\027N!\273[}\332\037\273z\377g\206\247\240\234\004\234"
+	.string	"\363\317\235\227\2527\377\374p\222\315\233O\037\374\b\204\377\361\351\b\211x\357s\340\023\230\317\177\217\"\026(\215\2764Y\345x,\rk\300\256\313\242\233V\267\f\333h\306\261:\364\3226\2521pu\3004\352\251U\243\025\330]t\005\022F"
+	.string	""
+	.string	"\235\004\371%\001\016"
+	.ascii	"2\003\302\260\306\302R\231\300\200\034(\030U)\201\020\260qM\354"
+	.ascii	"\016\221\001\025\342\345\np\351\026\355|\002"
+	.text
+	.section	.gnu.lto_pgResetFn_accelerometerConfig.46.a99562ef6bafc67b,"e",@progbits
+	.string	"(\265/\375`E"
+	.string	"\305\b"
+	.string	"\266\020>8@o\323\001"
+	.string	"\027\236\336\235c\035K\260E\352\260\365\264n\370,\373\023\332nYb2\210y\364\375Z\0130u\342\270:\254\360\357\207\016A\2104\315\353^\351J\233\354\235R+"
+	.string	"-"
+	.string	"/"
+	.string	"\004\327\247A\333\345\365c_\242\3228I\355.\225\036\007\037A\377#\017"
+	.string	"\2112\036\001\"v\327\021$\332\270\345m'\330~\260\275\022rd\277\364\307)QS/\007-\273\241U\314\262L\225\220\214\355G\373\"'\201/y>\260;R\241\354V\0067`\237\2567\270>\261\007\025\346\024\312\217\005\256p\331\0267\271\260\303g\201\t\325\301B\b\237\004\243\023M \276\347\372\\\b\2418H\2470\256\354\372\211\262\303\276\265\273\353\233\306e\234\217\333`\3264\\\267\341d\3366\261iZF?\257\373\270\355\243\334&\243\240\232\367Q\r\202\273\212\315\243\234\256\363h\246\206\267V\216l\245\004\013"
+	.ascii	"2\241\007\034\030.h<Y\0175/d,3\230w\t\240YM\001wy\321N2"
+	.text
+	.section	.gnu.lto_accelerometerConfig_Registry.50.a99562ef6bafc67b,"e",@progbits
+	.string	"(\265/\375 \247\345\004"
+	.string	"\324\bk"
+	.string	""
+	.string	""
+	.string	"0"
+	.string	"\005\001\212\001\202\200\200\374\342\203\307\202\037\030\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\366\007us\250\307\007uq"
+	.string	"\005\001\006'\001\020\005\001\006\035\001'\001\243\300"
+	.string	"?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\"./src/main/sensors/acceleration.c"
+	.string	"\004"
+	.ascii	"\237\n\013&\321)\212\274\001\024\001"
+	.text
+	.section	.gnu.lto_accDetect.57.a99562ef6bafc67b,"e",@progbits
+	.string	"(\265/\375`\247\003e\032"
+	.string	"Vp\251H\260XQ:\360\361\016}\211s \236x\024e\214~e\203Y!\371\272\216\t\203\30703!\034\257\200\357\006e\321\307zo\306\250\026p\0325\377\037\307|\341\360G\353R\2714\236\311\266\203\304\306\375\267F\b![\356\224\002\231"
+	.string	"\212"
+	.string	"\221"
+	.string	"BFN\265\356(\330\002\371\320\273#\020\037\2227 >\274\200!\307:\337\001\371\271\216\210-\251L\255;\327\376\360N\235\263V*r\024C\272S\307\257\235\365\035\034_\321\b\2764I\217\302\335\240\t\220\354(\271\021\034\216\251\332\031JH^\230\212"
+	.ascii	"\2354\202\2531G\272\274\336\357Q8\033T\303\222\242 \266)\222"
+	.ascii	"4\036"
+	.string	"\006\310\275\240\fj\255\357}\372\344`LJ\021\374\f\271\255r=TB\220\n\231U\356\305\334U\016\350s\264\251\265z\336r2\356\326m/\331\036a\257\213> .0\246\032\377\311\337\373\206_\320L\2606\323\320Zk\335\325\331\273\332\314\020\245E\210W\310>\223_\300y?\200\226\247\311+\335\343y\267\350\351\320\323\324\323;}\003?\022,3fB\257\326\2375h*\227\360\211\310\225~\373~\322{f\331V\242\2215\034\331\224d\024\254u7\341\241?\334\3509\177b\340\0374\t\326Z#<4\007\362\341\356Nr\316\243YU\253\217)\f\344C\006tN\373G_\222s&.N\240\326\273s\351R)\266\032\276\213\273+\212\261Y\371i\342\270s\337;\315\002\365\263=\361\3145\026W\007\345\266\371w\210\327\303\022^G\374\226H`z\346\031\213S\300\332+Z\314\337\276+\202vf\202=[\363\231~"
+	.ascii	"\013\217\0039\023t\242\253\363{W})\322D\336w\323\t`\305\365\261"
+	.ascii	"\253\030\b\201\250\300\235N\305\300\365\002\265j5\031\270\240"
+	.ascii	"\210<M\364\371Q\f$O\023\037\222 *\221\323Q\321\201\020\302\350"
+	.ascii	"\310Qk\355:l\0338o\265\212;\003,Z\211\023+\303\330L\204,D\254"
+	.ascii	"|\265(Q\276<\300`\257\001,b%\326"
+	.string	"\260\n72\0238\2572v\"\006\203\275\\\263R6\273\211\315\\7&^(\\\260r\346\252\320\300\262\024\261\322\205#\223\225.\326\256\016\235\256:L\331\350MQ\375\312Irm\263\263<,\325\264e*\346o\241\r\317\326\034D\351\341\264\032\377\273\2518nk}Z\253\200H\n\351K\317<3\244Z\035\223\324\321R]\037\273\024$\004E\376b\020\r}\245\246xLc\222\035[\302\377\376.A[\350\237>\256\317\225\323%\021G\250Q$\244\024C\212\020'\230\t\213\002Q\213\001`\002\231:3\017\021\200\315T3\3122\007\213\252@\3779\004\247d\t\374#\3711}\366\026\326\311\273\2152\305~\247k]\362\233L\246\005\232\276\234\364E\177y\371\367\210w\364v\034R\331\f7\266cC\210\016Z\210\237\312n<)2\370\020\214gV\242Vr\303\362\333\0201ry\321\204\035\021-\322o\300\207\211;\274"
+	.ascii	"\276\301\314\260\320\370t\271@\303\227\201\353rf\351\331\034"
+	.ascii	"ii\377\001e\201Ma\352\215\233~\345\371\253`\\\373\300\261\251"
+	.ascii	"t\233\340\007"
+	.text
+	.section	.gnu.lto_accInitFilters.58.a99562ef6bafc67b,"e",@progbits
+	.string	"(\265/\375`\365\002\215\026"
+	.string	"6\253\222I\300RN:\242\302!\020t\003-\3526\225\272N\007\213N:#}\313\207+\271\262\273$2w\013\004\320\225\225\347\340PY\267\225\350\267\266\343\210'\036\005A\351\b\026\032\034\277=\264\222\257\177\3679\n\023\226\020\262\211\334)\005\200"
+	.string	"s"
+	.string	"}"
+	.ascii	"\237W\361#\233#q\030ox\306\247\235\"\253\335\336\311\247\033"
+	.ascii	"\214\237$/\020~\202\037\020~\276e\033[\307{#\366NB:J=v\367\245"
+	.ascii	"\"\254\007{\267(m>\212\341\004U\332\370\342JI\225\r\335\356\346"
+	.ascii	"#\030\200\201/'\305\022"
+	.string	">\017\035T-\351v>\237\276'\250\301\363\323\332u\220 \200\335\207\253\310.\007$\331\335\033]\356\354p\244\024Wv\327R\267\353\271Y\267-d[\202-\177\004\276\0349\322\207\355\331\227h\306\335U\361\225\316B\203O\364iZM^\367\351\327t\362\220\272:\302\311\237\335\303\221\312\263/w\367\306\nd\217\034\351v\211\322!\2424\353I\367\030J\213S:\224\322\023\224\006AiUi)\245/\300@\017\032\027\246v=\374\200\354\214\tU\364\244\037\351\322\276\375\025\276\317\255$G59\241\260\332\335\b\343\247\375\024~\317\255S\324\353@L\r\365PS\357\273IT\214+\325\020T\227\252RN\206\252_|G\317\356\332\nrvq&\240>G\205#\177\226\252:y\344\254\256R\337\373\224\242\372\351\004\231\312\263\224g\372y'dh\210\262t\347Lg\351\001\022F,\365\237\356\202\306'2\206\227\227\360\223"
+	.ascii	"\216\037\234\374\201`\206\267\200A\270\261\233\243\3427\335)"
+	.ascii	"&\203\201\t?C\224\365\335]U\236i\302\353\203\002\267\331\006"
+	.ascii	"\030xk\221\321f\025d134\030K,\006s9\226\"S\233\325\300l\262\030"
+	.ascii	"Y,\006{\335l\265\233\214\354\366\222\231\301h\257\230\355\366"
+	.ascii	"J)qmFf{\325\324j\266W\253\207\273\002\331\350\243\324\325\f\234"
+	.ascii	"\342xT\236[C\341\210\316\241y\362QwP>\252\f:(.\370\250#z\023"
+	.ascii	"UK\271\020\b\244KC\025\325\236@A^g\222\234\336\330\237\272\211"
+	.ascii	"\\g[\346R,(7v\367\001\214G\265Xpq\t\0379 p\002!B\272\003\342"
+	.ascii	"\200\237\206$\345\242l[\353+Q\"{\347\2271\235Mt\350$.v\fo5ZY"
+	.ascii	"+\214\251\226\307\261\2122\301\340\246\340\273\035\3064\201z"
+	.ascii	"s\347\242\364;\262\263\376\r.L\210\375\207\362goT\230\237\f:"
+	.ascii	"\232\303\274#\225\323/SV-|\316\254T\004\363l\256\330\334Qq\341"
+	.ascii	"\364k\242s\214\360\005\334m}p\036`\217{0\004'A\331t\371\362)"
+	.ascii	"\347\351\261\2467\001\227\001"
+	.text
+	.section	.gnu.lto_accInit.59.a99562ef6bafc67b,"e",@progbits
+	.string	"(\265/\375`J\005\355\037"
+	.string	"\326\371\313H\200\334Q\007\033\336\222 \342\265k\327\217G\303h<\036\260\205+\021%\016$\340\372ac\267\030\216\203\264M\375\353\r;\313o!q\323!N\342\376\341^vr\376w\374\321\333A\250\f\016B\314\354D\335v\313\235RJ\001\263"
+	.string	"\256"
+	.string	"\277"
+	.string	"]\240\271n\332\230\021k\367*\255\245\271`U\312SWuc\2653\033q[u\026\343\230\364\225Qc\021\241\303\027\350\026\362\253\003\332\325\200\311\275\354%F]U\3247\351\305Mi\253\312\331\275K\005]\331\007\355\312K\364\235\271\221t\022\243\246Z\301\365\336\035C\242\334\273\\\300\r\320\256"
+	.string	":\347\354\352-\340\354\312\314\354"
+	.string	"\202\021\333^*\225\332\211\312x\225v\357r\367?\332\366Y\315w\313m\223\034\366\211\316\350\212K\"\271H&\271)\243\337L\300tE\206.yd\346\204\365\b\323Y\355\310d\321\335\326s\357e?&a4\333\232\231Sf\026\301\\m\237[\352\"E\305mE\305\005\004\312\024\030\372K\003\025/\363j\2003o\340\340}\364G\340E\003\254\330SXt\310\031\273\367v\020\356\340\207\226\002B\307\034\242\271~n\224\367\336\b]\243\370\023\344\r\242\257q"
+	.ascii	"g&Q\342uh,\201\025\177\3108\336D\232\255\234\n\272\265\332\211"
+	.ascii	"O\247\274\227\330\244\267z\334A\272r\352\363>v\345\366\001\235"
+	.ascii	"\360>rg5\b\251\253v\226\364C\346e\321\277\211\271\315\373>\230"
+	.ascii	"\233\252\233gG\347\235u\354\234\353\252\346\233\306j\306\261"
+	.ascii	"\263\r;\337n\316(\352lC\235O\324\271\242\316&;\277\315\331O\347"
+	.ascii	"\350\267\226\023\255RN\031\302\207?\004\224~\331&m\f\357\343"
+	.ascii	"\355\r\330\036\375\3562\256Yj5\366)\215\355sQg\036xk5\032k\303"
+	.ascii	"\307\330\342h5\233\243\302X\332\317\204\26137:,\017\367\372\002"
+	.ascii	"C\372!\343z\264\031\2422d\252\030\232Z\r\242\257\231|\376\316"
+	.ascii	";\226\263\2626\323\235\217C2\353!G&\260\377\246\266Og}\023V_"
+	.ascii	"\216\034MS\203\371\322d\366\007\003\261NNg\327\372\265\253\314"
+	.ascii	"|\235w1\343\032!\355\305>\211u\027\013\205\336{m\021\033e\215"
+	.ascii	"|.*\214\332?\263\225j.vK\330w\035\311\260\235j-6\tz\357Q\004"
+	.ascii	"n,\235\305*\361\261`\341\354\372\001\302_*\364\363\001\005\361"
+	.ascii	"n\302_*\364\363\001\005\371\b\001"
+	.string	"\205A\242\036\216\212\f\251\220\347!\rB!\304\373\320\353\361p\270\307\340\007\004\022\362\206\322\240\264\327\343\355\202C\300\340/\r\356~@<\241]o(\270cp\200\201(\322\241\235\020\b\034\332\341\226\3046+\0060fYPL/v\356\221\314\234{\356!~\361\244\340\272g\266H\326\350}\264\371\316\352\236\243\0372\317\353\236\335\270\306\271\320\302v\324ob\333\215gG\026\361\214\035\313\274\205\205\302\241\231\261\2219\273\261\350\201\362\336\244\026\236d\221b\216d\241\270\301\225\230#\310\0262U\366;\337PSL\256\363\270G\332\363\366&\254\310$x]\250AD\204\024$\206)\221\t\0244)V\016\300\"\0212\252\007\021\0201e\310L\032-c\370\374\0222R\316\016\231\373p0%\340\334g\371$\334S\356\216\352G\002$;@\260\275\210'\244\207/_\317\334O^\204\316)\344\373\350\267Y\367wo\217\225"
+	.ascii	"\212!L\034^\216\217\033;\270\t=\321\217u\370\204\213\223'2\227"
+	.ascii	"\374\350v#m\301\001\376\037\316c3!\004e\337\016\035\311\227\237"
+	.ascii	"\031y5\246{\357A\330\026oc$V%\2556\2178\256\266\302~w\027s\030"
+	.ascii	">tE\007]\351\025\360P\254\216s\242\3537\222\277\344\327\335\007"
+	.ascii	"\346\033:\232U\244\"\214~\252\207\215\341\346\3409\230qkm\207"
+	.ascii	"\002\317\013\377\233\242g5"
+	.text
+	.section	.gnu.lto_accStartCalibration.60.a99562ef6bafc67b,"e",@progbits
+	.string	"(\265/\375 \356}\006"
+	.string	"2L-2pM\322\001\240\361\327!\246{`/h!\341\314\210\363\013\301mhj\241\326\220F\017\327N\331\241apo\274\376\347\352\202Nf\0230\216-\373\313\235Rv\224\tV,R|\n\3179\251\311\b\345\364d\233*\322BsQ6\n\201!\303\213\315\002alQ\265\327\016\302\204G\243\016V\210_ \237\343\035\027\037\303\r\230\365y\346c\2403V\361\241Q\242Y\037\273\312,\245\260\017\260\332\261u@b$Adw\3639Y\017\013\311\260\375\310\224M\362\352b\0172\037<Lv\267\251\305\251/\312\377\306\005&'\363\025p\260\273^\223\023q\353m\027\3306\260\275\t\b"
+	.ascii	"3\001\0038\343(\276\3055\221,\004\3742\004\270t\213v>\001"
+	.text
+	.section	.gnu.lto_accIsCalibrationComplete.61.a99562ef6bafc67b,"e",@progbits
+	.string	"(\265/\375`"
+	.string	""
+	.string	"\355\006"
+	.string	"bM03`k\323\001\320\002\356\204\211B\230\f:\024\273mo,\360\272\333\274\251f\366\265\332\001\377/\350\212\273f\323 H\030\027\007#\356yC`\361\240F\244L)~\023\013V\224)R\n\324{\223\273\"\274,\352rV5-\270\027/7!0d\240\242\243@\030\235d\333kGu \243\032\373\025\351\252\372\215G\363\214kT|\n7X\362\331#\337\"=\272\006<d\362co\230\324\b\373\320j\307vZ3}H\340\342\243\342\330\325>#\353\021y,l_l\211\017\020.\306\276Mh\257\3206\033\"\273\233S\211cO\314?\306\241\020\220\216\214\203y\002$\354\2563\3438\334z\333\005\266\rlC\004\t"
+	.ascii	"2\001#8c\216#D\250@\\\023\037#\362\022\"\207;gj\347\023"
+	.text
+	.section	.gnu.lto_performAcclerationCalibration.64.a99562ef6bafc67b,"e",@progbits
+	.string	"(\265/\375`~\007\205)"
+	.string	"zH\314\017Dp\350\315p\323\270Gx\"I\021\245\366Z:=\253lq\002^\345\300\275C\255x\234\3371\020\273\271@\025{I\t\301\3004\223"
+	.string	"\022 \250)\311A\341\022\232\036"
+	.string	"\261\342\351\222'\250\t\331{\357-e\222\001\345"
+	.string	"\330"
+	.string	"\364"
+	.ascii	"l\220?\356\307l\230\213Q\217\266fR+\255\324\fMl\317\272\256\016"
+	.ascii	"nn\206\364\346\201\362G\347\013\263\237\305\300\203&\306\227"
+	.ascii	"\227\315\370qO8\256\031\273\357r/4~\334\336\322\303\273\271K"
+	.ascii	"c\227w\263\344\355\356y\367Z\276E=\227\032JE\353\025\331\r2\353"
+	.ascii	"zlZ\t\351\315=\036\351\274\231\376\350\274\271\352\356\333\217"
+	.ascii	"\306"
+	.string	"\025m\342$\253\f\271\256\253\257\225l\277<~OV\257K\321\323,\233\325\375\330\023\274\001\"\026\255\256C`\244G\220\247\345\004\033\310\256\303\321\nR\366\346\262\344|\354\b\244hq1Z\026\255\353:T\314*#p\216\342\220\317]\224\255\233@^\226L^k~\f\025m\224Ho\216\340\341\025\257\270?\346Lw\326\210\305\2553za]\327eb\261\307w\367\335\255\262\273\032vQ\030\001\335\006\226\250\275\271\031\rk\217\232\2474\315\273\223\314\tS\023r\222\315u\360\335\355p4OD\306u]-\354\317|\355\304\036\354\346\006Q\2408o\232g\332`\201\273\320l\355F\331_Z\377\235\005\272\253\n 2;W<\267{\265\227\371\355\301\026*\212O\214:o\026\350\2239\203-3r\\BN\366\272\256V\335_\273\307!\377k#\331\355\361258\227?A\217\267\300\321\276K=^\245\036o\322\216W"
+	.ascii	"\217\027\251\307\033\200\307{\204\362\002@y\215P\336\242\035"
+	.ascii	"/\021\312;\204\362\n\241\274\275\035/O\307\273Cyu(o\212\362\242"
+	.ascii	":\336\023\3455S\3362\345\355\224\227Q\336C\030\260\346\315\212"
+	.ascii	"\344\272\362H\006Z\335\230jO\216\366\223\367`N\346\305\323\266"
+	.ascii	"\317\004\177\214\032@Q\033\261\r\316b,\276Y$G\324C\026\0165\021"
+	.ascii	"\362B=\004\350\275\026j\3425\331k]\334[\230\032\257\005\005Z"
+	.ascii	"\241k^\227lY\203\346vM`\t\227V\332\272F\313\260\304\206g_3'\332"
+	.ascii	"i\233lqO\351\037\264uqy\344\324\226\340x\234\245\277\223\251"
+	.ascii	"?v#2+E\374\304\351\303\324?;\207QAzmA\373kunf\203n7v\360\245"
+	.ascii	"\316\321\364\245~\034\231\333\025\317\275\\\327u=\037|\251\033"
+	.ascii	"\364\273\356\254ay\r\235N=N\006\3324\374mC\232\007\310\201\200"
+	.ascii	"\021l\352\274\311\300\bw\267\337\231\362\360\201O\374p\336<\033"
+	.ascii	"MR'\214+mwYA\235MCj\243#b\3108\007MB\007\2114;\316\223\220\021"
+	.ascii	"\016\261O\331f\037\213M7w\3515t\263i\006"
+	.string	"6\304\333\210Hj[\327\265\002\333\331\220(a\302\304y3A)\031\27728%\005\034\241\002\312\205\024\210\024T\030X\260\250\002\032-\024\004\252*)\027?`\024\213((\250\237/\b\254\nRE\005}TR\277)\037\0240\350\203\220`\253ZD\001}.\252\252\200>\336Q\370\257\215d\237\330\334\b{\270J}\244\223\311\377\316\244V\3523\221\2446\267\342\344t>\336U\217\250_|\342~\354\351\0346\"r{\206m\265\277\323\251\204\273\234(\264-\341!*\223&\343\252MX\b\207\005\\\034D}\262j\024u\n\237\250N){\031\205O\035,\354\343Ux\013H\n'\\:\257p\017\247\255p/\253\206qQ\315\262\025n.k\251b\352\226=X\215\363\346\275\234\305t \275\264\300\t\350\035\254\243d#\366Aj\001\375\254A\001\372\250\221\032\375\203\005E\035\343\034\277\233\355b`b\206\227\2651\216"
+	.string	"}3;\\"
+	.string	"\364Q\243\001\200\227\250a \350\224S\f\215\220\244\240\240\240i\r\220\002\221\2512z\021\20013V$\nT\231\266\003c\350\200\354\"\007/dd@\213\262v\026C\355\\D\240\374\246O\240h!-\324\342\264\301\274&\024\356z\034\252\377\351\367\263b\002HP'6\331\256G\001\266\255\300Xb\216*\355\033\177~\032\356yFN\247\336/\353\262\313\364!\020\256\271\315\275\007G\276\002B\344\345\302m\326\305\210\001q\275d\330\035\213C\301\322i\236z\236\323\r\347\177!\007\227_\346Q\255M\224\201s\203w\260Q/\220\205e\203!p\231\265c\311\200\"\026\237h\326\031\013\332\220\023D\271/\036\350\2061\367\263n<\350|A\267(\3703\215A\346\034\001\224\017\314\373/&\323\260R~F\244\376}"
+	.string	"\3477\360<\340a\332\261;?\300_o\223\275\bd\371\216\251\331\210HH[\232\312\307\257\fP\266\037\254G\301z\260\375'\375IB\224\022\271\342\310\277+\331\316\300\240\314\374"
+	.ascii	"Dr\330 \001\022\364\021\302\251%H\216=g\263\253\001\f\034\260"
+	.ascii	"8&q?\215\373L\335b.#1u\350\376\007"
+	.text
+	.section	.gnu.lto_performInflightAccelerationCalibration.65.a99562ef6bafc67b,"e",@progbits
+	.string	"(\265/\375`\b\re<"
+	.ascii	"\372a\250\025@@\350M\007\270\3721]1 \213_a\032\307\030$Gw\217"
+	.ascii	"f\2677\337\331K\001\233\035$l\020\243\001(\006\233y\206v65m\240"
+	.ascii	"\031\006\3572U\016(\206/\361\021\tm\262\367\336{\313\224R7\001"
+	.ascii	";\001N\001\375\373}\273\354w\353~\263\356\367\352~\253\356w\352"
+	.ascii	"~\347\366\373\331o/\341\220\300@\025\r\351\342\270\254/R\374"
+	.ascii	"G\255\373\342n|}\365\323O\273\231\355o\346\274\r\354n\332\216"
+	.ascii	"J\214\031\237\255\200B\333\036\270\332 ZW\251RoZ\343\\\356\207"
+	.ascii	"3\233m\342\371\321\355j\034.\2103;\352\215\r\331\026\307\361"
+	.ascii	"\353jw\220\356\327\325\374v\267\177\267\267\271\033\354oB\240"
+	.ascii	"\230b\2615N\350\30413Bc\265\2566\323\235VW[oZ]m\270\033\2213"
+	.ascii	"\2231\333\005J&\007\215\343\370*\253u\366\224\351\335>\354JA"
+	.ascii	"\340\373s[vU\227\322\374p;\373\3015\236\rq%\244\007S\007|u\034"
+	.ascii	"y\236\0312u*\363b\224\362@\366\203\025%Q\374\255\262\242\004"
+	.ascii	"\212\377\322\nD\240Q<\317\fJ\n|D&\350\311\273)\223\223t\302\033"
+	.ascii	"\"\337\262\037\262(9:\213\346+\331\233\261W\235x\364\245<\263"
+	.ascii	"()U\034\307\276\364*1fS>e\3429u\200\344\303D\351L,u\002t\345"
+	.ascii	"\220/\375\217\234\025\377\331\017q\034\367\033\317\224x3y\267"
+	.ascii	"Wu\267\210n \223\036\307q\274\224\2614T[\2325\205\304\376Q\312"
+	.ascii	"\346FOF\215B\270\"\241\3079\371\330\214\205\306F\271fD\302)\347"
+	.ascii	"\236"
+	.string	"\226\201\244\0372\321aB\322=\021^H\350q\030\272I8!-'\034\305\004\207\244\220\325\3255c\221\311E\337\324<H\317\001y\240\274\367\266[]UsPMN\231f?}\"8\237=i\016\252\305E\353r\316#|\362;\307\203\242y\250x7\252\2603.\"~\037\004\267\023^H\306q\254\241\233\205\337i\321\306q\214\301\016\220-\tN.\303\325\325\234/\254\3259\035\2573t\361\342\305\352\352\347\367.N\331wD\312\300\344\234\326\024\234k\365\034c\r!\261\177\324\355q\\\016W;\227\356\362z7\272\332\356\265\272\352\271\303\231HH\267#\361\373\272\231\305\317iq\034\017\351\214\245;\313\337\334\261\334\215\367\002\367\333*\370\255\200\375N\020\374F\360\373\256\372}S\271\337S\277\357\003\277o)\367\333@\373]\340\367M\340\367\035\005\374\206b\277\237\330\357\001\356\267\223\373-\300\375nr\277\003\270\337"
+	.string	"\332o&\366{\251\375V\372}\007\337o\340\373\375\276\037Q\001Y)d\220|6U\357\315\b\235M\362\313hup>\031\001\031k\016O\371\326\224\305\204\371/^\232\242\0012\227-\277&l?\031 \007\233|\224u"
+	.string	"r\026\241\225\363\323`lM%%\375\025a\373V"
+	.ascii	"\344\fkuT\2302\333\274\213\036!\374\353\360\332\332\ro\201\273"
+	.ascii	"\274\033\233G#:Q>\261<\244"
+	.string	"\035\312\027x\214\r70\310\266'\221\306\332\217\366G\032p\030x\314\0305;\3503\352Y\326\346\347\\\353R\006{&K\331\227\336@\315Nyt7\247\365\253\205\315\312\252\226\245\007\276 \037\351\005\371\263x3\213\236\2669mA\316\312N\006\3327\206,\n\3273\241\225\363\315blMEH>?\211Rf\233t\321#]w\177\202#M\367\3444\302g\004$\215\260M:6h0\223\301\313\245\344\217\271q\0210\007\263\217\365y\363/\003\221\305\027k:+\270\314\027\3413R\316\037\362DX\t\247\201\335`\267\325\3257[\255\325\271\371\227\177o\214\257\017^\266\223\334\234\233s\224\237\331\007.\306#\301K\247G\016)\253\007\210w#\210\325U\026M\016\333\323\211swEV\237\343mv+\3206\373\033o\320\214\023\315jNk\367a_>\272\3220\034_`+jx\355\370J!#G\326\215\033C0"
+	.string	"\355%!\307\360kG\027\330\214\0333\274\274\272\256\302\300\206a9f\204]\345\370\352\302q\345\005\026v%\001A\017u\314"
+	.ascii	"\273\3321\034\202]\275L\242g,\315u\346\0171\027\2256|7\214\004"
+	.ascii	".{7\266/\275\325\203d\026\345+\n\327\263O$\264\340\\\362\210"
+	.ascii	"\340&\021\032F\373\275-\005\206\376\020\354\004\n,"
+	.string	"E\212\234\247a\0245\331\236\203\334\341:\304\023r\266Ob\324\352p-\342\365\204\215\301\341\232\304\013\322\352v8\1774H\240\310\266\247U\316\003\204g\\\244 [e'\233\224 #\310\n\262*i\fL\361\373\246\274\037.\016p\225\357\003_\301\200\227 sX{\253\312\b\262*\211*W\355\321C\225\335\346 \345T\306sw O\311q\251|\300\356\216Tv\233z\321:\003\271N8Ug\304\226\024\201l \247xd\223\350\nd\251\265#\205\250L \253vch\212q\340e\013'*\237xK\"\335\334\274s\202\240\317;nl\311`N\353w\342P9F\317\245\301c\240rF\023\244\004>e\271\276>\347Z\007\344\247\354\0177 \263w}\242G\177\2352s\271\027\342\335\204\316\306\331\246\345!\231\306)c\335\341\005\201\025\250q8\250\030chD$HA\222\244\320\030q\005\304\020I\025\245\007\021"
+	.ascii	"\255c\214M\215(\2511l\0063\274%-\003e^X\305\331\345\242x\314"
+	.ascii	"\242\314\205\246\030\027\001[\245^\210`*\274\245\002\242\rXT"
+	.ascii	"\266xE\t\330\271\b\324F\354&Rw\013!\241M\356\334\215\352\224"
+	.ascii	"sB\035\233W\333A`\031\202\033\375\035O\201\271\241)\352\343M"
+	.ascii	"&\310\322\350\336E\003\253\317\201\323n\226\177*s\2522\271\021"
+	.ascii	"\311\036\fair\023\034\030\n\224w\345\307`u\237@:h-\210f\336\335"
+	.ascii	"rhv|\003%\325f\265*\374\264\212\253b\227=\324\030\312\354O\253"
+	.ascii	"\2669\033a\364\201[\304\257\276P\315\340\022srT*\266\340\321"
+	.ascii	"\310\354>\236H\257T\306\303\327<\004\231$\252\2473\302\300\303"
+	.ascii	"\005:\271]\340\251\373\321D\333\305\375\036\023\340\275?T(H-"
+	.ascii	"\306wr\273\232\327\237P\333\271\315\306\305\030R\213\341\035"
+	.ascii	"8\036{:\373\331\2679\bI)r\312\353/@#\307\233.\367\213w\204zr"
+	.ascii	"\b;\341\236\021\264\025\t\213\211X)`\246\351\017\276\033\267"
+	.ascii	"T\325\216;6a!!`\362A\355BJm\034\364\025\216\234.\205\t\007\251"
+	.ascii	"\344\251\353-_\357\224(\f\036\333P\b\0020\213\037\214\357\341"
+	.ascii	"b/P\026c\360\025\206\275q\2654l\"\245\022T0\0026E\317\334(l\235"
+	.ascii	"\211\n\315Tx\205#J\255%\220=\223t\214\340\371Q$u#\241\001\327"
+	.ascii	"=\323\013i~,U\326\001\326\306u\002\006Q\222z\230\355\374\005"
+	.ascii	"\341\264\230q\027\215\312i\313DG\330\331\037$\265\330\203\005"
+	.ascii	"=\215\230\310\231\376'x\365\b:\350\213\345\200W\031&\006HH6\n"
+	.ascii	"3\267\212\033^\02116g\003J\215|Pe\263\327\256\316\227nw\255\247"
+	.ascii	"\376\223\032-\3733$5\224\177\267\202`\323f\370\0371Ri\241\213"
+	.ascii	"t\3049;F\364\032\252=)\211%\306b#\275\270\317%\002\253\260\034"
+	.ascii	"\316w\202\372)\243\242\006"
+	.text
+	.section	.gnu.lto_accUpdate.67.a99562ef6bafc67b,"e",@progbits
+	.string	"(\265/\375`*\001\315\r"
+	.string	"\306\031^D"
+	.string	"s\233\016\334"
+	.string	"t\007@\274\255"
+	.string	"v\375>\343 B\254\202\177\215D\025\004\266FI\0376\004\370\377\337\262Ix\333\240\335J\002\265$\322\213(\250F_j\345y\0244$\320\"km\362\030\364\244\355-S\nH"
+	.string	"H"
+	.string	"M"
+	.ascii	"U\201\217X\257\344\005X\257\374\331:\036\256\354g\310\230`R\273"
+	.ascii	"\213\305\022\337\367\311\3572\352\347\207\234D\227\027"
+	.string	"\312\243<\220b\003es\"\311\221\033#d\376r\345p*\251jJv\327\n\236<\334\325m;\260mb\037\f\177K\n\304\006G\025\373.\277\346\250?J\265F\365A\254\017a\212\207\206\035\273\035f|lLU\003\205\355olk\370\226\357.\030.\262\253\362\203\301\365\312\341u\265\257\342,\337Q\031\f\262+\"\005\215\335\020\201\023\\\017\242\335\335\350\013\226F\b/9J\332\303\034=\213\313\220\300Y\331\035\035\214\321\021\200\0215*\bQ\212\"\333\333_P\030`\177\356\242\003\200cw\027\300\274\205\005\377\304+{!=\030\262^=\232X\021\223\302\202\032\351\214\035\2224\222\260\003\336g\233'\0232\320f\022\201k\340\361tS\304{\240}\266\023\020\247\315\031\3128\316H\270n\003u\246\346\321\262\254\203y\263\3638\315\303\270\255\363\301\262\351a$\006\334U\320&\006\352\272\211m\302\221\351%\243H2\311"
+	.string	"\252\211v'\323\203\2261\031"
+	.ascii	"2\003\303\341\327X\270jI\317\024&\324\2550\317c!b\232\030 8`"
+	.ascii	"\b[\341z\271\304\306j\343\r\256\033\373\3215\240\030F\003\341"
+	.ascii	"75\005\356\005SS\202;\322\322\036\rL\355\001"
+	.text
+	.section	.gnu.lto_accGetAccumulationAverage.68.a99562ef6bafc67b,"e",@progbits
+	.string	"(\265/\375`\375\002}\027"
+	.string	"\226-\232F\260\332*\035\270\307\320\237\351pS\301\254\312\005\017\252?\345\206^k.\214\246bt\216\377\237\244G\223\250\260\275\366\013\365\035FJ\273\033\013\177J\177B\365a\317\312\362Q\264\217\330>\230#F\325%\215\354-wJ\001\210"
+	.string	"|"
+	.string	"\207"
+	.ascii	"\376\216\363x}\347\237\223j\325\371)R\353(\301\025\304S\217/"
+	.ascii	"\205\247\342\t\204\247\026.\274\f\373\230cQ@\267\273\371y\251"
+	.ascii	"u<m\r\357\347xO\330\302\036\n\351\\Q\302|[\354\241\027\017C3"
+	.ascii	"\274\317\335-\210JP\020\333\213\3239\240\326*\300vbR\250\265"
+	.ascii	"\336w\231\3026\223SF\207\363\025q.N\0049Pp\004\330h\323\301\224"
+	.ascii	"\031X\316\273\002\034-nR\206fj\255\2265\233\213[t\3331ls\260"
+	.ascii	"7@\247\337\363\016\301H\217\214\034\0367\231\f\332cL.\316\376"
+	.ascii	"\231|\331q\361\352\330\245\357~\222\245G\377\3352\357\335\242"
+	.ascii	")-J\351\020\225\016\2514\235\322\323\322;\245\345J\337\300\201"
+	.ascii	",3*>\035o\203\306\312\"\030\246J\241"
+	.string	"@7\376\373{\227\366{f\365\251s\306\n\237\035<\037}\237G~\217\373x\275\347$\257.\352Q\344tA\264\324ZM\247\326 \236&\230\322~\331#\333R:\006z*\226\320rf@\006G\f|\220\003\272\216\233\025\036/\342\372E@\030\330 \267\343\373GLm\213l\345\212N\302%mhO\3131\357'!\335pO\3031\223A\213\226\356\374\335\214\371\316= \206\246E&\2034'b\240Xk\305\340\013\371\220\032\177\347\324\254\020!\366\276ohq\253\362\005H&\203\273\265\326\330.\316\377k\255U\\\035\233\376\355\320\213bB\202\261\357s N\342\357\330e$\362\265S\337H\302\256U\t\324Ty@\265T$2\320\214\250\031\221J\241\b85\301\206\265\022\201j\251hT\251\024\352\344j\261\\6*\327\311f\205\2529\245Z\256\323\204\005f\201P\265N\"X\254\326\311c\375\fW\f\243\003\376"
+	.string	"\322\037\026\216<Z\317\310v\026\352\271(\247kr\003\224\246\313"
+	.ascii	"\220\244\265W\037\344k\273scw\2708%\347\235\302\270\005\361t"
+	.ascii	"9]\234G6\266\264\324\206h\272hSH\270h%\215\336\025\023\022\314"
+	.ascii	"=\306>\247#\\\264\245\r7 `\2021eF\0176F\340\262\204\211\316m"
+	.ascii	"u\214\351FR\006.\3662\272\032\035n\340&,k#E\003\327\273%9\237"
+	.ascii	"\f\354\335`W\"v\353\337kGV-\330{\347b\217\210WB8\"\005c\214n"
+	.ascii	"d5'\227\270K8{\241{\230\336q\354\004\352\302\022]\210aU\3127"
+	.ascii	"$\2636\003\201d\265\341\201\201\255\020\341\3450@\361\334\245"
+	.ascii	"\213\206\231\0263\370\0066\363 \300R\317\265\327\3224\rlA\001"
+	.text
+	.section	.gnu.lto_setAccelerationTrims.69.a99562ef6bafc67b,"e",@progbits
+	.string	"(\265/\375`4"
+	.string	"U\b"
+	.string	"&\220;7Po\322\001 yyXFA\235\347\252C\347\242\225l\ri\220\032\n-\313\255\241\326\375\330{\270\271f$q\200\310\324eT\321VU\312H!*|\202\310&{\247\024*"
+	.string	"-"
+	.string	"+"
+	.string	"\217\346l\230w\034{\360\321Bq\"\263\273\022n\234\373\343\374\223<\200T\022\375\0010\354\256\037\251tq\303\333N\260\335`\373\024\247\377U\002!/\245W\240\354Z\244f\026\025U<4\266\377\354\213|\204\373)\364\201]\223K\312n\247\340\205\353\321\335\013\254\307\353\004V\320\344\213e\0055\202\023~\320/\271I\310\357\260\004\350\235\364\350\203\254\307\007\214\030\220\214\321K\331\235\350A\r\373\325\356\256\241\311~Zu\230\234\332\331(\307\300\331\3063\267\017F5\b-\3130Y\351\254\036\255J\317\206udF\253\334 xFhT~\346\244R\323\355\253\r\t"
+	.ascii	"0\223\241\214i\3413l\234-\007C.\3016\253)\340./\332I\006"
+	.text
+	.section	.gnu.lto_applyAccelerometerTrimsDelta.70.a99562ef6bafc67b,"e",@progbits
+	.string	"(\265/\375`&\002\235\017"
+	.string	"V\\dC"
+	.string	"s\224\016\233\006B\234\325n\323pWY]\214,\352t\313\212\241\362\215\370}$:T\035\021\240\276\271&\013`\226@\2479\2133\263\341\337\275\032\307\223Ju,RK\"\224~,\327\377%\237\333J\231RM"
+	.string	"E"
+	.string	"Z"
+	.string	"B\326%\256\210\350\330~\332/q\023\246\207'\027\331]\301Tv]\007\214@{\264\353\002\262G\355\001\262G\233l\037w\261\366C\242\007J\nlw7\005q\323\323\344\377\3047)\325\205\247F\301\356:S\252\r\267\336v\001\333\r\354\034\021o=\332\202I>\365\350\233d\217\327\3038\304\004\tO\031\263]\250\324\017\3663\273\273\326\225\375\360\007\220i\217\246;\232\346dz\243i-\323\232Lg\232\216\232\316dZ5\235\231\276\210'l\251\236!fWC,,:X\033=L\210P\243\032w\032+3T4\372\021\322!\314TF\f\030/\236\372\0215\313hj\324\017\013\006\017\250\214Y5\343\242\373\313\253\305Hc\001\241\344-\257\326I\366\250\372\027\036\327\324\243\f\261\204\247t\tX6\205\257\030\221\330\273\212\022\003\257\335%A\361\024\240\003\240\222\210c"
+	.ascii	"\216\272\357\301\204P\251s\020\201\264@$\362\276\001\016\215"
+	.ascii	"\220\274\256\004\3728\021\027\n\2016\360\363@\022\007n\244\016"
+	.ascii	"4\332B\037\270\215\020\260W\201\373\266\222\347}[\307uzfuem\007"
+	.ascii	"\020\227\223\242\354\321\0348n\330\350\250\207\243\232v\364\323"
+	.ascii	"\262QN\215\3560\254, \260\202\231\032\355\"\241\02730\206\247"
+	.ascii	"\004\326\220\217{0\2763\211\356\r.\310\337\204\220\304\356\365"
+	.ascii	"bZ\003\006\016\361y\260\016\241 E\212\361b\304\342q9X+q1\027"
+	.ascii	"\344\005G\374\031J\276\035V2\212\305\270\206\342l\237\201\320"
+	.ascii	"\246\277L\350\275\315\372\353\320L\3266\373\024\350\345E\233"
+	.ascii	"\311"
+	.text
+	.section	.gnu.lto_accZero_saved.2.90.a99562ef6bafc67b,"e",@progbits
+	.string	"(\265/\375 )I\001"
+	.string	"\034"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\031\001"
+	.string	"\005\001\006\025\001\002?\202\210\200\030\1773\273\0014\273\001\274\001\273\001"
+	.text
+	.section	.gnu.lto_angleTrim_saved.1.91.a99562ef6bafc67b,"e",@progbits
+	.string	"(\265/\375 *=\001"
+	.string	"\370\035"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\031\001"
+	.string	"\005\001?\202\210\200\020\1773\273\0014\273\b}{\274\001"
+	.string	"\002"
+	.string	"_D\030"
+	.ascii	"\034"
+	.text
+	.section	.gnu.lto_accDetect.part.0.105.a99562ef6bafc67b,"e",@progbits
+	.string	"(\265/\375`\253\001\035\020"
+	.string	"\346]jH\360\2606\035x\276\350\253\006\205\303\340\362n\272\352#\373w\356\377\332\214fmp\237\204B\256\2355\270\205\033k\236F\315\203~U\365"
+	.string	"\217\023\002\226\374,>xe\346\334\342\201g\027,\346\203\216\363\231\257\316\264\311\336)\005S"
+	.string	"X"
+	.string	"T"
+	.string	"5\273\207\366\352\307\234|\n\317\270\002\032\236\335\005y\365\202\355\3652&)\031S\266MRB\272\364\025\f\313K\325\006\226\215\335\025\367JM\274t:\263\222?Q-\246\323\277\236"
+	.string	"\005\254\204\216\253\345\303g\3073"
+	.ascii	"&\273\353\r\304]o\333\201m\n\366\024\0208\177\371S3~\306\366"
+	.ascii	"\350\032\177C\232'{\nA\347\r\311\034\273$vb\021\266\327\326x"
+	.string	"\233\321\007\345\260\2472\226M\373,\316\"o3\322R\034\036J\225\310\253\037\254\266{h\244?\363\032\177^M\363\025y\025\244\315\224\332rX1<\273\253\220W3\330^?^@{)\363(\317\030224P\223;~@\263-\362\027\240\001\230\335m\340\303\036\303\340\237x\265\2502\217R\321^\377:H\215\234\025\035\027\215\323\354\231\2644\315\236-}\261=\375\032\"b\200\313.K\317\215\035Qa\250\216\363\267~\327\251}\373+F\277\305]<\2378\001\224@ \303\207B\277\260\033\241\204\335\211\347u\037R(\372\302jo$\004\202D]\370Y\370<\257\343\304\020\024C\237\310\205@]\n\347\205\"7\202\300\340\205/\344D \030r\237gK_\374\327!\354\270\264`\363/i\247\035\250MNt\205\322\322v\2009\017\322\354\n\001# @B\004\235\331\006\306d\361dc\f\221\b;\002tOi\257\332"
+	.ascii	"@\236G\230c\220\337\002\356\203\371\022!\035L?\2244\016\334s"
+	.ascii	"\271{\372\b\256'\247/\t\333n\333<K\036\370\373H-\261/\344\013"
+	.ascii	"/\205+\026\273X\013\253\021T\303KLQx\377\265e\f"
+	.text
+	.section	.gnu.lto_accInit.part.0.111.a99562ef6bafc67b,"e",@progbits
+	.string	"(\265/\375`\304\004\325\032"
+	.string	"F\357\246G\260ZQch\013\2601\346\365\202g\023\026@R\203\210s,<\376\006\016\252\370\220\245\317l\344\221\250\222\300HJ<\313P\227\0040\210\235\336P\2331\352\251's\241\360\360\005\363\2748=\f\253\277g\233\225[\312\224\002\212"
+	.string	"\232"
+	.string	"\221"
+	.ascii	"\254%\027SB\260n\031\210G\362$\272+Y\361+\344k\025-\005\241\356"
+	.ascii	"=!\334:\003\353\326'\313\"\375\231\373\021\034=\257\317g\221"
+	.ascii	"\3327\362$\335\217\340l\3575\002\362\344\336S\302\255'\260n\005"
+	.ascii	"\274\200\352\226\236\200\352\326>\021S\250\220\363\3316\205\n"
+	.ascii	":\373\374<*\272\217\244\241\237\360\336\223"
+	.string	"\274\255=\356\363JE\037\237\366^\374\274\036x\007B\206Y\236\224^\3048\035pq\205s\3575K\306mo\033\203\355 \266\b\f\246\001\250o#\201\310u\343\336\242!\232kd\241 }\351W:\226\330\314\261\034\027\236\220zV\252\310\202;\324WEfZv\340<\202\001\300Lp\bM\320;8<\242 Q\211\nT\021\341\005:!\250\360N%\n\332\351 y8\204\310\264\354{v&\327\031`\204R\002\314\370\022\245\025\344Ex\357\265[h@Y\375\242\336\364'\366h\363L\266Q\302\230\366xk\025g\362\312\251\314\220{\357\270\362\225r\376\322\201\036\235\344~9\353\374\337\235x\\r&\2727\261\261~|\0016\302\234\2322\365\327\023#V7\335\024\350\336\235\003[/\024\344\321\241k\025k\235\022\202\252\265~(M\024.\302\230\234\007bh\035\203\246\244\020\3203\035\n\204\201\243{w\357\205\311Q"
+	.ascii	"\246z4\002\252?\266C\334\313\210.\\^\355T\215$z\217S\331$\376"
+	.ascii	"\204\263\261K|KN\315\321\275\327\202\226;\231\360\177\334\372"
+	.ascii	"\004\n\372\036\n\325\355\201\247?\220\264\334(\022\265\243CZ"
+	.ascii	"y\270\212\027o\335a\233z\365\363W\271\250\255\213Z\024\251\253"
+	.ascii	"\r\r\326\2711k\270X\002\353\334\260(S\2305\\\214\214\365\034"
+	.ascii	"\260\316\253u\243\2253ZL\306\223af\336l+`\256\026\035\312\333"
+	.ascii	"KD\311\3233{\215\200\301^.\303nh\246\354\366\252\225<%\f\366"
+	.ascii	"\"m5\323F+m$M\366\232\221\260\232\215\274i`\263\247\254\2217"
+	.ascii	"\323\254\221\343\305[w\370\300o\3502d\322D\177\037\325\252\272"
+	.ascii	"\260\275\252\306\331U\236\353\305Zy\330^@m\r\034\350{\246R\246"
+	.ascii	"\256\360\352\217U\325\366p4\270\2323\326)\215\224\r[\355\017"
+	.ascii	"\227rS\\\250\241X\001$\245$\020\tfH\212\322\302\001\260\002\221"
+	.ascii	"\272\332\034\0210\261b\222\210\005U\220\032\231v\003\214\026"
+	.ascii	"x\276\251YH\027\213\3327~\007\001'\3739t\236\311\001rj\266,V"
+	.ascii	"b\206\013\227+\200\271bCv[\262e/\303\202\320\314\372\3403\034"
+	.ascii	"\332\256\266~\226t\365\211K\"\314k\267\004\335\274F1`w\027\233"
+	.ascii	"g;\230\213\305\302\314\276\232/\261\254\271<\247h<\333\347\261"
+	.ascii	"\206\214\032\300\273s\2050\262J6\216\002w^\213\250\267[\031b"
+	.ascii	"P\275\006@\277\300\370A\273P\366\225\t\352\224G\004\032\317\326"
+	.ascii	"q\353\301\222\343\221\233d\345,\325\342\210\312\2424_\211D/\351"
+	.ascii	"~"
+	.text
+	.section	.gnu.lto_accUpdate.part.0.113.a99562ef6bafc67b,"e",@progbits
+	.string	"(\265/\375`o\r\325?"
+	.ascii	"\272jD\027@@\346Q\007\220.\355\201\343\177_\244\310\036\271\202"
+	.ascii	"\f;^\306\003\303l\234*\215\346?A\332pc\335\202nR\t\3744}\007"
+	.ascii	"\237\242\236\013v\272\320\376\002\202\031\274Y\340\215lm7\331"
+	.ascii	"{\313\224R[\001P\001a\001e\316\254\226\346\246\357\332\261\264"
+	.ascii	"\366\t\205\244\227s&\321\226Y\343llx]GHB\277\344\234mt;\032O"
+	.ascii	"\323\rl\034^\327$\350\276(\305\344\234\2018\326\3662a\355\317"
+	.ascii	"\006v\267\237\ts:\035\357!\037\331\256|m<\347f^\247\323\321n"
+	.ascii	"\316O\232\305\326W)\025\330\377\356\fs9\036Q\316\274\226\326"
+	.ascii	"\377\335\036\347c^\227\343\341K9G\201\344&gg\003_\373A\353k;"
+	.ascii	"\235\310\372\332z\023\353k\267\207\351\356\260\264\356\267{\220"
+	.ascii	";\231\331\241\201\316\350\366r\316Y\276\3426\366\327\330U\247"
+	.ascii	"\267\223\372:\321"
+	.string	"\251\211iI)i(\f\002\177n\353cW\025\377\323\333>\346\304*\252\003*\357$e\355\315\233\352\270\n\327\204{\262\366\346LS|i\212\333+1=I]\240\367F\221\363Ic\252D!V\220\376d\362\303)\241O\303\2235\245\007\235O\332\022\177*y\240\252\344 \316\221\377\3714HYC\342.\022o\343\370\024\237\264$\252\324\323\247\262\244%\337\247*\345\234\207jg\252\203GS#{\366\007\307\346\353#\325\212\270\252.P\336!2T\353\241\022\367@\t\004T+{\354Q_0%\204Tc\363g\362'\237\206\234s\373\321\2127\224w;\231\356>\321\035\f\021\"\254\n\2250\240\247b`\333\224Qt\305x\020\b\013\024\332\003\271 \016\035>|`}\215b\2034t\374\351\016\317\003\341w\024\272C8 \021\316\206\204KK\370S\352\353\037\214\375\316-\352\307\247\034\037*^\266\352'X\3077\346"
+	.string	"\225}\243n\357\343~N\264\2775\n\025*X_\035\177\221\333S\306%q\316y\f\343e\033\331\356\025\216g\f2s\316\023\332\363\270\036\026\355o\276v\013\255w\244\026\353\253?\375\325\310\005R\212At\374\351\343e\343'\3178J7\002\367\333\312\375\256r\277\017P\t\277\247\204\337R\356\267\001\367\273@\373M\300\375\036\340~\013p\277\003\264\337"
+	.ascii	"\334\357(\367\033\312\375~j\277\211\356\267\323\360\273\211\375"
+	.ascii	"fr\247\373\322\357[I\370\235\024\374\036\006\277\205A\367\033"
+	.ascii	"\b\374\376\271\337\256\337y"
+	.string	"\267\277o\037\353~\257\355\267\332~c\177\343\375\276o\317\240\302\211IR\346,d\372(7Y\243W\374\215\373\235;\035\277\323\020$\204\265Q\315\311\0368P$<1{\271\314y\005A\202\2156F\365\300y\322=1{9;\263|\3653\355s\352\320\361\261\007\327\264\213s\347y-\373\017&\034\232\036\324\353\332\243o\302Z*\335\257\220WM\016\257,\t/\035\271\022N\002i#s\250\3177\031\362\312)ag\343\337\334\342\307\207\022>\t{\335+\227\024\255\224\030y\217H\rq\322\201\037v\316\"\371\324a\260B<\304\375gI\262\237\332\305}a\n\361\362\275\356\223\357\222\2404\347\343\313\344\215\274N$0\237\255D\326\027\251\373!/\2246\347\243#\327\212UR\265~\227o\333;\262\275\216\217\026<\354We\236s\202x\331\256\277TX!v\341\366A^*NM\342\201\224\030\242\t\335$\3274\307"
+	.ascii	"\361\262\201S\334 ^\247\264W\336\266\370\245\374\257\305A\374"
+	.ascii	"4\347C\017\020\377h(\324\373(:1\377,\021\322\220\202"
+	.string	"w\361\017w\277W^\270w$\020K\365\300c\335_\326U\305D>\331\253\005\003\323\327\376\261?\276\\^/o\263\311\372\372\303\216d;\376\324\313\247\r\255bF*\372S\n\311\305\036\307\327\264\344\231f\324mg\316\271\305Q\332\3370\254\017\273\230\313c\344\215\3360o\334+\367\312\261\276\372\260?]\315\222\244k&}x\331n\336\312b\234\367W\376\030\255\201?vEsy\330\325\234sf\031\370c\026\273\222)!3%\331O{\305\213\032J\224npE\305!3\221\253x\305\370\316L\357\020\210\006\206\002\306\256\034Z\252\361\004\327\214.\0235\274\270\300\300ll\t\2153\272\300L\304\330\252\3215\342\205\327\006\0312\276\300\226z\013\313\353\253\253\206\026\030\227\f\256\255-\255,#\330\227\321\213\313\230\345\325\2455#k\013\314\230\205E\325_4\270\300\262j|}\201e\001\3353\216\322\032\216\230\214\330\204"
+	.string	"\343<\246+\247\242rb\340T\030\001n\232C\203Za;u\252\360\001l\205UHfJ\2629\r\235\300\224S\304\222\306\251\302\023\334\300\274]C\333\376\350\303)\212\025z\241@a}=\200\275\016\236f\323\024v\303\300\245\360\024v3%\031\233o\323w\207\332\356\035\331v\254\257Ro\350\360\224qI\003XM\0324\005\360"
+	.string	"l\200"
+	.string	".\360<C\340\311\274\231\2712\357}\307\372:"
+	.string	"\373\020\321\021\200\345\306\304\005\300QX"
+	.string	""
+	.string	"\034 \f\030"
+	.string	"\r\376\213\227b\260K\024\366!:\022\205\302[\264\024\203\237\345\t;a(\354fX\210\370\t?\0363=,b\211\260\2309\227\211-\372+b\214\022Hs.\233`%\205\230\243\36671H\254\257D\214\345\026e\360o\rM\222\246\351\rO\245\030\234\342\204=\215?\2231\217\224q\321o{\346V\373[\213M\337\2611\326\327&\374K\312i&\217?e\"\223\263\204\227md\231.\274\352\357\031\333\375\376x\321\336\221L\330\205\035^\031\036S\252\360K8\201\n\250a(\006\025S\206HFD$I\222t1\005\204(%1S\017\022@u5\246\031s\246L\222\322\302~\215\001\334+\3374\345\342\202bH\265[\r\206\246Pg1\271\377>\273\360N#\016\255&\340Hj\033\2301\021s\262\2573>\257X\367\022e\362_\207RBuE\263\316\237\032W.\033\353"
+	.ascii	"~-\222\253\ba\344\300\"1\237.\250&\241H\3758\302NB\260\336\t"
+	.ascii	"hR\264\f\233)\375\016\372\313$\246\300\245\004\037\002\304\243"
+	.ascii	"\372\264v\371\200\2438>\263\222\013@%<\371\031\331\003\300y\f"
+	.ascii	"\303~\275%\321\340\265\013\243\207F\351\305\243\251\024\016\340"
+	.ascii	"\313\346\321Okk\345\227\\\241"
+	.string	"I\2219\212'\250\256\204P\332\260h\t\307\305\300\264m\251]\204\b\312\346\250\373\027\352\300\210\2010.\006\367\242\274B\217\2169\240A*\026N\213\023\213\320\343\240\274\222\t\272\346\242\317\264u\034Y4\374\301<^.\232m\314>?\037\357\222;\343`9\363\362\324\022\343\021\262\243N\227|\032 \002\376a\235\006\300\366\2464\006\350\344\037\213\240\375\0311\307\354C\004\364\227\302\304\221L\346\342\366\212\362j\267`\211c'\303\275B\237\366z\006K`@K\301\201\314?7A\307*ua\005\242\321\346%\344L\252\035@\005\241{\"\217V(\366\312L%\320\213\217rl2\372\200\001s\301\363\\\016C6(\2106\t`ac\311\344&=1\316\230\343\036\3669*i\341R\206\206\310q\357\212\036\321\310:\241\022L\247\375\275\034\035\0168s{\230P\255\314\300\234` \265$RL\213\222\355v\316\340\0236\344"
+	.ascii	"\0040mt\2762@\002 \270\272+h\230\006\034.O\3116\342y*\202\344"
+	.ascii	"\241\213\310Z\363 iod\027\356+4\002\006\207\367\2701$&D\322\243"
+	.ascii	"\332U\033=cZU&\030\2767}\221\3064\002?\205\337\301\224\t\215"
+	.ascii	"\371\ft)m\367\347\323[r\346\203\276\207\243\224u\236\336\032"
+	.ascii	"\200\344\261\037\271\235\251\3434"
+	.text
+	.section	.gnu.lto_accGetAccumulationAverage.part.0.114.a99562ef6bafc67b,"e",@progbits
+	.string	"(\265/\375`,\002%\022"
+	.string	"\206cwE\360\320&\035:M^\352\24000\275 \350\210\200\360\252\341#\365Q9\210\346\373\372\213g\371\353T3\253\307`\030\305Ve\333\301v\364\026\003\317\300v\246\237\223{\235_w\364\213\036lK\3550-\331{K\231Rc"
+	.string	"d"
+	.string	"\\"
+	.string	"\245Cw7\020\017K\367\210\207\366Kx\204\204\365\032!i\331\365N\207\246\200\214\247\302\017\322n\267\035\252\007\353_wk\272\016\237ft\371y\001\326r\250\225\364\374\361\330\324\300\211\021\004\313\360\367\006\354n"
+	.ascii	"\030\314k\260\273'z\312\300\\R\001\3100<=\036\265\222\335uI\303"
+	.ascii	"\255\3356\213\355\bvr\001I8v\003d\001\342\263\177\350i\337\037"
+	.ascii	"\"\022\022z;\333\2073331\342\263\373\370+l\002b\371\003\246["
+	.ascii	"\330\253\307\007\362S\374\247u\025n\361\255\331[\320\221\005"
+	.ascii	"\331\330]\220CC(\035~\274\364{X\266\311n\331\246\303|\307B\320"
+	.ascii	"m\315\313\232\366O\234\247u\024.z\307nN\321\321n\027rh\007\001"
+	.ascii	"\273\253\032\263\315\340\327\250\007|f\214bnl\244\300?R\261\221"
+	.ascii	"\377\301wQ<\\ \003I\237B}\214\210w\273\210\251\252\217\t\361"
+	.ascii	"\222I\276\246\236\350\360eC\343%\006P\016\227L\262^w\267%5f\215"
+	.ascii	"\377j\216\355\264\0265\r\337\375\357\245\365\245\363C\367MO\366"
+	.ascii	"B\300\315.M+\023\n\334CI\340T(\226\007'+(+\247\023\347\341\223"
+	.ascii	"HJ\312D\205S\241NP\247\023\267\255T\251U\nj\265\245\230p(\333"
+	.ascii	"I\265\332D\02285\001\245\332TR)\325f\372Ws\b<\337\0255M]\342"
+	.ascii	"\242/Pc~\007\022\f\02247\263U\016\326\377i\314p'\202\334\264"
+	.ascii	"\223Q\2572\266\035\362kv\360\231\001\2237\254\177\033+ `\202"
+	.ascii	"Aw\266\r7\"PAb<*\360i\230 \327\270\020a\247\250\272\216\355\030"
+	.ascii	"\315K\334\331\213\037\255\276\021\216\030\235\nNi\300\003k\020"
+	.ascii	"\336W\262G\351<F;\232%v\231\257@\251\220\200\001\200\342\271"
+	.ascii	"KS/\336k\222\253\f]l\200zX\023\266[h4.`\007\305\023\347\n\322"
+	.ascii	"\337{-\306\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.a99562ef6bafc67b,"e",@progbits
+	.string	"(\265/\375` \004%\023"
+	.string	"v\334mH\260XQ:<!\300\360}\235\340)MQ\264\240:\255H#xk\334\037\\\306\260\355?\251<{\205t\217u\336U\330\fdx\252\r\322e\002p\235\303O\235/\251\2516\032\247u\311\376\203\025 Q\367\372\277\233\3342\005U"
+	.string	"b"
+	.string	"X"
+	.string	"\227Z\021\3751!\376Dk\025\227@\364\301\310\017\367\342\341\\:|\013\207Wm8\225\206k!\220\341Y$\245\024\tC\277I^\310\261\200\233G*\200\240\302\261L\376W\2449\237\371\277Ek\245KK\241\317\223\225\307\364\367\037\025dY\224R:\241o\362\377\224\005\277\245\2413\377\036;\243\242!\235\320\016HGt\373\212>\206v\346\214\276\023]\277\311/\315\22222\372\3436\241!\362C\250\317$FK\220A\035A\302\370\224\027\367M\027\rA\002\365\303\264\350\0078+*$,\332\301\212\306Q\3216\312\224\242\023H\024}2\362\004\217\211\236\022\r~\030\2208\2259\"9 \307\216,\310\261qW\007d\233\272\265!UB\\ \347pb\034t\265\237R\222D\251\346b\233\321\346\342"
+	.ascii	"\342\0160\003\344\251\266\314\243\037eG\037\352\250/\305\250"
+	.ascii	"\037U\324\207\262\353;\351\350_!\352[\311\321\237\302\321\257"
+	.ascii	"r\243\377\304F\277\313\376\377\30355\372\001\177\325\275\200"
+	.ascii	"\003\374Ccm\335\005i\f\263Z)u\346K\221Y\310\260*\013\371\225"
+	.ascii	"\304\023\362\212=!\347|B\246\341B>\232\261Z\275e\335\314\330"
+	.ascii	"5.\357\334\360\253\267\006\240\214\370b2\336\244]%5b|\013d\374"
+	.ascii	"\022wy\224R\005 \303\256\326\326s\372\335@\0060\006Q\250a\f\306"
+	.ascii	"b\331\314HI\n+\255\006\240\002!+Z\007\021\260 +\031\221\250$"
+	.ascii	"\020\221`(\350\001\306\022T-\206R\245ib\215\021\303\276\024\210"
+	.ascii	"\241\243\343\013u\351\207::x\032\246\323\342b\367\\\356\343}"
+	.ascii	"\234\257\327\351\303\231\214<\267\020\t\376\22039\262\242\023"
+	.ascii	"\276\362A\374\311\305^\262\226\217\220\376\216u\3569q\260x$#"
+	.ascii	"\321Q\211\025-x\341\006a\201\257D\315\303\236\0327_,\272\250"
+	.ascii	"\217\375\346q,\256\001\332\234\tLy\371&O\316}\3329\257u\236\343"
+	.ascii	"\261fb\330\222\272Uhv\303\312\250\217\265p\001\370\007"
+	.text
+	.section	.gnu.lto_.refs.a99562ef6bafc67b,"e",@progbits
+	.string	"(\265/\375`\005\0015\n"
+	.string	"\366\234H.P\207&\351\210\235\231\231\231\231\231\231\231\231\231\251\310\324p\342\224\244\240*\376\020\265\177\002\037\354\373[\243\331\377\376\2665\"\226\020I\266L\0018"
+	.string	">"
+	.string	"<"
+	.string	"?\375H\363\220\206;\3307\030\3360\2745\276h\\5\236\324\223\275\210\2068\376p\337\260x\324GHOI/Q\037I\377\270o\3243\345-\361\325o\372\2248o>\376\030\263*\003\336\376E\236%\2442\037t\360\027,\276\202~\202\346\0214o@}E\363\024\016\237p^\202q\002\354#\230\037\300\274C\373K{\206\366\013\352\243\006\2670x\002{"
+	.string	"\352)\345P\303_\023\326\r\311\335<\257\036\236\326\b\352[\234\213\225\233\353\003~"
+	.string	"\342\005\372\025\320SL\370\304\344%\312#\372\020\345\r\375K\271B?R_\271?\200zK\372\220r\207\344v\372\214\347\177\017\267\316!\355,\316\326/\250x\341\316\2043\020O\320s\262\200~=\206[\340<*\320a\271\237\336\221u?\312\031\226g\242g\226_\224\257\365\252<\225\263\027\300\271\225\263\246^\013"
+	.ascii	"%\023\260\323b\344\021-xE\334\257;f\266ll\340\213\035H\002\306"
+	.ascii	"F\367<\312\327\301\240\001"
+	.text
+	.section	.gnu.lto_.decls.a99562ef6bafc67b,"e",@progbits
+	.string	"(\265/\375`9W\265p\001\032j\312\206V LI:\215\001\252\\\233U\267\247\206/\002\f\300\354\302\262\270\313\362\022\235\331\251\231UJPD"
+	.ascii	"TQPT\325*\273\022\205\260m\305\360w\261\266&\231B\346\361\353"
+	.ascii	"(\305\303\353S\030\217W\327\371\241\370\256\367\013\3642\213"
+	.ascii	"\034b\3346D\352\264$rK)e\nD\007z\b\204\b\277\245b\253T\246\215"
+	.ascii	"\263Sx\226{7\211\263Q,\\\b%\247\023f\224i\036\211\263P\252^\215"
+	.ascii	"\217/1|~{/yzz\2006\236\224ye\374\314D\377\026N\312\215\341\344"
+	.ascii	"\344\314\362\204\263\302\302\303\342\377\225i\337l\333r\363\324"
+	.ascii	"\344\245\330^,~6\323\317a\372\371\207~\356\322\317XN\354Z\016"
+	.ascii	"s\213\f\314\342\347*'9\205~n\322uY9d\236\272\223\277<\377\226"
+	.ascii	"\374\366\254\262U\265\n\254\212\202\344\211\305?\375t\336\311"
+	.ascii	"o\253\034\362\022\347\260\310b:Y\374\363\212~\007Bl\221\213d"
+	.ascii	"J\247\345\350\321\334{\371\337\216\331\262\312\264d\026\f/\367"
+	.ascii	"F#\263F\354\021\234\245\345\246:j\352\355\201\355\275\354\341"
+	.ascii	"\351\271I\3633\363\"\3430+\226\243\202\007\212\035\026\377\274"
+	.ascii	"\021v^\351\237LC,\021[\245\304\213\314\020\274\247\217\351\354"
+	.ascii	"\217zEL\231'\213\217\333\264\355a}T\246\375:6\323\332g{/o\256"
+	.ascii	"\362\205\034\233\305\257\"r\216\210|\314\324\307c\372Z*\207l"
+	.ascii	"\273\254\216[/\233c[/\017\264\366VZ\257\2343{+sj\r@\255\001\300"
+	.ascii	"a\\>\3222>\006\323\307;\364\233\225C\2666^\365F\260;h\2502E\303"
+	.ascii	"\342c\033\372u~\225C\266Z\225C&@\335\311oj\351\340\262r\310\325"
+	.ascii	"\252\356\344c\026:\306\331,\035\230\031~\026\037C\351:Uw\362"
+	.ascii	"\357\236\256Z\266\005\013\253$\205\022F\324-\213\337\256\250"
+	.ascii	"c\266\312j\355\275\264\367\356`\323v\246\351\205\305V\312NU\346"
+	.ascii	"\337,Upi\271\317t\300%\351\260\3707O\273\260\367\336\365o\031"
+	.ascii	"\370\367\367\367W\377\226m\352N\256L~n\243n\233\224\2463P\007"
+	.ascii	"\320KP\324\216X\374[\025)\256\023\224\326F\333{\251\001\230f"
+	.ascii	"\004J\027\213\355\023O\0253\206\f\313\342\337(\372u\254\251\362"
+	.ascii	"Y\345]\266\3515.\254\246m\252"
+	.string	"\313Z\207\243\\\356*\234+2\256\256\374\254\223Ea\227\254\222e\252L\333T\301\274\356\3250MlS\345R\2338\312\345\236\002&\261\212\301\256\336\341$-\267T\346\272\272\272\362\333{\371\232F\342\003\333T\361\252\336]~\001\231\\1\232{/{zxzzzn\272\2508yb\203m\322Y\\\226\264m\361\357R\377\3254\225iw\035\263V\321\334e\233f\343R\321\264\273\"\251bp\224:{\211+\305W\206=\257\253\214\317\360\334\344\320\032B\303\342\337.\375\232\346\226\346\257f*\231\312\254e\252\337Y\231\372\244\252\341(\227\032\240\271\272\002\333{\367\360\364\\2gr\315\214o\301\350[\271\276W1\177%\253eg{\357\0165,\352\266\304\260\230\304\317k_\006\213R\203\214\305\267i\272\356\312!\353\324\235|+D\327.\325Ke\036\240~Y\346\330\035h\230$\261\370v\207~=@\276\177\177\365"
+	.string	"\371VKW-uKebP\363N\342\203\337$\263\234\2334F\322\230\261\370\326J\277b\220\353_\305 \337\252\320\365\316V,5\313\353]\275r\022\037\334fi\037\331{Y\357\360\336\312Z\003\200Sk"
+	.ascii	"\3167\036\312$\031\3372\351W?\315S9d:\0176iMZavV\252\\e\326\271"
+	.ascii	"\352\004ImR\353\272L\b\213k\316\325\265\032W\353\272LHc\245"
+	.string	"\271\367\366\320\323\203\207\364\225\365e\\\205\307&\205\337\230\305\257h\372\177\235R\245T\270\372V\231\225J\205r\273\334\033\215-\n[\232\233\223Z\326V\325p\316\275\265\326\276\366\336\357\340\377y\245R\237T\265\020L{ke\355(\273\244@\343\267\367\346\351\351\351\351\311y\332\232\001&\003~}\322/\322\037\3227\241/\002\315A\345\220\337\001\375\022\372\257I^\233T\265\252\265;\340\260P\002veq=\253J*\323CE{eR\323~*\227{\271\367\316\251{]JT\026\353T\016\331\326\235\374\005\350\017\312\375\301q\264\n\366\256\036r\375\373\253\036r5\373yM\362W\261zd'OY-7\332\336;G\204\0356\302,\276u'?\203\276\325\032T\016\031\327\235\374\272\312!\177Y9d]w\362\377\017L9\177\\\025\334$U\357b\340\267&\314~\373\302ER\201\345\177'\360\337).e\177m\342"
+	.ascii	"\262\177\271Z\325R\313\376:\201\347\335\233\277J\251T\352\b\003"
+	.ascii	"\360\034\313\035\373\355\020\017\023\376\023\004\277\245\273"
+	.ascii	"Y\025\355\257Mj\325\f\003\025\305\177\213\334!\377\r\362_\036"
+	.ascii	"\377\305\241%\203\377t"
+	.string	"\373\357\007\277\rA\215\377y\177\315R\361\202\264&\360\037M\337\377\373\237\031\274\376\247\007\340_k\334q\376\323\21453\346\267R\256\326_y*\227\177\300\302\335\374\247\217\337\302pi\374u\327\345_\225\222\206\256\341?7p\177~\013\202\0315\006\272\177\271JX\f\360\006\374g\316o\351\262\376\303U\371k6\263BW\253T\236\235\213U\251\260pc\374\027\306\177]\324\270s\360\3431|\371?\267\374\377r\225\216\377\363\356\267Y.\213\337\362\374\267\352\2674.\325_\355\177E\360\337)\251\2776\371\355\003~[\202\273\342\267\035\376\033\365\333\017\027j\311_\357\177U\244]\240\024J\376\212t\213O\377=\201\323o\201\376\207h^\024\377Y\260x\020\370O\266\377r\200\351\267M~\353\344.]\245\277\342`\224\337\216\340*o\322S0\300oM\374\303\177*\371m\215\273\377\272k\222V\206\377,\361\337\001\374\367"
+	.string	"\3775\300\177\t\360_\r\376+\200\377\026\340\277\b\270\t\2708\377\305\340\277"
+	.ascii	"\270+\370\257\363\347\r\374\025\377\377R3\374\374\361\226\327"
+	.ascii	"\374'\222\377p\377U\301M\301_\363_\363\230x~+w\233\377\024\373"
+	.ascii	"_\346\277\337\323\374?\363\327j\253\374\327\3779\344\277(\370"
+	.ascii	"/\t\376\213\376W\370\337\016\374W\003\377\315\300\177-\360\337"
+	.ascii	"\022\376\373\200\377\202\360_\022\377\365\371o\002\376\333\363"
+	.ascii	"[4\2775\363[\270\337z\375\226\357\267{\277m\376\326\313o\361"
+	.ascii	"~\253\345\267v\277\325\372m\335o\345~[\345\267S~\373\344\267"
+	.ascii	"m\277]\373m\220\337\376\370\255\217\337\362\370\255\215\337n"
+	.ascii	"\375\326\352\267/~\333\342\267U\277\225\372-\324o\237~\213\342"
+	.ascii	"\267L\277U\372m\322oU\360\333\023\3746\375\253\322_\177\376\032"
+	.ascii	"\201\277\"\375\266\004\277\375\360\327\275\277~\371\353\323o"
+	.ascii	"\213\177\315\373\317\302\177\265\377X\376:\201\277\326\377t\377"
+	.ascii	"1\360\333\021\374U\303_-\370k\360\267C\277\r\372-\361\267&\376"
+	.ascii	"\352\344\257d\177\205\362W\266\277\302\375v\370W\236\337\206"
+	.ascii	"\340\267 \370\377\345\177\332o=\360\333\016\374\026\304_\303"
+	.ascii	"\374\025\314_\233\177\365\362\327.\177\345\362W\275\277n\371"
+	.ascii	"\253\226\277\342\375\325\356\2571\374\265\356\257t\177\235\373"
+	.ascii	"\253\334_\255\3745\356\257T\376Z\345\257S\376\243\360\327\235"
+	.ascii	"\377+\374\265\346\257\031\376\273\360?\356\177\207\277\277\277"
+	.ascii	"\277?\270\177\235\255\377\001\300J*\rNg[T\373lk\353\354%\345"
+	.ascii	"\324\323\322\236\322\260\317\266\300\3543-*\035\2473-*\247"
+	.ascii	"\263-'\325K\212\"iZ|\001\3231Wk8-\355\025QX\312)\235:\247\245"
+	.ascii	"\326\326\262wEk\332S\273no\001\354\215\2455\245E\t\243\266)\325"
+	.ascii	"\255Pj\242\324\252\313\275\267\207(%.\255\275T\227Tw\235\223"
+	.ascii	"\020\255\275\205(\r\355\250\275\367\366 iY\267u\324\272$\033"
+	.ascii	"X\033\252i\357\017{\271w\324\336Iu\327\355\275\223\366\336\300"
+	.ascii	")\254\345\336W:N_QQ{[\361Dm\254$\267\246\275-Z^\033\225\323\031"
+	.ascii	"\227\326\217\333\222\263\257\215b\231T\235\240\264\366\327\326"
+	.ascii	"\2625\245\317\222\220l\250\275w\r\243\277\250X\354Y\254\307\345"
+	.ascii	"d\r\317\342[p\267\\\356\275\314\251i\233\301\244\205\305Zl\224"
+	.ascii	"/\326b\260r\207\263d\330*\302\316\230wX\336v\006\344\211\316"
+	.ascii	"\342\345\006\253\"+\350^\231\230\016\307\020t\332\233J\203\""
+	.ascii	"[A\254\374\366\224\325\006@4pI[\026\343:\233/9V\210Y|\013f\350"
+	.ascii	"[p%\002\313\345\004\263\204\311B\243\302q\026\206\n U\026\337"
+	.ascii	"\202%\\\005SQ\266\351\331\231Y\374\343)8\312\225==1\213\217\263"
+	.ascii	"\376\253b\006\f_=\252\332\2153M!\265\311\324\005\016\273a4<\206"
+	.ascii	"\217`&>\303L0\024\334\206\223\340%^\202\237\340&x\rK\301d\330"
+	.ascii	"\tF\202\331\260\022\374\206\313p\0326\303j\225\211\243`#\307"
+	.ascii	"aX\254\356\341`\306(\333\361\364\265\367\222F\016\257\034\265"
+	.ascii	"i\365u\004\210_\223\307\r4c_e\232u\017\006<\247\037\260\252\207"
+	.ascii	"\223\244\263\225\356\350\276\210\344\325\275\0332\372\376\253"
+	.ascii	"B\253\253yUpe\335,\177\335\363R\021\304\213\r\254.\346"
+	.string	"\212f\021-f?\310\324=\035U\r\005\324\327\336\373g\310\r\275\346\215\377\307\207\0223\315\275\227W\005\216\202k\344\240\321\274*\242\340\255\332\254u][\231\024B\030;\037@\374zx\202>\236\204\220\t\001\333\266\312!\367\324\235|\rV\3645\210\351k\320\241\257A\206\276\006)}\235?}\035/\372:T\364u\226\372:;\364u\252\364u\224\3729|\3729v\3729l\3729c\3729^\3729U\3728i\364q\362\364q\250\350\343 \321\307\031\242\217cC\037gJ\037g\353\337l\321\277\211\323G\303XXF\2121Y\326,\276\2525\210HYb\361o\320\364\353\021\026\230\tK\325\272.<\307\326\354\023\263Vf\246\352\251}\3353\227L\332\327E\303\344\003\333\244\352\341\334\275g\240}\341\030\330\nO\341*\f\003\277\300.p\013LU\231\230\005V:^\2627n\2262aM\232i\260\262\326Y\211"
+	.string	"V\326\304,\356\230K\006\250\303M\217\314o\357eO\325\n\273\322\265\001\257\270crr?,\376M\226\376\217\241\260\212\312\304Q\270\351\370\tG\251\263\267\227\227&\216\252Hp\330\226f\016\022\206\215*\343\3274\354\204S`\024\225\211\237\226\332\252\032~\252O\252Z\006\036?\360\346\374z\220d7\314h|\233;}\2337\215Sw\362m\314\364\375\303\2732yp\222\235\322\n,\213o#\246W\260+O\376_\345\311\267\031\242o\323C\337&\207\276\215\226\276\215\213\353\207_\310\335\350a\361m\242\364m\230\364k\314\350\020*\207\374_\276\033\206K[\337\230\305`K\264\fJ\320\334P\354\221\345\315]I\003\3466e(\331|X\274\004\313\332\302\344\213\365\263JRL(^\256\223\217(R\336\272\304"
+	.ascii	"\222E\305p\342r\365B\300\001\206\311\342\245Vza\347\226\367u"
+	.ascii	"&\251\022\246\334R\233\234\260\262\"\323r\361l\336\2155&,\277"
+	.ascii	"x\377\275\273Y\252^\255\202\333\362a\261\210\312!\237u'W\262"
+	.ascii	"\237_,\330\206\030) W0\310Y\276\210\262aW\357\200bR\270\320b"
+	.ascii	"\330\372\r\315\224'uv\t2k\212\037\235\007`\0217\0328\346r\030"
+	.ascii	"4,+\344\354\213\025KW\254X%\260\017\013\223*q\267JUSS2V\245\326"
+	.ascii	"e\2101\005#\007\225+\345\206\310\225\024Q\026\277\216\375\026"
+	.ascii	"\306\225b\255l\f\234\245\345N\002\301\313\325\225\237\013)\366"
+	.ascii	"\005\211/WW~pw\312}\273Q*\363J\271n\277O.\024\030W\212\275\252"
+	.ascii	"\315._{/\257\024\233u\333"
+	.string	"\222D\340\262\2037\232\330me\3005\273r\310\365\253\356\344\327\364\351\313\246D\246\207\237\305\257\341\242\355\f\263\013v\313X\020\240\314\315nY\036\026\310E2\245\325\224\374\232f.\323M\221$\357k+\210ER\353\320\266\222K\304\330\r\213\303z\211(\373qU\230]\250\263\325:\264\315\204$\001cTdX~\026\006\bP\221a\201\355 \361\3015\253v\365\256\326Y\355$0\004(\253A\206\325\301o\321~\315\254\232-\023B\323T\005\270\2704\367\336fW\352\026\t\241\344\264w\225\007b`\270\254\215Zg\265\225I\036\224!!\303\362Kbf\231\265y\227m\032E\222.w\355\236\335\264\313\274h\327\311U\273\313\233\344.\271Hn\223\313\344*\251\314kf\321\334\312\260X\326\214\231=s\227Bh\232\n\256H\242g\315~\233\344\232Y%vI\255\353\332\233\312\203\261\030\310\260\374\366\3368I\260\332\360"
+	.string	"\200\311\252\020\2462!\026\277\006\310\221\312\274c\327\310\322\035\273aW\254\326\241\355M\225"
+	.string	"#TasUF\234\022\035\306W\354\2674\254\226\215a\203m[\252\206X\374\032\027\3725I\372\031\366\364%\342!\307F\016\345\235\305\317`\247\247.\213\273\374*AiE\023\310\035r\203T\346\025\262t\205\334\026\267+\204\246\251\f(E5\205\334\037\267\022B\311i+kp\360\203L\0202\274\244\213\n\r\215\237!\207~e\323\362P\353\272\""
+	.ascii	"D\255\354\206\221\346\355\272..\215\020JN\027\230\322\244\356"
+	.ascii	"m\375\r'\270\367\026\332\327\021\033a\3151.\021\265\016\215\204"
+	.ascii	"\266#\315\275\227\267\353\342\370\033\316\222\316^\352\001\326"
+	.ascii	"\254{\267\353\326\360\220u\350\3601\305\357\366\270_W\307\345"
+	.ascii	"qw\\\030\256\217\353U\231\267\353\346\350\3419\227(\3613c\001"
+	.ascii	"~\320N?\030\247\037\204\242\037T\323\017\232\351\007\305\364"
+	.ascii	"\203A\364\203:f\360\330\244/vR\026?h\245\377_\031\027\2532o\326"
+	.ascii	"\205\361\342\306\260\321\345\353f\335\253\033\303\202.[p\234"
+	.ascii	"\361\273kz|J2\276\206\323\377\215q\255j\322\214e\245\271V\027"
+	.ascii	"\006\016\231\017(\033\026_\227\351k0}\375C_{\351\377V\335\250"
+	.ascii	"\273\302z\215\340d\362\024\207\302\342K\365\363[\305\324\005"
+	.ascii	"Ue\361\001\270\364\365\fm\227\225C\026Qw\3625\013\255A\335\311"
+	.ascii	"N\367\t\205\346q\207\025%\215\023\212+h[K\323/\212{\311yIR\312"
+	.ascii	"\214\271Jg^\270\371\260\370@;\375\312\274\312\233\344D\310S\023"
+	.ascii	"\213\377\273I|P\357lv\b\2332V\346ZX\374>\373\367?\210\223\205"
+	.ascii	"\214\r\312_\032\234(\273\275\225\306\242\t\212\321\202F\314\342"
+	.ascii	"\003\251\350\003\237h\016\352N&\303c\365\306`,\261\370\300%Z"
+	.ascii	"\214\035S\231\326\317\266\3352\261iK~\266\211e\003ni\372Y7\313"
+	.ascii	"W\353\254t\366\222\0274\315\272DJ\232\275\214\357,\030._a\354"
+	.ascii	"\236\355\253L\313w\313g\237\3308\234$\r{\3438\363\305g\255\330"
+	.ascii	"+8K\313]\225\277\354\335\343\241\247\247\006\352FV\222\306_l"
+	.ascii	"\2632-\030\353e\213\355R\353\254\226\273\nGMK\f\237\037\030\233"
+	.ascii	"\305j"
+	.ascii	"\t\241\344dB\024\275\246\206\342\025EG\306\007\206\351\337v\271"
+	.ascii	"\345r\363\304\026\004/\317"
+	.string	"\352epaU\027\305\342\003{\350\274\327\025?\230\342,>\360\206~e\276\213\305\273\027\274\303\312\2131\213\017\324\322\007\306\320\007\272\270b\345l]\255C#a\316Ks\357mg\261T\246\275bc\270b\241T\275Zg%B\225/M\034\037A\304\3062>\360I\343\"KL9Kg\347\366\315\215\227\2547!\026?\377\351g?\375\314\247\037\\W\224,\316`\362^e>.\207\3712\007\347\t\n&q\026?\203&\372\365qy\005\365q9{y\376\362\007\203Of\334\330\262\370\031\234\351?w\371\203\300\264,2\276,~\006e\372\031\200\341\341\345<\036\275\217LAk^\031`d\300\344m\271c7\310\330\266d-6v]\350\322\310\004Q\242b\303\342g\340\025C\f\371n\347\211\253\214\220\312\304dD*\337e,88\236(\001\303r\005\007W\017\0367U\300\220Y\262\263`\226\311\f\030\370,>"
+	.string	"\302P9\225LW\315\266T\007Ixs`7aZR<\315=\323\245\335\020Bgq\256\222\345\2023\222\226\334\220\2632\346H[\232\025mh\254L\3458\334\224\303h\341\021\367\004\n\224\fW\31543\rK\206\224g8/9fPU\310X\234\337\340\236\312\320X\234\243\234m\212\231\223&\231\233\333M\342\321\272x,\366\244\234nC\334xX|"
+	.ascii	"09q\222\331\252\331\226\332\360\203\353\313\227_Y\031\273\261"
+	.ascii	"\274\366\314v\323\247\244\216\f\0038\264\243e\265\337\245=\303"
+	.ascii	"\311\227\r\233\025\246]\332\263Z\r\302%\353\213\305\231\311\231"
+	.ascii	"'\2716\275\377\301\223K\f\027\266\345r\231\227T&I\362\304\004"
+	.ascii	"qx\341\021%+y^R3$\214\333\322\342|\366"
+	.string	"59)ifX\374\276\234\304/N\006\221\234$\233u\251\003\033B&\205\255o\013\222k\004\237\205\245\341Y|\f\232\300\3002Y\b#[f\210\330\3405\273\340\345\261g26'e\337\230\305\331H>\362?\230\303\305d\313\213|$\213\271\331\350R6\2619#c\017/\207\235\313+d+\254\356lu\310\232\2214>!B2\021\r\260\3102\245FL\2120NC\236\211\340+eY\264\314\375\017\3469\2513e\230|}e \325lK-@\351\312\023\260\275\255D\330\2530s^?\236\201<C\232&0jV\376\0079\310\333\321\303\342\207\360\312=r\217\263\256\232m)\236 P\354\216\370\355m%\002\213\341E\261Y|\020e\364\237a\3100\330\024\"t\366\322]V\333\236\262\332\300R\311R6\261\370 b\370{\206\272QwEe\236\177\331\353Gi+\311D\270\331am\220\263\243\b\024\017\213u"
+	.ascii	"\225xY\250X|\020Q\364\353\221\250,\305%O\3515Yd\027\265\256+"
+	.ascii	"\002D\350\232?\026"
+	.string	"J^\021B\311\311\204#y\315\275\227[\031F\246\261\346\327\314[\271J\213\215\334\225s\344\033\271F\346\3128*3o\345\027y+SE\340\310\226\346\336\313\034>1&\f\035\034\365.!\224\234L \363\322\3143\262Vef\032\347\351 \323\310V9\253\306I\030\262)\017=7{X\264\310\310\370\317Y\031\253\3112G\030\213\263\f+\030qL\026\037\204\020\375\347\030\225\231\257t\037\230\233\231.\377\2035p^\\?\364A\354\320\0071#\267\320w\315\2549\213\017\302J\037D\013}\020Q\372 \234\364A(\351?K\345\025gU\370\346VT=9(%\213\377\341Og\247\234\"\253\370\2039am8\324,\376\2071\372\371\351\177\020\003^tj\026\343\372\267\234\233\236Q\374A\033\347\343+\312\342\177\330\323\317K\231\351\017\342h\351\301\004\211\305\377\220\247\237\225\376\007O\265?\276\030\026g\245n\372`\345"
+	.ascii	"\031\262\326h\310\310\373Y\371\347$\273\303z\275\360\207f\214"
+	.ascii	"\3057u'\333\025?\317\273fNJ\263\314\342\177(\323'\232\023\215"
+	.ascii	"\b?\272|\305\2155-Y\374\017[\372<\305\234br\226\262\306\320j"
+	.ascii	"\221\345,\363\323\214\215\336\22551'\231\240\030\227\334I\346"
+	.ascii	"\364{\222F\226G\027\205l\223\235c\252\023`U\035\034\n\213\377"
+	.ascii	"!J\363\361\235r&\270\355\351\270\261b\317\342{\340\323{{g\235"
+	.ascii	"\336\036\334\266\362\310\360\230b\361=\324\351\377l\2762\317"
+	.ascii	"&\346\"BkWy\320\267\347\003\b\323G\036\f\026\337\303\232\376"
+	.ascii	"\317\274\312<\363N/\326l'\341\350\325\320#\013\342\245\0313b"
+	.ascii	"\361\351\345?\365N.g\227j%\317\311\226\334W\013\213k]\345\220"
+	.ascii	"C\324\235|\017?\260\234Z\260\234xww'\236N\342P\244\246\215\206"
+	.ascii	"\220\"Y~\342}IQ\205g\361\373j\363\177\020\227\005\261\302a\361"
+	.ascii	"=\350\320\367pu\332\235vg]\035be%\342\246\213m\313\205\305\367"
+	.ascii	"\240B\237t'\335Y\347\200$s\315me%\242~\231\322b\212\305u\247"
+	.ascii	"\235\220\036i`\254X9\345L\330\033\304\252l\330\252lqY,\307cE"
+	.ascii	"W\251\202\315\360"
+	.string	"\0241\303K\310\312\270,>\217\222(\347\224('\334\371v\276\235puO\365e\030v\300$\261(}R~\302\335\350E\351\360a\361\373\276\366C\312\023\021\213\317\263C\237'\305\223\312<\237\330\030y\212\002J\262\232\035\366\364\177\266U\346\331\366\267:\245\231L3\232\035\244\350\377\034R\231\347\220s-(\302\333\223s\355?\211\234EN'8\254\224\261\262\270\211\023/\256\"\026\277\003S\377\214\311\205\311h;b\204l\356\347\210\334U\201d\356\247\214\210\\\023\254~I\231\023;\033Np\357)bm'\363Tr29\323\316\263\023\355T;\315\316%\225y&9\227g\222\223\354l8K\313\r\003P\357\211\031\"=5VmNZ6\340w\350\322\357\020C\277\303\013\375\016,\364;L\351w\210\322\357\220B\277\003\n\375\016K\372\035\222t\346Rw\362/\030s\0069\203\230]\240\367\343Gm\362si\333"
+	.ascii	"\373\332\333j\203\233\037aJ\224,\376\005w>|T\275j\266\2452\240"
+	.ascii	"\250\022C\004\315\227,:\220\3408w\3408y\2340\374\344q\3468s\234"
+	.ascii	"^:\311\003\032\263\232+\245-\260S\307O/ \023\0163-,>\273\360"
+	.ascii	"\226\377A"
+	.string	"M\244\257L\333\005E\364/\300\241\377\323\006\363\264q\361\252\331NJ\201\211\n!~{[mP\341\366~\314Y\374\013^\\\2355\256\316\255\274w]jIM\275\357\347V\360G\020.(\213O\031\247\214SK'mx\333\263G\226\324\306N\032?\265N\254-C\234X|b\2353\376\007\2011\372\326\212X\374\2373\316\254\252\245I\246+\315e\343\022w'\206\367?x\371h,\201\263\370\027@\351s0ce\265%B\336\016\264)/^\324\273j\266\245V\250\nb\005F\203I\310\027\213\317\001\210\376\317\026\314\263E\275\343\321J\002\303\001\024 \372\316\210\327\224\305\347\340\202\352t:\253,\213\272\233\246,\020U\246\311\201\205>\007\251\025\247\323)e\225z\267\351'Qg\232\177\372\033\272\350W#\365Tq:\235Pv\t\336]{W\375\320\001\331\033|\003\235\376\0066\375\237O\347Sm\212\320R*\t"
+	.ascii	"E\031\304\312o\357)\033\3409)\265,\213\277!L\237(N\024t\312\r"
+	.ascii	",\364\1772U\346\311dSh`o\0342\022\340fw\301h9Ib"
+	.string	"\361w\374\364\177*1O\245[\345:m%\227\bo[Y\364\177n|\346L\262,\"\360\0037\265\301w\260\350\357\324\351\3433\025\247a\3424\265)b+\225\004xS.7\370\016\024\375Z\233Y\314\305`3u\357\275\255v\022\230\017\336\354\246D\374\270\314\261\231\034\024b\246\326\310T\245\222\025M2~\027`R\tc\223l\240\364\354\312\3401u\314\020\026V\232,\376\316\020}\334\005{9\376\362/\230O\357\275\223\226[\212\247\fH\020+\277me%\"\017a\222E\013\2079\346\253/t\364\341\275\377A\2331qY,\3660\230\240\212\"\\`\330\247\233>( P\270Y\301h//hX\374\035\030\372\257\267\177\336\312\251\275w\325\271\334SJ6\371\257\257g\255\"\376\233z\253"
+	.string	"\376\343\2751\220\201\275\227\370\300\366\336\225O\007aS\312\320`\377\377\317\272\275\227\266\222\"\260E\265\264\005\303\351l\213J\203\323\331\326NZ\352\221\244ajo%9\235\355\255ai)\211\004-*\2473\345\326\340t\266\2516\223\035U\335\313\255\244\275\244\2655\354\245\255\334gZT\0328-mQ9\235\005\311\242\"\222\205\0132\350\354\244I$JDD\"\032\032\213%\0303\220,\026"
+	.ascii	"(E\223\030|\310G\310XD\246\311\013\210\210\216\214\306\243\021"
+	.ascii	"\230\n\321\027\212\311\334"
+	.string	"\302\0219\224\036\215\300\240!J\204S4Y\204\026\345\344\221\004>\344\223\026\215E\024\220%hPB\n\027H\213\306\023v>\344\203\226`\030$\354)\201\226`\030t\363!\237\021!\200P\"\023C\343\004\222'\240\310\243t\210\006\351\250p\301\207|\200\220\303\243\211\021\004\030\0269\260\001\211\310\310\250\204\006!ZTL\215G\310\021\304\240\fRt\205\f\037\362\031q,v\310\037\362\021*\006\031\221\202\212\351\021\003@\306\022'\206\311\035$\243\343\b<\351\207|\204\214F\b\031\355\020\215G5\306 {&\205BF6\251\320(dt\032\205\214\356P*dD\2112\372B1\211\221\214\216D\214L\215.\020\n\004B\223G8\t<R(d\344s\203\204L\223E!T\205a\210aJ\204\222P\002\211\310\310h\030\"\271!y\002\2218\344A\016\323\025\210\304\341\216\006\244!\022Y\"\004p\210\243\002\2218\364"
+	.string	"\204\032QT\002\311\241\tD\342p\203\n)\232D\221\027x\020\032\"\321\023%\214\307b\211\024\245"
+	.string	"\2218\324 \331!5\036\035G"
+	.string	"B\323!\321Q\321\021\2218\004\221~\310\007\004\t$\233\024\002\r\217LP4\201\303\201\t\373c\302\2220a\177\206\226\304\320\376\270`I\270`\177\220l\tD\3420\370\202\t\351\321\bAF\027 \022\2075\347\207|\204\216L\240@#\200\210\212G&P\240#\nA\"q\250\223\004B\201r\202\034\370\244\310\241\221OJDS\235\242#2\205\tL\340\230\242'\206+\b"
+	.string	"5\036I@\036%\207(\n\005@O\024Sb\t\343q\004\"\261D\b\023\225\003\037\0237\347\307\247\250\210d\001%\0222\0165\334\220\360\001BO\f\223\302\234\r%\214'\030\240\bM\223H+\b?h\030\326\016|\206\267\204\220\321\206H,Q\204<\006!Q#\f\204\306\022R4\211\252 d\204\301\211E$jD\205\364="
+	.string	"A\001 \204\340\002\360!0\200\003\006p\220\037\002\003~~\030"
+	.string	"\302\217>\b?7M\205\311\r\240E\305To81%\022\2077\025\222\350"
+	.ascii	"\025\242@G\024\220\250\021\212\232\260\371\220\317\021\211$"
+	.string	"d\303BjD\213\320\023G\024\216H$!\r\202\214\210\204h\362HxLk^\030\022\346\2740\244\363\363CB\370\302\320\006\022\302\240\240cz\224\006\035\223<-\f\221\204)\232\f\n:\346\264p$\nB\242'2P\002\":D\274\321\200\032!\245B\022\311\344\320\250\205#\221\020\t\211\2368\022Q\244\006 \242\343P\022E\016\245\302\026\206H\026\034\2210\302\021\211$\324A\030dD\264\363\302\220\320\205ajD\211H\324H8\224\002\025[\350`\202\232\027\206\204\306b\221\016\362\230\016\213\212i\022\335\031\"\246G\243\320\210\004\224\223,\2720\024\n\035\231@\201\204H4%*\006\t\217H$\241\013\200\320\344\021\211$t\223~\310\347\004\ntD\"\t\215\0202\342I?\344\223\032\321\242#\241\206\022E\3074yD\3149\"\221\204,\310.\240@\306\342\231<\222@\321(\231\205\206,\030\223\304\234<\222"
+	.string	"\221D\261\004\221D1C*\024\032\262p,\002\205\206,\024S\027P`jD\213\202I!\2218<\323\017\371\024 \375\220Or(\035\026\2150\036\213\212\216\304\017E5)\024\032\005\355\270PD\246C\024\322#\022'\315\021\002?\344\223\022\217\220i\222DR\350\002\232\036\025i(\001\361H$\024\346\324xt$\n\205@$jl\341(\024\002\223H4yd\024\n5\220\261X\002\2410'\215E\243\244P\b$B\205\302`*L\223E\"\235\017\371$Q#\244T\001@(r8\224T\300\210dZ41\342\310(\244"
+	.string	"\027\216\214E\"\005x"
+	.ascii	"\202\020\204\020\\\030\201\002\035\021\021\215\305\021\310\344"
+	.ascii	"\321\210\005\244.\240F\242\241\021\211\246\306\242\020h\210\""
+	.ascii	"\207R#\241\260\303\t\024i$\024\3464Y$\022\n\3630\035\002\t\205"
+	.ascii	"\031}\241\230\024\ns\t\210G\"LD\221B\n\374\244E\343\t\306\022"
+	.ascii	"\322\242\261\230\221i\nD\343Q\t@CT\005\"\261\304\206\244\360"
+	.ascii	"\004J\002\2218\324\306\022\200\206(2\247Ia\321h\205 \224\004"
+	.ascii	"\324\b\211\005\341\t)\254P\203\022\215\3034i,\352T\230\201\023"
+	.ascii	"\260\261\230\2021I\314E\243\344M\nG qB\315\b$N\bf\"\211\342\375"
+	.ascii	"\220O\362\310\204\207\244\020"
+	.string	"\005 \035$\232&\207E9\231D\221@@C zbH\264\302\221Q\221>\022\236@\201\222G&tR\210\022\213'P\022\222G&jP!j\204\304B\362\310D\0205BJ\223G&\200\311#\023\227\002?B\"q\230[\030\2520\002\t%r\372!\237#\243\"\341\021\211$\204\236(\"\201\020\200\nU\340\340\003\016@82*\3321\036\213\351\021\3211\211\"3$\205\033P\341\nGFE59%:J\242*\030\217\305\224\210\246(\tGFE\026\240B\243P\221h(\3041\n\025\211J\020\211C\215\0044DU\030\246C\240 r8D\304(\320q\004\343\261\230,\236@\2216H\224\210\250\030\224O\240@\367\005\023\320t\250\002JdT4L\332\214@B\t\"q\230Q\2421\003ir\210^ -\001\204\246C \243\r\020\241Db\211d\321C*$\321Aj,\002\323 \024H\230v\370\220"
+	.string	"\222G\302!bZL\001\310X\202\210\350\210\334\261 )\024*\006\031\217# \321\024-:\352\027\206\204AFDB\"q\230!\025\206\220\032\213G@\0249l\001\b9$:\036% <\221\311 \341\220PqHH$\016m\322 \024\310\303\207|0\370\321\bE\216H\217G\344\210\032 4E\211\214\212\216#\230(\022\r\211\033\222 \210\210\216H<DL\213Fg\013C\244\233D\217\210\206'\362\2210YTD\262\220$\026\213\206F$\022\322!\241\"Q\020\207T\b\302Oj,\002\377\3633\202\006\033\300"
+	.ascii	"\0054\321\307x,\246C$J\204\022\211\303\021"
+	.string	"I\3441iD\223#\214\305a\321\b\"29\302'"
+	.string	"-\f\221\367\210D?@$\016\201\317\1775Y\240\210\271K\222\331r\264h\335\2002\303f\220d\265\2333Q\312\360-\227T\263)\257(e\231,\007\220\271\031\026\003\215"
+	.string	"\215"
+	.string	"\307\352\2362\363\004x\344\300\261\004@u\255"
+	.string	"\212\345,\201\345\250\002\212\001\3030\022$GtX\031WXk\026?"
+	.string	"P\372\007\202\001\213\270\310Q\346/\207\316\257\253\t\220\bp\b\023\277\250e\223'\245-Z\254\217\373"
+	.string	"\006\271\005\312\275\225\366\236\221%B\337\236\017 A\200@\246\220\215A\002\004\370c\317ma\352-\255\225\\\2319\340\027\036c\n@RW\027\220\307\216\032zd@\035\007\362\200\241F,m9\003\206\0359\274\300\200\\-s\030\r(v@/\254\024\224\221D\214\334\233\013719\213\257A\223\213\013\210\243N\355\215P\242qu\345\267\255Z\210"
+	.string	"\342"
+	.string	"\336\210\242t\313\003\336"
+	.string	"\332\300-\244@\371aD\314\2266\213\257\201\025\375\003\2672\021|\306\205\f\232\032'\234\222\2562\032@\255\223G\021/J\212\320\310@\226\024\321C\263\370\225\t\234q\3261\211\321\305e1P\006\020\353\300\254\003\263,0\353\376\375\3451,\314\214\2011\2001\352[U\020+0\"0`\234r\301\037(\032L\001]"
+	.ascii	"]\234uuOy`\304,\203=\375\003[\234x5\\\352\256\226\232^H\242\342"
+	.ascii	"\003Xuj5\275\030\271\243\272edaG\226\300):\025M\374\200R\230"
+	.ascii	"\313]\027 -,^\036\221\222\332\241\025uz\2212\305\t\024\213\227"
+	.ascii	"G\366^\342d\"0\240pSq\007\326|\nK\221W\347\307\224\365\224\317"
+	.ascii	"\340\324\225\375\351p\002\242h\002Ej\212].\205\341{\213\322\224"
+	.ascii	"\341\360\022\273&#L\347\032\360\313\314F\325Rmf\030Lf"
+	.string	"\324\224p\fo5\254\370P\376tB\006\r\034\221\244sK\002{P7\200\033\363\221\371\3132\263sp\312\\\221\032c\213 a\321\302b.\317M.\371\314\315b\263\223\314\266\024\220-.\215\030\277\355d%\242\006\211\n$1\214y>\363l\206\304\007\357\002F$\213\322\342\\\3468VrO\232\026?\373e2\1770C\220\033gE,~\006P\364\025`\366\202\212\312\342,\306\n\351\002\005\306\342\334\3677+<\277\034\231o.\205\365\250CbsjH0\306 \216\304\224bJ\321\bm\222t\223\025@ PP\036\221\312\306\311v\023\200\303\213l\264q H\035C33\"\"IAQ\n\205\215\003\312\026\332\272`{\"\bO(~B\037O\222}6d\314p\204-\230MV\247\335\376*\035&\357.qz\304\226\3131\231\323\037]r\316FP\022\021\272N\3113\326\361\177\036\323\2048@\345>\316*"
+	.string	"0g\3761b\006P\331\257 v\335\345\354Bb\320m\245I\035y\013\367*\022\231\303:\2567\341b\202\302*\343x\254\t#\245\240\204\226-3\370\276vy\255$6\317\341\211\3012\b\205M\253\332\021B\353\357>&\f\013@\2677\3409}{5e\226o9\177y\332\034\020t\216\211/\371D$\374\254Vg\253K\2563\313^\246\362\264\016\3202\324\306BE\354\274)\223@r:\204Fa(\304\273\357\261=\274o\374s\316\001p\217f\322\220qS\"\214qa\024\211\037\311:\344>\322\317\350\tU\t>'\367L.8\213\272\346\370d\342\222\357N\351\204\007\255\356"
+	.ascii	".\301\f\205\243e0\202czBI\262d\237\343\226\352\235\037\312\253"
+	.ascii	"\250\227\020\026j53\002\205\210\240\270)\347\r\024\246\316\b"
+	.ascii	"\366\031\320;\214\0309\264\255\013\262\307\031\321\2376\313="
+	.ascii	"%\375\361y\243\376\252oDG\323D!r\214\247\331'z\037\312\253O\337"
+	.ascii	"\344\260h\3313\317\"!b\005\303Xd\204\"\225\357\274\001\200g\230"
+	.ascii	"MN*\354;\223+\205^\f\003\311\317\023\343\332\204XTP\177\371 "
+	.ascii	"\300\020T\225\306g\371/G\251\0278\327\315\271\037\216\272\004"
+	.ascii	"\322\372+q\353\202a\213\210\207P\307\222K\233\373|\032*1c\211"
+	.ascii	"\016\355s\354\234\227\204\345\n\207\340N\237\314\302z\004Q?\222"
+	.ascii	"%\033\375<\020\345\371\242\004\025\211\004\352k\332\027\253\236"
+	.ascii	"\275`\325~_\263\246 \303\224\002\315\034\tr\372rG(\004\253\213"
+	.ascii	"\212'\366\034\371\021\374\0175\007\324V9V\224Aj\310\364'y+!)"
+	.ascii	"\036\220\004TK\031:\0341l\032\3307\2000\250\361Yz1#\305S,Q\324"
+	.ascii	"\262\2378Z\356%\234'\215&\275\003\341\265\320\335@U\364\027\272"
+	.ascii	"\317$\b\213\264\366\345\373\360\317.\001\222\366_14O"
+	.string	"\252\b\360\321\255z\332\253\240i{\027\216\035c\275\233}\257A:\304\273\303L\210\2677\317o\343\362\323\340\\\335\030_ma!\214!\255J\f\310\307\303\266x\310\232a\310\200\325\245\303\241*\241\277\216\34609\354|P\376\206\250\253\347\356\336\013\226h\277E\004TFq\245Cd>T\334\237\370\307&\002\351\222\264G\254\347\202y7FQt\263G\255\274\366\351Z?\310CIXi\325O[p\356cK\362\032 e\305\316!\375\330\320\206*\304\343\327fY\034\252\372[!MH`\330V:|\233\214\232#\244\341mZ\322\260\017\0064\223%M\265\022\032\237[\027\243\347W\313\b\036H\243\266v\035\025\374_f\031SS \343c\245\237\006\323\263\037\341E\327\277\246\335\370\203\304\032\276z\200&w\217\224x\373+\\*\316\353\333/\245&\177\246\005\260 aZ\373\353GE\266\337\013\345\332T\307\300\312\303"
+	.string	"z\f\204x"
+	.string	"x\362^\227!g\307\027\326\237V\230m_!g\021\253k\036\3275J\002*m\317A$\353Y\263\260\361\366\317\271\304nV\302\256\206\334\242\311e\332@\304\330a\223\225\243\300A\336\037 \211\207oX&\220\231)\250Ra\331K\013\242 b\27731b\227\202\016f,\224\360\350_\374w\013\017\314v\026/,\245\306\024\336T\361G\321x\207\334cp|\233-\032\213\221!\016\300\3526\326\3158\217\277\207\260|n\235\275(8P\3576\221Iwo\243Z*"
+	.string	"\006\037\264+\005N\2366\005\203\251\321t\277p\245\0266\347\206aOQ\201\225\317\353\261!"
+	.string	"n.k\362y\261,\346i\016\300>\373\263\364\247GA@\360\347/\350#\245L\241\350\025jy\301)\312\267\244\243\210\216X;@C\024\363"
+	.string	"[I\236\204u\204\271Kk\374T@P[\fc\232\206\2144\226\323<\345\024\n\333\262\034\327rVs\360\031=\224a\330\335\215Q\277\257H\035\322E\317\244p9 \261R\233\330\\L[\277\241\2611\245\315\033\317\213h\343@g\325\032\327t\b\n\230\207\363\244\201\362\220r'\245\230\264\344\320Q\353\266\365\246\233\031\253]\235\366\273"
+	.string	"\271b$yTQ\257\273\375\333\305\370"
+	.ascii	"\\\326\267>\t\251\312\033\b\232>\2001\332:\355t\027\311\240*"
+	.ascii	"\270z\200\036\205\364\360\261\243\225=\372\214\305\255\320\002"
+	.ascii	"\016\315(a\205\360\026\202H?\321\354\036\2276\340\003\211\327"
+	.ascii	"\031\320\007\347u\026\216`GR\316d\313\336\230\r\235\bT\023\003"
+	.ascii	"\216\r\235\336\177\355\331\340\351\t\313\277R\234\307\006czn"
+	.ascii	"\370\226)~\336oXH\366-\036\370&\321\212J\361\266~\213\245`!3"
+	.ascii	"\371\213:\270+\321P\330 h8\316\242"
+	.string	"\204i\037\251E\247\004"
+	.string	"\314\333f\213\202\2707b\271\242\320\216\246k\251d4\034\236\016\234\0319\310\253\253-\206h\002s\360\307\344\362.RIO\233\tL\335\205\241\230\334\344\314\217\024\326\313\232\251\005$\001\305"
+	.string	"\365\322\360M\200Z\350\277\301\362\030}Hd\311\253\240\333\377b+\272\217U\005T\262=\320u\005\311"
+	.string	"QbZ\267\354\004\364\232.\334QzT\321\201\373=}\035<`\253\376B\0069\031\002\034P}\0227\315\030\235/="
+	.string	"B\025\334'\363\001\254\023\243S\323]Y\021_\305\362_D\310\334\354\337\f\241\336i\237\236\376\026'V\224_\320>7\n\3116+\033]N?\204\201\241)\264s\366\303\026T\202\376\035\275\340`\271\262\n\003\225\312N\225\3470\300D[\255\312!\236\262a\245\222\016\373p\225"
+	.string	"\216\224\210\373\220\275I1V\304,\365U\013d\252\214\026\"k0\231\362\322\024#\260\345\310\363F\234\317\031\306\264B\341\312}%\017\b\320\306\276b\251f{K\017\215c\372\341W\301\202V\214\220\3449\316\301\251\326Y1\367\3122\375@\215\245\241\325,\n\240"
+	.string	"\304\rK\313\334;>\207\302\226\340$\001\205n\342\212\031\237\030\317\235\312\232\265;\001\003\302B\252g\342\254\257\021\345\221\341\013\301\234\210\204\\\336\344\372_\002h6j)\317\240M\024\022\360\312\235p\262O|W\211\327A\024\364<\330|\270\027hdl\225\332\327|\271\234*W\302\002\263\210\2133\030cs\276h\2702\363\201s\367X\301H7\013\233\367\301\337\311\2054\371\252F\254\260ASVMe!_Wa\025\225\253"
+	.string	"$\025!J\276`\254\331a\266\214\257\375\251\312\334\325du\025\346dE&xy.\371\304)\306\326Q\336\205\345\314\351\016\302\233g\177bL\221\340\355i4\022\333\233t\351]\356\230\257\205\352\261\231\367\221f\2112\222\034\332 \274P\026C\277q?\326A\212\250\016\256\370_]d\363\334rx\347\270\340\017s\001\3618\316pj\347gS\002\265`\306\026\300\314\215\223D\314\027\265\217).\031\342N\340\026o|\225l%\357>\215Uq\361\250\276\3116\270\005\214\f`\226\250\r\t\023G\340-\326\306$\341V\221\233p\303\n\373\233\241\037c\310\226M{"
+	.string	"X\317j[\200\343\350\003\305k\276\230\337\325\250,\023%"
+	.string	"\""
+	.ascii	"\232\275\333\032\247\307k\200\223\324\3659\031\262\275\367\t"
+	.ascii	"\213\nw\023\211C5\344\212,l\240L\361\310VP(\352e)\250HE\001\207"
+	.ascii	",\247\n\312\357GC\355\225\3477\202?\2314f\342Bu\217]\030x^\217"
+	.ascii	"G\313D\206$\031\245\315>\354\237\353Z^%\212W}\001)\004\274\242"
+	.ascii	"2\333\217\302\004\273\234\005\271f\270\252\007\253\030rA\346"
+	.ascii	"N\200x|\333\341\367\247\263N\363h\rL,\004\246\272v\376\277\252"
+	.ascii	"\353\r\277\327 \320\310\366\331\371\320\342\222\023\020\366S"
+	.ascii	"\305\373=h)\200\f\231\273\235\022Wp\300\340\361\201\2322-\365"
+	.ascii	"\001\031\352\032\371V7\002\331!\211\251p\033\\\r^\326}%S\021"
+	.ascii	"6B\364N\360\275\365\007xu\037\002\203$\003\244\245\r}\307\313"
+	.ascii	"\220d\022Q\r\356\207\217\023F-\2023\361\336\340\207\212\r\214"
+	.ascii	"\226m8\3749i\204\365\310\370\\\376\325\332N\233+\252\037\263"
+	.ascii	"T\302N\3056\363c"
+	.string	"u\311x[Z\274\3000$\023\326\225O\333\214!C\200\254\245p\221\220\006>\230O\200\213e\216\305\217\326\005D\342\r\344\b]\020\345G\203\326&\313H\203G\323\325{\362|\023\023 b\225\362z%6Q\312\036\335\334@h\204ee}`3dC8\004\230\273\202\374\007\264c\361\312\224\266\005Q\331\357\236\222\236d\016(YQ\360\022\005\371\030(\024\355\002\274*\340\232\242*b$\017\240\306\324r\260\214$q\030OD\323\265\325P\005\277\240F>&\336\205\224,\264\001\220\200\322b\222Vo\323\301\322\337\335us\236\331h\233\216\345h\331.J\335W<,\253\210D\317=i\3733\323b\272k\203\n!\325\022\037\025\307Y0\251\001\316\310\263A\004\202\237\312\237\356\315\361\302\222\301/s\305U\236U\334 \222\335\372\021\251\235\233\344U\022\3372c\324\333\021\230\231J\217\235[\313k\017\224\224\307X*\177"
+	.string	":\034\004\355\213\267\032\3400@\203/\035\327\340x\r4\363\317"
+	.string	"\323\251\200\316\250Rh\366:R\377\f\367\2451<\367\222\337\224\b`\267\2049\274\t\222I\216\365\250Fc\210\307\332\017\033\341!X\276Q6\2625\357\373\357\227R\336\274\0331!\r\205\230\241F5J\334\344\337\332\222\354\244\360A\b\304\344y\231\310\314N\345_\007"
+	.string	"_\212\201\257\263\355\265G\026\261\033"
+	.ascii	"\224h\324\267D\263\231\265L\032\3530\036rU\347\023\344\336\t"
+	.ascii	"\360c\021\367\017\370dXE\027\302j\221\361\203~\317&\346\275M"
+	.ascii	"\350\323@\023O2\030\274\005\016\n\204\037T\371\232rA"
+	.string	"\365\306\346W\024\202\352\233nK\261\226'\317g8Ya +\333\357c!\214C\375}}\306\227=\030\216e\217K\232\n\345\322\236\350\353\360]\240)\035\305\bH,\312$\304\206\214\215U\016d\2213\325P\032\fO4Ip\344\201$X\026\340\237\357\343w\357\271\260\026\211\036\204\315\241\fn\337f\022\b\243<|\032}\256\360\367K\177`\354\fY\277\300\360\365'c\247~a\344\020=,-\260/\260\233\331\320S\235F^\272k\251\234\345\345\347\211[Gp\352c\366\013\3739\253\017f\227C\373\311\373\340\273\267$|\215\"\254a\020\033\205q\316\227o\275\225\363\311k?\r4\305\336X\275\203\303~\303\246\337S\373\244\313(=\r9\314[\327F\215\373Q?/\325\342\251}\031+\377\261\274\275\246\036\222<V\352\3170\036\0238Lm0\323N\350\377\032\340\025\201\177+\340\201\017\374\216\363\260{\267\320\373"
+	.ascii	"\317\3511\277\337ya\314\177\212\374!\365;\002\364\0017V\\y\354"
+	.ascii	"\274\021B\361\005\360I}\323\332W\323\035\355\234\303\007C\313"
+	.ascii	"\227\234\301\266\345_\347\n\336\227\213Om>u\367\265\301\233\013"
+	.ascii	"\\\261^@\361#\206\277\305\355\211\bv\361|\006gW\220\303\003\367"
+	.ascii	"\2749{\244\207\307G\237\177d\373\233\314\262\367A\207=1_\347"
+	.ascii	"\302\234\227\236\032p)3\253\017m\267t\341\340\274\320\023~\336"
+	.ascii	"\033\350\317\364\357\0224\2000\323\275;'\275\024\324\247\265"
+	.ascii	"F[\236\036\277\340\334\201mo\024\366\266\352\325\315\255\311"
+	.ascii	"\031}\034\371\331\346\001\207\347^\370zdu\3504\335g\277W_`H\277"
+	.ascii	"\036\355\035\277\343Eqcu\342\344V\034?\266\335\355\375\260|C"
+	.ascii	"\013X\354l\r<\037$w\005"
+	.text
+	.section	.gnu.lto_.symtab.a99562ef6bafc67b,"e",@progbits
+	.string	"pgResetFn_accelerometerConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\002"
+	.string	""
+	.string	"acc"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\002"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\002"
+	.string	""
+	.string	"resetRollAndPitchTrims"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\002"
+	.string	""
+	.string	"accHasBeenCalibrated"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\002"
+	.string	""
+	.string	"accResetRollAndPitchTrims"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\002"
+	.string	""
+	.string	"accDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\002"
+	.string	""
+	.string	"accInitFilters"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\002"
+	.string	""
+	.string	"accInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\002"
+	.string	""
+	.string	"accStartCalibration"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\002"
+	.string	""
+	.string	"accIsCalibrationComplete"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\002"
+	.string	""
+	.string	"accUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\002"
+	.string	""
+	.string	"accGetAccumulationAverage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\002"
+	.string	""
+	.string	"setAccelerationTrims"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\002"
+	.string	""
+	.string	"applyAccelerometerTrimsDelta"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\002"
+	.string	""
+	.string	"accelerometerConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\003"
+	.string	""
+	.string	"accelerometerConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\003"
+	.string	""
+	.string	"InflightcalibratingA"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\002"
+	.string	""
+	.string	"AccInflightCalibrationActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\002"
+	.string	""
+	.string	"AccInflightCalibrationMeasurementDone"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\002"
+	.string	""
+	.string	"AccInflightCalibrationSavetoEEProm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\002"
+	.string	""
+	.string	"detectedSensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\002"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\002"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\002"
+	.string	""
+	.string	"gyroDeviceConfig_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\002"
+	.string	""
+	.string	"gyroConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\002"
+	.string	""
+	.string	"saveConfigAndNotify"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\003"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\003"
+	.string	""
+	.string	"sensorsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\003"
+	.string	""
+	.string	"biquadFilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\003"
+	.string	""
+	.string	"alignSensorViaMatrix"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\003"
+	.string	""
+	.string	"alignSensorViaRotation"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\003"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\003"
+	.string	""
+	.string	"fakeAccDetect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\003"
+	.string	""
+	.string	"biquadFilterInitLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\003"
+	.string	""
+	.string	"buildRotationMatrixFromAlignment"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\003"
+	.string	""
+	.string	"gyroMpuDetectionResult"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\003"
+	.string	""
+	.string	"gyroSensorBus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.a99562ef6bafc67b,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
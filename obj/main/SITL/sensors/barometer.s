@@ -0,0 +1,862 @@
+	.file	"barometer.c"
+	.section	.gnu.lto_.profile.5d8141ba49b08d5,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\020"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.5d8141ba49b08d5,"e",@progbits
+	.string	"(\265/\375`\026\001}\t"
+	.string	"d\f\n\002"
+	.string	"\036"
+	.string	"\245\357\300\317\017\026\002"
+	.string	"\002\001\002\002"
+	.string	"\001\367\255\350\337\016\n\002\003\002\003\002\004\002\004\002\003\002\005\352\263\360\321\b\003\004\240\342\234\212\n\005\205\320\323\240\004\016\003\002\006\006\007\b\t\274\205\242\255\006"
+	.string	"\n\267\335\335\337\n"
+	.string	"\013\200\333\377\224\002\f\r\342\315\302\207\007\016\215\251\367\230\f\017\350\300\306\254\005\002\020\347\327\360\252\007F\002"
+	.string	"\002"
+	.string	"\002\007\002\007\002\b\002\t\n\002\013\002\002\013\002\f\n\r\002\013\003\016\002\016\002"
+	.string	"\002\017\004\002\002\013\022\253\327\227\253\013\024\025\026\027\030\031\214\323\306\336\004\022\002\002\017\032\033\371\364\264\234\013\026\002\003\002\003\034\364\201\355\242\016\035\036\364\302\210\333\007\037\240\342\234\212\n"
+	.ascii	"1 \200\002JS\365\002\002m.lA%\001\222\030\360\367.C\333\370x"
+	.ascii	"`\366\201\350\212\255\357h,\022I\312]1\215w\301|P\013\031Y\230"
+	.ascii	"\273\260u\301\222\273\013\033\330\225\3215\037\002\346\203\204"
+	.ascii	"\233\2726\316\022,\3066\\!\267B*\0279\306\267\213\204\311Oj0"
+	.ascii	"\021\334m \353\217\255\274Z\250\020\336)m\016\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.5d8141ba49b08d5,"e",@progbits
+	.string	"(\265/\375 n\205\002"
+	.string	"\204\003b"
+	.string	"\f"
+	.string	"\001\001\001\003"
+	.string	"\002\005\003"
+	.string	""
+	.string	"\001\003\001\001\002"
+	.string	""
+	.string	""
+	.string	"\t"
+	.string	"\001\n\002"
+	.string	"\020"
+	.string	"\007\013"
+	.string	"\003\r"
+	.string	"\001\016"
+	.string	"\001\017"
+	.string	"\003\020"
+	.string	"\003\031"
+	.string	""
+	.string	""
+	.string	"\033"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\t"
+	.string	"6\205\244$T\325"
+	.ascii	"X\365Ma\177\326S\271\366b\335\006\332"
+	.text
+	.section	.gnu.lto_.inline.5d8141ba49b08d5,"e",@progbits
+	.string	"(\265/\375`H\001\035\b"
+	.string	"\002\214+1`m\322\030C<.3V\327MR=\214\303\234\004\203;9;X*\262hE\260\247w\323?\254\351`\253\241Qn\306\365@\236\254\256n\367\226r\247?\215\036\021\035\005N\236\214hp l\360;\210a;\370Q}&\026\362\365i(\304#\222p\201\304\326?\265\035\324?j\031\2151\226dt0$\0328Y\221\002\362\\-\tD\231\324(\033\303\250\266%\300aw\037^\007\330A=\310_\312\365z=\335"
+	.ascii	"]\240\f\334\276\250&ww+\277\311\016\222\220\t\301K\210\352C1"
+	.ascii	"\275NJ\247\247\022dw-\371k\243\026\273\033\375\345d\b' \360\002"
+	.ascii	"\2411\352\262\001\214\006a\241\346\006\225\335!\260\313\020\373"
+	.ascii	"\031\277\030\037\b\306\301f\375\270\032\031\232\206t\302\004"
+	.ascii	"\331\217kmH&)\3608\326Z\313\205L\036&\304\256q\222\327h\243\005"
+	.ascii	"\360\034juY\260\306\n\314\\Gv\034\233\300\326\320\200\033"
+	.text
+	.section	.gnu.lto_.jmpfuncs.5d8141ba49b08d5,"e",@progbits
+	.string	"(\265/\375`\316"
+	.string	"\225\005"
+	.string	"\262\311 ,pGI\007\220\352\003@ \001\233\357\003"
+	.string	"\b\250\017Z\fKP\311\205x\241\002\005D\201\036\306\037\360\217Pk\377\201\031\333'D\312\024W\024X1,\034L\257i\255\301`\232\n.e\337\247\bt\003\020pf\325r\223.&\220\b,'\250\244\213}Ok\2559\017\375\363\215g\274\"\322\037}\262\211G|\274\307\032\225\220\036\324\303\220\\\207\243\344\220\222S>PFMFqGW#\262\267\310\027\263\n\021"
+	.ascii	"F\271@*\n\\<\b\f%\203JPt]-\315\b\233\2343)\231\244\3144\004S"
+	.ascii	"\340\343p\323\324~f\212\212\312\225\005p\003"
+	.text
+	.section	.gnu.lto_.pureconst.5d8141ba49b08d5,"e",@progbits
+	.string	"(\265/\375 )I\001"
+	.string	"%"
+	.string	""
+	.string	""
+	.string	"\f"
+	.ascii	"\232\004\001\230\004\005\230\004\t\200\004\n\200\004\013\204"
+	.ascii	"\004\r\230\004\016\230\004\017\204\004\020\230\004\031\230\004"
+	.ascii	"\033\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.5d8141ba49b08d5,"e",@progbits
+	.string	"(\265/\375`\231"
+	.string	"\275\005"
+	.string	"\"\311\031!\240\265\225\003\377`U\277|VU\020"
+	.string	""
+	.string	""
+	.string	"\217\005\320\326lm\367\342WKf\311d\311h\223$S:\362\350lv\317\t\302y:3v\324\223\332-\236\212\021ev0\024\034\364\324\1770MJ\2002p$\352\232g\342C'=\245]\364\214^\253\312\313\232\030/\347\204f\026\005\234\326\242s\335\347)"
+	.ascii	"\230\004\327\b# p\202!S\036\205@p\271\337\210\210CY7{\030A\004"
+	.ascii	"/9\274sm\023\b\243\223\bV>\300\223\315%\nA\0018\321=`\265YN\f"
+	.ascii	"\362\306\343\262\265`,8\217\2301\344\300t2\026\276\270\374M\331"
+	.ascii	"d1p\204\024`1\335"
+	.text
+	.section	.gnu.lto_.lto.5d8141ba49b08d5,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_barometerConfig_Registry.18.5d8141ba49b08d5,"e",@progbits
+	.string	"(\265/\375 \243\305\004"
+	.string	"\224\bj"
+	.string	""
+	.string	""
+	.string	"-"
+	.string	"\005\001\212\001\202\200\200\374\342\303\274\234\021\001\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\316\007us\250\345\006uq"
+	.string	"\005\001\006'\001\016\005\001\006\035\001'\001\246 ?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/sensors/barometer.c"
+	.string	"\004"
+	.ascii	"\237\n\013&\321)\212\274\001\024\001"
+	.text
+	.section	.gnu.lto_pgResetFn_barometerConfig.19.5d8141ba49b08d5,"e",@progbits
+	.string	"(\265/\375`\250\001u\f"
+	.string	"6UPA"
+	.string	"Q&\035\003N\207\251\004\327\370D\374\220\247\334s4\377\311h\233\315\206\253\377\253\361C\273Q\204\277r\321\002#\356\276\331\031-\375\353F\313-\323\002)7\335.\034\211i:\320\2256\"\366';\245:"
+	.string	"<"
+	.string	"A"
+	.string	"\252\030'v\311\001\276LNM\336\322\235N\376\321\235Z\264e"
+	.string	"\250\260A\243\004+w\327\3434\\\374\024\375\273N1\241F\237\222\003\273\353iB]\270\271\333\026`\333\200=\013\004\037$L"
+	.ascii	"\331\300\341\324\027u\247\024\004-5\322H\363f\223\243\311e\260"
+	.ascii	"\037\331\3355\247\262\337\372'\007\265P\022\021\002c\367t\253"
+	.ascii	"\255\214\246\350P\261\375i\177\274\007\361-\321=v\003\326\234"
+	.ascii	"E]\325`m\276bf+9W1\303f\342\266\203\243\230\325Jw^\202\262\252"
+	.ascii	"\375;\211P\202\323\230\032%- |\004\306UFb\007uvx\030H\201\213"
+	.ascii	"ey\250\263#\374\025\232\354.\001?\033N\003\317\207\240\303\232"
+	.ascii	"\013X?\265\363\201\031\006^\b~\241\247\206\236\207\223\351x\032"
+	.ascii	"0\364.\001\374=\250\240\367\371>\320\253\220\373\310r*c0\310"
+	.ascii	"H\034\205\005\177Q_!b\2673wQW\267\3329\" \360\202\221In\205\253"
+	.ascii	"\"'\336hF\303\260\221\201\240\230\313\231b\314/GGx\370\007\272"
+	.ascii	"\215\373\330\221\031?\333E\030i:\301k\267%\221\324\035\336\216"
+	.ascii	"\350H\b\036\225\003\374k@\333f0o\002h\326)\221\207\027\255'\003"
+	.text
+	.section	.gnu.lto_baroPreInit.27.5d8141ba49b08d5,"e",@progbits
+	.string	"(\265/\375 \304M\005"
+	.string	"\322\211$-\200\305\351`\230,\004j08\001@\255S\315\206\260\214\214\325\333\357\007\326\356\301\355\202\227\332e\"\246\002;\\+\300V?\370\243\275e\n\226 *+9M\0329b\245\263R\262F\n\022MQ\2425B\b\317\210\244\261\232\223\306\207\373B-!\201\023\233\273\036\274\330;\370\177C\315~\207N\300b\363W\n\b\016@\340dl\357c\313\026Xn\373v\033\245\033\370\037!f\255}\226w5k\300\262k_\241\361\337\017\313,k\270\266\025\266\031\266\037\001\007"
+	.ascii	"3\003\316\231\021\340\313\3512\376e\\p\351\026\355|\002"
+	.text
+	.section	.gnu.lto_baroDetect.28.5d8141ba49b08d5,"e",@progbits
+	.string	"(\265/\375`1"
+	.string	"\365\007"
+	.string	"r\01776Po\322\001 \333\250\026\204\002\301F\2731\216E\023\240g\331\267z\037\215\217 _\b{\017\267\373b\263'\030\320 \205\203\276F\202\366\026oa\361\004\321n{\247\024\2216H\2068/\t\317\274\0264\021\321\343\334\261f\f\305\217\234\227\003\244SRP\244\020\364p}`gRhm,!\342\204!)'\314T\213gTs\"\273\212\2323\331\307\354\356\332\225\354\237\376\273k\324\026\026\203\224\335\321\213\313\256<\024\017\333\230\235\261\355\352I\260\237&\034\260\273\241\302\251\376\n0\255\331\017\271\b\366\021\212kvK '\273\365\300V\365\347z\002\352\257\372"
+	.string	"\365g\333\034\004\314\331k\307\350\246\217\013\223\226\335\n\035\307\263\267\314\027 U\274\001$\354\256\033\006)\343v\267\275\261\255`\273$\f"
+	.ascii	"A3\240\314\200`\330\250\260]\205#\327\224\213\211\030\204\317"
+	.ascii	"\324(\270,ij\342\275\212\023"
+	.text
+	.section	.gnu.lto_baroIsCalibrationComplete.29.5d8141ba49b08d5,"e",@progbits
+	.string	"(\265/\375 \375\335\006"
+	.string	"2\315/3`\213\322\001\320b\035\224\231\n\031\026\223Y\205}w\025x\335?\357\bo\033\252Wh\355\230\356Y\357z"
+	.string	"\bY0w\035\340\030uD\205\177K\210\224)\005\266P^\313\264\213{\025\005\006\237\203\230\006\031f\241ra\226\007\031E\300\216\241=\226q\356\261I\334\353Hu\300\243\037\373\232\310U\365 \322\347\031\327\320\370\025n\330\344\255S\376&r\352\n\360\340\311\313\216\235\324\b\373\323\352\310vZ3\375)\240\364\221p\355\206\256\220\365\240H\027\2669\366\304\006\007\034W\217\023\241SX\2006@v#S\211W\317\312?\306\247R\007\207%\352<%\b\273\353\264D\016\267\3366\201\355\002\333\020\001\t"
+	.ascii	"2\001#8c\216#D\250@\\\023\037#\362\022\"\207;gj\347\023"
+	.text
+	.section	.gnu.lto_baroStartCalibration.31.5d8141ba49b08d5,"e",@progbits
+	.string	"(\265/\375`\020"
+	.string	"E\007"
+	.string	"2N36Pm\222\016\244\004\"\205\262\251\002\036\260U\337\003\233\245\"\214\nI\252\005\025\375\237\355v\214-\033\241\335\301{s,[\004\221\371\2421!\327\250\3529\272!Bd\nk0\361\352\\\033,f\030`\026\261\214se\220\323\220\331@M\314 \246`\314\341\212\260\203a\021Z[\250\246\n\224T\244BOtQ\365\\\356V\020\317\325\370\341\343:ju?\227V=\365\240d\262b\021r-\277\211\334\273\370\002df\376J\377\b(N\024F2%ZX2U\221l\374\275\037=\201\352\361\002JGfZ\255\036\364V\253Zk\237\322-#+\202\212\bQ\311L\3700\252\325i\267\246\016\214H\020u\001\t\231\271\033\221&\372\353o\360#\374\034\001\t"
+	.ascii	"2\003\302\260\024aK\f\001\306e\n\240B\274\\\001.\335\242\235"
+	.ascii	"O"
+	.text
+	.section	.gnu.lto_baroSetGroundLevel.32.5d8141ba49b08d5,"e",@progbits
+	.string	"(\265/\375`\017"
+	.string	"E\007"
+	.string	"\242\r26@o\222\016xW\346e\353\006\301\214\266\331;2\211\210\256\003!\f]\256Wl\307f\217\271\263)\3211\2707yug$\214\256\241~t\252\276&!r\033\204\310\024k0\361\352\\\033,f\032`\026\261\214se\220\343\220\331@M\314 \306`\354\341\212\260\203a\021Z[\250\246\n\224p\240BO4A=\227\273\025\304s3\206\370\270\216Z\335\317\245UOE(\231\260T\204\\\3527\221{\026_\200|\245\177\005\033'\013*\231\023\251\226DU$\032\177\357GO\240z\314\200b\265z\320[\255j\255}J7\214\254\310\210D\310Jf\302wQ\255N\2735u`D\212\250\013P\310\314\335\210D\321_\377\203?\341\357\b\013"
+	.ascii	"2\003\302p\024a)\f\001\272\206w\207p@Eq*\362\345^p\351\026\355"
+	.ascii	"|\002"
+	.text
+	.section	.gnu.lto_applyBarometerMedianFilter.33.5d8141ba49b08d5,"e",@progbits
+	.string	"(\265/\375`#\002\365\022"
+	.string	"f\343\177I\300RN:r\230r!\212\001\365\235zI\244\032Sws\365d\3308r\305\032\215\310\231\330\2404\003`\265\376\361l\367\025\021\030S\001\356#\336\340(\304\342\364)\210l\270\334\250\2074\351,\234a\020\200\255mdo\271S\nj"
+	.string	"e"
+	.string	"m"
+	.ascii	"\265z\240\332\325ZS\254\322:\265\355\227\270\221\215iS'ds]x\332"
+	.ascii	"A\301\243\326\n#\371\210w:?\300;\335\334i\367\350\\I\363o\356"
+	.ascii	"\2610\345\030m\031N\247I\325\013\253\227Mg\216\364\024\215\026"
+	.ascii	"\344\364\371N\223\333\223\317\313V\233#3>\334x\322%\217-GJ\326"
+	.ascii	"J\255\325r\264a\270Y\267\375\3006\213-\033\004\022\207\316-\347"
+	.ascii	"J?a'\237\310\023\334$?\236\372n\362N\277S9\242\333\221\006\034"
+	.ascii	"\031\304\326\335\310\305\331\237u\203^G\372]-"
+	.string	"K\317\353\356\365\244%\225\276\b\n\207\333\317P\214\255\241\253=A|T(\n\003\304u\237r\245\224\323\266\361\223\034b[g'\222\232\256\332\016,\2550:9u\002y$\232\001\004BWU;\2728\237\306\006\031{\362\220!\252\035&\331\332]\036[\364\344\266(\331\250\311+\357\344\256\017\220\335%V\324\017\022\256\265]\341.h\005\244j\255\b|\026o!\363\211NM\001\004\275\323Y.\352v\3643\027w\321\363S\\\205H##\343\235\262D\354\030\241\343E\343\rj\027\347\224\267\226@.\204\322TM^\031\345\337\326\0065\337\313L\301\027!F\026c0S\363\315D\034\314`^b\337\202/\224 \212_\310B\363\315\004\330E%\374f>\031\030\306Z`b\b\212\263O\204\315`b2\230K(\302T\f\030\214\371B\330\f\b\206\260\020]\375\006\371@V\323\265Oz\311H_;\347z\005gs\274"
+	.string	"\362&\356\004\226H\325\212\363\261\3110\020\344\307\327\276\003\320\256GUmo\002% P\242!\350\366\221\003\316\234"
+	.ascii	"wW\354e+\324\352z\213\352\013i\343\024\r/`\002\370\013\237V "
+	.ascii	"`H\222\017\341.\031b\370\006\211\342@\006\034!\237L:\264\216"
+	.ascii	"qs\340.\024\2767\\C\201c\271\022\334\3407{\020(\t\007\025+\263"
+	.ascii	"\342\315Q^#\342\313\036cJ\321\241"
+	.text
+	.section	.gnu.lto_recalculateBarometerTotal.34.5d8141ba49b08d5,"e",@progbits
+	.string	"(\265/\375`\251\002E\025"
+	.string	"\266'\215K\260\324Q:\270dfbD\313\264\356\305{z\244:\230\211E;\264\bs\232\351\347\007\2639\327\2340\211\364\205\356\227\310d\265\021\202\331\245\0367z\206t\307?X\351oN9\317\203q\356\fwD\264\261\2415\333>!D\356\224\002w"
+	.string	"m"
+	.string	"x"
+	.string	"b\021\216\306Q\255\225\305\016\350\20191@\335\365\204H\260\3246p\340\346D\027\274\265\376\200\034\325\ndq\313\352\243m\177\305Y\3348'\002I\364"
+	.string	""
+	.ascii	"m\320\tJ\325\n\214\rx\n\371Q<\214\374\270#\236\273\2704\347?"
+	.ascii	"xq\210I\310\353\351.\362|E\002\277\034<&\275\235\230\302\243"
+	.ascii	"\347\351\301\323\235^\016\245*\005\265VS^\317\303=\336v\003\333"
+	.ascii	"5\233:\005A\2669\211\236\367\321w\022\371\361K!\350\351\327\302"
+	.ascii	"\207C\223\330@\035\335\037\373b]\037\033\345\300\033v\340\177"
+	.ascii	"\362\242\377u\242\337\325"
+	.string	"\272\321\315RQ\257\226Z\245\242&\227z\\jq\251w\251\351R_\345)DHEM\020R+\207$Gj\323\210d\342F'\351H\327\276\361\203.\261m\344\341J\327a\365\002\310\007Uk]\371\350\n\001\013[\252c\\ro\341J\270\325p\\\026\022\216\rqYNJ*|\273\2661\274\006N\305G\255\025\201/\374\221\314\017\372\350\232\331\214\3748\016yC\\\364\2656L\f=o\227F\t\325)\250\335\352\304\375\271\f\351\313\370\f\031\232i\222\037G!\341P\221\227\340\375\232v\177\334Z\272..~\354\250\021\273\226\356\271\324C\007I\201\177[K\203h\370\345\034\306cx\350\0076\345K\215\301\315\246\254\275`j1/\262\022\302\003\\Y;\231\221\335L\t\345Yc\263\225'\215\353V\2531\027\224344Y\204\227g-gy+i\346)s\211\331N\323V+m\261Z\214\214\026\233\235\266X\213"
+	.ascii	"\2334\345\031\273\231\346\031+\001\326\257\217\357\204b\307\256"
+	.ascii	"\274\004\b\204\216\220\266\226\265;\266Q\326\344\003\221&\234"
+	.ascii	"\3151k\231T\031nL\371V\013[\224\023\252]\315|\t\267\302\241\232"
+	.ascii	"B:Y21 \240\"\031C;TF\222,]A+(mk\315C\026\b\021\242\263\262\354"
+	.ascii	"\345\f\343\333\023\007\n\365\r_\214\305\t\204\272F\007(Ky\331"
+	.ascii	"\262|\270Bj1\315\231cr\316\326j\223\302\020\034\237\355\205\271"
+	.ascii	"\335\001\371G\225e7\353\221\340*>\306\250-\237\306\002n\246\216"
+	.ascii	"\225\007\210\325\032\302\205\201\307\233\215\351\235\f\024\305"
+	.ascii	"5c\323\350\024\r\356\001"
+	.text
+	.section	.gnu.lto_isBaroReady.35.5d8141ba49b08d5,"e",@progbits
+	.string	"(\265/\375 \352}\006"
+	.string	"BL-3Pm\222\016$\241\212\200\270\252\243aI\006"
+	.string	"\210e\274\271\312\336\222]\265\177\267\303\256\215P\352\340\2759ff\210\234.R\271/0S\207\3064K\266L\001c,o\332L\031\367.\013\215z\216\322LT\3230\\2\r\363\250f\031\3305L\257m\234{\255re\231\b\031\301\207=|9\332Q]\214\0358X\253\322\345"
+	.string	"TB&0\361\301\321_\036d\024_J2\321\217#3\b)\311I&hd\222#\022H\306\337\371\312\b\t\235\253^\026\240^|@x\224d^\215U\264*V\267\033\245h\210\214\254\220\247\030\240\220\231\243\025\222\350\254\177\301\177\360G\004\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_baroUpdate.36.5d8141ba49b08d5,"e",@progbits
+	.string	"(\265/\375`\314\f%5"
+	.string	"zV@\023H`\\R\007{\"\366[\311^\267\373\252\017\301\006S\362'\374\265\335\314\023\031\235#@\301@\343~\243m\303W\340i\351\n.8]\t\340t\227\210>\017\n+\024,\017\377\201\250\332\327\252\371H\327\b\331{\357-SJ\001\025\001\f\001-\001\277o\241\373\375\266\337A\3407\360\367\375\003~\273\277\357\326\375f\333\357u\375V\331\357\274~\277\372\355\023t\212h\021\221%\216\235\372\324\304q\353\224\037.\365\374\337\355\335\375\242\235\254\203.u\341*\231\356\222'pc\342\270,\201\257\r\344\372\332.\346F^4\254\226A\233\354\0237\2463\2758.\013B\272\221\365Uu\"\353k\316r\330\215E\"\016\200\033\233\241\360\r\002\177n\313\256j~\270]\250\316\313\262\251t\343\202\266 \305.'\272\034\263\213\353q"
+	.ascii	"\264\023\254\236\266\374F\013"
+	.string	"\3726\352\001\264.`\376\305\324\241\036\301\244\322\344\230\316\037\n\277\230T\377Z\360\232\n\002\177\276\2308\376\367^\356\376X=9\275U\221rL\247\212\214\3438\330dz\326\311\374\002\327\036\031\253'/_\253rL\271\025S\n\006\013\234nM\201\315%V\265\341YEP\365fc\330TR\215Z\256\350\234\314\277\251\231\364\337N\210\343\270\177\331|\362>z\267;u\367\203\356 \232;\224\262\262\273+\270\334\205c7\006\327\222,\316\305q\354 \213\307e\320\260a\003\353\353\232\327i^T\212\364}\355i\236\303\026\247\3745=\335\232B\327\374|k\207S\271\332\332\3352\325Z\273\225w\242\322^\305g\310\210\322.\305C\260\276\366/\343\2464@\342\035\335\016\245\273\355\3348VzUw\267\335\027c\030\\tc\3428>\200dz>45{8\243\346\334\335\n\334\t\007\033h;\023o\342\241\275\313\327\376"
+	.string	"\002\304\262\314\347\234\235\211\317\317\\I\210\026\"D\260\276~^\237wQ\367\261\254\212\313>\202\365\\\302\354\213\322\243\351\366#\216dD{W\223\030z_\372\332>\304\372\352y\r\023\263\347D\372\276\356\262$W\343\374\354v5\316=\272%\b5p\251\367\217\373\215d\277}\330\357\236\367\233\207\375\336y\277u\324\357\001\300o\001\302\357"
+	.string	"\357w\216\372}\024~\033\337\357\342\373M\f~\343"
+	.ascii	"\277o~\3376\300\357a@|\300W\355]\304\334\342\275\3559\031tq\361"
+	.ascii	"\360\262\327\202\263\334\317z(|\005?\341\254\367%\234\205\263"
+	.ascii	"\224\225Z\377\204\271\216=\222\305+\234\274\256\275E\245\017"
+	.ascii	"\304\340\352ln\236\007\005#\364w\274\016\233|\223=x=\025,\306"
+	.ascii	"\003\315\221\314\201N\331\344\026k\355\212\277nV\206oRj\302\341"
+	.ascii	"\337\370\250\207\022\346\341\217\257\361O\337\024\3466J\215\315"
+	.ascii	"_7\261\367\315BA\336\351i\374\2147\377\242\322\332\276i\b\332"
+	.ascii	"\313\370\030\317\024\204\301~\351\302\361\225\222\305O\n\346"
+	.ascii	"u\rm\352\257\233\216\340\332+\361\316\200\371y\306\201}|I\003"
+	.ascii	"\3205\277\f\f\3634h\366~\271\215:\233\342\257[\215_~\372S\331"
+	.ascii	"\345\tq\363\263\363\316\360\351\335!\230nUi\363\263\375\004\353"
+	.ascii	"f\2672\003C\340\216B\321L\322\300\\\2316\273\231C\324\307\300"
+	.ascii	"b;b\222G\2736\267P|j\376Z\311c\331,!\377\232\206\307\234\016"
+	.ascii	"&#\020&\3313\007\206\315?(5Q|n\r\313\323\273\363y/\363.\024|"
+	.ascii	"\346\342\030\311\227\\\222\005\240[\326\334\020\002D)LtXAD\204"
+	.ascii	"\342\350\327C@FD,\210R\024\031\221(\021tdTt\244\202\350(H\205"
+	.ascii	"\t\022)\202\206\214\216\202\200|\272h\005\221Q\020\213\242\""
+	.ascii	"\243\240`\031\222\347\036\355T\260\202B\331\307\256\320(6\310"
+	.ascii	"-\304\260\270\355\234\273`}\214\214\306*!\377\344\246\356\376"
+	.ascii	"\311\303\251h\034RN\312}}}d\214\310\334\340\341`2\002\377\226"
+	.ascii	"\354\371+\310\374\213\242\213J\213>@\337\306\346\223Y\320\211"
+	.ascii	"a\342\353\371*\2776}\357)\313\223{\246\360\344\026\253K\324\271"
+	.ascii	"\263\340\243p\310y5\235\274\223\246\223[,.{8uw_D7\363\001\331"
+	.ascii	"\255\376\311"
+	.string	"\200\334\016\341\022u\342\254\036\202e\302fa\003\240\004\213\336\235\016\234\035\336\215\200\245Orb\347\315\222G$\002r\033\205%*\r\220\313r\335\262L\204'fc\316\221\0017\275/\003d$\214\254\354c\316\311y\306\217\301Nn\034+9\350\027{#p\263\006\f\005\305\372z\314\236\246%%\362Q\370\006,%\305\372j\314-\036\334^q\352\207\204\201\025\363\017\013.\352$\346n\230\352\203\300W\305\201\004\250q<\347\0344%\"I\nR\3104\006\021\006\204\020\346\\\261\003\021\340(b\0169TcKm\006\222\002\007tU\326\211\352>\313M\223\256!YY\330E\214\214tY\013\2336\252;\312\322{=^\316*w\306\375\255AB\234\331\310\330A\222\b\274#\215\0254\222O+Y\226\351&IA\255\360'IS\216\r\312'\354!\267\203\272\327ZTr\252\245\205\261\257\365\241\337>\005\245\311\207(\256"
+	.ascii	"\225G\366\310Fh\033n7\f\244\027\373\361\210\266r\302\336\006"
+	.ascii	"\330\204\375\3321\337\3064-3\266\335\227\355"
+	.string	"\252\320\307\302\313\230\034L\254\204?\325\273T\242\216\231\004\377\250\364\303j\222\374\214\b\016Z\375G)\233\363\225'\001\027l\211v`\275\354\374\262\242\301b\035\322\3562\033\331x\344\205\250\032\303t\267:\364\003\"\017\227\007(\241\200\347\315\224\007(A\317\336Q\217\002\223e\203\244:\250\345\354\307\222L\024\250\033\354Q9v[3\032\326\026\023\332.Y5\361\201+r\344\246\204\003+\242\b\023K\233\243\211\276x\276k\035\257\232\311q\222\035\214Q\370\177\254\314\211x\363\037k\036_\224[k\257\\\307\256\327\004Z\244\377\3056#\006vw\250w~\360^\001\266nK\251\f\245\241\b\241\323\013\205\347\023?W\032\307Gr\337\224\027\027G\370\374}\262c\027(\270\250D\234\323\302\276\201\351-\241\323\235'\3500\016\210\333\244\003\374,@\276\304\005\t[\205\334\243\034\220:\370\241\033\314@\223azE:\225\213\311"
+	.string	"\026\351d/\345\314"
+	.ascii	"\267\016\375b]\203J\242\372\226R\372\342mn\277\356\302ETdF\224"
+	.ascii	"\275\266\217 \345\242\340\226\322\024\361V\003"
+	.text
+	.section	.gnu.lto_baroCalculateAltitude.37.5d8141ba49b08d5,"e",@progbits
+	.string	"(\265/\375`Q\004-\034"
+	.string	"\306t\265I\240\232M:\226I0\355#\001S\324\216u\035\324\242\257\315\244`H5e\030\217\0362zF\326\205\274ql\024\236q\256%\371\265\2076]\212\3311\n\202\nc\fL\206\306\217&d\300\243\232\241I\321\350'vo\"\245L\001\231"
+	.string	"\222"
+	.string	"\244"
+	.ascii	"\223\037N~\207|n\376\022\020\372\232\202\004\244\326\247\260"
+	.ascii	"\257\3325\217\324X\340\356\277\337\036\213\365\217\017\261W\357"
+	.ascii	"\024b\306\235\177\210\177\334\271\277\210\257\325\307\005\222"
+	.ascii	"\342\222\t\021\310\f\257`\255\365\300\316\333\304\235_\035\273"
+	.ascii	"C\304\311\360\n\306\217\316\220\342\224E\246\326z\253\355\214"
+	.ascii	"\356\f\227\207\356\354\027K\356\f\233\311\357Zm\310\325\245\213"
+	.ascii	"\357\267\264\023\305\2065?\024\333\241\201\240\0211\262_S8{\242"
+	.ascii	"\341[\253\345\022\277\036s\214A\255\365\354\373\235\330\323\375"
+	.ascii	"o\341\277\202?\304\021;\2717\212\027p\203\254\020\243\\\207\016"
+	.ascii	"t\3476\202\024c\252\026\206\231 W\267\324\021%\352\265Z\035\037"
+	.ascii	":Z|\241\342\325\304f\376\375\261YG_\031\367\240\343\365\355\374"
+	.ascii	"\352\350N\242^\254\345*\251.(\036*\2308\354\277\352qK\375\033"
+	.ascii	"\326\216\372\317/\022\371DC\013\334\327&_(\306\017\242|\032\345"
+	.ascii	"\003Q\376\017\345\373P\376\214\362{(\237\207\362w&_G\344\347"
+	.ascii	"P>\316\344\313&\377&\306\267\241\374\221\362k(\237\206\362E\312"
+	.ascii	"\2175\2376\177\006_&\333\344\001\204\b\021\350NY\217.\276\252"
+	.ascii	"\2007]\353\241\336r\252\227d\225\220\022&L\240;o\232\216i\242"
+	.ascii	"\302\246k"
+	.string	"\315[h<\366O\241\002]\237M\327\232\234\242n\330\306f\260\222\212\246\277\265\265V\256\351\320J9\345\303\337Z,/.\026_b\377\026.\360\372h\2726\242\227\376\255\225\032\302T\353\027\204\205u5\325\3124 \326b\207aJ*\332\261\246Zep\3666m\232V\231#\354i\333\356\260\003h\225P=\016;w\367:\2359\206\325\312 \326\332\224\340Kd\213h\370\312\330\371\r8\034\r tJ\033\224>4\330\361p\016\306\033\331x9\245\234n\307\303q\270%\361vIH\271\244\033\322\021Nw3\342%\335l\002\276\003\221\343\335\224v;\336m\274b\332\260vTQ\327\230\272w-\244\350U\324\263<S\0068\017,\226+\363\n\030\0310\274d\304\223\215\360B]\205\224e\241\262>/A-\324\034\206\026\004\324=M\353\316*\241~z\326@\035\300\347\247\005\200\225S=.;\355\323\005\264\206z\326"
+	.string	"\254\364H\254\350\342\302\323=;\215\323<\275%\225N\3574\205R\006sZ\207\344\261PH\253'9\275Hb\310\032\247\033\254\f6X'\244XkM\020N\250A(\345\020r\210\031\223I\0234\255\264\030\220\002\031A\3329\021@\265s\220LAn\007\322\245/ir*\206\275\004\234??\263\232\020\276\316#\237S\032Ha\027\254vZ\"\324BU\227u\020\004\326\311\264\227\225\n\330\204"
+	.ascii	"H6\310\216-v\327\330\320\230\241\320\373\375\236\223\017\037"
+	.ascii	"\331%\343\313x0\022{\345oDD\2070\320d\006Y\267*c\300\261O\310"
+	.ascii	"\313i\fP\202\215\247\236\321\030P'\205`\261^V\256\223\013\"\032"
+	.ascii	"N.\2119E*%\3529\202s\372\3362\264\214\231\301\257\242\fE\274"
+	.ascii	"\223A(0\3636\254q\254?"
+	.text
+	.section	.gnu.lto_performBaroCalibrationCycle.38.5d8141ba49b08d5,"e",@progbits
+	.string	"(\265/\375`\030\003\365\025"
+	.string	"\246\247\211I\300\020)\035b\262\372D\365\272\364_V\246\013T\220\2337\224N\231\376N2\262\237\375\336Y7W\321\333\325\333\374~\377\2249\031\263\243\356\376lo\344OQ\264\376\025\035\321\022 <\312\307\314\314\315\316\255\375\237l\222\244L\001o"
+	.string	"i"
+	.string	"v"
+	.string	"k\326\327\253]\253v=\212k\371\265\270\353\357zw\255&\002H4\321\004\347\3040\234\232B\231\004BWmu\271\306\246\241D\036\246\006+\334"
+	.ascii	"\243\346\234\264w\320\032\225\342\267\306\252A\312\352\371lT"
+	.ascii	"\346\250\250B\231s\266|9z\261\300\016\214\f/\337N\2245q\230\241"
+	.ascii	"A\272\026|\272]\025\312\234\323\333\363\341\250G\265\235\300"
+	.ascii	"\266\001\373\027\002\265\332\250R\376\344i(WB\213 \270\274\274"
+	.ascii	"\214\256\021FR{\375\177 oG\267C\323\250\225F\375^y@:\025\322"
+	.ascii	"!\030k\217m2\253=\225V\231Q\245\336\345d\364\243\223\333\241"
+	.ascii	"M\244\333\377l\025\347\234\323\347\261\277.\031\327$\343Z\266"
+	.ascii	"\353\330\256a\273\036\221k\021\271\016\221k\020\271~\311\365"
+	.ascii	"\307\256=v\355\372\272\365<\037\220;\250s\316\r\271\b\344\205"
+	.ascii	"\210\255\203Z\364\204\244a\352u{\001\203\325\036\310M(\334\306"
+	.ascii	"\016\352OEnN\237\f\207\302\335\2349\002\037\177]y>\036\377\270"
+	.ascii	"\250\304\253\341\272\307G\234(\034< \327Sh\017\252uW\311Yo]\177"
+	.ascii	"\326\017\\]|\311%\023\017H\365\325L\307\253\016\200I~\274\336"
+	.ascii	"\354p\0035z\260\232sw\300zB\201+\326\036\225n\tn\231\335j35\030"
+	.ascii	"\333m\205"
+	.string	"\205\206\273\331p15\034-\306e\005\206\326r\303\321f\003l\213P\273\321fl\266\033\315E\224\323\363\330\201\2200w\235\204]\206\004)\247\036\024\311\231\206CM\031e'y!\273\\Z!\245\263,n4m\020\377\323\224\321\352B\227R\020\250\2508\035E\331\320\017\275\035\341\377\213\035v\026\023O\273\315\321bB\354\254$\330U(\216~tF\220\024\210|$Fn\2077<\"f\"\017\240#G\250q<\346\024A\214Q\345\024)\303\030\240\002\021\272b\007\020hHD\031\0162|;\347y\3102D\355s\305\f\206l\\f\322\366\254\265\335\243\224\307 Q\334$Z\223\013D\b\275\252\340\305F\210\232JW\317\311\204\177H\210\270y\217\017.M\321\3656\260\246\231\025\311\300\241\2444\342\266C\\\242\256\177\251\330A\255\035;W\341\336^dl\274\263\265e\"\016b\234\347+g\240?\343N\205\362\240\035"
+	.ascii	"\331\207\247,p~\201\315\272\2416\027u\305\336\217\0345"
+	.text
+	.section	.gnu.lto_.symbol_nodes.5d8141ba49b08d5,"e",@progbits
+	.string	"(\265/\375`\310\001\335\n"
+	.string	"\202\217<90\257s"
+	.ascii	"\003J\315`\036\t\006\332 |g\312\251\003\316\205`\333v\204k\033"
+	.ascii	"p6\227\021\021\372\311'/\254\320\265\256\357\373>6\335a\332\034"
+	.ascii	"P\335\317\317\177P\"R\246\024\213\021\021=U\003`\202\300\312"
+	.ascii	"\255\210`\375\312n\333\320\2742s\006\3200%w\362\236#\347\254"
+	.ascii	"\333:$\273JRX\272\253\254\302\333\377?w\345L\346\231K\013J\310"
+	.ascii	"\025\303W\027\316\342\377\337\375\274X\270\212+\272\336\375\200"
+	.ascii	"ytl\2744`\031/\216qY\006B\341\365D\253%\b\"\\D!8\375\340!\272"
+	.ascii	"1\007M\003\310\371\276\201\336\030\230q\225\232\201\324\273\033"
+	.ascii	".\214Z\301\021\022\374\200\266<d\371\207\256\004Z\345\006\243"
+	.ascii	"\027|-\345\036\324\351\3241\231J.Ro$\245\272\356\262\354G\250"
+	.ascii	"\336]\356I\362ID\016\"Mj\273\276{\022\302\333\377\177\3107tw"
+	.ascii	"\251\0310 \360\002!\252n\276A\264\26134\372\321\310\227$8\301"
+	.ascii	"\b>\301jDA\355\274B6OK\317\223`(?X\016\334\016\347\241\221\375"
+	.ascii	"l7\214\033il\334a\246\303\314\311\2541\024c>\240\321c\376\310"
+	.ascii	"\351\360xAb\017\221<\f\320\331/\3403\n\017\330\0313\226\3613"
+	.ascii	"bl\001z\310\f\2343\266\033\355\345\307"
+	.text
+	.section	.gnu.lto_.refs.5d8141ba49b08d5,"e",@progbits
+	.string	"(\265/\375``"
+	.string	"\225\007"
+	.string	"\266\0248+@k\224\016\3030\f\3030\f\3030\f\210\252\2426\303l\273a5\2022o\212!\022\037\213\377\326\375\fG\r\326\276\375om\313\024+"
+	.string	")"
+	.string	"/"
+	.string	"U_\336\3271U\271\317\r\2002z\335S\247\234\316\200^\202>r\036\202z\363\264y\226\030\034Z\376\301\3560\235Yz\361:_\213_\2208A\376\344u\201\304%\371[>\344u-\361G>\366\272\225x\346\277\327\251\304\033\371.\177z]J<\312w\3367\001?\242\277\310\257\250:E\325'\254\227\250z\304\365\020\216\177x\335\341\365\206|\006\254/d\257\200}B\366\312\365\b\331\017\254\247\\8\305\302\r2\217\022\3140`9\022\351\233\353\232\373\207\353X\344\257\355-\2553\266\336d\317lC\246'\371\003\3313\373\227Oi\317d\277`_\027\005"
+	.ascii	"I\303?\375\020\002\216%\305\b\200\245\310"
+	.text
+	.section	.gnu.lto_.decls.5d8141ba49b08d5,"e",@progbits
+	.string	"(\265/\375`G)U\273"
+	.ascii	"\232+iAY0\nQH\351%\341\027|[2\217\301\203\376\361XO\220\200Q"
+	.ascii	"w\f<\360\003\245\245\311\276\206\037z\213\034\216\352g\326z`"
+	.ascii	"\021\201_y\343\366nJ-[\313\177\277\271\273\337\331Bu=H%P\252"
+	.ascii	"\272\f\210\245\232U2\377\253\245\177I\3110\344\204\262\307\326"
+	.ascii	"\346\367\3362\005^\003!\004#\004\307zkRm\321\316\352\342\327"
+	.ascii	"\213\331\354\261G'3+\365\2769\350~8\350\376\232\254H)-I!\324"
+	.ascii	"\373\212\374\253\261\036q\320\322\306\352\345\311\3159\242\327"
+	.ascii	"\354\201*"
+	.string	"\246U\275C]\341\004\271\372\025\302\361\251\336\267\334\337l\232I\307U\346\004<aq-\234\352m\270n\323\316ci7\3577M\366\234d3;\333*\213\321\252\336[\223\340\025\273>\026\035OW\3205\030\321{M\005\335\022\252\231\177l\030Y\21385o;%dT`\365\366[m\267N\363~k4<\311~\2739\037\2735\370tk\300\3012\344\350Dw_\265\360\337\317\r896\205\253\317t\333\235\361\304\206R\275f\202x\260\224\371\362R\357\353\024~C\221\262\366\324\262\245\307\312\310\262t\271\202\305,\n\027.`:\255\313\264\t\035\246\3074\231f\353\265Fk\265v\266\2306{{\351/\257\315\234\2239\347_\320EK\230X\217ya\322\354'>6g\035c\256\272\316\372I\237A1 \t\231\346j1m\245\253\364\331\217\r\270\276<sn>\304O\364\203\b\321b\272\254\307. s\326\221#"
+	.string	"U_2\314\340rnv\b\352\240\233\362\002fM\320}\257\341?\333\202\316\247\311\360;\n~#\301o!\370\035\205\203\032\006\316 \002\314\241\204\236\023\220\234\360\246\336\027\361}\330\002\020pOi\022\332\271\241\251\274\301:\312q\216\315\334\254A\344\2428\251\367\023\300\357\r:;7\327\033t\177"
+	.string	"\006j\013\272\032\326\026t\335\244\275\332\211\241\277\016\"\304\255\321+s\345\334\374\271Nf<\210\324\373\005\340\377N>\201W\016\361\037\374\306\240\353\271\306\240{\305?[k\013\272\277\2274\027\006\253Tbf\260\234\233\024~\232NKU\365\276\331\026t\270+\350\232M\350\267b\377K\374\215T\253\036H\340\257!:\270\006\376[ \255"
+	.string	"\277\215\362\367\212\277E\250\021\250$\352\210\277\223\177\347\277;\220\342\357\340\337\300\277=\360\267\212\277Y\374M\374\273\370\267\001\376N\377\036\376\267 \374\333C\345\240K\205@\275}TA"
+	.ascii	"\376\007\375\255\373\177\241n\340\200\337ZQ\265\214\352\200\r"
+	.ascii	"\326\350\257\bh@S\317o5X\331Q\031\3607\316oq\374\257\031\374"
+	.ascii	"G\200\356\267L\367\2670\336\277\025\301\177\023\376\203\371/"
+	.ascii	"\346\377\327\377\263\377c\376\223\371\037\346\377\332\177\266"
+	.ascii	"\377hi\247\360\333\013\374\225\202\277\016\340\257\030\376*\200"
+	.ascii	"\277N\360W\241\277^\370k\206j\200\212\363W\t\376j\241.\340?\320"
+	.ascii	"\177G\374U\304_\211\376\272\341\257\006\370\253\206\277\333\376"
+	.ascii	"f\373{\355o\265\277\323\376F\373\373\313\337]\376\346\3627\331"
+	.ascii	"\337W\376\026\373\333\312\337T\376\236\3627\330\337_\177w\375"
+	.ascii	"\255\344\357\255\277\215\374\235\365\367\220\277\201\374\275"
+	.ascii	"\374\333\307\3379\376f\376\355\363\367\317\337\365\177\334\177"
+	.ascii	"\267\377 \374\247\362\337\314\337\306\277u\374\035\202\277o\374"
+	.ascii	"m\343o\250\277k\374=\343\357\246\377o\376\227\360\367\213\277"
+	.ascii	"\225\177\273\370\273\305\337I\177O\3607\320\337\370\357\335\337"
+	.ascii	"\366\277\334\3774\377M\374?\363\277\355?\327\177\022\377\313"
+	.ascii	"\376\373\314\315\315\315\375\327\371\357\322\037\303\\\031\362"
+	.ascii	"\177\226sr\312\270\301\024Sr\352I\351\234\312\306$\021#\205e"
+	.ascii	"\2362*\2359S\310\311\244\221\0043SP:3SN2\201\251ss\312\230\223"
+	.ascii	"\314L!'\3631\20329\305\244t\036\231((\235SL\3319\225\201r\362"
+	.ascii	"\270|\221\314K\n\3319\205&;\231L@J'\223I\351\234\212\3525\345"
+	.ascii	"\233\033\223\030&\025\225n\242L\346\030KQ\307%\320\231\262\311"
+	.ascii	"\314k97X\213\274,@\316Q\314\345\332\361\251\303\220g1\220$\034"
+	.ascii	"\231-\264\204\244b\346\344\231R\213\231\263\0262E^\302\300\330"
+	.ascii	"<\313V}f\254\212\312J-r\246`)gc\347\263\234\2631\347\274[F5s"
+	.ascii	"\276\001\244\274ZZ\312\031*h)G\031\305Z\344\\\301\310\2041)\235"
+	.ascii	"TL\"\261'\316\253\354\242i\354\253\2746\265\304Nc\223\254\364"
+	.ascii	"\206\257\230f\270\315\300\277\rA\314\216\333\226&\343\013\016"
+	.ascii	"=m\324\220[J3pjTI.\316C\207\bj\346j\013\213\274l~ \271\230Du"
+	.ascii	"\234ON\316Sn\256\270rt\\\2226Ok\264I6i\217\355\264\310z\302\353"
+	.ascii	"\234\315\026Y\231U\356\002Ry\273\340lXd\275\321q\032\274i\242"
+	.ascii	"\201\323#,\355\250suM\235R\034O\226.9c\275\327\035\237\325\255"
+	.ascii	"\262\251i\352\232\252\246\242\251n\352[mS\341\332Y\337\324\246"
+	.ascii	"W\035u\307\203\232\211\bZ\260\336T\255~\323Y\235\265=\353\233"
+	.ascii	"z\244\2121\352X1\333\236R?\314\256\254\206T\037UeWD\212p\261"
+	.ascii	"\002\322\345\t\245\276\251YV\236Uj\252\372\320\342\205\310U\025"
+	.ascii	"B\266\245\342xS\327\352\231g\333\263\203e\362\212\202$\350\232"
+	.ascii	"\251me\322\226_k\234`3ez\240\224\3358\262\275\226\341Y\323\""
+	.ascii	"NJ\275\225\214\375\"\327\3438\246\247\353J\f\331\230w\\-\022"
+	.ascii	"\243\210\032$j\225m\311\323\223!\030LMkg\rS\227\274\216P\215"
+	.ascii	"<\250\031\246\"\251\\L\2731\3170\265\253\242\365\031\024PN\266"
+	.ascii	"\311=;t\350'd'\270\351n\t\325K\231\253\263\372\245\232\320\316"
+	.ascii	"\212\366\212V\231T0\037#\205\234{\304]\241\325(5\314'\331\314"
+	.ascii	"M\27239w\020\352\320aG\211G\016#\276]\252Y;\253\227ZFV\271\364"
+	.ascii	"\031T37\371La\2525\301y\251c\025\313\005\244\322\203+lO<\006"
+	.ascii	"\344\212\225\356\036G\212\313\226\236\027V\262\304d\251Ztj@\235"
+	.ascii	"]\251\201\377,\217\201\225T\246t3\365\312\203tqZR\357q\\\340"
+	.ascii	"\343d\374\033\207kX\225R\251\364\031\030\t/m\317\234\263\225"
+	.ascii	"*\326\316\032V\253\3746s\006k\2620.g\236A\035|\212d)Y\362\304"
+	.ascii	"\367H\022\212Y%\241N\311==m9\260h\251\341\337/\370\267\254>\251"
+	.ascii	"P\332Y\301\352\327+V\335zP3g\022\300j\223\352\274\200T\226\320"
+	.ascii	"\341\246\202\325f\217\371\030\233Y\306N\221+\265\246\240\016"
+	.ascii	"\035vU%0\001\242\273\277WN'\326\206\222J\\\023'\013T\332\020"
+	.ascii	"\257\272d\207L\b\271\255\336_+\374+\205\177\241\360\257\f\374"
+	.ascii	"\213\254J~\240Lum\265\301I,\032\334\331\222\301\035\324\005\337"
+	.ascii	"\216\341[)\030\250\t\276E\2023\210\360T\2038\265\bK\2305\252"
+	.ascii	"\360-\016l\201\235Q{T\361\300P\306\331$\346QU\265\324\210mQ\275"
+	.ascii	"V\365[}3\343\243\255\312\3417\333`\234\246\0264\370\025\r?\354"
+	.ascii	"\n\376\031\324S\022&rm\352}r\0022\025$H\215W\247\267\361\344"
+	.ascii	"|\341B\214 J\352\275\232J\343\177\216\316\232\246\037mh\314h"
+	.ascii	"6\2644\270z\235uFmz3\347\240\206r<\"\245\340\2772-U@Au\325\373"
+	.ascii	"\272\224\321\314\234\301|f|m\335\250\267*\325\245v\n\325\030"
+	.ascii	"n?\220L^x\0049\267\220\256\347\346"
+	.ascii	"ZHWC z\205\301\200 UI\352\265]\341\205\320\021\261\035=\224."
+	.ascii	"p\234pI\022V\242<\350\252\234\236l\352e6\223\273\243\030\265"
+	.ascii	"-D\360\233\353&o\213\2562X.n\022\027[\bW\251\317~l`\344Km\336"
+	.ascii	"$.26n\214\353T\005\356\031\345\332\270/zl\r\307\335qu\334\250"
+	.ascii	"\013uo\334\034\355\2746\356\322\357\361\"\257\215\253\034\363"
+	.ascii	"\223F\t\224'\240\233\274\231\256\266\032\367\251\235\327\t\354"
+	.ascii	":]\031\227\306\016\0254d\322\300\tu\350qK[\303\241\2431\303\207"
+	.ascii	"\204\246\217\267zo\323\016\352\251,)\306\262\235\227\t\253\331"
+	.ascii	"\022{s3;Y\200P\365\300\300\357I\302\347\201\2730p\230g\016/n"
+	.ascii	"\370<m\370<b\360yL\300\3471\303\377mq\223\234\\\322x\271Ic`\314"
+	.ascii	"\224\220[p\345\320\025tV\316\316\335\374\347\374$\t\3531E\f\337"
+	.ascii	"\236\360?\307\002@\276L\251\367\3327\267qeE\256\226H\300\267"
+	.ascii	"m\254\233?\307g\215H\224&N|\0137e.\215\215z-\033\334\202\307"
+	.ascii	"\310\006\235\034Uv\340\250\367\226\315o\335\272\313\256\331@"
+	.ascii	"\316I\020\314\311\261\251\327\246\261jn\327\330\267l\327`\300"
+	.ascii	"\314\371h\327\374\304\345|\374\351\326\320\255\341&\241*\"Ew"
+	.ascii	"\317\203\205{\330\020\335\242\331\361B\366dR\357y\240\314\214"
+	.ascii	"\261m\035G\204\206\311\223\304\337i\303\267c\332\262\261\215"
+	.ascii	"\3452L\304\265\326\307\242[[C\263\343\272\002V\305D\315\252\355"
+	.ascii	"\b\001\003\306\246\2419@Y\326\217\244\2234]R\327\017$\365~\307"
+	.ascii	"\t\355\355\264h\335f\22593m8\263\254;\2240i\233\303\267fm\277"
+	.ascii	"\330/\326\251\202\261\345\031\374\266N]\234\266K]V\257\334\244"
+	.ascii	"\343\302\b\345\241\007+\311\027r\f\276\315\322v\013\026\313\305"
+	.ascii	"J\315\b\241\244\251\003\006_\247\f\327\266Rdd=\326^Y\206\216"
+	.string	"\013&#Z<\\\2713jVG\360\330\230\275R\257vO\246py^\244W\tl\256X2G\316\212\b\021\023\263`\036X@R\364Fe\f\323\212\025\3335\206\312\025\b%\030\311\365^g\211\n\025!\033:\2652[\200\300\341\333(m\2478\355\224\256\302!\037\217\025\210]\261\341wW\321A\201b\301<0\346\\\343\214\315\326\326\256iM\f%\260\034\254,*%\261f\323~I\220ei{\2205\021\263\316\333\257~\363\321\"\"\306U\257mb\235\340<\211A\365\304:\261^:b$\214\200&.\f\333\222\322FT\027\2223O\226,\261]8\347\034\204%Gq\350\311\272\372a\302\325\334v\341\230\240EDJ\275\317I\222\304jY%\025\271\301\013e\316MDX9V\3709N[N\273\325oA\331\210\306\202\26136[p9J#hY#\307\202\215K,\005\206\214g\033|\234V\244\210\315:"
+	.ascii	"\226\b\267Y\326\351\032\211\201\345H\275\026\253\307t\304\234"
+	.ascii	"h5\352\265W\326\251\2229\327\220X\n\266B,\223\035\322o\031:G"
+	.ascii	"f\263\265\225\227M\017\307[\370\270\312Z1Y \307r3X>6i\300\221"
+	.ascii	"=\034\303\300\337=\247>e}`\240\214,\363\346\231\241\2408\340"
+	.ascii	"10\032dl\217[\037\325Xv\344\314\362\260\372*\223\304\243\352"
+	.ascii	"\355\f\231l\346\007\215\210\214\032\365R\265Y\317\234\r\260\033"
+	.ascii	"d\3302{\352\027\027fN\276\242\336N\033eux\320\314F\335\322\023"
+	.ascii	"\312C\217\2324\257\031\365\332\034\034\220\n\313"
+	.string	"\322\205\277C\202\243.PN\362X\272\362\320\365F;=\310\307\246\fb\026\252\347\272\301Z.\021\202\355\023\007[#G\355-\007X\275\337Q\321\220\323\tc\246\204\t\3032\331\246\226\353\334b9\201\027^\236y\271\364\360\235\022\276U\262K\2671nc\330eCe\243\233\006\034M6[p\031j\311\341\2672n\227\035\367\243\204I\312[\307\351\306hI\271\020\303\177\375u\371\270\31497\3414\363\022\311\243k\234n\016\177O\333.\300\377\2331P gc\031f\032\234e\345\210\343\001)\217\230\001\024\351\227bb\212\232X\021\034\n\205=\336\007\202B\235\243\243\236\217\230\376N\f\025\201F\nXQ\004\376\216\024\200\201\b\236\210\fV\f\241E\305#\037\36074$\026\207\206>\020\034\246H\203\300\035\212\036ztS\"0\350\303A\221\002\177\303#]\212\264\2074\004\f\"!\005}\024\\\320\001\337\257\350\001"
+	.string	"\260\020\006GH\220\n\207\214\204\025|\300\342\016\020E\035\342\020y<)\017h$\304\001\032\tm\212\324\b\210\036\351P\020\374\210\227\2050\350\273\303Th\213P\240\321\357\250\267+B\211\305\353C\211\273\017yF\302\017=\303^\n\337e1L\211?#\024\003\025,\370P\204\252\350\021-\034\371X\214@\032\006Q\fQ\241"
+	.string	"\320\242b\372K\217 `\001\tM\211,L\360\220\212&~ppD| \356\236\342\303P\321\321\257x\002-\nV\300\250x\002-\312A\323^\2210\003:\034\020\177;G\250\n\224\002E\300bp(\201\0245a\202\003#\240\217\007M\203#\200\301_\332\033\236\370\035\365F\020K\b\245>4EI\350\244?`\tt\370\001\006"
+	.string	""
+	.string	"@\b\t\216zi\020\004t(D\001\304\007\026E=\024\003H\025\202.\370\260\002-\002\226H\201\350pX\364Q\300\003v\220\242D\024\003FB!\224\207\246\275\324\004PzQ\236\211"
+	.string	"\334\007\354\375\212\320\np\300\342H(\354Qp\337o\210\002Q#|\fD(@D\006+v\317@\003\0134\260@\367\f4 \"\322@\004\021\276\b\"K\364\201hb\210\246G\277\016\202\210<]\372\024\037\0220B\0024\355\035\025}G=_NJ\344\375\204&P\240$x%>0\261\203\372\200\275\224\b\374\341\224w\201\022\027\370\373"
+	.string	"H\364\351~B\242%\362F\200(\2613\002D\211\034\235\017\304\317>\305\007b\021U\361\033\026\t\021y\025"
+	.string	"\032\242)\261\207\244\333\241*zG&\212B$\\\344a\"\217\004\261xb\007\345\241B\026 \020\213'rv*\320\"b\361\204\216W\204\002\177'\220\202\276\236\264\210Y\364\216\320\"\236\260\210\3234\025^\240g\330K\211XX\344\025\365\320\341n\230~\340\003\026;HQ\t\b\213\274\0245\322\251@\213lz\004\201\340\260\307\301\016\035\026\323\336\020\025\"\241 \240\303\342\007D\236\n\224DN\312\003qA\n\374\355\216\202A\016x8\351S\020\340A!:\034J\203\301\341\320\316\360\310\267\202\3103\372\241"
+	.ascii	"\006GP@\205,Rb\361\304\017\220\350\343\375\204D\324\367S\201"
+	.ascii	"\026\375\020\211\350\260\250\250\307\363\201\370\001\241\303"
+	.ascii	"\336\007\212\206\275\024=)/\203]\n,\006}<\364H\210\324#R@!<\342"
+	.ascii	"\241\304_\020\350\223\362D\020\245\300_\021\037\241*x(|\274\235"
+	.ascii	"\224g\324\003!\370\333\235\210hD\206\fX@\002\330\367a\210\246"
+	.ascii	"(\322\020q\030$\002Q\342\020\360\327C\032\362\r\211C\037\006"
+	.ascii	"`\324Ky\276 \312\013\016{'x\336l\356\204\351\210B\243\251\005"
+	.ascii	"eK\r\f\353\t\\\225&(\327\310.\353\2705\367\304fI\235\031\217"
+	.ascii	"\324[B\223K\206\214 L\247\023\216\322v\006\303\211\016\036 K"
+	.ascii	"\240\322xY\251 On\274n\223\347\350T\005\255\f\223\245\223\020"
+	.ascii	"\037\"t\371H\223\253\001\246\336\233\344&\271\\\235\227hB<]]"
+	.ascii	"%\277\\m\326"
+	.ascii	"\fH\226\263\253\\&YP=\306\220t\025\335S\322\233)u\313\372\240"
+	.ascii	"r[\"\244\336\254?\353\032\2710&\345\201\326\224\271\021~\215"
+	.ascii	"\334\212\324\232\r\037\365^\255[y\225&kA\300\254~\213X]\254V"
+	.ascii	"\323\315\f\3054\272\035`\307\026\267'\\VFq0\352\261\243\313\325"
+	.ascii	"/V\027\335\334W\330\224\225\036\241\n\022)\365\336!\277D\376"
+	.ascii	"\234\235\2300e^K|\203\374\n\3011\203M\013\006\220?\207\347G\027"
+	.ascii	"/n\365\336'\t\277\347\004|\036\227\307\365\021\3044\242\251\200"
+	.ascii	"\211\361\214\023\007\035\333\223\206\233\333\343\327\307\004"
+	.ascii	"\236\f1\206Q]\252n\013\002\312\231\252M\230E&u)i\373\3745\266"
+	.ascii	"\323>\257\224UB\345\031\036\002\203u\250b\351<\210\322\230Rf"
+	.ascii	"FFdF\222$\215\001B\n\020\204Ci H\346\035\022\300$A\3162\310\314"
+	.ascii	"\210\210H\222\202\224\322\236\001\223\t\343\003\330\\\356\235"
+	.ascii	"H\207)l2"
+	.string	"\305\265\274V\305\024\211sG+\336r\221\267+ ,IU\301\264\224\223Md\272\312s\024@\250\363I,_\337\r\336\220\274\310\222\027\3144\247\3577\333\3172E\261\213\265\200\2425`_\322\036$]=\245\321@\272\320\3617\006r>U\346q]\023-L\226\037\016\375\274\2722\270Y\263sB\351\307\202\311\317g\371\2005\346@\216\n\033Q\201g\177cj\231\262\301\235H\300\300-\035\364\017\271\220\345\025\276\216,\225\r'w\240\301\013\254\225J1\316\f\334\"l\303\260\325\343\361vP\363mx\303\234\201\033\035\355\345\022B#\315\273.j9`vmMz\n\017\343\r*X\325\362\b\272\031\003]\207z\233\354[\226\347\276\220\363\200\2258\347\007i\240(\002\311\216\326\344\260\325\261\036YWH)q\004\342\344g\207\201v\246\367\025\\L\272\2721\362X|#\306\236r\022\273\003\352N\271Oo\231\3148"
+	.ascii	"\245@\220\326Gzr\250!\275\366\375\226\364\262\340E/\031\310;"
+	.ascii	"\215\030\306\252\017\310H\226K\260\2020\240\263\235\360V\003"
+	.ascii	"\334\207\016\347kY\006\266\350U\354\001\372a\3769B\300\026\\"
+	.ascii	"\200(\001\016\223\372z\327\263\236l\312\214/\302\204\3373\343"
+	.ascii	"\226\022@\236:b\347p\023\200\344Y\033\242\371\3053\240\206(\235"
+	.ascii	"\202\t\272\252\364\314\250\2444\0233\243\332\261G\273\372)$W"
+	.ascii	"!\224\256\333\271\3665{\212,s\002\356#\355R\007=\250\311\325"
+	.ascii	"DJ6Tf\203\255\372\266,\025\037\034J\016\330*\006;Q> \202\262"
+	.ascii	"\223\241\206\355\3040\224\336;4\300\246\322)\304=\035\242\300"
+	.ascii	"\026\367B\343\250f\232{9\334\252hc\365C\207mO>f\352b\3226O\221"
+	.ascii	"\272BWQ\320\204\364\2039c\024\3461a\365\202\333\274\227\327\354"
+	.ascii	"O\204Y\370\321E\355\"\310\017?\332\220\270\323\025\265\356\027"
+	.ascii	"\016\031@\007\266\272wk;"
+	.string	"\345\245\206lP\225B\357\320\302wip\261\304\241\377\347E\327O\365\215\033\274B\225O\266zl\364\325\216\250\241et=\273\020P.\332Z \235\340\214\020\240\223\021\006\344\232~C\354R:\317k\225\r9\362\024M\355B\265C\350O\373X\225\"\353;\303\200\322\247\345#E*\341\244\255.I\2410\226O\372\201\353Y\364\322\035\020`\203Y#\034r\2055\210\035e\001\232\340\227\203\nN0R.\241\177WM\205\341\324\240]L\233\336\275\375W\021d\356:H\216`'\325\345P\250\r\265o\377\334\313\311\370|\204q\377\300\177\004\241\260\376k\210\016\263R\212Z\247\313\314\235`\226\001\340Ef|H\353\300%\245\263\305\3238.\301\031\265ZT!{\034\001\206\276j\316\3075 \307+\270T\023\376\274\013pL8\177\344\262\317\264\031\222\362\360l-SD\236\023\016\347\237\001\025\037\f\216q\340KN7\322"
+	.string	"\355/r\372t\347*[\274\325]s\263\336l\365\202\004(\256S\204\260q\005\037\221\251\227\200\313E\300\253\362o\350\202"
+	.string	"\360\255\b\243j/-\031\264G\302@Q\007TV\0163\331B;`\371\017\003B0 \003\266f\021\004\246`\230t\005\253M\323\370\254\255\206\022\345\177'\320\376<4_\302\254\314\205~\315[\346A\274_\327l\006\301G`{\353\226\274\"A\316%\024\361\202aA\b\345\022\241\343\f\220\\\243\211\300\201/\315\330\271z\311\346\2025\035]~\230\327&Wl<4\212GB\017!\027]\031\367\311\313\342m)jL\207\007\322\2547\323\251\373\255\203XH+K\232\222\224d\031\202\273{\016\245\225\304W5\317\266\334{\032O&r\227\203\301(\272U\245y\356{KP\016\375\232\020\200F\301\b\210\233g\2452\372l\356\212\254O\306"
+	.ascii	"ny4\017x\230\355)N\373\275\3139A\3059\200\003\241\"\203\374\016"
+	.ascii	"\325l\032\337\244\231<\324QY\216\310\r\f\301K\227y\325\204i\224"
+	.ascii	"*W\303S\026\231\203\017WX\314aY\017\3167W\246\236\344v\006\304"
+	.ascii	"\361\241\020\017\204W]WM}\275\224\212\0312\255D\331\263Lb$\226"
+	.ascii	"m\033\023\3732\001\275\261\030B\001\315RB\216?\275{i\320w\262"
+	.ascii	"\024&\013!\301\021X\377\372\262FF\261\230Y&\020\006\n6\331\311"
+	.ascii	"P\354\233\340\253\013\275K\335\315\f\221\033\030D\323\321\260"
+	.ascii	"\375\343\321\025\031` \352x\353\324\366\266\013\324\215\330\360"
+	.ascii	"\263\003tBFd\rMP\005\362\315N\246$o\352inzI\255a\276\255\316"
+	.ascii	",\265O\020\030\036!\205\331\3040\006\320C\303#\216\273\376\221"
+	.ascii	"5X\t\214\223\354\313\316Ih\344\245\005u\264`[\370'\346\362\214"
+	.ascii	"\211\212\303\356\032]@\344\275\350w\243\372:\311\372\350\007"
+	.ascii	"\311?\027D\256\313AJ\0365^\377\201'p~\356\304\373\205;\235*\275"
+	.ascii	"a\272\320C\003\272\025\250\362\360\221]\037\255\007\003\304l"
+	.ascii	"9\f:\320\214\341$J#\217\374h\250\033c\361G+\365\214={`\"\270"
+	.ascii	"LF.\306\220\220\0274cR\013\020W\f\254\307\346\225\333a\021\324"
+	.ascii	"!~Q\020bJ.)\002\315\367\204\374D\3656\224L\342\233\322\300|2"
+	.ascii	"6l\242\365XP\262\256\232\343\263\331\217\225\030\325\350O\313"
+	.ascii	"\223d\216\036\2067#M\007\244\334\024e\032\365\233\225h\363\f"
+	.ascii	"F\267\274qS\331\342\243*\303s\037\313\232\351#a\310\271=PF\333"
+	.ascii	"\353\177\3451:B\240D.\241\226\376\272\2001B\302\035\365J\242"
+	.ascii	"\232\367\303\f\370h\b\033\201\204\314\223K\367\353\267.9\252"
+	.ascii	"(\007\243\317\276\205>P\253\213\306\323\274\300h\343\370\361"
+	.ascii	"\020\276\3241\037\303F\371\035\204\267\205\271\032\257H~q)=#"
+	.ascii	"\210\034M?\216\343\036\\\177\210\222\345\201\262\003\003\321"
+	.ascii	"[\321{#\267x\345@\327\241\267\240\037[\023\326\327\376\307\306"
+	.ascii	"rM\324\305\r\274\270q7\335\307\215\207\304\272>m\032?\313\233"
+	.ascii	"\007\236g\363@\320\326x\"\365|\202\367Re\332a\263\246\373\306"
+	.ascii	"\241\270\025>)\263\340\3720\022\322J\036\324\321\274\317\262"
+	.ascii	"\3343\365&X\206\305tI\371n\220A\254\r\265\027\314\375\374C\344"
+	.ascii	"\270s\037\242W\373\300\031\321'\362l?\347\353~\031Q\367\320\277"
+	.ascii	"\377\264\013a\337\305w\244\256\215\313f3\300\027i\300\376\330"
+	.ascii	"~a*O\337S?\323\267n0]\006w\363ry\312\371\035\250u\307\357\375"
+	.ascii	"\247dDj#\301[1w~w>8j\350C\310^\371\240\374\322\367\007\260\215"
+	.ascii	"\201\237\220\230\004a\005\211\331"
+	.ascii	",\216\223V"
+	.text
+	.section	.gnu.lto_.symtab.5d8141ba49b08d5,"e",@progbits
+	.string	"pgResetFn_barometerConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\001"
+	.string	""
+	.string	"baroPreInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\001"
+	.string	""
+	.string	"baroDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\001"
+	.string	""
+	.string	"baroIsCalibrationComplete"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\001"
+	.string	""
+	.string	"baroStartCalibration"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\001"
+	.string	""
+	.string	"baroSetGroundLevel"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\001"
+	.string	""
+	.string	"isBaroReady"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\001"
+	.string	""
+	.string	"baroUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\001"
+	.string	""
+	.string	"baro"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\001"
+	.string	""
+	.string	"barometerConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\001"
+	.string	""
+	.string	"baroCalculateAltitude"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\001"
+	.string	""
+	.string	"performBaroCalibrationCycle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\001"
+	.string	""
+	.string	"barometerConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\002"
+	.string	""
+	.string	"barometerConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\002"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\001"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\001"
+	.string	""
+	.string	"quickMedianFilter3"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\002"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\002"
+	.string	""
+	.string	"pow_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.5d8141ba49b08d5,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
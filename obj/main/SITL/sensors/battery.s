@@ -0,0 +1,1670 @@
+	.file	"battery.c"
+	.section	.gnu.lto_.profile.a433deb85508ed19,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.a433deb85508ed19,"e",@progbits
+	.string	"(\265/\375`$\002\265\016"
+	.string	"D\023\030\003"
+	.string	"."
+	.string	"\254\372\361\363\002\024\002"
+	.string	"\002\001\002\003\002\004\005\002\004\002"
+	.string	""
+	.string	"\002\004\001\240\342\234\212\n\002\003\004\314\346\255\372\005*\002\006\002\007\002\006\002\006\005\002\005\005\002\005\005\240\342\234\212\n\006\007\b\t\246\300\251\343\t\002\n\013\311\215\301\376\005\004\b\002\t\r\306\374\305\326"
+	.string	"\002\006\002\001\016\017\347\217\220\351\016\b\002\n\002\001\021\203\271\332\373\t8\001\002"
+	.string	"\001\022\024\313\322\375\213\007"
+	.string	"\025\354\206\342\366\026\027\030\234\236\237\233\f\004\002\013\002\f\031\361\220\342\261\005\032\256\274\321\260\005\026\002\006\r\002\001\033\034\204\225\341\235\001\n\r\035\352\263\360\321\b\036\365\237\256\307\n\002\037\373\310\241\374\006\f\016\002\017 \336\253\202\201\b\016\002\003\002\002\002!\314\344\207\235\n\006\"\355\241\206\304\017\002#\250\267\374\351\002\001$\300\253\277\314\017\007%\205\246\225\244\001&\317\356\361\267\004'\350\300\306\254\005(\307\266\257\307\n"
+	.string	"\002"
+	.string	")\241\365\225\242\b*\367\345\303\353\007+\207\312\266\244\016\002,\320\374\270\356\001-\325\241\220\227.\317\266\256\202\001/\355\220\274\212\0060\240\342\234\212\n"
+	.string	"R\250\221\251Ad\fg\223V\003P\002Scc\036\021pQ6W\223e\337\260V\356\016\324\215\235L\260\255\036\016\331g\333\307;\317\013sAX\007\215\005\220\\`\3476t\344\305S\252\225\376\335{\267\364)0\244\347L\202\256\210\030\327+\372\221DEy\337\266\333H\266]i`^\336\306%8\013#\233\3514~\364\033\345Q\267\353\217w}\333\352h\265\217`<\315\252"
+	.string	"\240,\350\3536\005\256s\fHCe\336EE!9\245\247\234i\374\375\007\207M\204\266"
+	.ascii	"\277>\f\347i/C\343K\200\t"
+	.text
+	.section	.gnu.lto_.ipa_sra.a433deb85508ed19,"e",@progbits
+	.string	"(\265/\375 \324\355\003"
+	.string	"\262\205\022\036\2209\303\001\377\377\377\377\377\377\377\277\375\003\377\300?\360\177\343\275\211@\023\245"
+	.string	"\330\324d\n.d\037\353\330\3062v\261\212M,b\017k(L\302`\005\211\273\266M\031"
+	.string	"\354\264\322F\013\355\343\254Yf.SQ\265\271\214\004\025"
+	.string	"J\b\363\263"
+	.string	"\347]\240\f\20163!\340\002\262`\007\216Ue%e"
+	.ascii	"@\321\242\304\341\214\240y\227(39S`\303\312\340\22706\200\005"
+	.text
+	.section	.gnu.lto_.inline.a433deb85508ed19,"e",@progbits
+	.string	"(\265/\375`D\004\355\r"
+	.string	"V\220>9 \261\322\001@\b\225Q\217\251\310{\207Qu\272'fX\020<c\020\370\3033p\331\035"
+	.string	"\354Vf\031"
+	.string	"K"
+	.string	"\300-\020\231C\335\233#B\364\306\271\3710\243\022B\244\334)/"
+	.string	"0"
+	.string	"."
+	.string	"\237\215\332\316\266`b2\035\013\200\212c\211\341\310P)\312\315\004\004\303\235ZQ\372\377\237-\352k&\213\231\324\226\242\2163YLd\207\366.\002\247\227JSn\306\234l\331\324pf\354b\003\202\265\345\200\374\250\021\301}\326\346A\342\372\330\263\377gH\355\025\227\366O\217\013P]J=\203\222\025\177\200C[\372\364\352lw\274\251#L\345\244\264RW\316\265b\262\210E\363\237\264Z[-\244\025:a?Z\b\001\244\241\353\203\r{\375q\256(QLH\210\033\001Azph\350x\271\225"
+	.ascii	"xt\035\371\017\232!\2459\377\034\301\376\t\362\302\267\345\237"
+	.ascii	"\026*e\3753\264\202\216\017W\2501Ye\002\242\251\206\235\315p"
+	.ascii	"\002\2319\262\036\022\200CI\303p\214\201\306\b,B\202\211j\342"
+	.ascii	"\347\003\216\347\226\207\343\237s\274\246\b/\336^G\302RBB$-+"
+	.ascii	"LL\314X4\246\231Fp.0d\255n 0\324\024\331Y\301AJ\341\36765iT\360"
+	.ascii	"\006\031\205\201\243\031^,S\231|\210\330\261\244\f\210\226_a"
+	.ascii	"\360\035\364*\303\244\250\363\202\013\013\005|b&S\307'\313\317"
+	.ascii	"t\200sR\265r\034\211y$WC\320U&\021\315\212%\f!Y-!x\275\317\033"
+	.ascii	"\f\270\265<\350\007\023H\211\235P\243s\007\263\306\032\346\037"
+	.ascii	"U\352\013~\232\026aPi\343\376ud\032\206\2512@\006"
+	.text
+	.section	.gnu.lto_.jmpfuncs.a433deb85508ed19,"e",@progbits
+	.string	"(\265/\375`\354"
+	.string	"m\006"
+	.string	"\222\013!(pK\222\306\374\177\256\252\3701"
+	.string	""
+	.string	""
+	.string	"\300`\375\177\305\272\252\352G\"\375\377\377\377\246\373\361\356\217Z\036~C\f\261[\246\317\030\343\213-\256\230\342\211%\216\030\342\207;|\362<\317\203\212\251\325\326p\206\027^i\030f\032\251\232m\026\005\312\023F\370`\203)\027\334S\017\034\310\366\261w\033\251P3\216\264q\244Z\217BN\202\212Tf\223\005\016X\226!G2\344\254d\035\251j\200\210\251&\262\255\\H\035"
+	.string	" \206\343\243\340\324\026G\314"
+	.string	""
+	.string	"\271l;\375\230\305\316X\007*{\301\2460\260\350\254Ak\205\255\301\3073\204\340="
+	.string	"!\003\270+\r\241)\265y\246\320\340\223ZTW~\032\203\306\200\020h\346"
+	.ascii	"F/\300\020"
+	.text
+	.section	.gnu.lto_.pureconst.a433deb85508ed19,"e",@progbits
+	.string	"(\265/\375 _m\002"
+	.string	"\362E\022\033pm\032\003\374!\373\377\377UUu\177;I\222$\361,Fc D\251\220\027\031>q\211G\034\342\017wx\303\031\276p\205'\034\302\035\234\301\013\236\034\301\r\\\340\001\007xd\005r\217s\274q\214[\234\256RUQ\002"
+	.text
+	.section	.gnu.lto_.ipa_modref.a433deb85508ed19,"e",@progbits
+	.string	"(\265/\375`\001\001-\006"
+	.string	"\202\307\026 \260'\303\001\f\3030\f\3030\f+\265\021\322\032!\204H#\264\033!\273 B#\240[\223)\005B\036\321\026r8\r\206\272P\243\006z\036\247\331\304,w\346\315fRTB\034t\027\024[f;A\007N_\266\313\232\257mB\020H\266n\230+\233\311\\m\325<\r`\362H3 \360\002\221\242v\246\214"
+	.string	"\337C\r\306\221N"
+	.string	"\r\267\340L(\222$\201\017\340\343`u\013\347\002!4\256\241\021\027\345\215\253\343\244s\204%\314\034'\263b\\"
+	.string	"t\340U@\303}r\2116fjc\rL\300,\f\321\355\030/\344\031\362\n.\030q\320dQ\325\003i\275"
+	.ascii	"Y\260\314W\3269XQ\344\241\025\330\r"
+	.text
+	.section	.gnu.lto_.lto.a433deb85508ed19,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_batteryConfig_Registry.55.a433deb85508ed19,"e",@progbits
+	.string	"(\265/\375 \242\315\004"
+	.string	"\264\bk"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001\212\001\206\200\200\374\342\303\337\301\035\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\376\006us\250\326\006uq"
+	.string	"\005\001\006'\001$\005\001\006\035\001'\001\213\340"
+	.string	"?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/battery.c"
+	.string	"\004"
+	.string	"\237\n\013&\361\024u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_batteryConfig.57.a433deb85508ed19,"e",@progbits
+	.string	"(\265/\375 \263M\004"
+	.string	"\224\006\246"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\002"
+	.string	"\n\036\005\001\006'\001\232\003\001\005\001\006\177\177'}{\344'\001\254\002\336\312\256\003?\202\210\200\330\002yw\312\001u\311\001s\310\001q\307\001o\306\001m\305\001k\304\001i\303\001g\302\001e\301\001c\275\001a\300\001_\277\001]\274\001[\276\001Y\275\001W\274\001U\274\001S\273\001"
+	.string	"\016"
+	.string	"`\b\230\013\216T\354\201dZ5\001r/\307\204j\217\247Dp\002\332M\021e"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_batteryUpdateVoltage.58.a433deb85508ed19,"e",@progbits
+	.string	"(\265/\375`\226\002\035\024"
+	.string	"\306#\201I\260\326M:4\316X\211\345\345\256\006\330<< \376k\214\361a]\267p\001\222$3ld`\215ZAfm\333B\351\210\2155\306\317\f_&\022\227z^\343K\207 \277\023\364\3317\307\272\t8#16i{\223\275S\nl"
+	.string	"d"
+	.string	"q"
+	.string	"3\340)\202\303\324\323\357\002\352\251k\266\223\363\222\366O+~\236\266v7\2343^\373\013tU\372MY\363\025\324\260\032u\266\277~#:\370$@Dgz\202\034@C\322\345\342\365G\205\2442L\2763\375\343A\003\310\250\023\372\374`\260d4i\321\341>\231\242\253\240\027]NJW\204\335\265\034u-n\226\333~a\373\201-u\004UN\002NY99\305\266\210;\365\200\273\271\032\377\307\233d\276\322\251I\314\344\307S\177VO\345\204\020\204\243h\267t\223Wl\036NN$\373\337\356\256\347\221\375\245\277Ri\372I\177SzJi\031@\203\321\026\024\006BvY\\\241\262=:\344F\213\355K\373>\276\253}\t\205_\2731\242\244vy\r\034[c\365\315?e\275\312\337\3249A\234\352Dn|%_\300\301\251\247s\322\246\253\035C\264\300\224\2241\344\030\351\345\2146\006"
+	.ascii	"TUONia\301\370\006\310\363\036\245\003\356\336>\372P\017\262"
+	.ascii	"\201\203\216\374\250S;T{\007\306\262\324K1mv\221v\b\036\371\321"
+	.ascii	"/P\273\036n\332\f&-\320\356\306|\240\222\222\362\304&\253\334"
+	.ascii	"\306X\324\233?\021\263\234X\017O\006\232OL\024K\300\\\f\2431"
+	.ascii	"!\306h\264\035\017\341L\224\315|b\263\320\207g\247'\204\211\263"
+	.ascii	"\220\346\200e#bbH\223\311\304\260\205w\373\267\363\310\026\264"
+	.ascii	"z\267\211{-\220v\255Gm7\247\355\340D\362\253>\247\001\241%.:"
+	.ascii	"m\317\374\252\306\024&\355\256\003\377\310\221H\230`cSO\253\222"
+	.ascii	"1\3127\351\374\217\025Sx\221\n\340n5 \200\002\031),\017cB\007"
+	.ascii	"K\214|(\367\006m>\327EFQ\"cJZ\330\004\257\007\211\346\330\300"
+	.ascii	"s\223K\326\314!\215\256\227\207\350W\214\255\305\263\211h\366"
+	.ascii	"\234d\376\321\261O\266G\203qw\327\340n\374\236J<7\024~^\020\355"
+	.ascii	"\037\001#\007,\314\002\033\242\356z\201\3266\300\365\355\"^\243"
+	.ascii	"G\227|\223(s\236\331\345r;\020\364h\346\253(\307q#y14\202\330"
+	.ascii	"\003"
+	.text
+	.section	.gnu.lto_updateBatteryBeeperAlert.59.a433deb85508ed19,"e",@progbits
+	.string	"(\265/\375`@\001%\r"
+	.string	"\326WVC\020o\234\0169j\321F\023\022\373"
+	.string	"#.\b\3128\017\264\207J7\005w\360C\373\034\222\006\013\320\200:\361\217\352\353\2761\f\207\320\265\001W@\005*\002\002"
+	.string	"\310\325b\004B\222Jk\013D\264\311\226)\005C"
+	.string	"@"
+	.string	"E"
+	.ascii	"\237\317,\262I\036\252\226\222\362\210\020\022cw5"
+	.string	"\251\341\242\317K\252\310W\016\027\037\350}\026\200q\275\343\027\b\326\310\007V\270$\225\260\001+\221\r\026\320$\225b`w\255\037H\341\306n;\201m\214}\216\017@\372\357\323\007a\237R\036\344\212\201\245B}\234F:\332!Ie\312\276\034\307\321\304r\303V\265\3042\017-0/v%\2142V\234*8\330\276\377q\220\320=\254,N\273\233}\332!;\013%\351\371%n9\021=\235\361\225\310j\205D\341\247P\353\267\246V\207\315\020\342\2330Ie\327;\352\377`\237*`!\244B\224\354\356\345$|TE\265\0236\334K\307\021\214\210&%%=\261\037^\304\307g9\336d@\034\307\343\321(\320:n\353:\234N\353,\3200\3206\\\247e\bxk\300\3414\317\266qZ\026\216~\255\334\360\201\017\342H\222\374\021\377\265\273;)\027N\034@\313\302\245\241\225o\230\355\240\323\177\016\320\002\305\036"
+	.ascii	"3\241\233)\006\340\005\017r\201\354\300aS\r\017H\261T\342\340"
+	.ascii	"\312g\006\272\306\022 .\350\307S9\024\335\3511s1\263\215d6\026"
+	.ascii	"Rm\327\0055\240L\27441\3169\230\302_\016i\032s\252Q\340D\347"
+	.ascii	"\226'"
+	.text
+	.section	.gnu.lto_batteryUpdatePresence.62.a433deb85508ed19,"e",@progbits
+	.string	"(\265/\375`\343\n\2656"
+	.string	"\312Z"
+	.string	"\024D`\332N\007\277\277]\273\202k\302p5\337\351\025\225\267?\340\273\315j\214BZ\305~\241B\002\306\f\332\212cX+\273\250l\360\313\006\277l\360\307\017\235x\253\203IR\bD\233\232\027!![\356\235RJ\0010\001\020\0012\001:\246lZ.+\025#m\327\215\327\035\245\237Y\216{\217\221Q\216\214W\\F(wa\206mK\2674\346\245\341q?y,bk]\327v\334w\214t\302\214\321r|bl\f\231\\\323q;i&\335$FG\231O\251E\327v\261^lR\344\220z\345$c\257\312\006\272\275\252\355sc0\367\\Cg\264\0347\t\372I{e\236\301\214\354uE2\223\271L\323\235\265]\267\330\254\223\266m\273|\"\315l"
+	.string	"@?>=<;I\235\034\034\344\315\321\310\336U}gr\033\220+tv]5"
+	.ascii	" 6UY \220\253\210\377\254\265\317ZO\232\232\363\244A\321|\207"
+	.ascii	"\355\314\223*\020\233\232\240\215\013\210\353\260\024<4\341\314"
+	.ascii	"\224y\261u\016\216\232\300p\n\232\016\344\032S\201t\2609\305"
+	.ascii	"\034Y\240\314+\254o\302\366\272@\033\327\017?\262\024\312\274"
+	.ascii	"\306\332\b\326\306\365\345l\\\323\357\212\354\332rU\247\213\206"
+	.ascii	"\252l\333\266\363\264\374U#@!c:\220\213L\r@\326\307\243\343\332"
+	.ascii	"mte\271\263\024\332\266ewvy5\0075s\2631\263\023\36311F\376\232"
+	.ascii	"\213=\366v&]\225?\025\375\373\320\177[\224\237lk\003\307`\324"
+	.ascii	"\030JQ\377\311F_\364C>\nAt_\bc\333j=qgi-\"F\220 q{-\372\th\320"
+	.ascii	"\316c\250\306\022el\333\366\211\333J_\221\342^\353\225M\240@"
+	.ascii	"q{5\372\316k\004^l\024\241=%\0210\310\367\321\365\027\022S\213"
+	.ascii	"\372i\271\032NN\247\3236}t\373\375{\213,\253\2474\225\024\334"
+	.ascii	"k\274\202\312\333Iu{\355G\n\326)~a\371\224\231.\313\377\311\334"
+	.ascii	"j\373f\314\253s\004\326\031\002\353\374\200uvp\235\033\\\347"
+	.ascii	"'\326\231A\3335;\261\316\013\256\263\002\326\271\351:3\261\316"
+	.ascii	"\313\306k^b\235\225\256s\022\353\214t\235\215\256s\321uV\262"
+	.ascii	"\316\003Xg\242!\326YHu\016\352(\315<\327y\347:'\257\263\316u"
+	.ascii	"\316\271\3168\2533\222u\276Y\235\217\253\263\221ufY\347{\235"
+	.ascii	"\327\353\254\256\316\257:\373;\267\204\344\017\300\345\264m\003"
+	.ascii	"\177\371\346\034+\204_\345|\327\021B\221\2173E~\307\265\222\220"
+	.ascii	"+p_9J\277y\346\n\026\274\235\254\324\372+\016\372\033*K\376\232"
+	.ascii	"\213\323>\272<\037tC(\227\004\347\237\334r\207en\214o\207\320"
+	.ascii	"\343\320\363\274\r\0017\302\261,J\330-\340\036?\302\2637\277"
+	.ascii	"\244\027"
+	.string	"\216\317\036\362\301}\031\3214\317\033_\306\222\273\346\"\362\237;n`z7ofd\377H\3540\272\205\375\241\367\304\346bR\337g\237\310o\213l\375\253\276\321\257\317v\331Z\302\374\241\017\317\250\337{\255\272U\321S\204\036\377\271\013\333\020C\006\r\032n\2572\340\366\234g\224^\334\300\214\377d\016\367\277*\032\206yC\217\341 \346\237\215\346\301}i\302\016\317\347<\203\225\342zA\356\270\223\"2\223</m\354\317\362\305\b\003\001\017\005\375\226~\371J]\266\244J\217\364KO\244\267u$\351\225\276\233\213x\354\241\005\003\223\336\371\320\240H\337OZ\235kK\314\372r\227\005\2267x\007<\321OE\373\274\231\357\n=\321\007H\334j\313\362)\027\275\320\263|\315E\243\037\360-\002V*THE\255/H8G-\301\250\222r\341\002\252\304\322\252\212\312\212\205\224\325\222\005\n\250\025\313\250*\253\345\222"
+	.string	"\246j!U\265tAEU\265D\322a\365\2331\2070.X\237\005\300\323z-\3111\253\2134\352\242\261\207]\336\272\320\207\fbAt3\347\341e\035\327H;\376\244\210@\377d\367I\352\206\266q\360\017\332c\003\251!\034p\216\025\376\374\263\257\206\032C\2377{\360M?\025\335\302\245\035\374\203\247w\360\215XfN\221L\317?\271\3013\375T\324\357\203\007q \r\360\252\2549\344yz\246?(\203\3601\261\247oh/\233\354 \222\306\313\316`3"
+	.ascii	"\",\343\364\f\026|\323;)\370\005\036\374\207\203)`\372&;\206"
+	.ascii	"r\037\336\203\351\373\256\017\210\361qF6\347C\366\n\365\222\235"
+	.ascii	"\342\366\023\030\023\363P7\260=\235\1772\325\320\334\213\251"
+	.ascii	"\326\025\355\223\"b\r6\206\313\314,\34290\020\201\361\033\216"
+	.ascii	"\203i\204\211\204\351\346v{=V\351{C\334q&a\306\325%\037\347w"
+	.ascii	"\376\372)\361\032\315\3447E\257(Bu\236]\313iD1\341\230q\314\270"
+	.ascii	"\333\353\267q\236\311y\234\327\t\200\351\250\201(\005\021SJ\321"
+	.ascii	"\210$I\nY\016\200\002\221)\262\352\022\2005E\2111\223\032\223"
+	.ascii	"\235\3757c\260\365O\035\005x\t#6\021\377\2329\304\316=6\033f"
+	.ascii	"\016\023:\r7\247\335\321\227\323\310f\352\371{Q\342\245)\034"
+	.ascii	"I8\034\221\261b\277\277\251\363Z\336\307\337r\202\355%\237a2"
+	.ascii	"\200\213|\344\337\005\345eD\027\252\332\206\345_l7\364\001e\327"
+	.ascii	"g\272\305\003\230"
+	.string	"\201pA*\204\315;\270\271\301\252 0\033\203\330>\231\037\211\247o\0012\366\370J\301\314\237\325]\001e\024\355\256\366\024aA\350\220\205\032\374\354\331\007n\261\007\016\312\234\177\311\267\276\357\243~\035\365\351a5\245\020iX2}\307\336\307b\264\314Ad\234q\243\021T\230\253<O\374\3554\365\270\202\305w\266\024fP\203\007\375\202/\335b\244\n\273-\2265qK\027\220}l\267\013jCS\275\307\202\325\201k#$\325\335&\220@\211sl\332f\232r\034O\341@\0260\r\213\220\030\005Dg\342\210/\350\352\374\202\242\343\244\032\271\330X\024\263I\032\300=\266q\243\247f\324\213w\370\314\247\333$5E\n\211\300N]\362B\223\273.\331 h\b\360&\254\220Q\005\343@.\006\324\006\364y\330\001\316\242\277lo.\332\215\351\336AR\251`\253]#4\253@\304\020\306\227\032\221\034\320\311\253\337\365"
+	.string	"\326\207\262\223n\367\320`\353\360\371<tA\236\336\207I~F\3608Z \326\224\"M\341)\370\361C \3570_\347'\243\252;\360\256\326\037\333K\033D\313_\302\005_\353\212"
+	.ascii	"0\324\270\250\227\235f\t\225\316Z\221/5\210\375~\334\302\273"
+	.ascii	"\252\3642_\303\"\322\317S\003"
+	.text
+	.section	.gnu.lto_batteryUpdateVoltageState.63.a433deb85508ed19,"e",@progbits
+	.string	"(\265/\375`\203\007\305#"
+	.string	"\266\375\326I\220\224\322p\235\005\360\372^\272\231@\017\340\200\337\013*\276\326\327o\253\022tJ\013\231'\377\314\007E\262V\343w\342\221\205\305\262}\336\270g\b"
+	.string	"\030\231\033\220n\346>\303\227\005\300\n\370\263\350\254\031\331f\367\336[J\231\002\277"
+	.string	"\255"
+	.string	"\307"
+	.string	";\225\257C\3719\224\257\246\374\024\345\243'\377D\371}\362\271\371K`%\006\232\201\257um\212{[\231\350\330\013\346e\257)wk\271<l\214\243doX\213\376\036~\336\242\314{\322\337\334%\213U]!v\354j[\327u\330+6i\201?_\217\267\323\345\324\024=\233\223\276\252\217\016\231TZ\340/\n\212}\275\247\345=\235\340\235n\257\234Jp\356\034\240d\207\223\035\342d\342\f6\271@\256\326\002\270rR\262\252\372\244"
+	.ascii	"\244DD-:\304)\212\227\374\300\347/\311t\336h-\207H.q\2438\356"
+	.ascii	"\222\3064e]\327\225r\212:Y\365Y\327\365\214L\212\330\247\354"
+	.ascii	"\277\302\377\t~5\030\337\026\213\336\302\320P\272(\267J\326\204"
+	.ascii	"\302U\344\270\257\327\002\261\230J\034e\273\2516\354\233\203"
+	.ascii	"A\204\270\361\305\261M\2535\305\327\267\306\233\271\305\220."
+	.ascii	"zF\256G3\253\355\372\337\354\021aX\353\252\264P\214\\\005\334"
+	.ascii	"|`\270\177e\354\f\f\337\026'\"\362\"\027\375\022\323E\267\037"
+	.ascii	"\250AQ\0269\356_\032\271\251\376=\327V\361\243\374\036\225\277"
+	.ascii	"\203\362uT>\216\312\2679\3715'\237F\345\013O\376\f\312\227A\371"
+	.ascii	"1)\037F\345\277\250|\027\224\037D\371-)\237\005\345\257\234|"
+	.ascii	"\025\224\237r\362\201*\377\207\362}(\277\227\362y*?\300NI;\002"
+	.ascii	"l\225\354\211\215\355\211\235\251\2776r\252!\227\024\177\235"
+	.ascii	"#V\3064\266R\332T_\"\272\251\26566T\247}\275W/\262/K{\355k\241"
+	.ascii	"\032\323\025\257{\n\226)\204\327\253\265\001\236\240\332\240"
+	.ascii	"\266\270vZ\247\325&G8]\357z\247w\271'\214\244\021\034_^3\374"
+	.ascii	"/`\300\213\334\365\215\261\225\376\005\262f\r:8p\220.\252k\224"
+	.ascii	"l-\353\313u]\317\246zNj\306\331\022\273]m\264s\035\323\305de"
+	.ascii	"\344\270\247\255>\330\037\020r\353\272T\340\333c}D\2200aB\272"
+	.ascii	"h\332k\226\306u6\272<\266,\210\302\317O\272\350\331\013V\245"
+	.ascii	"\344\356\336#\334\017\264cA\271u]\013|u\354\016\241\277\300s"
+	.ascii	"\224a\bi\303\260\210HDD\f\222y\020\017\007#!$$\240\n\303##\342"
+	.ascii	"Q\221\320\321\260h\b\210h\030dt4\344\2419"
+	.string	"Q\203\220\321\020\211H4\032\362\226\305=\267Uhmnl\213Yl\343\227\306\336\347\004\332\360\321\246s\306P\360\222Z\304\253\215\355W\3234\275R\\\254\351a\225\222\3278\232Vyxe\201mo\214\204O\030E\3309bq\275/78\336L\003\203,\261[\333L\373\246\340\262\312\320\246\222\354\302\234\274\005\233\\ u=-\263h\033\3232-l\002\3231\007\226\215\tL\024\023\247{\\\372\245qz\271^\372F\211K\243doY\312\001Pf#r\301Ni\351\225\016vL\030K\2674\325Xz\317\252Tz\005\t\202\037\225^\260\264\200\233\250a@&\221DC\")HJ\222a\r\340\002\031\241\251:\021\020\245\203\n\241Xh\243}\003\013'%\030\2172R\277\007\222\256#\036/\227\301\242\272ua0Y\225\311\275\341R\361\313\310\334S\343\220D;c\233\230\317<\225\347\371\034Bw\027TAc~"
+	.string	"7\003\271tU\276\231^L\215\303\020\376l\305\251\336 \356AlC\036\201\213\262\252\354?\351\365+2F"
+	.string	"c\337\211\333B!\364e}\235\373\325\364{\006\236L\363\210\250\224x\372\275~\005\243\032\t{Z\314\303k<\276A\r@\t\335\333\252\370~\025\321\"|`SA(\331sk\017\306\201\240)\256A\341\230c\360\372\234\030\020~\035\2132YS\270\005\306\017\257\377\316\257\305\365\367\243\331\310\276\262\306g\254\242\320\202{8\315\353i\tgeG\"Qz\347\352\022*\025\n\341E"
+	.ascii	"4/\340\032\223Z\346\333bX\244\264\024/Zt\237\316\033\002\276"
+	.ascii	"\310k^\202\334\260\034\330f\260\\\016\310\261\233\205aGV\003"
+	.text
+	.section	.gnu.lto_batteryUpdateLVC.64.a433deb85508ed19,"e",@progbits
+	.string	"(\265/\375`\366\003\345\031"
+	.string	"\206n\244H\300XM:pML4\027\307q#A\003\3304+?\226\"\226V\375d+T\275\346\363C\037v\260\233\264\206\354sXS\265\255\020\242\255\016\213\215\261MQ\020dK\366F\320\374\215\007\354\226?L,!do\"wJ\001\213"
+	.string	"\202"
+	.string	"\230"
+	.string	"\326\261\303\317\207\266/\355\357\270\021\317\217v\f\326\032c\311H\2559\b~\360}\"\270\212~v\247\241\237\346\261\265<'T\275!\241\037%0\265\326\325\3168\317S\340\347\321\331\255\344\361=\033\320v\033\361T\002\320\263\211\201\242\305?\0266N\254\220\336\217\244*>\303[-\300\215\204\354\272\006\270&\240"
+	.ascii	"\267Z\247\202\"\003Kx\363\221\033\345D\213\016A\255\365<.K\334"
+	.ascii	"hRz6\265VK\333\r\305\035\3366\016\333\025\354\215\022S\256\027"
+	.ascii	"\224$\314\nYk\035\261;Z\312]\364\313!\311\311G\212\261\335\341"
+	.ascii	"?\\_\255>\021|\037W\372\340\023}\372\005\223\267}\3720\372\371"
+	.ascii	"\2250\n\341\214"
+	.string	"\216zd\224\235\243\311\035\355wu\203lOZE\245i~\364\317\254t\270\322)O\032\364\244?O\332\363\244)\225\236S\272\233\322\333I\313\225\376\200\005B8\027CCK%WMD\215\251O\363H\r\277\307\221t\2363\203\021\n\267\343\323\001\347q\001H4`t\221B\263\252\365\276\374\224\231;\2634{\244w7nS\226f\374(\242\311(C\331y\232;\201\232\302\334\333\321\310\273\025\237\314>\247n\273&\026GtG\250\337P\233\302\233\3340\t\201\230rx\231Y\333\302\231v\224\\\030q\340\214\\\3743\212dv\240\312\021\020JI\016/\016\220\200,\231\237\321])&\351\n\206/\315\276Zk\004\237\310\213d\320\260a\003\375\334\275\322\320\315D\302DQ\267\243<\016\225+&Yy\220\013\301\361\211\314j\265\350\003\366P\023\003\341\222\315V9\260\327\013\306\"\020\273i\275\\\025d9-Q\234\261"
+	.ascii	"\230U#Bl"
+	.string	"\311d8\034V1\021\026\313i\305V9.\234\327\212%\306V5\006\f\013\321\022W2\030L\\\205\271\236wu\203(\244x\352YZ\352W\254\\\307\220-6.`\270Tn\024T\231\222\305\306\245\307\311S\033\356k8pSK\235t^ \251\337\202\313\200LM\207j\275\375\266\300\227\232\r\272\206\272\223Po\rd\251\025\321\226\2567f\b\323O\031\347j\255\337\216\356\242\020E}\002UmK\250\021\300\220S\320\t\n\032\212\023$%\315\001p\002\031)\274:\021p-4\210Ha\266\031\371\214\2377\"PI\353i{\312\260\264)\352\235\bq\2612\212p\0178\367\321}\250\310i\227E\304m\266\374\205\310\246r\320uC#^h\350\365\342\"i2\3146k\373{.\3114\300)\210@\261\230\300\265\0319!\026\206\264\024X\022*~\210\237G,6\264\003\371\242\340%\301C\272\346\004\336D5\222\217"
+	.string	""
+	.ascii	"$u\\\310\034r\214\004\271r0\304\246\324H\376\301\030vu\311\273"
+	.ascii	"\253\260\211eE\246\345qd\231#\030\250"
+	.text
+	.section	.gnu.lto_batteryUpdateConsumptionState.65.a433deb85508ed19,"e",@progbits
+	.string	"(\265/\375`\230\002E\022"
+	.string	"\206 tG\340\320(\035\332\203\370\336)W\201\003\320C\272\22513\366\325E\243\003\031\347t\307\036\213\350I\351\377\036\355\037GD\t\253\252\376P?a~@`\236D(\333 >\360D\n\bwe\242\021$,6\262\t!R\246\024`"
+	.string	"Y"
+	.string	"]"
+	.string	"\007\276w/\371e\023\375\026b\243\f\013\026\235\032\273\013*\210\277\336A\372\242\327q\232/?\212\220f4\225w\200\220>\240\026\016\334\007\211\226\227\214Q\304\203\013\314\275"
+	.string	"4\226\022\355Bv+\311\311Rm\007\001j\201\341>v\3676O\f\264Xf\024\331]\347\214\346r\227n\033\3076\003;W\002\366\311O\254\276]\331\002\377v\034\n\376\314;\267P\362\263w>\212\367\356\032eA%l\260<\262o\261\324\232}n5\306\376\315\035\2714\307\245U\323\231\351\227\004\364\304hP\264\233\341\b\307\376t=4\277\271}\023\276-\201\202\327oR\276\035\021wdxh\354\336\f\274s$\336\273(c\250\306\350cw=\255\371+\036\225\300\207\240\034!\217\264M\247\374,\352m?\215\206\016?1U\261o\273\333\245x\252"
+	.string	"lW\361\235\024\177\306!\n\345\275S\375\220\320\013,\217\362\234\326|\023/5s\244\236\302D'\365(\204rwUTk\276\005\357Z\2223C\2267\034(UJ\2252\235\204\017B\224\311\245\nO\254\320\301"
+	.ascii	"\237B*\260B\227\313T\002\266X\253\226*l\201\252\224\351\004<"
+	.ascii	"\261Z`H\001\257&\204,\320\265Z\261\300\322\rv\215\261\315?\037"
+	.ascii	"\237\037\230\306:\374\202+z!\335\005Q\215\221\307\356~ZsTN/\""
+	.ascii	"\007\006\204\373D\350\341\024\301\206!\033\266\230\037\361\374"
+	.ascii	"\026\347\031\221@\0227 \320\002\251!\363\263d\221\263\355o\262"
+	.ascii	"\237{\333\367n,\256p\344\346u\3672e\241\261@Gv\330$s8\007\251"
+	.ascii	"\270\362\2621\337\272\221\027\276\271\363\363,\372\263\355*\325"
+	.ascii	"ep\366,\246\302\356\205\221\315\364H\355&\227\032\262\036\217"
+	.ascii	"\250A\0039A\322\212d\267h9.\2320\270\027\\\031\316Y\201\tn\301"
+	.ascii	"\215\366\302P\b\275\335h\264\372\352\321\256\303\307r\031"
+	.text
+	.section	.gnu.lto_batteryUpdateStates.66.a433deb85508ed19,"e",@progbits
+	.string	"(\265/\375`\b\001\305\f"
+	.string	"\266\327UB\020Q\234\016@\264\320;\212\005\244\321\001\217Q\277WD\320\337\212,@l\247\f\001Kj\364\311\232\006\373ZI\035l`\262'\245\231\214L\334*\002L.\2021\307\032\216N\034]\001\330w\243M\366N)@"
+	.string	"A"
+	.string	"D"
+	.string	"\340?$x\262\273\341\304\310\256H\300\003\260\323\313\001X\247\325-\326\251A[\306E\017{T\214\n\"$\273[g\207\203\227\240\177\220OBR\350\362B\260\273\226!\251t\317\333\026`\373\200}\r\001\036\366\224\306n\272\257\237n\353\037\177E\261\320x\221"
+	.string	"\306\356\205T\311\216TE\210\233\376\223}\321/\361\220\023\350\222\0321\200\231@\337\322\336B\016\024\311\214]\021s\352\002\330\351+\266/\355\2178\211\024p\214Ph\327\374\215\017>\352&@>\b7\330\344\303S\177\263N\255\371\220W\033%\"2\210d\312\024YM\273\303\271\030'<\260\264\260\244\375\201 \037Z\256`1\216f\310\026Crr\260_\355\356z\006\033\215\344h\244\307@\353l\013>\217\326u\237\254\303Y&B\247}\337\206S\275\216\363<\232W=\333\246S\263\316\253\231"
+	.string	"\346\034h]\3758\256\253\025q_\355\364\260\202\032\243h\216\214\315\024\331A~\f\327\264&61\"\001\032"
+	.string	"2\241=i`\\ \210\003\22755\036Sc\202\024\320\256O\324E\252\025 \034HA\263\3415\005C\327@/\356\226\320"
+	.ascii	"\374h\302\302E\035^A\004\234\242A\254N\203ky!L2"
+	.text
+	.section	.gnu.lto_getLowVoltageCutoff.67.a433deb85508ed19,"e",@progbits
+	.string	"(\265/\375 \365\315\006"
+	.string	"\362\314/4`m\322\001@\341\034\2217 G@q1-\373'J\200\320U\2306o-jia%\307b\252G\350]V\242\002\234f\201\320\261\226@w\304\222M\366N)\266T\030i]W%\001N\031\347\305\232\360\242PY\200\0269a5\340\310`Ix\305(\341T\367\316cs`\322\356\346\324\337xm\360+\376\214\301\332\351\237\217E\177\004\033\347`WMs\022\366\241u\036\273Q\237\020\004\221]\210\223\317\202\274\017\013\333\031{\3621\236\221q&P):"
+	.string	"#&\017\035%\273\025\272> \372\223NE\177n\342\331[\346_\343\320\205\007\t\345h\336(\007\273\353F9\235\333\335v\201m\003\333\021\001\b"
+	.ascii	"2\003\336::V\b\3055\261\032!\264\020\231\270+\246v\222\001"
+	.text
+	.section	.gnu.lto_getBatteryState.68.a433deb85508ed19,"e",@progbits
+	.string	"(\265/\375 \366\275\006"
+	.string	"B\r03`m\322\001@\203"
+	.string	"\247@f9\364\2515xW\025\001\251\"}\321+\321,\352=\234d7\320UBoJ\207\223\300\034\205<\027\253\026\370n\311\336R\246\024\316\\6p\262,\214\302\253 Ui\246\352i\0260\f/\003\253w)0\3250\301gQ\024|R\334+(\325\362Q\007\373 \217\227\257\341\r'\217\335\371\234\350.\025\240\342\223!;zR/\354\267\335]+\310v:\225\200\342$AdW\"\224\262&nd\303v\307\226\374\216{t|\265\230\221\005D@<\204\240\354\306g\371@t\327.\020\335)\306\257\347\345\377\343\215\243\204\004\313<\317\n\302\356:\261l\342\326\3336\260}`\333\"\007"
+	.ascii	"2\001\0238#&\016\345\256!Y\210<\334\025S;\311"
+	.text
+	.section	.gnu.lto_getVoltageState.69.a433deb85508ed19,"e",@progbits
+	.string	"(\265/\375 \366\305\006"
+	.string	"\002\215/3pM\322\001\240\f\030X\201s\303/\017i\234\201\231\2105x\233\242\212ZC\332\366pd\3242\345\244f\356\177\327\277\260\214\356\2711\f\334X\262\267\224)\005\306X4P\252\252\313\302\243\340De$\352e\030.\r\017\003\251g1\360\344 \301WM\023|Q\334\353'\265\342\321\007\373!\217\226\257a\315&\177\335\371\033\350.5\240\302\223\231\035;\251\027\366\333\352\307v:\265\200\303D\341dw\"K\331\0227\262a\233cG\276\307?8\266Z\314\300\004\"$ DPv\343\253\234"
+	.string	"\272k\037\200\356\024\343\326\323\362\017\362\326A\222]X\347\t\220\260\273\316\013\243\270\365\266\017l#\330\266\b\b"
+	.ascii	"2\003\316:#f\b\3055\3616\002g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_getConsumptionState.70.a433deb85508ed19,"e",@progbits
+	.string	"(\265/\375 \366\305\006"
+	.string	"\002\215/3`m\322\001@\203@\324\020N\201U1k<\226Q'\206\236|\336\n\321,\352=\234d7\320UBoK\020\025\340\024\205<\027\253\026\370n\311\336R\246\024\316\\6p\262,\214\302\253 Ui\246\352i\0260\f/\003\253w)0\3250\301gQ\024|R\334+(\325\362Q\007\373 \217\227\237\341\r'\217\335\371\234\350.\025`\342\223!;zR-\354\267U\220\355t*\001\207I\002\311nD(eK\234\210\206\355\216-\371\035\367\350\370j\021#\013\200\250x\bA\331\215\317\362\201\350\256] \272\323\213_\317\313\377\307\333\306\310\t\226y\236\025\204\335ub\231\304\255\267m`\373\3006E\b"
+	.ascii	"2\003\316:#f\b\3055\3616\002g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_batteryStateStrings.71.a433deb85508ed19,"e",@progbits
+	.string	"(\265/\375 \357u\006"
+	.string	"\204\013\216"
+	.string	""
+	.string	""
+	.string	"U"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\370\331\002}\273\001"
+	.string	"\005\001\006\025\001\004\005\001'2\206\b{\by\276\003\005\001'?\206\bwu\301\002\005\001'I\206\bsq\304'R\206\bom\306\001"
+	.string	"?\202\210\200(k3\307\0014\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\005INIT"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/battery.c"
+	.string	"\fNOT PRESENT"
+	.string	"\tCRITICAL"
+	.string	"\bWARNING"
+	.string	"\003OK"
+	.string	"\b"
+	.ascii	"H \r\002\006\204\203\214\001\341<\363hP\371\r\240\b"
+	.text
+	.section	.gnu.lto_getBatteryStateString.72.a433deb85508ed19,"e",@progbits
+	.string	"(\265/\375`S"
+	.string	"E\t"
+	.string	"\306\021A;0\345(\035\036N\322\241\200A\022\276O\021i\344\212\212\"\355\353\221\341\034\324\251y\3416\266=\274 Bl\260\255Am\026\206\202\b!\240\337]\311\b\202;"
+	.string	"\2425\262\311\336)\005/"
+	.string	"/"
+	.string	"0"
+	.string	"*\215\312GF\b\333\255\324\365\003\332\347\346\002\332\247\354x\351\261\344\277\365,@\213\013*e\361\250i\330]GTJu\313\333N\260\275`[&\266\243\245\214\216\031\001\013\214\303\312\256F\f\300\276L\027\210_\362::\211\0030^\260\335\335>\355\221\275}\336&\331\233/\362\021\222K\005\325#G\371dg}\272\013i!\371\326\025b^3\256\233\374\344\363Y\236\020\305\243>}\221\366\031\345\353\021\3020d\303\024cv=E\311a?[\271\n\366p(<\016\004;\017\364\363\272\017\304}\024\004\321\371P\217\367Q\216\201;\t\316\243`\327yt\253\246g+WR\036\230\344\311\266+\236\022\261\331\275`\360\303\f"
+	.ascii	"2\241\365/\260Z\302#\235\2333q\216\324}\256\341DL8\250B\027T"
+	.ascii	"8\342\256\230\332I\006"
+	.text
+	.section	.gnu.lto_batteryInit.73.a433deb85508ed19,"e",@progbits
+	.string	"(\265/\375`\324\003E\030"
+	.string	"\366'\222J\260RRc\366Y\207\377+\202\032\274l\306\002q\316\327\242\033\246J\352t@\3146$\0238:f\030r\234\316\261\315\372\260\246Y1E\376\207v\270"
+	.string	"\336\256d\273\2615\350\336dd\331\275S\312\340\257xFnm\357\275eJ\001y"
+	.string	"{"
+	.string	"\200"
+	.string	"\313\345\362\313f\217m\255\355\255Orc\216\222K\302\362^\017K!\367\210F\tm\177f\325N\276\351\347\376\211\b\247\250\274\367\322L\237\253\217\245\350iZ\325\267<\240V \3571\031\247\324fI\255\300\021G5\004"
+	.ascii	"\336\244$@SA8\346\371\341O\026VX+0\304\315S\004\f\347j\006\364"
+	.ascii	"\235\bn\224%F\200?kc+\367^\333\025\370\341\226\335v\3176\212"
+	.ascii	"}\232\004wIm\b7\272P\001\270\301J\272r\204K\335\242\026\020\035"
+	.ascii	"\375%\265'\034\352\245$\353\336\253\342\313\370\f\n\276\320Q"
+	.ascii	"\303\324jH\0351\376\024c\233\211\025\2211\251\377\3420bdff\322"
+	.ascii	"\2431$\344\231^\324\321\354\320\340\225\322\277\245~\213\273"
+	.ascii	"\270]\310\345\322\243(\322*\351\274.\365\227N\324\371B\306\260"
+	.ascii	"\263_\217\372\273\364\350\201!-\035%\257\236]\332M>k\006\355"
+	.ascii	"\233\001C\252P\025\252Fj\2120]\232\245\"\355>\274\001\344\020"
+	.ascii	"\245]\357\211Wx6\354TU\214\030\215\262\237\233sy\356\211\210"
+	.ascii	"q\352\310\263a\306"
+	.string	"\242A\3341\315\240\375\f\351\315\022\247\035?\013\266\3429\324\241\354\336\237\212\177<\016uIebaI\217\336\214\025\267\276\210\005\254\235@\201\200\243\243\317\344\331\304^\3517Zd\367\366\276\3725n\203A\203\226\226\364\250\355\340\201\375jk4:\376L\236\035\256\245\354p6\033\033\230\n\264\034\356\226\253\261\345h5204\264\032.GK!\340\233\005\033\216fs\273\341h\263\246\336\315\236\017/\253\352:\366L\237\357\343^9c;&\202\\\244\212Dz\242\n\304\275> \347@S@T\250\322\377\262\034\212.\317\017\037\210\223\262_E\221\036\265]o\207\rE\357\262\2354EP)\357\345]g\306\363\263C\202\347R}zX3V\\~\021Q\222\252P\353[jP\\\250a@\013\225\022\253 E)J:\240\002\021\3011\017\02109\244\214J\2450\254\001R\034a\301\266\264\260\213|\303\003\005}\223"
+	.ascii	".i^\256\373<\"\220\241\205\272\362\266\351)$\001B\304\254\022"
+	.ascii	"Z\370\244N\007\320\022\2110\310\275\030<\215\221\"\232\240\240"
+	.ascii	"F\310^\335\034\243[\033j\365\334\363\020\005q\037\020@\016\230"
+	.ascii	"\36138@\221L\316\350\347\007\032]\344FU)\nJ\342G\314\302CN\f"
+	.ascii	"\033\007!\004!\300\030Psd\030G\211\333q\001\005\006Q\013\336"
+	.ascii	"\201\301\025?Z\211\302\"\347\035H\224\226\237%\001A\250\266\201"
+	.ascii	"7v\303\343\241\344\026\235\202>\225{s\311\005\321\304\260\n"
+	.text
+	.section	.gnu.lto_batteryUpdateCurrentMeter.74.a433deb85508ed19,"e",@progbits
+	.string	"(\265/\375`\302\005=$"
+	.string	"\n@\020\016BpjQc\272\021f\004O\256*\201\020\301\314\177\306\320\021"
+	.string	"\373\222bHv3\221\320t\030\003\0215\202~r\306N\2673S\006\200\312"
+	.string	"PA\037\002\251\312P\002l\025\210P\247\227\266\355\275\367\2262\245\311"
+	.string	"\301"
+	.string	"\325"
+	.string	"\350\030\0348\340\360J\331\b3\223\025\341\2455\240/}0\017\223\343C\317\230\364\341r\357\255\275\264s\330\265\227\265f\373\325~\326\265\322o\355\360\354\336\2539^\367\016'X\002\372\022\367\001\346K\362G\346K\247v\330\207N\356\323|\t\2221\336{s\266\311\323\327h3\3644K\322\326\324\377\275\226;R\205\026&\226\325ev&\375\251\310Q\234\225\250\"\365$!\210\2619\364<QS\344"
+	.ascii	"!R\204/\023\254\346\231\304\365\017Q\210\203\312_E\035\351A\223"
+	.ascii	"\342a\006Xp\025e\204$+\b\032f\215]\r9rKZ\340a\244\272I\001I\033"
+	.ascii	"Yp\317\271^}HA\325z&\335{]\205R"
+	.string	"Cn\333m\177\331\346\331%\214\367`\205\352\317\226`\027\025\250\267\271\233\022N&L\2303&}\272\330\251)`\356\220\003\352\207\367Z\201\336\373t\241\257\346kR\370P^Z\305\212\025&\213\026\365B\333\350\034\213@\373\263\037\257-+k\261\254d\336\272\020\003\bX\311\354\2379\032%\037\212\227t\365B\235\371\362\326K\026c\225\326\324S=\332C\250j\261\354\333\343\361x\264]b\233\325\t>\346&\360\256\373\350\2546\262U\027}\353\277\331\252i\266\352\231Y\215\326\252OZ\265I\253.g\325$Zm\317\352jV_\301\ty\031\007\315\360s\257\220#\242[,\333L\371\230\277\353e\265\366\355\017}2/\343Z\327\r\035`\306!\210i\224zai/\020\335\2303\213u\277I\002G\020\312d\222\326\026&&\220\203\032\340i\025\323N\257\244Y\352\205\2445\265\254\200\366\367\005r\256\0209o\230G\266"
+	.string	"\321\313\217\220\236\006]\322/\365\302#\3732\377\024\"W\021\352\316m\304/E3\020 \247Z\007\260\340j\221\2657p\270\021\257\274\316O\274F\261_M\344>>\304\270\224z\276\347|\034\226aO\025\225}\207*,\372x\252\253\360\002\371\242r\255\276|;\177\007\363%\211\0136\314zp\242\357\375\275\nur+\214\r\263\214\327\352>\250Y\361\250e\266?|\016\b\364^ \006?\316\345\204\0201b\204\371\322\332\263\313\317\330\326\315\276\221\242\005K\225\026\225\221-\262\247\241`Y\2657kd\037&\216\201\324\243!\303\347\224k\33211\355\226\f\364\234|J>\023>]\357\305\213\021:\032>\337\216\027\303w\353\241\3201\3118\341k\322\361xNK"
+	.string	"\274\204\204\203\247\363\371\224\\\344z\274]\257I\327\3135\311Pb\312-\361z9$\004\336\325\320\361r\276\335\216\227\253\r\237N^\273\244Z(?\317\235D\336\262D7;Y\212@:?\327\377\303N\225\"\315b\271\242\021n\003\373\nrJ8\315\3720s\262\261\"r\212\025*\001K\2633[\204$MR/4.h\177N`gF`\301\262\037\201\211\332\004\32658u\346\205\224R%:\324R\320bhl\352\264\004\254\375\n\226!U\323\332)V\332\304\274\360\2648\2579\231\005"
+	.string	"\357}bPZ\323\226|zX\201\252GGx\022v\250\201(\347\024SdFH&H\222\026\322\001p\002\2211\243\362\020x'\243I2\214\001\315\365x\310\253y\006X\310\347\342\021\250\321\236:\275\337\202v\306$,\231\030D\244\343\021"
+	.string	"\375\2649l7\271\035\030\374\217gn\340hx\261\243KZ\302a\215G\216\005K"
+	.ascii	"\372(/q$\362\037\002*\033\252\033\370\320\223\353\342GH \022"
+	.ascii	"^D\270-\225\022\372I\354\0066\267\357\215 l\362\003\367\376\212"
+	.ascii	"{\350\345\220L-\017AMK\0304\304\273>\261X\376\251\3251\026\271"
+	.ascii	"]\260\362\314\314\001\250\245\314O}'2<\017Rhip\007\035\304\233"
+	.ascii	"\323\244_\003\020\f\017\277\r\360\206\276\"\3369\202\007\307"
+	.ascii	"F\004\365\t)\346\273\240a\236w\254\0064]i\263[\257\301=#?\330"
+	.ascii	"\211\270\377\027\025\205\372\262\325\024~\201E')\350#|\f{\357"
+	.ascii	".F/3A\357r\350\023\177KP\376V$\214\032"
+	.text
+	.section	.gnu.lto_calculateVbatPidCompensation.75.a433deb85508ed19,"e",@progbits
+	.string	"(\265/\375`\307"
+	.string	"U\013"
+	.string	"\266\325M? O\234\0160f\001g\004"
+	.string	"\271-\311\251U\r\307O2\030zwoNWZ\300C\311\345$\220\267>(\320\250\274\224K\316\232\004\002P\220\202R\374\233\r\305\003.\226'\224\020\331[\312\224\0029"
+	.string	"="
+	.string	":"
+	.string	"#Z\354n5\371\200\351\021^\300\364\250\034\256\035jj>\244\002=|\220:\357sHa\270J<\016Nv\367\034O\f\017\224\t\251\354\256\263\363.\334\361\266\031\330V`\177A>\\\335`\353\277;\237~\214\250@a\242S\332\255Pz\261\036\221D\207\177\277\255\371\034\216\374\363\210\372X 0\201\244\261bw\017<\032\001\365\350\1778\b\315\036A\221\306\306I\032B\001 h"
+	.string	"i_\021\362]\252\352\347\251\232\301\231\256\227\216\024\\~\330\316\336\301\241v\271\004~\210\213\220\340o<\272\343\311w\217\276gz\274BB%\\|[\226l\021(5\303\001\230\365\300\202i\020\300\030J\007\2636\033\313\245\312\260+\323XY\245q`\311T\030,\253(\005|A\260\260js]X\025\021m\207\232\232aA!=\372\332\311\355n\006T1l\253J2\234\360\3304\023"
+	.ascii	"seY\203m0bf\202\007G\006\254\340\006[\260\013\205\035\3352\031"
+	.ascii	"\272\206\207L\220\240\342}L(\213\332\006\270\006\215\302g\250"
+	.ascii	"!\333U\312"
+	.text
+	.section	.gnu.lto_calculateBatteryPercentageRemaining.76.a433deb85508ed19,"e",@progbits
+	.string	"(\265/\375`q\004\325\035"
+	.string	"\306\370\302I\260TN:i!>I\373\340\3344s\fZ(B\036\3066\362\266\216\346\3350\3749v~*n_\200\225\326\177\302Z\017S\320\250a(\336\3202\317\035\265\277;*\224\232\030A~s\250\305\241V\214;\236\330M\210\334)\005\252"
+	.string	"\234"
+	.string	"\265"
+	.ascii	"+\224,\205\325j\"\rK\035\033\177T\235\353\327\372\264\377UKB"
+	.ascii	"\3445\356e\333\274\364\033nAAF\345B\277\313\266\017o\203\351"
+	.ascii	"\\Jd\365AF\205i5 ?\312\374\206~\234\257\241\037\355%\333\366"
+	.ascii	"q\332L\376\226m\327\002\222\325\252\366U\225eV\353\320\300G\037"
+	.ascii	" ?:\201\002&\003?|a\202VaAyQ\251u\210\333\251\003OGq'\320\257"
+	.ascii	"9\020\261\260@\211\n\2128\225\372\350\022\224\272x\013\216\260"
+	.ascii	"\005\237\346v}\226\b\226\"\200Z\353\267>I\004\235\346\2549\250"
+	.ascii	"\265zF\005O\334\265\333\376`\333\310\026\203\001=v>\325Gw8:\242"
+	.ascii	"\037\205\366]\0270\205\204\206p\326ZE\354\2720\220~9t9y\232V"
+	.ascii	"\354\353\370\016\240Oe\017\274\371(\036\375\370\255M\211UI\321"
+	.ascii	"4\323\354\241\323\\\027\366\305Zk\365\266\260\211\206\316u\013"
+	.ascii	"\321\351\240k\335@t\372\207\234\366!\247{\3504\017\235\336\241"
+	.ascii	"\323:t:\207N\343\324\246o\310i\033r\272\206\234\246\241\3233"
+	.ascii	"tZ\206N\307\320\351[m\032\206\234~\251M\333\350\264\3138\335"
+	.ascii	"2N\223t\2726N\323qz\034\247E:\275\343\364\024\247\037 (+\263"
+	.ascii	"Ab0{\333C\241E\270\230\216<\002\263/\203!\264\355\313\216O\240"
+	.ascii	"\320$\334\210\022\221\027\241P\301\202\005\372\321\266\bf\220"
+	.ascii	"U\021\216:K4\340,IW\331\027\232\201\347\254\316z\226SLv\013\241"
+	.ascii	".\233\263\377\272\230E\225CF\031\216(-\353\262\"X\211\204\\\272"
+	.ascii	"-\373\322Hm\311}iV[\037!Pha\317\341\333S\255MD\343\322\355YR"
+	.ascii	"^\211;w\334\227VN3\315\273\342\352\210\225f\276\360 \030\310"
+	.ascii	"Z\353\002\377\307\201d\320\260a\003\375\270\373 M\204B;\367X"
+	.ascii	"W\322J\263\213W\242B\353\263u\305\271\207\351\0240\251\365i\201"
+	.ascii	"\017\3666*J2\372\345x8\244\036\217\327\323\361(\375\216t9\020"
+	.ascii	"\271\0071\273\016\271\037\322N\347\333M\230\261\256H\311\267"
+	.ascii	"\373\375r\034pI\276^\022\322.\t\207t\224\343\341t\276$\\\321"
+	.ascii	"\217{ v>\334\257\327\363\341l\303\246\213\337\026~\025\251q\250"
+	.ascii	"%\313\031\232H\264!\316b\314\3638\320\222\260\r\264\337\372K"
+	.ascii	"\260P1\326\264N\"\215\331!\262\240\215\031\362\237\r\332{\371"
+	.ascii	"\354\317\212`=k\263>[ K\231\305\263=;+\263<\313@Jyu[\234\335"
+	.ascii	"Y\\\226\322\352fq \\\311\330\315\316'0\204M\004h\315\332l\001"
+	.ascii	"\257\362\212f_\266fy\226\224V3K#\263\267\235\331\227W\017P\250"
+	.ascii	"A(#\215A\n)g\"\231\321\264\260\325\220\002\031#\253\007\020X"
+	.ascii	"fE\311p\303c\225*\363\363\213J\351\233R\027A\256\3251\3406u\021"
+	.ascii	"m-\0342G\330\340\343c\362\030\f\"\310\344\215\306N1\274\272\035"
+	.ascii	"\314E\273\373\377\213\035\207\202\216\374\023{\344\222\356\033"
+	.ascii	"\027%\021^L\262\334~\336\316y\227\262\036jk\315\017\005\271&"
+	.ascii	"x\207\322I''\036L&Y\316[\254X0\315F\035\337h\300@4[v\222~\036"
+	.ascii	"\376\be;\221r\224D\241#\214\275\332\003^\304\216?R\002\036\r"
+	.ascii	",\221\034\025\354\316.v\232\024\221\357\215\032"
+	.text
+	.section	.gnu.lto_batteryUpdateAlarms.77.a433deb85508ed19,"e",@progbits
+	.string	"(\265/\375`Z"
+	.string	"\035\t"
+	.string	"f\021@8@\255\322\001\364F\254\265\334K\347\202\026x>\233\332\304}Oo\235m\223\225\357\025\323B\265{W\004Z\0045\336\305\236\241\264h\b\0202W\005E\332^\265O\366\226)\005."
+	.string	"."
+	.string	"2"
+	.string	"QK\376e\263\273o\035\003\206\246\313\211Gi0\373@\021\bQr@u\001\276u\215\b?\325\313fw\255`(qo\267\235`\373\300\266H6\354\323Ha_\356\356:\256\354\253\277\025h\220\220b\273\252\332\312\3126\020\f\333\317\270d\237\034\306\332\307BR\035)\273;c\305K\227\001#\031\262/\232\316\242\315<\242I\226\307\016G\tJi\266\275o<"
+	.string	"\354\242\020|\327_\020\276\3057\213Fz\360\233?\262|{\274\244LT^'\255\005\366hD\335'\024\342t\246\327q\036\350\343M\320\002\207az:oj\b\3145|\272\031\342\270nf`\247\313\215++\270d\247\370I\214\332\234\203\036t@\f"
+	.string	"3\241\305/\306\326Pq\330\233\250\266@\n\212\270\355\206"
+	.ascii	"\3412\312\313\020\304\3452\245P{"
+	.text
+	.section	.gnu.lto_isBatteryVoltageConfigured.78.a433deb85508ed19,"e",@progbits
+	.string	"(\265/\375`\n"
+	.string	"E\007"
+	.string	"b\21635Pm\323\001'\243\241 \020\363\001\020\031Q\240\b\236\036\236b\262v\350?X2\"\026\024\214\006+=\334\233cf\206(\247\373\275\202\2004\023:\034\264\211\224)\005\316\\0\213\272.\214\002\214V\0255T\204\232\005\f\003\314X\021^,\256\032(\013^Ue\301J\247]Z\375\250\016h\272\331\217\323Uu\022q@6;\234#\006\354N \370\033\017=\370\030\177\206\300\362\334\237\217M\177W\213IH\313\221\335m\251\025\366\245\335]\353\307vZ3}I \204$\242c\2673B\331\221\367\001\262\275\261+68\3308{w\3219\250\204#:\331\355\240Z<{f\3765\376<RD8\217\304\023 aw\235\234\207\342\326\333&\260]`;#\b"
+	.ascii	"2\241c\037\030\302\004;T\241\3145z\t\221\303\2353\265\363\t"
+	.text
+	.section	.gnu.lto_getBatteryVoltage.79.a433deb85508ed19,"e",@progbits
+	.string	"(\265/\375`\003"
+	.string	"\035\007"
+	.string	"\262\31514Po\322\001\243\274\242\2020\r\201\301\260\003\203#\300\312\253)\375q(nM\324Z\347\210,#{C\355LUU1V\373\237{\242\241J\020\303\222M\244L)\326`8\260\302\260\f\303\273\240um\252\353m\0322\016O\003\257\207)\260\365P\301\207Y\026|T\334K\253\"\353\001H'lC|$\003\330]\005_\3441\302\347\2703\247\223\327\356\374\216\006\204\200r\263\343'\025\303\276\264*\262\235N5\030\241H\250\354Vl,{\342L:l{l\312\367\370\207\307Y\306\r\213\251$\205\202de7>\201\023Lw\371\201\351N5\236=3\377 \227F-\233\026\372</\013\273\353\324B\027\267\3366\202\355\004\333\031\001\t"
+	.ascii	"\002\013\255\262\030\207\"\036\031\002r\r\277\215\030Y\210<\334"
+	.ascii	"\025S;\311"
+	.text
+	.section	.gnu.lto_getLegacyBatteryVoltage.80.a433deb85508ed19,"e",@progbits
+	.string	"(\265/\375`L"
+	.string	"\265\b"
+	.string	"6\321<5@\217\322\001\323\343q\341\0349\365\327\302M\254!\021\242\013\372\0211\263\032\271\377#\326Y[\210\301\353\244&\374\f\243Ki\020@\034T\301\226N\253\335\233H\231R,"
+	.string	","
+	.string	","
+	.string	"\220dU\032a\331\345\242\300\t\340_~"
+	.string	"\376i\306\267\347\346\037\344/\325\245\230N\241'\206aw\235\246\223\305\255\267\235`[\301\366J\\(\025\303\276\265\212\262\235\206\232\2664\255\232\316L\037s\260B\331Lv)\272\226=y%\034\266Av\306\367\370\007\310[r\032\025\001\357V\301T\325\247\"]\214\262\3635\365\245\027G\\d\003\330\335\005?\344\234\346o\374Y\342\2237\375\371\037\370w-PI\211\262\263\003\346h&\262\313\343\3314D-\303\264\316\245\305\216\303\346!r2-j\f\214A\\Y\364`X\0263\334\336ZEAE\020\351\310\226\302"
+	.string	"UK\237\013\251#\f"
+	.ascii	"2\241\347\037\230g\002BE\027\004\207f\214Cu\265k\342\372\b\235"
+	.ascii	"\205\310\303]1\265\223\f"
+	.text
+	.section	.gnu.lto_getBatteryVoltageLatest.81.a433deb85508ed19,"e",@progbits
+	.string	"(\265/\375`\005"
+	.string	"\035\007"
+	.string	"\322\31514`m\322\001@\203\300!\255X?\370%\030\304j\240\035\260;\307\304=f-\352\275CMv\003]%\364.!=i1G!s(\357\333\2164\331D\312\224\002\306X4\220\272\256\213\303\263`ee(\353e\036.\020\017\003\255g9p\025A\301wU\025|\225\270\227VCV\004\217~lK\\\004\013\330\335\005?\344q\302\337\270\263f\223\317\356\374\215\n\200xr\263c'5\303\276\264\032\262\235N\035\300(\321\016\"\331\255\330R\366\304\231p\330\346\330\025\277\343\036\034c\031E\026\323h\243\030A\331\215\217\340\006\323]\276`\272S\215cO\314\377\307\033>\240Q\246u\236"
+	.string	"\f\273\353\314\264\213[o;\301\266\202mQ\t"
+	.ascii	"\004\013\315\262\030\207\"\236\031\002r\r\357\215pY\b2\334\025"
+	.ascii	"S;\311"
+	.text
+	.section	.gnu.lto_getBatteryCellCount.82.a433deb85508ed19,"e",@progbits
+	.string	"(\265/\375 \352\215\006"
+	.string	"B\314-3pM\322\030\240,\007e0\004\n\260\360sX\313S\024\342\027\311'\272\326\b\322\266\207#\243\226)'5S\377\207,"
+	.string	"\265L\350\262E\300oC\242\2242\005c,\2327Y\326\345\301U\217\2522S\3452\020\227\b\207y\225\263\030LIL\317Y\024\365\234\264-*(\365\240\243\236\307\020\024\271\306\2165\233\304\f\243q\023\200Q\352@F'C\277a\251\033\217"
+	.string	"\253\240?O%\3200\321\360s\262{\021Z\331\222\210\304\343\347\274\364\002\003\347\253`\002CA\370\250\240\030Q\331\335\234r\340\205y\215\b\202\016\236OJ\246a\230\002\r\273{f\032\006\256\370'\374\n\277E\b"
+	.ascii	"2\003\316:#h\b\3055\2610\"/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_getBatteryAverageCellVoltage.83.a433deb85508ed19,"e",@progbits
+	.string	"(\265/\375`h"
+	.string	"E\t"
+	.string	"\366\321?7@\217\322\001\233\016\217.a\307\203\324\201\346\2017\335\230\016n\235\002xc\312m\037\261\340f!\006{\360\267\322F:\036\025.\r@\361\257\tztg\t\331D\312\224\0020"
+	.string	"-"
+	.string	"/"
+	.string	"\022\246\222\246\003\003u\322\262\373\305\200\017d\207y\201\354P[\367\236\236\377\2203d\244TT\253\322S[\330]\247jeq\353m\037\330F\260\237\t_)U\303>\266\312\262\235\3264\r5\215ai\325tf\372\030\200\026\305\352\251\224\335\212\227\313\256@\024\016\333$;\343\177\034\204dO\023V\305^r\223\217\357\262\003\b\244\t,\027\327\324\243^\274\235\304\303\354\256\202?\362\017\302w\035\272\033\345U\207\376(;\274\022l\210\230\362e\007\356l\"8\217H\304i\210\035\267u!O\027C\037\016(v\270.n\n\274=x\270(\3326.f\276=\266\312\322\324\300\244'C\3250M\205\372\t\217S\276\002\016"
+	.ascii	"2\241\037(0\366\005d'YN\025\337\232,g,oe\346P\265\342\302\030"
+	.ascii	"\003\263\235\005\313\303\265b\022&\031"
+	.text
+	.section	.gnu.lto_getBatterySagCellVoltage.84.a433deb85508ed19,"e",@progbits
+	.string	"(\265/\375`h"
+	.string	"=\t"
+	.string	"\366\221?6@\217\322\001\233\016\217\336l\340\362#\016\315\003oj\306\205H:\227\033\265\305lC,\270Y\210\301\036\374\255\364\3560\272\224\006\201\331\334!\220\f\335YB6\2212\2450"
+	.string	"-"
+	.string	"/"
+	.string	"\020'\323\206\243\"e\322\262\373\305\200\017`\207y\001\354P1\336=;\377 W\260\360R<\225\351\231%\354\256\323SM\334z\333\032\333\007\3663\001\237)\365\302\376\265\272\262\235\3164\r5}]i\325tf\372\030"
+	.string	"\r\024\325\275\223]\211\226\313\256@\225\r\333%;\343{\374\243\344n\023V\275N\362\022\220\3172C(\244\032\026\212k\352S/\326>\322av\027\301\027\371\347\340\263\016\315\221\362\336\241O\302\016\257\004\031!\247l\331\001\366p\036\266\317h\324Y\210\334\246q\242\017\027E\240N(z6.r\n\2545|\2668\322\264-f\276\375\265\272\312\324\340\244(C\315.M\205\372\210\016T\266\002\016"
+	.ascii	"2\241\037(0\366\005d'YN\025\337\232,g,oe\346P\265\342\302\030"
+	.ascii	"\003\263\235\005\313\303\265b\022&\031"
+	.text
+	.section	.gnu.lto_isAmperageConfigured.85.a433deb85508ed19,"e",@progbits
+	.string	"(\265/\375`\f"
+	.string	"E\007"
+	.string	"B\01634Pm\323\001\244\004\312\310(\351\032\253\016\024fy%<\305dI\263u\243m\203\330\310Y\333\230\341\243\316\036\304\314\024i|\255W\020\243%\n\204\231\b\221;\245\276T\256HY\226\205\001\312XI\f%!\246\301\342"
+	.string	"/Q\302\n\305\325\003\025\241UU\021N\\vh\225\243J\220\251f_JWU\351\243\021\321\fq\020\031\260K\221\340\177\334\023\341k<\262\304\365>\037\371\227\364\350J!\361d\257\2639\355\351\205}h\225c\373Y\337\363!\001\216\212\355\263dw\323\235\354H\024\322\261\235\261'\037 d\214\235\313\330\ftlh>&\273\034T\214c\177\230\177\217/h\263\233\333\304\037\200\302\356\372\315\315\342\326\333.\260m`\273\023\t"
+	.ascii	"2\241g\037\230\302\004;T\241\270&\246\214 K\210\034\356\234\251"
+	.ascii	"\235O"
+	.text
+	.section	.gnu.lto_getAmperage.86.a433deb85508ed19,"e",@progbits
+	.string	"(\265/\375`\004"
+	.string	"%\007"
+	.string	"\002\21625Pm\323\001$\243\232Jis\013\225bvaN(\027\251\246\361\020<k\344\265\371\247O[r\205\202\262g\006I\024\311~{\005\250\225\024\225U\177o\"eJ\001\306X4\261\302\260\013\003\274\242ue\252\013f\032.\016\020\023/h!\260\365PE\210YV\204T\267\227V?\326\212\246\036\333\020\377\310"
+	.string	"v\027\301\367x\027\341c\374Y\263\311o\177\376f\372K\r\350\320rdw\235\324\013\373\322\352\307v:U\n\211^\"\262[1:Y\222\027\222a\233cS\376\306E\034g\n\022\032W\020\322\230"
+	.string	"1\331]X\371\300\364']`\372S\320\263g\346\237\343\013\036\212\221\215\353<)\t\273\353\3348\213[o\333\300\366\201mP\b"
+	.string	"\003\013\275\262\030\005\205"
+	.ascii	"]\303q#\\\026\202\fw\305\324N2"
+	.text
+	.section	.gnu.lto_getAmperageLatest.87.a433deb85508ed19,"e",@progbits
+	.string	"(\265/\375`\005"
+	.string	"-\007"
+	.string	"\022\31625`m\322\001@\203\300!e\200.\320\3254\372jf\375T\262\327\r\003\2324\324{\207\232\354\006\272J\350]B\301I\n\313\334\253r\255`\267\371\215l\"eJ\001\326`8\221\272\256L\003\264bem(\013n\0342\017P\023-\210)p\005AExUU\204\026n/\255\206\254\227LA\266#>\202\001\354n\202/rN\302\027\375\231\323\311k\177~g\372K\r\030e\331\331\334'5\303\276\264\032\262\235N\025\360\020m\257\350v/\272\224=y&\034\266=\266\305\3778\210\307\330\302D\266\031t\214(HPv\027^N0\375I\037\230\376T\343\330\023\363\037r\006\220E\211\266}\236\025\205\335uj\033\306\255\267}`\033\301\366F\b"
+	.string	"\004\013\315\262\030\005\205"
+	.ascii	"]\303{#\\\026\202\fw\305\324N2"
+	.text
+	.section	.gnu.lto_getMAhDrawn.88.a433deb85508ed19,"e",@progbits
+	.string	"(\265/\375`\005"
+	.string	"5\007"
+	.string	"\022\01635@o\323\001\230.\f\\\353a\352d\240\320\302\326\273\207,\277\030?P\372\366\232\375\307\212\\!\332K\232\274,\274\036\025.\r\031\340i\202\005 3h\023)S\n\326`8\261\302\260\214\003\274\242um\252\013n\0362\020P\023/\2101\260\025QE\210YV\204T\267\227VE\326\213\246 \333\022'\311\002vW\301\037y7\341o\374\231\323\311o\177~g\372K\025\020\321rdw\237T\f\373\322\252\310v:u\300\343\204{He\327b\324\262)\017\205\303\266\307\246\374\217\203x\2341Ph\334A\207IE\t\313\356\302\313\013\246?\351\004\323\237f<{f\376C\336"
+	.string	"\n\255l\334\347\t\260\260\273\316\215\273\270\365\266\021l'\330\326\b\b"
+	.string	"\004\013\315\262\030\005\205"
+	.ascii	"]\303{#\\\026\202\fw\305\324N2"
+	.text
+	.section	.gnu.lto_batteryUpdateVoltage.part.0.128.a433deb85508ed19,"e",@progbits
+	.string	"(\265/\375`@\001\335\r"
+	.string	"6\031[D"
+	.string	"\223\232\016\263\231\024\021\365\222\002dw\316\366Xdd\001\262@E\242uS\202\271w+\030C\262\255k\034\031"
+	.string	"\023\211\323(c\"\212\004\220\035\240\005R,M#\033\236H*\252]\0331\242\021m\"wJ\001B"
+	.string	"I"
+	.string	"K"
+	.string	"\321\t\252\307\003'@=N\037@=Z\217_a\273\343`\317\346\361\371\355I.-\244\322\356\312G-q\357\n'\317?\315EF/\030\256#/\036\016\005|\n9\331]W\037\356x\333\013lK\260\377\005\032&\233o\262(m\206Ib\322kBV)0\277\016!8!p\370(\355N\371\350Y}\346\016\375\205\365\246&\305\356Z\367[t>\215\255\231\356s\005:X\021\b\222GCh_\346.\274\317\025\213\354\222\260\271\261;K\036((\324#\265c\324\343\n\365-Al\317gT\250v\227\201\037\3432>\276\211Gg)\360\243G?E\025\240\310\001DF\004s\240\306X\247O\25306\005\r#\364#\002\025\001D\354n\310\301\331\021\361\346\004\214\316*',.\001\246\260E\300>\036\b\034\b\323\264\013\027"
+	.string	"_&!\r\343\270\316\004\271i\331\006\3026\t\362t>\362\3226ib\300\231\005L\223\\\226i\322\372\264\n\343\007?t\210\224\305\252\032c\033\252\355\222\333\350\310ow\033\3704^\343\302\002\037"
+	.string	"\370\024C\2431`W`<\234!f\f0\232V\031]lG\252=\205\261\007\020\005\303\\\341nY\201\177\206\300s\001\004\033\206&\314 \243\326\350(\304\345y\307=\255\024\325N\347\2026]v."
+	.ascii	"\234\274\230wZ\232~B\031\003"
+	.text
+	.section	.gnu.lto_calculateVbatPidCompensation.part.0.143.a433deb85508ed19,"e",@progbits
+	.string	"(\265/\375`\362\002\r\026"
+	.string	"6)\215I\320\360(\035CU\362EY\026\006\357\301h\020\344\020r\362\007\020'\312\201_\026>+\334\374\203\312L\242\260*\255\367\2433\327g\3131(\365\007\377\306\301,\365\320c\364\230\002\316\030~\221/o\243\346:(\022B6\221;\245t"
+	.string	"z"
+	.string	"v"
+	.string	"\367\361X\322Lr+\353.W\363K\217\247\276\t\363\304\227\034\001\034\222NR\2555uj\005\342i\tZ\316\266O\342;5\233\367\225:\273#u\220\001\352\325Z\311S\222\017"
+	.string	"O\277\207\200\247\353\341\265\177;i\315\017U\337\b&\244\031\335\313\277P\025\3649\243\303\360\005\321\335>\222Z\353}>it\2669\005\234\206\252Z\253\305\f7x\333'\266a\366\"\b\323\037\341\264G8-\202\323a8\r\206\323T\234\376\302\351\005\247'\235>H\201\324Q\255\026\236\232\352\rm\021\342=\237\271z+SB\365D\314XSS\266gc\016\017\227\324;UAs\213\312V!\346[\261\324\333\351\325[\231B\361\024.n1P\352\\\b\2338\f)\365j-\311S\227\342C\354\257\006\242\236\017\364 {\364\354?>Pcf\227\377x\244Q4\256\337Cs\325\304\207\361\030\016\036\240\240\200\247\341\336\311\006\017\335]p\217\023a\233O\376\226\356qI\337oE\212d\234\346\356~;pI6\204\273X\211\265\336L|\242\027\261\374\335\251[))\340\351\334"
+	.string	"/\212\226xf\255\365e7\307^\001\277(\020?7n\223\311>\213\017\255\370;Kp\315\317\234\372.\360\364\273@\007\321\322\006\230\37147\307K\277\27286*\234\036\303V)\211\251\310V.\222\345\345r\275X\"V\201\265&\254X'"
+	.ascii	"\314*\231\301Z2\331*\002\031\203\275b,\255\030\311\262\262r\221"
+	.ascii	",X\214,\031\361\213B\013F\312^/\0309\332\236\377\352\342x\356"
+	.ascii	"\270.\0345\363GG-\215m\324\336\347\257\261\2211\003fm\336\177"
+	.ascii	"\337\307\216\013\346\260\361\376\301\346\350\246z\336j\205I\340"
+	.ascii	"\261\037\353\211S\022\027\\\217]!\234Q\270\342\216\b1\270Q\003"
+	.ascii	"\261\326= `\002!ve\033Ac<`E\034\022Ve\354A\273\372-\234\001\263"
+	.ascii	"@\360L\20704v5n]\241-@j\370h gw4v\306\237\361$\354h\236\302\323"
+	.ascii	"\333\364-\221\307#\034\207\355e\304\205X \345\230\232x\025\304"
+	.ascii	"\202\266\326\216\376\2628\022\262\261\266\270\211\374\266@\306"
+	.ascii	"\323\347\222\230k\351\314\276\245\356\362]\r\210l\003\302\027"
+	.ascii	"\006\343\004\202Y\222\201j\317\235\352\375\035\215!]X\277\240"
+	.ascii	"\n\372\274\361h\353\tj\f"
+	.text
+	.section	.gnu.lto_.symbol_nodes.a433deb85508ed19,"e",@progbits
+	.string	"(\265/\375`D\006\365\025"
+	.string	"\366\"\202I\240VN:\300W\274Z(\352\230z\365\030+\310\030\017\210\361\314\2059\217\004\237\204\275\264 .}\002\211\206v\035<\261\214\037\256\266u\026\306\030c\214o\016\305\362F}\324u\275\001WF\022\3003\327\235,\267M\232\3342\005k"
+	.string	"o"
+	.string	"p"
+	.string	"D\302\242~\021\242\376\220\241\276\020_\337\244B\375\254\240S\t\201z?}\344s0\n\254?z=D{nx\2751(\317\247\350*\020H\356\364V\312U\207\307\301`\020LN\023Q\234\234\233\207\205\237\262\301\t\271\316\360(h$\232@'\344\212\240g\311\251\003>\341\377Z\005\002\253\217\277\177-\031K\253\265V\003}+\372\337\226\024Q>\364\245x\350\237m\255\365\247\351\320\027[\016?\341\337\002J*j\305\323\206\240\360g\222bj\222r\212r\202Zzb\241\363%]h\360\205\031\372_\030\372O.\364\275,\364\273*\364\235P\3507\231\320g\"\241\317\025\241\277\005\241\277\204>\350k9\350+i\320\307\242\f\372WJ\375$\013\372H\222^\026D\352\037\241\003v\216\372F\214\036f@x"
+	.ascii	"\005`\033\026.\307{.\345\372\"v\243\227\343-}r:^P\205\375\344"
+	.ascii	"x\315%w\253\272\252\274zbX<\t\220\373.1\034[x4\236)\327\206\n"
+	.ascii	"l\006\217\3068[\271\267\242\261\212>\026\247\276YS?K\212\276"
+	.ascii	"\226_\177\013S\237\013\212~\227\245\276\227\023\3751\023}+%\372"
+	.ascii	"'\211\376\225\021}2\021\375*!\372P@\364\003\377\355\346\bs\266"
+	.ascii	"\025S\303\277\357XI\267\343\232\245\321v\274c4:\376-\005P\200"
+	.ascii	"s\245od\231\263hd\031\323hd\\y4\362\355D\032\371F\356\356k\007"
+	.ascii	"\215[\215l3\257F\266\221X#\327\316=\031\214\263\036\317\032\271"
+	.ascii	"\311\206od\334\031$2\256\024\022\371V\372D\266\231\373\262\255"
+	.ascii	" 5\206D\256\231D\"\327\312\236\310\002\314\275\005c\250A\b\205"
+	.ascii	"\2419J\n\n\nbi\f\360\002!\242Q\007\021\240\020\247\b!BD\204\""
+	.ascii	" ,\230\007\240\n\030\031\033h\237\035\033\206Y\374o\231\3404"
+	.ascii	"\376\2447\336\337\037\"\t\316\232\241\344#\035\367\261\315\312"
+	.ascii	"$_Aa}\367\351S\024\023\236\373\306?\303\177\343\237\341\277\346"
+	.ascii	"\327+N\032\331T:\020\227}g:\220\243/U\207@^&N\006\351\340\375"
+	.ascii	"(\205b \224\217\024\024\200\333\232e\224bYL\353\326\250\366\371"
+	.ascii	"\254\231\242\325$\306\374\232\nl\373\242\337P\263\343o%\323\304"
+	.ascii	"\b\240\326D`{Y0\205\335\302n\210w\323v\313\340\264\350\272\346"
+	.ascii	"u\252"
+	.text
+	.section	.gnu.lto_.refs.a433deb85508ed19,"e",@progbits
+	.string	"(\265/\375`V\001}\013"
+	.string	"V\034H/@i\224t\033\3603\f\3030\f\3030\f\303\354\252\350\005\030Th\241\003\177\350,xa\2335\202\377\320\217\f;bM\033\"\204\354\266\267L\0015"
+	.string	"9"
+	.string	";"
+	.string	"\251_\256[\320?\\o\350W\322O\372\022\365\221\374G\352\216\353\214\376\223^\365\021\372&\277w\2630\004\373\003\373\203\357\340+\260+\354\t{\342\343}\373\316\037\203\016\353\031\032_Y=\322\207\254\276\320w\260\336\270\276\362S?\2530\371y\272\223\257\030\237\362\316<"
+	.string	"h\225\217\375\256\0278>\275y\302]gE\237H]\342zF=&\037\"7\203\365\204\276\"\017\251\336\240\216\327oU\262\370\002\034\271\313\206\364\321\353\024\317\321\217"
+	.string	"\001\365\037\254\276\003\326op}A_A\177\"_\"?\203\035\203=B\365\004\375\013\352\226~G\\\346z\030\204h\373\202\240\226\033\327\017\347p\300@C\201\022\350\311\351\311\276\271\031\360\005\353\017\353\016\353\271*iI\277\221\217\332"
+	.string	"$\240S\332\335\332\ri\374\323\356D\351\r\345\261\335D\261B\013\036"
+	.ascii	" $\025 i\005\251\352\342\026*5\201'\016\006NR\355\004\227\260"
+	.ascii	"\224k>5\274\206=\320j;ty\021K\233\254\342\022ka\016\233z3\227"
+	.ascii	"\r[\301\266\004\256\025\377g\230\232\340\206\017\035FpI\267p"
+	.ascii	"D\254\004)\024\0304"
+	.text
+	.section	.gnu.lto_.decls.a433deb85508ed19,"e",@progbits
+	.string	"(\265/\375`I>\255\374"
+	.ascii	"\232u\325RU \fQ9\351\354\r\212/?\202W\317Y\330u?|\265l\264Lv"
+	.ascii	"\347\2577+\034\212\315\260\224O\220n,t\261\355\232\344[PN\316"
+	.ascii	"\310j\235\216\023\273r\273\310\213\032\331<?+\201\364\033\346"
+	.ascii	"b\253\204\372\276\234s\313W\314\313"
+	.string	"\242y\242\254\322od\023\271SP\004,\005b\005\307TP7O&H\023\2556\031\375\244B\241\234-\033\367\323\035\3041;c#\\\322\345\326\341\2509;\371\300|\270\334\272\253\267\303\001h}Q\237,\327/K\334\334\255K\237q\353\013(S\324\210\333\323\024A,A\3014\266\234\356\311\300\022,\363\211\336\265\253\327<q\206%z\007o\225\213\005G\351\231\243Z?,AA'O\356\032N\232\363\325\230\267#NX\202\202Q\244\004\200\020K\260\314\356\356\346e\020F\003\300<,AA$Ib(\201{f(\031-\030>\277\203\367\357\326\341,\237\231y\342\n\226 \230v\321/Zy\305\3340\315\324\313+x\013;\367R'uS+5\214K\3301\356\230\013\275\2037\360\327\313\375r\374\314Y)\347\374\r\376\2336\344\256\341(ur\322\036\024X\316\317_\264\f6\270\203\027\312]\373\220\224\363\225\225"
+	.string	"\270\306`\311\t\346\374\274`\347\202\013l\252\316\352\272\360\340v\336\rC\013R\275\365i\222\365\351\331\372Tk}\332\264\276\t\265\334-7z6\256\274U\3212w\373\356\023`\216\261\306\357\264\365Z\271|\027z\251\334\275\343\"\316\254\226\363\363&]\326h\001\216g\230sy\206o\257\025w\325ZA?\255$\362\372\342]\275\337\274\333\202\215\322\315\3039/\357\035"
+	.string	"\316\275\003P\351\276\226\320!~\277X\177\377V\016.\335\372\313\266\276\355n\030^&\227\356BC\334&\277rw\311\325\3453?\333K\214\033\264\361\257\220\3657\3040-,\274!\206\277]\253\316\3350\354\270+\265^\317\004\353\371\216\326G7\260\352\b\336\r\303\243X\357\363\022\271P\020W\355\031l\360TY$\243\345\374\314\271\031c6\206\260\361\025\260R\260\314\033<\303\372\013bx\013/\210\341{\255\340f\030\006\271h R&'gn\313\371y!\347Y\343i\253\361\237w\303p\275\031\206b\276:4W:3\307\365_\025rZ\377\225"
+	.string	"\034\326E2e\2007\032m6\177\032\305\366\244\326T\304\305s\370\247\312+d\375S\022\234!\335\b4\216\377\212\035"
+	.string	"\177Z\204\221n\360\240\251\246\376\333\324\374{\205\215\2777P\343\207F\007\376W\2405\360\267\n/\361\247\035x_o \305\341>\177\232\201\377r\365\f\023\023\370\357\216\277\243\376f\376\375\364\267\323\337M\1773\375\355\342o\345\337\371\177\315\237\256\310z\200\023\305\325\361\2372\240\325?M@\bz\3549\177*\002\251\037=\202\017\347\360\247E\034H\350'\032Zt\n!\032\205\013\340\357+\377\355\260\241\2214-\202\276\340\350\251\215\216\327\202\243\223\020\242\213\376\016\301\021\360\247\005\370{\247\330D\377\2659\341\177\223zh\251"
+	.string	"W\213\376-"
+	.ascii	"\241\277-h6\t\364\337\365;\377\017\360\377\303-\370S\365\277"
+	.ascii	"\340\177\361\177\207\377\303\374'\374\257\314\177\357\377/\377"
+	.ascii	"\307\374/\374\257\372\337\365\277\351\177g\376\017\376\227\346"
+	.ascii	"\277\230\377\356\375\317\362\237\357\035\376\324\355o\231\277"
+	.ascii	"k\376\246\371{"
+	.string	"\375\033\377=\374{\346\357\033.\177\247\177w\023\377\353\374\030\304\337&\374\355\201\2779\3607\t\177[\340\357\020\376N\361\367\211\277;\370\233\203\277M\374\335\3637\006\177\213\370;\304\337\006\370\273\202\277=\374\275\341o\235\277\247\374w\356\277r\377\205\373/\222\377\276\375\267\355\277l\377U\373o\221\377>\377+\344\277g\377-\373\357\330\177\305\376\013\343\277a\377\375\372\257\327\177\273\376\233\343\277Y\377u\376\367\352\277U\377\245\361_\251\377F\375\027\352\277\313\377>\3757\306\177\227\376\253\364\337\023\374\267\004\377%\301\177[\374\367\204\377\266\377\025\301\177\217\376{\374\257\361\277\036\374\227\204\377\n\375\227\375o\320\1771\370\357\210\377\002\375o\362\337\013\374\307\373/\213\377\232\360_\020\374\327\003\377\345\300\1775\360_\f\374w\204\377V\340\277\027\376;\201\377+\376\313\200\377\236\370o\002\376K\342\277=\377\r\361\337\003\374\027"
+	.string	"\377\245\340\277\036\376\213\363\337\233\377\326\374G\373?\364\337\356?\001\n\013\013\013\177\232\350_c\365\363\254\020\\i\027\006\346\004b`E3\363\206\210.\224a\007\226\356\260\361\353\241\227\367l2%I\233\332\332Js`\310\331\310\221.\233-\2479e\016\262\224\316I\211`\343\333$eeQ\r\307\274\320\225\3719\235\351\225\212\2343\226'\260\"O\246\274\362\254\254\322+\f\331\2313\230\314[\f\246\250\230\032\227\271\253\216\2223G\330B\r\\j#\265\221Vu\301"
+	.string	"\013\354\006\017\276\263\212bV\225Ry(\273\222S\252t\252F\252\351l\210\224g\216\021\275/T\215\233M\303\206K\035\326\213 4h4)\317\274\344x\031\263\362j\374\032(\251T*\216f\314\032\025\325\200k\336\311\323\273\271\302S\232\342\203\202\272k\267H\206\242y\021\345D\004\026\343W\245\013o\205\246Owm'+\271X\020\006F"
+	.ascii	"\261\031\313$Li\f\246\024\306\001\232\232R\030*@t\211\246Xeb"
+	.ascii	"\2044Na\300\3154\275\230\215O\003\266\236\306i)]j\037]$\317\240"
+	.ascii	"y\241\364\301D0\347\246\210\233\260\263\265\244,\2532MR\246J"
+	.ascii	"\303\234\357\323\t\305L\225\322e\272\354,\2532\347\035\271&\317"
+	.ascii	"\fS\031\0133u\353g\202\024\026\202\315\364\020#\246\3569C\203"
+	.ascii	"\2200N\306E\022\302\2601\202\201\r\246\247\340\334\226\2273J"
+	.ascii	"\020:\373\326\257L\274@\333\313\255\343\311K%O\330\323\211\b"
+	.ascii	"\325\213k\254FZ\227.\rX\002L\364\201o@U\212X\217\267-+\253\336"
+	.ascii	"\0332gd\354\311\210f&3\n\355hGQ\221\2273N\374x>E|\265\261\345"
+	.ascii	"\027\332[:\357F\345\274\234*A\026m\212\300\211\321\206\266.\327"
+	.ascii	"7__y\367A\273\257\263\334fVr\331\200Fn2y\376\306\362\316\362"
+	.ascii	"-6\371\003\016\032]\024L\343\007\366\214\3773?t<\004\271\254"
+	.ascii	"\177\377\303\274d\346\234g\250\317\314L\262\271\352\275<\377"
+	.ascii	"\315M/\001rj\314Y9\306\t\270\376\200[VU\220\177\275\234\225\262"
+	.ascii	"\224\016\310\212R\312\262\301\244\226\225\225J=\224\027\2309"
+	.ascii	"K\311\244\226\363\205\254\244\244\374\300\231/0\251\345\250\354"
+	.ascii	"BJ\324\315\317,eVr\346\013Y)/+`R\312\212bR[F]`R\313\212\312j"
+	.ascii	"YY'+-\231MJ\231y!\253eq\311j\316(\035&5g\024\223Z\026\326\335"
+	.ascii	"\3014\346/J\214S\013\314%\302\244\224e<\335X2u\364\230\236\316"
+	.ascii	"\314\227\363m[\312L\002\344|\303\311\344[\332\270qIz2\222\220"
+	.ascii	",\235\367\231s\366\360\224\244\345\314JzLb\316\234\305\222\210"
+	.ascii	"\362S\t\345S/w]=\345\326\215\354\264\2243\005O9+o\326\3139+s"
+	.ascii	"\3162\314\033\317\234\251t\230\300\236\236rn\356<\345\033J\271"
+	.ascii	"\245\234\273\255/.\212IM\313\351#\307\246\006\226_<\225\027,"
+	.ascii	"\363e1W5%\221\354\324e\005\213\222\372k\374\304\031\216\255\360"
+	.ascii	"B\256\361J\026\306E\330\370\371Fu\307"
+	.string	"\325\370n\246J\027\2536)\230&\214G\226\232\331S\353\325\330-\021+\344\2616^j\007\207\003\216\352\356\251\241I&\243\361e\242\240\374B\033J\323\355\350\344\254\325\004\223Q\252k'~I\230\214q\251kBGs\244\356\331\326\230\311\316\nF\325\304\222\022w\241\035\327KR\246\274\314:\361\203\351\245)\230\231L\021r;!"
+	.string	"\303\003\n\310\372\341\216V\3226b\2600\243\361\207Uk\022$m3O=&T\343k\260\246\004mHCqfr\316r\002\326m\255\326P\231\256\250\337\240`\316\371\255\335\372\310\205v[\263\275\215\\%\370*\352\243i\3056\352\226\365*\225\365j\223\265\237M\344BO\327E\272\352\224]J\326\024dN7\274\272\226vE\bZ\0210)+4~\243\375}\326A\232\314\306\231\263\222\n\330\364$\330\270yn\206\341\245\342\3636\303[^\240X(k\262\313\007fuG6\026D\005\035+<\321f\344\b\201\320h\334?Z\354\r\244Y\310\r\244\2043\347e\003\311\t\223\3632\347\336\001\334;"
+	.string	"|\246\345\343m\210\257>\303\256\0260\037'4\233i\215\337>\272\307u\346\0168RkeT\215\333\253W\270P\017\375u\377v$E5\276Z\266\232 \347\353ax\013\013\257\207aw\371\274yd\0302\233\317\234\023^[g\215\323\233a\307=\220\311a\351\340j-*pt_\366\256\362\300\234w`KZ\253\261d\216\304e\265\216\336\352\034\027\332Z\215\243\243h\265\325\315\033~1\373"
+	.ascii	"g\352\246\376\264h\360\325\030\3531\341z\034]\217\247\254\307"
+	.ascii	"s7B\254JsG\320\032\363\334\200\251\222T\326\270\247l\204p\221"
+	.ascii	"m\275\233]\243m\\hO5\215\266\273\327S\315\354\031)\021\346j\004"
+	.ascii	"\212\245\201\n7/}\202\311\260iY\371\364TK]\355\\p\301\005C\036"
+	.ascii	"k[\204+>~\256\307e\353\361\027OG\315(=\263\232\315\262\206\222"
+	.ascii	"(\215\217\267\326ZR!*\224\037\360\201\261`,\251\220\231\314$"
+	.ascii	"\321B\034\207\253><E\303F\206\245\355JGY\223\250]\201\301\227"
+	.ascii	"*Y\301N\033+`\006\211T\351%\353\334\326\225B*8\007\016\r$U\\"
+	.ascii	"S\032\020\273M\355\320\302{\235\227\004\3725CJ:%\035ls\321\327"
+	.ascii	"\030\017\017\353\r\202\245?\276\3005\311;\326\273o\271\271\002"
+	.string	"\207\027wwxlg\b\230\337`N\036\024\214f\227&M0\224\035\247\362\217\307n\271\345n\246\t\236S\027\024\374\244\n\fI\220\306\330\211M\241\225\275!k\270n\303\227\234\034f\242!,\253/n\310\240\024!x\356\230I\340\232^\032^\202\007\025f\260\020\016.\205\361AH\021+MA\033(\266\256\274\271\265\343#k8\311\r\274\317\334t*\377\f\200\005e\257\206`f\272\3013\244\003\353\016\311q\222\273a\341Z\\\026\034\020%fo\215\261\333\361\233\025*vE\252Vl\344\270\255J\n\213X\r\266\177\306f\307\035\336_\343k`\256\327\320\224\226\206\241z~\203eP\236\244\256\0249\206^\306\023*\2711&\322\320uI\037Y\217\306\370\211\303\356\374\2664\306Cn\336\252&\365\245\006\375?3\274\"\206\343\305\02644<\326\200\250\337\340\215\216$V\352\232\234\235\301\245[N\222@I++["
+	.string	"\263\017\260l\215f+X<\302\302\360\230\237\221Be\r \307cME\217J \026\323z&\351a1\374\303\207\025)A\230\314\024\006\216\321\261\320lO\204`Ii\372\360\001\006loG\032S\343gP\372\372j\300\006\304\371\r\226eQ\016a\313\322\325\205\2756X2\026\227\342\250\273\001\203\307\261\227\032d\311\323\306]\323\362\222\005\216\005.\256\006\204\0026L\343\212\202Ue=\013\347\270:\317\244=;\260\024\310T\013/\266\216s\254<\366\244\344h\214\265\372\311u2d\007\022\f/\252\252\260S\001q}\200e5^1\222\260\216\2357oZ\306\002\361\325a\204\311m]Y\275]E\355\311e,\306$\013\t\276\3218\206n]\b\333\002m\330\300S;f\313\036\203M\325\005\217G7\217\247h\306,q9\322p$\372\274z4Y?\003\317\3004\206nK//<\230kPH\037\246\201U"
+	.ascii	"3\345\024\203\245\202r\030a\302\302\372\013^\353\217\231\230"
+	.ascii	"\331y*\260\304efS\204\314\224\226\273\025\232U\236\372U\3012"
+	.ascii	"|\222\362\322\214\004Y\364F\020\013\220hc\374$\263\264R\345I"
+	.ascii	"\343_\210\261\376\242E\323\277,]\260D\277\244`\306\362\242\200"
+	.ascii	")\027\264\276\350RJ\210\223\256^S'+)\021\214.\301K\251\027>&"
+	.ascii	"\354\204c\340&\354\002\277\3000.\024/\245\203\337\301Ki\340\225"
+	.ascii	"\034\300 Fl\350\340\350\265|HbR\221\266e\211\225.\024'}\307'"
+	.ascii	")\r\203\225W\257\371\3143j\222\374q\341y\270\340\346o\n_\325"
+	.ascii	"\020\377X\2113\222'W\227\306i\241L\323\206\235\013,b.4\035\263"
+	.ascii	"\006\226\311\021\276\246\216\207\026\337z\035)\353u\350\326T"
+	.ascii	"p\245\022\265\302\203[\257sd\275\216\332z\235!\353u\310\326\353"
+	.ascii	"\260\360\227rQ\203\002\210\307\345\256\365^\013NI=\3264K\272"
+	.ascii	"%\347,N\307\021-\025\340\221w\2441\306\322v>\300\236\372p\370"
+	.ascii	"z\270\021i\374\364\212z\244\020p\252q\312\267.\3518C\320X)\301"
+	.ascii	"\252j\374\224\357O\233\\$#(\024\363\245q\033\361yj\245\006\257"
+	.ascii	"ItH\023\335\323\275\224.\235\242\242\231g\2340\253\241\372b\262"
+	.ascii	"\324\370\271\323w\201fV\032\247yi\224T\312?33\347\264w\243\361"
+	.ascii	"u\224\353S=\232\035R\276\2004\356\264\205\247x\377\214\f\032"
+	.ascii	"S\311-\314\372\324.\275\373gR1wsM\200\353S('\300\202\303\254"
+	.ascii	"q\372d]\312\241\022b\246\257"
+	.string	"\210\226\364\311\237:\271o\r\304\204v\252j\3725\306\271\031\206i\023\237\247u\355\243\315\316\256\361M\216\221\271\271#`iS\226\271(A\344\344R\2704\260.&o[\272\224(I\341\316\242\352\223\314\316\b\\C\207.\322v\230Y!A\222\n\t\034\322\210\363\322\024\2341#\223Jj\374\034\246\267\267\3649s\"\f\013l\250\205-\351\314\257\255-}\362\205MEg\376~|\031\262\204\215-\025kg\316y)\2470%\314)\2726\261A%H\232\232Z\341P\214\312\311\225\216\"E\322\247\337 \025*|z\215\217#c\310\220\364\211!g68-Q\021e]\350\236u4^D\226p\204Y\321\320R!*\362\0061\271u4\211\252!\344\346\205\375\320r\212\262\236\2355 a\366\322,\2431\303\241\302`\222\264,-c\200\033\226\350\n\264\302\275\306\2771K\307\322\261\r\246n\252\322\037\351\217Tl\306"
+	.string	"_\262\227\246\340\314\nUdY\354\256\325\\\211*\023\362e}\332\343\246`i\2174\254\247\254J\346z\344\353H\324\246\312z\233\271\365\267\247\f\277\276:\313\232o\035\230\227fY\340S\024\234\231\227W\0032\340H\217h\216ri\031\327\3706_\353\257\331M\271.4\rB47\307\"\0219Sl\221z\216FEEF@\031hpT\004\244\262F\026\304vENK\364\240\204dQ\207\203\021\262\005b\177Z\235$R\207\023\215x@2\002,\022\251%\262B=-\321P\321(\304\032\333\326\bIDB\313B"
+	.ascii	"\311\246P,\3229\321\210\244\321H"
+	.string	"\004\"j\211E=\311\266\310\242\007\3518\204A\nH\307\242\021\203\022&~Lp\220B\017\033\204d\004:\026{\220I\244\236\036\024\214\220D\255\321QF\210\310\032q\253\n\265\307\"\3228\244"
+	.string	"\002\035.\244\370"
+	.ascii	"E\006#\021\251E\026K\350\320\003\200\"#$\b\254"
+	.string	"\261(d\204\024!\250(\002\020\b\242$\213\024\342\020DdGH\361\001\212\f\027N4\242\307\250\330ax\242\021=I${B\021\031DA\373\223\f!Y4\032\213E\303\026GF)0\264G=CG\031\200\216H \264l\262\346(\324j\362\307\246\3759\016\035\251\307\241\243\224\250\035:\262\306!;\202b\022'\223,2(\210(\323\342\310\b\b#\333\243\3647-\220m\2628\304\216\360\023\304\036\207\212F\242L\020\233D\302@lR\346\304\226\030\324\376\f\035\215\300\3719*bIh\331$;\302\320\021\210\020.\264\354P\r\212dQ\303\020q\305\t(>d\350\320\002\2108\304v\270\020\304\"\221\222E\n\222EH\242\021E\022D\221X\304\216\240CbD\020\013T<\001\311\256h\223D\f)\332\3421\0025\311\fC\307\"\262]\261\301\203\226\035\312\241@\313\016e8\321\b\240\237#\022\262\007HH"
+	.string	"\311!\242\021\204\241c\261\bI\254\321a\201D\230\371\220<\262GEF)\202\212\"\264D\026%\260-\321\210\004d$\002\025\340D#z\202\214E$\026\036\206\220X\260A*\211\021-\222x4\002"
+	.ascii	"6\036 \355p\310\3403\"\031\002;t$\022\265I\242q\303\206\022<"
+	.ascii	"\024\255\320\220\242\004\n\260-1\350\b\003:\007*\"\331#;\264"
+	.ascii	"\276\204\t\fLp\220\202\3149\350\200D\007$\206\347\240\003\037"
+	.ascii	"\237\016L\370\2547\341\223\266?-\261]\201\323\332\260?)>@\261"
+	.ascii	"\242}k\303\376\260AF! \331#\226eas\242\0218k\233d[\"\005\330"
+	.ascii	"!\"\222=*\"\342\264?\031hpD\201\210\374\200\bE\321\212$\022\001"
+	.ascii	"a\231\023\215H\376\340\004\345\b\035\221h\202\214E\020\206\210"
+	.ascii	"\311\032\235\344\217\220\220Q\213\224\242\004\024\214\214\030"
+	.ascii	"\202"
+	.string	"X#\013\342\221\2259\242i\177\222\030`\213\212\355\312\026\025Ih\221\30469s\"\0207:b\221=\255\221\021\262\247&\3713T\024:\032\245@<\026\2130\240\320\036\331$\213<j\215\216\036\200N0\336\260?\030\330\037\r,\020\022\311h\005\222m\331\020\332#\213D\"\001ah\321\026\201\210G\304\0249-\321\203\022\330$\322\215\321\310\310\203\0375\331\"Y#\212\024l\022I\303\221\005B\262\"\034\025!%\217F@\037\222\305$\213d\333d\013\"\234\366\307\204\317\312\016\021[\243\321\tF#\013d4\"\teh\217HF)\214F6\205\007,\020\322HhC\013\242\361(Y\324\320\022Y\024o\206\216\305#\222\230\001\016F\"P\261-\"S \215@8\032\025[\"\022\351\203\016\355\017\007\355\261\210$s\037\237\024\025`\240\002\020X\201F\264@\262mKd\321\223D\032%\217l\262\347X$\026\365"
+	.ascii	"!\223=#>\004\031\025\221\254\bBG\024\030\"\256h"
+	.string	"\211,N\320yW\227\372U\342\311\337\nW\277\340\306\240Z\344\032\253^\207;\221\034r<\016w%D\370\274\244\264\264T..\r\200Ra\t\252\\\252\016\233\234\261\020%T\251C\315\221\325e\nK\343=s\302\024Q\243\242n\335\300\373DI\334Z\343wp\261\252V\252\225\212\003\001uK\276\210\251\316\2538\350\324\245,\200R\032\253X\247#t\0332\245\261zu:\031;<-\254\323a\032rAZ\320[\177\365\006\206R\311}q{\212\031)\253B\225D\206MP\311\fu*\205q\223\326\326\274S\233\230I\016\2373\207\223j\003J\366K\233QC\357K\335\222\245\3066}oy\201\252\nc\251\022\t\224\235*\225v\3258\225\335\351\2513\324(2\"[j\227\312\3049\256\372\260\032\357\334\r\303+\347s\025*\215k\262\024F\306\323OT\030\225\306W\237\200\230 \346+F^c5\206\317U\247"
+	.ascii	"$\241\223k,\003Cm\"\302\344Em\372U\246\353\204\007\r\251\274"
+	.ascii	"\3063A|\256\276\310\331\203\013\354\241.\251.j\270 \242\272\370"
+	.ascii	"\315\r\026\266r4V\223|\256*\251Sv8\274\032\327\250KUYc\205\355"
+	.ascii	"\316MU\376\270P\315\r\304\004%-\254\351h\314s7\f\325\3431b\252"
+	.ascii	"\210\214\321{\266\335(\231B\344-L\226\341\230\27759\302T\254"
+	.ascii	"\246\307s\211\213A\032\251\035\034\02020S\334\266\350\305h\f"
+	.ascii	"\b\210\277\\\346\337\t\263%^\250\004sS\005\236\037{9\376\242"
+	.ascii	"\344\326tk\214\367\250\372\254\364\224!]z/G\306V\f\257\277[7"
+	.ascii	"\264\341\202\360\b\027/A(T\232\032CAy9\033?\2375qWn*4\306Zp\205"
+	.ascii	"\223\250\243S\324i$-\0352\016\315\214\220&I\322\030\023\025@"
+	.ascii	" `L&\234\315\2075\037\023\300\322\0074\252\026\205)QlFD$)H*\245"
+	.ascii	"i\f6\022\340\001\264\234\333U\224\234\242\320"
+	.string	"\260$\213\274.\021\026\235|\206Mc\324\017\240\345\341\270!9v\217ns\332}z\276\344&\262\234\367k\364\306#\007D\346{h\233\001e\224\246\240y\317\310\340\234\037V\252\253\304\247\226\202\331\215\325R[\371\352F\373)\357w\323\367T\232L\376\356xx_\372\234v\273\336z\264\343['\300\326\246\002` k\370a\2752/\250\313L\017\347\304\321\217\202\221o\030.\271L\307a\031\351\246I\022\237_O\273r\276\2754\261\347;\332\352\233\210\037\340\037=\274\032\ns\f\024\217\257v\332\302\2337\002zb\t\374<\005W\200\361\372\211\235\367\222\244\277\305\320sY\301\335n\367<JDbv \337\223y\343p\021\200\033B\270\032+\352\037A|\236C,X\362\031\363\232\337\013S\227\212r\364\0139\207\227\215\275#\034C\214c\234\270\261\240\330\320\314\303Y\214N0\264\347\271\260$\306\355@o\326\335\246"
+	.ascii	"\351"
+	.string	"nj\264\214\006!'\2344\004?5\367\273\330\376\303z\335\355?\254\240F\277\237\322\325\302/\362\326\303\024\027\203~5\304\243\220\353\013\354\215ji\310/\326\201&\221^&,N\324<\357\340\3732\216\2422\003F\002e\303'8`\375m\376\317\2470h\347\353hi\3034l\263J\300=\271iRI\327:`\201R0\322\354\244\001\315\no/\365\370tmD,\204]\031\204 \227\333R\232\244<\216\326\345\026d\242\314T\346\005\2638#\244(J\004\375\344K\276-4\036\205\317\374(\277U\352-@\361\224b\3250r\254b\031\201\320\330\351\"\031b\360\266\336\322\n'\304\335D\311\244\237\214\246G\263*\233\330\313\305\220\001\217\305l\361\242\036w\356\020<\236\275\237_\026\377A\017\034|\356j\265\376%\"\016\322\036u[\"Z\263(\020\304b\031\016\260\021\246z\271\373\006\026\311g\002~H\001_\026G"
+	.string	"RL(\333G\025\030\002\320\320\316\377c\302\017\001\232\266\211\304>\034\232"
+	.string	"S\343\002\001\200\337\037\372}\020\222e\231\352G\265\200\302fC|\r^\311=H\021j\310\213\250\350\271\202>\216\367\t\353;\025"
+	.ascii	"aK\332\316\323\271>\232\334\nv)6\022T+\204\376X\327s\3549+\216"
+	.ascii	"\253\216s\227dn\037\277@\177\362 \216\177U\234"
+	.string	"\252\243\234Nd\314\354\341\332\377\336\314[.\355;}}\317\274w\016\200\271\326I\245\360|\303D\036\214\264\317\367\304\001N\354\271\237<\031\366.\356\247/L\031'\033t\247\373\273\347\377\2335nD7\027\220\3314\004_1\2141\276y\250<\2554\330+oW@"
+	.ascii	"\276W\002\f\027')\020\303e\262A[<\314f\003\013+\266LT\247b\350"
+	.ascii	"\001\027\345\023]\310\330\302\374\335E\360\374\320"
+	.string	"\315M\267\314\324\267?\206\\\354\212j\266d\023B\037\362\355M\027C\226\210\"y\215h\362~\304-\177\032ct=\366\360;\006#p%\226\300\347\2137\t\025\373\020\311\373l\204\332&ml\323\370\021\200\237\207\321\225\376\262\234`\242\331\\\0262\253\227\032\fO\022\366\341\026\223\001\\\016Q\267P6\037%l;\270\346\361<\375\242\321\\?\341Crd\013Qa\026\267x\237k\345\371\030V\262\273\353\230Y\210Su\255\304\013V\013\371o\206X\216*\200\"D\\\266\267\007|&\356E\375\013}\214O\245\007\334\305\bF\365\250\317\365\221\021t\030\264/\365\200\350\3127\310\321I\231\327M\253J\270\245b\302Y\251\236\344%\355\350\026\260\347%k\330\324\366ic!$=\033\327\373\247\254\004S\b\260\211\312m\273Q\"u\341\312#\220\2211\3740\025-,\307W\3010\rI\311!Q\346 \314z-V\346\022"
+	.string	".\327\230]\213Dk]\210\245\371A\356f`\035\031\272"
+	.string	"u\005f\314\204\255\340\301\361:\217\026\2327\352_\204{\265\304\034D:t\216;\302D\203\312\205\350\237\350\255O\234\352\364j\330>\311\320\254\001\013\324\235\265;\213>\372:\2563d\372s\013^\251P\237\t\255\252\274}\276\215\235:\032\363\306\343.\230\344\326\027m8\032e\363xM{Pe\326@\221\240\345a\357Ne\177\372\356\360\257\215qw\324^\002'z\002\253\253m\367\241\027\205\023W\230\240\205t\204\354\306\221o\211Y^\203%\313\251L\334\346\321I\212*m\314\366n\007\305\271X\356\371R\321\022%\"\t\347j\263}\037\335Y\245\236\253g\n\263\0038\373\205\1775\362$Z\b1?)\016A\264D\324)\234\234\357\210\026\021\332\013b\311\221K(=\026\024\273\032\363\240U\200\225\352-g4\344\275\275,]~\337\356|8\267:\3363\036\226\3426\007|\232\270"
+	.string	"\020\317\032\264\372\271\305V\236\302\215\f\235\214S'\272G\303f8\200\273\217\n:\345E\024}\233X\2061%\341N&\373}M\230&s\3415\220\r\344\370i\325\244\366_\263\267{\207\207\221\227\232\224\256\217NY\267;\3467v\021q"
+	.string	"\323\313Tw\3670\220\203\241lX\344\227/\267\373k4UH\236\354\177Q\236\002\3112\254fj)$XQ\266\224\227\314\310\342\316\252\205ekq\312\260\300\003>}\303\331\251\203\221\2678\3214Y\226\212\334\360\b\324\030*\326p`\352n\351\f\301\206zt\216\313(\263\260\017\242\031\177\370\3655\372o"
+	.ascii	"\250\f5nI\333\020\016\036\252\007 \203j\325\314\363\007\f[\""
+	.ascii	"\n\205a\311\361\204{d\001\r%Zs9pq\004]\270\362\344=\377\354d"
+	.ascii	"\016\f[K\227\302Q\232>\346\201n\032(\024\373\r\244\360\031\342"
+	.ascii	"i33\030zw6\354qM2\372\237\327\243\344\213\326\232[\331\371\351"
+	.ascii	"w\1770\211\223\266\330\002\307G\006=\030\001\315\363{\262c\200"
+	.ascii	"Fh\335\324\342\333\033\372\2169\205\262\344\374\356\375]\213"
+	.ascii	"\251$]\006G]26\313\277\242\214\0042\256k\325\251\321\"%\357\314"
+	.ascii	"\333\367\r\020X\311\032d@4\3644+\004\364\245\230<\311O\221n\207"
+	.ascii	"\351\264\017\300\343\370\370\247\342\221\265\032\027&\232\324"
+	.ascii	"\247J\b\250\277\276\337,\310\t\030\225\254\020\033\234\002\332"
+	.ascii	"\240\b\371N\325W\356\022F%\372\200S\233\344\232%n\004\213\317"
+	.ascii	"9\272K\222k!\2215\264H\221.W\367\n\3074^xQ\326t\211\364;\036"
+	.ascii	"#\324\035<\301~\017|\214\235;\367\034\352F\302\233s\t\270\306"
+	.ascii	"\3762t\264\240:\241\314fu\371B\202\t\005\367[\275\001\271\317"
+	.ascii	"\275\226\261\031\215\"\004"
+	.string	".\007\225\365\210x\204yb\304\205`\333I\320\320\326\363\375\n\253'_\022\007\023\356x\316\337\224+1\330\030\217\274\271g\216:\013\212\t:\365 W4S\023\365\273M\273\277\233\356+\266@\315\204\001:\034\363\261_\252\356\007\017\017V\372\245P\2640;\320\036\005\300#\315!\3538E)\356!\013\307;\f\230\315\354-\275Br!\351\026fu\305s\215{B\341{5\276Mt\340ZHK+A\230\342\331\3423z\252z\275\375\263\213z@\271W\227\030\03068\203\n\206~_\013\251\354q\217\276\025(}\265\334\313\254\336\256iZz4\003\367\001\362\350\373\252\353q\3000rl\313\341`\3570\365\317\302\003\360\343>\343y?\203\273\333Pg\376\275\007\321e\021V\216\002\252Y\333k<\370\250/\365\335\003l,\036\377\032l\275!\255\220)x\306\211\232!\273\231p>\314\025/\304\0270\bx\211\355\""
+	.ascii	"t\362\004\313\377~\002\032=f\352x^\367k\207\211\003L\200d\242"
+	.ascii	"\277X\024\265G\364\342\004\267\034Q\230\033\226\305\344\222\316"
+	.ascii	"\207\306{\300\246:\310"
+	.string	"*\244\003\301\277C\215\221Q\022aIA\037\252\210 p\341\022\345\363\336 _\306\366\372-\256\256\013\025\350@\026r\202\344\310m\254\214\342U\312\321\205\314h\376\271\201\276\"@\231\3204\204Dc)\0174\025x\331\352\\pF{\206\242`\232W\2426\311\177h\036\272\234\311\021\224R\240\212\204\017\243\263\\\346\210\223\214\336\277;\364\343\022\364G\310\273\330\216\337Q\225_6\247\023g\366\347)\321\372\370I\003\016\367\007\340,\312S\243s\177\334?\321(r\326\035C\264D\241\006\t\275\0327\t\2470s\232/\231\\\333Fk\374\267\263E\217\356@u\242\2368\034\217\016,0\305\356F\264\330j7O\260,\214+'\316Az\321\3151\261t\275\003\347&\004\270\305\366U\371q\327\251~\255\344\2768\247\3455\360\244\023\370:\221\337\004p&_\fw\375\334\212w\236\256\002t\245\333\357\366y\257z\346\377\273\327"
+	.ascii	"A\246\262\317=~\377\313\202)\350\f\t\203\317\247\227\327\201"
+	.ascii	"\260$\313\217\327\332V\356\212?6\034\373\371\201\003\227\357"
+	.ascii	"\373\265\336\330w_]t<\333t\022!\272\205\\\357\334e\367\2729\367"
+	.ascii	"\255D\322\203\237N\365\360\177\213\303\276\370k\342\231?\266"
+	.ascii	"\034-\371\375s5\350\223\255\206\013:K\355\033\342\241I\335n\245"
+	.ascii	"\2569\367=8K\221\217\277\367\227\3555S\377\214\331\240\017\227"
+	.ascii	"\216\220\315\206\217\\\266\002\037\245t\304b;L\337D\234+\234"
+	.ascii	"\244\034\\\004z\210\343\346]\321{\373k\035\240\013\177\206\251"
+	.ascii	"e\r\235\344S\033\202Wd\207l\355\t}\311~$\032n\275\342\337\003"
+	.ascii	"\351\261\333,\340/Xa^~\324\003\232\3570\217\020\375\2011\363"
+	.ascii	"-\337b\247\305\006\033\303~W8\377\253\271n\277nk\306\331\326"
+	.ascii	"\021<\346\214y\376\030\252g\336\246\330\366\274|\310>\370\f\360"
+	.ascii	"\177\252\t\\\b\016\274\207\333\372\036\274 \373rt's]\216\337"
+	.ascii	"\320\001\337\327\231gm4\017\242\335\362\221;\273\033\364\355"
+	.ascii	"N\250\340\345\326\340\374j\246\213\021C\3776m\266\3168\316\222"
+	.ascii	"%\247\002\237\222?QgKs\264\321\214>"
+	.ascii	"/\\\206\237\2554\036$L\211\373\215\340\021\360\261\350\254\366"
+	.ascii	"'\217\f\351/\240\177#\370\241\373\207KW\354FY}b\305s$S\335\031"
+	.ascii	"\307\247\270\207x\235I\026h?\322\271\347\\0y\021\373lu*.\240"
+	.ascii	"I\207\332\242\320\213\316J\215\366\241\313\n\321\f3W\371\241"
+	.ascii	"\356\274\272a?u\370]\001"
+	.text
+	.section	.gnu.lto_.symtab.a433deb85508ed19,"e",@progbits
+	.string	"batteryConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\001"
+	.string	""
+	.string	"batteryWarningVoltage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\001"
+	.string	""
+	.string	"batteryCriticalVoltage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\001"
+	.string	""
+	.string	"batteryCellCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\001"
+	.string	""
+	.string	"batteryUpdateVoltage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\001"
+	.string	""
+	.string	"batteryUpdatePresence"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\001"
+	.string	""
+	.string	"getLowVoltageCutoff"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\001"
+	.string	""
+	.string	"getBatteryState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\001"
+	.string	""
+	.string	"getVoltageState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\001"
+	.string	""
+	.string	"getConsumptionState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\001"
+	.string	""
+	.string	"getBatteryStateString"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\001"
+	.string	""
+	.string	"batteryStateStrings"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\001"
+	.string	""
+	.string	"batteryInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\001"
+	.string	""
+	.string	"batteryUpdateCurrentMeter"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\001"
+	.string	""
+	.string	"calculateVbatPidCompensation"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\001"
+	.string	""
+	.string	"calculateBatteryPercentageRemaining"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\001"
+	.string	""
+	.string	"batteryUpdateStates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\001"
+	.string	""
+	.string	"batteryUpdateAlarms"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\001"
+	.string	""
+	.string	"isBatteryVoltageConfigured"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\001"
+	.string	""
+	.string	"getBatteryVoltage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\001"
+	.string	""
+	.string	"getLegacyBatteryVoltage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\001"
+	.string	""
+	.string	"getBatteryVoltageLatest"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\001"
+	.string	""
+	.string	"getBatteryCellCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\001"
+	.string	""
+	.string	"getBatteryAverageCellVoltage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\001"
+	.string	""
+	.string	"getBatterySagCellVoltage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\001"
+	.string	""
+	.string	"isAmperageConfigured"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\001"
+	.string	""
+	.string	"getAmperage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\001"
+	.string	""
+	.string	"getAmperageLatest"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\001"
+	.string	""
+	.string	"getMAhDrawn"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\001"
+	.string	""
+	.string	"pgResetTemplate_batteryConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\001"
+	.string	""
+	.string	"batteryConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\002"
+	.string	""
+	.string	"batteryConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\002"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\001"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\001"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\002"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\002"
+	.string	""
+	.string	"voltageMeterReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \002"
+	.string	""
+	.string	"voltageMeterADCRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\002"
+	.string	""
+	.string	"voltageMeterADCRefresh"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\002"
+	.string	""
+	.string	"changePidProfileFromCellCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\002"
+	.string	""
+	.string	"currentMeterVirtualInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\002"
+	.string	""
+	.string	"currentMeterADCInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\002"
+	.string	""
+	.string	"currentMeterReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\002"
+	.string	""
+	.string	"voltageMeterADCInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\002"
+	.string	""
+	.string	"voltageMeterGenericInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\002"
+	.string	""
+	.string	"currentMeterVirtualRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\002"
+	.string	""
+	.string	"currentMeterVirtualRefresh"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\002"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\002"
+	.string	""
+	.string	"mixerGetThrottle"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\002"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\002"
+	.string	""
+	.string	"calculateThrottleStatus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\002"
+	.string	""
+	.string	"currentMeterADCRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\002"
+	.string	""
+	.string	"currentMeterADCRefresh"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.a433deb85508ed19,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,691 @@
+	.file	"compass.c"
+	.section	.gnu.lto_.profile.e992b2aad5b3a067,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\f"
+	.text
+	.section	.gnu.lto_.icf.e992b2aad5b3a067,"e",@progbits
+	.string	"(\265/\375`."
+	.string	"\335\005"
+	.string	"$\b\"\001"
+	.string	"\022"
+	.string	"\322\266\272\274\b\022\002"
+	.string	"\002\001\002\002\002\001"
+	.string	"\001\274\205\242\255\006"
+	.string	"\002\267\335\335\337\n"
+	.string	"\003\315\344\253\361\017\002\002\003\002\004\004\240\342\234\212\n\005\240\224\254\300\003\006\006\330\344\353\301\004\n\002\005\002\005\002\006\002\007\007\352\263\360\321\b\b\t\n\013\366\344\227\262\016\002\f\373\306\226\226\0070\002\b\002\t\002\002\002\n\013\002\t\002"
+	.string	"\002"
+	.string	"\006\002\006\r\016\017\020\203\325\356\324\t\021\240\342\234\212\n"
+	.string	"\030"
+	.string	"\031#\222\272\273\207F1\037v.\330\t@\200:\f\362\020"
+	.string	""
+	.string	"\250\302\003/1\260p\325*[\320X\212\210\256\256\345\306\345s\350\216\200i\006\017\364Z\271\253"
+	.ascii	"C"
+	.text
+	.section	.gnu.lto_.ipa_sra.e992b2aad5b3a067,"e",@progbits
+	.string	"(\265/\375 B\255\001"
+	.string	"\204\0026"
+	.string	"\b"
+	.string	"\001\001"
+	.string	"\001\001"
+	.string	"\001\002\002"
+	.string	"\020"
+	.string	"\007\003\003"
+	.string	"\003\005"
+	.string	"\003\006"
+	.string	"\001"
+	.string	""
+	.string	"\013"
+	.string	"\003\f"
+	.string	"\001"
+	.string	"\001"
+	.string	"\001"
+	.string	"\004"
+	.ascii	"\220\242\265\213\364\022\306\006\260"
+	.text
+	.section	.gnu.lto_.inline.e992b2aad5b3a067,"e",@progbits
+	.string	"(\265/\375`o"
+	.string	"\275\005"
+	.string	"\022\311\034&\220\245I\007\177e\\T9\375N\357\026\230\377\036\251\331g\021\023X\212\335]\236\273\366\177\375f\377Wkv\313\235\002\377\342xFZ\271\377\203A$\230*\312\006\240+\230*\352\204\025\207|[\307\311\177\302\207\007m\001\236edq\341\337:\2046R>\032\236\361\021y\201\266\321\346\360\354\031\351~\204\301\271.\361\213\006m\r\244m[\300\265\255\342\013[\023\033"
+	.string	"8\007q\0256X\327I\212\\\212"
+	.ascii	"E\201\030`\247\325\320\036\200v4.\314\\\343(\304\\\201.\001O"
+	.ascii	"\252c\240\005X\307Q\344\250r\341&\362\240\214\266\262\2533?\225"
+	.ascii	"i\026\363|\332U\200!"
+	.text
+	.section	.gnu.lto_.jmpfuncs.e992b2aad5b3a067,"e",@progbits
+	.string	"(\265/\375`\001"
+	.string	"=\004"
+	.string	"\"G\027!\220)\351\267\372\370.\350"
+	.string	"\376\237\337r\276\305\236\206\217\337\314\207h\235\017\363\372\3067m\273\267\224)\037P\304\320\"\264\314QK\205\204b\261S\274\220\024r\302r\b\243\361\330){\320|\340\277\007|\tz\303\336\361\312\365\211`\021\237#\237+G\2654-\361\247\2049\026\0259\263%\020"
+	.ascii	"\240\210\234et\fP0!P\364\021\262\302\324\0357\032\215h\307\207"
+	.ascii	"/\244X\3374\003\215\321\024\322;\t\331@\033"
+	.text
+	.section	.gnu.lto_.pureconst.e992b2aad5b3a067,"e",@progbits
+	.string	"(\265/\375 \035\351"
+	.string	""
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\b"
+	.ascii	"\232\004\001\200\004\002\200\004\003\230\004\005\204\004\006"
+	.ascii	"\232\004\013\204\004\f\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.e992b2aad5b3a067,"e",@progbits
+	.string	"(\265/\375 \315\305\003"
+	.string	"\242\005\023\037\2605\303\001\f+\313\005J\bDaH\f\006:!\025\255N\227\372\335\033\210\255\227\264-e\n;\017\324\250\327\200\310\341\312]'+g\355z\342'S\276\224\253\333v"
+	.string	"\024\"i\372\375nm\245\023\2146\347\367\244\f\360\342\365\013\002\021"
+	.ascii	"n\004\b\002\201\250\004tA\330a\202@\200\235\031\300\\W\005\265"
+	.ascii	"\246\354f6\005\255\3019\250\271\\\027\001^F\036@\021"
+	.text
+	.section	.gnu.lto_.lto.e992b2aad5b3a067,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_compassConfig_Registry.48.e992b2aad5b3a067,"e",@progbits
+	.string	"(\265/\375 \242\275\004"
+	.string	"\204\bk"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001\212\001\202\200\200\374\342\203\305\341\035\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\374\006us\250\324\006uq"
+	.string	"\005\001\006'\001\030\005\001\006\035\001'\001\250\300"
+	.string	"?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/compass.c"
+	.string	"\004"
+	.ascii	"\237\n\013&\321)\212\274\001\024\001"
+	.text
+	.section	.gnu.lto_pgResetFn_compassConfig.49.e992b2aad5b3a067,"e",@progbits
+	.string	"(\265/\375`\251\001m\r"
+	.string	"\266\027WC"
+	.string	"S\234\016XZ\356\234Wp\200\317\365J\023\355\ti`\246&4U.9c\004BH\312af\316 B\016U\340\025\276\006\271A\354j\322]\306\363$\335\005\021>\350uEP(\016\364\243\330\206\366N)?"
+	.string	"B"
+	.string	"F"
+	.ascii	"_\215.`\367\224#d\227D\340\003\225c&\237\251\307*\037P\217\031"
+	.ascii	"\264y\234D\355[%\020\256rw3\232\342\340'\350\377\305-\242)\374"
+	.ascii	"\004i\260\273\236\242i\304Mo\273\200\355\005\366t\020\266\206"
+	.ascii	"\303\370*\273\233\300gm\340\220A\2518\346\217\3521\t\245\321"
+	.ascii	"\204\352\2044_6\031N\212\302>ew\327\364d\177\365\3239}\f\003"
+	.ascii	"\262\364A\240\307\256\210\327\217%\301DV\\l\177\332W\335\005"
+	.ascii	"\030\257\301*);\027I\225\214\255\333\332C\276PGyr\317i|\021B"
+	.ascii	"\260\370V\355\317el\031\013k\306\b`\326{\244\032\370\251\r\342"
+	.ascii	"\346E_N|\240\241\375\030\0350\242\215\341.\357\230\346TA\211"
+	.ascii	"\227H\342_\r\237\355B\210{\020\300\332\306\363:\"\020\247e^\307"
+	.ascii	"y!\217\227\205\266\016(\323:/\333h\314\211<]\226\201\343\272"
+	.ascii	"\354B\356)KO\206\320\202\204D=\3708nO\370\b\307\264\243\344T"
+	.ascii	"\233\302opB\223\262\302m\244LF\013\001\" \260\202\2219\3633e"
+	.ascii	"\221e\017,\255E\013\364F\035Y7\246\016\330\371\335\315\375\335"
+	.ascii	"\315\341;\304!B)\317\230&!+\247\001\022]\302\001\355.zD=\342"
+	.ascii	"\b\316\264\032*\3302\355\220\307\234\330&<e\006\333|S\300./Z"
+	.ascii	"A\006"
+	.text
+	.section	.gnu.lto_compassPreInit.52.e992b2aad5b3a067,"e",@progbits
+	.string	"(\265/\375 \302%\005"
+	.string	"r\311\"*\200k:\300h\030j\201\022\031\3165\250\003F\366j\001\360\177{\331\277\247\267u\021\255\031\302T\340[=\2030!\215\342\336)\005\256\246Z\251\354\232\225\254tV\314\252\022SP\227\254h\225\323\3003\263\250\\\314I\245\364\355\243W`\304\206\375m0F\354\0036z6\214<\033Bf\367\021\002\255&\200\241\330\276d\315\356\374\233\354-\034\307\345\263\2732J\256\035j\376+\027p\335v\030!v\327\220\353 w\274m\203\355\203\355D\b"
+	.ascii	"3\003\316\231\021\340\313]\303\311B\030/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_compassDetect.53.e992b2aad5b3a067,"e",@progbits
+	.string	"(\265/\375`\037"
+	.string	"\215\007"
+	.string	"\242N56Po\322\001 n\013\0020\004\227\007\300\r\350/\3041\330\346D\314k\020QC\220\013g\323k\233\351\003\233\020T\025\021\005\f\235eBg4\326\271\267\214v\333;\245 L^\230\204g\242\n\240\220\021\317V\207\322\352sM+\322lRL\322\210y\252+Z\031\215\235\002\317\217\314\"h\316,r\352~\243\f.\036\206]C\356u\330\327\354\356\372\221lw\016\323)\006BeW4#\263&\310\022b\373\2665\233c\373\325\n\230\005\347\354\227\274\244\335\304\342\002\273\244\322\312nUp\302\346\320\365\004\324\341\346\003\324\241m34h\336^?D\007!\311@9\355\326\370<\276\335m\376O~0\322\342\362\2222\n\335\001<\354\256\235\306h\343~\267\215`\333\301\266H\n"
+	.ascii	"2\003\202\341\243\302f\025P\270\f\b\n\301e`$\001*\314\353\232"
+	.ascii	"d"
+	.text
+	.section	.gnu.lto_compassInit.54.e992b2aad5b3a067,"e",@progbits
+	.string	"(\265/\375 \376\355\006"
+	.string	"B\21505Pm\222\016d\254\210\006+\213kOug\027(\"F\377\226_eUN\252\033\332\355h\243\356l\335\301\277\331\314\021\313Y!5i\013\214X\3603\344\206\b\221)W\226\0301\034\215U\301xYq\223\211p\303\200\321\300\352\212\320B\260\305\311\\\260\301\262.X\331\262b\224/\331\373<\351w\006\357\320\220I\003Zf*\334QA\036\356F\251!:\256\240R\267C)U\217\272\021F\007\305\207)s\247\337>\356]|\001\362Y\374kE\311d\262P\222\031:\235d\211\"\341\370=_\031!\3013\326M\013UcDB\304\224\271\301\227Q\254\016\273\002\242\210\272\200Kf\356@\242\211\376\372\027\374\007\277\026\t"
+	.ascii	"2\003\302\360\030aF\035\302qM\314\212\300D\210\034\356\334m\213"
+	.ascii	"\023"
+	.text
+	.section	.gnu.lto_compassIsHealthy.55.e992b2aad5b3a067,"e",@progbits
+	.string	"(\265/\375`e\001}\f"
+	.string	"6\327P?0m\224\016KaTY\353\370E?\007(Vt\254DS4\202\330\301\243L\243B\225\262\0203\330Ova0FZc\276\325\217bd\004G4\354\335Zw\246\363\221Oi\030D\366\336R\246\024@"
+	.string	";"
+	.string	"A"
+	.string	"\242k\035\032\247"
+	.string	"\001#\004\305\256\026u\302E\207\317i\212|\n\363N\200\370P\312\260\303\215\277\007\351$\331E*\200\314\201\243\354\356/<32R&\205\331]g)\213pS\267\355\261]\261\357\021\025\376\334"
+	.string	"\224/\375\371 \370w\235\224\030\031\345\311\326\260T\016\373nw\327j\262\235\206\232v\231\326Lg\246O\t\330\020\241`\333\3258\251\330\020o\304\202\355\220-\261\201\003!\007j\322kx\007o\027\341\3609\310\206\333\003\374S\275\210\336\245\246\204\002\017\361\026A>\226\217\324\370\334]L7\002W\035\361a\342\"SX\256y\233\220\330\335\004v\365\f\237"
+	.string	"\035\273\213"
+	.ascii	"\303=.?\326\\\256+\343\341T\232xY\325\325\331\\\261\263 \303"
+	.ascii	"\211\032\353\212\227\001\256<\033+2\250*+J\264\275[59_\345\351"
+	.ascii	",w\232a\033*e\244$;\205z\214\025\243<Y@\345\200\252\355b/  \340"
+	.ascii	"\002\031\n\316\003\013\031z\306\031\336\313\"\003.\307\204\346"
+	.ascii	"\021\270\344\rV\356\326\214+\275\353]\022\272(\263q;\345\224"
+	.ascii	"k\324\030\001v\3343\201.\032m\346\341\2353\260b\203\214\357c"
+	.ascii	":N\262\030\352F\371\351\355\312e"
+	.text
+	.section	.gnu.lto_compassStartCalibration.56.e992b2aad5b3a067,"e",@progbits
+	.string	"(\265/\375`\001\002}\021"
+	.string	"\326\337pH\320\322(\035PgY8\t\272\351Cm\003@\267+\n\227\203\fg3\250\n\263\3223\244\265\325t\362\273T\373\006\034\325\244zfj|\177\365\201\214\346\360\202\273X\333\207\nx\305\372\272\032"
+	.string	"Qc\rn\214\354-wJ\001X"
+	.string	"Y"
+	.string	"b"
+	.ascii	"\323"
+	.string	"'\243O\0047\300}\312\023\340>O\262\313\326\361pf\317\323\201\203\216\217\335\355\324\204\3652\274et}J\215.?D\245\346\tlE\240\354\365)\007\354\256\210l\203L\2111\262X\224(f\327\207W`\253\201\262\331c\210\312\356:\2022\0207w\333-\333)v\\\tJS?\347+X>\215\275\227\351\277\374\200D\260x3\027m\013\030\342\301\253H\210\022A1}\331a,*\315\376We\354\322qn\251\321\032\243\343\243/`\304\346F\204\242]\017\267 \0334}N\034\347\366m\374\320\244\337\\\205\3538\376\031\275>\214vxD\354\330]\223\0073L$2P\007b\334'\345\225\225A\242\250\252\362\007\306F\315\265n\346\301a@(\021z\361\036\t\236\300\022\017\262p\237QI8z~\370\300\342\315\276\211\263}\341.L#B\273\333\300>\275\005j\264\273\fX|'U`fwO\363i\n\252"
+	.string	"_q\237\017_\242\323\223\202\007,\336Tw\367\245\001\237*\303I\032\205\362}'\027\226\207\352\276\226\367\265\244\276\256Eubu\250\326\327\241\220\330sI\265\272\n\236\327\352H!\354_\225\361k>\002\272\t\202il*\315"
+	.ascii	"\206\264\244:\024M.5f\301\245\276G\316\220\206\b\344rwW\236\\"
+	.ascii	"jI?\302V\203!\021\253A\003(\345`\365\231-\207j- `\202Q\252\316"
+	.ascii	"\003#\241\227\022\203A@3\265\213VK`\005K\332\003\331c\321s\260"
+	.ascii	"\007\027\270\004\310\340\356p\274\214\005\2459|c\221b\273\026"
+	.ascii	"Cl\035\267g\200a!z\t\356M\3024g\006\334\333\032\331x\321\375"
+	.ascii	"\274%i\270\234C\276\235\221\002\3559;\301i\345\020\242gF\343"
+	.ascii	"\2067X\331\333\032\360E\271s\211'"
+	.text
+	.section	.gnu.lto_compassIsCalibrationComplete.57.e992b2aad5b3a067,"e",@progbits
+	.string	"(\265/\375 \373\315\006"
+	.string	"R\315/3pk\322\001\220\365\377\003Hq\026\226\333`<\312\270\315\206\375\255\023B\265mh\350\230EW\331\342\331\322\371\252~\343O.\213\006F\004\004\216\204\020)S\n\266*\b#\225\211\263\032|\016R$\260Q\026\"\223f=\330\252\001\273\212\3445\006\347^\243\342^?\252\004\032\335\330\267LW\325s\262\315/\216a\361)\334p\311c\227\374\313t\351\032\360\240\311\220\0353\251\021\366\243\335]\353\307vZ3\375H`\343CAc\267\023\nY\017)\253\260\215\261)\037 `|=\202:\237"
+	.string	"q2@vcS\211_\317\313\277\305\243\254\203\003\363d\236"
+	.string	"\t\273\353\304<\016\267\336v\201m\003\333\020\001\b"
+	.ascii	"2\001O8c\216#D\250@\346\032\275\204\310\341\316\231\332\371\004"
+	.text
+	.section	.gnu.lto_compassUpdate.58.e992b2aad5b3a067,"e",@progbits
+	.string	"(\265/\375`Y\fe6"
+	.string	"\212Z\270\023E`^R\00730\007\305\251D\353\001v\324\261\203\327+\231\260i"
+	.ascii	"a\026N^\211\311\304V\255y\221\262\201\036\345FN\275\305\346`"
+	.ascii	"\343\005\033Qx\212\313!\266\036(\304p"
+	.string	"q\242\332CZ\362K\354\336;\245\224\002)\001\t\0010\001\354\356\334V\306:f4\330\271w\305t\317\235[\343\2004\224n\267n'\375\314\035\3458\026\274ciuA\336\254X\221\343\206r?q\302]xae<)V\326\336\334{\241ze*^\257\357c\346v\346f\322lm7\001\343\336\2758\330\262\334\013\215b\002\274^\217]d{U{\310\366\312\3342\267i\250\363\266\025\037dP\356\334{\221\317CH\344o\025\332\254\252m\017\025\211C!a0\b\b\3643\372~z\274\035\273\252\357-\367\316j\251L\031\246YX\017\375\350\242\217(iN\334q\246\326\303(\r!\255\016\016\2163\265\026R\203Ro3\\\270\263\332q\366\354\240\263\203\234o5\034\210\326@ho4\374\327\312g\033{\f)\003\342\276\0372\374'F\367\324\343\231\262\030\352\261\255\225\206\224\301p\236\322ng\205\343\354E\263\352"
+	.ascii	"49\026@32\265h&G]\267-}U\203\367^\240\031\tU\312O\230\211\271"
+	.ascii	"*\204E\177?\351\001b\340\230f,\332wV\367^v\246\331Y3Q3\367\031"
+	.ascii	"f^\300\354\213\n\322g\360/u\250f\372\023Q\315\364]\307M:\346"
+	.ascii	"yZU\t4\3233\370\236!\006n\211&\346S\376\017\303p\305(Wh0W@"
+	.string	"\247\227\376r\001C\206\fl\257\315\214\343\377\377]\226o\224>M\322\\\260\022l\361\357'-\240\313\230\2658\245O\377\357\275a\317Bohk\321:r\302u\226\rYZZ\320\306\322E\214\336\253l\346\225g\237\r\022\037\306\314[]\245\003\357\336;\305=\245\251pq\253\365\312\036\272\274\231\275rw\261\275\366\277\021\271\265&J\2372C\305\374\233\314\335\367u03\250\242\352&\335S\253\263TCivj\267\346\246v\322\314\364\316K\254\263\022\353|d\235\223\336\031\211u>zg\243w.R\235\003\2743\200w&R\235\215\357<\244:\027y\316D\236\363Pu\026R\235\205\357\034T\235\203Tg\240\352\f\364\316?\325\331\247:\377\250\316\275w\346\251\316\273\2353\313:\257\253\263\252:\377{\367\376\276\311\335\306\327\001\344\261\2346\030K\374/\2671\303\237z\342\217\030\363e\031D\314\007\306\016\375\205\303"
+	.ascii	"\313\3216\233l\257\303\177\272\272\037\241w\321\202\205\360\203"
+	.ascii	"^(\370\3023\263\262\240\237p\025)\034\2057wa{\r\372U\r\f\340"
+	.ascii	"\233\360\022N\006\364\276\007\376\036\210\204\217\271\330/\312"
+	.ascii	"\303\374N}\277\246\t\023\367\363|\366\350\351\375\356\177\276"
+	.ascii	"\227Ax\337{\347\263|\203\007\353\311\331\362\350;\355\223W\247"
+	.ascii	"\355\264iM\255\217\026\310O\267B\330^y\377\364\214\233#\347\n"
+	.ascii	"\350\214\263\373\325H\232\2658%\364\336\333\373&wK\204e\237\203"
+	.ascii	"\233\264\333\264\233\226\b\267\032\267FZ$\336\314\026\t\333+"
+	.ascii	"\373\337\202\016\317\013\036\223\257\337\320\256cs\345$m\227"
+	.ascii	"\264lG\251__\214\036\262>=m\021\254\372R\317N\366\202\271\260"
+	.ascii	"%q\356\216i\032\374\242\016\232\356\301\201(\2323\020xf\256\232"
+	.ascii	"\242s\034A\2027\223\177^\364\314\221\3700\250'R\300\260\337"
+	.string	"\344^S`\325\347\340\266f\314\3630\363\204\226\243\300\023\243~\2675\023\0352\3537\271\027I\256\021Yj\362\302V\027\227\205\020\037\266\276\276Dh\001\261V\201d2\013D\227\227\0262\371\345\225\374\260\225D~\340\312\352Bj}%\221\005\216\330\013\304\326\0272\204\227\327\027\322\007Uv\337\327\301\030\354\314)_\214\207\f8s+\243\245\341m\335*\276\300\231\023\373\260\342\220\352W\251\020T;9\021\235\236J\315\022m\351\233`!E\235\315\231\264iFN\245_z\225\216\254\2173\373\370J_D\267T\222\364G\177|\"(K4\244OR\202\325^\326\332gsI\202\364\355\345\031g\364G\337d}\212\370\021,\005Q#\355s*Z\304\350;J#[\324\371\3417c\364\220\266vj\322\2713G\350\233\354\223\006\253~\225\032\241\272\251\351\375\210\360\233M_\245\306\203EA\200\374\250Q\364\315\204\214\224\240"
+	.string	"d"
+	.string	"|"
+	.string	"\265\264\0365Z!"
+	.string	">\250\351\006H\364N\254\247(\217\366\351\024\335Q|\242o&c\354,\311H\335{\201\276i\374\342\367\0207\271\2417\276Jg\371F\007VU\216\366\211\300o8\2166\215o\264Bx\350\253\332#^\203\341\222\320\256\214h\024\277\337\372\211N\033<s7\200\367\250a4%\231B\246Fd$IRIc\300\002\021\031\252\252\003\021"
+	.ascii	"\2513\314!2M\222Bc\263`\230\n\355\030+=\301!s\304@\001\f\266"
+	.ascii	"t}\360\327\361y\217k\034\216\035#n"
+	.string	"r\246\204\222+\334\214\305\214\222F\316\373/\351\203R\022\221\260\216G\266\003<\032\240\020T\017p\303F\007\0175\001\007\n2\004\212\335P\033\304\007*\201\222\344N\205\336\303\202@\375k\367d\371z\035\307gW\335f\330A\274qD\366\bRp`S\256wk\314\\\3513\260\261\267[\344\340X\362(:\234\020\r\362\377\223\346\301\r\300\335\241wZ\362\027:\304o\277\"$t\n9\007:c\025\326\336\260G\213^\350\232X\315\244C\004\022\322\220^\325bHo\272\364\324Q\003G.\356i\021\314\342\322\373\213\233\273&\335EP\034XF3\245>\025\204\236\223\344\023\331\021\214#*\210Y\300\246\016C\361\224\274\353H\337\215bY\301\023\244\001\202c\260\242\372\337\001(+\222E\262\376[\274\017\372\222\321\253\005\326X\265\316\2760(;\265\233\222\236\232\342R\365\227\273\007\213i\t\321\034x\251\016\034\265\351\336"
+	.ascii	"\017\t<\2232\317\256\232p\276$\355\272b>8J\320\374\224\215\342"
+	.ascii	"\220\273\024\037\263)\017s\007\005O\262\032\033\240\347\037\255"
+	.ascii	"s\332\232\260\035\355\375\20170'\027\217TX\224\336\377|\241\373"
+	.ascii	"\002AWv5\225\265\350\213\b\273\"|1\3419\017g\365\017\td\311\006"
+	.ascii	"\233,5\326o\301\240jW\241\317\267\340\311\300\3162:\240\340\325"
+	.ascii	"8\001\304\254\374\025\256\277\326\212\017\261(Y\362\230\212\001"
+	.ascii	"\b\261\343\300\3219\215}\254\256\253\330\200\257\r\257LuX\306"
+	.ascii	"\317\205\323\213\372\013ug[T"
+	.text
+	.section	.gnu.lto_.symbol_nodes.e992b2aad5b3a067,"e",@progbits
+	.string	"(\265/\375`\360"
+	.string	"\335\007"
+	.string	"T\013\354\001"
+	.string	""
+	.string	""
+	.string	"\0021\177\033\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\300\202\0024\177\034\2005\177\0356\177\036\005,\020\201\2047\177\037\2008\177 \001\005(!\200\003\005-\"\005)#*$\200\003\0029\177%\200:\177&\001\005+\0232\0253'\0050(\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005.)\001;\177*\377\037"
+	.string	""
+	.string	"\200\200\200\001=\177+\300"
+	.string	"\177,?\177->\177.\377\003"
+	.string	"\022d\003\006\023\001\001$\003\f\026\330\307\302+\001\344\006\003\f\025\250\270\275\324"
+	.string	"\001\304\007\003\f\024\200\200\200 \001\304\037\004\f\200\200\200\200\001\001U"
+	.ascii	"!  \003\021\242n\365@\346\207\331\301\214\034\034m\202s\211\017"
+	.ascii	"\310K\226\266$\301x~\314\003\033m\27193\247\005;2\\ \321g\243"
+	.ascii	"\352FaH8\213\366\265s\270\220\203-\350\364\360\307p-\303e\353"
+	.ascii	"\030"
+	.text
+	.section	.gnu.lto_.refs.e992b2aad5b3a067,"e",@progbits
+	.string	"(\265/\375 \263\005\004"
+	.string	"\362\312\035\"\200EI\00730\00330\003s.\"8\030\330\261\243\330?\"\342B\373\255\3447B\biD\222-S\177\315\251+\234\r\024/`O\260~ q\001\306\003\330\003,\036Y\017\351?\322;\312\031\352\027}EyB=\242\177(7\250o\372\f\363Ko\245\335J\357\325\036\225\237\345o\271\257\335l\023\0323\255\360\304x\262x\025\277\304\004\215\372\247\317\216\316,\017\377\203\001"
+	.ascii	"\210`>\001"
+	.text
+	.section	.gnu.lto_.decls.e992b2aad5b3a067,"e",@progbits
+	.string	"(\265/\375`\226'=\265"
+	.ascii	"\212\"\021@X0\nQ:\035\036\364\357c<N)\r\343\030tD\034>h\346^"
+	.ascii	"\274\353\205\0361:\034{\325~\322\246k\226\206P5p\347\215o\207"
+	.ascii	"E\343\312Z\0334\274:\246\216\273\032*\352\271\204!j\332V\305"
+	.ascii	"\246\022\002\031\203\236\345]\327,N\264\n\275\023\003\033\311"
+	.ascii	"\036R\246\224\002\202\003\363\003\366\003?\325\316\343_\364\325"
+	.ascii	"\301\241\331\261t\244Jz=_\260\227\352~\250oj\266oR\360K\360\250"
+	.ascii	"\364\270\360\314}\201o\264\337E_\370\345\020\002cF\013\0261j"
+	.ascii	"XVU\177\237\t\30765\275\334$\334\336\303N/\357\212\327\325)\340"
+	.ascii	"\221<\313\224-!xvM\234\270\024/G\177\342\223\036\3053\177\351"
+	.ascii	"\215^\305+}\212_\341\320Gr-\355[\\\017\213\327\005m\316TU\266"
+	.ascii	"\306\350\\J\027\347\201\344\\\336\204\034\337\024*^\347\321\247"
+	.ascii	"\017\302\270\334\345\354l/{$7\3639-{wV6l\360H~\347u\301\2443"
+	.ascii	"\257\360\300\n\f2\275\234\235\236B\316\b\032\316\375\245\335"
+	.ascii	"\021\027\307\025\367\312O:\364\213|\257\275/\250\264\311Y\313"
+	.ascii	"\356\213\374\351^<\232u\303\350\322\256+lK\351m'\033"
+	.string	"R\345\313g\347s\250\367-\373\352\372\202JgV\372@EJN\007GG\347Hv\345\005\337\266W\270\335\213\367X\376\230\210\364p\373\353i<\355]l\333\233\321\336\337\266K\330ql\022\367\343\341\376&\270\377\r\343@q\277\030\3169\241\n\315\027\035_\274X\341\376\026\270\203gb\177\342P\034Z\201G\351\r\033\264M\226\345\261\234\2355\267)\356\312\306\337\376\214\333+H\275\317+H\333\257\340Fs\013)\223\0133P\243fX\234\234/q\250G\235\355\351kapwQo\3638\217f\205\360E\311]\316\371\202\216\316\305\221\205G\226\364*\231A\241\267\343o\273\031N\342G\034\211\033q\250\303y\221~g\316h=\336\330\310\206\250\271\0207W\013\302\344\334\\\333\3129\267\002\272y\332\341\234\210\253a0\221s\363\305\215\022\n\364\212^\316\031GGGG\247\346\250\212\nO\346\266/q\377\340&\342\336"
+	.string	"\356\f\340\f\037p\177\200\333\327\\\315\233\231\202 \013\037`Q\177\375\314\321\034z\301\203\264\2479Y\303(\235\331\351yYEK\177_\003\334\335@z\202\271\274A\0071\br\356\353\363\013\251\373\340i\377q\223*=9s\315\007'\310\b\373kep?\3566\267\220f\340\026\322\364&\265q\013;\272]\314\307*\260L\244fF\313\331Y\241\306\331\224$\343o;\335B\212\375&\355v\034\022\300\353~\r t?\007\335\037\201\207"
+	.string	"S\267wp\r\335\335\305\251\333\231\335N\325\355Y\215\301%\340;\255A\267\255q\325r\335\255\366\016\350\376\013>\350\013\032\247\333\256h\0201\3356E\267\017\340\033\220v\333\023\b\350\356\333m\223\355\3356\250\333g\272=\246\273\243t\373\257\333m\272\035\246\333i\272\275\246\333\203o"
+	.string	"\017\272\035w\373\355v\231\356\256\362\f\260\320m}\272_\246\373\203\335O\323\375\300\356\377u\177L\367\317t\277\215\347u\377\355~\230\357\240\273m\272o\001\272\177\001\335\277\323\375:\335\237\323\375\007\350\376\233\356\257\320\355H\272\375\255\333\335\272\275\255\333\327\272\035\332\355g\335\356\243\333\315\272\335\331\355_\335\336\325\335L\272{\204n\277\352\356\264n\217\240\333\265\272\375\251\333\263\272\375\001\335.\200n\237\321\355"
+	.string	"\350\366\252nov;\214n\237\352v\251n\217\352\366\f\272\275"
+	.ascii	"\335N\200n\267\240\3333t\267\b\335.A\267\337t\367Xw\357t7\\w"
+	.ascii	"\313\364\365\365\365u\333\017\272\177\033\272\005\200\023II9"
+	.ascii	"?\341$\345\251\244\020\243\234\037mJ\333\022\363i\325\344\021"
+	.ascii	"\362\343\271\225O8\223\276\225\245T)\341g\262GF\272\202\267\226"
+	.ascii	"X\344iA\255\226{\311\311\231)\203\030\023%\f:\346)\253\035j\263"
+	.ascii	",\214\030\346\365\352\273\373*O\236\236\376v\314\222\214v\250"
+	.ascii	"\225ag\3448s\022\003W\022\353M/+=aP\263bj\211\342\257\275\nr"
+	.ascii	"i\362\303Y\207\033\323\345\330\252\230\2453?g\224MkL\2421\332"
+	.ascii	"\307\212\260\276!M\030?\246$_\324R\311l\235\311\2202\202\273"
+	.ascii	"\355\2137\2031K\022\246\234r/\307\027G\364^*j*\252\004\322\302"
+	.ascii	"6Y(\313\302\272\260N\366\31129\324F=V[%\273\3248Bl\324\203=\217"
+	.ascii	"\274 <\366\204=\302\302\343\356\365\254\221\034\332\230\215z"
+	.ascii	"\257\2641\033\365?~\013\206\"\346u\003\362)\330\250\357R{\034"
+	.ascii	"6\352\235\357\343\b4\312\242\260+0\0241\363=cb\345\006\0263c"
+	.ascii	"\207\324\221\bn\232\335\302MjU\244\300\367\2341e\223,\222\214"
+	.ascii	"\233\224\274(6E[$\273\265\244m\013\215\031\271\255\024N\3302"
+	.ascii	"\2034l\034\211\361\267\261\022\367\217\017\357\341\330\263\245"
+	.ascii	"\216\267K\207Z\023\317\005\315\232\370.\266\bH[_\013\275\231"
+	.ascii	"|\304E\310-\262J\025*\356\230\177m2FI\013\027H\326\372\034js"
+	.ascii	"\333\345\304\350b\372\333Y\376\313c=\261\322\345K?\237R>\203"
+	.ascii	"\372\273\367\263[\232+\033\303^\236K\f\245\223%\035\270\177X"
+	.ascii	"\270\177UZ\236\312\016\247\037\177\373\327\204\257<\026\207~"
+	.ascii	"\226\017\202\223\345\317\036\272\364\243\273\313\362i\217\347"
+	.ascii	"\321'\233\274\264\343\273\363\037o_\362\322;\367v\177\367V>\317"
+	.ascii	"\241\217\327\217\367j\377\026LV\310y\306\336\026\336\033\371"
+	.ascii	"(Sj%_\361\322\273\240\243\003D\272z\221\304\267\312\3279\364"
+	.ascii	"\355\236\n\224\237\342\321'gf\n\006i^\361\322\263\373&\377\004"
+	.ascii	"C\0213\004\"T\356\360\020-\"4\322\333?\024S\350h\216\330\272"
+	.ascii	"\242Dy)2.\236\242D\276\340\356(\355*\270L\300e\301u\357\244\355"
+	.ascii	"NP\322\264\343\016wJ\207;}"
+	.string	"\202[\001\321?\362q\036E\353 g\267\344\2318\364\243/w\243\277\346uI\254\334\341\350\004ot\211\355@\202o\216\345Y\334\337G\362I\034\372J\036.\323\320\330\275(\342\305\206I\374\272H\332)\032\356\364\211\211|\021\207\376\333\017\301q\346\234\366\366l\357\206\241\210\351\201\252\313\335\333\257\001ol]\361\302\321\321\371\311p\343\241\225\336N\241p\367\273\t\261PL\265='\214\221''5\332>\bp\n\212l\367\267S&\334)\n\334i\0227\214\036n\230*h\017\244\346\254\212\fl\016\r&\tn\230!\377\364&Z\272\034=\361\367\3702\207\276Y\337\262f~\346\354\244\261\312\2468\266\234\264\306s\322\206\311A\206\343^&xxY\3411\207\376\216\327\261\343\303^,\270t\346$\003\224\246l\201\271\024\\\321\222{\305\272\377\353s\274TL\033\035\023\216\277\rc\204\373\346\341\276M\3607\335Bj"
+	.ascii	"\277I3(\202\373\252\335pmy\025\235V\221\277[\177\003X$\253G\013"
+	.ascii	"\255\376\0335fr\036\3139c\240i\316}\235\375\375\032\377(\274"
+	.ascii	"\215\376\032\177\302\314\362k\334\234\225\356\026\004\335-\200"
+	.ascii	")RCi\226\336\276g\370g<\r\246\037Q&\215,<w\004D\355o\177\326"
+	.ascii	"cu\347\234i\202\304\351m!\303\235\345\257b\360\236,\311\272R"
+	.ascii	"\273W\\kb2\242\337\244b\331\304jN\006J\311\t\253*\207\206\013"
+	.ascii	"\224\"\260\030T3dqfiM\357\344B\236\352\237\232-\030\223\363"
+	.string	"\021%[O\365Q/\345Q\264\373\005\327|\030\016}\252Hx\177/U\027y\212\242\207u_X9\253&E\177o\324\225rh\303\335\251\016\272\235"
+	.ascii	"\0027\005w\b\274\341\322\353\324\367\311\215\352\252j\256\251"
+	.ascii	";\346\007\205\"\265\025\207{\346\rw_\026\227\305\263\310\261"
+	.ascii	"\311\331jI\333\f\224\032\226(f\270]\207[\270\266u\016\265pw\211"
+	.ascii	"\247(+ud\340\2121\205\201\315Z2\031\373{\225\234Ke\024(H\276"
+	.ascii	"p\373\030\236\275BV\305b\241\342\305\362}-\3715\23376\305\336"
+	.ascii	"\035\331\276k\264\246Gv\217l\027))\356\212\253\342\"]\346Eq\223"
+	.ascii	"\034z\217\354\227\266v\326J\343\334#\233\305r\361hV\004\306\350"
+	.ascii	"\356j\260\210\2359\331\\\213\327udv&\356\t\207^#\264k\364]\356"
+	.ascii	"\022\250\206\327\244\205\336\005\035\232<'R\244\322\333}\227"
+	.ascii	"\267(\315\211u\345\357U\376\236\234\340L4a\207\336$\316\002&"
+	.ascii	"\304K\327\001\215hY\315(\341\236)\332\303O\356^\310\361\341\006"
+	.ascii	"r\301\r\314\303V\213\335\342\320\013\254\336\237\300\007\304"
+	.ascii	"\214\016\267_\220\332\276>\277 m\240\023\334\300%Wl\036\3143"
+	.ascii	"\t\0269\233W\327$\016\251\b\016g\310\361\233\324\322Y*\266Jw"
+	.ascii	"LMX\333\214 Cp\333)#h-\t\362\367z\027Im\224\266R\340nl%\255\341"
+	.ascii	"\266O,\224\356\230\240\024\033@z\374\300m\235\300\004\351\303"
+	.ascii	"\002\365\3276\301F@\260\013d^\254\301\260M\272m\234\225\263s"
+	.ascii	"\034\370@\037\337\226\2776j\231\264\235\263K\262\235\323\240"
+	.ascii	"\231\263\322\316\325\354\345\254\254q\267\300\335\202\033fu\003"
+	.ascii	"\232\336\006v\341\226\342\026R\032\277I\037\212\247\255\022\240"
+	.ascii	"\334\333\035\217)\334\326\210[$\016\265H\274\016''\3632\210\341"
+	.ascii	"\001[\340v\257#B\304\276\325\270\243\301A\244\006\231-\322\366"
+	.ascii	"-8V\344\216\213\225\260\210\226\336\337\006\032\271\271\341\210"
+	.ascii	"\371b\263\233\242kk\3639\257\220\263\f\276\255$P\273\346s\226"
+	.ascii	"\031\302\336\336\235L\2204\207\332\264g\341U\031C\261B\341\311"
+	.ascii	"8\274\267/\334\026\315-\324\241\026j\255\2563/\311\334\340rb"
+	.ascii	"\3202\\\270\335Z\245gg\366\313\237\034\020$\351.(\346\204C\203"
+	.ascii	"\362\341\303\232\205\300\225\3741Q\264P\362\267e\230ee\326\314"
+	.ascii	"\241j\252\302\226|\231quY!\355\201\201Y'NZpR\2712\026\036m\235"
+	.ascii	"p\\|\304\375\265c\226\f\001kKG\226\314\356Hy \371Jb\251bN`U\265"
+	.ascii	"\260b\035\310\342+\022\013\343C\262\265\366\317\356\236\322C"
+	.ascii	"K\334_\253\003\370\024Sn\261\303\201\303~9`\t\353\r,?M\345\304"
+	.ascii	"\304`\372\n\353,m\277`\346\274l@\227\340\266(\330\032mm\264\r"
+	.ascii	"\333\205s\3168\\=\236\236"
+	.string	"r0V\023\n\244\024\332v\325@\261\270\311Y\256\367\322\352bg\271\354\326\2154\264\3453=\245\025\225\375\2657\\\313\214]\324\311\356\fw\177w\232\225J9g&\030gV*\232I\035\306=\247\233\306\255\023 \347n\235\020\344\2544\002\206\005w\261)\2452\344\206\211\346\274\254JF\240jiY\345\304|V\345\344\322F\262\202R\256J2\2379W\310\313e\262C3W`>\363R61\267\344\331Y\225\314\313f\256\220\227Y\231\201\271\254Zb>\225K\025\230\317\252\245\374\254\3126y\251T:Zf\245\n\371Y\205\227\237\315%\033\346\263\271\304|Vi\371\332\321\tdLo`W(x\f\3462\253H\232R*\331D\231\316f\226\222\263\243\031e%\002\344<\325T\222\242t\362\266\242\250\212\2424e\323\235IEV\315\274\2142\275\2329{\025\375\344$\r\222\316h\246\341\321\244\214\251\214d\2243"
+	.string	"\222rNz\216\346\234\2239\347\237\322\2243\347(\033\346V$\212\307u(\202\004=\307\241P\b\003|\030\0261P\302\004\375\243\201\030\200\022\"\212\253\320\b=F\020\324\021C\344M\377h@\n\035\211\305\240\324X<\256\310\035\265\207\b\210h,\356\034\221D;\023"
+	.ascii	"\001\021\031\215B\306\337*LM\020:\376\254B\306\237\210\241\n"
+	.ascii	"tW\025\031\244\006\245%\206\2048D\260\366\217\006\237\241\035"
+	.ascii	"\237\241\033\242\221"
+	.string	"\bx\204A\ngV\241\321g\b\306\3503d\177V\037\243\n\224b\365\003E\344-1$D\274\307u\310\366\250\277\036\025It\211*\362\327G\241\317\220\006\232\343\360\207xK\034Wd\321G\3750\201\272\016{\206.\200\304@bh,\2120\024\244\202\bRWd\211\022\204\022\\\016\353q\270\226@A\211\237\025h\250\206\200\364`\003\\\211\352\252v\240Q\217$\004\205F\n\254*R\375\3403DA\023\213G\325\250\372\340\326\200\203\004p\320\001\211_w\340A\006\036d\220v\007\036\360\360x\300\001\017n\016x\254\t\303\0171#\324\016M\364\031\006\331U\210\274\200\032T\\\361\332?k\321\350a-\032\213\367\270\222@4\022Q\240g\250~\360\031\212 A\317P=\336\376\321pT\201z\214\303\020nV\243\210G\n\211\352\007\017\020\207!\200\200\206\034*\024W\022\352]\221\302\342P\t\"\324\016B\017$\224"
+	.string	"T\211\306\341\2124\026\361*\264\200\207k,\222`D\022\323\342\020\322\"\205\0346x"
+	.string	"r\330\340!&%n(Z\242\020;\310\243:\242x\354\271\200\024\212`sTW\3440(\375\251#\206@%\020\r\005a\"!F\n; \211B"
+	.string	"U\241:T\002\004\222(D\314o\204\332\203$\n\221\252\302\340\372\263\016\203"
+	.string	"\020\344H\241pH\304\r\211\342q\035\212\260\n\035\203>C\020\305\225\304\004V\243\007cqX\001 !!\t\ba\220\302\021j\007\237a\020F\302p\350"
+	.string	"\202\3170(\355@,\256\252q\355\237\n\326\376\321 \024\024$D<"
+	.string	"\221\260\002\bAB+\222\210x\203\024\372\024E\030\2058\324\030\213@D\265\307\250\006\031}\212@C\032\36584\241\3478\374\231Q\207J\254H\242\020A$R=\366\364\f\205\304\r\305\232U\330\301j,\022\375Tbq\204\332\0234\"\211\302\342\020R\3503\f\002\256B\237!\b\241\342\317g\bb\035\":\036\325\325X\234YE\250=\027\372GC\005-4\244\036wV!\241\343\016\260G]U\240\241 !\016F\241\342:<\206(\002\r\211\022 \003"
+	.string	"\004$t\274?\304\2658\004c\302\260\204E\252D@\303\021)\221\020\031T<\202@\022\213ACc\211\016\353\217O\021H\204\205U\310\001\317j,\376\232\207\207C\206\013\214P\001L\324\200D\016\207\202\204\210;\310\243\020\322\250\"w\214\305a\320\016\361\210\334\321\200\301\204\341\321\n\035U\r\370\f\203~f\366\353\002\201\312\262*\2737h\366\210t\301\322\343y<Y\330\230\323\371R?\262$(&\217\034eJZD\310\254\224\224\355\275\355\310r)2t\244\030\2633\200\2700\372\361bWQ\036}4n\330\233"
+	.string	"R\267B\355\352\350B\361\314\201\302_\256\346\2729\332.3U\332V\314\f\273\032D\276\372\346"
+	.ascii	"\342\270\"\304\371\367\342\350\265\270\267/T\327\353\247\007"
+	.ascii	"'\365u\275nW]\024\f\007\331\033[\026\272\233\302\353\270\317"
+	.ascii	"0h\220\n\005\024\356\r\234\246\245\023b%\017l\206M\311\331\334"
+	.ascii	"\265\321\367\206wUya\345\357\255\321k{Gqm^g\245\245\312\234\226"
+	.ascii	"\226\375\302\351\022b"
+	.string	"7u\305\242$\261\245\200\325\215u\263\274,\257H\317\230L\221\323\313\371)\007;u\3518\272YV\267\312[\037\215\022n\027}\241\256\213{e\241\314\344dY^\361cC\022%O/3\237r\200=R\364`\362\315\276W}el\330\240\353\300\276\240(\377^\253\276UOqnw1nUw\214L\327\3253\007\036\356\004\340\262\246\245\245\277\027F\327\325\005\203C\250R\261@\307\002\2352H\241\021\231\031I\222tb\n\020\004\303Y\034\3071>\022"
+	.string	"\025E\216*\310\f\215H\222\024$\255\001_\211\211\312\263!\326Y\243BB\342\f\006\211\341%\2311\351Y\236\270E\271I\2351.\r\252#\216\022\345\007A\233\260|G6\213\224\245R\311\236\200\375\360\312\215\260\311\344\370\r\336\240\274\225\325\270\007\366C\227\352J\321m\264\030\017\177h\021\303\356!)g\312"
+	.string	"\023D\003U\b\310\210\2248\200\356[\332\221\002sY\377\350\211\030f\230c\272\253\t\030s\305\016q?8T\340\200\210.\0201\006\261\264\232}\320\037\333\215{\203N\n\254]\270\356\212\306xP\017\374B\217\034\362h\325\231\376~ \231\220?\346\236\022w\222\356\226\220\017\342\226m\030\332\305E\365\320:<\036]\350\227\272\304\016\262\030\242\247\307\033\024\025W\253\032\211[@\335\3258IN\0253\263\317\310?\236S\362\317\035\373-!k\354Y\360X\341H\306"
+	.string	"\036|\2275C\320\230]\351\002$\021c{6\271\330\241\300\345\301^\272\254}\027q 5\214\230-\021\341\323i\206N\345`\347\035\210I9\030\n\211vZ\230j?\266\031\032\003\f{\370\325\b\032\246]\352B\210\276\261\272\177\245\222\205\"<\335d\340\370\234\234Q\031\020\355a\2153-\324\356\026B\003vW\013j\334\0057 3\316@\254|\261\300\317\3742\300\263\341\323\224\201\224\216\006\036d\350%e+\341\227``qD<\266\b0\022\244K\026\334\177\013\027\243\3029\214\023\217\225\2002"
+	.string	"2nUxTw\275<\273v\237\027\242\301d\031\221gs/[\260\337\t\240\016'\255:\353\030\250\r\220P\312\\W|\346dM\267,FiLo;\023\243\200B\304\224\b\234\271\t/t6S"
+	.ascii	"\377\003f#\n\323f\270\376\003\274\030p(\365\377\362D\215X\375"
+	.ascii	"0.i\275vc\251\223NC\027p\355\226\353\3644S\302\351w\343\037\\"
+	.ascii	"2v\031\t\020\3144{=\225\322u\313\342\323/e\005\245\3137\327\350"
+	.ascii	"\232\272\210\323R\034D\207a\033#P\016\262`u\020\324s\005j\267"
+	.ascii	"\365d\324\217v\231\007<|e\241\373\311\346)\005\324\222Ib6O\024"
+	.ascii	"\206\223\231q\222w \n\024\r\203\2438\3335\216 \220\332\342\307"
+	.ascii	"\243Z?l\224B\267\262\210\031\n\340\234\207\203Vm\344\300\021"
+	.ascii	"\370\233w\273\340V\377\221\201\252\013\316\215\355-` !)\311S"
+	.ascii	"2\037*\247Y\247C\233b=\206\236Q\227M\337\305\346\022\365U\026"
+	.ascii	"]\314\256\024\213\207\310\204AX\033\241\307\220\240,\372iz\356"
+	.ascii	"\332\242\253\205\365\366"
+	.string	"\245t\314z=\332Jv\206\373\256e\266\372c\347\tZ\035G\315}\001u\236\376\237\257\360y4\\\261\207UJ\252J\3451\362z\330\023\004\n5\203!\016\330\245\"\n-#\212\017:\023iH\362\270/\377\345Iy\320\357\3511(\340i\t\f\350\300#\205\004\005\344-\347\225\235\274e\214\320E\347\201\2502];\200\246\2350<\005\236\232\205\203\224m\022\020\326\213\231v\317\021-\311\250\267EAK\351(\320\234\274\206\343\271\210\022\024wg.\303z\270\223B\r\301KZ.+a\003\304\341oA\312I\202\355\"\f:\3057v\370\303\026\216\227t\227\211Z\252\215\307a\240\360\355^w\tn\200\005xP}\373\f\245>j\f\276q\352+\003\254\031\036\356\353\310\347\355:\013\376\305\023\244\261:\225G\r\365E\361n\021A\034\026\024\366\006#\252\025\205q*\005\370\241\371\022\237`u\025\344\200\300\013\374\330!"
+	.ascii	"\237\311\323KO`c\322C\241\323 \330\235\003\024\215\372Y\333\241"
+	.ascii	"JO\327@\001\262\305\217!R\201\346\201\201\036\016\221\265\203"
+	.ascii	"f>\234\241\352\340\003\334;\214\352\334\327\0164\263\265@,\371"
+	.ascii	"\303n\003 \017\2442\017\t\267\254\2458j\330\030\370B\200HAy\322"
+	.ascii	"8l+\007\001\252^\337\301\355\005\272\360Mj_a\333\376\360\fJ\216"
+	.ascii	"\223\213`\3303\217fg7\001S\214\306"
+	.string	"\001/\267\205\260\342\246\036 #\001F:2\227\304\252\025\257Lp\243R\371\214\247\032U\363\371Y\224|B\b\017\205:\325pZh\212Gl\245\244\276\017@\253x\035\341O\304\370\327P\302\232Z\320\007U\036\tU\346\207\356~\017\034\236U@\213\020Yh\312\351\334c\213\301\027\206\206\273\260\f\372\2246\023\3112\340Q\331\220\374l\225\2145\030\214\301\251\013`\257-\036\250\3558\241;=\3150\367\002J&\303j{\244^\236`\321\003l\323\2661\304\003\004fD\331\317|\2149\210\336G\201\335\207\337\016\314\\'8x\240\022\030]#\277-\311\344\207\231\242c\225\300\020\374\031\031\252\243L3\206\265!\203\007\343\377\326\211U\222@\202J\314\nG\013\2765` \237g\242\342\313\215\323\006T;\303\021\t`\305\323\330\332s\247\337\2014i\025\330\326\374\342p\243\211\304\256\230\032\260\307D-\227 =%\303\250"
+	.string	"p\016TaW6-\363;\365?\226EzC\231\225\204\320\007.\004)%\322*@\373\3029HJe*Q\231E8\264\251\342\021\367)\307{\225QD}\027\001\335)L\244\255\313H6\005\2067\203\022rH\234xgp\256\307\343\365Wx\340\360\243:\253\265\335\217\027z\317\212dz\3574:lD0\025|\271$\f\257\223w\211\007\364\343\215\003\372=\260#y\327\260W\303F\301\372>\362\263p\311\005\203\363bA"
+	.ascii	"\230\200Toz\330UT\231\270\342\007!\236\250W\216\350\361,6\276"
+	.ascii	"\032 M\217\326V\350\227\t\342.\245\240\246\243UF\224\303\377"
+	.ascii	"\342\204^\027\312\272o%z\325\036\225\240\326I\016#\021\225\030"
+	.ascii	"\241\361o\304p\333^\377\0030\373\343\031\301\331\003\332\373"
+	.ascii	"\341\262b\377\211\277Gl\231\331\033\371\213\316<b\177An\020\244"
+	.ascii	"~\362\262d\263\316y]X\272\347\033\362N&o\202\257\320,\347\344"
+	.ascii	"\355\374\r\316\216|\273\300\351\037\035{8&=\365\256\020\337\273"
+	.ascii	"\327\r\307-\273\3335\024\177\342\177\210o\225..\037Cz]N\225\334"
+	.ascii	"l\306\020\377\361\262\325\336\330\330V\3754\027\007\211\214\366"
+	.ascii	"<\277\373\376\"\312a\271\177\371\216D6\205\355\253+z\321\037"
+	.ascii	"<\204^j\334\n"
+	.text
+	.section	.gnu.lto_.symtab.e992b2aad5b3a067,"e",@progbits
+	.string	"pgResetFn_compassConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\001"
+	.string	""
+	.string	"compassPreInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\001"
+	.string	""
+	.string	"compassDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\001"
+	.string	""
+	.string	"compassInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\001"
+	.string	""
+	.string	"mag"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\001"
+	.string	""
+	.string	"compassIsHealthy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\001"
+	.string	""
+	.string	"compassStartCalibration"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\001"
+	.string	""
+	.string	"compassConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\001"
+	.string	""
+	.string	"compassIsCalibrationComplete"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\001"
+	.string	""
+	.string	"compassUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\001"
+	.string	""
+	.string	"magDev"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\001"
+	.string	""
+	.string	"compassConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\002"
+	.string	""
+	.string	"compassConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\002"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\002"
+	.string	""
+	.string	"saveConfigAndNotify"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\002"
+	.string	""
+	.string	"alignSensorViaRotation"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\002"
+	.string	""
+	.string	"alignSensorViaMatrix"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.e992b2aad5b3a067,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
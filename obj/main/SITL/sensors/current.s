@@ -0,0 +1,858 @@
+	.file	"current.c"
+	.section	.gnu.lto_.profile.61ec920ae10c8157,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.61ec920ae10c8157,"e",@progbits
+	.string	"(\265/\375`N"
+	.string	"\235\006"
+	.string	"d\tB\001"
+	.string	"\026"
+	.string	"\326\214\251\333\n\n\002"
+	.string	"\002\001\002"
+	.string	"\002\002\001\240\342\234\212\n\002\246\201\307\205\t\006\002\003\267\235\363\261\017\002\002\003\002\004\004\006\007\250\335\362\322\004\004\002"
+	.string	"\002\005\b\260\355\222\212\002\022\005\003\002\003\002\006\002\007\013\233\346\244\226\006"
+	.string	"\f\242\233\362\205\b\020\002\b\002\t\006\n\002\013"
+	.string	"\002\013\r\016\270\272\250\266\013\017\215\232\327\322\003\030\020\315\232\225\331\016\021\022\340\207\245\357\f\023\262\235\221\362\004\024\025\026\253\327\227\253\013\027\231\366\331l\030\367\343\320\264\b"
+	.string	"\031"
+	.string	")\"\324\334\017\2615\355s\350\203\001+\004\332(\f\317\276\304\241\221\235\f\b\260\312kb:\354\326\316\324"
+	.ascii	"{@\310\340bfg\236\322\330\243\304\007\224\375\313\rvy\025`\b"
+	.text
+	.section	.gnu.lto_.ipa_sra.61ec920ae10c8157,"e",@progbits
+	.string	"(\265/\375 d\365\001"
+	.string	"\024\002X"
+	.string	"\t"
+	.string	"\001\001\002\003"
+	.string	"\001\001\007\001\001\b"
+	.string	"\001\013\f\004\001\016\017\002\001\001\001\201\004"
+	.string	""
+	.string	"\001"
+	.string	"\013"
+	.ascii	"6\t\026j .\207\254\n\353\214\241\022cf`\232w\250\f~\tc\003X"
+	.text
+	.section	.gnu.lto_.inline.61ec920ae10c8157,"e",@progbits
+	.string	"(\265/\375`E\001\255\t"
+	.string	"B\01722`k\323\030\300\203\205\301\217\241a\b\b\213\017\016\002\037\r\035\251nV\247&\240\213\253u\223\300\224\001\257\002"
+	.ascii	"g\251\037\007\342\020m\374~k[J\231\002o]\360G}\304\235\216\222"
+	.ascii	"\013\r\031\007\305\222\243\343\001\202\340W}\276\212\222\030"
+	.ascii	"\233\b\215\376&\277+5>\235\t\367\304\362\022-2*p\312\355\007"
+	.ascii	"\300,\2322a\210!\263\361\221,\020\360\357v\031\265\253vW\272"
+	.ascii	"\251\344\354n\001\224\210\217\024(\345\206\225H\312\r\335Z1X"
+	.ascii	"R\330]\313s\216h\271\351`<\022M5\035\214\207\372a\351\240\037"
+	.ascii	"\217\277\276u\231\334\326eIs\327\242|EP\211\335\035X/\335\335"
+	.ascii	"\325\214\316\023\362\330#\0373\275\330\335\367\220\363 . `\002"
+	.ascii	"!D\326\016\013\032o[py\025\3720\032\020S\330\332\256\210\222"
+	.ascii	"a\215\357f\322-\333c_\304\352\355\300x\023r\236\360\2700\260"
+	.ascii	"\b \2464\211\300\267\375\310\345\313\025f\237\003\213#;\346:"
+	.ascii	"\025`\321\324\bNbD\007\267?[\327\020\220XV\240\033^\374\341\255"
+	.ascii	"`\277T\321\316\356N\333pj\230B\302hUsn"
+	.text
+	.section	.gnu.lto_.jmpfuncs.61ec920ae10c8157,"e",@progbits
+	.string	"(\265/\375`\020"
+	.string	"\005\005"
+	.string	"R\210\033&\2205I\007\227/\216\330\263\217\325\027\375\252\177\265\037K\241\231\325\335\336\217-\365\002\333Z7{\370\237\250Md\222\001$\257\177\326\366\f=\345\253$\314\3521\275\243\177[k9\207\302\200Y\300e\006\250\222'\356\220\177\334\271X\232\024\300\016\201\b\364\220\212(\032h<\017\003Q\273\033\365\215\352tj\0207h&MF\246\266\227\236\004n\001\024"
+	.string	"\"F\326\025\006\323\235\202v@`\200\t\324)q\231\303L\313\031\016g\020J\r.\207|"
+	.ascii	"\027\361\031\005.\036%\030V\205\2542d\001\334"
+	.text
+	.section	.gnu.lto_.pureconst.61ec920ae10c8157,"e",@progbits
+	.string	"(\265/\375  \001\001"
+	.string	"\034"
+	.string	""
+	.string	""
+	.string	"\t"
+	.ascii	"\232\004\002\232\004\003\230\004\007\230\004\b\232\004\013\230"
+	.ascii	"\004\f\232\004\016\232\004\017\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.61ec920ae10c8157,"e",@progbits
+	.string	"(\265/\375`A"
+	.string	"\325\004"
+	.string	"\222\006\025\037\220+\303\001\377\277\242\372\377\217\375_\235\276\353\246qR\256\353\272v\376P\331\337\265\277eJ\001b2\232K@}\210\303\324d+\231G\346\220\315\307\320\223\036\001\006K\301\261ml\372@\306v\013\220\343\274\330H\227k\352\242\350\256\342\304V\355\315\022Lz%\036"
+	.string	" \013\311\030\254\241!\300\0216\001@\034\036&@\\\315\013\260\213E+b\366~\300\210\341\002 \\\024\024\236\020\024h\222D\303Zp\322\262e\265\004\n\253\200"
+	.string	">=0j\022\304m\t\376\022\310"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_.lto.61ec920ae10c8157,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_currentMeterSourceNames.26.61ec920ae10c8157,"e",@progbits
+	.string	"(\265/\375 \344\025\006"
+	.string	"\244\n\217"
+	.string	""
+	.string	""
+	.string	"I"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\267\305\257\001}\273\001"
+	.string	"\005\001\006\025\001\004\005\001'1\270\257\005}\276\003\005\001'6\206\b{\by\301\002\005\001'?\b}\304'D\206\bw\bu\306\001"
+	.string	"?\202\210\200(s3\307\0014\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\004MSP"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/current.c"
+	.string	"\004ESC"
+	.string	"\bVIRTUAL"
+	.string	"\004ADC"
+	.string	"\005NONE"
+	.string	"\b"
+	.ascii	"gH\315\323\216\253\266\346\231\007\310\334g\326\001j\277\001"
+	.ascii	"\024\001"
+	.text
+	.section	.gnu.lto_currentMeterReset.29.61ec920ae10c8157,"e",@progbits
+	.string	"(\265/\375`k"
+	.string	"\315\b"
+	.string	"FP<8@o\323\001XPvq\300\214\307\230\t\247\032!\031\233\320\004R\\\025gh\275\224}\315\016\365oWH\032\350\3540\214\016d\177\344\216\r\201]\3215W\372\264\355\336)\005)"
+	.string	","
+	.string	"-"
+	.string	"\237\366\354\230\207\340\236\004\2740A\355.\225\033\367\036=\377!\007\020\215@\217\233\206\335u\024\2152ny\333\007\266\027\354_\001~\351\217U\345\002S\200\262\213\221\232\331\323\\\351\270l?\332\3778\210\367\322\347\002\273_K\312n\250\340\004\353\323\341\t\252O\353\003U,$\317K6\036&\024\302m\211\217LX\273\313\340\213PT\004\200\034\237\376\247\372\234*&\222L(\246\354\020\024\245\206}\315\356\256\345\3475\353\262\3164\306\351\264\254V\017F\271\272qZ\306Q\r\342\241C\261\312Q\216\201\267\210\254\322n\333*\275\302\275f\345g\207\227SHZp?\t\017"
+	.ascii	"2\241c\034\030\027\006\\\003\016\242`1(\306Q\224h*l\310\004V"
+	.ascii	"0\357\022@\263\232\002\356\362\242\235d"
+	.text
+	.section	.gnu.lto_currentSensorADCConfig_Registry.34.61ec920ae10c8157,"e",@progbits
+	.string	"(\265/\375 \241\275\004"
+	.string	"\224\bj"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001\212\001\206\200\200\374\342\303\346\201\027\031\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\334\030us\347\007uq"
+	.string	"\005\001\006'\001\004\005\001\006\035\001'\001\200\002?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/current.c"
+	.string	"\004"
+	.string	"\236\n\013f\361\024u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_currentSensorADCConfig.36.61ec920ae10c8157,"e",@progbits
+	.string	"(\265/\375 &\025\001"
+	.string	"\320\031"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\031\001\220\003?\202\210\200\020\177}\274\001{\273\001"
+	.string	"\002"
+	.ascii	")C\017\240\b"
+	.text
+	.section	.gnu.lto_currentSensorVirtualConfig_Registry.40.61ec920ae10c8157,"e",@progbits
+	.string	"(\265/\375 \223U\004"
+	.string	"\304\007\\"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\303\356\241\033\007yw\250\366\006yu"
+	.string	"\005\001\006'\001\004\005\001\006\035\001\001\201\0028sq\301\001o\300\001m\277\001k\276\001i\275\001g\274\001e\273\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/current.c"
+	.string	"\004"
+	.string	"B\b\354\345\006\320$d"
+	.ascii	"p"
+	.text
+	.section	.gnu.lto_currentMeterADCInit.44.61ec920ae10c8157,"e",@progbits
+	.string	"(\265/\375`\330"
+	.string	"\235\013"
+	.string	"\026\226N>\020Q\225\016+8\264,\302\313\232\241f\354\340g!\230\001`\316\357\316\004\364\204B\t\267\223\333\320\200>0\222+\025A`\261[Q\004\262\b\342\220\234 \374D\005\317:\332\032\333&R\246\024;"
+	.string	"6"
+	.string	"?"
+	.string	"\371\364%\022\226\213\0024v1\2046\266\025Y l\177b\217\035\343\240i\257\3220R\325\330]L=\334\363\364\370\027\361\310G\372<9\024\354\256\363#e\270\365\266)\266+\366-\004w\213G\345?\035\354:L\273\336?\037\365\324\346\177x4\205.\377=\372\335\343\321\356T\310\177N\023\251\226H?6\bJ\355`\377Z-\331\232\216\232\2764\255\231\016\341\f\033\002&\377E%pA?V\365\352\033\f\t\355z\224K/b\001\312\320\251\252\006D2\256\251\037\335\260\263\2534\310n\b\201O\342%\"d4\232\307\343\365\300\213\025!P^\206\216$\200\316,\234\215\306q\235\f\353\270\255\333h\035\266\311`$`\031\327a\226\001\336&h\034\306\3316\016\233\200\336\257\325\322\002\025-OA\026\220Q\177z\212\013\344\304Q0hp\2718x\020 \275:\007\030#\300\004a\026"
+	.ascii	"3\241\005)\360+z\027\310\004\f\004\311\240{i\226\005\3420\225"
+	.ascii	"\211\244\222q\003W\246\233\313\232R\255\0050B\\\345\343\232\310"
+	.ascii	"6\004\3752\004\270t\213v>\001"
+	.text
+	.section	.gnu.lto_currentMeterADCRefresh.45.61ec920ae10c8157,"e",@progbits
+	.string	"(\265/\375`T"
+	.string	"\345\b"
+	.string	"\266\220>90%\2511\200\003\250\311W2\263\204\241\020e\365^?.k+Z\214\006@\024F\332\245\344\017\331wr\255\275\3050\307 \r\252<\276\251\353\261\020S\350\226\261&\367\226)\005*"
+	.string	","
+	.string	"0"
+	.string	"\004\035\313\206m\216[\"\267kd\303\005\373?\263\020\207\216a\355\025{R\252\223c"
+	.string	"\304\377\306\224j\345fn\233\320\366\241-N\326\376\277\031\253\325\266\016\032\005\233\237#\026\340/)S\262\265ul\215\342\224\320*\246z\376\017\230\230\377\re\020\260DpA\307Rs\250L\343\363\213\313cRs\262\340\226d\027\223\301\315\177\207\232\305-\0305\211e3J\321)\313\272\324\261\334V30"
+	.string	"\250\030k[\247\230\201\264\001`\004\007\202(F\023\340\007\262\030h\350\003\2128\317#\205\346\347u\237\210\373\246\250\002t1C\3367?\007\355F\2347\301\256\363\346\326\272\265g\254Jx\274\002\f"
+	.string	"2\241\343/0.\f\270\003\214\333\224$3\225\200"
+	.ascii	"\363.\001\020\253)\340./\332I\006"
+	.text
+	.section	.gnu.lto_currentMeterADCRead.46.61ec920ae10c8157,"e",@progbits
+	.string	"(\265/\375`M\002\025\021"
+	.string	"&\337lE\360\322$\0352\343\363\374\253]QC\330{g&O\266\217\206\367g:\374\263\327\205\306b\276:p\033\217\215\n\302[\024l<\2260\321\3348\255"
+	.string	"\037\213\n\364\214U\321y\203\251\"77k\203\265\266\367\2262\245W"
+	.string	"R"
+	.string	"_"
+	.string	"\033\033\261\b\352\320\261\207\304C\324\r\304C\267\354\034\217\355\354\203X\324\004\355\330\335LA\274\365\b\237f\313?\225\354\356}\016\240s\305<\342\034n\320\220\357\346\372\024\344\020\335\bp\321\274\220\243\017J\367yrp\315d\236Jv\327\331\271l\356\323m\257\330^`\347+$\376\211\377d\360y\016\315z\311w\207\376K<\274\202\330 \301zd\262\311\216\305\244\276\354\277\335]\253\216\375\236?\300K\307\227\206\232~\231\326Lg\246O E\342H\204i\267C\223\2175\2022D\244l?\355\227\270\211\326{`^`Wg\b\306\006!\272\034#\325\227\023\374$>\255"
+	.string	"\204\203&{\330\237q\032'>\217%\240\344;\224x\370\024\376,\301<\250\332\023\036\203\302_l\r\222\234r\027\253\221\244\303\026\252\003l\224`\251\266\366\025\271d\341*R\244\246F \361\270\332*G\021ta\005d\207\007&\036jQ\247\303,\007\332P\273\033\234\346\242\261@\257T.-\032\307\275\2542\026\267\261Z4V\326\242\222\302\222\2558V\246B\340\r\203\306e.\333\306e\251\330\376\255\352\330\001\314HFgbT\275\210(B}\371B\177z"
+	.string	"\207\351A\265\375\032\037z@\302\300\267\361\033\020\"\230\230\304\303\274\205:\035POE5?d\262\351\0170 \260\002\021\241\264\003C\241\213\213\341\021\352\336\315\314\226+\2263\003\033"
+	.ascii	"\303.\215\223\214\347\267\240\024\336*\342K\b&\352\201%M\256"
+	.ascii	"\024\213\355\034$$\203\207\341\254\207?0\017\n\300@\345\305\031"
+	.ascii	"\276!\026[\302\204\375\244\3707\302\267B\226\r\204Q\222\256-"
+	.ascii	"\330S\304\220\337\335`\326\035V\263\030m\\Mqg\0213\246\024\013"
+	.ascii	"\n"
+	.text
+	.section	.gnu.lto_currentMeterVirtualInit.48.61ec920ae10c8157,"e",@progbits
+	.string	"(\265/\375`\002"
+	.string	"\325\006"
+	.string	"r\r02`M\323\001\300.\205\203\254\373"
+	.string	"3\004\250\3114\340\341\n\004\347\n%\326\261\204\217\035\320\354E\360\327N\tR\206\004K\262"
+	.string	"[\242\363\216\272{H\231R\216 \313$Ax\211^\005\251j\222\2527)$,\274\bV\017*0\305 \301g\241(\370\036m\257\032\204\222\r\243\020vr\340\376p*\277\3065\213 \333\305<\372\033\347\270\370\027wn\260\362\361\316\267\234;\333\341!\037\235\035 [\204b\266\206\245V\330\007X\325\330\372\220\204@&\273\023)(\2739\017\f\333\177|\331#\327\262\375FDbs\262\273O-~=/\377\031\027\210\031\354\031p\260\273\316\230\241\270\365\266\rlWlg\001\b"
+	.ascii	"3\001g8\203\004\3365\256\211d!\340\227!\300\245[\264\363\t"
+	.text
+	.section	.gnu.lto_currentMeterVirtualRefresh.49.61ec920ae10c8157,"e",@progbits
+	.string	"(\265/\375`\036\004\335\033"
+	.string	"\3662\262J\240\230Q:\301\352\365R`\342F\222'\001\206\257\200_\214=\204\025p\002z\367\035\316'C?@N\336\336\370_'LQ;Pf)\345\207\261\032-\360\r\270\366\205A\377\222f\274\220\f\305\245\021\367\352\231m\204\020\"wJ\001\227"
+	.string	"\216"
+	.string	"\243"
+	.string	"<<\256\024\364$\343$\271\\\264\203l\227\213\324\305F\272\2050u\027\003*G\207\320\201\005\\\\\221\260\324n\360"
+	.ascii	"w\240\020\354V\240r@\325\n\\\340\b\254\213>\265\237\343G\270"
+	.ascii	"\377nn\325\n\203\210\217Z\353\002+`]4\360\001\343\305\3602\343"
+	.ascii	"E\343\354)\007\372\352\203XJ\004\257\324Zc;\343\270\217b\270"
+	.ascii	"\024\347\223\023Z\274\336\320GW\217\305\305\025\017I0\355\350"
+	.ascii	"\276\364\316\320@\255\365\301S\023=\035\245\344\204Z\253)\257"
+	.ascii	"\227\342&o\273\307\266i\207\017\002b\270\205G\365\245+6\225\260"
+	.ascii	"\362\207;\365\260j\335A\360\233\336#\204O\343\242}Jz^9^\374:"
+	.ascii	"Pbu\343\227\243W6PG\267\310~XW\206mH\352\032\222\032FR\323\374"
+	.ascii	"\367\023X\352\031\222Z\346Kw\314\221~\001\327\361\303\034\370"
+	.ascii	"\007X\352\327\221n\327R\267\226\232\265\324\344R\217#\265\270"
+	.ascii	"\324"
+	.string	"\341R\357RS\221\3727//\222\304\242j=q\245\245J\211@j|\351\366\223|\246%?\261\206P\260x\314\340M\325Z\023\\tN\254$W\222\243\2433^\224\331+\235\036\251\360\021\035\375\242n,$\255\r\222T5n\221\317\364\326T\224U\230\340\016W\300\272\326\204\3152rCP\344<\252\231\245\313Z\361\310ID>!wfo\230\2348b\226\224r\032\211;.\271\205\303\241:\f\0217\302\216`\325/\027n\314^\312I\324\340~\032w\303\265\t\2368\\\353\332\335[\331\030r\032\351\350\225\270E\017W\206\220\303\354\213\026Yh\255uh/4\006XX\013+;\242\354(\026\323\265=<\310\255\300\223Z+\004\377\307\201\310f4\332\370\265\322\234\311,\2304\033\017O\206\027\240\322\304\251\225f\211a\347\207BPy\201&\3024\313\032\b\223f\207\346S\223\211&\005\232)\333\001\322`\332d\""
+	.ascii	"x\306\300\374\241\325j#f1[\255\264\375"
+	.string	"\320l\261\237\036\231OlV\263\305\030\334\270\004\242\325bfY\326b.\300\334\303\007_\201\212T\325Tnu\266\301y\224\333\313\007%G\307f7\370\242N$5\353\304N/_\023Z\205G\005[\231\255Y\261\351$\3229\375G\205I\252Z\302\325\225\322\256\326\334\001\232\205\355O\243\327\322l\315\3239E`[\373Z\362\310i\244S\262\206/qQ\250Q(E\225Q\b\ndF\202\314\322\302\214\001p\002\2212\253\016\020pFCI\306b[\326Z\211=M*\210\345M\260\202\307\020\206\021 q\371\263y\031Y\223\377\006uu\373P\267*>\250\277\035\351\254f\221(\270\3075\253\310\311I\255\032\205i\215\263\315\r\305\231\247\203\241\\\207\bT\003/cj2C\026\372\220G#\346LS\201Ax\304(I6\f\3706\002\220\205A\2246\245_x)\036\023q;:\314\215+@\224\362\222\345\332\001\312/"
+	.ascii	"\331\2248\305O\304V\256\342]\325+\264\251\n\201NP,\272cM\031"
+	.ascii	"'>\267\235\360\007"
+	.text
+	.section	.gnu.lto_currentMeterVirtualRead.50.61ec920ae10c8157,"e",@progbits
+	.string	"(\265/\375`\330"
+	.string	"\005\013"
+	.string	"F\024JA0\307(\035\220\313\313!\3373n\316\237\344\357\325^\374\354\352:\004\254\220\201r\306\215\251X\206B\204h\r{\036\342\177\320\312\206g\b*\002N\r\300h#z\207\201\004\311\005\360\345\223\310m\367N)4"
+	.string	"6"
+	.string	":"
+	.string	"\226\320N=\376!;\325\356\220\235\032\264\035|L\355\001\234\220\260 \354n\235)\007/A\377/W\bO\245\313\004\214\335\265\fO&\367\274\355\b\333\024\366E\002+\321$c\366X\222\023\305\276fw\327\023e_\3745RZJ\351k\013+\f,\f\354\226\304\"\354\213\"P\331\330\276\264\337r\027\360\"\351\r\273(\005\007v\307\211\003<\025v*@N\006Wk%v<\200\306j\301\247\375\371\f\013\244\343\244T\244\354t&\b\037\370\3432\237\266\273\025>\314cD\276\352\324!#\371\360\324\037e\247\237\034W\201\036\027\342>\324['\004\342<O\264\325\317\353>\020\367U\220g\343S7\357\253\035\bw\036\234WC]\347\325\315\270\327\354D9\203\345e\232#\226\323\336\336\222\r\270\023\370.`\346x\025"
+	.ascii	"2\241Q/0<\250^\320\206\260\007\017&\233\n\201\020\260<\310\r"
+	.ascii	"\336q\024\035La\243\224\364j\202=\0251\244\272\273`\324%\254"
+	.ascii	"f5\032\334\345E;\311"
+	.text
+	.section	.gnu.lto_currentMeterRead.51.61ec920ae10c8157,"e",@progbits
+	.string	"(\265/\375`\252\003M\030"
+	.string	"F\252\226H\260\222NcX{{f\233JnWZI\254\004"
+	.string	"\260\211\332\204Cp<\304A\346$\177\203eq\n\241m{\013\310\330\t\206\311d\022\370\273\241\346F\222\031\352\211\341\262\005O\357|\204\220\207\307\033\244\311\336[n)S\n}"
+	.string	"y"
+	.string	"\206"
+	.string	"\326\304\363\324\376\322\231~o\312\361\355\336 -\252{\211'fp\336\"xIyK~@y\353\237}vb\321\275q\253'j\355\336\233\253+\376\373i\226\226\254\364\347\027_\"\243\030F\343G\347\347\245NQ\214-)\231\007\n_\366\204\240\326$\bHx\362`$\204F\036ZI\005\303\255\022\001~@\220%_Be/\236\212\370\331\241\324\214p\3575\r\376"
+	.string	"\335\267\333\026\332n`W\253M@z<\213\340\320\253V\242\221\347\224\257\177\202\341\004$\214\214\207\016\261\211;\264\022\331\257\307\343\361\350:d[j\234I=RR\337J\352\263\2446-\265\375\323_\337\364\237\300\221\320\326~\254\370\270w\304\261\355zY\253\026\266\357\317\270\321\346PN\3206Lac\343\242.us(\0270z1\\\272\367\342n\355\033\033wKq\266)\361N\277?\341\234\344\336\241\266\334\371\017\373\016\n+,,\345-\275\261\312\333\007\323l5\271z\212<8A\304\2074yK9R5\024\257\343]-\276\221+\270\320\007]\312\333\221j\237\314\224\204\267\227oYx\016\036\004\243/\034\007\206\223\261[\255[\025"
+	.ascii	"T\246t\302<\213\232\305\374\306\325Yq.\304\330\232\254{\025\017"
+	.ascii	"@\021\325\207\235o\204S\336V\256`\332\215\336p\033\274\363\336"
+	.ascii	"\233\342\327\370\024\007\337\350\3262=\372`\257\2745+\231\211"
+	.ascii	"\244!S\276]\315N\306f\340Q\353Pjfv>\237\007]\216\306\327\243"
+	.ascii	"\231\331\321\344fx129\235\217&\207b\300\275\016;_\256\246\327"
+	.ascii	"\363\345pD\340\311[\274\n\022\032\033\032\260\356\220\367\336"
+	.ascii	"{\276\034\315Ve%\351~f\"a\255\251-\370\245\f\363\262#\237\242"
+	.ascii	"\341\222\032\220\036\337\265\3034e\036\240\265\332*\022\350\203"
+	.ascii	"&\253\216\323\322\204\256\312Jd\252\342Iz\304\240UA\276TX\034"
+	.ascii	"\312\307\304p\365B\216\272z\212\330z\260\363\230\220\342\300"
+	.ascii	"\001O\250q,\344\f\223\346F&hJ\n\222t\220\002\221\301b\007\021"
+	.ascii	"`\27163\263\205\225cb\302==\266\2742L\327\340$\274\\\352\216"
+	.ascii	"\224yAs\310\320\266\320\033\344Pz\013I\317\221x\202F\377n\275"
+	.ascii	"l\356\221\350\246P\336\300\374v\215\340p*6\021%\372_\211\006"
+	.ascii	"\253h}IKN1QVz\253\374\212\004\265\364\356\240G\246\026;P0\322"
+	.ascii	"\343\250E\365\302s;\027\360N\030\316\n\005in\241\036\005\226"
+	.ascii	"\251\361W0\362\260\261\004\202\220.\316\307o\227H\200\035\177"
+	.ascii	"\201Rj\362j\240Lr\253\342\364\374^\252\216\206I\314\250\001"
+	.text
+	.section	.gnu.lto_currentMeterRead.part.0.62.61ec920ae10c8157,"e",@progbits
+	.string	"(\265/\375`\360\001u\020"
+	.string	"F]gG"
+	.string	"\261&\035 \023\354\271\"\\\261f\353>\030\220\001\277\226c\224\336/\370P\310\375\310o?\375<f7\017[\221\276\206\206m\300\230\246&\233v\302\034\252j\373\250(Cq\304-\360\244X\326\005\204"
+	.string	"\251\265M\344N)O"
+	.string	"R"
+	.string	"Q"
+	.string	"\001vW\200lv\307\004\237F\240}z|H\350S;H\350\323\376\n\333\251\024\213\366\215\217-\373\031\235\017.\035\273\313}\352\211\213W\231\211\376\353!\257\016\327\307\016R\023c\203\006\204\210K\001\317D\017v\327\332\210{\336\266\003\333\013l\271!\341\213\307N\207\371"
+	.string	"k\245\262\273'\3733\247\2617\227\034f\002,\025+\026\273\273\225\250\337\"\345\277\274\331\276L\352.\023\031aU$D>\2551w!\336eb\217]\0239\n\264O\003\331f)?\246\016\203\0320n\210\024Ki\377\345-\3610\250\007,T\350SwNr<f\f\217\341i\273\313\300\2779N\006\237\365i\322'\177\362\205>\257\217]\372\250\364\254^Z*\031$\225\305\232=[]\261E\322\372\361\227\"\351k\"(\037\253]\224 \240-1oP\\\346\267\357\303\270Mx\2303\0349\001\027<\tv\246\2164=\0321\225:\020<\215\270\020\374\302R\027r%\217\204\304\215\300\220\033)\340OC\007r\246\357\003\271\355\257CH\361\263\343G\245\036\254\252,\266U\302y\244\017\205\357x\rb\256p\035\013\\\317g\r\325\017\234\032\227\026\311iLp\341\361\3503<"
+	.string	"-28t~1 \220\002\021\263\343\006"
+	.ascii	"\nPs\017\022\201tC\3723\246`x\234\330`\255\301\341T\201\006\314"
+	.ascii	"^nj\243t\216\002\202gkN\246\300\006\017C\270\033B\210<0\302\037"
+	.ascii	"\203\214\212\022\b+aJ'nS\320v\327\275,A\243T\366d\212\275\332"
+	.ascii	"\377H\372c\350f(\302\220\307\313\235\244\325nc\312\032\003\200"
+	.ascii	"\366F2\033dZz\302\033\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.61ec920ae10c8157,"e",@progbits
+	.string	"(\265/\375`\025\001U\b"
+	.string	"d\013\021\002"
+	.string	""
+	.string	""
+	.string	"\002>\177\036\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\204\202\202\200 "
+	.string	""
+	.string	""
+	.string	"\005/\022\201\204\001\035\177\037\272\200\202,\177 \005+\020\0057!\036\016\200\003\002-\177\".\177#8$9%\0020\177&1\177'%(\0022\177)3\177*\377\377\377\377\003(+\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005&,$-setdata"
+	.string	""
+	.string	"\005\".\037/ 0\0341\0332\0323\0016\1774\037"
+	.string	""
+	.string	"\200\200\200\0015\17754\1776\003\003\033$\003\003\032\304\001\003\003\031\344\001\003\013\033$\003\017"
+	.string	"\323\243\362\362"
+	.string	"\001\342\007"
+	.ascii	"% \260\002)2z\030\332\032\272\016\222w\030\252\207g lYZ!\302"
+	.ascii	"\0306r \016\234\214\251\214\2012.\343\365\022\362\235\2027\216"
+	.ascii	"5k!\234\373\311\003\356\217\302\004h\365\210\026x\370\302\177"
+	.ascii	"\343\353\261\301\240\r><K\006\272\341\275\306o\324\004\343\t"
+	.text
+	.section	.gnu.lto_.refs.61ec920ae10c8157,"e",@progbits
+	.string	"(\265/\375 \2335\003"
+	.string	"\242\b\026\032\200\265I\00730\00330\0033P\304\343\343\267\265\247\337\324\255I\333D\246\024\016fXa\004\263,M\031\202\3268\364\224V\351\312\344\b&\300{x\227UY\223\027%5\357\311\200\341\017\331\204\026\241-\016%JMi\034W{]\314\342\314\021z\315\030k}\235\032\020\003"
+	.ascii	"\237\020\254\317@0\033\3142"
+	.text
+	.section	.gnu.lto_.decls.61ec920ae10c8157,"e",@progbits
+	.string	"(\265/\375`5(\335\260"
+	.string	"Z\027e=Y0JQ9\351\331\003b\367\310S\001\245=\020\316%m\3079)l\340iA\201/\t<\316\344\360\322m\307p\234\216\376\346\r\216\023\030+YW\212\217\032pF\330ov\373\366g\313R\007\332\252!y\016\217a8D\214\33441\\\363\222\026\022\302#\365\031\022\321{K\231\0023\003\316\003\343\003-p\033\257\031oEC\026\207D\336\233\024!\242gG\023-jB\330>\262\006\223"
+	.ascii	"9^\347s\210\234\317\301q\336\336\235\267m\347\255\226\030-\303"
+	.ascii	"gM\312\214\225(1\260\032\006;\255\001\302\244\355\255\216\263"
+	.ascii	"\211\355\202\225\375\3426\3121\351S\2078\324\306B\230?!\314["
+	.ascii	"\030\347\253\233\363\325\314\211\201]s\034\276;\3331\234\036"
+	.ascii	"\"\333\331{\207\314\026\360\230-\310A\273\032*M\373*\346|\025"
+	.ascii	";=\250I\316\327\252\363`\254\301d5\274\206\225 \230\315Y\216"
+	.ascii	"\347\2363L\336d\033\211S\245\3468\317 \314zw\307 \314W\027'\020"
+	.ascii	"k0\233\f\315\371\356r\336\355\312y\271%'\020\035k0\337<Nfc1\254"
+	.ascii	"\364\300c\236\001\007\257\302(\327\353\336\344\217\217\035\227"
+	.ascii	"\335\233\266\357\033\347\331\203\311w\354\301|\023\317\017g0"
+	.ascii	"\036~\2228\234~\264U\273\020\246%\t\326\326K\320\231\245\303"
+	.ascii	"\350\203\315y\r\240\210yQ\331\222\305O\266p\bX\no\347\336\252"
+	.string	"\261\254.\314\205\323X\311[X\213\210 \333C\016\253\351\264g2\347Y\313\3713Ze\232qLb\330\321R\344\312\027/3\206\302R\352W\361\244bu%\307f<\205\305\352Wq\247\206\325\221,|\306J6\343\2613\031\227\021E\004\345\0341\373\2622\355\327X\203\331\303^'\226 ^S\2334e\333\363\361<?\251\3621^\003\343,&`\344\356\275W\330\n+9\214\301\316]\354u\233\274\027\354\336{\r~\241s\030Sa)\035\232\356\255\342\261!\212\024\030jt\367^\021A\"x\226ph\255\231\366H\347I8\337\200\363\b89\311_\254<\032/\317N\370\311w\210\311\273\274\367\3760\021-B\"m/t\236\243|\202\341\275\034\234\347L\341\336{u\370h\346\373\374\300\032L\313\031\314'Y\203yr\006\223\003\022\374\255\345\347\r4\211\240\007\340\357\262\233\375\347\257\033\036\306\n\370\031/\240\251"
+	.string	"\177_\360\r\177\375a\025>\206\252\312\317\027\004\235\303\337l~&\361\363\210\271\237[\370Y\204&@\017\340g\273\026\300\317a\332\202\277\201~.\241?t"
+	.string	"J\370\337\341A\177\26755"
+	.ascii	"\376\n\202\237\307~\026\373\331\354\177\375\253\220\237\221?"
+	.ascii	"{\375\334\3653\327\317K~\336\372\271\311\317O\332\303\317U?k"
+	.ascii	"\375\254\244;\374\007\372\353\326\177.\377\267\374\357\322`~"
+	.ascii	"\236\373\273\202\277)\370{\303\337\023\374\235\341\357\b\376"
+	.ascii	"\353\374\265\355o\f?\337\375\\\367s\232\237\337~\036\363\363"
+	.ascii	"\332\317_~N\373\371\354\347\257\237\241\374\274\342g\031?7\375"
+	.ascii	"\f\343\347\373\263\n?\177\340g\017\374\234\302\317\351\317\300"
+	.ascii	"\237\177?s\340\377\b\377\261\374\254\201\237"
+	.string	"3\3603\006~\356\340\347\003\374\\\302\317\027\370\357\345g\022~\266\300\377\345\317\024\370Y\002?\217\3603\212\377q~6\361_\204\237\031\3603\002~\366\340g\f~.\361s\210\377_\376\253\375\317\362?\305\377\003\374O\373\317\273\273\273\273\373-\322\257s\366w \023\235\346\274)\310\352\274\220=MZ7\302\260y\247\311a\323BbE\307\t\007\327h8\270u^H\035$G\340\310\210{\243\331a:\303\264\2310}\306\274\227\223\307\247\3425\026C\374\375\366>\323mkml\300\364\332\233\355l\355v\n\357\345\260#i4\206\340i2\006\212\2332o\267\307\365\334\353u\357\355`\206\321\rQk\333dZ\212\375\261\214\203\321\366l\272\355\377\016\217Uri\255m\217\301*\303\326\345e\347\216\r\023\264\266\312\026\303ZL.N|\260\2719\177\2029\377\376\315;,\336{k\344$oq\251\347\234\303>\\Y"
+	.ascii	"\377\355\275\006\260\300\275\303+tkN%c\303\035\037n\316\332\275"
+	.ascii	"\304*!\003\252\240\210URL\313\252+"
+	.string	"$\"\021b(\336*!\323\362^\f\227H\024\2428^\fL\313\013u]\260A\361MV\t/\361x1\\\342\035~`\"VA1-\207P\030\230\226UPwYu\201.qXl\"\336\"\206\273\254\232\273\313#\024\020\323\362\b\305\264\254\032\302vMAz\324\240B\007\344\211\251\230\210\227\206\323\324\260\b\264\306\224<^\267{\031\354\305-\n\340\336\251c\321m(\305dKk4\226\256\f\217\314\301i\311\352x\211kLZ\307{\265\226V\\\247\r\204\311\265K\204\327\204?\246\356\214\027\367R\340t\257\220\357\332\275Wx\357\325)N%\357\325\001\304\224\345\344t\2571\310\351N\t\313^\334\333`odPLK\253\243P\331\224e\326\205\221\024r\326u\253*\236K\341\327\235\241\346\314\202\212J\303\253\023\363\344\246m\222\207\254G\025\033if\354\210Tx\234\\j\332\030\325\351t\262\262\265t\231Y\214"
+	.ascii	"\2203r\347\335\nfgk\316\316\312>k\264\034\246;T\362\341\3148"
+	.ascii	"\202\335hQ\302\265\315r\305g-K\334P\355\274\016\230YY\2306oT"
+	.ascii	"\3326Y\307\220\021\247\353\310\024eOi\261\312t\207U\030le\325"
+	.ascii	"y\321\335bq\004\005\312<\221j{\235a\225\217m\261\222e\245\251"
+	.ascii	"|\354\210i\246\350f\352J\207\261\262\2554\030\330\016\027\025"
+	.ascii	"\362\305\230\363\346\226\363\246\331ys\251\354e\316\033\026\021"
+	.ascii	"%J\224Q\304l\322\212\2222_I\037\270\255\266 m\241\364\023Vv\262"
+	.ascii	"\235t\362\336\345\\W\223d{\365\026o\bt\211K\\Y\"D\350\334\255"
+	.ascii	"\340B\214io\3428o\026\317\233MM@\234\304\2630/.$\nF\343\223\266"
+	.ascii	"o\344\026\0377\360\242\244 u\264m\255^\302J\016\315$\315\220"
+	.ascii	"%\250\2667\205\247\n\3672\007\223\357\356\230\203\331+\b\275"
+	.ascii	"\225d0\213\306\344\005K\200\221\037M\332\326N\302Ag\253\314G"
+	.ascii	"\220\316\312!\"\221\252\232\321W2\2164V#ae_u\221\263[\033\271"
+	.ascii	"R\326W:VN1l\364\225 W\353\264|s\336\316\277\211\264\024\217\253"
+	.ascii	"\311\2247sEn\303\313\271\367\350\226E\203\333\360\332\020\006"
+	.ascii	"x\275\311\t5\365\214$\032N\303mj\222\354\204\241d\222+c\206l"
+	.ascii	"8v\343\220tkd\270Mh-\016\211\024j\247\00449#\327R\275\324L<b"
+	.ascii	"\362B\361\260\270\241\3436^\275\267\207\335\333\231d\034\222"
+	.ascii	"\256o\013\331.+\016\211\254{\303v<a\362>\231XI\r\240\302\344"
+	.ascii	"\342\220t,\300\311(\213\023\316m\220\344(\364\226\352'n\303\033"
+	.ascii	"&oQ\007K1\016I\3677\216\256\352\037\335\243ut\216\006\322>\372"
+	.ascii	"FO5\217\266\352c\007i\252\026\322\306\036\322;X\331R]\343\035"
+	.ascii	"\3256\316A\030n\343\t\201\356\222\230\247\254{\223\354\366g\300"
+	.ascii	"AKqmk\234\217]\354\313\315\310\334\3715_S\353\202\272\212n\246"
+	.ascii	"B\360\b\231\"C\243\205\327\272\377 \355\302n\264\255l*]O\024"
+	.ascii	"\025\335\030\235\233\232\344\212\206\024\0266]qK\265M\2035\034"
+	.ascii	"\r4p\306x\211\030\227\0251,\374,\3244;Lv\213\232\\Y\032/L\346"
+	.ascii	"z\320 Y\003\223\34412"
+	.ascii	"a\251r\177E\323s\274\227\230\263\246\311\211\016M\215\353\262"
+	.ascii	"\021\344\310N\331\233%7\332\262\023\241W8\373\243\315\323\na"
+	.ascii	"\347\253\033\3277e}\253nA\327:\025\353\274\220i\031)5]guk\036"
+	.ascii	"\022D/\231%\245\262\251\020\247J\222\266\257e\270\315\204{\223"
+	.ascii	"\030\272\024}\264\315@\350\225\214\211\314B\325\002\033\3271"
+	.ascii	"uLe\013\272\302\271\004(9z\031\301WP\242\356x\234\315\225\315"
+	.ascii	"Lz\365<=\0319\256\255\001\001\363\2113\336!m\317\023\252\251"
+	.ascii	"\325/[\310.<\215\305I\343\231e\0013'\006\3555\r\255B9\341\305"
+	.ascii	"\205 b\260\310\335\030\302\341\321\266r\251]\352\226\252\245"
+	.ascii	"\206\300G\251|\305\242\254g!\214C\033\037\270\344\370\fZ\034"
+	.ascii	"/m\315\222\313)Zsm\357S\344$\253c\254\254eU\254KG-\263\312\021"
+	.ascii	"\303\006\035\006\322Xh\301\264\367\201:\253\225ze\347l\206\230"
+	.ascii	"\251\260\013C\330\256\226\264\355*:^Eb\025\260\032\307\313Y\023"
+	.ascii	"\025\020\234\241\342j[\247\234/|\206 v\336\242\300\031i\373:"
+	.ascii	"\345\257R\370\255g\3540\242i\313{\022z]6\026XZZ\332\327W{i\240"
+	.ascii	"K\264zB\0267\365B\252\353<squz\355\301\312\352T\241\b-\335a\023"
+	.ascii	"\002t\221M\215\350)6\356\221\266O\222D\235a\0312\\\220\234g/"
+	.ascii	"\252j\305\302\2173Cj\021&`\344\200\324*\2577\271\255z\244j\361"
+	.ascii	"\232\021\350\022\305\350\344\352V\025\342\306U\235T\257\332\244"
+	.ascii	"2\251\310\332\305\312\272U\215\274\372\250\307\007\325\255\032"
+	.ascii	"\304\314\317\232.*R@\226\352p\035\226\230\034\360$NI]\302\312"
+	.ascii	"\252\365\240\252U\257\352\n\274fL\336\032<X\346\330\326\320q"
+	.ascii	"\020\341\223f\214\333\016s\205\232\344JR\210\232\2665K\307(\225"
+	.ascii	"\346\202\006\022VV\254\223\r\262\354\315\341\264\024\261\352"
+	.ascii	"\221q\276\307\305y\036\272\263\0229\333\344x|Is\236'\356<O\231"
+	.ascii	"\363<l\347y\272\234\347A\263\252U\313.k\276\324*nk1j3\226\312"
+	.ascii	"\316\016\301\031\314\252\243NU\036\377\316O\023\262 aU\316\327"
+	.ascii	"\035#\024\001\023\326\326V\343k\216\177\247\323\260\262\234\226"
+	.ascii	"\347+\216*\365\357\360\334\220T\371\362:_o\344\204\335\255\311"
+	.ascii	"\321\266\3328_\360 \001q\201\207\230\217\035m_m\374\365\211Y"
+	.ascii	"\250Q&\334K\364\300]\0347m+T\255\361\032U\213\267Fmp\274wX\243"
+	.ascii	"~\340\334;\374a\266\200\331\002\333\304\n\313\212i\317C\344\364"
+	.ascii	"\341\f&\223\t\275\322\340\371\022\0029(m\317\343\242\312\250"
+	.ascii	"2\202\324\334:/\272j\034+\302\235\177mR\326\246\366B\3029\246"
+	.ascii	"T\373\271a\274\336\204\325a\035V\030\347\255\313j\241\306\324"
+	.ascii	"W}\361\nc\207\006\227\266\333\266\272`)fo[H\332V\"\333%\361\202"
+	.ascii	"&\256m]b\273s\031u\265\274\220Uo\275\235F\215\254\316\213\356"
+	.ascii	"\3242\003\245\215\321\316\256\221\317!\336\037\310,\237$M\244"
+	.ascii	",\265\375\205\032pX\331p\270\215\243\334\247\0130\240\260\344"
+	.ascii	"\350\356\3352\302\306AC\206H\334YW\327h\332\256dyi"
+	.string	"\373:\353\322\246M\323\005\241\371\260\021\253\234i7o:\266r\215G\3304\243E\005C\271\346\254\3545\335\305\001\307\033\365A\311\3218\242\333\322\254\300!\231\233\013h\332KS\240i\257(I\211\002\337\0210\r\226@\213\224\220\210|G%\200A\245\022\023 !)\371|?\237N:dv\340\007\\\221\376|:*z(\222M\321 \013\224\205\351;\3525\300'\210\262\350\215\020,z\300\017\t\027\372D\021\232\002\177IIJA\n*\360\020\034z/\355\025\245h\220w\002\205\t\244$\026h\t\005h\221\364;\021\2004\251\204QR\006\"\237R\b)\032\344\361\251\3504'8d\224\324\223\016\371\214\222r|FIuEj\344C\221L\324\003GA\033\f\242\300\242\242\236N\213\244\037\221\005\246I\265\b\365\031\035!\365t\212\320\240\222%B\203:\007\016\031%\221\360\001\366V\020\331\026\3004xd\204N`"
+	.string	"\033,\310\371\n\022%\212\220\216\224N\340\200\026\375D0R:\001-\3329\201\302D\206\025A\024\250\002\235"
+	.string	"\213\024\022\244G\276\007\234@a\"C\212\0061`@\"\005\366\222H\024\365\320\tl8\321\021\020\365\241F\3477\350\340\202\016<HA\347\036|\200\301\007\030\230\367\340\003!\241\017:\020:\337\201PM\323\240T\202\364+H\250(\341\373\261`\361#\252\200\003\034\034\022J\223x\2029@4E:\n!\355\201pDT\324\363A\207\212\036"
+	.string	"\224\242\003\212\324#\n\346\244hP\205\212\237y\002\205\211\t\276\202Dp\310\350H\205\357\227B\317w\304\"\202\016\244>4\210\002\223\322\237\217\003\021\nH>\350P\004\350\220\004(\021P\351\227\"\202\026\351\021Q/\251w\302O\332\003\241\002hP\311\007\351\367\003a('\230\002Q$\023'\320\240\222\004>\224\b\210\222\220\304B)\350\373\021u\b\036\005Q \232\006[\254\340\245C\035\b\235\250Q/E\372\241\200\204\204\022!!)\251\310\220\372\224~'\220\220\320\023-\200h\232\366@@\211\200?\025\032Z\364\220\222\202G\022\244\275\023\216|\214|G>`\317\002\023 \365\210\216\322#\340\t\340/\004\337\357(\355\001\225PlH\207<H}GJ:E\277# J\202\212$\b\030\365R\244\275\023P"
+	.string	"J\203C\2744\210\246=\b\360\202CH=\245\024xT\001\n\322\257\360\360_\022\n,\221\376~\300\022<!\354\004\207L\210"
+	.string	"DST\204\nL\2608\321\264\227\246\360u\240\007D\261\242\307\302'\035\312@\203\324w\244s!\241\023\037(0B\003N\"\022\251\017\005\002\225\210J\004\201\277\240\017\r\226\360\035\365X\224 \002\006K\220\350\200\032\365\200h\022\213\336\211uFx\345)\315\006y\020{\305\267xo\231=r{%\002\217\027:\332\332!\326\310\226\013,\243\021[\244\256\316E\021\213\017\016\267\345\023K\204\301\230\254\220\\m\255\220\247d\0329. -\306\203\225\305\230\346G\235eS\363\246\315\252\336\351(\031\"\357\252\2724\026\345U\r\252F\253wv<\242\216\026\212\267\006\345\216\210\217\366\"5E\212\313\366\250_xH1*_\226G=\343\302\344\206\210\235\262;n\231)^\252\330\035\277\315au\324(\023\304\324\244\004i\033\2025\2309F\251!\250$mmo\245\242L\210s%\003L[{C\350\026\007"
+	.string	"\260\240\225\265\325\2616l\224\016* 1l\324rGlH\021\271\266\027\336\272\260B\013U\311\364\\a\224\373\2443\306\345\215\r\272\313d\f\301\363%\343+\214\235q\013u[\314\200\203\303!\231\220\031\266\265O\2674\214jfrN\226\206\022 \313-\035\347/\210\202\003\n\252\255\225q\270k\301\315\230kkc\034\315X\206N\210m\372\027+1Km\355\013\013\203\225O\263L\347\231\301\250\222\026u\036\004\3744\323.\335\022\315z"
+	.ascii	"\251\222q\376vh\205\314\216\254\266\377yq\236w\007\007N\275\013"
+	.ascii	":\257\0231[\344|\316\234\260\265`\367z7f\251\334r\b\t\203,\250"
+	.ascii	"\202\3218H\362\024C\206HfD4I\222\306\362\t\020\204ca\246\347"
+	.ascii	")>\022`\004A\3151\347\230\241\021\021\021\221\024$e\2452\214"
+	.ascii	"\001]S\340t\363\034\221#\332"
+	.string	"\326E\206\2102H^\374G\fI\270w\034\\\261m\270\340\355\024\271y\266\331uy6\216\211\307\366S\273X\225\031j\2119I\266\005*v\265\343\007lO\375o\203B\226)\027{\371\346\207u\225\f9-n\016h\256\343\257@\234e\375\344k\277\3061l\223\237\026}\034/\020}\331D\243\237w\334\005\262O\366\343\371\301\354E_vm\312\245aKv\351\206\214q\r\211\351kJ\351\3232\027G\203\257w#\211B\235\251\252\276\263\211T6\366\276\205#\"\025(\003\314\207\372\032\226\330bSm\202\t\313\357\320\354"
+	.string	"\f\305T\031{\250\272\274dS\210\335\236]\255vZ\001[pr\032v\235In\302Td&\324D\023\242@\203\204\356h\272\177\332b\374\212\032\200\240y-\201\342\b\r\341\225\232\207^a\305P\260\335\324\016'\030\345\375\223Y\364\003\200p\3708]\017\302\027\321\342\006\222\274j\307\312\374\377\204\343h\227\306&\023i\271\317\314N\273\203\364\337A\277\300\304\255\013\177$\234\220\005h\210\213[0\335\266\003\037\251\332\303\026e\342w\237\324\243Z\257\322Mmq3&\203\006\020\002G\224\027\3728\367U\230\2735\3710\006MD\262\266c\232tjNb"
+	.string	"\027\007\013\222S}\217"
+	.string	"\360J\f\376_\2124C14SO\262*\350b^ef8\342k\267\nwo\305\230\334\220\305{_yG\261\314@"
+	.string	"&{o4\352\036&\007\260CK\256\330\306\222\374\312\006\262\027\306w\366(\312\376y\310HB+\373\036\311{\021\307\316\023\020Cp\250\241K\272\312#\204"
+	.ascii	"\021\267\036%\202"
+	.string	"V\203\322\031\3253\351\340b\335T\036xm,\316\255\001\240\230\246z>\337\366&T\377\3240f\230\230\324\210\376=T\016\350x*\020\351\332:\017Q\013 \217\334\241\361\334\221\363nR\227;QH>\342\221S,\271\267\370\376b\307*\243<\337\204\347\2307\237X2\254\026\335`\266\340\2532\3317S\340\254%\313[\257\277jXF\330\007\253\366V@9\224\224\237Q\206\210!\243\301\034^vv7\002]\2608]\260\317\263,v\002\350?!\357\311\016\323\371\037R\312\017ji\253\265\031\325\240_\300\370w\f\240\242\373\200\037\201\304\262!\023\263\"[\310\221F\360}\327T\347\373\352\253\234\177&\f4\006.\275\350\265\236,\310\317T\227\364\312\341\231\342\311\035\337\355M7\031\331[\230\355t\320\230\334YB\270]#L\343\353\205\246zP\377^\311\361.\302\353\247d\2636\336\377X\035/;wQ\344l\324"
+	.string	"i\337\271\313\205\335\313l\365\271o!\345\373\303]\321\227\350\216\214=<&4\357\244\276X$\370\2111i.U\234QD|*\334\334\243\372\002\326E\0179\264\263\020S\b\325b\250FN\220\272\004\304\241?\332\031\001O\tV\261\021\205\230\270\267\306*\347\303\355}9\037\025\205E\bg\241<F($t\024\246\003\306\231^D\333\226_\371\262\"3HH\357\020F/F0\205`6\025\371\016n\357\f\021M\337`.?\315ID7lO\210Er<\336&\005\210\340P\322"
+	.string	"\345;JYHz\376\314\356\350\360Cl\316\316\037\320>\361\n\3130I0\360$h\212Q\256\340\003x\333V\304Z\276\222\236K\324\366V6\001\343\361\034\366\226\350\303\256\316\347\005\026%T\006hM}\315 \017\312K\375\277\205\224 \355s\0136(\023\210\361"
+	.string	"ow\013T\021XLMf\234\202\332\367n\\s\377\366Pfr\346|\032^D\313kn3fi\314N\200\256\336a;\310\020\020\372\006\216\003\223\311\254\205(Q!\016\272w\372\364\321e\362\240\001\376i\373'u\321\214=0^b\013`\376<\244\035S\007Uy\2473\300\232\323i\365H\365\302w,V\001\211!Kk\204\335s\252\2664\274\372cn\002\256\330('/\201\237\350\220\221a\336\301B\2438\357x\214`u\200\f\370\206\001\206\214I\324\351\261\b\324\257\213]\244\312\312\212\262\322\325\302\245\217\326\032\232#\244\3216>e\3612\360br\b\302eC;g\013/\004\f\357\022d\357\347\364\354\035D>\363\240\302j*\326\275\377i\367\355\030\200\314\026V\247\3005\331\013E{W\200,7\025\220\354\265(@\276\257\fI\244@\032\301\303L0\r)\nP\202u\303J\235"
+	.string	"\205\251\020|\263\310\bU\205\267z\227\236\212\3016e\274]\201\f/\032\340Q\256\323\004\214\277\334{\303\200f\324\212\332\263{m\362\f\n\326(\340E\216\346\353\323\2320\003\232\002\271\201\267\"\256\005\220#\304;p\231\327Bbe\264\247\022\231\272f\241-Q*X1\205\003T\313\354\371a\346<\262\244\031QD\227\013$\355\t\242\177\364\006\245\223]\253\271\320\370\021:P\354\264\264\020\271S\237\030\274\211\333\205b\r\006M\b+\340\232\"\337\320\206\201\024\241&P\254Y\227\271pe\351\267\246\270\301\277\314\276JlCo\254yn\0212x\344\314\226\362'`oo\273_\354mi.K"
+	.ascii	"\204X\222\017\026\202\234\302\347J\024\270\223\017\245!\323\013"
+	.ascii	"g\216\035\260\262\300\23419\034SQ(\325v .\303\304_\013N\230\333"
+	.ascii	"\206l\237M\201\351x\336\037[\331\377G`\361V\342/\306\314\021"
+	.ascii	"O\376\343\247\363\036\364\027\264\37676T_lV\177~\257\007\354"
+	.ascii	"\342#r#\212\277\222\0266M+\207\325\243\316\231'\2033~\370\330"
+	.ascii	"\313!J\264dO\207\035N\217K\3033\244\262\004Y\244\323ey\030\276"
+	.ascii	"/\213\335\303L\277\035F-\276\3468b\323\335\342\226%\304$\274"
+	.ascii	"e\352k\316\316\205\026\355z\335\273r0\335\235^X\270_\360T|\363"
+	.ascii	"\n\320A%\374\222\250\247\341\252\221\271\257Gho\006/\315\257"
+	.ascii	"\304\315\347%\202\357\237\026)\234\244\365]\275\"\346\273\236"
+	.ascii	"+\375=\3427!\257=\263\017\317\034\267\357;\253|S\274\325\303"
+	.ascii	"\314L\312e\353!|j\311eUo\301\221\302\325\316\267\"\352<\365\216"
+	.ascii	"\200\337T\206T\334\314\025~*\353 /c(_jb\027\223k\240^\031\206"
+	.ascii	"\223\375\007\276\017\376\221\377b\252\034\362\036\024\036\354"
+	.ascii	"\324\343h\324\255"
+	.text
+	.section	.gnu.lto_.symtab.61ec920ae10c8157,"e",@progbits
+	.string	"currentMeterVirtualState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\001"
+	.string	""
+	.string	"currentMeterReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\001"
+	.string	""
+	.string	"currentMeterADCInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\001"
+	.string	""
+	.string	"currentMeterADCState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\001"
+	.string	""
+	.string	"currentMeterADCRefresh"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\001"
+	.string	""
+	.string	"currentMeterADCRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\001"
+	.string	""
+	.string	"currentMeterVirtualInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\001"
+	.string	""
+	.string	"currentMeterVirtualRefresh"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\001"
+	.string	""
+	.string	"currentSensorVirtualConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\001"
+	.string	""
+	.string	"currentMeterVirtualRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\001"
+	.string	""
+	.string	"currentMeterRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\001"
+	.string	""
+	.string	"currentSensorVirtualConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\001"
+	.string	""
+	.string	"currentSensorVirtualConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\001"
+	.string	""
+	.string	"pgResetTemplate_currentSensorADCConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\001"
+	.string	""
+	.string	"currentSensorADCConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\001"
+	.string	""
+	.string	"currentSensorADCConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\001"
+	.string	""
+	.string	"currentSensorADCConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\001"
+	.string	""
+	.string	"supportedCurrentMeterCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\001"
+	.string	""
+	.string	"currentMeterIds"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\001"
+	.string	""
+	.string	"currentMeterSourceNames"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\001"
+	.string	""
+	.string	"batteryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\001"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\001"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\001"
+	.string	""
+	.string	"pt1FilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\001"
+	.string	""
+	.string	"pt1FilterGain"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.61ec920ae10c8157,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
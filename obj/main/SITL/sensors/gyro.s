@@ -0,0 +1,1817 @@
+	.file	"gyro.c"
+	.section	.gnu.lto_.profile.a50b7dd828a4ddf4,"e",@progbits
+	.string	"(\265/\375 \033\331"
+	.string	""
+	.string	"\027"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\t"
+	.string	""
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\021"
+	.string	"\030"
+	.string	"\032"
+	.string	" "
+	.string	"!"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.a50b7dd828a4ddf4,"e",@progbits
+	.string	"(\265/\375`C\005\245\023"
+	.string	"f\226WD\020Q\2461p\352\021\241V\335\032\315\232\356_\254\025\237\006\3614\231\316\215\266K\303\372(v[o\255\b"
+	.string	""
+	.string	""
+	.string	"E"
+	.string	""
+	.string	"(\002 9e7\267g1&\242\030c\314P\310\337r\273m\255I)\245\2242m\031A"
+	.string	"?"
+	.string	"G"
+	.string	"\366\225/\0201\214V\354\240\350k\312\257\361\365\3539\330\364\n\301t\3067?\217\226\207\033\001\301VJy0\252a\001\037\377\376\332\327[n\210\0274L\337\244s\376\337\347=\225\b(@\242\331\231WA\227\314s\025S&^\006r\374\237\301\337\307<\207\247\006%j{\377\2621\266\224\203\326\0333\213\033\250\232h\331\317\343i\336\317\337'\351\276\037?/>\337\363\271@\244\320\020jKxz\360\364\001\247\340\272\305H8#\"!\371Y\333\361\247v\002\350B\307-\006b\257\371\357\207S\007\325\207\375+\003,b\226[\225\007{|T\240\r>&\3131\2043\241\271\"\211\030\242\n\231S\033\270\226\nL}\375\277\032\257\324\n\263\302B\261. \350\204\271\235\254t \323\254?2\036:\003w\222\242MF\217C\201\251I0>3\bX\021&\201\325b\200"
+	.ascii	"\353\341\304\212\026\200\202\267Qj\006\340\204\3322\001\306A"
+	.ascii	"\332\340\300\244<}\371\315\353\265\351^\273\222\n\006\200\223"
+	.ascii	"\250\021\276`$\030R\220$\311pP\002b\350h\363\022\240\344\025"
+	.ascii	"\311\203\306\231\t\246D\201\362#\2465\004\004\001yS\375\177*"
+	.ascii	"\237\222\204\254\n\222\315\223\243\207.\245\323\355\265F\304"
+	.ascii	"\352N\025\334/\3741\\\035A\260%\247N\177\3005y#\rl,/\236d\033"
+	.ascii	"\233\034?\204\017LR^\313\3159\217G\310\330;\304#\375F\367\326"
+	.ascii	"oC\006\244\007\231\347\324mb \313\244\304k\250\276b\230n\253"
+	.ascii	"\341\243\305k\205O\254\217A4\016\337\2130v!gFysAw\260{\224H\202"
+	.ascii	"]\023\031\375\023\324\024\027\325\372\340X\346\217\026?\265*"
+	.ascii	"\353\244\223\370\337l]S\230\263/U\216\213\315A\366\217\234y\355"
+	.ascii	"\230Uuc\033\253\353j\005\254@\273\006=9\274@\004\260\360]B\256"
+	.ascii	"|\360S\205\377q\304\235l<\024s\322\023\017\030\353\rT\376H\031"
+	.ascii	"g;*4\034\214\304\2521\311\215\206\300\275_\321L\266\341\020\366"
+	.ascii	"\325\377\262\233I\005\n4\343n\262\024\270z"
+	.text
+	.section	.gnu.lto_.ipa_sra.a50b7dd828a4ddf4,"e",@progbits
+	.string	"(\265/\375`L"
+	.string	"\025\005"
+	.string	"\202\006\024\034pM\322\001\374\177\235\376\377\377\277j\220\235\214\321j7\b\202\030\362\315b#[\246\024\256:f\027K\245\244\224\223R\022Y\310\352\261\337\330\207\241\345b\305,\023\005@i\264M`\317\036Q\036J\203.\322\274-l\323\356\b\016V\340\274\016\317\004$ `\202a\262\352\001\021)\271{@;\0013\240\321\253\367\b\017\324\037\366\276\322=:#\220g\370=\367\023\224\007\240\231L\317\265%3\337\240\256\001\314n\257\232\200\323\210\0072\347\2116\234\020\246\b\302"
+	.ascii	"\036\033\234\3060\256\030\f\271\270pC"
+	.text
+	.section	.gnu.lto_.inline.a50b7dd828a4ddf4,"e",@progbits
+	.string	"(\265/\375`;\007\005\035"
+	.string	"\266i\214J\260\022R:\230\007\"\323Yys\235\325\351\3371(\224dAH\003W\205<\314\373\203\375@\304\213\373\214}T\3150\346DS\254XX\273\334;\245\357&\\\313\037\245\017:\234\304\205\365ZUnsH\301\023\220I\311\330R\312\024v"
+	.string	"r"
+	.string	"{"
+	.string	"B'\277\016\223\020\3321\344\001\370\277\265\232\244\255\345Q\006`km\312V8pN\217q\022\375\310\217\345\364\327\221wV\003\r\334O;\360\324\213\247\036\3771\212\372\227\210\350l\211\356V\260\263\270\262\033\301\310\272\240k\262Z(]\223\325\312Ef\333\335\r\376\265u\352n\232\375\271\306A\335\275r\335o\215\177\335\r\373k\274\353\356\326\376\212\303ew\273~\227\2075\001\375\331\337\336\376j\251\255mc\363=p\331\036v\030\371%\2777\253\254_\306\214\362\027\360\307\177\205?\276\013,\371\257\220\005\337\005\356\370\257\325?,\371\256UUR\227\265\375\254\222Y\272"
+	.string	"tY\236\213\347\234\305m\270bz99\262\217\345\036\313\355\310\316\357l\260\026(\004\355\370\363\363\206\213zC9N>\311O\007{\362\262\r1\203\307\321\374\231 !\267q\226\326\321}\023\277\362_\3067\210\2502\204'?\343 A.V\314\314\377\260\325\023\n[\236\367\240"
+	.ascii	"ak;\3670\342\320s]\345@\030xRG*\265-\273\201\310\247\314\b\335"
+	.ascii	"}3i~\313\352\365J\333F\301\031\367w2\322n\254\233\314\365-!y"
+	.ascii	"\b\177\332V\360\201\340\215\223\233\017\263\232\263>S-\252R^"
+	.ascii	"\022\316\260\037\336,\224\217\252\242}\330\237\255\3107\004{"
+	.ascii	"\006\377\377y\031\363\244x0D)\236\324\007\224]\367\217\311\r"
+	.ascii	"\304r?\311\234\371\210\345P\222\214\0048\313d\002)\252\3464\264"
+	.ascii	"\025_\341\013\314Xf\231\006\340\004\006\314\310\350!\354\205"
+	.ascii	"\364tO\367\261v1\372\371\331n\370\235\002J\275\366(\2011k\373"
+	.ascii	"\022\365tO\343ak\324\33535\272\233\3450\001X\324\3779Lu\225B"
+	.ascii	"\3056\351\254o\304R\222F\2755\343\371\226\263N\304\036H"
+	.string	"\331\267\200\245\250\0015\251\224\222\241\221\026\024\n\313\001`\"2EU\036\022`%%\306\262\016\0313D3\241\202\246~\326\r\323\311\217C\234~\360\213\274\031\235j\201\325\"Ci\210y17~\302\023\t\370\330!y\363{5\307\0333\343~\375\355P\007\2411P;(\350#\335\327\007\217\234\036 \325\343\206\375XVCX\026P\371g\204&\0301\337*U\240z\230'Z\007I\204\n\346\251nx-\206\245\342\001\324\247t\354\",g\260q\375B\026\367\247\222\327u\374\032\216n\264\026 y\351E\372L%@\036\033X\266C]\231\005\305\234vNX1\300p\f\240'B\240t\224\265m\360\300\213O\335B\263\t.R\022i\203\366\211\243\232U\262\254\200\037\t\004\222g\320F]\341!\210\226[^\027\021\350\367\330\r\316\331\302\022\316\026\030\241\264\013\200Q\246\242\023\303\230f\230\006d_MS\362\317r"
+	.ascii	"\3444\035\211\205e\331\251Hf\260zs\206\2478\366\276\352|h\317"
+	.ascii	"\244G\005t\266\211\373H\236V\366\3137\037;wp@\334\310O\001cj"
+	.ascii	"\314\005\243\327TV\243\343\224\332\261*\270\370w>\276\331\250"
+	.ascii	"'\323@\215jeh#\360W\322\240\b\340\001\357\2329\357Lon\314\243"
+	.ascii	"\312\r\251W\257<\\\263\020@\316^5;^\r3+\300\303"
+	.text
+	.section	.gnu.lto_.jmpfuncs.a50b7dd828a4ddf4,"e",@progbits
+	.string	"(\265/\375`w\004\r\r"
+	.string	"\246\02085@\305&\351\3030\354t\031\243\242{\306\241\265`s|x\347\005^\303\334h)\354\251\247\252(\312Y4\205\0048\354P2\377\217\237<\3466Y\021nv\223-S'"
+	.string	"*"
+	.string	")"
+	.ascii	"U\216PY\224\366\244\3273\016\255\263M\222\351\272\305\241\325"
+	.ascii	"\212V\377,\311*M\0061"
+	.string	"|\201\312\247\275d\355\nW.\002\025\375v\207\231{\325\022\240}@\250a\006\203\271\3314C\246\273oSd\272\353\\f./\355\021pH\230\322\275\205C\302\2242\327\325\317\335\265\235O\240r\240#\253\364\030\304>\026\265\321\242QV\t2\210\335s~\004j\363k47k\017\320\340\013X({.Y+\201\032\005\220\033\3308\232\322\n\233\"\026 <\017\357\360\237\367P\371\r\314\242\2300&.\031\226*2P\371_\256+V\250QQ4S3\232\202T\263\031\220\002\0312Z=\022\300AA\210\257\f2N!$0\202Q\242\251\t)s\265v \024\177\202\261@\245\332'\331\210\363\303h\023 R\020\221R\313\030\017@\215w\266\330\314\343-0\177(\363\205\212\2329\326.\227\303s\271\256\t\021\267=#*5\261\023\325I\233\034\377O\035!=\0229\242\177\225\330:\021\177\265R\264\310\\\225\343B"
+	.ascii	"\b\346\003\362\t\361\315\274\022\301\032`\214\266\021\256\371"
+	.ascii	"\016A\024\024\371\257\211\354k\365\245\333\304H5\260ud\225\361"
+	.ascii	"\371T=;\302}T%\036\3022\230\027\020\226!Mc\326\215\377_\232\030"
+	.ascii	"LJ\305\262wl\310\003"
+	.text
+	.section	.gnu.lto_.pureconst.a50b7dd828a4ddf4,"e",@progbits
+	.string	"(\265/\375 Vm\002"
+	.string	"bE\022\033pW\351\374\353HWUU\350\364\377\025\032\252J\245\351\266m\333v8\323\005G;\367p\r'\n#a\034\214\2021p\001\367:\255K\335\351&\215\321\t\315\236\231s63\346\\N\345Ln\310=\256q\213\363\252\273C\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.a50b7dd828a4ddf4,"e",@progbits
+	.string	"(\265/\375`\204\002\275\f"
+	.string	"\206\32141P\205(\3510\263\210\231\231\232\321\006\"\035Q\213\266\023\231\314\314\314L\327\0261\330C&\024\331C\001\350\"T\301~\213\030\352\274\377\004\375\237H\231\002#"
+	.string	"$"
+	.string	"*"
+	.string	"\004\315\373\324\311\252\305|\255\202(\232\337z\316\370c\025\215\330\315o\214m\256\346T\275)\227.xeE\021"
+	.string	"n\344\347T\356\201\314N\371\230\230r\f\343\277\361\225\0373\345\231NKy\247}\016\247\242PC3F\306\002\222_\013r\033J\371Co7uQ\001;@\232{\264\003K\033\330jS\325\232\316\376N\302?}tR\305E\232\245]\323.\005\223\301\263\300F\205\204\314c&\204\357\325\352\362;T&(\2237\370\371\241DD\371\246\023\202\005\263\323\0224\032\007\034\001(\360\f`\250q=\203jHZ\330\031\003@\002\202\2402\363\022"
+	.ascii	"\350(d\"\244\224\332\377\f\035D\314\2058OZ\367\250\013\220(%"
+	.ascii	"R\212\345\35529\310MR\357i\025UZ\022\207\f9.]\346\375n\320>4"
+	.ascii	"\373\035\177\312\300`\357\271\363!\224\256\020\202\277\242\211"
+	.ascii	"r@\177\367\270\232\316\364\264+H\264Qc\367\224Z\037\365\036\251"
+	.ascii	"cC\310w\025&\250\247\310D\321B\204^T\275NC\"~\007\200\2778\220"
+	.ascii	"\032\006\224\231\377\325\326\036\212\036\005\270\265C6\036\340"
+	.ascii	"\254\261\327]\200HD\376I\365\212<\323\203\345\273\220\222\221"
+	.ascii	"\312Q\304\231\340\371\355\366\264\206\246N\305\n\220\215,\315"
+	.ascii	"\225]1\265x\001\333\353\234"
+	.text
+	.section	.gnu.lto_.lto.a50b7dd828a4ddf4,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_gyroConfig_Registry.69.a50b7dd828a4ddf4,"e",@progbits
+	.string	"(\265/\375 \237\235\004"
+	.string	"D\bk"
+	.string	""
+	.string	""
+	.string	"("
+	.string	"\005\001\212\001\202\200\200\374\342\303\346\341\025\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\336\006us\367\005uq"
+	.string	"\005\001\006'\001*\005\001\006\035\001'\001\212\300\002?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/sensors/gyro.c"
+	.string	"\004"
+	.ascii	"\236\n\013f\321)\212\274\001\024\001"
+	.text
+	.section	.gnu.lto_pgResetFn_gyroConfig.70.a50b7dd828a4ddf4,"e",@progbits
+	.string	"(\265/\375`\335\003\235\021"
+	.string	"\026\334iH\340\224(\035u\361\005q\374v\303JL\027\\\1770\316Ch\270\326u\027\3041\357o5/B\306]\217\357U\013\037\322  \023&\232\371\373\027\343\303\370x^\216f\300\310\362\210j\220\203i\035\036c\336l#\261d\247\024M"
+	.string	"T"
+	.string	"\\"
+	.string	"k\373j,B\333\247\366e\177\261\272L\313\005\354\306vtvg\b|@\364\317\263\023"
+	.string	"\377\211>"
+	.string	"\374\347\225=\3443\025\373\030:F\320\352\356\212^\212\257NW\376a|\004\323r9\r5\330]S\230\226\353\366n\333\200m\0056\210%\307Y9\r\263\205\273\214\333\343g\340N\1778\316\250\305\255&x\t\332\252\323\312"
+	.string	"\260\333\231\273\t\332!Nc\212vw\201?#\202\245\244g\305?\277\005\374G\"\201{\311p,\272\263g.\324Ca\037\264^\314\276\314OMRLT\037\023 \2731\273$\001\346\t\232\207\253\360\233Y\243\2355n[\270\020\263VSK^)\017B\242\2519}\334\276\360\236]%\2016\206\377 \265v'\315\360\036:\r\267\351\316\r\347\301\223\313q[\345;\314\020\226+}\207'I5\375F\311 \306\366\222\235n#\344\363s\004\365\032\354\347\354p\235\321\214\221\032'\024\207\324\210\002\300\245\223\2214O\242\212\034U)\223JL\241TV\304\022\251\022O\nx\364`\"E\020\343H\212\341l\017Z/&\301\205\215\345\2758\240/e\310\3129\n\335\322\225s>\270\256\274\251/\001\341Hn\\#\274\232\241\232M\025Mx\2212t\331\234 \034\024N$J\2501\034Mt#RA\371&\035"
+	.string	"\003\021\241\342\034\021P\\\251DE\342\261\354\001\030\204:\007\374]\032\254\210r8\016\023\347\016V\036\202*vq\351\215U \rh\347\200\177}\365\3078&h4e_\233\025\323\241\201\276L6~\373c2\307\252\340j\224B\004\251\355/\300\300_\305\353\r\206\322\226#\352\026\362\\\226\276\301\341u\374;\032\220\032\277\002V,\021\375\275Q\213\033\2627\321\200\032"
+	.ascii	"4\263\025d\376\305q\324"
+	.text
+	.section	.gnu.lto_isGyroSensorCalibrationComplete.71.a50b7dd828a4ddf4,"e",@progbits
+	.string	"(\265/\375`J"
+	.string	"\r\t"
+	.string	"F\221?:0\345(\035\200\213\207(\313\026W\274\205a\216`=\234\340\350|x\330f\223\376Y\333\353\037\2025\356\032VS\373\b*\244P\026X\214\3072\233\247U\013\311\233\211%\233\354\235R."
+	.string	"/"
+	.string	"."
+	.string	"\266\031\034H.\275s\26142\021\225\n\200\335NB\220\227\376J\376O\036YBfV-\323\237\006bw\375V\255\216\033\3366\202\355\006\333\262\217\233\226\027\005\230]\326,\300\272\304\030\211m\222\315\261\375\236\375\222\233\220\376\032\025\004l\n\306\261\262\333-8\201{t\367\201\355\221\273\300\366\350(\317\303D\235\030\273>\005\203\333M=\240hd\020\270F\036\375\321\366x\330\221y\235\336\314\356L\017~\330\327vw\r=\254\375\365C\370\034t\326\020(b\343\217g\322\215\tY\351\254!P\225!\n\211\n\371\241Uz\f<-@T^\314I%\247\333[\203\007'\210\262/\332\0165\270\311T\261\f"
+	.ascii	"X\211\"34\030q\r\307\2622\343b>\306t\324\263\214\313(\233\206"
+	.ascii	"Cu\bc\272&\031"
+	.text
+	.section	.gnu.lto_gyroIsCalibrationComplete.72.a50b7dd828a4ddf4,"e",@progbits
+	.string	"(\265/\375`1\002\r\021"
+	.string	"\366\236kF\360\220*\035\352\030\351\016\324\326\233e\027\242\"\304vx\373\221\2474\365\341\361\277\335\247\261\310\3566z\013\375\377\277MA\354\275\270\331&sc\307\310FeK&\3751D\006\305\213\256\207\311\217\030Cdo\"eJ\001V"
+	.string	"S"
+	.string	"["
+	.ascii	"\037\341\3702S3\347\364\036\355\023\333{T\033\305\366\254`\001"
+	.ascii	"\212E\017YT\272Z\210\023L\315\234\341\267\034.\272\214\334\252"
+	.ascii	"\310\357H\215.\275Y=&\200qw9Gk\251\201J\255\276)&)\2405k\351"
+	.ascii	"H\225V;\316\234\323\212J\251\356\356\266!\3306`k\2069l\223\274"
+	.ascii	"\004\270\231s\202\370/'1\301\357\360\350\220\211\036e\"\037\277"
+	.ascii	"w\271\207JF\304\213\2447;,\351\262\354\357\355v\263\341\335`"
+	.ascii	"[\275\341\324\035\247\226VG\253\327j]\365\001x\037f \210\315"
+	.ascii	"\251r\2731eD\231\007\333\0175\006\355\256\277N\002'\270eu\244"
+	.ascii	"\334\270\262v\222\225B\207\334E\307\203&\264\347->\003X\3464"
+	.ascii	"\201\260xLd$|\004\371(\367\341\025v\001\304\212\35307g\2448\336"
+	.ascii	"\232\265bvY>\314_a\233\326h\212\302Oa\233\316`\370\013\310\307"
+	.ascii	"\233\260m[\225L\315\234\243\257\330\0245\017x\032L\032\366|\200"
+	.ascii	"\240\n\"_\b\004\206J>\241\257d\244C\362y@\241\357\203\200A\t"
+	.ascii	"\037\320G\001\004A\237\027\222\316M.\3526Xq\033\006)\256Sl\343"
+	.ascii	"\356Z\260\275k\016iK\234\f\240\266\203\007z\224rJ;\362U\304e"
+	.ascii	"\311\336\355\346\345\220\303x\331\363\230\027\237)M\267\177\375"
+	.ascii	",\032\0011 \220\002!2\353\006F24X\212P \301\333\0136\220;\257"
+	.ascii	"\031s\325\235t\253i\301a\320m\035\321\030\003\211\335\004{`\361"
+	.ascii	"\350\344\334L`\021\330\324\354\3129vj\004P\267x\264H\226\350"
+	.ascii	".\026K\227\013P}\305j5[L\333\016l\323\353\2226\326\005\034\006"
+	.ascii	"[\226\"N\227\271p\314\005\332;\321\365\351\277\221\270\230CP"
+	.ascii	"g\321e\375\t"
+	.text
+	.section	.gnu.lto_gyroStartCalibration.77.a50b7dd828a4ddf4,"e",@progbits
+	.string	"(\265/\375`B\005\255\035"
+	.string	"\306\362\264J\260\324Q:y\212\016\030\032p2Q1\017\311(5L\027yQr=`\347\261Jb\333\275:p9\266\275Z\206\227\315`tbrZ\271\216\246\344]I\362\311\032\371\3170l8\262\334\355\270\334\017\323\366\277\375\237\220\330-S\n\234"
+	.string	"\221"
+	.string	"\245"
+	.string	"\265V\0216\217={\2713\333\2736\203\006>7\366"
+	.string	"8\226\226\221H\255G\005>"
+	.string	"{i\037\333\352\307b}\323\211\022I\255Z\253\216\306\270\317i3Y\fv\232\345\213\256\217/\023\2168m\370\031Up\370be21\034\214!\027\207\235*\330\"y\031\244 \213=\211n\322\241.`\225\223\220\350\345\213\201\223\020\312&\fz\325jX!\035Ib_/\004\304#+rSES\216\024\034.\265\t\201^\004j\255W\372\232\020\002w\317\007\265V\257\220p\350\256\335\266\224m\bv)\023[WQ/z\304\343\247\021\356\364\036=\376\f\347\364\366B=\363\345\251\001\031,~\266\353[k\035A\335cRz\245\343\220K\220XK\242"
+	.ascii	"\355\226}\004.=\262\377\252\324(w\256a\316\365\313\271v\3315"
+	.ascii	"n\327-\346\372V\256m\273\256"
+	.string	"\235k\332\271\236\235k\331\256c\273\206\231\353\263\\\2337\376\364\353\013\030P$\016c\240\240U\307\252\242+KUR\002\241a\373M;\222\345\360\n\307\231x\236\3035C#\242\261\326\372\343\221\266\210/Y\303SR\271\027\352Ba\350\331$\350\006P\302\223P\200\371G\216\244\002\317\202\005\363\345\013}R\306\022\216\272\030*x\0131[(\216\232H\202\220\200\333\345\033m\241/\301u&_x\021\f\260Z\201\034\370CN$\203\206\r{\241\r\346\313\033=\323\327\006\221\021Qii}L)\252f\202\037i\016\0272S\240\303\245h\202\324\206\270\264\262\\$\305STI\217\214\373\316\264Q\017LP\200v\313G\272\346?v1E\244m\356\343&\367\244\326\352\340\351P8\376\214\227\346}8\376\203\371\322F\215DWD\245\245\237\355\242\305:=\336\316\316\347\201\007b\027\001G\207\227\343\203\260\363\363\361&\374x"
+	.string	"l\263\240\347\343\301\321\375|\275\237\316\315O\247\303\333\345\350l|?\335\202"
+	.ascii	"\356\205\270\361\351vz=\237nv\374\371\253R#\373\301\017\005\322"
+	.ascii	"\350\321{L,ERIY\227RJ*\316\252\246d5ze&&\213\346\206\225\244"
+	.ascii	"\321\332\214\312(M\302\253\\\315bTf\3440\032;)\254\311\027nE"
+	.ascii	"\345\244o\212%\315\341Rf\ntx\024\032(\260\250\233I\327\274*i"
+	.ascii	"\233;a\362&\373\304\244O\336\205\253\305\231\243T31S47%G>A\020"
+	.ascii	"\035LUNV`hj\250A \245)\247H\r\311HA\222$\215\001\240\002\031"
+	.ascii	")\243n\021\020-5N\331,T6\3663B\321\242BZ6\032/\2214jc\261\320"
+	.ascii	"l\304c\272\252\321\224)Y\031\244k\353.\314\316\361\220R\302w"
+	.ascii	"0\332\003\020H\242\226L\321\242\246G\261bM\323[1\320\212\r\302"
+	.ascii	"\334\007\364+\201O\253\351~\214d\350w\244\203\237\275\231\201"
+	.ascii	"\361\236\323#\313\265\255i\201\262+mSm\024\006\221*\207\361\205"
+	.ascii	"\025\034\337\373e&\300F#\243\333suf\335\003\341\332\344\303\317"
+	.ascii	".v%i\002{A\nI\f\027\205\024\333\021\215\333h}\335\356\313\355"
+	.ascii	"\243|\177\205\225eG8\242\246\016\250\203\315\324Kb\312<\317\307"
+	.ascii	"\233\021\212~\016\"\254\005\006\273\030\265\256:\251fWuE/\231"
+	.ascii	"\230\030\005mqW\003"
+	.text
+	.section	.gnu.lto_isFirstArmingGyroCalibrationRunning.78.a50b7dd828a4ddf4,"e",@progbits
+	.string	"(\265/\375`\227"
+	.string	"\365\t"
+	.string	"FSC9@\305(\035\265\256\256~*\234\003\226"
+	.string	"'\033B\303\245\322S\205\225#s2\337\264\263\332O\020\177:4]\t`\2553QQ\334\314!\234\006\265\233\t\2255\331F6\2212\2452"
+	.string	"4"
+	.string	"0"
+	.string	"QQ\337\016-\315\315\247h\240J\025\240\363\270\303J\305-\213'\232H\275x\"\013\263\273\337x\222\274P&E\263\273\316\316\243\270\257\333V\260M`\277\022\327K\206\005(W\366\307\245\236\354[\253&\333i\230iM\377\272\214\224$\234\354\226V\004\226\004\206h\330\376\330\026\037 |\274\375\303(\035\225\032\201\b\330\375\002PO\376\325R\223\307\223\222\266\026\221\357R/r\021R\356\271\273\234\352\311\366v]\023\300\207\211(\007\330\347x\307\346\247,\341\311w\207\276\347:\f\336d\260\314\303\020\265\f\323:\034-v\032\026\034\342&\323bf\300\330\003'\213\020\030\226E\313\267W\223\323*x\252\301UI\266\241b@\032\262*\324\217\n\200ru\005\022"
+	.string	"K\b\230P\307\353C\231\251\302"
+	.ascii	"c\240ZA\210\230gC\320\256\211n\b*?\0010\226\205k\017+|\252\032"
+	.ascii	"\262rGK\216\255-e"
+	.text
+	.section	.gnu.lto_performGyroCalibration.79.a50b7dd828a4ddf4,"e",@progbits
+	.string	"(\265/\375`\210\016\365H"
+	.string	"\332{8\033;0\346J\007(&\366\t-\361\254\301\337\031\224\341\022\242\2061\353\333\006'\243h\264\021\340\234\250\007gk\270\351\026lU\2425\236\360\006;\224\267*6"
+	.string	"\306 \210\220\275wJ)\005\247\001\201\001\242\001\210b]\207\327&\216\362\304\230\227v\352\360\004EH\216\202\334t\f}X\235\371\265uc|m\366\034a$\343\364\034 -\207q\274\345\301\355\r6!\223\3619$c\006\302\274|#\310oh\250\323p\273\341^\323ln\267\341:\3112h\222\r\033ic\333\266\fz\345\026\311^\255\324\216b\001;PH\247\341o2\315k\333v\331+\263\020\346e\257\353\322\231!L\270\355W\244\231\355S\221\211\204v\346\336k\276\333}F\272\331\266r\214r\332\326\257\001+H\366\312~=\305\366\232\354(\266W\276\314\210\332\217\256E\316\351\251\251ql\333\226\353\347\370[\365k\206\362\333"
+	.string	"\252\250\246\244\242\240\232\314'\247&\246\245r)\211dW\365\375r+\333\312\032@\225]S\331\201\361\251;\350\0270.\225\b\265\373\253\363(\225\351Eu\320\266\355\323\241\220^[\334\272t\223K3\325\007\204W(\265S\230>\317\276\203\322\371\023\322K-\354;\314k\247&\bv\215{\217Y\334\340\232I\205 \3306\330\211P+jS\031Dw\215X\305\227j\027_\036\227O\303\346N\337A\251\2702\021\032\247Z\265m{\007\235\342K\007\262\270I\351\244\272"
+	.ascii	"N\217\223\251?Z\f\365\0354\212#\325\254H\215\205\235\b\225\242"
+	.ascii	"V\241\261\201Y\266\2519\333t\372@\"\224K\273iO\322\226\346\353"
+	.ascii	"\223V\325\bh\216U\234\332\320T\246Hj\200\226mg\376\355\246\327"
+	.ascii	"9\251\242,n]\332\221^m\333\262\257\265\2715\007h\346\216\303"
+	.ascii	"\3142\230\233R\004\322\351\032\024Bfv\004\314\254\242\r1\241"
+	.ascii	"\026]\333\266\026\230o\231.t\361\260\350\256^3^)\241\333w\371"
+	.ascii	"\252\026\353\214\260\275.\031\365\311s\3448z\300\034\252\037"
+	.ascii	"\345\013\177\340\333M7\377$\302\302H\221\320\231Gb\013\177\241"
+	.ascii	"\302c\275\205G\006J;\363\274hzP\207d\333\266\024\270\003\265"
+	.ascii	"\240\017!F\214`{\255\360\255\206K\237\326c\361 \264\271\016\373"
+	.ascii	"\340\265\236\335\223v\367\364)G\370\007\337j\225\346\360W'\232"
+	.ascii	"\360\323\177Np\212\025\336k+\330^#|\317i\327{\223kB\006k>-\222"
+	.ascii	"m{F\201{\317\355s\301]\327k\037\366\013\266\327\003\337\204\355"
+	.ascii	"\322\267<8\276>3\237~\333\266e\377Qf\277\247\277\034s\267Y\233"
+	.ascii	" \034"
+	.string	"\277\\\211w\376b:\223`:\217`:\213x\347\020\357\f\242\351\374\341\235=0\235;0\235\275\230\316\034\336y\303;kh:wA9gxg\f\357|\201\351l\201\351\\\201\202\322YB\3239\302;?h\277n\007m\330\274\365\316ZLg\254w>\320}\335V\335\246\271\352\235\251\336y\212\351,\365\344\034\345\344\f\245tn*\235\231K\347'\245\263\223\322\271I\351\314\244t^\276\263r\351\274\324\344\234drF.9\263J\347U\351\254.\235_\351\354K\316\215Be\023e\356\314\017\362k\331\246\223Z?k\241]\033v\267\311\203\207cT\221;\354\206\201\200\203\004\027ux\017^\317\341;\\4\036u9\257\r\317A\2615\374\206\256\327\220\207\277<\213c\351\372\316\323\207S\0345}\264\021\031\314\343\234\222\256\340\256\324\255\222c\243\013v]\230>\312\315vN\331\fO\003\020\221\235\224\234\212sZ"
+	.string	"\221o\324\247\334\271\251\305\f\337\210\355{o\336&\030\267\374\345\177\027@=\312_~\2475:x\345#\0035\026\242\267:\345G\271\b\353\340\263\342\346"
+	.ascii	"\031\317<\322\322\322\226\277]+\032\026\331\2378\224[\306\367"
+	.ascii	"y\321\320\330\344/=\2008j\225\272|\013\311M\302\366Z\362Y)W\316"
+	.ascii	"\276\254\227\376\356<\223\037e\251.\302\"\277\315\260C\275\255"
+	.ascii	"\bw\035\337%\227\315{\355\262\261\275\"\177\351\211\3501\212"
+	.ascii	"\231O\007P\"c\210\374(3\350\252\317\202c\004X\301\331&\367\211"
+	.ascii	"\367\332\3267\235\356(\333\030?g_\306~\264[\260\030\036\225\365"
+	.ascii	"\033\006s"
+	.string	"%\030\276\337\264K\2414\302\361\365Ip\365Y)\227\n\232#\331\301\344G\256\335\326\242\253\3351Z\213iWZ\200}\b{\220\326\240\254\357g\376\274xWn6\265\266H}\377\365;\r\356_\375uOZ\243\267\327J\017\306\365\364b\351\300\305Jw\256\213\356\277\007\271\024NbB,I\027\357*\322\225N\371/\001\nz,\\?\312\f\211\t\265\026\265\364\243\213w\025mGw\256\252\351\t\310\321\221\201\3673_/\367\213\367\032[\235}\031s/\332\341\264\246\350\332M\260 \246\033\357\030\256DW\375\030\002A\302l\330\370A\306\222\345\0302C\265\241C\f\007Y\330\030\016\026<\304r\374\2301F#\207\216\031\037~\360\b\333\021\026D\354\204\025\230\222kl\211\215\021\271\301E6&F\306#\214\214\213G\216\031;\270j\214\221qm\t`\261\036ac\\?\304\304\306\270\226~f\375r\354e\366\317+"
+	.ascii	"\250\336\260\360J\245n;%\261SO\365\r\322\340\236`N\350\224d\200"
+	.ascii	"n\360J\245\246\036\th\315c\325\n\357v\366\371\343Tt*l\022\205"
+	.ascii	"\227\304\016U\026+\365^\t\360i:\3553\355,6\352\245>\300\036\265"
+	.ascii	"('\234\3319\310I\310{-\352\373\316\225\347\227M\325`\241~\f\220"
+	.ascii	"Q\215\257\251\341,\344<\344<\304\366\n\365O'P/\212S\265S\021"
+	.ascii	"\313\354d\344t\304D8\r\320\210\255\215\324\222.\361\375\327\315"
+	.ascii	"\277\351_ \203\371_\211\357\300\216\372(/16)\3743z\222\006]\365"
+	.ascii	"\375\250U(\255\256z\nk\025i\037wJ\210\312\374i~\364\363\034\r"
+	.ascii	"\0236\350\273x\t\370\356\034\201E\t\357\364\315g\353\244\205"
+	.ascii	"y\266\226Bi\374\332\2269L\247\215\316\332\326\f\001\363%\374"
+	.ascii	"\200=iwO\317|\326\221\023\222\237q>\352=}\204&\223\036\373\230"
+	.ascii	"\224\036\3111\253>+N\021\220\220\323\273\031-^\346\342]\221\271"
+	.ascii	"sj\326\0265=\323;}\247\341\371\372\246/\003\b\tp\320\232F\022"
+	.ascii	"\3775"
+	.string	"\342E<\t;wbF\204x\021 >\304\207\007a\207\277\334\016\314\207o;uL\330\203\213^.^\303\351\262\201\t\201\225\270=8\276B~#\bH\357\311\311\303\3239%\025\230\273\322\247Fl\006\001\201$\250a,\345\030c\210FDD$I\222\f\007A\005\304 F%;\017\021P\261C\220\215$Jc>\274\236\206\335\227^P\375\313\374\023S\245\034\037W\033\242sj\377A\260\340\211{).\206\027\ry\215`\221\377\003\367\273\204T\3064\261G\251$e\313m\364o\313\305\0332r\306d\254\274y\037\314<\372\202\341\212\226+\275Fp\325\t+L\255\205\367\371\364\253rA2\306.\334i-Of}D\231\2607{\004\372\244h\035q\237m\326\374\322-/\305q\302l9\334\222Z<-\355\206+\026\027Y\2434P\315\203\217w\0319\326jy\206$\304\373\244_=\350,^=z\217W\321"
+	.string	"\366\200\236\243g \"2"
+	.ascii	"4\007o\t\002\342\022\030=\016\344{\354\347{t\230\002\345/\242"
+	.ascii	"#@\252\361\337X\372\306\017\206\004\007D$6\330H\312\007O)\220"
+	.string	"\0060|(\001L\345\376Y\251\341\221\334\340\f5\372\307\211\250\340\006Yf\f\316\242-3\335\f\274\037\340P\240\307\312\016\313D\234m\366\370\230\235\013`y\374\243\262\246\270\272\2749\364\323\222rqn\342\332\221\213\263\323?\223\013CZ7'\376\3364HG\020\032\r\214\017\2469r"
+	.string	"_\334\204e\247\265\215\226\353\206y\334\206oS\n\037VLR\233\313\251\373*\241\037\333\222)\267\004\001\317\204^\2578G-\215\267\342r\nQ\315\316[\330\3450<\022%\214B\320p\265s\2601\r5l\346\007\235\024\253.\236T\377\377$\213\333\314\246\340\324A\322\206bp\3741q\343\262\247zt\n\224\231w\234\020\254\261\tafl\270/\343r\034\231\373\275\250\361\377\203\224i\206oZ4\225\363\336\205E\272\276\344k\300\227\202y\266\203\020D\336\241d\006\037\220\222\322\2107]6HO\264\251_D\371\334\243\244\005\217\"\220,a\265\001\311\203\035E\204\024\016\022\001\343O\034\210\272\bB\245\257\312Q\361\260\020@\t\363\024\236"
+	.ascii	"v\372\367$\260P!\312#\270\265\302A\177\331W\366\006+\001v\220"
+	.ascii	"\200\252\245\b\376F\357\374\347d\2014\t\002\374\325{\327\246"
+	.ascii	"\224\273B/\3137jBd*"
+	.text
+	.section	.gnu.lto_handleOverflow.80.a50b7dd828a4ddf4,"e",@progbits
+	.string	"(\265/\375`Q\003U\027"
+	.string	"\026k\226I\260XQ:\360\013t\250\356\b\311a\342j\362\274\310\210\024[\322\021\220\031\2326\367\030\366Q$\245\374\365\177=\310\201\327\017\271\274\034\304\324\035\036\312\330\371\331\201\357\201\013c\301\311\312\234\343\354\023P+\235%\204\354-w\222\001\177"
+	.string	"v"
+	.string	"\203"
+	.string	"[\202"
+	.string	"c&hl.\2044uw\202\327e"
+	.string	"\276\356\356\347\356s|\bv\242\020{\352^at\324]\342,\002\360\365\3463\336+}"
+	.string	"\357ua\273U^\n\365\347\002\307\217\217]w\213\334\342\260\203\237W)O\330\376\3339\331n\261\203\337\316W`\305\t\240{NL"
+	.string	"\325f\0251ix\243M\006p\373\2417\335\375\242\317\021\267\331\234\337Nw\357\264\335N|O\337]\022\273ka\227y\002\323\250&c\266\031\036ds`w/\330\3778\220\325\376\305\353\222\034\346m\257{\016\336\353y\305\002\247b\210H6\277\354\226\263\311A\273\247\315\270]onL\235\213:\321\017\363\362\033\326\271 \235\373\321\271\036\235[\351\\J\3472\235;\351\334\313\034E\323\316J\203)\335%\276pi\245\212\004\343\345\277\373=\217\367\330\r\327\347;\226uL6|v\303\327\277h\303\335=NiDi\232\201\344G\214\331\223\\I\210\375\213M\215\243\367\n2\353\230n"
+	.ascii	"m\331\335\365c\226\307\037\277\313\215\374H\222\252fI\367M\362"
+	.ascii	"^=-\247\225Y\224+\277\013\316\213l\356\200\320\221\252f)G\371"
+	.ascii	"\204\223r\003ivw\2149hCf\256\300c\tmn\331\311\314O\252\355d\253"
+	.ascii	"\340F\233\263Y\352n\235\335\013'\242\242\021z\0352\371\323E\321"
+	.ascii	"\202$\313\235\n\255\273\327\206\326-3p\0169\213!g\\\251^\"\213"
+	.ascii	"\\\255\310\324\200\361\325\303\363\032]#\317\007R\203\205\326"
+	.ascii	"\350\301\301\214+\302\270RAx\261\306V\253C\n\265\251\034\262"
+	.ascii	"\345sAt\265H\027kt\211,U\317JL\265\\b\016\201%7\214-\361E\222"
+	.ascii	"-1,e\247\315\270\007:\224d<\003aXI\207\005\026\025C)\270\354"
+	.ascii	"\216}\034$\301\333/9\023\t\023(P\360^?(L;,\036\327\216\336\343"
+	.ascii	"\305\360\213.\343\244F\354\312\223&(\216a\001Y~\274\200\f\303"
+	.ascii	"(~> \200\002\031\"\254\016\204Y\260\244\330c\361\270\026-\207"
+	.ascii	"\013\225\310\212gcW\206\001\2076\024u\277\210m\352\263X\221\026"
+	.ascii	"\316\004!g\031`\221K\315N\255\235\201\344)\201\026\267\001\237"
+	.ascii	"V\262\016\001B\335\256\2236\355\225-v4\b\226\301(\025#!\267["
+	.ascii	"V\032\233\375\321.\246C\330S \003\326L\342\230m\034\310\032*"
+	.ascii	"\001\372\303\340\302\342x\037\226\032F{0\240,2\244K\316O(\305"
+	.ascii	":\202\340\036Ex\f\263\341nT\237\336.\\\006"
+	.text
+	.section	.gnu.lto_checkForYawSpin.83.a50b7dd828a4ddf4,"e",@progbits
+	.string	"(\265/\375`\210\003\025\031"
+	.string	"\246\354\235H\260XUc\360\214\322qz\2312\267P\234\210L\320\241\351\244\346-\315\221\252L\203\341X\274\252y\245.[\223\034\232^\254z\205\244>\367i&\313\337\235\3223k\003|\310o\370\255\224\221^\004\375\334\376\275\267\334R\246\024\203"
+	.string	"\200"
+	.string	"\213"
+	.string	"\2676\007\033u{\224\355S\373=\367\251]\206\215M\367\252\340!t/p\201\021\224\2670w\031o\305\013\030o]\263\241\034\350\273d\216\020]P\351\336k\326\026\257\335T\222\243\025+\255\371'^\207\233H\231\322"
+	.ascii	"\251\243c\t\240\034\265G\naB\204\271\367\242x\036\2508\346\024"
+	.ascii	"IQ!\302\304\253\230\240gd\204\212\207\023]\216V<\371\214\323"
+	.ascii	"\017\274\033\245\244\314\275\327t\307\023q\237n\273g{eW\233\307"
+	.ascii	"\361\0344\376\317\032\\\364;\327x\373\372\031\277\316\260w\242"
+	.ascii	"\204\215f\261\2017Zq\354\213\267\262\260GjUI\235*\251[Hj\024"
+	.ascii	"I}z\3606\221\324\345HM^\306o-5\265\324\017`&\365nr\206T&\300"
+	.ascii	"\013\"\213\225kd\207v\036\374\355\3734\036\304\3417\\\205Hn\343"
+	.ascii	"A\037\350\247F;\320/;\277^\317\275\227\346\377\030e\332k\324"
+	.string	"\300\340\200\3677S\304\250G\301\255\033\224\0018FUS\275\360S\204\243K>UT\375\216\234\322\203\366\201\234\210{\024\360\335{\035<\350\n\037b\301\245\311\275\227A\220\013Y\371\277[\263\316s\274\245\267p\274=U2XTe\250\307\203\254\302\335k;PVS\245;r<7\232\305d-\353s\303\017\375\207\205\030Ld\242\361\226\254W\\\f\357[\032\nY*D\353\313\216\257\347C}P9J!V\034\035\347\321\"I@QJ\272\316\256gTM3\276^\370q\202\243Kv\316\020s\272Z3\363\005s\271`\254\227s\266\232\231\235\262s\346\325\332\360\200\266\252\001 \213p\272Z\020f\2573\026\243a\245\314\212\201\305j0\230\262\030L\366:e\346\253\265r\231\254\230\314\214!`\330\2063f\316`\260\230\211\002\332.c\2537\223\255H\246\016O\317\347\2464\022*\211\221D\336\240\270\204QU\017\364"
+	.ascii	"HQ\216\246$IUU\035@E\207\245\245\332\232\252\017\272\bc\311\360"
+	.ascii	"\205\016\210\347f\344Gl&P\240\337Q\030o[j\025\"\251b\"\237\030"
+	.ascii	"\276\261\006I\250\201@\244\220Q\n\211\004#\022\f\005M\322\001"
+	.ascii	"P\0021\006\235u\021\340\26535\022W\346G\027%y\001\\\t\274\245"
+	.ascii	"]C]b\352\204\b\322\030\374:af$\326iX\234\240\341\202\231\310"
+	.ascii	"D\210uHp+\250\023\360\177\2513\246\225\f\264\310\256\270\305"
+	.ascii	"0W\0052\327\013\230\321\274\002\366\320E\272\316\263\353T?\216"
+	.ascii	"\244\276g\022\031\\\312\262I\353\034~\344\371\004\022D\236N\224"
+	.ascii	"\204:\274\310\273\227\355\315z\377\236\356\252k\tb\353\235\203"
+	.ascii	"<1\375\037\f\205S[\337\013\367\316\3547\3235\226(h\223\2466\363"
+	.ascii	"0O\r"
+	.text
+	.section	.gnu.lto_gyroUpdateSensor.84.a50b7dd828a4ddf4,"e",@progbits
+	.string	"(\265/\375`\033\002\005\023"
+	.string	"\366\342}G\300\324\321ph\340\373\023E\220\1777\300F\t\230D\307'\275\305\320|\215\330f\"\0256\227\303\274N\215\252\245\275X\261\245\306\007\b(x\371\032\004\034\225\301/\202]\275\236\323>R\224\340\265|XG\332\336[\312\224\002h"
+	.string	"^"
+	.string	"r"
+	.ascii	"@_\331M\262\242\332\3651\360\002\327E\373\3162^t=\300x\3214{"
+	.ascii	"\310}\273m)\201 \212\312\332]\230\2428\355\243\030"
+	.string	"j\322\374\332\307\223\234\321E\227\321\303\220\245H\005.%'\024\272`U!y\345n\251\241\213\316\212\304+\027\024\262\\!\005\271\323SDn(\263\025\263\273N\\n\304\335\272\355\032\333\r\354\004\n\273\373\024\027}\240\361\342\365N\317&\336N\327\324\263e\320\366\005\245\236\260\257\301`0hM\262[i\224\367~\223V\2725\246G1\255a:5\375\024\030,\235\t\245\020\352\303\267EA%\253C\244\261\302\177\372\357\347>\017\3401\351\230v\367u\321\376\261_\027\377\262\375\264\317\364&\332{\001\266\245\220fDY\201B\272*\302\343\307\177\276\360*\232\004\300\2371\234*C\313n\3676c\247\3066\343E\024\375\357\031\243\004\3570n\337|\312\247\300N\206\n\320\204\205T\226\221\254:ru\244\366\031U5@\001\271e\022\003\310T_Ua\216nZ\263\377\302\203\002 \316\205\203\324P\b\316\3109\227\3221"
+	.ascii	"\2647<\212\307\265\273\017Z\354\304\004\354\002\262\330\254\007"
+	.ascii	"g\346\3047/1\331\207\034\330L\026\233\365\340\314`=:6<\260\033"
+	.ascii	"\331\f\366B\3001\01682X\207XL\006{\371l\017W\223\034c\323\240"
+	.ascii	"\207\273\273\343\201l)\204\by\234\021\bi\315\243\266\364SDK$"
+	.ascii	"\374\306\004\227_\3436(T\220\311\343d\306\213\243\252\f\341X"
+	.ascii	"\352\231\310S\216\036bK\232\250=c!\217s\250\265\357\340\005+"
+	.ascii	" \220\002\2311\353\001\230E\021\212we\270\312\367n\020d\347\336"
+	.ascii	"\254 \024|\370\026\0320\217>L\b\266q\265\006/\255\216!\333\220"
+	.ascii	"\260\003m\236\211 \032\037J:$\013\255\253\203\277\263\206\252"
+	.ascii	"C\\\\\023\337\020g\300:\202\206\nPg\374\346\033d\037\360\307"
+	.ascii	"8\343!\020\270\371\234\006\330H\357\334W<\243\0160\n"
+	.text
+	.section	.gnu.lto_gyroUpdate.85.a50b7dd828a4ddf4,"e",@progbits
+	.string	"(\265/\375`\n\023\245<"
+	.string	"z_|\024BPdN:eSz\263\034e$\243\027y}m;}\306\315*6\036\306\307m\236\004?\036g\017k@Q\277\001\321\b\021"
+	.string	"@\204\230\001 "
+	.ascii	"\256R\323\210.o\251\032\254\215\245P\355\255\221mIJ\031\021\001"
+	.ascii	"2\001C\001\357\215\360\336\343{\257\336k\365\336\252\367Bx\357"
+	.ascii	"\203\367R\t{\035\274\267\301{\247\336+\025\354e\360\336\005\357"
+	.ascii	"U\360\336\250\367B\2757\301{\021\274\367\300{\237\336\353\364"
+	.ascii	"^\003\357-\360\336\246\3672\275\227\300{\007\274w\351\275\002"
+	.ascii	"\336\033\340\275J\357\005\360\336\244\367\"\275\367\350\275F"
+	.ascii	"\3575\276\267\370\336\242\367\022\337;|o\372^\341{\203\357\375"
+	.ascii	"{\273{\231\004\002.t\262\022\325*$\021`\325\023\332Y\331]\216"
+	.ascii	"\303\323\006L\372\307\310\023)\312o\f\247\203\335\026\213\213"
+	.ascii	"\237\221\205\273:v\215,\f\032w\271\373\207\237\315\312{p;\344"
+	.ascii	"\n\325Z\217\207\302K>22\026\213\210\303T\030|/\227\207\034\212"
+	.ascii	"\230c\\|d4\344\320\204L\t\033\223 \351b\321\232\330\221&F\255"
+	.ascii	"\211\031\351a\032\326\302\250&df\034\254#f\026\204j\343\3661"
+	.ascii	"\366\325\337\001V\034\363J\001\324Z\271\211\230Y\260\207\034"
+	.ascii	"j\255\333\31412^$\336]\300\335u\260\033\340M\274lR\026\016\237"
+	.ascii	"\344\247\307\231\236\220_\237\360\177j\305\203\370\004\005\002"
+	.ascii	"$\374\263\013~o\241O\037\330\017r\251\317\036\223\257\253\023"
+	.ascii	"=\370\2468ak^ x\317BYN4\311wz\224L\227\347g9{\252\370\316B7D"
+	.ascii	"k\255\027vC\260\035\244\005\021\\'y\244\243\224\322\353'\371"
+	.ascii	"\345q\332\355\263\326\032|\332\232H1\234\333X\311\316\032\235"
+	.ascii	"Av\366|\265\241\345\270-\301qLHE\343\366\004\303A\301\324\254"
+	.ascii	"\365\353\r\347\245`\361d\025)\0131\234\343\270\315\020\321r\366"
+	.ascii	"\246\324\354\306mX\030Ek\355b\346n\013\306S&\210\262\360n_\300"
+	.ascii	"hf\256Q\036\021\275\257s-\233a'2=\256\016\344"
+	.string	"\333-\253i>\320e4\374\346JE\243[\256\333?\304Z\271\370l\371@\312\302mf\005B\346J\255\225\212\313,\237\021\233U\254>+\225\021\r\254\021\355n\f\036\223E\254\265VX\026\303s2\226\247\260p\265j43k\244,\344\013\313\3568\341\272:\321\356\323\253\237\266\313\301\372'\273io2\355\035\221\366jH{1t\357\204\356\225\360^\254\007\234^\340O\006\276t\247S\365E\365\344\301s\307@\323\225^\340M{u\350\350\315\221\323\304\324p:\257\337@y\203\265v- p\246_\325\205\255\rx\200\023\370S`\330\331\322\005|\300\251\372\360\026\332~\232w\311\276\303F\331w\3155Ko?jv\013\355\272f\032d\3135\321$9\260\tU2\240f\237\021\360\256S\263S:\200\007x\323\036\335By\216\231$\343\225Qr\035\031\245\363\234\271\205r\\\213Afh\271$\205\216SNu\030"
+	.ascii	"\307*#\004Uk-J\336H\2306&p[\242\277\300\355\211~zI\236\341\210"
+	.ascii	"#\332\230<\267D\277=\367D\273u\333\210\363\323\331\245\331\234"
+	.ascii	"\332hi\321Y\326\360\322p\347\261\031&Y\251B\005\351\305'\265"
+	.ascii	"\224(jM(H\177GO{\342\304\350\305\037Y5\023\264%\311\343Y+1z\222"
+	.ascii	"\037 \247\261\221\264Y\037)\276\350\306.\322eI\276#\322C\212"
+	.ascii	"M\326c-&\244\203\024=\311\357\317_\37249\254\201\215\013\314"
+	.ascii	"\226\350\037`\366D\373\350\036\315\354\250\2063\230\336\341\241"
+	.ascii	"\303\032\214\355\fw\336\026!\361\335\325\\]\207\377\211\177\214"
+	.ascii	"(\020\360\220\241\253\274\322\332\312\001\343hcK\313\306\214"
+	.ascii	"\0276\2163b\264\220qTn\3318^\031X-\032/\266\2167\264\264\266"
+	.ascii	"\216\306g\027\007\353\237\354\n6\275\256{\035M8\232,(sV*\341"
+	.ascii	"\023\376:+\247\3132#\341\307\243\373\203\303:\2311s\021~<\226"
+	.ascii	"\\\\\230\b_\236^\216\037\322\035\271\372\233[\233\325\253~\345"
+	.ascii	"\354\302f\265EK\226\252\017\347\334\330A8\226+H\244\250\025&"
+	.ascii	"\337\203S\035\302\037'\354\314\213\312B\255\232S\220RR\036\334"
+	.ascii	"J\315N\255\211D\202Bu!\2419\243\006\315nO[f!>A2\264\351\204\335"
+	.ascii	"\316d\271\245Bs\311v\264\2453\303\2278\370N@\003;W\333\225,\337"
+	.string	"\210I\034\374xr\177p\rnv\304\310\313\210\fipc\0219\347\324\311\306\304\254\036\004\310\217\251?;\2513\027\312\264\364\362\036H\244\363\210\303\344{\330B\253\016\206d\360/\251\033\213\304u\255\225\313\210#ep\027a\370\354v8\027\216W\006\377]\"'\034\223a\016\026\027\034Q \240\202/\210z\202+\200\372\322\243N\325\367W\210\220_\037\024\202+=\301\233\366\006\361!3D\005%)\004RN\001Bp\2542@\347\201\357\371\351\363\364\201n\250aD\252\030D2\")(HA\n\255\001A\006\204\020bV6\007\022\200\002%FR,\211\202\217\244 i\241\375\016s\323:SVA\t\272\211\332H\215\242\315\3576q\353\342\253\275Xs\330\265\270y\345\311\373\001\231@SD\327\323W\214<\356\341\305\365\nDB\216 \315<\335\310\214\026\313-\215]A\322\332\274\2221\261\216\n\371b\345\327\230"
+	.ascii	"\200\263\226\025:i\"\314\217\311W\207\222\306\245\254<K\221\300"
+	.ascii	"\032\350\027T2o]h\033\351)6\252\270\016\316r\244\352\215\344"
+	.ascii	"U\241\230\007\204w\271\213\334+\005\321\354\305\360\361'63\334"
+	.ascii	"^\266"
+	.string	"\341w\211j\340gos\276\355\337=9\366[\264=(\345\371\306|\247\376\357$\b\220\275\224w$\277\301\210\200\260\326\211J\002\005\034\364\263\013;Ulb\367n\244ZM\336<\315\205lb\025\323\036\362\346\033A\222\201)\231.Q?x\240Q\017\225\332\362g\304&v\257F*\025\344\323\222\334\313/V1\303\260\027\223\024\f<\326\210\276\377?\f\323\024\324\232\252\023\036\360\214\n4\256\317za\020\022f\306\331\330\343\313\235\225PVW\245\3647.2/aP\034\334+Z\217k\226\203\325\351\236PP\303\350&\031N'\022\"(\211S\202\0355\307\230\235!\300\037\363\033\310\205\316 \301?^\350\332\344\367\335\236\360\223\223\235\333\304\311\007\246&8\034\031\216D\027\262Hq\260\001\001\361n*D\271\007Z\262\022\313\005M\323KO F\031\233\311?\215x\364\357\232\315*\246\317\3661~\375\004\330\264\324\273"
+	.ascii	"\023\262\315\217\250k3\312Qy|7x\255\325\273\026\223s\222\335"
+	.ascii	"CF\351y\236\262:\fV\2541^\020\260\210z\r\272\224\240k\345\203"
+	.ascii	"\223\306\3334p\234\277\021#\375$\205\371%\247\327d\346k\036\246"
+	.ascii	"\2453+\243\2169\322>`9\235\350q\2506\263D\256\241vwP\026~\233"
+	.ascii	"i\nR\b\372\212\211wR\023\313]V\316\250#\262{l \306\271^o\237"
+	.ascii	"&\3246\343\341\373\245+\272\3215\313\017\2600\322C\376\274x\363"
+	.ascii	"&M:\n\206\374b\001e\223\035\360N\322+1tw'\2763)\016O]\201\005"
+	.ascii	"4X4\323.]\234d\347\355\253$\255\221\335\344\331\222\205\023\250"
+	.ascii	";\t\fk0j"
+	.text
+	.section	.gnu.lto_filterGyro.86.a50b7dd828a4ddf4,"e",@progbits
+	.string	"(\265/\375`\022\0065 "
+	.string	"Vx\304H\220\330Q:\300\207\211\371If\302\272\363\262\252>\361\0165{9\274\013B\345\001\226tL>\347\262\262]<l\351\326\201\223\230\363\240\340\032&&\021\031\343\305\364\"\006I\327/\003\033ufx\001\254\031\233\221F\310\226;\311\255"
+	.string	"\242"
+	.string	"\263"
+	.string	"\335m\301<\311S\351\205{\356\201\317ZzpW\233I=\002E\254[\252\347\344\376\230'\327\353\003\312\223\266\013(O\356\356\322\356\230\017\177M\241I\024\221\254\273q,\304\266\374:\374\322x\3517\333Y\243\231\263\222\254L\227\366\263 \341\025\374\300x=\246\337z\324\b\t\212H\361\240\266\004A|T?gA\\\247VF`\222+\037\325k5\300\227\324\216\032\301F\317\211\322\202\370\246n\316r\274\214\202\242\344\225O\307+N\217F\345\351\356\263\367D\371[\247T\304\200eW\276\251\323YPw/\345\365|_\234\357\036\300\356f\330%\215\004X;\243<\353\264\302\236\350\232\335Uq(3\314\356\006\332;\371\223\244\375\220\223\233sA\317;\271wQ\236<\377`\t\026w\227.\330]\243\013\267\230c\354\356\t\337\272"
+	.string	"\255_\025\220\254\211\036\271\273\231\230\261v\207L\364\315@vwtN\374\336\256\365\2651\335\263\244[+\351\322J\272&\323\2351\335\222\244K2\335Z\3512\323\245\224\356\021\374\007S\231/'\f6l\034\3076\355Ev\0219\361\327\372\203\347\335s\361<\r\025X\031\201H>\334o\355\271W\362%K\327\332*\265\231l"
+	.string	"F\021\013\274\017\017V\002\367\353n:o\367\304\301\b\375|1yO\0374\230iw\207\336\205\350\313\344\013O\247n\f\251\312\n6\321c\215\261\226\026f\3560\207\321\236\333\330\006\204\333\370i^\273\273i\017n\343\035\246yQ\003U\345D\217\324\344\262\305\003\306-\273\034\243\226\016Ydd\263\231\201J\344\215\225\\y\306\207\312\342D\217Kr\311\245\033(1f\222gb\242\336d\331\242\004,;\007W*\247"
+	.string	"\256Ww\227\214\265?*\231\177U\364*G&\025\346\nSA\222\261\230\200\221\277\360\306\246l\321\347\267\213t);\006\277\223E\312&\216\224u}\330\335\225\003JH0\206\252\221\206\r\030\314%\362Y\321\"\tIHW\364b\005\222\221PN\027\343\b\247\244\313)\261(R\302\261@\032J\302\021\351\224p>\r6\327\242H\207{\221\313\351p\347\260\377f \333a\312\253\211\235vW\273\257.<\370\213-\241\307\275\225\357\026\321>\262\031\273\033\350x\341\031|\021\311\316\334N\035\346\260Z\317o7\333\215u\370TVd\240\252Nv\263\305\002\034\336f\207cd#\343WDa\236|\256/\250\201\243MUVW\023=\362\311\245\306\003\316\370\341i@"
+	.string	"\375\320\324B\334\314X\215\271\247\245\214\214\210\217\021C\033\3610Df\030\215\271g%I\016\375\360B\022'\376\002z\250a@\303\230S\204f\002\021\031IAa:\320\002\021\242\3426\0210-S\212\231\204\261\0316\003t\242\003-\275\3156\227\337%\234\277\201\321T\372\bH\233\320\232\367Y\002uaM\017\212PF\336\206\241\270[\213UN\336\253\365VRI\301\tKA\035\226 '\"\r\366\312:\356\321\316\201\324 \037\003\343\206P\036\214\302"
+	.ascii	"\031J{\\\327q\213\034-8\213^\017\342\300\255\366\254\261X\"\033"
+	.ascii	"6\311~\201B\347Gg\235\232\237\377r\210VhJ\3501\243\\\200\r=q"
+	.ascii	"\023\306\347\323\244\367)\351\340\216\326\341o\351\221\224L\032"
+	.ascii	"<R\322\005\257P\352\024\204\016\315\013\003R\002+.\314PA\364"
+	.ascii	"\363\024k+\017x\373)\\\262_P.\376\211YXB\365\216\355'w\361\317"
+	.ascii	"\033@l\360S\231UOq\021\267~v(\324\265\32038\2757\306\327\221"
+	.ascii	"\251"
+	.text
+	.section	.gnu.lto_filterGyroDebug.87.a50b7dd828a4ddf4,"e",@progbits
+	.string	"(\265/\375`F\r\r9"
+	.string	"Z]l\024A@\346Q\007!\343\306G\t\371\371\023\325\370E\264\341~:\253\223\267\037\032~E\bA\214q/\342;\325|v\300^\314OC?\377\325\247\331\321l\"\347k?|#\345\243j$m\357\275\267L)\0053\001\030\001A\001\330O4\003\311k\224\347X9+>u\227\272C\035w{\\\022G4"
+	.ascii	"\223j\333\027\217\266\303\365\257]\214\217i\272\264\335\254\271"
+	.ascii	"\f\20665v9\347\t\257\263\311\365\375\255\177\355m\356\326th\327"
+	.ascii	"\232\313\254]\320\330\345<f\345l_\275\316\366\234\023[g\201."
+	.ascii	"l\235\355\356f\367 \217\242e\bf\304\246w9g%\226\202l\354k\324"
+	.ascii	"[\210\233~DFA=\031\233\212\304\241\220iI))\210\004\374\371z\257"
+	.ascii	"\333\262+\376f\273\213\365\346_\026\007\346\347\f\231\227\037"
+	.ascii	"\335\300<\022\352Ql\016\305\026\027\346\237\036\352\3066oj\263"
+	.ascii	"\362\305*N\254\362F\345\207\253\322\332\252 \347\f\366B\027+"
+	.ascii	"J\331\024gR\363%\265\264WRC\373\244\240\231#\231\255\311,cK\036"
+	.ascii	"\350b\235\2251\361\037\335\230\2225\231sN\362>\251\2632$\336"
+	.ascii	"\3132v\344_\247\033C\""
+	.string	"\225e\314\310\273E\274\025\343A\026\366\354\020_W\003fu\204\004\311r\254\304<O\002\375\310p<v8\3776vmxgeS\374]\254\234s\277\223\254\314\033\200w\377Uw[\350\376I\003^M\247\251>\375\340s\272\\MU\316\212}\232&\327\266^w\210\305O\374&\353\252\352m\334\r\210\0261\342\3359\242u\326\345\3434\364\365yU\\.\313\357\240\345\234\037t\223p6%\326\3340\341m\320\326l\264\316b\354w\322\344\032\205\253\261\361\346\234\033\264\243\3614)\332\327\234m\025+V`\237\376\201~}\236\373\027\0318:V\374\354\241/[\3074\244\177p<\243n/\343f\226\355k\335B\353\335\351l\273V\353\254c\207s\341\230937#_\237\207s\316^\030?\273\243^\357\031C\351\336@a\201O\275\253\\\352M\305~\027X\277\t\264\337S\354\367\200\365;@\373-\305~'\335o"
+	.ascii	"\377\215\364}\037}\337F\337w\324\372\r\325~?\261\337N\356w\323"
+	.ascii	"\177\027\327ob\373=d\277\205\3547\023\373\275\364~+\261\337I"
+	.ascii	"\377\035d\277\221z\337\300\365\373\327~\373\330\357\336\373\375"
+	.ascii	"\272\337\356\372\335\266\337,\373\275\256\337\030\177\377\177"
+	.ascii	";\007\177\342U\210\356Ln\332'\f\205\335\251\323S\b',\341\217"
+	.ascii	"\334\377\310\340\243\t;\325j\f\2318\304\"f\361<\212x\255G\243"
+	.ascii	"!~v\257\216i\003\306uo\345T\230G;\025vE\322\2725\347\234\205"
+	.ascii	"\370I\2057\340\336\236Eaf`\237\367LD\004\277\343u\f1\021\033"
+	.ascii	"\323\b\207\257p\t?\365\270\222\353\311Kz\260\246\036\253\377"
+	.ascii	"\3255\254\276W\007\267\273\273 \223q\235:\r-\341$\314\204=l\016"
+	.ascii	"\330\347\265\022^\302\255\2430\273 V\302\256 \261G\217\232\312"
+	.ascii	"\300QW\201FI\330E[\317\345\234\221\360\263}\331\006\261\2375"
+	.ascii	"\335\034o\371\336\005q\204#P \022.\342DMM\320|sD]Sh\207\220\360"
+	.ascii	"\211.xr\036\3159\377\360\263a\264@\314\224\326u\005\267\203\361"
+	.ascii	"\022\002\342+9Pjw\277\200"
+	.string	"\267\246\016\253\017\270|\271\363\375\0168\240,\267S\255\363\341\0376\246\351\371\3744\325\373\364\351rB|z\330\373\374\001,\215\324z\022\260\332\213\237M\205_\314t\361\213_\220\330\243\013N\227\341\315\343\342\tV\360\334\026O\226\003\264;\3564\304\342\026\273\216\304\036\031\177\305\335\034<\264\356dq\022\007\016\\Z5T\254,.`\250\360\366\212\004/d\300\320J\301\\\316x\241\305\"\305\026\323F\013%\027s\213+\306\222K\031CK\005\f\345\n&\2272\001\201\336\222\261d*glm1\225\277hv\317\030Jw82\367\205\301\272k\315\371\214\202C\335\355\306|^;#\357n\272=\334\022X\31597\220\372\233O\321M\357\020\035\361\263=\316\253\352\242(\340^\215\013pU\225#\2530\005\354J\230\020\n3+ \246\251MN>\332\025\254\276aA\005p\317\020\034^\024\201\265o\313\212\360lS\230"
+	.string	"vJ3`jm"
+	.string	"\3668(\374l\354\313\026\211\217@\236\360\263\277h\345\036\347\032\244\216\304\250MV\276"
+	.string	"\363h7\006\300\335\235\340\273p\221\302\001\222RXI,W"
+	.string	"4!\253 \361\201\037[\314\334\214\304Mi>QV\237\257\326\224\322"
+	.string	"-\355\230\366R\242\0341&\263\203\367d\312\23791Ry&M\266\327\314\2101\331\0330P\252\367\250\2775\261\370\324\351\321O\322\324\242D\313\371\313\235\335M.\217\244\351\345\252z\244\243p\377\232\344\300^`\276H\223\215H\024\306dn\360\240E\250/{!YW\037\344\275\003\201\024\250q@\344\224c\206DDJ\222\244\220\306\321\005\204\030\306 \273\003\021\320(\207\240S3S\222Ba8t\n\025\311cSv\207\210%\343g\3277\003r\212\347\271\267\n:\301\312\241\331\231\2208\372\022\036j\325\202g\334\204|\251k\034.\377(\217\177\234\237r=\311\372z\320>\027\330"
+	.ascii	"\345\r\332n\033\231\302V\032\206\005N\030\250\036^\253{\247\263"
+	.ascii	"\337z\303\036,\016X\036\317\205\206}\272\272\031\375S\361\303"
+	.ascii	"\314\335\221\035\361\211\262E\320\250K\275F\312\320\246A\270"
+	.ascii	"@\033\220\345\\Qt\354\360Yb\350\211\363\216\030yD\337\005}\242"
+	.ascii	"\344\273\034\334\333\\\377\235\335S^\353\272\312\002x!zU_\016"
+	.ascii	"+\242\240(\3304D\215%-3p9\212\244E\272\277\344I\311hG\b\335h"
+	.ascii	"P-Iz\361\030\224\266\034r\363<\251c]\214\304F'\336\035%\227\024"
+	.ascii	">"
+	.string	"I\013J\256\007F\336Yt\252\206J\313\030]Y7\215\210l\345\235\314!\353y_BJ\240\322\250!\315'\307%r\374\240\224\371\240\320a\r\305\314y3B@\221\215\\\214\347\n%\021?\350\036$6\026o x\344\023\037\374\274\333\254\365\341\002C\f,\342\325R9'\324.<xFa\267Y\350\361\005\370\247q\031\265=\360\277]\254\214\260$\363d\316\341\3674B\342N\3104V\"\030N\"\224\254\344\252i&1i\032\345\357H\364cDd\004\312\204HG\324X\t\263+j6\017\311\224/c\025\352A\233\357\231\364{\261 b\210n\345D\364\036;\332\226\233x\205A<\330\315\241\234\376\ffk\025\372\336\341\377\273<\r!\332\370Bt\255\032\276\301\337\360\352\326\231\024)jX%w\036\363>\353\214\\\227E\026%\333\341\2003\212b\032\201ou\177-\370\207^\207\001\207NF6\007\322p\343"
+	.ascii	"i\t\374x\373\264\237^\\M\005"
+	.text
+	.section	.gnu.lto_gyroInitFilterFn.88.a50b7dd828a4ddf4,"e",@progbits
+	.string	"(\265/\375`"
+	.string	""
+	.string	"\375\006"
+	.string	"RM13Pu\032\003\200\342\270\326\352\363\030wh\250\315\1777X\233\027\253%\360\033\247MnL\366\277j\265\316\350\260mfK\217\224\312:r\213A\033\364\273I\231R\355p\242\0049\300)\343\374x&\374<4D\300\216\234\220c\320(\341\221\220\"F\t+\355~\245\005\227\021\032\231\353\215\332\211Ip\372/cm\205S,\006N\377\023\352\023\243\200\352\020S\275\b9c\246\352\020\200)\006\216\226\021\314\312\306\345\266V\023\271\347\321z\363Wj\037D\t)#\263i\373I[\315_(\026\221\266\256j\2651\326@^@\322\201\2412\363\037\276\017[vVm\023\013`\231\310.@\341\177\035\226i\270\317m\017\332\"\2645\005\b"
+	.ascii	"3\001_8c\b\3365\256\211s!\340\227!\300\245[\264\363\t"
+	.text
+	.section	.gnu.lto_gyroFiltering.89.a50b7dd828a4ddf4,"e",@progbits
+	.string	"(\265/\375`\003!\005d"
+	.ascii	"\372\235\220\"H \316b\351\307\006\272\034\341\013`\2332\2504"
+	.ascii	"\001\017Q9,\321\367\361CP\316\201\344n\204\347\026\262oZ\021"
+	.ascii	"\\t\330'y` \030 \317\320\224\377\211\205\254\230\372I.%X\245"
+	.ascii	"\f7\225t\245w\025\021\271\367N)\245\003\002\340\0015\002\316"
+	.ascii	"KKg%\353\234d\235\221\254\363\221\352l\264t.\262\316\033\254"
+	.ascii	"3\221u\036R\235\205T\347\240w\006R\235\177\226\316>\326Y\203"
+	.ascii	"u\356\261\316<\252\363\316\322Y\307:\347Xg\034\353\274T\235\255"
+	.ascii	"\352\254\276s\372\316h\352\374\250\263\277s\367\b<3\030\221\353"
+	.ascii	"#k\356\205\253ts\031\323,I:J3\267 7a\024F\354;w\033\207\263\211"
+	.ascii	"\0273\367\336\252N\371k\331)w\n=\250A\013\362\326\335\242N\247"
+	.ascii	"\314\0320\353t\352:\314\334\316\334O\372om\300\r\030\347\336"
+	.ascii	" \200W\356\025\274\342\251e\247M=\244v\212v\220\332)\257\314"
+	.ascii	"\221-\350\274IL\2367\b'\357\275Y\257\307\337\250`\263\227\257"
+	.ascii	"\r\366\345\325\025\366\201kK+\013\353\312\252\212jJ*\n\312C\207"
+	.ascii	"'\016NMLKJIHGFE\033\210\206\204\202\200~|4\364\360\354\350\344"
+	.ascii	"\340,\255\232\242\357+\267%\303y\223Sk\260\311\376B}$Q-\3022"
+	.ascii	"\356e\311\210\314EvW\257Ev\330d\23086\376\001\262\271 \003\311"
+	.ascii	"\370\226%\233{l\255\036l\364\254%q\217\213\216\365\b\306\257"
+	.ascii	"\254\236\212^\365\245\251\276x\361\251.-\325\205\213G\0356\324"
+	.ascii	"\241\241{\260\322\035\254T\361'*\315\201\312\n\3564\245\233\246"
+	.ascii	"\024:S`/\005\002\272\322_'\375=q$\277>\362s\342F}]\324\207\202"
+	.ascii	"o z\"\361\241#-t\304\210\007\3615\020_\021\377\331k\237=\247"
+	.ascii	"kxv\317\023\317y|\364\216\217\036\256s\3279wv\216c\311\346x\364"
+	.ascii	"\022\245\302S\f\241\303\304\361@\207Z\020\002\331\201\355\264"
+	.ascii	"$\256\316m\022\325'H\334\017\325\347\206\352\343\024$\356\211"
+	.ascii	"\252a\342\236h\323\275\327\315S\272Fs\344\350\372\321!8$o=rm"
+	.ascii	"(\225\031,j:\260=\207\034\233\273%\273\367\262\277\311\3155\213"
+	.ascii	"53\312\305\314 \230\225p\004\235\026!\276\241Y\363J\253~,kH\347"
+	.ascii	"\275\027\214yD;\2325\030\022\335\310\354\304\022=\346\254\253"
+	.ascii	"4v\n\203\372\r\271\227e\315+;\307\f\0265\313o\362P\243\251\351"
+	.ascii	"7\221\016\323b\320\270\215\260\211\023'\324N\323\267aW\331W\267"
+	.ascii	"\346\225\334\\\272\013\311\314\300\250\346\224\366\233\213\334"
+	.ascii	"\214\356B7\204&=\314(r?\273\211\016%7\257\013\267\027\216\\\336"
+	.ascii	"\253\326x\334J\235w\231P*\271\367N\365\026n\274\245\363\306]"
+	.ascii	"\301;\305\225\327\201\277a\346\024\215\210\246\005}\026vo\356"
+	.ascii	"\275W\255\241\376\303\200\362\250\242\261\324\270\362/fG\231"
+	.ascii	"\362\n\f\274\337x\002-\214l\257\306Z\376Pp\242@\314\225\307\366"
+	.ascii	"j\314\334\242\255\270\250\342/f\227\246\257\371\006U\340\362"
+	.ascii	"\337df4\265\037\006\024\3076o\303\314/z\n\332\362\336\353\305"
+	.ascii	"\255B\027\306\3406\322)K \303\373M\206\332i\277\230\235$\033"
+	.ascii	"\3005\257d\026dk\277\367\252\3717\231\333\357\275j\374C\230;"
+	.ascii	"Js\3235`w\307\245\316\r\327Q\232a\3448\277\310q\216\300:\273"
+	.ascii	"\260\316\020X\347\026\326\371\001\034g\007\2543\013\353\274\302"
+	.ascii	":7`\235U\244\316\f\244\316)Rg\024\357|Bu^`\351l\302:+`\235\317"
+	.ascii	"\254s\002\326\271\204uF\300:3\255\363\001\2523\211\245\263\001"
+	.ascii	"\326\331\314:\027`\235GXg\002\254s\231u\036\300:\213P\235\311"
+	.ascii	"\226\316!\254\363\230u\026\300:\007`\235AXg1\353\034f\235\301"
+	.ascii	"T\347\257\245\263\227u\356\262\316\037\2543\227\352\274\265t"
+	.ascii	"\006\300:kY"
+	.string	"\347,\353\214\245:_-\235\255\254s\225u\246\262\316S\252\263\324\3229\312:CYg\017\326\271\203\352\374\244:sP\235\235T\347\246wfR\003g\376\374>\020\357k\034\263\204=\330\213\375\022\3427q\376\tL\227\342|&g\355\306\371&\204\275\033\356\375\022\347\223\340|%\314^t~\222\263Ft>\022\260o\311=\251o2Q\243\251M\242\276\236\257\210\327\177uy}x\256\357\322#\322\034\362!\b\220\274\037x\\P%x\330\372\036\177\007\300oi\001\220\365X\257\365u#0]\212\bO\227\365;~\356\345\230\275\370qpX\035\222<}S\307\177`\365WUVT?\365U\217\343=\370\033\357Fu\365m\317\366k\257\366w\212\303\344\223\317I\352\337PF\275\024T\224\207\357\360Pm\3300]\312\344\032\0172\244\211\201\331\213h\316th\232|\3521=IFB\222ytl|Zz\nQ\342"
+	.ascii	"\303\013b\302\2305\230\026\230\235\310\270\310!\251\022\311\351"
+	.ascii	"\237\212^\272p\331\222\350t\3044\203Q\323ka\001\313\025\263\006"
+	.ascii	"s\310\354DC+MELT\230\336\306\235!\0330-\025\331\307\250\346\224"
+	.ascii	"\033\226\246\024*\375R\222\022\322\037}\022a\024(\203H\202\201"
+	.ascii	"\200\314^\374{rD49f\310\310I_\321\033m(\"\372\241\337p\002\023"
+	.ascii	"\246K1\241\004\"'\301\225$a\366\"\222#CB@b\202\204\260\234\257"
+	.ascii	"l\314Y\304\251G\2449D\b(\360'\310\363<H\331\230\023\2107#\252"
+	.ascii	"\216\347>\314\032L\017f'\256I\374\316\355\202|\200\274\016\350"
+	.ascii	"m\334\251\360\245\2730\362N\303\317\213@\347\363?\032|z\236\347"
+	.ascii	"5\314\311\305\301\365\\\271\016\377\300s\370\233\343\340\351"
+	.ascii	"\231l=\236\035+\277Q\026\242\321\335\372\r\215\316\357|Q\231"
+	.ascii	"\033o\242<\347\231\327\022V&j\277\351|S\333\2531\316/?\347\215"
+	.ascii	"\b\335\226\260ye\023g\343C7ld\022\276\306t)\256v\326n\374\342"
+	.ascii	"\274\033:\002\276\341\303\226l\\\373\232r\365\3531n\230\2758"
+	.ascii	"\303Y#\266Y~K:\356|\223\267\032MU\024\242c\177\215\232\253N\023"
+	.ascii	"\003\2323fl\3167\271]\350\364S\271-\2258\352G\226\2155d\227Y"
+	.ascii	"\377\326@\021\"\3244d\330x\201\322H\021\203\002\031(.\250 FZ"
+	.ascii	"Z\r4\036F\303\232\221\226\201\004Y4\322f\320\250 \006\215\254"
+	.ascii	"\nd\274\240 \013-\215F\026\326\021\317\260 FZ\326\0053f\244e"
+	.ascii	"\351\b\256\265\337\037\302K\311/\214k\317\006\366\315ov\004\377"
+	.ascii	"\342\333\r\217\r\r\202\na\304\033\254\205\265\250\235F\360\035"
+	.ascii	"(\311\246\356\353\233\254S\244\253\351>-\022V\3250>\007\303x"
+	.ascii	"'\002\345\261\315\3334z\277\t\343\233\356\211\240\374mq\303c"
+	.ascii	"\313\343\303\244\306\037@l\177\222.\336\007\037B9{@\360*\336"
+	.ascii	"\305\247O7<\266\303\276\314\350\275kO-\036\202\007\236\305\267"
+	.ascii	"\370v[\342\300?\360I\204nf\326\274\022\007\312c\315Q\347\300"
+	.ascii	"\367\230=\300\025\337\300\263x#+nxl\"\360a+\352@\351V\277>DC"
+	.ascii	"X\361\2558'\007\267\356h\340\233p/\013\007NP8>\\\242:P\020V?"
+	.ascii	"\271u\307\016\265S\025\337\204\235\326\335E\366\375w}\223;\354"
+	.ascii	"\2070\220\343\007\003\217\004\331\345\003]\027J\3361\266q\245"
+	.ascii	"\360`\204\025H\212\357\300\376\001\243\004\317\307\026\227w\334"
+	.ascii	"s\017\256w\253\217\035\026\3160\266\275\232V\303\241mh\0075\326"
+	.ascii	"\037+\020 j\247\r\367=\330\316C\357\t"
+	.string	"\336_\035\0136\2634\212\367\023\204\240k5P5\024\217\345\330X\337\344^\365\324\023k\363\337\254z\313{\333\274\370\335<\345\272\307\267\036\361~[\217\250\235\236x\026w\213}\200\211\335Ny\265\300\267ac\342\027P\300\304\331#\360\n$\360%\376L\215\fibH\340\214\031\311\3102%\230\177\300#@\346\321\261\221\t\303\013.\210\ts\200U`\3257\231q\321\200'af@\001_\366f#\236\200/@\361\213\227.#\266$\"ja\201\200\001^\304\227a\271rh8@\025*+L)\024A\365M#\3557E\366R\312\306\2360\304\223}\321s,\204"
+	.string	"/\366c_$\203\233\222"
+	.string	"\036\304\013\360Y\317A>\374\304\024\230o(x\366Q\032\003\003\370Ot\374\343C_\363OV?\227\364c\372\030'\001\202}\250\262\2401\017RfFDDD\222\202$i\f\"\r\b!\212A\211q\007\022@\342$\204\322 \2149Y\211A\252u\003\223\210W\252\370\206\022\272\027\034\255"
+	.ascii	"%\256\207\231%t\356\355\207 \b\266\332\320\021\376\023y\230\351"
+	.ascii	"\225\227\243\302\035\302\351\276\347\230h\275E\215\314T\275\033"
+	.ascii	"5\344&\376$k\272\313\005\203&\317\322\233\346\235\231\241"
+	.string	"\217 E\377\335j2\204\27404%b\254\347u\001o\307Ht\212\351\223\215\307aU\261L\004\371E\224f\245\037\357F\3717\360\272\211\200\276.\214\345\033\207\257KB|\247\250\311\320\225\253T\007~\324\240\312\001\245\370\017\0378\240s\030I'\n\354\275\323\216\030\243F\263\255\235\t-\305\365\330\315\274H\266Gmd\331\350lh\206\371\253P\304\240\321!+=;\013\355\"\255\036\241\035]\260tT\336g\257\255\325U\342\354H\372\3154\316wEN\272\344\343.s\343\363\357\270\307 \b\230\305\246e\026B\371I\020C\bf\361\323\341\345j\305\333\352\263c\007\217G\3170\314\032*k\220\316\375\314\3747n\241{_\276o\214\0264\006\364\350\315\030\343\263\306K?o\235\311\313{!\353\232O\301\266W\350\324\236\207\003\262\356\357\246\177\fv\343ov\274c\201\351\032\f\304\0206\200\307\316%*\202\242\227\260"
+	.string	"b5\316\201Ip\242\262\312,\311{\037\204\351n4\330\217\276Q\3212l\206wL\342|\227\254\277?^\207\033\203hf\002\030\263\223\236\312\bH\377[\330\212\371\331\b\033\3177h\371Ge\241\257\306r\270\374H\207\016\"\330\220\212r\373\265A\320\236\t>\211\321a\034\262"
+	.ascii	"\223\203\013(.\210\017\223\346H\270L\2176\207\224\b)\217s=\r"
+	.ascii	"\267\222\232\373\337\240\300+\203\263\312\341\340&\315\270v\027"
+	.ascii	"\177\367w\0314\255o$\217\032\265E\007\203\332\002\t73cj\354-"
+	.ascii	"*'"
+	.string	"\344\027\230f\276\3412\n\026\200274\321\362=\336\327\374\305\203\306\364Re\261i\236\364\211\373\021x\003u\224\301\233\243\312{n\336\3557\357\353\005\274\346\323l\243T\253+\177k>\020\216\021LV\301\271\256\332\254\322\275W\366\373\3235\256\337WR\331\257\221\366`\373\277\330/\304\316\311\376Q\277\267P\316\bJ\302\272\274\004\254\027?\003\bm\006\216\017\2777C\247\\\353qz*\307Q@\260A\001\026}$R&\313UI\313\350\311\222\271\304\f\020~\351\333\257\332\373\032\025-\242\244\377\316We\204\323\362w\235O YP6\3402`9\270\003L\026{K\367\202\353z\223*\333\222\260\320-\027\0016\352Gs,\200\337$\0277+-\345n2k\r\0064\020\355L+\340\245\235\335sy#\331:\023;:w\307\331\242\030\374\231\2171\375\353\017\374+\214\356\350\t\245pIbQ\313\202\304v\242\356"
+	.string	"\345\332\365\312]edz\301-\347a\252\r\226T\242\361I\270p\013AOz\263\226\261\265y\227\305e\305\034\252tq-/;H.\242\344\323%\232\341\345\200tqlo0R\210+\364p\0202:\030 \214\335`\244\326Ad\220\2469\024N\340\"\\\001vb\321\222\037\206\0321"
+	.ascii	"\032J&\337T\214\027i>\271\332\231\374\013\225\376,\316=+z\301"
+	.ascii	"J\315\311\343*g\022\034#Q\022\"\225\364\320s\344\272\240\263"
+	.ascii	"\r\250\"\\\225\266\214~\315\267\367\2767B\214\320P\223[F\277"
+	.ascii	"\356\333{\337\0331Fj\251\311\337\207kle\311\367n_\341y!\342H"
+	.ascii	"\215:\271\261OoD\263\007\\\035m\020<\262~&\211\2528M\320z\342"
+	.ascii	"\360\032V\361!"
+	.text
+	.section	.gnu.lto_gyroGetAccumulationAverage.90.a50b7dd828a4ddf4,"e",@progbits
+	.string	"(\265/\375`\260\003m\032"
+	.string	"\206\362\253I\240\230Q:\217\342q`\223\364\210\314D\277\330\224<\002\377\177RJ\344\020@\353\366\202\f\334 \035\bW\033\377\374\343a\247f\277\024\003o\377\021\362V\030\035v\2004n\273y}\203\r\236\266\327G\261\216A\b\331[\356\224\002\224"
+	.string	"\215"
+	.string	"\226"
+	.string	"\265\366bNma<M0\245}c\253lKi_\350?n>d\245\017\250\265\006\260H\255\275\007n0\236\272w\002\341\351\370Ux*a\302\215k\357\361X\274"
+	.string	"M\311\025=\325\332c\355\r\357g\357\246\265\255}\024C:W\326\374\026\035\316\307\333z.\376\236\001\nR\222\020\324\f\236\236\207S"
+	.string	"nF8\312\221T\207\213OQ\346\350s\207\317\324\255i\210\316\3057\200.7\023\324ZOt\271\243\273I)\312\324Z-ut<7\313m\337\260\r\302^\031\001\362:\247\276\231\302\323\357\211\256@\347$J\214\037=6\031\264{8rw\366e\255\025\307[\303\206\271\357~\371\320\277\262\264\313\221n"
+	.string	"7\272U\241t\213\224f\021\245GQZ\f\245\303P\232R\351i\351\245\322rJ\337"
+	.ascii	"\202\244\033\224\037\320\3236\365*\213`T}B\227r\034\3517\372"
+	.ascii	"}_\373BfE\252\223\006R\022\241\240\"\377\310*#\037\341\001E9"
+	.ascii	"\325Z;\214\357\371?\253N} \017rs\237\212W\236\372\025O\200\256"
+	.ascii	"8\005\0062\340)y\017\237`\320S\313\372HL\030\270\200\367\343"
+	.ascii	"[IJ\207J\270t[\226\214\273Z\226=\216\307\274\231\204\342\216"
+	.ascii	"{\325\212;\213rS/\033.\214\024\316\311&\203$\316d`\005\177\351"
+	.ascii	"FB\264\\\256\360\224\356\217\216\241\205\317\024\324\222M\006"
+	.ascii	"w\347\\\271/\273E\270\0357\031\364w\356\201&\271)\277^df\254"
+	.ascii	"\265R\360\225\016\204\371?\247.\021\213\205\247r\377;\006*>R"
+	.ascii	"PC\257\265\326\335]\314\277\""
+	.string	"|Rr\244\025\373D\236\344#\376\217ef\n4X\212\326\244qx\305`\033jh^\261\327\314\206\326zi\030\361B\360\232i\315^(.\320\310`5-\02361\033\227\253\265\262\013\202l\246b\206E\233\311h4/\032\213\006\326\212\261\\3\032\013\302\001\313N\274f\254\032\231l\306R\365\352\247\270c\224\217\025G\300\360\257\205..k\031\333\336\306\335\371B\316\302\363\261\223\003\312\230\003\330\035{%Wk{\370 \257\26329\213sqwM\376;}\001\343\027T%\334\235U8&\314R\034\033s\325\356<\270j\245\215O\352\340\252\205\331\002>\242&\\\214\033P\301\222D\25018\344\004N!cJd\202\031M\222\264\001\220\002\031\262b\007\020xW\222\244\320\030|\243\346j\252\247D<\3364\343+\023\r\232\341\236\240w\037\0051\204\225\262\205\343\b\213\341\324\210e\352\230\005\277O\316c/\377v"
+	.ascii	"\004\201\366%\250\310j\021g\001\323S\272V\025\177\027\375\221"
+	.ascii	"%+~\372\274\004\006>\212\302\023\316\203\310$\374E\215\376g\347"
+	.ascii	"\305\245\263\032\272C\355>{\210\320<@QvG\362\215\007\335\254"
+	.ascii	"\362ZA6\342\t\353\271()\263u/p^}+7h\250"
+	.text
+	.section	.gnu.lto_gyroReadSensorTemperature.91.a50b7dd828a4ddf4,"e",@progbits
+	.string	"(\265/\375`\376"
+	.string	"\245\f"
+	.string	"6VSB"
+	.string	"Q5\0358\026\004:(\n\364\367\346\226\310\262\333;\005\315\342r\272\360\315\225\276\323+\234\370h\215 \322F\006&\0239`\003U\022\274j\375\377\356\2653\322\036\\YXM}hZ\251\356M\366N)="
+	.string	"@"
+	.string	"?"
+	.string	"\273\\\310+\333\353<e{\245#\016^\243\023\364\277:\203\326k&\032\303k!N5\312hEl2\2024\004\261\023\351\253O\016\343g\316\016\005\273\353)\032A\334\365\266\027\330N`\277\023\324\344J\247\277MHt\030\377\232\261\353a\226ca5F\t\333\036[b{N\373\252\237\360\274\314p\221]Q\366b\367\203\305\007<^GJ\322\266\237\272\t\217A\003!1,\200\"m@ac\003\344Y\220\254\247\350,\344\356^\204\361\251\357\252\221\202\205h8c\247\021\f\352o;}\320\242\001\2328lSx\353\023`w\276\272P\221\355.\346\365\324B\251\005J%\316\231]\206\223\212\260\257m^\367q4\r>\234\271t\036\006\b\334\347u\037G\363q\234\b\0166\\\306\373\270K"
+	.string	"w\0234\036W\241\353<NR\356\265\245\246J\t\210\364c\025\340"
+	.string	"\022"
+	.string	"Y\251\206\222\213\033\232d\236\365\227\004\020\331\346.\3602\002\033"
+	.ascii	"X\211\"\023/\302h\241\217]\204@\300\3060\024\312\344-\2038Me"
+	.ascii	"c:\300\030c\210!;\f\206\204\244\320\320\210\025\324\260\002/"
+	.ascii	"\"\273&\nM\264\225\006.\312\004\222\324\b@\352\240U-M\321\024"
+	.ascii	"\024"
+	.text
+	.section	.gnu.lto_gyroReadTemperature.92.a50b7dd828a4ddf4,"e",@progbits
+	.string	"(\265/\375`\007\b\r\""
+	.string	"f\267\302H\240\230Uc\216\bPr\375\326\304ld\346!ch\313\027`\357\250\2143\207a\002\274ap\274\275\237\366\016\2016`\223\257~\366z\364\215a\301W\204O`\035vx\rt\3041\270\005\270Or\251\355\332\367\377\336R\246\024\260"
+	.string	"\241"
+	.string	"\260"
+	.string	">\323\203\364\274\330\343p\323#b\221\326\275\277\007?]\203\376\024P<\001\330\317:\374\f\354\247\335c\247?\315\324>\266\226\027\207\327"
+	.string	"\221\206\t\2500\367\336\233\235q\237\333j\264t&Cc\260\323\264\325\307_@\245\364\001\177n;\346\250\3058-FRXS\030\237\301@^\201\216_Q\225\231\304\245\034\250\002\244 \321c\227\362#2\232\250\260\030\005\245\243S\2107\270 \005\215~\266\270i\316\274\240\312\262\001\205L\007Y;\212\036\365\212\002X\242\332\027C3`\020\f\300\275\367H?#\263\306(\334{]}\300\340-s\373\001lG\260c=\002G\227h\003\307\275\267\306\210o\204\016\357\357\026oMz$T\307\330\366\360\"\037\320{\257\004\177\310\211\350\374\032?\035\202W\357\343\301~\336b\020&!2\001\325/\273\030Tm\222}\363Z\031\266Y-sV\333\314\352\332YM3\253\323\263zfV\313\316j\324\254\256\266\372\tl:\260"
+	.string	"\217T\336\273\342\253\353b\235V7~\374\247\376\246\377\351\246\375$\225\255\013y\364\205\304\254\204\3120\376\222\235FA=(\274\362q 7\366|\311wzP\370$\365\233|^\354\375\016\3754\020i4\370\351Z\035\316\371\322\350\334\235f\366F\233k\365\2664]\235\301\362\013Lf},\317\202\363k8\303\315\r\354\247\365\362-{\346\275H\023\376\364+\375\f\n\257\210ZN\365\313Vp4\303\0022KB8\204\353\034P/u*7\264*8\317\302\035\311\223\303K}\312\206\007C\237\004\243\326?.\225\260\204\354\217\227Pe\3610m\222u`\250\345`\274R\242\212\361\243\234\363(:\b\242\234;T\007\002U~\242\366Q7\267\204U;W\366\240\374\351\016\360#\3371\301\372\251^\267M|'\225I\211\277\344?p\334#$~\022kA\357\375\271\221\217"
+	.ascii	"\366\363\001;\035\217'g3\263\016\004\335nD\207\033o\247\343\361"
+	.ascii	"\344x7\236\235\234\0177\235\035\357\006\341\200u r\273\233\b"
+	.ascii	"\235nwK\213@7\257\225\201vq\201\005d\203|\253\337\264\325Jt\245"
+	.ascii	"\317x\371\2262\266f\253\265\220\034\332\n\232\272\320\325\002"
+	.ascii	"G3\254\325\252*\213\244qj\260\252\376h4Z\3229UE\322\271S\321"
+	.ascii	"\354\22365E\317*\207\025\305\324\361\227z\005+\241\362\004\216"
+	.ascii	"f(\223"
+	.string	"N\325!\244q\252\320T\r\262\315lH\347\324\037\244s\027b\263G\036\275\363\257\336\230#\2233Xz\311\322\256\246'\\\\8\232a\212>\035\214\3218\337\3622\213\331$)\237\031\003\200\253\250\301H\304\030\033\231\221\024\224\024\244\220\016\360\002\221\031Z7\022 3=\n\004\271\232\200&(\254\3757X\362\003\033`$\225\2606\020\374T\214\256#C=6}\3751\030\034\314\263\264mp|\223\202\337z\341*\221c\214\210Mz\036\034c\203-\365\347\366\005\330\323\243\217q,\200\233%\332M\315\177=q\226\370a:a\022\235\033~\372\320\030\245\007*\024\371\322\3674\303J\350U\037\216\371\263\244ss\264\233\232\377^\245\357f'\275?\252\330<\372\232<b\365\216\361\201Y\237V\224U\214\334\301:h\301\262\003F?x\331\302\323\273\336X<Ht\220?o\r\250\231\243\305oD\333\321\te\350l4\276"
+	.ascii	"9\3414!\030Gh\323\023\032\240\340\352w\330\331\247\270\207\035"
+	.ascii	"\241\201\211\353 \275?\275\361L'\371\367\240\034\332}|\350\337"
+	.ascii	"\3243)\"\337\323\251\351L\272\021\272\246wR\305\t\245\200\033"
+	.ascii	"\250\\\211\355\366\315\227\321-\016\221\262!>\037\007\344\217"
+	.ascii	"S[\323\372\210~\355\250M\0361_}\357d:T\270B\216\311[\353KF\361"
+	.ascii	"c5\303\244\371\017"
+	.text
+	.section	.gnu.lto_gyroGetTemperature.93.a50b7dd828a4ddf4,"e",@progbits
+	.string	"(\265/\375 \365\265\006"
+	.string	"\362\f/3`m\322\001\300\016"
+	.string	"\005\224\030\023\377\007=\363\f\013b\240\211\221a@#\304Z\013"
+	.string	":\026S\027\306C\020\033P)\004\354\245;\362\273\365\322\264\233\224)\005\316`\334\34344\370\034\334h`\33380<\264\314\203\rc`\007\241y-\302\271\327,\326^A\251\007\223~\354\213\334\212\376\2069\235<u\346w\242\263\324\200\213)/\333\222R3\354WVA\266\323\251\002\035\024\325C'\273\025W\312\232\260\022\016\333\036\333\342\177\034\304\343x\221\230$\004\017\222\211\021\224\335m\003/\210\316\362\004\321\231j<>\243\377\220/|B\027UIO"
+	.string	"\205\335uR\225\305\255\267\235`\373b\033#\b"
+	.ascii	"2\003\316:#h\b\3055\2617\"g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_gyroOverflowDetected.94.a50b7dd828a4ddf4,"e",@progbits
+	.string	"(\265/\375 \347m\006"
+	.string	"\022\314,3Pm\222\016$\2233\312\021c\275T\325\b\325\352"
+	.string	",\3322\272\361\024\326\354\337\355\325\243#\224~\361\317\316L1\020\211\342-<\f\303\340\250q\213d\313\024_,\356i\036\332\364\334\224\301L-\003\341\020\321.oj\026\203\235\004\346\265\t\347^\253\\Y\026Bv\340a\237\357GA\250+Z\263\301V\225\356&\240\022\262\201\013\017\246\374\325A\206\361\005H\026\372qd\004\035\"\253#\222LP\nJ\226H\"\033?\347++,p\246zi\200\n8F(BN2\257\3062J\025\251[\2176|F&\225\325)\n0d\346XY\026\235\365G\370\023\376\212\b"
+	.ascii	"2\003\316:#h\b\3055\2610\"/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_gyroYawSpinDetected.95.a50b7dd828a4ddf4,"e",@progbits
+	.string	"(\265/\375 \347m\006"
+	.string	"\022\314,3Pm\222\016\244DXi\316 \260\262\226\314@C\020F\321j\264[)\254\331\277\333\253GG(\375\342\237\235\231b \022\305[x\030\206\301Q\343\026\311\226)[*\356e\036\332\364\334\204\271L\r\003\341\020\321,oj\025\203\235\304\345\265\t\347^\243\\Y\006Bv\320a\236\257G?\250\273qF\203\255*]M@%d\003\027\035<\371\213\203\f\343\013\220\f\364\343\310\bB#\253\242\221\314\317\211I\212H!\034\377\346)+,l\246zi|\n:F\024 %\231Wc\031\245\212\324m\250\r\036\021Ieq\212\002\f\2319V\226Eg\375\021\376\204\277\"\b"
+	.ascii	"2\003\316:#h\b\3055\2610\"/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_gyroAbsRateDps.96.a50b7dd828a4ddf4,"e",@progbits
+	.string	"(\265/\375`g"
+	.string	"\255\t"
+	.string	"\326\222C< \345*\035\34082"
+	.string	"\356\225\004\001\247\031\bC\212T\207@6\341\267\001\030\374\013\321z\273?\262\355#\324b\364\201\006\020\020\312\n\023\260D\226\340\231\32702\202\205\030\331D\312\224\0023"
+	.string	"1"
+	.string	"1"
+	.string	"&\237:\031)TGD\200F\214\266\033v\005?\340\036\363\006\334\243~\374\364<\371?\371\203J\026\303j\241\236\002\016\273\353d\2658n\275m\005\333\036\373\231\233\246S\323\347\b`\257\326e.\273\033\265\001\373\022g!\266M\266\306v\246}\223\303L\017\315\342\201\335\216\222\225\335\365x!\363\310\331l\373#'\t\266\305U,\333"
+	.string	"\330\335\006\333{l\002\001dw\031P\236\002\372\257GW\224\362\254G\277\304=^7\001f\251\254\331!*\325\303\376\266\352r|\370\007\340\350\002\2649\364\361>\f\210\016\374<\220$\002;\322\b\024\321\205>\260\373$\330\223\020}\035\205\347}\235&\334o\253\256\250\234\224\252\234\032\365\253\226k\352aV\264\r"
+	.ascii	"2\241\031h`DC5\021\274 \334\230MK\\\023M&\032\247\006\351\300"
+	.ascii	"\004\001'\214T+&a\222\001"
+	.text
+	.section	.gnu.lto_dynThrottle.97.a50b7dd828a4ddf4,"e",@progbits
+	.string	"(\265/\375`\221"
+	.string	"\335\t"
+	.string	"\366\221@9@\305(\035\365\245\371\3315\333S@\245\2454\275\330g\262$\272\204%\227`\206\200\317\354\377\\\r&t\245@\230\251IWQ\246UD"
+	.string	"@\004\354\207Qo\376O\366\2262\2450"
+	.string	"-"
+	.string	"/"
+	.string	"\035H\310\301I##e\300\356^\232\027X\217\360\004\326\243~\234{r\376O\376\200\242b\031\221>\317\213\303\356:G\244\216[o;\3016\203\375M\206O\353\323\371\3641\360\264q"
+	.string	"-\273\034\037\201]\305\025\021\333\234\235\311\243\354y`WU\242\262\273\013V\300<\332\366O7\341l\017\006\031 \325\336SUS\242\021\357\246\224i\265n\370\276\002\030\273 \204k\252\225\212\032\365\n\005\210HB\371\331\335'\325\303>\\-YG\375\361\031\035\212m\3032\211\rc\316\006\313.\".-\3034OG\273<\023\020\025\027'\323\256\215\2011\213Nvm\030\226]\231n\017WK\226j@\032\352\240ZzQ\205\032\025"
+	.ascii	"2\241e(\360\376\243\242\020n*\013p5\025\245\030a\024\027\"\250"
+	.ascii	"\274D\265B\225\030\\\3355\346X\256\341\"\023X[\257\340\301\222"
+	.ascii	"(\313\006\2402\232\332\371\004"
+	.text
+	.section	.gnu.lto_dynLpfGyroUpdate.98.a50b7dd828a4ddf4,"e",@progbits
+	.string	"(\265/\375`\345\005\035\""
+	.string	"\026}\323H\200XN:\177\0058\022{\232\021\236\016\230\223<\366n\261\323\237x\326\361v\233\313\241~o\335Qe\365\003\345\206\372vW\001\203\005\025\317\t\303\362\001\346\227\321\312g\003\257S&\037\247\336\021\317R3k\t!D\312$\003\272"
+	.string	"\256"
+	.string	"\303"
+	.string	"O\362\261\025\027\333`V\255\365_\373\260\365-\030\323+U}\213\344VU\262\326/\0027\327\300\356\346\356\212]\337M\366\355\356y\367H\316\225\276k\317\226W\353\032\027Z\255\265\300\n\330\335\004:\200\363fy\236\363\346\246\273_\376\225U\201[/\244\306\344j\255\301\346\361\364\276\036o\207\236f\331\234\356\321#\336\021\331t\037z\324\013\302AE\343<\0323x\367\266)+\"SU\214\242G8\250\254~\312\270i|Y\024\227\345"
+	.ascii	"\033Ub\374\220R%\200,9\342|H(\356\260\007\265MY\225@\265\326"
+	.ascii	"{\235] \237\230\321\243Z\353\362\021I\365\265\371\356\222\355"
+	.ascii	"\356\203]\363,f\306\344v8\232\2073\356\207=\002\231\253&Z\\k"
+	.ascii	"m\352\025\236o\020apPL\267\273\037\336D\270\253\265\036\330/"
+	.ascii	"9\023\244\375\217\233\233\244\304?*\2357\337\013\256\310\346"
+	.ascii	"\272\234\270n\367\353\211\033k\367em\035D\347\035:\257\320y\203"
+	.ascii	"N\366\3759\330\327\347\274=\357\372\201\347\345\351\361\356\360"
+	.ascii	"xuL\336\234\363\342\234\367w\336\233\036\257\r\217\327g\362\366"
+	.ascii	"P^\036\312\273;/z\336s\307k\236\274%\312\333'/\233\274/\372\301"
+	.ascii	"\305!\277v\246V\030ui*\233\371$\310\311~\260\335\213\355\313"
+	.ascii	"\326G\226\202\263l\331\252\221\254\2652\b6}\323g\031\n\327R\241"
+	.ascii	"\315\246_\343\312\211V\327\351k+g\263\200 \253\326\232`\177\345"
+	.ascii	"X.`\310\220\341\274\311\337\264\363\346\217b|\332\327\250\333"
+	.ascii	"\0030QCf6\326\022\270\360\354\365w\354\245|\212p\377c5l\330p"
+	.ascii	"\336\354\365\313^\312]\231\315U\255Z\024\f!\345;I\\\227\2607"
+	.ascii	"^\373t\273\031\257\354\272\233\3277\232A{\327\246\231\324\032"
+	.ascii	"\242>\033\355\233}6\320\315\230,\333\354K\255\341\360(i\245\221"
+	.ascii	"\257\241&j4M\250\201=\324\354%\250\367\354,\324\235f\024\362"
+	.ascii	"t\366\036i=\330\3526\250\253[\003U\253\323PO\007\365\231\006"
+	.ascii	"l`\367\364\307\216!lM\315H\344\211\353\226\273\333\fE\bC\"S\322"
+	.ascii	"y\002\211\030!D\210a\021\205\260\2074\242X\034\022E\024w+4\032"
+	.ascii	"\022\231\222\202K\304\341R\t\244\245`\t\245\017$\202B\342R\320"
+	.ascii	"\310g\207&\220\210\301\342pH\f\372\276\234^\326\326\341\365\263"
+	.ascii	"0\243\306\346\324O\276\306\342\235\346\351\213\235.\365\001\344"
+	.ascii	"si\020\2713\351\220\264\210\221\247O\246\302\230\235^p\005E\253"
+	.ascii	"\253\247\023&\251\303#\306\002\215G\3459_rZ\305\325\231\002-"
+	.ascii	"\344\333\216\213\206\304\241y\026]\022\r-b\234\276\222wI\217"
+	.ascii	"\374\270\324\352\364\343n\252u\270t\213A\312\365\267\324\313"
+	.ascii	"(\353&\027\007\017\370\307\r\300?\375\353]\t\023\370G\234\006"
+	.ascii	"\212\352\246\365\351_\2439\244\2001&\235\214V`nL\271\351\237"
+	.ascii	"n\263u\250a@\205\220b\212\215\210\004IR\220f\r\220\002\221!+"
+	.ascii	"\333\020P\250F\233\2441b(w\301\261gn\232\310\2214^\370w\227\244"
+	.ascii	"\234\367M\327%h\372~9\340\365\331\263\200\320\305A\215\177\223"
+	.ascii	"i\316\201\261\207\017\312\2666\232\366\022\263(;i-\030qJ\326"
+	.ascii	"\241^\336\307\230Y\177\226m\300\377X\323B\370\345\304\353\272"
+	.ascii	"\326\220Z^\240\021\253n\231L&\024\034,a\337\303e\351\\f\325\370"
+	.ascii	"\345\217@W\352<*LR\302W\306\250\260\324\206b1\247K\333\017\n"
+	.ascii	"~\bB\340:\312\343S\022!\310\360\001\350\005=dvq\032\307q\277"
+	.ascii	"\271\367nD\261\223\330\n\202\373aH\0313\240/\rr7hx\353A\001\307"
+	.ascii	"\017\273b(\343_?\024\232\002V\242\232\227\352\300\357\321E\220"
+	.ascii	"\212b\223\274\256\343)<\\\017=/2\032\205\316\232-\367\tL\376"
+	.ascii	"yj"
+	.text
+	.section	.gnu.lto_initYawSpinRecovery.99.a50b7dd828a4ddf4,"e",@progbits
+	.string	"(\265/\375`}\003%\032"
+	.string	"6\261\253I\260XQ:\260\306|Q\362\r\320\277F\275(-O\025\365M\225\037%Y\373\200\251Hr\361\251\244q\362"
+	.string	"\356\263\2153\366Pz\324\257\316b6\242m\006\365-\264m\242u\240{"
+	.string	"\204\227\005\0266.\030\315Z#\204\310\235R\222"
+	.string	"\212"
+	.string	"\237"
+	.string	".?\322\3778\317\245!H\210\235\bG\254=\025p<n\324\272\263\2603\020\201\316\256\326\310\030L\222r\016>:B\352\243\355S\373\271\017\305\2563\320\252Za\350\222j\255\017\314 \365\021\301\t\220\037\305\017 ?:f\013\277\253Q\013\340\202h\275,\265V\326\322x\354\243\2704\346\363\236\300\307\211\027\374\325r>\372Nyj..\276w\021\207O\224Y\360Ws\361\325\231\221\004\200\2006V5\024KQ\027j\255\246<5\0267y\333\247m\031{g\004?:\264\213m\021'\322J\325\2523\301\027\362!.\377\366\321$`\364<0\362\343\027U\243\362d\033\322\311\350\320\336\315\350\316\260\277\303\341P\213W\206\375r\352\362G\367\352\272_uj\324wD\367xjq\244\336SS\221\372"
+	.string	"\0168\361\240"
+	.string	"\301\tmpWW\f\267\324\246\321H\320\217\376\335O\364\265o\277\310\377\271<20\200\354\247\nP\241\003\027\344\251\326\252\341\275\373\354\3227/\362XDx\303\226\253\265\036\210]\3368\353;y\023\216\177s\314y\362\256\340\207\260\212m\250G\206\364S.\342X\005\265tMw\256"
+	.string	"\260\211\213\332\373.\366\270\031\345HRT\245\\\325\212\373\3367\304`\n\356\330\214V[n\003+;Wfth\361\006\222\252]\355\177\307\260\304G\n/X\324c\246\364\005XZ4\211\273/K\233\320\272\310\350\360K!\224\354\252jT\266\274\310\337{\206\035IY\236r(\227\003\001\201\220,\320GB\231\214rB\365\307\210\177\304\302\324\177"
+	.string	"\3052\231\222\023J\2620g{Qk\316m\224\2472(\003\236\201\201\315\330\230-V\215\253\325r\305\230\036\250\214I\203\001\304I\363\301\2549K\0204\256\031\330\371\232\261Q\2356&\207\022f\007\023fk\345\030\030\327\353F\206\005{\271`5'\214U\023\302l\261b^0\026\214\001\273F\234/\226\215\313\365b\225;\331\305\2722|\303-\321\220\350\231~\337U?K5\030$\322\375\r\347\203\206\264/Kn\n\nJh>\352\343\220\024~4\237\370(\177\357*\0358\035\ri\177\034r\334\024),>\232d;3\271\376\223C1\320\264\222\225\310\217'|\234x\364\214\001> `\002\031:\243\033\2130G\255\232f\235\315\220cfQ\006N\255[nvNY5/\352\r]\230\202\276\231V\227\024\024oi\234\206\275\255F\261\332\326\"\204}\024\327\342.V\317\003\213\035\024W\032\262\300\302)H%\023"
+	.string	"\231@$\256\276\274\246\221\267CvRi\006$&\270\263p\022\377bfXO\366\264\3022\326\254\212`^\330"
+	.ascii	"\341\333>\356\352\202\261\323W\315\3707\343o\213\275\203\021"
+	.ascii	"$\351\223S\003\316\\W\036)\036\016\366\252\347\333e\341\t"
+	.text
+	.section	.gnu.lto_gyroUpdateSensor.part.0.123.a50b7dd828a4ddf4,"e",@progbits
+	.string	"(\265/\375`]\005]\034"
+	.string	"V\360\252G\220\236I:L\234A\377\217Z\331\262\243,\310\217:\235\202d\036h\252ce0\224\025~\366\034\3041g\f!xT\031\342\363A"
+	.string	"\"\230\251B@\226\f\337\347\001\225w\242\246\001]\036\233FDZ#\204\020\262eJ\001\214"
+	.string	"\217"
+	.string	"\244"
+	.string	"H\224\336e\312K\242\264\364.\023\365\260j\324Z\311\365\271\232l\222\364\356\317\246\037a\np\326\253\030\336\265o\344[N?\302t\237Z\263\304\236\324z\n\035\364\202\361\240\317\007\205\007\307\003\205\007\355\027\261\335\024\303N\266\231\237f\025}\274\240\3622\253\265\336\016R\035w:\370\321\r\235\374\247\203\273\263\232\361\257f5\343\364c\200%&\303f%\365\005\215\341(s\256/\f\253\250\335\237\207b\205Z\253G\336-\336\266\007\333\033l\360Gg\n\017.=\327?!S_n\300\240\366li\016\323\360_\245Y6\271\006\322Y\377\320\326>\344\272\247\266\346\241\255m\343zg\\\353\214kR\\\327\3065m\\\217\343Z\024\327\341\270\006\307\3657\256\251\270\336\237\377\t\bi\361`\325Zu\026\247\332"
+	.string	"\301\200,\361\003\242&\353\020<\235f\325\003\"%\353~\232UF<\252h]\211Y|\225\306i^M\350\235ZfU\352l`{\311,\002\234\346\225\270E\304M\025\263Z\317\333A\337\353\001\224\3460\355G\241\215\346\272\306H\355\033\333\035\256\346(\201\231\246\004\320\263Q\332\324\224![;\024\315\0313:\224\244;e\310\220\351\324(y0\357\211\t\263wXx\260\346\206F\275t\031\033\251Hi[\264d\031C*\n\035\313\025\021F=+e\221\031R\bSR\206\200\201\224\212\277\024x\370\024$\003fX\031\324\003\275vi>J)\030$*\212\277^\366\341`H\377\002\245\274\330\313v\200-\245T"
+	.ascii	"\230)4P{\346\340_ \316D\202\035\342ND\030\365F\274"
+	.string	"IYd\326Z\213\230\264H\362{\034t.qTs9\204\313-\221\270\351r8]\212$\335-\205\211\021(neNw\033\032`\234\212\244\334m\005\016\227\273\221\377*\315r\005(\032e\372\257\326Z\301\003\373C\201\250m\341\302B\355\023R\204\255\345\r\210\206rv<\037\372\263dp\250\346\374\354(B\033\365\241^*\032Q\013e\315\330\215\257\300\362\320\036jc\310\260\337\231\202\r\027\364\311~\034\023#\034\244\2427\345P\017\r\313v\274\233\235\260\365j\255\337\331\032\336\206\303\303zl\31271y\350\004\2623;\036\375\177\354\260\270\004g\250a8\345 S$\"\"\242\244\205I:\200\002\031\"\254m\021@\261B\306\320TIT\310\306\030I\342h\201\341\277\247\234x\350\261d\376\263\177p\b\347\3777Cb\362\334\370\363\020\216\203\270Olh\211|\237\004.\316\023JQ\342`G\223hv\361\236\244\276"
+	.ascii	"\257\371\262\246\343\0358\263U%\267\030\251%*i\377\034g\227\325"
+	.ascii	"\305|+\216.lu\032\337@\231g\321E(\221gH\367'\2167\333\366wJ\230"
+	.ascii	"\017\326\315t\035\330O\343\220'\351\321b\210\313O\314\216\237"
+	.ascii	"o&\004\220\227\243\221\037\274=\004\001b\232\235~s\351\210\361"
+	.ascii	"\fn\266\212\346EWf=\246\023\007\257\242\305\021\357\370-\332"
+	.ascii	"\304!Q\001.P\020\242\210\351!Z\"\231\323\322V\221g\222\311U\363"
+	.ascii	"k\351\337\361\374"
+	.text
+	.section	.gnu.lto_gyroIsCalibrationComplete.part.0.128.a50b7dd828a4ddf4,"e",@progbits
+	.string	"(\265/\375`K\002=\020"
+	.string	"\226\034cC"
+	.string	"\221(\035_&\251\333\345<\n+\006\367\301\016\226\346\036\262m\027\226p\367\373\333|A\177\2056\016\217\366J\327\300\217xR\004\2775\335\245\273j\375_\225M\\\3249\305\200\352\fh\204#!{K\231RQ"
+	.string	"Q"
+	.string	"Q"
+	.ascii	"\377\340\020\221\221\004\333\016\021I1\351\261\325\242\305p\255"
+	.ascii	"\210\240\331\215\333\241f8\351\031|\232\032\311OT\252\364L\363"
+	.ascii	"(P\275\314@\245&\034\272\374mR\021R\001\244N\257\263\273\177"
+	.ascii	"=YR*\231\234k\232gw\355A\341\366\270m\316v\001;[\001\312\262"
+	.ascii	"j\177\253+\333i\350\364{i}\351|\351k\234\021\013\273-59\366\002"
+	.ascii	"\224\341\340N\211D\247\024\027\2506D\030\327\236\342\207(\201"
+	.ascii	"\206\030\f\215?\302E\210\204\021\203\005h\355\356A<\212\036c"
+	.ascii	"\004\030d\270vW\364\374\327\310\336\330)\366\3460,r&\365Q\237"
+	.ascii	"\273[Re\331\006e\327\277\236\025nt(\331xA\343\2248|\230?\227"
+	.ascii	"\001\021\230\201\331\344)N\004\264vO#'\216\202\363_\016\355 "
+	.ascii	"\224G\035:\036Bvx=\354Y\302\305\203\352\025c\312\032\023\266"
+	.ascii	"G5\022\265\006\016\237:2&\001\341:\321g\013u\\\b\245$\264\241"
+	.ascii	"\200\030\234l$]h\003\031`\256AI\267=\340\270n\333\374\255\256"
+	.ascii	"\374\3279\360)4T{L\252b\375\313\224\345|\037O=pU\026[\365\351"
+	.ascii	"Wv\230\262\006\352\323\225\212g\364\347\261h\223\267X\3616 \240"
+	.ascii	"\002\021$\242\007r$\306\257\204'\216\264\303a\214\204A\356\262"
+	.ascii	"\355`\030O\355\323\305\203\304(\020\355\370\363e\016\322\351"
+	.ascii	"S\333\247\265\245%\202\f\344l\031\034LD\3010;\234\243\b\bs\347"
+	.ascii	"\274\257\255\r^\027\n\370I?\230\004\363\216\017{\016$\260\213"
+	.ascii	"hnB\306}\221HK\006\021\016_\217\231\033\340\013\026(\256i\237"
+	.ascii	"\266\301q\215\323\311Fq\272\273\365Z3\006"
+	.text
+	.section	.gnu.lto_gyroGetAccumulationAverage.part.0.135.a50b7dd828a4ddf4,"e",@progbits
+	.string	"(\265/\375`\236\002M\024"
+	.string	"\026f\202H\320\322(\035\022\322Z\202m\371!\345\3309\001\257\221\313\353\203\232\271a/\373\001\313\255\r\013\255Y/Gb\306ij\214\311?\203\025V\003f\017\030V|\200\334\"U\\\366\b\nd\221\345\267\357of)\315\222\275\345N)m"
+	.string	"l"
+	.string	"f"
+	.ascii	"8DE\273a\311\247\033\240>\035\336\200\367\211\272\210\367i\037"
+	.ascii	"\206OPf\266\023\024\232k\017sf\n\354\364\350\340\263\264\033"
+	.ascii	"~\237\212\302z\031\336\032k\237R\243W\363\343\207[\313\347)%"
+	.ascii	"w\311S\243\273I\002\272"
+	.string	"\205\270\224\003v7\300\rF>\330\335\037=\312\334\\\242\002X\001\342Q\344\336)ew\215\022q\237n\233\305\266\005;\362\004*\036\364\013\375FW\373\276\321Q\321\314#0\341\336lE4\271\273\2257\273\0331\\\004]\310\037r\nh\366\335{|\033\272\331\316\007\252a\244\234\035&\245\335\255\200\312\371:\237\306}h\377\321\360\245\331{\320\261\003Di7$\3714\004\324\347\210\214~nf\247l\232\235\372\214\017g\b\302\245\261Y\243}\031\347\241}\206\207\036\262\033\326KU\234m\007\277zz\240g\227#\306\306D\013|$\231\211\374\024\276\207\274O\006;\226T\352\324\307\264\2207\016/\252\352cX\274\304&_\243\376\350\323V\363\363\222\244\013\342\022\233\254\327\335m\211\212\263z\377\356\256\025\307v\364\311\323\350\371\360\2273Zgt\274\321\375\224|1B\200\315\356L\023\323\226\230G\0011\326\006\225\214Q"
+	.string	"[\254\t2\027\330\002a+1\025(\341\002\250"
+	.ascii	"TQ\301@\226\b\256\027K\246\302\260\322ZY\255T\"^\231\274`\034"
+	.ascii	"T\276\030\354\025s\201\261\317\305R\265\276\025,\366\231$\360"
+	.ascii	"+\003\b\373d\257\027\354K\375\2538\004\244_\363N'u\212\213\276"
+	.ascii	"L\305\345\036\262\344\203\304\214\315n\325\204\365\227\212\363"
+	.ascii	"\324\361H\236\322\211\236^eJ~\215'zx\300\304\037\0018 \200\002"
+	.ascii	"\0313\255\003|*\250h1\330%\3609L\300k\\\320\360\240X\027\214"
+	.ascii	"\245A\242\"\020\3269\232\367\2703\027?[\355#\370Q/\215\275\023"
+	.ascii	"Dj\356\216\225\260\325\206\311\265F\301\335,b&v\005\343%\254"
+	.ascii	"\3374\f\270\354n9\373\264\b$\246\017\306\300\f<\341(`\006&\363"
+	.ascii	"\332\245!\2137\206wu\246\213\265P\034V\303\366\036\232\030\027"
+	.ascii	"\336A\361\304\271\005\351\337{\355\303\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.a50b7dd828a4ddf4,"e",@progbits
+	.string	"(\265/\375`\365\005\255\030"
+	.string	"\346&\223I\200XN:|\r\324\230}\"\242\022>0\325EqP\266Mc\002=\360p\303\320\254\223X&{&\236V\"\022\204._\267\313\372\324m\331=\317\363<\317s\260\314"
+	.string	"\244\3140[\271E\306p\250\252fD\365\215\220Md\n{"
+	.string	"y"
+	.string	"\206"
+	.string	"\3756\026}\266\025}\245\212\376Y\212\276\031\031\024\3752U\354<\321O\232h\246bK4\253\346\275\273\273\273#\321O\033\3217c\2128Y\210\037\327\253'Y \372Q\314\017\357\322\343\341s\035\372k\346\030\030s\350\253mx\240\201\b\275j\006\007\030\372S\314\013A\350U-\b\241\377\231\225*"
+	.string	"\204\252\353\252\206U\350K1\3271\261\277\3773!|\252\252\252R\350;1\377\363\302\004\251\222\271\346\344\321\247\333\321\257\213\352\207\201\352gy\352\267N}\271\246\276\026\035\375-L}/K\375/9\372`\370\377\317\203\243\317\205/u\343cJg\202\376=\232\236\234\222\212GMEE\246\2373;e\343M\320\244>\226\032\375e\261\037\207\324\207;\352_1i\364\337\214\372VL\342\004tF\337MF\277\212Y\324\247b\306\220"
+	.string	"#\302\013\b\250\213!\324TUU\252E\027\212/\360\344-\371tdor>\340\345\255\314K\2575\354\006\310]UYp\rn\356\217e\023\315.\216\b\320\315E22\216\222 j?\276k\204d"
+	.string	"e\250Z\004\276Kl9\200\030\253\262\004\276\373k\271\206l\355\307\320w{\255\002\337\355\261|\027\370.\r\3137s\353bc\340\273\002\276\354\204_\351I\034\200\3241\262\201c\222m\230\336`\233\262|"
+	.string	"\311\031\256azy,\363\232\\\0032LoO\331\303\n\017\266L\024v5\027\344s\177\255\220\317\375!\371kSVG\206|\256\315W\217\206\355\370mP\344\274\b\234Pl\312%\031\202\326s\246K\034\236\313X\314F\216I6\341\311[KTxyk\345\034\253\256*\026\336F\372h\243\330%\243\022\262\330\"\261\302V\207\2651\366\220\234\326\241\215\031\n/k\361\323\226\200\025I\205\327\310n\347\fj\005\327\364\310+p\347\022\331\314\321\271\274#3\227\222K-\230\023j\250a\024\216\221'\"\223\244\264\240\231\003\020\003\231\031r\003\021\260\bT\236\231@F$\020\t\306\202\016\234\271\023\274\366J\246\275w"
+	.string	"\247]\347]\347}:\353"
+	.ascii	"\313RD\3335\254x3\320\373\n\202\277\031L\225\254h\340\035\353"
+	.ascii	"\336\\\305\3062kOG\252\267\373A'_\345\252\\\225\253\242+_%\337"
+	.ascii	"\006\252m\262\200\257TB\023\241o\322x*,\024F\240\222g\314\253"
+	.ascii	"*\245s\274W\271\300P\347s\272\373d\201\226\016\267\205\224\025"
+	.ascii	"\031&\235\366\223\264\304C\036\257\246\213P\222\316\365\027H"
+	.ascii	"\232p\341\342\222\242\32463pj\226 n\177\211\202\247\336\301?"
+	.ascii	"\f\207\307\230hy\326\001\t\261\207\274\361\306\307\313\33425"
+	.text
+	.section	.gnu.lto_.refs.a50b7dd828a4ddf4,"e",@progbits
+	.string	"(\265/\375`c\003\375\022"
+	.string	"\246\246i?"
+	.string	"\223S\350s\321{\321{\351m\317f\316\314\212\340\370\377\377\377~\033\355W\265-"
+	.string	""
+	.string	""
+	.string	"\240"
+	.string	""
+	.string	""
+	.string	"@\337T\004\327\025\260\177\234\370G+~[\355\001\337\275\221m\322\226l\223\222O\210\224)M"
+	.string	"T"
+	.string	"a"
+	.string	".}\226\354U\216\233\224\227\364G\372\"\307C\375\254\3779\336\351\203\034\263?\246K\345#\345\"\355!\375"
+	.string	"\355"
+	.ascii	"\372\243\366\255\017*\307\254~\273\007\364\206q\321\305\017\273"
+	.ascii	"\276\2728\255A\260\267\212\213,~\325{\372W\277\352\263\263\363"
+	.ascii	"\026\204}T\373I\373\251\274\324'\365E\345ZGdfh\001\234\024\342"
+	.ascii	"$\345H\373\255Z\331\321\030Z\344\356\204T\243\356\321\336B?\243"
+	.ascii	"]@{\226\276\212\366\246\343$\331_\332\240\317\223\270)\337\346"
+	.ascii	"8\315\361\005}\005\331\307\264'\350#h?\320\207i\177\351\0338"
+	.ascii	"\036:r\340\270a\243\006\215\0312b\300x\341\342V\344\234\211\343"
+	.ascii	"\325\034\177\320o\320gp|\246/\223}\314\275\334\3618J\037\225"
+	.ascii	"\275\311qR?n\307E\307A\331c%\343LOg\331\202\305\212\034\025)"
+	.ascii	"P\234\300)\321\037\321\276\210\0207 l\372\177\250\351;\350\323"
+	.ascii	"\264\034\246\274\245\003\372+\375\224~*_\227jm\251\026ux\210"
+	.ascii	"\304-m\026k\224vT\377\344\270)\353\361Q\366\037\002\331\n\347"
+	.ascii	"\265J\ngj\024\216J\361\222\024\277\024Q\330\333\211\203J\374"
+	.ascii	"*}u\332\004dz8qv8=9\23087\22485d\300`z^(=-T =)X\317\t\022\264"
+	.ascii	"g\204\037>z\360\330\021d\250\201d\206\314\324\210\310$\205IR"
+	.ascii	"h\f\260\242\221\032\263\003\020\220S\233d8\221\033H\350&\212"
+	.ascii	"^V\nWQ\246\227\223]\243cv\254Z\331/6\330\013\202W\254q7_\224"
+	.ascii	"\335E\r2*nm\360\230\241\004\254\265\"5\177^\274\253\251\240\204"
+	.ascii	"o\267\005[\032\377\232\200=\201#\034\017\233\375\323\006'\267"
+	.ascii	"\255\305U\316\242\260\3105\210\b\034@\213R\351\034\323o\035`"
+	.ascii	"\313\013l\354\210\312\177\002\364\345\016Q\377\234\n(s\003\323"
+	.ascii	"\227{,)\310\347b\206A.t\204\313o\023ja\352Xj\346\344\031\363"
+	.ascii	"\262X*\250\346\260\364t\252\334Y5\030\275\004`X\262\032"
+	.text
+	.section	.gnu.lto_.decls.a50b7dd828a4ddf4,"e",@progbits
+	.string	"(\265/\375`\027bu\226\001\n\233\272\221T Ja+\215\001\233\017mu\322\243\376\361p\331#$\2652B\351G\376*\317\312C\305u\246\311\354#\216V\371\276\227\231mR\020"
+	.ascii	"JB^\223\234\357\373\276\1775\322\244m\206nW\216\347}\216G\314"
+	.ascii	"\330\327\362\374\260\347\363\352AU\217\225[n)\245L\001\307\007"
+	.ascii	"1\t"
+	.string	"S\tP\2540\261\370\332\215\376\007\266\215\035c\325T;7\354E\314\322\266\261l,\226\237\253\235\267\354sc\227Ui\333\3305\034.\235\266\037g2\276\006\243\257\247\3504\031\206\\1\371b\361u\231\266fl\336\261\320\2551c\311\250Ac\317T\2455c\313\274\316Y<\020 \212r\f4[u2\276v\242\257\277\3645\020}\255\245\353\256D\371ZJg\256*\224\177\272\321?\361\364\211\254B\331\326u\361\021\203\2533c\361\317+\372Ui\275t\271zh\340\330\321\335v\371I\224x\233\236\275\317\366\336\035|\210\224\235Ac\261\325b\271\374\337\271m\326\352\316p\231\273@\262\210\310\261X\356\316\211\222\352\263\370gR\377\257J\033g\267$\367\336bnWZ\026\377d\242\317\367\267\377;Z\311\\\214&\026\377\374\241\365\256B\371\215'\210\217\"\\,\376i\245\243\3201J\316\201\362g\224\326\027f\313\236"
+	.ascii	"\206Y\263\263:\037\374\226\211\024K\3663\025\264\267WU\230\035"
+	.ascii	"kb\311~v\366\216\n\374m\233e\263S\254\233\255b\257X\245\265b"
+	.ascii	"\251T\245]\263j\267aV\311q\322\256Y4K\3663\225\334P\331\r\227"
+	.ascii	"\034\270\276\2757\256A\246\314k\b?\263\321\317^\3643\027\375"
+	.ascii	"\034\247\237\263\350\3477\375\\E?\273\351\021k\372\311*\224-"
+	.ascii	"\331o\305*\335\261X.\t\254\2307>\372,\256V\214n\235\be\344Vr"
+	.ascii	"\273\355\275\201.\334\034\325\237\305\317j\372pU(\367T\241|\273"
+	.ascii	"1\235\355*Q\376\232*\2245\262\n\345g!\372y\207~\276\322zY\205"
+	.ascii	"\362\373*Q\276\tG\333/k\207X\"\267_V\310I\224x\317\224\375\302"
+	.ascii	"{G\325\212\301O\255\030\230rG\242\244d|\223\215\276Ig\273\316"
+	.ascii	"90\220\271\263\370fR\333\037\226\253*-\220\337\366\250U\216\325"
+	.ascii	"\270\266r\357\244\317\215\272\001\006\213\305\257\0372P````\375"
+	.ascii	"\220o.\321\270\n\345\233B\364\315\035\372f\226\276\271\365\316"
+	.ascii	"\26688\234N\262\374\030r\243\002\240\344\215\253 \026\377\326"
+	.ascii	"\206\255Q\206\315\222\032\026[\032E=^W\336\314X|\fG\277F\371"
+	.ascii	"+Z\234\030\316\324;!\177\313\275\267Q\233\252\345\005\233\337"
+	.ascii	"jY++U\373\252\034\033U\003\355\224\235aa\250\200\225\216\205"
+	.ascii	"\262W\026\206\215a\263\352\034[U\377\254\f\273-\262\372\331\027"
+	.ascii	"\265\216\245\252J\213U\341\274\356U\276\333\344\336St\177\235"
+	.ascii	"\353\322\226\243\n\231\030ahI#^\352\252\226\2550\2435k}W\314"
+	.ascii	"\b\251C\227\306o\271w\262\316\345\231\251\n3\322\253l?PA[\252"
+	.ascii	"\214\230\260e\232:\307eG\233\033\221+\177E\333\322\003\357\257"
+	.ascii	"sc`0b\263\326\346\203\277\242\305}\3618\373\353\334\227\266\031"
+	.ascii	"%\336\234\361\242f\316\034\230z\367\023\025\264\247`X\205\355"
+	.ascii	"\275_\313\374Fn\204\250\221\373\215\320T-7\t\247a\254\321\231"
+	.ascii	"B\242\204\305\252T*\333M\206\235m_?\226{'_\253\374\025\355\026"
+	.ascii	"\253\276U-'\024\327\256\202\321\346\343\356H\346\225\365\355"
+	.ascii	"\235\004\001\002D\021\210\235$1\304\346\214\200\217\243h\013"
+	.ascii	"W\2112\210*\224\217\225\350c\244\376\005\324\277K\375KF\377\306"
+	.ascii	"\351_)\372\027\211\376\265\241\177\267\2765\243o\271\350\333"
+	.ascii	")\372\326\211.\252D\3716\210\276\325\322\037*Q\256a\252\230"
+	.string	"\252\344P\3556P\325#\"\225e\361\255\f\r\202\275+\207\\\003\003+\207\374*G\277\212\321\257U\364\341\234\350\333\r\321AU(\177Y\211\362\353\f\375\032\245+\226\nW\225\034\324,\257V\352\225\233Q\311\235\334;\td\301\352L\221b\361\237\364+\007\371\006\006V\016\362\225tP%\312\266\ne\017\225(\237\005=\242\022\345\237\320#T\242\\\323\252ZUVP\327N\242\304/\224\332>\333;\t\344\003X\006H\307\342\223\240_\245|\002\274]\342\034\364k\005\271\006\326\n\362\255\366P\205\362\335*Q\376+\224\277\232\3253\016n\225\025\327v\333;\251AOm\251rf\361\223\225(\353*\224\377W\300C\376\263\t\233\205\002\237?\213\360\337$\256\340\277f\270\303o+\360\327\255\337\262\260\022\250\"P\360W#x\002\\\024\201\007\267\204\037\026b\341A\177\036\373\357\224\337~\251*`\237\377f\371qO\345"
+	.string	"\346\371\357\034\316p\273\260\337\032\261>\376\257\025\255\360\016xG\205\017\340\317G\376\253p\373g!,<K\217\337\3661\300\006Z\335 \353\277&.\212|uM\334\256\211\335\360\016\227\340\317R\277\325\360[\237\337R"
+	.string	"\003\277\035\332p\021\360\236?\207\340\277\027\340\363\257\"\274\002\034\340|=\224`\227t\3318\326\r6\255\023|\"vH}\212\341\377\232\005\212\352\013\030\377\226\313\017\360\347\244\372\302o\275\376\352\201kt\324\343\257\031\330\263\257\265\272\201\007\025\254\232\b\037\361\347\372\333\25610\373\344\210\331_-\360\265J\201\272\001\240Y\347\267\\\177\235"
+	.string	"\266\277\r\002\344\257\026\260I\316~\213\364[\t\374U\004k\005+\260R@\205\313\301\005\360\347\340\177yp\305\277C\2016\003\277\225\340\267\023\370\355\004\026\253nP\364_\016\210r\007\177{*"
+	.ascii	"\3229\321o\262\331\233s\377~\333E\306\001\035\313\345B\277y\367"
+	.ascii	"\337\034\277\025\263\367\337\037p\256\327o\361\364\356\233\277"
+	.ascii	"\262]|\227nZ\370\257\2216\377M\302\306^\340\257\311\337*]&k~"
+	.ascii	"\273\177\013\343\267P\277\245\372\253\bXV\216\3127\270<,\360"
+	.ascii	"\242\253&\315\177\317\334\274\377,Xy\212?s\370/\007/\327\003"
+	.ascii	"\375g\013\374\266\314K\035\241:T\331d\374\026\0020\374\266\205"
+	.ascii	"\272\033t\016\376o\360W\035\377\025\363_0u\203[\360g\t\374\227"
+	.ascii	"\203\027k\245\210\227\333\345\035&\030\372s\211\337V]\375v\312"
+	.ascii	"o\341.\007\337\371\363\003\376\312\363W\373_\316\3778\177\255"
+	.ascii	"\377\001\377z\377\352\363\327\f\377\375\376\372\277\006\351\377"
+	.ascii	"}\177=\377\323\371\353\316\3779\177\305\377\003\377\332\363W"
+	.ascii	"\240\277\346\377\177\1775_g\350\036~\263\313\177\367\177\247"
+	.ascii	"\376+\365_\250\377~\340\277!\370o\324\177\251\376\373S\207\376"
+	.ascii	"\273\364\337\027\376\333\201\337\256\371/\335\377\240\377\004"
+	.ascii	"\372/\227\377j\371/\225\377\246\375\367\354\277b\377\r\373/\330"
+	.ascii	"\177\203\374\227\353\277:\376{\343\277V\377\215\361_\030\377"
+	.ascii	"\255\300\177#\360\337\024\377U\341\277\f\370\357\t\377E\361_"
+	.ascii	"\023\377-\341\277\b\370\257\207\377\032\340\277\004\370\257\b"
+	.ascii	"\377-\361\337\017\376k\364_\021\377\365\340\277\035\374w\202"
+	.ascii	"\377r\360_\f\376K\301\177\211\376\033\301\177\203\376\373\363"
+	.ascii	"\337\236\377\342\377\332\377\376\267\200\277\375\373\255\337"
+	.ascii	"o\373~\033\347\267{\277\325\373\355\362\267k\376\352\201\337"
+	.ascii	"\342\370\355\230\277\362\370-\334_\331~\313\366[/\377\263\374"
+	.ascii	"U\350\257\305\277n\340\257\304\337\"\371\253\b\277\r\362\333"
+	.ascii	"&\277%\362[\254\337\342\375V\314o\217\374V\354\257*\374\366\313"
+	.ascii	"o\307~[\367W\016\374\226\313\177\026~;\364\333\r\177\335\340"
+	.ascii	"\267"
+	.ascii	"\023\374W\341\277\335_c\370\253\221\377k\277\225\373m\334o\267"
+	.ascii	"\374V\313o\263\374\026\313o\337~{\345\267V~[\345\267T~\353\366"
+	.ascii	"\333\266\337\252\375V\312o\323~\233\374\257\342\267h\277\215"
+	.ascii	"\362[(\377S\370k\004\177%\372\353\320\377\263\377O\377\353\376"
+	.ascii	"W\020\030\030\030\370\367\330\375\033\020\360\2338\023dg\224"
+	.ascii	"\253\034U\311\257\323l\316\313\r\355\303\234<)2\213\1773J\006"
+	.ascii	"\036b\330\274\261\370Na\262\314[\366\201\021c\277H\241\013\203"
+	.ascii	"\313b\026\226\267\354;\273an\3354\244n\223\322cI\307\304.o\331"
+	.ascii	"W$,oif\035Y\362\305\231\262L\262$\231\267\3543uH\355\b32s\230"
+	.ascii	"[\037$\301\220T-\b\330yK2:\035\\yKSk,\f\215\006\027\2300\026"
+	.ascii	"\013\r\017f\310\274\2455\022\003\032W\336\222O\316\316[\366\331"
+	.ascii	"-s\210\335\221\005\231\267\354\003;\202\206<3\207\\\030&r\004"
+	.ascii	"*$\003\244$Y\002^)\017N\270\362\226}h\311\274e\237\311e*1\301"
+	.ascii	"\314\037\246\017\363\313$3\217\230F\314%\346\230if\"1\317L!f"
+	.ascii	"\227\331\304\214\301\fb\0221\213\230N\31403\211\t\304\3642\241"
+	.ascii	"\230e\346\023\223\211)V\225\346\020s\307M\036f\017;s\210\275"
+	.ascii	"\263z7\r\251\202\327\225e\337\034[\007\004'pyKs\210icl\347-\373"
+	.ascii	",\034s\210\335\263_>\224%\363\226}f\215\022\310\274%\231\\\216"
+	.ascii	"\031a[\346\020\313\243j\271e\016\261>\254\027\bhpy\313\276\275"
+	.ascii	"\223\032oy\343I\002\360\247\354J\224w\""
+	.string	"\200\322'\332\323'*\363\301\304\221\004\332\311\203\323\303\315\342\023}\321'\272\242O\244\324'\"\323'B\242OtC\237H\2066\261p\022-=3\213?TG\277\236\231W\270\215\t\303MC6`\314\325r\206iU\225\346\025f\363\373\342R\231W\367\n\257\031\201\ni\302\030\253\345\336\033D\021\b\240*\0364\2642\226\361\033\343\312\360b\306\252\207\305\037R\243M*\363\305m\363\252\n\333{S\3417fT\265s\303O\002\227&\225)e\311\252\235\333\026a\227\267$3c\230U&\214\2524\251\314\251\337\030W\006\210\242\f\340\302\222\032\177\250N\177h\212\376\320\2326\243~\354\006/M(\313U\207\266\005g\261\271\377\244\340(\261\370CP\364?\340\333\001\267w,7\r\031\201\21410\314\271\334MCj6/\253\345\031\0343\270:\330\017\377a@\034X\225\230\016\216s,\007\367\321\301z\307\362B9"
+	.string	"%JN\037xtp=\370Ce\272rU\242<\244D\177\310\210\376\220\227\376\020\017\375!\033\372CY\372\332U\242LB\025\312\037z\241/\324\247/\024\007\344\310\304Y\254&\345\272\201\340\244+J\\\337\235\241e\231P\261dN\242\242\304\365]\271^]I!F\356\021'xU.\020\265*\307\362\"m"
+	.ascii	"czx>.\327M\206\235m^W\352\322~\335d\330\311\3465\245\226\351"
+	.ascii	"\032S%\f\307\3414\270\016\317a;L\006\347a<|\006\217\301b\360"
+	.ascii	"\026l\006k\301^0\030\254\006\323a4\270\f\316\202\345p\030\334"
+	.ascii	"\005\177\301\\\252\022\337\331\300_\030\256\325\213\246\330\""
+	.ascii	"\225\r\2042<\022%\360\335\rb\277\252\335\326\206z\243AY\322\232"
+	.ascii	"]a\033#P!w\260\306\304p\241\340\273\233\274i7\tg\202\227\331"
+	.ascii	"\022\r\363\300@\274\0060\206\205\357\256\326\315AC\003\263\250"
+	.ascii	"\013\345F\361:[\356\275\315\360\r\274c\004*\344\316\2141`j\370"
+	.ascii	"\356N\261d7\r\211bL\331r\357}\207\203`8\020\306\242\242\304\365"
+	.ascii	"],\035\267"
+	.string	"\207\326\2102\275(q}\200\330*\252\213\2041-\267\352\316\"\251Z\252\035\221\035\0055\202YW\224\270\276+\004\337\335!\267\310\030\264+\344\356\"\271g7\r\2713C\n\224%\276\273o\267N\007\251\252\275\2654\030\303\213\022\327\3673\027\303oG\b\030c\001\n\362\025U\306\342\013\251i!8\206\233\fC!5cY\005\277a+U\211\257|\352\n>\202\323F\240B>@\352jy\005S\371\227\016RU;\n\310\b%~O\242`6\"]~h|!\030\372uJ\031\207jG$\001K\252T\211R\206\3230\022L\326A\252\312\001tV\352\234\331\345\272\334\240<Y\236}\250vn'\340\316p\032F\273\334\317T\320\236BB\266\334{\317\3414\374\204\303OTr#s\021#M\350\372p\033\236\202\3250\033V\3425\354\206\245T%N\303\311)\223m\255\217\316\006\374\rj\372\033\314\36470\321\337"
+	.string	"\246\277\241K\177\303\016\375\r4\3647\304p\002\345\006\017\313\342k\350\323\377\261\030\036\253J\334\004\207%\301K\202\260\t\303M0\023\274d\003\2334`\177}\367M\315\336Z\306\327\340D\377x\211\022\036@(="
+	.string	"\225\340\260\237(I\254\202X|\r?\3645l\351k\310\322\327 C\377\370\3538\206\037wa/\f\246\001sJ\214:\030\026\343\"\330\3101\030&\2621\030\b\\{Ga0\240\277\275\243\200j\305\240V\f\360\023\257$T2\276\206\027\032\0171:\376zA\304J\313b\016\252P~\020\240~\320\034m\223\225(\177\250B\031s\031\307\332"
+	.string	"\261\370Ac\360\017\354\303\310\022M\030\356q\354\003JM\0253_r`\035[;c6\246\254a\313\261\265\223w\366\026\007\307\361\326\345\3631\344\210\305\347\253h[6\260\240\341\032Zbt\340\300Y\374 !\372U\211ihM\315Q\013\223u\254\365U\315\332\214\221c1\306\302H\035\206\005\365\002\271\351\352"
+	.string	"u\314\330ySF\f\221\031\365N\210\22273\213\037\204C\343\250\242\3336U\206eT%\206\341\006\272a\030\360\3061\246d\t\354\353\3311\346d\3011\252\352\214\031\313*\2131\214\235/5lt\261\370@g\364\217_T%\246\372"
+	.ascii	"\204\211\226\305\347\303S\377w\354W\0317~\026\377x\352X\n\271"
+	.ascii	"\333rX\214\243\3166Yxj\026\037hNc\250\033h\201D\221\311\262\370"
+	.ascii	"@[\364\201\322\364\201\316\376\254\032(8\330,>P\330\234\353W"
+	.ascii	"\225\227\316\335\362k\345^y\021\235\213\345j\371\231J\356\254"
+	.ascii	"\023\315\033:7\356\312\251v[A{\252M\235%\210\3126\007\250\227"
+	.ascii	"\361\231\273\267&,\316\345\273}Uy\345\374\312\271r7\314\017\224"
+	.ascii	"\206\275\207\374\205\311\271bn\236Vv\003\025g\213\003\b\020<"
+	.ascii	"VBz@i\254w\341T\345\335\273o\326\334e\265\333Jn\255\237*@\342"
+	.ascii	"l\365\355]4WM\007\251\252\023\342\324,\365\026#qE2>P\020\375"
+	.ascii	"\337\345\257\233\030X\230\230as\333d\260\261e\027g\361\201\266"
+	.ascii	"4\233\327\031J^\324Y| ,\375\252<\233\233\346m\300\276\334\200"
+	.ascii	"b\361\201d\350\003I\351\377\004\346]\273;\246\332\271\235\b\323"
+	.ascii	"f\271\367.s\315T\345\315\273d\362\356\\e\253v[$xq\263\374I\302"
+	.ascii	"\304\fJ\306\377\201\243\261\223\25160\027\357\336m\037\2376="
+	.ascii	"\344\304,\376\017\032\375\037<\375\2370\367\313\005S\2257\314"
+	.ascii	"\255+J\356m%\314\345r\275t\220\252B\301\207\337\222D\211\033"
+	.ascii	"\346\316U\266\037\250\344\306\342I\242$\316V\337\336\311\"\020"
+	.ascii	" \316 Z\320\214d\374\037&\372\277^\272\344\250\272\362\2274\271"
+	.ascii	"l\2219b\361\245\273id\3546\026\377'\006\375\237 \372?;\364\177"
+	.ascii	"\264\364"
+	.string	"\177\2504\334\315\322\326\025\205\314\342\373\374\301\371\354\351\373,uMV\242\\\224F\337\347N\337\247\213v\273m\266\007\356\217\352\206\305Wy\327\252\362r\227mg*\271\225E\270@\025\261\370>Y\264\213\275\367\256\227\313\347\345\362}\242\350/\253PF\253S\352]=\265\342\322\264X|\037&:W\241|\237/]w\025\312fE@4z\264UY|\037-\375\017\222\334%7\r\251\251|!Y^\262\373\244*o\331e\342v\313\256\330uR\355\334v\024\r\r\370\336\230\t+\002\341C\245\217\316\215\214\307n\023 \030\216\300"
+	.string	"\213\033\233\242\337#\026v\225X\2555#=D\302z\200\350\367\314"
+	.ascii	"\2731\3241q\374b\004\202\361}]\"7\371\326\005\317\342\363\230"
+	.ascii	"\371\342\251\323\225'\213>\217R\237G\211>\017\020}\177\340\033"
+	.ascii	"`\204 \261\370<9\364y`\270<\200\354\220\314\275Y\374\f\177w\207"
+	.ascii	"\233\255*\366\002M"
+	.string	"\314\342g\250\323\377\357\215\252\2748.\215\343\344\336S\027\307\255qmT;\267\275\263\006P\226\325\004\331\267\367.\002Qw\324I\211\301\370\332\370/\362fY\262\03584Zc\026?C\024\375\fF\3643\354\320\226\253\022e\r\252P\256\031d\350g\210\322>\311J\224+]\025\312\330J\025\312\025.\216\336\220\254D\331\022\251B\331\332]\251\033\345\226\314Re\361\205\272\023\333\301\305\342\357\254\321w\333\300\374\304\215\024\322\342\357\340\351\357\310i:\366\317\317\215\224\036_,\376\316\032\035?<%\007\021\257\363\335\372\231xbH\250X\374\2353m\"\277\364wrhsGJgd\025\312o8\354\304\005d\334\316\266\037e;\312\336~\206t\275\231\303f\325\200\316\332\324\222X|*\217\205N\355\312r+\207\301\372\363\263\370\031\320\210\022\345L\273\022\326\203\345K\033^\362gZe\262\246\207\033\213O\264\277\375\305"
+	.ascii	"\003\367\327\344M\316\263\252\266\261\352\226\025\2220d{o}\330"
+	.ascii	"\031\322\346H\334i\366\363\214g\fN\226\244\305\347\223"
+	.string	"\277\201\231\003\364Q\366\177\347\354\253\333\321\344,;\311\330\330\221\215m\355\314a\341Cs:\271\312'T\314\250-Yr\212\325\240\244\324\230.a\346\226>;1L~\212\265\371Q\306\275I\301\240\354\310\217\234aEzC\221\342e\271\367\326\207\"\2652f\222\374\fk\003\264\227e\372,>\221\230\221\321\331P2d\310\tV\3256V\007\263\264&HM\325\327\346\3444\362\023\314\315X\030\222\263\310\234\265\277\033g\221\223\210Z\227\215,\346\266\013#K;\277p\034>1/{\026\037\003\036]]g\220\".\2508?[V_{=Vv\310\2019\275~\006y!\343\005\336\030\271815`x\3608\271~\247\266\017$\371\314\312\313\357Z\331\210\023;\317\037m\302\210\361b\361\351C\217\231#\244\316\342{ r\366\360\240\265\365o\235:\252\332\306**\223\n\334\353\333{\353\203\325\001'\214\221\034?ud"
+	.string	"\244zS\305\356\377\316\2104`H,\376\005\347\214\2375\376\252<g\2347*_M\356-.(\275"
+	.ascii	"\374\250\003\274\321\267\253x|H\032\362\343\313i\343\347\215"
+	.ascii	"/9p"
+	.string	"\r\256\353\324\372I\343\3379\315\224\251S\263\370\027\230\351\023\3713\353\3371w\320P#f\361/h\242\377\023\353\337\351!\362%\214\236\305\277 L\377\202\"\372\247\214zZ\235V\225\255hC\275\3710\206G\327\001\217\025\224\2211\213\177\301\r]ke\313\377\031\343\214ak\234\020\264\267\227\033\334Fnu\300sVV\347\210\305\277\200J\277\226\325\374\3459\r\356\302^U\231\277\2340\214\244v\024\222\001\360\350\200\207\307\033!\\,>\251\316(3y],\276\005stV\223\331DY3\227\333\250Y\276\311p\252\035\221\0044\021s\347\362\232\016RU'\234\245\t\314|\371\357\255oy%\007\346\345\2233'\324\371\342\234:\2432\340\271O\251\252\314\201y/\007f7\t8C\263\334;\t\264g\326\206#\bg5g\323A\252\352\204(m\226\231N\256S\225\371\357E\037\344?\274\263\037\317\0258rtp"
+	.string	"\341\243G\346\314\216\3547'\371\005\307\342\334\267\205\243\356\205\305\267\240\213\376s\234\252\314r4\037Y\026:l\376\357\360p1\342\265E\337\002\266\254\247\313,{\204\261\370\026$\365-8\323\267`L\337\2020}\013\300\364\237\331\3445\246\322\313^\230\274\246\262\215\001c%e\361-\370\3229/\237\311h\376\035\240'pC\252X|\013~\350g3\377wT0\"\246\212\305\270^.g2\317e\376\035[\227$\354\312\342[\240C?\343\3451\377\316\317\031$S\322,\276\005Z\372\371\256J\340^\016\213\263\235\246\262`\212\203\f=\336~\354"
+	.ascii	"\363l\367\3470Y\314\013\201u\344X\3743\225(\373T\241l\305\214"
+	.ascii	"\236\301\360\204\231[\242Y\374\n\226tt\331\013\tfI\3022,I\013"
+	.ascii	"\224\322\345\331\213\245\023\207\312\330\227\270\270<gv\265\234"
+	.ascii	"\253!\306\210\334\363\\\033{\246$sU\005\016.k\261\233k\357\260"
+	.ascii	"\363\213Y\214\345\336\342\361a\347K\0352QY\236\265\034KmKs\267"
+	.ascii	"\005K\035{+\243\202f\305J~\263\\{o\252\355\342L\231\337R\337"
+	.ascii	"\305\340\206\343\312\363[\325\022e\217\313\013\213\317w\271\377"
+	.ascii	";\330F\02630\026\277\202L%S\311:N\350\241\246\347G\266\267\266"
+	.ascii	">\324,ws\354,~\005<\334\334\262\216\035\276sG\027\225e\0228\213"
+	.ascii	"_\001\214\265\265\314\366\212\3349\264\360\274\311\203\023\206"
+	.ascii	"\215\t\0249l\026\277\303\236\376\263\224\252\314R\352\335\207"
+	.ascii	"\035\025\345aL\255C\230\2644\353g\367\336;\354\244+3\262\374"
+	.ascii	"9\242\367\302\313\342w\240\002\005JF{P\324\336R{\373\310q\322"
+	.ascii	"\350\252Z\006\331\022\345\031\255\336]\273,+9\023yG\005\247\314"
+	.ascii	"\342w\b\323\1776\313f\227\253H\335&ed"
+	.string	"\331\241FY\231%+\n\332\333\253HX\007\030\372\317N~+V\351\2522;\261d\267j\357\254\021\306\242\220\035\234\0027\372\317cy\254\213\002:&L\314\245\234\\\247\345\306\360\022&\211\305\247\200\212\022%\326/N\336\202w6\211\253{R\226$\211\365\253\200\013^\006\2711`\240X|\n\220\344#\371H\326q\302\020\237\332\327\031,+\213O\201\214\\$\027\311`o\324~\236\320Y\2433\362\f\206\213\254\261\241\306\342\363\331\257\377;=2\264\266\370\260\370\023\360i/\257\374%\267D\243\211\003\002g\310\363\227)f\371\027(\304\234\262%7&$\310\217\225-Z8~\336\360\330^X\374\t\344zd =2W\366\341#sU\276\\G\317\214\301#L\\\376\361\314\245\346\252H\022\213'x\242?\301\326V\336\261\225ul\220s\344\034Y\307\316F\222\300%*\213\005q\323\225u(a\342ee\3619"
+	.string	"\352s"
+	.ascii	"\243\225ohe\033y\357\232\344\302B\356-\344\007\0324\262\215\272"
+	.ascii	"\221%\262D\325x\266q\312\211-\221\263\370|?_cu\200\026\237\203"
+	.ascii	"\025}\016b\372\366\253fdF\276\031\341$\212\003\r\375\347\031"
+	.ascii	"\257\312<\303\326\250Y{Gmy(\323\342#Wv\206\317\342s\200\312T"
+	.ascii	"\231*[\201 G+\303\360le\211\354\235\331bq\206\221ep\351\241\305"
+	.ascii	"L\226\221c\300\260\345E\027\023+\213Z\2312Wa6=Q]:\342X|"
+	.string	"\276\312\366\177\307\364\212\263\006\213\305/J\243\377<\245\314Sf\333\315\251\035\204,l\357\255\016|\224<Y\223\262\370Ed\364\237\243rTe\253j\033+\003\f\032C\304\372\366\246\353"
+	.string	"\327q\223W\304\342\027%\363\316\333\372U8]K\266\212\302"
+	.ascii	"\001\255\337Y\204F\327\022\300\277?&Z\364\374\372\226~~\227;"
+	.ascii	"aGe\215`\262\004\271;\270\004\\\372\372\354W\321\206\202C\002"
+	.ascii	"\023\265\2668q\314\242$p\242\177s\357'Q\242*\315=\3735\342\304"
+	.ascii	"2\306j9D\377\246^U\232z&\335\t;JK\003%x\311\016.\001\2166m\314"
+	.ascii	"e\335{\357\255\r\365\246\004\016\344\207\337tss\371s&\267\234"
+	.ascii	"C\367\177'(g\244\317\342KP\245o\2261\363n\232\271\031s\215\336"
+	.ascii	"{C%7V\221\331\022=\277\276\275\265\365\341\234\3636Gg\252\271"
+	.ascii	"\271\006N\\\035(3M\024\037\227^\0324p\242\310\270X\032{;\352"
+	.ascii	"\3141\317T8\030\312\013#H\213\037\001\034\375\277\356(\344\336"
+	.ascii	"[\313Ln\244TO\376\353\253Y\353\207\337\247\336\232\301\177\274"
+	.ascii	"\3671\300\264\367\2136D\366\336uO3\301\022\265\303\3036\355\366"
+	.ascii	"\236\352\202J@W\326T\027\216*eW\226\206*e\327\206\232B\002\245"
+	.ascii	"\001\271\273\240\252\224{k\230\232\202:\301\225U\245\214\332"
+	.ascii	"\032\252\224;k\277\300\313\252;\331\005\265\247\270\266\206="
+	.ascii	"\265\243\266\222+\313C\325TWV\2252*KC\225\262+k+\273v\320\236"
+	.ascii	"\212B\306\230\332H\r[\331\365f+\271\262\202\252\224\\YU\312."
+	.ascii	"0\325\210\2148ql\260!\002\326\245\336UM\355\031W<\242\220AvU"
+	.ascii	"I\256}f\357\352F\265\221\333n\357\f\366\346\301\205<\023\205"
+	.ascii	"\243\302I\331\315\220\262\022\305\305\341J\312\213kO\331A\325"
+	.ascii	"mW%\306\265\267\230\224\322\276\332{o\020\240\222v\273H\265\203"
+	.ascii	"\n\302c[Q\355=\301N\356}\2657T\335v{o\250\275\367\211\344\221"
+	.ascii	"\334[GPU\330\325\325\336[EW\233\007T\026\252\275\255[\032\270"
+	.ascii	"\254*\245\027\227Q\0266e\330\206\221\204\252UV\\;l\237\351Bj"
+	.ascii	"%T\332\266\332{W8:,\213\206\236\305\311\344\336I \0368\037Sj"
+	.ascii	"Xl\342\211\260\307\204\255\335\231b,\016\030\226hY\374\b\310"
+	.ascii	"\3140`\260X9\331o\026W\245\331\305\254\333\251\332;K\003%]z~"
+	.ascii	"}\033\271\325\301\217\330\\\2304\213\275\350\330\001\367f\361"
+	.ascii	"#\270\241\037A\026\227\236\250\033ow\026?\202*\235T\356\275\201"
+	.ascii	"z\322P\021\303'g^\345+:\313\2738L\343\007o\315\223-[\350\324"
+	.ascii	":5\033D\264d\351\211+3\003\307\342\252\003\nJ\026\034\316\201"
+	.ascii	"\377\334\306H\301\002\366vw\\1\221<K\356\344rX"
+	.string	"\261Xw\214\236\032\263*&\225%5\314\352lr\212\311\220\031F\246X \246\024/O\242\334\332ZlmEa\273\331V\271\266\004?4\326\310tXl\256\031\335d#\001,\310\023\213\257\2514\245\234r]\210hI\301k\354]\231\0163j^\362\230\273\036=\322\002\031\210C\241q'%\016=\034\211N=A>W\n\2012\r\3234(L\227\320\023(\3230\345ib:\332I\205\305%\026fz4\022\207(\210\0178\016+@U\230H\"\242\251p\311\351hIh\001q(4\301\307\004\007\024+8\240\005\242P\001\034RDp\245\020)\021eB2\n\213+4\020\016#0d\024\242K&Z\240HZ\351\350\264B\013\024\351\034\266@O \031\205HDa\252\242\005\2124t\245\020\030\034\217\206\351q\230\nS\025-\034\205,\030\321%'$T\351\350\330\341J!\216\202(\3230%:\031E\034\261\270"
+	.ascii	"\r\n\207\216I\302%\024\350\322\n\341qx\002M\"\272R\b\021\305"
+	.ascii	"\241\004\371J!\216KK\302#\245T\310$\302\205\242Q)-\022O\026B"
+	.ascii	"t\t\247Gb\361\310d\221\022\207\306\245\314T$\242'\232\212E\007"
+	.ascii	" \rW@[\f\323#\341\206\247\246\242\t\240\364J!\222\232D$5\t\035"
+	.ascii	"\021\235xR\364\210\032\315c0\251\251'\r\022\223\232LbR\323UJ"
+	.ascii	"\223\210\350RF_\030\036\361SS\361\b\033\323\246\213\204\236H"
+	.ascii	"\350\321\t\037\317\033\203IM!|\236\214\351q\230\204\246\020\242"
+	.string	"@:$\016\205L\bB\227\322\264hTb\201\370\204\304sl:\201\246\302\024\307\025%\374\f\245\250\t\033\210\220\204h\n\026\220\204h\n\016\024\034\215NG!\232\002\022*\224 \202$\342\020E\206$\342\220HtJ\201\3428\004\300\220\t\307\341\005\023$\t\215h\213\022\226\234\230\234\216\216JHQ\023\212\306\247$\f8\240)\272\324\304T4qD\241h|J\362\0204\"Dj\0246\205@S!R\023\004\220\320\324(LU\034\205\022H\"\016\231\214%\244G\343\220\205\007&4=>\251\bj0\201\311XdaD\233\"0\257\024\"\311i\005\212$\002ii\350\264\002E*\246\260\003\364\243\020KML\303\r\212\306'\0232\370\244(z\002\"\016\233T\270 \244\200\261\210\002\210\205\037\245\237 \021E\212\036\321\024IMC?\032\032Q\"\232\244\017B\b\036\2040\202\213\363#\024`D\001F\344\217P"
+	.string	"#\243\002\204`\244\037\202\321E\203H(\264p\024\246\032\r\242H\305\024\214h\023\212\256\350yZ4>%\3414x\204"
+	.string	"\3124L\3651\037{R4\311(L\177\322 \211\017P\246a\332T,:\340\207\205\211\023%\244D\247\242\t\036&'\025;H\350\322\n!q\001G\242\013E$\t\214\222\210C\342P\310\204\2468\242KGOG@\307\240\006&\247\343M\211A\246{\f\266@\221\322\343\231B\n*\220\226\212A\246\254\302\005\224\030d\312Fa\213{\304s\f\006 \005\n\236W\n\221\0369\031\323#\211c\320\005\232:1ih\341\250\270\024\f\346\340iD\211.\024\203\301\363hD\217N\304`P#\021\207-\004\203\371\030<\211\305\341q\270\204\006\203;i0=\016\227\202\256\024\342\2106=\245\036 \241F\241\322\321\003\021\307t\270B\204\0231\311\003\027N\304\341\222\007 \204\020\fa\004\027\"P$\247\245#\342P\204\361\350$\202"
+	.string	"\251\013\224\270$$\032\321\2248\f\"\tQ\243R\332\024\fJ\320\00256\005\2039=\016\227\202\301,L\205H\301`6\n\225\2160\372\302\360\030\f\346\026\216\212K8\035\022QH\207\304!\021\021\005\222\0205fc\272\302\021\321\t\2050\025\236@\022\242)\212\306'\0238\020Q\370\\)\3040u\201\032\321%$\242\360\204a\352\002\025J\211,\3541x\204\246h\341H\270biIhb\230\272@5\fS\027(N\217\301a\223\n\026\350\t\264\351\211\205 \n+\250\340A\217\210\302\364H\034\3524\370"
+	.ascii	"\0240q\270\002\361x\224\207M\307{\f\232 \201\002\217\t\022(\354"
+	.ascii	"\344#\022\303{\245\020G\247\025\301\024\220\202\214hz\0242\345"
+	.ascii	"\343\0215\"!\tO\264\205pI\205S\023\223v\n\266@\221\216N+\364"
+	.ascii	"1\210\036\r[\240'\216N+x\320 \332\364\304\302\321i\305\016\332"
+	.ascii	"\364\224\036\235V\234G\247\025\027]\022\036\035\315\242\021\255"
+	.ascii	"\2006q\242\2044H\342\203\2248<\217N\305a\013\324\270\302\006"
+	.ascii	"\027\204)L\234\310\200\032\235R\241\021mbBS\236\364J!\234\232"
+	.ascii	"\230"
+	.string	"\202E\343S\322\321\221P\304\321\210\266\030\032\221\004\200\006S\214(1\"\004\247&&!bq\230:-\025\217\2501\30318\204\006\235\232\230xr\272\344tDS\020\213C\247&\246\rh\220\2304\\\022\006\177\210I\303\245\022\202>/\234\320"
+	.ascii	"4\025\246xB\022\242)\204\251\020i\207E\323R\017\213\246\245\340"
+	.ascii	"\013J-\220\370`\303\261\251h<aD\221\206-\206'\234\232\230\200"
+	.ascii	"\322`\222\220\205\342\360L\022\2620L], %\242\340\324\304\344"
+	.ascii	"\203\006\177NH\257\024\342\250\224\n\231\230\3521\030lb!\344"
+	.ascii	"bhL\205)\244E\343\317I\202'=\006[\240'Z\240'T\270 4\022Q\350"
+	.ascii	"\241%\037\242T\203S\320\001E\343S\222P\332B\005BSaz4\321T\230"
+	.ascii	"\2520J\233~~\214\214\214\351\nC)\213\036\"\212\247\245\246\246"
+	.ascii	"\022\204\322+\205\020A,21\025\217( \361d\217\301\026\210B\005"
+	.ascii	" \t\23580\\\261a\304\nk\264\302\222Xa\215\204\226\204\320\032"
+	.ascii	"\271\260$\\X\243'K\242\347\205\023\320T\230\002]jb\022\2528:"
+	.ascii	"\022\002\241G\b\024Y(\032\237\222vP\244b\n\304\3420=B\323\242"
+	.ascii	"q\205\243\360\204\242\361)\211\303R\261\250\200\240\231D\034"
+	.ascii	"&\231\260$t:\201\036\235\206\322\240\013\024\2118\f\036\217\206"
+	.ascii	"LB\342\023R0UJ\032.\261\220\3408tQB\222\323\n\364\004\212\036"
+	.ascii	"\342\320\2050\005\026M\016 >!\355\264p\024\246p\034"
+	.string	"\272(\241\030\224^i\202\027\233P\243\210\264X4\212\340AB\323#4EO\034\217\301\244!\013b\261\207\205\224\2102\241-\212)\024\215OI\036X4-\005Q\243\320\005$\243P\311xd\021TJ\032*\371\240G\247`1\345yA\t\350\005\245 ##\022\301\027\224\206H\004Y\260(\246N)\213\342\261\310\005\341S0E\217,X\024\201\\(.\2610\242-\036\320\302\021\252t\344\243\001mzJ\203$\216Ga\223\013\305\245\rOF\264E\361\b5j8\221\226\212JG\324\250\224\006\211\303\246c\320\005\341\323\006\247\023\304\3420\025\032W\f\227\204&\212\306\247$\t\202,\232\226^P\n\272\020\246D\364\310\2106\005\225R\244\241\013\022p\200'\r\206`\224\022\207N\372\005\245 q\310\024d,\246B\246azD\205R\242S\361(\250t\224\026\211A\342\023\022P\032\034!%\016\235\316\033\031\231\360"
+	.string	"\001\025L\320G!\212\306\247$\021Gc\361HD\217\"\210C!\223\210#\343QD\b\016\307\241\013a0\311i\005\212\0244\242\351\322\220E\260h|J\212\340\277\366q\246\371\374\305\371\355\351\036\347YUC\032\211\323<r\330(O\316\222z\207\326\321c\343\313/\020HL\037\021+\026\333\260\241\267\276!\252\007\t|\313\274\245\336\3228z\350\242\310I\3238\364\r\273\303\240i\263[`\374\302X|\r\306\264\306\322X\232\206\336"
+	.string	"\270di\202\324Z\3274\344L\2525{x\026\353\254\313i:S\320\310X\254\221\227\253\013\343\365C\0030\375\353\031'\225e\024\216\030\372J\315\230\2537mujy\003D\223\003\303\311\205I\024Y\240\216\241\315\252\214\271Y|\r|\350_W\3455\"h?,>\223\233\241\251\314%\240\336Z\026\213\365\224\2362\227\272\366\320\322\363#\323\340J\377Z\312\352=\340\n\240X\324\263\325\225\233\230\322\342\344\031\026\026\030\227\305\277\3366v@\371\261g1 \240\271\254%\234"
+	.string	" P\377g\035\272/j\177s\026\237q\3168'\235\212D\302\361\340\314\nMG\337\336\252\361\341?\373~\3229\375\322|\311y9\347"
+	.string	"q\341\373\001g\361\001\320E\237rL:<\300#r"
+	.string	"\200E\377'\237\0166'j\334\366\270\276\330H.\201\023D\306\223:3,\336@?~c\260\344$\305\332\310\362\226\347\r\266\2767\255\323\315\t\226\205\345\207\226\263\315\031\346#\256K\0346bu\\\252\024Y\003e\027fKU\036\313\231&-l\357\035\324\223f\357\212\233\305\007\300\224\363\314y\346\314;\001\n\003jz~d"
+	.string	""
+	.ascii	"\273\273;\363\336\214\250\353:\313\374\314Cr\345G\034\031\277"
+	.ascii	"-cc'\231s\f\032_`\r\031z\213X\022\313\211gN\ta\342\267\306\342"
+	.ascii	"\003\340J\237bN1b2\330;\277\234_N0;\033\251\347\241N\017\314"
+	.ascii	"m{\021\205H\231\305\317@N\277*\317\272\254C\001zVBN/f\035\317"
+	.ascii	"^2l\237]\326(\251\344\365Y\034\367\270\223K\221\336P\306\320"
+	.ascii	"-}\266@\301\2333\367\223\013\22039\276,>\345\200\336\322\316"
+	.ascii	"\200\265Y\261rjA3\007\246&*\313O-O\252\220X\026\237WN\270\377"
+	.ascii	";>nXp\270\234pgX\035\253\2754<|A"
+	.string	"t\300`\361\371f\313t\301\230\322\226\301\021)RN*Umc!`\313\201\313p]InL\371I\305\n\371\242\201\304\342s\355t\243:\322$\206\362\250C\322\243jT\252\245(%\231A\n\021\315\214&\315\0303\025@0HH&\023\013\227Q\347\001\023\300\003\313\354\304\221\234'\235S2\"\222$)\325\330:\262 \374\364:\220[c\244YBF\331jznA\345\243\214g\013xG\266\2053\204k\002\220t\335!G\264\330\017\027\277\326\212\267\202\363^?9\325\033\300|\267T\344\3343\0077D\315\345c\371%L\373\301\341\361\336\254\001\032\002\273\0214\275\232)\203FLPm\202kP\n\\6\007\326\034bb7\246m\262\030\003\366\r\274\214)\216\276\300\306\\\334\330\227L\b\324^\317\343\230O\017\233\020\032\026G\216\007A\311\003\252\313\231\320\026\b31}S\350\025\360+Inr\345\037\331\\"
+	.ascii	"b\342\220q&i\355\200'NZ\357d\244\242\210\276 \331\267k\rja4\317"
+	.ascii	"M\234(\373\244\236\352\"\312\026\004\260\200\310\300:>\312u*"
+	.ascii	"\376\341!py\256\244\230\302\277"
+	.string	"\006`\016j\bF\200\304@\206\373i\251\032\343\317h\013h\230\021\005RR?\016D4\327{x \306\305\036?[(\347\034\f\270\t\302h2\321&\024\272\206\265\207y\004*O:\030&y\013\027\315s\273\231).\234=\306b3O\031\211K\343\033'\332\335R[J>4q4\242\220K\320~n\364<\0322\362\203U\216d\255@\017\024)<=xt\313\224\231\206\201\026\314o\320f\255'_\273\331\253\033\007.\023@\370\217(>R\345\254n\013\245\361\351\235F@\200\375\217'\325\214\270\262\264-E\262\215\027 \252y>\276\342\367=\206\227Uy\330\220\321\363\032\305\263:\210\277\016|\266\271k(\004\274K\212\033\027{\n\016\fL\2768\260\200\234\343e\327\231_  \336Mb\374|\253\274)\252\223\3447\017Pv\362U\270\313<\003#~\232\376RF[\026\304\3514\210\032U\210~i\314x\245"
+	.string	"I}\033\247\344h\324U*\"\372\256{\267\353\326\266\3174\325\203\2566,(+\261=\027\216\347\032\3771{H\233\237\256\360uw\275r\206\203\305\247\363*\345t\222)\335:\250\262^\271\311[\356\332\007\340\021\364\310\030\3142@\037\007x\350\351Ab"
+	.ascii	"\376O\307G*\216Z 4\314\3113\264\3764\253\2750>4\247\013\273\017"
+	.ascii	"\232\247S\364\200Q\375\270vyX\322\254\027\267\240\325*B\372%"
+	.ascii	"\227\033\346\n\t8\t\375\032\036d"
+	.string	"\3614\231W4\264 \347\373\365\324\"XT\345aM\225\0139\313\t\201\345\221\256\n\253\312\336w<\367W\036I>\333y\312\001\005_t\366\310\377o<\213\016\027\004\313\313\rp\033\322U\364\260\305+\264\314.{L\002\263,Q\332\246\177+"
+	.string	"50\325\027\202\305\375\\\350\272 \271R\263\330\344\307c\206\362\335\333f\341\2503\202X\254\316y\307\323\252\272\277\016t.\"e\260\200\311x\201\214\226\352%\305\252 \326\352\316;V\231\306"
+	.ascii	"a9.od\227+s\3348_\326\346\316\217\341}[\210=\301\021\355\206"
+	.ascii	"C\3217\310\377-!&\204\316\201\274\375\300+\330\254\332\214W\374"
+	.ascii	"{\276\207Q<\345\311\221\306\253\215\021\334\025\t\277\320\355"
+	.ascii	"\372\377\375\245\353\t\034\320\2402\232\247\\\220K\346\003M'"
+	.ascii	"\n\334q\3228R\347\317$\f\022H\240\343\252\277\300(\212EZ{ro\363"
+	.ascii	"H\326\252cv\363I(\216\035S\203\247F\230\315;\362\016OA`@/NK\223"
+	.ascii	"\210\276\r\035\274i`\265\021\360\210\243\304\032 \254\300r\034"
+	.ascii	"OQ"
+	.string	"\322\201W\302\263\006\336\030\361U\355n\327vj\214\202{\265S\367\254\311\226\022\034\320\323\262kB\013R\213@\272\326]0\254G\255\374\201\270\310@c\207\204\320\021\210\244\t\034\216$\245\340\007\245\b;\003gp\313OcZ\325\005\327[H3\306]\034\220^\2573\275\312\\\320\260\327\201#.\205\035NN\306\330\214A-R7\237@E\357\300+T\222\020u\253\225\304\222\257\264\307\002h\307(\227\217\334\355\251y\013W\247\307\f|\351\327<(\347\023w\021\005\236\b\263\273\214n\022\213\342h\306x\277\266\225v\220&T0\206#\353\326&U\257\231w\203gPG\3301\020\350:\242\340\203P\n\352\306\370\2368l\264Y\\_\345\312]\037\304L\233\004\f\007\025\032b\022\\\245\315r\345P\307=Z2\373R\002\207$:\246\001\025\003\227\353$\307\254\307\300<.agr\367\216\233\215f^\r\n\032\340_"
+	.ascii	"6J\313\007\021\304m{g\255\027\034(\256\221/-e\352j\363\326>h"
+	.ascii	"\223S\370V\f)\336}\233\302\301\206\b\330\314\313\260\347\315"
+	.ascii	"v\313\235\352l\243\326\360B\271\254\3077GD\203l\233\271\rB$-"
+	.ascii	"\305?]\366\324>\21710=a\034\324\377e\315\324\365\017"
+	.string	"p\017\016Icd/\345\033q'\212\321\365c?YC\205\301\24214\347\b\206a\n\210\344\320B\222zd\345t\270\255\252\246\257*\352H\315B|\244\370\"\277\3600\"4\234\352\232\333\331\26733\026X*A\236m\233\323\020\366\020\r\266\345\236]\3544\266\246\235\304\233j\236g\325v\232L\202\324ah\261\243\254\b\305\017\227\311\324\303\3260c\035\331\320\002\b\202\252m\354\206\225!z^!\316\233-\263\254\257\020\027X%\3733{\325\343\201\212\270m\017\0370zT\237&# \t\274\274\205\005\333\306\333\273\025\2241\364\262~\237VmZ\337\nLe\210\020\261\361\257I\223\2219\233)\275[\230A\025s\241f\217)\270\2774\255\201a\223\270\337Ix\373\337n~o\353DVt\305Fb\266\023\351K\t\362\3767jX\330\275\336$\017:9\277\016U\352.\344<\\\360r\215]w\230\034a\266\365"
+	.string	"\3061S\034\n\r-\301\233{)c\253\236\373\2317\210\271\327/\334J\245\312\275\244Hs\374OFk^\244<\341\304\321\214\332\3111\317%\244<2%\nn\326&\275$\222(\302f\017hVZ\204\343\304\"P;`p\215\377r\023\334\007\2758E\037 \264\b\002\320+\235\215\226\270\3324S\223\254C\2104A\260\344c=\245\020\363Vm\031\304\322i\bNT\225y\301S\300O\032\3565\031\013\312V\377RJ8\357o{\177\273v\232\250\346z\274T~\255\377} \266\2322\340\r\t\276r \344=\351>\365[\327\023u\312\027\224\376X\277\272=\242\217\220\314\277\342_\316\351\016\032"
+	.string	"-\2463:\227\233t\210\024\351{\030\214\201\370\263\031\246\327\363f\021\004*D\221kxt\353\310\224\257\006u\214.\032\257\0365tf--\332\364M\270<TP\327\245\360\314\017\n,\250\225\260\333\177\265&I(\234\235\271\201\207 \341\234\307\202\020\313\017\331\r^2g\273\303Az\006S\320!N\003\222>\316\327 olo\271\353\f\300\311\344@`\021\036\032\224\243\033<+7\254\222K=\004\254\022\316\267b\330\255\217\250_7\203\005\240\241Q\366\346\344\227S\234\236kC\226\266\226\220\274\025\262e\3056\306-\360;\326\360\256s\022\302\235\357\376u\310y\260\216cl\207\t\363"
+	.string	"\230r\260\222X\207\227i\222/\256\327\r\024\355"
+	.string	"\257\256V\2555jQ\300,#!\324\327\241,\"_f\225\b\371\3746\370\344z\227\031e\272B0\013\346\336v\271\232E\023\351P\340 y\202<\233\r>V\261X7\002\f\b/6\363@}_\036\210S\007\237\320\337OM87>c\254`\313\002\237D'\262\332z\223\254\2344slD\207\324\200\307\177\262`/\b\033a\236r3\341\205\235\201\345\273s\177`p\211\257\b\223aP\252Oc)\\\210u\322\217\301\034\212\032\331\374VW\326\352\2546\313\260!p`LC!\343\343\303\205$\024K\253\n\247+\031j\271Y\364\230\324f\244RD\fF\036\227e\203\331\364\361\t\361\0271\301\367\373\237\364\336\336\213{\006A\371y\333%\020\377\324\263\b\r\004\316'\002\367\231\270\262Q\353\201\273`#\316\200\375S \277\344,\375z\221\272\022K\330\307\206\305X%\020\354\006\242\320I\031"
+	.string	"eHF\024\235\265\022u3By\016\322\237\346/wp'8%\357\0030\030\220\263\301\200d\326\240\330\313\261C\b\326&Jb\031!\224\251\370T\214~\345e\272\315=\036\206\037su\217\023}\2452\326\036D\224\227\342\261"
+	.string	"\324\"\213\016\246\006\210\237?\264\326\257\036\324\247\333\257wK\023\367\323\367\331\003\256\227\026\345\240\231v\223\275\247\205J\305I\255\257\240\260j\353\227\003\202\331\24182"
+	.string	"\345\2411ou\336^\311FRU&x\260\315<\274SDF\213\037\222\303bLh\227\351}\323SaM\262\0046\335D\261\355\241<\362\370\345\036M\214\257\227d\342N?\245\351O,.\200\032,\2450"
+	.string	"\372^SD\234\013\262G7\315\220\226\230\256R$\020\217\245|~ I\375\307\023\353E\013\017l\331\257au\200\374\013\302e\t!'E\001I\252x\r\312\030\2407\3249\231(\323\374\t$`\003\354V%\312\005\322\240t\3071V(v\353\0174\314o\032\264\220\277\022/\225UY\274q\316\013 \001\302\320\325\324\326s#zq\"\\D\356\r;\254\345x;x\230\001\024\032\351\032\347\310.\315+p\017\353.\035\312\216\345\337\241\341\210\r\203\241\264\276\256\345\225\301\036\336\303P\204+\031\347X\344\220\237\365\305\322\017\377\200\376\177\276\352m"
+	.ascii	"\005\207%\tSH\211\362\006\260!nY\021q\217\225\332@\b\253\324"
+	.ascii	"N\364\330\354\t\362\002\0212\333\306\220\353\237\330d\325\254"
+	.ascii	"\242\201MF\267\355Bja\322\337+\202*\320\020\313\370\356\260\331"
+	.ascii	"?5\2553\242\200\263@\r\275\262\017\023\260+\b\260F\255\2316\024"
+	.ascii	"\247d\024\251\034\320\2425\2148?\352m\001\b\222Y\320\342\340"
+	.ascii	"\245["
+	.string	"\325\001g\017\226\214\2162\323a\213E?\240`HA\001E\002\265\224{\221\016\200\346\201?\260\335\234\232.\t\241\310`\226xz\262D\301\233\214|P2\344PG9z+\324\336,\334P\240\330\274\234"
+	.string	"A&\027\326oh\220wN\001\323\355\243m\004\212P\345\324;@\211!B\2071\035\371^\360]Q\252W\233\3464\032H'\206\350Yiy\315\270\r:\001\253d\260\231\003>\250\243\003\r%\352\311&B\222\030(\317c\344*\237\177\335\203\221N\n/\253\207\250\205\006\021^\244\032_O\275u\355D\b\312\004l(Z\262\342\244\231\030\022\326\372J\254F\017\233]\243\001\036\266c^#E\362\362\216\330\320\222\254I\347\221\334"
+	.ascii	"\216T\317\237\002\307\263\347a\240\021\205\351W\303\370R&\330"
+	.ascii	"N?\227\332\223\255\347\"\342c\222\246]k\376\302\022\3468\263"
+	.ascii	"b\315\355o\213\n\373\317\203 \236A/\023T)>q8\023N<ifO\261\316"
+	.ascii	"\\\325\034\232\377\201\bC[\006\330\002*\250\321\314:\265\342"
+	.ascii	"\307\321\243\177\200\255\352\344LB\225bz\226\303\257\244\204"
+	.ascii	"\021]%f\035Z\271\335\r\223\fi\006SMy2\206\027\333\350\350\302"
+	.ascii	"\r\376\244\005@F e8D\f\351\377\265A\370\233\016\321\246\262\322"
+	.ascii	"\351\3062\313\375\013\316Sx0\235\357Ci\262\2425\235@Q\357\201"
+	.ascii	"\330$Wmy\231\201<\303\361\210\\\t'9\221\225\362\203\347\3760"
+	.ascii	"\345\216,\017\230\023\311\272\327'\365\202\300X[q\356\361\367"
+	.ascii	"\242\372\f\312\256]\312z\352UT\273\255\200\f\210h\343\3461\232"
+	.ascii	"H?R\235L\313m\234\270\227\027\031\263\301~\232\313\360\335\325"
+	.ascii	"\017\217\323\357\375\367\217\374\376M\f\245?\\\274\344\345\361"
+	.ascii	"\320\357@\346\200\301\241\236\3676\360\377\035\366\364\257\231"
+	.ascii	"\f\246\3310%\334\f\323O9\306K\335\037\237\374\352;8j\347\234"
+	.ascii	"\370\330\217\026to\3432&\027n\234\020\303\264\024\037\202\327"
+	.ascii	"\272(p<s\203v\237N\355$\252\017z\364\254T\370\215Z\257b\215\313"
+	.ascii	"\3676s~1\322\274\266s\354\321\327p}K\013\264\345\366\020YN\305"
+	.ascii	"\356\350\313m"
+	.string	"\273\021\335\312-\236\"\345\241\305\236\240\316\220\275\022\346\003\220\264w\311.f\313@\330\271\033?\243\264\017\277\327\220\345\033\\\266B~\216\371\340\351\237C6\304<\242\247\003 \374\336\346Jvz\251\333?\244\366\005\372\b\367\021\374#v~:\206\344\275\310\332t\333\377`\277u8\377\304\225\336\365\253.\220\322\362\362\277j\364\034 \374\250\376\306i\351\302\343\007\340\366?T?\202\377\221\204-A}\005\026\357\363\371\3363\037\277\356\327S.\247?\331\034fI\305\363x\276\314\326\304j\374d1M\221i^\356\303Y\300{!\356L\276\374\204\364\233\206\343\301\203gs\036\225\216=r\327\232\301\325\355\303\357uy\301\2651\367\033P#\310\236+\377\232\370\023W\305\027Q;\222`.\234\271\323{\251c\0252\031\262\336\2110\006n\237\247\211\300{:~`\306\267*\006\342\234N\314\201\261\265\335\271\375\020\203\345\312\r"
+	.ascii	"\336\356/de\324cGGycJL_\240.\343\200\262\007\365\201d^Y\236q"
+	.ascii	"\375\023)\260\245\350\216\315\217\232\317\260\365m\355W\0166"
+	.ascii	"\3046\224\371;q\177S\376\217\273\212\366\310ZFG\376\017\345]"
+	.ascii	"}v\250\372D6>\026\373\373\361\233\342\277\376\300\354\310\307"
+	.ascii	"\226\357\352\317\352\330\340\204u39w\360\315F[Sr\353\372\020"
+	.ascii	"\307/\352\301^m\013nA~\rV\3352\t\223xSf\021\325.\230'\233\350"
+	.ascii	"(G\023b\324ui\350\343\366k`\024\372\232\236\363n\364\336\237"
+	.ascii	"Z\275\323\206iN\364\263\037ut<\3403Ne\f\274\247\303s\361\260"
+	.ascii	"\231\375u\005"
+	.text
+	.section	.gnu.lto_.symtab.a50b7dd828a4ddf4,"e",@progbits
+	.string	"pgResetFn_gyroConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\002"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\002"
+	.string	""
+	.string	"gyroConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\003"
+	.string	""
+	.string	"isGyroSensorCalibrationComplete"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\003"
+	.string	""
+	.string	"gyroIsCalibrationComplete"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\003"
+	.string	""
+	.string	"gyroStartCalibration"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\003"
+	.string	""
+	.string	"isFirstArmingGyroCalibrationRunning"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\003"
+	.string	""
+	.string	"gyroUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\003"
+	.string	""
+	.string	"gyroInitFilterFn"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\003"
+	.string	""
+	.string	"gyroFiltering"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\003"
+	.string	""
+	.string	"gyroGetAccumulationAverage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \003"
+	.string	""
+	.string	"gyroReadSensorTemperature"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\003"
+	.string	""
+	.string	"gyroReadTemperature"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\003"
+	.string	""
+	.string	"gyroGetTemperature"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\003"
+	.string	""
+	.string	"gyroOverflowDetected"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\003"
+	.string	""
+	.string	"gyroYawSpinDetected"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\003"
+	.string	""
+	.string	"gyroAbsRateDps"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\003"
+	.string	""
+	.string	"dynThrottle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\003"
+	.string	""
+	.string	"dynLpfGyroUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\003"
+	.string	""
+	.string	"initYawSpinRecovery"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\003"
+	.string	""
+	.string	"gyroConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\003"
+	.string	""
+	.string	"gyroConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\003"
+	.string	""
+	.string	"activePidLoopDenom"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\003"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\003"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\003"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\003"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\003"
+	.string	""
+	.string	"getArmingDisableFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\003"
+	.string	""
+	.string	"schedulerResetTaskStatistics"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\003"
+	.string	""
+	.string	"devStandardDeviation"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\003"
+	.string	""
+	.string	"devPush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\003"
+	.string	""
+	.string	"devClear"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\003"
+	.string	""
+	.string	"alignSensorViaMatrix"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\003"
+	.string	""
+	.string	"alignSensorViaRotation"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\003"
+	.string	""
+	.string	"biquadFilterBankUpdateLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\003"
+	.string	""
+	.string	"pt1FilterBankUpdateCutoff"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\003"
+	.string	""
+	.string	"pt1FilterGain"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.a50b7dd828a4ddf4,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
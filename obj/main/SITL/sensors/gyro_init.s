@@ -0,0 +1,1373 @@
+	.file	"gyro_init.c"
+	.section	.gnu.lto_.profile.25da401d0df9f5bc,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\017"
+	.text
+	.section	.gnu.lto_.icf.25da401d0df9f5bc,"e",@progbits
+	.string	"(\265/\375`f\001\215\n"
+	.string	"\002\21526@o\323\030\354\364\005$\025\352\f\354\252}\254|\373\355\177\260\t\3770\320hN\004\204\301?1E\321p\030\206a\030\206a\026\004\330\1777\221\321\247\245f\245L{\0071jPJ\026\f\240\371F\255\203\350\344\025h\013W!Cp%\242\020Y\030\330+d\344\251\004lMD\224t"
+	.ascii	"s\344\005\303\364\221\337\221o\332+\257\326lUll\017\364\244\343"
+	.ascii	"\341\353D*%\204\031ms\316y\276\356\365\346}n\201\252R\347\361"
+	.ascii	"ij\t\\$1\t\\\266\352\205\b3\330\274z\215tq\34281\0035VH\227\006"
+	.ascii	"\206.\246\215<\312\251\251Y$B S3e\205:Pau\271\353\357\231\037"
+	.ascii	"\020\031\337\362\370\331\006G\203I\374\304\r\002= `\002SE\325"
+	.ascii	"\003\024\006\200w\306\356\342m\331\246<\264go\306\266@|\337+"
+	.ascii	"ol\273gx\261b\302aT\336\337f\377p`\201\013\374\252\263ha#p\202"
+	.ascii	"\200=C\254\201\325j\326\3628\334\240 \260\346\271|\037\363|\003"
+	.ascii	"u\367,\360\260\200\200\274\302\336*\003\277\331\333U\2609\245"
+	.ascii	"k\333\3611\206\265pL0\006@\034\260q@\003 8\033\r4i\r\373\344"
+	.ascii	"\270\263\257\334Lh\357\307Z\027\027\300\r"
+	.text
+	.section	.gnu.lto_.ipa_sra.25da401d0df9f5bc,"e",@progbits
+	.string	"(\265/\375`\027"
+	.string	"\325\003"
+	.string	"\322E\017\026\2405\351\377\377\377\377"
+	.string	"\375\377\337\f33k\251\271\313D\356\224\002\226\376.\302\036L\301\f\354\003\346\342L\026\331\217\325\330BMGS\341\337\340qD\\\307]\267\233\306l\315Rq\024\031"
+	.ascii	"-\002C\306$3Xf \020\nQuY\003\270\231By\2022X\355\354\253\325"
+	.ascii	":X\t\306\250C1,\307\264\246S\361\340\003.\206/\026\246j\006\270"
+	.ascii	"\003t\0032)\300\020"
+	.text
+	.section	.gnu.lto_.inline.25da401d0df9f5bc,"e",@progbits
+	.string	"(\265/\375`\214\004\355\022"
+	.string	"F\232T?\020o\224t"
+	.string	""
+	.string	"\030P\204\200\034\316\220&\370\215T\024I=\230\235\347\004\027j\225\037A\337\"\220\257\034\210\007\376fc(P\325\201D\200\362\341\362q\017=X\201z\350G\306Fl\237l\271S>"
+	.string	"?"
+	.string	"F"
+	.string	"\367g\3426=\365\277\007\325\246\024:A\302\337\361\f\216\323\323\230\261\204\035HR$\026\314@zeZ\n\372G\252\212L\020\316\355\025UOBTf\266\336\277\351\335\257\324\314\314"
+	.string	"/`J\0067\034t\341\027\366\227\261\204\200(2pH\321\333\247\031\241\244\335>\207\312\333\207\335n\036M\221\244Lz\273\314\233\250}\362F\n\251F\220\213\232\026\252\257\220\231\326[\006\364\360\347\364\276\373\216S\327"
+	.string	"\357\364\016\277\017d\221iq\254q\030\n\253\3456Lm\221\231\034cF\224/"
+	.string	">\204X\351}\225\333\240\353f=\004\f\027\033,gd\364)\277F\305\016\261Qc\224`\360\220\301\216\037]q\242\204\210\003W\032\017\272\006]\231sPyz\032\257\215\023\316If^6P"
+	.ascii	"+\024\001Vj\307\203%\274\220ii\366\204\212wD\2527u\004\204\311"
+	.ascii	"HK\372hB\221\224\006\324\215X#\3023\031\306\256Go\204\0372C4"
+	.ascii	"/2\255\004\254\027y\250aER33#MA\245\305P\002A\250\310\314\003"
+	.ascii	"\022 \006A)\261!\252\321\224\024j\354\261w8\330\361\026\030/"
+	.ascii	"\261\312\341\034\tX\3622^\nw\035^qlW'\355\203`v\f\016\344T\373"
+	.ascii	"\345d\215\320!YA\034\333\246\271bt\304\262\243\250\367\\(pL9"
+	.ascii	"\317\276i\365W\233\373D4\246\027|\327K\2343Y\202\255\241t\313"
+	.ascii	"w:fn[\n\251&k\316zD\253z\rRZ\023\326dl6\206\202\351\310\276\336"
+	.ascii	"\331V\250\217\353\300\234\364Z\2644;\242\217\344\262\370:\356"
+	.ascii	"\372M\333\220\"\325\201\263\326\242\006\225l\036\266\264w\252"
+	.ascii	"\f+\354\332\310\271\222O\3135\364\360?\260\007\022\320t\233\356"
+	.ascii	"=\002\025\365\321\214e-C\204\005\224\3515\336\t\021'\363@\013"
+	.ascii	"\t\236\351\346\302\215\013~!\036\371`\273\005\347\211-\252\250"
+	.ascii	"\323\371\240+\277\227%_\364\032m\244\235S\333\216\315~6\325\333"
+	.ascii	"+\313\254\211J\034\036"
+	.text
+	.section	.gnu.lto_.jmpfuncs.25da401d0df9f5bc,"e",@progbits
+	.string	"(\265/\375`\177\003\235\013"
+	.string	"\"\217..pK\222\016\374\177\356\002\220\241\276]\027\252\252t\003\0262"
+	.string	"`\260\267n\315\261\341\343o4\347\020\376\253(Z[\253\317\327\310\266v\2232\005\317%\365\244\005\212\302'<\302\222\364\007\226\215\303F\206\3458\256\343\007g\203\271\217/\216}\301\023tj\030\032Q\020\312>\025\205\260\302\252\271\270\310S\261\260\352\201\027X\025\352\252\347\220\r\370+?\253\305\323J\312\222"
+	.string	"\037<\020(B\242\324 '\206\222u\326\242\306\236\234x\2121\005\246\342\213\003)\343\206\364\240\035\255\265\026\235\263\277\032;f\0362\363\224_m\2326\361\037\203\336\204\322\343\"I\263\357\2447\351Ed\227l\027\001I\250\221\265BV\242RP\2672\006P\202\021\224\272\343\001\022\300\002!\003\322<\313\230\021\214\231`\002\213\265\260e\226\213\001\325L\"elDx<k\250gH(\356c\257W\230\003\376\032%y\002H\232\347\005\300IB\027\"\325\202\303\036\377\244B\2408\020\311,j\275\304\240\240\001@\323\002\022\337\250\223\346\350\3015\027"
+	.string	"O\3148+\342\016}I\033^\264a=\253\343EzW}W$\253\t\264V\211\325X\252p\2031\320\2543C\366\360B\307\305\314,"
+	.ascii	"N\303\354\333\207\314p2sQd#c(\313\346E\310\267\265\236/L\373"
+	.ascii	"(\227(\254\225\256\024\3129\001"
+	.text
+	.section	.gnu.lto_.pureconst.25da401d0df9f5bc,"e",@progbits
+	.string	"(\265/\375 ;\331\001"
+	.string	"7"
+	.string	""
+	.string	""
+	.string	"\022"
+	.ascii	"\204\004\002\230\004\004\232\004\b\230\004\n\230\004\013\230"
+	.ascii	"\004\f\232\004\r\230\004\016\230\004\017\232\004\020\200\004"
+	.ascii	"\021\231\004\026\204\004\027\230\004\031\204\004\032\204\004"
+	.ascii	"\033\205\004\034\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.25da401d0df9f5bc,"e",@progbits
+	.string	"(\265/\375`\306"
+	.string	"\005\007"
+	.string	"R\211\035&\220E\031\016\377\377\177y~\275\377V\272\372\377\377\377\331\374\366?\033\017\204\246Y\371\233\003\333\312o\2735@\232\224)\337\004\264A\231RK\306\342\025\377$~R\"^\255\261j\316\264\346P\217e\336\026\273\314\373\316\t$]\213US\231\337\257\221\366\250mU&\207\004\fS\013;;\307\336\234?\312\243\362\022\006lA\345\020CG\331C\271T\376\315k\250\336&@0 \220\002\031,\353B!\224x.H\236\246\254\305\0017?\200b\316\021\3662i\207%\031\030m\250h\021,y\255Y\367K\344&\254\177Jn"
+	.ascii	"m\340E\324\"0\361f\030l\306\n\327\313\255#\203\335\231\305\022"
+	.ascii	"$\324H\360I\026\372\007\341b\353^\356\274\326\217\310,h\2670"
+	.ascii	"\325B\261\273ZX\233X\367\217W\021\206"
+	.text
+	.section	.gnu.lto_.lto.25da401d0df9f5bc,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_calculateNyquistAdjustedNotchHz.40.25da401d0df9f5bc,"e",@progbits
+	.string	"(\265/\375`\214\001\375\017"
+	.string	"6\336kE"
+	.string	"\261&\035@\032(\240\350\2731\252v\246\261\250bL:\273\211\221\036\2275\b\236O\\\bj(\3317\346Mql#\210\031\275\026\253-ZY\023\001\214V\177\311G6"
+	.string	"\221q4\025\377P7B\310\336R\246\024U"
+	.string	"S"
+	.string	"Y"
+	.ascii	"?.v?\004\036\321\036m\373(\236B\305\251\374D\274t\200\260a\275"
+	.ascii	"n"
+	.string	"\354~\033\310\007`\217\371\020\354QC<\365\b5S\276\002\031\236\226\226\352\261\243\005s\350\321bI\375hm\200\"\273\373\327\323\245\265\312\314\026\354\256\263\245\345\341\306n;\202m\t\366w\002\252\324\032\373p\225\306\016\375\373\265\273\376\3549\256\033\302\264\302t\302\364;\262\0172\b\350\354v\b\312\261>\361\205\315s~[\305\177\331\3037\307Qy\016JS\275h,V&l\354~\007\036\335@{\024\201\017\301\276T\202,\313J\206$\363\256\224\343\356L+\272\212Z\023\322\t15X@\207\252\035N\217\246\252\032bb\260\200rwU\2525\3064\325\002\016\f\226\374q\246\251\020bxX@\327\00273\3470Ls\006\207\023+\237|\005\247\355.\211\257s\025(\376\210G{\247|\313\243\177\302\036\257\001vzp\270V2\310\376\002&\217tBA=@\211J\243\023\312\250s  \245\304\304\2043\235\030"
+	.string	"H)\301 2q\245\314\242\021\023\251D\242\300u\250\013\233\327q^i\344m%R\205\223M\324y\333\210\001s\031F\335f\342\270n\363\370\366p\225\306\th\250\237\302\376z\210D\211\0260\244\206\231)T\027\333P?X0>\001\036"
+	.ascii	"F\305\251\325\301\2051\215\004b\213\314\326)\241-<\263\230%\200"
+	.ascii	"j\246\366\264A\207\317\202!B\324\220*l\327D\225\025\331M|gP<"
+	.ascii	"\371\207Y\215\033d\350\374j\005\020\031 \003\3126\342gF\230\215"
+	.ascii	"W%\350\232\247\267\253\224\001"
+	.text
+	.section	.gnu.lto_gyroInitFilterNotch1.41.25da401d0df9f5bc,"e",@progbits
+	.string	"(\265/\375`\216\002]\024"
+	.string	"f\247\211I\260\226Q:4f(\313\366\006mS`\002\351\230\275\032,\207tCY\357\036F\356\277!\235?"
+	.string	"r\177\3547W\243\267\017\"\345\016\336\036\236\320>\343\246\242\204\020\332&v\027\201\007\302\225B\031\001\326~\2234\262\211\224)\005q"
+	.string	"j"
+	.string	"z"
+	.string	"G%\236xsN\005\227~\020^\272|G\261wNb\302K\253\332w\361\027\264'\rY\316I\002H\323\234\273\027\303\204\227\001\316\002^\352W\300K\323l\"\337\351f\252\004\216\333\322\2229gkQ\234\366o\225\346_\351"
+	.string	"F\\\355\037\210\357\227\200\267#\311\nW\364\261 \251\030\257t=\302\331TS\r\346\234\326\021\367\341\226\267=c;\202\255F\002\366\3537zR\242\346\2341~\215\333\360\361S\\Z\374\321\217\227\376\017x)4\2427\206 \322\236\275\253\351\236\260\377\3159\247\327\204\375\245[\345I7\353I\377\352\273_\005\252C\251NI5\370\251\345\247\376>\365\252ZU}\001)'!\004\224\314\211\324k2\241$\217\025_\272\375\030>\r\243\3702>\203\366%\240\260\346\241%\271\236\021\217B\315\002\037=\253\2509gL\217\323\270\004\221Sr\035\023^\323\356\ts"
+	.ascii	"\345f\2201\244H\231\370\333]\271\212\344&\342<\256\332o?'7'\333"
+	.ascii	"\207@\326\356V\310\025\2719\331\264\347\026\375\352\332\026."
+	.ascii	"\350G\326\272t\330\232W\253{\325~\031\344\236nOV\3641\336d\243"
+	.ascii	"Q\030\256\343\346Ew\231\3038.\375heb\001U\2645;g\347\200nN\242"
+	.ascii	"\217\0015<\256\231\b\003\203htt\304\331\006\031U\020\r\217k&"
+	.ascii	"\302Rv\301\314^\260\327\215\030\003\332i\311b\242\f\226#k\301"
+	.ascii	"^8>-WL\326\202)`QCN\2545\023\305X\013e7\377\3155\241\364\220"
+	.ascii	"\251\007\024\321\332>\003\372\323`\200*\0332\035\312&\345\351"
+	.ascii	"\006AT\020\0072\372\321\337\024\2615\333\020\016d&\374\021\356"
+	.ascii	"\342\216\264H\032\240\340\246\326\2260A?\252\2606\2657\342\201"
+	.ascii	"+\024) \220\202\221\2712\0175\023(4\364\275\004,\260\343\250"
+	.ascii	"\331[~\243\337\245\2074\360=\004\n!\304\270\030b\246\302&\366"
+	.ascii	"1\371;\340/\323b\267\310-/<\245\206ll)\267\267\005:R7\310'\364"
+	.ascii	"Z\303\022\205\257n.\333D?N\034\256;\211\215U\b\247\221\306-\200"
+	.ascii	")\202\313\363&\247hp\017"
+	.text
+	.section	.gnu.lto_gyroInitFilterNotch2.42.25da401d0df9f5bc,"e",@progbits
+	.string	"(\265/\375`\216\002e\024"
+	.string	"f\347\211I\260\226Q:4g\033\372f\346\243\\\214\305\230?\007^\243\340\377\001\206MC\271\375\216P\347\017\200\334\037\373\315\325\350\355\203H\271\203\267\207'\264\317\270\251(!\204\266\211\335E\340\2010\264QF\200\265\347$\215l\"eJ\001q"
+	.string	"k"
+	.string	"z"
+	.string	"I&\246\364\346\234\013.\r!\274\204\371\256b\363\244\314\204\227V\265\337\342.h\337\025Y\316Y\"\210\323\234\274\030\313\204\227\002\356\002^\352[\300K\323l$\347\351f\312\304\221[\223\2239gkS\234\366o\225\346\237\351"
+	.string	"F\\\355_\210\357\247\240\247\203\311\nw\364\271(\255\030\317tM\302\331TS\016\346\234\326\021\267t\313\333\256\261-\301V%\001\366\3537~V\240\346\2343~\215\333"
+	.ascii	"\362U\\Z\f\322\217\227~\020xID\242\311(\302H\243l^M\027\205\375"
+	.ascii	"o\3169\275'\3547\335,\337\335\254\357"
+	.string	"\376\325y\277\nT\207R\235\222j\360S\313O\375}\352U\265\252\372\003\002,\021)\220dN\245\250(\363I\356`\361\246\333\207\341\317\260\212\037\3432ho\022\nk\037^\002\271&H\275\n7\f|\374\254\240\346\2343=>\3432D.\311uPzN\273(\334\001\224\253!\206\221#\205\342ow\345\352\222\333\210\357\270j\277\375\244\334x\330^\004\262v\327B\256\310\215\207M\243\374\242_]\373\002\006\375\310Z\030\017[\363ju\257\332o\203\334\217\333\224\026=\214;\341(T\206\347\310\211\321]\342\260\216K?Zi(y:\332\232\275\323\203@7\247\321\3077>\256\231\b\003\207lxx\304\031\007\032\325\220\215\217k&\302Rv\311\314^\260W\216\030\023\352i\311b\242\f\266#k\301^:@-WL\326\2221`q\303N\2545\023\305XK\2057\377\315=\301\364\360\006\210'\243\265}\007\364\247\275"
+	.ascii	"Y6\244\361'\234\225!9\t\240\204<\240\321\217\376\346\210\255"
+	.ascii	"\331\216\360 5!\220p\027\027\365dG@\301M\255=\201\202~damj\217"
+	.ascii	"\324\003\227() \220\202\221\2712\0175\023(4\364\275\004,\260"
+	.ascii	"\343\250\331[~\243\337\245\2074\360=\004\n!\304\270\030b\246"
+	.ascii	"\302&\3661\371;\340/\323b\267\310-/<\245\206ll)\267\267\005:"
+	.ascii	"R7\310'\364Z\303\022\205\257n.\333D?N\034\256;\211\215U\b\247"
+	.ascii	"\221\306-\200)\202\313\363&\247hp\017"
+	.text
+	.section	.gnu.lto_gyroInitLowpassFilterLpf.43.25da401d0df9f5bc,"e",@progbits
+	.string	"(\265/\375`5\006\335%"
+	.string	"JC\370\016I\200\232U:[\314\221\263\fY~\260q>%\343\333\342<\002)\3726\367\333\377\331\373*/\336m\321\377\377\377\315#\327\272\256\265.>Q\311\377xt\206\263\0176&\226"
+	.string	"\324\231\032\371\375MY\263\231\255-i\204\220\275\223\f\326"
+	.string	"\313"
+	.string	"\342"
+	.ascii	"^9\267EUI?\307Z\236\201\344*\302\201*\351\347\330\346!\"\242"
+	.ascii	"\2668\301r\316\n\2566\021\233Jy\221\326\362\321\007\324\204'"
+	.ascii	"\227R:\024\341\255\345\243Q\371\314\271\005j\b\354\325\332\275"
+	.ascii	"mm\3154`\257\366\275\335w\236\211\322\2334\264e9\367\340\362"
+	.ascii	"\3149\003u\020{"
+	.string	"\365\347=\353\325\364\266\365jw7\003\007J=|\033\244F\f\331\224\021\005,\347\366\206\201|x\332L\306\306V5\305w\330\237-\211\247\275\250\343\263\bT\316$\262TI\263u\206\365`\312q\026\307{,9\031qL\306]w\226\306\364'\347L[&\257\372\254\027`\3322nU-m<\275:\216\217\310\265\007\n*d\2664\342\033\023\3129\367U.\231\3369\357n\253\356Vv\253X\002\352\226?\353\367\211x\341\034\n\n\005M1\023\313[\210x\341\364\217\247h\354hb\314\344\322@\235\206\355\253\314H\253\"\371IK/\3504W\013\332g\234r&\236Gww\232\253\314\t\256\346\340g}\204\226g\230\327\361\306\351n\211\0273\273\217\243\321h\233\306?\272\337\376=\247z\333\016\345\257\275\352\315s*\357\235K\371u\336\344\317\351\333\262?\337\261c\275\327\234\333*\355v:\273\215e\267\257\354\366\005"
+	.ascii	"\237`_\n\256r\256\021}\223\301\250XDN\365W\375T\376\347\217\245"
+	.ascii	"\324\237r\253W\371\225g5\r\213\367\234\\\222\321 \243\304\205"
+	.ascii	"\225_)\375"
+	.string	"\351K\263S\233\231\202B\2668Y\264\354m+\025 K\\b\255\220Z\001,\210\334\244r6\315\364\2027E~\036=8\307\252\r\230\343\215\3231\314\354\035\214q\f)/5\214q\254\b\307\2705\025\247x\243_1\263U7i\237\313\347\303\365\301\250(\026\246\f\230\352\346\366\313\370|\270B\030\025\3351NxF\254+\355\217!at$\303*\323\214u\335~\030\236\201 ]\302\350\250\203\2157<\2349\347\007WW<\243[\270\326p\200\033f\244\272\216\327M\267\211\023\003\270r.^\331\377\362;\272\\C\372\274\365\252\213\250\250\262\211\347\362\340\213\273\221p\367J\033\376Abb\327\360\305\275(\255\276zR\207\232\247\334M!\032\355r\314\271X\340\230\007\337*I#\306\3437EM%\275\2127\332:x\300\223\247\277Xw\016<Q#\265%E\211\361F\373Y\336B\027\n\005\205\n\273!\241\256\327\253"
+	.ascii	"\340\207\013\352rC@ \212\336\013\236N'\b\314%\371\204"
+	.string	"\036\204H;\\\222\017\367\033\002\020\274\260\356r(V\244\270\026\271`\217\307\323\26102\250\350\351T\\O\030L\203<\0350m\244\240`n\227;\342\375\204+n\300\037\017\270\303\001o\273\034\212\0267\244\037\360\026D\240y=\334\357\026\344\361~7Z\233\237f\374\243g@\234d\\\315\376\341\372\254\023\221\3412u\205\373\303U&\303\027\033\273\205\322\214\231\207\360%\206j\206\340\352\340\213U\334=<2D\222\f[1Lr\260\341\022\007*\226\320\214\016\231\f\2354\265\316<\305\327R\230\214\300\265\341\024w[\300p\257\354>\233\034\321\327h`\277zEAj\337\207%\020i\243l\332\320aB\220\2357\021Q\243l*v\375\250\005\363\362i~\215a\321\004m\250a(e\240b\312\314\210\314\210\3040Y\003P\0021\310\312l\003\021 9t\254D\232\224\0242\034G@\245\314\342\254\340L\375\347g\0261"
+	.string	"\356r3\032z`\242.\324J\3604\303\265P\250\226\034|%:\262_\017\273\031\nA\247\201\346]\034\250\374<4\006:lyGr\231\362\033~0+\317\b\2403\217\222 \366\357\310\264\241\026\376\274x0\333(\322\260\006\016e\254\357~\225\202\023\206\r\202\362\rS6e\022W\250\264\243L6O\025s\026gd/Y\234\0238$\243"
+	.ascii	"\267Yj\f.'\356wx\214i\372\256<\251\316aw\332C\265\360\260CD$"
+	.ascii	"\376\323!\n;\317\201|\307P\206V\2147(\033\243\373OE\255\247\332"
+	.ascii	"$8\316``pQ`\226\320\275c\223+\210\302WM+\346\247}\t\f$\247\024"
+	.ascii	"\307\302\026M\300T\330L\300\0020\223\226\211nT\177"
+	.text
+	.section	.gnu.lto_dynLpfFilterInit.44.25da401d0df9f5bc,"e",@progbits
+	.string	"(\265/\375`\332\002]\022"
+	.string	"\346\336pH\340\262(\035W\025t\022\016\302\252s\235\232=5\271\272\353}b\374\334\0052\034\202u'\f\216\266p0\022\250\262\266\267\203\224:<\305{,\226\247j\314\030B\020\216\303u\270`\303,\373bH\234\2650~Bb\345N)]"
+	.string	"V"
+	.string	"]"
+	.string	"\237\316\214\355\217\270e\013\275\346e\303\333\213\354\246\267\273\242\336\336:)\004\277\221\316\226\237@\3673\243\271NB\020\352\3000G\342\013M\034\334F\364\b\321\362\341#\f"
+	.string	"h1\220"
+	.string	"\314.&\203\252\211&\033\035\330\335\243\370\324@\203\315\031\232\354\256\347\214\326r\213\3346\007\333\013l\r\020E\266Wn3\256\230\032\356\354\202\274,\313\"5\t^'\330\360\210M!\266+\\\005I\332\215\225\370)Nc\301\227\371\347\013\254\371\331?\237\005\376\273~;\273\034\315k\226v\rl\252\315\276\226eIdu\261?\255sz~\372%\001\035\200\032\344\354n(\207,//\341"
+	.ascii	"\001\347\216\316\r\0230^\302\371\371\324v\024h\237\236\203\032"
+	.ascii	"\260cwK\374\031\307II\251\250\200\377\302\037<\275\241\327,\375"
+	.ascii	"\0267\365\360\\\223\310;\230]\314Hm~\f_\306gp[s\341\277x\001"
+	.ascii	"\360\237\fn\327\376\215m!\322\256\353 <g+;\201\333\332*`P\213"
+	.ascii	"\315>\221\260\244T\251\223q\305J\021\311\325H\252P\244\250J\241"
+	.ascii	"\254\210\247\025)\222\030\360H\001\265\022Y\306q%\216\324\274"
+	.ascii	"\256.~\340\201\367R\230U\355\b\327\221c\006Y\302\201H\236\252"
+	.ascii	"\210\210\240\034\215\332'\307\201R\362\201\240\313\231\371x\315"
+	.ascii	"r\264\273KR[\317m\240L5J\374\364\206B\323\340\361\351\261\b?"
+	.ascii	" \300\002\031\261\343\001\243\200/\035\002j\320\214[Eb\253\323"
+	.ascii	"kl\177\345F\023\274\202u\220\221\242D\242\t\356\205\360\320\321"
+	.ascii	"\345;.\223e\343F\370AK\246\020\37148\231\255\026?\032\264\203"
+	.ascii	"\214\220\214\031c\025\222\255!}~.\375\262\321\374\340\210C\323"
+	.ascii	"5\201\322*-\353\2236-\256\242,jA\261\333\366X\b\336\001_\203"
+	.ascii	"\211f\222K\"{\344p`\030xbb=\3105p\370,\357\326\274\334\032\233"
+	.ascii	"\260\312"
+	.text
+	.section	.gnu.lto_gyroInitFilters.45.25da401d0df9f5bc,"e",@progbits
+	.string	"(\265/\375`\216\003M\026"
+	.string	"\246(\216J\260\226Q:Z\242\243\371\b\210!@\330\3366\243Q\370\366\020\362NX\357ys\200\237={\370\203\254\262<j\263gy\274\374\361S\246\241\315\033jZ\232\243<\230p\366\260\373d\215B\r\233.\364W?\372\277\374vo)e\ns"
+	.string	"m"
+	.string	"\201"
+	.ascii	"\223\337\315g\346o\200\231\212\247\003\305ZA\024\247\252\023"
+	.ascii	"]:\261\345\356\277[t\327\227\305\022\221[v\030+\215\021\230\324"
+	.ascii	"t\244V\243\226\245\267\215Ke\013@\265\224\227\246Zz\3627\262"
+	.ascii	"FBu\223\224\200HLj\255\267&\261\344\316f\362\273\202a\005\205"
+	.ascii	"\276\235\"\266a\302\236\311Rk\335\242e\037\341\217y\005Sk=\007"
+	.ascii	"\205!\366t\377\307\374G\360\367\223\325\327\rt\235j\333\302\321"
+	.ascii	"\220\036n\362\337f_\350F\244mj\243H\324s{\244\263\t\325\332\363"
+	.ascii	"\362m\261.n\276&\226~\247\303\033\\\372\325Q-\255u\373 B,y\270"
+	.ascii	"\370\033\375\270\203\376\235\265\201\376\332\226{\225\311\247"
+	.ascii	"1\1776\371)\314\227M~\214\371\260\311Ga\376K\305wM~\213\362Y"
+	.ascii	"\223?2\177\325|\325\344S\312\237\001\003J\274\032\245]\026,\217"
+	.ascii	"\035\25760\242H,]\3753X\035\275\027T\216\311\024D\242\352\261"
+	.ascii	"[]\300\325\254n5\330&\231\021\007\253\351pj\325c\357OYt\260L"
+	.ascii	"\272\033\253\246C'\304\362\301.\325P5\353hITYc\356n\332-\373"
+	.ascii	"K\230\300\033<\013"
+	.string	"\260}\237M\273U&QX%\231\031\263\351P\t\261T\351\356\005>\251\2602f\306Z\353\313\027\306\306\240\251\301\341:B\222\331A\\k\034.\314\364z49\031v\030b\257\261\355\344pr3;\336\006\233[\217\267\353\341\340z7\234\034\315\315\255\206\327\273\331V\276\313\301\361n;\273\035\357\3462\342\331\006\372\376\220R\352m\rR\037\270\326*\355\003a\310\211\247\177'\200\202\034\246\020\300?9D\022y\203\237\3758\375\332\367\025NiZ\377\344\212Y\323\210V\b\324L\326)\355B\026m\020 \262\250\025F\351X\377\t\024xh\337a\035\213\331\036O\260\016C\2501<D\2412\210d2\nR\232\346\260\002\031\261\272\r\0200\306\304\206J\036\205EC\034F*\211BE0\263\222m\346\023\301\262\007*\365\314\372\3760\215\037\031\231\035K\345\007HE\367\216\324\203\262\367I\262\355k\331\272\354^\fO\332"
+	.ascii	"V\t\266g\016\035\217\365^)9\373\275\223\300\236\307\336\345h"
+	.ascii	"\204\004\352\322)0A\300\320\311HN\007\306\323/\302\217\215\242"
+	.ascii	"\245\215LP\271\t\202\rLQ\266s\200\002~ \211\213\002\307m\366"
+	.ascii	"?"
+	.text
+	.section	.gnu.lto_gyroInitSensor.47.25da401d0df9f5bc,"e",@progbits
+	.string	"(\265/\375`c\005m\034"
+	.string	"f/\250H\260\230M:r\355=\022\f\220X\232"
+	.string	"\273,a\203G\024:\255\037\032O[p\357=\005\374\351\360\260\272F[\263\263\357\300\226H\371\361d\320)\314tB\340-\274\276|E\371\2073\225\006\353N\242\"\333\244\221M\344N)\213"
+	.string	"\213"
+	.string	"\236"
+	.ascii	"\323\340N"
+	.string	"/8=w\372\005^\344C\214\027\fM\265\306\370\221\251TtI\017\333\037m\317\236\013\002\001\352n\211\006\204O\373IW\"\317{\361\232Z\203\222@\325\332s`\231x\352\336c\341\251x\001\341\251I\333\352\275\241\372#Cv\230\304\324Zg\233\343\344C\n\356$\375\te\252\344\301=l\242\224i\251\nx\"W0ck\351\n\022\236\236\357N\027\306\210\242v\300xtv\272$\324Z=K\036\031\267\353\266i\266#\330\224(\340\332\032\016\305A\t8\245\304\332\005\367;er\035\376\344$\302\203\350\"<\335\035\201XA\232k\1778\022\026\005\206l\020?\022B\254\265>0Rb\004\r\026\036/\302Sp\253\304\312\335@\370\235\373\235&:\2238\223\t\261\326\335\003\177\351El|\036\247\276\301\231/q\302\323/\n\034A>J\274\334\374\331=\335\\!\373\373\373\375|\336 \373\275\277\346\274\237f\234\006"
+	.string	"\233\036_\3230q\372\265\323\342N\273\\\323a8Mi\033\352\023,IG\365\2476\030\177tf\231\033\277\"\201\026t\031"
+	.ascii	"`_;+\037O6\256\307\237\335\342\204\316\205\314\261e\\p\013\024"
+	.ascii	"\036L\307\265\220;\262\320\250\022\253\301|\365 \177\314\227"
+	.ascii	"\260M\260\253\252\311\206\2548\275\366GOMe\217X\364*\244\021"
+	.ascii	"\025\255 \247\232\022w\246H\225\217\347Z\233D\372\024R\210\024"
+	.ascii	"\245G!\207\270v\314\252B\342!\230t\303\265'P\230/\235@gq\366"
+	.ascii	"\235\250\330U\270\224\205SY\270/{\232\334fi_8\223\f\227\032Z"
+	.ascii	"\362'\2720\247\251\262'89'h5\233\260\003\3146\262\0259\264\034"
+	.ascii	"\0225[\013\234\331\315V\273\321nn3Z\216\t\0243\033\333m&C\340"
+	.ascii	"Z\212\033\333lE\255f\233\215\275\334\301\272A\246E>|W\271\325"
+	.ascii	"\201\265\326\032\256\220\316a\3544yy\354\007\365n\352\264\230"
+	.ascii	"\302<v\003\312w\005\256\320I\243\320&m\314J\032\035\370\305f"
+	.ascii	"\262\266\216\262\376\345\002\222\250ps\353DQDRk2\337\262\025"
+	.ascii	"\003 >5hj\304\334\3671\257\031%Y\327:\230\223@$Px\372t\225tT"
+	.ascii	"\253},\327\212\273\217\030v\250QL\244\2244TC\013\212\nRh\f\260"
+	.ascii	"\002\2211\353\034\021`-CJ\225\b-((\024:\274\205\302\256Y\215"
+	.ascii	"\267 \226\271\276\244\267H\211\317\374K\271\327{\223;\222PX\205"
+	.ascii	"i\342s\225\376\351\301\200\276I6\370\231\313\233\361\005\001"
+	.ascii	"Ex\372\236\024\355\006\223w<c\245mN\006\310\031\031e\034\032"
+	.ascii	"\254\273\200\306bON\252\b\032\357\351\230\025\363\342\254E\303"
+	.ascii	"c\016\005\203\006\f\322S\317R=\177\013Z$\212<\033\320\370\304"
+	.ascii	"\024\"=\260L\267\310\002\261\226\207\210\333\004G\004\340Il\031"
+	.ascii	"\221\213;)\357\223pE\305\tk\200\341Yl\213\252\323\\\007\202\027"
+	.ascii	"\372\225\311\350\303-j$\371\256=K\036\341\356\033\004\260\311"
+	.ascii	"<4B\373\347SIH}\320]\255\254+\210\b\200\253\300\3760fL4\350E"
+	.ascii	"\036\257\316\005\3211\375\017"
+	.text
+	.section	.gnu.lto_gyroDetect.48.25da401d0df9f5bc,"e",@progbits
+	.string	"(\265/\375`\331"
+	.string	"U\f"
+	.string	"\306\327VC\020q\233\016|#\303\270dM"
+	.string	"w\204\346\351\n\327>\263\244W\"i\370\236\007\022\030\317\244\325q\242'\324>N5\266\232\246\265_\307\"*"
+	.string	"\n\226^\004"
+	.string	"\006\256\032\006\264\203\177\377ijB\266\334)\005D"
+	.string	"D"
+	.string	"?"
+	.ascii	",\035.\254p\331\235W\201\017\240>\305\013\240>\351\207"
+	.string	"o\217\n7\377\337c\t\036.:\217{\334p\215\037,^V4^(\006 aA\305\277C\221g\002a\225`w\r;O\303=\3356\003\333\b\354+\b(.7\032\264\354b\350\261cK\023\f\021'\3756\310\377\214\361I\233\305e\260Z\210Nl\354N\003\237\374aAh\037\305S\200>)|\263;\212\361bw\0360\307\372\344i\331\366O|\005\344-N\025\017\023\025\324$\002\200\277\beg\021\340;gfp0\213\n\b\024\325\024\277\204\272\312\257F\b\276\230\202Qm\t$\360\335U#\003G)\244\234=9\250)\366\343\352\310>\351\256>\377\250\320\267\256#\230\354\220\204\310\316\202\314\004,D\r\302\031\361|<\0162Y\362\340\322d\246}0\355\372x:\"\027\210\324.\016\001g\0200y\215d\231\2740s\037WG>\215\226\020\272\371F\335D\016\017\320\337\250JE\266+\325\234\214(\005\020"
+	.ascii	"A\023\360\304\320\\\242\360\033\336\033\251\266\254R^\\{.\344"
+	.ascii	"b\233\225\244\331\315\t\305|\352\034\264\013H\t\264\352\246)"
+	.ascii	"\205\202\002"
+	.text
+	.section	.gnu.lto_gyroDetectSensor.49.25da401d0df9f5bc,"e",@progbits
+	.string	"(\265/\375`\005\001\025\r"
+	.string	"v\030YC\020q\233\016\250@\004\3604\315E\224u\241\366\311\2561\211\262\264\037\333\320\335\017\fMI\263\326\026\361\375?\304\343<qQ\202\246\335\355\035\200\342\214p\274\037]\0031*"
+	.string	"\027\274\205\242\211M\215\266\225;\245B"
+	.string	"F"
+	.string	"E"
+	.string	"\004vQ1\\\354\316\006\316\\\227\2367P]^/P]\332\266\203\007!\213>ML\226IF)\325\262;3\035q\321\243\310\177\352\025JDX\276\323\350\321\322\354\256\343w\372p\353m+\260M\301~)\326\301[^\345\2172\372\327\301\223\020$(3\264\306\\Sxci\310\027(\007\177;\344\247\214\361Q|%t\020\204\221\346\236>aK\312\202Kk\256K\354\242\323\343\300\200%\255\220\210\020\243\375\224\237\b]\345\343\001\326\336\242\203\300\204\205\200\223\214\200&F0\361jk\350\210\377\244b$\035\331_\321\201\301gsW\301\341\332]\b)<x\022l\234\\\372\037\325\345\365%\302\360\003\001\022C{\216\242\212\260\177\331\335\265\242lG\007Z\267\001a\3506\023"
+	.string	"t\266\f\036\216SY\3400'\363\331<\333\005\256\363\350d^\307y\036\315\313<\333\246#\343t^\226I`n\203\326e\037\216\3532\314\334_VQ\226b \032b\037TI\2654@\211\bK\tFH\f-\325\001\030"
+	.ascii	"5\203y\036+L\3232\366b\2646\366\033A\301\fX\f\216(\202\312&D"
+	.ascii	"\343y)\3064\004\324\016v\315\026\232\200\360\260v\b\tW\230@."
+	.ascii	"(\f\206%@E4]\363\t"
+	.text
+	.section	.gnu.lto_gyroPreInit.51.25da401d0df9f5bc,"e",@progbits
+	.string	"(\265/\375 \306u\005"
+	.string	"\362\311%/pU\323\001"
+	.string	"\345\276\023\270@\351\334\347\367X\225\207\370}\216\021\007\tR\302!\247~\203\031\t!"
+	.string	"p\001qK\331\f\352?!\262ho\231\002\236\244\253\262*\307\244\024\210\254tV\213\252\322\252\036\0229\321*\245\204\347\204\242\362\232\223\312\350\3136v\212,j\366\247\301\230\261w\360\377\216\235\r\017\033\020\267[\350\277\024\020<\200"
+	.string	"\300\261\275\2211[`?\357\210\216g\371\f\374\227Q\263\330B\314\273\2365l\\ea\241\361\337p\3430\353\270\266\027\266\031\266#\001\007"
+	.ascii	"3\003\316\2311\340\313\3552\376e\\p\351\026\355|\002"
+	.text
+	.section	.gnu.lto_gyroInit.52.25da401d0df9f5bc,"e",@progbits
+	.string	"(\265/\375`&\032\325g"
+	.ascii	"j\242h$O0\216\332\032\003O\262\t\377B\300\2114L\201\357\350\332"
+	.ascii	"\337\200w\260\227\023\207\002\b)\b\\\007(\306\263\330\tD\257"
+	.ascii	"\310t\356>\324\246\250g\222\303u~\221\3308\241\363\370Bh\343"
+	.ascii	"\361\207#\210\364\246q\260 /\330\007\352\342\244r\313\224R\n"
+	.ascii	"#\002\030\002<\002\316\037\330\331\210\235=\260s\007\326\231"
+	.ascii	"C\321\271\210\235\211X\347!v\026b\235\203Xg \326y\003\321\371"
+	.ascii	"\247\350\354St\356!:\363\260\316;Dg\035\242s\016\321\031\207"
+	.ascii	"\350|\303:\333\260\316\032Zg$\321\271\246u\316\300\316G\242\263"
+	.ascii	"\261u\246a\347\231\241s\313:\017Yg\226u~\326\331Y\347\346\340"
+	.ascii	"G\3122O-\214\354\367\316\336\254k\231\367n(\007\326\323nj;s\367"
+	.ascii	"\\\347\220>\334\220@\247>~N\026\241\317\370\267\252S\350\364"
+	.ascii	"}_#\313L\002wY\233\261\221\252$\376\310\202R@\261\207=u\211\254"
+	.ascii	"\316\336\254\366\307\323:]\352!;\025{\310OP$\260\333g\322\254"
+	.ascii	"\234\2601\346\332\230\367=K\276\220v\233D\024\324\b\021O!@$\235"
+	.ascii	"\232\230\226\224\222\220\216>\030y\350\300\241\210hH(\bh\303"
+	.ascii	"\217O\017\317\216N\016\316\215\215\006dM\206\243\221f\246Hl\207"
+	.ascii	"\354\273\313m\325$\374\257\243\240\374z\004\213\363t\323\353"
+	.ascii	",Z"
+	.string	"},\223\236\030\027\237\213\360\322O^\272x\b.\r\302\332I;\253;\331\325y\023\027:g\302\322KX\256\270\222\225N\252\322HU\374h\256\352\037\330$\025\254\254\316\242e\205\325 %\003\006\316\215\336\332\303\0237\357\300}\365\326\034\220\313\035s\323A\257\032O\272\310\205\026\234\310\005'>d\326BA\304\001\274jP\033\250l\352\033\314~\314\222h\261\340>d=dc\316\223D\213\211\357\200\035q\035#\235c\244\210\343t\026-\"\177~\363\3256_C\\\303\027\262\313\254\213\222hI\275\246\310\253\006\2643\360\360c\026-(K\364\276\257\221U\372\022\007Cg\321\322\301\352d\035iv\022\255\035N\3634\276L\311f\332\254\021\370A\303\311t\320\253\006W\027\237\316V\347K\n\221\366\322\342zb\216n\207%\030\267\260\234\245\331\312\321\317*A\261\330\250\331\212\301\352\340\375\340k\263v\031[Kw\342"
+	.string	"\357\373\2627\267j4\003\320\314oef\f\230w\334\002\322\367\275\352&\263\033\346\\\256XG\221\366\360\311\256\n\356\022\357\346\314\267`\017\254\267\342(ecB\216\037\345\240\366\304\f5\255K\267\2625\361'\236\235\351\\\372\325\235\nV\026\230qJ\233\370\267j\273\266dn\303e\222\302\2575\001\207\337~3\013\3352\337\322\032~\357p\026\016R\331gv\315\234\206\362\3503|K\023\220"
+	.string	"\227\341M\366\333\206\263\220\214\312\006\270\t(\216\254\3164\361%\234\204d\324\003Z\366\245\3078 \001\005\024h{H\264j\323\002\235n\351vBB\232\217\3425\263\003n\345\372\3338\2340\214\t\004l\244<)3\377\205\312\032B\344\222F[\023p\257W$\271\263r\302\376\222\362\025\245\030\303\\"
+	.ascii	"a\270\007\331\257\007\006\347\223\030\366\353\371[\n\323\201"
+	.ascii	"-\310~=\202s:;]\220\274=\336$0s9\177\354\327\323\347\264\351"
+	.ascii	"c\277\036\2769\244\027g\333A\255\225\233\013\373\365\370\315"
+	.ascii	"\275\257UC\277\203Z\022z\274aU\220\274/s\3531\263_7\224\375\212"
+	.ascii	"\322W\353={\223\330W\207\0272w^kQr\027\341\005\030`\240\355\341"
+	.ascii	"\277\003lw\3202g7\320w\256\335\f\032\333\030t\032\330n\313\354"
+	.ascii	"@cq\217W\364\306\364\224f\206\240\253(\217s/\234zc\201\202D\226"
+	.ascii	"\022E\313X\340\225_\333nY\346\244%\306A\261c@\300\037\325\241"
+	.ascii	"?\23051\036'\210\347d\331V\266\314'\332MYc}\3377\212\373I\273"
+	.ascii	" \001\005\025T\320\366\260\312Y7\026\330G\232\320+\377\321n\024"
+	.ascii	"\255\277\2124.1\234\f3[\320m(\212\357\033#\212{\255\331Rp\027"
+	.ascii	"\351!\257\220\362n\366\220[\252\355\241\177\233\265Q\334\032"
+	.ascii	"\037\264\214z\345W\346\263\245\177\224\271\377z\275\206\341\007"
+	.ascii	"\302\314:\247`\235O4\265\331\304\3219\352\350\f\305\316#D<\365"
+	.ascii	"\2649\204\321\031\204\3219I\343\3544\343\334\304:3\3158/\261"
+	.ascii	"\316JE\347$vFb\235\2178\r\370\027\367O\350\215xp\201\3202j\224"
+	.ascii	"w\023\357k\302\347\205\213\013v\264Z]1!\353\336\r7\207w\223\217"
+	.ascii	"lL\316\006\277\360\224\033V\352>|\224\347\230U\017\034\236^\304"
+	.ascii	"\313\340\240W\221Fwme\013\364A\377}%@\227~\315\313\002\364\037"
+	.ascii	"\007\307\347\303\350\316n'm\307\225NY\203\345\305so\013\034\017"
+	.ascii	"-\036>\312\033\276\312\212\262Xe\303O\360\324#\243\372W\037\024"
+	.ascii	"\253\016\335|B\322\246\034~\250\274?\217\\\356\260c\33282a\253"
+	.ascii	"\253\350\243\354\363=\177\f\022\305\325\341l\326\027\334\256"
+	.ascii	".\264\312\271b\035h\215\363yg\343B}z\325\325\321uRvy8\234\333"
+	.ascii	"\325S\336\\\261vs\353\3716kv\t\032\234\224\210\365\t\021(FeV"
+	.ascii	"\205\330\237\020\377\3642\230\231\347U \237\347Gxn\031\332\371"
+	.ascii	"'-Hi\002\266)\213l;\337P\236u\203\324+\241\217\252\245\321\005"
+	.ascii	"}\024M\231c=\013\341\211e,\360\212\251\204\345x\003\322y\252"
+	.ascii	"\264.:\177\263\344\2722\235\313,`\\\033>\352\324"
+	.string	"\316I\322\310\317\341&]\344\236?~\203I\2539\271\262\345\203\324\342\274\007I\343\362\243\221\217\363\3047\346\022ko\205\036\233\377\255\267%i%\310\200\353\343)\353\233o2i]\276\221Z\344\337|\327=\247,\367\332Zn\347\243\334\201bRf5\247\361\372\0021\036\314*N\323u\210\227\021\244m\246\312\"\023\233\177\2747$\3202\035\rO\246\024\222\276\357;\206|\r\317\263|^\231\205-%\363\005J\316q\017\rL^\017\034\254F\256\200|\037\267*\316+\277\336\324(\361Fj3|MX\206\017\341\3116h\303\346\370S(\344Y\2459X\032s\223\0371B\304\207\177\r9J5|\324qt{#A\272\211]k\214\037\355& RK\363\306o\246\215\245_\331\213\346Cx\252\2219\277\240XR\310\360Q\272\236\371)\024\314\360\302\3449y\253y\0177\372k\326Vcf\362.W\b\321\211\221%"
+	.string	"=d\347\341Pw\210K\3045\342\335t\215\264=\3543\327\341\202\005\020\254\201\023\bR\027d\360\242\307E\212\025\020LE"
+	.ascii	"\303x\201\024\025\213\017:\220z@\312\003\026T\022p0E\365BJ\n"
+	.ascii	"\207W8y\300\302\005\013\024ST\"d\220\204A5\005\303\205\024\214"
+	.ascii	"\244\013\026)8H\256\240\202\221t\032\342\251\027RTI\017\246\246"
+	.ascii	"\250\222\306\263\253f\337\007\302\033\2500\244\255\032\325x\335"
+	.ascii	"f],#\306\325V\275i\272\0361\342y\200\253_\262\357\373\276$>\032"
+	.ascii	"\365\321)]en\004\256\352X`\025a+\245\212\360\243\200\300\005"
+	.ascii	"7\006\211\326\021(\020\202/\027'(\346\253 \276\345\270\336\006"
+	.ascii	"\251\311g\256\032\374\267*\302\032\267\247\253\212\341\237T\021"
+	.ascii	"~\013\256\227\333U,\322\303\344\033\031\365\212o\rJ\230\021\037"
+	.ascii	"\345\026\255S[\0136\247/\301\3456(\342\243\254\326B(\315\355"
+	.ascii	"J6q\305\214\320\314Z\324Pk\362\244\177MS\256\3260\331"
+	.string	"B\306\325\344\217\271]G\277\304\025\013Z\241\351{\312\305F\306/<1\275\212W\242,\2121}\t\256\265A\352\207\265"
+	.ascii	"B\342v5\201\271bC\322?R"
+	.string	"u\375\"-\216V\"\306<i\265\211c\311\352\207p\365\370R_[~\020\2566E\335.# \256\030\317\217\245o%\\jd!\222f4\234\230:J\311G\217\244Wz(\017\267K\200\035\257#\251\314 \322?\337\031\365H ^\210\0232#y\3648\376\306\333\370\024\216H\334\375)q\372\360[\257\365\341\215x\325;\264\247\2016\343Q\370f\330\237\360&\330\335a5\031\275\n\017\337\341\215R\274\207o\246\334\322\257)\276\303\177\037S\356\261\224\037#\305\227x\212!\243^y1\005\340\314.\323=\241\235\354Q\271[\376\241\325\355-\211\370\267\252\022\361R\372(;\322R\267\033\033\223\272#\246\206\342\360\314\314\364VJ )\373\365_W\306\f7+\253-z\016?\334\302,$tut[\031\267K\200\030\\1(2E\337\356x\376\221Q\211~\214[c\0253\\k\002B=\321w\233\364Q\226\317\240"
+	.string	"a\"=\220!w\313\005\225\255'\rt\273\272N\032\006p\350[o\b\365\312\257\275\324\354\003;\022\372\243^Z\227\202\032\250\342\3700\221\202\226AC\"\"\222$)\244\003\242\013\020\210\002a\024k\353\001\022\340\242Y\f\210A\350\214N\222\f\007\276\226\203\"\t\310O\345\020\\\2449\356\254\313v\325L[xM\013\0335s\263V\331\336\206v\021>\305I\265\032\252"
+	.string	"\256\207r\030\256\275U\345\337\244\021<\342\233\237\004\370\256\206t\364\323\257&.\260\303K\350\020\013\360\201\202\206!\220r\266#\231\362\337R\037\267L\345\312\214TEvb\314\201r\222\233\205\334|\034h\345\332\0343]dV\344\020\235Y\300\202\245T\303\013\322c\323J\320\313\226\260\200\023{$\3104\353\202\201\2129V\277o\345v\307\300xN3\212M\355|0\356,f\275\214\253\255\350\225;\230\245\363-X,\215+D2\255\027\344\250\377\302\034\f\335p\207$\364\242\203\202\330"
+	.string	"\325.\315\222\336E\272\355P\350J\354\032\325\036\242Z\212\221\213\r\027\232E\271V,\320\276"
+	.string	"\322\216@\016\003q\034xN\343\n\b \202t>\357\271w*"
+	.string	"$P\345\304j8\304\314rA\3441F\356V2\312\214\302$^L\314\0264@V\242\224\272\300\f\025\241@\316\003\212\217+TQ\277!\177[\306\315j\212}\037 \22582+\f.\016\035\003\221\266\341F\234K\026\3072R\341\241\263\032c\200H\005\236N\376\276\023\252\026#\364B\362\336\306\363I=\363)W\023\002\344\202*C\342\035"
+	.ascii	"<V\300\362\373=\350Hx\243pw\371\252~n\311EU\276-\317\262U\256"
+	.ascii	"\335\310\227P_\240\253\214b\b\001\027\003^\210&U\326\377\245"
+	.ascii	"\312'\345\2375+\230@\242\211\372\263<\b\267\034\267\377\352s"
+	.ascii	"\253&\357\323\246M\020\371\235k\r6\2405i\273\253\261\r\240`\021"
+	.ascii	"K\304?q\007\2723^\341O~Y\r\322 z\227\317\346[d-\324U\2632to\314"
+	.ascii	"\300\2007\307\nz\242\033\177\321#\nD\030\200\324;\224t\254W\025"
+	.ascii	"\256\271\323\372yI\242\254\277-\375\357\373\2060\306\370w\027"
+	.ascii	"\340\311\310l\243\312#\tu&\327P\316B=\022\260\226\260\031\004"
+	.ascii	"\351\357q\320"
+	.string	"\226\264\0133\034\177\230\374\334\035\270\253\007\261<\251\021\240@\003\na\216@\356\342\256\250\0269}\305wA\265\351I\n\257,\337\002$T\322D\212\252f0\333[}C\340\312g)TU\215\00431\325\241\352\332\231\320\023\252\210W\373p\213J%u\310txi|J\023\342\2759lH\360#\231\347\341\321\032\333\001\260\311\001\227\357o\337L\023 ]S\300D\363q\337\2109\376\335\234OP\004\310\231\340\351\240 \340\215\013\341t\205\347\003q-:b\202\227F\376Rh5\271k>cs1\356\377\003@\226m\212\202\343\001\351\215/\372Y\306r\307\216\033g\325H\342Rkh\201wF|=\026f\247VE\310W\306\314\365\"w\314p5K\210\235\236\234R\201\344\366UhaS\3545\223\336.qo8\365\001'\241\304+\347D7\325\205\310\253\2228#\252<\t1\376Y\033#\311A.\234\373P\024"
+	.ascii	"\362@\201b6E\024R\\\025F\016\206^\211\235\n\254zR\251X\036\273"
+	.ascii	"\f\221\323\371\274w\316G\236%\n\361\213^S\221;W\212a:\221C\t"
+	.ascii	"\004\216PaTG\245{]\017<W\022\353\371\255\233\322\272\256\004"
+	.ascii	"\027\021\037\022F\253\214\202G\312Y&z\343\357Xn-\t\212\247Z\335"
+	.ascii	"\177|\220\205:u\340\t\n>\031\027 \2235\205_\205'Z\007\t\017\310"
+	.ascii	"\200\203\314\257\245N\276L\263\203t\024(u\\\034`f\250\344\201"
+	.ascii	"\220\034m\367f[\336R$\361\362\254\226\353\267[j\210\n\207"
+	.text
+	.section	.gnu.lto_getGyroDetectionFlags.53.25da401d0df9f5bc,"e",@progbits
+	.string	"(\265/\375 \372\345\006"
+	.string	"B\21504`m\322\001\300\216\fE\"\203M\3253\273\376^\2140\206\016\206\f\003\2324\324{\230v7\356\202g\206!\bi\"\344\266\363\244\367\017\242\0216\262\211\224)\005\276X2TE-\300\250ixV\204V\205\261^E18\274K\264\236\205\300\360\001\023_\006\302\370(\333^A\251\025L=\366;\276]\276\310\232M>\273\3637\323]*\300\004\226#{\353\244V\330\227VA\266\323\251\001\027!\332C\"\273\022\243\222\005q\037\030\26696\305\327\370\006\307\227\002\004\3669\310\020Ex\220\354n\257\362\201\351N\272\300t\247\026\277\236\227\177\216'xB#\231\326yN\020v\327\231i\237[o\273\300\266\201m\212\b"
+	.ascii	"2\003\316:#h\b\3055\2617\"g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_gyroSetTargetLooptime.54.25da401d0df9f5bc,"e",@progbits
+	.string	"(\265/\375`\311\001\305\017"
+	.string	"6\236hE"
+	.string	"\261&\035\240\234\316+\376\240\213\250\347Xx\327\314\256\335\034\226\340\320\2069\031\365\271B\030\337a\2435cV@ \315\232\246f\274\253\241\253J"
+	.string	"\302\n\212\2217"
+	.string	"o\275\2305\252\365u\267&\215\354-eJ\001S"
+	.string	"P"
+	.string	"W"
+	.string	" \333\231v\002\005\252\277\220Xw3\310\240\330}!\360({\264\312\216\361W\207\025\360\301\305$\306\306\356j\312\341\252G\250\251\362;\037\036\327\267z\314P\016?\037\312U\364\225\300\002\273{\020\317\n_+\263\363\261\273N\327wrc\267\355\300\266\207\235\013\002\fRj\\B\210\324\027\361\027\211\317\342\t]\336\365\350w\330#*\205\346\006\006V\346\330\257U\352\006\373pU\305\376\313/\212\351\020L\203`\372\003\323\236Lg1\215\301t\204i\230i\325\364;"
+	.ascii	"\264\274\370\276\262b\327BN\216\265\211*<\330~\003`Vj\230\340"
+	.ascii	"`j\223n\242$bQ\342\256\031Q1U\030^\rT\2478\215\223\335\365\201"
+	.ascii	"\222]\226\201\250\367fZ\231cU\250\220\306\273\271\252\006\320"
+	.ascii	"\260\"\303\004'ww\245\336\260+\004\230\026%\211\303\266\310I"
+	.ascii	"l\331\356z\370#\016#\301gy\264\211\343\260\307k&\356Tj\020aC"
+	.ascii	"e&\215F\266\323\006\302\245(\210h]\212\353N\245N;m!&\215\224"
+	.ascii	"\352\264\021\001s\250RJ\033\341\270\224\006z\355\341\252\212"
+	.ascii	"3\027\027lX\332\202\261#\355\007 y\227UW\013Cj\207\374\204\f"
+	.ascii	"HC\037\005i'\306\233\361\350G\357\265d\352\321{7\231\006# \200"
+	.ascii	"\002!I\263\003\323C\243I1\\\f\373\016c\201\333Gq~\315\210o\177"
+	.ascii	"\364\032\213\004!&\231wf\226#_\261\bq\027+\3432w/D\3542<B\037"
+	.ascii	"\225\214\270\334\021\3369}\313\355\363\207\017\023\341\250\316"
+	.ascii	"\344\320%\r\330\236<~zk_\031"
+	.text
+	.section	.gnu.lto_gyroSensorBus.55.25da401d0df9f5bc,"e",@progbits
+	.string	"(\265/\375`\341"
+	.string	"M\f"
+	.string	"\306VSB\020\221\232\016\030\034\001\324;\271#\205\226\276\341\367\016\371\202S\336\372\016\371"
+	.string	"\016@\256\326\323A#\210\265\341\210\206\345Y#\347\330\266\270\001"
+	.string	"\224\013<C\251\347\257"
+	.string	"\f8\321\271|w\363mo)S\n>"
+	.string	"?"
+	.string	"B"
+	.ascii	"\273\336d\357\035"
+	.string	"\3511s\001\322\243v\270\350PS\344\337\345\fF\335\267q'\207*Wh C\f\225\r7\202\035\030\0166\356\362L\341P2\001,\330]\347\306]\270\343m7\260\355a\337A\371\355\321/\221\036\257\235\230\021Z~\266w\222\312b\037\256\256\330NCMg\246\037\003\200\250\300\275\303\261k\341\333\2612\342\013\017\266Ml\215\037\342\"L,R\n\022\264\r\007>\260\230\360\222##\373)<\233\315\376\034\205\310a\3240\365\227\007'\"To\321\322e\322#\324\323\3300h\371A\250,\231.n\300h\320\217HW\235a\"\006%u\330\266^b$\263\273\b|\022\3670\277{t\250$\366|\220P \n\304\2722\221\t\273,\f\364\301&\020\025RM\236\013\233>\006\330\202\360\271&\022\313\272&\215\267\207\253+\346l\352\257\310\022\200\204*\005\234-}\025Y\201\226]-$Ty\244\246\330\206J@\323\026"
+	.ascii	"5\013=\205\340\001!>3!e\t\24520\325:\214\323\rK\220\211Z\177"
+	.ascii	"\\]\004\305E\221'\242\264\b\320x\b\3205\274\035\213\367\207 "
+	.ascii	"\307]\261\252\321)\232\332\003"
+	.text
+	.section	.gnu.lto_gyroMpuDetectionResult.56.25da401d0df9f5bc,"e",@progbits
+	.string	"(\265/\375`\341"
+	.string	"e\f"
+	.string	"\306\026TC\020q\233\016\030\242\bP\022y\034D\341\342\260\210\362.\270\020\r\253\313\217\240\204@\216,\312P\305\267\360\377(\242E\207E\311\b2/\370"
+	.string	""
+	.string	"\344\006\3170\252\022wB>"
+	.string	"\242\341\246\373}\333[\312\224\002?"
+	.string	"?"
+	.string	"C"
+	.string	"\273_\345\357\034\352\021s\001\324\243j8\351P\223\344\237\345\fJ+3:o\344\320\344\n\r`pa\242\361J\220\343rR\343,\317\022\217$\023\300\202\335uv\236\205;\336v\003\333\035\373\016\002\371\356\321\017\241\036\257\234\027\020\\\236\354o$5\305>\\E\261\235\206\232\316L?\006\350`\362\276\362b\267\302)\307\302\210+6\330\026\2613\276\207\177\0201I)H\340N\016ph1\241\345F%\373&@\232\316\016\275\204\307Y\320\260\365\226\007$\"\\O\241b\332\250G\250\227\321]\340\362\004\241\246d\252\260\341\222A\377A]5\306\210\027\222\304a\033\273\210\017\314\356\"\360C\374\323|\323\243G!\001\006y@,\221\365\301\262\315\243\3222L\023\205\264Jdu\\\025(\323*\317"
+	.string	"c\020BY\005\202aY\225\371\366p\025\305\233N}\024[\202\317\350R\260\351\322?\261\025P\331\345:FW'\265\3046T\002\234\006\026"
+	.ascii	"5\013=\205\340\001!>3!e\t\24520\325:\214\323\rK\220\211Z\177"
+	.ascii	"\\]\004\305E\221'\242\264\b\320x\b\3205\274\035\213\367\207 "
+	.ascii	"\307]\261\252\321)\232\332\003"
+	.text
+	.section	.gnu.lto_gyroRateDps.57.25da401d0df9f5bc,"e",@progbits
+	.string	"(\265/\375`~\001\235\017"
+	.string	"\006\036iF\340\262(\035\222E\r\301(\217\225\201\336\376S5\226\323\242N2\347\361\262\374\377\004\022\f\207\002\250@\263o\365\275q\023\3118\235\330\362\353\245i\030A\f\243\303x\274\023?\n\006&\207\241\214ce\253do)S\nV"
+	.string	"N"
+	.string	"X"
+	.ascii	"\253\300\243\317c\b\332\366S\\\205\312+\004\032Z,\221\211\034"
+	.ascii	")4\037\273\313\r\370\310\366\230'\260=\252\210\257\0165W\376"
+	.ascii	"c\376\300\365R\203\305X\207+W\230\300\303\215\025\0011\027\034"
+	.ascii	"\301\t\261\363\230\247J\354\225\t\300\301\356:a\261\016w\274"
+	.ascii	"m\b\266\027\330\357\021.\217"
+	.string	"\356N\362\260G\377d{\274\212F\334\264\262\307\236\261R[\354\303U\026\203>\373?[z\213\351\250i\250i\205\351\324\364\003\210\240\250\211\375ef\227C\017\220\325\021oH\330V\331!\2663\355\303|\205\3523\3230h\027\304\t\031\273\001P\355\t\024\266\303\242\206^\312\262\352\025\352wl\260\341\252\360\030\256\235'\307%\207A\372\324x\245\357\310\\>=\017\204\332\222i\303\003\347\203\376\264\245\212\224\220\321y\345\017\333\246\2778}\\\244r:0v\352-\\\023\311v\267\201\215:\315\202\201\234\335e s\026&~\037\n\003\t\2724BA\245P%\235\227\341\304}^\367\245L\037\227B\221L\270\222\367q\243\003\356.\230<\016\245\353<.d\266\207\253,&\241Q\177\306\367\032\021\272\322q\220\320\244o\363\235&\333m\035fK\350J\237\311\331T\3056HC-u9*H\237\022\244\225=.\220\001\035"
+	.string	"X\013\3751!\001\242\003\315\255\254\030\b\261\343f\264\022\261/\260\335\023\3302\243]\316\n!(V\344`Q\022\013\240h\202\263\n"
+	.string	"\301\335*uA\2201\233\201\270&j-\032\r\021\273'\023\004\234"
+	.ascii	"\244\032\264J\244)\205\202\002"
+	.text
+	.section	.gnu.lto_gyroReadRegister.59.25da401d0df9f5bc,"e",@progbits
+	.string	"(\265/\375`?\001\005\016"
+	.string	"\006\332^C"
+	.string	"\223[8\323\252\376]7R\336r\235\223\312K\355\252\201\303\341h\275\261\307\313\327,\263\236T\364c\255Y\252"
+	.string	"\025o]J^f[\253\353\307\234\271\006\333-ep\300|\033\220vy\274\032\267-\2212\245M"
+	.string	"E"
+	.string	"M"
+	.string	"\035\333&a\200\342\217\200\212\211\307\210\212\r+-nvS\231\222\370wK\363\363?s\t \352F(\232n\001"
+	.ascii	"ah\204\"\210\253E\242\022g\210\210)"
+	.string	"VH\n\033\024\037\237,\"\230yE\330]g(~\270;\267=\3016\004\373&\002`\352\213}k\325\305\266\322\227\323\236\307\374z\231?3}\220\220\032\016\342Q4\273\035rpv\325\261\001c\373\376\212\217\245\247\354@\304b%\033;\212\215\3312;\036d>\346\263\356\216P\325\330M-\360\007\344\001/\264\004\242\273\330\n\340\370\350\013#\216BK\016jw\033\274s)\213m\217\0368)\350+\257\227\332^\206|\350\321\317<\300\312&\304JEM\226\276X\307\211\036\036\364\237G\365\343\021\230hjX\344HI\037N\275~\345\307)s\354T\"\255\323\n&\241\315D\003\346\320\347d#m%\\W\022e^\307y$\315\313H\033h\224\205:/\373\0300\207A\353\262\023\216\3532,u\272\265\352\342\324\217\227\001\032\020CS\240\332FJF\234\205\026\234\233\013\310\217\207\001\022)\261{z\370\321\241\007\032"
+	.ascii	"\323#\360\371\241aW\360`\f!\3601\3256\207\"M\346.7s\300\257v"
+	.ascii	"H\325\325u\001\312\260\236\013y\271\215\301\240V\3060\254\204"
+	.ascii	"i\223\261\005\312\201\301\300\b\237\201\253\347A\232-\345\021"
+	.ascii	"\024\024"
+	.text
+	.section	.gnu.lto_gyroSetTargetLooptime.part.0.112.25da401d0df9f5bc,"e",@progbits
+	.string	"(\265/\375`\253"
+	.string	"m\n"
+	.string	"\346\322D< \345*\035\240\220#Q\347E\004\t\002ig\361\264\2471\303\235\363"
+	.string	"\331\211\203\334#\"j\030\307?fI\204H\211\322\275\b\001\210\004"
+	.string	"Fi\262$d\212G\021\336C\2176\331;\2451"
+	.string	"3"
+	.string	"4"
+	.string	"FYX\264c>v\354\006D\204B6\333\335z:9.~\312M\364?^`\305J}\016\260..\013\276\005(\354\2569\214\233\336\266\307\366\307~B\264\335\212\032m7(\313\307c\267O\202\362Gkb\356xP\207\235\344fS\001\016N=\245\335\361\210\207\235<w5TVvG\204Ss\270S\315\351G\354/\331m\321SPf>)c\177?!\021\274\354\356\307/\271I\350{\234\032\302$\277:\365M\231S\211\226K\b"
+	.string	"\225\254\311\371\362\334\276\355t\331\233lu\002\242\317\013-8t#\316 N\251\363:\206\017\214x\250!\370\205^(\254^\327 \252 0\254\034\003\177\243\020XK\337\007V\215m\371m\247\313\034LF\213jNx\316\031\027"
+	.string	"<+0\036\320\300f\224L0`\334S\034\240\335\250J@@\024\fs\205S4!\364\350\202\020\037;\343\025uC\247-\233y;-"
+	.ascii	"\327^L9-\247_[\306"
+	.text
+	.section	.gnu.lto_.symbol_nodes.25da401d0df9f5bc,"e",@progbits
+	.string	"(\265/\375`A\004\265\020"
+	.string	"\206\030_F\340\264&\035\250$\254\252\205\223\3035&\354\225\027/\265\267TI\022P\025 i\230\353\001\214\257%XiB\0302"
+	.string	"\021#v\322X\231\277\212\352\251\364\377\367\276\360\331\3029\265\247#\215\004.\262\210Sk\204\310-SF"
+	.string	"M"
+	.string	"M"
+	.string	"\017\356\242\232\273\320\274E\316|E\312\33434\346*\022\346n\275\334?j[~\256\317>\215\247\347(\022\007_\340b\033;\216\343\222\2263(!\340&\263=\372@0|a\337\026\n\025\373\276\357cy\212\264\235\245\002vq\270\2036\33444\3345\3021\303q0\334@\032^\270e\250\205\333\310\n\257\221\024N3\3413;\356\221I\270\214\316cd\004\357@9G\266\266\252~ \240d9\326\221\035\3019L\352/In\316\"\301\020\206\315\033\234| \250\"&\324DX.X \340\026\205\342\266m\333\226$\236hK\342Qe))r\031\320VW\326v\347\200\266\223"
+	.string	"\266\234JM>F\304\002\330\216D\225\257\236W\317\t[\022\367\217\021\267\017\021\267P\210\373\006\210\033\307\370\341)\0177\217\016\017V\325\212iUT\031 M\002l\n\260\363\026E\220\272\b\320\320\220\024oO\264\324AV\b\031\352\274\005\300*y\022H\f\237\026%o\267W\207\221D\005\335\216xP\272\355T\t\346N\"9w\266\266\271\334J\233K\"\032\255\260\271:\\i\003M\250Q\034$e+)(i\241\\\f\340\002)\252m\003\021\200\024\016\031\204\004\304\220@F\204h\352\001xK\"\364r(u\362\341\315\203\352,\232\327wR?M\306_\205\217\227$\261\267l\300M\217\245\312\371\025\214J\371\211\"B=\225\306\001\225\256\016\3445\261\215T\343>\254k\206.~\371M\222x\272\356\265o=\324\273\345\032\304}'\3669/S4\177k\231&Ir\371\305o"
+	.ascii	"\340\"1\355>\253\251z~\326<\256\347O\322:\211\263P\266\006\335"
+	.ascii	"\217\b\272\n"
+	.text
+	.section	.gnu.lto_.refs.25da401d0df9f5bc,"e",@progbits
+	.string	"(\265/\375`T\001%\013"
+	.string	"\326\323:5PM\223\306k\273\267\024#\007H\005AJr "
+	.string	"\225\231\231\231\231\231\231\231\231%f\b'\312 \375]\277\376\267\377f\326\3226{\263F\214l\223F\210\224)\005%"
+	.string	")"
+	.string	"*"
+	.string	"\017\263\315#\363wH^$\263\322\210\240M*2HR\362FN\251\027\362N\257\343m\274w\372i\017_WC\020k9\255\276\262vR\321\207\024=\305\005R\0233sz9]\247\224\323\t\310\351\264J\247\221\204\322>b\223\344dS\262N\001\352\240\001\203\265*XM\260\036\2705\260\026x\t\274\003V\001\267\001\226\002X\233\261tS\231\233M\214\265\027K5\225\251\331\304\034z\233\267Yh\240\212\273\2458Gf\f\344\313\313Z\202\304\b\021!>\037\020\037<x<\0358l\320\220\001\303\205N\307B\005\313Ja\202\204\b\234\312\224\263)\204\007w7 \240\002\251\252\331\006\016R\020\t\320"
+	.ascii	"\207`\3747\206\2265\356+\247\273#`P\374`\bA\343\244`\013a\304"
+	.ascii	"\201\301\016!\240\270D\301\252C\320\270o\260C\214+\230\020\342"
+	.ascii	"\016\246\220E\334F\325qf\301N\b\206\227\214\372Z\\\325\216\303"
+	.ascii	"\350\tDF\316\032\260bI\372|\316&S\322\232m\237\372\270\023\316"
+	.ascii	"\367\300\206\006S\020`aX\031\272\254\306\315\263\007\005"
+	.text
+	.section	.gnu.lto_.decls.25da401d0df9f5bc,"e",@progbits
+	.string	"(\265/\375`\004Y%o\001\312ZR\204S \316,\235\306\325\217\200\226X\335`Z\216#\214C\3533\331\224\203j\363\246x\210R\237|\370\314\016nX:\261\b\227\027/MT\004\213\310\351=\312\3101G\020\266\363\304\003z0%t\302+\217\016\347\327"
+	.string	"e7g\354Ro\251\352\323r\313-\245\224)\032\007N\bl\b\372:V\264\324]ay\332\344\250\220a\361\215\272)*\362Y\256\n\235\250\343F\376\330R\374a\361u\3244\212\275\367\256\317\222\317g\311\327A\242\257\254A\371\026\177\273g\265X\275zbair\305\342\353\004\321\271\006e\033\307\312\251H\rv\316\376\251l\276\240\256,\276\216\227f\301\336UC\256{{UC\276\316\f]w\r\312n\206~\262pD\221\262\370:O\372\034\320\331\272\333\304JK\361AD\271\367\361\277\275\263y\025i\361\354\2324<\253\264m\252\\\332~\312\312"
+	.string	"\317\256\207r\271\367\321\303\220\207\036)\313822\266\263l~\\\fY\021\004iG\246\257w\244\261j,\026\024 Z+\215\276\322?\365\312X35\231\007\207\305\2322dt\322\216\271\3075.b,\376\271%yN\321\365l\242\177\202\351\237=\364\317,=T\205\362O(m\271`\031q<\210X\374\034G?\253\321\035\252P\336\240\ne\213\345G\216\210\2265\213\237\277X7+m5,\305Y\230\305\317K\364\177\273V\221\226\315N9>\356\035e\331,\025[\245\312\245\355}\265"
+	.ascii	"2\25360\226{\357!\017\325\206\027(0\030\333*\277M\263j\265N\247"
+	.ascii	"\355\f\226\230\305\317[\372yJ\337\234\243\355V\025\312\031l\245"
+	.ascii	"\3217\307\350\236c\025\312\365\255\006eL\245\006\345\332\366"
+	.ascii	"\246/\034\253P\266_5([9[\246$\355hE\312b\2620a6\266X|sM'\261"
+	.ascii	"cY\311\032(+\213o\"\365\3151\rf\303\216\254y\202\003\316\342"
+	.ascii	"\233>\300\216`5\032_^\307\273=b\212\t#\"\305\342\2339\264i\262"
+	.ascii	"\320\307q\264\211\311\350lU\203\362\017\r:X\226P\001\263\370"
+	.ascii	"\330\212>\007\266\207\265a\275\252\\\032\356\002Fi{X\036v\205"
+	.ascii	"O\324q\027}\250v\022n\351\303~U\244\355awh\270q\242\3500\223"
+	.ascii	"\361\361\016}l\245\273*\364\240\002\203\263\370xk\253\303\346"
+	.ascii	"8\333[\032\253\303\336\240\263\\v\253"
+	.string	"\"\255\016\213\3435\317\326\360\340a(\2638\2435'\343_=\375[\247\177\315\350_.\272\356*\224\177\245\350\274U\203\362/\022\375\373C\237V5(\333\254\2606/e,\376\205\241_\221\026\353\212\315\2316rV\267W?\221\007\257\343\331\333l\357\275\241\347\213\314\314\031\213m\013[\365_\347\326A\361b\306\342\337V\331\027\227\353\352\313\215\305T\367\315\023\324\322\342\337\025\372\177E\332)\353\342\270\367\016K\243\302\262\370\026\216>\336\327\376\353h#ZX \261\370vN\353]\203\262U1\264\263#\307\217-\026\337\272\351;\2748!\226o\332\310\t\361fi\\\243\324\213\362W;6s8\370\353\2318\265\316'\nho/)\343\225\277\322\245\251u>:{?\355\031\367\336\377\353^\325\263E\273-\224MQ\345\330(\373T\221uN\205\363:W\313\034\037_\315\376\232W\347T7\265n\003\213\275\237l\b"
+	.ascii	"\351\306ml\271\367\3660\344\001\303\030C\346\205\001\337~\351"
+	.ascii	"\333\030\372\026K\337V\351\333)\r\304BsP\241o\241\364\0065(\337"
+	.ascii	"n\375c\r\312\177"
+	.string	"U\363Z\367W45\312\331\354\326\336Q{\357\013,\030\273\034K\213kZ\210W5A\331J\353\270\323\366\336?\267M\213\n9\026\277\316\321o\253A\231G\251\263\\\025\312OS\203\262\266\252A\371UN\277j\321\257iZ+kP\376\262\n\345W\"\272\306\331\nW\277\274\306U/'\362\340<Q5\016\357\375T+\001|j%\200\231e\310\323\223\214_\277\364kV};\337\270\030\023\306\342\253@\327,UKE\326-\177u\253W\216\235lm\344\336\307\236\373$#\216\315\342\327\016\371gooo\257v\310_\322\270\006e\016U(\377\004\372\037\320o\253B\271N\251T*R\203Z\3455\255\252\335|:\356\343\336\307\037\033d\216\332\023\213?B\277j\220\357\336^\325 ?\004\rT\205\262\255A\371rU(\327&\325IEbP\241\234\310\203\337\242\223m\266\367\361\247G\217L/\216\305\207\200~}r"
+	.ascii	"8\331\036<H\277b\220\353^\305 \337j\235]\203\362\225U(\377u\311"
+	.string	"_\313\252Y\207+5\265\265\323\366>Z\350y3\007\225\304\342\037\253P\3265(C\031\241C\316=\342\335\273\377$\016\305\215r\315o3(\361_\r\t\376o8\211\272\202\377\027\374YM\335o-\374\365\204\0322\2775A\367[\240\277\232\035\312\231\222\205?s\371\357\006\320\374vhA\360*cJ 1\302\006z\374\347)\277M\301o\203~K\264H\277E\361\333\f\216X6\266\315\365\300\231\337\n\215\360_3\367,\363\333\263\271\337\226\340\377\333o\301~\013\374-\327o\311\376\313Cf\314oO\374\366\350\267J\277\365\031\177\233G\242\232`\325\374\327r\223\227\004\"\374y\354\365\317Fn\004\300|\271\200\317\237\257\376{\343\267 \210\373\353\226\372\366\037N\002\337\371\263\n~;\200\337\n\325\270\337\006 \001;\340~\253\301\216\337\032\340\257\"\370m\334\177\275\374\267H\227\337\316\375\227\313o\001\360\327\022~\213"
+	.string	"K\306\026\340\267\031\370\255\002\204\3746\257\232\360\327/\377\021p\337\376\253\345\257Gg'\372\363\220\277\206\250D\377\315\220\305\026\371\355\326\177;\300\362[#\277\365\372\255\360\267a\277\365\361[\247\377\016\300\315\216}\203\006\257\362\004\374\331\353\267L\277\025\373-\nL\360\037\212%r\344\277W\376[\301\312\377\r\377\021\360\240?\203\370\357n\373+\002\356\006)\330\376\252\301_\013\260\366[\243\3376\3755\001\277\375\375\026\205\337\312\271-\244\334*\227\212\005\001\211\303e\020\322\024\036@\374/\326o\367\246\334\026R\324\376{\341\246\375W\353\277QjF\263*\370k\3207p\241\274"
+	.ascii	"\177F\341\267C\033\347>\371\257\301\177\235\334\240W\370\263"
+	.ascii	"\006\377m\362_\263\377\036\371\257\361\277<\376\313\365_\035"
+	.ascii	"\377\305\361_\032\377\215\361\337\254\377\272\370\257\212\377"
+	.ascii	"\026\377\253\202\377\232\370\357\360\277J\377E\372\357\210\377"
+	.ascii	"\242\377-\361\337\023\374\267\004\377%\301\177C\360\337\017\374"
+	.ascii	"\267\003\377\345\300\177/\360_\t\374\367\001\377u\300\177=\370"
+	.ascii	"\357\006\377\355\360_\016\377\325\360\337\013\376\033\364\177"
+	.ascii	"\003\377\345\371k\322_\345~k\346?\334_I\374\267\302o\343\374"
+	.ascii	"6\351\277\372\277\366\267&~\313\201\337\246\377\255\177\265\360"
+	.ascii	"\327\240\337\356\375v\351\267r\376\232\177\273\374\017\345\267"
+	.ascii	"y\277\005\301\177\022\377\253\374\366\356\267x\377G\374\266\315"
+	.ascii	"o\327\374\266\356\267t\277E\363\3333\277=\376\366\354\267L~\273"
+	.ascii	"\344\267f\277-\373\255\222\337\262\340\267+\370o\366\037\004"
+	.ascii	"\377\275\374\017\332\333\333\333\373\265\361\007b\362S@Ey,l\230"
+	.ascii	"P\177\275\213\372R\356}\254w+\242\340\330\362\327\274\027.f\324"
+	.ascii	")\245nLEy\241\254a\206-\306\233<*\253\267b\312\b\367\207\240"
+	.ascii	"A\247\f\221U\327\240\304QZ-\177\2753\307\314\024>t\334\231c\246"
+	.ascii	"\2126rC:EX"
+	.string	"\204\275\371"
+	.ascii	"\333\266*\224=\324\240|\2416\372BW\364\205\216\372Ba\372B;\364"
+	.ascii	"\205\262\3641\350\351c \243\217\241M\037\303\230>\006\037\372"
+	.ascii	"\030h\350cX\241\037t\247\037$F?\210M?hL?\310K?\250J\377\202\236"
+	.ascii	"\376\2059\375\013]\364/\250\351_\020\323\277\300C\177P\205\362"
+	.ascii	"/\274\320\277\260\365\323\360\236\006:\312m\212\231\305?\326"
+	.ascii	"\253p\003\214\032;\213/\0130e\022n\031c\206\205\361\344\315("
+	.ascii	"\305\242\314\230\204[\232i\301o\267\211\225\216\362\004\2072"
+	.ascii	"\304\034\230\\\022n\t\306\230\204\303V\206(\207\020Q#S\315\034"
+	.ascii	"\223pK\334\245"
+	.string	"\256\371<\001\355((\033\306\020\230\013~\343\340\230\204K\022fL]\233\300N\302%\211\"e+\t\267\264\303W\304\214wn[1d\330\025\034\312\254\222prb\316\266\222pC\212l\266\277\236\315\3256+VI\270e\230dE\353\340\314*\t\207\347\354\031n\373@\205\025\006\236\024Q\"\261e\034\306\266\222p\313.g\307$\334R\016\333a:\f\006\177\301e\360\022\253\301h0\033\214\207\343\340:,\007\223\301bp\036N\203\307`3\370\fv\203\225x\r\016\203\223x\016~\203\341\3406\370\256\"\361\034\366r\f\207\343\254\026\236\2634,\220\333\304j\003^U\224F#V\254\253\203\261\266$\\\315\233\303Y\304v\022ni\203\314Y!\026F\007\262c\022ny\207\261x`\225\204K\302\344H\346\205\361l\256Z\251h\367h<\243\360\220R\236\341\271\212\245r\351\340\254-\t\267\334\373\250\305(e(\241"
+	.ascii	"\276\332\256BY\307\302\033}\013i\364-\304u\300[\216?:smp\244"
+	.ascii	"Y|\013X\364-@\321\267`\246o\301\250o\241\207\276\205\027\372"
+	.ascii	"\026\2364\033.\202\305\246\314\342\003\341\351W3\\\005\023\301"
+	.ascii	"Sn\023\253\f$\251\3260\225\212\304U\360\220\333%\226\t\256b\241"
+	.ascii	"`!\037\250\260\032!9\245\334{{\030\362\360#u#\013+c)]\312L\341"
+	.ascii	"\260\370@I\215\206\241\334\025^Rh\330\bvR\345\322\260\222=%\032"
+	.ascii	"~R\353\252\\\332\006!\227\204K\242\206\323p\224\212\304h\030"
+	.ascii	"y\333\304:\3610T\2006\343Q\343\003\271\351\0035\321\007Z\242"
+	.ascii	"\261\223\037\027\301F\334\304ny9\323j\263\370(\007\252\215\021"
+	.ascii	"\213\017$\246\317\201\230\215\266\260\263\335&V\031Z$]\220=\313"
+	.ascii	"mb\245\321\274\246\224f`emK\260\022l\206\231\340\263\212\304"
+	.ascii	"e\030\311\361\030NR\206\217\234-\005r\001F\214g\0161om<\370@"
+	.ascii	"Ft\335\252B\031C\r\312\007\372\241\017\324\245\017dC\037\b\206"
+	.ascii	">\020\225>\020\013}\345\252P\216@\r\312\377\231\243\377\243\324"
+	.ascii	"d)\3102\006\213\305\367\t\352Ju0\306\245\027\266\264hW\365L\213"
+	.ascii	"Z7V\374\302u\f3g\317\214\205\271b\27549s]\234\255\312\245\355"
+	.ascii	"\024M\026 f\247\027\266\334\362f\273D\361\252\342\001\230\032"
+	.ascii	"w\217\306\023\315K\315\302\305U4\237\"\320\206JN1b\030\030\b"
+	.ascii	"\266\201e\340-\274\003\367\300]\370\013{a\0358\013\373\300X\270"
+	.ascii	"\006\306\201\203`-\374\003\363\300W8\006\316\201i\340\033xFE"
+	.ascii	"b.;v\373\304\"?d\265T0\025\255\003\2620D\036`.+W\343\252\234"
+	.ascii	"\326.\332e@V4\253r\263|\240\302J\247*)\304\276\301\\w\337\342"
+	.ascii	"=\266\215\340Uv\007w\303x-@,\n\346\262R\254\225\254\f\312\212"
+	.ascii	"L~\373\306\302\261z\367\330\246Wx\231)\367\336vZ\256\227\017"
+	.ascii	"TX\351\274H\006\271O\230\353\262\250u\267\211\225\bI2\345\336"
+	.ascii	"\233\353\216\301V\035\210\025\365\302\2266\312\025\233\005k\003"
+	.ascii	"2\2735\\\227\311\245\322\025\0011+zaK\265\337\036\271\352\230"
+	.ascii	"\272V\345\276\366S\361\2032.\275\260\345\336G\033\006sY1\226"
+	.ascii	"L\362\214\203\337\206\341\262h\354\3626\261\322y\361d\211\022"
+	.ascii	"s\335\027w\311\006(\251\275\2612\020\013\243\027\266\364\321"
+	.ascii	"\302\002\216\215\006`\\\365\263\303\307\023\031\213\377\243D"
+	.ascii	"\223\271i\356\321(\002\324\013\245\013\374\002OU$\246:\246\272"
+	.ascii	"jp\361\003\025V\034\200\242Rb*\334\342p\033\240\244\366\023\327"
+	.ascii	"\006F\336\300\311\201\321\276\270\350\320\370>{\372V\313\033"
+	.ascii	"\rU\356\213\002G\246\\\321#S\342\342\255\273\313\rPR\032x\243"
+	.ascii	"\242\314\213\363,>:{w\245\031\347(Q\312\351P\345\322D\264\231"
+	.ascii	")\367>\342\342\335{\026\237(\240\035E$\211\362\n.^8\032|\236"
+	.ascii	"\216\333*\377\370\221\227d\211W`\026\370\t\253\300Q8\005\226"
+	.ascii	"\302P\025\211\213xG\231hP\226q.\340\373(\321\367\001\323\367"
+	.ascii	"\t\242\357\343\245\357SC\337'K\337\307\205\276O\321\r\225\342"
+	.ascii	"\0321U\026\277Gyw\361*\362\346]\345\232\313f\207\032c\336ms\331"
+	.ascii	"\\Ps\206\016ny\327\350\356\240d\374\236\"\372\277l\354v\364\226"
+	.ascii	"\340\320\263\273J\037&E\246vX\374\236\031\372=V\372=,\364{\236"
+	.ascii	"n\232\377\212\271\311Kw\002S\215\205\227\025\026\3373\027\315"
+	.ascii	"/\3355\263/]\007[{?]\272\0379{?\375\324J\200Z\t\200\225x\025"
+	.ascii	"\221\222\361y\346\350;\027\342\267L\212\257),\2135\250A\371<"
+	.ascii	"y\372<v\332\036\253P\356P\203\362\225\033\212\325qy\001\363\005"
+	.ascii	"\210\362\214\321\342\373\245H7\245\f\026.\267\313\233\216X\f"
+	.ascii	"\2654L\270\274\351\314\231\255\345m\371}\273x9z\f\261\370x\365"
+	.ascii	"L+\006\333\330\305r%,N\2336\213\317\203C\277\"\257\333\275rF"
+	.ascii	"\275q\362\305\n\221\0075\256\226\325%\335X|\331n\2336V\025S\264"
+	.ascii	"%\371y\363\242WcM\307\216\f\230\2575\253\307\303\310Z\231\305"
+	.ascii	"\347\251\322N\206n\224(\262+\245\"\357\224{\2266\345\036\257"
+	.ascii	"\232\232\225\2637\236\315\342\215\025\254\226V_\274PJY|\243\350"
+	.ascii	"\300\301\210\301\305\342\357\310\351\377B\251\310\213\326\201"
+	.ascii	"\013\f\313\342\343]\344\177\035\353\203\314\0328\026\377\027"
+	.ascii	"\371\373\304jG\241a\261\223\263\356J\214\023\213\277\263\246"
+	.ascii	"\233\3343\313\3654\346\312\342\357L\321\337!\323\337\t3\263t"
+	.ascii	"Kf\240Y\374\235/\262\253\244\"o\331\315\372\235\272T\037*\273"
+	.ascii	"U\027\313'\352\270\257\3163ve\027\306\035\253rZ@;\252n\216\322"
+	.ascii	"CE\323\242\307&\343\257\033\226\306\210\344\212\335$\025y\307"
+	.ascii	"~\307n\214\233\303\247ha\357\036r\214cW\307\355\341\023u\334"
+	.ascii	"XyM\021l\251\301\203\207\235)\0368\212\032\037\271`\025y\303"
+	.ascii	"\256\021!\327X\345\264\216\033\313g\n\027\330r\031v\177\334 "
+	.ascii	"\033\240\244.\200\205N\251\335\200`\371\221\361wn\350[\204\005"
+	.ascii	"\033X\231!\227H\205\030ZrX,\376\216\225\036\362\372\302H\n/\026"
+	.ascii	"\177g\205~E^\315\005\362\272 p2\226X\374\235'\375\nq\364+\270"
+	.ascii	"\321\347\340\366\270[\327\253\312\245\211\370R\247\274<\256\217"
+	.ascii	"\212\274=\356\216\036WFE\253rZ\021\350\262F\351S\004\254lI\306"
+	.ascii	"\257@\247\361XT\224\270\333u\271vOO\035\216,a\026\277B\030\375"
+	.ascii	"\n]\364+h\2717.\216\212\2749\256\215\241\343\336Tr\334\031\267"
+	.ascii	"\306\006()\022r\300\251fD\036\334\034WFE\363)\036w\325N\021#"
+	.ascii	"`\313\345\336\307!\017\036\316\035W\316\200d\374\nA\364\177k"
+	.ascii	"\\\0324\244\252\3109\232[\264\306\f\261\370j\335,4-v"
+	.string	"\235\305\257\260C\277\302\r\375\nY\372\025Z\350\353\350\335\253(]L\222X|\235\273k\245\223F_\307\214\256\307*\224\207jP\276\216\030}\035.\001^^'\217\352dWe\265,=\031K\214\227\234C\265\343'\017\037$:\320\366"
+	.string	"\214\234\\'\227=2\344\306\230\204\303Zvn\266\305\037\300\326\251\343\324q\337|$\335tYV-i\320X\315\331\260q\342\250NvU\007\262\362n$\331\311k\321F\352\306O\034u\311\26393e3f\2344\352\264\302\214Ij\375\244\241\246K\226/D\256\234+ru\026_"
+	.string	"6b\304\230R\341\307\0164Y,\276"
+	.ascii	"\\PQ\235YCz/y\242F\251\341p\201\343\003\353gV\276\243\322\261"
+	.ascii	"\303\342\363jI\032\270<\213O\253\263\311\035ePY|V\3417!<\230"
+	.ascii	"\310\260\370|q\352\220\"\007/o\213\024S&\227'%u\272\030\322{"
+	.ascii	"I\362M\351\266D\314\233\026?]\260a.34|X|\2628\333\317Z\0233A"
+	.ascii	"\314\234P'\324\251\302\214\321JI\215\2673\305O\025=J\244\254"
+	.ascii	"\252,>\243z\322\252\332l9\233\330\032\231\024\213\217\301\234"
+	.ascii	"9g1\215Ye\313\332\234s\377,Z\036>\262\210X\234\3672\221\035\025"
+	.ascii	"C\220\214\2618\353\235\r\2779\251\242\304\200\311r\231\343D`"
+	.ascii	"\214\205Q{y!\"\007\316s\234\212v\352\200b\206\312\342\374\246"
+	.ascii	"\242\321\255\361re\310\335]\316C1F\f\314\016\f\262\244Z\306{"
+	.ascii	"\316\263z%p\221\025\343Yp\f+eq\026\037\003\256\272\327e6vk\357"
+	.ascii	"\255b;\335\211uQ\3329*ial\354~\366\0211<\262]V\256\251R6q\023"
+	.ascii	"\247\314\r\2165v\215Z\016!w\026\037\203\026g\316\3444B2\0277"
+	.ascii	"\035\262"
+	.string	"\345\223d\232L\267\204\007\0236\272\214\206G\214\0320R\314\300\240\270\354\260\370\033\344\350?\227)S\321\206\266\212l8\270\035\223p&\234+]e,\376\2063c\306d2\257V{o\250\275s\020\311Y\236\364\254\241j\253\"\223\251\330\304\240\372\262\370\033\334\364\237\305 \263\030\263Mu\262\213\025Xd%\273lac\344\213\305\337\300C?\177\251Y\256\"\263\\\246\272\300~\312\352@\314-\210\214\345\266:*\340\033\260\364k\246\312\177\216C\346\270\212V\235\354\252\n+\262\316\224\313\275\337\024\200\347\254\231\373a\361\003P\247\273t\311^\352\336xy\006\024\025\267\247(\213\275\030\001\363\232\"\363\366f\217\344\030P7:X)6L\346pqs\313Z\352\2146Ad$\301W\240\230aey\326\302cF\244J\206\305\031\213\024+\267b\217\350\275w\361\270\253\234\222Ad$\331ZZ\035\262\21345\356,~"
+	.string	"\224H\311kR2[\336\273\036\267\252\254\266\226U\207\3146eJ\256R\267U^\336\222\245\325\241\316\330\322&\205\312s\225+\307\031h\377uL\257\2744l\026?"
+	.string	";\364\003\260\342\354,\247U\273\020q\236DyN\213+\336\271\001\2638?\311h:H\2600qh\031\212\013\267\024\\\330\266\265\342\204\f\211\304Cx\236\272j\344e''\2147pw\331In\342\003H\222#f\216Jt\270\2119\232Utl<\311\213\313++\313K\330H"
+	.string	"\314\354y\211\315\262\243\205\205\224\030\026\037\317\226\035k\300\240##[\362\004"
+	.string	"Z\364\330X6\312\311\372\322A\207\314\031 p\026\037"
+	.string	"\307#G\262\030\231[\330\263\3305>\301@cq\006\003@\020\r\344@\262\261\002\035\241\222q\214u\313qkE\221g\243\017\333TU\226\3059H&\302\243\302\314\005\013\"C|t\220\331 \023bU\370\364\350\262{#\244\302\3711\213\342\244\b"
+	.string	"\260tWW\376B\323#$\t\222\211\217\347/\2640\272\245\305\331+\367\350Q\267\305\256\3073\017\343\234\251\273.\274\0355\\X\234wX\034]+\324\242X\274g\303F\336\332`K\336z\002B\005\313\342\234\303\247\356\306\0305\2133\216g\311\332r\373aq\276Q\201\312\027%t\026\037\017\277\375\327\311_\252\344\300\261\370\032\346\364\237i\274\"3\215\354\242\303\326\306\352"
+	.ascii	"O\031\245\b\032!Xb\304\3103*\036T\331\226\025\245\f1Xg\266\305"
+	.ascii	"\327\360D?\277\310U\317VV9Kg\357\275\265v\221M\006bm\202\310"
+	.ascii	"Xn-\253\016\177\306z\316\372\211<\250kROX\336,\316W'xKvY|\274"
+	.ascii	"\212\317\300\264zX|\rP\372\257\267\177\336OV{o,\363\270\255\240"
+	.ascii	"x\362__\315Z;\374=\365\326\002\374\307\007\256`o\025l_{\357z"
+	.ascii	"\247\301\330\236lp\330\377\337a\357b\335{[I!\273\212\026\244"
+	.ascii	"\220O[\n\212\334\225\005)d\327\225\324qs]\260\221;\266\324q\253"
+	.ascii	"\210\267\212{\357\242\335\307\035\325u\265\243\266\212LR\307"
+	.ascii	"m\265\217[E\240\035u\005$u|*J!\273\256\252\024r\353J\n\271ue"
+	.ascii	"aG\355\342\216z\342\322Q[WRp[W@R\310\247+\251\250\256\253z\334"
+	.ascii	"\3325\214\333\261\253\250b#\237z\366\336SGc\221g\357'\253]\024"
+	.ascii	"c\251v\227\222j\347\330U\216\354\270c\357]L3\343\265\245s\204"
+	.ascii	"\332rRa[I*\3666\263\251:(\326\342q\357\275bC\025\353\336*\216"
+	.ascii	"V{Cm\235@k\357\275\267\352\230\025V\273gG=MAym\361\250\200\332"
+	.ascii	"Z\261\303\270\352\336{_I!\275\266BXAC\0327\324\261X\245\246\266"
+	.ascii	"\266q\233\351\262\322\310bm\323\203\f\2425\225\247t\332\214]"
+	.ascii	"x\026\177(N\347\026^U\326\312X\374\2416\375\347\250\212\314Q"
+	.ascii	"Y\312:\331E\037\272\2568z:e\364\226\220Y\374\347\025\317R\177"
+	.ascii	"N\221Ud\250\n\207\246J\227\305D!\236W\344$X\270\336X\\\345\252"
+	.ascii	"P\336P\203\362\207\3004\317\2328#\214\347\342s\321^U'\273\252"
+	.ascii	">Q\222\365e\271\267V\207\032\025\245\203M\207\271w\355\350hx"
+	.ascii	"Y\374\241)S\017\316+\322\204c\312\271R[\373*\002nF-\005T6I6S"
+	.ascii	"\026\233qj\330h[\263\370C)\364\207\336\230K\033OlE,\266Ip\234"
+	.ascii	"Q\263\370\310SU\025d+\017\357\314\302\345\013\013\017\013\261"
+	.ascii	"a\310j\224\2713\333X4<\326R\330\335l\363\233l\354\226\212V\261"
+	.ascii	"\266t\025\261\330\254A\271\272\205\270i\207w\344U\035Q\326-k"
+	.ascii	"\352P\250\241e\264\330\2543\221hT\212\026\377\002:\375\233i."
+	.ascii	"\030\363FU\030*\2722h\3143-\334\314\255Yl\346\030\305\205D\013"
+	.ascii	"\232\305\277\340M\277\232\2051\331\314\270*\367\205\277\260\231"
+	.ascii	"PN\326\214P*\332\024#\232\355\"\305\214\242f\274U\025\315\347"
+	.ascii	"\356\235#\255\2149g~1\345L2\346\0303i\2121\301T\244\031\306\254"
+	.ascii	"rs\2552\271\335\202TBE\231fR\251rZ\021Hr\246\fa\2061\237\330"
+	.ascii	".\347\217+q\364\226{\037\353\226\222\344\027\006\fw\227\304\305"
+	.ascii	"\031\261\370\027\f\321\377\315.&\227\2124\275\230Vnn\361y\002"
+	.ascii	"\332\033H\235\322\364b\266\335b\225\373\302J\316(\367\336\032"
+	.ascii	"<x\310`m\330\2562~Us3\265\230of\226\2124\267\\\271b\365|\314"
+	.ascii	"\275\267\324\230[L,V\257\302\220#pr,=\f\231\360\210\243\361/"
+	.ascii	"x\322\317 G?\303R?\303\234~\0061\372\031\256h\237\032\224\237"
+	.ascii	"\341L\233j\246\224\212\0342\247\210\201zq"
+	.string	"\303\342gH\242[\260\353P\376^\035\312\317pD?C\020\375\f;\3643\340\320\317\200\245\237\241\205~\206\255\177\263I\215;\313\264x\245\035q\333\316\2210Yh\234\271\231O\272(yb\202\225\223ap\3400\227\300\360\022V\006\316\f\203\243\f\252\035\026\377f\2319\226dCWf\361\315\375\327\273\242\020,\253\307C\216R\253\256\245Pc*1\303\314 \346\226\251\303\004b\3720\205\230HL0\263\207\351e\3760\305\314\"\246\021\223\314\3442\215\346\016\363\210\371e&1\273\314!&\017\223HE\232c\346\215\2338\314\034\267-h(\253X\030\237|"
+	.string	"qQ\327\264\214f2\226y\346\325\034\030P\340\300Y\225\2212\332"
+	.string	"c\264`\320(\003h\021\320\004*\302\251\002B?\241\322\221\331\304\264\244\244\364+JJ\177K N\b\207I\2510x\036\375P%\234\022\203\302\"\363(\r\002\207J\031\004\022\360(8\202\003&\224`\001\013\240)pxbg(\202\t\034\236\364\241(\350D\324 EO"
+	.string	"z\322\007\024\205\337\221\317\003\212\302\357\310\347I\037\212|\350\0220\r6\rA\024\035\245\350\t\025\222\220\232\204\303\244\224H\374\225\220\002\203$\f\240\003):\302\017\206 \3607BO\n\f\222`A\204\022.\030\242)\021\210\204\232`\364C\201\210L\"F\020\233*\320\263$\f\242\"\230\204B\r\030\001K@M"
+	.string	"\323\242\337\205\021R\024I\350I\0370 \032\241F?HM%P#\020FJ\300\246\022\250\221p\204N\n\f\222"
+	.string	"\f\222\200\016K\330\361!\376\bm\360!\035\376\230>\220H\321\023\200*\020\t\205\020A\304\320\205#&\r\244\300 \t\026R`\220\004\240\017 \205\013$\025\245\302\r\030\241)\261\t\005F \244D`S\n\2346\200\246?\245\246\"\245_\321"
+	.ascii	"^\004\034\242A\024I\277\203\0060\240\001\037\2408S\247\337p\b"
+	.ascii	"\302\022\232\022\235N\330\240\244\324"
+	.string	"\024\fJ\205C'$\214\372\210H?%\021\322'}0\201\032!1\r\245O\372\220\006\321%%%\341\020'\025\245@&\363\304\317\3516\371,\234\370\r/\bK\302\224\330T\364\223MbS\005\200L\304\214\364#\021$\026ebS\005\212\210\200 \024\021\001+\240g\032D\227t\210>$\340QP\030\002\2114\210.\241&\204#8\020\233|\302\324\227B\322O\nI@!B\020\371RH\302@\344;:\022\246M\351\221\2208t\342\347\344KQ\342\321\221\320\207B\021\232T\324c\001erJ}>\247!jBX\204\016-\030)\t\223\210\3500)\365\235\3709]h\022q\201\357\210I)(\205$\037\212_\032D\213\206(\223/)5\002\236\270 \005;)$\371\202\300%\240\2410\375-\001S\"\032\344\013:\031\375\020\201(~>\244\246\022\250\221/\203\021J$f\"O\212\"\r\177\251O\352#\342"
+	.string	"]\002\246LB\241\006|\216B\020\001B\032l\022\206\260\263\324t\202\216\021\252T\342\027\264"
+	.string	"1xBhtA\210\024)\b\f\002\177K\250\tDT\251\310\251\350\207\350\013A8tB\262\260\324D\274i\320\267t\211>\023\250QJ<G\2148\301HI\350[\312'\234@\203\276\245<\374\231\270\303\022@\245_\321\016\321\367\244\017\007H\177|\347\223>\244EM\303\224HD\364\241@\323\246%\013(\024\t\225|\276\234\006\233\204E>\3379D\203'\204>\337I\034\242\304\246\240\317\247\215\202@\024|\276L\f\002\231\210>\337\031\024\002\211@%\324\347\323I})\021\250\004\364\244\017D\224\311)e\200\021:\374%\021\031"
+	.string	"\202\230\002K\200h\n\"1"
+	.string	"ES\020\250\304\200\016\032\340k\300\007(@\240FMJEA \210!\261\t\304\003R\024hP\351\027\034\242i\020\3503\372\241\303\244\224\311\347\273\300\004:d\362\371rJ\004*\371|\371\227\376\214|\276<\374%\025a4\005 \321\347\313(\024\t\225p\n\f\222\220\002\203@\241\240\bF?t\230\207i\tE\301&\021~\351O\204\321\0175A8t\032ACP\204\236'}"
+	.string	"\246(\320!\252d\024\374]"
+	.string	"\230\242@\203\322\340\221%\372\212P\023P(\372\225PR\372\205"
+	.string	"LQ\240\026\200)\n\024\247D\037\220\351\204#T\004\312\344D\302GB\t'\354\240E\301_J\f\002u\352\343"
+	.string	"\t8\b,!H,\312@&\342%\372B \"a'\004\"\022tr\021\021\360>\351\003\261\251\204\006\242o\204\021\320\020M\211\277\245L$\242C#\243\337\211\232\370)\235\320\304\264\244\233|&P#bS\tM\364\241E@\023\250\bbS\211\035\324\20729\221 6\225\320A\231\234RbS\211\223\330T\342\242J\277\"\242)\034\242#\320!\210"
+	.string	"!\365\021q\220\006\201'\261I\b4\201\016K\270p\342gB\b\"*\234\350\260)\375\rQ\246%4\335I\237\364\241\211i\311'\034:!\025\025\375@\020\207\250\t\340\320(\001\250\317\204\r<\330\240\001MLKAA!0mR\022\022\321a\005\242\017\003\352kbZ\332\311\251R\023\0215\001\025\321\304\264t\001\365\005\221\200J?\237O\020\t\250\004\202\257'\205\013d"
+	.string	"M\177&8\031\375P\023~\351\317HgH<\362%!\001\223|GLJ<GLJ\276\024\222P \342\300\227t\201\310$\034\212\030\242F@\023@\021MLK?\251\017\351GB\b<\221~$\200)\n\013\244A\022\232\230\226zP\237\017:\374\2350\032\362\244O\372@LJ\177KK\225\350\3631\035\005\241"
+	.string	"\016\323\337\210\240\020\230\376R\341\320G8tB\0022q\022\355\244D\237\tT\204\tT\304\t'~C\021\204C'\244\237\240\b\032\203R\217P\372\244\017"
+	.ascii	"\260\320\344\323\200p\350\204\024\224\242P\177\320\364\227\022"
+	.ascii	"M4\375\245'\204H\231|\210\210\304\037\323\t\241\222O\210\020"
+	.string	"\303\264\004\f\351\021OP\004'%&&\020\202\322'}8\002\021\024.-\t\213\002p!\023:\004\221\n\205C\020;DN\226\350C!\370\253\200\321\257)\005\300\022\0276(aC\224\260D%l\210\237%\372\331\020(,\021\n\033\302\311\022%\025\245\302 O\n\027@\323\237\t\250\022\323\322\357\204\242\242\337\017J\364\200\220\204p\350\204\244\203\032\tG\004\205\300\264\bM\205\303\0228@\374]@8tB\322\240$\024V\300g\"\005\201H#(\375\232D\240\304&\f\251\017\005j\024\004\372\210E\300\245_\320\311\310\227&!\001\225\216. \002Q\200\200\324T\002\025!\034:!\365\f\321T\t(\002O\020\330\200\020i\020\330\244Q\374F\0341i \350d\244\223\372>H\203\300\246\363!B\204\300\301\003\033\030A\027}H\201A\240O8tB\002A\034\n\211A\224\b\"\b\374-\201(\032\022A|\020"
+	.ascii	"\n\304\337\b\"\020\005\b'\204JGC\324\204\020\350\377\231w6\311"
+	.ascii	"-\316\200\261a\303\346\274;\320SY\216s\013\"\243\315\317\273"
+	.ascii	"2\\\300\202\020\340\207>\206EI2\2474;\321\226kXk\354\262B\262"
+	.ascii	"\252\316Xw\252IBFH\225\305n\216iP\274\024S\244\271s\366\326("
+	.ascii	"\3512\033\232\254e\307\327\323\336\231\f\365\263f\304[3#ejy\253"
+	.ascii	"\342V&Mk)\263\263\233\243\362\221\3143B\246\242%\343\246\240"
+	.ascii	",>\303\234a\316"
+	.string	"d\265\262\002\021\244+\216\336rk\301\350\360\237b~&\235\224I9\346 \200\226\376O\271\274\204K\325\f5\213\217&\2222M\350\276\234802\315\2339q<\304\260\240\261\306\342J\305B\354\313\213\361\264\342\202\312\322J\nE.EN.\347\033\025\267\2527\253\201\247\315]\026,[\254\025&J\314\216Zf\340\261\257\261\274,Y\254g+\206\022\037X\236\267\204xI\021\263\370\270\323\226C\355Jv\241\311\2509\002\303JqG\3714\203E\333\251\202gM\357\314\315\311\226\277j\227\024j\256\3165\257$\325Z\025\013\204\003U\364\302\250\234Y\032\206\035\031\223).N\260\247${\247\224lL[\301\245\212Z\3162"
+	.string	"\222\252%g\232]15\266\327\316('\215\266\024F \026\377\025y\266\023J\023\343\336\033\210\007\315]\2254\213O"
+	.ascii	",\375\237HS\316\335\321\270->b\320\032{a1\023&g\223\241\255\242"
+	.ascii	"]\006o\270z(MP\007\247\305y\374\331\344\270,3g\361y\226\351t"
+	.ascii	"\222RrV8\350\205\375T\022v\232\235X\2066T\324\316\361#(\316T"
+	.ascii	"\017\263\345\226\272\321\001\251\207\016\270\262\237fp{P\332"
+	.ascii	"\272\316$?\311~\235\263\f\031/N,>\0074}\"\3719\366\353\2306\262"
+	.ascii	"\350\302,>\207&\372?\305~\035\236/\270/l,>\2072}\016aG\216\330"
+	.ascii	"#G\246\272\224I\366\326\352\300\203E\n\t\016\213\317a\312\207"
+	.ascii	"\217\323\b\366\004'\307\262G\211\231\026,\212\3744J\341\021\006"
+	.ascii	"\306\3423\310ID'G\021\215\007\221!n\314\332\364\340\332\346\300"
+	.ascii	"Y\t1\255h\310m\314\f\361b\361\361N \347\322\213\r$'\220\363\207"
+	.ascii	"\032\271$bm[G\013\033\336\231\363\313N\301H%R\312\320\005\206"
+	.ascii	">\2503\022D\212H\230B\024\223L!d\212Ff\322t\263\025@0H@$\222"
+	.ascii	"\r\306A>\023\300C\013\253\224\231$G!cfFD\202H\222rR(,\0070@p"
+	.ascii	"\205d\311\231\257\017 L\024OT\371\rN\031\021\022\315\r%\367\317"
+	.ascii	"Z!/9ko\275%$\2536:\344e\276\b\356/@\347\224op\270>\016\302\364"
+	.ascii	",S\362\305\032\240\341\f\246\236/\373b8\356}\332o\204yC\243\036"
+	.ascii	"\226\266\30098\354\300\201\201e\013 ?\310\025\177E\325\372\303"
+	.ascii	"\330M,0n8cTy\022\300\234WZ\031\271\212\227\327\203\004\375\302"
+	.ascii	"\354k&a\t\261h\325\351\231\333\323\023=@9ha}U\371\330\3478\322"
+	.ascii	"\021=N\367\026\214\220\207d\213.T\263t\260\254,ON\220,\016\326"
+	.ascii	"\005\206\224\273e\222\220\021\0361\034\204\315\214\371L\022\323"
+	.ascii	"\341d\242\231\263{\262\256\214\200\025\002\217?\315\360ga\304"
+	.ascii	"$c6\257\220\344a\b\361\203{\346 s\240\253\316 lIB\205\024Z\217"
+	.ascii	"\004\r\222\261\300\341x\211V\232n\333<+B\361\006;\321\374\013"
+	.ascii	"-\256*\203\371\233Es\374m\370\234\301\024\024e\202\223W\310E"
+	.ascii	". \357\027\273-\f\364z\321\257\251j\261\221\374W\236\360\215"
+	.ascii	"B\030\321\036\\\301\331\222\344\352\374\315\314\345\365\035\324"
+	.ascii	"\324\300\"JvMF\301\253\222AF\320K\234\34108\027\366\357O\361"
+	.ascii	"B\035\345\031|\f\n$\004\306\007\342\211\254XpP?K\364\254Q\352"
+	.ascii	"\177\020i\315\267\"\324\204m\233\207 JO\256\035|\335TvB\265\206"
+	.ascii	"\031\204\254\b\345t^\242\245\216i<D\324\fZ\355\t%Q\250\274\256"
+	.ascii	"q\231\275\363\001\344\232\030\307\237\246\276\022\3072W\361\340"
+	.ascii	"\222\331\360\004\032\331+G\022A\240w\245 :\355\034A\024\330$"
+	.ascii	"\226\007T\357\336\231\237\334\254&\346\210j\315\032\243\322\262"
+	.ascii	"D\021U\226\242\230tE\252\311\317"
+	.string	"v\007%\370i\325%\007\374\335\210\303$\377\033\0135\226C\206k\343z\316e{\245\004N\203\021\352\365\345cFy8\266T\"\347\276\355=\236v\271\335\tn\3238+(\327\205\tL\275AN\277\270+\3247^\316j3!\300\327S\2438\242A\312P\374\205\237^E\274oz\262\244\361\2610\0205\020\254\234\360\b\013\023\232\231 Y\340fD\334\324'\204Z\243q\335b,\233Y\302\276]\342\247\303,3\255(\317:\017\374\226\200e\026\243>W\204\005\002\325L\365t\302\346Br\026)\321Y^\360\323&\320*x\021\360\022x\031\217\323\304)\326\347\373N\032\252I>\"\222\340d\020\240l-\337\300\217\301\326|\301.s&\274m\221o\214\276w\263=\315\236\031\330\352\3753\253g\262G\023\346\205\203\017\364\276;f\343\266E\020h$\305:\373\317\265i\034nl\031\260\237vb<\311\030\302\342E\215"
+	.string	"\306K\275\251\215\263\2239\362I\033\376\3274[\250\372\260\372\215d\265\230\237\334?\210\260\362\230`\334\\*\360>\237\371hY\332\243\032\332\222dz\206\273\224u\317\273"
+	.string	"\364?\366\020\003\222\340h\223\345\263\370s\006Rt\231,\370\374|&\204\n?\235\307C\313Op\261=y\267~v \013\251g\366\235\326\225JY\261\252\263\253\355\215\225Y\232\035F_n\tHC\nD\204\002F\310\314\343o\265\272\304R'b#P$\177\217\342/3!Wz\345\305z\367H.\033\321\\\242\267\315M\023\034\363\261i!\246\261\203\033\236D\221c\025\324\323<SNi\3668\371B\341\234\003\3248\265x\341\310n\331\244\257\221\322\350\"8\304]\273;\030"
+	.string	"\r\335\031a\263\217\304r\210\nP\007Y\232\030\034\372\340c\355"
+	.string	"a\271\350\366\211u\217\203\254\013\274e\325\fU6n\355\340?H(I\t\247d\024~|\257!\332v@\"'\"+\r\022\037\021\353\032\257\023k\331Vp7\022\272L@\326\001"
+	.string	"a\232\241\221\216\201\302\326\202\034\311\337\216\006\2200e\204j\306\243\265\210\224\360\001\272\324GO\020\263\030\260)\272\221\360-\361\271G\023'\265\305\375\006"
+	.string	"wtI\302\035j\203M\332NbU`\210Q\330\256\253\263\265\027\213\306\321\222\325\036\3534\262\352\366\226\207\013\364\345H\342\262Q\006\374\270k^\232H\275\300\350\327!\273M\305\315H\n\215\033\355\013#\035\024#~E\250!\002\262\215z\277\3644\251\264U\r\336\334\"\346\261\305\216a\025\226S\326,\\\344@\341\317Q,\030\312b\301\324H\001b\375R\214\027i\031\364\377\2627\213A\004w\3444\371\231N,K\204\262XKp\365\246\251\033\233L\260"
+	.ascii	"\022k\340\003\323\216Cb\3547\230@P\025\f\362*\"\326NP\326\224"
+	.ascii	"\355\251`-\305}\324\n\017]$_\210\013\342M\345~\311\334`\315Y"
+	.ascii	"=\356\003\0326\353\263J=\177\n\234o3z\211\n\244\\IE\223Ea\360"
+	.ascii	"\260\322\206\202WL\351\236\t\364}\\\006\213\316\3417\273U\341"
+	.ascii	"\317\t`\037\217\002\036\004\230\305\2460\f\310\332,\236\353\211"
+	.ascii	"\205Js\244\312\320j5\320b;\311\312\2660)l\361hW\236\335,Z\032"
+	.ascii	"\225\373\247\351\\\b\022b\200\270\"\240\336\3038o*O\216\320\007"
+	.ascii	"\022is3\230\263\210v\036\031\354\360*\242\373\214\217\327X\321"
+	.ascii	"\377?\300\236\247\025\226\256\270\241}\t.{N\256K\n\232\177Wl"
+	.ascii	"~(\317C\225\263\242\367-S\233\370\270u\375?h\300\305 bS\260\200"
+	.ascii	"\242\247\225!\017\3610u\250\276_\200l\316A7!9Z\016\215\b\361"
+	.ascii	"v\241\206U\277g.\\\2172L\243-\020\334\270\216"
+	.string	"\367\275\274\035L\3230\347\263x>\035\323 \001=D|\242\023\276\006\352\217'\324\212\372x\366\277\227j_/\203W\237\356My\331\336\352UO\312\366\263u\252\216\264\227\276\037\nU\253\242\246\263\204-\251\362\316\261\332\027\346\327\205n\343\342\201G\371\326C\tc\341\231\352\253\326l\260\254\244\b\025\355\345c#-PO\227Jaw\032\370\346v\023\220\232MU\311\206Q\022\324\264\305\364w\204\235\334\030>\202\214q\343\263\267\274\277\343\265\360\204r\210\201{\356\333\377?\004\276\235\201`(9\271>\272H:\322'\206\316\201\233a\230\3414c"
+	.ascii	"\3727\225\2101\223\357\203\241\325\025 \357rW\257|\\~p6\004\310"
+	.ascii	"T`6\002\251P\321\\a\b\244\311\237\321\220/\221j\254\233\202s"
+	.ascii	"\t\341\005\211\201\373\025b\254\202xJ\236aI\361\210\216\332!"
+	.ascii	"\361k\274\262\265a\335Y\223F\372'\t\034\013\235;\003\302V\344"
+	.ascii	"z\016r\346\260\017[\372QG]\224\243\260e\001\333\256\215\232\271"
+	.ascii	"\234\247\344\207y\301\337Q2\250lG\312\257%\304\210a K\025D\331"
+	.ascii	"w\354b\036\222"
+	.string	"\3634my@\237\016\243\034\313\035\221t\355)A\231\320\202\330e\310\001Z\020\334L\356\214\002z|\212y\267\036F\002y\r\202\361\233I|\311\003e.\tD\201ni\212\255\370\003H\234\021\334\364\310o\315\215e\357\021\367\030\375\361x\3620\227c\304\030\n\013\004\300\314\263\222\n\255\232_$\177\270\036\023\006\350\253]gM\243(0\017\0078R\367\2112\331\262k+\013b\331\303<\321Rj$B\327\303,\346u\377B\207?L\321\177\362\313\227\226\347\324B]\222U\245\325\035\001\244\001\305\265\341U\212\242\305I\203\017\n\004U\253\236[:\030\324\266\364\314\"\321\321]]\245\243\332\213\224\034\347f)Q\267_#0\311.\016/P['\267\037\300+\177m\003\243G\001\310\217\005\\\254\347i\337\375\260x\227\211[}j\253\033\225_\3467\004,\3574\024\214\267~L`\302\204\322\"\347\334\233\333T\253\233"
+	.string	"\200TL\311\036\344\277\233\346\305\302\005H@\034\325\232f\032\341\271\315\033y\351de\0368\321\023\271\226\341\345\215\370\223\330\036R\b3!2\363Y\212\312\214\026X#l\n\023hk"
+	.string	".\024=~T/P\253\205\257xL8)i\261M{\203\017JTH\231\022\035\314#\363\314\340*YX\276?\206\n\340\340?w\354\343\331o`,\247\200?Egmq'\307\246\220\302)\305Xe\020\321\360+B~.\202\336/b\017#\202;'\220\316\001P_' Ok/d\353\320\367"
+	.string	"5\257=\314\007iP\022\300~-\275:\315\376-c\300\342^C\332\n3\322\203;\235\177\216\020\225\353\327;a\212\252\3105"
+	.string	"_\242?\325^H\003b\030l\317~t\305(F\201S#z!\225{\317\020/\372K\257\245\224\2145\310\3626\224\233\002\373\304\3172\034k\303qeS\223\021}\340\2535\333D1\326B\331\374\201D\335_\tdft(N\202\325qcOIw(3\334\303\036\0033\212`&9N\321\320\365F\r\213\370\t\325n\351\003T\331\326\007\310@~\254D$\275\021\344V\361\330\031c\001\022+\341\345\004(\362\271B\274Kx\020\214*r.\220(\247;\301\240\020\263\305\326hjn\032q\252c)!\303&zbB\265x\354\320\313D\031q\272\034k"
+	.string	"\2105\251\331\007\351B\026\203\320\373p\237\017gP\330\361=\347f!\0063Kc9\274\027\266L\037\221\254\233^\205?\271>\336\362\331\246\022\2133\005g~$u\017N\345T\205\220\013\337<\366\203U@\017\353(c\333h\231\031\220\250\323r\032\"So\303'\260!@\245\244Z\235\r\250\214GVg\366\f\311\n}\240m\341\311b$QT\251>\305E;c7\256E&\265\361\237\224#\257M\260(+ns\017zt\250\304\265\345\325\244\327{\314\221\244\201\340d\236"
+	.string	"\370Z\363\332\b\247\034\005\250\304].d\351n\331\023S\326@\374\327\250\335\362@c \251\001\221\275\221$\b\216\234\031\233U;1\312\311r}\016\b\347\266\231\353$\361`\005T}\231\374\343\b\345\031\035&\177.\2219\251r\302\034K@[\0173\307\022\325\nMX#\361\001O\341\3407Q!D=\326\303\240\246\362\226\245\354\036B\231X\303^\227\340%H\337\204\352\226B\006_\211\251\334\361\365dV\037dNY\332\347\353\257\035\305_\222\005\361uN\241'<\260s\235K\207\022\235R\022T\350\223\316\b\033\277\tt\353\032\335\312Z6\214\256;3\351\001\244\242\341\353\267\nR\365\204\340B2\rEP\t\352i&\267\204\267p\272\346"
+	.ascii	"S\354\256\315\364\366\035\325\260\340$S\t\210\337\"\321\300\311"
+	.ascii	"\2478t\241\323\0308>h\t\307O\224\362/\226\254\177vx;\254\311"
+	.ascii	"|\236\030\267E"
+	.string	"\204\320\310\242\350`'\344p\276\370L\350H.\362/\275Ib:\221\303\2342\016\202\344\335\305\223\243G9}c>\367\345\254\177\275o VU\t\300\005\302\234\007\247;\253]\007\020\366\303\371\362\007\311\201\026\340j\327\277r\343,\216\222:>\214\302Wb`\324k\353G\247*o<1>\225\24450\004\360\375\241\004\2178\236\311~\221n\354-\0174zO~A\315\363I\363\002l|\002\027\217\205\316\302\036\273\227\373z\256\237n|\360\322\255\007r_\313\337<\3609\334\207\013;\357\274l\372\n\366\341c]\253\300\217 \0231\373\b:\362\377\236\311\237\341;\353o\020/\276\377'\237\\xj\257\304\374)\031\026\013Z\343\3521\3776\231\223\231\356\3729\317\207#\366\033Nj+\234\215\330\354\213\202\336\234\255\3569vk\375\"\347\256\273\333B\363U\323\1776\2542\253}\364\024M\331\212\036$.\f\247M"
+	.ascii	"\037\030\362\177\337\035F\177\005\337\321\363\013\272\251bg\313"
+	.ascii	"!'\331,\017\247\f= \340\r@\265a\216fX\377\364w\0079\257m\320"
+	.ascii	"A\355\277\365\2625!\232Zeg\020\377\255\353\004=*\260\312G'\311"
+	.ascii	"\210\253\267Z7\226k\030\326\245ki\301\007\214$\251S\261m\352"
+	.ascii	"\324\t\301\333\nG\300z\300m6E\376\0172\035\336\263?<\243vX\201"
+	.ascii	"\017+'_\374\371\215\007\330\004\273\212\013|t\"s,\204\201\320"
+	.ascii	"\245\340\217\351^\020xk\275Y\214\247\001~;\f\\\344\251\027\303"
+	.ascii	"}3\333\272\200\367\361.\370mt\260u\005"
+	.text
+	.section	.gnu.lto_.symtab.25da401d0df9f5bc,"e",@progbits
+	.string	"gyroInitFilters"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\003"
+	.string	""
+	.string	"gyroInitSensor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\003"
+	.string	""
+	.string	"gyroPreInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\003"
+	.string	""
+	.string	"gyroInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\003"
+	.string	""
+	.string	"getGyroDetectionFlags"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\003"
+	.string	""
+	.string	"gyroSetTargetLooptime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\003"
+	.string	""
+	.string	"gyroSensorBus"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\003"
+	.string	""
+	.string	"gyroMpuDetectionResult"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\003"
+	.string	""
+	.string	"gyroRateDps"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\003"
+	.string	""
+	.string	"gyroReadRegister"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\003"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\002"
+	.string	""
+	.string	"gyroConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\003"
+	.string	""
+	.string	"nullFilterBankApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	""
+	.string	"pt1FilterBankApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\003"
+	.string	""
+	.string	"biquadFilterBankApplyDF1"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\003"
+	.string	""
+	.string	"biquadFilterBankApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\003"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\003"
+	.string	""
+	.string	"gyroDeviceConfig_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\003"
+	.string	""
+	.string	"detectedSensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\003"
+	.string	""
+	.string	"activePidLoopDenom"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\003"
+	.string	""
+	.string	"biquadFilterBankInitLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\003"
+	.string	""
+	.string	"pt1FilterBankInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\003"
+	.string	""
+	.string	"pt1FilterGain"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\003"
+	.string	""
+	.string	"biquadFilterBankInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\003"
+	.string	""
+	.string	"filterGetNotchQ"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\003"
+	.string	""
+	.string	"biquadFilterBankInitPassthrough"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\003"
+	.string	""
+	.string	"sensorsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\003"
+	.string	""
+	.string	"fakeGyroDetect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\003"
+	.string	""
+	.string	"gyroInitFilterFn"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\003"
+	.string	""
+	.string	"gyroSetSampleRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\003"
+	.string	""
+	.string	"buildRotationMatrixFromAlignment"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\003"
+	.string	""
+	.string	"writeEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\003"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\003"
+	.string	""
+	.string	"mpuGyroReadRegister"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.25da401d0df9f5bc,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
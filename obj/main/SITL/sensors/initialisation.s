@@ -0,0 +1,605 @@
+	.file	"initialisation.c"
+	.section	.gnu.lto_.profile.c0e7cdbc2c8f0699,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.c0e7cdbc2c8f0699,"e",@progbits
+	.string	"(\265/\375 0m\001"
+	.string	"d\002$"
+	.string	"\004"
+	.string	"\304\225\207\302\002"
+	.string	"\001\222\320\347\320\005\004\002"
+	.string	"\002\001\002\002\002\003\005\247\243\326\333\005\006\247\243\326\333\005"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.c0e7cdbc2c8f0699,"e",@progbits
+	.string	"(\265/\375 \"\325"
+	.string	""
+	.string	"\220\026"
+	.string	"\002"
+	.string	""
+	.string	"\001\001"
+	.string	"\003"
+	.string	"\001"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\271A6\200\005"
+	.text
+	.section	.gnu.lto_.inline.c0e7cdbc2c8f0699,"e",@progbits
+	.string	"(\265/\375 \210\255\002"
+	.string	"\264\003|"
+	.string	"\002"
+	.string	""
+	.string	"\006\200\200\200\200\002h\001\201\200\200\200~d\002"
+	.string	""
+	.string	"\001\n"
+	.string	"\017\217\205\327\317\b\224\334\236\252\003d\003\f"
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\220N\002\013\220N"
+	.string	"\002\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t"
+	.ascii	"O\004L\204\f\001d\262\032J\312\020\233\f\337|\032\246\360\033"
+	.ascii	"\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.c0e7cdbc2c8f0699,"e",@progbits
+	.string	"(\265/\375 ]E\002"
+	.string	"\204\003Q"
+	.string	"\002"
+	.string	"\001"
+	.string	""
+	.string	"\004\0036"
+	.string	"wus"
+	.string	""
+	.string	""
+	.string	"\001\300\004\001"
+	.string	"\300\004\002x"
+	.string	"\001\002\006q\001\001\006q\001\177\001\377\001\001\002\006(\001"
+	.string	"\006(\001\377\001\377\003"
+	.string	""
+	.string	""
+	.string	"\005"
+	.string	"<\005\f8\250\344\254\007.\336"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.pureconst.c0e7cdbc2c8f0699,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\230\004\001\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.c0e7cdbc2c8f0699,"e",@progbits
+	.string	"(\265/\375 .\r\001"
+	.string	"\270\""
+	.string	"\002"
+	.string	"\001\002\002\b"
+	.string	"\001\002\t\001"
+	.string	"\002\n\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	",A\200\2027\200\005"
+	.text
+	.section	.gnu.lto_.lto.c0e7cdbc2c8f0699,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_sensorsPreInit.46.c0e7cdbc2c8f0699,"e",@progbits
+	.string	"(\265/\375 \372e\006"
+	.string	"\022\213*3pi\323\001\2002=\f\360\351\b0\370\252U\324\304\217\352\036)&!\302\2301\232\\\365wg*\242\376\037\275u\224o\255\2307\273!\002\331\267f\345\226)\227 9#\025\325\230\211\"\025e\204\225\316*\247\ne\2144P\242\025B\224\317\315D!5'\205\317\326\313\032&\343\b\370\002\350\002\226\202\337/0\360\026;$\202\273\330\3727\353\361\302\277\214f\355w*\006\221\212n\204\213\2569\007\242\341\377>\257\376\tI\301C\342\340\301\242\273!3l\265\257\372\256\303:\260\314\332\327\270t\367\037\226%\354y\377O\376[\376+\004\r"
+	.string	"3\001;8\243\306W\240\035\300\f\224"
+	.ascii	"\207\321l\314\205|\025l\277\214\033.\307\242\235d"
+	.text
+	.section	.gnu.lto_sensorsAutodetect.47.c0e7cdbc2c8f0699,"e",@progbits
+	.string	"(\265/\375`^\001\035\017"
+	.string	"\206\334fE\360\222(\035\262R\336\211\023uy\361|\306i\246\217\360\350xK\375N\237\247\b\300\273\376\331\b\314\347\267\375e\210V\371\001\2565G\331>\200\237%Z\004\323\237e\355\032\360\305bz\3438\027\305Eo\367\2262\245S"
+	.string	"O"
+	.string	"Q"
+	.string	"g\225HL\340T\231\224\300a!\270\264\202\354\322&\013X\\:(\243\372\313\3272\003gNP[\025/=\256\226\374\267\036a\230\310\371V\246G\022\337x |\001\031Y\245\242"
+	.ascii	"\025\213\357\255\253\313\n\245\n\240\301\234\323\372\255F\334"
+	.ascii	"\362\266'\330f"
+	.string	"`\337&'\315\271L\220P\307n\214_\352dK@\304\217\032\037)\r\342L\355\017\236\376\313\3660\027a,D\255\311\006Q\2721\366\343\\\030\373\254;\223\352\030\325\273jU\365EFR\2408\361\342\262=\300\251\312\0212arG\213\263~\233\305o\331\023v\005\013!\326\344\335\270\t.\334\006C6g\352\304\257q\033\0314\244\244t.w=4<bl\360\224\306\013\026\003\250\256\375\001\351?\223\244\326\344\257\356]-C\274\275F%\233s\236\3704\227\301\371+.\335!\244\377.\375P\347\362+_\256\330L\0346\022h#m\017\272\021\b\025\021\203JD\035G\372x\234\207\017G\342D\234\346\215:O\264y\232\210\373\2044\320\310\323J\f\270[\331F\032\251\353F\232\007<=\316\205\311v\345E\030\013O\213r\001\215\373\231\347p\2407s\236\376\331\020\216#\302\200\233\033wI\240\200\202\322\271\f\033"
+	.ascii	"2\241\237)\360\022(\336\365\002\330\f\004\006fY\3627\264\003"
+	.ascii	"\274\np\203l8,@Lc\243+M\354n^\270Q\251\232\306*\322\034s\211"
+	.ascii	"k\242\360,v\304\004H\024\321\241\"\216\273lU\243S4\265\007"
+	.text
+	.section	.gnu.lto_.symbol_nodes.c0e7cdbc2c8f0699,"e",@progbits
+	.string	"(\265/\375`c"
+	.string	"5\005"
+	.string	"4\007_\001"
+	.string	""
+	.string	""
+	.string	"\002.\177\013\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002/\177\f\0054\r "
+	.string	""
+	.string	""
+	.string	"\0059\0168\005-\017\201\204\005,\020\0012\177\021\377\037"
+	.string	""
+	.string	"\200\200\200\0011\177\0220\177\0237\177\0246\177\0255\177\0263\177\027\003"
+	.string	"\t$\003"
+	.string	"\bD\003"
+	.string	"\007d\003\001\r$\003\001\f\320\360\372\250\001\001\244\001\003\001\304\001\003\001\n\244\006"
+	.string	"\025"
+	.string	"W\207\226\264\262\002\203\200AZ\203X\254a\200z"
+	.string	"p"
+	.string	"p"
+	.string	"p"
+	.string	"p\370"
+	.string	"\351p\251\207\005\303\345\307\032\027\205\310\340\260J\213"
+	.ascii	"\r\227\235c"
+	.text
+	.section	.gnu.lto_.refs.c0e7cdbc2c8f0699,"e",@progbits
+	.string	"(\265/\375 \023\231"
+	.string	""
+	.string	"\017"
+	.string	""
+	.string	""
+	.string	"\003\001"
+	.string	"\002\003"
+	.string	""
+	.string	"\003\007"
+	.string	"\002\004\t"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.c0e7cdbc2c8f0699,"e",@progbits
+	.string	"(\265/\375`\3348=\366"
+	.ascii	"\252wITX0\nIJ\035\253\264\2365\366eu \376\217\316\266Ue\005\214"
+	.ascii	"\340\361\365[rv3z\370\337\336]\360\267\263\256\032\tSg\021l;"
+	.ascii	"xt\326B_\370V\003\313up\214\002\244\024\315\230\330l\241\037"
+	.ascii	"\206\013 \363\276p\016\230a)6OC\347\337\242Ci\267\224R\312\024"
+	.ascii	"\327\004<\0058\005\316\276\202\246\007\326\017\247\236\013\027"
+	.ascii	"|6\322\302r\244\372g\232\374?\313\3101b(\223\210\331O\236\336"
+	.ascii	"v`\235\2372\013-):\035\326?s\305\177F\212\377\314\023\377\231"
+	.ascii	"\025\374g\212r\323\r\331\024\030\327\227\274\224\251\343/\263"
+	.ascii	"\205\337\036\031,\374e\246\360\227Q\343\312\214\204k\320\304"
+	.ascii	"\240x\201u6\312G\367\371N2\n\031#g\177^=A^)\341&|\357$}\031/"
+	.ascii	"\376\321\253\223f\344?\336\303jX\357\372\234\232\fIk\3624\f\026"
+	.ascii	"s\237\024\360\230kgU\324d\305C\320\373\245\220\336\275\275K!"
+	.ascii	"}\031(\235\264\204\262\033\0264\310d\220\370o\220\303ty\310\222"
+	.ascii	"\033\301\301#\332\273\323\013\306\273O|\207\271\224\335\341("
+	.ascii	"\356\222dA\301]]\025\230\274\336\235\027z.\330\030\311\013\363"
+	.ascii	"\"\325u\330\356F\305\016$\035fu`\374\371\325\034\336\202\235"
+	.ascii	"\212\344\3404\346\370\013\376\274\b\013\216\273P<0I^\260h\301"
+	.ascii	"oN%P\254H\201\372\320\370\365\215\361\367q\361\367\351\340\357"
+	.ascii	"{\342=>%\307P\364\213\266\033<\260~_\347\237\332q\013\227'\325"
+	.ascii	"pyR\334\344\306\215\207\232\022(f\242\206\326s\265\216\302\264"
+	.ascii	"\304\270\222\373\304g\370\310kg\357F\370\f#\301I\256[Y\357M\026"
+	.ascii	"t-\273D\345]\2703\330\212\250h\215\223`\263K'\203\226\305i\013"
+	.ascii	"\353Oo\360O\233\370\247I\216\231\227'\245\200Y\307\177g\3416"
+	.ascii	"\316\265\253\223j7$W'\275hm|\202\323\352\352\244\330\r{\005)"
+	.ascii	"s.Qb\335\225\253h\315x\302\204sa i\020.EK3\376\373\213ga-\037"
+	.ascii	"\\\210\320\220BB\226\017m\026\303\212\352\357\036\373\330V\264"
+	.ascii	"x\030\301\3727\025\337\313\315\304\177w\276\231Z\013O\257(\310"
+	.ascii	"4\021\202$K\215\377\006\\\205g`\252\353V\246\243P\211\342*|\003"
+	.ascii	"#\375\214\234\035\371[\352P\274<\034\330\352>q\025\266A!\207"
+	.ascii	"!\253\021w\305_\273\340S3UKYR\260~}\304q\r\034\365gks\270\006"
+	.ascii	"\206\222\303R\230y\237\270\006\246\361\027\017\313\270p\241'"
+	.ascii	"M\312\3624&\325\257\213\370\347.\374\363\026\376y\n\277=\237"
+	.ascii	"\361\224\231\275\370g\036\334\267\274:)fa\243\205\306\206%\006"
+	.ascii	"wj\262\313\322\305m\371\270\351\351jz\377\352\275W\260\261\352"
+	.ascii	"\212\313\2025N\201Wd\272\"lqX\377\343\025\230)K5Y\225\200\365"
+	.ascii	"R\376\222,\312\303\372\263\022\177b%\254\342\235\275w\255\262"
+	.ascii	"%\247=\376w\257\344\377e8\226Z\322\0179\316\373\325I1\212\036"
+	.ascii	"\032\033QWO\326\270\227\2730>y_\272\210\361\371\222\327\344\022"
+	.ascii	"\325#\373\277uvc6"
+	.string	"\374\337,a.\335\317\b\247w*e3\355\377\312\315]\272\237L\357\311\275f\357}\357\352a$\356\270\b\037]1\330\b'\357\363\216\271`\376\302],\257\235\177\277\376/\336\035sK\270t\025\222zO\316\030\300S\217\305\222\274\336\373\205\236\013\272\305[\027\325\216~\274\203?\226\301\037\303\340\217[\360\307M\034\207\211O\240\202?Vr\r\370\210\277\363\322\375_-\227\354\3170\263w\243\336{\004\230J]T\036\326\267\314\347\357\026\235t\371\344\3547\031M\r\205\030\254\037'u\322\232;\236\272\315]\235\224/\357\025\376\227\215\377M\302y4\357f\361\333\206\257\224;\345o\333e\2531\272m\272\367\344\275\005\370\335[\200\355dG\222H\252\377\356\340\177\237\356\232\357\213\212\267*\235_'W\355>\357\223\377\313\344\246\275\026c\366g\357N\233\234|\321v\206\365_\013\351\315\265\220\276\221\353\253\223N\260\362\317"
+	.ascii	"\177\264#\027\311}Vp\223\374-\273f\277\223\316\356\304:\306\230"
+	.ascii	"\021\301\372A\340\177+H\363\336\336\255 \375\0168\316\345I\261"
+	.ascii	"\333\345I\357\220+"
+	.string	"v\237\022\334\"\377\203\301g\244X\377\352\335yc\243\327\245\027\006\353\317\200\377%\362\002\260\3221x\035\376W\202\364\356]\t\322\307\\\246G/O\372\177\205\374_\257\373UAV*1{Y\357\316\034n\304\344\310\027\326\357\274<)\277:\351\177\376'\031'\337\374c\027\377\371\227m\322\232\177\354\201L\363\217\2413\377\370\313\377W\370\177\021\376?\001/\345\377'\370\337f\327\347\376|\372\277\211\374g\231\377\354\373\317\371?\337\177\\\302?\276\373\307]\376q\335?\246\373\307q\377\030\356\037\277\375\343*\377\270\355\377\223\374c\266\177\f\345\037\247\375\343\265\177\\\366\217c\374\343\020\374c\020\374\377\327\377\367\374?\333\377\347\275\275\275\275\377\273\363_#\364oA\210:\370\347\260\340\237\203\304\317t\017';/0:\211\346\241\217\344!\313\t@\227\224h$\367\251\223\350\035\217\205`0\235\004\027\321$x@\261\344"
+	.string	"\252\024\355\271p\243\204b\341\224j#4Q\260(\321\210\343\177\277\306t\221\214D\245\034\323XZ,\310^tL\023\271t\031\334\240x\\f\272L\223\335\247\036\323\317\307C\260\230\001\320\232N\256\037g\215?\316\030\177\0341\256\305\376u\017\335\324C0\223-\354\t\rk\247\230\242.XX?N\020\376\033\266f\240i\375Y\036\262\004@\n\250\212\256w2F\245\024\375\312\372\2635/\264\336\273\020\035D\177i0\035v\237\332K\377x\rDs\275\366\322>\376\354\350i\001V\263K\224/\312\312\032Z\215~\234\037\374\356\360\340\217\203\203?\016\223?N\f\3768N\374q\230xv"
+	.ascii	"N\222\377\315\035\357\352\361\200\223\267&dEY\311\001\b\036k"
+	.ascii	"Jq\351\200 \247H9\253\300\341,@\252\244a\266!Y\262\212?;\032"
+	.ascii	"b\301\326\2235\034\205\214*\t\006Tn[v6}cTfQ,\245\r\247\027A\217"
+	.ascii	"4{w\266\3209\364\f\375B3\265\r]\245\247\264\225\246\32254\013"
+	.ascii	"\215C;i\031\232\206\326\241\237\364\225\276\241\233\264\013\035"
+	.ascii	"\245ch(\r\343>\265\024\006\362\230\b~~\017V\273T\356\030\207"
+	.ascii	".2-\205\335n\333u{\352\310:\n\272\220_I\262\223\025P\022\264"
+	.ascii	"T\356\031\231\235h\034Pyy\221\222\253PY\260Ef\004/\351,(\360"
+	.ascii	"B\202a0X/;\3218\022\325W\235Zf\363\200b)\303\004\325\221\223"
+	.ascii	"Z*']\272<d\271\001\264K*\277\351%\207-\244\036X\036&K\303N\234"
+	.ascii	"4t\325\351\201\345Ie\260\214d\312\001[K\364\300\362\314\376\261"
+	.ascii	"S\352\276]%\327\315\252'\221\036\274\244\364\300\362\310\264"
+	.ascii	"\024\266\202\257@\3036Ha-8/\017Y\3120\021\021\022\325R\231)\013"
+	.ascii	"\351N\024lU\321\003\313\373\251%\201\231\321A\353\02576p$\257"
+	.ascii	"`\3757a\374J\236\313\316\346\006ELQ\025\232I+\335\247^z\275\224"
+	.ascii	"\267h\244\007\024K\013\024-E\365\222N\361R*\024){RJ\003\326\027"
+	.ascii	"0\\z\314\nJ\r\256\377\306\210?V\373B\341\272Ye\340\343H\232^"
+	.ascii	"WT#3]\316\253P\244\244\300\032\222(^\230w2U\326\034\023$*\306"
+	.ascii	"\002\332\227F\346"
+	.ascii	"\275wb\304\203+\232\246\221\031\f\205_\322\331\227\351\325\025"
+	.ascii	"^Z\236F\322I:\251Qh#}\244\225\272\350>5R\367=V$/\314\004\375"
+	.ascii	"\2770\376?.\376\277&\377\237\025\377_\r\376\277'\376\277%\377"
+	.ascii	"\037\212\0220\222\213\225\025w\334K\276\273\317\214\227\243\\"
+	.ascii	"\262\235\215-M\274\334%\333M\330\222E\016/+\221\363RD\313\356"
+	.ascii	"\353h\364\204\320\320\303\272.G\177`=\224l`\3756P\374m\\\360"
+	.ascii	"\267a\342o\203\304?\317\375g+\031\232\3458\260\315\222\330\220"
+	.ascii	"\260\316Y\262\226\317r9\256g9\016\314\336\223Y\356FL\357\311"
+	.ascii	"\233{\013po\001t\020\252\036FR\3756I\236\341|>c9\262Rr\302\272"
+	.ascii	"\202\2320\374k\3608\266pu\322\354f\334\242\223r\313T\362\224"
+	.ascii	"\034\321,\315\334\366y\nR\356\b\026(Pr\2245\231-\027fsD\240\254"
+	.ascii	"\311\300})\301{\362y-\337EU\355@\273aO.\316\276r\223\253\025"
+	.ascii	"\246\013\332\024g\222\323|F_\304\246,\371\234v\333\256\027\035"
+	.ascii	"\264\004\254\363YF\343\315\025\310#4\256\23356=\031Jd\352\256"
+	.ascii	"P\261R\202\365n`)\361\302\372kZp\261\236Lf\324\205\265\221\373"
+	.ascii	"\314GrX\331\221\354\314ffK\302\354\362jz\322\227%\332\254\354"
+	.ascii	"21E\225Xg2\031)-\\@\271R\344>\363\230\005\251,'\254\377.?1\216"
+	.ascii	"+\\\300\344\347g\"\313N\026\003k1\037]\223\0251&yH\016\223J\276"
+	.ascii	"5\241\361\247\001\343O\323\365\205\345\204\300\030\333\301\273"
+	.ascii	"r\220\373\314^\231\305g\245\274\364=^yEvj\362e\251\363\312-2"
+	.ascii	"\220\353\366\204\323\215\350\306D/\\\270cjzv\251\266\312Zs\315"
+	.ascii	"\037y+s\335g\006\362\031Hv\221\243~\310\234\336\253\3044\201"
+	.ascii	"\344\032\271\312)\345\202\374\341\224G\341\302\005\032\245\033"
+	.ascii	"4\220\\\373\310Y\367\231\2652\026\t\271y\335\236\234\335\351"
+	.ascii	"wD\352\207S\236V\276\312:*\024);h\"\027\345Lr4\271J\365\323H"
+	.ascii	"5?\367H:\313\302\262#\363\230q\361\344\326\304\005\337\361\227"
+	.ascii	"\t\353\210M\351\267\344\034O\247C\312\013!X?\r\022\177\232\316"
+	.ascii	"\177F\f\377\r\271*33\210)"
+	.string	"t\321\336\373\215\214\343>sU\266Qu\335\236\034\020\205K\364\327#\313KH\224k Fdmy*Ku\033\033:\032N\264\340\370\317P\341?\303\226\2412\215\373\314QyF\217\263w$Q\031F\226Q\241H\351A\024\230\373\365\203A\216\312/\356\330\017\031=XI\0137B\240\262\260\221\300\177s\271\273\256n\317}\356=\251\245\351\353\221\324\2025c\317\335M\367\334t{\356:;2\335\341c\371\264\200\231\236\305\204\005\353\217@\005\337s8\202\243\nf\230L\342\366\334\377\226\303O\356\330uz2\325\003\353\315\304\347\267\026m\003o\205\217\035\367\367\271\343\366\024,\326\221\277$i^\321\232 @\244V\320\301\375}n\270-%+\231\275\311\001L\256\035\324.\013\024\272\337v\260\246d\200d\335\350\332oXYTJO\370o*\333\355w\225\257\202}\360\336\373M\222\326\245I^\177z\262\240\365\306T"
+	.string	"\200\212\377\343\377\264'\227\275w\247\355\354\313\242\232\277\373^\013\37767_\003\364\376\377\032\330@\357GW\254\274\360\254\263\344\f\254\373\277[\357FS\310\f\246\232\214\246`(\237S\035i\304\003\231\263\354SH\345\263\367\234nd\204\004\301\3549\312go\352GV\232nwN!\273\021\263\347t\243\236\234@i4\325\244|&\233r\224\317\251\246\376\234\3528\335(\271L2\352\313\234\376\234\252\353Of\023\216\362\311lR>\247\244\334\024)\354~\270x\263\322\021v\253(\215:\323\022Tr\211\343\246t2{\\\357\267\fE_\032\240w(\3462.\t\343\242\025\2711\025!I2\257s\251\210\212\331\215\334\224Z\314\336\265\212\204\372\022\007\244\323\255_]7\244\r\250\256\204\242\367"
+	.ascii	"tg\357K\275#ow\353\275#{\357\276%\224\263w\0318\312\346\322R"
+	.ascii	"\357O=K\035\n\271\004E\357\270L\013Z\223\362I\305\364Y2\366l"
+	.ascii	"v$'\3626{\334\324\222?\221C\272R\027\336lba\207u[\215\223\271"
+	.ascii	"\"S\346\370\2261\003M\311\225(f3W\332\274\230F\376>\267\221\275"
+	.ascii	"\226\225\274\033\201\351E{\177Z\200\315\227 7\260\260~\322\001"
+	.ascii	")\264'S\370_\262$\031i\nLSNIF\n\362%m\253m'\233\311}\356&\033"
+	.ascii	"\355\367\221\215d7\331g\333\254B\221R\203\345Ew\223\275$#\365"
+	.ascii	"\360\341\025\335Uho\311\031\375<K\370\363\030\341\3173\306\237"
+	.ascii	"\007\214?\017\017\236\306\361\\\225\325<\001\033\203\304\372"
+	.ascii	"yj\360\257\r\266\211l\347\026\333C\266\220=\266\303v\221\375"
+	.ascii	"\274\317M\266\241~\373\330Y\337C\306c\215l7o[ze\005K\224M\266"
+	.ascii	"\261\262\020\344\314\325\024\226(\\l\2645\353tl*\266\246\027"
+	.ascii	"\022\242DoH\211\342\221\355\036gQ.36\325\332\024/;v\216\nE\312"
+	.ascii	"\016\324\240D\3456\331\326\332^vX\242\344&1\263\256\036\275\203"
+	.ascii	"\334\267e\021<\267\335\265\271l\310\330d$7\220\337\\5x(\304\030"
+	.ascii	"\301z\377\330[T\306T%\267l\300\232X\324\266>#\341\036L=\356\324"
+	.ascii	"\370v\256\355\234\361\337\031\302\177\207\213\377N\017\376;U"
+	.ascii	"\374w\242\370\357\300\330W8|\ba\272H\332V\033\007\3171\245C\307"
+	.ascii	"\256\372\215\243\002\223\016\257\235\316_'oO1kT(\305|\311\262"
+	.ascii	"\2456\023k\335-\341\3325~3q\227-8\350v\324\f\236\223\325\227"
+	.ascii	"\035\265i\\\271*oy\233\306\206\"K&\213\260~\035*\374u\326\370"
+	.ascii	"\377\226\261[\330AqB\236\025\305)\357\030[\023I\312\023\024m"
+	.ascii	"\327,\tG\211"
+	.string	"\322\334\313\335\264c\354\025\333i\277\3300\366\323v\261\2316\213\373\334-\266\322\357\245\013\366X\305\032V;\272cS\232I\034\345\227{\217\312\322\334\035\211\243\004\321\262[l\243\f\276\250\370\354\026;\205O\207\223W4\235\232\002\305\353\321?\235*\376:1\370\353$\361\237 \206\377\2049\376\023\330\370OH\302\177\202\027\377\t$\360\237\300\344?\201\005\377\tG\374\343\364\236\0047\316\027K6\264\336\f\024\225-uX\377\206\234\224\025\205\342\345\271\200\201[\020Ykbe\222\327\227\232^##B#\352\003\227\345\006\305\313\243\322\204\342\351%;\242;x\230]\271q:\312U\362K\342t\243\242\031M\037\rE\257mpB\361\270\252\300=\240C\361\270\310\214\324\351\264\255\246\027&L\027/0\322\004^K(\236\233\2250&\024oG\2173\270\213\266d\t\305\313\253\002\r[\342\257\327p8L\243y@\261\224"
+	.ascii	"\221\036\321\037\330k\002 L(^^\2240\247\233\256\323r\232\212"
+	.ascii	"\236\242\261\350<\275Ek\321v\372N\207\321tZ\214\276\242\255h"
+	.ascii	"<=\247\337t\234\316\242K\320Q\315EW\321P=F\177\321`t\027\355"
+	.ascii	"\345>5\234f{-E\267\341\247\327p8\006\316\221\207,+@\225$\332"
+	.ascii	"\304\302[\034\200\240A\361\340\264\223-\254\003\016\223\200["
+	.ascii	"X\350rB\361\362\274\350&\030,\241x\\`\316+L\3150\270\273\344"
+	.ascii	"\216\335PF\3034\334mr\241p\bC\203\342q+\321\027A2\320o\326/O"
+	.ascii	"*\263\314\321\343\237S\307?\307\212"
+	.string	"\005\375D\006\256\013\2152\254?\007\n\377\034#\374s\206\360\317\331\342\237\023\255\220\350\301\013\r\327`\020h\200`\020\350\243\231y!\f*\001^\b\203\004C\305\340\217]\217\036X\2158l\320z\363\367\336\337Ck\313\236\b\001"
+	.string	":\250\330\0365\310y\nVc\b\366\203B\343J\\G\360\347\320\341\202\016\036L\370\336C\00344@C\372\036\032\340\343\323\200\016>\374;\370\3446\247mW\3431\004\253\246$\326\240\334\0165(\032\201\020\360\211\240\333\027\302\360agm\201\303cp\b\f\312\244j\320J\024\002\r\025\2036\355\221\237"
+	.ascii	"\016\327 \225\350\310\333\266%\262\200\215\021\330\262\234\350"
+	.ascii	"\250\372V\016d\210\216j\273\216H_\b\003\001Xu\204P\004\261\370"
+	.ascii	"\301\270\266\353\320\r\221\r\252B\"\366F\r\376\bqrXa\221\370"
+	.ascii	"\033\256$T\021A\232`q\255\031\001lU\3430hB-\032\201@6\254\232"
+	.ascii	"\2625\355:\302\bl\177\353\220"
+	.string	"\260%*\026)\360\023\361\001\204\006\037h\206\216!\310\004\255C  1\002,\261D1(\002\237v\004Q\270\202\300\256\303\340\211\340\r\253~\310\031:\262\271%\252C\231mY\337\007\037\224X\211A\303\242:\224\206Pb%\252C\251\021H\"\033\201\204C`\220\206}!\f\bhoT\337\013ah\203Gc\313\376\260\252\211\265=\016\345\020\217\305\240\252\372\214+\261DQU}\254qe\217DU\345AD\341\b\252\232\262D!\021\253\252>bQ\310\n\207\253\252\312\264*\316\005A\253\021(\304^\220\201m\205@\031\216\304\021\027\2308\022\205\303\0138tP;x0\221a\r:\016\203Da\006#{\314\300\200\326\304J\034\002\211\306\265%\nU\241\226HU# \261\032\211T5mY\341PUSUM\215@\241\240^? dU5\035!X\034\352VH\364\200\207\270A\020p5\246\3066D\220x\334"
+	.ascii	"\330\002AP n"
+	.string	"`\363B\030\214\3530\210\b\354@\247%\212\300\254\032\\A\030!\b\004\032\016\201\037r\204\255\211U\267\254*$\nA\304\nB\365 D\b4k\220\blY\242\220\267\252\005<\320Da\b\"\033L\205Dlf\325\017?\036\320|\370\361@&\r\376\b\363\021\210\002\253~\020\204c\\[\0268\224\262\354j\f\n\002\372V\022\300!?\252$\326 \366\b\304Yu\r\nI\254 \330#\020\315\252\256D'D`\217@2+\321\211\226=\002\371\330#P^\207\300 \273\213\306\025\003\334\327\252?\033\330cQHb5\206\230P\002\b\302\007\020\032\314\370V\343\261\005\032W\242\241\265\245i_\b\303\221hH\r\006\201\031X\343JBh\fR\300\252\202\240\001\003\r\035\216DC:\307a\221]\2153\254\272\263\252G\242!\232\264\035\036\331\025\204u\302\252\002\325\037q\204p\250\201j\363\201\016&p\"\b\270\202"
+	.string	"l\201A2FV\204*4B(\244\212 \032\326\210 \032\252\037\020\032\341g\203*4\201%*\032A\030\327 !\t!\210#\321\320M\253\216"
+	.string	"\212P\024\372F"
+	.string	"E\020\266&\"\320\022=8\022\r\331\254\352o5\002K\004\031\201\035\324\264\254P\013\034\032\272\254\252\022\211\3201!4\266\300\017\332\242\361\207Cb\005\341\373\241iY\225\304\n\202\304\n\"\204\022@\343\rq\003\2763\264\341i_\bC"
+	.string	"r\216*\005t\332\021\356\r\273\327\026\330\206\340\323\022\375~X\026HT\2428\374\371\370\030\333\020;\255\210\032\342\006'\206DD\032\350\264/\204AD\006bqh\250\030\024\300\027\211Vc\206\266X4f\240\3719\201Yu\004\"\020\002A\300\243\007\204@\0234"
+	.ascii	"a\037 \374\003\204}\200\370\007\210}L\340\037\023\330\347\004"
+	.ascii	"\376\021\n\266Eb\315\007:X[ \b\353\220h\b\030B0\b\274Y\331\013"
+	.ascii	"\024E\220Y\203\212\037\004\327\266h\fa\001\026\330\001\205a\261"
+	.ascii	"\b\001u\217 \nGp0\004\036A\254\354q\247UM\254AD\241\312\006\205"
+	.ascii	"C@\342\211 \265\025\032!\034\212\210`\304\021h\005Q4\236\030"
+	.ascii	"ac\\\333\241p\203\032\242\260\203\0177\001\374@\004\021\005\210"
+	.ascii	"'\202dZ\325CK\024\036}\357\343\363a\202\013T\200\003\036\304"
+	.ascii	"@,\n[ +\034\002\205\255\220(\314\300\032\213,qe3\020\205\300"
+	.ascii	"\241\fA#\233\001\303\001F`\201\037\260B\023\032\224(\016E\030"
+	.ascii	"W\022E\234\246_\313!\344\311K\272L\221oI\236j`\355\374\252Y\261"
+	.ascii	"B\007\223iO\321,\306b(-\245Hsn2\214\224\244xq6;\326*\336 `\247"
+	.ascii	"t\003\3534)M\332ob{i\232\313\b\021)nGG)\022\006TT`f\244j\230"
+	.ascii	"=\245(>EJ\271\244p\302r\225\350\260\254\247\252\255\264(-\332"
+	.ascii	"obzQ\\\367\b2\214\362\352\313\227\024y\305\234,\240\005\tL\332"
+	.ascii	"?E\376\264x,\371\302z\217\331{{\214\211jlOof\t\222\255\2722\233"
+	.ascii	"+rKJ13P`]\\\260\336a4\030\254\245\020\250\r\246\247\251\204\022"
+	.ascii	"\260\217\036f\306\342c/-{\241\241\354\272rw\347\223\246\027\305"
+	.ascii	"\365S\362"
+	.string	"\222[r\361.]\260\217+\326W\004\204\260\250\343r\003\232D\235\202\230b\f!35\243\211\322\001S\024@PXl2\033\354\312^\017\023\200\022\t\224\231(g!S$\"#%)#\245\255\003\242c+$\305\375\030\312\305kE\003\221\222\334\007\260\340\024Z\t05\305\216\257\2362\253\334\220\215\001!\205\324`H\220\200\211\246H\202\374\2216\222\366\351\254\237\354\215e%_\236\033\"\276^b\207\373DV\267o8\340C\306l\274e\276\270\244\"\251:\261\235\2516\330\261N^\034\r\245=\024\337N\206\202PL\003\213\322\206YB\205\305\376\004\203\207R\2762v\343\033\340\364U\310V\360\026lC\334\310\272\302w\300\3672V\360\242\213\336\003\216M\315\216\331E\206\305\224@\034t\211\n\226\t\201\370\220\177F@\031\273\2516\267\364\207\001Ij\227\364lXKa\030=p\312\306\b}\302\377b\211\365\177"
+	.string	"?\024\361l$\305|\234q \025O;2\370\212T\366\300\266Fl\304\022\275x\260\0220]\304\\K\027\216lH\f\215\243V\035d\020(\270\203\021\345\220\327\315<\331)\026`\24492\356\006z|\035\223\242&g\224\331\321T;\362\2151\315r{\270D\347\034\367\033~\boZ\004\b(\3141\246\222"
+	.string	"\2716\352\013\370h\222\3042\b\306Hz\340z{I\324\327O9\255\226\324\221DE\232\007\356)(S\313\026\372\353\003\211H\026\231\376dT\016\237\361\371\244p\n\267\3125\177\270\t[D\nkv\025\260\264\261 \225\037\242\345\364\3100\320\034\373{}\341o;0)S\350X\305_\243\032>\312\340\312XB%\242\267^M\267\260\267s\273\243Z[\rT\201k4t\240\216a\n\360\036r\207\\\3575\277\202G\266g\202\0205+\006\254KV\372\3671\361\rI\351\024\341i\3628\344:\251\307\f~\320\247\312\004\333\201\236\205\232\350\317\301\257\240\215@\365\350\300\250\026\004\340\246|\217\333-\200\262\354\",\315+\352\013\324\375\356s\nk\336%\357\376`\303"
+	.ascii	"L\234V~\320\017\230\304\334\343\307\262\376\221\204\\K\250\313"
+	.ascii	"\323\036\t\033\206wHB\254\240@\347\242}\r\320\320\246\013Q\271"
+	.string	"\240\266a.Se\273\357\212\206\313\231\27246\213\303H\216TYy\001\375\bV\335F\253Rb#\036\b\236{*\204_\226\004\212\336\246\236U\227lnS\333c\335yCn\3541\324L}f 6\007\363]L\021\260\3155\213\n\270\377@G9h\213=\240\016\002\266L\022Q\371\366\231\306X\312\210BR\266\027\361\303\350\343\367\200\274\261\313\2321\2362\254\304\251i\357f\034\262\350\330\345{\316?o\313\371r3\240\320"
+	.ascii	"\377\277g\001fWH\317\366\342\246\270\345\256^E\341q\320\336\322"
+	.ascii	"\013}vz\234\250\002*\032\263\305H\376\232\206\222\304@\270\353"
+	.ascii	"\t\004\357\240\271\370<\3553UBs\214\332\323\371\343\273J\366"
+	.ascii	"7pb\273\"\324\353B{\n\177\265D\201E\020p\321sr\035)\313\n#\367"
+	.ascii	"\006\343\234\342\342\352|\246\327(\271\2141lP\026\003\231u\""
+	.ascii	"\355\177\304'\331\377[\2304F;\030\233\210s\223x\b}\262\314~\253"
+	.ascii	"\177\270\301@\246Y\271\352\371\231\265\363\2233]0*bz\023\030"
+	.ascii	" (\224Tw\"\207\235\201.\315\334/\003\201:\340ml7\224g\233\b\327"
+	.ascii	"@r\340\340\232\b\001R\246vA \232o8r \306\022\370!\246\242\036"
+	.ascii	"v\275\370_\005,\357\240\240h=TI\304\327bV(t\177Fm\247\375\273"
+	.ascii	"3\032o\273\246dF\022\373\243^"
+	.string	"\206`4\033\031+[\021}\236@\027\363\\\322y\360/\t$\331p\332\245\247^A\224\362\266Xl\t\036c\367S\235\330bu\215X>\200\273\317Ee\2235\006=\026$Z\367\020f\254\307KLqh#W\366\251\365%Xl\270\201\305N\301k\317\b\0177}\017\215\271\007\026\345\245\303\033\315#I\311\215\221o\251\314U\237\321\273b\0300\341{\024\267s!\251\025$\341\371\t\251b;\243\361\\\267!\217|\340\204\036\304\265+\365\302\013\313\216U\021J4W`\021\212\364\t\363L\3042\244\313<E/xd\307\213\035\300\260\316\276\302\035;\253\\\301!\346\327R\254[\321vAt\017\367\023\274!\243U1\377\250cQf\306\035\314\376\353\025\362P\236cf_^\370\006\340\021\366V\344\320z-\0069`S\230\365\262k@M5.\262v\036\n\304\343\200\224Z#bQ\206\324\212W%\352\003Q,\234"
+	.string	"8\0215\013\360>\335Zg]\276\325}D\223\300\374\371-\035+\357\356\352\3048[\344>\253\262\327E\r\252\306\313\026\3364R\03460\004\250wM27\337b8\272\245\035R\005"
+	.string	"y\300\\\253\035\2306s\322\355A`\300\222#\223\225'L\217\021M\321L\035'\351\204\307\271\253\327\343\007|\261\366\243\003C\370\002\320\237\330\306#\254\3135i?\330\314\367\013#\346\326\326R\2532\334%\274!P\224P\310\354\031\314XB\216\246\242@B\2644Spj\023m\032\301n\256_\370\212\253H\373;\230e\231\325\354\307\270{\210\027\246i\033\202\025<\021\257\346a\373Ko\207\346\330g\033)\246\260\025'_)~\253 \027\022\207\231\220e\241\263L+s8\300\005\330\220\b6\343\366\"\231"
+	.string	"AM\346\200T\270\307\305\365\376\230v\243NF60\2371j\204\204z\320\363\331\362\353G\372@\342\016\266z \t34\221\005\321\2008\373\r\330,\270@\316~C\355>L\341\r\\rj\034\244`<\300m\263\034h!\004'\022\273/\003\002\234\022|\326\320\263P\006\366.\217\367\020N\360\020\331\344'\260JZ\004\304\2269\202Q\373\363\346\312\377\213\207\327\026\347|\002\007\025F\266a\373\335\346\025\332\360_I\005"
+	.string	"\264k\036\205\354\034\001\354\025M\327L\364J\363\217\274\367#\n\017\206\375\252\b\316D\030\020\025\251\n\240\b\024\310\264\247\215T\033!\b\016\373IkF\361\237N\234\310\002\002"
+	.ascii	"#"
+	.string	"\265g5\213\270\035\312\035z\251!\031Q\230\345\220\300\264g\017>\366\217\030Q\037k\222czsmB4$\240\306\255\246mcY\311\346\265D\024\353\265\217g\006)\342\f\356\037\021\203k\240\207*\263\322\271\300\275\346*\202e9\037\\\306L4\274IR##\276\374k_g\361)\346\331\001H\344\r\004\343\354\003\353J?\350\347\320\213:H\275\035v\253\215\005OT\337\310\024>r\252a<\275\224m CU\004\271p\002\016wx\377\364\002}k\312\326z\325E\004\t\254c\201\211\007![)\236\030\357\354\306\316\034\024\244\243\232\205\331A\"\306$\376\361\246D\n\371\240\264\276\272\347\321\035\244\330\237\223\324L\205\261s\0053M&\367\202\2025\243+\205i\371\"\357\321\032\354A\216\337\b\235\236\37380\353}L\206\313y,Hmp\"{\270;U{\013\360\241xw0\275\366iu[\314\206d\331\240"
+	.string	"L\232\247Q\013\217Qepm\303\263M\037\302\3075\214:\271x\tu7\025l71h\210Y\001^\fJ\272m\237{\266#\277"
+	.string	"D\266\335\362E1[\342\273\371\200\274\203\037\237\210!h\213o\310\3763\246\306\246\f\364x\n\223\017K\t\237^f\314\230\224*ri\355\325\366l|tFyk\225]3\353\215\252\346\212,1b\017\353\257\236*9`\177\235\325\246\245\210\261\344Xf<\324g\357\017\201\300P\221\022\374d3\261\023d>\221\244?;sn[`h\206\211N\350\b\036\267#\207\006\272\324\364$Cy\252\003\320\003\003\254\034r\352M#\355\331\232\032\316F\002\313fh\320\226T\207\002\005\355\2741F\261A\022\236\240u\020\255\242U\244\231O\310\376\t\250\374o\320h\335>\243\026\357\307\370\017= {\336F\034P\246\023\342*V\233^\"\211\203\030I"
+	.string	"\225d\312\325\311'\177\224\202\bNk\262\t)A\323\366V\202\375\344\326\353f\266\263M\331z,\270\226Qd\266ph\354\237\365\203\351v\251\362L\32493\230\2120#E\203\220\007T\267\241\356y\347\254e\252\215\021\245\342o\3110ZA\227"
+	.ascii	"h\236\001JD\371\315\206?B\253L\211;!}\332Y\022\300\234\223\246"
+	.ascii	"Re?\215\215]op\004Z;\004O\333%U`+l\375\310 \251\351E\300\020"
+	.ascii	"\2210^L\230\204\341\223Cq\370\216\016K6\034\226\246\205<B\321"
+	.ascii	"\353\337Qg\037/\275\215D\362\273=\221#\202\250\241?m\004SL\036"
+	.ascii	"\270\240)\026\031\277\202\275Pu\276\355\331\340b}\277\331<\337"
+	.ascii	"\253{-\351\001\225~\311_\350[\233%\275S\303e\034\312s\035\225"
+	.ascii	",\314\357fc\f3\336\254\216&X\236R\320\005db\005\270~}\354\031"
+	.ascii	"\002\023\f\305\236(\231\345>p\243\202\203\352:\342\\\303\020"
+	.ascii	"'\001\217\275|/\345\003D\030_}\370\243|\b\346\322j\031U\211\334"
+	.ascii	"\255\\Q\336P\373\326\325A\347q)\274\r8\360\332WN\325\377-\350"
+	.ascii	"\215\246\203\034o$!\026m}\236\315\255)~\341\2749<c\365Al\237"
+	.ascii	"\363^w\211\276_\227.\177\373h\357C\263\314I\352\b\376<HW"
+	.text
+	.section	.gnu.lto_.symtab.c0e7cdbc2c8f0699,"e",@progbits
+	.string	"sensorsPreInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\002"
+	.string	""
+	.string	"sensorsAutodetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\002"
+	.string	""
+	.string	"detectedSensors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\002"
+	.string	""
+	.string	"requestedSensors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\002"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\002"
+	.string	""
+	.string	"barometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\002"
+	.string	""
+	.string	"baro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\002"
+	.string	""
+	.string	"baroPreInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\002"
+	.string	""
+	.string	"compassPreInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\002"
+	.string	""
+	.string	"gyroPreInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\002"
+	.string	""
+	.string	"baroDetect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	""
+	.string	"compassInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\003"
+	.string	""
+	.string	"accInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\003"
+	.string	""
+	.string	"gyroInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.c0e7cdbc2c8f0699,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,970 @@
+	.file	"voltage.c"
+	.section	.gnu.lto_.profile.3cb7101f7a63e28b,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.3cb7101f7a63e28b,"e",@progbits
+	.string	"(\265/\375`@"
+	.string	"\215\006"
+	.string	"\364\t4\001"
+	.string	"\030"
+	.string	"\217\211\332\324\013\004\002"
+	.string	"\001\216\235\241\221\t\002\325\310\265\302\r\f\002\001\002\001\002\002\002\003\003\240\342\234\212\n\004\310\223\203\240\006\006\002\002\003\005\371\265\336\203\t"
+	.string	"\006\252\332\353\212\f\006\001\002\001\007\242\347\345\357\016\b\350\300\306\254\005\002\002\004\002\004\t\240\342\234\212\n\n\223\222\374\225\013\b\002\005\002\006\f\334\310\213\211\n\007\002\007\016\274\205\242\255\006"
+	.string	"\017\020\271\334\201\226\013\021\022\250\246\240\304\004\023\314\251\277\367\n\024\224\265\361\317\013\025\026\027\242\302\263\302\013\030\031\225\254\310\321\004"
+	.string	"\023"
+	.ascii	"A\211\245\3562\230\366'=je\336\305\230ST\206\353\fC\346(+D\240"
+	.ascii	"\tF\205+\006\216U\253\003\244\314\"\252\375W\020\313\rT\200!"
+	.text
+	.section	.gnu.lto_.ipa_sra.3cb7101f7a63e28b,"e",@progbits
+	.string	"(\265/\375 uu\002"
+	.string	"\344\002i"
+	.string	"\016"
+	.string	"\001\001\002\004\005\003\006"
+	.string	"\001\007\002\001\b"
+	.string	"\003\n"
+	.string	"\001\001\f"
+	.string	"\001\016"
+	.string	"\001\017"
+	.string	"\001\020\001\021\022\002\001\001\001\201\004"
+	.string	""
+	.string	"\001"
+	.string	"\r"
+	.string	"\270"
+	.ascii	" \240\3120p\342(s\250,L\325\214S\257\20080\230\312\264\227\340"
+	.ascii	"6\320\006"
+	.text
+	.section	.gnu.lto_.inline.3cb7101f7a63e28b,"e",@progbits
+	.string	"(\265/\375`\244\001E\t"
+	.ascii	"b\216-0`k\222\016\220\203\204\327NP&\006\275\276M\360\007qQ\336"
+	.ascii	"X\341\351\201\272\233\264\277K\b\352\032\206\341\004\310d\373"
+	.ascii	"\371\266u3\362\355\267-w\n?]\267\363e\227\021`\307\306\005\007"
+	.ascii	"N\231\352\343\217z\023\0275\341\n\236\250\b\343w)\304\002\303"
+	.ascii	"\003t%\200\0020\301`&\323\252`0\"\323\222\226\376~\374\266\322"
+	.ascii	"tI\234\247\353%4\300\315\246BC\240\217\007\315\260\220p\030\030"
+	.ascii	"\262\264\375\243\234\331\2773\205\211?\204\221\231\322\020\244"
+	.ascii	"h\255A\354G!3\255\217P\375aA\254\252qP\323\320\277K\344^\252"
+	.ascii	"\231\231\317We\375Y\357\373*l\2555\310On&/ P\"B\252\314\003\302"
+	.ascii	"\b\331\223p\003\326\306q\201\326\251h\203\3138\326\340\210\024"
+	.ascii	"\230\222\347\214\344\222]\306\302\215\201q\307F\224\\\273\301"
+	.ascii	"\262m\003\263f\331&\260\260s\204qC\354E\001\365\222\003\013\204"
+	.ascii	"@*\221C\253\321|\326\005\254\275\206\321\032\256\275\301\374"
+	.ascii	"\205\317\210R\260c\270\333\025\207\bi\304q\\O\350yC\355\376*"
+	.ascii	"\253i`\b"
+	.text
+	.section	.gnu.lto_.jmpfuncs.3cb7101f7a63e28b,"e",@progbits
+	.string	"(\265/\375`F"
+	.string	"-\006"
+	.string	"\222\n#+pK\222\016\374/\004\016$\240o\233\\\321w\001"
+	.string	"z_\334|\356\362\013U\025/\027\341\2003\242n\033\032jm\221\264Md\222\001$\257\177V\325\013\030\020P\275\245l\276\020\371\220\016\331D\321\324X%/\270\006c$\250\265\305Wl\027C,\343\210\r\310$\221\b\221H\307\203$9\020\324\356\307\372\307\352l\250M\334\246\311'\246P\340\022\\`\350\020'\320\344X'\312H\206TT\217\351=_"
+	.string	"r-\211\251*=\365t\370A\027"
+	.string	"J\220\003\330qG\254ap\227f;9\337T\305"
+	.string	"\302$I\230@\234\005*\350\002\371\202l\200\237\025(\370\214\002\027\217\nF\254!\002\\\006\246\251\\Y"
+	.ascii	"7"
+	.text
+	.section	.gnu.lto_.pureconst.3cb7101f7a63e28b,"e",@progbits
+	.string	"(\265/\375 /y\001"
+	.string	"+"
+	.string	""
+	.string	""
+	.string	"\016"
+	.ascii	"\232\004\002\232\004\004\232\004\005\200\004\006\232\004\007"
+	.ascii	"\232\004\b\204\004\n\270\004\f\231\004\016\200\004\017\200\004"
+	.ascii	"\020\232\004\021\232\004\022\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.3cb7101f7a63e28b,"e",@progbits
+	.string	"(\265/\375`K"
+	.string	"}\004"
+	.string	"b\205\021\033\220)\3510\377\377k\353\256b\233\013\357\3053\006\032\241F0\370!#\255\312\224\002*\030\215\004\300\227%\350\2673b\027\222\2428\016\333\300\223-\260j\263,\260*D\353\350.\332\236\031\3664%\375\307\0224\372\"\036"
+	.ascii	"\220\005`3@Z1E\323\016\f\006\203(\031d\260\272\273\213\3013t"
+	.ascii	"\316\2135\211\245D{\t\261\213\361U\220\312\001\2647\013\240E"
+	.ascii	"\300`\206\207D\t\321S\202]\351\002e`g\307\316\301\272\314^F\036"
+	.ascii	"@\021"
+	.text
+	.section	.gnu.lto_.lto.3cb7101f7a63e28b,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_voltageMeterSourceNames.35.3cb7101f7a63e28b,"e",@progbits
+	.string	"(\265/\375 \234}\004"
+	.string	"\024\bU"
+	.string	""
+	.string	""
+	.string	";"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\267\305\265\001}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'1\270\265\005}\276'6\206\b{\by\300\001"
+	.string	"?\202\210\200\030w3\301\0014\277\001\275\001\274\001"
+	.string	"\004ESC"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/voltage.c"
+	.string	"\004ADC"
+	.string	"\005NONE"
+	.string	"\004"
+	.string	"U\245\366iu\200\332o"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_voltageMeterReset.38.3cb7101f7a63e28b,"e",@progbits
+	.string	"(\265/\375`o"
+	.string	"\355\b"
+	.string	"\306\220=8@\217\322\001[\350vK\3641\316\232\237\245\350\304\363AR\332)\037\300\3206\325F\220\035wd\204\036\f)b\223t\f\017\302W\347\202]\020\316Ax\207\b\331\335\366N)*"
+	.string	","
+	.string	"."
+	.string	"\004\364\323\236\275\362\220\264G\2252R\254\335\255\262\343\336\243\347_\344"
+	.string	"\242\321\367x5\354\256\243h\264q\313\333F\260\275`_ \226\240}\323\037)}Q1(\331\325h\271\354j\236|dl?\332\007y\210w\023\350\003\273 \212\311n\250\340\004\354\323\341\013\350'\366)\254\243nO<5YT\254\177\250]\361\221\017\266\273\f\376\311\342\"\200\344\361\351\203\350\347uR\225ZB\261e\207_\224\034\3661\273\273\001[\326e\235i\216&{\330t\021\032E\3456\215\363d\\\365@l:\225\263qUs`M\"\333j\247i[\315\204{\314J\320\016\255UHbp'\271\276\016"
+	.ascii	"2\241k\034\030\027\f\030\006RJ\250 \360\244(\371\024\331\220"
+	.ascii	"\261\254`\336%\200f5\005\334\345E;\311"
+	.text
+	.section	.gnu.lto_getVoltageMeterADC.41.3cb7101f7a63e28b,"e",@progbits
+	.string	"(\265/\375`K"
+	.string	"%\t"
+	.string	"\306\221@:0%'\035\215\213'\026\325\3510\364@\013M2\243\203\031\003S\300\007\272P$\260m\350\326K\253\005\306"
+	.string	"S\r\365X\n\nT\021\211\311\232\225F\270\\\ff\233\265M\344N)/"
+	.string	"0"
+	.string	"-"
+	.string	"\253O\210+\345\002`7\234\016O\300\271\354|\200s\251#\367\036=\377)\307L\300\227Ouz\f\210\330]\307O\265\272\365\266\025l7\330\266\tQ\243/\005V4\007\257]\217W\200\235\2211%\266M\266\307\266F\333\341\301\364\326\206u\027\344\006f7d\360B\347\322\266\177r\024\223\275\202\020\f\3468\313E\002\270\273\020*_\351|\222Kc\224\342\277K\277\244\257\371>\242^1\231\224\013\025_vx\212*b\037[e\331\216\326\267\376\032\231\2046\222\026\201\262\211\020\211b\313\230\035\267uZ\326Mm\024\252\230\"\256\233 \003o\026\0317I\333\306MO\270\307VYV\004\224v\330o\361>\340g\007\013"
+	.ascii	"D\023Z'\306\345#\251\232Pl\202u^h/\241\272&RbA\240:D4]\363\t"
+	.text
+	.section	.gnu.lto_voltageSensorADCConfig_Registry.45.3cb7101f7a63e28b,"e",@progbits
+	.string	"(\265/\375 \241\265\004"
+	.string	"t\bj"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001\212\001\202\200\200\374\342\303\305\242\037\031\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\357\030us\250\374\007uq"
+	.string	"\005\001\006'\001\003\005\001\006\035\001'\001\202\002?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/voltage.c"
+	.string	"\004"
+	.ascii	"\237\n\013&\321)\212\274\001\024\001"
+	.text
+	.section	.gnu.lto_pgResetFn_voltageSensorADCConfig.46.3cb7101f7a63e28b,"e",@progbits
+	.string	"(\265/\375`'\001}\r"
+	.string	"\346Y[B q\223\016\fL\261\360@\221\312\200\271\232iJ\316`j\344\201\353Q\335\324"
+	.string	"\002\344\"\f*\367\035bk\230q_\303\"0\251R\215QA\200\006R\340c-\310P\236\302\235^d\350!\333\366\2262\245F"
+	.string	"H"
+	.string	"H"
+	.string	"1\336\221\354\277\016\033\276\032\273ki\b\377\260\273aj\217PS\3631\037\247\037(\241\261q\241G\250\331\335"
+	.string	"\\\006\250\311\021\027\222P\004\351\372\225+ Im\034\351\211\371\330]\347\306}\270/\267\215\331n`?\013\273#\251\033\313\022S\234d\336\263\377\275\363W\234y\264G\234\204v\317*\252\220\207\n\365\215\310\330]\216G3\250\0365\360\231\264\217\362\024\355*\030\n\bX\021\217\003\212\335n\201;\252Gw'py\254>\340\362h\315\016\273PM\250\233"
+	.string	"\2017y\t\013\023\262\305\305\256\206o\217>\352\002\210o\342W\270<&h\031\201\020e\312Q\257\377\356`E\tj\233!\312\224\252\232\354.\224Z\332\335\220\265d_\345\217\367\356|\372\030"
+	.string	"(-\020\320\b\236w8\237\r(\373x*s<:\0176 \b\027\005+\303\256\354\323\311\254\217g\023\301\342`\231\345a\300\227\204\016f\201\256\013\2632\335^K>\275:\221\302\"\322\020G5\031\303B;\2560rd\333\034O=!\235\274\027\"i\343p7\031"
+	.ascii	"2\003\376\031\322\340E?\256\304\212S\267q\272\b\316$s!\314b\\"
+	.ascii	"3\346G\224(.\013\241=U-\007rV\035\313\332\002MX%\020\0277D\224"
+	.ascii	"\rv\332\333s\300\237\224;\327|\002"
+	.text
+	.section	.gnu.lto_voltageMeterADCRefresh.49.3cb7101f7a63e28b,"e",@progbits
+	.string	"(\265/\375`f\001\275\r"
+	.string	"F\330ZF"
+	.string	"q\234\016\240\310\224L\326\314!$\252\376\367\245\3051\240=\247\361h\347\310\027J\334Yv\037]q\340j\341f\026\221m>6\212\212\210\007\200_\377\377\377\335\r\361\3248\300\261OK\252u\377\244\330h\223\275S\nD"
+	.string	"D"
+	.string	"I"
+	.string	"{R\005\003\t\333]\216\206p6\303\327\214\316\320\337<%\237\033RR/\227xz\3156\273\013@\274\220m<\304\324\314L|\234\236\365\271\362j\275\\\342\307\347\346\331]O\225\250\341\326n\273\201\355\002\366[\001\260\033\250\031\243\224\212\330\343i\316\335=\231\206\330_\335\337\274\022\326\302\301\261\233!\366\262e]!\361\325\355\237\334\304g9\363j\340@\370\225\t\263%6\027\371\202ew$\360j\016\346\365\031\2076\215\217#\0019\236\355\356f\016\256\342i@FZ\260 !O\336\036}\205\247\001\371\240\"\245\003\004\312\t\373\236fwG\3614\035^\020\330\346\274\005\206\034J\017&\273\233"
+	.string	"\305SD\360G\274z\002\205y\325\253_A{\375\311\007\324\210\005\242\033\324\t1\370\224\036t\0228\360\353@R\b\344H\242\317\210\003} \327\021\340\016B\350\343J]\367q\231qOCJ\276\240\245taA\321\224+\025\261\002\030\3647iU\304\274\213\237z\334\244\235\236\365"
+	.string	".$1l\310\230aa\006\037"
+	.string	"2\003\006j\214\250\303\213\330b\223\326\0050\340\032\273\300X`0\200\b\350x\b#\201q\2000\"$k\002Sg\312\232\315\360`\026\003s\347rOgd\252vLJ\306\313\025Afp\253"
+	.ascii	"\333zf\035\024\221\3275\237"
+	.text
+	.section	.gnu.lto_voltageMeterADCRead.50.3cb7101f7a63e28b,"e",@progbits
+	.string	"(\265/\375`q\001U\r"
+	.string	"\006\230WB\360\222D\035\240\367\270\340W)Pj>\032\2246\016\260\021aZ\374\345\212\246P\021t\257z\266\365\030`^\351z\330Z\255|/\227G6\241\360\3509\036\023\361\232\223\306yc\313\032\3217\242\326\312\235RB"
+	.string	"?"
+	.string	"I"
+	.string	"-\300\2038\270\332%\0013cWd\340\005\324\245\00470]\212N`\272d\320\326q\361\304\276E\304\007\226\231\335\275\324\304\301O\320\377\312\253\320\204\344\023$\302\356z\206&!n\275m\005\2669\366C\0013d\213$SK\330\217vw\255(\366U\376\351\240?\322i\325\351\251\323\327\004x\301\001\201\334\005\021\362\2611\322\013\n\333\267lO\361.\300\253\214\034\030\260\036VF8\240.Y\244>\355\263xS\355\3544\224\207vr\253\312qft\231Z\225c\217\253\335\271\214\215z\f\317S G\312\bL\270\303\027\016c\263N\306\006\266E\336\322\tH\341\242bw\037\260\374E\006?\345\222?\r\363\341\206\351\322\325:\031W\200J\002\236\366\321$"
+	.ascii	"\b\3218\016\263\300\311*`\032g\033\255\203}B:\221\353\363\272"
+	.ascii	"\217\323\276\213\363`\333\225y\337\265A\340\016\203\346]\237"
+	.ascii	"\256\363.K\334G\253(\236P\306\224h\007\253\332\024~\343\007v"
+	.ascii	"\033[%C\326(U+\0312  \320\202\221*\363\226O(7\235\026\303\300"
+	.ascii	"\252\277@\214\355v\254|\305\366\030\305\036\323\030:\221F\226"
+	.ascii	"\267r\032\273\352\210\035\244\261\363\314\031\351H\262\240\371"
+	.ascii	"V\n\262\254Z\274E\347M\370\355\224\357\005\343)\260\313\213\026"
+	.ascii	"\222\001"
+	.text
+	.section	.gnu.lto_isSagCompensationConfigured.51.3cb7101f7a63e28b,"e",@progbits
+	.string	"(\265/\375 \350\205\006"
+	.string	"\"\214-4Pm\222\016$\223\203(\207\250\233u\001\020"
+	.string	" \326F\232\253\354-\331U\373w;\300kW\f\346\213\332633\305\231\334\227Z&\210\006G\035\326>\3312\005k0\324B\206\323\360 \234U=kCYn\303\220qp\232\312r\230\201\337\003U9\316{\225\273d\3316\302F"
+	.string	"j\022\337\217\202\\W\343\210\016\026\353t;\226N\330\002,@X\372\354\203\355\342[\3116\372ql\002#%\t&\231\241RJ\222L\"\033\277\347/\037 x\276\232a\204J\312\230\bA\311\314\\#\365*^\267\036\255pt\234`\242O\021@!3GLT\321[\377\202\337\340\247\b\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_voltageMeterADCInit.52.3cb7101f7a63e28b,"e",@progbits
+	.string	"(\265/\375`\364\003\345\031"
+	.string	"&o\243F\240\034Q:dp\277\344\363\250\361\031)\256\233d\240\032\260\352\360\211<tt-\001\225=\212\342d^\215\217\337V\306\275\\\272\035?8M\367y\033V\271C\206\240\371\303\272P\2134Q\277\331\362\033i{o)\223\f\223"
+	.string	"\210"
+	.string	"\217"
+	.ascii	"\267\367\202\302Zd\005\345\t\tU\255#\202\317M\020~\356\256\330"
+	.ascii	"\025?Y\334\333\356\232\217?\352\237\226Z0\211Sk\225\265\217m"
+	.ascii	"m\330\267\263Z!\025\247l\276\355\223\274\200\222\340\316H\350"
+	.ascii	",\331\277'.\027\003\303\206\214\300\264\004\344\276!n\361\215"
+	.ascii	"\207+\n=\216\220NuG7.\312X\321\220\335\305\300\300!\017PYy\243"
+	.ascii	"\3439\343\022f\224\223\004\3063\221\021\013\356\373>} a\263\343"
+	.ascii	"\b\351\274\242Pk]\336\031\035}]\337\335&\273\253`\267\335\004"
+	.ascii	"7\320\264\245\n\t\307\301}1\317\327\013E\360\275\023\021\f\376"
+	.ascii	"\004\264\027\362\271#J\360w4\024\374\335~\374]P\241\023\245k"
+	.ascii	"\241\036\223\346\367\244[iw\034\342\367\310`Z\332\346\355R\336"
+	.ascii	"\030\345\335\201M\336\327{_\327\344\025'ok\362\262$o\330\274"
+	.ascii	"\253\311K'\357\234\274R\362v\3632\017\200\2440\020\200\265\026"
+	.ascii	"\005\347\324\250y\205\310{\377\356\235&4\2219\323\177+\276d\033"
+	.string	"\213\324R\255u\334\025\257d\357k\340 U/x\244\371\215\023\202\3016\257&\232\362\235N\002\002\265\323\377\3650\355}\027\013[\316\345\202\374\252\241\0302\b\340W\317\336\325\260\201\277\243M\200E\013\255\354\005^G\335\rs\265\342\f\314\276\016j\210\203\333-\373StT\334\335oQ\007\307\301\335\345p+\035\302Zs\017\366\300W\361\360\001\004\b\372\311\375,S=\034\007\345l%>\0337ax\262y{\033\215\265\215$\036Mhr,g\367Q.\305\266\027\262>3\376nF?c}\247@\337\331\202\037\021>)H\320T\310l5\232\315\304\217Mf\002\310\247\204lV\263\311\026\fX\332\211\237\232,\005\215V\223\211#\356\315\333$\017\2019\242p=\304\362]2A\211\237\372\312\020\326\256&\372\231\273\372u\232\246r,\347\277l\265\322J\200\242\177\020\275\357\254\037p\206\360>\210\302\232h\317QA\244"
+	.ascii	"\303\355a\261\367f\244^&@Kd\265\302f\365\325\254:\254p0_V\355"
+	.ascii	" \206TU\217\235h\024\325\240\255\264\377sh9bDl\336\262|\023\""
+	.ascii	"K\250A0\004\241B\204&\020\tDh$r5\220\002\241*1\017\021\200\265"
+	.ascii	"SD\026\244\225r1!\352*\301c%\027\355\007\t\030\211M\n)t\013\325"
+	.ascii	"\026\226\017 \377\372\250\247\327\200\n\036$\020\211\331\212"
+	.ascii	"\023\006\004\364\200\031\354\"\0302R\226`|x,\026E\354\013s@."
+	.ascii	"\244\363\034\320\002\314:\007\363\250w\301\007\033\277\370QT"
+	.ascii	"$\372\030\022\250\016\243\313z\243\273\223b\227G\005A\37545|"
+	.ascii	"\302\345\275ZTD&2Y\303\274M\036(z\2726,\017\270\nd\234~\332\362"
+	.ascii	"e\257 \330\006\346Ra[\334\374\206\032&O\374\001"
+	.text
+	.section	.gnu.lto_voltageMeterGenericInit.53.3cb7101f7a63e28b,"e",@progbits
+	.string	"(\265/\375`\330\001\215\020"
+	.string	"V\336kF\360\260(\035\272\343F\366\335\361q\021\246\277\240\355\377cvvW\223?\372\253\330JqX\030\206Z\2761\277\r\016\330"
+	.string	",g\242\366\260\373\2510\027\236\201\335\233\311\r\\T9\375\307\233\236\016\314\322\370\367&r\247\024V"
+	.string	"T"
+	.string	"X"
+	.string	"\362!\247\354\235\207 \3667.XR\320v\227\323\031\353\267\360\2361\365\317\224\233\306\224_\363\350!\307\312?["
+	.string	"\226-\201\313\267\212\023d\004\314\345\207o"
+	.string	">\r\233hwC\037+\352\303\307\234\035\231\016\316\007\363\370q\260\273\216-_\207\373\343\266_lC\260\317\023\340\013\207*\326\354p\025\265e\377\25326\350\261[5:\306\350\203\024p\20113/T'\\\016\265\035\033C\266\020\361\330o\337\031n\302\2323#a\377\345\207\016]\036v\233\324c\"\"V\270_\004\230\214\027m7<pi\004\037\227\242\017\230\227\333\005\314\007\273[iF=\311h\260b\217m\322qJ\f@\032\370\332e)\370\t\033\303W\230dO\f\r\214\327\356.\270\271\n\n\276\353\322']\205y\0315d\206\215*\326\254z}x\0039\263\225\316M\017\335\335\025\325\2267}\331Qx\276\313\026T\342[.}\225y\331"
+	.ascii	"\254\021.\031I0\245p\250\222\222\311d\002\001\323M2\"\225FP&"
+	.ascii	"\335\005\316;u\036\n\311\343PL#'\034\311\311\343F!\356RH'\016"
+	.ascii	"\325u'.\024\252\2562v\315\037\360\240\321aC\245\253\217\266\f"
+	.ascii	"\n!A*KD\273\234\347\333\024\231\252 \375\013l\266\001\\\305Z"
+	.ascii	"\224g\001\2721\243\205\033( p\0021\223\325\001\035bE\016\r|^"
+	.ascii	"\213\241C\311\276\243qob\301\017_\232}E\357\272H\335\242gctE"
+	.ascii	"i\234t\225E\013\264\261\213m\321\221\034\276x\321\t\013b\233"
+	.ascii	"\210\222\310\201\004|\022^\371+G\023\213c\204o\264\203\347M\305"
+	.ascii	"{\\\227\311\267hoB\335Y\373/a=\001"
+	.text
+	.section	.gnu.lto_voltageMeterESCInit.54.3cb7101f7a63e28b,"e",@progbits
+	.string	"(\265/\375 \302=\005"
+	.string	"r\211#+pm:\240l\341b\200O\210~\"7\320\324p\301/\213\221xQ\333)[\231\263\273\373\337\365U9\363\366b\0358\023\365\3362\005\277*\271\2602\307\214p\245\263b\2622\326\260\036|\321\312U\341\023\")gsR\246\276\336\350\031$q\362\177\033\214\230\177\001\035\275\037\0228\"\005\251\333r2u("
+	.string	"\332\374_\352\332?\332O\323\373\251P<\245\356\346\230Ym\241\366\335\316\016\270n[(Ht\367!\327]\366q\377\037\376#\3763\002\b"
+	.ascii	"3\003\316\231\021\340\313]\303\311B\030/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_voltageMeterESCRefresh.55.3cb7101f7a63e28b,"e",@progbits
+	.string	"(\265/\375 \302=\005"
+	.string	"r\211#+pm:\240l\341Bc\3651\372\252\273\220\320g\221[j\261yQ\333)[\231\263\273\373\337U(\f\363\366b\0358\023\365\3362\005\277*\271\2602\307\214p\245\263b\2622\326\260\036|\321\312U\341\023\")gsR\246\276\336\350\031$q\362\177\033\214\230\177\001\035\275\037\022@\"\005\251\273r2u(\360\331\374_\352\332?\332O\323\353\271P:\245\356\346\230Ym\241\366]\316\016\270n[(Ht\367!\327Y\366q\377\037\376#\3763\002\b"
+	.ascii	"3\003\316\231\021\340\313]\303\311B\030/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_voltageMeterESCReadMotor.56.3cb7101f7a63e28b,"e",@progbits
+	.string	"(\265/\375`\301"
+	.string	"5\013"
+	.string	"\026\325MD\020\2538\035\020U\231\362\345\225\353\022\301\251z\377\377N;\320s \016\253\341\203\200b\250W\017?\025\320k\333?\370\251d[\277\304h#\021!\341\026\330 @0A\022\rPP\201Sa\203\333\333.k;\2459"
+	.string	"9"
+	.string	"9"
+	.string	"\033\034\342U-\316vO\255\n\273\243\20630\247\026m\r\037Q{\t\251"
+	.string	"\016\312\335\3452\004\027?E\377\253C\220J\241\317\313\307\356z\222J\005\356\354\2661l\203\330\327\004%L\244\265K \326a1P\013\nl\337g\235\374\274\201I\\\251\335\335N\355\217\275\235~\263\235M\373\013\316@\374\b\262\230X"
+	.string	",\001\036\343+\264S\314)\264S\317i\007?\351\372\t\024v\241<\250\235\264\312!\200\022\250\335\355\360\037\260x\374\004\247>H;=\371\251\032\220\341\244\332 \2321{\034\315\354\200\375\207\335]g\006\354\217\377\324nz\005_\027v#\021_W\342y4_\r\253\267\231\223\351L6!J]\341\300\257\202\235\016\344:'\033\217\343| \227\271pM\351>.\254\365\343\266Q\364\325CL/\016/Q6\362N\341\022r\225\217\020\021"
+	.ascii	"\2473\241L\2130\f\262\2607\023\020\310\206\321I\252 \234\243"
+	.ascii	"&\t\2510\004\227\201\200FC\205\333`\356\227\212\007\356\334\242"
+	.ascii	"\235O"
+	.text
+	.section	.gnu.lto_voltageMeterESCReadCombined.57.3cb7101f7a63e28b,"e",@progbits
+	.string	"(\265/\375`\230"
+	.string	"\025\n"
+	.string	"\346RE= \005)\035 W\306{\n\375iHs\241\007\252%\301l\232"
+	.string	"\265\036\263\002\204S\211\346\372?\266[V\265\001#\327hd\022PXA\332\325\304\3505\004A@'\320(\355g3\262S\n0"
+	.string	"3"
+	.string	"3"
+	.string	"&o\320\235z\376\351N=\332\265\223\257=\013\314\306\314\266\273\225\033\371\3709\372\227]\200\325J}v\034v\327\223\325\372\270\271\333F\260\335`\177!\263\373\320hB/\273\035\267"
+	.string	";Ci%>\312\313\323IC\324Lv\327;\265O\266wz\317\366\247}\330O\306\307P/\330u\331\270\354\222\nN\360\234\006\342W(N\214\355\246\356\245/>3\021\274v\227\301O\321\310\360IN}Tw\372\362\023\306Q\023\002\313Q\315\233M\256&'b?`w\327\234\313~\354\017\341W\372B\003\036\201\276\bQi\002\304\250b\b\212\244O\254$\t\021E\035\205b\005\035\030\254\370\302Z\002\301\260z\244\352\262?\200x"
+	.string	"\270Qq+\213\267tR2\266\253\374\245\003\020"
+	.ascii	"s\311\"\3236\030\001Y\200\232\t\bd\303\350$U\020\316Q\223\204"
+	.ascii	"T\030\326e\036S\241\001\025\255Y]\001\327\362B\230d"
+	.text
+	.section	.gnu.lto_voltageMeterRead.59.3cb7101f7a63e28b,"e",@progbits
+	.string	"(\265/\375`N\001E\016"
+	.string	"\346\032aF"
+	.string	"\223\223\016P\225n\243\320I\226\326\244\2666)\213\t\274\266I,\210\230\371iZ9\301\\~\306\266\365\366m\033\212`U\267\222O\025*C\203\356\252\252\006\257\372{r\250%'%\002h&\306 \210\354\275wJ\001M"
+	.string	"I"
+	.string	"N"
+	.ascii	"\247\356l\035\007]\3663\0360\310\334\354n\225$\336\235N\031;"
+	.ascii	"_\365\216M\251\265\362F\247\017ORC\325Zy,\237\030\313\3454\360"
+	.ascii	"\311\350\020\300[\231"
+	.string	"\235\232\0216W=f\360J1\206,\330]G\223\307\341\276n\273\201\355\004\366Q\004\362\006\270\033rp\226Ea\234\260}_\346!\312Yx\300K\212\017\265\273\331\251\215bg\247\317lG\3601\335S)'\331=\341T\354\324 \366h\037\365\025\335aT,\262+\"\006\315.\210\300\007\260\323\002\357\\\247\363\002\256\376\352\302\004\337D\312u\372\360\021\245\001\307\207\362A\2129\361\305\217\232\020\363\212R\332\024,\304\233<\345\350/\246\217%e\213G\256r]>e#\246G+\307J\fb\203\245([\354\317\335]\313\223\375\324/\017\363_\304\303\372@\224\370\020\234&\322@\324\301'\332\304\243=(\021E\330*\324\020\267\205N\264P=\371\224\200\252\t\027\252\036\002\336$h\\\025m\033W3\220\364\271\362d\253\316@\305\002\331A\222%\3729M\310\210\306[\374\241!\334\005\3451\343\346\333\365\320\240\317l"
+	.string	"\\vWA\032"
+	.string	"2\241\231)H\003\005D\376\336\301\330"
+	.string	"\262\001\3460\n;GM\202T\034\313\306"
+	.ascii	"h\260PR\213\272\030g\257\271\314Fh`1\334\013\354oj\n\334\013"
+	.ascii	"\246\246\214\273\031\314\244y)\215A\355\001"
+	.text
+	.section	.gnu.lto__reset_template_136.0.60.3cb7101f7a63e28b,"e",@progbits
+	.string	"(\265/\375 /M\001"
+	.string	"\370\""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\001\n\356"
+	.string	"?\202\210\200\030\177}\275\001{\274\001y\273\001"
+	.string	"\003"
+	.ascii	"@D\312-\003(\002"
+	.text
+	.section	.gnu.lto_voltageMeterRead.part.0.73.3cb7101f7a63e28b,"e",@progbits
+	.string	"(\265/\375`:\002M\021"
+	.string	"\326\236mI\340\262(\035P\342\302\025\034!\273\252\204d\034\2166~\017\243[c\214\342H\353\247O\007\344T1\245\203\004e\376|\355\265\250?\330\271JA\220\t\200\340\3048\317R\020Y\004\201[\004c\032\215h\230\t\322\016\331d\357\224\002U"
+	.string	"V"
+	.string	"Z"
+	.ascii	"6\250\007\330m\005\351\354\222\b^m\022z5y\222\3565\364\221\356"
+	.ascii	"\325\276\313v\352\305*\373\307\311\024\373\030$<\300~v\027|\245"
+	.ascii	"(\256:\235\234\312\217\235\244\247\345&\203\351p\372\362#4nn"
+	.ascii	"2\230\020\237\002\316\001p\260\273\016\211\270\353m7\260\255"
+	.ascii	"\300\236\256;+\216\363\333\367e\274Ty\216MzX1\273\253b\037\306"
+	.ascii	"e\366\347\225\347\270\200\n\032V\213\335\375V\246\357\"\345\307"
+	.ascii	"\374\331>N\3520\226\taW#J^Mo\376Bu\030\213\275]\023\266\004\241"
+	.ascii	"\327\003\334\3479O\246n\203\"@.\210\027\317i\277\346/\325\003"
+	.ascii	"6\302\001>\374\032\034D\376\f*\207\013\220\227\036\275\026~'"
+	.ascii	"f\013^\332\247}\007E\204EI\263\273\ft>\203\344\317\274\276\274"
+	.ascii	"P\232w\021;\r\335\353\351\313O\236\030\037V\315k5\207L*c\312"
+	.ascii	"\235[\332\262\273i\256\233\246'\377\331M\337+\261\211\260v?\f"
+	.ascii	"\t\332\0225\026Hs\fOa\251zt\022\242\210N\030\304\r\240i\024M"
+	.ascii	")\241\tL!\211J\340h4\201'\006,f\bG\360$\212#\370\235[\332\262"
+	.ascii	"c\177\340Z \237\025m1\245T\3066\027\341=\204H8\217\320\273\321"
+	.ascii	"v\350\340\250w\243\321\t\307A\203P8O\350\325f?7l\224z\265\031"
+	.ascii	"\320\313\025\0364 \300\002\031\233\223\007JR\fj\t\342\276!\215"
+	.ascii	"\031s0\375\2650\334\3311\3759\202`\224M\\\263\006\243\023km\031"
+	.ascii	"`\303\214*\343Y\306\\0W\331:\332\202s\003\241\326\006\262\026"
+	.ascii	"y>\302\213\001r\033P\324\360\202\336\270\214\267K{\253\f\221"
+	.ascii	"\351x\017\377\231\324cH\315P\204!\212\2278I\273\335\346\224\205"
+	.ascii	"\006@\355\t=IKOXc"
+	.text
+	.section	.gnu.lto_.symbol_nodes.3cb7101f7a63e28b,"e",@progbits
+	.string	"(\265/\375`_\001\215\t"
+	.string	"\224\r[\002"
+	.string	""
+	.string	""
+	.string	"\002.\177\025\201\200\200\200\002\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\300\202\005<\026\200\204\001"
+	.string	""
+	.string	"\003\002\311"
+	.string	"\177\027\200\200\200\200\004\271\204\202\202\200 "
+	.string	""
+	.string	""
+	.string	"\005'\r\201"
+	.string	"\002&\177\030\272\200\002)\177\0311\177\0322\177\0333\177\034\005(\0354\177\036\270\275\224\034\005\300"
+	.string	"\037\0025\177 \001\301"
+	.string	"!6\177\"\004\0027\177#\0028\177$9\177%;\177&\005:'\005-(\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005*)+*%+$,#-\001?\177.\377\037"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001>\177/=\1770\003\n\034\311\302\353\343\003\001$\003\n\033\244\006\003\n\032\304\006\003\n\033\227\217\226\304\002\001\244\n\003\n\032\304\n\003\022\002\340\236\212\256\001\001B"
+	.ascii	"% \240\002\241\262\342\0010\226ihu\370\250\207\013\214\266,T"
+	.ascii	"H\202q~\215&7\314\215\346F\360\214\211\032\\\332\341s\233/\357"
+	.ascii	"\323t_\333\030\333!\336\341\203\260\030hB\006&#\006\305l\254"
+	.ascii	"\364\230\375q\006\360\310c\361\004Q\213\rO;\207\277\224B\033"
+	.ascii	"@<"
+	.text
+	.section	.gnu.lto_.refs.3cb7101f7a63e28b,"e",@progbits
+	.string	"(\265/\375 u5\002"
+	.string	"B\306\016\022\240'\351\377\377\377?\363\277\217\366Io#\311IR\246:\303\n#\354\030y\241\032\tv\360,\212\226Q\3429\212nT\217 j\f\220}\271\245\026`C\216\365U\273\235T\352!\002"
+	.ascii	"E]\235\202\211\007"
+	.text
+	.section	.gnu.lto_.decls.3cb7101f7a63e28b,"e",@progbits
+	.string	"(\265/\375`!:\235\357"
+	.ascii	"*j}PY0\nQ:\215\001=t\237\0035\304L,\037V\r\0030\360;\030\337"
+	.ascii	"\231\374M\r\377\274\302\203RCu\357qZ+~\260\0070v/44V\034\277"
+	.ascii	"m\020\363z\275\276SD@\251\004\305H\340\331\017\203TEE\301\321"
+	.ascii	"\265\215r\3374\215\212\346"
+	.string	"\245e\021Kj\333RJ\231\002t\004\361\004\036\005\3722z\372O\0310\3722q\3722i\3722]\272\007\210\276\f\225\316 \303B\337\267\247\357\343\242\355\376-rq\024\311\372\302\363\212\212c\372\314\260c\266-\007\004\264\260<}`\334\030\315\213\"\005\322\363\026\031\235\2610\333vhwyDW\351\323f\207\206\345#\303\001YY\236\027\307mq\227?\243\346f\372\221\251H\272\312\037\336{\206\336=*\021\307d\237\230\013\323\016\r\353*-\331\247\317\252i\207v'%\366\264C\273\273&.R\n\256\023Wi\333\226[\331E\203\037Qvhwd\027\307\245A\266t\343\002\271B\256\217\273\343\352\270C\256\325\265q\253n\217\033\3442\357\325\375q\211\334\034\027\353\362\260\316\213\343N\375R\335\032\337\340\267yv\314U\376\2249\273\310MI\353\342\270+\256R\306\352\314\016\315\006*\013J]\206|\243,\217\257"
+	.string	"\276-}\237\017}\037\224\276\317H\037\305\242\217Jy\272P7mNr\316%OB\256\223M\362b\343\352\346\2434\364m\272.\254\363\276xV\022\265\273\366n\336`\242\027S\3142\370pl\006\337Q\025\3729O?o\321\317Qt\007Z\372\271\207>\030\f\375\263\\\244\217\267\350\307\265\351?\303\364\357\360\017m\365\354\236uVp\367\215^\021=<\035\372\266\002\237\335\263\025\370\216\227\032\203\255\340\253"
+	.string	"\247\371\"\251\206\230\247\214\2214*\2600wMj\310\355\335\f\346\202 \314\016\245\233\217O\310\261- \213\035\373\241{GIaz\325Y,\016\230\342tuGg\355\254\027\373\305:m\235\325r\3432\330\300\326\3319\373\374)\233[)\0039\247\253\031(0\350\250h\262}^\313\305v\271}\332-6FM\373\314v"
+	.ascii	"?k\007\200>\351A\304\365\246\177\235\350_/\375;D\377\356\320"
+	.ascii	"\27734\006\226\007\316\002m\324DL\353\346\337^yk\352\374\220"
+	.ascii	"\274\220y\335l\305\b'\306\023&\313\233\177M\350[\256/;\206\233"
+	.ascii	"g\332\004\327\334s\357f\231\205\3623\312\331F\\Y\254\0226;\305"
+	.ascii	"B\301[K3(\250\266<\255\227Z\3166"
+	.string	"*\302\302\334\273\231\202u\263Ul\233\245b\235\226\315\242p\273f\245\030Y6\033\305\216\375\210\232{I\206KN\t\310\335\336M\r\0324h\350\321\240\241\013\006\r\233|\313\246m\217\005\323\267?\364-\r\235\326\203\0018$N7\337\266\320\267dh7\373\315\354\255\346d.\300\232Y2\333\304\236\335\214\202\023{\253A\355H\201YB\344n\357\375\304:\261N\333\3042yn\356\r\266\367\326\240\241g\246\210\024V\t_>Q\277\003\372\032\3209\004\215\301\362\370\354\022\013f\235\026X\261\333.\353u\224\250\271\233{7q.\2171a\\7\037\002\372\177\330\001Peo\360\t\364\255\005>\274\267g-\360]F\347X\036\337m\263<\276\034[a\353\267F\254\226mb$\025Q\033l#5u\254\221\325\230\222\233-\022\233\344\266i\217<\203\r\216\225J\266\326\336\33365\210\332\233\3106q\362\366&\302\261v"
+	.string	"\326\016 gQY9}\371W\277iy|\332V\360\235\347\317\370\277\367\277\002\350p\301\232\315m\376\f\202\310i\376\034DG\266\361\333\037\026\370\357\005Px\224\377\376\354\342\267\006\370/\217\377\2421\371/\363\354\267\0350SRf\201S\360"
+	.ascii	"\3749)\377\371\350\007\270\316\237C\360\277\312\177\266\377S"
+	.ascii	"\336^\363g\262\377\216\335\367\347\006\3747\305\177\225\376\273"
+	.ascii	"\342\277*\376\213\364_\024\377M\372/\223\330\177\207\376{\364"
+	.ascii	"\337\022\327\371?\347G\rp\177/A\377\371\370\377\313\377\272\377"
+	.ascii	"^\356.\363g\252\377\206\375\027\354\277_\377\365\372\217\376"
+	.ascii	"h\b\377\345\372\357\217\377V\375\267\306\177e\374\367\351\277"
+	.ascii	"N\377u\361_\026\377\r\376\027\001\377\345\300\1777\360\337\022"
+	.ascii	"\376K\302\177G\370/\005\376;\201\377~\360\337\017\377\215\300"
+	.ascii	"\177\037\360_\017\376\313\200\377b\360\337\004\374\027\303\177"
+	.ascii	")\370\255\230\377V\370\317\345\277\330\1770\377\255\374O\373"
+	.ascii	"\257\316\177q\376k\363\337\231\337\376\277\276\337\342\375\266"
+	.ascii	"\203\377b\376\207\371\177\367\377\312\377\267\377\315\377>\377"
+	.ascii	"\327\376\357\354\355\355\355\375\331\302\177#\201\037\001X\001"
+	.ascii	"\367m\242\245\2757\013\264\271\227\212l|\026\2656\303\177c\261"
+	.ascii	"%\300\336\377/\320\201\3466\032S\345E\0071#\202:\206\375\267"
+	.ascii	"\355m4\245\204\300\024\223\321\224\023R\327\324V\032\371P\352"
+	.ascii	",\355)%R\327\336:\333\310H\371!j\353 um\246}T\205\311\356\346"
+	.ascii	"\224r\033Em\235m\264\2110 \031M1!u\0211\351 uM1\355\256\251\235"
+	.ascii	"\263\215\210\226N\030\355%\235\3355\325ewE1\345 uE1!uM\231\331"
+	.ascii	"\024(\220`5\345U\351\340b\273 \031\355\025I1\210\226r\332\220"
+	.ascii	"\232Q;no\013Vb/\021`\357\030QKqDN\366\254\250mE\321\030Q\324"
+	.ascii	"\226 \251\210*j\033\265!\t\211\332[HQ\320N\322@\331l\333:l\233"
+	.ascii	"\262F\214\255\242\304\336\023$\355\255\264\273m\357\255\334{"
+	.ascii	"\313,\305h\356\375\224\203\304LJ\332{\331\223\264c(\231\224\330"
+	.ascii	"\373\202a9cB\352\242\212\362a\362\325\305\334&\232J\313\334q"
+	.ascii	"SK\272K\271\265U\324i&S\013\272\233s\21353)3+&gf\312J\031\232"
+	.ascii	"[\371+\022\263\264\274 7\307,\333`,)\3358\335\214\\\271\371Y"
+	.ascii	"\351\366\355r\315\001\tr\263\217\317\363\n\233\004o\013\312\315"
+	.ascii	"Y\005\256b\301\305\304\315\257\200\224S\344\023\227\013\231\223"
+	.ascii	"\253/\031\311D.\001T\305\006\346\346|d\203u$-N\212\376\006c\334"
+	.ascii	"\264\260\236\233\021e6\312E\326\231\211\360\336\255O&\312\233"
+	.ascii	"\352\210\323U\261\313\207\224\316\337Y\242\277\343C\177\247\206"
+	.ascii	"\376\316\213<\214gs\202\005\032\216\233\3054\3214\2576\272\233"
+	.ascii	"\277sB\177\001J\030O&.L\245\274\031\230\205\333\226\254#z\314"
+	.ascii	"/\260\271\254f\236\017\2168\2560_K\266\340\023(\236+\304<\363"
+	.ascii	"\224\3020\361h<\273\356\276\234\260=\355\256\230\034\317\"(S"
+	.ascii	"\230O\250H\231\362\266\006\307%\013\b~\202\225\340/X\f\327a3"
+	.ascii	"\334\005g\301U\360\023{\301^\230\013\027\301Q0\026\f\207\343"
+	.ascii	"p\023_\301T0\026\376\201\221\340/\274\206\323\360\026\276\302"
+	.ascii	"j\030\r3\301g\230\r\367\300P\360\033^\202\245\340,\334\205\235"
+	.ascii	"8\tN\001\373\300F\260\034\326\202\301`'X\b\016\202\301p\030|"
+	.ascii	"\004\217\3416\334\004\017\301n\230\013&\303Dp\030\236\202\267"
+	.ascii	"\3409\214\002\276\303v\270\fka&\246\303V\326\211\255`\035\307"
+	.ascii	";0\017K\206\224\302\213\013\030\036G+\236Z\216\240\240\202\002"
+	.ascii	"3\017'\271\341\301u\301b\246\271\221=\363\226\356\276\314n\223"
+	.ascii	"\243\270{\024\027\266\305H\332\265\3626\226e\004\016\311\356"
+	.ascii	"\216\221\241U\"\351)\007\306\304\222\204)%\013\022f\326U\202"
+	.ascii	"\367\264\202]\340\032\270y\006B\221\226'Fq\342i\244\224\225d"
+	.ascii	"\314\006"
+	.ascii	"^z\034a\025Tc\354\360~z\026a\306U)\303V\256\363\216\341&\363"
+	.ascii	"\003\257,u>\276\310\260di\355y\275\211=\323\260\225\033\345\256"
+	.ascii	"m\033R\276T1S0{\342\242\245\r\256\033F\307\023\216\316\212\271"
+	.ascii	"U&\227\306\026\205\231B\357y\345\310\211\211\260\t\025\317\213"
+	.ascii	"D/\006\363\356\275A1o\026\256\202;\301LkS{\336\220cZ\3019\330"
+	.ascii	"\236\327\316\312\275\263\261\343y\341\260\225;\347\2455\323\264"
+	.ascii	"u\326f\237\362u\352\264>C\241sE_\007\212\276\316\227\276\016"
+	.ascii	"\021}\235\032\372\270\306\217[\340&Le\243f\232\242\240\225\335"
+	.ascii	"<\205\365P\224\035\271\371:20\r<\003Ga\031\326\211\245\360\323"
+	.ascii	"1\224\215\373]^%n2e\226P\361\300R8F\217\247S\025\226\3020\206"
+	.ascii	"L\355X\366\240:\226tn4\371:D\332\207\247\237\023F?\007\214~\316"
+	.ascii	"\027m\315|\216_\344\032vJ@n~N\027m\003\220\303\246\237\263D?"
+	.ascii	"\307\210~N\225~\016\224~N\n}\0340\3728T\364q\312\364q\210\350"
+	.ascii	"\343L\351\343,\351\343(\365\177O\375\037\233\376\357Kc\3603\242"
+	.ascii	"\377\263\322\377=\351\377J\350\337\320\351\337H\321\277\031\323"
+	.ascii	"\277\331\322\277\261\322\277\211\322\277a\322o\332\340\351\333"
+	.ascii	"h\321\267Y\323\267\001\323\267\321\322\267\241\322\267I\241_"
+	.ascii	"\023F\277\206M\277\246L\277FK\277\246\206~\r\223>\215\236\376"
+	.ascii	"\031\215\234>\215\023}\032%\37246\364i\222\364g\360\364g\244"
+	.ascii	"\350\317\204\351\317\b\321\237\211\322W\263<>\265\273u\225\252"
+	.ascii	"\025\214\257\233m\227\317/\n\370,\255D\336\315\237y\322XI\277"
+	.ascii	"mF\251\257\267\350{v\231Xg\317E\263U\212V\304\200\323!\330{\266"
+	.ascii	"\307wm\246\257\257\364u\017}\303\256\n\333\364\300\005\233\035"
+	.ascii	".Z\260\335l\215\370\374\212U\360--\23388nf_|\334|-\245gtS`\027"
+	.ascii	"I\331\024\257\0337\243\266\302\222\257')\033(n>\372\3255S\226"
+	.ascii	"c\307\363\346\253\346s\324\313\001<jd\335\034\344(\221 (\027"
+	.ascii	"\276b\263\225J\266\222\214\331Z\220\027w\033i\231\241f+\305V"
+	.ascii	"\nH\216r\035U\222\301\006\237\303\272\272Bt3\272u\264\271\234"
+	.ascii	"\202\366L\2026\377\031\232 6\272\210@\351+@\311\013&\246\233"
+	.ascii	"\321#\237\273\2209\025]nF\265\376\304f\tw\207\0035B\205\312\255"
+	.ascii	"\350f\024\013-b\235_C\263\376C3\021\266\326\244\037\002\3735"
+	.ascii	"\037:\344\350\325?3\2036\303\306\224\n\375\243B\376\031\031\347"
+	.ascii	"\025\250\tL\350O\260}\370@\177\364\350}\304M\355y\323\344H\225"
+	.ascii	"0\314\243?n\226\245\342`\340\270\031\265\272\331\313\266\342"
+	.ascii	"x\320i\364\306o\240UV\311V\262\\QLP\311P\203#\306\225\025(\217"
+	.ascii	"\243U8Xzb.nFq\240;ZH\335\231\355\320\201\177\364X\341\224\366"
+	.ascii	"\305\310\226\"4\207e2\267\202K\236\331\220\262\"N+(\r\224\006"
+	.ascii	"Z\003E\312jr\317_\333\033\324\035\225L\225\236\222S\263f\211"
+	.ascii	"D\206\004\235B\245l4t\201\241\206J\241QF\232nT\3150\301\033\342"
+	.ascii	"bL\037\205\262\250\f\031\231\3156\0030\247\004\004\353\306\350"
+	.ascii	"\210\223\030-ti\321'\364)Sq\323!\345\002\355E\b\017()mm\246\342"
+	.ascii	"\373Q''\033>;\272\246\004\273\311:\321&\324\205\315\331\233j"
+	.ascii	"\354\354\306\211\024\0300\324E\t\017\354}\201\246\253\t\313\323"
+	.ascii	"\024\267\347.\326\231\335P\026\030i\271\233.xKq\245<\257\254"
+	.ascii	"nF\231d\210\340\256D9\323\267Z^\262\235\0260Y\236xy\214m\313"
+	.ascii	"\001\201+\266\273\374E\013\313\023E\336CM\330\266e\3166*\273"
+	.ascii	"CQd1q*\320%T\tMBO\240)\320\025\326\211\242\310z\317t\271\356"
+	.ascii	"=(\212\034F\016\307\213\221%N99{\371\034\005EH\023@\262\245\004"
+	.ascii	"\212d\235\250\211\367\230@7zd\333\226\315\315\242\206\254\216"
+	.ascii	"\352N\002\r7tV\342\240|\371G\217P\243\261&\216\272\233\321\""
+	.ascii	"\231\245\323\332\021S\377\250\322:Q\242/XL\360>W\003e\007U\017"
+	.ascii	"\375\036\034\372=O:\347\351\267\247\f*7\277\247I\277gI\277\347"
+	.ascii	"\204~\217\221\376\205<\375\013`\354\362\027\264\013\005/T\276"
+	.ascii	"\\\345u\233\242\242\250N\337\fs\231K~\376"
+	.string	"38Yg7\304\262X`\007\233\330\315\331\376\211/gy\326\362\317\3345+f\322\025\375,\227\261\3743\2778\037a[T\364s\234\330\236\027\0307g8]\342\302\231\00542\312h@\335\374\f\367\347+\327\004\211\2751`n\276\261\025|\331\212\317\363[\r\225\264g\222\233m.0\3653\233\315)\244\220\331\344\360b\\\200\346\301\340r\001\206\316l\367\202\223\005\267n\210\f#\231\212\214\211)x.nn\342\330()\361\210\232r\225\036\330[\013\347\311\246[\273ymm\313EQ\002\202\325\344F\225\"xii9\n\026S{\201\372:S{\2162\225Bs\337\234\241\\\245\315\230-\314f\004U\2348\311Yr2\2307b'\274\344\304\320\320r\226\rK\242AcF\311Bd\314:\363X>\313\020\265Yh\320E\311\216\345q\357m\305\315\371\354\317d\271,\233\331\004 \255U\241un7\356n\226"
+	.string	"\317\210\200\206\323\031\005\207u\321[\273\371\021\230"
+	.ascii	"\273uf\260\3344\201\250\335\002C\220\250\345\005\367m\3159G\367"
+	.ascii	"\365\265\004\013U\301\005\357\210J\2273w\331\247-\312k^p\236"
+	.ascii	"\256\255\255\254d\002J\034<\260\324\027#1%\3669\363#\b\225\212"
+	.ascii	"\034ZZ9\t\334R\t\b\326\f\230\013\035Z\220<'\321;\334\252\330"
+	.ascii	"\2709\037\311(\254Z\222\034c<ME\212\344,2% w\276\274\027It7\347"
+	.ascii	",\264\212\020\037\3161@\200d\"?*\275\030\031d\340`p\021rs&\222"
+	.ascii	"\257j\b\271\373\272\312C\226\0345\031Y\271X\320\252\322\204X"
+	.ascii	"\024h\342\230[|\\%Je\247\305\f\213\217\373\310L\273\227\366^"
+	.ascii	"n\354\206\245\004\004\013\347I\255\215i\365\314\264\2406\225"
+	.ascii	"wL\345*_\224\322\322^.e\3703\217\347\252\033\347\334\325\027"
+	.ascii	"*\252\254C+\305\226\027\n[U\226\034\317:\356\023\033<Z\334\234"
+	.ascii	"q\344$\215\326\304b\312\r\214\342\007\223\0327l\314`r\003\223"
+	.ascii	"\2058\231\032\253a\265\370\302\352\360\300\226\350[\260\322\267"
+	.ascii	"El\236\361,#\323\310Qz35\360\266|\356\245"
+	.string	"\246\013fR\274\300\033s\363-@\351[8\322\317.\362\213g\247;\345\030z\357m\275\222\226\313\f4ScT\256\240\236c|\213\315\246\240F\257\216\252\355\346\177\311O\377g\262\02006\232\236`\314\270\221\004K>B\177p\245a\335\354\314K\274w\003\345\204\223/+\372\366>5F\242\272&9\244\303\241\242\320H\344\240&\2078DP,\016\031\215G\243\314\n\364\2118\252A\353\321(\363\023L\213yM\223B\251\220\357&\231\034\206\2003LW\365\210D\016%'\030\201<z\300@\200\365A\033\200\220\034\200\220\025\204\306\241\032\343\317E\223@\233\025h\004B\242F $\016Z\201\214i\321\227\222 &s2\231\252\303aPf\004\362(\314\352\212\304\303\324\bD,\006e\206ir(\013\323\244\314U \020r\303\315\buM\022\201R\022\200\002@\006E\370\020\302q\365\360\241\003\215\035\246F\242\tA"
+	.string	"\2100\f\366\200\220"
+	.string	"\b\t\214\b\252j\207\344\005\020\204@XX\211\306\020\222\022\fSu\b(\b\"I\004\3000X\341'%\301\303\207\016\031XS\240\035\f6\254j\020\271a\030LI\270P\001\203\r\034,\300\007)\224\256@\025\310\0034~"
+	.ascii	"\204\304p!QM\215)\220\276\006\034(\200\203\016N\220y\007\036"
+	.ascii	"`\340\001\006\276w\340\201\217\217\007\034\370\350s\340\203\327"
+	.ascii	"$O\n\034\206\220\223\002W5%\026\221\304\2658$\344\341C\207\236"
+	.ascii	"\264\030\024&g\212\301\020!\210\303d\252\336\254B P0\t\344I\002"
+	.ascii	"G\030\022\2216$\202\200?\022A\300\034\022AA\302\365h\\\037\264"
+	.ascii	"aHDrX\203\200\210\305\237\236\017l\022\3703$\"}#\330\020\354"
+	.ascii	"\007;$\"\361\b\310\241\241\221\250\201\0135\"\202\033\030\002"
+	.ascii	"1$\"\177"
+	.string	"F\242\bk\207!\021\231\263\n\323\237\237\n\253\232\256E\342\n4\036I\020\325cP\317\210\225\030\"\250\202@\\\215A\234\022\"P\217kPM-\220 \"8B\247\230\n\205\035~C\240\234a\361\030\224L\211G\344\232&{R!\342J3\"XL\2075\026*$\215)R\350\350aH\034\241\204\241\032\024\241\036?\030\246\351\017\017\016\r\211 `\006\311d\020)\342X\324\031\241\246!\216\302T\005\006%\203\252\360\367\343Y\217\277\034bM\260'I<!\b\004\0322!\035^\320I\n\001\207\3014(\b\202\343\261\bTS#1\250\256\300\243*\fJ\220\243\243\036U5\275 \004\n\201I\023\202;)r\304\n\314`\207D\020\320H$\021$\244\246\353\320B:<\212P\002\005\025H\213@\306\016\027\214\304 \b:k\232LIPS  \242Z\202\210c\261\330\241xTW\343\321C\220\3208\024,\006"
+	.string	"\230&\207vN\b\026S\025(\"8\0028\004\262@\202\250\006S#\261\002krH\rZ+\240Fb\020\210&\025\032\203!\206\301\341\315:\204\\\207\216@\365\270\036\205v|B \020x\\\207\202\027\212\353zT\203Vb\322\030T\327\2365y<\232"
+	.ascii	"\374\371\321\251P\320\002i\221\370sT\2215BH\025h$\n\331\f\323"
+	.ascii	"\024\231\004\256\306ThM\016}`\030\344"
+	.string	"\361\r\211\310_\232\f\246\252\320HL\213C\242\0162Y<\"\325t5\022\327\240\n<!(\004\374\371\321Y\211B\304\"0\005\001\021\371S\217\2530\370\003\fZ\217G\241$\360\347'\347\210<!\005\246!\324!!\360\007Y\004\032G\fw\322\341Q\b\230\n\203*\260\230\206H\2138\017\332\220\004\002\021\177\214\307\023\202F\242\320\216\210\bVc\232LU\344z4J \fQ\274I\201)\320B*T\207\216 Vc\252\252C\302\235\021+Q\030D\006M\300Y\203\021\310@\232\034\272I\256jZ\354\340!M\016Y0\246B5\035\001)4\2244\036\205\024$\211\311\344\210\240_\261\230\n\213\305\241\237\n\253q\350\350\241XL=\214P\323u\rF \025\252\307\037\036\013k\320\004\342\r\220\221hT\203\032\210\240\030\024\022W\242\352A=~`<\022\327\240:\364\341\302\n\354@fx$\252\351\b?\310\n"
+	.string	"\005A\254A\023B\344\254\300\337\203\212\307c\004\200\350\317\317q\035\362\220\001\021\307bN\022\370\033\2468C4\303\264f}\005\311\231$\020\204\207\017\035\324tME\370\020\30105b@g}\320\206\037\016\306\243\220\320Q\b\200\037\221\251\312a=\036U\0165 \260I\240\317\212\254I\327\340\232DG\004\213\310$qx\263\0029\360Y\215\304!}\037\037\017\0300`\001\020\264p\003\207\244zL\032\323$\007#1(\304A\250&9l\240`\230\252\351Z$~"
+	.string	"\024\004\221\002\005\327\3421\304\216\032\f\022f)Upa\304l\255\3453\2670(\264\241N\356\004\215\362\035\242\275\213\366\236\221\243"
+	.string	"]\224,\2332\374\350\223\243QP5\027uaTj(\2248\027+|\210\ta\356\b\2244\254\003\243\320C\255\356O\\012%\253\211\205Rc\345dI\207V\225\253\324\341\2751A\177\310\004!\302\332C\317r\023\031W\017\026\327\214\253-\311\236\216\262\274\321#-\2728\262\n8\320ey5\206\272\330\242\203\311\212X\216\221\225^\210\2608\303j\340\276\244\204\335\214\206\375h\204\322\2503c$r\034\n1\245\230R\312L\ri\222tS\024@@\210P(\035N\207=\037\023"
+	.string	"Q\210\003\3628\fC\207hf$IJ\205}\266\003\036BA\355qO\214b\212\244aT-\003\025Cs\341\247!\225\rd\326MD\230\352I\017$\3376\256\232\006\341\215)\207\226\223Ug5|\267rO\300&\001\004\0264*\307\375=M1"
+	.string	"\\\341\211\217\201\217\324\"!&22\321S\370\226\226\244Ost\2656r\367\335\373\031\034\341\315N\377\333\034i\034\312F&\256\2319\330\020\370\270\316\333\247U\351\250l\301\315\313\315\306d\201\332\323\345\343M\352F7\204\334f\024\024\247\205EZI\021\315p\266\222\017LB\317c\211\263\n5\266\026\0218\261\334\241t$vU&J\234\356\340z\270\374"
+	.string	"\232\210oPI\r\250P6\206\232\f4\317\240\016Y\306\307\024q6"
+	.string	" \r\274a\002H\021L\t%\227\b\216M2\b\270FN\033\220\3613\240\235\344\251\f\376-\026S\377\344\353\363'R\214K\336\343I\302\220x#\320P\254F\317X\265V\035\313+\031\032\025\221#r\231\005\212H8\235\321\n\243Dh\211\322+\240\r?']\373\327\256K\223\312\021\231\033j+0E\213\005\207\234\006\332\017L\325\324`\221\007\215)$e\371\370\212\227>\034)\237'"
+	.ascii	"/\031\354B\307'.V"
+	.string	"0\236\361Z<\225q\f\265\036\005\036\345\306\275\201\024\246J$\b\211u\257O\t\214\221\020\254\305F\346\233\337-\2373v\247\250\035\366\311RJ\275\220\250\017eO<\361Xe\265\020\002\267\b_\006\372p\361\237\317\023r\t\032\246\265\002\323P\002v\213\342\3549Xv\223\216\247y\225\030\315\211Qy1<\242M\352*\023{\240:\333\322\271\220\204\327O\342\245\243Dn\274\2534e$z\234i\331[-\035\250W\224\254e\363\277\276\302\252\266g\344\3418\371\373\325\215m>\020\355\353'\313\271!f\204\361\270}\ffu]\303\t=y\310;C\322`\266\026\263\223ak\260\264\342\002\360\231\300]\220\236\267\030\034r\004-A\013H%[GMU\325 \026e\02297\312d\001\257\246<\331\307\356YYP}\236\213\002\301\343\302d(TI2\360fZ\215N\004\023I\234\245#\013\266\246\037\007/f$\266"
+	.string	"\277\317\334\033\022\347\266v\250\240oBy\260\345\013\025\205\273\017\0079\266\356\271\034F5\240\030\3159L|\257\027@\343\330\231\206\332Ln\223\225B\004\no\240Eh\304"
+	.string	"\266\300\265_\341\230\020\370\217f\026\335\376\3721c\304{l7hT\026V\320\035\310[h\026\034[]\313{93\373\022j\017\321\223E\273\215x\302\342F|mML@\372h )\355\205\210\267u\371YH\350\002\016&\370\254\312\326\200\371\3620\232{\314\004\225;\n\223\031b^{#\3462D\f~\023\t\246$\321\330\251\234\327\033W\267+\314"
+	.string	"W\316"
+	.ascii	"f \245\226\234*&>q9\0065\345\327\262\367\311A\370+\351\351SL"
+	.ascii	"\223\334!\007\304"
+	.string	"K\001\035\352\365\006\347g\376\256'\322\224%\326>H\307\004\3606\214*%G\034\023T\346n\2573>\025\351\356\025\352-\241K:o8^\356\034\220\227\375v\223\001\267\351P\327\245\247e\306\323\306C\252cB\210\013\346\202\001+\023\370f\306\342\310w\005\214k\242\252m%\025 \301\330\204\362\250\262\017\333\304\273\365\206\325_\013\253\224\020\251\352]\335t\341\334\037\f\206\336[\221\3627\035Q\347C\no6\272\247\355%\215\r\344\321\353\"\350\343\030tV$\230\t\271\241\346\0271H\326?\3559\202xl,\370%\365\3168&Vl2h\3169\024(x\030\222dR\321\001\\\244\377%\306.\302\017\344\200\004\026#\332\372\036\240\316\2258g\364\314\360\240`g\325\270\031\241\204\nE\227\020$\366\322F\211q\\%{\357\267\322\310\337\2439\315\370\255\0016\347'\214\263\016\266"
+	.string	"1\3076\343\247\177\30648\007\201\370\305\277\237\233-\342\311\265Xb\320\234\337\307$\330\233f\316i\262\024p\346\370K\314u\017\362h\265\323U\240A\252\243=\220\233\3222\336\212\263\325mC\311(\013\252\237YUoy\306\024\020\271\b\206\2057\272\224{C\r)O\227\027\242\215\303l\265\225\037\030\313g\310\331>B\325\013\212A,\257\016\250\013+\035\377\016s\374+,\340;\333\0061g\353w\252\214\034\372\214\371\205"
+	.string	"\277\213\306*L\264=u\200K\325}%\231u\017\345\314\223.N\355"
+	.string	"\341\346[dQ6\374\272uwQG\350\326\317\236U\210\350\301w\360\036?e\345\210\006D(]\240\343\332\205<\265\235\002+\244\034N }\264\032q\213&x\372tF\2406(E.m\t|E'\222\306<\213\251\301\311\020U4\245D\215_I\213\353\202\007\350\017'W\201]\tn\b\374\330\267\312M\256\236\365<a\261u4oI\247\256\356\275x\2774K\376$\311+\213\364\030\350\317\261t$\2317\270\277\006^\217\335\321\2222\207\274dJ\037\260n\3658dp\324)\220\3243v!\030\325\024\255\b@C\201\306"
+	.string	"#\361g\007\275\023\025\025\005\300|k\337|\353\334\223\344\212\331\324(\347d\325\326\2109\205.r\314\242\334\322l\340\216(A\304\200$\031$s\251\327\332(\305z\213\210\300\224\325\314C\352\002\332\f\233\323\301\271\207k\006j\215M\021M\004\021NNcU\302rh\3475\"@\241\3053\325\021\367x\324|d\230\357|\021R0\347(/R"
+	.string	"\333\364|2?\252]\232j\301p\330\327\334\212N\320\017"
+	.string	"\257\003\212\2715\031P\002\202R\016om/\013\244\256[\346\314\317\005\262\362\322\346)\344\0340\004V\n\300]\351s\310\263\f\340\301\337,\244\244\263\303a?5O\2605\322\210k\304\\\217\237\316\213\317\246\274S\253;(BC0\321\343\344\375\227\340@L\3478K\345f\310\212\333\271\334\251\2653\304\027q\016\330+\033\246\351\327\034];\377`\001\374\021\322\247\265\312 K\351\\\0256de\352\220\331\026\025\272\212\017>8\266\264H\217\311\210\221\340 \354\213|"
+	.string	"5\232\231\307[\313\200\007\277\310\315\022\203\024\306Or\020\231\375\312tM\003ViqB\231\246\037\tw\204\210,I\226\177\342Vy==\345\272\243\211v\311z\205\017p\245\353\001\377H\r\024\300\0313vS\356\332?$\236i4\b\201\203f\272\016\341*\376\272\341\211\250\034\001\227\266v\006\t\355S%\355\350:\374o\0323p\302\267^\336\367\001.7\321\221bu\305\026\231\336\265\355\332\225\306+\260,\f\331=f\327\374\232\231\205.\357\350\252\371\037\2337\257\344\377\002pH\177\\\366\350\332\272[}\332\254L2v\303\33727\351\235"
+	.string	"^Z\215\204\214\205\007\263a\013\246\257\345zBpq\374/M\326`\357\317~\251\320Pq1a\264\210\3507HP\246w\030\0050U;\207\332\372h\303I'\212;G\207 \200\275\017+\376-jcx\317\252\344{?\354\027\330\314\0046\356\345\032\275\037\3625\205\036\224\220j\261\001^\f\214|+\204I\361\224\332X\232,\274e\222\377\361\224\263\020\314\306\302\362}\213*\321\232\345\252\300\021tKC\272\004\372\013\3627\024BP\\\036\234\203\233\347!\305\360;\031V\202\343.C\226\267\201h\305\316Xg5\016\312 _\302B\263\222\313@#\350=\345\n\227n\226W\023\254S+\fJ\265\217\363\f\031\030\302\022\200\314x)J\216\377+"
+	.string	"\264\270\n\2372-\221Q\235R\264\026\273\342\267\265:th"
+	.string	"\021\367S\217\027m\204w\252`C,\257\320@\355\367\277y\001\006|\301\367N\001\030H\353\364\342\376R\373\22197\341;Z5\2779\260/\002\255\022l\364\316\0270\334\334\246\370\340YU\024\356Z+\353\314\226\231\224r\261\261\361^\001\306\226\247\342u\347T\t(wX\3425\226\005r'\252\"\215E49\370\222\024e\330o\013\363?=}\230?g\327"
+	.string	"S\314\226$\262<\023\205\n\\B]\212Ek\304\\\234}\340\3145\262\211\177{ n\250\276%MDi^\325\030\266\313\304\027\032\030:\3336\001w\333\214\373\236tL\311\373\225\326a\234\3622`~O\006\204\013\026`\343\br\021\022,\t\007\222\374\227\202\313\234\023DLf\013H\203c\364(\002\324\207R\207\030*all\231\227e\327\221\226\274\365\313%\241\237\007S\221Ds\t\351\237%\270\313\254\201BO\240\034\246\202\257\312UD4t\317hf\b\377\373\315{\366\307\253v\233\345\217\177UV\373X\327\303\262\006\355\3358\366c\324'.\236E\301KhU\327\311\031z\343 \177}\206\224\377\037\366\237\267;o\377\2677"
+	.ascii	"\260\r\374\214\277r\277e\034\332\324vv\2246#7\270\201=\203\370"
+	.ascii	"\370(\247}\357\326\031\017\377\262.\360a\340\t1?\316\227\326"
+	.ascii	"&\376/\336'l9\3437\357\366~\3413\273\325\265\316\211\333B\371"
+	.ascii	"pq\320,|\177\035\006\037\373\026\275Nc\3164\357\026\350\366\030"
+	.ascii	"\373\306\266)\265h|Y\034;o\370\250y\375\267SQ\317\312'~\263\314"
+	.ascii	"U\257\334\270p\340\031\367\013\031%\177$\205t\005"
+	.text
+	.section	.gnu.lto_.symtab.3cb7101f7a63e28b,"e",@progbits
+	.string	"pgResetFn_voltageSensorADCConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\002"
+	.string	""
+	.string	"voltageMeterADCStates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\002"
+	.string	""
+	.string	"voltageMeterReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\002"
+	.string	""
+	.string	"getVoltageMeterADC"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\002"
+	.string	""
+	.string	"voltageMeterADCRefresh"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\002"
+	.string	""
+	.string	"voltageMeterADCRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\002"
+	.string	""
+	.string	"isSagCompensationConfigured"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\002"
+	.string	""
+	.string	"voltageMeterADCInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\002"
+	.string	""
+	.string	"voltageMeterGenericInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\002"
+	.string	""
+	.string	"voltageMeterESCInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\002"
+	.string	""
+	.string	"voltageMeterESCRefresh"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\002"
+	.string	""
+	.string	"voltageMeterESCReadMotor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\002"
+	.string	""
+	.string	"voltageMeterESCReadCombined"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\002"
+	.string	""
+	.string	"voltageMeterRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\002"
+	.string	""
+	.string	"voltageMeterADCtoIDMap"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\002"
+	.string	""
+	.string	"voltageSensorADCConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\002"
+	.string	""
+	.string	"voltageSensorADCConfig_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\002"
+	.string	""
+	.string	"voltageSensorADCConfig_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\002"
+	.string	""
+	.string	"supportedVoltageMeterCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\002"
+	.string	""
+	.string	"voltageMeterIds"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\002"
+	.string	""
+	.string	"voltageMeterSourceNames"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\002"
+	.string	""
+	.string	"batteryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\002"
+	.string	""
+	.string	"pidProfiles_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\002"
+	.string	""
+	.string	"pt1FilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\002"
+	.string	""
+	.string	"pt1FilterGain"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.3cb7101f7a63e28b,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,2559 @@
+	.file	"target.c"
+	.section	.gnu.lto_.profile.daf0effb8d047246,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.daf0effb8d047246,"e",@progbits
+	.string	"(\265/\375`\341\002u\023"
+	.string	"\204\035\325\003"
+	.string	"O"
+	.string	"\226\342\223\316\016"
+	.string	"\001\327\346\357\377\002"
+	.string	"\002\336\327\276\377\017\002\002"
+	.string	"\002\001\003\257\231\321\314\002\004\337\313\242\204\n\005\202\321\322\374\007\004\002\003\006\240\342\234\212\n\007\b\232\246\323\206\017\t\n\261\263\351\341\005\004\013\f\233\364\264\234\017\030\002\005\002\006\007\002\007\b\002\b\005\002\006\017\337\333\256\234\004"
+	.string	"\020\256\234\262\364\013"
+	.string	"\021\022\023\337\323\354\234\002\020\002\002\002\003\002\t\002\n\024\242\302\263\302\013\025\222\221\202%\b\002"
+	.string	"\002\004\002\013\002\001\026\342\246\207\300\013\022\002\f\r\002\r\027\352\263\360\321\b\032\310\373\201\350\r\002\033\223\273\300\245\013\002\002\016\002\016\034\366\362\212\240\007"
+	.string	"\035\036\251\306\315\231\b"
+	.string	"\037\244\232\317\300\b\004\002\017\002\017\002\r\002\020 !\"#$\266\371\250\343\t"
+	.string	"%&\260\200\235\264\b\002\002\021\002\021'\275\327\256\211\003(\301\325\215\205\016"
+	.string	")\274\205\242\255\006"
+	.string	"*\225\221\315\200\006"
+	.string	"+\210\377\206\247\006"
+	.string	",\271\303\275\241\r\n\002\022\002\023\023\002\023-\230\336\335\312\001.\220\364\300\371\007(\005\002\005\002\023/012\315\343\301\244\01334\263\330\307\3135\261\213\233\205\b\n\021\002\021678\264\251\257\307\f9:;\367\267\311\301\004"
+	.string	"<=\222\321\201\352\t\b\023\002\023>\314\345\244\232\005"
+	.string	"?\211\307\340\277\f\002@\362\357\204\233\017"
+	.string	"A\202\220\306\317\004\020B\333\217\352\217\004CD\313\322\375\213\007"
+	.string	"E\310\342\324\f\003FG\303\272\266\211\013\002H\317\253\250\341\002"
+	.string	"I\351\361\317\236\016\004J\227\227\247\303\t\bK\341\274\276\362\017"
+	.string	"L\265\300\331\214\001"
+	.string	"M\351\377\201\334\001"
+	.string	"N\346\361\327\375\t"
+	.string	"O\324\365\343\372\002"
+	.string	"PQT\240\342\234\212\n"
+	.ascii	"B\250\341,\343\baLM \"2\233T\007`\002b\214l\033\021\320p\023"
+	.ascii	"\324I\020J\313LZ\003Q\221\374U9\004|\314\221Gg\232B\"\212\353"
+	.ascii	"\305E\363\374\301,|\215\2534\221\3762\")\231Y\261\243\333u\253"
+	.ascii	"\355]\211\343\244\3402\255\234v&\3139\273N\257\342\203c\353\331"
+	.ascii	")\365\006\257\301\316\237\340\313o7'9i0\334\346\351\026L\344"
+	.ascii	"y`g\251\225.u\2034=\375pb\233?\"\247\362\316\355Z\017pON8\214"
+	.ascii	"\374$\253M\263;\237\003"
+	.text
+	.section	.gnu.lto_.ipa_sra.daf0effb8d047246,"e",@progbits
+	.string	"(\265/\375`\223\001\205\b"
+	.string	"b\213! "
+	.ascii	"Y\222\016\374\273\364\377\377\377\377\265\242\037\212\213\204"
+	.ascii	"7F\261\275qF\021\353\272\3668B\344N)\356\266,\313\236Vj\267\312"
+	.ascii	"RP>\231I\r\225\220\314\221\001|\\d\310\301\224\246v\304T\246"
+	.ascii	"j! \037\277\207wplh\350\314\300p\271D\025\024;'$*b!6?\354pjx"
+	.ascii	"A\241\234\t\353\016\341\3405\313\024<\273K\004\242\321\253Iw"
+	.ascii	",6;\f\251\fj5\260\0056\3009M\264\365\366\302z\tL\250\200\024"
+	.ascii	"J\222J:`\002AG\305\003\020p5b\\\330\r7B:j\270\200\273O\220\021"
+	.ascii	"5MB\302o\036]\323\376\n\027\215\033/\264m\375\"\325@\005E\356"
+	.ascii	"\016H\0013\023#ppx\020I}\001?\025\024\2106\327\341\023!\n\001"
+	.ascii	"\371OuY$\225 \217\037\336\245\")\264q\016|\220\330\320\304\032"
+	.ascii	"d\220\240\303\316\365\t\004Z\301\336\177\013\335\217-\304\266"
+	.ascii	"*=,`\247B\274\363[\034$K\265\272F{c"
+	.text
+	.section	.gnu.lto_.inline.daf0effb8d047246,"e",@progbits
+	.string	"(\265/\375`\236\013e "
+	.string	"\306\242zI\300\324M:\250e\200\355\344\320\316\264M\330\334\316\301\b\330j\226`\353mX\334\222\004\235z\364\301.\002\244yEQL\212\330\032\324\212\206\240`\202\204\350\350\272\3458V\355\236zxP\313\354\342d\033\221&\355%mo)ST"
+	.string	"g"
+	.string	"r"
+	.ascii	" X+=\353L\3173;2Sw\177\377\214}\272\333\245~\266m\376\305=\377"
+	.ascii	"\342\375\374\264a \335\rsoG\325\273U\245\313<\257#\333\272\273"
+	.ascii	"C\221\361\352*\372\237\377\345\223\245\247\341\363Yd\3567\321"
+	.ascii	"\335\264\177\376\027\300\373\375\024gw7\375\035\334k\021\005"
+	.ascii	"\376\345U-\315,\213\210~J$:B\274\021\354b\352V\223\360\001,+"
+	.ascii	")\365*d\312C2$\371wq\017\311\220\fI\246q\277\214\311\036\322"
+	.ascii	"\004lxiI\221\241\027=v\272\263\311\242,\245@\236\315\033e)\305"
+	.ascii	":\354\337\371\317\256f\276\360\233\204~(i\271\311Ge\023\300\301"
+	.ascii	"n\317\342\3773\216r=$[\252\3631\336\245\261_\310Q\013\"\3021"
+	.ascii	"Q\320S\223\367\230\207d\363X\250\260\337\217\036\005'!\332Aj"
+	.ascii	"\251\220\340\025Fj9\001@\n\023\016\023\001Gw\233\034\302\203"
+	.ascii	"\333\220\323\324JI\306\322\217\210\034 \251\233\003\201\fX\216"
+	.ascii	"\272\033\006.\330\313Vf/P\201-\301C\262\021\210\363\007x^\\\226"
+	.ascii	"\326\360\223\201]\027\367\237c\034\251\361\240\023J\205\017\333"
+	.ascii	"\367\017\021\3762!)N\033;\206\222*-E\307\247\206\222\357 >\354"
+	.ascii	"W\250\347E\017\317\251\007\306\311=\2103(\352\304\214\312\337"
+	.ascii	"\tr\223\342{\007\016t\351\314\244A\203\232\342\327\213L\351\312"
+	.ascii	"p(\\\202'R\222\016\245\3257\320Jw\216l\323\220\341\177\037\341"
+	.ascii	"\030\335:&\034\243[=\206\006-- \350}\344\326\353w\354<\206\361"
+	.ascii	".?&\200\377\250AM\305h\206$I6\326`\002\021!*\253\016\022@C-\t"
+	.ascii	"\263\2401\312(\"\022L$\201\310\004#\031\322\2465\340p\336\017"
+	.ascii	"\260\rjy\002d\245\305\006\264\275kx\211Z\001\024\0349\205k\305"
+	.ascii	"\026Ha\t\002\177,p\nQ\267QR&6Rvn"
+	.string	"d7$0\360?\006\270r\220H\266y\212\333h\313\0343\351\236\206\214\270\3111O\210\315,\003\037\0060b\307\361\274\231\206\222\264\022\324\361\352,Z\313\0361\306M\357^\003\312j9\202C\371\313~~\277\353\2169:y}\221\317\257,\260cn!\215)$h\1779\331\242\306\332\204[\324\006\234:\2614\366\013Z`\373iX\366z\345\367\b\252Eu\275\243\304#\254\204zW\271\326}sBKC\233\325\240rTr\\\210[B\030\223\321N\333}\016\332\211\301!`+\271\020OHS\202\275\322x\321YDC\320o\304\0047\322\372\335\021\324\260\255\364\255D1\261\215!1\224\fV\371\200\340L\031\223\242\266\2730\267N\024\360\f\f\301D\267p\366\347h\310\032\b+\003\035C[\212e\b\"\200\335E\263\366\007^\005\r\002v,gH\222\353Ix\035X\355|\035\352'\300u\317\214p\256\212\354\315"
+	.string	"%^\240\304t\016W\204\233p\216\b\237\033\350\\+TVr\367h\177>?\b\240EW\375\345\036\303`Jl\035\337#f!A\230\222t\263\231\371 \004\317AS\002\207\250\344;\335U\263h\177\203r\300\365"
+	.ascii	"\007(\005\325W\232V\013\n\314\307`w\035\247\323y!\203-<-\005"
+	.ascii	"\274\264e\f\320GC\345~\225\234\242\034\244\360z\255fpTe\023\210"
+	.ascii	"\354\355\352k\022\317\b\203\006\300s$\225%-\021\003+\364\335"
+	.ascii	"\337\201\327\235\241h\024|d\370\325\350Mt2Q\224\020\322dY\"k"
+	.ascii	"\002\275\233\226H\005K\306\343\276#\325J|\330\200,\\!Y\263\036"
+	.ascii	"\334\361\224#Ss\244R\247\261\001\n\276\3341\335*\347\236\n~\235"
+	.text
+	.section	.gnu.lto_.jmpfuncs.daf0effb8d047246,"e",@progbits
+	.string	"(\265/\375`Q\017\r/"
+	.string	"JA\334\rC\240\3566\007p\303P\\G\005\035m\205\347\341\265\3179\365\201\353\210\307\322C\345\327\330\342\263m\202\240\211:\354\016R\255\237\257f|\300\024\362U\0221\375KPWP\226%\373\206\005\241\221\020[\264eJ)\273"
+	.string	"\314"
+	.string	"\320"
+	.string	"Ol\352i\262\233\361\207bSw\002V_\022\305\2466\260vSl\032\003\253\237\361\337A\305\246\037x\273\335n\355\236\253t\017~\265\377\336k\332M\367\335e\261)\003\260\346\254\305\246\005\300\312u'@po\367\346yK\367\317q\336k\272\225\177\206\320\006:(\310\273M\367\265\007_\035\214\373\027\177o\032\377}\355\272\203:\273g0\335{\347g\271\027W\267\214l\352\240\003\325g\360\335\356\247.\356\\\334\233\232\034\3251\335|8\252{\317\236\237\013\323\316\205\361n\333v\301w\367]\335\177"
+	.ascii	"\312\353\016 d\025|F}>\271?P7\327\375\n\\\350su\357\f\375`\272"
+	.ascii	"\t\244\001wl\312\001\001+\207\342\373W\231c\312c\323z\007\254"
+	.ascii	"\234\211\367w\247\320=\001\317\033\tv\\\335b\322c\323:\306\351"
+	.ascii	"\270\021X\247fa\342\323q\275\212\360\022\"\204\206\353+\203\357"
+	.ascii	"\324\023\325F|\345\344\370\260im\022\347\207M\253\220^I\221\002"
+	.ascii	"\304\246\357\007\254_\020\233>\034\260r]fJ\231)Cht\310N\304\246"
+	.ascii	"\217\006\254\234\273qo\343\255\257\257\356;;\207\257^w"
+	.string	"\315\202\177\366l\304\b\323\206\257\335\265G\322}\206\257\226\215\253[9\211M\377\n\313\277\255\365\254\244{\256\333\201\207\361\006.\306\213\026\364\251\251\251\251)s\355\371;\365\356\235\231\330\364\213\200\265K}\036J\021\021\371\201\356/\370;\261\251\327\001\253\355\036\n\027\246j\357T\335\016\030\035M\035_{\021z\245\243\266\207\312\260icB{%zE<\033eJD\355Y\270\342LuA\\\334c</\013<U\340\025\261(+g7i\311F9#c\314H\361\302\005;\201\024\366\312\254M\2165BZi\3260\026\320\337'\222\370\2122l\342\200Q\216\247\376\003d\345\250O\223X\213=pl\nt\244\3057\013\026\234\035\260r\251\367\241\317\002\334\0376\264\202\214\277\231,\307\246\234\232Vq/\207\245_\250\024\235W|\243>\013}V\361\375\301\335\235C\241\300Dw\211\027\2116\360Y\204\273WW7\2009"
+	.ascii	"\346\370k\204\210O\205H\201\350\356\017\335\355\241\273[\335"
+	.ascii	"\275A\003W+\270\263\272\367\352\036V`\355\b\215\216\344\353$"
+	.ascii	"\307\230\210O\033i;\265H\216$h6\023]\302\265\223@\037\275b(n"
+	.ascii	"\214Jdit\364\"\320\336\207o\2202\363*\225\027\265\2259d'\252"
+	.ascii	"=\030,F\213\013"
+	.string	"\342\273\342\211\333\301,\225.\216S6S\272%L\300\356\t\326\375\276/\t\213%\013l\332\220\020\230\2306\242H\247\376L\264,I\2240R\375\241\370\304.N\035\206!:\222\257$\032FO\036'RP\255,g\027%q\016\214\352\013aQX\024r\300p\301[\"\307\231\355\210\246#v\321\221\034S\355\211\2520\fM\234\303\304\347\215\225\210qQS\206\236B\375\231\245i\342k\342%\263\224Q\216\327H\250\275\035\255\242\232*I4K\0314\231y\2434c\r\332\023\261\355\242%y\3171\201\023\250\001E\305L\r\211H\222\202$\033\007\321\004\2040)%\264;\022\300\201i\016\2439\0209\303\b\231!\021)\221$EI\2451_O\n\031\343\255)\256\335,1\316\232\330-8\347(\333\213\264\203$\366\237N\352\273>\020\021RM\271\343\251=\357\337\340\024N\005\243\241t\177\022|\304e\256\013\314\272*"
+	.string	"\203\260\244P\032\306\206k)F\004h\230\226\020\232\206\004\207f\211$T\362R\240\366\273\250\375\2441\362R\262\305\354\005\244+`\232\244N\024\201\302e+\317\266[l\026T\031\026 o;\027\203\316\035rU\370qX\252\034\n\024$\265z\215\241t\277%\216(4\213>\326\362#q\037\275y\027\221\313R\367\272\244\313\341\325\320YML+\314+\022\221\357\006\247\r>\270\346\213\325K\322\327\211\t=\343v\311\211Y\377\251\301'\222%W|\214\212.\351FY\3238k\370T\224681\003\204\225\344q\017\r\003\0263!\016RP\363\235\177\320\334\265\365"
+	.string	"9\226\321\023\242\305\311\203L\265\360\236FH\355\374\017x\023\304<\016\251\222\363V\016\324hv\017b\357T\230c\247\317\237#\3172\353d`N\327\335\367\246\334!\3308\021\324::\252\211\305}k\262\355>\220i\241\243o\321ZR\324\n=\021n\316?\3061\347R\027XY\206\241"
+	.string	"R\t\214\305\302s?\214\253\004\237>.\206W\221=\232&F\233O\202\34177n\246\257}\203`ko\n\302\314\302fcC\217[vg\210\213\007\376\200\b\225\221\262\367\274\314j\257P\267\322~Qf\007!&l\226\240\034\004T\226\004\255\270\354\373Pf\276"
+	.string	"u\002\031\217\374\323\325\332 i\032n\001\263\317@\340\360\231\\u\206\211\367\255\364\027\340\264\216\242\300\236'\251\314P\332\361\206\016KUi\246\036\375\242\2776\306\001>\352\210\335[\243(\n\005@\367E\213\226h\003\020\007]\r]!\354g\301\262\001\002\327XAL1\016\n\273\274\330\247f}\203}m\216\032\236\346\035\b\352\361\214\360\005\263\262sf\362d5\361\\\220"
+	.ascii	"1bW\313K\267\251I\314\343\371\024\232\237<\354g\266\241n9A/\204"
+	.ascii	"\225\034\274n(\003\275A\017;\351\320\323oR}>\013\240"
+	.text
+	.section	.gnu.lto_.pureconst.daf0effb8d047246,"e",@progbits
+	.string	"(\265/\375 \235=\004"
+	.string	"\322\311 )@\255\322\030]\303\260sd\341q\002\307a\030\206\341'\277\245\253ev\236\221c%Wt\243\335\377\373\035+\270\206\"jm\007\267\306\235qc\334\0272\213\273\302)d\023\032\t\217\220A\370\203\224\203U\2033\370\202\035\n\236\340\b~\340\006^`\033p\001\017\270\001\216\243$#\335\243\233D7\205\254@\367\307=\3369\212\343\233k\031\307\370\305-w\305Fqc\342\022\217\370\271\016\221=d\213`\255\325\002"
+	.text
+	.section	.gnu.lto_.ipa_modref.daf0effb8d047246,"e",@progbits
+	.string	"(\265/\375`\366\002u\f"
+	.string	"\026\32000P\345f90\245\253\252\252\372\316\314\314\314\314\263\252\252\252\362w\320\246!f\004\246\233?9\024\331\211\200@c\337#\267K\326\035CC\310N2\005$"
+	.string	"!"
+	.string	"\""
+	.ascii	"\222\326\300xy9'\347\2712\305\271@Gn\256\021\f\b\2502\321S\024"
+	.ascii	"\020\263\306\214:\3203\364\334"
+	.string	"B\n@cX\360t\236\235\216\n\352\347\371\331\231\236\246\267B\257U\302\223\345!\250\007\317@K\317\322\216\364\002c\\P:\313y\236\236\335\351y\232\263\n\nkW\275/ob\2278B\210\007uy\016\353\337`\313\001\246\240xb\002\262\204D\035Q\317|\\$D\275\254\253j\257m\255\321h\023\200\002\331\207\352\321\261\216\303\r\215\214e\250AAt\350&\225\302\260\035`\202AFV;\021p-B\020\226\264T\332\332\f\370\023\220\274\344\301-\3513}\023\264\366%\341\214\020\324y4-.eI\341\354kE\223\300\266u\250\371\232UZ\352\034\254p\235\252\362+>%_\366\365\226[\232/\205,\237\322kk\030\271\240\300AA&\203\207po>\326>ma\375s\313\313w\331\245j\022\342\006G\211\365F$8\204\331\2770\025\304!\204\314sl\234\321\341z+V\017\035`!\376Y^\tG\211L"
+	.ascii	"B\217SjQ\007\364*bh\235\225\3548\027\332c\212\024co\215\036\004"
+	.ascii	"\232\023 \253\302\301\231O\314\372(\025`\005[\215\215q\271\204"
+	.ascii	"\306\276\363\b\220\001"
+	.text
+	.section	.gnu.lto_.lto.daf0effb8d047246,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_lockMainPID.71.daf0effb8d047246,"e",@progbits
+	.string	"(\265/\375`?"
+	.string	"}\b"
+	.string	"\346\020<5Po\322\001\305\240\263|\217\r\276\252\217\210\343\224J\230\310\331\370\253\316=,tkB\360o!b\2002fc\013\004\020\246\001~kw\220D\007-\333\233H\231R+"
+	.string	"+"
+	.string	"-"
+	.string	"\031\030\"\023\226\335\215\327\005\340\237\365"
+	.string	"\370\247\033\337\236\233\377\220?\025\351\304\215>O\200\203\335ur\243\213[o\233\3006f\033%\037\273\373\244j\330\267VK\266\246_\246\363\351\303$\235\230\276\362\262k\261r\331\224\207\362\260\275\331\031\037\344\246\315NY\035\307\350\001\232jP\242rB\205reLZw\n\026\374\"'\3210\273\240s~\367\021\n\277\343\317\021\332\3635\370gKL\344\271\253v-\037\025\032\336`\t\013\b\n\321\303a\3104\236\370\320\240q\210\233L\213\330\345\016\004'\213\236N'\213\231n\257\245\247\027HCN}z\221\n\224+\373\003\360\001\n"
+	.ascii	"{\311'c1\2153\305\352\205Yf\300\256\211\305#\210\026\"\023w\305"
+	.ascii	"\324N2"
+	.text
+	.section	.gnu.lto_sendMotorUpdate.72.daf0effb8d047246,"e",@progbits
+	.string	"(\265/\375`'"
+	.string	"\225\007"
+	.string	"2\31636Po\322\001 [9\245\240\250\213\020\264\"\021\262+\206\211d\252\226\226^\206Y\202\030\211\037\004bH\031\255w\265\001\3245c\372\301\3645\f\032<\006\355&eJ\001\366P\b\n\007\t\020\373,X\035\f:0t\032\240\307\272 E\340\352\341cA\254\252,\270\341\366\231U\221\201K\007\322\nkR\340N\231>z\3115\300BrR\005q]\323\337G\347\262\200]\320\243/\362\221\b\277\343\317\022Y>\376\371\331\364gOP\344\243\323D\245\263\320\315\346\266T\r\373\231U\221\255\034\220\257\224v1b`\266{(\037\266\277\261f\267\234\343\330\223<.J/\273\013u\343\332S\363\037rM\fmO\200\202\335u\306P\306\255\267\315\261M\331>\t\f"
+	.ascii	"{\3117c\332\371\206\217Lc\300\021\200\361\036\225\241k8Y\b\343"
+	.ascii	"e\bp\351\026\355|\002"
+	.text
+	.section	.gnu.lto_updateSensors.73.daf0effb8d047246,"e",@progbits
+	.string	"(\265/\375`\357\006\315 "
+	.string	"6\374\313F\220\226\316p\300S2\f\355a\303\302{\221\331\331c\260`\023#\322\234;\360\317\371&Yq\tE\253\367\256\206aA\223\005\"\201"
+	.string	"\206\246\005^\004"
+	.string	"fb*\361P\270\253YDDDDD\0345z\223\275e\222)\254"
+	.string	"\237"
+	.string	"\307"
+	.ascii	"\226!\357\230\3370\277_~\373\310\333\205\274[~\367~\233\277y"
+	.ascii	"\344]\2227\371{\177\377\267\0068\013\271\027S\206\0209\333#\307"
+	.ascii	"\023\304\335\225S\256\204ka[\331\314\326b\312\306J\250\315\335"
+	.ascii	"\340\221\246@F\314P\032\033T\206W,\316\247\245\275\301\366i\311"
+	.ascii	"\363\331\376\321o=\250\270\235\347\t\364\223\336\326\027\212"
+	.ascii	"\246\24508(\315y\222\305\271\235\347\021haOK\037\025\207\247"
+	.ascii	"eOmxZZ\313f\242\307\262\323Dq\006Vc\312y\236\302]\241Zz-\253"
+	.ascii	"\306\320\2260\261-\2759\340<O?L,\204z\325\366\317\266\003\333"
+	.ascii	"\254\020^\347\311\365\373\356\2325\276\\t\375\316\272\337\307"
+	.ascii	"}=\261\001(\3340\252\354<\275\246l\013\372F\354\235\247W\224"
+	.ascii	"\233\226\212\242\016\235\231\226V\016<-u/xP2\206\006\307\365"
+	.ascii	";\373\330\365Ma+y.\231M\336S\344-E\336Q\344\375D\336N\344\335"
+	.ascii	"D\336B\362\016\2227Pa\250\0020o\246\337K\346\255\364;\311\274"
+	.ascii	"\221~\037\231\267\321\357\037\357.\"o\"\362\036\"o!\362\016\372"
+	.ascii	"\r\364\373\347\267\017y\367\374\346\371\275\363[\207\274s~\343"
+	.ascii	"\374\276)o\033\362\256!o\032\362\236!\037;uC(::\235\272\017e"
+	.ascii	"chpN\373\224\263N\253j8\233\203\304\256\216\315D\224\343\361"
+	.ascii	"\264on\026g\315%_.\272\212\f\241$\350\\\331\315\302l\315Q\201"
+	.ascii	"\233\371\314\322l\315\332\254MUu\r\363\020\330n\331*\247B4X\315"
+	.ascii	"luu\r\273\342ii\263-#d\266\306eiV\303\236\224;\363\026\244\353"
+	.ascii	"\210\332\223\250-c6j\365\006\314\306\274,\214o_\324\207\306\375"
+	.ascii	"\270\226>;\035*\265.9\264e\245V\323z\333bn\217\267&Py\354\340"
+	.ascii	"\255\306\320+\361\320\244\303\2715\2652\353\177E\271\273S\353"
+	.ascii	"\340\221;\265JC\177psm6\322\354v\311U\034_@\336\324-\211\t$k"
+	.ascii	"_\\'N\333%\246\020\314\242`\244\"\n1\024\211\304bU\017q\270\200"
+	.ascii	"\312x\301jB\317h!\303\272*x\200\001\201\005B\243\325\025\026"
+	.ascii	"\225Q\210aHE\024Vae\t\203C.f\260\302\022\032\213E,\241\357\310"
+	.ascii	"\245K\346\002gr\\\333e\237\033-\322*-\323\332\006\020,-S\226"
+	.ascii	"!\024\026\240\245\205JZ%+Cm\253\" i\265\355h\221\246\f\225\211"
+	.ascii	"\224\035G\253L\352~k\264@\260,A\2052<\016\272\004j\247@\243\374"
+	.ascii	"\266$!\242l\f-\347B;\264D[\264v\203\007M\324I\026\204\b\021x"
+	.ascii	"Z\026=-Q\323\016\005W\310\bp\203A\013\\e\003\332\240\237\005"
+	.ascii	"Z\023\212\317\376,Q\342c&\334\246\236\025\256\256\361l\317\316"
+	.ascii	"\362\254\tEg\003y\250Q8\343\2311D\223\024\024\024$i\326\360\002"
+	.ascii	"\221\031\342<\021\360\240r\216!Bm=\263\031c}\337\363?p\327\255"
+	.ascii	"l\371j9I\021@8\332$\360\0011\301kf\201\313\202\317\030\017\260"
+	.ascii	"\327\370\0213\260I.F/\303\330SDe\021\275\313w\207\354M\314\275"
+	.ascii	"\nZb:TFLw\233Pnbfa\240\022\b<\274\242g\254\n\231\210!\b\220\304"
+	.ascii	"\005\342\031\261\336\3036\204P\2164\322{>\260\\\001 \201t\362"
+	.ascii	"\350\231\030(\375\233B'\035\341\024D\003*\232\253\216\252\247"
+	.ascii	"|\364\037\274\330G\f\2127}\220\273\346\264\245U\257\005i\007"
+	.ascii	"\372\247\bE;M\b\321\f\376\271\251\336\035\201\035D\020\361\316"
+	.ascii	"!\267\001G|\022\252\252\373p\377\204j\363J=$|\206\272\264\367"
+	.ascii	"sq\030.\031>\300_\005\211\264(\316\037"
+	.text
+	.section	.gnu.lto_updateState.74.daf0effb8d047246,"e",@progbits
+	.string	"(\265/\375`\\\t\2055"
+	.string	"\272_\300\024BP\244J:\003G\213.\253f\254."
+	.string	"\013\265\277\221Ln\022\310\004\346\225\020\262]s\001\253\252v\336:\302\342NA\310QZ\200\031\001\265\220\002\032\360ez\032\036\260\360+\333lk\2154B\210\334I\0065\001\034\001@\001o\326\343]\217\277\3678\\\274[\333\254Y\207\303\b\226\370\235\216\271x<\376\0337\234\247r\205\251sZ\372\230\367\336)5\213\337\346w\\\264\203\260\364ut\277\264\354qy\261\346uYg\003a\351ky\305\244"
+	.ascii	"\351\226,\324\243K\347\321<\rs\221}\234\216\021(\321S\306v\224"
+	.ascii	"\331\007s\361\250\275\231\303}\216\213g\036\267^n\013\t\f,{a"
+	.ascii	"&\324\243\277GGJ\337~\374\"\303\206D\300\2660\357]vX\0029/\331"
+	.ascii	"\362j\221Jc\2621\035e(\365\226\371lo[\357\026\344\001\356\255"
+	.ascii	"\262\306\356\336\245\023\037\325\243\274<\201\364\250z\244\364"
+	.ascii	"(\257\314\177\276\274r\037W\226\214\023\274\367\036\333\312\327"
+	.ascii	"\027\211CU\230\242g\333\225O"
+	.string	"\024\343z\2218w\005fcO>\024\2020\033krU\201\331\030\331\205dq\2226\375\235\260&\347\322\275\267(\206\264\350\331 \231h\213\221\030\330\231$\310\205\367.aN\354Y!m\217m\320l\314\311\373\204\002\023\204b$\366u\026\031J\342\371\334-\0211/k\205 \356\275l\225bc\347\24233\031f\256b\036N\bvnR\272\317\370\354w\r8:_\326\020\363\335\007\215\335{\331\301\327\275]\013\272\317>\262\314\3136\331v\367\221L\276\337\355\250\340g\341\253\025\366\312\025\351Q\333\017\320\310\222\372-\003K\023\311\354\262M6`\231[\270\260W&\265\315\222\3477\310\364j.\036`O\367\271\027\252\262\351\3141f\330+\371s\227\312[\0162\301\232\213y\351e\373\214\371\347\355*\314F\313\034\214\2267\\\357\254\301h9\203\3212\006\243\345\250\357\235/\030-[0Z\2062Z\256pd\231\002"
+	.string	"\313\023.\347|4\262\374dd\331\311h\271\311h\231\311hY\202\321r\204/\317Jw\373\023\374\355\234d\264\214d\264,\240h9"
+	.string	"\321\362\021\3212"
+	.ascii	"\242e#\242e#\321r\021\321r\261\3102\261\310\362\260\310\262J"
+	.ascii	"\264,$ZN\211\226Q\242\345\223h\271\213\226-\321\362=\b8\344\365"
+	.ascii	"\007\347\254\254\377\226\367H\363\320\365C\361\324\276\367\353"
+	.ascii	"\375r\376\345\377\366\313}hU+\264C\346\363\363.\207\317\307\305"
+	.ascii	"\352\204\246\320\347\274\364\330\023\372a\200\200\220]\236\372"
+	.ascii	"\330\007L&:U\352\324OM\355\324\3029\311D\335\327'\311\375\252"
+	.ascii	"\2262uS\243\204\220c\"\264\204f\352\363\035\r\003\374\343p\244"
+	.ascii	"\216)\224\320\021\272\206\355b{-\327\326\216\027/\322\243\022"
+	.ascii	"\332\300\236\353\361\252\345s\253\232z\357\215\212\320\217s\353"
+	.ascii	"\004\214\237\2626.\024\345I\235\3647Rb\327\200\3433l\265\211"
+	.ascii	"\335uI2/\333\034\366\t\230d\003r*}\336\346\364\300\216p\271\314"
+	.ascii	"\037\232\315BJ\255\266T\026@I1\017\254R'h\346\325\313\372\305"
+	.ascii	"\252a\342\007\326\\\367\343\026\306\r\3553\276cf\273@\251\017"
+	.ascii	"(i\302\365\t;m\245\266yH.\202\302~B#+\2246\235\022\301\262\266"
+	.ascii	"&S3c\347d`"
+	.string	"\217\316|\351\325\\\320\332f@O\240\007\256k+\231\265mmK\217^\315\001\211P\357\355\002\374\237\265\f\207\020a\257\024\221\246\031A\"\315\245\2760\007\231\310\346\342\244\346\203\006\366\r\222\241\315\377\273\036\276\353\301v\366J\266K\217v\2342\220M<\017\020\365\336\257(>\236\022(\262\004I\217\242-\304\353[s\353\262M\376\013TUYV\247\360\007\026\326\024\025\215,+5K\213\306\326\225U\272ueE\243j\007\016-\035SUXE;p\264\230\322\322QeC\325\312\301\243\231\352)\205\224\211\026G\255\252\033XSZG+\034S;\216TXY\307\247%\276\342Q\205u\324\272\272\302:\026\227]?\337U\030DW{\331b\217\315\031\274Eb\206\016\216\270u\336k\366\341r?\363\3156\231\202uz\323Og\247\254S\f\\\271\267+\212\225r#\312:eJ\272RY\317\364\374\220\232\241\254jO"
+	.string	"\221Z\2107hP@3\331\232ft\205\211\200\026\276\rZs\013`\223\3309\312\300"
+	.string	"]@M\233\337\221\025\313\243\f\264G\216\326\226\f\372\260\317\230\017\216\220\302\020\215\257,\265F\256\241\211\234\357\3033\276?\302\247\023u{\3116)\037Bz\241\2110\003\260EV+lg\353\224\201F\255\324"
+	.string	"\272\363 \345\030\273\330F\215\002\016\021\303D\017\222/xvrEm\354#\273p\350\242N\347 1t\261\237w&<?p\177r\314\r\235\2419h\350\r\215\"\312\320O\362\247NT[h\f}$\227\013\035\325h\036\250\256\320\026\372\214C\263C\3264!P\335"
+	.string	"\355skZ\205\006\205\b\255\005\200\263\250q(\205\230s\246HDf$)(\2441\200\002\221\2512v\021\240\301S4\013\222\024\206\003\036\206\177\307H\036t\313\023v\227d\224$\302\024(\376\206\003\222\250\223\250\205\355\310f7\224\327\033\364D\2369,E\221~\n\355\220\2255\300\205\321\233S\324\216Mo\021`\200\341/\265ro1\220I\262\021\271\215\344\256\006\250X\202\210K\234\272\222\024\036}jk!\027\317\326\3732\204\214\rL@\263\317\r\2048\003\001\200\215\254\b"
+	.string	"\333\024\247\325\023;\022\334\214\350\021@\274A\225\003yuJ\"\026\377Id\022o_\325\304\300>\tJ\377 \207\277\211,l\253v\332"
+	.ascii	"\331\347\213\027s\356mV\356\022\247N\322\260\302/\326\031\013"
+	.ascii	"-\253\001\266\321#\021\220\263\b\230\206B\260\3600\320\b`x\313"
+	.ascii	"zZ8\242z(\303\314\346{j\221\226U\257d\370\275\315x\257\264\350"
+	.ascii	"3\321\0252?\207\240M\374x\001:k\330&\364\232\350U\265\224mW\321"
+	.ascii	"\326x\\\341I\207\24642\035\255\307\241G`~]6\2451\211\266G\353"
+	.ascii	"\374\024w\241\272\337\256I\203\223\262i!\021\325\252\002<\006"
+	.ascii	"\t\222D\331j\007\316\250\203=\274\272\324\237\017\023B\013\264"
+	.ascii	"\bv\366s\243lI\341\230\243tR\005\317hXH\3159K\236\350/\221\373"
+	.ascii	"\205\220Vu\303\200\032\024\337\240Z\f\343\234\323\021bJ\021\323"
+	.ascii	"\325"
+	.text
+	.section	.gnu.lto_onFdmPacket.75.daf0effb8d047246,"e",@progbits
+	.string	"(\265/\375`;\001\235\r"
+	.string	"\226\030ZD"
+	.string	"\261&\035p\323\340\277%\234\222\340\032\250\303?\2521\237\261\373rM\037\303Q\337\021\206\321\233\026rT[$\223\221\211\270)\3736\244\361\377\021\375\n\264\346N!\223^S\004#\326@\314 v\357\275eJ\001F"
+	.string	"C"
+	.string	"I"
+	.ascii	"]\314r`l\254\214\250\261\273\363a0T\355\021>\325|\355\360b\343"
+	.ascii	"B\217\220#j\321\360"
+	.string	"\301\211\340\b\352\246\346\245\353\210KQ\270\301\345\357\245C\0162\251\215s\271r\020\354\256u\343*\334\362\266Il\037\260\317\005$\373\251/\t\214\016\203\306nK\352\306\236b\215\214\355w\330\326\356!\264\213\260\214\003\330%\331\030\250\036\335UW\373\036\376A;\210\023s\354\276\230\240\331\355\nxV\217!\027 \037\341\003\310Gk\366\214\007+nz\nOu\342(:\227\307S\342\340}\214R\247\025\270\273\013\315\2417\275\0046\300f\027\345\233O\3423\037?\303\243#`\372\r\223\217\266\004\n\372\315\036*,\234T^\350\315\264\020q\357\301\330]H?\022\203\272\361\013Vf\221@,3\271&\\\322\035\021\005\r\0220\230\331\345\001Y\3314)\261\036\314\016\b\233\"!\376@\270@3\373|@\263\243\333?\222\027\\8\241\274\224\310r\263\220\177\036/\245\030*\2122\210\372'\362,\267\013y\323i\260*\036"
+	.ascii	"{\311'\323\260\316&9\253\252\25770\013\231\033\373P\\4\310\002"
+	.ascii	"\034\001\030!\231\022\272m\265 8D\022K&\314\2620\205\202\023"
+	.ascii	"j\3317\206\321\234\n\252\251)p/\230\232\022\334\213[\252T-\003"
+	.ascii	"\365\262I\230O"
+	.text
+	.section	.gnu.lto_ioThread.76.daf0effb8d047246,"e",@progbits
+	.string	"(\265/\375`O"
+	.string	"}\t"
+	.string	"f\321B= \005)\035 \233\214\376\202Qx\266G\202\227,"
+	.string	"\253L\201\356\355\f\320n\003\252*;\b\213\004E\242\222wH-\331\016\330\301L\001\001\243\2435\266B\251\323#=\252\372?!{\247\024/"
+	.string	"/"
+	.string	"4"
+	.string	"..\217\226\234\335\262\272\374A\347\335\347\005\235w4\344\343\347\350_\345\t$067//\362\323\343\260\273\236\255\027\354\246\267=\262\375`\233&1\233\233&5\331qjv]\001"
+	.string	"\354\254\223\031\261=\332 \333\237O1\355\004\2731\224\230\335r\301\365\363\316\266\177r\331h\323\020J\021\230'\025\266\231[m\203\262\0340}\226\224\255\360\025\320\r\357.>\035\f\243\025\206@\311\214\203\222\346\246\235\2411\337\262\201\355\343VcQ\322.\311IA\354sK\003\026\211N\252/t\362\276\220\242\004\242\006<\321;q6\221\"J\020\022U\374&BO\254*\224\227\252\246pUI!\203\026_XE\020\f+\250\334sKc\365\001\f"
+	.ascii	"{\311'c\272\373\206\227\214-<Vwl-\2326\273&b\230\020.\201\022"
+	.ascii	"@e|\265\363\t"
+	.text
+	.section	.gnu.lto_systemInit.77.daf0effb8d047246,"e",@progbits
+	.string	"(\265/\375`\013\004\035\034"
+	.string	"F\262\265G\200\234m:\274\004i\345\314&*+\005\340R\324\330W?\301\263"
+	.string	"\324h\021\213\306e\260\277\f\362\373\310\354\306Z\222[\361\244\3034\350u\277\221\016\371r`\004\307\\\032\201\352K\311\317AG\005\202\023\275\227\210\335;\311\224"
+	.string	"\241"
+	.string	"\247"
+	.string	"\273\233\353\356\345\354\255\352\276,\337\"\335C@\317z\373X\333\366\266o I\n*\310\025\207\255\234\241\306\304\362\017\364]=\353\357\376\257\364O\337\312\261\360\263\332K\314E\211ZGn\200\345\234\215\016v)\036\034_ <(\373\200\360`\343\356\257\367\214\344s\331x\342\022\226s.\257\325\361CPv-\356_]s\017\033\024Zy?\353\316\312\372\312*\210\231\341\372Yu\262KD\312\257\334\352X\235\254\005`!\347\334V]\245\336"
+	.string	"\336\335 \272\033J\367\335\023\263Yx\260\273\303\007{\325\347\006\371\252\374\236\356\030\2335\\2\004vD\222"
+	.ascii	"(?\335\315\371\276\224\020y\031\200|O~:\005?\246\334[\3255\302"
+	.ascii	"\337\025Z\340\350l\236&`\273O\240\270ARN~N7\327\377\212\322\225"
+	.string	"\257\024\366\273\356E\251\257\244U\320h\341A0\314\326\024:Mv\254\205l\277\213\331}\364-\027=\341`M\344A(:\330\275d\263k/\fLws-\332\367\276\205I\314\271\351j?\313\265\304\350+9\3308&{\365`\237)<x\364\356\0314\354\325.\2606\301\003\026\037\272\317\302\004\313\0345\024r`(\274\332\301Tt^\007O\355\300TT=\360\017{u\350\332\250\242\360\200!\331\362\357a!x\310\257\024Z9\330*\316\2770\221*l\205\255\302#8\211\275\332\262\314\343\346\226\034N{\2119\347\bo\354%1\206J\026\221\005j\203\257\234\210\274\357vD\035\275\265\222\364\3154h\360\223\231\275\nt\203|_~O7\327D\326\347\276\3673X\212\220\021LE\344\325\212p\025\2145\365\033\255\321[\013\311\333+|\357e.0p\2233\357*\006\221\227\242\350\340{'3\023\3631\0326\004\335"
+	.ascii	"=Q\324\034Qs\t=M\2345\324\224\201\2328\224\226\342\016t\200\026"
+	.ascii	"D$I.\335j/F\021\031J\214)S\b\333\f\021cZ\273\325\0264\022\351"
+	.ascii	"\200t@Jx\200\024\240\033\240'\212\232#\214\363|1\2467S\2069\232"
+	.ascii	")\315D1$h\222$\323\332m\246d3S\034\r\034\212\241\324Do\263 ="
+	.ascii	"\220\230%\225\251\351\002\245\245\345\255F\263\225,P\\I\216}"
+	.ascii	"\3020\3212=O\264\374\351\345\337\"IS\277\246\353\324\025\354"
+	.ascii	"\321\305c\247\260\033\357\360\223\005\263\376v^\272\260\3020"
+	.ascii	"1=\370\206\310;\220;>p\200F\001L\250!$\3072\347\310\004\024\210"
+	.ascii	"D2\201\202(\007\220\002\021\242\263\035\020@\246\214&\205\264"
+	.ascii	"\006\334\216\245\b/\r\325~6=[\211\006\352\031U \"\366\204\206"
+	.ascii	"\021!\251\016\232`l%\302\216XP-\237(\366\316\016\353-\260\340"
+	.ascii	"NG_\232\353\367#\022\204\220g0<\374\302\251P\245Q\020\311\226"
+	.ascii	"\274\267a/\035\256\273\272JM\317\023\004\200j:\354\036}\373\""
+	.ascii	"'\026\005\324^o\240y\016\":JS \n\226\340\202j\377\354N\2034\373"
+	.ascii	"\035\352m\256\002$\241\246\325\227\236\344\342\035\267\373\372"
+	.ascii	"r#\200\366\330\007qf\205\376\001"
+	.text
+	.section	.gnu.lto_systemReset.78.daf0effb8d047246,"e",@progbits
+	.string	"(\265/\375`M"
+	.string	"\025\t"
+	.string	"\326\020?; \0057\035`\205_n|\222\002IB\304\360\222&\004\253\326F\342L\331@C\241\273\305\266\r!\240\004j\255\006\312\305\224\307\276\020\016\271uF\270U0\316\016\017\266\221\277eJ\001,"
+	.string	"/"
+	.string	"/"
+	.string	"+"
+	.string	"\025e\341\264\330~\310\240\275\363q\245\276\306F\204FUk\235R\345\340\027\364\275\227C\255\325+\222\224\334\362\266\017l7\330\326\t\236\275p\030\r3\334\332\b\b\231\t\267l\023\307^\364]Nq\032{R\0372\264\307pe\212\375O\225(\366\327\277\366f|9O\200ZG\002\244SJE\260\376\005\350\322\3062\021\310e>C}\026\227\264\275x\313\327@\267.?9'\223\216]Y`\355\215+8Ay\310\320\327\3721\001F\370\250G#,6\372y&\2174\340l\0041\361 1?Z\352\260obh\3306\263\316\233#\221\271\f\332\315\217\343\272\031\272|\033\254\302\355\212\r"
+	.string	"{\345\263\232\r\224\331\261\243\215<H\232\032\330d\210\207f|\360\f\3055\321)\204\3742\004f"
+	.ascii	"\n"
+	.text
+	.section	.gnu.lto_systemResetToBootloader.79.daf0effb8d047246,"e",@progbits
+	.string	"(\265/\375`\215"
+	.string	"\005\013"
+	.string	"6UOE\020\255(\035\b-\304wR\004\275\356\310\346\343 66$@\264\354B\302\252g\213\244\366a\302\217\366\376\264\204\264&-b\323ni,\202,~\306dl!\026"
+	.string	"fU!\330\001CS5\034q\315r\333\275S\n8"
+	.string	"="
+	.string	"<"
+	.string	"\002L\261\333\300\005b7\3740\335|z\336\311>3\347d\237\006m\327\303\b{\017\"T\033`\273K%\204\203\217\240\357\250\021\331]\307U\002\005\267\274\355\013\333)\366-\002 \237\247\315\201\220\215O;"
+	.string	"*~\345c8\n+4\361* Sv\230\212\362\201\375\314\356\256\245\003;F_\303AB\365\001c\304.\202\330\211m\315\020\0234\333\217\366+\334\002\370\013\001w'v\334VYa\275`\025\321\017e\227v\313\3461p\016\357 \362%\270\216\342W\237\376(\373\274\314\224`\260`@\214Y\2136\f\211C\241E@\246\274\211\276\006\223\355\361\f\236\003\326\350\252\313\306\305|\0347\302\201\276\352U\223\020\251~\036\312c\311\250%\024\350\363\352\311T;\315\242O\t\210\344\204~u\324m\037\005\360\262\221\250\250\363\350\307c\256T;\372q\\G5\333\3268\f"
+	.ascii	"zeA\231I;\232\313\203\320\251\321L\206 i\306\007\317P\n\206\\"
+	.ascii	"\202%VS\360\002{"
+	.text
+	.section	.gnu.lto_timerInit.80.daf0effb8d047246,"e",@progbits
+	.string	"(\265/\375`\002"
+	.string	"\005\007"
+	.string	"\342\21404`O\322\030\024HvL\213Q\214\256B\n\b\301\364\263I\311\220\277\031\203\300\237a\366*\"\207\330d\253\030\374\314\353\336\b\226\323\250\003\322\247/\204\b\331[\246C\bg\025\342@H\nT\315\007\202?\260\301\201\323\211\223\212\220\236\031C\225\007\024?r\"\302\202-\tJ\306iY2n\264Ui\337\250\323\262e<\215\001\334zB\361\tjR\261\202N\026\002\034\361@\247\277\300p\232\355VX\266\215\207\275\206\271\027\362*\355\033\375C\200Q\027\231]\217\032\232\335&\025\222_7_\037\243\332\310j\312K\007\312\314\356\306'\242\227\272k\325\022\035\310D\230\272"
+	.string	"\206\335\335e\242\017\375\351o\360/\374 \001\n"
+	.ascii	"{\3117c:\363\206\271\241?y\256\347BN\026\354x\031\002\\\272E"
+	.ascii	";\237"
+	.text
+	.section	.gnu.lto_timerStart.81.daf0effb8d047246,"e",@progbits
+	.string	"(\265/\375 \305-\005"
+	.string	"2I\"*pm:(\371\342\346\212\r\t\255\376\2015U\022\271\245\026\233O\311\211\231@$\204\232N\t\364\341\234\361Q\025\336\215q\357\224\002\276*\204\342\220P\r[LK\323G\303r\3505#ZQ\316 \330T-\313\246N\340^~\224DNl\220\213\362b\037\260\362\263c!t\020i\267R\032\355'\340\321\330\376\344\315\016\017f\366\235\220\302\021\355\256J\314\267\307\315\377\346\203\316\343\036\005\206\335u\354<\313-o\233`\273\262\315\b\t"
+	.ascii	"{\3117\323\342\234\031\001\276\3345\234,\204\3612\004\270t\213"
+	.ascii	"v>\001"
+	.text
+	.section	.gnu.lto_failureMode.82.daf0effb8d047246,"e",@progbits
+	.string	"(\265/\375`^"
+	.string	"=\t"
+	.string	"\346\321A;0\345(\035\200\347n\300`\207A\"\266\357\214\334\224\032\013\036n`k\245?\344~\rs(\3240\303\271\207\310vg4_\366\352:`\360\"\005\225\037\304Tc\316Z\262\367\336)\005-"
+	.string	"1"
+	.string	"/"
+	.string	"\247\376\354\227\207\256=\f\300FJ\314\356V)b\031\277O\031?\037\241\365\371q\271\261Z\217\031\320\356:\256X\0367\275m\220\355\220mX\224\003\006\305\022\264\377\372\3434\230\335E\266\333\021`\2661\3122\262\261\375h\237\344%\337_\031\016\330\005QY\331\r\017\\5\247\235s\264\323\371\001-\276\004\375)\301\317\335])A\333Z\214\362\341OP\002\256]\325W\026\032UB\301\251}\201\021\277\362M\276\265\310b\0322e\207\251(C\354\007\336H\004\035\217\307\363\300\221\272\005\316CI\224D\020\016\034\216\324\231\246G\037\205\206\020C=q\021\236\350T'J\"S\035y\025\365\323qG\301y\365\324u^\335\330v&\013"
+	.ascii	"~\311\005\346d\344* [\356], VS\202{q;m\266\f\334\270Bq\002"
+	.text
+	.section	.gnu.lto_indicateFailure.83.daf0effb8d047246,"e",@progbits
+	.string	"(\265/\375`x"
+	.string	"m\n"
+	.string	"\266\323JB \307*\035\227\b\"\002\3010\023\003\331Jv\002]|\n\016"
+	.string	"\310jA"
+	.string	"\232/\264@\202M#\364h"
+	.string	"$\025X+l\200\021R@\024Pq(U\210\026\302\303\211V\310C\025T"
+	.string	"\333\326\b\331;\2453"
+	.string	"5"
+	.string	"9"
+	.string	"us\256;C\346\334\366\205\3149\217\266\203\227\261\275\201\b(\005\036\354n\2450\037?G\377\002\316!_\255OMhw=\311\227\312Mo\333\301\366\311\366\202\333\356\256)\314\276\354\237[\003K\003\215\332nJ\r\302\3228\0041\266\337\261=K'`0\333\335\217%6\347\374i\037\300\003\214\227\221\230\263\353r`\266[~\034\253\n\352\f\252\276\260\212 \030\326N\271\337\226\302\334\321B+\241&\326\314I?\340\004V\n\261]\327I\326\306\025\2028g\213\214\314\223\236\nVh'\264e\227\255I_\354\007N =t\036\217\347\343#\201\031%\217n\"\004K]\310\312;\225\272\n\013Q\367\205\254\223\311\273\210\020S,\220B\364>\325\027v>\022\210\332<\002\211806\252\370\201\204\236XS&\017UGa\013"
+	.ascii	"\3369\312^\222\310\330\013?k\202\263;\256\241\2550^P\345\b\250"
+	.ascii	"\333\340Z^\b\223\f"
+	.text
+	.section	.gnu.lto_nanos64_real.84.daf0effb8d047246,"e",@progbits
+	.string	"(\265/\375`\227\001%\017"
+	.string	"\006\035eD"
+	.string	"\221(\035\230\303\357\234\242\204Uf\274\001\226V9J\273\323\2721\213\312\023\214\250n\r2\357\302\211\377\352\207Q\326\276zk\361\243uO\007\025\3247\370\250\023\025x}\3455:(\333\267}B\310\336R\246\024Q"
+	.string	"J"
+	.string	"Q"
+	.string	"\217\231\003{\212\324?\324\327C\321\304|p\311vQ\b<\272\343\036\277\037\337\304O\244\254\002\371<\250h1\0322\250\330\261\373u\376\376\241=r\017\240=j\207\253\236*\377\261G\227\0303\255\224\325sc\260\273\316V\212\312\255\267=\300\266\001;\017\004\005n\233,\344[\376\020\261<d\030te\177\253T\016\366\341\352\212\355\364\007\246=0\335\201i\216\24670\255\201iN\323\033Lk0\0355\raZa:5}"
+	.string	"\021F\270^%$\350\330u\315z,\215\370\002\304\277\337N9g\201\362[\036\r\"\345[\217>I{\3344\001\013,\252\252\246\367^P\243\252\f\223\307BPCl\300\\\034\007\t\230]+\270\260\313\022\220\252z\317\345$g\276\246f\016OfOxL\304\355.\202kHK\215\027\n\030+g\346\362/\217\221\270V\246S\272d\304\001\204\006\017\272\023\310\244Dr\352(\204HD]I\311\324\215\210xT\001T\352N\243Q\251\343|{\270\272\362Q\021\226\236\030\005w7,\220\275\344\314\036\375\350\275\031\035\325\324\243Q\306\013\301Q\215v6\312Q\020\030-B2\033\375\f\013\247\232M9\335n\300\210\374\025\001\037"
+	.ascii	"{\311'c\232\211\f\213&\373\260dI\365\206\320\306j \205c6B\301"
+	.ascii	"\254 ?\260\034\020\210\260m&\321y\013+\301\202\360\262\020D;"
+	.ascii	"=c\033z\254\263\371\373-\341\302H]\315\242\302\330\222T\343\340"
+	.ascii	"n\251\026\210\223b\272&\031"
+	.text
+	.section	.gnu.lto_micros64_real.85.daf0effb8d047246,"e",@progbits
+	.string	"(\265/\375`\304\001=\020"
+	.string	"\306\036lF\340\262(\035\240C\001\307\247\341#!y\021\017\001\222\321\2623\321\334p+)\304c\210\230\240\235\002\361eE\251bnk\230\246\323\0057\230\367\241\224p;0G6\r\013\241@\231\006\370k\326\376'\215\354-eJ\001U"
+	.string	"Q"
+	.string	"["
+	.ascii	"\336o\257\3702\217n\336b\345\236\312\267\203\t\351\214\3500\333"
+	.ascii	"\2059\360hn{\374\002\360U|\305\212Y\002x!d4\035\016\030r|\354"
+	.ascii	"z\234\275\213h\217\333C\264G\005q\226'\213\177\331aO\215/\026"
+	.ascii	"\323\362\004-\330]g,F\346\326\333.`;\201\235\251\336\3628\227"
+	.ascii	"\241l1\004\267S*\344c\0261\361\363cvA[l\257%\365\203}\270Jc;"
+	.ascii	"}\202i\023L\227`\232\004\323#\230\026i:\004\323\233\246A0\255"
+	.ascii	"\301t\204i\250i\205\351\324\364C \360\274\314\244\210\200c\367"
+	.ascii	"\345\003\262?\261\207\304\003 \335t\304"
+	.string	"'\006\313\177q\030*~\315\243U(\371\330\243\217\242=\202\3649\"\242\246j3.3\236\001\305\206\034\032N\364\360\254]\362}.,\354\302\006@\215\372\316\306%?\253B\2156N.[\251\022\320qsM\325\036\335\314\226p\031k\333]\005WT\r\220\031\0267\260\374\002)\257\264\t\252\301\003\006\016\270\227\352\304\225zq\023V)\026g\342J\341P$nQP\271\270W\253\345\342F\336\036\256\322\234\224\004\246.V\201\273\036Jf8\371\331\244'}w\003\306Cfwm\240\244&\315\235\316\206\244\232\226T\333\321\225\030\351\246$\035\361\021\351(\244\"\025\020dg%#\244\247\021\" p\002\2312\332\003{\362\211M\327\3210\177\332\327\215\375\335\216V\35308\315\203E\321\257\274;~%$\210i\354F\346pit\261\25577Qt\344\300\217\207w\"\343N?\306W\315\235\267mn\030\333\022G\221"
+	.ascii	"\223O\336\311:\r\020I1]\217\f"
+	.text
+	.section	.gnu.lto_millis64_real.86.daf0effb8d047246,"e",@progbits
+	.string	"(\265/\375`\304\001=\020"
+	.string	"\206\236kF\340\222*\035PC\200\276\363P1\323\tR\t\227\322&\302\233"
+	.string	"t\316\376&d\224\234\0369\035E3z#\357f\230\003\225j*}\226c\302"
+	.string	"@\t\267#\343:\2061\020\022 b7X\030\256-ido)S\nU"
+	.string	"P"
+	.string	"Z"
+	.string	"\277\375\362m\376\304\234\305\353\240\353\363S\351\320\270\270\334\346T9pi\257\273\374\004\340\247\270\212\227a\002\300\017,\034M\b\f3?\346\004=\203\037\341.\273\213p\227\353\341\260+\314\277\355\321\246F\017\332J\354\312Y0\347\264\322VX\356\275m\003\266\023\330Z\nz\231\333T\035\r\301mV\005=\315#0 \220\333\205\215\331`L\267\203\3758\267\305\266z\024\325\242\250\016E5(\252?Q\355Yu'\252\273Us\242\232\213j\031\325q\325\033\325\272\352\213@\260\221RC\021\201\306\234)\241\220\231C\332\2208\030Kr\003\003\345\273\370\013\227/\342\322&\225\236v\351\253\270K\316~\006\204\\]\2566\233\361\f'6\350\320"
+	.ascii	"c#c\332&a\330\302\302\2342\002q\345\376{\231i\350\335\270\362"
+	.ascii	"\006\312m\247\335\002;b\276\272\353\343\273\331\022nCusN\005"
+	.ascii	"_\322\b\023\265\02512\r\335\005\254\226\372\204\324\340\001\003"
+	.ascii	"\007^\313\204\262*\265\274\t\247\022\312;Y\261<R\211S\024L+\257"
+	.ascii	"\225J\255\274\0178\037\347\266\214\266D\2663\273\342\234\034"
+	.ascii	"Ln2\032Z\264\243\375\207C\026\304\001B+Z\255\371^@\313mh9\036"
+	.ascii	"_\211\317v\013Z\222\033\317~:\353\331\001CjN1:{\032\234\355\002"
+	.ascii	"# `\2021e\264\007{\362\211M\327\3210\177\332\327\215\375n\017"
+	.ascii	"\243\260j\035\006\247y\260(\372\225\373\016^\t\001\"\032\273"
+	.ascii	"\2209\\\032]l\353\315M\024\0359\360\343\302\203\310\200\323\207"
+	.ascii	"\361\265\346\316\30767\214m\211\243H\200\311'\363dm\003DRL\327"
+	.ascii	"#\003"
+	.text
+	.section	.gnu.lto_micros64.87.daf0effb8d047246,"e",@progbits
+	.string	"(\265/\375`f\001\215\016"
+	.string	"\266[`C"
+	.string	"\221(\035\260\t\226\322JV\226\311\205\003^\220\376e\306\254\306\356Y\275\005MGb\331d\210w\031\366\277\322\r\330\324\312\244\276\021m\356\231RP\347\001v\260\305\335,\334\375\264\035\230-\371d\223$S\nL"
+	.string	"F"
+	.string	"K"
+	.ascii	"$5\253\036\257JN\256\003\247d\205\305\225\331!\360\353\246\371"
+	.ascii	"\325+\314\202\244\245\002\035\211\223l%F\211\nMf\267\265\363"
+	.ascii	"\200\314Os\200\314\357#\\2\226j\263\214\255b"
+	.string	"Z)\023\223q\303 3\213)\223\023\367n{\240m\202\0261N}N\340\003\b\031\324Mmg\302\247\264\30623{\224\266X\220W\356\347a=\017\333\301\260\234\207\325\036v\363\260\331\303>\f\213a\330?,bX\003\350\340\2501\021\241\225\311\341U\2232\017\346\204W>\"\276\r36\307kw\013'\"\373\373\346\346R\240^\030F_(\324\245.\231_v\216\n\373\373[8\327\3779vs(P*\031~\0014T>\336\234\253na\027\245\272D1\204\320)\277:\224\371\371\3670\243Bu\302W5l-\214`\027D\"/\210\207\003\b\r\036l\244\020\t\243\017\322&2\341#\264\201\214F6\217\216\212*\204\2146\222H4\332<]\032\313\243\200\336q:\252\236\203\372b\324\206\020045X]\266\013^/\033\0322O\006:\367t\256 \246\305\271>gI\231\311\241\342\\\206S7\316\271\271\037"
+	.ascii	"{\311'\323\264\0011\354\274\0269\007\r\033\3162\325\346\347\""
+	.ascii	"\254\fc.#\025\b\001\013\031\273\2255\004\302v\230\205F\024-b"
+	.ascii	"\030!\316\363b\\)\213 \0174\206\024>\027\333X\224\005\3205\247"
+	.ascii	"\017\001.j\005qM\233\204I\006"
+	.text
+	.section	.gnu.lto_millis64.88.daf0effb8d047246,"e",@progbits
+	.string	"(\265/\375`f\001\215\016"
+	.string	"v\333_C\020\221\223\016\3006\201\227w\006\2037H:oP\275\341$\311\b`\277\247\357\265.\364\312k\020\027\214\273\365\276\r\316\356xKm\003T\005x\232M\270\t\002\256K\033\033\205\237\257\325\222F\244\221\275\223L)L"
+	.string	"F"
+	.string	"J"
+	.string	"\265J5\243D\216\034\207\254\204\245\006+\306\016\201a7\314\260^a\026$\025\025\350F\234\\,4JVp\304\330m\355<\3402\304\034\3402\274\b\213\234\242\332*~\250\227\225\311d\344\3240\21016M&'\356\335\366@\333\004mf#i\023\347\004<\250`J\037\265\335(\237\322\372\305\243\264\315v\214r90\253\301\354\346e3\230\305`V\003\263\027\314\302\227}/{\230\315\2275\200\215\314L\211\b\253\0307\264f\"\f\234a\302(?3\337\222\004\334\213\346y\354n\341@\\\207\327\334\\\212\322\013\303\250\212BSM]\206\327\263\323;\374[8\326\317\371\273\271\023\245\225\f\277"
+	.ascii	"\033'?o\216U\267\260\013QM\242\030<i\223a\355\271\f\375w\210"
+	.ascii	"Qq\"e\253X\266\026\002\027>\"/\210\207\003\b\r\036l\241\020\t"
+	.ascii	"\240\217\320&2\341\303\263\201\200F6\217\216~*\204\200\266\320"
+	.ascii	"\347\003\332\264.\372\305\243t\336Az\251\332;U\231\373\260\n"
+	.ascii	"\341\"\203\"\025\333\005\255\226\213\206\030I\0066\3276W\360"
+	.ascii	"\262\342X\234\313H\211\311q\312\036\303\246\033\317\356  P\002"
+	.ascii	"A\352\262\016{\362\2111m \031v\326\"\347hX\235eo\363^\304\312"
+	.ascii	"0\\F\bt\300Be\267\252!\220\355\300B\243\242\305\303\b?\3173\256"
+	.ascii	"f\261y4\206\206\317\263\215E\026Z\303\224\2628}\002\\\304\n\302"
+	.ascii	"\246MB'\003"
+	.text
+	.section	.gnu.lto_micros.89.daf0effb8d047246,"e",@progbits
+	.string	"(\265/\375 \373\275\006"
+	.string	"\342\314.2`m\322\001\263\347\026\004A0z\003\217\030\004\017\245\264\320\261\202\242\320\032AWa\344^\370Vf"
+	.string	"\336\324\006\2718\"\013\004A\231\345\226%{K\231R\256L\007\t\006\b\257\262(@J\365\032\026(\f\257\002\037\336$\231r\260\300WQ\024|Q\334\353\246\251\204\321\214\257M\323\243)\301\344\307.m\210\210<v%\250\310\350e\307+\325\302~[\335\330N\267L\337\rt.\342\331\225\370t6\304}d\330\276\330\221\257\361\215\213\255\02612\310\203D\3231\262\033\237\364"
+	.string	"\350\256\035"
+	.string	"\272\323\213[O\313?\307\033\b\207\203e\327sR\260\273N,\233\270\365\266\005lO\266)\002\t"
+	.ascii	"{\311'\323\342\2533\216\206\360\\\303\217#\\\026\202\fw\305\324"
+	.ascii	"N2"
+	.text
+	.section	.gnu.lto_millis.90.daf0effb8d047246,"e",@progbits
+	.string	"(\265/\375 \373\275\006"
+	.string	"\342\314.2pM\322\001\035\376?\317 \201\027T\262\f\ffx `\0137"
+	.string	"Z#\310\250!9f& \255\211\370\344\301/\316\031;\354\276\233,\221\354-eJ\001\256H\b\n\007\t\217\262,@\n\365\034\030(\r\257\002!\236\024yz\260\300GM\023|P\334\353\246i\204\321\214\257M\223\243\351`2\263K;B\"\177]\013.2j\331\321J\305\260\337V7\266\323-\323w\004\023/\341\354Rd'K\342B6l_l\310\347x\307\305U\213\032\330\003\322\321|\230\354\306\027]\340\271k\017x\3564\343\325\263\362\357\361&2\222]\230\365\0040\330]\347\205U\334z\333\003\266%\333\026\001\t"
+	.ascii	"{\311'\323\342\2533\216\206\360\\\303\217#\\\026\202\fw\305\324"
+	.ascii	"N2"
+	.text
+	.section	.gnu.lto_microsleep.91.daf0effb8d047246,"e",@progbits
+	.string	"(\265/\375`\266\001\265\020"
+	.string	"F`qF\340\360&\035\302J\247\220\306\354\\\001\370\327Vb6\377\302\232\343\363\006\274CB\246O\035N\204\347\263yV\354\033s\256`\323g\277i\344A<\240\207v\210/4 \2748\"Nf\304\323\236\204\371\263\275\267\224)\005\\"
+	.string	"W"
+	.string	"_"
+	.ascii	"[+`\256\343P\344\001\342\341{H<\264\313\226\361\232\316\236("
+	.ascii	"\026\023Tcw9\325`M\327a|\232.?3\buJC\262\327!H\210\232G\230|"
+	.ascii	"OmBF)\331\313;\340Sb\003J\346\222\372\356\003H\b\301\224\206"
+	.ascii	"d5O\216\004\273\353\214\3110\334\034\267m\3016\211}\247v\355"
+	.ascii	"\225J\263O\362\342\210\203uf\377\347\377\200\351\030\323\020"
+	.ascii	"\246\337K\253\246S\323O9"
+	.string	"\300\231\3019\021\301hw\346\311i\221 \013\020\267\375\366\337\031e\327\016\344\272\215\345\013C\343\221\342\203\314m\227\206\300\241\rt\034~A\236\366{\356\343\372\317\005{\354\346\360\250\330M;0}]\223b\330\206\236\322<\362\247\311\323\301pI\033N\345M\274Su\304\354\023\224|\354i\312\346\006\351E_\371vwUijKx\227\222A1\246T\325\307\334\340X\272\217\3425\3650\"`\371\344\017\275>X\232\021s\343*\321^\275S\321\245\335%\0210b\007\247\207FK>\005+\2554Q\255Tx6\031Y\320@\001\003\256\245:a\225\264\270\t(%)\234\tk\205\033\021\361\212\202\212\305\265V+\026\207\252\355uf\270\342\326tkQ\230Y\336n\016\202\233\255\003T\232\177Eq3s\021u\346w\027\305\250!@LI>Q\313E\036|\267\210\207Q!\221\214\r\200\264!\224\304\307\240\242t\002\037"
+	.ascii	"{\311\027\323\360R=\340\273\266va\f\013k\n\346\241\220\202\213"
+	.ascii	"S\003f!\t\026\343lu\031D\272a\327\210\b\263a\023a\210K\030\267"
+	.ascii	"\212A\317\313E\253E4H\351\251pp/\234\242\022\334\033\267?\020"
+	.ascii	"D\204A\007\315^\355|\002"
+	.text
+	.section	.gnu.lto_delayMicroseconds_real.92.daf0effb8d047246,"e",@progbits
+	.string	"(\265/\375`\f"
+	.string	"\035\007"
+	.string	"\362\r24Po\322\001 [\256\225<\fJ!%=s\336@\002)Qc\243h}D$1V&\021!e\264^_I\020\324\f\243\227\247*\225\314,\263A\366\3362\245\242\210,\310\203\240p\220\020\255\020C\365\261\342C\303\307!\202*Q\364pJA\204\252hQT\0257\332\375\356H] \331*\234E_\246k%&\322Y\323ed\273pX\253a\351<Z\277\377\257#\265.\331\371:\034~i\3713fd\276A\026\221M[g\353\022\233\\.QT\363w\250\254\374Z\2471\300\220\343\201\311\360Y`2\354\325\302X\003\271S60Pb\376G\367\341\313y\325>\261&\033aN"
+	.string	"\203\377\315l\244\341:\267%h[\3206$\t"
+	.string	"{\311'c\032\366\f\217\263\256`\336%"
+	.ascii	"b5\005\334\345E;\311"
+	.text
+	.section	.gnu.lto_delayMicroseconds.93.daf0effb8d047246,"e",@progbits
+	.string	"(\265/\375``"
+	.string	"5\t"
+	.string	"v\322@90\345(\035\200\213\263\270$\304\013\222\341]\\\235\330\026PQ2\013\237\364\004\020\356\325~\\\002\332r\311\031\177\327v1\362\r\020\271\302\316\240\351\201\025V\374\226\354-eJ\001."
+	.string	"/"
+	.string	"/"
+	.string	"\027\300\016\337\003\260Co\366\313\273\215\375I\007E\t\200\335\215\252\361\355\271\371\027y\306\251L\317L\301\356:9\225\305\255\267=`\233\300\276\003\272\262\317\372\241\246_\2465\323\231\351k:\037gq\331\255x\005X\027L\361\330\330~\332\007y\310v\226\204\263]\f\223\326n\327q\324\034r\002\252O;\251\225\324\253\352S*\250\217\234\304(>\207#\334\312s\207\276[\330ajv\001\365\252\320\362J\301\234\362ew\246\324\f\373ow\327\001\243R\032\3449H0@\210\244\020\203\366!\305\207\206\217C\004i\243\350\341X\004\021\322\"I$\322\342\246\333\277\325\225\027b\\'E9\223O\355Q)\317\2313\241&\007\f"
+	.ascii	"{\311'c\232\200\032\006\316\0360\224T\346\300\264\253\300\200"
+	.ascii	"K\b\304j\n\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_delay.94.daf0effb8d047246,"e",@progbits
+	.string	"(\265/\375`\020\001\005\r"
+	.string	"\346XYC"
+	.string	"\2216\035\177U\034\333W\253\265,5\032\231\03114\213\236\215l\037z\r8}\265\r\267\304\375x\2646\245\311\300$\316'"
+	.string	""
+	.string	"\325HP\370_`\002{\320@6"
+	.string	"\337\031<\202\275\266\221\266\267\224)\005E"
+	.string	"E"
+	.string	"D"
+	.string	"\367Z\366$\023\241\227\031\273{i\007\303\324\036\241\246\346\347\013\030\256\373<\302\n\224\362\241\243\003A\020S)\346\243\347\205nK(B\345\372\321!\t\0271\270N\345Y\035\330]'\327e\270\251\333v`\333\200\375\221\020dvSN5\366\2131 .\372\355\177\344\215\355]\205v\221\205/\n\006+D:Q\332\365\006<\272\200\346\321\236\346i\037\305Shw)\261\265\313\301\303\212]\217\200/\315\243\307\003P\217\360"
+	.string	"\250Gk6\2144\276\r\356\356B+\253\026/\241\354\316\204<g\216\031\033\337\211\302\310\200:5\2256\205\ny\256R\001\032d|\233~l\357\223\312b\037\244\305T\262\256\330w\371\255\213\356J\323\252\351\324\3647\233\021\033J\004\031\306\311<\321C\222\016\371P\300 \301\202+\023y\200q\262+\302\b\207\344\n\301<\327\207\207;\022D\260+\353t\260k\343\355u\305\r\272\317D\267\250,\212\200\305I\232l\251*$\205n\230\344\311\225^S\365\005%\304\226\247k\307L\026"
+	.string	"{\311'\323\260\316&9\253H\236\016n"
+	.ascii	"&\263o\t\333\200,\222j\254(/\211Z\255[\002\321p\245\247\314A"
+	.ascii	"\273p\352\225@\\\334R\245j\031\250\227M\302|\002"
+	.text
+	.section	.gnu.lto_timeval_sub.95.daf0effb8d047246,"e",@progbits
+	.string	"(\265/\375`\263\003}\030"
+	.string	"v\255\233G\240\330M:\300e\006O\227\025\3164\366\377z\t\312\375\367\006\362vp\214S\n:<G\202r\207\353\330\357\313Phi\333 C:Oa\\ \177\030z\234\034\243'@\016'IM\237g\372\341\0335i\204\220$S\n\212"
+	.string	"t"
+	.string	"\212"
+	.string	"\215E\335\320\206fq\210\351GS\003C\335\204AG\341T\016 Mb\334\031\360\327\005\241\r\240"
+	.string	"\2638\364TBA\r*\t\234\255\235L\003\347\035\220abT\232\342\021\343\356@k\241\277\356\302\266\265\f\317\300\265V\336\016\005\222\231v\020\335\210\022c\254\321L\003\372\363,\003\372\373\t\343\354=q\365\213\201\227\265\005\245\b)\310^\222/C\032\362h1FK9\215\220r\231/\0061\306f\021\322\b\367s\333\007m'\264\236,A\371\245\326^\274R\353em\274\263\005\230\312\255\261\r;\200k\330"
+	.ascii	"\f\345\3228\312\235\001\2632\231\215\311,Lfg\231}\311\254,\263"
+	.ascii	".\231m\311l,\263,\231\205}\331\320\313\276\236\005\237\3752\353"
+	.ascii	"e\366\231\315\314\232\200]\320xR\261\241+F\021]Ub\221\317\007"
+	.ascii	"\013S\331Pv\224\337\272\365T]\325\030U\255p0e5\2111B\b\215\253"
+	.ascii	"qX*\3265\315\274\345\337\021\242+,\207=v\357\206\256)\367c\207"
+	.ascii	"\345\0054\370j\207\002\354\226r\201'\\0\274\327\303\273V`\315"
+	.ascii	"_\367\221\026\023]\013\3605\267\026\321\025!\377\200\337\301"
+	.ascii	"[G\302\373\367\227\020\242+\317Z\222\024m\003\177\357\037\227"
+	.ascii	".F.\273\352\347\177W\371;\322B\242k\312e\2141\350_j\336\307\360"
+	.ascii	"\2245\224SzH\310\003PR\016\336aKP\353\240\340!\2141z\005\020"
+	.ascii	"\350\317\277\t-)NB\331\325\356\0029:=<\336\353\347v\303\311\271"
+	.ascii	"\320\303\023\376\030\204}6|\350\321\271\201\315A\020\301\202"
+	.ascii	"\203\n"
+	.string	"5\037\235\f7\034\237\032\217\006\034\016\265\234[O\r\001\255\266\016:\267\232\217\315v\253\305v\321W*\326\325CX\n,\022i#\246\271\221\253\f[\302\332J\201\025\"\353\033p\346FmmN\023z\2562\267\271c\016s\231'\027\321\213\"1\0370\004\346\277\202\002\303i\366,\233V\221\223\227\313>\243\371\313?+\262;i\213\210\313\203\354<\360\340\222\344H\221\223\226\307\356\362E\250Q,\346\0302\206\261\022Q\234\2024\215\001\220\242\221+\363\021\240\235T\314D\nKm\354{\356/A\210\032\3101_\337\227Jb\206\221M\263\237\234\321\3254\003\232\274\364\234\222]\371\007\374\206c@\0237+,\246:)\303\322j\226+\217\313/HNO\\\346\245N\274\031\035\177\002(J\300\236\373%\207\241F\210\220R\367n\005I\215I\342l\325}\334\032\255\375\243&\233\331\347Eg\341\370%\261S6\"?o"
+	.string	"\021\230\306v\363^\277\233\254"
+	.ascii	"Zg\223JE\333KZ\267%\370\017"
+	.text
+	.section	.gnu.lto_servoDevInit.101.daf0effb8d047246,"e",@progbits
+	.string	"(\265/\375`C\001\265\016"
+	.string	"F\233cF"
+	.string	"\261&\035;,- \346\211\247\353\3466\232\347\331)\337\032\261\n\006;\346\203\270\377D\020G\017R\345i\253A\332]?6*3\2325+g\325\244uDF\322d\363\001\370e\232\325\254;8r\322\310&R\246\024N"
+	.string	"M"
+	.string	"N"
+	.string	"\276\361\320f\277\223\342\220#\333\335NE\230\273\026\336Z\202\217\232&\350\337<A\260@\305`*\227G\r\024\343\201\006"
+	.string	"\325\006M\344\303\023\"\245B\245fb\346z\327\023\206\016N\f\246\232y\202\034\354\256\023F\365\341\336n;\305\266\210\375\226\232>h\002K\206F\266\"cWf\306cg\304\027%\336\272\375\320w9d\005\013\300\267X\270e\201`;\035zvC\004\217n\300=>d\373i\037\305S\200W\221\341\001vkb\264\330\r\023\270\343\036\035~\300\366\310]\300\366h\320\0012\236\027\032T\316\374{\233\215\362\227G\200\201\355\226\353\\"
+	.string	"\251\261\273\242\025\317)\371$\036\215A%\017\363\350\253l\217\006lr\234r\346\324\353]?p\342\205\212\275z\234r\246\372\212\371q\241\272\262C\227\024\371\274\260\2545\366[\255;\003+#\n\244\221\017\223\223\n$\357\201\227\362\215J!\227\204@\2200\022\2413\215L>\022SG:!A\351J\276R\027R\300\236\205\321\327\231<\357\353B\341\376\346\"8\366\247\347\244\250\250+\203\300t\3238\"\235\342R\007\216\r\r\271\343\332\356\256\246\253\263l\251\233^\026\034"
+	.ascii	"\200X{\311\027\323\020\232\253\266v\211\205\274\214\276\253\331"
+	.ascii	"\326,\001Tx\035\301\021\233p`\206\002\233\001aF\202\273\255\366"
+	.ascii	"9\254u\272=\343\326hV\242\203{qCD\331\253\253f\364\f/(\312\257"
+	.ascii	"k>\001"
+	.text
+	.section	.gnu.lto_motorPwmDevice.102.daf0effb8d047246,"e",@progbits
+	.string	"(\265/\375`\013"
+	.string	"U\006"
+	.string	"\224\n\321"
+	.string	""
+	.string	""
+	.string	"."
+	.string	"\005\001\212\001\202\200\200\374\342\303\344\230\032\002\177}\270\344\230v\177{\370\337\230Zyw\270\337\230Tus\370\336\230pqo\270\336\230vmk\370\335\230X\177i\270\335\230Vqg\370\334\230\226\001ec\230\334\030a_\370\327\230Z]["
+	.string	"\005\001?\202\210\200\330\001YW\305\001U\304\001S\303\001Q\302\001O\301\001M\300\001K\277\001I\276\001G\275\001E\274\001C\273\bA\277\177\306\001"
+	.string	"\013/root/repo"
+	.string	" ./src/main/target/SITL.c"
+	.string	"\r"
+	.ascii	"z\311\002K\265\r\363\236\211\337\006\257\200W\300+\340\025\360"
+	.ascii	"\nx%\346+h\276\205\201\""
+	.text
+	.section	.gnu.lto_pwmGetMotors.103.daf0effb8d047246,"e",@progbits
+	.string	"(\265/\375 \370\275\006"
+	.string	"\262\314.4@o\222\016x\255\300\334.\202\265\205\231\212\b\222\370\r\204\031h\211m\252\3777;\345j*\n8\263\037W\377%\023F\327\034v4\001\030\002\265\272\211%D\246w&\004\205\203\004hy\026*\216\005\035\0308\r\260SA\300i3\365\340\251\240EQ\025\324\304\254\313x\222+\223\031jvG\032#nG\337\022Wk\326w/\251o\023r\023\037A\315i|1\3512\276A\214\246\250dV\274\270$\312;\361\370?\257\271 \r\371\214\021D\216Q\200\311\005E\tKf\204\307\016H}\231\nH}n\243X\033v+R\314G\313J&\002\265\001\030d\346-\023\215\272\353_\360O\277E\t"
+	.ascii	"{\311'\323\342\255\243c\205P\\\023\253\021B\013\221\211\273b"
+	.ascii	"j'\031"
+	.text
+	.section	.gnu.lto_pwmConvertFromExternal.104.daf0effb8d047246,"e",@progbits
+	.string	"(\265/\375`\""
+	.string	"\265\007"
+	.string	"\242\01776@o\222\016PpX\034H!\241,\315\020A\314q|\221\224j`A\332P\377\217%\234&\320\277\241\356v\322\204\334_}\312\001\212\360\205?vt\037k[#D\246\031\005\bs"
+	.string	"a!-\333*\262\200?\236\205\006\005\206\270e\017\032\266\305\020\004\026\021?\332D\364\\\213$2-n\"\221\026;\377]\266Jx\032^$\210q\341\203\315\210!\275\232\357F\017z|\253\314\314\341\351\341\373\265k[\025\260\300X\24427jh\362\305Z\t\371\271\357\374\357}Mz\302\265\273\330\312\354pQ\311\354\016\216"
+	.string	"\265\004\336\177IZ\302}\252\352P \234\024J#E&3\343U\202M\255\252\003\233Z\360\243\\\037w\213\322jd\246\245d\032\365q\0222\363W2qt\330\337\340G\370E\002\b"
+	.ascii	"|e\301\2319U\260\227\256\321\034\230 \340\304\223j\305$L2"
+	.text
+	.section	.gnu.lto_pwmConvertToExternal.105.daf0effb8d047246,"e",@progbits
+	.string	"(\265/\375`\037"
+	.string	"\245\007"
+	.string	"\362N55PU\322\001 \235D\254\271\372\025sw\037\002F\254\314w\006\037\335l\240[C\234\034\304\326\233eDZE\310]\264V\204\272:\235\034Uu\322~B\366\226)\005\327\305\204\005!#\026?\034{:\r\017\f\016\020\273\"\244\205A\n\t\353\003=\322\002v*\307\212KB,F\t=\367o\035\311\256\n\271\f\337\251\273\006LH7{\202\324}\330\177\273\273v$\353\347\377w0#\203A\263\313\261\335l\314\324R\262\235\331\003\266U\355\237\034%\373\364\212\005v]^Xv7\3010\340S\365l\373%7\311\254\351\f\351\340\224D6Tjv'$\270\001\365I_@}r \327\256\232\377\224?\022\233M4\002]\001\026v\327*\032y\334\356\266\021l+\330\036\t\n"
+	.ascii	"z\345+\303\n\316\330\360\224e\\F\2314F\007&\b8a\244Z1\t\223\f"
+	.text
+	.section	.gnu.lto_pwmDisableMotors.106.daf0effb8d047246,"e",@progbits
+	.string	"(\265/\375 \376\355\006"
+	.string	"\302L06Pm\222\016\244!\033\276.*\246\364,\246;;@\2550\n\324\253\301.\025\313\326\356v\314\006\255\370F\032\373\3160j\n\304e\2706$H\204\037\2335A\204\310\024o\252\204\005\004\205\210q\030.\r\026\037\0324\016qsE\304j`\013\202sE\314\262\256\230\331\262o\004Q\246\225S\350Q|;\227\227\250HG\340$3\013n\251!\023\267\243p\317\307U+\274\237K\241A\351\204\001\242\022r-\277\201\334\323\370\002\344\033\375+\312\224J\361\224dZ\264\260\244\t$!\375\315\234=J7\216\304\220<*FR\231\031\337F\263\272\354\366\243\001\232\bT\2079\310\314\235&\272\350\257?\301_\375\031\001\t"
+	.string	"{\3117c\361\2063^\307\027\272\206\273\2050^\206"
+	.ascii	"\227n\321\316'"
+	.text
+	.section	.gnu.lto_pwmEnableMotors.107.daf0effb8d047246,"e",@progbits
+	.string	"(\265/\375`\003"
+	.string	"E\007"
+	.string	"\202\31526Po\322\001\240\262d[9\232\232Ih\270\315\007\320\032\004\300j\332\254j\273\321\254\335\372\300\023\003\220\3053[QU\\\\\027\300\211#\340k\006\316\220\220M\366N)\316\\\n\f\t\013R\3234LL\223\017\016\330Fff\204\274\002\234Ah\246\324\262lJ\253\356\247\205\234\3537]H\347\362\201\026\376)eK|D\001Zv\327\300'\271h\302\367x4\005\347\035\364\350s\250\307\003\021\2271\002\363y%\273z\036\334\260?-\344l\370\256\222^*Lv\267R\314\246D\224\017\333\035\3332AA\307\364\265c\253\266\321E\ti\267J\310q\372G\375\213\\"
+	.string	"dE\205\345$\344\371\253\020v\327\017\024\302\270\341m\017\330\276lk\004\t"
+	.ascii	"{\345c\230i\223\331\004p\260\30651/\0023!r\270s\257v>\001"
+	.text
+	.section	.gnu.lto_pwmWriteMotor.108.daf0effb8d047246,"e",@progbits
+	.string	"(\265/\375`\267"
+	.string	"M\013"
+	.string	"\306\326O? Q\224\016\247\024\316\020j\214\3738\222q[\f\230\fO\034\251\363\344i\020\250\201,\345\264},\250j\277|\362\366T\260%\310\316\201\227\300(\374\301\016 :\200\245\264\f5\022\273\211\224)\005;"
+	.string	";"
+	.string	"="
+	.string	"\320\231v\201\013w\017\013\326]\r*>v\275\212#vh\316\246q/\265\327j\205\311\304\215\335\215\312\341\334\223\363?\342\222\356$z^\bv\327\331\2350\334z\333\004l\037\260\277 \307\356\375\227\225\206\231\2664\255\232N+\375\216\001\036`T\370v/|8\026\004\266X\331\376\304\266\246\375\020\027\301\3353\013Kv]\310\370\330\335\212/\330!\345\002\"\207\326\003D\036\232\326\331P\205\232!\245\027\230Z\372\020S\216\324KU_\352@\312\317\327\324\227j\234\304Kt|\225=\240|w\350\203\"\207\327+\306\f\020\031F\371\331\236(u\203}k\025e\337\343\001\031H\002&\004)d\0178\032\350\214EA\203\004\f\342'\203\260a>\221\243\301lbf\363D\013\305\332\204l\213\037M\333\342\304\333+\312\016>\200\214\224d\250\266CO\321\001\220\332]\003\376\211\243\210\340\253\016\275\t\017"
+	.ascii	"{\311'c1\347\315(.<\344\215\202a`\374\305\270\256\214\261\250"
+	.ascii	"\366\\\310\215g\026\020*\314\001wy\321N2"
+	.text
+	.section	.gnu.lto_pwmWriteMotorInt.109.daf0effb8d047246,"e",@progbits
+	.string	"(\265/\375`\354"
+	.string	"m\f"
+	.string	"\226\230UA\020s\223\016?\2313K"
+	.string	"\371\324\242\200\274\037v*p\236\240\2634\355\263R\001IPW\333\032Dm\027\201\005\376\021\r7$\301\005\342\214\230 \022hR~\f\203\032@\250\0312\b!+\255\224)\005@"
+	.string	"?"
+	.string	"C"
+	.string	"\356\212\037\340\256F\264\025\210h\027\2458wA\310\230\261\273%\360\243\256\326l\3227\226\235\\j\250\260\360\261\273/I\\;j\376_^\205V8\034\247\006\273k\f\255x\270\363\266\017\330f`\377\023\256\024M)zrhw\321\237\371\366'\242Q\321\267\n\210p\244\304\354v(\375X\030\245\341b\373\376\212\217P\256\302\022H\326\325F\261\255\353-\373(\236B\373\246\301\272\033\202$B]\005\234@\372\020\017*\253\304\036 \033S>\251<\250\304\007Kv9\345\337\342.8~\213\261\023|\350\352\237\270\253\313\217\216 &\207\211\017\231\304\274J\220\314'"
+	.string	" :@;<X\262\267\017\346\b\373\231M\021\266\303\327\005\n\032\f\232\341\232`\262Q\217\204<\210\340"
+	.string	"\302\353\\$\231\246\363L6\032\316\033\311,\274\020\003\306*\\\331\353`X\366\254\315\363\227S7N\300x\362\343*?\2627<\006'"
+	.string	"\313\356.\360_\034\006\211\337r\365\246\244\304=\024"
+	.string	"{\311'\323\"\f\357,,\332\026J\021\271\231`\034\330"
+	.ascii	" $q\261\r\246]\256\341\3375\001\201F\221#\322\024n`\252\251)"
+	.ascii	"\205\005\\\313\013a\222\001"
+	.text
+	.section	.gnu.lto_pwmShutdownPulsesForAllMotors.110.daf0effb8d047246,"e",@progbits
+	.string	"(\265/\375 \376\345\006"
+	.string	"\002\21506Pm\222\0168c\002\306YE\025\200\206\335\317\242\341\005\306\205z5\330\245b\331\3325\343t@+\276\221\306\2763\214\232\002q\031\256\r\t\022\341\307fM\020!2\005o\252\204\005\004\205\210q\030.\r\026\037\0324\016qsE\304j`\013\202sE\314\262\256\230\331\262O\004S\245\025\024\320\263\370v./QSG\340\224\231\0057\244\"\023\327\243p\n\217\253Vx=\227B\003\323H\003D\005\344Z~\373\270\307\361\005\310\314\374\211\3765UB\245T\220db\264\260\244\t,!\375\315\234\375I\267QbH\247\213\021Tf\306\327\321\254.\273\375h\200\026\372\324a\0162s\247\2052\372\353O\360W\377F\b"
+	.ascii	"{\3117c1\2043^\307\027\332e\374\313\270\340\322-\332\371\004"
+	.text
+	.section	.gnu.lto_pwmIsMotorEnabled.111.daf0effb8d047246,"e",@progbits
+	.string	"(\265/\375`="
+	.string	"\205\b"
+	.string	"\246\320;7@\217\322\001\t\305\200\325\366\t"
+	.string	"\275z\214\005y\r(\260\374\\\377/z\212\337P\237\267\224\204\016>\033\263]>\344\376\352[*\220\001\342\313\r\237T\240\266\267\334)\005,"
+	.string	")"
+	.string	"+"
+	.string	">H\030\231\373T\235\276Z1\221\300\354N\251\036\347\3768\377 \207-\256\227\016E\372\003`\330]\277\016\265q\353m\027\330F\260}\022\232\262\375\f\317\372\237>?J\226\247\270\354\236^1\213\022MV\266G\266\306\266\276\2630\254\273\034\255\222\335i`\031\360h;*\273\253`;\343\"\025\003\252\335]h}\206\374\217G[\210\336\273G_\224y\204*\020\362\364z\223\253\364^\366$=\355\260\0177\027X\004\350\023\355\3418@4<\310\r\223\320:\233\004}:\023\322\243\205$g\343\214\002\323\344\226e\232\324\314=\\MA\335\224T\303v\366\021\216 \013"
+	.ascii	"{\311'cz\373\20613\366\266i#\260\3125\234\003\213g\2068\323\363"
+	.ascii	"\240\251\235O"
+	.text
+	.section	.gnu.lto_pwmCompleteMotorUpdate.112.daf0effb8d047246,"e",@progbits
+	.string	"(\265/\375`\277\003\275\026"
+	.string	"\346h\214I\260\224U:x\233z_\333,E\332\\\221\246\256\315\020\373 \254\177\177&\367\225e\341E\023\032\366c\252([\355\254\255\216\244'2w\245\257$\263\237\237~\366\254\335\361e\340p\377\"\355iL\177j\323\315\304\222\275\245\224)u"
+	.string	"k"
+	.string	"~"
+	.ascii	"A#\335\233<\036\365Q\375U\177\216\272\246P\0254\365\271\2216"
+	.ascii	"\216C\200\241\234#\276\356V\321\371Q\324\371\235\242\204:Ee\205"
+	.ascii	":O\373\205\350\316D\227x~7AE\272{\344\022J\323pJ^\332\365\244"
+	.ascii	"\253i(\202\320)\t\350\214\370\251t\032d\353F\357\006\267\362"
+	.ascii	"\203\262Jw\223\255\356\326\037]\034\235\315n\211\245\273\277"
+	.ascii	"9]\007}I\377\303\376'\370eJ*\"D\320\217g\333\240\344\235\355"
+	.string	"\356\032\263\316kB\345\027\240 \267\005\336\264\255\326X\370\317\320\254\346\224\365G\305\036A\337\317w\343\332\277\253-\357\374*\233u~\365\321\263\346~%\367'\2747\341}\311\356Ur\237\342=\t\357Q\273?\311\275\211\367\"\357K\273\017\345~\362^\362\236w\277\272\327\001\241\007_\221!4\032\3359\001&|R\302&*.I\302\241\032\352\341\245\030\311F\r\022N\241\230\344\304(\031:\343h\365G\241\316\323\317\304<\243\"\221M%\026C.\035P\030/B\241\036\336\344\377+\352\3421R~\\\202\266\230\220\372\321\335\b\210\224\005\005\327\353\025\352\344\244\034\021\311\223\365\346\b\213\231%+\016\311f\203_f\236G8\237m\203\006T\b&v\267\202\353\n\r\202\271\236\320\371\030\231y\225\tu.\007\260\n\256W\313,CL\374k\205\301\203\005-\343\f\006#s\315\306\0131.\013\343KF3\256\264\036\303"
+	.string	"\223\215\263XL6\242v\255\262Yll\023^\300\376\r\034\254\346\316\\S \211 \321\344\235\243\340t\033x5\023\024\2627R\340\001\334\272m\005X\214\263\342\027  \267\005>e\245\212\352N}\270\210\3356\315]yh\217\232\026\227\325\234\013\204\b\253\271\025k\321\016\024=\034\327~\302:z9\002K\250q<\304\021\n\204Dd\202\t\242 \0059\006\260\002\221\221:z\0210\2653\312d0\272g{\223\204n\027\351S\370\356\204\271=Z#Cr1e\360n_X"
+	.ascii	"S\230F}i\177\241]F\322\2213\006\310'6\202\212,4#\025\203\031"
+	.ascii	"\374DL\320\355f\202\332tR\236\214B\022b\333-\327;\t\272qAbK\212"
+	.ascii	"h\272@NGK\\K\021\221\013&\0016\305\f\006\\\255\243 \244\273\003"
+	.ascii	"\223_\r\b\354\222W\274\327\3131#\367\\\345\202\002\340\256\024"
+	.ascii	"\n\230\364\374\315\242\315\227\2130\267\257\253\001"
+	.text
+	.section	.gnu.lto_pwmWriteServo.113.daf0effb8d047246,"e",@progbits
+	.string	"(\265/\375`u"
+	.string	"\355\t"
+	.string	"\006\324F=0\305*\035\236\213\352\365v\207\327.%\337M\205\241s\312OKM\371\347\255\2017\020P\267Y\314N\211V\206\270\343\f\206\r\305\0277F\025\326\333\374S6\312\033\352>~\333d\313\224\0023"
+	.string	"4"
+	.string	"3"
+	.string	"\033\216\273 /\331n\350\361\324\\\372\263\005<l-\202kD\025+\260\2733\212\374\273~\376S\276\001W\250k\246aw\255\340\352\343\216\267\235`\233\301>A\252~fs\221<@l\327\243f`i\222\305\304\3669\266\243\332?9\312\367\320+\336\354\266\270\310v\327c\220\346\262\363\003\314\345v\003\314\245Um\005\320\367W\013>\354*\027~\311\245K'=x\351\2370\227\007\007lQ\243\022\350x\211\3611\003\003g\252\003)\255\331!Jc\210\375m#\313~\370o\177\375qSk\334\211\"\204!38\t\322HZ\364y\210p\200\230&n\302\013\231&i\024\252\230\"\2574?\035w\026\2347M]\347MN\270\3376\262\254\0010\243\245\"\2075\332\326x\254+h\355n\013"
+	.ascii	"{\311'c\032\202\032&\234\301\027\343c\332\345\032\276\230\205"
+	.ascii	"\202Pa\"\270s\213v>\001"
+	.text
+	.section	.gnu.lto_motorPwmDevInit.114.daf0effb8d047246,"e",@progbits
+	.string	"(\265/\375`c\001M\017"
+	.string	"V\234gG\360\260(\035s\276'S!\347H;^\212\034m\3472\244k3\230\220\177\273\205\366hE\353\267\336\222\326\366\327\313O\326\237\242\355\333/\266\274\270\320\374Zu\251gf\366@&\221\313\023\246\354\273\022O\b![\312\224\002Q"
+	.string	"S"
+	.string	"Q"
+	.string	"\005\fz\337l\373'\036\223\262j5d`\201"
+	.string	"yY\201\222\2426\347\bz\374"
+	.ascii	"\356\233w\001\334\267"
+	.string	"\025\241R\325\345\252\312\377b\253K\257\303W\036\300\371\200\342#\326\222\035X\f\331g\327\224\230K\265\373\3149\255\257\030\207{\273\355\005\266G\354\303\004\227\371=\251\356>\363\313\323\374k\265v\352{\200p`\033bW\2711'l\207\216\tccA\302v\312\356\3305\246\217\004Xh1- \030@\220:\r\352\236\331\272\261i \307\313R\2379Q\317t\265X\022x\337<j\325\313`x\2009[j\2649\307!\221\376\365}\\\273\362n\267V\224\234\257os\025\025\374\021\036\211\372\3277_\344\276\375UC\356W\301\n\215\326\214Y\016Kw\310(\341\201\266\353by\024\267\373\331uE\005Ff\343\346\205Kq\330\343J\327%G\315D\bo\213m\365\367\232\037@\243\013\"%!\210tb\"M\bM\250\217\023\t\365\205&\023\224HhR\"\032\371B\"\n$\221AI<\211\243\216A!\017$8\210"
+	.string	"\236\302P\211\344\004\222D$#\020T2\201! \026-\204%\360$\212%\2603\316\313\225/.f3\365U\234n\312\372\303\332\226\364\320n\355\035"
+	.string	"\353\314c\257$\037c\033\214"
+	.ascii	"\232\300\264\336W\231-\204\355\025\243\223.\354g\250ud.\225\024"
+	.ascii	"9uc\207k\334\200D\304\271\t\005\324\201{}\222\204\271$\004\013"
+	.ascii	"\302gj\024\216\035\2419\343\247\213M\tMcPP"
+	.text
+	.section	.gnu.lto_adcGetChannel.115.daf0effb8d047246,"e",@progbits
+	.string	"(\265/\375 \374\005\007"
+	.string	"B\21516@o\222\016C\265\220\375f\223s:0\312\346\216\256\243>u>\237\240\360\366on\327n\351\002\230i\233\345C\356\264>\001\236\331u\314\364\007H\322\370\335,!2\005\022X\226Y\020W\346\253\303\340\260\320\020=\330\303fyb\026aM\304k\253\210\235\315\032\005\266E\217\246mQ\323e\241\351r\325&\004E\337\201\036\344\370b\022\232\376aN.M)\311$\275\264$\nu\342\361\177^\363\303\367\006\007\237\206X\f37HL2\273\202#@\251\377~\024\3443\307\271\b\2018'\026\214\221\225\314.\006t\240*\365*P\225\202\035\345\372\270[\221*\210H*\243\022\250/\223\220\231\277Q)\243\303\376\004?\302\257\021\b"
+	.ascii	"{\311'\323b\2363p!\271\206/\230`\211\2510\246k\222\001"
+	.text
+	.section	.gnu.lto_FLASH_Unlock.119.daf0effb8d047246,"e",@progbits
+	.string	"(\265/\375`\333"
+	.string	"}\f"
+	.string	"\206VVE"
+	.string	"\2614\035;?\332\245E\337J?\365m\214oC\2461\021\247k\242"
+	.string	"\316\202\276\222O\024pL7\2467\003Z\315T)7\222M~\375\251\333`\251\022k\251\036S\220S\217^P\301\342\330j\263nD\312\224\002B"
+	.string	"="
+	.string	"C"
+	.string	";\200E\fJF\317\356FEq\323\255J\323\344\207\276\356\026H\346\225\002\022:\247\0323>\231kE"
+	.string	"\325CE\200\357\245*\320\323\355\334\346\351\341;e~Bv\327\351}!\356\353\266#\330\206`\177\024\257q\007\226\274w\313g\271n]o\363\003&rR38#\\2\264\301.\365\204}\r\3030\264\322\330O\347\323\377\030(\301ss\035:\2731!\217MY;+l_d\223\215\343`\212i\233\234\250v\267\341\"\007O\365\221\251\330\005\\\t\376\233\307\330\236\232\251\331\205\271\247\001\004\023\021\334\262W6\344=c(\355^pH\325/\207F\212"
+	.string	"?\200P\267\\W\0130n\274\344\016\3738o\321\342\016e\031\311\003l\001\bvA\004e\343T4\r\243pB\3322\244\220Th0\302 \023\231"
+	.string	"b\322(\223\340`$\2264\f\\I)\246\230\224\240D\022\267\022G\2307\025\215\213\245m\343\242\b\334+\215C\\\364\364jw\327\002\020\025"
+	.ascii	"{\3117\323b\2353pW\200\025\240\272t\265\006H\031\027\256\200"
+	.ascii	"&@\334\257F\001+$\342\026\033\002\264\313(/C\214Kw\263i\251\220"
+	.ascii	"(j\025\024"
+	.text
+	.section	.gnu.lto_FLASH_Lock.120.daf0effb8d047246,"e",@progbits
+	.string	"(\265/\375`\227\001\025\020"
+	.string	"\326\234jH\340\222*\035P\266\266\313#\323p\317\235\266D\234n\277\301\373\037\360\373Fi\224E\003\206iq\b\\\241\243qT\027\243\363k$I3`b\210\232\205\326\271\374\022  \306\315%\237\032l!] j\270P%\233\310\235RU"
+	.string	"Q"
+	.string	"V"
+	.string	"\266\353\370Q\253\210\035\037\325\006\275Qa\373\037\263l\235\343b*\002\032\216\213\013\036\265VpS\234u\352\355d\371\257=@\t#O=/\367@`/_\257@\254&7"
+	.string	"\346\362\034\344h%^\373\f\001k\231\023"
+	.string	"\204Z\253g\t\033q\177\267]\301v\311\376\215:\231\211o6\270\357\032\337\327\346\340a\276t\bMm\266\323\275\226\2349ZL\306\232\345\373\232\314\340p\315\036\366og\301\342\313\370\303\312|y\352\257|\247_z\302&Gv#\321\232;6\216\234\213\302\276W\027\306\376\264\367\351\375\364C\026\310p\002\026<\257\221\320\351m\277\271\360z\211\301\363\002C\2476I\211n\247\003\261\244\337\3421J\261\034+v\020\230\336\332\246\223k\311\232\0071\235\235\200\271;k\275i|\377\311w\333a\210\006bjm\275\364i\376\002\345\313\234\032E\024\277S{\334"
+	.ascii	"rYrf\3676\001NA\231\210\3041\245\022\206\037\203\204T\fB \ra"
+	.ascii	"\007\223\nT\202r\032G\031$\220\"\214DH\022\370$\032\225FH\340"
+	.ascii	"*<I\231V`\n\312$\202\247\224\n\024\201<\252\204)p5\216)\360\203"
+	.ascii	"\253_\030\213\334f;]k[\250\202iO\240\260\217\325\344f\336\201"
+	.ascii	"y\333g\220D9\001# `\2021e\311\003{\362\211-n\233\201\302\301"
+	.ascii	"m/\270+\347\272p%Br\214.\t\320*d\023\261\256\003k\270q\020m "
+	.ascii	"\016\327\r-\033Ih+\377=\342\255D`\333\274\021on\251\302\270\322"
+	.ascii	"z\200f\270U\017\177\034w\226n\331N\033I\2156C\001"
+	.text
+	.section	.gnu.lto_FLASH_ErasePage.121.daf0effb8d047246,"e",@progbits
+	.string	"(\265/\375`\020"
+	.string	"e\007"
+	.string	"\342\21536Po\322\001\240`f\3416i]r\370"
+	.string	"[\315\223\321\237\365\250\306y\2735\004\367\220,\203\r\026H\313j\271\t\330\266\bj\250\2462\301\254\267Ik\204\354\275S\nYvI\217'!\342\372X\016"
+	.string	"\356p\032 \030\036T\273>\322\322\224B\302\232\320\216\314\224S\031\253\270\244j\030&u3\367v<GU!(\262'\350\301\016\373q!\311~\261\364\362\225\226\335\214\030\230U\231P>lo\366\306\366{\366E>\262}Z<`\227\224r\262;\013\254\232O\236\032\333>\310C6s\013\027\241\316\240\304\202Q\342\262;\265\372"
+	.string	"\365)^\200\372\004=\316\375q\376I\256 \3320\031u\240\277\f\302\356\372\215:\215\033\3366\201\355\003\333\034\001\n"
+	.ascii	"{\311'\323\"\030\366\250\240\\\303\241X\214\016L\020p\302H\265"
+	.ascii	"b\022&\031"
+	.text
+	.section	.gnu.lto_FLASH_ProgramWord.122.daf0effb8d047246,"e",@progbits
+	.string	"(\265/\375`\270\001-\021"
+	.string	"\366\340uG\340\322&\035\243\022\200@\373zs\3663\352\023\263\341\371\330A"
+	.string	"\302F\302\177\034\353\274T\341\002\335sulk\027\224c\203\235f\"\273C\340\003j?G\023\002\005\317s\f\246\214\020\226\241Z\313\274\321\233\335\233l\231R_"
+	.string	"["
+	.string	"a"
+	.string	"\227\236\241l\373,\336\002\307\256\225\030,LYA\204\207(\310\356\214K\335d^n'0/\243\211\273>\345\026\325\345\237v\b92$0|}\216\204>\227(\237o%a\214$\324\321\270\231\364\240"
+	.string	"K\302\330\246\300\307\021\220\323\256\035\302\034\325\223\203\335\265\202\341\207\373t\3332\266_\354/\005\322\031Xz\360\322g\315\313\307\223\322\210%\236&\230\326\354\331K#\220\375X\253\325j\216?\366\205~\324g\377\224j\271\251uS\177D\345(\310"
+	.string	"\321nO\255\310&\311\032)l\343\330$\266\243^h\203\001\354\222\020\302@\325~\320]\340|\306\341\002v\177n\030\355\316\026\230C\005\r\022\\\332\035L*\026_\236Q\306S\tY\221\243\207\035MJ2\200\242\342\214\366jF\017Z\306\227\375#\304K\304\246Qy\320t\314\270\360!\031\214\313\2409\r\246\335M\271\214\241\2737\216y\251q\332\270\"\305zT\304\b\344\031\037-\320r\350\350\020\373E\254\003L\273\260\203>\321_x\376\211\007\036A\240Z\325t_J\306K\265n\274\224\315\211K\314\347Q\240\351\276\225\367IxYiy\300\242R\341Du\203\241\323 \277\230\230n3\f\n\313\204\b-\\K\265\372\272\026W3\323\321p0\037\213CI\331\263Q}\\\313\363>\216d\266\3376\376lw\315'\365"
+	.ascii	"\221\004\2139\333\356\356\034\2402~\350F.\005d\273;\007_P;\001"
+	.ascii	"  \240\002\0312\365\273\363\3112\375\036\303\203,\325\312\004"
+	.ascii	"e\234\307;\006\203\b\267}\301Q\032\212\317\2078\253\230}\026"
+	.ascii	"\013!?a\017\213\370|\330i\317\006\023dB\226\215\020\030\376\273"
+	.ascii	"\202\240AR\322\317\325\265\206\264\334\250\266\006\n"
+	.text
+	.section	.gnu.lto_IOConfigGPIO.123.daf0effb8d047246,"e",@progbits
+	.string	"(\265/\375`O"
+	.string	"\r\t"
+	.string	"f\021@90\221\322\001 T\263^\360F\351\034Kc\016e\322fQ3\240Q\222o\254|CV\340-*w\357_\313\316P\245=`\256\261\212\362}q\274\013\031j\315\347p\373\275S\n-"
+	.string	"."
+	.string	"0"
+	.string	"r\373@\347\322\237]\363\032\333\002Y\b\310\354fwg<\371w\370\371w\271\307\365j\035\006<\354\256\241\3535r\307\333>\260=\262M\0236\273\"98K\2233(\266\377\261\035\241-b\370^5\034wIbD\207\366W\316\362\275e\343\002\2730\025\231\335\272\340\271]\272\236\240\3634\216\330a\017\364g\324V\370\313\205\035.W\333G\003\302\245\215\221\001\357rB-\205\346\021[vm\301Xb\037`w\327\021fG\220\t\314\353\261&q\022\020\250\324IEG$\016\204:u\221\246\240\273P\004\00571Y&\224WbMU\252T1;o5C\006\246\026&o\262(\365\346\247\356#\314[M\026\013"
+	.ascii	"{\311'c\361\201g\300E%\317@\354\032\004\025\306\005#\002T\024"
+	.ascii	"p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_spektrumBind.124.daf0effb8d047246,"e",@progbits
+	.string	"(\265/\375`6"
+	.string	"\255\b"
+	.string	"6\320=;0%'\035\200\365H\221\003.,<\005\354 \367\022!GgH#-j`L\023d\334\210F,\260\244\212h\242\036\213h\301\205J\037\013\314\347\177M\312\224\036,\262\355\272wJ\001)"
+	.string	"-"
+	.string	"-"
+	.string	"\237\366\354\232\207(k\300R\022\022s\263\273T\236\334{\364\374\253."
+	.string	"\242\276\307N\303\356:\202(\222[\3366\202m\b\333\2532e\313\217\212\b\352)6\273#\001"
+	.string	",k\322\254xl?\332o\271\213\367\027\216\017\354\246T2\273!\203\351\365\351\360\005\234\317\353\004\2342\345\2535\303\352\220\036\356D\037\206\263\027\276:9\364\211q\201\204\022>m\215\215x\320\n-\025\353C~v\370Eib?`w\327\001\256\3202\207\322\251v\027\230\211\373\2202\013m{\310\250\227G \t\212\210\t\332a\244*\352\250\226\211JtT9\n:\360f\302*\355\266\255RO\270\017\n"
+	.ascii	"{\311'c\261\204g\300E%\317@\004\206\\\202mVS\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_unusedPinsInit.125.daf0effb8d047246,"e",@progbits
+	.string	"(\265/\375`\005"
+	.string	"\035\007"
+	.string	"\362L15PO\323\030 [\204\255\272\203\316\262k\327\360\210\f\270-\336\323r\200\030\021\342\274w\223\261O\036\315\242\264\200\270\257\365\250\274\203\200\316HE\0346O\330\3362\005c\324\364\\\223\202\230\230\256lf\005\203:\017\022\236\b\211M\024\326\007\223\223\372TH\220u\311\316\301\225\305dI\254\252,\311\361Vch3\202\3716\"\307\001pe\311~AW.fP\tc\343!\023T\372\f\r\250\334\n\243\227\257#n\357m0\216\274\002l\f}$09\351T\024\263\013RC\263\237\344\202\362+g\355e\324+Y\203\024\321G\313\314\356\312H\242\232BmU\025\035\340\272M\241\200\303\356\016\271.D\217\372#\374\r\277H\n"
+	.ascii	"{\3117c\361\2013\304\370\024y\332\347\032\356\026\302x\031\002"
+	.ascii	"\\\272E;\237"
+	.text
+	.section	.gnu.lto_pwmCompleteMotorUpdate.part.0.177.daf0effb8d047246,"e",@progbits
+	.string	"(\265/\375`\305"
+	.string	"\365\n"
+	.string	"\006SF> \345*\035'\027\203;\002\f\"\n\244\0214\177\277\035\032\f\f\240v\362=C\306Kk\261B\037S\250\240\244\264r\323\003\r`x\215#\0230\304\320\037 \323\346\214\205\177\310'\233\354\235R0"
+	.string	"5"
+	.string	"5"
+	.string	"\247O\261\235zY\264\003|\214\355FF\200\3036`w\353\351$\271\370)9\321W}r:<.\r\316m>\273k\357\343\246\267\355`\373\301\276D\353:P`E\250\214\354\263\333\237\245|\232;cJ.\214k\362\372\350\316\251U\276\"\236\3051_\326+\341\3462 `w\033N]\275S\217G\350N\275\037t\001.\177!}\245Rw\372\332o(owe{\213\311/9\365\t%\337:\365Q\031\032\362-\237\366\307jPhXS%'\314\223;\267s\304\236\334I\b\001\310\006#\213\220\b\024\236>\317\"O\304\004\004\250\206#\n0\024\326\213\212\020\251\212@S\3650\370\303\030\2015\374>\260vl\313\177VscN\230m\216,\270g\272\327\016SR"
+	.string	"\020\034"
+	.string	"\177\311\017s\024\213P\266@\320\2010\220\t\030\330Q\371\r5\326e\332\002O\0012\227\271YcBg\255\2241\320\342\250UJ\021X\301L\242\352\242sA\233.;\027"
+	.ascii	"N<\220\243\245\351'\2241"
+	.text
+	.section	.gnu.lto_motorPwmDevInit.part.0.180.daf0effb8d047246,"e",@progbits
+	.string	"(\265/\375`A\003%\030"
+	.string	"fk\230G\300\030Uc\3401\r\327\\\250\273\036\331m\243\264<\256\367\026\351b\377\337\256\345\352\314\314=\303C\244\3442\341XHb\251\315\240\234\307"
+	.string	"\006\b\236\261\207S\021\354:F%\310\232<\270J\035"
+	.string	"\035jm\313-eJ\001\200"
+	.string	"\204"
+	.string	"|"
+	.ascii	"7E\316$\265qrf\367\341\363\231k+*B\274\367Dp\353\023\351\326"
+	.ascii	"~\017\231i\002\316\032*r\347\361\337\314\264z\202Dm\206\3117"
+	.ascii	"4\021\304x\357y\272\365\371\232\362\226t\232\362\266\3220y\362"
+	.ascii	"\274+\245\335\222\225\2264\237\342t#n?\374\003\333\317\021\247"
+	.ascii	"cq\222\204)\342x\021\243\273\221\t\200\204\305\017\235\242\320"
+	.ascii	"\325h"
+	.string	"}\361\2558\245y9\322\271\367\232\324\342\036\335\366\007\333\034\354z!)\216\\n\f\253\344\306\205~ ?\221_x\322\276\217\344G\374!\227\204d\316\021\237dv%^b\272\235W7\002\376\234?\343\275W\003\351\326D\236\246\374q\377\207\314\017\362\"\037\272$4\322\"\257\213c9\177DFZ?\t\354\210?\242\t$\"\262\017y\231\354\2751H!\017\316>\344Eg\356\315\266s@\272\235\241@\016\214\231F\324\260\271\265\245\007\306\016\340^\236\221\001if\227n\351O\343\344\310\316\256WJ\233\347\354\240\264\276\242p}\245Z\200Pnt\213k%\353(\212\211.\344\275\367\326\332\263}\340\257\264r(\372\t\226\330\331\350\321\177\253\264{\356\2445@\201m\021'J\311X\271\367.`\362&\035|\033\267V\261\350q\267>\253\274\375\320\r\004\005y\273_\226\032=\272\276\002\t\213>Z{\256e\345\025q"
+	.ascii	"\021]y\266\251-IM\376\374+\275\320}\030\322g\224\331\335\033"
+	.ascii	"!L\236\025\004\025\b\t<&j\345\363ZY0_\261\030\363\345!&\301\364"
+	.ascii	"\300\223\312\360\322\223\332\260*\301V1V\003\027\013\306R\275"
+	.ascii	"\030u\023\241\002\004\n'\230\331\343\332\201\235V\251\035\325"
+	.ascii	"\t\345z\235nLf}0]'\030\213\345:\225^y\376\360\001H\233\264\032"
+	.ascii	"\024\374\355~\367\326\216\263\266Z\247Vm\266\3660\274J\321(("
+	.ascii	"\230\343\311\355\f\247\322\232\362\234\013-:\252\275s)>5\207"
+	.ascii	"\362((\223F\033\276\200\214\240\215]\017\0305z$k/G\250\2210\204"
+	.ascii	"\020C\006!\tDF\002\n35\006P\002Q\314\3146\020`h\234\264\006R"
+	.ascii	"mrb\367\360B\241\361\256\013\337\367\323bU\305\030\253\311\201"
+	.ascii	"\356}\261\032\r\330p\301\212\235>Y\026\327\277b\206\006|\245"
+	.ascii	"\257y \205\315M@%lTV\b\261\022\320\205\204\327\267\332&\f\201"
+	.ascii	"\002 \223\242\250L\253\035\366\2106Z\276E\313\275>\340\231;r"
+	.ascii	"B\264M\003\030\243J\205K\034\200\374\231\247\2757\033Vn\370\277"
+	.ascii	"\274Z\276\337\333L*]A\177\377\2111\004\001\340HX\251CM\325\023"
+	.ascii	"\001\r"
+	.text
+	.section	.gnu.lto_FLASH_Unlock.part.0.181.daf0effb8d047246,"e",@progbits
+	.string	"(\265/\375`\235\006=&"
+	.string	"\272C\310\016H\200\334M:5\371>\206M\005J\323\224(\212\241g\001\023G\277\377\354\242\027\340K"
+	.string	"iAx\330\034\036m\370\213\217/\004\t\375\375\022\375\242\367gi'd\313\022~\254\273;/\n\250\242\033:<\2324i\204\020\271\223\f\325"
+	.string	"\305"
+	.string	"\342"
+	.string	"F.\366\023o\231\317\207r!\177\312\307\370&\026\026\006E$\025c\003\330\220#\017\316\227D\030\227\002e\017\f\357\215\252\341\243\250\227\002E\336\253\341\275\201Je\251y2\347\336\241\320K\316\235/yx\002\346\313\363\002\314\007\317\017\302`\276\335^\336\t3\303\250b\225\331\315\207^\367"
+	.string	"\230\215_\330\234{o\356e\013\271z\324v\326\314\222l{S\371\250\225\357(\220\215L\303\030\177/S\225E*\b\322\003\355I\252\260\354\331;\206O\232\324\312T]=\370\263f\215\310\210Kk\313\023\264\262F\024<\020\220\033Y'}\254\250\310\364\336\373\261)\333ds-\361\261Z\311\013ieT\036\274\225a%em\200\337jD\367^~\224\326\231\347\314<d>"
+	.string	"\346r\030M\266\r\373\3351`m3\037\205\260\007v\247S\355c2\3335\037\026\257\255\340\325"
+	.ascii	"k\317d&\237\313\3147\363\b\022\366@\376\330?CLI\025\232\331\332"
+	.ascii	">\356\367\361\214\231\261\356.fva\276\333w\345Hd3e\351\360\233"
+	.ascii	"\237\345Z\\\360\277\270\204\211\222o\302|\3718\300\263({\344"
+	.ascii	"\037{\341\257$\351\3165\003\356\345\205\257\262t\336\273\036"
+	.ascii	"\270;W\t\270\024*\354\201\357\007\377\034+\230\021\315\214\252"
+	.ascii	"}\266\273\270o\357\343\361x\344\016\302\334\226\177N\313>5\313"
+	.ascii	"=\246e\236\322\362\255"
+	.string	"-\243m\331\326\226\317\023\317\265\266l\266\345\362bg\222\264\334m\331\266\345\003\221`Y~\266\356\265qL\273>\312.\001<\324\036\366\300[/\3450\376\262f\234g;\204\326wT\177p\235\353\251\340^\242ih7\027,i[\301\257Zwm\271\255{\266\246cg\316\303\344\330\272\213h\354\030\251\332w\341\341,YP\363F\355\032\340%\344\\\257\025<\200\"\232:\306\025\201\026\0233\301\f7e\305\333@X\310\276x7K\027k\243\022\271\331\326W\221se\201cV\215\250H\326\250`gS\300*+\203\354\313\234\354\027\237f\351c^/\376\214\272\244\200\227\332\344\\\215p\252\0235h\325\240\031c\374\375xv\306Ev\027\327\232\354\216\202\305\tqMj\315\266\367\236\303\230?\224\371\342\215E\t\274\356\215\022\3631\030\370_/9CQ\221i\304\301\036X\353\364\027\306l\021X_\020\330\262\231=|"
+	.string	"S6\004,2\264\253\016\214:\005\245\024tO\273^\013 F\031\260P\213f\364\tI\327Kj\300(\357)U\3221\355\220P,`4\227*1\005\245\025R\335\213\235S\352"
+	.ascii	"\347\024\204K\225tJH<\246\264D\212$\036SS\b\023\033\2160t\320"
+	.ascii	"@b\210\205z\315M\273\023C*x\275\025:\335M\367bw\304T6\235\223"
+	.ascii	"\206:\200\340p\224{\322-\365\220\236rM;$\025\271\244\236Sn(e"
+	.ascii	"\336\n]/\367\304\343\365r7f\266'o\007a\242\250\226\342>y\357"
+	.ascii	"\275\250\220\365\351\013m\rU\006\215s\275\031\356\345\217\225"
+	.ascii	"\361\323\266\253\t\266\307J\305a\017\364\351t\312\306@\301dg"
+	.ascii	"/\346\313\236\366!\236\261\222\025\3012\253:T,\363@\236~\226"
+	.ascii	"\265\t\02343)\2364B\033\231\337\272Gd\003\301\332\372dn\251\212"
+	.ascii	"N;\305j{\250\201\034\346\0204H!\022\021Q\320$I\007P\0021\350"
+	.ascii	"\214l\003\021P\265T$#3\242JZ\003P\217\032\325\301\267\314\226"
+	.ascii	"\301\242\376a\246 ]M\217\353)\327\203\210j\245\253\337\303p\300"
+	.ascii	"\264\210\260\252\277\337\024* $\265?\326$\375\177\f^d\265\321"
+	.ascii	"\212\243b\213R\257/\202\bly\370K\336\222\215yjrI\241\354\023"
+	.ascii	"\311\257H\213\034\321~$\270C*\342\036$\315\r\036\322\3527\032"
+	.ascii	"\022\351\341\210\344\"\225\222E\033\204[\\[\030=4=\201\317\271"
+	.ascii	"6\031\023~\032\036r[\346\361\243\234{ l\252\272L4\n\321N\237"
+	.ascii	"\002\355\002h\272\327\360\373\304\231\311CA\020\331L\250p\327"
+	.ascii	">&\n\366\345\256\270\031\372j&y\342\\\025\231K\001\260i\305)"
+	.ascii	"\033\202Y\025\361ZZn\360\341\027\0219>$\337*: \f|Nw\306\245\355"
+	.ascii	"\232\t\273-Np\030\233}Np\2154\335\302\\\256\226\203\247k\300"
+	.ascii	"\334\342\\\342\275\271\004c\237\315*\r"
+	.text
+	.section	.gnu.lto_FLASH_Lock.part.0.182.daf0effb8d047246,"e",@progbits
+	.string	"(\265/\375`\207"
+	.string	"-\n"
+	.string	"\346\022F;0\345\2521\200\213g\234<\327NG\202\203\244\215\345 \240\003G\211\260<wp\266\352\352"
+	.string	"\273\233\276n\266\301\275\207\036l\023 \335\0360\003\003\332}\311Ed\226\306\266\245\224)\0053"
+	.string	"4"
+	.string	"4"
+	.string	"Vmxe\273\374\026r\013j+\257\023"
+	.string	"\367\336\372n\202|\365)\351\312\277\355\232\021\306\372\334\3008.\007N\003\026\356\275\316t\334\335m+\330\006\331~\t\247\371\"%?\276\363S\230w\237\023\206\"\213\331<Z2'\347\314\223\236\336)\263\245\364)\255\265\b\304\356\325\310\005\270\037]\212\210}\233\312\346p\336}\304\016\225c[\236\336)s\206E\005\327\232\031s\316lk\344\247\301\t0\t?\311M\354q1\332\275\256\217\026\031WExg\237P\362\243\275\327d\331/\371\r\303\001\336L\200\243\317V\224P\236hK\336I\344\221lh\002A/b\364Y\217\204\303\207\301\323"
+	.string	"q\340\257\343\001=|\252\bR\204!\261\226D!R\375\302S\355x\266&0\254\242\265a\021"
+	.ascii	"ze\321\033k\270\215\025\030H\004D\3010W8 &0\316\210E\235\323"
+	.ascii	"i\241\315\224\235\006\200k/\246\234\226\323\257-c"
+	.text
+	.section	.gnu.lto_FLASH_ProgramWord.part.0.183.daf0effb8d047246,"e",@progbits
+	.string	"(\265/\375`5\001\r\016"
+	.string	"VZ_E\360\262&\035\222JtF\"\243\313\243\305X0\222|\302\017\270\364}\207\273\266\322z\024\022\320\264\254\033\202\2645\242\366\374d\217\252\256\303L\337\255\261\225]\206\225UOK@e J\016\202\361\216\242\337\366\226;\245H"
+	.string	"K"
+	.string	"K"
+	.ascii	"\337\2319\200\335\027\216\240\335\016\301\243%\366\350\356\004"
+	.ascii	"D\217\330\005\210\036\315\331<JvW$\027Ajf\374\330]\251*\316]"
+	.ascii	"\037\344\374\325\365?WIq"
+	.string	"\343\243\345\022\361\027\340P$ew\215\215\270\343m\223lO\260O\"CB\213\"\336ha\373@\226q\366\241\323q\331\354v\007l\313\214l\020\316\t\371h\377\207\263G\266\312\036\351\273\017\367\236\024\354\326\2451.C\365\236\224Gvq\200(\300\0363\370w\036\356;3%\335\206\260\361\237\375\027\207\241\nOi\334\306i\200\316.\353\255\rc-0\360hk\200yo\371@;\204\344`\351\312\252~\215\016)\237\205\037#z4Ya\342\372T\307M\217\232!4o\350i\216\025\302\335]\353\313\276\317\257\361\371\235\347\277\310+Q@h\027D&\341@Jp\2221\310^N*\224\346&\341\244M\227mB\260\340\200\245\301\212\n\005\023S\f\006mC\234\245\222\006\335\202\262\022\341\001\213D\231\\\246\206\222\031.h'\3312a$J\346\355\3054%j\333\246\034\331~\207\253/\247\320\250\007\253j\216m\222\033"
+	.ascii	"zeY]\326\360\266\361\300cB0Hcd\211Z\016\210\202at\271:\214\212"
+	.ascii	"Dn\206\261A7\2450\215\344\024\f\206\205\360\213@\n\227\031ar"
+	.ascii	"\316;\334iE\\\313F9GS\350\273\n\036"
+	.text
+	.section	.gnu.lto_.symbol_nodes.daf0effb8d047246,"e",@progbits
+	.string	"(\265/\375`\"\r%'"
+	.string	"&}\326C`^N:3P\250\306\211L\345\303\261P\205E\340\255xn\353GL\321\341Q[q^\034\rv 1\021\023\341\002\016\336\301;x\007\357\340/\200\203\323\327\272\212(\267b\020\300\214\340-\b#\231r\313\024\301"
+	.string	"\274"
+	.string	"\306"
+	.string	"i\216\276\031\034\3752\365F\237\214\215\376\230Z\243/\346\301\267\230Pf\201\366\240\372`\252\204\247\346\204\277mq\212F\005\023\303\205\031\3750UF\377Ke\324\301\275\240m1\372p0z\325\352\213^+\325\305&i\3322\263\305\373\230\274\\.\227,z\253\324\"\333\361\322\272\310\254\350\245\222\340]L\025\375\275\272d\301Dp.\007R\364Jy\352\313U\024\313\343\300\211\2452Q6\023\375\270\372\251\022\217c\376\257\304c\033\211~\236:\242\257'\242\217\247\206x\322\224\272\322\004\321\277\363\241o\247\362\277E\324\303\361\314\016\375:\034\372t~(\221x\\\373\373\027\243\265"
+	.ascii	"P\024E7\364\347\324\377F\006\002\275dh\275cQz\305\240\364\"y"
+	.ascii	"\322/\344\244\277l\322\033\344\254\327\007\223\336*\263^+tIo"
+	.ascii	"\217\262\005\246\222^\260E\217\350\0174\366\036Y\262\357\331"
+	.ascii	"\261\3631\305\372\204\302\372"
+	.string	"\203\222\364\005!\351\007\252`}@G\372\177\366\253\357\247z\365\365\\\320\237\265\262\355\352\367\031\271\235\311\325\347+\322\317\253D.\307\344\253B\333!\375;!}8\033\244\377f\253\357F\253\337\246FH\326\235-\220~]\315\352\323U\254>\233\253\355\372\261F|\364\347j\217\345\262\332\"&\217\376\232Z\325WS3\f\251~,\356\216\035K4\227\270S\346T\037Y\027\355\247\351>\232\252\243\177\306\264\312\023\274\213\007\310Qs@= \007\351\f\324\025`\251\244R^\022\007\227\267\370\346\344M\341\234\3743\3069\371\247\\^\336)\341.\347\344!\343\220rw\331\327GFdL\236L\224n\322\327\332\335\234\034 \335ur\2733\311\353\352\312\223\215\322\273\223\217\212x'\037\245[\224\347v\273\223\215\336v\003\211-\277\b@b\243b\035\022\007\333 \321\t\340\250\271#\016\2629b\2454M\021\0230\252)\342"
+	.string	"\312\257)b/\275g]z\275\322\336\"\227\336!o\275D\266\364\n9\366\242Zz\177\270\365be\351\005\202\245W\353J\357U[\357\026[o\330Z/\023\265\336/+\275fUz\227P\351\315J\353U2\245\327(%\037#\346a8\353\256\220\335\223\227;\237\327\024\230\322\345\370\367\266\333%\207\207\226t$\377\214I\345\036\243\362H\226\332\212\227\326U\346o\216\3349Z\372\366\316\307U\256#\226\326\363\036\307;6\340p\374A\303\360G^\372\221wlxah\301\316\316\033\362wC\336T\317\020\252\302\023\005(^j\360\004\201\225\224\357\023r\322\230\223\220\211\210\273w\334\324\334\212\204\317#\343\026v:!kp\022\n\365\234\364\032p\220\001\007\237\\\240\240\251\251\211\203sM\274t\230x\213{L\034\305\307\304\3019\246<A^Z\206[C\265%\f\362\022\f2\313\347"
+	.string	"\231\310H4\224\326\001\362\220\321\016\220\177\312\364gL\002\371W\214\373\035 \257\222\0160\200\342\250a\034\307L5\"\222\244 \205t\300\002\241\241\032u\021\240\224\243\016\031\"\024M \021\225\364\020\365\265\243\232\336z\237\235\375k"
+	.string	"\036i\006\204\213|\006\360OD0_\021\"\2308\026\201\027\253\215R~\301\224\265r\372\212n\"\334\225\"\n;\325\2644\r\264\204\350/$\207 R\323x\3131D\327\350\332\305r\374\275\266\235\372iW\004U1w\225\277q\2374\3710\004\275C\303\202p\341\022\204\302\021\356g\215Q\335\245\037\303\261\251\227)l\022F\276LA?\221\374.H\220\301\271\330\205\262\3125\243e\353\343d:\323=\350\377\032_\320h\3618\036\307\343x\034\217\343q<\216\307\3618\036\307\343x\034\217\343q<\304\250\300`\255\203\313\200\027\352\334\257\265 -\004\376\264\320\260\317Y]1gD\301\205\f\251\301\211\224\251\177\f\312\277B"
+	.string	";\200@\255\005\236\314cO&\322\246\255c\361N\316&n\305\312\330j\226GPx7\r\bB\006o@\245\330!\3633\212w\207\343\326\314\261\234A"
+	.string	"\026\374\301\f\b\026+:\330\372e\264\250\330f\234\363\223\270\216"
+	.string	"\r\r\234\013&\"\314;\360\177\247md\3420\316\272H1c<e\360m\370\234[x\2001\260\306\301\330ZN\326\277\377\310iF\003\224\367QD{bv&\226^G\364G\004f\335\244b\232\260\220u\024\271\241(\337\241\"\021\342\0257\007\205y"
+	.ascii	"\253"
+	.text
+	.section	.gnu.lto_.refs.daf0effb8d047246,"e",@progbits
+	.string	"(\265/\375`\351"
+	.string	"M\n"
+	.string	"&\033J3`i\223\3410\305\205\242A\020\004A\020\004A\020\004\2461\274\350\036Pk\372of\366\277\"\376ga\263\350\203\320\366#\243\305A\244mB\366&\204l)S7"
+	.string	";"
+	.string	"?"
+	.string	"\\b\037M\374a\337&\316\260\035\317\234:\033\r\320%\244\177D3z\335\020\037\316\030_\316\255;\214\323\271)\303\247\216\2666\035C\241\266L\331\373\205.7\027\313g\206P\244\267F_\0068!-@\240\363\241\0038\253\005\360\207\352)\252;T\357x\\\252\336Q\035z\337\3367\357\373\370\200~Vo\213\263\305\235\305\351\350\320L5\3647q\007\373i\n\024^A\341\025\t\237L\370D\205G(\377\240|4y7u\327\350\220\204?\023\316H\236\220\206\024t\007\371\006Y\242\t\370\212\030\001/Eo\244\223\242\020k\t@\227\"z\004\321\243\003\235\021\371\277\250N\252\024z{\334\241:\363&4\257\352\371\226\320\227\303\b|m\201\020\372\200\367\nt\300[\271\001g\\pgq\361\265\230A3\343\302\235\205\263\3123\227\257\345\005ME\2774tK\n"
+	.ascii	"5+4\255\033U\226\025\346\344\354\007&\273e\350\246\302v\374\241"
+	.ascii	"\220\236!<\002E\006"
+	.text
+	.section	.gnu.lto_.decls.daf0effb8d047246,"e",@progbits
+	.ascii	"(\265/\375`\017\202]&\002\312\226\353\310V LQ:\215\001\372\275"
+	.ascii	"7\335\025\320\n)P\216\243\022\1772K'\2020.M\202\206#,\226\004"
+	.ascii	"x\001\007x\364\037\353v!\351o\253\240\301 \241[Od\364\f~OU\345"
+	.ascii	"\371OM/r\263[\030\344\364\333\3657\273<j\215\210\205@j\266m\271"
+	.ascii	"\367\226[\312\024\001\013m\f\004\r\367zp\257\007Y\213\312\b3"
+	.ascii	"\315O\267\364\317\317\317\250\363\\\256\274..8?\305\322>\347"
+	.ascii	"\214S\306\305r\325%\b\363qg\214\377\307\321 \307\013\n*\n\316"
+	.ascii	"O\203\350\247T\372\356\313\223\236L\347\213\313<\332\t\343i\030"
+	.ascii	"\230\326\021\316Ok\350\025\354\243\245O\235\364\177*%\355\250"
+	.ascii	"Q\023\263L:]\250a\232V\222p~\212\244\217\352\351\333t\262@:\223"
+	.ascii	"\230\240\306 \235G:b9\312\266\340|4N\037m\323\377Yt\022\335\204"
+	.ascii	"\345pK:\211\316\2753d\315,\013\347\243f\372h\230\276S\\\032\257"
+	.ascii	"\301x\227\3713\234\367\345\216\016\226\026U\316p>\232\245\177"
+	.ascii	"\177\226\256\340"
+	.string	"\376,=zD_\345\345I\217Z\351;u{\322\013.Oz\321x\330YB1\365\230\223\263\203\212z\303Y\016\237\301qgW\323:e\214^\263y\231X./\367\016;\241*\251L\316q\027\303\332E\035\033<\035pfN(L\032kf\312\354t9kc\243\f&\223j\311\0315\315x\033\323\344\361\364\005\217q\323ab\333<\334\260\230U\315\033\233&8\037]\322?\016\323&\266LB\003g\314\266\304Q\302\252\222\302\371(\221\376\001~\3144[\243\004\203\317\260\032N\303h\370\313e\342\265\037w\301^\336\360\032&\303Z\344\224k\230\313\311\224\200\300)\347\312\342~\266`\261\273\026\225ao g\224Q\360\032\266\202\305:\030%\367v\"ao\217\t\301'e\302\222\262\244\223\237\263h\275\274=\351M^\236\364\271\212~V\352g\031\372\307Y\216\265\374w\016\217\345\220\t+\312\303\031c\3719\316\302"
+	.ascii	"\253\036Z8\237\227'\375\271\247\361\306W\216\305~\f\206\303N"
+	.ascii	"v\006\301\021v\005\347\013\346\347\370\3129\266\205\205\036\316"
+	.ascii	"?\321\350\273\274=\251\317\345I\337\254\362\345\253\263\302z"
+	.ascii	"\373\372\361\017\f\004S\301\231\342p\233\240\350\260p\306S\362"
+	.ascii	"\232\246\01348\377d\323?\200\220\213\335\265\257\253Tb\246\271"
+	.ascii	"\367\216\202\2550\223\030\035(\363c(\270\013s\341%\226\202\275"
+	.ascii	".\023G\371\261\026n\022\005;\301[\035\214\222-`\3115\357\225"
+	.ascii	"\270\033XR\376k\027\005\007\271\230\316\321r\017A\001nG\301U"
+	.ascii	"%\234\271\201\025\202O\b!\204\020\302UC3\003\215N\376e\376\f"
+	.ascii	"~\3628+4\250'8\377L\323?\3154^\336\236\364\303\345Iq\226\017"
+	.ascii	".\223\033\342\206\363O0\375\037'\301J.\023/\271\317\362\007\030"
+	.ascii	"\202\2154\323\226`%\306\032\361\345\006\326\335\336K\237\020"
+	.ascii	"B\360\341\231\235\221\245\371\307XWb\\2\312p\306Hn\226\216dq"
+	.ascii	"\302\371g\016\375\3772\361\221\345\366\271/\216 \235\341\374"
+	.ascii	"\323\206\021\\\004,JO\tgLdm\007\365!e\307\035\316?\235\364O&"
+	.ascii	"\375\023I\037\343\351\3438}\274\246/X\372\350q\301\354=\201\341"
+	.ascii	"\214{\374\327\016\353\300Twj\357\260\2757\207\235:\242/7\234"
+	.ascii	"\361\024\336q\231\030`\036{\347\242\2512r\302\371\270\213V\301"
+	.ascii	"\336\027\203\364\356\355]\f\322\273oO\212q\374\034\347\340I\233"
+	.ascii	"\242\226\373k\357\275\263\201\22522\234U,\205\301\0222\035?p"
+	.ascii	"\376\361\r<cG\251N/\t\347_(x\306\235r\303t\216\226\333I\215\262"
+	.ascii	"$6\226\364s<\343v\301ND\276\266\344\376\265r\345r\351\020-7\f"
+	.ascii	"_\024\245\030Mw%\234\200g\\\262[v.\225*\025*\027M\033\230\006"
+	.ascii	"\256\201\241p\324e\342\031\370\3518\006\226\341\203\222)\003"
+	.ascii	"F\rNN\367\355I\277vy\322c\246n\362\331\321[\"\342\206\363\261"
+	.ascii	"\023\355\305\354\242\351\020i\330\273\307\235r\357\345\177\314"
+	.ascii	"\204a`$\254\204[\340%|\204Y\340$\234\304..\023\277\300E\277["
+	.ascii	".\227\373,\367>\332{G\301F\027mM\214\246\27394\267\016.F\323"
+	.ascii	"\335\033\231{&\205\270\030Mwk\256^\007\243d\013cd\232\230\350"
+	.ascii	"\242u0J\266\220\245\326\374a\203\267\002\336\336\342n\363\314"
+	.ascii	"u\362_\273\273\333\274kQ\313\375\204B\231\030Mw^\322\356\230"
+	.ascii	"\273\026\265\004\200"
+	.string	"\\\214\246\254\275\227?\300\177\347\360\213\253\346\242\235\313#{\367\220\312 L\230'/w{/C\360\t\001mb\243\313\207O>V\322\277l\364o\032\375\343\275G\306\306\302E\233\337\275\213\335x\361\"F\3447M/\217\203\033WY\360~\363n[\22658\265)\372\227KgX\242\377[\227\346&\315\255\311\274t\277ir\312j(\271q\313P*5pbU\272\203\246\234\004\320,\371\370\225\273\\\353\221+\252%\234\177\245\364\177\317\300%\331[.\231\371\205\273u,\234\210\341|\313\340\032K\027M\234_w\261\377\353Mr\205\t\023\347_(M\302\345I\377;\306\r\313\271p\362\002\347\377\212\371u\363\225\001\342\204\207\363\rs\313\376\257'\214\261<,\234_w\333\376\257\231\353*\352\007\316\367\313U\273\314\001\334\265_0\227\355h\321r/\367^\356`+6U\242\340\234\341\366\244\370\362\244\277L\372w"
+	.string	"\351\271\267w\007\220\376\036\351\377\242\235\345*5\252\250p\376_w\231\367\354/\341\204\307\341\354\355d\357\335\001e\303*\302\304\371C\372\313\313\223\276\250\321\345\355I\337\345\362\244\027\313\315r\231\036\256\226\227p\302O\"(;9m\230\264\311\303\371@\372\327Cz\367\256\207\364#\320\037\241\377u{\322\273\240?v{\322K\345~]\346\207\013\366\353u\245|=Zn\257\275\227;B\037T\264\340|\025\364o\225o"
+	.string	"e\237\360\f\364\357\207tgooo\357~H\257u\007\267'\315\227'\375\330\345I\277v{\322\377v\375\267\311ur\271\316\344\322\324\376\332{\251Am\262\205\352\013\347\313\205\357\326]\376r\335'/\341\204\343\034m'{//W\336\273\350^\017t\356\365"
+	.string	"-#R\024%\315\307\372\313\333\223\352\313\223~p\272P\202\301\201\n\210P54F\306\202>\241N\271\312\2176\375x\002(\214\377T\301\213\037C\340\n\353G\231\376,\004]\372\363\017T)K\375h\322\217M@]\374W\310\377\021\036\270h\347\212\005\374)\335\365\371o\317\326Pj&X%_\240\t\320\226-\320\001h\033\221o4\207\344\2175p\276@[\374(\213\377ZN\274j\247\022\317\257r\3701\007\027:\347\277\331\317\220\320\243\037\247\345\031F\177\306\242"
+	.ascii	"\264\350\317Y~\224\350\317<\376L\365\243\233H=W\3441?\272\202"
+	.ascii	"\374\366\243*\270i\247\212\271\263i\364?[4\005\327\202\321P\023"
+	.ascii	"\244b\376\373A\233\377\002@O]\363\337\354g\006\270\306\377\006"
+	.ascii	"\335\017\262\211\037\203@Q\360\277\203\210\255k\360\247T.\013"
+	.ascii	"[\251\217o\211\330\301\226\363\2478N\027>@O\360\337\347\377\013"
+	.ascii	"g\013\251\323\1777|\213\351\277\033\024\200\232\340?%\220\"\235"
+	.ascii	"\020\370\371\247D\377_`\313\177\232\202\377R\340\266\200\256"
+	.ascii	"\250\373/\207\213\363_\235\377\346\377\372\376\233\376\367\346"
+	.ascii	"\277\347\177\321\377\256\377U\377\253\377\233\341\317\031\374"
+	.string	"\250\212\357=O\002Os\271\303\335M\204\007\177\352\342\277\020\270,\234i\376\253\345D#F\003\3469\316\257r\031c@\033\225\017\340\004\023\345?\321\320\024\377U;\372\253\\?\212\002\035\372Q\026~\314\323~\304=po\301\2576\031\363r\365\237FP\020py\372\253F\260\214\355\370O/\345E\200}\251NS\230\220\260?\226B\t\360\017\234\312\353\374*\020\371c%\220\353_\375\300\361\307Vg\025\006~\1775\204\207\253\277:\201\036\347\324\377\r\277\032\001\364\204\037O\225\340f?\363\300{~5\001\177n\376\330\003\250\020\352\313lH\240\0315\376h\317\217\223Hh1\350\307\347\217\022\177\354\342\304\217\016\177\354\204\232\370\321\016?Z\342\3072\200~\224E\205\217\273\334\177\325\356\232\r\224"
+	.string	"R\207\300\257\376\374\331\002?^\312.\374h\360\277\331\237_ \376\346\317f~\224\204\037\013"
+	.string	"\255"
+	.string	"\211\377L\362\343\034(\020\035\301\377\021W\355\031~T\303\217>\340\313\037\266 \303\371\001T\0047\004\377%\201\206\340?\215\374'\222\037\005\301\217\022\340\307<\037\370?\200\016\374\377\200\007\316\256-(\224\003\301\227\360\253A\177F\341\317\b\370\321\r\374W\004?\252\201?7"
+	.ascii	"\035\361\237#\370\300\237W@c\270%.\b~4\003\177\001\305\300\177"
+	.ascii	"\021'\bR&\177\336\300\217C@-\360c\001\240\025@C\334\367\253\006"
+	.ascii	"\370s\360\307\034\310\302\037m\341\377\210w\370\372\253\001\370"
+	.ascii	"3\324\217R\340G!\360\243)\374(\n?\372\363\243!\374(\007?\352"
+	.ascii	"\341G7\374\350\315\237\327\374y\356\317o\177^\373\263\331\237"
+	.ascii	"\263\374\231\371\347\345\237\261\376l\365g \177\246\3723\216"
+	.ascii	"?\017\377,\3743\007\376\374\302\237]\370\363\004\376\354\200"
+	.ascii	"?#\340\317$\374\271\303\2373\370\263\317\2377\374\371\202?[\360"
+	.ascii	"\347\233\377T\372s\372\237D\377\251\342\317\370?\217\377\331"
+	.ascii	"\346?\365\376\023\357?\323\374'\232\3774\363\237m\377\t\346?"
+	.ascii	"\325\3763\355?\275\374'\227\377\324\362\237X\376s\354?\257\374"
+	.ascii	"'\330\177~\375\347\224\377\364\372"
+	.string	"\317\256\377\334\372O\255\377T\362\237H\376S\371\237D\376\263\352?{\374'\217\377\234\372O\251\377\264\361\237Q\377\t\365\237O\377\t\343?\213\376S\005\377\211\202\377\\\361\237C\377\031\374O\341\177\216\340?E\360\237 \370\317\021\377\231\201\377\024\361\237/\374\247\013\377Y\201\377l\341?Y\370\317\025\376S\002\377\t\201\377t\300\1772\340\307\032~L\342\307\002\370/\332\217C\370/\t\376\013\364_\022\377\245\300\177A\370\357\007\377\251\200\377L\341\307m?V\373o\003~\234\366\177\353\307h?\346\372\261\362\377\210\037[\375\030\310\217{\374\230\352\307S?\326\361c\251\037\333\370q\324\217e\374\330\351\307K?V\372\261\213\037'\177\314\342\307+~<\364c\343\217\203?\376\375\330\003?\346\300\217?\370\261\006~\234\201\037\277\360\343\020?\236\300\217!\360\337\023\374x\001?6\341\307\007\3701\210\037\033\340\307\"\374x"
+	.ascii	"?\006\341\307\035~\354\341?\361\277\210\377\252\375\230\303\177"
+	.ascii	"-\377_\370\317\366\343\233\037\353\374\270\347\307<?\326?V\177"
+	.ascii	"\234\376\027\314\177\327\376\307\360\337\264\377\226\340\277"
+	.ascii	"B\377/\360\337\023\377-\361\337\340\177\030\376\333\302\177\001"
+	.ascii	"\360_\r\376\233\301\377\345\177*\377\317\376\237\260\267\267"
+	.ascii	"\267\367g\030\361\363\020\371E\320&\277Ln\352\365\313L\275\322"
+	.ascii	"&\327i\357\242\"\351\f\237$\024(\367\214\212\021\255&\007\273"
+	.ascii	"\345\362\346\341\275\367V\252L#D\232l:\335J\267\356^\002\352"
+	.ascii	"\210d|8\0070\235:\361\3650\323B\207\3639@\321\251VS\025\251$"
+	.ascii	"8\237\003\226\376S&iVT3\r\027\316KP\260\246\2635\234\317!\210"
+	.ascii	"\276svg\240\340Y\321S\273sh\363N9\207\302\351y\311\255I\217\304"
+	.ascii	"\224osh\335]\213b@\226\\\263M\332\235C\343\360\232\351>k\336"
+	.ascii	"9\324\f\033eJ#}J\243R#\251\215\324G*$E\222\306H\207\244G\322"
+	.ascii	"\253\264H\n\225*Ie\2445\322$iU\212\225\336H\211\244R\251U\252"
+	.ascii	"#\375\221R\245\312t*\315\221\342H{\244@\322\035\351\214\224\307"
+	.ascii	"e\246A\322\027Oa\244M\307\371*\357\315\212\013fZ\344\345\316"
+	.ascii	"\241enY\233|\365\377$\321,\260\324\250\313\001\322 \351R\312"
+	.ascii	"\304\245\334{\377\244IU\224?)\322\225fJd\326\366\377\244,\254"
+	.ascii	"\374\244-\320\2540\257=46_\224{/\347P2{vk\3144\335\376;\207\216"
+	.ascii	"IR:\3352\035\242\f\333\250mIyB\251\211S\246J_i\020\364\016\002"
+	.ascii	"N\340\316\344\335\2714\b*\346\226\375 \3013\313\332{\231\322"
+	.ascii	"\2502\347\242\002\371\034\220\364\331t{\322\022.O\372\rx:e\272"
+	.ascii	"e\352\325\336\01348\177C\032\375\rl\372\033\306\3647H\321\337"
+	.ascii	"\320C\177\203\222~\317\032\375\2364\375\2361\375\036)\372=L\364"
+	.ascii	"{\256\364{\204\350\367\354\320\357q\322\277`\215\376\005`\364"
+	.ascii	"/\270\242\177A\022\375\013\202\350_\200C\377\002&}\036;\215\242"
+	.ascii	"A\351.\323\007M\263s\331\214^"
+	.string	"H\341|\236\246^\301\276>\351\367\256Oz\2360\372<X\364y\262\364yj\350\363\020\351[@F\337\2020}\013\256\364-\250\241o\201\222\276\206<\375\346\355I\257\001N\377(\230\243a~\224\rm\3138\330\302LM\341\374\267\333\223\346\\\236\024M\362s\024\314\227-M.\265\2353[f\320\341|\r`\364\227S\212\255H\210\2204\024-\315\023$=p>\273\314(y_8_\303\230\356\"\243\374B\373\201\362\246D\243\220\241JP&=\324\224{\357\237PU\316.\033\323\f\235\362\377PI;\341\277vb\267L\347\334;G\031\324\253\204\023P2T\312-\273kQ\f\320\372\202fA\315\320.(\027\024\013\252\005\365\202nA\313\320\261\313D\311\320\260\243V\320+d(\330m\273kU;+=Y\241\311\332{I\001,7\273\r\371\032x\350\333t{R\013.Oz\rN\372\032\216\3643\320\351g"
+	.ascii	"\243\237\001\213~\006/\375\001\211&\241'}\206\033\372\031\224"
+	.ascii	"\364\217.Q.0\246\037,p\336\322fC\242r\340\374\035<\375\003\\"
+	.ascii	"\335\266s9\246[Dq\321\004U\20229\227\312\265\005\225\022\352"
+	.ascii	"\004\325B\237\\&\332\004\305:\232\344B9^\356}\2046A\221\3346"
+	.ascii	"5J\022\332\204C\314\027\235Q&Y:\352h\t\ngtI\206J\363Q\004\347"
+	.ascii	"\357\240\321\3371\243q.O\372\0353\375\235*\372;N\364\217\026"
+	.ascii	"9z\344G\215\240\312Sj\004;m\b\031\316x\355\366\244\005\270<)"
+	.ascii	"J\344\347h\221\354d\214\035\035\316\"\0049:\344G\205\240V9S\244"
+	.ascii	"\024\205\301\371V\335\236\264\347\362\2448\315\317\321 m\266"
+	.ascii	"\274\b\362\003\005\342c\216\221\261U\344\207\217\214C\223\361"
+	.ascii	"\2422\2023J\225\242\3314\244p\376\016\024\312c\307\317\020u-"
+	.ascii	"\361\222\343\227\211\346@u\254\311\274e\357\334{2\222\004\347"
+	.ascii	"\357\300\320?*\205J\345'_\323z\305(\251\271s\244\177\324\306"
+	.ascii	"\321\0338F\260wX\035\022/z8\347\033?Gm\244m\326(}A\035\255\361"
+	.ascii	"\2434\320\250\214\003'\312\276\362\003\347\213\001\330\317Q("
+	.ascii	"\234,OP\270\2402\216\316\370\263\362Z\3313\222f\tg4\306\317Q"
+	.ascii	"\0317G2\230Ep^a"
+	.ascii	"\034}\372\321&\324i\3351\266\264\202"
+	.string	"\363\355r{R\r.O\212\276\3709\n\003\207\356\315\213\t\316\031\240L\031G\023\031?\206\340\374\243J\250\322\323\007\035<4\t\025\"\343\212\035\232D\223y\215\tjGt\342\364\237\363~\2319\017e\201~82\207\"\245`\226\370\310\303\371:h\372?J\204\026\241F\227\211\036\345=\364\210\231\365r\233\016F\311\026\322\2005\355\320#t\377LJ\246\213\256\031BN\032/2\274\350|\235+}\235\035\231\rN\035\222\263:\234\257\263\244\257c\244\237c\247\177\231\031o\315\366%=QSu\367\274&\356\206\t\r\274\0348g\273s\315J\b\226%y.\243y\246{\246\313uw\357\275\2436\321\\\nss[\315\273\035\325\364\341\317i\236\353\316\244U\206\f)\202\363\353~\346\377z\303E\b\325\027\234\237\023\247\377{\374\247\273\250i\357\375\204.w\223\021N\372\337_\364\336\017\177\316=\357\007\377\363\336\013"
+	.string	"Zn\243\2644{\357\233F_\211\025\335\350`\243k{\037\361 \202"
+	.ascii	"\017\247#\0364\222^<\2344$\275xl\242\243\"D\032\2326\017\242"
+	.ascii	"\244\327\336\032\216\216\210V\230rJz\025m\rI\257\355\264\221"
+	.ascii	"\330\234\356^\362 \332GS[\303>\332E\333k\312\251\203\344\021"
+	.ascii	"\017\247\244W\221\223\206\244\027\017\247\355\305cg\330GEM.\216"
+	.ascii	"v\223\206\355\305cn{M9eHzM9%\275x4\2718\\\304\241\305@K\003\204"
+	.ascii	"\311uJ\036\355\027LREM\031\326\222\313\251\375\266\367\375b\261"
+	.ascii	"\233\366\332\336\037\354-5\325\364VD\343\216\031\255\2750\n+"
+	.ascii	"\232\272\313\2757\006LFTS\373h\215\350\356\265$\326\324\336X"
+	.ascii	"F&6\323\336{\233@\264\\\333A\356\032Q\017\251\275\304b\357\f"
+	.ascii	"\366ro\246\275\211\356^\333{\023\355\275\325&\251\345\33662$"
+	.ascii	"\225LL{G\3710m)\"2\026{\343\2572cNI/\252\251\037\262)^\312\335"
+	.ascii	"bIt\223KS[\271\337x"
+	.string	"4i/\242\256\275\264\367\276tZ\351\024\003M\\S\216\266\026hrqk^\016\036Up\306@M\223\314\322\"\303e1\371\355\256Ee%\236\231|\34623\\&\003\227\313\034M\205\301\244\f\032\006!\334\252$\031e\322\374\234\027\3728{:\277\235R#\330`\222a8g\267\237\3471^E\222LpF\300\235\3763\030f\006\223\333\316\344.\342\361\341H\027\233\006\250\232\274\340|\2348}\0341i\317k\177\376\222\3252\016\022V\252$q\276Y\267'\345\200\366\363\234V5D\211\030\316\033.O\232\315\020\260\333\2248\037\007-{y\2062\225s\026A\245\211q\341r$L\377Y\313\363\226?\203\345\262\241\256\255=\234q\325\355I\263\327\317\263\026_2)9d\214,cQ\221\356\232{8\343\344\355I=\270<\351\235\373y\036\323]hY\216\302\236\305\376l%_\301\261b\2474\2023V\336\236T"
+	.string	"`?\317a8\255H\221\016\234\003@%\177\345*\247\224oM\022-Kp\306_\267'%\300\345I\261\326\3173\025%ba\226Dy\236\362g\257,%\235\301\246\346\016g<u{R"
+	.ascii	"@\371y\216\262\266H\3425\341\f\302\326s\327\237\271\362\362F"
+	.ascii	"\252\212\215\016\2341\210'?\317[9We\224\274p6\200\022fV\222\233"
+	.ascii	"\370L\355'\017\232\034iSr\267w\224\b8`gsyZ\317M\376\274$g\335"
+	.ascii	"2$k\234(q\316L~\236\265\326*1\027l8\337\275\275\313\223f\330"
+	.ascii	"{_\236\3648S:'\3711\226\023*\373\310QF\307\221\214$_\225\260"
+	.ascii	"\024\004\b\316\357r{\322\233\313\223f\345\317\363\221\363d%\363"
+	.ascii	"\264p\366]\236tyA\324\222\0278\377>\271\231\b3\023\271\\>\233"
+	.ascii	"h\216\204\253\035c\"\034\207I\3779\310e\346 \331\312\327\264"
+	.ascii	"\202Q%\233\273\251I\204,$\353$\265pJ\203\363q\266\376\315\032"
+	.ascii	"\375g\037\277\314\354#\003Y\223{\3070\341\b\331V\363n75\211\220"
+	.ascii	"\177\254bpqF8\377\346\212\376\315\224\036TBi\236\224\231\332"
+	.ascii	"\221y\234Rgll\t\301\3716oO\272\201\216\237\347)\035&D8\212\340"
+	.ascii	"\354!\333x\316\361\347\033Y*"
+	.string	"\343\300UI^\314\226N\366\336;+Y^\222\0318\377\356\366\244;\227'\3155~\236m\234G\357\355e\t\202\263\316\345I3\215\254d\227\004\r\347\3378\321dy\306\231\\\232\352\302\332{g\2709\266\320\250\302\3717I\364\237edaR\242\205\363\017\300\224at0J\266\220U\345\224c\\f~\312M\371)'\345\245\033\037^\226\240\271Mr5\274\244\371\276\246\316/^\004QJ\342|\337\030}\337ZV:\316\223\244\2723\234\357\273\242\357\233\242\377\354\002\215K\222.\242\344\317\220\224\035\355\300\371\317-\200\340\240\210\340\234\215\316\266\024H\327UT6:\303(i\322dc\244\231Yd\244L\224\213\362\316G\227\231\215\376\263\315\271g\347v\342\335\265/\027\232L\356\\6:\305\254\200D+\033\235z'\236\316\321r\307\320iAt\245#\366E\006\227N>\227\267'M\341\362\244\367\355\320\367\345\320?"
+	.ascii	"\335Y\007D\256y\2569\357N\2733\3572O\274S\315\211w\2169\337\316"
+	.ascii	"\245rM\032\243'\005\357$s\312\235]M\032\254\305\032\266\377\007"
+	.ascii	"\357l\236ht\212\226\273i\005.\212he\355\275<\213D!\203\304\227"
+	.ascii	"\357{J\243&\235\211\031\202\363},\364\327<}\316\235k^\216\262"
+	.ascii	"p\376:\247\277\276\351\377g\334e\236r\347\031\257S\356,s\302"
+	.ascii	"\221\251QD\313w\003\rH\213\234\277J\321fr\272\244\221e\301\371"
+	.ascii	"k\023\375\025K\177\265\322\347\333\b6\207\265\213\231'ip\376"
+	.ascii	"\312C\177\305\241\277F\351\2571\364\327$\375\237l\037\326\270"
+	.ascii	"\031e\201Y\253\022\267\246\204\363\251\266\272\321\341\370\302"
+	.ascii	"\371+\221\376\317/iFDE6p\376\3174\264\034\032kzW8\237\371\234"
+	.ascii	"\330\232[p\276\326\323m\214N\026)\260hZ_P9i\322a5/\3239\312\260"
+	.ascii	"\217\250\276\224J^\246\263\356\315\303\214\262GT\323\211\220"
+	.ascii	"$\3469u\362h\263\321T\346\235-\316\344\251\324\326\2449\207d"
+	.ascii	"\r\363\034;\251^v\327\276&\320V\243y>9\275\234^g\330Y\3454;\263"
+	.ascii	"\234S\316\257syR9\257\234e'\331\311\345\004;\243\234[\316\256"
+	.ascii	"\323\312\271u2O-\247\330\211\345\204rr\235R\316.\227y\216\235"
+	.ascii	"\373\347\2223k\356\b^\363\034;u\f\340\\\216\351\244(8\274\020"
+	.ascii	"9\255\222\330\016\263\371\231\255\030\247\217\027M#zm\360\336"
+	.ascii	"Yd\364\344tz:g\034E\t\242\274l9|\316\245R\245\322\226\243\271"
+	.ascii	"\367>[,\235M)\260hZ[P1i&\211\303v\370\016\353E\341\3021~\234"
+	.ascii	"AR`\321\264*EYj^\235VQ\206\234V)\260hZYP\271h\356\275t\032;i"
+	.ascii	"\2348\316\245R\235b\244\243\271\367\266\303:\255\344\224cg\221"
+	.ascii	"\323\252\203Q\262\005$l\232\230n\354dr:\271kQ{;u\300$\310\217"
+	.ascii	"\250\020|\302\f\301\313\302\200\374\237M~:\371q\032\\wJ\215@"
+	.ascii	"\307\314\007\227\0278\237Z??\233\234\347\006\354\214\215\021"
+	.ascii	"\234y\232\350\234.\227'\275\306\322\327@\364\265\r}\275\244\257"
+	.ascii	"\262\321W\345\364U0\372\252\026}\365K_\325\322W"
+	.string	"\205\350_\346iuJM@\311\r38_\305\241\3773\310Y\245\213\254hQ;\253N \\FQN8_}\322W]\350\253E\372)\236~\212F\357\370N\332\0173H8?-\243\237~\321O\261\350\247Q\364\211\343/\341\204Sj\004\233\203\212#\243=\234O\033\347\215\237Rg\215}J\2310\265w\321)\265\243\267w\321N\276\244\001\316\252\242 C|G>\026y\315'0,%D\322|H\271\215\312\232!Rp^\367|Fl\350\\\204\301\241R&\317\r\347\337W\344#\242\242\203\r\035\006i\215!;\256\370v&\203\301\372%%\214\r\347\225\315\332\346\377\312aH\033*mr\035\256\023\262\026\207$\214\033\325\221\026\272\257vt\353\032\254\265<\367V.\215\332\310\006\220\267d\006\357n'\263>\250kI]\324\356\276\256\301yj\230I\352\276\252\371W\234\270\260!Fp~"
+	.string	"\260\364\232&"
+	.string	"F\312\224Y\347|\246\210\324\3504-\225\321\272\333\301\213s\222\324\374:\207\335\356|\344\341\274\312e\265FQ\020\242\270\377\253/I\017+,\234W3+\334e\276l=\263wv\270\324\351\030\303\371\001 \322*\312Ruooo\017"
+	.string	"hV\266\365-#\255]\3151H\306|}\373Y\231\255!<p^\335.\207\306*\f\032\316\253\230\237\321\251iI\342\274\206\371\331\215\231\021+\275UX\224\305G\352\205\310(\t\030\264\257_\320\326\265\034\032\320Xr\303\272\333\311\250\017\252\027^\322nU\373\272vZ\221Y!\333Z\323\272\312\276z)[\315|\246\210\346N\270\261\324\246\344n'\245>\340\270iU9\262\232i\371\221\024K\303y\345\362\265\313\277b\262;\033Sp>"
+	.string	"|\350u\313\372\324\302\310\030\316?aP!\215\311\b\013[\263d\220\341\263\215\316n\\:1pTd_\263|\305R\302\tX\017\347\306\021[\226Ul\035[\321@\251\032\223k\336a\335\225\301y\275b\205\t\n\224\225y\352\341l\242\fK#3[J\235.2X|y}e~\255\242R-\237\350\341\274~\255Z\350\020)=$*9_0\256(\341\274NY\225@y\205i\203\363*e\315*Z\n\342\205\363A\260\251\n\213\201\363\032e-\262\266\343\016\t\347\2576v\f1\362\204\363\001\200\244D\311\272\314-\356\362\207\t\030Vb\302\315X\362u\371\225\253\204\023^\226V\325\004\207\363\372d\335\322\3141ZWp^\235\374\353}b\003\f\t\347\203\320F\257Z\253\222\036y]v\340\27421"
+	.ascii	"\016\274\035z8\177\315\252b#\222\004g|_\226\036e\312qbd\214\035"
+	.ascii	"\021\"+\226\216\324K\223%N\356\316\2740yW\256\276b\351\255g6"
+	.ascii	"\236\244\341\274\036Y\221@\025%\335\360\343v\256\340\260l\341"
+	.ascii	"\274*\261\236\334X\223#\234W#X\357\314W\021\251\"j`\236\362n"
+	.ascii	"\310\214\210\231\231\013\022d\265J\223*\322,\261j\256M1d\354"
+	.ascii	"U\310W\253\2758=\2552>|\254@\322\344\212\036Kr4}<\244\276\274"
+	.ascii	"\370\361\025\b\232\n\264$$ \204Yu\254:V\252\237G;\207TJwc-r;"
+	.ascii	"J\362\370J\225\2470\317\342p^w\2542t\\E\325\341\274N\035\r3\321"
+	.ascii	"\222z\200\360E\233\371Z\303\314\212\343&\023\340\224\323\302"
+	.ascii	"\300=I}]e\270\2111\362\201\363zc\265\301T3Cc\303\207\022\263"
+	.ascii	"\"(\023\016\337\233\215\026v8k\2715J\277\250\002\243\206\263"
+	.ascii	"n\2564\270\242\350\231\341<\367\365in\205\322{GM\021\315\221"
+	.ascii	"\220f\265\304\311\235\323\222\032\332:\343+T\331\232\036\036"
+	.ascii	"\020\234_\267\312\230b\322[e\2541P\262\036Ja\316\270,q\260\301"
+	.ascii	"y}\261:\371\242\214\241\341\302y\205\2616\351\3401\231\341%\226"
+	.ascii	"\2642\005\tbe\017\347Ui]\322\3111E\2049ee\261\272\020\352\271"
+	.ascii	"E\301ym\261&qW\026$j\264\326\242\025\t\307\216k\256\n\316\253"
+	.ascii	"\321z\264r\0255\265\256\332\254D;a\224\214\301\341\254\367\326"
+	.ascii	"\255\324C\214\t\316\007\301J\347i6\252\027,#\0268k=m\306\214"
+	.ascii	"\016+I\234\3554\336e\303\345l\b\316\372N\257\271_\312\026Uv\250"
+	.ascii	"\331\021\222l\233\302\371:\215\256\373\3274-\f\322\306\371 D"
+	.ascii	"i\215F\323\245@\300\324\2205\035\004\027\372\006\200\002\345"
+	.ascii	"\344\204\263>s\035\367\2577Q\300\212h\340|\020\266\3765\334\277"
+	.ascii	"\346(a\262\331\340\374\017\326\350\177@\347v7M\346B\3310R\031"
+	.ascii	"KJ\320p\270\360\330\236\350\267k2\227\253N\312\332\226\036\363"
+	.ascii	"\201\024/\327i^t\230t-\031\365ag\312\253\005X\333u\230\277\204"
+	.ascii	"\023<\370\240\266L\021\301Y\253i\266\034.\275\253\032l\032\314"
+	.ascii	"\211\345V\307B\257Mi\340\313A\303\312R\353/\036\320\250\030\\"
+	.ascii	"p\350\263k\264\177]\261\344\360\301\003\347\177\220\245\177m"
+	.ascii	"\366\257*\323\355\206\022\347\177p\245\377\201\216\2611\315%"
+	.ascii	"\210\323U\324\315:\223\021\267\345\232KY\246\321\245\311\205"
+	.ascii	"\263\306\242\313\310\236\b!*\323Z\272 \301\340\221\177\250jc"
+	.ascii	"=\252\350,\232\354r9a]URz\347\027\2526#\234\377\001\215+W\356"
+	.ascii	"\231\317\324i\346\b]sG\t\356\313\027\234\377A\022\225/\035\226"
+	.ascii	"\225\3666\"ai\364\266w\324\207\rX\356\240T\271\016\273\006+\341"
+	.ascii	"\204\227A\240\r\024-\346\277\342*iuOp\376\007E\372u(\323\222"
+	.ascii	"<%7\234\357\001\235\276\007q\313\245\226Bu\343b\317\252\315\353"
+	.ascii	"ZJJ\305\306\225\205\263\216\202\307\240=\350\270\024\301YC\351"
+	.ascii	"jc\302Do\371L\235c\350\254\260|0XL\375xr\275\345\226\327F\r\316"
+	.ascii	"\332\t6c7g\347\004g\335\344\364\232\221\206\003g\255\265v\251"
+	.ascii	"\325h\202\363\3530\2252\315\020\"\234\357\001\027$H\364\022\237"
+	.ascii	")\"5\251\226%+=\271\245\2613J\256\227\234]\251\253\303Y'\271"
+	.ascii	"X\026\031\036lp\326X\027C\273|\220\261\341\254\257v\256t\275"
+	.ascii	"Yy`\245\177\235C\347\320\312\017\313Mtc\246KJ\004\235,7\254\272"
+	.ascii	"\030\311o2\230\350@\317\344M\331\341\254\213\\\023\301\231\312"
+	.ascii	"\221\004\311\f\347!QIqw8\337\203\033\372W\f[5Q\372x\322\324?"
+	.ascii	"\264\016\315#\212\223\246\376\201\225\030+\005\026MkR\024&M\375"
+	.ascii	"CS\241Y\035\214\366\316\201#M\263\004\244\315\235\026\242\203"
+	.ascii	"h+\rDW]\246\376\241{\254gT`\352p\362;\270\323\357\340M\277\203"
+	.ascii	"0z\007f\342\244\310\031\316\357 \213\236z\007_\372\035hII]\271"
+	.ascii	"\013e\303\270T5b4\335\355\035\365!UBf\n\006\316\357\300\207\266"
+	.ascii	"aC\235\3413u\266\301\210\372\220C\307\204\007\231\030QQ\247\224"
+	.ascii	"\017\003\256\\(\251\034\245\371\201\363;P\322\277\206\322P\247"
+	.ascii	"\324]n\030\351\221\246(\021n^\270m\243<\0312\356\231\020\273"
+	.ascii	"\037Gp\232I3\351'\006$\221R\2421\266h\031\242\235\256\237\224"
+	.ascii	"8)\2238\277N7\375_\325'T\264x\350&\r#*\314\030\222%;+\313\226"
+	.ascii	"\244\351\027\351\013\234\251\2674o8\237\0035\235\324I\255\324"
+	.ascii	"%\tS3\247\207\032\2604\235t\255\224\216\251\353\242\302Y\273"
+	.ascii	"\300[7I\330pU\241kLH\240\304\300\371\034`\321\372H\037i\026\317"
+	.ascii	"\260\237\220\3450\227\232\2304\3225\213$\035\365v\347#G\301}"
+	.ascii	"=y\301\371\034@\321"
+	.string	"z\353\255\213\236a\333Hu\034Q\267\264\231B\322D\327Emj\022\333\222\006\007X\372W\333\250mp\0174\271\213\220x0G\304\201\020\255\352\251z\027\356\356=\303i\253y\247\265\214!\202\201\3639\220R\243F\305CC"
+	.ascii	"\272.\251\017(S\312I\nO]\303\223\364B\206\272F\275\253\033C\344"
+	.ascii	"\fO\3319[\240bt\251v\034\300\320\277\232FM\203\277,hz\201I\217"
+	.ascii	"\203\344\2313*\0321\245\246\032(]IsW\321\304\321\310\243\302"
+	.ascii	"\2416\351\214\226T5U9,4d\206l\345D\201\261\246E\034\212\325f"
+	.ascii	"&\346\013\347o\220\247U1\252\030\325L\003\210\2105e0\221\326"
+	.ascii	"\312\\5S\266\244\t\204\ng\225\214:\346\024\263\205\254\005\316"
+	.ascii	"\352\233:\306\311\0132a\3241j\216\354\254\3241\252\033\0063\314"
+	.ascii	"$Q\335r\023\312\324\021FC\256\255MM;\243\245\334\361\302\354"
+	.ascii	"\005\316\337\200\f\0300jZ\031\230\255fV\222\331\335\036\316\337"
+	.ascii	"\200\213\232\232\232\226\305\247\344\344K\b\316\337`yv\246\246"
+	.ascii	"E5\300JR\023\335bDC\n\332\325\2646.\267\267\r\222x\361\242r1"
+	.ascii	"\323F\231\023\027\003J\r\316\337\240\310\226-*\027\274u\215\231"
+	.ascii	"&K\\\316\2652K\326\214\340\374\r\200h\371\242\234\302B\246\326"
+	.ascii	"\26416\226\326\334QQ\037pXHU\001\303\371\0338Y\271\222>\311;"
+	.ascii	"*\303>\002c*\227\3647@\322\314**\230\025\330\006D\372\036\362"
+	.ascii	"\364\327\227\252\274L\234\266\232Yi\232\230F8\337\003\032u\212"
+	.ascii	":EU\022 \311\016\2350\026d\316p\276\2070\372*\224\253z\251^'"
+	.ascii	";\223\033\211\214\001G\216x@\323'\273\370h\357\"\020P\")=\240"
+	.ascii	",\325%jW~\272;\251i\025C\n\322\334MM\"\334\203\026}\017L}\265"
+	.ascii	"\311U\237l\235\354n\026M\033\230bt4=4\321\367 Dc\020t\2104\311"
+	.ascii	"1\004\347\253K\256\312D]\242j\245O\356f\321\264*\371\250jz\220"
+	.ascii	"\322\367\260\244\177\323')\026\226\252D\357,\351\0164A\270$\271"
+	.ascii	"\252\344L\223\313\272\303\371ul|\330-q\276\207\215\004\211\252"
+	.ascii	"\274\352\302V\300T\305\300\371\035\320\250FT#\252r\n\330\213"
+	.ascii	"\246\006\223a\024E\231>\t\003&\306\214\030!BT\"m\224;*\352C\306"
+	.ascii	"a\324\004\033r\225H\316\262\305\212\f\234U+\0355u\315 /\3133"
+	.ascii	"\310\232\244\225\375\370\241V\255Q\3464\311@\242\003\310\325"
+	.ascii	"\252\033.R`@\251\032\3434\244\t\316\357PE\355\241\366 \023\247"
+	.ascii	"\334QR\037\260\232\024\234\023\316\357\260\305\203\307=\2738"
+	.ascii	"vl5\263\272\264\001\203\005+G\016u\352\206\323V3kGe}\270kV\262"
+	.ascii	"\020\321quj'\214li\206\363\353\320\036\377\327\020\374HB\206"
+	.ascii	"\363;HII\3353\2751\250q$\353\203\017L\t\343\005\316\357\320\244"
+	.ascii	"\177\325\306e\2526\316\265\274\334N\251X\027\021\316<\263\037"
+	.ascii	"Zp~\207\035\025u\317\364\276ND[\315\254 IP\210\352d\310P\241"
+	.ascii	"4\221O\02207`xP[\232L\2215\257\316`{\"\263q\276\006bT'\325I}"
+	.ascii	"\322\027\\\255b.zP\251Oe9I\231'Gp\276\006^\324#uI=Ra\250/\256"
+	.ascii	"\3028\263\244\224bpV\231T$\025IU\312\221r\035\361\301I\201\313"
+	.ascii	"S[\\UR\223f0\273\242pV]\244Q6\252\354p\276\006ajRe\221\243\212"
+	.ascii	"\\\3358\303\371u\351\027\030zx8_\003-}\rvhu\253E\352V\211T\242"
+	.ascii	"&D;e>\242@\341|\r\240\36458\322\177\332\246\315\231\346\003e"
+	.ascii	"?i\340\306\022'Y{w\021\301\347\245F\21468?\2031\372)\336M\365"
+	.ascii	"\364\316\264\237\275{\344H\217\220-Ex\006_\364\357\231\226\332"
+	.ascii	"\245k\354\356\356\324\244G\346r\230\302\300\302\220\351g\360"
+	.ascii	"\304-\245sK\353\322<\255[\233t}}\245c>&E\363\fE{\033\355\235"
+	.ascii	"\243*\255qk(\305\024I\343\236\242I\347\232(qS\316\245M6%\227"
+	.ascii	"\223T\353\312H\030\251T\016?\235\325qi\341\234\226I\317\234S"
+	.ascii	"\324\360\222gR8-X\262\214\316tp\314]q\245f\3200\030\312\033w"
+	.ascii	"8\247dn\233\332\224\26708\247o\272\315\213\032G\\\377W\234\244"
+	.ascii	"\247,9p~\006D\3643\200bK\303\260\335\263t\357\273\234\202\321"
+	.ascii	"\264\243\232>\264\265\335\263\273\233N\330\303`O\037\0030kk\330"
+	.ascii	"\f\225,7U\3113/\234\217A\231\376\323/\351\027<\306\007\312~\322"
+	.ascii	"\001bd\205u\267w\027\021t\216\354\276t\340|\ft\350tK\272%E3a"
+	.ascii	"\211Sz\366\024\255\212-\314\022\316)\227\324\354\377\352{k\341"
+	.ascii	"\006\205\363\237\232\245^l\364X\373\201\331|\3248(k\244\340\234"
+	.ascii	"v![\262tf\005\347c\340\244\377T\313\217\177` \227\231j\301_\001"
+	.ascii	"P;\322\024%\202Z\306\212F\023\234\217A\022\026,7M\013{o\242\345"
+	.ascii	"\206\321\303\206,\352\203\272\244#\211\005\347\373\334\215\215"
+	.ascii	"\3353\275\367&\312\260\215\344\336\224fW\256\\\267\273w\336\221"
+	.ascii	"*\372O\303\3220\334\343C\206}tfO\311\245\377\224y\231)\023S}"
+	.ascii	"\330EE\036\31495m\021\356\223\344\353\353\302\335\335t\302\032"
+	.ascii	"0@t:%\235r\345~\354\346|h\3507\001\002i\242\005\006\215\220A"
+	.ascii	"q\b<\256B,K\\\177~\354\321\330\"3\b\031\333\030\212C#\tpP\004"
+	.ascii	"\331\f\b\t\207\324\233\270\240\375\t\207+\0334l[\266\304\357"
+	.ascii	"D\320H\f\n\205\021\270\t\020\034\330\026\310\036\2037\001\202"
+	.ascii	"\304\220(,\036\207Z\366h,\352v\250\202\3157\001\342\330\376\200"
+	.ascii	"-\221]\341\004\0228\202%\016\tY\023A${\324\311p"
+	.string	"\023 J\024\207\307\026\271\341\330\266\310\2421\210\006\215\304\237\261x<\262\277_\006 \265\005\006\035\215@)P[\034\036\205R!\220=\002\241\302\3420\005{L\211D\266\005BO\260,\022\b\r\002\262\307\026\031\304\006\375\212\254\220Q'\210\r\002\322\354\360\204\321\030\274)\262BF!Pj\002\n\252\t(\254\2540\004\315\022\207@BA\255\312\"\215\304 P\312\026\207\304\342\320X\324A#\221\b\fJ\213\254\220\021\b\275\t\020#\004;\b\221!\330\343P\013d\2012\b\207F\0249\205\361h\2425\026U  K\314??\266D\021h\"\250\202\375\005\207A\306\026\370\373\361\b\213l\fB\302!\2658\224\001\034\"q\250X4\026Ud;$\364+\016[\342p\210\304\357\247\203l\207\204r\313\306\320\2621\f\005\rGhM\224\030\022\201|Z\340\020\006X\341P;l\333\b\264l\fCAC\013\332\233"
+	.string	"\221\"\177;%\200\355\311\3764\220\001Y\002Hd\201-\001D\016\371\330#0\205\360\bl!\207H\034z!\350\002\"q\350\205\023A`\213d\177*k\202a\f\277\023A`\033\303\2578\274\300\017Y\034\212\320\021\026\207\022\300\201!\204\b\n\300\020\002\207-\001\024\301\"\201\307\t\354\264,\005\202B`NP\n\021\253\021\305\221\215\241e)\020\224B\b\007\231\266\303b\b\034\022C\310\037\021\210\202\r\032\2667\250\006\244\260h\f\262\027X\001$\262\302\rB,K\364\245)\t?:\227"
+	.string	"\242E\002\211i;d<\017"
+	.string	"\242\0352\242zH$\016\203r\330\026\230\201\240!RUM"
+	.string	"\201\\uN"
+	.ascii	"\221"
+	.string	"!\007\005\020l\320\260m\221@\342\016\333\036\203\303\240\034\"\220=\376L@\001i,\002\2138,\260-08\024\026\207;7\276vX\fq\224\200q\004\207\226E\262\031\2709\0214\022U`\217F\025b\330i\207\305\020Al\213\\\201\364\t\213,rg\205\020\"\212C\340\005N\004\215\304\033\344P\013lc\320 <\0329\020\004<\2260\036E\370\234\b\032]\360\271\240\341&@\030\207\302\026\331s<\262\302\026\231\nY\3208'\202FbQ\003\277\026b\210\200\013,\360\354\264\303b\210\r\033H"
+	.string	"\321\036\201B 4\340\201\00277\001\202=\001\004\372\031\217+J\004\203\300\020\"\300\236"
+	.string	"\002\371\220G#\262\310\346\244!\202R\bi \022#p4\262\200\214!(\205\220\207\266\030\"CP\n\021\310\225%\n\207k;<r (\205PNP\n\241\035\035\344\nA)\2042\\\020d<\262`T!(\205\320\206\366g\002\n7\001B\305\221\347XD\376T\034\177,r\350\007\204<\006wT\034}B\300\240\340\021=\262\302!\n\343QH\310\2528\022\201\303#\213\324\240\202%\n\r\255"
+	.string	"D\004\232\360\261\302\341\361\310\2420\376\212\303\016~%\206\210B>\032Z\026\311\036\205\305!\211_\013D\376\202\206\216\355\tV\b\251\001\016K\004\006}\303\340Q8\fB\213\303 }\"\310\232\b\252"
+	.string	"\006\351\035$\021\210\202h\024:\262m1D\360\310\001\311\262\307\022\354\n,\261D1\002A@\025P\b\001Y $\032M \331\243\211\021l\013D1l\203\021`\205\306\013\034\207@\237\3420\310\"\207~*\200A?\025\307\233\237\212!\340O\0050h\007y4\036\217lOz\303\n\255h5`"
+	.ascii	"\004dl\207\202\033 \207*\200\277\022C$Xa;$T\034r`\205V\264?\026"
+	.ascii	"\305\260\005\242\030\036Ya\207\243\261\r\002\201~\306v"
+	.string	"\b\370+Q\034\232h\215\306 \344/x\364\021\032\207GV\350\007$D\374\261A\300#\320/xD\376\206H\344\021\003\341\360\327\016\213C9%\020U\034\221;-\022\b\364\023\016\001I\374\220C$\220:\255q\350k3\224\020\332pd\203\206#\204\354\006\234\fE\343\020ydQ\024C\004\245\020\241!(\205\b!\033,\256@\0265\300\"\207tZ\344qH\002,r(g\305\261e\203X\";B\003\321\0304\266\306\243\210\366h\024B\026\201\307\021\033J\024\201$\332\241\004Z\243\t\344\n,rh\247m\177*\262\004p\204q\230\"\177%\206@E\243\n(\330\025\220\304!\021G\266-\262*d`[`\006\202R\210`\177\254\320x\001\3668D\034\002\201r\330\037+\264bD\213d\207J\300f\340\310\n\201Fbk4\222\340\320\236\020\021$\004J\217\300\026\351;Q\034\272\260\006\tY(\032o\332\233"
+	.string	"!d4\022A"
+	.string	"\266@aF\3764\034[\021*\b\031\215.\264E\026\005{\301\211 \220\004\221\b\fj6x\0342\306\300\266\300\026y3\3028\324\017\016\217l\221-\241o\002\n\006@!\005\025\352SP"
+	.string	"\t\n !}\n\n\370\371Q"
+	.ascii	"\n?\372(\374\2347\001\242\204b\211!\021\370\373\265@\035\326"
+	.ascii	"\004C\344\357\227\266&Z\241\365\310\2368\0329`\034j\366'\fq\002"
+	.ascii	"\tl\265\220\321\350Bq\b\f\332\271\t\020-\322(\364+\032\203\202"
+	.ascii	"\214A`\013\\!\310x\024bY\237\220Ma$\022# \302\002#\212#\213\304"
+	.ascii	"iO\210\bJ!\224>\330\376N\024\207.\b\t\207\326\023\305\241\013"
+	.ascii	"A)\204\324\366wl\205\332\342phe\211$\206\214\302\364&@, \310"
+	.ascii	"\n!\333\037\0334l\177?\035d\221?\024m\332\376J\024\215D\344\217"
+	.ascii	"H\004\006\221+\220\277\237\206 \213,\376P\264\352M\2008Q\034"
+	.ascii	"\022\205\204C\036\b\201\360\020\211\213\303\337Q(\004\236\b\032"
+	.ascii	"\2217\355\017\210\274YA\034\006\001\201~\305!\322\327\376\326"
+	.ascii	"\366h\024\272\t\020\305\341\b-[\034\266l1\003\265\375\255\310"
+	.ascii	"\364(\024\002\215G\326\004\277\342\020\251Q\004\331cn\217F\241"
+	.ascii	"|\024\n\201\371\310\2428\2621 \207\272\375\225p\200\t\270\020"
+	.ascii	"\202\205|\023 \332\340\320\261E\216\200d\205V\264# \333!\211"
+	.ascii	"\021\206\212%\f\240b\2508$\032\300\004\024~(\244\240b\004V8D"
+	.ascii	"\f\026\207#\034\221C# \240\004!\213\034*\016\375tzl\205p\204"
+	.ascii	"@\366\250sl\205\204E\366\207#,\262?\240!\022,\022H\"\207E\002"
+	.ascii	"I\374\204\206N\004\201$~0\204\370\355\b\213\354\217E\001D\376"
+	.ascii	"`\b\361\303A\036\331\023G`\320O\027\207@\023\301_j,\262\304!"
+	.ascii	"\320O-\001Y\002H\004\372\251\355O\025\022\215\277\233b\320\020"
+	.ascii	"\321\030\374\035\207\202\277\033\226H\002\330\242\370\351\034"
+	.ascii	"\201&\202\031h\210D{4\232@\376\326\366\007C\210\237\357D\320"
+	.ascii	"H\374\241\355\317\004\024\200\200\214\277\337j\374\2510\204\370"
+	.ascii	"\335\264(\202\254\320\030\374i\030B\374r\200-P\370c\205\303\024"
+	.ascii	"?\337\004\\\b\301\302\017\206\020?\335\"\207\304\034\240!\022"
+	.ascii	"?${d\331#\320\017\247\375\261&\030\"\323\023\204@\241\337/e\205"
+	.ascii	"\306\240\037*dY!\344\357\306x\\QbE\376P\260+\004\203@\335\262"
+	.ascii	"'\202@\241_\220\020\310w\023C\244"
+	.string	"Q\bG(\b\330\"\331\240a\273\256\020:\376\216@\342P\211\"\3607\0244\3641\301\n\025G\226\310\006\203\300\337\021\310\026\207\304\337P\320P\203\0268T\202_\3218l\201m\221\035\036\215\277\241\240\341\005&X\241\342\267\242\035\006\215D\026\005N\373k\217F\0210\004\245\020\332i\1770\204\310\306!n\177*\034\331\240a\253s\023 \332!\241v\310\370\013J!\324\001\020\273\002+\264b\304\357\002!F\334\004\r\333\263\375e@\005\025\202\206\255>\006\203'\221-\026\201&\202*K\004\006c\360\265,\022\b\b\006\026I\034\022\272Ia$\002\035Y\0240\260\301\243\021(GE\376\330\340\020\005\273\302M\200\030\001ydQ\f\217B\rn\024b\217#\264F\343q\204\233b\n\243\260\0352\201\324\310\337\210\r\344\264\303b\210\026i\024\322\306\021D`\361\310\266*&`\034\321\036Y\024EcpC\312\022I"
+	.string	"\221C\241*\274"
+	.ascii	"r\250\323\036\201m\f7h\373C\341\247-\016\207t[\f\301\266\303"
+	.ascii	"c\n\315\266,Q(\310\250\002\333\002\205BC:,\221\004p\004\212\264"
+	.ascii	"\375\245\320\026\207Cj[\0342\006Q!k\202!\0218l\207\305\341\215"
+	.ascii	"\220U\333_\253\377\363\243B\007\032x\201\002:\b\302\205\021!"
+	.ascii	"b\030\241eK\034\201\355\b\305!0h\204\340\0219\002\b\016\220\027"
+	.ascii	"`\203\206#X\"\t`q\002Gck\f\322@4\032%\360C\377\337\310X\327f"
+	.ascii	"P1\355\233\030Y\354B\025i\323q\363\224\2319\254\310\227\334\215"
+	.ascii	"S\236\262\223\345\243K\311M\323\312\304\n\313\313\272\201\221"
+	.ascii	"\273n\246\214\210\214\271y\201uCF\017J\362\206i\265\332q\202"
+	.ascii	"\027\346\314\315\322\n\3442\311\351 \272Q\312I\360\222\256\036"
+	.ascii	",n\222V\034?\246\200-]\344-8EU\276\260I\2520z|0\271j\201\333"
+	.ascii	"\322\226\214Xd\254.\0301\260\220\320/yjJ\307\230#(\034/oEL\214"
+	.ascii	"r\223\233\243,G4\212\326U\313\327\022\275\033\"\252\034\204K"
+	.ascii	"\323\231\233\235\263\244K"
+	.ascii	"paH{\353[\226\224\017.m\322:U\212I[\0276\232\314\316\333\224"
+	.ascii	"\217%=L\345\343\310\225&yi\223\"7\274\340a*n1\366\230kT\037\233"
+	.ascii	"\"_\356\356\3244/\2705l\226:Qc\332\314\251Y\315t\031:0\243:\037"
+	.ascii	"\025,d\352\007\2304\350\021\234*WG\320\350\320!:Y4\312\276\320"
+	.ascii	"\370\224\240g3\3308\315\255s;PnG\344\232Jk\214!U\260\310\241"
+	.ascii	",p\330,1\242\213\363A\241B"
+	.string	"\336\310\2609\203&\3310\303\005\313g\346>\270L\206(\211\306W\006}B\222\333\323\"\263.w\230\023\251!o\350\f\244&4\2441>\034f\264\210\345MuH\255\306\264\2248\3772}b\32659F\250\350P\013\243\303r\226R[\260\264\371\216\354\330I\301\002\204\r\325\221G\306|\363\201Q\342\244\246\312jm\271uX\274\335\201QK\321\352\300\340\225}I\237 \335\220\233\363\245\251J\035K-\330\320|B\244\206T\355\300\331\347\345\\\301\336\336\336\236\336\336E>/\330w\3463\273\317\313w\324\267\254dQ\232\227;\251\033\325\033\031.z\211\226\225\036>p\316P8SlL\266\210\225\351-,Gt \361i\321R\260D\311\031\3019C\341L\201\301A\025\301\331g\305g\305Gv\013\212\254|xKx[\356\033\273\217\fe\001\227\206\rg\237\330\313t^\025\25608\373\256\274L=\373B\245c"
+	.string	".\364\357\013\313VK\326\250E\201e +\b\203\322\306\324\\\354\330\312\244|U\302\360\270\213\202\2073\224\337\007\305G\305\002\272%:\264\024\354H\232M\271\217J\231j\304\b\n\f\316\276(>)*\325\017\0266|R|^;\200\340\335\320M\350\254\332\b`\317\247u\237\023\237\226o\231\326\245X\260\226h\\\367-\343J\240D\307\306\331\267\345{\342k\"\2008_\226/\353\236\201u\3215\325.B\232VkW\277\357\312\247\304nI\016\352\016\217\201\203\221%\311}JB\374H\036\341\354\303\312m7^b\316\342p~\035\272cH\013%K8_"
+	.ascii	"Y|C|C|G\210\256\242\236p\234%}\312\373\216\2241\275\340\212\201"
+	.ascii	"\263\317\210.\303\331O-\230p\366\025\371\031+0''\234}D\260^\227"
+	.ascii	"4/\001\200\371v\334G\345\333\341\023\302\343\264D\207\246],\317"
+	.ascii	"\234\200\334"
+	.string	"'\344\276 8pqj\326\252t\026\262+1\276\036\276\037\371\314\f\357\312\347C\223I\255\361\202\363\0050D\373x\344\320\241\343\312\371L\235d\346\350\232Yc\332\330=i\212\212\362\341\360\231:\307\314]Ee\351&\244,aR\367\341\370S\304\0259\303\331wC\227a\331\322:\302\331g\003eJ\223\244\336\236p\366\325x\031\231\0208\001$}L>&\037\324\265\"\242k\336\345(=\364\246|3\356\203\302\321r\005U\207\263\317\311'C\251\307W\233O\206/\206\230\253<:\024I\314\306S\362=\345=\2573\272+\234}M/k\263A\206\263\017\306\271\226\341\270\234\271\303\331\367\"\267\341\021&o*/\357\253^\236OI'\311\222\034\324\035\027\227\017\265\026\367)\335\227T\302\t/\203\322Q\244\013\347\373\\\354\360(\222a\206s\211N\250$c\316\025F\013\315\222P(\325\223\034\250\034SL\021q\013"
+	.string	"3\026"
+	.string	"@@D \023\251\252\260\275\001\024"
+	.string	"\024e\316\222Z\240\220\206(K\032\306\020"
+	.string	"H"
+	.string	""
+	.string	""
+	.string	" "
+	.string	"\032"
+	.string	"d%A\302\355\031\236\352\310\035RLe\2021\001\245X\246[Kp\351b\023\302\030\026\202\373/\2467\242C\320\205\324\276a\2213\266\355}\250A\316\361\204\255\315\266b\217\241\021\306\to\341\036\004\336\\\r\265\264\364\300d\303\355\203y\230\341\241\276\351!\016m\264\250\360Cbk\354\bf\313\233v\2647U\334\020\033Yq\204|-\300\224]p\027\333\212\032\365\030\261\357\241k\367\357H\330\t"
+	.string	"\360\027\377;\300_\313\017\001N\256#\255}\260\377\215\331\t\303\027ulA\234\004\013kBO\t{\302\233-v[@\370\223U3u\323\210\271\265\252\210Z\200\r\266\344\273\024\325 \234`;\260\252\326\214\245\346\244BK\333\236F\002\341%z\212\360X\346\274\313:\342\313d\325\355\251i\322\312\335\216>\3347J,\225ln\314\274B\346\2747"
+	.string	"6}\226\204uD\263V"
+	.ascii	"\312{D\235\331\310\335\226\177\320\036\353\355\206S\224jhQZ\021"
+	.ascii	"\266I\016\252\177\004\342\367\233\215\024\002\225#\261\350vm"
+	.ascii	"\2264\256-\2148\240!9\376L\351\020\253\365\304\202\302\377\354"
+	.ascii	"B\325V\353\"\240%\243\321\310K\024\241\031\202\020\022\213\351"
+	.ascii	"\341Q,&l4C\355\230\316\325#|\221N\256\2003d\243M\322\22607\277"
+	.ascii	"\005\272\346\224J\205\356<}%\n\222\201^*\243\315}\205$\376'&"
+	.ascii	"\333\313\241\003l\031\245\324\017\222\261\201n\246\346\013u\027"
+	.ascii	"x\235\254\274 \244:$0\215\277\367\225I\264a8\"c\304j\253\327"
+	.ascii	"y\277\\\375u\205\224\347\320\t\030\276-\322\003 \363]\313]\375"
+	.ascii	"nd\242a-\317\035y9\337O(\226&\264\371\221\272](\235{\331\024"
+	.ascii	"Bx%\333(\377$A(\002\003\223\242\323\376\202\030\006\212}\261"
+	.ascii	"\f\322\351V\365\367\264\222\333\030\372H\206r\317\217\036G\204"
+	.ascii	"\354\305\013\202V\374\243\261\332A\255\305\230ks\361P?I\nH\215"
+	.ascii	"\313\022\203>\021I@\307\277\026%k"
+	.string	"\204\033\003E4a\353\260\364\3360\344cf88\317+\202@0\275\207\333chk5\031\343\037\240\007\031\031\232\246\026\374D&\231\222!\336\277\3773\323y\3215\035-K\273\237\220\266{\375\266\361\037\203&5\354j\331\356\026\214\234\346\202\234\277i\023{\2032b\337\200&.:A\213\024\255:\234u\b!\377\007\020\216e.r-\016I\220~\256\223g*\260\232\001t\201D?\302\"g\305\3655\034V\337<5\031\200d\035\002\240\346WB\022Tc\305\247!V\230\r\237\206\303H\247\275\002\225|\224r\204(\244\n\0221\243\235\322\201\370_\273\224\200D\257'v\363\26499}\323T\013=\225\345\356\362\373\226\336\300\177\025\320\223\345K\267\236\363\225\204,O\2179\227\365\t\340-u\305b\303\203\206\323\236N\350\313L\362\304\205\244\313 t\313[d:\227[\326\232\306V~\001\306\031m\247@\002\372\204"
+	.string	"A\346F`\276\315G\005\3746mu\267\330z(R?\302\332\321OS\365`\231|\334\271\256Z\264mR\267\001\371\326\206\337\262\224X\030-\367\215B\016\021\365l<\231\205\253\374\254lD\274E\370\r\003\".\263\217p\n\030"
+	.ascii	"\365X/\267\330\372\"sm\340\211\330\002a\017\264\354\353\311!"
+	.ascii	"\022\252\321\263\313NL\336\215+\362\310&\335\350/\256\030\037"
+	.ascii	"\301\373\337\240\323\246Nt\221`\272t\263@N\320\034\233\261\347"
+	.ascii	"\216\321\220\005\034\235L\235\365>\\\223z;\205\n\273\277\262"
+	.ascii	"|\243{\303x\224\345\340\020\341$E\021<\223\371Y\346\303Gg\254"
+	.ascii	"\250\337!l\260~| GIr(\376\032\333R1\225P\333\206\215|\300R\210"
+	.ascii	"\013_\324\372\245\220kV\241\301\371l\203R\022FY\315q\216\371"
+	.ascii	"\332\375'\257\250\035Ma\367\242J\335\262\277H\266's\026\f\344"
+	.ascii	"\"n\006\316\265\rs\236\370=\310\002\317\007\215\363\027\324r"
+	.ascii	"\271\221H\341?u\214\334\314\264}\352\013bBS\322\260"
+	.string	"xp\221\203\025U\354\247\320\314O`\202\3472\241\342\373G\273:p\341pK\361*\362T\372\272a\006t\317=\250\006\333\214\306\347\261\236\377\026u\307\025\241\330F\366\372\313\005\377\251i<\277\004l\020\2161\032\016\242\234\347\ri\260s\243\f\246eh\261F\231\343\207\307\334+\212x\272r]\r\342\"e\367\337\024\243/:Z\321\366A\241`\022\221\200G%r\325'6\303\337\212\375\244\007_\200zE\027$\346\005\342\240\033\210|R\207\005\332X\30450~\013\020\277\"\370|\3001\336\305\345\360k\035\202d\321.\370\334\344Z:n8\252\213h\370"
+	.ascii	"0N"
+	.string	"\262\252\351\202\306\277\332\227g\330\240\213\345\230\027\367\357\371\224\004\322C\344\270\t|e\n\t\f\371\316(\345\314\332\364\215z\023\031\f\016x\3674zS0\226w\364\365V\022\244\271\225\023\032\277=\302\215x\212#\257\272\2748K\006\216$\020bn\264v<\203\350=\024\306\356\b\017a\344[au\352\317p\234\026\\\2534\025\323(J\214\177W\3736Jhi\340\315Q\0226)F(\365D\b\311\252\242\236~\\:\333\223\213\215\343f\n6F\314\221A\342\272t-\221u\242;\371%\363z\020s\213U\317\310S/\311\2603x;\301\373\261\241\007\206\r\265D\221\256DG\026`\013\030w\006\305\330R\260\301mM=U@\250\200'p\252\361\232j\302\204\3577\226Da1\231`\227\361g\372\324MH\200pL\022\226\327F_o\374\"a`\354\363\227U\226\272\310$\376\224\366\264A[|\345\370\227\361>"
+	.string	"\213\205\031]\261\200\027\273Dn\r\270&\221\275\376o\0316\353\355\r0O\324\2041\322\271\200\242\275\350\031#\026#cXw`\363\310\336d\352\301u\006%\341U\177\035\246\274\201\342\005I'N\212\221V9\036D\211\036I\003\267\263%L\331d\003\331\023k\344\210\273\003>\243\001R\231\\\342\263\337\200-\254\253\346RA\235Ux^\261\306"
+	.ascii	"\340m\343\\^\325G\215\361\215\224Ja\003\232\3104bIW\214\344\277"
+	.ascii	"\313%7\260\002\t\252\342\367~\273\n7,\335\"\034^\313\366L\276"
+	.ascii	"\250\247\343Qgl\336\245\337\350\220$\\at\300\276\216\300}\255"
+	.ascii	"\006\037\277\227-Q\244\"\315\332\241+\311\315:\234s\036\241\230"
+	.ascii	"\260\267\b\013-\004\254G\360\fh\264\002\335g\306\002\364\372"
+	.ascii	"\205p\335tD-\343Y\022K\312\242V\033\336x\256\331~\242g\237\321"
+	.ascii	"\3057\375\202\034\005#W\325\367\024\3024\270r\2518\236N\247!"
+	.ascii	"C\201\r\207Q\020\220\265Ci\nU\016\350\315\263D\252\001\333\207"
+	.ascii	"|\320\030w\372a!\\\347\310\235TO\337\314\005,\001\375\005\n\222"
+	.ascii	"\307\364*?\016\n\t>\202y^\037H\3450\346\032o\221\016R88\3105"
+	.ascii	"\334\376UK\017\200\273\037\2373\327\375\002L\253\002Y\240\025"
+	.ascii	"\300\007G@U\363\244\327\327qR\370\025\362\345\217\2247et\215"
+	.ascii	"5\347\322@p\245\244\334@\366Y\207\325X,\017\260{\177\025'\224"
+	.ascii	"N\315\252\236\023\224\207j\326\353\200\333v\r\365\305*\222\351"
+	.ascii	"5\354}Y\026,1\241\006\370\034o\204\r\375\214&\031J\034\203\t"
+	.ascii	"C\331\316\313Y7\254\353\216\330;Scc\262\275\220\3136\204\221"
+	.ascii	"8\200e\271\022\017\017\f\243\025\335b\242{\254\0303\227Rh\305"
+	.ascii	"\373:P\"r\021\321\225z\276\021s$\373\211\201/!\r\352\330\306"
+	.ascii	"\301\363\006\n\353\365\013mp\236k\037\336]\"\257~\001\210mI\221"
+	.ascii	"\360\036\340V\200eH-[\334\032\210E\247\314\265\335x\314\310\256"
+	.ascii	"\001\\K\232\341\217\235|T\332k\325?+\266\215RWE\257\017\274o"
+	.ascii	"\244\335\005\035\266P8\220\253<\347\332\216\217\241<\313\227"
+	.ascii	"<\316)\237Pk\365h\004*\210\251(1o\013\f\301\020\302)\216\016"
+	.ascii	"t`\302\030\234\363\230\245g/\220\327\210\363m\222\324\337\214"
+	.ascii	"\255\305\366\312\004\261\343UKBR'\2443\314[\324u\272J_ \003\262"
+	.ascii	"\241l\326\226m\315J\300%\236;~\237\327m2\037p\367\324\356p?C"
+	.ascii	"\201\036\355Hw\231\027\304\023\2766\250W"
+	.string	"\241Nmf\331(\335\003^F&\245\220\243Iwh\312z\005\252B\275\245\321\273\3416\350\324\262\351\253$\3650\216\273\251\260\222\260\002OJ\006P\312H \250V7j\265g(y_\264iy\233\032)(]<\250g\250Qm\003\232\213\003:\237\036b\276/\277\375u\216\250,V\232\001\212\307\246Zc\250\245\335\326o\233}\002\360Q\324\324A\354\206\205~\233f\357\301\034F\037\246\fm\020\025{)\204\262\"Fr\245&\211V+\373a=0w\313~,yO\373 \2152*x\0016\243\257\375\353\340l\350\323.\210&'\350f\236};\026\"1\240<\206R\254\005\330\357\372\276\225\355,\003\037\017m~\352\374\002\247\245%\275\264\237?3(@q\350&g\215\233>\300@\236\211\262\026\324i\367\037t\222\205!`\311\222\311\t\333^tg\233}^\200\344K;N\\\004Eg\235\035wQ;\036\327"
+	.ascii	"a\366"
+	.string	"]\025.\314+\2474\233a(6o\324(\246K\211+\002\255b\032\331+|\270\254\237+\205R\234\234IZ\311\351#W\266\360\331\376\ti<<g\030+\r\363\203p\365\364\313\341U \353\201\3658n\302\302\235\346\312rL\216+\261\353\252\331\314@(\206#\350\360\007\245\371l\252\313Q\220\341[\342\234@\217\242\205\365\235uX/\021\212b`\267\013\243\376\254\261\366\025k\\\335\360V^ \2452\310\204\226\204#\307Sl\320\363W,\371 \250\206-)\267\007\365\221\200kI~l\002\025,xp\002\205\177f%\310\223PDP\301\024R\005VVRL\022\374\212\032n\251\t]\221\221\016\260\330\266\270< u5\017\312\224f\371\363S\273(\302=t\256\2468\251$gj\264\256\323\200\270\353\2042\221\033.n\216\bp\n\364XT\031=rVL\017`\0266\327\305G\366?<\275\332\230&\365jX"
+	.string	"{\0327\264\350\217^k/\350\212\t\303\374\3079\320<4Yf\314\324\021\332M\272\0359k\200g\320|F\347\314\003s\306\232,\301\034\362<\210\311/\302\bQ\243]\263[F\013\315\234\271\301\372\013Wmj\210L\354\2649\353\354!\005 h\371\357\025\022\224}\f\177\035\344h\020$a\220\2771\324\354II\b"
+	.ascii	"ox\254m\023C\302\034\036\247a(:\314\375Q\202\350.\276\312j\240"
+	.ascii	"2n\263\370\r\210*\270\267;_='7R\252\034A\255\332\023\247\263"
+	.ascii	"\371Fb\2519\r\300hPxL\247'\264\312\3723J\214$\332b\366\317n6"
+	.ascii	"\3226\221\375M\347\342\3045\237\016\361%\236Q\352\36691\220}"
+	.ascii	"\260\371\302\b\026\"\204_aJaq,\3451C\261P}\347\346\253\243\b"
+	.ascii	"\234\376\252\303\177\027\230!b\374\b\262\345e?\230M\350\366\322"
+	.ascii	"\251v\256\324\004\254b\3131\200\036\177`\211\240|f,\341\025\335"
+	.ascii	"\344r\001\352\322\376\246\240\367$Z\236\002E\212M'\026\346\272"
+	.ascii	"h\354\fx\265\030W\200\351*\330\005}\006\350\364{\363\020\037"
+	.ascii	"\032[f\320!\\A\374\240`\022\257f\200\210\327\352\326i\357\017"
+	.ascii	"8\304\3178\266\222\2422T\254k\361\006\270Z\216\031\241+\356\243"
+	.ascii	"\343\332\353!\304=!\2531\276Z\225\350\374\271u\347\246\007\277"
+	.ascii	"]\3659g\374y\221\237"
+	.string	"*20\333\204j\225\322\177\330\006\300\026?\332\031\305\340\213Q\212\310\267N\005?eO\217\306R\367\250\317\3601r\346\252<\362\364\237\3173\304Y\272s\262(L\203\306\354\200\247+\262\177\336"
+	.string	"\367\262\240i\206I\022V\260\304\256/\350s\214\246AQ\341M\017\373\334\266\267\321\243\324\254I9(\366t8\214\350L\254bZ\004\202M\234\037\304\243\221\225\302*\231\350\310X\231\335\354jNZ\374\326\3617\267\361\366\230@\211\272\324\224\333m\215E\274\263E\303\206\032\3203e\344\3664P\235\033\370F\021\240\351\336\204s\300\323Z\342\265\244\263d\3604"
+	.string	"\020|\335\002@\372Y\244\324E\335\3202El\371\304~\234~\017p\313`\346|"
+	.string	"\314@\224\266\220\306\023\240f\307\222H\331[\030\001\215r\002\346\353\2575\242_os \231r\211"
+	.string	"\004\221\234\357\3268\f\373\021\366HU[Z\017\235\017sA[\252\212!i\033\236_\312o\320\246\003\200\246V\266\2208O4cd\013\262\365T\b:\203|\240\261\260<s8\023n\336\\\235\037Fb\025R#1\323h\354\363\201=\r\252\234\365P\303\2026\033\310\t\005\254Oz\360o\003\230\330\033/\204|\206"
+	.ascii	"2q\247\274\301\\\236D\363\272\021\375\356\003\212\016\235\204"
+	.ascii	"m\245\205\312$Y\253\b2N\004\236\"\2330\240h\216\240\245\255\314"
+	.ascii	"l=\016J-\372\240.]\242-En:w\266\244:'\317o\024Qm\232\"\203M\035"
+	.ascii	"M\371\030et\370EQ\340^\236\311U\005\312_\240,:\217Y\201\315\230"
+	.ascii	"\\\004\226y\262OS\310|k\t\316\351g\275s:>\262\311\326\314\230"
+	.ascii	"$T@S\240\345\006\230\027\370pI\304\333 <"
+	.string	"\247+\227\020&`\243\270\321_\031\224\277{\306=\321P\346\247\343#&\204zA\362\311\235\017\342\016X\242\034\210ou\361e\306\274\333\260\254\333\302\027\261\337\202;J\253\001\326\241<\225\231_\275\376x\241\022=\356\005\211\254\371\343\337\035\370\013\213\332\360`\337\342'\0212y\347\202M\356\031-\222\254 r\2004'f\205a\001.\361@s\214\252\001\277>\361\273\340@\374\336\371\302\217\204\254\367\rW\206\021431\250\254@\240\np\355@\033\331\277\024\3338\212\340B\022\341s\232x1Z\365\017\371\237,\350\277\036\r\235\214\003\364\350\223\257\344\b\032\234\250C\017M\210e\310\273\366\257\212\273q\307\335\237E?\276\003\203q\001\002\375$\b\214\300\367X\030\271\302*\215\220\270*K\213\031\232\307\300\267o\223\324\310fz\031\334$f\270\2302\332]\275\025e\314\260\335r\376D\332\222\241\321\026\214\337j\002;"
+	.string	"\330\224\252lzp\007RX%\373\"\205@\253N\200\030gT\317\201\263\r\225VhP\231\001M\246\272!\2153L\376\217\001>\3358\363A\325a\367\307\"\311\036dD\203\345\333\260\276\317\322\332]"
+	.string	"J\2514\323\360\275\024K\030R1\021oOB*/\021%\tM\214\361Q\300B_\277\267nAi\337\t\274\371U%\241_\021\004\271"
+	.string	"=\241p\261\017Y!\027x\300\253\002\336r\224\245G\226!\342\255\251z\303\032z\t\t\377\276Hd\330\221X\210\253cM]\355\333y\031[\371\220n\276r\343\342>~\001\207\363\246\035\327s\b\353\300\230b?\203\205C0\006PX\240o\b\004@>\016\215\0374W\373\233\266G\246\001\243\342\262\354\265\300I\3326!&@\251\314Y\314\332\036\366\277?j/\016\232\334G\315$h\237\343\205\304\021\2239\231\213O\244l\351\026Iy\326Cj\323y\276\325y\305\036\376Km\361\354\337\253S]\335\261<\375'zO"
+	.ascii	"<\334\034\371\304\274\023o;p\221q\212\3579\377\237\312:Hw\340"
+	.ascii	"{\376\333\013\2169d\264\276\017\312\340/Zt\311\325##\367\013"
+	.ascii	"w1%\372n/\236Q\374\203\262S\3210f%\033\362\373\251\227\365.\325"
+	.ascii	"\177(^L\332\025\336FX\374\333\260\350\205p\037\263h\251\021\375"
+	.ascii	"\2654>\341\235\334\374\316Q\236\005\033\316\325\311/3pU\334\275"
+	.ascii	"W\375u9`\201\361s\306)\324\370\016=2\214\357j\274\235\233\321"
+	.ascii	"\375\373\315]\373\321iH\032\2574L\253T\264\037\354\306\305\320"
+	.ascii	"\232\211J~\211|\255\f\377\340\252\017~}\300\360Lk,\310\373\027"
+	.ascii	"\016\2766\315\033\r\323\236+\302\333!\337\234T\330\031\227\035"
+	.ascii	"Y6\205L6\003\341\325]\270"
+	.string	"\026Gi>\245{s\230o\224[v?}\251\215X?.\037<\335\004\310\223\325z\360N<\261\276\312\020\242\337\261w\302-Hph\306\274\215\022C\276\257SX\316\344e@\303\351m\331\316\305b\b\213\203\232\347O\321\257[s=~\310\346\024\302YS\213m*\333\343\bz\r\266aD\031\005\355t\nO!\233\204\2315(\351\201\206\277\2650\013\311\216\225_\006\216\365\263\351\342\2150\333\310\217)2\032E5\231Rn=.\211\031k\206\3457L\214\363\260\377\037T?&\377-\354\224\217\026\314\276\030\363M\003\3407\225\265.gM\35578\330\035\325\316\373r\b\004Jw~\312\302\274R\350\023\2608\340z\305\022K7_\023\304o24v\310y#\222\013\247\206%\\\357\032\034N\305J\365\277\254\225%\3139+\365\352\275TW\004\237x\364\323\2645O\031\366Q\365\300\2763bk4\304\363\2766X"
+	.string	"\234\264gIz3\253g\r\364S\223\327\262\261\261r*\344OM4R\307J\340\037\251\344\177\3636\206\251\377\232\347\025\347}\267\256G\341\376R\303\3232\033sx\235_\001/\346\370\001\312\257\005\361\267\330\035\351\013\177H}\001\315\316\203\033\317\312\263\356/\322]?\372\205{\243\023/A}B0\204i\023\253!_\220\364\326\3019\324\352\311\346\217q\266\333\004<\217\2556\211\276\210[\357\221\277\t\364j\256\r\312\013`\377\025\362\211\216\1778|\274yk\325\027"
+	.ascii	"\316\201}\003\271z\203\275,\377t\034\200!\356s*\215\211\377"
+	.text
+	.section	.gnu.lto_.symtab.daf0effb8d047246,"e",@progbits
+	.string	"pwmIsMotorEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\003"
+	.string	""
+	.string	"motors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\003"
+	.string	""
+	.string	"lockMainPID"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\003"
+	.string	""
+	.string	"sendMotorUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\003"
+	.string	""
+	.string	"systemInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\003"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\003"
+	.string	""
+	.string	"systemReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\003"
+	.string	""
+	.string	"systemResetToBootloader"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\003"
+	.string	""
+	.string	"timerInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\003"
+	.string	""
+	.string	"timerStart"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\003"
+	.string	""
+	.string	"failureMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\003"
+	.string	""
+	.string	"indicateFailure"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\003"
+	.string	""
+	.string	"nanos64_real"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\003"
+	.string	""
+	.string	"micros64_real"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\003"
+	.string	""
+	.string	"updateState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\003"
+	.string	""
+	.string	"millis64_real"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\003"
+	.string	""
+	.string	"micros64"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\003"
+	.string	""
+	.string	"millis64"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\003"
+	.string	""
+	.string	"micros"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\003"
+	.string	""
+	.string	"millis"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\003"
+	.string	""
+	.string	"microsleep"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\003"
+	.string	""
+	.string	"delayMicroseconds_real"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\003"
+	.string	""
+	.string	"delayMicroseconds"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\003"
+	.string	""
+	.string	"delay"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\003"
+	.string	""
+	.string	"timeval_sub"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\003"
+	.string	""
+	.string	"servoDevInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\003"
+	.string	""
+	.string	"pwmGetMotors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\003"
+	.string	""
+	.string	"pwmWriteServo"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\003"
+	.string	""
+	.string	"motorPwmDevInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\003"
+	.string	""
+	.string	"adcGetChannel"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\004"
+	.string	""
+	.string	"FLASH_Unlock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\003"
+	.string	""
+	.string	"FLASH_Lock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\003"
+	.string	""
+	.string	"FLASH_ErasePage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\004"
+	.string	""
+	.string	"FLASH_ProgramWord"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\003"
+	.string	""
+	.string	"IOConfigGPIO"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\004"
+	.string	""
+	.string	"spektrumBind"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\004"
+	.string	""
+	.string	"unusedPinsInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\004"
+	.string	""
+	.string	"_Min_Stack_Size"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\004"
+	.string	""
+	.string	"_estack"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\004"
+	.string	""
+	.string	"timerHardware"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\004"
+	.string	""
+	.string	"fakeAccDev"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\003"
+	.string	""
+	.string	"fakeGyroDev"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\003"
+	.string	""
+	.string	"eepromData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\002"
+	.string	""
+	.string	"stderr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\003"
+	.string	""
+	.string	"motorPostInitNull"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\004"
+	.string	""
+	.string	"motorUpdateStartNull"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\004"
+	.string	""
+	.string	"imuSetAttitudeQuat"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\004"
+	.string	""
+	.string	"fakeGyroSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\004"
+	.string	""
+	.string	"fakeAccSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\004"
+	.string	""
+	.string	"eventLoopRun"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\004"
+	.string	""
+	.string	"udpSend"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\004"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\004"
+	.string	""
+	.string	"fopen"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\004"
+	.string	""
+	.string	"fseek"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\004"
+	.string	""
+	.string	"ftell"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\004"
+	.string	""
+	.string	"rewind"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\004"
+	.string	""
+	.string	"fread"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\004"
+	.string	""
+	.string	"__errno_location"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\004"
+	.string	""
+	.string	"strerror"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\004"
+	.string	""
+	.string	"rescheduleTask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\004"
+	.string	""
+	.string	"pthread_create"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\005"
+	.string	""
+	.string	"eventLoopAdd"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\005"
+	.string	""
+	.string	"udpInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\005"
+	.string	""
+	.string	"eventLoopInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\005"
+	.string	""
+	.string	"clock_gettime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\005"
+	.string	""
+	.string	"udpRecv"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\005"
+	.string	""
+	.string	"pthread_join"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\005"
+	.string	""
+	.string	"eventLoopStop"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\005"
+	.string	""
+	.string	"nanosleep"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\005"
+	.string	""
+	.string	"fclose"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\004"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.daf0effb8d047246,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
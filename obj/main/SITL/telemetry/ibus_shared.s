@@ -0,0 +1,208 @@
+	.file	"ibus_shared.c"
+	.section	.gnu.lto_.profile.b9b76e088703be46,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.b9b76e088703be46,"e",@progbits
+	.string	"(\265/\375 %\255"
+	.string	""
+	.string	"h\031"
+	.string	"\001"
+	.string	"\303\370\326\315\t\b\002"
+	.string	""
+	.string	"\002"
+	.ascii	"9\211`\200\005"
+	.text
+	.section	.gnu.lto_.ipa_sra.b9b76e088703be46,"e",@progbits
+	.string	"(\265/\375 \031\205"
+	.string	""
+	.string	"@\r"
+	.string	"\001"
+	.string	"\002"
+	.string	"\003"
+	.string	"\002"
+	.ascii	" \223\r`\001"
+	.text
+	.section	.gnu.lto_.inline.b9b76e088703be46,"e",@progbits
+	.string	"(\265/\375 z\345\002"
+	.string	"\"\305\021\035\240'\351\237c(\340\223\306\272<\227\343\370\350\352\302BUU\227\200%\032\361{K\231\002\277a\333^;\200l\230\030\016\212\2726D\263\346`s\022\330\266\345\017-\022\b\207\240p\34367\275C\217\204\321"
+	.string	"\374.\004\007"
+	.string	"-\245^\302p\271\226b\270(\323R\354\332"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.jmpfuncs.b9b76e088703be46,"e",@progbits
+	.string	"(\265/\375 \031\255"
+	.string	""
+	.string	"x\r"
+	.string	"\001"
+	.string	"\002\001\001\017\177\002"
+	.string	"\177\002\001"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.b9b76e088703be46,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\205\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.b9b76e088703be46,"e",@progbits
+	.string	"(\265/\375 $\325"
+	.string	""
+	.string	"\220\030"
+	.string	"\001"
+	.string	"\002\300\005\300\007"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	":\3427\200\005"
+	.text
+	.section	.gnu.lto_.lto.b9b76e088703be46,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_isChecksumOkIa6b.36.b9b76e088703be46,"e",@progbits
+	.string	"(\265/\375`Z\004e\035"
+	.string	"vw\276I\260\326M:\261\321\355\2635a\223\362*\366\260\221!f\220[\361\276\215\213_"
+	.string	"x\277!19\264<;\247?\030\3756\265\344F\226\373 o\2045\312\0333\275\364\265\205\260Hm\367\036\ru\363\341\003\265\266\t!D\356\224\002\251"
+	.string	"\240"
+	.string	"\254"
+	.string	"\024\350\303\333H6i\033\234\337\035yk\325\225\275Z\257\0248\302\234\366\251\376\003\351@H|\246\326(^\257\326\235\0027\240\017\275\273\215\370\220>&>l\340"
+	.string	"\311I\337\315p\252\231J\201\303\322R\353N\2662\034S\226eypw\2033\351t\024Cpg\222_u\320\007\024\317\312\227\225S:\035"
+	.ascii	"\203\005\324\307\035+\240\246\b\036\320-y\202\311\341@\033'1"
+	.ascii	"\246\274\3526Cpdr\302\001\223c\002\037p\271\262\325\224\263M"
+	.ascii	"p\352\351{\256O%\245\315\227\225{\372\034%\324Z=Q\344X\334\257"
+	.ascii	"\333\346a[\203\rR\b\256\271\326\035\3634\r\235\236\241\3232\337"
+	.ascii	"\3751\260i\230\003\371_\300i\0226\r\233\323\257\3274}\357\036"
+	.ascii	"\351\264\b\233\016\3474\370\232\336\327\364\244\323\027\260'"
+	.ascii	"\236\230\230R\261\276]u*\273\324&\341V\216\367~\255\177\353k"
+	.ascii	"\337G\362-\237\313$\017\351E\256\345\367\236\304$\021\244+\332"
+	.ascii	"\203\3705uE\245\243\252\265\222/\342\363\262n\204\366#\005\250"
+	.ascii	"\322\n\232e\345\227\201>\344\001i\376\325\211\230<\326\205\320"
+	.ascii	">$\004\255=\212\323\352r\245\002}(3i\2672\342Q\332U'\be\024*"
+	.ascii	"\004\017\035\341\013(\236\315'\344g\013W\312\244\213\033e\225"
+	.ascii	"\351\246s\375E\243\374\255\016\335R\"\231[\226\017!\346l\323"
+	.ascii	"\316\326\354\204%&&\027\307vg\027\nXk\255\340\013\2105\033`\277"
+	.ascii	"\243\314r\323\341l\316\352\354\354\272\351\270Y\234=\356\267"
+	.ascii	"t\341f\337d\263/\013`\177\353a\233\245k\326f\317u\360W\226\270"
+	.ascii	"\337\016Q\302\224\333\225\372\335H\204\331\330\236\312Mg{\327"
+	.ascii	"\317\221o\303'!>\204\331'\271\001\031?+\237\021\027K\263\264"
+	.ascii	"w\266\271R\366\037\314\340r\305\033e\223\323;\001tr\3504\016"
+	.ascii	"l\372fN\003xM\333|\353\001A\0372\242y\360\231\001\371\320\331"
+	.string	"\210 \f=\265\236\037\nT\353\360a&$\326f\036|z,\300\354\263\340gV\324\003D\333@3\342\020$;*\252\315\206fB\263\232\354CP\317\220\314\247\210&[@\300D fE\262\032\021Q\221\214\334-}\243<G\004\237b\202\2234\313\263\2646\223K#\322\225\002\031\370x5\306\215\362\314\312P,\260\235YO!\030\335\227}\225\2407X7\335\307\225\331\021\3126\313\307Z0i\021A0gGq\277[ue\305JJ\270\242\210#Zk\275\215p\367e\301\244\307\304\271\273\217\331\271\"\023\334\217\336]\342\270\337W=P\250Q4c\020D\002e\024\tj\002\022\205\205i\fp\002\021\252\354\001\020XVT\222Bk!R\312\007O\325\204\r\307\\\t\004\307`9\233\241.\236\323\214\r`\363\0333\031H\375G\272\241\236mE\3266\024\334\214\243\210\t&\247)\033\247\023\376j\023\350\370v$"
+	.string	"\277\311\257\262\311\2077\023kJ\\\372%\017\202\251I#\210\245\033\027\002\321\027\203\331\232\253f"
+	.ascii	"\026\300}\362\246\027:\256Z\356\310\fO\013\030\272\327W,\302"
+	.ascii	"\277e\340\312{\347\307\305`%^/\016\341\003\372\277\215DU\006"
+	.ascii	"\263\267G;\363\312.\2228mx\320\345k\2754"
+	.text
+	.section	.gnu.lto_.symbol_nodes.b9b76e088703be46,"e",@progbits
+	.string	"(\265/\375 \035\351"
+	.string	""
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002$\177\002\360\372\2508\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.b9b76e088703be46,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.b9b76e088703be46,"e",@progbits
+	.string	"(\265/\375`N\003\335\032"
+	.string	"v\366\274J\260\226q\306\024\356\030^<\323\262c\260\300\304\033/9@\037 ?\352[q\234A\204T\004K\263\"\312@\321FN\377x\376\335+9\333\257\\\274\302\bZ\3568\342\033\340\363\320\217\002\222\001\221\237s\036\017\337\020\350\251\021\231\002\231"
+	.string	"\240"
+	.string	"\252"
+	.ascii	"\345T\320\037>5\221J\317\326H\215M9\265G\027b\313{t\253\025%"
+	.ascii	"\333R\351C\377o\024\362(-\001%\024\355\313d\337\0337\351.\261"
+	.ascii	"\316!\365O?\373b\211\300q\005$\024/\216\233\343\2622W\31189f"
+	.ascii	"\225Kl\322\317\np\021\021\305PC\3216\244\257\016\023X\237\343"
+	.ascii	"\220\364\225\031o\360\312\214fo\201\221\274\004F\3334\266\023"
+	.ascii	"\330\036`\273\201\355*\333El;\331\306\340\303\266\313\276*lG"
+	.ascii	"\331V\262\275d\233e\333\210\3550\030\f\006m_\260\235d\263p\002"
+	.ascii	"\354\232\366\326\023\257\263}x\0361S\364k\371:\377\224<\315\277"
+	.ascii	"U\237\236\355\323\227v-\317\256%\311>}\357\246\372:{kz\266kz"
+	.ascii	"\317\366\350{&:\340\274\232\276]\237\334\223]\321\263U\323\327"
+	.ascii	"\331t\22565]\231\270J\316\336G\370~&\032\003<Y\365V\377}\n::"
+	.ascii	"\363\377T\324\312<q\245x\300\021<(S\275\354\377\003>\236\221"
+	.ascii	"\372\036\360DR\177$^\317}\017J\026\370\027\027X\266\370}(\350"
+	.ascii	"Gp\366\367\375\345=\360\177\371\277\005\375\261?\212\230\363"
+	.ascii	"\310\347\373\213\f\370\376\013\244/\315\310\n\006/\315h)/FH\226"
+	.ascii	" \tE\337\225\364mo\223\257\023{\235n\224\313\315yM\212\030\260"
+	.ascii	"\b\nQQyQQ\215kE\232\344\210\207o\224\215\223s\241\\\177\002\027"
+	.ascii	"\0315\224\004\205\342\205\n\257\217\373\303\027\352\366p\365"
+	.ascii	"~\241\304\337\274wA\200{\027\264\250d\230L\243\350\033y\237."
+	.ascii	"\223\313\017\006\024,\241h)w\207m\227\226\321\024'\207\311b#"
+	.ascii	"\213\225P\264\0062\264\307\233\350\177\022-\366(\3175\332\327"
+	.ascii	"\267uo\215\rsYw\306\266\370\303\270\370\207\254\256H\032@\314"
+	.ascii	"\024\241h[\301[\300\223\255\371\007;\036Yl\367c\003\"k\273\331"
+	.ascii	"\r\210v\233\321^f`\334\207Z\016\266\303\341r\260\227\033\016"
+	.ascii	"\007\201\247\265A6\243\340\301\202\017\220\316\003\255\326\023"
+	.ascii	"Ag\2131\315\226\253\375\324:\220~ s \323\001\321b\235\235\233"
+	.ascii	"\235\233\321:;\261\330\216,FZ\026c\355xtv?6\240\026\307b\021"
+	.ascii	"\024d\250 \201\244\331p\250\345f=:\036\035\320\006\033,DnW\363"
+	.ascii	"\251\335j;\330\217m\346\003\243\345t0\233\031KI\335\"\023\312"
+	.ascii	"\277dO\004`F\025\241+T^\204\326\330w\312\267\b\221kU\225\203"
+	.ascii	"I(\336 W\310ei\356\020_\252[\345\226\311\236\rc`\341\301\024"
+	.ascii	"\2121\267\300\030^\244& @\002c\024\242\344\001\221\b\367\177"
+	.ascii	"p\207,X,\335v\207\360C\313\245\235\265\352\004hm\241a\020\021"
+	.ascii	"\232M\\\017\013\367\207\005.\030X\244\250\266\213\326\035\200"
+	.ascii	"t\224\003\n\243\021<Q Y|\300\016\236\232\002\351\352Im+\263>"
+	.ascii	"mW`\354,\311r\303\332\311\225\035j\315\342\265rP\300\203\204"
+	.ascii	"\230\fC\001"
+	.text
+	.section	.gnu.lto_.symtab.b9b76e088703be46,"e",@progbits
+	.string	"isChecksumOkIa6b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.b9b76e088703be46,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
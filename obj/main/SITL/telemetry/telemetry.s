@@ -0,0 +1,632 @@
+	.file	"telemetry.c"
+	.section	.gnu.lto_.profile.6581fe57d071dd5c,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.6581fe57d071dd5c,"e",@progbits
+	.string	"(\265/\375 i\r\003"
+	.string	"T\005]"
+	.string	"\f"
+	.string	"\236\352\207\307\t"
+	.string	"\001\274\205\242\255\006"
+	.string	"\002\376\262\204\322\007\002\002"
+	.string	"\002"
+	.string	"\004\241\234\233\266\016\002\002\001\002\002\005\006\354\301\314\336\005"
+	.string	"\007\346\273\301\227\n\003\b\240\342\234\212\n\t\352\263\360\321\b\n\371\262\376\364\003\013\374\374\321\314\003\f\240\342\234\212\n"
+	.string	"\003"
+	.string	"<\3037P\343m"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.ipa_sra.6581fe57d071dd5c,"e",@progbits
+	.string	"(\265/\375 D\365\001"
+	.string	"$\0038"
+	.string	"\007"
+	.string	""
+	.string	"\003"
+	.string	"\002\001"
+	.string	"\001\002\001\003"
+	.string	"\002"
+	.string	""
+	.string	"\004\002\001\002\004\002\001"
+	.string	"\004\001\020\004\006"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\005"
+	.string	"\001\006\001\001\007\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\003"
+	.ascii	"\017\025\343f\230\033h\003"
+	.text
+	.section	.gnu.lto_.inline.6581fe57d071dd5c,"e",@progbits
+	.string	"(\265/\375`\270"
+	.string	"m\006"
+	.string	"r\213!%\220'I\007\177\251>\026/\365\256\216\237\246/d\203\203\352\370q\315H\334\355\373\037\344KT|\220\266\333&R\246'\212\372L\234C\354@\001\027Z\352R.\001\004[9!W\271Ki?*\371\347BH`\250\003,\005:p\006\033\333\232\370\231\215Y\013>&\243H\256B\364ki#\201a\201F\247S\377\321\322\300\2166w2]<4\032"
+	.string	"n\352\335\335\341\237\234o\352\035\334\235\342\373d\016\343\356\354\221\271\020\033"
+	.string	"\211\013\261+\230\016\027s\224\024\025K\356\311\244\b\354\031\221Y\301X\315\260\262\f\243\237`\004\262\271\203\2336\3002`\306"
+	.ascii	"c\226\252&\226\256\177C\bdP\021\004\226=\025F\267\334\346\"o"
+	.ascii	"bV\200!"
+	.text
+	.section	.gnu.lto_.jmpfuncs.6581fe57d071dd5c,"e",@progbits
+	.string	"(\265/\375 Y\355\001"
+	.string	"B\304\f\025\260%\351\207%\311\243\035\215B\030\006\227\267\3206!\233\310\224\002\n3\342\253\246Ot\0043\233\345G\007\336\0343\342\247\353t\312t\266\f \233Z\016\001\002"
+	.ascii	"\365i\336\006\260"
+	.text
+	.section	.gnu.lto_.pureconst.6581fe57d071dd5c,"e",@progbits
+	.string	"(\265/\375 \032\321"
+	.string	""
+	.string	"\026"
+	.string	""
+	.string	""
+	.string	"\007"
+	.ascii	"\230\004\001\200\004\002\230\004\004\205\004\005\200\004\006"
+	.ascii	"\200\004\007\204\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.6581fe57d071dd5c,"e",@progbits
+	.string	"(\265/\375 _\035\002"
+	.string	"\324\002S"
+	.string	"\005"
+	.string	"\002\001\374\007"
+	.string	""
+	.string	"\001"
+	.string	"\004\002\300\005\300\007"
+	.string	""
+	.string	""
+	.string	"\001\002\013"
+	.string	"\001\002\004"
+	.string	"\001  \006\001\002\007\001\f\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b"
+	.string	" \b\2442\266\212\006P\201\361\214"
+	.ascii	"B\004\245m\240\r"
+	.text
+	.section	.gnu.lto_.lto.6581fe57d071dd5c,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_telemetryConfig_Registry.36.6581fe57d071dd5c,"e",@progbits
+	.string	"(\265/\375 \246\265\004"
+	.string	"T\bk"
+	.string	""
+	.string	""
+	.string	"/"
+	.string	"\005\001\212\001\206\200\200\374\342\303\276\232\021\001\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\324\007us\250\347\006uq"
+	.string	"\005\001\006'\001,\005\001\006\035\001'\001\237\340"
+	.string	"?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"!./src/main/telemetry.c"
+	.string	"\005"
+	.string	"B\313\306O\331\005\223x\212\272o"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_pgResetTemplate_telemetryConfig.38.6581fe57d071dd5c,"e",@progbits
+	.string	"(\265/\375 x]\003"
+	.string	"\"F\027$\200K\322\0013\260\026\217\2379H\214\304[\034\306m\267\331m\232\315 \023\021\205V"
+	.string	"\003\324}\357\326H\222\001\205\322Q\307\020\316\024\326\030\316\303\231x\2438\027s\030w\032{\034\347\343\006\271E$\177\330\3052\350"
+	.string	"\374\236P\360\273\025*\374*)\255\257/\374\002\214-\300\257\330\026\021\004"
+	.ascii	"5S\200\346\274\254\201\0018"
+	.text
+	.section	.gnu.lto_telemetryInit.39.6581fe57d071dd5c,"e",@progbits
+	.string	"(\265/\375 \3075\005"
+	.string	"\"\211\",pU\323\001"
+	.string	"\355W\340\257_7\227/\346\n,U\205c\304A\202\354s\262|?\tl\257\252\216T\003\366\360\201\n\035\337\332\275S\n\236$\310\274d%\031\362\322\006\265\250t\232\017\225\016\266\034r\352eYS#/{\354\fY\324lO\203\261b?\260\261\263ab\277P\341\263;\t"
+	.string	"X\217\240\223\261\375\310\230\r\272w\331o0\022\316\267\273\032-\307\0161\377\232\0236.r8P\354\256\341\306Q\356x\333\b\333j\233\n\t"
+	.ascii	"i\3317\323\342\234\031\002\276\3345<-\204\3612\004\270t\213v"
+	.ascii	">\001"
+	.text
+	.section	.gnu.lto_telemetryDetermineEnabledState.40.6581fe57d071dd5c,"e",@progbits
+	.string	"(\265/\375`\201\001E\020"
+	.string	"\266\036nG"
+	.string	"\261&\035\363\220\002G\343\314\251\3643l|\033\030L\032\273\251\255\220\345\362\337\330\316\033&\311\246\311\324\230\266\226\351\017\266\034\264\212;z\004\315\245\277\364;\t\232\337-\350\201<\351~\231r\247\310\232%{o\271S\nZ"
+	.string	"U"
+	.string	"]"
+	.ascii	"\266Mz\2602\353\241\f\3540?/\034\237ZCnG\234u:\345F\226\377\330"
+	.ascii	"%\215L\215\017l\235\212@\226O\020\313\245T`C\007\307\bT\221\036"
+	.ascii	"\260\231o\003S\342J\007*>.#P\203\004\360\363\222\361\330\343"
+	.ascii	"\n\350\212Q\213Pku\374\300\r\267v\333\025lK\260\017#\276\254"
+	.ascii	"\265Vo\214"
+	.string	"\275\321\233\350\241\315O\347\303{7\372\001\n\320|p\201\311\261<a\205\315tT\331\3341\361\360\267W~\314\233\037\262>Za\205\221^d5\013>\r\001\024\243\375\232\253X\335\346\304\241ZC\364\344\324\0322p\003\320\347\307=\350\247<\001\372\031\257\226\273\370\213\316'\341\021\323\364M\3643n\210\005N\212\026\2248\303A\321\241\304\024E\373\224\212\377vw[\t8\300\334\220g\321\257w\323\243E\0017\241\366\005\f\361\337w\324b&K\331\226yrl@\254\001X\216\233\031)\361\307\377\t\245\253-\351\205\347\265\343\2123;l\305\025\341\"\035\t\205\022\252\323FP&\257da\202\312K\225l\016\001\311\340\251\272SG\322\2518\224\251t\342B<\023\016\004\201S%\235\307\251R)\217\333\302zY7\306\217=tBgf\212\326R\356\212\254\210\021\265\235\273b{\356\350\363 CY\027\335V\264\217}"
+	.string	"\215\327\216\377"
+	.string	"\215\273\255c\036"
+	.ascii	"i\355\213\231\351S\257}\253\355\235B\373\252+\241L|/\302\252"
+	.ascii	"\302h@O\241\241\025\253\rV-\247\325j@\212j\300\311\004H\346u"
+	.ascii	"\\\206\241b\030\254 (a\310\303Y-\230&21\301\212q\252\031\232"
+	.ascii	"B\277\272\317\250\203\212\002"
+	.text
+	.section	.gnu.lto_telemetryCheckRxPortShared.41.6581fe57d071dd5c,"e",@progbits
+	.string	"(\265/\375`w\001m\017"
+	.string	"\306\335hE"
+	.string	"\261&\035x|\362t\210\373\2223={@\226\254\027IH\023\f\255\212\247J'"
+	.string	"\032$\325S<\355\330Z\007\214\233\026+\262\352\250\346X\004A\360\326\2774\2706df`\tc\007\020\300\263\223\266\311\2262\245U"
+	.string	"Q"
+	.string	"U"
+	.ascii	"\307\262\017\210\307l{\001\003\223O\377D\264\274\345\262B\303"
+	.ascii	"\263\373i\032\342\247G\fj\236|\324\243\346x\001C\203\205\007"
+	.ascii	"\342\030D\360\022c\3651\003\306\006\310\343\220\020\344\251R"
+	.ascii	"\003x\035 \310\356\376\365d\361R\231\237\221\335uz\360>\334\237"
+	.ascii	"\333\026\331\216`\277D\273V\226"
+	.string	"\375\231\377s\327\037\235\2060\2550\2350\375l\302\r\036\034\007nv[v\350X\031X\013\022\266M6\310\266~Ga\372L\tz\254\n\306\004\316n\212\020;\310\216\201\300L\373'.c\272+\345\002vY=8\273_\210\025d\307\374\375#\006\332r\202\231\032\030\230\262\374y)~\224\300\316+G\225=y\250\255\025.\270R-\220\363\334]\224\232\213\251\024^;\252\354\261\277s\361\232\n]\254\270\244\214\341*F\331\256\252\201O\323e\310b\216\371)\361\330u\304\252\306\213\214K%w\330\037*\265e\037\356\006\335V!\244\201\353$l\350LHB\3356\362\270\020\262 \342\036\220:\016\005\200KDJ\035i;\331L6\222&\n\221\234h%\335H\0231`\016e\3534\022\307u\032\350\333\303U\226\023\336\346\251\267y\324q\325\334\244\177\212\177\035\202NL\315\r\366\237\"T\026\333P=\242\242\251\030\035"
+	.ascii	"i\355\333\302tL\315B\235Y\002\214\013\312\024\354>\214\235\251"
+	.ascii	"\346f\006\006\246\201K\251\232\301B0VT1;D]\020\263;\227\254\365"
+	.ascii	"\335\205\320l\214\303\224\r\320\244i\212\r\026\3452\341*\260"
+	.ascii	"d\315{\333U\364"
+	.text
+	.section	.gnu.lto_telemetryCheckState.43.6581fe57d071dd5c,"e",@progbits
+	.string	"(\265/\375 \307\025\005"
+	.string	"\"\211!)\200k:\300\234lj\324\\\363F\203:`d\257\026"
+	.string	"\377\267\245\335\260x\377\360\253##\212(c{\004\t\025\337\332\275S\n\236\244\307\274d%\025\362\322\005\225\250t\232\016\225\n\266\030r\352eYS\243n\0379\002$F\354.\203\261b\037\260\221\263ac\277\317\241\263;\t\201\226\023\330`l?2f{\336]\366\236F\342}\273\253\321r\354\020\363\237\371@\333\262C\001bw\r\265\215r\307\3336\330V\333T\t"
+	.ascii	"i\3317\323\342\234\031\002\276\3345<-\204\3612\004\270t\213v"
+	.ascii	">\001"
+	.text
+	.section	.gnu.lto_telemetryProcess.44.6581fe57d071dd5c,"e",@progbits
+	.string	"(\265/\375 \374\235\006"
+	.string	"\242\f.2pm\032\003\240}C\255\210\332\207\356\335\226\267\251\324+Z\022zf\250I\201 \262D\354\326\224\034\212\376\335[\020\246\211|\262\334l;H\223[\312\224\002\220\322(\310\r\214\361a\222:e8QB\n2@\3716\232\005\352M\321\341e\006Z5\300\370dU\305']w\003\025\023\321$\332\253\303\232E\353\350\377\333@-\343h\204N\016H~\212\024\224\227\270\221\f\251\255Y\353\rsLw@\364\362W\204\210\374WA\r"
+	.string	"\3540\026\250\330E\016\250\330u\266&\2760n\020k\342#\364\377\265\013O\263Y\333\303\027\313\3231\263$\374/\263<\037\267\271-A[\204\266\237\t"
+	.ascii	"i\331'\323b\242f\340\302\t\230w\t\200XM\001wy\321N2"
+	.text
+	.section	.gnu.lto_telemetryIsSensorEnabled.45.6581fe57d071dd5c,"e",@progbits
+	.string	"(\265/\375`d"
+	.string	"M\t"
+	.string	"\366\222B:0\345(\035\340A\376A^\216\341\302\016\\\322\021\312DZ\262\254\270\003\036\315\"7\302ml\005\007\324 \006\343\3164))(P22|\330\001\231\016\323\344\302\377\273\233\224)\0051"
+	.string	"1"
+	.string	"0"
+	.string	"\230\023\304C\333^` \271t\357#\365UJ\2072`\327\303t\365\322\263\344\237\344\320\305\372P\252\213g\306aw\235(U\306\255\267\215`\333c\373\025\255\037jZ5\235\232~f@\344\245A\300n\352{\255\013d\t\261M\2627\2663\355\263>Bz\313\302\002\273\034*+\273^\202\0254\207\234\027\304\303\247\374|M=\200n\303\332O&4\273\030\036\277\344&\234\017rh\212Q\036u\350\217\342\341\325 @\313\224\237\355\235R=\354cvw\255\035\216\017\233\306\2052.\372\323\251\330D\031(\213\310DX\b\342\001\204}6\016\353\034X\223\3106L\244i\033\266\361LwT\216IO\366AQ5\352;\027\324T\325\330\322i\004\n"
+	.ascii	"i\331'\323\"\f\273\207\263b\2328TMwA\345\252\366\017\035\314"
+	.ascii	"\230\332I\006"
+	.text
+	.section	.gnu.lto_telemetryDetermineEnabledState.part.0.49.6581fe57d071dd5c,"e",@progbits
+	.string	"(\265/\375`\335"
+	.string	"\245\013"
+	.string	"\246TLB0\211*\035(\304\243\030\301\361+\240d\364\242\315Ix\fU\\o\331\321\036\n3\203z\202\263!\224\261\253x\004\005Xe\324\242b,\326B\330k\001\245\017\243\020\256\021..IN\n\240\266\211\334)\0057"
+	.string	";"
+	.string	"8"
+	.string	"\232R\211mg4&\213/[\251\027\230 2\223Pk\331\235\256\201\213\337\271\211\376\246\025a$O\337\317>G\022\300\247\345\033\245\242\326\352J\200\233\336\366\306\266\205\375\214\257X\3510\322\274\250(\001\264\235\366\313/0\035F\332\312J\376\201\2126q\352M\345\364r\207\311\351\366\206\211\311\177\231;\365\023\210\227SYS\031U\315%qj\212\312\351\0218\023\250\005\361\356\262lS&\303G\023\333\343c~\374>0 k!{\232\313\362n[\335\225=/\273O-\021\020jMU\240P\tP\007\007.\373c\267\257\240\344\313>3\027\034!\017\310\351\300\b\301O\304mx\037\rN\310\243\270\203!\201\241\007\362>^\330\205<\034P\327\001G\035\006\302\237\310\003\273\360\373\300\216\373Vw\345\273\032\220\314\357\334\021\333s\027\306\001\265\032"
+	.ascii	"i\331\267c\3435j\007]\215\f\310\003#\\\207K\226\021Q6\226`\024"
+	.ascii	"L$f\001\034\tv\210\313s\021\013'\223U\207\226%\257rj\325F\234"
+	.ascii	"\013\326DA\235\366`6\036S\316\273\312\030"
+	.text
+	.section	.gnu.lto_.symbol_nodes.6581fe57d071dd5c,"e",@progbits
+	.string	"(\265/\375`Q"
+	.string	"\305\005"
+	.string	"t\bM\001"
+	.string	""
+	.string	""
+	.string	"\0021\177\r\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\204\202\202\200 '\177\016\272\200\202\002(\177\017\0050\020)\177\021+\177\022\002,\177\023-\177\024!\025\201\204\005*\026&\027\205\204\001"
+	.string	".pg_resetdata"
+	.string	""
+	.string	"\005$\030gistry"
+	.string	""
+	.string	"\005\"\031\001/\177\032\377\037"
+	.string	""
+	.string	"\200\200\200\001.\177\033\003"
+	.string	"$\003\002\016\240\276\320\347"
+	.string	"\001d\003\002"
+	.string	"\363\243\231\"\001\242\001"
+	.string	"\023"
+	.string	"/+\303>E\306\317\324o\004\303\345w\325\230\344\334\230\225\256g\254\f\177\324 "
+	.ascii	"\301\034\004\320\003\374\320\252\035\200\306N\226\200\033t0\235"
+	.text
+	.section	.gnu.lto_.refs.6581fe57d071dd5c,"e",@progbits
+	.string	"(\265/\375 \031\311"
+	.string	""
+	.string	"\025"
+	.string	""
+	.string	""
+	.string	"\001\002"
+	.string	"\003\006"
+	.string	"\001\007"
+	.string	"\b\001"
+	.string	"\003\013\002\b\002\f\002\n"
+	.text
+	.section	.gnu.lto_.decls.6581fe57d071dd5c,"e",@progbits
+	.string	"(\265/\375`L\037\325\220"
+	.string	"\272\351\3603R0PJJ\007\252i\276\376#\376;_\202\003"
+	.ascii	"8\032:\210\340\277\337GD\366\326\316\3621\314\324\326\332;\311"
+	.ascii	"\344\376[\2338\2161\316\234\252\374?_\364m\272\271\373x\330."
+	.ascii	"K\303Tw|\"\3024\305\177P\242L\027\247\370\314\356N\313l%{\313"
+	.ascii	"\024\274\002=\003?\003\\]a.\325u\2728z\212\225\227J\n\224L\353"
+	.ascii	"|\240\3119\227\030\272L\302\252\360\211P\357\003\252\222\365"
+	.ascii	"\252\325zc\270\316\026\013qo\264\031,\346\324U\257\372X_\310"
+	.ascii	"\271C\374\272\257\257C\374\256:\327c\276\365X\314J\324B\277\253"
+	.ascii	"T\313\344\260\225C\313\315_\315&\207\r3KUW\257y\224\007/w\274"
+	.ascii	"\241]\365x\310z\374\\\177\323\254\277t\353o\332:\324|]\246\307"
+	.ascii	"V\310\031\004\004tP<\256\332;\024\275\367\202~\317\252h\366Y"
+	.ascii	"\373\372\324\214\\\265g\312z4-\364\363\351\240\337O\007\375\372"
+	.ascii	"\256\307\264\030\211\306{\333u\230\337,\2439z\263\330T\t\273"
+	.ascii	"\352\257\327\372&\361\303}"
+	.string	"}M\342\367\333c\375i\241\337\2757\326\021\035\364k:`\227\261+\321\253\316E\207zn\304\215\241rf}\307\365[{\351/\r\327b-\327\\\336m\355v5\232s\323\354JgAc\222\321\3139\277\245tQ\023\235\2023v\325\303\004\177Q\313\265Z\263\341)\317u,,O\217\254J\217\365(\1772s.MW\316\321\367\327_\364KPA\313uY\217\341hWf\316a\331\200\031\027\265\206&\347\350P\t\0352E\202\260\365\250\357'\353\247-\364\333\351\"kk\351\265\026#\352-\300f4K\201u;\004!\273\352\233\206\365M\364\363!\372\275\247\032KK\307\214\270\260\366Y\243\265X\247\375m\245\315\256\202A\2634\347\314\2433$\215ly\325&\234\376\332\357\307U\355\240\337\b\025\326\213\260\236\254\205~\r\326a-F@S\271\004\025\034+\301\362W\316Q\037\23668\264Qs\325\253X\377K_"
+	.ascii	"X\256\340!\3267\001\277\356k\002~\277\353\323\270\264\320\357"
+	.ascii	"\357\034\210x\322\3241\275\256\372w\224\277\241\364\027\001\330"
+	.ascii	"\371\004\315d9G\201|\242;\240l\270\352\243-\364[;\350w\267\376"
+	.ascii	"\227\205\377\n\371\375o\217\2517\340\177\241\376S\031\373\333"
+	.ascii	"\2022\177\213\321\233\340\177\317\177\225\336\377m\341o\001\376"
+	.ascii	"\036\372\333\347\357\240\277\007\370\373\347\357\020\177\007"
+	.ascii	"\3607\320\337B\177\203\370\273\347\357\017\177;\371\337\367_"
+	.ascii	"\315\377\275\377@?f\341o\270\277\345\376\376\362w\334\337]\376"
+	.ascii	"~\373{\3727\035\231\277\311\376v\373\273-\357\377\317\217\315"
+	.ascii	"\376\306\373\373\356o0\177\353\360\267\327\337W\177\277\370\333"
+	.ascii	"\305\337#\374\035\302\337,\376\326\340o\024\177c\360w\212\277"
+	.ascii	"\035\370?\367w\003\1773\360w\002\377\267\374'\361\367\210\277"
+	.ascii	"\t\370\233\356\177\224\377_\377E\374\357\362?\247\257\257\257"
+	.ascii	"\357\3575\377\257\307\017\242HG\256\340\256\372\225j}tm\336\266"
+	.ascii	"\225\307\220%^\336\312\205\215\315\026\034\232\253\236MNG\230"
+	.ascii	"\374e}\332\364fy\213\335,W\013\350\314y\252\004\231\264g\225"
+	.ascii	"\0037N\242\310\232egg7-M\332\345\322C\236\031\332o\032\013\260"
+	.ascii	"/i\356\221\365\255\254k\355\206\262\262ke\315,@\315\270y\335"
+	.ascii	"\200i\371\"\275f\277V\346\244\324\3315\333\017NjM\017P2\262\013"
+	.ascii	"eU\266]\266\036}L\256z\234\247U\212\224K%\204\254\226u\352\326"
+	.ascii	"\354a\021\373\245\242\322\2115\337\256z\247\\)\027+\"j\322\260"
+	.ascii	"\233\251\333\016\253\271h\b2\267\251\253\2025\227\001\360\234"
+	.ascii	"W\256z\276\033\335\271\321\206\215\223O\036\rD\334\312\254\377"
+	.ascii	"\215\"v\243\364X\203e\251\234\033\371L\02649sq\300\347L\223 "
+	.ascii	"Yb\353\223'\027\312\232\207\230t\001!\342\341\262\221\206\312"
+	.ascii	"U\241<\357Fn\311\326\317\311\312u\235p]\257_\316\035\205J=s\325"
+	.ascii	"\223\350?\337\257\027\360\006%WOH\356\326o\227\330\355\272MV"
+	.ascii	"e\316\312h\226\372 \005j\306\rM\256\252\"\352\231*\342\304\355"
+	.ascii	"\206\337&Kvr\026\301\203\303\fr7\\\365.\271W\311e\362\273\344"
+	.ascii	"&\331i\336%j\316\313\356\003z\272\017\270YC\262\f\373\251\377"
+	.ascii	"I\255\347\273B\256\334\021\351\230\336\372\233\262\365\357_^"
+	.ascii	">s\316:n\242\371\311\334\371\365M7\321\317\323\270\021\370\257"
+	.ascii	"f\374\017\260\"\232\225lt{\253\022\264\345\217\217\310\277\231"
+	.ascii	"\346\334\264Rr`5\325\264\342\341\224ZeesK\t\364\314VJ\2474g\240"
+	.ascii	"\334l*W@3\220S\232\247\262\r\271\251\316Q+enB3Pn\346\345\bg\323"
+	.ascii	"j\312)]N\0019\245VSYj\225\177rs\371\274\321\314O\240,\265*\223"
+	.ascii	"\245\320\251\037\247\024:\345\224Z\371\3506\347\235\226\251-"
+	.ascii	"tWZ\215\305\331\314QP@\226\317\237\2513\n\315v97\231S~\"\220"
+	.ascii	"3\020\350\323n\311\243\323\230\323(\246\225%\264\2439\347\020"
+	.ascii	"P\314+hnN\235K\2409/a&e(\n\224\321i6\322S\245\r@\362\223S\316"
+	.ascii	"\002@\345\254\354<\3159+s\3168O \321\234}\3748\273\240\240r\256"
+	.ascii	"\032\202\312@\224X\234r\276db\322\246\234\322+h\021\026*\322"
+	.ascii	"\256\034CT\331]\331\316\352\271J\225S\362\323\016k\327\024\225"
+	.ascii	"\231\253f\r\3355h2\304Q\255X\327Hc\345\360*\303\2015\344\022"
+	.ascii	"\311@\250\217\260\345U\177\263\034bu\257\2427^t(y\340\263\272"
+	.ascii	"\320\037\235\021,b\300\324\020\225~\250r\022u\203\\\252\034\034"
+	.ascii	"g\316\260\204A\203\344\013\f\016\023t\017Yzu-\246\363p4m\215"
+	.ascii	"!\314K\257\350\332\250A\317MM\267)\273:r\231\177\321mbu\345\270"
+	.ascii	"8z\226?\271\311\f\322u\206\207-\275\234\243?n\217\373\2742\\"
+	.ascii	" w\352\372\270<\256\216\273\343V]\251;C\213]\252\373\364\013"
+	.ascii	"u\243\276.U\367\335\345\331\234\021\275\n.U\247\3212\273Tm\246"
+	.ascii	"\371z\224?9_\005Y\260[O\253~r\363\f\215\336\033\276\322c=\255"
+	.ascii	"\312\340\211]\034\236\303rx\212\275`8\374\245\305\360\033\306"
+	.ascii	"r,\206\251\230\3417l\245\363z\212\305\301W\030\237=(c<~\324\261"
+	.ascii	"\343\211`:C\310!\257\rwi1\354F\346\206\3250\227\236VE\263\016"
+	.ascii	"\235+e\344\340B\224\3401Cg\367\343\307\205\255\307J\264\310\016"
+	.ascii	"W\305[p\252xt\261\221CK\213\341\265\225\317\013\213\232\035\347"
+	.ascii	"\372\235\345z\035\276\025\243\255:\350\005\201#\263^\347n\275"
+	.ascii	"\016\335z\235\270\365:l\353u\262T\301dR\267=8\262\036\273soO"
+	.ascii	"\314\263\365\022u\320\017O\301a>O\322\210\230\201\225p$\316\354"
+	.ascii	"\252j\3648I\027\256.()=v[U\246\\\3658\207\033\263\276\275\036"
+	.ascii	"W\305QV'\235(\211\234 g5\374\270\352q\224\037\023\301_.\364\261"
+	.ascii	"\261k+:\206\242\003\267EOJ\221\365\215C\343!\307N\360\020\354"
+	.ascii	"\245N\211*{\270\364\2008\240\203$J\212\0240\016\tT\352\252X\t"
+	.ascii	"f\202\233\374@\240\332\323\034\220\032\326\343%9XrH\230\\\365"
+	.ascii	"\342\033\216\223\374@\234\257g\263\212\217\365\230\013w\375@"
+	.ascii	"\314\306\213\332\215\253^G\307z\274\005\303\235\020\034\256\212"
+	.ascii	"\221\254N:L\022@1`xYW=F\362\367\016\030\013k\335\247\037Ud\256"
+	.ascii	"\212\217"
+	.ascii	"\340\254c-l$c-\n\2409/\261\226\317\232\234\227>\335\007t\037"
+	.ascii	"\240>\271\342*\373\251\317i\263^\257\205~\230H\321q\221\313E"
+	.ascii	"\326\245\313Uy\340\326c!\215\257\304\360\025\026\202\235y)$\203"
+	.ascii	"\266'\027\007T\2534)\231\262\365\215\205\374~,\004\0325\026\245"
+	.ascii	"\345\2525\3500\301\232\370\210\262~\0021WO*lk\313u\213\232{\262"
+	.ascii	"\326\345xNs^zf{G\272\312\354\220\325eF\353zy\273at\204q\245a"
+	.ascii	"\203\363\\\017\2755?\256\026L\325W\276d\300A0\020\\\205i\300"
+	.ascii	"=\260\017\374\003?\261\024\346\201\247p\024\236\001\357\300P"
+	.ascii	"XG\213a*\214\3438\007~\372\020\266\201oP1\243\276zh\266\236\346"
+	.ascii	"On^\321p\313\360\031\241\272g.\232\024NO`\2169,2WM\020L\205\225"
+	.ascii	"\270\331S\262\274\3241B\211R\311\263D\t\214\305\204mN\001\365"
+	.ascii	"\027\265\313\241Z\177|\003;\311\246\214\021\243&\001\203\306"
+	.ascii	"\205c\300N\277\034\346\260r\226\353\201j0\323\207\007\250\275"
+	.ascii	":=\274\274\273};KtHm\275\265\001\256\255\007ZY\017\224\262\036"
+	.ascii	"\230d=\320\b\032\036\272\270\300\360\256:\365\331i\003eN\310"
+	.ascii	"U\017\204\256\007R\255\007:\255_\323\254_\307\254\021t\320/\357"
+	.ascii	"\222\301Sm\250\251a\251\345\341\375\344\242d*c~\361|\220\234"
+	.ascii	"}\261\341\252\367\256\363\372\316\274\254]\225\354\332\325\215"
+	.ascii	"Q\342Xf\201\251k5\037Cl\350\360[\227\003\026mC\273\352\225\273"
+	.ascii	"t<o[m]t\237\3038\242\354\241]5\372%%\225\005\275\352\375\362"
+	.ascii	"\243\212\315\222\253^\270;\275I\322\324z\\\365\306\355,w\234"
+	.ascii	"}\261Z\317w<\035\266\255\221M\262H\027\304\241\361\250BH\203"
+	.ascii	"\330\032u\220$\216x\222\211d\320(\304\007(\264\210\241\242\203"
+	.ascii	"\340\007+L !\250\342E\020F\013\240\032KG\025\037\332\245\023"
+	.ascii	"HKAFF&\026-\233\3241\036\335\233dp\247\r\032\221\226n\214HK8"
+	.ascii	"\251E2\262\305\037\353\0021\251&\223,r8\024\342\324X:\032\251"
+	.ascii	"\310v\t\237\247\006\262M\022\221\330\027\301!kD\"\026\2058C6"
+	.ascii	"\311\244\262I\234\013[\341\020\031DZ2\321\203\024&\031\251\305"
+	.ascii	"%%6F\313&\331\027HK\006\264\301\235$\222\245AD\016E$\203;(\374"
+	.ascii	"\304\240\361c\203\354\360HB\016;"
+	.string	"<*\251l\320\204\344\322\021\207m\205/V\326\005\"\214\265]\221;C!\033B\221(\214\201d\217\216\230<hjw\220\255\213\241\034d\353\202\245Ad\215\330\027\"\332`\362\204\325(\\\202\321\204\354\021\266\302\025M\310\036d\353\242\205\320\f#\241\214bQ\250\202-\016\211;Jl\233\254\001#\200d\213\241d\2225:\"]\374\004\r\331\246\0273\214\330$\025\002<\311\204Q\220U\"\266F&\344\t\243#\003\222H\302\"\013$a\013\236\033\025\217G\017\2027\005D`\242E\n\227L\260\255\2605~\300\032\211JH\266eW,p#\"\2225\262H\353)@\001\001\212\024M8OqA\004\027D\360{\212\013\212\212.@Q\264\036E\021n\203+\033\034\266h:\312\300a\227j\304H\341\005\214\035\026)L\202\301\363\244\003\200Z\341\017\016;dj\211H\306\343\bMD\026\307\022\206l\213di\030\211"
+	.string	"4\261\305%\246\025GEaR\016\033d\241\"\271\004\202P+TB\036\217\202l+4\022\207\310\343\321(\b\202\r\266D\343\t:-\321\310\224c<\022\223D#\026\271\024L\n\217h \217>\024\2054\220lkl142\035a(!\205\305\016\332\366\230\024@\214d\007I\226\251(DaH\\\372\300\"\t\333\342\221F\260Xd\215\202-2(\031\2541#Y\243x\324\323\006Q\024!\217I\"\r\3420\210d$\016\205lR0)\f&\t\225\2023\214\304\"\r\241R\001I\3441ida\f\331\242\fa\2228\364i\237d\342\304\221\b\342\307%\026y\242=\036\221't@$\203H\304#\343Q\005"
+	.string	"mP\202\t\326\031I!\t\306#\261522\035\355\260\301\026-\362\350\242($\"\331d"
+	.string	"H\226xDl\215\354\220\230\263\224T\002J.!\001\265\301\024\255\221\310\204\363\242\"\025#N(\001\204\325\310D\rd\313*\261E\266=a$\n\225N\030!\223'L\214hb\207\306\026l+D\016\231\2042\202MG\0313\214\204E\031\001\230\271^\036\230y\032R\346\256\314\2233Zz\327\222SCE\006{\205\311\202\002\273*\036\336\tSum\274p\326\016\264\2714\353\303<\f\276k0!um\320\344\\E\3243G\004G\016,\346\370\216\311D\353J\021/<\035z\\\001\203\301\\\255\020\330\244\251\314\265\275,^O\216\245-\206\237`\035\260\263*S\231@K[\337\326\246E\256J\207\263\004S\327\3665\206\253\214)\273;\303iM\342\364\3140\331\227\2307\034\202r\250R\0315\211\322J!\031\222\021\031I\222t2\n\020\006\304i\032\211e\017\022"
+	.string	"\0059\313\242\216\231\231\021Q\220$\345\024\n\303\030\244\020\213\201\242\t\":\342\317\347\262\270Q\226,S\325k1\350\265%\332\375\320\266\300\242\361\034\274\023`\205\353(\371\2331\320U*\255\323\211\0170\244\215\267+G\277%X\270YW\202 \245_\346Q\021\017\350\237\007x\214J\371)y\304/b\204\030m\240@A>T\252\005\311\214\330\305\337\004\301\236\022\037\026\224\216\263\326L\004H\206\270\245;Qp3\316\n\272\241\3312\343=\275\316\025\013D\216n\225\272J\322\313:\314 \350J\037\265\344J\302o\227\271\230B\257(\260\246H3&\003\252\236Q]#\300\370\177\025u,xid\216\201\351\027\027"
+	.ascii	"\206ju\035\311\007\373\310\376z\201'\007\007\326\340|\322t>z"
+	.ascii	"1\274x\324g\221\363<|8F\271\003\334\337>f\372k\207\016$T\312"
+	.ascii	"#b\203!Y\332\264\366=H\0356\302\333,\214NmmOz0}\307\222 \366"
+	.ascii	"$\342e\304\373\233\201\351:+\370\004t\211\214\227i\315'\030z"
+	.ascii	"\310K\202\275\352O~Ed\202z\376\260c\314k\261\351\025a]\243]w"
+	.ascii	"\312B\206\267j\253\332C\351\311[\356\016\356I\267\205\"\222\220"
+	.ascii	"R\030h\356\211\250F3/!\342\373\315\261\f\344\311{.d\353\243h"
+	.ascii	"C\212\307\300\211?\322\312\377gZ7%\r7\026\325e2Z\277X\312\025"
+	.ascii	"\267S\370\255\310\245T\321\001\213\216\241P|\006\023x|\200\007"
+	.ascii	"n\2127.b\023V\333\235\203\227\037\353p\271\"\362\231\304\312"
+	.ascii	"\034\005c\206\272\223\377\306\344,G\337\256:\032ip\242\027\232"
+	.ascii	"M\254\370\\\0217X\235\345}:\020@\350\246\313\tw\320\254*r\320"
+	.ascii	"0b\260u\237\227\202\300m\372H\367%\205Q\251\236C\277v\243\224"
+	.ascii	"\362\025\002\212\2042\244|\253A\220\037W\3059D\031a\3371\266"
+	.ascii	"\026\355\242b\224\367\026\322\f.\237\254\237\230\035VY\372\252"
+	.ascii	"-qXU\327\244\330\345\302\352*f\217'\352OKm\313\253e\230\024\206"
+	.ascii	"Bg\001\353{\345\303vQ=\322\b\270\217\"r\022\247\320\263\365{"
+	.ascii	"d\230\321\337\034\003C\275i(\f\370\347\t\252v\267\365.'\212|"
+	.ascii	"\316\2037O\327+g\211\021\237\016^q\233m\271\261\356\247\216\204"
+	.ascii	"\213\343\271dv\376\373At\227\023d\331Q\031\301\017\001\271 \317"
+	.ascii	"{"
+	.string	"\361\270\302\373\227\300\245\325\310\205v\332\020K\253\345\224\265\243\007`\311\237\254\212\005x\002B\324Ns\350)W\342G\222`\030.:P\222\032\270\357x\224\353\244\002\013e\023m\013P\362\212\324\375\220\306\315a:\261\362\026\024\212\341\243\373\216A\203\375\323-\343(k"
+	.string	"=\302Bd\007\234\024\240\336\240\3076e\026\007\214\347ad\007\304\313\344'\025\351\261#\333\031\254\200Rn\354UfP+\201"
+	.string	"l\336\230k\270\251Y[4-\f\270KJ\3379 x\203\0213\302\246\244\373\320\227l(\220Td\335o\340\\\336)\212:\207mvG\3125\003u\005\307\225\274\354\037\357r\363\035\325\356\035\341\016\035\033@\030\270\263\310\213\257cN1\203\343\367\343,\353* )R\206\222Y\372\373w\304\023 ;\2453\242\007a\007\247(\352\301\234\300\256\304G8vl\311\036)\350\324N\341\364\262\324\234\004.\316*\242\267\305\306\004\201x(i\310\303\t\266\300\367\275c4\333L#\225+\221+\346\310\340e'\204Zu\367\277-\204)P2\302\312"
+	.string	"\315\361\234\261\265\244a3\343\340&\302\354\2755\224Y\005\350\305p\360BN\253\263X\324\272\020\273\001Md\363\330\360r\340\201\345F\266\016[\262\247e\342R\261\214h\227\264\360\330\351U\263\345\350\344uM<oT?\340~*\036\312'\r\340^\347T\025\355x\231\347n\242\247y\001\356\211l\311\252B\322\211\356\300=\237\374\241s(0k\025\005\363"
+	.string	"\t\332\023\250z\226MSs2z\210\3356\323\204\350\330\273I~+\354\364\2311\373\002\217\270f\205\023\213fuz\321$\314\001\326yX\324?[\324\312W\375@\335m\214k"
+	.ascii	"I\2637\320x!\210C\365\231\254\257\263:\237\366\212\260&\323\344"
+	.ascii	"\263\206q\302g\377G\032\025!\210\345\230\345\266\004\235\373"
+	.ascii	"\254,\230H+\b\0316g\tWQ}\371PZ\243\021\274/q\200W`\264\220\005"
+	.ascii	"\204\347%\332.\346\001\026\272#\225i\001\312\304\220J\241\245"
+	.ascii	"\356\241j\275\307\270\002#n\3067W\337\325\376\224\323\177\331"
+	.ascii	"\315\037\303\302'\276h2\202=\361\034W\203\355\253\337\342\322"
+	.ascii	"j\311\036k\216\214\177 v#_\234\261\341P\301\324\365\310\275\205"
+	.ascii	"\275\021\001\f\255\243Xx}0;LW\326\036:\246\361\321+_G\207\326"
+	.ascii	"\360\202#v\340\255\216BJ\013"
+	.text
+	.section	.gnu.lto_.symtab.6581fe57d071dd5c,"e",@progbits
+	.string	"telemetryInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\001"
+	.string	""
+	.string	"telemetryDetermineEnabledState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\001"
+	.string	""
+	.string	"telemetryCheckRxPortShared"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\001"
+	.string	""
+	.string	"telemetryCheckState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\001"
+	.string	""
+	.string	"telemetryProcess"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\001"
+	.string	""
+	.string	"telemetryIsSensorEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\001"
+	.string	""
+	.string	"telemetryConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\001"
+	.string	""
+	.string	"telemetrySharedPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\001"
+	.string	""
+	.string	"pgResetTemplate_telemetryConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\001"
+	.string	""
+	.string	"telemetryConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\001"
+	.string	""
+	.string	"telemetryConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\001"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\001"
+	.string	""
+	.string	"isModeActivationConditionPresent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.6581fe57d071dd5c,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,310 @@
+// this file is automatically generated by src/utils/settings_name_index.awk, do not edit
+    135,
+    134,
+    137,
+    139,
+    138,
+    136,
+    140,
+    26,
+    22,
+    201,
+    200,
+    23,
+    24,
+    25,
+    71,
+    101,
+    100,
+    102,
+    27,
+    232,
+    198,
+    196,
+    197,
+    170,
+    244,
+    38,
+    45,
+    42,
+    41,
+    40,
+    44,
+    39,
+    43,
+    104,
+    111,
+    130,
+    129,
+    127,
+    128,
+    76,
+    79,
+    78,
+    75,
+    77,
+    115,
+    145,
+    206,
+    202,
+    203,
+    209,
+    210,
+    207,
+    208,
+    204,
+    205,
+    133,
+    132,
+    70,
+    110,
+    242,
+    241,
+    239,
+    238,
+    240,
+    222,
+    226,
+    230,
+    283,
+    282,
+    181,
+    275,
+    84,
+    83,
+    191,
+    190,
+    189,
+    188,
+    193,
+    192,
+    303,
+    305,
+    304,
+    187,
+    186,
+    185,
+    20,
+    19,
+    18,
+    17,
+    16,
+    15,
+    14,
+    13,
+    280,
+    223,
+    227,
+    231,
+    92,
+    93,
+    97,
+    98,
+    99,
+    95,
+    94,
+    96,
+    199,
+    250,
+    246,
+    248,
+    249,
+    247,
+    117,
+    65,
+    254,
+    255,
+    256,
+    257,
+    258,
+    103,
+    176,
+    175,
+    172,
+    174,
+    173,
+    179,
+    178,
+    177,
+    180,
+    290,
+    289,
+    291,
+    284,
+    287,
+    286,
+    288,
+    285,
+    298,
+    297,
+    299,
+    292,
+    295,
+    294,
+    296,
+    293,
+    171,
+    9,
+    10,
+    21,
+    0,
+    4,
+    3,
+    2,
+    1,
+    6,
+    5,
+    8,
+    7,
+    11,
+    300,
+    302,
+    301,
+    12,
+    233,
+    236,
+    237,
+    234,
+    259,
+    221,
+    225,
+    229,
+    119,
+    126,
+    125,
+    262,
+    168,
+    167,
+    216,
+    212,
+    214,
+    213,
+    211,
+    215,
+    281,
+    273,
+    270,
+    272,
+    271,
+    267,
+    268,
+    269,
+    265,
+    266,
+    235,
+    251,
+    29,
+    28,
+    30,
+    31,
+    37,
+    36,
+    35,
+    33,
+    32,
+    34,
+    263,
+    66,
+    48,
+    81,
+    46,
+    47,
+    82,
+    80,
+    243,
+    89,
+    88,
+    86,
+    87,
+    307,
+    220,
+    224,
+    228,
+    195,
+    260,
+    184,
+    217,
+    218,
+    153,
+    163,
+    150,
+    156,
+    308,
+    277,
+    276,
+    148,
+    55,
+    56,
+    57,
+    64,
+    61,
+    60,
+    63,
+    59,
+    62,
+    58,
+    165,
+    261,
+    152,
+    162,
+    149,
+    155,
+    306,
+    49,
+    53,
+    52,
+    51,
+    50,
+    54,
+    73,
+    72,
+    69,
+    279,
+    278,
+    166,
+    74,
+    68,
+    67,
+    141,
+    143,
+    142,
+    169,
+    274,
+    264,
+    91,
+    90,
+    147,
+    146,
+    161,
+    160,
+    245,
+    253,
+    252,
+    159,
+    158,
+    144,
+    114,
+    85,
+    113,
+    116,
+    112,
+    118,
+    123,
+    121,
+    120,
+    106,
+    109,
+    105,
+    107,
+    124,
+    194,
+    122,
+    108,
+    183,
+    182,
+    154,
+    219,
+    131,
+    164,
+    151,
+    157,
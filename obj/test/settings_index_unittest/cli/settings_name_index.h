@@ -0,0 +1,260 @@
+// this file is automatically generated by src/utils/settings_name_index.awk, do not edit
+    116,
+    115,
+    118,
+    120,
+    119,
+    117,
+    121,
+    17,
+    13,
+    179,
+    178,
+    14,
+    15,
+    16,
+    55,
+    83,
+    82,
+    84,
+    18,
+    207,
+    176,
+    174,
+    175,
+    151,
+    214,
+    29,
+    36,
+    33,
+    32,
+    31,
+    35,
+    30,
+    34,
+    86,
+    93,
+    111,
+    109,
+    110,
+    60,
+    63,
+    62,
+    59,
+    61,
+    97,
+    126,
+    184,
+    180,
+    181,
+    187,
+    188,
+    185,
+    186,
+    182,
+    183,
+    114,
+    113,
+    54,
+    92,
+    197,
+    201,
+    205,
+    248,
+    247,
+    162,
+    240,
+    169,
+    168,
+    167,
+    166,
+    171,
+    170,
+    245,
+    198,
+    202,
+    206,
+    74,
+    75,
+    79,
+    80,
+    81,
+    77,
+    76,
+    78,
+    177,
+    215,
+    99,
+    49,
+    219,
+    220,
+    221,
+    222,
+    223,
+    85,
+    157,
+    156,
+    153,
+    155,
+    154,
+    160,
+    159,
+    158,
+    161,
+    255,
+    254,
+    256,
+    249,
+    252,
+    251,
+    253,
+    250,
+    152,
+    9,
+    10,
+    12,
+    0,
+    4,
+    3,
+    2,
+    1,
+    6,
+    5,
+    8,
+    7,
+    11,
+    208,
+    211,
+    212,
+    209,
+    224,
+    196,
+    200,
+    204,
+    101,
+    108,
+    107,
+    227,
+    149,
+    148,
+    191,
+    189,
+    190,
+    246,
+    238,
+    235,
+    237,
+    236,
+    232,
+    233,
+    234,
+    230,
+    231,
+    210,
+    216,
+    20,
+    19,
+    21,
+    22,
+    28,
+    27,
+    26,
+    24,
+    23,
+    25,
+    228,
+    50,
+    39,
+    65,
+    37,
+    38,
+    66,
+    64,
+    213,
+    71,
+    70,
+    68,
+    69,
+    257,
+    195,
+    199,
+    203,
+    173,
+    225,
+    165,
+    192,
+    193,
+    134,
+    144,
+    131,
+    137,
+    258,
+    242,
+    241,
+    129,
+    46,
+    47,
+    48,
+    146,
+    226,
+    133,
+    143,
+    130,
+    136,
+    40,
+    44,
+    43,
+    42,
+    41,
+    45,
+    57,
+    56,
+    53,
+    244,
+    243,
+    147,
+    58,
+    52,
+    51,
+    122,
+    124,
+    123,
+    150,
+    239,
+    229,
+    73,
+    72,
+    128,
+    127,
+    142,
+    141,
+    218,
+    217,
+    140,
+    139,
+    125,
+    96,
+    67,
+    95,
+    98,
+    94,
+    100,
+    105,
+    103,
+    102,
+    88,
+    91,
+    87,
+    89,
+    106,
+    172,
+    104,
+    90,
+    164,
+    163,
+    135,
+    194,
+    112,
+    145,
+    132,
+    138,
@@ -49,6 +49,7 @@
 #include "pg/rx.h"
 
 #include "drivers/compass/compass.h"
+#include "drivers/dshot.h"
 #include "drivers/sensor.h"
 #include "drivers/time.h"
 
@@ -87,13 +88,14 @@
 #define DEFAULT_BLACKBOX_DEVICE     BLACKBOX_DEVICE_SERIAL
 #endif
 
-PG_REGISTER_WITH_RESET_TEMPLATE(blackboxConfig_t, blackboxConfig, PG_BLACKBOX_CONFIG, 1);
+PG_REGISTER_WITH_RESET_TEMPLATE(blackboxConfig_t, blackboxConfig, PG_BLACKBOX_CONFIG, 2);
 
 PG_RESET_TEMPLATE(blackboxConfig_t, blackboxConfig,
     .p_ratio = 32,
     .device = DEFAULT_BLACKBOX_DEVICE,
     .record_acc = 1,
-    .mode = BLACKBOX_MODE_NORMAL
+    .mode = BLACKBOX_MODE_NORMAL,
+    .encoding = BLACKBOX_ENCODING_STANDARD
 );
 
 #define BLACKBOX_SHUTDOWN_TIMEOUT_MILLIS 200
@@ -238,10 +240,43 @@ static const blackboxDeltaFieldDefinition_t blackboxMainFields[] = {
     {"motor",       6, UNSIGNED, .Ipredict = PREDICT(MOTOR_0), .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(AVERAGE_2),     .Pencode = ENCODING(SIGNED_VB), CONDITION(AT_LEAST_MOTORS_7)},
     {"motor",       7, UNSIGNED, .Ipredict = PREDICT(MOTOR_0), .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(AVERAGE_2),     .Pencode = ENCODING(SIGNED_VB), CONDITION(AT_LEAST_MOTORS_8)},
 
+    /* Motor speeds from bidirectional DShot telemetry, these change slowly so predict the previous value: */
+    {"eRPM(/100)",  0, UNSIGNED, .Ipredict = PREDICT(0),       .Iencode = ENCODING(UNSIGNED_VB), .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(SIGNED_VB), CONDITION(MOTOR_1_HAS_RPM)},
+    {"eRPM(/100)",  1, UNSIGNED, .Ipredict = PREDICT(0),       .Iencode = ENCODING(UNSIGNED_VB), .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(SIGNED_VB), CONDITION(MOTOR_2_HAS_RPM)},
+    {"eRPM(/100)",  2, UNSIGNED, .Ipredict = PREDICT(0),       .Iencode = ENCODING(UNSIGNED_VB), .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(SIGNED_VB), CONDITION(MOTOR_3_HAS_RPM)},
+    {"eRPM(/100)",  3, UNSIGNED, .Ipredict = PREDICT(0),       .Iencode = ENCODING(UNSIGNED_VB), .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(SIGNED_VB), CONDITION(MOTOR_4_HAS_RPM)},
+    {"eRPM(/100)",  4, UNSIGNED, .Ipredict = PREDICT(0),       .Iencode = ENCODING(UNSIGNED_VB), .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(SIGNED_VB), CONDITION(MOTOR_5_HAS_RPM)},
+    {"eRPM(/100)",  5, UNSIGNED, .Ipredict = PREDICT(0),       .Iencode = ENCODING(UNSIGNED_VB), .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(SIGNED_VB), CONDITION(MOTOR_6_HAS_RPM)},
+    {"eRPM(/100)",  6, UNSIGNED, .Ipredict = PREDICT(0),       .Iencode = ENCODING(UNSIGNED_VB), .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(SIGNED_VB), CONDITION(MOTOR_7_HAS_RPM)},
+    {"eRPM(/100)",  7, UNSIGNED, .Ipredict = PREDICT(0),       .Iencode = ENCODING(UNSIGNED_VB), .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(SIGNED_VB), CONDITION(MOTOR_8_HAS_RPM)},
+
     /* Tricopter tail servo */
     {"servo",       5, UNSIGNED, .Ipredict = PREDICT(1500),    .Iencode = ENCODING(SIGNED_VB),   .Ppredict = PREDICT(PREVIOUS),      .Pencode = ENCODING(SIGNED_VB), CONDITION(TRICOPTER)}
 };
 
+/*
+ * With the high density encoding, P-frames pack these fields into bit-packed groups (one group per field name). Fields
+ * not listed keep the P-frame predictor and encoding given above. Predicting from the previous frame rather than from
+ * the average or the slope of the last two gives the smallest residuals at high logging rates, where the
+ * frame-to-frame change is dominated by the +-1 quantisation of the logged values.
+ */
+static const struct {
+    const char *name;
+    uint8_t Ppredict;
+} blackboxHighDensityPFields[] = {
+    {"time",        PREDICT(STRAIGHT_LINE)},
+    {"axisP",       PREDICT(PREVIOUS)},
+    {"axisI",       PREDICT(PREVIOUS)},
+    {"axisD",       PREDICT(PREVIOUS)},
+    {"axisF",       PREDICT(PREVIOUS)},
+    {"rcCommand",   PREDICT(PREVIOUS)},
+    {"setpoint",    PREDICT(PREVIOUS)},
+    {"gyroADC",     PREDICT(PREVIOUS)},
+    {"accSmooth",   PREDICT(PREVIOUS)},
+    {"debug",       PREDICT(PREVIOUS)},
+    {"motor",       PREDICT(PREVIOUS)},
+};
+
 #ifdef USE_GPS
 // GPS position/vel frame
 static const blackboxConditionalFieldDefinition_t blackboxGpsGFields[] = {
@@ -305,6 +340,9 @@ typedef struct blackboxMainState_s {
     int16_t debug[DEBUG16_VALUE_COUNT];
     int16_t motor[MAX_SUPPORTED_MOTORS];
     int16_t servo[MAX_SUPPORTED_SERVOS];
+#ifdef USE_DSHOT_TELEMETRY
+    uint16_t erpm[MAX_SUPPORTED_MOTORS];
+#endif
 
     uint16_t vbatLatest;
     int32_t amperageLatest;
@@ -373,6 +411,8 @@ STATIC_UNIT_TESTED int16_t blackboxPInterval = 0;
 STATIC_UNIT_TESTED int32_t blackboxSInterval = 0;
 STATIC_UNIT_TESTED int32_t blackboxSlowFrameIterationTimer;
 static bool blackboxLoggedAnyFrames;
+// blackboxConfig()->encoding, latched when the log is started since the headers must agree with the frames
+static uint8_t blackboxEncoding;
 
 /*
  * We store voltages in I-frames relative to this, which was the voltage when the blackbox was activated.
@@ -392,6 +432,71 @@ static blackboxMainState_t* blackboxHistory[3];
 
 static bool blackboxModeActivationConditionPresent = false;
 
+/*
+ * The flight loop only copies the state of each logged iteration into this ring in blackboxCapture(), the predictors,
+ * encoders and device writes run later in blackboxUpdate() from the blackbox task, so logging can't add to the loop
+ * time. head is only written by the flight loop and tail only by the blackbox task, both count snapshots since boot
+ * and are masked on access like spscRing_t.
+ */
+#ifndef BLACKBOX_SNAPSHOT_COUNT
+#if defined(STM32F3) || defined(STM32F411)
+#define BLACKBOX_SNAPSHOT_COUNT 16 // these are short of RAM, a snapshot is ~150 bytes
+#else
+#define BLACKBOX_SNAPSHOT_COUNT 64 // ~8ms at 8kHz logging
+#endif
+#endif
+STATIC_ASSERT((BLACKBOX_SNAPSHOT_COUNT & (BLACKBOX_SNAPSHOT_COUNT - 1)) == 0, blackbox_snapshot_count_not_power_of_two);
+
+// How long the blackbox task may be held off by higher priority tasks before the flight loop has to drop frames
+#define BLACKBOX_SNAPSHOT_HEADROOM_US   8000
+#define BLACKBOX_TASK_MAX_PERIOD_US     1000    // headers, events and the device state machine still want 1kHz
+
+#define BLACKBOX_SNAPSHOT_IFRAME    (1 << 0)
+#define BLACKBOX_SNAPSHOT_SLOW      (1 << 1)    // the next slow snapshot is a slow frame to write before the main frame
+#define BLACKBOX_SNAPSHOT_RESUME    (1 << 2)    // logging resumes at this I-frame after a pause or dropped frames
+
+typedef struct blackboxSnapshot_s {
+    blackboxMainState_t mainState;
+    uint32_t iteration;
+    uint8_t flags;
+} blackboxSnapshot_t;
+
+static blackboxSnapshot_t blackboxSnapshotRing[BLACKBOX_SNAPSHOT_COUNT] __attribute__((aligned(8))); // may be borrowed, see blackboxBorrowSnapshotRing()
+static uint32_t blackboxSnapshotHead;
+static uint32_t blackboxSnapshotTail;
+
+// Slow frames are rare, so they wait in a ring of their own, in the order of the snapshots flagged with them
+#define BLACKBOX_SLOW_SNAPSHOT_COUNT 8
+STATIC_ASSERT((BLACKBOX_SLOW_SNAPSHOT_COUNT & (BLACKBOX_SLOW_SNAPSHOT_COUNT - 1)) == 0, blackbox_slow_snapshot_count_not_power_of_two);
+
+static blackboxSlowState_t blackboxSlowSnapshotRing[BLACKBOX_SLOW_SNAPSHOT_COUNT];
+static uint32_t blackboxSlowSnapshotHead;
+static uint32_t blackboxSlowSnapshotTail;
+// frames lost since the log was started because the blackbox task didn't keep up with the flight loop
+static uint32_t blackboxDroppedFrames;
+// the next frame captured must be an I-frame with a resume event, since frames have been dropped
+static bool blackboxResyncPending;
+STATIC_UNIT_TESTED timeDelta_t blackboxTaskPeriodUs = BLACKBOX_TASK_MAX_PERIOD_US;
+
+/*
+ * Events are queued the same way, since some are logged from the flight loop (e.g. disarming on a crash), and the
+ * blackbox task writes them after the frames that were captured before them.
+ */
+#define BLACKBOX_EVENT_COUNT 8
+STATIC_ASSERT((BLACKBOX_EVENT_COUNT & (BLACKBOX_EVENT_COUNT - 1)) == 0, blackbox_event_count_not_power_of_two);
+
+typedef struct blackboxQueuedEvent_s {
+    flightLogEvent_t event;
+    uint32_t snapshotHead;  // the event is written before the snapshot captured at this head
+} blackboxQueuedEvent_t;
+
+static blackboxQueuedEvent_t blackboxEventRing[BLACKBOX_EVENT_COUNT];
+static uint32_t blackboxEventHead;
+static uint32_t blackboxEventTail;
+#ifdef USE_GPS
+static bool blackboxGpsHomeFrameDue;
+#endif
+
 /**
  * Return true if it is safe to edit the Blackbox configuration.
  */
@@ -400,6 +505,23 @@ bool blackboxMayEditConfig(void)
     return blackboxState <= BLACKBOX_STATE_STOPPED;
 }
 
+/**
+ * The snapshot ring is only used while a log is running, so rare jobs that need a large buffer (e.g. compressing
+ * dataflash reads) may borrow it in between, as long as they are done with it before they return to the scheduler.
+ * Returns NULL if a log is running or the ring is smaller than size.
+ */
+void *blackboxBorrowSnapshotRing(size_t size)
+{
+    if (size > sizeof(blackboxSnapshotRing)
+        || blackboxState == BLACKBOX_STATE_PAUSED
+        || blackboxState == BLACKBOX_STATE_RUNNING
+        || blackboxState == BLACKBOX_STATE_SHUTTING_DOWN) {
+        return NULL;
+    }
+
+    return blackboxSnapshotRing;
+}
+
 static bool blackboxIsOnlyLoggingIntraframes(void)
 {
     return blackboxConfig()->p_ratio == 0;
@@ -424,6 +546,20 @@ static bool testBlackboxConditionUncached(FlightLogFieldCondition condition)
     case FLIGHT_LOG_FIELD_CONDITION_TRICOPTER:
         return mixerConfig()->mixerMode == MIXER_TRI || mixerConfig()->mixerMode == MIXER_CUSTOM_TRI;
 
+    case FLIGHT_LOG_FIELD_CONDITION_MOTOR_1_HAS_RPM:
+    case FLIGHT_LOG_FIELD_CONDITION_MOTOR_2_HAS_RPM:
+    case FLIGHT_LOG_FIELD_CONDITION_MOTOR_3_HAS_RPM:
+    case FLIGHT_LOG_FIELD_CONDITION_MOTOR_4_HAS_RPM:
+    case FLIGHT_LOG_FIELD_CONDITION_MOTOR_5_HAS_RPM:
+    case FLIGHT_LOG_FIELD_CONDITION_MOTOR_6_HAS_RPM:
+    case FLIGHT_LOG_FIELD_CONDITION_MOTOR_7_HAS_RPM:
+    case FLIGHT_LOG_FIELD_CONDITION_MOTOR_8_HAS_RPM:
+#ifdef USE_DSHOT_TELEMETRY
+        return motorConfig()->dev.useDshotTelemetry && getMotorCount() >= condition - FLIGHT_LOG_FIELD_CONDITION_MOTOR_1_HAS_RPM + 1;
+#else
+        return false;
+#endif
+
     case FLIGHT_LOG_FIELD_CONDITION_NONZERO_PID_D_0:
     case FLIGHT_LOG_FIELD_CONDITION_NONZERO_PID_D_1:
     case FLIGHT_LOG_FIELD_CONDITION_NONZERO_PID_D_2:
@@ -525,13 +661,14 @@ static void blackboxSetState(BlackboxState newState)
     blackboxState = newState;
 }
 
-static void writeIntraframe(void)
+static void writeIntraframe(uint32_t iteration)
 {
     blackboxMainState_t *blackboxCurrent = blackboxHistory[0];
 
+    blackboxBeginFrame();
     blackboxWrite('I');
 
-    blackboxWriteUnsignedVB(blackboxIteration);
+    blackboxWriteUnsignedVB(iteration);
     blackboxWriteUnsignedVB(blackboxCurrent->time);
 
     blackboxWriteSignedVBArray(blackboxCurrent->axisPID_P, XYZ_AXIS_COUNT);
@@ -613,11 +750,21 @@ static void writeIntraframe(void)
         blackboxWriteSignedVB(blackboxCurrent->motor[x] - blackboxCurrent->motor[0]);
     }
 
+#ifdef USE_DSHOT_TELEMETRY
+    for (int x = 0; x < motorCount; x++) {
+        if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_MOTOR_1_HAS_RPM + x)) {
+            blackboxWriteUnsignedVB(blackboxCurrent->erpm[x]);
+        }
+    }
+#endif
+
     if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_TRICOPTER)) {
         //Assume the tail spends most of its time around the center
         blackboxWriteSignedVB(blackboxCurrent->servo[5] - 1500);
     }
 
+    blackboxCommitFrame();
+
     //Rotate our history buffers:
 
     //The current state becomes the new "before" state
@@ -644,11 +791,70 @@ static void blackboxWriteMainStateArrayUsingAveragePredictor(int arrOffsetInHist
     }
 }
 
+// Fill 'deltas' with the P-frame deltas of the optional sensor fields that are being logged, and return their count
+static int loadOptionalFieldDeltas(int32_t *deltas)
+{
+    const blackboxMainState_t *blackboxCurrent = blackboxHistory[0];
+    const blackboxMainState_t *blackboxLast = blackboxHistory[1];
+
+    int optionalFieldCount = 0;
+
+    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_VBAT)) {
+        deltas[optionalFieldCount++] = (int32_t) blackboxCurrent->vbatLatest - blackboxLast->vbatLatest;
+    }
+
+    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_AMPERAGE_ADC)) {
+        deltas[optionalFieldCount++] = blackboxCurrent->amperageLatest - blackboxLast->amperageLatest;
+    }
+
+#ifdef USE_MAG
+    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_MAG)) {
+        for (int x = 0; x < XYZ_AXIS_COUNT; x++) {
+            deltas[optionalFieldCount++] = blackboxCurrent->magADC[x] - blackboxLast->magADC[x];
+        }
+    }
+#endif
+
+#ifdef USE_BARO
+    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_BARO)) {
+        deltas[optionalFieldCount++] = blackboxCurrent->BaroAlt - blackboxLast->BaroAlt;
+    }
+#endif
+
+#ifdef USE_RANGEFINDER
+    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_RANGEFINDER)) {
+        deltas[optionalFieldCount++] = blackboxCurrent->surfaceRaw - blackboxLast->surfaceRaw;
+    }
+#endif
+
+    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_RSSI)) {
+        deltas[optionalFieldCount++] = (int32_t) blackboxCurrent->rssi - blackboxLast->rssi;
+    }
+
+    return optionalFieldCount;
+}
+
+static void writeErpmDeltas(const blackboxMainState_t *blackboxCurrent, const blackboxMainState_t *blackboxLast)
+{
+#ifdef USE_DSHOT_TELEMETRY
+    const int motorCount = getMotorCount();
+    for (int x = 0; x < motorCount; x++) {
+        if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_MOTOR_1_HAS_RPM + x)) {
+            blackboxWriteSignedVB((int32_t) blackboxCurrent->erpm[x] - blackboxLast->erpm[x]);
+        }
+    }
+#else
+    UNUSED(blackboxCurrent);
+    UNUSED(blackboxLast);
+#endif
+}
+
 static void writeInterframe(void)
 {
     blackboxMainState_t *blackboxCurrent = blackboxHistory[0];
     blackboxMainState_t *blackboxLast = blackboxHistory[1];
 
+    blackboxBeginFrame();
     blackboxWrite('P');
 
     //No need to store iteration count since its delta is always 1
@@ -698,56 +904,104 @@ static void writeInterframe(void)
     blackboxWriteTag8_4S16(setpointDeltas);
 
     //Check for sensors that are updated periodically (so deltas are normally zero)
-    int optionalFieldCount = 0;
+    const int optionalFieldCount = loadOptionalFieldDeltas(deltas);
+    blackboxWriteTag8_8SVB(deltas, optionalFieldCount);
 
-    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_VBAT)) {
-        deltas[optionalFieldCount++] = (int32_t) blackboxCurrent->vbatLatest - blackboxLast->vbatLatest;
+    //Since gyros, accs and motors are noisy, base their predictions on the average of the history:
+    blackboxWriteMainStateArrayUsingAveragePredictor(offsetof(blackboxMainState_t, gyroADC),   XYZ_AXIS_COUNT);
+    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_ACC)) {
+        blackboxWriteMainStateArrayUsingAveragePredictor(offsetof(blackboxMainState_t, accADC), XYZ_AXIS_COUNT);
     }
+    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_DEBUG)) {
+        blackboxWriteMainStateArrayUsingAveragePredictor(offsetof(blackboxMainState_t, debug), DEBUG16_VALUE_COUNT);
+    }
+    blackboxWriteMainStateArrayUsingAveragePredictor(offsetof(blackboxMainState_t, motor),     getMotorCount());
 
-    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_AMPERAGE_ADC)) {
-        deltas[optionalFieldCount++] = blackboxCurrent->amperageLatest - blackboxLast->amperageLatest;
+    writeErpmDeltas(blackboxCurrent, blackboxLast);
+
+    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_TRICOPTER)) {
+        blackboxWriteSignedVB(blackboxCurrent->servo[5] - blackboxLast->servo[5]);
     }
 
-#ifdef USE_MAG
-    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_MAG)) {
-        for (int x = 0; x < XYZ_AXIS_COUNT; x++) {
-            deltas[optionalFieldCount++] = blackboxCurrent->magADC[x] - blackboxLast->magADC[x];
+    blackboxCommitFrame();
+
+    //Rotate our history buffers
+    blackboxHistory[2] = blackboxHistory[1];
+    blackboxHistory[1] = blackboxHistory[0];
+    blackboxHistory[0] = ((blackboxHistory[0] - blackboxHistoryRing + 1) % 3) + blackboxHistoryRing;
+
+    blackboxLoggedAnyFrames = true;
+}
+
+/*
+ * P-frame for the high density encoding. Fields are written in the same order as writeInterframe(), but each field
+ * group is bit-packed and gyro, accelerometer, debug and motor values are predicted from the previous frame.
+ */
+static void writeHighDensityInterframe(void)
+{
+    blackboxMainState_t *blackboxCurrent = blackboxHistory[0];
+    blackboxMainState_t *blackboxLast = blackboxHistory[1];
+
+    blackboxBeginFrame();
+    blackboxWrite('P');
+
+    int32_t deltas[8];
+
+    deltas[0] = (int32_t) (blackboxHistory[0]->time - 2 * blackboxHistory[1]->time + blackboxHistory[2]->time);
+    blackboxWriteBitPackedGroup(deltas, 1);
+
+    arraySubInt32(deltas, blackboxCurrent->axisPID_P, blackboxLast->axisPID_P, XYZ_AXIS_COUNT);
+    blackboxWriteBitPackedGroup(deltas, XYZ_AXIS_COUNT);
+
+    arraySubInt32(deltas, blackboxCurrent->axisPID_I, blackboxLast->axisPID_I, XYZ_AXIS_COUNT);
+    blackboxWriteBitPackedGroup(deltas, XYZ_AXIS_COUNT);
+
+    int fieldCount = 0;
+    for (int x = 0; x < XYZ_AXIS_COUNT; x++) {
+        if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_NONZERO_PID_D_0 + x)) {
+            deltas[fieldCount++] = blackboxCurrent->axisPID_D[x] - blackboxLast->axisPID_D[x];
         }
     }
-#endif
+    blackboxWriteBitPackedGroup(deltas, fieldCount);
 
-#ifdef USE_BARO
-    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_BARO)) {
-        deltas[optionalFieldCount++] = blackboxCurrent->BaroAlt - blackboxLast->BaroAlt;
-    }
-#endif
+    arraySubInt32(deltas, blackboxCurrent->axisPID_F, blackboxLast->axisPID_F, XYZ_AXIS_COUNT);
+    blackboxWriteBitPackedGroup(deltas, XYZ_AXIS_COUNT);
 
-#ifdef USE_RANGEFINDER
-    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_RANGEFINDER)) {
-        deltas[optionalFieldCount++] = blackboxCurrent->surfaceRaw - blackboxLast->surfaceRaw;
-    }
-#endif
+    arraySubInt16(deltas, blackboxCurrent->rcCommand, blackboxLast->rcCommand, 4);
+    blackboxWriteBitPackedGroup(deltas, 4);
 
-    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_RSSI)) {
-        deltas[optionalFieldCount++] = (int32_t) blackboxCurrent->rssi - blackboxLast->rssi;
-    }
+    arraySubInt16(deltas, blackboxCurrent->setpoint, blackboxLast->setpoint, 4);
+    blackboxWriteBitPackedGroup(deltas, 4);
 
-    blackboxWriteTag8_8SVB(deltas, optionalFieldCount);
+    const int optionalFieldCount = loadOptionalFieldDeltas(deltas);
+    if (optionalFieldCount > 0) {
+        blackboxFlushBits();
+        blackboxWriteTag8_8SVB(deltas, optionalFieldCount);
+    }
 
-    //Since gyros, accs and motors are noisy, base their predictions on the average of the history:
-    blackboxWriteMainStateArrayUsingAveragePredictor(offsetof(blackboxMainState_t, gyroADC),   XYZ_AXIS_COUNT);
+    arraySubInt16(deltas, blackboxCurrent->gyroADC, blackboxLast->gyroADC, XYZ_AXIS_COUNT);
+    blackboxWriteBitPackedGroup(deltas, XYZ_AXIS_COUNT);
     if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_ACC)) {
-        blackboxWriteMainStateArrayUsingAveragePredictor(offsetof(blackboxMainState_t, accADC), XYZ_AXIS_COUNT);
+        arraySubInt16(deltas, blackboxCurrent->accADC, blackboxLast->accADC, XYZ_AXIS_COUNT);
+        blackboxWriteBitPackedGroup(deltas, XYZ_AXIS_COUNT);
     }
     if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_DEBUG)) {
-        blackboxWriteMainStateArrayUsingAveragePredictor(offsetof(blackboxMainState_t, debug), DEBUG16_VALUE_COUNT);
+        arraySubInt16(deltas, blackboxCurrent->debug, blackboxLast->debug, DEBUG16_VALUE_COUNT);
+        blackboxWriteBitPackedGroup(deltas, DEBUG16_VALUE_COUNT);
     }
-    blackboxWriteMainStateArrayUsingAveragePredictor(offsetof(blackboxMainState_t, motor),     getMotorCount());
+    arraySubInt16(deltas, blackboxCurrent->motor, blackboxLast->motor, getMotorCount());
+    blackboxWriteBitPackedGroup(deltas, getMotorCount());
+
+    blackboxFlushBits();
+
+    writeErpmDeltas(blackboxCurrent, blackboxLast);
 
     if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_TRICOPTER)) {
         blackboxWriteSignedVB(blackboxCurrent->servo[5] - blackboxLast->servo[5]);
     }
 
+    blackboxCommitFrame();
+
     //Rotate our history buffers
     blackboxHistory[2] = blackboxHistory[1];
     blackboxHistory[1] = blackboxHistory[0];
@@ -756,26 +1010,27 @@ static void writeInterframe(void)
     blackboxLoggedAnyFrames = true;
 }
 
-/* Write the contents of the global "slowHistory" to the log as an "S" frame. Because this data is logged so
- * infrequently, delta updates are not reasonable, so we log independent frames. */
-static void writeSlowFrame(void)
+/* Write the given slow state to the log as an "S" frame. Because this data is logged so infrequently, delta updates
+ * are not reasonable, so we log independent frames. */
+static void writeSlowFrame(const blackboxSlowState_t *slow)
 {
     int32_t values[3];
 
+    blackboxBeginFrame();
     blackboxWrite('S');
 
-    blackboxWriteUnsignedVB(slowHistory.flightModeFlags);
-    blackboxWriteUnsignedVB(slowHistory.stateFlags);
+    blackboxWriteUnsignedVB(slow->flightModeFlags);
+    blackboxWriteUnsignedVB(slow->stateFlags);
 
     /*
      * Most of the time these three values will be able to pack into one byte for us:
      */
-    values[0] = slowHistory.failsafePhase;
-    values[1] = slowHistory.rxSignalReceived ? 1 : 0;
-    values[2] = slowHistory.rxFlightChannelsValid ? 1 : 0;
+    values[0] = slow->failsafePhase;
+    values[1] = slow->rxSignalReceived ? 1 : 0;
+    values[2] = slow->rxFlightChannelsValid ? 1 : 0;
     blackboxWriteTag2_3S32(values);
 
-    blackboxSlowFrameIterationTimer = 0;
+    blackboxCommitFrame();
 }
 
 /**
@@ -791,10 +1046,11 @@ static void loadSlowState(blackboxSlowState_t *slow)
 }
 
 /**
- * If the data in the slow frame has changed, log a slow frame.
+ * If the data in the slow frame has changed, update the global "slowHistory" and return true so that a slow frame is
+ * logged from it along with the main frame being captured.
  *
- * If allowPeriodicWrite is true, the frame is also logged if it has been more than blackboxSInterval logging iterations
- * since the field was last logged.
+ * The frame is also logged if it has been more than blackboxSInterval logging iterations since the field was last
+ * logged.
  */
 STATIC_UNIT_TESTED bool writeSlowFrameIfNeeded(void)
 {
@@ -817,7 +1073,7 @@ STATIC_UNIT_TESTED bool writeSlowFrameIfNeeded(void)
     }
 
     if (shouldWrite) {
-        writeSlowFrame();
+        blackboxSlowFrameIterationTimer = 0;
     }
     return shouldWrite;
 }
@@ -831,6 +1087,9 @@ void blackboxValidateConfig(void)
 #endif
 #ifdef USE_SDCARD
     case BLACKBOX_DEVICE_SDCARD:
+#endif
+#ifdef USE_BLACKBOX_FILE
+    case BLACKBOX_DEVICE_FILE:
 #endif
     case BLACKBOX_DEVICE_SERIAL:
         // Device supported, leave the setting alone
@@ -879,10 +1138,19 @@ static void blackboxStart(void)
      */
     blackboxBuildConditionCache();
 
+    blackboxEncoding = blackboxConfig()->encoding;
+
     blackboxModeActivationConditionPresent = isModeActivationConditionPresent(BOXBLACKBOX);
 
     blackboxResetIterationTimers();
 
+    // The flight loop doesn't capture while stopped, so anything left over from the last log can be discarded here
+    blackboxSnapshotTail = blackboxSnapshotHead;
+    blackboxSlowSnapshotTail = blackboxSlowSnapshotHead;
+    blackboxEventTail = blackboxEventHead;
+    blackboxDroppedFrames = 0;
+    blackboxResyncPending = false;
+
     /*
      * Record the beeper's current idea of the last arming beep time, so that we can detect it changing when
      * it finally plays the beep for this arming event.
@@ -965,18 +1233,23 @@ static bool inMotorTestMode(void) {
 #ifdef USE_GPS
 static void writeGPSHomeFrame(void)
 {
+    blackboxBeginFrame();
     blackboxWrite('H');
 
     blackboxWriteSignedVB(GPS_home[0]);
     blackboxWriteSignedVB(GPS_home[1]);
     //TODO it'd be great if we could grab the GPS current time and write that too
 
+    blackboxCommitFrame();
+
     gpsHistory.GPS_home[0] = GPS_home[0];
     gpsHistory.GPS_home[1] = GPS_home[1];
+    blackboxGpsHomeFrameDue = false;
 }
 
 static void writeGPSFrame(timeUs_t currentTimeUs)
 {
+    blackboxBeginFrame();
     blackboxWrite('G');
 
     /*
@@ -997,6 +1270,8 @@ static void writeGPSFrame(timeUs_t currentTimeUs)
     blackboxWriteUnsignedVB(gpsSol.groundSpeed);
     blackboxWriteUnsignedVB(gpsSol.groundCourse);
 
+    blackboxCommitFrame();
+
     gpsHistory.GPS_numSat = gpsSol.numSat;
     gpsHistory.GPS_coord[LAT] = gpsSol.llh.lat;
     gpsHistory.GPS_coord[LON] = gpsSol.llh.lon;
@@ -1004,13 +1279,10 @@ static void writeGPSFrame(timeUs_t currentTimeUs)
 #endif
 
 /**
- * Fill the current state of the blackbox using values read from the flight controller
+ * Fill the given state of the blackbox using values read from the flight controller
  */
-static void loadMainState(timeUs_t currentTimeUs)
+static void loadMainState(blackboxMainState_t *blackboxCurrent, timeUs_t currentTimeUs)
 {
-#ifndef UNIT_TEST
-    blackboxMainState_t *blackboxCurrent = blackboxHistory[0];
-
     blackboxCurrent->time = currentTimeUs;
 
     for (int i = 0; i < XYZ_AXIS_COUNT; i++) {
@@ -1045,6 +1317,9 @@ static void loadMainState(timeUs_t currentTimeUs)
     const int motorCount = getMotorCount();
     for (int i = 0; i < motorCount; i++) {
         blackboxCurrent->motor[i] = motor[i];
+#ifdef USE_DSHOT_TELEMETRY
+        blackboxCurrent->erpm[i] = getDshotTelemetry(i);
+#endif
     }
 
     blackboxCurrent->vbatLatest = getBatteryVoltageLatest();
@@ -1065,9 +1340,20 @@ static void loadMainState(timeUs_t currentTimeUs)
     //Tail servo for tricopters
     blackboxCurrent->servo[5] = servo[5];
 #endif
-#else
-    UNUSED(currentTimeUs);
-#endif // UNIT_TEST
+}
+
+// The value of the given integer header for a field, allowing for the P-frame columns used by the high density encoding
+static uint8_t fieldHeaderValue(char deltaFrameChar, const blackboxFieldDefinition_t *def, unsigned headerIndex)
+{
+    if (deltaFrameChar == 'P' && blackboxEncoding == BLACKBOX_ENCODING_HIGH_DENSITY && headerIndex >= BLACKBOX_SIMPLE_FIELD_HEADER_COUNT) {
+        for (unsigned i = 0; i < ARRAYLEN(blackboxHighDensityPFields); i++) {
+            if (strcmp(def->name, blackboxHighDensityPFields[i].name) == 0) {
+                return headerIndex == BLACKBOX_SIMPLE_FIELD_HEADER_COUNT ? blackboxHighDensityPFields[i].Ppredict : ENCODING(BITPACKED);
+            }
+        }
+    }
+
+    return def->arr[headerIndex - 1];
 }
 
 /**
@@ -1170,7 +1456,7 @@ static bool sendFieldDefinition(char mainFrameChar, char deltaFrameChar, const v
                 }
             } else {
                 //The other headers are integers
-                blackboxPrintf("%d", def->arr[xmitState.headerIndex - 1]);
+                blackboxPrintf("%d", fieldHeaderValue(deltaFrameChar, def, xmitState.headerIndex));
             }
         }
     }
@@ -1217,7 +1503,6 @@ STATIC_UNIT_TESTED char *blackboxGetStartDateTime(char *buf)
  */
 static bool blackboxWriteSysinfo(void)
 {
-#ifndef UNIT_TEST
     const uint16_t motorOutputLowInt = lrintf(motorOutputLow);
     const uint16_t motorOutputHighInt = lrintf(motorOutputHigh);
 
@@ -1245,6 +1530,7 @@ static bool blackboxWriteSysinfo(void)
         BLACKBOX_PRINT_HEADER_LINE("I interval", "%d",                      blackboxIInterval);
         BLACKBOX_PRINT_HEADER_LINE("P interval", "%d",                      blackboxPInterval);
         BLACKBOX_PRINT_HEADER_LINE("P ratio", "%d",                         blackboxConfig()->p_ratio);
+        BLACKBOX_PRINT_HEADER_LINE("blackbox_encoding", "%d",               blackboxEncoding);
         BLACKBOX_PRINT_HEADER_LINE("minthrottle", "%d",                     motorConfig()->minthrottle);
         BLACKBOX_PRINT_HEADER_LINE("maxthrottle", "%d",                     motorConfig()->maxthrottle);
         BLACKBOX_PRINT_HEADER_LINE("gyro_scale","0x%x",                     castFloatBytesToInt(1.0f));
@@ -1379,9 +1665,12 @@ static bool blackboxWriteSysinfo(void)
         BLACKBOX_PRINT_HEADER_LINE("dyn_notch_width_percent", "%d",         gyroConfig()->dyn_notch_width_percent);
         BLACKBOX_PRINT_HEADER_LINE("dyn_notch_q", "%d",                     gyroConfig()->dyn_notch_q);
         BLACKBOX_PRINT_HEADER_LINE("dyn_notch_min_hz", "%d",                gyroConfig()->dyn_notch_min_hz);
+        BLACKBOX_PRINT_HEADER_LINE("dyn_notch_estimator", "%d",             gyroConfig()->dyn_notch_estimator);
+        BLACKBOX_PRINT_HEADER_LINE("dyn_notch_count", "%d",                 gyroConfig()->dyn_notch_count);
 #endif
 #ifdef USE_DSHOT_TELEMETRY
         BLACKBOX_PRINT_HEADER_LINE("dshot_bidir", "%d",                     motorConfig()->dev.useDshotTelemetry);
+        BLACKBOX_PRINT_HEADER_LINE("motor_poles", "%d",                     motorConfig()->motorPoleCount);
 #endif
 #ifdef USE_RPM_FILTER
         BLACKBOX_PRINT_HEADER_LINE("gyro_rpm_notch_harmonics", "%d",        rpmFilterConfig()->gyro_rpm_notch_harmonics);
@@ -1434,21 +1723,13 @@ static bool blackboxWriteSysinfo(void)
     }
 
     xmitState.headerIndex++;
-#endif // UNIT_TEST
     return false;
 }
 
-/**
- * Write the given event to the log immediately
- */
-void blackboxLogEvent(FlightLogEvent event, flightLogEventData_t *data)
+static void blackboxWriteEvent(FlightLogEvent event, const flightLogEventData_t *data)
 {
-    // Only allow events to be logged after headers have been written
-    if (!(blackboxState == BLACKBOX_STATE_RUNNING || blackboxState == BLACKBOX_STATE_PAUSED)) {
-        return;
-    }
-
     //Shared header for event frames
+    blackboxBeginFrame();
     blackboxWrite('E');
     blackboxWrite(event);
 
@@ -1484,6 +1765,53 @@ void blackboxLogEvent(FlightLogEvent event, flightLogEventData_t *data)
     default:
         break;
     }
+
+    blackboxCommitFrame();
+}
+
+// Callers pass just the member of flightLogEventData_t for their event, so only that much of it can be copied
+static size_t blackboxEventDataSize(FlightLogEvent event)
+{
+    switch (event) {
+    case FLIGHT_LOG_EVENT_SYNC_BEEP:
+        return sizeof(flightLogEvent_syncBeep_t);
+    case FLIGHT_LOG_EVENT_FLIGHTMODE:
+        return sizeof(flightLogEvent_flightMode_t);
+    case FLIGHT_LOG_EVENT_DISARM:
+        return sizeof(flightLogEvent_disarm_t);
+    case FLIGHT_LOG_EVENT_INFLIGHT_ADJUSTMENT:
+        return sizeof(flightLogEvent_inflightAdjustment_t);
+    case FLIGHT_LOG_EVENT_LOGGING_RESUME:
+        return sizeof(flightLogEvent_loggingResume_t);
+    default:
+        return 0;
+    }
+}
+
+/**
+ * Queue the given event for the blackbox task to write, after any frames the flight loop has already captured
+ */
+void blackboxLogEvent(FlightLogEvent event, flightLogEventData_t *data)
+{
+    // Only allow events to be logged after headers have been written
+    if (!(blackboxState == BLACKBOX_STATE_RUNNING || blackboxState == BLACKBOX_STATE_PAUSED)) {
+        return;
+    }
+
+    const uint32_t head = blackboxEventHead;
+    if (head - __atomic_load_n(&blackboxEventTail, __ATOMIC_ACQUIRE) >= BLACKBOX_EVENT_COUNT) {
+        // The blackbox task hasn't run for long enough that frames are being dropped too
+        return;
+    }
+    blackboxQueuedEvent_t *queued = &blackboxEventRing[head & (BLACKBOX_EVENT_COUNT - 1)];
+
+    queued->event.event = event;
+    if (data) {
+        memcpy(&queued->event.data, data, blackboxEventDataSize(event));
+    }
+    queued->snapshotHead = blackboxSnapshotHead;
+
+    __atomic_store_n(&blackboxEventHead, head + 1, __ATOMIC_RELEASE);
 }
 
 /* If an arming beep has played since it was last logged, write the time of the arming beep to the log as a synchronization point */
@@ -1531,8 +1859,7 @@ STATIC_UNIT_TESTED bool blackboxShouldLogIFrame(void)
 #ifdef USE_GPS
 STATIC_UNIT_TESTED bool blackboxShouldLogGpsHomeFrame(void)
 {
-    if (GPS_home[0] != gpsHistory.GPS_home[0] || GPS_home[1] != gpsHistory.GPS_home[1]
-        || (blackboxPFrameIndex == blackboxIInterval / 2 && blackboxIFrameIndex % 128 == 0)) {
+    if (GPS_home[0] != gpsHistory.GPS_home[0] || GPS_home[1] != gpsHistory.GPS_home[1] || blackboxGpsHomeFrameDue) {
         return true;
     }
     return false;
@@ -1554,56 +1881,192 @@ STATIC_UNIT_TESTED void blackboxAdvanceIterationTimers(void)
     }
 }
 
-// Called once every FC loop in order to log the current state
+// Called once every FC loop in order to capture the current state if a frame is due, the frame is encoded later
 STATIC_UNIT_TESTED void blackboxLogIteration(timeUs_t currentTimeUs)
 {
     // Write a keyframe every blackboxIInterval frames so we can resynchronise upon missing frames
-    if (blackboxShouldLogIFrame()) {
-        /*
-         * Don't log a slow frame if the slow data didn't change ("I" frames are already large enough without adding
-         * an additional item to write at the same time). Unless we're *only* logging "I" frames, then we have no choice.
-         */
-        if (blackboxIsOnlyLoggingIntraframes()) {
-            writeSlowFrameIfNeeded();
+    const bool logIFrame = blackboxShouldLogIFrame();
+
+    if (!logIFrame && !blackboxShouldLogPFrame()) {
+        return;
+    }
+
+    const uint32_t head = blackboxSnapshotHead;
+    const uint32_t slowHead = blackboxSlowSnapshotHead;
+    if ((!logIFrame && blackboxResyncPending)
+        || head - __atomic_load_n(&blackboxSnapshotTail, __ATOMIC_ACQUIRE) >= BLACKBOX_SNAPSHOT_COUNT
+        || slowHead - __atomic_load_n(&blackboxSlowSnapshotTail, __ATOMIC_ACQUIRE) >= BLACKBOX_SLOW_SNAPSHOT_COUNT) {
+        // The blackbox task is behind, so drop this frame. The log restarts from the next I-frame, since the P-frames
+        // before it have nothing to be predicted from, and with a slow frame since a dropped frame may have carried one
+        blackboxDroppedFrames++;
+        blackboxResyncPending = true;
+        blackboxSlowFrameIterationTimer = blackboxSInterval;
+        return;
+    }
+    blackboxSnapshot_t *snapshot = &blackboxSnapshotRing[head & (BLACKBOX_SNAPSHOT_COUNT - 1)];
+
+    snapshot->flags = 0;
+    if (logIFrame) {
+        snapshot->flags |= BLACKBOX_SNAPSHOT_IFRAME;
+        if (blackboxResyncPending) {
+            snapshot->flags |= BLACKBOX_SNAPSHOT_RESUME;
+            blackboxResyncPending = false;
         }
+    }
+
+    /*
+     * Don't log a slow frame with an I-frame if the slow data didn't change ("I" frames are already large enough without
+     * adding an additional item to write at the same time). Unless we're *only* logging "I" frames, then we have no choice.
+     *
+     * We assume that slow frames are only interesting in that they aid the interpretation of the main data stream.
+     * So only log slow frames during loop iterations where we log a main frame.
+     */
+    if ((!logIFrame || blackboxIsOnlyLoggingIntraframes()) && writeSlowFrameIfNeeded()) {
+        blackboxSlowSnapshotRing[slowHead & (BLACKBOX_SLOW_SNAPSHOT_COUNT - 1)] = slowHistory;
+        __atomic_store_n(&blackboxSlowSnapshotHead, slowHead + 1, __ATOMIC_RELEASE);
+        snapshot->flags |= BLACKBOX_SNAPSHOT_SLOW;
+    }
+
+    snapshot->iteration = blackboxIteration;
+    loadMainState(&snapshot->mainState, currentTimeUs);
+
+    __atomic_store_n(&blackboxSnapshotHead, head + 1, __ATOMIC_RELEASE);
+}
+
+// Run the predictors and encoders over a captured frame, using the time and iteration it was captured at
+static void blackboxEncodeSnapshot(const blackboxSnapshot_t *snapshot)
+{
+    if (snapshot->flags & BLACKBOX_SNAPSHOT_RESUME) {
+        // Write a log entry so the decoder is aware that our large time/iteration skip is intended
+        flightLogEvent_loggingResume_t resume;
+
+        resume.logIteration = snapshot->iteration;
+        resume.currentTime = snapshot->mainState.time;
+
+        blackboxWriteEvent(FLIGHT_LOG_EVENT_LOGGING_RESUME, (flightLogEventData_t *) &resume);
+    }
 
-        loadMainState(currentTimeUs);
-        writeIntraframe();
+    if (snapshot->flags & BLACKBOX_SNAPSHOT_SLOW) {
+        // the slow snapshot is published before the snapshot flagged with it
+        writeSlowFrame(&blackboxSlowSnapshotRing[blackboxSlowSnapshotTail & (BLACKBOX_SLOW_SNAPSHOT_COUNT - 1)]);
+        __atomic_store_n(&blackboxSlowSnapshotTail, blackboxSlowSnapshotTail + 1, __ATOMIC_RELEASE);
+    }
+
+    *blackboxHistory[0] = snapshot->mainState;
+    if (snapshot->flags & BLACKBOX_SNAPSHOT_IFRAME) {
+#ifdef USE_GPS
+        // Every 128 I-frames
+        if ((snapshot->iteration / blackboxIInterval) % 128 == 0) {
+            blackboxGpsHomeFrameDue = true;
+        }
+#endif
+        writeIntraframe(snapshot->iteration);
+    } else if (blackboxEncoding == BLACKBOX_ENCODING_HIGH_DENSITY) {
+        writeHighDensityInterframe();
     } else {
-        blackboxCheckAndLogArmingBeep();
-        blackboxCheckAndLogFlightMode(); // Check for FlightMode status change event
+        writeInterframe();
+    }
+}
 
-        if (blackboxShouldLogPFrame()) {
-            /*
-             * We assume that slow frames are only interesting in that they aid the interpretation of the main data stream.
-             * So only log slow frames during loop iterations where we log a main frame.
-             */
-            writeSlowFrameIfNeeded();
+// Write the queued events that were logged before the snapshot at snapshotTail was captured
+static void blackboxWriteQueuedEvents(uint32_t eventHead, uint32_t snapshotTail)
+{
+    uint32_t tail = blackboxEventTail;
 
-            loadMainState(currentTimeUs);
-            writeInterframe();
+    while (tail != eventHead) {
+        const blackboxQueuedEvent_t *queued = &blackboxEventRing[tail & (BLACKBOX_EVENT_COUNT - 1)];
+        if ((int32_t)(queued->snapshotHead - snapshotTail) > 0) {
+            break;
         }
+        blackboxWriteEvent(queued->event.event, &queued->event.data);
+        tail++;
+        __atomic_store_n(&blackboxEventTail, tail, __ATOMIC_RELEASE);
+    }
+}
+
+// Write the captured frames and the queued events in the order the flight loop and the other tasks logged them
+static void blackboxEncodeSnapshots(void)
+{
+    const uint32_t head = __atomic_load_n(&blackboxSnapshotHead, __ATOMIC_ACQUIRE);
+    const uint32_t eventHead = __atomic_load_n(&blackboxEventHead, __ATOMIC_ACQUIRE);
+    uint32_t tail = blackboxSnapshotTail;
+
+    blackboxWriteQueuedEvents(eventHead, tail);
+    while (tail != head) {
+        blackboxEncodeSnapshot(&blackboxSnapshotRing[tail & (BLACKBOX_SNAPSHOT_COUNT - 1)]);
+        tail++;
+        __atomic_store_n(&blackboxSnapshotTail, tail, __ATOMIC_RELEASE);
+        blackboxWriteQueuedEvents(eventHead, tail);
+    }
+}
+
+// Called from the blackbox task to write the frames captured since it last ran
+static void blackboxLogCapturedFrames(timeUs_t currentTimeUs)
+{
+    // These events are queued behind the frames captured so far, so they're written after them
+    blackboxCheckAndLogArmingBeep();
+    blackboxCheckAndLogFlightMode(); // Check for FlightMode status change event
+
+    blackboxEncodeSnapshots();
+
 #ifdef USE_GPS
-        if (featureIsEnabled(FEATURE_GPS)) {
-            if (blackboxShouldLogGpsHomeFrame()) {
-                writeGPSHomeFrame();
-                writeGPSFrame(currentTimeUs);
-            } else if (gpsSol.numSat != gpsHistory.GPS_numSat
-                    || gpsSol.llh.lat != gpsHistory.GPS_coord[LAT]
-                    || gpsSol.llh.lon != gpsHistory.GPS_coord[LON]) {
-                //We could check for velocity changes as well but I doubt it changes independent of position
-                writeGPSFrame(currentTimeUs);
-            }
+    // GPS frames are written relative to the last main frame, so there must be one
+    if (featureIsEnabled(FEATURE_GPS) && blackboxLoggedAnyFrames) {
+        if (blackboxShouldLogGpsHomeFrame()) {
+            writeGPSHomeFrame();
+            writeGPSFrame(currentTimeUs);
+        } else if (gpsSol.numSat != gpsHistory.GPS_numSat
+                || gpsSol.llh.lat != gpsHistory.GPS_coord[LAT]
+                || gpsSol.llh.lon != gpsHistory.GPS_coord[LON]) {
+            //We could check for velocity changes as well but I doubt it changes independent of position
+            writeGPSFrame(currentTimeUs);
         }
+    }
+#else
+    UNUSED(currentTimeUs);
 #endif
+}
+
+/**
+ * Call each flight loop iteration to capture the flight controller state for blackbox logging. Only a copy of the
+ * state is made here, it is encoded and written by blackboxUpdate().
+ */
+void blackboxCapture(timeUs_t currentTimeUs)
+{
+    switch (blackboxState) {
+    case BLACKBOX_STATE_PAUSED:
+        // Only allow resume to occur during an I-frame iteration, so that we have an "I" base to work from
+        if (IS_RC_MODE_ACTIVE(BOXBLACKBOX) && blackboxShouldLogIFrame()) {
+            blackboxResyncPending = true;
+            blackboxSetState(BLACKBOX_STATE_RUNNING);
+
+            blackboxLogIteration(currentTimeUs);
+        }
+        // Keep the logging timers ticking so our log iteration continues to advance
+        blackboxAdvanceIterationTimers();
+        break;
+    case BLACKBOX_STATE_RUNNING:
+        // On entry to this state, blackboxIteration, blackboxPFrameIndex and blackboxIFrameIndex are reset to 0
+        // Prevent the Pausing of the log on the mode switch if in Motor Test Mode
+        if (blackboxModeActivationConditionPresent && !IS_RC_MODE_ACTIVE(BOXBLACKBOX) && !startedLoggingInTestMode) {
+            blackboxSetState(BLACKBOX_STATE_PAUSED);
+        } else {
+            blackboxLogIteration(currentTimeUs);
+        }
+        blackboxAdvanceIterationTimers();
+        break;
+    default:
+        break;
     }
+}
 
-    //Flush every iteration so that our runtime variance is minimized
-    blackboxDeviceFlush();
+uint32_t blackboxGetDroppedFrameCount(void)
+{
+    return blackboxDroppedFrames;
 }
 
 /**
- * Call each flight loop iteration to perform blackbox logging.
+ * Call from the blackbox task to run the logging state machine and write the frames captured by blackboxCapture().
  */
 void blackboxUpdate(timeUs_t currentTimeUs)
 {
@@ -1700,34 +2163,19 @@ void blackboxUpdate(timeUs_t currentTimeUs)
         }
         break;
     case BLACKBOX_STATE_PAUSED:
-        // Only allow resume to occur during an I-frame iteration, so that we have an "I" base to work from
-        if (IS_RC_MODE_ACTIVE(BOXBLACKBOX) && blackboxShouldLogIFrame()) {
-            // Write a log entry so the decoder is aware that our large time/iteration skip is intended
-            flightLogEvent_loggingResume_t resume;
-
-            resume.logIteration = blackboxIteration;
-            resume.currentTime = currentTimeUs;
-
-            blackboxLogEvent(FLIGHT_LOG_EVENT_LOGGING_RESUME, (flightLogEventData_t *) &resume);
-            blackboxSetState(BLACKBOX_STATE_RUNNING);
-
-            blackboxLogIteration(currentTimeUs);
-        }
-        // Keep the logging timers ticking so our log iteration continues to advance
-        blackboxAdvanceIterationTimers();
+        // Write out whatever was captured before the flight loop paused the log
+        blackboxEncodeSnapshots();
+        //Flush every iteration so that our runtime variance is minimized
+        blackboxDeviceFlush();
         break;
     case BLACKBOX_STATE_RUNNING:
-        // On entry to this state, blackboxIteration, blackboxPFrameIndex and blackboxIFrameIndex are reset to 0
-        // Prevent the Pausing of the log on the mode switch if in Motor Test Mode
-        if (blackboxModeActivationConditionPresent && !IS_RC_MODE_ACTIVE(BOXBLACKBOX) && !startedLoggingInTestMode) {
-            blackboxSetState(BLACKBOX_STATE_PAUSED);
-        } else {
-            blackboxLogIteration(currentTimeUs);
-        }
-        blackboxAdvanceIterationTimers();
+        blackboxLogCapturedFrames(currentTimeUs);
+        blackboxDeviceFlush();
         break;
     case BLACKBOX_STATE_SHUTTING_DOWN:
         //On entry of this state, startTime is set
+        // Write out whatever was captured and queued before the log was finished, ending with the log end event
+        blackboxEncodeSnapshots();
         /*
          * Wait for the log we've transmitted to make its way to the logger before we release the serial port,
          * since releasing the port clears the Tx buffer.
@@ -1816,6 +2264,11 @@ uint8_t blackboxGetRateDenom(void)
 
 }
 
+timeDelta_t blackboxGetTaskPeriodUs(void)
+{
+    return blackboxTaskPeriodUs;
+}
+
 /**
  * Call during system startup to initialize the blackbox.
  */
@@ -1824,7 +2277,7 @@ void blackboxInit(void)
     blackboxResetIterationTimers();
 
     // an I-frame is written every 32ms
-    // blackboxUpdate() is run in synchronisation with the PID loop
+    // blackboxCapture() is run in synchronisation with the PID loop
     // targetPidLooptime is 1000 for 1kHz loop, 500 for 2kHz loop etc, targetPidLooptime is rounded for short looptimes
     blackboxIInterval = (uint16_t)(32 * 1000 / targetPidLooptime);
 
@@ -1837,6 +2290,14 @@ void blackboxInit(void)
     } else {
         blackboxPInterval = blackboxIInterval /  blackboxConfig()->p_ratio;
     }
+
+    // A captured frame waits up to a task period, plus however long the task is held off, before it is encoded. So the
+    // task runs often enough to leave BLACKBOX_SNAPSHOT_HEADROOM_US of the ring free at the logging rate, but no more
+    // often than frames are captured
+    const timeDelta_t frameIntervalUs = targetPidLooptime * (blackboxPInterval ? blackboxPInterval : blackboxIInterval);
+    blackboxTaskPeriodUs = constrain(BLACKBOX_SNAPSHOT_COUNT * frameIntervalUs - BLACKBOX_SNAPSHOT_HEADROOM_US,
+        MIN(frameIntervalUs, BLACKBOX_TASK_MAX_PERIOD_US), BLACKBOX_TASK_MAX_PERIOD_US);
+
     if (blackboxConfig()->device) {
         blackboxSetState(BLACKBOX_STATE_STOPPED);
     } else {
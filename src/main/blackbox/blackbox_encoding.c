@@ -32,6 +32,7 @@
 #include "blackbox_io.h"
 
 #include "common/encoding.h"
+#include "common/maths.h"
 #include "common/printf.h"
 
 
@@ -493,6 +494,68 @@ void blackboxWriteTag8_8SVB(int32_t *values, int valueCount)
     }
 }
 
+/*
+ * Bit-packed groups are used by the high density encoding. Each group starts with a 5-bit header giving the bit width
+ * of the largest zigzag-encoded value in the group, then every value follows at that width. A header of 31 stands for
+ * 32 bits, since 31-bit values are written at full width.
+ *
+ * Consecutive groups share one bit stream, written most significant bit first. Call blackboxFlushBits() to pad the
+ * stream out to a byte boundary before writing any byte-aligned field, and at the end of the frame.
+ *
+ * Three deltas in the range -4...3 take 14 bits this way, where signed VB needs 3 bytes.
+ */
+static uint8_t blackboxBitBuffer;
+static uint8_t blackboxBitBufferCount;
+
+static void blackboxWriteBits(uint32_t value, int bitCount)
+{
+    while (bitCount > 0) {
+        const int chunk = MIN(bitCount, 8 - blackboxBitBufferCount);
+
+        bitCount -= chunk;
+        blackboxBitBuffer = (blackboxBitBuffer << chunk) | ((value >> bitCount) & ((1 << chunk) - 1));
+        blackboxBitBufferCount += chunk;
+
+        if (blackboxBitBufferCount == 8) {
+            blackboxWrite(blackboxBitBuffer);
+            blackboxBitBuffer = 0;
+            blackboxBitBufferCount = 0;
+        }
+    }
+}
+
+void blackboxWriteBitPackedGroup(int32_t *values, int valueCount)
+{
+    if (valueCount <= 0) {
+        return;
+    }
+
+    uint32_t allBits = 0;
+    for (int i = 0; i < valueCount; i++) {
+        allBits |= zigzagEncode(values[i]);
+    }
+
+    int width = allBits ? 32 - __builtin_clz(allBits) : 0;
+    if (width == 31) {
+        width = 32;
+    }
+
+    blackboxWriteBits(MIN(width, 31), 5);
+
+    for (int i = 0; i < valueCount; i++) {
+        blackboxWriteBits(zigzagEncode(values[i]), width);
+    }
+}
+
+void blackboxFlushBits(void)
+{
+    if (blackboxBitBufferCount > 0) {
+        blackboxWrite(blackboxBitBuffer << (8 - blackboxBitBufferCount));
+        blackboxBitBuffer = 0;
+        blackboxBitBufferCount = 0;
+    }
+}
+
 /** Write unsigned integer **/
 void blackboxWriteU32(int32_t value)
 {
@@ -32,6 +32,15 @@ typedef enum FlightLogFieldCondition {
     FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_8,
     FLIGHT_LOG_FIELD_CONDITION_TRICOPTER,
 
+    FLIGHT_LOG_FIELD_CONDITION_MOTOR_1_HAS_RPM,
+    FLIGHT_LOG_FIELD_CONDITION_MOTOR_2_HAS_RPM,
+    FLIGHT_LOG_FIELD_CONDITION_MOTOR_3_HAS_RPM,
+    FLIGHT_LOG_FIELD_CONDITION_MOTOR_4_HAS_RPM,
+    FLIGHT_LOG_FIELD_CONDITION_MOTOR_5_HAS_RPM,
+    FLIGHT_LOG_FIELD_CONDITION_MOTOR_6_HAS_RPM,
+    FLIGHT_LOG_FIELD_CONDITION_MOTOR_7_HAS_RPM,
+    FLIGHT_LOG_FIELD_CONDITION_MOTOR_8_HAS_RPM,
+
     FLIGHT_LOG_FIELD_CONDITION_MAG,
     FLIGHT_LOG_FIELD_CONDITION_BARO,
     FLIGHT_LOG_FIELD_CONDITION_VBAT,
@@ -101,7 +110,8 @@ typedef enum FlightLogFieldEncoding {
     FLIGHT_LOG_FIELD_ENCODING_TAG2_3S32       = 7,
     FLIGHT_LOG_FIELD_ENCODING_TAG8_4S16       = 8,
     FLIGHT_LOG_FIELD_ENCODING_NULL            = 9, // Nothing is written to the file, take value to be zero
-    FLIGHT_LOG_FIELD_ENCODING_TAG2_3SVARIABLE = 10
+    FLIGHT_LOG_FIELD_ENCODING_TAG2_3SVARIABLE = 10,
+    FLIGHT_LOG_FIELD_ENCODING_BITPACKED       = 11  // Bit-packed groups with a shared width, see blackboxWriteBitPackedGroup()
 } FlightLogFieldEncoding;
 
 typedef enum FlightLogFieldSign {
@@ -0,0 +1,209 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "platform.h"
+
+#ifdef USE_BLACKBOX_FILE
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "common/maths.h"
+#include "common/utils.h"
+
+#include "blackbox_file.h"
+
+#define LOGFILE_DIRECTORY       "logs"
+#define LOGFILE_PREFIX          "LOG"
+#define LOGFILE_SUFFIX          ".BFL"
+
+// the file is grown by its current size, between these limits, so remapping is rare even at full logging rate
+#define LOGFILE_MIN_GROWTH      (4 * 1024 * 1024)
+#define LOGFILE_MAX_GROWTH      (256 * 1024 * 1024)
+
+static struct {
+    int fd;
+    uint8_t *map;
+    size_t mapSize;
+    size_t length;
+    int32_t largestLogFileNumber;
+    char filename[sizeof(LOGFILE_DIRECTORY "/" LOGFILE_PREFIX "00000" LOGFILE_SUFFIX)];
+    bool full;
+} blackboxFile = { .fd = -1 };
+
+static int32_t blackboxFileFindLargestLogNumber(void)
+{
+    int32_t largest = 0;
+
+    DIR *directory = opendir(LOGFILE_DIRECTORY);
+    if (!directory) {
+        return largest;
+    }
+
+    const struct dirent *entry;
+    while ((entry = readdir(directory))) {
+        const char *name = entry->d_name;
+        if (strlen(name) == strlen(LOGFILE_PREFIX "00000" LOGFILE_SUFFIX)
+            && strncmp(name, LOGFILE_PREFIX, strlen(LOGFILE_PREFIX)) == 0
+            && strcmp(name + strlen(LOGFILE_PREFIX) + 5, LOGFILE_SUFFIX) == 0) {
+            largest = MAX((int32_t)atoi(name + strlen(LOGFILE_PREFIX)), largest);
+        }
+    }
+    closedir(directory);
+
+    return largest;
+}
+
+// Resizes the file and its mapping to hold at least 'size' bytes
+static bool blackboxFileReserve(size_t size)
+{
+    if (size <= blackboxFile.mapSize) {
+        return true;
+    }
+
+    const size_t growth = constrain(blackboxFile.mapSize, LOGFILE_MIN_GROWTH, LOGFILE_MAX_GROWTH);
+    const size_t newSize = MAX(blackboxFile.mapSize + growth, size);
+
+    if (ftruncate(blackboxFile.fd, newSize) < 0) {
+        return false;
+    }
+
+    uint8_t *map;
+    if (blackboxFile.map) {
+        map = mremap(blackboxFile.map, blackboxFile.mapSize, newSize, MREMAP_MAYMOVE);
+    } else {
+        map = mmap(NULL, newSize, PROT_READ | PROT_WRITE, MAP_SHARED, blackboxFile.fd, 0);
+    }
+    if (map == MAP_FAILED) {
+        return false;
+    }
+
+    blackboxFile.map = map;
+    blackboxFile.mapSize = newSize;
+    return true;
+}
+
+bool blackboxFileOpen(void)
+{
+    // a full or failed log only ends that log, the next one gets a new file
+    return true;
+}
+
+bool blackboxFileBeginLog(void)
+{
+    if (blackboxFile.fd >= 0) {
+        return true;
+    }
+
+    blackboxFile.full = false;
+
+    mkdir(LOGFILE_DIRECTORY, 0755);
+    blackboxFile.largestLogFileNumber = blackboxFileFindLargestLogNumber();
+
+    snprintf(blackboxFile.filename, sizeof(blackboxFile.filename), LOGFILE_DIRECTORY "/" LOGFILE_PREFIX "%05u" LOGFILE_SUFFIX,
+        (unsigned)(blackboxFile.largestLogFileNumber + 1) % 100000);
+
+    blackboxFile.fd = open(blackboxFile.filename, O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (blackboxFile.fd < 0) {
+        fprintf(stderr, "[BLACKBOX] can't create %s\n", blackboxFile.filename);
+        blackboxFile.full = true;
+        // nothing will be written, let the caller go on to end the log
+        return true;
+    }
+
+    blackboxFile.map = NULL;
+    blackboxFile.mapSize = 0;
+    blackboxFile.length = 0;
+    blackboxFile.full = !blackboxFileReserve(LOGFILE_MIN_GROWTH);
+    blackboxFile.largestLogFileNumber++;
+    fprintf(stderr, "[BLACKBOX] logging to %s\n", blackboxFile.filename);
+
+    return true;
+}
+
+bool blackboxFileEndLog(bool retainLog)
+{
+    if (blackboxFile.fd < 0) {
+        return true;
+    }
+
+    if (blackboxFile.map) {
+        munmap(blackboxFile.map, blackboxFile.mapSize);
+        blackboxFile.map = NULL;
+        blackboxFile.mapSize = 0;
+    }
+    // drop the unused part of the last growth step
+    const int ret = ftruncate(blackboxFile.fd, blackboxFile.length);
+    UNUSED(ret);
+    close(blackboxFile.fd);
+    blackboxFile.fd = -1;
+
+    if (!retainLog) {
+        unlink(blackboxFile.filename);
+        blackboxFile.largestLogFileNumber--;
+    }
+
+    return true;
+}
+
+void blackboxFileWrite(const uint8_t *data, int len)
+{
+    if (blackboxFile.fd < 0 || blackboxFile.full) {
+        return;
+    }
+
+    if (!blackboxFileReserve(blackboxFile.length + len)) {
+        fprintf(stderr, "[BLACKBOX] can't grow %s past %u bytes\n", blackboxFile.filename, (unsigned)blackboxFile.mapSize);
+        blackboxFile.full = true;
+        // logging stops here, keep what was written
+        const int ret = ftruncate(blackboxFile.fd, blackboxFile.length);
+        UNUSED(ret);
+        return;
+    }
+
+    memcpy(blackboxFile.map + blackboxFile.length, data, len);
+    blackboxFile.length += len;
+}
+
+bool blackboxFileIsFull(void)
+{
+    return blackboxFile.full;
+}
+
+bool blackboxFileIsWorking(void)
+{
+    return !blackboxFile.full;
+}
+
+int32_t blackboxFileGetLogNumber(void)
+{
+    return blackboxFile.largestLogFileNumber;
+}
+
+#endif // USE_BLACKBOX_FILE
@@ -0,0 +1,38 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * Blackbox device for hosted builds (SITL): every log goes to its own file, logs/LOGxxxxx.BFL, numbered after the
+ * largest log already in the directory like on an SD card. The file is memory mapped and grown in large steps, so a
+ * frame is written with a memcpy and logging never has to wait for the disk or drop data.
+ */
+
+bool blackboxFileOpen(void);
+bool blackboxFileBeginLog(void);
+bool blackboxFileEndLog(bool retainLog);
+void blackboxFileWrite(const uint8_t *data, int len);
+bool blackboxFileIsFull(void);
+bool blackboxFileIsWorking(void);
+int32_t blackboxFileGetLogNumber(void);
@@ -59,6 +59,10 @@
 #include "drivers/sdcard.h"
 #endif
 
+#ifdef USE_BLACKBOX_FILE
+#include "blackbox_file.h"
+#endif
+
 #define BLACKBOX_SERIAL_PORT_MODE MODE_TX
 
 // How many bytes can we transmit per loop iteration when writing headers?
@@ -108,21 +112,32 @@ static uint16_t bbRateMax;
 static uint32_t bbDrops;
 #endif
 
-void blackboxWrite(uint8_t value)
+// Staging buffer for the frame currently being encoded, see blackboxBeginFrame()
+static uint8_t blackboxFrameBuffer[BLACKBOX_MAX_FRAME_SIZE];
+static int blackboxFrameBufferPos;
+static bool blackboxFrameOpen;
+
+// Hand 'len' bytes to the blackbox device in one write. On serial the data is dropped whole if it doesn't fit.
+static void blackboxDeviceWrite(const uint8_t *data, int len)
 {
 #ifdef DEBUG_BB_OUTPUT
-    bbBits += 8;
+    bbBits += len * 8;
 #endif
 
     switch (blackboxConfig()->device) {
 #ifdef USE_FLASHFS
     case BLACKBOX_DEVICE_FLASH:
-        flashfsWriteByte(value); // Write byte asynchronously
+        flashfsWrite(data, len, false); // Write asynchronously
         break;
 #endif
 #ifdef USE_SDCARD
     case BLACKBOX_DEVICE_SDCARD:
-        afatfs_fputc(blackboxSDCard.logFile, value);
+        afatfs_fwrite(blackboxSDCard.logFile, data, len); // Ignore failures due to buffers filling up
+        break;
+#endif
+#ifdef USE_BLACKBOX_FILE
+    case BLACKBOX_DEVICE_FILE:
+        blackboxFileWrite(data, len);
         break;
 #endif
     case BLACKBOX_DEVICE_SERIAL:
@@ -131,18 +146,18 @@ void blackboxWrite(uint8_t value)
             int txBytesFree = serialTxBytesFree(blackboxPort);
 
 #ifdef DEBUG_BB_OUTPUT
-            bbBits += 2;
+            bbBits += len * 2;
             DEBUG_SET(DEBUG_BLACKBOX_OUTPUT, 3, txBytesFree);
 #endif
 
-            if (txBytesFree == 0) {
+            if (txBytesFree < len) {
 #ifdef DEBUG_BB_OUTPUT
-                ++bbDrops;
+                bbDrops += len;
                 DEBUG_SET(DEBUG_BLACKBOX_OUTPUT, 2, bbDrops);
 #endif
                 return;
             }
-            serialWrite(blackboxPort, value);
+            serialWriteBuf(blackboxPort, data, len);
         }
         break;
     }
@@ -163,38 +178,49 @@ void blackboxWrite(uint8_t value)
 #endif
 }
 
-// Print the null-terminated string 's' to the blackbox device and return the number of bytes written
-int blackboxWriteString(const char *s)
+/*
+ * Start staging a log frame. Everything written until blackboxCommitFrame() is collected in memory and reaches the
+ * device in a single write, so a frame that can't be buffered by the device is dropped whole instead of torn.
+ */
+void blackboxBeginFrame(void)
 {
-    int length;
-    const uint8_t *pos;
+    blackboxFrameBufferPos = 0;
+    blackboxFrameOpen = true;
+}
 
-    switch (blackboxConfig()->device) {
+void blackboxCommitFrame(void)
+{
+    blackboxFrameOpen = false;
+    if (blackboxFrameBufferPos > 0) {
+        blackboxDeviceWrite(blackboxFrameBuffer, blackboxFrameBufferPos);
+    }
+}
 
-#ifdef USE_FLASHFS
-    case BLACKBOX_DEVICE_FLASH:
-        length = strlen(s);
-        flashfsWrite((const uint8_t*) s, length, false); // Write asynchronously
-        break;
-#endif // USE_FLASHFS
+void blackboxWrite(uint8_t value)
+{
+    if (blackboxFrameOpen) {
+        if (blackboxFrameBufferPos == BLACKBOX_MAX_FRAME_SIZE) {
+            // Oversized frame, pass the part we have through to the device rather than lose it
+            blackboxDeviceWrite(blackboxFrameBuffer, blackboxFrameBufferPos);
+            blackboxFrameBufferPos = 0;
+        }
+        blackboxFrameBuffer[blackboxFrameBufferPos++] = value;
+    } else {
+        blackboxDeviceWrite(&value, 1);
+    }
+}
 
-#ifdef USE_SDCARD
-    case BLACKBOX_DEVICE_SDCARD:
-        length = strlen(s);
-        afatfs_fwrite(blackboxSDCard.logFile, (const uint8_t*) s, length); // Ignore failures due to buffers filling up
-        break;
-#endif // USE_SDCARD
+// Print the null-terminated string 's' to the blackbox device and return the number of bytes written
+int blackboxWriteString(const char *s)
+{
+    const int length = strlen(s);
 
-    case BLACKBOX_DEVICE_SERIAL:
-    default:
-        pos = (uint8_t*) s;
-        while (*pos) {
-            blackboxWrite(*pos);
-            pos++;
+    if (blackboxFrameOpen) {
+        for (int i = 0; i < length; i++) {
+            blackboxWrite(s[i]);
         }
-
-        length = pos - (uint8_t*) s;
-        break;
+    } else {
+        blackboxDeviceWrite((const uint8_t *)s, length);
     }
 
     return length;
@@ -248,6 +274,12 @@ bool blackboxDeviceFlushForce(void)
         return afatfs_flush();
 #endif // USE_SDCARD
 
+#ifdef USE_BLACKBOX_FILE
+    case BLACKBOX_DEVICE_FILE:
+        // Written through to the file as soon as it is logged
+        return true;
+#endif // USE_BLACKBOX_FILE
+
     default:
         return false;
     }
@@ -339,6 +371,13 @@ bool blackboxDeviceOpen(void)
         return true;
         break;
 #endif // USE_SDCARD
+#ifdef USE_BLACKBOX_FILE
+    case BLACKBOX_DEVICE_FILE:
+        blackboxMaxHeaderBytesPerIteration = BLACKBOX_TARGET_HEADER_BUDGET_PER_ITERATION;
+
+        return blackboxFileOpen();
+        break;
+#endif // USE_BLACKBOX_FILE
     default:
         return false;
     }
@@ -538,6 +577,10 @@ bool blackboxDeviceBeginLog(void)
     case BLACKBOX_DEVICE_SDCARD:
         return blackboxSDCardBeginLog();
 #endif // USE_SDCARD
+#ifdef USE_BLACKBOX_FILE
+    case BLACKBOX_DEVICE_FILE:
+        return blackboxFileBeginLog();
+#endif // USE_BLACKBOX_FILE
     default:
         return true;
     }
@@ -553,7 +596,7 @@ bool blackboxDeviceBeginLog(void)
  */
 bool blackboxDeviceEndLog(bool retainLog)
 {
-#ifndef USE_SDCARD
+#if !defined(USE_SDCARD) && !defined(USE_BLACKBOX_FILE)
     UNUSED(retainLog);
 #endif
 
@@ -572,6 +615,10 @@ bool blackboxDeviceEndLog(bool retainLog)
         }
         return false;
 #endif // USE_SDCARD
+#ifdef USE_BLACKBOX_FILE
+    case BLACKBOX_DEVICE_FILE:
+        return blackboxFileEndLog(retainLog);
+#endif // USE_BLACKBOX_FILE
     default:
         return true;
     }
@@ -593,6 +640,11 @@ bool isBlackboxDeviceFull(void)
         return afatfs_isFull();
 #endif // USE_SDCARD
 
+#ifdef USE_BLACKBOX_FILE
+    case BLACKBOX_DEVICE_FILE:
+        return blackboxFileIsFull();
+#endif // USE_BLACKBOX_FILE
+
     default:
         return false;
     }
@@ -614,6 +666,11 @@ bool isBlackboxDeviceWorking(void)
         return flashfsIsReady();
 #endif
 
+#ifdef USE_BLACKBOX_FILE
+    case BLACKBOX_DEVICE_FILE:
+        return blackboxFileIsWorking();
+#endif
+
     default:
         return false;
     }
@@ -626,6 +683,10 @@ int32_t blackboxGetLogNumber(void)
     case BLACKBOX_DEVICE_SDCARD:
         return blackboxSDCard.largestLogFileNumber;
 #endif
+#ifdef USE_BLACKBOX_FILE
+    case BLACKBOX_DEVICE_FILE:
+        return blackboxFileGetLogNumber();
+#endif
 
     default:
         return -1;
@@ -653,6 +714,12 @@ void blackboxReplenishHeaderBudget(void)
     case BLACKBOX_DEVICE_SDCARD:
         freeSpace = afatfs_getFreeBufferSpace();
         break;
+#endif
+#ifdef USE_BLACKBOX_FILE
+    case BLACKBOX_DEVICE_FILE:
+        // The file grows as needed, only limit the size of each burst
+        freeSpace = BLACKBOX_MAX_ACCUMULATED_HEADER_BUDGET;
+        break;
 #endif
     default:
         freeSpace = 0;
@@ -719,6 +786,14 @@ blackboxBufferReserveStatus_e blackboxDeviceReserveBufferSpace(int32_t bytes)
         return BLACKBOX_RESERVE_TEMPORARY_FAILURE;
 #endif // USE_SDCARD
 
+#ifdef USE_BLACKBOX_FILE
+    case BLACKBOX_DEVICE_FILE:
+        if (bytes > BLACKBOX_MAX_ACCUMULATED_HEADER_BUDGET) {
+            return BLACKBOX_RESERVE_PERMANENT_FAILURE;
+        }
+        return BLACKBOX_RESERVE_TEMPORARY_FAILURE;
+#endif // USE_BLACKBOX_FILE
+
     default:
         return BLACKBOX_RESERVE_PERMANENT_FAILURE;
     }
@@ -38,12 +38,21 @@ typedef enum {
  */
 #define BLACKBOX_TARGET_HEADER_BUDGET_PER_ITERATION 64
 
+/*
+ * Log frames are assembled in a staging buffer and handed to the device in a single write, so that a frame which
+ * doesn't fit in the device's buffers is dropped whole rather than torn. This must hold the largest intraframe:
+ */
+#define BLACKBOX_MAX_FRAME_SIZE 384
+
 extern int32_t blackboxHeaderBudget;
 
 void blackboxOpen(void);
 void blackboxWrite(uint8_t value);
 int blackboxWriteString(const char *s);
 
+void blackboxBeginFrame(void);
+void blackboxCommitFrame(void);
+
 void blackboxDeviceFlush(void);
 bool blackboxDeviceFlushForce(void);
 bool blackboxDeviceOpen(void);
@@ -41,6 +41,7 @@ bool cliMode = false;
 #include "build/version.h"
 
 #include "cli/settings.h"
+#include "cli/settings_index.h"
 
 #include "cms/cms.h"
 
@@ -189,7 +190,16 @@ static uint8_t cliWriteBuffer[sizeof(*cliWriter) + CLI_OUT_BUFFER_SIZE];
 static char cliBuffer[CLI_IN_BUFFER_SIZE];
 static uint32_t bufferIndex = 0;
 
-static bool configIsInCopy = false;
+typedef enum {
+    DEFAULTS_NOT_LOADED,
+    DEFAULTS_BARE,
+    DEFAULTS_CUSTOM,
+} copiedDefaults_e;
+
+// The PG copies hold the default configuration to diff against, the live configuration stays untouched
+static copiedDefaults_e copiedDefaults = DEFAULTS_NOT_LOADED;
+static bool loadingDefaults = false;
+static bool comparingToDefaults = false;
 
 #define CURRENT_PROFILE_INDEX -1
 static int8_t pidProfileIndexToUse = CURRENT_PROFILE_INDEX;
@@ -669,76 +679,82 @@ static void backupPgConfig(const pgRegistry_t *pg)
     memcpy(pg->copy, pg->address, pg->size);
 }
 
-static void restorePgConfig(const pgRegistry_t *pg)
+static void swapBytes(uint8_t *a, uint8_t *b, unsigned size)
 {
-    memcpy(pg->address, pg->copy, pg->size);
+    for (unsigned i = 0; i < size; i++) {
+        const uint8_t temp = a[i];
+        a[i] = b[i];
+        b[i] = temp;
+    }
 }
 
-static void backupConfigs(void)
-{
-    if (configIsInCopy) {
-        return;
-    }
+#if defined(USE_CUSTOM_DEFAULTS)
+static bool cliProcessCustomDefaults(bool quiet);
+#endif
 
-    // make copies of configs to do differencing
+// The live configuration is parked in the copies while resetConfig() and the custom defaults write the defaults
+// over it, and swapped back, which leaves the defaults in the copies. The PG resets can not be run on the copies
+// directly, since some of them look up the live configuration (e.g. pgResetFn_serialConfig).
+static void loadDefaults(const copiedDefaults_e defaults)
+{
     PG_FOREACH(pg) {
         backupPgConfig(pg);
     }
 
-    configIsInCopy = true;
-}
+    loadingDefaults = true;
 
-static void restoreConfigs(void)
-{
-    if (!configIsInCopy) {
-        return;
-    }
+    resetConfig();
 
-    PG_FOREACH(pg) {
-        restorePgConfig(pg);
+#if defined(USE_CUSTOM_DEFAULTS)
+    if (defaults == DEFAULTS_CUSTOM) {
+        cliProcessCustomDefaults(true);
     }
+#endif
 
-    configIsInCopy = false;
-}
+    loadingDefaults = false;
 
-#if defined(USE_RESOURCE_MGMT) || defined(USE_TIMER_MGMT)
-static bool isReadingConfigFromCopy()
-{
-    return configIsInCopy;
-}
-#endif
+    PG_FOREACH(pg) {
+        swapBytes(pg->address, pg->copy, pg->size);
+    }
 
-static bool isWritingConfigToCopy()
-{
-    return configIsInCopy
-#if defined(USE_CUSTOM_DEFAULTS)
-        && !processingCustomDefaults
-#endif
-        ;
+    copiedDefaults = defaults;
 }
 
-#if defined(USE_CUSTOM_DEFAULTS)
-static bool cliProcessCustomDefaults(bool quiet);
-#endif
-
-static void backupAndResetConfigs(const bool useCustomDefaults)
+// The defaults can not change after boot, so they are only built again when the other kind is asked for
+static void loadDefaultsToCopies(const bool useCustomDefaults)
 {
-    backupConfigs();
-
-    // reset all configs to defaults to do differencing
-    resetConfig();
-
+    copiedDefaults_e defaults = DEFAULTS_BARE;
 #if defined(USE_CUSTOM_DEFAULTS)
     if (useCustomDefaults) {
-        if (!cliProcessCustomDefaults(true)) {
+        if (hasCustomDefaults()) {
+            defaults = DEFAULTS_CUSTOM;
+        } else {
             cliPrintLine("###WARNING: NO CUSTOM DEFAULTS FOUND###");
         }
     }
 #else
     UNUSED(useCustomDefaults);
 #endif
+
+    if (copiedDefaults != defaults) {
+        loadDefaults(defaults);
+    }
+
+    comparingToDefaults = true;
+}
+
+static void releaseDefaults(void)
+{
+    comparingToDefaults = false;
 }
 
+#if defined(USE_RESOURCE_MGMT) || defined(USE_TIMER_MGMT)
+static const void *getPgDefaults(const pgRegistry_t *pg)
+{
+    return comparingToDefaults ? pg->copy : NULL;
+}
+#endif
+
 static uint8_t getPidProfileIndexToUse()
 {
     return pidProfileIndexToUse == CURRENT_PROFILE_INDEX ? getCurrentPidProfileIndex() : pidProfileIndexToUse;
@@ -767,51 +783,71 @@ static uint16_t getValueOffset(const clivalue_t *value)
 STATIC_UNIT_TESTED void *cliGetValuePointer(const clivalue_t *value)
 {
     const pgRegistry_t* rec = pgFind(value->pgn);
-    if (isWritingConfigToCopy()) {
-        return CONST_CAST(void *, rec->copy + getValueOffset(value));
-    } else {
-        return CONST_CAST(void *, rec->address + getValueOffset(value));
-    }
+    return CONST_CAST(void *, rec->address + getValueOffset(value));
 }
 
-static const char *dumpPgValue(const char *cmdName, const clivalue_t *value, dumpFlags_t dumpMask, const char *headingStr)
+static const char *dumpPgValue(const char *cmdName, const pgRegistry_t *pg, const clivalue_t *value, dumpFlags_t dumpMask, const char *headingStr)
 {
-    const pgRegistry_t *pg = pgFind(value->pgn);
-#ifdef DEBUG
-    if (!pg) {
-        cliPrintLinef("VALUE %s ERROR", value->name);
-        return headingStr; // if it's not found, the pgn shouldn't be in the value table!
-    }
-#endif
-
     const char *format = "set %s = ";
     const char *defaultFormat = "#set %s = ";
     const int valueOffset = getValueOffset(value);
-    const bool equalsDefault = valuePtrEqualsDefault(value, pg->copy + valueOffset, pg->address + valueOffset);
+    const bool equalsDefault = valuePtrEqualsDefault(value, pg->address + valueOffset, pg->copy + valueOffset);
 
     headingStr = cliPrintSectionHeading(dumpMask, !equalsDefault, headingStr);
     if (((dumpMask & DO_DIFF) == 0) || !equalsDefault) {
         if (dumpMask & SHOW_DEFAULTS && !equalsDefault) {
             cliPrintf(defaultFormat, value->name);
-            printValuePointer(cmdName, value, (uint8_t*)pg->address + valueOffset, false);
+            printValuePointer(cmdName, value, pg->copy + valueOffset, false);
             cliPrintLinefeed();
         }
         cliPrintf(format, value->name);
-        printValuePointer(cmdName, value, pg->copy + valueOffset, false);
+        printValuePointer(cmdName, value, pg->address + valueOffset, false);
         cliPrintLinefeed();
     }
     return headingStr;
 }
 
+// Compares the part of the PG that values of the section live in, for a profile section that is the selected profile
+STATIC_UNIT_TESTED bool pgSectionEqualsDefault(const pgRegistry_t *pg, uint16_t valueSection)
+{
+    switch (valueSection) {
+    case PROFILE_VALUE: {
+        const unsigned offset = sizeof(pidProfile_t) * getPidProfileIndexToUse();
+        return memcmp(pg->address + offset, pg->copy + offset, sizeof(pidProfile_t)) == 0;
+    }
+    case PROFILE_RATE_VALUE: {
+        const unsigned offset = sizeof(controlRateConfig_t) * getRateProfileIndexToUse();
+        return memcmp(pg->address + offset, pg->copy + offset, sizeof(controlRateConfig_t)) == 0;
+    }
+    default:
+        return memcmp(pg->address, pg->copy, pgSize(pg)) == 0;
+    }
+}
+
 static void dumpAllValues(const char *cmdName, uint16_t valueSection, dumpFlags_t dumpMask, const char *headingStr)
 {
     headingStr = cliPrintSectionHeading(dumpMask, false, headingStr);
 
+    const pgRegistry_t *pg = NULL;
+    bool skipPg = false;
     for (uint32_t i = 0; i < valueTableEntryCount; i++) {
         const clivalue_t *value = &valueTable[i];
         cliWriterFlush();
         if ((value->type & VALUE_SECTION_MASK) == valueSection || ((valueSection == MASTER_VALUE) && (value->type & VALUE_SECTION_MASK) == HARDWARE_VALUE)) {
-            headingStr = dumpPgValue(cmdName, value, dumpMask, headingStr);
+            if (!pg || pgN(pg) != value->pgn) {
+                pg = pgFind(value->pgn);
+#ifdef DEBUG
+                if (!pg) {
+                    cliPrintLinef("VALUE %s ERROR", value->name);
+                    continue; // if it's not found, the pgn shouldn't be in the value table!
+                }
+#endif
+                // nothing in a PG that matches its defaults shows up in a diff
+                skipPg = (dumpMask & DO_DIFF) && pgSectionEqualsDefault(pg, value->type & VALUE_SECTION_MASK);
+            }
+            if (!skipPg) {
+                headingStr = dumpPgValue(cmdName, pg, value, dumpMask, headingStr);
+            }
         }
     }
 }
@@ -1541,6 +1577,7 @@ static void cliSerialPassthrough(const char *cmdName, char *cmdline)
             if ((*port)->rxCallback) {
                 (*port)->rxCallback = NULL;
             }
+            (*port)->rxSpanCallback = NULL;
         }
     }
 
@@ -3108,7 +3145,7 @@ static void cliBoardName(const char *cmdName, char *cmdline)
     if (len > 0 && strlen(boardName) != 0 && boardInformationIsSet() && (len != strlen(boardName) || strncmp(boardName, cmdline, len))) {
         cliPrintErrorLinef(cmdName, ERROR_MESSAGE, "BOARD_NAME", boardName);
     } else {
-        if (len > 0 && !configIsInCopy && setBoardName(cmdline)) {
+        if (len > 0 && !loadingDefaults && setBoardName(cmdline)) {
             boardInformationUpdated = true;
 
             cliPrintHashLine("Set board_name.");
@@ -3131,7 +3168,7 @@ static void cliManufacturerId(const char *cmdName, char *cmdline)
     if (len > 0 && boardInformationIsSet() && strlen(manufacturerId) != 0 && (len != strlen(manufacturerId) || strncmp(manufacturerId, cmdline, len))) {
         cliPrintErrorLinef(cmdName, ERROR_MESSAGE, "MANUFACTURER_ID", manufacturerId);
     } else {
-        if (len > 0 && !configIsInCopy && setManufacturerId(cmdline)) {
+        if (len > 0 && !loadingDefaults && setManufacturerId(cmdline)) {
             boardInformationUpdated = true;
 
             cliPrintHashLine("Set manufacturer_id.");
@@ -3183,7 +3220,7 @@ static void cliSignature(const char *cmdName, char *cmdline)
         writeSignature(signatureStr, getSignature());
         cliPrintErrorLinef(cmdName, ERROR_MESSAGE, "SIGNATURE", signatureStr);
     } else {
-        if (len > 0 && !configIsInCopy && setSignature(signature)) {
+        if (len > 0 && !loadingDefaults && setSignature(signature)) {
             signatureUpdated = true;
 
             writeSignature(signatureStr, getSignature());
@@ -4378,10 +4415,10 @@ static void cliPrintVarDefault(const char *cmdName, const clivalue_t *value)
     if (pg) {
         const char *defaultFormat = "Default value: ";
         const int valueOffset = getValueOffset(value);
-        const bool equalsDefault = valuePtrEqualsDefault(value, pg->copy + valueOffset, pg->address + valueOffset);
+        const bool equalsDefault = valuePtrEqualsDefault(value, pg->address + valueOffset, pg->copy + valueOffset);
         if (!equalsDefault) {
             cliPrintf(defaultFormat, value->name);
-            printValuePointer(cmdName, value, (uint8_t*)pg->address + valueOffset, false);
+            printValuePointer(cmdName, value, pg->copy + valueOffset, false);
             cliPrintLinefeed();
         }
     }
@@ -4395,7 +4432,7 @@ STATIC_UNIT_TESTED void cliGet(const char *cmdName, char *cmdline)
     pidProfileIndexToUse = getCurrentPidProfileIndex();
     rateProfileIndexToUse = getCurrentControlRateProfileIndex();
 
-    backupAndResetConfigs(true);
+    loadDefaultsToCopies(true);
 
     for (uint32_t i = 0; i < valueTableEntryCount; i++) {
         if (strcasestr(valueTable[i].name, cmdline)) {
@@ -4426,7 +4463,7 @@ STATIC_UNIT_TESTED void cliGet(const char *cmdName, char *cmdline)
         }
     }
 
-    restoreConfigs();
+    releaseDefaults();
 
     pidProfileIndexToUse = CURRENT_PROFILE_INDEX;
     rateProfileIndexToUse = CURRENT_PROFILE_INDEX;
@@ -4447,15 +4484,8 @@ static uint8_t getWordLength(char *bufBegin, char *bufEnd)
 
 uint16_t cliGetSettingIndex(char *name, uint8_t length)
 {
-    for (uint32_t i = 0; i < valueTableEntryCount; i++) {
-        const char *settingName = valueTable[i].name;
-
-        // ensure exact match when setting to prevent setting variables with shorter names
-        if (strncasecmp(name, settingName, strlen(settingName)) == 0 && length == strlen(settingName)) {
-            return i;
-        }
-    }
-    return valueTableEntryCount;
+    // exact match only, to prevent setting variables with shorter names
+    return settingsIndexFind(name, length);
 }
 
 STATIC_UNIT_TESTED void cliSet(const char *cmdName, char *cmdline)
@@ -4785,6 +4815,10 @@ static void cliStatus(const char *cmdName, char *cmdline)
 #endif
     cliPrintLinef("I2C Errors: %d", i2cErrorCounter);
 
+#ifdef USE_BLACKBOX
+    cliPrintLinef("Blackbox dropped frames: %u", blackboxGetDroppedFrameCount());
+#endif
+
 #ifdef USE_SDCARD
     cliSdInfo(cmdName, "");
 #endif
@@ -4799,6 +4833,36 @@ static void cliStatus(const char *cmdName, char *cmdline)
     cliPrintLinefeed();
 }
 
+#if defined(USE_TASK_HISTOGRAMS)
+static void cliPrintHistogramPercentiles(const histogram_t *histogram)
+{
+    cliPrintf(" %6d %6d %6d", histogramPercentile(histogram, 5000), histogramPercentile(histogram, 9900), histogramPercentile(histogram, 9990));
+}
+
+static void cliTaskHistograms(void)
+{
+#ifndef MINIMAL_CLI
+    cliPrintLine("                       ---- execution -----    ----- lateness -----");
+    cliPrintLine("Task latency/us           p50    p99  p99.9       p50    p99  p99.9");
+#endif
+    for (taskId_e taskId = 0; taskId < TASK_COUNT; taskId++) {
+        taskInfo_t taskInfo;
+        getTaskInfo(taskId, &taskInfo);
+        if (taskInfo.isEnabled) {
+            cliPrintf("%02d - (%15s)", taskId, taskInfo.taskName);
+            cliPrintHistogramPercentiles(getTaskExecutionTimeHistogram(taskId));
+            cliPrintf("   ");
+            cliPrintHistogramPercentiles(getTaskLatenessHistogram(taskId));
+            cliPrintLinefeed();
+        }
+    }
+    cliPrintf("Gyro period jitter    ");
+    cliPrintHistogramPercentiles(getGyroPeriodJitterHistogram());
+    cliPrintLinefeed();
+    schedulerResetTaskHistograms();
+}
+#endif
+
 #if defined(USE_TASK_STATISTICS)
 static void cliTasks(const char *cmdName, char *cmdline)
 {
@@ -4843,6 +4907,9 @@ static void cliTasks(const char *cmdName, char *cmdline)
         cliPrintLinef("RX Check Function %19d %7d %25d", checkFuncInfo.maxExecutionTimeUs, checkFuncInfo.averageExecutionTimeUs, checkFuncInfo.totalExecutionTimeUs / 1000);
         cliPrintLinef("Total (excluding SERIAL) %25d.%1d%% %4d.%1d%%", maxLoadSum/10, maxLoadSum%10, averageLoadSum/10, averageLoadSum%10);
         schedulerResetCheckFunctionMaxExecutionTime();
+#if defined(USE_TASK_HISTOGRAMS)
+        cliTaskHistograms();
+#endif
     }
 }
 #endif
@@ -5121,15 +5188,8 @@ static void printResource(dumpFlags_t dumpMask, const char *headingStr)
     for (unsigned int i = 0; i < ARRAYLEN(resourceTable); i++) {
         const char* owner = ownerNames[resourceTable[i].owner];
         const pgRegistry_t* pg = pgFind(resourceTable[i].pgn);
-        const void *currentConfig;
-        const void *defaultConfig;
-        if (isReadingConfigFromCopy()) {
-            currentConfig = pg->copy;
-            defaultConfig = pg->address;
-        } else {
-            currentConfig = pg->address;
-            defaultConfig = NULL;
-        }
+        const void *currentConfig = pg->address;
+        const void *defaultConfig = getPgDefaults(pg);
 
         for (int index = 0; index < MAX_RESOURCE_INDEX(resourceTable[i].maxIndex); index++) {
             const ioTag_t ioTag = *(ioTag_t *)((const uint8_t *)currentConfig + resourceTable[i].stride * index + resourceTable[i].offset);
@@ -5341,16 +5401,8 @@ static void printPeripheralDmaoptDetails(dmaoptEntry_t *entry, int index, const
 static const char *printPeripheralDmaopt(dmaoptEntry_t *entry, int index, dumpFlags_t dumpMask, const char *headingStr)
 {
     const pgRegistry_t* pg = pgFind(entry->pgn);
-    const void *currentConfig;
-    const void *defaultConfig;
-
-    if (isReadingConfigFromCopy()) {
-        currentConfig = pg->copy;
-        defaultConfig = pg->address;
-    } else {
-        currentConfig = pg->address;
-        defaultConfig = NULL;
-    }
+    const void *currentConfig = pg->address;
+    const void *defaultConfig = getPgDefaults(pg);
 
     dmaoptValue_t currentOpt = *(dmaoptValue_t *)((uint8_t *)currentConfig + entry->stride * index + entry->offset);
     dmaoptValue_t defaultOpt;
@@ -5454,16 +5506,8 @@ static void printDmaopt(dumpFlags_t dumpMask, const char *headingStr)
 
 #if defined(USE_TIMER_MGMT)
     const pgRegistry_t* pg = pgFind(PG_TIMER_IO_CONFIG);
-    const timerIOConfig_t *currentConfig;
-    const timerIOConfig_t *defaultConfig;
-
-    if (isReadingConfigFromCopy()) {
-        currentConfig = (timerIOConfig_t *)pg->copy;
-        defaultConfig = (timerIOConfig_t *)pg->address;
-    } else {
-        currentConfig = (timerIOConfig_t *)pg->address;
-        defaultConfig = NULL;
-    }
+    const timerIOConfig_t *currentConfig = (timerIOConfig_t *)pg->address;
+    const timerIOConfig_t *defaultConfig = getPgDefaults(pg);
 
     bool tagsInUse[MAX_TIMER_PINMAP_COUNT] = { false };
     for (unsigned i = 0; i < MAX_TIMER_PINMAP_COUNT; i++) {
@@ -5533,13 +5577,7 @@ static void cliDmaopt(const char *cmdName, char *cmdline)
         }
 
         const pgRegistry_t* pg = pgFind(entry->pgn);
-        const void *currentConfig;
-        if (isWritingConfigToCopy()) {
-            currentConfig = pg->copy;
-        } else {
-            currentConfig = pg->address;
-        }
-        optaddr = (dmaoptValue_t *)((uint8_t *)currentConfig + entry->stride * index + entry->offset);
+        optaddr = (dmaoptValue_t *)(pg->address + entry->stride * index + entry->offset);
         orgval = *optaddr;
     } else {
         // It's a pin
@@ -5687,17 +5725,10 @@ static void printTimerDetails(const ioTag_t ioTag, const unsigned timerIndex, co
 static void printTimer(dumpFlags_t dumpMask, const char *headingStr)
 {
     const pgRegistry_t* pg = pgFind(PG_TIMER_IO_CONFIG);
-    const timerIOConfig_t *currentConfig;
-    const timerIOConfig_t *defaultConfig;
+    const timerIOConfig_t *currentConfig = (timerIOConfig_t *)pg->address;
+    const timerIOConfig_t *defaultConfig = getPgDefaults(pg);
 
     headingStr = cliPrintSectionHeading(dumpMask, false, headingStr);
-    if (isReadingConfigFromCopy()) {
-        currentConfig = (timerIOConfig_t *)pg->copy;
-        defaultConfig = (timerIOConfig_t *)pg->address;
-    } else {
-        currentConfig = (timerIOConfig_t *)pg->address;
-        defaultConfig = NULL;
-    }
 
     bool tagsInUse[MAX_TIMER_PINMAP_COUNT] = { false };
     for (unsigned int i = 0; i < MAX_TIMER_PINMAP_COUNT; i++) {
@@ -6103,7 +6134,7 @@ static void printConfig(const char *cmdName, char *cmdline, bool doDiff)
         dumpMask = dumpMask | BARE;   // show the diff / dump without extra commands and board specific data
     }
 
-    backupAndResetConfigs((dumpMask & BARE) == 0);
+    loadDefaultsToCopies((dumpMask & BARE) == 0);
 
 #ifdef USE_CLI_BATCH
     bool batchModeEnabled = false;
@@ -6139,7 +6170,7 @@ static void printConfig(const char *cmdName, char *cmdline, bool doDiff)
         }
 
         if (!(dumpMask & HARDWARE_ONLY)) {
-            printName(dumpMask, &pilotConfig_Copy);
+            printName(dumpMask, pilotConfig());
         }
 
 #ifdef USE_RESOURCE_MGMT
@@ -6155,66 +6186,66 @@ static void printConfig(const char *cmdName, char *cmdline, bool doDiff)
         if (!(dumpMask & HARDWARE_ONLY)) {
 #ifndef USE_QUAD_MIXER_ONLY
             const char *mixerHeadingStr = "mixer";
-            const bool equalsDefault = mixerConfig_Copy.mixerMode == mixerConfig()->mixerMode;
+            const bool equalsDefault = mixerConfig()->mixerMode == mixerConfig_Copy.mixerMode;
             mixerHeadingStr = cliPrintSectionHeading(dumpMask, !equalsDefault, mixerHeadingStr);
             const char *formatMixer = "mixer %s";
-            cliDefaultPrintLinef(dumpMask, equalsDefault, formatMixer, mixerNames[mixerConfig()->mixerMode - 1]);
-            cliDumpPrintLinef(dumpMask, equalsDefault, formatMixer, mixerNames[mixerConfig_Copy.mixerMode - 1]);
+            cliDefaultPrintLinef(dumpMask, equalsDefault, formatMixer, mixerNames[mixerConfig_Copy.mixerMode - 1]);
+            cliDumpPrintLinef(dumpMask, equalsDefault, formatMixer, mixerNames[mixerConfig()->mixerMode - 1]);
 
-            cliDumpPrintLinef(dumpMask, customMotorMixer(0)->throttle == 0.0f, "\r\nmmix reset\r\n");
+            cliDumpPrintLinef(dumpMask, customMotorMixer_CopyArray[0].throttle == 0.0f, "\r\nmmix reset\r\n");
 
-            printMotorMix(dumpMask, customMotorMixer_CopyArray, customMotorMixer(0), mixerHeadingStr);
+            printMotorMix(dumpMask, customMotorMixer(0), customMotorMixer_CopyArray, mixerHeadingStr);
 
 #ifdef USE_SERVOS
-            printServo(dumpMask, servoParams_CopyArray, servoParams(0), "servo");
+            printServo(dumpMask, servoParams(0), servoParams_CopyArray, "servo");
 
             const char *servoMixHeadingStr = "servo mixer";
-            if (!(dumpMask & DO_DIFF) || customServoMixers(0)->rate != 0) {
+            if (!(dumpMask & DO_DIFF) || customServoMixers_CopyArray[0].rate != 0) {
                 cliPrintHashLine(servoMixHeadingStr);
                 cliPrintLine("smix reset\r\n");
                 servoMixHeadingStr = NULL;
             }
-            printServoMix(dumpMask, customServoMixers_CopyArray, customServoMixers(0), servoMixHeadingStr);
+            printServoMix(dumpMask, customServoMixers(0), customServoMixers_CopyArray, servoMixHeadingStr);
 #endif
 #endif
 
-            printFeature(dumpMask, featureConfig_Copy.enabledFeatures, featureConfig()->enabledFeatures, "feature");
+            printFeature(dumpMask, featureConfig()->enabledFeatures, featureConfig_Copy.enabledFeatures, "feature");
 
 #if defined(USE_BEEPER)
-            printBeeper(dumpMask, beeperConfig_Copy.beeper_off_flags, beeperConfig()->beeper_off_flags, "beeper", BEEPER_ALLOWED_MODES, "beeper");
+            printBeeper(dumpMask, beeperConfig()->beeper_off_flags, beeperConfig_Copy.beeper_off_flags, "beeper", BEEPER_ALLOWED_MODES, "beeper");
 
 #if defined(USE_DSHOT)
-            printBeeper(dumpMask, beeperConfig_Copy.dshotBeaconOffFlags, beeperConfig()->dshotBeaconOffFlags, "beacon", DSHOT_BEACON_ALLOWED_MODES, "beacon");
+            printBeeper(dumpMask, beeperConfig()->dshotBeaconOffFlags, beeperConfig_Copy.dshotBeaconOffFlags, "beacon", DSHOT_BEACON_ALLOWED_MODES, "beacon");
 #endif
 #endif // USE_BEEPER
 
-            printMap(dumpMask, &rxConfig_Copy, rxConfig(), "map");
+            printMap(dumpMask, rxConfig(), &rxConfig_Copy, "map");
 
-            printSerial(dumpMask, &serialConfig_Copy, serialConfig(), "serial");
+            printSerial(dumpMask, serialConfig(), &serialConfig_Copy, "serial");
 
 #ifdef USE_LED_STRIP_STATUS_MODE
-            printLed(dumpMask, ledStripStatusModeConfig_Copy.ledConfigs, ledStripStatusModeConfig()->ledConfigs, "led");
+            printLed(dumpMask, ledStripStatusModeConfig()->ledConfigs, ledStripStatusModeConfig_Copy.ledConfigs, "led");
 
-            printColor(dumpMask, ledStripStatusModeConfig_Copy.colors, ledStripStatusModeConfig()->colors, "color");
+            printColor(dumpMask, ledStripStatusModeConfig()->colors, ledStripStatusModeConfig_Copy.colors, "color");
 
-            printModeColor(dumpMask, &ledStripStatusModeConfig_Copy, ledStripStatusModeConfig(), "mode_color");
+            printModeColor(dumpMask, ledStripStatusModeConfig(), &ledStripStatusModeConfig_Copy, "mode_color");
 #endif
 
-            printAux(dumpMask, modeActivationConditions_CopyArray, modeActivationConditions(0), "aux");
+            printAux(dumpMask, modeActivationConditions(0), modeActivationConditions_CopyArray, "aux");
 
-            printAdjustmentRange(dumpMask, adjustmentRanges_CopyArray, adjustmentRanges(0), "adjrange");
+            printAdjustmentRange(dumpMask, adjustmentRanges(0), adjustmentRanges_CopyArray, "adjrange");
 
-            printRxRange(dumpMask, rxChannelRangeConfigs_CopyArray, rxChannelRangeConfigs(0), "rxrange");
+            printRxRange(dumpMask, rxChannelRangeConfigs(0), rxChannelRangeConfigs_CopyArray, "rxrange");
 
 #ifdef USE_VTX_TABLE
-            printVtxTable(dumpMask, &vtxTableConfig_Copy, vtxTableConfig(), "vtxtable");
+            printVtxTable(dumpMask, vtxTableConfig(), &vtxTableConfig_Copy, "vtxtable");
 #endif
 
 #ifdef USE_VTX_CONTROL
-            printVtx(dumpMask, &vtxConfig_Copy, vtxConfig(), "vtx");
+            printVtx(dumpMask, vtxConfig(), &vtxConfig_Copy, "vtx");
 #endif
 
-            printRxFailsafe(dumpMask, rxFailsafeChannelConfigs_CopyArray, rxFailsafeChannelConfigs(0), "rxfail");
+            printRxFailsafe(dumpMask, rxFailsafeChannelConfigs(0), rxFailsafeChannelConfigs_CopyArray, "rxfail");
         }
 
         if (dumpMask & HARDWARE_ONLY) {
@@ -6227,7 +6258,7 @@ static void printConfig(const char *cmdName, char *cmdline, bool doDiff)
                     cliDumpPidProfile(cmdName, pidProfileIndex, dumpMask);
                 }
 
-                pidProfileIndexToUse = systemConfig_Copy.pidProfileIndex;
+                pidProfileIndexToUse = systemConfig()->pidProfileIndex;
 
                 if (!(dumpMask & BARE)) {
                     cliPrintHashLine("restore original profile selection");
@@ -6241,7 +6272,7 @@ static void printConfig(const char *cmdName, char *cmdline, bool doDiff)
                     cliDumpRateProfile(cmdName, rateIndex, dumpMask);
                 }
 
-                rateProfileIndexToUse = systemConfig_Copy.activeRateProfile;
+                rateProfileIndexToUse = systemConfig()->activeRateProfile;
 
                 if (!(dumpMask & BARE)) {
                     cliPrintHashLine("restore original rateprofile selection");
@@ -6257,15 +6288,15 @@ static void printConfig(const char *cmdName, char *cmdline, bool doDiff)
 
                 rateProfileIndexToUse = CURRENT_PROFILE_INDEX;
             } else {
-                cliDumpPidProfile(cmdName, systemConfig_Copy.pidProfileIndex, dumpMask);
+                cliDumpPidProfile(cmdName, systemConfig()->pidProfileIndex, dumpMask);
 
-                cliDumpRateProfile(cmdName, systemConfig_Copy.activeRateProfile, dumpMask);
+                cliDumpRateProfile(cmdName, systemConfig()->activeRateProfile, dumpMask);
             }
         }
     } else if (dumpMask & DUMP_PROFILE) {
-        cliDumpPidProfile(cmdName, systemConfig_Copy.pidProfileIndex, dumpMask);
+        cliDumpPidProfile(cmdName, systemConfig()->pidProfileIndex, dumpMask);
     } else if (dumpMask & DUMP_RATES) {
-        cliDumpRateProfile(cmdName, systemConfig_Copy.activeRateProfile, dumpMask);
+        cliDumpRateProfile(cmdName, systemConfig()->activeRateProfile, dumpMask);
     }
 
 #ifdef USE_CLI_BATCH
@@ -6275,8 +6306,7 @@ static void printConfig(const char *cmdName, char *cmdline, bool doDiff)
     }
 #endif
 
-    // restore configs from copies
-    restoreConfigs();
+    releaseDefaults();
 }
 
 static void cliDump(const char *cmdName, char *cmdline)
@@ -6284,7 +6314,7 @@ static void cliDump(const char *cmdName, char *cmdline)
     printConfig(cmdName, cmdline, false);
 }
 
-static void cliDiff(const char *cmdName, char *cmdline)
+STATIC_UNIT_TESTED void cliDiff(const char *cmdName, char *cmdline)
 {
     printConfig(cmdName, cmdline, true);
 }
@@ -41,6 +41,7 @@ typedef enum {
 #ifdef USE_BLACKBOX
     TABLE_BLACKBOX_DEVICE,
     TABLE_BLACKBOX_MODE,
+    TABLE_BLACKBOX_ENCODING,
 #endif
     TABLE_CURRENT_METER,
     TABLE_VOLTAGE_METER,
@@ -132,6 +133,9 @@ typedef enum {
     TABLE_LEDSTRIP_COLOR,
 #endif
     TABLE_GYRO_FILTER_DEBUG,
+#ifdef USE_GYRO_DATA_ANALYSE
+    TABLE_DYN_NOTCH_ESTIMATOR,
+#endif
     TABLE_POSITION_ALT_SOURCE,
     TABLE_OFF_ON_AUTO,
     TABLE_INTERPOLATED_SP,
@@ -232,6 +236,7 @@ extern const lookupTableEntry_t lookupTables[];
 extern const uint16_t valueTableEntryCount;
 
 extern const clivalue_t valueTable[];
+extern const uint16_t valueTableNameIndex[];
 //extern const uint8_t lookupTablesEntryCount;
 
 extern const char * const lookupTableGyroHardware[];
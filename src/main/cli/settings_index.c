@@ -0,0 +1,68 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "platform.h"
+
+#include "cli/settings.h"
+
+#include "settings_index.h"
+
+// Setting names are ASCII, this avoids the locale lookup in tolower()
+static inline int lowerCase(char c)
+{
+    return (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c;
+}
+
+// Compares the first length characters of name with settingName, ignoring case
+static int compareSettingName(const char *name, uint8_t length, const char *settingName)
+{
+    for (unsigned i = 0; i < length; i++) {
+        // a shorter settingName compares lower since its terminator does
+        const int diff = lowerCase(name[i]) - lowerCase(settingName[i]);
+        if (diff) {
+            return diff;
+        }
+    }
+    return settingName[length] ? -1 : 0;
+}
+
+// Returns the valueTable index of the setting called name, or valueTableEntryCount if there isn't one.
+// valueTableNameIndex is sorted by the build, see settings.c
+uint16_t settingsIndexFind(const char *name, uint8_t length)
+{
+    unsigned low = 0;
+    unsigned high = valueTableEntryCount;
+    while (low < high) {
+        const unsigned mid = (low + high) / 2;
+        const uint16_t index = valueTableNameIndex[mid];
+        const int diff = compareSettingName(name, length, valueTable[index].name);
+        if (diff == 0) {
+            return index;
+        } else if (diff > 0) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return valueTableEntryCount;
+}
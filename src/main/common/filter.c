@@ -41,6 +41,12 @@ FAST_CODE float nullFilterApply(filter_t *filter, float input)
     return input;
 }
 
+FAST_CODE void nullFilterBankApply(filterBank_t *bank, float *data)
+{
+    UNUSED(bank);
+    UNUSED(data);
+}
+
 
 // PT1 Low Pass filter
 
@@ -203,6 +209,96 @@ FAST_CODE float biquadFilterApply(biquadFilter_t *filter, float input)
     return result;
 }
 
+// PT1 Low Pass filter bank, one filter per axis sharing the same gain
+
+void pt1FilterBankInit(pt1FilterBank_t *bank, float k)
+{
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        bank->state[axis] = 0.0f;
+    }
+    bank->k = k;
+}
+
+void pt1FilterBankUpdateCutoff(pt1FilterBank_t *bank, float k)
+{
+    bank->k = k;
+}
+
+FAST_CODE void pt1FilterBankApply(pt1FilterBank_t *bank, float *data)
+{
+    pt1FilterBankApplyInline(bank, data);
+}
+
+// Biquad filter bank, one filter per axis with independent coefficients
+
+// updates the coefficients of a single axis, keeping the filter state
+FAST_CODE void biquadFilterBankUpdateAxis(biquadFilterBank_t *bank, int axis, float filterFreq, uint32_t refreshRate, float Q, biquadFilterType_e filterType)
+{
+    biquadFilter_t filter;
+    biquadFilterInit(&filter, filterFreq, refreshRate, Q, filterType);
+
+    bank->b0[axis] = filter.b0;
+    bank->b1[axis] = filter.b1;
+    bank->b2[axis] = filter.b2;
+    bank->a1[axis] = filter.a1;
+    bank->a2[axis] = filter.a2;
+}
+
+void biquadFilterBankInitLPF(biquadFilterBank_t *bank, float filterFreq, uint32_t refreshRate)
+{
+    biquadFilterBankInit(bank, filterFreq, refreshRate, BIQUAD_Q, FILTER_LPF);
+}
+
+void biquadFilterBankInit(biquadFilterBank_t *bank, float filterFreq, uint32_t refreshRate, float Q, biquadFilterType_e filterType)
+{
+    biquadFilterBankUpdate(bank, filterFreq, refreshRate, Q, filterType);
+
+    // zero initial samples
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        bank->x1[axis] = bank->x2[axis] = 0;
+        bank->y1[axis] = bank->y2[axis] = 0;
+    }
+}
+
+// updates the coefficients of all axes, keeping the filter state
+FAST_CODE void biquadFilterBankUpdate(biquadFilterBank_t *bank, float filterFreq, uint32_t refreshRate, float Q, biquadFilterType_e filterType)
+{
+    biquadFilterBankUpdateAxis(bank, 0, filterFreq, refreshRate, Q, filterType);
+    for (int axis = 1; axis < XYZ_AXIS_COUNT; axis++) {
+        bank->b0[axis] = bank->b0[0];
+        bank->b1[axis] = bank->b1[0];
+        bank->b2[axis] = bank->b2[0];
+        bank->a1[axis] = bank->a1[0];
+        bank->a2[axis] = bank->a2[0];
+    }
+}
+
+FAST_CODE void biquadFilterBankUpdateLPF(biquadFilterBank_t *bank, float filterFreq, uint32_t refreshRate)
+{
+    biquadFilterBankUpdate(bank, filterFreq, refreshRate, BIQUAD_Q, FILTER_LPF);
+}
+
+// a filter that leaves its input unchanged, in either direct form
+void biquadFilterBankInitPassthrough(biquadFilterBank_t *bank)
+{
+    memset(bank, 0, sizeof(*bank));
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        bank->b0[axis] = 1.0f;
+    }
+}
+
+/* Computes the biquad filter bank in direct form 1 on a XYZ vector, in place (works in dynamic mode) */
+FAST_CODE void biquadFilterBankApplyDF1(biquadFilterBank_t *bank, float *data)
+{
+    biquadFilterBankApplyDF1Inline(bank, data);
+}
+
+/* Computes the biquad filter bank in direct form 2 on a XYZ vector, in place (can't handle changes in coefficients) */
+FAST_CODE void biquadFilterBankApply(biquadFilterBank_t *bank, float *data)
+{
+    biquadFilterBankApplyInline(bank, data);
+}
+
 void laggedMovingAverageInit(laggedMovingAverage_t *filter, uint16_t windowSize, float *buf)
 {
     filter->movingWindowIndex = 0;
@@ -0,0 +1,90 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "platform.h"
+
+#include "histogram.h"
+
+void histogramReset(histogram_t *histogram)
+{
+    memset(histogram, 0, sizeof(*histogram));
+}
+
+static unsigned histogramBucket(uint32_t value)
+{
+    if (value < 2) {
+        return value;
+    }
+    const unsigned log2 = 31 - __builtin_clz(value);
+    const unsigned bucket = 2 * log2 + ((value >> (log2 - 1)) & 1);
+    return bucket < HISTOGRAM_BUCKET_COUNT ? bucket : HISTOGRAM_BUCKET_COUNT - 1;
+}
+
+uint32_t histogramBucketLowerBound(unsigned bucket)
+{
+    if (bucket < 2) {
+        return bucket;
+    }
+    const unsigned log2 = bucket / 2;
+    return (1U << log2) + (bucket & 1) * (1U << (log2 - 1));
+}
+
+FAST_CODE void histogramAdd(histogram_t *histogram, uint32_t value)
+{
+    const unsigned bucket = histogramBucket(value);
+    if (histogram->count[bucket] == UINT16_MAX) {
+        for (unsigned i = 0; i < HISTOGRAM_BUCKET_COUNT; i++) {
+            histogram->count[i] /= 2;
+        }
+    }
+    histogram->count[bucket]++;
+}
+
+uint32_t histogramSampleCount(const histogram_t *histogram)
+{
+    uint32_t samples = 0;
+    for (unsigned i = 0; i < HISTOGRAM_BUCKET_COUNT; i++) {
+        samples += histogram->count[i];
+    }
+    return samples;
+}
+
+// Returns the largest value in the bucket containing the given percentile, or the
+// lower bound of the last bucket if the percentile falls into it.
+uint32_t histogramPercentile(const histogram_t *histogram, unsigned partsPer10000)
+{
+    const uint32_t samples = histogramSampleCount(histogram);
+    if (samples == 0) {
+        return 0;
+    }
+    // rank of the sample wanted, rounded up so that p100 is the largest sample
+    const uint32_t rank = ((uint64_t)samples * partsPer10000 + 9999) / 10000;
+    uint32_t cumulative = 0;
+    for (unsigned i = 0; i < HISTOGRAM_BUCKET_COUNT - 1; i++) {
+        cumulative += histogram->count[i];
+        if (cumulative >= rank && cumulative > 0) {
+            return histogramBucketLowerBound(i + 1) - 1;
+        }
+    }
+    return histogramBucketLowerBound(HISTOGRAM_BUCKET_COUNT - 1);
+}
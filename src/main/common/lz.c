@@ -0,0 +1,203 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "platform.h"
+
+#ifdef USE_LZ
+
+#include "common/huffman.h"
+#include "common/maths.h"
+
+#include "lz.h"
+
+#define LZ_ESCAPE_SYMBOL (HUFFMAN_TABLE_SIZE - 1)
+
+static uint32_t lzHash(const uint8_t *p)
+{
+    const uint32_t bytes = p[0] | (p[1] << 8) | (p[2] << 16);
+    return (bytes * 2654435761U) >> (32 - LZ_HASH_BITS);
+}
+
+static void lzInsertHash(lzState_t *state, int pos)
+{
+    uint16_t *bucket = state->hashTable[lzHash(state->history + pos)];
+    memmove(bucket + 1, bucket, (LZ_HASH_WAYS - 1) * sizeof(*bucket));
+    bucket[0] = pos + 1;
+}
+
+static void lzWriteBits(lzState_t *state, uint32_t value, int bitCount)
+{
+    state->bitBuffer = (state->bitBuffer << bitCount) | value;
+    state->bitCount += bitCount;
+    while (state->bitCount >= 8) {
+        state->bitCount -= 8;
+        *state->outByte++ = state->bitBuffer >> state->bitCount;
+        ++state->bytesWritten;
+    }
+}
+
+static void lzWriteSymbol(lzState_t *state, int symbol)
+{
+    const int codeLen = huffmanTable[symbol].codeLen;
+    lzWriteBits(state, huffmanTable[symbol].code >> (16 - codeLen), codeLen);
+}
+
+static int lzMatchBits(int len)
+{
+    const int bits = huffmanTable[LZ_ESCAPE_SYMBOL].codeLen + LZ_LENGTH_BITS + LZ_OFFSET_BITS;
+    return len - LZ_MIN_MATCH < LZ_SHORT_MATCH_CODES ? bits : bits + LZ_LONG_LENGTH_BITS;
+}
+
+static void lzWriteMatch(lzState_t *state, int offset, int len)
+{
+    const int lenCode = len - LZ_MIN_MATCH;
+    lzWriteSymbol(state, LZ_ESCAPE_SYMBOL);
+    lzWriteBits(state, MIN(lenCode, LZ_SHORT_MATCH_CODES), LZ_LENGTH_BITS);
+    lzWriteBits(state, offset - 1, LZ_OFFSET_BITS);
+    if (lenCode >= LZ_SHORT_MATCH_CODES) {
+        lzWriteBits(state, lenCode - LZ_SHORT_MATCH_CODES, LZ_LONG_LENGTH_BITS);
+    }
+}
+
+void lzInit(lzState_t *state, uint8_t *outBuf, uint16_t outBufLen)
+{
+    memset(state->hashTable, 0, sizeof(state->hashTable));
+    state->historyLen = 0;
+    state->outByte = outBuf;
+    state->bytesWritten = 0;
+    state->outBufLen = outBufLen;
+    state->bitBuffer = 0;
+    state->bitCount = 0;
+}
+
+// Returns the largest block that is guaranteed to fit in the output buffer, even if none of it compresses
+int lzBlockCapacity(const lzState_t *state)
+{
+    // keep a byte for the bits that haven't been written yet
+    const int bytesFree = state->outBufLen - state->bytesWritten - 1;
+    const int capacity = bytesFree * 8 / LZ_MAX_LITERAL_BITS;
+    return constrain(capacity, 0, LZ_BLOCK_SIZE);
+}
+
+// The next block of input is read into this buffer before calling lzEncodeBlock()
+uint8_t *lzBlockBuffer(lzState_t *state)
+{
+    return state->history + state->historyLen;
+}
+
+// Compresses inLen bytes from lzBlockBuffer(), which must be no more than lzBlockCapacity()
+void lzEncodeBlock(lzState_t *state, int inLen)
+{
+    uint8_t *history = state->history;
+    const int end = state->historyLen + inLen;
+    int pos = state->historyLen;
+
+    while (pos < end) {
+        int len = 0;
+        int offset = 0;
+        if (pos + LZ_MIN_MATCH <= end) {
+            uint16_t *bucket = state->hashTable[lzHash(history + pos)];
+            const int maxLen = MIN(end - pos, LZ_MAX_MATCH);
+            int bestSaving = 0;
+
+            for (int way = 0; way < LZ_HASH_WAYS && bucket[way]; way++) {
+                const int candidate = bucket[way] - 1;
+                if (pos - candidate > LZ_WINDOW_SIZE) {
+                    break;
+                }
+                int candidateLen = 0;
+                int literalBits = 0;
+                while (candidateLen < maxLen && history[candidate + candidateLen] == history[pos + candidateLen]) {
+                    literalBits += huffmanTable[history[pos + candidateLen]].codeLen;
+                    ++candidateLen;
+                }
+                const int saving = literalBits - lzMatchBits(candidateLen);
+                if (candidateLen >= LZ_MIN_MATCH && saving > bestSaving) {
+                    bestSaving = saving;
+                    len = candidateLen;
+                    offset = pos - candidate;
+                }
+            }
+            lzInsertHash(state, pos);
+        }
+
+        if (len == 0) {
+            lzWriteSymbol(state, history[pos]);
+            ++pos;
+            continue;
+        }
+
+        lzWriteMatch(state, offset, len);
+
+        // index the rest of the match so later strings can refer to it
+        const int matchEnd = pos + len;
+        for (++pos; pos < matchEnd && pos + LZ_MIN_MATCH <= end; ++pos) {
+            lzInsertHash(state, pos);
+        }
+        pos = matchEnd;
+    }
+
+    // slide the window so that the next block follows the last LZ_WINDOW_SIZE bytes of input
+    if (end > LZ_WINDOW_SIZE) {
+        const int shift = end - LZ_WINDOW_SIZE;
+        memmove(history, history + shift, LZ_WINDOW_SIZE);
+        uint16_t *entry = &state->hashTable[0][0];
+        for (int i = 0; i < LZ_HASH_SIZE * LZ_HASH_WAYS; i++, entry++) {
+            *entry = *entry > shift ? *entry - shift : 0;
+        }
+        state->historyLen = LZ_WINDOW_SIZE;
+    } else {
+        state->historyLen = end;
+    }
+}
+
+// Pads the last byte with zero bits, returns the number of bytes written
+int lzFinish(lzState_t *state)
+{
+    if (state->bitCount) {
+        lzWriteBits(state, 0, 8 - state->bitCount);
+    }
+    return state->bytesWritten;
+}
+
+// Compresses as much of inBuf as is guaranteed to fit in outBuf, returns the number of input bytes consumed
+int lzEncodeBuf(lzState_t *state, uint8_t *outBuf, int outBufLen, const uint8_t *inBuf, int inLen)
+{
+    lzInit(state, outBuf, outBufLen);
+
+    int bytesRead = 0;
+    while (bytesRead < inLen) {
+        const int blockLen = MIN(lzBlockCapacity(state), inLen - bytesRead);
+        if (blockLen <= 0) {
+            break;
+        }
+        memcpy(lzBlockBuffer(state), inBuf + bytesRead, blockLen);
+        lzEncodeBlock(state, blockLen);
+        bytesRead += blockLen;
+    }
+    lzFinish(state);
+    return bytesRead;
+}
+
+#endif
@@ -0,0 +1,75 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+/*
+ * LZ77 compressor with a 1K window, for blackbox logs.
+ *
+ * The output is a bit stream, MSB first. Literals are written with the static Huffman table from huffman.c, which
+ * is trained on blackbox logs, and its EOF code is the escape for a match:
+ *   <EOF code> LLLL OOOOOOOOOO             match of L + 3 bytes (L < 15), starting O + 1 bytes back
+ *   <EOF code> 1111 OOOOOOOOOO LLLLLLLL    match of L + 18 bytes, starting O + 1 bytes back
+ * A match is only used where it is shorter than the Huffman codes for the same bytes, so the output is never
+ * larger than Huffman alone. Matches may overlap the bytes they produce, so runs of erased flash compress well.
+ * The last byte is padded with zero bits, the decoder is told how many bytes to decode.
+ */
+
+#define LZ_WINDOW_SIZE          1024
+#define LZ_BLOCK_SIZE           256
+#define LZ_HASH_BITS            8
+#define LZ_HASH_SIZE            (1 << LZ_HASH_BITS)
+#define LZ_HASH_WAYS            4
+
+#define LZ_OFFSET_BITS          10
+#define LZ_LENGTH_BITS          4
+#define LZ_LONG_LENGTH_BITS     8
+#define LZ_MIN_MATCH            3
+#define LZ_SHORT_MATCH_CODES    ((1 << LZ_LENGTH_BITS) - 1)
+#define LZ_MAX_MATCH            (LZ_MIN_MATCH + LZ_SHORT_MATCH_CODES + (1 << LZ_LONG_LENGTH_BITS) - 1)
+#define LZ_MAX_LITERAL_BITS     12  // longest code in huffmanTable
+
+typedef struct lzState_s {
+    // the previous LZ_WINDOW_SIZE bytes of input, followed by the block being compressed
+    uint8_t     history[LZ_WINDOW_SIZE + LZ_BLOCK_SIZE];
+    // 1 + the positions in history of the last few strings with each hash, newest first, 0 if none
+    uint16_t    hashTable[LZ_HASH_SIZE][LZ_HASH_WAYS];
+    uint16_t    historyLen;
+    uint8_t     *outByte;
+    uint16_t    bytesWritten;
+    uint16_t    outBufLen;
+    uint32_t    bitBuffer;
+    uint8_t     bitCount;
+} lzState_t;
+
+struct lzInfo_s {
+    uint16_t uncompressedByteCount;
+};
+
+#define LZ_INFO_SIZE sizeof(struct lzInfo_s)
+
+void lzInit(lzState_t *state, uint8_t *outBuf, uint16_t outBufLen);
+int lzBlockCapacity(const lzState_t *state);
+uint8_t *lzBlockBuffer(lzState_t *state);
+void lzEncodeBlock(lzState_t *state, int inLen);
+int lzFinish(lzState_t *state);
+int lzEncodeBuf(lzState_t *state, uint8_t *outBuf, int outBufLen, const uint8_t *inBuf, int inLen);
@@ -361,6 +361,13 @@ void arraySubInt32(int32_t *dest, int32_t *array1, int32_t *array2, int count)
     }
 }
 
+void arraySubInt16(int32_t *dest, int16_t *array1, int16_t *array2, int count)
+{
+    for (int i = 0; i < count; i++) {
+        dest[i] = array1[i] - array2[i];
+    }
+}
+
 int16_t qPercent(fix12_t q) {
     return (100 * q) >> 12;
 }
@@ -0,0 +1,120 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "common/maths.h"
+
+#include "spsc_ring.h"
+
+// The acquire load of the other side's index orders the data access after it, and the release store of our own
+// index publishes the data access before it.
+
+void spscRingInit(spscRing_t *ring, uint8_t *buffer, uint32_t size)
+{
+    ring->buffer = buffer;
+    ring->mask = size - 1;
+    ring->head = 0;
+    ring->tail = 0;
+}
+
+uint32_t spscRingSize(const spscRing_t *ring)
+{
+    return ring->mask + 1;
+}
+
+uint32_t spscRingCount(const spscRing_t *ring)
+{
+    return __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE) - __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE);
+}
+
+uint32_t spscRingFree(const spscRing_t *ring)
+{
+    return spscRingSize(ring) - spscRingCount(ring);
+}
+
+// Returns the number of contiguous bytes that can be written at *data, then call spscRingCommit()
+uint32_t spscRingWriteSpan(spscRing_t *ring, uint8_t **data)
+{
+    const uint32_t head = ring->head;
+    const uint32_t bytesFree = spscRingSize(ring) - (head - __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE));
+    const uint32_t offset = head & ring->mask;
+
+    *data = ring->buffer + offset;
+    return MIN(bytesFree, spscRingSize(ring) - offset);
+}
+
+void spscRingCommit(spscRing_t *ring, uint32_t len)
+{
+    __atomic_store_n(&ring->head, ring->head + len, __ATOMIC_RELEASE);
+}
+
+// Returns the number of bytes written, less than len if the ring is full
+uint32_t spscRingWrite(spscRing_t *ring, const uint8_t *data, uint32_t len)
+{
+    uint32_t written = 0;
+    while (written < len) {
+        uint8_t *span;
+        const uint32_t spanLen = MIN(spscRingWriteSpan(ring, &span), len - written);
+        if (spanLen == 0) {
+            break;
+        }
+        memcpy(span, data + written, spanLen);
+        written += spanLen;
+        // commit each span so the write index never runs ahead of the data
+        spscRingCommit(ring, spanLen);
+    }
+    return written;
+}
+
+// Returns the number of contiguous bytes that can be read at *data, then call spscRingConsume()
+uint32_t spscRingReadSpan(spscRing_t *ring, const uint8_t **data)
+{
+    const uint32_t tail = ring->tail;
+    const uint32_t count = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE) - tail;
+    const uint32_t offset = tail & ring->mask;
+
+    *data = ring->buffer + offset;
+    return MIN(count, spscRingSize(ring) - offset);
+}
+
+void spscRingConsume(spscRing_t *ring, uint32_t len)
+{
+    __atomic_store_n(&ring->tail, ring->tail + len, __ATOMIC_RELEASE);
+}
+
+// Returns the number of bytes read, less than len if the ring runs empty
+uint32_t spscRingRead(spscRing_t *ring, uint8_t *data, uint32_t len)
+{
+    uint32_t bytesRead = 0;
+    while (bytesRead < len) {
+        const uint8_t *span;
+        const uint32_t spanLen = MIN(spscRingReadSpan(ring, &span), len - bytesRead);
+        if (spanLen == 0) {
+            break;
+        }
+        memcpy(data + bytesRead, span, spanLen);
+        bytesRead += spanLen;
+        spscRingConsume(ring, spanLen);
+    }
+    return bytesRead;
+}
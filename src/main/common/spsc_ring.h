@@ -0,0 +1,50 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Lock-free byte ring for exactly one producer thread and one consumer thread.
+// head is only written by the producer and tail only by the consumer, both count bytes since init and are masked on
+// access, so the size must be a power of two.
+
+typedef struct spscRing_s {
+    uint8_t *buffer;
+    uint32_t mask;
+    uint32_t head;
+    uint32_t tail;
+} spscRing_t;
+
+void spscRingInit(spscRing_t *ring, uint8_t *buffer, uint32_t size);
+uint32_t spscRingSize(const spscRing_t *ring);
+uint32_t spscRingCount(const spscRing_t *ring);
+uint32_t spscRingFree(const spscRing_t *ring);
+
+// producer
+uint32_t spscRingWrite(spscRing_t *ring, const uint8_t *data, uint32_t len);
+uint32_t spscRingWriteSpan(spscRing_t *ring, uint8_t **data);
+void spscRingCommit(spscRing_t *ring, uint32_t len);
+
+// consumer
+uint32_t spscRingRead(spscRing_t *ring, uint8_t *data, uint32_t len);
+uint32_t spscRingReadSpan(spscRing_t *ring, const uint8_t **data);
+void spscRingConsume(spscRing_t *ring, uint32_t len);
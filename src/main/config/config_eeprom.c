@@ -77,6 +77,31 @@ typedef struct {
 } PG_PACKED configFooter_t;
 // checksum is appended just after footer. It is not included in footer to make checksum calculation consistent
 
+// Saves only append the PGs that changed to the full copy, as segments laid out like the full copy: a header, the
+// records, a footer and the checksum. Each segment starts on a streamer word boundary, its sequence number follows the
+// one of the segment before and its checksum is seeded with the stored checksum before it, so leftovers of an older
+// log are never taken for part of the current one. Records in newer segments override older ones. The full copy is
+// always followed by an empty segment, when the log fills up the whole config is written again (compacted).
+#define CONFIG_LOG_MAGIC            0xBF
+#define CONFIG_LOG_MAX_SEGMENTS     32      // bounds the load time, the log is compacted when it is reached
+#define CONFIG_LOG_ALIGN(offset)    (((offset) + CONFIG_STREAMER_BUFFER_SIZE - 1) & ~(CONFIG_STREAMER_BUFFER_SIZE - 1))
+
+// Header for each appended segment.
+typedef struct {
+    configHeader_t header;      // magic_be is CONFIG_LOG_MAGIC
+    uint16_t sequence;
+} PG_PACKED configLogHeader_t;
+
+typedef struct configLog_s {
+    int segmentCount;
+    uint32_t segmentOffset[CONFIG_LOG_MAX_SEGMENTS];    // from __config_start
+    uint32_t end;               // offset of the first byte after the log
+    uint16_t lastCrc;           // stored checksum of the full copy or the last segment
+    uint16_t nextSequence;
+} configLog_t;
+
+static configLog_t configLog;
+
 // Used to check the compiler packing at build time.
 typedef struct {
     uint8_t byte;
@@ -269,6 +294,68 @@ void initEEPROM(void)
 #endif
 }
 
+// Find the segments appended to the full copy that ends at fullCopyEnd. The log ends at the first one that is not valid.
+static void scanConfigLog(uint32_t fullCopyEnd, uint16_t fullCopyCrc)
+{
+    configLog.segmentCount = 0;
+    configLog.end = fullCopyEnd;
+    configLog.lastCrc = fullCopyCrc;
+    configLog.nextSequence = 0;
+
+    const uint8_t *p = &__config_start + CONFIG_LOG_ALIGN(fullCopyEnd);
+    while (configLog.segmentCount < CONFIG_LOG_MAX_SEGMENTS) {
+        const configLogHeader_t *logHeader = (const configLogHeader_t *)p;
+        if (p + sizeof(*logHeader) >= &__config_end
+            || logHeader->header.eepromConfigVersion != EEPROM_CONF_VERSION
+            || logHeader->header.magic_be != CONFIG_LOG_MAGIC
+            || (configLog.segmentCount > 0 && logHeader->sequence != configLog.nextSequence)) {
+            break;
+        }
+
+        uint16_t crc = configLog.lastCrc;
+        crc = crc16_ccitt_update(crc, logHeader, sizeof(*logHeader));
+        const uint8_t *q = p + sizeof(*logHeader);
+        bool valid = true;
+        for (;;) {
+            const configRecord_t *record = (const configRecord_t *)q;
+            if (q + sizeof(configFooter_t) + sizeof(uint16_t) > &__config_end) {
+                valid = false;
+                break;
+            }
+            if (record->size == 0) {
+                break;
+            }
+            if (q + record->size >= &__config_end
+                || record->size < sizeof(*record)) {
+                valid = false;
+                break;
+            }
+            crc = crc16_ccitt_update(crc, q, record->size);
+            q += record->size;
+        }
+        if (!valid) {
+            break;
+        }
+
+        const configFooter_t *footer = (const configFooter_t *)q;
+        crc = crc16_ccitt_update(crc, footer, sizeof(*footer));
+        q += sizeof(*footer);
+        const uint16_t *storedCrc = (const uint16_t *)q;
+        crc = crc16_ccitt_update(crc, storedCrc, sizeof(*storedCrc));
+        q += sizeof(*storedCrc);
+        if (crc != CRC_CHECK_VALUE) {
+            break;
+        }
+
+        configLog.segmentOffset[configLog.segmentCount++] = p - &__config_start;
+        configLog.end = q - &__config_start;
+        configLog.lastCrc = *storedCrc;
+        configLog.nextSequence = logHeader->sequence + 1;
+
+        p = &__config_start + CONFIG_LOG_ALIGN(configLog.end);
+    }
+}
+
 bool isEEPROMVersionValid(void)
 {
     const uint8_t *p = &__config_start;
@@ -320,12 +407,18 @@ bool isEEPROMStructureValid(void)
     // include stored CRC in the CRC calculation
     const uint16_t *storedCrc = (const uint16_t *)p;
     crc = crc16_ccitt_update(crc, storedCrc, sizeof(*storedCrc));
-    p += sizeof(storedCrc);
-
-    eepromConfigSize = p - &__config_start;
+    p += sizeof(*storedCrc);
 
     // CRC has the property that if the CRC itself is included in the calculation the resulting CRC will have constant value
-    return crc == CRC_CHECK_VALUE;
+    if (crc != CRC_CHECK_VALUE) {
+        configLog.segmentCount = 0;
+        return false;
+    }
+
+    scanConfigLog(p - &__config_start, *storedCrc);
+    eepromConfigSize = configLog.end;
+
+    return true;
 }
 
 uint16_t getEEPROMConfigSize(void)
@@ -347,13 +440,20 @@ size_t getEEPROMStorageSize(void)
 #endif
 }
 
-// find config record for reg + classification (profile info) in EEPROM
+// The records of the full copy are area 0, those of segment n of the log are area n + 1
+static const uint8_t *configRecordArea(int area)
+{
+    if (area == 0) {
+        return &__config_start + sizeof(configHeader_t);
+    }
+    return &__config_start + configLog.segmentOffset[area - 1] + sizeof(configLogHeader_t);
+}
+
+// find config record for reg + classification (profile info) in the records starting at p
 // return NULL when record is not found
 // this function assumes that EEPROM content is valid
-static const configRecord_t *findEEPROM(const pgRegistry_t *reg, configRecordFlags_e classification)
+static const configRecord_t *findEEPROMInArea(const uint8_t *p, const pgRegistry_t *reg, configRecordFlags_e classification)
 {
-    const uint8_t *p = &__config_start;
-    p += sizeof(configHeader_t);             // skip header
     while (true) {
         const configRecord_t *record = (const configRecord_t *)p;
         if (record->size == 0
@@ -369,15 +469,125 @@ static const configRecord_t *findEEPROM(const pgRegistry_t *reg, configRecordFla
     return NULL;
 }
 
+// find config record for reg + classification (profile info) in EEPROM, the newest segment of the log first
+// return NULL when record is not found
+// this function assumes that EEPROM content is valid
+static const configRecord_t *findEEPROM(const pgRegistry_t *reg, configRecordFlags_e classification)
+{
+    for (int area = configLog.segmentCount; area >= 0; area--) {
+        const configRecord_t *record = findEEPROMInArea(configRecordArea(area), reg, classification);
+        if (record) {
+            return record;
+        }
+    }
+    return NULL;
+}
+
+// Open addressing hash table of record offsets from __config_start, keyed by PGN. Offset 0 marks an empty slot, no
+// record can start there since the header does.
+#define CONFIG_RECORD_INDEX_SIZE        256     // power of 2, well above the number of registered PGs
+#define CONFIG_RECORD_INDEX_MAX_FILL    (CONFIG_RECORD_INDEX_SIZE * 3 / 4)
+
+typedef struct configRecordIndex_s {
+    uint16_t offset[CONFIG_RECORD_INDEX_SIZE];
+    bool complete;      // false when records were left out, these are looked up with findEEPROM()
+} configRecordIndex_t;
+
+static unsigned configRecordIndexSlot(pgn_t pgn)
+{
+    return (pgn ^ (pgn >> 8)) & (CONFIG_RECORD_INDEX_SIZE - 1);
+}
+
+// Walk the EEPROM records once and index the record of each PGN with the given classification that findEEPROM() would
+// return. Areas are walked newest first, so once the index is full only older records are left out.
+// this function assumes that EEPROM content is valid
+static void buildEEPROMIndex(configRecordIndex_t *index, configRecordFlags_e classification)
+{
+    memset(index, 0, sizeof(*index));
+    index->complete = true;
+
+    int recordCount = 0;
+    for (int area = configLog.segmentCount; area >= 0; area--) {
+        const uint8_t *p = configRecordArea(area);
+        while (true) {
+            const configRecord_t *record = (const configRecord_t *)p;
+            if (record->size == 0
+                || p + record->size >= &__config_end
+                || record->size < sizeof(*record))
+                break;
+
+            const uintptr_t offset = p - &__config_start;
+            if ((record->flags & CR_CLASSIFICATION_MASK) == classification) {
+                if (recordCount >= CONFIG_RECORD_INDEX_MAX_FILL || offset > UINT16_MAX) {
+                    index->complete = false;
+                } else {
+                    unsigned slot = configRecordIndexSlot(record->pgn);
+                    while (index->offset[slot] && ((const configRecord_t *)(&__config_start + index->offset[slot]))->pgn != record->pgn) {
+                        slot = (slot + 1) & (CONFIG_RECORD_INDEX_SIZE - 1);
+                    }
+                    // keep the first record for a PGN, as findEEPROM() would
+                    if (!index->offset[slot]) {
+                        index->offset[slot] = offset;
+                        recordCount++;
+                    }
+                }
+            }
+
+            p += record->size;
+        }
+    }
+}
+
+static const configRecord_t *findEEPROMIndexed(const configRecordIndex_t *index, const pgRegistry_t *reg, configRecordFlags_e classification)
+{
+    unsigned slot = configRecordIndexSlot(pgN(reg));
+    while (index->offset[slot]) {
+        const configRecord_t *record = (const configRecord_t *)(&__config_start + index->offset[slot]);
+        if (record->pgn == pgN(reg)) {
+            return record;
+        }
+        slot = (slot + 1) & (CONFIG_RECORD_INDEX_SIZE - 1);
+    }
+
+    return index->complete ? NULL : findEEPROM(reg, classification);
+}
+
+// Returns true if the PG in RAM differs from its stored copy, or has none.
+static bool isPGModified(const configRecordIndex_t *index, const pgRegistry_t *reg)
+{
+    const configRecord_t *rec = findEEPROMIndexed(index, reg, CR_CLASSICATION_SYSTEM);
+    return !rec
+        || rec->version != pgVersion(reg)
+        || rec->size != sizeof(configRecord_t) + pgSize(reg)
+        || memcmp(rec->pg, reg->address, pgSize(reg)) != 0;
+}
+
+// Returns true if loading the EEPROM would give the settings that are in RAM.
+static bool isEEPROMUpToDate(void)
+{
+    configRecordIndex_t index;
+    buildEEPROMIndex(&index, CR_CLASSICATION_SYSTEM);
+
+    PG_FOREACH(reg) {
+        if (isPGModified(&index, reg)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 // Initialize all PG records from EEPROM.
-// This functions processes all PGs sequentially, scanning EEPROM for each one. This is suboptimal,
-//   but each PG is loaded/initialized exactly once and in defined order.
+// The records are indexed in a single pass first, then each PG is loaded/initialized exactly once and in defined order.
 bool loadEEPROM(void)
 {
     bool success = true;
 
+    configRecordIndex_t index;
+    buildEEPROMIndex(&index, CR_CLASSICATION_SYSTEM);
+
     PG_FOREACH(reg) {
-        const configRecord_t *rec = findEEPROM(reg, CR_CLASSICATION_SYSTEM);
+        const configRecord_t *rec = findEEPROMIndexed(&index, reg, CR_CLASSICATION_SYSTEM);
         if (rec) {
             // config from EEPROM is available, use it to initialize PG. pgLoad will handle version mismatch
             if (!pgLoad(reg, rec->pg, rec->size - offsetof(configRecord_t, pg), rec->version)) {
@@ -393,6 +603,59 @@ bool loadEEPROM(void)
     return success;
 }
 
+static uint16_t writeSettingsRecord(config_streamer_t *streamer, const pgRegistry_t *reg, uint16_t crc)
+{
+    const uint16_t regSize = pgSize(reg);
+    configRecord_t record = {
+        .size = sizeof(configRecord_t) + regSize,
+        .pgn = pgN(reg),
+        .version = pgVersion(reg),
+        .flags = 0
+    };
+
+    record.flags |= CR_CLASSICATION_SYSTEM;
+    config_streamer_write(streamer, (uint8_t *)&record, sizeof(record));
+    crc = crc16_ccitt_update(crc, (uint8_t *)&record, sizeof(record));
+    config_streamer_write(streamer, reg->address, regSize);
+    crc = crc16_ccitt_update(crc, reg->address, regSize);
+
+    return crc;
+}
+
+// Writes the footer and the checksum, pads to the next streamer word and returns the checksum as stored.
+static uint16_t writeSettingsFooter(config_streamer_t *streamer, uint16_t crc)
+{
+    configFooter_t footer = {
+        .terminator = 0,
+    };
+
+    config_streamer_write(streamer, (uint8_t *)&footer, sizeof(footer));
+    crc = crc16_ccitt_update(crc, (uint8_t *)&footer, sizeof(footer));
+
+    // include inverted CRC in big endian format in the CRC
+    const uint16_t invertedBigEndianCrc = ~(((crc & 0xFF) << 8) | (crc >> 8));
+    config_streamer_write(streamer, (uint8_t *)&invertedBigEndianCrc, sizeof(crc));
+
+    config_streamer_flush(streamer);
+
+    return invertedBigEndianCrc;
+}
+
+static uint16_t writeLogHeader(config_streamer_t *streamer, uint16_t sequence, uint16_t previousCrc)
+{
+    configLogHeader_t logHeader = {
+        .header = {
+            .eepromConfigVersion =  EEPROM_CONF_VERSION,
+            .magic_be =             CONFIG_LOG_MAGIC,
+        },
+        .sequence = sequence,
+    };
+
+    config_streamer_write(streamer, (uint8_t *)&logHeader, sizeof(logHeader));
+    return crc16_ccitt_update(previousCrc, (uint8_t *)&logHeader, sizeof(logHeader));
+}
+
+// Writes the whole config, followed by the empty segment that starts a new log.
 static bool writeSettingsToEEPROM(void)
 {
     config_streamer_t streamer;
@@ -409,33 +672,66 @@ static bool writeSettingsToEEPROM(void)
     uint16_t crc = CRC_START_VALUE;
     crc = crc16_ccitt_update(crc, (uint8_t *)&header, sizeof(header));
     PG_FOREACH(reg) {
-        const uint16_t regSize = pgSize(reg);
-        configRecord_t record = {
-            .size = sizeof(configRecord_t) + regSize,
-            .pgn = pgN(reg),
-            .version = pgVersion(reg),
-            .flags = 0
-        };
+        crc = writeSettingsRecord(&streamer, reg, crc);
+    }
+
+    const uint16_t storedCrc = writeSettingsFooter(&streamer, crc);
+
+    // continue the sequence of the previous log, if there was one
+    crc = writeLogHeader(&streamer, configLog.nextSequence, storedCrc);
+    writeSettingsFooter(&streamer, crc);
+
+    const bool success = config_streamer_finish(&streamer) == 0;
 
-        record.flags |= CR_CLASSICATION_SYSTEM;
-        config_streamer_write(&streamer, (uint8_t *)&record, sizeof(record));
-        crc = crc16_ccitt_update(crc, (uint8_t *)&record, sizeof(record));
-        config_streamer_write(&streamer, reg->address, regSize);
-        crc = crc16_ccitt_update(crc, reg->address, regSize);
+    return success;
+}
+
+// Appends the PGs that differ from the stored copy to the log. Returns false when they have to be saved by writing
+// the whole config instead, because the log is full or the stored copy was not written with one.
+static bool appendSettingsToEEPROM(void)
+{
+    if (!isEEPROMVersionValid() || !isEEPROMStructureValid()
+        || configLog.segmentCount == 0 || configLog.segmentCount == CONFIG_LOG_MAX_SEGMENTS) {
+        return false;
     }
 
-    configFooter_t footer = {
-        .terminator = 0,
-    };
+    configRecordIndex_t index;
+    buildEEPROMIndex(&index, CR_CLASSICATION_SYSTEM);
 
-    config_streamer_write(&streamer, (uint8_t *)&footer, sizeof(footer));
-    crc = crc16_ccitt_update(crc, (uint8_t *)&footer, sizeof(footer));
+    uint32_t segmentSize = sizeof(configLogHeader_t) + sizeof(configFooter_t) + sizeof(uint16_t);
+    int modifiedCount = 0;
+    PG_FOREACH(reg) {
+        if (isPGModified(&index, reg)) {
+            segmentSize += sizeof(configRecord_t) + pgSize(reg);
+            modifiedCount++;
+        }
+    }
 
-    // include inverted CRC in big endian format in the CRC
-    const uint16_t invertedBigEndianCrc = ~(((crc & 0xFF) << 8) | (crc >> 8));
-    config_streamer_write(&streamer, (uint8_t *)&invertedBigEndianCrc, sizeof(crc));
+    if (modifiedCount == 0) {
+        return true;
+    }
+
+    // the offsets must fit the record index
+    const uint32_t start = CONFIG_LOG_ALIGN(configLog.end);
+    const uint32_t end = start + CONFIG_LOG_ALIGN(segmentSize);
+    if (end >= (uint32_t)(&__config_end - &__config_start) || end > UINT16_MAX
+        || !config_streamer_is_writable((uintptr_t)(&__config_start + start), segmentSize)) {
+        return false;
+    }
+
+    config_streamer_t streamer;
+    config_streamer_init(&streamer);
+
+    config_streamer_start(&streamer, (uintptr_t)(&__config_start + start), &__config_end - &__config_start - start);
+
+    uint16_t crc = writeLogHeader(&streamer, configLog.nextSequence, configLog.lastCrc);
+    PG_FOREACH(reg) {
+        if (isPGModified(&index, reg)) {
+            crc = writeSettingsRecord(&streamer, reg, crc);
+        }
+    }
 
-    config_streamer_flush(&streamer);
+    writeSettingsFooter(&streamer, crc);
 
     const bool success = config_streamer_finish(&streamer) == 0;
 
@@ -447,7 +743,8 @@ void writeConfigToEEPROM(void)
     bool success = false;
     // write it
     for (int attempt = 0; attempt < 3 && !success; attempt++) {
-        if (writeSettingsToEEPROM()) {
+        // a failed attempt may leave a partial segment behind, so only the first one appends
+        if ((attempt == 0 && appendSettingsToEEPROM()) || writeSettingsToEEPROM()) {
             success = true;
 
 #ifdef CONFIG_IN_EXTERNAL_FLASH
@@ -459,10 +756,11 @@ void writeConfigToEEPROM(void)
             success = loadEEPROMFromSDCard();
 #endif
         }
-    }
 
+        success = success && isEEPROMVersionValid() && isEEPROMStructureValid() && isEEPROMUpToDate();
+    }
 
-    if (success && isEEPROMVersionValid() && isEEPROMStructureValid()) {
+    if (success) {
         return;
     }
 
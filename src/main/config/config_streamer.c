@@ -22,6 +22,8 @@
 
 #include "platform.h"
 
+#include "common/utils.h"
+
 #include "drivers/system.h"
 #include "drivers/flash.h"
 
@@ -90,8 +92,10 @@ void config_streamer_init(config_streamer_t *c)
 
 void config_streamer_start(config_streamer_t *c, uintptr_t base, int size)
 {
-    // base must start at FLASH_PAGE_SIZE boundary when using embedded flash.
+    // base must start at FLASH_PAGE_SIZE boundary when using embedded flash, unless the data is appended to what is
+    // there already, see config_streamer_is_writable().
     c->address = base;
+    c->start = base;
     c->size = size;
     if (!c->unlocked) {
 #if defined(CONFIG_IN_RAM) || defined(CONFIG_IN_EXTERNAL_FLASH) || defined(CONFIG_IN_SDCARD)
@@ -371,10 +375,10 @@ static int write_word(config_streamer_t *c, config_streamer_buffer_align_type_t
     uint32_t flashPageSize = flashGeometry->pageSize;
 
     bool onPageBoundary = (flashAddress % flashPageSize == 0);
-    if (onPageBoundary) {
+    bool firstWrite = (c->address == c->start);
+    if (onPageBoundary || firstWrite) {
 
-        bool firstPage = (flashAddress == flashStartAddress);
-        if (!firstPage) {
+        if (!firstWrite) {
             flashPageProgramFinish();
         }
 
@@ -511,6 +515,38 @@ int config_streamer_write(config_streamer_t *c, const uint8_t *p, uint32_t size)
     return c->err;
 }
 
+// Returns true if size bytes at address can be written without erasing them first. The streamer erases each page or
+// sector it starts writing, so only the part before the first such boundary has to be blank.
+bool config_streamer_is_writable(uintptr_t address, int size)
+{
+#if defined(CONFIG_IN_RAM) || defined(CONFIG_IN_SDCARD) || defined(CONFIG_IN_FILE)
+    UNUSED(address);
+    UNUSED(size);
+
+    return true;
+#else
+#if defined(CONFIG_IN_EXTERNAL_FLASH)
+    const flashPartition_t *flashPartition = flashPartitionFindByType(FLASH_PARTITION_TYPE_CONFIG);
+    const flashGeometry_t *flashGeometry = flashGetGeometry();
+
+    // eepromData mirrors the partition, which starts on a sector boundary
+    const uint32_t eraseSize = flashGeometry->sectorSize;
+    const uint32_t offset = (uint32_t)(address - (uintptr_t)&eepromData[0]) + flashPartition->startSector * flashGeometry->sectorSize;
+#else
+    const uint32_t eraseSize = FLASH_PAGE_SIZE;
+    const uintptr_t offset = address;
+#endif
+    const uint8_t *p = (const uint8_t *)address;
+    for (int i = 0; i < size && (offset + i) % eraseSize != 0; i++) {
+        if (p[i] != 0xFF) {
+            return false;
+        }
+    }
+
+    return true;
+#endif
+}
+
 int config_streamer_status(config_streamer_t *c)
 {
     return c->err;
@@ -42,6 +42,7 @@ typedef uint32_t config_streamer_buffer_align_type_t;
 
 typedef struct config_streamer_s {
     uintptr_t address;
+    uintptr_t start;
     int size;
     union {
         uint8_t b[CONFIG_STREAMER_BUFFER_SIZE];
@@ -56,6 +57,7 @@ void config_streamer_init(config_streamer_t *c);
 
 void config_streamer_start(config_streamer_t *c, uintptr_t base, int size);
 int config_streamer_write(config_streamer_t *c, const uint8_t *p, uint32_t size);
+bool config_streamer_is_writable(uintptr_t address, int size);
 int config_streamer_flush(config_streamer_t *c);
 
 int config_streamer_finish(config_streamer_t *c);
@@ -123,3 +123,19 @@ void serialEndWrite(serialPort_t *instance)
     if (instance->vTable->endWrite)
         instance->vTable->endWrite(instance);
 }
+
+void serialSetRxSpanCallback(serialPort_t *instance, serialReceiveSpanCallbackPtr rxSpanCallback)
+{
+    instance->rxSpanCallback = rxSpanCallback;
+}
+
+void serialReceiveSpan(serialPort_t *instance, const uint8_t *data, uint32_t length, timeUs_t arrivalTimeUs)
+{
+    if (instance->rxSpanCallback) {
+        instance->rxSpanCallback(data, length, arrivalTimeUs, instance->rxCallbackData);
+    } else if (instance->rxCallback) {
+        for (uint32_t i = 0; i < length; i++) {
+            instance->rxCallback(data[i], instance->rxCallbackData);
+        }
+    }
+}
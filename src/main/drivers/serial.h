@@ -20,6 +20,8 @@
 
 #pragma once
 
+#include "common/time.h"
+
 #include "drivers/io.h"
 #include "drivers/io_types.h"
 #include "drivers/resource.h"
@@ -59,6 +61,8 @@ typedef enum {
 #define CTRL_LINE_STATE_RTS (1 << 1)
 
 typedef void (*serialReceiveCallbackPtr)(uint16_t data, void *rxCallbackData);   // used by serial drivers to return frames to app
+// used by serial drivers that receive several bytes at once, e.g. by DMA up to an idle line, arrivalTimeUs is when the last byte arrived
+typedef void (*serialReceiveSpanCallbackPtr)(const uint8_t *data, uint32_t length, timeUs_t arrivalTimeUs, void *rxCallbackData);
 typedef void (*serialIdleCallbackPtr)();
 
 typedef struct serialPort_s {
@@ -80,6 +84,7 @@ typedef struct serialPort_s {
     uint32_t txBufferTail;
 
     serialReceiveCallbackPtr rxCallback;
+    serialReceiveSpanCallbackPtr rxSpanCallback;
     void *rxCallbackData;
 
     serialIdleCallbackPtr idleCallback;
@@ -145,3 +150,8 @@ uint32_t serialGetBaudRate(serialPort_t *instance);
 void serialWriteBufShim(void *instance, const uint8_t *data, int count);
 void serialBeginWrite(serialPort_t *instance);
 void serialEndWrite(serialPort_t *instance);
+
+// Receivers that can parse a span of bytes at once register for it next to their byte callback.
+void serialSetRxSpanCallback(serialPort_t *instance, serialReceiveSpanCallbackPtr rxSpanCallback);
+// Used by drivers to pass received bytes to the receiver, a byte at a time if it has no span callback.
+void serialReceiveSpan(serialPort_t *instance, const uint8_t *data, uint32_t length, timeUs_t arrivalTimeUs);
@@ -27,8 +27,16 @@
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <errno.h>
 
+#include <sched.h>
+#include <unistd.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+
 #include "platform.h"
 
 #include "build/build_config.h"
@@ -47,36 +55,185 @@ static bool tcpStart = false;
 bool tcpIsStart(void) {
     return tcpStart;
 }
-static void onData(dyad_Event *e) {
-    tcpPort_t* s = (tcpPort_t*)(e->udata);
-    tcpDataIn(s, (uint8_t*)e->data, e->size);
+
+static bool tcpIsConnected(const tcpPort_t *s)
+{
+    return __atomic_load_n(&s->connected, __ATOMIC_ACQUIRE);
 }
-static void onClose(dyad_Event *e) {
-    tcpPort_t* s = (tcpPort_t*)(e->udata);
-    s->clientCount--;
-    s->conn = NULL;
-    fprintf(stderr, "[CLS]UART%u: %d,%d\n", s->id + 1, s->connected, s->clientCount);
-    if (s->clientCount == 0) {
-        s->connected = false;
+
+// flight loop: have the I/O thread look at the port, at most one wake up is outstanding
+static void tcpWake(tcpPort_t *s)
+{
+    if (!__atomic_exchange_n(&s->wakePending, true, __ATOMIC_ACQ_REL)) {
+        const uint64_t one = 1;
+        const ssize_t ret = write(s->wake.fd, &one, sizeof(one));
+        UNUSED(ret);
     }
 }
-static void onAccept(dyad_Event *e) {
-    tcpPort_t* s = (tcpPort_t*)(e->udata);
-    fprintf(stderr, "New connection on UART%u, %d\n", s->id + 1, s->clientCount);
 
-    s->connected = true;
-    if (s->clientCount > 0) {
-        dyad_close(e->remote);
+// Everything below up to the vTable runs on the I/O thread
+
+static void tcpUpdateClientEvents(tcpPort_t *s)
+{
+    eventLoopModify(&s->client, (s->rxPaused ? 0 : EPOLLIN) | (s->txPending ? EPOLLOUT : 0));
+}
+
+static void tcpClose(tcpPort_t *s)
+{
+    const int fd = s->client.fd;
+    eventLoopRemove(&s->client);
+    close(fd);
+
+    // drop what wasn't sent
+    spscRingConsume(&s->txRing, spscRingCount(&s->txRing));
+    __atomic_store_n(&s->connected, false, __ATOMIC_RELEASE);
+    fprintf(stderr, "[CLS]UART%u\n", s->id + 1);
+}
+
+static void tcpFlushTx(tcpPort_t *s)
+{
+    const uint8_t *data;
+    uint32_t len;
+    while ((len = spscRingReadSpan(&s->txRing, &data)) > 0) {
+        const ssize_t sent = send(s->client.fd, data, len, MSG_NOSIGNAL);
+        if (sent < 0) {
+            if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                break;
+            }
+            tcpClose(s);
+            return;
+        }
+        spscRingConsume(&s->txRing, sent);
+    }
+
+    const bool txPending = spscRingCount(&s->txRing) > 0;
+    if (txPending != s->txPending) {
+        s->txPending = txPending;
+        tcpUpdateClientEvents(s);
+    }
+}
+
+static void tcpFillRx(tcpPort_t *s)
+{
+    while (true) {
+        uint8_t *data;
+        const uint32_t len = spscRingWriteSpan(&s->rxRing, &data);
+        if (len == 0) {
+            // stop reading the socket until the flight loop has made some space
+            __atomic_store_n(&s->rxPaused, true, __ATOMIC_RELEASE);
+            // the store must be seen before the free space is read, tcpRead() does the same the other way round,
+            // otherwise both sides can miss each other and reception stays paused
+            __atomic_thread_fence(__ATOMIC_SEQ_CST);
+            if (spscRingFree(&s->rxRing) > 0) {
+                // it already did, before it could see rxPaused
+                __atomic_store_n(&s->rxPaused, false, __ATOMIC_RELEASE);
+                continue;
+            }
+            tcpUpdateClientEvents(s);
+            return;
+        }
+        const ssize_t received = recv(s->client.fd, data, len, 0);
+        if (received > 0) {
+            spscRingCommit(&s->rxRing, received);
+        } else if (received < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            return;
+        } else {
+            tcpClose(s);
+            return;
+        }
+    }
+}
+
+static void onClientEvent(uint32_t events, void *data)
+{
+    tcpPort_t *s = data;
+
+    if (events & EPOLLOUT) {
+        tcpFlushTx(s);
+    }
+    // read what is left before a hang up, recv() then reports the end of the connection
+    if ((events & EPOLLIN) && tcpIsConnected(s)) {
+        tcpFillRx(s);
+    }
+    if ((events & (EPOLLHUP | EPOLLERR)) && tcpIsConnected(s)) {
+        tcpClose(s);
+    }
+}
+
+static void onWake(uint32_t events, void *data)
+{
+    UNUSED(events);
+    tcpPort_t *s = data;
+
+    uint64_t count;
+    const ssize_t ret = read(s->wake.fd, &count, sizeof(count));
+    UNUSED(ret);
+    // data written from here on needs another wake up
+    __atomic_store_n(&s->wakePending, false, __ATOMIC_RELEASE);
+    // the store must be seen before the rings are read, or data written just before it has no wake up
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+    if (!tcpIsConnected(s)) {
+        return;
+    }
+    if (!s->txPending) {
+        tcpFlushTx(s);
+    }
+    if (tcpIsConnected(s) && s->rxPaused && spscRingFree(&s->rxRing) > 0) {
+        __atomic_store_n(&s->rxPaused, false, __ATOMIC_RELEASE);
+        tcpUpdateClientEvents(s);
+    }
+}
+
+static void onAccept(uint32_t events, void *data)
+{
+    UNUSED(events);
+    tcpPort_t *s = data;
+
+    const int fd = accept4(s->listener.fd, NULL, NULL, SOCK_NONBLOCK | SOCK_CLOEXEC);
+    if (fd < 0) {
+        return;
+    }
+    fprintf(stderr, "New connection on UART%u\n", s->id + 1);
+
+    if (tcpIsConnected(s)) {
+        close(fd);
         return;
     }
-    s->clientCount++;
-    fprintf(stderr, "[NEW]UART%u: %d,%d\n", s->id + 1, s->connected, s->clientCount);
-    s->conn = e->remote;
-    dyad_setNoDelay(e->remote, 1);
-    dyad_setTimeout(e->remote, 120);
-    dyad_addListener(e->remote, DYAD_EVENT_DATA, onData, e->udata);
-    dyad_addListener(e->remote, DYAD_EVENT_CLOSE, onClose, e->udata);
+
+    const int one = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+
+    s->rxPaused = false;
+    s->txPending = false;
+    eventLoopAdd(&s->client, fd, EPOLLIN, onClientEvent, s);
+    __atomic_store_n(&s->connected, true, __ATOMIC_RELEASE);
+    fprintf(stderr, "[NEW]UART%u\n", s->id + 1);
 }
+
+static int tcpListen(int port)
+{
+    const int fd = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (fd < 0) {
+        return -1;
+    }
+
+    const int one = 1;
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    addr.sin_port = htons(port);
+
+    if (bind(fd, (const struct sockaddr *)&addr, sizeof(addr)) < 0 || listen(fd, 10) < 0) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
 static tcpPort_t* tcpReconfigure(tcpPort_t *s, int id)
 {
     if (tcpPortInitialized[id]) {
@@ -84,14 +241,9 @@ static tcpPort_t* tcpReconfigure(tcpPort_t *s, int id)
         return s;
     }
 
-    if (pthread_mutex_init(&s->txLock, NULL) != 0) {
-        fprintf(stderr, "TX mutex init failed - %d\n", errno);
-        // TODO: clean up & re-init
-        return NULL;
-    }
-    if (pthread_mutex_init(&s->rxLock, NULL) != 0) {
-        fprintf(stderr, "RX mutex init failed - %d\n", errno);
-        // TODO: clean up & re-init
+    const int wakeFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (wakeFd < 0) {
+        fprintf(stderr, "eventfd failed - %d\n", errno);
         return NULL;
     }
 
@@ -99,14 +251,18 @@ static tcpPort_t* tcpReconfigure(tcpPort_t *s, int id)
     tcpPortInitialized[id] = true;
 
     s->connected = false;
-    s->clientCount = 0;
+    s->wakePending = false;
+    s->rxPaused = false;
+    s->txPending = false;
+    s->writing = false;
     s->id = id;
-    s->conn = NULL;
-    s->serv = dyad_newStream();
-    dyad_setNoDelay(s->serv, 1);
-    dyad_addListener(s->serv, DYAD_EVENT_ACCEPT, onAccept, s);
+    spscRingInit(&s->rxRing, s->rxBuffer, RX_BUFFER_SIZE);
+    spscRingInit(&s->txRing, s->txBuffer, TX_BUFFER_SIZE);
+    eventLoopAdd(&s->wake, wakeFd, EPOLLIN, onWake, s);
 
-    if (dyad_listenEx(s->serv, NULL, BASE_PORT + id + 1, 10) == 0) {
+    const int listenFd = tcpListen(BASE_PORT + id + 1);
+    if (listenFd >= 0) {
+        eventLoopAdd(&s->listener, listenFd, EPOLLIN, onAccept, s);
         fprintf(stderr, "bind port %u for UART%u\n", (unsigned)BASE_PORT + id + 1, (unsigned)id + 1);
     } else {
         fprintf(stderr, "bind port %u for UART%u failed!!\n", (unsigned)BASE_PORT + id + 1, (unsigned)id + 1);
@@ -129,6 +285,7 @@ serialPort_t *serTcpOpen(int id, serialReceiveCallbackPtr rxCallback, void *rxCa
     s->port.vTable = &tcpVTable;
 
     // common serial initialisation code should move to serialPort::init()
+    // the buffers are managed by the rings, head and tail are unused
     s->port.rxBufferHead = s->port.rxBufferTail = 0;
     s->port.txBufferHead = s->port.txBufferTail = 0;
     s->port.rxBufferSize = RX_BUFFER_SIZE;
@@ -146,116 +303,78 @@ serialPort_t *serTcpOpen(int id, serialReceiveCallbackPtr rxCallback, void *rxCa
     return (serialPort_t *)s;
 }
 
+// The vTable functions run on the flight loop
+
 uint32_t tcpTotalRxBytesWaiting(const serialPort_t *instance)
 {
-    tcpPort_t *s = (tcpPort_t*)instance;
-    uint32_t count;
-    pthread_mutex_lock(&s->rxLock);
-    if (s->port.rxBufferHead >= s->port.rxBufferTail) {
-        count = s->port.rxBufferHead - s->port.rxBufferTail;
-    } else {
-        count = s->port.rxBufferSize + s->port.rxBufferHead - s->port.rxBufferTail;
-    }
-    pthread_mutex_unlock(&s->rxLock);
-
-    return count;
+    const tcpPort_t *s = (const tcpPort_t *)instance;
+    return spscRingCount(&s->rxRing);
 }
 
 uint32_t tcpTotalTxBytesFree(const serialPort_t *instance)
 {
-    tcpPort_t *s = (tcpPort_t*)instance;
-    uint32_t bytesUsed;
-
-    pthread_mutex_lock(&s->txLock);
-    if (s->port.txBufferHead >= s->port.txBufferTail) {
-        bytesUsed = s->port.txBufferHead - s->port.txBufferTail;
-    } else {
-        bytesUsed = s->port.txBufferSize + s->port.txBufferHead - s->port.txBufferTail;
-    }
-    uint32_t bytesFree = (s->port.txBufferSize - 1) - bytesUsed;
-    pthread_mutex_unlock(&s->txLock);
-
-    return bytesFree;
+    const tcpPort_t *s = (const tcpPort_t *)instance;
+    return spscRingFree(&s->txRing);
 }
 
 bool isTcpTransmitBufferEmpty(const serialPort_t *instance)
 {
-    tcpPort_t *s = (tcpPort_t *)instance;
-    pthread_mutex_lock(&s->txLock);
-    bool isEmpty = s->port.txBufferTail == s->port.txBufferHead;
-    pthread_mutex_unlock(&s->txLock);
-    return isEmpty;
+    const tcpPort_t *s = (const tcpPort_t *)instance;
+    return spscRingCount(&s->txRing) == 0;
 }
 
 uint8_t tcpRead(serialPort_t *instance)
 {
-    uint8_t ch;
     tcpPort_t *s = (tcpPort_t *)instance;
-    pthread_mutex_lock(&s->rxLock);
+    uint8_t ch = 0;
+    spscRingRead(&s->rxRing, &ch, 1);
 
-    ch = s->port.rxBuffer[s->port.rxBufferTail];
-    if (s->port.rxBufferTail + 1 >= s->port.rxBufferSize) {
-        s->port.rxBufferTail = 0;
-    } else {
-        s->port.rxBufferTail++;
+    // pairs with the fence in tcpFillRx()
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    if (__atomic_load_n(&s->rxPaused, __ATOMIC_ACQUIRE)) {
+        tcpWake(s);
     }
-    pthread_mutex_unlock(&s->rxLock);
-
     return ch;
 }
 
-void tcpWrite(serialPort_t *instance, uint8_t ch)
+void tcpWriteBuf(serialPort_t *instance, const void *data, int count)
 {
     tcpPort_t *s = (tcpPort_t *)instance;
-    pthread_mutex_lock(&s->txLock);
+    const uint8_t *p = data;
+
+    // nobody to send to
+    while (count > 0 && tcpIsConnected(s)) {
+        const uint32_t written = spscRingWrite(&s->txRing, p, count);
+        p += written;
+        count -= written;
+        if (count > 0) {
+            // block until the I/O thread has made space, like a UART
+            tcpWake(s);
+            sched_yield();
+        }
+    }
 
-    s->port.txBuffer[s->port.txBufferHead] = ch;
-    if (s->port.txBufferHead + 1 >= s->port.txBufferSize) {
-        s->port.txBufferHead = 0;
-    } else {
-        s->port.txBufferHead++;
+    if (!s->writing) {
+        tcpWake(s);
     }
-    pthread_mutex_unlock(&s->txLock);
+}
 
-    tcpDataOut(s);
+void tcpWrite(serialPort_t *instance, uint8_t ch)
+{
+    tcpWriteBuf(instance, &ch, 1);
 }
 
-void tcpDataOut(tcpPort_t *instance)
+static void tcpBeginWrite(serialPort_t *instance)
 {
     tcpPort_t *s = (tcpPort_t *)instance;
-    if (s->conn == NULL) return;
-    pthread_mutex_lock(&s->txLock);
-
-    if (s->port.txBufferHead < s->port.txBufferTail) {
-        // send data till end of buffer
-        int chunk = s->port.txBufferSize - s->port.txBufferTail;
-        dyad_write(s->conn, (const void *)&s->port.txBuffer[s->port.txBufferTail], chunk);
-        s->port.txBufferTail = 0;
-    }
-    int chunk = s->port.txBufferHead - s->port.txBufferTail;
-    if (chunk)
-        dyad_write(s->conn, (const void*)&s->port.txBuffer[s->port.txBufferTail], chunk);
-    s->port.txBufferTail = s->port.txBufferHead;
-
-    pthread_mutex_unlock(&s->txLock);
+    s->writing = true;
 }
 
-void tcpDataIn(tcpPort_t *instance, uint8_t* ch, int size)
+static void tcpEndWrite(serialPort_t *instance)
 {
     tcpPort_t *s = (tcpPort_t *)instance;
-    pthread_mutex_lock(&s->rxLock);
-
-    while (size--) {
-//        printf("%c", *ch);
-        s->port.rxBuffer[s->port.rxBufferHead] = *(ch++);
-        if (s->port.rxBufferHead + 1 >= s->port.rxBufferSize) {
-            s->port.rxBufferHead = 0;
-        } else {
-            s->port.rxBufferHead++;
-        }
-    }
-    pthread_mutex_unlock(&s->rxLock);
-//    printf("\n");
+    s->writing = false;
+    tcpWake(s);
 }
 
 static const struct serialPortVTable tcpVTable = {
@@ -268,7 +387,7 @@ static const struct serialPortVTable tcpVTable = {
         .setMode = NULL,
         .setCtrlLineStateCb = NULL,
         .setBaudRateCb = NULL,
-        .writeBuf = NULL,
-        .beginWrite = NULL,
-        .endWrite = NULL,
+        .writeBuf = tcpWriteBuf,
+        .beginWrite = tcpBeginWrite,
+        .endWrite = tcpEndWrite,
 };
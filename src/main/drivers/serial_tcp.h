@@ -20,33 +20,34 @@
 
 #pragma once
 
-#include <netinet/in.h>
-#include <pthread.h>
-#include "dyad.h"
+#include "common/spsc_ring.h"
 
-#define RX_BUFFER_SIZE    1400
-#define TX_BUFFER_SIZE    1400
+#include "target/SITL/eventloop.h"
+
+// must be powers of two
+#define RX_BUFFER_SIZE    2048
+#define TX_BUFFER_SIZE    2048
 
 typedef struct {
     serialPort_t port;
     uint8_t rxBuffer[RX_BUFFER_SIZE];
     uint8_t txBuffer[TX_BUFFER_SIZE];
 
-    dyad_Stream *serv;
-    dyad_Stream *conn;
-    pthread_mutex_t txLock;
-    pthread_mutex_t rxLock;
+    // the I/O thread produces rxRing and consumes txRing, the flight loop does the opposite
+    spscRing_t rxRing;
+    spscRing_t txRing;
+
+    eventLoopSource_t listener;
+    eventLoopSource_t client;
+    eventLoopSource_t wake;     // eventfd, signalled by the flight loop for new TX data or free RX space
     bool connected;
-    uint16_t clientCount;
+    bool wakePending;
+    bool rxPaused;              // rxRing is full, the client socket isn't read until it has space
+    bool txPending;             // the client socket is full, waiting for EPOLLOUT
+    bool writing;               // between beginWrite and endWrite
     uint8_t id;
 } tcpPort_t;
 
 serialPort_t *serTcpOpen(int id, serialReceiveCallbackPtr rxCallback, void *rxCallbackData, uint32_t baudRate, portMode_e mode, portOptions_e options);
 
-// tcpPort API
-void tcpDataIn(tcpPort_t *instance, uint8_t* ch, int size);
-void tcpDataOut(tcpPort_t *instance);
-
 bool tcpIsStart(void);
-bool* tcpGetUsed(void);
-tcpPort_t* tcpGetPool(void);
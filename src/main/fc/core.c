@@ -1152,7 +1152,7 @@ static FAST_CODE_NOINLINE void subTaskPidSubprocesses(timeUs_t currentTimeUs)
 
 #ifdef USE_BLACKBOX
     if (!cliMode && blackboxConfig()->device) {
-        blackboxUpdate(currentTimeUs);
+        blackboxCapture(currentTimeUs);
     }
 #else
     UNUSED(currentTimeUs);
@@ -24,6 +24,8 @@
 
 #include "platform.h"
 
+#include "blackbox/blackbox.h"
+
 #include "build/debug.h"
 
 #include "cli/cli.h"
@@ -207,6 +209,15 @@ static void taskTelemetry(timeUs_t currentTimeUs)
 }
 #endif
 
+#ifdef USE_BLACKBOX
+static void taskBlackbox(timeUs_t currentTimeUs)
+{
+    if (!cliMode) {
+        blackboxUpdate(currentTimeUs);
+    }
+}
+#endif
+
 #ifdef USE_CAMERA_CONTROL
 static void taskCameraControl(uint32_t currentTime)
 {
@@ -339,6 +350,11 @@ void tasksInit(void)
     setTaskEnabled(TASK_PINIOBOX, true);
 #endif
 
+#ifdef USE_BLACKBOX
+    setTaskEnabled(TASK_BLACKBOX, blackboxConfig()->device);
+    rescheduleTask(TASK_BLACKBOX, blackboxGetTaskPeriodUs());
+#endif
+
 #ifdef USE_CMS
 #ifdef USE_MSP_DISPLAYPORT
     setTaskEnabled(TASK_CMS, true);
@@ -475,6 +491,10 @@ task_t tasks[TASK_COUNT] = {
     [TASK_PINIOBOX] = DEFINE_TASK("PINIOBOX", NULL, NULL, pinioBoxUpdate, TASK_PERIOD_HZ(20), TASK_PRIORITY_IDLE),
 #endif
 
+#ifdef USE_BLACKBOX
+    [TASK_BLACKBOX] = DEFINE_TASK("BLACKBOX", NULL, NULL, taskBlackbox, TASK_PERIOD_HZ(1000), TASK_PRIORITY_MEDIUM), // Rescheduled from the logging rate by tasksInit()
+#endif
+
 #ifdef USE_RANGEFINDER
     [TASK_RANGEFINDER] = DEFINE_TASK("RANGEFINDER", NULL, NULL, rangefinderUpdate, TASK_PERIOD_HZ(10), TASK_PRIORITY_IDLE),
 #endif
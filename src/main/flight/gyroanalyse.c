@@ -81,10 +81,26 @@
 // Each FFT output bin has width fftSamplingRateHz/32, ie 41.65Hz per bin at 1333Hz
 // Usable bandwidth is half this, ie 666Hz if fftSamplingRateHz is 1333Hz, i.e. bin 1 is 41.65hz, bin 2 83.3hz etc
 
+// With dyn_notch_estimator = SDFT the same 32 sample window is analysed with a sliding DFT instead.
+// Every downsampled sample updates the 17 bins of each axis in place, a few multiplies per bin, so there is no
+// batch to split up. The bins are kept relative to the start of the circular buffer, so a sample is added and
+// later removed with the same twiddle factor. That cancels the sample itself exactly, but the rounding of each
+// update is not damped and still adds up slowly over a long flight, well below the gyro noise floor.
+// Then one axis per gyro loop gets its bin magnitudes, peak and notch filters updated, in the same tick.
+// At 8k each axis is updated for every downsampled sample, every 0.75ms instead of 1.5ms,
+// and the spectrum it uses is never more than 2 gyro loops old.
+// The Hanning window is applied to the bins, by combining each one with its neighbours.
+
+// dyn_notch_count notches (or pairs of notches, with dyn_notch_width_percent) are placed on each axis, and each
+// follows its own peak in the spectrum, so frame resonances and motor noise can be notched at the same time.
+// More notches cost a biquad per gyro loop each, and a filter update per axis update.
+
 #define DYN_NOTCH_SMOOTH_HZ       4
 #define FFT_BIN_COUNT             (FFT_WINDOW_SIZE / 2) // 16
 #define DYN_NOTCH_CALC_TICKS      (XYZ_AXIS_COUNT * 4) // 4 steps per axis
 #define DYN_NOTCH_OSD_MIN_THROTTLE 20
+#define DYN_NOTCH_ACQUIRE_PERCENT 25 // a smaller peak needs this much of the tallest peak to get a notch
+#define DYN_NOTCH_RELEASE_PERCENT 15 // and keeps its notch until it drops below this
 
 static uint16_t FAST_RAM_ZERO_INIT   fftSamplingRateHz;
 static float FAST_RAM_ZERO_INIT      fftResolution;
@@ -94,12 +110,18 @@ static float FAST_RAM_ZERO_INIT      dynNotch1Ctr;
 static float FAST_RAM_ZERO_INIT      dynNotch2Ctr;
 static uint16_t FAST_RAM_ZERO_INIT   dynNotchMinHz;
 static uint16_t FAST_RAM_ZERO_INIT   dynNotchMaxHz;
+static uint8_t FAST_RAM_ZERO_INIT    dynNotchCount;
 static bool FAST_RAM                 dualNotch = true;
 static uint16_t FAST_RAM_ZERO_INIT   dynNotchMaxFFT;
 static float FAST_RAM_ZERO_INIT      smoothFactor;
 static uint8_t FAST_RAM_ZERO_INIT    samples;
 // Hanning window, see https://en.wikipedia.org/wiki/Window_function#Hann_.28Hanning.29_window
 static FAST_RAM_ZERO_INIT float hanningWindow[FFT_WINDOW_SIZE];
+static uint8_t FAST_RAM_ZERO_INIT    dynNotchEstimator;
+// sliding DFT twiddle factors, e^(-2*pi*i*n/FFT_WINDOW_SIZE)
+static FAST_RAM_ZERO_INIT float sdftTwiddleRe[FFT_WINDOW_SIZE];
+static FAST_RAM_ZERO_INIT float sdftTwiddleIm[FFT_WINDOW_SIZE];
+static float FAST_RAM_ZERO_INIT      sdftSmoothFactor;
 
 void gyroDataAnalyseInit(uint32_t targetLooptimeUs)
 {
@@ -116,10 +138,12 @@ void gyroDataAnalyseInit(uint32_t targetLooptimeUs)
     dynNotchQ = gyroConfig()->dyn_notch_q / 100.0f;
     dynNotchMinHz = gyroConfig()->dyn_notch_min_hz;
     dynNotchMaxHz = MAX(2 * dynNotchMinHz, gyroConfig()->dyn_notch_max_hz);
+    dynNotchCount = constrain(gyroConfig()->dyn_notch_count, 1, DYN_NOTCH_COUNT_MAX);
 
     if (gyroConfig()->dyn_notch_width_percent == 0) {
         dualNotch = false;
     }
+    dynNotchEstimator = gyroConfig()->dyn_notch_estimator;
 
     const int gyroLoopRateHz = lrintf((1.0f / targetLooptimeUs) * 1e6f);
     samples = MAX(1, gyroLoopRateHz / (2 * dynNotchMaxHz)); //600hz, 8k looptime, 13.333
@@ -139,6 +163,14 @@ void gyroDataAnalyseInit(uint32_t targetLooptimeUs)
     for (int i = 0; i < FFT_WINDOW_SIZE; i++) {
         hanningWindow[i] = (0.5f - 0.5f * cos_approx(2 * M_PIf * i / (FFT_WINDOW_SIZE - 1)));
     }
+
+    for (int i = 0; i < FFT_WINDOW_SIZE; i++) {
+        sdftTwiddleRe[i] = cos_approx(2 * M_PIf * i / FFT_WINDOW_SIZE);
+        sdftTwiddleIm[i] = -sin_approx(2 * M_PIf * i / FFT_WINDOW_SIZE);
+    }
+    // each axis is updated for every downsampled sample, or every third gyro loop if that is less often
+    const int sdftUpdateRateHz = MIN(fftSamplingRateHz, gyroLoopRateHz / XYZ_AXIS_COUNT);
+    sdftSmoothFactor = 2 * M_PIf * DYN_NOTCH_SMOOTH_HZ / sdftUpdateRateHz;
 }
 
 void gyroDataAnalyseStateInit(gyroAnalyseState_t *state, uint32_t targetLooptimeUs)
@@ -149,9 +181,21 @@ void gyroDataAnalyseStateInit(gyroAnalyseState_t *state, uint32_t targetLooptime
     state->maxSampleCountRcp = 1.0f / state->maxSampleCount;
     arm_rfft_fast_init_f32(&state->fftInstance, FFT_WINDOW_SIZE);
     for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
-        // any init value
-        state->centerFreq[axis] = dynNotchMaxHz;
+        // any init value, spread out so that each notch is nearest to a different part of the range
+        for (int notch = 0; notch < dynNotchCount; notch++) {
+            state->centerFreq[axis][notch] = dynNotchMaxHz - notch * (dynNotchMaxHz - dynNotchMinHz) / dynNotchCount;
+        }
+        state->notchTrackingMask[axis] = 0;
+        // the sliding DFT bins must match the contents of the circular buffer
+        for (int i = 0; i < FFT_WINDOW_SIZE; i++) {
+            state->downsampledGyroData[axis][i] = 0;
+        }
+        for (int i = 0; i < SDFT_BIN_COUNT; i++) {
+            state->sdftRe[axis][i] = 0;
+            state->sdftIm[axis][i] = 0;
+        }
     }
+    state->sdftPendingAxes = 0;
 }
 
 void gyroDataAnalysePush(gyroAnalyseState_t *state, const int axis, const float sample)
@@ -159,12 +203,33 @@ void gyroDataAnalysePush(gyroAnalyseState_t *state, const int axis, const float
     state->oversampledGyroAccumulator[axis] += sample;
 }
 
-static void gyroDataAnalyseUpdate(gyroAnalyseState_t *state, biquadFilter_t *notchFilterDyn, biquadFilter_t *notchFilterDyn2);
+static void gyroDataAnalyseUpdate(gyroAnalyseState_t *state, biquadFilterBank_t *notchFilterDyn, biquadFilterBank_t *notchFilterDyn2);
+static void gyroDataAnalyseSdftUpdate(gyroAnalyseState_t *state, biquadFilterBank_t *notchFilterDyn, biquadFilterBank_t *notchFilterDyn2);
+
+/*
+ * Slide the DFT window of one axis by one sample: replace the sample leaving the window, which is still in the
+ * circular buffer, with the new one. Bin k holds the sum of sample[n] * e^(-2*pi*i*k*n/FFT_WINDOW_SIZE) over the
+ * circular buffer index n.
+ */
+static FAST_CODE void sdftPush(gyroAnalyseState_t *state, const int axis, const float sample)
+{
+    const uint8_t idx = state->circularBufferIdx;
+    const float delta = sample - state->downsampledGyroData[axis][idx];
+    float *binRe = state->sdftRe[axis];
+    float *binIm = state->sdftIm[axis];
+
+    uint8_t twiddleIdx = 0;
+    for (int i = 0; i < SDFT_BIN_COUNT; i++) {
+        binRe[i] += delta * sdftTwiddleRe[twiddleIdx];
+        binIm[i] += delta * sdftTwiddleIm[twiddleIdx];
+        twiddleIdx = (twiddleIdx + idx) % FFT_WINDOW_SIZE;
+    }
+}
 
 /*
  * Collect gyro data, to be analysed in gyroDataAnalyseUpdate function
  */
-void gyroDataAnalyse(gyroAnalyseState_t *state, biquadFilter_t *notchFilterDyn, biquadFilter_t *notchFilterDyn2)
+void gyroDataAnalyse(gyroAnalyseState_t *state, biquadFilterBank_t *notchFilterDyn, biquadFilterBank_t *notchFilterDyn2)
 {
     // samples should have been pushed by `gyroDataAnalysePush`
     // if gyro sampling is > 1kHz, accumulate and average multiple gyro samples
@@ -176,6 +241,9 @@ void gyroDataAnalyse(gyroAnalyseState_t *state, biquadFilter_t *notchFilterDyn,
         // calculate mean value of accumulated samples
         for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
             float sample = state->oversampledGyroAccumulator[axis] * state->maxSampleCountRcp;
+            if (dynNotchEstimator == DYN_NOTCH_ESTIMATOR_SDFT) {
+                sdftPush(state, axis, sample);
+            }
             state->downsampledGyroData[axis][state->circularBufferIdx] = sample;
             if (axis == 0) {
                 DEBUG_SET(DEBUG_FFT, 2, lrintf(sample));
@@ -186,6 +254,9 @@ void gyroDataAnalyse(gyroAnalyseState_t *state, biquadFilter_t *notchFilterDyn,
 
         state->circularBufferIdx = (state->circularBufferIdx + 1) % FFT_WINDOW_SIZE;
 
+        // the sliding DFT bins of all axes are up to date now
+        state->sdftPendingAxes = BIT(XYZ_AXIS_COUNT) - 1;
+
         // We need DYN_NOTCH_CALC_TICKS tick to update all axis with newly sampled value
         // recalculation of filters takes 4 calls per axis => each filter gets updated every DYN_NOTCH_CALC_TICKS calls
         // at 4kHz gyro loop rate this means 8kHz / 4 / 3 = 666Hz => update every 1.5ms
@@ -193,6 +264,12 @@ void gyroDataAnalyse(gyroAnalyseState_t *state, biquadFilter_t *notchFilterDyn,
         state->updateTicks = DYN_NOTCH_CALC_TICKS;
     }
 
+    // update one axis per tick
+    if (dynNotchEstimator == DYN_NOTCH_ESTIMATOR_SDFT) {
+        gyroDataAnalyseSdftUpdate(state, notchFilterDyn, notchFilterDyn2);
+        return;
+    }
+
     // calculate FFT and update filters
     if (state->updateTicks > 0) {
         gyroDataAnalyseUpdate(state, notchFilterDyn, notchFilterDyn2);
@@ -206,10 +283,176 @@ void arm_cfft_radix8by4_f32(arm_cfft_instance_f32 *S, float32_t *p1);
 void arm_radix8_butterfly_f32(float32_t *pSrc, uint16_t fftLen, const float32_t *pCoef, uint16_t twidCoefModifier);
 void arm_bitreversal_32(uint32_t *pSrc, const uint16_t bitRevLen, const uint16_t *pBitRevTable);
 
+/*
+ * Measure the peak at binMax in the bin magnitudes in state->fftData, returns its frequency in Hz and how much it
+ * stands out from the bins around it
+ */
+static float gyroDataAnalysePeakFreq(const gyroAnalyseState_t *state, const int binMax, float *dynamicFactor, float *fftMeanIndex)
+{
+    float dataMin = 1.0f;
+    float dataMinHi = 1.0f;
+    for (int i = binMax - 1; i > 1; i--) { // look for min below max
+        dataMin = state->fftData[i];
+        if (state->fftData[i - 1] > state->fftData[i]) { // up step below this one
+            break;
+        }
+    }
+    for (int i = binMax + 1; i < (FFT_BIN_COUNT - 1); i++) { // // look for min above max
+        dataMinHi = state->fftData[i];
+        if (state->fftData[i] < state->fftData[i + 1]) { // up step above this one
+            break;
+        }
+    }
+    dataMin = fminf(dataMin, dataMinHi);
+
+    // accumulate fftSum and fftWeightedSum from peak bin, and shoulder bins either side of peak
+    float squaredData = state->fftData[binMax] * state->fftData[binMax];
+    float fftSum = squaredData;
+    float fftWeightedSum = squaredData * binMax;
+
+    // accumulate upper shoulder unless it would be FFT_BIN_COUNT
+    uint8_t shoulderBin = binMax + 1;
+    if (shoulderBin < FFT_BIN_COUNT) {
+        squaredData = state->fftData[shoulderBin] * state->fftData[shoulderBin];
+        fftSum += squaredData;
+        fftWeightedSum += squaredData * shoulderBin;
+    }
+
+    // accumulate lower shoulder unless lower shoulder would be bin 0 (DC)
+    if (binMax > 1) {
+        shoulderBin = binMax - 1;
+        squaredData = state->fftData[shoulderBin] * state->fftData[shoulderBin];
+        fftSum += squaredData;
+        fftWeightedSum += squaredData * shoulderBin;
+    }
+
+    // PT1 style dynamic smoothing moves rapidly towards big peaks and slowly away, up to 8x faster
+    *dynamicFactor = constrainf(state->fftData[binMax] / dataMin, 1.0f, 8.0f);
+
+    // get centerFreq in Hz from weighted bins
+    *fftMeanIndex = 0;
+    if (fftSum > 0) {
+        *fftMeanIndex = (fftWeightedSum / fftSum);
+        // In theory, the index points to the centre frequency of the bin.
+        // at 1333hz, bin widths are 41.65Hz, so bin 2 has the range 83,3Hz to 124,95Hz
+        // Rav feels that maybe centerFreq = (fftMeanIndex + 0.5) * fftResolution; is better
+        // empirical checking shows that not adding 0.5 works better
+        return constrainf(*fftMeanIndex * fftResolution, dynNotchMinHz, dynNotchMaxHz);
+    }
+    return 0;
+}
+
+/*
+ * Find the tallest noise peaks in the bin magnitudes in state->fftData and move the centre frequency of each notch
+ * of the axis towards one of them.
+ * Peaks are handed out tallest first, each to the nearest notch that is still free, so a notch keeps following the
+ * same peak as it moves. The tallest peak is always followed. A notch only picks up a smaller one if it is at least
+ * DYN_NOTCH_ACQUIRE_PERCENT of the tallest, and lets it go once it drops below DYN_NOTCH_RELEASE_PERCENT.
+ * Notches without a peak hold their frequency.
+ */
+static FAST_CODE_NOINLINE void gyroDataAnalyseCalculateCenterFreq(gyroAnalyseState_t *state, const int axis, const float smoothK)
+{
+    float *centerFreq = state->centerFreq[axis];
+
+    // find the tallest local maxima, tallest first
+    uint8_t peakBin[DYN_NOTCH_COUNT_MAX];
+    int peakCount = 0;
+    for (int i = fftStartBin; i < FFT_BIN_COUNT; i++) {
+        const float data = state->fftData[i];
+        if (data > state->fftData[i - 1] && (i == FFT_BIN_COUNT - 1 || data >= state->fftData[i + 1])) {
+            int j = MIN(peakCount, dynNotchCount - 1);
+            if (j == peakCount || data > state->fftData[peakBin[j]]) {
+                for (; j > 0 && data > state->fftData[peakBin[j - 1]]; j--) {
+                    peakBin[j] = peakBin[j - 1];
+                }
+                peakBin[j] = i;
+                peakCount = MIN(peakCount + 1, dynNotchCount);
+            }
+        }
+    }
+
+    if (peakCount == 0) {
+        // no bin increase, hold prev max bin, dataMin = 1 dataMax = 0, ie move slow
+        for (int notch = 0; notch < dynNotchCount; notch++) {
+            const int binMax = constrain(lrintf(centerFreq[notch] / fftResolution), 1, FFT_BIN_COUNT - 1);
+            float dynamicFactor;
+            float fftMeanIndex;
+            const float peakFreq = gyroDataAnalysePeakFreq(state, binMax, &dynamicFactor, &fftMeanIndex);
+            if (peakFreq > 0) {
+                centerFreq[notch] += smoothK * (peakFreq - centerFreq[notch]);
+            }
+            if (calculateThrottlePercentAbs() > DYN_NOTCH_OSD_MIN_THROTTLE) {
+                dynNotchMaxFFT = MAX(dynNotchMaxFFT, centerFreq[notch]);
+            }
+        }
+        if (axis == 0) {
+            DEBUG_SET(DEBUG_FFT, 3, 0);
+            DEBUG_SET(DEBUG_FFT_FREQ, 0, centerFreq[0]);
+            DEBUG_SET(DEBUG_FFT_FREQ, 1, 100);
+            DEBUG_SET(DEBUG_DYN_LPF, 1, centerFreq[0]);
+        }
+        state->notchTrackingMask[axis] = 0;
+        return;
+    }
+
+    const float dataMax = state->fftData[peakBin[0]];
+    uint8_t trackingMask = 0;
+    for (int peak = 0; peak < peakCount; peak++) {
+        float dynamicFactor;
+        float fftMeanIndex;
+        const float peakFreq = gyroDataAnalysePeakFreq(state, peakBin[peak], &dynamicFactor, &fftMeanIndex);
+        if (peakFreq == 0) {
+            continue;
+        }
+
+        int nearest = -1;
+        for (int notch = 0; notch < dynNotchCount; notch++) {
+            if (!(trackingMask & BIT(notch)) && (nearest < 0 || fabsf(centerFreq[notch] - peakFreq) < fabsf(centerFreq[nearest] - peakFreq))) {
+                nearest = notch;
+            }
+        }
+        if (peak > 0) {
+            const int thresholdPercent = (state->notchTrackingMask[axis] & BIT(nearest)) ? DYN_NOTCH_RELEASE_PERCENT : DYN_NOTCH_ACQUIRE_PERCENT;
+            if (state->fftData[peakBin[peak]] * 100 < dataMax * thresholdPercent) {
+                break;
+            }
+        }
+        trackingMask |= BIT(nearest);
+
+        centerFreq[nearest] += smoothK * dynamicFactor * (peakFreq - centerFreq[nearest]);
+
+        if(calculateThrottlePercentAbs() > DYN_NOTCH_OSD_MIN_THROTTLE) {
+            dynNotchMaxFFT = MAX(dynNotchMaxFFT, centerFreq[nearest]);
+        }
+
+        if (axis == 0 && peak == 0) {
+            DEBUG_SET(DEBUG_FFT, 3, lrintf(fftMeanIndex * 100));
+            DEBUG_SET(DEBUG_FFT_FREQ, 0, centerFreq[nearest]);
+            DEBUG_SET(DEBUG_FFT_FREQ, 1, lrintf(dynamicFactor * 100));
+            DEBUG_SET(DEBUG_DYN_LPF, 1, centerFreq[nearest]);
+        }
+    }
+    state->notchTrackingMask[axis] = trackingMask;
+}
+
+static FAST_CODE_NOINLINE void gyroDataAnalyseUpdateNotches(gyroAnalyseState_t *state, const int axis, biquadFilterBank_t *notchFilterDyn, biquadFilterBank_t *notchFilterDyn2)
+{
+    // calculate cutoffFreq and notch Q, update notch filter
+    for (int notch = 0; notch < dynNotchCount; notch++) {
+        const float centerFreq = state->centerFreq[axis][notch];
+        if (dualNotch) {
+            biquadFilterBankUpdateAxis(&notchFilterDyn[notch], axis, centerFreq * dynNotch1Ctr, gyro.targetLooptime, dynNotchQ, FILTER_NOTCH);
+            biquadFilterBankUpdateAxis(&notchFilterDyn2[notch], axis, centerFreq * dynNotch2Ctr, gyro.targetLooptime, dynNotchQ, FILTER_NOTCH);
+        } else {
+            biquadFilterBankUpdateAxis(&notchFilterDyn[notch], axis, centerFreq, gyro.targetLooptime, dynNotchQ, FILTER_NOTCH);
+        }
+    }
+}
+
 /*
  * Analyse gyro data
  */
-static FAST_CODE_NOINLINE void gyroDataAnalyseUpdate(gyroAnalyseState_t *state, biquadFilter_t *notchFilterDyn, biquadFilter_t *notchFilterDyn2)
+static FAST_CODE_NOINLINE void gyroDataAnalyseUpdate(gyroAnalyseState_t *state, biquadFilterBank_t *notchFilterDyn, biquadFilterBank_t *notchFilterDyn2)
 {
     enum {
         STEP_ARM_CFFT_F32,
@@ -278,90 +521,7 @@ static FAST_CODE_NOINLINE void gyroDataAnalyseUpdate(gyroAnalyseState_t *state,
         }
         case STEP_CALC_FREQUENCIES:
         {
-            // identify max bin and max/min heights
-            float dataMax = 0.0f;
-            float dataMin = 1.0f;
-            uint8_t binMax = 0;
-            float dataMinHi = 1.0f;
-            for (int i = fftStartBin; i < FFT_BIN_COUNT; i++) {
-                if (state->fftData[i] > state->fftData[i - 1]) { // bin height increased
-                    if (state->fftData[i] > dataMax) {
-                        dataMax = state->fftData[i];
-                        binMax = i;  // tallest bin so far
-                    }
-                }
-            }
-            if (binMax == 0) { // no bin increase, hold prev max bin, dataMin = 1 dataMax = 0, ie move slow
-                binMax = lrintf(state->centerFreq[state->updateAxis] / fftResolution);
-            } else { // there was a max, find min
-                for (int i = binMax - 1; i > 1; i--) { // look for min below max
-                    dataMin = state->fftData[i];
-                    if (state->fftData[i - 1] > state->fftData[i]) { // up step below this one
-                        break;
-                    }
-                }
-                for (int i = binMax + 1; i < (FFT_BIN_COUNT - 1); i++) { // // look for min above max
-                    dataMinHi = state->fftData[i];
-                    if (state->fftData[i] < state->fftData[i + 1]) { // up step above this one
-                        break;
-                    }
-                }
-            }
-            dataMin = fminf(dataMin, dataMinHi);
-
-            // accumulate fftSum and fftWeightedSum from peak bin, and shoulder bins either side of peak
-            float squaredData = state->fftData[binMax] * state->fftData[binMax];
-            float fftSum = squaredData;
-            float fftWeightedSum = squaredData * binMax;
-
-            // accumulate upper shoulder unless it would be FFT_BIN_COUNT
-            uint8_t shoulderBin = binMax + 1;
-            if (shoulderBin < FFT_BIN_COUNT) {
-                squaredData = state->fftData[shoulderBin] * state->fftData[shoulderBin];
-                fftSum += squaredData;
-                fftWeightedSum += squaredData * shoulderBin;
-            }
-
-            // accumulate lower shoulder unless lower shoulder would be bin 0 (DC)
-            if (binMax > 1) {
-                shoulderBin = binMax - 1;
-                squaredData = state->fftData[shoulderBin] * state->fftData[shoulderBin];
-                fftSum += squaredData;
-                fftWeightedSum += squaredData * shoulderBin;
-            }
-
-            // get centerFreq in Hz from weighted bins
-            float centerFreq = dynNotchMaxHz;
-            float fftMeanIndex = 0;
-            if (fftSum > 0) {
-                fftMeanIndex = (fftWeightedSum / fftSum);
-                centerFreq = fftMeanIndex * fftResolution;
-                // In theory, the index points to the centre frequency of the bin.
-                // at 1333hz, bin widths are 41.65Hz, so bin 2 has the range 83,3Hz to 124,95Hz
-                // Rav feels that maybe centerFreq = (fftMeanIndex + 0.5) * fftResolution; is better
-                // empirical checking shows that not adding 0.5 works better
-            } else {
-                centerFreq = state->centerFreq[state->updateAxis];
-            }
-            centerFreq = constrainf(centerFreq, dynNotchMinHz, dynNotchMaxHz);
-
-            // PT1 style dynamic smoothing moves rapidly towards big peaks and slowly away, up to 8x faster
-            float dynamicFactor = constrainf(dataMax / dataMin, 1.0f, 8.0f);
-            state->centerFreq[state->updateAxis] = state->centerFreq[state->updateAxis] + smoothFactor * dynamicFactor * (centerFreq - state->centerFreq[state->updateAxis]);
-
-            if(calculateThrottlePercentAbs() > DYN_NOTCH_OSD_MIN_THROTTLE) {
-                dynNotchMaxFFT = MAX(dynNotchMaxFFT, state->centerFreq[state->updateAxis]);
-            }
-
-            if (state->updateAxis == 0) {
-                DEBUG_SET(DEBUG_FFT, 3, lrintf(fftMeanIndex * 100));
-                DEBUG_SET(DEBUG_FFT_FREQ, 0, state->centerFreq[state->updateAxis]);
-                DEBUG_SET(DEBUG_FFT_FREQ, 1, lrintf(dynamicFactor * 100));
-                DEBUG_SET(DEBUG_DYN_LPF, 1, state->centerFreq[state->updateAxis]);
-            }
-//            if (state->updateAxis == 1) {
-//            DEBUG_SET(DEBUG_FFT_FREQ, 1, state->centerFreq[state->updateAxis]);
-//            }
+            gyroDataAnalyseCalculateCenterFreq(state, state->updateAxis, smoothFactor);
             DEBUG_SET(DEBUG_FFT_TIME, 1, micros() - startTime);
 
             break;
@@ -369,13 +529,7 @@ static FAST_CODE_NOINLINE void gyroDataAnalyseUpdate(gyroAnalyseState_t *state,
         case STEP_UPDATE_FILTERS:
         {
             // 7us
-            // calculate cutoffFreq and notch Q, update notch filter
-            if (dualNotch) {
-                biquadFilterUpdate(&notchFilterDyn[state->updateAxis], state->centerFreq[state->updateAxis] * dynNotch1Ctr, gyro.targetLooptime, dynNotchQ, FILTER_NOTCH);
-                biquadFilterUpdate(&notchFilterDyn2[state->updateAxis], state->centerFreq[state->updateAxis] * dynNotch2Ctr, gyro.targetLooptime, dynNotchQ, FILTER_NOTCH);
-            } else {
-                biquadFilterUpdate(&notchFilterDyn[state->updateAxis], state->centerFreq[state->updateAxis], gyro.targetLooptime, dynNotchQ, FILTER_NOTCH);
-            }
+            gyroDataAnalyseUpdateNotches(state, state->updateAxis, notchFilterDyn, notchFilterDyn2);
             DEBUG_SET(DEBUG_FFT_TIME, 1, micros() - startTime);
 
             state->updateAxis = (state->updateAxis + 1) % XYZ_AXIS_COUNT;
@@ -399,6 +553,48 @@ static FAST_CODE_NOINLINE void gyroDataAnalyseUpdate(gyroAnalyseState_t *state,
     state->updateStep = (state->updateStep + 1) % STEP_COUNT;
 }
 
+/*
+ * Sliding DFT estimator: update the bin magnitudes, centre frequency and notch filters of the next axis with new data
+ */
+static FAST_CODE_NOINLINE void gyroDataAnalyseSdftUpdate(gyroAnalyseState_t *state, biquadFilterBank_t *notchFilterDyn, biquadFilterBank_t *notchFilterDyn2)
+{
+    const int axis = state->updateAxis;
+    if (!(state->sdftPendingAxes & BIT(axis))) {
+        return;
+    }
+
+    uint32_t startTime = 0;
+    if (debugMode == (DEBUG_FFT_TIME)) {
+        startTime = micros();
+    }
+
+    // rotate the bins so that the window starts at the oldest sample, like the FFT input
+    float binRe[SDFT_BIN_COUNT];
+    float binIm[SDFT_BIN_COUNT];
+    uint8_t twiddleIdx = 0;
+    for (int i = 0; i < SDFT_BIN_COUNT; i++) {
+        const float re = state->sdftRe[axis][i];
+        const float im = state->sdftIm[axis][i];
+        binRe[i] = re * sdftTwiddleRe[twiddleIdx] + im * sdftTwiddleIm[twiddleIdx];
+        binIm[i] = im * sdftTwiddleRe[twiddleIdx] - re * sdftTwiddleIm[twiddleIdx];
+        twiddleIdx = (twiddleIdx + state->circularBufferIdx) % FFT_WINDOW_SIZE;
+    }
+
+    // Hanning window the bins by combining each with its neighbours, bin 0 isn't used
+    for (int i = 1; i < FFT_BIN_COUNT; i++) {
+        const float re = 0.5f * binRe[i] - 0.25f * (binRe[i - 1] + binRe[i + 1]);
+        const float im = 0.5f * binIm[i] - 0.25f * (binIm[i - 1] + binIm[i + 1]);
+        state->fftData[i] = sqrtf(re * re + im * im);
+    }
+
+    gyroDataAnalyseCalculateCenterFreq(state, axis, sdftSmoothFactor);
+    gyroDataAnalyseUpdateNotches(state, axis, notchFilterDyn, notchFilterDyn2);
+
+    state->sdftPendingAxes &= ~BIT(axis);
+    state->updateAxis = (axis + 1) % XYZ_AXIS_COUNT;
+
+    DEBUG_SET(DEBUG_FFT_TIME, 1, micros() - startTime);
+}
 
 uint16_t getMaxFFT(void) {
     return dynNotchMaxFFT;
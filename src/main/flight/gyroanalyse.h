@@ -25,6 +25,8 @@
 #include "common/filter.h"
 
 #define FFT_WINDOW_SIZE 32
+#define SDFT_BIN_COUNT  (FFT_WINDOW_SIZE / 2 + 1) // DC to Nyquist
+#define DYN_NOTCH_COUNT_MAX 5
 
 typedef struct gyroAnalyseState_s {
     // accumulator for oversampled data => no aliasing and less noise
@@ -46,7 +48,14 @@ typedef struct gyroAnalyseState_s {
     float fftData[FFT_WINDOW_SIZE];
     float rfftData[FFT_WINDOW_SIZE];
 
-    float centerFreq[XYZ_AXIS_COUNT];
+    // sliding DFT of downsampledGyroData, updated with every downsampled sample
+    float sdftRe[XYZ_AXIS_COUNT][SDFT_BIN_COUNT];
+    float sdftIm[XYZ_AXIS_COUNT][SDFT_BIN_COUNT];
+    uint8_t sdftPendingAxes;    // bit per axis with new data since its notches were last updated
+
+    // centre frequency of each dynamic notch, each follows its own noise peak
+    float centerFreq[XYZ_AXIS_COUNT][DYN_NOTCH_COUNT_MAX];
+    uint8_t notchTrackingMask[XYZ_AXIS_COUNT];  // bit per notch that was given a peak at the last update
 
 } gyroAnalyseState_t;
 
@@ -54,6 +63,7 @@ STATIC_ASSERT(FFT_WINDOW_SIZE <= (uint8_t) -1, window_size_greater_than_underlyi
 
 void gyroDataAnalyseStateInit(gyroAnalyseState_t *state, uint32_t targetLooptimeUs);
 void gyroDataAnalysePush(gyroAnalyseState_t *state, const int axis, const float sample);
-void gyroDataAnalyse(gyroAnalyseState_t *state, biquadFilter_t *notchFilterDyn, biquadFilter_t *notchFilterDyn2);
+// notchFilterDyn and notchFilterDyn2 are arrays of DYN_NOTCH_COUNT_MAX filter banks, one per tracked peak
+void gyroDataAnalyse(gyroAnalyseState_t *state, biquadFilterBank_t *notchFilterDyn, biquadFilterBank_t *notchFilterDyn2);
 uint16_t getMaxFFT(void);
 void resetMaxFFT(void);
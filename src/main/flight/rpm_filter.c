@@ -21,6 +21,7 @@
 
 #include <math.h>
 #include <stdint.h>
+#include <string.h>
 
 #include "platform.h"
 
@@ -45,6 +46,8 @@
 #include "rpm_filter.h"
 
 #define RPM_FILTER_MAXHARMONICS 3
+#define RPM_FILTER_MAXNOTCHES   (MAX_SUPPORTED_MOTORS * RPM_FILTER_MAXHARMONICS)
+#define RPM_NOTCH_FADE_RANGE_HZ 50.0f
 #define SECONDS_PER_MINUTE      60.0f
 #define ERPM_PER_LSB            100.0f
 #define MIN_UPDATE_T            0.001f
@@ -52,6 +55,17 @@
 
 static pt1Filter_t rpmFilters[MAX_SUPPORTED_MOTORS];
 
+typedef struct rpmNotchState_s
+{
+    float x1[XYZ_AXIS_COUNT];
+    float x2[XYZ_AXIS_COUNT];
+    float y1[XYZ_AXIS_COUNT];
+    float y2[XYZ_AXIS_COUNT];
+} rpmNotchState_t;
+
+// Notches are indexed by motor * harmonics + harmonic. The coefficients are the
+// same for every axis, so they are stored once, only the state is per axis.
+// Each notch is applied to all three axes at once, the axes being independent.
 typedef struct rpmNotchFilter_s
 {
     uint8_t harmonics;
@@ -60,7 +74,16 @@ typedef struct rpmNotchFilter_s
     float   q;
     float   loopTime;
 
-    biquadFilter_t notch[XYZ_AXIS_COUNT][MAX_SUPPORTED_MOTORS][RPM_FILTER_MAXHARMONICS];
+    float b0[RPM_FILTER_MAXNOTCHES];    // b2 == b0 for a notch
+    float b1[RPM_FILTER_MAXNOTCHES];
+    float a1[RPM_FILTER_MAXNOTCHES];
+    float a2[RPM_FILTER_MAXNOTCHES];
+    float weight[RPM_FILTER_MAXNOTCHES]; // 0 = notch off, 1 = notch fully applied
+
+    uint8_t activeCount;
+    uint8_t active[RPM_FILTER_MAXNOTCHES]; // indices of the notches with a non zero weight
+
+    rpmNotchState_t state[RPM_FILTER_MAXNOTCHES];
 } rpmNotchFilter_t;
 
 FAST_RAM_ZERO_INIT static float   erpmToHz;
@@ -103,14 +126,10 @@ static void rpmNotchFilterInit(rpmNotchFilter_t* filter, int harmonics, int minH
     filter->q = q / 100.0f;
     filter->loopTime = looptime;
 
-    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
-        for (int motor = 0; motor < getMotorCount(); motor++) {
-            for (int i = 0; i < harmonics; i++) {
-                biquadFilterInit(
-                    &filter->notch[axis][motor][i], minHz * i, looptime, filter->q, FILTER_NOTCH);
-            }
-        }
-    }
+    // all notches start switched off, rpmFilterUpdate() enables them once the motors spin
+    memset(filter->weight, 0, sizeof(filter->weight));
+    memset(filter->state, 0, sizeof(filter->state));
+    filter->activeCount = 0;
 }
 
 void rpmFilterInit(const rpmFilterConfig_t *config)
@@ -156,27 +175,63 @@ void rpmFilterInit(const rpmFilterConfig_t *config)
     filterUpdatesPerIteration = rintf(filtersPerLoopIteration + 0.49f);
 }
 
-static float applyFilter(rpmNotchFilter_t* filter, int axis, float value)
+static void applyFilter(rpmNotchFilter_t* filter, float *values)
 {
     if (filter == NULL) {
-        return value;
+        return;
     }
-    for (int motor = 0; motor < getMotorCount(); motor++) {
-        for (int i = 0; i < filter->harmonics; i++) {
-            value = biquadFilterApplyDF1(&filter->notch[axis][motor][i], value);
+    for (int n = 0; n < filter->activeCount; n++) {
+        const int i = filter->active[n];
+        const float b0 = filter->b0[i];
+        const float b1 = filter->b1[i];
+        const float a1 = filter->a1[i];
+        const float a2 = filter->a2[i];
+        const float weight = filter->weight[i];
+        rpmNotchState_t *state = &filter->state[i];
+
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            // direct form 1, as the coefficients change while flying
+            const float input = values[axis];
+            const float result = b0 * (input + state->x2[axis]) + b1 * state->x1[axis] - a1 * state->y1[axis] - a2 * state->y2[axis];
+            state->x2[axis] = state->x1[axis];
+            state->x1[axis] = input;
+            state->y2[axis] = state->y1[axis];
+            state->y1[axis] = result;
+
+            // crossfade notches which are fading in or out at the edges of the band
+            values[axis] = input + weight * (result - input);
         }
     }
-    return value;
 }
 
-float rpmFilterGyro(int axis, float value)
+static void updateActiveNotches(rpmNotchFilter_t* filter)
 {
-    return applyFilter(gyroFilter, axis, value);
+    const int notchCount = getMotorCount() * filter->harmonics;
+    uint8_t activeCount = 0;
+    for (int i = 0; i < notchCount; i++) {
+        if (filter->weight[i] > 0.0f) {
+            filter->active[activeCount++] = i;
+        }
+    }
+    filter->activeCount = activeCount;
 }
 
-float rpmFilterDterm(int axis, float value)
+// Inside [minHz, maxHz] the notches follow the motors at full depth, clamped to the edges of the band. Beyond
+// the edges they fade out over RPM_NOTCH_FADE_RANGE_HZ, so the notch of an idling motor or of a harmonic
+// past nyquist drops out of the active list instead of staying parked at the edge.
+STATIC_UNIT_TESTED float rpmNotchWeight(float frequency, float minHz, float maxHz)
 {
-    return applyFilter(dtermFilter, axis, value);
+    return constrainf(1.0f + MIN(frequency - minHz, maxHz - frequency) / RPM_NOTCH_FADE_RANGE_HZ, 0.0f, 1.0f);
+}
+
+FAST_CODE void rpmFilterGyro(float *values)
+{
+    applyFilter(gyroFilter, values);
+}
+
+FAST_CODE void rpmFilterDterm(float *values)
+{
+    applyFilter(dtermFilter, values);
 }
 
 FAST_RAM_ZERO_INIT static float motorFrequency[MAX_SUPPORTED_MOTORS];
@@ -195,23 +250,32 @@ FAST_CODE_NOINLINE void rpmFilterUpdate()
     }
 
     for (int i = 0; i < filterUpdatesPerIteration; i++) {
-        float frequency = constrainf(
-            (currentHarmonic + 1) * motorFrequency[currentMotor], currentFilter->minHz, currentFilter->maxHz);
-        biquadFilter_t* template = &currentFilter->notch[0][currentMotor][currentHarmonic];
+        const int notch = currentMotor * currentFilter->harmonics + currentHarmonic;
+        const float harmonicFrequency = (currentHarmonic + 1) * motorFrequency[currentMotor];
+        const float frequency = constrainf(harmonicFrequency, currentFilter->minHz, currentFilter->maxHz);
+        const float weight = rpmNotchWeight(harmonicFrequency, currentFilter->minHz, currentFilter->maxHz);
         // uncomment below to debug filter stepping. Need to also comment out motor rpm DEBUG_SET above
         /* DEBUG_SET(DEBUG_RPM_FILTER, 0, harmonic); */
         /* DEBUG_SET(DEBUG_RPM_FILTER, 1, motor); */
         /* DEBUG_SET(DEBUG_RPM_FILTER, 2, currentFilter == &gyroFilter); */
         /* DEBUG_SET(DEBUG_RPM_FILTER, 3, frequency) */
-        biquadFilterUpdate(
-            template, frequency, currentFilter->loopTime, currentFilter->q, FILTER_NOTCH);
-        for (int axis = 1; axis < XYZ_AXIS_COUNT; axis++) {
-            biquadFilter_t* clone = &currentFilter->notch[axis][currentMotor][currentHarmonic];
-            clone->b0 = template->b0;
-            clone->b1 = template->b1;
-            clone->b2 = template->b2;
-            clone->a1 = template->a1;
-            clone->a2 = template->a2;
+        const bool wasActive = currentFilter->weight[notch] > 0.0f;
+        if (weight > 0.0f) {
+            biquadFilter_t coefficients;
+            biquadFilterInit(&coefficients, frequency, currentFilter->loopTime, currentFilter->q, FILTER_NOTCH);
+            currentFilter->b0[notch] = coefficients.b0;
+            currentFilter->b1[notch] = coefficients.b1;
+            currentFilter->a1[notch] = coefficients.a1;
+            currentFilter->a2[notch] = coefficients.a2;
+            if (!wasActive) {
+                // the state of a notch that was off is stale, restart it from rest
+                memset(&currentFilter->state[notch], 0, sizeof(rpmNotchState_t));
+            }
+        }
+        currentFilter->weight[notch] = weight;
+
+        if (wasActive != (weight > 0.0f)) {
+            updateActiveNotches(currentFilter);
         }
 
         if (++currentHarmonic == currentFilter->harmonics) {
@@ -39,8 +39,8 @@ typedef struct rpmFilterConfig_s
 PG_DECLARE(rpmFilterConfig_t, rpmFilterConfig);
 
 void  rpmFilterInit(const rpmFilterConfig_t *config);
-float rpmFilterGyro(int axis, float values);
-float rpmFilterDterm(int axis, float values);
+void  rpmFilterGyro(float *values);
+void  rpmFilterDterm(float *values);
 void  rpmFilterUpdate();
 bool isRpmFilterEnabled(void);
 float rpmMinMotorFrequency();
@@ -425,6 +425,8 @@ serialPort_t *openSerialPort(
     }
 
     serialPort->identifier = identifier;
+    // set by the receiver after opening, if it can take spans
+    serialPort->rxSpanCallback = NULL;
 
     serialPortUsage->function = function;
     serialPortUsage->serialPort = serialPort;
@@ -40,6 +40,7 @@
 #include "common/bitarray.h"
 #include "common/color.h"
 #include "common/huffman.h"
+#include "common/lz.h"
 #include "common/maths.h"
 #include "common/streambuf.h"
 #include "common/utils.h"
@@ -63,6 +64,7 @@
 #include "drivers/serial.h"
 #include "drivers/serial_escserial.h"
 #include "drivers/system.h"
+#include "drivers/time.h"
 #include "drivers/transponder_ir.h"
 #include "drivers/usb_msc.h"
 #include "drivers/vtx_common.h"
@@ -378,6 +380,15 @@ static void mspRebootFn(serialPort_t *serialPort)
     while (true) ;
 }
 
+#if defined(USE_TASK_HISTOGRAMS)
+static void serializeHistogram(sbuf_t *dst, const histogram_t *histogram)
+{
+    for (int i = 0; i < HISTOGRAM_BUCKET_COUNT; i++) {
+        sbufWriteU16(dst, histogram->count[i]);
+    }
+}
+#endif
+
 static void serializeSDCardSummaryReply(sbuf_t *dst)
 {
     uint8_t flags = 0;
@@ -461,10 +472,39 @@ static void serializeDataflashSummaryReply(sbuf_t *dst)
 #ifdef USE_FLASHFS
 enum compressionType_e {
     NO_COMPRESSION,
-    HUFFMAN
+    HUFFMAN,
+    LZ
 };
 
-static void serializeDataflashReadReply(sbuf_t *dst, uint32_t address, const uint16_t size, bool useLegacyFormat, bool allowCompression)
+// The client sends a mask of the methods it can decode, older clients just send 1 to allow Huffman
+#define COMPRESSION_ALLOWED(methods, method) ((methods) & (1 << ((method) - 1)))
+
+#ifdef USE_LZ
+// The compressor state is too large to keep for the odd flash download, so it borrows the blackbox snapshot ring,
+// which is idle unless a log is running. Without it the reply falls back to Huffman.
+static lzState_t *getLzState(void)
+{
+    return blackboxBorrowSnapshotRing(sizeof(lzState_t));
+}
+#endif
+
+static uint8_t selectCompressionMethod(uint8_t allowedMethods)
+{
+#ifdef USE_LZ
+    if (COMPRESSION_ALLOWED(allowedMethods, LZ) && getLzState()) {
+        return LZ;
+    }
+#endif
+#ifdef USE_HUFFMAN
+    if (COMPRESSION_ALLOWED(allowedMethods, HUFFMAN)) {
+        return HUFFMAN;
+    }
+#endif
+    UNUSED(allowedMethods);
+    return NO_COMPRESSION;
+}
+
+static void serializeDataflashReadReply(sbuf_t *dst, uint32_t address, const uint16_t size, bool useLegacyFormat, uint8_t allowedCompressionMethods)
 {
     STATIC_ASSERT(MSP_PORT_DATAFLASH_INFO_SIZE >= 16, MSP_PORT_DATAFLASH_INFO_SIZE_invalid);
 
@@ -482,12 +522,7 @@ static void serializeDataflashReadReply(sbuf_t *dst, uint32_t address, const uin
     sbufWriteU32(dst, address);
 
     // legacy format does not support compression
-#ifdef USE_HUFFMAN
-    const uint8_t compressionMethod = (!allowCompression || useLegacyFormat) ? NO_COMPRESSION : HUFFMAN;
-#else
-    const uint8_t compressionMethod = NO_COMPRESSION;
-    UNUSED(allowCompression);
-#endif
+    const uint8_t compressionMethod = useLegacyFormat ? NO_COMPRESSION : selectCompressionMethod(allowedCompressionMethods);
 
     if (compressionMethod == NO_COMPRESSION) {
 
@@ -513,6 +548,35 @@ static void serializeDataflashReadReply(sbuf_t *dst, uint32_t address, const uin
                 sbufWriteU8(dst, 0);
             }
         }
+#ifdef USE_LZ
+    } else if (compressionMethod == LZ) {
+        lzState_t *lzState = getLzState();
+        lzInit(lzState, sbufPtr(dst) + sizeof(uint16_t) + sizeof(uint8_t) + LZ_INFO_SIZE, readLen);
+
+        // read straight into the compressor's window until the output might overflow, flash is exhausted,
+        // or the uncompressed byte count would overflow (long runs of erased flash compress very well)
+        uint16_t bytesReadTotal = 0;
+        while (address + bytesReadTotal < flashfsSize) {
+            const int blockLen = MIN(MIN(lzBlockCapacity(lzState), UINT16_MAX - bytesReadTotal), flashfsSize - address - bytesReadTotal);
+            if (blockLen <= 0) {
+                break;
+            }
+            const int bytesRead = flashfsReadAbs(address + bytesReadTotal, lzBlockBuffer(lzState), blockLen);
+            if (bytesRead <= 0) {
+                break;
+            }
+            lzEncodeBlock(lzState, bytesRead);
+            bytesReadTotal += bytesRead;
+        }
+        const int bytesWritten = lzFinish(lzState);
+
+        // header
+        sbufWriteU16(dst, LZ_INFO_SIZE + bytesWritten);
+        sbufWriteU8(dst, compressionMethod);
+        // payload
+        sbufWriteU16(dst, bytesReadTotal);
+        sbufAdvance(dst, bytesWritten);
+#endif
     } else {
 #ifdef USE_HUFFMAN
         // compress in 256-byte chunks
@@ -557,6 +621,98 @@ static void serializeDataflashReadReply(sbuf_t *dst, uint32_t address, const uin
 }
 #endif // USE_FLASHFS
 
+// The handlers that process commands, in the order they are tried
+typedef enum {
+    MSP_HANDLER_NONE = 0,
+    MSP_HANDLER_COMMON_OUT,
+    MSP_HANDLER_OUT,
+    MSP_HANDLER_OUT_WITH_ARG,
+    MSP_HANDLER_PASSTHROUGH,
+    MSP_HANDLER_DATAFLASH_READ,
+    MSP_HANDLER_IN,
+    MSP_HANDLER_COUNT
+} mspHandler_e;
+
+#define MSP_COMMAND_HANDLER_MASK            0x7F
+#define MSP_COMMAND_HANDLER_POST_PROCESS    0x80    // the command has requested a post process function
+
+// Commands are looked up by ID, MSP v1 IDs directly and MSP2 IDs by their offset into the common and betaflight ranges
+#define MSP_COMMAND_SLOTS_V1                256
+#define MSP_COMMAND_SLOTS_V2_COMMON         32
+#define MSP_COMMAND_SLOTS_V2_BETAFLIGHT     32
+#define MSP_COMMAND_SLOT_COUNT              (MSP_COMMAND_SLOTS_V1 + MSP_COMMAND_SLOTS_V2_COMMON + MSP_COMMAND_SLOTS_V2_BETAFLIGHT)
+#define MSP2_COMMON_FIRST_ID                0x1000
+#define MSP2_BETAFLIGHT_FIRST_ID            0x3000
+
+// handler that processed each command last, and MSP_COMMAND_HANDLER_POST_PROCESS
+static uint8_t mspCommandHandler[MSP_COMMAND_SLOT_COUNT];
+
+#ifdef USE_MSP_COMMAND_STATISTICS
+typedef struct mspCommandStatistics_s {
+    uint32_t callCount;
+    uint32_t totalExecuteTimeUs;
+    uint16_t maxExecuteTimeUs;
+} mspCommandStatistics_t;
+
+static mspCommandStatistics_t mspCommandStatistics[MSP_COMMAND_SLOT_COUNT];
+#endif
+
+// Returns -1 for IDs outside the table
+static int mspCommandSlot(int16_t cmdMSP)
+{
+    const uint16_t id = cmdMSP;
+    if (id < MSP_COMMAND_SLOTS_V1) {
+        return id;
+    }
+    if (id >= MSP2_COMMON_FIRST_ID && id < MSP2_COMMON_FIRST_ID + MSP_COMMAND_SLOTS_V2_COMMON) {
+        return MSP_COMMAND_SLOTS_V1 + id - MSP2_COMMON_FIRST_ID;
+    }
+    if (id >= MSP2_BETAFLIGHT_FIRST_ID && id < MSP2_BETAFLIGHT_FIRST_ID + MSP_COMMAND_SLOTS_V2_BETAFLIGHT) {
+        return MSP_COMMAND_SLOTS_V1 + MSP_COMMAND_SLOTS_V2_COMMON + id - MSP2_BETAFLIGHT_FIRST_ID;
+    }
+    return -1;
+}
+
+#ifdef USE_MSP_COMMAND_STATISTICS
+static uint16_t mspCommandForSlot(int slot)
+{
+    if (slot < MSP_COMMAND_SLOTS_V1) {
+        return slot;
+    }
+    slot -= MSP_COMMAND_SLOTS_V1;
+    if (slot < MSP_COMMAND_SLOTS_V2_COMMON) {
+        return MSP2_COMMON_FIRST_ID + slot;
+    }
+    return MSP2_BETAFLIGHT_FIRST_ID + slot - MSP_COMMAND_SLOTS_V2_COMMON;
+}
+
+static void serializeMspCommandStatistics(sbuf_t *dst, sbuf_t *src)
+{
+    // as many commands as fit in the reply, starting at the given slot
+    const int entrySize = 13;
+    int slot = sbufBytesRemaining(src) >= 2 ? sbufReadU16(src) : 0;
+    uint8_t *nextSlot = sbufPtr(dst);
+    sbufWriteU16(dst, 0);
+    for (; slot < MSP_COMMAND_SLOT_COUNT; slot++) {
+        const mspCommandStatistics_t *statistics = &mspCommandStatistics[slot];
+        if (statistics->callCount == 0) {
+            continue;
+        }
+        if (sbufBytesRemaining(dst) < entrySize) {
+            // more to come, the next request starts here
+            nextSlot[0] = slot & 0xFF;
+            nextSlot[1] = slot >> 8;
+            break;
+        }
+        sbufWriteU16(dst, mspCommandForSlot(slot));
+        sbufWriteU8(dst, mspCommandHandler[slot]);
+        sbufWriteU32(dst, statistics->callCount);
+        sbufWriteU32(dst, statistics->totalExecuteTimeUs);
+        sbufWriteU16(dst, statistics->maxExecuteTimeUs);
+    }
+}
+#endif
+
 /*
  * Returns true if the command was processd, false otherwise.
  * May set mspPostProcessFunc to a function to be called once the command has been processed
@@ -1934,6 +2090,29 @@ static mspResult_e mspFcProcessOutCommandWithArg(mspDescriptor_t srcDesc, int16_
             serializeBoxReply(dst, page, &serializeBoxPermanentIdFn);
         }
         break;
+#if defined(USE_TASK_HISTOGRAMS)
+    case MSP2_BETAFLIGHT_TASK_HISTOGRAM:
+        {
+            // Bucket counts of the execution time and start lateness histograms of a task, see common/histogram.h for the bucket bounds
+            const uint8_t taskId = sbufBytesRemaining(src) ? sbufReadU8(src) : MSP2_TASK_HISTOGRAM_GYRO_PERIOD;
+            sbufWriteU8(dst, taskId);
+            sbufWriteU8(dst, HISTOGRAM_BUCKET_COUNT);
+            if (taskId == MSP2_TASK_HISTOGRAM_GYRO_PERIOD) {
+                serializeHistogram(dst, getGyroPeriodJitterHistogram());
+            } else if (taskId < TASK_COUNT) {
+                serializeHistogram(dst, getTaskExecutionTimeHistogram(taskId));
+                serializeHistogram(dst, getTaskLatenessHistogram(taskId));
+            } else {
+                return MSP_RESULT_ERROR;
+            }
+        }
+        break;
+#endif
+#if defined(USE_MSP_COMMAND_STATISTICS)
+    case MSP2_BETAFLIGHT_MSP_STATISTICS:
+        serializeMspCommandStatistics(dst, src);
+        break;
+#endif
     case MSP_REBOOT:
         if (sbufBytesRemaining(src)) {
             rebootMode = sbufReadU8(src);
@@ -2087,12 +2266,12 @@ static void mspFcDataFlashReadCommand(sbuf_t *dst, sbuf_t *src)
     const unsigned int dataSize = sbufBytesRemaining(src);
     const uint32_t readAddress = sbufReadU32(src);
     uint16_t readLength;
-    bool allowCompression = false;
+    uint8_t allowedCompressionMethods = 0;
     bool useLegacyFormat;
     if (dataSize >= sizeof(uint32_t) + sizeof(uint16_t)) {
         readLength = sbufReadU16(src);
         if (sbufBytesRemaining(src)) {
-            allowCompression = sbufReadU8(src);
+            allowedCompressionMethods = sbufReadU8(src);
         }
         useLegacyFormat = false;
     } else {
@@ -2100,7 +2279,7 @@ static void mspFcDataFlashReadCommand(sbuf_t *dst, sbuf_t *src)
         useLegacyFormat = true;
     }
 
-    serializeDataflashReadReply(dst, readAddress, readLength, useLegacyFormat, allowCompression);
+    serializeDataflashReadReply(dst, readAddress, readLength, useLegacyFormat, allowedCompressionMethods);
 }
 #endif
 
@@ -3288,8 +3467,7 @@ static mspResult_e mspProcessInCommand(mspDescriptor_t srcDesc, int16_t cmdMSP,
         break;
 #endif
     default:
-        // we do not know how to handle the (valid) message, indicate error MSP $M!
-        return MSP_RESULT_ERROR;
+        return MSP_RESULT_CMD_UNKNOWN;
     }
     return MSP_RESULT_ACK;
 }
@@ -3541,35 +3719,89 @@ static mspResult_e mspCommonProcessInCommand(mspDescriptor_t srcDesc, int16_t cm
     return MSP_RESULT_ACK;
 }
 
+static mspResult_e mspFcProcessCommandWithHandler(mspHandler_e handler, mspDescriptor_t srcDesc, int16_t cmdMSP, sbuf_t *src, sbuf_t *dst, mspPostProcessFnPtr *mspPostProcessFn)
+{
+    switch (handler) {
+    case MSP_HANDLER_COMMON_OUT:
+        return mspCommonProcessOutCommand(cmdMSP, dst, mspPostProcessFn) ? MSP_RESULT_ACK : MSP_RESULT_CMD_UNKNOWN;
+    case MSP_HANDLER_OUT:
+        return mspProcessOutCommand(cmdMSP, dst) ? MSP_RESULT_ACK : MSP_RESULT_CMD_UNKNOWN;
+    case MSP_HANDLER_OUT_WITH_ARG:
+        return mspFcProcessOutCommandWithArg(srcDesc, cmdMSP, src, dst, mspPostProcessFn);
+    case MSP_HANDLER_PASSTHROUGH:
+        if (cmdMSP != MSP_SET_PASSTHROUGH) {
+            return MSP_RESULT_CMD_UNKNOWN;
+        }
+        mspFcSetPassthroughCommand(dst, src, mspPostProcessFn);
+        return MSP_RESULT_ACK;
+#ifdef USE_FLASHFS
+    case MSP_HANDLER_DATAFLASH_READ:
+        if (cmdMSP != MSP_DATAFLASH_READ) {
+            return MSP_RESULT_CMD_UNKNOWN;
+        }
+        mspFcDataFlashReadCommand(dst, src);
+        return MSP_RESULT_ACK;
+#endif
+    case MSP_HANDLER_IN:
+        return mspCommonProcessInCommand(srcDesc, cmdMSP, src, mspPostProcessFn);
+    default:
+        return MSP_RESULT_CMD_UNKNOWN;
+    }
+}
+
 /*
  * Returns MSP_RESULT_ACK, MSP_RESULT_ERROR or MSP_RESULT_NO_REPLY
  */
 mspResult_e mspFcProcessCommand(mspDescriptor_t srcDesc, mspPacket_t *cmd, mspPacket_t *reply, mspPostProcessFnPtr *mspPostProcessFn)
 {
-    int ret = MSP_RESULT_ACK;
     sbuf_t *dst = &reply->buf;
     sbuf_t *src = &cmd->buf;
     const int16_t cmdMSP = cmd->cmd;
     // initialize reply by default
     reply->cmd = cmd->cmd;
 
-    if (mspCommonProcessOutCommand(cmdMSP, dst, mspPostProcessFn)) {
-        ret = MSP_RESULT_ACK;
-    } else if (mspProcessOutCommand(cmdMSP, dst)) {
-        ret = MSP_RESULT_ACK;
-    } else if ((ret = mspFcProcessOutCommandWithArg(srcDesc, cmdMSP, src, dst, mspPostProcessFn)) != MSP_RESULT_CMD_UNKNOWN) {
-        /* ret */;
-    } else if (cmdMSP == MSP_SET_PASSTHROUGH) {
-        mspFcSetPassthroughCommand(dst, src, mspPostProcessFn);
-        ret = MSP_RESULT_ACK;
-#ifdef USE_FLASHFS
-    } else if (cmdMSP == MSP_DATAFLASH_READ) {
-        mspFcDataFlashReadCommand(dst, src);
-        ret = MSP_RESULT_ACK;
+#ifdef USE_MSP_COMMAND_STATISTICS
+    const timeUs_t startTimeUs = micros();
 #endif
-    } else {
-        ret = mspCommonProcessInCommand(srcDesc, cmdMSP, src, mspPostProcessFn);
+
+    // pushed replies only come from the handlers that report state and take no arguments
+    const mspHandler_e lastAllowedHandler = cmd->direction == MSP_DIRECTION_PUSH ? MSP_HANDLER_OUT : MSP_HANDLER_COUNT - 1;
+
+    // Go straight to the handler that processed the command last time, the handlers are only tried in turn for
+    // commands seen for the first time or that their handler did not take this time (no handler changes anything
+    // before it knows it takes a command)
+    const int slot = mspCommandSlot(cmdMSP);
+    mspHandler_e lastHandler = slot >= 0 ? mspCommandHandler[slot] & MSP_COMMAND_HANDLER_MASK : MSP_HANDLER_NONE;
+    if (lastHandler > lastAllowedHandler) {
+        lastHandler = MSP_HANDLER_NONE;
+    }
+    mspResult_e ret = mspFcProcessCommandWithHandler(lastHandler, srcDesc, cmdMSP, src, dst, mspPostProcessFn);
+    for (mspHandler_e handler = MSP_HANDLER_NONE + 1; ret == MSP_RESULT_CMD_UNKNOWN && handler <= lastAllowedHandler; handler++) {
+        if (handler != lastHandler) {
+            ret = mspFcProcessCommandWithHandler(handler, srcDesc, cmdMSP, src, dst, mspPostProcessFn);
+            if (ret != MSP_RESULT_CMD_UNKNOWN && slot >= 0) {
+                mspCommandHandler[slot] = handler;
+            }
+        }
     }
+
+    if (ret == MSP_RESULT_CMD_UNKNOWN) {
+        // we do not know how to handle the (valid) message, indicate error MSP $M!
+        ret = MSP_RESULT_ERROR;
+    } else if (slot >= 0 && *mspPostProcessFn) {
+        mspCommandHandler[slot] |= MSP_COMMAND_HANDLER_POST_PROCESS;
+    }
+
+#ifdef USE_MSP_COMMAND_STATISTICS
+    if (slot >= 0) {
+        const timeDelta_t executeTimeUs = cmpTimeUs(micros(), startTimeUs);
+        mspCommandStatistics_t *statistics = &mspCommandStatistics[slot];
+        statistics->callCount++;
+        statistics->totalExecuteTimeUs += executeTimeUs;
+        statistics->maxExecuteTimeUs = MAX(statistics->maxExecuteTimeUs, (uint16_t)MIN(executeTimeUs, UINT16_MAX));
+    }
+#endif
+
     reply->result = ret;
     return ret;
 }
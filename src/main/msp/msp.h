@@ -43,7 +43,8 @@ typedef enum {
 
 typedef enum {
     MSP_DIRECTION_REPLY = 0,
-    MSP_DIRECTION_REQUEST = 1
+    MSP_DIRECTION_REQUEST = 1,
+    MSP_DIRECTION_PUSH = 2      // request for a reply the client subscribed to, only commands that report state are processed
 } mspDirection_e;
 
 typedef struct mspPacket_s {
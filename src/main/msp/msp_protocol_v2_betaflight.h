@@ -19,3 +19,8 @@
  */
 
 #define MSP2_BETAFLIGHT_BIND            0x3000
+#define MSP2_BETAFLIGHT_TASK_HISTOGRAM  0x3001  //in message: task id, or MSP2_TASK_HISTOGRAM_GYRO_PERIOD for the gyro period jitter
+#define MSP2_BETAFLIGHT_MSP_STATISTICS  0x3002  //in message: first entry to send. out message: next entry to request (0 when done), then per command: id, handler, calls, total and max execution time in us
+#define MSP2_BETAFLIGHT_SUBSCRIBE       0x3003  //in message: per command: id and interval in ms, replaces the subscriptions of the port, none to unsubscribe. out message: number of subscriptions accepted
+
+#define MSP2_TASK_HISTOGRAM_GYRO_PERIOD 0xFF
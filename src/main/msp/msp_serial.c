@@ -37,6 +37,7 @@
 #include "io/displayport_msp.h"
 
 #include "msp/msp.h"
+#include "msp/msp_protocol_v2_betaflight.h"
 
 #include "msp_serial.h"
 
@@ -208,9 +209,10 @@ static bool mspSerialProcessReceivedData(mspPort_t *mspPort, uint8_t c)
         case MSP_HEADER_V2_OVER_V1:     // V2 header is part of V1 payload - we need to calculate both checksums now
             mspPort->inBuf[mspPort->offset++] = c;
             mspPort->checksum1 ^= c;
-            mspPort->checksum2 = crc8_dvb_s2(mspPort->checksum2, c);
             if (mspPort->offset == (sizeof(mspHeaderV2_t) + sizeof(mspHeaderV1_t))) {
                 mspHeaderV2_t * hdrv2 = (mspHeaderV2_t *)&mspPort->inBuf[sizeof(mspHeaderV1_t)];
+                // the V2 checksum is run over whole blocks once they are received
+                mspPort->checksum2 = crc8_dvb_s2_update(mspPort->checksum2, hdrv2, sizeof(mspHeaderV2_t));
                 mspPort->dataSize = hdrv2->size;
                 mspPort->cmdMSP = hdrv2->cmd;
                 mspPort->cmdFlags = hdrv2->flags;
@@ -220,11 +222,11 @@ static bool mspSerialProcessReceivedData(mspPort_t *mspPort, uint8_t c)
             break;
 
         case MSP_PAYLOAD_V2_OVER_V1:
-            mspPort->checksum2 = crc8_dvb_s2(mspPort->checksum2, c);
             mspPort->checksum1 ^= c;
             mspPort->inBuf[mspPort->offset++] = c;
 
             if (mspPort->offset == mspPort->dataSize) {
+                mspPort->checksum2 = crc8_dvb_s2_update(mspPort->checksum2, mspPort->inBuf, mspPort->dataSize);
                 mspPort->c_state = MSP_CHECKSUM_V2_OVER_V1;
             }
             break;
@@ -240,9 +242,9 @@ static bool mspSerialProcessReceivedData(mspPort_t *mspPort, uint8_t c)
 
         case MSP_HEADER_V2_NATIVE:
             mspPort->inBuf[mspPort->offset++] = c;
-            mspPort->checksum2 = crc8_dvb_s2(mspPort->checksum2, c);
             if (mspPort->offset == sizeof(mspHeaderV2_t)) {
                 mspHeaderV2_t * hdrv2 = (mspHeaderV2_t *)&mspPort->inBuf[0];
+                mspPort->checksum2 = crc8_dvb_s2_update(mspPort->checksum2, hdrv2, sizeof(mspHeaderV2_t));
                 mspPort->dataSize = hdrv2->size;
                 mspPort->cmdMSP = hdrv2->cmd;
                 mspPort->cmdFlags = hdrv2->flags;
@@ -252,10 +254,10 @@ static bool mspSerialProcessReceivedData(mspPort_t *mspPort, uint8_t c)
             break;
 
         case MSP_PAYLOAD_V2_NATIVE:
-            mspPort->checksum2 = crc8_dvb_s2(mspPort->checksum2, c);
             mspPort->inBuf[mspPort->offset++] = c;
 
             if (mspPort->offset == mspPort->dataSize) {
+                mspPort->checksum2 = crc8_dvb_s2_update(mspPort->checksum2, mspPort->inBuf, mspPort->dataSize);
                 mspPort->c_state = MSP_CHECKSUM_V2_NATIVE;
             }
             break;
@@ -394,10 +396,111 @@ static int mspSerialEncode(mspPort_t *msp, mspPacket_t *packet, mspVersion_e msp
     return mspSerialSendFrame(msp, hdrBuf, hdrLen, sbufPtr(&packet->buf), dataLen, crcBuf, crcLen);
 }
 
-static mspPostProcessFnPtr mspSerialProcessReceivedCommand(mspPort_t *msp, mspProcessCommandFnPtr mspProcessCommandFn)
+static uint8_t outBuf[MSP_PORT_OUTBUF_SIZE];
+
+#ifdef USE_MSP_SUBSCRIPTIONS
+// Replace the subscriptions of the port with those in the request, returns the number accepted
+static mspResult_e mspSerialSubscribe(mspPort_t *msp, mspPacket_t *cmd, mspPacket_t *reply)
 {
-    static uint8_t outBuf[MSP_PORT_OUTBUF_SIZE];
+    sbuf_t *src = &cmd->buf;
+    sbuf_t *dst = &reply->buf;
+    reply->cmd = cmd->cmd;
+
+    const timeMs_t nowMs = millis();
+
+    msp->subscriptionCount = 0;
+    msp->nextSubscription = 0;
+    msp->subscriptionVersion = msp->mspVersion;
+    while (sbufBytesRemaining(src) >= 4 && msp->subscriptionCount < MSP_MAX_SUBSCRIPTIONS) {
+        mspSubscription_t *subscription = &msp->subscriptions[msp->subscriptionCount];
+        subscription->cmdMSP = sbufReadU16(src);
+        subscription->intervalMs = sbufReadU16(src);
+        subscription->frameSize = 0;
+        subscription->dueMs = nowMs;
+        // MSP v1 frames can not carry MSP2 IDs
+        if (subscription->intervalMs && (subscription->cmdMSP < MSP_V2_FRAME_ID || msp->mspVersion != MSP_V1)) {
+            msp->subscriptionCount++;
+        }
+    }
+
+    sbufWriteU8(dst, msp->subscriptionCount);
+    return MSP_RESULT_ACK;
+}
+
+// Push the replies that are due, as long as they fit in the transmit buffer
+static void mspSerialProcessSubscriptions(mspPort_t *msp, mspProcessCommandFnPtr mspProcessCommandFn)
+{
+    if (!msp->subscriptionCount) {
+        return;
+    }
+
+    const timeMs_t nowMs = millis();
+    if (nowMs - msp->lastActivityMs > MSP_SUBSCRIPTION_TIMEOUT_MS) {
+        // the client has gone away
+        msp->subscriptionCount = 0;
+        return;
+    }
+
+    for (int i = 0; i < msp->subscriptionCount; i++) {
+        const int index = (msp->nextSubscription + i) % msp->subscriptionCount;
+        mspSubscription_t *subscription = &msp->subscriptions[index];
+        if (!subscription->intervalMs || cmp32(nowMs, subscription->dueMs) < 0) {
+            continue;
+        }
+
+        // state replies hardly change in size, so don't run the command for a reply that would not fit
+        const uint32_t bytesFree = serialTxBytesFree(msp->port);
+        if (bytesFree < subscription->frameSize) {
+            msp->nextSubscription = index;
+            return;
+        }
+
+        mspPacket_t reply = {
+            .buf = { .ptr = outBuf, .end = ARRAYEND(outBuf), },
+            .cmd = -1,
+            .flags = 0,
+            .result = 0,
+            .direction = MSP_DIRECTION_REPLY,
+        };
+        uint8_t *outBufHead = reply.buf.ptr;
 
+        mspPacket_t command = {
+            .buf = { .ptr = NULL, .end = NULL, },
+            .cmd = subscription->cmdMSP,
+            .flags = 0,
+            .result = 0,
+            .direction = MSP_DIRECTION_PUSH,
+        };
+
+        mspPostProcessFnPtr mspPostProcessFn = NULL;
+        const mspResult_e status = mspProcessCommandFn(msp->descriptor, &command, &reply, &mspPostProcessFn);
+        sbufSwitchToReader(&reply.buf, outBufHead);
+
+        // replies are pushed whole or not at all, what is not sent now is sent on the next call
+        subscription->frameSize = sbufBytesRemaining(&reply.buf) + MSP_MAX_HEADER_SIZE + 2;
+        if (bytesFree < subscription->frameSize) {
+            msp->nextSubscription = index;
+            return;
+        }
+        mspSerialEncode(msp, &reply, msp->subscriptionVersion);
+
+        if (status == MSP_RESULT_ERROR) {
+            // not a command that can be pushed, the client got the error once
+            subscription->intervalMs = 0;
+            continue;
+        }
+
+        // keep the interval when pushing is late, but never catch up with a burst
+        subscription->dueMs += subscription->intervalMs;
+        if (cmp32(nowMs, subscription->dueMs) >= 0) {
+            subscription->dueMs = nowMs + subscription->intervalMs;
+        }
+    }
+}
+#endif
+
+static mspPostProcessFnPtr mspSerialProcessReceivedCommand(mspPort_t *msp, mspProcessCommandFnPtr mspProcessCommandFn)
+{
     mspPacket_t reply = {
         .buf = { .ptr = outBuf, .end = ARRAYEND(outBuf), },
         .cmd = -1,
@@ -416,7 +519,12 @@ static mspPostProcessFnPtr mspSerialProcessReceivedCommand(mspPort_t *msp, mspPr
     };
 
     mspPostProcessFnPtr mspPostProcessFn = NULL;
+#ifdef USE_MSP_SUBSCRIPTIONS
+    // subscriptions belong to the port
+    const mspResult_e status = command.cmd == MSP2_BETAFLIGHT_SUBSCRIBE ? mspSerialSubscribe(msp, &command, &reply) : mspProcessCommandFn(msp->descriptor, &command, &reply, &mspPostProcessFn);
+#else
     const mspResult_e status = mspProcessCommandFn(msp->descriptor, &command, &reply, &mspPostProcessFn);
+#endif
 
     if (status != MSP_RESULT_NO_REPLY) {
         sbufSwitchToReader(&reply.buf, outBufHead); // change streambuf direction
@@ -534,6 +642,12 @@ void mspSerialProcess(mspEvaluateNonMspData_e evaluateNonMspData, mspProcessComm
         else {
             mspProcessPendingRequest(mspPort);
         }
+
+#ifdef USE_MSP_SUBSCRIPTIONS
+        if (mspPort->port) {
+            mspSerialProcessSubscriptions(mspPort, mspProcessCommandFn);
+        }
+#endif
     }
 }
 
@@ -97,6 +97,19 @@ typedef struct __attribute__((packed)) {
 
 #define MSP_MAX_HEADER_SIZE     9
 
+#ifdef USE_MSP_SUBSCRIPTIONS
+#define MSP_MAX_SUBSCRIPTIONS           16
+#define MSP_SUBSCRIPTION_TIMEOUT_MS     5000    // pushing stops when nothing was received from the client for this long
+
+// A reply pushed to the client every intervalMs, see MSP2_BETAFLIGHT_SUBSCRIBE
+typedef struct mspSubscription_s {
+    uint16_t cmdMSP;
+    uint16_t intervalMs;
+    uint16_t frameSize;                 // size of the last frame pushed, the command only runs once this much can be sent
+    timeMs_t dueMs;
+} mspSubscription_t;
+#endif
+
 struct serialPort_s;
 typedef struct mspPort_s {
     struct serialPort_s *port; // null when port unused.
@@ -114,6 +127,12 @@ typedef struct mspPort_s {
     uint8_t checksum2;
     bool sharedWithTelemetry;
     mspDescriptor_t descriptor;
+#ifdef USE_MSP_SUBSCRIPTIONS
+    mspSubscription_t subscriptions[MSP_MAX_SUBSCRIPTIONS];
+    uint8_t subscriptionCount;
+    uint8_t nextSubscription;           // pushing resumes here when the transmit buffer filled up
+    mspVersion_e subscriptionVersion;
+#endif
 } mspPort_t;
 
 void mspSerialInit(void);
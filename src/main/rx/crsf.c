@@ -50,6 +50,8 @@
 
 #define CRSF_TIME_NEEDED_PER_FRAME_US   1100 // 700 ms + 400 ms for potential ad-hoc request
 #define CRSF_TIME_BETWEEN_FRAMES_US     6667 // At fastest, frames are sent by the transmitter every 6.667 milliseconds, 150 Hz
+#define CRSF_BYTE_TIME_US               (10 * 1000000 / CRSF_BAUDRATE) // start, 8 data and stop bits
+#define CRSF_FRAME_HEADER_BYTES         (CRSF_FRAME_LENGTH_ADDRESS + CRSF_FRAME_LENGTH_FRAMELENGTH + CRSF_FRAME_LENGTH_TYPE)
 
 #define CRSF_DIGITAL_CHANNEL_MIN 172
 #define CRSF_DIGITAL_CHANNEL_MAX 1811
@@ -65,6 +67,7 @@ STATIC_UNIT_TESTED uint32_t crsfChannelData[CRSF_MAX_CHANNEL];
 
 static serialPort_t *serialPort;
 static timeUs_t crsfFrameStartAtUs = 0;
+static uint8_t crsfFramePosition = 0;
 static uint8_t telemetryBuf[CRSF_FRAME_SIZE_MAX];
 static uint8_t telemetryBufLen = 0;
 
@@ -222,20 +225,125 @@ static void crsfCheckRssi(uint32_t currentTimeUs) {
 
 STATIC_UNIT_TESTED uint8_t crsfFrameCRC(void)
 {
-    // CRC includes type and payload
-    uint8_t crc = crc8_dvb_s2(0, crsfFrame.frame.type);
-    for (int ii = 0; ii < crsfFrame.frame.frameLength - CRSF_FRAME_LENGTH_TYPE_CRC; ++ii) {
-        crc = crc8_dvb_s2(crc, crsfFrame.frame.payload[ii]);
+    // CRC includes type and payload, which follow each other in the frame, the type is always included
+    const int length = MAX(crsfFrame.frame.frameLength - CRSF_FRAME_LENGTH_CRC, CRSF_FRAME_LENGTH_TYPE);
+    return crc8_dvb_s2_update(0, &crsfFrame.frame.type, length);
+}
+
+// Handles a complete frame, currentTimeUs is when its last byte arrived
+static void crsfProcessFrame(timeUs_t currentTimeUs)
+{
+    const int fullFrameLength = crsfFrame.frame.frameLength + CRSF_FRAME_LENGTH_ADDRESS + CRSF_FRAME_LENGTH_FRAMELENGTH;
+    const uint8_t crc = crsfFrameCRC();
+    if (crc != crsfFrame.bytes[fullFrameLength - 1]) {
+        return;
+    }
+
+    switch (crsfFrame.frame.type)
+    {
+        case CRSF_FRAMETYPE_RC_CHANNELS_PACKED:
+            if (crsfFrame.frame.deviceAddress == CRSF_ADDRESS_FLIGHT_CONTROLLER) {
+                lastRcFrameTimeUs = currentTimeUs;
+                crsfFrameDone = true;
+                memcpy(&crsfChannelDataFrame, &crsfFrame, sizeof(crsfFrame));
+            }
+            break;
+
+#if defined(USE_TELEMETRY_CRSF) && defined(USE_MSP_OVER_TELEMETRY)
+        case CRSF_FRAMETYPE_MSP_REQ:
+        case CRSF_FRAMETYPE_MSP_WRITE: {
+            uint8_t *frameStart = (uint8_t *)&crsfFrame.frame.payload + CRSF_FRAME_ORIGIN_DEST_SIZE;
+            if (bufferCrsfMspFrame(frameStart, CRSF_FRAME_RX_MSP_FRAME_SIZE)) {
+                crsfScheduleMspResponse();
+            }
+            break;
+        }
+#endif
+#if defined(USE_CRSF_CMS_TELEMETRY)
+        case CRSF_FRAMETYPE_DEVICE_PING:
+            crsfScheduleDeviceInfoResponse();
+            break;
+        case CRSF_FRAMETYPE_DISPLAYPORT_CMD: {
+            uint8_t *frameStart = (uint8_t *)&crsfFrame.frame.payload + CRSF_FRAME_ORIGIN_DEST_SIZE;
+            crsfProcessDisplayPortCmd(frameStart);
+            break;
+        }
+#endif
+#if defined(USE_CRSF_LINK_STATISTICS)
+
+        case CRSF_FRAMETYPE_LINK_STATISTICS: {
+             // if to FC and 10 bytes + CRSF_FRAME_ORIGIN_DEST_SIZE
+             if ((rssiSource == RSSI_SOURCE_RX_PROTOCOL_CRSF) &&
+                 (crsfFrame.frame.deviceAddress == CRSF_ADDRESS_FLIGHT_CONTROLLER) &&
+                 (crsfFrame.frame.frameLength == CRSF_FRAME_ORIGIN_DEST_SIZE + CRSF_FRAME_LINK_STATISTICS_PAYLOAD_SIZE)) {
+                 const crsfLinkStatistics_t* statsFrame = (const crsfLinkStatistics_t*)&crsfFrame.frame.payload;
+                 handleCrsfLinkStatisticsFrame(statsFrame, currentTimeUs);
+             }
+            break;
+        }
+#endif
+        default:
+            break;
     }
-    return crc;
 }
 
-// Receive ISR callback, called back from serial port
+// Receive callback for drivers that pass several bytes at once. The bytes of a span follow each other on the
+// line, so the time each one arrived is worked back from arrivalTimeUs, the time the last one did.
+STATIC_UNIT_TESTED void crsfDataReceiveSpan(const uint8_t *data, uint32_t length, timeUs_t arrivalTimeUs, void *callbackData)
+{
+    UNUSED(callbackData);
+
+    if (length == 0) {
+        return;
+    }
+    const timeUs_t firstByteTimeUs = arrivalTimeUs - (length - 1) * CRSF_BYTE_TIME_US;
+
+#ifdef DEBUG_CRSF_PACKETS
+    debug[2] = firstByteTimeUs - crsfFrameStartAtUs;
+#endif
+
+    uint32_t i = 0;
+    while (i < length) {
+        const timeUs_t byteTimeUs = firstByteTimeUs + i * CRSF_BYTE_TIME_US;
+        if (cmpTimeUs(byteTimeUs, crsfFrameStartAtUs) > CRSF_TIME_NEEDED_PER_FRAME_US) {
+            // We've received a character after max time needed to complete a frame,
+            // so this must be the start of a new frame.
+            crsfFramePosition = 0;
+        }
+
+        if (crsfFramePosition == 0) {
+            crsfFrameStartAtUs = byteTimeUs;
+        }
+        // the header is address, frame length and type, after that the frame length gives the end of the frame
+        // full frame length includes the length of the address and framelength fields
+        const bool headerReceived = crsfFramePosition >= CRSF_FRAME_HEADER_BYTES;
+        const int frameEnd = headerReceived ? crsfFrame.frame.frameLength + CRSF_FRAME_LENGTH_ADDRESS + CRSF_FRAME_LENGTH_FRAMELENGTH : CRSF_FRAME_HEADER_BYTES;
+
+        if (crsfFramePosition >= frameEnd || frameEnd > (int)sizeof(crsfFrame.bytes)) {
+            // not a valid frame, the bytes are dropped until a gap starts the next one
+            i++;
+            continue;
+        }
+
+        // copy what is left of the frame, up to the last byte that arrives within the time needed for a frame
+        const uint32_t bytesInTime = (CRSF_TIME_NEEDED_PER_FRAME_US - cmpTimeUs(byteTimeUs, crsfFrameStartAtUs)) / CRSF_BYTE_TIME_US + 1;
+        const uint32_t count = MIN(MIN((uint32_t)(frameEnd - crsfFramePosition), length - i), bytesInTime);
+        memcpy(&crsfFrame.bytes[crsfFramePosition], &data[i], count);
+        crsfFramePosition += count;
+        i += count;
+
+        if (headerReceived && crsfFramePosition >= frameEnd) {
+            crsfFramePosition = 0;
+            crsfProcessFrame(firstByteTimeUs + (i - 1) * CRSF_BYTE_TIME_US);
+        }
+    }
+}
+
+// Receive ISR callback, called back from serial port by drivers that pass a byte at a time
 STATIC_UNIT_TESTED void crsfDataReceive(uint16_t c, void *data)
 {
     UNUSED(data);
 
-    static uint8_t crsfFramePosition = 0;
     const timeUs_t currentTimeUs = microsISR();
 
 #ifdef DEBUG_CRSF_PACKETS
@@ -255,59 +363,11 @@ STATIC_UNIT_TESTED void crsfDataReceive(uint16_t c, void *data)
     // full frame length includes the length of the address and framelength fields
     const int fullFrameLength = crsfFramePosition < 3 ? 5 : crsfFrame.frame.frameLength + CRSF_FRAME_LENGTH_ADDRESS + CRSF_FRAME_LENGTH_FRAMELENGTH;
 
-    if (crsfFramePosition < fullFrameLength) {
+    if (crsfFramePosition < fullFrameLength && fullFrameLength <= (int)sizeof(crsfFrame.bytes)) {
         crsfFrame.bytes[crsfFramePosition++] = (uint8_t)c;
         if (crsfFramePosition >= fullFrameLength) {
             crsfFramePosition = 0;
-            const uint8_t crc = crsfFrameCRC();
-            if (crc == crsfFrame.bytes[fullFrameLength - 1]) {
-                switch (crsfFrame.frame.type)
-                {
-                    case CRSF_FRAMETYPE_RC_CHANNELS_PACKED:
-                        if (crsfFrame.frame.deviceAddress == CRSF_ADDRESS_FLIGHT_CONTROLLER) {
-                            lastRcFrameTimeUs = currentTimeUs;
-                            crsfFrameDone = true;
-                            memcpy(&crsfChannelDataFrame, &crsfFrame, sizeof(crsfFrame));
-                        }
-                        break;
-
-#if defined(USE_TELEMETRY_CRSF) && defined(USE_MSP_OVER_TELEMETRY)
-                    case CRSF_FRAMETYPE_MSP_REQ:
-                    case CRSF_FRAMETYPE_MSP_WRITE: {
-                        uint8_t *frameStart = (uint8_t *)&crsfFrame.frame.payload + CRSF_FRAME_ORIGIN_DEST_SIZE;
-                        if (bufferCrsfMspFrame(frameStart, CRSF_FRAME_RX_MSP_FRAME_SIZE)) {
-                            crsfScheduleMspResponse();
-                        }
-                        break;
-                    }
-#endif
-#if defined(USE_CRSF_CMS_TELEMETRY)
-                    case CRSF_FRAMETYPE_DEVICE_PING:
-                        crsfScheduleDeviceInfoResponse();
-                        break;
-                    case CRSF_FRAMETYPE_DISPLAYPORT_CMD: {
-                        uint8_t *frameStart = (uint8_t *)&crsfFrame.frame.payload + CRSF_FRAME_ORIGIN_DEST_SIZE;
-                        crsfProcessDisplayPortCmd(frameStart);
-                        break;
-                    }
-#endif
-#if defined(USE_CRSF_LINK_STATISTICS)
-
-                    case CRSF_FRAMETYPE_LINK_STATISTICS: {
-                         // if to FC and 10 bytes + CRSF_FRAME_ORIGIN_DEST_SIZE
-                         if ((rssiSource == RSSI_SOURCE_RX_PROTOCOL_CRSF) &&
-                             (crsfFrame.frame.deviceAddress == CRSF_ADDRESS_FLIGHT_CONTROLLER) &&
-                             (crsfFrame.frame.frameLength == CRSF_FRAME_ORIGIN_DEST_SIZE + CRSF_FRAME_LINK_STATISTICS_PAYLOAD_SIZE)) {
-                             const crsfLinkStatistics_t* statsFrame = (const crsfLinkStatistics_t*)&crsfFrame.frame.payload;
-                             handleCrsfLinkStatisticsFrame(statsFrame, currentTimeUs);
-                         }
-                        break;
-                    }
-#endif
-                    default:
-                        break;
-                }
-            }
+            crsfProcessFrame(currentTimeUs);
         }
     }
 }
@@ -406,6 +466,9 @@ bool crsfRxInit(const rxConfig_t *rxConfig, rxRuntimeState_t *rxRuntimeState)
         CRSF_PORT_MODE,
         CRSF_PORT_OPTIONS | (rxConfig->serialrx_inverted ? SERIAL_INVERTED : 0)
         );
+    if (serialPort) {
+        serialSetRxSpanCallback(serialPort, crsfDataReceiveSpan);
+    }
 
         if (rssiSource == RSSI_SOURCE_NONE) {
             rssiSource = RSSI_SOURCE_RX_PROTOCOL_CRSF;
@@ -21,6 +21,7 @@
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "platform.h"
 
@@ -28,6 +29,7 @@
 
 #include "build/debug.h"
 
+#include "common/maths.h"
 #include "common/utils.h"
 
 #include "drivers/time.h"
@@ -70,6 +72,8 @@
 
 #define SBUS_FRAME_BEGIN_BYTE 0x0F
 
+#define SBUS_BYTE_BITS 12 // start, 8 data, parity and 2 stop bits
+
 #if !defined(SBUS_PORT_OPTIONS)
 #define SBUS_PORT_OPTIONS (SERIAL_STOPBITS_2 | SERIAL_PARITY_EVEN)
 #endif
@@ -104,13 +108,60 @@ typedef union sbusFrame_u {
 typedef struct sbusFrameData_s {
     sbusFrame_t frame;
     timeUs_t startAtUs;
+    timeDelta_t byteTimeUs;
     uint8_t position;
     bool done;
 } sbusFrameData_t;
 
 static timeUs_t lastRcFrameTimeUs = 0;
 
-// Receive ISR callback
+// Receive callback for drivers that pass several bytes at once. The bytes of a span follow each other on the
+// line, so the time each one arrived is worked back from arrivalTimeUs, the time the last one did.
+static void sbusDataReceiveSpan(const uint8_t *data, uint32_t length, timeUs_t arrivalTimeUs, void *callbackData)
+{
+    sbusFrameData_t *sbusFrameData = callbackData;
+
+    const timeUs_t firstByteTimeUs = arrivalTimeUs - (length - 1) * sbusFrameData->byteTimeUs;
+
+    uint32_t i = 0;
+    while (i < length) {
+        const timeUs_t byteTimeUs = firstByteTimeUs + i * sbusFrameData->byteTimeUs;
+        if (cmpTimeUs(byteTimeUs, sbusFrameData->startAtUs) > (long)(SBUS_TIME_NEEDED_PER_FRAME + 500)) {
+            sbusFrameData->position = 0;
+        }
+
+        if (sbusFrameData->position == 0) {
+            if (data[i] != SBUS_FRAME_BEGIN_BYTE) {
+                i++;
+                continue;
+            }
+            sbusFrameData->startAtUs = byteTimeUs;
+        }
+
+        if (sbusFrameData->position >= SBUS_FRAME_SIZE) {
+            // the frame is complete, the bytes are dropped until a gap starts the next one
+            i++;
+            continue;
+        }
+
+        // copy what is left of the frame, up to the last byte that arrives before a new frame would be started
+        const uint32_t bytesInTime = (SBUS_TIME_NEEDED_PER_FRAME + 500 - cmpTimeUs(byteTimeUs, sbusFrameData->startAtUs)) / sbusFrameData->byteTimeUs + 1;
+        const uint32_t count = MIN(MIN((uint32_t)(SBUS_FRAME_SIZE - sbusFrameData->position), length - i), bytesInTime);
+        memcpy(&sbusFrameData->frame.bytes[sbusFrameData->position], &data[i], count);
+        sbusFrameData->position += count;
+        i += count;
+
+        if (sbusFrameData->position < SBUS_FRAME_SIZE) {
+            sbusFrameData->done = false;
+        } else {
+            sbusFrameData->done = true;
+            const timeUs_t endAtUs = firstByteTimeUs + (i - 1) * sbusFrameData->byteTimeUs;
+            DEBUG_SET(DEBUG_SBUS, DEBUG_SBUS_FRAME_TIME, cmpTimeUs(endAtUs, sbusFrameData->startAtUs));
+        }
+    }
+}
+
+// Receive ISR callback, called back from serial port by drivers that pass a byte at a time
 static void sbusDataReceive(uint16_t c, void *data)
 {
     sbusFrameData_t *sbusFrameData = data;
@@ -184,6 +235,7 @@ bool sbusInit(const rxConfig_t *rxConfig, rxRuntimeState_t *rxRuntimeState)
         rxRuntimeState->rxRefreshRate = SBUS_RX_REFRESH_RATE;
         sbusBaudRate  = SBUS_BAUDRATE;
     }
+    sbusFrameData.byteTimeUs = SBUS_BYTE_BITS * 1000000 / sbusBaudRate;
 
     rxRuntimeState->rcFrameStatusFn = sbusFrameStatus;
     rxRuntimeState->rcFrameTimeUsFn = sbusFrameTimeUs;
@@ -207,6 +259,9 @@ bool sbusInit(const rxConfig_t *rxConfig, rxRuntimeState_t *rxRuntimeState)
         portShared ? MODE_RXTX : MODE_RX,
         SBUS_PORT_OPTIONS | (rxConfig->serialrx_inverted ? 0 : SERIAL_INVERTED) | (rxConfig->halfDuplex ? SERIAL_BIDIR : 0)
         );
+    if (sBusPort) {
+        serialSetRxSpanCallback(sBusPort, sbusDataReceiveSpan);
+    }
 
     if (rxConfig->rssi_src_frame_errors) {
         rssiSource = RSSI_SOURCE_FRAME_ERRORS;
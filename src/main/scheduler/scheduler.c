@@ -29,6 +29,7 @@
 #include "build/build_config.h"
 #include "build/debug.h"
 
+#include "common/histogram.h"
 #include "common/maths.h"
 #include "common/time.h"
 #include "common/utils.h"
@@ -67,11 +68,44 @@ static FAST_RAM_ZERO_INIT bool gyroEnabled;
 
 STATIC_UNIT_TESTED FAST_RAM_ZERO_INIT task_t* taskQueueArray[TASK_COUNT + 1]; // extra item for NULL pointer at end of queue
 
+// Deadline queue, used instead of scanning the whole task queue when enabled.
+// Time driven tasks are kept in a min-heap ordered by the time they next become due,
+// so each pass only visits tasks which are actually waiting. Event driven tasks still
+// need their checkFunc polled every pass, so they are kept in a separate list.
+// Both are rebuilt from taskQueueArray whenever the queue changes.
+typedef struct {
+    task_t *task;
+    timeUs_t dueAtUs;
+    uint8_t queuePos;   // position in taskQueueArray, used to break priority ties the same way the scan does
+} deadlineQueueEntry_t;
+
+static FAST_RAM_ZERO_INIT bool useDeadlineQueue;
+static FAST_RAM_ZERO_INIT bool deadlineQueueDirty;
+static FAST_RAM_ZERO_INIT deadlineQueueEntry_t deadlineHeap[TASK_COUNT];
+static FAST_RAM_ZERO_INIT int deadlineHeapSize;
+static FAST_RAM_ZERO_INIT deadlineQueueEntry_t eventTaskList[TASK_COUNT];
+static FAST_RAM_ZERO_INIT int eventTaskCount;
+
+#if defined(UNIT_TEST)
+uint32_t unittest_scheduler_examinedTasks;
+#endif
+
+#if defined(USE_TASK_HISTOGRAMS)
+typedef struct taskHistograms_s {
+    histogram_t executionTimeUs;
+    histogram_t latenessUs;         // how long after its desired time the task was started
+} taskHistograms_t;
+
+static FAST_RAM_ZERO_INIT taskHistograms_t taskHistograms[TASK_COUNT];
+static FAST_RAM_ZERO_INIT histogram_t gyroPeriodJitterHistogram;   // deviation of the gyro loop period from desiredPeriodUs
+#endif
+
 void queueClear(void)
 {
     memset(taskQueueArray, 0, sizeof(taskQueueArray));
     taskQueuePos = 0;
     taskQueueSize = 0;
+    deadlineQueueDirty = true;
 }
 
 bool queueContains(task_t *task)
@@ -94,6 +128,7 @@ bool queueAdd(task_t *task)
             memmove(&taskQueueArray[ii+1], &taskQueueArray[ii], sizeof(task) * (taskQueueSize - ii));
             taskQueueArray[ii] = task;
             ++taskQueueSize;
+            deadlineQueueDirty = true;
             return true;
         }
     }
@@ -106,6 +141,7 @@ bool queueRemove(task_t *task)
         if (taskQueueArray[ii] == task) {
             memmove(&taskQueueArray[ii], &taskQueueArray[ii+1], sizeof(task) * (taskQueueSize - ii));
             --taskQueueSize;
+            deadlineQueueDirty = true;
             return true;
         }
     }
@@ -129,6 +165,95 @@ FAST_CODE task_t *queueNext(void)
     return taskQueueArray[++taskQueuePos]; // guaranteed to be NULL at end of queue
 }
 
+static FAST_CODE void deadlineHeapSwap(int a, int b)
+{
+    const deadlineQueueEntry_t tmp = deadlineHeap[a];
+    deadlineHeap[a] = deadlineHeap[b];
+    deadlineHeap[b] = tmp;
+}
+
+static FAST_CODE void deadlineHeapSiftUp(int index)
+{
+    while (index > 0) {
+        const int parent = (index - 1) / 2;
+        if (cmpTimeUs(deadlineHeap[index].dueAtUs, deadlineHeap[parent].dueAtUs) >= 0) {
+            break;
+        }
+        deadlineHeapSwap(index, parent);
+        index = parent;
+    }
+}
+
+static FAST_CODE void deadlineHeapSiftDown(int index)
+{
+    while (true) {
+        const int left = 2 * index + 1;
+        const int right = left + 1;
+        int earliest = index;
+        if (left < deadlineHeapSize && cmpTimeUs(deadlineHeap[left].dueAtUs, deadlineHeap[earliest].dueAtUs) < 0) {
+            earliest = left;
+        }
+        if (right < deadlineHeapSize && cmpTimeUs(deadlineHeap[right].dueAtUs, deadlineHeap[earliest].dueAtUs) < 0) {
+            earliest = right;
+        }
+        if (earliest == index) {
+            break;
+        }
+        deadlineHeapSwap(index, earliest);
+        index = earliest;
+    }
+}
+
+static FAST_CODE void deadlineHeapUpdate(int index)
+{
+    deadlineHeap[index].dueAtUs = deadlineHeap[index].task->lastExecutedAtUs + deadlineHeap[index].task->desiredPeriodUs;
+    deadlineHeapSiftUp(index);
+    deadlineHeapSiftDown(index);
+}
+
+static void deadlineQueueRebuild(timeUs_t currentTimeUs)
+{
+    deadlineHeapSize = 0;
+    eventTaskCount = 0;
+    for (int ii = 0; ii < taskQueueSize; ++ii) {
+        task_t *task = taskQueueArray[ii];
+        if (task->staticPriority == TASK_PRIORITY_REALTIME) {
+            continue;
+        }
+        if (task->checkFunc) {
+            eventTaskList[eventTaskCount].task = task;
+            eventTaskList[eventTaskCount].queuePos = ii;
+            eventTaskCount++;
+        } else {
+            deadlineQueueEntry_t *entry = &deadlineHeap[deadlineHeapSize];
+            entry->task = task;
+            entry->queuePos = ii;
+            entry->dueAtUs = task->lastExecutedAtUs + task->desiredPeriodUs;
+            if (currentTimeUs - task->lastExecutedAtUs >= (timeUs_t)task->desiredPeriodUs) {
+                // Task has been waiting for longer than cmpTimeUs() can represent, so pull its deadline forward
+                if (cmpTimeUs(currentTimeUs, entry->dueAtUs) < 0) {
+                    entry->dueAtUs = currentTimeUs;
+                }
+            }
+            deadlineHeapSiftUp(deadlineHeapSize++);
+        }
+    }
+    deadlineQueueDirty = false;
+}
+
+static void deadlineQueueUpdateTask(task_t *task)
+{
+    if (!useDeadlineQueue || deadlineQueueDirty) {
+        return;
+    }
+    for (int ii = 0; ii < deadlineHeapSize; ++ii) {
+        if (deadlineHeap[ii].task == task) {
+            deadlineHeapUpdate(ii);
+            return;
+        }
+    }
+}
+
 void taskSystemLoad(timeUs_t currentTimeUs)
 {
     UNUSED(currentTimeUs);
@@ -181,9 +306,11 @@ void rescheduleTask(taskId_e taskId, timeDelta_t newPeriodUs)
     if (taskId == TASK_SELF) {
         task_t *task = currentTask;
         task->desiredPeriodUs = MAX(SCHEDULER_DELAY_LIMIT, newPeriodUs);  // Limit delay to 100us (10 kHz) to prevent scheduler clogging
+        deadlineQueueUpdateTask(task);
     } else if (taskId < TASK_COUNT) {
         task_t *task = getTask(taskId);
         task->desiredPeriodUs = MAX(SCHEDULER_DELAY_LIMIT, newPeriodUs);  // Limit delay to 100us (10 kHz) to prevent scheduler clogging
+        deadlineQueueUpdateTask(task);
     }
 }
 
@@ -254,6 +381,32 @@ void schedulerResetCheckFunctionMaxExecutionTime(void)
 }
 #endif
 
+#if defined(USE_TASK_HISTOGRAMS)
+const histogram_t *getTaskExecutionTimeHistogram(taskId_e taskId)
+{
+    return &taskHistograms[taskId].executionTimeUs;
+}
+
+const histogram_t *getTaskLatenessHistogram(taskId_e taskId)
+{
+    return &taskHistograms[taskId].latenessUs;
+}
+
+const histogram_t *getGyroPeriodJitterHistogram(void)
+{
+    return &gyroPeriodJitterHistogram;
+}
+
+void schedulerResetTaskHistograms(void)
+{
+    for (int taskId = 0; taskId < TASK_COUNT; taskId++) {
+        histogramReset(&taskHistograms[taskId].executionTimeUs);
+        histogramReset(&taskHistograms[taskId].latenessUs);
+    }
+    histogramReset(&gyroPeriodJitterHistogram);
+}
+#endif
+
 void schedulerInit(void)
 {
     calculateTaskStatistics = true;
@@ -266,6 +419,12 @@ void schedulerOptimizeRate(bool optimizeRate)
     periodCalculationBasisOffset = optimizeRate ? offsetof(task_t, lastDesiredAt) : offsetof(task_t, lastExecutedAtUs);
 }
 
+void schedulerUseDeadlineQueue(bool enabled)
+{
+    useDeadlineQueue = enabled;
+    deadlineQueueDirty = true;
+}
+
 inline static timeUs_t getPeriodCalculationBasis(const task_t* task)
 {
     if (task->staticPriority == TASK_PRIORITY_REALTIME) {
@@ -280,6 +439,11 @@ FAST_CODE timeUs_t schedulerExecuteTask(task_t *selectedTask, timeUs_t currentTi
     timeUs_t taskExecutionTimeUs = 0;
 
     if (selectedTask) {
+#if defined(USE_TASK_HISTOGRAMS)
+        // Event driven tasks are late from the time they were signalled, all others from the time they became due
+        const timeUs_t desiredAtUs = selectedTask->checkFunc ? selectedTask->lastSignaledAtUs : getPeriodCalculationBasis(selectedTask) + selectedTask->desiredPeriodUs;
+        const bool firstExecution = selectedTask->lastExecutedAtUs == 0;
+#endif
         currentTask = selectedTask;
         selectedTask->taskLatestDeltaTimeUs = cmpTimeUs(currentTimeUs, selectedTask->lastExecutedAtUs);
 #if defined(USE_TASK_STATISTICS)
@@ -288,6 +452,7 @@ FAST_CODE timeUs_t schedulerExecuteTask(task_t *selectedTask, timeUs_t currentTi
         selectedTask->lastExecutedAtUs = currentTimeUs;
         selectedTask->lastDesiredAt += (cmpTimeUs(currentTimeUs, selectedTask->lastDesiredAt) / selectedTask->desiredPeriodUs) * selectedTask->desiredPeriodUs;
         selectedTask->dynamicPriority = 0;
+        selectedTask->taskAgeCycles = 0;
 
         // Execute task
 #if defined(USE_TASK_STATISTICS)
@@ -300,6 +465,13 @@ FAST_CODE timeUs_t schedulerExecuteTask(task_t *selectedTask, timeUs_t currentTi
             selectedTask->totalExecutionTimeUs += taskExecutionTimeUs;   // time consumed by scheduler + task
             selectedTask->maxExecutionTimeUs = MAX(selectedTask->maxExecutionTimeUs, taskExecutionTimeUs);
             selectedTask->movingAverageCycleTimeUs += 0.05f * (period - selectedTask->movingAverageCycleTimeUs);
+#if defined(USE_TASK_HISTOGRAMS)
+            taskHistograms_t *histograms = &taskHistograms[selectedTask - getTask(0)];
+            histogramAdd(&histograms->executionTimeUs, taskExecutionTimeUs);
+            if (!firstExecution) {
+                histogramAdd(&histograms->latenessUs, MAX(cmpTimeUs(currentTimeUs, desiredAtUs), 0));
+            }
+#endif
         } else
 #endif
         {
@@ -323,6 +495,116 @@ static void readSchedulerLocals(task_t *selectedTask, uint8_t selectedTaskDynami
 }
 #endif
 
+// Update the dynamic priority of an event driven task, returns true if the task is waiting to run
+static FAST_CODE bool schedulerUpdateEventDrivenTask(task_t *task, timeUs_t currentTimeUs)
+{
+#if defined(SCHEDULER_DEBUG)
+    const timeUs_t currentTimeBeforeCheckFuncCallUs = micros();
+#else
+    const timeUs_t currentTimeBeforeCheckFuncCallUs = currentTimeUs;
+#endif
+    // Increase priority for event driven tasks
+    if (task->dynamicPriority > 0) {
+        task->taskAgeCycles = 1 + ((currentTimeUs - task->lastSignaledAtUs) / task->desiredPeriodUs);
+        task->dynamicPriority = 1 + task->staticPriority * task->taskAgeCycles;
+        return true;
+    } else if (task->checkFunc(currentTimeBeforeCheckFuncCallUs, cmpTimeUs(currentTimeBeforeCheckFuncCallUs, task->lastExecutedAtUs))) {
+#if defined(SCHEDULER_DEBUG)
+        DEBUG_SET(DEBUG_SCHEDULER, 3, micros() - currentTimeBeforeCheckFuncCallUs);
+#endif
+#if defined(USE_TASK_STATISTICS)
+        if (calculateTaskStatistics) {
+            const uint32_t checkFuncExecutionTimeUs = micros() - currentTimeBeforeCheckFuncCallUs;
+            checkFuncMovingSumExecutionTimeUs += checkFuncExecutionTimeUs - checkFuncMovingSumExecutionTimeUs / TASK_STATS_MOVING_SUM_COUNT;
+            checkFuncMovingSumDeltaTimeUs += task->taskLatestDeltaTimeUs - checkFuncMovingSumDeltaTimeUs / TASK_STATS_MOVING_SUM_COUNT;
+            checkFuncTotalExecutionTimeUs += checkFuncExecutionTimeUs;   // time consumed by scheduler + task
+            checkFuncMaxExecutionTimeUs = MAX(checkFuncMaxExecutionTimeUs, checkFuncExecutionTimeUs);
+        }
+#endif
+        task->lastSignaledAtUs = currentTimeBeforeCheckFuncCallUs;
+        task->taskAgeCycles = 1;
+        task->dynamicPriority = 1 + task->staticPriority;
+        return true;
+    } else {
+        task->taskAgeCycles = 0;
+        return false;
+    }
+}
+
+// Update the dynamic priority of a time driven task, returns true if the task is waiting to run
+static FAST_CODE bool schedulerUpdateTimeDrivenTask(task_t *task, timeUs_t currentTimeUs)
+{
+    // Task is time-driven, dynamicPriority is last execution age (measured in desiredPeriods)
+    // Task age is calculated from last execution
+    task->taskAgeCycles = ((currentTimeUs - getPeriodCalculationBasis(task)) / task->desiredPeriodUs);
+    if (task->taskAgeCycles > 0) {
+        task->dynamicPriority = 1 + task->staticPriority * task->taskAgeCycles;
+        return true;
+    }
+    return false;
+}
+
+// Select the task to run by visiting only the event driven tasks and the time driven tasks which are due.
+// Gives the same result as scanning the whole queue: the highest dynamic priority wins and ties go to the
+// task nearest the front of the queue.
+static FAST_CODE task_t *schedulerSelectFromDeadlineQueue(timeUs_t currentTimeUs, uint16_t *selectedTaskDynamicPriority, uint16_t *waitingTasks, int *selectedHeapIndex)
+{
+    task_t *selectedTask = NULL;
+    int selectedQueuePos = TASK_COUNT;
+    *selectedHeapIndex = -1;
+
+    if (deadlineQueueDirty) {
+        deadlineQueueRebuild(currentTimeUs);
+    }
+
+    for (int ii = 0; ii < eventTaskCount; ++ii) {
+        task_t *task = eventTaskList[ii].task;
+        if (schedulerUpdateEventDrivenTask(task, currentTimeUs)) {
+            (*waitingTasks)++;
+        }
+        if (task->dynamicPriority > *selectedTaskDynamicPriority) {
+            *selectedTaskDynamicPriority = task->dynamicPriority;
+            selectedTask = task;
+            selectedQueuePos = eventTaskList[ii].queuePos;
+        }
+    }
+
+    // Depth first walk of the heap, a task's children are never due before it is
+    int stack[TASK_COUNT];
+    int stackSize = 0;
+    if (deadlineHeapSize > 0 && cmpTimeUs(currentTimeUs, deadlineHeap[0].dueAtUs) >= 0) {
+        stack[stackSize++] = 0;
+    }
+    while (stackSize > 0) {
+        const int index = stack[--stackSize];
+        const deadlineQueueEntry_t *entry = &deadlineHeap[index];
+        task_t *task = entry->task;
+        if (schedulerUpdateTimeDrivenTask(task, currentTimeUs)) {
+            (*waitingTasks)++;
+        }
+        if (task->dynamicPriority > *selectedTaskDynamicPriority
+            || (task->dynamicPriority == *selectedTaskDynamicPriority && task->dynamicPriority > 0 && entry->queuePos < selectedQueuePos)) {
+            *selectedTaskDynamicPriority = task->dynamicPriority;
+            selectedTask = task;
+            selectedQueuePos = entry->queuePos;
+            *selectedHeapIndex = index;
+        }
+#if defined(UNIT_TEST)
+        unittest_scheduler_examinedTasks++;
+#endif
+        for (int child = 2 * index + 1; child <= 2 * index + 2 && child < deadlineHeapSize; child++) {
+            if (cmpTimeUs(currentTimeUs, deadlineHeap[child].dueAtUs) >= 0) {
+                stack[stackSize++] = child;
+            }
+        }
+    }
+#if defined(UNIT_TEST)
+    unittest_scheduler_examinedTasks += eventTaskCount;
+#endif
+
+    return selectedTask;
+}
+
 FAST_CODE void scheduler(void)
 {
     // Cache currentTime
@@ -334,6 +616,7 @@ FAST_CODE void scheduler(void)
     uint16_t waitingTasks = 0;
     bool realtimeTaskRan = false;
     timeDelta_t gyroTaskDelayUs = 0;
+    int selectedHeapIndex = -1;
 
     if (gyroEnabled) {
         // Realtime gyro/filtering/PID tasks get complete priority
@@ -342,6 +625,11 @@ FAST_CODE void scheduler(void)
         gyroTaskDelayUs = cmpTimeUs(gyroExecuteTimeUs, currentTimeUs);  // time until the next expected gyro sample
         if (cmpTimeUs(currentTimeUs, gyroExecuteTimeUs) >= 0) {
             taskExecutionTimeUs = schedulerExecuteTask(gyroTask, currentTimeUs);
+#if defined(USE_TASK_HISTOGRAMS)
+            if (calculateTaskStatistics) {
+                histogramAdd(&gyroPeriodJitterHistogram, ABS(gyroTask->taskLatestDeltaTimeUs - gyroTask->desiredPeriodUs));
+            }
+#endif
             if (gyroFilterReady()) {
                 taskExecutionTimeUs += schedulerExecuteTask(getTask(TASK_FILTER), currentTimeUs);
             }
@@ -356,54 +644,28 @@ FAST_CODE void scheduler(void)
     if (!gyroEnabled || realtimeTaskRan || (gyroTaskDelayUs > GYRO_TASK_GUARD_INTERVAL_US)) {
         // The task to be invoked
 
-        // Update task dynamic priorities
-        for (task_t *task = queueFirst(); task != NULL; task = queueNext()) {
-            if (task->staticPriority != TASK_PRIORITY_REALTIME) {
-                // Task has checkFunc - event driven
-                if (task->checkFunc) {
-#if defined(SCHEDULER_DEBUG)
-                    const timeUs_t currentTimeBeforeCheckFuncCallUs = micros();
-#else
-                    const timeUs_t currentTimeBeforeCheckFuncCallUs = currentTimeUs;
-#endif
-                    // Increase priority for event driven tasks
-                    if (task->dynamicPriority > 0) {
-                        task->taskAgeCycles = 1 + ((currentTimeUs - task->lastSignaledAtUs) / task->desiredPeriodUs);
-                        task->dynamicPriority = 1 + task->staticPriority * task->taskAgeCycles;
-                        waitingTasks++;
-                    } else if (task->checkFunc(currentTimeBeforeCheckFuncCallUs, cmpTimeUs(currentTimeBeforeCheckFuncCallUs, task->lastExecutedAtUs))) {
-#if defined(SCHEDULER_DEBUG)
-                        DEBUG_SET(DEBUG_SCHEDULER, 3, micros() - currentTimeBeforeCheckFuncCallUs);
+        if (useDeadlineQueue) {
+            selectedTask = schedulerSelectFromDeadlineQueue(currentTimeUs, &selectedTaskDynamicPriority, &waitingTasks, &selectedHeapIndex);
+        } else {
+            // Update task dynamic priorities
+            for (task_t *task = queueFirst(); task != NULL; task = queueNext()) {
+                if (task->staticPriority != TASK_PRIORITY_REALTIME) {
+#if defined(UNIT_TEST)
+                    unittest_scheduler_examinedTasks++;
 #endif
-#if defined(USE_TASK_STATISTICS)
-                        if (calculateTaskStatistics) {
-                            const uint32_t checkFuncExecutionTimeUs = micros() - currentTimeBeforeCheckFuncCallUs;
-                            checkFuncMovingSumExecutionTimeUs += checkFuncExecutionTimeUs - checkFuncMovingSumExecutionTimeUs / TASK_STATS_MOVING_SUM_COUNT;
-                            checkFuncMovingSumDeltaTimeUs += task->taskLatestDeltaTimeUs - checkFuncMovingSumDeltaTimeUs / TASK_STATS_MOVING_SUM_COUNT;
-                            checkFuncTotalExecutionTimeUs += checkFuncExecutionTimeUs;   // time consumed by scheduler + task
-                            checkFuncMaxExecutionTimeUs = MAX(checkFuncMaxExecutionTimeUs, checkFuncExecutionTimeUs);
+                    if (task->checkFunc) {
+                        // Task has checkFunc - event driven
+                        if (schedulerUpdateEventDrivenTask(task, currentTimeUs)) {
+                            waitingTasks++;
                         }
-#endif
-                        task->lastSignaledAtUs = currentTimeBeforeCheckFuncCallUs;
-                        task->taskAgeCycles = 1;
-                        task->dynamicPriority = 1 + task->staticPriority;
-                        waitingTasks++;
-                    } else {
-                        task->taskAgeCycles = 0;
-                    }
-                } else {
-                    // Task is time-driven, dynamicPriority is last execution age (measured in desiredPeriods)
-                    // Task age is calculated from last execution
-                    task->taskAgeCycles = ((currentTimeUs - getPeriodCalculationBasis(task)) / task->desiredPeriodUs);
-                    if (task->taskAgeCycles > 0) {
-                        task->dynamicPriority = 1 + task->staticPriority * task->taskAgeCycles;
+                    } else if (schedulerUpdateTimeDrivenTask(task, currentTimeUs)) {
                         waitingTasks++;
                     }
-                }
 
-                if (task->dynamicPriority > selectedTaskDynamicPriority) {
-                    selectedTaskDynamicPriority = task->dynamicPriority;
-                    selectedTask = task;
+                    if (task->dynamicPriority > selectedTaskDynamicPriority) {
+                        selectedTaskDynamicPriority = task->dynamicPriority;
+                        selectedTask = task;
+                    }
                 }
             }
         }
@@ -422,6 +684,10 @@ FAST_CODE void scheduler(void)
             taskRequiredTimeUs += cmpTimeUs(micros(), currentTimeUs);
             if (!gyroEnabled || realtimeTaskRan || (taskRequiredTimeUs < gyroTaskDelayUs)) {
                 taskExecutionTimeUs += schedulerExecuteTask(selectedTask, currentTimeUs);
+                if (selectedHeapIndex >= 0 && !deadlineQueueDirty) {
+                    // Task has run, so move it to its next deadline
+                    deadlineHeapUpdate(selectedHeapIndex);
+                }
             } else {
                 selectedTask = NULL;
             }
@@ -20,6 +20,7 @@
 
 #pragma once
 
+#include "common/histogram.h"
 #include "common/time.h"
 #include "config/config.h"
 
@@ -145,6 +146,10 @@ typedef enum {
     TASK_PINIOBOX,
 #endif
 
+#ifdef USE_BLACKBOX
+    TASK_BLACKBOX,
+#endif
+
     /* Count of real tasks */
     TASK_COUNT,
 
@@ -191,11 +196,18 @@ void schedulerSetCalulateTaskStatistics(bool calculateTaskStatistics);
 void schedulerResetTaskStatistics(taskId_e taskId);
 void schedulerResetTaskMaxExecutionTime(taskId_e taskId);
 void schedulerResetCheckFunctionMaxExecutionTime(void);
+#if defined(USE_TASK_HISTOGRAMS)
+const histogram_t *getTaskExecutionTimeHistogram(taskId_e taskId);
+const histogram_t *getTaskLatenessHistogram(taskId_e taskId);
+const histogram_t *getGyroPeriodJitterHistogram(void);
+void schedulerResetTaskHistograms(void);
+#endif
 
 void schedulerInit(void);
 void scheduler(void);
 timeUs_t schedulerExecuteTask(task_t *selectedTask, timeUs_t currentTimeUs);
 void taskSystemLoad(timeUs_t currentTimeUs);
 void schedulerOptimizeRate(bool optimizeRate);
+void schedulerUseDeadlineQueue(bool enabled);
 void schedulerEnableGyro(void);
 uint16_t getAverageSystemLoadPercent(void);
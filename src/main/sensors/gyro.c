@@ -37,6 +37,7 @@
 #include "pg/pg.h"
 #include "pg/pg_ids.h"
 #include "pg/gyrodev.h"
+#include "pg/motor.h"
 
 #include "drivers/bus_spi.h"
 #include "drivers/io.h"
@@ -97,7 +98,7 @@ STATIC_UNIT_TESTED gyroDev_t * const gyroDevPtr = &gyro.gyroSensor1.gyroDev;
 #define GYRO_OVERFLOW_TRIGGER_THRESHOLD 31980  // 97.5% full scale (1950dps for 2000dps gyro)
 #define GYRO_OVERFLOW_RESET_THRESHOLD 30340    // 92.5% full scale (1850dps for 2000dps gyro)
 
-PG_REGISTER_WITH_RESET_FN(gyroConfig_t, gyroConfig, PG_GYRO_CONFIG, 8);
+PG_REGISTER_WITH_RESET_FN(gyroConfig_t, gyroConfig, PG_GYRO_CONFIG, 10);
 
 #ifndef GYRO_CONFIG_USE_GYRO_DEFAULT
 #define GYRO_CONFIG_USE_GYRO_DEFAULT GYRO_CONFIG_USE_GYRO_1
@@ -131,6 +132,8 @@ void pgResetFn_gyroConfig(gyroConfig_t *gyroConfig)
     gyroConfig->dyn_notch_width_percent = 8;
     gyroConfig->dyn_notch_q = 120;
     gyroConfig->dyn_notch_min_hz = 150;
+    gyroConfig->dyn_notch_estimator = DYN_NOTCH_ESTIMATOR_FFT;
+    gyroConfig->dyn_notch_count = 1;
     gyroConfig->gyro_filter_debug_axis = FD_ROLL;
 }
 
@@ -442,9 +445,10 @@ FAST_CODE void gyroUpdate(void)
 
     if (gyro.downsampleFilterEnabled) {
         // using gyro lowpass 2 filter for downsampling
-        gyro.sampleSum[X] = gyro.lowpass2FilterApplyFn((filter_t *)&gyro.lowpass2Filter[X], gyro.gyroADC[X]);
-        gyro.sampleSum[Y] = gyro.lowpass2FilterApplyFn((filter_t *)&gyro.lowpass2Filter[Y], gyro.gyroADC[Y]);
-        gyro.sampleSum[Z] = gyro.lowpass2FilterApplyFn((filter_t *)&gyro.lowpass2Filter[Z], gyro.gyroADC[Z]);
+        gyro.sampleSum[X] = gyro.gyroADC[X];
+        gyro.sampleSum[Y] = gyro.gyroADC[Y];
+        gyro.sampleSum[Z] = gyro.gyroADC[Z];
+        gyro.lowpass2FilterApplyFn((filterBank_t *)&gyro.lowpass2Filter, gyro.sampleSum);
     } else {
         // using simple averaging for downsampling
         gyro.sampleSum[X] += gyro.gyroADC[X];
@@ -454,26 +458,234 @@ FAST_CODE void gyroUpdate(void)
     }
 }
 
-#define GYRO_FILTER_FUNCTION_NAME filterGyro
+// settings for the stages of the filterGyro functions, see gyro_filter_impl.c
+#define GYRO_FILTER_ANY     0
+#define GYRO_FILTER_OFF     1
+#define GYRO_FILTER_ON      2
+#define GYRO_FILTER_PT1     3
+#define GYRO_FILTER_BIQUAD  4
+#define GYRO_FILTER_SINGLE  5
+#define GYRO_FILTER_DUAL    6
+
 #define GYRO_FILTER_DEBUG_SET(mode, index, value) do { UNUSED(mode); UNUSED(index); UNUSED(value); } while (0)
 #define GYRO_FILTER_AXIS_DEBUG_SET(axis, mode, index, value) do { UNUSED(axis); UNUSED(mode); UNUSED(index); UNUSED(value); } while (0)
+
+#define GYRO_FILTER_FUNCTION_NAME filterGyro
+#define GYRO_FILTER_RPM GYRO_FILTER_ANY
+#define GYRO_FILTER_NOTCHES GYRO_FILTER_ANY
+#define GYRO_FILTER_LOWPASS GYRO_FILTER_ANY
+#define GYRO_FILTER_DYN_NOTCH GYRO_FILTER_ANY
+#include "gyro_filter_impl.c"
+#undef GYRO_FILTER_FUNCTION_NAME
+
+#if defined(USE_GYRO_FILTER_VARIANTS) && defined(USE_GYRO_DATA_ANALYSE)
+// Variants of filterGyro for the common filter setups, with only the enabled stages compiled in and the filters
+// inlined. They are indexed by [rpm][static notches][lowpass biquad][dual dynamic notch], the other setups (no
+// lowpass, no dynamic notch) and the debug modes use the function pointers.
+
+#define GYRO_FILTER_FUNCTION_NAME filterGyroRpmOffNotchOffPt1Single
+#define GYRO_FILTER_RPM GYRO_FILTER_OFF
+#define GYRO_FILTER_NOTCHES GYRO_FILTER_OFF
+#define GYRO_FILTER_LOWPASS GYRO_FILTER_PT1
+#define GYRO_FILTER_DYN_NOTCH GYRO_FILTER_SINGLE
+#include "gyro_filter_impl.c"
+#undef GYRO_FILTER_FUNCTION_NAME
+
+#define GYRO_FILTER_FUNCTION_NAME filterGyroRpmOffNotchOffPt1Dual
+#define GYRO_FILTER_RPM GYRO_FILTER_OFF
+#define GYRO_FILTER_NOTCHES GYRO_FILTER_OFF
+#define GYRO_FILTER_LOWPASS GYRO_FILTER_PT1
+#define GYRO_FILTER_DYN_NOTCH GYRO_FILTER_DUAL
+#include "gyro_filter_impl.c"
+#undef GYRO_FILTER_FUNCTION_NAME
+
+#define GYRO_FILTER_FUNCTION_NAME filterGyroRpmOffNotchOffBiquadSingle
+#define GYRO_FILTER_RPM GYRO_FILTER_OFF
+#define GYRO_FILTER_NOTCHES GYRO_FILTER_OFF
+#define GYRO_FILTER_LOWPASS GYRO_FILTER_BIQUAD
+#define GYRO_FILTER_DYN_NOTCH GYRO_FILTER_SINGLE
+#include "gyro_filter_impl.c"
+#undef GYRO_FILTER_FUNCTION_NAME
+
+#define GYRO_FILTER_FUNCTION_NAME filterGyroRpmOffNotchOffBiquadDual
+#define GYRO_FILTER_RPM GYRO_FILTER_OFF
+#define GYRO_FILTER_NOTCHES GYRO_FILTER_OFF
+#define GYRO_FILTER_LOWPASS GYRO_FILTER_BIQUAD
+#define GYRO_FILTER_DYN_NOTCH GYRO_FILTER_DUAL
+#include "gyro_filter_impl.c"
+#undef GYRO_FILTER_FUNCTION_NAME
+
+#define GYRO_FILTER_FUNCTION_NAME filterGyroRpmOffNotchOnPt1Single
+#define GYRO_FILTER_RPM GYRO_FILTER_OFF
+#define GYRO_FILTER_NOTCHES GYRO_FILTER_ON
+#define GYRO_FILTER_LOWPASS GYRO_FILTER_PT1
+#define GYRO_FILTER_DYN_NOTCH GYRO_FILTER_SINGLE
+#include "gyro_filter_impl.c"
+#undef GYRO_FILTER_FUNCTION_NAME
+
+#define GYRO_FILTER_FUNCTION_NAME filterGyroRpmOffNotchOnPt1Dual
+#define GYRO_FILTER_RPM GYRO_FILTER_OFF
+#define GYRO_FILTER_NOTCHES GYRO_FILTER_ON
+#define GYRO_FILTER_LOWPASS GYRO_FILTER_PT1
+#define GYRO_FILTER_DYN_NOTCH GYRO_FILTER_DUAL
+#include "gyro_filter_impl.c"
+#undef GYRO_FILTER_FUNCTION_NAME
+
+#define GYRO_FILTER_FUNCTION_NAME filterGyroRpmOffNotchOnBiquadSingle
+#define GYRO_FILTER_RPM GYRO_FILTER_OFF
+#define GYRO_FILTER_NOTCHES GYRO_FILTER_ON
+#define GYRO_FILTER_LOWPASS GYRO_FILTER_BIQUAD
+#define GYRO_FILTER_DYN_NOTCH GYRO_FILTER_SINGLE
+#include "gyro_filter_impl.c"
+#undef GYRO_FILTER_FUNCTION_NAME
+
+#define GYRO_FILTER_FUNCTION_NAME filterGyroRpmOffNotchOnBiquadDual
+#define GYRO_FILTER_RPM GYRO_FILTER_OFF
+#define GYRO_FILTER_NOTCHES GYRO_FILTER_ON
+#define GYRO_FILTER_LOWPASS GYRO_FILTER_BIQUAD
+#define GYRO_FILTER_DYN_NOTCH GYRO_FILTER_DUAL
+#include "gyro_filter_impl.c"
+#undef GYRO_FILTER_FUNCTION_NAME
+
+#define GYRO_FILTER_FUNCTION_NAME filterGyroRpmOnNotchOffPt1Single
+#define GYRO_FILTER_RPM GYRO_FILTER_ON
+#define GYRO_FILTER_NOTCHES GYRO_FILTER_OFF
+#define GYRO_FILTER_LOWPASS GYRO_FILTER_PT1
+#define GYRO_FILTER_DYN_NOTCH GYRO_FILTER_SINGLE
 #include "gyro_filter_impl.c"
 #undef GYRO_FILTER_FUNCTION_NAME
+
+#define GYRO_FILTER_FUNCTION_NAME filterGyroRpmOnNotchOffPt1Dual
+#define GYRO_FILTER_RPM GYRO_FILTER_ON
+#define GYRO_FILTER_NOTCHES GYRO_FILTER_OFF
+#define GYRO_FILTER_LOWPASS GYRO_FILTER_PT1
+#define GYRO_FILTER_DYN_NOTCH GYRO_FILTER_DUAL
+#include "gyro_filter_impl.c"
+#undef GYRO_FILTER_FUNCTION_NAME
+
+#define GYRO_FILTER_FUNCTION_NAME filterGyroRpmOnNotchOffBiquadSingle
+#define GYRO_FILTER_RPM GYRO_FILTER_ON
+#define GYRO_FILTER_NOTCHES GYRO_FILTER_OFF
+#define GYRO_FILTER_LOWPASS GYRO_FILTER_BIQUAD
+#define GYRO_FILTER_DYN_NOTCH GYRO_FILTER_SINGLE
+#include "gyro_filter_impl.c"
+#undef GYRO_FILTER_FUNCTION_NAME
+
+#define GYRO_FILTER_FUNCTION_NAME filterGyroRpmOnNotchOffBiquadDual
+#define GYRO_FILTER_RPM GYRO_FILTER_ON
+#define GYRO_FILTER_NOTCHES GYRO_FILTER_OFF
+#define GYRO_FILTER_LOWPASS GYRO_FILTER_BIQUAD
+#define GYRO_FILTER_DYN_NOTCH GYRO_FILTER_DUAL
+#include "gyro_filter_impl.c"
+#undef GYRO_FILTER_FUNCTION_NAME
+
+#define GYRO_FILTER_FUNCTION_NAME filterGyroRpmOnNotchOnPt1Single
+#define GYRO_FILTER_RPM GYRO_FILTER_ON
+#define GYRO_FILTER_NOTCHES GYRO_FILTER_ON
+#define GYRO_FILTER_LOWPASS GYRO_FILTER_PT1
+#define GYRO_FILTER_DYN_NOTCH GYRO_FILTER_SINGLE
+#include "gyro_filter_impl.c"
+#undef GYRO_FILTER_FUNCTION_NAME
+
+#define GYRO_FILTER_FUNCTION_NAME filterGyroRpmOnNotchOnPt1Dual
+#define GYRO_FILTER_RPM GYRO_FILTER_ON
+#define GYRO_FILTER_NOTCHES GYRO_FILTER_ON
+#define GYRO_FILTER_LOWPASS GYRO_FILTER_PT1
+#define GYRO_FILTER_DYN_NOTCH GYRO_FILTER_DUAL
+#include "gyro_filter_impl.c"
+#undef GYRO_FILTER_FUNCTION_NAME
+
+#define GYRO_FILTER_FUNCTION_NAME filterGyroRpmOnNotchOnBiquadSingle
+#define GYRO_FILTER_RPM GYRO_FILTER_ON
+#define GYRO_FILTER_NOTCHES GYRO_FILTER_ON
+#define GYRO_FILTER_LOWPASS GYRO_FILTER_BIQUAD
+#define GYRO_FILTER_DYN_NOTCH GYRO_FILTER_SINGLE
+#include "gyro_filter_impl.c"
+#undef GYRO_FILTER_FUNCTION_NAME
+
+#define GYRO_FILTER_FUNCTION_NAME filterGyroRpmOnNotchOnBiquadDual
+#define GYRO_FILTER_RPM GYRO_FILTER_ON
+#define GYRO_FILTER_NOTCHES GYRO_FILTER_ON
+#define GYRO_FILTER_LOWPASS GYRO_FILTER_BIQUAD
+#define GYRO_FILTER_DYN_NOTCH GYRO_FILTER_DUAL
+#include "gyro_filter_impl.c"
+#undef GYRO_FILTER_FUNCTION_NAME
+
+static const gyroFilterFnPtr filterGyroVariants[2][2][2][2] = {
+    {
+        {
+            { filterGyroRpmOffNotchOffPt1Single, filterGyroRpmOffNotchOffPt1Dual },
+            { filterGyroRpmOffNotchOffBiquadSingle, filterGyroRpmOffNotchOffBiquadDual },
+        },
+        {
+            { filterGyroRpmOffNotchOnPt1Single, filterGyroRpmOffNotchOnPt1Dual },
+            { filterGyroRpmOffNotchOnBiquadSingle, filterGyroRpmOffNotchOnBiquadDual },
+        },
+    },
+    {
+        {
+            { filterGyroRpmOnNotchOffPt1Single, filterGyroRpmOnNotchOffPt1Dual },
+            { filterGyroRpmOnNotchOffBiquadSingle, filterGyroRpmOnNotchOffBiquadDual },
+        },
+        {
+            { filterGyroRpmOnNotchOnPt1Single, filterGyroRpmOnNotchOnPt1Dual },
+            { filterGyroRpmOnNotchOnBiquadSingle, filterGyroRpmOnNotchOnBiquadDual },
+        },
+    },
+};
+#endif
+
 #undef GYRO_FILTER_DEBUG_SET
 #undef GYRO_FILTER_AXIS_DEBUG_SET
 
 #define GYRO_FILTER_FUNCTION_NAME filterGyroDebug
 #define GYRO_FILTER_DEBUG_SET DEBUG_SET
 #define GYRO_FILTER_AXIS_DEBUG_SET(axis, mode, index, value) if (axis == (int)gyro.gyroDebugAxis) DEBUG_SET(mode, index, value)
+#define GYRO_FILTER_RPM GYRO_FILTER_ANY
+#define GYRO_FILTER_NOTCHES GYRO_FILTER_ANY
+#define GYRO_FILTER_LOWPASS GYRO_FILTER_ANY
+#define GYRO_FILTER_DYN_NOTCH GYRO_FILTER_ANY
 #include "gyro_filter_impl.c"
 #undef GYRO_FILTER_FUNCTION_NAME
 #undef GYRO_FILTER_DEBUG_SET
 #undef GYRO_FILTER_AXIS_DEBUG_SET
 
+// Picks the filterGyro function for the filters gyroInitFilters() enabled
+void gyroInitFilterFn(void)
+{
+    gyro.filterFn = filterGyro;
+
+#if defined(USE_GYRO_FILTER_VARIANTS) && defined(USE_GYRO_DATA_ANALYSE)
+    int lowpassBiquad;
+    if (gyro.lowpassFilterApplyFn == (filterBankApplyFnPtr)pt1FilterBankApply) {
+        lowpassBiquad = 0;
+    } else if (gyro.lowpassFilterApplyFn == (filterBankApplyFnPtr)biquadFilterBankApplyDF1
+        || gyro.lowpassFilterApplyFn == (filterBankApplyFnPtr)biquadFilterBankApply) {
+        lowpassBiquad = 1;
+    } else {
+        return;
+    }
+    if (!isDynamicFilterActive()) {
+        return;
+    }
+
+    // same test as rpmFilterInit(), which runs later from pidInit()
+#ifdef USE_RPM_FILTER
+    const int rpm = motorConfig()->dev.useDshotTelemetry && rpmFilterConfig()->gyro_rpm_notch_harmonics;
+#else
+    const int rpm = 0;
+#endif
+    const int notches = gyro.notchFilter1ApplyFn != nullFilterBankApply || gyro.notchFilter2ApplyFn != nullFilterBankApply;
+    const int dualDynNotch = gyro.notchFilterDynApplyFn2 != nullFilterBankApply;
+
+    gyro.filterFn = filterGyroVariants[rpm][notches][lowpassBiquad][dualDynNotch];
+#endif
+}
+
 FAST_CODE void gyroFiltering(timeUs_t currentTimeUs)
 {
     if (gyro.gyroDebugMode == DEBUG_NONE) {
-        filterGyro();
+        gyro.filterFn();
     } else {
         filterGyroDebug();
     }
@@ -630,14 +842,10 @@ void dynLpfGyroUpdate(float throttle)
         if (gyro.dynLpfFilter == DYN_LPF_PT1) {
             DEBUG_SET(DEBUG_DYN_LPF, 2, cutoffFreq);
             const float gyroDt = gyro.targetLooptime * 1e-6f;
-            for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
-                pt1FilterUpdateCutoff(&gyro.lowpassFilter[axis].pt1FilterState, pt1FilterGain(cutoffFreq, gyroDt));
-            }
+            pt1FilterBankUpdateCutoff(&gyro.lowpassFilter.pt1FilterState, pt1FilterGain(cutoffFreq, gyroDt));
         } else if (gyro.dynLpfFilter == DYN_LPF_BIQUAD) {
             DEBUG_SET(DEBUG_DYN_LPF, 2, cutoffFreq);
-            for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
-                biquadFilterUpdateLPF(&gyro.lowpassFilter[axis].biquadFilterState, cutoffFreq, gyro.targetLooptime);
-            }
+            biquadFilterBankUpdateLPF(&gyro.lowpassFilter.biquadFilterState, cutoffFreq, gyro.targetLooptime);
         }
     }
 }
@@ -44,8 +44,8 @@
 #endif
 
 typedef union gyroLowpassFilter_u {
-    pt1Filter_t pt1FilterState;
-    biquadFilter_t biquadFilterState;
+    pt1FilterBank_t pt1FilterState;
+    biquadFilterBank_t biquadFilterState;
 } gyroLowpassFilter_t;
 
 typedef enum gyroDetectionFlags_e {
@@ -69,6 +69,8 @@ typedef struct gyroSensor_s {
     gyroCalibration_t calibration;
 } gyroSensor_t;
 
+typedef void (*gyroFilterFnPtr)(void);
+
 typedef struct gyro_s {
     uint16_t sampleRateHz;
     uint32_t targetLooptime;
@@ -87,27 +89,31 @@ typedef struct gyro_s {
 
     gyroDev_t *rawSensorDev;           // pointer to the sensor providing the raw data for DEBUG_GYRO_RAW
 
+    // the filter pipeline run by gyroFiltering(), specialised for the enabled filters where possible
+    gyroFilterFnPtr filterFn;
+
     // lowpass gyro soft filter
-    filterApplyFnPtr lowpassFilterApplyFn;
-    gyroLowpassFilter_t lowpassFilter[XYZ_AXIS_COUNT];
+    filterBankApplyFnPtr lowpassFilterApplyFn;
+    gyroLowpassFilter_t lowpassFilter;
 
     // lowpass2 gyro soft filter
-    filterApplyFnPtr lowpass2FilterApplyFn;
-    gyroLowpassFilter_t lowpass2Filter[XYZ_AXIS_COUNT];
+    filterBankApplyFnPtr lowpass2FilterApplyFn;
+    gyroLowpassFilter_t lowpass2Filter;
 
     // notch filters
-    filterApplyFnPtr notchFilter1ApplyFn;
-    biquadFilter_t notchFilter1[XYZ_AXIS_COUNT];
-
-    filterApplyFnPtr notchFilter2ApplyFn;
-    biquadFilter_t notchFilter2[XYZ_AXIS_COUNT];
+    filterBankApplyFnPtr notchFilter1ApplyFn;
+    biquadFilterBank_t notchFilter1;
 
-    filterApplyFnPtr notchFilterDynApplyFn;
-    filterApplyFnPtr notchFilterDynApplyFn2;
-    biquadFilter_t notchFilterDyn[XYZ_AXIS_COUNT];
-    biquadFilter_t notchFilterDyn2[XYZ_AXIS_COUNT];
+    filterBankApplyFnPtr notchFilter2ApplyFn;
+    biquadFilterBank_t notchFilter2;
 
 #ifdef USE_GYRO_DATA_ANALYSE
+    filterBankApplyFnPtr notchFilterDynApplyFn;
+    filterBankApplyFnPtr notchFilterDynApplyFn2;
+    uint8_t notchFilterDynCount;
+    biquadFilterBank_t notchFilterDyn[DYN_NOTCH_COUNT_MAX];
+    biquadFilterBank_t notchFilterDyn2[DYN_NOTCH_COUNT_MAX];
+
     gyroAnalyseState_t gyroAnalyseState;
 #endif
 
@@ -145,6 +151,11 @@ enum {
     DYN_LPF_BIQUAD
 };
 
+typedef enum {
+    DYN_NOTCH_ESTIMATOR_FFT = 0,
+    DYN_NOTCH_ESTIMATOR_SDFT
+} dynNotchEstimator_e;
+
 typedef enum {
     YAW_SPIN_RECOVERY_OFF,
     YAW_SPIN_RECOVERY_ON,
@@ -193,6 +204,8 @@ typedef struct gyroConfig_s {
     uint8_t  dyn_notch_width_percent;
     uint16_t dyn_notch_q;
     uint16_t dyn_notch_min_hz;
+    uint8_t  dyn_notch_estimator;       // how the dynamic notch finds the noise peak, see dynNotchEstimator_e
+    uint8_t  dyn_notch_count;           // number of noise peaks per axis that get their own dynamic notch
 
     uint8_t  gyro_filter_debug_axis;
 
@@ -203,6 +216,7 @@ PG_DECLARE(gyroConfig_t, gyroConfig);
 
 void gyroUpdate(void);
 void gyroFiltering(timeUs_t currentTimeUs);
+void gyroInitFilterFn(void);
 bool gyroGetAccumulationAverage(float *accumulation);
 void gyroStartCalibration(bool isFirstArmingCalibration);
 bool isFirstArmingGyroCalibrationRunning(void);
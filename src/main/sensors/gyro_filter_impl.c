@@ -20,8 +20,21 @@
 
 #include "platform.h"
 
+// The stages are set at compile time by GYRO_FILTER_RPM, GYRO_FILTER_NOTCHES, GYRO_FILTER_LOWPASS and
+// GYRO_FILTER_DYN_NOTCH, which are #undef'd at the end. GYRO_FILTER_ANY runs a stage through its function
+// pointer, the other settings inline the stage or leave it out.
+
+#if GYRO_FILTER_DYN_NOTCH == GYRO_FILTER_ANY
+#define GYRO_FILTER_DYN_NOTCH_ACTIVE() isDynamicFilterActive()
+#else
+#define GYRO_FILTER_DYN_NOTCH_ACTIVE() true
+#endif
+
 static FAST_CODE void GYRO_FILTER_FUNCTION_NAME(void)
 {
+    // the filters are applied one stage at a time to the XYZ vector
+    float gyroADCf[XYZ_AXIS_COUNT];
+
     for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
         // DEBUG_GYRO_RAW records the raw value read from the sensor (not zero offset, not scaled)
         GYRO_FILTER_DEBUG_SET(DEBUG_GYRO_RAW, axis, gyro.rawSensorDev->gyroADCRaw[axis]);
@@ -34,63 +47,92 @@ static FAST_CODE void GYRO_FILTER_FUNCTION_NAME(void)
         GYRO_FILTER_AXIS_DEBUG_SET(axis, DEBUG_GYRO_SAMPLE, 0, lrintf(gyro.gyroADC[axis]));
 
         // downsample the individual gyro samples
-        float gyroADCf = 0;
+        gyroADCf[axis] = 0;
         if (gyro.downsampleFilterEnabled) {
             // using gyro lowpass 2 filter for downsampling
-            gyroADCf = gyro.sampleSum[axis];
+            gyroADCf[axis] = gyro.sampleSum[axis];
         } else {
             // using simple average for downsampling
             if (gyro.sampleCount) {
-                gyroADCf = gyro.sampleSum[axis] / gyro.sampleCount;
+                gyroADCf[axis] = gyro.sampleSum[axis] / gyro.sampleCount;
             }
             gyro.sampleSum[axis] = 0;
         }
 
         // DEBUG_GYRO_SAMPLE(1) Record the post-downsample value for the selected debug axis
-        GYRO_FILTER_AXIS_DEBUG_SET(axis, DEBUG_GYRO_SAMPLE, 1, lrintf(gyroADCf));
+        GYRO_FILTER_AXIS_DEBUG_SET(axis, DEBUG_GYRO_SAMPLE, 1, lrintf(gyroADCf[axis]));
+    }
 
 #ifdef USE_GYRO_DATA_ANALYSE
-        if (isDynamicFilterActive()) {
-            if (axis == gyro.gyroDebugAxis) {
-                GYRO_FILTER_DEBUG_SET(DEBUG_FFT, 0, lrintf(gyroADCf));
-                GYRO_FILTER_DEBUG_SET(DEBUG_FFT_FREQ, 3, lrintf(gyroADCf));
-                GYRO_FILTER_DEBUG_SET(DEBUG_DYN_LPF, 0, lrintf(gyroADCf));
-            }
-        }
+    if (GYRO_FILTER_DYN_NOTCH_ACTIVE()) {
+        GYRO_FILTER_DEBUG_SET(DEBUG_FFT, 0, lrintf(gyroADCf[gyro.gyroDebugAxis]));
+        GYRO_FILTER_DEBUG_SET(DEBUG_FFT_FREQ, 3, lrintf(gyroADCf[gyro.gyroDebugAxis]));
+        GYRO_FILTER_DEBUG_SET(DEBUG_DYN_LPF, 0, lrintf(gyroADCf[gyro.gyroDebugAxis]));
+    }
 #endif
 
-#ifdef USE_RPM_FILTER
-        gyroADCf = rpmFilterGyro(axis, gyroADCf);
+#if defined(USE_RPM_FILTER) && GYRO_FILTER_RPM != GYRO_FILTER_OFF
+    rpmFilterGyro(gyroADCf);
 #endif
 
-        // DEBUG_GYRO_SAMPLE(2) Record the post-RPM Filter value for the selected debug axis
-        GYRO_FILTER_AXIS_DEBUG_SET(axis, DEBUG_GYRO_SAMPLE, 2, lrintf(gyroADCf));
+    // DEBUG_GYRO_SAMPLE(2) Record the post-RPM Filter value for the selected debug axis
+    GYRO_FILTER_DEBUG_SET(DEBUG_GYRO_SAMPLE, 2, lrintf(gyroADCf[gyro.gyroDebugAxis]));
+
+    // apply static notch filters and software lowpass filters
+#if GYRO_FILTER_NOTCHES == GYRO_FILTER_ANY
+    gyro.notchFilter1ApplyFn((filterBank_t *)&gyro.notchFilter1, gyroADCf);
+    gyro.notchFilter2ApplyFn((filterBank_t *)&gyro.notchFilter2, gyroADCf);
+#elif GYRO_FILTER_NOTCHES == GYRO_FILTER_ON
+    biquadFilterBankApplyInline(&gyro.notchFilter1, gyroADCf);
+    biquadFilterBankApplyInline(&gyro.notchFilter2, gyroADCf);
+#endif
 
-        // apply static notch filters and software lowpass filters
-        gyroADCf = gyro.notchFilter1ApplyFn((filter_t *)&gyro.notchFilter1[axis], gyroADCf);
-        gyroADCf = gyro.notchFilter2ApplyFn((filter_t *)&gyro.notchFilter2[axis], gyroADCf);
-        gyroADCf = gyro.lowpassFilterApplyFn((filter_t *)&gyro.lowpassFilter[axis], gyroADCf);
+#if GYRO_FILTER_LOWPASS == GYRO_FILTER_ANY
+    gyro.lowpassFilterApplyFn((filterBank_t *)&gyro.lowpassFilter, gyroADCf);
+#elif GYRO_FILTER_LOWPASS == GYRO_FILTER_PT1
+    pt1FilterBankApplyInline(&gyro.lowpassFilter.pt1FilterState, gyroADCf);
+#elif GYRO_FILTER_LOWPASS == GYRO_FILTER_BIQUAD && defined(USE_DYN_LPF)
+    biquadFilterBankApplyDF1Inline(&gyro.lowpassFilter.biquadFilterState, gyroADCf);
+#elif GYRO_FILTER_LOWPASS == GYRO_FILTER_BIQUAD
+    biquadFilterBankApplyInline(&gyro.lowpassFilter.biquadFilterState, gyroADCf);
+#endif
 
-        // DEBUG_GYRO_SAMPLE(3) Record the post-static notch and lowpass filter value for the selected debug axis
-        GYRO_FILTER_AXIS_DEBUG_SET(axis, DEBUG_GYRO_SAMPLE, 3, lrintf(gyroADCf));
+    // DEBUG_GYRO_SAMPLE(3) Record the post-static notch and lowpass filter value for the selected debug axis
+    GYRO_FILTER_DEBUG_SET(DEBUG_GYRO_SAMPLE, 3, lrintf(gyroADCf[gyro.gyroDebugAxis]));
 
 #ifdef USE_GYRO_DATA_ANALYSE
-        if (isDynamicFilterActive()) {
-            if (axis == gyro.gyroDebugAxis) {
-                GYRO_FILTER_DEBUG_SET(DEBUG_FFT, 1, lrintf(gyroADCf));
-                GYRO_FILTER_DEBUG_SET(DEBUG_FFT_FREQ, 2, lrintf(gyroADCf));
-                GYRO_FILTER_DEBUG_SET(DEBUG_DYN_LPF, 3, lrintf(gyroADCf));
-            }
-            gyroDataAnalysePush(&gyro.gyroAnalyseState, axis, gyroADCf);
-            gyroADCf = gyro.notchFilterDynApplyFn((filter_t *)&gyro.notchFilterDyn[axis], gyroADCf);
-            gyroADCf = gyro.notchFilterDynApplyFn2((filter_t *)&gyro.notchFilterDyn2[axis], gyroADCf);
+    if (GYRO_FILTER_DYN_NOTCH_ACTIVE()) {
+        GYRO_FILTER_DEBUG_SET(DEBUG_FFT, 1, lrintf(gyroADCf[gyro.gyroDebugAxis]));
+        GYRO_FILTER_DEBUG_SET(DEBUG_FFT_FREQ, 2, lrintf(gyroADCf[gyro.gyroDebugAxis]));
+        GYRO_FILTER_DEBUG_SET(DEBUG_DYN_LPF, 3, lrintf(gyroADCf[gyro.gyroDebugAxis]));
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            gyroDataAnalysePush(&gyro.gyroAnalyseState, axis, gyroADCf[axis]);
         }
+        for (int i = 0; i < gyro.notchFilterDynCount; i++) {
+#if GYRO_FILTER_DYN_NOTCH == GYRO_FILTER_ANY
+            gyro.notchFilterDynApplyFn((filterBank_t *)&gyro.notchFilterDyn[i], gyroADCf);
+            gyro.notchFilterDynApplyFn2((filterBank_t *)&gyro.notchFilterDyn2[i], gyroADCf);
+#else
+            biquadFilterBankApplyDF1Inline(&gyro.notchFilterDyn[i], gyroADCf);
+#if GYRO_FILTER_DYN_NOTCH == GYRO_FILTER_DUAL
+            biquadFilterBankApplyDF1Inline(&gyro.notchFilterDyn2[i], gyroADCf);
+#endif
+#endif
+        }
+    }
 #endif
 
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
         // DEBUG_GYRO_FILTERED records the scaled, filtered, after all software filtering has been applied.
-        GYRO_FILTER_DEBUG_SET(DEBUG_GYRO_FILTERED, axis, lrintf(gyroADCf));
+        GYRO_FILTER_DEBUG_SET(DEBUG_GYRO_FILTERED, axis, lrintf(gyroADCf[axis]));
 
-        gyro.gyroADCf[axis] = gyroADCf;
+        gyro.gyroADCf[axis] = gyroADCf[axis];
     }
     gyro.sampleCount = 0;
 }
+
+#undef GYRO_FILTER_DYN_NOTCH_ACTIVE
+#undef GYRO_FILTER_RPM
+#undef GYRO_FILTER_NOTCHES
+#undef GYRO_FILTER_LOWPASS
+#undef GYRO_FILTER_DYN_NOTCH
@@ -100,49 +100,50 @@ static uint16_t calculateNyquistAdjustedNotchHz(uint16_t notchHz, uint16_t notch
 
 static void gyroInitFilterNotch1(uint16_t notchHz, uint16_t notchCutoffHz)
 {
-    gyro.notchFilter1ApplyFn = nullFilterApply;
+    gyro.notchFilter1ApplyFn = nullFilterBankApply;
+    // the filterGyro variants with static notches apply both of them
+    biquadFilterBankInitPassthrough(&gyro.notchFilter1);
 
     notchHz = calculateNyquistAdjustedNotchHz(notchHz, notchCutoffHz);
 
     if (notchHz != 0 && notchCutoffHz != 0) {
-        gyro.notchFilter1ApplyFn = (filterApplyFnPtr)biquadFilterApply;
+        gyro.notchFilter1ApplyFn = (filterBankApplyFnPtr)biquadFilterBankApply;
         const float notchQ = filterGetNotchQ(notchHz, notchCutoffHz);
-        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
-            biquadFilterInit(&gyro.notchFilter1[axis], notchHz, gyro.targetLooptime, notchQ, FILTER_NOTCH);
-        }
+        biquadFilterBankInit(&gyro.notchFilter1, notchHz, gyro.targetLooptime, notchQ, FILTER_NOTCH);
     }
 }
 
 static void gyroInitFilterNotch2(uint16_t notchHz, uint16_t notchCutoffHz)
 {
-    gyro.notchFilter2ApplyFn = nullFilterApply;
+    gyro.notchFilter2ApplyFn = nullFilterBankApply;
+    // the filterGyro variants with static notches apply both of them
+    biquadFilterBankInitPassthrough(&gyro.notchFilter2);
 
     notchHz = calculateNyquistAdjustedNotchHz(notchHz, notchCutoffHz);
 
     if (notchHz != 0 && notchCutoffHz != 0) {
-        gyro.notchFilter2ApplyFn = (filterApplyFnPtr)biquadFilterApply;
+        gyro.notchFilter2ApplyFn = (filterBankApplyFnPtr)biquadFilterBankApply;
         const float notchQ = filterGetNotchQ(notchHz, notchCutoffHz);
-        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
-            biquadFilterInit(&gyro.notchFilter2[axis], notchHz, gyro.targetLooptime, notchQ, FILTER_NOTCH);
-        }
+        biquadFilterBankInit(&gyro.notchFilter2, notchHz, gyro.targetLooptime, notchQ, FILTER_NOTCH);
     }
 }
 
 #ifdef USE_GYRO_DATA_ANALYSE
 static void gyroInitFilterDynamicNotch()
 {
-    gyro.notchFilterDynApplyFn = nullFilterApply;
-    gyro.notchFilterDynApplyFn2 = nullFilterApply;
+    gyro.notchFilterDynApplyFn = nullFilterBankApply;
+    gyro.notchFilterDynApplyFn2 = nullFilterBankApply;
+    gyro.notchFilterDynCount = constrain(gyroConfig()->dyn_notch_count, 1, DYN_NOTCH_COUNT_MAX);
 
     if (isDynamicFilterActive()) {
-        gyro.notchFilterDynApplyFn = (filterApplyFnPtr)biquadFilterApplyDF1; // must be this function, not DF2
+        gyro.notchFilterDynApplyFn = (filterBankApplyFnPtr)biquadFilterBankApplyDF1; // must be this function, not DF2
         if(gyroConfig()->dyn_notch_width_percent != 0) {
-            gyro.notchFilterDynApplyFn2 = (filterApplyFnPtr)biquadFilterApplyDF1; // must be this function, not DF2
+            gyro.notchFilterDynApplyFn2 = (filterBankApplyFnPtr)biquadFilterBankApplyDF1; // must be this function, not DF2
         }
         const float notchQ = filterGetNotchQ(DYNAMIC_NOTCH_DEFAULT_CENTER_HZ, DYNAMIC_NOTCH_DEFAULT_CUTOFF_HZ); // any defaults OK here
-        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
-            biquadFilterInit(&gyro.notchFilterDyn[axis], DYNAMIC_NOTCH_DEFAULT_CENTER_HZ, gyro.targetLooptime, notchQ, FILTER_NOTCH);
-            biquadFilterInit(&gyro.notchFilterDyn2[axis], DYNAMIC_NOTCH_DEFAULT_CENTER_HZ, gyro.targetLooptime, notchQ, FILTER_NOTCH);
+        for (int i = 0; i < gyro.notchFilterDynCount; i++) {
+            biquadFilterBankInit(&gyro.notchFilterDyn[i], DYNAMIC_NOTCH_DEFAULT_CENTER_HZ, gyro.targetLooptime, notchQ, FILTER_NOTCH);
+            biquadFilterBankInit(&gyro.notchFilterDyn2[i], DYNAMIC_NOTCH_DEFAULT_CENTER_HZ, gyro.targetLooptime, notchQ, FILTER_NOTCH);
         }
     }
 }
@@ -150,18 +151,18 @@ static void gyroInitFilterDynamicNotch()
 
 static bool gyroInitLowpassFilterLpf(int slot, int type, uint16_t lpfHz, uint32_t looptime)
 {
-    filterApplyFnPtr *lowpassFilterApplyFn;
+    filterBankApplyFnPtr *lowpassFilterApplyFn;
     gyroLowpassFilter_t *lowpassFilter = NULL;
 
     switch (slot) {
     case FILTER_LOWPASS:
         lowpassFilterApplyFn = &gyro.lowpassFilterApplyFn;
-        lowpassFilter = gyro.lowpassFilter;
+        lowpassFilter = &gyro.lowpassFilter;
         break;
 
     case FILTER_LOWPASS2:
         lowpassFilterApplyFn = &gyro.lowpass2FilterApplyFn;
-        lowpassFilter = gyro.lowpass2Filter;
+        lowpassFilter = &gyro.lowpass2Filter;
         break;
 
     default:
@@ -179,27 +180,23 @@ static bool gyroInitLowpassFilterLpf(int slot, int type, uint16_t lpfHz, uint32_
 
     // Dereference the pointer to null before checking valid cutoff and filter
     // type. It will be overridden for positive cases.
-    *lowpassFilterApplyFn = nullFilterApply;
+    *lowpassFilterApplyFn = nullFilterBankApply;
 
     // If lowpass cutoff has been specified and is less than the Nyquist frequency
     if (lpfHz && lpfHz <= gyroFrequencyNyquist) {
         switch (type) {
         case FILTER_PT1:
-            *lowpassFilterApplyFn = (filterApplyFnPtr) pt1FilterApply;
-            for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
-                pt1FilterInit(&lowpassFilter[axis].pt1FilterState, gain);
-            }
+            *lowpassFilterApplyFn = (filterBankApplyFnPtr) pt1FilterBankApply;
+            pt1FilterBankInit(&lowpassFilter->pt1FilterState, gain);
             ret = true;
             break;
         case FILTER_BIQUAD:
 #ifdef USE_DYN_LPF
-            *lowpassFilterApplyFn = (filterApplyFnPtr) biquadFilterApplyDF1;
+            *lowpassFilterApplyFn = (filterBankApplyFnPtr) biquadFilterBankApplyDF1;
 #else
-            *lowpassFilterApplyFn = (filterApplyFnPtr) biquadFilterApply;
+            *lowpassFilterApplyFn = (filterBankApplyFnPtr) biquadFilterBankApply;
 #endif
-            for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
-                biquadFilterInitLPF(&lowpassFilter[axis].biquadFilterState, lpfHz, looptime);
-            }
+            biquadFilterBankInitLPF(&lowpassFilter->biquadFilterState, lpfHz, looptime);
             ret = true;
             break;
         }
@@ -265,6 +262,8 @@ void gyroInitFilters(void)
 #ifdef USE_GYRO_DATA_ANALYSE
     gyroDataAnalyseStateInit(&gyro.gyroAnalyseState, gyro.targetLooptime);
 #endif
+
+    gyroInitFilterFn();
 }
 
 #if defined(USE_GYRO_SLEW_LIMITER)
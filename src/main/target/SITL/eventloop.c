@@ -0,0 +1,117 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include <errno.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+
+#include "common/utils.h"
+
+#include "eventloop.h"
+
+#define EVENT_LOOP_MAX_EVENTS 16
+
+static int epollFd = -1;
+static eventLoopSource_t stopSource;
+static bool running;
+
+static void onStop(uint32_t events, void *data)
+{
+    UNUSED(events);
+    UNUSED(data);
+
+    uint64_t count;
+    const ssize_t ret = read(stopSource.fd, &count, sizeof(count));
+    UNUSED(ret);
+    __atomic_store_n(&running, false, __ATOMIC_RELEASE);
+}
+
+bool eventLoopInit(void)
+{
+    epollFd = epoll_create1(EPOLL_CLOEXEC);
+    if (epollFd < 0) {
+        fprintf(stderr, "[eventLoop]epoll_create1 failed - %d\n", errno);
+        return false;
+    }
+
+    const int stopFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (stopFd < 0) {
+        return false;
+    }
+    running = true;
+
+    return eventLoopAdd(&stopSource, stopFd, EPOLLIN, onStop, NULL);
+}
+
+bool eventLoopAdd(eventLoopSource_t *source, int fd, uint32_t events, eventLoopCallbackPtr callback, void *data)
+{
+    source->fd = fd;
+    source->callback = callback;
+    source->data = data;
+
+    struct epoll_event event = { .events = events, .data.ptr = source };
+    return epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &event) == 0;
+}
+
+bool eventLoopModify(eventLoopSource_t *source, uint32_t events)
+{
+    struct epoll_event event = { .events = events, .data.ptr = source };
+    return epoll_ctl(epollFd, EPOLL_CTL_MOD, source->fd, &event) == 0;
+}
+
+// Events that epoll_wait() already returned for the source are dropped, unless it is added again before they are handled
+void eventLoopRemove(eventLoopSource_t *source)
+{
+    epoll_ctl(epollFd, EPOLL_CTL_DEL, source->fd, NULL);
+    source->fd = -1;
+}
+
+// Blocks in epoll_wait() until there is something to do, until eventLoopStop() is called
+void eventLoopRun(void)
+{
+    struct epoll_event events[EVENT_LOOP_MAX_EVENTS];
+
+    while (__atomic_load_n(&running, __ATOMIC_ACQUIRE)) {
+        const int count = epoll_wait(epollFd, events, EVENT_LOOP_MAX_EVENTS, -1);
+        if (count < 0 && errno != EINTR) {
+            fprintf(stderr, "[eventLoop]epoll_wait failed - %d\n", errno);
+            break;
+        }
+        for (int i = 0; i < count; i++) {
+            const eventLoopSource_t *source = events[i].data.ptr;
+            if (source->fd >= 0) {
+                source->callback(events[i].events, source->data);
+            }
+        }
+    }
+}
+
+void eventLoopStop(void)
+{
+    const uint64_t one = 1;
+    if (write(stopSource.fd, &one, sizeof(one)) < 0) {
+        __atomic_store_n(&running, false, __ATOMIC_RELEASE);
+    }
+}
@@ -0,0 +1,44 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <sys/epoll.h>
+
+// epoll based event loop for the SITL I/O thread.
+// Sources can be added, modified and removed from any thread, the callbacks run on the thread in eventLoopRun().
+
+typedef void (*eventLoopCallbackPtr)(uint32_t events, void *data);
+
+typedef struct eventLoopSource_s {
+    int fd;
+    eventLoopCallbackPtr callback;
+    void *data;
+} eventLoopSource_t;
+
+bool eventLoopInit(void);
+bool eventLoopAdd(eventLoopSource_t *source, int fd, uint32_t events, eventLoopCallbackPtr callback, void *data);
+bool eventLoopModify(eventLoopSource_t *source, uint32_t events);
+void eventLoopRemove(eventLoopSource_t *source);
+void eventLoopRun(void);
+void eventLoopStop(void);
@@ -26,6 +26,7 @@
 
 #include <errno.h>
 #include <time.h>
+#include <pthread.h>
 
 #include "common/maths.h"
 
@@ -54,7 +55,7 @@ const timerHardware_t timerHardware[1]; // unused
 
 #include "rx/rx.h"
 
-#include "dyad.h"
+#include "target/SITL/eventloop.h"
 #include "target/SITL/udplink.h"
 
 uint32_t SystemCoreClock;
@@ -64,16 +65,19 @@ static servo_packet pwmPkt;
 
 static struct timespec start_time;
 static double simRate = 1.0;
-static pthread_t tcpWorker, udpWorker;
-static bool workerRunning = true;
+static pthread_t ioWorker;
 static udpLink_t stateLink, pwmLink;
-static pthread_mutex_t updateLock;
-static pthread_mutex_t mainLoopLock;
+#if !defined(SIMULATOR_LOCKSTEP)
+static eventLoopSource_t stateSource;
+#endif
+// set by the I/O thread for every fdm_packet, taken by the flight loop
+static bool servoPacketAllowed = true;
+static bool mainLoopAllowed = true;
 
 int timeval_sub(struct timespec *result, struct timespec *x, struct timespec *y);
 
 int lockMainPID(void) {
-    return pthread_mutex_trylock(&mainLoopLock);
+    return __atomic_exchange_n(&mainLoopAllowed, false, __ATOMIC_ACQ_REL) ? 0 : 1;
 }
 
 #define RAD2DEG (180.0 / M_PI)
@@ -82,27 +86,7 @@ int lockMainPID(void) {
 void sendMotorUpdate() {
     udpSend(&pwmLink, &pwmPkt, sizeof(servo_packet));
 }
-void updateState(const fdm_packet* pkt) {
-    static double last_timestamp = 0; // in seconds
-    static uint64_t last_realtime = 0; // in uS
-    static struct timespec last_ts; // last packet
-
-    struct timespec now_ts;
-    clock_gettime(CLOCK_MONOTONIC, &now_ts);
-
-    const uint64_t realtime_now = micros64_real();
-    if (realtime_now > last_realtime + 500*1e3) { // 500ms timeout
-        last_timestamp = pkt->timestamp;
-        last_realtime = realtime_now;
-        sendMotorUpdate();
-        return;
-    }
-
-    const double deltaSim = pkt->timestamp - last_timestamp;  // in seconds
-    if (deltaSim < 0) { // don't use old packet
-        return;
-    }
-
+static void updateSensors(const fdm_packet* pkt, double deltaSim) {
     int16_t x,y,z;
     x = constrain(-pkt->imu_linear_acceleration_xyz[0] * ACC_SCALE, -32767, 32767);
     y = constrain(-pkt->imu_linear_acceleration_xyz[1] * ACC_SCALE, -32767, 32767);
@@ -150,8 +134,33 @@ void updateState(const fdm_packet* pkt) {
 #if defined(SIMULATOR_IMU_SYNC)
     imuSetHasNewData(deltaSim*1e6);
     imuUpdateAttitude(micros());
+#else
+    UNUSED(deltaSim);
 #endif
+}
 
+void updateState(const fdm_packet* pkt) {
+    static double last_timestamp = 0; // in seconds
+    static uint64_t last_realtime = 0; // in uS
+    static struct timespec last_ts; // last packet
+
+    struct timespec now_ts;
+    clock_gettime(CLOCK_MONOTONIC, &now_ts);
+
+    const uint64_t realtime_now = micros64_real();
+    if (realtime_now > last_realtime + 500*1e3) { // 500ms timeout
+        last_timestamp = pkt->timestamp;
+        last_realtime = realtime_now;
+        sendMotorUpdate();
+        return;
+    }
+
+    const double deltaSim = pkt->timestamp - last_timestamp;  // in seconds
+    if (deltaSim < 0) { // don't use old packet
+        return;
+    }
+
+    updateSensors(pkt, deltaSim);
 
     if (deltaSim < 0.02 && deltaSim > 0) { // simulator should run faster than 50Hz
 //        simRate = simRate * 0.5 + (1e6 * deltaSim / (realtime_now - last_realtime)) * 0.5;
@@ -167,44 +176,81 @@ void updateState(const fdm_packet* pkt) {
     last_ts.tv_sec = now_ts.tv_sec;
     last_ts.tv_nsec = now_ts.tv_nsec;
 
-    pthread_mutex_unlock(&updateLock); // can send PWM output now
+    __atomic_store_n(&servoPacketAllowed, true, __ATOMIC_RELEASE); // can send PWM output now
 
 #if defined(SIMULATOR_GYROPID_SYNC)
-    pthread_mutex_unlock(&mainLoopLock); // can run main loop
+    __atomic_store_n(&mainLoopAllowed, true, __ATOMIC_RELEASE); // can run main loop
 #endif
 }
 
-static void* udpThread(void* data) {
+#if !defined(SIMULATOR_LOCKSTEP)
+static void onFdmPacket(uint32_t events, void *data) {
+    UNUSED(events);
     UNUSED(data);
-    int n = 0;
 
-    while (workerRunning) {
-        n = udpRecv(&stateLink, &fdmPkt, sizeof(fdm_packet), 100);
-        if (n == sizeof(fdm_packet)) {
-//            printf("[data]new fdm %d\n", n);
-            updateState(&fdmPkt);
-        }
+    while (udpRecv(&stateLink, &fdmPkt, sizeof(fdm_packet), 0) == sizeof(fdm_packet)) {
+//        printf("[data]new fdm\n");
+        updateState(&fdmPkt);
     }
+}
+#endif
 
-    printf("udpThread end!!\n");
+// serial over TCP and the fdm link, sleeps in epoll_wait() until there is something to do
+static void* ioThread(void* data) {
+    UNUSED(data);
+
+    eventLoopRun();
+
+    printf("ioThread end!!\n");
     return NULL;
 }
 
-static void* tcpThread(void* data) {
-    UNUSED(data);
+#if defined(SIMULATOR_LOCKSTEP)
+// The main loop owns the fdm link: the simulated clock only moves forward in the main loop and in delays, and stops at
+// the timestamp of the last fdm_packet until the servo_packet has been sent back and the next fdm_packet received.
+static uint64_t simTimeUs = 0;
+static uint64_t packetTimeUs = 0;   // simulated time of the last fdm_packet
+static bool lockstepStarted = false;
 
-    dyad_init();
-    dyad_setTickInterval(0.2f);
-    dyad_setUpdateTimeout(0.5f);
+static void lockstepReceive(void) {
+    static double first_timestamp;  // in seconds
+    static double last_timestamp;   // in seconds
+    static uint64_t firstPacketTimeUs;
 
-    while (workerRunning) {
-        dyad_update();
+    while (udpRecv(&stateLink, &fdmPkt, sizeof(fdm_packet), 100) != sizeof(fdm_packet)) {
     }
 
-    dyad_shutdown();
-    printf("tcpThread end!!\n");
-    return NULL;
+    if (!lockstepStarted) {
+        printf("[lockstep]first fdm packet at %.6lf, simulated time %luus\n", fdmPkt.timestamp, simTimeUs);
+        first_timestamp = fdmPkt.timestamp;
+        last_timestamp = fdmPkt.timestamp;
+        firstPacketTimeUs = simTimeUs;
+        lockstepStarted = true;
+    }
+
+    const double deltaSim = fdmPkt.timestamp - last_timestamp;  // in seconds
+    if (deltaSim < 0) { // don't use old packet, reply without running the loop
+        return;
+    }
+
+    updateSensors(&fdmPkt, deltaSim);
+
+    // from the first timestamp, so that rounding doesn't add up
+    packetTimeUs = firstPacketTimeUs + llrint((fdmPkt.timestamp - first_timestamp) * 1e6);
+    last_timestamp = fdmPkt.timestamp;
+}
+
+void simulatorLockstepStep(void) {
+    if (simTimeUs >= packetTimeUs) {
+        if (lockstepStarted) {
+            sendMotorUpdate();
+        }
+        lockstepReceive();
+    }
+
+    simTimeUs = MIN(simTimeUs + SIMULATOR_LOCKSTEP_STEP_US, MAX(packetTimeUs, simTimeUs));
 }
+#endif
 
 // system
 void systemInit(void) {
@@ -215,19 +261,8 @@ void systemInit(void) {
 
     SystemCoreClock = 500 * 1e6; // fake 500MHz
 
-    if (pthread_mutex_init(&updateLock, NULL) != 0) {
-        printf("Create updateLock error!\n");
-        exit(1);
-    }
-
-    if (pthread_mutex_init(&mainLoopLock, NULL) != 0) {
-        printf("Create mainLoopLock error!\n");
-        exit(1);
-    }
-
-    ret = pthread_create(&tcpWorker, NULL, tcpThread, NULL);
-    if (ret != 0) {
-        printf("Create tcpWorker error!\n");
+    if (!eventLoopInit()) {
+        printf("Create event loop error!\n");
         exit(1);
     }
 
@@ -237,9 +272,15 @@ void systemInit(void) {
     ret = udpInit(&stateLink, NULL, 9003, true);
     printf("start UDP server...%d\n", ret);
 
-    ret = pthread_create(&udpWorker, NULL, udpThread, NULL);
+#if defined(SIMULATOR_LOCKSTEP)
+    printf("[lockstep]%dus per main loop pass\n", SIMULATOR_LOCKSTEP_STEP_US);
+#else
+    eventLoopAdd(&stateSource, stateLink.fd, EPOLLIN, onFdmPacket, NULL);
+#endif
+
+    ret = pthread_create(&ioWorker, NULL, ioThread, NULL);
     if (ret != 0) {
-        printf("Create udpWorker error!\n");
+        printf("Create ioWorker error!\n");
         exit(1);
     }
 
@@ -249,18 +290,16 @@ void systemInit(void) {
 
 void systemReset(void){
     printf("[system]Reset!\n");
-    workerRunning = false;
-    pthread_join(tcpWorker, NULL);
-    pthread_join(udpWorker, NULL);
+    eventLoopStop();
+    pthread_join(ioWorker, NULL);
     exit(0);
 }
 void systemResetToBootloader(bootloaderRequestType_e requestType) {
     UNUSED(requestType);
 
     printf("[system]ResetToBootloader!\n");
-    workerRunning = false;
-    pthread_join(tcpWorker, NULL);
-    pthread_join(udpWorker, NULL);
+    eventLoopStop();
+    pthread_join(ioWorker, NULL);
     exit(0);
 }
 
@@ -302,6 +341,15 @@ uint64_t millis64_real() {
     return 1.0e3*((ts.tv_sec + (ts.tv_nsec*1.0e-9)) - (start_time.tv_sec + (start_time.tv_nsec*1.0e-9)));
 }
 
+#if defined(SIMULATOR_LOCKSTEP)
+uint64_t micros64() {
+    return simTimeUs;
+}
+
+uint64_t millis64() {
+    return simTimeUs / 1000;
+}
+#else
 uint64_t micros64() {
     static uint64_t last = 0;
     static uint64_t out = 0;
@@ -325,6 +373,7 @@ uint64_t millis64() {
     return out*1e-6;
 //    return millis64_real();
 }
+#endif
 
 uint32_t micros(void) {
     return micros64() & 0xFFFFFFFF;
@@ -341,12 +390,21 @@ void microsleep(uint32_t usec) {
     while (nanosleep(&ts, &ts) == -1 && errno == EINTR) ;
 }
 
+void delayMicroseconds_real(uint32_t us) {
+    microsleep(us);
+}
+
+#if defined(SIMULATOR_LOCKSTEP)
 void delayMicroseconds(uint32_t us) {
-    microsleep(us / simRate);
+    simTimeUs += us;
 }
 
-void delayMicroseconds_real(uint32_t us) {
-    microsleep(us);
+void delay(uint32_t ms) {
+    simTimeUs += (uint64_t)ms * 1000;
+}
+#else
+void delayMicroseconds(uint32_t us) {
+    microsleep(us / simRate);
 }
 
 void delay(uint32_t ms) {
@@ -356,6 +414,7 @@ void delay(uint32_t ms) {
         microsleep(1000);
     }
 }
+#endif
 
 // Subtract the ‘struct timespec’ values X and Y,  storing the result in RESULT.
 // Return 1 if the difference is negative, otherwise 0.
@@ -458,9 +517,12 @@ static void pwmCompleteMotorUpdate(void)
     pwmPkt.motor_speed[1] = motorsPwm[2] / outScale;
     pwmPkt.motor_speed[2] = motorsPwm[3] / outScale;
 
+    // in lockstep, simulatorLockstepStep() sends it once the firmware has caught up with the fdm_packet
+#if !defined(SIMULATOR_LOCKSTEP)
     // get one "fdm_packet" can only send one "servo_packet"!!
-    if (pthread_mutex_trylock(&updateLock) != 0) return;
+    if (!__atomic_exchange_n(&servoPacketAllowed, false, __ATOMIC_ACQ_REL)) return;
     udpSend(&pwmLink, &pwmPkt, sizeof(servo_packet));
+#endif
 //    printf("[pwm]%u:%u,%u,%u,%u\n", idlePulse, motorsPwm[0], motorsPwm[1], motorsPwm[2], motorsPwm[3]);
 }
 
@@ -40,6 +40,14 @@
 //#define SIMULATOR_IMU_SYNC
 //#define SIMULATOR_GYROPID_SYNC
 
+// lockstep with the simulator: time only advances up to the timestamp of the last fdm_packet, then a servo_packet
+// is sent back and the firmware waits for the next fdm_packet. Runs are reproducible and not tied to realtime.
+//#define SIMULATOR_LOCKSTEP
+#if defined(SIMULATOR_LOCKSTEP) && !defined(SIMULATOR_LOCKSTEP_STEP_US)
+// simulated time that passes on every pass of the main loop
+#define SIMULATOR_LOCKSTEP_STEP_US 5
+#endif
+
 // file name to save config
 #define EEPROM_FILENAME "eeprom.bin"
 #define CONFIG_IN_FILE
@@ -69,6 +77,9 @@
 #define USE_BARO
 #define USE_FAKE_BARO
 
+// logs to files in ./logs, set blackbox_device = FILE
+#define USE_BLACKBOX_FILE
+
 #define USABLE_TIMER_CHANNEL_COUNT 0
 
 #define USE_UART1
@@ -254,5 +265,6 @@ uint64_t micros64(void);
 uint64_t millis64(void);
 
 int lockMainPID(void);
+void simulatorLockstepStep(void);
 
 
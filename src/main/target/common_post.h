@@ -36,6 +36,15 @@
 #undef USE_ESC_SENSOR_TELEMETRY
 #endif
 
+#ifndef USE_TASK_STATISTICS
+#undef USE_TASK_HISTOGRAMS
+#endif
+
+// LZ literals are written with the Huffman table, and its state borrows the blackbox snapshot ring
+#if !defined(USE_HUFFMAN) || !defined(USE_BLACKBOX)
+#undef USE_LZ
+#endif
+
 // XXX Followup implicit dependencies among DASHBOARD, display_xxx and USE_I2C.
 // XXX This should eventually be cleaned up.
 #ifndef USE_I2C
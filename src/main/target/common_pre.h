@@ -60,6 +60,9 @@
 #define USE_DYN_IDLE
 #define I2C3_OVERCLOCK true
 #define USE_GYRO_DATA_ANALYSE
+#if defined(STM32F40_41xxx)
+#define USE_GYRO_FILTER_VARIANTS
+#endif
 #define USE_ADC
 #define USE_ADC_INTERNAL
 #define USE_USB_CDC_HID
@@ -117,6 +120,7 @@
 #define I2C3_OVERCLOCK true
 #define I2C4_OVERCLOCK true
 #define USE_GYRO_DATA_ANALYSE
+#define USE_GYRO_FILTER_VARIANTS
 #define USE_ADC_INTERNAL
 #define USE_USB_CDC_HID
 #define USE_DMA_SPEC
@@ -230,6 +234,7 @@
 #endif
 
 #if (TARGET_FLASH_SIZE > 128)
+#define USE_CRC_BYTE_TABLES     // 256 entry CRC tables, 16 entry nibble tables are used otherwise
 #define USE_GYRO_OVERFLOW_CHECK
 #define USE_YAW_SPIN_RECOVERY
 #define USE_DSHOT_DMAR
@@ -288,6 +293,7 @@
 
 #if ((TARGET_FLASH_SIZE > 256) || (FEATURE_CUT_LEVEL < 4))
 #define USE_HUFFMAN
+#define USE_LZ
 #define USE_PINIO
 #define USE_PINIOBOX
 #endif
@@ -358,6 +364,9 @@
 #define USE_OSD_STICK_OVERLAY
 #define USE_ESCSERIAL_SIMONK
 #define USE_SERIAL_4WAY_SK_BOOTLOADER
+#define USE_TASK_HISTOGRAMS
+#define USE_MSP_COMMAND_STATISTICS
+#define USE_MSP_SUBSCRIPTIONS
 #define USE_CMS_FAILSAFE_MENU
 #define USE_CMS_GPS_RESCUE_MENU
 #define USE_TELEMETRY_SENSORS_DISABLED_DETAILS
@@ -0,0 +1,100 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "benchmark.h"
+
+#define CLOCK_CALIBRATION_SAMPLES 10000
+
+static uint64_t clockOverheadNs;
+static uint32_t iterationsOverride;
+
+uint64_t benchmarkNowNs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+// usage: <benchmark> [-n iterations]
+void benchmarkInit(int argc, char **argv)
+{
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-n") && i + 1 < argc) {
+            iterationsOverride = strtoul(argv[++i], NULL, 0);
+        }
+    }
+
+    // use the minimum, anything above that is scheduling noise
+    clockOverheadNs = UINT64_MAX;
+    for (int i = 0; i < CLOCK_CALIBRATION_SAMPLES; i++) {
+        const uint64_t start = benchmarkNowNs();
+        const uint64_t elapsed = benchmarkNowNs() - start;
+        if (elapsed < clockOverheadNs) {
+            clockOverheadNs = elapsed;
+        }
+    }
+}
+
+uint32_t benchmarkIterations(uint32_t defaultIterations)
+{
+    return iterationsOverride ? iterationsOverride : defaultIterations;
+}
+
+void benchmarkTimerReset(benchmarkTimer_t *timer)
+{
+    memset(timer, 0, sizeof(*timer));
+}
+
+void benchmarkTimerStart(benchmarkTimer_t *timer)
+{
+    timer->startNs = benchmarkNowNs();
+}
+
+void benchmarkTimerStop(benchmarkTimer_t *timer)
+{
+    uint64_t elapsed = benchmarkNowNs() - timer->startNs;
+    elapsed = elapsed > clockOverheadNs ? elapsed - clockOverheadNs : 0;
+    timer->totalNs += elapsed;
+    if (elapsed > timer->maxNs) {
+        timer->maxNs = elapsed;
+    }
+    timer->count++;
+}
+
+void benchmarkReport(const char *benchmark, const char *config, const char *name, const benchmarkTimer_t *timer)
+{
+    const double nsPerIteration = timer->count ? (double)timer->totalNs / timer->count : 0.0;
+    printf("{\"benchmark\":\"%s\",\"config\":\"%s\",\"name\":\"%s\",\"iterations\":%u,\"ns_per_iter\":%.2f,\"max_ns\":%llu}\n",
+        benchmark, config, name, timer->count, nsPerIteration, (unsigned long long)timer->maxNs);
+    fflush(stdout);
+}
+
+void benchmarkReportValue(const char *benchmark, const char *config, const char *name, const char *unit, double value)
+{
+    printf("{\"benchmark\":\"%s\",\"config\":\"%s\",\"name\":\"%s\",\"%s\":%.4f}\n",
+        benchmark, config, name, unit, value);
+    fflush(stdout);
+}
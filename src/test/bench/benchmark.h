@@ -0,0 +1,46 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+// Accumulates the time spent in one section of code over many iterations.
+// The cost of reading the clock is measured once by benchmarkInit() and
+// subtracted from every sample.
+typedef struct benchmarkTimer_s {
+    uint64_t startNs;
+    uint64_t totalNs;
+    uint64_t maxNs;
+    uint32_t count;
+} benchmarkTimer_t;
+
+void benchmarkInit(int argc, char **argv);
+uint32_t benchmarkIterations(uint32_t defaultIterations);
+uint64_t benchmarkNowNs(void);
+
+void benchmarkTimerReset(benchmarkTimer_t *timer);
+void benchmarkTimerStart(benchmarkTimer_t *timer);
+void benchmarkTimerStop(benchmarkTimer_t *timer);
+
+// Results are written to stdout, one JSON object per line, e.g.
+// {"benchmark":"gyro_loop","config":"8k_rpm3","name":"gyroFiltering","iterations":80000,"ns_per_iter":101.3,"max_ns":730}
+void benchmarkReport(const char *benchmark, const char *config, const char *name, const benchmarkTimer_t *timer);
+void benchmarkReportValue(const char *benchmark, const char *config, const char *name, const char *unit, double value);
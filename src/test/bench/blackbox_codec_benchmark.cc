@@ -0,0 +1,552 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Logs a synthetic 8kHz flight to a serial port that captures everything written, then decodes the log again with
+// the host decoder. The flight loop side blackboxCapture() runs every iteration and the blackbox task side
+// blackboxUpdate() at 1kHz, and they are timed separately. Reports bytes per frame and throughput in both directions
+// for each P-frame encoding, and how many decoded values differ from what was logged (which should always be none).
+// The log is then compressed the way MSP dataflash reads send it, to compare the Huffman and LZ methods. Logs given
+// on the command line (e.g. .BFL files downloaded from a flight controller) are compressed the same way.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <math.h>
+
+#include <vector>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "build/debug.h"
+    #include "build/version.h"
+
+    #include "blackbox/blackbox.h"
+    #include "common/huffman.h"
+    #include "common/lz.h"
+    #include "common/utils.h"
+    #include "config/config.h"
+    #include "config/feature.h"
+
+    #include "pg/pg.h"
+    #include "pg/pg_ids.h"
+    #include "pg/rx.h"
+    #include "pg/motor.h"
+
+    #include "drivers/accgyro/accgyro.h"
+    #include "drivers/accgyro/gyro_sync.h"
+    #include "drivers/serial.h"
+
+    #include "fc/controlrate_profile.h"
+    #include "fc/rc_controls.h"
+    #include "fc/rc_modes.h"
+    #include "fc/runtime_config.h"
+
+    #include "flight/failsafe.h"
+    #include "flight/mixer.h"
+    #include "flight/pid.h"
+    #include "flight/servos.h"
+
+    #include "io/gps.h"
+    #include "io/serial.h"
+
+    #include "rx/rx.h"
+
+    #include "sensors/acceleration.h"
+    #include "sensors/barometer.h"
+    #include "sensors/battery.h"
+    #include "sensors/compass.h"
+    #include "sensors/current.h"
+    #include "sensors/gyro.h"
+    #include "sensors/voltage.h"
+    #include "sensors/sensors.h"
+
+    #include "blackbox_decoder.h"
+    #include "lz_decoder.h"
+    #include "benchmark.h"
+
+    extern pidProfile_t *currentPidProfile;
+}
+
+#define BENCHMARK_NAME          "blackbox_codec"
+#define DEFAULT_ITERATIONS      80000   // 10s of flight at 8kHz
+#define WARMUP_ITERATIONS       8000    // long enough for the header to be sent
+#define PID_LOOPTIME_US         125
+#define TASK_INTERVAL           8       // PID loop iterations per blackbox task run
+#define MOTOR_COUNT             4
+#define DATAFLASH_REPLY_SIZE    4096    // MSP_PORT_DATAFLASH_BUFFER_SIZE
+
+static std::vector<uint8_t> logData;
+static timeUs_t simulatedTimeUs;
+static uint32_t noiseState;
+static float setpoint[XYZ_AXIS_COUNT];
+static float throttle;
+static serialPort_t blackboxSerialPort;
+static serialPortConfig_t blackboxSerialPortConfig;
+static pidProfile_t pidProfile;
+
+// Deterministic noise in the range -amplitude...amplitude
+static int noise(int amplitude)
+{
+    noiseState = noiseState * 1664525 + 1013904223;
+    return (int)((noiseState >> 16) % (2 * amplitude + 1)) - amplitude;
+}
+
+static float wave(uint32_t iteration, float hz, float phase)
+{
+    return sinf(2 * M_PIf * hz * iteration * (PID_LOOPTIME_US * 1e-6f) + phase);
+}
+
+// The flight controller state logged at the given iteration. Values are whole numbers so they survive logging exactly.
+typedef struct syntheticState_s {
+    int32_t gyro[XYZ_AXIS_COUNT];
+    int32_t acc[XYZ_AXIS_COUNT];
+    int32_t pid[4][XYZ_AXIS_COUNT];
+    int32_t rc[4];
+    int32_t motor[MOTOR_COUNT];
+    int32_t erpm[MOTOR_COUNT];
+    int32_t debug[DEBUG16_VALUE_COUNT];
+} syntheticState_t;
+
+static std::vector<syntheticState_t> states;
+
+static void makeState(uint32_t iteration, syntheticState_t *state)
+{
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        // Stick movements at a few Hz with motor noise at 180Hz on top
+        const float stick = 200 * wave(iteration, 0.7f + axis * 0.3f, axis);
+        state->gyro[axis] = lrintf(stick + 25 * wave(iteration, 180, axis) + noise(3));
+        state->acc[axis] = lrintf(50 * wave(iteration, 2, axis) + noise(8)) + (axis == 2 ? 2048 : 0);
+        state->pid[0][axis] = lrintf(0.3f * (stick - state->gyro[axis]));
+        state->pid[1][axis] = lrintf(20 * wave(iteration, 0.2f, axis));
+        state->pid[2][axis] = lrintf(8 * wave(iteration, 180, axis + 1.5f) + noise(2));
+        state->pid[3][axis] = lrintf(40 * wave(iteration, 0.7f + axis * 0.3f, axis + 0.5f));
+        state->rc[axis] = lrintf(stick / 2);
+        state->debug[axis] = state->gyro[axis] + noise(4);
+    }
+    state->rc[THROTTLE] = 1300 + lrintf(150 * wave(iteration, 0.5f, 0));
+    state->debug[3] = noise(100);
+
+    for (int i = 0; i < MOTOR_COUNT; i++) {
+        const int sign = (i & 1) ? -1 : 1;
+        state->motor[i] = state->rc[THROTTLE] + sign * (state->pid[0][0] + state->pid[2][0]) / 2 + noise(2);
+        // eRPM / 100 follows the motor output
+        state->erpm[i] = (state->motor[i] - 1000) * 2 + noise(1);
+    }
+}
+
+static void applyState(uint32_t iteration, const syntheticState_t *state)
+{
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        gyro.gyroADCf[axis] = state->gyro[axis];
+        acc.accADC[axis] = state->acc[axis];
+        pidData[axis].P = state->pid[0][axis];
+        pidData[axis].I = state->pid[1][axis];
+        pidData[axis].D = state->pid[2][axis];
+        pidData[axis].F = state->pid[3][axis];
+        setpoint[axis] = state->rc[axis] * 3;
+    }
+    for (int i = 0; i < 4; i++) {
+        rcCommand[i] = state->rc[i];
+    }
+    for (int i = 0; i < MOTOR_COUNT; i++) {
+        motor[i] = state->motor[i];
+    }
+    for (int i = 0; i < DEBUG16_VALUE_COUNT; i++) {
+        debug[i] = state->debug[i];
+    }
+    throttle = (state->rc[THROTTLE] - 1000) / 1000.0f;
+    simulatedTimeUs = iteration * PID_LOOPTIME_US;
+}
+
+static int checkField(const blackboxDecoderFieldDefs_t *defs, const int32_t *values, const char *name, int32_t expected)
+{
+    const int index = blackboxDecoderFieldIndex(defs, name);
+    return (index < 0 || values[index] != expected) ? 1 : 0;
+}
+
+// Count the values in a decoded main frame that differ from the synthetic state at the frame's timestamp
+static int countMismatches(const blackboxDecoder_t *decoder)
+{
+    static const char * const pidNames[] = { "axisP", "axisI", "axisD", "axisF" };
+    const int32_t *values = decoder->mainHistory[0];
+    const blackboxDecoderFieldDefs_t *defs = &decoder->mainI;
+
+    const uint32_t iteration = (uint32_t)values[decoder->timeIndex] / PID_LOOPTIME_US;
+    if (iteration >= states.size()) {
+        return 1;
+    }
+    const syntheticState_t *state = &states[iteration];
+
+    int mismatches = 0;
+    char name[BLACKBOX_DECODER_MAX_NAME_LENGTH];
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        for (int term = 0; term < 4; term++) {
+            snprintf(name, sizeof(name), "%s[%d]", pidNames[term], axis);
+            mismatches += checkField(defs, values, name, state->pid[term][axis]);
+        }
+        snprintf(name, sizeof(name), "gyroADC[%d]", axis);
+        mismatches += checkField(defs, values, name, state->gyro[axis]);
+        snprintf(name, sizeof(name), "accSmooth[%d]", axis);
+        mismatches += checkField(defs, values, name, state->acc[axis]);
+    }
+    for (int i = 0; i < 4; i++) {
+        snprintf(name, sizeof(name), "rcCommand[%d]", i);
+        mismatches += checkField(defs, values, name, state->rc[i]);
+    }
+    for (int i = 0; i < DEBUG16_VALUE_COUNT; i++) {
+        snprintf(name, sizeof(name), "debug[%d]", i);
+        mismatches += checkField(defs, values, name, state->debug[i]);
+    }
+    for (int i = 0; i < MOTOR_COUNT; i++) {
+        snprintf(name, sizeof(name), "motor[%d]", i);
+        mismatches += checkField(defs, values, name, state->motor[i]);
+        snprintf(name, sizeof(name), "eRPM(/100)[%d]", i);
+        mismatches += checkField(defs, values, name, state->erpm[i]);
+    }
+
+    return mismatches;
+}
+
+// Compresses the log in reply sized pieces as serializeDataflashReadReply() does, returns the total compressed size
+static size_t huffmanCompressLog(void)
+{
+    static uint8_t outBuf[DATAFLASH_REPLY_SIZE + 1];
+    size_t compressedBytes = 0;
+    size_t address = 0;
+
+    while (address < logData.size()) {
+        huffmanState_t state = {
+            .bytesWritten = 0,
+            .outByte = outBuf,
+            .outBufLen = DATAFLASH_REPLY_SIZE,
+            .outBit = 0x80,
+        };
+        *state.outByte = 0;
+
+        size_t bytesReadTotal = 0;
+        while (state.bytesWritten < state.outBufLen && address + bytesReadTotal < logData.size()) {
+            const int bytesRead = MIN(256, logData.size() - address - bytesReadTotal);
+            if (huffmanEncodeBufStreaming(&state, &logData[address + bytesReadTotal], bytesRead, huffmanTable) == -1) {
+                break;
+            }
+            bytesReadTotal += bytesRead;
+        }
+        if (state.outBit != 0x80) {
+            ++state.bytesWritten;
+        }
+
+        compressedBytes += HUFFMAN_INFO_SIZE + state.bytesWritten;
+        address += bytesReadTotal;
+    }
+    return compressedBytes;
+}
+
+static size_t lzCompressLog(int *mismatchedReplies)
+{
+    static lzState_t state;
+    static uint8_t outBuf[DATAFLASH_REPLY_SIZE];
+    static uint8_t decodeBuf[UINT16_MAX];
+    size_t compressedBytes = 0;
+    size_t address = 0;
+
+    if (mismatchedReplies) {
+        *mismatchedReplies = 0;
+    }
+    while (address < logData.size()) {
+        const int bytesRead = lzEncodeBuf(&state, outBuf, sizeof(outBuf), &logData[address], MIN(UINT16_MAX, logData.size() - address));
+
+        if (mismatchedReplies) {
+            const int decoded = lzDecodeBuf(decodeBuf, bytesRead, outBuf, state.bytesWritten);
+            if (decoded != bytesRead || memcmp(decodeBuf, &logData[address], bytesRead)) {
+                ++*mismatchedReplies;
+            }
+        }
+
+        compressedBytes += LZ_INFO_SIZE + state.bytesWritten;
+        address += bytesRead;
+    }
+    return compressedBytes;
+}
+
+static void runCompression(const char *configName)
+{
+    uint64_t startNs = benchmarkNowNs();
+    const size_t huffmanBytes = huffmanCompressLog();
+    const uint64_t huffmanNs = benchmarkNowNs() - startNs;
+
+    int mismatchedReplies;
+    startNs = benchmarkNowNs();
+    const size_t lzBytes = lzCompressLog(NULL);
+    const uint64_t lzNs = benchmarkNowNs() - startNs;
+    // decode on a second pass so it isn't part of the compression time
+    lzCompressLog(&mismatchedReplies);
+
+    benchmarkReportValue(BENCHMARK_NAME, configName, "huffmanRatio", "x", (double)logData.size() / huffmanBytes);
+    benchmarkReportValue(BENCHMARK_NAME, configName, "huffmanThroughput", "MB/s", logData.size() / (huffmanNs * 1e-9) / 1e6);
+    benchmarkReportValue(BENCHMARK_NAME, configName, "lzRatio", "x", (double)logData.size() / lzBytes);
+    benchmarkReportValue(BENCHMARK_NAME, configName, "lzThroughput", "MB/s", logData.size() / (lzNs * 1e-9) / 1e6);
+    benchmarkReportValue(BENCHMARK_NAME, configName, "lzMismatchedReplies", "replies", mismatchedReplies);
+}
+
+static void runConfig(BlackboxEncoding encoding, uint32_t iterations)
+{
+    const char *configName = encoding == BLACKBOX_ENCODING_HIGH_DENSITY ? "high_density" : "standard";
+
+    blackboxConfigMutable()->device = BLACKBOX_DEVICE_SERIAL;
+    blackboxConfigMutable()->encoding = encoding;
+    blackboxConfigMutable()->record_acc = 1;
+    // Log every PID loop iteration
+    blackboxConfigMutable()->p_ratio = 512;
+    targetPidLooptime = PID_LOOPTIME_US;
+
+    logData.clear();
+    logData.reserve(64 * (WARMUP_ITERATIONS + iterations));
+    noiseState = 1;
+    states.resize(WARMUP_ITERATIONS + iterations);
+    for (uint32_t i = 0; i < states.size(); i++) {
+        makeState(i, &states[i]);
+    }
+
+    blackboxInit();
+    ENABLE_ARMING_FLAG(ARMED);
+
+    benchmarkTimer_t captureTimer;
+    benchmarkTimer_t encodeTimer;
+    size_t encodeStart = 0;
+    for (uint32_t i = 0; i < WARMUP_ITERATIONS + iterations; i++) {
+        if (i == WARMUP_ITERATIONS) {
+            benchmarkTimerReset(&captureTimer);
+            benchmarkTimerReset(&encodeTimer);
+            encodeStart = logData.size();
+        }
+        applyState(i, &states[i]);
+        benchmarkTimerStart(&captureTimer);
+        blackboxCapture(simulatedTimeUs);
+        benchmarkTimerStop(&captureTimer);
+        if (i % TASK_INTERVAL == TASK_INTERVAL - 1) {
+            benchmarkTimerStart(&encodeTimer);
+            blackboxUpdate(simulatedTimeUs);
+            benchmarkTimerStop(&encodeTimer);
+        }
+    }
+    const size_t encodedBytes = logData.size() - encodeStart;
+    const uint32_t droppedFrames = blackboxGetDroppedFrameCount();
+
+    blackboxFinish();
+    blackboxUpdate(simulatedTimeUs); // writes the log end event
+    DISABLE_ARMING_FLAG(ARMED);
+
+    static blackboxDecoder_t decoder;
+    uint32_t mainFrames = 0;
+    uint32_t mismatches = 0;
+    bool decodeError = false;
+
+    const uint64_t decodeStartNs = benchmarkNowNs();
+    blackboxDecoderInit(&decoder, logData.data(), logData.size());
+    if (blackboxDecoderReadHeaders(&decoder)) {
+        int frameType;
+        while ((frameType = blackboxDecoderNextFrame(&decoder)) > 0) {
+            if (frameType == 'I' || frameType == 'P') {
+                mainFrames++;
+            }
+        }
+        decodeError = frameType < 0 || !decoder.logEnded;
+    } else {
+        decodeError = true;
+    }
+    const uint64_t decodeNs = benchmarkNowNs() - decodeStartNs;
+
+    // Check the values on a second pass so the comparison isn't part of the decode time
+    blackboxDecoderInit(&decoder, logData.data(), logData.size());
+    if (!decodeError && blackboxDecoderReadHeaders(&decoder)) {
+        int frameType;
+        while ((frameType = blackboxDecoderNextFrame(&decoder)) > 0) {
+            if (frameType == 'I' || frameType == 'P') {
+                mismatches += countMismatches(&decoder);
+            }
+        }
+    }
+
+    const double encodeSeconds = encodeTimer.totalNs * 1e-9;
+    benchmarkReport(BENCHMARK_NAME, configName, "capture", &captureTimer);
+    benchmarkReport(BENCHMARK_NAME, configName, "encode", &encodeTimer);
+    benchmarkReportValue(BENCHMARK_NAME, configName, "encodeThroughput", "MB/s", encodedBytes / encodeSeconds / 1e6);
+    benchmarkReportValue(BENCHMARK_NAME, configName, "decodeThroughput", "MB/s", logData.size() / (decodeNs * 1e-9) / 1e6);
+    benchmarkReportValue(BENCHMARK_NAME, configName, "bytesPerIFrame", "bytes",
+        decoder.frameCount['I'] ? (double)decoder.frameBytes['I'] / decoder.frameCount['I'] : 0);
+    benchmarkReportValue(BENCHMARK_NAME, configName, "bytesPerPFrame", "bytes",
+        decoder.frameCount['P'] ? (double)decoder.frameBytes['P'] / decoder.frameCount['P'] : 0);
+    benchmarkReportValue(BENCHMARK_NAME, configName, "mainFrames", "frames", mainFrames);
+    benchmarkReportValue(BENCHMARK_NAME, configName, "decodeErrors", "frames", decodeError ? 1 : 0);
+    benchmarkReportValue(BENCHMARK_NAME, configName, "mismatchedValues", "values", mismatches);
+    benchmarkReportValue(BENCHMARK_NAME, configName, "droppedFrames", "frames", droppedFrames);
+
+    runCompression(configName);
+}
+
+// Compresses a log file from a real flight, reported under its file name
+static void runLogFile(const char *filename)
+{
+    FILE *file = fopen(filename, "rb");
+    if (!file) {
+        fprintf(stderr, "can't open %s\n", filename);
+        return;
+    }
+    logData.clear();
+    uint8_t buffer[4096];
+    size_t bytesRead;
+    while ((bytesRead = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+        logData.insert(logData.end(), buffer, buffer + bytesRead);
+    }
+    fclose(file);
+
+    // the SITL file device grows its files ahead of the log, drop what an interrupted run left unwritten
+    while (!logData.empty() && logData.back() == 0) {
+        logData.pop_back();
+    }
+    if (logData.empty()) {
+        return;
+    }
+
+    const char *name = strrchr(filename, '/');
+    runCompression(name ? name + 1 : filename);
+}
+
+// usage: blackbox_codec_benchmark [-n iterations] [log files...]
+int main(int argc, char **argv)
+{
+    benchmarkInit(argc, argv);
+    const uint32_t iterations = benchmarkIterations(DEFAULT_ITERATIONS);
+
+    currentPidProfile = &pidProfile;
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        pidProfile.pid[axis].D = 30;
+    }
+    motorConfigMutable()->minthrottle = 1070;
+    motorConfigMutable()->dev.useDshotTelemetry = true;
+    debugMode = DEBUG_GYRO_SCALED;
+    blackboxSerialPortConfig.blackbox_baudrateIndex = BAUD_2000000;
+
+    runConfig(BLACKBOX_ENCODING_STANDARD, iterations);
+    runConfig(BLACKBOX_ENCODING_HIGH_DENSITY, iterations);
+
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-n")) {
+            i++;
+        } else {
+            runLogFile(argv[i]);
+        }
+    }
+
+    return 0;
+}
+
+// STUBS
+
+extern "C" {
+
+PG_REGISTER(flight3DConfig_t, flight3DConfig, PG_MOTOR_3D_CONFIG, 0);
+PG_REGISTER(mixerConfig_t, mixerConfig, PG_MIXER_CONFIG, 0);
+PG_REGISTER(motorConfig_t, motorConfig, PG_MOTOR_CONFIG, 0);
+PG_REGISTER(batteryConfig_t, batteryConfig, PG_BATTERY_CONFIG, 0);
+PG_REGISTER(rxConfig_t, rxConfig, PG_RX_CONFIG, 0);
+PG_REGISTER_ARRAY(modeActivationCondition_t, MAX_MODE_ACTIVATION_CONDITION_COUNT, modeActivationConditions, PG_MODE_ACTIVATION_PROFILE, 0);
+
+// for the header lines
+PG_REGISTER(systemConfig_t, systemConfig, PG_SYSTEM_CONFIG, 0);
+PG_REGISTER(pilotConfig_t, pilotConfig, PG_PILOT_CONFIG, 0);
+PG_REGISTER(featureConfig_t, featureConfig, PG_FEATURE_CONFIG, 0);
+PG_REGISTER(gyroConfig_t, gyroConfig, PG_GYRO_CONFIG, 0);
+PG_REGISTER(accelerometerConfig_t, accelerometerConfig, PG_ACCELEROMETER_CONFIG, 0);
+PG_REGISTER(barometerConfig_t, barometerConfig, PG_BAROMETER_CONFIG, 0);
+PG_REGISTER(compassConfig_t, compassConfig, PG_COMPASS_CONFIG, 0);
+PG_REGISTER(armingConfig_t, armingConfig, PG_ARMING_CONFIG, 0);
+PG_REGISTER(rcControlsConfig_t, rcControlsConfig, PG_RC_CONTROLS_CONFIG, 0);
+PG_REGISTER(currentSensorADCConfig_t, currentSensorADCConfig, PG_CURRENT_SENSOR_ADC_CONFIG, 0);
+PG_REGISTER_ARRAY(voltageSensorADCConfig_t, MAX_VOLTAGE_SENSOR_ADC, voltageSensorADCConfig, PG_VOLTAGE_SENSOR_ADC_CONFIG, 0);
+PG_REGISTER_ARRAY(controlRateConfig_t, CONTROL_RATE_PROFILE_COUNT, controlRateProfiles, PG_CONTROL_RATE_PROFILES, 0);
+
+const char* const targetName = "TEST";
+const char* const shortGitRevision = "0000000";
+const char* const buildDate = "Jan 01 2020";
+const char* const buildTime = "00:00:00";
+uint8_t activePidLoopDenom = 1;
+
+uint8_t armingFlags;
+uint8_t stateFlags;
+const uint32_t baudRates[] = {0, 9600, 19200, 38400, 57600, 115200, 230400, 250000,
+        400000, 460800, 500000, 921600, 1000000, 1500000, 2000000, 2470000}; // see baudRate_e
+uint8_t debugMode;
+int16_t debug[DEBUG16_VALUE_COUNT];
+int32_t blackboxHeaderBudget;
+gpsSolutionData_t gpsSol;
+int32_t GPS_home[2];
+
+gyro_t gyro;
+acc_t acc;
+mag_t mag;
+baro_t baro;
+pidAxisData_t pidData[3];
+float rcCommand[4];
+float motor[MAX_SUPPORTED_MOTORS];
+int16_t servo[MAX_SUPPORTED_SERVOS];
+
+float motorOutputHigh = 2000, motorOutputLow = 1000;
+float motor_disarmed[MAX_SUPPORTED_MOTORS];
+pidProfile_t *currentPidProfile;
+uint32_t targetPidLooptime;
+
+boxBitmask_t rcModeActivationMask;
+
+void mspSerialAllocatePorts(void) {}
+uint32_t getArmingBeepTimeMicros(void) {return 0;}
+uint16_t getBatteryVoltageLatest(void) {return 0;}
+int32_t getAmperageLatest(void) {return 0;}
+uint16_t getRssi(void) {return 0;}
+float pidGetPreviousSetpoint(int axis) {return setpoint[axis];}
+float mixerGetThrottle(void) {return throttle;}
+uint8_t getMotorCount(void) {return MOTOR_COUNT;}
+uint16_t getDshotTelemetry(uint8_t index) {return states[simulatedTimeUs / PID_LOOPTIME_US].erpm[index];}
+bool areMotorsRunning(void) { return true; }
+bool IS_RC_MODE_ACTIVE(boxId_e) {return false;}
+bool isModeActivationConditionPresent(boxId_e) {return false;}
+uint32_t millis(void) {return simulatedTimeUs / 1000;}
+bool sensors(uint32_t mask) {return mask == SENSOR_ACC;}
+void serialWrite(serialPort_t *, uint8_t ch) { logData.push_back(ch); }
+void serialWriteBuf(serialPort_t *, const uint8_t *data, int count)
+{
+    logData.insert(logData.end(), data, data + count);
+}
+uint32_t serialTxBytesFree(const serialPort_t *) {return 1 << 20;}
+bool isSerialTransmitBufferEmpty(const serialPort_t *) {return true;}
+bool featureIsEnabled(uint32_t) {return false;}
+void mspSerialReleasePortIfAllocated(serialPort_t *) {}
+const serialPortConfig_t *findSerialPortConfig(serialPortFunction_e ) {return &blackboxSerialPortConfig;}
+serialPort_t *findSharedSerialPort(uint16_t , serialPortFunction_e ) {return NULL;}
+serialPort_t *openSerialPort(serialPortIdentifier_e, serialPortFunction_e, serialReceiveCallbackPtr, void *, uint32_t, portMode_e, portOptions_e) {return &blackboxSerialPort;}
+void closeSerialPort(serialPort_t *) {}
+portSharing_e determinePortSharing(const serialPortConfig_t *, serialPortFunction_e ) {return PORTSHARING_UNUSED;}
+failsafePhase_e failsafePhase(void) {return FAILSAFE_IDLE;}
+bool rxAreFlightChannelsValid(void) {return true;}
+bool rxIsReceivingSignal(void) {return true;}
+bool isRssiConfigured(void) {return false;}
+
+}
@@ -0,0 +1,110 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Times looking up the setting names of a 500 line batch of "set" commands in the full settings table, the way a
+// configurator applies a saved configuration, with the linear scan the CLI used to do and with the name index.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <vector>
+#include <string>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "build/debug.h"
+
+    #include "cli/settings.h"
+    #include "cli/settings_index.h"
+
+    #include "sensors/current.h"
+    #include "sensors/voltage.h"
+
+    #include "benchmark.h"
+
+    const char * const currentMeterSourceNames[CURRENT_METER_COUNT] = { "NONE" };
+    const char * const debugModeNames[DEBUG_COUNT] = { "NONE" };
+    const char * const voltageMeterSourceNames[VOLTAGE_METER_COUNT] = { "NONE" };
+}
+
+#define BENCHMARK_NAME          "cli_settings"
+#define DEFAULT_ITERATIONS      200
+#define BATCH_LINES             500
+
+static std::vector<std::string> batch;
+
+// The lookup cliGetSettingIndex() used before the index
+static uint16_t linearFind(const char *name, uint8_t length)
+{
+    for (uint32_t i = 0; i < valueTableEntryCount; i++) {
+        const char *settingName = valueTable[i].name;
+
+        if (strncasecmp(name, settingName, strlen(settingName)) == 0 && length == strlen(settingName)) {
+            return i;
+        }
+    }
+    return valueTableEntryCount;
+}
+
+static uint32_t runBatch(const char *configName, uint16_t (*find)(const char *name, uint8_t length), uint32_t iterations)
+{
+    benchmarkTimer_t timer;
+    benchmarkTimerReset(&timer);
+    uint32_t checksum = 0;
+
+    for (uint32_t iteration = 0; iteration < iterations; iteration++) {
+        benchmarkTimerStart(&timer);
+        for (const std::string &line : batch) {
+            const char *eqptr = strchr(line.c_str(), '=');
+            uint8_t length = eqptr - line.c_str();
+            while (line[length - 1] == ' ') {
+                length--;
+            }
+            checksum += find(line.c_str(), length);
+        }
+        benchmarkTimerStop(&timer);
+    }
+
+    benchmarkReport(BENCHMARK_NAME, configName, "batchApply", &timer);
+    return checksum;
+}
+
+int main(int argc, char **argv)
+{
+    benchmarkInit(argc, argv);
+    const uint32_t iterations = benchmarkIterations(DEFAULT_ITERATIONS);
+
+    // spread the batch over the whole table, the way a full configuration touches every part of it
+    for (uint32_t i = 0; i < BATCH_LINES; i++) {
+        const uint16_t index = (i * 7919) % valueTableEntryCount;
+        batch.push_back(std::string(valueTable[index].name) + " = 1");
+    }
+
+    const uint32_t linearChecksum = runBatch("linear", linearFind, iterations);
+    const uint32_t indexedChecksum = runBatch("indexed", settingsIndexFind, iterations);
+
+    benchmarkReportValue(BENCHMARK_NAME, "indexed", "settings", "entries", valueTableEntryCount);
+    benchmarkReportValue(BENCHMARK_NAME, "indexed", "mismatchedLookups", "batches", linearChecksum != indexedChecksum);
+
+    return 0;
+}
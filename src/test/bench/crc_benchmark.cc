@@ -0,0 +1,168 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+// Compares the table driven CRCs with the bit at a time versions they replaced, on a CRSF frame and an MSP v2
+// frame (CRC8/DVB-S2) and a config sized block (CRC16/CCITT). Each is run byte by byte, as the serial drivers
+// used to, and in bulk with the _update functions. Reports the time per frame, the throughput and the number
+// of frames where the table driven result differs from the bitwise one.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "common/crc.h"
+    #include "common/maths.h"
+    #include "common/utils.h"
+
+    #include "benchmark.h"
+}
+
+#define BENCHMARK_NAME          "crc"
+#define DEFAULT_ITERATIONS      20000
+#define MAX_FRAME_SIZE          4096
+
+typedef enum {
+    CRC_TYPE_CRC8_DVB_S2,
+    CRC_TYPE_CRC16_CCITT,
+} crcType_e;
+
+typedef struct benchConfig_s {
+    const char *name;
+    crcType_e type;
+    uint32_t length;
+} benchConfig_t;
+
+static uint8_t frame[MAX_FRAME_SIZE];
+static volatile uint32_t sink;
+
+static uint16_t bitwiseCrc16Ccitt(uint16_t crc, uint8_t a)
+{
+    crc ^= (uint16_t)a << 8;
+    for (int i = 0; i < 8; i++) {
+        crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+    }
+    return crc;
+}
+
+static uint8_t bitwiseCrc8DvbS2(uint8_t crc, uint8_t a)
+{
+    crc ^= a;
+    for (int i = 0; i < 8; i++) {
+        crc = (crc & 0x80) ? (crc << 1) ^ 0xD5 : crc << 1;
+    }
+    return crc;
+}
+
+static uint32_t bitwiseCrc(crcType_e type, const uint8_t *data, uint32_t length)
+{
+    uint32_t crc = 0;
+    for (uint32_t i = 0; i < length; i++) {
+        crc = type == CRC_TYPE_CRC8_DVB_S2 ? bitwiseCrc8DvbS2(crc, data[i]) : bitwiseCrc16Ccitt(crc, data[i]);
+    }
+    return crc;
+}
+
+static uint32_t bytewiseCrc(crcType_e type, const uint8_t *data, uint32_t length)
+{
+    uint32_t crc = 0;
+    for (uint32_t i = 0; i < length; i++) {
+        crc = type == CRC_TYPE_CRC8_DVB_S2 ? crc8_dvb_s2(crc, data[i]) : crc16_ccitt(crc, data[i]);
+    }
+    return crc;
+}
+
+static uint32_t bulkCrc(crcType_e type, const uint8_t *data, uint32_t length)
+{
+    return type == CRC_TYPE_CRC8_DVB_S2 ? crc8_dvb_s2_update(0, data, length) : crc16_ccitt_update(0, data, length);
+}
+
+static void runConfig(const benchConfig_t *config, uint32_t iterations)
+{
+    // fewer iterations for the bigger blocks, so each config takes about as long
+    iterations = MAX(iterations / (config->length / 64 + 1), 100U);
+
+    benchmarkTimer_t bitwiseTimer;
+    benchmarkTimer_t bytewiseTimer;
+    benchmarkTimer_t bulkTimer;
+    benchmarkTimerReset(&bitwiseTimer);
+    benchmarkTimerReset(&bytewiseTimer);
+    benchmarkTimerReset(&bulkTimer);
+
+    uint32_t state = 1;
+    uint32_t mismatches = 0;
+    for (uint32_t i = 0; i < iterations; i++) {
+        // a different frame each time, so nothing is predicted from the last one
+        for (uint32_t j = 0; j < config->length; j++) {
+            state = state * 1664525 + 1013904223;
+            frame[j] = state >> 24;
+        }
+
+        benchmarkTimerStart(&bitwiseTimer);
+        const uint32_t expected = bitwiseCrc(config->type, frame, config->length);
+        benchmarkTimerStop(&bitwiseTimer);
+
+        benchmarkTimerStart(&bytewiseTimer);
+        const uint32_t bytewise = bytewiseCrc(config->type, frame, config->length);
+        benchmarkTimerStop(&bytewiseTimer);
+
+        benchmarkTimerStart(&bulkTimer);
+        const uint32_t bulk = bulkCrc(config->type, frame, config->length);
+        benchmarkTimerStop(&bulkTimer);
+
+        mismatches += (bytewise != expected) + (bulk != expected);
+        sink = bulk;
+    }
+
+    benchmarkReport(BENCHMARK_NAME, config->name, "bitwise", &bitwiseTimer);
+    benchmarkReport(BENCHMARK_NAME, config->name, "bytewise", &bytewiseTimer);
+    benchmarkReport(BENCHMARK_NAME, config->name, "bulk", &bulkTimer);
+
+    const benchmarkTimer_t *timers[] = { &bitwiseTimer, &bytewiseTimer, &bulkTimer };
+    const char *throughputNames[] = { "bitwiseThroughput", "bytewiseThroughput", "bulkThroughput" };
+    for (unsigned i = 0; i < ARRAYLEN(timers); i++) {
+        // bytes per ns is GB/s, in MB/s
+        const double mbPerS = timers[i]->totalNs ? 1000.0 * config->length * timers[i]->count / timers[i]->totalNs : 0;
+        benchmarkReportValue(BENCHMARK_NAME, config->name, throughputNames[i], "MB/s", mbPerS);
+    }
+    benchmarkReportValue(BENCHMARK_NAME, config->name, "mismatches", "count", mismatches);
+}
+
+int main(int argc, char **argv)
+{
+    benchmarkInit(argc, argv);
+    const uint32_t iterations = benchmarkIterations(DEFAULT_ITERATIONS);
+
+    static const benchConfig_t configs[] = {
+        // type and payload of an RC channels frame
+        { "crsf_rc", CRC_TYPE_CRC8_DVB_S2, 23 },
+        // flag, command, size and a 58 byte payload
+        { "msp_v2", CRC_TYPE_CRC8_DVB_S2, 63 },
+        { "config", CRC_TYPE_CRC16_CCITT, MAX_FRAME_SIZE },
+    };
+    for (unsigned i = 0; i < ARRAYLEN(configs); i++) {
+        runConfig(&configs[i], iterations);
+    }
+
+    return 0;
+}
@@ -0,0 +1,226 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+// Compares the two dynamic notch estimators, the FFT computed in steps and the sliding DFT, on synthetic gyro
+// data with a motor noise tone that sweeps up and down, with 1, 3 and 5 dynamic notches per axis. Reports the time
+// spent in gyroDataAnalyse() per gyro loop, how far the nearest notch centre frequency lags the sweeping tone, and how
+// long it takes to settle after a step.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#include <cmath>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "build/debug.h"
+
+    #include "common/axis.h"
+    #include "common/filter.h"
+    #include "common/maths.h"
+    #include "common/utils.h"
+
+    #include "flight/gyroanalyse.h"
+
+    #include "pg/pg.h"
+    #include "pg/pg_ids.h"
+
+    #include "sensors/gyro.h"
+
+    #include "benchmark.h"
+
+    PG_REGISTER(gyroConfig_t, gyroConfig, PG_GYRO_CONFIG, 0);
+
+    gyro_t gyro;
+    uint8_t debugMode;
+    int16_t debug[DEBUG16_VALUE_COUNT];
+}
+
+#define BENCHMARK_NAME          "dyn_notch"
+#define DEFAULT_ITERATIONS      80000
+#define SWEEP_MIN_HZ            150.0f
+#define SWEEP_MAX_HZ            550.0f
+#define SWEEP_HZ                2.0f    // up and down twice a second, 1600Hz/s
+#define STEP_FROM_HZ            200.0f
+#define STEP_TO_HZ              400.0f
+
+typedef struct benchConfig_s {
+    uint32_t looptimeUs;
+    dynNotchEstimator_e estimator;
+    uint8_t notchCount;
+} benchConfig_t;
+
+static gyroAnalyseState_t state;
+static biquadFilterBank_t notchFilterDyn[DYN_NOTCH_COUNT_MAX];
+static biquadFilterBank_t notchFilterDyn2[DYN_NOTCH_COUNT_MAX];
+static uint32_t noiseState;
+static float tonePhase;
+
+// Deterministic noise in the range -amplitude...amplitude
+static float noise(float amplitude)
+{
+    noiseState = noiseState * 1664525 + 1013904223;
+    return amplitude * ((int32_t)(noiseState >> 8) / (float)(1 << 23) - 1.0f);
+}
+
+static void configure(const benchConfig_t *config)
+{
+    pgResetAll();
+    gyroConfigMutable()->dyn_notch_max_hz = 600;
+    gyroConfigMutable()->dyn_notch_width_percent = 8;
+    gyroConfigMutable()->dyn_notch_q = 120;
+    gyroConfigMutable()->dyn_notch_min_hz = 150;
+    gyroConfigMutable()->dyn_notch_estimator = config->estimator;
+    gyroConfigMutable()->dyn_notch_count = config->notchCount;
+
+    gyro.targetLooptime = config->looptimeUs;
+    for (int notch = 0; notch < DYN_NOTCH_COUNT_MAX; notch++) {
+        biquadFilterBankInit(&notchFilterDyn[notch], SWEEP_MIN_HZ, config->looptimeUs, 1.2f, FILTER_NOTCH);
+        biquadFilterBankInit(&notchFilterDyn2[notch], SWEEP_MIN_HZ, config->looptimeUs, 1.2f, FILTER_NOTCH);
+    }
+    gyroDataAnalyseStateInit(&state, config->looptimeUs);
+
+    noiseState = 12345;
+    tonePhase = 0;
+}
+
+// One gyro loop of stick movement, a motor noise tone and broadband noise
+static void pushSample(uint32_t looptimeUs, uint32_t iteration, float toneHz)
+{
+    const float t = iteration * looptimeUs * 1e-6f;
+    tonePhase += 2 * M_PIf * toneHz * looptimeUs * 1e-6f;
+    if (tonePhase > 2 * M_PIf) {
+        tonePhase -= 2 * M_PIf;
+    }
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        const float sticks = 200.0f * sinf(2 * M_PIf * (1.0f + axis) * t);
+        gyroDataAnalysePush(&state, axis, sticks + 40.0f * sinf(tonePhase + axis) + noise(10));
+    }
+}
+
+// Distance from toneHz to the nearest notch of the axis
+static float notchErrorHz(int axis, uint8_t notchCount, float toneHz)
+{
+    float errorHz = fabsf(state.centerFreq[axis][0] - toneHz);
+    for (int notch = 1; notch < notchCount; notch++) {
+        errorHz = fminf(errorHz, fabsf(state.centerFreq[axis][notch] - toneHz));
+    }
+    return errorHz;
+}
+
+static float sweepHz(uint32_t looptimeUs, uint32_t iteration)
+{
+    // triangle wave between SWEEP_MIN_HZ and SWEEP_MAX_HZ
+    const float cycle = fmodf(iteration * looptimeUs * 1e-6f * SWEEP_HZ, 1.0f);
+    const float triangle = cycle < 0.5f ? 2 * cycle : 2 - 2 * cycle;
+    return SWEEP_MIN_HZ + (SWEEP_MAX_HZ - SWEEP_MIN_HZ) * triangle;
+}
+
+static void runConfig(const benchConfig_t *config, uint32_t iterations)
+{
+    char configName[32];
+    snprintf(configName, sizeof(configName), "%uk_%s_x%u", (unsigned)(8 / (config->looptimeUs / 125)),
+        config->estimator == DYN_NOTCH_ESTIMATOR_SDFT ? "sdft" : "fft", config->notchCount);
+
+    const uint32_t loopRateHz = 1000000 / config->looptimeUs;
+
+    // sweeping tone, after a second to settle
+    configure(config);
+    benchmarkTimer_t timer;
+    float absErrorSum = 0;
+    uint32_t errorCount = 0;
+    for (uint32_t i = 0; i < loopRateHz + iterations; i++) {
+        if (i == loopRateHz) {
+            benchmarkTimerReset(&timer);
+        }
+        const float toneHz = sweepHz(config->looptimeUs, i);
+        pushSample(config->looptimeUs, i, toneHz);
+
+        benchmarkTimerStart(&timer);
+        gyroDataAnalyse(&state, notchFilterDyn, notchFilterDyn2);
+        benchmarkTimerStop(&timer);
+
+        if (i >= loopRateHz) {
+            for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+                absErrorSum += notchErrorHz(axis, config->notchCount, toneHz);
+                errorCount++;
+            }
+        }
+    }
+    const float meanErrorHz = absErrorSum / errorCount;
+    const float sweepRateHzPerS = 2 * (SWEEP_MAX_HZ - SWEEP_MIN_HZ) * SWEEP_HZ;
+
+    benchmarkReport(BENCHMARK_NAME, configName, "gyroDataAnalyse", &timer);
+    benchmarkReportValue(BENCHMARK_NAME, configName, "sweepError", "Hz", meanErrorHz);
+    // a tone sweeping at a constant rate is followed with a constant lag
+    benchmarkReportValue(BENCHMARK_NAME, configName, "sweepLag", "ms", 1000.0f * meanErrorHz / sweepRateHzPerS);
+
+    // step in the tone frequency, until every axis has a notch within 5% of the new tone
+    configure(config);
+    for (uint32_t i = 0; i < loopRateHz; i++) {
+        pushSample(config->looptimeUs, i, STEP_FROM_HZ);
+        gyroDataAnalyse(&state, notchFilterDyn, notchFilterDyn2);
+    }
+    uint32_t settleLoops = 0;
+    for (bool settled = false; !settled && settleLoops < loopRateHz; settleLoops++) {
+        pushSample(config->looptimeUs, loopRateHz + settleLoops, STEP_TO_HZ);
+        gyroDataAnalyse(&state, notchFilterDyn, notchFilterDyn2);
+        settled = true;
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            settled = settled && notchErrorHz(axis, config->notchCount, STEP_TO_HZ) < 0.05f * STEP_TO_HZ;
+        }
+    }
+    benchmarkReportValue(BENCHMARK_NAME, configName, "stepLatency", "ms", settleLoops * config->looptimeUs / 1000.0f);
+}
+
+int main(int argc, char **argv)
+{
+    benchmarkInit(argc, argv);
+    const uint32_t iterations = benchmarkIterations(DEFAULT_ITERATIONS);
+
+    static const uint32_t looptimes[] = { 125, 250 };
+    static const uint8_t notchCounts[] = { 1, 3, DYN_NOTCH_COUNT_MAX };
+    for (unsigned i = 0; i < ARRAYLEN(looptimes); i++) {
+        for (int estimator = DYN_NOTCH_ESTIMATOR_FFT; estimator <= DYN_NOTCH_ESTIMATOR_SDFT; estimator++) {
+            for (unsigned j = 0; j < ARRAYLEN(notchCounts); j++) {
+                const benchConfig_t config = {
+                    .looptimeUs = looptimes[i],
+                    .estimator = (dynNotchEstimator_e)estimator,
+                    .notchCount = notchCounts[j],
+                };
+                runConfig(&config, iterations);
+            }
+        }
+    }
+
+    return 0;
+}
+
+// STUBS
+
+extern "C" {
+
+uint32_t micros(void) { return 0; }
+uint8_t calculateThrottlePercentAbs(void) { return 50; }
+
+}
@@ -0,0 +1,329 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Times the real-time path gyroUpdate() -> gyroFiltering() -> pidController() -> mixTable()
+// driven by a fake gyro and fake DShot telemetry, with the stages scheduled in the same
+// order as taskGyroSample/taskFiltering/taskMainPidLoop.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#include <cmath>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "build/debug.h"
+
+    #include "common/axis.h"
+    #include "common/filter.h"
+    #include "common/maths.h"
+
+    #include "config/config.h"
+    #include "config/feature.h"
+
+    #include "drivers/accgyro/accgyro.h"
+    #include "drivers/dshot.h"
+    #include "drivers/dshot_command.h"
+    #include "drivers/motor.h"
+
+    #include "fc/controlrate_profile.h"
+    #include "fc/core.h"
+    #include "fc/rc.h"
+    #include "fc/rc_controls.h"
+    #include "fc/rc_modes.h"
+    #include "fc/runtime_config.h"
+
+    #include "io/beeper.h"
+
+    #include "flight/gps_rescue.h"
+    #include "flight/failsafe.h"
+    #include "flight/imu.h"
+    #include "flight/interpolated_setpoint.h"
+    #include "flight/mixer.h"
+    #include "flight/pid.h"
+    #include "flight/mixer_tricopter.h"
+    #include "flight/rpm_filter.h"
+
+    #include "pg/motor.h"
+    #include "pg/pg.h"
+    #include "pg/pg_ids.h"
+    #include "pg/rx.h"
+
+    #include "rx/rx.h"
+
+    #include "scheduler/scheduler.h"
+
+    #include "sensors/acceleration.h"
+    #include "sensors/battery.h"
+    #include "sensors/gyro.h"
+    #include "sensors/gyro_init.h"
+    #include "sensors/sensors.h"
+
+    #include "benchmark.h"
+
+    uint8_t debugMode;
+    int16_t debug[DEBUG16_VALUE_COUNT];
+}
+
+#define BENCHMARK_NAME          "gyro_loop"
+#define DEFAULT_ITERATIONS      100000
+#define WARMUP_ITERATIONS       2000
+#define SIGNAL_SAMPLE_COUNT     8000     // one second of gyro data at 8kHz
+#define MOTOR_POLE_COUNT        14
+
+typedef struct benchConfig_s {
+    uint8_t pidProcessDenom;
+    uint8_t rpmHarmonics;
+    bool dynamicNotch;
+    bool dualGyro;
+} benchConfig_t;
+
+static int16_t gyroSignal[SIGNAL_SAMPLE_COUNT][XYZ_AXIS_COUNT];
+static uint16_t motorErpm[SIGNAL_SAMPLE_COUNT];
+static unsigned signalIndex;
+static timeUs_t simulatedTimeUs;
+
+// Synthesise a gyro trace made of slow stick movement plus motor noise at the
+// fundamental and harmonics of the (equally synthetic) DShot telemetry eRPM.
+static void generateSignals(void)
+{
+    uint32_t seed = 12345;
+    float motorPhase = 0;
+    for (int i = 0; i < SIGNAL_SAMPLE_COUNT; i++) {
+        const float t = i / 8000.0f;
+        const float erpm = 180000.0f + 60000.0f * sinf(2 * M_PIf * 0.5f * t);
+        const float motorHz = erpm / 60.0f / (MOTOR_POLE_COUNT / 2);
+        motorPhase += 2 * M_PIf * motorHz / 8000.0f;
+        motorErpm[i] = lrintf(erpm / 100.0f);
+
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            seed = seed * 1664525 + 1013904223;
+            const float noise = ((int32_t)(seed >> 16) & 0xff) - 128;
+            const float sticks = 400.0f * sinf(2 * M_PIf * (1.0f + axis) * t);
+            const float motorNoise = 120.0f * sinf(motorPhase + axis) + 60.0f * sinf(2 * motorPhase) + 30.0f * sinf(3 * motorPhase);
+            gyroSignal[i][axis] = lrintf(sticks + motorNoise + noise);
+        }
+    }
+}
+
+// Fake gyro driver, returns a new sample on every read
+static bool benchGyroRead(gyroDev_t *gyroDev)
+{
+    const int16_t *sample = gyroSignal[signalIndex % SIGNAL_SAMPLE_COUNT];
+    gyroDev->gyroADCRaw[X] = sample[X];
+    gyroDev->gyroADCRaw[Y] = sample[Y];
+    gyroDev->gyroADCRaw[Z] = sample[Z];
+    return true;
+}
+
+static void configure(const benchConfig_t *config)
+{
+    pgResetAll();
+
+    gyroConfigMutable()->gyro_to_use = config->dualGyro ? GYRO_CONFIG_USE_GYRO_BOTH : GYRO_CONFIG_USE_GYRO_1;
+    gyroConfigMutable()->gyrosDetected = 0;
+
+    motorConfigMutable()->dev.useDshotTelemetry = config->rpmHarmonics > 0;
+    motorConfigMutable()->motorPoleCount = MOTOR_POLE_COUNT;
+    rpmFilterConfigMutable()->gyro_rpm_notch_harmonics = config->rpmHarmonics;
+
+    if (config->dynamicNotch) {
+        featureEnableImmediate(FEATURE_DYNAMIC_FILTER);
+    } else {
+        featureDisableImmediate(FEATURE_DYNAMIC_FILTER);
+    }
+
+    gyroInit();
+    gyroSetTargetLooptime(config->pidProcessDenom);
+    gyroInitFilters();
+    gyro.gyroSensor1.gyroDev.readFn = benchGyroRead;
+    gyro.gyroSensor2.gyroDev.readFn = benchGyroRead;
+
+    currentPidProfile = pidProfilesMutable(0);
+    mixerInit(MIXER_QUADX);
+    mixerConfigureOutput();
+    pidInit(currentPidProfile);
+    pidStabilisationState(PID_STABILISATION_ON);
+
+    ENABLE_ARMING_FLAG(ARMED);
+}
+
+static void runConfig(const benchConfig_t *config, uint32_t iterations)
+{
+    char configName[64];
+    snprintf(configName, sizeof(configName), "%dk_rpm%d_%s_%s",
+        8 / config->pidProcessDenom, config->rpmHarmonics,
+        config->dynamicNotch ? "dyn" : "nodyn", config->dualGyro ? "dual" : "single");
+
+    configure(config);
+
+    benchmarkTimer_t gyroUpdateTimer;
+    benchmarkTimer_t gyroFilteringTimer;
+    benchmarkTimer_t pidControllerTimer;
+    benchmarkTimer_t mixTableTimer;
+
+    signalIndex = 0;
+    uint8_t pidUpdateCounter = 0;
+    for (uint32_t i = 0; i < WARMUP_ITERATIONS + iterations; i++) {
+        if (i == WARMUP_ITERATIONS) {
+            benchmarkTimerReset(&gyroUpdateTimer);
+            benchmarkTimerReset(&gyroFilteringTimer);
+            benchmarkTimerReset(&pidControllerTimer);
+            benchmarkTimerReset(&mixTableTimer);
+        }
+        simulatedTimeUs += gyro.sampleLooptime;
+        signalIndex++;
+
+        // taskGyroSample
+        benchmarkTimerStart(&gyroUpdateTimer);
+        gyroUpdate();
+        benchmarkTimerStop(&gyroUpdateTimer);
+        if (pidUpdateCounter % activePidLoopDenom == 0) {
+            pidUpdateCounter = 0;
+        }
+        pidUpdateCounter++;
+
+        // taskFiltering
+        if (pidUpdateCounter % activePidLoopDenom == 0) {
+            benchmarkTimerStart(&gyroFilteringTimer);
+            gyroFiltering(simulatedTimeUs);
+            benchmarkTimerStop(&gyroFilteringTimer);
+        }
+
+        // taskMainPidLoop
+        if ((pidUpdateCounter % activePidLoopDenom) == (activePidLoopDenom / 2)) {
+            benchmarkTimerStart(&pidControllerTimer);
+            pidController(currentPidProfile, simulatedTimeUs);
+            benchmarkTimerStop(&pidControllerTimer);
+
+            benchmarkTimerStart(&mixTableTimer);
+            mixTable(simulatedTimeUs, currentPidProfile->vbatPidCompensation);
+            benchmarkTimerStop(&mixTableTimer);
+        }
+    }
+
+    benchmarkReport(BENCHMARK_NAME, configName, "gyroUpdate", &gyroUpdateTimer);
+    benchmarkReport(BENCHMARK_NAME, configName, "gyroFiltering", &gyroFilteringTimer);
+    benchmarkReport(BENCHMARK_NAME, configName, "pidController", &pidControllerTimer);
+    benchmarkReport(BENCHMARK_NAME, configName, "mixTable", &mixTableTimer);
+}
+
+int main(int argc, char **argv)
+{
+    benchmarkInit(argc, argv);
+    const uint32_t iterations = benchmarkIterations(DEFAULT_ITERATIONS);
+
+    generateSignals();
+
+    static const uint8_t pidProcessDenoms[] = { 1, 2 };
+    for (unsigned denom = 0; denom < ARRAYLEN(pidProcessDenoms); denom++) {
+        for (uint8_t harmonics = 0; harmonics <= 3; harmonics++) {
+            for (int dynamicNotch = 0; dynamicNotch <= 1; dynamicNotch++) {
+                for (int dualGyro = 0; dualGyro <= 1; dualGyro++) {
+                    const benchConfig_t config = {
+                        .pidProcessDenom = pidProcessDenoms[denom],
+                        .rpmHarmonics = harmonics,
+                        .dynamicNotch = (bool)dynamicNotch,
+                        .dualGyro = (bool)dualGyro,
+                    };
+                    runConfig(&config, iterations);
+                }
+            }
+        }
+    }
+
+    return 0;
+}
+
+// STUBS
+
+extern "C" {
+
+PG_REGISTER(accelerometerConfig_t, accelerometerConfig, PG_ACCELEROMETER_CONFIG, 0);
+PG_REGISTER(rxConfig_t, rxConfig, PG_RX_CONFIG, 0);
+PG_REGISTER(flight3DConfig_t, flight3DConfig, PG_MOTOR_3D_CONFIG, 0);
+
+pidProfile_t *currentPidProfile;
+static controlRateConfig_t controlRateProfile;
+controlRateConfig_t *currentControlRateProfile = &controlRateProfile;
+
+uint8_t detectedSensors[SENSOR_INDEX_COUNT];
+attitudeEulerAngles_t attitude;
+acc_t acc;
+int16_t rcData[MAX_SUPPORTED_RC_CHANNEL_COUNT];
+float rcCommand[4];
+bool cliMode = false;
+
+uint32_t micros(void) { return simulatedTimeUs; }
+uint32_t millis(void) { return simulatedTimeUs / 1000; }
+timeDelta_t getGyroUpdateRate(void) { return gyro.targetLooptime; }
+void schedulerResetTaskStatistics(taskId_e) {}
+void writeEEPROM(void) {}
+void systemBeep(bool) {}
+void beeperConfirmationBeeps(uint8_t) {}
+void disarm(flightLogDisarmReason_e) {}
+
+uint16_t getDshotTelemetry(uint8_t)
+{
+    return motorErpm[signalIndex % SIGNAL_SAMPLE_COUNT];
+}
+
+float getSetpointRate(int axis)
+{
+    return 200.0f * sinf(2 * M_PIf * (1.0f + axis) * simulatedTimeUs * 1e-6f);
+}
+float getRcDeflection(int axis) { return getSetpointRate(axis) / 670.0f; }
+float getRcDeflectionAbs(int axis) { return fabsf(getRcDeflection(axis)); }
+float getThrottlePIDAttenuation(void) { return 1.0f; }
+bool isAirmodeActivated(void) { return true; }
+bool airmodeIsEnabled(void) { return true; }
+bool isFlipOverAfterCrashActive(void) { return false; }
+bool isLaunchControlActive(void) { return false; }
+float calculateVbatPidCompensation(void) { return 1.0f; }
+uint8_t calculateThrottlePercentAbs(void) { return 50; }
+bool isMotorProtocolDshot(void) { return true; }
+void motorInitEndpoints(const motorConfig_t *, float outputLimit, float *outputLow, float *outputHigh, float *disarm, float *deadbandMotor3DHigh, float *deadbandMotor3DLow)
+{
+    *outputLow = DSHOT_MIN_THROTTLE;
+    *outputHigh = DSHOT_MIN_THROTTLE + (DSHOT_MAX_THROTTLE - DSHOT_MIN_THROTTLE) * outputLimit;
+    *disarm = DSHOT_CMD_MOTOR_STOP;
+    *deadbandMotor3DHigh = DSHOT_3D_FORWARD_MIN_THROTTLE;
+    *deadbandMotor3DLow = DSHOT_3D_FORWARD_MIN_THROTTLE - 1;
+}
+float motorConvertFromExternal(uint16_t externalValue) { return externalValue; }
+uint16_t motorConvertToExternal(float motorValue) { return motorValue; }
+void motorWriteAll(float *) {}
+void beeper(beeperMode_e) {}
+void delay(uint32_t) {}
+bool IS_RC_MODE_ACTIVE(boxId_e) { return false; }
+bool failsafeIsActive(void) { return false; }
+bool isMotorsReversed(void) { return false; }
+void mixerTricopterInit(void) {}
+float mixerTricopterMotorCorrection(int) { return 0; }
+void dshotSetPidLoopTime(uint32_t) {}
+uint32_t getRcFrameNumber(void) { return simulatedTimeUs / 4000; }
+void interpolatedSpInit(const pidProfile_t *) {}
+float interpolatedSpApply(int, bool, ffInterpolationType_t) { return 0; }
+float applyFfLimit(int, float value, float, float) { return value; }
+bool shouldApplyFfLimits(int) { return false; }
+
+}
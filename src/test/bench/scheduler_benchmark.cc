@@ -0,0 +1,208 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Times scheduler() with every task in the table enabled, using the periods and
+// priorities from fc/tasks.c. Tasks do no work apart from advancing a simulated
+// clock, so the time measured is the scheduler's own overhead per pass.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#include <new>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "build/debug.h"
+
+    #include "common/utils.h"
+
+    #include "scheduler/scheduler.h"
+
+    #include "benchmark.h"
+
+    uint8_t debugMode;
+    int16_t debug[DEBUG16_VALUE_COUNT];
+
+    extern uint32_t unittest_scheduler_examinedTasks;
+}
+
+#define BENCHMARK_NAME          "scheduler"
+#define DEFAULT_ITERATIONS      1000000
+#define WARMUP_ITERATIONS       10000
+#define GYRO_SAMPLE_HZ          8000
+#define PASS_TIME_US            1       // simulated time taken by the main loop around each scheduler() call
+#define TASK_TIME_US            5       // simulated execution time of every non-realtime task
+#define RX_FRAME_PERIOD_US      4000    // rxUpdateCheck() signals a new frame at this rate
+
+static timeUs_t simulatedTimeUs;
+static timeUs_t lastRxFrameUs;
+static bool filterReady;
+
+static task_t tasks[TASK_COUNT] = { };
+
+static void benchTaskFunc(timeUs_t)
+{
+    simulatedTimeUs += TASK_TIME_US;
+}
+
+static void benchGyroSample(timeUs_t)
+{
+    simulatedTimeUs += 10;
+    filterReady = true;
+}
+
+static void benchFiltering(timeUs_t)
+{
+    simulatedTimeUs += 15;
+    filterReady = false;
+}
+
+static void benchPidLoop(timeUs_t)
+{
+    simulatedTimeUs += 40;
+}
+
+static bool benchRxCheck(timeUs_t currentTimeUs, timeDelta_t)
+{
+    if (cmpTimeUs(currentTimeUs, lastRxFrameUs) >= RX_FRAME_PERIOD_US) {
+        lastRxFrameUs = currentTimeUs;
+        return true;
+    }
+    return false;
+}
+
+static void defineTask(taskId_e taskId, const char *taskName, bool (*checkFunc)(timeUs_t, timeDelta_t), void (*taskFunc)(timeUs_t), timeDelta_t desiredPeriodUs, int8_t staticPriority)
+{
+    const task_t task = { taskName, NULL, checkFunc, taskFunc, desiredPeriodUs, staticPriority };
+    new (&tasks[taskId]) task_t(task);
+}
+
+static void defineTasks(void)
+{
+    for (int taskId = 0; taskId < TASK_COUNT; taskId++) {
+        defineTask(static_cast<taskId_e>(taskId), "OTHER", NULL, benchTaskFunc, TASK_PERIOD_HZ(20), TASK_PRIORITY_LOW);
+    }
+
+    defineTask(TASK_SYSTEM, "SYSTEM", NULL, benchTaskFunc, TASK_PERIOD_HZ(10), TASK_PRIORITY_MEDIUM_HIGH);
+    defineTask(TASK_MAIN, "MAIN", NULL, benchTaskFunc, TASK_PERIOD_HZ(1000), TASK_PRIORITY_MEDIUM_HIGH);
+    defineTask(TASK_GYRO, "GYRO", NULL, benchGyroSample, TASK_PERIOD_HZ(GYRO_SAMPLE_HZ), TASK_PRIORITY_REALTIME);
+    defineTask(TASK_FILTER, "FILTER", NULL, benchFiltering, TASK_PERIOD_HZ(GYRO_SAMPLE_HZ), TASK_PRIORITY_REALTIME);
+    defineTask(TASK_PID, "PID", NULL, benchPidLoop, TASK_PERIOD_HZ(GYRO_SAMPLE_HZ), TASK_PRIORITY_REALTIME);
+    defineTask(TASK_ACCEL, "ACC", NULL, benchTaskFunc, TASK_PERIOD_HZ(1000), TASK_PRIORITY_MEDIUM);
+    defineTask(TASK_ATTITUDE, "ATTITUDE", NULL, benchTaskFunc, TASK_PERIOD_HZ(100), TASK_PRIORITY_MEDIUM);
+    defineTask(TASK_RX, "RX", benchRxCheck, benchTaskFunc, TASK_PERIOD_HZ(33), TASK_PRIORITY_HIGH);
+    defineTask(TASK_SERIAL, "SERIAL", NULL, benchTaskFunc, TASK_PERIOD_HZ(100), TASK_PRIORITY_LOW);
+    defineTask(TASK_DISPATCH, "DISPATCH", NULL, benchTaskFunc, TASK_PERIOD_HZ(1000), TASK_PRIORITY_HIGH);
+    defineTask(TASK_BATTERY_VOLTAGE, "BATTERY_VOLTAGE", NULL, benchTaskFunc, TASK_PERIOD_HZ(50), TASK_PRIORITY_MEDIUM);
+    defineTask(TASK_BATTERY_CURRENT, "BATTERY_CURRENT", NULL, benchTaskFunc, TASK_PERIOD_HZ(50), TASK_PRIORITY_MEDIUM);
+    defineTask(TASK_BATTERY_ALERTS, "BATTERY_ALERTS", NULL, benchTaskFunc, TASK_PERIOD_HZ(5), TASK_PRIORITY_MEDIUM);
+#ifdef USE_BEEPER
+    defineTask(TASK_BEEPER, "BEEPER", NULL, benchTaskFunc, TASK_PERIOD_HZ(100), TASK_PRIORITY_LOW);
+#endif
+#ifdef USE_GPS
+    defineTask(TASK_GPS, "GPS", NULL, benchTaskFunc, TASK_PERIOD_HZ(100), TASK_PRIORITY_MEDIUM);
+#endif
+#ifdef USE_MAG
+    defineTask(TASK_COMPASS, "COMPASS", NULL, benchTaskFunc, TASK_PERIOD_HZ(10), TASK_PRIORITY_LOW);
+#endif
+#ifdef USE_BARO
+    defineTask(TASK_BARO, "BARO", NULL, benchTaskFunc, TASK_PERIOD_HZ(20), TASK_PRIORITY_LOW);
+#endif
+#if defined(USE_BARO) || defined(USE_GPS)
+    defineTask(TASK_ALTITUDE, "ALTITUDE", NULL, benchTaskFunc, TASK_PERIOD_HZ(40), TASK_PRIORITY_LOW);
+#endif
+#ifdef USE_TELEMETRY
+    defineTask(TASK_TELEMETRY, "TELEMETRY", NULL, benchTaskFunc, TASK_PERIOD_HZ(250), TASK_PRIORITY_LOW);
+#endif
+#ifdef USE_LED_STRIP
+    defineTask(TASK_LEDSTRIP, "LEDSTRIP", NULL, benchTaskFunc, TASK_PERIOD_HZ(100), TASK_PRIORITY_LOW);
+#endif
+#ifdef USE_TRANSPONDER
+    defineTask(TASK_TRANSPONDER, "TRANSPONDER", NULL, benchTaskFunc, TASK_PERIOD_HZ(250), TASK_PRIORITY_LOW);
+#endif
+#ifdef USE_OSD
+    defineTask(TASK_OSD, "OSD", NULL, benchTaskFunc, TASK_PERIOD_HZ(60), TASK_PRIORITY_LOW);
+#endif
+#ifdef USE_CMS
+    defineTask(TASK_CMS, "CMS", NULL, benchTaskFunc, TASK_PERIOD_HZ(20), TASK_PRIORITY_LOW);
+#endif
+}
+
+static void runConfig(bool useDeadlineQueue, uint32_t iterations)
+{
+    const char *configName = useDeadlineQueue ? "deadline_queue" : "scan";
+
+    defineTasks();
+    simulatedTimeUs = 0;
+    lastRxFrameUs = 0;
+    schedulerUseDeadlineQueue(useDeadlineQueue);
+    schedulerInit();
+    schedulerEnableGyro();
+    for (int taskId = 0; taskId < TASK_COUNT; taskId++) {
+        setTaskEnabled(static_cast<taskId_e>(taskId), true);
+    }
+
+    benchmarkTimer_t schedulerTimer;
+    uint32_t examinedTasks = 0;
+    for (uint32_t i = 0; i < WARMUP_ITERATIONS + iterations; i++) {
+        if (i == WARMUP_ITERATIONS) {
+            benchmarkTimerReset(&schedulerTimer);
+            examinedTasks = unittest_scheduler_examinedTasks;
+        }
+        benchmarkTimerStart(&schedulerTimer);
+        scheduler();
+        benchmarkTimerStop(&schedulerTimer);
+        simulatedTimeUs += PASS_TIME_US;
+    }
+    examinedTasks = unittest_scheduler_examinedTasks - examinedTasks;
+
+    schedulerUseDeadlineQueue(false);
+
+    benchmarkReport(BENCHMARK_NAME, configName, "scheduler", &schedulerTimer);
+    benchmarkReportValue(BENCHMARK_NAME, configName, "tasksExaminedPerPass", "tasks", (double)examinedTasks / iterations);
+}
+
+int main(int argc, char **argv)
+{
+    benchmarkInit(argc, argv);
+    const uint32_t iterations = benchmarkIterations(DEFAULT_ITERATIONS);
+
+    runConfig(false, iterations);
+    runConfig(true, iterations);
+
+    return 0;
+}
+
+// STUBS
+
+extern "C" {
+
+uint32_t micros(void) { return simulatedTimeUs; }
+bool gyroFilterReady(void) { return filterReady; }
+bool pidLoopReady(void) { return true; }
+
+task_t *getTask(unsigned taskId)
+{
+    return &tasks[taskId];
+}
+
+}
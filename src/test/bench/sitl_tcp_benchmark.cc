@@ -0,0 +1,207 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Times MSP sized round trips and bulk throughput through a SITL TCP UART, with the event loop on its own thread and
+// a stand-in for the flight loop that echoes whatever it reads, polling the port the way the SITL main loop does.
+// Also reports how much CPU the I/O thread uses while the port is idle.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include <pthread.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "drivers/serial.h"
+    #include "drivers/serial_tcp.h"
+
+    #include "target/SITL/eventloop.h"
+
+    #include "benchmark.h"
+}
+
+#define BENCHMARK_NAME          "sitl_tcp"
+#define DEFAULT_ITERATIONS      2000
+#define PORT_ID                 (SERIAL_PORT_COUNT - 1)
+#define TCP_PORT                (5760 + PORT_ID + 1)
+#define FLIGHT_LOOP_DELAY_US    50      // the SITL main loop sleeps this long between scheduler runs
+#define REQUEST_SIZE            8       // an MSP v1 request without payload
+#define BULK_FRAME_SIZE         200
+#define BULK_BYTES              (4 * 1024 * 1024)
+#define IDLE_SAMPLE_MS          500
+
+static serialPort_t *port;
+static volatile bool running = true;
+
+static void *ioThread(void *arg)
+{
+    (void)arg;
+    eventLoopRun();
+    return NULL;
+}
+
+static void *flightLoop(void *arg)
+{
+    (void)arg;
+    uint8_t buf[256];
+
+    const struct timespec delay = { 0, FLIGHT_LOOP_DELAY_US * 1000 };
+    while (running) {
+        uint32_t count = serialRxBytesWaiting(port);
+        if (count > sizeof(buf)) {
+            count = sizeof(buf);
+        }
+        for (uint32_t i = 0; i < count; i++) {
+            buf[i] = serialRead(port);
+        }
+        if (count) {
+            serialBeginWrite(port);
+            serialWriteBuf(port, buf, count);
+            serialEndWrite(port);
+        }
+        nanosleep(&delay, NULL);
+    }
+    return NULL;
+}
+
+static bool readFully(int fd, uint8_t *buf, size_t len)
+{
+    while (len > 0) {
+        const ssize_t received = recv(fd, buf, len, 0);
+        if (received <= 0) {
+            return false;
+        }
+        buf += received;
+        len -= received;
+    }
+    return true;
+}
+
+static void *bulkSender(void *arg)
+{
+    const int fd = *(int *)arg;
+    uint8_t frame[BULK_FRAME_SIZE];
+    memset(frame, 0x55, sizeof(frame));
+
+    for (uint32_t sent = 0; sent < BULK_BYTES; sent += sizeof(frame)) {
+        if (send(fd, frame, sizeof(frame), MSG_NOSIGNAL) != sizeof(frame)) {
+            break;
+        }
+    }
+    return NULL;
+}
+
+static int connectToPort(void)
+{
+    const int fd = socket(AF_INET, SOCK_STREAM, 0);
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = htons(TCP_PORT);
+    if (connect(fd, (const struct sockaddr *)&addr, sizeof(addr)) < 0) {
+        close(fd);
+        return -1;
+    }
+    const int one = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    return fd;
+}
+
+static uint64_t threadCpuNs(pthread_t thread)
+{
+    clockid_t clock;
+    struct timespec ts;
+    pthread_getcpuclockid(thread, &clock);
+    clock_gettime(clock, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+int main(int argc, char **argv)
+{
+    benchmarkInit(argc, argv);
+    const uint32_t iterations = benchmarkIterations(DEFAULT_ITERATIONS);
+
+    if (!eventLoopInit()) {
+        fprintf(stderr, "eventLoopInit failed\n");
+        return 1;
+    }
+    port = serTcpOpen(PORT_ID, NULL, NULL, 115200, MODE_RXTX, SERIAL_NOT_INVERTED);
+
+    pthread_t io;
+    pthread_t flight;
+    pthread_create(&io, NULL, ioThread, NULL);
+    pthread_create(&flight, NULL, flightLoop, NULL);
+
+    const int fd = connectToPort();
+    if (fd < 0) {
+        fprintf(stderr, "connect to port %d failed\n", TCP_PORT);
+        return 1;
+    }
+
+    // round trip of a request the size of most MSP polls
+    uint8_t request[REQUEST_SIZE] = { '$', 'M', '<', 0, 101, 101, 0, 0 };
+    uint8_t reply[REQUEST_SIZE];
+    benchmarkTimer_t timer;
+    benchmarkTimerReset(&timer);
+    for (uint32_t i = 0; i < iterations; i++) {
+        benchmarkTimerStart(&timer);
+        send(fd, request, sizeof(request), MSG_NOSIGNAL);
+        if (!readFully(fd, reply, sizeof(reply))) {
+            break;
+        }
+        benchmarkTimerStop(&timer);
+    }
+    benchmarkReport(BENCHMARK_NAME, "epoll", "mspRoundTrip", &timer);
+
+    // pipelined frames, sent from their own thread so that neither direction stalls the other
+    static uint8_t bulk[BULK_BYTES];
+    pthread_t sender;
+    int senderFd = fd;
+    const uint64_t bulkStartNs = benchmarkNowNs();
+    pthread_create(&sender, NULL, bulkSender, &senderFd);
+    const bool bulkComplete = readFully(fd, bulk, sizeof(bulk));
+    const uint64_t bulkNs = benchmarkNowNs() - bulkStartNs;
+    pthread_join(sender, NULL);
+    benchmarkReportValue(BENCHMARK_NAME, "epoll", "echoThroughput", "MB/s", bulkComplete ? BULK_BYTES * 1e3 / bulkNs : 0);
+
+    // connected but nothing to do
+    const uint64_t idleCpuStartNs = threadCpuNs(io);
+    usleep(IDLE_SAMPLE_MS * 1000);
+    const uint64_t idleCpuNs = threadCpuNs(io) - idleCpuStartNs;
+    benchmarkReportValue(BENCHMARK_NAME, "epoll", "ioThreadIdleCpu", "%", idleCpuNs * 1e-4 / IDLE_SAMPLE_MS);
+
+    close(fd);
+    running = false;
+    pthread_join(flight, NULL);
+    eventLoopStop();
+    pthread_join(io, NULL);
+
+    return 0;
+}
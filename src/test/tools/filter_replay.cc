@@ -0,0 +1,933 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Replays the unfiltered gyro and the motor eRPM recorded in a blackbox log through the flight code's own gyro
+// filters, dynamic notch, RPM filter and PID controller, once with the settings in the log header and once for each
+// configuration file given, so that filter settings can be compared on a real flight without flying again.
+//
+//   filter_replay [-j jobs] [-o outdir] log.bbl [config.txt ...]
+//
+// A configuration file holds CLI "set name = value" and "feature [-]DYNAMIC_FILTER" lines, applied on top of the
+// logged settings. Each configuration is replayed in its own process, up to jobs at a time (default: one per core),
+// and prints one JSON line with, for each axis, the delay of the filtered gyro behind a zero-phase smoothed
+// reference, the noise left in the filtered gyro around that reference and the RMS of the D term. With -o, each
+// configuration also writes its traces to <outdir>/<config>.csv.
+//
+// The unfiltered gyro comes from debug[0..2] of a log recorded with debug_mode GYRO_SCALED (or GYRO_RAW), and the
+// filters run at the rate the log was recorded at, so the log should be recorded with blackbox_p_ratio 1.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <time.h>
+
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "build/debug.h"
+
+    #include "cli/settings.h"
+    #include "cli/settings_index.h"
+
+    #include "common/axis.h"
+    #include "common/filter.h"
+    #include "common/maths.h"
+
+    #include "config/config.h"
+    #include "config/feature.h"
+
+    #include "drivers/accgyro/accgyro.h"
+    #include "drivers/dshot.h"
+    #include "drivers/dshot_command.h"
+    #include "drivers/motor.h"
+
+    #include "fc/controlrate_profile.h"
+    #include "fc/core.h"
+    #include "fc/rc.h"
+    #include "fc/rc_controls.h"
+    #include "fc/rc_modes.h"
+    #include "fc/runtime_config.h"
+
+    #include "io/beeper.h"
+
+    #include "flight/gps_rescue.h"
+    #include "flight/failsafe.h"
+    #include "flight/imu.h"
+    #include "flight/interpolated_setpoint.h"
+    #include "flight/mixer.h"
+    #include "flight/pid.h"
+    #include "flight/mixer_tricopter.h"
+    #include "flight/rpm_filter.h"
+
+    #include "pg/motor.h"
+    #include "pg/pg.h"
+    #include "pg/pg_ids.h"
+    #include "pg/rx.h"
+
+    #include "rx/rx.h"
+
+    #include "scheduler/scheduler.h"
+
+    #include "sensors/acceleration.h"
+    #include "sensors/battery.h"
+    #include "sensors/current.h"
+    #include "sensors/gyro.h"
+    #include "sensors/gyro_init.h"
+    #include "sensors/sensors.h"
+    #include "sensors/voltage.h"
+
+    #include "blackbox_decoder.h"
+
+    uint8_t debugMode;
+    int16_t debug[DEBUG16_VALUE_COUNT];
+
+    const char * const currentMeterSourceNames[CURRENT_METER_COUNT] = { "NONE" };
+    const char * const debugModeNames[DEBUG_COUNT] = { "NONE" };
+    const char * const voltageMeterSourceNames[VOLTAGE_METER_COUNT] = { "NONE" };
+}
+
+#define TOOL_NAME               "filter_replay"
+#define LOGGED_CONFIG_NAME      "logged"
+#define REFERENCE_CUTOFF_HZ     50
+#define MAX_DELAY_MS            20
+#define SETTLE_TIME_US          500000  // left out of the metrics while the filters settle
+
+typedef struct setting_s {
+    std::string name;
+    std::string value;
+    int line;
+} setting_t;
+
+typedef struct replayConfig_s {
+    std::string name;
+    std::string path;
+    std::vector<setting_t> settings;
+} replayConfig_t;
+
+// Written by the replay processes into memory shared with the parent
+typedef struct replayResult_s {
+    bool done;
+    uint32_t sampleCount;
+    double replaySeconds;
+    float delayMs[XYZ_AXIS_COUNT];
+    float noiseRms[XYZ_AXIS_COUNT];
+    float rawNoiseRms[XYZ_AXIS_COUNT];
+    float dtermRms[XYZ_AXIS_COUNT];
+} replayResult_t;
+
+// The inputs of the replay, decoded from the log once before the replay processes are started
+static struct {
+    uint32_t sampleCount;
+    uint32_t intervalUs;
+    float gyroScale;
+    int motorCount;
+    bool hasErpm;
+    bool hasSetpoint;
+    std::vector<uint32_t> timeUs;
+    std::vector<int16_t> gyro[XYZ_AXIS_COUNT];
+    std::vector<float> setpoint[XYZ_AXIS_COUNT];
+    std::vector<uint16_t> erpm[MAX_SUPPORTED_MOTORS];
+    std::vector<setting_t> headerSettings;
+    int dynamicFilterFeature;   // -1 if the log has no features header
+} logData;
+
+static uint32_t replayIndex;
+static timeUs_t simulatedTimeUs;
+
+static std::vector<uint8_t> readFile(const char *path)
+{
+    std::vector<uint8_t> data;
+    FILE *file = fopen(path, "rb");
+    if (!file) {
+        return data;
+    }
+    uint8_t buf[65536];
+    size_t len;
+    while ((len = fread(buf, 1, sizeof(buf), file)) > 0) {
+        data.insert(data.end(), buf, buf + len);
+    }
+    fclose(file);
+    return data;
+}
+
+static std::vector<std::string> splitValues(const char *value)
+{
+    std::vector<std::string> values;
+    const char *start = value;
+    for (const char *p = value; ; p++) {
+        if (*p == ',' || *p == '\0') {
+            values.push_back(std::string(start, p - start));
+            if (*p == '\0') {
+                break;
+            }
+            start = p + 1;
+        }
+    }
+    return values;
+}
+
+// Header lines that hold several settings, in the order they are printed by blackboxWriteSysinfo()
+static const struct {
+    const char *header;
+    const char *settings[3];
+} headerAliases[] = {
+    { "gyro_notch_hz",          { "gyro_notch1_hz", "gyro_notch2_hz" } },
+    { "gyro_notch_cutoff",      { "gyro_notch1_cutoff", "gyro_notch2_cutoff" } },
+    { "gyro_lowpass_dyn_hz",    { "dyn_lpf_gyro_min_hz", "dyn_lpf_gyro_max_hz" } },
+    { "dterm_lowpass_dyn_hz",   { "dyn_lpf_dterm_min_hz", "dyn_lpf_dterm_max_hz" } },
+    { "d_min",                  { "d_min_roll", "d_min_pitch", "d_min_yaw" } },
+};
+
+static void loadHeaderSettings(const blackboxDecoder_t *decoder)
+{
+    logData.dynamicFilterFeature = -1;
+
+    for (int i = 0; i < decoder->headerCount; i++) {
+        const char *name = decoder->headerName[i];
+        const char *value = decoder->headerValue[i];
+
+        if (strcmp(name, "features") == 0) {
+            logData.dynamicFilterFeature = (strtoul(value, NULL, 10) & FEATURE_DYNAMIC_FILTER) != 0;
+            continue;
+        }
+
+        bool isAlias = false;
+        for (unsigned alias = 0; alias < ARRAYLEN(headerAliases); alias++) {
+            if (strcmp(name, headerAliases[alias].header) == 0) {
+                const std::vector<std::string> values = splitValues(value);
+                for (unsigned j = 0; j < values.size() && j < ARRAYLEN(headerAliases[alias].settings); j++) {
+                    if (headerAliases[alias].settings[j]) {
+                        logData.headerSettings.push_back({ headerAliases[alias].settings[j], values[j], 0 });
+                    }
+                }
+                isAlias = true;
+            }
+        }
+
+        if (!isAlias && settingsIndexFind(name, strlen(name)) < valueTableEntryCount) {
+            logData.headerSettings.push_back({ name, value, 0 });
+        }
+    }
+}
+
+static bool loadLog(const char *path)
+{
+    const std::vector<uint8_t> data = readFile(path);
+    if (data.empty()) {
+        fprintf(stderr, "%s: can't read %s\n", TOOL_NAME, path);
+        return false;
+    }
+
+    static blackboxDecoder_t decoder;
+    blackboxDecoderInit(&decoder, data.data(), data.size());
+    if (!blackboxDecoderReadHeaders(&decoder)) {
+        fprintf(stderr, "%s: %s is not a blackbox log\n", TOOL_NAME, path);
+        return false;
+    }
+    loadHeaderSettings(&decoder);
+
+    // Find the unfiltered gyro, gyroADC has already been through the filters being replayed
+    const char *debugModeHeader = blackboxDecoderGetHeader(&decoder, "debug_mode");
+    const int logDebugMode = debugModeHeader ? atoi(debugModeHeader) : DEBUG_NONE;
+    int gyroIndex[XYZ_AXIS_COUNT];
+    char fieldName[BLACKBOX_DECODER_MAX_NAME_LENGTH];
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        if (logDebugMode == DEBUG_GYRO_SCALED || logDebugMode == DEBUG_GYRO_RAW) {
+            snprintf(fieldName, sizeof(fieldName), "debug[%d]", axis);
+        } else {
+            snprintf(fieldName, sizeof(fieldName), "gyroADC[%d]", axis);
+        }
+        gyroIndex[axis] = blackboxDecoderFieldIndex(&decoder.mainI, fieldName);
+        if (gyroIndex[axis] < 0) {
+            fprintf(stderr, "%s: %s has no %s field\n", TOOL_NAME, path, fieldName);
+            return false;
+        }
+    }
+    if (logDebugMode == DEBUG_GYRO_RAW) {
+        // raw sensor counts, with the sensor's zero offset still in them
+        logData.gyroScale = 1.0f / 16.4f;
+    } else {
+        logData.gyroScale = 1.0f;
+        if (logDebugMode != DEBUG_GYRO_SCALED) {
+            fprintf(stderr, "%s: warning: log was not recorded with debug_mode GYRO_SCALED, replaying the filtered gyro\n", TOOL_NAME);
+        }
+    }
+
+    int setpointIndex[XYZ_AXIS_COUNT];
+    logData.hasSetpoint = true;
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        snprintf(fieldName, sizeof(fieldName), "setpoint[%d]", axis);
+        setpointIndex[axis] = blackboxDecoderFieldIndex(&decoder.mainI, fieldName);
+        logData.hasSetpoint &= setpointIndex[axis] >= 0;
+    }
+
+    int erpmIndex[MAX_SUPPORTED_MOTORS];
+    logData.motorCount = 0;
+    for (int motor = 0; motor < MAX_SUPPORTED_MOTORS; motor++) {
+        snprintf(fieldName, sizeof(fieldName), "eRPM(/100)[%d]", motor);
+        erpmIndex[motor] = blackboxDecoderFieldIndex(&decoder.mainI, fieldName);
+        if (erpmIndex[motor] >= 0) {
+            logData.motorCount = motor + 1;
+        }
+    }
+    logData.hasErpm = logData.motorCount > 0;
+    if (!logData.hasErpm) {
+        fprintf(stderr, "%s: warning: log has no eRPM fields, the RPM filter is off\n", TOOL_NAME);
+    }
+
+    int frameType;
+    while ((frameType = blackboxDecoderNextFrame(&decoder)) != 0) {
+        if (frameType < 0) {
+            fprintf(stderr, "%s: warning: %s is corrupt after %u frames, replaying up to there\n",
+                TOOL_NAME, path, (unsigned)logData.timeUs.size());
+            break;
+        }
+        if (frameType != 'I' && frameType != 'P') {
+            continue;
+        }
+        const int32_t *frame = decoder.mainHistory[0];
+        logData.timeUs.push_back(frame[decoder.timeIndex]);
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            logData.gyro[axis].push_back(constrain(frame[gyroIndex[axis]], INT16_MIN, INT16_MAX));
+            logData.setpoint[axis].push_back(logData.hasSetpoint ? frame[setpointIndex[axis]] : 0);
+        }
+        for (int motor = 0; motor < logData.motorCount; motor++) {
+            logData.erpm[motor].push_back(erpmIndex[motor] >= 0 ? frame[erpmIndex[motor]] : 0);
+        }
+    }
+
+    logData.sampleCount = logData.timeUs.size();
+    if (logData.sampleCount < 2) {
+        fprintf(stderr, "%s: %s has no main frames\n", TOOL_NAME, path);
+        return false;
+    }
+
+    // The median frame interval, skipping the gaps where logging paused
+    std::vector<uint32_t> intervals;
+    for (uint32_t i = 1; i < logData.sampleCount; i++) {
+        intervals.push_back(logData.timeUs[i] - logData.timeUs[i - 1]);
+    }
+    std::nth_element(intervals.begin(), intervals.begin() + intervals.size() / 2, intervals.end());
+    logData.intervalUs = intervals[intervals.size() / 2];
+    if (logData.intervalUs == 0) {
+        fprintf(stderr, "%s: %s has no usable frame times\n", TOOL_NAME, path);
+        return false;
+    }
+
+    return true;
+}
+
+typedef enum {
+    SETTING_OK,
+    SETTING_UNKNOWN,
+    SETTING_NOT_REPLAYED,
+    SETTING_INVALID,
+} settingResult_e;
+
+// Sets a value the way the CLI "set" command does, profile settings go to profile 0
+static settingResult_e applySetting(const char *name, const char *value)
+{
+    const uint16_t index = settingsIndexFind(name, strlen(name));
+    if (index >= valueTableEntryCount) {
+        return SETTING_UNKNOWN;
+    }
+    const clivalue_t *var = &valueTable[index];
+    const pgRegistry_t *pg = pgFind(var->pgn);
+    if (!pg) {
+        return SETTING_NOT_REPLAYED;
+    }
+
+    char *end;
+    int64_t number = strtoll(value, &end, 10);
+    const bool isNumber = end != value && *end == '\0';
+
+    switch (var->type & VALUE_MODE_MASK) {
+    case MODE_LOOKUP: {
+        const lookupTableEntry_t *table = &lookupTables[var->config.lookup.tableIndex];
+        if (!isNumber) {
+            number = -1;
+            for (int i = 0; i < table->valueCount; i++) {
+                if (strcasecmp(value, table->values[i]) == 0) {
+                    number = i;
+                }
+            }
+        }
+        if (number < 0 || number >= table->valueCount) {
+            return SETTING_INVALID;
+        }
+        break;
+    }
+    case MODE_DIRECT:
+        if (!isNumber) {
+            return SETTING_INVALID;
+        }
+        switch (var->type & VALUE_TYPE_MASK) {
+        case VAR_UINT32:
+            if (number < 0 || number > var->config.u32Max) {
+                return SETTING_INVALID;
+            }
+            break;
+        case VAR_INT8:
+        case VAR_INT16:
+            if (number < var->config.minmax.min || number > var->config.minmax.max) {
+                return SETTING_INVALID;
+            }
+            break;
+        default:
+            if (number < var->config.minmaxUnsigned.min || number > var->config.minmaxUnsigned.max) {
+                return SETTING_INVALID;
+            }
+            break;
+        }
+        break;
+    default:
+        // arrays, bitsets and strings don't change the filters
+        return SETTING_NOT_REPLAYED;
+    }
+
+    uint8_t *ptr = pg->address + var->offset;
+    switch (var->type & VALUE_TYPE_MASK) {
+    case VAR_UINT8:
+    case VAR_INT8:
+        *(uint8_t *)ptr = number;
+        break;
+    case VAR_UINT16:
+    case VAR_INT16:
+        *(uint16_t *)ptr = number;
+        break;
+    case VAR_UINT32:
+        *(uint32_t *)ptr = number;
+        break;
+    }
+    return SETTING_OK;
+}
+
+static bool applyConfig(const replayConfig_t *config)
+{
+    pgResetAll();
+
+    // eRPM is only logged with bidirectional DShot on
+    motorConfigMutable()->dev.useDshotTelemetry = logData.hasErpm;
+
+    // The logged settings are applied quietly, most of them aren't used by the replay
+    for (const setting_t &setting : logData.headerSettings) {
+        applySetting(setting.name.c_str(), setting.value.c_str());
+    }
+    if (logData.dynamicFilterFeature >= 0) {
+        if (logData.dynamicFilterFeature) {
+            featureEnableImmediate(FEATURE_DYNAMIC_FILTER);
+        } else {
+            featureDisableImmediate(FEATURE_DYNAMIC_FILTER);
+        }
+    }
+
+    bool ok = true;
+    for (const setting_t &setting : config->settings) {
+        if (setting.name == "feature") {
+            const bool disable = setting.value[0] == '-';
+            if (strcasecmp(setting.value.c_str() + disable, "DYNAMIC_FILTER") != 0) {
+                fprintf(stderr, "%s:%d: only feature DYNAMIC_FILTER is replayed\n", config->path.c_str(), setting.line);
+                ok = false;
+            } else if (disable) {
+                featureDisableImmediate(FEATURE_DYNAMIC_FILTER);
+            } else {
+                featureEnableImmediate(FEATURE_DYNAMIC_FILTER);
+            }
+            continue;
+        }
+
+        switch (applySetting(setting.name.c_str(), setting.value.c_str())) {
+        case SETTING_OK:
+            break;
+        case SETTING_UNKNOWN:
+            fprintf(stderr, "%s:%d: unknown setting %s\n", config->path.c_str(), setting.line, setting.name.c_str());
+            ok = false;
+            break;
+        case SETTING_NOT_REPLAYED:
+            fprintf(stderr, "%s:%d: %s is not used by the replay\n", config->path.c_str(), setting.line, setting.name.c_str());
+            ok = false;
+            break;
+        case SETTING_INVALID:
+            fprintf(stderr, "%s:%d: invalid value for %s: %s\n", config->path.c_str(), setting.line, setting.name.c_str(), setting.value.c_str());
+            ok = false;
+            break;
+        }
+    }
+
+    // The RPM filter can only run on the telemetry that was logged
+    if (!logData.hasErpm) {
+        motorConfigMutable()->dev.useDshotTelemetry = false;
+    }
+
+    return ok;
+}
+
+static bool loadConfigFile(const char *path, replayConfig_t *config)
+{
+    FILE *file = fopen(path, "r");
+    if (!file) {
+        fprintf(stderr, "%s: can't read %s\n", TOOL_NAME, path);
+        return false;
+    }
+
+    std::string name = path;
+    const size_t slash = name.find_last_of('/');
+    if (slash != std::string::npos) {
+        name = name.substr(slash + 1);
+    }
+    const size_t dot = name.find_last_of('.');
+    if (dot != std::string::npos && dot > 0) {
+        name = name.substr(0, dot);
+    }
+    config->name = name;
+    config->path = path;
+
+    bool ok = true;
+    char line[256];
+    int lineNumber = 0;
+    while (fgets(line, sizeof(line), file)) {
+        lineNumber++;
+        char *saveptr;
+        const char *command = strtok_r(line, " \t\r\n", &saveptr);
+        if (!command || command[0] == '#') {
+            continue;
+        }
+        if (strcasecmp(command, "set") == 0) {
+            const char *settingName = strtok_r(NULL, " \t=\r\n", &saveptr);
+            const char *value = strtok_r(NULL, " \t=\r\n", &saveptr);
+            if (settingName && value) {
+                config->settings.push_back({ settingName, value, lineNumber });
+                continue;
+            }
+        } else if (strcasecmp(command, "feature") == 0) {
+            const char *feature = strtok_r(NULL, " \t\r\n", &saveptr);
+            if (feature) {
+                config->settings.push_back({ "feature", feature, lineNumber });
+                continue;
+            }
+        }
+        fprintf(stderr, "%s:%d: expected \"set <name> = <value>\" or \"feature [-]<name>\"\n", path, lineNumber);
+        ok = false;
+    }
+    fclose(file);
+    return ok;
+}
+
+// Fake gyro driver, returns the logged sample for the current loop
+static bool replayGyroRead(gyroDev_t *gyroDev)
+{
+    gyroDev->gyroADCRaw[X] = logData.gyro[X][replayIndex];
+    gyroDev->gyroADCRaw[Y] = logData.gyro[Y][replayIndex];
+    gyroDev->gyroADCRaw[Z] = logData.gyro[Z][replayIndex];
+    return true;
+}
+
+static void initFlightCode(void)
+{
+    gyroConfigMutable()->gyro_to_use = GYRO_CONFIG_USE_GYRO_1;
+    gyroInit();
+
+    // run every stage on every logged sample, at the logged rate
+    gyro.sampleRateHz = 1000000 / logData.intervalUs;
+    gyroSetTargetLooptime(1);
+    gyro.sampleLooptime = logData.intervalUs;
+    gyro.targetLooptime = logData.intervalUs;
+    gyroInitFilters();
+
+    gyroSensor_t *gyroSensor = &gyro.gyroSensor1;
+    gyroSensor->gyroDev.readFn = replayGyroRead;
+    gyroSensor->gyroDev.scale = logData.gyroScale;
+    gyroSensor->calibration.cyclesRemaining = 0;
+
+    currentPidProfile = pidProfilesMutable(0);
+    switch (logData.motorCount) {
+    case 6:
+        mixerInit(MIXER_HEX6X);
+        break;
+    case 8:
+        mixerInit(MIXER_OCTOX8);
+        break;
+    default:
+        mixerInit(MIXER_QUADX);
+        break;
+    }
+    mixerConfigureOutput();
+    pidInit(currentPidProfile);
+    pidStabilisationState(PID_STABILISATION_ON);
+
+    ENABLE_ARMING_FLAG(ARMED);
+}
+
+static double nowSeconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Sets the state of a biquadFilterApply() filter to where a constant input of value leaves it
+static void biquadFilterSettle(biquadFilter_t *filter, float value)
+{
+    filter->x1 = value * (1 - filter->b0);
+    filter->x2 = value * (filter->b2 - filter->a2);
+}
+
+// Two passes of a biquad lowpass, forwards and backwards, to get a smoothed signal with no delay
+static std::vector<float> zeroPhaseLowpass(const std::vector<float> &signal)
+{
+    std::vector<float> smoothed(signal.size());
+    biquadFilter_t filter;
+
+    biquadFilterInitLPF(&filter, REFERENCE_CUTOFF_HZ, logData.intervalUs);
+    biquadFilterSettle(&filter, signal.front());
+    for (size_t i = 0; i < signal.size(); i++) {
+        smoothed[i] = biquadFilterApply(&filter, signal[i]);
+    }
+
+    biquadFilterInitLPF(&filter, REFERENCE_CUTOFF_HZ, logData.intervalUs);
+    biquadFilterSettle(&filter, smoothed.back());
+    for (size_t i = signal.size(); i-- > 0; ) {
+        smoothed[i] = biquadFilterApply(&filter, smoothed[i]);
+    }
+    return smoothed;
+}
+
+// The RMS difference between a and b delayed by lag, which must be no more than start
+static double rms(const std::vector<float> &a, const std::vector<float> &b, size_t start, int lag)
+{
+    double sum = 0;
+    for (size_t i = start; i < a.size(); i++) {
+        const double diff = a[i] - b[i - lag];
+        sum += diff * diff;
+    }
+    return sqrt(sum / (a.size() - start));
+}
+
+// The delay of signal behind reference, in samples, where the reference delayed by it is the closest fit. Every lag
+// is compared over the same samples so that the fit isn't biased towards the lags with fewer samples to compare.
+static float delaySamples(const std::vector<float> &signal, const std::vector<float> &reference, size_t start)
+{
+    const int maxLag = MIN(MAX_DELAY_MS * 1000 / logData.intervalUs, start);
+    std::vector<double> error(maxLag + 1);
+
+    int best = 0;
+    for (int lag = 0; lag <= maxLag; lag++) {
+        double sum = 0;
+        for (size_t i = start; i < signal.size(); i++) {
+            const double diff = signal[i] - reference[i - lag];
+            sum += diff * diff;
+        }
+        error[lag] = sum;
+        if (error[lag] < error[best]) {
+            best = lag;
+        }
+    }
+
+    // fit a parabola through the best lag and its neighbours
+    if (best > 0 && best < maxLag) {
+        const double left = error[best - 1];
+        const double right = error[best + 1];
+        const double denominator = left - 2 * error[best] + right;
+        if (denominator > 0) {
+            return best + 0.5 * (left - right) / denominator;
+        }
+    }
+    return best;
+}
+
+static bool writeTraces(const char *path, const std::vector<float> *filtered, const std::vector<float> *dterm)
+{
+    FILE *file = fopen(path, "w");
+    if (!file) {
+        fprintf(stderr, "%s: can't write %s\n", TOOL_NAME, path);
+        return false;
+    }
+    fprintf(file, "time_us,gyroRaw[0],gyroRaw[1],gyroRaw[2],gyroFiltered[0],gyroFiltered[1],gyroFiltered[2],dterm[0],dterm[1],dterm[2]\n");
+    for (uint32_t i = 0; i < logData.sampleCount; i++) {
+        fprintf(file, "%u", (unsigned)logData.timeUs[i]);
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            fprintf(file, ",%.2f", logData.gyro[axis][i] * logData.gyroScale);
+        }
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            fprintf(file, ",%.2f", filtered[axis][i]);
+        }
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            fprintf(file, ",%.2f", dterm[axis][i]);
+        }
+        fprintf(file, "\n");
+    }
+    fclose(file);
+    return true;
+}
+
+static bool replay(const replayConfig_t *config, const char *outDir, replayResult_t *result)
+{
+    applyConfig(config);
+    initFlightCode();
+
+    std::vector<float> raw[XYZ_AXIS_COUNT];
+    std::vector<float> filtered[XYZ_AXIS_COUNT];
+    std::vector<float> dterm[XYZ_AXIS_COUNT];
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        raw[axis].resize(logData.sampleCount);
+        filtered[axis].resize(logData.sampleCount);
+        dterm[axis].resize(logData.sampleCount);
+    }
+
+    // the same order as taskGyroSample/taskFiltering/taskMainPidLoop with pid_process_denom 1
+    const double startSeconds = nowSeconds();
+    simulatedTimeUs = logData.timeUs[0];
+    for (replayIndex = 0; replayIndex < logData.sampleCount; replayIndex++) {
+        simulatedTimeUs += logData.intervalUs;
+        gyroUpdate();
+        gyroFiltering(simulatedTimeUs);
+        pidController(currentPidProfile, simulatedTimeUs);
+
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            filtered[axis][replayIndex] = gyro.gyroADCf[axis];
+            dterm[axis][replayIndex] = pidData[axis].D;
+        }
+    }
+    result->replaySeconds = nowSeconds() - startSeconds;
+    result->sampleCount = logData.sampleCount;
+
+    const size_t start = MIN(SETTLE_TIME_US / logData.intervalUs, logData.sampleCount / 2);
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        for (uint32_t i = 0; i < logData.sampleCount; i++) {
+            raw[axis][i] = logData.gyro[axis][i] * logData.gyroScale;
+        }
+        const std::vector<float> reference = zeroPhaseLowpass(raw[axis]);
+        const float delay = delaySamples(filtered[axis], reference, start);
+
+        result->delayMs[axis] = delay * logData.intervalUs * 1e-3f;
+        result->noiseRms[axis] = rms(filtered[axis], reference, start, lrintf(delay));
+        result->rawNoiseRms[axis] = rms(raw[axis], reference, start, 0);
+
+        double sum = 0;
+        for (size_t i = start; i < logData.sampleCount; i++) {
+            sum += dterm[axis][i] * dterm[axis][i];
+        }
+        result->dtermRms[axis] = sqrt(sum / (logData.sampleCount - start));
+    }
+
+    if (outDir) {
+        const std::string path = std::string(outDir) + "/" + config->name + ".csv";
+        if (!writeTraces(path.c_str(), filtered, dterm)) {
+            return false;
+        }
+    }
+
+    result->done = true;
+    return true;
+}
+
+static void printAxes(const char *name, const float *values)
+{
+    printf(",\"%s\":[%.3f,%.3f,%.3f]", name, values[X], values[Y], values[Z]);
+}
+
+static void printResult(const replayConfig_t *config, const replayResult_t *result)
+{
+    const double loggedSeconds = (double)result->sampleCount * logData.intervalUs * 1e-6;
+    printf("{\"tool\":\"%s\",\"config\":\"%s\",\"samples\":%u,\"sample_rate_hz\":%u,\"realtime_factor\":%.1f",
+        TOOL_NAME, config->name.c_str(), (unsigned)result->sampleCount, (unsigned)(1000000 / logData.intervalUs),
+        loggedSeconds / result->replaySeconds);
+    printAxes("delay_ms", result->delayMs);
+    printAxes("noise_rms", result->noiseRms);
+    printAxes("raw_noise_rms", result->rawNoiseRms);
+    printAxes("dterm_rms", result->dtermRms);
+    printf("}\n");
+}
+
+static void usage(void)
+{
+    fprintf(stderr, "usage: %s [-j jobs] [-o outdir] log.bbl [config.txt ...]\n", TOOL_NAME);
+}
+
+int main(int argc, char **argv)
+{
+    long jobs = sysconf(_SC_NPROCESSORS_ONLN);
+    const char *outDir = NULL;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "j:o:")) != -1) {
+        switch (opt) {
+        case 'j':
+            jobs = atol(optarg);
+            break;
+        case 'o':
+            outDir = optarg;
+            break;
+        default:
+            usage();
+            return 1;
+        }
+    }
+    if (optind >= argc || jobs < 1) {
+        usage();
+        return 1;
+    }
+
+    if (!loadLog(argv[optind])) {
+        return 1;
+    }
+
+    std::vector<replayConfig_t> configs(1);
+    configs[0].name = LOGGED_CONFIG_NAME;
+    configs[0].path = argv[optind];
+    bool ok = true;
+    for (int i = optind + 1; i < argc; i++) {
+        configs.push_back(replayConfig_t());
+        ok &= loadConfigFile(argv[i], &configs.back());
+    }
+
+    // check every configuration before starting the replays
+    for (const replayConfig_t &config : configs) {
+        ok &= applyConfig(&config);
+    }
+    if (!ok) {
+        return 1;
+    }
+
+    replayResult_t *results = (replayResult_t *)mmap(NULL, configs.size() * sizeof(replayResult_t),
+        PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (results == MAP_FAILED) {
+        perror(TOOL_NAME);
+        return 1;
+    }
+    memset(results, 0, configs.size() * sizeof(replayResult_t));
+
+    // Each replay runs in its own process, the flight code keeps its state in globals
+    fflush(stdout);
+    long running = 0;
+    for (size_t i = 0; i < configs.size(); i++) {
+        if (running == jobs) {
+            wait(NULL);
+            running--;
+        }
+        const pid_t pid = fork();
+        if (pid < 0) {
+            perror(TOOL_NAME);
+            break;
+        }
+        if (pid == 0) {
+            _exit(replay(&configs[i], outDir, &results[i]) ? 0 : 1);
+        }
+        running++;
+    }
+    while (running > 0 && wait(NULL) > 0) {
+        running--;
+    }
+
+    int status = 0;
+    for (size_t i = 0; i < configs.size(); i++) {
+        if (results[i].done) {
+            printResult(&configs[i], &results[i]);
+        } else {
+            fprintf(stderr, "%s: replay of %s failed\n", TOOL_NAME, configs[i].name.c_str());
+            status = 1;
+        }
+    }
+    munmap(results, configs.size() * sizeof(replayResult_t));
+    return status;
+}
+
+// STUBS
+
+extern "C" {
+
+PG_REGISTER(accelerometerConfig_t, accelerometerConfig, PG_ACCELEROMETER_CONFIG, 0);
+PG_REGISTER(rxConfig_t, rxConfig, PG_RX_CONFIG, 0);
+PG_REGISTER(flight3DConfig_t, flight3DConfig, PG_MOTOR_3D_CONFIG, 0);
+
+pidProfile_t *currentPidProfile;
+static controlRateConfig_t controlRateProfile;
+controlRateConfig_t *currentControlRateProfile = &controlRateProfile;
+
+uint8_t detectedSensors[SENSOR_INDEX_COUNT];
+attitudeEulerAngles_t attitude;
+acc_t acc;
+int16_t rcData[MAX_SUPPORTED_RC_CHANNEL_COUNT];
+float rcCommand[4];
+bool cliMode = false;
+
+uint32_t micros(void) { return simulatedTimeUs; }
+uint32_t millis(void) { return simulatedTimeUs / 1000; }
+timeDelta_t getGyroUpdateRate(void) { return gyro.targetLooptime; }
+void schedulerResetTaskStatistics(taskId_e) {}
+void writeEEPROM(void) {}
+void systemBeep(bool) {}
+void beeperConfirmationBeeps(uint8_t) {}
+void disarm(flightLogDisarmReason_e) {}
+
+uint16_t getDshotTelemetry(uint8_t index)
+{
+    return index < logData.motorCount ? logData.erpm[index][replayIndex] : 0;
+}
+
+float getSetpointRate(int axis) { return logData.setpoint[axis][replayIndex]; }
+float getRcDeflection(int axis) { return getSetpointRate(axis) / 670.0f; }
+float getRcDeflectionAbs(int axis) { return fabsf(getRcDeflection(axis)); }
+float getThrottlePIDAttenuation(void) { return 1.0f; }
+bool isAirmodeActivated(void) { return true; }
+bool airmodeIsEnabled(void) { return true; }
+bool isFlipOverAfterCrashActive(void) { return false; }
+bool isLaunchControlActive(void) { return false; }
+float calculateVbatPidCompensation(void) { return 1.0f; }
+uint8_t calculateThrottlePercentAbs(void) { return 50; }
+bool isMotorProtocolDshot(void) { return true; }
+void motorInitEndpoints(const motorConfig_t *, float outputLimit, float *outputLow, float *outputHigh, float *disarm, float *deadbandMotor3DHigh, float *deadbandMotor3DLow)
+{
+    *outputLow = DSHOT_MIN_THROTTLE;
+    *outputHigh = DSHOT_MIN_THROTTLE + (DSHOT_MAX_THROTTLE - DSHOT_MIN_THROTTLE) * outputLimit;
+    *disarm = DSHOT_CMD_MOTOR_STOP;
+    *deadbandMotor3DHigh = DSHOT_3D_FORWARD_MIN_THROTTLE;
+    *deadbandMotor3DLow = DSHOT_3D_FORWARD_MIN_THROTTLE - 1;
+}
+float motorConvertFromExternal(uint16_t externalValue) { return externalValue; }
+uint16_t motorConvertToExternal(float motorValue) { return motorValue; }
+void motorWriteAll(float *) {}
+void beeper(beeperMode_e) {}
+void delay(uint32_t) {}
+bool IS_RC_MODE_ACTIVE(boxId_e) { return false; }
+bool failsafeIsActive(void) { return false; }
+bool isMotorsReversed(void) { return false; }
+void mixerTricopterInit(void) {}
+float mixerTricopterMotorCorrection(int) { return 0; }
+void dshotSetPidLoopTime(uint32_t) {}
+uint32_t getRcFrameNumber(void) { return simulatedTimeUs / 4000; }
+void interpolatedSpInit(const pidProfile_t *) {}
+float interpolatedSpApply(int, bool, ffInterpolationType_t) { return 0; }
+float applyFfLimit(int, float value, float, float) { return value; }
+bool shouldApplyFfLimits(int) { return false; }
+
+}
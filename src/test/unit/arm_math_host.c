@@ -0,0 +1,191 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Portable implementation of the CMSIS-DSP entry points used by
+// flight/gyroanalyse.c. Results match CMSIS (including the 0.5 scaling
+// applied by stage_rfft_f32), but the complex FFT is a plain radix-2
+// transform which leaves its output in natural order, so the bit reversal
+// step is a no-op.
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "arm_math.h"
+
+#define HOST_FFT_MAX_LENGTH 128
+
+static float32_t cfftTwiddle[HOST_FFT_MAX_LENGTH];
+static float32_t rfftTwiddle[HOST_FFT_MAX_LENGTH];
+
+arm_status arm_rfft_fast_init_f32(arm_rfft_fast_instance_f32 *S, uint16_t fftLen)
+{
+    if (fftLen > HOST_FFT_MAX_LENGTH || (fftLen & (fftLen - 1)) != 0) {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    const uint16_t cfftLen = fftLen / 2;
+
+    for (int i = 0; i < cfftLen; i++) {
+        cfftTwiddle[2 * i] = cosf(2 * M_PI * i / cfftLen);
+        cfftTwiddle[2 * i + 1] = sinf(2 * M_PI * i / cfftLen);
+        // the CMSIS real FFT table holds sin, cos pairs
+        rfftTwiddle[2 * i] = sinf(2 * M_PI * i / fftLen);
+        rfftTwiddle[2 * i + 1] = cosf(2 * M_PI * i / fftLen);
+    }
+
+    S->fftLenRFFT = fftLen;
+    S->pTwiddleRFFT = rfftTwiddle;
+    S->Sint.fftLen = cfftLen;
+    S->Sint.pTwiddle = cfftTwiddle;
+    S->Sint.pBitRevTable = NULL;
+    S->Sint.bitRevLength = 0;
+
+    return ARM_MATH_SUCCESS;
+}
+
+// in place forward complex FFT, output in natural order
+static void hostCfft(float32_t *p, uint16_t fftLen, const float32_t *pCoef, uint16_t twidCoefModifier)
+{
+    for (unsigned i = 1, j = 0; i < fftLen; i++) {
+        unsigned bit = fftLen >> 1;
+        for (; j & bit; bit >>= 1) {
+            j ^= bit;
+        }
+        j ^= bit;
+        if (i < j) {
+            float32_t t = p[2 * i];
+            p[2 * i] = p[2 * j];
+            p[2 * j] = t;
+            t = p[2 * i + 1];
+            p[2 * i + 1] = p[2 * j + 1];
+            p[2 * j + 1] = t;
+        }
+    }
+
+    for (unsigned len = 2; len <= fftLen; len <<= 1) {
+        const unsigned twiddleStep = (fftLen / len) * twidCoefModifier;
+        for (unsigned start = 0; start < fftLen; start += len) {
+            for (unsigned k = 0; k < len / 2; k++) {
+                const float32_t wr = pCoef[2 * k * twiddleStep];
+                const float32_t wi = pCoef[2 * k * twiddleStep + 1];
+                float32_t *a = &p[2 * (start + k)];
+                float32_t *b = &p[2 * (start + k + len / 2)];
+                const float32_t tr = b[0] * wr + b[1] * wi;
+                const float32_t ti = b[1] * wr - b[0] * wi;
+                b[0] = a[0] - tr;
+                b[1] = a[1] - ti;
+                a[0] += tr;
+                a[1] += ti;
+            }
+        }
+    }
+}
+
+void arm_cfft_radix8by2_f32(arm_cfft_instance_f32 *S, float32_t *p1)
+{
+    hostCfft(p1, S->fftLen, S->pTwiddle, 1);
+}
+
+void arm_cfft_radix8by4_f32(arm_cfft_instance_f32 *S, float32_t *p1)
+{
+    hostCfft(p1, S->fftLen, S->pTwiddle, 1);
+}
+
+void arm_radix8_butterfly_f32(float32_t *pSrc, uint16_t fftLen, const float32_t *pCoef, uint16_t twidCoefModifier)
+{
+    hostCfft(pSrc, fftLen, pCoef, twidCoefModifier);
+}
+
+void arm_bitreversal_32(uint32_t *pSrc, const uint16_t bitRevLen, const uint16_t *pBitRevTable)
+{
+    for (unsigned i = 0; i + 1 < bitRevLen; i += 2) {
+        const unsigned a = pBitRevTable[i] >> 2;
+        const unsigned b = pBitRevTable[i + 1] >> 2;
+        uint32_t t = pSrc[a];
+        pSrc[a] = pSrc[b];
+        pSrc[b] = t;
+        t = pSrc[a + 1];
+        pSrc[a + 1] = pSrc[b + 1];
+        pSrc[b + 1] = t;
+    }
+}
+
+void stage_rfft_f32(arm_rfft_fast_instance_f32 *S, float32_t *p, float32_t *pOut)
+{
+    const float32_t *pCoeff = S->pTwiddleRFFT;
+    const float32_t *pA = p;
+    const float32_t *pB = p;
+
+    // pack first and last sample of the frequency domain together
+    float32_t xBR = pB[0];
+    float32_t xBI = pB[1];
+    float32_t xAR = pA[0];
+    float32_t xAI = pA[1];
+    pCoeff += 2;
+
+    float32_t t1a = xBR + xAR;
+    float32_t t1b = xBI + xAI;
+    *pOut++ = 0.5f * (t1a + t1b);
+    *pOut++ = 0.5f * (t1a - t1b);
+
+    uint32_t k = S->Sint.fftLen - 1;
+    pB = p + 2 * k;
+    pA += 2;
+
+    while (k > 0) {
+        xBR = pB[0];
+        xBI = pB[1];
+        xAR = pA[0];
+        xAI = pA[1];
+        const float32_t twR = *pCoeff++;
+        const float32_t twI = *pCoeff++;
+
+        t1a = xBR - xAR;
+        t1b = xBI + xAI;
+        const float32_t p0 = twR * t1a;
+        const float32_t p1 = twI * t1a;
+        const float32_t p2 = twR * t1b;
+        const float32_t p3 = twI * t1b;
+
+        *pOut++ = 0.5f * (xAR + xBR + p0 + p3);
+        *pOut++ = 0.5f * (xAI - xBI + p1 - p2);
+
+        pA += 2;
+        pB -= 2;
+        k--;
+    }
+}
+
+void arm_cmplx_mag_f32(float32_t *pSrc, float32_t *pDst, uint32_t numSamples)
+{
+    for (uint32_t i = 0; i < numSamples; i++) {
+        const float32_t real = pSrc[2 * i];
+        const float32_t imag = pSrc[2 * i + 1];
+        pDst[i] = sqrtf(real * real + imag * imag);
+    }
+}
+
+void arm_mult_f32(float32_t *pSrcA, float32_t *pSrcB, float32_t *pDst, uint32_t blockSize)
+{
+    for (uint32_t i = 0; i < blockSize; i++) {
+        pDst[i] = pSrcA[i] * pSrcB[i];
+    }
+}
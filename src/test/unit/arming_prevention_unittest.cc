@@ -1073,7 +1073,7 @@ extern "C" {
     int16_t calculateThrottleAngleCorrection(uint8_t) { return 0; }
     void processRcCommand(void) {}
     void updateGpsStateForHomeAndHoldMode(void) {}
-    void blackboxUpdate(timeUs_t) {}
+    void blackboxCapture(timeUs_t) {}
     void transponderUpdate(timeUs_t) {}
     void GPS_reset_home_position(void) {}
     void accStartCalibration(void) {}
@@ -0,0 +1,689 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "blackbox/blackbox.h"
+#include "blackbox/blackbox_fielddefs.h"
+
+#include "blackbox_decoder.h"
+
+static int32_t signExtend(uint32_t value, int bits)
+{
+    const uint32_t signBit = 1u << (bits - 1);
+    value &= (bits == 32) ? 0xFFFFFFFF : ((1u << bits) - 1);
+    return (int32_t)((value ^ signBit) - signBit);
+}
+
+static int32_t zigzagDecode(uint32_t value)
+{
+    return (int32_t)((value >> 1) ^ -(int32_t)(value & 1));
+}
+
+void blackboxDecoderInit(blackboxDecoder_t *decoder, const uint8_t *data, size_t length)
+{
+    memset(decoder, 0, sizeof(*decoder));
+    decoder->data = data;
+    decoder->length = length;
+    decoder->pInterval = 1;
+    decoder->motor0Index = -1;
+    decoder->timeIndex = -1;
+}
+
+uint8_t blackboxDecoderReadByte(blackboxDecoder_t *decoder)
+{
+    if (decoder->pos >= decoder->length) {
+        decoder->overrun = true;
+        return 0;
+    }
+    return decoder->data[decoder->pos++];
+}
+
+uint32_t blackboxDecoderReadUnsignedVB(blackboxDecoder_t *decoder)
+{
+    uint32_t value = 0;
+
+    // The encoder writes at most 5 bytes for a 32-bit value
+    for (int shift = 0; shift < 35; shift += 7) {
+        const uint8_t c = blackboxDecoderReadByte(decoder);
+        value |= (uint32_t)(c & 0x7F) << shift;
+        if (!(c & 0x80)) {
+            return value;
+        }
+    }
+
+    decoder->overrun = true;
+    return 0;
+}
+
+int32_t blackboxDecoderReadSignedVB(blackboxDecoder_t *decoder)
+{
+    return zigzagDecode(blackboxDecoderReadUnsignedVB(decoder));
+}
+
+int16_t blackboxDecoderReadS16(blackboxDecoder_t *decoder)
+{
+    const uint8_t low = blackboxDecoderReadByte(decoder);
+    const uint8_t high = blackboxDecoderReadByte(decoder);
+    return (int16_t)(low | (high << 8));
+}
+
+uint32_t blackboxDecoderReadU32(blackboxDecoder_t *decoder)
+{
+    uint32_t value = 0;
+    for (int i = 0; i < 4; i++) {
+        value |= (uint32_t)blackboxDecoderReadByte(decoder) << (i * 8);
+    }
+    return value;
+}
+
+float blackboxDecoderReadFloat(blackboxDecoder_t *decoder)
+{
+    const uint32_t bits = blackboxDecoderReadU32(decoder);
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+// Shared by the 32-bit layouts of TAG2_3S32 and TAG2_3SVARIABLE: two bits per field (first field in the low bits)
+// giving its size as 1, 2, 3 or 4 little-endian bytes.
+static void readTag2_3S32Bytes(blackboxDecoder_t *decoder, uint8_t sizes, int32_t *values)
+{
+    for (int i = 0; i < 3; i++) {
+        const int byteCount = (sizes & 0x03) + 1;
+        uint32_t value = 0;
+        for (int b = 0; b < byteCount; b++) {
+            value |= (uint32_t)blackboxDecoderReadByte(decoder) << (b * 8);
+        }
+        values[i] = signExtend(value, byteCount * 8);
+        sizes >>= 2;
+    }
+}
+
+void blackboxDecoderReadTag2_3S32(blackboxDecoder_t *decoder, int32_t *values)
+{
+    const uint8_t leadByte = blackboxDecoderReadByte(decoder);
+
+    switch (leadByte >> 6) {
+    case 0: // 2 bits per field
+        values[0] = signExtend(leadByte >> 4, 2);
+        values[1] = signExtend(leadByte >> 2, 2);
+        values[2] = signExtend(leadByte, 2);
+        break;
+    case 1: { // 4 bits per field
+        const uint8_t byte1 = blackboxDecoderReadByte(decoder);
+        values[0] = signExtend(leadByte, 4);
+        values[1] = signExtend(byte1 >> 4, 4);
+        values[2] = signExtend(byte1, 4);
+        break;
+    }
+    case 2: // 6 bits per field
+        values[0] = signExtend(leadByte, 6);
+        values[1] = signExtend(blackboxDecoderReadByte(decoder), 6);
+        values[2] = signExtend(blackboxDecoderReadByte(decoder), 6);
+        break;
+    default:
+        readTag2_3S32Bytes(decoder, leadByte, values);
+        break;
+    }
+}
+
+void blackboxDecoderReadTag2_3SVariable(blackboxDecoder_t *decoder, int32_t *values)
+{
+    const uint8_t leadByte = blackboxDecoderReadByte(decoder);
+
+    switch (leadByte >> 6) {
+    case 0: // 2 bits per field
+        values[0] = signExtend(leadByte >> 4, 2);
+        values[1] = signExtend(leadByte >> 2, 2);
+        values[2] = signExtend(leadByte, 2);
+        break;
+    case 1: { // 5, 5 and 4 bits
+        const uint8_t byte1 = blackboxDecoderReadByte(decoder);
+        values[0] = signExtend(leadByte >> 1, 5);
+        values[1] = signExtend(((leadByte & 0x01) << 4) | (byte1 >> 4), 5);
+        values[2] = signExtend(byte1, 4);
+        break;
+    }
+    case 2: { // 8, 7 and 7 bits
+        const uint8_t byte1 = blackboxDecoderReadByte(decoder);
+        const uint8_t byte2 = blackboxDecoderReadByte(decoder);
+        values[0] = signExtend(((leadByte & 0x3F) << 2) | (byte1 >> 6), 8);
+        values[1] = signExtend(((byte1 & 0x3F) << 1) | (byte2 >> 7), 7);
+        values[2] = signExtend(byte2, 7);
+        break;
+    }
+    default:
+        readTag2_3S32Bytes(decoder, leadByte, values);
+        break;
+    }
+}
+
+void blackboxDecoderReadTag8_4S16(blackboxDecoder_t *decoder, int32_t *values)
+{
+    uint8_t selector = blackboxDecoderReadByte(decoder);
+    uint8_t buffer = 0;
+    bool haveNibble = false;
+
+    // Fields are packed as a stream of nibbles, high nibble of each byte first
+    for (int i = 0; i < 4; i++) {
+        int nibbleCount;
+        switch (selector & 0x03) {
+        case 0:
+            nibbleCount = 0;
+            break;
+        case 1:
+            nibbleCount = 1;
+            break;
+        case 2:
+            nibbleCount = 2;
+            break;
+        default:
+            nibbleCount = 4;
+            break;
+        }
+
+        uint32_t value = 0;
+        for (int n = 0; n < nibbleCount; n++) {
+            if (haveNibble) {
+                value = (value << 4) | (buffer & 0x0F);
+                haveNibble = false;
+            } else {
+                buffer = blackboxDecoderReadByte(decoder);
+                value = (value << 4) | (buffer >> 4);
+                haveNibble = true;
+            }
+        }
+        values[i] = nibbleCount ? signExtend(value, nibbleCount * 4) : 0;
+
+        selector >>= 2;
+    }
+}
+
+void blackboxDecoderReadTag8_8SVB(blackboxDecoder_t *decoder, int32_t *values, int valueCount)
+{
+    if (valueCount == 1) {
+        values[0] = blackboxDecoderReadSignedVB(decoder);
+        return;
+    }
+
+    const uint8_t header = blackboxDecoderReadByte(decoder);
+    for (int i = 0; i < valueCount; i++) {
+        values[i] = (header & (1 << i)) ? blackboxDecoderReadSignedVB(decoder) : 0;
+    }
+}
+
+static uint32_t readBits(blackboxDecoder_t *decoder, int bitCount)
+{
+    uint32_t value = 0;
+
+    while (bitCount > 0) {
+        if (decoder->bitCount == 0) {
+            decoder->bitBuffer = blackboxDecoderReadByte(decoder);
+            decoder->bitCount = 8;
+        }
+        const int take = bitCount < decoder->bitCount ? bitCount : decoder->bitCount;
+        const uint8_t bits = (decoder->bitBuffer >> (decoder->bitCount - take)) & ((1 << take) - 1);
+        value = (value << take) | bits;
+        decoder->bitCount -= take;
+        bitCount -= take;
+    }
+
+    return value;
+}
+
+void blackboxDecoderReadBitPackedGroup(blackboxDecoder_t *decoder, int32_t *values, int valueCount)
+{
+    if (valueCount <= 0) {
+        return;
+    }
+
+    int width = readBits(decoder, 5);
+    if (width == 31) {
+        width = 32;
+    }
+    for (int i = 0; i < valueCount; i++) {
+        values[i] = width ? zigzagDecode(readBits(decoder, width)) : 0;
+    }
+}
+
+void blackboxDecoderAlignToByte(blackboxDecoder_t *decoder)
+{
+    decoder->bitCount = 0;
+}
+
+static int findHeader(const blackboxDecoder_t *decoder, const char *name)
+{
+    for (int i = 0; i < decoder->headerCount; i++) {
+        if (strcmp(decoder->headerName[i], name) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+const char *blackboxDecoderGetHeader(const blackboxDecoder_t *decoder, const char *name)
+{
+    const int index = findHeader(decoder, name);
+    return index >= 0 ? decoder->headerValue[index] : NULL;
+}
+
+int blackboxDecoderFieldIndex(const blackboxDecoderFieldDefs_t *defs, const char *name)
+{
+    for (int i = 0; i < defs->count; i++) {
+        if (strcmp(defs->name[i], name) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static blackboxDecoderFieldDefs_t *fieldDefsForFrame(blackboxDecoder_t *decoder, char frameType)
+{
+    switch (frameType) {
+    case 'I':
+        return &decoder->mainI;
+    case 'P':
+        return &decoder->mainP;
+    case 'S':
+        return &decoder->slow;
+    case 'H':
+        return &decoder->gpsH;
+    case 'G':
+        return &decoder->gpsG;
+    default:
+        return NULL;
+    }
+}
+
+// Parse one "H Field <frame> <property>:a,b,c" line into the field definitions of that frame type
+static bool parseFieldHeader(blackboxDecoder_t *decoder, const char *name, const char *value)
+{
+    // name is "Field X property"
+    if (strlen(name) < 9 || name[7] != ' ') {
+        return false;
+    }
+    blackboxDecoderFieldDefs_t *defs = fieldDefsForFrame(decoder, name[6]);
+    if (!defs) {
+        return false;
+    }
+    const char *property = name + 8;
+
+    int count = 0;
+    const char *p = value;
+    while (*p && count < BLACKBOX_DECODER_MAX_FIELDS) {
+        const char *end = strchr(p, ',');
+        const size_t length = end ? (size_t)(end - p) : strlen(p);
+
+        if (strcmp(property, "name") == 0) {
+            const size_t copyLength = length < BLACKBOX_DECODER_MAX_NAME_LENGTH - 1 ? length : BLACKBOX_DECODER_MAX_NAME_LENGTH - 1;
+            memcpy(defs->name[count], p, copyLength);
+            defs->name[count][copyLength] = '\0';
+        } else if (strcmp(property, "signed") == 0) {
+            defs->isSigned[count] = atoi(p);
+        } else if (strcmp(property, "predictor") == 0) {
+            defs->predictor[count] = atoi(p);
+        } else if (strcmp(property, "encoding") == 0) {
+            defs->encoding[count] = atoi(p);
+        } else {
+            return false;
+        }
+
+        count++;
+        p = end ? end + 1 : p + length;
+    }
+
+    if (strcmp(property, "name") == 0) {
+        defs->count = count;
+        // P frames carry the same fields as I frames, only their predictors and encodings differ
+        if (defs == &decoder->mainI) {
+            decoder->mainP.count = count;
+            memcpy(decoder->mainP.name, decoder->mainI.name, sizeof(decoder->mainI.name));
+            memcpy(decoder->mainP.isSigned, decoder->mainI.isSigned, sizeof(decoder->mainI.isSigned));
+        }
+    } else if (strcmp(property, "signed") == 0 && defs == &decoder->mainI) {
+        memcpy(decoder->mainP.isSigned, decoder->mainI.isSigned, sizeof(decoder->mainI.isSigned));
+    }
+
+    return true;
+}
+
+bool blackboxDecoderReadHeaders(blackboxDecoder_t *decoder)
+{
+    while (decoder->pos + 2 <= decoder->length && decoder->data[decoder->pos] == 'H' && decoder->data[decoder->pos + 1] == ' ') {
+        const char *line = (const char *)decoder->data + decoder->pos + 2;
+        const char *lineEnd = memchr(line, '\n', decoder->length - decoder->pos - 2);
+        if (!lineEnd) {
+            return false;
+        }
+        const char *colon = memchr(line, ':', lineEnd - line);
+        if (!colon) {
+            return false;
+        }
+        decoder->pos = (const uint8_t *)lineEnd + 1 - decoder->data;
+
+        char name[BLACKBOX_DECODER_MAX_NAME_LENGTH];
+        char value[BLACKBOX_DECODER_MAX_FIELDS * BLACKBOX_DECODER_MAX_NAME_LENGTH];
+        const size_t nameLength = colon - line;
+        const size_t valueLength = lineEnd - colon - 1;
+        if (nameLength >= sizeof(name) || valueLength >= sizeof(value)) {
+            return false;
+        }
+        memcpy(name, line, nameLength);
+        name[nameLength] = '\0';
+        memcpy(value, colon + 1, valueLength);
+        value[valueLength] = '\0';
+
+        if (strncmp(name, "Field ", 6) == 0) {
+            if (!parseFieldHeader(decoder, name, value)) {
+                return false;
+            }
+            continue;
+        }
+
+        int index = findHeader(decoder, name);
+        if (index < 0) {
+            if (decoder->headerCount >= BLACKBOX_DECODER_MAX_HEADERS) {
+                continue;
+            }
+            index = decoder->headerCount++;
+        }
+        snprintf(decoder->headerName[index], BLACKBOX_DECODER_MAX_NAME_LENGTH, "%s", name);
+        snprintf(decoder->headerValue[index], BLACKBOX_DECODER_MAX_HEADER_LENGTH, "%.*s", BLACKBOX_DECODER_MAX_HEADER_LENGTH - 1, value);
+    }
+
+    const char *header;
+    if ((header = blackboxDecoderGetHeader(decoder, "minthrottle"))) {
+        decoder->minthrottle = atoi(header);
+    }
+    if ((header = blackboxDecoderGetHeader(decoder, "motorOutput"))) {
+        decoder->minmotor = atoi(header);
+    }
+    if ((header = blackboxDecoderGetHeader(decoder, "vbatref"))) {
+        decoder->vbatref = atoi(header);
+    }
+    if ((header = blackboxDecoderGetHeader(decoder, "P interval"))) {
+        decoder->pInterval = atoi(header);
+    }
+    decoder->motor0Index = blackboxDecoderFieldIndex(&decoder->mainI, "motor[0]");
+    decoder->timeIndex = blackboxDecoderFieldIndex(&decoder->mainI, "time");
+
+    return decoder->mainI.count > 0;
+}
+
+static bool sameBaseName(const char *a, const char *b)
+{
+    const size_t lengthA = strcspn(a, "[");
+    const size_t lengthB = strcspn(b, "[");
+    return lengthA == lengthB && strncmp(a, b, lengthA) == 0;
+}
+
+// Read the raw (still predicted) values of every field of a frame, following the encodings in defs
+static void readFrameValues(blackboxDecoder_t *decoder, const blackboxDecoderFieldDefs_t *defs, int32_t *values)
+{
+    int i = 0;
+
+    while (i < defs->count) {
+        const uint8_t encoding = defs->encoding[i];
+
+        if (encoding != FLIGHT_LOG_FIELD_ENCODING_BITPACKED) {
+            blackboxDecoderAlignToByte(decoder);
+        }
+
+        switch (encoding) {
+        case FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB:
+            values[i++] = blackboxDecoderReadSignedVB(decoder);
+            break;
+        case FLIGHT_LOG_FIELD_ENCODING_UNSIGNED_VB:
+            values[i++] = blackboxDecoderReadUnsignedVB(decoder);
+            break;
+        case FLIGHT_LOG_FIELD_ENCODING_NEG_14BIT:
+            values[i++] = -signExtend(blackboxDecoderReadUnsignedVB(decoder), 14);
+            break;
+        case FLIGHT_LOG_FIELD_ENCODING_NULL:
+            values[i++] = 0;
+            break;
+        case FLIGHT_LOG_FIELD_ENCODING_TAG2_3S32:
+        case FLIGHT_LOG_FIELD_ENCODING_TAG2_3SVARIABLE:
+        case FLIGHT_LOG_FIELD_ENCODING_TAG8_4S16: {
+            // These always cover a fixed number of fields, the last ones may be past the end of the frame
+            const int groupSize = encoding == FLIGHT_LOG_FIELD_ENCODING_TAG8_4S16 ? 4 : 3;
+            int32_t group[4];
+            if (encoding == FLIGHT_LOG_FIELD_ENCODING_TAG2_3S32) {
+                blackboxDecoderReadTag2_3S32(decoder, group);
+            } else if (encoding == FLIGHT_LOG_FIELD_ENCODING_TAG2_3SVARIABLE) {
+                blackboxDecoderReadTag2_3SVariable(decoder, group);
+            } else {
+                blackboxDecoderReadTag8_4S16(decoder, group);
+            }
+            for (int j = 0; j < groupSize && i < defs->count; j++) {
+                values[i++] = group[j];
+            }
+            break;
+        }
+        case FLIGHT_LOG_FIELD_ENCODING_TAG8_8SVB: {
+            int groupSize = 1;
+            while (groupSize < 8 && i + groupSize < defs->count && defs->encoding[i + groupSize] == FLIGHT_LOG_FIELD_ENCODING_TAG8_8SVB) {
+                groupSize++;
+            }
+            blackboxDecoderReadTag8_8SVB(decoder, values + i, groupSize);
+            i += groupSize;
+            break;
+        }
+        case FLIGHT_LOG_FIELD_ENCODING_BITPACKED: {
+            // One group per array field, e.g. gyroADC[0..2]
+            int groupSize = 1;
+            while (i + groupSize < defs->count && defs->encoding[i + groupSize] == FLIGHT_LOG_FIELD_ENCODING_BITPACKED
+                && sameBaseName(defs->name[i], defs->name[i + groupSize])) {
+                groupSize++;
+            }
+            blackboxDecoderReadBitPackedGroup(decoder, values + i, groupSize);
+            i += groupSize;
+            break;
+        }
+        default:
+            decoder->overrun = true;
+            return;
+        }
+    }
+
+    blackboxDecoderAlignToByte(decoder);
+}
+
+// Add the prediction for each field to the raw values read from the log
+static void applyPredictions(blackboxDecoder_t *decoder, const blackboxDecoderFieldDefs_t *defs, int32_t *values,
+    const int32_t *previous, const int32_t *previous2, const int32_t *home)
+{
+    int homeIndex = 0;
+
+    for (int i = 0; i < defs->count; i++) {
+        uint32_t prediction;
+
+        switch (defs->predictor[i]) {
+        case FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS:
+            prediction = previous[i];
+            break;
+        case FLIGHT_LOG_FIELD_PREDICTOR_STRAIGHT_LINE:
+            prediction = 2 * (uint32_t)previous[i] - (uint32_t)previous2[i];
+            break;
+        case FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2:
+            prediction = defs->isSigned[i]
+                ? (uint32_t)(int32_t)(((int64_t)previous[i] + previous2[i]) / 2)
+                : (uint32_t)(((uint64_t)(uint32_t)previous[i] + (uint32_t)previous2[i]) / 2);
+            break;
+        case FLIGHT_LOG_FIELD_PREDICTOR_MINTHROTTLE:
+            prediction = decoder->minthrottle;
+            break;
+        case FLIGHT_LOG_FIELD_PREDICTOR_MOTOR_0:
+            prediction = decoder->motor0Index >= 0 ? values[decoder->motor0Index] : 0;
+            break;
+        case FLIGHT_LOG_FIELD_PREDICTOR_INC:
+            prediction = previous[i] + decoder->pInterval;
+            break;
+        case FLIGHT_LOG_FIELD_PREDICTOR_HOME_COORD:
+            prediction = home ? home[homeIndex] : 0;
+            homeIndex++;
+            break;
+        case FLIGHT_LOG_FIELD_PREDICTOR_1500:
+            prediction = 1500;
+            break;
+        case FLIGHT_LOG_FIELD_PREDICTOR_VBATREF:
+            prediction = decoder->vbatref;
+            break;
+        case FLIGHT_LOG_FIELD_PREDICTOR_LAST_MAIN_FRAME_TIME:
+            prediction = decoder->timeIndex >= 0 ? decoder->mainHistory[0][decoder->timeIndex] : 0;
+            break;
+        case FLIGHT_LOG_FIELD_PREDICTOR_MINMOTOR:
+            prediction = decoder->minmotor;
+            break;
+        default:
+            prediction = 0;
+            break;
+        }
+
+        values[i] = (int32_t)((uint32_t)values[i] + prediction);
+    }
+}
+
+static bool readMainFrame(blackboxDecoder_t *decoder, bool intraframe)
+{
+    const blackboxDecoderFieldDefs_t *defs = intraframe ? &decoder->mainI : &decoder->mainP;
+    int32_t values[BLACKBOX_DECODER_MAX_FIELDS];
+
+    // A P frame can only be decoded against the frames before it
+    if (!intraframe && !decoder->mainHistoryValid) {
+        return false;
+    }
+
+    readFrameValues(decoder, defs, values);
+    applyPredictions(decoder, defs, values, decoder->mainHistory[0], decoder->mainHistory[1], NULL);
+
+    if (intraframe) {
+        memcpy(decoder->mainHistory[1], values, sizeof(values));
+    } else {
+        memcpy(decoder->mainHistory[1], decoder->mainHistory[0], sizeof(values));
+    }
+    memcpy(decoder->mainHistory[0], values, sizeof(values));
+    decoder->mainHistoryValid = true;
+
+    return true;
+}
+
+static void readSimpleFrame(blackboxDecoder_t *decoder, const blackboxDecoderFieldDefs_t *defs, int32_t *values,
+    const int32_t *home)
+{
+    int32_t raw[BLACKBOX_DECODER_MAX_FIELDS];
+
+    readFrameValues(decoder, defs, raw);
+    applyPredictions(decoder, defs, raw, values, values, home);
+    memcpy(values, raw, sizeof(raw));
+}
+
+static bool readEventFrame(blackboxDecoder_t *decoder)
+{
+    blackboxDecoderEvent_t *event = &decoder->event;
+
+    memset(event, 0, sizeof(*event));
+    event->type = blackboxDecoderReadByte(decoder);
+
+    switch (event->type) {
+    case FLIGHT_LOG_EVENT_SYNC_BEEP:
+    case FLIGHT_LOG_EVENT_DISARM:
+        event->values[0] = blackboxDecoderReadUnsignedVB(decoder);
+        break;
+    case FLIGHT_LOG_EVENT_FLIGHTMODE:
+    case FLIGHT_LOG_EVENT_LOGGING_RESUME:
+        event->values[0] = blackboxDecoderReadUnsignedVB(decoder);
+        event->values[1] = blackboxDecoderReadUnsignedVB(decoder);
+        break;
+    case FLIGHT_LOG_EVENT_INFLIGHT_ADJUSTMENT:
+        event->adjustmentFunction = blackboxDecoderReadByte(decoder);
+        if (event->adjustmentFunction & FLIGHT_LOG_EVENT_INFLIGHT_ADJUSTMENT_FUNCTION_FLOAT_VALUE_FLAG) {
+            event->adjustmentFunction &= ~FLIGHT_LOG_EVENT_INFLIGHT_ADJUSTMENT_FUNCTION_FLOAT_VALUE_FLAG;
+            event->floatValue = blackboxDecoderReadFloat(decoder);
+        } else {
+            event->values[0] = blackboxDecoderReadSignedVB(decoder);
+        }
+        break;
+    case FLIGHT_LOG_EVENT_LOG_END: {
+        static const char endMessage[] = "End of log";
+        for (unsigned i = 0; i < sizeof(endMessage); i++) {
+            if (blackboxDecoderReadByte(decoder) != (uint8_t)endMessage[i]) {
+                return false;
+            }
+        }
+        decoder->logEnded = true;
+        break;
+    }
+    default:
+        return false;
+    }
+
+    return true;
+}
+
+int blackboxDecoderNextFrame(blackboxDecoder_t *decoder)
+{
+    if (decoder->logEnded || decoder->pos >= decoder->length) {
+        return 0;
+    }
+
+    const size_t frameStart = decoder->pos;
+    const uint8_t frameType = blackboxDecoderReadByte(decoder);
+    bool valid;
+
+    switch (frameType) {
+    case 'I':
+        valid = readMainFrame(decoder, true);
+        break;
+    case 'P':
+        valid = readMainFrame(decoder, false);
+        break;
+    case 'S':
+        readSimpleFrame(decoder, &decoder->slow, decoder->slowFrame, NULL);
+        valid = true;
+        break;
+    case 'H':
+        readSimpleFrame(decoder, &decoder->gpsH, decoder->gpsHomeFrame, NULL);
+        valid = true;
+        break;
+    case 'G':
+        readSimpleFrame(decoder, &decoder->gpsG, decoder->gpsFrame, decoder->gpsHomeFrame);
+        valid = true;
+        break;
+    case 'E':
+        valid = readEventFrame(decoder);
+        break;
+    default:
+        valid = false;
+        break;
+    }
+
+    if (!valid || decoder->overrun) {
+        return -1;
+    }
+
+    decoder->frameCount[frameType]++;
+    decoder->frameBytes[frameType] += decoder->pos - frameStart;
+
+    return frameType;
+}
@@ -0,0 +1,116 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Host decoder for the logs written by blackbox/blackbox.c. It parses the "H" header lines, then decodes I, P, S, G,
+// H and E frames using the field definitions, predictors and encodings the header describes, so tests and benchmarks
+// can check that what was logged comes back out unchanged.
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define BLACKBOX_DECODER_MAX_FIELDS         64
+#define BLACKBOX_DECODER_MAX_NAME_LENGTH    32
+#define BLACKBOX_DECODER_MAX_HEADERS        128
+#define BLACKBOX_DECODER_MAX_HEADER_LENGTH  128
+
+typedef struct blackboxDecoderFieldDefs_s {
+    int count;
+    char name[BLACKBOX_DECODER_MAX_FIELDS][BLACKBOX_DECODER_MAX_NAME_LENGTH];
+    uint8_t isSigned[BLACKBOX_DECODER_MAX_FIELDS];
+    uint8_t predictor[BLACKBOX_DECODER_MAX_FIELDS];
+    uint8_t encoding[BLACKBOX_DECODER_MAX_FIELDS];
+} blackboxDecoderFieldDefs_t;
+
+typedef struct blackboxDecoderEvent_s {
+    uint8_t type;                   // FlightLogEvent
+    uint8_t adjustmentFunction;     // FLIGHT_LOG_EVENT_INFLIGHT_ADJUSTMENT only
+    uint32_t values[2];             // event data in the order it is logged
+    float floatValue;               // FLIGHT_LOG_EVENT_INFLIGHT_ADJUSTMENT with a float value only
+} blackboxDecoderEvent_t;
+
+typedef struct blackboxDecoder_s {
+    const uint8_t *data;
+    size_t length;
+    size_t pos;
+    bool overrun;
+
+    // state of the bit stream shared by consecutive BITPACKED groups
+    uint8_t bitBuffer;
+    uint8_t bitCount;
+
+    int headerCount;
+    char headerName[BLACKBOX_DECODER_MAX_HEADERS][BLACKBOX_DECODER_MAX_NAME_LENGTH];
+    char headerValue[BLACKBOX_DECODER_MAX_HEADERS][BLACKBOX_DECODER_MAX_HEADER_LENGTH];
+
+    // field definitions, the P-frame definitions share their names with the I-frame ones
+    blackboxDecoderFieldDefs_t mainI;
+    blackboxDecoderFieldDefs_t mainP;
+    blackboxDecoderFieldDefs_t slow;
+    blackboxDecoderFieldDefs_t gpsH;
+    blackboxDecoderFieldDefs_t gpsG;
+
+    // header values used by predictors
+    int32_t minthrottle;
+    int32_t minmotor;
+    int32_t vbatref;
+    int32_t pInterval;
+
+    int motor0Index;
+    int timeIndex;
+
+    // the last two main frames, [0] is the most recent
+    int32_t mainHistory[2][BLACKBOX_DECODER_MAX_FIELDS];
+    bool mainHistoryValid;
+
+    int32_t slowFrame[BLACKBOX_DECODER_MAX_FIELDS];
+    int32_t gpsHomeFrame[BLACKBOX_DECODER_MAX_FIELDS];
+    int32_t gpsFrame[BLACKBOX_DECODER_MAX_FIELDS];
+    blackboxDecoderEvent_t event;
+    bool logEnded;
+
+    uint32_t frameCount[256];
+    uint32_t frameBytes[256];
+} blackboxDecoder_t;
+
+void blackboxDecoderInit(blackboxDecoder_t *decoder, const uint8_t *data, size_t length);
+bool blackboxDecoderReadHeaders(blackboxDecoder_t *decoder);
+const char *blackboxDecoderGetHeader(const blackboxDecoder_t *decoder, const char *name);
+int blackboxDecoderFieldIndex(const blackboxDecoderFieldDefs_t *defs, const char *name);
+
+// Decode the next frame and return its type ('I', 'P', 'S', 'G', 'H' or 'E'), 0 at the end of the log or -1 if the
+// data is corrupt. Main frame values are in mainHistory[0], the others in the array for their frame type.
+int blackboxDecoderNextFrame(blackboxDecoder_t *decoder);
+
+// Readers for the individual encodings, the counterparts of the blackboxWrite*() functions
+uint8_t blackboxDecoderReadByte(blackboxDecoder_t *decoder);
+uint32_t blackboxDecoderReadUnsignedVB(blackboxDecoder_t *decoder);
+int32_t blackboxDecoderReadSignedVB(blackboxDecoder_t *decoder);
+int16_t blackboxDecoderReadS16(blackboxDecoder_t *decoder);
+uint32_t blackboxDecoderReadU32(blackboxDecoder_t *decoder);
+float blackboxDecoderReadFloat(blackboxDecoder_t *decoder);
+void blackboxDecoderReadTag2_3S32(blackboxDecoder_t *decoder, int32_t *values);
+void blackboxDecoderReadTag2_3SVariable(blackboxDecoder_t *decoder, int32_t *values);
+void blackboxDecoderReadTag8_4S16(blackboxDecoder_t *decoder, int32_t *values);
+void blackboxDecoderReadTag8_8SVB(blackboxDecoder_t *decoder, int32_t *values, int valueCount);
+void blackboxDecoderReadBitPackedGroup(blackboxDecoder_t *decoder, int32_t *values, int valueCount);
+void blackboxDecoderAlignToByte(blackboxDecoder_t *decoder);
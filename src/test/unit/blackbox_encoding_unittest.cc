@@ -22,6 +22,7 @@ extern "C" {
 
     #include "blackbox/blackbox.h"
     #include "blackbox/blackbox_encoding.h"
+    #include "common/maths.h"
     #include "common/utils.h"
 
     #include "pg/pg.h"
@@ -29,8 +30,12 @@ extern "C" {
 
     #include "drivers/serial.h"
     #include "io/serial.h"
+
+    #include "blackbox_decoder.h"
 }
 
+#include <math.h>
+
 #include "unittest_macros.h"
 #include "gtest/gtest.h"
 
@@ -240,6 +245,273 @@ TEST(BlackboxTest, TestWriteTag2_3SVariable_BITS887)
     EXPECT_EQ(0, buf[3]); // ensure next byte has not been written
     buf += 3;
 }
+
+TEST(BlackboxEncodingTest, TestWriteBitPackedGroup)
+{
+    serialTestResetBuffers();
+    int32_t v[3];
+
+    // all zero: just the 5-bit header, padded out by the flush
+    v[0] = 0;
+    v[1] = 0;
+    v[2] = 0;
+    blackboxWriteBitPackedGroup(v, 3);
+    EXPECT_EQ(0, serialWritePos);
+    blackboxFlushBits();
+    EXPECT_EQ(1, serialWritePos);
+    EXPECT_EQ(0x00, serialWriteBuffer[0]);
+
+    // zigzag 2, 1, 6 at 3 bits: 00011 010 001 110 -> 0001 1010 0011 1000
+    v[0] = 1;
+    v[1] = -1;
+    v[2] = 3;
+    blackboxWriteBitPackedGroup(v, 3);
+    blackboxFlushBits();
+    EXPECT_EQ(3, serialWritePos);
+    EXPECT_EQ(0x1A, serialWriteBuffer[1]);
+    EXPECT_EQ(0x38, serialWriteBuffer[2]);
+
+    // flushing when already on a byte boundary writes nothing
+    blackboxFlushBits();
+    EXPECT_EQ(3, serialWritePos);
+
+    // an empty group writes nothing at all
+    blackboxWriteBitPackedGroup(v, 0);
+    blackboxFlushBits();
+    EXPECT_EQ(3, serialWritePos);
+}
+
+TEST(BlackboxEncodingTest, TestBitPackedGroupRoundTrip)
+{
+    serialTestResetBuffers();
+
+    int32_t groups[][4] = {
+        { 0, 0, 0, 0 },
+        { 1, -1, 2, -2 },
+        { 100, -3, 0, 7 },
+        { -32768, 32767, 0, 1 },
+        { INT32_MIN, INT32_MAX, -1, 0 },
+        { 1073741823, -1073741824, 0, 0 },  // zigzag needs 31 bits, written at 32
+        { 5, 0, 0, 0 },
+    };
+    const int groupSizes[] = { 4, 4, 3, 2, 4, 2, 1 };
+    const int groupCount = ARRAYLEN(groupSizes);
+
+    // consecutive groups share the bit stream
+    for (int i = 0; i < groupCount; i++) {
+        blackboxWriteBitPackedGroup(groups[i], groupSizes[i]);
+    }
+    blackboxFlushBits();
+    const int bytesWritten = serialWritePos;
+
+    blackboxDecoder_t decoder;
+    blackboxDecoderInit(&decoder, serialWriteBuffer, serialWritePos);
+    for (int i = 0; i < groupCount; i++) {
+        int32_t decoded[4];
+        blackboxDecoderReadBitPackedGroup(&decoder, decoded, groupSizes[i]);
+        for (int j = 0; j < groupSizes[i]; j++) {
+            EXPECT_EQ(groups[i][j], decoded[j]);
+        }
+    }
+    EXPECT_EQ(bytesWritten, (int)decoder.pos);
+
+    // a byte-aligned field after a flush starts on the next byte
+    blackboxWriteBitPackedGroup(groups[1], 1);
+    blackboxFlushBits();
+    blackboxWriteUnsignedVB(42);
+    EXPECT_EQ(bytesWritten + 2, serialWritePos);
+    EXPECT_EQ(42, serialWriteBuffer[bytesWritten + 1]);
+}
+
+TEST(BlackboxEncodingTest, TestDecoderRoundTrip)
+{
+    serialTestResetBuffers();
+
+    const uint32_t unsignedValues[] = { 0, 1, 127, 128, 16383, 16384, 0x7FFFFFFF, 0xFFFFFFFF };
+    const int32_t signedValues[] = { 0, -1, 1, -64, 63, -8192, INT32_MAX, INT32_MIN };
+    const int32_t triples[][3] = {
+        { 0, -1, 1 },           // 2 bits
+        { -7, 6, 3 },           // 4 bits / 554
+        { 30, -32, 20 },        // 6 bits / 554
+        { 100, -60, 63 },       // 32 bits / 877
+        { 127, -64, 63 },       // 32 bits / 877
+        { 200, -40000, 3 },     // 32 bits
+        { INT32_MIN, INT32_MAX, 0 },
+    };
+    const int32_t quads[][4] = {
+        { 0, 0, 0, 0 },
+        { 7, -8, 0, 1 },
+        { 127, -128, 5, 0 },
+        { 32767, -32768, -1, 100 },
+        { 0, 300, 0, -5 },
+    };
+    const int32_t svbGroup[8] = { 0, 5, 0, -300, 0, 0, 70000, -1 };
+
+    for (unsigned i = 0; i < ARRAYLEN(unsignedValues); i++) {
+        blackboxWriteUnsignedVB(unsignedValues[i]);
+    }
+    for (unsigned i = 0; i < ARRAYLEN(signedValues); i++) {
+        blackboxWriteSignedVB(signedValues[i]);
+    }
+    for (unsigned i = 0; i < ARRAYLEN(triples); i++) {
+        int32_t v[3] = { triples[i][0], triples[i][1], triples[i][2] };
+        blackboxWriteTag2_3S32(v);
+    }
+    for (unsigned i = 0; i < ARRAYLEN(triples); i++) {
+        int32_t v[3] = { triples[i][0], triples[i][1], triples[i][2] };
+        blackboxWriteTag2_3SVariable(v);
+    }
+    for (unsigned i = 0; i < ARRAYLEN(quads); i++) {
+        int32_t v[4] = { quads[i][0], quads[i][1], quads[i][2], quads[i][3] };
+        blackboxWriteTag8_4S16(v);
+    }
+    int32_t group[8];
+    memcpy(group, svbGroup, sizeof(group));
+    blackboxWriteTag8_8SVB(group, 8);
+    blackboxWriteTag8_8SVB(group + 1, 1);
+    blackboxWriteU32(0xDEADBEEF);
+    blackboxWriteFloat(-2.5f);
+    ASSERT_LT(serialWritePos, SERIAL_BUFFER_SIZE);
+
+    blackboxDecoder_t decoder;
+    blackboxDecoderInit(&decoder, serialWriteBuffer, serialWritePos);
+    for (unsigned i = 0; i < ARRAYLEN(unsignedValues); i++) {
+        EXPECT_EQ(unsignedValues[i], blackboxDecoderReadUnsignedVB(&decoder));
+    }
+    for (unsigned i = 0; i < ARRAYLEN(signedValues); i++) {
+        EXPECT_EQ(signedValues[i], blackboxDecoderReadSignedVB(&decoder));
+    }
+    for (unsigned i = 0; i < ARRAYLEN(triples); i++) {
+        int32_t v[3];
+        blackboxDecoderReadTag2_3S32(&decoder, v);
+        for (int j = 0; j < 3; j++) {
+            EXPECT_EQ(triples[i][j], v[j]);
+        }
+    }
+    for (unsigned i = 0; i < ARRAYLEN(triples); i++) {
+        int32_t v[3];
+        blackboxDecoderReadTag2_3SVariable(&decoder, v);
+        for (int j = 0; j < 3; j++) {
+            EXPECT_EQ(triples[i][j], v[j]);
+        }
+    }
+    for (unsigned i = 0; i < ARRAYLEN(quads); i++) {
+        int32_t v[4];
+        blackboxDecoderReadTag8_4S16(&decoder, v);
+        for (int j = 0; j < 4; j++) {
+            EXPECT_EQ(quads[i][j], v[j]);
+        }
+    }
+    blackboxDecoderReadTag8_8SVB(&decoder, group, 8);
+    for (int j = 0; j < 8; j++) {
+        EXPECT_EQ(svbGroup[j], group[j]);
+    }
+    blackboxDecoderReadTag8_8SVB(&decoder, group, 1);
+    EXPECT_EQ(svbGroup[1], group[0]);
+    EXPECT_EQ(0xDEADBEEF, blackboxDecoderReadU32(&decoder));
+    EXPECT_EQ(-2.5f, blackboxDecoderReadFloat(&decoder));
+
+    EXPECT_EQ(serialWritePos, (int)decoder.pos);
+    EXPECT_FALSE(decoder.overrun);
+    blackboxDecoderReadByte(&decoder);
+    EXPECT_TRUE(decoder.overrun);
+}
+
+/*
+ * Encode the main P-frame fields of a simulated 8kHz flight (slow stick movement, prop noise on the gyros and
+ * everything derived from them, RC updates every 32 frames) both ways and compare the average frame size.
+ */
+TEST(BlackboxEncodingTest, TestHighDensityFrameSize)
+{
+    const int frameCount = 8000;
+    const float dT = 1.0f / 8000;
+    uint32_t noiseSeed = 1;
+
+    int32_t history[3][22] = { };
+    int standardBytes = 0;
+    int highDensityBytes = 0;
+
+    for (int frame = 0; frame < frameCount; frame++) {
+        const float t = frame * dT;
+        const float rcT = (frame & ~31) * dT;
+        int32_t *curr = history[frame % 3];
+        int32_t *prev1 = history[(frame + 2) % 3];
+        int32_t *prev2 = history[(frame + 1) % 3];
+
+        // 0..2 P, 3..5 I, 6..7 D, 8..10 F, 11..14 rcCommand, 15..18 setpoint, 19..21 gyro
+        for (int axis = 0; axis < 3; axis++) {
+            noiseSeed = noiseSeed * 1664525 + 1013904223;
+            const float noise = ((noiseSeed >> 16) & 0xFF) / 64.0f - 2.0f;
+            const float stick = 300 * sinf(2 * M_PI * 0.7f * t + axis);
+            const float gyro = stick + 8 * sinf(2 * M_PI * 210 * t + 2 * axis) + noise;
+            curr[19 + axis] = lrintf(gyro);
+            curr[axis] = lrintf(0.6f * (300 * sinf(2 * M_PI * 0.7f * rcT + axis) - gyro));
+            curr[3 + axis] = lrintf(20 * sinf(2 * M_PI * 0.2f * t + axis));
+            if (axis < 2) {
+                curr[6 + axis] = lrintf(-0.8f * (gyro - stick));
+            }
+            curr[8 + axis] = lrintf(40 * cosf(2 * M_PI * 0.7f * rcT + axis));
+            curr[11 + axis] = lrintf(200 * sinf(2 * M_PI * 0.7f * rcT + axis));
+            curr[15 + axis] = lrintf(300 * sinf(2 * M_PI * 0.7f * rcT + axis));
+        }
+        curr[14] = 1300;
+        curr[18] = 400;
+
+        if (frame < 2) {
+            continue;
+        }
+
+        int32_t deltas[8];
+        int32_t averages[3];
+        for (int i = 0; i < 3; i++) {
+            averages[i] = curr[19 + i] - (prev1[19 + i] + prev2[19 + i]) / 2;
+        }
+
+        // standard encoding, as written by writeInterframe()
+        serialTestResetBuffers();
+        blackboxWriteSignedVB(0);
+        arraySubInt32(deltas, &curr[0], &prev1[0], 3);
+        blackboxWriteSignedVBArray(deltas, 3);
+        arraySubInt32(deltas, &curr[3], &prev1[3], 3);
+        blackboxWriteTag2_3S32(deltas);
+        arraySubInt32(deltas, &curr[6], &prev1[6], 2);
+        blackboxWriteSignedVBArray(deltas, 2);
+        arraySubInt32(deltas, &curr[8], &prev1[8], 3);
+        blackboxWriteSignedVBArray(deltas, 3);
+        arraySubInt32(deltas, &curr[11], &prev1[11], 4);
+        blackboxWriteTag8_4S16(deltas);
+        arraySubInt32(deltas, &curr[15], &prev1[15], 4);
+        blackboxWriteTag8_4S16(deltas);
+        blackboxWriteSignedVBArray(averages, 3);
+        standardBytes += serialWritePos;
+
+        // high density encoding, as written by writeHighDensityInterframe()
+        serialTestResetBuffers();
+        deltas[0] = 0;
+        blackboxWriteBitPackedGroup(deltas, 1);
+        arraySubInt32(deltas, &curr[0], &prev1[0], 3);
+        blackboxWriteBitPackedGroup(deltas, 3);
+        arraySubInt32(deltas, &curr[3], &prev1[3], 3);
+        blackboxWriteBitPackedGroup(deltas, 3);
+        arraySubInt32(deltas, &curr[6], &prev1[6], 2);
+        blackboxWriteBitPackedGroup(deltas, 2);
+        arraySubInt32(deltas, &curr[8], &prev1[8], 3);
+        blackboxWriteBitPackedGroup(deltas, 3);
+        arraySubInt32(deltas, &curr[11], &prev1[11], 4);
+        blackboxWriteBitPackedGroup(deltas, 4);
+        arraySubInt32(deltas, &curr[15], &prev1[15], 4);
+        blackboxWriteBitPackedGroup(deltas, 4);
+        arraySubInt32(deltas, &curr[19], &prev1[19], 3);
+        blackboxWriteBitPackedGroup(deltas, 3);
+        blackboxFlushBits();
+        highDensityBytes += serialWritePos;
+    }
+
+    printf("P-frame bytes: standard %.2f, high density %.2f\n",
+        (double)standardBytes / (frameCount - 2), (double)highDensityBytes / (frameCount - 2));
+    EXPECT_LE(highDensityBytes, standardBytes * 7 / 10);
+}
+
 // STUBS
 extern "C" {
 PG_REGISTER(blackboxConfig_t, blackboxConfig, PG_BLACKBOX_CONFIG, 0);
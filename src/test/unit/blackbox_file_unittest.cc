@@ -0,0 +1,141 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <unistd.h>
+#include <sys/stat.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "blackbox/blackbox_file.h"
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+static long fileSize(const char *filename)
+{
+    struct stat st;
+    return stat(filename, &st) == 0 ? st.st_size : -1;
+}
+
+class BlackboxFileTest : public ::testing::Test {
+protected:
+    char directory[64];
+    char *previousDirectory;
+
+    virtual void SetUp() {
+        strcpy(directory, "/tmp/blackbox_file_unittest_XXXXXX");
+        ASSERT_NE(nullptr, mkdtemp(directory));
+        previousDirectory = getcwd(NULL, 0);
+        ASSERT_EQ(0, chdir(directory));
+    }
+
+    virtual void TearDown() {
+        EXPECT_EQ(0, chdir(previousDirectory));
+        free(previousDirectory);
+        char command[128];
+        snprintf(command, sizeof(command), "rm -rf %s", directory);
+        EXPECT_EQ(0, system(command));
+    }
+};
+
+TEST_F(BlackboxFileTest, TestLogIsWrittenAndTrimmed)
+{
+    EXPECT_TRUE(blackboxFileOpen());
+    EXPECT_TRUE(blackboxFileBeginLog());
+    EXPECT_EQ(1, blackboxFileGetLogNumber());
+    EXPECT_TRUE(blackboxFileIsWorking());
+
+    // enough frames to grow the file several times
+    uint8_t frame[100];
+    const int frameCount = 200000;
+    for (int i = 0; i < frameCount; i++) {
+        memset(frame, i, sizeof(frame));
+        blackboxFileWrite(frame, sizeof(frame));
+    }
+    EXPECT_FALSE(blackboxFileIsFull());
+    EXPECT_TRUE(blackboxFileEndLog(true));
+
+    EXPECT_EQ(frameCount * (long)sizeof(frame), fileSize("logs/LOG00001.BFL"));
+
+    FILE *file = fopen("logs/LOG00001.BFL", "rb");
+    ASSERT_NE(nullptr, file);
+    int mismatches = 0;
+    for (int i = 0; i < frameCount; i++) {
+        ASSERT_EQ(sizeof(frame), fread(frame, 1, sizeof(frame), file));
+        for (unsigned j = 0; j < sizeof(frame); j++) {
+            mismatches += frame[j] != (uint8_t)i;
+        }
+    }
+    fclose(file);
+    EXPECT_EQ(0, mismatches);
+}
+
+TEST_F(BlackboxFileTest, TestLogNumbering)
+{
+    // logs from an earlier run, and files that aren't logs
+    ASSERT_EQ(0, mkdir("logs", 0755));
+    fclose(fopen("logs/LOG00007.BFL", "w"));
+    fclose(fopen("logs/LOG00042.TXT", "w"));
+    fclose(fopen("logs/LOG123.BFL", "w"));
+
+    const uint8_t data[] = "H Product:Blackbox";
+    EXPECT_TRUE(blackboxFileBeginLog());
+    EXPECT_EQ(8, blackboxFileGetLogNumber());
+    blackboxFileWrite(data, sizeof(data));
+    EXPECT_TRUE(blackboxFileEndLog(true));
+    EXPECT_EQ((long)sizeof(data), fileSize("logs/LOG00008.BFL"));
+
+    // a discarded log is removed and its number reused
+    EXPECT_TRUE(blackboxFileBeginLog());
+    EXPECT_EQ(9, blackboxFileGetLogNumber());
+    blackboxFileWrite(data, sizeof(data));
+    EXPECT_TRUE(blackboxFileEndLog(false));
+    EXPECT_EQ(-1, fileSize("logs/LOG00009.BFL"));
+    EXPECT_EQ(8, blackboxFileGetLogNumber());
+
+    EXPECT_TRUE(blackboxFileBeginLog());
+    EXPECT_EQ(9, blackboxFileGetLogNumber());
+    EXPECT_TRUE(blackboxFileEndLog(true));
+    EXPECT_EQ(0, fileSize("logs/LOG00009.BFL"));
+}
+
+TEST_F(BlackboxFileTest, TestFailedLogDoesNotDisableTheDevice)
+{
+    // the log directory can't be created
+    fclose(fopen("logs", "w"));
+    EXPECT_TRUE(blackboxFileOpen());
+    EXPECT_TRUE(blackboxFileBeginLog());
+    EXPECT_FALSE(blackboxFileIsWorking());
+    EXPECT_TRUE(blackboxFileEndLog(false));
+
+    // once it can, the next log is written
+    ASSERT_EQ(0, unlink("logs"));
+    const uint8_t data[] = "H Product:Blackbox";
+    EXPECT_TRUE(blackboxFileOpen());
+    EXPECT_TRUE(blackboxFileBeginLog());
+    EXPECT_TRUE(blackboxFileIsWorking());
+    blackboxFileWrite(data, sizeof(data));
+    EXPECT_TRUE(blackboxFileEndLog(true));
+    EXPECT_EQ((long)sizeof(data), fileSize("logs/LOG00001.BFL"));
+}
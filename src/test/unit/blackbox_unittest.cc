@@ -21,9 +21,14 @@ extern "C" {
     #include "platform.h"
 
     #include "build/debug.h"
+    #include "build/version.h"
 
     #include "blackbox/blackbox.h"
+    #include "blackbox/blackbox_fielddefs.h"
+    #include "blackbox/blackbox_io.h"
     #include "common/utils.h"
+    #include "config/config.h"
+    #include "config/feature.h"
 
     #include "pg/pg.h"
     #include "pg/pg_ids.h"
@@ -37,22 +42,34 @@ extern "C" {
     #include "flight/failsafe.h"
     #include "flight/mixer.h"
     #include "flight/pid.h"
+    #include "flight/servos.h"
 
+    #include "fc/controlrate_profile.h"
     #include "fc/rc_controls.h"
     #include "fc/rc_modes.h"
+    #include "fc/runtime_config.h"
 
     #include "io/gps.h"
     #include "io/serial.h"
 
     #include "rx/rx.h"
 
+    #include "sensors/acceleration.h"
+    #include "sensors/barometer.h"
     #include "sensors/battery.h"
+    #include "sensors/compass.h"
+    #include "sensors/current.h"
     #include "sensors/gyro.h"
+    #include "sensors/voltage.h"
+
+    #include "blackbox_decoder.h"
 
     extern int16_t blackboxIInterval;
     extern int16_t blackboxPInterval;
 }
 
+#include <vector>
+
 #include "unittest_macros.h"
 #include "gtest/gtest.h"
 
@@ -327,6 +344,323 @@ TEST(BlackboxTest, Test_CalculateRates)
 
 }
 
+static uint32_t serialTxBytesFreeValue;
+static serialPort_t blackboxSerialPort;
+static serialPortConfig_t blackboxSerialPortConfig;
+static int serialWriteBufCalls;
+static std::vector<uint8_t> serialWritten;
+
+TEST(BlackboxTest, TestFrameIsWrittenWhole)
+{
+    blackboxConfigMutable()->device = BLACKBOX_DEVICE_SERIAL;
+    serialWriteBufCalls = 0;
+    serialWritten.clear();
+
+    // a frame that fits is handed to the port in one write
+    serialTxBytesFreeValue = 16;
+    blackboxBeginFrame();
+    blackboxWrite('P');
+    blackboxWriteString("abcd");
+    EXPECT_EQ(0, serialWriteBufCalls);
+    blackboxCommitFrame();
+    EXPECT_EQ(1, serialWriteBufCalls);
+    EXPECT_EQ(std::vector<uint8_t>({'P', 'a', 'b', 'c', 'd'}), serialWritten);
+
+    // a frame that doesn't fit is dropped whole rather than truncated
+    serialWritten.clear();
+    serialTxBytesFreeValue = 4;
+    blackboxBeginFrame();
+    blackboxWrite('P');
+    blackboxWriteString("abcd");
+    blackboxCommitFrame();
+    EXPECT_EQ(1, serialWriteBufCalls);
+    EXPECT_TRUE(serialWritten.empty());
+
+    // writes outside a frame go straight to the port
+    blackboxWrite('H');
+    EXPECT_EQ(2, serialWriteBufCalls);
+    EXPECT_EQ(std::vector<uint8_t>({'H'}), serialWritten);
+
+    serialTxBytesFreeValue = 0;
+}
+
+static uint32_t millisValue;
+
+#define CAPTURE_START_US 5000000
+
+static timeUs_t iterationTimeUs(uint32_t iteration)
+{
+    return CAPTURE_START_US + iteration * targetPidLooptime;
+}
+
+// Arm and run the blackbox task until the headers are sent and the flight loop is logging
+static void startLog(uint32_t looptimeUs = 1000, uint16_t pRatio = 32)
+{
+    blackboxConfigMutable()->device = BLACKBOX_DEVICE_SERIAL;
+    blackboxConfigMutable()->p_ratio = pRatio;
+    blackboxSerialPortConfig.blackbox_baudrateIndex = BAUD_2000000;
+    targetPidLooptime = looptimeUs;
+    serialTxBytesFreeValue = 1 << 20;
+    serialWritten.clear();
+
+    blackboxInit();
+    ENABLE_ARMING_FLAG(ARMED);
+    for (int i = 0; i < 1000; i++) {
+        millisValue++;
+        blackboxUpdate(millisValue * 1000);
+    }
+}
+
+static void finishLog(void)
+{
+    blackboxUpdate(millisValue * 1000);
+    blackboxFinish();
+    // the log end event is written by the task
+    blackboxUpdate(millisValue * 1000);
+    DISABLE_ARMING_FLAG(ARMED);
+    serialTxBytesFreeValue = 0;
+}
+
+// Capture iterations first...last, running the blackbox task after every taskInterval of them
+static void captureIterations(uint32_t first, uint32_t last, uint32_t taskInterval)
+{
+    for (uint32_t i = first; i <= last; i++) {
+        blackboxCapture(iterationTimeUs(i));
+        if (taskInterval && i % taskInterval == taskInterval - 1) {
+            // the task runs well after the frames were captured
+            blackboxUpdate(iterationTimeUs(i) + 777);
+        }
+    }
+}
+
+typedef struct decodedLog_s {
+    std::vector<uint32_t> iterations;
+    std::vector<uint32_t> times;
+    std::vector<int> frameTypes;    // main frames and events in log order
+    std::vector<uint32_t> resumeIterations;
+    std::vector<uint32_t> resumeTimes;
+    std::vector<uint32_t> disarmReasons;
+    std::vector<uint32_t> slowStateFlags;
+    bool logEnded;
+} decodedLog_t;
+
+static void decodeLog(decodedLog_t *log)
+{
+    static blackboxDecoder_t decoder;
+
+    blackboxDecoderInit(&decoder, serialWritten.data(), serialWritten.size());
+    ASSERT_TRUE(blackboxDecoderReadHeaders(&decoder));
+    const int iterationIndex = blackboxDecoderFieldIndex(&decoder.mainI, "loopIteration");
+    const int stateFlagsIndex = blackboxDecoderFieldIndex(&decoder.slow, "stateFlags");
+
+    int frameType;
+    while ((frameType = blackboxDecoderNextFrame(&decoder)) > 0) {
+        if (frameType == 'I' || frameType == 'P') {
+            log->frameTypes.push_back(frameType);
+            log->iterations.push_back(decoder.mainHistory[0][iterationIndex]);
+            log->times.push_back(decoder.mainHistory[0][decoder.timeIndex]);
+        } else if (frameType == 'E' && decoder.event.type == FLIGHT_LOG_EVENT_LOGGING_RESUME) {
+            log->frameTypes.push_back(frameType);
+            log->resumeIterations.push_back(decoder.event.values[0]);
+            log->resumeTimes.push_back(decoder.event.values[1]);
+        } else if (frameType == 'S') {
+            log->slowStateFlags.push_back(decoder.slowFrame[stateFlagsIndex]);
+        } else if (frameType == 'E' && decoder.event.type == FLIGHT_LOG_EVENT_DISARM) {
+            log->frameTypes.push_back(frameType);
+            log->disarmReasons.push_back(decoder.event.values[0]);
+        }
+    }
+    EXPECT_EQ(0, frameType);
+    log->logEnded = decoder.logEnded;
+}
+
+TEST(BlackboxTest, TestCapturedFramesKeepTimeAndIteration)
+{
+    startLog();
+
+    // the flight loop only captures, nothing is written until the blackbox task runs
+    const size_t headerSize = serialWritten.size();
+    captureIterations(0, 9, 0);
+    EXPECT_EQ(headerSize, serialWritten.size());
+    blackboxUpdate(iterationTimeUs(9) + 12345);
+    EXPECT_LT(headerSize, serialWritten.size());
+
+    captureIterations(10, 39, 4);
+    finishLog();
+    EXPECT_EQ(0U, blackboxGetDroppedFrameCount());
+
+    decodedLog_t log;
+    decodeLog(&log);
+    EXPECT_TRUE(log.logEnded);
+    ASSERT_EQ(40U, log.iterations.size());
+    for (uint32_t i = 0; i < 40; i++) {
+        EXPECT_EQ(i, log.iterations[i]);
+        EXPECT_EQ(iterationTimeUs(i), log.times[i]);
+        EXPECT_EQ(i % 32 == 0 ? 'I' : 'P', log.frameTypes[i]);
+    }
+    EXPECT_TRUE(log.resumeIterations.empty());
+}
+
+TEST(BlackboxTest, TestOverflowIsCountedAndResyncs)
+{
+    startLog();
+
+    // the blackbox task falls behind, so the ring of 64 fills and every frame after it is dropped
+    captureIterations(0, 87, 0);
+    EXPECT_EQ(24U, blackboxGetDroppedFrameCount());
+    blackboxUpdate(iterationTimeUs(87));
+
+    // with room in the ring again, logging still waits for the next I-frame at iteration 96
+    captureIterations(88, 101, 1);
+    EXPECT_EQ(32U, blackboxGetDroppedFrameCount());
+    finishLog();
+
+    decodedLog_t log;
+    decodeLog(&log);
+    EXPECT_TRUE(log.logEnded);
+
+    std::vector<uint32_t> expectedIterations;
+    std::vector<uint32_t> expectedTimes;
+    for (uint32_t i = 0; i <= 101; i = (i == 63) ? 96 : i + 1) {
+        expectedIterations.push_back(i);
+        expectedTimes.push_back(iterationTimeUs(i));
+    }
+    EXPECT_EQ(expectedIterations, log.iterations);
+    EXPECT_EQ(expectedTimes, log.times);
+
+    // the gap is marked with a resume event just before the I-frame it resumes at
+    ASSERT_EQ(1U, log.resumeIterations.size());
+    EXPECT_EQ(96U, log.resumeIterations[0]);
+    EXPECT_EQ(iterationTimeUs(96), log.resumeTimes[0]);
+    ASSERT_EQ(71U, log.frameTypes.size());
+    EXPECT_EQ('E', log.frameTypes[64]);
+    EXPECT_EQ('I', log.frameTypes[65]);
+}
+
+TEST(BlackboxTest, TestSlowFramesWaitInTheirOwnRing)
+{
+    startLog();
+
+    // the slow state changes with every frame, until the slow ring of 8 is full
+    for (uint32_t i = 0; i < 12; i++) {
+        stateFlags = i;
+        blackboxCapture(iterationTimeUs(i));
+    }
+    EXPECT_EQ(3U, blackboxGetDroppedFrameCount());
+    blackboxUpdate(iterationTimeUs(11));
+
+    // logging resumes at the next I-frame, with a slow frame in the first P-frame after it
+    captureIterations(12, 40, 1);
+    EXPECT_EQ(23U, blackboxGetDroppedFrameCount());
+    finishLog();
+    stateFlags = 0;
+
+    decodedLog_t log;
+    decodeLog(&log);
+    EXPECT_TRUE(log.logEnded);
+    EXPECT_EQ(std::vector<uint32_t>({1, 2, 3, 4, 5, 6, 7, 8, 11}), log.slowStateFlags);
+    ASSERT_EQ(1U, log.resumeIterations.size());
+    EXPECT_EQ(32U, log.resumeIterations[0]);
+}
+
+TEST(BlackboxTest, TestEventsAreWrittenByTheTask)
+{
+    startLog();
+
+    // an event logged from the flight loop is only queued
+    captureIterations(0, 9, 0);
+    const size_t headerSize = serialWritten.size();
+    flightLogEvent_disarm_t disarm;
+    disarm.reason = 3;
+    blackboxLogEvent(FLIGHT_LOG_EVENT_DISARM, (flightLogEventData_t *)&disarm);
+    EXPECT_EQ(headerSize, serialWritten.size());
+
+    // the task writes it between the frames captured before and after it
+    captureIterations(10, 19, 0);
+    blackboxUpdate(iterationTimeUs(19));
+    EXPECT_LT(headerSize, serialWritten.size());
+    finishLog();
+
+    decodedLog_t log;
+    decodeLog(&log);
+    EXPECT_TRUE(log.logEnded);
+    ASSERT_EQ(20U, log.iterations.size());
+    ASSERT_EQ(21U, log.frameTypes.size());
+    EXPECT_EQ('P', log.frameTypes[9]);
+    EXPECT_EQ('E', log.frameTypes[10]);
+    EXPECT_EQ('P', log.frameTypes[11]);
+    EXPECT_EQ(std::vector<uint32_t>({3}), log.disarmReasons);
+}
+
+TEST(BlackboxTest, TestSnapshotRingIsOnlyLentBetweenLogs)
+{
+    blackboxConfigMutable()->device = BLACKBOX_DEVICE_SERIAL;
+    blackboxInit();
+    EXPECT_NE(nullptr, blackboxBorrowSnapshotRing(1024));
+    EXPECT_EQ(nullptr, blackboxBorrowSnapshotRing(1 << 20));
+
+    startLog();
+    EXPECT_EQ(nullptr, blackboxBorrowSnapshotRing(1024));
+
+    blackboxFinish();
+    EXPECT_EQ(nullptr, blackboxBorrowSnapshotRing(1024));
+    blackboxUpdate(millisValue * 1000);
+    DISABLE_ARMING_FLAG(ARMED);
+    serialTxBytesFreeValue = 0;
+    EXPECT_NE(nullptr, blackboxBorrowSnapshotRing(1024));
+}
+
+TEST(BlackboxTest, TestTaskPeriodFollowsLoggingRate)
+{
+    blackboxConfigMutable()->device = BLACKBOX_DEVICE_SERIAL;
+
+    // 1kHz logging, drained at 1kHz with plenty of room left
+    targetPidLooptime = 125;
+    blackboxConfigMutable()->p_ratio = 32;
+    blackboxInit();
+    EXPECT_EQ(1000, blackboxGetTaskPeriodUs());
+
+    // 8kHz logging, drained every frame to keep as much of the ring free as possible
+    blackboxConfigMutable()->p_ratio = 256;
+    blackboxInit();
+    EXPECT_EQ(125, blackboxGetTaskPeriodUs());
+
+    // I-frames only, the task still runs at 1kHz for events and the device
+    targetPidLooptime = 1000;
+    blackboxConfigMutable()->p_ratio = 0;
+    blackboxInit();
+    EXPECT_EQ(1000, blackboxGetTaskPeriodUs());
+}
+
+TEST(BlackboxTest, TestDelayedTaskDropsNothing)
+{
+    // 8kHz flight loop at the default ratio (1kHz logging) and at 2kHz and 4kHz logging
+    const uint16_t pRatios[] = { 32, 64, 128 };
+    for (const uint16_t pRatio : pRatios) {
+        startLog(125, pRatio);
+        const uint32_t taskIterations = blackboxGetTaskPeriodUs() / targetPidLooptime;
+        const uint32_t delayIterations = 8000 / targetPidLooptime;
+
+        // the task runs on time, then is held off by other tasks for 8ms on top of its period
+        const uint32_t delayStart = 4 * taskIterations;
+        const uint32_t delayEnd = delayStart + taskIterations + delayIterations;
+        captureIterations(0, delayStart - 1, taskIterations);
+        captureIterations(delayStart, delayEnd - 1, 0);
+        captureIterations(delayEnd, delayEnd + 4 * taskIterations - 1, taskIterations);
+        finishLog();
+        EXPECT_EQ(0U, blackboxGetDroppedFrameCount()) << "p_ratio " << pRatio;
+
+        decodedLog_t log;
+        decodeLog(&log);
+        EXPECT_TRUE(log.logEnded);
+        EXPECT_TRUE(log.resumeIterations.empty());
+        const uint32_t pInterval = 256 / pRatio;
+        ASSERT_EQ((delayEnd + 4 * taskIterations) / pInterval, log.iterations.size()) << "p_ratio " << pRatio;
+        for (uint32_t i = 0; i < log.iterations.size(); i++) {
+            EXPECT_EQ(i * pInterval, log.iterations[i]);
+        }
+    }
+}
 
 // STUBS
 extern "C" {
@@ -338,6 +672,26 @@ PG_REGISTER(batteryConfig_t, batteryConfig, PG_BATTERY_CONFIG, 0);
 PG_REGISTER(rxConfig_t, rxConfig, PG_RX_CONFIG, 0);
 PG_REGISTER_ARRAY(modeActivationCondition_t, MAX_MODE_ACTIVATION_CONDITION_COUNT, modeActivationConditions, PG_MODE_ACTIVATION_PROFILE, 0);
 
+// for the header lines
+PG_REGISTER(systemConfig_t, systemConfig, PG_SYSTEM_CONFIG, 0);
+PG_REGISTER(pilotConfig_t, pilotConfig, PG_PILOT_CONFIG, 0);
+PG_REGISTER(featureConfig_t, featureConfig, PG_FEATURE_CONFIG, 0);
+PG_REGISTER(gyroConfig_t, gyroConfig, PG_GYRO_CONFIG, 0);
+PG_REGISTER(accelerometerConfig_t, accelerometerConfig, PG_ACCELEROMETER_CONFIG, 0);
+PG_REGISTER(barometerConfig_t, barometerConfig, PG_BAROMETER_CONFIG, 0);
+PG_REGISTER(compassConfig_t, compassConfig, PG_COMPASS_CONFIG, 0);
+PG_REGISTER(armingConfig_t, armingConfig, PG_ARMING_CONFIG, 0);
+PG_REGISTER(rcControlsConfig_t, rcControlsConfig, PG_RC_CONTROLS_CONFIG, 0);
+PG_REGISTER(currentSensorADCConfig_t, currentSensorADCConfig, PG_CURRENT_SENSOR_ADC_CONFIG, 0);
+PG_REGISTER_ARRAY(voltageSensorADCConfig_t, MAX_VOLTAGE_SENSOR_ADC, voltageSensorADCConfig, PG_VOLTAGE_SENSOR_ADC_CONFIG, 0);
+PG_REGISTER_ARRAY(controlRateConfig_t, CONTROL_RATE_PROFILE_COUNT, controlRateProfiles, PG_CONTROL_RATE_PROFILES, 0);
+
+const char* const targetName = "TEST";
+const char* const shortGitRevision = "0000000";
+const char* const buildDate = "Jan 01 2020";
+const char* const buildTime = "00:00:00";
+uint8_t activePidLoopDenom = 1;
+
 uint8_t armingFlags;
 uint8_t stateFlags;
 const uint32_t baudRates[] = {0, 9600, 19200, 38400, 57600, 115200, 230400, 250000,
@@ -349,11 +703,18 @@ gpsSolutionData_t gpsSol;
 int32_t GPS_home[2];
 
 gyro_t gyro;
+acc_t acc;
+mag_t mag;
+baro_t baro;
+pidAxisData_t pidData[3];
+float rcCommand[4];
+float motor[MAX_SUPPORTED_MOTORS];
+int16_t servo[MAX_SUPPORTED_SERVOS];
 
 float motorOutputHigh, motorOutputLow;
 float motor_disarmed[MAX_SUPPORTED_MOTORS];
-struct pidProfile_s;
-struct pidProfile_s *currentPidProfile;
+static pidProfile_t pidProfile;
+pidProfile_t *currentPidProfile = &pidProfile;
 uint32_t targetPidLooptime;
 
 boxBitmask_t rcModeActivationMask;
@@ -361,20 +722,29 @@ boxBitmask_t rcModeActivationMask;
 void mspSerialAllocatePorts(void) {}
 uint32_t getArmingBeepTimeMicros(void) {return 0;}
 uint16_t getBatteryVoltageLatest(void) {return 0;}
+int32_t getAmperageLatest(void) {return 0;}
+uint16_t getRssi(void) {return 0;}
+float pidGetPreviousSetpoint(int) {return 0;}
+float mixerGetThrottle(void) {return 0;}
 uint8_t getMotorCount(void) {return 4;}
 bool areMotorsRunning(void) { return false; }
 bool IS_RC_MODE_ACTIVE(boxId_e) {return false;}
 bool isModeActivationConditionPresent(boxId_e) {return false;}
-uint32_t millis(void) {return 0;}
+uint32_t millis(void) {return millisValue;}
 bool sensors(uint32_t) {return false;}
-void serialWrite(serialPort_t *, uint8_t) {}
-uint32_t serialTxBytesFree(const serialPort_t *) {return 0;}
-bool isSerialTransmitBufferEmpty(const serialPort_t *) {return false;}
+void serialWrite(serialPort_t *, uint8_t ch) { serialWritten.push_back(ch); }
+void serialWriteBuf(serialPort_t *, const uint8_t *data, int count)
+{
+    serialWriteBufCalls++;
+    serialWritten.insert(serialWritten.end(), data, data + count);
+}
+uint32_t serialTxBytesFree(const serialPort_t *) {return serialTxBytesFreeValue;}
+bool isSerialTransmitBufferEmpty(const serialPort_t *) {return true;}
 bool featureIsEnabled(uint32_t) {return false;}
 void mspSerialReleasePortIfAllocated(serialPort_t *) {}
-const serialPortConfig_t *findSerialPortConfig(serialPortFunction_e ) {return NULL;}
+const serialPortConfig_t *findSerialPortConfig(serialPortFunction_e ) {return &blackboxSerialPortConfig;}
 serialPort_t *findSharedSerialPort(uint16_t , serialPortFunction_e ) {return NULL;}
-serialPort_t *openSerialPort(serialPortIdentifier_e, serialPortFunction_e, serialReceiveCallbackPtr, void *, uint32_t, portMode_e, portOptions_e) {return NULL;}
+serialPort_t *openSerialPort(serialPortIdentifier_e, serialPortFunction_e, serialReceiveCallbackPtr, void *, uint32_t, portMode_e, portOptions_e) {return &blackboxSerialPort;}
 void closeSerialPort(serialPort_t *) {}
 portSharing_e determinePortSharing(const serialPortConfig_t *, serialPortFunction_e ) {return PORTSHARING_UNUSED;}
 failsafePhase_e failsafePhase(void) {return FAILSAFE_IDLE;}
@@ -22,6 +22,8 @@
 
 #include <math.h>
 
+#include <string>
+
 extern "C" {
     #include "platform.h"
     #include "target.h"
@@ -55,15 +57,20 @@ extern "C" {
     #include "sensors/gyro.h"
 
     void cliSet(const char *cmdName, char *cmdline);
+    void cliDiff(const char *cmdName, char *cmdline);
+    bool pgSectionEqualsDefault(const pgRegistry_t *pg, uint16_t valueSection);
     int cliGetSettingIndex(char *name, uint8_t length);
     void *cliGetValuePointer(const clivalue_t *value);
     
     const clivalue_t valueTable[] = {
-        { "array_unit_test",   VAR_INT8  | MODE_ARRAY  | MASTER_VALUE, .config.array.length = 3,      PG_RESERVED_FOR_TESTING_1, 0 },
-        { "str_unit_test",     VAR_UINT8 | MODE_STRING | MASTER_VALUE, .config.string = { 0, 16, 0 }, PG_RESERVED_FOR_TESTING_1, 0 },
-        { "wos_unit_test",     VAR_UINT8 | MODE_STRING | MASTER_VALUE, .config.string = { 0, 16, STRING_FLAGS_WRITEONCE }, PG_RESERVED_FOR_TESTING_1, 0 },
+        { "array_unit_test",   VAR_INT8  | MODE_ARRAY  | MASTER_VALUE, { .array = { 3 } },      PG_RESERVED_FOR_TESTING_1, 0 },
+        { "str_unit_test",     VAR_UINT8 | MODE_STRING | MASTER_VALUE, { .string = { 0, 16, 0 } }, PG_RESERVED_FOR_TESTING_1, 0 },
+        { "wos_unit_test",     VAR_UINT8 | MODE_STRING | MASTER_VALUE, { .string = { 0, 16, STRING_FLAGS_WRITEONCE } }, PG_RESERVED_FOR_TESTING_1, 0 },
+        { "p_pitch",           VAR_UINT8 | MODE_DIRECT | PROFILE_VALUE, { .minmaxUnsigned = { 0, 200 } }, PG_PID_PROFILE, offsetof(pidProfile_t, pid[PID_PITCH].P) },
+        { "i_pitch",           VAR_UINT8 | MODE_DIRECT | PROFILE_VALUE, { .minmaxUnsigned = { 0, 200 } }, PG_PID_PROFILE, offsetof(pidProfile_t, pid[PID_PITCH].I) },
     };
     const uint16_t valueTableEntryCount = ARRAYLEN(valueTable);
+    const uint16_t valueTableNameIndex[] = { 0, 4, 3, 1, 2 };
     const lookupTableEntry_t lookupTables[] = {};
     const char * const lookupTableOsdDisplayPortDevice[] = {};
 
@@ -82,11 +89,12 @@ extern "C" {
     PG_REGISTER_ARRAY(servoMixer_t, MAX_SERVO_RULES, customServoMixers, PG_SERVO_MIXER, 0);
     PG_REGISTER(beeperConfig_t, beeperConfig, PG_BEEPER_CONFIG, 0);
     PG_REGISTER(rxConfig_t, rxConfig, PG_RX_CONFIG, 0);
-    PG_REGISTER(serialConfig_t, serialConfig, PG_SERIAL_CONFIG, 0);
+    PG_REGISTER_WITH_RESET_FN(serialConfig_t, serialConfig, PG_SERIAL_CONFIG, 0);
     PG_REGISTER_ARRAY(rxChannelRangeConfig_t, NON_AUX_CHANNEL_COUNT, rxChannelRangeConfigs, PG_RX_CHANNEL_RANGE_CONFIG, 0);
     PG_REGISTER_ARRAY(rxFailsafeChannelConfig_t, MAX_SUPPORTED_RC_CHANNEL_COUNT, rxFailsafeChannelConfigs, PG_RX_FAILSAFE_CHANNEL_CONFIG, 0);
     PG_REGISTER(pidConfig_t, pidConfig, PG_PID_CONFIG, 0);
     PG_REGISTER(gyroConfig_t, gyroConfig, PG_GYRO_CONFIG, 0);
+    PG_REGISTER_ARRAY_WITH_RESET_FN(pidProfile_t, PID_PROFILE_COUNT, pidProfiles, PG_PID_PROFILE, 0);
 
     PG_REGISTER_WITH_RESET_FN(int8_t, unitTestData, PG_RESERVED_FOR_TESTING_1, 0);
 }
@@ -193,6 +201,128 @@ TEST(CLIUnittest, TestCliSetStringWriteOnce)
     printf("\n");
 }
 
+static std::string cliOutput;
+static int resetConfigCount;
+
+static const pgRegistry_t *resetPidProfiles(void)
+{
+    const pgRegistry_t *pg = pgFind(PG_PID_PROFILE);
+    pgReset(pg);
+    return pg;
+}
+
+static void diff(const char *options)
+{
+    char cmdline[32];
+    strcpy(cmdline, options);
+    cliOutput.clear();
+    cliDiff("diff", cmdline);
+}
+
+static bool outputHas(const char *line)
+{
+    return cliOutput.find(line) != std::string::npos;
+}
+
+TEST(CLIUnittest, TestPgSectionEqualsDefault)
+{
+    // given
+    const pgRegistry_t *pg = resetPidProfiles();
+    pgResetInstance(pg, pg->copy);
+
+    // then
+    EXPECT_TRUE(pgSectionEqualsDefault(pg, PROFILE_VALUE));
+    EXPECT_TRUE(pgSectionEqualsDefault(pg, MASTER_VALUE));
+
+    // when
+    pidProfilesMutable(0)->pid[PID_PITCH].P = 10;
+
+    // then
+    // only the selected profile counts for the profile section
+    EXPECT_TRUE(pgSectionEqualsDefault(pg, PROFILE_VALUE));
+    EXPECT_FALSE(pgSectionEqualsDefault(pg, MASTER_VALUE));
+
+    // when
+    pidProfilesMutable(getCurrentPidProfileIndex())->pid[PID_PITCH].I = 10;
+
+    // then
+    EXPECT_FALSE(pgSectionEqualsDefault(pg, PROFILE_VALUE));
+}
+
+TEST(CLIUnittest, TestDiffShowsChangedValues)
+{
+    // given
+    serialPort_t cliPort;
+    cliEnter(&cliPort);
+    systemConfigMutable()->pidProfileIndex = 1;
+    resetPidProfiles();
+
+    // when
+    diff("profile");
+
+    // then
+    EXPECT_TRUE(outputHas("profile 1"));
+    EXPECT_FALSE(outputHas("set p_pitch"));
+    EXPECT_FALSE(outputHas("set i_pitch"));
+
+    // when
+    pidProfilesMutable(0)->pid[PID_PITCH].I = 60;
+    diff("profile");
+
+    // then
+    EXPECT_FALSE(outputHas("set i_pitch"));
+
+    // when
+    pidProfilesMutable(1)->pid[PID_PITCH].P = 55;
+    diff("profile");
+
+    // then
+    EXPECT_TRUE(outputHas("set p_pitch = 55"));
+    EXPECT_FALSE(outputHas("set i_pitch"));
+
+    // when
+    diff("profile defaults");
+
+    // then
+    EXPECT_TRUE(outputHas("#set p_pitch = 40"));
+    EXPECT_TRUE(outputHas("set p_pitch = 55"));
+
+    // when
+    pidProfilesMutable(1)->pid[PID_PITCH].P = 40;
+    diff("profile");
+
+    // then
+    EXPECT_FALSE(outputHas("set p_pitch"));
+}
+
+TEST(CLIUnittest, TestDiffLeavesTheLiveConfigAlone)
+{
+    // given
+    serialPort_t cliPort;
+    cliEnter(&cliPort);
+    systemConfigMutable()->pidProfileIndex = 1;
+    resetPidProfiles();
+    pidProfilesMutable(1)->pid[PID_PITCH].P = 55;
+    serialConfigMutable()->portConfigs[1].functionMask = FUNCTION_MSP;
+    resetConfigCount = 0;
+
+    // when
+    for (int i = 0; i < 3; i++) {
+        diff("profile");
+        EXPECT_TRUE(outputHas("set p_pitch = 55"));
+        diff("profile bare");
+        EXPECT_TRUE(outputHas("set p_pitch = 55"));
+    }
+
+    // then
+    // the defaults are built at most once, and the serial reset can't reach the live config
+    EXPECT_GE(1, resetConfigCount);
+    EXPECT_EQ(55, pidProfiles(1)->pid[PID_PITCH].P);
+    EXPECT_EQ(50, pidProfiles(1)->pid[PID_PITCH].I);
+    EXPECT_EQ(FUNCTION_MSP, serialConfig()->portConfigs[1].functionMask);
+    EXPECT_EQ(FUNCTION_RX_SERIAL, ((const serialConfig_t *)pgFind(PG_SERIAL_CONFIG)->copy)->portConfigs[1].functionMask);
+}
+
 // STUBS
 extern "C" {
 
@@ -241,6 +371,21 @@ void pgResetFn_unitTestData(int8_t *ptr) {
     ptr = &unitTestDataArray[0];
 }
 
+void pgResetFn_pidProfiles(pidProfile_t *pidProfiles)
+{
+    for (int i = 0; i < PID_PROFILE_COUNT; i++) {
+        pidProfiles[i].pid[PID_PITCH].P = 40;
+        pidProfiles[i].pid[PID_PITCH].I = 50;
+    }
+}
+
+// Like the real reset, this finds the RX port through the live config rather than the instance being reset
+void pgResetFn_serialConfig(serialConfig_t *serialConfig)
+{
+    memset(serialConfig, 0, sizeof(serialConfig_t));
+    serialConfigMutable()->portConfigs[1].functionMask = FUNCTION_RX_SERIAL;
+}
+
 uint32_t getBeeperOffMask(void) { return 0; }
 uint32_t getPreferredBeeperOffMask(void) { return 0; }
 
@@ -301,6 +446,7 @@ uint8_t __config_end = 0x10;
 uint16_t averageSystemLoadPercent = 0;
 
 timeDelta_t getTaskDeltaTimeUs(taskId_e){ return 0; }
+uint32_t blackboxGetDroppedFrameCount(void) { return 0; }
 uint16_t currentRxRefreshRate = 9000;
 armingDisableFlags_e getArmingDisableFlags(void) { return ARMING_DISABLED_NO_GYRO; }
 
@@ -321,15 +467,15 @@ const char * const shortGitRevision = "MASTER";
 uint32_t serialRxBytesWaiting(const serialPort_t *) {return 0;}
 uint8_t serialRead(serialPort_t *){return 0;}
 
-void bufWriterAppend(bufWriter_t *, uint8_t ch){ printf("%c", ch); }
+void bufWriterAppend(bufWriter_t *, uint8_t ch){ cliOutput += ch; }
 void serialWriteBufShim(void *, const uint8_t *, int) {}
-bufWriter_t *bufWriterInit(uint8_t *, int, bufWrite_t, void *) {return NULL;}
+bufWriter_t *bufWriterInit(uint8_t *b, int, bufWrite_t, void *) {return (bufWriter_t *)b;}
 void schedulerSetCalulateTaskStatistics(bool) {}
 void setArmingDisabled(armingDisableFlags_e) {}
 
 void waitForSerialPortToFinishTransmitting(serialPort_t *) {}
 void systemResetToBootloader(void) {}
-void resetConfig(void) {}
+void resetConfig(void) { resetConfigCount++; pgResetAll(); }
 void systemReset(void) {}
 void writeUnmodifiedConfigToEEPROM(void) {}
 
@@ -114,3 +114,88 @@ TEST(FilterUnittest, TestSlewFilter)
     slewFilterApply(&filter, 200.0f);
     EXPECT_EQ(200, filter.state);
 }
+
+TEST(FilterUnittest, TestPt1FilterBankMatchesPt1Filter)
+{
+    pt1Filter_t filter[XYZ_AXIS_COUNT];
+    pt1FilterBank_t bank;
+    const float k = pt1FilterGain(100.0f, 125e-6f);
+
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        pt1FilterInit(&filter[axis], k);
+    }
+    pt1FilterBankInit(&bank, k);
+
+    for (int i = 0; i < 100; i++) {
+        float data[XYZ_AXIS_COUNT] = { 1000.0f * sinf(i * 0.3f), -500.0f + i, 50.0f * (i % 7) };
+        float expected[XYZ_AXIS_COUNT];
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            expected[axis] = pt1FilterApply(&filter[axis], data[axis]);
+        }
+        pt1FilterBankApply(&bank, data);
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            EXPECT_FLOAT_EQ(expected[axis], data[axis]);
+        }
+    }
+}
+
+TEST(FilterUnittest, TestBiquadFilterBankMatchesBiquadFilter)
+{
+    biquadFilter_t filter[XYZ_AXIS_COUNT];
+    biquadFilter_t filterDF1[XYZ_AXIS_COUNT];
+    biquadFilterBank_t bank;
+    biquadFilterBank_t bankDF1;
+    const uint32_t looptime = 125;
+    const float notchQ = filterGetNotchQ(260.0f, 160.0f);
+
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        biquadFilterInit(&filter[axis], 260.0f, looptime, notchQ, FILTER_NOTCH);
+        biquadFilterInit(&filterDF1[axis], 260.0f, looptime, notchQ, FILTER_NOTCH);
+    }
+    biquadFilterBankInit(&bank, 260.0f, looptime, notchQ, FILTER_NOTCH);
+    biquadFilterBankInit(&bankDF1, 260.0f, looptime, notchQ, FILTER_NOTCH);
+
+    for (int i = 0; i < 200; i++) {
+        if (i == 100) {
+            // retune one axis of the DF1 bank, as the dynamic notch does
+            biquadFilterUpdate(&filterDF1[Y], 180.0f, looptime, notchQ, FILTER_NOTCH);
+            biquadFilterBankUpdateAxis(&bankDF1, Y, 180.0f, looptime, notchQ, FILTER_NOTCH);
+        }
+        const float input[XYZ_AXIS_COUNT] = { 800.0f * sinf(i * 0.2f), 300.0f * cosf(i * 0.7f), 20.0f * i };
+        float data[XYZ_AXIS_COUNT] = { input[X], input[Y], input[Z] };
+        float dataDF1[XYZ_AXIS_COUNT] = { input[X], input[Y], input[Z] };
+
+        biquadFilterBankApply(&bank, data);
+        biquadFilterBankApplyDF1(&bankDF1, dataDF1);
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            EXPECT_FLOAT_EQ(biquadFilterApply(&filter[axis], input[axis]), data[axis]);
+            EXPECT_FLOAT_EQ(biquadFilterApplyDF1(&filterDF1[axis], input[axis]), dataDF1[axis]);
+        }
+    }
+}
+
+TEST(FilterUnittest, TestBiquadFilterBankUpdateKeepsState)
+{
+    biquadFilter_t filter;
+    biquadFilterBank_t bank;
+
+    biquadFilterInitLPF(&filter, 100.0f, 125);
+    biquadFilterBankInitLPF(&bank, 100.0f, 125);
+
+    for (int i = 0; i < 50; i++) {
+        float data[XYZ_AXIS_COUNT] = { 100.0f, 100.0f, 100.0f };
+        const float expected = biquadFilterApplyDF1(&filter, 100.0f);
+        biquadFilterBankApplyDF1(&bank, data);
+        EXPECT_FLOAT_EQ(expected, data[Z]);
+    }
+
+    biquadFilterUpdateLPF(&filter, 250.0f, 125);
+    biquadFilterBankUpdateLPF(&bank, 250.0f, 125);
+
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        EXPECT_FLOAT_EQ(filter.b0, bank.b0[axis]);
+        EXPECT_FLOAT_EQ(filter.a2, bank.a2[axis]);
+        EXPECT_FLOAT_EQ(filter.y1, bank.y1[axis]);
+        EXPECT_FLOAT_EQ(filter.x2, bank.x2[axis]);
+    }
+}
@@ -0,0 +1,530 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <chrono>
+#include <vector>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "common/crc.h"
+    #include "common/utils.h"
+
+    #include "config/config_eeprom.h"
+    #include "config/config_streamer.h"
+
+    #include "drivers/system.h"
+
+    #include "pg/pg.h"
+
+    uint8_t eepromData[EEPROM_SIZE];
+
+// A fully populated registry: 128 groups of assorted sizes and versions, with PGNs spread over the whole range
+#define TEST_PG_COUNT       128
+#define TEST_PGN(n)         (100 + ((n) * 29) % 3900)
+
+#define TEST_PG_I(n) \
+    typedef struct testConfig ## n ## _s { uint8_t data[4 + (n) % 13]; } testConfig ## n ## _t; \
+    PG_DECLARE(testConfig ## n ## _t, testConfig ## n); \
+    PG_REGISTER(testConfig ## n ## _t, testConfig ## n, TEST_PGN(n), (n) % 3)
+#define TEST_PG(n) TEST_PG_I(n)
+#define TEST_PG_8 \
+    TEST_PG(__COUNTER__); TEST_PG(__COUNTER__); TEST_PG(__COUNTER__); TEST_PG(__COUNTER__); \
+    TEST_PG(__COUNTER__); TEST_PG(__COUNTER__); TEST_PG(__COUNTER__); TEST_PG(__COUNTER__)
+
+    TEST_PG_8; TEST_PG_8; TEST_PG_8; TEST_PG_8;
+    TEST_PG_8; TEST_PG_8; TEST_PG_8; TEST_PG_8;
+    TEST_PG_8; TEST_PG_8; TEST_PG_8; TEST_PG_8;
+    TEST_PG_8; TEST_PG_8; TEST_PG_8; TEST_PG_8;
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+// Layout of the stored config, see config_eeprom.c
+#define CONFIG_HEADER_SIZE      2
+#define CONFIG_RECORD_SIZE      6
+#define CONFIG_MAGIC            0xBE
+
+typedef struct loadResult_s {
+    bool success;
+    std::vector<uint8_t> ram;
+} loadResult_t;
+
+// The loader as it was before the records were indexed: scan the EEPROM from the start for every PG
+static const uint8_t *findRecordLinear(const pgRegistry_t *reg)
+{
+    const uint8_t *p = &__config_start + CONFIG_HEADER_SIZE;
+    while (true) {
+        const uint16_t size = p[0] | (p[1] << 8);
+        const pgn_t pgn = p[2] | (p[3] << 8);
+        if (size == 0 || p + size >= &__config_end || size < CONFIG_RECORD_SIZE) {
+            return NULL;
+        }
+        if (pgn == pgN(reg) && (p[5] & 0x3) == 0) {
+            return p;
+        }
+        p += size;
+    }
+}
+
+static bool loadEEPROMLinear(void)
+{
+    bool success = true;
+    PG_FOREACH(reg) {
+        const uint8_t *record = findRecordLinear(reg);
+        if (record) {
+            const uint16_t size = record[0] | (record[1] << 8);
+            if (!pgLoad(reg, record + CONFIG_RECORD_SIZE, size - CONFIG_RECORD_SIZE, record[4])) {
+                success = false;
+            }
+        } else {
+            pgReset(reg);
+            success = false;
+        }
+    }
+    return success;
+}
+
+static void scrambleRam(uint8_t value)
+{
+    PG_FOREACH(reg) {
+        memset(reg->address, value, pgSize(reg));
+    }
+}
+
+static std::vector<uint8_t> snapshotRam(void)
+{
+    std::vector<uint8_t> ram;
+    PG_FOREACH(reg) {
+        ram.insert(ram.end(), reg->address, reg->address + pgSize(reg));
+    }
+    return ram;
+}
+
+static loadResult_t runLoad(bool (*load)(void))
+{
+    scrambleRam(0xA5);
+    loadResult_t result;
+    result.success = load();
+    result.ram = snapshotRam();
+    return result;
+}
+
+static void expectSameAsLinearScan(void)
+{
+    const loadResult_t expected = runLoad(loadEEPROMLinear);
+    const loadResult_t actual = runLoad(loadEEPROM);
+    EXPECT_EQ(expected.success, actual.success);
+    EXPECT_TRUE(expected.ram == actual.ram);
+}
+
+// Builds config images record by record, including ones writeConfigToEEPROM() never would
+class configImage {
+public:
+    configImage()
+    {
+        bytes.push_back(EEPROM_CONF_VERSION);
+        bytes.push_back(CONFIG_MAGIC);
+    }
+
+    void addRecord(pgn_t pgn, uint8_t version, uint8_t flags, int payloadSize, uint8_t fill)
+    {
+        const uint16_t size = CONFIG_RECORD_SIZE + payloadSize;
+        bytes.push_back(size & 0xFF);
+        bytes.push_back(size >> 8);
+        bytes.push_back(pgn & 0xFF);
+        bytes.push_back(pgn >> 8);
+        bytes.push_back(version);
+        bytes.push_back(flags);
+        bytes.insert(bytes.end(), payloadSize, fill);
+    }
+
+    void addRecord(const pgRegistry_t *reg, uint8_t fill)
+    {
+        addRecord(pgN(reg), pgVersion(reg), 0, pgSize(reg), fill);
+    }
+
+    // Stores the image as writeConfigToEEPROM() would, but without the log after it, and validates it
+    void store(void)
+    {
+        std::vector<uint8_t> image = bytes;
+        image.push_back(0);     // the terminator, a zero size record
+        image.push_back(0);
+        const uint16_t crc = crc16_ccitt_update(0xFFFF, image.data(), image.size());
+        const uint16_t invertedBigEndianCrc = ~(((crc & 0xFF) << 8) | (crc >> 8));
+        image.push_back(invertedBigEndianCrc & 0xFF);
+        image.push_back(invertedBigEndianCrc >> 8);
+
+        ASSERT_LE(image.size(), sizeof(eepromData));
+        memset(eepromData, 0xFF, sizeof(eepromData));
+        memcpy(eepromData, image.data(), image.size());
+        EXPECT_TRUE(isEEPROMStructureValid());
+    }
+
+private:
+    std::vector<uint8_t> bytes;
+};
+
+static const pgRegistry_t *registryEntry(int index)
+{
+    return &__pg_registry_start[index];
+}
+
+TEST(ConfigEepromTest, TestLoadSavedConfig)
+{
+    ASSERT_EQ(TEST_PG_COUNT, PG_REGISTRY_SIZE);
+
+    int i = 0;
+    PG_FOREACH(reg) {
+        for (int j = 0; j < pgSize(reg); j++) {
+            reg->address[j] = i + j;
+        }
+        i++;
+    }
+    const std::vector<uint8_t> saved = snapshotRam();
+
+    memset(eepromData, 0xFF, sizeof(eepromData));
+    writeConfigToEEPROM();
+    EXPECT_TRUE(isEEPROMVersionValid());
+    EXPECT_TRUE(isEEPROMStructureValid());
+
+    scrambleRam(0);
+    EXPECT_TRUE(loadEEPROM());
+    EXPECT_TRUE(saved == snapshotRam());
+
+    expectSameAsLinearScan();
+}
+
+TEST(ConfigEepromTest, TestLoadMatchesLinearScan)
+{
+    // records in reverse order
+    {
+        configImage image;
+        for (int i = TEST_PG_COUNT - 1; i >= 0; i--) {
+            image.addRecord(registryEntry(i), i);
+        }
+        image.store();
+        expectSameAsLinearScan();
+        EXPECT_TRUE(loadEEPROM());
+    }
+
+    // missing records, duplicates (the first one wins), unknown PGNs, other classifications and old versions
+    {
+        configImage image;
+        image.addRecord(4000, 0, 0, 10, 0x11);
+        for (int i = 0; i < TEST_PG_COUNT; i += 2) {
+            const pgRegistry_t *reg = registryEntry(i);
+            if (i % 6 == 0) {
+                image.addRecord(pgN(reg), pgVersion(reg), 1, pgSize(reg), 0x22);
+            }
+            if (i % 10 == 0) {
+                image.addRecord(pgN(reg), pgVersion(reg) + 1, 0, pgSize(reg), 0x33);
+            }
+            image.addRecord(reg, i);
+            if (i % 4 == 0) {
+                image.addRecord(reg, 0x44);
+            }
+        }
+        image.store();
+        expectSameAsLinearScan();
+        EXPECT_FALSE(loadEEPROM());
+    }
+
+    // shorter and longer records than the PG
+    {
+        configImage image;
+        for (int i = 0; i < TEST_PG_COUNT; i++) {
+            const pgRegistry_t *reg = registryEntry(i);
+            image.addRecord(pgN(reg), pgVersion(reg), 0, pgSize(reg) + (i % 3) - 1, 0x55);
+        }
+        image.store();
+        expectSameAsLinearScan();
+    }
+
+    // no records at all
+    {
+        configImage image;
+        image.store();
+        expectSameAsLinearScan();
+        EXPECT_FALSE(loadEEPROM());
+    }
+}
+
+TEST(ConfigEepromTest, TestLoadWithMoreRecordsThanIndexSlots)
+{
+    // Unknown records fill the index before the real ones, which must still be found
+    configImage image;
+    for (pgn_t pgn = 1, added = 0; added < 240; pgn++) {
+        if (!pgFind(pgn)) {
+            image.addRecord(pgn, 0, 0, 0, 0);
+            added++;
+        }
+    }
+    for (int i = 0; i < TEST_PG_COUNT; i++) {
+        image.addRecord(registryEntry(i), i);
+    }
+    image.addRecord(registryEntry(0), 0x66);
+    image.store();
+
+    expectSameAsLinearScan();
+    EXPECT_TRUE(loadEEPROM());
+}
+
+TEST(ConfigEepromTest, TestLoadTime)
+{
+    configImage image;
+    for (int i = 0; i < TEST_PG_COUNT; i++) {
+        image.addRecord(registryEntry(i), i);
+    }
+    image.store();
+
+    const int repeats = 200;
+    double linearUs = 0;
+    double indexedUs = 0;
+    // alternate so both loaders see the same cache and frequency conditions
+    for (int i = 0; i < repeats; i++) {
+        auto start = std::chrono::steady_clock::now();
+        loadEEPROMLinear();
+        auto end = std::chrono::steady_clock::now();
+        linearUs += std::chrono::duration<double, std::micro>(end - start).count();
+
+        start = std::chrono::steady_clock::now();
+        loadEEPROM();
+        end = std::chrono::steady_clock::now();
+        indexedUs += std::chrono::duration<double, std::micro>(end - start).count();
+    }
+
+    printf("loading %d PGs: linear scan %.1fus, indexed %.1fus\n", TEST_PG_COUNT, linearUs / repeats, indexedUs / repeats);
+    EXPECT_LT(indexedUs, linearUs);
+}
+
+static void fillRam(void)
+{
+    int i = 0;
+    PG_FOREACH(reg) {
+        for (int j = 0; j < pgSize(reg); j++) {
+            reg->address[j] = i * 7 + j;
+        }
+        i++;
+    }
+}
+
+static void expectLoadGives(const std::vector<uint8_t> &ram)
+{
+    scrambleRam(0xA5);
+    EXPECT_TRUE(loadEEPROM());
+    EXPECT_TRUE(ram == snapshotRam());
+}
+
+// The streamer stub behaves like embedded flash, see the stubs below
+#define TEST_FLASH_PAGE_SIZE 1024
+
+static int streamerProgrammedBytes;
+static int streamerErasedPages;
+
+TEST(ConfigEepromTest, TestSaveAppendsModifiedPGs)
+{
+    memset(eepromData, 0xFF, sizeof(eepromData));
+    fillRam();
+    writeConfigToEEPROM();
+    const int fullSize = getEEPROMConfigSize();
+    const std::vector<uint8_t> fullCopy(eepromData, eepromData + fullSize);
+
+    // nothing changed, nothing is written
+    streamerProgrammedBytes = 0;
+    writeConfigToEEPROM();
+    EXPECT_EQ(0, streamerProgrammedBytes);
+    EXPECT_EQ(fullSize, getEEPROMConfigSize());
+
+    // only the modified PGs are written, after what was there
+    registryEntry(3)->address[0]++;
+    registryEntry(77)->address[pgSize(registryEntry(77)) - 1]++;
+    streamerProgrammedBytes = 0;
+    writeConfigToEEPROM();
+    const int segmentSize = 4 + 6 + pgSize(registryEntry(3)) + 6 + pgSize(registryEntry(77)) + 2 + 2;
+    EXPECT_LE(segmentSize, streamerProgrammedBytes);
+    EXPECT_GT(segmentSize + 4, streamerProgrammedBytes);
+    EXPECT_LT(streamerProgrammedBytes * 10, fullSize);
+    EXPECT_TRUE(fullCopy == std::vector<uint8_t>(eepromData, eepromData + fullSize));
+    EXPECT_TRUE(isEEPROMVersionValid());
+    EXPECT_TRUE(isEEPROMStructureValid());
+
+    const std::vector<uint8_t> saved = snapshotRam();
+    expectLoadGives(saved);
+
+    // and again, the newest record wins
+    registryEntry(3)->address[0]++;
+    writeConfigToEEPROM();
+    expectLoadGives(snapshotRam());
+}
+
+TEST(ConfigEepromTest, TestSaveCompactsWhenTheLogIsFull)
+{
+    memset(eepromData, 0xFF, sizeof(eepromData));
+    fillRam();
+    writeConfigToEEPROM();
+    const int fullSize = getEEPROMConfigSize();
+
+    int compactions = 0;
+    int previousSize = fullSize;
+    for (int save = 0; save < 300; save++) {
+        // a few of the bigger PGs change between saves
+        for (int i = 0; i < 3; i++) {
+            const pgRegistry_t *reg = registryEntry((save * 5 + i * 41) % TEST_PG_COUNT);
+            reg->address[save % pgSize(reg)] += 1 + i;
+        }
+        writeConfigToEEPROM();
+
+        const int size = getEEPROMConfigSize();
+        if (size < previousSize) {
+            compactions++;
+            EXPECT_GE(size, fullSize);
+        }
+        previousSize = size;
+
+        const std::vector<uint8_t> saved = snapshotRam();
+        expectLoadGives(saved);
+    }
+
+    // the log holds at most 32 segments, but these fill the space first
+    EXPECT_GE(compactions, 300 / 32);
+    EXPECT_LE(compactions, 300 / 2);
+}
+
+TEST(ConfigEepromTest, TestLoadIgnoresAnIncompleteSegment)
+{
+    memset(eepromData, 0xFF, sizeof(eepromData));
+    fillRam();
+    writeConfigToEEPROM();
+    const std::vector<uint8_t> before = snapshotRam();
+    const int sizeBefore = getEEPROMConfigSize();
+
+    // power lost while the end of the segment was written
+    registryEntry(10)->address[0]++;
+    registryEntry(20)->address[0]++;
+    writeConfigToEEPROM();
+    const int end = getEEPROMConfigSize();
+    memset(&eepromData[end - 5], 0xFF, 5);
+
+    EXPECT_TRUE(isEEPROMStructureValid());
+    EXPECT_LT(sizeBefore, end);
+    EXPECT_EQ(sizeBefore, getEEPROMConfigSize());
+    expectLoadGives(before);
+
+    // the partly written bytes can not be written again, so the next save compacts the log
+    registryEntry(30)->address[0]++;
+    streamerErasedPages = 0;
+    writeConfigToEEPROM();
+    EXPECT_LT(0, streamerErasedPages);
+    expectLoadGives(snapshotRam());
+}
+
+TEST(ConfigEepromTest, TestSaveAfterConfigWithoutLog)
+{
+    // a config saved by firmware that did not have the log is compacted on the first save
+    configImage image;
+    for (int i = 0; i < TEST_PG_COUNT; i++) {
+        image.addRecord(registryEntry(i), i);
+    }
+    image.store();
+    EXPECT_TRUE(loadEEPROM());
+
+    registryEntry(0)->address[0]++;
+    streamerErasedPages = 0;
+    writeConfigToEEPROM();
+    EXPECT_LT(0, streamerErasedPages);
+    expectLoadGives(snapshotRam());
+
+    registryEntry(0)->address[0]++;
+    streamerErasedPages = 0;
+    writeConfigToEEPROM();
+    EXPECT_EQ(0, streamerErasedPages);
+    expectLoadGives(snapshotRam());
+}
+
+// STUBS
+
+extern "C" {
+
+void failureMode(failureMode_e mode)
+{
+    FAIL() << "failureMode(" << mode << ")";
+}
+
+// Writes to eepromData like embedded flash: pages are erased when writing reaches their start and only erased bytes
+// can be programmed
+void config_streamer_init(config_streamer_t *c)
+{
+    memset(c, 0, sizeof(*c));
+}
+
+void config_streamer_start(config_streamer_t *c, uintptr_t base, int size)
+{
+    c->address = base;
+    c->start = base;
+    c->size = size;
+}
+
+int config_streamer_write(config_streamer_t *c, const uint8_t *p, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++) {
+        uint8_t *dest = (uint8_t *)c->address;
+        EXPECT_LT(dest, ARRAYEND(eepromData));
+        if ((dest - eepromData) % TEST_FLASH_PAGE_SIZE == 0) {
+            memset(dest, 0xFF, TEST_FLASH_PAGE_SIZE);
+            streamerErasedPages++;
+        }
+        EXPECT_EQ(0xFF, *dest);
+        *dest = p[i];
+        streamerProgrammedBytes++;
+        c->address++;
+    }
+    return 0;
+}
+
+bool config_streamer_is_writable(uintptr_t address, int size)
+{
+    const uint8_t *p = (const uint8_t *)address;
+    for (int i = 0; i < size && (p + i - eepromData) % TEST_FLASH_PAGE_SIZE != 0; i++) {
+        if (p[i] != 0xFF) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int config_streamer_flush(config_streamer_t *c)
+{
+    // pad to the streamer word
+    const uint8_t zero = 0;
+    while ((c->address - c->start) % CONFIG_STREAMER_BUFFER_SIZE) {
+        config_streamer_write(c, &zero, 1);
+    }
+    return 0;
+}
+
+int config_streamer_finish(config_streamer_t *) {return 0;}
+
+}
@@ -0,0 +1,161 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "common/crc.h"
+    #include "common/maths.h"
+    #include "common/streambuf.h"
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+// Bit at a time versions of the CRCs, as they were before the table driven ones
+static uint16_t referenceCrc16Ccitt(uint16_t crc, uint8_t a)
+{
+    crc ^= (uint16_t)a << 8;
+    for (int i = 0; i < 8; i++) {
+        crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+    }
+    return crc;
+}
+
+static uint8_t referenceCrc8DvbS2(uint8_t crc, uint8_t a)
+{
+    crc ^= a;
+    for (int i = 0; i < 8; i++) {
+        crc = (crc & 0x80) ? (crc << 1) ^ 0xD5 : crc << 1;
+    }
+    return crc;
+}
+
+static uint8_t testData[300];
+
+static void fillTestData(void)
+{
+    uint32_t state = 1;
+    for (unsigned i = 0; i < sizeof(testData); i++) {
+        state = state * 1664525 + 1013904223;
+        testData[i] = state >> 24;
+    }
+}
+
+TEST(CrcUnittest, CheckValues)
+{
+    static const char check[] = "123456789";
+
+    // CRC-16/XMODEM and CRC-8/DVB-S2 check values
+    EXPECT_EQ(0x31C3, crc16_ccitt_update(0, check, strlen(check)));
+    EXPECT_EQ(0xBC, crc8_dvb_s2_update(0, check, strlen(check)));
+}
+
+TEST(CrcUnittest, SingleByteMatchesReference)
+{
+    // counted rather than asserted one at a time to keep the test quick, every crc16 with a spread
+    // of bytes reaches every table entry with every low byte
+    int mismatches16 = 0;
+    for (int crc = 0; crc < 0x10000; crc++) {
+        for (int a = 0; a < 256; a += 17) {
+            mismatches16 += referenceCrc16Ccitt(crc, a) != crc16_ccitt(crc, a);
+        }
+    }
+    EXPECT_EQ(0, mismatches16);
+
+    // every crc8 and byte value
+    int mismatches8 = 0;
+    for (int crc = 0; crc < 256; crc++) {
+        for (int a = 0; a < 256; a++) {
+            mismatches8 += referenceCrc8DvbS2(crc, a) != crc8_dvb_s2(crc, a);
+        }
+    }
+    EXPECT_EQ(0, mismatches8);
+}
+
+TEST(CrcUnittest, UpdateMatchesReference)
+{
+    fillTestData();
+
+    // every length around the 4 byte unrolling, from unaligned starts, with non zero seeds
+    for (int offset = 0; offset < 4; offset++) {
+        for (unsigned length = 0; length + offset <= sizeof(testData); length++) {
+            const uint8_t *data = testData + offset;
+            const uint16_t seed16 = 0x1D0F * offset;
+            const uint8_t seed8 = 0x5A * offset;
+
+            uint16_t expected16 = seed16;
+            uint8_t expected8 = seed8;
+            for (unsigned i = 0; i < length; i++) {
+                expected16 = referenceCrc16Ccitt(expected16, data[i]);
+                expected8 = referenceCrc8DvbS2(expected8, data[i]);
+            }
+
+            ASSERT_EQ(expected16, crc16_ccitt_update(seed16, data, length)) << "offset " << offset << " length " << length;
+            ASSERT_EQ(expected8, crc8_dvb_s2_update(seed8, data, length)) << "offset " << offset << " length " << length;
+        }
+    }
+}
+
+TEST(CrcUnittest, UpdateInChunks)
+{
+    fillTestData();
+
+    const uint16_t whole16 = crc16_ccitt_update(0, testData, sizeof(testData));
+    const uint8_t whole8 = crc8_dvb_s2_update(0, testData, sizeof(testData));
+
+    for (unsigned chunk = 1; chunk <= 9; chunk++) {
+        uint16_t crc16 = 0;
+        uint8_t crc8 = 0;
+        for (unsigned i = 0; i < sizeof(testData); i += chunk) {
+            const unsigned length = MIN(chunk, sizeof(testData) - i);
+            crc16 = crc16_ccitt_update(crc16, testData + i, length);
+            crc8 = crc8_dvb_s2_update(crc8, testData + i, length);
+        }
+        EXPECT_EQ(whole16, crc16) << "chunk " << chunk;
+        EXPECT_EQ(whole8, crc8) << "chunk " << chunk;
+    }
+}
+
+TEST(CrcUnittest, SbufAppend)
+{
+    fillTestData();
+
+    uint8_t buf[64];
+    sbuf_t sbuf;
+
+    memcpy(buf, testData, 40);
+    sbufInit(&sbuf, buf + 40, buf + sizeof(buf));
+    crc8_dvb_s2_sbuf_append(&sbuf, buf + 3);
+    EXPECT_EQ(buf + 41, sbuf.ptr);
+    EXPECT_EQ(crc8_dvb_s2_update(0, testData + 3, 37), buf[40]);
+
+    sbufInit(&sbuf, buf + 40, buf + sizeof(buf));
+    crc16_ccitt_sbuf_append(&sbuf, buf + 5);
+    EXPECT_EQ(buf + 42, sbuf.ptr);
+    const uint16_t crc16 = crc16_ccitt_update(0, testData + 5, 35);
+    EXPECT_EQ(crc16 & 0xFF, buf[40]);
+    EXPECT_EQ(crc16 >> 8, buf[41]);
+}
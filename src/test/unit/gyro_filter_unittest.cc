@@ -0,0 +1,257 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "build/debug.h"
+
+    #include "common/axis.h"
+    #include "common/filter.h"
+    #include "common/maths.h"
+
+    #include "config/feature.h"
+
+    #include "drivers/sensor.h"
+
+    #include "flight/rpm_filter.h"
+
+    #include "io/beeper.h"
+
+    #include "pg/motor.h"
+    #include "pg/pg.h"
+    #include "pg/pg_ids.h"
+
+    #include "scheduler/scheduler.h"
+
+    #include "sensors/gyro.h"
+    #include "sensors/gyro_init.h"
+    #include "sensors/sensors.h"
+
+    PG_REGISTER(motorConfig_t, motorConfig, PG_MOTOR_CONFIG, 0);
+    PG_REGISTER(rpmFilterConfig_t, rpmFilterConfig, PG_RPM_FILTER_CONFIG, 0);
+
+    uint8_t debugMode;
+    int16_t debug[DEBUG16_VALUE_COUNT];
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define SAMPLE_COUNT 4000
+
+extern "C" float rpmFilterState[XYZ_AXIS_COUNT];
+
+typedef struct filterSetup_s {
+    bool rpm;
+    bool notches;
+    uint8_t lowpassType;
+    uint16_t lowpassHz;
+    uint16_t dynLpfMinHz;
+    uint8_t dynNotchWidthPercent;
+    uint8_t dynNotchCount;
+} filterSetup_t;
+
+static void initGyroFilters(const filterSetup_t *setup, uint8_t mode)
+{
+    pgResetAll();
+    featureEnableImmediate(FEATURE_DYNAMIC_FILTER);
+
+    motorConfigMutable()->dev.useDshotTelemetry = setup->rpm;
+    rpmFilterConfigMutable()->gyro_rpm_notch_harmonics = setup->rpm ? 3 : 0;
+
+    gyroConfigMutable()->gyro_soft_notch_hz_1 = setup->notches ? 300 : 0;
+    gyroConfigMutable()->gyro_soft_notch_cutoff_1 = 200;
+    gyroConfigMutable()->gyro_soft_notch_hz_2 = 0;
+    gyroConfigMutable()->gyro_lowpass_type = setup->lowpassType;
+    gyroConfigMutable()->gyro_lowpass_hz = setup->lowpassHz;
+    gyroConfigMutable()->dyn_lpf_gyro_min_hz = setup->dynLpfMinHz;
+    gyroConfigMutable()->gyro_lowpass2_hz = 0;
+    gyroConfigMutable()->dyn_notch_width_percent = setup->dynNotchWidthPercent;
+    gyroConfigMutable()->dyn_notch_count = setup->dynNotchCount;
+
+    // both runs of a setup start from the same filter and analyser state
+    memset(rpmFilterState, 0, sizeof(rpmFilterState));
+    memset(&gyro.gyroAnalyseState, 0, sizeof(gyro.gyroAnalyseState));
+
+    debugMode = mode;
+    gyroInit();
+    gyroSetTargetLooptime(1);
+    gyroInitFilters();
+}
+
+// Runs the gyro filters over a sweep with a fixed tone on top, the filtered output goes in output
+static void runGyroFilters(float output[SAMPLE_COUNT][XYZ_AXIS_COUNT])
+{
+    const float dT = gyro.targetLooptime * 1e-6f;
+    for (int i = 0; i < SAMPLE_COUNT; i++) {
+        const float t = i * dT;
+        const float sweepHz = 100 + 400 * (float)i / SAMPLE_COUNT;
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            gyro.sampleSum[axis] = (axis + 1) * 100 * sin_approx(fmodf(2 * M_PIf * sweepHz * t, 2 * M_PIf) - M_PIf)
+                + 20 * sinf(2 * M_PIf * 240 * t) + 10 * axis;
+        }
+        gyro.sampleCount = 1;
+        gyroFiltering(0);
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            output[i][axis] = gyro.gyroADCf[axis];
+        }
+    }
+}
+
+static float variantOutput[SAMPLE_COUNT][XYZ_AXIS_COUNT];
+static float genericOutput[SAMPLE_COUNT][XYZ_AXIS_COUNT];
+
+// The filterGyro variant picked at init must give exactly the same output as the generic
+// function pointer path, which is the one the gyro debug modes use
+static void expectVariantMatchesGeneric(const filterSetup_t *setup)
+{
+    initGyroFilters(setup, DEBUG_NONE);
+    EXPECT_EQ(DEBUG_NONE, gyro.gyroDebugMode);
+    runGyroFilters(variantOutput);
+
+    initGyroFilters(setup, DEBUG_FFT);
+    EXPECT_EQ(DEBUG_FFT, gyro.gyroDebugMode);
+    runGyroFilters(genericOutput);
+
+    for (int i = 0; i < SAMPLE_COUNT; i++) {
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            ASSERT_EQ(genericOutput[i][axis], variantOutput[i][axis]) << "sample " << i << " axis " << axis;
+        }
+    }
+}
+
+TEST(GyroFilterUnittest, VariantsMatchGenericFilters)
+{
+    for (int rpm = 0; rpm <= 1; rpm++) {
+        for (int notches = 0; notches <= 1; notches++) {
+            for (int lowpassType = FILTER_PT1; lowpassType <= FILTER_BIQUAD; lowpassType++) {
+                for (int dynLpf = 0; dynLpf <= 1; dynLpf++) {
+                    for (int dual = 0; dual <= 1; dual++) {
+                        const filterSetup_t setup = {
+                            .rpm = (bool)rpm,
+                            .notches = (bool)notches,
+                            .lowpassType = (uint8_t)lowpassType,
+                            .lowpassHz = 150,
+                            .dynLpfMinHz = (uint16_t)(dynLpf ? 200 : 0),
+                            .dynNotchWidthPercent = (uint8_t)(dual ? 8 : 0),
+                            .dynNotchCount = (uint8_t)(dual ? 1 : 3),
+                        };
+                        SCOPED_TRACE(testing::Message() << "rpm " << rpm << " notches " << notches << " lowpass " << lowpassType
+                            << " dynLpf " << dynLpf << " dual " << dual);
+                        expectVariantMatchesGeneric(&setup);
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST(GyroFilterUnittest, VariantSelection)
+{
+    filterSetup_t setup = {
+        .rpm = false,
+        .notches = false,
+        .lowpassType = FILTER_PT1,
+        .lowpassHz = 150,
+        .dynLpfMinHz = 0,
+        .dynNotchWidthPercent = 0,
+        .dynNotchCount = 1,
+    };
+
+    // no lowpass filter has no variant, so it runs the generic filters
+    setup.lowpassHz = 0;
+    initGyroFilters(&setup, DEBUG_NONE);
+    const gyroFilterFnPtr genericFn = gyro.filterFn;
+
+    // each stage setting picks a different variant
+    setup.lowpassHz = 150;
+    initGyroFilters(&setup, DEBUG_NONE);
+    const gyroFilterFnPtr pt1Fn = gyro.filterFn;
+    EXPECT_NE(genericFn, pt1Fn);
+
+    setup.lowpassType = FILTER_BIQUAD;
+    initGyroFilters(&setup, DEBUG_NONE);
+    const gyroFilterFnPtr biquadFn = gyro.filterFn;
+    EXPECT_NE(genericFn, biquadFn);
+    EXPECT_NE(pt1Fn, biquadFn);
+
+    setup.dynNotchWidthPercent = 8;
+    initGyroFilters(&setup, DEBUG_NONE);
+    EXPECT_NE(biquadFn, gyro.filterFn);
+    EXPECT_NE(genericFn, gyro.filterFn);
+
+    setup.dynNotchWidthPercent = 0;
+    setup.rpm = true;
+    initGyroFilters(&setup, DEBUG_NONE);
+    EXPECT_NE(biquadFn, gyro.filterFn);
+    EXPECT_NE(genericFn, gyro.filterFn);
+
+    setup.rpm = false;
+    setup.notches = true;
+    initGyroFilters(&setup, DEBUG_NONE);
+    EXPECT_NE(biquadFn, gyro.filterFn);
+    EXPECT_NE(genericFn, gyro.filterFn);
+
+    // the same setup picks the same variant again
+    setup.notches = false;
+    initGyroFilters(&setup, DEBUG_NONE);
+    EXPECT_EQ(biquadFn, gyro.filterFn);
+
+    // without the dynamic notch the generic filters run
+    featureDisableImmediate(FEATURE_DYNAMIC_FILTER);
+    gyroInitFilters();
+    EXPECT_EQ(genericFn, gyro.filterFn);
+}
+
+// STUBS
+
+extern "C" {
+
+float rpmFilterState[XYZ_AXIS_COUNT];
+
+// a simple stateful filter, so a missing or repeated rpm stage changes the output,
+// it does nothing when the rpm filter is configured off, like the real one
+void rpmFilterGyro(float *values)
+{
+    if (!motorConfig()->dev.useDshotTelemetry || !rpmFilterConfig()->gyro_rpm_notch_harmonics) {
+        return;
+    }
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        rpmFilterState[axis] += 0.25f * (values[axis] - rpmFilterState[axis]);
+        values[axis] -= 0.5f * rpmFilterState[axis];
+    }
+}
+
+uint32_t micros(void) { return 0; }
+uint8_t calculateThrottlePercentAbs(void) { return 50; }
+void beeper(beeperMode_e) {}
+uint8_t detectedSensors[] = { GYRO_NONE, ACC_NONE };
+timeDelta_t getGyroUpdateRate(void) { return gyro.targetLooptime; }
+void sensorsSet(uint32_t) {}
+void schedulerResetTaskStatistics(taskId_e) {}
+int getArmingDisableFlags(void) { return 0; }
+void writeEEPROM(void) {}
+}
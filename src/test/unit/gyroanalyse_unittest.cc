@@ -0,0 +1,345 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "build/debug.h"
+
+    #include "common/filter.h"
+    #include "common/maths.h"
+    #include "common/utils.h"
+
+    #include "flight/gyroanalyse.h"
+
+    #include "pg/pg.h"
+    #include "pg/pg_ids.h"
+
+    #include "sensors/gyro.h"
+
+    PG_REGISTER(gyroConfig_t, gyroConfig, PG_GYRO_CONFIG, 0);
+
+    gyro_t gyro;
+    uint8_t debugMode;
+    int16_t debug[DEBUG16_VALUE_COUNT];
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define LOOPTIME_US     125
+#define LOOP_RATE_HZ    (1000000 / LOOPTIME_US)
+
+static gyroAnalyseState_t state;
+static biquadFilterBank_t notchFilterDyn[DYN_NOTCH_COUNT_MAX];
+static biquadFilterBank_t notchFilterDyn2[DYN_NOTCH_COUNT_MAX];
+static float phase[3];
+
+static void initAnalyser(dynNotchEstimator_e estimator, uint8_t notchCount = 1)
+{
+    gyroConfigMutable()->dyn_notch_max_hz = 600;
+    gyroConfigMutable()->dyn_notch_width_percent = 8;
+    gyroConfigMutable()->dyn_notch_q = 120;
+    gyroConfigMutable()->dyn_notch_min_hz = 150;
+    gyroConfigMutable()->dyn_notch_estimator = estimator;
+    gyroConfigMutable()->dyn_notch_count = notchCount;
+
+    gyro.targetLooptime = LOOPTIME_US;
+    for (int notch = 0; notch < DYN_NOTCH_COUNT_MAX; notch++) {
+        biquadFilterBankInit(&notchFilterDyn[notch], 200, LOOPTIME_US, 1.2f, FILTER_NOTCH);
+        biquadFilterBankInit(&notchFilterDyn2[notch], 200, LOOPTIME_US, 1.2f, FILTER_NOTCH);
+    }
+    gyroDataAnalyseStateInit(&state, LOOPTIME_US);
+    memset(phase, 0, sizeof(phase));
+}
+
+// Runs one gyro loop with the sum of up to 3 tones on every axis, the amplitudes scaled differently on each axis
+static void runLoopTones(const float *hz, const float *amplitude, int toneCount)
+{
+    float sample = 0;
+    for (int tone = 0; tone < toneCount; tone++) {
+        phase[tone] += 2 * M_PIf * hz[tone] / LOOP_RATE_HZ;
+        if (phase[tone] > 2 * M_PIf) {
+            phase[tone] -= 2 * M_PIf;
+        }
+        sample += amplitude[tone] * sinf(phase[tone]);
+    }
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        gyroDataAnalysePush(&state, axis, (2 + axis) * sample + 5);
+    }
+    gyroDataAnalyse(&state, notchFilterDyn, notchFilterDyn2);
+}
+
+// Runs one gyro loop with a tone of the given frequency on every axis, a different amplitude on each
+static void runLoop(float hz)
+{
+    static const float amplitude = 10;
+    runLoopTones(&hz, &amplitude, 1);
+}
+
+static float trackTone(dynNotchEstimator_e estimator, float hz)
+{
+    initAnalyser(estimator);
+    for (int i = 0; i < LOOP_RATE_HZ / 2; i++) {
+        runLoop(hz);
+    }
+    return state.centerFreq[0][0];
+}
+
+static void trackTones(uint8_t notchCount, const float *hz, const float *amplitude, int toneCount)
+{
+    initAnalyser(DYN_NOTCH_ESTIMATOR_FFT, notchCount);
+    for (int i = 0; i < LOOP_RATE_HZ / 2; i++) {
+        runLoopTones(hz, amplitude, toneCount);
+    }
+}
+
+// Returns the notch of the axis with the centre frequency nearest to hz
+static int nearestNotch(int axis, float hz)
+{
+    int nearest = 0;
+    for (int notch = 1; notch < gyroConfig()->dyn_notch_count; notch++) {
+        if (fabsf(state.centerFreq[axis][notch] - hz) < fabsf(state.centerFreq[axis][nearest] - hz)) {
+            nearest = notch;
+        }
+    }
+    return nearest;
+}
+
+static int trackingCount(int axis)
+{
+    return __builtin_popcount(state.notchTrackingMask[axis]);
+}
+
+// Returns the number of gyro loops after a step from fromHz to toHz until the centre frequency of every axis is
+// within 5% of the new tone
+static int stepLatency(dynNotchEstimator_e estimator, float fromHz, float toHz)
+{
+    initAnalyser(estimator);
+    for (int i = 0; i < LOOP_RATE_HZ / 2; i++) {
+        runLoop(fromHz);
+    }
+    for (int i = 0; i < LOOP_RATE_HZ / 2; i++) {
+        runLoop(toHz);
+        bool settled = true;
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            settled = settled && fabsf(state.centerFreq[axis][0] - toHz) < 0.05f * toHz;
+        }
+        if (settled) {
+            return i;
+        }
+    }
+    return LOOP_RATE_HZ / 2;
+}
+
+TEST(GyroAnalyseUnittest, TestStationaryTone)
+{
+    static const float tones[] = { 180, 230, 310, 420, 500 };
+
+    for (unsigned i = 0; i < ARRAYLEN(tones); i++) {
+        const float fftHz = trackTone(DYN_NOTCH_ESTIMATOR_FFT, tones[i]);
+        const float sdftHz = trackTone(DYN_NOTCH_ESTIMATOR_SDFT, tones[i]);
+
+        EXPECT_NEAR(tones[i], fftHz, 3) << tones[i] << "Hz";
+        EXPECT_NEAR(tones[i], sdftHz, 3) << tones[i] << "Hz";
+        // the same spectrum, windowed a little differently
+        EXPECT_NEAR(fftHz, sdftHz, 1) << tones[i] << "Hz";
+    }
+}
+
+TEST(GyroAnalyseUnittest, TestSdftMatchesDft)
+{
+    initAnalyser(DYN_NOTCH_ESTIMATOR_SDFT);
+
+    // two minutes at 8k, so any rounding errors in the sliding DFT would have built up
+    for (int i = 0; i < LOOP_RATE_HZ * 120; i++) {
+        runLoop(200 + 150 * sinf(2 * M_PIf * i / LOOP_RATE_HZ));
+    }
+
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        float peak = 0;
+        for (int k = 0; k < SDFT_BIN_COUNT; k++) {
+            peak = fmaxf(peak, hypotf(state.sdftRe[axis][k], state.sdftIm[axis][k]));
+        }
+        ASSERT_GT(peak, 0);
+
+        for (int k = 0; k < SDFT_BIN_COUNT; k++) {
+            // DFT of the circular buffer
+            double re = 0;
+            double im = 0;
+            for (int i = 0; i < FFT_WINDOW_SIZE; i++) {
+                const float sample = state.downsampledGyroData[axis][i];
+                re += sample * cos(2 * M_PI * k * i / FFT_WINDOW_SIZE);
+                im -= sample * sin(2 * M_PI * k * i / FFT_WINDOW_SIZE);
+            }
+            EXPECT_NEAR(re, state.sdftRe[axis][k], 0.001f * peak) << "axis " << axis << " bin " << k;
+            EXPECT_NEAR(im, state.sdftIm[axis][k], 0.001f * peak) << "axis " << axis << " bin " << k;
+        }
+    }
+}
+
+TEST(GyroAnalyseUnittest, TestStepLatency)
+{
+    const int fftUp = stepLatency(DYN_NOTCH_ESTIMATOR_FFT, 200, 400);
+    const int sdftUp = stepLatency(DYN_NOTCH_ESTIMATOR_SDFT, 200, 400);
+    const int fftDown = stepLatency(DYN_NOTCH_ESTIMATOR_FFT, 400, 200);
+    const int sdftDown = stepLatency(DYN_NOTCH_ESTIMATOR_SDFT, 400, 200);
+
+    // both settle within 30ms, most of which is the time for the new tone to fill the 24ms window
+    EXPECT_LT(fftUp, LOOP_RATE_HZ * 30 / 1000);
+    EXPECT_LT(fftDown, LOOP_RATE_HZ * 30 / 1000);
+    EXPECT_LT(sdftUp, LOOP_RATE_HZ * 30 / 1000);
+    EXPECT_LT(sdftDown, LOOP_RATE_HZ * 30 / 1000);
+
+    // and the sliding DFT is never slower than the FFT
+    EXPECT_LE(sdftUp, fftUp);
+    EXPECT_LE(sdftDown, fftDown);
+}
+
+TEST(GyroAnalyseUnittest, TestSdftUpdatesEveryAxisPerSample)
+{
+    initAnalyser(DYN_NOTCH_ESTIMATOR_SDFT);
+
+    // 6 gyro loops per downsampled sample at 8k with a 600Hz maximum
+    EXPECT_EQ(6, state.maxSampleCount);
+
+    for (int i = 0; i < LOOP_RATE_HZ / 10; i++) {
+        runLoop(300);
+        // one axis is updated in each of the 3 loops after a sample
+        if (state.sampleCount == XYZ_AXIS_COUNT) {
+            EXPECT_EQ(0, state.sdftPendingAxes);
+        }
+    }
+
+    // the notch filters follow the centre frequency
+    initAnalyser(DYN_NOTCH_ESTIMATOR_SDFT);
+    for (int i = 0; i < LOOP_RATE_HZ / 2; i++) {
+        runLoop(300);
+    }
+    biquadFilterBank_t expected;
+    biquadFilterBankInit(&expected, state.centerFreq[0][0] * 0.92f, LOOPTIME_US, 1.2f, FILTER_NOTCH);
+    EXPECT_FLOAT_EQ(expected.b0[0], notchFilterDyn[0].b0[0]);
+    EXPECT_FLOAT_EQ(expected.a1[0], notchFilterDyn[0].a1[0]);
+}
+
+TEST(GyroAnalyseUnittest, TestTwoTones)
+{
+    static const float hz[] = { 200, 420 };
+    static const float amplitude[] = { 10, 7 };
+
+    trackTones(2, hz, amplitude, 2);
+
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        EXPECT_EQ(2, trackingCount(axis));
+        const int low = nearestNotch(axis, hz[0]);
+        const int high = nearestNotch(axis, hz[1]);
+        EXPECT_NE(low, high);
+        EXPECT_NEAR(hz[0], state.centerFreq[axis][low], 10) << "axis " << axis;
+        EXPECT_NEAR(hz[1], state.centerFreq[axis][high], 10) << "axis " << axis;
+    }
+
+    // a single notch follows the tallest of them, as before
+    trackTones(1, hz, amplitude, 2);
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        EXPECT_EQ(1, trackingCount(axis));
+        EXPECT_NEAR(hz[0], state.centerFreq[axis][0], 10) << "axis " << axis;
+    }
+}
+
+TEST(GyroAnalyseUnittest, TestSpareNotchHolds)
+{
+    static const float hz[] = { 200, 420 };
+    static const float amplitude[] = { 10, 7 };
+
+    trackTones(3, hz, amplitude, 2);
+    EXPECT_EQ(2, trackingCount(0));
+
+    float settledFreq[DYN_NOTCH_COUNT_MAX];
+    memcpy(settledFreq, state.centerFreq[0], sizeof(settledFreq));
+    for (int i = 0; i < LOOP_RATE_HZ / 2; i++) {
+        runLoopTones(hz, amplitude, 2);
+    }
+
+    EXPECT_EQ(2, trackingCount(0));
+    for (int notch = 0; notch < 3; notch++) {
+        if (!(state.notchTrackingMask[0] & BIT(notch))) {
+            // the notch without a peak stays where it was
+            EXPECT_FLOAT_EQ(settledFreq[notch], state.centerFreq[0][notch]);
+        }
+    }
+    EXPECT_NEAR(hz[0], state.centerFreq[0][nearestNotch(0, hz[0])], 10);
+    EXPECT_NEAR(hz[1], state.centerFreq[0][nearestNotch(0, hz[1])], 10);
+}
+
+TEST(GyroAnalyseUnittest, TestPeakHysteresis)
+{
+    static const float hz[] = { 200, 450 };
+    float amplitude[] = { 10, 0 };
+
+    // settle on the tallest tone first, so the step at start up doesn't hand out the second notch
+    trackTones(2, hz, amplitude, 2);
+
+    // 20% of the tallest peak is not enough to pick up a notch
+    amplitude[1] = 2;
+    for (int i = 0; i < LOOP_RATE_HZ / 2; i++) {
+        runLoopTones(hz, amplitude, 2);
+    }
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        EXPECT_EQ(1, trackingCount(axis)) << "axis " << axis;
+    }
+
+    // 40% is
+    amplitude[1] = 4;
+    for (int i = 0; i < LOOP_RATE_HZ / 2; i++) {
+        runLoopTones(hz, amplitude, 2);
+    }
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        EXPECT_EQ(2, trackingCount(axis)) << "axis " << axis;
+        EXPECT_NEAR(hz[1], state.centerFreq[axis][nearestNotch(axis, hz[1])], 10) << "axis " << axis;
+    }
+
+    // and once it has a notch it keeps it down to 20%
+    amplitude[1] = 2;
+    for (int i = 0; i < LOOP_RATE_HZ / 2; i++) {
+        runLoopTones(hz, amplitude, 2);
+    }
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        EXPECT_EQ(2, trackingCount(axis)) << "axis " << axis;
+    }
+
+    // but not below 15%
+    amplitude[1] = 1;
+    for (int i = 0; i < LOOP_RATE_HZ / 2; i++) {
+        runLoopTones(hz, amplitude, 2);
+    }
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        EXPECT_EQ(1, trackingCount(axis)) << "axis " << axis;
+    }
+}
+
+// STUBS
+
+extern "C" {
+
+uint32_t micros(void) { return 0; }
+uint8_t calculateThrottlePercentAbs(void) { return 50; }
+
+}
@@ -0,0 +1,107 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+
+extern "C" {
+    #include "common/histogram.h"
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+TEST(HistogramUnittest, TestBucketBounds)
+{
+    EXPECT_EQ(0, histogramBucketLowerBound(0));
+    EXPECT_EQ(1, histogramBucketLowerBound(1));
+    EXPECT_EQ(2, histogramBucketLowerBound(2));
+    EXPECT_EQ(3, histogramBucketLowerBound(3));
+    EXPECT_EQ(4, histogramBucketLowerBound(4));
+    EXPECT_EQ(6, histogramBucketLowerBound(5));
+    EXPECT_EQ(8, histogramBucketLowerBound(6));
+    EXPECT_EQ(12, histogramBucketLowerBound(7));
+    EXPECT_EQ(128, histogramBucketLowerBound(14));
+    EXPECT_EQ(192, histogramBucketLowerBound(15));
+
+    // every value lands in the bucket whose bounds contain it
+    for (uint32_t value = 0; value < histogramBucketLowerBound(HISTOGRAM_BUCKET_COUNT - 1); value++) {
+        histogram_t histogram;
+        histogramReset(&histogram);
+        histogramAdd(&histogram, value);
+        int bucket = -1;
+        for (int i = 0; i < HISTOGRAM_BUCKET_COUNT; i++) {
+            if (histogram.count[i]) {
+                bucket = i;
+            }
+        }
+        ASSERT_LE(histogramBucketLowerBound(bucket), value);
+        ASSERT_GT(histogramBucketLowerBound(bucket + 1), value);
+    }
+}
+
+TEST(HistogramUnittest, TestOverflowBucket)
+{
+    histogram_t histogram;
+    histogramReset(&histogram);
+    histogramAdd(&histogram, UINT32_MAX);
+    histogramAdd(&histogram, 1000000);
+    EXPECT_EQ(2, histogram.count[HISTOGRAM_BUCKET_COUNT - 1]);
+    EXPECT_EQ(histogramBucketLowerBound(HISTOGRAM_BUCKET_COUNT - 1), histogramPercentile(&histogram, 5000));
+}
+
+TEST(HistogramUnittest, TestPercentiles)
+{
+    histogram_t histogram;
+    histogramReset(&histogram);
+    EXPECT_EQ(0, histogramPercentile(&histogram, 5000));
+
+    // 990 samples of 10us, 9 of 100us and one of 1000us
+    for (int i = 0; i < 990; i++) {
+        histogramAdd(&histogram, 10);
+    }
+    for (int i = 0; i < 9; i++) {
+        histogramAdd(&histogram, 100);
+    }
+    histogramAdd(&histogram, 1000);
+    EXPECT_EQ(1000, histogramSampleCount(&histogram));
+
+    // results are the upper bound of the bucket the percentile falls in
+    EXPECT_EQ(11, histogramPercentile(&histogram, 5000));     // 8..11
+    EXPECT_EQ(11, histogramPercentile(&histogram, 9900));
+    EXPECT_EQ(127, histogramPercentile(&histogram, 9990));    // 96..127
+    EXPECT_EQ(1023, histogramPercentile(&histogram, 10000));  // 768..1023
+    EXPECT_EQ(11, histogramPercentile(&histogram, 0));
+}
+
+TEST(HistogramUnittest, TestSaturation)
+{
+    histogram_t histogram;
+    histogramReset(&histogram);
+    for (int i = 0; i < UINT16_MAX; i++) {
+        histogramAdd(&histogram, 5);
+    }
+    for (int i = 0; i < 100; i++) {
+        histogramAdd(&histogram, 50);
+    }
+    EXPECT_EQ(UINT16_MAX, histogram.count[4]);
+    EXPECT_EQ(100, histogram.count[11]);
+
+    // filling a bucket halves all of them, keeping their ratios
+    histogramAdd(&histogram, 5);
+    EXPECT_EQ(UINT16_MAX / 2 + 1, histogram.count[4]);
+    EXPECT_EQ(50, histogram.count[11]);
+}
@@ -0,0 +1,125 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "common/huffman.h"
+#include "common/lz.h"
+
+#include "lz_decoder.h"
+
+#define LZ_ESCAPE_SYMBOL (HUFFMAN_TABLE_SIZE - 1)
+
+// Every LZ_MAX_LITERAL_BITS bit pattern maps to the symbol whose code it starts with
+typedef struct lzDecodeEntry_s {
+    int16_t symbol;
+    uint8_t codeLen;
+} lzDecodeEntry_t;
+
+static lzDecodeEntry_t decodeTable[1 << LZ_MAX_LITERAL_BITS];
+static bool decodeTableBuilt;
+
+static void buildDecodeTable(void)
+{
+    for (int symbol = 0; symbol < HUFFMAN_TABLE_SIZE; symbol++) {
+        const int codeLen = huffmanTable[symbol].codeLen;
+        const int first = huffmanTable[symbol].code >> (16 - LZ_MAX_LITERAL_BITS);
+        for (int i = 0; i < 1 << (LZ_MAX_LITERAL_BITS - codeLen); i++) {
+            decodeTable[first + i].symbol = symbol;
+            decodeTable[first + i].codeLen = codeLen;
+        }
+    }
+    decodeTableBuilt = true;
+}
+
+typedef struct bitReader_s {
+    const uint8_t *buf;
+    int len;
+    int bitPos;
+} bitReader_t;
+
+// Bits past the end of the input read as zero
+static uint32_t peekBits(const bitReader_t *reader, int count)
+{
+    uint32_t value = 0;
+    for (int i = 0; i < count; i++) {
+        const int pos = reader->bitPos + i;
+        const int bit = pos / 8 < reader->len ? (reader->buf[pos / 8] >> (7 - pos % 8)) & 1 : 0;
+        value = (value << 1) | bit;
+    }
+    return value;
+}
+
+static bool readBits(bitReader_t *reader, int count, uint32_t *value)
+{
+    if (reader->bitPos + count > reader->len * 8) {
+        return false;
+    }
+    *value = peekBits(reader, count);
+    reader->bitPos += count;
+    return true;
+}
+
+// Decodes exactly outLen bytes, returns outLen or -1 if the input is malformed or too short
+int lzDecodeBuf(uint8_t *outBuf, int outLen, const uint8_t *inBuf, int inLen)
+{
+    if (!decodeTableBuilt) {
+        buildDecodeTable();
+    }
+
+    bitReader_t reader = { .buf = inBuf, .len = inLen, .bitPos = 0 };
+    int out = 0;
+
+    while (out < outLen) {
+        const lzDecodeEntry_t *entry = &decodeTable[peekBits(&reader, LZ_MAX_LITERAL_BITS)];
+        uint32_t code;
+        if (!readBits(&reader, entry->codeLen, &code)) {
+            return -1;
+        }
+        if (entry->symbol != LZ_ESCAPE_SYMBOL) {
+            outBuf[out++] = entry->symbol;
+            continue;
+        }
+
+        uint32_t lenCode;
+        uint32_t offsetCode;
+        if (!readBits(&reader, LZ_LENGTH_BITS, &lenCode) || !readBits(&reader, LZ_OFFSET_BITS, &offsetCode)) {
+            return -1;
+        }
+        if (lenCode == LZ_SHORT_MATCH_CODES) {
+            uint32_t longLenCode;
+            if (!readBits(&reader, LZ_LONG_LENGTH_BITS, &longLenCode)) {
+                return -1;
+            }
+            lenCode += longLenCode;
+        }
+        const int len = LZ_MIN_MATCH + lenCode;
+        const int offset = offsetCode + 1;
+        if (offset > out || out + len > outLen) {
+            return -1;
+        }
+        // byte by byte, since the match may overlap the bytes it produces
+        for (int i = 0; i < len; i++, out++) {
+            outBuf[out] = outBuf[out - offset];
+        }
+    }
+    return out;
+}
@@ -0,0 +1,222 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+extern "C" {
+    #include "common/huffman.h"
+    #include "common/lz.h"
+    #include "common/maths.h"
+
+    #include "lz_decoder.h"
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define OUTBUF_LEN 4096
+#define INBUF_LEN 16384
+
+static lzState_t state;
+static uint8_t inBuf[INBUF_LEN];
+static uint8_t outBuf[OUTBUF_LEN];
+static uint8_t decodeBuf[INBUF_LEN];
+
+static uint32_t randomState;
+
+static uint8_t randomByte(void)
+{
+    randomState = randomState * 1103515245 + 12345;
+    return randomState >> 16;
+}
+
+// Size of the same data compressed with huffmanEncodeBuf()
+static int huffmanSize(const uint8_t *buf, int len)
+{
+    int bits = 0;
+    for (int i = 0; i < len; i++) {
+        bits += huffmanTable[buf[i]].codeLen;
+    }
+    return (bits + 7) / 8;
+}
+
+// Compresses inLen bytes of inBuf, checks they decode to the same thing, and returns the compressed size
+static int roundTrip(int inLen)
+{
+    const int consumed = lzEncodeBuf(&state, outBuf, sizeof(outBuf), inBuf, inLen);
+    EXPECT_EQ(inLen, consumed);
+    EXPECT_LE(state.bytesWritten, sizeof(outBuf));
+    EXPECT_LE(state.bytesWritten, huffmanSize(inBuf, inLen));
+
+    const int decoded = lzDecodeBuf(decodeBuf, inLen, outBuf, state.bytesWritten);
+    EXPECT_EQ(inLen, decoded);
+    EXPECT_EQ(0, memcmp(inBuf, decodeBuf, inLen));
+    return state.bytesWritten;
+}
+
+TEST(LzUnittest, TestEmpty)
+{
+    EXPECT_EQ(0, roundTrip(0));
+}
+
+TEST(LzUnittest, TestLiterals)
+{
+    // too short to match, so the same as Huffman: 0x00 is 11, 0x01 is 101, then padded with zeros
+    const uint8_t literals[] = { 0x00, 0x01, 0x00 };
+    memcpy(inBuf, literals, sizeof(literals));
+    EXPECT_EQ(1, roundTrip(sizeof(literals)));
+    EXPECT_EQ(0xEE, outBuf[0]);
+}
+
+TEST(LzUnittest, TestShortMatchNotUsed)
+{
+    // a repeat that is cheaper as Huffman codes than as a match
+    const uint8_t repeated[] = { 0x00, 0x01, 0x02, 0x00, 0x01, 0x02 };
+    memcpy(inBuf, repeated, sizeof(repeated));
+    EXPECT_EQ(huffmanSize(inBuf, sizeof(repeated)), roundTrip(sizeof(repeated)));
+}
+
+TEST(LzUnittest, TestRunCompresses)
+{
+    // erased flash: one literal then overlapping matches of the maximum length
+    memset(inBuf, 0xff, OUTBUF_LEN);
+    const int compressedLen = roundTrip(OUTBUF_LEN);
+    const int matchBytes = (12 + LZ_LENGTH_BITS + LZ_OFFSET_BITS + LZ_LONG_LENGTH_BITS) / 8 + 1;
+    EXPECT_LE(compressedLen, 2 + matchBytes * (OUTBUF_LEN / LZ_MAX_MATCH + 1));
+}
+
+TEST(LzUnittest, TestMatchLengths)
+{
+    // every length up to the maximum, including the boundary between short and long length codes
+    for (int len = LZ_MIN_MATCH; len <= LZ_MAX_MATCH; len++) {
+        for (int i = 0; i < 8; i++) {
+            inBuf[i] = 0xA0 + i;
+        }
+        for (int i = 0; i < len; i++) {
+            inBuf[8 + i] = inBuf[i % 8];
+        }
+        inBuf[8 + len] = 0xB0;
+        roundTrip(8 + len + 1);
+    }
+}
+
+TEST(LzUnittest, TestIncompressible)
+{
+    randomState = 1;
+    for (int i = 0; i < INBUF_LEN; i++) {
+        inBuf[i] = randomByte();
+    }
+
+    // only as much as is guaranteed to fit is consumed, and it decodes correctly
+    const int consumed = lzEncodeBuf(&state, outBuf, sizeof(outBuf), inBuf, INBUF_LEN);
+    EXPECT_LT(consumed, OUTBUF_LEN);
+    EXPECT_GT(state.bytesWritten, OUTBUF_LEN - 16);
+    EXPECT_LE(state.bytesWritten, OUTBUF_LEN);
+    EXPECT_LE(state.bytesWritten, huffmanSize(inBuf, consumed));
+
+    const int decoded = lzDecodeBuf(decodeBuf, consumed, outBuf, state.bytesWritten);
+    EXPECT_EQ(consumed, decoded);
+    EXPECT_EQ(0, memcmp(inBuf, decodeBuf, consumed));
+}
+
+TEST(LzUnittest, TestWindow)
+{
+    // a block of random data repeated after a gap, so the repeat is just inside or just outside the window
+    randomState = 2;
+    for (int i = 0; i < 200; i++) {
+        inBuf[i] = randomByte();
+    }
+    for (int gap = LZ_WINDOW_SIZE - 300; gap <= LZ_WINDOW_SIZE + 100; gap += 100) {
+        randomState = 3;
+        for (int i = 200; i < gap; i++) {
+            inBuf[i] = randomByte();
+        }
+        memcpy(inBuf + gap, inBuf, 200);
+        const int compressedLen = roundTrip(gap + 200);
+        if (gap <= LZ_WINDOW_SIZE - 200) {
+            EXPECT_LT(compressedLen, huffmanSize(inBuf, gap + 200) - 150);
+        } else if (gap > LZ_WINDOW_SIZE) {
+            EXPECT_EQ(compressedLen, huffmanSize(inBuf, gap + 200));
+        }
+    }
+}
+
+TEST(LzUnittest, TestStructuredData)
+{
+    // records with a fixed layout and slowly changing values, like a blackbox log
+    int len = 0;
+    for (uint32_t iteration = 0; len + 16 < INBUF_LEN / 2; iteration++) {
+        inBuf[len++] = 'P';
+        inBuf[len++] = iteration & 0x7f;
+        for (int field = 0; field < 12; field++) {
+            inBuf[len++] = (field & 1) ? 0x80 | (((iteration >> 4) + field) & 0x03) : 0x40;
+        }
+    }
+    const int consumed = lzEncodeBuf(&state, outBuf, sizeof(outBuf), inBuf, len);
+    EXPECT_EQ(len, consumed);
+    EXPECT_EQ(len, lzDecodeBuf(decodeBuf, len, outBuf, state.bytesWritten));
+    EXPECT_EQ(0, memcmp(inBuf, decodeBuf, len));
+    // at least twice as good as Huffman on data like this
+    EXPECT_LT(2 * state.bytesWritten, huffmanSize(inBuf, len));
+}
+
+TEST(LzUnittest, TestStreaming)
+{
+    // blocks fed in one at a time, as the MSP dataflash read does, give the same output as lzEncodeBuf()
+    randomState = 5;
+    for (int i = 0; i < INBUF_LEN; i++) {
+        inBuf[i] = randomByte() & 0x0f;
+    }
+    static uint8_t streamedBuf[OUTBUF_LEN];
+    lzInit(&state, streamedBuf, sizeof(streamedBuf));
+    int bytesRead = 0;
+    int blockLen;
+    while ((blockLen = MIN(lzBlockCapacity(&state), INBUF_LEN - bytesRead)) > 0) {
+        memcpy(lzBlockBuffer(&state), inBuf + bytesRead, blockLen);
+        lzEncodeBlock(&state, blockLen);
+        bytesRead += blockLen;
+    }
+    const int streamedLen = lzFinish(&state);
+
+    EXPECT_EQ(bytesRead, lzEncodeBuf(&state, outBuf, sizeof(outBuf), inBuf, INBUF_LEN));
+    EXPECT_EQ(streamedLen, state.bytesWritten);
+    EXPECT_EQ(0, memcmp(streamedBuf, outBuf, streamedLen));
+}
+
+TEST(LzUnittest, TestDecodeMalformed)
+{
+    // four 0x00 literals
+    const uint8_t zeros[] = { 0xFF };
+    EXPECT_EQ(4, lzDecodeBuf(decodeBuf, 4, zeros, sizeof(zeros)));
+    EXPECT_EQ(-1, lzDecodeBuf(decodeBuf, 5, zeros, sizeof(zeros)));
+
+    // match before the start of the output
+    const uint8_t badOffset[] = { 0x00, 0x00, 0x00, 0x00 };
+    EXPECT_EQ(-1, lzDecodeBuf(decodeBuf, 4, badOffset, sizeof(badOffset)));
+
+    // match missing its offset
+    const uint8_t truncatedMatch[] = { 0xC0, 0x00 };
+    EXPECT_EQ(-1, lzDecodeBuf(decodeBuf, 4, truncatedMatch, sizeof(truncatedMatch)));
+
+    // 0x00 literal then a match of 3 with offset 1
+    const uint8_t run[] = { 0xC0, 0x00, 0x00, 0x00 };
+    EXPECT_EQ(4, lzDecodeBuf(decodeBuf, 4, run, sizeof(run)));
+    EXPECT_EQ(0, memcmp("\0\0\0\0", decodeBuf, 4));
+    EXPECT_EQ(-1, lzDecodeBuf(decodeBuf, 3, run, sizeof(run)));
+}
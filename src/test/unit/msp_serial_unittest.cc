@@ -0,0 +1,391 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include <algorithm>
+#include <deque>
+#include <vector>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "common/crc.h"
+    #include "common/streambuf.h"
+
+    #include "drivers/serial.h"
+    #include "drivers/system.h"
+
+    #include "io/serial.h"
+
+    #include "msp/msp.h"
+    #include "msp/msp_protocol.h"
+    #include "msp/msp_protocol_v2_betaflight.h"
+    #include "msp/msp_serial.h"
+
+    #include "pg/pg.h"
+    #include "pg/pg_ids.h"
+
+    PG_REGISTER(serialConfig_t, serialConfig, PG_SERIAL_CONFIG, 0);
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define TEST_TX_BUFFER_SIZE 256
+
+static timeMs_t currentTimeMs;
+
+// A serial port that receives what the test queues and reports a transmit buffer of txFree bytes
+static serialPort_t testPort;
+static std::deque<uint8_t> rxBytes;
+static std::vector<uint8_t> txBytes;
+static uint32_t txFree;
+
+// What the subscribed commands did
+static int commandRuns[2];
+static int replySize;
+
+static void testWrite(serialPort_t *, uint8_t ch)
+{
+    txBytes.push_back(ch);
+    txFree--;
+}
+
+static void testWriteBuf(serialPort_t *instance, const void *data, int count)
+{
+    for (int i = 0; i < count; i++) {
+        testWrite(instance, ((const uint8_t *)data)[i]);
+    }
+}
+
+static uint32_t testRxWaiting(const serialPort_t *)
+{
+    return rxBytes.size();
+}
+
+static uint32_t testTxFree(const serialPort_t *)
+{
+    return txFree;
+}
+
+static uint8_t testRead(serialPort_t *)
+{
+    const uint8_t c = rxBytes.front();
+    rxBytes.pop_front();
+    return c;
+}
+
+static bool testTxEmpty(const serialPort_t *)
+{
+    return txFree == TEST_TX_BUFFER_SIZE;
+}
+
+static const struct serialPortVTable testVTable = {
+    .serialWrite = testWrite,
+    .serialTotalRxWaiting = testRxWaiting,
+    .serialTotalTxFree = testTxFree,
+    .serialRead = testRead,
+    .serialSetBaudRate = NULL,
+    .isSerialTransmitBufferEmpty = testTxEmpty,
+    .setMode = NULL,
+    .setCtrlLineStateCb = NULL,
+    .setBaudRateCb = NULL,
+    .writeBuf = testWriteBuf,
+    .beginWrite = NULL,
+    .endWrite = NULL,
+};
+
+static mspResult_e testProcessCommand(mspDescriptor_t, mspPacket_t *cmd, mspPacket_t *reply, mspPostProcessFnPtr *)
+{
+    reply->cmd = cmd->cmd;
+    switch (cmd->cmd) {
+    case MSP_ATTITUDE:
+        commandRuns[0]++;
+        for (int i = 0; i < replySize; i++) {
+            sbufWriteU8(&reply->buf, i);
+        }
+        return MSP_RESULT_ACK;
+    case MSP_ANALOG:
+        commandRuns[1]++;
+        sbufWriteU8(&reply->buf, 0);
+        return MSP_RESULT_ACK;
+    default:
+        return MSP_RESULT_ERROR;
+    }
+}
+
+static void mspProcess(void)
+{
+    mspSerialProcess(MSP_SKIP_NON_MSP_DATA, testProcessCommand, NULL);
+}
+
+// Queues a MSP v2 request as the client would send it
+static void receiveRequest(uint16_t cmd, const std::vector<uint8_t> &payload)
+{
+    const uint8_t header[] = { 0, (uint8_t)(cmd & 0xff), (uint8_t)(cmd >> 8), (uint8_t)(payload.size() & 0xff), (uint8_t)(payload.size() >> 8) };
+    uint8_t crc = crc8_dvb_s2_update(0, header, sizeof(header));
+    crc = crc8_dvb_s2_update(crc, payload.data(), payload.size());
+
+    const uint8_t magic[] = { '$', 'X', '<' };
+    rxBytes.insert(rxBytes.end(), magic, magic + sizeof(magic));
+    rxBytes.insert(rxBytes.end(), header, header + sizeof(header));
+    rxBytes.insert(rxBytes.end(), payload.begin(), payload.end());
+    rxBytes.push_back(crc);
+}
+
+static void subscribe(const std::vector<std::pair<uint16_t, uint16_t>> &subscriptions)
+{
+    std::vector<uint8_t> payload;
+    for (const auto &subscription : subscriptions) {
+        payload.push_back(subscription.first & 0xff);
+        payload.push_back(subscription.first >> 8);
+        payload.push_back(subscription.second & 0xff);
+        payload.push_back(subscription.second >> 8);
+    }
+    receiveRequest(MSP2_BETAFLIGHT_SUBSCRIBE, payload);
+}
+
+// The command IDs of the MSP v2 frames sent since the last call
+static std::vector<uint16_t> sentFrames(void)
+{
+    std::vector<uint16_t> frames;
+    size_t i = 0;
+    while (i + 8 < txBytes.size()) {
+        EXPECT_EQ('$', txBytes[i]);
+        EXPECT_EQ('X', txBytes[i + 1]);
+        frames.push_back(txBytes[i + 4] | txBytes[i + 5] << 8);
+        i += 8 + (txBytes[i + 6] | txBytes[i + 7] << 8) + 1;
+    }
+    EXPECT_EQ(txBytes.size(), i);
+    txBytes.clear();
+    txFree = TEST_TX_BUFFER_SIZE;
+    return frames;
+}
+
+static int countFrames(const std::vector<uint16_t> &frames, uint16_t cmd)
+{
+    return std::count(frames.begin(), frames.end(), cmd);
+}
+
+class MspSerialSubscriptionTest : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        memset(&testPort, 0, sizeof(testPort));
+        testPort.vTable = &testVTable;
+        rxBytes.clear();
+        txBytes.clear();
+        txFree = TEST_TX_BUFFER_SIZE;
+        memset(commandRuns, 0, sizeof(commandRuns));
+        replySize = 12;
+        currentTimeMs = 1000;
+
+        mspSerialReleasePortIfAllocated(&testPort);
+        mspSerialAllocatePorts();
+    }
+};
+
+TEST_F(MspSerialSubscriptionTest, TestPushesAtTheSubscribedIntervals)
+{
+    // given
+    subscribe({ { MSP_ATTITUDE, 20 }, { MSP_ANALOG, 100 } });
+    mspProcess();
+
+    // then
+    std::vector<uint16_t> frames = sentFrames();
+    ASSERT_EQ(3, frames.size());
+    EXPECT_EQ(MSP2_BETAFLIGHT_SUBSCRIBE, frames[0]);
+    EXPECT_EQ(MSP_ATTITUDE, frames[1]);
+    EXPECT_EQ(MSP_ANALOG, frames[2]);
+
+    // when
+    for (int i = 0; i < 200; i++) {
+        currentTimeMs++;
+        mspProcess();
+    }
+
+    // then
+    frames = sentFrames();
+    EXPECT_EQ(10, countFrames(frames, MSP_ATTITUDE));
+    EXPECT_EQ(2, countFrames(frames, MSP_ANALOG));
+}
+
+TEST_F(MspSerialSubscriptionTest, TestUnsupportedCommandIsDropped)
+{
+    // given
+    subscribe({ { MSP_STATUS, 10 }, { MSP_ATTITUDE, 10 } });
+    mspProcess();
+    sentFrames();
+
+    // when
+    for (int i = 0; i < 100; i++) {
+        currentTimeMs++;
+        mspProcess();
+    }
+
+    // then
+    const std::vector<uint16_t> frames = sentFrames();
+    EXPECT_EQ(0, countFrames(frames, MSP_STATUS));
+    EXPECT_EQ(10, countFrames(frames, MSP_ATTITUDE));
+}
+
+TEST_F(MspSerialSubscriptionTest, TestUnsubscribe)
+{
+    // given
+    subscribe({ { MSP_ATTITUDE, 10 } });
+    mspProcess();
+    currentTimeMs += 10;
+    mspProcess();
+    EXPECT_EQ(2, countFrames(sentFrames(), MSP_ATTITUDE));
+
+    // when
+    subscribe({});
+    mspProcess();
+    for (int i = 0; i < 100; i++) {
+        currentTimeMs++;
+        mspProcess();
+    }
+
+    // then
+    const std::vector<uint16_t> frames = sentFrames();
+    ASSERT_EQ(1, frames.size());
+    EXPECT_EQ(MSP2_BETAFLIGHT_SUBSCRIBE, frames[0]);
+    EXPECT_EQ(2, commandRuns[0]);
+}
+
+TEST_F(MspSerialSubscriptionTest, TestPushingStopsWhenTheClientGoesIdle)
+{
+    // given
+    subscribe({ { MSP_ATTITUDE, 100 } });
+    mspProcess();
+    sentFrames();
+
+    // when
+    int pushed = 0;
+    while (currentTimeMs < 1000 + MSP_SUBSCRIPTION_TIMEOUT_MS) {
+        currentTimeMs++;
+        mspProcess();
+        pushed += countFrames(sentFrames(), MSP_ATTITUDE);
+    }
+
+    // then
+    EXPECT_EQ(MSP_SUBSCRIPTION_TIMEOUT_MS / 100, pushed);
+
+    // when
+    for (int i = 0; i < 1000; i++) {
+        currentTimeMs++;
+        mspProcess();
+    }
+
+    // then
+    EXPECT_EQ(0, sentFrames().size());
+}
+
+TEST_F(MspSerialSubscriptionTest, TestCommandDoesNotRunWhileTheReplyDoesNotFit)
+{
+    // given
+    replySize = 100;
+    subscribe({ { MSP_ATTITUDE, 10 }, { MSP_ANALOG, 10 } });
+    mspProcess();
+    sentFrames();
+    EXPECT_EQ(1, commandRuns[0]);
+
+    // when
+    txFree = 50;
+    for (int i = 0; i < 100; i++) {
+        currentTimeMs++;
+        mspProcess();
+    }
+
+    // then
+    EXPECT_EQ(1, commandRuns[0]);
+    EXPECT_EQ(1, commandRuns[1]);
+    EXPECT_TRUE(txBytes.empty());
+
+    // when
+    txFree = TEST_TX_BUFFER_SIZE;
+    currentTimeMs++;
+    mspProcess();
+
+    // then
+    const std::vector<uint16_t> frames = sentFrames();
+    ASSERT_EQ(2, frames.size());
+    EXPECT_EQ(MSP_ATTITUDE, frames[0]);
+    EXPECT_EQ(MSP_ANALOG, frames[1]);
+    EXPECT_EQ(2, commandRuns[0]);
+}
+
+TEST_F(MspSerialSubscriptionTest, TestReplyThatGrewIsNotSentPartially)
+{
+    // given
+    replySize = 10;
+    subscribe({ { MSP_ATTITUDE, 10 } });
+    mspProcess();
+    sentFrames();
+
+    // when
+    replySize = 100;
+    txFree = 50;
+    currentTimeMs += 10;
+    mspProcess();
+    currentTimeMs += 10;
+    mspProcess();
+
+    // then
+    EXPECT_TRUE(txBytes.empty());
+    EXPECT_EQ(2, commandRuns[0]);
+}
+
+// STUBS
+extern "C" {
+    timeMs_t millis(void) { return currentTimeMs; }
+
+    static uint8_t serialPortConfigIndex;
+    static serialPortConfig_t testPortConfig = { .functionMask = FUNCTION_MSP, .identifier = SERIAL_PORT_USART1, .msp_baudrateIndex = 0, .gps_baudrateIndex = 0, .blackbox_baudrateIndex = 0, .telemetry_baudrateIndex = 0 };
+
+    const serialPortConfig_t *findNextSerialPortConfig(serialPortFunction_e)
+    {
+        return serialPortConfigIndex++ ? NULL : &testPortConfig;
+    }
+
+    const serialPortConfig_t *findSerialPortConfig(serialPortFunction_e function)
+    {
+        serialPortConfigIndex = 0;
+        return findNextSerialPortConfig(function);
+    }
+
+    serialPort_t *openSerialPort(serialPortIdentifier_e, serialPortFunction_e, serialReceiveCallbackPtr, void *, uint32_t, portMode_e, portOptions_e)
+    {
+        return &testPort;
+    }
+
+    void closeSerialPort(serialPort_t *) {}
+    bool isSerialPortShared(const serialPortConfig_t *, uint16_t, serialPortFunction_e) { return false; }
+    serialPort_t *findSharedSerialPort(uint16_t, serialPortFunction_e) { return NULL; }
+    const uint32_t baudRates[] = { 0 };
+
+    mspDescriptor_t mspDescriptorAlloc(void) { return 0; }
+    void waitForSerialPortToFinishTransmitting(serialPort_t *) {}
+    void systemResetToBootloader(bootloaderRequestType_e) {}
+    void cliEnter(serialPort_t *) {}
+}
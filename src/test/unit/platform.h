@@ -112,6 +112,14 @@ typedef struct
 #define MCU_TYPE_ID   99
 #define MCU_TYPE_NAME "UNIT_TEST"
 
+// Tests that define CONFIG_IN_RAM get the config storage the firmware uses for RAM based targets
+#ifdef CONFIG_IN_RAM
+#define EEPROM_SIZE     4096
+extern uint8_t eepromData[EEPROM_SIZE];
+#define __config_start (*eepromData)
+#define __config_end (*ARRAYEND(eepromData))
+#endif
+
 #include "target.h"
 
 #include "target/common_defaults_post.h"
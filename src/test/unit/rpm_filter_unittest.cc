@@ -0,0 +1,228 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <math.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "build/debug.h"
+
+    #include "common/filter.h"
+    #include "common/maths.h"
+
+    #include "drivers/dshot.h"
+
+    #include "flight/mixer.h"
+    #include "flight/rpm_filter.h"
+
+    #include "pg/motor.h"
+    #include "pg/pg.h"
+    #include "pg/pg_ids.h"
+
+    #include "sensors/gyro.h"
+
+    float rpmNotchWeight(float frequency, float minHz, float maxHz);
+
+    PG_REGISTER(motorConfig_t, motorConfig, PG_MOTOR_CONFIG, 0);
+
+    gyro_t gyro;
+    uint8_t debugMode;
+    int16_t debug[DEBUG16_VALUE_COUNT];
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define LOOPTIME_US     125
+#define MOTOR_COUNT     4
+#define POLE_COUNT      14
+#define MIN_HZ          100
+#define MAX_HZ          (0.48f * 1e6f / LOOPTIME_US)
+#define Q               500
+#define ERPM_TO_HZ      (100.0f / 60.0f / (POLE_COUNT / 2.0f))
+
+static uint16_t dshotTelemetry[MOTOR_COUNT];
+
+// Sets the eRPM the ESC reports, returns the motor frequency the filter sees
+static float setMotorFrequency(int motor, float frequency)
+{
+    dshotTelemetry[motor] = lrintf(frequency / ERPM_TO_HZ);
+    return dshotTelemetry[motor] * ERPM_TO_HZ;
+}
+
+// Lets the rpm lowpass and the round robin of notch updates catch up with the telemetry
+static void settle(void)
+{
+    for (int i = 0; i < 2000; i++) {
+        rpmFilterUpdate();
+    }
+}
+
+static void initRpmFilter(void)
+{
+    motorConfigMutable()->dev.useDshotTelemetry = true;
+    motorConfigMutable()->motorPoleCount = POLE_COUNT;
+    gyro.targetLooptime = LOOPTIME_US;
+
+    rpmFilterConfig_t config = {
+        .gyro_rpm_notch_harmonics = 1,
+        .gyro_rpm_notch_min = MIN_HZ,
+        .gyro_rpm_notch_q = Q,
+        .dterm_rpm_notch_harmonics = 0,
+        .dterm_rpm_notch_min = MIN_HZ,
+        .dterm_rpm_notch_q = Q,
+        .rpm_lpf = 150,
+    };
+    for (int motor = 0; motor < MOTOR_COUNT; motor++) {
+        setMotorFrequency(motor, 0);
+    }
+    rpmFilterInit(&config);
+    settle();
+}
+
+static float testSignal(int sample, int axis)
+{
+    return sinf(sample * 0.37f * (axis + 1)) + 0.5f * sinf(sample * 0.05f + axis);
+}
+
+// Runs the gyro through the rpm filter and through a single notch, which starts from rest, faded in by weight
+static void expectSingleNotch(float frequency, float weight, int samples)
+{
+    biquadFilter_t notch[XYZ_AXIS_COUNT];
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        biquadFilterInit(&notch[axis], frequency, LOOPTIME_US, Q / 100.0f, FILTER_NOTCH);
+    }
+
+    for (int sample = 0; sample < samples; sample++) {
+        float values[XYZ_AXIS_COUNT];
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            values[axis] = testSignal(sample, axis);
+        }
+        rpmFilterGyro(values);
+
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            const float input = testSignal(sample, axis);
+            const float expected = input + weight * (biquadFilterApplyDF1(&notch[axis], input) - input);
+            EXPECT_NEAR(expected, values[axis], 1e-4f) << "sample " << sample << " axis " << axis;
+        }
+    }
+}
+
+static void expectNoNotch(int samples)
+{
+    for (int sample = 0; sample < samples; sample++) {
+        float values[XYZ_AXIS_COUNT];
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            values[axis] = testSignal(sample, axis);
+        }
+        rpmFilterGyro(values);
+
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            EXPECT_EQ(testSignal(sample, axis), values[axis]);
+        }
+    }
+}
+
+TEST(RpmFilterUnittest, TestNotchWeight)
+{
+    // full depth inside the band, edges included
+    EXPECT_FLOAT_EQ(1.0f, rpmNotchWeight(MIN_HZ, MIN_HZ, MAX_HZ));
+    EXPECT_FLOAT_EQ(1.0f, rpmNotchWeight(MIN_HZ + 10, MIN_HZ, MAX_HZ));
+    EXPECT_FLOAT_EQ(1.0f, rpmNotchWeight(1000, MIN_HZ, MAX_HZ));
+    EXPECT_FLOAT_EQ(1.0f, rpmNotchWeight(MAX_HZ, MIN_HZ, MAX_HZ));
+
+    // fading out beyond the edges
+    EXPECT_FLOAT_EQ(0.5f, rpmNotchWeight(MIN_HZ - 25, MIN_HZ, MAX_HZ));
+    EXPECT_FLOAT_EQ(0.5f, rpmNotchWeight(MAX_HZ + 25, MIN_HZ, MAX_HZ));
+
+    // off
+    EXPECT_FLOAT_EQ(0.0f, rpmNotchWeight(MIN_HZ - 50, MIN_HZ, MAX_HZ));
+    EXPECT_FLOAT_EQ(0.0f, rpmNotchWeight(0, MIN_HZ, MAX_HZ));
+    EXPECT_FLOAT_EQ(0.0f, rpmNotchWeight(MAX_HZ + 50, MIN_HZ, MAX_HZ));
+}
+
+TEST(RpmFilterUnittest, TestStoppedMotorsLeaveTheGyroAlone)
+{
+    // given
+    initRpmFilter();
+
+    // then
+    expectNoNotch(100);
+}
+
+TEST(RpmFilterUnittest, TestNotchAtFullDepthInsideTheBand)
+{
+    // given
+    initRpmFilter();
+
+    // when
+    const float frequency = setMotorFrequency(0, MIN_HZ + 20);
+    settle();
+
+    // then
+    // only the notch of the spinning motor is applied
+    expectSingleNotch(frequency, 1.0f, 200);
+}
+
+TEST(RpmFilterUnittest, TestNotchBelowTheBandIsClampedAndFaded)
+{
+    // given
+    initRpmFilter();
+
+    // when
+    const float frequency = setMotorFrequency(2, MIN_HZ - 20);
+    settle();
+
+    // then
+    expectSingleNotch(MIN_HZ, 1.0f - (MIN_HZ - frequency) / 50.0f, 200);
+}
+
+TEST(RpmFilterUnittest, TestNotchRestartsFromRest)
+{
+    // given
+    initRpmFilter();
+    const float frequency = setMotorFrequency(1, 200);
+    settle();
+    expectSingleNotch(frequency, 1.0f, 50);
+
+    // when
+    setMotorFrequency(1, 0);
+    settle();
+
+    // then
+    expectNoNotch(50);
+
+    // when
+    setMotorFrequency(1, 200);
+    settle();
+
+    // then
+    // no state left over from before the motor stopped
+    expectSingleNotch(frequency, 1.0f, 50);
+}
+
+// STUBS
+extern "C" {
+    uint16_t getDshotTelemetry(uint8_t index) { return dshotTelemetry[index]; }
+    uint8_t getMotorCount(void) { return MOTOR_COUNT; }
+}
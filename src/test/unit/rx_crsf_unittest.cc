@@ -20,6 +20,7 @@
 
 #include <limits.h>
 #include <algorithm>
+#include <vector>
 
 extern "C" {
     #include <platform.h>
@@ -43,7 +44,8 @@ extern "C" {
 
     rssiSource_e rssiSource;
 
-    void crsfDataReceive(uint16_t c);
+    void crsfDataReceive(uint16_t c, void *data);
+    void crsfDataReceiveSpan(const uint8_t *data, uint32_t length, timeUs_t arrivalTimeUs, void *callbackData);
     uint8_t crsfFrameCRC(void);
     uint8_t crsfFrameStatus(void);
     uint16_t crsfReadRawRC(const rxRuntimeState_t *rxRuntimeState, uint8_t chan);
@@ -270,7 +272,7 @@ TEST(CrossFireTest, TestCrsfDataReceive)
     crsfFrameDone = false;
     const uint8_t *pData = capturedData;
     for (unsigned int ii = 0; ii < sizeof(crsfRcChannelsFrame_t); ++ii) {
-        crsfDataReceive(*pData++);
+        crsfDataReceive(*pData++, NULL);
     }
     EXPECT_FALSE(crsfFrameDone); // data is not a valid rc channels frame so don't expect crsfFrameDone to be true
     EXPECT_EQ(CRSF_ADDRESS_BROADCAST, crsfFrame.frame.deviceAddress);
@@ -283,6 +285,171 @@ TEST(CrossFireTest, TestCrsfDataReceive)
     EXPECT_EQ(crc, crsfFrame.frame.payload[CRSF_FRAME_RC_CHANNELS_PAYLOAD_SIZE]);
 }
 
+// Replays of a received byte stream, as bursts of bytes that follow each other on the line
+#define CRSF_TEST_BYTE_TIME_US (10 * 1000000 / CRSF_BAUDRATE)
+
+typedef struct crsfBurst_s {
+    timeUs_t startUs;
+    std::vector<uint8_t> bytes;
+} crsfBurst_t;
+
+typedef struct crsfReceivedFrame_s {
+    timeUs_t timeUs;
+    uint32_t channels[CRSF_MAX_CHANNEL];
+} crsfReceivedFrame_t;
+
+static timeUs_t replayStartUs;
+static rxRuntimeState_t testRxRuntimeState;
+
+static std::vector<uint8_t> capturedFrame(int index)
+{
+    const uint8_t *frame = capturedData + index * sizeof(crsfRcChannelsFrame_t);
+    std::vector<uint8_t> bytes(frame, frame + sizeof(crsfRcChannelsFrame_t));
+    bytes[0] = CRSF_ADDRESS_FLIGHT_CONTROLLER;
+    return bytes;
+}
+
+static std::vector<crsfBurst_t> capturedStream(void)
+{
+    std::vector<crsfBurst_t> bursts;
+    bursts.push_back({ 1000, capturedFrame(0) });
+    // a frame cut short, the next one starts after a gap
+    const std::vector<uint8_t> frame1 = capturedFrame(1);
+    bursts.push_back({ 5000, std::vector<uint8_t>(frame1.begin(), frame1.begin() + 8) });
+    bursts.push_back({ 9000, capturedFrame(1) });
+    // a frame with a bad CRC
+    std::vector<uint8_t> corrupted = capturedFrame(0);
+    corrupted.back() ^= 0x01;
+    bursts.push_back({ 13000, corrupted });
+    // a frame with a short pause half way through
+    bursts.push_back({ 17000, std::vector<uint8_t>(frame1.begin(), frame1.begin() + 10) });
+    bursts.push_back({ 17000 + 10 * CRSF_TEST_BYTE_TIME_US + 300, std::vector<uint8_t>(frame1.begin() + 10, frame1.end()) });
+    // a frame too long for the buffer, its bytes are dropped until the gap
+    std::vector<uint8_t> oversized = capturedFrame(0);
+    oversized[1] = CRSF_FRAME_SIZE_MAX;
+    bursts.push_back({ 21000, oversized });
+    // frames back to back, with a frame that is not for the flight controller
+    std::vector<uint8_t> backToBack = capturedFrame(0);
+    backToBack.insert(backToBack.end(), capturedData, capturedData + sizeof(crsfRcChannelsFrame_t));
+    bursts.push_back({ 25000, backToBack });
+    backToBack.assign(capturedData, capturedData + sizeof(crsfRcChannelsFrame_t));
+    const std::vector<uint8_t> frame0 = capturedFrame(0);
+    backToBack.insert(backToBack.end(), frame0.begin(), frame0.end());
+    bursts.push_back({ 29000, backToBack });
+    return bursts;
+}
+
+static void pollFrame(std::vector<crsfReceivedFrame_t> *frames)
+{
+    if (crsfFrameDone) {
+        EXPECT_EQ(RX_FRAME_COMPLETE, crsfFrameStatus());
+        crsfReceivedFrame_t frame;
+        frame.timeUs = testRxRuntimeState.rcFrameTimeUsFn() - replayStartUs;
+        memcpy(frame.channels, crsfChannelData, sizeof(frame.channels));
+        frames->push_back(frame);
+    }
+}
+
+static void startReplay(void)
+{
+    // far enough from the last replay for any partial frame to be dropped
+    replayStartUs += 1000000;
+    crsfFrameDone = false;
+    crsfRxInit(rxConfig(), &testRxRuntimeState);
+}
+
+// Reference replay through the byte callback, as from the UART ISR
+static std::vector<crsfReceivedFrame_t> replayBytes(const std::vector<crsfBurst_t> &bursts)
+{
+    startReplay();
+    std::vector<crsfReceivedFrame_t> frames;
+    for (const crsfBurst_t &burst : bursts) {
+        for (unsigned i = 0; i < burst.bytes.size(); i++) {
+            dummyTimeUs = replayStartUs + burst.startUs + i * CRSF_TEST_BYTE_TIME_US;
+            crsfDataReceive(burst.bytes[i], NULL);
+            pollFrame(&frames);
+        }
+    }
+    return frames;
+}
+
+// Replay through the span callback, with each burst split into chunks of chunkSize bytes, or of pseudo random sizes
+static std::vector<crsfReceivedFrame_t> replaySpans(const std::vector<crsfBurst_t> &bursts, unsigned chunkSize)
+{
+    startReplay();
+    serialPort_t port;
+    memset(&port, 0, sizeof(port));
+    serialSetRxSpanCallback(&port, crsfDataReceiveSpan);
+
+    uint32_t state = chunkSize;
+    std::vector<crsfReceivedFrame_t> frames;
+    for (const crsfBurst_t &burst : bursts) {
+        for (unsigned i = 0; i < burst.bytes.size();) {
+            unsigned length = chunkSize;
+            if (!length) {
+                state = state * 1664525 + 1013904223;
+                length = 1 + (state >> 24) % 12;
+            }
+            length = std::min(length, (unsigned)burst.bytes.size() - i);
+            const timeUs_t arrivalTimeUs = replayStartUs + burst.startUs + (i + length - 1) * CRSF_TEST_BYTE_TIME_US;
+            serialReceiveSpan(&port, &burst.bytes[i], length, arrivalTimeUs);
+            pollFrame(&frames);
+            i += length;
+        }
+    }
+    return frames;
+}
+
+static void expectSameFrames(const std::vector<crsfReceivedFrame_t> &expected, const std::vector<crsfReceivedFrame_t> &actual)
+{
+    ASSERT_EQ(expected.size(), actual.size());
+    for (unsigned i = 0; i < expected.size(); i++) {
+        EXPECT_EQ(expected[i].timeUs, actual[i].timeUs) << "frame " << i;
+        EXPECT_EQ(0, memcmp(expected[i].channels, actual[i].channels, sizeof(expected[i].channels))) << "frame " << i;
+    }
+}
+
+TEST(CrossFireTest, TestReplayBytes)
+{
+    const std::vector<crsfBurst_t> bursts = capturedStream();
+    const std::vector<crsfReceivedFrame_t> frames = replayBytes(bursts);
+
+    // the cut short, corrupted and oversized frames are dropped, each frame is timed by its last byte
+    ASSERT_EQ(5U, frames.size());
+    EXPECT_EQ(1000 + 25 * CRSF_TEST_BYTE_TIME_US, frames[0].timeUs);
+    EXPECT_EQ(9000 + 25 * CRSF_TEST_BYTE_TIME_US, frames[1].timeUs);
+    EXPECT_EQ(17000 + 25 * CRSF_TEST_BYTE_TIME_US + 300, frames[2].timeUs);
+    EXPECT_EQ(25000 + 25 * CRSF_TEST_BYTE_TIME_US, frames[3].timeUs);
+    EXPECT_EQ(29000 + 51 * CRSF_TEST_BYTE_TIME_US, frames[4].timeUs);
+    EXPECT_EQ(983U, frames[0].channels[3]);
+    EXPECT_EQ(981U, frames[1].channels[3]);
+}
+
+TEST(CrossFireTest, TestReplaySpans)
+{
+    const std::vector<crsfBurst_t> bursts = capturedStream();
+    const std::vector<crsfReceivedFrame_t> expected = replayBytes(bursts);
+
+    for (unsigned chunkSize = 0; chunkSize <= 30; chunkSize++) {
+        SCOPED_TRACE(testing::Message() << "chunk size " << chunkSize);
+        expectSameFrames(expected, replaySpans(bursts, chunkSize));
+    }
+}
+
+TEST(CrossFireTest, TestSpanFallsBackToByteCallback)
+{
+    startReplay();
+    serialPort_t port;
+    memset(&port, 0, sizeof(port));
+    port.rxCallback = crsfDataReceive;
+
+    // without a span callback the port passes the span a byte at a time
+    const std::vector<uint8_t> frame = capturedFrame(0);
+    dummyTimeUs = replayStartUs;
+    serialReceiveSpan(&port, frame.data(), frame.size(), dummyTimeUs);
+    EXPECT_TRUE(crsfFrameDone);
+}
+
 // STUBS
 
 extern "C" {
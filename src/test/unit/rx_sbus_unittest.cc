@@ -0,0 +1,246 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include <algorithm>
+#include <vector>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "build/debug.h"
+
+    #include "drivers/serial.h"
+
+    #include "io/serial.h"
+
+    #include "pg/pg.h"
+    #include "pg/pg_ids.h"
+    #include "pg/rx.h"
+
+    #include "rx/rx.h"
+    #include "rx/sbus.h"
+    #include "rx/sbus_channels.h"
+
+    PG_REGISTER(rxConfig_t, rxConfig, PG_RX_CONFIG, 0);
+
+    uint8_t debugMode;
+    int16_t debug[DEBUG16_VALUE_COUNT];
+    rssiSource_e rssiSource;
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define SBUS_TEST_BYTE_TIME_US  120 // 12 bits at 100000 baud
+#define SBUS_TEST_FRAME_SIZE    25
+
+static timeUs_t currentTimeUs;
+static serialPort_t sbusPort;
+static rxRuntimeState_t testRxRuntimeState;
+static timeUs_t replayStartUs;
+
+// Replays of a received byte stream, as bursts of bytes that follow each other on the line
+typedef struct sbusBurst_s {
+    timeUs_t startUs;
+    std::vector<uint8_t> bytes;
+} sbusBurst_t;
+
+typedef struct sbusReceivedFrame_s {
+    uint8_t status;
+    timeUs_t timeUs;
+    uint16_t channels[SBUS_MAX_CHANNEL];
+} sbusReceivedFrame_t;
+
+static std::vector<uint8_t> sbusFrame(uint16_t firstChannel, uint8_t flags)
+{
+    std::vector<uint8_t> frame(SBUS_TEST_FRAME_SIZE, 0);
+    frame[0] = 0x0F;
+    // 16 channels of 11 bits, least significant bit first
+    for (int channel = 0; channel < 16; channel++) {
+        const uint16_t value = firstChannel + channel * 50;
+        for (int bit = 0; bit < 11; bit++) {
+            const int position = channel * 11 + bit;
+            if (value & (1 << bit)) {
+                frame[1 + position / 8] |= 1 << (position % 8);
+            }
+        }
+    }
+    frame[23] = flags;
+    return frame;
+}
+
+static std::vector<sbusBurst_t> capturedStream(void)
+{
+    const std::vector<uint8_t> frameA = sbusFrame(200, 0);
+    const std::vector<uint8_t> frameB = sbusFrame(1000, 0);
+
+    std::vector<sbusBurst_t> bursts;
+    bursts.push_back({ 1000, frameA });
+    // bytes before the start of a frame are dropped
+    std::vector<uint8_t> leading = { 0x00, 0x55 };
+    leading.insert(leading.end(), frameB.begin(), frameB.end());
+    bursts.push_back({ 10000, leading });
+    // a frame cut short, the next one starts after a gap
+    bursts.push_back({ 20000, std::vector<uint8_t>(frameA.begin(), frameA.begin() + 10) });
+    bursts.push_back({ 40000, frameA });
+    // a frame with a short pause half way through
+    bursts.push_back({ 50000, std::vector<uint8_t>(frameB.begin(), frameB.begin() + 12) });
+    bursts.push_back({ 50000 + 12 * SBUS_TEST_BYTE_TIME_US + 300, std::vector<uint8_t>(frameB.begin() + 12, frameB.end()) });
+    bursts.push_back({ 60000, sbusFrame(300, SBUS_FLAG_FAILSAFE_ACTIVE) });
+    // without a gap after a frame the next one is dropped
+    std::vector<uint8_t> backToBack = frameA;
+    backToBack.insert(backToBack.end(), frameB.begin(), frameB.end());
+    bursts.push_back({ 70000, backToBack });
+    bursts.push_back({ 80000, frameB });
+    return bursts;
+}
+
+static void pollFrame(std::vector<sbusReceivedFrame_t> *frames)
+{
+    const uint8_t status = testRxRuntimeState.rcFrameStatusFn(&testRxRuntimeState);
+    if (status != RX_FRAME_PENDING) {
+        sbusReceivedFrame_t frame;
+        frame.status = status;
+        frame.timeUs = testRxRuntimeState.rcFrameTimeUsFn() - replayStartUs;
+        memcpy(frame.channels, testRxRuntimeState.channelData, sizeof(frame.channels));
+        frames->push_back(frame);
+    }
+}
+
+static void startReplay(void)
+{
+    // far enough from the last replay for any partial frame to be dropped
+    replayStartUs += 1000000;
+    pgResetAll();
+    EXPECT_TRUE(sbusInit(rxConfig(), &testRxRuntimeState));
+    // the last frame time of the previous replay
+    pollFrame(NULL);
+}
+
+// Reference replay through the byte callback, as from the UART ISR
+static std::vector<sbusReceivedFrame_t> replayBytes(const std::vector<sbusBurst_t> &bursts)
+{
+    startReplay();
+    std::vector<sbusReceivedFrame_t> frames;
+    for (const sbusBurst_t &burst : bursts) {
+        for (unsigned i = 0; i < burst.bytes.size(); i++) {
+            currentTimeUs = replayStartUs + burst.startUs + i * SBUS_TEST_BYTE_TIME_US;
+            sbusPort.rxCallback(burst.bytes[i], sbusPort.rxCallbackData);
+            pollFrame(&frames);
+        }
+    }
+    return frames;
+}
+
+// Replay through the span callback, with each burst split into chunks of chunkSize bytes, or of pseudo random sizes
+static std::vector<sbusReceivedFrame_t> replaySpans(const std::vector<sbusBurst_t> &bursts, unsigned chunkSize)
+{
+    startReplay();
+    uint32_t state = chunkSize;
+    std::vector<sbusReceivedFrame_t> frames;
+    for (const sbusBurst_t &burst : bursts) {
+        for (unsigned i = 0; i < burst.bytes.size();) {
+            unsigned length = chunkSize;
+            if (!length) {
+                state = state * 1664525 + 1013904223;
+                length = 1 + (state >> 24) % 12;
+            }
+            length = std::min(length, (unsigned)burst.bytes.size() - i);
+            const timeUs_t arrivalTimeUs = replayStartUs + burst.startUs + (i + length - 1) * SBUS_TEST_BYTE_TIME_US;
+            serialReceiveSpan(&sbusPort, &burst.bytes[i], length, arrivalTimeUs);
+            pollFrame(&frames);
+            i += length;
+        }
+    }
+    return frames;
+}
+
+TEST(SbusUnittest, ReplayBytes)
+{
+    const std::vector<sbusReceivedFrame_t> frames = replayBytes(capturedStream());
+
+    // frames are timed by their first byte, the cut short frame and the one straight after a frame are dropped
+    ASSERT_EQ(7U, frames.size());
+    EXPECT_EQ(RX_FRAME_COMPLETE, frames[0].status);
+    EXPECT_EQ(1000U, frames[0].timeUs);
+    EXPECT_EQ(200, frames[0].channels[0]);
+    EXPECT_EQ(10000U + 2 * SBUS_TEST_BYTE_TIME_US, frames[1].timeUs);
+    EXPECT_EQ(1000, frames[1].channels[0]);
+    EXPECT_EQ(1750, frames[1].channels[15]);
+    EXPECT_EQ(40000U, frames[2].timeUs);
+    EXPECT_EQ(50000U, frames[3].timeUs);
+    // a failsafe frame does not move the frame time on
+    EXPECT_EQ(RX_FRAME_COMPLETE | RX_FRAME_FAILSAFE, frames[4].status);
+    EXPECT_EQ(50000U, frames[4].timeUs);
+    EXPECT_EQ(300, frames[4].channels[0]);
+    EXPECT_EQ(70000U, frames[5].timeUs);
+    EXPECT_EQ(200, frames[5].channels[0]);
+    EXPECT_EQ(80000U, frames[6].timeUs);
+    EXPECT_EQ(1000, frames[6].channels[0]);
+}
+
+TEST(SbusUnittest, ReplaySpans)
+{
+    const std::vector<sbusBurst_t> bursts = capturedStream();
+    const std::vector<sbusReceivedFrame_t> expected = replayBytes(bursts);
+
+    for (unsigned chunkSize = 0; chunkSize <= 60; chunkSize++) {
+        SCOPED_TRACE(testing::Message() << "chunk size " << chunkSize);
+        const std::vector<sbusReceivedFrame_t> frames = replaySpans(bursts, chunkSize);
+        ASSERT_EQ(expected.size(), frames.size());
+        for (unsigned i = 0; i < expected.size(); i++) {
+            EXPECT_EQ(expected[i].status, frames[i].status) << "frame " << i;
+            EXPECT_EQ(expected[i].timeUs, frames[i].timeUs) << "frame " << i;
+            EXPECT_EQ(0, memcmp(expected[i].channels, frames[i].channels, sizeof(expected[i].channels))) << "frame " << i;
+        }
+    }
+}
+
+// STUBS
+
+extern "C" {
+
+static serialPortConfig_t sbusPortConfig;
+
+uint32_t microsISR(void) { return currentTimeUs; }
+
+const serialPortConfig_t *findSerialPortConfig(serialPortFunction_e)
+{
+    return &sbusPortConfig;
+}
+
+serialPort_t *openSerialPort(serialPortIdentifier_e, serialPortFunction_e, serialReceiveCallbackPtr rxCallback, void *rxCallbackData,
+    uint32_t, portMode_e, portOptions_e)
+{
+    memset(&sbusPort, 0, sizeof(sbusPort));
+    sbusPort.rxCallback = rxCallback;
+    sbusPort.rxCallbackData = rxCallbackData;
+    return &sbusPort;
+}
+
+bool telemetryCheckRxPortShared(const serialPortConfig_t *, SerialRXType) { return false; }
+serialPort_t *telemetrySharedPort = NULL;
+
+}
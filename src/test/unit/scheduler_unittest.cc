@@ -16,6 +16,9 @@
  */
 
 #include <stdint.h>
+#include <string.h>
+
+#include <vector>
 
 extern "C" {
     #include "platform.h"
@@ -46,6 +49,7 @@ extern "C" {
     uint8_t unittest_scheduler_selectedTaskDynPrio;
     uint16_t unittest_scheduler_waitingTasks;
     timeDelta_t unittest_scheduler_taskRequiredTimeUs;
+    extern uint32_t unittest_scheduler_examinedTasks;
     bool taskGyroRan = false;
     bool taskFilterRan = false;
     bool taskPidRan = false;
@@ -158,6 +162,28 @@ extern "C" {
     }
 }
 
+// Set the time a task last ran, then reschedule it so the deadline queue picks up the new due time
+static void setTaskLastExecutedAtUs(taskId_e taskId, timeUs_t lastExecutedAtUs)
+{
+    tasks[taskId].lastExecutedAtUs = lastExecutedAtUs;
+    rescheduleTask(taskId, tasks[taskId].desiredPeriodUs);
+}
+
+// The scheduling tests are run with both the queue scan and the deadline queue
+class SchedulerModeUnittest : public ::testing::TestWithParam<bool>
+{
+protected:
+    virtual void SetUp()
+    {
+        schedulerUseDeadlineQueue(GetParam());
+        for (int taskId = 0; taskId < TASK_COUNT; ++taskId) {
+            schedulerResetTaskStatistics(static_cast<taskId_e>(taskId));
+        }
+    }
+};
+
+INSTANTIATE_TEST_CASE_P(ScanAndDeadlineQueue, SchedulerModeUnittest, ::testing::Bool());
+
 TEST(SchedulerUnittest, TestPriorites)
 {
     EXPECT_EQ(TASK_PRIORITY_MEDIUM_HIGH, tasks[TASK_SYSTEM].staticPriority);
@@ -335,7 +361,7 @@ TEST(SchedulerUnittest, TestSchedulerInit)
     EXPECT_EQ(&tasks[TASK_SYSTEM], queueFirst());
 }
 
-TEST(SchedulerUnittest, TestScheduleEmptyQueue)
+TEST_P(SchedulerModeUnittest, TestScheduleEmptyQueue)
 {
     queueClear();
     simulatedTime = 4000;
@@ -344,7 +370,7 @@ TEST(SchedulerUnittest, TestScheduleEmptyQueue)
     EXPECT_EQ(NULL, unittest_scheduler_selectedTask);
 }
 
-TEST(SchedulerUnittest, TestSingleTask)
+TEST_P(SchedulerModeUnittest, TestSingleTask)
 {
     schedulerInit();
     // disable all tasks except TASK_ACCEL
@@ -352,7 +378,7 @@ TEST(SchedulerUnittest, TestSingleTask)
         setTaskEnabled(static_cast<taskId_e>(taskId), false);
     }
     setTaskEnabled(TASK_ACCEL, true);
-    tasks[TASK_ACCEL].lastExecutedAtUs = 1000;
+    setTaskLastExecutedAtUs(TASK_ACCEL, 1000);
     simulatedTime = 2050;
     // run the scheduler and check the task has executed
     scheduler();
@@ -365,7 +391,7 @@ TEST(SchedulerUnittest, TestSingleTask)
     EXPECT_EQ(0, tasks[TASK_GYRO].dynamicPriority);
 }
 
-TEST(SchedulerUnittest, TestTwoTasks)
+TEST_P(SchedulerModeUnittest, TestTwoTasks)
 {
     // disable all tasks except TASK_ACCEL and TASK_ATTITUDE
     for (int taskId = 0; taskId < TASK_COUNT; ++taskId) {
@@ -377,8 +403,8 @@ TEST(SchedulerUnittest, TestTwoTasks)
     // set it up so that TASK_ACCEL ran just before TASK_ATTITUDE
     static const uint32_t startTime = 4000;
     simulatedTime = startTime;
-    tasks[TASK_ACCEL].lastExecutedAtUs = simulatedTime;
-    tasks[TASK_ATTITUDE].lastExecutedAtUs = tasks[TASK_ACCEL].lastExecutedAtUs - TEST_UPDATE_ATTITUDE_TIME;
+    setTaskLastExecutedAtUs(TASK_ACCEL, simulatedTime);
+    setTaskLastExecutedAtUs(TASK_ATTITUDE, tasks[TASK_ACCEL].lastExecutedAtUs - TEST_UPDATE_ATTITUDE_TIME);
     EXPECT_EQ(0, tasks[TASK_ATTITUDE].taskAgeCycles);
     // run the scheduler
     scheduler();
@@ -422,7 +448,7 @@ TEST(SchedulerUnittest, TestTwoTasks)
     EXPECT_EQ(&tasks[TASK_ATTITUDE], unittest_scheduler_selectedTask);
 }
 
-TEST(SchedulerUnittest, TestGyroTask)
+TEST_P(SchedulerModeUnittest, TestGyroTask)
 {
     static const uint32_t startTime = 4000;
 
@@ -508,7 +534,7 @@ TEST(SchedulerUnittest, TestGyroTask)
 
 // Test the scheduling logic that prevents other tasks from running if they
 // might interfere with the timing of the next gyro task.
-TEST(SchedulerUnittest, TestGyroLookahead)
+TEST_P(SchedulerModeUnittest, TestGyroLookahead)
 {
     static const uint32_t startTime = 4000;
 
@@ -537,7 +563,7 @@ TEST(SchedulerUnittest, TestGyroLookahead)
     // set it up so TASK_GYRO just ran and TASK_ACCEL is ready to run
     simulatedTime = startTime;
     tasks[TASK_GYRO].lastExecutedAtUs = simulatedTime;
-    tasks[TASK_ACCEL].lastExecutedAtUs = simulatedTime - TASK_PERIOD_HZ(1000);
+    setTaskLastExecutedAtUs(TASK_ACCEL, simulatedTime - TASK_PERIOD_HZ(1000));
     // reset the flags
     resetGyroTaskTestFlags();
 
@@ -554,7 +580,7 @@ TEST(SchedulerUnittest, TestGyroLookahead)
     // set it up so TASK_GYRO will run soon and TASK_ACCEL is ready to run
     simulatedTime = startTime;
     tasks[TASK_GYRO].lastExecutedAtUs = simulatedTime - TASK_PERIOD_HZ(TEST_GYRO_SAMPLE_HZ) + GYRO_TASK_GUARD_INTERVAL_US / 2;
-    tasks[TASK_ACCEL].lastExecutedAtUs = simulatedTime - TASK_PERIOD_HZ(1000);
+    setTaskLastExecutedAtUs(TASK_ACCEL, simulatedTime - TASK_PERIOD_HZ(1000));
     // reset the flags
     resetGyroTaskTestFlags();
 
@@ -571,7 +597,7 @@ TEST(SchedulerUnittest, TestGyroLookahead)
     // set it up so TASK_GYRO will run soon and TASK_ACCEL is ready to run
     simulatedTime = startTime;
     tasks[TASK_GYRO].lastExecutedAtUs = simulatedTime - TASK_PERIOD_HZ(TEST_GYRO_SAMPLE_HZ) + TEST_UPDATE_ACCEL_TIME / 2;
-    tasks[TASK_ACCEL].lastExecutedAtUs = simulatedTime - TASK_PERIOD_HZ(1000);
+    setTaskLastExecutedAtUs(TASK_ACCEL, simulatedTime - TASK_PERIOD_HZ(1000));
     // reset the flags
     resetGyroTaskTestFlags();
 
@@ -588,7 +614,7 @@ TEST(SchedulerUnittest, TestGyroLookahead)
     // set it up so TASK_GYRO will run now and TASK_ACCEL is ready to run
     simulatedTime = startTime;
     tasks[TASK_GYRO].lastExecutedAtUs = simulatedTime - TASK_PERIOD_HZ(TEST_GYRO_SAMPLE_HZ);
-    tasks[TASK_ACCEL].lastExecutedAtUs = simulatedTime - TASK_PERIOD_HZ(1000);
+    setTaskLastExecutedAtUs(TASK_ACCEL, simulatedTime - TASK_PERIOD_HZ(1000));
     // reset the flags
     resetGyroTaskTestFlags();
 
@@ -605,3 +631,110 @@ TEST(SchedulerUnittest, TestGyroLookahead)
     // TASK_ACCEL should have run
     EXPECT_EQ(&tasks[TASK_ACCEL], unittest_scheduler_selectedTask);
 }
+
+typedef struct {
+    task_t *selectedTask;
+    uint16_t waitingTasks;
+    uint32_t timeUs;
+} schedulerPass_t;
+
+static uint32_t runFullTaskTable(bool useDeadlineQueue, int passCount, std::vector<schedulerPass_t> &passes)
+{
+    schedulerUseDeadlineQueue(useDeadlineQueue);
+    schedulerEnableGyro();
+    schedulerInit();
+    for (int taskId = 0; taskId < TASK_COUNT; ++taskId) {
+        setTaskEnabled(static_cast<taskId_e>(taskId), true);
+    }
+    taskFilterReady = true;
+    taskPidReady = true;
+    unittest_scheduler_examinedTasks = 0;
+
+    for (int ii = 0; ii < passCount; ++ii) {
+        scheduler();
+        schedulerPass_t pass = { unittest_scheduler_selectedTask, unittest_scheduler_waitingTasks, simulatedTime };
+        passes.push_back(pass);
+        simulatedTime += 1; // the scheduler loop itself takes time
+    }
+
+    return unittest_scheduler_examinedTasks;
+}
+
+// Parameterised on schedulerOptimizeRate(), registered after the mode tests since it leaves the gyro enabled
+class SchedulerFullTaskTableUnittest : public ::testing::TestWithParam<bool>
+{
+};
+
+INSTANTIATE_TEST_CASE_P(OptimizeRate, SchedulerFullTaskTableUnittest, ::testing::Bool());
+
+// Run every task in the table with both scheduling modes and check they make the same decisions,
+// and that the deadline queue examines fewer tasks per pass than the queue scan.
+TEST_P(SchedulerFullTaskTableUnittest, TestOverhead)
+{
+    static const int passCount = 100000;
+    schedulerOptimizeRate(GetParam());
+    static uint8_t initialTasks[sizeof(tasks)];
+    memcpy(initialTasks, tasks, sizeof(tasks));
+
+    std::vector<schedulerPass_t> scanPasses;
+    simulatedTime = 0;
+    const uint32_t scanExaminedTasks = runFullTaskTable(false, passCount, scanPasses);
+
+    memcpy(static_cast<void *>(tasks), initialTasks, sizeof(tasks));
+    std::vector<schedulerPass_t> deadlinePasses;
+    simulatedTime = 0;
+    const uint32_t deadlineExaminedTasks = runFullTaskTable(true, passCount, deadlinePasses);
+
+    memcpy(static_cast<void *>(tasks), initialTasks, sizeof(tasks));
+    schedulerUseDeadlineQueue(false);
+    schedulerOptimizeRate(false);
+
+    ASSERT_EQ(scanPasses.size(), deadlinePasses.size());
+    int tasksRun = 0;
+    for (unsigned ii = 0; ii < scanPasses.size(); ++ii) {
+        ASSERT_EQ(scanPasses[ii].selectedTask, deadlinePasses[ii].selectedTask) << "pass " << ii;
+        ASSERT_EQ(scanPasses[ii].waitingTasks, deadlinePasses[ii].waitingTasks) << "pass " << ii;
+        ASSERT_EQ(scanPasses[ii].timeUs, deadlinePasses[ii].timeUs) << "pass " << ii;
+        if (scanPasses[ii].selectedTask) {
+            tasksRun++;
+        }
+    }
+    EXPECT_GT(tasksRun, 0);
+    EXPECT_GT(simulatedTime, 1000000U);
+
+    // overhead per pass, measured in tasks examined
+    const float scanTasksPerPass = static_cast<float>(scanExaminedTasks) / passCount;
+    const float deadlineTasksPerPass = static_cast<float>(deadlineExaminedTasks) / passCount;
+    printf("tasks examined per pass: scan %.2f, deadline queue %.2f\n", scanTasksPerPass, deadlineTasksPerPass);
+    EXPECT_LT(deadlineTasksPerPass, scanTasksPerPass / 2);
+}
+
+TEST_P(SchedulerFullTaskTableUnittest, TestHistograms)
+{
+    schedulerOptimizeRate(GetParam());
+    static uint8_t initialTasks[sizeof(tasks)];
+    memcpy(initialTasks, tasks, sizeof(tasks));
+
+    schedulerResetTaskHistograms();
+    std::vector<schedulerPass_t> passes;
+    simulatedTime = 0;
+    runFullTaskTable(false, 20000, passes);
+
+    memcpy(static_cast<void *>(tasks), initialTasks, sizeof(tasks));
+    schedulerOptimizeRate(false);
+
+    // execution times are fixed, so they fall in a single bucket
+    EXPECT_EQ(47, histogramPercentile(getTaskExecutionTimeHistogram(TASK_ACCEL), 5000));   // 32..47
+    EXPECT_EQ(47, histogramPercentile(getTaskExecutionTimeHistogram(TASK_ACCEL), 9990));
+    EXPECT_EQ(31, histogramPercentile(getTaskExecutionTimeHistogram(TASK_SERIAL), 5000));  // 24..31
+    EXPECT_EQ(63, histogramPercentile(getTaskExecutionTimeHistogram(TASK_PID), 5000));     // 48..63
+
+    EXPECT_GT(histogramSampleCount(getTaskLatenessHistogram(TASK_ACCEL)), 0U);
+    EXPECT_GT(histogramSampleCount(getTaskLatenessHistogram(TASK_GYRO)), 0U);
+    // other tasks are held back near the gyro sample time, so are started late
+    EXPECT_GT(histogramPercentile(getTaskLatenessHistogram(TASK_ACCEL), 9900), 0U);
+
+    const histogram_t *gyroPeriodJitter = getGyroPeriodJitterHistogram();
+    EXPECT_GT(histogramSampleCount(gyroPeriodJitter), 1000U);
+    EXPECT_LT(histogramPercentile(gyroPeriodJitter, 9990), static_cast<uint32_t>(TASK_PERIOD_HZ(TEST_GYRO_SAMPLE_HZ)));
+}
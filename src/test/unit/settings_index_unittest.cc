@@ -0,0 +1,79 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <ctype.h>
+#include <stdint.h>
+#include <string.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "build/debug.h"
+
+    #include "cli/settings.h"
+    #include "cli/settings_index.h"
+
+    #include "sensors/current.h"
+    #include "sensors/voltage.h"
+
+    const char * const currentMeterSourceNames[] = { "NONE" };
+    const char * const debugModeNames[] = { "NONE" };
+    const char * const voltageMeterSourceNames[] = { "NONE" };
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+TEST(SettingsIndexUnittest, TestIndexIsSorted)
+{
+    // valueTableNameIndex is generated by the build, this checks the generator
+    ASSERT_GT(valueTableEntryCount, 100);
+    for (unsigned i = 1; i < valueTableEntryCount; i++) {
+        const char *previous = valueTable[valueTableNameIndex[i - 1]].name;
+        const char *name = valueTable[valueTableNameIndex[i]].name;
+        // strictly increasing, so there are no duplicate names either
+        EXPECT_LT(strcasecmp(previous, name), 0) << previous << " " << name;
+    }
+}
+
+TEST(SettingsIndexUnittest, TestEveryNameIsFound)
+{
+    char name[64];
+    for (unsigned i = 0; i < valueTableEntryCount; i++) {
+        const uint8_t length = strlen(valueTable[i].name);
+        EXPECT_EQ(i, settingsIndexFind(valueTable[i].name, length)) << valueTable[i].name;
+
+        for (unsigned j = 0; j <= length; j++) {
+            name[j] = toupper(valueTable[i].name[j]);
+        }
+        EXPECT_EQ(i, settingsIndexFind(name, length)) << name;
+    }
+}
+
+TEST(SettingsIndexUnittest, TestOnlyExactNamesAreFound)
+{
+    // the length passed in is what counts, not the terminator, as the name is part of a command line
+    const char *line = "gyro_lowpass_hz = 100";
+    const uint16_t index = settingsIndexFind(line, strlen("gyro_lowpass_hz"));
+    ASSERT_LT(index, valueTableEntryCount);
+    EXPECT_STREQ("gyro_lowpass_hz", valueTable[index].name);
+
+    EXPECT_EQ(valueTableEntryCount, settingsIndexFind(line, strlen("gyro_lowpass_h")));
+    EXPECT_EQ(valueTableEntryCount, settingsIndexFind("gyro_lowpass_hzz", strlen("gyro_lowpass_hzz")));
+    EXPECT_EQ(valueTableEntryCount, settingsIndexFind("", 0));
+    EXPECT_EQ(valueTableEntryCount, settingsIndexFind("~", 1));
+}
@@ -0,0 +1,134 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include <thread>
+
+extern "C" {
+    #include "common/spsc_ring.h"
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define RING_SIZE 16
+
+TEST(SpscRingUnittest, TestWriteRead)
+{
+    uint8_t buffer[RING_SIZE];
+    spscRing_t ring;
+    spscRingInit(&ring, buffer, sizeof(buffer));
+
+    EXPECT_EQ(RING_SIZE, spscRingSize(&ring));
+    EXPECT_EQ(0, spscRingCount(&ring));
+    EXPECT_EQ(RING_SIZE, spscRingFree(&ring));
+
+    const uint8_t data[20] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20 };
+    uint8_t out[20];
+
+    // writes are truncated to the free space
+    EXPECT_EQ(RING_SIZE, spscRingWrite(&ring, data, sizeof(data)));
+    EXPECT_EQ(0, spscRingFree(&ring));
+    EXPECT_EQ(0, spscRingWrite(&ring, data, 1));
+
+    EXPECT_EQ(10, spscRingRead(&ring, out, 10));
+    EXPECT_EQ(0, memcmp(out, data, 10));
+
+    // wraps around the end of the buffer
+    EXPECT_EQ(4, spscRingWrite(&ring, data + 16, 4));
+    EXPECT_EQ(10, spscRingCount(&ring));
+    EXPECT_EQ(10, spscRingRead(&ring, out, sizeof(out)));
+    EXPECT_EQ(0, memcmp(out, data + 10, 10));
+    EXPECT_EQ(0, spscRingCount(&ring));
+}
+
+TEST(SpscRingUnittest, TestSpans)
+{
+    uint8_t buffer[RING_SIZE];
+    spscRing_t ring;
+    spscRingInit(&ring, buffer, sizeof(buffer));
+
+    const uint8_t data[12] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 };
+    uint8_t out[12];
+    spscRingWrite(&ring, data, sizeof(data));
+    spscRingRead(&ring, out, sizeof(out));
+
+    // the spans stop at the end of the buffer
+    uint8_t *writeSpan;
+    EXPECT_EQ(4, spscRingWriteSpan(&ring, &writeSpan));
+    EXPECT_EQ(buffer + 12, writeSpan);
+    memcpy(writeSpan, data, 4);
+    spscRingCommit(&ring, 4);
+    EXPECT_EQ(12, spscRingWriteSpan(&ring, &writeSpan));
+    EXPECT_EQ(buffer, writeSpan);
+    memcpy(writeSpan, data + 4, 2);
+    spscRingCommit(&ring, 2);
+
+    const uint8_t *readSpan;
+    EXPECT_EQ(4, spscRingReadSpan(&ring, &readSpan));
+    EXPECT_EQ(0, memcmp(readSpan, data, 4));
+    spscRingConsume(&ring, 4);
+    EXPECT_EQ(2, spscRingReadSpan(&ring, &readSpan));
+    EXPECT_EQ(0, memcmp(readSpan, data + 4, 2));
+    spscRingConsume(&ring, 2);
+    EXPECT_EQ(0, spscRingReadSpan(&ring, &readSpan));
+}
+
+TEST(SpscRingUnittest, TestProducerConsumerThreads)
+{
+    static uint8_t buffer[64];
+    static spscRing_t ring;
+    spscRingInit(&ring, buffer, sizeof(buffer));
+
+    const uint32_t total = 100000;
+
+    std::thread producer([&]() {
+        uint32_t next = 0;
+        while (next < total) {
+            uint8_t chunk[7];
+            const uint32_t len = total - next < sizeof(chunk) ? total - next : sizeof(chunk);
+            for (uint32_t i = 0; i < len; i++) {
+                chunk[i] = (next + i) * 31;
+            }
+            const uint32_t written = spscRingWrite(&ring, chunk, len);
+            if (written == 0) {
+                std::this_thread::yield();
+            }
+            next += written;
+        }
+    });
+
+    uint32_t received = 0;
+    uint32_t mismatches = 0;
+    while (received < total) {
+        uint8_t chunk[13];
+        const uint32_t len = spscRingRead(&ring, chunk, sizeof(chunk));
+        if (len == 0) {
+            std::this_thread::yield();
+        }
+        for (uint32_t i = 0; i < len; i++) {
+            mismatches += chunk[i] != (uint8_t)((received + i) * 31);
+        }
+        received += len;
+    }
+    producer.join();
+
+    EXPECT_EQ(total, received);
+    EXPECT_EQ(0, mismatches);
+}
@@ -0,0 +1,68 @@
+#
+# This file is part of Cleanflight and Betaflight.
+#
+# Cleanflight and Betaflight are free software. You can redistribute
+# this software and/or modify this software under the terms of the
+# GNU General Public License as published by the Free Software
+# Foundation, either version 3 of the License, or (at your option)
+# any later version.
+#
+# Cleanflight and Betaflight are distributed in the hope that they
+# will be useful, but WITHOUT ANY WARRANTY; without even the implied
+# warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+# See the GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this software.
+#
+# If not, see <http://www.gnu.org/licenses/>.
+#
+
+# Reads the preprocessed cli/settings.c and prints the valueTable indexes in
+# name order, ignoring case, as the body of valueTableNameIndex[].
+#
+# Which settings valueTable has depends on the target, so the build runs this
+# over each target's own preprocessed source, see the Makefile. Run it with
+# LC_ALL=C so names compare byte by byte the way settingsIndexFind() does.
+
+/^const clivalue_t valueTable\[\] = \{/ {
+    inTable = 1
+    next
+}
+
+inTable && /^\};/ {
+    inTable = 0
+}
+
+# every entry starts on its own line with its name, line markers are skipped
+inTable && /^[ \t]*\{[ \t]*"/ {
+    name = $0
+    sub(/^[ \t]*\{[ \t]*"/, "", name)
+    sub(/".*/, "", name)
+    names[count++] = tolower(name)
+}
+
+END {
+    if (count == 0) {
+        print "settings_name_index.awk: no valueTable entries found" > "/dev/stderr"
+        exit 1
+    }
+
+    for (i = 0; i < count; i++) {
+        order[i] = i
+    }
+
+    # insertion sort, the table is only a few hundred entries
+    for (i = 1; i < count; i++) {
+        entry = order[i]
+        for (j = i; j > 0 && names[order[j - 1]] > names[entry]; j--) {
+            order[j] = order[j - 1]
+        }
+        order[j] = entry
+    }
+
+    print "// this file is automatically generated by src/utils/settings_name_index.awk, do not edit"
+    for (i = 0; i < count; i++) {
+        printf("    %d,\n", order[i])
+    }
+}